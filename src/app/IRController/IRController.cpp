@@ -47,6 +47,8 @@ LV_IMG_DECLARE(info_1_16px);
 // declare callback functions for the app and widget icon to enter the app
 static void enter_IRController_event_cb( lv_obj_t * obj, lv_event_t event );
 static void enter_ircontroller_widget_event_cb( lv_obj_t * obj, lv_event_t event );
+static void IRController_create_cb( void );
+static void IRController_destroy_cb( void );
 
 /*
  * setup routine for example app
@@ -74,11 +76,25 @@ void IRController_setup( void ) {
     widget_set_indicator( ircontroller_widget, ICON_INDICATOR_UPDATE );
 #endif // EXAMPLE_WIDGET
 
-    // init main and setup tile, see IRController_main.cpp and IRController_setup.cpp
+    // main tile is build on the first use and deleted when not used for a while
+    mainbar_add_app_tile_lifecycle_cb( IRController_main_tile_num, IRController_create_cb, IRController_destroy_cb );
+}
+
+/*
+ * init main and setup tile, see IRController_main.cpp and IRController_setup.cpp
+ */
+static void IRController_create_cb( void ) {
     IRController_main_setup( IRController_main_tile_num );
     //IRController_setup_setup( IRController_setup_tile_num ); //No use just yet
 }
 
+/*
+ * forget all objects, the tile is already cleaned
+ */
+static void IRController_destroy_cb( void ) {
+    IRController_main_destroy();
+}
+
 /*
  *
  */
@@ -178,6 +178,11 @@ void IRController_main_setup( uint32_t tile_num ) {
     
 }
 
+void IRController_main_destroy( void ) {
+    lv_style_reset( &IRController_main_style );
+    IRController_main_tile = NULL;
+}
+
 /*//Not yet in use
 static void enter_IRController_setup_event_cb( lv_obj_t * obj, lv_event_t event ) {
     switch( event ) {
@@ -25,6 +25,7 @@
     #include <TTGO.h>
 
     void IRController_main_setup( uint32_t tile_num );
+    void IRController_main_destroy( void );
 
 #endif // _EXAMPLE_APP_MAIN_H
 
@@ -10,271 +10,393 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_IRCONTROLLER_64PX uint8_t IRController_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x13, 0xc0, 0x34, 0xc0, 0x5c, 0xc0, 0x7c, 0xc0, 0x94, 0xc0, 0xac, 0xc0, 0xaf, 0xc0, 0xaf, 0xc0, 0xb0, 0xc0, 0x9c, 0xc0, 0x83, 0xc0, 0x60, 0xc0, 0x38, 0xc0, 0x17, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xc0, 0x37, 0xc0, 0x83, 0xc0, 0xcb, 0xc0, 0xef, 0xc0, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfb, 0xc0, 0xef, 0xc0, 0xc8, 0xc0, 0x80, 0xc0, 0x37, 0xa0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0xc0, 0x70, 0xc0, 0xd3, 0xc0, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0xfb, 0xc0, 0xf8, 0xc0, 0xf8, 0xc0, 0xfb, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0xd3, 0xc0, 0x73, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x13, 0xc0, 0x83, 0xc0, 0xeb, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xf7, 0xc0, 0xdb, 0xc0, 0xa7, 0xc0, 0x7b, 0xc0, 0x57, 0xc0, 0x3c, 0xc0, 0x30, 0xc0, 0x20, 0xc0, 0x1f, 0xc0, 0x2b, 0xc0, 0x30, 0xc0, 0x4f, 0xc0, 0x78, 0xc0, 0xa8, 0xc0, 0xdc, 0xc0, 0xfb, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xef, 0xc0, 0x7f, 0xc0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x60, 0xc0, 0xe4, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0xcb, 0xc0, 0x73, 0xc0, 0x27, 0xa0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x07, 0xc0, 0x2c, 0xc0, 0x78, 0xc0, 0xd0, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xe8, 0xc0, 0x67, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x23, 0xc0, 0xb4, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xf7, 0xc0, 0xa4, 0xc0, 0x38, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xc0, 0x3f, 0xc0, 0xa7, 0xc0, 0xf4, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xb8, 0xc0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x50, 0xc0, 0xe7, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0xb0, 0xc0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xc0, 0x2f, 0xc0, 0xb0, 0xc0, 0xfb, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xeb, 0xc0, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xc0, 0x7c, 0xc0, 0xf8, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xe3, 0xc0, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x50, 0xc0, 0xdf, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfb, 0xc0, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xc0, 0x94, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xb0, 0xc0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x17, 0xc0, 0xa8, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x94, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x80, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0x83, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x04, 0xc0, 0x7c, 0xc0, 0xfb, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x28, 0xc0, 0xe3, 0xc0, 0xf8, 0xc0, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x40, 0x10, 0xa0, 0x04, 0x60, 0x14, 0x20, 0x4f, 0x00, 0x48, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x4c, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x63, 0xc0, 0xf7, 0xc0, 0xe4, 0xc0, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x2f, 0xc0, 0x58, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x4f, 0x00, 0x30, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2c, 0x80, 0x10, 0x60, 0x80, 0xc0, 0x83, 0xa0, 0xc0, 0x80, 0xe7, 0xa0, 0xe8, 0xc0, 0xec, 0xa0, 0xef, 0xa0, 0xec, 0xa0, 0xdb, 0xa0, 0xbf, 0xc0, 0x84, 0x60, 0x83, 0x20, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x03, 0x00, 0x37, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x5b, 0xc0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x30, 0x00, 0x00, 0x40, 0x60, 0xa0, 0x93, 0xc0, 0xe4, 0xa0, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xa0, 0xff, 0xa0, 0xff, 0xc0, 0xff, 0xa0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xa0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xa0, 0xef, 0xc0, 0x8f, 0x80, 0x30, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, 0x4c, 0xc0, 0xa3, 0xa0, 0xf7, 0xc0, 0xff, 0xc0, 0xff, 0xa0, 0xff, 0xc0, 0xff, 0xc0, 0xfb, 0xa0, 0xf4, 0xa0, 0xdf, 0xc0, 0xc8, 0x80, 0xdb, 0xc0, 0xdb, 0xc0, 0xf0, 0xa0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xa0, 0xff, 0xc0, 0xff, 0xa0, 0xf7, 0x80, 0xb0, 0xc0, 0x1b, 0x00, 0x13, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xa0, 0x6f, 0xa0, 0xf3, 0xc0, 0xff, 0xa0, 0xff, 0xa0, 0xff, 0xc0, 0xf7, 0x80, 0xcf, 0xc0, 0x67, 0xc0, 0x2b, 0x20, 0x4c, 0x20, 0x14, 0xe0, 0x00, 0x00, 0x54, 0x80, 0x04, 0x60, 0x0b, 0x40, 0x70, 0xc0, 0x68, 0xc0, 0xb0, 0xa0, 0xf7, 0xc0, 0xff, 0xc0, 0xff, 0xa0, 0xff, 0xc0, 0xeb, 0x80, 0x7b, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xc0, 0x98, 0xa0, 0xfc, 0xa0, 0xff, 0xc0, 0xff, 0xa0, 0xf0, 0x80, 0xb4, 0x40, 0x5c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4b, 0x00, 0x50, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x20, 0x64, 0xc0, 0x84, 0xc0, 0xef, 0xa0, 0xff, 0xa0, 0xff, 0xa0, 0xfc, 0xa0, 0x9f, 0xa0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0b, 0xc0, 0xbb, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0xa7, 0xc0, 0x1c, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc0, 0x1b, 0xc0, 0xa4, 0xa0, 0xfb, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xb7, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x47, 0xc0, 0xf8, 0xc0, 0xff, 0xc0, 0xf0, 0xc0, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc0, 0x60, 0xc0, 0xf3, 0xc0, 0xff, 0xc0, 0xfb, 0xc0, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x68, 0xc0, 0xe8, 0xc0, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x43, 0xc0, 0xe4, 0xc0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x07, 0xc0, 0x28, 0xc0, 0x4f, 0xc0, 0x4f, 0xc0, 0x4f, 0xc0, 0x4c, 0xc0, 0x28, 0xa0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x17, 0xc0, 0x74, 0xc0, 0xd3, 0xc0, 0xf8, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xfb, 0xc0, 0xdb, 0xc0, 0x80, 0xc0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xc0, 0x6b, 0xc0, 0xe8, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xec, 0xc0, 0x6b, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0xc0, 0xa7, 0xc0, 0xfc, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0xc3, 0xc0, 0x7f, 0xc0, 0x58, 0xc0, 0x30, 0xc0, 0x2b, 0xc0, 0x50, 0xc0, 0x74, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xa8, 0xa0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x13, 0xc0, 0xc4, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xbc, 0xc0, 0x38, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xc0, 0x34, 0xc0, 0xbf, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xc3, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x08, 0xc0, 0xc4, 0xc0, 0xff, 0xc0, 0xfb, 0xc0, 0x78, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x07, 0xc0, 0x7c, 0xc0, 0xf8, 0xc0, 0xff, 0xc0, 0xbc, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x1f, 0xc0, 0xeb, 0xc0, 0xf7, 0xc0, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x5f, 0xc0, 0xf7, 0xc0, 0xe8, 0xa0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x50, 0xc0, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x6c, 0xc0, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x48, 0x44, 0x9c, 0x44, 0xb0, 0x44, 0xa0, 0x44, 0x57, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0c, 0x44, 0xb0, 0x44, 0xff, 0x44, 0xff, 0x44, 0xff, 0x44, 0xff, 0x44, 0xff, 0x44, 0xcb, 0x44, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xa4, 0x44, 0xff, 0x44, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x44, 0xff, 0x44, 0xff, 0x44, 0xd0, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3f, 0x44, 0xff, 0x44, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x44, 0xff, 0x44, 0xff, 0x44, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x77, 0x8d, 0xd7, 0x44, 0xff, 0x40, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x40, 0xff, 0x44, 0xff, 0x44, 0xdc, 0x6e, 0x77, 0xb6, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x4f, 0xff, 0xe8, 0xff, 0xff, 0xb2, 0xff, 0x89, 0xff, 0x69, 0xff, 0x49, 0xff, 0x45, 0xff, 0x45, 0xff, 0x45, 0xff, 0x44, 0xff, 0x45, 0xff, 0x45, 0xff, 0x45, 0xff, 0x92, 0xff, 0xb6, 0xe8, 0xdb, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x5f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf3, 0xdb, 0x8f, 0xdb, 0x54, 0xb7, 0x37, 0x92, 0x2f, 0x92, 0x2c, 0x6e, 0x2c, 0x6d, 0x2c, 0x49, 0x2c, 0x6e, 0x34, 0x6e, 0x50, 0x6e, 0x88, 0x92, 0xf0, 0xb6, 0xff, 0xdb, 0xfc, 0xdb, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2c, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x18, 0xb6, 0xbf, 0xb7, 0xff, 0xdb, 0xf7, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xd0, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x0c, 0xb7, 0xcf, 0xdb, 0xff, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x68, 0xff, 0xff, 0xff, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xd3, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x9f, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0xff, 0xff, 0xdb, 0x84, 0x00, 0x00, 0xc0, 0x24, 0xc0, 0x8b, 0xc0, 0x8b, 0xc0, 0x8b, 0xc0, 0x24, 0x00, 0x17, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x84, 0x00, 0x17, 0x00, 0x17, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x84, 0x00, 0x17, 0x00, 0x00, 0xdb, 0x84, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0xdb, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0xc0, 0x7f, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x7f, 0x00, 0x74, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x74, 0x00, 0x74, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x74, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0xc0, 0x23, 0xc0, 0x8b, 0xc0, 0x8b, 0xc0, 0x8b, 0xc0, 0x23, 0x00, 0x17, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x84, 0x00, 0x17, 0x00, 0x17, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x84, 0x00, 0x17, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xb7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x7f, 0xb7, 0xff, 0xb6, 0x7f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x58, 0x00, 0x5c, 0x00, 0x58, 0x00, 0x08, 0x00, 0x08, 0x00, 0x58, 0x00, 0x5c, 0x00, 0x58, 0x00, 0x08, 0x00, 0x08, 0x00, 0x58, 0x00, 0x5c, 0x00, 0x58, 0x00, 0x08, 0x00, 0x00, 0xb7, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x7f, 0xb6, 0xff, 0x92, 0x7f, 0x00, 0x00, 0x00, 0x70, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x70, 0x00, 0x70, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x70, 0x00, 0x70, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x70, 0x00, 0x00, 0xb7, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x7f, 0x92, 0xff, 0x92, 0x7f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0xb3, 0x00, 0xb8, 0x00, 0xb3, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0xb3, 0x00, 0xb8, 0x00, 0xb3, 0x00, 0x2b, 0x00, 0x2b, 0x00, 0xb3, 0x00, 0xb8, 0x00, 0xb3, 0x00, 0x2b, 0x00, 0x00, 0xb7, 0x7f, 0xdb, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x7f, 0x92, 0xff, 0x92, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x7f, 0xdb, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x7f, 0x92, 0xff, 0x6e, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x7f, 0xb7, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x7f, 0x6e, 0xff, 0x6d, 0x7f, 0x00, 0x00, 0x00, 0x63, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x63, 0x00, 0x63, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x63, 0x00, 0x63, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x63, 0x00, 0x00, 0xb6, 0x7f, 0xb7, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x7f, 0x6d, 0xff, 0x49, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xe0, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xe0, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xe0, 0x00, 0x3f, 0x00, 0x00, 0x92, 0x7f, 0xb7, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7f, 0x6d, 0xff, 0x49, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x7f, 0xb6, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x7f, 0x49, 0xff, 0x49, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x7f, 0xb6, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x7f, 0x49, 0xff, 0x25, 0x7f, 0x00, 0x00, 0x00, 0x4c, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0x4c, 0x00, 0x00, 0x92, 0x7f, 0xb6, 0xff, 0xb7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x7f, 0x25, 0xff, 0x24, 0x7f, 0x00, 0x00, 0x00, 0x57, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0x57, 0x00, 0x57, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0x57, 0x00, 0x57, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0x57, 0x00, 0x00, 0x92, 0x7f, 0x92, 0xff, 0xb7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7f, 0x25, 0xff, 0x24, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x92, 0x7f, 0x92, 0xff, 0xb7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7f, 0x24, 0xff, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x7f, 0x92, 0xff, 0xb6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x04, 0x92, 0x0b, 0xb6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xd7, 0x00, 0x00, 0x06, 0x80, 0x03, 0xc0, 0x13, 0xc0, 0x34, 0xc0, 0x5c, 0xc0, 0x7c, 0xc0, 0x94, 0xc0, 0xac, 0x81, 0xc0, 0xaf, 0x06, 0xc0, 0xb0, 0xc0, 0x9c, 0xc0, 0x83, 
+  0xc0, 0x60, 0xc0, 0x38, 0xc0, 0x17, 0xc0, 0x04, 0xac, 0x00, 0x00, 0x05, 0xc0, 0x04, 0xc0, 0x37, 0xc0, 0x83, 0xc0, 0xcb, 0xc0, 0xef, 0xc0, 0xfc, 0x89, 0xc0, 0xff, 0x05, 0xc0, 0xfb, 0xc0, 0xef, 
+  0xc0, 0xc8, 0xc0, 0x80, 0xc0, 0x37, 0xa0, 0x07, 0xa7, 0x00, 0x00, 0x03, 0xc0, 0x14, 0xc0, 0x70, 0xc0, 0xd3, 0xc0, 0xfc, 0x85, 0xc0, 0xff, 0x01, 0xc0, 0xfc, 0xc0, 0xfb, 0x81, 0xc0, 0xf8, 0x00, 
+  0xc0, 0xfb, 0x86, 0xc0, 0xff, 0x03, 0xc0, 0xfc, 0xc0, 0xd3, 0xc0, 0x73, 0xc0, 0x0c, 0xa3, 0x00, 0x00, 0x02, 0xa0, 0x13, 0xc0, 0x83, 0xc0, 0xeb, 0x83, 0xc0, 0xff, 0x0f, 0xc0, 0xf7, 0xc0, 0xdb, 
+  0xc0, 0xa7, 0xc0, 0x7b, 0xc0, 0x57, 0xc0, 0x3c, 0xc0, 0x30, 0xc0, 0x20, 0xc0, 0x1f, 0xc0, 0x2b, 0xc0, 0x30, 0xc0, 0x4f, 0xc0, 0x78, 0xc0, 0xa8, 0xc0, 0xdc, 0xc0, 0xfb, 0x83, 0xc0, 0xff, 0x02, 
+  0xc0, 0xef, 0xc0, 0x7f, 0xc0, 0x13, 0x9f, 0x00, 0x00, 0x02, 0x80, 0x03, 0xc0, 0x60, 0xc0, 0xe4, 0x82, 0xc0, 0xff, 0x04, 0xc0, 0xfc, 0xc0, 0xcb, 0xc0, 0x73, 0xc0, 0x27, 0xa0, 0x07, 0x8b, 0x00, 
+  0x00, 0x03, 0xa0, 0x07, 0xc0, 0x2c, 0xc0, 0x78, 0xc0, 0xd0, 0x83, 0xc0, 0xff, 0x02, 0xc0, 0xe8, 0xc0, 0x67, 0xc0, 0x04, 0x9c, 0x00, 0x00, 0x01, 0xc0, 0x23, 0xc0, 0xb4, 0x82, 0xc0, 0xff, 0x03, 
+  0xc0, 0xf7, 0xc0, 0xa4, 0xc0, 0x38, 0x80, 0x03, 0x91, 0x00, 0x00, 0x03, 0xc0, 0x04, 0xc0, 0x3f, 0xc0, 0xa7, 0xc0, 0xf4, 0x82, 0xc0, 0xff, 0x01, 0xc0, 0xb8, 0xc0, 0x23, 0x9a, 0x00, 0x00, 0x01, 
+  0xc0, 0x50, 0xc0, 0xe7, 0x81, 0xc0, 0xff, 0x02, 0xc0, 0xfc, 0xc0, 0xb0, 0xc0, 0x2f, 0x97, 0x00, 0x00, 0x02, 0xc0, 0x2f, 0xc0, 0xb0, 0xc0, 0xfb, 0x81, 0xc0, 0xff, 0x01, 0xc0, 0xeb, 0xc0, 0x53, 
+  0x97, 0x00, 0x00, 0x02, 0xc0, 0x04, 0xc0, 0x7c, 0xc0, 0xf8, 0x81, 0xc0, 0xff, 0x01, 0xc0, 0xe3, 0xc0, 0x4c, 0x9a, 0x00, 0x00, 0x02, 0x80, 0x03, 0xc0, 0x50, 0xc0, 0xdf, 0x81, 0xc0, 0xff, 0x01, 
+  0xc0, 0xfb, 0xc0, 0x7c, 0x95, 0x00, 0x00, 0x01, 0xc0, 0x04, 0xc0, 0x94, 0x82, 0xc0, 0xff, 0x01, 0xc0, 0xb0, 0xc0, 0x14, 0x9d, 0x00, 0x00, 0x01, 0xc0, 0x17, 0xc0, 0xa8, 0x82, 0xc0, 0xff, 0x01, 
+  0xc0, 0x94, 0x80, 0x04, 0x93, 0x00, 0x00, 0x00, 0xc0, 0x80, 0x81, 0xc0, 0xff, 0x02, 0xc0, 0xfc, 0xc0, 0x83, 0xc0, 0x04, 0x9f, 0x00, 0x00, 0x02, 0xa0, 0x04, 0xc0, 0x7c, 0xc0, 0xfb, 0x81, 0xc0, 
+  0xff, 0x00, 0xc0, 0x83, 0x93, 0x00, 0x00, 0x03, 0xc0, 0x28, 0xc0, 0xe3, 0xc0, 0xf8, 0xc0, 0x6c, 0x85, 0x00, 0x00, 0x12, 0x00, 0x2f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x4c, 
+  0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x40, 0x10, 0xa0, 0x04, 0x60, 0x14, 0x20, 0x4f, 0x00, 0x48, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x43, 0x81, 0x00, 0x00, 0x02, 0x00, 0x1c, 
+  0x00, 0x4c, 0x00, 0x3b, 0x85, 0x00, 0x00, 0x03, 0xc0, 0x63, 0xc0, 0xf7, 0xc0, 0xe4, 0xc0, 0x27, 0x94, 0x00, 0x00, 0x01, 0xc0, 0x2f, 0xc0, 0x58, 0x85, 0x00, 0x00, 0x13, 0x00, 0x30, 0x00, 0x4f, 
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2c, 0x80, 0x10, 0x60, 0x80, 0xc0, 0x83, 0xa0, 0xc0, 0x80, 0xe7, 0xa0, 0xe8, 0xc0, 0xec, 0xa0, 0xef, 0xa0, 0xec, 0xa0, 0xdb, 0xa0, 0xbf, 0xc0, 0x84, 
+  0x60, 0x83, 0x20, 0x64, 0x81, 0x00, 0x00, 0x03, 0x00, 0x58, 0x00, 0x03, 0x00, 0x37, 0x00, 0x23, 0x85, 0x00, 0x00, 0x01, 0xc0, 0x5b, 0xc0, 0x2c, 0x9e, 0x00, 0x00, 0x06, 0x00, 0x24, 0x00, 0x30, 
+  0x00, 0x00, 0x40, 0x60, 0xa0, 0x93, 0xc0, 0xe4, 0xa0, 0xfc, 0x81, 0xc0, 0xff, 0x81, 0xa0, 0xff, 0x01, 0xc0, 0xff, 0xa0, 0xff, 0x81, 0xc0, 0xff, 0x09, 0xa0, 0xff, 0xc0, 0xff, 0xc0, 0xfc, 0xa0, 
+  0xef, 0xc0, 0x8f, 0x80, 0x30, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x40, 0xa6, 0x00, 0x00, 0x03, 0x00, 0x24, 0x40, 0x4c, 0xc0, 0xa3, 0xa0, 0xf7, 0x81, 0xc0, 0xff, 0x09, 0xa0, 0xff, 0xc0, 
+  0xff, 0xc0, 0xfb, 0xa0, 0xf4, 0xa0, 0xdf, 0xc0, 0xc8, 0x80, 0xdb, 0xc0, 0xdb, 0xc0, 0xf0, 0xa0, 0xff, 0x81, 0xc0, 0xff, 0x06, 0xa0, 0xff, 0xc0, 0xff, 0xa0, 0xf7, 0x80, 0xb0, 0xc0, 0x1b, 0x00, 
+  0x13, 0x00, 0x44, 0xa5, 0x00, 0x00, 0x03, 0x80, 0x03, 0xa0, 0x6f, 0xa0, 0xf3, 0xc0, 0xff, 0x81, 0xa0, 0xff, 0x0d, 0xc0, 0xf7, 0x80, 0xcf, 0xc0, 0x67, 0xc0, 0x2b, 0x20, 0x4c, 0x20, 0x14, 0x00, 
+  0x00, 0x00, 0x54, 0x80, 0x04, 0x60, 0x0b, 0x40, 0x70, 0xc0, 0x68, 0xc0, 0xb0, 0xa0, 0xf7, 0x81, 0xc0, 0xff, 0x03, 0xa0, 0xff, 0xc0, 0xeb, 0x80, 0x7b, 0x00, 0x38, 0xa4, 0x00, 0x00, 0x08, 0xc0, 
+  0x04, 0xc0, 0x98, 0xa0, 0xfc, 0xa0, 0xff, 0xc0, 0xff, 0xa0, 0xf0, 0x80, 0xb4, 0x40, 0x5c, 0x00, 0x40, 0x81, 0x00, 0x00, 0x06, 0x00, 0x44, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4b, 0x00, 
+  0x50, 0x00, 0x24, 0x81, 0x00, 0x00, 0x02, 0x20, 0x64, 0xc0, 0x84, 0xc0, 0xef, 0x81, 0xa0, 0xff, 0x02, 0xa0, 0xfc, 0xa0, 0x9f, 0xa0, 0x08, 0xa2, 0x00, 0x00, 0x01, 0xc0, 0x0b, 0xc0, 0xbb, 0x81, 
+  0xc0, 0xff, 0x04, 0xc0, 0xfc, 0xc0, 0xa7, 0xc0, 0x1c, 0x00, 0x07, 0x00, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x0b, 0x82, 0x00, 0x00, 0x04, 0x00, 
+  0x08, 0x00, 0x00, 0xc0, 0x1b, 0xc0, 0xa4, 0xa0, 0xfb, 0x81, 0xc0, 0xff, 0x01, 0xc0, 0xb7, 0xc0, 0x0c, 0xa1, 0x00, 0x00, 0x04, 0xc0, 0x47, 0xc0, 0xf8, 0xc0, 0xff, 0xc0, 0xf0, 0xc0, 0x57, 0x92, 
+  0x00, 0x00, 0x05, 0x80, 0x03, 0xc0, 0x60, 0xc0, 0xf3, 0xc0, 0xff, 0xc0, 0xfb, 0xc0, 0x43, 0xa2, 0x00, 0x00, 0x02, 0xc0, 0x68, 0xc0, 0xe8, 0xc0, 0x37, 0x95, 0x00, 0x00, 0x02, 0xc0, 0x43, 0xc0, 
+  0xe4, 0xc0, 0x68, 0xa4, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x97, 0x00, 0x00, 0x00, 0xc0, 0x18, 0xae, 0x00, 0x00, 0x01, 0xa0, 0x07, 0xc0, 0x28, 0x82, 0xc0, 0x4f, 0x02, 0xc0, 0x4c, 0xc0, 0x28, 0xa0, 
+  0x07, 0xb5, 0x00, 0x00, 0x03, 0xc0, 0x17, 0xc0, 0x74, 0xc0, 0xd3, 0xc0, 0xf8, 0x83, 0xc0, 0xff, 0x03, 0xc0, 0xfb, 0xc0, 0xdb, 0xc0, 0x80, 0xc0, 0x17, 0xb1, 0x00, 0x00, 0x02, 0xc0, 0x04, 0xc0, 
+  0x6b, 0xc0, 0xe8, 0x89, 0xc0, 0xff, 0x02, 0xc0, 0xec, 0xc0, 0x6b, 0xa0, 0x03, 0xae, 0x00, 0x00, 0x0d, 0xc0, 0x14, 0xc0, 0xa7, 0xc0, 0xfc, 0xc0, 0xff, 0xc0, 0xfc, 0xc0, 0xc3, 0xc0, 0x7f, 0xc0, 
+  0x58, 0xc0, 0x30, 0xc0, 0x2b, 0xc0, 0x50, 0xc0, 0x74, 0xc0, 0xc0, 0xc0, 0xfc, 0x81, 0xc0, 0xff, 0x01, 0xc0, 0xa8, 0xa0, 0x13, 0xac, 0x00, 0x00, 0x01, 0xc0, 0x13, 0xc0, 0xc4, 0x81, 0xc0, 0xff, 
+  0x02, 0xc0, 0xbc, 0xc0, 0x38, 0xa0, 0x03, 0x86, 0x00, 0x00, 0x01, 0xc0, 0x34, 0xc0, 0xbf, 0x81, 0xc0, 0xff, 0x01, 0xc0, 0xc3, 0xc0, 0x10, 0xaa, 0x00, 0x00, 0x05, 0xa0, 0x08, 0xc0, 0xc4, 0xc0, 
+  0xff, 0xc0, 0xfb, 0xc0, 0x78, 0x80, 0x04, 0x89, 0x00, 0x00, 0x05, 0xa0, 0x07, 0xc0, 0x7c, 0xc0, 0xf8, 0xc0, 0xff, 0xc0, 0xbc, 0xc0, 0x04, 0xa9, 0x00, 0x00, 0x03, 0xc0, 0x1f, 0xc0, 0xeb, 0xc0, 
+  0xf7, 0xc0, 0x5b, 0x8d, 0x00, 0x00, 0x03, 0xc0, 0x5f, 0xc0, 0xf7, 0xc0, 0xe8, 0xa0, 0x1c, 0xaa, 0x00, 0x00, 0x01, 0xc0, 0x50, 0xc0, 0x6b, 0x8f, 0x00, 0x00, 0x01, 0xc0, 0x6c, 0xc0, 0x4b, 0xff, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x06, 0x00, 0x03, 0x44, 0x48, 0x44, 0x9c, 0x44, 0xb0, 0x44, 0xa0, 0x44, 0x57, 0x40, 0x07, 0xb7, 0x00, 0x00, 0x01, 0x44, 0x0c, 0x44, 0xb0, 0x84, 
+  0x44, 0xff, 0x01, 0x44, 0xcb, 0x44, 0x1b, 0xb6, 0x00, 0x00, 0x00, 0x44, 0xa4, 0x81, 0x44, 0xff, 0x82, 0x40, 0xff, 0x81, 0x44, 0xff, 0x01, 0x44, 0xd0, 0x40, 0x07, 0xb4, 0x00, 0x00, 0x00, 0x44, 
+  0x3f, 0x81, 0x44, 0xff, 0x84, 0x20, 0xff, 0x81, 0x44, 0xff, 0x00, 0x44, 0x68, 0xb2, 0x00, 0x00, 0x04, 0xff, 0x0f, 0xff, 0x77, 0x8d, 0xd7, 0x44, 0xff, 0x40, 0xff, 0x84, 0x20, 0xff, 0x04, 0x40, 
+  0xff, 0x44, 0xff, 0x44, 0xdc, 0x6e, 0x77, 0xb6, 0x0f, 0xaf, 0x00, 0x00, 0x06, 0xff, 0x4f, 0xff, 0xe8, 0xff, 0xff, 0xb2, 0xff, 0x89, 0xff, 0x69, 0xff, 0x49, 0xff, 0x82, 0x45, 0xff, 0x00, 0x44, 
+  0xff, 0x82, 0x45, 0xff, 0x02, 0x92, 0xff, 0xb6, 0xe8, 0xdb, 0x4f, 0xad, 0x00, 0x00, 0x12, 0xff, 0x5f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf3, 0xdb, 0x8f, 0xdb, 0x54, 0xb7, 0x37, 0x92, 0x2f, 0x92, 
+  0x2c, 0x6e, 0x2c, 0x6d, 0x2c, 0x49, 0x2c, 0x6e, 0x34, 0x6e, 0x50, 0x6e, 0x88, 0x92, 0xf0, 0xb6, 0xff, 0xdb, 0xfc, 0xdb, 0x5f, 0xab, 0x00, 0x00, 0x04, 0xff, 0x2c, 0xff, 0xf7, 0xff, 0xff, 0xff, 
+  0xbf, 0xff, 0x18, 0x8a, 0x00, 0x00, 0x04, 0x92, 0x18, 0xb6, 0xbf, 0xb7, 0xff, 0xdb, 0xf7, 0xff, 0x2c, 0xaa, 0x00, 0x00, 0x03, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xd0, 0xdb, 0x08, 0x8c, 0x00, 0x00, 
+  0x03, 0xb6, 0x0c, 0xb7, 0xcf, 0xdb, 0xff, 0xff, 0xbb, 0xa9, 0x00, 0x00, 0x00, 0xff, 0x23, 0x81, 0xff, 0xff, 0x00, 0xff, 0x38, 0x8e, 0x00, 0x00, 0x03, 0xdb, 0x33, 0xdb, 0xff, 0xff, 0xff, 0xff, 
+  0x23, 0xa8, 0x00, 0x00, 0x02, 0xff, 0x68, 0xff, 0xff, 0xff, 0xd3, 0x90, 0x00, 0x00, 0x02, 0xdb, 0xd3, 0xff, 0xff, 0xff, 0x68, 0xa8, 0x00, 0x00, 0x02, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x9f, 0x90, 
+  0x00, 0x00, 0x02, 0xdb, 0x9f, 0xff, 0xff, 0xff, 0x7f, 0xa8, 0x00, 0x00, 0x04, 0xff, 0x7f, 0xff, 0xff, 0xdb, 0x84, 0x00, 0x00, 0xc0, 0x24, 0x82, 0xc0, 0x8b, 0x04, 0xc0, 0x24, 0x00, 0x17, 0x00, 
+  0x84, 0x00, 0x8b, 0x00, 0x84, 0x81, 0x00, 0x17, 0x07, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x84, 0x00, 0x17, 0x00, 0x00, 0xdb, 0x84, 0xff, 0xff, 0xff, 0x7f, 0xa8, 0x00, 0x00, 0x04, 0xff, 0x7f, 0xdb, 
+  0xff, 0xdb, 0x7f, 0x00, 0x00, 0xc0, 0x7f, 0x82, 0xc0, 0xff, 0x01, 0xc0, 0x7f, 0x00, 0x74, 0x82, 0x00, 0xff, 0x81, 0x00, 0x74, 0x82, 0x00, 0xff, 0x04, 0x00, 0x74, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 
+  0xff, 0xff, 0x7f, 0xa8, 0x00, 0x00, 0x04, 0xdb, 0x7f, 0xdb, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0xc0, 0x23, 0x82, 0xc0, 0x8b, 0x04, 0xc0, 0x23, 0x00, 0x17, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x84, 0x81, 
+  0x00, 0x17, 0x07, 0x00, 0x84, 0x00, 0x8b, 0x00, 0x84, 0x00, 0x17, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0xdb, 0x7f, 0xdb, 0xff, 0xb7, 0x7f, 0x90, 0x00, 0x00, 
+  0x02, 0xb7, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0xa8, 0x00, 0x00, 0x07, 0xdb, 0x7f, 0xb7, 0xff, 0xb6, 0x7f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x58, 0x00, 0x5c, 0x00, 0x58, 0x81, 0x00, 0x08, 0x02, 0x00, 
+  0x58, 0x00, 0x5c, 0x00, 0x58, 0x81, 0x00, 0x08, 0x07, 0x00, 0x58, 0x00, 0x5c, 0x00, 0x58, 0x00, 0x08, 0x00, 0x00, 0xb7, 0x7f, 0xdb, 0xff, 0xff, 0x7f, 0xa8, 0x00, 0x00, 0x04, 0xb7, 0x7f, 0xb6, 
+  0xff, 0x92, 0x7f, 0x00, 0x00, 0x00, 0x70, 0x82, 0x00, 0xff, 0x81, 0x00, 0x70, 0x82, 0x00, 0xff, 0x81, 0x00, 0x70, 0x82, 0x00, 0xff, 0x04, 0x00, 0x70, 0x00, 0x00, 0xb7, 0x7f, 0xdb, 0xff, 0xff, 
+  0x7f, 0xa8, 0x00, 0x00, 0x07, 0xb6, 0x7f, 0x92, 0xff, 0x92, 0x7f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0xb3, 0x00, 0xb8, 0x00, 0xb3, 0x81, 0x00, 0x2b, 0x02, 0x00, 0xb3, 0x00, 0xb8, 0x00, 0xb3, 0x81, 
+  0x00, 0x2b, 0x07, 0x00, 0xb3, 0x00, 0xb8, 0x00, 0xb3, 0x00, 0x2b, 0x00, 0x00, 0xb7, 0x7f, 0xdb, 0xff, 0xdb, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0xb6, 0x7f, 0x92, 0xff, 0x92, 0x7f, 0x90, 0x00, 0x00, 
+  0x02, 0xb6, 0x7f, 0xdb, 0xff, 0xdb, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0x92, 0x7f, 0x92, 0xff, 0x6e, 0x7f, 0x81, 0x00, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x02, 0x00, 
+  0x2b, 0x00, 0x2f, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x02, 0xb6, 0x7f, 0xb7, 0xff, 0xdb, 0x7f, 0xa8, 0x00, 0x00, 0x04, 0x92, 0x7f, 0x6e, 
+  0xff, 0x6d, 0x7f, 0x00, 0x00, 0x00, 0x63, 0x82, 0x00, 0xff, 0x81, 0x00, 0x63, 0x82, 0x00, 0xff, 0x81, 0x00, 0x63, 0x82, 0x00, 0xff, 0x04, 0x00, 0x63, 0x00, 0x00, 0xb6, 0x7f, 0xb7, 0xff, 0xdb, 
+  0x7f, 0xa8, 0x00, 0x00, 0x07, 0x6e, 0x7f, 0x6d, 0xff, 0x49, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xe0, 0x81, 0x00, 0x3f, 0x02, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xe0, 0x81, 
+  0x00, 0x3f, 0x07, 0x00, 0xe0, 0x00, 0xe7, 0x00, 0xe0, 0x00, 0x3f, 0x00, 0x00, 0x92, 0x7f, 0xb7, 0xff, 0xdb, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0x6d, 0x7f, 0x6d, 0xff, 0x49, 0x7f, 0x90, 0x00, 0x00, 
+  0x02, 0x92, 0x7f, 0xb6, 0xff, 0xdb, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0x6d, 0x7f, 0x49, 0xff, 0x49, 0x7f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x02, 0x92, 0x7f, 0xb6, 0xff, 0xdb, 0x7f, 0xa8, 0x00, 0x00, 0x07, 0x49, 0x7f, 0x49, 0xff, 0x25, 0x7f, 0x00, 0x00, 0x00, 0x4c, 0x00, 0xf8, 0x00, 0xff, 0x00, 
+  0xf8, 0x81, 0x00, 0x4c, 0x02, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x81, 0x00, 0x4c, 0x07, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0x4c, 0x00, 0x00, 0x92, 0x7f, 0xb6, 0xff, 0xb7, 0x7f, 0xa8, 
+  0x00, 0x00, 0x07, 0x49, 0x7f, 0x25, 0xff, 0x24, 0x7f, 0x00, 0x00, 0x00, 0x57, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x81, 0x00, 0x57, 0x02, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x81, 0x00, 0x57, 
+  0x07, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0x57, 0x00, 0x00, 0x92, 0x7f, 0x92, 0xff, 0xb7, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0x25, 0x7f, 0x25, 0xff, 0x24, 0x7f, 0x81, 0x00, 0x00, 0x02, 0x00, 
+  0x10, 0x00, 0x14, 0x00, 0x10, 0x81, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x14, 0x00, 0x10, 0x81, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x14, 0x00, 0x10, 0x81, 0x00, 0x00, 0x02, 0x92, 0x7f, 0x92, 
+  0xff, 0xb7, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0x25, 0x7f, 0x24, 0xff, 0x00, 0x7f, 0x90, 0x00, 0x00, 0x02, 0x6e, 0x7f, 0x92, 0xff, 0xb6, 0x7f, 0xa8, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x0b, 0x00, 
+  0x04, 0x90, 0x00, 0x00, 0x02, 0x6e, 0x04, 0x92, 0x0b, 0xb6, 0x04, 0xd4, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xb8, 0x13, 0x00, 0xb8, 0x34, 0x00, 0xb8, 0x5c, 0x00, 0xb8, 0x7c, 0x00, 0xb8, 0x94, 0x00, 0xb8, 0xac, 0x00, 0xb8, 0xaf, 0x00, 0xb8, 0xaf, 0x00, 0xb8, 0xb0, 0x00, 0xb8, 0x9c, 0x00, 0xb8, 0x83, 0x00, 0xb8, 0x60, 0x00, 0xb8, 0x38, 0x00, 0xb8, 0x17, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0xb0, 0x37, 0x00, 0xb8, 0x83, 0x00, 0xb8, 0xcb, 0x00, 0xb8, 0xef, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xef, 0x00, 0xb8, 0xc8, 0x00, 0xb8, 0x80, 0x00, 0xb8, 0x37, 0x00, 0xa8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x14, 0x00, 0xb8, 0x70, 0x00, 0xb8, 0xd3, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xd3, 0x00, 0xb8, 0x73, 0x00, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x13, 0x00, 0xb8, 0x83, 0x00, 0xb8, 0xeb, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0xdb, 0x00, 0xb8, 0xa7, 0x00, 0xb0, 0x7b, 0x00, 0xb8, 0x57, 0x00, 0xb0, 0x3c, 0x00, 0xb8, 0x30, 0x00, 0xb8, 0x20, 0x00, 0xb8, 0x1f, 0x00, 0xb8, 0x2b, 0x00, 0xb8, 0x30, 0x00, 0xb8, 0x4f, 0x00, 0xb8, 0x78, 0x00, 0xb8, 0xa8, 0x00, 0xb8, 0xdc, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xef, 0x00, 0xb8, 0x7f, 0x00, 0xb8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xb8, 0x60, 0x00, 0xb8, 0xe4, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xcb, 0x00, 0xb8, 0x73, 0x00, 0xb0, 0x27, 0x00, 0xa8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0xb8, 0x2c, 0x00, 0xb8, 0x78, 0x00, 0xb8, 0xd0, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xe8, 0x00, 0xb8, 0x67, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x23, 0x00, 0xb8, 0xb4, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0xa4, 0x00, 0xb8, 0x38, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0xb8, 0x3f, 0x00, 0xb8, 0xa7, 0x00, 0xb8, 0xf4, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xb8, 0x00, 0xb8, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x50, 0x00, 0xb8, 0xe7, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xb0, 0x00, 0xb8, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xb0, 0x2f, 0x00, 0xb8, 0xb0, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xeb, 0x00, 0xb0, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0xb8, 0x7c, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xe3, 0x00, 0xb8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xb0, 0x50, 0x00, 0xb8, 0xdf, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0xb8, 0x94, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xb0, 0x00, 0xb0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x17, 0x00, 0xb8, 0xa8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0x94, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x80, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0xb0, 0x83, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x04, 0x00, 0xb8, 0x7c, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x28, 0x00, 0xb8, 0xe3, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x40, 0x10, 0x00, 0x98, 0x04, 0x00, 0x58, 0x14, 0x00, 0x10, 0x4f, 0x00, 0x08, 0x48, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x63, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0xe4, 0x00, 0xb8, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x2f, 0x00, 0xb8, 0x58, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2c, 0x00, 0x78, 0x10, 0x00, 0x58, 0x80, 0x00, 0xb8, 0x83, 0x00, 0x90, 0xc0, 0x00, 0x90, 0xe7, 0x00, 0xb0, 0xe8, 0x00, 0xb8, 0xec, 0x00, 0x98, 0xef, 0x00, 0xb0, 0xec, 0x00, 0xa8, 0xdb, 0x00, 0x90, 0xbf, 0x00, 0xb0, 0x84, 0x00, 0x60, 0x83, 0x00, 0x18, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x03, 0x00, 0x00, 0x37, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x5b, 0x00, 0xb8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0xa8, 0x93, 0x00, 0xb8, 0xe4, 0x00, 0x98, 0xfc, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0x98, 0xff, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xff, 0x00, 0x98, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0x90, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0x90, 0xef, 0x00, 0xb8, 0x8f, 0x00, 0x90, 0x30, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x48, 0x4c, 0x00, 0xb8, 0xa3, 0x00, 0x98, 0xf7, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xff, 0x00, 0x98, 0xff, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0x98, 0xf4, 0x00, 0xb0, 0xdf, 0x00, 0xb8, 0xc8, 0x00, 0x90, 0xdb, 0x00, 0xb8, 0xdb, 0x00, 0xb8, 0xf0, 0x00, 0x98, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0x98, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb0, 0xf7, 0x00, 0x88, 0xb0, 0x00, 0xb8, 0x1b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x90, 0x6f, 0x00, 0xa0, 0xf3, 0x00, 0xb8, 0xff, 0x00, 0xa0, 0xff, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xf7, 0x00, 0x88, 0xcf, 0x00, 0xb0, 0x67, 0x00, 0xb8, 0x2b, 0x00, 0x20, 0x4c, 0x00, 0x28, 0x14, 0x00, 0xf8, 0x00, 0x00, 0x08, 0x54, 0x00, 0x80, 0x04, 0x00, 0x68, 0x0b, 0x00, 0x40, 0x70, 0x00, 0xb8, 0x68, 0x00, 0xb8, 0xb0, 0x00, 0x90, 0xf7, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0x98, 0xff, 0x00, 0xb8, 0xeb, 0x00, 0x90, 0x7b, 0x00, 0x08, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0xb8, 0x98, 0x00, 0xa8, 0xfc, 0x00, 0xa0, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb0, 0xf0, 0x00, 0x78, 0xb4, 0x00, 0x38, 0x5c, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x50, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x64, 0x00, 0xb8, 0x84, 0x00, 0xb8, 0xef, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xff, 0x00, 0x90, 0xfc, 0x00, 0xb0, 0x9f, 0x00, 0xa8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x0b, 0x00, 0xb8, 0xbb, 0x00, 0xb8, 0xff, 0x00, 0xb0, 0xff, 0x00, 0xb0, 0xfc, 0x00, 0xb8, 0xa7, 0x00, 0xb8, 0x1c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x1b, 0x00, 0xb8, 0xa4, 0x00, 0xb0, 0xfb, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xb7, 0x00, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x47, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xf0, 0x00, 0xb8, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0xb8, 0x60, 0x00, 0xb8, 0xf3, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x68, 0x00, 0xb8, 0xe8, 0x00, 0xb8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x43, 0x00, 0xb8, 0xe4, 0x00, 0xb8, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0xb8, 0x28, 0x00, 0xb8, 0x4f, 0x00, 0xb8, 0x4f, 0x00, 0xb8, 0x4f, 0x00, 0xb8, 0x4c, 0x00, 0xb0, 0x28, 0x00, 0xa8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x17, 0x00, 0xb0, 0x74, 0x00, 0xb8, 0xd3, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xdb, 0x00, 0xb8, 0x80, 0x00, 0xb8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0xb8, 0x6b, 0x00, 0xb8, 0xe8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xec, 0x00, 0xb8, 0x6b, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x14, 0x00, 0xb8, 0xa7, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xc3, 0x00, 0xb8, 0x7f, 0x00, 0xb8, 0x58, 0x00, 0xb8, 0x30, 0x00, 0xb0, 0x2b, 0x00, 0xb8, 0x50, 0x00, 0xb8, 0x74, 0x00, 0xb8, 0xc0, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xa8, 0x00, 0xb0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x13, 0x00, 0xb8, 0xc4, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xbc, 0x00, 0xb8, 0x38, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xb0, 0x34, 0x00, 0xb8, 0xbf, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xc3, 0x00, 0xb0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x08, 0x00, 0xb8, 0xc4, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0x78, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0xb8, 0x7c, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xbc, 0x00, 0xc8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x1f, 0x00, 0xb8, 0xeb, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x5f, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0xe8, 0x00, 0xb0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x50, 0x00, 0xb0, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x6c, 0x00, 0xb0, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa3, 0x50, 0x48, 0xa3, 0x50, 0x9c, 0xa3, 0x50, 0xb0, 0xa3, 0x50, 0xa0, 0xa3, 0x50, 0x57, 0x00, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x40, 0x0c, 0xa3, 0x50, 0xb0, 0xa3, 0x50, 0xff, 0xa3, 0x50, 0xff, 0xa3, 0x50, 0xff, 0xa3, 0x50, 0xff, 0xa3, 0x50, 0xff, 0xa3, 0x50, 0xcb, 0xa2, 0x50, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x50, 0xa4, 0xa3, 0x50, 0xff, 0xa2, 0x48, 0xff, 0x61, 0x38, 0xff, 0x41, 0x38, 0xff, 0x61, 0x38, 0xff, 0xa2, 0x48, 0xff, 0xa3, 0x50, 0xff, 0xa3, 0x50, 0xd0, 0x00, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x50, 0x3f, 0xa3, 0x50, 0xff, 0xa2, 0x48, 0xff, 0x41, 0x30, 0xff, 0x21, 0x28, 0xff, 0x21, 0x28, 0xff, 0x21, 0x28, 0xff, 0x21, 0x30, 0xff, 0x82, 0x48, 0xff, 0xa3, 0x50, 0xff, 0xa2, 0x48, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x5d, 0xef, 0x77, 0xeb, 0x82, 0xd7, 0xa3, 0x50, 0xff, 0x61, 0x38, 0xff, 0x21, 0x28, 0xff, 0x21, 0x28, 0xff, 0x21, 0x28, 0xff, 0x21, 0x28, 0xff, 0x21, 0x28, 0xff, 0x41, 0x30, 0xff, 0xa3, 0x50, 0xff, 0x04, 0x51, 0xdc, 0x4d, 0x6b, 0x77, 0xd3, 0x9c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4f, 0xbe, 0xf7, 0xe8, 0x1c, 0xe7, 0xff, 0xcf, 0x93, 0xff, 0x69, 0x72, 0xff, 0xe8, 0x59, 0xff, 0xa7, 0x51, 0xff, 0x66, 0x49, 0xff, 0x45, 0x41, 0xff, 0x04, 0x39, 0xff, 0xe4, 0x38, 0xff, 0x04, 0x39, 0xff, 0x45, 0x51, 0xff, 0x65, 0x49, 0xff, 0xcf, 0x7b, 0xff, 0xd3, 0x9c, 0xe8, 0x96, 0xb5, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5f, 0xdf, 0xff, 0xfc, 0x5d, 0xef, 0xff, 0xbb, 0xde, 0xf3, 0x39, 0xce, 0x8f, 0xb6, 0xb5, 0x54, 0x14, 0xa5, 0x37, 0x92, 0x94, 0x2f, 0xf0, 0x83, 0x2c, 0x6d, 0x6b, 0x2c, 0xab, 0x5a, 0x2c, 0x8a, 0x52, 0x2c, 0x4d, 0x6b, 0x34, 0x6e, 0x73, 0x50, 0x0c, 0x63, 0x88, 0xcf, 0x7b, 0xf0, 0xb3, 0x9c, 0xff, 0xb6, 0xb5, 0xfc, 0x79, 0xce, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xf7, 0x7e, 0xf7, 0xff, 0x1c, 0xe7, 0xbf, 0xba, 0xd6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x18, 0xb3, 0x9c, 0xbf, 0x96, 0xb5, 0xff, 0x7a, 0xd6, 0xf7, 0x1c, 0xe7, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbb, 0xbf, 0xff, 0xff, 0x3c, 0xe7, 0xd0, 0x39, 0xce, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x0c, 0x76, 0xb5, 0xcf, 0x59, 0xce, 0xff, 0x3c, 0xe7, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x23, 0xdf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x1c, 0xe7, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x33, 0x39, 0xce, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x68, 0x9e, 0xf7, 0xff, 0xfc, 0xe6, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xd3, 0xfc, 0xe6, 0xff, 0xbe, 0xf7, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xf7, 0x7f, 0x3c, 0xe7, 0xff, 0xbb, 0xde, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x9f, 0xdb, 0xde, 0xff, 0x9e, 0xf7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xef, 0x7f, 0xdb, 0xde, 0xff, 0x59, 0xce, 0x84, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x24, 0x00, 0xb8, 0x8b, 0x00, 0xb8, 0x8b, 0x00, 0xb8, 0x8b, 0x00, 0xb0, 0x24, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x84, 0xba, 0xd6, 0xff, 0x7d, 0xef, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x7f, 0x79, 0xce, 0xff, 0xf8, 0xc5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x7f, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0x7f, 0x00, 0x00, 0x74, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x7f, 0x9a, 0xd6, 0xff, 0x3d, 0xef, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x7f, 0x18, 0xc6, 0xff, 0x96, 0xb5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x23, 0x00, 0xb8, 0x8b, 0x00, 0xb8, 0x8b, 0x00, 0xb8, 0x8b, 0x00, 0xb8, 0x23, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x7f, 0x59, 0xce, 0xff, 0x1c, 0xe7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x7f, 0xb6, 0xb5, 0xff, 0x35, 0xad, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x7f, 0x39, 0xce, 0xff, 0xfc, 0xe6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x7f, 0x35, 0xad, 0xff, 0xd3, 0x9c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x75, 0xad, 0x7f, 0x18, 0xc6, 0xff, 0xdb, 0xde, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x7f, 0xd3, 0x9c, 0xff, 0x72, 0x94, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x35, 0xad, 0x7f, 0xf7, 0xbd, 0xff, 0xba, 0xd6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x7f, 0x72, 0x94, 0xff, 0x10, 0x84, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2b, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2b, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x7f, 0xd7, 0xbd, 0xff, 0x7a, 0xd6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0x7f, 0x10, 0x84, 0xff, 0xae, 0x73, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x7f, 0x96, 0xb5, 0xff, 0x59, 0xce, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x7f, 0xaf, 0x7b, 0xff, 0x4d, 0x6b, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x7f, 0x76, 0xb5, 0xff, 0x39, 0xce, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x7f, 0x4d, 0x6b, 0xff, 0xeb, 0x5a, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x7f, 0x55, 0xad, 0xff, 0x18, 0xc6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6b, 0x7f, 0xec, 0x62, 0xff, 0x8a, 0x52, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x72, 0x94, 0x7f, 0x34, 0xa5, 0xff, 0xf7, 0xbd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x7f, 0x8a, 0x52, 0xff, 0x28, 0x42, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x7f, 0x14, 0xa5, 0xff, 0xb7, 0xbd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x52, 0x7f, 0x29, 0x4a, 0xff, 0xc7, 0x39, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x7f, 0xd3, 0x9c, 0xff, 0x96, 0xb5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x4a, 0x7f, 0xc7, 0x39, 0xff, 0x45, 0x29, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x7f, 0xb3, 0x9c, 0xff, 0x76, 0xb5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x7f, 0x66, 0x31, 0xff, 0xe4, 0x20, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x7f, 0x92, 0x94, 0xff, 0x55, 0xad, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x31, 0x7f, 0x04, 0x21, 0xff, 0x82, 0x10, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x73, 0x7f, 0x71, 0x8c, 0xff, 0x34, 0xa5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x7f, 0xa3, 0x18, 0xff, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x73, 0x7f, 0x51, 0x8c, 0xff, 0x14, 0xa5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x6b, 0x04, 0x10, 0x84, 0x0b, 0xd3, 0x9c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xd7, 0x00, 0x00, 0x00, 0x06, 0x00, 0x80, 0x03, 0x00, 0xb8, 0x13, 0x00, 0xb8, 0x34, 0x00, 0xb8, 0x5c, 0x00, 0xb8, 0x7c, 0x00, 0xb8, 0x94, 0x00, 0xb8, 0xac, 0x81, 0x00, 
+  0xb8, 0xaf, 0x06, 0x00, 0xb8, 0xb0, 0x00, 0xb8, 0x9c, 0x00, 0xb8, 0x83, 0x00, 0xb8, 0x60, 0x00, 0xb8, 0x38, 0x00, 0xb8, 0x17, 0x00, 0xc0, 0x04, 0xac, 0x00, 0x00, 0x00, 0x05, 0x00, 0xc0, 0x04, 
+  0x00, 0xb0, 0x37, 0x00, 0xb8, 0x83, 0x00, 0xb8, 0xcb, 0x00, 0xb8, 0xef, 0x00, 0xb8, 0xfc, 0x89, 0x00, 0xb8, 0xff, 0x05, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xef, 0x00, 0xb8, 0xc8, 0x00, 0xb8, 0x80, 
+  0x00, 0xb8, 0x37, 0x00, 0xa8, 0x07, 0xa7, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb0, 0x14, 0x00, 0xb8, 0x70, 0x00, 0xb8, 0xd3, 0x00, 0xb8, 0xfc, 0x85, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xb8, 0xfc, 0x00, 
+  0xb8, 0xfb, 0x81, 0x00, 0xb8, 0xf8, 0x00, 0x00, 0xb8, 0xfb, 0x86, 0x00, 0xb8, 0xff, 0x03, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xd3, 0x00, 0xb8, 0x73, 0x00, 0xb0, 0x0c, 0xa3, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0xa8, 0x13, 0x00, 0xb8, 0x83, 0x00, 0xb8, 0xeb, 0x83, 0x00, 0xb8, 0xff, 0x0f, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0xdb, 0x00, 0xb8, 0xa7, 0x00, 0xb0, 0x7b, 0x00, 0xb8, 0x57, 0x00, 0xb0, 0x3c, 
+  0x00, 0xb8, 0x30, 0x00, 0xb8, 0x20, 0x00, 0xb8, 0x1f, 0x00, 0xb8, 0x2b, 0x00, 0xb8, 0x30, 0x00, 0xb8, 0x4f, 0x00, 0xb8, 0x78, 0x00, 0xb8, 0xa8, 0x00, 0xb8, 0xdc, 0x00, 0xb8, 0xfb, 0x83, 0x00, 
+  0xb8, 0xff, 0x02, 0x00, 0xb8, 0xef, 0x00, 0xb8, 0x7f, 0x00, 0xb8, 0x13, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x00, 0xb8, 0x60, 0x00, 0xb8, 0xe4, 0x82, 0x00, 0xb8, 0xff, 0x04, 0x00, 
+  0xb8, 0xfc, 0x00, 0xb8, 0xcb, 0x00, 0xb8, 0x73, 0x00, 0xb0, 0x27, 0x00, 0xa8, 0x07, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0xa8, 0x07, 0x00, 0xb8, 0x2c, 0x00, 0xb8, 0x78, 0x00, 0xb8, 0xd0, 0x83, 
+  0x00, 0xb8, 0xff, 0x02, 0x00, 0xb8, 0xe8, 0x00, 0xb8, 0x67, 0x00, 0xc0, 0x04, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb0, 0x23, 0x00, 0xb8, 0xb4, 0x82, 0x00, 0xb8, 0xff, 0x03, 0x00, 0xb8, 0xf7, 
+  0x00, 0xb8, 0xa4, 0x00, 0xb8, 0x38, 0x00, 0x80, 0x03, 0x91, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x04, 0x00, 0xb8, 0x3f, 0x00, 0xb8, 0xa7, 0x00, 0xb8, 0xf4, 0x82, 0x00, 0xb8, 0xff, 0x01, 0x00, 
+  0xb8, 0xb8, 0x00, 0xb8, 0x23, 0x9a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0x50, 0x00, 0xb8, 0xe7, 0x81, 0x00, 0xb8, 0xff, 0x02, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xb0, 0x00, 0xb8, 0x2f, 0x97, 0x00, 
+  0x00, 0x00, 0x02, 0x00, 0xb0, 0x2f, 0x00, 0xb8, 0xb0, 0x00, 0xb8, 0xfb, 0x81, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xb8, 0xeb, 0x00, 0xb0, 0x53, 0x97, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc0, 0x04, 0x00, 
+  0xb8, 0x7c, 0x00, 0xb8, 0xf8, 0x81, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xb8, 0xe3, 0x00, 0xb8, 0x4c, 0x9a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x00, 0xb0, 0x50, 0x00, 0xb8, 0xdf, 0x81, 0x00, 
+  0xb8, 0xff, 0x01, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0x7c, 0x95, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc0, 0x04, 0x00, 0xb8, 0x94, 0x82, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xb8, 0xb0, 0x00, 0xb0, 0x14, 0x9d, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0x17, 0x00, 0xb8, 0xa8, 0x82, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xb8, 0x94, 0x00, 0x80, 0x04, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x80, 0x81, 0x00, 0xb8, 
+  0xff, 0x02, 0x00, 0xb8, 0xfc, 0x00, 0xb0, 0x83, 0x00, 0xc0, 0x04, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x98, 0x04, 0x00, 0xb8, 0x7c, 0x00, 0xb8, 0xfb, 0x81, 0x00, 0xb8, 0xff, 0x00, 0x00, 0xb8, 
+  0x83, 0x93, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb0, 0x28, 0x00, 0xb8, 0xe3, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0x6c, 0x85, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x40, 0x10, 0x00, 0x98, 0x04, 0x00, 0x58, 0x14, 0x00, 0x10, 
+  0x4f, 0x00, 0x08, 0x48, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x43, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x3b, 0x85, 0x00, 
+  0x00, 0x00, 0x03, 0x00, 0xb8, 0x63, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0xe4, 0x00, 0xb8, 0x27, 0x94, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb0, 0x2f, 0x00, 0xb8, 0x58, 0x85, 0x00, 0x00, 0x00, 0x13, 0x00, 
+  0x00, 0x30, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2c, 0x00, 0x78, 0x10, 0x00, 0x58, 0x80, 0x00, 0xb8, 0x83, 0x00, 0x90, 0xc0, 0x00, 0x90, 0xe7, 
+  0x00, 0xb0, 0xe8, 0x00, 0xb8, 0xec, 0x00, 0x98, 0xef, 0x00, 0xb0, 0xec, 0x00, 0xa8, 0xdb, 0x00, 0x90, 0xbf, 0x00, 0xb0, 0x84, 0x00, 0x60, 0x83, 0x00, 0x18, 0x64, 0x81, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x58, 0x00, 0x00, 0x03, 0x00, 0x00, 0x37, 0x00, 0x00, 0x23, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0x5b, 0x00, 0xb8, 0x2c, 0x9e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x24, 0x00, 
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0xa8, 0x93, 0x00, 0xb8, 0xe4, 0x00, 0x98, 0xfc, 0x81, 0x00, 0xb8, 0xff, 0x03, 0x00, 0x98, 0xff, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xff, 0x00, 
+  0x98, 0xff, 0x81, 0x00, 0xb8, 0xff, 0x09, 0x00, 0x90, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0x90, 0xef, 0x00, 0xb8, 0x8f, 0x00, 0x90, 0x30, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x17, 0x00, 0x00, 0x40, 0xa6, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x24, 0x00, 0x48, 0x4c, 0x00, 0xb8, 0xa3, 0x00, 0x98, 0xf7, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xff, 0x00, 0x98, 0xff, 0x00, 
+  0xb0, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0x98, 0xf4, 0x00, 0xb0, 0xdf, 0x00, 0xb8, 0xc8, 0x00, 0x90, 0xdb, 0x00, 0xb8, 0xdb, 0x00, 0xb8, 0xf0, 0x00, 0x98, 0xff, 0x81, 0x00, 0xb8, 0xff, 0x06, 0x00, 
+  0x98, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb0, 0xf7, 0x00, 0x88, 0xb0, 0x00, 0xb8, 0x1b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x44, 0xa5, 0x00, 0x00, 0x00, 0x13, 0x00, 0x80, 0x03, 0x00, 0x90, 0x6f, 0x00, 
+  0xa0, 0xf3, 0x00, 0xb8, 0xff, 0x00, 0xa0, 0xff, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xf7, 0x00, 0x88, 0xcf, 0x00, 0xb0, 0x67, 0x00, 0xb8, 0x2b, 0x00, 0x20, 0x4c, 0x00, 0x28, 0x14, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x54, 0x00, 0x80, 0x04, 0x00, 0x68, 0x0b, 0x00, 0x40, 0x70, 0x00, 0xb8, 0x68, 0x00, 0xb8, 0xb0, 0x00, 0x90, 0xf7, 0x81, 0x00, 0xb8, 0xff, 0x03, 0x00, 0x98, 0xff, 0x00, 0xb8, 0xeb, 
+  0x00, 0x90, 0x7b, 0x00, 0x08, 0x38, 0xa4, 0x00, 0x00, 0x00, 0x08, 0x00, 0xc8, 0x04, 0x00, 0xb8, 0x98, 0x00, 0xa8, 0xfc, 0x00, 0xa0, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb0, 0xf0, 0x00, 0x78, 0xb4, 
+  0x00, 0x38, 0x5c, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x50, 0x00, 0x00, 0x24, 
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0x64, 0x00, 0xb8, 0x84, 0x00, 0xb8, 0xef, 0x81, 0x00, 0xa0, 0xff, 0x02, 0x00, 0x90, 0xfc, 0x00, 0xb0, 0x9f, 0x00, 0xa8, 0x08, 0xa2, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0xb8, 0x0b, 0x00, 0xb8, 0xbb, 0x00, 0xb8, 0xff, 0x00, 0xb0, 0xff, 0x00, 0xb0, 0xfc, 0x00, 0xb8, 0xa7, 0x00, 0xb8, 0x1c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x82, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x1b, 0x00, 0xb8, 0xa4, 
+  0x00, 0xb0, 0xfb, 0x00, 0xb0, 0xff, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xb7, 0x00, 0xb0, 0x0c, 0xa1, 0x00, 0x00, 0x00, 0x04, 0x00, 0xb8, 0x47, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xf0, 
+  0x00, 0xb8, 0x57, 0x92, 0x00, 0x00, 0x00, 0x05, 0x00, 0x80, 0x03, 0x00, 0xb8, 0x60, 0x00, 0xb8, 0xf3, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0x43, 0xa2, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0xb8, 0x68, 0x00, 0xb8, 0xe8, 0x00, 0xb8, 0x37, 0x95, 0x00, 0x00, 0x00, 0x02, 0x00, 0xb8, 0x43, 0x00, 0xb8, 0xe4, 0x00, 0xb8, 0x68, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x18, 0x97, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xb8, 0x18, 0xae, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa8, 0x07, 0x00, 0xb8, 0x28, 0x82, 0x00, 0xb8, 0x4f, 0x02, 0x00, 0xb8, 0x4c, 0x00, 0xb0, 0x28, 0x00, 0xa8, 0x07, 0xb5, 
+  0x00, 0x00, 0x00, 0x03, 0x00, 0xb8, 0x17, 0x00, 0xb0, 0x74, 0x00, 0xb8, 0xd3, 0x00, 0xb8, 0xf8, 0x83, 0x00, 0xb8, 0xff, 0x03, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0xdb, 0x00, 0xb8, 0x80, 0x00, 0xb8, 
+  0x17, 0xb1, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc0, 0x04, 0x00, 0xb8, 0x6b, 0x00, 0xb8, 0xe8, 0x89, 0x00, 0xb8, 0xff, 0x02, 0x00, 0xb8, 0xec, 0x00, 0xb8, 0x6b, 0x00, 0xa8, 0x03, 0xae, 0x00, 0x00, 
+  0x00, 0x0d, 0x00, 0xb8, 0x14, 0x00, 0xb8, 0xa7, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0xb8, 0xc3, 0x00, 0xb8, 0x7f, 0x00, 0xb8, 0x58, 0x00, 0xb8, 0x30, 0x00, 0xb0, 0x2b, 
+  0x00, 0xb8, 0x50, 0x00, 0xb8, 0x74, 0x00, 0xb8, 0xc0, 0x00, 0xb8, 0xfc, 0x81, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xb8, 0xa8, 0x00, 0xb0, 0x13, 0xac, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0x13, 0x00, 
+  0xb8, 0xc4, 0x81, 0x00, 0xb8, 0xff, 0x02, 0x00, 0xb8, 0xbc, 0x00, 0xb8, 0x38, 0x00, 0xa8, 0x03, 0x86, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb0, 0x34, 0x00, 0xb8, 0xbf, 0x81, 0x00, 0xb8, 0xff, 0x01, 
+  0x00, 0xb8, 0xc3, 0x00, 0xb0, 0x10, 0xaa, 0x00, 0x00, 0x00, 0x05, 0x00, 0xa0, 0x08, 0x00, 0xb8, 0xc4, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xfb, 0x00, 0xb8, 0x78, 0x00, 0x80, 0x04, 0x89, 0x00, 0x00, 
+  0x00, 0x05, 0x00, 0xa8, 0x07, 0x00, 0xb8, 0x7c, 0x00, 0xb8, 0xf8, 0x00, 0xb8, 0xff, 0x00, 0xb8, 0xbc, 0x00, 0xc8, 0x04, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb0, 0x1f, 0x00, 0xb8, 0xeb, 0x00, 
+  0xb8, 0xf7, 0x00, 0xb8, 0x5b, 0x8d, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb8, 0x5f, 0x00, 0xb8, 0xf7, 0x00, 0xb8, 0xe8, 0x00, 0xb0, 0x1c, 0xaa, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb0, 0x50, 0x00, 0xb0, 
+  0x6b, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb8, 0x6c, 0x00, 0xb0, 0x4b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0xa3, 0x50, 0x48, 0xa3, 
+  0x50, 0x9c, 0xa3, 0x50, 0xb0, 0xa3, 0x50, 0xa0, 0xa3, 0x50, 0x57, 0x00, 0x48, 0x07, 0xb7, 0x00, 0x00, 0x00, 0x01, 0xa3, 0x40, 0x0c, 0xa3, 0x50, 0xb0, 0x84, 0xa3, 0x50, 0xff, 0x01, 0xa3, 0x50, 
+  0xcb, 0xa2, 0x50, 0x1b, 0xb6, 0x00, 0x00, 0x00, 0x09, 0xa3, 0x50, 0xa4, 0xa3, 0x50, 0xff, 0xa2, 0x48, 0xff, 0x61, 0x38, 0xff, 0x41, 0x38, 0xff, 0x61, 0x38, 0xff, 0xa2, 0x48, 0xff, 0xa3, 0x50, 
+  0xff, 0xa3, 0x50, 0xd0, 0x00, 0x48, 0x07, 0xb4, 0x00, 0x00, 0x00, 0x03, 0xa3, 0x50, 0x3f, 0xa3, 0x50, 0xff, 0xa2, 0x48, 0xff, 0x41, 0x30, 0xff, 0x82, 0x21, 0x28, 0xff, 0x03, 0x21, 0x30, 0xff, 
+  0x82, 0x48, 0xff, 0xa3, 0x50, 0xff, 0xa2, 0x48, 0x68, 0xb2, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x0f, 0x5d, 0xef, 0x77, 0xeb, 0x82, 0xd7, 0xa3, 0x50, 0xff, 0x61, 0x38, 0xff, 0x84, 0x21, 0x28, 
+  0xff, 0x04, 0x41, 0x30, 0xff, 0xa3, 0x50, 0xff, 0x04, 0x51, 0xdc, 0x4d, 0x6b, 0x77, 0xd3, 0x9c, 0x0f, 0xaf, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0x4f, 0xbe, 0xf7, 0xe8, 0x1c, 0xe7, 0xff, 0xcf, 
+  0x93, 0xff, 0x69, 0x72, 0xff, 0xe8, 0x59, 0xff, 0xa7, 0x51, 0xff, 0x66, 0x49, 0xff, 0x45, 0x41, 0xff, 0x04, 0x39, 0xff, 0xe4, 0x38, 0xff, 0x04, 0x39, 0xff, 0x45, 0x51, 0xff, 0x65, 0x49, 0xff, 
+  0xcf, 0x7b, 0xff, 0xd3, 0x9c, 0xe8, 0x96, 0xb5, 0x4f, 0xad, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x5f, 0xdf, 0xff, 0xfc, 0x5d, 0xef, 0xff, 0xbb, 0xde, 0xf3, 0x39, 0xce, 0x8f, 0xb6, 0xb5, 0x54, 
+  0x14, 0xa5, 0x37, 0x92, 0x94, 0x2f, 0xf0, 0x83, 0x2c, 0x6d, 0x6b, 0x2c, 0xab, 0x5a, 0x2c, 0x8a, 0x52, 0x2c, 0x4d, 0x6b, 0x34, 0x6e, 0x73, 0x50, 0x0c, 0x63, 0x88, 0xcf, 0x7b, 0xf0, 0xb3, 0x9c, 
+  0xff, 0xb6, 0xb5, 0xfc, 0x79, 0xce, 0x5f, 0xab, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xf7, 0x7e, 0xf7, 0xff, 0x1c, 0xe7, 0xbf, 0xba, 0xd6, 0x18, 0x8a, 0x00, 0x00, 0x00, 0x04, 
+  0x10, 0x84, 0x18, 0xb3, 0x9c, 0xbf, 0x96, 0xb5, 0xff, 0x7a, 0xd6, 0xf7, 0x1c, 0xe7, 0x2c, 0xaa, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xbb, 0xbf, 0xff, 0xff, 0x3c, 0xe7, 0xd0, 0x39, 0xce, 0x08, 
+  0x8c, 0x00, 0x00, 0x00, 0x03, 0xf4, 0xa4, 0x0c, 0x76, 0xb5, 0xcf, 0x59, 0xce, 0xff, 0x3c, 0xe7, 0xbb, 0xa9, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x23, 0xdf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x1c, 
+  0xe7, 0x38, 0x8e, 0x00, 0x00, 0x00, 0x03, 0x96, 0xb5, 0x33, 0x39, 0xce, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0x23, 0xa8, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xff, 0x68, 0x9e, 0xf7, 0xff, 0xfc, 0xe6, 
+  0xd3, 0x90, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0xd3, 0xfc, 0xe6, 0xff, 0xbe, 0xf7, 0x68, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x9e, 0xf7, 0x7f, 0x3c, 0xe7, 0xff, 0xbb, 0xde, 0x9f, 0x90, 0x00, 0x00, 
+  0x00, 0x02, 0x18, 0xc6, 0x9f, 0xdb, 0xde, 0xff, 0x9e, 0xf7, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x3d, 0xef, 0x7f, 0xdb, 0xde, 0xff, 0x59, 0xce, 0x84, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x24, 0x82, 
+  0x00, 0xb8, 0x8b, 0x04, 0x00, 0xb0, 0x24, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0x17, 0x07, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 
+  0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x84, 0xba, 0xd6, 0xff, 0x7d, 0xef, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0xdb, 0xde, 0x7f, 0x79, 0xce, 0xff, 0xf8, 0xc5, 0x7f, 0x00, 0x00, 
+  0x00, 0x00, 0xb8, 0x7f, 0x82, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xb8, 0x7f, 0x00, 0x00, 0x74, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x74, 0x82, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x74, 0x00, 
+  0x00, 0x00, 0xd7, 0xbd, 0x7f, 0x9a, 0xd6, 0xff, 0x3d, 0xef, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x7a, 0xd6, 0x7f, 0x18, 0xc6, 0xff, 0x96, 0xb5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x23, 0x82, 
+  0x00, 0xb8, 0x8b, 0x04, 0x00, 0xb8, 0x23, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0x17, 0x07, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 
+  0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x7f, 0x59, 0xce, 0xff, 0x1c, 0xe7, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x7f, 0xb6, 0xb5, 0xff, 0x35, 0xad, 0x7f, 0x90, 0x00, 
+  0x00, 0x00, 0x02, 0x96, 0xb5, 0x7f, 0x39, 0xce, 0xff, 0xfc, 0xe6, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0xb7, 0xbd, 0x7f, 0x35, 0xad, 0xff, 0xd3, 0x9c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x81, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x81, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x58, 0x00, 
+  0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x75, 0xad, 0x7f, 0x18, 0xc6, 0xff, 0xdb, 0xde, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x55, 0xad, 0x7f, 0xd3, 0x9c, 0xff, 0x72, 
+  0x94, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x70, 
+  0x00, 0x00, 0x00, 0x35, 0xad, 0x7f, 0xf7, 0xbd, 0xff, 0xba, 0xd6, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0xf4, 0xa4, 0x7f, 0x72, 0x94, 0xff, 0x10, 0x84, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 
+  0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x81, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x81, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x00, 0xb3, 0x00, 
+  0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x7f, 0xd7, 0xbd, 0xff, 0x7a, 0xd6, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x92, 0x94, 0x7f, 0x10, 0x84, 0xff, 0xae, 
+  0x73, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x02, 0xf4, 0xa4, 0x7f, 0x96, 0xb5, 0xff, 0x59, 0xce, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x31, 0x8c, 0x7f, 0xaf, 0x7b, 0xff, 0x4d, 0x6b, 0x7f, 0x81, 0x00, 
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x02, 0xd3, 0x9c, 0x7f, 0x76, 0xb5, 0xff, 0x39, 0xce, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0xcf, 0x7b, 0x7f, 0x4d, 0x6b, 
+  0xff, 0xeb, 0x5a, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0xff, 0x04, 0x00, 
+  0x00, 0x63, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x7f, 0x55, 0xad, 0xff, 0x18, 0xc6, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x6b, 0x7f, 0xec, 0x62, 0xff, 0x8a, 0x52, 0x7f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x00, 0x3f, 0x07, 0x00, 0x00, 
+  0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x72, 0x94, 0x7f, 0x34, 0xa5, 0xff, 0xf7, 0xbd, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x63, 0x7f, 0x8a, 0x52, 
+  0xff, 0x28, 0x42, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x02, 0x51, 0x8c, 0x7f, 0x14, 0xa5, 0xff, 0xb7, 0xbd, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0xaa, 0x52, 0x7f, 0x29, 0x4a, 0xff, 0xc7, 0x39, 0x7f, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x02, 0x31, 0x8c, 0x7f, 
+  0xd3, 0x9c, 0xff, 0x96, 0xb5, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0x29, 0x4a, 0x7f, 0xc7, 0x39, 0xff, 0x45, 0x29, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xf8, 0x81, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x00, 0x4c, 0x07, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 
+  0x00, 0x4c, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x7f, 0xb3, 0x9c, 0xff, 0x76, 0xb5, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0xc7, 0x39, 0x7f, 0x66, 0x31, 0xff, 0xe4, 0x20, 0x7f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x7f, 0x92, 0x94, 0xff, 0x55, 0xad, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x66, 0x31, 0x7f, 0x04, 0x21, 
+  0xff, 0x82, 0x10, 0x7f, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x02, 0xae, 0x73, 0x7f, 0x71, 0x8c, 0xff, 0x34, 0xa5, 0x7f, 0xa8, 0x00, 0x00, 0x00, 
+  0x02, 0x04, 0x21, 0x7f, 0xa3, 0x18, 0xff, 0x21, 0x08, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x02, 0x8e, 0x73, 0x7f, 0x51, 0x8c, 0xff, 0x14, 0xa5, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x6b, 0x04, 0x10, 0x84, 0x0b, 0xd3, 0x9c, 0x04, 0xd4, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0xb8, 0x00, 0x13, 0xb8, 0x00, 0x34, 0xb8, 0x00, 0x5c, 0xb8, 0x00, 0x7c, 0xb8, 0x00, 0x94, 0xb8, 0x00, 0xac, 0xb8, 0x00, 0xaf, 0xb8, 0x00, 0xaf, 0xb8, 0x00, 0xb0, 0xb8, 0x00, 0x9c, 0xb8, 0x00, 0x83, 0xb8, 0x00, 0x60, 0xb8, 0x00, 0x38, 0xb8, 0x00, 0x17, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x04, 0xb0, 0x00, 0x37, 0xb8, 0x00, 0x83, 0xb8, 0x00, 0xcb, 0xb8, 0x00, 0xef, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xef, 0xb8, 0x00, 0xc8, 0xb8, 0x00, 0x80, 0xb8, 0x00, 0x37, 0xa8, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x14, 0xb8, 0x00, 0x70, 0xb8, 0x00, 0xd3, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xd3, 0xb8, 0x00, 0x73, 0xb0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x13, 0xb8, 0x00, 0x83, 0xb8, 0x00, 0xeb, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0xdb, 0xb8, 0x00, 0xa7, 0xb0, 0x00, 0x7b, 0xb8, 0x00, 0x57, 0xb0, 0x00, 0x3c, 0xb8, 0x00, 0x30, 0xb8, 0x00, 0x20, 0xb8, 0x00, 0x1f, 0xb8, 0x00, 0x2b, 0xb8, 0x00, 0x30, 0xb8, 0x00, 0x4f, 0xb8, 0x00, 0x78, 0xb8, 0x00, 0xa8, 0xb8, 0x00, 0xdc, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xef, 0xb8, 0x00, 0x7f, 0xb8, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0xb8, 0x00, 0x60, 0xb8, 0x00, 0xe4, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xcb, 0xb8, 0x00, 0x73, 0xb0, 0x00, 0x27, 0xa8, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x07, 0xb8, 0x00, 0x2c, 0xb8, 0x00, 0x78, 0xb8, 0x00, 0xd0, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xe8, 0xb8, 0x00, 0x67, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x23, 0xb8, 0x00, 0xb4, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0xa4, 0xb8, 0x00, 0x38, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x04, 0xb8, 0x00, 0x3f, 0xb8, 0x00, 0xa7, 0xb8, 0x00, 0xf4, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xb8, 0xb8, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x50, 0xb8, 0x00, 0xe7, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xb0, 0xb8, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xb0, 0x00, 0x2f, 0xb8, 0x00, 0xb0, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xeb, 0xb0, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x04, 0xb8, 0x00, 0x7c, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xe3, 0xb8, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0xb0, 0x00, 0x50, 0xb8, 0x00, 0xdf, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x04, 0xb8, 0x00, 0x94, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xb0, 0xb0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x17, 0xb8, 0x00, 0xa8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0x94, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x80, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0xb0, 0x00, 0x83, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x04, 0xb8, 0x00, 0x7c, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x28, 0xb8, 0x00, 0xe3, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x40, 0x00, 0x10, 0x98, 0x00, 0x04, 0x58, 0x00, 0x14, 0x10, 0x00, 0x4f, 0x08, 0x00, 0x48, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x63, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0xe4, 0xb8, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x2f, 0xb8, 0x00, 0x58, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2c, 0x78, 0x00, 0x10, 0x58, 0x00, 0x80, 0xb8, 0x00, 0x83, 0x90, 0x00, 0xc0, 0x90, 0x00, 0xe7, 0xb0, 0x00, 0xe8, 0xb8, 0x00, 0xec, 0x98, 0x00, 0xef, 0xb0, 0x00, 0xec, 0xa8, 0x00, 0xdb, 0x90, 0x00, 0xbf, 0xb0, 0x00, 0x84, 0x60, 0x00, 0x83, 0x18, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x03, 0x00, 0x00, 0x37, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x5b, 0xb8, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0xa8, 0x00, 0x93, 0xb8, 0x00, 0xe4, 0x98, 0x00, 0xfc, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x98, 0x00, 0xff, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x98, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x90, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0x90, 0x00, 0xef, 0xb8, 0x00, 0x8f, 0x90, 0x00, 0x30, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x00, 0x4c, 0xb8, 0x00, 0xa3, 0x98, 0x00, 0xf7, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x98, 0x00, 0xff, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0x98, 0x00, 0xf4, 0xb0, 0x00, 0xdf, 0xb8, 0x00, 0xc8, 0x90, 0x00, 0xdb, 0xb8, 0x00, 0xdb, 0xb8, 0x00, 0xf0, 0x98, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x98, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb0, 0x00, 0xf7, 0x88, 0x00, 0xb0, 0xb8, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x90, 0x00, 0x6f, 0xa0, 0x00, 0xf3, 0xb8, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xf7, 0x88, 0x00, 0xcf, 0xb0, 0x00, 0x67, 0xb8, 0x00, 0x2b, 0x20, 0x00, 0x4c, 0x28, 0x00, 0x14, 0xf8, 0x00, 0x00, 0x08, 0x00, 0x54, 0x80, 0x00, 0x04, 0x68, 0x00, 0x0b, 0x40, 0x00, 0x70, 0xb8, 0x00, 0x68, 0xb8, 0x00, 0xb0, 0x90, 0x00, 0xf7, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x98, 0x00, 0xff, 0xb8, 0x00, 0xeb, 0x90, 0x00, 0x7b, 0x08, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x04, 0xb8, 0x00, 0x98, 0xa8, 0x00, 0xfc, 0xa0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb0, 0x00, 0xf0, 0x78, 0x00, 0xb4, 0x38, 0x00, 0x5c, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x50, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x64, 0xb8, 0x00, 0x84, 0xb8, 0x00, 0xef, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x90, 0x00, 0xfc, 0xb0, 0x00, 0x9f, 0xa8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x0b, 0xb8, 0x00, 0xbb, 0xb8, 0x00, 0xff, 0xb0, 0x00, 0xff, 0xb0, 0x00, 0xfc, 0xb8, 0x00, 0xa7, 0xb8, 0x00, 0x1c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x1b, 0xb8, 0x00, 0xa4, 0xb0, 0x00, 0xfb, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xb7, 0xb0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x47, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xf0, 0xb8, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0xb8, 0x00, 0x60, 0xb8, 0x00, 0xf3, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x68, 0xb8, 0x00, 0xe8, 0xb8, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x43, 0xb8, 0x00, 0xe4, 0xb8, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x07, 0xb8, 0x00, 0x28, 0xb8, 0x00, 0x4f, 0xb8, 0x00, 0x4f, 0xb8, 0x00, 0x4f, 0xb8, 0x00, 0x4c, 0xb0, 0x00, 0x28, 0xa8, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x17, 0xb0, 0x00, 0x74, 0xb8, 0x00, 0xd3, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xdb, 0xb8, 0x00, 0x80, 0xb8, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x04, 0xb8, 0x00, 0x6b, 0xb8, 0x00, 0xe8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xec, 0xb8, 0x00, 0x6b, 0xa8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x14, 0xb8, 0x00, 0xa7, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xc3, 0xb8, 0x00, 0x7f, 0xb8, 0x00, 0x58, 0xb8, 0x00, 0x30, 0xb0, 0x00, 0x2b, 0xb8, 0x00, 0x50, 0xb8, 0x00, 0x74, 0xb8, 0x00, 0xc0, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xa8, 0xb0, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x13, 0xb8, 0x00, 0xc4, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xbc, 0xb8, 0x00, 0x38, 0xa8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xb0, 0x00, 0x34, 0xb8, 0x00, 0xbf, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xc3, 0xb0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x08, 0xb8, 0x00, 0xc4, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0x78, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x07, 0xb8, 0x00, 0x7c, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xbc, 0xc8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x1f, 0xb8, 0x00, 0xeb, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x5f, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0xe8, 0xb0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x50, 0xb0, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x6c, 0xb0, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0xa3, 0x48, 0x50, 0xa3, 0x9c, 0x50, 0xa3, 0xb0, 0x50, 0xa3, 0xa0, 0x50, 0xa3, 0x57, 0x48, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa3, 0x0c, 0x50, 0xa3, 0xb0, 0x50, 0xa3, 0xff, 0x50, 0xa3, 0xff, 0x50, 0xa3, 0xff, 0x50, 0xa3, 0xff, 0x50, 0xa3, 0xff, 0x50, 0xa3, 0xcb, 0x50, 0xa2, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xa3, 0xa4, 0x50, 0xa3, 0xff, 0x48, 0xa2, 0xff, 0x38, 0x61, 0xff, 0x38, 0x41, 0xff, 0x38, 0x61, 0xff, 0x48, 0xa2, 0xff, 0x50, 0xa3, 0xff, 0x50, 0xa3, 0xd0, 0x48, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xa3, 0x3f, 0x50, 0xa3, 0xff, 0x48, 0xa2, 0xff, 0x30, 0x41, 0xff, 0x28, 0x21, 0xff, 0x28, 0x21, 0xff, 0x28, 0x21, 0xff, 0x30, 0x21, 0xff, 0x48, 0x82, 0xff, 0x50, 0xa3, 0xff, 0x48, 0xa2, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0xef, 0x5d, 0x77, 0x82, 0xeb, 0xd7, 0x50, 0xa3, 0xff, 0x38, 0x61, 0xff, 0x28, 0x21, 0xff, 0x28, 0x21, 0xff, 0x28, 0x21, 0xff, 0x28, 0x21, 0xff, 0x28, 0x21, 0xff, 0x30, 0x41, 0xff, 0x50, 0xa3, 0xff, 0x51, 0x04, 0xdc, 0x6b, 0x4d, 0x77, 0x9c, 0xd3, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4f, 0xf7, 0xbe, 0xe8, 0xe7, 0x1c, 0xff, 0x93, 0xcf, 0xff, 0x72, 0x69, 0xff, 0x59, 0xe8, 0xff, 0x51, 0xa7, 0xff, 0x49, 0x66, 0xff, 0x41, 0x45, 0xff, 0x39, 0x04, 0xff, 0x38, 0xe4, 0xff, 0x39, 0x04, 0xff, 0x51, 0x45, 0xff, 0x49, 0x65, 0xff, 0x7b, 0xcf, 0xff, 0x9c, 0xd3, 0xe8, 0xb5, 0x96, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5f, 0xff, 0xdf, 0xfc, 0xef, 0x5d, 0xff, 0xde, 0xbb, 0xf3, 0xce, 0x39, 0x8f, 0xb5, 0xb6, 0x54, 0xa5, 0x14, 0x37, 0x94, 0x92, 0x2f, 0x83, 0xf0, 0x2c, 0x6b, 0x6d, 0x2c, 0x5a, 0xab, 0x2c, 0x52, 0x8a, 0x2c, 0x6b, 0x4d, 0x34, 0x73, 0x6e, 0x50, 0x63, 0x0c, 0x88, 0x7b, 0xcf, 0xf0, 0x9c, 0xb3, 0xff, 0xb5, 0xb6, 0xfc, 0xce, 0x79, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xf7, 0xf7, 0x7e, 0xff, 0xe7, 0x1c, 0xbf, 0xd6, 0xba, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x18, 0x9c, 0xb3, 0xbf, 0xb5, 0x96, 0xff, 0xd6, 0x7a, 0xf7, 0xe7, 0x1c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xe7, 0x3c, 0xd0, 0xce, 0x39, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x0c, 0xb5, 0x76, 0xcf, 0xce, 0x59, 0xff, 0xe7, 0x3c, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x23, 0xff, 0xdf, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x33, 0xce, 0x39, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x68, 0xf7, 0x9e, 0xff, 0xe6, 0xfc, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xd3, 0xe6, 0xfc, 0xff, 0xf7, 0xbe, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x9e, 0x7f, 0xe7, 0x3c, 0xff, 0xde, 0xbb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x9f, 0xde, 0xdb, 0xff, 0xf7, 0x9e, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x3d, 0x7f, 0xde, 0xdb, 0xff, 0xce, 0x59, 0x84, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x24, 0xb8, 0x00, 0x8b, 0xb8, 0x00, 0x8b, 0xb8, 0x00, 0x8b, 0xb0, 0x00, 0x24, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x84, 0xd6, 0xba, 0xff, 0xef, 0x7d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x7f, 0xce, 0x79, 0xff, 0xc5, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x7f, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0x7f, 0x00, 0x00, 0x74, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x7f, 0xd6, 0x9a, 0xff, 0xef, 0x3d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x7f, 0xc6, 0x18, 0xff, 0xb5, 0x96, 0x7f, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x23, 0xb8, 0x00, 0x8b, 0xb8, 0x00, 0x8b, 0xb8, 0x00, 0x8b, 0xb8, 0x00, 0x23, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x7f, 0xce, 0x59, 0xff, 0xe7, 0x1c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x7f, 0xb5, 0xb6, 0xff, 0xad, 0x35, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x7f, 0xce, 0x39, 0xff, 0xe6, 0xfc, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x7f, 0xad, 0x35, 0xff, 0x9c, 0xd3, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xad, 0x75, 0x7f, 0xc6, 0x18, 0xff, 0xde, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x7f, 0x9c, 0xd3, 0xff, 0x94, 0x72, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xad, 0x35, 0x7f, 0xbd, 0xf7, 0xff, 0xd6, 0xba, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x7f, 0x94, 0x72, 0xff, 0x84, 0x10, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2b, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2b, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x7f, 0xbd, 0xd7, 0xff, 0xd6, 0x7a, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x92, 0x7f, 0x84, 0x10, 0xff, 0x73, 0xae, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x7f, 0xb5, 0x96, 0xff, 0xce, 0x59, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x7f, 0x7b, 0xaf, 0xff, 0x6b, 0x4d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x7f, 0xb5, 0x76, 0xff, 0xce, 0x39, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xcf, 0x7f, 0x6b, 0x4d, 0xff, 0x5a, 0xeb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x63, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x7f, 0xad, 0x55, 0xff, 0xc6, 0x18, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0x7f, 0x62, 0xec, 0xff, 0x52, 0x8a, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x94, 0x72, 0x7f, 0xa5, 0x34, 0xff, 0xbd, 0xf7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x7f, 0x52, 0x8a, 0xff, 0x42, 0x28, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x7f, 0xa5, 0x14, 0xff, 0xbd, 0xb7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x7f, 0x4a, 0x29, 0xff, 0x39, 0xc7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x7f, 0x9c, 0xd3, 0xff, 0xb5, 0x96, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x7f, 0x39, 0xc7, 0xff, 0x29, 0x45, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x7f, 0x9c, 0xb3, 0xff, 0xb5, 0x76, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x7f, 0x31, 0x66, 0xff, 0x20, 0xe4, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x7b, 0xcf, 0x7f, 0x94, 0x92, 0xff, 0xad, 0x55, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x66, 0x7f, 0x21, 0x04, 0xff, 0x10, 0x82, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xae, 0x7f, 0x8c, 0x71, 0xff, 0xa5, 0x34, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x7f, 0x18, 0xa3, 0xff, 0x08, 0x21, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8e, 0x7f, 0x8c, 0x51, 0xff, 0xa5, 0x14, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x2d, 0x04, 0x84, 0x10, 0x0b, 0x9c, 0xd3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xd7, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x03, 0xb8, 0x00, 0x13, 0xb8, 0x00, 0x34, 0xb8, 0x00, 0x5c, 0xb8, 0x00, 0x7c, 0xb8, 0x00, 0x94, 0xb8, 0x00, 0xac, 0x81, 0xb8, 
+  0x00, 0xaf, 0x06, 0xb8, 0x00, 0xb0, 0xb8, 0x00, 0x9c, 0xb8, 0x00, 0x83, 0xb8, 0x00, 0x60, 0xb8, 0x00, 0x38, 0xb8, 0x00, 0x17, 0xc0, 0x00, 0x04, 0xac, 0x00, 0x00, 0x00, 0x05, 0xc0, 0x00, 0x04, 
+  0xb0, 0x00, 0x37, 0xb8, 0x00, 0x83, 0xb8, 0x00, 0xcb, 0xb8, 0x00, 0xef, 0xb8, 0x00, 0xfc, 0x89, 0xb8, 0x00, 0xff, 0x05, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xef, 0xb8, 0x00, 0xc8, 0xb8, 0x00, 0x80, 
+  0xb8, 0x00, 0x37, 0xa8, 0x00, 0x07, 0xa7, 0x00, 0x00, 0x00, 0x03, 0xb0, 0x00, 0x14, 0xb8, 0x00, 0x70, 0xb8, 0x00, 0xd3, 0xb8, 0x00, 0xfc, 0x85, 0xb8, 0x00, 0xff, 0x01, 0xb8, 0x00, 0xfc, 0xb8, 
+  0x00, 0xfb, 0x81, 0xb8, 0x00, 0xf8, 0x00, 0xb8, 0x00, 0xfb, 0x86, 0xb8, 0x00, 0xff, 0x03, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xd3, 0xb8, 0x00, 0x73, 0xb0, 0x00, 0x0c, 0xa3, 0x00, 0x00, 0x00, 0x02, 
+  0xa8, 0x00, 0x13, 0xb8, 0x00, 0x83, 0xb8, 0x00, 0xeb, 0x83, 0xb8, 0x00, 0xff, 0x0f, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0xdb, 0xb8, 0x00, 0xa7, 0xb0, 0x00, 0x7b, 0xb8, 0x00, 0x57, 0xb0, 0x00, 0x3c, 
+  0xb8, 0x00, 0x30, 0xb8, 0x00, 0x20, 0xb8, 0x00, 0x1f, 0xb8, 0x00, 0x2b, 0xb8, 0x00, 0x30, 0xb8, 0x00, 0x4f, 0xb8, 0x00, 0x78, 0xb8, 0x00, 0xa8, 0xb8, 0x00, 0xdc, 0xb8, 0x00, 0xfb, 0x83, 0xb8, 
+  0x00, 0xff, 0x02, 0xb8, 0x00, 0xef, 0xb8, 0x00, 0x7f, 0xb8, 0x00, 0x13, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x03, 0xb8, 0x00, 0x60, 0xb8, 0x00, 0xe4, 0x82, 0xb8, 0x00, 0xff, 0x04, 0xb8, 
+  0x00, 0xfc, 0xb8, 0x00, 0xcb, 0xb8, 0x00, 0x73, 0xb0, 0x00, 0x27, 0xa8, 0x00, 0x07, 0x8b, 0x00, 0x00, 0x00, 0x03, 0xa8, 0x00, 0x07, 0xb8, 0x00, 0x2c, 0xb8, 0x00, 0x78, 0xb8, 0x00, 0xd0, 0x83, 
+  0xb8, 0x00, 0xff, 0x02, 0xb8, 0x00, 0xe8, 0xb8, 0x00, 0x67, 0xc0, 0x00, 0x04, 0x9c, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x23, 0xb8, 0x00, 0xb4, 0x82, 0xb8, 0x00, 0xff, 0x03, 0xb8, 0x00, 0xf7, 
+  0xb8, 0x00, 0xa4, 0xb8, 0x00, 0x38, 0x80, 0x00, 0x03, 0x91, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x04, 0xb8, 0x00, 0x3f, 0xb8, 0x00, 0xa7, 0xb8, 0x00, 0xf4, 0x82, 0xb8, 0x00, 0xff, 0x01, 0xb8, 
+  0x00, 0xb8, 0xb8, 0x00, 0x23, 0x9a, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x00, 0x50, 0xb8, 0x00, 0xe7, 0x81, 0xb8, 0x00, 0xff, 0x02, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xb0, 0xb8, 0x00, 0x2f, 0x97, 0x00, 
+  0x00, 0x00, 0x02, 0xb0, 0x00, 0x2f, 0xb8, 0x00, 0xb0, 0xb8, 0x00, 0xfb, 0x81, 0xb8, 0x00, 0xff, 0x01, 0xb8, 0x00, 0xeb, 0xb0, 0x00, 0x53, 0x97, 0x00, 0x00, 0x00, 0x02, 0xc0, 0x00, 0x04, 0xb8, 
+  0x00, 0x7c, 0xb8, 0x00, 0xf8, 0x81, 0xb8, 0x00, 0xff, 0x01, 0xb8, 0x00, 0xe3, 0xb8, 0x00, 0x4c, 0x9a, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x03, 0xb0, 0x00, 0x50, 0xb8, 0x00, 0xdf, 0x81, 0xb8, 
+  0x00, 0xff, 0x01, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0x7c, 0x95, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x04, 0xb8, 0x00, 0x94, 0x82, 0xb8, 0x00, 0xff, 0x01, 0xb8, 0x00, 0xb0, 0xb0, 0x00, 0x14, 0x9d, 
+  0x00, 0x00, 0x00, 0x01, 0xb8, 0x00, 0x17, 0xb8, 0x00, 0xa8, 0x82, 0xb8, 0x00, 0xff, 0x01, 0xb8, 0x00, 0x94, 0x80, 0x00, 0x04, 0x93, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x80, 0x81, 0xb8, 0x00, 
+  0xff, 0x02, 0xb8, 0x00, 0xfc, 0xb0, 0x00, 0x83, 0xc0, 0x00, 0x04, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x98, 0x00, 0x04, 0xb8, 0x00, 0x7c, 0xb8, 0x00, 0xfb, 0x81, 0xb8, 0x00, 0xff, 0x00, 0xb8, 0x00, 
+  0x83, 0x93, 0x00, 0x00, 0x00, 0x03, 0xb0, 0x00, 0x28, 0xb8, 0x00, 0xe3, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0x6c, 0x85, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x40, 0x00, 0x10, 0x98, 0x00, 0x04, 0x58, 0x00, 0x14, 0x10, 0x00, 
+  0x4f, 0x08, 0x00, 0x48, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x43, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x3b, 0x85, 0x00, 
+  0x00, 0x00, 0x03, 0xb8, 0x00, 0x63, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0xe4, 0xb8, 0x00, 0x27, 0x94, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x2f, 0xb8, 0x00, 0x58, 0x85, 0x00, 0x00, 0x00, 0x13, 0x00, 
+  0x00, 0x30, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2c, 0x78, 0x00, 0x10, 0x58, 0x00, 0x80, 0xb8, 0x00, 0x83, 0x90, 0x00, 0xc0, 0x90, 0x00, 0xe7, 
+  0xb0, 0x00, 0xe8, 0xb8, 0x00, 0xec, 0x98, 0x00, 0xef, 0xb0, 0x00, 0xec, 0xa8, 0x00, 0xdb, 0x90, 0x00, 0xbf, 0xb0, 0x00, 0x84, 0x60, 0x00, 0x83, 0x18, 0x00, 0x64, 0x81, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x58, 0x00, 0x00, 0x03, 0x00, 0x00, 0x37, 0x00, 0x00, 0x23, 0x85, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x00, 0x5b, 0xb8, 0x00, 0x2c, 0x9e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x24, 0x00, 
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0xa8, 0x00, 0x93, 0xb8, 0x00, 0xe4, 0x98, 0x00, 0xfc, 0x81, 0xb8, 0x00, 0xff, 0x03, 0x98, 0x00, 0xff, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x98, 
+  0x00, 0xff, 0x81, 0xb8, 0x00, 0xff, 0x09, 0x90, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0x90, 0x00, 0xef, 0xb8, 0x00, 0x8f, 0x90, 0x00, 0x30, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x17, 0x00, 0x00, 0x40, 0xa6, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x24, 0x48, 0x00, 0x4c, 0xb8, 0x00, 0xa3, 0x98, 0x00, 0xf7, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0x98, 0x00, 0xff, 0xb0, 
+  0x00, 0xff, 0xb8, 0x00, 0xfb, 0x98, 0x00, 0xf4, 0xb0, 0x00, 0xdf, 0xb8, 0x00, 0xc8, 0x90, 0x00, 0xdb, 0xb8, 0x00, 0xdb, 0xb8, 0x00, 0xf0, 0x98, 0x00, 0xff, 0x81, 0xb8, 0x00, 0xff, 0x06, 0x98, 
+  0x00, 0xff, 0xb8, 0x00, 0xff, 0xb0, 0x00, 0xf7, 0x88, 0x00, 0xb0, 0xb8, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x44, 0xa5, 0x00, 0x00, 0x00, 0x13, 0x80, 0x00, 0x03, 0x90, 0x00, 0x6f, 0xa0, 
+  0x00, 0xf3, 0xb8, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xf7, 0x88, 0x00, 0xcf, 0xb0, 0x00, 0x67, 0xb8, 0x00, 0x2b, 0x20, 0x00, 0x4c, 0x28, 0x00, 0x14, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x54, 0x80, 0x00, 0x04, 0x68, 0x00, 0x0b, 0x40, 0x00, 0x70, 0xb8, 0x00, 0x68, 0xb8, 0x00, 0xb0, 0x90, 0x00, 0xf7, 0x81, 0xb8, 0x00, 0xff, 0x03, 0x98, 0x00, 0xff, 0xb8, 0x00, 0xeb, 
+  0x90, 0x00, 0x7b, 0x08, 0x00, 0x38, 0xa4, 0x00, 0x00, 0x00, 0x08, 0xc8, 0x00, 0x04, 0xb8, 0x00, 0x98, 0xa8, 0x00, 0xfc, 0xa0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb0, 0x00, 0xf0, 0x78, 0x00, 0xb4, 
+  0x38, 0x00, 0x5c, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x44, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x50, 0x00, 0x00, 0x24, 
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x64, 0xb8, 0x00, 0x84, 0xb8, 0x00, 0xef, 0x81, 0xa0, 0x00, 0xff, 0x02, 0x90, 0x00, 0xfc, 0xb0, 0x00, 0x9f, 0xa8, 0x00, 0x08, 0xa2, 0x00, 0x00, 0x00, 
+  0x08, 0xb8, 0x00, 0x0b, 0xb8, 0x00, 0xbb, 0xb8, 0x00, 0xff, 0xb0, 0x00, 0xff, 0xb0, 0x00, 0xfc, 0xb8, 0x00, 0xa7, 0xb8, 0x00, 0x1c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x82, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x1b, 0xb8, 0x00, 0xa4, 
+  0xb0, 0x00, 0xfb, 0xb0, 0x00, 0xff, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xb7, 0xb0, 0x00, 0x0c, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xb8, 0x00, 0x47, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xf0, 
+  0xb8, 0x00, 0x57, 0x92, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x03, 0xb8, 0x00, 0x60, 0xb8, 0x00, 0xf3, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0x43, 0xa2, 0x00, 0x00, 0x00, 0x02, 0xb8, 
+  0x00, 0x68, 0xb8, 0x00, 0xe8, 0xb8, 0x00, 0x37, 0x95, 0x00, 0x00, 0x00, 0x02, 0xb8, 0x00, 0x43, 0xb8, 0x00, 0xe4, 0xb8, 0x00, 0x68, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x18, 0x97, 0x00, 
+  0x00, 0x00, 0x00, 0xb8, 0x00, 0x18, 0xae, 0x00, 0x00, 0x00, 0x01, 0xa8, 0x00, 0x07, 0xb8, 0x00, 0x28, 0x82, 0xb8, 0x00, 0x4f, 0x02, 0xb8, 0x00, 0x4c, 0xb0, 0x00, 0x28, 0xa8, 0x00, 0x07, 0xb5, 
+  0x00, 0x00, 0x00, 0x03, 0xb8, 0x00, 0x17, 0xb0, 0x00, 0x74, 0xb8, 0x00, 0xd3, 0xb8, 0x00, 0xf8, 0x83, 0xb8, 0x00, 0xff, 0x03, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0xdb, 0xb8, 0x00, 0x80, 0xb8, 0x00, 
+  0x17, 0xb1, 0x00, 0x00, 0x00, 0x02, 0xc0, 0x00, 0x04, 0xb8, 0x00, 0x6b, 0xb8, 0x00, 0xe8, 0x89, 0xb8, 0x00, 0xff, 0x02, 0xb8, 0x00, 0xec, 0xb8, 0x00, 0x6b, 0xa8, 0x00, 0x03, 0xae, 0x00, 0x00, 
+  0x00, 0x0d, 0xb8, 0x00, 0x14, 0xb8, 0x00, 0xa7, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfc, 0xb8, 0x00, 0xc3, 0xb8, 0x00, 0x7f, 0xb8, 0x00, 0x58, 0xb8, 0x00, 0x30, 0xb0, 0x00, 0x2b, 
+  0xb8, 0x00, 0x50, 0xb8, 0x00, 0x74, 0xb8, 0x00, 0xc0, 0xb8, 0x00, 0xfc, 0x81, 0xb8, 0x00, 0xff, 0x01, 0xb8, 0x00, 0xa8, 0xb0, 0x00, 0x13, 0xac, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x00, 0x13, 0xb8, 
+  0x00, 0xc4, 0x81, 0xb8, 0x00, 0xff, 0x02, 0xb8, 0x00, 0xbc, 0xb8, 0x00, 0x38, 0xa8, 0x00, 0x03, 0x86, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x34, 0xb8, 0x00, 0xbf, 0x81, 0xb8, 0x00, 0xff, 0x01, 
+  0xb8, 0x00, 0xc3, 0xb0, 0x00, 0x10, 0xaa, 0x00, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x08, 0xb8, 0x00, 0xc4, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xfb, 0xb8, 0x00, 0x78, 0x80, 0x00, 0x04, 0x89, 0x00, 0x00, 
+  0x00, 0x05, 0xa8, 0x00, 0x07, 0xb8, 0x00, 0x7c, 0xb8, 0x00, 0xf8, 0xb8, 0x00, 0xff, 0xb8, 0x00, 0xbc, 0xc8, 0x00, 0x04, 0xa9, 0x00, 0x00, 0x00, 0x03, 0xb0, 0x00, 0x1f, 0xb8, 0x00, 0xeb, 0xb8, 
+  0x00, 0xf7, 0xb8, 0x00, 0x5b, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xb8, 0x00, 0x5f, 0xb8, 0x00, 0xf7, 0xb8, 0x00, 0xe8, 0xb0, 0x00, 0x1c, 0xaa, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x50, 0xb0, 0x00, 
+  0x6b, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x00, 0x6c, 0xb0, 0x00, 0x4b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x50, 0xa3, 0x48, 0x50, 
+  0xa3, 0x9c, 0x50, 0xa3, 0xb0, 0x50, 0xa3, 0xa0, 0x50, 0xa3, 0x57, 0x48, 0x00, 0x07, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x40, 0xa3, 0x0c, 0x50, 0xa3, 0xb0, 0x84, 0x50, 0xa3, 0xff, 0x01, 0x50, 0xa3, 
+  0xcb, 0x50, 0xa2, 0x1b, 0xb6, 0x00, 0x00, 0x00, 0x09, 0x50, 0xa3, 0xa4, 0x50, 0xa3, 0xff, 0x48, 0xa2, 0xff, 0x38, 0x61, 0xff, 0x38, 0x41, 0xff, 0x38, 0x61, 0xff, 0x48, 0xa2, 0xff, 0x50, 0xa3, 
+  0xff, 0x50, 0xa3, 0xd0, 0x48, 0x00, 0x07, 0xb4, 0x00, 0x00, 0x00, 0x03, 0x50, 0xa3, 0x3f, 0x50, 0xa3, 0xff, 0x48, 0xa2, 0xff, 0x30, 0x41, 0xff, 0x82, 0x28, 0x21, 0xff, 0x03, 0x30, 0x21, 0xff, 
+  0x48, 0x82, 0xff, 0x50, 0xa3, 0xff, 0x48, 0xa2, 0x68, 0xb2, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x0f, 0xef, 0x5d, 0x77, 0x82, 0xeb, 0xd7, 0x50, 0xa3, 0xff, 0x38, 0x61, 0xff, 0x84, 0x28, 0x21, 
+  0xff, 0x04, 0x30, 0x41, 0xff, 0x50, 0xa3, 0xff, 0x51, 0x04, 0xdc, 0x6b, 0x4d, 0x77, 0x9c, 0xd3, 0x0f, 0xaf, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0x4f, 0xf7, 0xbe, 0xe8, 0xe7, 0x1c, 0xff, 0x93, 
+  0xcf, 0xff, 0x72, 0x69, 0xff, 0x59, 0xe8, 0xff, 0x51, 0xa7, 0xff, 0x49, 0x66, 0xff, 0x41, 0x45, 0xff, 0x39, 0x04, 0xff, 0x38, 0xe4, 0xff, 0x39, 0x04, 0xff, 0x51, 0x45, 0xff, 0x49, 0x65, 0xff, 
+  0x7b, 0xcf, 0xff, 0x9c, 0xd3, 0xe8, 0xb5, 0x96, 0x4f, 0xad, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x5f, 0xff, 0xdf, 0xfc, 0xef, 0x5d, 0xff, 0xde, 0xbb, 0xf3, 0xce, 0x39, 0x8f, 0xb5, 0xb6, 0x54, 
+  0xa5, 0x14, 0x37, 0x94, 0x92, 0x2f, 0x83, 0xf0, 0x2c, 0x6b, 0x6d, 0x2c, 0x5a, 0xab, 0x2c, 0x52, 0x8a, 0x2c, 0x6b, 0x4d, 0x34, 0x73, 0x6e, 0x50, 0x63, 0x0c, 0x88, 0x7b, 0xcf, 0xf0, 0x9c, 0xb3, 
+  0xff, 0xb5, 0xb6, 0xfc, 0xce, 0x79, 0x5f, 0xab, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xf7, 0xf7, 0x7e, 0xff, 0xe7, 0x1c, 0xbf, 0xd6, 0xba, 0x18, 0x8a, 0x00, 0x00, 0x00, 0x04, 
+  0x84, 0x10, 0x18, 0x9c, 0xb3, 0xbf, 0xb5, 0x96, 0xff, 0xd6, 0x7a, 0xf7, 0xe7, 0x1c, 0x2c, 0xaa, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xbb, 0xff, 0xbf, 0xff, 0xe7, 0x3c, 0xd0, 0xce, 0x39, 0x08, 
+  0x8c, 0x00, 0x00, 0x00, 0x03, 0xa4, 0xf4, 0x0c, 0xb5, 0x76, 0xcf, 0xce, 0x59, 0xff, 0xe7, 0x3c, 0xbb, 0xa9, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x23, 0xff, 0xdf, 0xff, 0xef, 0x5d, 0xff, 0xe7, 
+  0x1c, 0x38, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xb5, 0x96, 0x33, 0xce, 0x39, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0x23, 0xa8, 0x00, 0x00, 0x00, 0x02, 0xff, 0xdf, 0x68, 0xf7, 0x9e, 0xff, 0xe6, 0xfc, 
+  0xd3, 0x90, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0xd3, 0xe6, 0xfc, 0xff, 0xf7, 0xbe, 0x68, 0xa8, 0x00, 0x00, 0x00, 0x02, 0xf7, 0x9e, 0x7f, 0xe7, 0x3c, 0xff, 0xde, 0xbb, 0x9f, 0x90, 0x00, 0x00, 
+  0x00, 0x02, 0xc6, 0x18, 0x9f, 0xde, 0xdb, 0xff, 0xf7, 0x9e, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0xef, 0x3d, 0x7f, 0xde, 0xdb, 0xff, 0xce, 0x59, 0x84, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x24, 0x82, 
+  0xb8, 0x00, 0x8b, 0x04, 0xb0, 0x00, 0x24, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0x17, 0x07, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 
+  0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x84, 0xd6, 0xba, 0xff, 0xef, 0x7d, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0xde, 0xdb, 0x7f, 0xce, 0x79, 0xff, 0xc5, 0xf8, 0x7f, 0x00, 0x00, 
+  0x00, 0xb8, 0x00, 0x7f, 0x82, 0xb8, 0x00, 0xff, 0x01, 0xb8, 0x00, 0x7f, 0x00, 0x00, 0x74, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x74, 0x82, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x74, 0x00, 
+  0x00, 0x00, 0xbd, 0xd7, 0x7f, 0xd6, 0x9a, 0xff, 0xef, 0x3d, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0xd6, 0x7a, 0x7f, 0xc6, 0x18, 0xff, 0xb5, 0x96, 0x7f, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x23, 0x82, 
+  0xb8, 0x00, 0x8b, 0x04, 0xb8, 0x00, 0x23, 0x00, 0x00, 0x17, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0x17, 0x07, 0x00, 0x00, 0x84, 0x00, 0x00, 0x8b, 0x00, 0x00, 
+  0x84, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x7f, 0xce, 0x59, 0xff, 0xe7, 0x1c, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x7f, 0xb5, 0xb6, 0xff, 0xad, 0x35, 0x7f, 0x90, 0x00, 
+  0x00, 0x00, 0x02, 0xb5, 0x96, 0x7f, 0xce, 0x39, 0xff, 0xe6, 0xfc, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0xbd, 0xb7, 0x7f, 0xad, 0x35, 0xff, 0x9c, 0xd3, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x81, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x58, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x58, 0x81, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x58, 0x00, 
+  0x00, 0x5c, 0x00, 0x00, 0x58, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xad, 0x75, 0x7f, 0xc6, 0x18, 0xff, 0xde, 0xdb, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0xad, 0x55, 0x7f, 0x9c, 0xd3, 0xff, 0x94, 
+  0x72, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x70, 
+  0x00, 0x00, 0x00, 0xad, 0x35, 0x7f, 0xbd, 0xf7, 0xff, 0xd6, 0xba, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0xa4, 0xf4, 0x7f, 0x94, 0x72, 0xff, 0x84, 0x10, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 
+  0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x81, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xb3, 0x81, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x00, 0xb3, 0x00, 
+  0x00, 0xb8, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x7f, 0xbd, 0xd7, 0xff, 0xd6, 0x7a, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x94, 0x92, 0x7f, 0x84, 0x10, 0xff, 0x73, 
+  0xae, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x02, 0xa4, 0xf4, 0x7f, 0xb5, 0x96, 0xff, 0xce, 0x59, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x8c, 0x31, 0x7f, 0x7b, 0xaf, 0xff, 0x6b, 0x4d, 0x7f, 0x81, 0x00, 
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0x00, 0x2b, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x9c, 0xd3, 0x7f, 0xb5, 0x76, 0xff, 0xce, 0x39, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x7b, 0xcf, 0x7f, 0x6b, 0x4d, 
+  0xff, 0x5a, 0xeb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0xff, 0x04, 0x00, 
+  0x00, 0x63, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x7f, 0xad, 0x55, 0xff, 0xc6, 0x18, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0x6b, 0x6d, 0x7f, 0x62, 0xec, 0xff, 0x52, 0x8a, 0x7f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x3f, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x00, 0x3f, 0x07, 0x00, 0x00, 
+  0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x94, 0x72, 0x7f, 0xa5, 0x34, 0xff, 0xbd, 0xf7, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x63, 0x0c, 0x7f, 0x52, 0x8a, 
+  0xff, 0x42, 0x28, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x02, 0x8c, 0x51, 0x7f, 0xa5, 0x14, 0xff, 0xbd, 0xb7, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x52, 0xaa, 0x7f, 0x4a, 0x29, 0xff, 0x39, 0xc7, 0x7f, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x02, 0x8c, 0x31, 0x7f, 
+  0x9c, 0xd3, 0xff, 0xb5, 0x96, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0x4a, 0x29, 0x7f, 0x39, 0xc7, 0xff, 0x29, 0x45, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xf8, 0x81, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x00, 0x4c, 0x07, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 
+  0x00, 0x4c, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x7f, 0x9c, 0xb3, 0xff, 0xb5, 0x76, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x07, 0x39, 0xc7, 0x7f, 0x31, 0x66, 0xff, 0x20, 0xe4, 0x7f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x57, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x7b, 0xcf, 0x7f, 0x94, 0x92, 0xff, 0xad, 0x55, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x31, 0x66, 0x7f, 0x21, 0x04, 
+  0xff, 0x10, 0x82, 0x7f, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x02, 0x73, 0xae, 0x7f, 0x8c, 0x71, 0xff, 0xa5, 0x34, 0x7f, 0xa8, 0x00, 0x00, 0x00, 
+  0x02, 0x21, 0x04, 0x7f, 0x18, 0xa3, 0xff, 0x08, 0x21, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x02, 0x73, 0x8e, 0x7f, 0x8c, 0x51, 0xff, 0xa5, 0x14, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x00, 0x02, 0x6b, 0x2d, 0x04, 0x84, 0x10, 0x0b, 0x9c, 0xd3, 0x04, 0xd4, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x00, 0xb7, 0x34, 0x00, 0x00, 0xb5, 0x5c, 0x00, 0x00, 0xb6, 0x7c, 0x00, 0x00, 0xb5, 0x94, 0x00, 0x00, 0xb6, 0xac, 0x00, 0x00, 0xb6, 0xaf, 0x00, 0x00, 0xb6, 0xaf, 0x00, 0x00, 0xb7, 0xb0, 0x00, 0x00, 0xb5, 0x9c, 0x00, 0x00, 0xb5, 0x83, 0x00, 0x00, 0xb5, 0x60, 0x00, 0x00, 0xb6, 0x38, 0x00, 0x00, 0xbc, 0x17, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb3, 0x37, 0x00, 0x00, 0xb6, 0x83, 0x00, 0x00, 0xb6, 0xcb, 0x00, 0x00, 0xb6, 0xef, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb6, 0xef, 0x00, 0x00, 0xb5, 0xc8, 0x00, 0x00, 0xb5, 0x80, 0x00, 0x00, 0xb5, 0x37, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x14, 0x00, 0x00, 0xb5, 0x70, 0x00, 0x00, 0xb6, 0xd3, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb6, 0xf8, 0x00, 0x00, 0xb6, 0xf8, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb6, 0xd3, 0x00, 0x00, 0xb5, 0x73, 0x00, 0x00, 0xb1, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x13, 0x00, 0x00, 0xb6, 0x83, 0x00, 0x00, 0xb6, 0xeb, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 0xb5, 0xdb, 0x00, 0x00, 0xb6, 0xa7, 0x00, 0x00, 0xb4, 0x7b, 0x00, 0x00, 0xb6, 0x57, 0x00, 0x00, 0xb4, 0x3c, 0x00, 0x00, 0xb6, 0x30, 0x00, 0x00, 0xb7, 0x20, 0x00, 0x00, 0xb5, 0x1f, 0x00, 0x00, 0xb6, 0x2b, 0x00, 0x00, 0xb5, 0x30, 0x00, 0x00, 0xb7, 0x4f, 0x00, 0x00, 0xb5, 0x78, 0x00, 0x00, 0xb7, 0xa8, 0x00, 0x00, 0xb5, 0xdc, 0x00, 0x00, 0xb7, 0xfb, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xef, 0x00, 0x00, 0xb7, 0x7f, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb7, 0x60, 0x00, 0x00, 0xb6, 0xe4, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb6, 0xcb, 0x00, 0x00, 0xb7, 0x73, 0x00, 0x00, 0xb1, 0x27, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0xb9, 0x2c, 0x00, 0x00, 0xb5, 0x78, 0x00, 0x00, 0xb5, 0xd0, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xe8, 0x00, 0x00, 0xb6, 0x67, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x23, 0x00, 0x00, 0xb7, 0xb4, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xf7, 0x00, 0x00, 0xb6, 0xa4, 0x00, 0x00, 0xb6, 0x38, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb5, 0x3f, 0x00, 0x00, 0xb6, 0xa7, 0x00, 0x00, 0xb6, 0xf4, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xb8, 0x00, 0x00, 0xb6, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x50, 0x00, 0x00, 0xb6, 0xe7, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb5, 0xb0, 0x00, 0x00, 0xb8, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xb3, 0x2f, 0x00, 0x00, 0xb5, 0xb0, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xeb, 0x00, 0x00, 0xb4, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb6, 0x7c, 0x00, 0x00, 0xb5, 0xf8, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xe3, 0x00, 0x00, 0xb6, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb3, 0x50, 0x00, 0x00, 0xb6, 0xdf, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb5, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb7, 0x94, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xb0, 0x00, 0x00, 0xb2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x17, 0x00, 0x00, 0xb7, 0xa8, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb7, 0x94, 0x00, 0x00, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x80, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb4, 0x83, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x04, 0x00, 0x00, 0xb6, 0x7c, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x28, 0x00, 0x00, 0xb6, 0xe3, 0x00, 0x00, 0xb5, 0xf8, 0x00, 0x00, 0xb6, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x99, 0x04, 0x00, 0x00, 0x59, 0x14, 0x00, 0x00, 0x13, 0x4f, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x63, 0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 0xb6, 0xe4, 0x00, 0x00, 0xb5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x2f, 0x00, 0x00, 0xb7, 0x58, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x58, 0x80, 0x00, 0x00, 0xb6, 0x83, 0x00, 0x00, 0x91, 0xc0, 0x00, 0x00, 0x8d, 0xe7, 0x00, 0x00, 0xaf, 0xe8, 0x00, 0x00, 0xb6, 0xec, 0x00, 0x00, 0x96, 0xef, 0x00, 0x00, 0xaf, 0xec, 0x00, 0x00, 0xaa, 0xdb, 0x00, 0x00, 0x92, 0xbf, 0x00, 0x00, 0xb2, 0x84, 0x00, 0x00, 0x5d, 0x83, 0x00, 0x00, 0x1a, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x5b, 0x00, 0x00, 0xb5, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x60, 0x00, 0x00, 0xa8, 0x93, 0x00, 0x00, 0xb6, 0xe4, 0x00, 0x00, 0x95, 0xfc, 0x00, 0x00, 0xb5, 0xff, 0x00, 0x00, 0xb5, 0xff, 0x00, 0x00, 0x9b, 0xff, 0x00, 0x00, 0xaf, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xff, 0x00, 0x00, 0x94, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0x92, 0xef, 0x00, 0x00, 0xb7, 0x8f, 0x00, 0x00, 0x8f, 0x30, 0x00, 0x00, 0x03, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x49, 0x4c, 0x00, 0x00, 0xb5, 0xa3, 0x00, 0x00, 0x97, 0xf7, 0x00, 0x00, 0xb2, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x96, 0xff, 0x00, 0x00, 0xb4, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0x9a, 0xf4, 0x00, 0x00, 0xaf, 0xdf, 0x00, 0x00, 0xb5, 0xc8, 0x00, 0x00, 0x8e, 0xdb, 0x00, 0x00, 0xb5, 0xdb, 0x00, 0x00, 0xb6, 0xf0, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb0, 0xf7, 0x00, 0x00, 0x8a, 0xb0, 0x00, 0x00, 0xba, 0x1b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x91, 0x6f, 0x00, 0x00, 0xa2, 0xf3, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x9e, 0xff, 0x00, 0x00, 0xad, 0xff, 0x00, 0x00, 0xb5, 0xf7, 0x00, 0x00, 0x89, 0xcf, 0x00, 0x00, 0xb4, 0x67, 0x00, 0x00, 0xb6, 0x2b, 0x00, 0x00, 0x1e, 0x4c, 0x00, 0x00, 0x26, 0x14, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x06, 0x54, 0x00, 0x00, 0x7f, 0x04, 0x00, 0x00, 0x66, 0x0b, 0x00, 0x00, 0x44, 0x70, 0x00, 0x00, 0xb6, 0x68, 0x00, 0x00, 0xb5, 0xb0, 0x00, 0x00, 0x94, 0xf7, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xff, 0x00, 0x00, 0x97, 0xff, 0x00, 0x00, 0xb6, 0xeb, 0x00, 0x00, 0x8f, 0x7b, 0x00, 0x00, 0x09, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00, 0xb6, 0x98, 0x00, 0x00, 0xa8, 0xfc, 0x00, 0x00, 0xa3, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xaf, 0xf0, 0x00, 0x00, 0x7a, 0xb4, 0x00, 0x00, 0x37, 0x5c, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x64, 0x00, 0x00, 0xb6, 0x84, 0x00, 0x00, 0xb6, 0xef, 0x00, 0x00, 0x9d, 0xff, 0x00, 0x00, 0x9e, 0xff, 0x00, 0x00, 0x94, 0xfc, 0x00, 0x00, 0xae, 0x9f, 0x00, 0x00, 0xaa, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x0b, 0x00, 0x00, 0xb5, 0xbb, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb4, 0xff, 0x00, 0x00, 0xb3, 0xfc, 0x00, 0x00, 0xb7, 0xa7, 0x00, 0x00, 0xb6, 0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x1b, 0x00, 0x00, 0xb6, 0xa4, 0x00, 0x00, 0xb0, 0xfb, 0x00, 0x00, 0xb3, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xb7, 0x00, 0x00, 0xb1, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x47, 0x00, 0x00, 0xb6, 0xf8, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xf0, 0x00, 0x00, 0xb5, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb7, 0x60, 0x00, 0x00, 0xb6, 0xf3, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb7, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x68, 0x00, 0x00, 0xb6, 0xe8, 0x00, 0x00, 0xb8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x43, 0x00, 0x00, 0xb6, 0xe4, 0x00, 0x00, 0xb5, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0xb9, 0x28, 0x00, 0x00, 0xb7, 0x4f, 0x00, 0x00, 0xb5, 0x4f, 0x00, 0x00, 0xb5, 0x4f, 0x00, 0x00, 0xb5, 0x4c, 0x00, 0x00, 0xb4, 0x28, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x17, 0x00, 0x00, 0xb4, 0x74, 0x00, 0x00, 0xb5, 0xd3, 0x00, 0x00, 0xb5, 0xf8, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb5, 0xdb, 0x00, 0x00, 0xb5, 0x80, 0x00, 0x00, 0xb9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb5, 0x6b, 0x00, 0x00, 0xb5, 0xe8, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xec, 0x00, 0x00, 0xb8, 0x6b, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x14, 0x00, 0x00, 0xb7, 0xa7, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb5, 0xc3, 0x00, 0x00, 0xb6, 0x7f, 0x00, 0x00, 0xb7, 0x58, 0x00, 0x00, 0xb6, 0x30, 0x00, 0x00, 0xb2, 0x2b, 0x00, 0x00, 0xb7, 0x50, 0x00, 0x00, 0xb5, 0x74, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xa8, 0x00, 0x00, 0xae, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x00, 0xb6, 0xc4, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xbc, 0x00, 0x00, 0xb7, 0x38, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xb2, 0x34, 0x00, 0x00, 0xb6, 0xbf, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xc3, 0x00, 0x00, 0xb4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x08, 0x00, 0x00, 0xb5, 0xc4, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb5, 0x78, 0x00, 0x00, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0xb7, 0x7c, 0x00, 0x00, 0xb6, 0xf8, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xbc, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x1f, 0x00, 0x00, 0xb6, 0xeb, 0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 0xb5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x5f, 0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 0xb6, 0xe8, 0x00, 0x00, 0xb0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x50, 0x00, 0x00, 0xb4, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x6c, 0x00, 0x00, 0xb4, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x15, 0x15, 0x4d, 0x48, 0x15, 0x15, 0x4d, 0x9c, 0x16, 0x16, 0x4e, 0xb0, 0x15, 0x15, 0x4e, 0xa0, 0x15, 0x15, 0x4d, 0x57, 0x00, 0x00, 0x49, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x40, 0x0c, 0x16, 0x16, 0x4e, 0xb0, 0x15, 0x15, 0x4d, 0xff, 0x16, 0x16, 0x4e, 0xff, 0x16, 0x16, 0x4e, 0xff, 0x16, 0x16, 0x4e, 0xff, 0x16, 0x16, 0x4d, 0xff, 0x15, 0x15, 0x4e, 0xcb, 0x14, 0x14, 0x4e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x4e, 0xa4, 0x16, 0x16, 0x4e, 0xff, 0x14, 0x14, 0x4a, 0xff, 0x0c, 0x0c, 0x3b, 0xff, 0x09, 0x09, 0x35, 0xff, 0x0b, 0x0b, 0x38, 0xff, 0x13, 0x13, 0x48, 0xff, 0x16, 0x16, 0x4e, 0xff, 0x15, 0x15, 0x4d, 0xd0, 0x00, 0x00, 0x49, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x4e, 0x3f, 0x15, 0x15, 0x4d, 0xff, 0x14, 0x14, 0x4a, 0xff, 0x07, 0x07, 0x30, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x05, 0x05, 0x2d, 0xff, 0x12, 0x12, 0x46, 0xff, 0x16, 0x16, 0x4d, 0xff, 0x14, 0x14, 0x4c, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xe9, 0xe9, 0xe9, 0x77, 0x5b, 0x5b, 0x7f, 0xd7, 0x16, 0x16, 0x4e, 0xff, 0x0c, 0x0c, 0x3a, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x05, 0x05, 0x2c, 0xff, 0x09, 0x09, 0x34, 0xff, 0x16, 0x16, 0x4e, 0xff, 0x1f, 0x1f, 0x4d, 0xdc, 0x6c, 0x6a, 0x6a, 0x77, 0x99, 0x99, 0x99, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4f, 0xf4, 0xf4, 0xf4, 0xe8, 0xe1, 0xe1, 0xe1, 0xff, 0x79, 0x79, 0x93, 0xff, 0x4c, 0x4c, 0x72, 0xff, 0x3e, 0x3e, 0x5a, 0xff, 0x35, 0x35, 0x4e, 0xff, 0x2e, 0x2e, 0x48, 0xff, 0x28, 0x28, 0x42, 0xff, 0x22, 0x22, 0x3c, 0xff, 0x1d, 0x1d, 0x37, 0xff, 0x22, 0x22, 0x3b, 0xff, 0x29, 0x29, 0x4e, 0xff, 0x2c, 0x2c, 0x4c, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x9a, 0x9a, 0x9b, 0xe8, 0xb2, 0xb2, 0xb2, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5f, 0xfa, 0xfa, 0xf9, 0xfc, 0xe8, 0xe8, 0xe8, 0xff, 0xd6, 0xd6, 0xd6, 0xf3, 0xc6, 0xc6, 0xc6, 0x8f, 0xb3, 0xb3, 0xb3, 0x54, 0xa2, 0xa2, 0xa2, 0x37, 0x90, 0x90, 0x90, 0x2f, 0x7d, 0x7d, 0x7d, 0x2c, 0x6c, 0x6c, 0x6c, 0x2c, 0x55, 0x55, 0x55, 0x2c, 0x4f, 0x4f, 0x4f, 0x2c, 0x6a, 0x6a, 0x6a, 0x34, 0x6e, 0x6e, 0x6e, 0x50, 0x61, 0x61, 0x61, 0x88, 0x7a, 0x7a, 0x7a, 0xf0, 0x96, 0x96, 0x96, 0xff, 0xb4, 0xb4, 0xb4, 0xfc, 0xcb, 0xcb, 0xcb, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x2c, 0xfe, 0xfe, 0xfe, 0xf7, 0xee, 0xee, 0xee, 0xff, 0xdf, 0xdf, 0xdf, 0xbf, 0xd4, 0xd4, 0xd4, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x18, 0x95, 0x95, 0x95, 0xbf, 0xb0, 0xaf, 0xb0, 0xff, 0xcd, 0xcd, 0xcd, 0xf7, 0xe2, 0xe2, 0xe2, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbb, 0xf5, 0xf4, 0xf5, 0xff, 0xe4, 0xe4, 0xe4, 0xd0, 0xc6, 0xc6, 0xc6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0x9d, 0x0c, 0xae, 0xae, 0xae, 0xcf, 0xc9, 0xc9, 0xc9, 0xff, 0xe4, 0xe4, 0xe4, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x23, 0xfa, 0xfa, 0xfa, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe0, 0xe0, 0xe0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x33, 0xc5, 0xc5, 0xc5, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xf0, 0xf0, 0xf0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfa, 0xfd, 0x68, 0xef, 0xef, 0xef, 0xff, 0xde, 0xde, 0xde, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0xd3, 0xdd, 0xdd, 0xdd, 0xff, 0xf3, 0xf3, 0xf3, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xf1, 0xf1, 0x7f, 0xe3, 0xe3, 0xe3, 0xff, 0xd5, 0xd5, 0xd5, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x9f, 0xd8, 0xd8, 0xd8, 0xff, 0xef, 0xef, 0xef, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe5, 0xe5, 0x7f, 0xd7, 0xd7, 0xd7, 0xff, 0xc9, 0xc9, 0xc9, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x24, 0x00, 0x00, 0xb6, 0x8b, 0x00, 0x00, 0xb6, 0x8b, 0x00, 0x00, 0xb6, 0x8b, 0x00, 0x00, 0xb1, 0x24, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x84, 0xd4, 0xd4, 0xd4, 0xff, 0xeb, 0xeb, 0xeb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xd9, 0xd9, 0x7f, 0xcb, 0xcb, 0xcb, 0xff, 0xbd, 0xbd, 0xbd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x7f, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb7, 0x7f, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x7f, 0xcf, 0xcf, 0xcf, 0xff, 0xe5, 0xe5, 0xe5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x7f, 0xbf, 0xbf, 0xbf, 0xff, 0xb1, 0xb1, 0xb1, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x23, 0x00, 0x00, 0xb5, 0x8b, 0x00, 0x00, 0xb5, 0x8b, 0x00, 0x00, 0xb5, 0x8b, 0x00, 0x00, 0xb6, 0x23, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x7f, 0xca, 0xca, 0xca, 0xff, 0xe1, 0xe1, 0xe1, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x7f, 0xb2, 0xb3, 0xb3, 0xff, 0xa5, 0xa5, 0xa5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xaf, 0xaf, 0x7f, 0xc5, 0xc5, 0xc5, 0xff, 0xdd, 0xdd, 0xdd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x7f, 0xa6, 0xa6, 0xa6, 0xff, 0x99, 0x99, 0x99, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xab, 0xab, 0xab, 0x7f, 0xc0, 0xc1, 0xc0, 0xff, 0xd7, 0xd7, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xa9, 0xa9, 0x7f, 0x9a, 0x9a, 0x9a, 0xff, 0x8d, 0x8d, 0x8d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0xa5, 0x7f, 0xbc, 0xbc, 0xbc, 0xff, 0xd3, 0xd3, 0xd3, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0x9d, 0x7f, 0x8e, 0x8e, 0x8e, 0xff, 0x81, 0x81, 0x81, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa1, 0xa1, 0x7f, 0xb7, 0xb7, 0xb7, 0xff, 0xcd, 0xcd, 0xcf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x7f, 0x82, 0x82, 0x82, 0xff, 0x74, 0x74, 0x74, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9d, 0x9d, 0x7f, 0xb2, 0xb2, 0xb2, 0xff, 0xc9, 0xc9, 0xc9, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x85, 0x85, 0x7f, 0x76, 0x76, 0x76, 0xff, 0x68, 0x68, 0x68, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x97, 0x97, 0x7f, 0xad, 0xad, 0xad, 0xff, 0xc5, 0xc5, 0xc5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x7f, 0x6a, 0x6a, 0x6a, 0xff, 0x5c, 0x5c, 0x5c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x93, 0x93, 0x93, 0x7f, 0xa8, 0xa9, 0xa9, 0xff, 0xbf, 0xbf, 0xbf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x6c, 0x7f, 0x5e, 0x5e, 0x5e, 0xff, 0x50, 0x50, 0x50, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0x8d, 0x7f, 0xa4, 0xa4, 0xa4, 0xff, 0xbb, 0xbb, 0xbb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x7f, 0x52, 0x52, 0x52, 0xff, 0x44, 0x44, 0x44, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x7f, 0x9f, 0x9f, 0x9f, 0xff, 0xb7, 0xb5, 0xb5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x54, 0x54, 0x7f, 0x46, 0x46, 0x46, 0xff, 0x38, 0x38, 0x38, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x85, 0x85, 0x7f, 0x9a, 0x9a, 0x9a, 0xff, 0xb1, 0xb1, 0xb1, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x46, 0x46, 0x7f, 0x3a, 0x39, 0x39, 0xff, 0x2c, 0x2a, 0x2c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7f, 0x95, 0x95, 0x95, 0xff, 0xad, 0xad, 0xad, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x3a, 0x7f, 0x2d, 0x2d, 0x2d, 0xff, 0x1e, 0x1e, 0x20, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x7f, 0x91, 0x90, 0x90, 0xff, 0xa7, 0xa7, 0xa7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x2e, 0x7f, 0x21, 0x21, 0x21, 0xff, 0x12, 0x12, 0x14, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x74, 0x7f, 0x8c, 0x8c, 0x8c, 0xff, 0xa3, 0xa3, 0xa3, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x7f, 0x15, 0x15, 0x15, 0xff, 0x06, 0x06, 0x06, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x7f, 0x87, 0x87, 0x87, 0xff, 0x9f, 0x9f, 0x9f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x04, 0x7f, 0x7f, 0x7f, 0x0b, 0x99, 0x99, 0x99, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x00, 0xb7, 0x34, 0x00, 0x00, 0xb5, 0x5c, 0x00, 0x00, 0xb6, 0x7c, 0x00, 0x00, 
+  0xb5, 0x94, 0x00, 0x00, 0xb6, 0xac, 0x81, 0x00, 0x00, 0xb6, 0xaf, 0x06, 0x00, 0x00, 0xb7, 0xb0, 0x00, 0x00, 0xb5, 0x9c, 0x00, 0x00, 0xb5, 0x83, 0x00, 0x00, 0xb5, 0x60, 0x00, 0x00, 0xb6, 0x38, 
+  0x00, 0x00, 0xbc, 0x17, 0x00, 0x00, 0xbf, 0x04, 0xac, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb3, 0x37, 0x00, 0x00, 0xb6, 0x83, 0x00, 0x00, 0xb6, 0xcb, 0x00, 0x00, 
+  0xb6, 0xef, 0x00, 0x00, 0xb6, 0xfc, 0x89, 0x00, 0x00, 0xb6, 0xff, 0x05, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb6, 0xef, 0x00, 0x00, 0xb5, 0xc8, 0x00, 0x00, 0xb5, 0x80, 0x00, 0x00, 0xb5, 0x37, 
+  0x00, 0x00, 0xaa, 0x07, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xb2, 0x14, 0x00, 0x00, 0xb5, 0x70, 0x00, 0x00, 0xb6, 0xd3, 0x00, 0x00, 0xb6, 0xfc, 0x85, 0x00, 0x00, 0xb6, 0xff, 0x01, 
+  0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb6, 0xfb, 0x81, 0x00, 0x00, 0xb6, 0xf8, 0x00, 0x00, 0x00, 0xb6, 0xfb, 0x86, 0x00, 0x00, 0xb6, 0xff, 0x03, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb6, 0xd3, 
+  0x00, 0x00, 0xb5, 0x73, 0x00, 0x00, 0xb1, 0x0c, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xaa, 0x13, 0x00, 0x00, 0xb6, 0x83, 0x00, 0x00, 0xb6, 0xeb, 0x83, 0x00, 0x00, 0xb6, 0xff, 0x0f, 
+  0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 0xb5, 0xdb, 0x00, 0x00, 0xb6, 0xa7, 0x00, 0x00, 0xb4, 0x7b, 0x00, 0x00, 0xb6, 0x57, 0x00, 0x00, 0xb4, 0x3c, 0x00, 0x00, 0xb6, 0x30, 0x00, 0x00, 0xb7, 0x20, 
+  0x00, 0x00, 0xb5, 0x1f, 0x00, 0x00, 0xb6, 0x2b, 0x00, 0x00, 0xb5, 0x30, 0x00, 0x00, 0xb7, 0x4f, 0x00, 0x00, 0xb5, 0x78, 0x00, 0x00, 0xb7, 0xa8, 0x00, 0x00, 0xb5, 0xdc, 0x00, 0x00, 0xb7, 0xfb, 
+  0x83, 0x00, 0x00, 0xb6, 0xff, 0x02, 0x00, 0x00, 0xb6, 0xef, 0x00, 0x00, 0xb7, 0x7f, 0x00, 0x00, 0xb8, 0x13, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb7, 0x60, 
+  0x00, 0x00, 0xb6, 0xe4, 0x82, 0x00, 0x00, 0xb6, 0xff, 0x04, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb6, 0xcb, 0x00, 0x00, 0xb7, 0x73, 0x00, 0x00, 0xb1, 0x27, 0x00, 0x00, 0xaa, 0x07, 0x8b, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0xb9, 0x2c, 0x00, 0x00, 0xb5, 0x78, 0x00, 0x00, 0xb5, 0xd0, 0x83, 0x00, 0x00, 0xb6, 0xff, 0x02, 0x00, 0x00, 0xb5, 0xe8, 0x00, 0x00, 
+  0xb6, 0x67, 0x00, 0x00, 0xbf, 0x04, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb4, 0x23, 0x00, 0x00, 0xb7, 0xb4, 0x82, 0x00, 0x00, 0xb6, 0xff, 0x03, 0x00, 0x00, 0xb5, 0xf7, 0x00, 0x00, 
+  0xb6, 0xa4, 0x00, 0x00, 0xb6, 0x38, 0x00, 0x00, 0x7f, 0x03, 0x91, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb5, 0x3f, 0x00, 0x00, 0xb6, 0xa7, 0x00, 0x00, 0xb6, 0xf4, 
+  0x82, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 0xb6, 0xb8, 0x00, 0x00, 0xb6, 0x23, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb7, 0x50, 0x00, 0x00, 0xb6, 0xe7, 0x81, 0x00, 0x00, 0xb6, 
+  0xff, 0x02, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb5, 0xb0, 0x00, 0x00, 0xb8, 0x2f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xb3, 0x2f, 0x00, 0x00, 0xb5, 0xb0, 0x00, 0x00, 0xb6, 0xfb, 
+  0x81, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 0xb6, 0xeb, 0x00, 0x00, 0xb4, 0x53, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb6, 0x7c, 0x00, 0x00, 0xb5, 0xf8, 
+  0x81, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 0xb6, 0xe3, 0x00, 0x00, 0xb6, 0x4c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb3, 0x50, 0x00, 0x00, 0xb6, 0xdf, 
+  0x81, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb5, 0x7c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb7, 0x94, 0x82, 0x00, 0x00, 0xb6, 
+  0xff, 0x01, 0x00, 0x00, 0xb6, 0xb0, 0x00, 0x00, 0xb2, 0x14, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbc, 0x17, 0x00, 0x00, 0xb7, 0xa8, 0x82, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 
+  0xb7, 0x94, 0x00, 0x00, 0x7f, 0x04, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x80, 0x81, 0x00, 0x00, 0xb6, 0xff, 0x02, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb4, 0x83, 0x00, 0x00, 
+  0xbf, 0x04, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x99, 0x04, 0x00, 0x00, 0xb6, 0x7c, 0x00, 0x00, 0xb6, 0xfb, 0x81, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x00, 0xb6, 0x83, 0x93, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xb4, 0x28, 0x00, 0x00, 0xb6, 0xe3, 0x00, 0x00, 0xb5, 0xf8, 0x00, 0x00, 0xb6, 0x6c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x04, 0x40, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x99, 0x04, 0x00, 0x00, 0x59, 0x14, 0x00, 0x00, 0x13, 0x4f, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0b, 0x00, 0x00, 0x00, 0x43, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x3b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0xb6, 0x63, 0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 0xb6, 0xe4, 0x00, 0x00, 0xb5, 0x27, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb1, 0x2f, 0x00, 0x00, 0xb7, 0x58, 0x85, 0x00, 0x00, 0x00, 
+  0x00, 0x13, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 
+  0x58, 0x80, 0x00, 0x00, 0xb6, 0x83, 0x00, 0x00, 0x91, 0xc0, 0x00, 0x00, 0x8d, 0xe7, 0x00, 0x00, 0xaf, 0xe8, 0x00, 0x00, 0xb6, 0xec, 0x00, 0x00, 0x96, 0xef, 0x00, 0x00, 0xaf, 0xec, 0x00, 0x00, 
+  0xaa, 0xdb, 0x00, 0x00, 0x92, 0xbf, 0x00, 0x00, 0xb2, 0x84, 0x00, 0x00, 0x5d, 0x83, 0x00, 0x00, 0x1a, 0x64, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x23, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb5, 0x5b, 0x00, 0x00, 0xb5, 0x2c, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x24, 
+  0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x60, 0x00, 0x00, 0xa8, 0x93, 0x00, 0x00, 0xb6, 0xe4, 0x00, 0x00, 0x95, 0xfc, 0x81, 0x00, 0x00, 0xb5, 0xff, 0x0f, 0x00, 0x00, 
+  0x9b, 0xff, 0x00, 0x00, 0xaf, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb5, 0xff, 0x00, 0x00, 0x94, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 
+  0xb5, 0xfc, 0x00, 0x00, 0x92, 0xef, 0x00, 0x00, 0xb7, 0x8f, 0x00, 0x00, 0x8f, 0x30, 0x00, 0x00, 0x03, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x40, 0xa6, 0x00, 
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x49, 0x4c, 0x00, 0x00, 0xb5, 0xa3, 0x00, 0x00, 0x97, 0xf7, 0x00, 0x00, 0xb2, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x96, 0xff, 
+  0x00, 0x00, 0xb4, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0x9a, 0xf4, 0x00, 0x00, 0xaf, 0xdf, 0x00, 0x00, 0xb5, 0xc8, 0x00, 0x00, 0x8e, 0xdb, 0x00, 0x00, 0xb5, 0xdb, 0x00, 0x00, 0xb6, 0xf0, 
+  0x00, 0x00, 0x95, 0xff, 0x81, 0x00, 0x00, 0xb6, 0xff, 0x06, 0x00, 0x00, 0x95, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb0, 0xf7, 0x00, 0x00, 0x8a, 0xb0, 0x00, 0x00, 0xba, 0x1b, 0x00, 0x00, 
+  0x00, 0x13, 0x00, 0x00, 0x00, 0x44, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x91, 0x6f, 0x00, 0x00, 0xa2, 0xf3, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0x9e, 0xff, 
+  0x00, 0x00, 0xad, 0xff, 0x00, 0x00, 0xb5, 0xf7, 0x00, 0x00, 0x89, 0xcf, 0x00, 0x00, 0xb4, 0x67, 0x00, 0x00, 0xb6, 0x2b, 0x00, 0x00, 0x1e, 0x4c, 0x00, 0x00, 0x26, 0x14, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x06, 0x54, 0x00, 0x00, 0x7f, 0x04, 0x00, 0x00, 0x66, 0x0b, 0x00, 0x00, 0x44, 0x70, 0x00, 0x00, 0xb6, 0x68, 0x00, 0x00, 0xb5, 0xb0, 0x00, 0x00, 0x94, 0xf7, 0x00, 0x00, 0xb6, 0xff, 
+  0x00, 0x00, 0xb5, 0xff, 0x00, 0x00, 0x97, 0xff, 0x00, 0x00, 0xb6, 0xeb, 0x00, 0x00, 0x8f, 0x7b, 0x00, 0x00, 0x09, 0x38, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00, 
+  0xb6, 0x98, 0x00, 0x00, 0xa8, 0xfc, 0x00, 0x00, 0xa3, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xaf, 0xf0, 0x00, 0x00, 0x7a, 0xb4, 0x00, 0x00, 0x37, 0x5c, 0x00, 0x00, 0x04, 0x40, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x24, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x2b, 0x64, 0x00, 0x00, 0xb6, 0x84, 0x00, 0x00, 0xb6, 0xef, 0x00, 0x00, 0x9d, 0xff, 0x00, 0x00, 0x9e, 0xff, 0x00, 0x00, 0x94, 0xfc, 0x00, 0x00, 
+  0xae, 0x9f, 0x00, 0x00, 0xaa, 0x08, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xb9, 0x0b, 0x00, 0x00, 0xb5, 0xbb, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb4, 0xff, 0x00, 0x00, 0xb3, 0xfc, 
+  0x00, 0x00, 0xb7, 0xa7, 0x00, 0x00, 0xb6, 0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x82, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x1b, 0x00, 0x00, 0xb6, 0xa4, 0x00, 0x00, 
+  0xb0, 0xfb, 0x00, 0x00, 0xb3, 0xff, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xb7, 0x00, 0x00, 0xb1, 0x0c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb7, 0x47, 0x00, 0x00, 0xb6, 0xf8, 
+  0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xf0, 0x00, 0x00, 0xb5, 0x57, 0x92, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb7, 0x60, 0x00, 0x00, 0xb6, 0xf3, 0x00, 0x00, 
+  0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb7, 0x43, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xb6, 0x68, 0x00, 0x00, 0xb6, 0xe8, 0x00, 0x00, 0xb8, 0x37, 0x95, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0xb7, 0x43, 0x00, 0x00, 0xb6, 0xe4, 0x00, 0x00, 0xb5, 0x68, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x18, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xb5, 0x18, 0xae, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0xb9, 0x28, 0x00, 0x00, 0xb7, 0x4f, 0x81, 0x00, 0x00, 0xb5, 0x4f, 0x02, 0x00, 0x00, 0xb5, 0x4c, 0x00, 0x00, 
+  0xb4, 0x28, 0x00, 0x00, 0xaa, 0x07, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xb9, 0x17, 0x00, 0x00, 0xb4, 0x74, 0x00, 0x00, 0xb5, 0xd3, 0x00, 0x00, 0xb5, 0xf8, 0x83, 0x00, 0x00, 0xb6, 
+  0xff, 0x03, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb5, 0xdb, 0x00, 0x00, 0xb5, 0x80, 0x00, 0x00, 0xb9, 0x17, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xb5, 0x6b, 
+  0x00, 0x00, 0xb5, 0xe8, 0x89, 0x00, 0x00, 0xb6, 0xff, 0x02, 0x00, 0x00, 0xb6, 0xec, 0x00, 0x00, 0xb8, 0x6b, 0x00, 0x00, 0xaa, 0x03, 0xae, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xb6, 0x14, 
+  0x00, 0x00, 0xb7, 0xa7, 0x00, 0x00, 0xb5, 0xfc, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfc, 0x00, 0x00, 0xb5, 0xc3, 0x00, 0x00, 0xb6, 0x7f, 0x00, 0x00, 0xb7, 0x58, 0x00, 0x00, 0xb6, 0x30, 
+  0x00, 0x00, 0xb2, 0x2b, 0x00, 0x00, 0xb7, 0x50, 0x00, 0x00, 0xb5, 0x74, 0x00, 0x00, 0xb6, 0xc0, 0x00, 0x00, 0xb5, 0xfc, 0x81, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 0xb5, 0xa8, 0x00, 0x00, 
+  0xae, 0x13, 0xac, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x00, 0xb6, 0xc4, 0x81, 0x00, 0x00, 0xb6, 0xff, 0x02, 0x00, 0x00, 0xb6, 0xbc, 0x00, 0x00, 0xb7, 0x38, 0x00, 0x00, 
+  0xaa, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb2, 0x34, 0x00, 0x00, 0xb6, 0xbf, 0x81, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 0xb5, 0xc3, 0x00, 0x00, 0xb4, 0x10, 0xaa, 0x00, 
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x9f, 0x08, 0x00, 0x00, 0xb5, 0xc4, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xfb, 0x00, 0x00, 0xb5, 0x78, 0x00, 0x00, 0x7f, 0x04, 0x89, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0x00, 0x00, 0xaa, 0x07, 0x00, 0x00, 0xb7, 0x7c, 0x00, 0x00, 0xb6, 0xf8, 0x00, 0x00, 0xb6, 0xff, 0x00, 0x00, 0xb6, 0xbc, 0x00, 0x00, 0xcc, 0x04, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0xb2, 0x1f, 0x00, 0x00, 0xb6, 0xeb, 0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 0xb5, 0x5b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xb6, 0x5f, 0x00, 0x00, 0xb6, 0xf7, 0x00, 0x00, 
+  0xb6, 0xe8, 0x00, 0x00, 0xb0, 0x1c, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb3, 0x50, 0x00, 0x00, 0xb4, 0x6b, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xb6, 0x6c, 0x00, 0x00, 
+  0xb4, 0x4b, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x15, 0x15, 0x4d, 0x48, 0x15, 0x15, 0x4d, 0x9c, 0x16, 0x16, 
+  0x4e, 0xb0, 0x15, 0x15, 0x4e, 0xa0, 0x15, 0x15, 0x4d, 0x57, 0x00, 0x00, 0x49, 0x07, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x15, 0x40, 0x0c, 0x16, 0x16, 0x4e, 0xb0, 0x15, 0x15, 0x4d, 0xff, 
+  0x82, 0x16, 0x16, 0x4e, 0xff, 0x02, 0x16, 0x16, 0x4d, 0xff, 0x15, 0x15, 0x4e, 0xcb, 0x14, 0x14, 0x4e, 0x1b, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x09, 0x16, 0x16, 0x4e, 0xa4, 0x16, 0x16, 0x4e, 0xff, 
+  0x14, 0x14, 0x4a, 0xff, 0x0c, 0x0c, 0x3b, 0xff, 0x09, 0x09, 0x35, 0xff, 0x0b, 0x0b, 0x38, 0xff, 0x13, 0x13, 0x48, 0xff, 0x16, 0x16, 0x4e, 0xff, 0x15, 0x15, 0x4d, 0xd0, 0x00, 0x00, 0x49, 0x07, 
+  0xb4, 0x00, 0x00, 0x00, 0x00, 0x03, 0x15, 0x15, 0x4e, 0x3f, 0x15, 0x15, 0x4d, 0xff, 0x14, 0x14, 0x4a, 0xff, 0x07, 0x07, 0x30, 0xff, 0x82, 0x05, 0x05, 0x2c, 0xff, 0x03, 0x05, 0x05, 0x2d, 0xff, 
+  0x12, 0x12, 0x46, 0xff, 0x16, 0x16, 0x4d, 0xff, 0x14, 0x14, 0x4c, 0x68, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x0f, 0xe9, 0xe9, 0xe9, 0x77, 0x5b, 0x5b, 0x7f, 0xd7, 0x16, 0x16, 
+  0x4e, 0xff, 0x0c, 0x0c, 0x3a, 0xff, 0x84, 0x05, 0x05, 0x2c, 0xff, 0x04, 0x09, 0x09, 0x34, 0xff, 0x16, 0x16, 0x4e, 0xff, 0x1f, 0x1f, 0x4d, 0xdc, 0x6c, 0x6a, 0x6a, 0x77, 0x99, 0x99, 0x99, 0x0f, 
+  0xaf, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0x4f, 0xf4, 0xf4, 0xf4, 0xe8, 0xe1, 0xe1, 0xe1, 0xff, 0x79, 0x79, 0x93, 0xff, 0x4c, 0x4c, 0x72, 0xff, 0x3e, 0x3e, 0x5a, 0xff, 0x35, 0x35, 
+  0x4e, 0xff, 0x2e, 0x2e, 0x48, 0xff, 0x28, 0x28, 0x42, 0xff, 0x22, 0x22, 0x3c, 0xff, 0x1d, 0x1d, 0x37, 0xff, 0x22, 0x22, 0x3b, 0xff, 0x29, 0x29, 0x4e, 0xff, 0x2c, 0x2c, 0x4c, 0xff, 0x7a, 0x7a, 
+  0x7a, 0xff, 0x9a, 0x9a, 0x9b, 0xe8, 0xb2, 0xb2, 0xb2, 0x4f, 0xad, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x5f, 0xfa, 0xfa, 0xf9, 0xfc, 0xe8, 0xe8, 0xe8, 0xff, 0xd6, 0xd6, 0xd6, 0xf3, 
+  0xc6, 0xc6, 0xc6, 0x8f, 0xb3, 0xb3, 0xb3, 0x54, 0xa2, 0xa2, 0xa2, 0x37, 0x90, 0x90, 0x90, 0x2f, 0x7d, 0x7d, 0x7d, 0x2c, 0x6c, 0x6c, 0x6c, 0x2c, 0x55, 0x55, 0x55, 0x2c, 0x4f, 0x4f, 0x4f, 0x2c, 
+  0x6a, 0x6a, 0x6a, 0x34, 0x6e, 0x6e, 0x6e, 0x50, 0x61, 0x61, 0x61, 0x88, 0x7a, 0x7a, 0x7a, 0xf0, 0x96, 0x96, 0x96, 0xff, 0xb4, 0xb4, 0xb4, 0xfc, 0xcb, 0xcb, 0xcb, 0x5f, 0xab, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xff, 0xff, 0xff, 0x2c, 0xfe, 0xfe, 0xfe, 0xf7, 0xee, 0xee, 0xee, 0xff, 0xdf, 0xdf, 0xdf, 0xbf, 0xd4, 0xd4, 0xd4, 0x18, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7f, 0x7f, 0x7f, 0x18, 
+  0x95, 0x95, 0x95, 0xbf, 0xb0, 0xaf, 0xb0, 0xff, 0xcd, 0xcd, 0xcd, 0xf7, 0xe2, 0xe2, 0xe2, 0x2c, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xbb, 0xf5, 0xf4, 0xf5, 0xff, 0xe4, 0xe4, 
+  0xe4, 0xd0, 0xc6, 0xc6, 0xc6, 0x08, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9d, 0x9d, 0x9d, 0x0c, 0xae, 0xae, 0xae, 0xcf, 0xc9, 0xc9, 0xc9, 0xff, 0xe4, 0xe4, 0xe4, 0xbb, 0xa9, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0xff, 0xff, 0xff, 0x23, 0xfa, 0xfa, 0xfa, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe0, 0xe0, 0xe0, 0x38, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb2, 0xb2, 0xb2, 0x33, 0xc5, 0xc5, 0xc5, 0xff, 
+  0xe2, 0xe2, 0xe2, 0xff, 0xf0, 0xf0, 0xf0, 0x23, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xfa, 0xfd, 0x68, 0xef, 0xef, 0xef, 0xff, 0xde, 0xde, 0xde, 0xd3, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xc2, 0xc2, 0xc2, 0xd3, 0xdd, 0xdd, 0xdd, 0xff, 0xf3, 0xf3, 0xf3, 0x68, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xf1, 0xf1, 0x7f, 0xe3, 0xe3, 0xe3, 0xff, 0xd5, 0xd5, 0xd5, 0x9f, 0x90, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0xc0, 0xc0, 0xc0, 0x9f, 0xd8, 0xd8, 0xd8, 0xff, 0xef, 0xef, 0xef, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xe5, 0xe5, 0x7f, 0xd7, 0xd7, 0xd7, 0xff, 0xc9, 0xc9, 
+  0xc9, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x24, 0x82, 0x00, 0x00, 0xb6, 0x8b, 0x04, 0x00, 0x00, 0xb1, 0x24, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 
+  0x00, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0x00, 0x17, 0x07, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 
+  0xbe, 0x84, 0xd4, 0xd4, 0xd4, 0xff, 0xeb, 0xeb, 0xeb, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd9, 0xd9, 0xd9, 0x7f, 0xcb, 0xcb, 0xcb, 0xff, 0xbd, 0xbd, 0xbd, 0x7f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xb7, 0x7f, 0x82, 0x00, 0x00, 0xb6, 0xff, 0x01, 0x00, 0x00, 0xb7, 0x7f, 0x00, 0x00, 0x00, 0x74, 0x82, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0x74, 0x82, 0x00, 0x00, 0x00, 
+  0xff, 0x04, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x7f, 0xcf, 0xcf, 0xcf, 0xff, 0xe5, 0xe5, 0xe5, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcd, 0xcd, 0xcd, 0x7f, 
+  0xbf, 0xbf, 0xbf, 0xff, 0xb1, 0xb1, 0xb1, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x23, 0x82, 0x00, 0x00, 0xb5, 0x8b, 0x04, 0x00, 0x00, 0xb6, 0x23, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 
+  0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0x00, 0x17, 0x07, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x17, 
+  0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x7f, 0xca, 0xca, 0xca, 0xff, 0xe1, 0xe1, 0xe1, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc1, 0xc1, 0xc1, 0x7f, 0xb2, 0xb3, 0xb3, 0xff, 0xa5, 0xa5, 
+  0xa5, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaf, 0xaf, 0xaf, 0x7f, 0xc5, 0xc5, 0xc5, 0xff, 0xdd, 0xdd, 0xdd, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xb5, 0xb5, 0xb5, 0x7f, 0xa6, 0xa6, 
+  0xa6, 0xff, 0x99, 0x99, 0x99, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x58, 0x81, 0x00, 0x00, 0x00, 0x08, 0x02, 
+  0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x58, 0x81, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xab, 0xab, 0xab, 0x7f, 0xc0, 0xc1, 0xc0, 0xff, 0xd7, 0xd7, 0xd7, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa9, 0xa9, 0xa9, 0x7f, 0x9a, 0x9a, 0x9a, 0xff, 
+  0x8d, 0x8d, 0x8d, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0x70, 0x82, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0x70, 
+  0x82, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0xa5, 0x7f, 0xbc, 0xbc, 0xbc, 0xff, 0xd3, 0xd3, 0xd3, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x07, 
+  0x9d, 0x9d, 0x9d, 0x7f, 0x8e, 0x8e, 0x8e, 0xff, 0x81, 0x81, 0x81, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb3, 
+  0x81, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb3, 0x81, 0x00, 0x00, 0x00, 0x2b, 0x07, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb8, 
+  0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa1, 0xa1, 0x7f, 0xb7, 0xb7, 0xb7, 0xff, 0xcd, 0xcd, 0xcf, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x91, 0x91, 
+  0x91, 0x7f, 0x82, 0x82, 0x82, 0xff, 0x74, 0x74, 0x74, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9d, 0x9d, 0x9d, 0x7f, 0xb2, 0xb2, 0xb2, 0xff, 0xc9, 0xc9, 0xc9, 0x7f, 0xa8, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x85, 0x85, 0x85, 0x7f, 0x76, 0x76, 0x76, 0xff, 0x68, 0x68, 0x68, 0x7f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2b, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2f, 
+  0x00, 0x00, 0x00, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x97, 0x97, 0x97, 0x7f, 0xad, 0xad, 0xad, 0xff, 0xc5, 0xc5, 0xc5, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x78, 0x78, 0x78, 0x7f, 
+  0x6a, 0x6a, 0x6a, 0xff, 0x5c, 0x5c, 0x5c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0x00, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x63, 0x82, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x93, 0x93, 0x93, 0x7f, 0xa8, 0xa9, 0xa9, 0xff, 0xbf, 0xbf, 0xbf, 0x7f, 0xa8, 0x00, 
+  0x00, 0x00, 0x00, 0x07, 0x6c, 0x6c, 0x6c, 0x7f, 0x5e, 0x5e, 0x5e, 0xff, 0x50, 0x50, 0x50, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe7, 
+  0x00, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x00, 0x00, 0x3f, 0x07, 0x00, 0x00, 0x00, 0xe0, 
+  0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x8d, 0x8d, 0x7f, 0xa4, 0xa4, 0xa4, 0xff, 0xbb, 0xbb, 0xbb, 0x7f, 0xa8, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x60, 0x60, 0x60, 0x7f, 0x52, 0x52, 0x52, 0xff, 0x44, 0x44, 0x44, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0x89, 0x89, 0x89, 0x7f, 0x9f, 0x9f, 0x9f, 0xff, 0xb7, 0xb5, 0xb5, 0x7f, 
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x54, 0x54, 0x54, 0x7f, 0x46, 0x46, 0x46, 0xff, 0x38, 0x38, 0x38, 0x7f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x85, 0x85, 0x85, 0x7f, 0x9a, 0x9a, 0x9a, 0xff, 0xb1, 0xb1, 
+  0xb1, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x07, 0x48, 0x46, 0x46, 0x7f, 0x3a, 0x39, 0x39, 0xff, 0x2c, 0x2a, 0x2c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xf8, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x00, 0x00, 0x4c, 0x07, 
+  0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x7f, 0x95, 0x95, 0x95, 0xff, 0xad, 0xad, 0xad, 0x7f, 
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3a, 0x3a, 0x3a, 0x7f, 0x2d, 0x2d, 0x2d, 0xff, 0x1e, 0x1e, 0x20, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00, 
+  0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0x7f, 0x91, 0x90, 0x90, 0xff, 0xa7, 0xa7, 0xa7, 0x7f, 0xa8, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0x2e, 0x2e, 0x2e, 0x7f, 0x21, 0x21, 0x21, 0xff, 0x12, 0x12, 0x14, 0x7f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 
+  0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+  0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x74, 0x74, 0x74, 0x7f, 0x8c, 0x8c, 0x8c, 0xff, 0xa3, 0xa3, 0xa3, 0x7f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
+  0x22, 0x7f, 0x15, 0x15, 0x15, 0xff, 0x06, 0x06, 0x06, 0x7f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x70, 0x70, 0x7f, 0x87, 0x87, 0x87, 0xff, 0x9f, 0x9f, 0x9f, 0x7f, 0xa8, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x66, 0x66, 0x04, 0x7f, 0x7f, 0x7f, 0x0b, 0x99, 0x99, 0x99, 0x04, 
+  0xd4, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +404,7 @@ const lv_img_dsc_t IRController_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( IRController_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = IRController_64px_map,
 };
-
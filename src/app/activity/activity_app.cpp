@@ -0,0 +1,85 @@
+/****************************************************************************
+ *   Oct 29 22:31:09 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <TTGO.h>
+
+#include "activity_app.h"
+#include "activity_app_main.h"
+#include "activity_app_week.h"
+
+#include "gui/mainbar/mainbar.h"
+#include "gui/statusbar.h"
+#include "gui/app.h"
+
+uint32_t activity_app_main_tile_num;
+uint32_t activity_app_week_tile_num;
+
+// app icon
+icon_t *activity_app = NULL;
+
+LV_IMG_DECLARE(activity_app_64px);
+
+static void enter_activity_app_event_cb( lv_obj_t * obj, lv_event_t event );
+static void activity_app_create_cb( void );
+static void activity_app_destroy_cb( void );
+
+/*
+ * setup routine for activity app, today on the main tile and the last seven days below
+ */
+void activity_app_setup( void ) {
+    activity_app_main_tile_num = mainbar_add_app_tile( 1, 2, "Activity App" );
+    activity_app_week_tile_num = activity_app_main_tile_num + 1;
+
+    activity_app = app_register( "activity", &activity_app_64px, enter_activity_app_event_cb );
+
+    // the charts are build on the first use and deleted when not used for a while
+    mainbar_add_app_tile_lifecycle_cb( activity_app_main_tile_num, activity_app_create_cb, activity_app_destroy_cb );
+}
+
+static void activity_app_create_cb( void ) {
+    activity_app_main_setup( activity_app_main_tile_num );
+    activity_app_week_setup( activity_app_week_tile_num );
+}
+
+static void activity_app_destroy_cb( void ) {
+    activity_app_main_destroy();
+    activity_app_week_destroy();
+}
+
+uint32_t activity_app_get_app_main_tile_num( void ) {
+    return( activity_app_main_tile_num );
+}
+
+uint32_t activity_app_get_app_week_tile_num( void ) {
+    return( activity_app_week_tile_num );
+}
+
+/*
+ *
+ */
+static void enter_activity_app_event_cb( lv_obj_t * obj, lv_event_t event ) {
+    switch( event ) {
+        case( LV_EVENT_CLICKED ):       statusbar_hide( true );
+                                        mainbar_jump_to_tilenumber( activity_app_main_tile_num, LV_ANIM_OFF );
+                                        break;
+    }    
+}
@@ -0,0 +1,33 @@
+/****************************************************************************
+ *   Oct 29 22:31:09 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _ACTIVITY_APP_H
+    #define _ACTIVITY_APP_H
+
+    #include <TTGO.h>
+
+    #define ACTIVITY_APP_REFRESH        60000       // ms between two chart updates while the app is open
+
+    void activity_app_setup( void );
+    uint32_t activity_app_get_app_main_tile_num( void );
+    uint32_t activity_app_get_app_week_tile_num( void );
+
+#endif // _ACTIVITY_APP_H
@@ -0,0 +1,180 @@
+/****************************************************************************
+ *   Oct 29 22:31:09 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <TTGO.h>
+
+#include "activity_app.h"
+#include "activity_app_main.h"
+
+#include "gui/mainbar/mainbar.h"
+#include "gui/statusbar.h"
+#include "hardware/stephistory.h"
+#include "hardware/bma.h"
+
+lv_obj_t *activity_app_main_tile = NULL;
+lv_style_t activity_app_main_style;
+lv_style_t activity_app_main_steps_style;
+
+static lv_obj_t *activity_app_main_steps_label = NULL;
+static lv_obj_t *activity_app_main_minutes_label = NULL;
+static lv_obj_t *activity_app_main_chart = NULL;
+static lv_chart_series_t *activity_app_main_series = NULL;
+
+lv_task_t * _activity_app_main_task = NULL;
+
+LV_IMG_DECLARE(exit_32px);
+LV_FONT_DECLARE(Ubuntu_32px);
+
+static void exit_activity_app_main_event_cb( lv_obj_t * obj, lv_event_t event );
+static void activity_app_main_update( void );
+void activity_app_main_task( lv_task_t * task );
+
+void activity_app_main_setup( uint32_t tile_num ) {
+
+    activity_app_main_tile = mainbar_get_tile_obj( tile_num );
+    lv_style_copy( &activity_app_main_style, mainbar_get_style() );
+    lv_style_copy( &activity_app_main_steps_style, &activity_app_main_style );
+    lv_style_set_text_font( &activity_app_main_steps_style, LV_STATE_DEFAULT, &Ubuntu_32px );
+
+    lv_obj_t *title_label = lv_label_create( activity_app_main_tile, NULL );
+    lv_label_set_text( title_label, "today" );
+    lv_obj_reset_style_list( title_label, LV_OBJ_PART_MAIN );
+    lv_obj_add_style( title_label, LV_OBJ_PART_MAIN, &activity_app_main_style );
+    lv_obj_align( title_label, activity_app_main_tile, LV_ALIGN_IN_TOP_LEFT, 10, 10 );
+
+    activity_app_main_steps_label = lv_label_create( activity_app_main_tile, NULL );
+    lv_label_set_text( activity_app_main_steps_label, "0" );
+    lv_obj_reset_style_list( activity_app_main_steps_label, LV_OBJ_PART_MAIN );
+    lv_obj_add_style( activity_app_main_steps_label, LV_OBJ_PART_MAIN, &activity_app_main_steps_style );
+    lv_obj_align( activity_app_main_steps_label, title_label, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 5 );
+
+    activity_app_main_minutes_label = lv_label_create( activity_app_main_tile, NULL );
+    lv_label_set_text( activity_app_main_minutes_label, "" );
+    lv_label_set_align( activity_app_main_minutes_label, LV_LABEL_ALIGN_RIGHT );
+    lv_obj_reset_style_list( activity_app_main_minutes_label, LV_OBJ_PART_MAIN );
+    lv_obj_add_style( activity_app_main_minutes_label, LV_OBJ_PART_MAIN, &activity_app_main_style );
+    lv_obj_align( activity_app_main_minutes_label, activity_app_main_tile, LV_ALIGN_IN_TOP_RIGHT, -10, 10 );
+
+    /*
+     * one column per hour
+     */
+    activity_app_main_chart = lv_chart_create( activity_app_main_tile, NULL );
+    lv_obj_set_size( activity_app_main_chart, lv_disp_get_hor_res( NULL ) - 20, 110 );
+    lv_obj_set_style_local_bg_opa( activity_app_main_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, LV_OPA_0 );
+    lv_obj_set_style_local_border_width( activity_app_main_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 0 );
+    lv_obj_set_style_local_pad_bottom( activity_app_main_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 20 );
+    lv_obj_set_style_local_text_color( activity_app_main_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, LV_COLOR_WHITE );
+    lv_obj_align( activity_app_main_chart, activity_app_main_tile, LV_ALIGN_CENTER, 0, 15 );
+    lv_chart_set_type( activity_app_main_chart, LV_CHART_TYPE_COLUMN );
+    lv_chart_set_point_count( activity_app_main_chart, 24 );
+    lv_chart_set_div_line_count( activity_app_main_chart, 3, 0 );
+    lv_chart_set_x_tick_texts( activity_app_main_chart, "0\n6\n12\n18\n24", 0, LV_CHART_AXIS_DRAW_LAST_TICK );
+    activity_app_main_series = lv_chart_add_series( activity_app_main_chart, LV_COLOR_MAKE( 0x20, 0x99, 0xd8 ) );
+
+    lv_obj_t * exit_btn = lv_imgbtn_create( activity_app_main_tile, NULL);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_RELEASED, &exit_32px);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_PRESSED, &exit_32px);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_CHECKED_RELEASED, &exit_32px);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_CHECKED_PRESSED, &exit_32px);
+    lv_obj_add_style(exit_btn, LV_IMGBTN_PART_MAIN, &activity_app_main_style );
+    lv_obj_align(exit_btn, activity_app_main_tile, LV_ALIGN_IN_BOTTOM_LEFT, 10, -10 );
+    lv_obj_set_event_cb( exit_btn, exit_activity_app_main_event_cb );
+
+    activity_app_main_update();
+    _activity_app_main_task = lv_task_create( activity_app_main_task, ACTIVITY_APP_REFRESH, LV_TASK_PRIO_LOW, NULL );
+}
+
+void activity_app_main_destroy( void ) {
+    if ( _activity_app_main_task ) {
+        lv_task_del( _activity_app_main_task );
+        _activity_app_main_task = NULL;
+    }
+    lv_style_reset( &activity_app_main_style );
+    lv_style_reset( &activity_app_main_steps_style );
+    activity_app_main_tile = NULL;
+    activity_app_main_steps_label = NULL;
+    activity_app_main_minutes_label = NULL;
+    activity_app_main_chart = NULL;
+    activity_app_main_series = NULL;
+}
+
+/*
+ * fill the hour columns of today from the step history
+ */
+static void activity_app_main_update( void ) {
+    stephistory_bucket_t buckets[ 24 ];
+    lv_coord_t points[ 24 ];
+    uint32_t steps = 0;
+    uint32_t active = 0;
+    uint32_t sleep = 0;
+    uint32_t max = 100;
+    char msg[32]="";
+    time_t now;
+
+    time( &now );
+    time_t day_start = stephistory_bucket_start( STEPHISTORY_DAY, now );
+    size_t count = stephistory_query( STEPHISTORY_HOUR, day_start, now, buckets, 24 );
+
+    memset( points, 0, sizeof( points ) );
+    for ( size_t i = 0 ; i < count ; i++ ) {
+        uint32_t hour = ( buckets[ i ].time - day_start ) / 3600;
+        if ( hour >= 24 ) {
+            continue;
+        }
+        points[ hour ] = buckets[ i ].steps > 30000 ? 30000 : buckets[ i ].steps;
+        steps += buckets[ i ].steps;
+        active += buckets[ i ].active;
+        sleep += buckets[ i ].sleep;
+        if ( buckets[ i ].steps > max ) {
+            max = buckets[ i ].steps;
+        }
+    }
+
+    lv_chart_set_range( activity_app_main_chart, 0, max > 30000 ? 30000 : max );
+    lv_chart_set_points( activity_app_main_chart, activity_app_main_series, points );
+
+    snprintf( msg, sizeof( msg ), "%d", steps );
+    lv_label_set_text( activity_app_main_steps_label, msg );
+
+    /*
+     * active and sleep minutes are only recorded with activity recognition on
+     */
+    if ( bma_get_config( BMA_ACTIVITY ) ) {
+        snprintf( msg, sizeof( msg ), "%d min active\n%d:%02d sleep", active, sleep / 60, sleep % 60 );
+    }
+    else {
+        msg[ 0 ] = '\0';
+    }
+    lv_label_set_text( activity_app_main_minutes_label, msg );
+    lv_obj_align( activity_app_main_minutes_label, activity_app_main_tile, LV_ALIGN_IN_TOP_RIGHT, -10, 10 );
+}
+
+static void exit_activity_app_main_event_cb( lv_obj_t * obj, lv_event_t event ) {
+    switch( event ) {
+        case( LV_EVENT_CLICKED ):       mainbar_jump_to_maintile( LV_ANIM_OFF );
+                                        break;
+    }
+}
+
+void activity_app_main_task( lv_task_t * task ) {
+    activity_app_main_update();
+}
@@ -0,0 +1,166 @@
+/****************************************************************************
+ *   Oct 29 22:31:09 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <TTGO.h>
+
+#include "activity_app.h"
+#include "activity_app_week.h"
+
+#include "gui/mainbar/mainbar.h"
+#include "gui/statusbar.h"
+#include "hardware/stephistory.h"
+
+lv_obj_t *activity_app_week_tile = NULL;
+lv_style_t activity_app_week_style;
+lv_style_t activity_app_week_steps_style;
+
+static lv_obj_t *activity_app_week_steps_label = NULL;
+static lv_obj_t *activity_app_week_chart = NULL;
+static lv_chart_series_t *activity_app_week_series = NULL;
+static char activity_app_week_days[ 7 * 4 ] = "";      // tick texts, the chart keeps the pointer
+
+lv_task_t * _activity_app_week_task = NULL;
+
+LV_IMG_DECLARE(exit_32px);
+LV_FONT_DECLARE(Ubuntu_32px);
+
+static void exit_activity_app_week_event_cb( lv_obj_t * obj, lv_event_t event );
+static void activity_app_week_update( void );
+void activity_app_week_task( lv_task_t * task );
+
+void activity_app_week_setup( uint32_t tile_num ) {
+
+    activity_app_week_tile = mainbar_get_tile_obj( tile_num );
+    lv_style_copy( &activity_app_week_style, mainbar_get_style() );
+    lv_style_copy( &activity_app_week_steps_style, &activity_app_week_style );
+    lv_style_set_text_font( &activity_app_week_steps_style, LV_STATE_DEFAULT, &Ubuntu_32px );
+
+    lv_obj_t *title_label = lv_label_create( activity_app_week_tile, NULL );
+    lv_label_set_text( title_label, "last 7 days, average" );
+    lv_obj_reset_style_list( title_label, LV_OBJ_PART_MAIN );
+    lv_obj_add_style( title_label, LV_OBJ_PART_MAIN, &activity_app_week_style );
+    lv_obj_align( title_label, activity_app_week_tile, LV_ALIGN_IN_TOP_LEFT, 10, 10 );
+
+    activity_app_week_steps_label = lv_label_create( activity_app_week_tile, NULL );
+    lv_label_set_text( activity_app_week_steps_label, "0" );
+    lv_obj_reset_style_list( activity_app_week_steps_label, LV_OBJ_PART_MAIN );
+    lv_obj_add_style( activity_app_week_steps_label, LV_OBJ_PART_MAIN, &activity_app_week_steps_style );
+    lv_obj_align( activity_app_week_steps_label, title_label, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 5 );
+
+    /*
+     * one column per day, today on the right
+     */
+    activity_app_week_chart = lv_chart_create( activity_app_week_tile, NULL );
+    lv_obj_set_size( activity_app_week_chart, lv_disp_get_hor_res( NULL ) - 20, 110 );
+    lv_obj_set_style_local_bg_opa( activity_app_week_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, LV_OPA_0 );
+    lv_obj_set_style_local_border_width( activity_app_week_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 0 );
+    lv_obj_set_style_local_pad_bottom( activity_app_week_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 20 );
+    lv_obj_set_style_local_text_color( activity_app_week_chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, LV_COLOR_WHITE );
+    lv_obj_align( activity_app_week_chart, activity_app_week_tile, LV_ALIGN_CENTER, 0, 15 );
+    lv_chart_set_type( activity_app_week_chart, LV_CHART_TYPE_COLUMN );
+    lv_chart_set_point_count( activity_app_week_chart, 7 );
+    lv_chart_set_div_line_count( activity_app_week_chart, 3, 0 );
+    activity_app_week_series = lv_chart_add_series( activity_app_week_chart, LV_COLOR_MAKE( 0x20, 0x99, 0xd8 ) );
+
+    lv_obj_t * exit_btn = lv_imgbtn_create( activity_app_week_tile, NULL);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_RELEASED, &exit_32px);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_PRESSED, &exit_32px);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_CHECKED_RELEASED, &exit_32px);
+    lv_imgbtn_set_src(exit_btn, LV_BTN_STATE_CHECKED_PRESSED, &exit_32px);
+    lv_obj_add_style(exit_btn, LV_IMGBTN_PART_MAIN, &activity_app_week_style );
+    lv_obj_align(exit_btn, activity_app_week_tile, LV_ALIGN_IN_BOTTOM_LEFT, 10, -10 );
+    lv_obj_set_event_cb( exit_btn, exit_activity_app_week_event_cb );
+
+    activity_app_week_update();
+    _activity_app_week_task = lv_task_create( activity_app_week_task, ACTIVITY_APP_REFRESH, LV_TASK_PRIO_LOW, NULL );
+}
+
+void activity_app_week_destroy( void ) {
+    if ( _activity_app_week_task ) {
+        lv_task_del( _activity_app_week_task );
+        _activity_app_week_task = NULL;
+    }
+    lv_style_reset( &activity_app_week_style );
+    lv_style_reset( &activity_app_week_steps_style );
+    activity_app_week_tile = NULL;
+    activity_app_week_steps_label = NULL;
+    activity_app_week_chart = NULL;
+    activity_app_week_series = NULL;
+}
+
+/*
+ * fill the day columns of the last seven days from the step history
+ */
+static void activity_app_week_update( void ) {
+    stephistory_bucket_t buckets[ 7 ];
+    lv_coord_t points[ 7 ];
+    uint32_t steps = 0;
+    uint32_t max = 1000;
+    char msg[16]="";
+    struct tm info;
+    time_t now;
+
+    time( &now );
+    time_t week_start = stephistory_bucket_start( STEPHISTORY_DAY, now - 6 * 86400 );
+    size_t count = stephistory_query( STEPHISTORY_DAY, week_start, now, buckets, 7 );
+
+    memset( points, 0, sizeof( points ) );
+    for ( size_t i = 0 ; i < count ; i++ ) {
+        /*
+         * round to the next day, a day with a daylight saving switch is 23 or 25 hours long
+         */
+        uint32_t day = ( buckets[ i ].time - week_start + 43200 ) / 86400;
+        if ( day >= 7 ) {
+            continue;
+        }
+        points[ day ] = buckets[ i ].steps > 30000 ? 30000 : buckets[ i ].steps;
+        steps += buckets[ i ].steps;
+        if ( buckets[ i ].steps > max ) {
+            max = buckets[ i ].steps;
+        }
+    }
+
+    activity_app_week_days[ 0 ] = '\0';
+    for ( int i = 0 ; i < 7 ; i++ ) {
+        time_t day = week_start + i * 86400 + 43200;
+        localtime_r( &day, &info );
+        size_t len = strlen( activity_app_week_days );
+        strftime( &activity_app_week_days[ len ], sizeof( activity_app_week_days ) - len, i < 6 ? "%a\n" : "%a", &info );
+    }
+    lv_chart_set_x_tick_texts( activity_app_week_chart, activity_app_week_days, 0, LV_CHART_AXIS_DRAW_LAST_TICK );
+    lv_chart_set_range( activity_app_week_chart, 0, max > 30000 ? 30000 : max );
+    lv_chart_set_points( activity_app_week_chart, activity_app_week_series, points );
+
+    snprintf( msg, sizeof( msg ), "%d", steps / 7 );
+    lv_label_set_text( activity_app_week_steps_label, msg );
+}
+
+static void exit_activity_app_week_event_cb( lv_obj_t * obj, lv_event_t event ) {
+    switch( event ) {
+        case( LV_EVENT_CLICKED ):       mainbar_jump_to_maintile( LV_ANIM_OFF );
+                                        break;
+    }
+}
+
+void activity_app_week_task( lv_task_t * task ) {
+    activity_app_week_update();
+}
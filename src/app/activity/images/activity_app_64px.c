@@ -0,0 +1,197 @@
+#include "lvgl/lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_ACTIVITY_APP_64PX
+#define LV_ATTRIBUTE_IMG_ACTIVITY_APP_64PX
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ACTIVITY_APP_64PX uint8_t activity_app_64px_map[] = {
+#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0xaa, 0x33, 0xff, 0x92, 0x00, 0x00, 0xae, 0x33, 0xff, 0x8e, 0x00, 0x00, 0xb2, 0x33, 0xff, 0x8b, 0x00, 0x00, 0xb4, 0x33, 0xff, 0x89, 0x00, 0x00, 0xb6, 
+  0x33, 0xff, 0x87, 0x00, 0x00, 0xb8, 0x33, 0xff, 0x85, 0x00, 0x00, 0xba, 0x33, 0xff, 0x84, 0x00, 0x00, 0xba, 0x33, 0xff, 0x83, 0x00, 0x00, 0xbc, 0x33, 0xff, 0x82, 0x00, 0x00, 0xbc, 0x33, 0xff, 
+  0x81, 0x00, 0x00, 0xbe, 0x33, 0xff, 0x00, 0x00, 0x00, 0xbe, 0x33, 0xff, 0x00, 0x00, 0x00, 0xbe, 0x33, 0xff, 0x00, 0x00, 0x00, 0xbe, 0x33, 0xff, 0x00, 0x00, 0x00, 0xbe, 0x33, 0xff, 0x00, 0x00, 
+  0x00, 0xbe, 0x33, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x9f, 
+  0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 
+  0x00, 0x00, 0x00, 0x9f, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 
+  0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 
+  0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 
+  0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 
+  0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 
+  0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 
+  0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8c, 0x33, 0xff, 0x88, 0xff, 
+  0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 
+  0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 
+  0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 
+  0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 
+  0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x95, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 
+  0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 
+  0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 
+  0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 
+  0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 
+  0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 
+  0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 
+  0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 
+  0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 
+  0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 
+  0x00, 0x00, 0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 
+  0x00, 0x89, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x81, 0x33, 0xff, 0x88, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x00, 0x00, 0x00, 0x89, 
+  0x33, 0xff, 0xa9, 0xff, 0xff, 0x8a, 0x33, 0xff, 0x81, 0x00, 0x00, 0x88, 0x33, 0xff, 0xa9, 0xff, 0xff, 0x89, 0x33, 0xff, 0x82, 0x00, 0x00, 0x88, 0x33, 0xff, 0xa9, 0xff, 0xff, 0x89, 0x33, 0xff, 
+  0x83, 0x00, 0x00, 0xba, 0x33, 0xff, 0x84, 0x00, 0x00, 0xba, 0x33, 0xff, 0x85, 0x00, 0x00, 0xb8, 0x33, 0xff, 0x87, 0x00, 0x00, 0xb6, 0x33, 0xff, 0x89, 0x00, 0x00, 0xb4, 0x33, 0xff, 0x8b, 0x00, 
+  0x00, 0xb2, 0x33, 0xff, 0x8e, 0x00, 0x00, 0xae, 0x33, 0xff, 0x92, 0x00, 0x00, 0xaa, 0x33, 0xff, 0xca, 0x00, 0x00, 
+#endif
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0xaa, 0xdb, 0x24, 0xff, 0x92, 0x00, 0x00, 0x00, 0xae, 0xdb, 0x24, 0xff, 0x8e, 0x00, 0x00, 0x00, 0xb2, 0xdb, 0x24, 0xff, 0x8b, 0x00, 0x00, 0x00, 
+  0xb4, 0xdb, 0x24, 0xff, 0x89, 0x00, 0x00, 0x00, 0xb6, 0xdb, 0x24, 0xff, 0x87, 0x00, 0x00, 0x00, 0xb8, 0xdb, 0x24, 0xff, 0x85, 0x00, 0x00, 0x00, 0xba, 0xdb, 0x24, 0xff, 0x84, 0x00, 0x00, 0x00, 
+  0xba, 0xdb, 0x24, 0xff, 0x83, 0x00, 0x00, 0x00, 0xbc, 0xdb, 0x24, 0xff, 0x82, 0x00, 0x00, 0x00, 0xbc, 0xdb, 0x24, 0xff, 0x81, 0x00, 0x00, 0x00, 0xbe, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0xbe, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0xbe, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0xdb, 0x24, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8a, 0xdb, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0xdb, 0x24, 0xff, 0xa9, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0x24, 0xff, 0x81, 0x00, 0x00, 0x00, 0x88, 0xdb, 0x24, 0xff, 0xa9, 0xff, 0xff, 0xff, 
+  0x89, 0xdb, 0x24, 0xff, 0x82, 0x00, 0x00, 0x00, 0x88, 0xdb, 0x24, 0xff, 0xa9, 0xff, 0xff, 0xff, 0x89, 0xdb, 0x24, 0xff, 0x83, 0x00, 0x00, 0x00, 0xba, 0xdb, 0x24, 0xff, 0x84, 0x00, 0x00, 0x00, 
+  0xba, 0xdb, 0x24, 0xff, 0x85, 0x00, 0x00, 0x00, 0xb8, 0xdb, 0x24, 0xff, 0x87, 0x00, 0x00, 0x00, 0xb6, 0xdb, 0x24, 0xff, 0x89, 0x00, 0x00, 0x00, 0xb4, 0xdb, 0x24, 0xff, 0x8b, 0x00, 0x00, 0x00, 
+  0xb2, 0xdb, 0x24, 0xff, 0x8e, 0x00, 0x00, 0x00, 0xae, 0xdb, 0x24, 0xff, 0x92, 0x00, 0x00, 0x00, 0xaa, 0xdb, 0x24, 0xff, 0xca, 0x00, 0x00, 0x00, 
+#endif
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0xaa, 0x24, 0xdb, 0xff, 0x92, 0x00, 0x00, 0x00, 0xae, 0x24, 0xdb, 0xff, 0x8e, 0x00, 0x00, 0x00, 0xb2, 0x24, 0xdb, 0xff, 0x8b, 0x00, 0x00, 0x00, 
+  0xb4, 0x24, 0xdb, 0xff, 0x89, 0x00, 0x00, 0x00, 0xb6, 0x24, 0xdb, 0xff, 0x87, 0x00, 0x00, 0x00, 0xb8, 0x24, 0xdb, 0xff, 0x85, 0x00, 0x00, 0x00, 0xba, 0x24, 0xdb, 0xff, 0x84, 0x00, 0x00, 0x00, 
+  0xba, 0x24, 0xdb, 0xff, 0x83, 0x00, 0x00, 0x00, 0xbc, 0x24, 0xdb, 0xff, 0x82, 0x00, 0x00, 0x00, 0xbc, 0x24, 0xdb, 0xff, 0x81, 0x00, 0x00, 0x00, 0xbe, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0xbe, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0xbe, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8c, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x95, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x89, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 0x81, 0x24, 0xdb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0x8a, 0x24, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x89, 0x24, 0xdb, 0xff, 0xa9, 0xff, 0xff, 0xff, 0x8a, 0x24, 0xdb, 0xff, 0x81, 0x00, 0x00, 0x00, 0x88, 0x24, 0xdb, 0xff, 0xa9, 0xff, 0xff, 0xff, 
+  0x89, 0x24, 0xdb, 0xff, 0x82, 0x00, 0x00, 0x00, 0x88, 0x24, 0xdb, 0xff, 0xa9, 0xff, 0xff, 0xff, 0x89, 0x24, 0xdb, 0xff, 0x83, 0x00, 0x00, 0x00, 0xba, 0x24, 0xdb, 0xff, 0x84, 0x00, 0x00, 0x00, 
+  0xba, 0x24, 0xdb, 0xff, 0x85, 0x00, 0x00, 0x00, 0xb8, 0x24, 0xdb, 0xff, 0x87, 0x00, 0x00, 0x00, 0xb6, 0x24, 0xdb, 0xff, 0x89, 0x00, 0x00, 0x00, 0xb4, 0x24, 0xdb, 0xff, 0x8b, 0x00, 0x00, 0x00, 
+  0xb2, 0x24, 0xdb, 0xff, 0x8e, 0x00, 0x00, 0x00, 0xae, 0x24, 0xdb, 0xff, 0x92, 0x00, 0x00, 0x00, 0xaa, 0x24, 0xdb, 0xff, 0xca, 0x00, 0x00, 0x00, 
+#endif
+#if LV_COLOR_DEPTH == 32
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xd8, 0x99, 0x20, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0xae, 0xd8, 0x99, 0x20, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xd8, 0x99, 
+  0x20, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xd8, 0x99, 0x20, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xd8, 0x99, 0x20, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xd8, 0x99, 0x20, 0xff, 
+  0x85, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd8, 0x99, 0x20, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd8, 0x99, 0x20, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xd8, 0x99, 0x20, 0xff, 0x82, 0x00, 
+  0x00, 0x00, 0x00, 0xbc, 0xd8, 0x99, 0x20, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xbe, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 
+  0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 
+  0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 
+  0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 
+  0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 
+  0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x95, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 
+  0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 
+  0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 
+  0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 
+  0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x81, 0xd8, 0x99, 
+  0x20, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x99, 0x20, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xd8, 0x99, 0x20, 0xff, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x88, 0xd8, 0x99, 0x20, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x88, 0xd8, 0x99, 0x20, 0xff, 0xa9, 0xff, 
+  0xff, 0xff, 0xff, 0x89, 0xd8, 0x99, 0x20, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd8, 0x99, 0x20, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd8, 0x99, 0x20, 0xff, 0x85, 0x00, 0x00, 0x00, 
+  0x00, 0xb8, 0xd8, 0x99, 0x20, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xd8, 0x99, 0x20, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xd8, 0x99, 0x20, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xb2, 
+  0xd8, 0x99, 0x20, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xae, 0xd8, 0x99, 0x20, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xd8, 0x99, 0x20, 0xff, 0xca, 0x00, 0x00, 0x00, 0x00, 
+#endif
+};
+
+const lv_img_dsc_t activity_app_64px = {
+  .header.always_zero = 0,
+  .header.w = 64,
+  .header.h = 64,
+  .data_size = sizeof( activity_app_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
+  .data = activity_app_64px_map,
+};
@@ -23,13 +23,28 @@
 #include <hardware/rtcctl.h>
 #include <SPIFFS.h>
 #include "hardware/json_psram_allocator.h"
+#include "hardware/config_store.h"
 
 #define CONFIG_FILE_PATH "/alarm.json"
 
 static bool vibe = 1;
 static bool fade = 1;
 
-static void load_data(){
+typedef struct {
+    bool vibe = true;
+    bool fade = true;
+    uint8_t hour = 0;
+    uint8_t minute = 0;
+    bool enabled = false;
+} alarm_data_config_t;
+
+static alarm_data_config_t alarm_data_config;
+static bool alarm_data_valid = false;
+
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void load_json_data(){
     if (! SPIFFS.exists( CONFIG_FILE_PATH ) ) {
         return; //wil be used default values set during theier creation
     }
@@ -46,49 +61,47 @@ static void load_data(){
     DeserializationError error = deserializeJson( doc, file );
     if ( error ) {
         log_e("update check deserializeJson() failed: %s", error.c_str() );
+        file.close();
         return;
     }
 
-    //vibe and fade are feature of alarm and is set directly
-    //enabled, hour and minute are features of rtc and are set via registered event
-    vibe = doc["vibe"].as<bool>();
-    fade = doc["fade"].as<bool>();
-    alarm_set_term(doc["hour"].as<int>(), doc["minute"].as<int>());
-    alarm_set_enabled(doc["enabled"].as<bool>());
+    alarm_data_config.vibe = doc["vibe"].as<bool>();
+    alarm_data_config.fade = doc["fade"].as<bool>();
+    alarm_data_config.hour = doc["hour"].as<int>();
+    alarm_data_config.minute = doc["minute"].as<int>();
+    alarm_data_config.enabled = doc["enabled"].as<bool>();
+    alarm_data_valid = true;
 
     doc.clear();
     file.close();
 }
 
-void alarm_data_store_data(bool enabled){
-    if ( SPIFFS.exists( CONFIG_FILE_PATH ) ) {
-        SPIFFS.remove( CONFIG_FILE_PATH );
-        log_i("remove old binary weather config");
+static void load_data(){
+    if ( config_store_register( "alarm", &alarm_data_config, sizeof( alarm_data_config ), load_json_data ) ) {
+        alarm_data_valid = true;
     }
-
-    fs::File file = SPIFFS.open( CONFIG_FILE_PATH, FILE_WRITE );
-    if (!file) {
-        log_e("Can't open file: %s!", CONFIG_FILE_PATH );
-        return;
+    if ( !alarm_data_valid ) {
+        return; //wil be used default values set during theier creation
     }
 
-    SpiRamJsonDocument doc( 1000 );
+    //vibe and fade are feature of alarm and is set directly
+    //enabled, hour and minute are features of rtc and are set via registered event
+    vibe = alarm_data_config.vibe;
+    fade = alarm_data_config.fade;
+    alarm_set_term( alarm_data_config.hour, alarm_data_config.minute );
+    alarm_set_enabled( alarm_data_config.enabled );
+}
 
-    doc["version"] = 1;
-    doc["vibe"] = vibe;
-    doc["fade"] = fade;
-    doc["hour"] = alarm_get_hour();
-    doc["minute"] = alarm_get_minute();
+void alarm_data_store_data(bool enabled){
+    alarm_data_config.vibe = vibe;
+    alarm_data_config.fade = fade;
+    alarm_data_config.hour = alarm_get_hour();
+    alarm_data_config.minute = alarm_get_minute();
 
     //FIXME: Workaround: alarm have to be disabled when it is stored. When was enabled and the alarm time was now it caused crashes (opening the file crashed)
-    doc["enabled"] = enabled; //alarm_is_enabled();
-
-    if ( serializeJsonPretty( doc, file ) == 0) {
-        log_e("Failed to write config file");
-    }
+    alarm_data_config.enabled = enabled; //alarm_is_enabled();
 
-    doc.clear();
-    file.close();
+    config_store_save( &alarm_data_config );
 }
 
 void alarm_set_term(uint8_t hour, uint8_t minute){
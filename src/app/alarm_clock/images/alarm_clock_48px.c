@@ -10,207 +10,450 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ALARM_CLOCK_48PX uint8_t alarm_clock_48px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x0c, 0x92, 0x07, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x0b, 0x92, 0x0b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x38, 0x25, 0x93, 0x00, 0xcc, 0x00, 0xe7, 0x00, 0xdb, 0x24, 0xb0, 0x49, 0x4f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x49, 0x64, 0x24, 0xbf, 0x00, 0xe0, 0x00, 0xe3, 0x00, 0xc3, 0x25, 0x7f, 0x6e, 0x23, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6d, 0x24, 0x24, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0x9f, 0x92, 0x07, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x1c, 0x24, 0xc3, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0x25, 0x90, 0x6e, 0x0f, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x57, 0x00, 0xef, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xf8, 0x00, 0xff, 0x24, 0xa8, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x10, 0x00, 0xd3, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd7, 0x49, 0x33, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x5f, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x25, 0x78, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x24, 0xab, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xf0, 0x49, 0x33, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x28, 0x00, 0xf7, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xeb, 0x6e, 0x1b, 0x92, 0x03, 0x92, 0x03, 0x92, 0x04, 0x92, 0x03, 0x6d, 0x3c, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xd8, 0x6e, 0x0c, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x24, 0xa0, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x25, 0x9c, 0x6e, 0x17, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x2f, 0x24, 0xbb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x49, 0x68, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x6e, 0x08, 0x00, 0xdf, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x24, 0xb7, 0x49, 0x44, 0x6e, 0x20, 0x49, 0x50, 0x49, 0x80, 0x24, 0x9b, 0x24, 0xa7, 0x24, 0xa4, 0x24, 0x93, 0x49, 0x77, 0x6d, 0x43, 0x6d, 0x1f, 0x49, 0x5c, 0x00, 0xd0, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x24, 0xb4, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x03, 0x92, 0x00, 0x6e, 0x1b, 0x00, 0xf4, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd3, 0x25, 0x80, 0x25, 0x77, 0x00, 0xbf, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf3, 0x24, 0xa8, 0x25, 0x67, 0x25, 0x8f, 0x00, 0xe4, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xcc, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x03, 0x92, 0x00, 0x6e, 0x13, 0x00, 0xeb, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xe8, 0x24, 0x9f, 0x24, 0x9f, 0x00, 0xdf, 0x00, 0xff, 0x24, 0xff, 0x6d, 0xff, 0xb6, 0xfb, 0xdb, 0xfb, 0xdb, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xdb, 0xfb, 0xdb, 0xfb, 0x92, 0xfb, 0x49, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xc8, 0x24, 0x8f, 0x24, 0xa8, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x24, 0xc3, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x24, 0xa3, 0x24, 0x80, 0x00, 0xd3, 0x00, 0xff, 0x49, 0xff, 0xb7, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x92, 0xfc, 0x24, 0xff, 0x00, 0xff, 0x24, 0xb4, 0x25, 0x73, 0x24, 0xbc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xf8, 0x00, 0xff, 0x25, 0x97, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x25, 0x80, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xd3, 0x49, 0x47, 0x25, 0x7f, 0x00, 0xf8, 0x24, 0xff, 0xb6, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x6e, 0xfc, 0x00, 0xff, 0x00, 0xe3, 0x49, 0x53, 0x49, 0x63, 0x00, 0xec, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x49, 0x48, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x1f, 0x00, 0xfc, 0x00, 0xf3, 0x49, 0x7f, 0x92, 0x03, 0x49, 0x8c, 0x00, 0xff, 0x49, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xfc, 0x24, 0xff, 0x00, 0xff, 0x49, 0x4f, 0x92, 0x10, 0x24, 0x9b, 0x00, 0xff, 0x00, 0xd8, 0x92, 0x07, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x5f, 0x6d, 0x2c, 0x92, 0x00, 0x25, 0x90, 0x00, 0xff, 0x49, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfc, 0x25, 0xfc, 0x00, 0xff, 0x49, 0x4c, 0x92, 0x00, 0x49, 0x47, 0x49, 0x48, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x63, 0x00, 0xff, 0x49, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfc, 0x24, 0xfc, 0x00, 0xf3, 0x6d, 0x28, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x6e, 0x23, 0x00, 0xf3, 0x25, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xdb, 0xff, 0x24, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xfb, 0x00, 0xff, 0x24, 0xc4, 0x92, 0x04, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xab, 0x00, 0xff, 0xb7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xfb, 0x00, 0xff, 0x49, 0x60, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x33, 0x00, 0xff, 0x49, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x24, 0xff, 0x00, 0xdc, 0x92, 0x08, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x24, 0xa0, 0x00, 0xff, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xfc, 0x00, 0xff, 0x49, 0x58, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x13, 0x00, 0xef, 0x49, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0xff, 0x00, 0xb7, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x50, 0x00, 0xff, 0x92, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x49, 0xff, 0x00, 0xf0, 0x6e, 0x17, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x25, 0x8c, 0x00, 0xff, 0xdb, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x49, 0x47, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0xb8, 0x24, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf8, 0x00, 0xff, 0x49, 0x74, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0xd3, 0x25, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x24, 0xff, 0x92, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfb, 0x00, 0xff, 0x24, 0x93, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x08, 0x00, 0xdf, 0x49, 0xff, 0xff, 0xfc, 0x6d, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xff, 0xfb, 0x00, 0xff, 0x24, 0xa4, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x0b, 0x00, 0xe0, 0x6d, 0xff, 0xff, 0xfc, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x24, 0xff, 0x24, 0xff, 0x49, 0xff, 0xff, 0xfb, 0x24, 0xff, 0x24, 0xa7, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x6e, 0x04, 0x00, 0xdb, 0x49, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x24, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0x24, 0x9f, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0xcb, 0x24, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xf8, 0x00, 0xff, 0x25, 0x87, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xa7, 0x00, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xfb, 0x00, 0xff, 0x49, 0x60, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x73, 0x00, 0xff, 0xb7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xfc, 0x00, 0xff, 0x6d, 0x30, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6d, 0x33, 0x00, 0xfc, 0x6e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x25, 0xff, 0x00, 0xdb, 0x92, 0x07, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x00, 0xd3, 0x24, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfb, 0x00, 0xff, 0x25, 0x90, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x6f, 0x00, 0xff, 0xb6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xfc, 0x00, 0xfb, 0x6d, 0x2c, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x0f, 0x00, 0xe7, 0x24, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfb, 0x00, 0xff, 0x24, 0xac, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x68, 0x00, 0xff, 0x6e, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x25, 0xfc, 0x00, 0xf8, 0x6d, 0x2b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x24, 0xc0, 0x00, 0xff, 0xb6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xfb, 0x00, 0xff, 0x49, 0x7c, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x1f, 0x00, 0xe8, 0x00, 0xff, 0xdb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xf8, 0x00, 0xff, 0x00, 0xb8, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6d, 0x3b, 0x00, 0xf4, 0x00, 0xff, 0xb7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x00, 0xcf, 0x6e, 0x10, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6d, 0x3f, 0x00, 0xec, 0x00, 0xff, 0x92, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xfc, 0x00, 0xff, 0x00, 0xc8, 0x6e, 0x14, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6d, 0x2c, 0x00, 0xd3, 0x00, 0xfc, 0x49, 0xfc, 0xb7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb6, 0xfc, 0x24, 0xfc, 0x00, 0xff, 0x24, 0xa8, 0x6e, 0x0f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x00, 0xcb, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 0xff, 0xb6, 0xfb, 0xdb, 0xfb, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xdb, 0xfb, 0x92, 0xfb, 0x25, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x24, 0x97, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x6f, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xf7, 0x24, 0xab, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x25, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd8, 0x24, 0xa8, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x3b, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x18, 0x00, 0xe7, 0x00, 0xf8, 0x00, 0xff, 0x24, 0x93, 0x92, 0x00, 0x6e, 0x1c, 0x49, 0x63, 0x24, 0xa8, 0x00, 0xd8, 0x00, 0xf4, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xef, 0x00, 0xd0, 0x25, 0x98, 0x49, 0x4f, 0x92, 0x0b, 0x92, 0x00, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xfc, 0x24, 0xbf, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x44, 0x00, 0xff, 0x00, 0xff, 0x00, 0xef, 0x6e, 0x14, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x6e, 0x1b, 0x6d, 0x2f, 0x6d, 0x3b, 0x6d, 0x38, 0x6d, 0x2b, 0x92, 0x14, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x3b, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6e, 0x18, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x08, 0x25, 0x98, 0x00, 0xdc, 0x49, 0x57, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x04, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x25, 0x84, 0x00, 0xdc, 0x25, 0x73, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xb1, 0x00, 0x00, 0x01, 0x92, 0x03, 0x92, 0x04, 0x82, 0x00, 0x00, 0x81, 0x92, 0x03, 0x8b, 0x00, 0x00, 0x81, 0x92, 0x03, 0x82, 0x00, 0x00, 0x00, 0x92, 0x04, 0x93, 0x00, 
+  0x00, 0x01, 0x92, 0x0c, 0x92, 0x07, 0x8f, 0x00, 0x00, 0x81, 0x92, 0x0b, 0x82, 0x00, 0x00, 0x00, 0x92, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x92, 0x03, 0x81, 0x00, 0x00, 0x06, 0x6d, 0x38, 0x25, 0x93, 
+  0x00, 0xcc, 0x00, 0xe7, 0x00, 0xdb, 0x24, 0xb0, 0x49, 0x4f, 0x8a, 0x00, 0x00, 0x07, 0x92, 0x04, 0x49, 0x64, 0x24, 0xbf, 0x00, 0xe0, 0x00, 0xe3, 0x00, 0xc3, 0x25, 0x7f, 0x6e, 0x23, 0x81, 0x00, 
+  0x00, 0x00, 0x92, 0x03, 0x88, 0x00, 0x00, 0x03, 0x92, 0x03, 0x00, 0x00, 0x6d, 0x24, 0x24, 0xaf, 0x86, 0x00, 0xff, 0x01, 0x24, 0x9f, 0x92, 0x07, 0x87, 0x00, 0x00, 0x01, 0x6e, 0x1c, 0x24, 0xc3, 
+  0x85, 0x00, 0xff, 0x04, 0x00, 0xf4, 0x25, 0x90, 0x6e, 0x0f, 0x00, 0x00, 0x92, 0x03, 0x86, 0x00, 0x00, 0x06, 0x92, 0x03, 0x00, 0x00, 0x49, 0x57, 0x00, 0xef, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 
+  0x82, 0x00, 0xfc, 0x05, 0x00, 0xfb, 0x00, 0xf8, 0x00, 0xff, 0x24, 0xa8, 0x00, 0x00, 0x92, 0x03, 0x84, 0x00, 0x00, 0x04, 0x6e, 0x10, 0x00, 0xd3, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xfb, 0x82, 0x00, 
+  0xfc, 0x00, 0x00, 0xfb, 0x81, 0x00, 0xff, 0x01, 0x00, 0xd7, 0x49, 0x33, 0x88, 0x00, 0x00, 0x00, 0x49, 0x5f, 0x81, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x86, 0x00, 0xff, 0x02, 0x00, 0xf8, 0x00, 0xff, 
+  0x25, 0x78, 0x84, 0x00, 0x00, 0x03, 0x92, 0x03, 0x24, 0xab, 0x00, 0xff, 0x00, 0xf8, 0x86, 0x00, 0xff, 0x03, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xf0, 0x49, 0x33, 0x86, 0x00, 0x00, 0x03, 0x6d, 0x28, 
+  0x00, 0xf7, 0x00, 0xfc, 0x00, 0xfb, 0x86, 0x00, 0xff, 0x81, 0x00, 0xfc, 0x02, 0x00, 0xff, 0x00, 0xeb, 0x6e, 0x1b, 0x81, 0x92, 0x03, 0x02, 0x92, 0x04, 0x92, 0x03, 0x6d, 0x3c, 0x81, 0x00, 0xff, 
+  0x01, 0x00, 0xfb, 0x00, 0xfc, 0x86, 0x00, 0xff, 0x03, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xd8, 0x6e, 0x0c, 0x83, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x24, 0xa0, 0x00, 0xff, 0x00, 0xf8, 0x85, 
+  0x00, 0xff, 0x81, 0x00, 0xfc, 0x81, 0x00, 0xff, 0x01, 0x25, 0x9c, 0x6e, 0x17, 0x85, 0x00, 0x00, 0x01, 0x6d, 0x2f, 0x24, 0xbb, 0x81, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x86, 0x00, 0xff, 0x04, 0x00, 
+  0xf8, 0x00, 0xff, 0x49, 0x68, 0x00, 0x00, 0x92, 0x03, 0x82, 0x00, 0x00, 0x03, 0x6e, 0x08, 0x00, 0xdf, 0x00, 0xff, 0x00, 0xfc, 0x84, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x81, 0x00, 0xff, 0x0d, 0x24, 
+  0xb7, 0x49, 0x44, 0x6e, 0x20, 0x49, 0x50, 0x49, 0x80, 0x24, 0x9b, 0x24, 0xa7, 0x24, 0xa4, 0x24, 0x93, 0x49, 0x77, 0x6d, 0x43, 0x6d, 0x1f, 0x49, 0x5c, 0x00, 0xd0, 0x81, 0x00, 0xff, 0x00, 0x00, 
+  0xfc, 0x84, 0x00, 0xff, 0x02, 0x00, 0xfb, 0x00, 0xfc, 0x24, 0xb4, 0x82, 0x00, 0x00, 0x05, 0x92, 0x03, 0x00, 0x00, 0x6e, 0x1b, 0x00, 0xf4, 0x00, 0xff, 0x00, 0xfc, 0x82, 0x00, 0xff, 0x00, 0x00, 
+  0xfc, 0x81, 0x00, 0xff, 0x04, 0x00, 0xd3, 0x25, 0x80, 0x25, 0x77, 0x00, 0xbf, 0x00, 0xfc, 0x87, 0x00, 0xff, 0x04, 0x00, 0xf3, 0x24, 0xa8, 0x25, 0x67, 0x25, 0x8f, 0x00, 0xe4, 0x81, 0x00, 0xff, 
+  0x00, 0x00, 0xfc, 0x82, 0x00, 0xff, 0x02, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xcc, 0x82, 0x00, 0x00, 0x06, 0x92, 0x03, 0x00, 0x00, 0x6e, 0x13, 0x00, 0xeb, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x81, 
+  0x00, 0xfc, 0x01, 0x00, 0xff, 0x00, 0xe8, 0x81, 0x24, 0x9f, 0x04, 0x00, 0xdf, 0x00, 0xff, 0x24, 0xff, 0x6d, 0xff, 0xb6, 0xfb, 0x81, 0xdb, 0xfb, 0x81, 0xff, 0xfb, 0x81, 0xdb, 0xfb, 0x01, 0x92, 
+  0xfb, 0x49, 0xff, 0x81, 0x00, 0xff, 0x0a, 0x00, 0xc8, 0x24, 0x8f, 0x24, 0xa8, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x24, 0xc3, 0x85, 0x00, 0x00, 
+  0x01, 0x00, 0xc8, 0x00, 0xff, 0x81, 0x00, 0xfb, 0x81, 0x00, 0xff, 0x06, 0x24, 0xa3, 0x24, 0x80, 0x00, 0xd3, 0x00, 0xff, 0x49, 0xff, 0xb7, 0xfc, 0xff, 0xfc, 0x83, 0xff, 0xff, 0x01, 0x49, 0xff, 
+  0xb7, 0xff, 0x83, 0xff, 0xff, 0x06, 0xff, 0xfc, 0x92, 0xfc, 0x24, 0xff, 0x00, 0xff, 0x24, 0xb4, 0x25, 0x73, 0x24, 0xbc, 0x81, 0x00, 0xff, 0x05, 0x00, 0xfb, 0x00, 0xf8, 0x00, 0xff, 0x25, 0x97, 
+  0x00, 0x00, 0x92, 0x03, 0x81, 0x00, 0x00, 0x0c, 0x92, 0x03, 0x00, 0x00, 0x25, 0x80, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xd3, 0x49, 0x47, 0x25, 0x7f, 0x00, 0xf8, 0x24, 0xff, 0xb6, 0xfb, 
+  0xff, 0xfc, 0x85, 0xff, 0xff, 0x01, 0x00, 0xff, 0x92, 0xff, 0x85, 0xff, 0xff, 0x0c, 0xff, 0xfc, 0x6e, 0xfc, 0x00, 0xff, 0x00, 0xe3, 0x49, 0x53, 0x49, 0x63, 0x00, 0xec, 0x00, 0xff, 0x00, 0xfb, 
+  0x00, 0xff, 0x49, 0x48, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x08, 0x6e, 0x1f, 0x00, 0xfc, 0x00, 0xf3, 0x49, 0x7f, 0x92, 0x03, 0x49, 0x8c, 0x00, 0xff, 0x49, 0xfc, 0xff, 0xfc, 0x87, 0xff, 
+  0xff, 0x01, 0x00, 0xff, 0x92, 0xff, 0x87, 0xff, 0xff, 0x08, 0xb7, 0xfc, 0x24, 0xff, 0x00, 0xff, 0x49, 0x4f, 0x92, 0x10, 0x24, 0x9b, 0x00, 0xff, 0x00, 0xd8, 0x92, 0x07, 0x86, 0x00, 0x00, 0x05, 
+  0x49, 0x5f, 0x6d, 0x2c, 0x00, 0x00, 0x25, 0x90, 0x00, 0xff, 0x49, 0xf8, 0x89, 0xff, 0xff, 0x01, 0x25, 0xff, 0xb6, 0xff, 0x88, 0xff, 0xff, 0x06, 0xdb, 0xfc, 0x25, 0xfc, 0x00, 0xff, 0x49, 0x4c, 
+  0x00, 0x00, 0x49, 0x47, 0x49, 0x48, 0x89, 0x00, 0x00, 0x02, 0x49, 0x63, 0x00, 0xff, 0x49, 0xfb, 0x96, 0xff, 0xff, 0x03, 0xdb, 0xfc, 0x24, 0xfc, 0x00, 0xf3, 0x6d, 0x28, 0x89, 0x00, 0x00, 0x08, 
+  0x92, 0x04, 0x6e, 0x23, 0x00, 0xf3, 0x25, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xdb, 0xff, 0x24, 0xff, 0xdb, 0xff, 0x93, 0xff, 0xff, 0x02, 0xb7, 0xfb, 0x00, 0xff, 0x24, 0xc4, 0x81, 0x92, 0x04, 0x88, 
+  0x00, 0x00, 0x02, 0x24, 0xab, 0x00, 0xff, 0xb7, 0xfb, 0x82, 0xff, 0xff, 0x02, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x8d, 0xff, 0xff, 0x01, 0x49, 0xff, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x04, 0x6e, 
+  0xfb, 0x00, 0xff, 0x49, 0x60, 0x00, 0x00, 0x92, 0x03, 0x86, 0x00, 0x00, 0x02, 0x6d, 0x33, 0x00, 0xff, 0x49, 0xfc, 0x84, 0xff, 0xff, 0x02, 0x49, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x8b, 0xff, 0xff, 
+  0x02, 0x24, 0xff, 0x00, 0xff, 0x24, 0xff, 0x83, 0xff, 0xff, 0x03, 0xff, 0xfc, 0x24, 0xff, 0x00, 0xdc, 0x92, 0x08, 0x85, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x24, 0xa0, 0x00, 0xff, 0xdb, 
+  0xfb, 0x85, 0xff, 0xff, 0x02, 0x49, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x00, 0x24, 0xff, 0x81, 0x00, 0xff, 0x00, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x04, 0x92, 0xfc, 0x00, 0xff, 0x49, 
+  0x58, 0x00, 0x00, 0x92, 0x03, 0x84, 0x00, 0x00, 0x03, 0x6e, 0x13, 0x00, 0xef, 0x49, 0xff, 0xff, 0xfc, 0x86, 0xff, 0xff, 0x02, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x87, 0xff, 0xff, 0x00, 0x24, 
+  0xff, 0x81, 0x00, 0xff, 0x00, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x02, 0xff, 0xfb, 0x00, 0xff, 0x00, 0xb7, 0x84, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x50, 0x00, 0xff, 0x92, 0xfb, 0x88, 
+  0xff, 0xff, 0x02, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x00, 0x24, 0xff, 0x81, 0x00, 0xff, 0x00, 0xdb, 0xff, 0x86, 0xff, 0xff, 0x03, 0xff, 0xfc, 0x49, 0xff, 0x00, 0xf0, 0x6e, 
+  0x17, 0x83, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x25, 0x8c, 0x00, 0xff, 0xdb, 0xf8, 0x89, 0xff, 0xff, 0x02, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x00, 0x25, 0xff, 0x81, 
+  0x00, 0xff, 0x00, 0xdb, 0xff, 0x88, 0xff, 0xff, 0x04, 0x92, 0xfb, 0x00, 0xff, 0x49, 0x47, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x02, 0x00, 0xb8, 0x24, 0xff, 0xff, 0xfb, 0x8a, 0xff, 0xff, 
+  0x02, 0x25, 0xff, 0x00, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x00, 0x25, 0xff, 0x81, 0x00, 0xff, 0x00, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x04, 0xdb, 0xf8, 0x00, 0xff, 0x49, 0x74, 0x00, 0x00, 0x92, 
+  0x03, 0x83, 0x00, 0x00, 0x02, 0x00, 0xd3, 0x25, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0x03, 0x25, 0xff, 0x24, 0xff, 0x92, 0xff, 0x24, 0xff, 0x81, 0x00, 0xff, 0x00, 0xdb, 0xff, 0x8a, 0xff, 0xff, 
+  0x04, 0xdb, 0xfb, 0x00, 0xff, 0x24, 0x93, 0x00, 0x00, 0x92, 0x03, 0x82, 0x00, 0x00, 0x07, 0x92, 0x08, 0x00, 0xdf, 0x49, 0xff, 0xff, 0xfc, 0x6d, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0x88, 
+  0xff, 0xff, 0x83, 0x00, 0xff, 0x00, 0xdb, 0xff, 0x87, 0xff, 0xff, 0x81, 0x6e, 0xff, 0x06, 0x6d, 0xff, 0x92, 0xff, 0xff, 0xfb, 0x00, 0xff, 0x24, 0xa4, 0x00, 0x00, 0x92, 0x03, 0x82, 0x00, 0x00, 
+  0x03, 0x92, 0x0b, 0x00, 0xe0, 0x6d, 0xff, 0xff, 0xfc, 0x82, 0x24, 0xff, 0x00, 0x92, 0xff, 0x88, 0xff, 0xff, 0x00, 0x24, 0xff, 0x81, 0x00, 0xff, 0x00, 0x49, 0xff, 0x88, 0xff, 0xff, 0x00, 0x25, 
+  0xff, 0x81, 0x24, 0xff, 0x03, 0x49, 0xff, 0xff, 0xfb, 0x24, 0xff, 0x24, 0xa7, 0x84, 0x00, 0x00, 0x03, 0x6e, 0x04, 0x00, 0xdb, 0x49, 0xff, 0xff, 0xfc, 0x8c, 0xff, 0xff, 0x03, 0x92, 0xff, 0x00, 
+  0xff, 0x24, 0xff, 0xdb, 0xff, 0x8c, 0xff, 0xff, 0x04, 0xff, 0xf8, 0x00, 0xff, 0x24, 0x9f, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x02, 0x00, 0xcb, 0x24, 0xff, 0xff, 0xfb, 0x9d, 0xff, 0xff, 
+  0x04, 0xdb, 0xf8, 0x00, 0xff, 0x25, 0x87, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x02, 0x24, 0xa7, 0x00, 0xff, 0xff, 0xfb, 0x9d, 0xff, 0xff, 0x04, 0xb7, 0xfb, 0x00, 0xff, 0x49, 0x60, 0x00, 
+  0x00, 0x92, 0x03, 0x81, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x73, 0x00, 0xff, 0xb7, 0xfb, 0x9d, 0xff, 0xff, 0x02, 0x6e, 0xfc, 0x00, 0xff, 0x6d, 0x30, 0x83, 0x00, 0x00, 0x04, 0x92, 
+  0x03, 0x00, 0x00, 0x6d, 0x33, 0x00, 0xfc, 0x6e, 0xfc, 0x9c, 0xff, 0xff, 0x03, 0xff, 0xfc, 0x25, 0xff, 0x00, 0xdb, 0x92, 0x07, 0x85, 0x00, 0x00, 0x03, 0x92, 0x03, 0x00, 0xd3, 0x24, 0xff, 0xff, 
+  0xfc, 0x9b, 0xff, 0xff, 0x04, 0xdb, 0xfb, 0x00, 0xff, 0x25, 0x90, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x6f, 0x00, 0xff, 0xb6, 0xfb, 0x9b, 0xff, 0xff, 
+  0x02, 0x49, 0xfc, 0x00, 0xfb, 0x6d, 0x2c, 0x87, 0x00, 0x00, 0x03, 0x92, 0x0f, 0x00, 0xe7, 0x24, 0xfc, 0xff, 0xfc, 0x99, 0xff, 0xff, 0x02, 0xdb, 0xfb, 0x00, 0xff, 0x24, 0xac, 0x87, 0x00, 0x00, 
+  0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x68, 0x00, 0xff, 0x6e, 0xfb, 0x98, 0xff, 0xff, 0x03, 0xff, 0xfc, 0x25, 0xfc, 0x00, 0xf8, 0x6d, 0x2b, 0x88, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x24, 
+  0xc0, 0x00, 0xff, 0xb6, 0xfb, 0x97, 0xff, 0xff, 0x04, 0x6e, 0xfb, 0x00, 0xff, 0x49, 0x7c, 0x00, 0x00, 0x92, 0x03, 0x89, 0x00, 0x00, 0x03, 0x6d, 0x1f, 0x00, 0xe8, 0x00, 0xff, 0xdb, 0xfb, 0x89, 
+  0xff, 0xff, 0x00, 0xb7, 0xff, 0x8a, 0xff, 0xff, 0x04, 0x92, 0xf8, 0x00, 0xff, 0x00, 0xb8, 0x00, 0x00, 0x92, 0x03, 0x89, 0x00, 0x00, 0x05, 0x92, 0x03, 0x00, 0x00, 0x6d, 0x3b, 0x00, 0xf4, 0x00, 
+  0xff, 0xb7, 0xfc, 0x88, 0xff, 0xff, 0x01, 0x00, 0xff, 0x92, 0xff, 0x88, 0xff, 0xff, 0x03, 0x92, 0xfb, 0x00, 0xff, 0x00, 0xcf, 0x6e, 0x10, 0x8c, 0x00, 0x00, 0x05, 0x92, 0x03, 0x00, 0x00, 0x6d, 
+  0x3f, 0x00, 0xec, 0x00, 0xff, 0x92, 0xfc, 0x87, 0xff, 0xff, 0x01, 0x00, 0xff, 0x92, 0xff, 0x87, 0xff, 0xff, 0x03, 0x6d, 0xfc, 0x00, 0xff, 0x00, 0xc8, 0x6e, 0x14, 0x8e, 0x00, 0x00, 0x06, 0x92, 
+  0x03, 0x00, 0x00, 0x6d, 0x2c, 0x00, 0xd3, 0x00, 0xfc, 0x49, 0xfc, 0xb7, 0xfc, 0x85, 0xff, 0xff, 0x01, 0x00, 0xff, 0x92, 0xff, 0x84, 0xff, 0xff, 0x05, 0xff, 0xfc, 0xb6, 0xfc, 0x24, 0xfc, 0x00, 
+  0xff, 0x24, 0xa8, 0x6e, 0x0f, 0x90, 0x00, 0x00, 0x08, 0x92, 0x04, 0x00, 0x00, 0x00, 0xcb, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 0xff, 0xb6, 0xfb, 0xdb, 0xfb, 0x81, 0xff, 0xfc, 0x01, 0xff, 
+  0xff, 0xb6, 0xff, 0x81, 0xff, 0xff, 0x81, 0xff, 0xfc, 0x08, 0xdb, 0xfb, 0x92, 0xfb, 0x25, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x24, 0x97, 0x00, 0x00, 0x92, 0x04, 0x8e, 0x00, 0x00, 0x07, 
+  0x92, 0x03, 0x00, 0x00, 0x49, 0x6f, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xf7, 0x24, 0xab, 0x00, 0xf0, 0x81, 0x00, 0xff, 0x07, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x6e, 0xff, 
+  0x49, 0xff, 0x25, 0xff, 0x81, 0x00, 0xff, 0x07, 0x00, 0xd8, 0x24, 0xa8, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x3b, 0x00, 0x00, 0x92, 0x03, 0x8e, 0x00, 0x00, 0x0a, 0x6e, 0x18, 0x00, 0xe7, 
+  0x00, 0xf8, 0x00, 0xff, 0x24, 0x93, 0x00, 0x00, 0x6e, 0x1c, 0x49, 0x63, 0x24, 0xa8, 0x00, 0xd8, 0x00, 0xf4, 0x83, 0x00, 0xff, 0x06, 0x00, 0xef, 0x00, 0xd0, 0x25, 0x98, 0x49, 0x4f, 0x92, 0x0b, 
+  0x00, 0x00, 0x00, 0xc8, 0x81, 0x00, 0xfc, 0x01, 0x24, 0xbf, 0x92, 0x04, 0x8d, 0x00, 0x00, 0x02, 0x92, 0x03, 0x00, 0x00, 0x49, 0x44, 0x81, 0x00, 0xff, 0x02, 0x00, 0xef, 0x6e, 0x14, 0x92, 0x03, 
+  0x82, 0x00, 0x00, 0x06, 0x92, 0x03, 0x6e, 0x1b, 0x6d, 0x2f, 0x6d, 0x3b, 0x6d, 0x38, 0x6d, 0x2b, 0x92, 0x14, 0x84, 0x00, 0x00, 0x00, 0x49, 0x3b, 0x82, 0x00, 0xff, 0x00, 0x6e, 0x18, 0x8f, 0x00, 
+  0x00, 0x08, 0x92, 0x08, 0x25, 0x98, 0x00, 0xdc, 0x49, 0x57, 0x00, 0x00, 0x92, 0x03, 0x00, 0x00, 0x92, 0x04, 0x92, 0x03, 0x87, 0x00, 0x00, 0x81, 0x92, 0x03, 0x05, 0x00, 0x00, 0x92, 0x03, 0x00, 
+  0x00, 0x25, 0x84, 0x00, 0xdc, 0x25, 0x73, 0x9c, 0x00, 0x00, 0x81, 0x92, 0x03, 0x93, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0x30, 0x84, 0x00, 0x10, 0x84, 0x03, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x03, 0x30, 0x84, 0x00, 0x30, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x04, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0xaf, 0x7b, 0x00, 0x8e, 0x73, 0x0c, 0x8e, 0x73, 0x07, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x8e, 0x73, 0x0b, 0x8e, 0x73, 0x0b, 0xef, 0x7b, 0x00, 0x51, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x31, 0x8c, 0x00, 0x10, 0x84, 0x00, 0xab, 0x5a, 0x38, 0x45, 0x29, 0x93, 0x41, 0x08, 0xcc, 0x20, 0x00, 0xe7, 0x00, 0x00, 0xdb, 0xa3, 0x18, 0xb0, 0x49, 0x4a, 0x4f, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xcf, 0x7b, 0x04, 0x08, 0x42, 0x64, 0x82, 0x10, 0xbf, 0x20, 0x00, 0xe0, 0x20, 0x00, 0xe3, 0x82, 0x10, 0xc3, 0x65, 0x29, 0x7f, 0x2c, 0x63, 0x23, 0x31, 0x8c, 0x00, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x0c, 0x63, 0x24, 0xc3, 0x18, 0xaf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xc3, 0x18, 0x9f, 0xaf, 0x7b, 0x07, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x0c, 0x63, 0x1c, 0x82, 0x10, 0xc3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf4, 0x45, 0x29, 0x90, 0x4d, 0x6b, 0x0f, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x49, 0x4a, 0x57, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xa8, 0xef, 0x7b, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x4d, 0x6b, 0x10, 0x20, 0x00, 0xd3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xd7, 0x69, 0x4a, 0x33, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xa7, 0x39, 0x5f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x86, 0x31, 0x78, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0xe3, 0x18, 0xab, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x6a, 0x52, 0x33, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0x0c, 0x63, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xeb, 0x0c, 0x63, 0x1b, 0x31, 0x8c, 0x03, 0xf0, 0x83, 0x03, 0xef, 0x7b, 0x04, 0x51, 0x8c, 0x03, 0xaa, 0x52, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x08, 0xd8, 0x6e, 0x73, 0x0c, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x30, 0x84, 0x00, 0x04, 0x21, 0xa0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x25, 0x29, 0x9c, 0x6d, 0x6b, 0x17, 0x31, 0x8c, 0x00, 0x30, 0x84, 0x00, 0x30, 0x84, 0x00, 0x30, 0x84, 0x00, 0x30, 0x84, 0x00, 0x51, 0x8c, 0x00, 0xcb, 0x5a, 0x2f, 0xa2, 0x10, 0xbb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xc7, 0x39, 0x68, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x6e, 0x73, 0x08, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb7, 0x49, 0x4a, 0x44, 0x0c, 0x63, 0x20, 0x69, 0x4a, 0x50, 0xa6, 0x31, 0x80, 0xc3, 0x18, 0x9b, 0xa3, 0x18, 0xa7, 0xa3, 0x18, 0xa4, 0xe3, 0x18, 0x93, 0xe7, 0x39, 0x77, 0xab, 0x5a, 0x43, 0x0c, 0x63, 0x1f, 0xe8, 0x41, 0x5c, 0x62, 0x10, 0xd0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0xe3, 0x18, 0xb4, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x03, 0x30, 0x84, 0x00, 0x8e, 0x73, 0x1b, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xd3, 0x25, 0x29, 0x80, 0x45, 0x29, 0x77, 0x62, 0x10, 0xbf, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x82, 0x10, 0xff, 0x62, 0x10, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf3, 0xe3, 0x18, 0xa8, 0x65, 0x29, 0x67, 0x04, 0x21, 0x8f, 0x41, 0x08, 0xe4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x62, 0x10, 0xcc, 0xcf, 0x7b, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x03, 0x30, 0x84, 0x00, 0x6e, 0x73, 0x13, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x20, 0x00, 0xe8, 0xa2, 0x10, 0x9f, 0xa2, 0x10, 0x9f, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0xe3, 0x18, 0xff, 0x0c, 0x63, 0xff, 0xd3, 0x9c, 0xfb, 0xd7, 0xbd, 0xfb, 0x9a, 0xd6, 0xfb, 0xfc, 0xe6, 0xfb, 0xdb, 0xde, 0xfb, 0x59, 0xce, 0xfb, 0xb6, 0xb5, 0xfb, 0x51, 0x8c, 0xfb, 0x6a, 0x52, 0xff, 0x61, 0x08, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xc8, 0xc3, 0x18, 0x8f, 0x82, 0x10, 0xa8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xc3, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0xaf, 0x7b, 0x00, 0x41, 0x08, 0xc8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xa3, 0xe4, 0x20, 0x80, 0x20, 0x00, 0xd3, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x14, 0xa5, 0xfc, 0x1c, 0xe7, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xa7, 0x39, 0xff, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbb, 0xde, 0xfc, 0x31, 0x8c, 0xfc, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb4, 0x25, 0x29, 0x73, 0x82, 0x10, 0xbc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x25, 0x29, 0x97, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x66, 0x31, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x41, 0x08, 0xd3, 0x08, 0x42, 0x47, 0x04, 0x21, 0x7f, 0x00, 0x00, 0xf8, 0xa3, 0x18, 0xff, 0xd3, 0x9c, 0xfb, 0x7e, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x00, 0x00, 0xff, 0x51, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0xfc, 0x8e, 0x73, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0xc7, 0x39, 0x53, 0xc7, 0x39, 0x63, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x29, 0x4a, 0x48, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x4d, 0x6b, 0x1f, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf3, 0xa6, 0x31, 0x7f, 0x8e, 0x73, 0x03, 0x86, 0x31, 0x8c, 0x00, 0x00, 0xff, 0xe7, 0x39, 0xfc, 0xba, 0xd6, 0xfc, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x00, 0x00, 0xff, 0x51, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x96, 0xb5, 0xfc, 0xa3, 0x18, 0xff, 0x00, 0x00, 0xff, 0x6a, 0x52, 0x4f, 0x8e, 0x73, 0x10, 0xe4, 0x20, 0x9b, 0x00, 0x00, 0xff, 0x20, 0x00, 0xd8, 0xae, 0x73, 0x07, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0xc7, 0x39, 0x5f, 0xcb, 0x5a, 0x2c, 0x71, 0x8c, 0x00, 0x45, 0x29, 0x90, 0x00, 0x00, 0xff, 0x8a, 0x52, 0xf8, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x45, 0x29, 0xff, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xfc, 0x04, 0x21, 0xfc, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x4c, 0x72, 0x94, 0x00, 0x69, 0x4a, 0x47, 0x29, 0x4a, 0x48, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0x92, 0x94, 0x00, 0xc7, 0x39, 0x63, 0x00, 0x00, 0xff, 0x08, 0x42, 0xfb, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xfc, 0xa3, 0x18, 0xfc, 0x00, 0x00, 0xf3, 0xec, 0x62, 0x28, 0x72, 0x94, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x04, 0x0c, 0x63, 0x23, 0x00, 0x00, 0xf3, 0x04, 0x21, 0xfb, 0xdb, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xff, 0xc3, 0x18, 0xff, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xfb, 0x20, 0x00, 0xff, 0x82, 0x10, 0xc4, 0xcf, 0x7b, 0x04, 0x10, 0x84, 0x04, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0xe3, 0x18, 0xab, 0x00, 0x00, 0xff, 0x55, 0xad, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0x86, 0x31, 0xff, 0x21, 0x08, 0xff, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xde, 0xff, 0xc7, 0x39, 0xff, 0x39, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x6b, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x42, 0x60, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xec, 0x62, 0x33, 0x00, 0x00, 0xff, 0x8a, 0x52, 0xfc, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x86, 0x31, 0xff, 0x21, 0x08, 0xff, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 0x04, 0x21, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x1c, 0xe7, 0xfc, 0xc3, 0x18, 0xff, 0x41, 0x08, 0xdc, 0xcf, 0x7b, 0x08, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0x30, 0x84, 0x00, 0xe3, 0x18, 0xa0, 0x00, 0x00, 0xff, 0xf8, 0xc5, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xa6, 0x31, 0xff, 0x21, 0x08, 0xff, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 0x61, 0x08, 0xff, 0xb7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0xfc, 0x00, 0x00, 0xff, 0x28, 0x42, 0x58, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x6e, 0x73, 0x13, 0x00, 0x00, 0xef, 0xe7, 0x39, 0xff, 0x9e, 0xf7, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x86, 0x31, 0xff, 0x41, 0x08, 0xff, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xf7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xfb, 0x41, 0x08, 0xff, 0x82, 0x10, 0xb7, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x49, 0x4a, 0x50, 0x00, 0x00, 0xff, 0x51, 0x8c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x86, 0x31, 0xff, 0x41, 0x08, 0xff, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfc, 0x49, 0x4a, 0xff, 0x00, 0x00, 0xf0, 0x6d, 0x6b, 0x17, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x31, 0x8c, 0x00, 0x25, 0x29, 0x8c, 0x00, 0x00, 0xff, 0x18, 0xc6, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x66, 0x31, 0xff, 0x61, 0x08, 0xff, 0x7a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0xfb, 0x00, 0x00, 0xff, 0x69, 0x4a, 0x47, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0x82, 0x10, 0xb8, 0xa2, 0x10, 0xff, 0x1c, 0xe7, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xff, 0x66, 0x31, 0xff, 0x61, 0x08, 0xff, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xb7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0xf8, 0x00, 0x00, 0xff, 0xc7, 0x39, 0x74, 0x51, 0x8c, 0x00, 0xef, 0x7b, 0x03, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0xae, 0x73, 0x00, 0x20, 0x00, 0xd3, 0x66, 0x31, 0xff, 0x9e, 0xf7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xff, 0x65, 0x29, 0xff, 0x82, 0x10, 0xff, 0xaf, 0x7b, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xfb, 0x00, 0x00, 0xff, 0xe4, 0x20, 0x93, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x8e, 0x73, 0x08, 0x00, 0x00, 0xdf, 0x6a, 0x52, 0xff, 0xfb, 0xde, 0xfc, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xff, 0x62, 0x10, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x82, 0x10, 0xff, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x2c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0xf0, 0x83, 0xff, 0xfb, 0xde, 0xfb, 0x82, 0x10, 0xff, 0x82, 0x10, 0xa4, 0x30, 0x84, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0xae, 0x73, 0x0b, 0x00, 0x00, 0xe0, 0xaa, 0x52, 0xff, 0x9a, 0xd6, 0xfc, 0xe4, 0x20, 0xff, 0x04, 0x21, 0xff, 0xe3, 0x18, 0xff, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa2, 0x10, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x8a, 0x52, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0xff, 0x04, 0x21, 0xff, 0xe4, 0x20, 0xff, 0xe3, 0x18, 0xff, 0x29, 0x4a, 0xff, 0xfc, 0xe6, 0xfb, 0x82, 0x10, 0xff, 0xa2, 0x10, 0xa7, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 
-  0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x8e, 0x73, 0x04, 0x00, 0x00, 0xdb, 0x08, 0x42, 0xff, 0x9e, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0xff, 0x21, 0x08, 0xff, 0xa3, 0x18, 0xff, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0xf8, 0x41, 0x08, 0xff, 0x82, 0x10, 0x9f, 0x30, 0x84, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x00, 0x41, 0x08, 0xcb, 0x04, 0x21, 0xff, 0x5d, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xf8, 0x00, 0x00, 0xff, 0x66, 0x31, 0x87, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xa3, 0x18, 0xa7, 0x41, 0x08, 0xff, 0xba, 0xd6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x42, 0x60, 0x51, 0x8c, 0x00, 0xef, 0x7b, 0x03, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xa7, 0x39, 0x73, 0x00, 0x00, 0xff, 0x75, 0xad, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x6b, 0xfc, 0x00, 0x00, 0xff, 0xeb, 0x5a, 0x30, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xcb, 0x5a, 0x33, 0x00, 0x00, 0xfc, 0x4d, 0x6b, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xfc, 0x45, 0x29, 0xff, 0x00, 0x00, 0xdb, 0xaf, 0x7b, 0x07, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xcf, 0x7b, 0x03, 0x20, 0x00, 0xd3, 0xc3, 0x18, 0xff, 0x1c, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0xfb, 0x00, 0x00, 0xff, 0x25, 0x29, 0x90, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xc7, 0x39, 0x6f, 0x00, 0x00, 0xff, 0x92, 0x94, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x8a, 0x52, 0xfc, 0x00, 0x00, 0xfb, 0xec, 0x62, 0x2c, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0xae, 0x73, 0x0f, 0x20, 0x00, 0xe7, 0x04, 0x21, 0xfc, 0x1c, 0xe7, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xbd, 0xfb, 0x00, 0x00, 0xff, 0xe3, 0x18, 0xac, 0x31, 0x8c, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xc7, 0x39, 0x68, 0x00, 0x00, 0xff, 0x4d, 0x6b, 0xfb, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5d, 0xef, 0xfc, 0x86, 0x31, 0xfc, 0x00, 0x00, 0xf8, 0xec, 0x62, 0x2b, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0xf0, 0x83, 0x00, 0x82, 0x10, 0xc0, 0x00, 0x00, 0xff, 0xf4, 0xa4, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x2c, 0x63, 0xfb, 0x00, 0x00, 0xff, 0x86, 0x31, 0x7c, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0x0c, 0x63, 0x1f, 0x00, 0x00, 0xe8, 0x62, 0x10, 0xff, 0xb6, 0xb5, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x35, 0xad, 0xff, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x10, 0x84, 0xf8, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb8, 0xcf, 0x7b, 0x00, 0x10, 0x84, 0x03, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xab, 0x5a, 0x3b, 0x00, 0x00, 0xf4, 0x82, 0x10, 0xff, 0x75, 0xad, 0xfc, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x00, 0x00, 0xff, 0x31, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xcf, 0x7b, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0xcf, 0x8e, 0x73, 0x10, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xab, 0x5a, 0x3f, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x10, 0x84, 0xfc, 0x5d, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x41, 0x08, 0xff, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdb, 0xde, 0xff, 0xaa, 0x52, 0xfc, 0x00, 0x00, 0xff, 0x62, 0x10, 0xc8, 0x8e, 0x73, 0x14, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xcb, 0x5a, 0x2c, 0x61, 0x08, 0xd3, 0x00, 0x00, 0xfc, 0xc7, 0x39, 0xfc, 0x96, 0xb5, 0xfc, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x00, 0x00, 0xff, 0x31, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xfc, 0x92, 0x94, 0xfc, 0xe3, 0x18, 0xfc, 0x00, 0x00, 0xff, 0xe4, 0x20, 0xa8, 0x8e, 0x73, 0x0f, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x04, 0xf0, 0x83, 0x00, 0x62, 0x10, 0xcb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x42, 0xff, 0xb3, 0x9c, 0xfb, 0x9a, 0xd6, 0xfb, 0x7d, 0xef, 0xfc, 0xdf, 0xff, 0xfc, 0xdf, 0xff, 0xff, 0x14, 0xa5, 0xff, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfc, 0x5d, 0xef, 0xfc, 0x18, 0xc6, 0xfb, 0x10, 0x84, 0xfb, 0x25, 0x29, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x04, 0x21, 0x97, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xa6, 0x31, 0x6f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0xe3, 0x18, 0xab, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0xa6, 0x31, 0xff, 0xab, 0x5a, 0xff, 0xcf, 0x7b, 0xff, 0xd3, 0x9c, 0xff, 0x72, 0x94, 0xff, 0x6d, 0x6b, 0xff, 0x6a, 0x52, 0xff, 0x24, 0x21, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd8, 0xe4, 0x20, 0xa8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x6a, 0x52, 0x3b, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x2d, 0x6b, 0x18, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xe3, 0x18, 0x93, 0x30, 0x84, 0x00, 0x4d, 0x6b, 0x1c, 0x08, 0x42, 0x63, 0xc3, 0x18, 0xa8, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x00, 0x00, 0xd0, 0x24, 0x21, 0x98, 0x6a, 0x52, 0x4f, 0xaf, 0x7b, 0x0b, 0xf0, 0x83, 0x00, 0x61, 0x08, 0xc8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xa3, 0x18, 0xbf, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x29, 0x4a, 0x44, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x4d, 0x6b, 0x14, 0x31, 0x8c, 0x03, 0x30, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x30, 0x84, 0x00, 0xaf, 0x7b, 0x03, 0x6d, 0x6b, 0x1b, 0xaa, 0x52, 0x2f, 0xab, 0x5a, 0x3b, 0xaa, 0x52, 0x38, 0xab, 0x5a, 0x2b, 0x8e, 0x73, 0x14, 0xcf, 0x7b, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x10, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x49, 0x4a, 0x3b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x2d, 0x6b, 0x18, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0xcf, 0x7b, 0x08, 0x04, 0x21, 0x98, 0x00, 0x00, 0xdc, 0xe8, 0x41, 0x57, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x30, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x45, 0x29, 0x84, 0x20, 0x00, 0xdc, 0x65, 0x29, 0x73, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x51, 0x8c, 0x00, 0xcf, 0x7b, 0x00, 0x51, 0x8c, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x71, 0x8c, 0x00, 0xcf, 0x7b, 0x00, 0x72, 0x94, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xb1, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x03, 0xf0, 0x83, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xf0, 
+  0x83, 0x03, 0x10, 0x84, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x04, 0x93, 0x00, 0x00, 0x00, 0x01, 0x8e, 0x73, 0x0c, 0x8e, 0x73, 0x07, 0x8f, 0x00, 0x00, 0x00, 0x81, 0x8e, 0x73, 0x0b, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x81, 0x00, 0x00, 0x00, 0x06, 0xab, 0x5a, 0x38, 0x45, 0x29, 0x93, 0x41, 0x08, 0xcc, 0x20, 0x00, 
+  0xe7, 0x00, 0x00, 0xdb, 0xa3, 0x18, 0xb0, 0x49, 0x4a, 0x4f, 0x8a, 0x00, 0x00, 0x00, 0x07, 0xcf, 0x7b, 0x04, 0x08, 0x42, 0x64, 0x82, 0x10, 0xbf, 0x20, 0x00, 0xe0, 0x20, 0x00, 0xe3, 0x82, 0x10, 
+  0xc3, 0x65, 0x29, 0x7f, 0x2c, 0x63, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x88, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x24, 0xc3, 0x18, 0xaf, 
+  0x86, 0x00, 0x00, 0xff, 0x01, 0xc3, 0x18, 0x9f, 0xaf, 0x7b, 0x07, 0x87, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x63, 0x1c, 0x82, 0x10, 0xc3, 0x85, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xf4, 0x45, 0x29, 
+  0x90, 0x4d, 0x6b, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x86, 0x00, 0x00, 0x00, 0x06, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x57, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xa8, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 
+  0x4d, 0x6b, 0x10, 0x20, 0x00, 0xd3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x01, 0x21, 0x08, 0xd7, 0x69, 
+  0x4a, 0x33, 0x88, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x39, 0x5f, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x86, 0x31, 0x78, 
+  0x84, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x83, 0x03, 0xe3, 0x18, 0xab, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x86, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x6a, 
+  0x52, 0x33, 0x86, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x63, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xeb, 0x0c, 0x63, 0x1b, 0x31, 0x8c, 0x03, 0xf0, 0x83, 0x03, 0xef, 0x7b, 0x04, 0x51, 0x8c, 0x03, 0xaa, 0x52, 0x3c, 0x81, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x86, 
+  0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x08, 0xd8, 0x6e, 0x73, 0x0c, 0x83, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x04, 0x21, 0xa0, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0xf8, 0x85, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x01, 0x25, 0x29, 0x9c, 0x6d, 0x6b, 0x17, 0x85, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x5a, 0x2f, 0xa2, 
+  0x10, 0xbb, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xc7, 0x39, 0x68, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x82, 0x00, 
+  0x00, 0x00, 0x03, 0x6e, 0x73, 0x08, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x84, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x0d, 0x82, 0x10, 0xb7, 0x49, 
+  0x4a, 0x44, 0x0c, 0x63, 0x20, 0x69, 0x4a, 0x50, 0xa6, 0x31, 0x80, 0xc3, 0x18, 0x9b, 0xa3, 0x18, 0xa7, 0xa3, 0x18, 0xa4, 0xe3, 0x18, 0x93, 0xe7, 0x39, 0x77, 0xab, 0x5a, 0x43, 0x0c, 0x63, 0x1f, 
+  0xe8, 0x41, 0x5c, 0x62, 0x10, 0xd0, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x84, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0xe3, 0x18, 0xb4, 0x82, 0x00, 0x00, 0x00, 
+  0x05, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x8e, 0x73, 0x1b, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x82, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x04, 
+  0x41, 0x08, 0xd3, 0x25, 0x29, 0x80, 0x45, 0x29, 0x77, 0x62, 0x10, 0xbf, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x02, 0x20, 0x00, 0xff, 0x82, 0x10, 0xff, 0x62, 0x10, 0xff, 0x82, 0x00, 0x00, 
+  0xff, 0x04, 0x00, 0x00, 0xf3, 0xe3, 0x18, 0xa8, 0x65, 0x29, 0x67, 0x04, 0x21, 0x8f, 0x41, 0x08, 0xe4, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x82, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 
+  0xfb, 0x00, 0x00, 0xff, 0x62, 0x10, 0xcc, 0x82, 0x00, 0x00, 0x00, 0x06, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x6e, 0x73, 0x13, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 
+  0xff, 0x81, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xff, 0x20, 0x00, 0xe8, 0x81, 0xa2, 0x10, 0x9f, 0x19, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0xe3, 0x18, 0xff, 0x0c, 0x63, 0xff, 0xd3, 0x9c, 0xfb, 
+  0xd7, 0xbd, 0xfb, 0x9a, 0xd6, 0xfb, 0xfc, 0xe6, 0xfb, 0xdb, 0xde, 0xfb, 0x59, 0xce, 0xfb, 0xb6, 0xb5, 0xfb, 0x51, 0x8c, 0xfb, 0x6a, 0x52, 0xff, 0x61, 0x08, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 
+  0xc8, 0xc3, 0x18, 0x8f, 0x82, 0x10, 0xa8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xc3, 0x85, 
+  0x00, 0x00, 0x00, 0x01, 0x41, 0x08, 0xc8, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x07, 0xa2, 0x10, 0xa3, 0xe4, 0x20, 0x80, 0x20, 0x00, 0xd3, 0x00, 0x00, 0xff, 0xc7, 
+  0x39, 0xff, 0x14, 0xa5, 0xfc, 0x1c, 0xe7, 0xfc, 0xdf, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xbe, 0xf7, 0xff, 0xa7, 0x39, 0xff, 0x14, 0xa5, 0xff, 0x82, 0xff, 0xff, 0xff, 0x07, 0xbf, 0xff, 
+  0xff, 0xbb, 0xde, 0xfc, 0x31, 0x8c, 0xfc, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb4, 0x25, 0x29, 0x73, 0x82, 0x10, 0xbc, 0x81, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xfb, 0x00, 0x00, 
+  0xf8, 0x00, 0x00, 0xff, 0x25, 0x29, 0x97, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x81, 0x00, 0x00, 0x00, 0x0d, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xff, 0x41, 0x08, 0xd3, 0x08, 0x42, 0x47, 0x04, 0x21, 0x7f, 0x00, 0x00, 0xf8, 0xa3, 0x18, 0xff, 0xd3, 0x9c, 0xfb, 0x7e, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xff, 
+  0x81, 0xff, 0xff, 0xff, 0x05, 0x7e, 0xf7, 0xff, 0x00, 0x00, 0xff, 0x51, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x0d, 0xff, 0xff, 0xff, 0xfc, 
+  0xe6, 0xfc, 0x8e, 0x73, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0xc7, 0x39, 0x53, 0xc7, 0x39, 0x63, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x29, 0x4a, 0x48, 
+  0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x83, 0x00, 0x00, 0x00, 0x0a, 0x4d, 0x6b, 0x1f, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf3, 0xa6, 0x31, 0x7f, 0x8e, 0x73, 0x03, 0x86, 0x31, 0x8c, 0x00, 0x00, 0xff, 
+  0xe7, 0x39, 0xfc, 0xba, 0xd6, 0xfc, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x04, 0x9e, 0xf7, 0xff, 0x00, 0x00, 0xff, 0x51, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 
+  0x83, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x08, 0x96, 0xb5, 0xfc, 0xa3, 0x18, 0xff, 0x00, 0x00, 0xff, 0x6a, 0x52, 0x4f, 0x8e, 0x73, 0x10, 0xe4, 0x20, 0x9b, 0x00, 0x00, 0xff, 0x20, 0x00, 
+  0xd8, 0xae, 0x73, 0x07, 0x86, 0x00, 0x00, 0x00, 0x08, 0xc7, 0x39, 0x5f, 0xcb, 0x5a, 0x2c, 0x00, 0x00, 0x00, 0x45, 0x29, 0x90, 0x00, 0x00, 0xff, 0x8a, 0x52, 0xf8, 0x5d, 0xef, 0xff, 0xff, 0xff, 
+  0xff, 0xdf, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0x9e, 0xf7, 0xff, 0x45, 0x29, 0xff, 0xf3, 0x9c, 0xff, 0x86, 0xff, 0xff, 0xff, 0x08, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xfc, 
+  0x04, 0x21, 0xfc, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x4c, 0x00, 0x00, 0x00, 0x69, 0x4a, 0x47, 0x29, 0x4a, 0x48, 0x89, 0x00, 0x00, 0x00, 0x05, 0xc7, 0x39, 0x63, 0x00, 0x00, 0xff, 0x08, 0x42, 0xfb, 
+  0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xfc, 0xa3, 
+  0x18, 0xfc, 0x00, 0x00, 0xf3, 0xec, 0x62, 0x28, 0x89, 0x00, 0x00, 0x00, 0x0a, 0x30, 0x84, 0x04, 0x0c, 0x63, 0x23, 0x00, 0x00, 0xf3, 0x04, 0x21, 0xfb, 0xdb, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xf7, 
+  0xbd, 0xff, 0xc3, 0x18, 0xff, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xfb, 0x20, 0x00, 0xff, 0x82, 
+  0x10, 0xc4, 0xcf, 0x7b, 0x04, 0x10, 0x84, 0x04, 0x88, 0x00, 0x00, 0x00, 0x08, 0xe3, 0x18, 0xab, 0x00, 0x00, 0xff, 0x55, 0xad, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0x86, 
+  0x31, 0xff, 0x21, 0x08, 0xff, 0x59, 0xce, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xde, 0xff, 0xc7, 0x39, 0xff, 0x39, 0xce, 0xff, 0x81, 0xff, 0xff, 0xff, 
+  0x06, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x6b, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x42, 0x60, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x86, 0x00, 0x00, 0x00, 0x02, 0xec, 0x62, 0x33, 0x00, 0x00, 
+  0xff, 0x8a, 0x52, 0xfc, 0x81, 0xdf, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0x9e, 0xf7, 0xff, 0x86, 0x31, 0xff, 0x21, 0x08, 0xff, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x88, 
+  0xff, 0xff, 0xff, 0x04, 0xdb, 0xde, 0xff, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 0x04, 0x21, 0xff, 0x9e, 0xf7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xff, 0x1c, 0xe7, 0xfc, 0xc3, 0x18, 
+  0xff, 0x41, 0x08, 0xdc, 0xcf, 0x7b, 0x08, 0x85, 0x00, 0x00, 0x00, 0x04, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0xe3, 0x18, 0xa0, 0x00, 0x00, 0xff, 0xf8, 0xc5, 0xfb, 0x84, 0xff, 0xff, 0xff, 0x03, 
+  0x9e, 0xf7, 0xff, 0xa6, 0x31, 0xff, 0x21, 0x08, 0xff, 0x59, 0xce, 0xff, 0x86, 0xff, 0xff, 0xff, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 
+  0x61, 0x08, 0xff, 0xb7, 0xbd, 0xff, 0x84, 0xff, 0xff, 0xff, 0x04, 0x10, 0x84, 0xfc, 0x00, 0x00, 0xff, 0x28, 0x42, 0x58, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 0x6e, 
+  0x73, 0x13, 0x00, 0x00, 0xef, 0xe7, 0x39, 0xff, 0x9e, 0xf7, 0xfc, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x05, 0x9e, 0xf7, 0xff, 0x86, 0x31, 0xff, 0x41, 0x08, 0xff, 0x79, 0xce, 0xff, 0xff, 
+  0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x04, 0xdb, 0xde, 0xff, 0xe4, 0x20, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xf7, 0xbd, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0x9a, 0xd6, 
+  0xfb, 0x41, 0x08, 0xff, 0x82, 0x10, 0xb7, 0x84, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x50, 0x00, 0x00, 0xff, 0x51, 0x8c, 0xfb, 0x87, 0xff, 0xff, 0xff, 0x03, 
+  0x7e, 0xf7, 0xff, 0x86, 0x31, 0xff, 0x41, 0x08, 0xff, 0x79, 0xce, 0xff, 0x82, 0xff, 0xff, 0xff, 0x08, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 
+  0x41, 0x08, 0xff, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x03, 0xbf, 0xff, 0xfc, 0x49, 0x4a, 0xff, 0x00, 0x00, 0xf0, 0x6d, 0x6b, 0x17, 0x83, 0x00, 0x00, 
+  0x00, 0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x25, 0x29, 0x8c, 0x00, 0x00, 0xff, 0x18, 0xc6, 0xf8, 0x88, 0xff, 0xff, 0xff, 0x0d, 0x7e, 0xf7, 0xff, 0x66, 0x31, 0xff, 0x61, 0x08, 0xff, 0x7a, 
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 
+  0x86, 0xff, 0xff, 0xff, 0x04, 0x31, 0x8c, 0xfb, 0x00, 0x00, 0xff, 0x69, 0x4a, 0x47, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x83, 0x00, 0x00, 0x00, 0x05, 0x82, 0x10, 0xb8, 0xa2, 0x10, 0xff, 0x1c, 
+  0xe7, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x0b, 0x7d, 0xef, 0xff, 0x66, 0x31, 0xff, 0x61, 0x08, 0xff, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xdb, 
+  0xde, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xb7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 
+  0xb6, 0xb5, 0xf8, 0x00, 0x00, 0xff, 0xc7, 0x39, 0x74, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0xd3, 0x66, 0x31, 0xff, 0x9e, 0xf7, 0xfb, 0x8a, 0xff, 0xff, 
+  0xff, 0x09, 0x7d, 0xef, 0xff, 0x65, 0x29, 0xff, 0x82, 0x10, 0xff, 0xaf, 0x7b, 0xff, 0x04, 0x21, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0x04, 0x59, 0xce, 0xfb, 0x00, 0x00, 0xff, 0xe4, 0x20, 0x93, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x82, 0x00, 0x00, 0x00, 0x03, 0x8e, 0x73, 0x08, 0x00, 0x00, 0xdf, 0x6a, 
+  0x52, 0xff, 0xfb, 0xde, 0xfc, 0x82, 0x0c, 0x63, 0xff, 0x00, 0xf3, 0x9c, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x3c, 0xe7, 0xff, 0x62, 0x10, 0xff, 0x81, 0x00, 0x00, 0xff, 0x03, 0x82, 0x10, 0xff, 
+  0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0x5d, 0xef, 0xff, 0x2c, 0x63, 0xff, 0x81, 0x0c, 0x63, 0xff, 0x05, 0xf0, 0x83, 0xff, 0xfb, 0xde, 0xfb, 0x82, 
+  0x10, 0xff, 0x82, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x82, 0x00, 0x00, 0x00, 0x07, 0xae, 0x73, 0x0b, 0x00, 0x00, 0xe0, 0xaa, 0x52, 0xff, 0x9a, 0xd6, 0xfc, 0xe4, 0x20, 0xff, 0x04, 
+  0x21, 0xff, 0xe3, 0x18, 0xff, 0x8e, 0x73, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xff, 0xa2, 0x10, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0x8a, 0x52, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 
+  0xff, 0x85, 0xff, 0xff, 0xff, 0x07, 0xfc, 0xe6, 0xff, 0x04, 0x21, 0xff, 0xe4, 0x20, 0xff, 0xe3, 0x18, 0xff, 0x29, 0x4a, 0xff, 0xfc, 0xe6, 0xfb, 0x82, 0x10, 0xff, 0xa2, 0x10, 0xa7, 0x84, 0x00, 
+  0x00, 0x00, 0x03, 0x8e, 0x73, 0x04, 0x00, 0x00, 0xdb, 0x08, 0x42, 0xff, 0x9e, 0xf7, 0xfc, 0x8c, 0xff, 0xff, 0xff, 0x03, 0x51, 0x8c, 0xff, 0x21, 0x08, 0xff, 0xa3, 0x18, 0xff, 0x18, 0xc6, 0xff, 
+  0x8c, 0xff, 0xff, 0xff, 0x04, 0xba, 0xd6, 0xf8, 0x41, 0x08, 0xff, 0x82, 0x10, 0x9f, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x41, 0x08, 0xcb, 0x04, 0x21, 0xff, 0x5d, 
+  0xef, 0xfb, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x1c, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x04, 0x18, 0xc6, 0xf8, 0x00, 0x00, 0xff, 0x66, 0x31, 0x87, 0x00, 0x00, 0x00, 0xf0, 0x83, 
+  0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0xa3, 0x18, 0xa7, 0x41, 0x08, 0xff, 0xba, 0xd6, 0xfb, 0x9d, 0xff, 0xff, 0xff, 0x04, 0x14, 0xa5, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x42, 0x60, 0x00, 0x00, 0x00, 
+  0xef, 0x7b, 0x03, 0x81, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xa7, 0x39, 0x73, 0x00, 0x00, 0xff, 0x75, 0xad, 0xfb, 0x9d, 0xff, 0xff, 0xff, 0x02, 0x6d, 0x6b, 0xfc, 0x00, 
+  0x00, 0xff, 0xeb, 0x5a, 0x30, 0x83, 0x00, 0x00, 0x00, 0x05, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0x33, 0x00, 0x00, 0xfc, 0x4d, 0x6b, 0xfc, 0xdf, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 
+  0x03, 0x5d, 0xef, 0xfc, 0x45, 0x29, 0xff, 0x00, 0x00, 0xdb, 0xaf, 0x7b, 0x07, 0x85, 0x00, 0x00, 0x00, 0x03, 0xcf, 0x7b, 0x03, 0x20, 0x00, 0xd3, 0xc3, 0x18, 0xff, 0x1c, 0xe7, 0xfc, 0x9b, 0xff, 
+  0xff, 0xff, 0x04, 0xb6, 0xb5, 0xfb, 0x00, 0x00, 0xff, 0x25, 0x29, 0x90, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x83, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x6f, 
+  0x00, 0x00, 0xff, 0x92, 0x94, 0xfb, 0x99, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x8a, 0x52, 0xfc, 0x00, 0x00, 0xfb, 0xec, 0x62, 0x2c, 0x87, 0x00, 0x00, 0x00, 0x04, 0xae, 
+  0x73, 0x0f, 0x20, 0x00, 0xe7, 0x04, 0x21, 0xfc, 0x1c, 0xe7, 0xfc, 0xdf, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0x02, 0xb7, 0xbd, 0xfb, 0x00, 0x00, 0xff, 0xe3, 0x18, 0xac, 0x87, 0x00, 0x00, 0x00, 
+  0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x68, 0x00, 0x00, 0xff, 0x4d, 0x6b, 0xfb, 0x81, 0xdf, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 
+  0x04, 0xbf, 0xff, 0xff, 0x5d, 0xef, 0xfc, 0x86, 0x31, 0xfc, 0x00, 0x00, 0xf8, 0xec, 0x62, 0x2b, 0x88, 0x00, 0x00, 0x00, 0x06, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0x82, 0x10, 0xc0, 0x00, 0x00, 
+  0xff, 0xf4, 0xa4, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x04, 0x2c, 0x63, 0xfb, 0x00, 0x00, 0xff, 0x86, 0x31, 0x7c, 0x00, 0x00, 0x00, 0xf0, 
+  0x83, 0x03, 0x89, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x63, 0x1f, 0x00, 0x00, 0xe8, 0x62, 0x10, 0xff, 0xb6, 0xb5, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 
+  0xff, 0x35, 0xad, 0xff, 0xba, 0xd6, 0xff, 0x87, 0xff, 0xff, 0xff, 0x06, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x10, 0x84, 0xf8, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x10, 0x84, 
+  0x03, 0x89, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x3b, 0x00, 0x00, 0xf4, 0x82, 0x10, 0xff, 0x75, 0xad, 0xfc, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x85, 0xff, 
+  0xff, 0xff, 0x04, 0x7e, 0xf7, 0xff, 0x00, 0x00, 0xff, 0x31, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xcf, 0x7b, 0xfb, 
+  0x00, 0x00, 0xff, 0x82, 0x10, 0xcf, 0x8e, 0x73, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x06, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xab, 0x5a, 0x3f, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x10, 0x84, 0xfc, 
+  0x5d, 0xef, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0x9e, 0xf7, 0xff, 0x41, 0x08, 0xff, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x82, 
+  0xdf, 0xff, 0xff, 0x04, 0xdb, 0xde, 0xff, 0xaa, 0x52, 0xfc, 0x00, 0x00, 0xff, 0x62, 0x10, 0xc8, 0x8e, 0x73, 0x14, 0x8e, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xcb, 0x5a, 
+  0x2c, 0x61, 0x08, 0xd3, 0x00, 0x00, 0xfc, 0xc7, 0x39, 0xfc, 0x96, 0xb5, 0xfc, 0x9e, 0xf7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x06, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x00, 0x00, 
+  0xff, 0x31, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x05, 0x3d, 0xef, 0xfc, 0x92, 0x94, 0xfc, 0xe3, 0x18, 0xfc, 0x00, 0x00, 0xff, 0xe4, 0x20, 0xa8, 0x8e, 0x73, 
+  0x0f, 0x90, 0x00, 0x00, 0x00, 0x19, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x62, 0x10, 0xcb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x42, 0xff, 0xb3, 0x9c, 0xfb, 0x9a, 0xd6, 
+  0xfb, 0x7d, 0xef, 0xfc, 0xdf, 0xff, 0xfc, 0xdf, 0xff, 0xff, 0x14, 0xa5, 0xff, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfc, 0x5d, 0xef, 0xfc, 0x18, 0xc6, 0xfb, 0x10, 0x84, 0xfb, 0x25, 
+  0x29, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x04, 0x21, 0x97, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x11, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xa6, 
+  0x31, 0x6f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0xe3, 0x18, 0xab, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0xa6, 0x31, 0xff, 0xab, 0x5a, 0xff, 0xcf, 0x7b, 0xff, 
+  0xd3, 0x9c, 0xff, 0x72, 0x94, 0xff, 0x6d, 0x6b, 0xff, 0x6a, 0x52, 0xff, 0x24, 0x21, 0xff, 0x81, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xd8, 0xe4, 0x20, 0xa8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 
+  0x00, 0x00, 0xff, 0x6a, 0x52, 0x3b, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x0a, 0x2d, 0x6b, 0x18, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xe3, 0x18, 0x93, 
+  0x00, 0x00, 0x00, 0x4d, 0x6b, 0x1c, 0x08, 0x42, 0x63, 0xc3, 0x18, 0xa8, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xf4, 0x83, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xef, 0x00, 0x00, 0xd0, 0x24, 0x21, 0x98, 
+  0x6a, 0x52, 0x4f, 0xaf, 0x7b, 0x0b, 0x00, 0x00, 0x00, 0x61, 0x08, 0xc8, 0x81, 0x00, 0x00, 0xfc, 0x01, 0xa3, 0x18, 0xbf, 0xf0, 0x83, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xef, 0x7b, 0x03, 0x00, 
+  0x00, 0x00, 0x29, 0x4a, 0x44, 0x81, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xef, 0x4d, 0x6b, 0x14, 0x31, 0x8c, 0x03, 0x82, 0x00, 0x00, 0x00, 0x06, 0xaf, 0x7b, 0x03, 0x6d, 0x6b, 0x1b, 0xaa, 0x52, 
+  0x2f, 0xab, 0x5a, 0x3b, 0xaa, 0x52, 0x38, 0xab, 0x5a, 0x2b, 0x8e, 0x73, 0x14, 0x84, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x3b, 0x82, 0x00, 0x00, 0xff, 0x00, 0x2d, 0x6b, 0x18, 0x8f, 0x00, 0x00, 
+  0x00, 0x08, 0xcf, 0x7b, 0x08, 0x04, 0x21, 0x98, 0x00, 0x00, 0xdc, 0xe8, 0x41, 0x57, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x03, 0x87, 0x00, 0x00, 
+  0x00, 0x81, 0xf0, 0x83, 0x03, 0x05, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x45, 0x29, 0x84, 0x20, 0x00, 0xdc, 0x65, 0x29, 0x73, 0x9c, 0x00, 0x00, 0x00, 0x81, 0xf0, 0x83, 0x03, 
+  0x93, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x84, 0x30, 0x00, 0x84, 0x10, 0x03, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x03, 0x84, 0x30, 0x00, 0x84, 0x30, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x04, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x7b, 0xaf, 0x00, 0x73, 0x8e, 0x0c, 0x73, 0x8e, 0x07, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x73, 0x8e, 0x0b, 0x73, 0x8e, 0x0b, 0x7b, 0xef, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x31, 0x00, 0x84, 0x10, 0x00, 0x5a, 0xab, 0x38, 0x29, 0x45, 0x93, 0x08, 0x41, 0xcc, 0x00, 0x20, 0xe7, 0x00, 0x00, 0xdb, 0x18, 0xa3, 0xb0, 0x4a, 0x49, 0x4f, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x7b, 0xcf, 0x04, 0x42, 0x08, 0x64, 0x10, 0x82, 0xbf, 0x00, 0x20, 0xe0, 0x00, 0x20, 0xe3, 0x10, 0x82, 0xc3, 0x29, 0x65, 0x7f, 0x63, 0x2c, 0x23, 0x8c, 0x31, 0x00, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x63, 0x0c, 0x24, 0x18, 0xc3, 0xaf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x18, 0xc3, 0x9f, 0x7b, 0xaf, 0x07, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x63, 0x0c, 0x1c, 0x10, 0x82, 0xc3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf4, 0x29, 0x45, 0x90, 0x6b, 0x4d, 0x0f, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x4a, 0x49, 0x57, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xa8, 0x7b, 0xef, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x6b, 0x4d, 0x10, 0x00, 0x20, 0xd3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xd7, 0x4a, 0x69, 0x33, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x39, 0xa7, 0x5f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x31, 0x86, 0x78, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x18, 0xe3, 0xab, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x52, 0x6a, 0x33, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x63, 0x0c, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xeb, 0x63, 0x0c, 0x1b, 0x8c, 0x31, 0x03, 0x83, 0xf0, 0x03, 0x7b, 0xef, 0x04, 0x8c, 0x51, 0x03, 0x52, 0xaa, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x21, 0xd8, 0x73, 0x6e, 0x0c, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x30, 0x00, 0x21, 0x04, 0xa0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x29, 0x25, 0x9c, 0x6b, 0x6d, 0x17, 0x8c, 0x31, 0x00, 0x84, 0x30, 0x00, 0x84, 0x30, 0x00, 0x84, 0x30, 0x00, 0x84, 0x30, 0x00, 0x8c, 0x51, 0x00, 0x5a, 0xcb, 0x2f, 0x10, 0xa2, 0xbb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x39, 0xc7, 0x68, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x73, 0x6e, 0x08, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb7, 0x4a, 0x49, 0x44, 0x63, 0x0c, 0x20, 0x4a, 0x69, 0x50, 0x31, 0xa6, 0x80, 0x18, 0xc3, 0x9b, 0x18, 0xa3, 0xa7, 0x18, 0xa3, 0xa4, 0x18, 0xe3, 0x93, 0x39, 0xe7, 0x77, 0x5a, 0xab, 0x43, 0x63, 0x0c, 0x1f, 0x41, 0xe8, 0x5c, 0x10, 0x62, 0xd0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x18, 0xe3, 0xb4, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x03, 0x84, 0x30, 0x00, 0x73, 0x8e, 0x1b, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xd3, 0x29, 0x25, 0x80, 0x29, 0x45, 0x77, 0x10, 0x62, 0xbf, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0x10, 0x82, 0xff, 0x10, 0x62, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf3, 0x18, 0xe3, 0xa8, 0x29, 0x65, 0x67, 0x21, 0x04, 0x8f, 0x08, 0x41, 0xe4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x62, 0xcc, 0x7b, 0xcf, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x03, 0x84, 0x30, 0x00, 0x73, 0x6e, 0x13, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x20, 0xe8, 0x10, 0xa2, 0x9f, 0x10, 0xa2, 0x9f, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x18, 0xe3, 0xff, 0x63, 0x0c, 0xff, 0x9c, 0xd3, 0xfb, 0xbd, 0xd7, 0xfb, 0xd6, 0x9a, 0xfb, 0xe6, 0xfc, 0xfb, 0xde, 0xdb, 0xfb, 0xce, 0x59, 0xfb, 0xb5, 0xb6, 0xfb, 0x8c, 0x51, 0xfb, 0x52, 0x6a, 0xff, 0x08, 0x61, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xc8, 0x18, 0xc3, 0x8f, 0x10, 0x82, 0xa8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xc3, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xaf, 0x00, 0x08, 0x41, 0xc8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xa3, 0x20, 0xe4, 0x80, 0x00, 0x20, 0xd3, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xa5, 0x14, 0xfc, 0xe7, 0x1c, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0x39, 0xa7, 0xff, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xde, 0xbb, 0xfc, 0x8c, 0x31, 0xfc, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb4, 0x29, 0x25, 0x73, 0x10, 0x82, 0xbc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x29, 0x25, 0x97, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x31, 0x66, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x41, 0xd3, 0x42, 0x08, 0x47, 0x21, 0x04, 0x7f, 0x00, 0x00, 0xf8, 0x18, 0xa3, 0xff, 0x9c, 0xd3, 0xfb, 0xf7, 0x7e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x00, 0x00, 0xff, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfc, 0xfc, 0x73, 0x8e, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0x39, 0xc7, 0x53, 0x39, 0xc7, 0x63, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x00, 0x20, 0xfb, 0x00, 0x00, 0xff, 0x4a, 0x29, 0x48, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x6b, 0x4d, 0x1f, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf3, 0x31, 0xa6, 0x7f, 0x73, 0x8e, 0x03, 0x31, 0x86, 0x8c, 0x00, 0x00, 0xff, 0x39, 0xe7, 0xfc, 0xd6, 0xba, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x00, 0x00, 0xff, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xb5, 0x96, 0xfc, 0x18, 0xa3, 0xff, 0x00, 0x00, 0xff, 0x52, 0x6a, 0x4f, 0x73, 0x8e, 0x10, 0x20, 0xe4, 0x9b, 0x00, 0x00, 0xff, 0x00, 0x20, 0xd8, 0x73, 0xae, 0x07, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x39, 0xc7, 0x5f, 0x5a, 0xcb, 0x2c, 0x8c, 0x71, 0x00, 0x29, 0x45, 0x90, 0x00, 0x00, 0xff, 0x52, 0x8a, 0xf8, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x29, 0x45, 0xff, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0xfc, 0x21, 0x04, 0xfc, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x4c, 0x94, 0x72, 0x00, 0x4a, 0x69, 0x47, 0x4a, 0x29, 0x48, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x94, 0x92, 0x00, 0x39, 0xc7, 0x63, 0x00, 0x00, 0xff, 0x42, 0x08, 0xfb, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0xfc, 0x18, 0xa3, 0xfc, 0x00, 0x00, 0xf3, 0x62, 0xec, 0x28, 0x94, 0x72, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x04, 0x63, 0x0c, 0x23, 0x00, 0x00, 0xf3, 0x21, 0x04, 0xfb, 0xde, 0xdb, 0xfc, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0xff, 0x18, 0xc3, 0xff, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xfb, 0x00, 0x20, 0xff, 0x10, 0x82, 0xc4, 0x7b, 0xcf, 0x04, 0x84, 0x10, 0x04, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x18, 0xe3, 0xab, 0x00, 0x00, 0xff, 0xad, 0x55, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0x31, 0x86, 0xff, 0x08, 0x21, 0xff, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xbb, 0xff, 0x39, 0xc7, 0xff, 0xce, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x6d, 0xfb, 0x00, 0x00, 0xff, 0x42, 0x08, 0x60, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x62, 0xec, 0x33, 0x00, 0x00, 0xff, 0x52, 0x8a, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x31, 0x86, 0xff, 0x08, 0x21, 0xff, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 0x21, 0x04, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x1c, 0xfc, 0x18, 0xc3, 0xff, 0x08, 0x41, 0xdc, 0x7b, 0xcf, 0x08, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x84, 0x30, 0x00, 0x18, 0xe3, 0xa0, 0x00, 0x00, 0xff, 0xc5, 0xf8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x31, 0xa6, 0xff, 0x08, 0x21, 0xff, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 0x08, 0x61, 0xff, 0xbd, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x10, 0xfc, 0x00, 0x00, 0xff, 0x42, 0x28, 0x58, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x73, 0x6e, 0x13, 0x00, 0x00, 0xef, 0x39, 0xe7, 0xff, 0xf7, 0x9e, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x31, 0x86, 0xff, 0x08, 0x41, 0xff, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0xfb, 0x08, 0x41, 0xff, 0x10, 0x82, 0xb7, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x4a, 0x49, 0x50, 0x00, 0x00, 0xff, 0x8c, 0x51, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x31, 0x86, 0xff, 0x08, 0x41, 0xff, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfc, 0x4a, 0x49, 0xff, 0x00, 0x00, 0xf0, 0x6b, 0x6d, 0x17, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x31, 0x00, 0x29, 0x25, 0x8c, 0x00, 0x00, 0xff, 0xc6, 0x18, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x31, 0x66, 0xff, 0x08, 0x61, 0xff, 0xd6, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x31, 0xfb, 0x00, 0x00, 0xff, 0x4a, 0x69, 0x47, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x10, 0x82, 0xb8, 0x10, 0xa2, 0xff, 0xe7, 0x1c, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0x31, 0x66, 0xff, 0x08, 0x61, 0xff, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xbd, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xb6, 0xf8, 0x00, 0x00, 0xff, 0x39, 0xc7, 0x74, 0x8c, 0x51, 0x00, 0x7b, 0xef, 0x03, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x73, 0xae, 0x00, 0x00, 0x20, 0xd3, 0x31, 0x66, 0xff, 0xf7, 0x9e, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0x29, 0x65, 0xff, 0x10, 0x82, 0xff, 0x7b, 0xaf, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0xfb, 0x00, 0x00, 0xff, 0x20, 0xe4, 0x93, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x73, 0x8e, 0x08, 0x00, 0x00, 0xdf, 0x52, 0x6a, 0xff, 0xde, 0xfb, 0xfc, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0xff, 0x10, 0x62, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0x82, 0xff, 0xb5, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0x63, 0x2c, 0xff, 0x63, 0x0c, 0xff, 0x63, 0x0c, 0xff, 0x83, 0xf0, 0xff, 0xde, 0xfb, 0xfb, 0x10, 0x82, 0xff, 0x10, 0x82, 0xa4, 0x84, 0x30, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x73, 0xae, 0x0b, 0x00, 0x00, 0xe0, 0x52, 0xaa, 0xff, 0xd6, 0x9a, 0xfc, 0x20, 0xe4, 0xff, 0x21, 0x04, 0xff, 0x18, 0xe3, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x10, 0xa2, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x52, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfc, 0xff, 0x21, 0x04, 0xff, 0x20, 0xe4, 0xff, 0x18, 0xe3, 0xff, 0x4a, 0x29, 0xff, 0xe6, 0xfc, 0xfb, 0x10, 0x82, 0xff, 0x10, 0xa2, 0xa7, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 
-  0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x73, 0x8e, 0x04, 0x00, 0x00, 0xdb, 0x42, 0x08, 0xff, 0xf7, 0x9e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x51, 0xff, 0x08, 0x21, 0xff, 0x18, 0xa3, 0xff, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0xf8, 0x08, 0x41, 0xff, 0x10, 0x82, 0x9f, 0x84, 0x30, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x00, 0x08, 0x41, 0xcb, 0x21, 0x04, 0xff, 0xef, 0x5d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x18, 0xf8, 0x00, 0x00, 0xff, 0x31, 0x66, 0x87, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x18, 0xa3, 0xa7, 0x08, 0x41, 0xff, 0xd6, 0xba, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x14, 0xfb, 0x00, 0x00, 0xff, 0x42, 0x08, 0x60, 0x8c, 0x51, 0x00, 0x7b, 0xef, 0x03, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x39, 0xa7, 0x73, 0x00, 0x00, 0xff, 0xad, 0x75, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x6d, 0xfc, 0x00, 0x00, 0xff, 0x5a, 0xeb, 0x30, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x5a, 0xcb, 0x33, 0x00, 0x00, 0xfc, 0x6b, 0x4d, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xfc, 0x29, 0x45, 0xff, 0x00, 0x00, 0xdb, 0x7b, 0xaf, 0x07, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xcf, 0x03, 0x00, 0x20, 0xd3, 0x18, 0xc3, 0xff, 0xe7, 0x1c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xb6, 0xfb, 0x00, 0x00, 0xff, 0x29, 0x25, 0x90, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x39, 0xc7, 0x6f, 0x00, 0x00, 0xff, 0x94, 0x92, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0x52, 0x8a, 0xfc, 0x00, 0x00, 0xfb, 0x62, 0xec, 0x2c, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x73, 0xae, 0x0f, 0x00, 0x20, 0xe7, 0x21, 0x04, 0xfc, 0xe7, 0x1c, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xb7, 0xfb, 0x00, 0x00, 0xff, 0x18, 0xe3, 0xac, 0x8c, 0x31, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x39, 0xc7, 0x68, 0x00, 0x00, 0xff, 0x6b, 0x4d, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x5d, 0xfc, 0x31, 0x86, 0xfc, 0x00, 0x00, 0xf8, 0x62, 0xec, 0x2b, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x83, 0xf0, 0x00, 0x10, 0x82, 0xc0, 0x00, 0x00, 0xff, 0xa4, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0x63, 0x2c, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x86, 0x7c, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x63, 0x0c, 0x1f, 0x00, 0x00, 0xe8, 0x10, 0x62, 0xff, 0xb5, 0xb6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xad, 0x35, 0xff, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0x84, 0x10, 0xf8, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb8, 0x7b, 0xcf, 0x00, 0x84, 0x10, 0x03, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x5a, 0xab, 0x3b, 0x00, 0x00, 0xf4, 0x10, 0x82, 0xff, 0xad, 0x75, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x00, 0x00, 0xff, 0x8c, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0x7b, 0xcf, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0xcf, 0x73, 0x8e, 0x10, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x5a, 0xab, 0x3f, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x84, 0x10, 0xfc, 0xef, 0x5d, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x08, 0x41, 0xff, 0x94, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xdb, 0xff, 0x52, 0xaa, 0xfc, 0x00, 0x00, 0xff, 0x10, 0x62, 0xc8, 0x73, 0x8e, 0x14, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x5a, 0xcb, 0x2c, 0x08, 0x61, 0xd3, 0x00, 0x00, 0xfc, 0x39, 0xc7, 0xfc, 0xb5, 0x96, 0xfc, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x00, 0x00, 0xff, 0x8c, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3d, 0xfc, 0x94, 0x92, 0xfc, 0x18, 0xe3, 0xfc, 0x00, 0x00, 0xff, 0x20, 0xe4, 0xa8, 0x73, 0x8e, 0x0f, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x04, 0x83, 0xf0, 0x00, 0x10, 0x62, 0xcb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x42, 0x08, 0xff, 0x9c, 0xb3, 0xfb, 0xd6, 0x9a, 0xfb, 0xef, 0x7d, 0xfc, 0xff, 0xdf, 0xfc, 0xff, 0xdf, 0xff, 0xa5, 0x14, 0xff, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfc, 0xef, 0x5d, 0xfc, 0xc6, 0x18, 0xfb, 0x84, 0x10, 0xfb, 0x29, 0x25, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x04, 0x97, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x31, 0xa6, 0x6f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0x18, 0xe3, 0xab, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x31, 0xa6, 0xff, 0x5a, 0xab, 0xff, 0x7b, 0xcf, 0xff, 0x9c, 0xd3, 0xff, 0x94, 0x72, 0xff, 0x6b, 0x6d, 0xff, 0x52, 0x6a, 0xff, 0x21, 0x24, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd8, 0x20, 0xe4, 0xa8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x52, 0x6a, 0x3b, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x6b, 0x2d, 0x18, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x18, 0xe3, 0x93, 0x84, 0x30, 0x00, 0x6b, 0x4d, 0x1c, 0x42, 0x08, 0x63, 0x18, 0xc3, 0xa8, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x00, 0x00, 0xd0, 0x21, 0x24, 0x98, 0x52, 0x6a, 0x4f, 0x7b, 0xaf, 0x0b, 0x83, 0xf0, 0x00, 0x08, 0x61, 0xc8, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x18, 0xa3, 0xbf, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x51, 0x00, 0x4a, 0x29, 0x44, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x6b, 0x4d, 0x14, 0x8c, 0x31, 0x03, 0x84, 0x30, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x30, 0x00, 0x7b, 0xaf, 0x03, 0x6b, 0x6d, 0x1b, 0x52, 0xaa, 0x2f, 0x5a, 0xab, 0x3b, 0x52, 0xaa, 0x38, 0x5a, 0xab, 0x2b, 0x73, 0x8e, 0x14, 0x7b, 0xcf, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x51, 0x00, 0x4a, 0x49, 0x3b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x6b, 0x2d, 0x18, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xcf, 0x08, 0x21, 0x04, 0x98, 0x00, 0x00, 0xdc, 0x41, 0xe8, 0x57, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x30, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x29, 0x45, 0x84, 0x00, 0x20, 0xdc, 0x29, 0x65, 0x73, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x8c, 0x51, 0x00, 0x7b, 0xcf, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x71, 0x00, 0x7b, 0xcf, 0x00, 0x94, 0x72, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xb1, 0x00, 0x00, 0x00, 0x01, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x03, 0x83, 0xf0, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x83, 
+  0xf0, 0x03, 0x84, 0x10, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x04, 0x93, 0x00, 0x00, 0x00, 0x01, 0x73, 0x8e, 0x0c, 0x73, 0x8e, 0x07, 0x8f, 0x00, 0x00, 0x00, 0x81, 0x73, 0x8e, 0x0b, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x81, 0x00, 0x00, 0x00, 0x06, 0x5a, 0xab, 0x38, 0x29, 0x45, 0x93, 0x08, 0x41, 0xcc, 0x00, 0x20, 
+  0xe7, 0x00, 0x00, 0xdb, 0x18, 0xa3, 0xb0, 0x4a, 0x49, 0x4f, 0x8a, 0x00, 0x00, 0x00, 0x07, 0x7b, 0xcf, 0x04, 0x42, 0x08, 0x64, 0x10, 0x82, 0xbf, 0x00, 0x20, 0xe0, 0x00, 0x20, 0xe3, 0x10, 0x82, 
+  0xc3, 0x29, 0x65, 0x7f, 0x63, 0x2c, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x88, 0x00, 0x00, 0x00, 0x03, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x63, 0x0c, 0x24, 0x18, 0xc3, 0xaf, 
+  0x86, 0x00, 0x00, 0xff, 0x01, 0x18, 0xc3, 0x9f, 0x7b, 0xaf, 0x07, 0x87, 0x00, 0x00, 0x00, 0x01, 0x63, 0x0c, 0x1c, 0x10, 0x82, 0xc3, 0x85, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xf4, 0x29, 0x45, 
+  0x90, 0x6b, 0x4d, 0x0f, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x86, 0x00, 0x00, 0x00, 0x06, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x57, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xa8, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 
+  0x6b, 0x4d, 0x10, 0x00, 0x20, 0xd3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x01, 0x08, 0x21, 0xd7, 0x4a, 
+  0x69, 0x33, 0x88, 0x00, 0x00, 0x00, 0x00, 0x39, 0xa7, 0x5f, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x31, 0x86, 0x78, 
+  0x84, 0x00, 0x00, 0x00, 0x03, 0x83, 0xf0, 0x03, 0x18, 0xe3, 0xab, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x86, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x52, 
+  0x6a, 0x33, 0x86, 0x00, 0x00, 0x00, 0x03, 0x63, 0x0c, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xeb, 0x63, 0x0c, 0x1b, 0x8c, 0x31, 0x03, 0x83, 0xf0, 0x03, 0x7b, 0xef, 0x04, 0x8c, 0x51, 0x03, 0x52, 0xaa, 0x3c, 0x81, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x86, 
+  0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x21, 0xd8, 0x73, 0x6e, 0x0c, 0x83, 0x00, 0x00, 0x00, 0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x21, 0x04, 0xa0, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0xf8, 0x85, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x01, 0x29, 0x25, 0x9c, 0x6b, 0x6d, 0x17, 0x85, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xcb, 0x2f, 0x10, 
+  0xa2, 0xbb, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x39, 0xc7, 0x68, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x82, 0x00, 
+  0x00, 0x00, 0x03, 0x73, 0x6e, 0x08, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x84, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x0d, 0x10, 0x82, 0xb7, 0x4a, 
+  0x49, 0x44, 0x63, 0x0c, 0x20, 0x4a, 0x69, 0x50, 0x31, 0xa6, 0x80, 0x18, 0xc3, 0x9b, 0x18, 0xa3, 0xa7, 0x18, 0xa3, 0xa4, 0x18, 0xe3, 0x93, 0x39, 0xe7, 0x77, 0x5a, 0xab, 0x43, 0x63, 0x0c, 0x1f, 
+  0x41, 0xe8, 0x5c, 0x10, 0x62, 0xd0, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x84, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x18, 0xe3, 0xb4, 0x82, 0x00, 0x00, 0x00, 
+  0x05, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x73, 0x8e, 0x1b, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x82, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x04, 
+  0x08, 0x41, 0xd3, 0x29, 0x25, 0x80, 0x29, 0x45, 0x77, 0x10, 0x62, 0xbf, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x02, 0x00, 0x20, 0xff, 0x10, 0x82, 0xff, 0x10, 0x62, 0xff, 0x82, 0x00, 0x00, 
+  0xff, 0x04, 0x00, 0x00, 0xf3, 0x18, 0xe3, 0xa8, 0x29, 0x65, 0x67, 0x21, 0x04, 0x8f, 0x08, 0x41, 0xe4, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x82, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 
+  0xfb, 0x00, 0x00, 0xff, 0x10, 0x62, 0xcc, 0x82, 0x00, 0x00, 0x00, 0x06, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x73, 0x6e, 0x13, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 
+  0xff, 0x81, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xff, 0x00, 0x20, 0xe8, 0x81, 0x10, 0xa2, 0x9f, 0x19, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x18, 0xe3, 0xff, 0x63, 0x0c, 0xff, 0x9c, 0xd3, 0xfb, 
+  0xbd, 0xd7, 0xfb, 0xd6, 0x9a, 0xfb, 0xe6, 0xfc, 0xfb, 0xde, 0xdb, 0xfb, 0xce, 0x59, 0xfb, 0xb5, 0xb6, 0xfb, 0x8c, 0x51, 0xfb, 0x52, 0x6a, 0xff, 0x08, 0x61, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 
+  0xc8, 0x18, 0xc3, 0x8f, 0x10, 0x82, 0xa8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xc3, 0x85, 
+  0x00, 0x00, 0x00, 0x01, 0x08, 0x41, 0xc8, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x07, 0x10, 0xa2, 0xa3, 0x20, 0xe4, 0x80, 0x00, 0x20, 0xd3, 0x00, 0x00, 0xff, 0x39, 
+  0xc7, 0xff, 0xa5, 0x14, 0xfc, 0xe7, 0x1c, 0xfc, 0xff, 0xdf, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xbe, 0xff, 0x39, 0xa7, 0xff, 0xa5, 0x14, 0xff, 0x82, 0xff, 0xff, 0xff, 0x07, 0xff, 0xbf, 
+  0xff, 0xde, 0xbb, 0xfc, 0x8c, 0x31, 0xfc, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb4, 0x29, 0x25, 0x73, 0x10, 0x82, 0xbc, 0x81, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xfb, 0x00, 0x00, 
+  0xf8, 0x00, 0x00, 0xff, 0x29, 0x25, 0x97, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x81, 0x00, 0x00, 0x00, 0x0d, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x31, 0x66, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xff, 0x08, 0x41, 0xd3, 0x42, 0x08, 0x47, 0x21, 0x04, 0x7f, 0x00, 0x00, 0xf8, 0x18, 0xa3, 0xff, 0x9c, 0xd3, 0xfb, 0xf7, 0x7e, 0xfc, 0xff, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xff, 
+  0x81, 0xff, 0xff, 0xff, 0x05, 0xf7, 0x7e, 0xff, 0x00, 0x00, 0xff, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x0d, 0xff, 0xff, 0xff, 0xe6, 
+  0xfc, 0xfc, 0x73, 0x8e, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0x39, 0xc7, 0x53, 0x39, 0xc7, 0x63, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x00, 0x20, 0xfb, 0x00, 0x00, 0xff, 0x4a, 0x29, 0x48, 
+  0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x83, 0x00, 0x00, 0x00, 0x0a, 0x6b, 0x4d, 0x1f, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf3, 0x31, 0xa6, 0x7f, 0x73, 0x8e, 0x03, 0x31, 0x86, 0x8c, 0x00, 0x00, 0xff, 
+  0x39, 0xe7, 0xfc, 0xd6, 0xba, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x04, 0xf7, 0x9e, 0xff, 0x00, 0x00, 0xff, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 
+  0x83, 0xff, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x08, 0xb5, 0x96, 0xfc, 0x18, 0xa3, 0xff, 0x00, 0x00, 0xff, 0x52, 0x6a, 0x4f, 0x73, 0x8e, 0x10, 0x20, 0xe4, 0x9b, 0x00, 0x00, 0xff, 0x00, 0x20, 
+  0xd8, 0x73, 0xae, 0x07, 0x86, 0x00, 0x00, 0x00, 0x08, 0x39, 0xc7, 0x5f, 0x5a, 0xcb, 0x2c, 0x00, 0x00, 0x00, 0x29, 0x45, 0x90, 0x00, 0x00, 0xff, 0x52, 0x8a, 0xf8, 0xef, 0x5d, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xdf, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0xf7, 0x9e, 0xff, 0x29, 0x45, 0xff, 0x9c, 0xf3, 0xff, 0x86, 0xff, 0xff, 0xff, 0x08, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0xfc, 
+  0x21, 0x04, 0xfc, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x4c, 0x00, 0x00, 0x00, 0x4a, 0x69, 0x47, 0x4a, 0x29, 0x48, 0x89, 0x00, 0x00, 0x00, 0x05, 0x39, 0xc7, 0x63, 0x00, 0x00, 0xff, 0x42, 0x08, 0xfb, 
+  0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x87, 0xff, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x87, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0xfc, 0x18, 
+  0xa3, 0xfc, 0x00, 0x00, 0xf3, 0x62, 0xec, 0x28, 0x89, 0x00, 0x00, 0x00, 0x0a, 0x84, 0x30, 0x04, 0x63, 0x0c, 0x23, 0x00, 0x00, 0xf3, 0x21, 0x04, 0xfb, 0xde, 0xdb, 0xfc, 0xff, 0xff, 0xff, 0xbd, 
+  0xf7, 0xff, 0x18, 0xc3, 0xff, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x06, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xfb, 0x00, 0x20, 0xff, 0x10, 
+  0x82, 0xc4, 0x7b, 0xcf, 0x04, 0x84, 0x10, 0x04, 0x88, 0x00, 0x00, 0x00, 0x08, 0x18, 0xe3, 0xab, 0x00, 0x00, 0xff, 0xad, 0x55, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0x31, 
+  0x86, 0xff, 0x08, 0x21, 0xff, 0xce, 0x59, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xbb, 0xff, 0x39, 0xc7, 0xff, 0xce, 0x39, 0xff, 0x81, 0xff, 0xff, 0xff, 
+  0x06, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x6d, 0xfb, 0x00, 0x00, 0xff, 0x42, 0x08, 0x60, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x86, 0x00, 0x00, 0x00, 0x02, 0x62, 0xec, 0x33, 0x00, 0x00, 
+  0xff, 0x52, 0x8a, 0xfc, 0x81, 0xff, 0xdf, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0xf7, 0x9e, 0xff, 0x31, 0x86, 0xff, 0x08, 0x21, 0xff, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x88, 
+  0xff, 0xff, 0xff, 0x04, 0xde, 0xdb, 0xff, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 0x21, 0x04, 0xff, 0xf7, 0x9e, 0xff, 0x81, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xff, 0xe7, 0x1c, 0xfc, 0x18, 0xc3, 
+  0xff, 0x08, 0x41, 0xdc, 0x7b, 0xcf, 0x08, 0x85, 0x00, 0x00, 0x00, 0x04, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x18, 0xe3, 0xa0, 0x00, 0x00, 0xff, 0xc5, 0xf8, 0xfb, 0x84, 0xff, 0xff, 0xff, 0x03, 
+  0xf7, 0x9e, 0xff, 0x31, 0xa6, 0xff, 0x08, 0x21, 0xff, 0xce, 0x59, 0xff, 0x86, 0xff, 0xff, 0xff, 0x06, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 
+  0x08, 0x61, 0xff, 0xbd, 0xb7, 0xff, 0x84, 0xff, 0xff, 0xff, 0x04, 0x84, 0x10, 0xfc, 0x00, 0x00, 0xff, 0x42, 0x28, 0x58, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 0x73, 
+  0x6e, 0x13, 0x00, 0x00, 0xef, 0x39, 0xe7, 0xff, 0xf7, 0x9e, 0xfc, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x05, 0xf7, 0x9e, 0xff, 0x31, 0x86, 0xff, 0x08, 0x41, 0xff, 0xce, 0x79, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x04, 0xde, 0xdb, 0xff, 0x20, 0xe4, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xbd, 0xf7, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0xd6, 0x9a, 
+  0xfb, 0x08, 0x41, 0xff, 0x10, 0x82, 0xb7, 0x84, 0x00, 0x00, 0x00, 0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x50, 0x00, 0x00, 0xff, 0x8c, 0x51, 0xfb, 0x87, 0xff, 0xff, 0xff, 0x03, 
+  0xf7, 0x7e, 0xff, 0x31, 0x86, 0xff, 0x08, 0x41, 0xff, 0xce, 0x79, 0xff, 0x82, 0xff, 0xff, 0xff, 0x08, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 
+  0x08, 0x41, 0xff, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x03, 0xff, 0xbf, 0xfc, 0x4a, 0x49, 0xff, 0x00, 0x00, 0xf0, 0x6b, 0x6d, 0x17, 0x83, 0x00, 0x00, 
+  0x00, 0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x29, 0x25, 0x8c, 0x00, 0x00, 0xff, 0xc6, 0x18, 0xf8, 0x88, 0xff, 0xff, 0xff, 0x0d, 0xf7, 0x7e, 0xff, 0x31, 0x66, 0xff, 0x08, 0x61, 0xff, 0xd6, 
+  0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 
+  0x86, 0xff, 0xff, 0xff, 0x04, 0x8c, 0x31, 0xfb, 0x00, 0x00, 0xff, 0x4a, 0x69, 0x47, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x83, 0x00, 0x00, 0x00, 0x05, 0x10, 0x82, 0xb8, 0x10, 0xa2, 0xff, 0xe7, 
+  0x1c, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x0b, 0xef, 0x7d, 0xff, 0x31, 0x66, 0xff, 0x08, 0x61, 0xff, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff, 0xde, 
+  0xdb, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xbd, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x05, 0xff, 0xff, 0xff, 
+  0xb5, 0xb6, 0xf8, 0x00, 0x00, 0xff, 0x39, 0xc7, 0x74, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0xd3, 0x31, 0x66, 0xff, 0xf7, 0x9e, 0xfb, 0x8a, 0xff, 0xff, 
+  0xff, 0x09, 0xef, 0x7d, 0xff, 0x29, 0x65, 0xff, 0x10, 0x82, 0xff, 0x7b, 0xaf, 0xff, 0x21, 0x04, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0x04, 0xce, 0x59, 0xfb, 0x00, 0x00, 0xff, 0x20, 0xe4, 0x93, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x82, 0x00, 0x00, 0x00, 0x03, 0x73, 0x8e, 0x08, 0x00, 0x00, 0xdf, 0x52, 
+  0x6a, 0xff, 0xde, 0xfb, 0xfc, 0x82, 0x63, 0x0c, 0xff, 0x00, 0x9c, 0xf3, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xe7, 0x3c, 0xff, 0x10, 0x62, 0xff, 0x81, 0x00, 0x00, 0xff, 0x03, 0x10, 0x82, 0xff, 
+  0xb5, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xef, 0x5d, 0xff, 0x63, 0x2c, 0xff, 0x81, 0x63, 0x0c, 0xff, 0x05, 0x83, 0xf0, 0xff, 0xde, 0xfb, 0xfb, 0x10, 
+  0x82, 0xff, 0x10, 0x82, 0xa4, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x82, 0x00, 0x00, 0x00, 0x07, 0x73, 0xae, 0x0b, 0x00, 0x00, 0xe0, 0x52, 0xaa, 0xff, 0xd6, 0x9a, 0xfc, 0x20, 0xe4, 0xff, 0x21, 
+  0x04, 0xff, 0x18, 0xe3, 0xff, 0x73, 0x8e, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xff, 0x10, 0xa2, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0x52, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 
+  0xff, 0x85, 0xff, 0xff, 0xff, 0x07, 0xe6, 0xfc, 0xff, 0x21, 0x04, 0xff, 0x20, 0xe4, 0xff, 0x18, 0xe3, 0xff, 0x4a, 0x29, 0xff, 0xe6, 0xfc, 0xfb, 0x10, 0x82, 0xff, 0x10, 0xa2, 0xa7, 0x84, 0x00, 
+  0x00, 0x00, 0x03, 0x73, 0x8e, 0x04, 0x00, 0x00, 0xdb, 0x42, 0x08, 0xff, 0xf7, 0x9e, 0xfc, 0x8c, 0xff, 0xff, 0xff, 0x03, 0x8c, 0x51, 0xff, 0x08, 0x21, 0xff, 0x18, 0xa3, 0xff, 0xc6, 0x18, 0xff, 
+  0x8c, 0xff, 0xff, 0xff, 0x04, 0xd6, 0xba, 0xf8, 0x08, 0x41, 0xff, 0x10, 0x82, 0x9f, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x08, 0x41, 0xcb, 0x21, 0x04, 0xff, 0xef, 
+  0x5d, 0xfb, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xe7, 0x1c, 0xff, 0xef, 0x7d, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x04, 0xc6, 0x18, 0xf8, 0x00, 0x00, 0xff, 0x31, 0x66, 0x87, 0x00, 0x00, 0x00, 0x83, 0xf0, 
+  0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x18, 0xa3, 0xa7, 0x08, 0x41, 0xff, 0xd6, 0xba, 0xfb, 0x9d, 0xff, 0xff, 0xff, 0x04, 0xa5, 0x14, 0xfb, 0x00, 0x00, 0xff, 0x42, 0x08, 0x60, 0x00, 0x00, 0x00, 
+  0x7b, 0xef, 0x03, 0x81, 0x00, 0x00, 0x00, 0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x39, 0xa7, 0x73, 0x00, 0x00, 0xff, 0xad, 0x75, 0xfb, 0x9d, 0xff, 0xff, 0xff, 0x02, 0x6b, 0x6d, 0xfc, 0x00, 
+  0x00, 0xff, 0x5a, 0xeb, 0x30, 0x83, 0x00, 0x00, 0x00, 0x05, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x5a, 0xcb, 0x33, 0x00, 0x00, 0xfc, 0x6b, 0x4d, 0xfc, 0xff, 0xdf, 0xff, 0x9b, 0xff, 0xff, 0xff, 
+  0x03, 0xef, 0x5d, 0xfc, 0x29, 0x45, 0xff, 0x00, 0x00, 0xdb, 0x7b, 0xaf, 0x07, 0x85, 0x00, 0x00, 0x00, 0x03, 0x7b, 0xcf, 0x03, 0x00, 0x20, 0xd3, 0x18, 0xc3, 0xff, 0xe7, 0x1c, 0xfc, 0x9b, 0xff, 
+  0xff, 0xff, 0x04, 0xb5, 0xb6, 0xfb, 0x00, 0x00, 0xff, 0x29, 0x25, 0x90, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x83, 0x00, 0x00, 0x00, 0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x6f, 
+  0x00, 0x00, 0xff, 0x94, 0x92, 0xfb, 0x99, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0x52, 0x8a, 0xfc, 0x00, 0x00, 0xfb, 0x62, 0xec, 0x2c, 0x87, 0x00, 0x00, 0x00, 0x04, 0x73, 
+  0xae, 0x0f, 0x00, 0x20, 0xe7, 0x21, 0x04, 0xfc, 0xe7, 0x1c, 0xfc, 0xff, 0xdf, 0xff, 0x98, 0xff, 0xff, 0xff, 0x02, 0xbd, 0xb7, 0xfb, 0x00, 0x00, 0xff, 0x18, 0xe3, 0xac, 0x87, 0x00, 0x00, 0x00, 
+  0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x68, 0x00, 0x00, 0xff, 0x6b, 0x4d, 0xfb, 0x81, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0xff, 
+  0x04, 0xff, 0xbf, 0xff, 0xef, 0x5d, 0xfc, 0x31, 0x86, 0xfc, 0x00, 0x00, 0xf8, 0x62, 0xec, 0x2b, 0x88, 0x00, 0x00, 0x00, 0x06, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x10, 0x82, 0xc0, 0x00, 0x00, 
+  0xff, 0xa4, 0xf4, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x93, 0xff, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x04, 0x63, 0x2c, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x86, 0x7c, 0x00, 0x00, 0x00, 0x83, 
+  0xf0, 0x03, 0x89, 0x00, 0x00, 0x00, 0x05, 0x63, 0x0c, 0x1f, 0x00, 0x00, 0xe8, 0x10, 0x62, 0xff, 0xb5, 0xb6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 
+  0xff, 0xad, 0x35, 0xff, 0xd6, 0xba, 0xff, 0x87, 0xff, 0xff, 0xff, 0x06, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0x84, 0x10, 0xf8, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb8, 0x00, 0x00, 0x00, 0x84, 0x10, 
+  0x03, 0x89, 0x00, 0x00, 0x00, 0x07, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x3b, 0x00, 0x00, 0xf4, 0x10, 0x82, 0xff, 0xad, 0x75, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x85, 0xff, 
+  0xff, 0xff, 0x04, 0xf7, 0x7e, 0xff, 0x00, 0x00, 0xff, 0x8c, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0x7b, 0xcf, 0xfb, 
+  0x00, 0x00, 0xff, 0x10, 0x82, 0xcf, 0x73, 0x8e, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x06, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x5a, 0xab, 0x3f, 0x00, 0x00, 0xec, 0x00, 0x00, 0xff, 0x84, 0x10, 0xfc, 
+  0xef, 0x5d, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xf7, 0x9e, 0xff, 0x08, 0x41, 0xff, 0x94, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x81, 0xff, 0xff, 0xff, 0x82, 
+  0xff, 0xdf, 0xff, 0x04, 0xde, 0xdb, 0xff, 0x52, 0xaa, 0xfc, 0x00, 0x00, 0xff, 0x10, 0x62, 0xc8, 0x73, 0x8e, 0x14, 0x8e, 0x00, 0x00, 0x00, 0x07, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x5a, 0xcb, 
+  0x2c, 0x08, 0x61, 0xd3, 0x00, 0x00, 0xfc, 0x39, 0xc7, 0xfc, 0xb5, 0x96, 0xfc, 0xf7, 0x9e, 0xff, 0x81, 0xff, 0xff, 0xff, 0x06, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x00, 0x00, 
+  0xff, 0x8c, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x05, 0xef, 0x3d, 0xfc, 0x94, 0x92, 0xfc, 0x18, 0xe3, 0xfc, 0x00, 0x00, 0xff, 0x20, 0xe4, 0xa8, 0x73, 0x8e, 
+  0x0f, 0x90, 0x00, 0x00, 0x00, 0x19, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x10, 0x62, 0xcb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x42, 0x08, 0xff, 0x9c, 0xb3, 0xfb, 0xd6, 0x9a, 
+  0xfb, 0xef, 0x7d, 0xfc, 0xff, 0xdf, 0xfc, 0xff, 0xdf, 0xff, 0xa5, 0x14, 0xff, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfc, 0xef, 0x5d, 0xfc, 0xc6, 0x18, 0xfb, 0x84, 0x10, 0xfb, 0x29, 
+  0x25, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x04, 0x97, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x11, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x31, 
+  0xa6, 0x6f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0x18, 0xe3, 0xab, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x31, 0xa6, 0xff, 0x5a, 0xab, 0xff, 0x7b, 0xcf, 0xff, 
+  0x9c, 0xd3, 0xff, 0x94, 0x72, 0xff, 0x6b, 0x6d, 0xff, 0x52, 0x6a, 0xff, 0x21, 0x24, 0xff, 0x81, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xd8, 0x20, 0xe4, 0xa8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 
+  0x00, 0x00, 0xff, 0x52, 0x6a, 0x3b, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x0a, 0x6b, 0x2d, 0x18, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x18, 0xe3, 0x93, 
+  0x00, 0x00, 0x00, 0x6b, 0x4d, 0x1c, 0x42, 0x08, 0x63, 0x18, 0xc3, 0xa8, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xf4, 0x83, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xef, 0x00, 0x00, 0xd0, 0x21, 0x24, 0x98, 
+  0x52, 0x6a, 0x4f, 0x7b, 0xaf, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x61, 0xc8, 0x81, 0x00, 0x00, 0xfc, 0x01, 0x18, 0xa3, 0xbf, 0x83, 0xf0, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x7b, 0xef, 0x03, 0x00, 
+  0x00, 0x00, 0x4a, 0x29, 0x44, 0x81, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xef, 0x6b, 0x4d, 0x14, 0x8c, 0x31, 0x03, 0x82, 0x00, 0x00, 0x00, 0x06, 0x7b, 0xaf, 0x03, 0x6b, 0x6d, 0x1b, 0x52, 0xaa, 
+  0x2f, 0x5a, 0xab, 0x3b, 0x52, 0xaa, 0x38, 0x5a, 0xab, 0x2b, 0x73, 0x8e, 0x14, 0x84, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x49, 0x3b, 0x82, 0x00, 0x00, 0xff, 0x00, 0x6b, 0x2d, 0x18, 0x8f, 0x00, 0x00, 
+  0x00, 0x08, 0x7b, 0xcf, 0x08, 0x21, 0x04, 0x98, 0x00, 0x00, 0xdc, 0x41, 0xe8, 0x57, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x03, 0x87, 0x00, 0x00, 
+  0x00, 0x81, 0x83, 0xf0, 0x03, 0x05, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x29, 0x45, 0x84, 0x00, 0x20, 0xdc, 0x29, 0x65, 0x73, 0x9c, 0x00, 0x00, 0x00, 0x81, 0x83, 0xf0, 0x03, 
+  0x93, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7e, 0x7e, 0x7e, 0x04, 0x82, 0x82, 0x82, 0x00, 0x83, 0x83, 0x83, 0x00, 0x83, 0x83, 0x83, 0x00, 0x80, 0x80, 0x80, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x03, 0x83, 0x83, 0x83, 0x00, 0x83, 0x83, 0x83, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7e, 0x7e, 0x7e, 0x04, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x76, 0x76, 0x76, 0x00, 0x71, 0x71, 0x71, 0x0c, 0x71, 0x71, 0x71, 0x07, 0x7e, 0x7e, 0x7e, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x82, 0x82, 0x82, 0x00, 0x89, 0x89, 0x89, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x71, 0x71, 0x71, 0x0b, 0x71, 0x71, 0x71, 0x0b, 0x7b, 0x7b, 0x7b, 0x00, 0x88, 0x88, 0x88, 0x00, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x85, 0x85, 0x85, 0x00, 0x81, 0x81, 0x81, 0x00, 0x55, 0x55, 0x55, 0x38, 0x2a, 0x2a, 0x2a, 0x93, 0x09, 0x09, 0x09, 0xcc, 0x03, 0x03, 0x03, 0xe7, 0x02, 0x02, 0x02, 0xdb, 0x16, 0x16, 0x16, 0xb0, 0x48, 0x48, 0x48, 0x4f, 0x7e, 0x7e, 0x7e, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x85, 0x85, 0x85, 0x00, 0x79, 0x79, 0x79, 0x04, 0x40, 0x40, 0x40, 0x64, 0x12, 0x12, 0x12, 0xbf, 0x03, 0x03, 0x03, 0xe0, 0x03, 0x03, 0x03, 0xe3, 0x0f, 0x0f, 0x0f, 0xc3, 0x2b, 0x2b, 0x2b, 0x7f, 0x64, 0x64, 0x64, 0x23, 0x86, 0x86, 0x86, 0x00, 0x83, 0x83, 0x83, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x87, 0x87, 0x87, 0x00, 0x60, 0x60, 0x60, 0x24, 0x18, 0x18, 0x18, 0xaf, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x1a, 0x1a, 0x9f, 0x76, 0x76, 0x76, 0x07, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x86, 0x86, 0x86, 0x00, 0x61, 0x61, 0x61, 0x1c, 0x11, 0x11, 0x11, 0xc3, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf4, 0x29, 0x29, 0x29, 0x90, 0x6a, 0x6a, 0x6a, 0x0f, 0x88, 0x88, 0x88, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x87, 0x87, 0x87, 0x00, 0x48, 0x48, 0x48, 0x57, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xa8, 0x7b, 0x7b, 0x7b, 0x00, 0x81, 0x81, 0x81, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x85, 0x85, 0x85, 0x00, 0x6a, 0x6a, 0x6a, 0x10, 0x04, 0x04, 0x04, 0xd3, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x05, 0x05, 0x05, 0xd7, 0x4b, 0x4b, 0x4b, 0x33, 0x88, 0x88, 0x88, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x86, 0x86, 0x86, 0x00, 0x36, 0x36, 0x36, 0x5f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x30, 0x30, 0x30, 0x78, 0x85, 0x85, 0x85, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x1c, 0x1c, 0x1c, 0xab, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf0, 0x4d, 0x4d, 0x4d, 0x33, 0x88, 0x88, 0x88, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x5f, 0x5f, 0x5f, 0x28, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xeb, 0x62, 0x62, 0x62, 0x1b, 0x85, 0x85, 0x85, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7c, 0x7c, 0x7c, 0x04, 0x87, 0x87, 0x87, 0x03, 0x53, 0x53, 0x53, 0x3c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x06, 0x06, 0x06, 0xd8, 0x6e, 0x6e, 0x6e, 0x0c, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x83, 0x83, 0x83, 0x00, 0x1f, 0x1f, 0x1f, 0xa0, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x25, 0x25, 0x25, 0x9c, 0x6b, 0x6b, 0x6b, 0x17, 0x85, 0x85, 0x85, 0x00, 0x84, 0x84, 0x84, 0x00, 0x84, 0x84, 0x84, 0x00, 0x84, 0x84, 0x84, 0x00, 0x84, 0x84, 0x84, 0x00, 0x87, 0x87, 0x87, 0x00, 0x59, 0x59, 0x59, 0x2f, 0x13, 0x13, 0x13, 0xbb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x37, 0x37, 0x37, 0x68, 0x89, 0x89, 0x89, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 
-  0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x00, 0x6e, 0x6e, 0x6e, 0x08, 0x01, 0x01, 0x01, 0xdf, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x12, 0x12, 0xb7, 0x48, 0x48, 0x48, 0x44, 0x62, 0x62, 0x62, 0x20, 0x4b, 0x4b, 0x4b, 0x50, 0x34, 0x34, 0x34, 0x80, 0x17, 0x17, 0x17, 0x9b, 0x15, 0x15, 0x15, 0xa7, 0x15, 0x15, 0x15, 0xa4, 0x1b, 0x1b, 0x1b, 0x93, 0x3c, 0x3c, 0x3c, 0x77, 0x55, 0x55, 0x55, 0x43, 0x60, 0x60, 0x60, 0x1f, 0x3d, 0x3d, 0x3d, 0x5c, 0x0d, 0x0d, 0x0d, 0xd0, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x1b, 0x1b, 0x1b, 0xb4, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x7e, 0x7e, 0x7e, 0x03, 0x83, 0x83, 0x83, 0x00, 0x6f, 0x6f, 0x6f, 0x1b, 0x02, 0x02, 0x02, 0xf4, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xd3, 0x25, 0x25, 0x25, 0x80, 0x27, 0x27, 0x27, 0x77, 0x0e, 0x0e, 0x0e, 0xbf, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf3, 0x1c, 0x1c, 0x1c, 0xa8, 0x2c, 0x2c, 0x2c, 0x67, 0x21, 0x21, 0x21, 0x8f, 0x07, 0x07, 0x07, 0xe4, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xcc, 0x78, 0x78, 0x78, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 
-  0x7d, 0x7d, 0x7d, 0x03, 0x84, 0x84, 0x84, 0x00, 0x6d, 0x6d, 0x6d, 0x13, 0x01, 0x01, 0x01, 0xeb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xe8, 0x13, 0x13, 0x13, 0x9f, 0x14, 0x14, 0x14, 0x9f, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x60, 0x60, 0x60, 0xff, 0x98, 0x98, 0x98, 0xfb, 0xba, 0xba, 0xba, 0xfb, 0xcf, 0xcf, 0xcf, 0xfb, 0xde, 0xde, 0xde, 0xfb, 0xda, 0xda, 0xda, 0xfb, 0xca, 0xca, 0xca, 0xfb, 0xb4, 0xb4, 0xb4, 0xfb, 0x88, 0x88, 0x88, 0xfb, 0x4d, 0x4d, 0x4d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xc8, 0x1a, 0x1a, 0x1a, 0x8f, 0x12, 0x12, 0x12, 0xa8, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xc3, 0x82, 0x82, 0x82, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 
-  0x7e, 0x7e, 0x7e, 0x00, 0x82, 0x82, 0x82, 0x00, 0x76, 0x76, 0x76, 0x00, 0x08, 0x08, 0x08, 0xc8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xa3, 0x1d, 0x1d, 0x1d, 0x80, 0x04, 0x04, 0x04, 0xd3, 0x00, 0x00, 0x00, 0xff, 0x38, 0x38, 0x38, 0xff, 0xa1, 0xa1, 0xa1, 0xfc, 0xe2, 0xe2, 0xe2, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x36, 0x36, 0x36, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xd5, 0xd5, 0xd5, 0xfc, 0x85, 0x85, 0x85, 0xfc, 0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x12, 0x12, 0xb4, 0x25, 0x25, 0x25, 0x73, 0x11, 0x11, 0x11, 0xbc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x26, 0x26, 0x26, 0x97, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x88, 0x88, 0x00, 0x2d, 0x2d, 0x2d, 0x80, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xd3, 0x42, 0x42, 0x42, 0x47, 0x21, 0x21, 0x21, 0x7f, 0x00, 0x00, 0x00, 0xf8, 0x15, 0x15, 0x15, 0xff, 0x97, 0x97, 0x97, 0xfb, 0xed, 0xed, 0xed, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xee, 0xee, 0xee, 0xff, 0x00, 0x00, 0x00, 0xff, 0x88, 0x88, 0x88, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xde, 0xde, 0xde, 0xfc, 0x70, 0x70, 0x70, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x37, 0x37, 0x37, 0x53, 0x39, 0x39, 0x39, 0x63, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x45, 0x45, 0x45, 0x48, 0x8a, 0x8a, 0x8a, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 
-  0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x85, 0x85, 0x85, 0x00, 0x69, 0x69, 0x69, 0x1f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf3, 0x33, 0x33, 0x33, 0x7f, 0x71, 0x71, 0x71, 0x03, 0x31, 0x31, 0x31, 0x8c, 0x00, 0x00, 0x00, 0xff, 0x3b, 0x3b, 0x3b, 0xfc, 0xd3, 0xd3, 0xd3, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xef, 0xef, 0xef, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xb0, 0xb0, 0xb0, 0xfc, 0x15, 0x15, 0x15, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4e, 0x4e, 0x4e, 0x4f, 0x71, 0x71, 0x71, 0x10, 0x1e, 0x1e, 0x1e, 0x9b, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xd8, 0x74, 0x74, 0x74, 0x07, 0x82, 0x82, 0x82, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x83, 0x83, 0x83, 0x00, 0x3a, 0x3a, 0x3a, 0x5f, 0x5a, 0x5a, 0x5a, 0x2c, 0x8b, 0x8b, 0x8b, 0x00, 0x29, 0x29, 0x29, 0x90, 0x00, 0x00, 0x00, 0xff, 0x50, 0x50, 0x50, 0xf8, 0xe9, 0xe9, 0xe9, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x28, 0x28, 0x28, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xcc, 0xcc, 0xcc, 0xfc, 0x22, 0x22, 0x22, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x49, 0x49, 0x49, 0x4c, 0x8e, 0x8e, 0x8e, 0x00, 0x4b, 0x4b, 0x4b, 0x47, 0x46, 0x46, 0x46, 0x48, 0x87, 0x87, 0x87, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x83, 0x83, 0x83, 0x00, 0x8f, 0x8f, 0x8f, 0x00, 0x39, 0x39, 0x39, 0x63, 0x00, 0x00, 0x00, 0xff, 0x42, 0x42, 0x42, 0xfb, 0xeb, 0xeb, 0xeb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xca, 0xca, 0xca, 0xfc, 0x15, 0x15, 0x15, 0xfc, 0x00, 0x00, 0x00, 0xf3, 0x5d, 0x5d, 0x5d, 0x28, 0x8e, 0x8e, 0x8e, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x04, 0x62, 0x62, 0x62, 0x23, 0x00, 0x00, 0x00, 0xf3, 0x21, 0x21, 0x21, 0xfb, 0xd8, 0xd8, 0xd8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xae, 0xae, 0xae, 0xfb, 0x03, 0x03, 0x03, 0xff, 0x12, 0x12, 0x12, 0xc4, 0x79, 0x79, 0x79, 0x04, 0x7f, 0x7f, 0x7f, 0x04, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x84, 0x84, 0x84, 0x00, 0x1b, 0x1b, 0x1b, 0xab, 0x00, 0x00, 0x00, 0xff, 0xaa, 0xaa, 0xaa, 0xfb, 0xfa, 0xfa, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x30, 0x30, 0x30, 0xff, 0x05, 0x05, 0x05, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0x39, 0x39, 0x39, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x6c, 0x6c, 0x6c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0x60, 0x89, 0x89, 0x89, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x86, 0x86, 0x86, 0x00, 0x5d, 0x5d, 0x5d, 0x33, 0x00, 0x00, 0x00, 0xff, 0x50, 0x50, 0x50, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x32, 0x32, 0x32, 0xff, 0x05, 0x05, 0x05, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xe0, 0xe0, 0xe0, 0xfc, 0x1a, 0x1a, 0x1a, 0xff, 0x07, 0x07, 0x07, 0xdc, 0x78, 0x78, 0x78, 0x08, 0x82, 0x82, 0x82, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x83, 0x83, 0x83, 0x00, 0x1b, 0x1b, 0x1b, 0xa0, 0x02, 0x02, 0x02, 0xff, 0xbd, 0xbd, 0xbd, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xff, 0x33, 0x33, 0x33, 0xff, 0x06, 0x06, 0x06, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x43, 0x43, 0x43, 0x58, 0x88, 0x88, 0x88, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x00, 0x6d, 0x6d, 0x6d, 0x13, 0x00, 0x00, 0x00, 0xef, 0x3b, 0x3b, 0x3b, 0xff, 0xf1, 0xf1, 0xf1, 0xfc, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xff, 0x30, 0x30, 0x30, 0xff, 0x07, 0x07, 0x07, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xd2, 0xd2, 0xd2, 0xfb, 0x0a, 0x0a, 0x0a, 0xff, 0x10, 0x10, 0x10, 0xb7, 0x81, 0x81, 0x81, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x89, 0x89, 0x89, 0x00, 0x49, 0x49, 0x49, 0x50, 0x00, 0x00, 0x00, 0xff, 0x8a, 0x8a, 0x8a, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xff, 0x30, 0x30, 0x30, 0xff, 0x09, 0x09, 0x09, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xf5, 0xf5, 0xf5, 0xfc, 0x49, 0x49, 0x49, 0xff, 0x00, 0x00, 0x00, 0xf0, 0x6b, 0x6b, 0x6b, 0x17, 0x85, 0x85, 0x85, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x86, 0x86, 0x86, 0x00, 0x25, 0x25, 0x25, 0x8c, 0x01, 0x01, 0x01, 0xff, 0xbf, 0xbf, 0xbf, 0xf8, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0xce, 0xce, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0x21, 0x21, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x85, 0x85, 0x85, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x4c, 0x4c, 0x4c, 0x47, 0x88, 0x88, 0x88, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x84, 0x84, 0x84, 0x00, 0x10, 0x10, 0x10, 0xb8, 0x13, 0x13, 0x13, 0xff, 0xdf, 0xdf, 0xdf, 0xfb, 0xf9, 0xf9, 0xf9, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xda, 0xff, 0x21, 0x21, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xb3, 0xb3, 0xb3, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0x74, 0x8a, 0x8a, 0x8a, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x7e, 0x7e, 0x7e, 0x00, 0x83, 0x83, 0x83, 0x00, 0x74, 0x74, 0x74, 0x00, 0x03, 0x03, 0x03, 0xd3, 0x2e, 0x2e, 0x2e, 0xff, 0xef, 0xef, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x76, 0x76, 0x76, 0xff, 0x20, 0x20, 0x20, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xc8, 0xc8, 0xfb, 0x02, 0x02, 0x02, 0xff, 0x1d, 0x1d, 0x1d, 0x93, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x7d, 0x7d, 0x7d, 0x00, 0x84, 0x84, 0x84, 0x00, 0x71, 0x71, 0x71, 0x08, 0x00, 0x00, 0x00, 0xdf, 0x4e, 0x4e, 0x4e, 0xff, 0xdc, 0xdc, 0xdc, 0xfc, 0x60, 0x60, 0x60, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0x63, 0x63, 0x63, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0xdb, 0xdb, 0xdb, 0xfb, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xa4, 0x84, 0x84, 0x84, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x7e, 0x7e, 0x7e, 0x00, 0x83, 0x83, 0x83, 0x00, 0x73, 0x73, 0x73, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x54, 0x54, 0x54, 0xff, 0xd2, 0xd2, 0xd2, 0xfc, 0x1d, 0x1d, 0x1d, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x72, 0x72, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0x14, 0x14, 0x14, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xde, 0xde, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x45, 0x45, 0x45, 0xff, 0xdd, 0xdd, 0xdd, 0xfb, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xa7, 0x85, 0x85, 0x85, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x7d, 0x7d, 0x7d, 0x00, 0x84, 0x84, 0x84, 0x00, 0x70, 0x70, 0x70, 0x04, 0x00, 0x00, 0x00, 0xdb, 0x40, 0x40, 0x40, 0xff, 0xf2, 0xf2, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x88, 0x88, 0x88, 0xff, 0x06, 0x06, 0x06, 0xff, 0x16, 0x16, 0x16, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xd3, 0xd3, 0xf8, 0x09, 0x09, 0x09, 0xff, 0x12, 0x12, 0x12, 0x9f, 0x84, 0x84, 0x84, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x7f, 0x7f, 0x7f, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7c, 0x7c, 0x7c, 0x00, 0x0a, 0x0a, 0x0a, 0xcb, 0x20, 0x20, 0x20, 0xff, 0xe8, 0xe8, 0xe8, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x2d, 0x2d, 0x87, 0x87, 0x87, 0x87, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x85, 0x85, 0x85, 0x00, 0x16, 0x16, 0x16, 0xa7, 0x09, 0x09, 0x09, 0xff, 0xd4, 0xd4, 0xd4, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xa2, 0xa2, 0xa2, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0x60, 0x8a, 0x8a, 0x8a, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x80, 0x80, 0x80, 0x00, 
-  0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x88, 0x88, 0x00, 0x36, 0x36, 0x36, 0x73, 0x00, 0x00, 0x00, 0xff, 0xab, 0xab, 0xab, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x6c, 0x6c, 0x6c, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x5b, 0x5b, 0x5b, 0x30, 0x87, 0x87, 0x87, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x88, 0x88, 0x00, 0x5a, 0x5a, 0x5a, 0x33, 0x00, 0x00, 0x00, 0xfc, 0x69, 0x69, 0x69, 0xfc, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xe9, 0xe9, 0xe9, 0xfc, 0x29, 0x29, 0x29, 0xff, 0x01, 0x01, 0x01, 0xdb, 0x75, 0x75, 0x75, 0x07, 0x83, 0x83, 0x83, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7a, 0x7a, 0x7a, 0x03, 0x03, 0x03, 0x03, 0xd3, 0x19, 0x19, 0x19, 0xff, 0xe0, 0xe0, 0xe0, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xb4, 0xb4, 0xb4, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x25, 0x25, 0x25, 0x90, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x87, 0x87, 0x00, 0x39, 0x39, 0x39, 0x6f, 0x00, 0x00, 0x00, 0xff, 0x91, 0x91, 0x91, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x50, 0x50, 0x50, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x5e, 0x5e, 0x5e, 0x2c, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x83, 0x83, 0x83, 0x00, 0x74, 0x74, 0x74, 0x0f, 0x04, 0x04, 0x04, 0xe7, 0x20, 0x20, 0x20, 0xfc, 0xe2, 0xe2, 0xe2, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xb6, 0xb6, 0xb6, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x1c, 0x1c, 0x1c, 0xac, 0x85, 0x85, 0x85, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x89, 0x89, 0x89, 0x00, 0x3a, 0x3a, 0x3a, 0x68, 0x00, 0x00, 0x00, 0xff, 0x6a, 0x6a, 0x6a, 0xfb, 0xf9, 0xf9, 0xf9, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xe9, 0xe9, 0xe9, 0xfc, 0x30, 0x30, 0x30, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x5e, 0x5e, 0x5e, 0x2b, 0x87, 0x87, 0x87, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x03, 0x7d, 0x7d, 0x7d, 0x00, 0x12, 0x12, 0x12, 0xc0, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x9e, 0x9e, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x64, 0x64, 0x64, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x31, 0x31, 0x31, 0x7c, 0x88, 0x88, 0x88, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x60, 0x60, 0x60, 0x1f, 0x01, 0x01, 0x01, 0xe8, 0x0d, 0x0d, 0x0d, 0xff, 0xb4, 0xb4, 0xb4, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0x80, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0xb8, 0x79, 0x79, 0x79, 0x00, 0x82, 0x82, 0x82, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x87, 0x87, 0x00, 0x55, 0x55, 0x55, 0x3b, 0x00, 0x00, 0x00, 0xf4, 0x0f, 0x0f, 0x0f, 0xff, 0xab, 0xab, 0xab, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xff, 0x00, 0x00, 0x00, 0xff, 0x86, 0x86, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x7a, 0x7a, 0x7a, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0xcf, 0x70, 0x70, 0x70, 0x10, 0x83, 0x83, 0x83, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x8a, 0x8a, 0x8a, 0x00, 0x56, 0x56, 0x56, 0x3f, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x7f, 0xfc, 0xea, 0xea, 0xea, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x54, 0x54, 0x54, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xc8, 0x70, 0x70, 0x70, 0x14, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x88, 0x88, 0x00, 0x58, 0x58, 0x58, 0x2c, 0x0b, 0x0b, 0x0b, 0xd3, 0x00, 0x00, 0x00, 0xfc, 0x39, 0x39, 0x39, 0xfc, 0xb0, 0xb0, 0xb0, 0xfc, 0xf0, 0xf0, 0xf0, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xed, 0xed, 0xed, 0xff, 0x00, 0x00, 0x00, 0xff, 0x85, 0x85, 0x85, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xe5, 0xe5, 0xe5, 0xfc, 0x91, 0x91, 0x91, 0xfc, 0x1c, 0x1c, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x1e, 0x1e, 0xa8, 0x70, 0x70, 0x70, 0x0f, 0x85, 0x85, 0x85, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x04, 0x7d, 0x7d, 0x7d, 0x00, 0x0d, 0x0d, 0x0d, 0xcb, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0xff, 0x96, 0x96, 0x96, 0xfb, 0xcf, 0xcf, 0xcf, 0xfb, 0xec, 0xec, 0xec, 0xfc, 0xfa, 0xfa, 0xfa, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf6, 0xf6, 0xf6, 0xfc, 0xe7, 0xe7, 0xe7, 0xfc, 0xc2, 0xc2, 0xc2, 0xfb, 0x7f, 0x7f, 0x7f, 0xfb, 0x25, 0x25, 0x25, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x02, 0x02, 0x02, 0xff, 0x20, 0x20, 0x20, 0x97, 0x83, 0x83, 0x83, 0x00, 0x7d, 0x7d, 0x7d, 0x04, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x89, 0x89, 0x89, 0x00, 0x33, 0x33, 0x33, 0x6f, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x01, 0x01, 0xf7, 0x1c, 0x1c, 0x1c, 0xab, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x33, 0x33, 0x33, 0xff, 0x55, 0x55, 0x55, 0xff, 0x77, 0x77, 0x77, 0xff, 0x98, 0x98, 0x98, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd8, 0x1d, 0x1d, 0x1d, 0xa8, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x4e, 0x4e, 0x4e, 0x3b, 0x89, 0x89, 0x89, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x85, 0x85, 0x85, 0x00, 0x66, 0x66, 0x66, 0x18, 0x02, 0x02, 0x02, 0xe7, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x1c, 0x1c, 0x93, 0x84, 0x84, 0x84, 0x00, 0x6a, 0x6a, 0x6a, 0x1c, 0x41, 0x41, 0x41, 0x63, 0x18, 0x18, 0x18, 0xa8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xef, 0x02, 0x02, 0x02, 0xd0, 0x23, 0x23, 0x23, 0x98, 0x4e, 0x4e, 0x4e, 0x4f, 0x75, 0x75, 0x75, 0x0b, 0x7e, 0x7e, 0x7e, 0x00, 0x0b, 0x0b, 0x0b, 0xc8, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x01, 0x01, 0xfc, 0x15, 0x15, 0x15, 0xbf, 0x7d, 0x7d, 0x7d, 0x04, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x8a, 0x8a, 0x8a, 0x00, 0x45, 0x45, 0x45, 0x44, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xef, 0x68, 0x68, 0x68, 0x14, 0x85, 0x85, 0x85, 0x03, 0x84, 0x84, 0x84, 0x00, 0x89, 0x89, 0x89, 0x00, 0x84, 0x84, 0x84, 0x00, 0x76, 0x76, 0x76, 0x03, 0x6c, 0x6c, 0x6c, 0x1b, 0x54, 0x54, 0x54, 0x2f, 0x55, 0x55, 0x55, 0x3b, 0x54, 0x54, 0x54, 0x38, 0x56, 0x56, 0x56, 0x2b, 0x72, 0x72, 0x72, 0x14, 0x79, 0x79, 0x79, 0x00, 0x87, 0x87, 0x87, 0x00, 0x89, 0x89, 0x89, 0x00, 0x81, 0x81, 0x81, 0x00, 0x88, 0x88, 0x88, 0x00, 0x4a, 0x4a, 0x4a, 0x3b, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x66, 0x66, 0x66, 0x18, 0x85, 0x85, 0x85, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x81, 0x81, 0x81, 0x00, 0x77, 0x77, 0x77, 0x08, 0x21, 0x21, 0x21, 0x98, 0x01, 0x01, 0x01, 0xdc, 0x3d, 0x3d, 0x3d, 0x57, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x7d, 0x7d, 0x7d, 0x04, 0x7f, 0x7f, 0x7f, 0x03, 0x82, 0x82, 0x82, 0x00, 0x84, 0x84, 0x84, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x00, 0x83, 0x83, 0x83, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x82, 0x82, 0x82, 0x00, 0x29, 0x29, 0x29, 0x84, 0x03, 0x03, 0x03, 0xdc, 0x2c, 0x2c, 0x2c, 0x73, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x00, 0x89, 0x89, 0x89, 0x00, 0x78, 0x78, 0x78, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x8b, 0x8b, 0x8b, 0x00, 0x79, 0x79, 0x79, 0x00, 0x8d, 0x8d, 0x8d, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7e, 0x7e, 0x7e, 0x03, 0x7e, 0x7e, 0x7e, 0x04, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 
+  0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x04, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0x71, 0x71, 
+  0x71, 0x0c, 0x71, 0x71, 0x71, 0x07, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x81, 0x71, 0x71, 0x71, 0x0b, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x7e, 0x7e, 0x7e, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55, 0x55, 0x55, 0x38, 0x2a, 0x2a, 0x2a, 0x93, 0x09, 0x09, 0x09, 0xcc, 0x03, 0x03, 0x03, 0xe7, 0x02, 0x02, 0x02, 0xdb, 0x16, 0x16, 
+  0x16, 0xb0, 0x48, 0x48, 0x48, 0x4f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x07, 0x79, 0x79, 0x79, 0x04, 0x40, 0x40, 0x40, 0x64, 0x12, 0x12, 0x12, 0xbf, 0x03, 0x03, 0x03, 0xe0, 0x03, 0x03, 0x03, 0xe3, 
+  0x0f, 0x0f, 0x0f, 0xc3, 0x2b, 0x2b, 0x2b, 0x7f, 0x64, 0x64, 0x64, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7e, 0x7e, 0x7e, 0x03, 
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x24, 0x18, 0x18, 0x18, 0xaf, 0x86, 0x00, 0x00, 0x00, 0xff, 0x01, 0x1a, 0x1a, 0x1a, 0x9f, 0x76, 0x76, 0x76, 0x07, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x61, 0x61, 0x61, 0x1c, 0x11, 0x11, 0x11, 0xc3, 0x85, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0xf4, 0x29, 0x29, 0x29, 0x90, 0x6a, 0x6a, 0x6a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 
+  0x7d, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x57, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 
+  0x01, 0x01, 0x01, 0xfb, 0x82, 0x00, 0x00, 0x00, 0xfc, 0x05, 0x01, 0x01, 0x01, 0xfb, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 
+  0x81, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0x6a, 0x6a, 0x10, 0x04, 0x04, 0x04, 0xd3, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0x00, 
+  0xfc, 0x00, 0x01, 0x01, 0x01, 0xfb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x01, 0x05, 0x05, 0x05, 0xd7, 0x4b, 0x4b, 0x4b, 0x33, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x5f, 0x81, 0x00, 
+  0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0x01, 0xfb, 0x86, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x30, 0x30, 0x30, 0x78, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0x7e, 0x7e, 0x7e, 0x03, 0x1c, 0x1c, 0x1c, 0xab, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x86, 0x00, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0xf0, 0x4d, 0x4d, 0x4d, 0x33, 0x86, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x5f, 0x5f, 0x28, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0x00, 
+  0xff, 0x09, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xeb, 0x62, 0x62, 0x62, 0x1b, 0x85, 0x85, 0x85, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7c, 0x7c, 
+  0x7c, 0x04, 0x87, 0x87, 0x87, 0x03, 0x53, 0x53, 0x53, 0x3c, 0x81, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x86, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 
+  0x00, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x06, 0x06, 0x06, 0xd8, 0x6e, 0x6e, 0x6e, 0x0c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0xa0, 
+  0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x85, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x01, 0x25, 0x25, 0x25, 0x9c, 0x6b, 0x6b, 0x6b, 0x17, 
+  0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x59, 0x59, 0x2f, 0x13, 0x13, 0x13, 0xbb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x86, 0x00, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 
+  0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x37, 0x37, 0x37, 0x68, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6e, 0x6e, 0x6e, 0x08, 0x01, 0x01, 0x01, 0xdf, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x84, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x12, 0x12, 0x12, 0xb7, 0x48, 0x48, 0x48, 0x44, 
+  0x62, 0x62, 0x62, 0x20, 0x4b, 0x4b, 0x4b, 0x50, 0x34, 0x34, 0x34, 0x80, 0x17, 0x17, 0x17, 0x9b, 0x15, 0x15, 0x15, 0xa7, 0x15, 0x15, 0x15, 0xa4, 0x1b, 0x1b, 0x1b, 0x93, 0x3c, 0x3c, 0x3c, 0x77, 
+  0x55, 0x55, 0x55, 0x43, 0x60, 0x60, 0x60, 0x1f, 0x3d, 0x3d, 0x3d, 0x5c, 0x0d, 0x0d, 0x0d, 0xd0, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x84, 0x00, 0x00, 0x00, 0xff, 0x02, 
+  0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x1b, 0x1b, 0x1b, 0xb4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6f, 0x6f, 0x1b, 0x02, 0x02, 
+  0x02, 0xf4, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x82, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x04, 0x08, 0x08, 0x08, 0xd3, 0x25, 0x25, 
+  0x25, 0x80, 0x27, 0x27, 0x27, 0x77, 0x0e, 0x0e, 0x0e, 0xbf, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x02, 0x04, 0x04, 0x04, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x0d, 0x0d, 0x0d, 0xff, 
+  0x82, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0xf3, 0x1c, 0x1c, 0x1c, 0xa8, 0x2c, 0x2c, 0x2c, 0x67, 0x21, 0x21, 0x21, 0x8f, 0x07, 0x07, 0x07, 0xe4, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xfc, 0x82, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xcc, 0x82, 0x00, 0x00, 0x00, 0x00, 0x26, 0x7d, 0x7d, 0x7d, 0x03, 
+  0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x6d, 0x13, 0x01, 0x01, 0x01, 0xeb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfc, 
+  0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xe8, 0x13, 0x13, 0x13, 0x9f, 0x14, 0x14, 0x14, 0x9f, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x60, 0x60, 0x60, 0xff, 
+  0x98, 0x98, 0x98, 0xfb, 0xba, 0xba, 0xba, 0xfb, 0xcf, 0xcf, 0xcf, 0xfb, 0xde, 0xde, 0xde, 0xfb, 0xda, 0xda, 0xda, 0xfb, 0xca, 0xca, 0xca, 0xfb, 0xb4, 0xb4, 0xb4, 0xfb, 0x88, 0x88, 0x88, 0xfb, 
+  0x4d, 0x4d, 0x4d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xc8, 0x1a, 0x1a, 0x1a, 0x8f, 0x12, 0x12, 0x12, 0xa8, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 
+  0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xc3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x08, 
+  0x08, 0xc8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xfb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x17, 0x14, 0x14, 0x14, 0xa3, 0x1d, 0x1d, 0x1d, 0x80, 0x04, 0x04, 0x04, 0xd3, 
+  0x00, 0x00, 0x00, 0xff, 0x38, 0x38, 0x38, 0xff, 0xa1, 0xa1, 0xa1, 0xfc, 0xe2, 0xe2, 0xe2, 0xfc, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 
+  0x36, 0x36, 0x36, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xd5, 0xd5, 0xd5, 0xfc, 0x85, 0x85, 0x85, 0xfc, 
+  0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x12, 0x12, 0xb4, 0x25, 0x25, 0x25, 0x73, 0x11, 0x11, 0x11, 0xbc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x05, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 
+  0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x26, 0x26, 0x26, 0x97, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x2d, 0x2d, 0x2d, 0x80, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xd3, 0x42, 0x42, 0x42, 0x47, 0x21, 0x21, 0x21, 0x7f, 0x00, 0x00, 0x00, 0xf8, 
+  0x15, 0x15, 0x15, 0xff, 0x97, 0x97, 0x97, 0xfb, 0xed, 0xed, 0xed, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 
+  0xee, 0xee, 0xee, 0xff, 0x00, 0x00, 0x00, 0xff, 0x88, 0x88, 0x88, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 
+  0xfb, 0xfb, 0xfb, 0xff, 0xde, 0xde, 0xde, 0xfc, 0x70, 0x70, 0x70, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x37, 0x37, 0x37, 0x53, 0x39, 0x39, 0x39, 0x63, 0x00, 0x00, 0x00, 0xec, 
+  0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x45, 0x45, 0x45, 0x48, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x14, 0x69, 0x69, 
+  0x69, 0x1f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf3, 0x33, 0x33, 0x33, 0x7f, 0x71, 0x71, 0x71, 0x03, 0x31, 0x31, 0x31, 0x8c, 0x00, 0x00, 0x00, 0xff, 0x3b, 0x3b, 0x3b, 0xfc, 0xd3, 0xd3, 
+  0xd3, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xef, 0xef, 
+  0xef, 0xff, 0x00, 0x00, 0x00, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x0b, 0xfb, 0xfb, 0xfb, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 
+  0xf9, 0xf9, 0xf9, 0xff, 0xb0, 0xb0, 0xb0, 0xfc, 0x15, 0x15, 0x15, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4e, 0x4e, 0x4e, 0x4f, 0x71, 0x71, 0x71, 0x10, 0x1e, 0x1e, 0x1e, 0x9b, 0x00, 0x00, 0x00, 0xff, 
+  0x04, 0x04, 0x04, 0xd8, 0x74, 0x74, 0x74, 0x07, 0x86, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3a, 0x3a, 0x3a, 0x5f, 0x5a, 0x5a, 0x5a, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0x90, 0x00, 0x00, 
+  0x00, 0xff, 0x50, 0x50, 0x50, 0xf8, 0xe9, 0xe9, 0xe9, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x84, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 
+  0x28, 0x28, 0x28, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x83, 0xfe, 0xfe, 0xfe, 0xff, 0x09, 0xfd, 0xfd, 0xfd, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfb, 0xfb, 
+  0xfb, 0xff, 0xcc, 0xcc, 0xcc, 0xfc, 0x22, 0x22, 0x22, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x49, 0x49, 0x49, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x4b, 0x4b, 0x47, 0x46, 0x46, 0x46, 0x48, 0x89, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x39, 0x39, 0x39, 0x63, 0x00, 0x00, 0x00, 0xff, 0x42, 0x42, 0x42, 0xfb, 0xeb, 0xeb, 0xeb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x11, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfa, 0xfa, 
+  0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xca, 0xca, 0xca, 0xfc, 0x15, 0x15, 0x15, 0xfc, 0x00, 0x00, 0x00, 0xf3, 0x5d, 0x5d, 0x5d, 0x28, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x84, 0x84, 0x84, 0x04, 
+  0x62, 0x62, 0x62, 0x23, 0x00, 0x00, 0x00, 0xf3, 0x21, 0x21, 0x21, 0xfb, 0xd8, 0xd8, 0xd8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0x1a, 0x1a, 0x1a, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xae, 0xae, 0xae, 0xfb, 0x03, 0x03, 0x03, 0xff, 0x12, 0x12, 0x12, 0xc4, 0x79, 0x79, 
+  0x79, 0x04, 0x7f, 0x7f, 0x7f, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1b, 0x1b, 0x1b, 0xab, 0x00, 0x00, 0x00, 0xff, 0xaa, 0xaa, 0xaa, 0xfb, 0xfa, 0xfa, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 
+  0xe1, 0xe1, 0xe1, 0xff, 0x30, 0x30, 0x30, 0xff, 0x05, 0x05, 0x05, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xfe, 0xfe, 0xfe, 
+  0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0x39, 0x39, 0x39, 0xff, 0xc6, 0xc6, 
+  0xc6, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x6c, 0x6c, 0x6c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0x60, 0x00, 0x00, 
+  0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5d, 0x5d, 0x5d, 0x33, 0x00, 0x00, 0x00, 0xff, 0x50, 0x50, 0x50, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 
+  0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x32, 0x32, 0x32, 0xff, 0x05, 0x05, 0x05, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xd7, 0xd7, 0xd7, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 
+  0xe0, 0xe0, 0xe0, 0xfc, 0x1a, 0x1a, 0x1a, 0xff, 0x07, 0x07, 0x07, 0xdc, 0x78, 0x78, 0x78, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0x7f, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 
+  0x1b, 0xa0, 0x02, 0x02, 0x02, 0xff, 0xbd, 0xbd, 0xbd, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xff, 
+  0x33, 0x33, 0x33, 0xff, 0x06, 0x06, 0x06, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x11, 0xff, 0xff, 
+  0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0c, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xfd, 0xfd, 
+  0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x82, 0x82, 0x82, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x43, 0x43, 0x43, 0x58, 0x00, 0x00, 
+  0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x22, 0x6d, 0x6d, 0x6d, 0x13, 0x00, 0x00, 0x00, 0xef, 0x3b, 0x3b, 0x3b, 0xff, 0xf1, 0xf1, 0xf1, 0xfc, 0xfa, 0xfa, 0xfa, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0xff, 0x30, 0x30, 0x30, 0xff, 0x07, 0x07, 0x07, 0xff, 
+  0xcb, 0xcb, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xd9, 0xd9, 0xd9, 0xff, 0x1d, 0x1d, 0x1d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xd2, 0xd2, 0xd2, 0xfb, 0x0a, 0x0a, 0x0a, 0xff, 0x10, 0x10, 0x10, 0xb7, 0x84, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7d, 0x7d, 
+  0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x49, 0x50, 0x00, 0x00, 0x00, 0xff, 0x8a, 0x8a, 0x8a, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x12, 
+  0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xff, 0x30, 0x30, 0x30, 0xff, 0x09, 0x09, 0x09, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0x1f, 0x1f, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xff, 
+  0xb8, 0xb8, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x04, 0xfb, 0xfb, 0xfb, 0xff, 0xf5, 0xf5, 0xf5, 0xfc, 0x49, 
+  0x49, 0x49, 0xff, 0x00, 0x00, 0x00, 0xf0, 0x6b, 0x6b, 0x6b, 0x17, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0x8c, 0x01, 0x01, 0x01, 
+  0xff, 0xbf, 0xbf, 0xbf, 0xf8, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xed, 0xed, 0xff, 0x2e, 0x2e, 0x2e, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0xce, 0xce, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xdc, 0xdc, 0xdc, 0xff, 0x21, 0x21, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x82, 0xfe, 0xfe, 
+  0xfe, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x85, 0x85, 0x85, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x4c, 0x4c, 0x4c, 0x47, 0x00, 
+  0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x10, 0x10, 0xb8, 0x13, 0x13, 0x13, 0xff, 0xdf, 0xdf, 0xdf, 0xfb, 0xf9, 0xf9, 0xf9, 0xff, 0xfb, 0xfb, 0xfb, 
+  0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 
+  0xec, 0xec, 0xff, 0x2d, 0x2d, 0x2d, 0xff, 0x0b, 0x0b, 0x0b, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xda, 0xff, 0x21, 0x21, 0x21, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 
+  0x08, 0x08, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xfb, 0xfb, 0xfb, 0xff, 0x81, 0xfa, 0xfa, 
+  0xfa, 0xff, 0x05, 0xfc, 0xfc, 0xfc, 0xff, 0xb3, 0xb3, 0xb3, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0x74, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 
+  0x02, 0x03, 0x03, 0x03, 0xd3, 0x2e, 0x2e, 0x2e, 0xff, 0xef, 0xef, 0xef, 0xfb, 0x86, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x11, 0x11, 0x11, 0xff, 0x76, 0x76, 0x76, 0xff, 0x20, 0x20, 0x20, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0xb4, 
+  0xb4, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x04, 0xc8, 0xc8, 0xc8, 0xfb, 0x02, 0x02, 0x02, 0xff, 0x1d, 0x1d, 
+  0x1d, 0x93, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x09, 0x71, 0x71, 0x71, 0x08, 0x00, 0x00, 0x00, 0xdf, 0x4e, 0x4e, 0x4e, 0xff, 0xdc, 0xdc, 0xdc, 0xfc, 
+  0x60, 0x60, 0x60, 0xff, 0x62, 0x62, 0x62, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xfe, 
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0x0e, 0x0e, 0x0e, 0xff, 0x81, 0x00, 0x00, 0x00, 0xff, 0x03, 0x0f, 0x0f, 0x0f, 0xff, 
+  0xb2, 0xb2, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 
+  0xe7, 0xff, 0x63, 0x63, 0x63, 0xff, 0x61, 0x61, 0x61, 0xff, 0x60, 0x60, 0x60, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0xdb, 0xdb, 0xdb, 0xfb, 0x0f, 0x0f, 0x0f, 0xff, 0x12, 0x12, 0x12, 0xa4, 0x00, 0x00, 
+  0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x73, 0x73, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x54, 0x54, 0x54, 0xff, 0xd2, 0xd2, 0xd2, 0xfc, 0x1d, 0x1d, 0x1d, 0xff, 
+  0x1f, 0x1f, 0x1f, 0xff, 0x1c, 0x1c, 0x1c, 0xff, 0x72, 0x72, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xfd, 
+  0xfd, 0xfd, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0x14, 0x14, 0x14, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0x82, 
+  0xfe, 0xfe, 0xfe, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xde, 0xde, 0xff, 0x21, 0x21, 0x21, 0xff, 0x1e, 0x1e, 0x1e, 0xff, 0x1c, 0x1c, 0x1c, 
+  0xff, 0x45, 0x45, 0x45, 0xff, 0xdd, 0xdd, 0xdd, 0xfb, 0x12, 0x12, 0x12, 0xff, 0x13, 0x13, 0x13, 0xa7, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0x70, 0x70, 0x04, 0x00, 0x00, 0x00, 0xdb, 0x40, 
+  0x40, 0x40, 0xff, 0xf2, 0xf2, 0xf2, 0xfc, 0x89, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x88, 0x88, 0x88, 0xff, 0x06, 0x06, 0x06, 
+  0xff, 0x16, 0x16, 0x16, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xfc, 0xfc, 0xfc, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x04, 0xd3, 0xd3, 0xd3, 0xf8, 0x09, 0x09, 0x09, 0xff, 0x12, 0x12, 0x12, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x7f, 
+  0x7f, 0x7f, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x0a, 0x0a, 0xcb, 0x20, 0x20, 0x20, 0xff, 0xe8, 0xe8, 0xe8, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
+  0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x04, 0xc0, 0xc0, 0xc0, 0xf8, 0x00, 0x00, 0x00, 0xff, 
+  0x2d, 0x2d, 0x2d, 0x87, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x08, 0x16, 0x16, 0x16, 0xa7, 0x09, 0x09, 0x09, 0xff, 0xd4, 0xd4, 0xd4, 0xfb, 0xfc, 0xfc, 
+  0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xfd, 0xfd, 0xfd, 0xff, 0x05, 0xfe, 0xfe, 0xfe, 0xff, 0xa2, 0xa2, 0xa2, 0xfb, 0x00, 
+  0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 
+  0x73, 0x00, 0x00, 0x00, 0xff, 0xab, 0xab, 0xab, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xfd, 0xfd, 0xfd, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xfd, 0xfd, 0xfd, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xfc, 0xfc, 0xfc, 
+  0xff, 0x02, 0x6c, 0x6c, 0x6c, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x5b, 0x5b, 0x5b, 0x30, 0x83, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x5a, 0x5a, 0x33, 
+  0x00, 0x00, 0x00, 0xfc, 0x69, 0x69, 0x69, 0xfc, 0xfa, 0xfa, 0xfa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x94, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xe9, 0xe9, 0xe9, 0xfc, 0x29, 0x29, 0x29, 0xff, 0x01, 0x01, 0x01, 0xdb, 0x75, 0x75, 0x75, 0x07, 0x85, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7a, 0x7a, 0x7a, 
+  0x03, 0x03, 0x03, 0x03, 0xd3, 0x19, 0x19, 0x19, 0xff, 0xe0, 0xe0, 0xe0, 0xfc, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 
+  0xfe, 0xfe, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x04, 0xb4, 0xb4, 0xb4, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x25, 0x25, 0x25, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 
+  0x7e, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x6f, 0x00, 0x00, 0x00, 0xff, 0x91, 0x91, 0x91, 0xfb, 0xfd, 0xfd, 0xfd, 0xff, 
+  0xfc, 0xfc, 0xfc, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x04, 0xf9, 0xf9, 0xf9, 
+  0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x50, 0x50, 0x50, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x5e, 0x5e, 0x5e, 0x2c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x74, 0x74, 0x0f, 0x04, 0x04, 0x04, 0xe7, 0x20, 
+  0x20, 0x20, 0xfc, 0xe2, 0xe2, 0xe2, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 
+  0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x04, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xb6, 0xb6, 0xb6, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x1c, 0x1c, 0x1c, 0xac, 0x87, 0x00, 0x00, 0x00, 0x00, 0x09, 
+  0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x3a, 0x3a, 0x68, 0x00, 0x00, 0x00, 0xff, 0x6a, 0x6a, 0x6a, 0xfb, 0xf9, 0xf9, 0xf9, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 
+  0xfa, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 
+  0xfe, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xe9, 0xe9, 0xe9, 0xfc, 0x30, 0x30, 0x30, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x5e, 0x5e, 0x5e, 0x2b, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x80, 0x80, 0x03, 
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0xc0, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x9e, 0x9e, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x64, 0x64, 0x64, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x31, 0x31, 0x31, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x89, 0x00, 
+  0x00, 0x00, 0x00, 0x05, 0x60, 0x60, 0x60, 0x1f, 0x01, 0x01, 0x01, 0xe8, 0x0d, 0x0d, 0x0d, 0xff, 0xb4, 0xb4, 0xb4, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xfd, 0xfd, 0xfd, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 
+  0x80, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x03, 0x89, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 
+  0x00, 0x00, 0x55, 0x55, 0x55, 0x3b, 0x00, 0x00, 0x00, 0xf4, 0x0f, 0x0f, 0x0f, 0xff, 0xab, 0xab, 0xab, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xff, 0x00, 0x00, 0x00, 0xff, 0x86, 0x86, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfa, 0xfa, 0xfa, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x7a, 0x7a, 0x7a, 0xfb, 0x00, 0x00, 
+  0x00, 0xff, 0x10, 0x10, 0x10, 0xcf, 0x70, 0x70, 0x70, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x56, 0x56, 0x56, 0x3f, 0x00, 0x00, 0x00, 0xec, 
+  0x00, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0x7f, 0xfc, 0xea, 0xea, 0xea, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 
+  0xfe, 0xfe, 0xfe, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x8f, 0x8f, 0x8f, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 
+  0xfa, 0xfa, 0xfa, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x54, 0x54, 0x54, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x0d, 0x0d, 0xc8, 0x70, 0x70, 0x70, 0x14, 
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x11, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x58, 0x58, 0x58, 0x2c, 0x0b, 0x0b, 0x0b, 0xd3, 0x00, 0x00, 0x00, 0xfc, 0x39, 0x39, 0x39, 0xfc, 0xb0, 0xb0, 
+  0xb0, 0xfc, 0xf0, 0xf0, 0xf0, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xed, 0xed, 0xed, 0xff, 0x00, 0x00, 0x00, 0xff, 0x85, 0x85, 
+  0x85, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x81, 0xfc, 0xfc, 0xfc, 0xff, 0x05, 0xe5, 0xe5, 0xe5, 0xfc, 0x91, 0x91, 0x91, 0xfc, 0x1c, 0x1c, 0x1c, 0xfc, 
+  0x00, 0x00, 0x00, 0xff, 0x1e, 0x1e, 0x1e, 0xa8, 0x70, 0x70, 0x70, 0x0f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x0d, 0x0d, 0xcb, 0x02, 0x02, 
+  0x02, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0xff, 0x96, 0x96, 0x96, 0xfb, 0xcf, 0xcf, 0xcf, 0xfb, 0xec, 0xec, 0xec, 0xfc, 0xfa, 0xfa, 0xfa, 0xfc, 0xf7, 0xf7, 
+  0xf7, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf6, 0xf6, 0xf6, 0xfc, 0xe7, 0xe7, 0xe7, 0xfc, 0xc2, 0xc2, 0xc2, 0xfb, 0x7f, 0x7f, 0x7f, 0xfb, 0x25, 0x25, 
+  0x25, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x02, 0x02, 0x02, 0xff, 0x20, 0x20, 0x20, 0x97, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x11, 
+  0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x6f, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x01, 0x01, 0xf7, 0x1c, 0x1c, 0x1c, 0xab, 0x00, 0x00, 0x00, 0xf0, 
+  0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x33, 0x33, 0x33, 0xff, 0x55, 0x55, 0x55, 0xff, 0x77, 0x77, 0x77, 0xff, 0x98, 0x98, 0x98, 0xff, 0x8d, 0x8d, 0x8d, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 
+  0x4e, 0x4e, 0x4e, 0xff, 0x24, 0x24, 0x24, 0xff, 0x81, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0xd8, 0x1d, 0x1d, 0x1d, 0xa8, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 
+  0x00, 0xff, 0x4e, 0x4e, 0x4e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x66, 0x66, 0x66, 0x18, 0x02, 0x02, 0x02, 0xe7, 0x02, 0x02, 0x02, 0xf8, 
+  0x00, 0x00, 0x00, 0xff, 0x1c, 0x1c, 0x1c, 0x93, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x6a, 0x6a, 0x1c, 0x41, 0x41, 0x41, 0x63, 0x18, 0x18, 0x18, 0xa8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xf4, 
+  0x83, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0x00, 0xef, 0x02, 0x02, 0x02, 0xd0, 0x23, 0x23, 0x23, 0x98, 0x4e, 0x4e, 0x4e, 0x4f, 0x75, 0x75, 0x75, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0b, 
+  0x0b, 0xc8, 0x81, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x15, 0x15, 0x15, 0xbf, 0x7d, 0x7d, 0x7d, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7c, 0x7c, 0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 
+  0x45, 0x44, 0x81, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0xef, 0x68, 0x68, 0x68, 0x14, 0x85, 0x85, 0x85, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0x76, 0x76, 0x03, 0x6c, 0x6c, 
+  0x6c, 0x1b, 0x54, 0x54, 0x54, 0x2f, 0x55, 0x55, 0x55, 0x3b, 0x54, 0x54, 0x54, 0x38, 0x56, 0x56, 0x56, 0x2b, 0x72, 0x72, 0x72, 0x14, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0x3b, 
+  0x82, 0x00, 0x00, 0x00, 0xff, 0x00, 0x66, 0x66, 0x66, 0x18, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x77, 0x77, 0x08, 0x21, 0x21, 0x21, 0x98, 0x01, 0x01, 0x01, 0xdc, 0x3d, 0x3d, 0x3d, 0x57, 
+  0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x04, 0x7f, 0x7f, 0x7f, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7e, 0x7e, 0x7e, 0x03, 0x7d, 0x7d, 
+  0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0x84, 0x03, 0x03, 0x03, 0xdc, 0x2c, 0x2c, 0x2c, 0x73, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x81, 
+  0x7d, 0x7d, 0x7d, 0x03, 0x93, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -218,8 +461,7 @@ const lv_img_dsc_t alarm_clock_48px = {
   .header.always_zero = 0,
   .header.w = 42,
   .header.h = 48,
-  .data_size = 2016 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( alarm_clock_48px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = alarm_clock_48px_map,
 };
-
@@ -10,271 +10,668 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_ALARM_CLOCK_64PX uint8_t alarm_clock_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x17, 0x6d, 0x2b, 0x6d, 0x1c, 0x6e, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x07, 0x6d, 0x24, 0x6d, 0x27, 0x6d, 0x0f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x3b, 0x25, 0x8c, 0x00, 0xcf, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0xef, 0x00, 0xd7, 0x25, 0x8c, 0x6d, 0x27, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x43, 0x24, 0xa8, 0x00, 0xdf, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xe4, 0x24, 0xbc, 0x25, 0x73, 0x6e, 0x1f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x38, 0x24, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf3, 0x25, 0x6b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x0f, 0x24, 0x9f, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xec, 0x25, 0x8c, 0x6e, 0x1b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x07, 0x25, 0x88, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x24, 0x8c, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x10, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xe3, 0x49, 0x58, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x14, 0x24, 0xc0, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xff, 0x24, 0x7c, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x04, 0x00, 0xbb, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x24, 0x8f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x14, 0x00, 0xcf, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x3c, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x25, 0x80, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0x9b, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xb0, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xe3, 0x6e, 0x14, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x44, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x68, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x53, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xf7, 0x24, 0x90, 0x6d, 0x17, 0x92, 0x04, 0x92, 0x03, 0x92, 0x03, 0x92, 0x03, 0x92, 0x04, 0x92, 0x04, 0x6d, 0x33, 0x00, 0xb7, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xf3, 0x6d, 0x1b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0xbc, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x24, 0xb3, 0x6e, 0x28, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x4f, 0x00, 0xd4, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x74, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x1b, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xc4, 0x49, 0x3f, 0x6e, 0x00, 0x6e, 0x14, 0x49, 0x4b, 0x49, 0x6f, 0x24, 0x8b, 0x24, 0x9f, 0x24, 0xa4, 0x24, 0xa4, 0x24, 0x98, 0x25, 0x80, 0x49, 0x64, 0x49, 0x37, 0x92, 0x03, 0x6e, 0x00, 0x49, 0x67, 0x00, 0xe4, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x24, 0xbf, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6d, 0x38, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdc, 0x25, 0x6f, 0x49, 0x38, 0x49, 0x74, 0x00, 0xc8, 0x00, 0xf7, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xe8, 0x24, 0xaf, 0x49, 0x57, 0x49, 0x37, 0x24, 0x8c, 0x00, 0xf4, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xd8, 0x6e, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6d, 0x3c, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xf0, 0x24, 0x97, 0x25, 0x68, 0x24, 0xa8, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0xff, 0x25, 0xfb, 0x49, 0xfb, 0x6e, 0xfb, 0x6e, 0xfc, 0x6e, 0xfb, 0x6d, 0xfb, 0x49, 0xfb, 0x25, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xe4, 0x25, 0x84, 0x49, 0x60, 0x00, 0xb0, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xdc, 0x6e, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x28, 0x00, 0xf7, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x24, 0xb0, 0x24, 0x77, 0x24, 0xb0, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xfb, 0x92, 0xfb, 0xb7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb6, 0xfc, 0x6d, 0xfb, 0x24, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xe8, 0x24, 0x8f, 0x24, 0x74, 0x00, 0xcc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xcc, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x07, 0x00, 0xdc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd3, 0x25, 0x63, 0x24, 0x8b, 0x00, 0xf3, 0x00, 0xff, 0x00, 0xff, 0x6d, 0xfc, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x25, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x25, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd0, 0x25, 0x60, 0x25, 0x7b, 0x00, 0xf3, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x24, 0x9c, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x24, 0x9c, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xf7, 0x25, 0x7b, 0x25, 0x33, 0x24, 0xbc, 0x00, 0xff, 0x00, 0xff, 0x49, 0xfc, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x24, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x24, 0x7c, 0x49, 0x2b, 0x24, 0xa8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x49, 0x53, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x44, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x6e, 0x1f, 0x6d, 0x30, 0x00, 0xeb, 0x00, 0xff, 0x00, 0xfb, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x24, 0xaf, 0x6e, 0x03, 0x49, 0x4c, 0x00, 0xd0, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xe7, 0x6d, 0x0f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xc4, 0x00, 0xff, 0x00, 0xc8, 0x49, 0x4c, 0x92, 0x00, 0x6d, 0x38, 0x00, 0xf7, 0x00, 0xff, 0x24, 0xfb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x24, 0xc0, 0x92, 0x00, 0x92, 0x07, 0x25, 0x73, 0x00, 0xe7, 0x00, 0xff, 0x25, 0x7c, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x47, 0x25, 0x77, 0x92, 0x04, 0xb6, 0x00, 0x6d, 0x34, 0x00, 0xf0, 0x00, 0xff, 0x25, 0xfc, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xb7, 0x92, 0x03, 0x92, 0x00, 0x6e, 0x1b, 0x24, 0x8f, 0x6e, 0x1b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x17, 0x00, 0xdf, 0x00, 0xff, 0x25, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x24, 0x90, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x24, 0xaf, 0x00, 0xff, 0x00, 0xfb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x49, 0x53, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x5c, 0x00, 0xff, 0x00, 0xfb, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xfc, 0x00, 0xfc, 0x00, 0xe4, 0x6e, 0x17, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x10, 0x00, 0xe4, 0x00, 0xfc, 0x6d, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xfb, 0x00, 0xff, 0x24, 0x93, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x7b, 0x00, 0xff, 0x24, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xfc, 0x00, 0xfc, 0x00, 0xf4, 0x6d, 0x24, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x10, 0x00, 0xe7, 0x00, 0xfc, 0x92, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xfb, 0x00, 0xff, 0x25, 0x94, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x64, 0x00, 0xff, 0x24, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xfc, 0x00, 0xff, 0x00, 0xec, 0x6e, 0x17, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xbf, 0x00, 0xff, 0x6d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xfb, 0x00, 0xff, 0x49, 0x60, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x1f, 0x00, 0xf7, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xfb, 0x00, 0xff, 0x24, 0xb0, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x5c, 0x00, 0xff, 0x24, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfc, 0x00, 0xff, 0x00, 0xe8, 0x6e, 0x0f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x24, 0x93, 0x00, 0xff, 0x49, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x38, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xbf, 0x00, 0xff, 0x92, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xfb, 0x00, 0xff, 0x49, 0x64, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x03, 0x00, 0xdc, 0x00, 0xff, 0xb6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xf8, 0x00, 0xff, 0x25, 0x87, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x14, 0x00, 0xeb, 0x00, 0xff, 0xdb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xfb, 0x00, 0xff, 0x00, 0x9f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x20, 0x00, 0xf3, 0x00, 0xff, 0xdb, 0xfc, 0xdb, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x24, 0xab, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x23, 0x00, 0xf4, 0x00, 0xff, 0xff, 0xfc, 0xb7, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x24, 0xaf, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x1f, 0x00, 0xf0, 0x00, 0xff, 0xdb, 0xfc, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x24, 0xa8, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x10, 0x00, 0xe8, 0x00, 0xff, 0xb7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x25, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xfb, 0x00, 0xff, 0x24, 0x98, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0xd8, 0x00, 0xff, 0x92, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xfb, 0x00, 0xff, 0x49, 0x80, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xb7, 0x00, 0xff, 0x92, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xfb, 0x00, 0xff, 0x49, 0x5b, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x25, 0x88, 0x00, 0xff, 0x49, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x6d, 0x2f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x4f, 0x00, 0xff, 0x24, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfc, 0x00, 0xff, 0x00, 0xdf, 0x6e, 0x08, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x14, 0x00, 0xef, 0x00, 0xff, 0xb6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xfb, 0x00, 0xff, 0x24, 0xa0, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0xac, 0x00, 0xff, 0x49, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x50, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x4f, 0x00, 0xff, 0x00, 0xfc, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xfc, 0x00, 0xff, 0x00, 0xdf, 0x6e, 0x0b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x07, 0x00, 0xd4, 0x00, 0xff, 0x6e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xfb, 0x00, 0xff, 0x25, 0x7b, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x5f, 0x00, 0xff, 0x00, 0xfb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xfc, 0x00, 0xfc, 0x00, 0xe8, 0x6e, 0x14, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x07, 0x00, 0xcf, 0x00, 0xff, 0x49, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x73, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x3c, 0x00, 0xff, 0x00, 0xfc, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xfc, 0x00, 0xff, 0x00, 0xcc, 0x92, 0x08, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x25, 0x88, 0x00, 0xff, 0x00, 0xfb, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xfc, 0x00, 0xfc, 0x00, 0xf7, 0x49, 0x33, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x6e, 0x03, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xfb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x68, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x17, 0x00, 0xd3, 0x00, 0xff, 0x00, 0xfb, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xfc, 0x00, 0xf8, 0x00, 0xff, 0x25, 0x88, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6e, 0x1f, 0x00, 0xd7, 0x00, 0xff, 0x00, 0xf8, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x93, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6e, 0x1c, 0x00, 0xcc, 0x00, 0xff, 0x00, 0xfc, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x25, 0xff, 0x00, 0xff, 0x00, 0xff, 0x25, 0x87, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x6e, 0x0c, 0x24, 0x9c, 0x00, 0xff, 0x00, 0xfc, 0x24, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x00, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6d, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf0, 0x49, 0x5b, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x5c, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x25, 0xfb, 0x92, 0xfc, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6d, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xef, 0x6d, 0x18, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x13, 0x00, 0xe7, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x49, 0xfb, 0x92, 0xfc, 0xb7, 0xfc, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb6, 0xfc, 0x6e, 0xfc, 0x25, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xaf, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x24, 0x8b, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x64, 0x25, 0x80, 0x00, 0xe0, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x24, 0xfb, 0x49, 0xfb, 0x49, 0xfb, 0x49, 0xfb, 0x49, 0xfb, 0x24, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xc8, 0x49, 0x58, 0x25, 0x94, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x43, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x28, 0x00, 0xf4, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xac, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x0f, 0x49, 0x4c, 0x24, 0x94, 0x00, 0xcf, 0x00, 0xef, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xe4, 0x24, 0xbb, 0x25, 0x7b, 0x6d, 0x33, 0x92, 0x00, 0x92, 0x00, 0x6e, 0x13, 0x00, 0xe7, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xc7, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x25, 0x77, 0x00, 0xff, 0x00, 0xf4, 0x00, 0xfb, 0x00, 0xf8, 0x6d, 0x28, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x1c, 0x6d, 0x38, 0x49, 0x53, 0x49, 0x68, 0x49, 0x70, 0x49, 0x6f, 0x49, 0x60, 0x49, 0x48, 0x6e, 0x30, 0x6e, 0x0f, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x92, 0x00, 0x25, 0x68, 0x00, 0xff, 0x00, 0xf7, 0x00, 0xf8, 0x00, 0xff, 0x6d, 0x34, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x49, 0x47, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0x88, 0x92, 0x00, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x04, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x04, 0x00, 0xcb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xe3, 0x6e, 0x17, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x49, 0x4c, 0x00, 0xb0, 0x24, 0x8f, 0x92, 0x07, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x03, 0x92, 0x03, 0x92, 0x03, 0x92, 0x03, 0x92, 0x03, 0x92, 0x03, 0x92, 0x03, 0x92, 0x03, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x6d, 0x27, 0x24, 0xab, 0x24, 0xa3, 0x6d, 0x27, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
-  0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 0x92, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xfa, 0x00, 0x00, 0x01, 0x92, 0x03, 0x92, 0x04, 0x84, 0x00, 0x00, 0x81, 0x92, 0x03, 0x8f, 0x00, 0x00, 0x81, 0x92, 0x03, 0x84, 0x00, 0x00, 0x00, 0x92, 0x04, 0x94, 0x00, 
+  0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x02, 0x6d, 0x17, 0x6d, 0x2b, 0x6d, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x92, 0x03, 0x90, 0x00, 0x00, 0x03, 0x6e, 0x07, 0x6d, 0x24, 0x6d, 0x27, 0x6d, 0x0f, 
+  0x82, 0x00, 0x00, 0x00, 0x92, 0x03, 0x91, 0x00, 0x00, 0x00, 0x92, 0x03, 0x81, 0x00, 0x00, 0x08, 0x6d, 0x3b, 0x25, 0x8c, 0x00, 0xcf, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0xef, 0x00, 0xd7, 0x25, 0x8c, 
+  0x6d, 0x27, 0x8f, 0x00, 0x00, 0x02, 0x49, 0x43, 0x24, 0xa8, 0x00, 0xdf, 0x81, 0x00, 0xf4, 0x03, 0x00, 0xe4, 0x24, 0xbc, 0x25, 0x73, 0x6e, 0x1f, 0x81, 0x00, 0x00, 0x00, 0x92, 0x03, 0x90, 0x00, 
+  0x00, 0x01, 0x49, 0x38, 0x24, 0xaf, 0x87, 0x00, 0xff, 0x01, 0x00, 0xf3, 0x25, 0x6b, 0x8c, 0x00, 0x00, 0x01, 0x6e, 0x0f, 0x24, 0x9f, 0x87, 0x00, 0xff, 0x02, 0x00, 0xec, 0x25, 0x8c, 0x6e, 0x1b, 
+  0x8d, 0x00, 0x00, 0x07, 0x92, 0x03, 0x00, 0x00, 0x92, 0x07, 0x25, 0x88, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x81, 0x00, 0xfc, 0x81, 0x00, 0xff, 0x01, 0x00, 0xfc, 0x00, 0xfb, 0x81, 
+  0x00, 0xff, 0x02, 0x24, 0x8c, 0x00, 0x00, 0x92, 0x03, 0x88, 0x00, 0x00, 0x02, 0x6d, 0x10, 0x00, 0xc8, 0x00, 0xff, 0x81, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x81, 0x00, 0xff, 0x81, 0x00, 0xfc, 0x00, 
+  0x00, 0xfb, 0x81, 0x00, 0xff, 0x01, 0x00, 0xe3, 0x49, 0x58, 0x8d, 0x00, 0x00, 0x04, 0x6e, 0x14, 0x24, 0xc0, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfb, 0x87, 0x00, 0xff, 0x05, 0x00, 0xfc, 0x00, 0xf8, 
+  0x00, 0xff, 0x24, 0x7c, 0x00, 0x00, 0x92, 0x03, 0x85, 0x00, 0x00, 0x04, 0x92, 0x03, 0x92, 0x04, 0x00, 0xbb, 0x00, 0xff, 0x00, 0xf8, 0x88, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x81, 0x00, 0xff, 0x00, 
+  0x24, 0x8f, 0x8b, 0x00, 0x00, 0x03, 0x6d, 0x14, 0x00, 0xcf, 0x00, 0xff, 0x00, 0xfb, 0x8a, 0x00, 0xff, 0x81, 0x00, 0xfc, 0x03, 0x00, 0xff, 0x49, 0x3c, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 
+  0x04, 0x92, 0x03, 0x00, 0x00, 0x25, 0x80, 0x00, 0xff, 0x00, 0xfb, 0x8a, 0x00, 0xff, 0x05, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x00, 0x9b, 0x00, 0x00, 0x92, 0x03, 0x88, 0x00, 0x00, 0x02, 0x24, 
+  0xb0, 0x00, 0xff, 0x00, 0xf8, 0x8c, 0x00, 0xff, 0x03, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xe3, 0x6e, 0x14, 0x85, 0x00, 0x00, 0x01, 0x49, 0x44, 0x00, 0xff, 0x81, 0x00, 0xfb, 0x8b, 0x00, 0xff, 0x05, 
+  0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x68, 0x00, 0x00, 0x92, 0x03, 0x84, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x53, 0x00, 0xff, 0x00, 0xf8, 0x8b, 0x00, 0xff, 0x06, 0x00, 0xfc, 
+  0x00, 0xfb, 0x00, 0xff, 0x00, 0xf7, 0x24, 0x90, 0x6d, 0x17, 0x92, 0x04, 0x82, 0x92, 0x03, 0x81, 0x92, 0x04, 0x01, 0x6d, 0x33, 0x00, 0xb7, 0x81, 0x00, 0xff, 0x01, 0x00, 0xfb, 0x00, 0xfc, 0x8a, 
+  0x00, 0xff, 0x03, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xf3, 0x6d, 0x1b, 0x87, 0x00, 0x00, 0x02, 0x00, 0xbc, 0x00, 0xfc, 0x00, 0xfb, 0x89, 0x00, 0xff, 0x01, 0x00, 0xfc, 0x00, 0xfb, 0x81, 0x00, 0xff, 
+  0x01, 0x24, 0xb3, 0x6e, 0x28, 0x89, 0x00, 0x00, 0x01, 0x49, 0x4f, 0x00, 0xd4, 0x81, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x8a, 0x00, 0xff, 0x04, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x74, 0x00, 0x00, 0x92, 
+  0x03, 0x84, 0x00, 0x00, 0x03, 0x6d, 0x1b, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xfc, 0x88, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x81, 0x00, 0xff, 0x07, 0x00, 0xc4, 0x49, 0x3f, 0x00, 0x00, 0x6e, 0x14, 0x49, 
+  0x4b, 0x49, 0x6f, 0x24, 0x8b, 0x24, 0x9f, 0x81, 0x24, 0xa4, 0x07, 0x24, 0x98, 0x25, 0x80, 0x49, 0x64, 0x49, 0x37, 0x92, 0x03, 0x00, 0x00, 0x49, 0x67, 0x00, 0xe4, 0x81, 0x00, 0xff, 0x00, 0x00, 
+  0xfc, 0x88, 0x00, 0xff, 0x02, 0x00, 0xfb, 0x00, 0xff, 0x24, 0xbf, 0x84, 0x00, 0x00, 0x03, 0x92, 0x03, 0x00, 0x00, 0x6d, 0x38, 0x00, 0xff, 0x81, 0x00, 0xfc, 0x86, 0x00, 0xff, 0x00, 0x00, 0xfc, 
+  0x81, 0x00, 0xff, 0x05, 0x00, 0xdc, 0x25, 0x6f, 0x49, 0x38, 0x49, 0x74, 0x00, 0xc8, 0x00, 0xf7, 0x89, 0x00, 0xff, 0x06, 0x00, 0xe8, 0x24, 0xaf, 0x49, 0x57, 0x49, 0x37, 0x24, 0x8c, 0x00, 0xf4, 
+  0x00, 0xff, 0x81, 0x00, 0xfc, 0x86, 0x00, 0xff, 0x02, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xd8, 0x84, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x6d, 0x3c, 0x00, 0xff, 0x00, 0xfc, 0x85, 0x00, 0xff, 
+  0x81, 0x00, 0xfc, 0x05, 0x00, 0xff, 0x00, 0xf0, 0x24, 0x97, 0x25, 0x68, 0x24, 0xa8, 0x00, 0xfb, 0x82, 0x00, 0xff, 0x08, 0x24, 0xff, 0x25, 0xfb, 0x49, 0xfb, 0x6e, 0xfb, 0x6e, 0xfc, 0x6e, 0xfb, 
+  0x6d, 0xfb, 0x49, 0xfb, 0x25, 0xfc, 0x83, 0x00, 0xff, 0x03, 0x00, 0xe4, 0x25, 0x84, 0x49, 0x60, 0x00, 0xb0, 0x81, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x85, 0x00, 0xff, 0x03, 0x00, 0xfc, 0x00, 0xff, 
+  0x00, 0xdc, 0x6e, 0x03, 0x85, 0x00, 0x00, 0x03, 0x6d, 0x28, 0x00, 0xf7, 0x00, 0xff, 0x00, 0xfc, 0x83, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x81, 0x00, 0xff, 0x02, 0x24, 0xb0, 0x24, 0x77, 0x24, 0xb0, 
+  0x82, 0x00, 0xff, 0x02, 0x49, 0xfb, 0x92, 0xfb, 0xb7, 0xfc, 0x88, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb6, 0xfc, 0x6d, 0xfb, 0x24, 0xfb, 0x81, 0x00, 0xff, 0x03, 0x00, 0xe8, 0x24, 0x8f, 0x24, 0x74, 
+  0x00, 0xcc, 0x81, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x83, 0x00, 0xff, 0x02, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xcc, 0x86, 0x00, 0x00, 0x03, 0x6e, 0x07, 0x00, 0xdc, 0x00, 0xff, 0x00, 0xfc, 0x81, 0x00, 
+  0xff, 0x00, 0x00, 0xfb, 0x81, 0x00, 0xff, 0x03, 0x00, 0xd3, 0x25, 0x63, 0x24, 0x8b, 0x00, 0xf3, 0x81, 0x00, 0xff, 0x01, 0x6d, 0xfc, 0xb7, 0xff, 0x85, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x25, 0xff, 
+  0x92, 0xff, 0x86, 0xff, 0xff, 0x01, 0x92, 0xff, 0x25, 0xfb, 0x81, 0x00, 0xff, 0x04, 0x00, 0xd0, 0x25, 0x60, 0x25, 0x7b, 0x00, 0xf3, 0x00, 0xff, 0x81, 0x00, 0xfc, 0x81, 0x00, 0xff, 0x02, 0x00, 
+  0xfb, 0x00, 0xff, 0x24, 0x9c, 0x85, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x24, 0x9c, 0x00, 0xff, 0x00, 0xfb, 0x81, 0x00, 0xfc, 0x04, 0x00, 0xff, 0x00, 0xf7, 0x25, 0x7b, 0x25, 0x33, 0x24, 
+  0xbc, 0x81, 0x00, 0xff, 0x01, 0x49, 0xfc, 0xdb, 0xff, 0x87, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x88, 0xff, 0xff, 0x01, 0x92, 0xff, 0x24, 0xfb, 0x81, 0x00, 0xff, 0x02, 0x24, 
+  0x7c, 0x49, 0x2b, 0x24, 0xa8, 0x81, 0x00, 0xff, 0x06, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xfb, 0x00, 0xff, 0x49, 0x53, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 
+  0x44, 0x00, 0xff, 0x00, 0xf8, 0x81, 0x00, 0xff, 0x06, 0x00, 0xaf, 0x6e, 0x1f, 0x6d, 0x30, 0x00, 0xeb, 0x00, 0xff, 0x00, 0xfb, 0x92, 0xff, 0x89, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x00, 0xff, 0x92, 
+  0xff, 0x8a, 0xff, 0xff, 0x06, 0x49, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x24, 0xaf, 0x6e, 0x03, 0x49, 0x4c, 0x00, 0xd0, 0x81, 0x00, 0xff, 0x02, 0x00, 0xfb, 0x00, 0xe7, 0x6d, 0x0f, 0x88, 0x00, 0x00, 
+  0x09, 0x24, 0xc4, 0x00, 0xff, 0x00, 0xc8, 0x49, 0x4c, 0x00, 0x00, 0x6d, 0x38, 0x00, 0xf7, 0x00, 0xff, 0x24, 0xfb, 0xdb, 0xff, 0x8a, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x00, 0xff, 0x92, 0xff, 0x8b, 
+  0xff, 0xff, 0x0b, 0x92, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x24, 0xc0, 0x00, 0x00, 0x92, 0x07, 0x25, 0x73, 0x00, 0xe7, 0x00, 0xff, 0x25, 0x7c, 0x00, 0x00, 0x92, 0x03, 0x87, 0x00, 0x00, 0x08, 0x49, 
+  0x47, 0x25, 0x77, 0x92, 0x04, 0x00, 0x00, 0x6d, 0x34, 0x00, 0xf0, 0x00, 0xff, 0x25, 0xfc, 0xdb, 0xff, 0x8b, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x8c, 0xff, 0xff, 0x08, 0xb6, 
+  0xff, 0x00, 0xfb, 0x00, 0xff, 0x00, 0xb7, 0x92, 0x03, 0x00, 0x00, 0x6e, 0x1b, 0x24, 0x8f, 0x6e, 0x1b, 0x8c, 0x00, 0x00, 0x03, 0x6d, 0x17, 0x00, 0xdf, 0x00, 0xff, 0x25, 0xfb, 0x8e, 0xff, 0xff, 
+  0x00, 0xdb, 0xff, 0x8e, 0xff, 0xff, 0x03, 0xb6, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x24, 0x90, 0x8e, 0x00, 0x00, 0x05, 0x92, 0x04, 0x00, 0x00, 0x24, 0xaf, 0x00, 0xff, 0x00, 0xfb, 0xdb, 0xff, 0x82, 
+  0xff, 0xff, 0x00, 0xb7, 0xff, 0x9b, 0xff, 0xff, 0x05, 0x92, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x49, 0x53, 0x00, 0x00, 0x92, 0x04, 0x8a, 0x00, 0x00, 0x05, 0x92, 0x03, 0x00, 0x00, 0x49, 0x5c, 0x00, 
+  0xff, 0x00, 0xfb, 0xb6, 0xff, 0x82, 0xff, 0xff, 0x02, 0x25, 0xff, 0x00, 0xff, 0xb7, 0xff, 0x9b, 0xff, 0xff, 0x03, 0x49, 0xfc, 0x00, 0xfc, 0x00, 0xe4, 0x6e, 0x17, 0x8c, 0x00, 0x00, 0x03, 0x6e, 
+  0x10, 0x00, 0xe4, 0x00, 0xfc, 0x6d, 0xfc, 0x83, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 0x00, 0xb6, 0xff, 0x92, 0xff, 0xff, 0x01, 0x6e, 0xff, 0x49, 0xff, 0x86, 0xff, 0xff, 0x04, 0x24, 
+  0xfb, 0x00, 0xff, 0x24, 0x93, 0x00, 0x00, 0x92, 0x03, 0x88, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x7b, 0x00, 0xff, 0x24, 0xfb, 0x85, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 
+  0x00, 0xb7, 0xff, 0x90, 0xff, 0xff, 0x00, 0x92, 0xff, 0x81, 0x00, 0xff, 0x00, 0x49, 0xff, 0x85, 0xff, 0xff, 0x03, 0x92, 0xfc, 0x00, 0xfc, 0x00, 0xf4, 0x6d, 0x24, 0x8a, 0x00, 0x00, 0x03, 0x6e, 
+  0x10, 0x00, 0xe7, 0x00, 0xfc, 0x92, 0xfc, 0x86, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 0x00, 0xb7, 0xff, 0x8e, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x00, 0xff, 0x00, 0x49, 0xff, 0x86, 
+  0xff, 0xff, 0x04, 0x25, 0xfb, 0x00, 0xff, 0x25, 0x94, 0x00, 0x00, 0x92, 0x03, 0x86, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x64, 0x00, 0xff, 0x24, 0xfb, 0x88, 0xff, 0xff, 0x00, 0xb6, 
+  0xff, 0x81, 0x00, 0xff, 0x00, 0xb7, 0xff, 0x8c, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x00, 0xff, 0x00, 0x49, 0xff, 0x87, 0xff, 0xff, 0x03, 0x92, 0xfc, 0x00, 0xff, 0x00, 0xec, 0x6e, 0x17, 0x89, 
+  0x00, 0x00, 0x02, 0x24, 0xbf, 0x00, 0xff, 0x6d, 0xfb, 0x89, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 0x00, 0xb7, 0xff, 0x8a, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x00, 0xff, 0x00, 0x49, 
+  0xff, 0x89, 0xff, 0xff, 0x04, 0x24, 0xfb, 0x00, 0xff, 0x49, 0x60, 0x00, 0x00, 0x92, 0x03, 0x86, 0x00, 0x00, 0x03, 0x6d, 0x1f, 0x00, 0xf7, 0x00, 0xff, 0xb7, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xb6, 
+  0xff, 0x81, 0x00, 0xff, 0x00, 0xb7, 0xff, 0x88, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x00, 0xff, 0x00, 0x49, 0xff, 0x8a, 0xff, 0xff, 0x02, 0x6d, 0xfb, 0x00, 0xff, 0x24, 0xb0, 0x86, 0x00, 0x00, 
+  0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x5c, 0x00, 0xff, 0x24, 0xfb, 0x8c, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 0x00, 0xb7, 0xff, 0x86, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x00, 0xff, 
+  0x00, 0x49, 0xff, 0x8b, 0xff, 0xff, 0x03, 0xb6, 0xfc, 0x00, 0xff, 0x00, 0xe8, 0x6e, 0x0f, 0x85, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x24, 0x93, 0x00, 0xff, 0x49, 0xfb, 0x8d, 0xff, 0xff, 
+  0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 0x00, 0xb7, 0xff, 0x84, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x00, 0xff, 0x00, 0x49, 0xff, 0x8c, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 
+  0x38, 0x87, 0x00, 0x00, 0x02, 0x24, 0xbf, 0x00, 0xff, 0x92, 0xfb, 0x8e, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 0x00, 0xb7, 0xff, 0x82, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x00, 0xff, 
+  0x00, 0x49, 0xff, 0x8e, 0xff, 0xff, 0x04, 0x25, 0xfb, 0x00, 0xff, 0x49, 0x64, 0x00, 0x00, 0x92, 0x03, 0x84, 0x00, 0x00, 0x03, 0x6e, 0x03, 0x00, 0xdc, 0x00, 0xff, 0xb6, 0xfc, 0x8f, 0xff, 0xff, 
+  0x00, 0xb6, 0xff, 0x81, 0x00, 0xff, 0x02, 0xb7, 0xff, 0xff, 0xff, 0x92, 0xff, 0x82, 0x00, 0xff, 0x00, 0x49, 0xff, 0x8f, 0xff, 0xff, 0x04, 0x49, 0xf8, 0x00, 0xff, 0x25, 0x87, 0x00, 0x00, 0x92, 
+  0x03, 0x84, 0x00, 0x00, 0x03, 0x6d, 0x14, 0x00, 0xeb, 0x00, 0xff, 0xdb, 0xfc, 0x90, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x85, 0x00, 0xff, 0x00, 0x49, 0xff, 0x90, 0xff, 0xff, 0x02, 0x6e, 0xfb, 0x00, 
+  0xff, 0x00, 0x9f, 0x86, 0x00, 0x00, 0x04, 0x6d, 0x20, 0x00, 0xf3, 0x00, 0xff, 0xdb, 0xfc, 0xdb, 0xff, 0x83, 0x49, 0xff, 0x00, 0x92, 0xff, 0x8b, 0xff, 0xff, 0x00, 0x6d, 0xff, 0x83, 0x00, 0xff, 
+  0x00, 0x49, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x83, 0x49, 0xff, 0x04, 0x6d, 0xff, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x24, 0xab, 0x86, 0x00, 0x00, 0x04, 0x6d, 0x23, 0x00, 0xf4, 0x00, 
+  0xff, 0xff, 0xfc, 0xb7, 0xff, 0x83, 0x00, 0xff, 0x00, 0x49, 0xff, 0x8b, 0xff, 0xff, 0x00, 0x6d, 0xff, 0x83, 0x00, 0xff, 0x00, 0xdb, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xb6, 0xff, 0x83, 0x00, 0xff, 
+  0x04, 0x24, 0xff, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x24, 0xaf, 0x86, 0x00, 0x00, 0x04, 0x6d, 0x1f, 0x00, 0xf0, 0x00, 0xff, 0xdb, 0xfc, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x8c, 0xff, 0xff, 0x00, 
+  0xb6, 0xff, 0x82, 0x00, 0xff, 0x00, 0x24, 0xff, 0x8c, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xff, 0xff, 0x82, 0xdb, 0xff, 0x03, 0xff, 0xff, 0x92, 0xfb, 0x00, 0xff, 0x24, 0xa8, 0x86, 0x00, 0x00, 0x03, 
+  0x6d, 0x10, 0x00, 0xe8, 0x00, 0xff, 0xb7, 0xfc, 0x92, 0xff, 0xff, 0x03, 0x92, 0xff, 0x25, 0xff, 0x49, 0xff, 0xdb, 0xff, 0x92, 0xff, 0xff, 0x04, 0x6d, 0xfb, 0x00, 0xff, 0x24, 0x98, 0x00, 0x00, 
+  0x92, 0x03, 0x85, 0x00, 0x00, 0x02, 0x00, 0xd8, 0x00, 0xff, 0x92, 0xfc, 0xa9, 0xff, 0xff, 0x04, 0x49, 0xfb, 0x00, 0xff, 0x49, 0x80, 0x00, 0x00, 0x92, 0x03, 0x85, 0x00, 0x00, 0x02, 0x24, 0xb7, 
+  0x00, 0xff, 0x92, 0xfb, 0xa9, 0xff, 0xff, 0x04, 0x25, 0xfb, 0x00, 0xff, 0x49, 0x5b, 0x00, 0x00, 0x92, 0x03, 0x83, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x25, 0x88, 0x00, 0xff, 0x49, 0xfb, 
+  0xa8, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0x00, 0xfc, 0x00, 0x6d, 0x2f, 0x85, 0x00, 0x00, 0x04, 0x92, 0x03, 0x00, 0x00, 0x49, 0x4f, 0x00, 0xff, 0x24, 0xfb, 0xa8, 0xff, 0xff, 0x03, 0xb6, 0xfc, 
+  0x00, 0xff, 0x00, 0xdf, 0x6e, 0x08, 0x87, 0x00, 0x00, 0x03, 0x6e, 0x14, 0x00, 0xef, 0x00, 0xff, 0xb6, 0xfc, 0xa7, 0xff, 0xff, 0x04, 0x49, 0xfb, 0x00, 0xff, 0x24, 0xa0, 0x00, 0x00, 0x92, 0x03, 
+  0x87, 0x00, 0x00, 0x02, 0x24, 0xac, 0x00, 0xff, 0x49, 0xfb, 0xa6, 0xff, 0xff, 0x05, 0xdb, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x50, 0x00, 0x00, 0x92, 0x03, 0x85, 0x00, 0x00, 0x05, 0x92, 0x03, 
+  0x00, 0x00, 0x49, 0x4f, 0x00, 0xff, 0x00, 0xfc, 0xdb, 0xff, 0xa5, 0xff, 0xff, 0x03, 0x92, 0xfc, 0x00, 0xff, 0x00, 0xdf, 0x6e, 0x0b, 0x89, 0x00, 0x00, 0x03, 0x92, 0x07, 0x00, 0xd4, 0x00, 0xff, 
+  0x6e, 0xfc, 0xa5, 0xff, 0xff, 0x04, 0x24, 0xfb, 0x00, 0xff, 0x25, 0x7b, 0x00, 0x00, 0x92, 0x03, 0x87, 0x00, 0x00, 0x05, 0x92, 0x03, 0x00, 0x00, 0x49, 0x5f, 0x00, 0xff, 0x00, 0xfb, 0xdb, 0xff, 
+  0xa3, 0xff, 0xff, 0x03, 0x6e, 0xfc, 0x00, 0xfc, 0x00, 0xe8, 0x6e, 0x14, 0x8a, 0x00, 0x00, 0x04, 0x92, 0x03, 0x92, 0x07, 0x00, 0xcf, 0x00, 0xff, 0x49, 0xfb, 0xa2, 0xff, 0xff, 0x05, 0xdb, 0xff, 
+  0x00, 0xfb, 0x00, 0xff, 0x25, 0x73, 0x00, 0x00, 0x92, 0x03, 0x89, 0x00, 0x00, 0x05, 0x92, 0x03, 0x00, 0x00, 0x49, 0x3c, 0x00, 0xff, 0x00, 0xfc, 0x92, 0xff, 0xa1, 0xff, 0xff, 0x04, 0x25, 0xfc, 
+  0x00, 0xff, 0x00, 0xcc, 0x92, 0x08, 0x92, 0x03, 0x8b, 0x00, 0x00, 0x05, 0x92, 0x03, 0x00, 0x00, 0x25, 0x88, 0x00, 0xff, 0x00, 0xfb, 0xb6, 0xff, 0x9f, 0xff, 0xff, 0x03, 0x49, 0xfc, 0x00, 0xfc, 
+  0x00, 0xf7, 0x49, 0x33, 0x8e, 0x00, 0x00, 0x05, 0x92, 0x03, 0x6e, 0x03, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xfb, 0xdb, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xb7, 0xff, 0xdb, 0xff, 0x8d, 0xff, 0xff, 0x05, 
+  0x6e, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x68, 0x00, 0x00, 0x92, 0x03, 0x8f, 0x00, 0x00, 0x04, 0x6e, 0x17, 0x00, 0xd3, 0x00, 0xff, 0x00, 0xfb, 0xb7, 0xff, 0x8b, 0xff, 0xff, 0x02, 0xb7, 0xff, 
+  0x00, 0xff, 0x6e, 0xff, 0x8c, 0xff, 0xff, 0x05, 0x6e, 0xfc, 0x00, 0xf8, 0x00, 0xff, 0x25, 0x88, 0x00, 0x00, 0x92, 0x04, 0x8f, 0x00, 0x00, 0x06, 0x92, 0x03, 0x00, 0x00, 0x6e, 0x1f, 0x00, 0xd7, 
+  0x00, 0xff, 0x00, 0xf8, 0x92, 0xff, 0x8a, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x00, 0xff, 0x92, 0xff, 0x8b, 0xff, 0xff, 0x05, 0x49, 0xff, 0x00, 0xfb, 0x00, 0xff, 0x25, 0x93, 0x00, 0x00, 0x92, 0x03, 
+  0x91, 0x00, 0x00, 0x06, 0x92, 0x03, 0x00, 0x00, 0x6e, 0x1c, 0x00, 0xcc, 0x00, 0xff, 0x00, 0xfc, 0x6d, 0xff, 0x89, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x00, 0xff, 0x92, 0xff, 0x89, 0xff, 0xff, 0x01, 
+  0xb7, 0xff, 0x25, 0xff, 0x81, 0x00, 0xff, 0x00, 0x25, 0x87, 0x95, 0x00, 0x00, 0x07, 0x92, 0x03, 0x00, 0x00, 0x6e, 0x0c, 0x24, 0x9c, 0x00, 0xff, 0x00, 0xfc, 0x24, 0xff, 0x92, 0xff, 0x87, 0xff, 
+  0xff, 0x02, 0xb7, 0xff, 0x00, 0xff, 0x6e, 0xff, 0x87, 0xff, 0xff, 0x01, 0xdb, 0xff, 0x6d, 0xff, 0x81, 0x00, 0xfc, 0x01, 0x00, 0xf0, 0x49, 0x5b, 0x97, 0x00, 0x00, 0x09, 0x92, 0x03, 0x00, 0x00, 
+  0x49, 0x5c, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x25, 0xfb, 0x92, 0xfc, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0x85, 0xff, 0xff, 0x07, 0xdb, 0xff, 
+  0x6d, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xef, 0x6d, 0x18, 0x98, 0x00, 0x00, 0x03, 0x6e, 0x13, 0x00, 0xe7, 0x00, 0xff, 0x00, 0xfc, 0x83, 0x00, 0xff, 0x04, 0x00, 0xfc, 
+  0x49, 0xfb, 0x92, 0xfc, 0xb7, 0xfc, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb6, 0xfc, 0x6e, 0xfc, 0x25, 0xfb, 0x83, 0x00, 0xff, 0x81, 0x00, 0xfc, 0x01, 0x00, 0xff, 0x00, 0xaf, 0x98, 
+  0x00, 0x00, 0x07, 0x24, 0x8b, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x64, 0x25, 0x80, 0x00, 0xe0, 0x83, 0x00, 0xff, 0x01, 0x00, 0xfc, 0x24, 0xfb, 0x83, 0x49, 0xfb, 0x00, 0x24, 
+  0xfc, 0x84, 0x00, 0xff, 0x07, 0x00, 0xc8, 0x49, 0x58, 0x25, 0x94, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfc, 0x00, 0xff, 0x49, 0x43, 0x96, 0x00, 0x00, 0x05, 0x6d, 0x28, 0x00, 0xf4, 0x00, 0xfc, 0x00, 
+  0xfb, 0x00, 0xff, 0x00, 0xac, 0x81, 0x00, 0x00, 0x04, 0x6e, 0x0f, 0x49, 0x4c, 0x24, 0x94, 0x00, 0xcf, 0x00, 0xef, 0x86, 0x00, 0xff, 0x04, 0x00, 0xfc, 0x00, 0xe4, 0x24, 0xbb, 0x25, 0x7b, 0x6d, 
+  0x33, 0x81, 0x00, 0x00, 0x06, 0x6e, 0x13, 0x00, 0xe7, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xc7, 0x92, 0x03, 0x93, 0x00, 0x00, 0x09, 0x92, 0x03, 0x00, 0x00, 0x25, 0x77, 0x00, 0xff, 0x00, 
+  0xf4, 0x00, 0xfb, 0x00, 0xf8, 0x6d, 0x28, 0x00, 0x00, 0x92, 0x04, 0x83, 0x00, 0x00, 0x09, 0x6d, 0x1c, 0x6d, 0x38, 0x49, 0x53, 0x49, 0x68, 0x49, 0x70, 0x49, 0x6f, 0x49, 0x60, 0x49, 0x48, 0x6e, 
+  0x30, 0x6e, 0x0f, 0x83, 0x00, 0x00, 0x09, 0x92, 0x04, 0x00, 0x00, 0x25, 0x68, 0x00, 0xff, 0x00, 0xf7, 0x00, 0xf8, 0x00, 0xff, 0x6d, 0x34, 0x00, 0x00, 0x92, 0x03, 0x91, 0x00, 0x00, 0x02, 0x92, 
+  0x03, 0x00, 0x00, 0x49, 0x47, 0x82, 0x00, 0xff, 0x02, 0x24, 0x88, 0x00, 0x00, 0x92, 0x03, 0x81, 0x00, 0x00, 0x81, 0x92, 0x03, 0x8b, 0x00, 0x00, 0x01, 0x92, 0x04, 0x92, 0x03, 0x81, 0x00, 0x00, 
+  0x02, 0x92, 0x03, 0x92, 0x04, 0x00, 0xcb, 0x81, 0x00, 0xff, 0x01, 0x00, 0xe3, 0x6e, 0x17, 0x96, 0x00, 0x00, 0x03, 0x49, 0x4c, 0x00, 0xb0, 0x24, 0x8f, 0x92, 0x07, 0x87, 0x00, 0x00, 0x87, 0x92, 
+  0x03, 0x87, 0x00, 0x00, 0x03, 0x6d, 0x27, 0x24, 0xab, 0x24, 0xa3, 0x6d, 0x27, 0xc3, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x00, 0x31, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x03, 0x31, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x04, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x8e, 0x73, 0x00, 0x0c, 0x63, 0x17, 0x0c, 0x63, 0x2b, 0x0c, 0x63, 0x1c, 0x4d, 0x6b, 0x00, 0x31, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x30, 0x84, 0x00, 0x4d, 0x6b, 0x07, 0x0c, 0x63, 0x24, 0x0c, 0x63, 0x27, 0x0c, 0x63, 0x0f, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x8a, 0x52, 0x3b, 0x45, 0x29, 0x8c, 0x41, 0x08, 0xcf, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xef, 0x00, 0x00, 0xd7, 0x45, 0x29, 0x8c, 0xaa, 0x52, 0x27, 0x51, 0x8c, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x10, 0x84, 0x00, 0x8a, 0x52, 0x43, 0xe3, 0x18, 0xa8, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xe4, 0x82, 0x10, 0xbc, 0x45, 0x29, 0x73, 0x2c, 0x63, 0x1f, 0x31, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x30, 0x84, 0x00, 0x6a, 0x52, 0x38, 0xa2, 0x10, 0xaf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf3, 0x65, 0x29, 0x6b, 0xef, 0x7b, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x4d, 0x6b, 0x0f, 0x04, 0x21, 0x9f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0x45, 0x29, 0x8c, 0x2d, 0x6b, 0x1b, 0x31, 0x8c, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x8e, 0x73, 0x07, 0x25, 0x29, 0x88, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xe4, 0x20, 0x8c, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x03, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x0c, 0x63, 0x10, 0x20, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0xa6, 0x31, 0x58, 0xcf, 0x7b, 0x00, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x6e, 0x73, 0x14, 0x82, 0x10, 0xc0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xe4, 0x20, 0x7c, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x03, 0xaf, 0x7b, 0x04, 0x20, 0x00, 0xbb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x82, 0x10, 0x8f, 0xae, 0x73, 0x00, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0x0c, 0x63, 0x14, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x3c, 0x71, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x45, 0x29, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0x9b, 0xcf, 0x7b, 0x00, 0x30, 0x84, 0x03, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x00, 0x82, 0x10, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0x2d, 0x6b, 0x14, 0x30, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x49, 0x4a, 0x44, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfb, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x66, 0x31, 0x68, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x29, 0x4a, 0x53, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0xe3, 0x18, 0x90, 0x0c, 0x63, 0x17, 0x10, 0x84, 0x04, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x03, 0x10, 0x84, 0x03, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x04, 0xec, 0x62, 0x33, 0x61, 0x08, 0xb7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf3, 0xeb, 0x5a, 0x1b, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xcf, 0x7b, 0x00, 0x62, 0x10, 0xbc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xb3, 0x0c, 0x63, 0x28, 0x72, 0x94, 0x00, 0x72, 0x94, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0x92, 0x94, 0x00, 0x10, 0x84, 0x00, 0x28, 0x42, 0x4f, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x86, 0x31, 0x74, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0xcb, 0x5a, 0x1b, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xc4, 0x69, 0x4a, 0x3f, 0x8e, 0x73, 0x00, 0x4d, 0x6b, 0x14, 0x28, 0x42, 0x4b, 0x08, 0x42, 0x6f, 0xc3, 0x18, 0x8b, 0xc3, 0x18, 0x9f, 0xc3, 0x18, 0xa4, 0xc3, 0x18, 0xa4, 0xc3, 0x18, 0x98, 0x45, 0x29, 0x80, 0x29, 0x4a, 0x64, 0x49, 0x4a, 0x37, 0xcf, 0x7b, 0x03, 0x2d, 0x6b, 0x00, 0xa7, 0x39, 0x67, 0x21, 0x08, 0xe4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0xbf, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x31, 0x8c, 0x00, 0xeb, 0x5a, 0x38, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xdc, 0x25, 0x29, 0x6f, 0xe7, 0x39, 0x38, 0xa7, 0x39, 0x74, 0x62, 0x10, 0xc8, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe8, 0xe4, 0x20, 0xaf, 0x49, 0x4a, 0x57, 0x08, 0x42, 0x37, 0xe3, 0x18, 0x8c, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x41, 0x08, 0xd8, 0x8e, 0x73, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x31, 0x8c, 0x00, 0xeb, 0x5a, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x82, 0x10, 0x97, 0x45, 0x29, 0x68, 0xc3, 0x18, 0xa8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xc3, 0x18, 0xff, 0x66, 0x31, 0xfb, 0x49, 0x4a, 0xfb, 0x2d, 0x6b, 0xfb, 0x8e, 0x73, 0xfc, 0x6e, 0x73, 0xfb, 0xec, 0x62, 0xfb, 0xc7, 0x39, 0xfb, 0x45, 0x29, 0xfc, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xe4, 0x25, 0x29, 0x84, 0x86, 0x31, 0x60, 0x82, 0x10, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x41, 0x08, 0xdc, 0x6e, 0x73, 0x03, 0x30, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0xcb, 0x5a, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb0, 0xc3, 0x18, 0x77, 0x82, 0x10, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x86, 0x31, 0xfb, 0xae, 0x73, 0xfb, 0x96, 0xb5, 0xfc, 0xba, 0xd6, 0xff, 0x5d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x39, 0xce, 0xff, 0xf4, 0xa4, 0xfc, 0xcb, 0x5a, 0xfb, 0xc3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xe8, 0xc3, 0x18, 0x8f, 0xe3, 0x18, 0x74, 0x82, 0x10, 0xcc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0xcc, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0x2d, 0x6b, 0x07, 0x20, 0x00, 0xdc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xd3, 0x25, 0x29, 0x63, 0xc3, 0x18, 0x8b, 0x20, 0x00, 0xf3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x8a, 0x52, 0xfc, 0x96, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xb7, 0xbd, 0xff, 0x25, 0x29, 0xff, 0x30, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbb, 0xde, 0xff, 0x72, 0x94, 0xff, 0x65, 0x29, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x62, 0x10, 0xd0, 0x65, 0x29, 0x60, 0x04, 0x21, 0x7b, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xe4, 0x20, 0x9c, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0xa3, 0x18, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x45, 0x29, 0x7b, 0x86, 0x31, 0x33, 0x82, 0x10, 0xbc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xe8, 0x41, 0xfc, 0xb7, 0xbd, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xff, 0x00, 0x00, 0xff, 0x6d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x3c, 0xe7, 0xff, 0x71, 0x8c, 0xff, 0xc3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xe4, 0x20, 0x7c, 0x49, 0x4a, 0x2b, 0xa2, 0x10, 0xa8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xe8, 0x41, 0x53, 0x51, 0x8c, 0x00, 0xef, 0x7b, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x69, 0x4a, 0x44, 0x00, 0x00, 0xff, 0x20, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x61, 0x08, 0xaf, 0x2d, 0x6b, 0x1f, 0xaa, 0x52, 0x30, 0x21, 0x08, 0xeb, 0x00, 0x00, 0xff, 0x41, 0x08, 0xfb, 0x31, 0x8c, 0xff, 0x7d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xff, 0x20, 0x00, 0xff, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xba, 0xd6, 0xff, 0x6a, 0x52, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xc3, 0x18, 0xaf, 0x6e, 0x73, 0x03, 0x6a, 0x52, 0x4c, 0x21, 0x08, 0xd0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xe7, 0x0c, 0x63, 0x0f, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x82, 0x10, 0xc4, 0x00, 0x00, 0xff, 0x61, 0x08, 0xc8, 0x08, 0x42, 0x4c, 0x30, 0x84, 0x00, 0xcb, 0x5a, 0x38, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0xe3, 0x18, 0xfb, 0xd7, 0xbd, 0xff, 0xbf, 0xff, 0xff, 0x7d, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xff, 0x00, 0x00, 0xff, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x82, 0x10, 0xc0, 0x10, 0x84, 0x00, 0x8e, 0x73, 0x07, 0x65, 0x29, 0x73, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 0x25, 0x29, 0x7c, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0x69, 0x4a, 0x47, 0x25, 0x29, 0x77, 0x8e, 0x73, 0x04, 0x92, 0x94, 0x00, 0x8a, 0x52, 0x34, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x45, 0x29, 0xfc, 0x9a, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xff, 0x20, 0x00, 0xff, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xb3, 0x9c, 0xff, 0x20, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb7, 0xcf, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x4d, 0x6b, 0x1b, 0xe3, 0x18, 0x8f, 0x2c, 0x63, 0x1b, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x51, 0x8c, 0x00, 0xec, 0x62, 0x17, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x04, 0x21, 0xfb, 0xba, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x9a, 0xd6, 0xff, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xb3, 0x9c, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xa2, 0x10, 0x90, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x04, 0xf0, 0x83, 0x00, 0xa2, 0x10, 0xaf, 0x00, 0x00, 0xff, 0x82, 0x10, 0xfb, 0x18, 0xc6, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xde, 0xff, 0x35, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xaf, 0x7b, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xe8, 0x41, 0x53, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xc7, 0x39, 0x5c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0xf3, 0x9c, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x65, 0x29, 0xff, 0x00, 0x00, 0xff, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x49, 0x4a, 0xfc, 0x00, 0x00, 0xfc, 0x21, 0x08, 0xe4, 0x2d, 0x6b, 0x17, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x6d, 0x6b, 0x10, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xfc, 0xcb, 0x5a, 0xfc, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x6b, 0xff, 0x29, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x9a, 0xd6, 0xff, 0xa3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0x04, 0x21, 0x93, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x86, 0x31, 0x7b, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xfb, 0x9a, 0xd6, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x28, 0x42, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x71, 0x8c, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf4, 0x0c, 0x63, 0x24, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x6d, 0x6b, 0x10, 0x21, 0x08, 0xe7, 0x00, 0x00, 0xfc, 0xcf, 0x7b, 0xfc, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x3d, 0xef, 0xff, 0x65, 0x29, 0xfb, 0x00, 0x00, 0xff, 0x24, 0x21, 0x94, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0xa6, 0x31, 0x64, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xfb, 0xba, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0x08, 0x42, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x92, 0x94, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0x0c, 0x63, 0x17, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x82, 0x10, 0xbf, 0x00, 0x00, 0xff, 0x0c, 0x63, 0xfb, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x35, 0xad, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe8, 0x41, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0xa3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0xc7, 0x39, 0x60, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xeb, 0x5a, 0x1f, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x76, 0xb5, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x35, 0xad, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe7, 0x39, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xeb, 0x5a, 0xfb, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xb0, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x08, 0x42, 0x5c, 0x00, 0x00, 0xff, 0x04, 0x21, 0xfb, 0xfc, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe7, 0x39, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x14, 0xa5, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe8, 0x6d, 0x6b, 0x0f, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0xe4, 0x20, 0x93, 0x00, 0x00, 0xff, 0x49, 0x4a, 0xfb, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe8, 0x41, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x59, 0xce, 0xff, 0x41, 0x08, 0xfc, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x38, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xa2, 0x10, 0xbf, 0x00, 0x00, 0xff, 0x10, 0x84, 0xfb, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x3d, 0xef, 0xff, 0x86, 0x31, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x42, 0x64, 0x51, 0x8c, 0x00, 0xef, 0x7b, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0x6e, 0x73, 0x03, 0x61, 0x08, 0xdc, 0x00, 0x00, 0xff, 0xb2, 0x94, 0xfc, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x35, 0xad, 0xff, 0x3c, 0xe7, 0xff, 0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x08, 0x42, 0xf8, 0x00, 0x00, 0xff, 0x65, 0x29, 0x87, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0xcb, 0x5a, 0x14, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0x96, 0xb5, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0xff, 0x20, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x2c, 0x63, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0x9f, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xec, 0x62, 0x20, 0x00, 0x00, 0xf3, 0x21, 0x08, 0xff, 0x79, 0xce, 0xfc, 0xf7, 0xbd, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0xae, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5a, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xe7, 0x39, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0xcb, 0x5a, 0xff, 0x9e, 0xf7, 0xff, 0xcf, 0x7b, 0xfb, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xab, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0xeb, 0x5a, 0x23, 0x00, 0x00, 0xf4, 0x21, 0x08, 0xff, 0xba, 0xd6, 0xfc, 0x14, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5a, 0xff, 0x20, 0x00, 0xff, 0x41, 0x08, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 0xf7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xff, 0x7d, 0xef, 0xff, 0xf0, 0x83, 0xfb, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xaf, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xec, 0x62, 0x1f, 0x00, 0x00, 0xf0, 0x21, 0x08, 0xff, 0x18, 0xc6, 0xfc, 0x3d, 0xef, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xff, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbe, 0xf7, 0xff, 0xaf, 0x7b, 0xfb, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xa8, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0xcb, 0x5a, 0x10, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xff, 0x55, 0xad, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0xff, 0x65, 0x29, 0xff, 0x08, 0x42, 0xff, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xeb, 0x5a, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0x98, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xaf, 0x7b, 0x00, 0x82, 0x10, 0xd8, 0x00, 0x00, 0xff, 0x92, 0x94, 0xfc, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xe8, 0x41, 0xfb, 0x00, 0x00, 0xff, 0xa7, 0x39, 0x80, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x82, 0x10, 0xb7, 0x00, 0x00, 0xff, 0xcf, 0x7b, 0xfb, 0xbe, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x1c, 0xe7, 0xff, 0x45, 0x29, 0xfb, 0x00, 0x00, 0xff, 0xe8, 0x41, 0x5b, 0x51, 0x8c, 0x00, 0xef, 0x7b, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x30, 0x84, 0x00, 0x45, 0x29, 0x88, 0x00, 0x00, 0xff, 0x08, 0x42, 0xfb, 0x7e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x18, 0xc6, 0xff, 0x20, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x8a, 0x52, 0x2f, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x28, 0x42, 0x4f, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xfb, 0xbb, 0xde, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x92, 0x94, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xdf, 0x8e, 0x73, 0x08, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x2d, 0x6b, 0x14, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x14, 0xa5, 0xfc, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x69, 0x4a, 0xfb, 0x00, 0x00, 0xff, 0xe4, 0x20, 0xa0, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xc3, 0x18, 0xac, 0x00, 0x00, 0xff, 0x6a, 0x52, 0xfb, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x79, 0xce, 0xff, 0x62, 0x10, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x42, 0x50, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x08, 0x42, 0x4f, 0x00, 0x00, 0xff, 0x41, 0x08, 0xfc, 0x39, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xcf, 0x7b, 0xfc, 0x00, 0x00, 0xff, 0x21, 0x08, 0xdf, 0x4d, 0x6b, 0x0b, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0xaf, 0x7b, 0x07, 0x61, 0x08, 0xd4, 0x00, 0x00, 0xff, 0x0c, 0x63, 0xfc, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0xe3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0x86, 0x31, 0x7b, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x08, 0x42, 0x5f, 0x00, 0x00, 0xff, 0x41, 0x08, 0xfb, 0xf8, 0xc5, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x6e, 0x73, 0xfc, 0x00, 0x00, 0xfc, 0x20, 0x00, 0xe8, 0x6d, 0x6b, 0x14, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0xaf, 0x7b, 0x07, 0x41, 0x08, 0xcf, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xfb, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xf7, 0xbd, 0xff, 0x41, 0x08, 0xfb, 0x00, 0x00, 0xff, 0x66, 0x31, 0x73, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x69, 0x4a, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0xcf, 0x7b, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x66, 0x31, 0xfc, 0x00, 0x00, 0xff, 0x61, 0x08, 0xcc, 0xae, 0x73, 0x08, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0x31, 0x8c, 0x00, 0x04, 0x21, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x14, 0xa5, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x8a, 0x52, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0x8a, 0x52, 0x33, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x03, 0x8e, 0x73, 0x03, 0x41, 0x08, 0xc0, 0x00, 0x00, 0xff, 0x61, 0x08, 0xfb, 0xb7, 0xbd, 0xff, 0xbe, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xff, 0x14, 0xa5, 0xff, 0x39, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0x6e, 0x73, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x25, 0x29, 0x68, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x2d, 0x6b, 0x17, 0x41, 0x08, 0xd3, 0x00, 0x00, 0xff, 0x82, 0x10, 0xfb, 0x75, 0xad, 0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xff, 0x00, 0x00, 0xff, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x4d, 0x6b, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x25, 0x29, 0x88, 0x10, 0x84, 0x00, 0x10, 0x84, 0x04, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x2d, 0x6b, 0x1f, 0x41, 0x08, 0xd7, 0x00, 0x00, 0xff, 0x21, 0x08, 0xf8, 0x72, 0x94, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xff, 0x20, 0x00, 0xff, 0xae, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xfc, 0xe6, 0xff, 0x6a, 0x52, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x24, 0x21, 0x93, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x2d, 0x6b, 0x1c, 0x41, 0x08, 0xcc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0xab, 0x5a, 0xff, 0xbb, 0xde, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xff, 0x00, 0x00, 0xff, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x76, 0xb5, 0xff, 0x25, 0x29, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x24, 0x21, 0x87, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x51, 0x8c, 0x00, 0x2d, 0x6b, 0x0c, 0xe3, 0x18, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0xc3, 0x18, 0xff, 0x71, 0x8c, 0xff, 0x1c, 0xe7, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xff, 0x00, 0x00, 0xff, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x59, 0xce, 0xff, 0xec, 0x62, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x21, 0x08, 0xf0, 0xa7, 0x39, 0x5b, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x71, 0x8c, 0x00, 0xa7, 0x39, 0x5c, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x45, 0x29, 0xfb, 0x30, 0x84, 0xfc, 0x79, 0xce, 0xff, 0x7e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x18, 0xc6, 0xff, 0x8a, 0x52, 0xff, 0xf3, 0x9c, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x3d, 0xef, 0xff, 0xb6, 0xb5, 0xff, 0xec, 0x62, 0xfc, 0x61, 0x08, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0xec, 0x62, 0x18, 0x51, 0x8c, 0x00, 0xef, 0x7b, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x30, 0x84, 0x00, 0x4d, 0x6b, 0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x82, 0x10, 0xfc, 0x28, 0x42, 0xfb, 0x10, 0x84, 0xfc, 0x96, 0xb5, 0xfc, 0x9a, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0x7d, 0xef, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x3c, 0xe7, 0xff, 0xbb, 0xde, 0xff, 0x59, 0xce, 0xff, 0xf4, 0xa4, 0xfc, 0x8e, 0x73, 0xfc, 0x65, 0x29, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x41, 0x08, 0xaf, 0xef, 0x7b, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x30, 0x84, 0x00, 0xe3, 0x18, 0x8b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xa7, 0x39, 0x64, 0x66, 0x31, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xfc, 0x04, 0x21, 0xfb, 0xc7, 0x39, 0xfb, 0xe8, 0x41, 0xfb, 0xe8, 0x41, 0xfb, 0xa6, 0x31, 0xfb, 0xa2, 0x10, 0xfc, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x61, 0x08, 0xc8, 0x28, 0x42, 0x58, 0x04, 0x21, 0x94, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x43, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0xab, 0x5a, 0x28, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x41, 0x08, 0xac, 0xcf, 0x7b, 0x00, 0x51, 0x8c, 0x00, 0x6d, 0x6b, 0x0f, 0x29, 0x4a, 0x4c, 0x04, 0x21, 0x94, 0x62, 0x10, 0xcf, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xe4, 0xa3, 0x18, 0xbb, 0x66, 0x31, 0x7b, 0xab, 0x5a, 0x33, 0xaf, 0x7b, 0x00, 0x72, 0x94, 0x00, 0x4d, 0x6b, 0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x62, 0x10, 0xc7, 0xcf, 0x7b, 0x03, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x04, 0x21, 0x77, 0x00, 0x00, 0xff, 0x20, 0x00, 0xf4, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0xab, 0x5a, 0x28, 0x31, 0x8c, 0x00, 0xef, 0x7b, 0x04, 0x30, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x30, 0x84, 0x00, 0xaf, 0x7b, 0x00, 0x0c, 0x63, 0x1c, 0xeb, 0x5a, 0x38, 0x86, 0x31, 0x53, 0x86, 0x31, 0x68, 0x86, 0x31, 0x70, 0x86, 0x31, 0x6f, 0x86, 0x31, 0x60, 0x08, 0x42, 0x48, 0x2c, 0x63, 0x30, 0x0c, 0x63, 0x0f, 0x10, 0x84, 0x00, 0x31, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x04, 0x51, 0x8c, 0x00, 0x25, 0x29, 0x68, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x20, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xab, 0x5a, 0x34, 0x51, 0x8c, 0x00, 0xef, 0x7b, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xef, 0x7b, 0x03, 0x51, 0x8c, 0x00, 0x28, 0x42, 0x47, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xc3, 0x18, 0x88, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x03, 0x10, 0x84, 0x00, 0x31, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0x31, 0x8c, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x04, 0xf0, 0x83, 0x03, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x03, 0xae, 0x73, 0x04, 0x21, 0x08, 0xcb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0x0c, 0x63, 0x17, 0x31, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x29, 0x4a, 0x4c, 0x61, 0x08, 0xb0, 0xc3, 0x18, 0x8f, 0xae, 0x73, 0x07, 0x30, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x31, 0x8c, 0x00, 0xcb, 0x5a, 0x27, 0xa3, 0x18, 0xab, 0xa2, 0x10, 0xa3, 0xaa, 0x52, 0x27, 0x30, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
-  0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0xf0, 0x83, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0x51, 0x8c, 0x00, 0xf0, 0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xfa, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x83, 0x03, 0xf0, 0x83, 0x04, 0x84, 0x00, 0x00, 0x00, 0x81, 0xf0, 0x83, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x83, 0x03, 0x10, 
+  0x84, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x04, 0x94, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x63, 0x17, 0x0c, 0x63, 0x2b, 0x0c, 0x63, 0x1c, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x90, 0x00, 0x00, 0x00, 0x03, 0x4d, 0x6b, 0x07, 0x0c, 0x63, 0x24, 0x0c, 0x63, 0x27, 0x0c, 0x63, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 
+  0x03, 0x91, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x81, 0x00, 0x00, 0x00, 0x08, 0x8a, 0x52, 0x3b, 0x45, 0x29, 0x8c, 0x41, 0x08, 0xcf, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xef, 
+  0x00, 0x00, 0xd7, 0x45, 0x29, 0x8c, 0xaa, 0x52, 0x27, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x8a, 0x52, 0x43, 0xe3, 0x18, 0xa8, 0x00, 0x00, 0xdf, 0x81, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xe4, 0x82, 
+  0x10, 0xbc, 0x45, 0x29, 0x73, 0x2c, 0x63, 0x1f, 0x81, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x90, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x52, 0x38, 0xa2, 0x10, 0xaf, 0x87, 0x00, 0x00, 0xff, 0x01, 
+  0x00, 0x00, 0xf3, 0x65, 0x29, 0x6b, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x6b, 0x0f, 0x04, 0x21, 0x9f, 0x87, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xec, 0x45, 0x29, 0x8c, 0x2d, 0x6b, 0x1b, 0x8d, 
+  0x00, 0x00, 0x00, 0x07, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x8e, 0x73, 0x07, 0x25, 0x29, 0x88, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xfc, 
+  0x81, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x02, 0xe4, 0x20, 0x8c, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x88, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x63, 
+  0x10, 0x20, 0x00, 0xc8, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x01, 
+  0x00, 0x00, 0xe3, 0xa6, 0x31, 0x58, 0x8d, 0x00, 0x00, 0x00, 0x04, 0x6e, 0x73, 0x14, 0x82, 0x10, 0xc0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x87, 0x00, 0x00, 0xff, 0x05, 0x00, 
+  0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xe4, 0x20, 0x7c, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x85, 0x00, 0x00, 0x00, 0x04, 0x10, 0x84, 0x03, 0xaf, 0x7b, 0x04, 0x20, 0x00, 0xbb, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0xf8, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x00, 0x82, 0x10, 0x8f, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x63, 0x14, 0x00, 0x00, 0xcf, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x8a, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x3c, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x83, 0x00, 0x00, 0x00, 0x04, 
+  0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x45, 0x29, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x8a, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0x9b, 
+  0x00, 0x00, 0x00, 0x30, 0x84, 0x03, 0x88, 0x00, 0x00, 0x00, 0x02, 0x82, 0x10, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x8c, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xe3, 0x2d, 0x6b, 0x14, 0x85, 0x00, 0x00, 0x00, 0x03, 0x49, 0x4a, 0x44, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfb, 0x00, 0x00, 0xfb, 0x8b, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xfc, 0x00, 0x00, 
+  0xfb, 0x00, 0x00, 0xff, 0x66, 0x31, 0x68, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 0xef, 0x7b, 0x03, 0x00, 0x00, 0x00, 0x29, 0x4a, 0x53, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xf8, 0x8b, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0xe3, 0x18, 0x90, 0x0c, 0x63, 0x17, 0x10, 0x84, 0x04, 0xf0, 0x83, 0x03, 0x81, 0x10, 
+  0x84, 0x03, 0x03, 0xf0, 0x83, 0x04, 0x10, 0x84, 0x04, 0xec, 0x62, 0x33, 0x61, 0x08, 0xb7, 0x81, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x8a, 0x00, 0x00, 0xff, 0x03, 0x00, 
+  0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf3, 0xeb, 0x5a, 0x1b, 0x87, 0x00, 0x00, 0x00, 0x02, 0x62, 0x10, 0xbc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x89, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x01, 0xa2, 0x10, 0xb3, 0x0c, 0x63, 0x28, 0x89, 0x00, 0x00, 0x00, 0x01, 0x28, 0x42, 0x4f, 0x00, 0x00, 0xd4, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0xfb, 0x8a, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x86, 0x31, 0x74, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x84, 0x00, 0x00, 0x00, 0x03, 0xcb, 0x5a, 0x1b, 0x00, 0x00, 
+  0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x07, 0x41, 0x08, 0xc4, 0x69, 0x4a, 0x3f, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x14, 
+  0x28, 0x42, 0x4b, 0x08, 0x42, 0x6f, 0xc3, 0x18, 0x8b, 0xc3, 0x18, 0x9f, 0x81, 0xc3, 0x18, 0xa4, 0x07, 0xc3, 0x18, 0x98, 0x45, 0x29, 0x80, 0x29, 0x4a, 0x64, 0x49, 0x4a, 0x37, 0xcf, 0x7b, 0x03, 
+  0x00, 0x00, 0x00, 0xa7, 0x39, 0x67, 0x21, 0x08, 0xe4, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x88, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0xbf, 0x84, 
+  0x00, 0x00, 0x00, 0x03, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x38, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x86, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 
+  0x05, 0x41, 0x08, 0xdc, 0x25, 0x29, 0x6f, 0xe7, 0x39, 0x38, 0xa7, 0x39, 0x74, 0x62, 0x10, 0xc8, 0x00, 0x00, 0xf7, 0x89, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xe8, 0xe4, 0x20, 0xaf, 0x49, 0x4a, 
+  0x57, 0x08, 0x42, 0x37, 0xe3, 0x18, 0x8c, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x86, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x41, 0x08, 0xd8, 0x84, 
+  0x00, 0x00, 0x00, 0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x85, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xf0, 0x82, 0x10, 0x97, 0x45, 0x29, 0x68, 0xc3, 0x18, 0xa8, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0xff, 0x09, 0xc3, 0x18, 0xff, 0x66, 0x31, 0xfb, 0x49, 0x4a, 0xfb, 0x2d, 0x6b, 0xfb, 0x8e, 
+  0x73, 0xfc, 0x6e, 0x73, 0xfb, 0xec, 0x62, 0xfb, 0xc7, 0x39, 0xfb, 0x45, 0x29, 0xfc, 0x41, 0x08, 0xff, 0x82, 0x00, 0x00, 0xff, 0x03, 0x41, 0x08, 0xe4, 0x25, 0x29, 0x84, 0x86, 0x31, 0x60, 0x82, 
+  0x10, 0xb0, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x85, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x41, 0x08, 0xdc, 0x6e, 0x73, 0x03, 0x85, 0x00, 0x00, 0x00, 0x03, 
+  0xcb, 0x5a, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x83, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x02, 0x82, 0x10, 0xb0, 0xc3, 0x18, 0x77, 0x82, 
+  0x10, 0xb0, 0x82, 0x00, 0x00, 0xff, 0x06, 0x86, 0x31, 0xfb, 0xae, 0x73, 0xfb, 0x96, 0xb5, 0xfc, 0xba, 0xd6, 0xff, 0x5d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x82, 0x9e, 0xf7, 0xff, 
+  0x05, 0x7d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x39, 0xce, 0xff, 0xf4, 0xa4, 0xfc, 0xcb, 0x5a, 0xfb, 0xc3, 0x18, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x03, 0x41, 0x08, 0xe8, 0xc3, 0x18, 0x8f, 0xe3, 0x18, 
+  0x74, 0x82, 0x10, 0xcc, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x83, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0xcc, 0x86, 0x00, 0x00, 0x00, 0x03, 0x2d, 
+  0x6b, 0x07, 0x20, 0x00, 0xdc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x03, 0x41, 0x08, 0xd3, 0x25, 0x29, 0x63, 0xc3, 0x18, 
+  0x8b, 0x20, 0x00, 0xf3, 0x81, 0x00, 0x00, 0xff, 0x02, 0x8a, 0x52, 0xfc, 0x96, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0x82, 0xbe, 0xf7, 0xff, 0x05, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xb7, 0xbd, 0xff, 
+  0x25, 0x29, 0xff, 0x30, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x03, 0x9e, 0xf7, 0xff, 0xbb, 0xde, 0xff, 0x72, 0x94, 0xff, 0x65, 0x29, 0xfb, 0x81, 0x00, 
+  0x00, 0xff, 0x04, 0x62, 0x10, 0xd0, 0x65, 0x29, 0x60, 0x04, 0x21, 0x7b, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 
+  0xff, 0xe4, 0x20, 0x9c, 0x85, 0x00, 0x00, 0x00, 0x04, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0xa3, 0x18, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xf7, 0x45, 0x29, 0x7b, 0x86, 0x31, 0x33, 0x82, 0x10, 0xbc, 0x81, 0x00, 0x00, 0xff, 0x01, 0xe8, 0x41, 0xfc, 0xb7, 0xbd, 0xff, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x83, 
+  0xff, 0xff, 0xff, 0x02, 0x55, 0xad, 0xff, 0x00, 0x00, 0xff, 0x6d, 0x6b, 0xff, 0x83, 0xff, 0xff, 0xff, 0x06, 0xdf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x3c, 0xe7, 
+  0xff, 0x71, 0x8c, 0xff, 0xc3, 0x18, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x02, 0xe4, 0x20, 0x7c, 0x49, 0x4a, 0x2b, 0xa2, 0x10, 0xa8, 0x81, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 
+  0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xe8, 0x41, 0x53, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x03, 0x83, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x69, 0x4a, 0x44, 0x00, 0x00, 0xff, 
+  0x20, 0x00, 0xf8, 0x81, 0x00, 0x00, 0xff, 0x07, 0x61, 0x08, 0xaf, 0x2d, 0x6b, 0x1f, 0xaa, 0x52, 0x30, 0x21, 0x08, 0xeb, 0x00, 0x00, 0xff, 0x41, 0x08, 0xfb, 0x31, 0x8c, 0xff, 0x7d, 0xef, 0xff, 
+  0x81, 0x9e, 0xf7, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xff, 0x20, 0x00, 0xff, 0x8e, 0x73, 0xff, 0x86, 0xff, 0xff, 0xff, 
+  0x0a, 0xbf, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xba, 0xd6, 0xff, 0x6a, 0x52, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xc3, 0x18, 0xaf, 0x6e, 0x73, 0x03, 0x6a, 0x52, 0x4c, 0x21, 
+  0x08, 0xd0, 0x81, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xe7, 0x0c, 0x63, 0x0f, 0x88, 0x00, 0x00, 0x00, 0x0c, 0x82, 0x10, 0xc4, 0x00, 0x00, 0xff, 0x61, 0x08, 0xc8, 0x08, 0x42, 
+  0x4c, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0x38, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0xe3, 0x18, 0xfb, 0xd7, 0xbd, 0xff, 0xbf, 0xff, 0xff, 0x7d, 0xef, 0xff, 0xdf, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 
+  0x04, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xff, 0x00, 0x00, 0xff, 0x8e, 0x73, 0xff, 0x88, 0xff, 0xff, 0xff, 0x0e, 0xbe, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xcf, 0x7b, 
+  0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x82, 0x10, 0xc0, 0x00, 0x00, 0x00, 0x8e, 0x73, 0x07, 0x65, 0x29, 0x73, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 0x25, 0x29, 0x7c, 0x00, 0x00, 0x00, 0xf0, 
+  0x83, 0x03, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x69, 0x4a, 0x47, 0x25, 0x29, 0x77, 0x8e, 0x73, 0x04, 0x00, 0x00, 0x00, 0x8a, 0x52, 0x34, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x45, 0x29, 0xfc, 0x9a, 
+  0xd6, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0x55, 0xad, 0xff, 0x20, 0x00, 0xff, 0x8e, 0x73, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x0a, 0x7d, 0xef, 0xff, 0xbe, 0xf7, 
+  0xff, 0xb3, 0x9c, 0xff, 0x20, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0xb7, 0xcf, 0x7b, 0x03, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x1b, 0xe3, 0x18, 0x8f, 0x2c, 0x63, 0x1b, 0x8c, 0x00, 0x00, 0x00, 
+  0x06, 0xec, 0x62, 0x17, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x04, 0x21, 0xfb, 0xba, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0x5d, 0xef, 0xff, 0x9a, 0xd6, 
+  0xff, 0x1c, 0xe7, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x05, 0x7d, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xb3, 0x9c, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xa2, 0x10, 0x90, 0x8e, 0x00, 0x00, 0x00, 0x09, 
+  0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0xa2, 0x10, 0xaf, 0x00, 0x00, 0xff, 0x82, 0x10, 0xfb, 0x18, 0xc6, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xde, 0xff, 0x35, 0xad, 0xff, 0x99, 0xff, 
+  0xff, 0xff, 0x07, 0x7d, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xaf, 0x7b, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xe8, 0x41, 0x53, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x04, 0x8a, 0x00, 0x00, 0x00, 0x0d, 
+  0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x5c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0xf3, 0x9c, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x65, 0x29, 0xff, 0x00, 0x00, 
+  0xff, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x05, 0x7d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x49, 0x4a, 0xfc, 
+  0x00, 0x00, 0xfc, 0x21, 0x08, 0xe4, 0x2d, 0x6b, 0x17, 0x8c, 0x00, 0x00, 0x00, 0x08, 0x6d, 0x6b, 0x10, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xfc, 0xcb, 0x5a, 0xfc, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xff, 
+  0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0x6d, 0x6b, 0xff, 0x29, 
+  0x4a, 0xff, 0x84, 0xff, 0xff, 0xff, 0x06, 0x7e, 0xf7, 0xff, 0x9a, 0xd6, 0xff, 0xa3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0x04, 0x21, 0x93, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x88, 0x00, 0x00, 0x00, 
+  0x06, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x86, 0x31, 0x7b, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xfb, 0x9a, 0xd6, 0xff, 0x7e, 0xf7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xa4, 0xff, 0x81, 0x00, 
+  0x00, 0xff, 0x00, 0x14, 0xa5, 0xff, 0x90, 0xff, 0xff, 0xff, 0x00, 0xcf, 0x7b, 0xff, 0x81, 0x00, 0x00, 0xff, 0x01, 0x28, 0x42, 0xff, 0x7e, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x81, 0xbe, 0xf7, 
+  0xff, 0x03, 0x71, 0x8c, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf4, 0x0c, 0x63, 0x24, 0x8a, 0x00, 0x00, 0x00, 0x05, 0x6d, 0x6b, 0x10, 0x21, 0x08, 0xe7, 0x00, 0x00, 0xfc, 0xcf, 0x7b, 0xfc, 0xbf, 
+  0xff, 0xff, 0xbe, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 
+  0xff, 0x8c, 0xff, 0xff, 0xff, 0x05, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x7d, 0xef, 0xff, 0x83, 0xff, 0xff, 0xff, 0x06, 0x7e, 0xf7, 0xff, 
+  0x3d, 0xef, 0xff, 0x65, 0x29, 0xfb, 0x00, 0x00, 0xff, 0x24, 0x21, 0x94, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x86, 0x00, 0x00, 0x00, 0x06, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0xa6, 0x31, 0x64, 
+  0x00, 0x00, 0xff, 0xa2, 0x10, 0xfb, 0xba, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0x84, 0xff, 0xff, 0xff, 0x07, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 
+  0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x05, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0x08, 0x42, 0xff, 0xbe, 0xf7, 0xff, 
+  0x84, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x92, 0x94, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0x0c, 0x63, 0x17, 0x89, 0x00, 0x00, 0x00, 0x02, 0x82, 0x10, 0xbf, 0x00, 
+  0x00, 0xff, 0x0c, 0x63, 0xfb, 0x81, 0xbe, 0xf7, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0x35, 0xad, 0xff, 0xff, 
+  0xff, 0xff, 0xdf, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x05, 0xcf, 0x7b, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe8, 0x41, 0xff, 0x9e, 0xf7, 0xff, 0x86, 0xff, 0xff, 0xff, 
+  0x06, 0x9e, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0xa3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0xc7, 0x39, 0x60, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x86, 0x00, 0x00, 0x00, 0x04, 0xeb, 0x5a, 0x1f, 0x00, 0x00, 
+  0xf7, 0x00, 0x00, 0xff, 0x76, 0xb5, 0xff, 0xbe, 0xf7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x07, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x35, 0xad, 
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x05, 0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe7, 0x39, 0xff, 0x9e, 0xf7, 0xff, 0x87, 0xff, 
+  0xff, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x02, 0xeb, 0x5a, 0xfb, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xb0, 0x86, 0x00, 0x00, 0x00, 0x06, 0xef, 0x7b, 0x03, 0x00, 0x00, 0x00, 0x08, 0x42, 0x5c, 0x00, 0x00, 
+  0xff, 0x04, 0x21, 0xfb, 0xfc, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x05, 0xb3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 
+  0xff, 0x84, 0xff, 0xff, 0xff, 0x05, 0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe7, 0x39, 0xff, 0x9e, 0xf7, 0xff, 0x88, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 
+  0xbf, 0xff, 0xff, 0x14, 0xa5, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe8, 0x6d, 0x6b, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x06, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0xe4, 0x20, 0x93, 0x00, 0x00, 0xff, 
+  0x49, 0x4a, 0xfb, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x89, 0xff, 0xff, 0xff, 0x10, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x55, 0xad, 0xff, 
+  0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xe8, 0x41, 0xff, 0x9e, 0xf7, 
+  0xff, 0x8a, 0xff, 0xff, 0xff, 0x04, 0xbe, 0xf7, 0xff, 0x59, 0xce, 0xff, 0x41, 0x08, 0xfc, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x38, 0x87, 0x00, 0x00, 0x00, 0x04, 0xa2, 0x10, 0xbf, 0x00, 0x00, 0xff, 
+  0x10, 0x84, 0xfb, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0xff, 0x00, 0x00, 0xff, 0x21, 0x08, 0xff, 0x55, 0xad, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x05, 0x10, 0x84, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x9e, 0xf7, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x06, 0x9e, 0xf7, 0xff, 0x3d, 
+  0xef, 0xff, 0x86, 0x31, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x42, 0x64, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x03, 0x84, 0x00, 0x00, 0x00, 0x03, 0x6e, 0x73, 0x03, 0x61, 0x08, 0xdc, 0x00, 0x00, 0xff, 0xb2, 
+  0x94, 0xfc, 0x81, 0xdf, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x35, 0xad, 0xff, 0x3c, 0xe7, 0xff, 
+  0xf0, 0x83, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xff, 0x7e, 0xf7, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x06, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x08, 0x42, 0xf8, 
+  0x00, 0x00, 0xff, 0x65, 0x29, 0x87, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 0xcb, 0x5a, 0x14, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0x96, 0xb5, 0xfc, 0xdf, 0xff, 0xff, 
+  0x8f, 0xff, 0xff, 0xff, 0x03, 0x92, 0x94, 0xff, 0x20, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0x08, 0xff, 0x82, 0x00, 0x00, 0xff, 0x01, 0xc7, 0x39, 0xff, 0x7e, 0xf7, 0xff, 0x8e, 0xff, 0xff, 0xff, 
+  0x03, 0xbe, 0xf7, 0xff, 0x2c, 0x63, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0x9f, 0x86, 0x00, 0x00, 0x00, 0x05, 0xec, 0x62, 0x20, 0x00, 0x00, 0xf3, 0x21, 0x08, 0xff, 0x79, 0xce, 0xfc, 0xf7, 0xbd, 
+  0xff, 0x08, 0x42, 0xff, 0x81, 0x28, 0x42, 0xff, 0x01, 0x08, 0x42, 0xff, 0xae, 0x73, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5a, 0xff, 0x83, 0x00, 0x00, 
+  0xff, 0x01, 0xe7, 0x39, 0xff, 0x7e, 0xf7, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x96, 0xb5, 0xff, 0x08, 0x42, 0xff, 0x81, 0x28, 0x42, 0xff, 0x05, 0x08, 0x42, 0xff, 0xcb, 0x5a, 0xff, 0x9e, 0xf7, 
+  0xff, 0xcf, 0x7b, 0xfb, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xab, 0x86, 0x00, 0x00, 0x00, 0x04, 0xeb, 0x5a, 0x23, 0x00, 0x00, 0xf4, 0x21, 0x08, 0xff, 0xba, 0xd6, 0xfc, 0x14, 0xa5, 0xff, 0x83, 0x00, 
+  0x00, 0xff, 0x00, 0x08, 0x42, 0xff, 0x89, 0xff, 0xff, 0xff, 0x09, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5a, 0xff, 0x20, 0x00, 0xff, 0x41, 0x08, 0xff, 0x21, 0x08, 0xff, 0x00, 0x00, 0xff, 
+  0xf7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xd3, 0x9c, 0xff, 0x83, 0x00, 0x00, 0xff, 0x04, 0xa2, 0x10, 0xff, 0x7d, 0xef, 0xff, 0xf0, 0x83, 0xfb, 0x00, 
+  0x00, 0xff, 0xa2, 0x10, 0xaf, 0x86, 0x00, 0x00, 0x00, 0x05, 0xec, 0x62, 0x1f, 0x00, 0x00, 0xf0, 0x21, 0x08, 0xff, 0x18, 0xc6, 0xfc, 0x3d, 0xef, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 
+  0x01, 0x7a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xa4, 0xff, 0x82, 0x00, 0x00, 0xff, 0x01, 0xa2, 0x10, 0xff, 0x3d, 0xef, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x5d, 
+  0xef, 0xff, 0x7a, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x03, 0xbe, 0xf7, 0xff, 0xaf, 0x7b, 0xfb, 0x00, 0x00, 0xff, 0xa2, 0x10, 0xa8, 0x86, 0x00, 0x00, 0x00, 0x04, 0xcb, 0x5a, 0x10, 0x00, 0x00, 
+  0xe8, 0x00, 0x00, 0xff, 0x55, 0xad, 0xfc, 0xdf, 0xff, 0xff, 0x91, 0xff, 0xff, 0xff, 0x03, 0x51, 0x8c, 0xff, 0x65, 0x29, 0xff, 0x08, 0x42, 0xff, 0x59, 0xce, 0xff, 0x91, 0xff, 0xff, 0xff, 0x05, 
+  0x9e, 0xf7, 0xff, 0xeb, 0x5a, 0xfb, 0x00, 0x00, 0xff, 0x82, 0x10, 0x98, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x82, 0x10, 0xd8, 0x00, 0x00, 0xff, 0x92, 0x94, 0xfc, 
+  0x81, 0xdf, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x04, 0xe8, 0x41, 0xfb, 0x00, 0x00, 0xff, 0xa7, 0x39, 0x80, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x85, 0x00, 0x00, 0x00, 
+  0x04, 0x82, 0x10, 0xb7, 0x00, 0x00, 0xff, 0xcf, 0x7b, 0xfb, 0xbe, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0x06, 0xbe, 0xf7, 0xff, 0x1c, 0xe7, 0xff, 0x45, 0x29, 0xfb, 0x00, 0x00, 
+  0xff, 0xe8, 0x41, 0x5b, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x03, 0x83, 0x00, 0x00, 0x00, 0x06, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x45, 0x29, 0x88, 0x00, 0x00, 0xff, 0x08, 0x42, 0xfb, 0x7e, 0xf7, 
+  0xff, 0xbe, 0xf7, 0xff, 0xa5, 0xff, 0xff, 0xff, 0x04, 0xbe, 0xf7, 0xff, 0x18, 0xc6, 0xff, 0x20, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x8a, 0x52, 0x2f, 0x85, 0x00, 0x00, 0x00, 0x06, 0xef, 0x7b, 0x03, 
+  0x00, 0x00, 0x00, 0x28, 0x42, 0x4f, 0x00, 0x00, 0xff, 0xa3, 0x18, 0xfb, 0xbb, 0xde, 0xff, 0x9e, 0xf7, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x92, 0x94, 0xfc, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xdf, 0x8e, 0x73, 0x08, 0x87, 0x00, 0x00, 0x00, 0x05, 0x2d, 0x6b, 0x14, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x14, 0xa5, 0xfc, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 
+  0xa3, 0xff, 0xff, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x04, 0x69, 0x4a, 0xfb, 0x00, 0x00, 0xff, 0xe4, 0x20, 0xa0, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x87, 0x00, 0x00, 0x00, 0x02, 0xc3, 0x18, 0xac, 
+  0x00, 0x00, 0xff, 0x6a, 0x52, 0xfb, 0x81, 0x9e, 0xf7, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x06, 0x9e, 0xf7, 0xff, 0x79, 0xce, 0xff, 0x62, 0x10, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x42, 0x50, 0x00, 0x00, 
+  0x00, 0xf0, 0x83, 0x03, 0x85, 0x00, 0x00, 0x00, 0x06, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x08, 0x42, 0x4f, 0x00, 0x00, 0xff, 0x41, 0x08, 0xfc, 0x39, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0xa2, 0xff, 
+  0xff, 0xff, 0x05, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xcf, 0x7b, 0xfc, 0x00, 0x00, 0xff, 0x21, 0x08, 0xdf, 0x4d, 0x6b, 0x0b, 0x89, 0x00, 0x00, 0x00, 0x05, 0xaf, 0x7b, 0x07, 0x61, 0x08, 0xd4, 
+  0x00, 0x00, 0xff, 0x0c, 0x63, 0xfc, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xa1, 0xff, 0xff, 0xff, 0x06, 0x7e, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0xe3, 0x18, 0xfb, 0x00, 0x00, 0xff, 0x86, 0x31, 0x7b, 
+  0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x87, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x08, 0x42, 0x5f, 0x00, 0x00, 0xff, 0x41, 0x08, 0xfb, 0xf8, 0xc5, 0xff, 0x9e, 0xf7, 0xff, 
+  0xdf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x05, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x6e, 0x73, 0xfc, 0x00, 0x00, 0xfc, 0x20, 0x00, 0xe8, 0x6d, 0x6b, 0x14, 0x8a, 0x00, 0x00, 0x00, 0x04, 0x10, 
+  0x84, 0x03, 0xaf, 0x7b, 0x07, 0x41, 0x08, 0xcf, 0x00, 0x00, 0xff, 0xc7, 0x39, 0xfb, 0x81, 0x7d, 0xef, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x07, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xf7, 0xbd, 0xff, 
+  0x41, 0x08, 0xfb, 0x00, 0x00, 0xff, 0x66, 0x31, 0x73, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x89, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x69, 0x4a, 0x3c, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xfc, 0xcf, 0x7b, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x9d, 0xff, 0xff, 0xff, 0x06, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x66, 0x31, 0xfc, 0x00, 0x00, 0xff, 0x61, 0x08, 0xcc, 
+  0xae, 0x73, 0x08, 0x10, 0x84, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x07, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0x04, 0x21, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x14, 0xa5, 0xff, 0xbf, 0xff, 0xff, 
+  0x9e, 0xf7, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x05, 0x5d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x8a, 0x52, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0x8a, 0x52, 0x33, 0x8e, 0x00, 0x00, 0x00, 0x07, 0x30, 
+  0x84, 0x03, 0x8e, 0x73, 0x03, 0x41, 0x08, 0xc0, 0x00, 0x00, 0xff, 0x61, 0x08, 0xfb, 0xb7, 0xbd, 0xff, 0xbe, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xdb, 0xde, 0xff, 0x14, 
+  0xa5, 0xff, 0x39, 0xce, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x07, 0x5d, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0x6e, 0x73, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x25, 0x29, 0x68, 0x00, 0x00, 0x00, 0xf0, 
+  0x83, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x06, 0x2d, 0x6b, 0x17, 0x41, 0x08, 0xd3, 0x00, 0x00, 0xff, 0x82, 0x10, 0xfb, 0x75, 0xad, 0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x87, 0xff, 0xff, 0xff, 
+  0x04, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xff, 0x00, 0x00, 0xff, 0x4d, 0x6b, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x81, 0x7d, 0xef, 0xff, 0x05, 0x4d, 0x6b, 0xfc, 
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x25, 0x29, 0x88, 0x00, 0x00, 0x00, 0x10, 0x84, 0x04, 0x8f, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x2d, 0x6b, 0x1f, 0x41, 0x08, 0xd7, 
+  0x00, 0x00, 0xff, 0x21, 0x08, 0xf8, 0x72, 0x94, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0x76, 0xb5, 0xff, 0x20, 0x00, 0xff, 0xae, 0x73, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0x08, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xfc, 0xe6, 0xff, 0x6a, 0x52, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x24, 0x21, 0x93, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 
+  0x91, 0x00, 0x00, 0x00, 0x0a, 0xef, 0x7b, 0x03, 0x00, 0x00, 0x00, 0x2d, 0x6b, 0x1c, 0x41, 0x08, 0xcc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0xab, 0x5a, 0xff, 0xbb, 0xde, 0xff, 0xbe, 0xf7, 0xff, 
+  0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0xff, 0x00, 0x00, 0xff, 0x8e, 0x73, 0xff, 0x86, 0xff, 0xff, 0xff, 0x82, 0x9e, 
+  0xf7, 0xff, 0x01, 0x76, 0xb5, 0xff, 0x25, 0x29, 0xff, 0x81, 0x00, 0x00, 0xff, 0x00, 0x24, 0x21, 0x87, 0x95, 0x00, 0x00, 0x00, 0x09, 0xf0, 0x83, 0x03, 0x00, 0x00, 0x00, 0x2d, 0x6b, 0x0c, 0xe3, 
+  0x18, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0xc3, 0x18, 0xff, 0x71, 0x8c, 0xff, 0x1c, 0xe7, 0xff, 0xbf, 0xff, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0x02, 0x55, 0xad, 0xff, 0x00, 0x00, 0xff, 0x4d, 0x6b, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x01, 0x59, 0xce, 0xff, 
+  0xec, 0x62, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x01, 0x21, 0x08, 0xf0, 0xa7, 0x39, 0x5b, 0x97, 0x00, 0x00, 0x00, 0x12, 0xef, 0x7b, 0x03, 0x00, 0x00, 0x00, 0xa7, 0x39, 0x5c, 0x00, 0x00, 0xff, 0x20, 
+  0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x45, 0x29, 0xfb, 0x30, 0x84, 0xfc, 0x79, 0xce, 0xff, 0x7e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 
+  0x18, 0xc6, 0xff, 0x8a, 0x52, 0xff, 0xf3, 0x9c, 0xff, 0xbf, 0xff, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x0a, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0x3d, 0xef, 0xff, 0xb6, 0xb5, 0xff, 0xec, 0x62, 0xfc, 
+  0x61, 0x08, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0xec, 0x62, 0x18, 0x98, 0x00, 0x00, 0x00, 0x03, 0x4d, 0x6b, 0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xfc, 0x83, 0x00, 0x00, 0xff, 0x0e, 0x82, 0x10, 0xfc, 0x28, 0x42, 0xfb, 0x10, 0x84, 0xfc, 0x96, 0xb5, 0xfc, 0x9a, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0x7d, 0xef, 0xff, 0xdf, 0xff, 0xff, 
+  0x9e, 0xf7, 0xff, 0x3c, 0xe7, 0xff, 0xbb, 0xde, 0xff, 0x59, 0xce, 0xff, 0xf4, 0xa4, 0xfc, 0x8e, 0x73, 0xfc, 0x65, 0x29, 0xfb, 0x83, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 
+  0xff, 0x41, 0x08, 0xaf, 0x98, 0x00, 0x00, 0x00, 0x07, 0xe3, 0x18, 0x8b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xa7, 0x39, 0x64, 0x66, 0x31, 0x80, 0x00, 0x00, 
+  0xe0, 0x83, 0x00, 0x00, 0xff, 0x02, 0x41, 0x08, 0xfc, 0x04, 0x21, 0xfb, 0xc7, 0x39, 0xfb, 0x81, 0xe8, 0x41, 0xfb, 0x02, 0xa6, 0x31, 0xfb, 0xa2, 0x10, 0xfc, 0x41, 0x08, 0xff, 0x83, 0x00, 0x00, 
+  0xff, 0x07, 0x61, 0x08, 0xc8, 0x28, 0x42, 0x58, 0x04, 0x21, 0x94, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x49, 0x4a, 0x43, 0x96, 0x00, 0x00, 0x00, 0x05, 0xab, 
+  0x5a, 0x28, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x41, 0x08, 0xac, 0x81, 0x00, 0x00, 0x00, 0x04, 0x6d, 0x6b, 0x0f, 0x29, 0x4a, 0x4c, 0x04, 0x21, 0x94, 0x62, 
+  0x10, 0xcf, 0x00, 0x00, 0xef, 0x86, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xe4, 0xa3, 0x18, 0xbb, 0x66, 0x31, 0x7b, 0xab, 0x5a, 0x33, 0x81, 0x00, 0x00, 0x00, 0x06, 0x4d, 0x6b, 
+  0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x62, 0x10, 0xc7, 0xcf, 0x7b, 0x03, 0x93, 0x00, 0x00, 0x00, 0x09, 0xef, 0x7b, 0x03, 0x00, 0x00, 0x00, 0x04, 0x21, 
+  0x77, 0x00, 0x00, 0xff, 0x20, 0x00, 0xf4, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0xab, 0x5a, 0x28, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x83, 0x00, 0x00, 0x00, 0x09, 0x0c, 0x63, 0x1c, 0xeb, 0x5a, 
+  0x38, 0x86, 0x31, 0x53, 0x86, 0x31, 0x68, 0x86, 0x31, 0x70, 0x86, 0x31, 0x6f, 0x86, 0x31, 0x60, 0x08, 0x42, 0x48, 0x2c, 0x63, 0x30, 0x0c, 0x63, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x09, 0xef, 0x7b, 
+  0x04, 0x00, 0x00, 0x00, 0x25, 0x29, 0x68, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x20, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xab, 0x5a, 0x34, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x03, 0x91, 0x00, 0x00, 0x00, 
+  0x02, 0xef, 0x7b, 0x03, 0x00, 0x00, 0x00, 0x28, 0x42, 0x47, 0x82, 0x00, 0x00, 0xff, 0x02, 0xc3, 0x18, 0x88, 0x00, 0x00, 0x00, 0xf0, 0x83, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x83, 0x03, 
+  0x10, 0x84, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x83, 0x04, 0xf0, 0x83, 0x03, 0x81, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0x03, 0xae, 0x73, 0x04, 0x21, 0x08, 0xcb, 0x81, 0x00, 0x00, 0xff, 
+  0x01, 0x00, 0x00, 0xe3, 0x0c, 0x63, 0x17, 0x96, 0x00, 0x00, 0x00, 0x03, 0x29, 0x4a, 0x4c, 0x61, 0x08, 0xb0, 0xc3, 0x18, 0x8f, 0xae, 0x73, 0x07, 0x87, 0x00, 0x00, 0x00, 0x87, 0xf0, 0x83, 0x03, 
+  0x87, 0x00, 0x00, 0x00, 0x03, 0xcb, 0x5a, 0x27, 0xa3, 0x18, 0xab, 0xa2, 0x10, 0xa3, 0xaa, 0x52, 0x27, 0xc3, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x03, 0x8c, 0x31, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x31, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x04, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x73, 0x8e, 0x00, 0x63, 0x0c, 0x17, 0x63, 0x0c, 0x2b, 0x63, 0x0c, 0x1c, 0x6b, 0x4d, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x30, 0x00, 0x6b, 0x4d, 0x07, 0x63, 0x0c, 0x24, 0x63, 0x0c, 0x27, 0x63, 0x0c, 0x0f, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x52, 0x8a, 0x3b, 0x29, 0x45, 0x8c, 0x08, 0x41, 0xcf, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xef, 0x00, 0x00, 0xd7, 0x29, 0x45, 0x8c, 0x52, 0xaa, 0x27, 0x8c, 0x51, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x84, 0x10, 0x00, 0x52, 0x8a, 0x43, 0x18, 0xe3, 0xa8, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xe4, 0x10, 0x82, 0xbc, 0x29, 0x45, 0x73, 0x63, 0x2c, 0x1f, 0x8c, 0x31, 0x00, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x84, 0x30, 0x00, 0x52, 0x6a, 0x38, 0x10, 0xa2, 0xaf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf3, 0x29, 0x65, 0x6b, 0x7b, 0xef, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x6b, 0x4d, 0x0f, 0x21, 0x04, 0x9f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0x29, 0x45, 0x8c, 0x6b, 0x2d, 0x1b, 0x8c, 0x31, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x73, 0x8e, 0x07, 0x29, 0x25, 0x88, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0xe4, 0x8c, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x03, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x63, 0x0c, 0x10, 0x00, 0x20, 0xc8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0x31, 0xa6, 0x58, 0x7b, 0xcf, 0x00, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x73, 0x6e, 0x14, 0x10, 0x82, 0xc0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x20, 0xe4, 0x7c, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x03, 0x7b, 0xaf, 0x04, 0x00, 0x20, 0xbb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0x82, 0x8f, 0x73, 0xae, 0x00, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x63, 0x0c, 0x14, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x3c, 0x8c, 0x71, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x29, 0x45, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0x9b, 0x7b, 0xcf, 0x00, 0x84, 0x30, 0x03, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x00, 0x10, 0x82, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0x6b, 0x2d, 0x14, 0x84, 0x30, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x4a, 0x49, 0x44, 0x00, 0x00, 0xff, 0x00, 0x20, 0xfb, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x66, 0x68, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x51, 0x00, 0x4a, 0x29, 0x53, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x18, 0xe3, 0x90, 0x63, 0x0c, 0x17, 0x84, 0x10, 0x04, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x03, 0x84, 0x10, 0x03, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x04, 0x62, 0xec, 0x33, 0x08, 0x61, 0xb7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf3, 0x5a, 0xeb, 0x1b, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xcf, 0x00, 0x10, 0x62, 0xbc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xb3, 0x63, 0x0c, 0x28, 0x94, 0x72, 0x00, 0x94, 0x72, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x94, 0x92, 0x00, 0x84, 0x10, 0x00, 0x42, 0x28, 0x4f, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x86, 0x74, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x5a, 0xcb, 0x1b, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xc4, 0x4a, 0x69, 0x3f, 0x73, 0x8e, 0x00, 0x6b, 0x4d, 0x14, 0x42, 0x28, 0x4b, 0x42, 0x08, 0x6f, 0x18, 0xc3, 0x8b, 0x18, 0xc3, 0x9f, 0x18, 0xc3, 0xa4, 0x18, 0xc3, 0xa4, 0x18, 0xc3, 0x98, 0x29, 0x45, 0x80, 0x4a, 0x29, 0x64, 0x4a, 0x49, 0x37, 0x7b, 0xcf, 0x03, 0x6b, 0x2d, 0x00, 0x39, 0xa7, 0x67, 0x08, 0x21, 0xe4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0xbf, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x31, 0x00, 0x5a, 0xeb, 0x38, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xdc, 0x29, 0x25, 0x6f, 0x39, 0xe7, 0x38, 0x39, 0xa7, 0x74, 0x10, 0x62, 0xc8, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe8, 0x20, 0xe4, 0xaf, 0x4a, 0x49, 0x57, 0x42, 0x08, 0x37, 0x18, 0xe3, 0x8c, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x41, 0xd8, 0x73, 0x8e, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x31, 0x00, 0x5a, 0xeb, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x10, 0x82, 0x97, 0x29, 0x45, 0x68, 0x18, 0xc3, 0xa8, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x18, 0xc3, 0xff, 0x31, 0x66, 0xfb, 0x4a, 0x49, 0xfb, 0x6b, 0x2d, 0xfb, 0x73, 0x8e, 0xfc, 0x73, 0x6e, 0xfb, 0x62, 0xec, 0xfb, 0x39, 0xc7, 0xfb, 0x29, 0x45, 0xfc, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xe4, 0x29, 0x25, 0x84, 0x31, 0x86, 0x60, 0x10, 0x82, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x41, 0xdc, 0x73, 0x6e, 0x03, 0x84, 0x30, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x5a, 0xcb, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb0, 0x18, 0xc3, 0x77, 0x10, 0x82, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x31, 0x86, 0xfb, 0x73, 0xae, 0xfb, 0xb5, 0x96, 0xfc, 0xd6, 0xba, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xff, 0xe7, 0x3c, 0xff, 0xce, 0x39, 0xff, 0xa4, 0xf4, 0xfc, 0x5a, 0xcb, 0xfb, 0x18, 0xc3, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xe8, 0x18, 0xc3, 0x8f, 0x18, 0xe3, 0x74, 0x10, 0x82, 0xcc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0xcc, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x6b, 0x2d, 0x07, 0x00, 0x20, 0xdc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xd3, 0x29, 0x25, 0x63, 0x18, 0xc3, 0x8b, 0x00, 0x20, 0xf3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x52, 0x8a, 0xfc, 0xb5, 0x96, 0xff, 0xef, 0x3d, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xbd, 0xb7, 0xff, 0x29, 0x25, 0xff, 0x84, 0x30, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xde, 0xbb, 0xff, 0x94, 0x72, 0xff, 0x29, 0x65, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0x62, 0xd0, 0x29, 0x65, 0x60, 0x21, 0x04, 0x7b, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x20, 0xe4, 0x9c, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x18, 0xa3, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x29, 0x45, 0x7b, 0x31, 0x86, 0x33, 0x10, 0x82, 0xbc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x41, 0xe8, 0xfc, 0xbd, 0xb7, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xff, 0x00, 0x00, 0xff, 0x6b, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xe7, 0x3c, 0xff, 0x8c, 0x71, 0xff, 0x18, 0xc3, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0xe4, 0x7c, 0x4a, 0x49, 0x2b, 0x10, 0xa2, 0xa8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x41, 0xe8, 0x53, 0x8c, 0x51, 0x00, 0x7b, 0xef, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x4a, 0x69, 0x44, 0x00, 0x00, 0xff, 0x00, 0x20, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x61, 0xaf, 0x6b, 0x2d, 0x1f, 0x52, 0xaa, 0x30, 0x08, 0x21, 0xeb, 0x00, 0x00, 0xff, 0x08, 0x41, 0xfb, 0x8c, 0x31, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xff, 0x00, 0x20, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0xbe, 0xff, 0xd6, 0xba, 0xff, 0x52, 0x6a, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x18, 0xc3, 0xaf, 0x73, 0x6e, 0x03, 0x52, 0x6a, 0x4c, 0x08, 0x21, 0xd0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xe7, 0x63, 0x0c, 0x0f, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x10, 0x82, 0xc4, 0x00, 0x00, 0xff, 0x08, 0x61, 0xc8, 0x42, 0x08, 0x4c, 0x84, 0x30, 0x00, 0x5a, 0xcb, 0x38, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x18, 0xe3, 0xfb, 0xbd, 0xd7, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xff, 0x00, 0x00, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x10, 0x82, 0xc0, 0x84, 0x10, 0x00, 0x73, 0x8e, 0x07, 0x29, 0x65, 0x73, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 0x29, 0x25, 0x7c, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x4a, 0x69, 0x47, 0x29, 0x25, 0x77, 0x73, 0x8e, 0x04, 0x94, 0x92, 0x00, 0x52, 0x8a, 0x34, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x29, 0x45, 0xfc, 0xd6, 0x9a, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xff, 0x00, 0x20, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0xbe, 0xff, 0x9c, 0xb3, 0xff, 0x00, 0x20, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb7, 0x7b, 0xcf, 0x03, 0x8c, 0x51, 0x00, 0x6b, 0x4d, 0x1b, 0x18, 0xe3, 0x8f, 0x63, 0x2c, 0x1b, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x51, 0x00, 0x62, 0xec, 0x17, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x21, 0x04, 0xfb, 0xd6, 0xba, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0x9a, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xbf, 0xff, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x10, 0xa2, 0x90, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x04, 0x83, 0xf0, 0x00, 0x10, 0xa2, 0xaf, 0x00, 0x00, 0xff, 0x10, 0x82, 0xfb, 0xc6, 0x18, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xfb, 0xff, 0xad, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xbf, 0xff, 0x7b, 0xaf, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x41, 0xe8, 0x53, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x39, 0xc7, 0x5c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x9c, 0xf3, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0x29, 0x65, 0xff, 0x00, 0x00, 0xff, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0x4a, 0x49, 0xfc, 0x00, 0x00, 0xfc, 0x08, 0x21, 0xe4, 0x6b, 0x2d, 0x17, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x6b, 0x6d, 0x10, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xfc, 0x5a, 0xcb, 0xfc, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9c, 0xd3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x6d, 0xff, 0x4a, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0xd6, 0x9a, 0xff, 0x18, 0xa3, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x04, 0x93, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x31, 0x86, 0x7b, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xfb, 0xd6, 0x9a, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x42, 0x28, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0x8c, 0x71, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf4, 0x63, 0x0c, 0x24, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x6b, 0x6d, 0x10, 0x08, 0x21, 0xe7, 0x00, 0x00, 0xfc, 0x7b, 0xcf, 0xfc, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x3d, 0xff, 0x29, 0x65, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x24, 0x94, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x31, 0xa6, 0x64, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xfb, 0xd6, 0xba, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x42, 0x08, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbe, 0xff, 0x94, 0x92, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0x63, 0x0c, 0x17, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x10, 0x82, 0xbf, 0x00, 0x00, 0xff, 0x63, 0x0c, 0xfb, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xad, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x41, 0xe8, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xde, 0xdb, 0xff, 0x18, 0xa3, 0xfb, 0x00, 0x00, 0xff, 0x39, 0xc7, 0x60, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x5a, 0xeb, 0x1f, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0xb5, 0x76, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 0x39, 0xe7, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0x5a, 0xeb, 0xfb, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xb0, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x51, 0x00, 0x42, 0x08, 0x5c, 0x00, 0x00, 0xff, 0x21, 0x04, 0xfb, 0xe6, 0xfc, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 0x39, 0xe7, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xa5, 0x14, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe8, 0x6b, 0x6d, 0x0f, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x20, 0xe4, 0x93, 0x00, 0x00, 0xff, 0x4a, 0x49, 0xfb, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x41, 0xe8, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xce, 0x59, 0xff, 0x08, 0x41, 0xfc, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x38, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x10, 0xa2, 0xbf, 0x00, 0x00, 0xff, 0x84, 0x10, 0xfb, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x94, 0xb2, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0xad, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x10, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x3d, 0xff, 0x31, 0x86, 0xfb, 0x00, 0x00, 0xff, 0x42, 0x08, 0x64, 0x8c, 0x51, 0x00, 0x7b, 0xef, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x73, 0x6e, 0x03, 0x08, 0x61, 0xdc, 0x00, 0x00, 0xff, 0x94, 0xb2, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x94, 0xb2, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x35, 0xff, 0xe7, 0x3c, 0xff, 0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0x42, 0x08, 0xf8, 0x00, 0x00, 0xff, 0x29, 0x65, 0x87, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x5a, 0xcb, 0x14, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0xb5, 0x96, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x92, 0xff, 0x00, 0x20, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0x63, 0x2c, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0x9f, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x62, 0xec, 0x20, 0x00, 0x00, 0xf3, 0x08, 0x21, 0xff, 0xce, 0x79, 0xfc, 0xbd, 0xf7, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x73, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xeb, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x39, 0xe7, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xcb, 0xff, 0xf7, 0x9e, 0xff, 0x7b, 0xcf, 0xfb, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xab, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x5a, 0xeb, 0x23, 0x00, 0x00, 0xf4, 0x08, 0x21, 0xff, 0xd6, 0xba, 0xfc, 0xa5, 0x14, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x42, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xeb, 0xff, 0x00, 0x20, 0xff, 0x08, 0x41, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xff, 0xef, 0x7d, 0xff, 0x83, 0xf0, 0xfb, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xaf, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x62, 0xec, 0x1f, 0x00, 0x00, 0xf0, 0x08, 0x21, 0xff, 0xc6, 0x18, 0xfc, 0xef, 0x3d, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xff, 0xef, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xf7, 0xbe, 0xff, 0x7b, 0xaf, 0xfb, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xa8, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x5a, 0xcb, 0x10, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xff, 0xad, 0x55, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x51, 0xff, 0x29, 0x65, 0xff, 0x42, 0x08, 0xff, 0xce, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x5a, 0xeb, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0x98, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xaf, 0x00, 0x10, 0x82, 0xd8, 0x00, 0x00, 0xff, 0x94, 0x92, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0x41, 0xe8, 0xfb, 0x00, 0x00, 0xff, 0x39, 0xa7, 0x80, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x10, 0x82, 0xb7, 0x00, 0x00, 0xff, 0x7b, 0xcf, 0xfb, 0xf7, 0xbe, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xe7, 0x1c, 0xff, 0x29, 0x45, 0xfb, 0x00, 0x00, 0xff, 0x41, 0xe8, 0x5b, 0x8c, 0x51, 0x00, 0x7b, 0xef, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x30, 0x00, 0x29, 0x45, 0x88, 0x00, 0x00, 0xff, 0x42, 0x08, 0xfb, 0xf7, 0x7e, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xc6, 0x18, 0xff, 0x00, 0x20, 0xfc, 0x00, 0x00, 0xfc, 0x52, 0x8a, 0x2f, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x51, 0x00, 0x42, 0x28, 0x4f, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xfb, 0xde, 0xbb, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0x94, 0x92, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xdf, 0x73, 0x8e, 0x08, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x6b, 0x2d, 0x14, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0xa5, 0x14, 0xfc, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0x4a, 0x69, 0xfb, 0x00, 0x00, 0xff, 0x20, 0xe4, 0xa0, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x18, 0xc3, 0xac, 0x00, 0x00, 0xff, 0x52, 0x6a, 0xfb, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xce, 0x79, 0xff, 0x10, 0x62, 0xfc, 0x00, 0x00, 0xff, 0x42, 0x08, 0x50, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x42, 0x08, 0x4f, 0x00, 0x00, 0xff, 0x08, 0x41, 0xfc, 0xce, 0x39, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0x7b, 0xcf, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x21, 0xdf, 0x6b, 0x4d, 0x0b, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xaf, 0x07, 0x08, 0x61, 0xd4, 0x00, 0x00, 0xff, 0x63, 0x0c, 0xfc, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0xde, 0xdb, 0xff, 0x18, 0xe3, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x86, 0x7b, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x42, 0x08, 0x5f, 0x00, 0x00, 0xff, 0x08, 0x41, 0xfb, 0xc5, 0xf8, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0x73, 0x6e, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x20, 0xe8, 0x6b, 0x6d, 0x14, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x7b, 0xaf, 0x07, 0x08, 0x41, 0xcf, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xfb, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xbd, 0xf7, 0xff, 0x08, 0x41, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x66, 0x73, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x4a, 0x69, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x7b, 0xcf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0x31, 0x66, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x61, 0xcc, 0x73, 0xae, 0x08, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x8c, 0x31, 0x00, 0x21, 0x04, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0xa5, 0x14, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0x52, 0x8a, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0x52, 0x8a, 0x33, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x03, 0x73, 0x8e, 0x03, 0x08, 0x41, 0xc0, 0x00, 0x00, 0xff, 0x08, 0x61, 0xfb, 0xbd, 0xb7, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xff, 0xa5, 0x14, 0xff, 0xce, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0xbe, 0xff, 0x73, 0x6e, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x29, 0x25, 0x68, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x6b, 0x2d, 0x17, 0x08, 0x41, 0xd3, 0x00, 0x00, 0xff, 0x10, 0x82, 0xfb, 0xad, 0x75, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xff, 0x00, 0x00, 0xff, 0x6b, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0x6b, 0x4d, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x29, 0x25, 0x88, 0x84, 0x10, 0x00, 0x84, 0x10, 0x04, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x6b, 0x2d, 0x1f, 0x08, 0x41, 0xd7, 0x00, 0x00, 0xff, 0x08, 0x21, 0xf8, 0x94, 0x72, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xff, 0x00, 0x20, 0xff, 0x73, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xfc, 0xff, 0x52, 0x6a, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x24, 0x93, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x51, 0x00, 0x6b, 0x2d, 0x1c, 0x08, 0x41, 0xcc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x5a, 0xab, 0xff, 0xde, 0xbb, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xff, 0x00, 0x00, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xb5, 0x76, 0xff, 0x29, 0x25, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x21, 0x24, 0x87, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x03, 0x8c, 0x51, 0x00, 0x6b, 0x2d, 0x0c, 0x18, 0xe3, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x18, 0xc3, 0xff, 0x8c, 0x71, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xff, 0x00, 0x00, 0xff, 0x6b, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xce, 0x59, 0xff, 0x62, 0xec, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x08, 0x21, 0xf0, 0x39, 0xa7, 0x5b, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x71, 0x00, 0x39, 0xa7, 0x5c, 0x00, 0x00, 0xff, 0x00, 0x20, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x29, 0x45, 0xfb, 0x84, 0x30, 0xfc, 0xce, 0x79, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0xc6, 0x18, 0xff, 0x52, 0x8a, 0xff, 0x9c, 0xf3, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xb6, 0xff, 0x62, 0xec, 0xfc, 0x08, 0x61, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x62, 0xec, 0x18, 0x8c, 0x51, 0x00, 0x7b, 0xef, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x30, 0x00, 0x6b, 0x4d, 0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x10, 0x82, 0xfc, 0x42, 0x28, 0xfb, 0x84, 0x10, 0xfc, 0xb5, 0x96, 0xfc, 0xd6, 0x9a, 0xff, 0xde, 0xfb, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0xbb, 0xff, 0xce, 0x59, 0xff, 0xa4, 0xf4, 0xfc, 0x73, 0x8e, 0xfc, 0x29, 0x65, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x41, 0xaf, 0x7b, 0xef, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x30, 0x00, 0x18, 0xe3, 0x8b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x39, 0xa7, 0x64, 0x31, 0x66, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xfc, 0x21, 0x04, 0xfb, 0x39, 0xc7, 0xfb, 0x41, 0xe8, 0xfb, 0x41, 0xe8, 0xfb, 0x31, 0xa6, 0xfb, 0x10, 0xa2, 0xfc, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x08, 0x61, 0xc8, 0x42, 0x28, 0x58, 0x21, 0x04, 0x94, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x43, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x5a, 0xab, 0x28, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x41, 0xac, 0x7b, 0xcf, 0x00, 0x8c, 0x51, 0x00, 0x6b, 0x6d, 0x0f, 0x4a, 0x29, 0x4c, 0x21, 0x04, 0x94, 0x10, 0x62, 0xcf, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xe4, 0x18, 0xa3, 0xbb, 0x31, 0x66, 0x7b, 0x5a, 0xab, 0x33, 0x7b, 0xaf, 0x00, 0x94, 0x72, 0x00, 0x6b, 0x4d, 0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x10, 0x62, 0xc7, 0x7b, 0xcf, 0x03, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x51, 0x00, 0x21, 0x04, 0x77, 0x00, 0x00, 0xff, 0x00, 0x20, 0xf4, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x5a, 0xab, 0x28, 0x8c, 0x31, 0x00, 0x7b, 0xef, 0x04, 0x84, 0x30, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x30, 0x00, 0x7b, 0xaf, 0x00, 0x63, 0x0c, 0x1c, 0x5a, 0xeb, 0x38, 0x31, 0x86, 0x53, 0x31, 0x86, 0x68, 0x31, 0x86, 0x70, 0x31, 0x86, 0x6f, 0x31, 0x86, 0x60, 0x42, 0x08, 0x48, 0x63, 0x2c, 0x30, 0x63, 0x0c, 0x0f, 0x84, 0x10, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x04, 0x8c, 0x51, 0x00, 0x29, 0x25, 0x68, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x00, 0x20, 0xf8, 0x00, 0x00, 0xff, 0x5a, 0xab, 0x34, 0x8c, 0x51, 0x00, 0x7b, 0xef, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x7b, 0xef, 0x03, 0x8c, 0x51, 0x00, 0x42, 0x28, 0x47, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x18, 0xc3, 0x88, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x03, 0x84, 0x10, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x31, 0x00, 0x8c, 0x31, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x04, 0x83, 0xf0, 0x03, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x03, 0x73, 0xae, 0x04, 0x08, 0x21, 0xcb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe3, 0x63, 0x0c, 0x17, 0x8c, 0x31, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x4a, 0x29, 0x4c, 0x08, 0x61, 0xb0, 0x18, 0xc3, 0x8f, 0x73, 0xae, 0x07, 0x84, 0x30, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x31, 0x00, 0x5a, 0xcb, 0x27, 0x18, 0xa3, 0xab, 0x10, 0xa2, 0xa3, 0x52, 0xaa, 0x27, 0x84, 0x30, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
-  0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x83, 0xf0, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x8c, 0x51, 0x00, 0x83, 0xf0, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x83, 0xf0, 0x03, 0x83, 0xf0, 0x04, 0x84, 0x00, 0x00, 0x00, 0x81, 0x83, 0xf0, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x83, 0xf0, 0x03, 0x84, 
+  0x10, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x04, 0x94, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x63, 0x0c, 0x17, 0x63, 0x0c, 0x2b, 0x63, 0x0c, 0x1c, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x90, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x4d, 0x07, 0x63, 0x0c, 0x24, 0x63, 0x0c, 0x27, 0x63, 0x0c, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 
+  0x03, 0x91, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x81, 0x00, 0x00, 0x00, 0x08, 0x52, 0x8a, 0x3b, 0x29, 0x45, 0x8c, 0x08, 0x41, 0xcf, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xef, 
+  0x00, 0x00, 0xd7, 0x29, 0x45, 0x8c, 0x52, 0xaa, 0x27, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x52, 0x8a, 0x43, 0x18, 0xe3, 0xa8, 0x00, 0x00, 0xdf, 0x81, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xe4, 0x10, 
+  0x82, 0xbc, 0x29, 0x45, 0x73, 0x63, 0x2c, 0x1f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x90, 0x00, 0x00, 0x00, 0x01, 0x52, 0x6a, 0x38, 0x10, 0xa2, 0xaf, 0x87, 0x00, 0x00, 0xff, 0x01, 
+  0x00, 0x00, 0xf3, 0x29, 0x65, 0x6b, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x6b, 0x4d, 0x0f, 0x21, 0x04, 0x9f, 0x87, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xec, 0x29, 0x45, 0x8c, 0x6b, 0x2d, 0x1b, 0x8d, 
+  0x00, 0x00, 0x00, 0x07, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x73, 0x8e, 0x07, 0x29, 0x25, 0x88, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xfc, 
+  0x81, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x02, 0x20, 0xe4, 0x8c, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x88, 0x00, 0x00, 0x00, 0x02, 0x63, 0x0c, 
+  0x10, 0x00, 0x20, 0xc8, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x01, 
+  0x00, 0x00, 0xe3, 0x31, 0xa6, 0x58, 0x8d, 0x00, 0x00, 0x00, 0x04, 0x73, 0x6e, 0x14, 0x10, 0x82, 0xc0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x87, 0x00, 0x00, 0xff, 0x05, 0x00, 
+  0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x20, 0xe4, 0x7c, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x85, 0x00, 0x00, 0x00, 0x04, 0x84, 0x10, 0x03, 0x7b, 0xaf, 0x04, 0x00, 0x20, 0xbb, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0xf8, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x00, 0x10, 0x82, 0x8f, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x63, 0x0c, 0x14, 0x00, 0x00, 0xcf, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x8a, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x3c, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x83, 0x00, 0x00, 0x00, 0x04, 
+  0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x29, 0x45, 0x80, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x8a, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0x9b, 
+  0x00, 0x00, 0x00, 0x84, 0x30, 0x03, 0x88, 0x00, 0x00, 0x00, 0x02, 0x10, 0x82, 0xb0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x8c, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xe3, 0x6b, 0x2d, 0x14, 0x85, 0x00, 0x00, 0x00, 0x03, 0x4a, 0x49, 0x44, 0x00, 0x00, 0xff, 0x00, 0x20, 0xfb, 0x00, 0x00, 0xfb, 0x8b, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xfc, 0x00, 0x00, 
+  0xfb, 0x00, 0x00, 0xff, 0x31, 0x66, 0x68, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 0x7b, 0xef, 0x03, 0x00, 0x00, 0x00, 0x4a, 0x29, 0x53, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xf8, 0x8b, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x18, 0xe3, 0x90, 0x63, 0x0c, 0x17, 0x84, 0x10, 0x04, 0x83, 0xf0, 0x03, 0x81, 0x84, 
+  0x10, 0x03, 0x03, 0x83, 0xf0, 0x04, 0x84, 0x10, 0x04, 0x62, 0xec, 0x33, 0x08, 0x61, 0xb7, 0x81, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x8a, 0x00, 0x00, 0xff, 0x03, 0x00, 
+  0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf3, 0x5a, 0xeb, 0x1b, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x62, 0xbc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x89, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 
+  0xfc, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x01, 0x10, 0xa2, 0xb3, 0x63, 0x0c, 0x28, 0x89, 0x00, 0x00, 0x00, 0x01, 0x42, 0x28, 0x4f, 0x00, 0x00, 0xd4, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0xfb, 0x8a, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x86, 0x74, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x00, 0x00, 0x00, 0x03, 0x5a, 0xcb, 0x1b, 0x00, 0x00, 
+  0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x07, 0x08, 0x41, 0xc4, 0x4a, 0x69, 0x3f, 0x00, 0x00, 0x00, 0x6b, 0x4d, 0x14, 
+  0x42, 0x28, 0x4b, 0x42, 0x08, 0x6f, 0x18, 0xc3, 0x8b, 0x18, 0xc3, 0x9f, 0x81, 0x18, 0xc3, 0xa4, 0x07, 0x18, 0xc3, 0x98, 0x29, 0x45, 0x80, 0x4a, 0x29, 0x64, 0x4a, 0x49, 0x37, 0x7b, 0xcf, 0x03, 
+  0x00, 0x00, 0x00, 0x39, 0xa7, 0x67, 0x08, 0x21, 0xe4, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x88, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0xbf, 0x84, 
+  0x00, 0x00, 0x00, 0x03, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x5a, 0xeb, 0x38, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x86, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 
+  0x05, 0x08, 0x41, 0xdc, 0x29, 0x25, 0x6f, 0x39, 0xe7, 0x38, 0x39, 0xa7, 0x74, 0x10, 0x62, 0xc8, 0x00, 0x00, 0xf7, 0x89, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xe8, 0x20, 0xe4, 0xaf, 0x4a, 0x49, 
+  0x57, 0x42, 0x08, 0x37, 0x18, 0xe3, 0x8c, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x86, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x41, 0xd8, 0x84, 
+  0x00, 0x00, 0x00, 0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x5a, 0xeb, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x85, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xf0, 0x10, 0x82, 0x97, 0x29, 0x45, 0x68, 0x18, 0xc3, 0xa8, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0xff, 0x09, 0x18, 0xc3, 0xff, 0x31, 0x66, 0xfb, 0x4a, 0x49, 0xfb, 0x6b, 0x2d, 0xfb, 0x73, 
+  0x8e, 0xfc, 0x73, 0x6e, 0xfb, 0x62, 0xec, 0xfb, 0x39, 0xc7, 0xfb, 0x29, 0x45, 0xfc, 0x08, 0x41, 0xff, 0x82, 0x00, 0x00, 0xff, 0x03, 0x08, 0x41, 0xe4, 0x29, 0x25, 0x84, 0x31, 0x86, 0x60, 0x10, 
+  0x82, 0xb0, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x85, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x41, 0xdc, 0x73, 0x6e, 0x03, 0x85, 0x00, 0x00, 0x00, 0x03, 
+  0x5a, 0xcb, 0x28, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x83, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x02, 0x10, 0x82, 0xb0, 0x18, 0xc3, 0x77, 0x10, 
+  0x82, 0xb0, 0x82, 0x00, 0x00, 0xff, 0x06, 0x31, 0x86, 0xfb, 0x73, 0xae, 0xfb, 0xb5, 0x96, 0xfc, 0xd6, 0xba, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0x82, 0xf7, 0x9e, 0xff, 
+  0x05, 0xef, 0x7d, 0xff, 0xe7, 0x3c, 0xff, 0xce, 0x39, 0xff, 0xa4, 0xf4, 0xfc, 0x5a, 0xcb, 0xfb, 0x18, 0xc3, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x03, 0x08, 0x41, 0xe8, 0x18, 0xc3, 0x8f, 0x18, 0xe3, 
+  0x74, 0x10, 0x82, 0xcc, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x83, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0xcc, 0x86, 0x00, 0x00, 0x00, 0x03, 0x6b, 
+  0x2d, 0x07, 0x00, 0x20, 0xdc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x03, 0x08, 0x41, 0xd3, 0x29, 0x25, 0x63, 0x18, 0xc3, 
+  0x8b, 0x00, 0x20, 0xf3, 0x81, 0x00, 0x00, 0xff, 0x02, 0x52, 0x8a, 0xfc, 0xb5, 0x96, 0xff, 0xef, 0x3d, 0xff, 0x82, 0xf7, 0xbe, 0xff, 0x05, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xbd, 0xb7, 0xff, 
+  0x29, 0x25, 0xff, 0x84, 0x30, 0xff, 0xff, 0xdf, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x03, 0xf7, 0x9e, 0xff, 0xde, 0xbb, 0xff, 0x94, 0x72, 0xff, 0x29, 0x65, 0xfb, 0x81, 0x00, 
+  0x00, 0xff, 0x04, 0x10, 0x62, 0xd0, 0x29, 0x65, 0x60, 0x21, 0x04, 0x7b, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 
+  0xff, 0x20, 0xe4, 0x9c, 0x85, 0x00, 0x00, 0x00, 0x04, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x18, 0xa3, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xf7, 0x29, 0x45, 0x7b, 0x31, 0x86, 0x33, 0x10, 0x82, 0xbc, 0x81, 0x00, 0x00, 0xff, 0x01, 0x41, 0xe8, 0xfc, 0xbd, 0xb7, 0xff, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x83, 
+  0xff, 0xff, 0xff, 0x02, 0xad, 0x55, 0xff, 0x00, 0x00, 0xff, 0x6b, 0x6d, 0xff, 0x83, 0xff, 0xff, 0xff, 0x06, 0xff, 0xdf, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xe7, 0x3c, 
+  0xff, 0x8c, 0x71, 0xff, 0x18, 0xc3, 0xfb, 0x81, 0x00, 0x00, 0xff, 0x02, 0x20, 0xe4, 0x7c, 0x4a, 0x49, 0x2b, 0x10, 0xa2, 0xa8, 0x81, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 
+  0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x41, 0xe8, 0x53, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x03, 0x83, 0x00, 0x00, 0x00, 0x04, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x4a, 0x69, 0x44, 0x00, 0x00, 0xff, 
+  0x00, 0x20, 0xf8, 0x81, 0x00, 0x00, 0xff, 0x07, 0x08, 0x61, 0xaf, 0x6b, 0x2d, 0x1f, 0x52, 0xaa, 0x30, 0x08, 0x21, 0xeb, 0x00, 0x00, 0xff, 0x08, 0x41, 0xfb, 0x8c, 0x31, 0xff, 0xef, 0x7d, 0xff, 
+  0x81, 0xf7, 0x9e, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xff, 0x00, 0x20, 0xff, 0x73, 0x8e, 0xff, 0x86, 0xff, 0xff, 0xff, 
+  0x0a, 0xff, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0xbe, 0xff, 0xd6, 0xba, 0xff, 0x52, 0x6a, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x18, 0xc3, 0xaf, 0x73, 0x6e, 0x03, 0x52, 0x6a, 0x4c, 0x08, 
+  0x21, 0xd0, 0x81, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xe7, 0x63, 0x0c, 0x0f, 0x88, 0x00, 0x00, 0x00, 0x0c, 0x10, 0x82, 0xc4, 0x00, 0x00, 0xff, 0x08, 0x61, 0xc8, 0x42, 0x08, 
+  0x4c, 0x00, 0x00, 0x00, 0x5a, 0xcb, 0x38, 0x00, 0x00, 0xf7, 0x00, 0x00, 0xff, 0x18, 0xe3, 0xfb, 0xbd, 0xd7, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xdf, 0xff, 0x85, 0xff, 0xff, 0xff, 
+  0x04, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xff, 0x00, 0x00, 0xff, 0x73, 0x8e, 0xff, 0x88, 0xff, 0xff, 0xff, 0x0e, 0xf7, 0xbe, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0x7b, 0xcf, 
+  0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x10, 0x82, 0xc0, 0x00, 0x00, 0x00, 0x73, 0x8e, 0x07, 0x29, 0x65, 0x73, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 0x29, 0x25, 0x7c, 0x00, 0x00, 0x00, 0x83, 
+  0xf0, 0x03, 0x87, 0x00, 0x00, 0x00, 0x0a, 0x4a, 0x69, 0x47, 0x29, 0x25, 0x77, 0x73, 0x8e, 0x04, 0x00, 0x00, 0x00, 0x52, 0x8a, 0x34, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x29, 0x45, 0xfc, 0xd6, 
+  0x9a, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xad, 0x55, 0xff, 0x00, 0x20, 0xff, 0x73, 0x8e, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x0a, 0xef, 0x7d, 0xff, 0xf7, 0xbe, 
+  0xff, 0x9c, 0xb3, 0xff, 0x00, 0x20, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0xb7, 0x7b, 0xcf, 0x03, 0x00, 0x00, 0x00, 0x6b, 0x4d, 0x1b, 0x18, 0xe3, 0x8f, 0x63, 0x2c, 0x1b, 0x8c, 0x00, 0x00, 0x00, 
+  0x06, 0x62, 0xec, 0x17, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xff, 0x21, 0x04, 0xfb, 0xd6, 0xba, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xef, 0x5d, 0xff, 0xd6, 0x9a, 
+  0xff, 0xe7, 0x1c, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x05, 0xef, 0x7d, 0xff, 0xff, 0xbf, 0xff, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x10, 0xa2, 0x90, 0x8e, 0x00, 0x00, 0x00, 0x09, 
+  0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x10, 0xa2, 0xaf, 0x00, 0x00, 0xff, 0x10, 0x82, 0xfb, 0xc6, 0x18, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xfb, 0xff, 0xad, 0x35, 0xff, 0x99, 0xff, 
+  0xff, 0xff, 0x07, 0xef, 0x7d, 0xff, 0xff, 0xbf, 0xff, 0x7b, 0xaf, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x41, 0xe8, 0x53, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x04, 0x8a, 0x00, 0x00, 0x00, 0x0d, 
+  0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x39, 0xc7, 0x5c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x9c, 0xf3, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0x29, 0x65, 0xff, 0x00, 0x00, 
+  0xff, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x05, 0xef, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0x4a, 0x49, 0xfc, 
+  0x00, 0x00, 0xfc, 0x08, 0x21, 0xe4, 0x6b, 0x2d, 0x17, 0x8c, 0x00, 0x00, 0x00, 0x08, 0x6b, 0x6d, 0x10, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xfc, 0x5a, 0xcb, 0xfc, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9c, 0xd3, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0x6b, 0x6d, 0xff, 0x4a, 
+  0x29, 0xff, 0x84, 0xff, 0xff, 0xff, 0x06, 0xf7, 0x7e, 0xff, 0xd6, 0x9a, 0xff, 0x18, 0xa3, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x04, 0x93, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x88, 0x00, 0x00, 0x00, 
+  0x06, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x31, 0x86, 0x7b, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xfb, 0xd6, 0x9a, 0xff, 0xf7, 0x7e, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xa4, 0xf4, 0xff, 0x81, 0x00, 
+  0x00, 0xff, 0x00, 0xa5, 0x14, 0xff, 0x90, 0xff, 0xff, 0xff, 0x00, 0x7b, 0xcf, 0xff, 0x81, 0x00, 0x00, 0xff, 0x01, 0x42, 0x28, 0xff, 0xf7, 0x7e, 0xff, 0x82, 0xff, 0xff, 0xff, 0x81, 0xf7, 0xbe, 
+  0xff, 0x03, 0x8c, 0x71, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf4, 0x63, 0x0c, 0x24, 0x8a, 0x00, 0x00, 0x00, 0x05, 0x6b, 0x6d, 0x10, 0x08, 0x21, 0xe7, 0x00, 0x00, 0xfc, 0x7b, 0xcf, 0xfc, 0xff, 
+  0xbf, 0xff, 0xf7, 0xbe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 
+  0xff, 0x8c, 0xff, 0xff, 0xff, 0x05, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xef, 0x7d, 0xff, 0x83, 0xff, 0xff, 0xff, 0x06, 0xf7, 0x7e, 0xff, 
+  0xef, 0x3d, 0xff, 0x29, 0x65, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x24, 0x94, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x86, 0x00, 0x00, 0x00, 0x06, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x64, 
+  0x00, 0x00, 0xff, 0x10, 0xa2, 0xfb, 0xd6, 0xba, 0xff, 0xf7, 0x9e, 0xff, 0x84, 0xff, 0xff, 0xff, 0x07, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 
+  0xa5, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x05, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x42, 0x08, 0xff, 0xf7, 0xbe, 0xff, 
+  0x84, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xf7, 0xbe, 0xff, 0x94, 0x92, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0x63, 0x0c, 0x17, 0x89, 0x00, 0x00, 0x00, 0x02, 0x10, 0x82, 0xbf, 0x00, 
+  0x00, 0xff, 0x63, 0x0c, 0xfb, 0x81, 0xf7, 0xbe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0xff, 0x81, 0x00, 0x00, 0xff, 0x02, 0xad, 0x35, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xdf, 0xff, 0x88, 0xff, 0xff, 0xff, 0x05, 0x7b, 0xcf, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x41, 0xe8, 0xff, 0xf7, 0x9e, 0xff, 0x86, 0xff, 0xff, 0xff, 
+  0x06, 0xf7, 0x9e, 0xff, 0xde, 0xdb, 0xff, 0x18, 0xa3, 0xfb, 0x00, 0x00, 0xff, 0x39, 0xc7, 0x60, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x86, 0x00, 0x00, 0x00, 0x04, 0x5a, 0xeb, 0x1f, 0x00, 0x00, 
+  0xf7, 0x00, 0x00, 0xff, 0xb5, 0x76, 0xff, 0xf7, 0xbe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x07, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x35, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x05, 0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 0x39, 0xe7, 0xff, 0xf7, 0x9e, 0xff, 0x87, 0xff, 
+  0xff, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x02, 0x5a, 0xeb, 0xfb, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xb0, 0x86, 0x00, 0x00, 0x00, 0x06, 0x7b, 0xef, 0x03, 0x00, 0x00, 0x00, 0x42, 0x08, 0x5c, 0x00, 0x00, 
+  0xff, 0x21, 0x04, 0xfb, 0xe6, 0xfc, 0xff, 0xf7, 0x9e, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x05, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 
+  0xff, 0x84, 0xff, 0xff, 0xff, 0x05, 0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 0x39, 0xe7, 0xff, 0xf7, 0x9e, 0xff, 0x88, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 
+  0xff, 0xbf, 0xff, 0xa5, 0x14, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe8, 0x6b, 0x6d, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x06, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x93, 0x00, 0x00, 0xff, 
+  0x4a, 0x49, 0xfb, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0x89, 0xff, 0xff, 0xff, 0x10, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb3, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x55, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x41, 0xe8, 0xff, 0xf7, 0x9e, 
+  0xff, 0x8a, 0xff, 0xff, 0xff, 0x04, 0xf7, 0xbe, 0xff, 0xce, 0x59, 0xff, 0x08, 0x41, 0xfc, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x38, 0x87, 0x00, 0x00, 0x00, 0x04, 0x10, 0xa2, 0xbf, 0x00, 0x00, 0xff, 
+  0x84, 0x10, 0xfb, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x94, 0xb2, 0xff, 0x00, 0x00, 0xff, 0x08, 0x21, 0xff, 0xad, 0x55, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x05, 0x84, 0x10, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xf7, 0x9e, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x06, 0xf7, 0x9e, 0xff, 0xef, 
+  0x3d, 0xff, 0x31, 0x86, 0xfb, 0x00, 0x00, 0xff, 0x42, 0x08, 0x64, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x03, 0x84, 0x00, 0x00, 0x00, 0x03, 0x73, 0x6e, 0x03, 0x08, 0x61, 0xdc, 0x00, 0x00, 0xff, 0x94, 
+  0xb2, 0xfc, 0x81, 0xff, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x94, 0xb2, 0xff, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0xad, 0x35, 0xff, 0xe7, 0x3c, 0xff, 
+  0x83, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xff, 0xf7, 0x7e, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x06, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0x42, 0x08, 0xf8, 
+  0x00, 0x00, 0xff, 0x29, 0x65, 0x87, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x84, 0x00, 0x00, 0x00, 0x04, 0x5a, 0xcb, 0x14, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xff, 0xb5, 0x96, 0xfc, 0xff, 0xdf, 0xff, 
+  0x8f, 0xff, 0xff, 0xff, 0x03, 0x94, 0x92, 0xff, 0x00, 0x20, 0xff, 0x00, 0x00, 0xff, 0x08, 0x41, 0xff, 0x82, 0x00, 0x00, 0xff, 0x01, 0x39, 0xc7, 0xff, 0xf7, 0x7e, 0xff, 0x8e, 0xff, 0xff, 0xff, 
+  0x03, 0xf7, 0xbe, 0xff, 0x63, 0x2c, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0x9f, 0x86, 0x00, 0x00, 0x00, 0x05, 0x62, 0xec, 0x20, 0x00, 0x00, 0xf3, 0x08, 0x21, 0xff, 0xce, 0x79, 0xfc, 0xbd, 0xf7, 
+  0xff, 0x42, 0x08, 0xff, 0x81, 0x42, 0x28, 0xff, 0x01, 0x42, 0x08, 0xff, 0x73, 0xae, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xeb, 0xff, 0x83, 0x00, 0x00, 
+  0xff, 0x01, 0x39, 0xe7, 0xff, 0xf7, 0x7e, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xb5, 0x96, 0xff, 0x42, 0x08, 0xff, 0x81, 0x42, 0x28, 0xff, 0x05, 0x42, 0x08, 0xff, 0x5a, 0xcb, 0xff, 0xf7, 0x9e, 
+  0xff, 0x7b, 0xcf, 0xfb, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xab, 0x86, 0x00, 0x00, 0x00, 0x04, 0x5a, 0xeb, 0x23, 0x00, 0x00, 0xf4, 0x08, 0x21, 0xff, 0xd6, 0xba, 0xfc, 0xa5, 0x14, 0xff, 0x83, 0x00, 
+  0x00, 0xff, 0x00, 0x42, 0x08, 0xff, 0x89, 0xff, 0xff, 0xff, 0x09, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xeb, 0xff, 0x00, 0x20, 0xff, 0x08, 0x41, 0xff, 0x08, 0x21, 0xff, 0x00, 0x00, 0xff, 
+  0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0x9c, 0xd3, 0xff, 0x83, 0x00, 0x00, 0xff, 0x04, 0x10, 0xa2, 0xff, 0xef, 0x7d, 0xff, 0x83, 0xf0, 0xfb, 0x00, 
+  0x00, 0xff, 0x10, 0xa2, 0xaf, 0x86, 0x00, 0x00, 0x00, 0x05, 0x62, 0xec, 0x1f, 0x00, 0x00, 0xf0, 0x08, 0x21, 0xff, 0xc6, 0x18, 0xfc, 0xef, 0x3d, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 
+  0x01, 0xd6, 0x7a, 0xff, 0xde, 0xdb, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xa4, 0xf4, 0xff, 0x82, 0x00, 0x00, 0xff, 0x01, 0x10, 0xa2, 0xff, 0xef, 0x3d, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xef, 
+  0x5d, 0xff, 0xd6, 0x7a, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x03, 0xf7, 0xbe, 0xff, 0x7b, 0xaf, 0xfb, 0x00, 0x00, 0xff, 0x10, 0xa2, 0xa8, 0x86, 0x00, 0x00, 0x00, 0x04, 0x5a, 0xcb, 0x10, 0x00, 0x00, 
+  0xe8, 0x00, 0x00, 0xff, 0xad, 0x55, 0xfc, 0xff, 0xdf, 0xff, 0x91, 0xff, 0xff, 0xff, 0x03, 0x8c, 0x51, 0xff, 0x29, 0x65, 0xff, 0x42, 0x08, 0xff, 0xce, 0x59, 0xff, 0x91, 0xff, 0xff, 0xff, 0x05, 
+  0xf7, 0x9e, 0xff, 0x5a, 0xeb, 0xfb, 0x00, 0x00, 0xff, 0x10, 0x82, 0x98, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x10, 0x82, 0xd8, 0x00, 0x00, 0xff, 0x94, 0x92, 0xfc, 
+  0x81, 0xff, 0xdf, 0xff, 0xa5, 0xff, 0xff, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x04, 0x41, 0xe8, 0xfb, 0x00, 0x00, 0xff, 0x39, 0xa7, 0x80, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x85, 0x00, 0x00, 0x00, 
+  0x04, 0x10, 0x82, 0xb7, 0x00, 0x00, 0xff, 0x7b, 0xcf, 0xfb, 0xf7, 0xbe, 0xff, 0xff, 0xdf, 0xff, 0xa5, 0xff, 0xff, 0xff, 0x06, 0xf7, 0xbe, 0xff, 0xe7, 0x1c, 0xff, 0x29, 0x45, 0xfb, 0x00, 0x00, 
+  0xff, 0x41, 0xe8, 0x5b, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x03, 0x83, 0x00, 0x00, 0x00, 0x06, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x29, 0x45, 0x88, 0x00, 0x00, 0xff, 0x42, 0x08, 0xfb, 0xf7, 0x7e, 
+  0xff, 0xf7, 0xbe, 0xff, 0xa5, 0xff, 0xff, 0xff, 0x04, 0xf7, 0xbe, 0xff, 0xc6, 0x18, 0xff, 0x00, 0x20, 0xfc, 0x00, 0x00, 0xfc, 0x52, 0x8a, 0x2f, 0x85, 0x00, 0x00, 0x00, 0x06, 0x7b, 0xef, 0x03, 
+  0x00, 0x00, 0x00, 0x42, 0x28, 0x4f, 0x00, 0x00, 0xff, 0x18, 0xa3, 0xfb, 0xde, 0xbb, 0xff, 0xf7, 0x9e, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0x94, 0x92, 0xfc, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xdf, 0x73, 0x8e, 0x08, 0x87, 0x00, 0x00, 0x00, 0x05, 0x6b, 0x2d, 0x14, 0x00, 0x00, 0xef, 0x00, 0x00, 0xff, 0xa5, 0x14, 0xfc, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 
+  0xa3, 0xff, 0xff, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x04, 0x4a, 0x69, 0xfb, 0x00, 0x00, 0xff, 0x20, 0xe4, 0xa0, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x87, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc3, 0xac, 
+  0x00, 0x00, 0xff, 0x52, 0x6a, 0xfb, 0x81, 0xf7, 0x9e, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x06, 0xf7, 0x9e, 0xff, 0xce, 0x79, 0xff, 0x10, 0x62, 0xfc, 0x00, 0x00, 0xff, 0x42, 0x08, 0x50, 0x00, 0x00, 
+  0x00, 0x83, 0xf0, 0x03, 0x85, 0x00, 0x00, 0x00, 0x06, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x42, 0x08, 0x4f, 0x00, 0x00, 0xff, 0x08, 0x41, 0xfc, 0xce, 0x39, 0xff, 0xf7, 0x9e, 0xff, 0xa2, 0xff, 
+  0xff, 0xff, 0x05, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0x7b, 0xcf, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x21, 0xdf, 0x6b, 0x4d, 0x0b, 0x89, 0x00, 0x00, 0x00, 0x05, 0x7b, 0xaf, 0x07, 0x08, 0x61, 0xd4, 
+  0x00, 0x00, 0xff, 0x63, 0x0c, 0xfc, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xa1, 0xff, 0xff, 0xff, 0x06, 0xf7, 0x7e, 0xff, 0xde, 0xdb, 0xff, 0x18, 0xe3, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x86, 0x7b, 
+  0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x87, 0x00, 0x00, 0x00, 0x07, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x42, 0x08, 0x5f, 0x00, 0x00, 0xff, 0x08, 0x41, 0xfb, 0xc5, 0xf8, 0xff, 0xf7, 0x9e, 0xff, 
+  0xff, 0xdf, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x05, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0x73, 0x6e, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x20, 0xe8, 0x6b, 0x6d, 0x14, 0x8a, 0x00, 0x00, 0x00, 0x04, 0x84, 
+  0x10, 0x03, 0x7b, 0xaf, 0x07, 0x08, 0x41, 0xcf, 0x00, 0x00, 0xff, 0x39, 0xc7, 0xfb, 0x81, 0xef, 0x7d, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x07, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xbd, 0xf7, 0xff, 
+  0x08, 0x41, 0xfb, 0x00, 0x00, 0xff, 0x31, 0x66, 0x73, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x89, 0x00, 0x00, 0x00, 0x07, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x4a, 0x69, 0x3c, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xfc, 0x7b, 0xcf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0x9d, 0xff, 0xff, 0xff, 0x06, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0x31, 0x66, 0xfc, 0x00, 0x00, 0xff, 0x08, 0x61, 0xcc, 
+  0x73, 0xae, 0x08, 0x84, 0x10, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x07, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x21, 0x04, 0x88, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0xa5, 0x14, 0xff, 0xff, 0xbf, 0xff, 
+  0xf7, 0x9e, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x05, 0xef, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0x52, 0x8a, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf7, 0x52, 0x8a, 0x33, 0x8e, 0x00, 0x00, 0x00, 0x07, 0x84, 
+  0x30, 0x03, 0x73, 0x8e, 0x03, 0x08, 0x41, 0xc0, 0x00, 0x00, 0xff, 0x08, 0x61, 0xfb, 0xbd, 0xb7, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x7e, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xde, 0xdb, 0xff, 0xa5, 
+  0x14, 0xff, 0xce, 0x39, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x07, 0xef, 0x5d, 0xff, 0xf7, 0xbe, 0xff, 0x73, 0x6e, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x29, 0x25, 0x68, 0x00, 0x00, 0x00, 0x83, 
+  0xf0, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x06, 0x6b, 0x2d, 0x17, 0x08, 0x41, 0xd3, 0x00, 0x00, 0xff, 0x10, 0x82, 0xfb, 0xad, 0x75, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x7d, 0xff, 0x87, 0xff, 0xff, 0xff, 
+  0x04, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xff, 0x00, 0x00, 0xff, 0x6b, 0x4d, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x81, 0xef, 0x7d, 0xff, 0x05, 0x6b, 0x4d, 0xfc, 
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x29, 0x25, 0x88, 0x00, 0x00, 0x00, 0x84, 0x10, 0x04, 0x8f, 0x00, 0x00, 0x00, 0x09, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x6b, 0x2d, 0x1f, 0x08, 0x41, 0xd7, 
+  0x00, 0x00, 0xff, 0x08, 0x21, 0xf8, 0x94, 0x72, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0xbe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0xb5, 0x76, 0xff, 0x00, 0x20, 0xff, 0x73, 0xae, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0x08, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xfc, 0xff, 0x52, 0x6a, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x21, 0x24, 0x93, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 
+  0x91, 0x00, 0x00, 0x00, 0x0a, 0x7b, 0xef, 0x03, 0x00, 0x00, 0x00, 0x6b, 0x2d, 0x1c, 0x08, 0x41, 0xcc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x5a, 0xab, 0xff, 0xde, 0xbb, 0xff, 0xf7, 0xbe, 0xff, 
+  0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0xff, 0x00, 0x00, 0xff, 0x73, 0x8e, 0xff, 0x86, 0xff, 0xff, 0xff, 0x82, 0xf7, 
+  0x9e, 0xff, 0x01, 0xb5, 0x76, 0xff, 0x29, 0x25, 0xff, 0x81, 0x00, 0x00, 0xff, 0x00, 0x21, 0x24, 0x87, 0x95, 0x00, 0x00, 0x00, 0x09, 0x83, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x6b, 0x2d, 0x0c, 0x18, 
+  0xe3, 0x9c, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x18, 0xc3, 0xff, 0x8c, 0x71, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xbf, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0x02, 0xad, 0x55, 0xff, 0x00, 0x00, 0xff, 0x6b, 0x4d, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x01, 0xce, 0x59, 0xff, 
+  0x62, 0xec, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x01, 0x08, 0x21, 0xf0, 0x39, 0xa7, 0x5b, 0x97, 0x00, 0x00, 0x00, 0x12, 0x7b, 0xef, 0x03, 0x00, 0x00, 0x00, 0x39, 0xa7, 0x5c, 0x00, 0x00, 0xff, 0x00, 
+  0x20, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x29, 0x45, 0xfb, 0x84, 0x30, 0xfc, 0xce, 0x79, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 
+  0xc6, 0x18, 0xff, 0x52, 0x8a, 0xff, 0x9c, 0xf3, 0xff, 0xff, 0xbf, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x0a, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0xb6, 0xff, 0x62, 0xec, 0xfc, 
+  0x08, 0x61, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xef, 0x62, 0xec, 0x18, 0x98, 0x00, 0x00, 0x00, 0x03, 0x6b, 0x4d, 0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0xfc, 0x83, 0x00, 0x00, 0xff, 0x0e, 0x10, 0x82, 0xfc, 0x42, 0x28, 0xfb, 0x84, 0x10, 0xfc, 0xb5, 0x96, 0xfc, 0xd6, 0x9a, 0xff, 0xde, 0xfb, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xdf, 0xff, 
+  0xf7, 0x9e, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0xbb, 0xff, 0xce, 0x59, 0xff, 0xa4, 0xf4, 0xfc, 0x73, 0x8e, 0xfc, 0x29, 0x65, 0xfb, 0x83, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 
+  0xff, 0x08, 0x41, 0xaf, 0x98, 0x00, 0x00, 0x00, 0x07, 0x18, 0xe3, 0x8b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x39, 0xa7, 0x64, 0x31, 0x66, 0x80, 0x00, 0x00, 
+  0xe0, 0x83, 0x00, 0x00, 0xff, 0x02, 0x08, 0x41, 0xfc, 0x21, 0x04, 0xfb, 0x39, 0xc7, 0xfb, 0x81, 0x41, 0xe8, 0xfb, 0x02, 0x31, 0xa6, 0xfb, 0x10, 0xa2, 0xfc, 0x08, 0x41, 0xff, 0x83, 0x00, 0x00, 
+  0xff, 0x07, 0x08, 0x61, 0xc8, 0x42, 0x28, 0x58, 0x21, 0x04, 0x94, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x4a, 0x49, 0x43, 0x96, 0x00, 0x00, 0x00, 0x05, 0x5a, 
+  0xab, 0x28, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xff, 0x08, 0x41, 0xac, 0x81, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x6d, 0x0f, 0x4a, 0x29, 0x4c, 0x21, 0x04, 0x94, 0x10, 
+  0x62, 0xcf, 0x00, 0x00, 0xef, 0x86, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xe4, 0x18, 0xa3, 0xbb, 0x31, 0x66, 0x7b, 0x5a, 0xab, 0x33, 0x81, 0x00, 0x00, 0x00, 0x06, 0x6b, 0x4d, 
+  0x13, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x10, 0x62, 0xc7, 0x7b, 0xcf, 0x03, 0x93, 0x00, 0x00, 0x00, 0x09, 0x7b, 0xef, 0x03, 0x00, 0x00, 0x00, 0x21, 0x04, 
+  0x77, 0x00, 0x00, 0xff, 0x00, 0x20, 0xf4, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf8, 0x5a, 0xab, 0x28, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x83, 0x00, 0x00, 0x00, 0x09, 0x63, 0x0c, 0x1c, 0x5a, 0xeb, 
+  0x38, 0x31, 0x86, 0x53, 0x31, 0x86, 0x68, 0x31, 0x86, 0x70, 0x31, 0x86, 0x6f, 0x31, 0x86, 0x60, 0x42, 0x08, 0x48, 0x63, 0x2c, 0x30, 0x63, 0x0c, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x09, 0x7b, 0xef, 
+  0x04, 0x00, 0x00, 0x00, 0x29, 0x25, 0x68, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf7, 0x00, 0x20, 0xf8, 0x00, 0x00, 0xff, 0x5a, 0xab, 0x34, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x03, 0x91, 0x00, 0x00, 0x00, 
+  0x02, 0x7b, 0xef, 0x03, 0x00, 0x00, 0x00, 0x42, 0x28, 0x47, 0x82, 0x00, 0x00, 0xff, 0x02, 0x18, 0xc3, 0x88, 0x00, 0x00, 0x00, 0x83, 0xf0, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0x83, 0xf0, 0x03, 
+  0x84, 0x10, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x83, 0xf0, 0x04, 0x83, 0xf0, 0x03, 0x81, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0x03, 0x73, 0xae, 0x04, 0x08, 0x21, 0xcb, 0x81, 0x00, 0x00, 0xff, 
+  0x01, 0x00, 0x00, 0xe3, 0x63, 0x0c, 0x17, 0x96, 0x00, 0x00, 0x00, 0x03, 0x4a, 0x29, 0x4c, 0x08, 0x61, 0xb0, 0x18, 0xc3, 0x8f, 0x73, 0xae, 0x07, 0x87, 0x00, 0x00, 0x00, 0x87, 0x83, 0xf0, 0x03, 
+  0x87, 0x00, 0x00, 0x00, 0x03, 0x5a, 0xcb, 0x27, 0x18, 0xa3, 0xab, 0x10, 0xa2, 0xa3, 0x52, 0xaa, 0x27, 0xc3, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7e, 0x7e, 0x7e, 0x04, 0x82, 0x82, 0x82, 0x00, 0x86, 0x86, 0x86, 0x00, 0x86, 0x86, 0x86, 0x00, 0x86, 0x86, 0x86, 0x00, 0x85, 0x85, 0x85, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x03, 0x85, 0x85, 0x85, 0x00, 0x87, 0x87, 0x87, 0x00, 0x87, 0x87, 0x87, 0x00, 0x86, 0x86, 0x86, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x04, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x88, 0x88, 0x88, 0x00, 0x87, 0x87, 0x87, 0x00, 0x72, 0x72, 0x72, 0x00, 0x5f, 0x5f, 0x5f, 0x17, 0x60, 0x60, 0x60, 0x2b, 0x5f, 0x5f, 0x5f, 0x1c, 0x67, 0x67, 0x67, 0x00, 0x86, 0x86, 0x86, 0x00, 0x88, 0x88, 0x88, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x87, 0x87, 0x87, 0x00, 0x83, 0x83, 0x83, 0x00, 0x67, 0x67, 0x67, 0x07, 0x5f, 0x5f, 0x5f, 0x24, 0x5f, 0x5f, 0x5f, 0x27, 0x60, 0x60, 0x60, 0x0f, 0x7e, 0x7e, 0x7e, 0x00, 0x85, 0x85, 0x85, 0x00, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x88, 0x88, 0x88, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x52, 0x52, 0x52, 0x3b, 0x29, 0x29, 0x29, 0x8c, 0x09, 0x09, 0x09, 0xcf, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xd7, 0x2a, 0x2a, 0x2a, 0x8c, 0x54, 0x54, 0x54, 0x27, 0x87, 0x87, 0x87, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x86, 0x86, 0x86, 0x00, 0x80, 0x80, 0x80, 0x00, 0x50, 0x50, 0x50, 0x43, 0x1b, 0x1b, 0x1b, 0xa8, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xe4, 0x11, 0x11, 0x11, 0xbc, 0x28, 0x28, 0x28, 0x73, 0x64, 0x64, 0x64, 0x1f, 0x86, 0x86, 0x86, 0x00, 0x85, 0x85, 0x85, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x83, 0x83, 0x83, 0x00, 0x83, 0x83, 0x83, 0x00, 0x4e, 0x4e, 0x4e, 0x38, 0x14, 0x14, 0x14, 0xaf, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf3, 0x2b, 0x2b, 0x2b, 0x6b, 0x7b, 0x7b, 0x7b, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x86, 0x86, 0x86, 0x00, 0x6a, 0x6a, 0x6a, 0x0f, 0x1f, 0x1f, 0x1f, 0x9f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xec, 0x29, 0x29, 0x29, 0x8c, 0x65, 0x65, 0x65, 0x1b, 0x85, 0x85, 0x85, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x87, 0x87, 0x00, 0x72, 0x72, 0x72, 0x07, 0x25, 0x25, 0x25, 0x88, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x1e, 0x1e, 0x8c, 0x7e, 0x7e, 0x7e, 0x00, 0x81, 0x81, 0x81, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x85, 0x85, 0x85, 0x00, 0x60, 0x60, 0x60, 0x10, 0x03, 0x03, 0x03, 0xc8, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x34, 0x34, 0x34, 0x58, 0x7a, 0x7a, 0x7a, 0x00, 0x83, 0x83, 0x83, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x82, 0x82, 0x82, 0x00, 0x6d, 0x6d, 0x6d, 0x14, 0x11, 0x11, 0x11, 0xc0, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x1e, 0x1e, 0x7c, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x82, 0x82, 0x82, 0x03, 0x76, 0x76, 0x76, 0x04, 0x04, 0x04, 0x04, 0xbb, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x12, 0x12, 0x8f, 0x73, 0x73, 0x73, 0x00, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x5f, 0x5f, 0x5f, 0x14, 0x01, 0x01, 0x01, 0xcf, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x48, 0x48, 0x48, 0x3c, 0x8b, 0x8b, 0x8b, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x89, 0x89, 0x89, 0x00, 0x27, 0x27, 0x27, 0x80, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0x9b, 0x77, 0x77, 0x77, 0x00, 0x83, 0x83, 0x83, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7b, 0x7b, 0x7b, 0x00, 0x11, 0x11, 0x11, 0xb0, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x66, 0x66, 0x66, 0x14, 0x83, 0x83, 0x83, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x86, 0x86, 0x86, 0x00, 0x49, 0x49, 0x49, 0x44, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xfb, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x2d, 0x2d, 0x68, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x89, 0x89, 0x89, 0x00, 0x45, 0x45, 0x45, 0x53, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf7, 0x1c, 0x1c, 0x1c, 0x90, 0x60, 0x60, 0x60, 0x17, 0x82, 0x82, 0x82, 0x04, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x03, 0x7f, 0x7f, 0x7f, 0x03, 0x7e, 0x7e, 0x7e, 0x04, 0x82, 0x82, 0x82, 0x04, 0x5d, 0x5d, 0x5d, 0x33, 0x0b, 0x0b, 0x0b, 0xb7, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xf3, 0x5c, 0x5c, 0x5c, 0x1b, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x81, 0x81, 0x81, 0x00, 0x77, 0x77, 0x77, 0x00, 0x0d, 0x0d, 0x0d, 0xbc, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xb3, 0x62, 0x62, 0x62, 0x28, 0x8d, 0x8d, 0x8d, 0x00, 0x8d, 0x8d, 0x8d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x81, 0x81, 0x81, 0x00, 0x81, 0x81, 0x81, 0x00, 0x81, 0x81, 0x81, 0x00, 0x81, 0x81, 0x81, 0x00, 0x83, 0x83, 0x83, 0x00, 0x8f, 0x8f, 0x8f, 0x00, 0x82, 0x82, 0x82, 0x00, 0x43, 0x43, 0x43, 0x4f, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x2f, 0x2f, 0x2f, 0x74, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x5a, 0x5a, 0x5a, 0x1b, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xc4, 0x4b, 0x4b, 0x4b, 0x3f, 0x70, 0x70, 0x70, 0x00, 0x6a, 0x6a, 0x6a, 0x14, 0x44, 0x44, 0x44, 0x4b, 0x40, 0x40, 0x40, 0x6f, 0x19, 0x19, 0x19, 0x8b, 0x17, 0x17, 0x17, 0x9f, 0x17, 0x17, 0x17, 0xa4, 0x18, 0x18, 0x18, 0xa4, 0x17, 0x17, 0x17, 0x98, 0x27, 0x27, 0x27, 0x80, 0x46, 0x46, 0x46, 0x64, 0x4a, 0x4a, 0x4a, 0x37, 0x77, 0x77, 0x77, 0x03, 0x65, 0x65, 0x65, 0x00, 0x35, 0x35, 0x35, 0x67, 0x05, 0x05, 0x05, 0xe4, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0xbf, 0x81, 0x81, 0x81, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x86, 0x86, 0x86, 0x00, 0x5c, 0x5c, 0x5c, 0x38, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xdc, 0x25, 0x25, 0x25, 0x6f, 0x3c, 0x3c, 0x3c, 0x38, 0x36, 0x36, 0x36, 0x74, 0x0d, 0x0d, 0x0d, 0xc8, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xe8, 0x1e, 0x1e, 0x1e, 0xaf, 0x47, 0x47, 0x47, 0x57, 0x3f, 0x3f, 0x3f, 0x37, 0x1c, 0x1c, 0x1c, 0x8c, 0x01, 0x01, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xd8, 0x70, 0x70, 0x70, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x86, 0x86, 0x86, 0x00, 0x5c, 0x5c, 0x5c, 0x3c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf0, 0x11, 0x11, 0x11, 0x97, 0x2a, 0x2a, 0x2a, 0x68, 0x1a, 0x1a, 0x1a, 0xa8, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0xff, 0x2e, 0x2e, 0x2e, 0xfb, 0x47, 0x47, 0x47, 0xfb, 0x66, 0x66, 0x66, 0xfb, 0x70, 0x70, 0x70, 0xfc, 0x6d, 0x6d, 0x6d, 0xfb, 0x5e, 0x5e, 0x5e, 0xfb, 0x3a, 0x3a, 0x3a, 0xfb, 0x2a, 0x2a, 0x2a, 0xfc, 0x0a, 0x0a, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xe4, 0x25, 0x25, 0x25, 0x84, 0x32, 0x32, 0x32, 0x60, 0x0f, 0x0f, 0x0f, 0xb0, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xdc, 0x6d, 0x6d, 0x6d, 0x03, 0x83, 0x83, 0x83, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x5a, 0x5a, 0x5a, 0x28, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x12, 0x12, 0x12, 0xb0, 0x19, 0x19, 0x19, 0x77, 0x11, 0x11, 0x11, 0xb0, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x32, 0x32, 0x32, 0xfb, 0x73, 0x73, 0x73, 0xfb, 0xaf, 0xaf, 0xaf, 0xfc, 0xd3, 0xd3, 0xd3, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0x9d, 0x9d, 0x9d, 0xfc, 0x57, 0x57, 0x57, 0xfb, 0x17, 0x17, 0x17, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xe8, 0x17, 0x17, 0x17, 0x8f, 0x1c, 0x1c, 0x1c, 0x74, 0x0f, 0x0f, 0x0f, 0xcc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0xcc, 0x81, 0x81, 0x81, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x85, 0x85, 0x85, 0x00, 0x65, 0x65, 0x65, 0x07, 0x03, 0x03, 0x03, 0xdc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xd3, 0x25, 0x25, 0x25, 0x63, 0x18, 0x18, 0x18, 0x8b, 0x04, 0x04, 0x04, 0xf3, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x52, 0x52, 0x52, 0xfc, 0xb0, 0xb0, 0xb0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0x26, 0x26, 0x26, 0xff, 0x84, 0x84, 0x84, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x2b, 0x2b, 0x2b, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0e, 0x0e, 0xd0, 0x2b, 0x2b, 0x2b, 0x60, 0x22, 0x22, 0x22, 0x7b, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x1d, 0x1d, 0x9c, 0x81, 0x81, 0x81, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x82, 0x82, 0x82, 0x00, 0x16, 0x16, 0x16, 0x9c, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf7, 0x29, 0x29, 0x29, 0x7b, 0x30, 0x30, 0x30, 0x33, 0x12, 0x12, 0x12, 0xbc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d, 0x3d, 0xfc, 0xb6, 0xb6, 0xb6, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0x00, 0x00, 0x00, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x17, 0x17, 0x17, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x1e, 0x1e, 0x1e, 0x7c, 0x47, 0x47, 0x47, 0x2b, 0x13, 0x13, 0x13, 0xa8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x3e, 0x3e, 0x53, 0x89, 0x89, 0x89, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x87, 0x87, 0x00, 0x4c, 0x4c, 0x4c, 0x44, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x0b, 0x0b, 0xaf, 0x65, 0x65, 0x65, 0x1f, 0x53, 0x53, 0x53, 0x30, 0x06, 0x06, 0x06, 0xeb, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xfb, 0x86, 0x86, 0x86, 0xff, 0xec, 0xec, 0xec, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xad, 0xad, 0xad, 0xff, 0x03, 0x03, 0x03, 0xff, 0x72, 0x72, 0x72, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xee, 0xee, 0xee, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x4e, 0x4e, 0x4e, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0xaf, 0x6d, 0x6d, 0x6d, 0x03, 0x4d, 0x4d, 0x4d, 0x4c, 0x06, 0x06, 0x06, 0xd0, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xe7, 0x60, 0x60, 0x60, 0x0f, 0x84, 0x84, 0x84, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x11, 0x11, 0x11, 0xc4, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x0b, 0x0b, 0xc8, 0x41, 0x41, 0x41, 0x4c, 0x83, 0x83, 0x83, 0x00, 0x57, 0x57, 0x57, 0x38, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x1b, 0x1b, 0xfb, 0xb7, 0xb7, 0xb7, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xec, 0xec, 0xec, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xad, 0xad, 0xff, 0x00, 0x00, 0x00, 0xff, 0x71, 0x71, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xed, 0xed, 0xed, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x79, 0x79, 0x79, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0xc0, 0x7f, 0x7f, 0x7f, 0x00, 0x72, 0x72, 0x72, 0x07, 0x2b, 0x2b, 0x2b, 0x73, 0x02, 0x02, 0x02, 0xe7, 0x00, 0x00, 0x00, 0xff, 0x25, 0x25, 0x25, 0x7c, 0x87, 0x87, 0x87, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x89, 0x89, 0x89, 0x00, 0x4c, 0x4c, 0x4c, 0x47, 0x26, 0x26, 0x26, 0x77, 0x72, 0x72, 0x72, 0x04, 0x91, 0x91, 0x91, 0x00, 0x51, 0x51, 0x51, 0x34, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x2a, 0x2a, 0xfc, 0xcf, 0xcf, 0xcf, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0x03, 0x03, 0x03, 0xff, 0x70, 0x70, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x95, 0x95, 0x95, 0xff, 0x04, 0x04, 0x04, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x0f, 0x0f, 0xb7, 0x78, 0x78, 0x78, 0x03, 0x8a, 0x8a, 0x8a, 0x00, 0x67, 0x67, 0x67, 0x1b, 0x1b, 0x1b, 0x1b, 0x8f, 0x63, 0x63, 0x63, 0x1b, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x82, 0x82, 0x82, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x5e, 0x5e, 0x5e, 0x17, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xff, 0x22, 0x22, 0x22, 0xfb, 0xd4, 0xd4, 0xd4, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xea, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x95, 0x95, 0x95, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0x90, 0x7f, 0x7f, 0x7f, 0x00, 0x84, 0x84, 0x84, 0x00, 0x80, 0x80, 0x80, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x04, 0x7e, 0x7e, 0x7e, 0x00, 0x14, 0x14, 0x14, 0xaf, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x0f, 0x0f, 0xfb, 0xc1, 0xc1, 0xc1, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x76, 0x76, 0x76, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x3e, 0x3e, 0x53, 0x89, 0x89, 0x89, 0x00, 0x7d, 0x7d, 0x7d, 0x04, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x87, 0x87, 0x00, 0x39, 0x39, 0x39, 0x5c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x9b, 0x9b, 0x9b, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x00, 0x00, 0x00, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x4a, 0x4a, 0x4a, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x05, 0x05, 0x05, 0xe4, 0x65, 0x65, 0x65, 0x17, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x83, 0x83, 0x83, 0x00, 0x6c, 0x6c, 0x6c, 0x10, 0x02, 0x02, 0x02, 0xe4, 0x00, 0x00, 0x00, 0xfc, 0x57, 0x57, 0x57, 0xfc, 0xf2, 0xf2, 0xf2, 0xff, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x98, 0x98, 0x98, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x45, 0x45, 0x45, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xed, 0xed, 0xed, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x15, 0x15, 0x15, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x20, 0x20, 0x20, 0x93, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x88, 0x88, 0x00, 0x31, 0x31, 0x31, 0x7b, 0x00, 0x00, 0x00, 0xff, 0x15, 0x15, 0x15, 0xfb, 0xd2, 0xd2, 0xd2, 0xff, 0xee, 0xee, 0xee, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x77, 0x77, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x44, 0x44, 0x44, 0xff, 0xee, 0xee, 0xee, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x8b, 0x8b, 0x8b, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xf4, 0x60, 0x60, 0x60, 0x24, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x00, 0x6c, 0x6c, 0x6c, 0x10, 0x06, 0x06, 0x06, 0xe7, 0x00, 0x00, 0x00, 0xfc, 0x7a, 0x7a, 0x7a, 0xfc, 0xf5, 0xf5, 0xf5, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x78, 0x78, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0x39, 0x39, 0xff, 0xec, 0xec, 0xec, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x2c, 0x2c, 0x2c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x24, 0x24, 0x24, 0x94, 0x85, 0x85, 0x85, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x88, 0x88, 0x88, 0x00, 0x34, 0x34, 0x34, 0x64, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xfb, 0xd4, 0xd4, 0xd4, 0xff, 0xef, 0xef, 0xef, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0x79, 0xff, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x41, 0x41, 0x41, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x8f, 0x8f, 0x8f, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xec, 0x61, 0x61, 0x61, 0x17, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x11, 0x11, 0x11, 0xbf, 0x00, 0x00, 0x00, 0xff, 0x5f, 0x5f, 0x5f, 0xfb, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x98, 0x98, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0x16, 0x16, 0x16, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0x60, 0x89, 0x89, 0x89, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x85, 0x85, 0x85, 0x00, 0x5c, 0x5c, 0x5c, 0x1f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xff, 0xad, 0xad, 0xad, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x97, 0x97, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x5b, 0x5b, 0x5b, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xb0, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x89, 0x89, 0x89, 0x00, 0x3f, 0x3f, 0x3f, 0x5c, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x1f, 0x1f, 0xfb, 0xdd, 0xdd, 0xdd, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x96, 0x96, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x9f, 0x9f, 0x9f, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe8, 0x6c, 0x6c, 0x6c, 0x0f, 0x84, 0x84, 0x84, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x80, 0x80, 0x80, 0x00, 0x1e, 0x1e, 0x1e, 0x93, 0x00, 0x00, 0x00, 0xff, 0x4a, 0x4a, 0x4a, 0xfb, 0xf0, 0xf0, 0xf0, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x95, 0x95, 0xff, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x0a, 0x0a, 0x0a, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x48, 0x48, 0x48, 0x38, 0x87, 0x87, 0x87, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x81, 0x81, 0x81, 0x00, 0x13, 0x13, 0x13, 0xbf, 0x00, 0x00, 0x00, 0xff, 0x80, 0x80, 0x80, 0xfb, 0xf5, 0xf5, 0xf5, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x94, 0x94, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x30, 0x30, 0x30, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0x64, 0x89, 0x89, 0x89, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x83, 0x83, 0x83, 0x00, 0x6e, 0x6e, 0x6e, 0x03, 0x0b, 0x0b, 0x0b, 0xdc, 0x00, 0x00, 0x00, 0xff, 0x94, 0x94, 0x94, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x93, 0x93, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0x39, 0x39, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xff, 0x41, 0x41, 0x41, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x2b, 0x2b, 0x2b, 0x87, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x59, 0x59, 0x59, 0x14, 0x00, 0x00, 0x00, 0xeb, 0x01, 0x01, 0x01, 0xff, 0xb1, 0xb1, 0xb1, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x91, 0x91, 0xff, 0x04, 0x04, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x38, 0x38, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x64, 0x64, 0x64, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0x9f, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x86, 0x86, 0x86, 0x00, 0x5d, 0x5d, 0x5d, 0x20, 0x00, 0x00, 0x00, 0xf3, 0x05, 0x05, 0x05, 0xff, 0xcc, 0xcc, 0xcc, 0xfc, 0xbc, 0xbc, 0xbc, 0xff, 0x41, 0x41, 0x41, 0xff, 0x43, 0x43, 0x43, 0xff, 0x44, 0x44, 0x44, 0xff, 0x41, 0x41, 0x41, 0xff, 0x74, 0x74, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x40, 0x40, 0x40, 0xff, 0x44, 0x44, 0x44, 0xff, 0x43, 0x43, 0x43, 0xff, 0x41, 0x41, 0x41, 0xff, 0x57, 0x57, 0x57, 0xff, 0xef, 0xef, 0xef, 0xff, 0x79, 0x79, 0x79, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xab, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x87, 0x87, 0x87, 0x00, 0x5c, 0x5c, 0x5c, 0x23, 0x00, 0x00, 0x00, 0xf4, 0x05, 0x05, 0x05, 0xff, 0xd4, 0xd4, 0xd4, 0xfc, 0xa2, 0xa2, 0xa2, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x03, 0x03, 0x03, 0xff, 0x07, 0x07, 0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x7e, 0x7e, 0x7e, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x13, 0x13, 0x13, 0xaf, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x86, 0x86, 0x86, 0x00, 0x5d, 0x5d, 0x5d, 0x1f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x05, 0x05, 0xff, 0xc2, 0xc2, 0xc2, 0xfc, 0xe6, 0xe6, 0xe6, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x13, 0x13, 0x13, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x76, 0x76, 0x76, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xa8, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x5a, 0x5a, 0x5a, 0x10, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xff, 0xaa, 0xaa, 0xaa, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x42, 0x42, 0x42, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x5c, 0x5c, 0x5c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0x98, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x81, 0x81, 0x81, 0x00, 0x76, 0x76, 0x76, 0x00, 0x0f, 0x0f, 0x0f, 0xd8, 0x00, 0x00, 0x00, 0xff, 0x90, 0x90, 0x90, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xef, 0xef, 0xef, 0xff, 0x3d, 0x3d, 0x3d, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x35, 0x35, 0x35, 0x80, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x11, 0x11, 0x11, 0xb7, 0x00, 0x00, 0x00, 0xff, 0x77, 0x77, 0x77, 0xfb, 0xf4, 0xf4, 0xf4, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x2a, 0x2a, 0x2a, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x3e, 0x3e, 0x5b, 0x89, 0x89, 0x89, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x83, 0x83, 0x83, 0x00, 0x27, 0x27, 0x27, 0x88, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x3f, 0x3f, 0xfb, 0xee, 0xee, 0xee, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x03, 0x03, 0x03, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x52, 0x52, 0x52, 0x2f, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x89, 0x89, 0x89, 0x00, 0x43, 0x43, 0x43, 0x4f, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xfb, 0xd5, 0xd5, 0xd5, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x91, 0x91, 0x91, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xdf, 0x70, 0x70, 0x70, 0x08, 0x83, 0x83, 0x83, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x84, 0x84, 0x84, 0x00, 0x65, 0x65, 0x65, 0x14, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xff, 0x9f, 0x9f, 0x9f, 0xfc, 0xf5, 0xf5, 0xf5, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x4c, 0x4c, 0x4c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x1d, 0x1d, 0xa0, 0x82, 0x82, 0x82, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x17, 0x17, 0x17, 0xac, 0x01, 0x01, 0x01, 0xff, 0x4d, 0x4d, 0x4d, 0xfb, 0xf0, 0xf0, 0xf0, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x0d, 0x0d, 0x0d, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x42, 0x42, 0x42, 0x50, 0x89, 0x89, 0x89, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x89, 0x89, 0x89, 0x00, 0x3f, 0x3f, 0x3f, 0x4f, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xfc, 0xc6, 0xc6, 0xc6, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x7a, 0x7a, 0x7a, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x05, 0x05, 0x05, 0xdf, 0x6a, 0x6a, 0x6a, 0x0b, 0x84, 0x84, 0x84, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x82, 0x82, 0x82, 0x00, 0x76, 0x76, 0x76, 0x07, 0x0c, 0x0c, 0x0c, 0xd4, 0x00, 0x00, 0x00, 0xff, 0x61, 0x61, 0x61, 0xfc, 0xf4, 0xf4, 0xf4, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xee, 0xee, 0xee, 0xff, 0xda, 0xda, 0xda, 0xff, 0x1b, 0x1b, 0x1b, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x30, 0x30, 0x30, 0x7b, 0x88, 0x88, 0x88, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x89, 0x89, 0x89, 0x00, 0x3f, 0x3f, 0x3f, 0x5f, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xfb, 0xbe, 0xbe, 0xbe, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x6e, 0x6e, 0x6e, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x04, 0x04, 0xe8, 0x6b, 0x6b, 0x6b, 0x14, 0x83, 0x83, 0x83, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x81, 0x81, 0x81, 0x03, 0x76, 0x76, 0x76, 0x07, 0x07, 0x07, 0x07, 0xcf, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0xfb, 0xeb, 0xeb, 0xeb, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0x08, 0x08, 0x08, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x2d, 0x2d, 0x73, 0x88, 0x88, 0x88, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x87, 0x87, 0x00, 0x4c, 0x4c, 0x4c, 0x3c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x79, 0x79, 0x79, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x2e, 0x2e, 0x2e, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x0b, 0x0b, 0xcc, 0x73, 0x73, 0x73, 0x08, 0x82, 0x82, 0x82, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x85, 0x85, 0x85, 0x00, 0x22, 0x22, 0x22, 0x88, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xfb, 0x9f, 0x9f, 0x9f, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xea, 0xea, 0xea, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x50, 0x50, 0x50, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf7, 0x50, 0x50, 0x50, 0x33, 0x89, 0x89, 0x89, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x03, 0x6f, 0x6f, 0x6f, 0x03, 0x07, 0x07, 0x07, 0xc0, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0c, 0xfb, 0xb5, 0xb5, 0xb5, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xda, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xea, 0xea, 0xea, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x26, 0x26, 0x26, 0x68, 0x86, 0x86, 0x86, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x00, 0x66, 0x66, 0x66, 0x17, 0x08, 0x08, 0x08, 0xd3, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0xfb, 0xab, 0xab, 0xab, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x69, 0x69, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xec, 0xec, 0xec, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x69, 0x69, 0x69, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x25, 0x25, 0x25, 0x88, 0x81, 0x81, 0x81, 0x00, 0x7f, 0x7f, 0x7f, 0x04, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x87, 0x87, 0x00, 0x66, 0x66, 0x66, 0x1f, 0x07, 0x07, 0x07, 0xd7, 0x00, 0x00, 0x00, 0xff, 0x05, 0x05, 0x05, 0xf8, 0x8d, 0x8d, 0x8d, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xed, 0xed, 0xed, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xae, 0xae, 0xff, 0x03, 0x03, 0x03, 0xff, 0x73, 0x73, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xee, 0xee, 0xee, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xde, 0xde, 0xde, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x23, 0x23, 0x23, 0x93, 0x81, 0x81, 0x81, 0x00, 0x80, 0x80, 0x80, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x88, 0x88, 0x88, 0x00, 0x65, 0x65, 0x65, 0x1c, 0x07, 0x07, 0x07, 0xcc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x56, 0x56, 0x56, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xad, 0xad, 0xad, 0xff, 0x02, 0x02, 0x02, 0xff, 0x72, 0x72, 0x72, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xae, 0xae, 0xae, 0xff, 0x25, 0x25, 0x25, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x24, 0x24, 0x24, 0x87, 0x81, 0x81, 0x81, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x88, 0x88, 0x00, 0x65, 0x65, 0x65, 0x0c, 0x1c, 0x1c, 0x1c, 0x9c, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x17, 0x17, 0x17, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x69, 0x69, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x05, 0x05, 0x05, 0xf0, 0x35, 0x35, 0x35, 0x5b, 0x7e, 0x7e, 0x7e, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7b, 0x7b, 0x7b, 0x03, 0x8c, 0x8c, 0x8c, 0x00, 0x35, 0x35, 0x35, 0x5c, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x29, 0x29, 0x29, 0xfb, 0x83, 0x83, 0x83, 0xfc, 0xcc, 0xcc, 0xcc, 0xff, 0xed, 0xed, 0xed, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x52, 0x52, 0x52, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0x5e, 0x5e, 0x5e, 0xfc, 0x0b, 0x0b, 0x0b, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xef, 0x5d, 0x5d, 0x5d, 0x18, 0x87, 0x87, 0x87, 0x00, 0x7c, 0x7c, 0x7c, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x84, 0x84, 0x84, 0x00, 0x6a, 0x6a, 0x6a, 0x13, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x0f, 0x0f, 0xfc, 0x44, 0x44, 0x44, 0xfb, 0x80, 0x80, 0x80, 0xfc, 0xb0, 0xb0, 0xb0, 0xfc, 0xcf, 0xcf, 0xcf, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xec, 0xec, 0xec, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x9d, 0x9d, 0x9d, 0xfc, 0x6f, 0x6f, 0x6f, 0xfc, 0x2b, 0x2b, 0x2b, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xaf, 0x7b, 0x7b, 0x7b, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x83, 0x83, 0x83, 0x00, 0x1c, 0x1c, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x35, 0x35, 0x35, 0x64, 0x2d, 0x2d, 0x2d, 0x80, 0x02, 0x02, 0x02, 0xe0, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xfc, 0x20, 0x20, 0x20, 0xfb, 0x38, 0x38, 0x38, 0xfb, 0x3e, 0x3e, 0x3e, 0xfb, 0x3e, 0x3e, 0x3e, 0xfb, 0x33, 0x33, 0x33, 0xfb, 0x14, 0x14, 0x14, 0xfc, 0x08, 0x08, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0c, 0xc8, 0x43, 0x43, 0x43, 0x58, 0x21, 0x21, 0x21, 0x94, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x47, 0x47, 0x47, 0x43, 0x8a, 0x8a, 0x8a, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x87, 0x87, 0x87, 0x00, 0x55, 0x55, 0x55, 0x28, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xac, 0x7a, 0x7a, 0x7a, 0x00, 0x87, 0x87, 0x87, 0x00, 0x6b, 0x6b, 0x6b, 0x0f, 0x45, 0x45, 0x45, 0x4c, 0x1f, 0x1f, 0x1f, 0x94, 0x0e, 0x0e, 0x0e, 0xcf, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xe4, 0x16, 0x16, 0x16, 0xbb, 0x2e, 0x2e, 0x2e, 0x7b, 0x56, 0x56, 0x56, 0x33, 0x75, 0x75, 0x75, 0x00, 0x8e, 0x8e, 0x8e, 0x00, 0x67, 0x67, 0x67, 0x13, 0x02, 0x02, 0x02, 0xe7, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0e, 0x0e, 0xc7, 0x79, 0x79, 0x79, 0x03, 0x81, 0x81, 0x81, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x88, 0x88, 0x88, 0x00, 0x22, 0x22, 0x22, 0x77, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xf4, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xf8, 0x55, 0x55, 0x55, 0x28, 0x86, 0x86, 0x86, 0x00, 0x7c, 0x7c, 0x7c, 0x04, 0x84, 0x84, 0x84, 0x00, 0x88, 0x88, 0x88, 0x00, 0x84, 0x84, 0x84, 0x00, 0x76, 0x76, 0x76, 0x00, 0x60, 0x60, 0x60, 0x1c, 0x5c, 0x5c, 0x5c, 0x38, 0x32, 0x32, 0x32, 0x53, 0x31, 0x31, 0x31, 0x68, 0x31, 0x31, 0x31, 0x70, 0x32, 0x32, 0x32, 0x6f, 0x31, 0x31, 0x31, 0x60, 0x40, 0x40, 0x40, 0x48, 0x63, 0x63, 0x63, 0x30, 0x62, 0x62, 0x62, 0x0f, 0x80, 0x80, 0x80, 0x00, 0x86, 0x86, 0x86, 0x00, 0x87, 0x87, 0x87, 0x00, 0x81, 0x81, 0x81, 0x00, 0x7c, 0x7c, 0x7c, 0x04, 0x87, 0x87, 0x87, 0x00, 0x26, 0x26, 0x26, 0x68, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xf7, 0x03, 0x03, 0x03, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x55, 0x55, 0x55, 0x34, 0x88, 0x88, 0x88, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x88, 0x88, 0x88, 0x00, 0x44, 0x44, 0x44, 0x47, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1a, 0x1a, 0x1a, 0x88, 0x83, 0x83, 0x83, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x03, 0x82, 0x82, 0x82, 0x00, 0x86, 0x86, 0x86, 0x00, 0x87, 0x87, 0x87, 0x00, 0x88, 0x88, 0x88, 0x00, 0x89, 0x89, 0x89, 0x00, 0x89, 0x89, 0x89, 0x00, 0x89, 0x89, 0x89, 0x00, 0x89, 0x89, 0x89, 0x00, 0x88, 0x88, 0x88, 0x00, 0x86, 0x86, 0x86, 0x00, 0x86, 0x86, 0x86, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x04, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x81, 0x81, 0x81, 0x03, 0x73, 0x73, 0x73, 0x04, 0x06, 0x06, 0x06, 0xcb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x61, 0x61, 0x61, 0x17, 0x86, 0x86, 0x86, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x82, 0x82, 0x82, 0x00, 0x46, 0x46, 0x46, 0x4c, 0x0c, 0x0c, 0x0c, 0xb0, 0x19, 0x19, 0x19, 0x8f, 0x73, 0x73, 0x73, 0x07, 0x83, 0x83, 0x83, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x7e, 0x7e, 0x7e, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7e, 0x7e, 0x7e, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x7e, 0x7e, 0x7e, 0x03, 0x7e, 0x7e, 0x7e, 0x03, 0x7e, 0x7e, 0x7e, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x86, 0x86, 0x86, 0x00, 0x59, 0x59, 0x59, 0x27, 0x16, 0x16, 0x16, 0xab, 0x13, 0x13, 0x13, 0xa3, 0x53, 0x53, 0x53, 0x27, 0x84, 0x84, 0x84, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
-  0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x89, 0x89, 0x89, 0x00, 0x87, 0x87, 0x87, 0x00, 0x89, 0x89, 0x89, 0x00, 0x82, 0x82, 0x82, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x89, 0x89, 0x89, 0x00, 0x89, 0x89, 0x89, 0x00, 0x88, 0x88, 0x88, 0x00, 0x8a, 0x8a, 0x8a, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x80, 0x80, 0x80, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7d, 0x7d, 0x7d, 0x03, 0x7e, 0x7e, 0x7e, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7e, 0x7e, 0x7e, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7e, 0x7e, 0x7e, 0x03, 0x7f, 0x7f, 0x7f, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x04, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 
+  0x7d, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5f, 0x5f, 0x5f, 0x17, 0x60, 0x60, 0x60, 0x2b, 0x5f, 0x5f, 0x5f, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x90, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0x67, 0x67, 0x67, 0x07, 0x5f, 0x5f, 0x5f, 0x24, 0x5f, 0x5f, 0x5f, 0x27, 0x60, 0x60, 0x60, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x91, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x08, 0x52, 0x52, 0x52, 0x3b, 0x29, 0x29, 0x29, 0x8c, 0x09, 0x09, 0x09, 0xcf, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 
+  0x00, 0xf8, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xd7, 0x2a, 0x2a, 0x2a, 0x8c, 0x54, 0x54, 0x54, 0x27, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x50, 0x50, 0x43, 0x1b, 0x1b, 0x1b, 0xa8, 
+  0x00, 0x00, 0x00, 0xdf, 0x81, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0x00, 0xe4, 0x11, 0x11, 0x11, 0xbc, 0x28, 0x28, 0x28, 0x73, 0x64, 0x64, 0x64, 0x1f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x7e, 0x7e, 0x7e, 0x03, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x4e, 0x4e, 0x38, 0x14, 0x14, 0x14, 0xaf, 0x82, 0x00, 0x00, 0x00, 0xff, 0x82, 0x01, 0x01, 0x01, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0xff, 0x01, 0x00, 0x00, 0x00, 0xf3, 0x2b, 0x2b, 0x2b, 0x6b, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0x6a, 0x6a, 0x0f, 0x1f, 0x1f, 0x1f, 0x9f, 0x82, 0x00, 0x00, 0x00, 0xff, 0x82, 0x01, 0x01, 
+  0x01, 0xff, 0x81, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0xec, 0x29, 0x29, 0x29, 0x8c, 0x65, 0x65, 0x65, 0x1b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 
+  0x00, 0x00, 0x72, 0x72, 0x72, 0x07, 0x25, 0x25, 0x25, 0x88, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x81, 
+  0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x1e, 0x1e, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x81, 
+  0x03, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x60, 0x60, 0x10, 0x03, 0x03, 0x03, 0xc8, 0x00, 0x00, 0x00, 0xff, 0x81, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 
+  0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x34, 0x34, 0x34, 0x58, 0x8d, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0x6d, 0x6d, 0x6d, 0x14, 0x11, 0x11, 0x11, 0xc0, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x87, 0x00, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0x00, 0xfc, 
+  0x02, 0x02, 0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x1e, 0x1e, 0x1e, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0x82, 0x82, 0x82, 0x03, 0x76, 0x76, 
+  0x76, 0x04, 0x04, 0x04, 0x04, 0xbb, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x88, 0x00, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x12, 0x12, 0x12, 0x8f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x5f, 0x5f, 0x14, 0x01, 0x01, 0x01, 0xcf, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0xff, 0x05, 
+  0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x48, 0x48, 0x48, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7e, 0x7e, 
+  0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x80, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 
+  0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x83, 0x83, 0x83, 0x03, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11, 0xb0, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 
+  0x01, 0xf8, 0x8c, 0x00, 0x00, 0x00, 0xff, 0x03, 0x01, 0x01, 0x01, 0xf8, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x66, 0x66, 0x66, 0x14, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0x49, 0x49, 
+  0x49, 0x44, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xfb, 0x00, 0x00, 0x00, 0xfb, 0x8b, 0x00, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfb, 0x00, 0x00, 0x00, 0xff, 
+  0x2d, 0x2d, 0x2d, 0x68, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7c, 0x7c, 0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x45, 0x45, 0x45, 0x53, 0x00, 0x00, 
+  0x00, 0xff, 0x01, 0x01, 0x01, 0xf8, 0x8b, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf7, 0x1c, 0x1c, 0x1c, 0x90, 
+  0x60, 0x60, 0x60, 0x17, 0x82, 0x82, 0x82, 0x04, 0x7e, 0x7e, 0x7e, 0x03, 0x81, 0x7f, 0x7f, 0x7f, 0x03, 0x03, 0x7e, 0x7e, 0x7e, 0x04, 0x82, 0x82, 0x82, 0x04, 0x5d, 0x5d, 0x5d, 0x33, 0x0b, 0x0b, 
+  0x0b, 0xb7, 0x81, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x8a, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 
+  0x00, 0xf3, 0x5c, 0x5c, 0x5c, 0x1b, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x0d, 0x0d, 0xbc, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x89, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 
+  0x00, 0xfc, 0x01, 0x01, 0x01, 0xfb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x01, 0x14, 0x14, 0x14, 0xb3, 0x62, 0x62, 0x62, 0x28, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0x43, 0x43, 0x4f, 0x00, 0x00, 
+  0x00, 0xd4, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0xff, 0x04, 0x01, 0x01, 0x01, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x2f, 0x2f, 0x2f, 0x74, 0x00, 0x00, 
+  0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5a, 0x5a, 0x5a, 0x1b, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x88, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x11, 0x0a, 0x0a, 0x0a, 0xc4, 0x4b, 0x4b, 0x4b, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x6a, 0x6a, 0x14, 0x44, 0x44, 0x44, 0x4b, 
+  0x40, 0x40, 0x40, 0x6f, 0x19, 0x19, 0x19, 0x8b, 0x17, 0x17, 0x17, 0x9f, 0x17, 0x17, 0x17, 0xa4, 0x18, 0x18, 0x18, 0xa4, 0x17, 0x17, 0x17, 0x98, 0x27, 0x27, 0x27, 0x80, 0x46, 0x46, 0x46, 0x64, 
+  0x4a, 0x4a, 0x4a, 0x37, 0x77, 0x77, 0x77, 0x03, 0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x67, 0x05, 0x05, 0x05, 0xe4, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x88, 0x00, 
+  0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0xbf, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x5c, 
+  0x5c, 0x38, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x86, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x05, 0x08, 0x08, 0x08, 0xdc, 0x25, 
+  0x25, 0x25, 0x6f, 0x3c, 0x3c, 0x3c, 0x38, 0x36, 0x36, 0x36, 0x74, 0x0d, 0x0d, 0x0d, 0xc8, 0x00, 0x00, 0x00, 0xf7, 0x89, 0x00, 0x00, 0x00, 0xff, 0x06, 0x01, 0x01, 0x01, 0xe8, 0x1e, 0x1e, 0x1e, 
+  0xaf, 0x47, 0x47, 0x47, 0x57, 0x3f, 0x3f, 0x3f, 0x37, 0x1c, 0x1c, 0x1c, 0x8c, 0x01, 0x01, 0x01, 0xf4, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x86, 0x00, 0x00, 0x00, 0xff, 0x02, 
+  0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xd8, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x5c, 0x5c, 0x3c, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x85, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xf0, 0x11, 0x11, 0x11, 0x97, 
+  0x2a, 0x2a, 0x2a, 0x68, 0x1a, 0x1a, 0x1a, 0xa8, 0x00, 0x00, 0x00, 0xfb, 0x82, 0x00, 0x00, 0x00, 0xff, 0x09, 0x18, 0x18, 0x18, 0xff, 0x2e, 0x2e, 0x2e, 0xfb, 0x47, 0x47, 0x47, 0xfb, 0x66, 0x66, 
+  0x66, 0xfb, 0x70, 0x70, 0x70, 0xfc, 0x6d, 0x6d, 0x6d, 0xfb, 0x5e, 0x5e, 0x5e, 0xfb, 0x3a, 0x3a, 0x3a, 0xfb, 0x2a, 0x2a, 0x2a, 0xfc, 0x0a, 0x0a, 0x0a, 0xff, 0x82, 0x00, 0x00, 0x00, 0xff, 0x03, 
+  0x07, 0x07, 0x07, 0xe4, 0x25, 0x25, 0x25, 0x84, 0x32, 0x32, 0x32, 0x60, 0x0f, 0x0f, 0x0f, 0xb0, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0x01, 0xfb, 0x85, 0x00, 0x00, 0x00, 0xff, 0x03, 
+  0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xdc, 0x6d, 0x6d, 0x6d, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5a, 0x5a, 0x5a, 0x28, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x01, 
+  0x01, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x83, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0x01, 0xfb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x02, 0x12, 0x12, 0x12, 0xb0, 0x19, 0x19, 0x19, 0x77, 0x11, 0x11, 
+  0x11, 0xb0, 0x82, 0x00, 0x00, 0x00, 0xff, 0x07, 0x32, 0x32, 0x32, 0xfb, 0x73, 0x73, 0x73, 0xfb, 0xaf, 0xaf, 0xaf, 0xfc, 0xd3, 0xd3, 0xd3, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xef, 0xef, 0xef, 0xff, 
+  0xf3, 0xf3, 0xf3, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 0xff, 0x05, 0xeb, 0xeb, 0xeb, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0x9d, 0x9d, 0x9d, 0xfc, 0x57, 0x57, 
+  0x57, 0xfb, 0x17, 0x17, 0x17, 0xfb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x03, 0x09, 0x09, 0x09, 0xe8, 0x17, 0x17, 0x17, 0x8f, 0x1c, 0x1c, 0x1c, 0x74, 0x0f, 0x0f, 0x0f, 0xcc, 0x81, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x83, 0x00, 0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x10, 0xcc, 0x86, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x65, 
+  0x65, 0x07, 0x03, 0x03, 0x03, 0xdc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 
+  0x09, 0x09, 0x09, 0xd3, 0x25, 0x25, 0x25, 0x63, 0x18, 0x18, 0x18, 0x8b, 0x04, 0x04, 0x04, 0xf3, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x52, 0x52, 0x52, 0xfc, 0xb0, 0xb0, 0xb0, 0xff, 
+  0xe6, 0xe6, 0xe6, 0xff, 0x81, 0xf4, 0xf4, 0xf4, 0xff, 0x06, 0xf3, 0xf3, 0xf3, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0x26, 0x26, 0x26, 0xff, 0x84, 0x84, 
+  0x84, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf4, 0xf4, 0xf4, 0xff, 0x03, 0xf2, 0xf2, 0xf2, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x2b, 0x2b, 0x2b, 
+  0xfb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x06, 0x0e, 0x0e, 0x0e, 0xd0, 0x2b, 0x2b, 0x2b, 0x60, 0x22, 0x22, 0x22, 0x7b, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xfc, 0x00, 
+  0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x1d, 0x1d, 0x9c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x7f, 0x7f, 0x7f, 0x03, 0x00, 
+  0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x9c, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf7, 0x29, 
+  0x29, 0x29, 0x7b, 0x30, 0x30, 0x30, 0x33, 0x12, 0x12, 0x12, 0xbc, 0x81, 0x00, 0x00, 0x00, 0xff, 0x1c, 0x3d, 0x3d, 0x3d, 0xfc, 0xb6, 0xb6, 0xb6, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 
+  0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x6c, 0x6c, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf0, 0xf0, 0xf0, 
+  0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0x17, 0x17, 0x17, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0x1e, 0x1e, 0x1e, 0x7c, 0x47, 0x47, 0x47, 
+  0x2b, 0x13, 0x13, 0x13, 0xa8, 0x81, 0x00, 0x00, 0x00, 0xff, 0x06, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x3e, 0x3e, 0x53, 0x00, 
+  0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x4c, 0x4c, 0x44, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 
+  0xf8, 0x81, 0x00, 0x00, 0x00, 0xff, 0x07, 0x0b, 0x0b, 0x0b, 0xaf, 0x65, 0x65, 0x65, 0x1f, 0x53, 0x53, 0x53, 0x30, 0x06, 0x06, 0x06, 0xeb, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xfb, 0x86, 
+  0x86, 0x86, 0xff, 0xec, 0xec, 0xec, 0xff, 0x81, 0xf0, 0xf0, 0xf0, 0xff, 0x00, 0xfa, 0xfa, 0xfa, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x07, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 
+  0xfe, 0xfe, 0xff, 0xad, 0xad, 0xad, 0xff, 0x03, 0x03, 0x03, 0xff, 0x72, 0x72, 0x72, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 
+  0xff, 0x0b, 0xfe, 0xfe, 0xfe, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xee, 0xee, 0xee, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x4e, 0x4e, 0x4e, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 
+  0x00, 0xff, 0x18, 0x18, 0x18, 0xaf, 0x6d, 0x6d, 0x6d, 0x03, 0x4d, 0x4d, 0x4d, 0x4c, 0x06, 0x06, 0x06, 0xd0, 0x81, 0x00, 0x00, 0x00, 0xff, 0x02, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xe7, 
+  0x60, 0x60, 0x60, 0x0f, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x11, 0x11, 0x11, 0xc4, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x0b, 0x0b, 0xc8, 0x41, 0x41, 0x41, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x57, 0x57, 
+  0x57, 0x38, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x1b, 0x1b, 0xfb, 0xb7, 0xb7, 0xb7, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xec, 0xec, 0xec, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0x84, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xad, 0xad, 0xff, 0x00, 0x00, 0x00, 0xff, 0x71, 0x71, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfb, 0xfb, 0xfb, 0xff, 0x84, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xf3, 0xf3, 0xf3, 0xff, 0xed, 0xed, 0xed, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x79, 0x79, 0x79, 0xff, 0x00, 
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x72, 0x72, 0x72, 0x07, 0x2b, 0x2b, 0x2b, 0x73, 0x02, 0x02, 0x02, 0xe7, 0x00, 0x00, 0x00, 0xff, 0x25, 
+  0x25, 0x25, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x4c, 0x4c, 0x4c, 0x47, 0x26, 0x26, 0x26, 0x77, 0x72, 0x72, 0x72, 0x04, 0x00, 0x00, 0x00, 
+  0x00, 0x51, 0x51, 0x51, 0x34, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0x2a, 0x2a, 0x2a, 0xfc, 0xcf, 0xcf, 0xcf, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 
+  0xff, 0x03, 0x03, 0x03, 0xff, 0x70, 0x70, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x95, 0x95, 0x95, 0xff, 0x04, 0x04, 0x04, 0xfb, 0x00, 0x00, 
+  0x00, 0xff, 0x0f, 0x0f, 0x0f, 0xb7, 0x78, 0x78, 0x78, 0x03, 0x00, 0x00, 0x00, 0x00, 0x67, 0x67, 0x67, 0x1b, 0x1b, 0x1b, 0x1b, 0x8f, 0x63, 0x63, 0x63, 0x1b, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x0a, 
+  0x5e, 0x5e, 0x5e, 0x17, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xff, 0x22, 0x22, 0x22, 0xfb, 0xd4, 0xd4, 0xd4, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 
+  0xea, 0xea, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xfd, 0xfd, 
+  0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xeb, 0xeb, 0xeb, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x95, 0x95, 0x95, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0x90, 
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0xaf, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x0f, 0x0f, 0xfb, 0xc1, 0xc1, 0xc1, 0xff, 0xf0, 0xf0, 
+  0xf0, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 
+  0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x76, 0x76, 0x76, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x3e, 0x3e, 0x53, 0x00, 0x00, 
+  0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x04, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x5c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 
+  0x9b, 0x9b, 0x9b, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x00, 0x00, 0x00, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 
+  0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x81, 0xfd, 0xfd, 0xfd, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xeb, 0xeb, 0xeb, 0xff, 
+  0xf1, 0xf1, 0xf1, 0xff, 0x4a, 0x4a, 0x4a, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x05, 0x05, 0x05, 0xe4, 0x65, 0x65, 0x65, 0x17, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6c, 0x6c, 0x6c, 0x10, 0x02, 0x02, 
+  0x02, 0xe4, 0x00, 0x00, 0x00, 0xfc, 0x57, 0x57, 0x57, 0xfc, 0xf2, 0xf2, 0xf2, 0xff, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x98, 0x98, 0x98, 0xff, 0x81, 0x01, 
+  0x01, 0x01, 0xff, 0x05, 0xa0, 0xa0, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x12, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x45, 0x45, 0x45, 0xff, 0xfb, 0xfb, 
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xed, 0xed, 0xed, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x15, 0x15, 0x15, 0xfb, 0x00, 0x00, 
+  0x00, 0xff, 0x20, 0x20, 0x20, 0x93, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x88, 0x00, 0x00, 0x00, 0x00, 0x13, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0x31, 0x7b, 
+  0x00, 0x00, 0x00, 0xff, 0x15, 0x15, 0x15, 0xfb, 0xd2, 0xd2, 0xd2, 0xff, 0xee, 0xee, 0xee, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x9d, 0x9d, 0x9d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0xa1, 0xa1, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xfe, 0xfe, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x77, 
+  0x77, 0xff, 0x81, 0x00, 0x00, 0x00, 0xff, 0x01, 0x44, 0x44, 0x44, 0xff, 0xee, 0xee, 0xee, 0xff, 0x81, 0xfd, 0xfd, 0xfd, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 
+  0xf3, 0xff, 0x8b, 0x8b, 0x8b, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xf4, 0x60, 0x60, 0x60, 0x24, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x13, 0x6c, 0x6c, 0x6c, 0x10, 0x06, 0x06, 0x06, 0xe7, 
+  0x00, 0x00, 0x00, 0xfc, 0x7a, 0x7a, 0x7a, 0xfc, 0xf5, 0xf5, 0xf5, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x9c, 0x9c, 0x9c, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x01, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0x78, 0x78, 0x78, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0x39, 0x39, 0xff, 0xec, 0xec, 0xec, 0xff, 0x81, 0xfd, 0xfd, 0xfd, 0xff, 0x08, 
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x2c, 0x2c, 0x2c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x24, 0x24, 0x24, 0x94, 0x00, 0x00, 0x00, 0x00, 
+  0x7e, 0x7e, 0x7e, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x64, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xfb, 0xd4, 0xd4, 
+  0xd4, 0xff, 0xef, 0xef, 0xef, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 
+  0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0x79, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0x00, 0x00, 0x00, 0xff, 0x41, 0x41, 0x41, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 
+  0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x8f, 0x8f, 0x8f, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xec, 0x61, 0x61, 0x61, 0x17, 0x89, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11, 0xbf, 0x00, 0x00, 0x00, 0xff, 0x5f, 0x5f, 0x5f, 0xfb, 0x81, 0xf3, 0xf3, 0xf3, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x98, 0x98, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 
+  0x02, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xf1, 0xf1, 0xf1, 0xff, 
+  0xd8, 0xd8, 0xd8, 0xff, 0x16, 0x16, 0x16, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0x60, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0x5c, 
+  0x5c, 0x1f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xff, 0xad, 0xad, 0xad, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x97, 0x97, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 
+  0xa6, 0xa6, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 
+  0xf3, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x5b, 0x5b, 0x5b, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xb0, 0x86, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x7c, 0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x3f, 0x3f, 0x3f, 0x5c, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x1f, 0x1f, 0xfb, 0xdd, 0xdd, 0xdd, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0xff, 0x19, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x96, 0x96, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x03, 0x03, 0x03, 0xff, 0xa7, 0xa7, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3c, 0x3c, 0x3c, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0xfa, 0xfa, 0xfa, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x9f, 0x9f, 0x9f, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe8, 0x6c, 0x6c, 0x6c, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7f, 0x7f, 
+  0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x93, 0x00, 0x00, 0x00, 0xff, 0x4a, 0x4a, 0x4a, 0xfb, 0xf0, 0xf0, 0xf0, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 
+  0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x95, 0x95, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x04, 0x04, 0x04, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x7d, 0x7d, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3d, 0x3d, 0x3d, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x07, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x0a, 
+  0x0a, 0x0a, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x48, 0x48, 0x48, 0x38, 0x87, 0x00, 0x00, 0x00, 0x00, 0x06, 0x13, 0x13, 0x13, 0xbf, 0x00, 0x00, 0x00, 0xff, 0x80, 0x80, 0x80, 0xfb, 0xf5, 0xf5, 0xf5, 
+  0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 
+  0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x94, 0x94, 0xff, 0x00, 0x00, 0x00, 0xff, 0x06, 0x06, 0x06, 
+  0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x80, 0x80, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0xff, 0xef, 
+  0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 
+  0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x30, 0x30, 0x30, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x40, 0x40, 0x40, 
+  0x64, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6e, 0x6e, 0x6e, 0x03, 0x0b, 0x0b, 0x0b, 0xdc, 0x00, 0x00, 0x00, 0xff, 0x94, 0x94, 0x94, 0xfc, 0xf7, 
+  0xf7, 0xf7, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 
+  0xff, 0xff, 0x13, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x93, 0x93, 0xff, 0x00, 0x00, 0x00, 0xff, 0x03, 
+  0x03, 0x03, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x00, 0x00, 0x00, 0xff, 0x07, 0x07, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x39, 0x39, 0x39, 0xff, 0xee, 
+  0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xfd, 0xfd, 
+  0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xff, 0x41, 0x41, 0x41, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x2b, 0x2b, 0x2b, 0x87, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 
+  0x7e, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x59, 0x59, 0x14, 0x00, 0x00, 0x00, 0xeb, 0x01, 0x01, 0x01, 0xff, 0xb1, 0xb1, 0xb1, 0xfc, 0xf7, 0xf7, 0xf7, 0xff, 0x8a, 0xff, 0xff, 0xff, 
+  0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x91, 0x91, 0xff, 0x04, 0x04, 0x04, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x38, 0x38, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 
+  0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfd, 0xfd, 0xfd, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x64, 0x64, 0x64, 0xfb, 0x00, 0x00, 0x00, 0xff, 
+  0x10, 0x10, 0x10, 0x9f, 0x86, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x5d, 0x5d, 0x5d, 0x20, 0x00, 0x00, 0x00, 0xf3, 0x05, 0x05, 0x05, 0xff, 0xcc, 0xcc, 0xcc, 0xfc, 0xbc, 0xbc, 0xbc, 0xff, 0x41, 0x41, 
+  0x41, 0xff, 0x43, 0x43, 0x43, 0xff, 0x44, 0x44, 0x44, 0xff, 0x41, 0x41, 0x41, 0xff, 0x74, 0x74, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x05, 
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x81, 0x00, 0x00, 0x00, 0xff, 0x07, 0x02, 0x02, 
+  0x02, 0xff, 0x01, 0x01, 0x01, 0xff, 0x3b, 0x3b, 0x3b, 0xff, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 
+  0xff, 0xff, 0xff, 0x0b, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0x40, 0x40, 0x40, 0xff, 0x44, 0x44, 0x44, 0xff, 0x43, 0x43, 0x43, 0xff, 0x41, 0x41, 0x41, 0xff, 
+  0x57, 0x57, 0x57, 0xff, 0xef, 0xef, 0xef, 0xff, 0x79, 0x79, 0x79, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0xab, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5c, 0x5c, 0x5c, 0x23, 0x00, 0x00, 
+  0x00, 0xf4, 0x05, 0x05, 0x05, 0xff, 0xd4, 0xd4, 0xd4, 0xfc, 0xa2, 0xa2, 0xa2, 0xff, 0x83, 0x00, 0x00, 0x00, 0xff, 0x02, 0x40, 0x40, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x03, 0x03, 0x03, 0xff, 0x07, 0x07, 
+  0x07, 0xff, 0x05, 0x05, 0x05, 0xff, 0x00, 0x00, 0x00, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0xff, 0x83, 0x00, 0x00, 0x00, 0xff, 0x04, 0x14, 0x14, 0x14, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x7e, 
+  0x7e, 0x7e, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x13, 0x13, 0x13, 0xaf, 0x86, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5d, 0x5d, 0x5d, 0x1f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x05, 0x05, 0xff, 0xc2, 0xc2, 0xc2, 
+  0xfc, 0xe6, 0xe6, 0xe6, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xd0, 0xd0, 0xd0, 0xff, 0x03, 0xce, 0xce, 0xce, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x86, 
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0x82, 0x00, 0x00, 0x00, 0xff, 0x01, 0x13, 0x13, 0x13, 0xff, 0xe5, 
+  0xe5, 0xe5, 0xff, 0x81, 0xfd, 0xfd, 0xfd, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xcd, 
+  0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x76, 0x76, 0x76, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x14, 
+  0x14, 0x14, 0xa8, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5a, 0x5a, 0x5a, 0x10, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xff, 0xaa, 0xaa, 0xaa, 0xfc, 0xf8, 0xf8, 0xf8, 0xff, 0x8e, 0xff, 0xff, 
+  0xff, 0xff, 0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0x2b, 0x2b, 0x2b, 0xff, 0x42, 0x42, 0x42, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf2, 0xf2, 0xf2, 0xff, 0x5c, 0x5c, 0x5c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x11, 0x11, 0x11, 0x98, 0x00, 0x00, 0x00, 
+  0x00, 0x80, 0x80, 0x80, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x0f, 0x0f, 0xd8, 0x00, 0x00, 0x00, 0xff, 0x90, 0x90, 0x90, 0xfc, 0x81, 0xf7, 0xf7, 0xf7, 0xff, 0x05, 0xfc, 0xfc, 0xfc, 
+  0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 
+  0xfd, 0xfd, 0xff, 0x81, 0xfc, 0xfc, 0xfc, 0xff, 0x08, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xef, 0xef, 0xef, 0xff, 0x3d, 0x3d, 0x3d, 0xfb, 0x00, 0x00, 0x00, 
+  0xff, 0x35, 0x35, 0x35, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0xb7, 0x00, 0x00, 0x00, 0xff, 0x77, 0x77, 0x77, 0xfb, 0xf4, 
+  0xf4, 0xf4, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8c, 0xff, 0xff, 
+  0xff, 0xff, 0x08, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x2a, 0x2a, 0x2a, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x3e, 0x3e, 0x3e, 0x5b, 0x00, 
+  0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x88, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x3f, 0x3f, 
+  0xfb, 0xee, 0xee, 0xee, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xfd, 0xfd, 0xfd, 0xff, 
+  0xf4, 0xf4, 0xf4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x03, 0x03, 0x03, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x52, 0x52, 0x52, 0x2f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7c, 0x7c, 0x7c, 0x03, 0x00, 0x00, 
+  0x00, 0x00, 0x43, 0x43, 0x43, 0x4f, 0x00, 0x00, 0x00, 0xff, 0x16, 0x16, 0x16, 0xfb, 0xd5, 0xd5, 0xd5, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 
+  0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x91, 0x91, 0x91, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x02, 0x02, 0x02, 
+  0xdf, 0x70, 0x70, 0x70, 0x08, 0x87, 0x00, 0x00, 0x00, 0x00, 0x08, 0x65, 0x65, 0x65, 0x14, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xff, 0x9f, 0x9f, 0x9f, 0xfc, 0xf5, 0xf5, 0xf5, 0xff, 0xf9, 
+  0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 
+  0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x4c, 0x4c, 0x4c, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x1d, 0x1d, 0x1d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 
+  0x17, 0x17, 0xac, 0x01, 0x01, 0x01, 0xff, 0x4d, 0x4d, 0x4d, 0xfb, 0xf0, 0xf0, 0xf0, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
+  0xfe, 0xfe, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xf1, 0xf1, 0xf1, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x0d, 0x0d, 0x0d, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x42, 0x42, 
+  0x42, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7e, 0x7e, 0x7e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x4f, 0x00, 0x00, 0x00, 0xff, 
+  0x0a, 0x0a, 0x0a, 0xfc, 0xc6, 0xc6, 0xc6, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x09, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x7a, 0x7a, 0x7a, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x05, 0x05, 0x05, 0xdf, 0x6a, 
+  0x6a, 0x6a, 0x0b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x07, 0x76, 0x76, 0x76, 0x07, 0x0c, 0x0c, 0x0c, 0xd4, 0x00, 0x00, 0x00, 0xff, 0x61, 0x61, 0x61, 0xfc, 0xf4, 0xf4, 0xf4, 0xff, 0xf1, 0xf1, 0xf1, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xee, 0xee, 0xee, 0xff, 0xda, 0xda, 0xda, 
+  0xff, 0x1b, 0x1b, 0x1b, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x30, 0x30, 0x30, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 
+  0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x5f, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xfb, 0xbe, 0xbe, 0xbe, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 
+  0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 
+  0xf0, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x6e, 0x6e, 0x6e, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x04, 0x04, 0xe8, 0x6b, 0x6b, 0x6b, 0x14, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81, 0x81, 0x81, 0x03, 
+  0x76, 0x76, 0x76, 0x07, 0x07, 0x07, 0x07, 0xcf, 0x00, 0x00, 0x00, 0xff, 0x3a, 0x3a, 0x3a, 0xfb, 0x81, 0xeb, 0xeb, 0xeb, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 
+  0xfe, 0xfe, 0xff, 0x95, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf0, 0xf0, 0xf0, 
+  0xff, 0xbb, 0xbb, 0xbb, 0xff, 0x08, 0x08, 0x08, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x2d, 0x2d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x7d, 0x7d, 0x03, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x7d, 
+  0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x4c, 0x4c, 0x3c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x79, 0x79, 0x79, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xfc, 0xfc, 0xfc, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x2e, 0x2e, 0x2e, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x0b, 0x0b, 
+  0xcc, 0x73, 0x73, 0x73, 0x08, 0x82, 0x82, 0x82, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x7f, 0x7f, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x88, 0x00, 0x00, 0x00, 0xff, 0x02, 
+  0x02, 0x02, 0xfb, 0x9f, 0x9f, 0x9f, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 
+  0xfe, 0xfe, 0xfe, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xfc, 0xfc, 0xfc, 0xff, 0xea, 0xea, 0xea, 
+  0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x50, 0x50, 0x50, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf7, 0x50, 0x50, 0x50, 0x33, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x84, 0x84, 0x03, 0x6f, 
+  0x6f, 0x6f, 0x03, 0x07, 0x07, 0x07, 0xc0, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x0c, 0x0c, 0xfb, 0xb5, 0xb5, 0xb5, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 
+  0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xda, 0xff, 
+  0xa1, 0xa1, 0xa1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 
+  0xfe, 0xfe, 0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xea, 0xea, 0xea, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 
+  0x26, 0x26, 0x26, 0x68, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x66, 0x66, 0x66, 0x17, 0x08, 0x08, 0x08, 0xd3, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 
+  0x10, 0xfb, 0xab, 0xab, 0xab, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x69, 0x69, 0x69, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 
+  0xf5, 0xff, 0xec, 0xec, 0xec, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x69, 0x69, 0x69, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x25, 0x25, 0x25, 0x88, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 
+  0x7f, 0x04, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x1f, 0x07, 0x07, 0x07, 0xd7, 0x00, 0x00, 0x00, 0xff, 0x05, 0x05, 0x05, 0xf8, 
+  0x8d, 0x8d, 0x8d, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xed, 0xed, 0xed, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xfb, 0xfb, 
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xae, 0xae, 0xff, 0x03, 0x03, 0x03, 0xff, 0x73, 0x73, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x84, 0xfe, 0xfe, 0xfe, 0xff, 0x0a, 
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xee, 0xee, 0xee, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xde, 0xde, 0xde, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 
+  0x23, 0x23, 0x23, 0x93, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x03, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x7c, 0x7c, 0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x65, 0x65, 0x65, 0x1c, 0x07, 0x07, 
+  0x07, 0xcc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x56, 0x56, 0x56, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xfd, 0xfd, 
+  0xfd, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x07, 0xfa, 0xfa, 0xfa, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xad, 0xad, 0xad, 0xff, 0x02, 0x02, 0x02, 0xff, 0x72, 0x72, 0x72, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
+  0xfb, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfb, 0xfb, 0xfb, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xae, 0xae, 
+  0xae, 0xff, 0x25, 0x25, 0x25, 0xff, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0x24, 0x24, 0x87, 0x95, 0x00, 0x00, 0x00, 0x00, 0x18, 0x7d, 0x7d, 0x7d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x65, 0x65, 
+  0x65, 0x0c, 0x1c, 0x1c, 0x1c, 0x9c, 0x02, 0x02, 0x02, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x17, 0x17, 0x17, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf1, 0xf1, 
+  0xf1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0x00, 0x00, 0x00, 0xff, 0x69, 0x69, 
+  0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x81, 0xf3, 0xf3, 0xf3, 0xff, 0x01, 
+  0xc9, 0xc9, 0xc9, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x05, 0x05, 0x05, 0xf0, 0x35, 0x35, 0x35, 0x5b, 0x97, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7b, 0x7b, 0x7b, 0x03, 
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x5c, 0x00, 0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x29, 0x29, 0x29, 0xfb, 0x83, 0x83, 0x83, 0xfc, 
+  0xcc, 0xcc, 0xcc, 0xff, 0xed, 0xed, 0xed, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x52, 0x52, 0x52, 0xff, 
+  0x9c, 0x9c, 0x9c, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 
+  0x5e, 0x5e, 0x5e, 0xfc, 0x0b, 0x0b, 0x0b, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x02, 0x02, 0xff, 0x02, 0x02, 0x02, 0xef, 0x5d, 0x5d, 0x5d, 0x18, 0x98, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0x6a, 0x6a, 0x6a, 0x13, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x01, 0x01, 0xff, 0x82, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0f, 0x0f, 0x0f, 0xfc, 
+  0x44, 0x44, 0x44, 0xfb, 0x80, 0x80, 0x80, 0xfc, 0xb0, 0xb0, 0xb0, 0xfc, 0xcf, 0xcf, 0xcf, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xec, 0xec, 0xec, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 
+  0xe4, 0xe4, 0xe4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x9d, 0x9d, 0x9d, 0xfc, 0x6f, 0x6f, 0x6f, 0xfc, 0x2b, 0x2b, 0x2b, 0xfb, 0x83, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 
+  0x00, 0xfc, 0x01, 0x00, 0x00, 0x00, 0xff, 0x09, 0x09, 0x09, 0xaf, 0x98, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x1c, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 
+  0xfc, 0x00, 0x00, 0x00, 0xff, 0x35, 0x35, 0x35, 0x64, 0x2d, 0x2d, 0x2d, 0x80, 0x02, 0x02, 0x02, 0xe0, 0x83, 0x00, 0x00, 0x00, 0xff, 0x02, 0x0a, 0x0a, 0x0a, 0xfc, 0x20, 0x20, 0x20, 0xfb, 0x38, 
+  0x38, 0x38, 0xfb, 0x81, 0x3e, 0x3e, 0x3e, 0xfb, 0x02, 0x33, 0x33, 0x33, 0xfb, 0x14, 0x14, 0x14, 0xfc, 0x08, 0x08, 0x08, 0xff, 0x83, 0x00, 0x00, 0x00, 0xff, 0x07, 0x0c, 0x0c, 0x0c, 0xc8, 0x43, 
+  0x43, 0x43, 0x58, 0x21, 0x21, 0x21, 0x94, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x47, 0x47, 0x47, 0x43, 0x96, 0x00, 0x00, 0x00, 0x00, 
+  0x05, 0x55, 0x55, 0x55, 0x28, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x01, 0x01, 0xfc, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x0a, 0x0a, 0xac, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 
+  0x6b, 0x6b, 0x0f, 0x45, 0x45, 0x45, 0x4c, 0x1f, 0x1f, 0x1f, 0x94, 0x0e, 0x0e, 0x0e, 0xcf, 0x00, 0x00, 0x00, 0xef, 0x86, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 
+  0xe4, 0x16, 0x16, 0x16, 0xbb, 0x2e, 0x2e, 0x2e, 0x7b, 0x56, 0x56, 0x56, 0x33, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x67, 0x67, 0x13, 0x02, 0x02, 0x02, 0xe7, 0x01, 0x01, 0x01, 0xfc, 0x00, 
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x0e, 0x0e, 0x0e, 0xc7, 0x79, 0x79, 0x79, 0x03, 0x93, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x7c, 0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 
+  0x77, 0x01, 0x01, 0x01, 0xff, 0x03, 0x03, 0x03, 0xf4, 0x01, 0x01, 0x01, 0xfb, 0x00, 0x00, 0x00, 0xf8, 0x55, 0x55, 0x55, 0x28, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x04, 0x83, 0x00, 0x00, 
+  0x00, 0x00, 0x09, 0x60, 0x60, 0x60, 0x1c, 0x5c, 0x5c, 0x5c, 0x38, 0x32, 0x32, 0x32, 0x53, 0x31, 0x31, 0x31, 0x68, 0x31, 0x31, 0x31, 0x70, 0x32, 0x32, 0x32, 0x6f, 0x31, 0x31, 0x31, 0x60, 0x40, 
+  0x40, 0x40, 0x48, 0x63, 0x63, 0x63, 0x30, 0x62, 0x62, 0x62, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x7c, 0x7c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x26, 0x26, 0x26, 0x68, 0x00, 0x00, 0x00, 
+  0xff, 0x02, 0x02, 0x02, 0xf7, 0x03, 0x03, 0x03, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x55, 0x55, 0x55, 0x34, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x03, 0x91, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7c, 
+  0x7c, 0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x47, 0x82, 0x00, 0x00, 0x00, 0xff, 0x02, 0x1a, 0x1a, 0x1a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x03, 0x81, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x7d, 0x7d, 0x7d, 0x03, 0x7f, 0x7f, 0x7f, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7e, 0x7e, 0x7e, 0x04, 0x7d, 0x7d, 0x7d, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x81, 
+  0x81, 0x81, 0x03, 0x73, 0x73, 0x73, 0x04, 0x06, 0x06, 0x06, 0xcb, 0x81, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0xe3, 0x61, 0x61, 0x61, 0x17, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0x46, 
+  0x46, 0x46, 0x4c, 0x0c, 0x0c, 0x0c, 0xb0, 0x19, 0x19, 0x19, 0x8f, 0x73, 0x73, 0x73, 0x07, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0x7e, 0x7e, 0x7e, 0x03, 0x81, 0x7d, 0x7d, 0x7d, 0x03, 0x01, 0x7e, 
+  0x7e, 0x7e, 0x03, 0x7d, 0x7d, 0x7d, 0x03, 0x81, 0x7e, 0x7e, 0x7e, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x03, 0x59, 0x59, 0x59, 0x27, 0x16, 0x16, 0x16, 0xab, 0x13, 0x13, 0x13, 0xa3, 0x53, 0x53, 
+  0x53, 0x27, 0xc3, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +679,7 @@ const lv_img_dsc_t alarm_clock_64px = {
   .header.always_zero = 0,
   .header.w = 56,
   .header.h = 64,
-  .data_size = 3584 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( alarm_clock_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = alarm_clock_64px_map,
 };
-
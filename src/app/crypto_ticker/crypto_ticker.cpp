@@ -26,6 +26,7 @@
 #include "crypto_ticker_fetch.h"
 #include "crypto_ticker_main.h"
 #include "crypto_ticker_setup.h"
+#include "hardware/config_store.h"
 #ifdef CRYPTO_TICKER_WIDGET
     #include "crypto_ticker_widget.h"
 #endif // CRYPTO_TICKER_WIDGET
@@ -52,6 +53,8 @@ LV_IMG_DECLARE(info_1_16px);
 
 // declare callback functions
 static void enter_crypto_ticker_event_cb( lv_obj_t * obj, lv_event_t event );
+static void crypto_ticker_create_cb( void );
+static void crypto_ticker_destroy_cb( void );
 
 void crypto_ticker_load_config( void );
 
@@ -70,10 +73,26 @@ void crypto_ticker_setup( void ) {
     crypto_ticker_widget_setup();
 #endif // CRYPTO_TICKER_WIDGET
 
-    // init main and setup tile, see crypto_ticker_main.cpp and crypto_ticker_setup.cpp
+    // main and setup tile are build on the first use and deleted when not used for a while,
+    // the wifictl callback is needed before and registered now
+    crypto_ticker_main_register_cb();
+    mainbar_add_app_tile_lifecycle_cb( crypto_ticker_main_tile_num, crypto_ticker_create_cb, crypto_ticker_destroy_cb );
+}
+
+/*
+ * init main and setup tile, see crypto_ticker_main.cpp and crypto_ticker_setup.cpp
+ */
+static void crypto_ticker_create_cb( void ) {
     crypto_ticker_main_setup( crypto_ticker_main_tile_num );
     crypto_ticker_setup_setup( crypto_ticker_setup_tile_num );
+}
 
+/*
+ * forget all objects, the tiles are already cleaned
+ */
+static void crypto_ticker_destroy_cb( void ) {
+    crypto_ticker_main_destroy();
+    crypto_ticker_setup_destroy();
 }
 
 uint32_t crypto_ticker_get_app_main_tile_num( void ) {
@@ -114,31 +133,16 @@ crypto_ticker_config_t *crypto_ticker_get_config( void ) {
  *
  */
 void crypto_ticker_save_config( void ) {
-  
-
-    fs::File file = SPIFFS.open( crypto_ticker_JSON_CONFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", crypto_ticker_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["symbol"] = crypto_ticker_config.symbol;
-        doc["autosync"] = crypto_ticker_config.autosync;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &crypto_ticker_config );
 }
 
 /*
  *
  */
-void crypto_ticker_load_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void crypto_ticker_load_json_config( void ) {
     if ( SPIFFS.exists( crypto_ticker_JSON_CONFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( crypto_ticker_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -161,4 +165,8 @@ void crypto_ticker_load_config( void ) {
         file.close();
     }
 
-}
\ No newline at end of file
+}
+
+void crypto_ticker_load_config( void ) {
+    config_store_register( "crypto_ticker", &crypto_ticker_config, sizeof( crypto_ticker_config ), crypto_ticker_load_json_config );
+}
@@ -29,87 +29,63 @@
 
 #include "hardware/powermgm.h"
 #include "hardware/json_psram_allocator.h"
+#include "hardware/http_cache.h"
 
+static bool crypto_ticker_price_parse( HTTPClient *today_client, void *data, void *arg );
+static bool crypto_ticker_statistics_parse( HTTPClient *today_client, void *data, void *arg );
 
 int crypto_ticker_fetch_price( crypto_ticker_config_t *crypto_ticker_config, crypto_ticker_widget_data_t *crypto_ticker_widget_data ) {
     char url[512]="";
-    int httpcode = -1;
 
-    
     snprintf( url, sizeof( url ), "http://%s/api/CryptoTicker/Price/%s", MY_TTGO_WATCH_HOST, crypto_ticker_config->symbol);
 
-    HTTPClient today_client;
-
-    today_client.useHTTP10( true );
-    today_client.begin( url );
-    today_client.addHeader("force-unsecure","true");
-    httpcode = today_client.GET();
+    return( http_cache_get( url, crypto_ticker_widget_data, sizeof( crypto_ticker_widget_data_t ), crypto_ticker_price_parse, NULL, HTTP_CACHE_FORCE_UNSECURE ) );
+}
 
-    if ( httpcode != 200 ) {
-        log_e("HTTPClient error %d", httpcode, url );
-        today_client.end();
-        return( -1 );
-    }
+static bool crypto_ticker_price_parse( HTTPClient *today_client, void *data, void *arg ) {
+    crypto_ticker_widget_data_t *crypto_ticker_widget_data = (crypto_ticker_widget_data_t *)data;
 
     SpiRamJsonDocument doc( 1000 );
 
-    DeserializationError error = deserializeJson( doc, today_client.getStream() );
+    DeserializationError error = deserializeJson( doc, today_client->getStream() );
     if (error) {
         log_e("crypto_ticker deserializeJson() failed: %s", error.c_str() );
         doc.clear();
-        today_client.end();
-        return( -1 );
+        return( false );
     }
 
-    today_client.end();
-
     crypto_ticker_widget_data->valide = true;
     strcpy( crypto_ticker_widget_data->price, doc["price"] );
 
-
     doc.clear();
-    return( httpcode );
+    return( true );
 }
 
-
-
 int crypto_ticker_fetch_statistics( crypto_ticker_config_t *crypto_ticker_config, crypto_ticker_main_data_t *crypto_ticker_main_data ) {
     char url[512]="";
-    int httpcode = -1;
 
-    
     snprintf( url, sizeof( url ), "http://%s/api/CryptoTicker/24hrStatistics/%s", MY_TTGO_WATCH_HOST, crypto_ticker_config->symbol);
 
-    HTTPClient today_client;
+    return( http_cache_get( url, crypto_ticker_main_data, sizeof( crypto_ticker_main_data_t ), crypto_ticker_statistics_parse, NULL, HTTP_CACHE_FORCE_UNSECURE ) );
+}
 
-    today_client.useHTTP10( true );
-    today_client.begin( url );
-    today_client.addHeader("force-unsecure","true");
-    httpcode = today_client.GET();
-
-    if ( httpcode != 200 ) {
-        log_e("HTTPClient error %d", httpcode, url );
-        today_client.end();
-        return( -1 );
-    }
+static bool crypto_ticker_statistics_parse( HTTPClient *today_client, void *data, void *arg ) {
+    crypto_ticker_main_data_t *crypto_ticker_main_data = (crypto_ticker_main_data_t *)data;
 
     SpiRamJsonDocument doc( 1000 );
 
-    DeserializationError error = deserializeJson( doc, today_client.getStream() );
+    DeserializationError error = deserializeJson( doc, today_client->getStream() );
     if (error) {
         log_e("crypto_ticker deserializeJson() failed: %s", error.c_str() );
         doc.clear();
-        today_client.end();
-        return( -1 );
+        return( false );
     }
 
-    today_client.end();
-
     crypto_ticker_main_data->valide = true;
     strcpy( crypto_ticker_main_data->lastPrice, doc["lastPrice"] );
     strcpy( crypto_ticker_main_data->priceChangePercent, doc["priceChangePercent"] );
     strcpy( crypto_ticker_main_data->volume, doc["volume"] );
 
     doc.clear();
-    return( httpcode );
+    return( true );
 }
\ No newline at end of file
@@ -38,9 +38,7 @@
 #include "gui/statusbar.h"
 
 #include "hardware/wifictl.h"
-
-EventGroupHandle_t crypto_ticker_main_event_handle = NULL;
-TaskHandle_t _crypto_ticker_main_sync_Task;
+#include "hardware/jobqueue.h"
 
 lv_obj_t *crypto_ticker_main_tile = NULL;
 lv_style_t crypto_ticker_main_style;
@@ -50,10 +48,16 @@ lv_obj_t *crypto_ticker_main_last_price_value_label = NULL;
 lv_obj_t *crypto_ticker_main_price_change_value_label = NULL;
 lv_obj_t *crypto_ticker_main_volume_value_label = NULL;
 
-crypto_ticker_main_data_t crypto_ticker_main_data;
-
+crypto_ticker_main_data_t crypto_ticker_main_data;       // shown on the tile, under crypto_ticker_main_mutex
+static crypto_ticker_main_data_t crypto_ticker_main_fetch;  // written by the sync job only
+static char crypto_ticker_main_update[64] = "";
+static SemaphoreHandle_t crypto_ticker_main_mutex = NULL;
+static volatile bool crypto_ticker_main_changed = false;
+static lv_task_t *crypto_ticker_main_task = NULL;
 
-void crypto_ticker_main_sync_Task( void * pvParameters );
+static void crypto_ticker_main_sync_job( void *arg );
+static void crypto_ticker_main_task_cb( lv_task_t *task );
+static void crypto_ticker_main_update_tile( void );
 bool crypto_ticker_main_wifictl_event_cb( EventBits_t event, void *arg );
 
 LV_IMG_DECLARE(exit_32px);
@@ -145,9 +149,34 @@ void crypto_ticker_main_setup( uint32_t tile_num ) {
     lv_obj_set_width( crypto_ticker_main_volume_value_label, lv_disp_get_hor_res( NULL ) /4 * 2 );
     lv_obj_align( crypto_ticker_main_volume_value_label, NULL, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
+    // show the last statistics fetched while the tile did not exist
+    crypto_ticker_main_update_tile();
+    crypto_ticker_main_task = lv_task_create( crypto_ticker_main_task_cb, 500, LV_TASK_PRIO_LOWEST, NULL );
+}
 
-    crypto_ticker_main_event_handle = xEventGroupCreate();
+void crypto_ticker_main_destroy( void ) {
+    /*
+     * a running sync job only stores the statistics, no need to wait for it
+     */
+    jobqueue_cancel_job( crypto_ticker_main_sync_job, NULL );
+    if ( crypto_ticker_main_task ) {
+        lv_task_del( crypto_ticker_main_task );
+        crypto_ticker_main_task = NULL;
+    }
+    lv_style_reset( &crypto_ticker_main_style );
+    crypto_ticker_main_tile = NULL;
+    crypto_ticker_main_update_label = NULL;
+    crypto_ticker_main_last_price_value_label = NULL;
+    crypto_ticker_main_price_change_value_label = NULL;
+    crypto_ticker_main_volume_value_label = NULL;
+}
 
+void crypto_ticker_main_register_cb( void ) {
+    crypto_ticker_main_mutex = xSemaphoreCreateMutex();
+    if ( crypto_ticker_main_mutex == NULL ) {
+        log_e("crypto ticker main mutex alloc failed");
+        while(true);
+    }
     wifictl_register_cb( WIFICTL_OFF | WIFICTL_CONNECT, crypto_ticker_main_wifictl_event_cb, "crypto ticker main" );
 }
 
@@ -192,56 +221,66 @@ static void refresh_crypto_ticker_main_event_cb( lv_obj_t * obj, lv_event_t even
 
 
 void crypto_ticker_main_sync_request( void ) {
-    if ( xEventGroupGetBits( crypto_ticker_main_event_handle ) & CRYPTO_TICKER_MAIN_SYNC_REQUEST ) {
-        return;
-    }
-    else {
-        xEventGroupSetBits( crypto_ticker_main_event_handle, CRYPTO_TICKER_MAIN_SYNC_REQUEST );
-        xTaskCreate(    crypto_ticker_main_sync_Task,      /* Function to implement the task */
-                        "crypto ticker main sync Task",    /* Name of the task */
-                        5000,                            /* Stack size in words */
-                        NULL,                            /* Task input parameter */
-                        1,                               /* Priority of the task */
-                        &_crypto_ticker_main_sync_Task );  /* Task handle. */ 
-    }
+    jobqueue_submit( crypto_ticker_main_sync_job, NULL, JOBQUEUE_PRIO_NORMAL, JOBQUEUE_NETWORK, "crypto ticker main sync" );
 }
 
-void crypto_ticker_main_sync_Task( void * pvParameters ) {
+static void crypto_ticker_main_sync_job( void *arg ) {
     crypto_ticker_config_t *crypto_ticker_config = crypto_ticker_get_config();
     int32_t retval = -1;
 
-    log_i("start crypto ticker main task, heap: %d", ESP.getFreeHeap() );
+    log_i("start crypto ticker main job, heap: %d", ESP.getFreeHeap() );
 
     vTaskDelay( 250 );
 
-    if ( xEventGroupGetBits( crypto_ticker_main_event_handle ) & CRYPTO_TICKER_MAIN_SYNC_REQUEST ) {   
-        if ( crypto_ticker_config->autosync ) {
-            retval = crypto_ticker_fetch_statistics( crypto_ticker_config , &crypto_ticker_main_data );
-            if ( retval == 200 ) {
-                time_t now;
-                struct tm info;
-                char buf[64];
+    /*
+     * runs on a jobqueue worker, the tile is updated from the gui task, see crypto_ticker_main_task_cb()
+     */
+    if ( crypto_ticker_config->autosync ) {
+        retval = crypto_ticker_fetch_statistics( crypto_ticker_config , &crypto_ticker_main_fetch );
+        if ( retval == 200 ) {
+            time_t now;
+            struct tm info;
+
+            time( &now );
+            localtime_r( &now, &info );
+            xSemaphoreTake( crypto_ticker_main_mutex, portMAX_DELAY );
+            crypto_ticker_main_data = crypto_ticker_main_fetch;
+            strftime( crypto_ticker_main_update, sizeof( crypto_ticker_main_update ), "updated: %d.%b %H:%M", &info );
+            xSemaphoreGive( crypto_ticker_main_mutex );
+            crypto_ticker_main_changed = true;
+        }
+    }
+    log_i("finish crypto ticker main job, heap: %d", ESP.getFreeHeap() );
+}
+
+static void crypto_ticker_main_task_cb( lv_task_t *task ) {
+    if ( crypto_ticker_main_changed ) {
+        crypto_ticker_main_changed = false;
+        crypto_ticker_main_update_tile();
+    }
+}
 
+static void crypto_ticker_main_update_tile( void ) {
+    if ( crypto_ticker_main_tile == NULL ) {
+        return;
+    }
 
-                lv_label_set_text( crypto_ticker_main_last_price_value_label, crypto_ticker_main_data.lastPrice );
-                lv_obj_align( crypto_ticker_main_last_price_value_label, NULL, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+    xSemaphoreTake( crypto_ticker_main_mutex, portMAX_DELAY );
+    if ( !crypto_ticker_main_data.valide ) {
+        xSemaphoreGive( crypto_ticker_main_mutex );
+        return;
+    }
 
-                lv_label_set_text( crypto_ticker_main_price_change_value_label, crypto_ticker_main_data.priceChangePercent );
-                lv_obj_align( crypto_ticker_main_price_change_value_label, NULL, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+    lv_label_set_text( crypto_ticker_main_last_price_value_label, crypto_ticker_main_data.lastPrice );
+    lv_obj_align( crypto_ticker_main_last_price_value_label, NULL, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
-                lv_label_set_text( crypto_ticker_main_volume_value_label, crypto_ticker_main_data.volume );
-                lv_obj_align( crypto_ticker_main_volume_value_label, NULL, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
-               
+    lv_label_set_text( crypto_ticker_main_price_change_value_label, crypto_ticker_main_data.priceChangePercent );
+    lv_obj_align( crypto_ticker_main_price_change_value_label, NULL, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
-                time( &now );
-                localtime_r( &now, &info );
-                strftime( buf, sizeof(buf), "updated: %d.%b %H:%M", &info );
-                lv_label_set_text( crypto_ticker_main_update_label, buf );
-                lv_obj_invalidate( lv_scr_act() );
-            }
-        }
-    }
-    xEventGroupClearBits( crypto_ticker_main_event_handle, CRYPTO_TICKER_MAIN_SYNC_REQUEST );
-    log_i("finish crypto ticker main task, heap: %d", ESP.getFreeHeap() );
-    vTaskDelete( NULL );
-}
\ No newline at end of file
+    lv_label_set_text( crypto_ticker_main_volume_value_label, crypto_ticker_main_data.volume );
+    lv_obj_align( crypto_ticker_main_volume_value_label, NULL, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+
+    lv_label_set_text( crypto_ticker_main_update_label, crypto_ticker_main_update );
+    xSemaphoreGive( crypto_ticker_main_mutex );
+    lv_obj_invalidate( lv_scr_act() );
+}
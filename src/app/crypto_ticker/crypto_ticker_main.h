@@ -24,7 +24,6 @@
 
     #include <TTGO.h>
 
-    #define CRYPTO_TICKER_MAIN_SYNC_REQUEST   _BV(0)
 
     typedef struct {
         bool valide = false;
@@ -34,7 +33,23 @@
         char volume[50] = "";
     } crypto_ticker_main_data_t;
 
+    /**
+     * @brief build the main tile, called on the first use of the app
+     *
+     * @param   tile_num    tile number of the main tile
+     */
     void crypto_ticker_main_setup( uint32_t tile_num );
+    /**
+     * @brief forget all objects of the main tile after the tile is cleaned
+     */
+    void crypto_ticker_main_destroy( void );
+    /**
+     * @brief register the wifictl callback, must be called at setup time
+     */
+    void crypto_ticker_main_register_cb( void );
+    /**
+     * @brief fetch the statistics in the background, the main tile is updated if it exists
+     */
     void crypto_ticker_main_sync_request( void );
 
 #endif // _CRYPTO_TICKER_MAIN_H
\ No newline at end of file
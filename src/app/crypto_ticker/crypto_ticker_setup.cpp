@@ -110,6 +110,13 @@ void crypto_ticker_setup_setup( uint32_t tile_num ) {
     lv_obj_align( crypto_ticker_autosync_switch_label, crypto_ticker_autosync_switch_cont, LV_ALIGN_IN_LEFT_MID, 5, 0 );
 }
 
+void crypto_ticker_setup_destroy( void ) {
+    lv_style_reset( &crypto_ticker_setup_style );
+    crypto_ticker_setup_tile = NULL;
+    crypto_ticker_symbol_textfield = NULL;
+    crypto_ticker_autosync_switch = NULL;
+}
+
 
 
 static void crypto_ticker_textarea_event_cb( lv_obj_t * obj, lv_event_t event ) {
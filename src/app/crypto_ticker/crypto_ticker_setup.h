@@ -24,6 +24,15 @@
 
     #include <TTGO.h>
 
+    /**
+     * @brief build the setup tile, called on the first use of the app
+     *
+     * @param   tile_num    tile number of the setup tile
+     */
     void crypto_ticker_setup_setup( uint32_t tile_num );
+    /**
+     * @brief forget all objects of the setup tile after the tile is cleaned
+     */
+    void crypto_ticker_setup_destroy( void );
 
 #endif // _CRYPTO_TICKER_SETUP_H
\ No newline at end of file
@@ -33,10 +33,9 @@
 
 #include "hardware/json_psram_allocator.h"
 #include "hardware/wifictl.h"
+#include "hardware/jobqueue.h"
 
-EventGroupHandle_t crypto_ticker_widget_event_handle = NULL;
-TaskHandle_t _crypto_ticker_widget_sync_Task;
-void crypto_ticker_widget_sync_Task( void * pvParameters );
+static void crypto_ticker_widget_sync_job( void *arg );
 
 crypto_ticker_widget_data_t crypto_ticker_widget_data;
 
@@ -52,8 +51,6 @@ void crypto_ticker_widget_setup( void ) {
     
     crypto_ticker_widget = widget_register( "BTC", &bitcoin_64px, enter_crypto_ticker_widget_event_cb );
 
-    crypto_ticker_widget_event_handle = xEventGroupCreate();
-
     wifictl_register_cb( WIFICTL_OFF | WIFICTL_CONNECT, crypto_ticker_widget_wifictl_event_cb, "crypto ticker widget" );
 }
 
@@ -90,37 +87,23 @@ static void enter_crypto_ticker_widget_event_cb( lv_obj_t * obj, lv_event_t even
 }
 
 void crypto_ticker_widget_sync_request( void ) {
-    if ( xEventGroupGetBits( crypto_ticker_widget_event_handle ) & CRYPTO_TICKER_WIDGET_SYNC_REQUEST ) {
-        return;
-    }
-    else {
-        xEventGroupSetBits( crypto_ticker_widget_event_handle, CRYPTO_TICKER_WIDGET_SYNC_REQUEST );
-        widget_hide_indicator( crypto_ticker_widget );
-        xTaskCreate(    crypto_ticker_widget_sync_Task,       /* Function to implement the task */
-                        "crypto_ticker widget sync Task",     /* Name of the task */
-                        5000,                           /* Stack size in words */
-                        NULL,                           /* Task input parameter */
-                        1,                              /* Priority of the task */
-                        &_crypto_ticker_widget_sync_Task );   /* Task handle. */
-    }
+    jobqueue_submit( crypto_ticker_widget_sync_job, NULL, JOBQUEUE_PRIO_NORMAL, JOBQUEUE_NETWORK, "crypto ticker widget sync" );
 }
 
-void crypto_ticker_widget_sync_Task( void * pvParameters ) {
-    log_i("start crypto_ticker widget task");
+static void crypto_ticker_widget_sync_job( void *arg ) {
+    log_i("start crypto_ticker widget job");
+
+    widget_hide_indicator( crypto_ticker_widget );
 
     vTaskDelay( 250 );
 
-    if ( xEventGroupGetBits( crypto_ticker_widget_event_handle ) & CRYPTO_TICKER_WIDGET_SYNC_REQUEST ) {       
-        uint32_t retval = crypto_ticker_fetch_price(crypto_ticker_get_config() , &crypto_ticker_widget_data );
-        if ( retval == 200 ) {
-            widget_set_indicator( crypto_ticker_widget, ICON_INDICATOR_OK );
-            widget_set_label( crypto_ticker_widget, crypto_ticker_widget_data.price );
-        }
-        else {
-            widget_set_indicator( crypto_ticker_widget, ICON_INDICATOR_FAIL );
-        }
+    uint32_t retval = crypto_ticker_fetch_price(crypto_ticker_get_config() , &crypto_ticker_widget_data );
+    if ( retval == 200 ) {
+        widget_set_indicator( crypto_ticker_widget, ICON_INDICATOR_OK );
+        widget_set_label( crypto_ticker_widget, crypto_ticker_widget_data.price );
+    }
+    else {
+        widget_set_indicator( crypto_ticker_widget, ICON_INDICATOR_FAIL );
     }
-    xEventGroupClearBits( crypto_ticker_widget_event_handle, CRYPTO_TICKER_WIDGET_SYNC_REQUEST );
-    vTaskDelete( NULL );
 }
 
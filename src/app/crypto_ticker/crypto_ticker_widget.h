@@ -24,7 +24,6 @@
 
     #include <TTGO.h>
 
-    #define CRYPTO_TICKER_WIDGET_SYNC_REQUEST    _BV(0)
 
 
     typedef struct {
@@ -10,271 +10,357 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_BITCOIN_64PX uint8_t bitcoin_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf5, 0xd0, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xbb, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x23, 0xf4, 0xfb, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xf6, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x44, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x2b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xfc, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xf5, 0xe4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf6, 0x0b, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x6c, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf6, 0x03, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xfb, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xdf, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x2c, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x30, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x7c, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x30, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x68, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfb, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x1f, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x27, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfb, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xfc, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfb, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x38, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x3f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x6c, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfb, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0xb0, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x53, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x23, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf4, 0xfb, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xf4, 0xfb, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xfc, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf6, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x23, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x27, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x68, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x27, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x48, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xf6, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xff, 0xf4, 0xfc, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf4, 0xfb, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xe4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x2c, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x2b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x48, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x1f, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfc, 0xf4, 0xff, 0xf4, 0xff, 0xf6, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xf5, 0x3b, 0xf4, 0xfb, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xfb, 0xf5, 0x1f, 0xfb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xfa, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xf5, 0xd0, 0x8a, 0xf4, 0xff, 0x00, 0xf5, 0xbb, 0xae, 0x00, 0x00, 0x01, 0xf5, 0x23, 0xf4, 0xfb, 0x90, 0xf4, 
+  0xff, 0x00, 0xf4, 0xfc, 0xa9, 0x00, 0x00, 0x00, 0xf5, 0x44, 0x96, 0xf4, 0xff, 0x00, 0xf5, 0x2b, 0xa5, 0x00, 0x00, 0x89, 0xf4, 0xff, 0x81, 0xfa, 0xff, 0x81, 0xf5, 0xff, 0x8b, 0xf4, 0xff, 0x00, 
+  0xf4, 0xfc, 0xa2, 0x00, 0x00, 0x00, 0xf4, 0xfc, 0x8a, 0xf4, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xf4, 0xff, 0x02, 0xf5, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0x86, 0xf4, 0xff, 0x01, 0xf4, 
+  0xfc, 0xf5, 0xe4, 0x9f, 0x00, 0x00, 0x8c, 0xf4, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xf4, 0xff, 0x84, 0xff, 0xff, 0x87, 0xf4, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xf6, 0x0b, 0x8c, 0xf4, 
+  0xff, 0x00, 0xf5, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x81, 0xf4, 0xff, 0x84, 0xff, 0xff, 0x88, 0xf4, 0xff, 0x9a, 0x00, 0x00, 0x00, 0xf5, 0x6c, 0x8d, 0xf4, 0xff, 0x00, 0xf6, 0xff, 0x83, 
+  0xff, 0xff, 0x00, 0xf5, 0xff, 0x81, 0xf4, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x89, 0xf4, 0xff, 0x00, 0xf5, 0x23, 0x97, 0x00, 0x00, 0x00, 0xf6, 0x03, 0x8e, 0xf4, 0xff, 0x00, 0xfa, 0xff, 
+  0x83, 0xff, 0xff, 0x82, 0xf4, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x8a, 0xf4, 0xff, 0x00, 0xf6, 0x0b, 0x96, 0x00, 0x00, 0x87, 0xf4, 0xff, 0x82, 0xff, 0xff, 0x04, 0xfb, 0xff, 0xfa, 0xff, 
+  0xf6, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x84, 0xff, 0xff, 0x81, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8b, 0xf4, 0xff, 0x95, 0x00, 0x00, 0x88, 0xf4, 0xff, 0x8c, 0xff, 
+  0xff, 0x81, 0xf5, 0xff, 0x00, 0xfa, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x8c, 0xf4, 0xff, 0x93, 0x00, 0x00, 0x00, 0xf4, 0xfb, 0x87, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x93, 0xff, 0xff, 0x8d, 
+  0xf4, 0xff, 0x00, 0xf5, 0xdf, 0x91, 0x00, 0x00, 0x00, 0xf5, 0x2c, 0x88, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8b, 0xf4, 0xff, 0x00, 0xf5, 0x30, 0x90, 0x00, 0x00, 
+  0x89, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x97, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8a, 0xf4, 0xff, 0x8f, 0x00, 0x00, 0x00, 0xf5, 0x7c, 0x8d, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf5, 
+  0xff, 0x88, 0xf4, 0xff, 0x00, 0xf5, 0x30, 0x8e, 0x00, 0x00, 0x8f, 0xf4, 0xff, 0x96, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x88, 0xf4, 0xff, 0x8d, 0x00, 0x00, 0x00, 0xf5, 0x68, 0x8f, 0xf4, 0xff, 0x87, 
+  0xff, 0xff, 0x82, 0xf4, 0xff, 0x01, 0xf5, 0xff, 0xfa, 0xff, 0x8a, 0xff, 0xff, 0x88, 0xf4, 0xff, 0x8d, 0x00, 0x00, 0x90, 0xf4, 0xff, 0x87, 0xff, 0xff, 0x85, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x88, 
+  0xff, 0xff, 0x00, 0xfa, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf4, 0xfb, 0x8c, 0x00, 0x00, 0x90, 0xf4, 0xff, 0x86, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x86, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x88, 0xff, 0xff, 
+  0x88, 0xf4, 0xff, 0x8b, 0x00, 0x00, 0x00, 0xf5, 0x1f, 0x90, 0xf4, 0xff, 0x86, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x87, 0xff, 0xff, 0x88, 0xf4, 0xff, 0x00, 0xf5, 
+  0x27, 0x8a, 0x00, 0x00, 0x90, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x87, 0xff, 0xff, 0x88, 0xf4, 0xff, 0x00, 0xf4, 0xfb, 0x8a, 
+  0x00, 0x00, 0x90, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x87, 0xff, 0xff, 0x89, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x90, 0xf4, 0xff, 
+  0x00, 0xfa, 0xff, 0x86, 0xff, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x87, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x89, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x90, 0xf4, 0xff, 0x00, 0xfb, 0xff, 0x86, 0xff, 
+  0xff, 0x01, 0xf6, 0xff, 0xf5, 0xff, 0x84, 0xf4, 0xff, 0x00, 0xf6, 0xff, 0x88, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x89, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x90, 0xf4, 0xff, 0x97, 0xff, 0xff, 0x00, 0xfa, 
+  0xff, 0x8a, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x90, 0xf4, 0xff, 0x96, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x8a, 0xf4, 0xff, 0x00, 0xf4, 0xfc, 0x8a, 0x00, 0x00, 0x90, 0xf4, 0xff, 0x95, 0xff, 0xff, 0x00, 
+  0xf5, 0xff, 0x8c, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x8f, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x96, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x8b, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x8f, 0xf4, 0xff, 0x00, 0xfa, 0xff, 
+  0x86, 0xff, 0xff, 0x82, 0xf5, 0xff, 0x81, 0xfa, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x8a, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x8f, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x86, 0xff, 0xff, 0x86, 0xf4, 
+  0xff, 0x00, 0xfa, 0xff, 0x89, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x89, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x8f, 0xf4, 0xff, 0x87, 0xff, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x89, 0xff, 0xff, 0x89, 
+  0xf4, 0xff, 0x8a, 0x00, 0x00, 0x8f, 0xf4, 0xff, 0x87, 0xff, 0xff, 0x89, 0xf4, 0xff, 0x88, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x88, 0xf4, 0xff, 0x8a, 0x00, 0x00, 0x00, 0xf4, 0xfc, 0x8e, 0xf4, 0xff, 
+  0x86, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x89, 0xf4, 0xff, 0x00, 0xf6, 0xff, 0x87, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf4, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0xf5, 0x38, 0x8d, 0xf4, 
+  0xff, 0x00, 0xf5, 0xff, 0x86, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x89, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x87, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf5, 0x3f, 0x8b, 0x00, 0x00, 0x8d, 
+  0xf4, 0xff, 0x00, 0xfa, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x89, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x87, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x87, 0xf4, 0xff, 0x8c, 0x00, 0x00, 0x89, 0xf4, 0xff, 
+  0x8b, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x89, 0xf4, 0xff, 0x88, 0xff, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf4, 0xfc, 0x8c, 0x00, 0x00, 0x00, 0xf5, 0x6c, 0x87, 0xf4, 0xff, 0x00, 0xf6, 0xff, 0x8b, 0xff, 
+  0xff, 0x01, 0xf6, 0xff, 0xf5, 0xff, 0x86, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x89, 0xff, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf6, 0x07, 0x8d, 0x00, 0x00, 0x87, 0xf4, 0xff, 0x9f, 0xff, 0xff, 0x00, 0xfa, 
+  0xff, 0x87, 0xf4, 0xff, 0x8e, 0x00, 0x00, 0x00, 0xf5, 0xb0, 0x86, 0xf4, 0xff, 0x9f, 0xff, 0xff, 0x87, 0xf4, 0xff, 0x00, 0xf5, 0x53, 0x8f, 0x00, 0x00, 0x85, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x9e, 
+  0xff, 0xff, 0x00, 0xf6, 0xff, 0x87, 0xf4, 0xff, 0x90, 0x00, 0x00, 0x00, 0xf5, 0x23, 0x87, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x81, 0xfa, 0xff, 0x98, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x87, 0xf4, 0xff, 
+  0x00, 0xf5, 0x1c, 0x91, 0x00, 0x00, 0x00, 0xf4, 0xfb, 0x8b, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x94, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x86, 0xf4, 0xff, 0x01, 0xf4, 0xfc, 0xf4, 0xfb, 0x93, 0x00, 0x00, 
+  0x00, 0xf4, 0xfc, 0x8a, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x83, 0xff, 0xff, 0x81, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x8a, 0xff, 0xff, 0x01, 0xfa, 0xff, 0xf5, 0xff, 0x89, 0xf4, 0xff, 0x95, 0x00, 0x00, 
+  0x8a, 0xf4, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x81, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x90, 0xf4, 0xff, 0x96, 0x00, 0x00, 0x00, 0xf5, 0x23, 0x89, 0xf4, 
+  0xff, 0x84, 0xff, 0xff, 0x81, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x8f, 0xf4, 0xff, 0x00, 0xf5, 0x27, 0x97, 0x00, 0x00, 0x00, 0xf5, 0x68, 0x88, 0xf4, 0xff, 0x83, 
+  0xff, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xf4, 0xff, 0x00, 0xfa, 0xff, 0x83, 0xff, 0xff, 0x8f, 0xf4, 0xff, 0x00, 0xf5, 0x27, 0x99, 0x00, 0x00, 0x00, 0xf5, 0x48, 0x87, 0xf4, 0xff, 0x83, 0xff, 0xff, 
+  0x00, 0xfa, 0xff, 0x81, 0xf4, 0xff, 0x84, 0xff, 0xff, 0x8d, 0xf4, 0xff, 0x00, 0xf4, 0xfc, 0x9d, 0x00, 0x00, 0x01, 0xf4, 0xff, 0xf4, 0xfc, 0x83, 0xf4, 0xff, 0x00, 0xf5, 0xff, 0x83, 0xff, 0xff, 
+  0x00, 0xf5, 0xff, 0x81, 0xf4, 0xff, 0x84, 0xff, 0xff, 0x8d, 0xf4, 0xff, 0x9f, 0x00, 0x00, 0x00, 0xf4, 0xfb, 0x86, 0xf4, 0xff, 0x01, 0xf5, 0xff, 0xfa, 0xff, 0x82, 0xf4, 0xff, 0x83, 0xff, 0xff, 
+  0x00, 0xfb, 0xff, 0x8b, 0xf4, 0xff, 0x00, 0xf5, 0xe4, 0xa1, 0x00, 0x00, 0x00, 0xf5, 0x2c, 0x8b, 0xf4, 0xff, 0x81, 0xf5, 0xff, 0x01, 0xfa, 0xff, 0xf5, 0xff, 0x8a, 0xf4, 0xff, 0x00, 0xf5, 0x2b, 
+  0xa4, 0x00, 0x00, 0x00, 0xf5, 0x48, 0x96, 0xf4, 0xff, 0x00, 0xf5, 0x23, 0xa8, 0x00, 0x00, 0x00, 0xf5, 0x1f, 0x81, 0xf4, 0xff, 0x00, 0xf4, 0xfc, 0x8c, 0xf4, 0xff, 0x00, 0xf4, 0xfc, 0x81, 0xf4, 
+  0xff, 0xae, 0x00, 0x00, 0x01, 0xf5, 0x3b, 0xf4, 0xfb, 0x8a, 0xf4, 0xff, 0x01, 0xf4, 0xfb, 0xf5, 0x1f, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x98, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x5b, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x96, 0xfe, 0x00, 0x33, 0xfe, 0x00, 0xd1, 0xf5, 0x00, 0xd1, 0xf5, 0x00, 0xd1, 0xf5, 0x00, 0x33, 0xfe, 0x00, 0x96, 0xfe, 0x00, 0xf8, 0xfe, 0x00, 0x7b, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff, 0x00, 0xb6, 0xfe, 0x00, 0xaf, 0xfd, 0x00, 0xa5, 0xf4, 0xd0, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xc6, 0xf4, 0xbb, 0xd0, 0xfd, 0x00, 0xd7, 0xfe, 0x00, 0x9c, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xb7, 0xfe, 0x00, 0x4b, 0xf5, 0x23, 0xa4, 0xfc, 0xfb, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0x6d, 0xf5, 0x00, 0xf8, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0x00, 0x0a, 0xf5, 0x44, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2b, 0xf5, 0x2b, 0x19, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0x00, 0x8e, 0xf5, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xae, 0xfd, 0xff, 0xaf, 0xf5, 0xff, 0x29, 0xfd, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0xaf, 0xfd, 0x00, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x54, 0xf6, 0x00, 0xa4, 0xfc, 0xfc, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x11, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2a, 0xfd, 0xff, 0x8e, 0xfd, 0xff, 0xc6, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0xa4, 0xfc, 0xe4, 0x96, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xff, 0x00, 0xaf, 0xfd, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xf4, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x96, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xd7, 0xf6, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd1, 0xfd, 0x00, 0xde, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7c, 0xff, 0x00, 0x4c, 0xf5, 0x0b, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xc5, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x8e, 0xfd, 0x00, 0xbd, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0x00, 0xe9, 0xf4, 0x6c, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x6c, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2b, 0xf5, 0x23, 0xbd, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xff, 0x00, 0x6d, 0xf5, 0x03, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xf1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x6c, 0xf5, 0x0b, 0xde, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xff, 0x00, 0x8e, 0xf5, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0x39, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0x95, 0xfe, 0xff, 0xf1, 0xfd, 0xff, 0x6c, 0xfd, 0xff, 0xa5, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0x96, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x09, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd1, 0xf5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x33, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0xa5, 0xf4, 0xff, 0xaf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa5, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x96, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0x00, 0xa4, 0xfc, 0xfb, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xe8, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa5, 0xf4, 0xdf, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x2b, 0xf5, 0x2c, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xaf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xd7, 0xfe, 0xff, 0x4c, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2b, 0xf5, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb6, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x4c, 0xfd, 0xff, 0xb7, 0xfe, 0xff, 0x5a, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0x8e, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x19, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbd, 0xff, 0x00, 0xe8, 0xfc, 0x7c, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xaf, 0xf5, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0x2b, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2b, 0xf5, 0x30, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x95, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xb7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0x5a, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x2b, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xf8, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x09, 0xf5, 0x68, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x96, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xe7, 0xf4, 0xff, 0xf2, 0xf5, 0xff, 0x19, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x6d, 0xf5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x0b, 0xf5, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfb, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x54, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x54, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x4c, 0xf5, 0x1f, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x8e, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x4b, 0xfd, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbc, 0xff, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa5, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xe7, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xfb, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x19, 0xff, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x4b, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa5, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xae, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x96, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xc5, 0xf4, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xf8, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x12, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x95, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x6d, 0xfd, 0xff, 0xa5, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0x6d, 0xfd, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x96, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb0, 0xf5, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xbc, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x33, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xfd, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x13, 0xf6, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0xd1, 0xf5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xfd, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xe8, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd0, 0xf5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xaf, 0xfd, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xc6, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0x2b, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd1, 0xf5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb0, 0xf5, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xae, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0xa5, 0xf4, 0xff, 0x4b, 0xfd, 0xff, 0xb0, 0xfd, 0xff, 0x12, 0xfe, 0xff, 0xd8, 0xfe, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xd0, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x33, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x12, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x33, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0xd0, 0xfd, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0x2b, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x96, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x95, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xb6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x96, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd8, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x19, 0xff, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xc5, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x6c, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfb, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xf5, 0x38, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa5, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xc7, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2a, 0xf5, 0x3f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x54, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xaf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xd0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x54, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x39, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xd7, 0xfe, 0xff, 0xb6, 0xf6, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa5, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x09, 0xfd, 0x6c, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x8e, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0xa5, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x8e, 0xfd, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x4c, 0xf5, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x95, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x18, 0xff, 0xff, 0xd8, 0xfe, 0xff, 0xf8, 0xfe, 0xff, 0x5a, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xf8, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbd, 0xff, 0x00, 0xc6, 0xfc, 0xb0, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x0a, 0xf5, 0x53, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb6, 0xfe, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0x4b, 0xfd, 0xff, 0x7b, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x8e, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xf8, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x2b, 0xf5, 0x23, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0xe8, 0xfc, 0xff, 0xaf, 0xfd, 0xff, 0x33, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0x3a, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xd0, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x4c, 0xf5, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x39, 0xff, 0x00, 0xa4, 0xfc, 0xfb, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2a, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0x4c, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0xa4, 0xfc, 0xfb, 0x5a, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x33, 0xfe, 0x00, 0xa4, 0xfc, 0xfc, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xc7, 0xf4, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x39, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0x12, 0xfe, 0xff, 0xe8, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x96, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xff, 0x00, 0x8e, 0xfd, 0x00, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x74, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xc7, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd0, 0xf5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbd, 0xff, 0x00, 0x4b, 0xfd, 0x23, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0x8e, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xc7, 0xf4, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2b, 0xf5, 0x27, 0xdd, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0x00, 0xe9, 0xf4, 0x68, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x32, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x4b, 0xfd, 0x27, 0xbd, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9c, 0xff, 0x00, 0x0a, 0xf5, 0x48, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xb6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0x6d, 0xf5, 0x00, 0xbd, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbd, 0xff, 0x00, 0x8f, 0xf5, 0x00, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x5b, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf5, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xd0, 0xf5, 0x00, 0xde, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x54, 0xf6, 0x00, 0xa4, 0xfc, 0xfb, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x08, 0xf5, 0xff, 0xaf, 0xf5, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x19, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xe4, 0x96, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xff, 0x00, 0x2b, 0xfd, 0x2c, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa5, 0xf4, 0xff, 0x6c, 0xfd, 0xff, 0xf1, 0xfd, 0xff, 0x2b, 0xfd, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2b, 0xfd, 0x2b, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xff, 0x00, 0xd7, 0xfe, 0x00, 0x0a, 0xf5, 0x48, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x2b, 0xf5, 0x23, 0xf9, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xb7, 0xfe, 0x00, 0x4c, 0xf5, 0x1f, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xfc, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x6d, 0xf5, 0x00, 0xf8, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5b, 0xff, 0x00, 0x54, 0xfe, 0x00, 0x2b, 0xf5, 0x3b, 0xa4, 0xfc, 0xfb, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xfb, 0x4c, 0xf5, 0x1f, 0x54, 0xfe, 0x00, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x5b, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x96, 0xfe, 0x00, 0x33, 0xfe, 0x00, 0xd2, 0xfd, 0x00, 0xd1, 0xf5, 0x00, 0xd1, 0xfd, 0x00, 0x33, 0xfe, 0x00, 0x96, 0xfe, 0x00, 0xf8, 0xfe, 0x00, 0x7b, 0xff, 0x00, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xf4, 0xd0, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 0xc6, 0xf4, 0xbb, 0xae, 0x00, 0x00, 0x00, 
+  0x01, 0x4b, 0xf5, 0x23, 0xa4, 0xfc, 0xfb, 0x90, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf5, 0x44, 0x96, 0xa3, 0xfc, 0xff, 0x00, 0x2b, 0xf5, 0x2b, 0xa5, 
+  0x00, 0x00, 0x00, 0x89, 0xa3, 0xfc, 0xff, 0x04, 0xae, 0xfd, 0xff, 0xaf, 0xf5, 0xff, 0x29, 0xfd, 0xff, 0xa4, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 0xa2, 
+  0x00, 0x00, 0x00, 0x00, 0xa4, 0xfc, 0xfc, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x11, 0xfe, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x03, 0x2a, 
+  0xfd, 0xff, 0x8e, 0xfd, 0xff, 0xc6, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0x85, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xfc, 0xa4, 0xfc, 0xe4, 0x9f, 0x00, 0x00, 0x00, 0x8b, 0xa3, 0xfc, 0xff, 0x01, 0xa3, 
+  0xf4, 0xff, 0x9c, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0x96, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xff, 0xff, 0xd7, 0xf6, 0xff, 
+  0x87, 0xa3, 0xfc, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf5, 0x0b, 0x8c, 0xa3, 0xfc, 0xff, 0x01, 0xc5, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x0a, 0xf5, 0xff, 0x81, 
+  0xa3, 0xfc, 0xff, 0x00, 0x19, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xfe, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xf4, 0x6c, 0x8d, 0xa3, 0xfc, 0xff, 0x00, 
+  0x6c, 0xfd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x75, 0xfe, 0xff, 0x89, 0xa3, 
+  0xfc, 0xff, 0x00, 0x2b, 0xf5, 0x23, 0x97, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf5, 0x03, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xff, 0x85, 0xa3, 0xfc, 0xff, 0x00, 0xf1, 0xfd, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf1, 0xfd, 0xff, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 0x6c, 0xf5, 
+  0x0b, 0x96, 0x00, 0x00, 0x00, 0x86, 0xa3, 0xfc, 0xff, 0x09, 0xa4, 0xfc, 0xff, 0x39, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0x95, 0xfe, 0xff, 0xf1, 0xfd, 0xff, 0x6c, 0xfd, 0xff, 0xa5, 
+  0xf4, 0xff, 0xa4, 0xfc, 0xff, 0x96, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0x09, 0xf5, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x4c, 0xfd, 0xff, 
+  0x8b, 0xa3, 0xfc, 0xff, 0x95, 0x00, 0x00, 0x00, 0x87, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0xdd, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0x9c, 0xff, 0xff, 0xbd, 0xff, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0x03, 0x5b, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0xa5, 0xf4, 0xff, 0xaf, 0xfd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xa5, 0xf4, 0xff, 0x8c, 0xa3, 0xfc, 0xff, 0x93, 0x00, 
+  0x00, 0x00, 0x00, 0xa4, 0xfc, 0xfb, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0xe8, 0xf4, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9c, 0xff, 
+  0xff, 0xa4, 0xf4, 0xff, 0x8c, 0xa3, 0xfc, 0xff, 0x00, 0xa5, 0xf4, 0xdf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xf5, 0x2c, 0x88, 0xa3, 0xfc, 0xff, 0x00, 0xaf, 0xfd, 0xff, 0x93, 0xff, 0xff, 0xff, 
+  0x02, 0xbc, 0xff, 0xff, 0xd7, 0xfe, 0xff, 0x4c, 0xf5, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x00, 0x2b, 0xf5, 0x30, 0x90, 0x00, 0x00, 0x00, 0x89, 0xa3, 
+  0xfc, 0xff, 0x03, 0x4c, 0xfd, 0xff, 0xb7, 0xfe, 0xff, 0x5a, 0xff, 0xff, 0xbd, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0x3a, 0xff, 0xff, 0x8e, 0xf5, 0xff, 0x8a, 0xa3, 0xfc, 0xff, 0x8f, 0x00, 
+  0x00, 0x00, 0x00, 0xe8, 0xfc, 0x7c, 0x8a, 0xa3, 0xfc, 0xff, 0x04, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xaf, 0xf5, 0xff, 0xbd, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0xf8, 
+  0xfe, 0xff, 0x2b, 0xfd, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x00, 0x2b, 0xf5, 0x30, 0x8e, 0x00, 0x00, 0x00, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0xb7, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xff, 
+  0xff, 0xf8, 0xfe, 0xff, 0x5a, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xdd, 0xff, 0xff, 0x2b, 0xf5, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x8d, 0x00, 0x00, 0x00, 
+  0x00, 0x09, 0xf5, 0x68, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0x96, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x07, 0x7b, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0xe7, 0xf4, 0xff, 
+  0xf2, 0xf5, 0xff, 0x19, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x39, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 
+  0x00, 0x19, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xfe, 0xff, 0x85, 0xa3, 0xfc, 0xff, 0x01, 0x0b, 0xf5, 0xff, 0x19, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0xaf, 0xfd, 0xff, 0x87, 
+  0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfb, 0x8c, 0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0x96, 0xfe, 0xff, 0x86, 0xa3, 0xfc, 0xff, 0x01, 
+  0xa4, 0xf4, 0xff, 0x3a, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xb7, 0xfe, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf5, 0x1f, 0x8f, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 
+  0xfc, 0xff, 0x9c, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xf1, 0xfd, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0x8e, 0xfd, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x88, 0xa3, 0xfc, 
+  0xff, 0x00, 0x4b, 0xfd, 0x27, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 0x01, 0xa5, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0x6c, 0xfd, 0xff, 0x87, 0xa3, 0xfc, 0xff, 
+  0x00, 0xe7, 0xf4, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0x5a, 0xff, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xf4, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 0x00, 0x4b, 0xfd, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xa5, 0xf4, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0xae, 0xf5, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x89, 0xa3, 0xfc, 0xff, 0x8a, 
+  0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 0x00, 0xd1, 0xfd, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0x86, 0xa3, 0xfc, 0xff, 0x01, 0xc5, 0xf4, 0xff, 0x3a, 0xff, 
+  0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0x12, 0xfe, 0xff, 0x89, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 0x00, 0x95, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x03, 0x7c, 0xff, 
+  0xff, 0x6d, 0xfd, 0xff, 0xa5, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0x82, 0xa3, 0xfc, 0xff, 0x02, 0xa4, 0xfc, 0xff, 0x6d, 0xfd, 0xff, 0x5a, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0x9c, 0xff, 0xff, 
+  0xa4, 0xf4, 0xff, 0x89, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xbc, 0xff, 0xff, 0x82, 0x5b, 
+  0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x8a, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xa3, 0xfc, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x94, 0xff, 
+  0xff, 0xff, 0x01, 0xdd, 0xff, 0xff, 0x13, 0xf6, 0xff, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xf4, 0xff, 0xdd, 0xff, 0xff, 
+  0x93, 0xff, 0xff, 0xff, 0x01, 0x5b, 0xff, 0xff, 0xe8, 0xf4, 0xff, 0x8c, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0xc6, 0xf4, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 
+  0xbc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x39, 0xff, 0xff, 0x2b, 0xfd, 0xff, 0x8b, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0xae, 0xf5, 
+  0xff, 0x86, 0xff, 0xff, 0xff, 0x06, 0xa4, 0xf4, 0xff, 0xa5, 0xf4, 0xff, 0x4b, 0xfd, 0xff, 0xb0, 0xfd, 0xff, 0x12, 0xfe, 0xff, 0xd8, 0xfe, 0xff, 0xbd, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 
+  0xde, 0xff, 0xff, 0xd0, 0xfd, 0xff, 0x8a, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0x33, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xdd, 0xff, 0xff, 0xa4, 0xfc, 
+  0xff, 0x84, 0xa3, 0xfc, 0xff, 0x02, 0xa4, 0xf4, 0xff, 0xd0, 0xfd, 0xff, 0x5b, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xde, 0xff, 0xff, 0x2b, 0xf5, 0xff, 0x89, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 
+  0x00, 0x00, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0xb6, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xf4, 0xff, 0x96, 0xfe, 0xff, 0x87, 0xff, 0xff, 
+  0xff, 0x01, 0xf8, 0xfe, 0xff, 0xa4, 0xfc, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0x39, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xf8, 0xfe, 0xff, 
+  0xa4, 0xfc, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x00, 0xd7, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xc5, 0xf4, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xa4, 
+  0xfc, 0xfc, 0x8d, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0x7c, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0x95, 0xfe, 0xff, 0x89, 0xa3, 0xfc, 0xff, 0x00, 0x6c, 0xf5, 0xff, 0x87, 0xff, 0xff, 
+  0xff, 0x00, 0x6c, 0xfd, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xf5, 0x38, 0x8d, 0xa3, 0xfc, 0xff, 0x01, 0xa5, 0xf4, 0xff, 0xfe, 0xff, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0x00, 0xf1, 0xfd, 0xff, 0x89, 0xa3, 0xfc, 0xff, 0x00, 0xc7, 0xf4, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0x6d, 0xfd, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0x2a, 0xf5, 0x3f, 
+  0x8b, 0x00, 0x00, 0x00, 0x89, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xff, 0x82, 0xa3, 0xfc, 0xff, 0x00, 0xaf, 0xfd, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0x6d, 0xfd, 0xff, 0x88, 0xa3, 0xfc, 0xff, 
+  0x01, 0xa4, 0xfc, 0xff, 0xd0, 0xfd, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xc7, 0xf4, 0xff, 0xa4, 0xfc, 0xff, 0x86, 0xa3, 0xfc, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x88, 0xa3, 0xfc, 0xff, 0x05, 0xa4, 
+  0xf4, 0xff, 0x39, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xd7, 0xfe, 0xff, 0xb6, 0xf6, 0xff, 0x9c, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xa5, 0xf4, 0xff, 0x86, 0xa3, 0xfc, 0xff, 
+  0x03, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xf4, 0xff, 0x3a, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xff, 0xff, 0xa4, 0xf4, 0xff, 0x86, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 
+  0x8c, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0x6c, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0x8e, 0xf5, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xdd, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0xa5, 0xf4, 0xff, 0x81, 0xa4, 
+  0xfc, 0xff, 0x83, 0xa3, 0xfc, 0xff, 0x02, 0xa4, 0xf4, 0xff, 0x8e, 0xfd, 0xff, 0x3a, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xfe, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0x4c, 0xf5, 0x07, 
+  0x8d, 0x00, 0x00, 0x00, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x18, 0xff, 0xff, 0xd8, 0xfe, 0xff, 
+  0xf8, 0xfe, 0xff, 0x5a, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 0xcf, 0xfd, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xfc, 0xb0, 0x85, 0xa3, 0xfc, 
+  0xff, 0x01, 0xa4, 0xf4, 0xff, 0xbd, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xff, 0x01, 0x7b, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0x86, 0xa3, 0xfc, 0xff, 0x00, 0x0a, 0xf5, 0x53, 0x8f, 0x00, 0x00, 0x00, 0x84, 
+  0xa3, 0xfc, 0xff, 0x03, 0xa4, 0xfc, 0xff, 0x4b, 0xfd, 0xff, 0x7b, 0xff, 0xff, 0xdd, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x8e, 0xfd, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x90, 
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0xf5, 0x23, 0x86, 0xa3, 0xfc, 0xff, 0x06, 0xa4, 0xf4, 0xff, 0xe8, 0xfc, 0xff, 0xaf, 0xfd, 0xff, 0x33, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0x3a, 0xff, 0xff, 0x9c, 0xff, 
+  0xff, 0x94, 0xff, 0xff, 0xff, 0x01, 0xde, 0xff, 0xff, 0xd0, 0xfd, 0xff, 0x87, 0xa3, 0xfc, 0xff, 0x00, 0x4c, 0xf5, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xfc, 0xfb, 0x8b, 0xa3, 0xfc, 0xff, 
+  0x00, 0x2a, 0xfd, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x3a, 0xff, 0xff, 0x4c, 0xf5, 0xff, 0x86, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 
+  0xfc, 0xfc, 0xa4, 0xfc, 0xfb, 0x93, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xfc, 0xfc, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 0xd0, 0xfd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x9c, 0xff, 0xff, 0x81, 0xa4, 0xfc, 
+  0xff, 0x01, 0xc7, 0xf4, 0xff, 0xdd, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x82, 0x5a, 0xff, 0xff, 0x04, 0x5b, 0xff, 0xff, 0x39, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0x12, 0xfe, 
+  0xff, 0xe8, 0xfc, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xff, 0x84, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0xa3, 0xfc, 0xff, 0x95, 0x00, 0x00, 0x00, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 
+  0x74, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x3a, 0xff, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0xc7, 0xf4, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x8e, 0xfd, 0xff, 0x90, 0xa3, 0xfc, 0xff, 0x96, 
+  0x00, 0x00, 0x00, 0x00, 0x4b, 0xfd, 0x23, 0x89, 0xa3, 0xfc, 0xff, 0x00, 0xd7, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xb7, 0xfe, 0xff, 0xa3, 0xfc, 0xff, 0xa4, 0xfc, 0xff, 0x8e, 0xfd, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xc7, 0xf4, 0xff, 0x8f, 0xa3, 0xfc, 0xff, 0x00, 0x2b, 0xf5, 0x27, 0x97, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xf4, 0x68, 0x88, 0xa3, 0xfc, 0xff, 0x00, 
+  0x5a, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x53, 0xfe, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0x32, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xff, 0xff, 0xa4, 0xfc, 0xff, 0x8e, 0xa3, 
+  0xfc, 0xff, 0x00, 0x4b, 0xfd, 0x27, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf5, 0x48, 0x86, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xfc, 0xff, 0xbd, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xaf, 0xf5, 
+  0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0xb6, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x5b, 0xff, 0xff, 0x8d, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xa3, 0xfc, 
+  0xff, 0xa4, 0xfc, 0xfc, 0x83, 0xa3, 0xfc, 0xff, 0x02, 0xa4, 0xf4, 0xff, 0x5b, 0xff, 0xff, 0xde, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0x09, 0xf5, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0x39, 
+  0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xfe, 0xff, 0x8d, 0xa3, 0xfc, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xfc, 0xfb, 0x85, 0xa3, 0xfc, 0xff, 0x03, 0xa4, 0xf4, 0xff, 0x08, 0xf5, 
+  0xff, 0xaf, 0xf5, 0xff, 0xa4, 0xfc, 0xff, 0x81, 0xa3, 0xfc, 0xff, 0x01, 0x19, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0x74, 0xfe, 0xff, 0x8b, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 
+  0xf4, 0xe4, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xfd, 0x2c, 0x8b, 0xa3, 0xfc, 0xff, 0x03, 0xa5, 0xf4, 0xff, 0x6c, 0xfd, 0xff, 0xf1, 0xfd, 0xff, 0x2b, 0xfd, 0xff, 0x8a, 0xa3, 0xfc, 0xff, 0x00, 
+  0x2b, 0xfd, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf5, 0x48, 0x8b, 0xa3, 0xfc, 0xff, 0x81, 0xa4, 0xfc, 0xff, 0x88, 0xa3, 0xfc, 0xff, 0x00, 0x2b, 0xf5, 0x23, 0xa8, 0x00, 0x00, 0x00, 0x00, 
+  0x4c, 0xf5, 0x1f, 0x81, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 0x8c, 0xa3, 0xfc, 0xff, 0x00, 0xa4, 0xfc, 0xfc, 0x81, 0xa3, 0xfc, 0xff, 0xae, 0x00, 0x00, 0x00, 0x01, 0x2b, 0xf5, 0x3b, 0xa4, 
+  0xfc, 0xfb, 0x8a, 0xa3, 0xfc, 0xff, 0x01, 0xa4, 0xf4, 0xfb, 0x4c, 0xf5, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xff, 0x5b, 0x00, 0xfe, 0xf8, 0x00, 0xfe, 0x96, 0x00, 0xfe, 0x33, 0x00, 0xf5, 0xd1, 0x00, 0xf5, 0xd1, 0x00, 0xf5, 0xd1, 0x00, 0xfe, 0x33, 0x00, 0xfe, 0x96, 0x00, 0xfe, 0xf8, 0x00, 0xff, 0x7b, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x7c, 0x00, 0xfe, 0xb6, 0x00, 0xfd, 0xaf, 0x00, 0xf4, 0xa5, 0xd0, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xc6, 0xbb, 0xfd, 0xd0, 0x00, 0xfe, 0xd7, 0x00, 0xff, 0x9c, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xfe, 0xb7, 0x00, 0xf5, 0x4b, 0x23, 0xfc, 0xa4, 0xfb, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xf5, 0x6d, 0x00, 0xfe, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xfe, 0xd8, 0x00, 0xf5, 0x0a, 0x44, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x2b, 0x2b, 0xff, 0x19, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x5b, 0x00, 0xf5, 0x8e, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0xae, 0xff, 0xf5, 0xaf, 0xff, 0xfd, 0x29, 0xff, 0xf4, 0xa4, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xfd, 0xaf, 0x00, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xf6, 0x54, 0x00, 0xfc, 0xa4, 0xfc, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0x11, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x2a, 0xff, 0xfd, 0x8e, 0xff, 0xf4, 0xc6, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xfc, 0xa4, 0xe4, 0xfe, 0x96, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xde, 0x00, 0xfd, 0xaf, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa3, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xd0, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xf6, 0xd7, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0xd1, 0x00, 0xff, 0xde, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x7c, 0x00, 0xf5, 0x4c, 0x0b, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xc5, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0a, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x8e, 0x00, 0xff, 0xbd, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x9c, 0x00, 0xf4, 0xe9, 0x6c, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x75, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x2b, 0x23, 0xff, 0xbd, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xde, 0x00, 0xf5, 0x6d, 0x03, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf1, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x6c, 0x0b, 0xff, 0xde, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xde, 0x00, 0xf5, 0x8e, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xff, 0x39, 0xff, 0xff, 0x5b, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0x95, 0xff, 0xfd, 0xf1, 0xff, 0xfd, 0x6c, 0xff, 0xf4, 0xa5, 0xff, 0xfc, 0xa4, 0xff, 0xfe, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x4c, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0xd1, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x33, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xfd, 0x6c, 0xff, 0xf4, 0xa5, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xa5, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x96, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x5a, 0x00, 0xfc, 0xa4, 0xfb, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xf4, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa5, 0xdf, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xf5, 0x2b, 0x2c, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xfe, 0xd7, 0xff, 0xf5, 0x4c, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x2b, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xb6, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x4c, 0xff, 0xfe, 0xb7, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xf5, 0x8e, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x19, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbd, 0x00, 0xfc, 0xe8, 0x7c, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfd, 0x2b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x2b, 0x30, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x95, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xf5, 0x2b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xf8, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xf5, 0x09, 0x68, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xf4, 0xe7, 0xff, 0xf5, 0xf2, 0xff, 0xff, 0x19, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x6d, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x5a, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x0b, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfb, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x54, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x96, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb7, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x54, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf5, 0x4c, 0x1f, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf1, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x4b, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbc, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x6c, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xfb, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x19, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xa5, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd8, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x96, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xc5, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x12, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xf8, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x12, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xfd, 0x6d, 0xff, 0xf4, 0xa5, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfd, 0x6d, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xf4, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x96, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf5, 0xb0, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xbc, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xd0, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x33, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfd, 0xaf, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xf6, 0x13, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xf5, 0xd1, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfd, 0xaf, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xf4, 0xe8, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0xd0, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfd, 0xaf, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xfd, 0x2b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0xd1, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf5, 0xb0, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0xff, 0xf4, 0xa5, 0xff, 0xfd, 0x4b, 0xff, 0xfd, 0xb0, 0xff, 0xfe, 0x12, 0xff, 0xfe, 0xd8, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xfd, 0xd0, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x33, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x12, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xfd, 0xd0, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xf5, 0x2b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x96, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x95, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xfe, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xd8, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x19, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xc5, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbc, 0x00, 0xfc, 0xa4, 0xfc, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x95, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x6c, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfb, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf5, 0x2b, 0x38, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf1, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x6d, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x2a, 0x3f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x54, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x6d, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfd, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc7, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x54, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x5a, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0x39, 0xff, 0xff, 0x5a, 0xff, 0xfe, 0xd7, 0xff, 0xf6, 0xb6, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xa5, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xf4, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xfd, 0x09, 0x6c, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xfd, 0x6c, 0xff, 0xf4, 0xa5, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xfd, 0x8e, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x4c, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x95, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x18, 0xff, 0xfe, 0xd8, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xf8, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbd, 0x00, 0xfc, 0xc6, 0xb0, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x0a, 0x53, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xb6, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfd, 0x4b, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0x8e, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xf8, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xf5, 0x2b, 0x23, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xfc, 0xe8, 0xff, 0xfd, 0xaf, 0xff, 0xfe, 0x33, 0xff, 0xfe, 0xb7, 0xff, 0xff, 0x3a, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xfd, 0xd0, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x4c, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x39, 0x00, 0xfc, 0xa4, 0xfb, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xf5, 0x4c, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xfc, 0xa4, 0xfb, 0xff, 0x5a, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x33, 0x00, 0xfc, 0xa4, 0xfc, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa4, 0xff, 0xf4, 0xc7, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x39, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0x12, 0xff, 0xfc, 0xe8, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x96, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xde, 0x00, 0xfd, 0x8e, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x8e, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0xd0, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbd, 0x00, 0xfd, 0x4b, 0x23, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb7, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfd, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xc7, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x2b, 0x27, 0xff, 0xdd, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x9c, 0x00, 0xf4, 0xe9, 0x68, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x53, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x4b, 0x27, 0xff, 0xbd, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x9c, 0x00, 0xf5, 0x0a, 0x48, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xaf, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfe, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xf5, 0x6d, 0x00, 0xff, 0xbd, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbd, 0x00, 0xf5, 0x8f, 0x00, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x09, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd7, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0xd0, 0x00, 0xff, 0xde, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xf6, 0x54, 0x00, 0xfc, 0xa4, 0xfb, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xf5, 0x08, 0xff, 0xf5, 0xaf, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf7, 0x19, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x74, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xe4, 0xfe, 0x96, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x5a, 0x00, 0xfd, 0x2b, 0x2c, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa5, 0xff, 0xfd, 0x6c, 0xff, 0xfd, 0xf1, 0xff, 0xfd, 0x2b, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfd, 0x2b, 0x2b, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xde, 0x00, 0xfe, 0xd7, 0x00, 0xf5, 0x0a, 0x48, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x2b, 0x23, 0xfe, 0xf9, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xfe, 0xb7, 0x00, 0xf5, 0x4c, 0x1f, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xfc, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf5, 0x6d, 0x00, 0xfe, 0xf8, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x5b, 0x00, 0xfe, 0x54, 0x00, 0xf5, 0x2b, 0x3b, 0xfc, 0xa4, 0xfb, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xfb, 0xf5, 0x4c, 0x1f, 0xfe, 0x54, 0x00, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xff, 0x5b, 0x00, 0xfe, 0xf8, 0x00, 0xfe, 0x96, 0x00, 0xfe, 0x33, 0x00, 0xfd, 0xd2, 0x00, 0xf5, 0xd1, 0x00, 0xfd, 0xd1, 0x00, 0xfe, 0x33, 0x00, 0xfe, 0x96, 0x00, 0xfe, 0xf8, 0x00, 0xff, 0x7b, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa5, 0xd0, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 0xc6, 0xbb, 0xae, 0x00, 0x00, 0x00, 
+  0x01, 0xf5, 0x4b, 0x23, 0xfc, 0xa4, 0xfb, 0x90, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfc, 0xa9, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x0a, 0x44, 0x96, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x2b, 0x2b, 0xa5, 
+  0x00, 0x00, 0x00, 0x89, 0xfc, 0xa3, 0xff, 0x04, 0xfd, 0xae, 0xff, 0xf5, 0xaf, 0xff, 0xfd, 0x29, 0xff, 0xf4, 0xa4, 0xff, 0xfc, 0xa4, 0xff, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfc, 0xa2, 
+  0x00, 0x00, 0x00, 0x00, 0xfc, 0xa4, 0xfc, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xfe, 0x11, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x03, 0xfd, 
+  0x2a, 0xff, 0xfd, 0x8e, 0xff, 0xf4, 0xc6, 0xff, 0xfc, 0xa4, 0xff, 0x85, 0xfc, 0xa3, 0xff, 0x01, 0xfc, 0xa4, 0xfc, 0xfc, 0xa4, 0xe4, 0x9f, 0x00, 0x00, 0x00, 0x8b, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 
+  0xa3, 0xff, 0xff, 0x9c, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf5, 0xd0, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0x96, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xff, 0xbd, 0xff, 0xf6, 0xd7, 0xff, 
+  0x87, 0xfc, 0xa3, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x4c, 0x0b, 0x8c, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xc5, 0xff, 0xff, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf5, 0x0a, 0xff, 0x81, 
+  0xfc, 0xa3, 0xff, 0x00, 0xff, 0x19, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xf8, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe9, 0x6c, 0x8d, 0xfc, 0xa3, 0xff, 0x00, 
+  0xfd, 0x6c, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xf4, 0xa4, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x75, 0xff, 0x89, 0xfc, 
+  0xa3, 0xff, 0x00, 0xf5, 0x2b, 0x23, 0x97, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x6d, 0x03, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xff, 0x85, 0xfc, 0xa3, 0xff, 0x00, 0xfd, 0xf1, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0x00, 0xff, 0x7c, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xa4, 0xff, 0xff, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xf1, 0xff, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x6c, 
+  0x0b, 0x96, 0x00, 0x00, 0x00, 0x86, 0xfc, 0xa3, 0xff, 0x09, 0xfc, 0xa4, 0xff, 0xff, 0x39, 0xff, 0xff, 0x5b, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0x95, 0xff, 0xfd, 0xf1, 0xff, 0xfd, 0x6c, 0xff, 0xf4, 
+  0xa5, 0xff, 0xfc, 0xa4, 0xff, 0xfe, 0x96, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x09, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xfd, 0x4c, 0xff, 
+  0x8b, 0xfc, 0xa3, 0xff, 0x95, 0x00, 0x00, 0x00, 0x87, 0xfc, 0xa3, 0xff, 0x01, 0xfc, 0xa4, 0xff, 0xff, 0xdd, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9c, 0xff, 0xff, 0xbd, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0x03, 0xff, 0x5b, 0xff, 0xfd, 0x6c, 0xff, 0xf4, 0xa5, 0xff, 0xfd, 0xaf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xf4, 0xa5, 0xff, 0x8c, 0xfc, 0xa3, 0xff, 0x93, 0x00, 
+  0x00, 0x00, 0x00, 0xfc, 0xa4, 0xfb, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 0xe8, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9c, 
+  0xff, 0xf4, 0xa4, 0xff, 0x8c, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 0xa5, 0xdf, 0x91, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x2b, 0x2c, 0x88, 0xfc, 0xa3, 0xff, 0x00, 0xfd, 0xaf, 0xff, 0x93, 0xff, 0xff, 0xff, 
+  0x02, 0xff, 0xbc, 0xff, 0xfe, 0xd7, 0xff, 0xf5, 0x4c, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x2b, 0x30, 0x90, 0x00, 0x00, 0x00, 0x89, 0xfc, 
+  0xa3, 0xff, 0x03, 0xfd, 0x4c, 0xff, 0xfe, 0xb7, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xbd, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0x3a, 0xff, 0xf5, 0x8e, 0xff, 0x8a, 0xfc, 0xa3, 0xff, 0x8f, 0x00, 
+  0x00, 0x00, 0x00, 0xfc, 0xe8, 0x7c, 0x8a, 0xfc, 0xa3, 0xff, 0x04, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xf5, 0xaf, 0xff, 0xff, 0xbd, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0xfe, 
+  0xf8, 0xff, 0xfd, 0x2b, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x2b, 0x30, 0x8e, 0x00, 0x00, 0x00, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0xb7, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 0xff, 0xfe, 
+  0xff, 0xfe, 0xf8, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdd, 0xff, 0xf5, 0x2b, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x8d, 0x00, 0x00, 0x00, 
+  0x00, 0xf5, 0x09, 0x68, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0x96, 0xff, 0x85, 0xff, 0xff, 0xff, 0x07, 0xff, 0x7b, 0xff, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xf4, 0xe7, 0xff, 
+  0xf5, 0xf2, 0xff, 0xff, 0x19, 0xff, 0xff, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0x39, 0xff, 0xfc, 0xa4, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 
+  0x00, 0xff, 0x19, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xf8, 0xff, 0x85, 0xfc, 0xa3, 0xff, 0x01, 0xf5, 0x0b, 0xff, 0xff, 0x19, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xaf, 0xff, 0x87, 
+  0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfb, 0x8c, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x96, 0xff, 0x86, 0xfc, 0xa3, 0xff, 0x01, 
+  0xf4, 0xa4, 0xff, 0xff, 0x3a, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xb7, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x4c, 0x1f, 0x8f, 0xfc, 0xa3, 0xff, 0x01, 0xfc, 
+  0xa4, 0xff, 0xff, 0x9c, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xf1, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xfd, 0x8e, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x88, 0xfc, 0xa3, 
+  0xff, 0x00, 0xfd, 0x4b, 0x27, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xa5, 0xff, 0xff, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfd, 0x6c, 0xff, 0x87, 0xfc, 0xa3, 0xff, 
+  0x00, 0xf4, 0xe7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0x5a, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 0xa4, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 0x00, 0xfd, 0x4b, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xf4, 0xa5, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0xae, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xd8, 0xff, 0x89, 0xfc, 0xa3, 0xff, 0x8a, 
+  0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 0x00, 0xfd, 0xd1, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xbd, 0xff, 0xfc, 0xa4, 0xff, 0x86, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xc5, 0xff, 0xff, 0x3a, 
+  0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x12, 0xff, 0x89, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0x95, 0xff, 0x85, 0xff, 0xff, 0xff, 0x03, 0xff, 0x7c, 
+  0xff, 0xfd, 0x6d, 0xff, 0xf4, 0xa5, 0xff, 0xfc, 0xa4, 0xff, 0x82, 0xfc, 0xa3, 0xff, 0x02, 0xfc, 0xa4, 0xff, 0xfd, 0x6d, 0xff, 0xff, 0x5a, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9c, 0xff, 
+  0xf4, 0xa4, 0xff, 0x89, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0xd8, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xff, 0xbc, 0xff, 0x82, 0xff, 
+  0x5b, 0xff, 0x00, 0xff, 0xdd, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xf5, 0xd0, 0xff, 0x8a, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x90, 0xfc, 0xa3, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x94, 0xff, 
+  0xff, 0xff, 0x01, 0xff, 0xdd, 0xff, 0xf6, 0x13, 0xff, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfc, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xa4, 0xff, 0xff, 0xdd, 0xff, 
+  0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0x5b, 0xff, 0xf4, 0xe8, 0xff, 0x8c, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 0xc6, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xbc, 0xff, 0xff, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0x39, 0xff, 0xfd, 0x2b, 0xff, 0x8b, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0xae, 
+  0xff, 0x86, 0xff, 0xff, 0xff, 0x06, 0xf4, 0xa4, 0xff, 0xf4, 0xa5, 0xff, 0xfd, 0x4b, 0xff, 0xfd, 0xb0, 0xff, 0xfe, 0x12, 0xff, 0xfe, 0xd8, 0xff, 0xff, 0xbd, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xde, 0xff, 0xfd, 0xd0, 0xff, 0x8a, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0x33, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdd, 0xff, 0xfc, 0xa4, 
+  0xff, 0x84, 0xfc, 0xa3, 0xff, 0x02, 0xf4, 0xa4, 0xff, 0xfd, 0xd0, 0xff, 0xff, 0x5b, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xde, 0xff, 0xf5, 0x2b, 0xff, 0x89, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 
+  0x00, 0x00, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0xb6, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xa4, 0xff, 0xfe, 0x96, 0xff, 0x87, 0xff, 0xff, 
+  0xff, 0x01, 0xfe, 0xf8, 0xff, 0xfc, 0xa4, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xff, 0x39, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xf8, 0xff, 
+  0xfc, 0xa4, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0xd7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xf4, 0xc5, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xfc, 
+  0xa4, 0xfc, 0x8d, 0xfc, 0xa3, 0xff, 0x01, 0xfc, 0xa4, 0xff, 0xff, 0x7c, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x95, 0xff, 0x89, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x6c, 0xff, 0x87, 0xff, 0xff, 
+  0xff, 0x00, 0xfd, 0x6c, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x2b, 0x38, 0x8d, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xa5, 0xff, 0xff, 0xfe, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xf1, 0xff, 0x89, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 0xc7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0xfd, 0x6d, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x2a, 0x3f, 
+  0x8b, 0x00, 0x00, 0x00, 0x89, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xff, 0x82, 0xfc, 0xa3, 0xff, 0x00, 0xfd, 0xaf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xfd, 0x6d, 0xff, 0x88, 0xfc, 0xa3, 0xff, 
+  0x01, 0xfc, 0xa4, 0xff, 0xfd, 0xd0, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xf4, 0xc7, 0xff, 0xfc, 0xa4, 0xff, 0x86, 0xfc, 0xa3, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x88, 0xfc, 0xa3, 0xff, 0x05, 0xf4, 
+  0xa4, 0xff, 0xff, 0x39, 0xff, 0xff, 0x5a, 0xff, 0xfe, 0xd7, 0xff, 0xf6, 0xb6, 0xff, 0xff, 0x9c, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xf4, 0xa5, 0xff, 0x86, 0xfc, 0xa3, 0xff, 
+  0x03, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0xf4, 0xa4, 0xff, 0xff, 0x3a, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xff, 0xbd, 0xff, 0xf4, 0xa4, 0xff, 0x86, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfc, 
+  0x8c, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x09, 0x6c, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x8e, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdd, 0xff, 0xfd, 0x6c, 0xff, 0xf4, 0xa5, 0xff, 0x81, 0xfc, 
+  0xa4, 0xff, 0x83, 0xfc, 0xa3, 0xff, 0x02, 0xf4, 0xa4, 0xff, 0xfd, 0x8e, 0xff, 0xff, 0x3a, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xf8, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x4c, 0x07, 
+  0x8d, 0x00, 0x00, 0x00, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0xd8, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x07, 0xff, 0xfe, 0xff, 0xff, 0x9c, 0xff, 0xff, 0x5a, 0xff, 0xff, 0x18, 0xff, 0xfe, 0xd8, 0xff, 
+  0xfe, 0xf8, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xdd, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xcf, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xc6, 0xb0, 0x85, 0xfc, 0xa3, 
+  0xff, 0x01, 0xf4, 0xa4, 0xff, 0xff, 0xbd, 0xff, 0x9d, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7b, 0xff, 0xfc, 0xa4, 0xff, 0x86, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x0a, 0x53, 0x8f, 0x00, 0x00, 0x00, 0x84, 
+  0xfc, 0xa3, 0xff, 0x03, 0xfc, 0xa4, 0xff, 0xfd, 0x4b, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xdd, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xfd, 0x8e, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x90, 
+  0x00, 0x00, 0x00, 0x00, 0xf5, 0x2b, 0x23, 0x86, 0xfc, 0xa3, 0xff, 0x06, 0xf4, 0xa4, 0xff, 0xfc, 0xe8, 0xff, 0xfd, 0xaf, 0xff, 0xfe, 0x33, 0xff, 0xfe, 0xb7, 0xff, 0xff, 0x3a, 0xff, 0xff, 0x9c, 
+  0xff, 0x94, 0xff, 0xff, 0xff, 0x01, 0xff, 0xde, 0xff, 0xfd, 0xd0, 0xff, 0x87, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x4c, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xa4, 0xfb, 0x8b, 0xfc, 0xa3, 0xff, 
+  0x00, 0xfd, 0x2a, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9c, 0xff, 0xff, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0x3a, 0xff, 0xf5, 0x4c, 0xff, 0x86, 0xfc, 0xa3, 0xff, 0x01, 0xfc, 
+  0xa4, 0xfc, 0xfc, 0xa4, 0xfb, 0x93, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xa4, 0xfc, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 0xfd, 0xd0, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xff, 0x9c, 0xff, 0x81, 0xfc, 0xa4, 
+  0xff, 0x01, 0xf4, 0xc7, 0xff, 0xff, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xff, 0x7b, 0xff, 0x82, 0xff, 0x5a, 0xff, 0x04, 0xff, 0x5b, 0xff, 0xff, 0x39, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0x12, 
+  0xff, 0xfc, 0xe8, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xff, 0x84, 0xfc, 0xa3, 0xff, 0x01, 0xfc, 0xa4, 0xff, 0xfc, 0xa3, 0xff, 0x95, 0x00, 0x00, 0x00, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 
+  0xfe, 0x74, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xff, 0x3a, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 0xc7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xfd, 0x8e, 0xff, 0x90, 0xfc, 0xa3, 0xff, 0x96, 
+  0x00, 0x00, 0x00, 0x00, 0xfd, 0x4b, 0x23, 0x89, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0xd7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xb7, 0xff, 0xfc, 0xa3, 0xff, 0xfc, 0xa4, 0xff, 0xfd, 0x8e, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xf4, 0xc7, 0xff, 0x8f, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x2b, 0x27, 0x97, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe9, 0x68, 0x88, 0xfc, 0xa3, 0xff, 0x00, 
+  0xff, 0x5a, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x53, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0x32, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xbd, 0xff, 0xfc, 0xa4, 0xff, 0x8e, 0xfc, 
+  0xa3, 0xff, 0x00, 0xfd, 0x4b, 0x27, 0x99, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x0a, 0x48, 0x86, 0xfc, 0xa3, 0xff, 0x01, 0xfc, 0xa4, 0xff, 0xff, 0xbd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf5, 0xaf, 
+  0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xfe, 0xb6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xff, 0x5b, 0xff, 0x8d, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfc, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xfc, 0xa3, 
+  0xff, 0xfc, 0xa4, 0xfc, 0x83, 0xfc, 0xa3, 0xff, 0x02, 0xf4, 0xa4, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xde, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0xf5, 0x09, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xff, 
+  0x39, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xd7, 0xff, 0x8d, 0xfc, 0xa3, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xa4, 0xfb, 0x85, 0xfc, 0xa3, 0xff, 0x03, 0xf4, 0xa4, 0xff, 0xf5, 0x08, 
+  0xff, 0xf5, 0xaf, 0xff, 0xfc, 0xa4, 0xff, 0x81, 0xfc, 0xa3, 0xff, 0x01, 0xf7, 0x19, 0xff, 0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x74, 0xff, 0x8b, 0xfc, 0xa3, 0xff, 0x00, 0xf4, 
+  0xa4, 0xe4, 0xa1, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x2b, 0x2c, 0x8b, 0xfc, 0xa3, 0xff, 0x03, 0xf4, 0xa5, 0xff, 0xfd, 0x6c, 0xff, 0xfd, 0xf1, 0xff, 0xfd, 0x2b, 0xff, 0x8a, 0xfc, 0xa3, 0xff, 0x00, 
+  0xfd, 0x2b, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x0a, 0x48, 0x8b, 0xfc, 0xa3, 0xff, 0x81, 0xfc, 0xa4, 0xff, 0x88, 0xfc, 0xa3, 0xff, 0x00, 0xf5, 0x2b, 0x23, 0xa8, 0x00, 0x00, 0x00, 0x00, 
+  0xf5, 0x4c, 0x1f, 0x81, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfc, 0x8c, 0xfc, 0xa3, 0xff, 0x00, 0xfc, 0xa4, 0xfc, 0x81, 0xfc, 0xa3, 0xff, 0xae, 0x00, 0x00, 0x00, 0x01, 0xf5, 0x2b, 0x3b, 0xfc, 
+  0xa4, 0xfb, 0x8a, 0xfc, 0xa3, 0xff, 0x01, 0xf4, 0xa4, 0xfb, 0xf5, 0x4c, 0x1f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xf3, 0xfd, 0xfe, 0x00, 0xd6, 0xea, 0xf8, 0x00, 0xbf, 0xdb, 0xf6, 0x00, 0xad, 0xd0, 0xf6, 0x00, 0x95, 0xc4, 0xf8, 0x00, 0x86, 0xba, 0xf2, 0x00, 0x85, 0xb7, 0xf1, 0x00, 0x87, 0xba, 0xf2, 0x00, 0x98, 0xc5, 0xf8, 0x00, 0xaf, 0xd1, 0xf7, 0x00, 0xc3, 0xdd, 0xf8, 0x00, 0xd9, 0xec, 0xf7, 0x00, 0xf2, 0xfd, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf6, 0xfe, 0xfd, 0x00, 0xdd, 0xed, 0xfa, 0x00, 0xb4, 0xd5, 0xf8, 0x00, 0x76, 0xb3, 0xf5, 0x00, 0x2a, 0x96, 0xf4, 0xd0, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x30, 0x97, 0xf4, 0xbb, 0x82, 0xb9, 0xf6, 0x00, 0xba, 0xd9, 0xf9, 0x00, 0xdf, 0xf0, 0xfb, 0x00, 0xf9, 0xfe, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf7, 0xff, 0xfd, 0x00, 0xf1, 0xfb, 0xfd, 0x00, 0xb8, 0xd5, 0xf6, 0x00, 0x5c, 0xa7, 0xf4, 0x23, 0x1e, 0x94, 0xf7, 0xfb, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf6, 0xfc, 0x69, 0xac, 0xf3, 0x00, 0xc0, 0xdc, 0xf7, 0x00, 0xf3, 0xfc, 0xfd, 0x00, 0xf9, 0xfe, 0xfd, 0x00, 0xf9, 0xfe, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf3, 0xfd, 0xfe, 0x00, 0xbd, 0xd9, 0xf6, 0x00, 0x52, 0xa2, 0xf4, 0x44, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x5a, 0xa5, 0xf4, 0x2b, 0xc6, 0xe0, 0xf7, 0x00, 0xf6, 0xfe, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xfe, 0xfd, 0x00, 0xd6, 0xe7, 0xf8, 0x00, 0x73, 0xb0, 0xf4, 0x00, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x74, 0xb4, 0xfa, 0xff, 0x7b, 0xb6, 0xf4, 0xff, 0x48, 0xa3, 0xf5, 0xff, 0x22, 0x94, 0xf2, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1a, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x95, 0xf5, 0xfc, 0x76, 0xb3, 0xf5, 0x00, 0xdb, 0xed, 0xf9, 0x00, 0xf9, 0xfe, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf1, 0xfc, 0xfc, 0x00, 0x9d, 0xc8, 0xf4, 0x00, 0x1d, 0x94, 0xf6, 0xfc, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0xd3, 0xe7, 0xf7, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xee, 0xfb, 0xfe, 0xff, 0x8c, 0xc0, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x53, 0xa3, 0xf5, 0xff, 0x6d, 0xb2, 0xf5, 0xff, 0x31, 0x98, 0xf3, 0xff, 0x1f, 0x94, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xfc, 0x24, 0x95, 0xf5, 0xe4, 0xaf, 0xd1, 0xf6, 0x00, 0xf5, 0xfe, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xee, 0xf9, 0xfb, 0x00, 0x7c, 0xb5, 0xf6, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf4, 0xff, 0xe2, 0xf1, 0xfc, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0x80, 0xb7, 0xf3, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xaf, 0xd1, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf6, 0xfe, 0xfd, 0xff, 0xe6, 0xf4, 0xfc, 0xff, 0xb6, 0xd7, 0xf4, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x86, 0xba, 0xf5, 0x00, 0xef, 0xfa, 0xfb, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xdd, 0xee, 0xf8, 0x00, 0x63, 0xa7, 0xf4, 0x0b, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x2a, 0x97, 0xf2, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0x4f, 0xa2, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0xc8, 0xe0, 0xf9, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xc0, 0xdb, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x74, 0xb1, 0xf6, 0x00, 0xe5, 0xf4, 0xfa, 0x00, 0xf8, 0xfe, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xe1, 0xf0, 0xf9, 0x00, 0x47, 0x9d, 0xf3, 0x6c, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x63, 0xad, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf0, 0xfc, 0xfd, 0xff, 0x22, 0x94, 0xf2, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0xdb, 0xeb, 0xf7, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xa9, 0xce, 0xf6, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x5c, 0xa6, 0xf4, 0x23, 0xe7, 0xf5, 0xfb, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xed, 0xf8, 0xfb, 0x00, 0x65, 0xab, 0xf4, 0x03, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x8a, 0xbc, 0xf6, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xe0, 0xed, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x94, 0xf4, 0xff, 0xef, 0xfb, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x87, 0xbb, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x63, 0xab, 0xf2, 0x0b, 0xed, 0xf7, 0xfb, 0x00, 0xfa, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf1, 0xfa, 0xfc, 0x00, 0x70, 0xaf, 0xf3, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0xc9, 0xe5, 0xf6, 0xff, 0xda, 0xea, 0xf8, 0xff, 0xc1, 0xde, 0xf8, 0xff, 0xac, 0xd0, 0xf6, 0xff, 0x88, 0xbc, 0xf6, 0xff, 0x62, 0xac, 0xf7, 0xff, 0x29, 0x96, 0xf1, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0xb0, 0xd1, 0xf7, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xd7, 0xe9, 0xfb, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x4c, 0xa1, 0xf4, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf6, 0xfe, 0xfc, 0xff, 0x62, 0xaa, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0x87, 0xb9, 0xf4, 0x00, 0xf6, 0xfe, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfd, 0x00, 0x98, 0xc6, 0xf5, 0x00, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x94, 0xf6, 0xff, 0xea, 0xf8, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf5, 0xfe, 0xfe, 0xff, 0xe2, 0xf1, 0xfa, 0xff, 0xea, 0xf5, 0xfa, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xd5, 0xe8, 0xfa, 0xff, 0x60, 0xac, 0xf7, 0xff, 0x28, 0x95, 0xf1, 0xff, 0x7c, 0xb6, 0xf6, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf1, 0xfd, 0xfd, 0xff, 0x26, 0x94, 0xf2, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xaf, 0xd2, 0xf6, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xd3, 0xe8, 0xf8, 0x00, 0x1e, 0x94, 0xf6, 0xfb, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x3d, 0x9c, 0xf3, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf1, 0xfe, 0xff, 0xff, 0xea, 0xf8, 0xfc, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xe2, 0xf1, 0xf8, 0xff, 0x20, 0x95, 0xf4, 0xff, 0x1a, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x26, 0x96, 0xf4, 0xdf, 0xd9, 0xec, 0xfa, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xfe, 0xfd, 0x00, 0xf2, 0xfc, 0xfd, 0x00, 0x59, 0xa6, 0xf4, 0x2c, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x78, 0xb5, 0xf5, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0xe3, 0xf3, 0xfb, 0xff, 0xb6, 0xd7, 0xf8, 0xff, 0x63, 0xa8, 0xf4, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x58, 0xa6, 0xf4, 0x30, 0xf7, 0xfe, 0xfd, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xb2, 0xd4, 0xf6, 0x00, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x60, 0xaa, 0xf5, 0xff, 0xb9, 0xd6, 0xf7, 0xff, 0xd1, 0xe8, 0xfa, 0xff, 0xe8, 0xf5, 0xfc, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0xd1, 0xe6, 0xf9, 0xff, 0x73, 0xb0, 0xf4, 0xff, 0x1a, 0x95, 0xf8, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0xc6, 0xe0, 0xf7, 0x00, 0xf8, 0xfe, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xeb, 0xf6, 0xfb, 0x00, 0x42, 0x9e, 0xf5, 0x7c, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1d, 0x95, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x20, 0x95, 0xf5, 0xff, 0x75, 0xb3, 0xf4, 0xff, 0xe9, 0xf5, 0xfa, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xfe, 0xff, 0xc4, 0xde, 0xf7, 0xff, 0x58, 0xa6, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x58, 0xa6, 0xf3, 0x30, 0xf2, 0xfc, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xac, 0xcf, 0xf7, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xb9, 0xd6, 0xf5, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf1, 0xfb, 0xfd, 0xff, 0xc2, 0xdc, 0xf9, 0xff, 0xd3, 0xe9, 0xf7, 0xff, 0xe1, 0xf2, 0xfa, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xec, 0xf8, 0xfc, 0xff, 0x5a, 0xa6, 0xf3, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xc3, 0xdc, 0xf7, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf3, 0xfd, 0xfe, 0x00, 0x48, 0xa0, 0xf4, 0x68, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xb3, 0xd2, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xdb, 0xec, 0xf8, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x3b, 0x9b, 0xf3, 0xff, 0x8d, 0xbd, 0xf4, 0xff, 0xc5, 0xdf, 0xf6, 0xff, 0xf3, 0xfd, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xcc, 0xe6, 0xf9, 0xff, 0x1f, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x66, 0xac, 0xf4, 0x00, 0xf8, 0xfe, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xfe, 0xfd, 0x00, 0xd3, 0xe7, 0xfa, 0x00, 0x1c, 0x95, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xc9, 0xe1, 0xfa, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xc3, 0xde, 0xfa, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x56, 0xa2, 0xf3, 0xff, 0xc8, 0xe0, 0xf7, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x79, 0xb4, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1e, 0x95, 0xf6, 0xfb, 0xd7, 0xec, 0xfa, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfd, 0x00, 0xa0, 0xca, 0xf5, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xd9, 0xe9, 0xf9, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xad, 0xd0, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x21, 0x96, 0xf3, 0xff, 0xd2, 0xe6, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xb5, 0xd5, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0xa1, 0xca, 0xf5, 0x00, 0xfa, 0xfe, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0x5d, 0xa7, 0xf4, 0x1f, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1e, 0x94, 0xf6, 0xff, 0xe0, 0xef, 0xfa, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x8c, 0xbd, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x72, 0xb2, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xcf, 0xe7, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x5b, 0xa8, 0xf5, 0x27, 0xf9, 0xff, 0xfd, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xe2, 0xf3, 0xfa, 0x00, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x25, 0x95, 0xf2, 0xff, 0xf3, 0xfe, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x63, 0xad, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x36, 0x9b, 0xf3, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfb, 0xfe, 0xfe, 0xff, 0xd0, 0xe8, 0xf9, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1e, 0x95, 0xf4, 0xfb, 0xf1, 0xfd, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xc9, 0xe2, 0xfa, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x5c, 0xa9, 0xf5, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf4, 0xff, 0xfe, 0xff, 0x2a, 0x96, 0xf2, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x74, 0xb3, 0xf4, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xff, 0xff, 0xbd, 0xda, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xda, 0xeb, 0xf7, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xae, 0xd0, 0xf6, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x87, 0xba, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xe5, 0xf3, 0xfb, 0xff, 0x1e, 0x95, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x95, 0xf7, 0xff, 0x27, 0x98, 0xf4, 0xff, 0xce, 0xe5, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x8f, 0xc0, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0xc2, 0xdc, 0xf9, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0x91, 0xc0, 0xf6, 0x00, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0xa9, 0xcf, 0xf6, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xdd, 0xee, 0xf8, 0xff, 0x6b, 0xae, 0xf5, 0xff, 0x2c, 0x96, 0xf2, 0xff, 0x1d, 0x94, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x93, 0xf5, 0xff, 0x6c, 0xad, 0xf5, 0xff, 0xd4, 0xe8, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xe0, 0xf1, 0xfa, 0xff, 0x22, 0x95, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0xaf, 0xd1, 0xf7, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0x7d, 0xb6, 0xf3, 0x00, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x95, 0xf7, 0xff, 0xbf, 0xda, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf3, 0xfe, 0xff, 0xff, 0xe4, 0xf4, 0xfc, 0xff, 0xd8, 0xea, 0xf5, 0xff, 0xd7, 0xe8, 0xf5, 0xff, 0xd8, 0xea, 0xf6, 0xff, 0xe9, 0xf8, 0xfd, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0x83, 0xb9, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x97, 0xc5, 0xf8, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0x7a, 0xb5, 0xf9, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0xd7, 0xea, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xea, 0xf8, 0xfb, 0xff, 0x95, 0xbf, 0xf3, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xfc, 0x88, 0xba, 0xf2, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0x75, 0xb5, 0xf8, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x95, 0xf3, 0xff, 0xe9, 0xf7, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0xd5, 0xe8, 0xf6, 0xff, 0x42, 0x9e, 0xf4, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x84, 0xb7, 0xf2, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0x78, 0xb5, 0xf7, 0x00, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x31, 0x9a, 0xf2, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xe4, 0xf4, 0xfa, 0xff, 0xf4, 0xfd, 0xfe, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0xcb, 0xe4, 0xf8, 0xff, 0x57, 0xa4, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x88, 0xb8, 0xf4, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0x7f, 0xb6, 0xf2, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x73, 0xb3, 0xf4, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0x23, 0x96, 0xf4, 0xff, 0x26, 0x94, 0xf2, 0xff, 0x5b, 0xa8, 0xf7, 0xff, 0x80, 0xb6, 0xf7, 0xff, 0x93, 0xc0, 0xf6, 0xff, 0xbd, 0xd8, 0xf7, 0xff, 0xe6, 0xf5, 0xfc, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xef, 0xf9, 0xfa, 0xff, 0x83, 0xb8, 0xf6, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x98, 0xc4, 0xf8, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0x93, 0xc0, 0xf6, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x98, 0xc4, 0xf7, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xeb, 0xfa, 0xfe, 0xff, 0x1e, 0x96, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1f, 0x94, 0xf4, 0xff, 0x7d, 0xb9, 0xf5, 0xff, 0xd5, 0xe9, 0xf9, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xed, 0xf8, 0xfb, 0xff, 0x55, 0xa5, 0xf4, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xad, 0xd0, 0xf5, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xab, 0xd0, 0xf7, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xb2, 0xd3, 0xf6, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xd8, 0xeb, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x23, 0x95, 0xf4, 0xff, 0xad, 0xd2, 0xf6, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xc2, 0xde, 0xf6, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xbd, 0xda, 0xf8, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xca, 0xe2, 0xfa, 0x00, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xcc, 0xe5, 0xf9, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xbf, 0xdc, 0xf8, 0xff, 0x1d, 0x94, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xb7, 0xd7, 0xf7, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf2, 0xfc, 0xfe, 0xff, 0x2b, 0x97, 0xf3, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xd9, 0xeb, 0xf6, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfd, 0x00, 0xe1, 0xf3, 0xfb, 0x00, 0x1d, 0x93, 0xf5, 0xfc, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1e, 0x94, 0xf6, 0xff, 0xdd, 0xee, 0xf9, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xab, 0xcf, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x63, 0xab, 0xf4, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x5d, 0xae, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1e, 0x94, 0xf5, 0xfb, 0xf3, 0xfd, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf5, 0xff, 0xfe, 0x00, 0x56, 0xa3, 0xf2, 0x38, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x25, 0x95, 0xf3, 0xff, 0xf0, 0xfd, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0x88, 0xbc, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x37, 0x9a, 0xf3, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x65, 0xae, 0xf6, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x54, 0xa3, 0xf2, 0x3f, 0xf8, 0xfe, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf8, 0xfe, 0xfe, 0x00, 0xa2, 0xca, 0xf6, 0x00, 0x1c, 0x94, 0xf9, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x19, 0x94, 0xf7, 0xff, 0x78, 0xb4, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0x65, 0xab, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x7e, 0xb7, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0x35, 0x9a, 0xf2, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xa2, 0xc9, 0xf5, 0x00, 0xf9, 0xfe, 0xff, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xd2, 0xe7, 0xf9, 0x00, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf4, 0xff, 0xcc, 0xe6, 0xf8, 0xff, 0xd3, 0xe8, 0xf8, 0xff, 0xba, 0xd7, 0xf7, 0xff, 0xb1, 0xd3, 0xf4, 0xff, 0xe3, 0xf1, 0xfa, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf3, 0xfd, 0xfe, 0xff, 0x29, 0x95, 0xf2, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x94, 0xf4, 0xff, 0xd0, 0xe5, 0xf7, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xe6, 0xf5, 0xfc, 0xff, 0x20, 0x95, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf6, 0xfc, 0xd8, 0xeb, 0xf9, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf1, 0xfb, 0xfd, 0x00, 0x47, 0xa1, 0xf5, 0x6c, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x6d, 0xb0, 0xf4, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xe9, 0xf7, 0xfa, 0xff, 0x63, 0xae, 0xf6, 0xff, 0x26, 0x94, 0xf2, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x1c, 0x93, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1b, 0x93, 0xf7, 0xff, 0x1f, 0x93, 0xf4, 0xff, 0x72, 0xb2, 0xf6, 0xff, 0xcd, 0xe4, 0xf7, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xc1, 0xde, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x64, 0xa9, 0xf3, 0x07, 0xf7, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xa9, 0xcf, 0xf6, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0xbd, 0xda, 0xf7, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xf3, 0xfe, 0xfe, 0xff, 0xe1, 0xf1, 0xfb, 0xff, 0xd3, 0xe9, 0xf8, 0xff, 0xc3, 0xdf, 0xfb, 0xff, 0xbe, 0xd9, 0xf9, 0xff, 0xc1, 0xdc, 0xf9, 0xff, 0xd3, 0xe8, 0xf8, 0xff, 0xe8, 0xf7, 0xfd, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x7b, 0xb7, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0xbe, 0xdb, 0xf7, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xea, 0xf6, 0xfc, 0x00, 0x33, 0x99, 0xf5, 0xb0, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x20, 0x94, 0xf3, 0xff, 0xe5, 0xf5, 0xfb, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xd8, 0xec, 0xfa, 0xff, 0x1e, 0x94, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x4e, 0xa2, 0xf4, 0x53, 0xf3, 0xfc, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xaf, 0xd3, 0xf5, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x55, 0xa8, 0xf5, 0xff, 0xd9, 0xeb, 0xf8, 0xff, 0xeb, 0xf9, 0xfd, 0xff, 0xf7, 0xfe, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0xf3, 0xfc, 0xfd, 0xff, 0x6e, 0xaf, 0xf5, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xc3, 0xde, 0xf8, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf2, 0xfb, 0xfd, 0x00, 0x5c, 0xa6, 0xf3, 0x23, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x20, 0x94, 0xf4, 0xff, 0x3e, 0x9d, 0xf5, 0xff, 0x78, 0xb5, 0xf5, 0xff, 0x98, 0xc5, 0xf8, 0xff, 0xb6, 0xd5, 0xf7, 0xff, 0xce, 0xe6, 0xf9, 0xff, 0xdf, 0xf0, 0xf9, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf0, 0xfa, 0xfb, 0xff, 0x83, 0xba, 0xf6, 0xff, 0x1b, 0x93, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x5e, 0xa7, 0xf3, 0x1c, 0xf7, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0xcc, 0xe4, 0xfa, 0x00, 0x1e, 0x95, 0xf6, 0xfb, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x4e, 0xa4, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xe3, 0xf2, 0xfb, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xd0, 0xe6, 0xf9, 0xff, 0x5e, 0xa8, 0xf3, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xfc, 0x1e, 0x94, 0xf5, 0xfb, 0xd0, 0xe8, 0xf8, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xfe, 0xfd, 0x00, 0x98, 0xc5, 0xf5, 0x00, 0x1d, 0x95, 0xf6, 0xfc, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x83, 0xb8, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xe0, 0xf1, 0xf9, 0xff, 0x1d, 0x94, 0xf8, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x36, 0x98, 0xf0, 0xff, 0xec, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xda, 0xeb, 0xfa, 0xff, 0xd1, 0xe8, 0xfa, 0xff, 0xd3, 0xe8, 0xf8, 0xff, 0xd4, 0xe8, 0xf7, 0xff, 0xd5, 0xe9, 0xf7, 0xff, 0xcc, 0xe3, 0xfa, 0xff, 0xb5, 0xd4, 0xf5, 0xff, 0x8e, 0xbf, 0xf7, 0xff, 0x42, 0x9d, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0xaf, 0xd2, 0xf6, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf0, 0xfa, 0xfd, 0x00, 0x6e, 0xaf, 0xf5, 0x00, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0xa3, 0xcc, 0xf7, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xcf, 0xe6, 0xf9, 0xff, 0x1b, 0x95, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x35, 0x9a, 0xf2, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0x70, 0xb2, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x83, 0xb9, 0xf4, 0x00, 0xf5, 0xfe, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfd, 0x00, 0xe5, 0xf3, 0xfb, 0x00, 0x5c, 0xa7, 0xf6, 0x23, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0xbb, 0xd8, 0xf7, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xb7, 0xd5, 0xf6, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x72, 0xb1, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0x36, 0x99, 0xf3, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x5b, 0xa5, 0xf4, 0x27, 0xe9, 0xf7, 0xfc, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xdf, 0xef, 0xf9, 0x00, 0x48, 0x9e, 0xf4, 0x68, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0xd4, 0xe8, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0x9a, 0xc7, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x94, 0xc3, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xe6, 0xf6, 0xfc, 0xff, 0x1d, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x5b, 0xa7, 0xf5, 0x27, 0xe7, 0xf5, 0xfb, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xdf, 0xef, 0xf9, 0x00, 0x51, 0xa1, 0xf3, 0x48, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x95, 0xf5, 0xff, 0xe5, 0xf5, 0xfc, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x7a, 0xb5, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xb2, 0xd3, 0xf6, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xd5, 0xe9, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1d, 0x95, 0xf6, 0xfc, 0x67, 0xac, 0xf4, 0x00, 0xe7, 0xf6, 0xfa, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xe8, 0xf5, 0xfc, 0x00, 0x79, 0xb2, 0xf4, 0x00, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf6, 0xfc, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x23, 0x95, 0xf3, 0xff, 0xd5, 0xea, 0xf7, 0xff, 0xed, 0xfa, 0xfd, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0xf9, 0xfe, 0xfc, 0xff, 0x4a, 0x9f, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0xca, 0xe3, 0xfa, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xbb, 0xd9, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x82, 0xb8, 0xf4, 0x00, 0xed, 0xf8, 0xfc, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0xf3, 0xfb, 0xfd, 0x00, 0x9f, 0xc9, 0xf4, 0x00, 0x1e, 0x94, 0xf5, 0xfb, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1e, 0x94, 0xf4, 0xff, 0x44, 0x9f, 0xf3, 0xff, 0x77, 0xb4, 0xf3, 0xff, 0x1f, 0x94, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xc6, 0xe2, 0xf4, 0xff, 0xf3, 0xfe, 0xfe, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xa3, 0xcc, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x24, 0x95, 0xf4, 0xe4, 0xb1, 0xd2, 0xf5, 0x00, 0xf6, 0xfd, 0xfd, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xfe, 0xfd, 0x00, 0xd0, 0xe7, 0xf8, 0x00, 0x59, 0xa5, 0xf5, 0x2c, 0x1c, 0x95, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x28, 0x96, 0xf1, 0xff, 0x5f, 0xab, 0xf5, 0xff, 0x87, 0xbb, 0xf5, 0xff, 0x56, 0xa6, 0xf5, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x5a, 0xa6, 0xf5, 0x2b, 0xd6, 0xeb, 0xf9, 0x00, 0xfa, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xef, 0xf9, 0xfc, 0x00, 0xbb, 0xd9, 0xf8, 0x00, 0x51, 0xa2, 0xf2, 0x48, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x5c, 0xa6, 0xf4, 0x23, 0xc5, 0xde, 0xf8, 0x00, 0xf3, 0xfb, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf1, 0xfc, 0xfc, 0x00, 0xb8, 0xd6, 0xf7, 0x00, 0x5d, 0xa8, 0xf3, 0x1f, 0x1b, 0x95, 0xf6, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1d, 0x94, 0xf7, 0xfc, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xfc, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x68, 0xad, 0xf4, 0x00, 0xc0, 0xdc, 0xf7, 0x00, 0xf2, 0xfc, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf6, 0xfe, 0xfe, 0x00, 0xd6, 0xea, 0xf9, 0x00, 0x9d, 0xc8, 0xf6, 0x00, 0x55, 0xa4, 0xf4, 0x3b, 0x1e, 0x94, 0xf5, 0xfb, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1e, 0x95, 0xf4, 0xfb, 0x5d, 0xa8, 0xf2, 0x1f, 0xa2, 0xca, 0xf5, 0x00, 0xda, 0xed, 0xfa, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xf1, 0xfc, 0xfd, 0x00, 0xd7, 0xea, 0xf8, 0x00, 0xbf, 0xdb, 0xf7, 0x00, 0xae, 0xd1, 0xf7, 0x00, 0x97, 0xc3, 0xf8, 0x00, 0x8d, 0xba, 0xf5, 0x00, 0x89, 0xb8, 0xf3, 0x00, 0x8c, 0xba, 0xf5, 0x00, 0x98, 0xc5, 0xf8, 0x00, 0xae, 0xd1, 0xf8, 0x00, 0xc2, 0xdd, 0xf8, 0x00, 0xd9, 0xec, 0xf9, 0x00, 0xf1, 0xfc, 0xfd, 0x00, 0xf8, 0xfe, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xfe, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfd, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
-  0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xfe, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2a, 0x96, 0xf4, 0xd0, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 
+  0x82, 0x1b, 0x94, 0xf7, 0xff, 0x06, 0x1b, 0x95, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x30, 0x97, 
+  0xf4, 0xbb, 0xae, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0xa7, 0xf4, 0x23, 0x1e, 0x94, 0xf7, 0xfb, 0x90, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1d, 0x94, 0xf6, 0xfc, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x52, 0xa2, 0xf4, 0x44, 0x1b, 0x94, 0xf7, 0xff, 0x94, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x94, 0xf7, 0xff, 0x5a, 0xa5, 0xf4, 0x2b, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x95, 0xf6, 0xff, 
+  0x87, 0x1c, 0x94, 0xf7, 0xff, 0x0a, 0x1a, 0x94, 0xf7, 0xff, 0x74, 0xb4, 0xfa, 0xff, 0x7b, 0xb6, 0xf4, 0xff, 0x48, 0xa3, 0xf5, 0xff, 0x22, 0x94, 0xf2, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x1c, 0x94, 
+  0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1a, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1d, 0x95, 0xf5, 0xfc, 0xa2, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x1d, 0x94, 0xf6, 0xfc, 0x1b, 0x94, 0xf8, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x0c, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0xd3, 0xe7, 0xf7, 0xff, 0xf9, 0xff, 0xfe, 0xff, 
+  0xf8, 0xff, 0xfe, 0xff, 0xee, 0xfb, 0xfe, 0xff, 0x8c, 0xc0, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x53, 0xa3, 0xf5, 0xff, 0x6d, 0xb2, 0xf5, 0xff, 0x31, 0x98, 0xf3, 0xff, 
+  0x1f, 0x94, 0xf5, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1b, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xfc, 0x24, 0x95, 0xf5, 0xe4, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x1c, 0x94, 0xf7, 0xff, 
+  0x05, 0x1c, 0x95, 0xf4, 0xff, 0xe2, 0xf1, 0xfc, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0x80, 0xb7, 0xf3, 0xff, 0x81, 0x1c, 0x94, 0xf7, 0xff, 0x05, 0xaf, 
+  0xd1, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf6, 0xfe, 0xfd, 0xff, 0xe6, 0xf4, 0xfc, 0xff, 0xb6, 0xd7, 0xf4, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x9c, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x63, 0xa7, 0xf4, 0x0b, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x8a, 0x1c, 0x94, 0xf7, 0xff, 0x08, 0x2a, 0x97, 0xf2, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 
+  0xf9, 0xff, 0xfd, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0x4f, 0xa2, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0xc8, 0xe0, 0xf9, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf8, 0xfe, 
+  0xfd, 0xff, 0xc0, 0xdb, 0xf8, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1a, 0x94, 0xf7, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x9d, 0xf3, 0x6c, 0x8d, 0x1c, 0x94, 0xf7, 0xff, 0x00, 
+  0x63, 0xad, 0xf5, 0xff, 0x82, 0xf9, 0xff, 0xfe, 0xff, 0x09, 0xf0, 0xfc, 0xfd, 0xff, 0x22, 0x94, 0xf2, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0xdb, 0xeb, 0xf7, 0xff, 0xf8, 0xff, 
+  0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xa9, 0xce, 0xf6, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x5c, 0xa6, 0xf4, 0x23, 0x97, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x65, 0xab, 0xf4, 0x03, 0x1b, 0x94, 0xf7, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x0f, 0x1d, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 
+  0x1b, 0x95, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x8a, 0xbc, 0xf6, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xe0, 0xed, 0xf7, 0xff, 
+  0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x94, 0xf4, 0xff, 0xef, 0xfb, 0xfe, 0xff, 0x82, 0xf9, 0xff, 0xfe, 0xff, 0x00, 0x87, 0xbb, 0xf5, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x81, 
+  0x1b, 0x94, 0xf7, 0xff, 0x00, 0x63, 0xab, 0xf2, 0x0b, 0x96, 0x00, 0x00, 0x00, 0x00, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x0a, 0x1d, 0x94, 0xf7, 0xff, 0xc9, 0xe5, 0xf6, 0xff, 0xda, 0xea, 0xf8, 0xff, 
+  0xc1, 0xde, 0xf8, 0xff, 0xac, 0xd0, 0xf6, 0xff, 0x88, 0xbc, 0xf6, 0xff, 0x62, 0xac, 0xf7, 0xff, 0x29, 0x96, 0xf1, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0xb0, 0xd1, 0xf7, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 
+  0x81, 0xf9, 0xff, 0xfe, 0xff, 0x09, 0xd7, 0xe9, 0xfb, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x4c, 0xa1, 0xf4, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 
+  0xfe, 0xff, 0xf6, 0xfe, 0xfc, 0xff, 0x62, 0xaa, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x89, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x94, 0xf6, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x94, 
+  0xf8, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x09, 0x1f, 0x94, 0xf6, 0xff, 0xea, 0xf8, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 
+  0xf9, 0xfe, 0xfd, 0xff, 0xf5, 0xfe, 0xfe, 0xff, 0xe2, 0xf1, 0xfa, 0xff, 0xea, 0xf5, 0xfa, 0xff, 0x82, 0xf9, 0xff, 0xfe, 0xff, 0x04, 0xd5, 0xe8, 0xfa, 0xff, 0x60, 0xac, 0xf7, 0xff, 0x28, 0x95, 
+  0xf1, 0xff, 0x7c, 0xb6, 0xf6, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf1, 0xfd, 0xfd, 0xff, 0x26, 0x94, 0xf2, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x8a, 0x1c, 0x94, 0xf7, 
+  0xff, 0x00, 0x1b, 0x94, 0xf7, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x94, 0xf6, 0xfb, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1b, 0x95, 0xf6, 0xff, 0x3d, 0x9c, 0xf3, 0xff, 0xf5, 0xff, 
+  0xfe, 0xff, 0x8a, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf9, 0xff, 0xfd, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf1, 0xfe, 0xff, 0xff, 0xea, 0xf8, 0xfc, 0xff, 0x82, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xe2, 0xf1, 
+  0xf8, 0xff, 0x20, 0x95, 0xf4, 0xff, 0x1a, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x8a, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x26, 0x96, 0xf4, 0xdf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0xa6, 
+  0xf4, 0x2c, 0x1b, 0x94, 0xf7, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1c, 0x95, 0xf6, 0xff, 0x78, 0xb5, 0xf5, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0x89, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf8, 0xff, 
+  0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x0a, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 
+  0xe3, 0xf3, 0xfb, 0xff, 0xb6, 0xd7, 0xf8, 0xff, 0x63, 0xa8, 0xf4, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x86, 0x1c, 0x94, 0xf7, 
+  0xff, 0x01, 0x1b, 0x94, 0xf7, 0xff, 0x58, 0xa6, 0xf4, 0x30, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x94, 0xf7, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x04, 0x60, 0xaa, 0xf5, 0xff, 0xb9, 0xd6, 
+  0xf7, 0xff, 0xd1, 0xe8, 0xfa, 0xff, 0xe8, 0xf5, 0xfc, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0x91, 0xf9, 0xff, 0xfe, 0xff, 0x04, 0xf7, 0xfe, 0xfd, 0xff, 0xd1, 0xe6, 0xf9, 0xff, 0x73, 0xb0, 0xf4, 0xff, 
+  0x1a, 0x95, 0xf8, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1c, 0x94, 0xf6, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x9e, 0xf5, 0x7c, 0x1c, 0x94, 0xf7, 0xff, 
+  0x1b, 0x94, 0xf6, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x05, 0x1b, 0x94, 0xf7, 0xff, 0x1d, 0x95, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x20, 0x95, 0xf5, 0xff, 0x75, 0xb3, 0xf4, 0xff, 0xe9, 0xf5, 
+  0xfa, 0xff, 0x86, 0xf9, 0xff, 0xfe, 0xff, 0x04, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x83, 0xf9, 0xff, 0xfe, 
+  0xff, 0x82, 0xf8, 0xff, 0xfe, 0xff, 0x04, 0xf7, 0xfe, 0xfe, 0xff, 0xc4, 0xde, 0xf7, 0xff, 0x58, 0xa6, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 
+  0x00, 0x58, 0xa6, 0xf3, 0x30, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0xb9, 0xd6, 0xf5, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x06, 0xf1, 0xfb, 
+  0xfd, 0xff, 0xc2, 0xdc, 0xf9, 0xff, 0xd3, 0xe9, 0xf7, 0xff, 0xe1, 0xf2, 0xfa, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0x86, 0xf9, 0xff, 0xfe, 0xff, 0x03, 
+  0xf9, 0xff, 0xfd, 0xff, 0xec, 0xf8, 0xfc, 0xff, 0x5a, 0xa6, 0xf3, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x94, 0xf7, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x48, 0xa0, 0xf4, 0x68, 0x1c, 0x95, 0xf7, 0xff, 0x8e, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0xb3, 0xd2, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x09, 0xdb, 0xec, 0xf8, 0xff, 
+  0x1d, 0x95, 0xf6, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x3b, 0x9b, 0xf3, 0xff, 0x8d, 0xbd, 0xf4, 0xff, 0xc5, 0xdf, 0xf6, 0xff, 0xf3, 0xfd, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 
+  0xf9, 0xff, 0xfd, 0xff, 0x83, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf9, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xcc, 0xe6, 0xf9, 0xff, 0x1f, 0x94, 0xf7, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x00, 
+  0x1c, 0x95, 0xf6, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x95, 0xf8, 0xff, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0xc9, 0xe1, 0xfa, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0x84, 0xf9, 0xff, 0xfe, 
+  0xff, 0x01, 0xc3, 0xde, 0xfa, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x81, 0x1c, 0x94, 0xf7, 0xff, 0x05, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x56, 0xa2, 0xf3, 0xff, 
+  0xc8, 0xe0, 0xf7, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf8, 0xff, 0xfe, 0xff, 0x79, 0xb4, 0xf5, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x94, 0xf7, 0xff, 
+  0x1e, 0x95, 0xf6, 0xfb, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x90, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0xd9, 0xe9, 0xf9, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0x83, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf8, 0xff, 0xff, 
+  0xff, 0xad, 0xd0, 0xf7, 0xff, 0x83, 0x1c, 0x94, 0xf7, 0xff, 0x04, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x21, 0x96, 0xf3, 0xff, 0xd2, 0xe6, 0xf8, 0xff, 0x85, 
+  0xf9, 0xff, 0xfe, 0xff, 0x01, 0xfa, 0xfe, 0xfe, 0xff, 0xb5, 0xd5, 0xf7, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x95, 0xf6, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xa7, 0xf4, 
+  0x1f, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1e, 0x94, 0xf6, 0xff, 0xe0, 0xef, 0xfa, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x00, 0x8c, 0xbd, 0xf5, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1b, 
+  0x95, 0xf7, 0xff, 0x72, 0xb2, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x00, 0xcf, 0xe7, 0xf8, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x5b, 0xa8, 0xf5, 0x27, 0x8a, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x95, 0xf6, 0xff, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x25, 0x95, 0xf2, 0xff, 0xf3, 0xfe, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x83, 0xf9, 0xff, 0xfe, 0xff, 
+  0x01, 0xf9, 0xff, 0xfd, 0xff, 0x63, 0xad, 0xf6, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1a, 0x94, 0xf7, 0xff, 0x36, 0x9b, 0xf3, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xfb, 0xfe, 0xfe, 
+  0xff, 0xd0, 0xe8, 0xf9, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1e, 0x95, 0xf4, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x90, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x5c, 0xa9, 0xf5, 0xff, 0xfa, 0xff, 
+  0xfd, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x83, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf4, 0xff, 0xfe, 0xff, 0x2a, 0x96, 0xf2, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1b, 0x94, 0xf7, 0xff, 0x74, 0xb3, 
+  0xf4, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xfa, 0xfe, 0xff, 0xff, 0xbd, 0xda, 0xf8, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x94, 0xf7, 0xff, 0x8a, 0x00, 
+  0x00, 0x00, 0x00, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x94, 0xf7, 0xff, 0x87, 0xba, 0xf5, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xfe, 0xff, 0xe5, 0xf3, 0xfb, 0xff, 0x1e, 
+  0x95, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x83, 0x1c, 0x94, 0xf7, 0xff, 0x03, 0x1b, 0x94, 0xf7, 0xff, 0x1a, 0x95, 0xf7, 0xff, 0x27, 0x98, 0xf4, 0xff, 0xce, 0xe5, 0xf8, 0xff, 0x85, 0xf9, 0xff, 
+  0xfe, 0xff, 0x01, 0xf9, 0xff, 0xfd, 0xff, 0x8f, 0xc0, 0xf7, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x94, 0xf6, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x94, 0xf8, 0xff, 0x8e, 
+  0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x95, 0xf7, 0xff, 0xa9, 0xcf, 0xf6, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x04, 0xfa, 0xff, 0xfe, 0xff, 0xdd, 0xee, 0xf8, 0xff, 0x6b, 0xae, 0xf5, 0xff, 0x2c, 
+  0x96, 0xf2, 0xff, 0x1d, 0x94, 0xf5, 0xff, 0x82, 0x1c, 0x94, 0xf7, 0xff, 0x04, 0x1f, 0x93, 0xf5, 0xff, 0x6c, 0xad, 0xf5, 0xff, 0xd4, 0xe8, 0xf8, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 
+  0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xe0, 0xf1, 0xfa, 0xff, 0x22, 0x95, 0xf4, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1c, 0x95, 0xf7, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 
+  0x94, 0xf7, 0xff, 0x8e, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1a, 0x95, 0xf7, 0xff, 0xbf, 0xda, 0xf8, 0xff, 0x86, 0xf9, 0xff, 0xfe, 0xff, 0x07, 0xf8, 0xff, 0xfe, 0xff, 0xf3, 0xfe, 0xff, 0xff, 0xe4, 
+  0xf4, 0xfc, 0xff, 0xd8, 0xea, 0xf5, 0xff, 0xd7, 0xe8, 0xf5, 0xff, 0xd8, 0xea, 0xf6, 0xff, 0xe9, 0xf8, 0xfd, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf8, 0xff, 0xfd, 
+  0xff, 0xf6, 0xfe, 0xfe, 0xff, 0x83, 0xb9, 0xf4, 0xff, 0x89, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x95, 0xf6, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x95, 
+  0xf6, 0xff, 0xd7, 0xea, 0xf8, 0xff, 0x87, 0xf9, 0xff, 0xfe, 0xff, 0x82, 0xf8, 0xff, 0xfe, 0xff, 0x01, 0xf7, 0xfe, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 0xff, 0x87, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xea, 
+  0xf8, 0xfb, 0xff, 0x95, 0xbf, 0xf3, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1d, 0x94, 0xf7, 0xfc, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1c, 
+  0x94, 0xf7, 0xff, 0x01, 0x1f, 0x95, 0xf3, 0xff, 0xe9, 0xf7, 0xfd, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xfa, 0xfe, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x8a, 0xf9, 0xff, 0xfe, 0xff, 0x03, 
+  0xf9, 0xfe, 0xfd, 0xff, 0xd5, 0xe8, 0xf6, 0xff, 0x42, 0x9e, 0xf4, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x8a, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x95, 0xf7, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x1b, 0x94, 0xf7, 0xff, 0x8e, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x31, 0x9a, 0xf2, 0xff, 0xf7, 0xfe, 0xfd, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf7, 0xff, 0xfe, 0xff, 0xe4, 0xf4, 0xfa, 0xff, 
+  0xf4, 0xfd, 0xfe, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0x8a, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf7, 0xfe, 0xfd, 0xff, 0xcb, 0xe4, 0xf8, 0xff, 0x57, 0xa4, 0xf5, 0xff, 0x8a, 0x1c, 0x94, 0xf7, 0xff, 0x00, 
+  0x1b, 0x95, 0xf7, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x73, 0xb3, 0xf4, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x0a, 0xf6, 0xfe, 0xfe, 0xff, 0x23, 0x96, 0xf4, 
+  0xff, 0x26, 0x94, 0xf2, 0xff, 0x5b, 0xa8, 0xf7, 0xff, 0x80, 0xb6, 0xf7, 0xff, 0x93, 0xc0, 0xf6, 0xff, 0xbd, 0xd8, 0xf7, 0xff, 0xe6, 0xf5, 0xfc, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf8, 0xfe, 0xfd, 
+  0xff, 0xf8, 0xff, 0xfe, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf9, 0xfe, 0xfe, 0xff, 0xef, 0xf9, 0xfa, 0xff, 0x83, 0xb8, 0xf6, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 
+  0x00, 0x1b, 0x94, 0xf7, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x98, 0xc4, 0xf7, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x0a, 0xeb, 0xfa, 
+  0xfe, 0xff, 0x1e, 0x96, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1f, 0x94, 0xf4, 0xff, 0x7d, 0xb9, 
+  0xf5, 0xff, 0xd5, 0xe9, 0xf9, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x04, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xed, 0xf8, 0xfb, 0xff, 0x55, 0xa5, 0xf4, 0xff, 
+  0x1c, 0x94, 0xf6, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0xb2, 0xd3, 0xf6, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf8, 0xff, 
+  0xfe, 0xff, 0xd8, 0xeb, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x03, 0x23, 0x95, 0xf4, 0xff, 0xad, 0xd2, 0xf6, 0xff, 0xf9, 0xff, 0xfe, 0xff, 
+  0xf8, 0xff, 0xfe, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xfe, 0xff, 0xc2, 0xde, 0xf6, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x00, 
+  0x1b, 0x94, 0xf7, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x95, 0xf7, 0xff, 0x8e, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0xcc, 0xe5, 0xf9, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0x83, 0xf9, 0xff, 0xfe, 
+  0xff, 0x03, 0xf9, 0xff, 0xfd, 0xff, 0xbf, 0xdc, 0xf8, 0xff, 0x1d, 0x94, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x03, 0x1a, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 
+  0xb7, 0xd7, 0xf7, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xfa, 0xff, 0xfe, 0xff, 0xf2, 0xfc, 0xfe, 0xff, 0x2b, 0x97, 0xf3, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x8a, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x93, 0xf5, 0xfc, 0x8d, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1e, 0x94, 0xf6, 0xff, 0xdd, 0xee, 0xf9, 0xff, 0xf9, 0xfe, 0xfe, 0xff, 0x83, 0xf9, 0xff, 0xfe, 0xff, 
+  0x01, 0xf8, 0xfe, 0xfd, 0xff, 0xab, 0xcf, 0xf6, 0xff, 0x89, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x63, 0xab, 0xf4, 0xff, 0x86, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf9, 0xff, 0xfd, 0xff, 0x5d, 0xae, 0xf6, 
+  0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1e, 0x94, 0xf5, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xa3, 0xf2, 0x38, 0x89, 0x1c, 0x94, 0xf7, 0xff, 0x05, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 
+  0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x25, 0x95, 0xf3, 0xff, 0xf0, 0xfd, 0xfe, 0xff, 0x83, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xfe, 0xfd, 
+  0xff, 0x88, 0xbc, 0xf5, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1b, 0x95, 0xf6, 0xff, 0x37, 0x9a, 0xf3, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf9, 0xff, 0xfd, 
+  0xff, 0x65, 0xae, 0xf6, 0xff, 0x1b, 0x95, 0xf6, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x54, 0xa3, 0xf2, 0x3f, 0x8b, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1c, 0x94, 0xf9, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x05, 0x1c, 0x95, 0xf6, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x19, 0x94, 0xf7, 0xff, 0x78, 
+  0xb4, 0xf6, 0xff, 0x81, 0xf8, 0xff, 0xfe, 0xff, 0x83, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf6, 0xff, 0xfd, 0xff, 0x65, 0xab, 0xf5, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1d, 0x94, 0xf7, 0xff, 
+  0x7e, 0xb7, 0xf5, 0xff, 0x86, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf6, 0xfe, 0xfe, 0xff, 0x35, 0x9a, 0xf2, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1c, 0x95, 0xf6, 0xff, 
+  0x1c, 0x94, 0xf7, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x95, 0xf7, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x05, 0x1d, 0x94, 0xf4, 0xff, 0xcc, 0xe6, 0xf8, 0xff, 0xd3, 0xe8, 0xf8, 0xff, 
+  0xba, 0xd7, 0xf7, 0xff, 0xb1, 0xd3, 0xf4, 0xff, 0xe3, 0xf1, 0xfa, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xfa, 0xff, 0xfd, 0xff, 0xf3, 0xfd, 0xfe, 0xff, 0x29, 0x95, 0xf2, 0xff, 0x1b, 0x94, 
+  0xf7, 0xff, 0x82, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1c, 0x94, 0xf6, 0xff, 0x81, 0x1c, 0x94, 0xf7, 0xff, 0x03, 0x1d, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1f, 0x94, 0xf4, 0xff, 0xd0, 0xe5, 
+  0xf7, 0xff, 0x86, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xe6, 0xf5, 0xfc, 0xff, 0x20, 0x95, 0xf4, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1a, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf6, 0xfc, 0x8c, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x47, 0xa1, 0xf5, 0x6c, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x6d, 0xb0, 0xf4, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x88, 0xf9, 0xff, 0xfe, 0xff, 0x0d, 
+  0xe9, 0xf7, 0xfa, 0xff, 0x63, 0xae, 0xf6, 0xff, 0x26, 0x94, 0xf2, 0xff, 0x1e, 0x95, 0xf7, 0xff, 0x1d, 0x95, 0xf7, 0xff, 0x1c, 0x93, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 
+  0x1b, 0x93, 0xf7, 0xff, 0x1f, 0x93, 0xf4, 0xff, 0x72, 0xb2, 0xf6, 0xff, 0xcd, 0xe4, 0xf7, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x84, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf9, 0xff, 
+  0xfd, 0xff, 0xc1, 0xde, 0xf7, 0xff, 0x1c, 0x94, 0xf8, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x94, 0xf7, 0xff, 0x64, 0xa9, 0xf3, 0x07, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x86, 0x1c, 0x94, 
+  0xf7, 0xff, 0x03, 0x1c, 0x95, 0xf7, 0xff, 0xbd, 0xda, 0xf7, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0x87, 0xf9, 0xff, 0xfe, 0xff, 0x0d, 0xfa, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfd, 
+  0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xf3, 0xfe, 0xfe, 0xff, 0xe1, 0xf1, 0xfb, 0xff, 0xd3, 0xe9, 0xf8, 0xff, 0xc3, 0xdf, 0xfb, 0xff, 0xbe, 0xd9, 0xf9, 0xff, 0xc1, 0xdc, 0xf9, 0xff, 0xd3, 0xe8, 0xf8, 
+  0xff, 0xe8, 0xf7, 0xfd, 0xff, 0xf8, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x85, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf9, 0xff, 0xfd, 0xff, 0x7b, 0xb7, 0xf5, 0xff, 0x86, 
+  0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x94, 0xf6, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x99, 0xf5, 0xb0, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x20, 0x94, 0xf3, 0xff, 0xe5, 0xf5, 0xfb, 
+  0xff, 0xf8, 0xff, 0xfd, 0xff, 0x9c, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xd8, 0xec, 0xfa, 0xff, 0x1e, 0x94, 0xf5, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x4e, 0xa2, 0xf4, 0x53, 0x8f, 0x00, 0x00, 
+  0x00, 0x00, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x0b, 0x1d, 0x95, 0xf6, 0xff, 0x55, 0xa8, 0xf5, 0xff, 0xd9, 0xeb, 0xf8, 0xff, 0xeb, 0xf9, 0xfd, 0xff, 0xf7, 0xfe, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 
+  0xfa, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x92, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf9, 0xfe, 
+  0xfe, 0xff, 0xf3, 0xfc, 0xfd, 0xff, 0x6e, 0xaf, 0xf5, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x81, 0x1b, 0x94, 0xf7, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0xa6, 
+  0xf3, 0x23, 0x1b, 0x94, 0xf8, 0xff, 0x83, 0x1c, 0x94, 0xf7, 0xff, 0x08, 0x1c, 0x94, 0xf6, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x20, 0x94, 0xf4, 0xff, 0x3e, 0x9d, 0xf5, 0xff, 0x78, 0xb5, 0xf5, 0xff, 
+  0x98, 0xc5, 0xf8, 0xff, 0xb6, 0xd5, 0xf7, 0xff, 0xce, 0xe6, 0xf9, 0xff, 0xdf, 0xf0, 0xf9, 0xff, 0x94, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xf0, 0xfa, 0xfb, 0xff, 0x83, 0xba, 0xf6, 0xff, 0x1b, 0x93, 
+  0xf6, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x94, 0xf8, 0xff, 0x5e, 0xa7, 0xf3, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x95, 0xf6, 0xfb, 0x1b, 0x94, 0xf7, 0xff, 0x83, 0x1c, 
+  0x94, 0xf7, 0xff, 0x00, 0x1c, 0x94, 0xf8, 0xff, 0x81, 0x1c, 0x94, 0xf7, 0xff, 0x04, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x95, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x4e, 0xa4, 
+  0xf5, 0xff, 0x82, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf8, 0xfe, 0xfe, 0xff, 0xe3, 0xf2, 0xfb, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x00, 0xfa, 0xff, 
+  0xfe, 0xff, 0x81, 0xf8, 0xff, 0xfd, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x81, 0xf9, 0xff, 0xfd, 0xff, 0x00, 0xf8, 0xff, 0xfe, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x03, 0xf8, 0xfe, 0xfe, 0xff, 
+  0xd0, 0xe6, 0xf9, 0xff, 0x5e, 0xa8, 0xf3, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1d, 0x94, 0xf7, 0xfc, 0x1e, 0x94, 0xf5, 0xfb, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x1d, 0x95, 0xf6, 0xfc, 0x1b, 0x94, 0xf7, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x95, 0xf6, 0xff, 0x83, 0xb8, 0xf5, 0xff, 0x82, 0xf9, 0xff, 0xfe, 0xff, 0x10, 0xe0, 0xf1, 0xf9, 0xff, 
+  0x1d, 0x94, 0xf8, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x36, 0x98, 0xf0, 0xff, 0xec, 0xf9, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfe, 0xff, 0xda, 0xeb, 0xfa, 0xff, 
+  0xd1, 0xe8, 0xfa, 0xff, 0xd3, 0xe8, 0xf8, 0xff, 0xd4, 0xe8, 0xf7, 0xff, 0xd5, 0xe9, 0xf7, 0xff, 0xcc, 0xe3, 0xfa, 0xff, 0xb5, 0xd4, 0xf5, 0xff, 0x8e, 0xbf, 0xf7, 0xff, 0x42, 0x9d, 0xf5, 0xff, 
+  0x81, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1d, 0x94, 0xf6, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1d, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x95, 
+  0xf6, 0xff, 0x88, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x95, 0xf7, 0xff, 0xa3, 0xcc, 0xf7, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x05, 0xfb, 0xff, 0xfd, 0xff, 0xcf, 0xe6, 0xf9, 0xff, 0x1b, 0x95, 
+  0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x35, 0x9a, 0xf2, 0xff, 0xf6, 0xfe, 0xfe, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xf8, 0xfe, 0xfd, 0xff, 0x70, 0xb2, 0xf6, 0xff, 0x82, 0x1c, 0x94, 0xf7, 
+  0xff, 0x05, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1a, 0x94, 0xf7, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x02, 
+  0x1c, 0x94, 0xf6, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0xa7, 0xf6, 0x23, 0x1c, 0x94, 0xf8, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x01, 
+  0x1b, 0x95, 0xf7, 0xff, 0xbb, 0xd8, 0xf7, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x09, 0xfa, 0xfe, 0xfd, 0xff, 0xb7, 0xd5, 0xf6, 0xff, 0x1b, 0x95, 0xf7, 0xff, 0x1d, 0x94, 0xf7, 0xff, 0x72, 0xb1, 
+  0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xf4, 0xfe, 0xfe, 0xff, 0x36, 0x99, 0xf3, 0xff, 0x8d, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1b, 0x94, 0xf7, 0xff, 
+  0x1c, 0x95, 0xf7, 0xff, 0x5b, 0xa5, 0xf4, 0x27, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x9e, 0xf4, 0x68, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x95, 0xf6, 0xff, 0x85, 0x1c, 0x94, 0xf7, 0xff, 0x09, 
+  0x1b, 0x95, 0xf7, 0xff, 0xd4, 0xe8, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfa, 0xfe, 0xfd, 0xff, 0x9a, 0xc7, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 
+  0x94, 0xc3, 0xf6, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xe6, 0xf6, 0xfc, 0xff, 0x1d, 0x94, 0xf6, 0xff, 0x8c, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1c, 0x94, 0xf8, 0xff, 
+  0x1b, 0x95, 0xf7, 0xff, 0x5b, 0xa7, 0xf5, 0x27, 0x99, 0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0xa1, 0xf3, 0x48, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x01, 
+  0x1f, 0x95, 0xf5, 0xff, 0xe5, 0xf5, 0xfc, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x04, 0xf9, 0xff, 0xfd, 0xff, 0x7a, 0xb5, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xb2, 0xd3, 
+  0xf6, 0xff, 0x82, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0xd5, 0xe9, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x8b, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1b, 0x94, 0xf8, 0xff, 0x1d, 0x95, 0xf6, 0xfc, 0x9d, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x1c, 0x94, 0xf7, 0xff, 0x1d, 0x94, 0xf6, 0xfc, 0x83, 0x1c, 0x94, 0xf7, 0xff, 0x08, 0x23, 0x95, 0xf3, 0xff, 0xd5, 0xea, 0xf7, 0xff, 0xed, 0xfa, 0xfd, 0xff, 0xf6, 0xfe, 
+  0xfe, 0xff, 0xf9, 0xfe, 0xfc, 0xff, 0x4a, 0x9f, 0xf4, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf6, 0xff, 0xca, 0xe3, 0xfa, 0xff, 0x81, 0xf9, 0xff, 0xfe, 0xff, 0x02, 0xfa, 0xff, 0xfd, 0xff, 
+  0xbb, 0xd9, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x8c, 0x1c, 0x94, 0xf7, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x94, 0xf5, 0xfb, 0x83, 0x1c, 0x94, 0xf7, 0xff, 0x0d, 0x1c, 0x94, 0xf8, 
+  0xff, 0x1b, 0x95, 0xf6, 0xff, 0x1e, 0x94, 0xf4, 0xff, 0x44, 0x9f, 0xf3, 0xff, 0x77, 0xb4, 0xf3, 0xff, 0x1f, 0x94, 0xf5, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0xc6, 0xe2, 0xf4, 
+  0xff, 0xf3, 0xfe, 0xfe, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xfd, 0xff, 0xa3, 0xcc, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x8a, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x24, 0x95, 0xf4, 0xe4, 0xa1, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x59, 0xa5, 0xf5, 0x2c, 0x1c, 0x95, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf8, 0xff, 0x87, 0x1c, 0x94, 0xf7, 0xff, 0x05, 0x1c, 0x94, 0xf8, 0xff, 0x28, 
+  0x96, 0xf1, 0xff, 0x5f, 0xab, 0xf5, 0xff, 0x87, 0xbb, 0xf5, 0xff, 0x56, 0xa6, 0xf5, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0x86, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x95, 0xf7, 0xff, 0x81, 0x1c, 0x95, 
+  0xf6, 0xff, 0x00, 0x5a, 0xa6, 0xf5, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0xa2, 0xf2, 0x48, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 
+  0xff, 0x1b, 0x94, 0xf7, 0xff, 0x84, 0x1c, 0x94, 0xf7, 0xff, 0x81, 0x1c, 0x94, 0xf8, 0xff, 0x01, 0x1d, 0x94, 0xf7, 0xff, 0x1d, 0x95, 0xf6, 0xff, 0x83, 0x1c, 0x94, 0xf7, 0xff, 0x00, 0x1b, 0x94, 
+  0xf8, 0xff, 0x81, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x5c, 0xa6, 0xf4, 0x23, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xa8, 0xf3, 0x1f, 0x81, 0x1b, 
+  0x95, 0xf6, 0xff, 0x00, 0x1d, 0x94, 0xf7, 0xfc, 0x8c, 0x1c, 0x94, 0xf7, 0xff, 0x02, 0x1d, 0x94, 0xf7, 0xfc, 0x1c, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf6, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x55, 0xa4, 0xf4, 0x3b, 0x1e, 0x94, 0xf5, 0xfb, 0x81, 0x1c, 0x94, 0xf7, 0xff, 0x01, 0x1c, 0x94, 0xf8, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x82, 0x1b, 0x94, 0xf7, 0xff, 0x05, 0x1b, 0x95, 0xf7, 0xff, 
+  0x1b, 0x94, 0xf6, 0xff, 0x1b, 0x94, 0xf7, 0xff, 0x1c, 0x94, 0xf7, 0xff, 0x1e, 0x95, 0xf4, 0xfb, 0x5d, 0xa8, 0xf2, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +368,7 @@ const lv_img_dsc_t bitcoin_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( bitcoin_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = bitcoin_64px_map,
 };
-
@@ -47,6 +47,8 @@ LV_IMG_DECLARE(info_1_16px);
 // declare callback functions for the app and widget icon to enter the app
 static void enter_example_app_event_cb( lv_obj_t * obj, lv_event_t event );
 static void enter_example_widget_event_cb( lv_obj_t * obj, lv_event_t event );
+static void example_app_create_cb( void );
+static void example_app_destroy_cb( void );
 
 /*
  * setup routine for example app
@@ -74,11 +76,27 @@ void example_app_setup( void ) {
     widget_set_indicator( example_widget, ICON_INDICATOR_UPDATE );
 #endif // EXAMPLE_WIDGET
 
-    // init main and setup tile, see example_app_main.cpp and example_app_setup.cpp
+    // main and setup tile are build on the first use and deleted when not used for a while
+    // to save heap and boot time, see example_app_create_cb() and example_app_destroy_cb()
+    mainbar_add_app_tile_lifecycle_cb( example_app_main_tile_num, example_app_create_cb, example_app_destroy_cb );
+}
+
+/*
+ * init main and setup tile, see example_app_main.cpp and example_app_setup.cpp
+ */
+static void example_app_create_cb( void ) {
     example_app_main_setup( example_app_main_tile_num );
     example_app_setup_setup( example_app_setup_tile_num );
 }
 
+/*
+ * stop all tasks and forget all objects, the tiles are already cleaned
+ */
+static void example_app_destroy_cb( void ) {
+    example_app_main_destroy();
+    example_app_setup_destroy();
+}
+
 /*
  *
  */
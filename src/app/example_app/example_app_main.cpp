@@ -33,7 +33,7 @@
 lv_obj_t *example_app_main_tile = NULL;
 lv_style_t example_app_main_style;
 
-lv_task_t * _example_app_task;
+lv_task_t * _example_app_task = NULL;
 
 LV_IMG_DECLARE(exit_32px);
 LV_IMG_DECLARE(setup_32px);
@@ -80,6 +80,15 @@ void example_app_main_setup( uint32_t tile_num ) {
     _example_app_task = lv_task_create( example_app_task, 1000, LV_TASK_PRIO_MID, NULL );
 }
 
+void example_app_main_destroy( void ) {
+    if ( _example_app_task ) {
+        lv_task_del( _example_app_task );
+        _example_app_task = NULL;
+    }
+    lv_style_reset( &example_app_main_style );
+    example_app_main_tile = NULL;
+}
+
 static void enter_example_app_setup_event_cb( lv_obj_t * obj, lv_event_t event ) {
     switch( event ) {
         case( LV_EVENT_CLICKED ):       statusbar_hide( true );
@@ -25,5 +25,6 @@
     #include <TTGO.h>
 
     void example_app_main_setup( uint32_t tile_num );
+    void example_app_main_destroy( void );
 
 #endif // _EXAMPLE_APP_MAIN_H
\ No newline at end of file
@@ -85,6 +85,12 @@ void example_app_setup_setup( uint32_t tile_num ) {
     lv_obj_align( example_app_foobar_switch_label, example_app_foobar_switch_cont, LV_ALIGN_IN_LEFT_MID, 5, 0 );
 }
 
+void example_app_setup_destroy( void ) {
+    lv_style_reset( &example_app_setup_style );
+    example_app_foobar_switch = NULL;
+    example_app_setup_tile = NULL;
+}
+
 static void example_app_foobar_switch_event_cb( lv_obj_t * obj, lv_event_t event ) {
     switch( event ) {
         case( LV_EVENT_VALUE_CHANGED ): Serial.printf( "switch value = %d\r\n", lv_switch_get_state( obj ) );
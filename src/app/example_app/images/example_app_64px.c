@@ -10,271 +10,239 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_EXAMPLE_APP_64PX uint8_t example_app_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x28, 0x33, 0xb0, 0x33, 0xf3, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x28, 0x33, 0xf0, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xfc, 0x33, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xb0, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xf3, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xf3, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe4, 0x33, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xcf, 0x33, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xb3, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xfc, 0x33, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf3, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe4, 0x33, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xcf, 0x33, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x0c, 0x00, 0x00, 0x33, 0xe8, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xb3, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x4c, 0x00, 0x00, 0x33, 0x50, 0x33, 0xeb, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xd7, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xd8, 0x33, 0x4f, 0x33, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf8, 0x33, 0x8c, 0x33, 0x33, 0x33, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe3, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf7, 0x33, 0x2b, 0x00, 0x00, 0x33, 0x2b, 0x33, 0xb3, 0x33, 0xf4, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf4, 0x33, 0xb3, 0x33, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x8c, 0x00, 0x00, 0x33, 0x2b, 0x33, 0xf0, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf0, 0x33, 0x28, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x33, 0x00, 0x00, 0x33, 0xb4, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xb0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x08, 0x00, 0x00, 0x33, 0xf4, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf4, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xd4, 0x33, 0x4b, 0x33, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0b, 0x33, 0x4f, 0x33, 0xd7, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0x33, 0x4f, 0x33, 0xd8, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0x33, 0x4f, 0x33, 0xd8, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xd4, 0x33, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0f, 0x33, 0xd7, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x10, 0x33, 0xd8, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x10, 0x33, 0xd8, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x4b, 0x00, 0x00, 0x33, 0x53, 0x33, 0xeb, 0x33, 0xff, 0x33, 0xff, 0x33, 0xeb, 0x33, 0x50, 0x00, 0x00, 0x33, 0x4f, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xeb, 0x33, 0x50, 0x00, 0x00, 0x33, 0x4f, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xeb, 0x33, 0x50, 0x00, 0x00, 0x33, 0x4f, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x0b, 0x00, 0x00, 0x33, 0xeb, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe8, 0x33, 0x4f, 0x00, 0x00, 0x33, 0x50, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe8, 0x33, 0x4f, 0x00, 0x00, 0x33, 0x50, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x10, 0x33, 0xd8, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x10, 0x33, 0xd8, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x33, 0x0f, 0x33, 0x53, 0x33, 0xdb, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x33, 0x0f, 0x33, 0x53, 0x33, 0xdb, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x08, 0x00, 0x00, 0x33, 0xf4, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x33, 0x00, 0x00, 0x33, 0xb3, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xaf, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0x8f, 0x00, 0x00, 0x33, 0x28, 0x33, 0xf0, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xef, 0x33, 0x27, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf8, 0x33, 0x2c, 0x00, 0x00, 0x33, 0x28, 0x33, 0xb0, 0x33, 0xf4, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf3, 0x33, 0xaf, 0x33, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xe3, 0x33, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf8, 0x33, 0x8f, 0x33, 0x34, 0x33, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xf4, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xb3, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x28, 0x33, 0xf0, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xef, 0x33, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x28, 0x33, 0xb0, 0x33, 0xf4, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf4, 0x33, 0xb0, 0x33, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x84, 0x00, 0x00, 0x02, 0x33, 0x28, 0x33, 0xb0, 0x33, 0xf3, 0x93, 0x33, 0xff, 0x81, 0x00, 0x00, 0x00, 0x33, 0x6c, 
+  0xa4, 0x00, 0x00, 0x01, 0x33, 0x28, 0x33, 0xf0, 0x95, 0x33, 0xff, 0x81, 0x00, 0x00, 0x01, 0x33, 0xfc, 0x33, 0x4b, 0xa3, 0x00, 0x00, 0x00, 0x33, 0xb0, 0x96, 0x33, 0xff, 0x81, 0x00, 0x00, 0x02, 
+  0x33, 0xff, 0x33, 0xf3, 0x33, 0x30, 0xa2, 0x00, 0x00, 0x00, 0x33, 0xf3, 0x96, 0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 0x01, 0x33, 0xe4, 0x33, 0x1b, 0xa1, 0x00, 0x00, 0x97, 0x33, 0xff, 
+  0x81, 0x00, 0x00, 0x82, 0x33, 0xff, 0x01, 0x33, 0xcf, 0x33, 0x0c, 0xa0, 0x00, 0x00, 0x97, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x01, 0x33, 0xb3, 0x0f, 0x03, 0x9f, 0x00, 0x00, 0x97, 
+  0x33, 0xff, 0x81, 0x00, 0x00, 0x84, 0x33, 0xff, 0x00, 0x33, 0x93, 0x9f, 0x00, 0x00, 0x97, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x00, 0x33, 0x6c, 0x9e, 0x00, 0x00, 0x97, 0x33, 0xff, 
+  0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x01, 0x33, 0xfc, 0x33, 0x4b, 0x9d, 0x00, 0x00, 0x97, 0x33, 0xff, 0x81, 0x00, 0x00, 0x86, 0x33, 0xff, 0x01, 0x33, 0xf3, 0x33, 0x30, 0x9c, 0x00, 0x00, 0x97, 
+  0x33, 0xff, 0x81, 0x00, 0x00, 0x87, 0x33, 0xff, 0x01, 0x33, 0xe4, 0x33, 0x1b, 0x9b, 0x00, 0x00, 0x97, 0x33, 0xff, 0x81, 0x00, 0x00, 0x88, 0x33, 0xff, 0x01, 0x33, 0xcf, 0x33, 0x0c, 0x9a, 0x00, 
+  0x00, 0x97, 0x33, 0xff, 0x02, 0x33, 0x0c, 0x00, 0x00, 0x33, 0xe8, 0x88, 0x33, 0xff, 0x01, 0x33, 0xb3, 0x0f, 0x03, 0x99, 0x00, 0x00, 0x97, 0x33, 0xff, 0x03, 0x33, 0x4c, 0x00, 0x00, 0x33, 0x50, 
+  0x33, 0xeb, 0x88, 0x33, 0xff, 0x00, 0x33, 0x93, 0x99, 0x00, 0x00, 0x97, 0x33, 0xff, 0x01, 0x33, 0xd7, 0x13, 0x10, 0xa5, 0x00, 0x00, 0x98, 0x33, 0xff, 0x02, 0x33, 0xd8, 0x33, 0x4f, 0x33, 0x0c, 
+  0xa3, 0x00, 0x00, 0xa5, 0x33, 0xff, 0x99, 0x00, 0x00, 0xa5, 0x33, 0xff, 0x99, 0x00, 0x00, 0xa5, 0x33, 0xff, 0x99, 0x00, 0x00, 0xa5, 0x33, 0xff, 0x99, 0x00, 0x00, 0x8f, 0x33, 0xff, 0x03, 0x33, 
+  0xf8, 0x33, 0x8c, 0x33, 0x33, 0x33, 0x08, 0xab, 0x00, 0x00, 0x8e, 0x33, 0xff, 0x01, 0x33, 0xe3, 0x33, 0x2b, 0xae, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x05, 0x33, 0xf7, 0x33, 0x2b, 0x00, 0x00, 0x33, 
+  0x2b, 0x33, 0xb3, 0x33, 0xf4, 0xa1, 0x33, 0xff, 0x02, 0x33, 0xf4, 0x33, 0xb3, 0x33, 0x28, 0x86, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x03, 0x33, 0x8c, 0x00, 0x00, 0x33, 0x2b, 0x33, 0xf0, 0xa5, 0x33, 
+  0xff, 0x01, 0x33, 0xf0, 0x33, 0x28, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x02, 0x33, 0x33, 0x00, 0x00, 0x33, 0xb4, 0xa7, 0x33, 0xff, 0x00, 0x33, 0xb0, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x02, 
+  0x33, 0x08, 0x00, 0x00, 0x33, 0xf4, 0xa7, 0x33, 0xff, 0x00, 0x33, 0xf4, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x84, 0x33, 0xff, 0x02, 0x33, 0xd4, 0x33, 0x4b, 0x33, 0x0b, 0x81, 
+  0x00, 0x00, 0x02, 0x33, 0x0b, 0x33, 0x4f, 0x33, 0xd7, 0x82, 0x33, 0xff, 0x85, 0x00, 0x00, 0x02, 0x33, 0x0c, 0x33, 0x4f, 0x33, 0xd8, 0x82, 0x33, 0xff, 0x85, 0x00, 0x00, 0x02, 0x33, 0x0c, 0x33, 
+  0x4f, 0x33, 0xd8, 0x84, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x01, 0x33, 0xd4, 0x33, 0x0f, 0x85, 0x00, 0x00, 0x01, 0x33, 0x0f, 0x33, 0xd7, 0x81, 
+  0x33, 0xff, 0x87, 0x00, 0x00, 0x01, 0x13, 0x10, 0x33, 0xd8, 0x81, 0x33, 0xff, 0x87, 0x00, 0x00, 0x01, 0x13, 0x10, 0x33, 0xd8, 0x83, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 
+  0x00, 0x83, 0x33, 0xff, 0x03, 0x33, 0x4b, 0x00, 0x00, 0x33, 0x53, 0x33, 0xeb, 0x81, 0x33, 0xff, 0x03, 0x33, 0xeb, 0x33, 0x50, 0x00, 0x00, 0x33, 0x4f, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 
+  0x33, 0xff, 0x03, 0x33, 0xeb, 0x33, 0x50, 0x00, 0x00, 0x33, 0x4f, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x03, 0x33, 0xeb, 0x33, 0x50, 0x00, 0x00, 0x33, 0x4f, 0x83, 0x33, 0xff, 
+  0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x02, 0x33, 0x0b, 0x00, 0x00, 0x33, 0xeb, 0x83, 0x33, 0xff, 0x02, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x81, 0x33, 0xff, 
+  0x81, 0x00, 0x00, 0x84, 0x33, 0xff, 0x02, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x84, 0x33, 0xff, 0x02, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x83, 0x33, 0xff, 
+  0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x84, 0x33, 0xff, 0x02, 0x33, 
+  0xe8, 0x00, 0x00, 0x33, 0x0c, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x84, 0x33, 0xff, 0x02, 0x33, 0xe8, 0x00, 0x00, 0x33, 0x0c, 0x83, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 
+  0x00, 0x83, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x03, 0x33, 0xe8, 0x33, 0x4f, 0x00, 0x00, 0x33, 0x50, 0x81, 
+  0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x03, 0x33, 0xe8, 0x33, 0x4f, 0x00, 0x00, 0x33, 0x50, 0x83, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 
+  0x89, 0x00, 0x00, 0x81, 0x33, 0xff, 0x87, 0x00, 0x00, 0x01, 0x13, 0x10, 0x33, 0xd8, 0x81, 0x33, 0xff, 0x87, 0x00, 0x00, 0x01, 0x13, 0x10, 0x33, 0xd8, 0x83, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 
+  0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x89, 0x00, 0x00, 0x81, 0x33, 0xff, 0x85, 0x00, 0x00, 0x02, 0x33, 0x0f, 0x33, 0x53, 0x33, 0xdb, 0x82, 0x33, 0xff, 0x85, 0x00, 0x00, 0x02, 0x33, 
+  0x0f, 0x33, 0x53, 0x33, 0xdb, 0x84, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 
+  0x81, 0x00, 0x00, 0x89, 0x33, 0xff, 0x81, 0x00, 0x00, 0x8b, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x81, 0x00, 
+  0x00, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x89, 0x33, 0xff, 0x81, 0x00, 0x00, 0x8b, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 
+  0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x89, 0x33, 0xff, 0x81, 0x00, 0x00, 0x8b, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 
+  0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x89, 0x33, 0xff, 0x81, 0x00, 0x00, 0x8b, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x81, 0x00, 
+  0x00, 0x83, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x89, 0x33, 0xff, 0x81, 0x00, 0x00, 0x8b, 0x33, 0xff, 0x85, 0x00, 0x00, 0x8d, 
+  0x33, 0xff, 0x81, 0x00, 0x00, 0x83, 0x33, 0xff, 0x81, 0x00, 0x00, 0x85, 0x33, 0xff, 0x81, 0x00, 0x00, 0x81, 0x33, 0xff, 0x81, 0x00, 0x00, 0x89, 0x33, 0xff, 0x81, 0x00, 0x00, 0x8b, 0x33, 0xff, 
+  0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x02, 0x33, 0x08, 0x00, 0x00, 0x33, 0xf4, 0xa7, 0x33, 0xff, 0x00, 0x33, 0xf3, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x02, 0x33, 0x33, 0x00, 0x00, 0x33, 0xb3, 
+  0xa7, 0x33, 0xff, 0x00, 0x33, 0xaf, 0x85, 0x00, 0x00, 0x8d, 0x33, 0xff, 0x03, 0x33, 0x8f, 0x00, 0x00, 0x33, 0x28, 0x33, 0xf0, 0xa5, 0x33, 0xff, 0x01, 0x33, 0xef, 0x33, 0x27, 0x85, 0x00, 0x00, 
+  0x8d, 0x33, 0xff, 0x05, 0x33, 0xf8, 0x33, 0x2c, 0x00, 0x00, 0x33, 0x28, 0x33, 0xb0, 0x33, 0xf4, 0xa1, 0x33, 0xff, 0x02, 0x33, 0xf3, 0x33, 0xaf, 0x33, 0x24, 0x86, 0x00, 0x00, 0x8e, 0x33, 0xff, 
+  0x01, 0x33, 0xe3, 0x33, 0x2c, 0xae, 0x00, 0x00, 0x8f, 0x33, 0xff, 0x03, 0x33, 0xf8, 0x33, 0x8f, 0x33, 0x34, 0x33, 0x0b, 0xab, 0x00, 0x00, 0xa5, 0x33, 0xff, 0x99, 0x00, 0x00, 0xa5, 0x33, 0xff, 
+  0x99, 0x00, 0x00, 0xa5, 0x33, 0xff, 0x99, 0x00, 0x00, 0xa5, 0x33, 0xff, 0x99, 0x00, 0x00, 0x00, 0x33, 0xf4, 0xa3, 0x33, 0xff, 0x00, 0x33, 0xf4, 0x99, 0x00, 0x00, 0x00, 0x33, 0xb3, 0xa3, 0x33, 
+  0xff, 0x00, 0x33, 0xb0, 0x99, 0x00, 0x00, 0x01, 0x33, 0x28, 0x33, 0xf0, 0xa1, 0x33, 0xff, 0x01, 0x33, 0xef, 0x33, 0x27, 0x9a, 0x00, 0x00, 0x02, 0x33, 0x28, 0x33, 0xb0, 0x33, 0xf4, 0x9d, 0x33, 
+  0xff, 0x02, 0x33, 0xf4, 0x33, 0xb0, 0x33, 0x27, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x96, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x13, 0xb0, 0xff, 0x13, 0xf3, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xf0, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xfc, 0xff, 0x13, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0xb0, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf3, 0x1f, 0x1c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0xf3, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xe4, 0xdf, 0x13, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xcf, 0x1f, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xb3, 0xbf, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xfc, 0xff, 0x13, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf3, 0x1f, 0x1c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xe4, 0xdf, 0x13, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xcf, 0x1f, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x1f, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0xff, 0x13, 0xe8, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xb3, 0xbf, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0x4c, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x50, 0xff, 0x13, 0xeb, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xd7, 0x1f, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xd8, 0xff, 0x1b, 0x4f, 0xbf, 0x13, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf8, 0xff, 0x1b, 0x8c, 0x1f, 0x14, 0x33, 0x1f, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xe3, 0xff, 0x1b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf7, 0xff, 0x1b, 0x2b, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x2b, 0xff, 0x1b, 0xb3, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xb3, 0x1f, 0x14, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0x8c, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x2b, 0xff, 0x1b, 0xf0, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xf0, 0x1f, 0x14, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x1f, 0x14, 0x33, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xb4, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x1f, 0x24, 0x08, 0x00, 0x00, 0x00, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xd4, 0xff, 0x13, 0x4b, 0x1f, 0x1c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x1b, 0x0b, 0x1f, 0x14, 0x4f, 0xff, 0x1b, 0xd7, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x0c, 0xff, 0x1b, 0x4f, 0xff, 0x1b, 0xd8, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x0c, 0xff, 0x1b, 0x4f, 0xff, 0x1b, 0xd8, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xd4, 0x1f, 0x14, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x13, 0x0f, 0xff, 0x1b, 0xd7, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x10, 0xff, 0x1b, 0xd8, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x10, 0xff, 0x1b, 0xd8, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0x4b, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x53, 0xff, 0x13, 0xeb, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xeb, 0x1f, 0x1c, 0x50, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x4f, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xeb, 0x1f, 0x1c, 0x50, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x4f, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xeb, 0x1f, 0x1c, 0x50, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x4f, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x1f, 0x1c, 0x0b, 0x00, 0x00, 0x00, 0xff, 0x13, 0xeb, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x0c, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xe8, 0x1f, 0x14, 0x4f, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x50, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xe8, 0x1f, 0x14, 0x4f, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x50, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x13, 0x10, 0xff, 0x1b, 0xd8, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x13, 0x10, 0xff, 0x1b, 0xd8, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x14, 0x0f, 0x1f, 0x1c, 0x53, 0xff, 0x1b, 0xdb, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x14, 0x0f, 0x1f, 0x1c, 0x53, 0xff, 0x1b, 0xdb, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x1f, 0x24, 0x08, 0x00, 0x00, 0x00, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0x33, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xb3, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0x8f, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xf0, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xef, 0x1f, 0x14, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf8, 0x1f, 0x1c, 0x2c, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xb0, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf3, 0xff, 0x13, 0xaf, 0xff, 0x13, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xe3, 0x1f, 0x1c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf8, 0xff, 0x1b, 0x8f, 0x1f, 0x14, 0x34, 0x1f, 0x1c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xb3, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xf0, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xef, 0xff, 0x13, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xb0, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf4, 0xff, 0x13, 0xb0, 0xff, 0x13, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x14, 0x28, 0xff, 0x13, 0xb0, 0xff, 0x13, 0xf3, 0x93, 0xff, 
+  0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x6c, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xf0, 0x95, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x1b, 
+  0xfc, 0xff, 0x13, 0x4b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0xb0, 0x96, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x02, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xf3, 0x1f, 0x1c, 0x30, 0xa2, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0x13, 0xf3, 0x96, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xe4, 0xdf, 0x13, 0x1b, 0xa1, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 
+  0xff, 0x81, 0x00, 0x00, 0x00, 0x82, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xcf, 0x1f, 0x1c, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 
+  0x01, 0xff, 0x1b, 0xb3, 0xbf, 0x02, 0x03, 0x9f, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x13, 0x93, 0x9f, 0x00, 0x00, 0x00, 0x97, 
+  0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1b, 0x6c, 0x9e, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x01, 
+  0xff, 0x1b, 0xfc, 0xff, 0x13, 0x4b, 0x9d, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x86, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x13, 0xf3, 0x1f, 0x1c, 0x30, 0x9c, 0x00, 0x00, 
+  0x00, 0x97, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x87, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xe4, 0xdf, 0x13, 0x1b, 0x9b, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0x88, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xcf, 0x1f, 0x1c, 0x0c, 0x9a, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x02, 0x1f, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0xff, 0x13, 0xe8, 0x88, 0xff, 0x1b, 
+  0xff, 0x01, 0xff, 0x1b, 0xb3, 0xbf, 0x02, 0x03, 0x99, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0x4c, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x50, 0xff, 0x13, 0xeb, 0x88, 0xff, 0x1b, 
+  0xff, 0x00, 0xff, 0x13, 0x93, 0x99, 0x00, 0x00, 0x00, 0x97, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xd7, 0x1f, 0x14, 0x10, 0xa5, 0x00, 0x00, 0x00, 0x98, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x1b, 0xd8, 
+  0xff, 0x1b, 0x4f, 0xbf, 0x13, 0x0c, 0xa3, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 0x99, 0x00, 
+  0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 0x99, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0xf8, 0xff, 0x1b, 0x8c, 0x1f, 0x14, 0x33, 0x1f, 0x24, 0x08, 0xab, 0x00, 0x00, 0x00, 0x8e, 
+  0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xe3, 0xff, 0x1b, 0x2b, 0xae, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x05, 0xff, 0x13, 0xf7, 0xff, 0x1b, 0x2b, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x2b, 0xff, 
+  0x1b, 0xb3, 0xff, 0x13, 0xf4, 0xa1, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0xf4, 0xff, 0x1b, 0xb3, 0x1f, 0x14, 0x28, 0x86, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x1b, 0x8c, 0x00, 
+  0x00, 0x00, 0x1f, 0x14, 0x2b, 0xff, 0x1b, 0xf0, 0xa5, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xf0, 0x1f, 0x14, 0x28, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x02, 0x1f, 0x14, 0x33, 0x00, 
+  0x00, 0x00, 0xff, 0x1b, 0xb4, 0xa7, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1b, 0xb0, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x02, 0x1f, 0x24, 0x08, 0x00, 0x00, 0x00, 0xff, 0x13, 0xf4, 0xa7, 
+  0xff, 0x1b, 0xff, 0x00, 0xff, 0x13, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0xd4, 0xff, 0x13, 0x4b, 0x1f, 0x1c, 
+  0x0b, 0x81, 0x00, 0x00, 0x00, 0x02, 0xbf, 0x1b, 0x0b, 0x1f, 0x14, 0x4f, 0xff, 0x1b, 0xd7, 0x82, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x1c, 0x0c, 0xff, 0x1b, 0x4f, 0xff, 0x1b, 
+  0xd8, 0x82, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x1c, 0x0c, 0xff, 0x1b, 0x4f, 0xff, 0x1b, 0xd8, 0x84, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x13, 0xd4, 0x1f, 0x14, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x13, 0x0f, 0xff, 0x1b, 0xd7, 0x81, 0xff, 0x1b, 0xff, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0x1f, 0x14, 0x10, 0xff, 0x1b, 0xd8, 0x81, 0xff, 0x1b, 0xff, 0x87, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x14, 0x10, 0xff, 0x1b, 0xd8, 0x83, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 
+  0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0x4b, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x53, 0xff, 0x13, 0xeb, 0x81, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0xeb, 
+  0x1f, 0x1c, 0x50, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x4f, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0xeb, 0x1f, 0x1c, 0x50, 0x00, 0x00, 0x00, 0xff, 
+  0x1b, 0x4f, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0xeb, 0x1f, 0x1c, 0x50, 0x00, 0x00, 0x00, 0xff, 0x1b, 0x4f, 0x83, 0xff, 0x1b, 0xff, 0x85, 
+  0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x02, 0x1f, 0x1c, 0x0b, 0x00, 0x00, 0x00, 0xff, 0x13, 0xeb, 0x83, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 
+  0xe8, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x0c, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0x81, 0xff, 0x1b, 
+  0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0x83, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0xff, 0x1b, 0xff, 0x02, 
+  0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0xe8, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x0c, 0x83, 
+  0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 
+  0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0xe8, 0x1f, 0x14, 0x4f, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x50, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0x83, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0xe8, 0x1f, 0x14, 0x4f, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x50, 0x83, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 
+  0x00, 0x83, 0xff, 0x1b, 0xff, 0x89, 0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x87, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x13, 0x10, 0xff, 0x1b, 0xd8, 0x81, 0xff, 0x1b, 0xff, 0x87, 0x00, 0x00, 0x00, 
+  0x01, 0xdf, 0x13, 0x10, 0xff, 0x1b, 0xd8, 0x83, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x89, 0x00, 0x00, 0x00, 0x81, 
+  0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x14, 0x0f, 0x1f, 0x1c, 0x53, 0xff, 0x1b, 0xdb, 0x82, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x14, 0x0f, 0x1f, 0x1c, 0x53, 
+  0xff, 0x1b, 0xdb, 0x84, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x8b, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x8b, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x8b, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x8b, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x8b, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0xff, 0x1b, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0xff, 0x1b, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x8b, 0xff, 0x1b, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x02, 0x1f, 0x24, 0x08, 0x00, 0x00, 0x00, 0xff, 0x13, 0xf4, 0xa7, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x13, 
+  0xf3, 0x85, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0x33, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xb3, 0xa7, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x13, 0xaf, 0x85, 0x00, 0x00, 0x00, 0x8d, 
+  0xff, 0x1b, 0xff, 0x03, 0xff, 0x1b, 0x8f, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xf0, 0xa5, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xef, 0x1f, 0x14, 0x27, 0x85, 0x00, 0x00, 0x00, 0x8d, 
+  0xff, 0x1b, 0xff, 0x05, 0xff, 0x13, 0xf8, 0x1f, 0x1c, 0x2c, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xb0, 0xff, 0x13, 0xf4, 0xa1, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0xf3, 0xff, 0x13, 
+  0xaf, 0xff, 0x13, 0x24, 0x86, 0x00, 0x00, 0x00, 0x8e, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xe3, 0x1f, 0x1c, 0x2c, 0xae, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x13, 0xf8, 0xff, 
+  0x1b, 0x8f, 0x1f, 0x14, 0x34, 0x1f, 0x1c, 0x0b, 0xab, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 
+  0x99, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1b, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0xf4, 0xa3, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x13, 0xf4, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xb3, 
+  0xa3, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x13, 0xb0, 0x99, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xf0, 0xa1, 0xff, 0x1b, 0xff, 0x01, 0xff, 0x1b, 0xef, 0xff, 0x13, 0x27, 0x9a, 0x00, 
+  0x00, 0x00, 0x02, 0x1f, 0x14, 0x28, 0xff, 0x1b, 0xb0, 0xff, 0x13, 0xf4, 0x9d, 0xff, 0x1b, 0xff, 0x02, 0xff, 0x13, 0xf4, 0xff, 0x13, 0xb0, 0xff, 0x13, 0x27, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x13, 0xff, 0xb0, 0x13, 0xff, 0xf3, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xf0, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xfc, 0x13, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xb0, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf3, 0x1c, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xf3, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xe4, 0x13, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xcf, 0x1c, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xb3, 0x02, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xfc, 0x13, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf3, 0x1c, 0x1f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xe4, 0x13, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xcf, 0x1c, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1c, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x13, 0xff, 0xe8, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xb3, 0x02, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x50, 0x13, 0xff, 0xeb, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xd7, 0x14, 0x1f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xd8, 0x1b, 0xff, 0x4f, 0x13, 0xbf, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf8, 0x1b, 0xff, 0x8c, 0x14, 0x1f, 0x33, 0x24, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xe3, 0x1b, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf7, 0x1b, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x2b, 0x1b, 0xff, 0xb3, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xb3, 0x14, 0x1f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x2b, 0x1b, 0xff, 0xf0, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xf0, 0x14, 0x1f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x14, 0x1f, 0x33, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb4, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x24, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xd4, 0x13, 0xff, 0x4b, 0x1c, 0x1f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xbf, 0x0b, 0x14, 0x1f, 0x4f, 0x1b, 0xff, 0xd7, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x0c, 0x1b, 0xff, 0x4f, 0x1b, 0xff, 0xd8, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x0c, 0x1b, 0xff, 0x4f, 0x1b, 0xff, 0xd8, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xd4, 0x14, 0x1f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xdf, 0x0f, 0x1b, 0xff, 0xd7, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x10, 0x1b, 0xff, 0xd8, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x10, 0x1b, 0xff, 0xd8, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x53, 0x13, 0xff, 0xeb, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xeb, 0x1c, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x4f, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xeb, 0x1c, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x4f, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xeb, 0x1c, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x4f, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1c, 0x1f, 0x0b, 0x00, 0x00, 0x00, 0x13, 0xff, 0xeb, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x0c, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xe8, 0x14, 0x1f, 0x4f, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x50, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xe8, 0x14, 0x1f, 0x4f, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x50, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xdf, 0x10, 0x1b, 0xff, 0xd8, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xdf, 0x10, 0x1b, 0xff, 0xd8, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x14, 0x1f, 0x0f, 0x1c, 0x1f, 0x53, 0x1b, 0xff, 0xdb, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x14, 0x1f, 0x0f, 0x1c, 0x1f, 0x53, 0x1b, 0xff, 0xdb, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x24, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0x33, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb3, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xf0, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xef, 0x14, 0x1f, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf8, 0x1c, 0x1f, 0x2c, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xb0, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf3, 0x13, 0xff, 0xaf, 0x13, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xe3, 0x1c, 0x1f, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf8, 0x1b, 0xff, 0x8f, 0x14, 0x1f, 0x34, 0x1c, 0x1f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb3, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xf0, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xef, 0x13, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xb0, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf4, 0x13, 0xff, 0xb0, 0x13, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x02, 0x14, 0x1f, 0x28, 0x13, 0xff, 0xb0, 0x13, 0xff, 0xf3, 0x93, 0x1b, 
+  0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x6c, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xf0, 0x95, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x01, 0x1b, 0xff, 
+  0xfc, 0x13, 0xff, 0x4b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xb0, 0x96, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x02, 0x1b, 0xff, 0xff, 0x13, 0xff, 0xf3, 0x1c, 0x1f, 0x30, 0xa2, 0x00, 
+  0x00, 0x00, 0x00, 0x13, 0xff, 0xf3, 0x96, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xe4, 0x13, 0xdf, 0x1b, 0xa1, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 
+  0xff, 0x81, 0x00, 0x00, 0x00, 0x82, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xcf, 0x1c, 0x1f, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 
+  0x01, 0x1b, 0xff, 0xb3, 0x02, 0xbf, 0x03, 0x9f, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0x1b, 0xff, 0xff, 0x00, 0x13, 0xff, 0x93, 0x9f, 0x00, 0x00, 0x00, 0x97, 
+  0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x00, 0x1b, 0xff, 0x6c, 0x9e, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x01, 
+  0x1b, 0xff, 0xfc, 0x13, 0xff, 0x4b, 0x9d, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x86, 0x1b, 0xff, 0xff, 0x01, 0x13, 0xff, 0xf3, 0x1c, 0x1f, 0x30, 0x9c, 0x00, 0x00, 
+  0x00, 0x97, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x87, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xe4, 0x13, 0xdf, 0x1b, 0x9b, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0x88, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xcf, 0x1c, 0x1f, 0x0c, 0x9a, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x02, 0x1c, 0x1f, 0x0c, 0x00, 0x00, 0x00, 0x13, 0xff, 0xe8, 0x88, 0x1b, 0xff, 
+  0xff, 0x01, 0x1b, 0xff, 0xb3, 0x02, 0xbf, 0x03, 0x99, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x50, 0x13, 0xff, 0xeb, 0x88, 0x1b, 0xff, 
+  0xff, 0x00, 0x13, 0xff, 0x93, 0x99, 0x00, 0x00, 0x00, 0x97, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xd7, 0x14, 0x1f, 0x10, 0xa5, 0x00, 0x00, 0x00, 0x98, 0x1b, 0xff, 0xff, 0x02, 0x1b, 0xff, 0xd8, 
+  0x1b, 0xff, 0x4f, 0x13, 0xbf, 0x0c, 0xa3, 0x00, 0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 0x99, 0x00, 
+  0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x8f, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0xf8, 0x1b, 0xff, 0x8c, 0x14, 0x1f, 0x33, 0x24, 0x1f, 0x08, 0xab, 0x00, 0x00, 0x00, 0x8e, 
+  0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xe3, 0x1b, 0xff, 0x2b, 0xae, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x05, 0x13, 0xff, 0xf7, 0x1b, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x2b, 0x1b, 
+  0xff, 0xb3, 0x13, 0xff, 0xf4, 0xa1, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0xf4, 0x1b, 0xff, 0xb3, 0x14, 0x1f, 0x28, 0x86, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x03, 0x1b, 0xff, 0x8c, 0x00, 
+  0x00, 0x00, 0x14, 0x1f, 0x2b, 0x1b, 0xff, 0xf0, 0xa5, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xf0, 0x14, 0x1f, 0x28, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x02, 0x14, 0x1f, 0x33, 0x00, 
+  0x00, 0x00, 0x1b, 0xff, 0xb4, 0xa7, 0x1b, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xb0, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x02, 0x24, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x13, 0xff, 0xf4, 0xa7, 
+  0x1b, 0xff, 0xff, 0x00, 0x13, 0xff, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0xd4, 0x13, 0xff, 0x4b, 0x1c, 0x1f, 
+  0x0b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x1b, 0xbf, 0x0b, 0x14, 0x1f, 0x4f, 0x1b, 0xff, 0xd7, 0x82, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x1f, 0x0c, 0x1b, 0xff, 0x4f, 0x1b, 0xff, 
+  0xd8, 0x82, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x1f, 0x0c, 0x1b, 0xff, 0x4f, 0x1b, 0xff, 0xd8, 0x84, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x01, 0x13, 0xff, 0xd4, 0x14, 0x1f, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x01, 0x13, 0xdf, 0x0f, 0x1b, 0xff, 0xd7, 0x81, 0x1b, 0xff, 0xff, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0x14, 0x1f, 0x10, 0x1b, 0xff, 0xd8, 0x81, 0x1b, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x01, 0x14, 0x1f, 0x10, 0x1b, 0xff, 0xd8, 0x83, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 
+  0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x53, 0x13, 0xff, 0xeb, 0x81, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0xeb, 
+  0x1c, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x4f, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0xeb, 0x1c, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x1b, 
+  0xff, 0x4f, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0xeb, 0x1c, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x4f, 0x83, 0x1b, 0xff, 0xff, 0x85, 
+  0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x02, 0x1c, 0x1f, 0x0b, 0x00, 0x00, 0x00, 0x13, 0xff, 0xeb, 0x83, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 
+  0xe8, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x0c, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x81, 0x1b, 0xff, 
+  0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x83, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0x1b, 0xff, 0xff, 0x02, 
+  0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x84, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x13, 0xbf, 0x0c, 0x83, 
+  0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 
+  0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0xe8, 0x14, 0x1f, 0x4f, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x50, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0x83, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0xe8, 0x14, 0x1f, 0x4f, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x50, 0x83, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 
+  0x00, 0x83, 0x1b, 0xff, 0xff, 0x89, 0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x01, 0x13, 0xdf, 0x10, 0x1b, 0xff, 0xd8, 0x81, 0x1b, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 
+  0x01, 0x13, 0xdf, 0x10, 0x1b, 0xff, 0xd8, 0x83, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x89, 0x00, 0x00, 0x00, 0x81, 
+  0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x14, 0x1f, 0x0f, 0x1c, 0x1f, 0x53, 0x1b, 0xff, 0xdb, 0x82, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x02, 0x14, 0x1f, 0x0f, 0x1c, 0x1f, 0x53, 
+  0x1b, 0xff, 0xdb, 0x84, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x8b, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x8b, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x8b, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x8b, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x8b, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x83, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x85, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x81, 0x1b, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x89, 0x1b, 0xff, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x8b, 0x1b, 0xff, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x02, 0x24, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x13, 0xff, 0xf4, 0xa7, 0x1b, 0xff, 0xff, 0x00, 0x13, 0xff, 
+  0xf3, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0x33, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb3, 0xa7, 0x1b, 0xff, 0xff, 0x00, 0x13, 0xff, 0xaf, 0x85, 0x00, 0x00, 0x00, 0x8d, 
+  0x1b, 0xff, 0xff, 0x03, 0x1b, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xf0, 0xa5, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xef, 0x14, 0x1f, 0x27, 0x85, 0x00, 0x00, 0x00, 0x8d, 
+  0x1b, 0xff, 0xff, 0x05, 0x13, 0xff, 0xf8, 0x1c, 0x1f, 0x2c, 0x00, 0x00, 0x00, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xb0, 0x13, 0xff, 0xf4, 0xa1, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0xf3, 0x13, 0xff, 
+  0xaf, 0x13, 0xff, 0x24, 0x86, 0x00, 0x00, 0x00, 0x8e, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xe3, 0x1c, 0x1f, 0x2c, 0xae, 0x00, 0x00, 0x00, 0x8f, 0x1b, 0xff, 0xff, 0x03, 0x13, 0xff, 0xf8, 0x1b, 
+  0xff, 0x8f, 0x14, 0x1f, 0x34, 0x1c, 0x1f, 0x0b, 0xab, 0x00, 0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 
+  0x99, 0x00, 0x00, 0x00, 0xa5, 0x1b, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xf4, 0xa3, 0x1b, 0xff, 0xff, 0x00, 0x13, 0xff, 0xf4, 0x99, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb3, 
+  0xa3, 0x1b, 0xff, 0xff, 0x00, 0x13, 0xff, 0xb0, 0x99, 0x00, 0x00, 0x00, 0x01, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xf0, 0xa1, 0x1b, 0xff, 0xff, 0x01, 0x1b, 0xff, 0xef, 0x13, 0xff, 0x27, 0x9a, 0x00, 
+  0x00, 0x00, 0x02, 0x14, 0x1f, 0x28, 0x1b, 0xff, 0xb0, 0x13, 0xff, 0xf4, 0x9d, 0x1b, 0xff, 0xff, 0x02, 0x13, 0xff, 0xf4, 0x13, 0xff, 0xb0, 0x13, 0xff, 0x27, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xfa, 0x7e, 0x14, 0xb0, 0xf9, 0x7c, 0x13, 0xf3, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x7e, 0x15, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xf9, 0x7e, 0x15, 0xf0, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7e, 0x15, 0xfc, 0xfb, 0x7d, 0x14, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x7e, 0x14, 0xb0, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xf3, 0xf9, 0x7f, 0x15, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xf3, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7e, 0x15, 0xe4, 0xfe, 0x7a, 0x12, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xcf, 0xff, 0x7f, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7d, 0x15, 0xb3, 0xff, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7d, 0x13, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7e, 0x15, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x15, 0xfc, 0xfb, 0x7d, 0x14, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xf3, 0xf9, 0x7f, 0x15, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7e, 0x15, 0xe4, 0xfe, 0x7a, 0x12, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xcf, 0xff, 0x7f, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xff, 0x7f, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xe8, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7d, 0x15, 0xb3, 0xff, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7d, 0x13, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x16, 0x50, 0xf9, 0x7e, 0x13, 0xeb, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7d, 0x13, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7c, 0x15, 0xd7, 0xff, 0x7f, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xd8, 0xfb, 0x7d, 0x16, 0x4f, 0xfe, 0x75, 0x13, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xf8, 0xfb, 0x7e, 0x15, 0x8c, 0xf9, 0x7f, 0x14, 0x33, 0xff, 0x7f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7e, 0x15, 0xe3, 0xf9, 0x7c, 0x17, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xf7, 0xf9, 0x7c, 0x17, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x12, 0x2b, 0xf9, 0x7d, 0x15, 0xb3, 0xf9, 0x7c, 0x13, 0xf4, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xf4, 0xfa, 0x7e, 0x15, 0xb3, 0xf8, 0x7f, 0x13, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7d, 0x15, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x12, 0x2b, 0xf9, 0x7c, 0x15, 0xf0, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x15, 0xf0, 0xf8, 0x7f, 0x13, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7f, 0x14, 0x33, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7e, 0x15, 0xb4, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7d, 0x15, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xff, 0x7f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xf4, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x14, 0xd4, 0xfb, 0x7d, 0x14, 0x4b, 0xff, 0x7f, 0x19, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x73, 0x17, 0x0b, 0xfb, 0x7f, 0x13, 0x4f, 0xfb, 0x7c, 0x15, 0xd7, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x15, 0x0c, 0xfb, 0x7d, 0x16, 0x4f, 0xfb, 0x7e, 0x15, 0xd8, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x15, 0x0c, 0xfb, 0x7d, 0x16, 0x4f, 0xfb, 0x7e, 0x15, 0xd8, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x14, 0xd4, 0xfe, 0x7f, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x77, 0x11, 0x0f, 0xfb, 0x7c, 0x15, 0xd7, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x0f, 0x10, 0xfb, 0x7e, 0x15, 0xd8, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x0f, 0x10, 0xfb, 0x7e, 0x15, 0xd8, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7d, 0x14, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7d, 0x15, 0x53, 0xf9, 0x7c, 0x13, 0xeb, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xeb, 0xfb, 0x7f, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x13, 0x4f, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xeb, 0xfb, 0x7f, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7d, 0x16, 0x4f, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xeb, 0xfb, 0x7f, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7d, 0x16, 0x4f, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xff, 0x7f, 0x19, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xeb, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x15, 0x0c, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xe8, 0xfb, 0x7f, 0x13, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x16, 0x50, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xe8, 0xfb, 0x7f, 0x13, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x16, 0x50, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x78, 0x0f, 0x10, 0xfb, 0x7c, 0x15, 0xd8, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x78, 0x0f, 0x10, 0xfb, 0x7c, 0x15, 0xd8, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x12, 0x0f, 0xfb, 0x7f, 0x15, 0x53, 0xfb, 0x7e, 0x15, 0xdb, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x12, 0x0f, 0xfb, 0x7f, 0x15, 0x53, 0xfb, 0x7e, 0x15, 0xdb, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xff, 0x7f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xf4, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7d, 0x14, 0x33, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x7e, 0x15, 0xb3, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7d, 0x14, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7d, 0x15, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xf9, 0x7e, 0x15, 0xf0, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x15, 0xef, 0xf8, 0x7f, 0x14, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xf8, 0xf9, 0x7f, 0x17, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xfa, 0x7d, 0x15, 0xb0, 0xf9, 0x7e, 0x13, 0xf4, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xf3, 0xfa, 0x7e, 0x14, 0xaf, 0xf8, 0x7c, 0x14, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7c, 0x15, 0xe3, 0xf9, 0x7f, 0x17, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xf8, 0xfb, 0x7e, 0x15, 0x8f, 0xfa, 0x7f, 0x13, 0x34, 0xff, 0x7f, 0x19, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xf4, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x7e, 0x15, 0xb3, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfa, 0x7e, 0x14, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xf9, 0x7e, 0x15, 0xf0, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x15, 0xef, 0xf8, 0x7c, 0x13, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xfa, 0x7d, 0x15, 0xb0, 0xf9, 0x7c, 0x13, 0xf4, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7e, 0x13, 0xf4, 0xfa, 0x7e, 0x14, 0xb0, 0xf8, 0x7c, 0x13, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf8, 0x7f, 0x13, 0x28, 0xfa, 0x7e, 0x14, 
+  0xb0, 0xf9, 0x7c, 0x13, 0xf3, 0x93, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x7e, 0x15, 0x6c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x7f, 0x13, 0x28, 0xf9, 0x7e, 
+  0x15, 0xf0, 0x95, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf9, 0x7e, 0x15, 0xfc, 0xfb, 0x7d, 0x14, 0x4b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x7e, 0x14, 0xb0, 0x96, 
+  0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x7e, 0x15, 0xff, 0xf9, 0x7c, 0x13, 0xf3, 0xf9, 0x7f, 0x15, 0x30, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xf3, 
+  0x96, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfa, 0x7e, 0x15, 0xe4, 0xfe, 0x7a, 0x12, 0x1b, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 
+  0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x82, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfb, 0x7e, 0x15, 0xcf, 0xff, 0x7f, 0x15, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xf9, 0x7d, 0x15, 0xb3, 0xff, 0x55, 0x00, 0x03, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x84, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xfb, 0x7d, 0x13, 0x93, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x00, 
+  0xfa, 0x7e, 0x15, 0x6c, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xf9, 0x7e, 0x15, 0xfc, 0xfb, 0x7d, 0x14, 
+  0x4b, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x86, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xf9, 0x7c, 0x13, 0xf3, 0xf9, 0x7f, 0x15, 0x30, 0x9c, 0x00, 
+  0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x87, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfa, 0x7e, 0x15, 0xe4, 0xfe, 0x7a, 0x12, 0x1b, 0x9b, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x88, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfb, 0x7e, 0x15, 0xcf, 0xff, 0x7f, 0x15, 0x0c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 
+  0x15, 0xff, 0x02, 0xff, 0x7f, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xe8, 0x88, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xf9, 0x7d, 0x15, 0xb3, 0xff, 0x55, 0x00, 0x03, 0x99, 0x00, 0x00, 
+  0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xfb, 0x7d, 0x13, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x16, 0x50, 0xf9, 0x7e, 0x13, 0xeb, 0x88, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xfb, 0x7d, 
+  0x13, 0x93, 0x99, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfb, 0x7c, 0x15, 0xd7, 0xff, 0x7f, 0x0f, 0x10, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x98, 0xfb, 0x7e, 0x15, 0xff, 0x02, 
+  0xfb, 0x7e, 0x15, 0xd8, 0xfb, 0x7d, 0x16, 0x4f, 0xfe, 0x75, 0x13, 0x0c, 0xa3, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 
+  0x99, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xf9, 
+  0x7e, 0x13, 0xf8, 0xfb, 0x7e, 0x15, 0x8c, 0xf9, 0x7f, 0x14, 0x33, 0xff, 0x7f, 0x1f, 0x08, 0xab, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfa, 0x7e, 0x15, 0xe3, 0xf9, 0x7c, 
+  0x17, 0x2b, 0xae, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x05, 0xf9, 0x7c, 0x13, 0xf7, 0xf9, 0x7c, 0x17, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x12, 0x2b, 0xf9, 0x7d, 0x15, 
+  0xb3, 0xf9, 0x7c, 0x13, 0xf4, 0xa1, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xf9, 0x7e, 0x13, 0xf4, 0xfa, 0x7e, 0x15, 0xb3, 0xf8, 0x7f, 0x13, 0x28, 0x86, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 
+  0xff, 0x03, 0xfb, 0x7d, 0x15, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x12, 0x2b, 0xf9, 0x7c, 0x15, 0xf0, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xf9, 0x7e, 0x15, 0xf0, 0xf8, 0x7f, 0x13, 0x28, 
+  0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xf9, 0x7f, 0x14, 0x33, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7e, 0x15, 0xb4, 0xa7, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xfa, 0x7d, 0x15, 
+  0xb0, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xff, 0x7f, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xf4, 0xa7, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xf9, 0x7e, 
+  0x13, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xfb, 0x7e, 0x14, 0xd4, 0xfb, 0x7d, 0x14, 0x4b, 0xff, 
+  0x7f, 0x19, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x73, 0x17, 0x0b, 0xfb, 0x7f, 0x13, 0x4f, 0xfb, 0x7c, 0x15, 0xd7, 0x82, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xff, 0x7f, 0x15, 0x0c, 0xfb, 0x7d, 0x16, 0x4f, 0xfb, 0x7e, 0x15, 0xd8, 0x82, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x7f, 0x15, 0x0c, 0xfb, 0x7d, 0x16, 0x4f, 0xfb, 
+  0x7e, 0x15, 0xd8, 0x84, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfb, 0x7e, 0x14, 
+  0xd4, 0xfe, 0x7f, 0x12, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x77, 0x11, 0x0f, 0xfb, 0x7c, 0x15, 0xd7, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x7f, 
+  0x0f, 0x10, 0xfb, 0x7e, 0x15, 0xd8, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x7f, 0x0f, 0x10, 0xfb, 0x7e, 0x15, 0xd8, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 
+  0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xfb, 0x7d, 0x14, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7d, 0x15, 0x53, 0xf9, 
+  0x7c, 0x13, 0xeb, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xf9, 0x7e, 0x13, 0xeb, 0xfb, 0x7f, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x13, 0x4f, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xf9, 0x7e, 0x13, 0xeb, 0xfb, 0x7f, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7d, 0x16, 0x4f, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xf9, 0x7e, 0x13, 0xeb, 0xfb, 0x7f, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7d, 0x16, 0x4f, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 
+  0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xff, 0x7f, 0x19, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xeb, 0x83, 
+  0xfb, 0x7e, 0x15, 0xff, 0x02, 0xf9, 0x7c, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x15, 0x0c, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfb, 0x7e, 0x15, 0xff, 
+  0x02, 0xf9, 0x7c, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xf9, 0x7c, 0x13, 
+  0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 
+  0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfb, 0x7e, 0x15, 0xff, 
+  0x02, 0xf9, 0x7e, 0x13, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x84, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xf9, 0x7e, 0x13, 
+  0xe8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x75, 0x13, 0x0c, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 
+  0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 
+  0x03, 0xf9, 0x7e, 0x13, 0xe8, 0xfb, 0x7f, 0x13, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x16, 0x50, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 
+  0x03, 0xf9, 0x7e, 0x13, 0xe8, 0xfb, 0x7f, 0x13, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x7f, 0x16, 0x50, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x78, 0x0f, 0x10, 0xfb, 0x7c, 
+  0x15, 0xd8, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x78, 0x0f, 0x10, 0xfb, 0x7c, 0x15, 0xd8, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 
+  0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x7f, 
+  0x12, 0x0f, 0xfb, 0x7f, 0x15, 0x53, 0xfb, 0x7e, 0x15, 0xdb, 0x82, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x7f, 0x12, 0x0f, 0xfb, 0x7f, 0x15, 0x53, 0xfb, 0x7e, 0x15, 
+  0xdb, 0x84, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 
+  0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfb, 0x7e, 
+  0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 
+  0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 
+  0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 
+  0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x89, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x89, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x83, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x89, 
+  0xfb, 0x7e, 0x15, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfb, 0x7e, 0x15, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xff, 0x7f, 0x1f, 0x08, 0x00, 0x00, 0x00, 
+  0x00, 0xf9, 0x7c, 0x13, 0xf4, 0xa7, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xf9, 0x7c, 0x13, 0xf3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x02, 0xfa, 0x7d, 0x14, 0x33, 0x00, 0x00, 
+  0x00, 0x00, 0xfa, 0x7e, 0x15, 0xb3, 0xa7, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xfa, 0x7d, 0x14, 0xaf, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xfb, 0x7d, 0x15, 0x8f, 0x00, 
+  0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xf9, 0x7e, 0x15, 0xf0, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xf9, 0x7e, 0x15, 0xef, 0xf8, 0x7f, 0x14, 0x27, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xfb, 
+  0x7e, 0x15, 0xff, 0x05, 0xf9, 0x7e, 0x13, 0xf8, 0xf9, 0x7f, 0x17, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x13, 0x28, 0xfa, 0x7d, 0x15, 0xb0, 0xf9, 0x7e, 0x13, 0xf4, 0xa1, 0xfb, 0x7e, 0x15, 
+  0xff, 0x02, 0xf9, 0x7c, 0x13, 0xf3, 0xfa, 0x7e, 0x14, 0xaf, 0xf8, 0x7c, 0x14, 0x24, 0x86, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xfb, 0x7e, 0x15, 0xff, 0x01, 0xfa, 0x7c, 0x15, 0xe3, 0xf9, 0x7f, 0x17, 
+  0x2c, 0xae, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xfb, 0x7e, 0x15, 0xff, 0x03, 0xf9, 0x7e, 0x13, 0xf8, 0xfb, 0x7e, 0x15, 0x8f, 0xfa, 0x7f, 0x13, 0x34, 0xff, 0x7f, 0x19, 0x0b, 0xab, 0x00, 0x00, 0x00, 
+  0x00, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfb, 0x7e, 0x15, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0xa5, 
+  0xfb, 0x7e, 0x15, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7c, 0x13, 0xf4, 0xa3, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xf9, 0x7e, 0x13, 0xf4, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x7e, 
+  0x15, 0xb3, 0xa3, 0xfb, 0x7e, 0x15, 0xff, 0x00, 0xfa, 0x7e, 0x14, 0xb0, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x7f, 0x13, 0x28, 0xf9, 0x7e, 0x15, 0xf0, 0xa1, 0xfb, 0x7e, 0x15, 0xff, 0x01, 
+  0xf9, 0x7c, 0x15, 0xef, 0xf8, 0x7c, 0x13, 0x27, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf8, 0x7f, 0x13, 0x28, 0xfa, 0x7d, 0x15, 0xb0, 0xf9, 0x7c, 0x13, 0xf4, 0x9d, 0xfb, 0x7e, 0x15, 0xff, 0x02, 
+  0xf9, 0x7e, 0x13, 0xf4, 0xfa, 0x7e, 0x14, 0xb0, 0xf8, 0x7c, 0x13, 0x27, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +250,7 @@ const lv_img_dsc_t example_app_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( example_app_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = example_app_64px_map,
 };
-
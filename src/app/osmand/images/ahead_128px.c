@@ -10,527 +10,541 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_AHEAD_128PX uint8_t ahead_128px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x40, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x40, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x40, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x40, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x40, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x40, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdf, 0x92, 0xff, 0x92, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x92, 0x40, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xd9, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd9, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x50, 0x00, 0x00, 
-  0x92, 0x0c, 0x92, 0xdf, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x13, 
-  0x92, 0x94, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa4, 
-  0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x13, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x23, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 0x92, 0x08, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xd5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xa4, 0x00, 0x00, 0x01, 0x92, 0x3f, 0x92, 0x4f, 0xc8, 0x00, 0x00, 0x03, 0x92, 0x0c, 0x92, 0xdc, 0x92, 0xe7, 0x92, 0x13, 0xc7, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 
+  0xff, 0x00, 0x92, 0xa4, 0xc6, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x83, 0x92, 0xff, 0x00, 0x92, 0x50, 0xc4, 0x00, 0x00, 0x01, 0x92, 0x0b, 0x92, 0xdc, 0x83, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 
+  0xc3, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x81, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xc2, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0x81, 0xf8, 0xff, 0x00, 0xb2, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xc0, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0x81, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 
+  0xe7, 0x92, 0x13, 0xbf, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x83, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xbe, 0x00, 0x00, 0x00, 0x92, 
+  0x3f, 0x82, 0x92, 0xff, 0x85, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xbc, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0x85, 0xf8, 
+  0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0xbb, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x87, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 
+  0xff, 0x00, 0x92, 0xa4, 0xba, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0x89, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xb8, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 
+  0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0x89, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 
+  0xff, 0x8b, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xb6, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0x8d, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 
+  0x92, 0x50, 0xb4, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0x8d, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0xb3, 0x00, 
+  0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x8f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xb2, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0x91, 
+  0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xb0, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0x91, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 
+  0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0xaf, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x93, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xae, 
+  0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0x95, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xac, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 
+  0xf9, 0xff, 0x95, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0xab, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x97, 0xf8, 0xff, 0x00, 
+  0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xaa, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0x99, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xa8, 0x00, 0x00, 
+  0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0x99, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0xa7, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 
+  0x92, 0xff, 0x00, 0xd5, 0xff, 0x9b, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xa6, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0x9d, 0xf8, 0xff, 0x00, 0xb2, 0xff, 
+  0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xa4, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0x9d, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 
+  0x92, 0x13, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0xa2, 0x00, 0x00, 0x00, 0x92, 0x3f, 
+  0x82, 0x92, 0xff, 0xa1, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0xa0, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0xa1, 0xf8, 0xff, 
+  0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0x9f, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0xa3, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 
+  0x00, 0x92, 0xa4, 0x9e, 0x00, 0x00, 0x00, 0x92, 0x3f, 0x82, 0x92, 0xff, 0xa5, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0x9c, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 
+  0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0xa5, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0x9b, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 
+  0xa7, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0x9a, 0x00, 0x00, 0x00, 0x92, 0x40, 0x82, 0x92, 0xff, 0xa9, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 
+  0x50, 0x98, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0xa9, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0x97, 0x00, 0x00, 
+  0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0xab, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0x96, 0x00, 0x00, 0x00, 0x92, 0x40, 0x82, 0x92, 0xff, 0xad, 0xf8, 
+  0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0x94, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0xad, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 
+  0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0x93, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0xaf, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0x92, 0x00, 
+  0x00, 0x00, 0x92, 0x40, 0x82, 0x92, 0xff, 0xb1, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0x90, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 
+  0xff, 0xb1, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0x8f, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0xb3, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0x8e, 0x00, 0x00, 0x00, 0x92, 0x40, 0x82, 0x92, 0xff, 0xb5, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0x8c, 0x00, 0x00, 0x01, 
+  0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0xb5, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x92, 0x93, 0x81, 0x92, 
+  0xff, 0x00, 0xd5, 0xff, 0xb7, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0x8a, 0x00, 0x00, 0x00, 0x92, 0x40, 0x82, 0x92, 0xff, 0xb9, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 
+  0x92, 0xff, 0x00, 0x92, 0x50, 0x88, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdc, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0xb9, 0xf8, 0xff, 0x00, 0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 
+  0x13, 0x87, 0x00, 0x00, 0x00, 0x92, 0x94, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0xbb, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa4, 0x86, 0x00, 0x00, 0x00, 0x92, 0x40, 0x82, 
+  0x92, 0xff, 0xbd, 0xf8, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x50, 0x84, 0x00, 0x00, 0x01, 0x92, 0x0c, 0x92, 0xdf, 0x81, 0x92, 0xff, 0x00, 0xf9, 0xff, 0xbd, 0xf8, 0xff, 0x00, 
+  0xf9, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xe7, 0x92, 0x13, 0x83, 0x00, 0x00, 0x00, 0x92, 0x94, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0xbf, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 
+  0x92, 0xa4, 0x82, 0x00, 0x00, 0x00, 0x92, 0x40, 0x82, 0x92, 0xff, 0x00, 0xb6, 0xff, 0x8e, 0xb5, 0xff, 0x00, 0xd9, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd9, 0xff, 0x8e, 0xb5, 0xff, 0x00, 0xb6, 0xff, 
+  0x82, 0x92, 0xff, 0x03, 0x92, 0x50, 0x00, 0x00, 0x92, 0x0c, 0x92, 0xdf, 0x92, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x92, 0x92, 0xff, 0x02, 0x92, 0xe7, 0x92, 0x13, 
+  0x92, 0x94, 0x93, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x93, 0x92, 0xff, 0x00, 0x92, 0xa4, 0x91, 0x92, 0x08, 0x00, 0x92, 0x13, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 
+  0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x23, 0x91, 0x92, 0x08, 0x91, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 
+  0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 
+  0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 0x00, 0xd5, 0xff, 0x9f, 0xf8, 0xff, 0x00, 0xd5, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x81, 0x92, 0xff, 
+  0x00, 0xb2, 0xff, 0x9f, 0xb6, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 0x0b, 0xa5, 0x92, 0xff, 0x00, 0x92, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x92, 
+  0x0b, 0xa5, 0x92, 0xff, 0x00, 0x92, 0x1b, 0x91, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0b, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x94, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdf, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xe7, 0xd5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x06, 0xde, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x94, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4b, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xec, 0xac, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0xa9, 0xcd, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0xc9, 0xd5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0x0c, 0xb5, 0xff, 0xec, 0xac, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 
-  0x10, 0x84, 0x0c, 0x10, 0x84, 0xdf, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 
-  0x10, 0x84, 0x94, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa4, 
-  0x30, 0x84, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x31, 0x8c, 0x13, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x23, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 0x51, 0x8c, 0x08, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0xb5, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x80, 0xf6, 0xff, 0x4c, 0xbd, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x6e, 0x94, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0xec, 0xac, 0xff, 0x6e, 0x94, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x3f, 0x10, 0x84, 0x4f, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 
+  0xc7, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x83, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 
+  0xc4, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0b, 0x10, 0x84, 0xdc, 0x83, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 
+  0x84, 0xff, 0x01, 0x0c, 0xb5, 0xff, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x00, 0x4f, 0x94, 
+  0xff, 0x81, 0x61, 0xee, 0xff, 0x00, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 
+  0x00, 0xe7, 0xd5, 0xff, 0x81, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 
+  0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x83, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 
+  0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x83, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0xbc, 0x00, 0x00, 
+  0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0x85, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 
+  0x10, 0x84, 0x13, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x87, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 
+  0x10, 0x84, 0xa4, 0xba, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x87, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 
+  0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0x89, 0x80, 0xf6, 0xff, 
+  0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x8b, 
+  0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 
+  0xee, 0xff, 0x8b, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0xb4, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 
+  0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0x8d, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xb3, 0x00, 0x00, 0x00, 0x00, 
+  0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x8f, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xb2, 0x00, 0x00, 0x00, 0x00, 
+  0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x8f, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x50, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0x91, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 
+  0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x93, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 
+  0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xae, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x93, 0x80, 0xf6, 0xff, 0x01, 0x61, 
+  0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0xac, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 
+  0x95, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xab, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 
+  0x0c, 0xb5, 0xff, 0x97, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x01, 
+  0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x97, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 
+  0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0x99, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xa7, 
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9b, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xa6, 
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x9b, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 
+  0xff, 0x00, 0x10, 0x84, 0x50, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0x9d, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 
+  0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 
+  0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0x9f, 0x80, 
+  0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 
+  0x00, 0xe7, 0xd5, 0xff, 0xa1, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 
+  0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0xa3, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x3f, 0x81, 
+  0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0xa3, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0x9c, 0x00, 0x00, 
+  0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0xa5, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 
+  0x10, 0x84, 0x13, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0xa7, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 
+  0x10, 0x84, 0xa4, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0xa7, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 
+  0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0x98, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0xa9, 0x80, 0xf6, 0xff, 
+  0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x97, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0xab, 
+  0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0x96, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 
+  0xee, 0xff, 0xab, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0x94, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 
+  0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0xad, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x93, 0x00, 0x00, 0x00, 0x00, 
+  0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0xaf, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0x92, 0x00, 0x00, 0x00, 0x00, 
+  0x10, 0x84, 0x40, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0xaf, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x50, 0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0xb1, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 
+  0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0xb3, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 
+  0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0xb3, 0x80, 0xf6, 0xff, 0x01, 0x61, 
+  0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 
+  0xb5, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x00, 
+  0x0c, 0xb5, 0xff, 0xb7, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x81, 0x10, 0x84, 0xff, 0x01, 
+  0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0xb7, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x50, 0x88, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 
+  0x0c, 0x10, 0x84, 0xdc, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0xb9, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x87, 
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x94, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0xbb, 0x80, 0xf6, 0xff, 0x00, 0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0x86, 
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x81, 0x10, 0x84, 0xff, 0x01, 0x4f, 0x94, 0xff, 0x61, 0xee, 0xff, 0xbb, 0x80, 0xf6, 0xff, 0x01, 0x61, 0xee, 0xff, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 
+  0xff, 0x00, 0x10, 0x84, 0x50, 0x84, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x0c, 0x10, 0x84, 0xdf, 0x81, 0x10, 0x84, 0xff, 0x00, 0xe7, 0xd5, 0xff, 0xbd, 0x80, 0xf6, 0xff, 0x00, 0x06, 0xde, 0xff, 
+  0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x83, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x94, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0xbf, 0x80, 0xf6, 0xff, 0x00, 
+  0x4b, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xa4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x40, 0x82, 0x10, 0x84, 0xff, 0x00, 0xec, 0xac, 0xff, 0x8e, 0x0c, 0xb5, 0xff, 0x00, 
+  0xa9, 0xcd, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0xc9, 0xd5, 0xff, 0x8e, 0x0c, 0xb5, 0xff, 0x00, 0xec, 0xac, 0xff, 0x82, 0x10, 0x84, 0xff, 0x03, 0x10, 0x84, 0x50, 0x00, 0x00, 0x00, 0x10, 0x84, 
+  0x0c, 0x10, 0x84, 0xdf, 0x92, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x92, 0x10, 0x84, 0xff, 0x02, 0x10, 0x84, 0xe7, 0x10, 0x84, 0x13, 0x10, 
+  0x84, 0x94, 0x93, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x93, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xa4, 0x30, 0x84, 0x08, 0x90, 0x51, 0x8c, 
+  0x08, 0x00, 0x31, 0x8c, 0x13, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x23, 0x91, 0x51, 0x8c, 
+  0x08, 0x91, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0xb5, 0xff, 0x9f, 0x80, 0xf6, 0xff, 0x00, 0x4c, 0xbd, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x6e, 0x94, 0xff, 0x9f, 0xec, 0xac, 0xff, 0x00, 0x6e, 0x94, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0xa5, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x0b, 0xa5, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 
+  0x1b, 0x91, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0b, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x94, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdf, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xd5, 0xe7, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xde, 0x06, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x94, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4b, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xac, 0xec, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xcd, 0xa9, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xd5, 0xc9, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x0c, 0xff, 0xac, 0xec, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 
-  0x84, 0x10, 0x0c, 0x84, 0x10, 0xdf, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 
-  0x84, 0x10, 0x94, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa4, 
-  0x84, 0x30, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x31, 0x13, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x23, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 0x8c, 0x51, 0x08, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0xb5, 0x0c, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xf6, 0x80, 0xff, 0xbd, 0x4c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x94, 0x6e, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0xac, 0xec, 0xff, 0x94, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x3f, 0x84, 0x10, 0x4f, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 
+  0xc7, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x83, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 
+  0xc4, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0b, 0x84, 0x10, 0xdc, 0x83, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 
+  0x10, 0xff, 0x01, 0xb5, 0x0c, 0xff, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x00, 0x94, 0x4f, 
+  0xff, 0x81, 0xee, 0x61, 0xff, 0x00, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 
+  0x00, 0xd5, 0xe7, 0xff, 0x81, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 
+  0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x83, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 
+  0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0x83, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0xbc, 0x00, 0x00, 
+  0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0x85, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 
+  0x84, 0x10, 0x13, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x87, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 
+  0x84, 0x10, 0xa4, 0xba, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0x87, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 
+  0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0x89, 0xf6, 0x80, 0xff, 
+  0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x8b, 
+  0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 
+  0x61, 0xff, 0x8b, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0xb4, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 
+  0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0x8d, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xb3, 0x00, 0x00, 0x00, 0x00, 
+  0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x8f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xb2, 0x00, 0x00, 0x00, 0x00, 
+  0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0x8f, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x50, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0x91, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 
+  0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x93, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 
+  0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xae, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0x93, 0xf6, 0x80, 0xff, 0x01, 0xee, 
+  0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0xac, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 
+  0x95, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xab, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 
+  0xb5, 0x0c, 0xff, 0x97, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x01, 
+  0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0x97, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 
+  0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0x99, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xa7, 
+  0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9b, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xa6, 
+  0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0x9b, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 
+  0xff, 0x00, 0x84, 0x10, 0x50, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0x9d, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 
+  0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 
+  0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0x9f, 0xf6, 
+  0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 
+  0x00, 0xd5, 0xe7, 0xff, 0xa1, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 
+  0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0xa3, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x3f, 0x81, 
+  0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xa3, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0x9c, 0x00, 0x00, 
+  0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0xa5, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 
+  0x84, 0x10, 0x13, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0xa7, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 
+  0x84, 0x10, 0xa4, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xa7, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 
+  0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0x98, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0xa9, 0xf6, 0x80, 0xff, 
+  0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x97, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0xab, 
+  0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0x96, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 
+  0x61, 0xff, 0xab, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0x94, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 
+  0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0xad, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x93, 0x00, 0x00, 0x00, 0x00, 
+  0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0xaf, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0x92, 0x00, 0x00, 0x00, 0x00, 
+  0x84, 0x10, 0x40, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xaf, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x50, 0x90, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0xb1, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 
+  0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0xb3, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 
+  0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xb3, 0xf6, 0x80, 0xff, 0x01, 0xee, 
+  0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 
+  0xb5, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x00, 
+  0xb5, 0x0c, 0xff, 0xb7, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x81, 0x84, 0x10, 0xff, 0x01, 
+  0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xb7, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x50, 0x88, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 
+  0x0c, 0x84, 0x10, 0xdc, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0xb9, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x87, 
+  0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x94, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0xbb, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0x86, 
+  0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x81, 0x84, 0x10, 0xff, 0x01, 0x94, 0x4f, 0xff, 0xee, 0x61, 0xff, 0xbb, 0xf6, 0x80, 0xff, 0x01, 0xee, 0x61, 0xff, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 
+  0xff, 0x00, 0x84, 0x10, 0x50, 0x84, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x0c, 0x84, 0x10, 0xdf, 0x81, 0x84, 0x10, 0xff, 0x00, 0xd5, 0xe7, 0xff, 0xbd, 0xf6, 0x80, 0xff, 0x00, 0xde, 0x06, 0xff, 
+  0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x83, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x94, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0xbf, 0xf6, 0x80, 0xff, 0x00, 
+  0xbd, 0x4b, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xa4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x40, 0x82, 0x84, 0x10, 0xff, 0x00, 0xac, 0xec, 0xff, 0x8e, 0xb5, 0x0c, 0xff, 0x00, 
+  0xcd, 0xa9, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xd5, 0xc9, 0xff, 0x8e, 0xb5, 0x0c, 0xff, 0x00, 0xac, 0xec, 0xff, 0x82, 0x84, 0x10, 0xff, 0x03, 0x84, 0x10, 0x50, 0x00, 0x00, 0x00, 0x84, 0x10, 
+  0x0c, 0x84, 0x10, 0xdf, 0x92, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x92, 0x84, 0x10, 0xff, 0x02, 0x84, 0x10, 0xe7, 0x84, 0x10, 0x13, 0x84, 
+  0x10, 0x94, 0x93, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x93, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xa4, 0x84, 0x30, 0x08, 0x90, 0x8c, 0x51, 
+  0x08, 0x00, 0x8c, 0x31, 0x13, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x23, 0x91, 0x8c, 0x51, 
+  0x08, 0x91, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0xb5, 0x0c, 0xff, 0x9f, 0xf6, 0x80, 0xff, 0x00, 0xbd, 0x4c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0x81, 0x84, 0x10, 0xff, 0x00, 0x94, 0x6e, 0xff, 0x9f, 0xac, 0xec, 0xff, 0x00, 0x94, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0xa5, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x0b, 0xa5, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 
+  0x1b, 0x91, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x0b, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x80, 0x80, 0x80, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x06, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x06, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x06, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa1, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x94, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x56, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdf, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3b, 0xbb, 0xd4, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x94, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0xa2, 0xb1, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x56, 0xa7, 0xb8, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x63, 0x9b, 0xa7, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x46, 0xb4, 0xc9, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x45, 0xb7, 0xce, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x60, 0xa1, 0xaf, 0xff, 0x61, 0x9d, 0xaa, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 
-  0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdf, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 
-  0x80, 0x80, 0x80, 0x94, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa4, 
-  0x84, 0x84, 0x84, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x85, 0x85, 0x85, 0x13, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x23, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 0x87, 0x87, 0x87, 0x08, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0xa2, 0xb2, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0xd0, 0xf0, 0xff, 0x5d, 0xa8, 0xbb, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x74, 0x8b, 0x91, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x61, 0x9e, 0xab, 0xff, 0x73, 0x8e, 0x94, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x3f, 0x80, 0x80, 0x80, 0x4f, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 
+  0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0xc6, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x83, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x50, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x82, 0x82, 0x0b, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x03, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x80, 0x80, 0x80, 0x13, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x01, 0x5e, 0xa1, 0xb1, 0xff, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x03, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x06, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0x81, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 
+  0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x00, 0x5e, 0xa1, 0xb1, 0xff, 0x83, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x80, 0x80, 0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x83, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x06, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 
+  0xd4, 0xff, 0x85, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xbb, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa1, 0xb1, 0xff, 0x87, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 
+  0x80, 0x80, 0x80, 0xa4, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x87, 0x00, 0xd0, 0xf0, 
+  0xff, 0x01, 0x06, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 
+  0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0x89, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 
+  0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa1, 0xb1, 0xff, 0x8b, 0x00, 0xd0, 0xf0, 0xff, 0x00, 
+  0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 
+  0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x8b, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xb4, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0x8d, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 
+  0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 
+  0x5e, 0xa1, 0xb1, 0xff, 0x8f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 
+  0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x8f, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 
+  0x91, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa1, 0xb1, 0xff, 0x93, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 
+  0x80, 0xa4, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x93, 0x00, 0xd0, 0xf0, 0xff, 0x01, 
+  0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xac, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0x95, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 
+  0x81, 0x81, 0x81, 0x13, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa1, 0xb1, 0xff, 0x97, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 
+  0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8e, 0xff, 
+  0x0c, 0xcb, 0xea, 0xff, 0x97, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xa8, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0x99, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 
+  0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa1, 
+  0xb1, 0xff, 0x9b, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8e, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x9b, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0x9d, 0x00, 
+  0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 
+  0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa1, 0xb1, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 
+  0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 
+  0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0xa1, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 
+  0x81, 0x13, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 0xa3, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x3f, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 
+  0xea, 0xff, 0xa3, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0xa5, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 
+  0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 
+  0xa7, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0xa7, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 
+  0x81, 0x81, 0x81, 0x50, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0xa9, 0x00, 0xd0, 0xf0, 
+  0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 0xab, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x96, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0xab, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 
+  0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0xad, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 
+  0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 0xaf, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 
+  0xaf, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 
+  0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0xb1, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 
+  0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 0xb3, 0x00, 
+  0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0xb3, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 
+  0x81, 0x50, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0xb5, 0x00, 0xd0, 0xf0, 0xff, 0x04, 
+  0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 0xb7, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x57, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x8a, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0xb7, 0x00, 0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 
+  0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdc, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 
+  0x3b, 0xbb, 0xd4, 0xff, 0xb9, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x87, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x94, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 0xbb, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x56, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x75, 0x8a, 0x8f, 0xff, 0x0c, 0xcb, 0xea, 0xff, 0xbb, 0x00, 
+  0xd0, 0xf0, 0xff, 0x01, 0x05, 0xcd, 0xec, 0xff, 0x72, 0x8d, 0x93, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x50, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x0c, 
+  0x80, 0x80, 0x80, 0xdf, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3b, 0xbb, 0xd4, 0xff, 0xbd, 0x00, 0xd0, 0xf0, 0xff, 0x04, 0x32, 0xc0, 0xda, 0xff, 0x7f, 0x81, 0x81, 0xff, 0x80, 0x80, 0x80, 0xff, 
+  0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x94, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5e, 0xa2, 0xb1, 0xff, 0xbf, 0x00, 0xd0, 0xf0, 
+  0xff, 0x00, 0x56, 0xa7, 0xb8, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xa4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 
+  0x63, 0x9b, 0xa7, 0xff, 0x8e, 0x60, 0xa1, 0xaf, 0xff, 0x00, 0x46, 0xb4, 0xc9, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x45, 0xb7, 0xce, 0xff, 0x8e, 0x60, 0xa1, 0xaf, 0xff, 0x00, 0x61, 0x9d, 
+  0xaa, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x03, 0x81, 0x81, 0x81, 0x50, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0xdf, 0x92, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 
+  0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x92, 0x80, 0x80, 0x80, 0xff, 0x02, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x81, 0x81, 0x13, 0x80, 0x80, 0x80, 0x94, 0x93, 0x80, 
+  0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x93, 0x80, 0x80, 0x80, 0xff, 0x01, 0x80, 0x80, 0x80, 0xa4, 0x84, 0x84, 0x84, 0x08, 
+  0x90, 0x87, 0x87, 0x87, 0x08, 0x00, 0x85, 0x85, 0x85, 0x13, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x23, 0x91, 0x87, 0x87, 0x87, 0x08, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 
+  0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 
+  0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0xa2, 0xb2, 0xff, 0x9f, 0x00, 0xd0, 0xf0, 0xff, 0x00, 0x5d, 0xa8, 0xbb, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x74, 0x8b, 0x91, 0xff, 0x9f, 0x61, 0x9e, 0xab, 0xff, 0x00, 0x73, 
+  0x8e, 0x94, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0xa5, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 
+  0x1b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x86, 0x0b, 0xa5, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x1b, 0x91, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -538,8 +552,7 @@ const lv_img_dsc_t ahead_128px = {
   .header.always_zero = 0,
   .header.w = 76,
   .header.h = 128,
-  .data_size = 9728 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( ahead_128px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = ahead_128px_map,
 };
-
@@ -42,6 +42,8 @@ LV_IMG_DECLARE(osmand_64px);
 
 // declare callback functions
 static void enter_osmand_app_event_cb( lv_obj_t * obj, lv_event_t event );
+static void osmand_app_create_cb( void );
+static void osmand_app_destroy_cb( void );
 
 // setup routine for example app
 void osmand_app_setup( void ) {
@@ -52,10 +54,26 @@ void osmand_app_setup( void ) {
 
 //    osmand_widget = widget_register( "OsmAnd", &osmand_64px, enter_osmand_app_event_cb );
 
-    // init main tile, see example_app_main.cpp and example_app_setup.cpp
+    // the main tile is build on the first use and deleted when not used for a while,
+    // the bluetooth callback is needed before and registered now
+    osmand_app_main_register_cb();
+    mainbar_add_app_tile_lifecycle_cb( osmand_app_main_tile_num, osmand_app_create_cb, osmand_app_destroy_cb );
+}
+
+/*
+ * init main tile, see osmand_app_main.cpp
+ */
+static void osmand_app_create_cb( void ) {
     osmand_app_main_setup( osmand_app_main_tile_num );
 }
 
+/*
+ * forget all objects, the tile is already cleaned
+ */
+static void osmand_app_destroy_cb( void ) {
+    osmand_app_main_destroy();
+}
+
 uint32_t osmand_app_get_app_main_tile_num( void ) {
     return( osmand_app_main_tile_num );
 }
@@ -33,7 +33,7 @@
 
 #include "hardware/display.h"
 #include "hardware/blectl.h"
-#include "hardware/json_psram_allocator.h"
+#include "hardware/json_msg.h"
 #include "hardware/powermgm.h"
 
 lv_obj_t *osmand_app_main_tile = NULL;
@@ -46,6 +46,7 @@ lv_obj_t *osmand_app_info_label = NULL;
 
 lv_task_t * _osmand_app_task;
 
+static const char *osmand_app_info = "no bluetooth connection";
 static bool osmand_active = false;
 static bool osmand_block_return_maintile = false;
 
@@ -90,8 +91,9 @@ struct direction_t direction[] = {
 };
 
 static void exit_osmand_app_main_event_cb( lv_obj_t * obj, lv_event_t event );
+static void osmand_app_update_info( void );
 bool osmand_bluetooth_message_event_cb( EventBits_t event, void *arg );
-void osmand_bluetooth_message_msg_pharse( const char* msg );
+void osmand_bluetooth_message_msg_pharse( JsonDocument &doc );
 const lv_img_dsc_t *osmand_find_direction_img( const char * msg );
 void osmand_activate_cb( void );
 void osmand_hibernate_cb( void );
@@ -140,13 +142,24 @@ void osmand_app_main_setup( uint32_t tile_num ) {
 
     osmand_app_info_label = lv_label_create( osmand_app_main_tile, NULL);
     lv_obj_add_style( osmand_app_info_label, LV_OBJ_PART_MAIN, &osmand_app_main_style  );
-    lv_label_set_text( osmand_app_info_label, "no bluetooth connection");
+    lv_label_set_text( osmand_app_info_label, osmand_app_info );
     lv_obj_align( osmand_app_info_label, osmand_app_distance_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
 
     mainbar_add_tile_activate_cb( tile_num, osmand_activate_cb );
     mainbar_add_tile_hibernate_cb( tile_num, osmand_hibernate_cb );
+}
+
+void osmand_app_main_destroy( void ) {
+    lv_style_reset( &osmand_app_main_style );
+    lv_style_reset( &osmand_app_distance_style );
+    osmand_app_main_tile = NULL;
+    osmand_app_direction_img = NULL;
+    osmand_app_distance_label = NULL;
+    osmand_app_info_label = NULL;
+}
 
-    blectl_register_cb( BLECTL_MSG | BLECTL_CONNECT | BLECTL_DISCONNECT , osmand_bluetooth_message_event_cb, "OsmAnd main" );
+void osmand_app_main_register_cb( void ) {
+    blectl_register_cb( BLECTL_MSG_JSON | BLECTL_CONNECT | BLECTL_DISCONNECT , osmand_bluetooth_message_event_cb, "OsmAnd main" );
 }
 
 static void exit_osmand_app_main_event_cb( lv_obj_t * obj, lv_event_t event ) {
@@ -159,56 +172,64 @@ static void exit_osmand_app_main_event_cb( lv_obj_t * obj, lv_event_t event ) {
 
 bool osmand_bluetooth_message_event_cb( EventBits_t event, void *arg ) {
     switch( event ) {
-        case BLECTL_MSG:            
-            osmand_bluetooth_message_msg_pharse( (const char*)arg );
+        case BLECTL_MSG_JSON:
+            osmand_bluetooth_message_msg_pharse( *(JsonDocument*)arg );
             break;
         case BLECTL_CONNECT:
-            lv_label_set_text( osmand_app_info_label, "wait for OsmAnd msg");
-            lv_obj_align( osmand_app_info_label, osmand_app_distance_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
+            osmand_app_info = "wait for OsmAnd msg";
+            osmand_app_update_info();
             break;
         case BLECTL_DISCONNECT:     
-            lv_label_set_text( osmand_app_info_label, "no bluetooth connection");
-            lv_obj_align( osmand_app_info_label, osmand_app_distance_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
+            osmand_app_info = "no bluetooth connection";
+            osmand_app_update_info();
             break;
     }
     return( true );
 }
 
-void osmand_bluetooth_message_msg_pharse( const char* msg ) {
-    if ( osmand_active == false ) {
+/*
+ * the tile is only build while the app is in use
+ */
+static void osmand_app_update_info( void ) {
+    if ( osmand_app_info_label == NULL ) {
         return;
     }
+    lv_label_set_text( osmand_app_info_label, osmand_app_info );
+    lv_obj_align( osmand_app_info_label, osmand_app_distance_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
+}
 
-    SpiRamJsonDocument doc( strlen( msg ) * 2 );
-
-    DeserializationError error = deserializeJson( doc, msg );
-    if ( error ) {
-        log_e("bluetooth message deserializeJson() failed: %s", error.c_str() );
+void osmand_bluetooth_message_msg_pharse( JsonDocument &doc ) {
+    if ( osmand_active == false ) {
+        return;
     }
-    else  {
-        if ( doc["t"] && doc["src"] && doc["title"] ) {
-            if ( !strcmp( doc["t"], "notify" ) && !strcmp( doc["src"], "OsmAnd" ) ) {
-                if ( strstr( doc["title"], "?") ) {
-                    const char * distance = doc["title"];
-                    char * direction = strstr( doc["title"], "?");
-                    *direction = '\0';
-                    direction++;
-                    lv_img_set_src( osmand_app_direction_img, osmand_find_direction_img( (const char*)direction ) );
-                    lv_obj_align( osmand_app_direction_img, osmand_app_main_tile, LV_ALIGN_IN_TOP_MID, 0, 32 );
-                    lv_label_set_text( osmand_app_distance_label, distance );
-                    lv_obj_align( osmand_app_distance_label, osmand_app_direction_img, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
-                }
-                else {
-                    lv_label_set_text( osmand_app_info_label, doc["title"] );
-                    lv_obj_align( osmand_app_info_label, osmand_app_distance_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
+
+    if ( doc["t"] && doc["src"] && doc["title"] ) {
+        if ( !strcmp( doc["t"], "notify" ) && !strcmp( doc["src"], "OsmAnd" ) ) {
+            if ( strstr( doc["title"], "?") ) {
+                /*
+                 * the document is shared with other consumers, split a copy of the title
+                 */
+                char distance[ 64 ] = "";
+                strlcpy( distance, doc["title"], sizeof( distance ) );
+                char * direction = strstr( distance, "?");
+                if ( direction == NULL ) {
+                    return;
                 }
+                *direction = '\0';
+                direction++;
+                lv_img_set_src( osmand_app_direction_img, osmand_find_direction_img( (const char*)direction ) );
+                lv_obj_align( osmand_app_direction_img, osmand_app_main_tile, LV_ALIGN_IN_TOP_MID, 0, 32 );
+                lv_label_set_text( osmand_app_distance_label, distance );
+                lv_obj_align( osmand_app_distance_label, osmand_app_direction_img, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
+            }
+            else {
+                lv_label_set_text( osmand_app_info_label, doc["title"] );
+                lv_obj_align( osmand_app_info_label, osmand_app_distance_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
             }
-            powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
         }
-
+        powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
     }
     lv_obj_invalidate( lv_scr_act() );
-    doc.clear();
 }
 
 const lv_img_dsc_t *osmand_find_direction_img( const char * msg ) {
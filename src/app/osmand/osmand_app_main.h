@@ -30,6 +30,19 @@
         const lv_img_dsc_t *img;
     };
 
+    /**
+     * @brief build the main tile, called on the first use of the app
+     *
+     * @param   tile_num    tile number of the main tile
+     */
     void osmand_app_main_setup( uint32_t tile_num );
+    /**
+     * @brief forget all objects of the main tile after the tile is cleaned
+     */
+    void osmand_app_main_destroy( void );
+    /**
+     * @brief register the bluetooth callback, must be called at setup time
+     */
+    void osmand_app_main_register_cb( void );
 
 #endif // _OSMAND_APP_MAIN_H
\ No newline at end of file
@@ -10,271 +10,477 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_POWERMETER_64PX uint8_t powermeter_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x07, 0x92, 0x57, 0x92, 0xa4, 0x92, 0xd7, 0x92, 0xf7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xf7, 0x92, 0xd7, 0x92, 0xa4, 0x92, 0x57, 0x92, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x03, 0x92, 0x68, 0x92, 0xe8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe8, 0x92, 0x6b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x14, 0x92, 0xbf, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xbf, 0x92, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x92, 0x18, 0x92, 0xd8, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xd8, 0x92, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x92, 0x04, 0x92, 0xc7, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xc7, 0x92, 0x04, 0x00, 0x00, 
-  0x00, 0x00, 0x92, 0x78, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x77, 0x00, 0x00, 
-  0x92, 0x0f, 0x92, 0xf0, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xf0, 0x92, 0x0f, 
-  0x92, 0x67, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0x67, 
-  0x92, 0xb0, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xb0, 
-  0x92, 0xe3, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xe3, 
-  0x92, 0xfb, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xfb, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x69, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x89, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0xb6, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0xb6, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xae, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x49, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xad, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0xb6, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xce, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x6d, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x49, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x89, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xd2, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xad, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x8d, 0xff, 0xad, 0xff, 0xad, 0xff, 0xad, 0xff, 0xad, 0xff, 0xad, 0xff, 0xad, 0xff, 0xad, 0xff, 0x8d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb2, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xa9, 0xff, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb2, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x8e, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 
-  0x92, 0xf8, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xf8, 
-  0x92, 0xdb, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xdb, 
-  0x92, 0xa7, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xa7, 
-  0x92, 0x57, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x57, 
-  0x92, 0x04, 0x92, 0xe3, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xe3, 0x92, 0x04, 
-  0x00, 0x00, 0x92, 0x5c, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x5b, 0x00, 0x00, 
-  0x00, 0x00, 0x92, 0x00, 0x92, 0xa8, 0x92, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa8, 0x92, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x92, 0x08, 0x92, 0xbb, 0x92, 0xff, 0x92, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xbb, 0x92, 0x08, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x04, 0x92, 0x93, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x93, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x92, 0x3c, 0x92, 0xc0, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xc0, 0x92, 0x3c, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0x27, 0x92, 0x77, 0x92, 0xa8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xe7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xf3, 0x92, 0xff, 0x92, 0xf4, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xc8, 0x92, 0xa8, 0x92, 0x77, 0x92, 0x27, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9b, 0x92, 0xff, 0x92, 0xff, 0x92, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x92, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xcf, 0x92, 0xff, 0x92, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x92, 0xff, 0x92, 0xff, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x92, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x92, 0xff, 0x92, 0xff, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x92, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x92, 0xff, 0x92, 0xff, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x92, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x92, 0xff, 0x92, 0xff, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x92, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x92, 0xff, 0x92, 0xff, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x92, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x92, 0xff, 0x92, 0xff, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xff, 0x92, 0xff, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x87, 0x92, 0xff, 0x92, 0xf4, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x92, 0xf4, 0x92, 0xff, 0x92, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xbf, 0x92, 0xff, 0x92, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2c, 0x92, 0xeb, 0x92, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x80, 0x92, 0xdf, 0x92, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x54, 0x92, 0xef, 0x92, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x85, 0x00, 0x00, 0x04, 0x92, 0x07, 0x92, 0x57, 0x92, 0xa4, 0x92, 0xd7, 0x92, 0xf7, 0xa9, 0x92, 0xff, 0x04, 0x92, 0xf7, 0x92, 0xd7, 0x92, 0xa4, 0x92, 0x57, 0x92, 0x07, 
+  0x89, 0x00, 0x00, 0x02, 0x92, 0x03, 0x92, 0x68, 0x92, 0xe8, 0xb1, 0x92, 0xff, 0x01, 0x92, 0xe8, 0x92, 0x6b, 0x87, 0x00, 0x00, 0x01, 0x92, 0x14, 0x92, 0xbf, 0x81, 0x92, 0xff, 0x01, 0x6e, 0xff, 
+  0x6d, 0xff, 0xad, 0x49, 0xff, 0x01, 0x6d, 0xff, 0x6e, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xbf, 0x92, 0x14, 0x84, 0x00, 0x00, 0x01, 0x92, 0x18, 0x92, 0xd8, 0x81, 0x92, 0xff, 0xb3, 0x49, 0xff, 
+  0x81, 0x92, 0xff, 0x01, 0x92, 0xd8, 0x92, 0x18, 0x82, 0x00, 0x00, 0x01, 0x92, 0x04, 0x92, 0xc7, 0x81, 0x92, 0xff, 0xb5, 0x49, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xc7, 0x92, 0x04, 0x81, 0x00, 
+  0x00, 0x00, 0x92, 0x78, 0x81, 0x92, 0xff, 0xb7, 0x49, 0xff, 0x81, 0x92, 0xff, 0x04, 0x92, 0x77, 0x00, 0x00, 0x92, 0x0f, 0x92, 0xf0, 0x92, 0xff, 0xb9, 0x49, 0xff, 0x05, 0x92, 0xff, 0x92, 0xf0, 
+  0x92, 0x0f, 0x92, 0x67, 0x92, 0xff, 0x6e, 0xff, 0x86, 0x49, 0xff, 0xac, 0x6d, 0xff, 0x85, 0x49, 0xff, 0x05, 0x6e, 0xff, 0x92, 0xff, 0x92, 0x67, 0x92, 0xb0, 0x92, 0xff, 0x6d, 0xff, 0x84, 0x49, 
+  0xff, 0x00, 0x6e, 0xff, 0xae, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x83, 0x49, 0xff, 0x04, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xb0, 0x92, 0xe3, 0x92, 0xff, 0x84, 0x49, 0xff, 0x00, 0x6e, 0xff, 0xb0, 0x92, 
+  0xff, 0x00, 0x6e, 0xff, 0x83, 0x49, 0xff, 0x03, 0x92, 0xff, 0x92, 0xe3, 0x92, 0xfb, 0x92, 0xff, 0x84, 0x49, 0xff, 0xb2, 0x92, 0xff, 0x83, 0x49, 0xff, 0x01, 0x92, 0xff, 0x92, 0xfb, 0x81, 0x92, 
+  0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0xa2, 0x49, 0xff, 0x00, 0x69, 0xff, 0x87, 0xa9, 0xff, 0x00, 0x89, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x49, 0xff, 0x83, 
+  0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x81, 0x49, 0xff, 0x00, 0x92, 0xff, 0x82, 0xff, 0xff, 0x00, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 
+  0x00, 0xdb, 0xff, 0x83, 0x49, 0xff, 0x00, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x00, 0x92, 0xff, 0x82, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x83, 0xff, 0xff, 0x00, 0x6e, 0xff, 0x81, 0x49, 0xff, 0x00, 0x89, 
+  0xff, 0x81, 0xa9, 0xff, 0x83, 0xff, 0xff, 0x00, 0xd6, 0xff, 0x81, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 
+  0x92, 0xff, 0x81, 0x49, 0xff, 0x04, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0xb6, 0xff, 0xff, 0xff, 0x82, 0x49, 0xff, 0x01, 0xb7, 0xff, 0xff, 0xff, 0x81, 0x6d, 0xff, 0x01, 0xff, 0xff, 0xb7, 0xff, 
+  0x82, 0x49, 0xff, 0x05, 0xdb, 0xff, 0x92, 0xff, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x81, 0x49, 0xff, 0x01, 0x6d, 0xff, 0xb6, 0xff, 0x81, 0x6e, 0xff, 0x01, 0xdb, 0xff, 0xff, 0xff, 
+  0x81, 0x49, 0xff, 0x00, 0x89, 0xff, 0x81, 0xa9, 0xff, 0x00, 0xff, 0xff, 0x82, 0xd2, 0xff, 0x00, 0xae, 0xff, 0x81, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 
+  0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x02, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 0x82, 0x49, 0xff, 0x01, 0xff, 0xff, 0xb6, 0xff, 0x81, 0x49, 0xff, 0x01, 0xff, 0xff, 0xb7, 
+  0xff, 0x81, 0x49, 0xff, 0x01, 0xb7, 0xff, 0xff, 0xff, 0x86, 0x49, 0xff, 0x01, 0xff, 0xff, 0xb6, 0xff, 0x85, 0x49, 0xff, 0x01, 0x92, 0xff, 0xff, 0xff, 0x81, 0x49, 0xff, 0x00, 0x89, 0xff, 0x81, 
+  0xa9, 0xff, 0x00, 0xff, 0xff, 0x85, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x02, 0x49, 0xff, 
+  0xb7, 0xff, 0xff, 0xff, 0x82, 0x49, 0xff, 0x01, 0xff, 0xff, 0xb7, 0xff, 0x81, 0x49, 0xff, 0x01, 0xff, 0xff, 0x92, 0xff, 0x81, 0x49, 0xff, 0x01, 0x92, 0xff, 0xff, 0xff, 0x85, 0x49, 0xff, 0x02, 
+  0x92, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x83, 0x49, 0xff, 0x03, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x81, 0x49, 0xff, 0x00, 0x89, 0xff, 0x81, 0xa9, 0xff, 0x83, 0xff, 0xff, 0x00, 0xd2, 
+  0xff, 0x81, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x02, 0x49, 0xff, 0xb7, 0xff, 0xff, 0xff, 
+  0x82, 0x49, 0xff, 0x01, 0xff, 0xff, 0xb7, 0xff, 0x81, 0x49, 0xff, 0x01, 0xff, 0xff, 0x92, 0xff, 0x81, 0x49, 0xff, 0x01, 0x92, 0xff, 0xff, 0xff, 0x84, 0x49, 0xff, 0x02, 0x92, 0xff, 0xff, 0xff, 
+  0xb6, 0xff, 0x84, 0x49, 0xff, 0x03, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x81, 0x49, 0xff, 0x00, 0x89, 0xff, 0x81, 0xa9, 0xff, 0x00, 0xad, 0xff, 0x81, 0xa9, 0xff, 0x01, 0xfb, 0xff, 
+  0xff, 0xff, 0x81, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x02, 0x49, 0xff, 0xb6, 0xff, 0xff, 
+  0xff, 0x82, 0x49, 0xff, 0x01, 0xff, 0xff, 0xb6, 0xff, 0x81, 0x49, 0xff, 0x01, 0xff, 0xff, 0xb7, 0xff, 0x81, 0x49, 0xff, 0x01, 0xb7, 0xff, 0xff, 0xff, 0x83, 0x49, 0xff, 0x02, 0x92, 0xff, 0xff, 
+  0xff, 0xb6, 0xff, 0x87, 0x49, 0xff, 0x04, 0x6d, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x89, 0xff, 0x84, 0xa9, 0xff, 0x01, 0xce, 0xff, 0xff, 0xff, 0x81, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 
+  0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x07, 0x49, 0xff, 0x6d, 0xff, 0xff, 0xff, 0x92, 0xff, 0x49, 0xff, 0x92, 0xff, 0xff, 0xff, 
+  0x6e, 0xff, 0x81, 0x49, 0xff, 0x01, 0xdb, 0xff, 0xff, 0xff, 0x81, 0x49, 0xff, 0x01, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x49, 0xff, 0x02, 0x92, 0xff, 0xff, 0xff, 0x92, 0xff, 0x88, 0x49, 0xff, 0x04, 
+  0x6e, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x89, 0xff, 0x84, 0xa9, 0xff, 0x01, 0xd7, 0xff, 0xff, 0xff, 0x81, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 
+  0xff, 0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x81, 0x49, 0xff, 0x04, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x82, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x83, 0xff, 
+  0xff, 0x00, 0x6d, 0xff, 0x82, 0x49, 0xff, 0x84, 0xff, 0xff, 0x00, 0x92, 0xff, 0x81, 0x49, 0xff, 0x01, 0xb7, 0xff, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xff, 0xff, 0xdb, 0xff, 0x81, 0x49, 0xff, 
+  0x04, 0x89, 0xff, 0xa9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x00, 0xd6, 0xff, 0x81, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 
+  0x83, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x82, 0x49, 0xff, 0x02, 0x6e, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x85, 0x49, 0xff, 0x81, 0x92, 0xff, 0x84, 0x49, 0xff, 0x84, 0x92, 0xff, 0x00, 
+  0x6d, 0xff, 0x82, 0x49, 0xff, 0x00, 0x92, 0xff, 0x81, 0xb7, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x00, 0x89, 0xff, 0x81, 0xa9, 0xff, 0x00, 0xd2, 0xff, 0x81, 0xd6, 0xff, 0x00, 0xad, 0xff, 
+  0x82, 0xa9, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x84, 0x49, 0xff, 0x82, 0x92, 0xff, 0xa3, 0x6d, 0xff, 0x00, 0x8d, 0xff, 0x86, 0xad, 0xff, 0x00, 0x8d, 
+  0xff, 0x82, 0x92, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x84, 0x49, 0xff, 0xb2, 0x92, 0xff, 0x83, 0x49, 0xff, 0x83, 0x92, 0xff, 0x84, 0x49, 0xff, 0x00, 0x6d, 0xff, 0xb0, 
+  0x92, 0xff, 0x00, 0x6d, 0xff, 0x83, 0x49, 0xff, 0x83, 0x92, 0xff, 0x86, 0x49, 0xff, 0x00, 0x6e, 0xff, 0xac, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x85, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 
+  0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 
+  0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6e, 0xff, 0xb2, 0x92, 0xff, 0x83, 0x49, 0xff, 0x83, 0x92, 0xff, 0x82, 0x49, 0xff, 0x00, 
+  0x6d, 0xff, 0x81, 0x92, 0xff, 0x93, 0xb7, 0xff, 0x00, 0xb2, 0xff, 0x85, 0x8e, 0xff, 0x01, 0x92, 0xff, 0xb6, 0xff, 0x92, 0xb7, 0xff, 0x02, 0xb6, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x82, 0x49, 0xff, 
+  0x83, 0x92, 0xff, 0x82, 0x49, 0xff, 0x81, 0x92, 0xff, 0x93, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x87, 0xa9, 0xff, 0x00, 0xad, 0xff, 0x93, 0xff, 0xff, 0x01, 0xb6, 0xff, 0x92, 0xff, 0x82, 0x49, 0xff, 
+  0x83, 0x92, 0xff, 0x82, 0x49, 0xff, 0x81, 0x92, 0xff, 0x93, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x87, 0xa9, 0xff, 0x00, 0xad, 0xff, 0x93, 0xff, 0xff, 0x01, 0xb6, 0xff, 0x92, 0xff, 0x82, 0x49, 0xff, 
+  0x83, 0x92, 0xff, 0x82, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x81, 0x92, 0xff, 0x93, 0xb7, 0xff, 0x00, 0xb2, 0xff, 0x85, 0x8e, 0xff, 0x01, 0x92, 0xff, 0xb6, 0xff, 0x92, 0xb7, 0xff, 0x02, 0xb6, 0xff, 
+  0x92, 0xff, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x83, 0x92, 0xff, 0x83, 0x49, 0xff, 0x00, 0x6e, 0xff, 0xb1, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x83, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 
+  0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x83, 0x92, 0xff, 0xbb, 0x49, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xf8, 0x92, 0xff, 0xbb, 
+  0x49, 0xff, 0x03, 0x92, 0xff, 0x92, 0xf8, 0x92, 0xdb, 0x92, 0xff, 0x8b, 0x49, 0xff, 0x02, 0x6e, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x02, 0x6d, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x82, 
+  0x49, 0xff, 0x00, 0x6d, 0xff, 0x81, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x02, 0x6e, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x82, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x81, 0x92, 0xff, 0x83, 0x49, 
+  0xff, 0x81, 0x6e, 0xff, 0x00, 0x6d, 0xff, 0x8c, 0x49, 0xff, 0x04, 0x92, 0xff, 0x92, 0xdb, 0x92, 0xa7, 0x92, 0xff, 0x6d, 0xff, 0x89, 0x49, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6d, 
+  0xff, 0x81, 0x49, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x81, 0x49, 0xff, 0x83, 0x92, 0xff, 0x81, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x81, 0x49, 0xff, 0x82, 
+  0x92, 0xff, 0x00, 0x6e, 0xff, 0x81, 0x49, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x92, 0xff, 0x8b, 0x49, 0xff, 0x03, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xa7, 0x92, 0x57, 0x81, 0x92, 0xff, 0x89, 0x49, 0xff, 
+  0x00, 0x6e, 0xff, 0x82, 0x92, 0xff, 0x02, 0x6e, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x83, 0x92, 0xff, 0x81, 0x49, 0xff, 0x83, 0x92, 0xff, 0x81, 0x49, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x92, 0xff, 0x02, 
+  0x6e, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x83, 0x92, 0xff, 0x81, 0x49, 0xff, 0x83, 0x92, 0xff, 0x00, 0x6d, 0xff, 0x8a, 0x49, 0xff, 0x81, 0x92, 0xff, 0x04, 0x92, 0x57, 0x92, 0x04, 0x92, 0xe3, 0x92, 
+  0xff, 0x6d, 0xff, 0x88, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6d, 0xff, 0x81, 0x49, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6d, 0xff, 0x81, 0x49, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x92, 
+  0xff, 0x81, 0x49, 0xff, 0x00, 0x6d, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6d, 0xff, 0x81, 0x49, 0xff, 0x82, 0x92, 0xff, 0x00, 0x6e, 0xff, 0x81, 0x49, 0xff, 0x00, 0x6e, 0xff, 0x82, 0x92, 0xff, 0x8a, 
+  0x49, 0xff, 0x05, 0x6d, 0xff, 0x92, 0xff, 0x92, 0xe3, 0x92, 0x04, 0x00, 0x00, 0x92, 0x5c, 0x81, 0x92, 0xff, 0x89, 0x49, 0xff, 0x81, 0x6d, 0xff, 0x84, 0x49, 0xff, 0x81, 0x6d, 0xff, 0x84, 0x49, 
+  0xff, 0x00, 0x6d, 0xff, 0x84, 0x49, 0xff, 0x81, 0x6d, 0xff, 0x83, 0x49, 0xff, 0x81, 0x6d, 0xff, 0x83, 0x49, 0xff, 0x81, 0x6e, 0xff, 0x8b, 0x49, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0x5b, 0x82, 
+  0x00, 0x00, 0x00, 0x92, 0xa8, 0x81, 0x92, 0xff, 0xb5, 0x49, 0xff, 0x81, 0x92, 0xff, 0x00, 0x92, 0xa8, 0x83, 0x00, 0x00, 0x01, 0x92, 0x08, 0x92, 0xbb, 0x81, 0x92, 0xff, 0x00, 0x6d, 0xff, 0xb1, 
+  0x49, 0xff, 0x00, 0x6d, 0xff, 0x81, 0x92, 0xff, 0x01, 0x92, 0xbb, 0x92, 0x08, 0x84, 0x00, 0x00, 0x01, 0x92, 0x04, 0x92, 0x93, 0x82, 0x92, 0xff, 0x01, 0x6e, 0xff, 0x6d, 0xff, 0xab, 0x49, 0xff, 
+  0x01, 0x6d, 0xff, 0x6e, 0xff, 0x82, 0x92, 0xff, 0x01, 0x92, 0x93, 0x92, 0x04, 0x87, 0x00, 0x00, 0x01, 0x92, 0x3c, 0x92, 0xc0, 0xb1, 0x92, 0xff, 0x01, 0x92, 0xc0, 0x92, 0x3c, 0x8b, 0x00, 0x00, 
+  0x02, 0x92, 0x27, 0x92, 0x77, 0x92, 0xa8, 0x88, 0x92, 0xc8, 0x00, 0x92, 0xe7, 0x81, 0x92, 0xff, 0x88, 0x92, 0xc8, 0x81, 0x92, 0xff, 0x00, 0x92, 0xe8, 0x87, 0x92, 0xc8, 0x02, 0x92, 0xf3, 0x92, 
+  0xff, 0x92, 0xf4, 0x88, 0x92, 0xc8, 0x02, 0x92, 0xa8, 0x92, 0x77, 0x92, 0x27, 0x99, 0x00, 0x00, 0x00, 0x92, 0x9b, 0x81, 0x92, 0xff, 0x00, 0x92, 0x03, 0x87, 0x00, 0x00, 0x81, 0x92, 0xff, 0x00, 
+  0x92, 0x94, 0x87, 0x00, 0x00, 0x02, 0x92, 0xcf, 0x92, 0xff, 0x92, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x81, 0x92, 0xff, 0x00, 0x92, 0x04, 0x87, 0x00, 0x00, 0x81, 0x92, 0xff, 0x00, 0x92, 
+  0x94, 0x87, 0x00, 0x00, 0x02, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x81, 0x92, 0xff, 0x00, 0x92, 0x04, 0x87, 0x00, 0x00, 0x81, 0x92, 0xff, 0x00, 0x92, 0x94, 
+  0x87, 0x00, 0x00, 0x02, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x81, 0x92, 0xff, 0x00, 0x92, 0x04, 0x87, 0x00, 0x00, 0x81, 0x92, 0xff, 0x00, 0x92, 0x94, 0x87, 
+  0x00, 0x00, 0x02, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x81, 0x92, 0xff, 0x00, 0x92, 0x04, 0x87, 0x00, 0x00, 0x81, 0x92, 0xff, 0x00, 0x92, 0x94, 0x87, 0x00, 
+  0x00, 0x02, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x81, 0x92, 0xff, 0x00, 0x92, 0x04, 0x87, 0x00, 0x00, 0x81, 0x92, 0xff, 0x00, 0x92, 0x94, 0x87, 0x00, 0x00, 
+  0x02, 0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x92, 0x9c, 0x81, 0x92, 0xff, 0x00, 0x92, 0x04, 0x87, 0x00, 0x00, 0x81, 0x92, 0xff, 0x00, 0x92, 0x94, 0x87, 0x00, 0x00, 0x02, 
+  0x92, 0xd0, 0x92, 0xff, 0x92, 0xcf, 0xa5, 0x00, 0x00, 0x02, 0x92, 0x87, 0x92, 0xff, 0x92, 0xf4, 0x88, 0x00, 0x00, 0x02, 0x92, 0xf4, 0x92, 0xff, 0x92, 0x84, 0x87, 0x00, 0x00, 0x02, 0x92, 0xbf, 
+  0x92, 0xff, 0x92, 0xbc, 0xa5, 0x00, 0x00, 0x02, 0x92, 0x2c, 0x92, 0xeb, 0x92, 0x87, 0x88, 0x00, 0x00, 0x02, 0x92, 0x80, 0x92, 0xdf, 0x92, 0x27, 0x87, 0x00, 0x00, 0x02, 0x92, 0x54, 0x92, 0xef, 
+  0x92, 0x54, 0x92, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x07, 0x10, 0x84, 0x57, 0x10, 0x84, 0xa4, 0x10, 0x84, 0xd7, 0x10, 0x84, 0xf7, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xf7, 0x10, 0x84, 0xd7, 0x10, 0x84, 0xa4, 0x10, 0x84, 0x57, 0x10, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x10, 0x84, 0x68, 0x10, 0x84, 0xe8, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe8, 0x10, 0x84, 0x6b, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x14, 0x10, 0x84, 0xbf, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0xcb, 0x5a, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x29, 0x4a, 0xff, 0xcb, 0x5a, 0xff, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xbf, 0x10, 0x84, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x18, 0x10, 0x84, 0xd8, 0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x8a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xd8, 0x10, 0x84, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x10, 0x84, 0x04, 0x10, 0x84, 0xc7, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xc7, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x10, 0x84, 0x78, 0x10, 0x84, 0xff, 0xaf, 0x7b, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0xaf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x77, 0x00, 0x00, 0x00, 
-  0x10, 0x84, 0x0f, 0x10, 0x84, 0xf0, 0x10, 0x84, 0xff, 0x6a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x6a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xf0, 0x10, 0x84, 0x0f, 
-  0x10, 0x84, 0x67, 0x10, 0x84, 0xff, 0x6e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x8a, 0x52, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x6e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x67, 
-  0x10, 0x84, 0xb0, 0x10, 0x84, 0xff, 0xab, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x2c, 0x63, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4d, 0x6b, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xab, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xb0, 
-  0x10, 0x84, 0xe3, 0x10, 0x84, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x2c, 0x63, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe3, 
-  0x10, 0x84, 0xfb, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x8b, 0xff, 0xcf, 0x8b, 0xff, 0xcf, 0x8b, 0xff, 0xcf, 0x8b, 0xff, 0xcf, 0x8b, 0xff, 0xcf, 0x8b, 0xff, 0xcf, 0x83, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xfb, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xe8, 0x41, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x5a, 0xff, 0x08, 0xa2, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0x8a, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xaf, 0x7b, 0xff, 0x1c, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x18, 0xc6, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x18, 0xc6, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xd7, 0xbd, 0xff, 0x1c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0xfb, 0xde, 0xff, 0x71, 0x8c, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xeb, 0x5a, 0xff, 0xba, 0xd6, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x9a, 0xd6, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x82, 0xff, 0x08, 0xaa, 0xff, 0x29, 0xaa, 0xff, 0x1c, 0xf7, 0xff, 0x1c, 0xf7, 0xff, 0x1c, 0xf7, 0xff, 0x1c, 0xf7, 0xff, 0x14, 0xcd, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x83, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x7d, 0xef, 0xff, 0x75, 0xad, 0xff, 0x08, 0x42, 0xff, 0xf4, 0xa4, 0xff, 0x9e, 0xf7, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x75, 0xad, 0xff, 0x5d, 0xef, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0x5d, 0xef, 0xff, 0x55, 0xad, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x18, 0xc6, 0xff, 0x30, 0x84, 0xff, 0x6a, 0x52, 0xff, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xab, 0x5a, 0xff, 0xb3, 0x9c, 0xff, 0x2c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x59, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x49, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x30, 0xbc, 0xff, 0x30, 0xbc, 0xff, 0x30, 0xbc, 0xff, 0x2c, 0xb3, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x30, 0x84, 0xff, 0xbf, 0xff, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x9e, 0xf7, 0xff, 0xb2, 0x94, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x1c, 0xe7, 0xff, 0x96, 0xb5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x96, 0xb5, 0xff, 0xfc, 0xe6, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x7e, 0xf7, 0xff, 0x92, 0x94, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x71, 0x8c, 0xff, 0xbf, 0xff, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x49, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x28, 0xaa, 0xff, 0x28, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x34, 0xa5, 0xff, 0x5d, 0xef, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x1c, 0xe7, 0xff, 0x76, 0xb5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x9e, 0xf7, 0xff, 0x71, 0x8c, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x71, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x71, 0x8c, 0xff, 0xdf, 0xff, 0xff, 0xeb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x96, 0xb5, 0xff, 0xf7, 0xbd, 0xff, 0x1c, 0xe7, 0xff, 0x34, 0xa5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x49, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x3c, 0xf7, 0xff, 0xaf, 0xbb, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x55, 0xad, 0xff, 0x5d, 0xef, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x1c, 0xe7, 0xff, 0x76, 0xb5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xbe, 0xf7, 0xff, 0x31, 0x8c, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x31, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x9e, 0xf7, 0xff, 0x92, 0x94, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x55, 0xad, 0xff, 0xb7, 0xbd, 0xff, 0x5d, 0xef, 0xff, 0xf8, 0xc5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xeb, 0xb2, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x38, 0xde, 0xff, 0x5d, 0xf7, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x92, 0x94, 0xff, 0x9e, 0xf7, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x5d, 0xef, 0xff, 0x14, 0xa5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x5d, 0xef, 0xff, 0x34, 0xa5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x34, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x30, 0x84, 0xff, 0x9e, 0xf7, 0xff, 0xb3, 0x9c, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xeb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x6e, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xa9, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0xdf, 0xff, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x8e, 0x73, 0xff, 0xdf, 0xff, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x18, 0xc6, 0xff, 0xba, 0xd6, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xba, 0xd6, 0xff, 0x18, 0xc6, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x51, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 0x72, 0x94, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x28, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x34, 0xcd, 0xff, 0xbe, 0xff, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x55, 0xad, 0xff, 0x9e, 0xf7, 0xff, 0x7a, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0x96, 0xb5, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xcb, 0x5a, 0xff, 0x5d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x5d, 0xef, 0xff, 0xcb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xdf, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x51, 0x8c, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x76, 0xb5, 0xff, 0xfb, 0xde, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0xbe, 0xf7, 0xff, 0xf7, 0xbd, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x96, 0xd5, 0xff, 0x1c, 0xf7, 0xff, 0x79, 0xe6, 0xff, 0xbb, 0xee, 0xff, 0xdf, 0xff, 0xff, 0xf3, 0xcc, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x2d, 0x6b, 0xff, 0x51, 0x8c, 0xff, 0x4d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x30, 0x84, 0xff, 0x30, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x30, 0x84, 0xff, 0x30, 0x84, 0xff, 0x30, 0x84, 0xff, 0x30, 0x84, 0xff, 0x30, 0x84, 0xff, 0xeb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x31, 0x8c, 0xff, 0x55, 0xad, 0xff, 0x35, 0xad, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x7a, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x10, 0xbc, 0xff, 0x14, 0xcd, 0xff, 0xb2, 0xc4, 0xff, 0xcb, 0xb2, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xa2, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x6a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xec, 0x62, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xaa, 0x8a, 0xff, 0xaa, 0xa2, 0xff, 0xaa, 0xa2, 0xff, 0xaa, 0xa2, 0xff, 0xaa, 0xa2, 0xff, 0xaa, 0xa2, 0xff, 0xaa, 0xa2, 0xff, 0xaa, 0x9a, 0xff, 0xcb, 0x7a, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xeb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xf0, 0x83, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xeb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0x4d, 0x6b, 0xff, 0xaf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0xcf, 0x7b, 0xff, 0x6d, 0x6b, 0xff, 0x8a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x6a, 0x52, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x2d, 0x6b, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xec, 0x62, 0xff, 0x10, 0x84, 0xff, 0x51, 0x8c, 0xff, 0x76, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x71, 0x9c, 0xff, 0x8e, 0x93, 0xff, 0x8e, 0x93, 0xff, 0x8e, 0x93, 0xff, 0x8e, 0x93, 0xff, 0x8e, 0x93, 0xff, 0x8e, 0x93, 0xff, 0x8e, 0x93, 0xff, 0x14, 0xad, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0xd3, 0x9c, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xe6, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcb, 0xb2, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xe6, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0x08, 0xaa, 0xff, 0xcb, 0xb2, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xeb, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x51, 0x8c, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x10, 0x94, 0xff, 0x8e, 0x93, 0xff, 0x6e, 0x93, 0xff, 0x6e, 0x93, 0xff, 0x6e, 0x93, 0xff, 0x6e, 0x93, 0xff, 0x6e, 0x93, 0xff, 0x8e, 0x93, 0xff, 0xb2, 0x9c, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0xb2, 0x94, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x0c, 0x63, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x69, 0x4a, 0xff, 0x28, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 
-  0x10, 0x84, 0xf8, 0xf0, 0x83, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xf0, 0x83, 0xff, 0x10, 0x84, 0xf8, 
-  0x10, 0x84, 0xdb, 0x10, 0x84, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x4d, 0x6b, 0xff, 0xcf, 0x7b, 0xff, 0x4d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x0c, 0x63, 0xff, 0xcf, 0x7b, 0xff, 0x8e, 0x73, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xaa, 0x52, 0xff, 0xef, 0x7b, 0xff, 0xf0, 0x83, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x4d, 0x6b, 0xff, 0xcf, 0x7b, 0xff, 0x4d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xec, 0x62, 0xff, 0xcf, 0x7b, 0xff, 0x8e, 0x73, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x29, 0x4a, 0xff, 0x4d, 0x6b, 0xff, 0x8e, 0x73, 0xff, 0xaa, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x29, 0x4a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xdb, 
-  0x10, 0x84, 0xa7, 0x10, 0x84, 0xff, 0xcb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x0c, 0x63, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xec, 0x62, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x6d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0xec, 0x62, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x69, 0x4a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xf0, 0x83, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xcb, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa7, 
-  0x10, 0x84, 0x57, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x6d, 0x6b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x4d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0xeb, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xae, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x6a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x4d, 0x6b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x6d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0xab, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x57, 
-  0x10, 0x84, 0x04, 0x10, 0x84, 0xe3, 0x10, 0x84, 0xff, 0xab, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xaa, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x0c, 0x63, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xaa, 0x52, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x2c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x6e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x29, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xab, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe3, 0x10, 0x84, 0x04, 
-  0x00, 0x00, 0x00, 0x10, 0x84, 0x5c, 0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x0c, 0x63, 0xff, 0x8a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0x0c, 0x63, 0xff, 0xcb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0xaa, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x0c, 0x63, 0xff, 0x8a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0x0c, 0x63, 0xff, 0xcb, 0x5a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0x2d, 0x6b, 0xff, 0x4d, 0x6b, 0xff, 0x6a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x5b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xa8, 0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa8, 0xef, 0x7b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x08, 0x10, 0x84, 0xbb, 0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0xec, 0x62, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0xec, 0x62, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xbb, 0x10, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x04, 0x10, 0x84, 0x93, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x2d, 0x6b, 0xff, 0xab, 0x5a, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0xab, 0x5a, 0xff, 0x2d, 0x6b, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x93, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x10, 0x84, 0x3c, 0x10, 0x84, 0xc0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xc0, 0x10, 0x84, 0x3c, 0xc7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0x27, 0x10, 0x84, 0x77, 0x10, 0x84, 0xa8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xe7, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xf3, 0x10, 0x84, 0xff, 0x10, 0x84, 0xf4, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xc8, 0x10, 0x84, 0xa8, 0x10, 0x84, 0x77, 0x10, 0x84, 0x27, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9b, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xcf, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x87, 0x10, 0x84, 0xff, 0x10, 0x84, 0xf4, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x00, 0x10, 0x84, 0xf4, 0x10, 0x84, 0xff, 0x10, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xbf, 0x10, 0x84, 0xff, 0x10, 0x84, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x2c, 0x10, 0x84, 0xeb, 0x10, 0x84, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x80, 0x10, 0x84, 0xdf, 0x10, 0x84, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x54, 0x10, 0x84, 0xef, 0x10, 0x84, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x85, 0x00, 0x00, 0x00, 0x04, 0x10, 0x84, 0x07, 0x10, 0x84, 0x57, 0x10, 0x84, 0xa4, 0x10, 0x84, 0xd7, 0x10, 0x84, 0xf7, 0xa9, 0x10, 0x84, 0xff, 0x04, 0x10, 0x84, 0xf7, 
+  0x10, 0x84, 0xd7, 0x10, 0x84, 0xa4, 0x10, 0x84, 0x57, 0x10, 0x84, 0x07, 0x89, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0x03, 0x10, 0x84, 0x68, 0x10, 0x84, 0xe8, 0x82, 0x10, 0x84, 0xff, 0x00, 0xef, 
+  0x7b, 0xff, 0xa9, 0xcf, 0x7b, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x82, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xe8, 0x10, 0x84, 0x6b, 0x87, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x14, 0x10, 0x84, 0xbf, 
+  0x81, 0x10, 0x84, 0xff, 0x02, 0x8e, 0x73, 0xff, 0xcb, 0x5a, 0xff, 0x29, 0x4a, 0xff, 0xab, 0x08, 0x42, 0xff, 0x02, 0x29, 0x4a, 0xff, 0xcb, 0x5a, 0xff, 0x8e, 0x73, 0xff, 0x81, 0x10, 0x84, 0xff, 
+  0x01, 0x10, 0x84, 0xbf, 0x10, 0x84, 0x14, 0x84, 0x00, 0x00, 0x00, 0x04, 0x10, 0x84, 0x18, 0x10, 0x84, 0xd8, 0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x8a, 0x52, 0xff, 0xb1, 0x08, 0x42, 0xff, 0x04, 
+  0x8a, 0x52, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xd8, 0x10, 0x84, 0x18, 0x82, 0x00, 0x00, 0x00, 0x04, 0x10, 0x84, 0x04, 0x10, 0x84, 0xc7, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 
+  0x28, 0x42, 0xff, 0xb3, 0x08, 0x42, 0xff, 0x04, 0x28, 0x42, 0xff, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xc7, 0x10, 0x84, 0x04, 0x81, 0x00, 0x00, 0x00, 0x03, 0x10, 0x84, 0x78, 0x10, 
+  0x84, 0xff, 0xaf, 0x7b, 0xff, 0x28, 0x42, 0xff, 0xb5, 0x08, 0x42, 0xff, 0x08, 0x28, 0x42, 0xff, 0xaf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x77, 0x00, 0x00, 0x00, 0x10, 0x84, 0x0f, 0x10, 
+  0x84, 0xf0, 0x10, 0x84, 0xff, 0x6a, 0x52, 0xff, 0xb7, 0x08, 0x42, 0xff, 0x06, 0x6a, 0x52, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xf0, 0x10, 0x84, 0x0f, 0x10, 0x84, 0x67, 0x10, 0x84, 0xff, 0x6e, 
+  0x73, 0xff, 0x86, 0x08, 0x42, 0xff, 0xac, 0x8a, 0x52, 0xff, 0x00, 0x28, 0x42, 0xff, 0x84, 0x08, 0x42, 0xff, 0x05, 0x6e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x67, 0x10, 0x84, 0xb0, 0x10, 
+  0x84, 0xff, 0xab, 0x5a, 0xff, 0x84, 0x08, 0x42, 0xff, 0x01, 0x2c, 0x63, 0xff, 0xf0, 0x83, 0xff, 0xad, 0x10, 0x84, 0xff, 0x01, 0x4d, 0x6b, 0xff, 0x28, 0x42, 0xff, 0x82, 0x08, 0x42, 0xff, 0x05, 
+  0xab, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xb0, 0x10, 0x84, 0xe3, 0x10, 0x84, 0xff, 0x28, 0x42, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x2c, 0x63, 0xff, 0xb0, 0x10, 0x84, 0xff, 0x00, 0x8e, 
+  0x73, 0xff, 0x82, 0x08, 0x42, 0xff, 0x04, 0x28, 0x42, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xe3, 0x10, 0x84, 0xfb, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x01, 0x28, 0x42, 0xff, 0xf0, 0x83, 
+  0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xa3, 0xcf, 0x7b, 0xff, 0x85, 0xcf, 0x8b, 0xff, 0x01, 0xcf, 0x83, 0xff, 0xcf, 0x7b, 0xff, 0x82, 0x10, 0x84, 0xff, 0x00, 0x8a, 0x52, 0xff, 
+  0x82, 0x08, 0x42, 0xff, 0x03, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xfb, 0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x00, 0x29, 0x4a, 
+  0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xe8, 0x41, 0xff, 0x9d, 0x08, 0x42, 0xff, 0x01, 0x08, 0x5a, 0xff, 0x08, 0xa2, 0xff, 0x86, 0x08, 0xaa, 0xff, 0x01, 0x08, 0x8a, 0xff, 0xcf, 0x7b, 0xff, 0x81, 
+  0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 
+  0x10, 0x84, 0xff, 0x81, 0x08, 0x42, 0xff, 0x04, 0xaf, 0x7b, 0xff, 0x1c, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x10, 0x84, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x18, 0xc6, 0xff, 0x81, 
+  0x7e, 0xf7, 0xff, 0x00, 0x18, 0xc6, 0xff, 0x83, 0x08, 0x42, 0xff, 0x04, 0xd7, 0xbd, 0xff, 0x1c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0xfb, 0xde, 0xff, 0x71, 0x8c, 0xff, 0x82, 0x08, 0x42, 0xff, 0x01, 
+  0xeb, 0x5a, 0xff, 0xba, 0xd6, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x01, 0x9a, 0xd6, 0xff, 0x8e, 0x73, 0xff, 0x81, 0x08, 0x42, 0xff, 0x02, 0x08, 0x82, 0xff, 0x08, 0xaa, 0xff, 0x29, 0xaa, 0xff, 0x83, 
+  0x1c, 0xf7, 0xff, 0x00, 0x14, 0xcd, 0xff, 0x81, 0x08, 0xaa, 0xff, 0x00, 0xcf, 0x83, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 
+  0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x81, 0x08, 0x42, 0xff, 0x05, 0x7d, 0xef, 0xff, 0x75, 0xad, 0xff, 0x08, 0x42, 
+  0xff, 0xf4, 0xa4, 0xff, 0x9e, 0xf7, 0xff, 0x29, 0x4a, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x75, 0xad, 0xff, 0x5d, 0xef, 0xff, 0x81, 0xaa, 0x52, 0xff, 0x01, 0x5d, 0xef, 0xff, 0x55, 0xad, 0xff, 
+  0x82, 0x08, 0x42, 0xff, 0x05, 0x18, 0xc6, 0xff, 0x30, 0x84, 0xff, 0x6a, 0x52, 0xff, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0xff, 0x81, 0x08, 0x42, 0xff, 0x05, 0xab, 0x5a, 0xff, 0xb3, 
+  0x9c, 0xff, 0x2c, 0x63, 0xff, 0x0c, 0x63, 0xff, 0x59, 0xce, 0xff, 0x3d, 0xef, 0xff, 0x81, 0x08, 0x42, 0xff, 0x03, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x49, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x82, 
+  0x30, 0xbc, 0xff, 0x00, 0x2c, 0xb3, 0xff, 0x81, 0x08, 0xaa, 0xff, 0x00, 0xcf, 0x8b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 
+  0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x08, 0x42, 0xff, 0x30, 0x84, 0xff, 0xbf, 0xff, 0xff, 0x82, 0x08, 0x42, 
+  0xff, 0x01, 0x9e, 0xf7, 0xff, 0xb2, 0x94, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x1c, 0xe7, 0xff, 0x96, 0xb5, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x96, 0xb5, 0xff, 0xfc, 0xe6, 0xff, 0x86, 0x08, 
+  0x42, 0xff, 0x01, 0x7e, 0xf7, 0xff, 0x92, 0x94, 0xff, 0x85, 0x08, 0x42, 0xff, 0x01, 0x71, 0x8c, 0xff, 0xbf, 0xff, 0xff, 0x81, 0x08, 0x42, 0xff, 0x03, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x49, 
+  0xaa, 0xff, 0xff, 0xff, 0xff, 0x81, 0x28, 0xaa, 0xff, 0x83, 0x08, 0xaa, 0xff, 0x00, 0xcf, 0x8b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 
+  0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x08, 0x42, 0xff, 0x34, 0xa5, 0xff, 0x5d, 0xef, 0xff, 0x82, 
+  0x08, 0x42, 0xff, 0x01, 0x1c, 0xe7, 0xff, 0x76, 0xb5, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x9e, 0xf7, 0xff, 0x71, 0x8c, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x71, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 
+  0x85, 0x08, 0x42, 0xff, 0x02, 0x71, 0x8c, 0xff, 0xdf, 0xff, 0xff, 0xeb, 0x5a, 0xff, 0x83, 0x08, 0x42, 0xff, 0x03, 0x96, 0xb5, 0xff, 0xf7, 0xbd, 0xff, 0x1c, 0xe7, 0xff, 0x34, 0xa5, 0xff, 0x81, 
+  0x08, 0x42, 0xff, 0x07, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x49, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x3c, 0xf7, 0xff, 0xaf, 0xbb, 0xff, 0x81, 0x08, 0xaa, 0xff, 
+  0x00, 0xcf, 0x8b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 
+  0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x08, 0x42, 0xff, 0x55, 0xad, 0xff, 0x5d, 0xef, 0xff, 0x82, 0x08, 0x42, 0xff, 0x01, 0x1c, 0xe7, 0xff, 0x76, 0xb5, 0xff, 0x81, 0x08, 0x42, 
+  0xff, 0x01, 0xbe, 0xf7, 0xff, 0x31, 0x8c, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x31, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 0x84, 0x08, 0x42, 0xff, 0x02, 0xef, 0x7b, 0xff, 0x9e, 0xf7, 0xff, 0x92, 0x94, 
+  0xff, 0x84, 0x08, 0x42, 0xff, 0x03, 0x55, 0xad, 0xff, 0xb7, 0xbd, 0xff, 0x5d, 0xef, 0xff, 0xf8, 0xc5, 0xff, 0x81, 0x08, 0x42, 0xff, 0x00, 0x08, 0x8a, 0xff, 0x81, 0x08, 0xaa, 0xff, 0x00, 0xeb, 
+  0xb2, 0xff, 0x81, 0x08, 0xaa, 0xff, 0x01, 0x38, 0xde, 0xff, 0x5d, 0xf7, 0xff, 0x81, 0x08, 0xaa, 0xff, 0x00, 0xcf, 0x8b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 
+  0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x08, 0x42, 0xff, 0x92, 0x94, 0xff, 
+  0x9e, 0xf7, 0xff, 0x82, 0x08, 0x42, 0xff, 0x01, 0x5d, 0xef, 0xff, 0x14, 0xa5, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x5d, 0xef, 0xff, 0x34, 0xa5, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x34, 0xa5, 
+  0xff, 0x3d, 0xef, 0xff, 0x83, 0x08, 0x42, 0xff, 0x02, 0x30, 0x84, 0xff, 0x9e, 0xf7, 0xff, 0xb3, 0x9c, 0xff, 0x87, 0x08, 0x42, 0xff, 0x04, 0xeb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0xff, 
+  0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x84, 0x08, 0xaa, 0xff, 0x04, 0x6e, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xa9, 0xff, 0x08, 0xaa, 0xff, 0xcf, 0x8b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 
+  0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x07, 0x08, 
+  0x42, 0xff, 0x8a, 0x52, 0xff, 0xdf, 0xff, 0xff, 0x10, 0x84, 0xff, 0x08, 0x42, 0xff, 0x8e, 0x73, 0xff, 0xdf, 0xff, 0xff, 0x0c, 0x63, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0x18, 0xc6, 0xff, 0xba, 
+  0xd6, 0xff, 0x81, 0x08, 0x42, 0xff, 0x01, 0xba, 0xd6, 0xff, 0x18, 0xc6, 0xff, 0x82, 0x08, 0x42, 0xff, 0x02, 0x51, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 0x72, 0x94, 0xff, 0x88, 0x08, 0x42, 0xff, 0x06, 
+  0x8e, 0x73, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x63, 0xff, 0x08, 0x42, 0xff, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x28, 0xaa, 0xff, 0x82, 0x08, 0xaa, 0xff, 0x01, 0x34, 0xcd, 0xff, 0xbe, 0xff, 0xff, 
+  0x81, 0x08, 0xaa, 0xff, 0x00, 0xcf, 0x8b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 
+  0x83, 0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x81, 0x08, 0x42, 0xff, 0x04, 0x55, 0xad, 0xff, 0x9e, 0xf7, 0xff, 0x7a, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0x96, 0xb5, 0xff, 
+  0x82, 0x08, 0x42, 0xff, 0x01, 0xcb, 0x5a, 0xff, 0x5d, 0xef, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x01, 0x5d, 0xef, 0xff, 0xcb, 0x5a, 0xff, 0x82, 0x08, 0x42, 0xff, 0x01, 0xdf, 0xff, 0xff, 0x7e, 0xf7, 
+  0xff, 0x82, 0xdb, 0xde, 0xff, 0x00, 0x51, 0x8c, 0xff, 0x81, 0x08, 0x42, 0xff, 0x05, 0x76, 0xb5, 0xff, 0xfb, 0xde, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0xbe, 0xf7, 0xff, 0xf7, 0xbd, 0xff, 
+  0x81, 0x08, 0x42, 0xff, 0x07, 0x08, 0x8a, 0xff, 0x08, 0xaa, 0xff, 0x96, 0xd5, 0xff, 0x1c, 0xf7, 0xff, 0x79, 0xe6, 0xff, 0xbb, 0xee, 0xff, 0xdf, 0xff, 0xff, 0xf3, 0xcc, 0xff, 0x81, 0x08, 0xaa, 
+  0xff, 0x00, 0xcf, 0x8b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 
+  0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x82, 0x08, 0x42, 0xff, 0x02, 0x2d, 0x6b, 0xff, 0x51, 0x8c, 0xff, 0x4d, 0x6b, 0xff, 0x85, 0x08, 0x42, 0xff, 0x81, 0x30, 0x84, 0xff, 0x84, 
+  0x08, 0x42, 0xff, 0x84, 0x30, 0x84, 0xff, 0x00, 0xeb, 0x5a, 0xff, 0x82, 0x08, 0x42, 0xff, 0x03, 0x31, 0x8c, 0xff, 0x55, 0xad, 0xff, 0x35, 0xad, 0xff, 0x8e, 0x73, 0xff, 0x82, 0x08, 0x42, 0xff, 
+  0x00, 0x08, 0x7a, 0xff, 0x81, 0x08, 0xaa, 0xff, 0x03, 0x10, 0xbc, 0xff, 0x14, 0xcd, 0xff, 0xb2, 0xc4, 0xff, 0xcb, 0xb2, 0xff, 0x81, 0x08, 0xaa, 0xff, 0x01, 0x08, 0xa2, 0xff, 0xcf, 0x7b, 0xff, 
+  0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0x6a, 0x52, 0xff, 
+  0x82, 0x10, 0x84, 0xff, 0x00, 0xec, 0x62, 0xff, 0xa2, 0xaa, 0x52, 0xff, 0x00, 0xaa, 0x8a, 0xff, 0x85, 0xaa, 0xa2, 0xff, 0x02, 0xaa, 0x9a, 0xff, 0xcb, 0x7a, 0xff, 0xf0, 0x83, 0xff, 0x81, 0x10, 
+  0x84, 0xff, 0x00, 0xeb, 0x5a, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x84, 0x08, 0x42, 0xff, 0x00, 0xcf, 0x7b, 0xff, 0xb0, 0x10, 
+  0x84, 0xff, 0x01, 0xf0, 0x83, 0xff, 0x29, 0x4a, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x84, 0x08, 0x42, 0xff, 0x01, 0x8a, 0x52, 
+  0xff, 0xf0, 0x83, 0xff, 0xaf, 0x10, 0x84, 0xff, 0x00, 0xeb, 0x5a, 0xff, 0x83, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x85, 0x08, 0x42, 0xff, 
+  0x02, 0x49, 0x4a, 0xff, 0x4d, 0x6b, 0xff, 0xaf, 0x7b, 0xff, 0xab, 0xcf, 0x7b, 0xff, 0x01, 0x6d, 0x6b, 0xff, 0x8a, 0x52, 0xff, 0x84, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 
+  0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 
+  0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 
+  0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 
+  0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x84, 0x08, 0x42, 0xff, 0x00, 0x28, 0x42, 0xff, 0xaf, 0x6a, 0x52, 
+  0xff, 0x00, 0x49, 0x4a, 0xff, 0x84, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x01, 0x2d, 0x6b, 0xff, 0xf0, 0x83, 0xff, 
+  0xb0, 0x10, 0x84, 0xff, 0x01, 0x8e, 0x73, 0xff, 0x29, 0x4a, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x82, 0x08, 0x42, 0xff, 0x03, 
+  0xec, 0x62, 0xff, 0x10, 0x84, 0xff, 0x51, 0x8c, 0xff, 0x76, 0xb5, 0xff, 0x92, 0x96, 0xb5, 0xff, 0x00, 0x71, 0x9c, 0xff, 0x86, 0x8e, 0x93, 0xff, 0x00, 0x14, 0xad, 0xff, 0x92, 0x96, 0xb5, 0xff, 
+  0x02, 0xd3, 0x9c, 0xff, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x82, 0x08, 0x42, 0xff, 0x02, 0x8e, 
+  0x73, 0xff, 0x10, 0x84, 0xff, 0x9e, 0xf7, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0x7a, 0xe6, 0xff, 0x87, 0x08, 0xaa, 0xff, 0x01, 0xcb, 0xb2, 0xff, 0xbe, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 
+  0xf3, 0x9c, 0xff, 0x10, 0x84, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x82, 0x08, 0x42, 0xff, 0x02, 0x8e, 0x73, 0xff, 0x10, 0x84, 
+  0xff, 0x7d, 0xef, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0x9a, 0xe6, 0xff, 0x87, 0x08, 0xaa, 0xff, 0x01, 0xcb, 0xb2, 0xff, 0xbe, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0xff, 0x10, 
+  0x84, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x82, 0x08, 0x42, 0xff, 0x02, 0xeb, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x51, 0x8c, 0xff, 
+  0x93, 0x34, 0xa5, 0xff, 0x01, 0x10, 0x94, 0xff, 0x8e, 0x93, 0xff, 0x84, 0x6e, 0x93, 0xff, 0x01, 0x8e, 0x93, 0xff, 0xb2, 0x9c, 0xff, 0x92, 0x34, 0xa5, 0xff, 0x02, 0xb2, 0x94, 0xff, 0x10, 0x84, 
+  0xff, 0x8e, 0x73, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x83, 0x08, 0x42, 0xff, 0x01, 0x0c, 0x63, 0xff, 0xf0, 0x83, 0xff, 0xb0, 
+  0x10, 0x84, 0xff, 0x01, 0x8e, 0x73, 0xff, 0x29, 0x4a, 0xff, 0x82, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x85, 0x08, 0x42, 0xff, 0x00, 0x49, 
+  0x4a, 0xff, 0xae, 0x69, 0x4a, 0xff, 0x00, 0x28, 0x42, 0xff, 0x84, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 
+  0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x00, 0xef, 
+  0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0xef, 0x7b, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x03, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xf8, 0xf0, 0x83, 0xff, 0xbb, 0x08, 0x42, 0xff, 0x04, 
+  0xf0, 0x83, 0xff, 0x10, 0x84, 0xf8, 0x10, 0x84, 0xdb, 0x10, 0x84, 0xff, 0x29, 0x4a, 0xff, 0x8a, 0x08, 0x42, 0xff, 0x02, 0x4d, 0x6b, 0xff, 0xcf, 0x7b, 0xff, 0x4d, 0x6b, 0xff, 0x82, 0x08, 0x42, 
+  0xff, 0x03, 0x0c, 0x63, 0xff, 0xcf, 0x7b, 0xff, 0x8e, 0x73, 0xff, 0x49, 0x4a, 0xff, 0x81, 0x08, 0x42, 0xff, 0x03, 0xaa, 0x52, 0xff, 0xef, 0x7b, 0xff, 0xf0, 0x83, 0xff, 0x0c, 0x63, 0xff, 0x82, 
+  0x08, 0x42, 0xff, 0x02, 0x4d, 0x6b, 0xff, 0xcf, 0x7b, 0xff, 0x4d, 0x6b, 0xff, 0x82, 0x08, 0x42, 0xff, 0x03, 0xec, 0x62, 0xff, 0xcf, 0x7b, 0xff, 0x8e, 0x73, 0xff, 0x49, 0x4a, 0xff, 0x81, 0x08, 
+  0x42, 0xff, 0x03, 0x29, 0x4a, 0xff, 0x4d, 0x6b, 0xff, 0x8e, 0x73, 0xff, 0xaa, 0x52, 0xff, 0x8b, 0x08, 0x42, 0xff, 0x05, 0x29, 0x4a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xdb, 0x10, 0x84, 0xa7, 
+  0x10, 0x84, 0xff, 0xcb, 0x5a, 0xff, 0x89, 0x08, 0x42, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0xec, 0x62, 0xff, 0x08, 0x42, 0xff, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 
+  0x00, 0x6d, 0x6b, 0xff, 0x81, 0x08, 0x42, 0xff, 0x00, 0xcf, 0x7b, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0xec, 0x62, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x0c, 
+  0x63, 0xff, 0x08, 0x42, 0xff, 0x69, 0x4a, 0xff, 0x82, 0x10, 0x84, 0xff, 0x00, 0x8e, 0x73, 0xff, 0x81, 0x08, 0x42, 0xff, 0x00, 0x8e, 0x73, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0xf0, 0x83, 0xff, 
+  0x29, 0x4a, 0xff, 0x8a, 0x08, 0x42, 0xff, 0x05, 0xcb, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa7, 0x10, 0x84, 0x57, 0x10, 0x84, 0xff, 0x8e, 0x73, 0xff, 0x89, 0x08, 0x42, 0xff, 0x00, 0x6d, 
+  0x6b, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x4d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0xeb, 0x5a, 0xff, 0x82, 0x10, 0x84, 0xff, 0x00, 0xae, 0x73, 0xff, 0x81, 0x08, 0x42, 0xff, 0x00, 0xef, 0x7b, 0xff, 
+  0x82, 0x10, 0x84, 0xff, 0x02, 0x6a, 0x52, 0xff, 0x08, 0x42, 0xff, 0x4d, 0x6b, 0xff, 0x82, 0x10, 0x84, 0xff, 0x02, 0x6d, 0x6b, 0xff, 0x08, 0x42, 0xff, 0xab, 0x5a, 0xff, 0x82, 0x10, 0x84, 0xff, 
+  0x00, 0xcf, 0x7b, 0xff, 0x81, 0x08, 0x42, 0xff, 0x00, 0xcf, 0x7b, 0xff, 0x82, 0x10, 0x84, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x8a, 0x08, 0x42, 0xff, 0x06, 0x8e, 0x73, 0xff, 0x10, 0x84, 0xff, 0x10, 
+  0x84, 0x57, 0x10, 0x84, 0x04, 0x10, 0x84, 0xe3, 0x10, 0x84, 0xff, 0xab, 0x5a, 0xff, 0x88, 0x08, 0x42, 0xff, 0x00, 0xaa, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x03, 0x8a, 0x52, 0xff, 0x08, 0x42, 
+  0xff, 0x49, 0x4a, 0xff, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x81, 0x08, 0x42, 0xff, 0x00, 0x0c, 0x63, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x8e, 0x73, 0xff, 0x81, 
+  0x08, 0x42, 0xff, 0x00, 0x8a, 0x52, 0xff, 0x82, 0x10, 0x84, 0xff, 0x03, 0xaa, 0x52, 0xff, 0x08, 0x42, 0xff, 0x28, 0x42, 0xff, 0xef, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x00, 0x2c, 0x63, 0xff, 
+  0x81, 0x08, 0x42, 0xff, 0x00, 0x6e, 0x73, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0xef, 0x7b, 0xff, 0x29, 0x4a, 0xff, 0x89, 0x08, 0x42, 0xff, 0x08, 0xab, 0x5a, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 
+  0xe3, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x10, 0x84, 0x5c, 0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x49, 0x4a, 0xff, 0x88, 0x08, 0x42, 0xff, 0x02, 0x8a, 0x52, 0xff, 0x0c, 0x63, 0xff, 0x8a, 0x52, 
+  0xff, 0x82, 0x08, 0x42, 0xff, 0x02, 0x49, 0x4a, 0xff, 0x0c, 0x63, 0xff, 0xcb, 0x5a, 0xff, 0x83, 0x08, 0x42, 0xff, 0x01, 0x8a, 0x52, 0xff, 0xaa, 0x52, 0xff, 0x83, 0x08, 0x42, 0xff, 0x02, 0x8a, 
+  0x52, 0xff, 0x0c, 0x63, 0xff, 0x8a, 0x52, 0xff, 0x82, 0x08, 0x42, 0xff, 0x02, 0x49, 0x4a, 0xff, 0x0c, 0x63, 0xff, 0xcb, 0x5a, 0xff, 0x82, 0x08, 0x42, 0xff, 0x03, 0x28, 0x42, 0xff, 0x2d, 0x6b, 
+  0xff, 0x4d, 0x6b, 0xff, 0x6a, 0x52, 0xff, 0x89, 0x08, 0x42, 0xff, 0x03, 0x49, 0x4a, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0x5b, 0x82, 0x00, 0x00, 0x00, 0x03, 0x10, 0x84, 0xa8, 
+  0x10, 0x84, 0xff, 0xcf, 0x7b, 0xff, 0x49, 0x4a, 0xff, 0xb3, 0x08, 0x42, 0xff, 0x03, 0x49, 0x4a, 0xff, 0xcf, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xa8, 0x83, 0x00, 0x00, 0x00, 0x04, 0x10, 
+  0x84, 0x08, 0x10, 0x84, 0xbb, 0x10, 0x84, 0xff, 0xef, 0x7b, 0xff, 0xec, 0x62, 0xff, 0xb1, 0x08, 0x42, 0xff, 0x04, 0xec, 0x62, 0xff, 0xef, 0x7b, 0xff, 0x10, 0x84, 0xff, 0x10, 0x84, 0xbb, 0x10, 
+  0x84, 0x08, 0x84, 0x00, 0x00, 0x00, 0x01, 0x10, 0x84, 0x04, 0x10, 0x84, 0x93, 0x81, 0x10, 0x84, 0xff, 0x03, 0xcf, 0x7b, 0xff, 0x2d, 0x6b, 0xff, 0xab, 0x5a, 0xff, 0x49, 0x4a, 0xff, 0xa9, 0x08, 
+  0x42, 0xff, 0x03, 0x49, 0x4a, 0xff, 0xab, 0x5a, 0xff, 0x2d, 0x6b, 0xff, 0xcf, 0x7b, 0xff, 0x81, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0x93, 0x10, 0x84, 0x04, 0x87, 0x00, 0x00, 0x00, 0x01, 0x10, 
+  0x84, 0x3c, 0x10, 0x84, 0xc0, 0xb1, 0x10, 0x84, 0xff, 0x01, 0x10, 0x84, 0xc0, 0x10, 0x84, 0x3c, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0x27, 0x10, 0x84, 0x77, 0x10, 0x84, 0xa8, 0x88, 0x10, 
+  0x84, 0xc8, 0x00, 0x10, 0x84, 0xe7, 0x81, 0x10, 0x84, 0xff, 0x88, 0x10, 0x84, 0xc8, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0xe8, 0x87, 0x10, 0x84, 0xc8, 0x02, 0x10, 0x84, 0xf3, 0x10, 0x84, 
+  0xff, 0x10, 0x84, 0xf4, 0x88, 0x10, 0x84, 0xc8, 0x02, 0x10, 0x84, 0xa8, 0x10, 0x84, 0x77, 0x10, 0x84, 0x27, 0x99, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9b, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 
+  0x84, 0x03, 0x87, 0x00, 0x00, 0x00, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xcf, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0xa5, 0x00, 0x00, 0x00, 
+  0x00, 0x10, 0x84, 0x9c, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xd0, 
+  0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 
+  0x84, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x04, 
+  0x87, 0x00, 0x00, 0x00, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x10, 
+  0x84, 0x9c, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xd0, 0x10, 0x84, 
+  0xff, 0x10, 0x84, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x94, 
+  0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x9c, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x04, 0x87, 0x00, 
+  0x00, 0x00, 0x81, 0x10, 0x84, 0xff, 0x00, 0x10, 0x84, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xd0, 0x10, 0x84, 0xff, 0x10, 0x84, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0x87, 
+  0x10, 0x84, 0xff, 0x10, 0x84, 0xf4, 0x88, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xf4, 0x10, 0x84, 0xff, 0x10, 0x84, 0x84, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0xbf, 0x10, 0x84, 0xff, 0x10, 
+  0x84, 0xbc, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0x2c, 0x10, 0x84, 0xeb, 0x10, 0x84, 0x87, 0x88, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0x80, 0x10, 0x84, 0xdf, 0x10, 0x84, 0x27, 0x87, 0x00, 
+  0x00, 0x00, 0x02, 0x10, 0x84, 0x54, 0x10, 0x84, 0xef, 0x10, 0x84, 0x54, 0x92, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x07, 0x84, 0x10, 0x57, 0x84, 0x10, 0xa4, 0x84, 0x10, 0xd7, 0x84, 0x10, 0xf7, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xf7, 0x84, 0x10, 0xd7, 0x84, 0x10, 0xa4, 0x84, 0x10, 0x57, 0x84, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x84, 0x10, 0x68, 0x84, 0x10, 0xe8, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe8, 0x84, 0x10, 0x6b, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x14, 0x84, 0x10, 0xbf, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x5a, 0xcb, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x29, 0xff, 0x5a, 0xcb, 0xff, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xbf, 0x84, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x18, 0x84, 0x10, 0xd8, 0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xd8, 0x84, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x84, 0x10, 0x04, 0x84, 0x10, 0xc7, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xc7, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x84, 0x10, 0x78, 0x84, 0x10, 0xff, 0x7b, 0xaf, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x7b, 0xaf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x77, 0x00, 0x00, 0x00, 
-  0x84, 0x10, 0x0f, 0x84, 0x10, 0xf0, 0x84, 0x10, 0xff, 0x52, 0x6a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x6a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xf0, 0x84, 0x10, 0x0f, 
-  0x84, 0x10, 0x67, 0x84, 0x10, 0xff, 0x73, 0x6e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x73, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x67, 
-  0x84, 0x10, 0xb0, 0x84, 0x10, 0xff, 0x5a, 0xab, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x63, 0x2c, 0xff, 0x83, 0xf0, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x6b, 0x4d, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xab, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xb0, 
-  0x84, 0x10, 0xe3, 0x84, 0x10, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x63, 0x2c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe3, 
-  0x84, 0x10, 0xfb, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x83, 0xf0, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x8b, 0xcf, 0xff, 0x8b, 0xcf, 0xff, 0x8b, 0xcf, 0xff, 0x8b, 0xcf, 0xff, 0x8b, 0xcf, 0xff, 0x8b, 0xcf, 0xff, 0x83, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xfb, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x41, 0xe8, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0x08, 0xff, 0xa2, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x8a, 0x08, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xaf, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xc6, 0x18, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xc6, 0x18, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xbd, 0xd7, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xfb, 0xff, 0x8c, 0x71, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xeb, 0xff, 0xd6, 0xba, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0x9a, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x82, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x29, 0xff, 0xf7, 0x1c, 0xff, 0xf7, 0x1c, 0xff, 0xf7, 0x1c, 0xff, 0xf7, 0x1c, 0xff, 0xcd, 0x14, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x83, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xef, 0x7d, 0xff, 0xad, 0x75, 0xff, 0x42, 0x08, 0xff, 0xa4, 0xf4, 0xff, 0xf7, 0x9e, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xad, 0x75, 0xff, 0xef, 0x5d, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0xef, 0x5d, 0xff, 0xad, 0x55, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xc6, 0x18, 0xff, 0x84, 0x30, 0xff, 0x52, 0x6a, 0xff, 0xad, 0x55, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x4d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xab, 0xff, 0x9c, 0xb3, 0xff, 0x63, 0x2c, 0xff, 0x63, 0x0c, 0xff, 0xce, 0x59, 0xff, 0xef, 0x3d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x49, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x30, 0xff, 0xbc, 0x30, 0xff, 0xbc, 0x30, 0xff, 0xb3, 0x2c, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x84, 0x30, 0xff, 0xff, 0xbf, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xf7, 0x9e, 0xff, 0x94, 0xb2, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xe7, 0x1c, 0xff, 0xb5, 0x96, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xb5, 0x96, 0xff, 0xe6, 0xfc, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xf7, 0x7e, 0xff, 0x94, 0x92, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8c, 0x71, 0xff, 0xff, 0xbf, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x49, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x28, 0xff, 0xaa, 0x28, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0xa5, 0x34, 0xff, 0xef, 0x5d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xe7, 0x1c, 0xff, 0xb5, 0x76, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xf7, 0x9e, 0xff, 0x8c, 0x71, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8c, 0x71, 0xff, 0xf7, 0x9e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8c, 0x71, 0xff, 0xff, 0xdf, 0xff, 0x5a, 0xeb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xb5, 0x96, 0xff, 0xbd, 0xf7, 0xff, 0xe7, 0x1c, 0xff, 0xa5, 0x34, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x49, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x3c, 0xff, 0xbb, 0xaf, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0xad, 0x55, 0xff, 0xef, 0x5d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xe7, 0x1c, 0xff, 0xb5, 0x76, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xf7, 0xbe, 0xff, 0x8c, 0x31, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8c, 0x31, 0xff, 0xf7, 0x9e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0xf7, 0x9e, 0xff, 0x94, 0x92, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xad, 0x55, 0xff, 0xbd, 0xb7, 0xff, 0xef, 0x5d, 0xff, 0xc5, 0xf8, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xb2, 0xeb, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xde, 0x38, 0xff, 0xf7, 0x5d, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x94, 0x92, 0xff, 0xf7, 0x9e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xef, 0x5d, 0xff, 0xa5, 0x14, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xef, 0x5d, 0xff, 0xa5, 0x34, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xa5, 0x34, 0xff, 0xef, 0x3d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x84, 0x30, 0xff, 0xf7, 0x9e, 0xff, 0x9c, 0xb3, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x4d, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xb3, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xe8, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0xff, 0xdf, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xdf, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xc6, 0x18, 0xff, 0xd6, 0xba, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xd6, 0xba, 0xff, 0xc6, 0x18, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8c, 0x51, 0xff, 0xf7, 0x9e, 0xff, 0x94, 0x72, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x28, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xcd, 0x34, 0xff, 0xff, 0xbe, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xad, 0x55, 0xff, 0xf7, 0x9e, 0xff, 0xd6, 0x7a, 0xff, 0xf7, 0x9e, 0xff, 0xb5, 0x96, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xcb, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xef, 0x5d, 0xff, 0x5a, 0xcb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x7e, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0x8c, 0x51, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0xb5, 0x76, 0xff, 0xde, 0xfb, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xf7, 0xbe, 0xff, 0xbd, 0xf7, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xd5, 0x96, 0xff, 0xf7, 0x1c, 0xff, 0xe6, 0x79, 0xff, 0xee, 0xbb, 0xff, 0xff, 0xdf, 0xff, 0xcc, 0xf3, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x6b, 0x2d, 0xff, 0x8c, 0x51, 0xff, 0x6b, 0x4d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x84, 0x30, 0xff, 0x84, 0x30, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x84, 0x30, 0xff, 0x84, 0x30, 0xff, 0x84, 0x30, 0xff, 0x84, 0x30, 0xff, 0x84, 0x30, 0xff, 0x5a, 0xeb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x8c, 0x31, 0xff, 0xad, 0x55, 0xff, 0xad, 0x35, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xbc, 0x10, 0xff, 0xcd, 0x14, 0xff, 0xc4, 0xb2, 0xff, 0xb2, 0xcb, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xa2, 0x08, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x6a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x62, 0xec, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x52, 0xaa, 0xff, 0x8a, 0xaa, 0xff, 0xa2, 0xaa, 0xff, 0xa2, 0xaa, 0xff, 0xa2, 0xaa, 0xff, 0xa2, 0xaa, 0xff, 0xa2, 0xaa, 0xff, 0xa2, 0xaa, 0xff, 0x9a, 0xaa, 0xff, 0x7a, 0xcb, 0xff, 0x83, 0xf0, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x5a, 0xeb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x83, 0xf0, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x83, 0xf0, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x5a, 0xeb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x6b, 0x4d, 0xff, 0x7b, 0xaf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x6b, 0x6d, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x52, 0x6a, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x6b, 0x2d, 0xff, 0x83, 0xf0, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x62, 0xec, 0xff, 0x84, 0x10, 0xff, 0x8c, 0x51, 0xff, 0xb5, 0x76, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0x9c, 0x71, 0xff, 0x93, 0x8e, 0xff, 0x93, 0x8e, 0xff, 0x93, 0x8e, 0xff, 0x93, 0x8e, 0xff, 0x93, 0x8e, 0xff, 0x93, 0x8e, 0xff, 0x93, 0x8e, 0xff, 0xad, 0x14, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xff, 0x9c, 0xd3, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7a, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xb2, 0xcb, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x9a, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xb2, 0xcb, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd3, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xeb, 0xff, 0x84, 0x10, 0xff, 0x8c, 0x51, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0x94, 0x10, 0xff, 0x93, 0x8e, 0xff, 0x93, 0x6e, 0xff, 0x93, 0x6e, 0xff, 0x93, 0x6e, 0xff, 0x93, 0x6e, 0xff, 0x93, 0x6e, 0xff, 0x93, 0x8e, 0xff, 0x9c, 0xb2, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0x94, 0xb2, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x63, 0x0c, 0xff, 0x83, 0xf0, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x4a, 0x69, 0xff, 0x42, 0x28, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 
-  0x84, 0x10, 0xf8, 0x83, 0xf0, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x83, 0xf0, 0xff, 0x84, 0x10, 0xf8, 
-  0x84, 0x10, 0xdb, 0x84, 0x10, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x6b, 0x4d, 0xff, 0x7b, 0xcf, 0xff, 0x6b, 0x4d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x63, 0x0c, 0xff, 0x7b, 0xcf, 0xff, 0x73, 0x8e, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0xaa, 0xff, 0x7b, 0xef, 0xff, 0x83, 0xf0, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x6b, 0x4d, 0xff, 0x7b, 0xcf, 0xff, 0x6b, 0x4d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x62, 0xec, 0xff, 0x7b, 0xcf, 0xff, 0x73, 0x8e, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x29, 0xff, 0x6b, 0x4d, 0xff, 0x73, 0x8e, 0xff, 0x52, 0xaa, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x29, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xdb, 
-  0x84, 0x10, 0xa7, 0x84, 0x10, 0xff, 0x5a, 0xcb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x63, 0x0c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x62, 0xec, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x6b, 0x6d, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x62, 0xec, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x69, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x83, 0xf0, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xcb, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa7, 
-  0x84, 0x10, 0x57, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x6b, 0x6d, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x6b, 0x4d, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xeb, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x73, 0xae, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x52, 0x6a, 0xff, 0x42, 0x08, 0xff, 0x6b, 0x4d, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x6b, 0x6d, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xab, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x57, 
-  0x84, 0x10, 0x04, 0x84, 0x10, 0xe3, 0x84, 0x10, 0xff, 0x5a, 0xab, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0xaa, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x63, 0x0c, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x52, 0xaa, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x63, 0x2c, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x73, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x4a, 0x29, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xab, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe3, 0x84, 0x10, 0x04, 
-  0x00, 0x00, 0x00, 0x84, 0x10, 0x5c, 0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x63, 0x0c, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x63, 0x0c, 0xff, 0x5a, 0xcb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x52, 0xaa, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x63, 0x0c, 0xff, 0x52, 0x8a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x63, 0x0c, 0xff, 0x5a, 0xcb, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x6b, 0x2d, 0xff, 0x6b, 0x4d, 0xff, 0x52, 0x6a, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x5b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xa8, 0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa8, 0x7b, 0xef, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x08, 0x84, 0x10, 0xbb, 0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x62, 0xec, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x62, 0xec, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xbb, 0x84, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x04, 0x84, 0x10, 0x93, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x6b, 0x2d, 0xff, 0x5a, 0xab, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x5a, 0xab, 0xff, 0x6b, 0x2d, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x93, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xe8, 0x00, 0x84, 0x10, 0x3c, 0x84, 0x10, 0xc0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xc0, 0x84, 0x10, 0x3c, 0x39, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0x27, 0x84, 0x10, 0x77, 0x84, 0x10, 0xa8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xe7, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xf3, 0x84, 0x10, 0xff, 0x84, 0x10, 0xf4, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xc8, 0x84, 0x10, 0xa8, 0x84, 0x10, 0x77, 0x84, 0x10, 0x27, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9b, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xcf, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x87, 0x84, 0x10, 0xff, 0x84, 0x10, 0xf4, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x84, 0x10, 0xf4, 0x84, 0x10, 0xff, 0x84, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0xbf, 0x84, 0x10, 0xff, 0x84, 0x10, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x2c, 0x84, 0x10, 0xeb, 0x84, 0x10, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x80, 0x84, 0x10, 0xdf, 0x84, 0x10, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x54, 0x84, 0x10, 0xef, 0x84, 0x10, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x85, 0x00, 0x00, 0x00, 0x04, 0x84, 0x10, 0x07, 0x84, 0x10, 0x57, 0x84, 0x10, 0xa4, 0x84, 0x10, 0xd7, 0x84, 0x10, 0xf7, 0xa9, 0x84, 0x10, 0xff, 0x04, 0x84, 0x10, 0xf7, 
+  0x84, 0x10, 0xd7, 0x84, 0x10, 0xa4, 0x84, 0x10, 0x57, 0x84, 0x10, 0x07, 0x89, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0x03, 0x84, 0x10, 0x68, 0x84, 0x10, 0xe8, 0x82, 0x84, 0x10, 0xff, 0x00, 0x7b, 
+  0xef, 0xff, 0xa9, 0x7b, 0xcf, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x82, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xe8, 0x84, 0x10, 0x6b, 0x87, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x14, 0x84, 0x10, 0xbf, 
+  0x81, 0x84, 0x10, 0xff, 0x02, 0x73, 0x8e, 0xff, 0x5a, 0xcb, 0xff, 0x4a, 0x29, 0xff, 0xab, 0x42, 0x08, 0xff, 0x02, 0x4a, 0x29, 0xff, 0x5a, 0xcb, 0xff, 0x73, 0x8e, 0xff, 0x81, 0x84, 0x10, 0xff, 
+  0x01, 0x84, 0x10, 0xbf, 0x84, 0x10, 0x14, 0x84, 0x00, 0x00, 0x00, 0x04, 0x84, 0x10, 0x18, 0x84, 0x10, 0xd8, 0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x52, 0x8a, 0xff, 0xb1, 0x42, 0x08, 0xff, 0x04, 
+  0x52, 0x8a, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xd8, 0x84, 0x10, 0x18, 0x82, 0x00, 0x00, 0x00, 0x04, 0x84, 0x10, 0x04, 0x84, 0x10, 0xc7, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 
+  0x42, 0x28, 0xff, 0xb3, 0x42, 0x08, 0xff, 0x04, 0x42, 0x28, 0xff, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xc7, 0x84, 0x10, 0x04, 0x81, 0x00, 0x00, 0x00, 0x03, 0x84, 0x10, 0x78, 0x84, 
+  0x10, 0xff, 0x7b, 0xaf, 0xff, 0x42, 0x28, 0xff, 0xb5, 0x42, 0x08, 0xff, 0x08, 0x42, 0x28, 0xff, 0x7b, 0xaf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x77, 0x00, 0x00, 0x00, 0x84, 0x10, 0x0f, 0x84, 
+  0x10, 0xf0, 0x84, 0x10, 0xff, 0x52, 0x6a, 0xff, 0xb7, 0x42, 0x08, 0xff, 0x06, 0x52, 0x6a, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xf0, 0x84, 0x10, 0x0f, 0x84, 0x10, 0x67, 0x84, 0x10, 0xff, 0x73, 
+  0x6e, 0xff, 0x86, 0x42, 0x08, 0xff, 0xac, 0x52, 0x8a, 0xff, 0x00, 0x42, 0x28, 0xff, 0x84, 0x42, 0x08, 0xff, 0x05, 0x73, 0x6e, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x67, 0x84, 0x10, 0xb0, 0x84, 
+  0x10, 0xff, 0x5a, 0xab, 0xff, 0x84, 0x42, 0x08, 0xff, 0x01, 0x63, 0x2c, 0xff, 0x83, 0xf0, 0xff, 0xad, 0x84, 0x10, 0xff, 0x01, 0x6b, 0x4d, 0xff, 0x42, 0x28, 0xff, 0x82, 0x42, 0x08, 0xff, 0x05, 
+  0x5a, 0xab, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xb0, 0x84, 0x10, 0xe3, 0x84, 0x10, 0xff, 0x42, 0x28, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x63, 0x2c, 0xff, 0xb0, 0x84, 0x10, 0xff, 0x00, 0x73, 
+  0x8e, 0xff, 0x82, 0x42, 0x08, 0xff, 0x04, 0x42, 0x28, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xe3, 0x84, 0x10, 0xfb, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x01, 0x42, 0x28, 0xff, 0x83, 0xf0, 
+  0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xa3, 0x7b, 0xcf, 0xff, 0x85, 0x8b, 0xcf, 0xff, 0x01, 0x83, 0xcf, 0xff, 0x7b, 0xcf, 0xff, 0x82, 0x84, 0x10, 0xff, 0x00, 0x52, 0x8a, 0xff, 
+  0x82, 0x42, 0x08, 0xff, 0x03, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xfb, 0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x00, 0x4a, 0x29, 
+  0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x41, 0xe8, 0xff, 0x9d, 0x42, 0x08, 0xff, 0x01, 0x5a, 0x08, 0xff, 0xa2, 0x08, 0xff, 0x86, 0xaa, 0x08, 0xff, 0x01, 0x8a, 0x08, 0xff, 0x7b, 0xcf, 0xff, 0x81, 
+  0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 
+  0x84, 0x10, 0xff, 0x81, 0x42, 0x08, 0xff, 0x04, 0x7b, 0xaf, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0x84, 0x10, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0xc6, 0x18, 0xff, 0x81, 
+  0xf7, 0x7e, 0xff, 0x00, 0xc6, 0x18, 0xff, 0x83, 0x42, 0x08, 0xff, 0x04, 0xbd, 0xd7, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xfb, 0xff, 0x8c, 0x71, 0xff, 0x82, 0x42, 0x08, 0xff, 0x01, 
+  0x5a, 0xeb, 0xff, 0xd6, 0xba, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x01, 0xd6, 0x9a, 0xff, 0x73, 0x8e, 0xff, 0x81, 0x42, 0x08, 0xff, 0x02, 0x82, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x29, 0xff, 0x83, 
+  0xf7, 0x1c, 0xff, 0x00, 0xcd, 0x14, 0xff, 0x81, 0xaa, 0x08, 0xff, 0x00, 0x83, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 
+  0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x81, 0x42, 0x08, 0xff, 0x05, 0xef, 0x7d, 0xff, 0xad, 0x75, 0xff, 0x42, 0x08, 
+  0xff, 0xa4, 0xf4, 0xff, 0xf7, 0x9e, 0xff, 0x4a, 0x29, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xad, 0x75, 0xff, 0xef, 0x5d, 0xff, 0x81, 0x52, 0xaa, 0xff, 0x01, 0xef, 0x5d, 0xff, 0xad, 0x55, 0xff, 
+  0x82, 0x42, 0x08, 0xff, 0x05, 0xc6, 0x18, 0xff, 0x84, 0x30, 0xff, 0x52, 0x6a, 0xff, 0xad, 0x55, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x4d, 0xff, 0x81, 0x42, 0x08, 0xff, 0x05, 0x5a, 0xab, 0xff, 0x9c, 
+  0xb3, 0xff, 0x63, 0x2c, 0xff, 0x63, 0x0c, 0xff, 0xce, 0x59, 0xff, 0xef, 0x3d, 0xff, 0x81, 0x42, 0x08, 0xff, 0x03, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x49, 0xff, 0xff, 0xff, 0xff, 0x82, 
+  0xbc, 0x30, 0xff, 0x00, 0xb3, 0x2c, 0xff, 0x81, 0xaa, 0x08, 0xff, 0x00, 0x8b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 
+  0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x42, 0x08, 0xff, 0x84, 0x30, 0xff, 0xff, 0xbf, 0xff, 0x82, 0x42, 0x08, 
+  0xff, 0x01, 0xf7, 0x9e, 0xff, 0x94, 0xb2, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xe7, 0x1c, 0xff, 0xb5, 0x96, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xb5, 0x96, 0xff, 0xe6, 0xfc, 0xff, 0x86, 0x42, 
+  0x08, 0xff, 0x01, 0xf7, 0x7e, 0xff, 0x94, 0x92, 0xff, 0x85, 0x42, 0x08, 0xff, 0x01, 0x8c, 0x71, 0xff, 0xff, 0xbf, 0xff, 0x81, 0x42, 0x08, 0xff, 0x03, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 
+  0x49, 0xff, 0xff, 0xff, 0xff, 0x81, 0xaa, 0x28, 0xff, 0x83, 0xaa, 0x08, 0xff, 0x00, 0x8b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 
+  0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x42, 0x08, 0xff, 0xa5, 0x34, 0xff, 0xef, 0x5d, 0xff, 0x82, 
+  0x42, 0x08, 0xff, 0x01, 0xe7, 0x1c, 0xff, 0xb5, 0x76, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xf7, 0x9e, 0xff, 0x8c, 0x71, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0x8c, 0x71, 0xff, 0xf7, 0x9e, 0xff, 
+  0x85, 0x42, 0x08, 0xff, 0x02, 0x8c, 0x71, 0xff, 0xff, 0xdf, 0xff, 0x5a, 0xeb, 0xff, 0x83, 0x42, 0x08, 0xff, 0x03, 0xb5, 0x96, 0xff, 0xbd, 0xf7, 0xff, 0xe7, 0x1c, 0xff, 0xa5, 0x34, 0xff, 0x81, 
+  0x42, 0x08, 0xff, 0x07, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x49, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x3c, 0xff, 0xbb, 0xaf, 0xff, 0x81, 0xaa, 0x08, 0xff, 
+  0x00, 0x8b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 
+  0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x42, 0x08, 0xff, 0xad, 0x55, 0xff, 0xef, 0x5d, 0xff, 0x82, 0x42, 0x08, 0xff, 0x01, 0xe7, 0x1c, 0xff, 0xb5, 0x76, 0xff, 0x81, 0x42, 0x08, 
+  0xff, 0x01, 0xf7, 0xbe, 0xff, 0x8c, 0x31, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0x8c, 0x31, 0xff, 0xf7, 0x9e, 0xff, 0x84, 0x42, 0x08, 0xff, 0x02, 0x7b, 0xef, 0xff, 0xf7, 0x9e, 0xff, 0x94, 0x92, 
+  0xff, 0x84, 0x42, 0x08, 0xff, 0x03, 0xad, 0x55, 0xff, 0xbd, 0xb7, 0xff, 0xef, 0x5d, 0xff, 0xc5, 0xf8, 0xff, 0x81, 0x42, 0x08, 0xff, 0x00, 0x8a, 0x08, 0xff, 0x81, 0xaa, 0x08, 0xff, 0x00, 0xb2, 
+  0xeb, 0xff, 0x81, 0xaa, 0x08, 0xff, 0x01, 0xde, 0x38, 0xff, 0xf7, 0x5d, 0xff, 0x81, 0xaa, 0x08, 0xff, 0x00, 0x8b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 
+  0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x42, 0x08, 0xff, 0x94, 0x92, 0xff, 
+  0xf7, 0x9e, 0xff, 0x82, 0x42, 0x08, 0xff, 0x01, 0xef, 0x5d, 0xff, 0xa5, 0x14, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xef, 0x5d, 0xff, 0xa5, 0x34, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xa5, 0x34, 
+  0xff, 0xef, 0x3d, 0xff, 0x83, 0x42, 0x08, 0xff, 0x02, 0x84, 0x30, 0xff, 0xf7, 0x9e, 0xff, 0x9c, 0xb3, 0xff, 0x87, 0x42, 0x08, 0xff, 0x04, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x4d, 0xff, 
+  0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0x84, 0xaa, 0x08, 0xff, 0x04, 0xb3, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xe8, 0xff, 0xaa, 0x08, 0xff, 0x8b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 
+  0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x07, 0x42, 
+  0x08, 0xff, 0x52, 0x8a, 0xff, 0xff, 0xdf, 0xff, 0x84, 0x10, 0xff, 0x42, 0x08, 0xff, 0x73, 0x8e, 0xff, 0xff, 0xdf, 0xff, 0x63, 0x0c, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xc6, 0x18, 0xff, 0xd6, 
+  0xba, 0xff, 0x81, 0x42, 0x08, 0xff, 0x01, 0xd6, 0xba, 0xff, 0xc6, 0x18, 0xff, 0x82, 0x42, 0x08, 0xff, 0x02, 0x8c, 0x51, 0xff, 0xf7, 0x9e, 0xff, 0x94, 0x72, 0xff, 0x88, 0x42, 0x08, 0xff, 0x06, 
+  0x73, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x08, 0xff, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xaa, 0x28, 0xff, 0x82, 0xaa, 0x08, 0xff, 0x01, 0xcd, 0x34, 0xff, 0xff, 0xbe, 0xff, 
+  0x81, 0xaa, 0x08, 0xff, 0x00, 0x8b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 
+  0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x81, 0x42, 0x08, 0xff, 0x04, 0xad, 0x55, 0xff, 0xf7, 0x9e, 0xff, 0xd6, 0x7a, 0xff, 0xf7, 0x9e, 0xff, 0xb5, 0x96, 0xff, 
+  0x82, 0x42, 0x08, 0xff, 0x01, 0x5a, 0xcb, 0xff, 0xef, 0x5d, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x01, 0xef, 0x5d, 0xff, 0x5a, 0xcb, 0xff, 0x82, 0x42, 0x08, 0xff, 0x01, 0xff, 0xdf, 0xff, 0xf7, 0x7e, 
+  0xff, 0x82, 0xde, 0xdb, 0xff, 0x00, 0x8c, 0x51, 0xff, 0x81, 0x42, 0x08, 0xff, 0x05, 0xb5, 0x76, 0xff, 0xde, 0xfb, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xf7, 0xbe, 0xff, 0xbd, 0xf7, 0xff, 
+  0x81, 0x42, 0x08, 0xff, 0x07, 0x8a, 0x08, 0xff, 0xaa, 0x08, 0xff, 0xd5, 0x96, 0xff, 0xf7, 0x1c, 0xff, 0xe6, 0x79, 0xff, 0xee, 0xbb, 0xff, 0xff, 0xdf, 0xff, 0xcc, 0xf3, 0xff, 0x81, 0xaa, 0x08, 
+  0xff, 0x00, 0x8b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 
+  0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x82, 0x42, 0x08, 0xff, 0x02, 0x6b, 0x2d, 0xff, 0x8c, 0x51, 0xff, 0x6b, 0x4d, 0xff, 0x85, 0x42, 0x08, 0xff, 0x81, 0x84, 0x30, 0xff, 0x84, 
+  0x42, 0x08, 0xff, 0x84, 0x84, 0x30, 0xff, 0x00, 0x5a, 0xeb, 0xff, 0x82, 0x42, 0x08, 0xff, 0x03, 0x8c, 0x31, 0xff, 0xad, 0x55, 0xff, 0xad, 0x35, 0xff, 0x73, 0x8e, 0xff, 0x82, 0x42, 0x08, 0xff, 
+  0x00, 0x7a, 0x08, 0xff, 0x81, 0xaa, 0x08, 0xff, 0x03, 0xbc, 0x10, 0xff, 0xcd, 0x14, 0xff, 0xc4, 0xb2, 0xff, 0xb2, 0xcb, 0xff, 0x81, 0xaa, 0x08, 0xff, 0x01, 0xa2, 0x08, 0xff, 0x7b, 0xcf, 0xff, 
+  0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x52, 0x6a, 0xff, 
+  0x82, 0x84, 0x10, 0xff, 0x00, 0x62, 0xec, 0xff, 0xa2, 0x52, 0xaa, 0xff, 0x00, 0x8a, 0xaa, 0xff, 0x85, 0xa2, 0xaa, 0xff, 0x02, 0x9a, 0xaa, 0xff, 0x7a, 0xcb, 0xff, 0x83, 0xf0, 0xff, 0x81, 0x84, 
+  0x10, 0xff, 0x00, 0x5a, 0xeb, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x84, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xcf, 0xff, 0xb0, 0x84, 
+  0x10, 0xff, 0x01, 0x83, 0xf0, 0xff, 0x4a, 0x29, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x84, 0x42, 0x08, 0xff, 0x01, 0x52, 0x8a, 
+  0xff, 0x83, 0xf0, 0xff, 0xaf, 0x84, 0x10, 0xff, 0x00, 0x5a, 0xeb, 0xff, 0x83, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x85, 0x42, 0x08, 0xff, 
+  0x02, 0x4a, 0x49, 0xff, 0x6b, 0x4d, 0xff, 0x7b, 0xaf, 0xff, 0xab, 0x7b, 0xcf, 0xff, 0x01, 0x6b, 0x6d, 0xff, 0x52, 0x8a, 0xff, 0x84, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 
+  0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 
+  0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 
+  0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 
+  0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x84, 0x42, 0x08, 0xff, 0x00, 0x42, 0x28, 0xff, 0xaf, 0x52, 0x6a, 
+  0xff, 0x00, 0x4a, 0x49, 0xff, 0x84, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x01, 0x6b, 0x2d, 0xff, 0x83, 0xf0, 0xff, 
+  0xb0, 0x84, 0x10, 0xff, 0x01, 0x73, 0x8e, 0xff, 0x4a, 0x29, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x82, 0x42, 0x08, 0xff, 0x03, 
+  0x62, 0xec, 0xff, 0x84, 0x10, 0xff, 0x8c, 0x51, 0xff, 0xb5, 0x76, 0xff, 0x92, 0xb5, 0x96, 0xff, 0x00, 0x9c, 0x71, 0xff, 0x86, 0x93, 0x8e, 0xff, 0x00, 0xad, 0x14, 0xff, 0x92, 0xb5, 0x96, 0xff, 
+  0x02, 0x9c, 0xd3, 0xff, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x82, 0x42, 0x08, 0xff, 0x02, 0x73, 
+  0x8e, 0xff, 0x84, 0x10, 0xff, 0xf7, 0x9e, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0xe6, 0x7a, 0xff, 0x87, 0xaa, 0x08, 0xff, 0x01, 0xb2, 0xcb, 0xff, 0xff, 0xbe, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 
+  0x9c, 0xf3, 0xff, 0x84, 0x10, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x82, 0x42, 0x08, 0xff, 0x02, 0x73, 0x8e, 0xff, 0x84, 0x10, 
+  0xff, 0xef, 0x7d, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0xe6, 0x9a, 0xff, 0x87, 0xaa, 0x08, 0xff, 0x01, 0xb2, 0xcb, 0xff, 0xff, 0xbe, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0xff, 0x84, 
+  0x10, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x82, 0x42, 0x08, 0xff, 0x02, 0x5a, 0xeb, 0xff, 0x84, 0x10, 0xff, 0x8c, 0x51, 0xff, 
+  0x93, 0xa5, 0x34, 0xff, 0x01, 0x94, 0x10, 0xff, 0x93, 0x8e, 0xff, 0x84, 0x93, 0x6e, 0xff, 0x01, 0x93, 0x8e, 0xff, 0x9c, 0xb2, 0xff, 0x92, 0xa5, 0x34, 0xff, 0x02, 0x94, 0xb2, 0xff, 0x84, 0x10, 
+  0xff, 0x73, 0x8e, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x83, 0x42, 0x08, 0xff, 0x01, 0x63, 0x0c, 0xff, 0x83, 0xf0, 0xff, 0xb0, 
+  0x84, 0x10, 0xff, 0x01, 0x73, 0x8e, 0xff, 0x4a, 0x29, 0xff, 0x82, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x85, 0x42, 0x08, 0xff, 0x00, 0x4a, 
+  0x49, 0xff, 0xae, 0x4a, 0x69, 0xff, 0x00, 0x42, 0x28, 0xff, 0x84, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 
+  0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x00, 0x7b, 
+  0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x7b, 0xef, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x03, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xf8, 0x83, 0xf0, 0xff, 0xbb, 0x42, 0x08, 0xff, 0x04, 
+  0x83, 0xf0, 0xff, 0x84, 0x10, 0xf8, 0x84, 0x10, 0xdb, 0x84, 0x10, 0xff, 0x4a, 0x29, 0xff, 0x8a, 0x42, 0x08, 0xff, 0x02, 0x6b, 0x4d, 0xff, 0x7b, 0xcf, 0xff, 0x6b, 0x4d, 0xff, 0x82, 0x42, 0x08, 
+  0xff, 0x03, 0x63, 0x0c, 0xff, 0x7b, 0xcf, 0xff, 0x73, 0x8e, 0xff, 0x4a, 0x49, 0xff, 0x81, 0x42, 0x08, 0xff, 0x03, 0x52, 0xaa, 0xff, 0x7b, 0xef, 0xff, 0x83, 0xf0, 0xff, 0x63, 0x0c, 0xff, 0x82, 
+  0x42, 0x08, 0xff, 0x02, 0x6b, 0x4d, 0xff, 0x7b, 0xcf, 0xff, 0x6b, 0x4d, 0xff, 0x82, 0x42, 0x08, 0xff, 0x03, 0x62, 0xec, 0xff, 0x7b, 0xcf, 0xff, 0x73, 0x8e, 0xff, 0x4a, 0x49, 0xff, 0x81, 0x42, 
+  0x08, 0xff, 0x03, 0x4a, 0x29, 0xff, 0x6b, 0x4d, 0xff, 0x73, 0x8e, 0xff, 0x52, 0xaa, 0xff, 0x8b, 0x42, 0x08, 0xff, 0x05, 0x4a, 0x29, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xdb, 0x84, 0x10, 0xa7, 
+  0x84, 0x10, 0xff, 0x5a, 0xcb, 0xff, 0x89, 0x42, 0x08, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x62, 0xec, 0xff, 0x42, 0x08, 0xff, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 
+  0x00, 0x6b, 0x6d, 0xff, 0x81, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xcf, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x62, 0xec, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x63, 
+  0x0c, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x69, 0xff, 0x82, 0x84, 0x10, 0xff, 0x00, 0x73, 0x8e, 0xff, 0x81, 0x42, 0x08, 0xff, 0x00, 0x73, 0x8e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x83, 0xf0, 0xff, 
+  0x4a, 0x29, 0xff, 0x8a, 0x42, 0x08, 0xff, 0x05, 0x5a, 0xcb, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa7, 0x84, 0x10, 0x57, 0x84, 0x10, 0xff, 0x73, 0x8e, 0xff, 0x89, 0x42, 0x08, 0xff, 0x00, 0x6b, 
+  0x6d, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x6b, 0x4d, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xeb, 0xff, 0x82, 0x84, 0x10, 0xff, 0x00, 0x73, 0xae, 0xff, 0x81, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xef, 0xff, 
+  0x82, 0x84, 0x10, 0xff, 0x02, 0x52, 0x6a, 0xff, 0x42, 0x08, 0xff, 0x6b, 0x4d, 0xff, 0x82, 0x84, 0x10, 0xff, 0x02, 0x6b, 0x6d, 0xff, 0x42, 0x08, 0xff, 0x5a, 0xab, 0xff, 0x82, 0x84, 0x10, 0xff, 
+  0x00, 0x7b, 0xcf, 0xff, 0x81, 0x42, 0x08, 0xff, 0x00, 0x7b, 0xcf, 0xff, 0x82, 0x84, 0x10, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x8a, 0x42, 0x08, 0xff, 0x06, 0x73, 0x8e, 0xff, 0x84, 0x10, 0xff, 0x84, 
+  0x10, 0x57, 0x84, 0x10, 0x04, 0x84, 0x10, 0xe3, 0x84, 0x10, 0xff, 0x5a, 0xab, 0xff, 0x88, 0x42, 0x08, 0xff, 0x00, 0x52, 0xaa, 0xff, 0x82, 0x84, 0x10, 0xff, 0x03, 0x52, 0x8a, 0xff, 0x42, 0x08, 
+  0xff, 0x4a, 0x49, 0xff, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x81, 0x42, 0x08, 0xff, 0x00, 0x63, 0x0c, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x73, 0x8e, 0xff, 0x81, 
+  0x42, 0x08, 0xff, 0x00, 0x52, 0x8a, 0xff, 0x82, 0x84, 0x10, 0xff, 0x03, 0x52, 0xaa, 0xff, 0x42, 0x08, 0xff, 0x42, 0x28, 0xff, 0x7b, 0xef, 0xff, 0x81, 0x84, 0x10, 0xff, 0x00, 0x63, 0x2c, 0xff, 
+  0x81, 0x42, 0x08, 0xff, 0x00, 0x73, 0x6e, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x7b, 0xef, 0xff, 0x4a, 0x29, 0xff, 0x89, 0x42, 0x08, 0xff, 0x08, 0x5a, 0xab, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 
+  0xe3, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x84, 0x10, 0x5c, 0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x4a, 0x49, 0xff, 0x88, 0x42, 0x08, 0xff, 0x02, 0x52, 0x8a, 0xff, 0x63, 0x0c, 0xff, 0x52, 0x8a, 
+  0xff, 0x82, 0x42, 0x08, 0xff, 0x02, 0x4a, 0x49, 0xff, 0x63, 0x0c, 0xff, 0x5a, 0xcb, 0xff, 0x83, 0x42, 0x08, 0xff, 0x01, 0x52, 0x8a, 0xff, 0x52, 0xaa, 0xff, 0x83, 0x42, 0x08, 0xff, 0x02, 0x52, 
+  0x8a, 0xff, 0x63, 0x0c, 0xff, 0x52, 0x8a, 0xff, 0x82, 0x42, 0x08, 0xff, 0x02, 0x4a, 0x49, 0xff, 0x63, 0x0c, 0xff, 0x5a, 0xcb, 0xff, 0x82, 0x42, 0x08, 0xff, 0x03, 0x42, 0x28, 0xff, 0x6b, 0x2d, 
+  0xff, 0x6b, 0x4d, 0xff, 0x52, 0x6a, 0xff, 0x89, 0x42, 0x08, 0xff, 0x03, 0x4a, 0x49, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0x5b, 0x82, 0x00, 0x00, 0x00, 0x03, 0x84, 0x10, 0xa8, 
+  0x84, 0x10, 0xff, 0x7b, 0xcf, 0xff, 0x4a, 0x49, 0xff, 0xb3, 0x42, 0x08, 0xff, 0x03, 0x4a, 0x49, 0xff, 0x7b, 0xcf, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xa8, 0x83, 0x00, 0x00, 0x00, 0x04, 0x84, 
+  0x10, 0x08, 0x84, 0x10, 0xbb, 0x84, 0x10, 0xff, 0x7b, 0xef, 0xff, 0x62, 0xec, 0xff, 0xb1, 0x42, 0x08, 0xff, 0x04, 0x62, 0xec, 0xff, 0x7b, 0xef, 0xff, 0x84, 0x10, 0xff, 0x84, 0x10, 0xbb, 0x84, 
+  0x10, 0x08, 0x84, 0x00, 0x00, 0x00, 0x01, 0x84, 0x10, 0x04, 0x84, 0x10, 0x93, 0x81, 0x84, 0x10, 0xff, 0x03, 0x7b, 0xcf, 0xff, 0x6b, 0x2d, 0xff, 0x5a, 0xab, 0xff, 0x4a, 0x49, 0xff, 0xa9, 0x42, 
+  0x08, 0xff, 0x03, 0x4a, 0x49, 0xff, 0x5a, 0xab, 0xff, 0x6b, 0x2d, 0xff, 0x7b, 0xcf, 0xff, 0x81, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0x93, 0x84, 0x10, 0x04, 0x87, 0x00, 0x00, 0x00, 0x01, 0x84, 
+  0x10, 0x3c, 0x84, 0x10, 0xc0, 0xb1, 0x84, 0x10, 0xff, 0x01, 0x84, 0x10, 0xc0, 0x84, 0x10, 0x3c, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0x27, 0x84, 0x10, 0x77, 0x84, 0x10, 0xa8, 0x88, 0x84, 
+  0x10, 0xc8, 0x00, 0x84, 0x10, 0xe7, 0x81, 0x84, 0x10, 0xff, 0x88, 0x84, 0x10, 0xc8, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0xe8, 0x87, 0x84, 0x10, 0xc8, 0x02, 0x84, 0x10, 0xf3, 0x84, 0x10, 
+  0xff, 0x84, 0x10, 0xf4, 0x88, 0x84, 0x10, 0xc8, 0x02, 0x84, 0x10, 0xa8, 0x84, 0x10, 0x77, 0x84, 0x10, 0x27, 0x99, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9b, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 
+  0x10, 0x03, 0x87, 0x00, 0x00, 0x00, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xcf, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0xa5, 0x00, 0x00, 0x00, 
+  0x00, 0x84, 0x10, 0x9c, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xd0, 
+  0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 
+  0x10, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x04, 
+  0x87, 0x00, 0x00, 0x00, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x84, 
+  0x10, 0x9c, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xd0, 0x84, 0x10, 
+  0xff, 0x84, 0x10, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x04, 0x87, 0x00, 0x00, 0x00, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x94, 
+  0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x9c, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x04, 0x87, 0x00, 
+  0x00, 0x00, 0x81, 0x84, 0x10, 0xff, 0x00, 0x84, 0x10, 0x94, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xd0, 0x84, 0x10, 0xff, 0x84, 0x10, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0x87, 
+  0x84, 0x10, 0xff, 0x84, 0x10, 0xf4, 0x88, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xf4, 0x84, 0x10, 0xff, 0x84, 0x10, 0x84, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0xbf, 0x84, 0x10, 0xff, 0x84, 
+  0x10, 0xbc, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0x2c, 0x84, 0x10, 0xeb, 0x84, 0x10, 0x87, 0x88, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0x80, 0x84, 0x10, 0xdf, 0x84, 0x10, 0x27, 0x87, 0x00, 
+  0x00, 0x00, 0x02, 0x84, 0x10, 0x54, 0x84, 0x10, 0xef, 0x84, 0x10, 0x54, 0x92, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80, 0x57, 0x80, 0x80, 0x80, 0xa4, 0x80, 0x80, 0x80, 0xd7, 0x80, 0x80, 0x80, 0xf7, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xf7, 0x80, 0x80, 0x80, 0xd7, 0x80, 0x80, 0x80, 0xa4, 0x80, 0x80, 0x80, 0x57, 0x80, 0x80, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0x82, 0x03, 0x80, 0x80, 0x80, 0x68, 0x80, 0x80, 0x80, 0xe8, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe8, 0x80, 0x80, 0x80, 0x6b, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x14, 0x80, 0x80, 0x80, 0xbf, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x70, 0x70, 0x70, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x45, 0x45, 0x45, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x45, 0x45, 0x45, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x70, 0x70, 0x70, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xbf, 0x80, 0x80, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x18, 0x80, 0x80, 0x80, 0xd8, 0x80, 0x80, 0x80, 0xff, 0x77, 0x77, 0x77, 0xff, 0x50, 0x50, 0x50, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x50, 0x50, 0x50, 0xff, 0x77, 0x77, 0x77, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xd8, 0x80, 0x80, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0xc7, 0x80, 0x80, 0x80, 0xff, 0x72, 0x72, 0x72, 0xff, 0x44, 0x44, 0x44, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x44, 0x44, 0x44, 0xff, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xc7, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x78, 0x80, 0x80, 0x80, 0xff, 0x76, 0x76, 0x76, 0xff, 0x43, 0x43, 0x43, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x43, 0x43, 0x43, 0xff, 0x76, 0x76, 0x76, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x77, 0x00, 0x00, 0x00, 0x00, 
-  0x80, 0x80, 0x80, 0x0f, 0x80, 0x80, 0x80, 0xf0, 0x7f, 0x7f, 0x7f, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x80, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x0f, 
-  0x80, 0x80, 0x80, 0x67, 0x80, 0x80, 0x80, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x41, 0x41, 0x41, 0xff, 0x51, 0x51, 0x51, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x52, 0x52, 0x52, 0xff, 0x43, 0x43, 0x43, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x67, 
-  0x80, 0x80, 0x80, 0xb0, 0x80, 0x80, 0x80, 0xff, 0x56, 0x56, 0x56, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x63, 0x63, 0x63, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x43, 0x43, 0x43, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x56, 0x56, 0x56, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xb0, 
-  0x80, 0x80, 0x80, 0xe3, 0x80, 0x80, 0x80, 0xff, 0x43, 0x43, 0x43, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x64, 0x64, 0x64, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x43, 0x43, 0x43, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe3, 
-  0x80, 0x80, 0x80, 0xfb, 0x7c, 0x7c, 0x7c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x43, 0x43, 0x43, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x7a, 0xff, 0x77, 0x77, 0x88, 0xff, 0x77, 0x77, 0x88, 0xff, 0x77, 0x77, 0x88, 0xff, 0x77, 0x77, 0x88, 0xff, 0x77, 0x77, 0x88, 0xff, 0x77, 0x77, 0x88, 0xff, 0x77, 0x77, 0x83, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xfb, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x45, 0x45, 0x45, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3e, 0x3e, 0x3e, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x56, 0xff, 0x40, 0x40, 0x9f, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0x8a, 0xff, 0x79, 0x79, 0x79, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x76, 0x76, 0x76, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x82, 0x82, 0x82, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xea, 0xea, 0xea, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0x70, 0x70, 0x70, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x82, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x45, 0x45, 0xa9, 0xff, 0xe2, 0xe2, 0xed, 0xff, 0xe1, 0xe1, 0xed, 0xff, 0xe1, 0xe1, 0xed, 0xff, 0xe1, 0xe1, 0xed, 0xff, 0x9f, 0x9f, 0xc8, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x82, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x41, 0x41, 0x41, 0xff, 0xec, 0xec, 0xec, 0xff, 0xac, 0xac, 0xac, 0xff, 0x40, 0x40, 0x40, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x46, 0x46, 0x46, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xab, 0xab, 0xab, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x84, 0x84, 0x84, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x69, 0x69, 0x69, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x55, 0x55, 0x55, 0xff, 0x96, 0x96, 0x96, 0xff, 0x63, 0x63, 0x63, 0xff, 0x62, 0x62, 0x62, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x47, 0x47, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0xbc, 0xff, 0x84, 0x84, 0xbc, 0xff, 0x84, 0x84, 0xbc, 0xff, 0x64, 0x64, 0xb0, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x89, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x84, 0x84, 0x84, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0xef, 0xef, 0xef, 0xff, 0x94, 0x94, 0x94, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0xde, 0xde, 0xde, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xed, 0xed, 0xed, 0xff, 0x92, 0x92, 0x92, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x47, 0x47, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x43, 0xa8, 0xff, 0x44, 0x44, 0xa8, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x89, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xea, 0xea, 0xea, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xad, 0xad, 0xad, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0xef, 0xef, 0xef, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x8c, 0x8c, 0x8c, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x47, 0x47, 0xaa, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xeb, 0xeb, 0xf3, 0xff, 0xf6, 0xf6, 0xf9, 0xff, 0xe3, 0xe3, 0xee, 0xff, 0x76, 0x76, 0xb7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x89, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xea, 0xea, 0xea, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xad, 0xad, 0xad, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x86, 0x86, 0x86, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x86, 0x86, 0x86, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x92, 0x92, 0x92, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x42, 0x42, 0xa8, 0xff, 0x5b, 0x5b, 0xae, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x41, 0x41, 0xa7, 0xff, 0xc3, 0xc3, 0xdc, 0xff, 0xe8, 0xe8, 0xf1, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x89, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x91, 0x91, 0x91, 0xff, 0xef, 0xef, 0xef, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x83, 0x83, 0x83, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x96, 0x96, 0x96, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x6d, 0x6d, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x3e, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x89, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x51, 0x51, 0x51, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x72, 0x72, 0x72, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x87, 0x87, 0x87, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0x62, 0x62, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x43, 0x43, 0xa8, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0xa3, 0xa3, 0xcb, 0xff, 0xf4, 0xf4, 0xf8, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x89, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 0x40, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x59, 0x59, 0x59, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xda, 0xda, 0xda, 0xff, 0xda, 0xda, 0xda, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0x58, 0x58, 0x58, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xed, 0xed, 0xed, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x89, 0x89, 0x89, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0xad, 0xad, 0xad, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0xb0, 0xb0, 0xd1, 0xff, 0xe1, 0xe1, 0xed, 0xff, 0xcc, 0xcc, 0xe0, 0xff, 0xd6, 0xd6, 0xe6, 0xff, 0xf8, 0xf8, 0xfb, 0xff, 0x9b, 0x9b, 0xc7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x88, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x65, 0x65, 0x65, 0xff, 0x87, 0x87, 0x87, 0xff, 0x68, 0x68, 0x68, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x41, 0x41, 0x41, 0xff, 0x83, 0x83, 0x83, 0xff, 0x83, 0x83, 0x83, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x84, 0x84, 0x84, 0xff, 0x83, 0x83, 0x83, 0xff, 0x83, 0x83, 0x83, 0xff, 0x83, 0x83, 0x83, 0xff, 0x83, 0x83, 0x83, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x85, 0x85, 0x85, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x77, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x81, 0x81, 0xbb, 0xff, 0x9f, 0x9f, 0xc9, 0xff, 0x93, 0x93, 0xc4, 0xff, 0x5a, 0x5a, 0xae, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa4, 0xff, 0x77, 0x77, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x53, 0xff, 0x53, 0x53, 0x54, 0xff, 0x53, 0x53, 0x8a, 0xff, 0x53, 0x53, 0xa0, 0xff, 0x53, 0x53, 0xa0, 0xff, 0x53, 0x53, 0xa0, 0xff, 0x53, 0x53, 0xa0, 0xff, 0x53, 0x53, 0xa0, 0xff, 0x53, 0x53, 0xa0, 0xff, 0x53, 0x53, 0x9b, 0xff, 0x57, 0x57, 0x75, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x78, 0x78, 0x78, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x46, 0x46, 0x46, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x69, 0x69, 0x69, 0xff, 0x76, 0x76, 0x76, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x50, 0x50, 0x50, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x43, 0x43, 0x43, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x47, 0x47, 0x47, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x65, 0x65, 0x65, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x71, 0x71, 0x71, 0xff, 0x46, 0x46, 0x46, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0xad, 0xad, 0xad, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0x8c, 0x8c, 0x9b, 0xff, 0x70, 0x70, 0x8e, 0xff, 0x6f, 0x6f, 0x8e, 0xff, 0x6f, 0x6f, 0x8e, 0xff, 0x6f, 0x6f, 0x8e, 0xff, 0x6f, 0x6f, 0x8e, 0xff, 0x6f, 0x6f, 0x8e, 0xff, 0x71, 0x71, 0x8f, 0xff, 0xa0, 0xa0, 0xa6, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0xff, 0x98, 0x98, 0x98, 0xff, 0x80, 0x80, 0x80, 0xff, 0x70, 0x70, 0x70, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xcd, 0xe1, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x58, 0x58, 0xad, 0xff, 0xf4, 0xf4, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x41, 0x41, 0x41, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xcf, 0xe2, 0xff, 0x3f, 0x3f, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x5a, 0x5a, 0xae, 0xff, 0xf4, 0xf4, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x41, 0x41, 0x41, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x88, 0x88, 0x88, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0x82, 0x82, 0x91, 0xff, 0x6f, 0x6f, 0x8e, 0xff, 0x6e, 0x6e, 0x8e, 0xff, 0x6e, 0x6e, 0x8e, 0xff, 0x6e, 0x6e, 0x8e, 0xff, 0x6e, 0x6e, 0x8e, 0xff, 0x6e, 0x6e, 0x8e, 0xff, 0x71, 0x71, 0x8d, 0xff, 0x93, 0x93, 0x9a, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0x94, 0x94, 0x94, 0xff, 0x80, 0x80, 0x80, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x62, 0x62, 0x62, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x45, 0x45, 0x45, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x4b, 0x4b, 0x4b, 0xff, 0x43, 0x43, 0x43, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 
-  0x80, 0x80, 0x80, 0xf8, 0x7d, 0x7d, 0x7d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xf8, 
-  0x80, 0x80, 0x80, 0xdb, 0x80, 0x80, 0x80, 0xff, 0x45, 0x45, 0x45, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x42, 0x42, 0x42, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x77, 0x77, 0x77, 0xff, 0x68, 0x68, 0x68, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x60, 0x60, 0x60, 0xff, 0x77, 0x77, 0x77, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x47, 0x47, 0x47, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x68, 0x68, 0x68, 0xff, 0x77, 0x77, 0x77, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x42, 0x42, 0x42, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x77, 0x77, 0x77, 0xff, 0x71, 0x71, 0x71, 0xff, 0x49, 0x49, 0x49, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x45, 0x45, 0x45, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x53, 0x53, 0x53, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x45, 0x45, 0x45, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xdb, 
-  0x80, 0x80, 0x80, 0xa7, 0x80, 0x80, 0x80, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x62, 0x62, 0x62, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x40, 0x40, 0x40, 0xff, 0x50, 0x50, 0x50, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x6c, 0x6c, 0x6c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x78, 0x78, 0x78, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x70, 0x70, 0x70, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x46, 0x46, 0x46, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa7, 
-  0x80, 0x80, 0x80, 0x57, 0x80, 0x80, 0x80, 0xff, 0x71, 0x71, 0x71, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x68, 0x68, 0x68, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x74, 0x74, 0x74, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x68, 0x68, 0x68, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x6b, 0x6b, 0x6b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x56, 0x56, 0x56, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x77, 0x77, 0x77, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x78, 0x78, 0x78, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x51, 0x51, 0x51, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x57, 
-  0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0xe3, 0x80, 0x80, 0x80, 0xff, 0x55, 0x55, 0x55, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x51, 0x51, 0x51, 0xff, 0x40, 0x40, 0x40, 0xff, 0x47, 0x47, 0x47, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x5f, 0x5f, 0x5f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x62, 0x62, 0x62, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x71, 0x71, 0x71, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x44, 0x44, 0x44, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x63, 0x63, 0x63, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x45, 0x45, 0x45, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x55, 0x55, 0x55, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe3, 0x80, 0x80, 0x80, 0x04, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x5c, 0x80, 0x80, 0x80, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x51, 0x51, 0x51, 0xff, 0x60, 0x60, 0x60, 0xff, 0x50, 0x50, 0x50, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x60, 0x60, 0x60, 0xff, 0x57, 0x57, 0x57, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4f, 0x4f, 0x4f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x50, 0x50, 0x50, 0xff, 0x60, 0x60, 0x60, 0xff, 0x51, 0x51, 0x51, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x60, 0x60, 0x60, 0xff, 0x58, 0x58, 0x58, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x43, 0x43, 0x43, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x5b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xa8, 0x80, 0x80, 0x80, 0xff, 0x78, 0x78, 0x78, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0x78, 0x78, 0x78, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa8, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80, 0xbb, 0x80, 0x80, 0x80, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xbb, 0x80, 0x80, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x79, 0x79, 0x79, 0xff, 0x65, 0x65, 0x65, 0xff, 0x55, 0x55, 0x55, 0xff, 0x49, 0x49, 0x49, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x41, 0x41, 0x41, 0xff, 0x49, 0x49, 0x49, 0xff, 0x55, 0x55, 0x55, 0xff, 0x65, 0x65, 0x65, 0xff, 0x79, 0x79, 0x79, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x00, 0x80, 0x80, 0x80, 0x3c, 0x80, 0x80, 0x80, 0xc0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xc0, 0x80, 0x80, 0x80, 0x3c, 0x37, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x27, 0x80, 0x80, 0x80, 0x77, 0x80, 0x80, 0x80, 0xa8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xe7, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xf3, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xf4, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xc8, 0x80, 0x80, 0x80, 0xa8, 0x80, 0x80, 0x80, 0x77, 0x80, 0x80, 0x80, 0x27, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9b, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x82, 0x82, 0x82, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xcf, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x81, 0x81, 0x81, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xf4, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0xf4, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xbf, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x2c, 0x80, 0x80, 0x80, 0xeb, 0x80, 0x80, 0x80, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xdf, 0x80, 0x80, 0x80, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x54, 0x80, 0x80, 0x80, 0xef, 0x80, 0x80, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80, 0x57, 0x80, 0x80, 0x80, 0xa4, 0x80, 0x80, 0x80, 0xd7, 0x80, 0x80, 0x80, 0xf7, 0xa9, 0x80, 
+  0x80, 0x80, 0xff, 0x04, 0x80, 0x80, 0x80, 0xf7, 0x80, 0x80, 0x80, 0xd7, 0x80, 0x80, 0x80, 0xa4, 0x80, 0x80, 0x80, 0x57, 0x80, 0x80, 0x80, 0x07, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x82, 
+  0x82, 0x03, 0x80, 0x80, 0x80, 0x68, 0x80, 0x80, 0x80, 0xe8, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7c, 0x7c, 0x7c, 0xff, 0xa9, 0x7a, 0x7a, 0x7a, 0xff, 0x00, 0x7c, 0x7c, 0x7c, 0xff, 0x82, 0x80, 
+  0x80, 0x80, 0xff, 0x01, 0x80, 0x80, 0x80, 0xe8, 0x80, 0x80, 0x80, 0x6b, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x14, 0x80, 0x80, 0x80, 0xbf, 0x81, 0x80, 0x80, 0x80, 0xff, 0x02, 
+  0x70, 0x70, 0x70, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x45, 0x45, 0x45, 0xff, 0xab, 0x40, 0x40, 0x40, 0xff, 0x02, 0x45, 0x45, 0x45, 0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x70, 0x70, 0x70, 0xff, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x01, 0x80, 0x80, 0x80, 0xbf, 0x80, 0x80, 0x80, 0x14, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x80, 0x80, 0x18, 0x80, 0x80, 0x80, 0xd8, 0x80, 0x80, 0x80, 0xff, 0x77, 0x77, 
+  0x77, 0xff, 0x50, 0x50, 0x50, 0xff, 0xb1, 0x40, 0x40, 0x40, 0xff, 0x04, 0x50, 0x50, 0x50, 0xff, 0x77, 0x77, 0x77, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xd8, 0x80, 0x80, 0x80, 0x18, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0xc7, 0x80, 0x80, 0x80, 0xff, 0x72, 0x72, 0x72, 0xff, 0x44, 0x44, 0x44, 0xff, 0xb3, 0x40, 0x40, 0x40, 0xff, 0x04, 
+  0x44, 0x44, 0x44, 0xff, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xc7, 0x80, 0x80, 0x80, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x80, 0x80, 0x78, 0x80, 0x80, 
+  0x80, 0xff, 0x76, 0x76, 0x76, 0xff, 0x43, 0x43, 0x43, 0xff, 0xb5, 0x40, 0x40, 0x40, 0xff, 0x08, 0x43, 0x43, 0x43, 0xff, 0x76, 0x76, 0x76, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x77, 
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x0f, 0x80, 0x80, 0x80, 0xf0, 0x7f, 0x7f, 0x7f, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0xb7, 0x40, 0x40, 0x40, 0xff, 0x06, 0x4e, 0x4e, 0x4e, 0xff, 0x7f, 0x7f, 
+  0x7f, 0xff, 0x80, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x0f, 0x80, 0x80, 0x80, 0x67, 0x80, 0x80, 0x80, 0xff, 0x6d, 0x6d, 0x6d, 0xff, 0x85, 0x40, 0x40, 0x40, 0xff, 0x01, 0x41, 0x41, 0x41, 0xff, 
+  0x51, 0x51, 0x51, 0xff, 0xab, 0x52, 0x52, 0x52, 0xff, 0x00, 0x43, 0x43, 0x43, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x05, 0x6d, 0x6d, 0x6d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x67, 
+  0x80, 0x80, 0x80, 0xb0, 0x80, 0x80, 0x80, 0xff, 0x56, 0x56, 0x56, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x01, 0x63, 0x63, 0x63, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0xac, 0x80, 0x80, 0x80, 0xff, 0x02, 
+  0x7f, 0x7f, 0x7f, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x43, 0x43, 0x43, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x05, 0x56, 0x56, 0x56, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xb0, 0x80, 0x80, 
+  0x80, 0xe3, 0x80, 0x80, 0x80, 0xff, 0x43, 0x43, 0x43, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x64, 0x64, 0x64, 0xff, 0xb0, 0x80, 0x80, 0x80, 0xff, 0x00, 0x6f, 0x6f, 0x6f, 0xff, 0x82, 0x40, 
+  0x40, 0x40, 0xff, 0x04, 0x43, 0x43, 0x43, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe3, 0x80, 0x80, 0x80, 0xfb, 0x7c, 0x7c, 0x7c, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x01, 0x43, 0x43, 
+  0x43, 0xff, 0x7e, 0x7e, 0x7e, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7c, 0x7c, 0x7c, 0xff, 0xa2, 0x77, 0x77, 0x77, 0xff, 0x00, 0x77, 0x77, 0x7a, 0xff, 0x85, 0x77, 0x77, 0x88, 0xff, 0x01, 
+  0x77, 0x77, 0x83, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x4f, 0x4f, 0x4f, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x03, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xfb, 
+  0x80, 0x80, 0x80, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x45, 0x45, 0x45, 0xff, 0x82, 0x40, 0x40, 0x40, 
+  0xff, 0x00, 0x3e, 0x3e, 0x3e, 0xff, 0x86, 0x40, 0x40, 0x40, 0xff, 0x81, 0x3f, 0x3f, 0x3f, 0xff, 0x94, 0x40, 0x40, 0x40, 0xff, 0x01, 0x40, 0x40, 0x56, 0xff, 0x40, 0x40, 0x9f, 0xff, 0x86, 0x40, 
+  0x40, 0xa7, 0xff, 0x01, 0x40, 0x40, 0x8a, 0xff, 0x79, 0x79, 0x79, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0x5f, 0x5f, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x06, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 
+  0x40, 0xff, 0x76, 0x76, 0x76, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x82, 0x82, 0x82, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0xc1, 0xc1, 0xc1, 0xff, 
+  0x81, 0xee, 0xee, 0xee, 0xff, 0x00, 0xc1, 0xc1, 0xc1, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x04, 0xb8, 0xb8, 0xb8, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xea, 0xea, 0xea, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 
+  0x8b, 0x8b, 0x8b, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x05, 0x5b, 0x5b, 0x5b, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0x70, 0x70, 
+  0x70, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x03, 0x40, 0x40, 0x82, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x45, 0x45, 0xa9, 0xff, 0xe2, 0xe2, 0xed, 0xff, 0x82, 0xe1, 0xe1, 0xed, 0xff, 0x00, 0x9f, 0x9f, 
+  0xc8, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x00, 0x77, 0x77, 0x82, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x07, 0x3f, 0x3f, 0x3f, 0xff, 0x41, 0x41, 
+  0x41, 0xff, 0xec, 0xec, 0xec, 0xff, 0xac, 0xac, 0xac, 0xff, 0x40, 0x40, 0x40, 0xff, 0x9d, 0x9d, 0x9d, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x46, 0x46, 0x46, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 
+  0xab, 0xab, 0xab, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0x81, 0x54, 0x54, 0x54, 0xff, 0x01, 0xe9, 0xe9, 0xe9, 0xff, 0xa9, 0xa9, 0xa9, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x05, 0xc2, 0xc2, 0xc2, 0xff, 
+  0x84, 0x84, 0x84, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0xaa, 0xaa, 0xaa, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0x69, 0x69, 0x69, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x05, 0x55, 0x55, 0x55, 0xff, 0x96, 0x96, 
+  0x96, 0xff, 0x63, 0x63, 0x63, 0xff, 0x62, 0x62, 0x62, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x03, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 
+  0x47, 0x47, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x84, 0x84, 0xbc, 0xff, 0x00, 0x64, 0x64, 0xb0, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x00, 0x77, 0x77, 0x89, 0xff, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 
+  0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x3f, 0x3f, 0x3f, 0xff, 0x84, 0x84, 0x84, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x02, 0x3f, 0x3f, 0x3f, 0xff, 
+  0xef, 0xef, 0xef, 0xff, 0x94, 0x94, 0x94, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xdf, 0xdf, 0xdf, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xb0, 0xb0, 0xb0, 0xff, 
+  0xde, 0xde, 0xde, 0xff, 0x86, 0x40, 0x40, 0x40, 0xff, 0x01, 0xed, 0xed, 0xed, 0xff, 0x92, 0x92, 0x92, 0xff, 0x85, 0x40, 0x40, 0x40, 0xff, 0x01, 0x8b, 0x8b, 0x8b, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 
+  0x81, 0x40, 0x40, 0x40, 0xff, 0x05, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x47, 0x47, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x43, 0xa8, 0xff, 0x44, 0x44, 0xa8, 0xff, 0x83, 0x40, 
+  0x40, 0xa7, 0xff, 0x00, 0x77, 0x77, 0x89, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x3f, 0x3f, 0x3f, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0xea, 0xea, 
+  0xea, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x01, 0xe1, 0xe1, 0xe1, 0xff, 0xad, 0xad, 0xad, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xf0, 0xf0, 0xf0, 0xff, 0x8b, 0x8b, 0x8b, 0xff, 0x81, 0x40, 
+  0x40, 0x40, 0xff, 0x01, 0x8b, 0x8b, 0x8b, 0xff, 0xef, 0xef, 0xef, 0xff, 0x85, 0x40, 0x40, 0x40, 0xff, 0x02, 0x8c, 0x8c, 0x8c, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x83, 0x40, 
+  0x40, 0x40, 0xff, 0x03, 0xaf, 0xaf, 0xaf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x07, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 
+  0xa7, 0xff, 0x47, 0x47, 0xaa, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xeb, 0xeb, 0xf3, 0xff, 0xf6, 0xf6, 0xf9, 0xff, 0xe3, 0xe3, 0xee, 0xff, 0x76, 0x76, 0xb7, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x00, 
+  0x77, 0x77, 0x89, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 
+  0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x3f, 0x3f, 0x3f, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xea, 0xea, 0xea, 0xff, 0x82, 0x40, 
+  0x40, 0x40, 0xff, 0x01, 0xdf, 0xdf, 0xdf, 0xff, 0xad, 0xad, 0xad, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xf3, 0xf3, 0xf3, 0xff, 0x86, 0x86, 0x86, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 
+  0x86, 0x86, 0x86, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x02, 0x7b, 0x7b, 0x7b, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x92, 0x92, 0x92, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x03, 
+  0xaa, 0xaa, 0xaa, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x07, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x42, 0x42, 
+  0xa8, 0xff, 0x5b, 0x5b, 0xae, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x41, 0x41, 0xa7, 0xff, 0xc3, 0xc3, 0xdc, 0xff, 0xe8, 0xe8, 0xf1, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x00, 0x77, 0x77, 0x89, 0xff, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 
+  0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x3f, 0x3f, 0x3f, 0xff, 0x91, 0x91, 0x91, 0xff, 0xef, 0xef, 0xef, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x01, 
+  0xe8, 0xe8, 0xe8, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xe7, 0xe7, 0xe7, 0xff, 0xa3, 0xa3, 0xa3, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xa4, 0xa4, 0xa4, 0xff, 
+  0xe6, 0xe6, 0xe6, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x02, 0x83, 0x83, 0x83, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x96, 0x96, 0x96, 0xff, 0x87, 0x40, 0x40, 0x40, 0xff, 0x04, 0x5c, 0x5c, 0x5c, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 0x84, 0x40, 0x40, 0xa7, 0xff, 0x04, 0x6d, 0x6d, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x3e, 
+  0xa7, 0xff, 0x40, 0x40, 0xa7, 0xff, 0x77, 0x77, 0x89, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 
+  0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x07, 0x3f, 0x3f, 0x3f, 0xff, 0x51, 0x51, 0x51, 0xff, 
+  0xf9, 0xf9, 0xf9, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x40, 0x40, 0x40, 0xff, 0x72, 0x72, 0x72, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0x61, 0x61, 0x61, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xc1, 0xc1, 
+  0xc1, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x01, 0xd4, 0xd4, 0xd4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x02, 0x87, 0x87, 0x87, 0xff, 0xf2, 0xf2, 
+  0xf2, 0xff, 0x8e, 0x8e, 0x8e, 0xff, 0x88, 0x40, 0x40, 0x40, 0xff, 0x06, 0x6f, 0x6f, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0x62, 0x62, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x87, 0xff, 
+  0x40, 0x40, 0xa7, 0xff, 0x43, 0x43, 0xa8, 0xff, 0x82, 0x40, 0x40, 0xa7, 0xff, 0x01, 0xa3, 0xa3, 0xcb, 0xff, 0xf4, 0xf4, 0xf8, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x00, 0x77, 0x77, 0x89, 0xff, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 
+  0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x06, 0x3f, 0x3f, 0x3f, 0xff, 0x40, 0x40, 0x40, 0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcd, 0xcd, 
+  0xcd, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xb0, 0xb0, 0xb0, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x01, 0x59, 0x59, 0x59, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0x81, 0xda, 0xda, 0xda, 0xff, 0x01, 0xe7, 0xe7, 
+  0xe7, 0xff, 0x58, 0x58, 0x58, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x02, 0x3f, 0x3f, 0x3f, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xed, 0xed, 0xed, 0xff, 0x82, 0xd7, 0xd7, 0xd7, 0xff, 0x00, 0x89, 0x89, 
+  0x89, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x05, 0xad, 0xad, 0xad, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 
+  0x81, 0x40, 0x40, 0x40, 0xff, 0x07, 0x40, 0x40, 0x87, 0xff, 0x40, 0x40, 0xa7, 0xff, 0xb0, 0xb0, 0xd1, 0xff, 0xe1, 0xe1, 0xed, 0xff, 0xcc, 0xcc, 0xe0, 0xff, 0xd6, 0xd6, 0xe6, 0xff, 0xf8, 0xf8, 
+  0xfb, 0xff, 0x9b, 0x9b, 0xc7, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x00, 0x77, 0x77, 0x88, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 
+  0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x3f, 0x3f, 
+  0x3f, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x02, 0x65, 0x65, 0x65, 0xff, 0x87, 0x87, 0x87, 0xff, 0x68, 0x68, 0x68, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x00, 0x41, 0x41, 0x41, 0xff, 0x81, 0x83, 
+  0x83, 0x83, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x00, 0x84, 0x84, 0x84, 0xff, 0x83, 0x83, 0x83, 0x83, 0xff, 0x00, 0x5c, 0x5c, 0x5c, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x03, 0x85, 0x85, 0x85, 
+  0xff, 0xa8, 0xa8, 0xa8, 0xff, 0xa5, 0xa5, 0xa5, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x40, 0x40, 0x77, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x03, 0x81, 0x81, 0xbb, 
+  0xff, 0x9f, 0x9f, 0xc9, 0xff, 0x93, 0x93, 0xc4, 0xff, 0x5a, 0x5a, 0xae, 0xff, 0x81, 0x40, 0x40, 0xa7, 0xff, 0x01, 0x40, 0x40, 0xa4, 0xff, 0x77, 0x77, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x4e, 
+  0x4e, 0x4e, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5d, 0x5d, 0x5d, 0xff, 0xa1, 0x53, 0x53, 0x53, 0xff, 0x01, 0x53, 0x53, 0x54, 0xff, 0x53, 0x53, 0x8a, 0xff, 0x85, 0x53, 0x53, 0xa0, 0xff, 
+  0x02, 0x53, 0x53, 0x9b, 0xff, 0x57, 0x57, 0x75, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5b, 0x5b, 0x5b, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 
+  0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x00, 0x78, 0x78, 0x78, 0xff, 0xb0, 0x80, 0x80, 0x80, 0xff, 0x01, 0x7d, 0x7d, 0x7d, 0xff, 0x46, 
+  0x46, 0x46, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x01, 0x51, 0x51, 0x51, 
+  0xff, 0x7d, 0x7d, 0x7d, 0xff, 0xae, 0x80, 0x80, 0x80, 0xff, 0x01, 0x7f, 0x7f, 0x7f, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 
+  0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x85, 0x40, 0x40, 0x40, 0xff, 0x02, 0x4a, 0x4a, 0x4a, 0xff, 0x69, 0x69, 0x69, 0xff, 0x76, 0x76, 0x76, 0xff, 0xab, 0x77, 0x77, 0x77, 0xff, 0x01, 0x6c, 
+  0x6c, 0x6c, 0xff, 0x50, 0x50, 0x50, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 
+  0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 
+  0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 
+  0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 
+  0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 
+  0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x01, 0x43, 0x43, 0x43, 0xff, 0x4d, 0x4d, 0x4d, 0xff, 0xae, 0x4e, 0x4e, 0x4e, 0xff, 0x00, 0x47, 0x47, 0x47, 0xff, 0x84, 
+  0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x01, 0x65, 0x65, 0x65, 0xff, 0x7e, 0x7e, 0x7e, 
+  0xff, 0xb0, 0x80, 0x80, 0x80, 0xff, 0x01, 0x71, 0x71, 0x71, 0xff, 0x46, 0x46, 0x46, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 
+  0x7b, 0x7b, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x03, 0x5d, 0x5d, 0x5d, 0xff, 0x80, 0x80, 0x80, 0xff, 0x8a, 0x8a, 0x8a, 0xff, 0xad, 0xad, 0xad, 0xff, 0x92, 0xaf, 0xaf, 0xaf, 0xff, 0x01, 0x8c, 
+  0x8c, 0x9b, 0xff, 0x70, 0x70, 0x8e, 0xff, 0x84, 0x6f, 0x6f, 0x8e, 0xff, 0x01, 0x71, 0x71, 0x8f, 0xff, 0xa0, 0xa0, 0xa6, 0xff, 0x92, 0xaf, 0xaf, 0xaf, 0xff, 0x02, 0x98, 0x98, 0x98, 0xff, 0x80, 
+  0x80, 0x80, 0xff, 0x70, 0x70, 0x70, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 
+  0x02, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0xef, 0xef, 0xef, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x00, 0xcd, 0xcd, 0xe1, 0xff, 0x87, 0x40, 0x40, 0xa7, 0xff, 0x01, 0x58, 0x58, 0xad, 
+  0xff, 0xf4, 0xf4, 0xf8, 0xff, 0x91, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfd, 0xfd, 0xfd, 0xff, 0x9b, 0x9b, 0x9b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x41, 0x41, 0x41, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 
+  0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x02, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0xec, 0xec, 0xec, 
+  0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x01, 0xcf, 0xcf, 0xe2, 0xff, 0x3f, 0x3f, 0xa7, 0xff, 0x86, 0x40, 0x40, 0xa7, 0xff, 0x01, 0x5a, 0x5a, 0xae, 0xff, 0xf4, 0xf4, 0xf8, 0xff, 0x91, 0xff, 0xff, 
+  0xff, 0xff, 0x03, 0xfc, 0xfc, 0xfc, 0xff, 0x9a, 0x9a, 0x9a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x41, 0x41, 0x41, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 
+  0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x03, 0x5b, 0x5b, 0x5b, 0xff, 0x80, 0x80, 0x80, 0xff, 0x88, 0x88, 0x88, 0xff, 0xa4, 0xa4, 0xa4, 0xff, 0x92, 0xa3, 0xa3, 
+  0xa3, 0xff, 0x01, 0x82, 0x82, 0x91, 0xff, 0x6f, 0x6f, 0x8e, 0xff, 0x84, 0x6e, 0x6e, 0x8e, 0xff, 0x01, 0x71, 0x71, 0x8d, 0xff, 0x93, 0x93, 0x9a, 0xff, 0x92, 0xa3, 0xa3, 0xa3, 0xff, 0x02, 0x94, 
+  0x94, 0x94, 0xff, 0x80, 0x80, 0x80, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x83, 
+  0x40, 0x40, 0x40, 0xff, 0x01, 0x62, 0x62, 0x62, 0xff, 0x7d, 0x7d, 0x7d, 0xff, 0xb0, 0x80, 0x80, 0x80, 0xff, 0x01, 0x6f, 0x6f, 0x6f, 0xff, 0x45, 0x45, 0x45, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 
+  0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x85, 0x40, 0x40, 0x40, 0xff, 0x00, 0x4a, 0x4a, 0x4a, 0xff, 0xae, 0x4b, 0x4b, 0x4b, 0xff, 0x00, 0x43, 
+  0x43, 0x43, 0xff, 0x84, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 
+  0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 
+  0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x03, 0x7b, 0x7b, 0x7b, 0xff, 0x80, 0x80, 0x80, 
+  0xff, 0x80, 0x80, 0x80, 0xf8, 0x7d, 0x7d, 0x7d, 0xff, 0xbb, 0x40, 0x40, 0x40, 0xff, 0x04, 0x7d, 0x7d, 0x7d, 0xff, 0x80, 0x80, 0x80, 0xf8, 0x80, 0x80, 0x80, 0xdb, 0x80, 0x80, 0x80, 0xff, 0x45, 
+  0x45, 0x45, 0xff, 0x89, 0x40, 0x40, 0x40, 0xff, 0x03, 0x42, 0x42, 0x42, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x77, 0x77, 0x77, 0xff, 0x68, 0x68, 0x68, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x03, 0x60, 
+  0x60, 0x60, 0xff, 0x77, 0x77, 0x77, 0xff, 0x6f, 0x6f, 0x6f, 0xff, 0x47, 0x47, 0x47, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x03, 0x54, 0x54, 0x54, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x7e, 0x7e, 0x7e, 
+  0xff, 0x61, 0x61, 0x61, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x03, 0x68, 0x68, 0x68, 0xff, 0x77, 0x77, 0x77, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x42, 0x42, 0x42, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 
+  0x03, 0x5e, 0x5e, 0x5e, 0xff, 0x77, 0x77, 0x77, 0xff, 0x71, 0x71, 0x71, 0xff, 0x49, 0x49, 0x49, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x03, 0x45, 0x45, 0x45, 0xff, 0x69, 0x69, 0x69, 0xff, 0x6f, 
+  0x6f, 0x6f, 0xff, 0x53, 0x53, 0x53, 0xff, 0x8b, 0x40, 0x40, 0x40, 0xff, 0x05, 0x45, 0x45, 0x45, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xdb, 0x80, 0x80, 0x80, 0xa7, 0x80, 0x80, 0x80, 
+  0xff, 0x5a, 0x5a, 0x5a, 0xff, 0x89, 0x40, 0x40, 0x40, 0xff, 0x00, 0x62, 0x62, 0x62, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x5e, 0x5e, 0x5e, 0xff, 0x40, 0x40, 0x40, 0xff, 0x50, 0x50, 0x50, 
+  0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x6c, 0x6c, 0x6c, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x00, 0x78, 0x78, 0x78, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x48, 0x48, 0x48, 0xff, 0x40, 
+  0x40, 0x40, 0xff, 0x5e, 0x5e, 0x5e, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x61, 0x61, 0x61, 0xff, 0x40, 0x40, 0x40, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x70, 
+  0x70, 0x70, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x00, 0x6f, 0x6f, 0x6f, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x7e, 0x7e, 0x7e, 0xff, 0x46, 0x46, 0x46, 0xff, 0x8a, 0x40, 0x40, 0x40, 0xff, 
+  0x05, 0x5a, 0x5a, 0x5a, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa7, 0x80, 0x80, 0x80, 0x57, 0x80, 0x80, 0x80, 0xff, 0x71, 0x71, 0x71, 0xff, 0x89, 0x40, 0x40, 0x40, 0xff, 0x00, 0x6b, 
+  0x6b, 0x6b, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x68, 0x68, 0x68, 0xff, 0x40, 0x40, 0x40, 0xff, 0x5b, 0x5b, 0x5b, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x74, 0x74, 0x74, 0xff, 0x81, 
+  0x40, 0x40, 0x40, 0xff, 0x00, 0x7b, 0x7b, 0x7b, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x02, 0x4d, 0x4d, 0x4d, 0xff, 0x40, 0x40, 0x40, 0xff, 0x68, 0x68, 0x68, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 
+  0x02, 0x6b, 0x6b, 0x6b, 0xff, 0x40, 0x40, 0x40, 0xff, 0x56, 0x56, 0x56, 0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x77, 0x77, 0x77, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x00, 0x78, 0x78, 0x78, 
+  0xff, 0x82, 0x80, 0x80, 0x80, 0xff, 0x00, 0x51, 0x51, 0x51, 0xff, 0x8a, 0x40, 0x40, 0x40, 0xff, 0x06, 0x71, 0x71, 0x71, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x57, 0x80, 0x80, 0x80, 
+  0x04, 0x80, 0x80, 0x80, 0xe3, 0x80, 0x80, 0x80, 0xff, 0x55, 0x55, 0x55, 0xff, 0x88, 0x40, 0x40, 0x40, 0xff, 0x07, 0x54, 0x54, 0x54, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x80, 0x80, 0x80, 0xff, 0x7f, 
+  0x7f, 0x7f, 0xff, 0x51, 0x51, 0x51, 0xff, 0x40, 0x40, 0x40, 0xff, 0x47, 0x47, 0x47, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x5f, 0x5f, 0x5f, 0xff, 0x81, 0x40, 0x40, 
+  0x40, 0xff, 0x00, 0x62, 0x62, 0x62, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x71, 0x71, 0x71, 0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x07, 0x51, 0x51, 0x51, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x80, 
+  0x80, 0x80, 0xff, 0x7f, 0x7f, 0x7f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x44, 0x44, 0x44, 0xff, 0x7b, 0x7b, 0x7b, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x63, 0x63, 0x63, 
+  0xff, 0x81, 0x40, 0x40, 0x40, 0xff, 0x00, 0x6d, 0x6d, 0x6d, 0xff, 0x81, 0x80, 0x80, 0x80, 0xff, 0x01, 0x7c, 0x7c, 0x7c, 0xff, 0x45, 0x45, 0x45, 0xff, 0x89, 0x40, 0x40, 0x40, 0xff, 0x08, 0x55, 
+  0x55, 0x55, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xe3, 0x80, 0x80, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x5c, 0x80, 0x80, 0x80, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x48, 
+  0x48, 0x48, 0xff, 0x88, 0x40, 0x40, 0x40, 0xff, 0x02, 0x51, 0x51, 0x51, 0xff, 0x60, 0x60, 0x60, 0xff, 0x50, 0x50, 0x50, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x02, 0x4a, 0x4a, 0x4a, 0xff, 0x60, 
+  0x60, 0x60, 0xff, 0x57, 0x57, 0x57, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x01, 0x4f, 0x4f, 0x4f, 0xff, 0x54, 0x54, 0x54, 0xff, 0x83, 0x40, 0x40, 0x40, 0xff, 0x02, 0x50, 0x50, 0x50, 0xff, 0x60, 
+  0x60, 0x60, 0xff, 0x51, 0x51, 0x51, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x02, 0x48, 0x48, 0x48, 0xff, 0x60, 0x60, 0x60, 0xff, 0x58, 0x58, 0x58, 0xff, 0x82, 0x40, 0x40, 0x40, 0xff, 0x03, 0x43, 
+  0x43, 0x43, 0xff, 0x65, 0x65, 0x65, 0xff, 0x6a, 0x6a, 0x6a, 0xff, 0x4e, 0x4e, 0x4e, 0xff, 0x89, 0x40, 0x40, 0x40, 0xff, 0x03, 0x48, 0x48, 0x48, 0xff, 0x7a, 0x7a, 0x7a, 0xff, 0x80, 0x80, 0x80, 
+  0xff, 0x80, 0x80, 0x80, 0x5b, 0x82, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x80, 0x80, 0xa8, 0x80, 0x80, 0x80, 0xff, 0x78, 0x78, 0x78, 0xff, 0x4a, 0x4a, 0x4a, 0xff, 0xb3, 0x40, 0x40, 0x40, 0xff, 
+  0x03, 0x4a, 0x4a, 0x4a, 0xff, 0x78, 0x78, 0x78, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xa8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80, 0xbb, 0x80, 
+  0x80, 0x80, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x5d, 0x5d, 0x5d, 0xff, 0xb1, 0x40, 0x40, 0x40, 0xff, 0x04, 0x5d, 0x5d, 0x5d, 0xff, 0x7c, 0x7c, 0x7c, 0xff, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 
+  0xbb, 0x80, 0x80, 0x80, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x93, 0x81, 0x80, 0x80, 0x80, 0xff, 0x03, 0x79, 0x79, 0x79, 0xff, 0x65, 0x65, 0x65, 
+  0xff, 0x55, 0x55, 0x55, 0xff, 0x49, 0x49, 0x49, 0xff, 0xa9, 0x41, 0x41, 0x41, 0xff, 0x03, 0x49, 0x49, 0x49, 0xff, 0x55, 0x55, 0x55, 0xff, 0x65, 0x65, 0x65, 0xff, 0x79, 0x79, 0x79, 0xff, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x01, 0x80, 0x80, 0x80, 0x93, 0x80, 0x80, 0x80, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x3c, 0x80, 0x80, 0x80, 0xc0, 0xb1, 0x80, 0x80, 0x80, 0xff, 
+  0x01, 0x80, 0x80, 0x80, 0xc0, 0x80, 0x80, 0x80, 0x3c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0x27, 0x80, 0x80, 0x80, 0x77, 0x80, 0x80, 0x80, 0xa8, 0x88, 0x80, 0x80, 0x80, 0xc8, 
+  0x00, 0x80, 0x80, 0x80, 0xe7, 0x81, 0x80, 0x80, 0x80, 0xff, 0x88, 0x80, 0x80, 0x80, 0xc8, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0xe8, 0x87, 0x80, 0x80, 0x80, 0xc8, 0x02, 0x80, 
+  0x80, 0x80, 0xf3, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xf4, 0x88, 0x80, 0x80, 0x80, 0xc8, 0x02, 0x80, 0x80, 0x80, 0xa8, 0x80, 0x80, 0x80, 0x77, 0x80, 0x80, 0x80, 0x27, 0x99, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9b, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x82, 0x82, 0x82, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x94, 
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xcf, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x81, 0x80, 0x80, 0x80, 
+  0xff, 0x00, 0x80, 0x80, 0x80, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x94, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xd0, 0x80, 
+  0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 
+  0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x94, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0xa5, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x94, 0x87, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x81, 0x80, 0x80, 0x80, 0xff, 
+  0x00, 0x80, 0x80, 0x80, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x94, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 
+  0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x9c, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 
+  0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x94, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x80, 0x80, 0x80, 0x9c, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x81, 0x81, 0x81, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x80, 0xff, 0x00, 0x80, 0x80, 0x80, 0x94, 0x87, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xd0, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 
+  0x80, 0xf4, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xf4, 0x80, 0x80, 0x80, 0xff, 0x80, 0x80, 0x80, 0x84, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0xbf, 0x80, 0x80, 
+  0x80, 0xff, 0x80, 0x80, 0x80, 0xbc, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0x2c, 0x80, 0x80, 0x80, 0xeb, 0x80, 0x80, 0x80, 0x87, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xdf, 0x80, 0x80, 0x80, 0x27, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x80, 0x54, 0x80, 0x80, 0x80, 0xef, 0x80, 0x80, 0x80, 0x54, 0x92, 0x00, 0x00, 0x00, 
+  0x00, 
 #endif
 };
 
@@ -282,8 +488,7 @@ const lv_img_dsc_t powermeter_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( powermeter_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = powermeter_64px_map,
 };
-
@@ -32,6 +32,7 @@
 #include "gui/widget.h"
 
 #include "hardware/json_psram_allocator.h"
+#include "hardware/config_store.h"
 
 powermeter_config_t powermeter_config;
 
@@ -96,7 +97,10 @@ powermeter_config_t *powermeter_get_config( void ) {
     return( &powermeter_config );
 }
 
-void powermeter_load_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void powermeter_load_json_config( void ) {
     fs::File file = SPIFFS.open( POWERMETER_JSON_CONFIG_FILE, FILE_READ );
     if (!file) {
         log_e("Can't open file: %s!", POWERMETER_JSON_CONFIG_FILE );
@@ -124,30 +128,12 @@ void powermeter_load_config( void ) {
     file.close();
 }
 
-void powermeter_save_config( void ) {
-    fs::File file = SPIFFS.open( POWERMETER_JSON_CONFIG_FILE, FILE_WRITE );
+void powermeter_load_config( void ) {
+    config_store_register( "powermeter", &powermeter_config, sizeof( powermeter_config ), powermeter_load_json_config );
+}
 
-    if (!file) {
-        log_e("Can't open file: %s!", POWERMETER_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["powermeter"]["server"] = powermeter_config.server;
-        doc["powermeter"]["port"] = powermeter_config.port;
-        doc["powermeter"]["ssl"] = powermeter_config.ssl;
-        doc["powermeter"]["user"] = powermeter_config.user;
-        doc["powermeter"]["password"] = powermeter_config.password;
-        doc["powermeter"]["topic"] = powermeter_config.topic;
-        doc["powermeter"]["autoconnect"] = powermeter_config.autoconnect;
-        doc["powermeter"]["widget"] = powermeter_config.widget;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+void powermeter_save_config( void ) {
+    config_store_save( &powermeter_config );
 }
 
 
@@ -35,7 +35,7 @@
 #include "gui/widget.h"
 
 #include "hardware/wifictl.h"
-#include "hardware/json_psram_allocator.h"
+#include "hardware/json_msg.h"
 
 lv_obj_t *powermeter_main_tile = NULL;
 lv_style_t powermeter_main_style;
@@ -54,6 +54,7 @@ lv_obj_t *power_label = NULL;
 
 WiFiClient espClient;
 PubSubClient powermeter_mqtt_client( espClient );
+StaticJsonDocument<256> powermeter_filter;
 
 LV_IMG_DECLARE(exit_32px);
 LV_IMG_DECLARE(setup_32px);
@@ -67,51 +68,44 @@ static void enter_powermeter_setup_event_cb( lv_obj_t * obj, lv_event_t event );
 void powermeter_main_task( lv_task_t * task );
 
 void callback(char* topic, byte* payload, unsigned int length) {
-    char *msg = NULL;
-    msg = (char*)ps_calloc( length + 1, 1 );
-    if ( msg == NULL ) {
-        log_e("ps_calloc failed");
+    /*
+     * decode in place from the mqtt client buffer, only the used fields are kept
+     */
+    JsonDocument *doc = json_msg_decode( (char*)payload, length, &powermeter_filter );
+    if ( doc == NULL ) {
+        log_e("powermeter message decode failed");
         return;
     }
-    memcpy( msg, payload, length );
 
-    SpiRamJsonDocument doc( strlen( msg ) * 2 );
-
-    DeserializationError error = deserializeJson( doc, msg );
-    if ( error ) {
-        log_e("powermeter message deserializeJson() failed: %s", error.c_str() );
+    if ( (*doc)["id"] ) {
+        lv_label_set_text( id_label, (*doc)["id"] );
+    }
+    if ( (*doc)["all"]["power"] ) {
+        char temp[16] = "";
+        snprintf( temp, sizeof( temp ), "%0.2fkW", atof( (*doc)["all"]["power"] ) );
+        widget_set_label( powermeter_get_widget_icon(), temp );
+    }
+    if ( (*doc)["channel0"]["power"] ) {
+        char temp[16] = "";
+        snprintf( temp, sizeof( temp ), "%0.2fkW", atof( (*doc)["channel0"]["power"] ) );
+        lv_label_set_text( power_label, temp );
     }
-    else  {
-        if ( doc["id"] ) {
-            lv_label_set_text( id_label, doc["id"] );
-        }
-        if ( doc["all"]["power"] ) {
-            char temp[16] = "";
-            snprintf( temp, sizeof( temp ), "%0.2fkW", atof( doc["all"]["power"] ) );
-            widget_set_label( powermeter_get_widget_icon(), temp );
-        }
-        if ( doc["channel0"]["power"] ) {
-            char temp[16] = "";
-            snprintf( temp, sizeof( temp ), "%0.2fkW", atof( doc["channel0"]["power"] ) );
-            lv_label_set_text( power_label, temp );
-        }
-        if ( doc["channel0"]["voltage"] ) {
-            char temp[16] = "";
-            snprintf( temp, sizeof( temp ), "%0.1fV", atof( doc["channel0"]["voltage"] ) );
-            lv_label_set_text( voltage_label, temp );
-        }
-        if ( doc["channel0"]["current"] ) {
-            char temp[16] = "";
-            snprintf( temp, sizeof( temp ), "%0.1fA", atof( doc["channel0"]["current"] ) );
-            lv_label_set_text( current_label, temp );
-        }
-        lv_obj_align( id_label, id_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
-        lv_obj_align( power_label, power_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
-        lv_obj_align( voltage_label, voltage_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
-        lv_obj_align( current_label, current_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+    if ( (*doc)["channel0"]["voltage"] ) {
+        char temp[16] = "";
+        snprintf( temp, sizeof( temp ), "%0.1fV", atof( (*doc)["channel0"]["voltage"] ) );
+        lv_label_set_text( voltage_label, temp );
     }
-    doc.clear();
-    free( msg );
+    if ( (*doc)["channel0"]["current"] ) {
+        char temp[16] = "";
+        snprintf( temp, sizeof( temp ), "%0.1fA", atof( (*doc)["channel0"]["current"] ) );
+        lv_label_set_text( current_label, temp );
+    }
+    lv_obj_align( id_label, id_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+    lv_obj_align( power_label, power_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+    lv_obj_align( voltage_label, voltage_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+    lv_obj_align( current_label, current_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+
+    json_msg_release();
 }
 
 void powermeter_main_tile_setup( uint32_t tile_num ) {
@@ -201,6 +195,12 @@ void powermeter_main_tile_setup( uint32_t tile_num ) {
     lv_label_set_text( power_label, "n/a" );
     lv_obj_align( power_label, power_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
+    powermeter_filter["id"] = true;
+    powermeter_filter["all"]["power"] = true;
+    powermeter_filter["channel0"]["power"] = true;
+    powermeter_filter["channel0"]["voltage"] = true;
+    powermeter_filter["channel0"]["current"] = true;
+
     powermeter_mqtt_client.setCallback( callback );
     powermeter_mqtt_client.setBufferSize( 512 );
 
@@ -10,271 +10,412 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_01D_64PX uint8_t owm_01d_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xb4, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x43, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x48, 0xfc, 0x77, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x44, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x14, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0x03, 0xfc, 0xdf, 0xfc, 0x90, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0xd7, 0xfc, 0xe7, 0xfc, 0x0f, 0xfc, 0x00, 0xfc, 0x6b, 0xfc, 0xef, 0xfc, 0x0c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04, 0xfc, 0xcb, 0xfc, 0x6c, 0xfc, 0x00, 0xfc, 0x1f, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0x60, 0xfc, 0x4c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x70, 0xfc, 0x3f, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x2b, 0xfc, 0x00, 0xfc, 0x50, 0xfc, 0xcf, 0xfc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x13, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0xe0, 0xfc, 0xff, 0xfc, 0x88, 0xfc, 0x5b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x87, 0xfc, 0x67, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0x1b, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xa8, 0xfc, 0xb3, 0xfc, 0x10, 0xfc, 0x13, 0xfc, 0xec, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x20, 0xfc, 0x07, 0xfc, 0x9f, 0xfc, 0xbc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xa0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xaf, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xa0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xc8, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x2f, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x8b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xb3, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1c, 0xfc, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xfb, 0xfc, 0xec, 0xfc, 0x93, 0xfc, 0x9c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xbb, 0xfc, 0x87, 0xfc, 0xdf, 0xfc, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x90, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xb8, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x37, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x5f, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xfc, 0xaf, 0xfc, 0xd4, 0xfc, 0xcc, 0xfc, 0xd3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd7, 0xfc, 0xcb, 0xfc, 0xd4, 0xfc, 0xbc, 0xfc, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x48, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x78, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xeb, 0xf8, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x17, 0xfc, 0x20, 0xfc, 0x2c, 0xfc, 0x67, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x88, 0xfc, 0x2b, 0xfc, 0x20, 0xfc, 0x17, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xb3, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xc8, 0xfc, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x07, 0xfc, 0xef, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x27, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x2c, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0x43, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x2b, 0xfc, 0x87, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0x97, 0xfc, 0x34, 0xfc, 0x13, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0xe4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0x2b, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x23, 0xfc, 0xe7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0x3f, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0xc8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe0, 0xfc, 0x1f, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0c, 0xfc, 0x68, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x83, 0xfc, 0x13, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x68, 0xfc, 0xe7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xeb, 0xfc, 0x80, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x0b, 0xfc, 0xa8, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xc0, 0xfc, 0x23, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1f, 0xfc, 0xc3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe0, 0xfc, 0x28, 0xf4, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x47, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x68, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x70, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x98, 0xfc, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x17, 0xfc, 0xbc, 0xfc, 0xe3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe7, 0xfc, 0xc8, 0xfc, 0x33, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x37, 0xfc, 0xe4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf0, 0xfc, 0x43, 0xfc, 0x17, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x60, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x80, 0xfc, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x44, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x68, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0xfc, 0xb7, 0xfc, 0xd8, 0xfc, 0xe0, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xe4, 0xfc, 0xd8, 0xfc, 0xc0, 0xfc, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x08, 0xfc, 0x0c, 0xfc, 0x77, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x9c, 0xfc, 0x0b, 0xfc, 0x08, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x0b, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x80, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xac, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04, 0xfc, 0x8c, 0xfc, 0x7f, 0xfc, 0x74, 0xfc, 0x70, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x74, 0xfc, 0x74, 0xfc, 0x77, 0xfc, 0x93, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x53, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x7c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xac, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd4, 0xfc, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xe8, 0xfc, 0x87, 0xfc, 0x34, 0xfc, 0x8c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xb3, 0xfc, 0x2b, 0xfc, 0x7f, 0xfc, 0xe4, 0xfc, 0x17, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x93, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xbb, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xa8, 0xfc, 0xff, 0xfc, 0xcc, 0xfc, 0x58, 0xfc, 0xf4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x57, 0xfc, 0xb8, 0xfc, 0xff, 0xfc, 0xcc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x98, 0xfc, 0x50, 0xfc, 0x00, 0xfc, 0x17, 0xfc, 0xe8, 0xfc, 0xff, 0xfc, 0xfb, 0xfc, 0xe4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xeb, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0x23, 0xfc, 0x00, 0xfc, 0x38, 0xfc, 0xa3, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0c, 0xfc, 0xdf, 0xfc, 0xfb, 0xfc, 0x40, 0xfc, 0x3c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xeb, 0xfc, 0xbc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd8, 0xfc, 0xcf, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x5c, 0xfc, 0x2c, 0xfc, 0xef, 0xfc, 0xeb, 0xfc, 0x17, 0x14, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0xac, 0xfc, 0x17, 0xfc, 0x00, 0xfc, 0x17, 0xfc, 0xe8, 0xfc, 0xf4, 0xfc, 0x27, 0xfc, 0x28, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0x43, 0xfc, 0x14, 0xfc, 0xe8, 0xfc, 0xf4, 0xfc, 0x20, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0xa4, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0xcb, 0xfc, 0x40, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0xb8, 0xfc, 0xd3, 0xfc, 0x03, 0xfc, 0x00, 0xfc, 0x27, 0xfc, 0xdb, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1b, 0xfc, 0x3f, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xb9, 0x00, 0x00, 0x00, 0xfc, 0x43, 0x82, 0x00, 0x00, 0x01, 
+  0xfc, 0x48, 0xfc, 0x77, 0x82, 0x00, 0x00, 0x00, 0xfc, 0x44, 0xb1, 0x00, 0x00, 0x00, 0xfc, 0x14, 0x81, 0x00, 0x00, 0x0b, 0xfc, 0x03, 0xfc, 0xdf, 0xfc, 0x90, 0x00, 0x00, 0xfc, 0x04, 0xfc, 0xd7, 
+  0xfc, 0xe7, 0xfc, 0x0f, 0x00, 0x00, 0xfc, 0x6b, 0xfc, 0xef, 0xfc, 0x0c, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x0f, 0xfc, 0x03, 0xab, 0x00, 0x00, 0x08, 0xfc, 0x04, 0xfc, 0xcb, 0xfc, 0x6c, 0x00, 0x00, 
+  0xfc, 0x1f, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0x60, 0xfc, 0x4c, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0x70, 0xfc, 0x3f, 0x81, 0xfc, 0xfc, 0x04, 0xfc, 0x2b, 0x00, 0x00, 0xfc, 0x50, 0xfc, 0xcf, 0xfc, 0x10, 
+  0xa8, 0x00, 0x00, 0x00, 0xfc, 0x13, 0x81, 0x00, 0x00, 0x04, 0xfc, 0x10, 0xfc, 0xe0, 0xfc, 0xff, 0xfc, 0x88, 0xfc, 0x5b, 0x82, 0xfc, 0xff, 0x00, 0xfc, 0xf3, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xfb, 
+  0xfc, 0xfc, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0x87, 0xfc, 0x67, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0x1b, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x10, 0xa5, 0x00, 0x00, 0x04, 0xfc, 0xa8, 0xfc, 0xb3, 0xfc, 0x10, 
+  0xfc, 0x13, 0xfc, 0xec, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0xf7, 0x89, 0xfc, 0xff, 0x00, 0xfc, 0xf7, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0xf8, 0xfc, 0x20, 0xfc, 0x07, 0xfc, 0x9f, 0xfc, 0xbc, 0xa5, 0x00, 
+  0x00, 0x00, 0xfc, 0xa0, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xaf, 0xfc, 0xf8, 0x90, 0xfc, 0xff, 0x00, 0xfc, 0xa0, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0xc8, 0xa1, 0x00, 0x00, 0x01, 0xfc, 0x03, 0xfc, 0x2f, 
+  0x81, 0x00, 0x00, 0x00, 0xfc, 0x8b, 0x97, 0xfc, 0xff, 0x00, 0xfc, 0xb3, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x1c, 0xfc, 0x10, 0x9e, 0x00, 0x00, 0x03, 0xfc, 0xfb, 0xfc, 0xec, 0xfc, 0x93, 0xfc, 0x9c, 
+  0x97, 0xfc, 0xff, 0x03, 0xfc, 0xbb, 0xfc, 0x87, 0xfc, 0xdf, 0xfc, 0xff, 0x9f, 0x00, 0x00, 0x00, 0xfc, 0x90, 0x9d, 0xfc, 0xff, 0x00, 0xfc, 0xb8, 0x9c, 0x00, 0x00, 0x81, 0xfc, 0x04, 0x01, 0x00, 
+  0x00, 0xfc, 0x37, 0x9d, 0xfc, 0xff, 0x03, 0xfc, 0x5f, 0x00, 0x00, 0xfc, 0x04, 0xfc, 0x07, 0x99, 0x00, 0x00, 0x03, 0xfc, 0xaf, 0xfc, 0xd4, 0xfc, 0xcc, 0xfc, 0xd3, 0x9d, 0xfc, 0xff, 0x04, 0xfc, 
+  0xd7, 0xfc, 0xcb, 0xfc, 0xd4, 0xfc, 0xbc, 0xfc, 0x08, 0x98, 0x00, 0x00, 0x00, 0xfc, 0x48, 0xa3, 0xfc, 0xff, 0x00, 0xfc, 0x78, 0x9a, 0x00, 0x00, 0x00, 0xfc, 0xc7, 0xa1, 0xfc, 0xff, 0x00, 0xfc, 
+  0xeb, 0x97, 0x00, 0x00, 0x04, 0xfc, 0x03, 0xfc, 0x17, 0xfc, 0x20, 0xfc, 0x2c, 0xfc, 0x67, 0xa1, 0xfc, 0xff, 0x04, 0xfc, 0x88, 0xfc, 0x2b, 0xfc, 0x20, 0xfc, 0x17, 0xfc, 0x03, 0x94, 0x00, 0x00, 
+  0x01, 0xfc, 0xb3, 0xfc, 0xf3, 0xa5, 0xfc, 0xff, 0x02, 0xfc, 0xf3, 0xfc, 0xc8, 0xfc, 0x07, 0x94, 0x00, 0x00, 0x01, 0xfc, 0x07, 0xfc, 0xef, 0xa6, 0xfc, 0xff, 0x00, 0xfc, 0x27, 0x96, 0x00, 0x00, 
+  0x01, 0xfc, 0x2c, 0xfc, 0xf3, 0xa3, 0xfc, 0xff, 0x01, 0xfc, 0xfc, 0xfc, 0x43, 0x95, 0x00, 0x00, 0x03, 0xfc, 0x10, 0xfc, 0x2b, 0xfc, 0x87, 0xfc, 0xf3, 0xa3, 0xfc, 0xff, 0x03, 0xfc, 0xf7, 0xfc, 
+  0x97, 0xfc, 0x34, 0xfc, 0x13, 0x92, 0x00, 0x00, 0x01, 0xfc, 0x10, 0xfc, 0xe4, 0xa9, 0xfc, 0xff, 0x01, 0xfc, 0xf3, 0xfc, 0x2b, 0x92, 0x00, 0x00, 0x01, 0xfc, 0x23, 0xfc, 0xe7, 0xa7, 0xfc, 0xff, 
+  0x01, 0xfc, 0xf3, 0xfc, 0x3f, 0x94, 0x00, 0x00, 0x01, 0xfc, 0x0f, 0xfc, 0xc8, 0xa5, 0xfc, 0xff, 0x01, 0xfc, 0xe0, 0xfc, 0x1f, 0x94, 0x00, 0x00, 0x02, 0xfc, 0x0c, 0xfc, 0x68, 0xfc, 0xfc, 0xa6, 
+  0xfc, 0xff, 0x01, 0xfc, 0x83, 0xfc, 0x13, 0x92, 0x00, 0x00, 0x01, 0xfc, 0x68, 0xfc, 0xe7, 0xa9, 0xfc, 0xff, 0x01, 0xfc, 0xeb, 0xfc, 0x80, 0x91, 0x00, 0x00, 0x02, 0xfc, 0x0b, 0xfc, 0xa8, 0xfc, 
+  0xf8, 0xa7, 0xfc, 0xff, 0x02, 0xfc, 0xfc, 0xfc, 0xc0, 0xfc, 0x23, 0x93, 0x00, 0x00, 0x01, 0xfc, 0x1f, 0xfc, 0xc3, 0xa5, 0xfc, 0xff, 0x01, 0xfc, 0xe0, 0xfc, 0x28, 0x95, 0x00, 0x00, 0x00, 0xfc, 
+  0x47, 0xa7, 0xfc, 0xff, 0x00, 0xfc, 0x68, 0x94, 0x00, 0x00, 0x00, 0xfc, 0x70, 0xa9, 0xfc, 0xff, 0x00, 0xfc, 0x98, 0x92, 0x00, 0x00, 0x02, 0xfc, 0x17, 0xfc, 0xbc, 0xfc, 0xe3, 0xa7, 0xfc, 0xff, 
+  0x02, 0xfc, 0xe7, 0xfc, 0xc8, 0xfc, 0x33, 0x93, 0x00, 0x00, 0x02, 0xfc, 0x10, 0xfc, 0x37, 0xfc, 0xe4, 0xa3, 0xfc, 0xff, 0x02, 0xfc, 0xf0, 0xfc, 0x43, 0xfc, 0x17, 0x96, 0x00, 0x00, 0x00, 0xfc, 
+  0x60, 0xa5, 0xfc, 0xff, 0x00, 0xfc, 0x80, 0x96, 0x00, 0x00, 0x00, 0xfc, 0x44, 0xa7, 0xfc, 0xff, 0x00, 0xfc, 0x68, 0x94, 0x00, 0x00, 0x04, 0xfc, 0x08, 0xfc, 0xb7, 0xfc, 0xd8, 0xfc, 0xe0, 0xfc, 
+  0xf0, 0xa1, 0xfc, 0xff, 0x04, 0xfc, 0xf3, 0xfc, 0xe4, 0xfc, 0xd8, 0xfc, 0xc0, 0xfc, 0x13, 0x95, 0x00, 0x00, 0x02, 0xfc, 0x08, 0xfc, 0x0c, 0xfc, 0x77, 0xa1, 0xfc, 0xff, 0x02, 0xfc, 0x9c, 0xfc, 
+  0x0b, 0xfc, 0x08, 0x99, 0x00, 0x00, 0x00, 0xfc, 0xf3, 0xa2, 0xfc, 0xff, 0x00, 0xfc, 0x0b, 0x99, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xa3, 0xfc, 0xff, 0x00, 0xfc, 0xac, 0x98, 0x00, 0x00, 0x05, 0xfc, 
+  0x04, 0xfc, 0x8c, 0xfc, 0x7f, 0xfc, 0x74, 0xfc, 0x70, 0xfc, 0xf8, 0x9c, 0xfc, 0xff, 0x81, 0xfc, 0x74, 0x02, 0xfc, 0x77, 0xfc, 0x93, 0xfc, 0x0c, 0x9b, 0x00, 0x00, 0x00, 0xfc, 0x53, 0x9d, 0xfc, 
+  0xff, 0x00, 0xfc, 0x7c, 0x9f, 0x00, 0x00, 0x00, 0xfc, 0xac, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0xf7, 0x97, 0xfc, 0xff, 0x00, 0xfc, 0xf8, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0xd4, 0x9f, 0x00, 0x00, 0x03, 
+  0xfc, 0xe8, 0xfc, 0x87, 0xfc, 0x34, 0xfc, 0x8c, 0x97, 0xfc, 0xff, 0x04, 0xfc, 0xb3, 0xfc, 0x2b, 0xfc, 0x7f, 0xfc, 0xe4, 0xfc, 0x17, 0xa1, 0x00, 0x00, 0x00, 0xfc, 0x93, 0x97, 0xfc, 0xff, 0x00, 
+  0xfc, 0xbb, 0xa5, 0x00, 0x00, 0x04, 0xfc, 0xa8, 0xfc, 0xff, 0xfc, 0xcc, 0xfc, 0x58, 0xfc, 0xf4, 0x90, 0xfc, 0xff, 0x03, 0xfc, 0x57, 0xfc, 0xb8, 0xfc, 0xff, 0xfc, 0xcc, 0xa5, 0x00, 0x00, 0x07, 
+  0xfc, 0x98, 0xfc, 0x50, 0x00, 0x00, 0xfc, 0x17, 0xfc, 0xe8, 0xfc, 0xff, 0xfc, 0xfb, 0xfc, 0xe4, 0x89, 0xfc, 0xff, 0x07, 0xfc, 0xeb, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0x23, 0x00, 0x00, 
+  0xfc, 0x38, 0xfc, 0xa3, 0xa8, 0x00, 0x00, 0x04, 0xfc, 0x0c, 0xfc, 0xdf, 0xfc, 0xfb, 0xfc, 0x40, 0xfc, 0x3c, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xeb, 0xfc, 0xbc, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xd8, 
+  0xfc, 0xcf, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0x5c, 0xfc, 0x2c, 0xfc, 0xef, 0xfc, 0xeb, 0xfc, 0x17, 0xab, 0x00, 0x00, 0x13, 0xfc, 0x03, 0xfc, 0xac, 0xfc, 0x17, 0x00, 0x00, 0xfc, 0x17, 0xfc, 0xe8, 
+  0xfc, 0xf4, 0xfc, 0x27, 0xfc, 0x28, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0x43, 0xfc, 0x14, 0xfc, 0xe8, 0xfc, 0xf4, 0xfc, 0x20, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0xa4, 0xfc, 0x0c, 0xb0, 0x00, 0x00, 0x01, 
+  0xfc, 0xcb, 0xfc, 0x40, 0x81, 0x00, 0x00, 0x06, 0xfc, 0xb8, 0xfc, 0xd3, 0xfc, 0x03, 0x00, 0x00, 0xfc, 0x27, 0xfc, 0xdb, 0xfc, 0x04, 0xb4, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x82, 0x00, 0x00, 0x01, 
+  0xfc, 0x1b, 0xfc, 0x3f, 0x82, 0x00, 0x00, 0x00, 0xfc, 0x04, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xda, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0xff, 0x00, 0x60, 0xb5, 0x00, 0xa0, 0xff, 0x00, 0x80, 0xff, 0x00, 0x40, 0xff, 0x03, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x43, 0x40, 0xff, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x48, 0x40, 0xff, 0x77, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x44, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x00, 0x60, 0xff, 0x14, 0x60, 0xff, 0x00, 0x00, 0xfe, 0x00, 0xe0, 0xff, 0x03, 0x00, 0xff, 0xdf, 0x40, 0xff, 0x90, 0x80, 0xfe, 0x00, 0xc1, 0xff, 0x04, 0x00, 0xff, 0xd7, 0xe0, 0xfe, 0xe7, 0x80, 0xff, 0x0f, 0x20, 0xff, 0x00, 0x60, 0xff, 0x6b, 0x00, 0xff, 0xef, 0x60, 0xff, 0x0c, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x0f, 0x80, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x04, 0x20, 0xff, 0xcb, 0x60, 0xff, 0x6c, 0x60, 0xff, 0x00, 0x40, 0xff, 0x1f, 0xe0, 0xfe, 0xf0, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x60, 0x20, 0xff, 0x4c, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0x70, 0x40, 0xff, 0x3f, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xfc, 0x20, 0xff, 0x2b, 0x40, 0xff, 0x00, 0x60, 0xff, 0x50, 0x20, 0xff, 0xcf, 0x40, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x13, 0x20, 0xff, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x10, 0xc0, 0xfe, 0xe0, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x88, 0x20, 0xff, 0x5b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x01, 0xff, 0xfb, 0x20, 0xff, 0xfc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x87, 0x60, 0xff, 0x67, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xec, 0x20, 0xff, 0x1b, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x10, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0xa8, 0x60, 0xff, 0xb3, 0xa0, 0xff, 0x10, 0x00, 0xff, 0x13, 0xc0, 0xfe, 0xec, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xf7, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xf7, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0xe0, 0xfe, 0x20, 0x61, 0xff, 0x07, 0x60, 0xff, 0x9f, 0x20, 0xff, 0xbc, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x40, 0xfe, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0xa0, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xaf, 0xe0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x21, 0xff, 0xa0, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xc8, 0xa0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0xa0, 0xfe, 0x03, 0x60, 0xff, 0x2f, 0x40, 0xff, 0x00, 0x20, 0xff, 0x00, 0xe0, 0xfe, 0x8b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xb3, 0x20, 0xff, 0x00, 0x40, 0xff, 0x00, 0x80, 0xff, 0x1c, 0x60, 0xff, 0x10, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0xfb, 0x40, 0xff, 0xec, 0x40, 0xff, 0x93, 0x00, 0xff, 0x9c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xbb, 0x40, 0xff, 0x87, 0x40, 0xff, 0xdf, 0x20, 0xff, 0xff, 0x40, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x90, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xb8, 0xc0, 0xfe, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x04, 0x80, 0xff, 0x04, 0x40, 0xff, 0x00, 0xe0, 0xfe, 0x37, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x5f, 0x40, 0xff, 0x00, 0x80, 0xff, 0x04, 0x80, 0xff, 0x07, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfd, 0x00, 0x40, 0xff, 0xaf, 0x40, 0xff, 0xd4, 0x60, 0xff, 0xcc, 0x40, 0xff, 0xd3, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xd7, 0x60, 0xff, 0xcb, 0x40, 0xff, 0xd4, 0x40, 0xff, 0xbc, 0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x48, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x78, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0xc0, 0xfe, 0xc7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xeb, 0x60, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0x60, 0xff, 0x17, 0x60, 0xff, 0x20, 0x60, 0xff, 0x2c, 0x00, 0xff, 0x67, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0x88, 0x60, 0xff, 0x2b, 0x60, 0xff, 0x20, 0x60, 0xff, 0x17, 0x60, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x20, 0xff, 0xb3, 0x00, 0xff, 0xf3, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xf3, 0x20, 0xff, 0xc8, 0x60, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x80, 0xfe, 0x07, 0xc0, 0xfe, 0xef, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xa0, 0xfe, 0x27, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xa0, 0xfe, 0x2c, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xfc, 0xc0, 0xfe, 0x43, 0xe0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfd, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x10, 0x80, 0xff, 0x2b, 0x40, 0xff, 0x87, 0xe0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xf7, 0x40, 0xff, 0x97, 0x60, 0xff, 0x34, 0x60, 0xff, 0x13, 0xe0, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0xa0, 0xff, 0x10, 0x20, 0xff, 0xe4, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xf3, 0x60, 0xff, 0x2b, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0xa0, 0xfe, 0x23, 0xc0, 0xfe, 0xe7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0xa0, 0xfe, 0x3f, 0x20, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x0f, 0xc0, 0xfe, 0xc8, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xe0, 0xc0, 0xfe, 0x1f, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x0c, 0x60, 0xff, 0x68, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x83, 0x60, 0xff, 0x13, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x60, 0xff, 0x68, 0x20, 0xff, 0xe7, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xeb, 0x60, 0xff, 0x80, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x0b, 0xa0, 0xfe, 0xa8, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xfc, 0xc0, 0xfe, 0xc0, 0xe0, 0xfe, 0x23, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0xa0, 0xfe, 0x1f, 0xc0, 0xfe, 0xc3, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xe0, 0xa0, 0xfe, 0x28, 0x20, 0xfd, 0x00, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x41, 0xff, 0x00, 0x60, 0xff, 0x47, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x41, 0xff, 0x68, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x60, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x70, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x60, 0xff, 0x98, 0x00, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x17, 0x00, 0xff, 0xbc, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xe7, 0xe0, 0xfe, 0xc8, 0x60, 0xff, 0x33, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0xc0, 0xfe, 0x10, 0xc0, 0xfe, 0x37, 0xc0, 0xfe, 0xe4, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0x43, 0xe0, 0xfe, 0x17, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x60, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0x80, 0x20, 0xff, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x44, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x60, 0xff, 0x68, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x08, 0x00, 0xff, 0xb7, 0xc0, 0xfe, 0xd8, 0xc0, 0xfe, 0xe0, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xe4, 0xc0, 0xfe, 0xd8, 0x00, 0xff, 0xc0, 0x80, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x00, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x08, 0xa0, 0xfe, 0x0c, 0xe0, 0xfe, 0x77, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x9c, 0xa0, 0xfe, 0x0b, 0xa0, 0xfe, 0x08, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x81, 0xfe, 0x00, 0x00, 0xff, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xff, 0x0b, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x80, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xac, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x04, 0xe0, 0xfe, 0x8c, 0xc0, 0xfe, 0x7f, 0xc0, 0xfe, 0x74, 0xc0, 0xfe, 0x70, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x74, 0xc0, 0xfe, 0x74, 0xc0, 0xfe, 0x77, 0xc0, 0xfe, 0x93, 0x80, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x53, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x7c, 0x20, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0x00, 0x00, 0xff, 0xac, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf7, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xd4, 0x00, 0xff, 0x00, 0x60, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0xe8, 0xc0, 0xfe, 0x87, 0xc0, 0xfe, 0x34, 0xe0, 0xfe, 0x8c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xb3, 0xc0, 0xfe, 0x2b, 0xc0, 0xfe, 0x7f, 0xc0, 0xfe, 0xe4, 0xa0, 0xff, 0x17, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xff, 0x93, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xbb, 0xe0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xa0, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xa8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xcc, 0xc0, 0xfe, 0x58, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x57, 0xc0, 0xfe, 0xb8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xcc, 0xa0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x98, 0xc0, 0xfe, 0x50, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x17, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0xe4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xeb, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0xe0, 0xfe, 0x23, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x38, 0xc0, 0xfe, 0xa3, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xc0, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x40, 0xff, 0x0c, 0xc0, 0xfe, 0xdf, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0x40, 0xc0, 0xfe, 0x3c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xeb, 0xc0, 0xfe, 0xbc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xd8, 0xc0, 0xfe, 0xcf, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x5c, 0xc0, 0xfe, 0x2c, 0xc0, 0xfe, 0xef, 0xc0, 0xfe, 0xeb, 0x00, 0xff, 0x17, 0x40, 0x05, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x20, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x03, 0xc0, 0xfe, 0xac, 0xc0, 0xfe, 0x17, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x17, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0x27, 0xe0, 0xfe, 0x28, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x43, 0xc0, 0xfe, 0x14, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0x20, 0xc0, 0xfe, 0x00, 0xa0, 0xff, 0x03, 0xc0, 0xfe, 0xa4, 0x20, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x60, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x20, 0xfe, 0x00, 0xc0, 0xfe, 0xcb, 0xc0, 0xfe, 0x40, 0xa0, 0xfe, 0x00, 0x80, 0xfd, 0x00, 0xc0, 0xfe, 0xb8, 0xc0, 0xfe, 0xd3, 0x00, 0xff, 0x03, 0xa0, 0xfe, 0x00, 0xc0, 0xfe, 0x27, 0xc0, 0xfe, 0xdb, 0x60, 0xff, 0x04, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x00, 0x80, 0xff, 0x04, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x1b, 0xc0, 0xfe, 0x3f, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xa0, 0xff, 0x04, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0xb9, 0x00, 0x00, 0x00, 
+  0x00, 0x60, 0xff, 0x43, 0x82, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x48, 0x40, 0xff, 0x77, 0x82, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x44, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x14, 0x81, 
+  0x00, 0x00, 0x00, 0x0b, 0xe0, 0xff, 0x03, 0x00, 0xff, 0xdf, 0x40, 0xff, 0x90, 0x00, 0x00, 0x00, 0xc1, 0xff, 0x04, 0x00, 0xff, 0xd7, 0xe0, 0xfe, 0xe7, 0x80, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x60, 
+  0xff, 0x6b, 0x00, 0xff, 0xef, 0x60, 0xff, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x0f, 0x80, 0xff, 0x03, 0xab, 0x00, 0x00, 0x00, 0x13, 0x80, 0xff, 0x04, 0x20, 0xff, 0xcb, 0x60, 0xff, 
+  0x6c, 0x00, 0x00, 0x00, 0x40, 0xff, 0x1f, 0xe0, 0xfe, 0xf0, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x60, 0x20, 0xff, 0x4c, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0x70, 0x40, 0xff, 0x3f, 0xe0, 
+  0xfe, 0xfc, 0xc0, 0xfe, 0xfc, 0x20, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x60, 0xff, 0x50, 0x20, 0xff, 0xcf, 0x40, 0xff, 0x10, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x13, 0x81, 0x00, 0x00, 0x00, 
+  0x04, 0x60, 0xff, 0x10, 0xc0, 0xfe, 0xe0, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x88, 0x20, 0xff, 0x5b, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 0x20, 0xff, 0xf3, 0x81, 0xc0, 0xfe, 0xff, 0x01, 
+  0x01, 0xff, 0xfb, 0x20, 0xff, 0xfc, 0x81, 0xc0, 0xfe, 0xff, 0x04, 0x20, 0xff, 0x87, 0x60, 0xff, 0x67, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xec, 0x20, 0xff, 0x1b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x80, 
+  0xff, 0x10, 0xa5, 0x00, 0x00, 0x00, 0x0a, 0x20, 0xff, 0xa8, 0x60, 0xff, 0xb3, 0xa0, 0xff, 0x10, 0x00, 0xff, 0x13, 0xc0, 0xfe, 0xec, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xf7, 0xc0, 
+  0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x07, 0x00, 0xff, 0xf7, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0xe0, 0xfe, 0x20, 0x61, 0xff, 0x07, 0x60, 
+  0xff, 0x9f, 0x20, 0xff, 0xbc, 0xa5, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xfe, 0xa0, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xaf, 0xe0, 0xfe, 0xf8, 0x81, 0xc0, 0xfe, 0xff, 0x8c, 0xe0, 0xfe, 
+  0xff, 0x05, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x21, 0xff, 0xa0, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xc8, 0xa1, 0x00, 0x00, 0x00, 0x01, 0xa0, 0xfe, 0x03, 0x60, 0xff, 0x2f, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x8b, 0x81, 0xc0, 0xfe, 0xff, 0x93, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xb3, 0x81, 0x00, 0x00, 0x00, 0x01, 0x80, 0xff, 0x1c, 0x60, 
+  0xff, 0x10, 0x9e, 0x00, 0x00, 0x00, 0x03, 0x20, 0xff, 0xfb, 0x40, 0xff, 0xec, 0x40, 0xff, 0x93, 0x00, 0xff, 0x9c, 0x81, 0xc0, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x86, 0xe1, 0xfe, 0xff, 0x86, 
+  0xe0, 0xfe, 0xff, 0x04, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xbb, 0x40, 0xff, 0x87, 0x40, 0xff, 0xdf, 0x20, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xfe, 0x90, 0xc0, 0xfe, 0xff, 0x86, 0xe0, 
+  0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x8a, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xb8, 0x9c, 0x00, 0x00, 0x00, 0x81, 0x80, 0xff, 
+  0x04, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x37, 0x81, 0xc0, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x8d, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 
+  0x81, 0xc0, 0xfe, 0xff, 0x03, 0xe0, 0xfe, 0x5f, 0x00, 0x00, 0x00, 0x80, 0xff, 0x04, 0x80, 0xff, 0x07, 0x99, 0x00, 0x00, 0x00, 0x04, 0x40, 0xff, 0xaf, 0x40, 0xff, 0xd4, 0x60, 0xff, 0xcc, 0x40, 
+  0xff, 0xd3, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x85, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 
+  0xff, 0x05, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xd7, 0x60, 0xff, 0xcb, 0x40, 0xff, 0xd4, 0x40, 0xff, 0xbc, 0x60, 0xff, 0x08, 0x98, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x48, 0x82, 0xc0, 0xfe, 0xff, 
+  0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x89, 0x21, 0xff, 0xff, 0x85, 0x01, 0xff, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x78, 
+  0x9a, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xc7, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x8d, 0x21, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 
+  0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xeb, 0x97, 0x00, 0x00, 0x00, 0x05, 0x40, 0xff, 0x03, 0x60, 0xff, 0x17, 0x60, 0xff, 0x20, 0x60, 0xff, 0x2c, 
+  0x00, 0xff, 0x67, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x85, 0x21, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x85, 0x21, 0xff, 0xff, 0x83, 0x01, 
+  0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x04, 0x00, 0xff, 0x88, 0x60, 0xff, 0x2b, 0x60, 0xff, 0x20, 0x60, 0xff, 0x17, 0x60, 0xff, 0x03, 0x94, 0x00, 0x00, 0x00, 0x02, 0x20, 
+  0xff, 0xb3, 0x00, 0xff, 0xf3, 0x00, 0xff, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x83, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 
+  0x83, 0x21, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x02, 0x00, 0xff, 0xf3, 0x20, 0xff, 0xc8, 0x60, 0xff, 0x07, 0x94, 0x00, 0x00, 0x00, 0x01, 0x80, 
+  0xfe, 0x07, 0xc0, 0xfe, 0xef, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x86, 0x42, 0xff, 
+  0xff, 0x82, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0xa0, 0xfe, 0x27, 0x96, 0x00, 0x00, 
+  0x00, 0x02, 0xa0, 0xfe, 0x2c, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x81, 
+  0x42, 0xff, 0xff, 0x85, 0x62, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 
+  0xc0, 0xfe, 0xfc, 0xc0, 0xfe, 0x43, 0x95, 0x00, 0x00, 0x00, 0x04, 0x60, 0xff, 0x10, 0x80, 0xff, 0x2b, 0x40, 0xff, 0x87, 0xe0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 
+  0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x86, 0x62, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 
+  0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x03, 0xe0, 0xfe, 0xf7, 0x40, 0xff, 0x97, 0x60, 0xff, 0x34, 0x60, 0xff, 0x13, 0x92, 0x00, 0x00, 0x00, 0x01, 0xa0, 0xff, 0x10, 0x20, 
+  0xff, 0xe4, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 
+  0xff, 0xff, 0x88, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x01, 0x20, 0xff, 0xf3, 0x60, 0xff, 
+  0x2b, 0x92, 0x00, 0x00, 0x00, 0x01, 0xa0, 0xfe, 0x23, 0xc0, 0xfe, 0xe7, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 
+  0x81, 0x42, 0xff, 0xff, 0x8a, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 
+  0x02, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0xa0, 0xfe, 0x3f, 0x94, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xfe, 0x0f, 0xc0, 0xfe, 0xc8, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 
+  0x82, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x84, 0x82, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x01, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x83, 
+  0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xe0, 0xc0, 0xfe, 0x1f, 0x94, 0x00, 0x00, 0x00, 0x03, 0x80, 0xff, 0x0c, 0x60, 0xff, 
+  0x68, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x82, 0x62, 0xff, 0xff, 0x85, 
+  0x82, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x01, 
+  0x40, 0xff, 0x83, 0x60, 0xff, 0x13, 0x92, 0x00, 0x00, 0x00, 0x02, 0x60, 0xff, 0x68, 0x20, 0xff, 0xe7, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 
+  0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x82, 0x62, 0xff, 0xff, 0x85, 0x82, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 
+  0x82, 0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x03, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xeb, 0x60, 0xff, 0x80, 0x91, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0xff, 0x0b, 0xa0, 0xfe, 0xa8, 0xc0, 0xfe, 0xf8, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 
+  0x42, 0xff, 0xff, 0x82, 0x62, 0xff, 0xff, 0x85, 0x82, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 
+  0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x03, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xfc, 0xc0, 0xfe, 0xc0, 0xe0, 0xfe, 0x23, 0x93, 0x00, 0x00, 0x00, 0x02, 0xa0, 0xfe, 0x1f, 0xc0, 0xfe, 0xc3, 0xc0, 
+  0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x84, 0x82, 0xff, 0xff, 0x83, 0x62, 
+  0xff, 0xff, 0x01, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xe0, 0xa0, 0xfe, 0x28, 
+  0x95, 0x00, 0x00, 0x00, 0x02, 0x60, 0xff, 0x47, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x00, 0x42, 
+  0xff, 0xff, 0x84, 0x62, 0xff, 0xff, 0x82, 0x82, 0xff, 0xff, 0x84, 0x62, 0xff, 0xff, 0x01, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 
+  0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0x41, 0xff, 0x68, 0x94, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x70, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 
+  0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x89, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 
+  0x82, 0x01, 0xff, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x60, 0xff, 0x98, 0x92, 0x00, 0x00, 0x00, 0x02, 0x60, 0xff, 0x17, 0x00, 0xff, 0xbc, 0xc0, 0xfe, 0xe3, 
+  0x82, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x87, 0x62, 0xff, 0xff, 
+  0x82, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xe7, 0xe0, 0xfe, 0xc8, 0x60, 
+  0xff, 0x33, 0x93, 0x00, 0x00, 0x00, 0x03, 0xc0, 0xfe, 0x10, 0xc0, 0xfe, 0x37, 0xc0, 0xfe, 0xe4, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xff, 0xff, 0x83, 
+  0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x85, 0x62, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 
+  0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0x43, 0xe0, 0xfe, 0x17, 0x96, 0x00, 0x00, 0x00, 0x02, 0x40, 0xff, 0x60, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x82, 
+  0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x89, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x82, 
+  0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0x80, 0x96, 0x00, 0x00, 0x00, 0x01, 0x80, 0xff, 0x44, 0xe0, 0xfe, 0xff, 
+  0x81, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x83, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 
+  0x83, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xff, 0x60, 0xff, 0x68, 0x94, 0x00, 0x00, 0x00, 0x05, 0xa0, 0xff, 0x08, 0x00, 
+  0xff, 0xb7, 0xc0, 0xfe, 0xd8, 0xc0, 0xfe, 0xe0, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x85, 0x21, 0xff, 0xff, 0x86, 0x41, 
+  0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x04, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xe4, 0xc0, 0xfe, 0xd8, 0x00, 0xff, 0xc0, 0x80, 
+  0xff, 0x13, 0x95, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xfe, 0x08, 0xa0, 0xfe, 0x0c, 0xe0, 0xfe, 0x77, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 
+  0x8d, 0x21, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x03, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x9c, 0xa0, 0xfe, 0x0b, 0xa0, 0xfe, 0x08, 0x99, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xf3, 0x81, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x8c, 0x21, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 
+  0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 0xe0, 0xff, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x80, 0x83, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 
+  0x86, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x85, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0x20, 0xff, 0xac, 0x98, 0x00, 0x00, 0x00, 
+  0x06, 0xe0, 0xff, 0x04, 0xe0, 0xfe, 0x8c, 0xc0, 0xfe, 0x7f, 0xc0, 0xfe, 0x74, 0xc0, 0xfe, 0x70, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x90, 0x01, 
+  0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0x74, 0x02, 0xc0, 0xfe, 0x77, 0xc0, 0xfe, 0x93, 0x80, 0xff, 0x0c, 0x9b, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x53, 0x82, 0xc0, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x8a, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 
+  0x00, 0x20, 0xff, 0x7c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xac, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xf7, 0xc0, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x86, 
+  0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xf8, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xd4, 0x9f, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xfe, 0xe8, 0xc0, 
+  0xfe, 0x87, 0xc0, 0xfe, 0x34, 0xe0, 0xfe, 0x8c, 0x82, 0xc0, 0xfe, 0xff, 0x92, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x04, 0xc0, 0xfe, 0xb3, 0xc0, 0xfe, 0x2b, 0xc0, 0xfe, 0x7f, 0xc0, 0xfe, 
+  0xe4, 0xa0, 0xff, 0x17, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0x83, 0xc0, 0xfe, 0xff, 0x90, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xbb, 0xa5, 0x00, 0x00, 0x00, 
+  0x04, 0xe0, 0xfe, 0xa8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xcc, 0xc0, 0xfe, 0x58, 0xc0, 0xfe, 0xf4, 0x83, 0xc0, 0xfe, 0xff, 0x88, 0xe0, 0xfe, 0xff, 0x83, 0xc0, 0xfe, 0xff, 0x03, 0xc0, 0xfe, 0x57, 
+  0xc0, 0xfe, 0xb8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xcc, 0xa5, 0x00, 0x00, 0x00, 0x07, 0xe0, 0xfe, 0x98, 0xc0, 0xfe, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 0x17, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xff, 
+  0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0xe4, 0x89, 0xc0, 0xfe, 0xff, 0x07, 0xc0, 0xfe, 0xeb, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0xe0, 0xfe, 0x23, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x38, 
+  0xc0, 0xfe, 0xa3, 0xa8, 0x00, 0x00, 0x00, 0x04, 0x40, 0xff, 0x0c, 0xc0, 0xfe, 0xdf, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0x40, 0xc0, 0xfe, 0x3c, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xeb, 0xc0, 
+  0xfe, 0xbc, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xd8, 0xc0, 0xfe, 0xcf, 0x81, 0xc0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0x5c, 0xc0, 0xfe, 0x2c, 0xc0, 0xfe, 0xef, 0xc0, 0xfe, 0xeb, 0x00, 0xff, 
+  0x17, 0xab, 0x00, 0x00, 0x00, 0x13, 0xe0, 0xff, 0x03, 0xc0, 0xfe, 0xac, 0xc0, 0xfe, 0x17, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x17, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0x27, 0xe0, 0xfe, 
+  0x28, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x43, 0xc0, 0xfe, 0x14, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0x20, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x03, 0xc0, 0xfe, 0xa4, 0x20, 
+  0xff, 0x0c, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0xcb, 0xc0, 0xfe, 0x40, 0x81, 0x00, 0x00, 0x00, 0x06, 0xc0, 0xfe, 0xb8, 0xc0, 0xfe, 0xd3, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xfe, 
+  0x27, 0xc0, 0xfe, 0xdb, 0x60, 0xff, 0x04, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0x1b, 0xc0, 0xfe, 0x3f, 0x82, 0x00, 0x00, 0x00, 0x00, 0xa0, 
+  0xff, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x00, 0x00, 0xb5, 0x60, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x80, 0x00, 0xff, 0x40, 0x03, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x43, 0xff, 0x40, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x48, 0xff, 0x40, 0x77, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x44, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa0, 0x00, 0xff, 0x60, 0x14, 0xff, 0x60, 0x00, 0xfe, 0x00, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x00, 0xdf, 0xff, 0x40, 0x90, 0xfe, 0x80, 0x00, 0xff, 0xc1, 0x04, 0xff, 0x00, 0xd7, 0xfe, 0xe0, 0xe7, 0xff, 0x80, 0x0f, 0xff, 0x20, 0x00, 0xff, 0x60, 0x6b, 0xff, 0x00, 0xef, 0xff, 0x60, 0x0c, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x0f, 0xff, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x04, 0xff, 0x20, 0xcb, 0xff, 0x60, 0x6c, 0xff, 0x60, 0x00, 0xff, 0x40, 0x1f, 0xfe, 0xe0, 0xf0, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x60, 0xff, 0x20, 0x4c, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0x70, 0xff, 0x40, 0x3f, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xfc, 0xff, 0x20, 0x2b, 0xff, 0x40, 0x00, 0xff, 0x60, 0x50, 0xff, 0x20, 0xcf, 0xff, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x13, 0xff, 0x20, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x10, 0xfe, 0xc0, 0xe0, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x88, 0xff, 0x20, 0x5b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x01, 0xfb, 0xff, 0x20, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x87, 0xff, 0x60, 0x67, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xec, 0xff, 0x20, 0x1b, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x10, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0xa8, 0xff, 0x60, 0xb3, 0xff, 0xa0, 0x10, 0xff, 0x00, 0x13, 0xfe, 0xc0, 0xec, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xf7, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xf7, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 0xfe, 0xe0, 0x20, 0xff, 0x61, 0x07, 0xff, 0x60, 0x9f, 0xff, 0x20, 0xbc, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0xa0, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xaf, 0xfe, 0xe0, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x21, 0xa0, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xc8, 0xfe, 0xa0, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xa0, 0x03, 0xff, 0x60, 0x2f, 0xff, 0x40, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xe0, 0x8b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xb3, 0xff, 0x20, 0x00, 0xff, 0x40, 0x00, 0xff, 0x80, 0x1c, 0xff, 0x60, 0x10, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0xfb, 0xff, 0x40, 0xec, 0xff, 0x40, 0x93, 0xff, 0x00, 0x9c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xbb, 0xff, 0x40, 0x87, 0xff, 0x40, 0xdf, 0xff, 0x20, 0xff, 0xff, 0x40, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x90, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xb8, 0xfe, 0xc0, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x04, 0xff, 0x80, 0x04, 0xff, 0x40, 0x00, 0xfe, 0xe0, 0x37, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x5f, 0xff, 0x40, 0x00, 0xff, 0x80, 0x04, 0xff, 0x80, 0x07, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x20, 0x00, 0xff, 0x40, 0xaf, 0xff, 0x40, 0xd4, 0xff, 0x60, 0xcc, 0xff, 0x40, 0xd3, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xd7, 0xff, 0x60, 0xcb, 0xff, 0x40, 0xd4, 0xff, 0x40, 0xbc, 0xff, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x48, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x78, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xc0, 0xc7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xeb, 0xfe, 0x60, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x03, 0xff, 0x60, 0x17, 0xff, 0x60, 0x20, 0xff, 0x60, 0x2c, 0xff, 0x00, 0x67, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0x88, 0xff, 0x60, 0x2b, 0xff, 0x60, 0x20, 0xff, 0x60, 0x17, 0xff, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xff, 0x20, 0xb3, 0xff, 0x00, 0xf3, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xf3, 0xff, 0x20, 0xc8, 0xff, 0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0x80, 0x07, 0xfe, 0xc0, 0xef, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xa0, 0x27, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xa0, 0x2c, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xfc, 0xfe, 0xc0, 0x43, 0xfe, 0xe0, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xe0, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x10, 0xff, 0x80, 0x2b, 0xff, 0x40, 0x87, 0xfe, 0xe0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xf7, 0xff, 0x40, 0x97, 0xff, 0x60, 0x34, 0xff, 0x60, 0x13, 0xff, 0xe0, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0xa0, 0x10, 0xff, 0x20, 0xe4, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xf3, 0xff, 0x60, 0x2b, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xfe, 0xa0, 0x23, 0xfe, 0xc0, 0xe7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf3, 0xfe, 0xa0, 0x3f, 0xff, 0x20, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x0f, 0xfe, 0xc0, 0xc8, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xe0, 0xfe, 0xc0, 0x1f, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x0c, 0xff, 0x60, 0x68, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x83, 0xff, 0x60, 0x13, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x60, 0x68, 0xff, 0x20, 0xe7, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xeb, 0xff, 0x60, 0x80, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x0b, 0xfe, 0xa0, 0xa8, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xfc, 0xfe, 0xc0, 0xc0, 0xfe, 0xe0, 0x23, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xa0, 0x1f, 0xfe, 0xc0, 0xc3, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xe0, 0xfe, 0xa0, 0x28, 0xfd, 0x20, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x41, 0x00, 0xff, 0x60, 0x47, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x41, 0x68, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0xf7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x70, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x60, 0x98, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x17, 0xff, 0x00, 0xbc, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xe7, 0xfe, 0xe0, 0xc8, 0xff, 0x60, 0x33, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xc0, 0x10, 0xfe, 0xc0, 0x37, 0xfe, 0xc0, 0xe4, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0x43, 0xfe, 0xe0, 0x17, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x60, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0x80, 0xff, 0x20, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x44, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x60, 0x68, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x08, 0xff, 0x00, 0xb7, 0xfe, 0xc0, 0xd8, 0xfe, 0xc0, 0xe0, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xe4, 0xfe, 0xc0, 0xd8, 0xff, 0x00, 0xc0, 0xff, 0x80, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xc0, 0x08, 0xfe, 0xa0, 0x0c, 0xfe, 0xe0, 0x77, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x9c, 0xfe, 0xa0, 0x0b, 0xfe, 0xa0, 0x08, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xfe, 0x81, 0x00, 0xff, 0x00, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0x0b, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x80, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xac, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x04, 0xfe, 0xe0, 0x8c, 0xfe, 0xc0, 0x7f, 0xfe, 0xc0, 0x74, 0xfe, 0xc0, 0x70, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x74, 0xfe, 0xc0, 0x74, 0xfe, 0xc0, 0x77, 0xfe, 0xc0, 0x93, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x53, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x7c, 0xff, 0x20, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x00, 0xac, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf7, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0xe8, 0xfe, 0xc0, 0x87, 0xfe, 0xc0, 0x34, 0xfe, 0xe0, 0x8c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xb3, 0xfe, 0xc0, 0x2b, 0xfe, 0xc0, 0x7f, 0xfe, 0xc0, 0xe4, 0xff, 0xa0, 0x17, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x00, 0x93, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xbb, 0xfe, 0xe0, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xa8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xcc, 0xfe, 0xc0, 0x58, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x57, 0xfe, 0xc0, 0xb8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xcc, 0xfe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x98, 0xfe, 0xc0, 0x50, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x17, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0xe4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xeb, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf3, 0xfe, 0xe0, 0x23, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x38, 0xfe, 0xc0, 0xa3, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x40, 0x0c, 0xfe, 0xc0, 0xdf, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0x40, 0xfe, 0xc0, 0x3c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xeb, 0xfe, 0xc0, 0xbc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xd8, 0xfe, 0xc0, 0xcf, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x5c, 0xfe, 0xc0, 0x2c, 0xfe, 0xc0, 0xef, 0xfe, 0xc0, 0xeb, 0xff, 0x00, 0x17, 0x05, 0x40, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x03, 0xfe, 0xc0, 0xac, 0xfe, 0xc0, 0x17, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x17, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0x27, 0xfe, 0xe0, 0x28, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x43, 0xfe, 0xc0, 0x14, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0x20, 0xfe, 0xc0, 0x00, 0xff, 0xa0, 0x03, 0xfe, 0xc0, 0xa4, 0xff, 0x20, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x60, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0x20, 0x00, 0xfe, 0xc0, 0xcb, 0xfe, 0xc0, 0x40, 0xfe, 0xa0, 0x00, 0xfd, 0x80, 0x00, 0xfe, 0xc0, 0xb8, 0xfe, 0xc0, 0xd3, 0xff, 0x00, 0x03, 0xfe, 0xa0, 0x00, 0xfe, 0xc0, 0x27, 0xfe, 0xc0, 0xdb, 0xff, 0x60, 0x04, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xa0, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x80, 0x04, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x1b, 0xfe, 0xc0, 0x3f, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0xa0, 0x04, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x03, 0xb9, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0x60, 0x43, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x48, 0xff, 0x40, 0x77, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x44, 0xb1, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x14, 0x81, 
+  0x00, 0x00, 0x00, 0x0b, 0xff, 0xe0, 0x03, 0xff, 0x00, 0xdf, 0xff, 0x40, 0x90, 0x00, 0x00, 0x00, 0xff, 0xc1, 0x04, 0xff, 0x00, 0xd7, 0xfe, 0xe0, 0xe7, 0xff, 0x80, 0x0f, 0x00, 0x00, 0x00, 0xff, 
+  0x60, 0x6b, 0xff, 0x00, 0xef, 0xff, 0x60, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x0f, 0xff, 0x80, 0x03, 0xab, 0x00, 0x00, 0x00, 0x13, 0xff, 0x80, 0x04, 0xff, 0x20, 0xcb, 0xff, 0x60, 
+  0x6c, 0x00, 0x00, 0x00, 0xff, 0x40, 0x1f, 0xfe, 0xe0, 0xf0, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x60, 0xff, 0x20, 0x4c, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0x70, 0xff, 0x40, 0x3f, 0xfe, 
+  0xe0, 0xfc, 0xfe, 0xc0, 0xfc, 0xff, 0x20, 0x2b, 0x00, 0x00, 0x00, 0xff, 0x60, 0x50, 0xff, 0x20, 0xcf, 0xff, 0x40, 0x10, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x13, 0x81, 0x00, 0x00, 0x00, 
+  0x04, 0xff, 0x60, 0x10, 0xfe, 0xc0, 0xe0, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x88, 0xff, 0x20, 0x5b, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xff, 0x00, 0xff, 0xff, 0x20, 0xf3, 0x81, 0xfe, 0xc0, 0xff, 0x01, 
+  0xff, 0x01, 0xfb, 0xff, 0x20, 0xfc, 0x81, 0xfe, 0xc0, 0xff, 0x04, 0xff, 0x20, 0x87, 0xff, 0x60, 0x67, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xec, 0xff, 0x20, 0x1b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0x80, 0x10, 0xa5, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x20, 0xa8, 0xff, 0x60, 0xb3, 0xff, 0xa0, 0x10, 0xff, 0x00, 0x13, 0xfe, 0xc0, 0xec, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xf7, 0xfe, 
+  0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x07, 0xff, 0x00, 0xf7, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 0xfe, 0xe0, 0x20, 0xff, 0x61, 0x07, 0xff, 
+  0x60, 0x9f, 0xff, 0x20, 0xbc, 0xa5, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xe0, 0xa0, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xaf, 0xfe, 0xe0, 0xf8, 0x81, 0xfe, 0xc0, 0xff, 0x8c, 0xfe, 0xe0, 
+  0xff, 0x05, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x21, 0xa0, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xc8, 0xa1, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xa0, 0x03, 0xff, 0x60, 0x2f, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x8b, 0x81, 0xfe, 0xc0, 0xff, 0x93, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0xb3, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x1c, 0xff, 
+  0x60, 0x10, 0x9e, 0x00, 0x00, 0x00, 0x03, 0xff, 0x20, 0xfb, 0xff, 0x40, 0xec, 0xff, 0x40, 0x93, 0xff, 0x00, 0x9c, 0x81, 0xfe, 0xc0, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x86, 0xfe, 0xe1, 0xff, 0x86, 
+  0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xbb, 0xff, 0x40, 0x87, 0xff, 0x40, 0xdf, 0xff, 0x20, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xe0, 0x90, 0xfe, 0xc0, 0xff, 0x86, 0xfe, 
+  0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x8a, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xb8, 0x9c, 0x00, 0x00, 0x00, 0x81, 0xff, 0x80, 
+  0x04, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x37, 0x81, 0xfe, 0xc0, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x8d, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 
+  0x81, 0xfe, 0xc0, 0xff, 0x03, 0xfe, 0xe0, 0x5f, 0x00, 0x00, 0x00, 0xff, 0x80, 0x04, 0xff, 0x80, 0x07, 0x99, 0x00, 0x00, 0x00, 0x04, 0xff, 0x40, 0xaf, 0xff, 0x40, 0xd4, 0xff, 0x60, 0xcc, 0xff, 
+  0x40, 0xd3, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 0x85, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 
+  0xff, 0x05, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xd7, 0xff, 0x60, 0xcb, 0xff, 0x40, 0xd4, 0xff, 0x40, 0xbc, 0xff, 0x60, 0x08, 0x98, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x48, 0x82, 0xfe, 0xc0, 0xff, 
+  0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 0x89, 0xff, 0x21, 0xff, 0x85, 0xff, 0x01, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0x78, 
+  0x9a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xc7, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x8d, 0xff, 0x21, 0xff, 0x84, 0xff, 0x01, 0xff, 
+  0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xeb, 0x97, 0x00, 0x00, 0x00, 0x05, 0xff, 0x40, 0x03, 0xff, 0x60, 0x17, 0xff, 0x60, 0x20, 0xff, 0x60, 0x2c, 
+  0xff, 0x00, 0x67, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x85, 0xff, 0x21, 0xff, 0x82, 0xff, 0x41, 0xff, 0x85, 0xff, 0x21, 0xff, 0x83, 0xff, 
+  0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x04, 0xff, 0x00, 0x88, 0xff, 0x60, 0x2b, 0xff, 0x60, 0x20, 0xff, 0x60, 0x17, 0xff, 0x60, 0x03, 0x94, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0x20, 0xb3, 0xff, 0x00, 0xf3, 0xff, 0x00, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x83, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x82, 0xff, 0x41, 0xff, 
+  0x83, 0xff, 0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x02, 0xff, 0x00, 0xf3, 0xff, 0x20, 0xc8, 0xff, 0x60, 0x07, 0x94, 0x00, 0x00, 0x00, 0x01, 0xfe, 
+  0x80, 0x07, 0xfe, 0xc0, 0xef, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x41, 0xff, 0x86, 0xff, 0x42, 
+  0xff, 0x82, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xa0, 0x27, 0x96, 0x00, 0x00, 
+  0x00, 0x02, 0xfe, 0xa0, 0x2c, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x81, 
+  0xff, 0x42, 0xff, 0x85, 0xff, 0x62, 0xff, 0x82, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 
+  0xfe, 0xc0, 0xfc, 0xfe, 0xc0, 0x43, 0x95, 0x00, 0x00, 0x00, 0x04, 0xff, 0x60, 0x10, 0xff, 0x80, 0x2b, 0xff, 0x40, 0x87, 0xfe, 0xe0, 0xf3, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 
+  0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x86, 0xff, 0x62, 0xff, 0x82, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 
+  0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x03, 0xfe, 0xe0, 0xf7, 0xff, 0x40, 0x97, 0xff, 0x60, 0x34, 0xff, 0x60, 0x13, 0x92, 0x00, 0x00, 0x00, 0x01, 0xff, 0xa0, 0x10, 0xff, 
+  0x20, 0xe4, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 
+  0x42, 0xff, 0x88, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x01, 0xff, 0x20, 0xf3, 0xff, 0x60, 
+  0x2b, 0x92, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xa0, 0x23, 0xfe, 0xc0, 0xe7, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x81, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 
+  0x81, 0xff, 0x42, 0xff, 0x8a, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 
+  0x02, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf3, 0xfe, 0xa0, 0x3f, 0x94, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xc0, 0x0f, 0xfe, 0xc0, 0xc8, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 
+  0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x83, 0xff, 0x62, 0xff, 0x84, 0xff, 0x82, 0xff, 0x83, 0xff, 0x62, 0xff, 0x01, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0x83, 
+  0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xe0, 0xfe, 0xc0, 0x1f, 0x94, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x0c, 0xff, 0x60, 
+  0x68, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x82, 0xff, 0x62, 0xff, 0x85, 
+  0xff, 0x82, 0xff, 0x83, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x01, 
+  0xff, 0x40, 0x83, 0xff, 0x60, 0x13, 0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0x60, 0x68, 0xff, 0x20, 0xe7, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 
+  0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x82, 0xff, 0x62, 0xff, 0x85, 0xff, 0x82, 0xff, 0x83, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 
+  0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x03, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xeb, 0xff, 0x60, 0x80, 0x91, 0x00, 0x00, 
+  0x00, 0x02, 0xff, 0x00, 0x0b, 0xfe, 0xa0, 0xa8, 0xfe, 0xc0, 0xf8, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 
+  0xff, 0x42, 0xff, 0x82, 0xff, 0x62, 0xff, 0x85, 0xff, 0x82, 0xff, 0x83, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 
+  0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x03, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xfc, 0xfe, 0xc0, 0xc0, 0xfe, 0xe0, 0x23, 0x93, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xa0, 0x1f, 0xfe, 0xc0, 0xc3, 0xfe, 
+  0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x83, 0xff, 0x62, 0xff, 0x84, 0xff, 0x82, 0xff, 0x83, 0xff, 
+  0x62, 0xff, 0x01, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0x83, 0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xe0, 0xfe, 0xa0, 0x28, 
+  0x95, 0x00, 0x00, 0x00, 0x02, 0xff, 0x60, 0x47, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x81, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x00, 0xff, 
+  0x42, 0xff, 0x84, 0xff, 0x62, 0xff, 0x82, 0xff, 0x82, 0xff, 0x84, 0xff, 0x62, 0xff, 0x01, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 
+  0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xff, 0x41, 0x68, 0x94, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x70, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 
+  0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x89, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 
+  0x82, 0xff, 0x01, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x60, 0x98, 0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0x60, 0x17, 0xff, 0x00, 0xbc, 0xfe, 0xc0, 0xe3, 
+  0x82, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x87, 0xff, 0x62, 0xff, 
+  0x82, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x02, 0xfe, 0xc0, 0xe7, 0xfe, 0xe0, 0xc8, 0xff, 
+  0x60, 0x33, 0x93, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xc0, 0x10, 0xfe, 0xc0, 0x37, 0xfe, 0xc0, 0xe4, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x01, 0xff, 0x83, 
+  0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x85, 0xff, 0x62, 0xff, 0x82, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 
+  0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0x43, 0xfe, 0xe0, 0x17, 0x96, 0x00, 0x00, 0x00, 0x02, 0xff, 0x40, 0x60, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0x82, 
+  0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x89, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x83, 0xff, 0x21, 0xff, 0x82, 
+  0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0x80, 0x96, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x44, 0xfe, 0xe0, 0xff, 
+  0x81, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x83, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x82, 0xff, 0x41, 0xff, 0x83, 0xff, 0x21, 0xff, 
+  0x83, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xe0, 0xff, 0xff, 0x60, 0x68, 0x94, 0x00, 0x00, 0x00, 0x05, 0xff, 0xa0, 0x08, 0xff, 
+  0x00, 0xb7, 0xfe, 0xc0, 0xd8, 0xfe, 0xc0, 0xe0, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x85, 0xff, 0x21, 0xff, 0x86, 0xff, 
+  0x41, 0xff, 0x84, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xe4, 0xfe, 0xc0, 0xd8, 0xff, 0x00, 0xc0, 0xff, 
+  0x80, 0x13, 0x95, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xc0, 0x08, 0xfe, 0xa0, 0x0c, 0xfe, 0xe0, 0x77, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 
+  0x8d, 0xff, 0x21, 0xff, 0x84, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x03, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x9c, 0xfe, 0xa0, 0x0b, 0xfe, 0xa0, 0x08, 0x99, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x00, 0xf3, 0x81, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x84, 0xff, 0x01, 0xff, 0x8c, 0xff, 0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 
+  0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xff, 0x00, 0xff, 0xff, 0xe0, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x80, 0x83, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 
+  0x86, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 0x85, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xff, 0x20, 0xac, 0x98, 0x00, 0x00, 0x00, 
+  0x06, 0xff, 0xe0, 0x04, 0xfe, 0xe0, 0x8c, 0xfe, 0xc0, 0x7f, 0xfe, 0xc0, 0x74, 0xfe, 0xc0, 0x70, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x90, 0xff, 
+  0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xc0, 0x74, 0x02, 0xfe, 0xc0, 0x77, 0xfe, 0xc0, 0x93, 0xff, 0x80, 0x0c, 0x9b, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x53, 0x82, 0xfe, 0xc0, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x8a, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 
+  0x00, 0xff, 0x20, 0x7c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xac, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xc0, 0xf7, 0xfe, 0xc0, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x86, 
+  0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xc0, 0xf8, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xff, 0x00, 0xd4, 0x9f, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xe0, 0xe8, 0xfe, 
+  0xc0, 0x87, 0xfe, 0xc0, 0x34, 0xfe, 0xe0, 0x8c, 0x82, 0xfe, 0xc0, 0xff, 0x92, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x04, 0xfe, 0xc0, 0xb3, 0xfe, 0xc0, 0x2b, 0xfe, 0xc0, 0x7f, 0xfe, 0xc0, 
+  0xe4, 0xff, 0xa0, 0x17, 0xa1, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x93, 0x83, 0xfe, 0xc0, 0xff, 0x90, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xe0, 0xbb, 0xa5, 0x00, 0x00, 0x00, 
+  0x04, 0xfe, 0xe0, 0xa8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xcc, 0xfe, 0xc0, 0x58, 0xfe, 0xc0, 0xf4, 0x83, 0xfe, 0xc0, 0xff, 0x88, 0xfe, 0xe0, 0xff, 0x83, 0xfe, 0xc0, 0xff, 0x03, 0xfe, 0xc0, 0x57, 
+  0xfe, 0xc0, 0xb8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xcc, 0xa5, 0x00, 0x00, 0x00, 0x07, 0xfe, 0xe0, 0x98, 0xfe, 0xc0, 0x50, 0x00, 0x00, 0x00, 0xff, 0x00, 0x17, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xff, 
+  0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0xe4, 0x89, 0xfe, 0xc0, 0xff, 0x07, 0xfe, 0xc0, 0xeb, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf3, 0xfe, 0xe0, 0x23, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x38, 
+  0xfe, 0xc0, 0xa3, 0xa8, 0x00, 0x00, 0x00, 0x04, 0xff, 0x40, 0x0c, 0xfe, 0xc0, 0xdf, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0x40, 0xfe, 0xc0, 0x3c, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xc0, 0xeb, 0xfe, 
+  0xc0, 0xbc, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xc0, 0xd8, 0xfe, 0xc0, 0xcf, 0x81, 0xfe, 0xc0, 0xff, 0x04, 0xfe, 0xe0, 0x5c, 0xfe, 0xc0, 0x2c, 0xfe, 0xc0, 0xef, 0xfe, 0xc0, 0xeb, 0xff, 0x00, 
+  0x17, 0xab, 0x00, 0x00, 0x00, 0x13, 0xff, 0xe0, 0x03, 0xfe, 0xc0, 0xac, 0xfe, 0xc0, 0x17, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x17, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0x27, 0xfe, 0xe0, 
+  0x28, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x43, 0xfe, 0xc0, 0x14, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0x20, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x03, 0xfe, 0xc0, 0xa4, 0xff, 
+  0x20, 0x0c, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0xcb, 0xfe, 0xc0, 0x40, 0x81, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xc0, 0xb8, 0xfe, 0xc0, 0xd3, 0xff, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfe, 0xc0, 
+  0x27, 0xfe, 0xc0, 0xdb, 0xff, 0x60, 0x04, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x1b, 0xfe, 0xc0, 0x3f, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xa0, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00, 0xae, 0xae, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x03, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xee, 0xff, 0x43, 0x00, 0xe8, 0xfe, 0x00, 0x00, 0xe4, 0xfc, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xed, 0xff, 0x48, 0x00, 0xe9, 0xfe, 0x77, 0x00, 0xea, 0xfe, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x44, 0x00, 0xe6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xed, 0xfd, 0x14, 0x00, 0xeb, 0xfe, 0x00, 0x00, 0xc2, 0xff, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xe1, 0xfe, 0xdf, 0x00, 0xe9, 0xfd, 0x90, 0x00, 0xd1, 0xf8, 0x00, 0x06, 0xf7, 0xfd, 0x04, 0x00, 0xe1, 0xfe, 0xd7, 0x00, 0xde, 0xfe, 0xe7, 0x01, 0xf1, 0xff, 0x0f, 0x00, 0xe4, 0xfd, 0x00, 0x01, 0xeb, 0xff, 0x6b, 0x00, 0xe1, 0xfe, 0xef, 0x00, 0xed, 0xfe, 0x0c, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0xec, 0xfe, 0x00, 0x00, 0xee, 0xff, 0x0f, 0x00, 0xef, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x04, 0x00, 0xe3, 0xfe, 0xcb, 0x00, 0xed, 0xfe, 0x6c, 0x04, 0xed, 0xfe, 0x00, 0x03, 0xe8, 0xfe, 0x1f, 0x01, 0xdb, 0xfe, 0xf0, 0x01, 0xdd, 0xfe, 0xff, 0x03, 0xe9, 0xff, 0x60, 0x03, 0xe5, 0xfe, 0x4c, 0x01, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x04, 0xe7, 0xff, 0x70, 0x04, 0xea, 0xff, 0x3f, 0x02, 0xdd, 0xfe, 0xfc, 0x01, 0xda, 0xfe, 0xfc, 0x02, 0xe3, 0xfe, 0x2b, 0x02, 0xe9, 0xfe, 0x00, 0x00, 0xee, 0xfd, 0x50, 0x00, 0xe5, 0xfe, 0xcf, 0x00, 0xe8, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xee, 0xff, 0x13, 0x00, 0xe5, 0xfd, 0x00, 0x00, 0xef, 0xfe, 0x00, 0x01, 0xed, 0xff, 0x10, 0x00, 0xd9, 0xfe, 0xe0, 0x02, 0xde, 0xfe, 0xff, 0x04, 0xe9, 0xfe, 0x88, 0x02, 0xe4, 0xfe, 0x5b, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xe1, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x05, 0xe1, 0xfe, 0xfb, 0x02, 0xe3, 0xfe, 0xfc, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0x87, 0x03, 0xeb, 0xfe, 0x67, 0x02, 0xe1, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xec, 0x00, 0xe5, 0xfd, 0x1b, 0x04, 0xe9, 0xff, 0x00, 0x01, 0xee, 0xfe, 0x00, 0x00, 0xef, 0xff, 0x10, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xfe, 0x00, 0x00, 0xe3, 0xfe, 0xa8, 0x00, 0xed, 0xfe, 0xb3, 0x00, 0xf4, 0xfd, 0x10, 0x03, 0xe2, 0xfd, 0x13, 0x01, 0xda, 0xfe, 0xec, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xf7, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdf, 0xfe, 0xf7, 0x02, 0xdd, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xf8, 0x02, 0xdd, 0xfe, 0x20, 0x07, 0xed, 0xff, 0x07, 0x01, 0xec, 0xfe, 0x9f, 0x00, 0xe4, 0xfe, 0xbc, 0x00, 0xe7, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x01, 0xda, 0xfe, 0x00, 0x01, 0xdb, 0xfe, 0xa0, 0x00, 0xd9, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xff, 0x03, 0xe7, 0xfd, 0xaf, 0x02, 0xdb, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x05, 0xe5, 0xff, 0xa0, 0x03, 0xe6, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xd7, 0xfe, 0xc8, 0x00, 0xd3, 0xfe, 0x00, 0x00, 0xdc, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x03, 0x00, 0xee, 0xff, 0x2f, 0x00, 0xea, 0xfe, 0x00, 0x03, 0xe6, 0xfd, 0x00, 0x01, 0xdc, 0xfe, 0x8b, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xb3, 0x03, 0xe4, 0xff, 0x00, 0x03, 0xea, 0xfe, 0x00, 0x00, 0xf0, 0xff, 0x1c, 0x00, 0xec, 0xff, 0x10, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe3, 0xfe, 0x00, 0x00, 0xe4, 0xfe, 0xfb, 0x00, 0xe8, 0xfe, 0xec, 0x04, 0xe9, 0xfd, 0x93, 0x03, 0xe2, 0xfd, 0x9c, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xbb, 0x04, 0xe9, 0xff, 0x87, 0x03, 0xe8, 0xfe, 0xdf, 0x00, 0xe4, 0xfe, 0xff, 0x00, 0xe7, 0xfc, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfe, 0x00, 0x00, 0xdc, 0xfe, 0x90, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfd, 0xb8, 0x01, 0xda, 0xfd, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xef, 0xff, 0x04, 0x00, 0xf1, 0xff, 0x04, 0x03, 0xea, 0xfe, 0x00, 0x01, 0xdb, 0xfe, 0x37, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xde, 0xff, 0x5f, 0x04, 0xe9, 0xff, 0x00, 0x00, 0xef, 0xff, 0x04, 0x00, 0xef, 0xff, 0x07, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xf8, 0x00, 0x00, 0xe8, 0xfe, 0xaf, 0x00, 0xe9, 0xfe, 0xd4, 0x03, 0xec, 0xfe, 0xcc, 0x04, 0xe9, 0xfe, 0xd3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x04, 0xe8, 0xfe, 0xd7, 0x04, 0xec, 0xfe, 0xcb, 0x01, 0xe9, 0xfe, 0xd4, 0x00, 0xe8, 0xfe, 0xbc, 0x00, 0xec, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xfd, 0x00, 0x00, 0xd7, 0xfd, 0x48, 0x00, 0xd7, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xd7, 0xfe, 0x78, 0x00, 0xdb, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0xd4, 0xfd, 0x00, 0x02, 0xda, 0xfd, 0xc7, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xeb, 0x02, 0xcb, 0xfc, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x03, 0x00, 0xee, 0xfd, 0x17, 0x00, 0xed, 0xfd, 0x20, 0x04, 0xed, 0xfe, 0x2c, 0x02, 0xe1, 0xfe, 0x67, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0x88, 0x04, 0xee, 0xfe, 0x2b, 0x01, 0xed, 0xfd, 0x20, 0x00, 0xec, 0xfd, 0x17, 0x00, 0xee, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xe3, 0xfe, 0xb3, 0x00, 0xe1, 0xfe, 0xf3, 0x02, 0xdf, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x02, 0xe1, 0xfe, 0xf3, 0x00, 0xe3, 0xfe, 0xc8, 0x00, 0xee, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xd1, 0xff, 0x07, 0x00, 0xd8, 0xfe, 0xef, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd6, 0xff, 0x27, 0x00, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x01, 0xd6, 0xfe, 0x2c, 0x01, 0xd9, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xfc, 0x01, 0xd7, 0xfe, 0x43, 0x01, 0xdb, 0xfe, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xed, 0xfe, 0x10, 0x00, 0xef, 0xfe, 0x2b, 0x03, 0xe7, 0xfe, 0x87, 0x01, 0xdb, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xf7, 0x03, 0xe7, 0xfe, 0x97, 0x03, 0xec, 0xfe, 0x34, 0x00, 0xed, 0xff, 0x13, 0x00, 0xff, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xf4, 0xff, 0x10, 0x00, 0xe5, 0xfe, 0xe4, 0x00, 0xde, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0f, 0xea, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xdd, 0xfe, 0xff, 0x00, 0xe5, 0xfe, 0xf3, 0x00, 0xed, 0xff, 0x2b, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xd6, 0xff, 0x23, 0x01, 0xd8, 0xfe, 0xe7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf3, 0x01, 0xd5, 0xff, 0x3f, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdb, 0xfe, 0x00, 0x00, 0xd7, 0xfe, 0x0f, 0x01, 0xd9, 0xfd, 0xc8, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xe0, 0x00, 0xd9, 0xfe, 0x1f, 0x01, 0xda, 0xfe, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfc, 0x00, 0x00, 0xec, 0xfd, 0x00, 0x00, 0xf0, 0xff, 0x0c, 0x03, 0xeb, 0xff, 0x68, 0x02, 0xde, 0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfe, 0xff, 0x04, 0xe9, 0xff, 0x83, 0x01, 0xee, 0xff, 0x13, 0x00, 0xec, 0xfe, 0x00, 0x00, 0xe5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfc, 0x00, 0x00, 0xec, 0xfd, 0x68, 0x00, 0xe6, 0xfe, 0xe7, 0x01, 0xdc, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x13, 0xf1, 0xfb, 0xff, 0x13, 0xf1, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xe4, 0xfe, 0xeb, 0x00, 0xec, 0xfe, 0x80, 0x00, 0xe4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0xe1, 0xff, 0x0b, 0x00, 0xd6, 0xfe, 0xa8, 0x01, 0xd9, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x13, 0xf0, 0xfb, 0xff, 0x13, 0xf1, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xfc, 0x00, 0xd8, 0xfe, 0xc0, 0x00, 0xdb, 0xff, 0x23, 0x00, 0xde, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xd5, 0xfc, 0x00, 0x00, 0xd6, 0xfe, 0x1f, 0x02, 0xd9, 0xfd, 0xc3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xe0, 0x00, 0xd4, 0xfe, 0x28, 0x00, 0xa5, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x06, 0xea, 0xfd, 0x00, 0x04, 0xee, 0xff, 0x47, 0x02, 0xde, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x05, 0xea, 0xff, 0x68, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xda, 0xfb, 0x00, 0x00, 0xed, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x70, 0x00, 0xde, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdd, 0xfe, 0xff, 0x00, 0xeb, 0xfd, 0x98, 0x00, 0xe2, 0xfd, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x17, 0x00, 0xe0, 0xfe, 0xbc, 0x00, 0xd7, 0xfe, 0xe3, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xe7, 0x00, 0xdc, 0xfe, 0xc8, 0x00, 0xed, 0xff, 0x33, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xe5, 0xfe, 0x00, 0x00, 0xd9, 0xff, 0x10, 0x01, 0xd8, 0xfe, 0x37, 0x01, 0xd9, 0xfe, 0xe4, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf0, 0x01, 0xd8, 0xfe, 0x43, 0x02, 0xdb, 0xfd, 0x17, 0x00, 0xe0, 0xfd, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xfc, 0x00, 0x00, 0xe8, 0xfe, 0x00, 0x01, 0xe7, 0xfe, 0x60, 0x01, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0x80, 0x04, 0xe6, 0xfe, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0x00, 0x00, 0xef, 0xfd, 0x44, 0x00, 0xde, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xee, 0xfe, 0x68, 0x00, 0xec, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x08, 0x00, 0xe2, 0xfe, 0xb7, 0x00, 0xd7, 0xfe, 0xd8, 0x01, 0xd9, 0xfe, 0xe0, 0x01, 0xd9, 0xfe, 0xf0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xe4, 0x00, 0xd8, 0xfe, 0xd8, 0x00, 0xe0, 0xfe, 0xc0, 0x00, 0xf0, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x00, 0xe1, 0xfe, 0x00, 0x00, 0xd7, 0xff, 0x08, 0x00, 0xd4, 0xff, 0x0c, 0x02, 0xdb, 0xfe, 0x77, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0x9c, 0x00, 0xd3, 0xff, 0x0b, 0x00, 0xd6, 0xff, 0x08, 0x00, 0xe1, 0xfe, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x06, 0xcf, 0xfc, 0x00, 0x02, 0xe2, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xff, 0x00, 0xfd, 0xff, 0x0b, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xfe, 0x00, 0x00, 0xe9, 0xfe, 0x80, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xe5, 0xfe, 0xac, 0x00, 0xe2, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xdd, 0xfe, 0x8c, 0x00, 0xd7, 0xfe, 0x7f, 0x02, 0xd9, 0xfd, 0x74, 0x00, 0xd9, 0xff, 0x70, 0x02, 0xda, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xda, 0xff, 0x74, 0x02, 0xd9, 0xfd, 0x74, 0x00, 0xd8, 0xfd, 0x77, 0x00, 0xda, 0xfe, 0x93, 0x00, 0xef, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x00, 0xdd, 0xfe, 0x00, 0x00, 0xd7, 0xfe, 0x00, 0x01, 0xe2, 0xfe, 0x00, 0x01, 0xe2, 0xfe, 0x53, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0xe3, 0xff, 0x7c, 0x04, 0xe3, 0xfe, 0x00, 0x00, 0xd8, 0xfd, 0x00, 0x00, 0xdb, 0xfe, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xe2, 0xff, 0xac, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf7, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xe0, 0xfd, 0xd4, 0x00, 0xe1, 0xfd, 0x00, 0x00, 0xcd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xd8, 0xfd, 0x00, 0x00, 0xdc, 0xfe, 0xe8, 0x00, 0xd8, 0xfe, 0x87, 0x01, 0xda, 0xfe, 0x34, 0x02, 0xdb, 0xfd, 0x8c, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xb3, 0x01, 0xd9, 0xfe, 0x2b, 0x00, 0xd7, 0xfe, 0x7f, 0x00, 0xda, 0xfe, 0xe4, 0x00, 0xf6, 0xff, 0x17, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xd4, 0xfd, 0x00, 0x00, 0xdc, 0xfe, 0x00, 0x00, 0xd8, 0xfe, 0x00, 0x01, 0xde, 0xfe, 0x00, 0x01, 0xdf, 0xfe, 0x93, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xbb, 0x01, 0xdc, 0xfe, 0x00, 0x00, 0xd6, 0xfe, 0x00, 0x00, 0xd8, 0xfe, 0x00, 0x00, 0xf3, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xfe, 0x00, 0x00, 0xdd, 0xfe, 0xa8, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfd, 0xcc, 0x01, 0xd9, 0xfe, 0x58, 0x01, 0xd9, 0xfe, 0xf4, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0x57, 0x01, 0xd9, 0xfe, 0xb8, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xcc, 0x00, 0xd6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xfe, 0x00, 0x00, 0xdb, 0xfe, 0x98, 0x00, 0xd8, 0xfd, 0x50, 0x02, 0xd8, 0xfd, 0x00, 0x02, 0xe0, 0xfd, 0x17, 0x01, 0xda, 0xfe, 0xe8, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xfb, 0x01, 0xd9, 0xfe, 0xe4, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xeb, 0x01, 0xd9, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf3, 0x01, 0xdc, 0xfe, 0x23, 0x00, 0xda, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x38, 0x00, 0xd9, 0xfe, 0xa3, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xfb, 0x00, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0xd7, 0xfd, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x0c, 0x00, 0xd9, 0xfe, 0xdf, 0x00, 0xd8, 0xfe, 0xfb, 0x01, 0xda, 0xfe, 0x40, 0x01, 0xda, 0xfe, 0x3c, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xeb, 0x02, 0xda, 0xfd, 0xbc, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xd8, 0x02, 0xd9, 0xfd, 0xcf, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0x5c, 0x01, 0xd8, 0xfe, 0x2c, 0x00, 0xd8, 0xfe, 0xef, 0x00, 0xd9, 0xfe, 0xeb, 0x00, 0xe0, 0xff, 0x17, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xde, 0xfd, 0x00, 0x00, 0xc5, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x03, 0x00, 0xd9, 0xfe, 0xac, 0x00, 0xd8, 0xff, 0x17, 0x00, 0xda, 0xfe, 0x00, 0x00, 0xdd, 0xfd, 0x17, 0x00, 0xd8, 0xfe, 0xe8, 0x00, 0xd8, 0xfe, 0xf4, 0x01, 0xda, 0xfe, 0x27, 0x00, 0xdd, 0xff, 0x28, 0x01, 0xd9, 0xfe, 0xfb, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdb, 0xfe, 0x43, 0x00, 0xd7, 0xff, 0x14, 0x01, 0xd8, 0xfe, 0xe8, 0x00, 0xd8, 0xfe, 0xf4, 0x00, 0xd8, 0xfe, 0x20, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0xd9, 0xfe, 0xa4, 0x00, 0xe6, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xda, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xc3, 0xfc, 0x00, 0x00, 0xd8, 0xfe, 0xcb, 0x00, 0xd9, 0xff, 0x40, 0x01, 0xd6, 0xfe, 0x00, 0x01, 0xb2, 0xf9, 0x00, 0x00, 0xd8, 0xfe, 0xb8, 0x00, 0xd8, 0xfe, 0xd3, 0x00, 0xe2, 0xfd, 0x03, 0x00, 0xd6, 0xfe, 0x00, 0x00, 0xd9, 0xff, 0x27, 0x00, 0xd8, 0xfe, 0xdb, 0x00, 0xec, 0xff, 0x04, 0x00, 0xdb, 0xff, 0x00, 0x00, 0xdb, 0xff, 0x00, 0x00, 0xd6, 0xfc, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xef, 0xff, 0x04, 0x00, 0xdc, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x1b, 0x00, 0xd8, 0xff, 0x3f, 0x00, 0xda, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0xf4, 0xff, 0x04, 0x00, 0xe7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 
+  0xff, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x43, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xed, 0xff, 0x48, 0x00, 0xe9, 0xfe, 0x77, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xec, 0xff, 0x44, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xfd, 0x14, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0xff, 0xff, 0x03, 0x00, 0xe1, 0xfe, 0xdf, 0x00, 0xe9, 0xfd, 0x90, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xf7, 0xfd, 0x04, 0x00, 0xe1, 0xfe, 0xd7, 0x00, 0xde, 0xfe, 0xe7, 0x01, 0xf1, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xeb, 0xff, 0x6b, 0x00, 0xe1, 0xfe, 0xef, 
+  0x00, 0xed, 0xfe, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x0f, 0x00, 0xef, 0xff, 0x03, 0xab, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xef, 0xff, 0x04, 0x00, 0xe3, 0xfe, 0xcb, 
+  0x00, 0xed, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8, 0xfe, 0x1f, 0x01, 0xdb, 0xfe, 0xf0, 0x01, 0xdd, 0xfe, 0xff, 0x03, 0xe9, 0xff, 0x60, 0x03, 0xe5, 0xfe, 0x4c, 0x01, 0xdb, 0xfe, 0xff, 
+  0x01, 0xda, 0xfe, 0xff, 0x04, 0xe7, 0xff, 0x70, 0x04, 0xea, 0xff, 0x3f, 0x02, 0xdd, 0xfe, 0xfc, 0x01, 0xda, 0xfe, 0xfc, 0x02, 0xe3, 0xfe, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xfd, 0x50, 
+  0x00, 0xe5, 0xfe, 0xcf, 0x00, 0xe8, 0xff, 0x10, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x13, 0x81, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0xed, 0xff, 0x10, 0x00, 0xd9, 0xfe, 0xe0, 
+  0x02, 0xde, 0xfe, 0xff, 0x04, 0xe9, 0xfe, 0x88, 0x02, 0xe4, 0xfe, 0x5b, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xe1, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xf3, 0x81, 0x02, 0xda, 0xfe, 
+  0xff, 0x01, 0x05, 0xe1, 0xfe, 0xfb, 0x02, 0xe3, 0xfe, 0xfc, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0x03, 0xe3, 0xfe, 0x87, 0x03, 0xeb, 0xfe, 0x67, 0x02, 0xe1, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xec, 
+  0x00, 0xe5, 0xfd, 0x1b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x10, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0xe3, 0xfe, 0xa8, 0x00, 0xed, 0xfe, 0xb3, 0x00, 0xf4, 0xfd, 0x10, 
+  0x03, 0xe2, 0xfd, 0x13, 0x01, 0xda, 0xfe, 0xec, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xf7, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 
+  0x02, 0xdb, 0xfe, 0xff, 0x82, 0x03, 0xdb, 0xfd, 0xff, 0x82, 0x02, 0xdb, 0xfe, 0xff, 0x07, 0x03, 0xdf, 0xfe, 0xf7, 0x02, 0xdd, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xf8, 0x02, 
+  0xdd, 0xfe, 0x20, 0x07, 0xed, 0xff, 0x07, 0x01, 0xec, 0xfe, 0x9f, 0x00, 0xe4, 0xfe, 0xbc, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xdb, 0xfe, 0xa0, 0x00, 0xd9, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 
+  0xff, 0x03, 0xe7, 0xfd, 0xaf, 0x02, 0xdb, 0xfe, 0xf8, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x85, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x03, 0xdb, 
+  0xfd, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x05, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x05, 0xe5, 0xff, 0xa0, 0x03, 0xe6, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xd7, 0xfe, 0xc8, 
+  0xa1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd4, 0xff, 0x03, 0x00, 0xee, 0xff, 0x2f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0xdc, 0xfe, 0x8b, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 
+  0x02, 0xdc, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x89, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 
+  0x04, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xb3, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf0, 0xff, 0x1c, 0x00, 
+  0xec, 0xff, 0x10, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xe4, 0xfe, 0xfb, 0x00, 0xe8, 0xfe, 0xec, 0x04, 0xe9, 0xfd, 0x93, 0x03, 0xe2, 0xfd, 0x9c, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 
+  0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x86, 0x05, 0xde, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x81, 0x04, 
+  0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x06, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xbb, 0x04, 0xe9, 0xff, 0x87, 0x03, 0xe8, 0xfe, 
+  0xdf, 0x00, 0xe4, 0xfe, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xdc, 0xfe, 0x90, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 
+  0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x06, 0xdf, 0xfd, 0xff, 0x86, 0x06, 0xe0, 0xfd, 0xff, 0x01, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 
+  0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x03, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x02, 0xdc, 0xfe, 0xff, 0x01, 0x01, 0xd9, 0xfe, 
+  0xff, 0x01, 0xd9, 0xfd, 0xb8, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0xef, 0xff, 0x04, 0x00, 0xf1, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdb, 0xfe, 0x37, 0x01, 0xd9, 0xfe, 0xff, 0x02, 
+  0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 
+  0xdf, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x85, 0x07, 0xe1, 0xfd, 0xff, 0x00, 0x07, 0xe0, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x00, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 
+  0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x01, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x03, 0x03, 0xde, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 
+  0x04, 0x00, 0xef, 0xff, 0x07, 0x99, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xe8, 0xfe, 0xaf, 0x00, 0xe9, 0xfe, 0xd4, 0x03, 0xec, 0xfe, 0xcc, 0x04, 0xe9, 0xfe, 0xd3, 0x02, 0xda, 0xfe, 0xff, 0x02, 
+  0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x03, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 
+  0xe2, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x84, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 
+  0xff, 0x08, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x04, 0xe8, 0xfe, 0xd7, 0x04, 0xec, 0xfe, 0xcb, 0x01, 0xe9, 0xfe, 0xd4, 0x00, 0xe8, 
+  0xfe, 0xbc, 0x00, 0xec, 0xff, 0x08, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd7, 0xfd, 0x48, 0x00, 0xd7, 0xfe, 0xff, 0x81, 0x01, 0xd8, 0xfe, 0xff, 0x05, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 
+  0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x01, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 
+  0x81, 0x08, 0xe3, 0xfd, 0xff, 0x01, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x81, 0x09, 0xe4, 0xfc, 0xff, 0x81, 0x09, 0xe4, 0xfd, 0xff, 0x01, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 
+  0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x03, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x02, 0x03, 0xdc, 0xfd, 
+  0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x81, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0x00, 0xd7, 0xfe, 0x78, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x02, 0xda, 0xfd, 0xc7, 0x01, 0xda, 0xfe, 
+  0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 
+  0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x82, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x00, 0x0a, 0xe6, 0xfc, 0xff, 
+  0x82, 0x0a, 0xe5, 0xfc, 0xff, 0x01, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 
+  0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xeb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xe8, 
+  0xff, 0x03, 0x00, 0xee, 0xfd, 0x17, 0x00, 0xed, 0xfd, 0x20, 0x04, 0xed, 0xfe, 0x2c, 0x02, 0xe1, 0xfe, 0x67, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 
+  0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x01, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x03, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 
+  0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x82, 0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x04, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 
+  0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x0a, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 
+  0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0x88, 0x04, 0xee, 0xfe, 0x2b, 0x01, 0xed, 0xfd, 0x20, 0x00, 0xec, 0xfd, 0x17, 0x00, 0xee, 0xff, 0x03, 0x94, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0x00, 0xe3, 0xfe, 0xb3, 0x00, 0xe1, 0xfe, 0xf3, 0x02, 0xdf, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x09, 
+  0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 
+  0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x00, 0x0d, 0xe8, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x00, 0x0c, 0xe7, 0xfc, 
+  0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x01, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 
+  0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x02, 0xe1, 0xfe, 0xf3, 0x00, 0xe3, 0xfe, 0xc8, 0x00, 0xee, 0xff, 0x07, 0x94, 0x00, 
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0xd1, 0xff, 0x07, 0x00, 0xd8, 0xfe, 0xef, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 
+  0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x86, 0x0d, 0xe9, 0xfc, 0xff, 0x02, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0a, 0xe5, 0xfc, 0xff, 
+  0x03, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0x02, 0xda, 0xfe, 0xff, 
+  0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd6, 0xff, 0x27, 0x96, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0xd6, 0xfe, 0x2c, 0x01, 0xd9, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 
+  0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 
+  0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x81, 0x0e, 0xeb, 0xfc, 0xff, 0x82, 0x0f, 0xeb, 0xfc, 0xff, 
+  0x11, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 
+  0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 
+  0xff, 0x02, 0xda, 0xfe, 0xfc, 0x01, 0xd7, 0xfe, 0x43, 0x95, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xed, 0xfe, 0x10, 0x00, 0xef, 0xfe, 0x2b, 0x03, 0xe7, 0xfe, 0x87, 0x01, 0xdb, 0xfe, 0xf3, 0x02, 
+  0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 
+  0xe4, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x81, 0x0e, 0xea, 0xfc, 0xff, 0x00, 0x0f, 0xeb, 0xfc, 0xff, 0x84, 0x0f, 0xec, 
+  0xfc, 0xff, 0x01, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 
+  0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 
+  0xf7, 0x03, 0xe7, 0xfe, 0x97, 0x03, 0xec, 0xfe, 0x34, 0x00, 0xed, 0xff, 0x13, 0x92, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xf4, 0xff, 0x10, 0x00, 0xe5, 0xfe, 0xe4, 0x00, 0xde, 0xfe, 0xff, 0x01, 
+  0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 
+  0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0f, 0xea, 0xfc, 0xff, 0x0f, 
+  0xec, 0xfc, 0xff, 0x81, 0x10, 0xed, 0xfb, 0xff, 0x81, 0x10, 0xee, 0xfb, 0xff, 0x81, 0x10, 0xed, 0xfb, 0xff, 0x81, 0x0f, 0xec, 0xfc, 0xff, 0x0c, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 
+  0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 
+  0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0x01, 0xdd, 0xfe, 0xff, 0x00, 0xe5, 0xfe, 0xf3, 0x00, 0xed, 0xff, 0x2b, 0x92, 0x00, 
+  0x00, 0x00, 0x00, 0x10, 0x00, 0xd6, 0xff, 0x23, 0x01, 0xd8, 0xfe, 0xe7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 
+  0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0f, 0xec, 0xfc, 0xff, 0x00, 0x10, 0xed, 0xfb, 0xff, 0x84, 0x11, 0xee, 0xfb, 0xff, 0x12, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 
+  0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 
+  0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf3, 
+  0x01, 0xd5, 0xff, 0x3f, 0x94, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xd7, 0xfe, 0x0f, 0x01, 0xd9, 0xfd, 0xc8, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 
+  0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x0a, 0xe5, 0xfc, 0xff, 0x1d, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 
+  0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 
+  0x12, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 
+  0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xe0, 0x00, 0xd9, 0xfe, 0x1f, 0x94, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf0, 0xff, 0x0c, 0x03, 0xeb, 0xff, 0x68, 0x02, 0xde, 
+  0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x09, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 
+  0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x81, 0x10, 0xed, 0xfb, 0xff, 0x01, 0x11, 0xef, 
+  0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x82, 0x12, 0xf0, 0xfb, 0xff, 0x13, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 
+  0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 
+  0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfe, 0xff, 0x04, 0xe9, 0xff, 0x83, 0x01, 0xee, 0xff, 0x13, 0x92, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0x00, 0xec, 0xfd, 0x68, 0x00, 0xe6, 0xfe, 0xe7, 0x01, 0xdc, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x0d, 
+  0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 
+  0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x81, 0x13, 0xf1, 0xfb, 0xff, 0x81, 0x12, 0xf0, 
+  0xfb, 0xff, 0x03, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 
+  0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 
+  0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xe4, 0xfe, 0xeb, 0x00, 0xec, 0xfe, 0x80, 0x91, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xe1, 0xff, 0x0b, 0x00, 0xd6, 0xfe, 0xa8, 0x01, 
+  0xd9, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x15, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 
+  0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 
+  0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x13, 0xf0, 0xfb, 0xff, 0x13, 0xf1, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 
+  0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 
+  0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 
+  0xd9, 0xfe, 0xfc, 0x00, 0xd8, 0xfe, 0xc0, 0x00, 0xdb, 0xff, 0x23, 0x93, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xd6, 0xfe, 0x1f, 0x02, 0xd9, 0xfd, 0xc3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 
+  0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x0a, 0xe5, 0xfc, 0xff, 0x1d, 0x0c, 
+  0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 
+  0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 
+  0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 
+  0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xe0, 0x00, 0xd4, 0xfe, 0x28, 0x95, 0x00, 0x00, 0x00, 0x00, 0x11, 0x04, 0xee, 0xff, 
+  0x47, 0x02, 0xde, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 
+  0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 
+  0xff, 0x10, 0xed, 0xfb, 0xff, 0x81, 0x11, 0xee, 0xfb, 0xff, 0x82, 0x11, 0xef, 0xfb, 0xff, 0x00, 0x11, 0xee, 0xfb, 0xff, 0x81, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 
+  0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 
+  0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x05, 0xea, 0xff, 0x68, 0x94, 0x00, 0x00, 0x00, 0x00, 0x12, 
+  0x00, 0xeb, 0xff, 0x70, 0x00, 0xde, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 
+  0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 
+  0x0d, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x81, 0x10, 0xed, 0xfb, 0xff, 0x81, 0x10, 0xee, 0xfb, 0xff, 0x81, 0x10, 0xed, 0xfb, 0xff, 0x81, 0x0f, 0xec, 0xfc, 0xff, 
+  0x10, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 
+  0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdd, 0xfe, 
+  0xff, 0x00, 0xeb, 0xfd, 0x98, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xeb, 0xff, 0x17, 0x00, 0xe0, 0xfe, 0xbc, 0x00, 0xd7, 0xfe, 0xe3, 0x01, 0xd9, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 
+  0x0f, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 
+  0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xec, 0xfc, 
+  0xff, 0x82, 0x10, 0xed, 0xfb, 0xff, 0x0c, 0x10, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 
+  0xe7, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xe7, 0x00, 0xdc, 0xfe, 0xc8, 0x00, 0xed, 0xff, 0x33, 0x93, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 
+  0xd9, 0xff, 0x10, 0x01, 0xd8, 0xfe, 0x37, 0x01, 0xd9, 0xfe, 0xe4, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 
+  0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe9, 0xfc, 0xff, 0x0d, 
+  0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x81, 0x0e, 0xeb, 0xfc, 0xff, 0x82, 0x0f, 0xeb, 0xfc, 0xff, 0x12, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 
+  0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 
+  0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf0, 0x01, 0xd8, 0xfe, 0x43, 0x02, 0xdb, 0xfd, 0x17, 0x96, 0x00, 
+  0x00, 0x00, 0x00, 0x10, 0x01, 0xe7, 0xfe, 0x60, 0x01, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 
+  0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 
+  0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x85, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 
+  0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 
+  0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0x80, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xef, 0xfd, 0x44, 0x00, 0xde, 0xfe, 0xff, 0x81, 0x01, 0xd9, 
+  0xfe, 0xff, 0x01, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x09, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 
+  0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x81, 0x0d, 
+  0xe9, 0xfc, 0xff, 0x00, 0x0d, 0xe8, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x00, 0x0c, 0xe7, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x01, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 
+  0x81, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 
+  0xd9, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xee, 0xfe, 0x68, 0x94, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xf4, 0xff, 0x08, 0x00, 0xe2, 0xfe, 0xb7, 0x00, 0xd7, 0xfe, 0xd8, 0x01, 0xd9, 0xfe, 
+  0xe0, 0x01, 0xd9, 0xfe, 0xf0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 
+  0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x81, 0x0c, 0xe7, 0xfc, 0xff, 0x82, 
+  0x0c, 0xe8, 0xfc, 0xff, 0x13, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 
+  0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 
+  0xff, 0x02, 0xda, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xe4, 0x00, 0xd8, 0xfe, 0xd8, 0x00, 0xe0, 0xfe, 0xc0, 0x00, 0xf0, 0xff, 0x13, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xd7, 0xff, 0x08, 0x00, 
+  0xd4, 0xff, 0x0c, 0x02, 0xdb, 0xfe, 0x77, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 
+  0xdf, 0xfd, 0xff, 0x06, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x82, 0x0a, 0xe5, 0xfc, 0xff, 
+  0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x00, 0x0a, 0xe6, 0xfc, 0xff, 0x82, 0x0a, 0xe5, 0xfc, 0xff, 0x01, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x0a, 0x07, 0xe1, 
+  0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdc, 
+  0xfe, 0x9c, 0x00, 0xd3, 0xff, 0x0b, 0x00, 0xd6, 0xff, 0x08, 0x99, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0xe2, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x08, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 
+  0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x84, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x09, 0xe4, 0xfc, 0xff, 0x07, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 
+  0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0x02, 
+  0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xff, 0x00, 0xfd, 0xff, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe9, 0xfe, 0x80, 0x00, 0xd8, 0xfe, 0xff, 0x81, 0x01, 0xd9, 
+  0xfe, 0xff, 0x01, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x06, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 
+  0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x84, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 
+  0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x07, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 
+  0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xe5, 0xfe, 0xac, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xdd, 0xfe, 0x8c, 0x00, 0xd7, 0xfe, 0x7f, 0x02, 0xd9, 
+  0xfd, 0x74, 0x00, 0xd9, 0xff, 0x70, 0x02, 0xda, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x01, 0x05, 0xde, 0xfd, 0xff, 
+  0x05, 0xdf, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x00, 0x07, 0xe2, 0xfd, 0xff, 0x84, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x05, 0x07, 0xe0, 
+  0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x06, 0x02, 0xdb, 0xfe, 0xff, 
+  0x02, 0xda, 0xfe, 0xff, 0x00, 0xda, 0xff, 0x74, 0x02, 0xd9, 0xfd, 0x74, 0x00, 0xd8, 0xfd, 0x77, 0x00, 0xda, 0xfe, 0x93, 0x00, 0xef, 0xff, 0x0c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe2, 
+  0xfe, 0x53, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 
+  0x06, 0xdf, 0xfd, 0xff, 0x86, 0x06, 0xe0, 0xfd, 0xff, 0x01, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x07, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0xe3, 0xff, 0x7c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xe2, 
+  0xff, 0xac, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf7, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 
+  0xdd, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 0xff, 0x82, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 
+  0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf8, 0x81, 0x01, 0xd9, 0xfe, 
+  0xff, 0x00, 0x00, 0xe0, 0xfd, 0xd4, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xdc, 0xfe, 0xe8, 0x00, 0xd8, 0xfe, 0x87, 0x01, 0xda, 0xfe, 0x34, 0x02, 0xdb, 0xfd, 0x8c, 0x01, 0xd9, 0xfe, 0xff, 
+  0x81, 0x02, 0xda, 0xfe, 0xff, 0x01, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x89, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 0x81, 0x03, 0xdc, 
+  0xfd, 0xff, 0x08, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xb3, 0x01, 0xd9, 0xfe, 0x2b, 0x00, 0xd7, 0xfe, 0x7f, 0x00, 
+  0xda, 0xfe, 0xe4, 0x00, 0xf6, 0xff, 0x17, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xfe, 0x93, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 
+  0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdc, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 0x82, 0x03, 0xdc, 0xfd, 
+  0xff, 0x00, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xbb, 0xa5, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0x00, 0xdd, 0xfe, 0xa8, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfd, 0xcc, 0x01, 0xd9, 0xfe, 0x58, 0x01, 0xd9, 0xfe, 0xf4, 0x01, 0xd9, 0xfe, 0xff, 0x82, 0x02, 0xda, 0xfe, 0xff, 0x82, 
+  0x02, 0xdb, 0xfe, 0xff, 0x82, 0x03, 0xdb, 0xfd, 0xff, 0x82, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x05, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0x57, 
+  0x01, 0xd9, 0xfe, 0xb8, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xcc, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xdb, 0xfe, 0x98, 0x00, 0xd8, 0xfd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe0, 
+  0xfd, 0x17, 0x01, 0xda, 0xfe, 0xe8, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xfb, 0x01, 0xd9, 0xfe, 0xe4, 0x89, 0x02, 0xda, 0xfe, 0xff, 0x07, 0x01, 0xda, 0xfe, 0xeb, 0x01, 0xd9, 0xfe, 0xf3, 
+  0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf3, 0x01, 0xdc, 0xfe, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x38, 0x00, 0xd9, 0xfe, 0xa3, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe7, 
+  0xff, 0x0c, 0x00, 0xd9, 0xfe, 0xdf, 0x00, 0xd8, 0xfe, 0xfb, 0x01, 0xda, 0xfe, 0x40, 0x01, 0xda, 0xfe, 0x3c, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0x01, 0xd9, 0xfe, 0xeb, 0x02, 0xda, 0xfd, 0xbc, 
+  0x81, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0x01, 0xd9, 0xfe, 0xd8, 0x02, 0xd9, 0xfd, 0xcf, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0x00, 0xdc, 0xff, 0x5c, 0x01, 0xd8, 0xfe, 0x2c, 0x00, 0xd8, 0xfe, 0xef, 
+  0x00, 0xd9, 0xfe, 0xeb, 0x00, 0xe0, 0xff, 0x17, 0xab, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xfc, 0xff, 0x03, 0x00, 0xd9, 0xfe, 0xac, 0x00, 0xd8, 0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 
+  0xfd, 0x17, 0x00, 0xd8, 0xfe, 0xe8, 0x00, 0xd8, 0xfe, 0xf4, 0x01, 0xda, 0xfe, 0x27, 0x00, 0xdd, 0xff, 0x28, 0x01, 0xd9, 0xfe, 0xfb, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdb, 0xfe, 0x43, 0x00, 0xd7, 
+  0xff, 0x14, 0x01, 0xd8, 0xfe, 0xe8, 0x00, 0xd8, 0xfe, 0xf4, 0x00, 0xd8, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0xd9, 0xfe, 0xa4, 0x00, 0xe6, 0xff, 0x0c, 0xb0, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xd8, 0xfe, 0xcb, 0x00, 0xd9, 0xff, 0x40, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xd8, 0xfe, 0xb8, 0x00, 0xd8, 0xfe, 0xd3, 0x00, 0xe2, 0xfd, 0x03, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xd9, 0xff, 0x27, 0x00, 0xd8, 0xfe, 0xdb, 0x00, 0xec, 0xff, 0x04, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x04, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe0, 
+  0xff, 0x1b, 0x00, 0xd8, 0xff, 0x3f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +423,7 @@ const lv_img_dsc_t owm_01d_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_01d_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_01d_64px_map,
 };
-
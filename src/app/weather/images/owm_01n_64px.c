@@ -10,271 +10,367 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_01N_64PX uint8_t owm_01n_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x08, 0xdb, 0x17, 0xdb, 0x23, 0xdb, 0x2c, 0xdb, 0x33, 0xdb, 0x33, 0xdb, 0x2c, 0xdb, 0x23, 0xdb, 0x17, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x38, 0xdb, 0x8b, 0xdb, 0xdc, 0xdb, 0xe8, 0xdb, 0xf4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf4, 0xdb, 0xe8, 0xdb, 0xdc, 0xdb, 0x8b, 0xdb, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0b, 0xdb, 0x47, 0xdb, 0xbf, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xbf, 0xdb, 0x47, 0xdb, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x3b, 0xdb, 0xcf, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0xcf, 0xdb, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0xdb, 0x73, 0xdb, 0xf7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf7, 0xdb, 0x73, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x08, 0xdb, 0x9b, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9b, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0xdb, 0xa3, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xa3, 0xb7, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x8f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x67, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x18, 0xdb, 0xe7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe7, 0xb7, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x9f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x9f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x14, 0xdb, 0xe7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe7, 0xb7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33, 0xdb, 0xfb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xfb, 0xdb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xb4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xeb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x90, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x53, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1b, 0xdb, 0xec, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xec, 0xdb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x07, 0xdb, 0xcb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xcb, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x54, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x38, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xb7, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0xdb, 0xa0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xa0, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0xdb, 0xc8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xc8, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x23, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xdb, 0xb7, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2b, 0xdb, 0xd4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd4, 0xdb, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1b, 0xdb, 0xcb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xcb, 0xb7, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x08, 0xdb, 0x7b, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0x7b, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2f, 0xdb, 0xab, 0xdb, 0xf0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf0, 0xb7, 0xab, 0xdb, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0xdb, 0x1b, 0xdb, 0x7f, 0xdb, 0xd0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd0, 0xdb, 0x7f, 0xdb, 0x1b, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x24, 0xdb, 0x5f, 0xdb, 0x8c, 0xdb, 0xb0, 0xdb, 0xc7, 0xdb, 0xc7, 0xdb, 0xb0, 0xdb, 0x8c, 0xb7, 0x5f, 0xb7, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x03, 0xdb, 0x08, 0xdb, 0x17, 0xdb, 0x23, 
+  0xdb, 0x2c, 0x81, 0xdb, 0x33, 0x03, 0xdb, 0x2c, 0xdb, 0x23, 0xdb, 0x17, 0xdb, 0x08, 0xb3, 0x00, 0x00, 0x04, 0xdb, 0x38, 0xdb, 0x8b, 0xdb, 0xdc, 0xdb, 0xe8, 0xdb, 0xf4, 0x83, 0xdb, 0xff, 0x04, 
+  0xdb, 0xf4, 0xdb, 0xe8, 0xdb, 0xdc, 0xdb, 0x8b, 0xdb, 0x38, 0xae, 0x00, 0x00, 0x02, 0xdb, 0x0b, 0xdb, 0x47, 0xdb, 0xbf, 0x8d, 0xdb, 0xff, 0x02, 0xdb, 0xbf, 0xdb, 0x47, 0xdb, 0x0b, 0xaa, 0x00, 
+  0x00, 0x02, 0xdb, 0x3b, 0xdb, 0xcf, 0xdb, 0xf8, 0x8f, 0xdb, 0xff, 0x02, 0xdb, 0xf8, 0xdb, 0xcf, 0xdb, 0x3b, 0xa7, 0x00, 0x00, 0x02, 0xdb, 0x04, 0xdb, 0x73, 0xdb, 0xf7, 0x93, 0xdb, 0xff, 0x02, 
+  0xdb, 0xf7, 0xdb, 0x73, 0xdb, 0x04, 0xa4, 0x00, 0x00, 0x01, 0xdb, 0x08, 0xdb, 0x9b, 0x97, 0xdb, 0xff, 0x01, 0xdb, 0x9b, 0xdb, 0x08, 0xa2, 0x00, 0x00, 0x01, 0xdb, 0x0c, 0xdb, 0xa3, 0x99, 0xdb, 
+  0xff, 0x01, 0xdb, 0xa3, 0xb7, 0x0c, 0xa1, 0x00, 0x00, 0x00, 0xdb, 0x8f, 0x9b, 0xdb, 0xff, 0x00, 0xdb, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0xdb, 0x67, 0x9d, 0xdb, 0xff, 0x00, 0xdb, 0x67, 0x9e, 0x00, 
+  0x00, 0x01, 0xdb, 0x18, 0xdb, 0xe7, 0x89, 0xdb, 0xff, 0x01, 0xff, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x8f, 0xdb, 0xff, 0x01, 0xdb, 0xe7, 0xb7, 0x18, 0x9d, 0x00, 0x00, 0x00, 0xdb, 0x9f, 0x8b, 
+  0xdb, 0xff, 0x84, 0xff, 0xff, 0x8e, 0xdb, 0xff, 0x00, 0xdb, 0x9f, 0x9c, 0x00, 0x00, 0x00, 0xdb, 0x33, 0x8c, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x8e, 0xdb, 0xff, 0x00, 0xb7, 0x33, 0x9b, 0x00, 0x00, 
+  0x00, 0xdb, 0x9f, 0x8c, 0xdb, 0xff, 0x86, 0xff, 0xff, 0x8d, 0xdb, 0xff, 0x00, 0xdb, 0x9f, 0x9a, 0x00, 0x00, 0x01, 0xdb, 0x14, 0xdb, 0xe7, 0x8c, 0xdb, 0xff, 0x87, 0xff, 0xff, 0x8c, 0xdb, 0xff, 
+  0x01, 0xdb, 0xe7, 0xb7, 0x14, 0x99, 0x00, 0x00, 0x01, 0xdb, 0x33, 0xdb, 0xfb, 0x84, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x85, 0xdb, 0xff, 0x88, 0xff, 0xff, 0x8b, 0xdb, 0xff, 0x01, 0xdb, 0xfb, 0xdb, 
+  0x33, 0x99, 0x00, 0x00, 0x00, 0xdb, 0x7f, 0x85, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x8c, 0xdb, 0xff, 0x00, 0xdb, 0x7f, 0x99, 0x00, 0x00, 0x00, 0xdb, 0xb4, 0x84, 
+  0xdb, 0xff, 0x91, 0xff, 0xff, 0x8c, 0xdb, 0xff, 0x00, 0xdb, 0xb4, 0x99, 0x00, 0x00, 0x00, 0xdb, 0xe0, 0x85, 0xdb, 0xff, 0x90, 0xff, 0xff, 0x8c, 0xdb, 0xff, 0x00, 0xdb, 0xe0, 0x99, 0x00, 0x00, 
+  0x86, 0xdb, 0xff, 0x90, 0xff, 0xff, 0x8d, 0xdb, 0xff, 0x99, 0x00, 0x00, 0x85, 0xdb, 0xff, 0x8f, 0xff, 0xff, 0x8f, 0xdb, 0xff, 0x99, 0x00, 0x00, 0x86, 0xdb, 0xff, 0x8e, 0xff, 0xff, 0x8f, 0xdb, 
+  0xff, 0x99, 0x00, 0x00, 0x00, 0xdb, 0xeb, 0x85, 0xdb, 0xff, 0x8d, 0xff, 0xff, 0x8f, 0xdb, 0xff, 0x00, 0xdb, 0xeb, 0x99, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0x87, 0xdb, 0xff, 0x8a, 0xff, 0xff, 0x01, 
+  0xdb, 0xff, 0xff, 0xff, 0x8e, 0xdb, 0xff, 0x00, 0xb7, 0xc4, 0x99, 0x00, 0x00, 0x00, 0xdb, 0x90, 0x87, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xff, 0xff, 0x8f, 0xdb, 0xff, 0x00, 0xdb, 
+  0x90, 0x99, 0x00, 0x00, 0x00, 0xdb, 0x53, 0x88, 0xdb, 0xff, 0x88, 0xff, 0xff, 0x91, 0xdb, 0xff, 0x00, 0xb7, 0x53, 0x99, 0x00, 0x00, 0x01, 0xdb, 0x1b, 0xdb, 0xec, 0x89, 0xdb, 0xff, 0x86, 0xff, 
+  0xff, 0x90, 0xdb, 0xff, 0x01, 0xdb, 0xec, 0xdb, 0x1b, 0x99, 0x00, 0x00, 0x01, 0xdb, 0x07, 0xdb, 0xcb, 0x8b, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x91, 0xdb, 0xff, 0x01, 0xdb, 0xcb, 0xdb, 0x07, 0x9a, 
+  0x00, 0x00, 0x00, 0xdb, 0x54, 0xa1, 0xdb, 0xff, 0x00, 0xb7, 0x54, 0x9c, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0x9f, 0xdb, 0xff, 0x00, 0xb7, 0xc4, 0x9d, 0x00, 0x00, 0x01, 0xdb, 0x38, 0xdb, 0xf8, 0x9d, 
+  0xdb, 0xff, 0x01, 0xdb, 0xf8, 0xb7, 0x38, 0x9d, 0x00, 0x00, 0x01, 0xdb, 0x04, 0xdb, 0xa0, 0x9d, 0xdb, 0xff, 0x01, 0xdb, 0xa0, 0xb7, 0x04, 0x9e, 0x00, 0x00, 0x01, 0xb7, 0x04, 0xdb, 0xc8, 0x9b, 
+  0xdb, 0xff, 0x01, 0xdb, 0xc8, 0xdb, 0x04, 0xa0, 0x00, 0x00, 0x01, 0xdb, 0x23, 0xdb, 0xdb, 0x99, 0xdb, 0xff, 0x01, 0xdb, 0xdb, 0xb7, 0x23, 0xa2, 0x00, 0x00, 0x01, 0xdb, 0x2b, 0xdb, 0xd4, 0x97, 
+  0xdb, 0xff, 0x01, 0xdb, 0xd4, 0xdb, 0x2b, 0xa4, 0x00, 0x00, 0x01, 0xdb, 0x1b, 0xdb, 0xcb, 0x95, 0xdb, 0xff, 0x01, 0xdb, 0xcb, 0xb7, 0x1b, 0xa6, 0x00, 0x00, 0x01, 0xdb, 0x08, 0xdb, 0x7b, 0x93, 
+  0xdb, 0xff, 0x01, 0xb7, 0x7b, 0xdb, 0x08, 0xa9, 0x00, 0x00, 0x02, 0xdb, 0x2f, 0xdb, 0xab, 0xdb, 0xf0, 0x8d, 0xdb, 0xff, 0x02, 0xdb, 0xf0, 0xb7, 0xab, 0xdb, 0x2f, 0xac, 0x00, 0x00, 0x03, 0xb7, 
+  0x03, 0xdb, 0x1b, 0xdb, 0x7f, 0xdb, 0xd0, 0x89, 0xdb, 0xff, 0x03, 0xdb, 0xd0, 0xdb, 0x7f, 0xdb, 0x1b, 0xb7, 0x03, 0xb1, 0x00, 0x00, 0x03, 0xdb, 0x24, 0xdb, 0x5f, 0xdb, 0x8c, 0xdb, 0xb0, 0x81, 
+  0xdb, 0xc7, 0x03, 0xdb, 0xb0, 0xdb, 0x8c, 0xb7, 0x5f, 0xb7, 0x24, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd8, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x08, 0xd7, 0xbd, 0x17, 0xf7, 0xbd, 0x23, 0xf7, 0xbd, 0x2c, 0xd7, 0xbd, 0x33, 0xd7, 0xbd, 0x33, 0xd7, 0xbd, 0x2c, 0xd7, 0xbd, 0x23, 0xd7, 0xbd, 0x17, 0xd7, 0xbd, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x38, 0xf8, 0xc5, 0x8b, 0xf7, 0xbd, 0xdc, 0xf7, 0xbd, 0xe8, 0xf8, 0xc5, 0xf4, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xf4, 0xd7, 0xbd, 0xe8, 0xd7, 0xbd, 0xdc, 0xd7, 0xbd, 0x8b, 0xb7, 0xbd, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x0b, 0xf8, 0xc5, 0x47, 0xf8, 0xc5, 0xbf, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xbf, 0xb6, 0xb5, 0x47, 0xd7, 0xbd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x3b, 0x18, 0xc6, 0xcf, 0x18, 0xc6, 0xf8, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xf8, 0xb7, 0xbd, 0xcf, 0xb6, 0xb5, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x04, 0xf8, 0xc5, 0x73, 0x18, 0xc6, 0xf7, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xf7, 0xb6, 0xb5, 0x73, 0xd7, 0xbd, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x08, 0x18, 0xc6, 0x9b, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x9b, 0x96, 0xb5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x0c, 0x18, 0xc6, 0xa3, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xa3, 0x96, 0xb5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x8f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x67, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x18, 0x18, 0xc6, 0xe7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xe7, 0x96, 0xb5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x9f, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x33, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x76, 0xb5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x9f, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x14, 0x18, 0xc6, 0xe7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xe7, 0x96, 0xb5, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x33, 0x18, 0xc6, 0xfb, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xfb, 0x96, 0xb5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x7f, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xb4, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xe0, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xeb, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0xc4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x90, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x53, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x1b, 0xf8, 0xc5, 0xec, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xec, 0x96, 0xb5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x07, 0xf8, 0xc5, 0xcb, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xcb, 0x96, 0xb5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x54, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xc4, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x38, 0xf7, 0xbd, 0xf8, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xf8, 0x96, 0xb5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0x04, 0xd7, 0xbd, 0xa0, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xa0, 0x76, 0xb5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x04, 0xd7, 0xbd, 0xc8, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xc8, 0x96, 0xb5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x23, 0xd7, 0xbd, 0xdb, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xdb, 0x76, 0xb5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x2b, 0xd7, 0xbd, 0xd4, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xd4, 0x96, 0xb5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x1b, 0xd7, 0xbd, 0xcb, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xcb, 0x96, 0xb5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x08, 0xd7, 0xbd, 0x7b, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x7b, 0x96, 0xb5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x2f, 0xd7, 0xbd, 0xab, 0xd7, 0xbd, 0xf0, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xf0, 0x96, 0xb5, 0xab, 0x96, 0xb5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0xb7, 0xbd, 0x1b, 0xb7, 0xbd, 0x7f, 0xb7, 0xbd, 0xd0, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xd0, 0x96, 0xb5, 0x7f, 0x96, 0xb5, 0x1b, 0x75, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0x24, 0xb6, 0xb5, 0x5f, 0xb7, 0xbd, 0x8c, 0xb6, 0xb5, 0xb0, 0xb6, 0xb5, 0xc7, 0xb6, 0xb5, 0xc7, 0xb6, 0xb5, 0xb0, 0xb6, 0xb5, 0x8c, 0x96, 0xb5, 0x5f, 0x76, 0xb5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 
+  0x03, 0xd7, 0xbd, 0x08, 0xd7, 0xbd, 0x17, 0xf7, 0xbd, 0x23, 0xf7, 0xbd, 0x2c, 0x81, 0xd7, 0xbd, 0x33, 0x03, 0xd7, 0xbd, 0x2c, 0xd7, 0xbd, 0x23, 0xd7, 0xbd, 0x17, 0xd7, 0xbd, 0x08, 0xb3, 0x00, 
+  0x00, 0x00, 0x04, 0xf7, 0xbd, 0x38, 0xf8, 0xc5, 0x8b, 0xf7, 0xbd, 0xdc, 0xf7, 0xbd, 0xe8, 0xf8, 0xc5, 0xf4, 0x82, 0xf7, 0xbd, 0xff, 0x05, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xf4, 0xd7, 0xbd, 0xe8, 
+  0xd7, 0xbd, 0xdc, 0xd7, 0xbd, 0x8b, 0xb7, 0xbd, 0x38, 0xae, 0x00, 0x00, 0x00, 0x02, 0xf8, 0xc5, 0x0b, 0xf8, 0xc5, 0x47, 0xf8, 0xc5, 0xbf, 0x81, 0xf8, 0xc5, 0xff, 0x01, 0x18, 0xc6, 0xff, 0xf8, 
+  0xc5, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x82, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x82, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xbf, 0xb6, 0xb5, 0x47, 0xd7, 0xbd, 0x0b, 0xaa, 0x00, 0x00, 0x00, 
+  0x02, 0x18, 0xc6, 0x3b, 0x18, 0xc6, 0xcf, 0x18, 0xc6, 0xf8, 0x8a, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x82, 0xf7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xf8, 0xb7, 0xbd, 0xcf, 
+  0xb6, 0xb5, 0x3b, 0xa7, 0x00, 0x00, 0x00, 0x02, 0x38, 0xc6, 0x04, 0xf8, 0xc5, 0x73, 0x18, 0xc6, 0xf7, 0x82, 0x18, 0xc6, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x83, 0x38, 0xc6, 
+  0xff, 0x83, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xf7, 0xb6, 0xb5, 0x73, 0xd7, 0xbd, 0x04, 0xa4, 0x00, 0x00, 0x00, 0x01, 
+  0x59, 0xce, 0x08, 0x18, 0xc6, 0x9b, 0x81, 0x18, 0xc6, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x83, 0x39, 0xce, 0xff, 0x83, 0x59, 0xce, 0xff, 0x82, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x82, 0x18, 
+  0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x9b, 0x96, 0xb5, 0x08, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x0c, 
+  0x18, 0xc6, 0xa3, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x8b, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x81, 0xf7, 0xbd, 0xff, 
+  0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xa3, 0x96, 0xb5, 0x0c, 0xa1, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x8f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 
+  0x59, 0xce, 0xff, 0x88, 0x79, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x81, 0xb7, 
+  0xbd, 0xff, 0x00, 0xb6, 0xb5, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x67, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 
+  0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x83, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x00, 0x18, 0xc6, 0xff, 0x81, 
+  0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x67, 0x9e, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xbd, 0x18, 0x18, 0xc6, 0xe7, 0x38, 0xc6, 0xff, 0x39, 
+  0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x00, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x85, 0x9a, 0xd6, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x81, 0x79, 
+  0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 
+  0xb6, 0xb5, 0xe7, 0x96, 0xb5, 0x18, 0x9d, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x9f, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 
+  0x18, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x01, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x82, 0xba, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 
+  0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x02, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0x81, 0xb7, 0xbd, 0xff, 0x00, 0x96, 0xb5, 0x9f, 0x9c, 0x00, 
+  0x00, 0x00, 0x04, 0xf8, 0xc5, 0x33, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0x84, 0x59, 0xce, 
+  0xff, 0x00, 0xba, 0xd6, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x04, 0x39, 0xce, 0xff, 
+  0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x76, 0xb5, 0x33, 0x9b, 0x00, 0x00, 0x00, 0x03, 0x18, 
+  0xc6, 0x9f, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x02, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 
+  0xff, 0x02, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 
+  0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x05, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x9f, 
+  0x9a, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0x14, 0x18, 0xc6, 0xe7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x02, 0x39, 
+  0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x01, 0x59, 0xce, 0xff, 0xbb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x82, 0x9a, 
+  0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x04, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 
+  0xff, 0x02, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xe7, 0x96, 0xb5, 0x14, 0x99, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x33, 0x18, 0xc6, 0xfb, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x79, 0xce, 
+  0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x03, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x84, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xde, 
+  0xff, 0xba, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x02, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 
+  0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xfb, 0x96, 0xb5, 0x33, 0x99, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x7f, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 
+  0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x03, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x83, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x01, 
+  0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x05, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 
+  0xff, 0x04, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x7f, 0x99, 0x00, 0x00, 0x00, 0x05, 0x18, 0xc6, 0xb4, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 
+  0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x86, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xde, 0xff, 
+  0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x05, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 
+  0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xb4, 0x99, 0x00, 0x00, 0x00, 0x05, 0x18, 0xc6, 0xe0, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 
+  0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x86, 0xfb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x81, 
+  0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 
+  0xff, 0x01, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xe0, 0x99, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 
+  0xd6, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x85, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x03, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 
+  0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 
+  0xff, 0x99, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x83, 0xdb, 
+  0xde, 0xff, 0x84, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x03, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x83, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 
+  0x18, 0xc6, 0xff, 0x05, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x99, 0x00, 0x00, 0x00, 0x81, 0x18, 0xc6, 0xff, 0x00, 0x39, 
+  0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x84, 0xdb, 0xde, 0xff, 0x00, 0xfb, 0xde, 0xff, 0x83, 0xdb, 0xde, 
+  0xff, 0x00, 0xbb, 0xde, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 
+  0x05, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x99, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0xeb, 0x18, 0xc6, 0xff, 0x38, 0xc6, 
+  0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x87, 0xdb, 0xde, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x83, 0x9a, 0xd6, 0xff, 
+  0x04, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x05, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 
+  0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xeb, 0x99, 0x00, 0x00, 0x00, 0x06, 0xf8, 0xc5, 0xc4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 
+  0xff, 0x82, 0x9a, 0xd6, 0xff, 0x01, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x85, 0xdb, 0xde, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 
+  0x06, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 
+  0xff, 0x96, 0xb5, 0xc4, 0x99, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x90, 0x81, 0x18, 0xc6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x82, 0x9a, 0xd6, 0xff, 
+  0x81, 0xba, 0xd6, 0xff, 0x86, 0xbb, 0xde, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x02, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x81, 0xf8, 
+  0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x81, 0xb6, 0xb5, 0xff, 0x00, 0x96, 0xb5, 0x90, 0x99, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x53, 0x81, 0x18, 0xc6, 0xff, 0x01, 0x38, 
+  0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x82, 0xba, 0xd6, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x81, 0xba, 0xd6, 0xff, 
+  0x02, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x00, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x09, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 
+  0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x53, 0x99, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xbd, 
+  0x1b, 0xf8, 0xc5, 0xec, 0x81, 0x18, 0xc6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 
+  0x00, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x05, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 
+  0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x03, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xec, 0x96, 0xb5, 0x1b, 0x99, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xbd, 0x07, 0xf8, 0xc5, 0xcb, 0xf8, 
+  0xc5, 0xff, 0x18, 0xc6, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x82, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x86, 0x9a, 0xd6, 0xff, 0x83, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 
+  0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x02, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x03, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 
+  0xff, 0x96, 0xb5, 0xcb, 0x96, 0xb5, 0x07, 0x9a, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xbd, 0x54, 0xf8, 0xc5, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 
+  0xff, 0x81, 0x79, 0xce, 0xff, 0x82, 0x7a, 0xd6, 0xff, 0x00, 0x9a, 0xd6, 0xff, 0x82, 0x7a, 0xd6, 0xff, 0x84, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 
+  0xff, 0x83, 0xd7, 0xbd, 0xff, 0x03, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x54, 0x9c, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xbd, 0xc4, 0xf8, 0xc5, 0xff, 0x82, 0x18, 0xc6, 
+  0xff, 0x01, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x86, 0x79, 0xce, 0xff, 0x01, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 
+  0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x83, 0xd7, 0xbd, 0xff, 0x81, 0xb6, 0xb5, 0xff, 0x00, 0x96, 0xb5, 0xc4, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xbd, 
+  0x38, 0xf7, 0xbd, 0xf8, 0xf8, 0xc5, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x82, 0x39, 0xce, 0xff, 0x88, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x82, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 
+  0xf8, 0xc5, 0xff, 0x84, 0xd7, 0xbd, 0xff, 0x03, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xf8, 0x96, 0xb5, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xb6, 0xb5, 0x04, 0xd7, 0xbd, 0xa0, 0xf7, 
+  0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x83, 0x18, 0xc6, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x59, 0xce, 0xff, 0x83, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 
+  0xff, 0x81, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x84, 0xd7, 0xbd, 0xff, 0x04, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xa0, 0x76, 0xb5, 
+  0x04, 0x9e, 0x00, 0x00, 0x00, 0x02, 0x96, 0xb5, 0x04, 0xd7, 0xbd, 0xc8, 0xf7, 0xbd, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x02, 0x39, 0xce, 0xff, 0x38, 
+  0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x82, 0xd7, 0xbd, 0xff, 0x04, 0xb7, 0xbd, 
+  0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0xc8, 0x96, 0xb5, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xd7, 0xbd, 0x23, 0xd7, 0xbd, 0xdb, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 
+  0xff, 0x85, 0x18, 0xc6, 0xff, 0x01, 0xf7, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 
+  0x82, 0xd7, 0xbd, 0xff, 0x00, 0xb7, 0xbd, 0xff, 0x81, 0xb6, 0xb5, 0xff, 0x01, 0x96, 0xb5, 0xdb, 0x76, 0xb5, 0x23, 0xa2, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xbd, 0x2b, 0xd7, 0xbd, 0xd4, 0xd7, 0xbd, 
+  0xff, 0x81, 0xf7, 0xbd, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x00, 0x18, 0xc6, 0xff, 0x83, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 
+  0xff, 0x83, 0xd7, 0xbd, 0xff, 0x00, 0xb7, 0xbd, 0xff, 0x81, 0xb6, 0xb5, 0xff, 0x01, 0x96, 0xb5, 0xd4, 0x96, 0xb5, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x01, 0xb7, 0xbd, 0x1b, 0xd7, 0xbd, 0xcb, 0x81, 
+  0xd7, 0xbd, 0xff, 0x83, 0xf7, 0xbd, 0xff, 0x86, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x83, 0xd7, 0xbd, 0xff, 0x81, 0xb7, 0xbd, 0xff, 0x81, 0xb6, 0xb5, 0xff, 0x01, 0x96, 0xb5, 0xcb, 0x96, 
+  0xb5, 0x1b, 0xa6, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xbd, 0x08, 0xd7, 0xbd, 0x7b, 0x85, 0xd7, 0xbd, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x82, 0xd7, 0xbd, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x84, 0xd7, 0xbd, 
+  0xff, 0x81, 0xb7, 0xbd, 0xff, 0x03, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x7b, 0x96, 0xb5, 0x08, 0xa9, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xbd, 0x2f, 0xd7, 0xbd, 0xab, 0xd7, 0xbd, 0xf0, 
+  0x89, 0xd7, 0xbd, 0xff, 0x82, 0xb7, 0xbd, 0xff, 0x03, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xf0, 0x96, 0xb5, 0xab, 0x96, 0xb5, 0x2f, 0xac, 0x00, 0x00, 0x00, 0x03, 0x55, 0xad, 0x03, 0xb7, 0xbd, 0x1b, 
+  0xb7, 0xbd, 0x7f, 0xb7, 0xbd, 0xd0, 0x86, 0xb7, 0xbd, 0xff, 0x82, 0xb6, 0xb5, 0xff, 0x03, 0x96, 0xb5, 0xd0, 0x96, 0xb5, 0x7f, 0x96, 0xb5, 0x1b, 0x75, 0xad, 0x03, 0xb1, 0x00, 0x00, 0x00, 0x03, 
+  0xb6, 0xb5, 0x24, 0xb6, 0xb5, 0x5f, 0xb7, 0xbd, 0x8c, 0xb6, 0xb5, 0xb0, 0x81, 0xb6, 0xb5, 0xc7, 0x03, 0xb6, 0xb5, 0xb0, 0xb6, 0xb5, 0x8c, 0x96, 0xb5, 0x5f, 0x76, 0xb5, 0x24, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x08, 0xbd, 0xd7, 0x17, 0xbd, 0xf7, 0x23, 0xbd, 0xf7, 0x2c, 0xbd, 0xd7, 0x33, 0xbd, 0xd7, 0x33, 0xbd, 0xd7, 0x2c, 0xbd, 0xd7, 0x23, 0xbd, 0xd7, 0x17, 0xbd, 0xd7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x38, 0xc5, 0xf8, 0x8b, 0xbd, 0xf7, 0xdc, 0xbd, 0xf7, 0xe8, 0xc5, 0xf8, 0xf4, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xf4, 0xbd, 0xd7, 0xe8, 0xbd, 0xd7, 0xdc, 0xbd, 0xd7, 0x8b, 0xbd, 0xb7, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x0b, 0xc5, 0xf8, 0x47, 0xc5, 0xf8, 0xbf, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xbf, 0xb5, 0xb6, 0x47, 0xbd, 0xd7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x3b, 0xc6, 0x18, 0xcf, 0xc6, 0x18, 0xf8, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xf8, 0xbd, 0xb7, 0xcf, 0xb5, 0xb6, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x38, 0x04, 0xc5, 0xf8, 0x73, 0xc6, 0x18, 0xf7, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xf7, 0xb5, 0xb6, 0x73, 0xbd, 0xd7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x59, 0x08, 0xc6, 0x18, 0x9b, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x9b, 0xb5, 0x96, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x0c, 0xc6, 0x18, 0xa3, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xa3, 0xb5, 0x96, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x8f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x67, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x18, 0xc6, 0x18, 0xe7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xe7, 0xb5, 0x96, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x9f, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x33, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x76, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x9f, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x14, 0xc6, 0x18, 0xe7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xe7, 0xb5, 0x96, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x33, 0xc6, 0x18, 0xfb, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xfb, 0xb5, 0x96, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x7f, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xb4, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xe0, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xeb, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0xc4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x90, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x53, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x1b, 0xc5, 0xf8, 0xec, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xec, 0xb5, 0x96, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x07, 0xc5, 0xf8, 0xcb, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xcb, 0xb5, 0x96, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x54, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0xc4, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x38, 0xbd, 0xf7, 0xf8, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xf8, 0xb5, 0x96, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb6, 0x04, 0xbd, 0xd7, 0xa0, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xa0, 0xb5, 0x76, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x04, 0xbd, 0xd7, 0xc8, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xc8, 0xb5, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x23, 0xbd, 0xd7, 0xdb, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xdb, 0xb5, 0x76, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x2b, 0xbd, 0xd7, 0xd4, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xd4, 0xb5, 0x96, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x1b, 0xbd, 0xd7, 0xcb, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xcb, 0xb5, 0x96, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x08, 0xbd, 0xd7, 0x7b, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x7b, 0xb5, 0x96, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x2f, 0xbd, 0xd7, 0xab, 0xbd, 0xd7, 0xf0, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xf0, 0xb5, 0x96, 0xab, 0xb5, 0x96, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0xbd, 0xb7, 0x1b, 0xbd, 0xb7, 0x7f, 0xbd, 0xb7, 0xd0, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xd0, 0xb5, 0x96, 0x7f, 0xb5, 0x96, 0x1b, 0xad, 0x75, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb6, 0x24, 0xb5, 0xb6, 0x5f, 0xbd, 0xb7, 0x8c, 0xb5, 0xb6, 0xb0, 0xb5, 0xb6, 0xc7, 0xb5, 0xb6, 0xc7, 0xb5, 0xb6, 0xb0, 0xb5, 0xb6, 0x8c, 0xb5, 0x96, 0x5f, 0xb5, 0x76, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 
+  0x03, 0xbd, 0xd7, 0x08, 0xbd, 0xd7, 0x17, 0xbd, 0xf7, 0x23, 0xbd, 0xf7, 0x2c, 0x81, 0xbd, 0xd7, 0x33, 0x03, 0xbd, 0xd7, 0x2c, 0xbd, 0xd7, 0x23, 0xbd, 0xd7, 0x17, 0xbd, 0xd7, 0x08, 0xb3, 0x00, 
+  0x00, 0x00, 0x04, 0xbd, 0xf7, 0x38, 0xc5, 0xf8, 0x8b, 0xbd, 0xf7, 0xdc, 0xbd, 0xf7, 0xe8, 0xc5, 0xf8, 0xf4, 0x82, 0xbd, 0xf7, 0xff, 0x05, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xf4, 0xbd, 0xd7, 0xe8, 
+  0xbd, 0xd7, 0xdc, 0xbd, 0xd7, 0x8b, 0xbd, 0xb7, 0x38, 0xae, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xf8, 0x0b, 0xc5, 0xf8, 0x47, 0xc5, 0xf8, 0xbf, 0x81, 0xc5, 0xf8, 0xff, 0x01, 0xc6, 0x18, 0xff, 0xc5, 
+  0xf8, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x82, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x82, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xbf, 0xb5, 0xb6, 0x47, 0xbd, 0xd7, 0x0b, 0xaa, 0x00, 0x00, 0x00, 
+  0x02, 0xc6, 0x18, 0x3b, 0xc6, 0x18, 0xcf, 0xc6, 0x18, 0xf8, 0x8a, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x82, 0xbd, 0xf7, 0xff, 0x03, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xf8, 0xbd, 0xb7, 0xcf, 
+  0xb5, 0xb6, 0x3b, 0xa7, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x38, 0x04, 0xc5, 0xf8, 0x73, 0xc6, 0x18, 0xf7, 0x82, 0xc6, 0x18, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x39, 0xff, 0x83, 0xc6, 0x38, 
+  0xff, 0x83, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xf7, 0xb5, 0xb6, 0x73, 0xbd, 0xd7, 0x04, 0xa4, 0x00, 0x00, 0x00, 0x01, 
+  0xce, 0x59, 0x08, 0xc6, 0x18, 0x9b, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x83, 0xce, 0x39, 0xff, 0x83, 0xce, 0x59, 0xff, 0x82, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x82, 0xc6, 
+  0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x9b, 0xb5, 0x96, 0x08, 0xa2, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x0c, 
+  0xc6, 0x18, 0xa3, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x39, 0xff, 0x8b, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x81, 0xbd, 0xf7, 0xff, 
+  0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xa3, 0xb5, 0x96, 0x0c, 0xa1, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x8f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 
+  0xce, 0x59, 0xff, 0x88, 0xce, 0x79, 0xff, 0x82, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x81, 0xbd, 
+  0xb7, 0xff, 0x00, 0xb5, 0xb6, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x67, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 
+  0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x83, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x00, 0xc6, 0x18, 0xff, 0x81, 
+  0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x67, 0x9e, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xf7, 0x18, 0xc6, 0x18, 0xe7, 0xc6, 0x38, 0xff, 0xce, 
+  0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x00, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xce, 0x79, 0xff, 0x85, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x81, 0xce, 
+  0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 
+  0xb5, 0xb6, 0xe7, 0xb5, 0x96, 0x18, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x9f, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x01, 0xce, 0x39, 0xff, 
+  0xc6, 0x18, 0xff, 0x81, 0xce, 0x39, 0xff, 0x01, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0x82, 0xd6, 0xba, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 
+  0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x02, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0x81, 0xbd, 0xb7, 0xff, 0x00, 0xb5, 0x96, 0x9f, 0x9c, 0x00, 
+  0x00, 0x00, 0x04, 0xc5, 0xf8, 0x33, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xc6, 0x38, 0xff, 0x84, 0xce, 0x59, 
+  0xff, 0x00, 0xd6, 0xba, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x04, 0xce, 0x39, 0xff, 
+  0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x76, 0x33, 0x9b, 0x00, 0x00, 0x00, 0x03, 0xc6, 
+  0x18, 0x9f, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x02, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 
+  0xff, 0x02, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 
+  0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x05, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x9f, 
+  0x9a, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0x14, 0xc6, 0x18, 0xe7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x02, 0xce, 
+  0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x01, 0xce, 0x59, 0xff, 0xde, 0xbb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x01, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0x82, 0xd6, 
+  0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x04, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 
+  0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xe7, 0xb5, 0x96, 0x14, 0x99, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x33, 0xc6, 0x18, 0xfb, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x79, 
+  0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x81, 0xce, 0x59, 0xff, 0x03, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x84, 0xde, 0xdb, 0xff, 0x01, 0xde, 0xbb, 
+  0xff, 0xd6, 0xba, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x02, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 
+  0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xfb, 0xb5, 0x96, 0x33, 0x99, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x7f, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 
+  0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x03, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0x83, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x01, 
+  0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x05, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 
+  0xff, 0x04, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x7f, 0x99, 0x00, 0x00, 0x00, 0x05, 0xc6, 0x18, 0xb4, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 
+  0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x86, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x01, 0xde, 0xbb, 0xff, 
+  0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x05, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 
+  0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xb4, 0x99, 0x00, 0x00, 0x00, 0x05, 0xc6, 0x18, 0xe0, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 
+  0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x86, 0xde, 0xfb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x01, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0x81, 
+  0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 
+  0xff, 0x01, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xe0, 0x99, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 
+  0x9a, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x85, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x03, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 
+  0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x01, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 
+  0xff, 0x99, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x83, 0xde, 
+  0xdb, 0xff, 0x84, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x03, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x83, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 
+  0xc6, 0x18, 0xff, 0x05, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0x99, 0x00, 0x00, 0x00, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xce, 
+  0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x84, 0xde, 0xdb, 0xff, 0x00, 0xde, 0xfb, 0xff, 0x83, 0xde, 0xdb, 
+  0xff, 0x00, 0xde, 0xbb, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 
+  0x05, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0x99, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0xeb, 0xc6, 0x18, 0xff, 0xc6, 0x38, 
+  0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x87, 0xde, 0xdb, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x83, 0xd6, 0x9a, 0xff, 
+  0x04, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x05, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 
+  0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xeb, 0x99, 0x00, 0x00, 0x00, 0x06, 0xc5, 0xf8, 0xc4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 
+  0xff, 0x82, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x85, 0xde, 0xdb, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 
+  0x06, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 
+  0xff, 0xb5, 0x96, 0xc4, 0x99, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x90, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x9a, 0xff, 
+  0x81, 0xd6, 0xba, 0xff, 0x86, 0xde, 0xbb, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x02, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0x81, 0xc5, 
+  0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x81, 0xb5, 0xb6, 0xff, 0x00, 0xb5, 0x96, 0x90, 0x99, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x53, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc6, 
+  0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x82, 0xd6, 0xba, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x81, 0xd6, 0xba, 0xff, 
+  0x02, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x00, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x09, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 
+  0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x53, 0x99, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xf7, 
+  0x1b, 0xc5, 0xf8, 0xec, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x83, 0xd6, 0x9a, 0xff, 
+  0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x05, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 
+  0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x03, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xec, 0xb5, 0x96, 0x1b, 0x99, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xf7, 0x07, 0xc5, 0xf8, 0xcb, 0xc5, 
+  0xf8, 0xff, 0xc6, 0x18, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x82, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x86, 0xd6, 0x9a, 0xff, 0x83, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 
+  0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x02, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x03, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 
+  0xff, 0xb5, 0x96, 0xcb, 0xb5, 0x96, 0x07, 0x9a, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xd7, 0x54, 0xc5, 0xf8, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 
+  0xff, 0x81, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x7a, 0xff, 0x00, 0xd6, 0x9a, 0xff, 0x82, 0xd6, 0x7a, 0xff, 0x84, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 
+  0xff, 0x83, 0xbd, 0xd7, 0xff, 0x03, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x54, 0x9c, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xf7, 0xc4, 0xc5, 0xf8, 0xff, 0x82, 0xc6, 0x18, 
+  0xff, 0x01, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x86, 0xce, 0x79, 0xff, 0x01, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 
+  0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x83, 0xbd, 0xd7, 0xff, 0x81, 0xb5, 0xb6, 0xff, 0x00, 0xb5, 0x96, 0xc4, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xd7, 
+  0x38, 0xbd, 0xf7, 0xf8, 0xc5, 0xf8, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x82, 0xce, 0x39, 0xff, 0x88, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x82, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 
+  0xc5, 0xf8, 0xff, 0x84, 0xbd, 0xd7, 0xff, 0x03, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xf8, 0xb5, 0x96, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xb5, 0xb6, 0x04, 0xbd, 0xd7, 0xa0, 0xbd, 
+  0xf7, 0xff, 0xc5, 0xf8, 0xff, 0x83, 0xc6, 0x18, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xce, 0x59, 0xff, 0x83, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 
+  0xff, 0x81, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x84, 0xbd, 0xd7, 0xff, 0x04, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xa0, 0xb5, 0x76, 
+  0x04, 0x9e, 0x00, 0x00, 0x00, 0x02, 0xb5, 0x96, 0x04, 0xbd, 0xd7, 0xc8, 0xbd, 0xf7, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x02, 0xce, 0x39, 0xff, 0xc6, 
+  0x38, 0xff, 0xc5, 0xf8, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x82, 0xbd, 0xd7, 0xff, 0x04, 0xbd, 0xb7, 
+  0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0xc8, 0xb5, 0x96, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xbd, 0xd7, 0x23, 0xbd, 0xd7, 0xdb, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 
+  0xff, 0x85, 0xc6, 0x18, 0xff, 0x01, 0xbd, 0xf7, 0xff, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 
+  0x82, 0xbd, 0xd7, 0xff, 0x00, 0xbd, 0xb7, 0xff, 0x81, 0xb5, 0xb6, 0xff, 0x01, 0xb5, 0x96, 0xdb, 0xb5, 0x76, 0x23, 0xa2, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xd7, 0x2b, 0xbd, 0xd7, 0xd4, 0xbd, 0xd7, 
+  0xff, 0x81, 0xbd, 0xf7, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x00, 0xc6, 0x18, 0xff, 0x83, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 
+  0xff, 0x83, 0xbd, 0xd7, 0xff, 0x00, 0xbd, 0xb7, 0xff, 0x81, 0xb5, 0xb6, 0xff, 0x01, 0xb5, 0x96, 0xd4, 0xb5, 0x96, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xb7, 0x1b, 0xbd, 0xd7, 0xcb, 0x81, 
+  0xbd, 0xd7, 0xff, 0x83, 0xbd, 0xf7, 0xff, 0x86, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x83, 0xbd, 0xd7, 0xff, 0x81, 0xbd, 0xb7, 0xff, 0x81, 0xb5, 0xb6, 0xff, 0x01, 0xb5, 0x96, 0xcb, 0xb5, 
+  0x96, 0x1b, 0xa6, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xd7, 0x08, 0xbd, 0xd7, 0x7b, 0x85, 0xbd, 0xd7, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x82, 0xbd, 0xd7, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x84, 0xbd, 0xd7, 
+  0xff, 0x81, 0xbd, 0xb7, 0xff, 0x03, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x7b, 0xb5, 0x96, 0x08, 0xa9, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xb7, 0x2f, 0xbd, 0xd7, 0xab, 0xbd, 0xd7, 0xf0, 
+  0x89, 0xbd, 0xd7, 0xff, 0x82, 0xbd, 0xb7, 0xff, 0x03, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xf0, 0xb5, 0x96, 0xab, 0xb5, 0x96, 0x2f, 0xac, 0x00, 0x00, 0x00, 0x03, 0xad, 0x55, 0x03, 0xbd, 0xb7, 0x1b, 
+  0xbd, 0xb7, 0x7f, 0xbd, 0xb7, 0xd0, 0x86, 0xbd, 0xb7, 0xff, 0x82, 0xb5, 0xb6, 0xff, 0x03, 0xb5, 0x96, 0xd0, 0xb5, 0x96, 0x7f, 0xb5, 0x96, 0x1b, 0xad, 0x75, 0x03, 0xb1, 0x00, 0x00, 0x00, 0x03, 
+  0xb5, 0xb6, 0x24, 0xb5, 0xb6, 0x5f, 0xbd, 0xb7, 0x8c, 0xb5, 0xb6, 0xb0, 0x81, 0xb5, 0xb6, 0xc7, 0x03, 0xb5, 0xb6, 0xb0, 0xb5, 0xb6, 0x8c, 0xb5, 0x96, 0x5f, 0xb5, 0x76, 0x24, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8, 0x08, 0xb8, 0xb8, 0xb8, 0x17, 0xbb, 0xbb, 0xbb, 0x23, 0xbb, 0xbb, 0xbb, 0x2c, 0xba, 0xba, 0xba, 0x33, 0xb9, 0xb9, 0xb9, 0x33, 0xb9, 0xb9, 0xb9, 0x2c, 0xb8, 0xb8, 0xb8, 0x23, 0xb7, 0xb7, 0xb7, 0x17, 0xba, 0xba, 0xba, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x38, 0xbd, 0xbd, 0xbd, 0x8b, 0xbc, 0xbc, 0xbc, 0xdc, 0xbc, 0xbc, 0xbc, 0xe8, 0xbd, 0xbd, 0xbd, 0xf4, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xf4, 0xb9, 0xb9, 0xb9, 0xe8, 0xb7, 0xb7, 0xb7, 0xdc, 0xb7, 0xb7, 0xb7, 0x8b, 0xb5, 0xb5, 0xb5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x0b, 0xbd, 0xbd, 0xbd, 0x47, 0xbd, 0xbd, 0xbd, 0xbf, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xbf, 0xb4, 0xb4, 0xb4, 0x47, 0xb7, 0xb7, 0xb7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x3b, 0xbf, 0xbf, 0xbf, 0xcf, 0xbf, 0xbf, 0xbf, 0xf8, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xf8, 0xb6, 0xb6, 0xb6, 0xcf, 0xb3, 0xb3, 0xb3, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0xc3, 0x04, 0xbd, 0xbd, 0xbd, 0x73, 0xbf, 0xbf, 0xbf, 0xf7, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xf7, 0xb3, 0xb3, 0xb3, 0x73, 0xb8, 0xb8, 0xb8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xc7, 0x08, 0xbf, 0xbf, 0xbf, 0x9b, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x9b, 0xb1, 0xb1, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x0c, 0xbf, 0xbf, 0xbf, 0xa3, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xa3, 0xb0, 0xb0, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x8f, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x67, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x18, 0xc1, 0xc1, 0xc1, 0xe7, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xe7, 0xb0, 0xb0, 0xb0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x9f, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xca, 0xca, 0xca, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x33, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xae, 0xae, 0xae, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x9f, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x14, 0xc1, 0xc1, 0xc1, 0xe7, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xe7, 0xb0, 0xb0, 0xb0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x33, 0xc2, 0xc2, 0xc2, 0xfb, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xfb, 0xb1, 0xb1, 0xb1, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x7f, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xb4, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xe0, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xeb, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0xc4, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb0, 0xb0, 0xb0, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x90, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x53, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x1b, 0xbe, 0xbe, 0xbe, 0xec, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xec, 0xb1, 0xb1, 0xb1, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x07, 0xbd, 0xbd, 0xbd, 0xcb, 0xbe, 0xbe, 0xbe, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xcb, 0xb1, 0xb1, 0xb1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x54, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0xc4, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb0, 0xb0, 0xb0, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8, 0x38, 0xbc, 0xbc, 0xbc, 0xf8, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xf8, 0xb0, 0xb0, 0xb0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x04, 0xba, 0xba, 0xba, 0xa0, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xa0, 0xad, 0xad, 0xad, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xaf, 0xaf, 0x04, 0xba, 0xba, 0xba, 0xc8, 0xbb, 0xbb, 0xbb, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xc8, 0xb1, 0xb1, 0xb1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb7, 0xb7, 0x23, 0xb9, 0xb9, 0xb9, 0xdb, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xdb, 0xae, 0xae, 0xae, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x2b, 0xb9, 0xb9, 0xb9, 0xd4, 0xb9, 0xb9, 0xb9, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0xd4, 0xb2, 0xb2, 0xb2, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x1b, 0xb7, 0xb7, 0xb7, 0xcb, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0xcb, 0xaf, 0xaf, 0xaf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x08, 0xb7, 0xb7, 0xb7, 0x7b, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x7b, 0xb2, 0xb2, 0xb2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x2f, 0xb7, 0xb7, 0xb7, 0xab, 0xb7, 0xb7, 0xb7, 0xf0, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xf0, 0xb0, 0xb0, 0xb0, 0xab, 0xb1, 0xb1, 0xb1, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0x03, 0xb6, 0xb6, 0xb6, 0x1b, 0xb5, 0xb5, 0xb5, 0x7f, 0xb5, 0xb5, 0xb5, 0xd0, 0xb5, 0xb5, 0xb5, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xd0, 0xb1, 0xb1, 0xb1, 0x7f, 0xb2, 0xb2, 0xb2, 0x1b, 0xac, 0xac, 0xac, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x24, 0xb3, 0xb3, 0xb3, 0x5f, 0xb5, 0xb5, 0xb5, 0x8c, 0xb4, 0xb4, 0xb4, 0xb0, 0xb4, 0xb4, 0xb4, 0xc7, 0xb3, 0xb3, 0xb3, 0xc7, 0xb3, 0xb3, 0xb3, 0xb0, 0xb3, 0xb3, 0xb3, 0x8c, 0xaf, 0xaf, 0xaf, 0x5f, 0xae, 0xae, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb8, 0xb8, 0xb8, 0x08, 0xb8, 0xb8, 0xb8, 0x17, 0xbb, 0xbb, 0xbb, 0x23, 0xbb, 0xbb, 0xbb, 0x2c, 0xba, 0xba, 0xba, 0x33, 0xb9, 0xb9, 0xb9, 0x33, 
+  0xb9, 0xb9, 0xb9, 0x2c, 0xb8, 0xb8, 0xb8, 0x23, 0xb7, 0xb7, 0xb7, 0x17, 0xba, 0xba, 0xba, 0x08, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbb, 0xbb, 0xbb, 0x38, 0xbd, 0xbd, 0xbd, 0x8b, 0xbc, 0xbc, 
+  0xbc, 0xdc, 0xbc, 0xbc, 0xbc, 0xe8, 0xbd, 0xbd, 0xbd, 0xf4, 0xbc, 0xbc, 0xbc, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x05, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xf4, 0xb9, 0xb9, 0xb9, 0xe8, 
+  0xb7, 0xb7, 0xb7, 0xdc, 0xb7, 0xb7, 0xb7, 0x8b, 0xb5, 0xb5, 0xb5, 0x38, 0xae, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xbd, 0xbd, 0x0b, 0xbd, 0xbd, 0xbd, 0x47, 0xbd, 0xbd, 0xbd, 0xbf, 0x81, 0xbe, 
+  0xbe, 0xbe, 0xff, 0x01, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0x81, 0xbf, 0xbf, 0xbf, 0xff, 0x00, 0xbe, 0xbe, 0xbe, 0xff, 0x81, 0xbd, 0xbd, 0xbd, 0xff, 0x07, 0xbc, 0xbc, 0xbc, 0xff, 
+  0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xbf, 0xb4, 0xb4, 0xb4, 0x47, 0xb7, 0xb7, 0xb7, 0x0b, 0xaa, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0xbf, 0xbf, 0xbf, 0x3b, 0xbf, 0xbf, 0xbf, 0xcf, 0xbf, 0xbf, 0xbf, 0xf8, 0xc0, 0xc0, 0xc0, 0xff, 0x82, 0xc1, 0xc1, 0xc1, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x82, 0xc1, 0xc1, 0xc1, 
+  0xff, 0x81, 0xbf, 0xbf, 0xbf, 0xff, 0x01, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x03, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xf8, 0xb6, 0xb6, 0xb6, 
+  0xcf, 0xb3, 0xb3, 0xb3, 0x3b, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc3, 0xc3, 0xc3, 0x04, 0xbd, 0xbd, 0xbd, 0x73, 0xbf, 0xbf, 0xbf, 0xf7, 0xc1, 0xc1, 0xc1, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 
+  0x01, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x01, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0x81, 0xc3, 0xc3, 0xc3, 0xff, 0x0b, 0xc2, 0xc2, 0xc2, 
+  0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 
+  0xff, 0xb5, 0xb5, 0xb5, 0xf7, 0xb3, 0xb3, 0xb3, 0x73, 0xb8, 0xb8, 0xb8, 0x04, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc7, 0xc7, 0xc7, 0x08, 0xbf, 0xbf, 0xbf, 0x9b, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 
+  0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x00, 0xc8, 0xc8, 0xc8, 0xff, 0x82, 0xc7, 0xc7, 0xc7, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 
+  0x0c, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 
+  0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x9b, 0xb1, 0xb1, 0xb1, 0x08, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc1, 0xc1, 0xc1, 0x0c, 0xbf, 
+  0xbf, 0xbf, 0xa3, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x01, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x00, 0xca, 
+  0xca, 0xca, 0xff, 0x83, 0xc9, 0xc9, 0xc9, 0xff, 0x00, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x0b, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 
+  0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xa3, 0xb0, 
+  0xb0, 0xb0, 0x0c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 0x8f, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 
+  0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x82, 0xcb, 0xcb, 0xcb, 0xff, 0x84, 0xcc, 0xcc, 0xcc, 0xff, 0x0b, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 
+  0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 
+  0x81, 0xb6, 0xb6, 0xb6, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 0x67, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 
+  0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xce, 0xce, 0xce, 0xff, 0x81, 0xcf, 0xcf, 0xcf, 0xff, 0x82, 0xce, 0xce, 0xce, 0xff, 
+  0x0f, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 
+  0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 
+  0x67, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbb, 0xbb, 0xbb, 0x18, 0xc1, 0xc1, 0xc1, 0xe7, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 
+  0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x02, 0xcb, 0xcb, 0xcb, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0x81, 0xd1, 0xd1, 
+  0xd1, 0xff, 0x11, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 
+  0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 
+  0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xe7, 0xb0, 0xb0, 0xb0, 0x18, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc1, 0xc1, 0xc1, 0x9f, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 
+  0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x01, 0xc3, 0xc3, 0xc3, 0xff, 0xca, 
+  0xca, 0xca, 0xff, 0x82, 0xd3, 0xd3, 0xd3, 0xff, 0x11, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 
+  0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 
+  0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0x9f, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbe, 0xbe, 0xbe, 0x33, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 
+  0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0x82, 
+  0xc9, 0xc9, 0xc9, 0xff, 0x01, 0xc7, 0xc7, 0xc7, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x81, 0xd5, 0xd5, 0xd5, 0xff, 0x81, 0xd4, 0xd4, 0xd4, 0xff, 0x10, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 
+  0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 
+  0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xae, 0xae, 0xae, 0x33, 0x9b, 0x00, 0x00, 0x00, 
+  0x00, 0x0a, 0xc0, 0xc0, 0xc0, 0x9f, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 
+  0xce, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0x81, 0xcb, 0xcb, 0xcb, 0xff, 0x16, 0xc9, 0xc9, 0xc9, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 
+  0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 
+  0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 
+  0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0x9f, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 0x14, 0xc1, 0xc1, 0xc1, 0xe7, 0xc3, 0xc3, 
+  0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xd0, 0xd0, 0xd0, 0xff, 0x02, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 
+  0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xcd, 0xcd, 0xcd, 0xff, 0x01, 0xca, 0xca, 0xca, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x02, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 
+  0xd4, 0xd4, 0xd4, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x0e, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 
+  0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 
+  0xb2, 0xe7, 0xb0, 0xb0, 0xb0, 0x14, 0x99, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc0, 0xc0, 0xc0, 0x33, 0xc2, 0xc2, 0xc2, 0xfb, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 
+  0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x05, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 
+  0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xd9, 0xd9, 0xd9, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x12, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 
+  0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 
+  0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xfb, 0xb1, 0xb1, 0xb1, 0x33, 0x99, 0x00, 0x00, 
+  0x00, 0x00, 0x07, 0xc0, 0xc0, 0xc0, 0x7f, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 
+  0xd2, 0xd2, 0xff, 0x81, 0xd4, 0xd4, 0xd4, 0xff, 0x03, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0x83, 0xdb, 0xdb, 0xdb, 0xff, 0x13, 0xda, 
+  0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 
+  0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 
+  0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x7f, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbf, 0xbf, 0xbf, 0xb4, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 
+  0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xda, 0xda, 0xda, 
+  0xff, 0xdb, 0xdb, 0xdb, 0xff, 0x83, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x00, 0xda, 0xda, 0xda, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x10, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 
+  0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 
+  0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xb4, 0x99, 0x00, 
+  0x00, 0x00, 0x00, 0x0c, 0xc0, 0xc0, 0xc0, 0xe0, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 
+  0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0x83, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xdb, 0xdb, 
+  0xdb, 0xff, 0x12, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 
+  0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 
+  0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xe0, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 
+  0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 
+  0xff, 0xda, 0xda, 0xda, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x81, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x13, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 
+  0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 
+  0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 
+  0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbf, 0xbf, 0xbf, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 
+  0xcc, 0xcc, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x00, 0xda, 0xda, 0xda, 0xff, 0x84, 0xdb, 0xdb, 
+  0xdb, 0xff, 0x00, 0xda, 0xda, 0xda, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x03, 0xd3, 0xd3, 0xd3, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xc9, 0xc9, 
+  0xc9, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x08, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 
+  0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 
+  0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 
+  0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0x81, 0xda, 0xda, 0xda, 0xff, 0x00, 0xdb, 0xdb, 0xdb, 0xff, 0x81, 0xda, 0xda, 0xda, 0xff, 0x09, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd5, 0xd5, 
+  0xd5, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc4, 
+  0xc4, 0xc4, 0xff, 0x07, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 
+  0xb1, 0xb1, 0xb1, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0xc0, 0xc0, 0xeb, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 
+  0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x01, 
+  0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0x81, 0xd9, 0xd9, 0xd9, 0xff, 0x02, 0xd8, 0xd8, 0xd8, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x81, 0xd0, 0xd0, 0xd0, 0xff, 0x05, 
+  0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x06, 0xbf, 0xbf, 
+  0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xeb, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+  0xbd, 0xbd, 0xbd, 0xc4, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 
+  0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0x82, 0xd7, 0xd7, 0xd7, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x14, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 
+  0xd6, 0xd6, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 
+  0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 
+  0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb0, 0xb0, 0xb0, 0xc4, 0x99, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbe, 0xbe, 0xbe, 0x90, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 
+  0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xcf, 0xcf, 0xcf, 0xff, 0x02, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 
+  0xd4, 0xd4, 0xff, 0x81, 0xd5, 0xd5, 0xd5, 0xff, 0x83, 0xd6, 0xd6, 0xd6, 0xff, 0x02, 0xd5, 0xd5, 0xd5, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0x81, 0xcf, 0xcf, 0xcf, 0xff, 0x06, 
+  0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xbe, 0xbe, 0xbe, 
+  0xff, 0x02, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0x81, 0xb4, 0xb4, 0xb4, 0xff, 0x00, 0xb1, 0xb1, 0xb1, 0x90, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbe, 0xbe, 
+  0xbe, 0x53, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 
+  0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x82, 0xd4, 0xd4, 0xd4, 0xff, 0x00, 0xd5, 0xd5, 0xd5, 0xff, 0x81, 0xd4, 0xd4, 0xd4, 0xff, 0x13, 0xd2, 0xd2, 
+  0xd2, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 
+  0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 
+  0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x53, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbc, 0xbc, 0xbc, 0x1b, 0xbe, 0xbe, 0xbe, 0xec, 0xc0, 0xc0, 0xc0, 0xff, 
+  0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 
+  0xd0, 0xd0, 0xd0, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x00, 0xd3, 0xd3, 0xd3, 0xff, 0x82, 0xd2, 0xd2, 0xd2, 0xff, 0x13, 0xd1, 0xd1, 0xd1, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 
+  0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 
+  0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xec, 
+  0xb1, 0xb1, 0xb1, 0x1b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbb, 0xbb, 0xbb, 0x07, 0xbd, 0xbd, 0xbd, 0xcb, 0xbe, 0xbe, 0xbe, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 
+  0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 
+  0x81, 0xd1, 0xd1, 0xd1, 0xff, 0x03, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x0f, 0xcb, 0xcb, 0xcb, 0xff, 
+  0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 
+  0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xcb, 0xb1, 0xb1, 0xb1, 0x07, 0x9a, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0xba, 0xba, 0xba, 0x54, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 
+  0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xcd, 0xcd, 0xcd, 0xff, 0x01, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd, 
+  0xcd, 0xcd, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x0f, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 
+  0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 
+  0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x54, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbb, 0xbb, 0xbb, 0xc4, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 
+  0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0x84, 0xcc, 0xcc, 0xcc, 0xff, 
+  0x02, 0xcb, 0xcb, 0xcb, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x05, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 
+  0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0x82, 0xb8, 0xb8, 0xb8, 0xff, 0x03, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb0, 0xb0, 0xb0, 
+  0xc4, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb8, 0xb8, 0xb8, 0x38, 0xbc, 0xbc, 0xbc, 0xf8, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 
+  0xff, 0x03, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x82, 0xca, 0xca, 0xca, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x10, 0xc8, 0xc8, 0xc8, 
+  0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xba, 0xba, 0xba, 
+  0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xf8, 0xb0, 0xb0, 0xb0, 
+  0x38, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb3, 0xb3, 0xb3, 0x04, 0xba, 0xba, 0xba, 0xa0, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0x81, 
+  0xc2, 0xc2, 0xc2, 0xff, 0x00, 0xc4, 0xc4, 0xc4, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x00, 0xc7, 0xc7, 0xc7, 0xff, 0x83, 0xc6, 0xc6, 0xc6, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x02, 0xc5, 0xc5, 
+  0xc5, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xbe, 0xbe, 0xbe, 0xff, 0x01, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0x82, 0xb9, 0xb9, 0xb9, 0xff, 0x05, 0xb8, 0xb8, 
+  0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xa0, 0xad, 0xad, 0xad, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x05, 0xaf, 0xaf, 0xaf, 0x04, 
+  0xba, 0xba, 0xba, 0xc8, 0xbb, 0xbb, 0xbb, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x04, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 
+  0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0xbf, 0xbf, 0xbf, 0xff, 0x06, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 
+  0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x07, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 
+  0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0xc8, 0xb1, 0xb1, 0xb1, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb7, 0xb7, 0xb7, 0x23, 
+  0xb9, 0xb9, 0xb9, 0xdb, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x83, 0xc1, 0xc1, 0xc1, 0xff, 0x01, 0xbc, 0xbc, 
+  0xbc, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xbd, 0xbd, 0xbd, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x04, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 
+  0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0x81, 0xb8, 0xb8, 0xb8, 0xff, 0x04, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xdb, 
+  0xae, 0xae, 0xae, 0x23, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0xb9, 0xb9, 0x2b, 0xb9, 0xb9, 0xb9, 0xd4, 0xb9, 0xb9, 0xb9, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 
+  0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0x82, 0xbf, 0xbf, 0xbf, 0xff, 0x03, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xbe, 0xbe, 0xbe, 
+  0xff, 0x81, 0xbd, 0xbd, 0xbd, 0xff, 0x00, 0xbc, 0xbc, 0xbc, 0xff, 0x81, 0xba, 0xba, 0xba, 0xff, 0x06, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 
+  0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0xd4, 0xb2, 0xb2, 0xb2, 0x2b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb6, 0xb6, 0xb6, 0x1b, 0xb7, 0xb7, 0xb7, 0xcb, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 
+  0xba, 0xba, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x00, 0xbd, 0xbd, 0xbd, 0xff, 0x83, 0xbe, 0xbe, 0xbe, 0xff, 0x81, 0xbd, 0xbd, 0xbd, 0xff, 0x00, 0xbb, 0xbb, 0xbb, 
+  0xff, 0x81, 0xba, 0xba, 0xba, 0xff, 0x81, 0xb8, 0xb8, 0xb8, 0xff, 0x05, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0xcb, 
+  0xaf, 0xaf, 0xaf, 0x1b, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x02, 0xba, 0xba, 0xba, 0x08, 0xb7, 0xb7, 0xb7, 0x7b, 0xb7, 0xb7, 0xb7, 0xff, 0x81, 0xb8, 0xb8, 0xb8, 0xff, 0x82, 0xba, 0xba, 0xba, 0xff, 
+  0x00, 0xbb, 0xbb, 0xbb, 0xff, 0x82, 0xba, 0xba, 0xba, 0xff, 0x01, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0x81, 0xb9, 0xb9, 0xb9, 0xff, 0x81, 0xb7, 0xb7, 0xb7, 0xff, 0x81, 0xb5, 0xb5, 
+  0xb5, 0xff, 0x03, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x7b, 0xb2, 0xb2, 0xb2, 0x08, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb5, 0xb5, 0xb5, 0x2f, 0xb7, 0xb7, 0xb7, 
+  0xab, 0xb7, 0xb7, 0xb7, 0xf0, 0x81, 0xb7, 0xb7, 0xb7, 0xff, 0x82, 0xb8, 0xb8, 0xb8, 0xff, 0x00, 0xb9, 0xb9, 0xb9, 0xff, 0x82, 0xb8, 0xb8, 0xb8, 0xff, 0x01, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 
+  0xb6, 0xff, 0x81, 0xb5, 0xb5, 0xb5, 0xff, 0x03, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xf0, 0xb0, 0xb0, 0xb0, 0xab, 0xb1, 0xb1, 0xb1, 0x2f, 0xac, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa8, 0xa8, 
+  0xa8, 0x03, 0xb6, 0xb6, 0xb6, 0x1b, 0xb5, 0xb5, 0xb5, 0x7f, 0xb5, 0xb5, 0xb5, 0xd0, 0xb5, 0xb5, 0xb5, 0xff, 0x82, 0xb6, 0xb6, 0xb6, 0xff, 0x82, 0xb5, 0xb5, 0xb5, 0xff, 0x81, 0xb4, 0xb4, 0xb4, 
+  0xff, 0x04, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xd0, 0xb1, 0xb1, 0xb1, 0x7f, 0xb2, 0xb2, 0xb2, 0x1b, 0xac, 0xac, 0xac, 0x03, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb3, 0xb3, 0xb3, 0x24, 
+  0xb3, 0xb3, 0xb3, 0x5f, 0xb5, 0xb5, 0xb5, 0x8c, 0xb4, 0xb4, 0xb4, 0xb0, 0xb4, 0xb4, 0xb4, 0xc7, 0xb3, 0xb3, 0xb3, 0xc7, 0xb3, 0xb3, 0xb3, 0xb0, 0xb3, 0xb3, 0xb3, 0x8c, 0xaf, 0xaf, 0xaf, 0x5f, 
+  0xae, 0xae, 0xae, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +378,7 @@ const lv_img_dsc_t owm_01n_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_01n_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_01n_64px_map,
 };
-
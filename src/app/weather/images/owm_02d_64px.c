@@ -10,271 +10,405 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_02D_64PX uint8_t owm_02d_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x18, 0xfc, 0x34, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xbc, 0xfc, 0x50, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xb0, 0xfc, 0xcc, 0xfc, 0x03, 0xfc, 0x00, 0xfc, 0x2f, 0xfc, 0xcb, 0xfc, 0x04, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x93, 0xfc, 0x14, 0xfc, 0x00, 0xfc, 0x17, 0xfc, 0xe7, 0xfc, 0xf4, 0xfc, 0x28, 0xfc, 0x2c, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x18, 0xfc, 0xec, 0xfc, 0xf3, 0xfc, 0x20, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0x7f, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0c, 0xfc, 0xe0, 0xfc, 0xec, 0xfc, 0x43, 0xfc, 0x30, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe4, 0xfc, 0xc8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xdc, 0xfc, 0xd0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x5c, 0xfc, 0x23, 0xfc, 0xe0, 0xfc, 0xec, 0xfc, 0x17, 0xfc, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x7f, 0xfc, 0x33, 0xfc, 0x03, 0xfc, 0x14, 0xfc, 0xe8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xdb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xdf, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0x20, 0xfc, 0x00, 0xfc, 0x28, 0xfc, 0x80, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xab, 0xfc, 0xff, 0xfc, 0xd3, 0xfc, 0x70, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0x64, 0xfc, 0xcb, 0xfc, 0xfb, 0xfc, 0xd0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0b, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x90, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xbb, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x07, 0xfc, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xdb, 0xfc, 0xa7, 0xfc, 0x4c, 0xfc, 0x7c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xa4, 0xfc, 0x3f, 0xfc, 0x98, 0xfc, 0xe8, 0xfc, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xaf, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xdb, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x53, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x80, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x50, 0xfc, 0x5b, 0xfc, 0x37, 0xfc, 0x53, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x5f, 0xfc, 0x34, 0xfc, 0x58, 0xfc, 0x57, 0xfc, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x80, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xac, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x13, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x4f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x7c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x07, 0xfc, 0x8b, 0xfc, 0xc4, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xc8, 0xfc, 0x97, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x3b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x63, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x68, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x94, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x47, 0xfc, 0xef, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0x5b, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x88, 0xfc, 0xf4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x97, 0xfc, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x6b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x88, 0xfc, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x68, 0xfc, 0xf4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x88, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1f, 0xfc, 0xe8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0x3b, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x18, 0xfc, 0x80, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x98, 0xfc, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x30, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x50, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x90, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0xa8, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x08, 0xfc, 0xec, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0x24, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x27, 0xfc, 0xec, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x38, 0xfc, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x13, 0xfc, 0xe7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0x30, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x47, 0xfc, 0xb7, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xde, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x57, 0xff, 0x7b, 0xff, 0x9b, 0xd7, 0x1b, 0x23, 0xff, 0x00, 0x1b, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x27, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xf3, 0x9f, 0x4c, 0x9f, 0x00, 0xbb, 0x08, 0x9f, 0x0c, 0xbf, 0x07, 0x9f, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x08, 0xfc, 0xeb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xfc, 0x9b, 0xdb, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xfc, 0x9b, 0xcc, 0x9f, 0x78, 0x9f, 0x1f, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0xfc, 0xd4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xde, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xef, 0x9f, 0x70, 0xf7, 0x00, 0x9f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x23, 0xfc, 0x3f, 0xfc, 0x9c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9f, 0x80, 0x1b, 0x00, 0x9f, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xde, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9f, 0x6b, 0x9f, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x44, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xde, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xec, 0x9f, 0x18, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0xb8, 0xfc, 0xc7, 0xfc, 0xbb, 0xfc, 0xab, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x34, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xaf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x8c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xe4, 0xfc, 0xe3, 0xfc, 0xc0, 0xfc, 0xbc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0x2c, 0xfc, 0x0f, 0xfc, 0x00, 0xfc, 0x88, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xa0, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xcc, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xb0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xc3, 0xfc, 0x97, 0xfc, 0x23, 0xfc, 0x18, 0xfc, 0xec, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0xe3, 0xfc, 0xff, 0xfc, 0xab, 0xfc, 0x5b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfb, 0xfd, 0xef, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xe7, 0x5b, 0x17, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x04, 0xfc, 0xe0, 0xfc, 0x57, 0xf8, 0x00, 0xfc, 0x20, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0x60, 0xfc, 0x4f, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0x68, 0x17, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xfc, 0x08, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0xd7, 0xfc, 0x9c, 0xf8, 0x00, 0xfc, 0x0b, 0xdd, 0xd7, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xfc, 0x5b, 0x8c, 0x0f, 0x00, 0x9f, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x37, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x47, 0xba, 0xa3, 0x3b, 0xf7, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xf7, 0x5b, 0x67, 0x5f, 0x04, 0x7f, 0x00, 0x7b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xde, 0x00, 0x5b, 0x2f, 0x5b, 0xb8, 0x5b, 0xef, 0x5b, 0xfc, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xf7, 0x5b, 0xe3, 0x5b, 0x9c, 0x5b, 0x1f, 0x5b, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x3b, 0x00, 0x5b, 0x08, 0x5b, 0x1f, 0x5b, 0x2b, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x27, 0x5b, 0x17, 0x5b, 0x04, 0x5b, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0xfc, 0x10, 0x82, 0x00, 0x00, 0x01, 0xfc, 0x18, 0xfc, 0x34, 0x82, 0x00, 
+  0x00, 0x00, 0xfc, 0x10, 0xb5, 0x00, 0x00, 0x01, 0xfc, 0xbc, 0xfc, 0x50, 0x81, 0x00, 0x00, 0x06, 0xfc, 0xb0, 0xfc, 0xcc, 0xfc, 0x03, 0x00, 0x00, 0xfc, 0x2f, 0xfc, 0xcb, 0xfc, 0x04, 0xaf, 0x00, 
+  0x00, 0x13, 0xfc, 0x03, 0xfc, 0x93, 0xfc, 0x14, 0x00, 0x00, 0xfc, 0x17, 0xfc, 0xe7, 0xfc, 0xf4, 0xfc, 0x28, 0xfc, 0x2c, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x18, 0xfc, 0xec, 0xfc, 0xf3, 
+  0xfc, 0x20, 0x00, 0x00, 0xfc, 0x0f, 0xfc, 0x7f, 0xfc, 0x0c, 0xab, 0x00, 0x00, 0x04, 0xfc, 0x0c, 0xfc, 0xe0, 0xfc, 0xec, 0xfc, 0x43, 0xfc, 0x30, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xe4, 0xfc, 0xc8, 
+  0x81, 0xfc, 0xff, 0x01, 0xfc, 0xdc, 0xfc, 0xd0, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0x5c, 0xfc, 0x23, 0xfc, 0xe0, 0xfc, 0xec, 0xfc, 0x17, 0xa8, 0x00, 0x00, 0x04, 0xfc, 0x7f, 0xfc, 0x33, 0xfc, 0x03, 
+  0xfc, 0x14, 0xfc, 0xe8, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0xdb, 0x89, 0xfc, 0xff, 0x00, 0xfc, 0xdf, 0x81, 0xfc, 0xff, 0x05, 0xfc, 0xf3, 0xfc, 0x20, 0x00, 0x00, 0xfc, 0x28, 0xfc, 0x80, 0xfc, 0x03, 
+  0xa4, 0x00, 0x00, 0x04, 0xfc, 0xab, 0xfc, 0xff, 0xfc, 0xd3, 0xfc, 0x70, 0xfc, 0xf3, 0x8f, 0xfc, 0xff, 0x04, 0xfc, 0xfc, 0xfc, 0x64, 0xfc, 0xcb, 0xfc, 0xfb, 0xfc, 0xd0, 0xa2, 0x00, 0x00, 0x00, 
+  0xfc, 0x0b, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x90, 0x97, 0xfc, 0xff, 0x00, 0xfc, 0xbb, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x07, 0xfc, 0x04, 0x9e, 0x00, 0x00, 0x03, 0xfc, 0xdb, 0xfc, 0xa7, 0xfc, 0x4c, 
+  0xfc, 0x7c, 0x97, 0xfc, 0xff, 0x04, 0xfc, 0xa4, 0xfc, 0x3f, 0xfc, 0x98, 0xfc, 0xe8, 0xfc, 0x03, 0x9e, 0x00, 0x00, 0x00, 0xfc, 0xaf, 0x9d, 0xfc, 0xff, 0x00, 0xfc, 0xdb, 0x9f, 0x00, 0x00, 0x00, 
+  0xfc, 0x53, 0x9d, 0xfc, 0xff, 0x00, 0xfc, 0x80, 0x9b, 0x00, 0x00, 0x05, 0xfc, 0x03, 0xfc, 0x50, 0xfc, 0x5b, 0xfc, 0x37, 0xfc, 0x53, 0xfc, 0xfb, 0x9c, 0xfc, 0xff, 0x04, 0xfc, 0x5f, 0xfc, 0x34, 
+  0xfc, 0x58, 0xfc, 0x57, 0xfc, 0x07, 0x98, 0x00, 0x00, 0x00, 0xfc, 0x80, 0xa3, 0xfc, 0xff, 0x00, 0xfc, 0xac, 0x9a, 0x00, 0x00, 0x00, 0xfc, 0xf7, 0xa2, 0xfc, 0xff, 0x00, 0xfc, 0x13, 0x9a, 0x00, 
+  0x00, 0x00, 0xfc, 0x4f, 0xa1, 0xfc, 0xff, 0x00, 0xfc, 0x7c, 0x97, 0x00, 0x00, 0x03, 0xfc, 0x07, 0xfc, 0x8b, 0xfc, 0xc4, 0xfc, 0xf7, 0xa4, 0xfc, 0xff, 0x02, 0xfc, 0xc8, 0xfc, 0x97, 0xfc, 0x0c, 
+  0x94, 0x00, 0x00, 0x00, 0xfc, 0x3b, 0xa7, 0xfc, 0xff, 0x00, 0xfc, 0x63, 0x96, 0x00, 0x00, 0x00, 0xfc, 0x68, 0xa5, 0xfc, 0xff, 0x00, 0xfc, 0x94, 0x97, 0x00, 0x00, 0x01, 0xfc, 0x47, 0xfc, 0xef, 
+  0xa3, 0xfc, 0xff, 0x01, 0xfc, 0xf7, 0xfc, 0x5b, 0x94, 0x00, 0x00, 0x02, 0xfc, 0x03, 0xfc, 0x88, 0xfc, 0xf4, 0xa8, 0xfc, 0xff, 0x01, 0xfc, 0x97, 0xfc, 0x0f, 0x91, 0x00, 0x00, 0x01, 0xfc, 0x03, 
+  0xfc, 0x6b, 0xa9, 0xfc, 0xff, 0x01, 0xfc, 0x88, 0xfc, 0x07, 0x93, 0x00, 0x00, 0x01, 0xfc, 0x68, 0xfc, 0xf4, 0xa5, 0xfc, 0xff, 0x01, 0xfc, 0xf8, 0xfc, 0x88, 0x95, 0x00, 0x00, 0x01, 0xfc, 0x1f, 
+  0xfc, 0xe8, 0xa5, 0xfc, 0xff, 0x01, 0xfc, 0xf7, 0xfc, 0x3b, 0x93, 0x00, 0x00, 0x01, 0xfc, 0x18, 0xfc, 0x80, 0xa9, 0xfc, 0xff, 0x01, 0xfc, 0x98, 0xfc, 0x1c, 0x91, 0x00, 0x00, 0x01, 0xfc, 0x30, 
+  0xfc, 0xf0, 0xaa, 0xfc, 0xff, 0x00, 0xfc, 0x50, 0x93, 0x00, 0x00, 0x01, 0xfc, 0x90, 0xfc, 0xf0, 0xa5, 0xfc, 0xff, 0x02, 0xfc, 0xf8, 0xfc, 0xa8, 0xfc, 0x04, 0x94, 0x00, 0x00, 0x01, 0xfc, 0x08, 
+  0xfc, 0xec, 0xa5, 0xfc, 0xff, 0x01, 0xfc, 0xfc, 0xfc, 0x24, 0x94, 0x00, 0x00, 0x01, 0xfc, 0x27, 0xfc, 0xec, 0x9f, 0xfc, 0xff, 0x81, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x81, 0xfc, 
+  0xff, 0x01, 0xfc, 0xf8, 0xfc, 0x38, 0x92, 0x00, 0x00, 0x01, 0xfc, 0x13, 0xfc, 0xe7, 0x9e, 0xfc, 0xff, 0x02, 0xfd, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0x83, 0x7b, 0xff, 0x05, 0x9b, 0xff, 0xbf, 0xff, 
+  0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0x30, 0x93, 0x00, 0x00, 0x02, 0xfc, 0x47, 0xfc, 0xb7, 0xfc, 0xf8, 0x99, 0xfc, 0xff, 0x04, 0xfd, 0xff, 0xde, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x57, 0xff, 
+  0x83, 0x5b, 0xff, 0x81, 0x57, 0xff, 0x02, 0x7b, 0xff, 0x9b, 0xd7, 0x1b, 0x23, 0x95, 0x00, 0x00, 0x01, 0xfc, 0x27, 0xfc, 0xf8, 0x99, 0xfc, 0xff, 0x00, 0x9b, 0xff, 0x8b, 0x5b, 0xff, 0x05, 0x7b, 
+  0xf3, 0x9f, 0x4c, 0x00, 0x00, 0xbb, 0x08, 0x9f, 0x0c, 0xbf, 0x07, 0x8f, 0x00, 0x00, 0x01, 0xfc, 0x08, 0xfc, 0xeb, 0x99, 0xfc, 0xff, 0x00, 0xbf, 0xff, 0x8d, 0x5b, 0xff, 0x01, 0x7b, 0xfc, 0x9b, 
+  0xdb, 0x81, 0x9b, 0xff, 0x03, 0x9b, 0xfc, 0x9b, 0xcc, 0x9f, 0x78, 0x9f, 0x1f, 0x8b, 0x00, 0x00, 0x01, 0xfc, 0x08, 0xfc, 0xd4, 0x99, 0xfc, 0xff, 0x00, 0xde, 0xff, 0x94, 0x5b, 0xff, 0x02, 0x7b, 
+  0xff, 0x7b, 0xef, 0x9f, 0x70, 0x8c, 0x00, 0x00, 0x02, 0xfc, 0x23, 0xfc, 0x3f, 0xfc, 0x9c, 0x96, 0xfc, 0xff, 0x00, 0x7b, 0xff, 0x96, 0x5b, 0xff, 0x01, 0x7b, 0xff, 0x9f, 0x80, 0x8d, 0x00, 0x00, 
+  0x00, 0xfc, 0xc8, 0x95, 0xfc, 0xff, 0x00, 0xde, 0xff, 0x98, 0x5b, 0xff, 0x01, 0x7b, 0xff, 0x9f, 0x6b, 0x8b, 0x00, 0x00, 0x00, 0xfc, 0x44, 0x93, 0xfc, 0xff, 0x03, 0xfe, 0xff, 0xde, 0xff, 0xbf, 
+  0xff, 0x7b, 0xff, 0x99, 0x5b, 0xff, 0x01, 0x7b, 0xec, 0x9f, 0x18, 0x89, 0x00, 0x00, 0x05, 0xfc, 0x03, 0xfc, 0xb8, 0xfc, 0xc7, 0xfc, 0xbb, 0xfc, 0xab, 0xfc, 0xf8, 0x8d, 0xfc, 0xff, 0x02, 0xfd, 
+  0xff, 0xbf, 0xff, 0x7b, 0xff, 0x9d, 0x5b, 0xff, 0x00, 0x7b, 0x63, 0x8d, 0x00, 0x00, 0x00, 0xfc, 0x34, 0x8e, 0xfc, 0xff, 0x00, 0x9b, 0xff, 0x9f, 0x5b, 0xff, 0x00, 0x7b, 0xaf, 0x8d, 0x00, 0x00, 
+  0x00, 0xfc, 0x8c, 0x8d, 0xfc, 0xff, 0x00, 0xbf, 0xff, 0xa0, 0x5b, 0xff, 0x00, 0x5b, 0xe0, 0x8d, 0x00, 0x00, 0x03, 0xfc, 0xe4, 0xfc, 0xe3, 0xfc, 0xc0, 0xfc, 0xbc, 0x89, 0xfc, 0xff, 0x00, 0xfd, 
+  0xff, 0xa1, 0x5b, 0xff, 0x00, 0x5b, 0xf7, 0x8d, 0x00, 0x00, 0x03, 0xfc, 0x2c, 0xfc, 0x0f, 0x00, 0x00, 0xfc, 0x88, 0x89, 0xfc, 0xff, 0x01, 0xfe, 0xff, 0x3b, 0xff, 0xa0, 0x5b, 0xff, 0x00, 0x5b, 
+  0xe0, 0x90, 0x00, 0x00, 0x04, 0xfc, 0xa0, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xcc, 0xfc, 0xfb, 0x85, 0xfc, 0xff, 0x01, 0xfe, 0xff, 0x3b, 0xff, 0xa0, 0x5b, 0xff, 0x00, 0x5b, 0xb0, 0x90, 0x00, 0x00, 
+  0x04, 0xfc, 0xc3, 0xfc, 0x97, 0xfc, 0x23, 0xfc, 0x18, 0xfc, 0xec, 0x85, 0xfc, 0xff, 0x01, 0xfe, 0xff, 0x3b, 0xff, 0xa0, 0x5b, 0xff, 0x00, 0x5b, 0x63, 0x93, 0x00, 0x00, 0x04, 0xfc, 0x10, 0xfc, 
+  0xe3, 0xfc, 0xff, 0xfc, 0xab, 0xfc, 0x5b, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xfb, 0xfd, 0xef, 0xa0, 0x5b, 0xff, 0x01, 0x5b, 0xe7, 0x5b, 0x17, 0x93, 0x00, 0x00, 0x09, 0xfc, 0x04, 0xfc, 0xe0, 0xfc, 
+  0x57, 0x00, 0x00, 0xfc, 0x20, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0x60, 0xfc, 0x4f, 0x7b, 0xff, 0x9f, 0x5b, 0xff, 0x00, 0x5b, 0x68, 0x95, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x81, 0x00, 0x00, 0x06, 0xfc, 
+  0x04, 0xfc, 0xd7, 0xfc, 0x9c, 0x00, 0x00, 0xfc, 0x0b, 0xdd, 0xd7, 0x3b, 0xff, 0x9c, 0x5b, 0xff, 0x01, 0x5b, 0xfc, 0x5b, 0x8c, 0x9a, 0x00, 0x00, 0x00, 0xfc, 0x37, 0x82, 0x00, 0x00, 0x02, 0xfc, 
+  0x47, 0xba, 0xa3, 0x3b, 0xf7, 0x9a, 0x5b, 0xff, 0x02, 0x5b, 0xf7, 0x5b, 0x67, 0x5f, 0x04, 0xa0, 0x00, 0x00, 0x03, 0x5b, 0x2f, 0x5b, 0xb8, 0x5b, 0xef, 0x5b, 0xfc, 0x94, 0x5b, 0xff, 0x03, 0x5b, 
+  0xf7, 0x5b, 0xe3, 0x5b, 0x9c, 0x5b, 0x1f, 0xa3, 0x00, 0x00, 0x02, 0x5b, 0x08, 0x5b, 0x1f, 0x5b, 0x2b, 0x94, 0x5b, 0x2f, 0x02, 0x5b, 0x27, 0x5b, 0x17, 0x5b, 0x04, 0xff, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x84, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x10, 0x40, 0xff, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x18, 0x40, 0xff, 0x34, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x10, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0x20, 0xff, 0xbc, 0x60, 0xff, 0x50, 0x60, 0xff, 0x00, 0xc1, 0xfe, 0x00, 0x20, 0xff, 0xb0, 0x00, 0xff, 0xcc, 0xe0, 0xff, 0x03, 0x60, 0xff, 0x00, 0x80, 0xff, 0x2f, 0x20, 0xff, 0xcb, 0xa0, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0x40, 0xff, 0x93, 0x60, 0xff, 0x14, 0x60, 0xff, 0x00, 0x60, 0xff, 0x17, 0xc0, 0xfe, 0xe7, 0x00, 0xff, 0xf4, 0x60, 0xff, 0x28, 0x41, 0xff, 0x2c, 0xe0, 0xfe, 0xf7, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x3f, 0x60, 0xff, 0x18, 0x00, 0xff, 0xec, 0xc0, 0xfe, 0xf3, 0x20, 0xff, 0x20, 0x40, 0xff, 0x00, 0x80, 0xff, 0x0f, 0x40, 0xff, 0x7f, 0x60, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0xc0, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x0c, 0xe0, 0xfe, 0xe0, 0x00, 0xff, 0xec, 0x61, 0xff, 0x43, 0x00, 0xff, 0x30, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xe4, 0x20, 0xff, 0xc8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x21, 0xff, 0xdc, 0x40, 0xff, 0xd0, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x5c, 0x80, 0xff, 0x23, 0x20, 0xff, 0xe0, 0xe0, 0xfe, 0xec, 0x20, 0xff, 0x17, 0x20, 0xff, 0x00, 0x00, 0xf8, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x7f, 0x60, 0xff, 0x33, 0xc0, 0xff, 0x03, 0x20, 0xff, 0x14, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xdb, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xdf, 0x20, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0x00, 0xff, 0x20, 0xe4, 0xff, 0x00, 0x60, 0xff, 0x28, 0x40, 0xff, 0x80, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xab, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0xd3, 0x40, 0xff, 0x70, 0xe0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xfc, 0x20, 0xff, 0x64, 0x40, 0xff, 0xcb, 0x00, 0xff, 0xfb, 0xc0, 0xfe, 0xd0, 0xa0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0x80, 0xff, 0x0b, 0x40, 0xff, 0x00, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x90, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xbb, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x07, 0x60, 0xff, 0x04, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0xdb, 0x60, 0xff, 0xa7, 0x61, 0xff, 0x4c, 0x00, 0xff, 0x7c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xa4, 0x61, 0xff, 0x3f, 0x60, 0xff, 0x98, 0x40, 0xff, 0xe8, 0xe0, 0xfe, 0x03, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0xaf, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xdb, 0xc0, 0xfe, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0xe0, 0xfe, 0x53, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x80, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x03, 0x40, 0xff, 0x50, 0x40, 0xff, 0x5b, 0x60, 0xff, 0x37, 0x20, 0xff, 0x53, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x5f, 0x60, 0xff, 0x34, 0x40, 0xff, 0x58, 0x40, 0xff, 0x57, 0x60, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x80, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xac, 0x20, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0xc0, 0xfe, 0xf7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0x13, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0xc0, 0xfe, 0x4f, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0x7c, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x07, 0x40, 0xff, 0x8b, 0x40, 0xff, 0xc4, 0x40, 0xff, 0xf7, 0x20, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xc8, 0x40, 0xff, 0x97, 0x60, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x3b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x63, 0x60, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x68, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x94, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x47, 0xc0, 0xfe, 0xef, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xf7, 0x40, 0xff, 0x5b, 0x41, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xe0, 0xff, 0x03, 0x40, 0xff, 0x88, 0x40, 0xff, 0xf4, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0x97, 0x60, 0xff, 0x0f, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xff, 0x03, 0x00, 0xff, 0x6b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x88, 0xa0, 0xff, 0x07, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x68, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0x88, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0xa0, 0xff, 0x1f, 0xe0, 0xfe, 0xe8, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xf7, 0x81, 0xff, 0x3b, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x60, 0xff, 0x18, 0x40, 0xff, 0x80, 0x20, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0x98, 0x60, 0xff, 0x1c, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x40, 0xff, 0x30, 0xe0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0x50, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0xc0, 0xfe, 0x90, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xa8, 0xa0, 0xfe, 0x04, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0xe1, 0xff, 0x08, 0xe0, 0xfe, 0xec, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xfc, 0x81, 0xff, 0x24, 0x40, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x27, 0x20, 0xff, 0xec, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x05, 0xf7, 0xff, 0x0a, 0xf7, 0xff, 0xed, 0xf6, 0xff, 0xee, 0xee, 0xff, 0xeb, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xf8, 0x60, 0xff, 0x38, 0x20, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x13, 0x00, 0xff, 0xe7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x20, 0xff, 0xff, 0x07, 0xe7, 0xff, 0xd7, 0xb6, 0xff, 0x5c, 0x86, 0xff, 0x1d, 0x6e, 0xff, 0xfd, 0x5d, 0xff, 0xde, 0x5d, 0xff, 0x1d, 0x66, 0xff, 0x3c, 0x7e, 0xff, 0x9a, 0x9e, 0xff, 0xcc, 0xd6, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0x60, 0xff, 0x30, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0xc0, 0xfe, 0x47, 0xc0, 0xfe, 0xb7, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x24, 0xf7, 0xff, 0xd3, 0xbe, 0xff, 0x3e, 0x66, 0xff, 0xbe, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x9d, 0x45, 0xff, 0xff, 0x55, 0xff, 0x7b, 0x86, 0xd7, 0x9f, 0x0e, 0x23, 0x14, 0xdf, 0x00, 0xff, 0x05, 0x00, 0x9f, 0x8e, 0x00, 0xbf, 0x86, 0x00, 0xbf, 0x86, 0x00, 0xbf, 0x86, 0x00, 0xbf, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x40, 0xff, 0x27, 0xe0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x20, 0xf7, 0xff, 0x99, 0x96, 0xff, 0xde, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0x3e, 0x6e, 0xf3, 0xdf, 0x96, 0x4c, 0x7f, 0x97, 0x00, 0x9f, 0x9e, 0x08, 0xbf, 0x8e, 0x0c, 0xdf, 0x96, 0x07, 0xbe, 0x86, 0x00, 0xbf, 0x8e, 0x00, 0xdf, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xff, 0x08, 0x20, 0xff, 0xeb, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x23, 0xff, 0xff, 0x99, 0x96, 0xff, 0xbe, 0x45, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x3e, 0x66, 0xfc, 0x9e, 0x7e, 0xdb, 0x7e, 0x7e, 0xff, 0x7e, 0x76, 0xff, 0x7e, 0x7e, 0xfc, 0x9e, 0x7e, 0xcc, 0x9e, 0x86, 0x78, 0xdf, 0x8e, 0x1f, 0x1f, 0x8f, 0x00, 0xbf, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x08, 0x20, 0xff, 0xd4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0xd1, 0xc6, 0xff, 0xde, 0x4d, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x4d, 0xff, 0xde, 0x55, 0xff, 0x5e, 0x6e, 0xef, 0xbe, 0x86, 0x70, 0xff, 0xfc, 0x00, 0xde, 0x86, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x00, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x23, 0xa0, 0xfe, 0x3f, 0xc0, 0xfe, 0x9c, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xf7, 0xff, 0x1c, 0x5e, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0x1e, 0x5e, 0xff, 0x9e, 0x7e, 0x80, 0x1b, 0x06, 0x00, 0xbf, 0x8e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0xc8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0xd2, 0xbe, 0xff, 0xbe, 0x3d, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xfe, 0x55, 0xff, 0xbf, 0x86, 0x6b, 0xbd, 0x7e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x44, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x0d, 0xe7, 0xff, 0xd3, 0xb6, 0xff, 0xd7, 0x9e, 0xff, 0x3d, 0x5e, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0x1e, 0x5e, 0xec, 0xdf, 0x86, 0x18, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x03, 0x00, 0xff, 0xb8, 0xc0, 0xfe, 0xc7, 0xc0, 0xfe, 0xbb, 0xc0, 0xfe, 0xab, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x05, 0xf7, 0xff, 0xb9, 0x96, 0xff, 0x1d, 0x56, 0xff, 0xfe, 0x45, 0xff, 0xde, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0x9e, 0x76, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xff, 0x34, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xf7, 0xff, 0x9a, 0x7e, 0xff, 0xde, 0x3d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0x5e, 0x66, 0xaf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x20, 0xff, 0x8c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0xb7, 0x9e, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x3e, 0x4e, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xe4, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xc0, 0xc0, 0xfe, 0xbc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe9, 0xf6, 0xff, 0x1c, 0x56, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x45, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x80, 0xfe, 0x00, 0xe0, 0xfe, 0x2c, 0xc0, 0xfe, 0x0f, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x88, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xce, 0xee, 0xff, 0xfe, 0x35, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xa0, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xcc, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xae, 0xee, 0xff, 0xfe, 0x25, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x3e, 0x46, 0xb0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xc3, 0xc0, 0xfe, 0x97, 0xc0, 0xfe, 0x23, 0xe0, 0xfe, 0x18, 0xc0, 0xfe, 0xec, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xae, 0xee, 0xff, 0xfe, 0x25, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x3e, 0x4e, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x9f, 0x00, 0x00, 0xf8, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0x10, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xab, 0xc0, 0xfe, 0x5b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xfb, 0xab, 0xee, 0xef, 0x1d, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xe7, 0x7e, 0x46, 0x17, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x04, 0xc0, 0xfe, 0xe0, 0xc0, 0xfe, 0x57, 0x01, 0xfe, 0x00, 0xe0, 0xfe, 0x20, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x60, 0xc3, 0xe6, 0x4f, 0x3a, 0x6e, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x3e, 0x3e, 0x68, 0x9d, 0x05, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfc, 0x00, 0x20, 0xff, 0x08, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xa0, 0xff, 0x04, 0xc0, 0xfe, 0xd7, 0xc0, 0xfe, 0x9c, 0x60, 0xfe, 0x00, 0x00, 0xff, 0x0b, 0x8b, 0xbe, 0xd7, 0x1d, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xfc, 0x1e, 0x3e, 0x8c, 0x9d, 0x03, 0x00, 0xfe, 0x86, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x37, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x47, 0x93, 0xae, 0xa3, 0x3e, 0x2e, 0xf7, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xf7, 0x3e, 0x3e, 0x67, 0xbf, 0x4e, 0x04, 0xde, 0x6e, 0x00, 0x9e, 0x66, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x91, 0xc6, 0x00, 0x3d, 0x3e, 0x2f, 0x3e, 0x36, 0xb8, 0x3e, 0x36, 0xef, 0x3e, 0x36, 0xfc, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xf7, 0x3e, 0x36, 0xe3, 0x3e, 0x36, 0x9c, 0x5e, 0x46, 0x1f, 0x5e, 0x3e, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xb7, 0x00, 0xdd, 0x1d, 0x00, 0x5e, 0x46, 0x08, 0x3e, 0x36, 0x1f, 0x3e, 0x36, 0x2b, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x27, 0x3e, 0x36, 0x17, 0x9e, 0x4e, 0x04, 0x1d, 0x36, 0x00, 0x3e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x10, 0x82, 0x00, 0x00, 0x00, 
+  0x01, 0x60, 0xff, 0x18, 0x40, 0xff, 0x34, 0x82, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x10, 0xb5, 0x00, 0x00, 0x00, 0x01, 0x20, 0xff, 0xbc, 0x60, 0xff, 0x50, 0x81, 0x00, 0x00, 0x00, 0x06, 0x20, 
+  0xff, 0xb0, 0x00, 0xff, 0xcc, 0xe0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x80, 0xff, 0x2f, 0x20, 0xff, 0xcb, 0xa0, 0xff, 0x04, 0xaf, 0x00, 0x00, 0x00, 0x13, 0x40, 0xff, 0x03, 0x40, 0xff, 0x93, 0x60, 
+  0xff, 0x14, 0x00, 0x00, 0x00, 0x60, 0xff, 0x17, 0xc0, 0xfe, 0xe7, 0x00, 0xff, 0xf4, 0x60, 0xff, 0x28, 0x41, 0xff, 0x2c, 0xe0, 0xfe, 0xf7, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x3f, 0x60, 0xff, 0x18, 
+  0x00, 0xff, 0xec, 0xc0, 0xfe, 0xf3, 0x20, 0xff, 0x20, 0x00, 0x00, 0x00, 0x80, 0xff, 0x0f, 0x40, 0xff, 0x7f, 0x60, 0xff, 0x0c, 0xab, 0x00, 0x00, 0x00, 0x04, 0x80, 0xff, 0x0c, 0xe0, 0xfe, 0xe0, 
+  0x00, 0xff, 0xec, 0x61, 0xff, 0x43, 0x00, 0xff, 0x30, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x20, 0xff, 0xe4, 0x20, 0xff, 0xc8, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x21, 0xff, 0xdc, 0x40, 0xff, 0xd0, 0x81, 
+  0xc0, 0xfe, 0xff, 0x04, 0x20, 0xff, 0x5c, 0x80, 0xff, 0x23, 0x20, 0xff, 0xe0, 0xe0, 0xfe, 0xec, 0x20, 0xff, 0x17, 0xa8, 0x00, 0x00, 0x00, 0x07, 0x40, 0xff, 0x7f, 0x60, 0xff, 0x33, 0xc0, 0xff, 
+  0x03, 0x20, 0xff, 0x14, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xdb, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x85, 0xc0, 0xfe, 0xff, 0x08, 0x00, 0xff, 0xdf, 
+  0x20, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf3, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x60, 0xff, 0x28, 0x40, 0xff, 0x80, 0x40, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xfe, 0xab, 
+  0xe0, 0xfe, 0xff, 0x40, 0xff, 0xd3, 0x40, 0xff, 0x70, 0xe0, 0xfe, 0xf3, 0x81, 0xc0, 0xfe, 0xff, 0x8b, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xfc, 0x20, 0xff, 0x64, 0x40, 
+  0xff, 0xcb, 0x00, 0xff, 0xfb, 0xc0, 0xfe, 0xd0, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x90, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 
+  0x91, 0xe0, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xbb, 0x81, 0x00, 0x00, 0x00, 0x01, 0x80, 0xff, 0x07, 0x60, 0xff, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x03, 
+  0x40, 0xff, 0xdb, 0x60, 0xff, 0xa7, 0x61, 0xff, 0x4c, 0x00, 0xff, 0x7c, 0x81, 0xc0, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x86, 0xe1, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x05, 0xc0, 0xfe, 0xff, 
+  0xe0, 0xfe, 0xa4, 0x61, 0xff, 0x3f, 0x60, 0xff, 0x98, 0x40, 0xff, 0xe8, 0xe0, 0xfe, 0x03, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0xaf, 0xc0, 0xfe, 0xff, 0x81, 0x00, 0xff, 0xff, 0x00, 0xc0, 
+  0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x86, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x03, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xff, 
+  0xc0, 0xfe, 0xdb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x53, 0x82, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x8d, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x83, 
+  0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0x80, 0x9b, 0x00, 0x00, 0x00, 0x06, 0xa0, 0xff, 0x03, 0x40, 0xff, 0x50, 0x40, 0xff, 0x5b, 0x60, 0xff, 0x37, 0x20, 0xff, 0x53, 0xc0, 
+  0xfe, 0xfb, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x90, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x05, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x5f, 
+  0x60, 0xff, 0x34, 0x40, 0xff, 0x58, 0x40, 0xff, 0x57, 0x60, 0xff, 0x07, 0x98, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x80, 0x86, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 
+  0x89, 0x21, 0xff, 0xff, 0x85, 0x01, 0xff, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xac, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xf7, 0x81, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 
+  0x84, 0x01, 0xff, 0xff, 0x8c, 0x21, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0x40, 0xff, 0x13, 0x9a, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0x4f, 
+  0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x85, 0x21, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x85, 0x21, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 
+  0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x7c, 0x97, 0x00, 0x00, 0x00, 0x05, 0x60, 0xff, 0x07, 0x40, 0xff, 0x8b, 0x40, 0xff, 0xc4, 0x40, 0xff, 0xf7, 0x20, 0xff, 0xff, 0xc0, 
+  0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x85, 0x21, 0xff, 0xff, 0x86, 0x41, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0xe0, 
+  0xfe, 0xff, 0x05, 0xc0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xc8, 0x40, 0xff, 0x97, 0x60, 0xff, 0x0c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3b, 0x82, 0xc0, 0xfe, 
+  0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x86, 0x42, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 
+  0xff, 0x82, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0x63, 0x96, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x68, 0x81, 0xc0, 0xfe, 
+  0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x89, 0x42, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 
+  0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x94, 0x97, 0x00, 0x00, 0x00, 0x02, 0x40, 0xff, 0x47, 0xc0, 0xfe, 0xef, 
+  0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x86, 0x62, 0xff, 0xff, 0x82, 
+  0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xf7, 0x40, 0xff, 0x5b, 0x94, 0x00, 0x00, 0x00, 0x05, 0xe0, 
+  0xff, 0x03, 0x40, 0xff, 0x88, 0x40, 0xff, 0xf4, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 
+  0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x88, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x83, 0xe0, 0xfe, 
+  0xff, 0x03, 0x00, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0x97, 0x60, 0xff, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xff, 0x03, 0x00, 0xff, 0x6b, 0x82, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 
+  0xff, 0x83, 0x01, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x8a, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 
+  0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0x88, 0xa0, 0xff, 0x07, 0x93, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xfe, 0x68, 
+  0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x84, 0x62, 0xff, 0xff, 0x82, 0x82, 
+  0xff, 0xff, 0x84, 0x62, 0xff, 0xff, 0x01, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 
+  0xf8, 0xc0, 0xfe, 0x88, 0x95, 0x00, 0x00, 0x00, 0x02, 0xa0, 0xff, 0x1f, 0xe0, 0xfe, 0xe8, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 
+  0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x82, 0x62, 0xff, 0xff, 0x85, 0x82, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x01, 
+  0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xf7, 0x81, 0xff, 0x3b, 0x93, 0x00, 0x00, 0x00, 0x02, 0x60, 0xff, 0x18, 0x40, 0xff, 0x80, 0x20, 0xff, 0xff, 0x81, 
+  0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x82, 0x62, 0xff, 0xff, 0x85, 0x82, 0xff, 0xff, 0x83, 
+  0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x03, 0xc0, 0xfe, 0xff, 0x00, 
+  0xff, 0xff, 0x40, 0xff, 0x98, 0x60, 0xff, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x30, 0xe0, 0xfe, 0xf0, 0x82, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 
+  0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x82, 0x62, 0xff, 0xff, 0x85, 0x82, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 
+  0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0x50, 0x93, 0x00, 0x00, 0x00, 0x02, 0xc0, 
+  0xfe, 0x90, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x82, 0x62, 0xff, 0xff, 
+  0x85, 0x82, 0xff, 0xff, 0x83, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 
+  0x02, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xa8, 0xa0, 0xfe, 0x04, 0x94, 0x00, 0x00, 0x00, 0x02, 0xe1, 0xff, 0x08, 0xe0, 0xfe, 0xec, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 
+  0x81, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x00, 0x42, 0xff, 0xff, 0x84, 0x62, 0xff, 0xff, 0x82, 0x82, 0xff, 0xff, 0x84, 0x62, 0xff, 0xff, 0x01, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x82, 
+  0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xfc, 0x81, 0xff, 0x24, 0x94, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x27, 0x20, 0xff, 
+  0xec, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x8a, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 
+  0xff, 0x01, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x81, 0x20, 0xff, 0xff, 0x09, 0x05, 0xf7, 0xff, 0x0a, 0xf7, 0xff, 0xed, 0xf6, 0xff, 0xee, 0xee, 0xff, 0xeb, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xe0, 
+  0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xf8, 0x60, 0xff, 0x38, 0x92, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x13, 0x00, 0xff, 0xe7, 0x83, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 
+  0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x88, 0x62, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x0d, 0x20, 
+  0xff, 0xff, 0x07, 0xe7, 0xff, 0xd7, 0xb6, 0xff, 0x5c, 0x86, 0xff, 0x1d, 0x6e, 0xff, 0xfd, 0x5d, 0xff, 0xde, 0x5d, 0xff, 0x1d, 0x66, 0xff, 0x3c, 0x7e, 0xff, 0x9a, 0x9e, 0xff, 0xcc, 0xd6, 0xff, 
+  0xc0, 0xfe, 0xff, 0x00, 0xff, 0xfc, 0x60, 0xff, 0x30, 0x93, 0x00, 0x00, 0x00, 0x03, 0xc0, 0xfe, 0x47, 0xc0, 0xfe, 0xb7, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 
+  0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x86, 0x62, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x05, 0x41, 0xff, 0xff, 0x24, 0xf7, 
+  0xff, 0xd3, 0xbe, 0xff, 0x3e, 0x66, 0xff, 0xbe, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x83, 0x9d, 0x4d, 0xff, 0x81, 0x9d, 0x45, 0xff, 0x02, 0xff, 0x55, 0xff, 0x7b, 0x86, 0xd7, 0x9f, 0x0e, 0x23, 0x95, 
+  0x00, 0x00, 0x00, 0x02, 0x40, 0xff, 0x27, 0xe0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 
+  0xff, 0x89, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x02, 0x20, 0xf7, 0xff, 0x99, 0x96, 0xff, 0xde, 0x4d, 0xff, 0x89, 0x9d, 0x4d, 0xff, 0x06, 0xbd, 0x4d, 0xff, 0x3e, 0x6e, 0xf3, 0xdf, 0x96, 
+  0x4c, 0x00, 0x00, 0x00, 0x9f, 0x9e, 0x08, 0xbf, 0x8e, 0x0c, 0xdf, 0x96, 0x07, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xff, 0x08, 0x20, 0xff, 0xeb, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 
+  0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x86, 0x42, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x02, 0x23, 0xff, 0xff, 0x99, 0x96, 0xff, 0xbe, 
+  0x45, 0xff, 0x8b, 0xbd, 0x4d, 0xff, 0x08, 0x9d, 0x45, 0xff, 0x3e, 0x66, 0xfc, 0x9e, 0x7e, 0xdb, 0x7e, 0x7e, 0xff, 0x7e, 0x76, 0xff, 0x7e, 0x7e, 0xfc, 0x9e, 0x7e, 0xcc, 0x9e, 0x86, 0x78, 0xdf, 
+  0x8e, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xa0, 0xff, 0x08, 0x20, 0xff, 0xd4, 0x83, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x85, 0x21, 0xff, 
+  0xff, 0x86, 0x41, 0xff, 0xff, 0x03, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0xd1, 0xc6, 0xff, 0xde, 0x4d, 0xff, 0x8e, 0xbd, 0x45, 0xff, 0x00, 0xbd, 0x4d, 0xff, 0x82, 0xbd, 0x45, 0xff, 0x03, 0xbd, 
+  0x4d, 0xff, 0xde, 0x55, 0xff, 0x5e, 0x6e, 0xef, 0xbe, 0x86, 0x70, 0x8c, 0x00, 0x00, 0x00, 0x03, 0xc0, 0xfe, 0x23, 0xa0, 0xfe, 0x3f, 0xc0, 0xfe, 0x9c, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 
+  0x81, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x85, 0x21, 0xff, 0xff, 0x82, 0x41, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x01, 0x20, 0xf7, 0xff, 0x1c, 0x5e, 0xff, 0x96, 0xbd, 0x45, 0xff, 0x01, 
+  0x1e, 0x5e, 0xff, 0x9e, 0x7e, 0x80, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xc8, 0x81, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x88, 0x21, 0xff, 0xff, 0x81, 0x20, 
+  0xff, 0xff, 0x01, 0xd2, 0xbe, 0xff, 0xbe, 0x3d, 0xff, 0x97, 0xbd, 0x45, 0xff, 0x01, 0xfe, 0x55, 0xff, 0xbf, 0x86, 0x6b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x44, 0x82, 0xc0, 0xfe, 0xff, 
+  0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x81, 0x20, 0xff, 0xff, 0x03, 0x0d, 0xe7, 0xff, 0xd3, 0xb6, 0xff, 0xd7, 0x9e, 0xff, 0x3d, 0x5e, 
+  0xff, 0x98, 0xdd, 0x45, 0xff, 0x02, 0xbd, 0x45, 0xff, 0x1e, 0x5e, 0xec, 0xdf, 0x86, 0x18, 0x89, 0x00, 0x00, 0x00, 0x06, 0xe0, 0xff, 0x03, 0x00, 0xff, 0xb8, 0xc0, 0xfe, 0xc7, 0xc0, 0xfe, 0xbb, 
+  0xc0, 0xfe, 0xab, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x87, 0x01, 0xff, 0xff, 0x04, 0x05, 0xf7, 0xff, 0xb9, 0x96, 0xff, 0x1d, 0x56, 0xff, 0xfe, 
+  0x45, 0xff, 0xde, 0x45, 0xff, 0x9b, 0xdd, 0x45, 0xff, 0x00, 0x9e, 0x76, 0x63, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x34, 0x81, 0xc0, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 
+  0xff, 0x84, 0x01, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x03, 0xf7, 0xff, 0x9a, 0x7e, 0xff, 0xde, 0x3d, 0xff, 0x9e, 0xdd, 0x45, 0xff, 0x00, 0x5e, 0x66, 0xaf, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x20, 
+  0xff, 0x8c, 0x83, 0xc0, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x02, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0xb7, 0x9e, 0xff, 0xa0, 0xfe, 0x3d, 0xff, 0x00, 0x3e, 0x4e, 0xe0, 
+  0x8d, 0x00, 0x00, 0x00, 0x03, 0x00, 0xff, 0xe4, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xc0, 0xc0, 0xfe, 0xbc, 0x81, 0xc0, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x02, 0xe1, 0xfe, 0xff, 0xe9, 0xf6, 0xff, 
+  0x1c, 0x56, 0xff, 0xa0, 0xfe, 0x3d, 0xff, 0x00, 0xfe, 0x45, 0xf7, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xfe, 0x2c, 0xc0, 0xfe, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x88, 0x83, 0xc0, 0xfe, 0xff, 
+  0x85, 0xe0, 0xfe, 0xff, 0x01, 0xce, 0xee, 0xff, 0xfe, 0x35, 0xff, 0xa0, 0xfe, 0x3d, 0xff, 0x00, 0xfe, 0x3d, 0xe0, 0x90, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xfe, 0xa0, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 
+  0xf3, 0xc0, 0xfe, 0xcc, 0xc0, 0xfe, 0xfb, 0x81, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x01, 0xae, 0xee, 0xff, 0xfe, 0x25, 0xff, 0xa0, 0xfe, 0x3d, 0xff, 0x00, 0x3e, 0x46, 0xb0, 0x90, 0x00, 
+  0x00, 0x00, 0x04, 0xe0, 0xfe, 0xc3, 0xc0, 0xfe, 0x97, 0xc0, 0xfe, 0x23, 0xe0, 0xfe, 0x18, 0xc0, 0xfe, 0xec, 0x85, 0xc0, 0xfe, 0xff, 0x01, 0xae, 0xee, 0xff, 0xfe, 0x25, 0xff, 0xa0, 0x1e, 0x3e, 
+  0xff, 0x00, 0x3e, 0x4e, 0x63, 0x93, 0x00, 0x00, 0x00, 0x04, 0x20, 0xff, 0x10, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xab, 0xc0, 0xfe, 0x5b, 0x81, 0xc0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 
+  0xfb, 0xab, 0xee, 0xef, 0x1d, 0x3e, 0xff, 0x9f, 0x1e, 0x3e, 0xff, 0x01, 0x1e, 0x3e, 0xe7, 0x7e, 0x46, 0x17, 0x93, 0x00, 0x00, 0x00, 0x09, 0xa0, 0xff, 0x04, 0xc0, 0xfe, 0xe0, 0xc0, 0xfe, 0x57, 
+  0x00, 0x00, 0x00, 0xe0, 0xfe, 0x20, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x60, 0xc3, 0xe6, 0x4f, 0x3a, 0x6e, 0xff, 0x9f, 0x1e, 0x36, 0xff, 0x00, 0x3e, 0x3e, 0x68, 0x95, 0x00, 0x00, 
+  0x00, 0x00, 0x20, 0xff, 0x08, 0x81, 0x00, 0x00, 0x00, 0x06, 0xa0, 0xff, 0x04, 0xc0, 0xfe, 0xd7, 0xc0, 0xfe, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x8b, 0xbe, 0xd7, 0x1d, 0x36, 0xff, 0x9c, 
+  0x1e, 0x36, 0xff, 0x01, 0x1e, 0x36, 0xfc, 0x1e, 0x3e, 0x8c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x37, 0x82, 0x00, 0x00, 0x00, 0x02, 0xe0, 0xfe, 0x47, 0x93, 0xae, 0xa3, 0x3e, 0x2e, 0xf7, 
+  0x9a, 0x3e, 0x36, 0xff, 0x02, 0x3e, 0x36, 0xf7, 0x3e, 0x3e, 0x67, 0xbf, 0x4e, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x03, 0x3d, 0x3e, 0x2f, 0x3e, 0x36, 0xb8, 0x3e, 0x36, 0xef, 0x3e, 0x36, 0xfc, 0x94, 
+  0x3e, 0x36, 0xff, 0x03, 0x3e, 0x36, 0xf7, 0x3e, 0x36, 0xe3, 0x3e, 0x36, 0x9c, 0x5e, 0x46, 0x1f, 0xa3, 0x00, 0x00, 0x00, 0x02, 0x5e, 0x46, 0x08, 0x3e, 0x36, 0x1f, 0x3e, 0x36, 0x2b, 0x94, 0x3e, 
+  0x36, 0x2f, 0x02, 0x3e, 0x36, 0x27, 0x3e, 0x36, 0x17, 0x9e, 0x4e, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x80, 0x10, 0xff, 0x40, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x18, 0xff, 0x40, 0x34, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x10, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x20, 0xbc, 0xff, 0x60, 0x50, 0xff, 0x60, 0x00, 0xfe, 0xc1, 0x00, 0xff, 0x20, 0xb0, 0xff, 0x00, 0xcc, 0xff, 0xe0, 0x03, 0xff, 0x60, 0x00, 0xff, 0x80, 0x2f, 0xff, 0x20, 0xcb, 0xff, 0xa0, 0x04, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x03, 0xff, 0x40, 0x93, 0xff, 0x60, 0x14, 0xff, 0x60, 0x00, 0xff, 0x60, 0x17, 0xfe, 0xc0, 0xe7, 0xff, 0x00, 0xf4, 0xff, 0x60, 0x28, 0xff, 0x41, 0x2c, 0xfe, 0xe0, 0xf7, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x3f, 0xff, 0x60, 0x18, 0xff, 0x00, 0xec, 0xfe, 0xc0, 0xf3, 0xff, 0x20, 0x20, 0xff, 0x40, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x40, 0x7f, 0xff, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0xc0, 0x00, 0xff, 0x80, 0x00, 0xff, 0x80, 0x0c, 0xfe, 0xe0, 0xe0, 0xff, 0x00, 0xec, 0xff, 0x61, 0x43, 0xff, 0x00, 0x30, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xe4, 0xff, 0x20, 0xc8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x21, 0xdc, 0xff, 0x40, 0xd0, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x5c, 0xff, 0x80, 0x23, 0xff, 0x20, 0xe0, 0xfe, 0xe0, 0xec, 0xff, 0x20, 0x17, 0xff, 0x20, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x7f, 0xff, 0x60, 0x33, 0xff, 0xc0, 0x03, 0xff, 0x20, 0x14, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xdb, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x20, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf3, 0xff, 0x00, 0x20, 0xff, 0xe4, 0x00, 0xff, 0x60, 0x28, 0xff, 0x40, 0x80, 0xff, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xab, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0xd3, 0xff, 0x40, 0x70, 0xfe, 0xe0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xfc, 0xff, 0x20, 0x64, 0xff, 0x40, 0xcb, 0xff, 0x00, 0xfb, 0xfe, 0xc0, 0xd0, 0xfe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xa0, 0x00, 0xff, 0x80, 0x0b, 0xff, 0x40, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xe0, 0x90, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xbb, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x07, 0xff, 0x60, 0x04, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0xdb, 0xff, 0x60, 0xa7, 0xff, 0x61, 0x4c, 0xff, 0x00, 0x7c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xa4, 0xff, 0x61, 0x3f, 0xff, 0x60, 0x98, 0xff, 0x40, 0xe8, 0xfe, 0xe0, 0x03, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0xaf, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xdb, 0xfe, 0xc0, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xe0, 0x53, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x80, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x03, 0xff, 0x40, 0x50, 0xff, 0x40, 0x5b, 0xff, 0x60, 0x37, 0xff, 0x20, 0x53, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x5f, 0xff, 0x60, 0x34, 0xff, 0x40, 0x58, 0xff, 0x40, 0x57, 0xff, 0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x80, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xac, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x00, 0xfd, 0xc0, 0x00, 0xfe, 0xc0, 0xf7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xfe, 0xc0, 0x4f, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0x7c, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x07, 0xff, 0x40, 0x8b, 0xff, 0x40, 0xc4, 0xff, 0x40, 0xf7, 0xff, 0x20, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xc8, 0xff, 0x40, 0x97, 0xff, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x3b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x63, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x68, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x94, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xfe, 0xa0, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x47, 0xfe, 0xc0, 0xef, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xf7, 0xff, 0x40, 0x5b, 0xff, 0x41, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x40, 0x88, 0xff, 0x40, 0xf4, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0x97, 0xff, 0x60, 0x0f, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x00, 0x6b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x88, 0xff, 0xa0, 0x07, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x68, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0x88, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0xa0, 0x1f, 0xfe, 0xe0, 0xe8, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xf7, 0xff, 0x81, 0x3b, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x60, 0x18, 0xff, 0x40, 0x80, 0xff, 0x20, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x40, 0x98, 0xff, 0x60, 0x1c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x40, 0x30, 0xfe, 0xe0, 0xf0, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0x50, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xc0, 0x90, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xa8, 0xfe, 0xa0, 0x04, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0xe1, 0x08, 0xfe, 0xe0, 0xec, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x82, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xfc, 0xff, 0x81, 0x24, 0xff, 0x40, 0x00, 0xfe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x27, 0xff, 0x20, 0xec, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xf7, 0x05, 0xff, 0xf7, 0x0a, 0xff, 0xf6, 0xed, 0xff, 0xee, 0xee, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xf8, 0xff, 0x60, 0x38, 0xff, 0x20, 0x00, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x13, 0xff, 0x00, 0xe7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x20, 0xff, 0xe7, 0x07, 0xff, 0xb6, 0xd7, 0xff, 0x86, 0x5c, 0xff, 0x6e, 0x1d, 0xff, 0x5d, 0xfd, 0xff, 0x5d, 0xde, 0xff, 0x66, 0x1d, 0xff, 0x7e, 0x3c, 0xff, 0x9e, 0x9a, 0xff, 0xd6, 0xcc, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xfc, 0xff, 0x60, 0x30, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xc0, 0x47, 0xfe, 0xc0, 0xb7, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xf7, 0x24, 0xff, 0xbe, 0xd3, 0xff, 0x66, 0x3e, 0xff, 0x4d, 0xbe, 0xff, 0x45, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x45, 0x9d, 0xff, 0x45, 0x9d, 0xff, 0x55, 0xff, 0xff, 0x86, 0x7b, 0xd7, 0x0e, 0x9f, 0x23, 0xdf, 0x14, 0x00, 0x05, 0xff, 0x00, 0x8e, 0x9f, 0x00, 0x86, 0xbf, 0x00, 0x86, 0xbf, 0x00, 0x86, 0xbf, 0x00, 0x86, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x80, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x40, 0x27, 0xfe, 0xe0, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xf7, 0x20, 0xff, 0x96, 0x99, 0xff, 0x4d, 0xde, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0xbd, 0xff, 0x6e, 0x3e, 0xf3, 0x96, 0xdf, 0x4c, 0x97, 0x7f, 0x00, 0x9e, 0x9f, 0x08, 0x8e, 0xbf, 0x0c, 0x96, 0xdf, 0x07, 0x86, 0xbe, 0x00, 0x8e, 0xbf, 0x00, 0x8e, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0xe0, 0x08, 0xff, 0x20, 0xeb, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x23, 0xff, 0x96, 0x99, 0xff, 0x45, 0xbe, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x45, 0x9d, 0xff, 0x66, 0x3e, 0xfc, 0x7e, 0x9e, 0xdb, 0x7e, 0x7e, 0xff, 0x76, 0x7e, 0xff, 0x7e, 0x7e, 0xfc, 0x7e, 0x9e, 0xcc, 0x86, 0x9e, 0x78, 0x8e, 0xdf, 0x1f, 0x8f, 0x1f, 0x00, 0x8e, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x08, 0xff, 0x20, 0xd4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xc6, 0xd1, 0xff, 0x4d, 0xde, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x55, 0xde, 0xff, 0x6e, 0x5e, 0xef, 0x86, 0xbe, 0x70, 0xfc, 0xff, 0x00, 0x86, 0xde, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xc0, 0x23, 0xfe, 0xa0, 0x3f, 0xfe, 0xc0, 0x9c, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xf7, 0x20, 0xff, 0x5e, 0x1c, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x5e, 0x1e, 0xff, 0x7e, 0x9e, 0x80, 0x06, 0x1b, 0x00, 0x8e, 0xbf, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xa0, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0xc8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xbe, 0xd2, 0xff, 0x3d, 0xbe, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x55, 0xfe, 0xff, 0x86, 0xbf, 0x6b, 0x7e, 0xbd, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x44, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xe7, 0x0d, 0xff, 0xb6, 0xd3, 0xff, 0x9e, 0xd7, 0xff, 0x5e, 0x3d, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xbd, 0xff, 0x5e, 0x1e, 0xec, 0x86, 0xdf, 0x18, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x03, 0xff, 0x00, 0xb8, 0xfe, 0xc0, 0xc7, 0xfe, 0xc0, 0xbb, 0xfe, 0xc0, 0xab, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xf7, 0x05, 0xff, 0x96, 0xb9, 0xff, 0x56, 0x1d, 0xff, 0x45, 0xfe, 0xff, 0x45, 0xde, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x76, 0x9e, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x00, 0x34, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0xf7, 0x03, 0xff, 0x7e, 0x9a, 0xff, 0x3d, 0xde, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x66, 0x5e, 0xaf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x20, 0x8c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0x9e, 0xb7, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x4e, 0x3e, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xe4, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xc0, 0xfe, 0xc0, 0xbc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xf6, 0xe9, 0xff, 0x56, 0x1c, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x45, 0xfe, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0x80, 0x00, 0xfe, 0xe0, 0x2c, 0xfe, 0xc0, 0x0f, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x88, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xee, 0xce, 0xff, 0x35, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xa0, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xcc, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xee, 0xae, 0xff, 0x25, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x46, 0x3e, 0xb0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xc3, 0xfe, 0xc0, 0x97, 0xfe, 0xc0, 0x23, 0xfe, 0xe0, 0x18, 0xfe, 0xc0, 0xec, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xee, 0xae, 0xff, 0x25, 0xfe, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x4e, 0x3e, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0xf8, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0x10, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xab, 0xfe, 0xc0, 0x5b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xfb, 0xee, 0xab, 0xef, 0x3e, 0x1d, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xe7, 0x46, 0x7e, 0x17, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x04, 0xfe, 0xc0, 0xe0, 0xfe, 0xc0, 0x57, 0xfe, 0x01, 0x00, 0xfe, 0xe0, 0x20, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x60, 0xe6, 0xc3, 0x4f, 0x6e, 0x3a, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x3e, 0x3e, 0x68, 0x05, 0x9d, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x20, 0x00, 0xff, 0x20, 0x08, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0xa0, 0x04, 0xfe, 0xc0, 0xd7, 0xfe, 0xc0, 0x9c, 0xfe, 0x60, 0x00, 0xff, 0x00, 0x0b, 0xbe, 0x8b, 0xd7, 0x36, 0x1d, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xfc, 0x3e, 0x1e, 0x8c, 0x03, 0x9d, 0x00, 0x86, 0xfe, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x40, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x37, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x47, 0xae, 0x93, 0xa3, 0x2e, 0x3e, 0xf7, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xf7, 0x3e, 0x3e, 0x67, 0x4e, 0xbf, 0x04, 0x6e, 0xde, 0x00, 0x66, 0x9e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xc6, 0x91, 0x00, 0x3e, 0x3d, 0x2f, 0x36, 0x3e, 0xb8, 0x36, 0x3e, 0xef, 0x36, 0x3e, 0xfc, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xf7, 0x36, 0x3e, 0xe3, 0x36, 0x3e, 0x9c, 0x46, 0x5e, 0x1f, 0x3e, 0x5e, 0x00, 0x03, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xfb, 0x00, 0x1d, 0xdd, 0x00, 0x46, 0x5e, 0x08, 0x36, 0x3e, 0x1f, 0x36, 0x3e, 0x2b, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x27, 0x36, 0x3e, 0x17, 0x4e, 0x9e, 0x04, 0x36, 0x1d, 0x00, 0x46, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x10, 0x82, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0x60, 0x18, 0xff, 0x40, 0x34, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x10, 0xb5, 0x00, 0x00, 0x00, 0x01, 0xff, 0x20, 0xbc, 0xff, 0x60, 0x50, 0x81, 0x00, 0x00, 0x00, 0x06, 0xff, 
+  0x20, 0xb0, 0xff, 0x00, 0xcc, 0xff, 0xe0, 0x03, 0x00, 0x00, 0x00, 0xff, 0x80, 0x2f, 0xff, 0x20, 0xcb, 0xff, 0xa0, 0x04, 0xaf, 0x00, 0x00, 0x00, 0x13, 0xff, 0x40, 0x03, 0xff, 0x40, 0x93, 0xff, 
+  0x60, 0x14, 0x00, 0x00, 0x00, 0xff, 0x60, 0x17, 0xfe, 0xc0, 0xe7, 0xff, 0x00, 0xf4, 0xff, 0x60, 0x28, 0xff, 0x41, 0x2c, 0xfe, 0xe0, 0xf7, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x3f, 0xff, 0x60, 0x18, 
+  0xff, 0x00, 0xec, 0xfe, 0xc0, 0xf3, 0xff, 0x20, 0x20, 0x00, 0x00, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x40, 0x7f, 0xff, 0x60, 0x0c, 0xab, 0x00, 0x00, 0x00, 0x04, 0xff, 0x80, 0x0c, 0xfe, 0xe0, 0xe0, 
+  0xff, 0x00, 0xec, 0xff, 0x61, 0x43, 0xff, 0x00, 0x30, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xff, 0x20, 0xe4, 0xff, 0x20, 0xc8, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xff, 0x21, 0xdc, 0xff, 0x40, 0xd0, 0x81, 
+  0xfe, 0xc0, 0xff, 0x04, 0xff, 0x20, 0x5c, 0xff, 0x80, 0x23, 0xff, 0x20, 0xe0, 0xfe, 0xe0, 0xec, 0xff, 0x20, 0x17, 0xa8, 0x00, 0x00, 0x00, 0x07, 0xff, 0x40, 0x7f, 0xff, 0x60, 0x33, 0xff, 0xc0, 
+  0x03, 0xff, 0x20, 0x14, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xdb, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xe0, 0xff, 0x85, 0xfe, 0xc0, 0xff, 0x08, 0xff, 0x00, 0xdf, 
+  0xff, 0x20, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf3, 0xff, 0x00, 0x20, 0x00, 0x00, 0x00, 0xff, 0x60, 0x28, 0xff, 0x40, 0x80, 0xff, 0x40, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xe0, 0xab, 
+  0xfe, 0xe0, 0xff, 0xff, 0x40, 0xd3, 0xff, 0x40, 0x70, 0xfe, 0xe0, 0xf3, 0x81, 0xfe, 0xc0, 0xff, 0x8b, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x04, 0xfe, 0xe0, 0xfc, 0xff, 0x20, 0x64, 0xff, 
+  0x40, 0xcb, 0xff, 0x00, 0xfb, 0xfe, 0xc0, 0xd0, 0xa2, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x90, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xff, 0x00, 0xff, 
+  0x91, 0xfe, 0xe0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0xbb, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x07, 0xff, 0x60, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x03, 
+  0xff, 0x40, 0xdb, 0xff, 0x60, 0xa7, 0xff, 0x61, 0x4c, 0xff, 0x00, 0x7c, 0x81, 0xfe, 0xc0, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x86, 0xfe, 0xe1, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x05, 0xfe, 0xc0, 0xff, 
+  0xfe, 0xe0, 0xa4, 0xff, 0x61, 0x3f, 0xff, 0x60, 0x98, 0xff, 0x40, 0xe8, 0xfe, 0xe0, 0x03, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0xaf, 0xfe, 0xc0, 0xff, 0x81, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+  0xc0, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x86, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x03, 0xff, 0x00, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xff, 
+  0xfe, 0xc0, 0xdb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x53, 0x82, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x8d, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x83, 
+  0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xe0, 0x80, 0x9b, 0x00, 0x00, 0x00, 0x06, 0xff, 0xa0, 0x03, 0xff, 0x40, 0x50, 0xff, 0x40, 0x5b, 0xff, 0x60, 0x37, 0xff, 0x20, 0x53, 0xfe, 
+  0xc0, 0xfb, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x90, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x05, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x5f, 
+  0xff, 0x60, 0x34, 0xff, 0x40, 0x58, 0xff, 0x40, 0x57, 0xff, 0x60, 0x07, 0x98, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x80, 0x86, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 
+  0x89, 0xff, 0x21, 0xff, 0x85, 0xff, 0x01, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe0, 0xac, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xf7, 0x81, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 
+  0x84, 0xff, 0x01, 0xff, 0x8c, 0xff, 0x21, 0xff, 0x84, 0xff, 0x01, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xff, 0x40, 0x13, 0x9a, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0x4f, 
+  0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x85, 0xff, 0x21, 0xff, 0x82, 0xff, 0x41, 0xff, 0x85, 0xff, 0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 
+  0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xc0, 0x7c, 0x97, 0x00, 0x00, 0x00, 0x05, 0xff, 0x60, 0x07, 0xff, 0x40, 0x8b, 0xff, 0x40, 0xc4, 0xff, 0x40, 0xf7, 0xff, 0x20, 0xff, 0xfe, 
+  0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x85, 0xff, 0x21, 0xff, 0x86, 0xff, 0x41, 0xff, 0x84, 0xff, 0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xfe, 
+  0xe0, 0xff, 0x05, 0xfe, 0xc0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xc8, 0xff, 0x40, 0x97, 0xff, 0x60, 0x0c, 0x94, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x3b, 0x82, 0xfe, 0xc0, 
+  0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x41, 0xff, 0x86, 0xff, 0x42, 0xff, 0x82, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 
+  0xff, 0x82, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xe0, 0x63, 0x96, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x68, 0x81, 0xfe, 0xc0, 
+  0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x89, 0xff, 0x42, 0xff, 0x82, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 
+  0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0x94, 0x97, 0x00, 0x00, 0x00, 0x02, 0xff, 0x40, 0x47, 0xfe, 0xc0, 0xef, 
+  0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x86, 0xff, 0x62, 0xff, 0x82, 
+  0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xf7, 0xff, 0x40, 0x5b, 0x94, 0x00, 0x00, 0x00, 0x05, 0xff, 
+  0xe0, 0x03, 0xff, 0x40, 0x88, 0xff, 0x40, 0xf4, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 
+  0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x88, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x83, 0xfe, 0xe0, 
+  0xff, 0x03, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0x97, 0xff, 0x60, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x03, 0xff, 0x00, 0x6b, 0x82, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 
+  0xff, 0x83, 0xff, 0x01, 0xff, 0x81, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x8a, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 
+  0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xe0, 0x88, 0xff, 0xa0, 0x07, 0x93, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xc0, 0x68, 
+  0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x81, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x84, 0xff, 0x62, 0xff, 0x82, 0xff, 
+  0x82, 0xff, 0x84, 0xff, 0x62, 0xff, 0x01, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 
+  0xf8, 0xfe, 0xc0, 0x88, 0x95, 0x00, 0x00, 0x00, 0x02, 0xff, 0xa0, 0x1f, 0xfe, 0xe0, 0xe8, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 
+  0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x82, 0xff, 0x62, 0xff, 0x85, 0xff, 0x82, 0xff, 0x83, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 
+  0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xe0, 0xf7, 0xff, 0x81, 0x3b, 0x93, 0x00, 0x00, 0x00, 0x02, 0xff, 0x60, 0x18, 0xff, 0x40, 0x80, 0xff, 0x20, 0xff, 0x81, 
+  0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x82, 0xff, 0x62, 0xff, 0x85, 0xff, 0x82, 0xff, 0x83, 
+  0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x03, 0xfe, 0xc0, 0xff, 0xff, 
+  0x00, 0xff, 0xff, 0x40, 0x98, 0xff, 0x60, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x30, 0xfe, 0xe0, 0xf0, 0x82, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 
+  0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x82, 0xff, 0x62, 0xff, 0x85, 0xff, 0x82, 0xff, 0x83, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 
+  0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0x50, 0x93, 0x00, 0x00, 0x00, 0x02, 0xfe, 
+  0xc0, 0x90, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x82, 0xff, 0x62, 0xff, 
+  0x85, 0xff, 0x82, 0xff, 0x83, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 
+  0x02, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xa8, 0xfe, 0xa0, 0x04, 0x94, 0x00, 0x00, 0x00, 0x02, 0xff, 0xe1, 0x08, 0xfe, 0xe0, 0xec, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 
+  0x81, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x00, 0xff, 0x42, 0xff, 0x84, 0xff, 0x62, 0xff, 0x82, 0xff, 0x82, 0xff, 0x84, 0xff, 0x62, 0xff, 0x01, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0x82, 
+  0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xe0, 0xfc, 0xff, 0x81, 0x24, 0x94, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x27, 0xff, 0x20, 
+  0xec, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x81, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x8a, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 
+  0xff, 0x01, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0x81, 0xff, 0x20, 0xff, 0x09, 0xf7, 0x05, 0xff, 0xf7, 0x0a, 0xff, 0xf6, 0xed, 0xff, 0xee, 0xee, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 
+  0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xf8, 0xff, 0x60, 0x38, 0x92, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x13, 0xff, 0x00, 0xe7, 0x83, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 
+  0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x88, 0xff, 0x62, 0xff, 0x81, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x0d, 0xff, 
+  0x20, 0xff, 0xe7, 0x07, 0xff, 0xb6, 0xd7, 0xff, 0x86, 0x5c, 0xff, 0x6e, 0x1d, 0xff, 0x5d, 0xfd, 0xff, 0x5d, 0xde, 0xff, 0x66, 0x1d, 0xff, 0x7e, 0x3c, 0xff, 0x9e, 0x9a, 0xff, 0xd6, 0xcc, 0xff, 
+  0xfe, 0xc0, 0xff, 0xff, 0x00, 0xfc, 0xff, 0x60, 0x30, 0x93, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xc0, 0x47, 0xfe, 0xc0, 0xb7, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 
+  0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x86, 0xff, 0x62, 0xff, 0x82, 0xff, 0x42, 0xff, 0x05, 0xff, 0x41, 0xff, 0xf7, 0x24, 
+  0xff, 0xbe, 0xd3, 0xff, 0x66, 0x3e, 0xff, 0x4d, 0xbe, 0xff, 0x45, 0x9d, 0xff, 0x83, 0x4d, 0x9d, 0xff, 0x81, 0x45, 0x9d, 0xff, 0x02, 0x55, 0xff, 0xff, 0x86, 0x7b, 0xd7, 0x0e, 0x9f, 0x23, 0x95, 
+  0x00, 0x00, 0x00, 0x02, 0xff, 0x40, 0x27, 0xfe, 0xe0, 0xf8, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 
+  0xff, 0x89, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x02, 0xf7, 0x20, 0xff, 0x96, 0x99, 0xff, 0x4d, 0xde, 0xff, 0x89, 0x4d, 0x9d, 0xff, 0x06, 0x4d, 0xbd, 0xff, 0x6e, 0x3e, 0xf3, 0x96, 0xdf, 
+  0x4c, 0x00, 0x00, 0x00, 0x9e, 0x9f, 0x08, 0x8e, 0xbf, 0x0c, 0x96, 0xdf, 0x07, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x08, 0xff, 0x20, 0xeb, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 
+  0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x82, 0xff, 0x41, 0xff, 0x86, 0xff, 0x42, 0xff, 0x81, 0xff, 0x41, 0xff, 0x02, 0xff, 0x23, 0xff, 0x96, 0x99, 0xff, 0x45, 
+  0xbe, 0xff, 0x8b, 0x4d, 0xbd, 0xff, 0x08, 0x45, 0x9d, 0xff, 0x66, 0x3e, 0xfc, 0x7e, 0x9e, 0xdb, 0x7e, 0x7e, 0xff, 0x76, 0x7e, 0xff, 0x7e, 0x7e, 0xfc, 0x7e, 0x9e, 0xcc, 0x86, 0x9e, 0x78, 0x8e, 
+  0xdf, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xa0, 0x08, 0xff, 0x20, 0xd4, 0x83, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x85, 0xff, 0x21, 
+  0xff, 0x86, 0xff, 0x41, 0xff, 0x03, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xc6, 0xd1, 0xff, 0x4d, 0xde, 0xff, 0x8e, 0x45, 0xbd, 0xff, 0x00, 0x4d, 0xbd, 0xff, 0x82, 0x45, 0xbd, 0xff, 0x03, 0x4d, 
+  0xbd, 0xff, 0x55, 0xde, 0xff, 0x6e, 0x5e, 0xef, 0x86, 0xbe, 0x70, 0x8c, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xc0, 0x23, 0xfe, 0xa0, 0x3f, 0xfe, 0xc0, 0x9c, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 
+  0x81, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x85, 0xff, 0x21, 0xff, 0x82, 0xff, 0x41, 0xff, 0x82, 0xff, 0x21, 0xff, 0x01, 0xf7, 0x20, 0xff, 0x5e, 0x1c, 0xff, 0x96, 0x45, 0xbd, 0xff, 0x01, 
+  0x5e, 0x1e, 0xff, 0x7e, 0x9e, 0x80, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0xc8, 0x81, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x84, 0xff, 0x01, 0xff, 0x88, 0xff, 0x21, 0xff, 0x81, 0xff, 
+  0x20, 0xff, 0x01, 0xbe, 0xd2, 0xff, 0x3d, 0xbe, 0xff, 0x97, 0x45, 0xbd, 0xff, 0x01, 0x55, 0xfe, 0xff, 0x86, 0xbf, 0x6b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x44, 0x82, 0xfe, 0xc0, 0xff, 
+  0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 0x81, 0xff, 0x20, 0xff, 0x03, 0xe7, 0x0d, 0xff, 0xb6, 0xd3, 0xff, 0x9e, 0xd7, 0xff, 0x5e, 0x3d, 
+  0xff, 0x98, 0x45, 0xdd, 0xff, 0x02, 0x45, 0xbd, 0xff, 0x5e, 0x1e, 0xec, 0x86, 0xdf, 0x18, 0x89, 0x00, 0x00, 0x00, 0x06, 0xff, 0xe0, 0x03, 0xff, 0x00, 0xb8, 0xfe, 0xc0, 0xc7, 0xfe, 0xc0, 0xbb, 
+  0xfe, 0xc0, 0xab, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x87, 0xff, 0x01, 0xff, 0x04, 0xf7, 0x05, 0xff, 0x96, 0xb9, 0xff, 0x56, 0x1d, 0xff, 0x45, 
+  0xfe, 0xff, 0x45, 0xde, 0xff, 0x9b, 0x45, 0xdd, 0xff, 0x00, 0x76, 0x9e, 0x63, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x34, 0x81, 0xfe, 0xc0, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 
+  0xff, 0x84, 0xff, 0x01, 0xff, 0x03, 0xff, 0x00, 0xff, 0xf7, 0x03, 0xff, 0x7e, 0x9a, 0xff, 0x3d, 0xde, 0xff, 0x9e, 0x45, 0xdd, 0xff, 0x00, 0x66, 0x5e, 0xaf, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0x20, 0x8c, 0x83, 0xfe, 0xc0, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x02, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0x9e, 0xb7, 0xff, 0xa0, 0x3d, 0xfe, 0xff, 0x00, 0x4e, 0x3e, 0xe0, 
+  0x8d, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0xe4, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xc0, 0xfe, 0xc0, 0xbc, 0x81, 0xfe, 0xc0, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xe1, 0xff, 0xf6, 0xe9, 0xff, 
+  0x56, 0x1c, 0xff, 0xa0, 0x3d, 0xfe, 0xff, 0x00, 0x45, 0xfe, 0xf7, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xe0, 0x2c, 0xfe, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x88, 0x83, 0xfe, 0xc0, 0xff, 
+  0x85, 0xfe, 0xe0, 0xff, 0x01, 0xee, 0xce, 0xff, 0x35, 0xfe, 0xff, 0xa0, 0x3d, 0xfe, 0xff, 0x00, 0x3d, 0xfe, 0xe0, 0x90, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xe0, 0xa0, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 
+  0xf3, 0xfe, 0xc0, 0xcc, 0xfe, 0xc0, 0xfb, 0x81, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x01, 0xee, 0xae, 0xff, 0x25, 0xfe, 0xff, 0xa0, 0x3d, 0xfe, 0xff, 0x00, 0x46, 0x3e, 0xb0, 0x90, 0x00, 
+  0x00, 0x00, 0x04, 0xfe, 0xe0, 0xc3, 0xfe, 0xc0, 0x97, 0xfe, 0xc0, 0x23, 0xfe, 0xe0, 0x18, 0xfe, 0xc0, 0xec, 0x85, 0xfe, 0xc0, 0xff, 0x01, 0xee, 0xae, 0xff, 0x25, 0xfe, 0xff, 0xa0, 0x3e, 0x1e, 
+  0xff, 0x00, 0x4e, 0x3e, 0x63, 0x93, 0x00, 0x00, 0x00, 0x04, 0xff, 0x20, 0x10, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xab, 0xfe, 0xc0, 0x5b, 0x81, 0xfe, 0xc0, 0xff, 0x02, 0xfe, 0xc0, 
+  0xfb, 0xee, 0xab, 0xef, 0x3e, 0x1d, 0xff, 0x9f, 0x3e, 0x1e, 0xff, 0x01, 0x3e, 0x1e, 0xe7, 0x46, 0x7e, 0x17, 0x93, 0x00, 0x00, 0x00, 0x09, 0xff, 0xa0, 0x04, 0xfe, 0xc0, 0xe0, 0xfe, 0xc0, 0x57, 
+  0x00, 0x00, 0x00, 0xfe, 0xe0, 0x20, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x60, 0xe6, 0xc3, 0x4f, 0x6e, 0x3a, 0xff, 0x9f, 0x36, 0x1e, 0xff, 0x00, 0x3e, 0x3e, 0x68, 0x95, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x20, 0x08, 0x81, 0x00, 0x00, 0x00, 0x06, 0xff, 0xa0, 0x04, 0xfe, 0xc0, 0xd7, 0xfe, 0xc0, 0x9c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x0b, 0xbe, 0x8b, 0xd7, 0x36, 0x1d, 0xff, 0x9c, 
+  0x36, 0x1e, 0xff, 0x01, 0x36, 0x1e, 0xfc, 0x3e, 0x1e, 0x8c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x37, 0x82, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xe0, 0x47, 0xae, 0x93, 0xa3, 0x2e, 0x3e, 0xf7, 
+  0x9a, 0x36, 0x3e, 0xff, 0x02, 0x36, 0x3e, 0xf7, 0x3e, 0x3e, 0x67, 0x4e, 0xbf, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x03, 0x3e, 0x3d, 0x2f, 0x36, 0x3e, 0xb8, 0x36, 0x3e, 0xef, 0x36, 0x3e, 0xfc, 0x94, 
+  0x36, 0x3e, 0xff, 0x03, 0x36, 0x3e, 0xf7, 0x36, 0x3e, 0xe3, 0x36, 0x3e, 0x9c, 0x46, 0x5e, 0x1f, 0xa3, 0x00, 0x00, 0x00, 0x02, 0x46, 0x5e, 0x08, 0x36, 0x3e, 0x1f, 0x36, 0x3e, 0x2b, 0x94, 0x36, 
+  0x3e, 0x2f, 0x02, 0x36, 0x3e, 0x27, 0x36, 0x3e, 0x17, 0x4e, 0x9e, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xef, 0xff, 0x10, 0x00, 0xe9, 0xfd, 0x00, 0x00, 0xe6, 0xfd, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xed, 0xff, 0x18, 0x00, 0xe9, 0xfe, 0x34, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x10, 0x00, 0xe7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xfe, 0x00, 0x00, 0xe5, 0xfe, 0xbc, 0x00, 0xee, 0xfd, 0x50, 0x02, 0xec, 0xfe, 0x00, 0x05, 0xd7, 0xfb, 0x00, 0x00, 0xe4, 0xfe, 0xb0, 0x00, 0xe0, 0xfe, 0xcc, 0x00, 0xff, 0xff, 0x03, 0x01, 0xed, 0xff, 0x00, 0x00, 0xf1, 0xff, 0x2f, 0x00, 0xe5, 0xfe, 0xcb, 0x00, 0xf5, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xff, 0x03, 0x00, 0xe8, 0xfd, 0x93, 0x00, 0xee, 0xfe, 0x14, 0x04, 0xec, 0xfe, 0x00, 0x01, 0xee, 0xff, 0x17, 0x00, 0xd9, 0xfe, 0xe7, 0x01, 0xe0, 0xfe, 0xf4, 0x04, 0xec, 0xff, 0x28, 0x05, 0xe9, 0xfd, 0x2c, 0x02, 0xdc, 0xfe, 0xf7, 0x01, 0xdb, 0xfe, 0xff, 0x03, 0xea, 0xfe, 0x3f, 0x04, 0xec, 0xff, 0x18, 0x03, 0xe2, 0xfe, 0xec, 0x00, 0xd9, 0xfe, 0xf3, 0x00, 0xe6, 0xfd, 0x20, 0x02, 0xea, 0xfe, 0x00, 0x00, 0xf1, 0xfc, 0x0f, 0x00, 0xe9, 0xff, 0x7f, 0x00, 0xec, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0c, 0x00, 0xdb, 0xfe, 0xe0, 0x02, 0xe2, 0xfe, 0xec, 0x05, 0xec, 0xff, 0x43, 0x01, 0xe2, 0xfe, 0x30, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xe4, 0x03, 0xe6, 0xfe, 0xc8, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x05, 0xe4, 0xfe, 0xdc, 0x03, 0xe7, 0xfe, 0xd0, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x03, 0xe3, 0xff, 0x5c, 0x02, 0xf1, 0xff, 0x23, 0x02, 0xe4, 0xfe, 0xe0, 0x01, 0xdb, 0xfe, 0xec, 0x00, 0xe6, 0xfd, 0x17, 0x00, 0xe3, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x7f, 0x00, 0xee, 0xfe, 0x33, 0x00, 0xfa, 0xfd, 0x03, 0x03, 0xe5, 0xff, 0x14, 0x01, 0xda, 0xfe, 0xe8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xe2, 0xfe, 0xff, 0x03, 0xe4, 0xfe, 0xdb, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x03, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xdf, 0x03, 0xe4, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xf3, 0x02, 0xe1, 0xfd, 0x20, 0x1e, 0xff, 0xff, 0x00, 0x00, 0xeb, 0xfe, 0x28, 0x00, 0xe9, 0xff, 0x80, 0x00, 0xe8, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xfe, 0x00, 0x00, 0xdc, 0xfe, 0xab, 0x00, 0xde, 0xfe, 0xff, 0x04, 0xea, 0xfe, 0xd3, 0x04, 0xea, 0xfd, 0x70, 0x02, 0xdb, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xfc, 0x04, 0xe6, 0xff, 0x64, 0x04, 0xea, 0xfe, 0xcb, 0x01, 0xe0, 0xfe, 0xfb, 0x00, 0xda, 0xfe, 0xd0, 0x00, 0xd4, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xd5, 0xff, 0x00, 0x00, 0xef, 0xff, 0x0b, 0x00, 0xea, 0xfe, 0x00, 0x03, 0xe1, 0xfe, 0x00, 0x03, 0xdb, 0xfe, 0x90, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xe1, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xbb, 0x02, 0xdf, 0xfe, 0x00, 0x03, 0xeb, 0xfe, 0x00, 0x00, 0xf1, 0xff, 0x07, 0x00, 0xec, 0xff, 0x04, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe7, 0xfe, 0x00, 0x00, 0xe7, 0xfe, 0xdb, 0x00, 0xec, 0xfe, 0xa7, 0x05, 0xee, 0xfd, 0x4c, 0x02, 0xe0, 0xfd, 0x7c, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xdd, 0xfe, 0xa4, 0x05, 0xed, 0xff, 0x3f, 0x03, 0xed, 0xfe, 0x98, 0x00, 0xe8, 0xfe, 0xe8, 0x00, 0xdd, 0xff, 0x03, 0x00, 0xe6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xfd, 0x00, 0x00, 0xd9, 0xfd, 0xaf, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xe1, 0xfe, 0xff, 0x04, 0xe1, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdf, 0xfe, 0xff, 0x04, 0xe3, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xd7, 0xfe, 0xdb, 0x00, 0xd8, 0xfe, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x01, 0xdd, 0xfe, 0x53, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0x80, 0x04, 0xe1, 0xfe, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x03, 0x00, 0xea, 0xff, 0x50, 0x00, 0xea, 0xfe, 0x5b, 0x03, 0xed, 0xfe, 0x37, 0x03, 0xe4, 0xfe, 0x53, 0x02, 0xda, 0xfe, 0xfb, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0x5f, 0x04, 0xed, 0xfe, 0x34, 0x00, 0xea, 0xfe, 0x58, 0x00, 0xea, 0xff, 0x57, 0x00, 0xec, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xfd, 0x00, 0x00, 0xde, 0xfd, 0x80, 0x00, 0xdc, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xff, 0x00, 0xdc, 0xfe, 0xac, 0x00, 0xc6, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x02, 0xb9, 0xfb, 0x00, 0x01, 0xd8, 0xfe, 0xf7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xe8, 0xff, 0x13, 0x00, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xec, 0xfd, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x03, 0xe9, 0xfe, 0x00, 0x00, 0xd8, 0xfe, 0x4f, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0x7c, 0x03, 0xe7, 0xfe, 0x00, 0x01, 0xeb, 0xfd, 0x00, 0x00, 0xea, 0xfd, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0x07, 0x00, 0xe9, 0xfd, 0x8b, 0x00, 0xe8, 0xfd, 0xc4, 0x03, 0xe8, 0xfe, 0xf7, 0x03, 0xe4, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x05, 0xe2, 0xfe, 0xff, 0x03, 0xe8, 0xfe, 0xff, 0x01, 0xe8, 0xfd, 0xc8, 0x00, 0xe8, 0xfd, 0x97, 0x00, 0xee, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfe, 0x00, 0x00, 0xdf, 0xff, 0x3b, 0x00, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x00, 0xdd, 0xff, 0x63, 0x00, 0xce, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x68, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfd, 0x94, 0x01, 0xd9, 0xfe, 0x00, 0x00, 0xda, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xd5, 0xff, 0x00, 0x00, 0xeb, 0xfe, 0x00, 0x01, 0xe9, 0xfe, 0x00, 0x02, 0xe8, 0xff, 0x47, 0x01, 0xda, 0xfe, 0xef, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf7, 0x03, 0xe8, 0xff, 0x5b, 0x07, 0xe7, 0xfd, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xe8, 0xfe, 0x88, 0x00, 0xe8, 0xfe, 0xf4, 0x03, 0xe2, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x00, 0xe8, 0xfe, 0x97, 0x00, 0xec, 0xff, 0x0f, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xdf, 0xfe, 0x6b, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdd, 0xfe, 0x88, 0x00, 0xf5, 0xff, 0x07, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x01, 0xdb, 0xfe, 0x00, 0x01, 0xd8, 0xfe, 0x68, 0x01, 0xd9, 0xfe, 0xf4, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0x88, 0x02, 0xda, 0xfd, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x01, 0xec, 0xff, 0x00, 0x04, 0xf6, 0xff, 0x1f, 0x02, 0xde, 0xfe, 0xe8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfe, 0xf7, 0x05, 0xf0, 0xff, 0x3b, 0x02, 0xed, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfc, 0x00, 0x00, 0xec, 0xfd, 0x18, 0x00, 0xe9, 0xfe, 0x80, 0x02, 0xe4, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x13, 0xf0, 0xfb, 0xff, 0x13, 0xf1, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xff, 0x01, 0xe9, 0xfe, 0x98, 0x00, 0xec, 0xfe, 0x1c, 0x00, 0xe4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xe9, 0xfe, 0x30, 0x00, 0xdb, 0xfe, 0xf0, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x13, 0xf0, 0xfb, 0xff, 0x13, 0xf1, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdb, 0xfe, 0xff, 0x00, 0xe5, 0xff, 0x50, 0x00, 0xdd, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x01, 0xd4, 0xf9, 0x00, 0x01, 0xd9, 0xfe, 0x90, 0x01, 0xd9, 0xfe, 0xf0, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0xa8, 0x00, 0xd5, 0xff, 0x04, 0x00, 0xde, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xea, 0xff, 0x00, 0x0c, 0xff, 0xff, 0x08, 0x02, 0xde, 0xfe, 0xec, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xfc, 0x07, 0xf2, 0xff, 0x24, 0x04, 0xe8, 0xfe, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x27, 0x02, 0xe6, 0xfe, 0xec, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x01, 0xe5, 0xfd, 0xff, 0x00, 0xe3, 0xfc, 0xff, 0x2a, 0xe1, 0xf4, 0xff, 0x54, 0xdf, 0xef, 0xff, 0x6c, 0xde, 0xed, 0xff, 0x70, 0xdd, 0xec, 0xff, 0x5c, 0xdc, 0xee, 0xff, 0x38, 0xdb, 0xf2, 0xff, 0x00, 0xdb, 0xfb, 0xff, 0x00, 0xd8, 0xff, 0xff, 0x03, 0xe3, 0xfe, 0xf8, 0x02, 0xec, 0xfd, 0x38, 0x00, 0xe3, 0xfd, 0x00, 0x00, 0xaf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x13, 0x00, 0xe2, 0xfe, 0xe7, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x3b, 0xe1, 0xe1, 0xff, 0xb9, 0xd8, 0xaf, 0xff, 0xe1, 0xc9, 0x81, 0xff, 0xe5, 0xc1, 0x6a, 0xff, 0xec, 0xbb, 0x59, 0xff, 0xed, 0xba, 0x57, 0xff, 0xe8, 0xbf, 0x64, 0xff, 0xe1, 0xc6, 0x79, 0xff, 0xd3, 0xd1, 0x9c, 0xff, 0x63, 0xd8, 0xd2, 0xff, 0x00, 0xd8, 0xfc, 0xff, 0x00, 0xdf, 0xff, 0xfc, 0x01, 0xed, 0xff, 0x30, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xe6, 0xfe, 0x00, 0x00, 0xd9, 0xff, 0x47, 0x01, 0xd9, 0xfe, 0xb7, 0x01, 0xda, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x08, 0xe7, 0xfd, 0xff, 0x23, 0xe5, 0xf3, 0xff, 0x9a, 0xda, 0xb6, 0xff, 0xee, 0xc3, 0x62, 0xff, 0xef, 0xb4, 0x47, 0xff, 0xea, 0xb0, 0x43, 0xff, 0xeb, 0xb1, 0x45, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb1, 0x47, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb0, 0x44, 0xff, 0xeb, 0xb0, 0x43, 0xff, 0xf6, 0xbd, 0x53, 0xff, 0xdb, 0xce, 0x80, 0xd7, 0xff, 0xcf, 0x06, 0x23, 0xa3, 0xdf, 0xd7, 0x00, 0xff, 0xbe, 0x00, 0x00, 0xf7, 0xd2, 0x88, 0x00, 0xf8, 0xd3, 0x83, 0x00, 0xf5, 0xd4, 0x84, 0x00, 0xf9, 0xd6, 0x82, 0x00, 0xff, 0xd4, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x00, 0x00, 0xdc, 0xff, 0x00, 0x03, 0xe7, 0xff, 0x27, 0x01, 0xdb, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x09, 0xe7, 0xfd, 0xff, 0x00, 0xe6, 0xf0, 0xff, 0xcb, 0xd0, 0x90, 0xff, 0xed, 0xb7, 0x4c, 0xff, 0xeb, 0xb2, 0x45, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb1, 0x45, 0xff, 0xec, 0xb4, 0x49, 0xff, 0xf0, 0xc4, 0x67, 0xf3, 0xf6, 0xda, 0x8f, 0x4c, 0xff, 0xeb, 0x90, 0x00, 0xfc, 0xd0, 0x99, 0x08, 0xfe, 0xd6, 0x8c, 0x0c, 0xf8, 0xd7, 0x91, 0x07, 0xef, 0xd3, 0x82, 0x00, 0xf6, 0xd6, 0x86, 0x00, 0xf8, 0xd7, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xfe, 0x00, 0x00, 0xfb, 0xfb, 0x08, 0x00, 0xe4, 0xfe, 0xeb, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x19, 0xe6, 0xf6, 0xff, 0xc6, 0xd1, 0x93, 0xff, 0xee, 0xb3, 0x40, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xea, 0xb1, 0x41, 0xff, 0xef, 0xc3, 0x62, 0xfc, 0xf3, 0xcf, 0x7a, 0xdb, 0xf2, 0xcd, 0x75, 0xff, 0xf2, 0xcc, 0x74, 0xff, 0xf2, 0xcd, 0x76, 0xfc, 0xf4, 0xcf, 0x7a, 0xcc, 0xf4, 0xd2, 0x7f, 0x78, 0xf5, 0xd9, 0x89, 0x1f, 0xf7, 0xe2, 0x89, 0x00, 0xf6, 0xd3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x08, 0x00, 0xe4, 0xfe, 0xd4, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x89, 0xda, 0xbe, 0xff, 0xed, 0xb7, 0x48, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb5, 0x47, 0xff, 0xec, 0xb3, 0x43, 0xff, 0xec, 0xb3, 0x42, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb6, 0x48, 0xff, 0xed, 0xba, 0x51, 0xff, 0xf1, 0xc7, 0x69, 0xef, 0xf4, 0xd6, 0x84, 0x70, 0xff, 0x9e, 0xff, 0x00, 0xf3, 0xd8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x00, 0xe1, 0xfe, 0x00, 0x00, 0xd7, 0xff, 0x23, 0x00, 0xd6, 0xff, 0x3f, 0x02, 0xd9, 0xfd, 0x9c, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x06, 0xe6, 0xfd, 0xff, 0x00, 0xe4, 0xed, 0xff, 0xe3, 0xc2, 0x55, 0xff, 0xec, 0xb4, 0x41, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xeb, 0xb3, 0x3e, 0xff, 0xef, 0xc0, 0x58, 0xff, 0xf3, 0xd2, 0x79, 0x80, 0xdb, 0xc0, 0x00, 0x00, 0xf9, 0xd6, 0x86, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xff, 0x00, 0x00, 0xd5, 0xff, 0x00, 0x02, 0xe6, 0xfe, 0x00, 0x03, 0xe3, 0xfe, 0xc8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x05, 0xe5, 0xfd, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x92, 0xd7, 0xb7, 0xff, 0xf0, 0xb4, 0x35, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xee, 0xbd, 0x51, 0xff, 0xf5, 0xd6, 0x7d, 0x6b, 0xea, 0xd3, 0x76, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xef, 0xff, 0x44, 0x00, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x02, 0xe4, 0xfd, 0xff, 0x03, 0xe4, 0xf8, 0xff, 0x6a, 0xe0, 0xde, 0xff, 0x9c, 0xda, 0xb1, 0xff, 0xbc, 0xd7, 0x95, 0xff, 0xe7, 0xc3, 0x5c, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb6, 0x3f, 0xff, 0xef, 0xc2, 0x58, 0xec, 0xf5, 0xd7, 0x81, 0x18, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xdf, 0xfe, 0xb8, 0x00, 0xd7, 0xfe, 0xc7, 0x01, 0xd9, 0xfd, 0xbb, 0x00, 0xd9, 0xff, 0xab, 0x02, 0xda, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0b, 0xe2, 0xfe, 0xff, 0x29, 0xe2, 0xef, 0xff, 0xcc, 0xd5, 0x94, 0xff, 0xea, 0xc2, 0x54, 0xff, 0xef, 0xbb, 0x42, 0xff, 0xee, 0xba, 0x40, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xba, 0x43, 0xff, 0xf2, 0xcf, 0x6d, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x00, 0xdd, 0xfe, 0x00, 0x00, 0xd7, 0xfe, 0x00, 0x02, 0xdb, 0xfd, 0x00, 0x02, 0xe0, 0xfe, 0x34, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x02, 0xe1, 0xfd, 0xff, 0x16, 0xe0, 0xf0, 0xff, 0xd2, 0xd0, 0x76, 0xff, 0xee, 0xba, 0x3a, 0xff, 0xec, 0xb9, 0x3d, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3d, 0xff, 0xf0, 0xc7, 0x5d, 0xaf, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x8c, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x00, 0xdf, 0xfa, 0xff, 0xbc, 0xd3, 0x98, 0xff, 0xf0, 0xbb, 0x35, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xef, 0xc3, 0x4c, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xdf, 0xfe, 0xe4, 0x00, 0xd8, 0xfe, 0xe3, 0x01, 0xd9, 0xfe, 0xc0, 0x01, 0xd9, 0xfe, 0xbc, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x49, 0xdc, 0xed, 0xff, 0xe4, 0xc1, 0x50, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xee, 0xbe, 0x40, 0xf7, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xd0, 0xfd, 0x00, 0x00, 0xdb, 0xfe, 0x2c, 0x00, 0xd8, 0xfe, 0x0f, 0x01, 0xda, 0xfe, 0x00, 0x01, 0xde, 0xfe, 0x88, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x6d, 0xd8, 0xe7, 0xff, 0xed, 0xbe, 0x30, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbe, 0x3c, 0xe0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xfe, 0x00, 0x00, 0xdd, 0xfe, 0xa0, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xcc, 0x02, 0xda, 0xfe, 0xfb, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x74, 0xd6, 0xe6, 0xff, 0xf0, 0xbe, 0x23, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x37, 0xff, 0xef, 0xc3, 0x43, 0xb0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xfe, 0x00, 0x00, 0xdb, 0xfe, 0xc3, 0x00, 0xd8, 0xfd, 0x97, 0x01, 0xd9, 0xfd, 0x23, 0x02, 0xde, 0xfd, 0x18, 0x01, 0xda, 0xfe, 0xec, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x71, 0xd5, 0xe7, 0xff, 0xee, 0xbe, 0x23, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xf0, 0xc6, 0x4a, 0x63, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd7, 0xfd, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0xe4, 0xff, 0x10, 0x00, 0xd9, 0xfe, 0xe3, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xab, 0x00, 0xd9, 0xff, 0x5b, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xfb, 0x58, 0xd6, 0xe8, 0xef, 0xe5, 0xc1, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc1, 0x37, 0xe7, 0xf1, 0xcc, 0x3d, 0x17, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x04, 0x00, 0xd9, 0xfe, 0xe0, 0x00, 0xd8, 0xff, 0x57, 0x09, 0xc1, 0xff, 0x00, 0x00, 0xdb, 0xfd, 0x20, 0x00, 0xd9, 0xfe, 0xf3, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0x60, 0x1c, 0xda, 0xdf, 0x4f, 0xcf, 0xc6, 0x6a, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc3, 0x3b, 0x68, 0xec, 0xaf, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xfe, 0x00, 0x00, 0xe3, 0xff, 0x08, 0x00, 0xda, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xf3, 0xff, 0x04, 0x00, 0xd8, 0xfe, 0xd7, 0x00, 0xd8, 0xfe, 0x9c, 0x02, 0xce, 0xfc, 0x00, 0x00, 0xe2, 0xff, 0x0b, 0x58, 0xd2, 0xb6, 0xd7, 0xea, 0xc2, 0x2d, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xfc, 0xed, 0xc2, 0x35, 0x8c, 0xe9, 0x70, 0x00, 0x00, 0xef, 0xdd, 0x7e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xfe, 0x00, 0x00, 0xda, 0xfe, 0x37, 0x00, 0xd7, 0xff, 0x00, 0x00, 0xdb, 0xff, 0x00, 0x00, 0xd9, 0xf8, 0x00, 0x00, 0xdc, 0xff, 0x47, 0x95, 0xcf, 0xaa, 0xa3, 0xef, 0xc3, 0x2c, 0xf7, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xf7, 0xef, 0xc5, 0x36, 0x67, 0xf5, 0xd6, 0x4c, 0x04, 0xf1, 0xd9, 0x67, 0x00, 0xef, 0xcf, 0x60, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x86, 0xd1, 0xc1, 0x00, 0xec, 0xc4, 0x39, 0x2f, 0xee, 0xc3, 0x33, 0xb8, 0xee, 0xc3, 0x32, 0xef, 0xee, 0xc3, 0x32, 0xfc, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xf7, 0xee, 0xc3, 0x32, 0xe3, 0xee, 0xc3, 0x33, 0x9c, 0xf2, 0xc7, 0x3f, 0x1f, 0xf0, 0xc7, 0x3a, 0x00, 0xbd, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xb1, 0x00, 0xea, 0xb7, 0x17, 0x00, 0xef, 0xc9, 0x41, 0x08, 0xef, 0xc5, 0x32, 0x1f, 0xee, 0xc4, 0x32, 0x2b, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xef, 0xc3, 0x31, 0x27, 0xed, 0xc4, 0x33, 0x17, 0xf4, 0xd0, 0x4a, 0x04, 0xec, 0xc2, 0x32, 0x00, 0xf1, 0xc6, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 
+  0xff, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xed, 0xff, 0x18, 0x00, 0xe9, 0xfe, 0x34, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x10, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0xe5, 0xfe, 0xbc, 0x00, 0xee, 0xfd, 0x50, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xe4, 0xfe, 0xb0, 0x00, 0xe0, 0xfe, 0xcc, 0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 
+  0xff, 0x2f, 0x00, 0xe5, 0xfe, 0xcb, 0x00, 0xf5, 0xff, 0x04, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xe7, 0xff, 0x03, 0x00, 0xe8, 0xfd, 0x93, 0x00, 0xee, 0xfe, 0x14, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0xee, 0xff, 0x17, 0x00, 0xd9, 0xfe, 0xe7, 0x01, 0xe0, 0xfe, 0xf4, 0x04, 0xec, 0xff, 0x28, 0x05, 0xe9, 0xfd, 0x2c, 0x02, 0xdc, 0xfe, 0xf7, 0x01, 0xdb, 0xfe, 0xff, 0x03, 0xea, 0xfe, 0x3f, 
+  0x04, 0xec, 0xff, 0x18, 0x03, 0xe2, 0xfe, 0xec, 0x00, 0xd9, 0xfe, 0xf3, 0x00, 0xe6, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xfc, 0x0f, 0x00, 0xe9, 0xff, 0x7f, 0x00, 0xec, 0xff, 0x0c, 
+  0xab, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xf0, 0xff, 0x0c, 0x00, 0xdb, 0xfe, 0xe0, 0x02, 0xe2, 0xfe, 0xec, 0x05, 0xec, 0xff, 0x43, 0x01, 0xe2, 0xfe, 0x30, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 
+  0xfe, 0xff, 0x03, 0xe5, 0xfe, 0xe4, 0x03, 0xe6, 0xfe, 0xc8, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x01, 0x05, 0xe4, 0xfe, 0xdc, 0x03, 0xe7, 0xfe, 0xd0, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0x03, 0xe3, 
+  0xff, 0x5c, 0x02, 0xf1, 0xff, 0x23, 0x02, 0xe4, 0xfe, 0xe0, 0x01, 0xdb, 0xfe, 0xec, 0x00, 0xe6, 0xfd, 0x17, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xe9, 0xff, 0x7f, 0x00, 0xee, 0xfe, 0x33, 
+  0x00, 0xfa, 0xfd, 0x03, 0x03, 0xe5, 0xff, 0x14, 0x01, 0xda, 0xfe, 0xe8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xe2, 0xfe, 0xff, 0x03, 0xe4, 0xfe, 0xdb, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x01, 0x02, 0xd9, 
+  0xfe, 0xff, 0x03, 0xdb, 0xfe, 0xff, 0x85, 0x02, 0xda, 0xfe, 0xff, 0x08, 0x03, 0xe2, 0xfe, 0xdf, 0x03, 0xe4, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xf3, 0x02, 0xe1, 0xfd, 0x20, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0x28, 0x00, 0xe9, 0xff, 0x80, 0x00, 0xe8, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xdc, 0xfe, 0xab, 0x00, 0xde, 0xfe, 0xff, 0x04, 0xea, 
+  0xfe, 0xd3, 0x04, 0xea, 0xfd, 0x70, 0x02, 0xdb, 0xfe, 0xf3, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x02, 0xdc, 0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x85, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x03, 
+  0xdb, 0xfd, 0xff, 0x00, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x04, 0x02, 0xdb, 0xfe, 0xfc, 0x04, 0xe6, 0xff, 0x64, 0x04, 0xea, 0xfe, 0xcb, 0x01, 0xe0, 0xfe, 0xfb, 0x00, 0xda, 
+  0xfe, 0xd0, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xdb, 0xfe, 0x90, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe0, 
+  0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdc, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 
+  0x82, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x00, 0x04, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0x01, 0xd9, 0xfe, 0xbb, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xff, 0x07, 0x00, 0xec, 0xff, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xe7, 0xfe, 0xdb, 0x00, 0xec, 0xfe, 0xa7, 0x05, 0xee, 0xfd, 0x4c, 0x02, 0xe0, 
+  0xfd, 0x7c, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x86, 0x05, 0xde, 
+  0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x07, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xdd, 
+  0xfe, 0xa4, 0x05, 0xed, 0xff, 0x3f, 0x03, 0xed, 0xfe, 0x98, 0x00, 0xe8, 0xfe, 0xe8, 0x00, 0xdd, 0xff, 0x03, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xd9, 0xfd, 0xaf, 0x02, 0xda, 0xfe, 0xff, 
+  0x02, 0xe1, 0xfe, 0xff, 0x04, 0xe1, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xde, 
+  0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 0xff, 0x82, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 
+  0x81, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdf, 0xfe, 0xff, 0x04, 0xe3, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x00, 0xd7, 
+  0xfe, 0xdb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xdd, 0xfe, 0x53, 0x01, 0xd9, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x06, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 
+  0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x85, 0x07, 0xe1, 0xfd, 0xff, 0x00, 0x07, 0xe0, 0xfd, 
+  0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x00, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 
+  0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0x80, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xf6, 0xff, 0x03, 0x00, 0xea, 0xff, 0x50, 0x00, 0xea, 0xfe, 0x5b, 0x03, 0xed, 0xfe, 0x37, 
+  0x03, 0xe4, 0xfe, 0x53, 0x02, 0xda, 0xfe, 0xfb, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x01, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 
+  0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x00, 0x07, 0xe2, 0xfd, 0xff, 0x84, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x05, 0x07, 0xe0, 0xfd, 0xff, 
+  0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x06, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 
+  0xfe, 0xff, 0x03, 0xe3, 0xfe, 0x5f, 0x04, 0xed, 0xfe, 0x34, 0x00, 0xea, 0xfe, 0x58, 0x00, 0xea, 0xff, 0x57, 0x00, 0xec, 0xff, 0x07, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xde, 0xfd, 0x80, 
+  0x00, 0xdc, 0xfe, 0xff, 0x81, 0x02, 0xdd, 0xfe, 0xff, 0x05, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 
+  0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x01, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x08, 0xe3, 0xfd, 0xff, 0x01, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x81, 0x09, 
+  0xe4, 0xfc, 0xff, 0x81, 0x09, 0xe4, 0xfd, 0xff, 0x01, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x03, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 
+  0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x01, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x02, 0xdd, 0xfe, 0xff, 0x01, 0x01, 0xdc, 0xfe, 0xff, 0x00, 
+  0xdc, 0xfe, 0xac, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xd8, 0xfe, 0xf7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 
+  0xfd, 0xff, 0x08, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 
+  0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x84, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x09, 0xe4, 0xfc, 0xff, 0x07, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 
+  0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x01, 0x01, 0xd9, 0xfe, 
+  0xff, 0x00, 0xe8, 0xff, 0x13, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xd8, 0xfe, 0x4f, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x81, 
+  0x05, 0xde, 0xfd, 0xff, 0x01, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x03, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 
+  0xe6, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x82, 0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x04, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 
+  0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 
+  0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0x7c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xeb, 0xff, 0x07, 0x00, 0xe9, 0xfd, 0x8b, 0x00, 0xe8, 0xfd, 0xc4, 0x03, 0xe8, 0xfe, 0xf7, 0x03, 
+  0xe4, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 
+  0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x81, 0x0c, 0xe7, 0xfc, 0xff, 0x82, 0x0c, 0xe8, 
+  0xfc, 0xff, 0x13, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 
+  0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x05, 
+  0xe2, 0xfe, 0xff, 0x03, 0xe8, 0xfe, 0xff, 0x01, 0xe8, 0xfd, 0xc8, 0x00, 0xe8, 0xfd, 0x97, 0x00, 0xee, 0xff, 0x0c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xdf, 0xff, 0x3b, 0x00, 0xd9, 0xfe, 
+  0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 
+  0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x86, 0x0d, 
+  0xe9, 0xfc, 0xff, 0x02, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0a, 0xe5, 0xfc, 0xff, 0x03, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 
+  0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0x02, 0xda, 0xfe, 0xff, 0x81, 0x01, 0xda, 0xfe, 0xff, 0x00, 0x00, 0xdd, 0xff, 0x63, 0x96, 
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xd8, 0xff, 0x68, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 
+  0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 
+  0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x85, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x0b, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 
+  0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x02, 0xd9, 0xfd, 0x94, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0xe8, 0xff, 0x47, 0x01, 0xda, 0xfe, 0xef, 0x02, 0xda, 0xfe, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 
+  0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x81, 0x0e, 0xea, 0xfc, 0xff, 0x00, 0x0f, 0xeb, 0xfc, 0xff, 0x84, 0x0f, 0xec, 0xfc, 0xff, 0x01, 
+  0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe2, 
+  0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf7, 0x03, 0xe8, 
+  0xff, 0x5b, 0x94, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0xff, 0xff, 0x03, 0x00, 0xe8, 0xfe, 0x88, 0x00, 0xe8, 0xfe, 0xf4, 0x03, 0xe2, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 
+  0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0f, 0xec, 0xfc, 0xff, 0x00, 0x10, 0xec, 0xfc, 0xff, 0x82, 0x10, 
+  0xed, 0xfb, 0xff, 0x0c, 0x10, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 
+  0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0x03, 0xdb, 
+  0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xe1, 0xfe, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x00, 0xe8, 0xfe, 0x97, 0x00, 0xec, 0xff, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0xfb, 0xff, 0x03, 
+  0x00, 0xdf, 0xfe, 0x6b, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 
+  0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 
+  0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0f, 0xec, 0xfc, 0xff, 0x00, 0x10, 0xed, 0xfb, 0xff, 0x84, 0x11, 0xee, 0xfb, 0xff, 0x0f, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 
+  0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 
+  0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0x00, 0xdd, 0xfe, 0x88, 0x00, 0xf5, 
+  0xff, 0x07, 0x93, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0xd8, 0xfe, 0x68, 0x01, 0xd9, 0xfe, 0xf4, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 
+  0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x81, 0x11, 0xee, 0xfb, 0xff, 0x82, 0x11, 0xef, 0xfb, 0xff, 0x00, 0x11, 0xee, 0xfb, 0xff, 0x81, 
+  0x10, 0xed, 0xfb, 0xff, 0x0f, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 
+  0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 
+  0xf8, 0x01, 0xd9, 0xfe, 0x88, 0x95, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0xf6, 0xff, 0x1f, 0x02, 0xde, 0xfe, 0xe8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 
+  0x09, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 
+  0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x81, 0x10, 0xed, 0xfb, 0xff, 0x01, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x82, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0x12, 0xef, 0xfb, 
+  0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 
+  0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 
+  0xff, 0x03, 0xdc, 0xfe, 0xf7, 0x05, 0xf0, 0xff, 0x3b, 0x93, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xec, 0xfd, 0x18, 0x00, 0xe9, 0xfe, 0x80, 0x02, 0xe4, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 
+  0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x15, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 
+  0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 
+  0xff, 0x12, 0xef, 0xfb, 0xff, 0x13, 0xf0, 0xfb, 0xff, 0x13, 0xf1, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 
+  0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 
+  0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xff, 0x01, 0xe9, 0xfe, 0x98, 0x00, 
+  0xec, 0xfe, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe9, 0xfe, 0x30, 0x00, 0xdb, 0xfe, 0xf0, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 
+  0x04, 0xdd, 0xfd, 0xff, 0x15, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 
+  0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x13, 0xf0, 0xfb, 
+  0xff, 0x13, 0xf1, 0xfb, 0xff, 0x12, 0xf0, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xee, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 
+  0xfc, 0xff, 0x0d, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 
+  0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdb, 0xfe, 0xff, 0x00, 0xe5, 0xff, 0x50, 0x93, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0x01, 0xd9, 0xfe, 0x90, 0x01, 0xd9, 0xfe, 0xf0, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x09, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 
+  0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x81, 
+  0x10, 0xed, 0xfb, 0xff, 0x01, 0x11, 0xef, 0xfb, 0xff, 0x12, 0xef, 0xfb, 0xff, 0x82, 0x12, 0xf0, 0xfb, 0xff, 0x13, 0x12, 0xef, 0xfb, 0xff, 0x11, 0xee, 0xfb, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x0f, 
+  0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 
+  0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0xa8, 0x00, 
+  0xd5, 0xff, 0x04, 0x94, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0c, 0xff, 0xff, 0x08, 0x02, 0xde, 0xfe, 0xec, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 
+  0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 
+  0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x10, 0xed, 0xfb, 0xff, 0x81, 0x11, 0xee, 0xfb, 0xff, 0x82, 0x11, 0xef, 0xfb, 0xff, 0x00, 0x11, 0xee, 0xfb, 0xff, 
+  0x81, 0x10, 0xed, 0xfb, 0xff, 0x0f, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe3, 
+  0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdd, 
+  0xfe, 0xfc, 0x07, 0xf2, 0xff, 0x24, 0x94, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xec, 0xff, 0x27, 0x02, 0xe6, 0xfe, 0xec, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 
+  0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0f, 0xec, 0xfc, 0xff, 0x00, 0x10, 0xed, 0xfb, 0xff, 0x84, 0x11, 0xee, 0xfb, 0xff, 0x12, 
+  0x10, 0xed, 0xfb, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x01, 0xe5, 0xfd, 0xff, 
+  0x00, 0xe3, 0xfc, 0xff, 0x2a, 0xe1, 0xf4, 0xff, 0x54, 0xdf, 0xef, 0xff, 0x6c, 0xde, 0xed, 0xff, 0x70, 0xdd, 0xec, 0xff, 0x5c, 0xdc, 0xee, 0xff, 0x38, 0xdb, 0xf2, 0xff, 0x00, 0xdb, 0xfb, 0xff, 
+  0x00, 0xd8, 0xff, 0xff, 0x03, 0xe3, 0xfe, 0xf8, 0x02, 0xec, 0xfd, 0x38, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xeb, 0xff, 0x13, 0x00, 0xe2, 0xfe, 0xe7, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 
+  0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x0c, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 
+  0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0f, 0xec, 0xfc, 
+  0xff, 0x00, 0x10, 0xec, 0xfc, 0xff, 0x82, 0x10, 0xed, 0xfb, 0xff, 0x14, 0x10, 0xec, 0xfc, 0xff, 0x0f, 0xec, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 
+  0x0c, 0xe8, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x3b, 0xe1, 0xe1, 0xff, 0xb9, 0xd8, 0xaf, 0xff, 0xe1, 0xc9, 0x81, 0xff, 0xe5, 0xc1, 0x6a, 0xff, 0xec, 0xbb, 0x59, 0xff, 
+  0xed, 0xba, 0x57, 0xff, 0xe8, 0xbf, 0x64, 0xff, 0xe1, 0xc6, 0x79, 0xff, 0xd3, 0xd1, 0x9c, 0xff, 0x63, 0xd8, 0xd2, 0xff, 0x00, 0xd8, 0xfc, 0xff, 0x00, 0xdf, 0xff, 0xfc, 0x01, 0xed, 0xff, 0x30, 
+  0x93, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xd9, 0xff, 0x47, 0x01, 0xd9, 0xfe, 0xb7, 0x01, 0xda, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 
+  0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 
+  0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x81, 0x0e, 0xea, 0xfc, 0xff, 0x00, 0x0f, 0xeb, 0xfc, 0xff, 0x84, 0x0f, 0xec, 0xfc, 0xff, 0x01, 0x0e, 0xeb, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0d, 
+  0xe9, 0xfc, 0xff, 0x0e, 0x08, 0xe7, 0xfd, 0xff, 0x23, 0xe5, 0xf3, 0xff, 0x9a, 0xda, 0xb6, 0xff, 0xee, 0xc3, 0x62, 0xff, 0xef, 0xb4, 0x47, 0xff, 0xea, 0xb0, 0x43, 0xff, 0xeb, 0xb1, 0x45, 0xff, 
+  0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb1, 0x47, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb0, 0x44, 0xff, 0xeb, 0xb0, 0x43, 0xff, 0xf6, 0xbd, 0x53, 0xff, 0xdb, 0xce, 0x80, 0xd7, 0xff, 0xcf, 0x06, 0x23, 
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xe7, 0xff, 0x27, 0x01, 0xdb, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 
+  0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 
+  0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x85, 0x0e, 0xea, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 0xff, 0x05, 0x0c, 0xe8, 0xfc, 0xff, 0x09, 0xe7, 0xfd, 0xff, 0x00, 0xe6, 0xf0, 
+  0xff, 0xcb, 0xd0, 0x90, 0xff, 0xed, 0xb7, 0x4c, 0xff, 0xeb, 0xb2, 0x45, 0xff, 0x87, 0xeb, 0xb2, 0x46, 0xff, 0x07, 0xeb, 0xb1, 0x45, 0xff, 0xec, 0xb4, 0x49, 0xff, 0xf0, 0xc4, 0x67, 0xf3, 0xf6, 
+  0xda, 0x8f, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xd0, 0x99, 0x08, 0xfe, 0xd6, 0x8c, 0x0c, 0xf8, 0xd7, 0x91, 0x07, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xfb, 0xfb, 0x08, 0x00, 0xe4, 0xfe, 
+  0xeb, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 
+  0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x86, 0x0d, 
+  0xe9, 0xfc, 0xff, 0x04, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x19, 0xe6, 0xf6, 0xff, 0xc6, 0xd1, 0x93, 0xff, 0xee, 0xb3, 0x40, 0xff, 0x8b, 0xeb, 0xb3, 0x45, 0xff, 0x08, 0xea, 0xb1, 
+  0x41, 0xff, 0xef, 0xc3, 0x62, 0xfc, 0xf3, 0xcf, 0x7a, 0xdb, 0xf2, 0xcd, 0x75, 0xff, 0xf2, 0xcc, 0x74, 0xff, 0xf2, 0xcd, 0x76, 0xfc, 0xf4, 0xcf, 0x7a, 0xcc, 0xf4, 0xd2, 0x7f, 0x78, 0xf5, 0xd9, 
+  0x89, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf5, 0xff, 0x08, 0x00, 0xe4, 0xfe, 0xd4, 0x00, 0xd8, 0xfe, 0xff, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x0b, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 
+  0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 
+  0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x81, 0x0c, 0xe7, 0xfc, 0xff, 0x82, 0x0c, 0xe8, 0xfc, 0xff, 0x05, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 
+  0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x89, 0xda, 0xbe, 0xff, 0xed, 0xb7, 0x48, 0xff, 0x8e, 0xec, 0xb4, 0x44, 0xff, 0x07, 0xec, 0xb5, 0x47, 0xff, 0xec, 0xb3, 0x43, 0xff, 
+  0xec, 0xb3, 0x42, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb6, 0x48, 0xff, 0xed, 0xba, 0x51, 0xff, 0xf1, 0xc7, 0x69, 0xef, 0xf4, 0xd6, 0x84, 0x70, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xd7, 
+  0xff, 0x23, 0x00, 0xd6, 0xff, 0x3f, 0x02, 0xd9, 0xfd, 0x9c, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x01, 
+  0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x03, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x81, 0x0b, 
+  0xe6, 0xfc, 0xff, 0x82, 0x0b, 0xe7, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x03, 0x06, 0xe6, 0xfd, 0xff, 0x00, 0xe4, 0xed, 0xff, 0xe3, 0xc2, 0x55, 0xff, 0xec, 0xb4, 0x41, 0xff, 0x94, 0xec, 
+  0xb5, 0x43, 0xff, 0x02, 0xeb, 0xb3, 0x3e, 0xff, 0xef, 0xc0, 0x58, 0xff, 0xf3, 0xd2, 0x79, 0x80, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xe3, 0xfe, 0xc8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 
+  0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x08, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 
+  0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x83, 0x0a, 0xe5, 0xfc, 0xff, 0x00, 0x05, 0xe5, 0xfd, 0xff, 0x81, 0x00, 
+  0xe5, 0xff, 0xff, 0x01, 0x92, 0xd7, 0xb7, 0xff, 0xf0, 0xb4, 0x35, 0xff, 0x97, 0xec, 0xb6, 0x41, 0xff, 0x01, 0xee, 0xbd, 0x51, 0xff, 0xf5, 0xd6, 0x7d, 0x6b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0xef, 0xff, 0x44, 0x00, 0xda, 0xfe, 0xff, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x05, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdd, 
+  0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x01, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 
+  0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x02, 0xe4, 0xfd, 0xff, 0x03, 0xe4, 0xf8, 0xff, 0x6a, 0xe0, 0xde, 0xff, 0x9c, 0xda, 0xb1, 0xff, 0xbc, 0xd7, 0x95, 0xff, 0xe7, 0xc3, 0x5c, 0xff, 0xec, 0xb7, 
+  0x40, 0xff, 0x97, 0xec, 0xb7, 0x41, 0xff, 0x02, 0xec, 0xb6, 0x3f, 0xff, 0xef, 0xc2, 0x58, 0xec, 0xf5, 0xd7, 0x81, 0x18, 0x89, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xff, 0xff, 0x03, 0x00, 0xdf, 
+  0xfe, 0xb8, 0x00, 0xd7, 0xfe, 0xc7, 0x01, 0xd9, 0xfd, 0xbb, 0x00, 0xd9, 0xff, 0xab, 0x02, 0xda, 0xfe, 0xf8, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 
+  0xdd, 0xfd, 0xff, 0x01, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0b, 
+  0xe2, 0xfe, 0xff, 0x29, 0xe2, 0xef, 0xff, 0xcc, 0xd5, 0x94, 0xff, 0xea, 0xc2, 0x54, 0xff, 0xef, 0xbb, 0x42, 0xff, 0xee, 0xba, 0x40, 0xff, 0x9a, 0xec, 0xb8, 0x3f, 0xff, 0x01, 0xec, 0xba, 0x43, 
+  0xff, 0xf2, 0xcf, 0x6d, 0x63, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x02, 0xe0, 0xfe, 0x34, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 
+  0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0x07, 0xe1, 0xfd, 
+  0xff, 0x02, 0xe1, 0xfd, 0xff, 0x16, 0xe0, 0xf0, 0xff, 0xd2, 0xd0, 0x76, 0xff, 0xee, 0xba, 0x3a, 0xff, 0xec, 0xb9, 0x3d, 0xff, 0x9c, 0xec, 0xb9, 0x3e, 0xff, 0x01, 0xec, 0xb9, 0x3d, 0xff, 0xf0, 
+  0xc7, 0x5d, 0xaf, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x8c, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x02, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x03, 0x05, 0xdf, 0xfd, 0xff, 0x00, 0xdf, 0xfa, 0xff, 0xbc, 0xd3, 0x98, 0xff, 
+  0xf0, 0xbb, 0x35, 0xff, 0x9f, 0xed, 0xbb, 0x3c, 0xff, 0x00, 0xef, 0xc3, 0x4c, 0xe0, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xdf, 0xfe, 0xe4, 0x00, 0xd8, 0xfe, 0xe3, 0x01, 0xd9, 0xfe, 0xc0, 
+  0x01, 0xd9, 0xfe, 0xbc, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0x04, 0xde, 0xfd, 0xff, 0x05, 
+  0xde, 0xfd, 0xff, 0x49, 0xdc, 0xed, 0xff, 0xe4, 0xc1, 0x50, 0xff, 0xa0, 0xed, 0xbb, 0x3b, 0xff, 0x00, 0xee, 0xbe, 0x40, 0xf7, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xdb, 0xfe, 0x2c, 0x00, 
+  0xd8, 0xfe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xde, 0xfe, 0x88, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdb, 
+  0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0x04, 0xdc, 0xfd, 0xff, 0x6d, 0xd8, 0xe7, 0xff, 0xed, 0xbe, 0x30, 0xff, 0xa0, 0xed, 0xbd, 0x39, 0xff, 0x00, 0xed, 0xbe, 0x3c, 0xe0, 0x90, 0x00, 
+  0x00, 0x00, 0x00, 0x04, 0x00, 0xdd, 0xfe, 0xa0, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xcc, 0x02, 0xda, 0xfe, 0xfb, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x02, 0xdb, 
+  0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0x03, 0xdc, 0xfd, 0xff, 0x74, 0xd6, 0xe6, 0xff, 0xf0, 0xbe, 0x23, 0xff, 0x9f, 0xed, 0xbe, 0x38, 0xff, 0x01, 0xed, 0xbe, 0x37, 0xff, 0xef, 0xc3, 
+  0x43, 0xb0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xdb, 0xfe, 0xc3, 0x00, 0xd8, 0xfd, 0x97, 0x01, 0xd9, 0xfd, 0x23, 0x02, 0xde, 0xfd, 0x18, 0x01, 0xda, 0xfe, 0xec, 0x82, 0x01, 0xd9, 0xfe, 
+  0xff, 0x82, 0x02, 0xda, 0xfe, 0xff, 0x01, 0x71, 0xd5, 0xe7, 0xff, 0xee, 0xbe, 0x23, 0xff, 0xa0, 0xed, 0xbf, 0x37, 0xff, 0x00, 0xf0, 0xc6, 0x4a, 0x63, 0x93, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
+  0xe4, 0xff, 0x10, 0x00, 0xd9, 0xfe, 0xe3, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xab, 0x00, 0xd9, 0xff, 0x5b, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0x01, 0xda, 0xfe, 0xfb, 0x58, 0xd6, 0xe8, 
+  0xef, 0xe5, 0xc1, 0x36, 0xff, 0x9f, 0xed, 0xc0, 0x36, 0xff, 0x01, 0xed, 0xc1, 0x37, 0xe7, 0xf1, 0xcc, 0x3d, 0x17, 0x93, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf5, 0xff, 0x04, 0x00, 0xd9, 0xfe, 
+  0xe0, 0x00, 0xd8, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xfd, 0x20, 0x00, 0xd9, 0xfe, 0xf3, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0x60, 0x1c, 0xda, 0xdf, 0x4f, 0xcf, 0xc6, 0x6a, 
+  0xff, 0x9f, 0xee, 0xc1, 0x34, 0xff, 0x00, 0xee, 0xc3, 0x3b, 0x68, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf3, 0xff, 0x04, 0x00, 
+  0xd8, 0xfe, 0xd7, 0x00, 0xd8, 0xfe, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0x0b, 0x58, 0xd2, 0xb6, 0xd7, 0xea, 0xc2, 0x2d, 0xff, 0xee, 0xc2, 0x33, 0xff, 0x9b, 0xee, 0xc2, 0x34, 0xff, 
+  0x01, 0xee, 0xc2, 0x34, 0xfc, 0xed, 0xc2, 0x35, 0x8c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xfe, 0x37, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xdc, 0xff, 0x47, 0x95, 0xcf, 0xaa, 
+  0xa3, 0xef, 0xc3, 0x2c, 0xf7, 0x9a, 0xee, 0xc3, 0x32, 0xff, 0x02, 0xee, 0xc3, 0x32, 0xf7, 0xef, 0xc5, 0x36, 0x67, 0xf5, 0xd6, 0x4c, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0xc4, 0x39, 
+  0x2f, 0xee, 0xc3, 0x33, 0xb8, 0xee, 0xc3, 0x32, 0xef, 0xee, 0xc3, 0x32, 0xfc, 0x94, 0xee, 0xc3, 0x32, 0xff, 0x03, 0xee, 0xc3, 0x32, 0xf7, 0xee, 0xc3, 0x32, 0xe3, 0xee, 0xc3, 0x33, 0x9c, 0xf2, 
+  0xc7, 0x3f, 0x1f, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x02, 0xef, 0xc9, 0x41, 0x08, 0xef, 0xc5, 0x32, 0x1f, 0xee, 0xc4, 0x32, 0x2b, 0x94, 0xee, 0xc4, 0x31, 0x2f, 0x02, 0xef, 0xc3, 0x31, 0x27, 0xed, 
+  0xc4, 0x33, 0x17, 0xf4, 0xd0, 0x4a, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +416,7 @@ const lv_img_dsc_t owm_02d_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_02d_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_02d_64px_map,
 };
-
@@ -10,271 +10,352 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_02N_64PX uint8_t owm_02n_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x0c, 0xdb, 0x1c, 0xdb, 0x27, 0xdb, 0x2f, 0xdb, 0x33, 0xdb, 0x30, 0xdb, 0x2b, 0xdb, 0x20, 0xdb, 0x13, 0xdb, 0x03, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x54, 0xdb, 0xa8, 0xdb, 0xe0, 0xdb, 0xec, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xfb, 0xdb, 0xf0, 0xdb, 0xe4, 0xdb, 0xcb, 0xdb, 0x70, 0xdb, 0x1b, 0xdb, 0x00, 0xb7, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x17, 0xdb, 0x74, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9c, 0xdb, 0x28, 0xb7, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xb6, 0x00, 0xdb, 0x67, 0xdb, 0xec, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf3, 0xdb, 0x97, 0xdb, 0x18, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x0c, 0xdb, 0xab, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd8, 0xdb, 0x33, 0x6d, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x28, 0xdb, 0xd7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf7, 0xdb, 0x60, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x28, 0xdb, 0xd8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xfb, 0xdb, 0x5b, 0xdb, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x0c, 0xdb, 0xd7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xfb, 0xdb, 0x4c, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0xab, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf0, 0xdb, 0x23, 0xdb, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x67, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xab, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x17, 0xdb, 0xec, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x57, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x74, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd3, 0xb7, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0x33, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x54, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9b, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0xa8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xeb, 0xdb, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0x38, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1c, 0xdb, 0xec, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xb7, 0x6f, 0xb7, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x27, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x57, 0xff, 0x77, 0xc7, 0x17, 0x14, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x37, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x37, 0xef, 0x37, 0x5c, 0x3b, 0x03, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xfc, 0x37, 0x8b, 0x37, 0x00, 0x5b, 0x07, 0x37, 0x0c, 0x37, 0x0b, 0x83, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x30, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xdb, 0x37, 0xf7, 0x37, 0xff, 0x37, 0xff, 0x37, 0xdf, 0x37, 0x98, 0x37, 0x37, 0x3b, 0x04, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2b, 0xdb, 0xfb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xf7, 0x37, 0xa7, 0x3b, 0x10, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x20, 0xdb, 0xf0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc7, 0x37, 0x17, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x13, 0xdb, 0xe4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xac, 0x37, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x03, 0xdb, 0xcb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x5c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x70, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xcc, 0x3b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x1b, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x9c, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x28, 0xdb, 0xf3, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x6d, 0x00, 0xdb, 0x97, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x18, 0xdb, 0xd8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x33, 0xdb, 0xf7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x37, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x60, 0xdb, 0xfb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xb7, 0x00, 0xdb, 0x5b, 0xdb, 0xfb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xaf, 0x0a, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x4c, 0xdb, 0xf0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x37, 0x18, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x23, 0xdb, 0xab, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x9c, 0x37, 0x13, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x57, 0xdb, 0xd3, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x77, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0xec, 0x13, 0xbc, 0x13, 0x47, 0x13, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0xff, 0x00, 0xdb, 0x00, 0xdb, 0x0c, 0xdb, 0x33, 0xdb, 0x9b, 0xdb, 0xeb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xb7, 0x97, 0x5f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x28, 0x13, 0x1c, 0x37, 0x0b, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x38, 0xdb, 0x6f, 0xdb, 0x9b, 0xdb, 0xb8, 0xdb, 0xcb, 0xdb, 0xc0, 0xdb, 0xa7, 0xdb, 0x7f, 0xb7, 0x4c, 0xb7, 0x0f, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xb7, 0x00, 0xb7, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x92, 0x00, 0x00, 0x09, 0xdb, 0x0c, 0xdb, 0x1c, 0xdb, 0x27, 
+  0xdb, 0x2f, 0xdb, 0x33, 0xdb, 0x30, 0xdb, 0x2b, 0xdb, 0x20, 0xdb, 0x13, 0xdb, 0x03, 0xb3, 0x00, 0x00, 0x04, 0xdb, 0x54, 0xdb, 0xa8, 0xdb, 0xe0, 0xdb, 0xec, 0xdb, 0xf8, 0x82, 0xdb, 0xff, 0x05, 
+  0xdb, 0xfb, 0xdb, 0xf0, 0xdb, 0xe4, 0xdb, 0xcb, 0xdb, 0x70, 0xdb, 0x1b, 0xae, 0x00, 0x00, 0x02, 0xdb, 0x17, 0xdb, 0x74, 0xdb, 0xe0, 0x8d, 0xdb, 0xff, 0x01, 0xdb, 0x9c, 0xdb, 0x28, 0xab, 0x00, 
+  0x00, 0x01, 0xdb, 0x67, 0xdb, 0xec, 0x90, 0xdb, 0xff, 0x02, 0xdb, 0xf3, 0xdb, 0x97, 0xdb, 0x18, 0xa7, 0x00, 0x00, 0x01, 0xdb, 0x0c, 0xdb, 0xab, 0x94, 0xdb, 0xff, 0x01, 0xdb, 0xd8, 0xdb, 0x33, 
+  0xa5, 0x00, 0x00, 0x01, 0xdb, 0x28, 0xdb, 0xd7, 0x96, 0xdb, 0xff, 0x01, 0xdb, 0xf7, 0xdb, 0x60, 0xa3, 0x00, 0x00, 0x01, 0xdb, 0x28, 0xdb, 0xd8, 0x98, 0xdb, 0xff, 0x01, 0xdb, 0xfb, 0xdb, 0x5b, 
+  0xa1, 0x00, 0x00, 0x01, 0xdb, 0x0c, 0xdb, 0xd7, 0x9a, 0xdb, 0xff, 0x01, 0xdb, 0xfb, 0xdb, 0x4c, 0xa0, 0x00, 0x00, 0x00, 0xdb, 0xab, 0x9c, 0xdb, 0xff, 0x01, 0xdb, 0xf0, 0xdb, 0x23, 0x9e, 0x00, 
+  0x00, 0x00, 0xdb, 0x67, 0x8b, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x91, 0xdb, 0xff, 0x00, 0xdb, 0xab, 0x9d, 0x00, 0x00, 0x01, 0xdb, 0x17, 0xdb, 0xec, 0x8b, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x8e, 0xdb, 
+  0xff, 0x00, 0xdb, 0x57, 0x9c, 0x00, 0x00, 0x00, 0xdb, 0x74, 0x8c, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x8d, 0xdb, 0xff, 0x01, 0xdb, 0xd3, 0xb7, 0x0c, 0x9b, 0x00, 0x00, 0x00, 0xdb, 0xe0, 0x8c, 0xdb, 
+  0xff, 0x86, 0xff, 0xff, 0x8c, 0xdb, 0xff, 0x01, 0xdb, 0xf8, 0xdb, 0x33, 0x9a, 0x00, 0x00, 0x00, 0xdb, 0x54, 0x85, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x86, 0xdb, 0xff, 0x87, 0xff, 0xff, 0x8c, 0xdb, 
+  0xff, 0x00, 0xdb, 0x9b, 0x9a, 0x00, 0x00, 0x00, 0xdb, 0xa8, 0x85, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x85, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x8b, 0xdb, 0xff, 0x00, 0xdb, 0xeb, 0x99, 0x00, 0x00, 0x01, 
+  0xdb, 0x0c, 0xdb, 0xe0, 0x85, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x82, 0xdb, 0xff, 0x8a, 0xff, 0xff, 0x8c, 0xdb, 0xff, 0x00, 0xb7, 0x38, 0x98, 0x00, 0x00, 0x01, 0xdb, 0x1c, 0xdb, 0xec, 0x84, 0xdb, 
+  0xff, 0x91, 0xff, 0xff, 0x86, 0xdb, 0xff, 0x85, 0xbb, 0xff, 0x00, 0xb7, 0x6f, 0x98, 0x00, 0x00, 0x01, 0xdb, 0x27, 0xdb, 0xf8, 0x84, 0xdb, 0xff, 0x91, 0xff, 0xff, 0x84, 0xdb, 0xff, 0x02, 0x9b, 
+  0xff, 0x57, 0xff, 0x33, 0xff, 0x82, 0x13, 0xff, 0x03, 0x33, 0xff, 0x57, 0xff, 0x77, 0xc7, 0x17, 0x14, 0x97, 0x00, 0x00, 0x00, 0xdb, 0x2f, 0x85, 0xdb, 0xff, 0x91, 0xff, 0xff, 0x82, 0xdb, 0xff, 
+  0x02, 0xbb, 0xff, 0x37, 0xff, 0x13, 0xff, 0x81, 0x0f, 0xff, 0x81, 0x13, 0xff, 0x82, 0x0f, 0xff, 0x03, 0x13, 0xff, 0x37, 0xef, 0x37, 0x5c, 0x3b, 0x03, 0x95, 0x00, 0x00, 0x00, 0xdb, 0x33, 0x85, 
+  0xdb, 0xff, 0x8f, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x00, 0x7b, 0xff, 0x8b, 0x13, 0xff, 0x05, 0x33, 0xfc, 0x37, 0x8b, 0x00, 0x00, 0x5b, 0x07, 0x37, 0x0c, 0x37, 0x0b, 0x91, 0x00, 0x00, 0x00, 0xdb, 
+  0x30, 0x85, 0xdb, 0xff, 0x8e, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x00, 0x9b, 0xff, 0x8e, 0x13, 0xff, 0x01, 0x37, 0xdb, 0x37, 0xf7, 0x81, 0x37, 0xff, 0x03, 0x37, 0xdf, 0x37, 0x98, 0x37, 0x37, 0x3b, 
+  0x04, 0x8d, 0x00, 0x00, 0x01, 0xdb, 0x2b, 0xdb, 0xfb, 0x85, 0xdb, 0xff, 0x8d, 0xff, 0xff, 0x82, 0xdb, 0xff, 0x00, 0xbb, 0xff, 0x95, 0x13, 0xff, 0x02, 0x33, 0xf7, 0x37, 0xa7, 0x3b, 0x10, 0x8c, 
+  0x00, 0x00, 0x01, 0xdb, 0x20, 0xdb, 0xf0, 0x86, 0xdb, 0xff, 0x8b, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x00, 0x77, 0xff, 0x97, 0x13, 0xff, 0x01, 0x37, 0xc7, 0x37, 0x17, 
+  0x8b, 0x00, 0x00, 0x01, 0xdb, 0x13, 0xdb, 0xe4, 0x87, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x01, 0xdb, 0xff, 0x33, 0xff, 0x98, 0x13, 0xff, 0x00, 0x37, 
+  0xac, 0x8b, 0x00, 0x00, 0x01, 0xdb, 0x03, 0xdb, 0xcb, 0x88, 0xdb, 0xff, 0x87, 0xff, 0xff, 0x82, 0xdb, 0xff, 0x02, 0x9b, 0xff, 0x5b, 0xff, 0x37, 0xff, 0x9a, 0x13, 0xff, 0x00, 0x37, 0x5c, 0x8b, 
+  0x00, 0x00, 0x00, 0xdb, 0x70, 0x89, 0xdb, 0xff, 0x86, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x9d, 0x13, 0xff, 0x01, 0x33, 0xcc, 0x3b, 0x08, 0x8a, 0x00, 0x00, 0x00, 0xdb, 0x1b, 
+  0x8b, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x01, 0xdb, 0xff, 0x7b, 0xff, 0x9f, 0x13, 0xff, 0x01, 0x13, 0xef, 0x37, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0xdb, 0x9c, 0x8e, 0xdb, 0xff, 0x00, 0xbb, 0xff, 0xa0, 
+  0x13, 0xff, 0x01, 0x13, 0xfc, 0x37, 0x2b, 0x8b, 0x00, 0x00, 0x01, 0xdb, 0x28, 0xdb, 0xf3, 0x8c, 0xdb, 0xff, 0x01, 0xfb, 0xff, 0x57, 0xff, 0xa1, 0x13, 0xff, 0x00, 0x13, 0x30, 0x8c, 0x00, 0x00, 
+  0x00, 0xdb, 0x97, 0x8d, 0xdb, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xfc, 0x13, 0x2b, 0x8c, 0x00, 0x00, 0x01, 0xdb, 0x18, 0xdb, 0xd8, 0x8c, 0xdb, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xef, 0x37, 
+  0x1c, 0x8d, 0x00, 0x00, 0x01, 0xdb, 0x33, 0xdb, 0xf7, 0x8b, 0xdb, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xcf, 0x37, 0x08, 0x8e, 0x00, 0x00, 0x01, 0xdb, 0x60, 0xdb, 0xfb, 0x8a, 0xdb, 0xff, 0x00, 
+  0x17, 0xff, 0xa0, 0x13, 0xff, 0x00, 0x33, 0x5f, 0x90, 0x00, 0x00, 0x01, 0xdb, 0x5b, 0xdb, 0xfb, 0x89, 0xdb, 0xff, 0x00, 0x97, 0xff, 0x9f, 0x13, 0xff, 0x00, 0x13, 0xaf, 0x92, 0x00, 0x00, 0x01, 
+  0xdb, 0x4c, 0xdb, 0xf0, 0x89, 0xdb, 0xff, 0x00, 0x57, 0xff, 0x9d, 0x13, 0xff, 0x01, 0x13, 0xcf, 0x37, 0x18, 0x93, 0x00, 0x00, 0x01, 0xdb, 0x23, 0xdb, 0xab, 0x88, 0xdb, 0xff, 0x01, 0xbb, 0xff, 
+  0x17, 0xff, 0x9b, 0x13, 0xff, 0x01, 0x13, 0x9c, 0x37, 0x13, 0x96, 0x00, 0x00, 0x02, 0xdb, 0x57, 0xdb, 0xd3, 0xdb, 0xf8, 0x86, 0xdb, 0xff, 0x02, 0xbb, 0xff, 0x77, 0xff, 0x37, 0xff, 0x95, 0x13, 
+  0xff, 0x03, 0x13, 0xfb, 0x13, 0xec, 0x13, 0xbc, 0x13, 0x47, 0x99, 0x00, 0x00, 0x03, 0xdb, 0x0c, 0xdb, 0x33, 0xdb, 0x9b, 0xdb, 0xeb, 0x86, 0xdb, 0xff, 0x00, 0xbb, 0xff, 0x81, 0xb7, 0xff, 0x01, 
+  0xb7, 0xb7, 0x97, 0x5f, 0x91, 0x13, 0x2f, 0x02, 0x13, 0x28, 0x13, 0x1c, 0x37, 0x0b, 0x9e, 0x00, 0x00, 0x09, 0xdb, 0x38, 0xdb, 0x6f, 0xdb, 0x9b, 0xdb, 0xb8, 0xdb, 0xcb, 0xdb, 0xc0, 0xdb, 0xa7, 
+  0xdb, 0x7f, 0xb7, 0x4c, 0xb7, 0x0f, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe2, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0x18, 0xc6, 0x00, 0xd7, 0xbd, 0x0c, 0xd7, 0xbd, 0x1c, 0xf7, 0xbd, 0x27, 0xf7, 0xbd, 0x2f, 0xd7, 0xbd, 0x33, 0xd7, 0xbd, 0x30, 0xd7, 0xbd, 0x2b, 0xd7, 0xbd, 0x20, 0xd7, 0xbd, 0x13, 0xf8, 0xc5, 0x03, 0xd7, 0xbd, 0x00, 0xb7, 0xbd, 0x00, 0xb7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf8, 0xc5, 0x00, 0x18, 0xc6, 0x00, 0xf7, 0xbd, 0x54, 0xf8, 0xc5, 0xa8, 0xf8, 0xc5, 0xe0, 0xf7, 0xbd, 0xec, 0xf8, 0xc5, 0xf8, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xfb, 0xd7, 0xbd, 0xf0, 0xd7, 0xbd, 0xe4, 0xd7, 0xbd, 0xcb, 0xd7, 0xbd, 0x70, 0xb6, 0xb5, 0x1b, 0xb7, 0xbd, 0x00, 0x55, 0xad, 0x00, 0x76, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x00, 0x39, 0xce, 0x00, 0xf8, 0xc5, 0x17, 0xf8, 0xc5, 0x74, 0xf8, 0xc5, 0xe0, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0x9c, 0xb6, 0xb5, 0x28, 0x14, 0xa5, 0x00, 0x96, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x00, 0xb2, 0x94, 0x00, 0x18, 0xc6, 0x67, 0x18, 0xc6, 0xec, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xf3, 0xb7, 0xbd, 0x97, 0x96, 0xb5, 0x18, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0xf7, 0xbd, 0x00, 0x18, 0xc6, 0x0c, 0xf8, 0xc5, 0xab, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xd8, 0xb6, 0xb5, 0x33, 0xab, 0x5a, 0x00, 0xb7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x28, 0x18, 0xc6, 0xd7, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xf7, 0xb6, 0xb5, 0x60, 0xf7, 0xbd, 0x00, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0x18, 0xc6, 0x28, 0x18, 0xc6, 0xd8, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xfb, 0xb6, 0xb5, 0x5b, 0x18, 0xc6, 0x00, 0x34, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0xf8, 0xc5, 0x0c, 0x18, 0xc6, 0xd7, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xfb, 0x96, 0xb5, 0x4c, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0x79, 0xce, 0x00, 0x18, 0xc6, 0xab, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf0, 0x96, 0xb5, 0x23, 0x96, 0xb5, 0x00, 0xf4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x00, 0x18, 0xc6, 0x67, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xab, 0xb7, 0xbd, 0x00, 0x39, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0x18, 0xc6, 0x17, 0x18, 0xc6, 0xec, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x57, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x74, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xd3, 0x76, 0xb5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0xe0, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf8, 0x96, 0xb5, 0x33, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x54, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x9b, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x00, 0x18, 0xc6, 0xa8, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xeb, 0xb7, 0xbd, 0x00, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x0c, 0x18, 0xc6, 0xe0, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x38, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x1c, 0x18, 0xc6, 0xec, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xbe, 0xff, 0xf8, 0xb5, 0xff, 0xd8, 0xad, 0xff, 0xd8, 0xad, 0xff, 0xb8, 0xad, 0xff, 0xb7, 0xad, 0xff, 0xb7, 0xad, 0xff, 0x96, 0xb5, 0x6f, 0x77, 0x9d, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x27, 0x18, 0xc6, 0xf8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xb6, 0xff, 0xb9, 0x75, 0xff, 0x19, 0x45, 0xff, 0x97, 0x24, 0xff, 0x37, 0x04, 0xff, 0x16, 0x04, 0xff, 0x37, 0x04, 0xff, 0x77, 0x24, 0xff, 0xf8, 0x44, 0xff, 0x79, 0x5d, 0xc7, 0x9b, 0x05, 0x14, 0x5a, 0x25, 0x00, 0x5c, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x2f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xf9, 0x95, 0xff, 0xf8, 0x1c, 0xff, 0xd6, 0x03, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xd8, 0x1c, 0xef, 0x3a, 0x25, 0x5c, 0x3a, 0x26, 0x03, 0x5a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x5a, 0x1d, 0x00, 0x5a, 0x25, 0x00, 0x99, 0x1d, 0x00, 0x5b, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x33, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0xb9, 0x75, 0xff, 0x37, 0x04, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x37, 0x14, 0xfc, 0x3a, 0x25, 0x8b, 0x79, 0x25, 0x00, 0x1b, 0x36, 0x07, 0x7c, 0x1d, 0x0c, 0x7c, 0x2d, 0x0b, 0x1f, 0x70, 0x00, 0x7a, 0x25, 0x00, 0x3a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x30, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xd6, 0xff, 0xd9, 0x8d, 0xff, 0xf6, 0x03, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x19, 0x1d, 0xdb, 0xf9, 0x1c, 0xf7, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0x19, 0x1d, 0xdf, 0x39, 0x1d, 0x98, 0x5a, 0x25, 0x37, 0xdb, 0x2d, 0x04, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x2b, 0x18, 0xc6, 0xfb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x3a, 0xa6, 0xff, 0x57, 0x04, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 0xf7, 0x5a, 0x25, 0xa7, 0xda, 0x25, 0x10, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x20, 0xf8, 0xc5, 0xf0, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xce, 0xff, 0x18, 0x5d, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x24, 0xc7, 0x7a, 0x25, 0x17, 0x7a, 0x2d, 0x00, 0x5a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x13, 0x18, 0xc6, 0xe4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xc6, 0xff, 0x36, 0x14, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x25, 0xac, 0x78, 0x15, 0x00, 0x3c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x03, 0xf8, 0xc5, 0xcb, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xbe, 0xff, 0xfa, 0x7d, 0xff, 0x99, 0x4d, 0xff, 0x39, 0x2d, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xff, 0x7a, 0x25, 0x5c, 0x39, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x70, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xce, 0xff, 0xfa, 0x75, 0xff, 0xb8, 0x24, 0xff, 0x36, 0x04, 0xff, 0x16, 0x04, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x97, 0x14, 0xcc, 0x1c, 0x2e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x1b, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xce, 0xff, 0xba, 0x6d, 0xff, 0x36, 0x04, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x9c, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x3a, 0xa6, 0xff, 0x57, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x00, 0xf7, 0xbd, 0x28, 0xf7, 0xbd, 0xf3, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xd6, 0xff, 0x59, 0x35, 0xff, 0x16, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0x0c, 0x63, 0x00, 0xd7, 0xbd, 0x97, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xd6, 0xff, 0x77, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xfc, 0x56, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x00, 0xb6, 0xb5, 0x18, 0xf7, 0xbd, 0xd8, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x16, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0xef, 0xb7, 0x14, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x33, 0xd7, 0xbd, 0xf7, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xce, 0xff, 0x36, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xcf, 0x79, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x00, 0xd7, 0xbd, 0x60, 0xd7, 0xbd, 0xfb, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x97, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x97, 0x14, 0x5f, 0x97, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0x34, 0xa5, 0x00, 0xd7, 0xbd, 0x5b, 0xd7, 0xbd, 0xfb, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0x57, 0x75, 0xff, 0x56, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xaf, 0xb2, 0x01, 0x00, 0x38, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xb7, 0xbd, 0x4c, 0xd7, 0xbd, 0xf0, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xb5, 0xff, 0xb7, 0x34, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xcf, 0x17, 0x1d, 0x18, 0x79, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x23, 0xd7, 0xbd, 0xab, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xb7, 0xad, 0xff, 0xb7, 0x0c, 0xff, 0x76, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0x9c, 0xf7, 0x1c, 0x13, 0x55, 0x0c, 0x00, 0x98, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0xb7, 0xbd, 0x57, 0xd7, 0xbd, 0xd3, 0xd7, 0xbd, 0xf8, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xb5, 0xff, 0x17, 0x65, 0xff, 0xb7, 0x2c, 0xff, 0x97, 0x04, 0xff, 0x97, 0x04, 0xff, 0x97, 0x04, 0xff, 0x97, 0x0c, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xec, 0x97, 0x14, 0xbc, 0x97, 0x14, 0x47, 0x36, 0x04, 0x00, 0x17, 0x00, 0x00, 0xb7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x00, 0xbb, 0xde, 0x00, 0xd7, 0xbd, 0x00, 0xb6, 0xb5, 0x0c, 0xb7, 0xbd, 0x33, 0xb7, 0xbd, 0x9b, 0xb7, 0xbd, 0xeb, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xb5, 0xff, 0x96, 0xad, 0xff, 0x96, 0xad, 0xff, 0x76, 0xa5, 0xff, 0x56, 0x9d, 0xb7, 0x16, 0x85, 0x5f, 0x97, 0x04, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x28, 0x77, 0x14, 0x1c, 0xd7, 0x14, 0x0b, 0x14, 0x04, 0x00, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x00, 0xb7, 0xbd, 0x00, 0xb7, 0xbd, 0x00, 0x96, 0xb5, 0x38, 0xb6, 0xb5, 0x6f, 0xb6, 0xb5, 0x9b, 0xb6, 0xb5, 0xb8, 0xb6, 0xb5, 0xcb, 0xb6, 0xb5, 0xc0, 0xb6, 0xb5, 0xa7, 0x96, 0xb5, 0x7f, 0x96, 0xb5, 0x4c, 0x75, 0xad, 0x0f, 0x96, 0xb5, 0x00, 0x96, 0xb5, 0x00, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0x96, 0xb5, 0x00, 0x96, 0xb5, 0x00, 0x96, 0xb5, 0x00, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 
+  0x09, 0xd7, 0xbd, 0x0c, 0xd7, 0xbd, 0x1c, 0xf7, 0xbd, 0x27, 0xf7, 0xbd, 0x2f, 0xd7, 0xbd, 0x33, 0xd7, 0xbd, 0x30, 0xd7, 0xbd, 0x2b, 0xd7, 0xbd, 0x20, 0xd7, 0xbd, 0x13, 0xf8, 0xc5, 0x03, 0xb3, 
+  0x00, 0x00, 0x00, 0x04, 0xf7, 0xbd, 0x54, 0xf8, 0xc5, 0xa8, 0xf8, 0xc5, 0xe0, 0xf7, 0xbd, 0xec, 0xf8, 0xc5, 0xf8, 0x81, 0xf7, 0xbd, 0xff, 0x06, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xfb, 0xd7, 0xbd, 
+  0xf0, 0xd7, 0xbd, 0xe4, 0xd7, 0xbd, 0xcb, 0xd7, 0xbd, 0x70, 0xb6, 0xb5, 0x1b, 0xae, 0x00, 0x00, 0x00, 0x03, 0xf8, 0xc5, 0x17, 0xf8, 0xc5, 0x74, 0xf8, 0xc5, 0xe0, 0x18, 0xc6, 0xff, 0x82, 0xf8, 
+  0xc5, 0xff, 0x00, 0x18, 0xc6, 0xff, 0x83, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x82, 0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0x9c, 0xb6, 0xb5, 0x28, 0xab, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 
+  0x67, 0x18, 0xc6, 0xec, 0x84, 0x18, 0xc6, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x84, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xd7, 0xbd, 0xf3, 
+  0xb7, 0xbd, 0x97, 0x96, 0xb5, 0x18, 0xa7, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 0x0c, 0xf8, 0xc5, 0xab, 0x82, 0x18, 0xc6, 0xff, 0x82, 0x38, 0xc6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x83, 0x38, 0xc6, 
+  0xff, 0x84, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xd8, 0xb6, 0xb5, 0x33, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x18, 
+  0xc6, 0x28, 0x18, 0xc6, 0xd7, 0x81, 0x18, 0xc6, 0xff, 0x83, 0x39, 0xce, 0xff, 0x84, 0x59, 0xce, 0xff, 0x82, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 
+  0xff, 0x81, 0xf7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xf7, 0xb6, 0xb5, 0x60, 0xa3, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x28, 0x18, 0xc6, 0xd8, 0x18, 0xc6, 0xff, 
+  0x38, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x8a, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x03, 
+  0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xfb, 0xb6, 0xb5, 0x5b, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xf8, 0xc5, 0x0c, 0x18, 0xc6, 0xd7, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 
+  0x82, 0x59, 0xce, 0xff, 0x83, 0x79, 0xce, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x82, 0x79, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 
+  0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xfb, 0x96, 0xb5, 0x4c, 0xa0, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0xab, 0x18, 0xc6, 0xff, 
+  0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x82, 0x7a, 0xd6, 0xff, 0x00, 0x79, 0xce, 0xff, 0x82, 0x59, 
+  0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf0, 0x96, 
+  0xb5, 0x23, 0x9e, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x67, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x03, 0x39, 0xce, 0xff, 0x38, 
+  0xc6, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x84, 0x9a, 0xd6, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x00, 0x79, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 
+  0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xab, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x17, 0x18, 0xc6, 0xec, 
+  0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x07, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 
+  0x9a, 0xd6, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 
+  0xc6, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x57, 0x9c, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x74, 0x18, 0xc6, 0xff, 0x39, 
+  0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x03, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x84, 0x59, 0xce, 0xff, 0x00, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x81, 
+  0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 
+  0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xd3, 0x76, 0xb5, 0x0c, 0x9b, 0x00, 0x00, 0x00, 0x07, 0x18, 0xc6, 0xe0, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 
+  0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x82, 0x79, 0xce, 0xff, 0x00, 0x59, 0xce, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 
+  0x81, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x02, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 
+  0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf8, 0x96, 0xb5, 0x33, 0x9a, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x54, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x59, 0xce, 
+  0xff, 0x02, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x00, 0x59, 0xce, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x81, 
+  0xbb, 0xde, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x05, 0xf8, 
+  0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x9b, 0x9a, 0x00, 0x00, 0x00, 0x05, 0x18, 0xc6, 0xa8, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 
+  0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x01, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x01, 0x79, 0xce, 0xff, 0xba, 0xd6, 0xff, 0x83, 0xdb, 
+  0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x04, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 
+  0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xeb, 0x99, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0x0c, 0x18, 0xc6, 0xe0, 0x38, 
+  0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x03, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 
+  0xba, 0xd6, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x01, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x81, 0x59, 
+  0xce, 0xff, 0x04, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x38, 
+  0x98, 0x00, 0x00, 0x00, 0x02, 0xf8, 0xc5, 0x1c, 0x18, 0xc6, 0xec, 0x38, 0xc6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x01, 0xbb, 0xde, 0xff, 0xdb, 0xde, 
+  0xff, 0x81, 0xfb, 0xde, 0xff, 0x00, 0xfc, 0xe6, 0xff, 0x84, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 
+  0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x02, 0x38, 0xc6, 0xff, 0x18, 0xbe, 0xff, 0xf8, 0xb5, 0xff, 0x81, 0xd8, 0xad, 0xff, 0x00, 0xb8, 0xad, 0xff, 0x81, 0xb7, 0xad, 0xff, 0x00, 0x96, 0xb5, 
+  0x6f, 0x98, 0x00, 0x00, 0x00, 0x05, 0x18, 0xc6, 0x27, 0x18, 0xc6, 0xf8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0xba, 0xd6, 0xff, 
+  0xbb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x85, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x0d, 0x7a, 0xd6, 0xff, 0x79, 0xce, 
+  0xff, 0x59, 0xce, 0xff, 0x39, 0xb6, 0xff, 0xb9, 0x75, 0xff, 0x19, 0x45, 0xff, 0x97, 0x24, 0xff, 0x37, 0x04, 0xff, 0x16, 0x04, 0xff, 0x37, 0x04, 0xff, 0x77, 0x24, 0xff, 0xf8, 0x44, 0xff, 0x79, 
+  0x5d, 0xc7, 0x9b, 0x05, 0x14, 0x97, 0x00, 0x00, 0x00, 0x09, 0x18, 0xc6, 0x2f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 
+  0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x00, 0xfc, 0xe6, 0xff, 0x82, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xde, 0xff, 
+  0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x04, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xf9, 0x95, 0xff, 0xf8, 0x1c, 0xff, 0xd6, 0x03, 0xff, 0x85, 0x95, 0x0b, 0xff, 0x04, 0x75, 0x0b, 0xff, 0xf6, 
+  0x0b, 0xff, 0xd8, 0x1c, 0xef, 0x3a, 0x25, 0x5c, 0x3a, 0x26, 0x03, 0x95, 0x00, 0x00, 0x00, 0x09, 0x18, 0xc6, 0x33, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 
+  0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x83, 0xdb, 0xde, 0xff, 0x84, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x04, 0x7a, 
+  0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0xb9, 0x75, 0xff, 0x37, 0x04, 0xff, 0x8a, 0x95, 0x0b, 0xff, 0x05, 0x37, 0x14, 0xfc, 0x3a, 0x25, 0x8b, 0x00, 0x00, 0x00, 0x1b, 0x36, 0x07, 0x7c, 
+  0x1d, 0x0c, 0x7c, 0x2d, 0x0b, 0x91, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0x30, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 
+  0x9a, 0xd6, 0xff, 0x01, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x83, 0xdb, 0xde, 0xff, 0x82, 0xfb, 0xde, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x04, 0x7a, 
+  0xd6, 0xff, 0x79, 0xd6, 0xff, 0xd9, 0x8d, 0xff, 0xf6, 0x03, 0xff, 0x95, 0x0b, 0xff, 0x8a, 0xb5, 0x0b, 0xff, 0x03, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x19, 0x1d, 0xdb, 0xf9, 0x1c, 0xf7, 0x81, 
+  0xf9, 0x1c, 0xff, 0x03, 0x19, 0x1d, 0xdf, 0x39, 0x1d, 0x98, 0x5a, 0x25, 0x37, 0xdb, 0x2d, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x2b, 0x18, 0xc6, 0xfb, 0x38, 0xc6, 0xff, 0x39, 0xce, 
+  0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x87, 0xdb, 0xde, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 
+  0xff, 0x01, 0x3a, 0xa6, 0xff, 0x57, 0x04, 0xff, 0x8e, 0xb5, 0x0b, 0xff, 0x00, 0xd6, 0x0b, 0xff, 0x82, 0xb5, 0x0b, 0xff, 0x04, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 0xf7, 0x5a, 0x25, 
+  0xa7, 0xda, 0x25, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xbd, 0x20, 0xf8, 0xc5, 0xf0, 0x18, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x02, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 
+  0x81, 0x9a, 0xd6, 0xff, 0x01, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x86, 0xdb, 0xde, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xce, 0xff, 0x18, 0x5d, 0xff, 0x96, 0xb5, 
+  0x0b, 0xff, 0x02, 0xf6, 0x13, 0xff, 0xf9, 0x24, 0xc7, 0x7a, 0x25, 0x17, 0x8b, 0x00, 0x00, 0x00, 0x05, 0xf7, 0xbd, 0x13, 0x18, 0xc6, 0xe4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 
+  0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x86, 0xbb, 0xde, 0xff, 0x84, 0x9a, 0xd6, 0xff, 0x01, 0x59, 0xc6, 0xff, 0x36, 0x14, 0xff, 0x97, 0xd5, 
+  0x0b, 0xff, 0x01, 0xf6, 0x0b, 0xff, 0x19, 0x25, 0xac, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 0x03, 0xf8, 0xc5, 0xcb, 0x81, 0x18, 0xc6, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x82, 0x59, 0xce, 0xff, 
+  0x00, 0x7a, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x85, 0xba, 0xd6, 0xff, 0x06, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xbe, 0xff, 0xfa, 0x7d, 0xff, 0x99, 0x4d, 0xff, 0x39, 0x2d, 0xff, 0xf6, 
+  0x0b, 0xff, 0x98, 0xd6, 0x0b, 0xff, 0x01, 0x36, 0x14, 0xff, 0x7a, 0x25, 0x5c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x70, 0x81, 0x18, 0xc6, 0xff, 0x01, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 
+  0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x04, 0x7a, 0xce, 0xff, 0xfa, 0x75, 0xff, 0xb8, 
+  0x24, 0xff, 0x36, 0x04, 0xff, 0x16, 0x04, 0xff, 0x9a, 0xf6, 0x0b, 0xff, 0x02, 0xd6, 0x0b, 0xff, 0x97, 0x14, 0xcc, 0x1c, 0x2e, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xbd, 0x1b, 0xf8, 0xc5, 
+  0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x01, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x85, 0x9a, 0xd6, 0xff, 0x02, 0x9a, 0xce, 0xff, 0xba, 
+  0x6d, 0xff, 0x36, 0x04, 0xff, 0x9e, 0xf6, 0x0b, 0xff, 0x01, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xbd, 0x9c, 0xf8, 0xc5, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 
+  0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x82, 0x79, 0xce, 0xff, 0x82, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x3a, 0xa6, 0xff, 0x57, 0x04, 0xff, 0x9f, 0x16, 0x0c, 
+  0xff, 0x01, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xbd, 0x28, 0xf7, 0xbd, 0xf3, 0xf8, 0xc5, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0x38, 0xc6, 0xff, 0x39, 0xce, 
+  0xff, 0x83, 0x59, 0xce, 0xff, 0x83, 0x79, 0xce, 0xff, 0x02, 0x79, 0xd6, 0xff, 0x59, 0x35, 0xff, 0x16, 0x04, 0xff, 0x9f, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x30, 0x8c, 0x00, 
+  0x00, 0x00, 0x00, 0xd7, 0xbd, 0x97, 0x81, 0xf8, 0xc5, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x82, 0x39, 0xce, 0xff, 0x84, 0x59, 0xce, 0xff, 0x01, 0x79, 0xd6, 0xff, 0x77, 0x04, 
+  0xff, 0xa0, 0x36, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xfc, 0x56, 0x14, 0x2b, 0x8c, 0x00, 0x00, 0x00, 0x03, 0xb6, 0xb5, 0x18, 0xf7, 0xbd, 0xd8, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x82, 0x18, 0xc6, 
+  0xff, 0x81, 0x38, 0xc6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x02, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x16, 0x04, 0xff, 0xa0, 0x36, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xef, 0xb7, 
+  0x14, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xd7, 0xbd, 0x33, 0xd7, 0xbd, 0xf7, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x83, 0x18, 0xc6, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x04, 0x39, 0xce, 0xff, 0x18, 
+  0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xce, 0xff, 0x36, 0x04, 0xff, 0xa0, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xcf, 0x79, 0x25, 0x08, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xbd, 0x60, 0xd7, 0xbd, 
+  0xfb, 0x81, 0xf7, 0xbd, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x84, 0x18, 0xc6, 0xff, 0x03, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x18, 0xc6, 0xff, 0x97, 0x04, 0xff, 0xa0, 0x56, 0x0c, 0xff, 0x00, 0x97, 
+  0x14, 0x5f, 0x90, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xbd, 0x5b, 0xd7, 0xbd, 0xfb, 0xd7, 0xbd, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 
+  0x81, 0xd7, 0xbd, 0xff, 0x01, 0x57, 0x75, 0xff, 0x56, 0x04, 0xff, 0x9e, 0x76, 0x14, 0xff, 0x00, 0x77, 0x14, 0xaf, 0x92, 0x00, 0x00, 0x00, 0x01, 0xb7, 0xbd, 0x4c, 0xd7, 0xbd, 0xf0, 0x81, 0xd7, 
+  0xbd, 0xff, 0x82, 0xf7, 0xbd, 0xff, 0x83, 0xf8, 0xc5, 0xff, 0x02, 0xf8, 0xb5, 0xff, 0xb7, 0x34, 0xff, 0x76, 0x0c, 0xff, 0x9c, 0x76, 0x14, 0xff, 0x01, 0x77, 0x14, 0xcf, 0x17, 0x1d, 0x18, 0x93, 
+  0x00, 0x00, 0x00, 0x01, 0xd7, 0xbd, 0x23, 0xd7, 0xbd, 0xab, 0x87, 0xd7, 0xbd, 0xff, 0x03, 0xf7, 0xbd, 0xff, 0xb7, 0xad, 0xff, 0xb7, 0x0c, 0xff, 0x76, 0x04, 0xff, 0x9a, 0x76, 0x14, 0xff, 0x01, 
+  0x77, 0x14, 0x9c, 0xf7, 0x1c, 0x13, 0x96, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xbd, 0x57, 0xd7, 0xbd, 0xd3, 0xd7, 0xbd, 0xf8, 0x86, 0xd7, 0xbd, 0xff, 0x02, 0xd7, 0xb5, 0xff, 0x17, 0x65, 0xff, 0xb7, 
+  0x2c, 0xff, 0x82, 0x97, 0x04, 0xff, 0x00, 0x97, 0x0c, 0xff, 0x91, 0x97, 0x14, 0xff, 0x03, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xec, 0x97, 0x14, 0xbc, 0x97, 0x14, 0x47, 0x99, 0x00, 0x00, 0x00, 0x03, 
+  0xb6, 0xb5, 0x0c, 0xb7, 0xbd, 0x33, 0xb7, 0xbd, 0x9b, 0xb7, 0xbd, 0xeb, 0x85, 0xb7, 0xbd, 0xff, 0x00, 0xb7, 0xb5, 0xff, 0x81, 0x96, 0xad, 0xff, 0x03, 0x76, 0xa5, 0xff, 0x56, 0x9d, 0xb7, 0x16, 
+  0x85, 0x5f, 0x97, 0x04, 0x2f, 0x90, 0x97, 0x14, 0x2f, 0x02, 0x97, 0x14, 0x28, 0x77, 0x14, 0x1c, 0xd7, 0x14, 0x0b, 0x9e, 0x00, 0x00, 0x00, 0x09, 0x96, 0xb5, 0x38, 0xb6, 0xb5, 0x6f, 0xb6, 0xb5, 
+  0x9b, 0xb6, 0xb5, 0xb8, 0xb6, 0xb5, 0xcb, 0xb6, 0xb5, 0xc0, 0xb6, 0xb5, 0xa7, 0x96, 0xb5, 0x7f, 0x96, 0xb5, 0x4c, 0x75, 0xad, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x00, 0xc6, 0x18, 0x00, 0xbd, 0xd7, 0x0c, 0xbd, 0xd7, 0x1c, 0xbd, 0xf7, 0x27, 0xbd, 0xf7, 0x2f, 0xbd, 0xd7, 0x33, 0xbd, 0xd7, 0x30, 0xbd, 0xd7, 0x2b, 0xbd, 0xd7, 0x20, 0xbd, 0xd7, 0x13, 0xc5, 0xf8, 0x03, 0xbd, 0xd7, 0x00, 0xbd, 0xb7, 0x00, 0xbd, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xc5, 0xf8, 0x00, 0xc6, 0x18, 0x00, 0xbd, 0xf7, 0x54, 0xc5, 0xf8, 0xa8, 0xc5, 0xf8, 0xe0, 0xbd, 0xf7, 0xec, 0xc5, 0xf8, 0xf8, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xfb, 0xbd, 0xd7, 0xf0, 0xbd, 0xd7, 0xe4, 0xbd, 0xd7, 0xcb, 0xbd, 0xd7, 0x70, 0xb5, 0xb6, 0x1b, 0xbd, 0xb7, 0x00, 0xad, 0x55, 0x00, 0xb5, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x00, 0xce, 0x39, 0x00, 0xc5, 0xf8, 0x17, 0xc5, 0xf8, 0x74, 0xc5, 0xf8, 0xe0, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0x9c, 0xb5, 0xb6, 0x28, 0xa5, 0x14, 0x00, 0xb5, 0x96, 0x00, 0xb5, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x00, 0x94, 0xb2, 0x00, 0xc6, 0x18, 0x67, 0xc6, 0x18, 0xec, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xf3, 0xbd, 0xb7, 0x97, 0xb5, 0x96, 0x18, 0xb5, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xbd, 0xf7, 0x00, 0xc6, 0x18, 0x0c, 0xc5, 0xf8, 0xab, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xd8, 0xb5, 0xb6, 0x33, 0x5a, 0xab, 0x00, 0xbd, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x28, 0xc6, 0x18, 0xd7, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xf7, 0xb5, 0xb6, 0x60, 0xbd, 0xf7, 0x00, 0xb5, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xc6, 0x18, 0x28, 0xc6, 0x18, 0xd8, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xfb, 0xb5, 0xb6, 0x5b, 0xc6, 0x18, 0x00, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc5, 0xf8, 0x0c, 0xc6, 0x18, 0xd7, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xfb, 0xb5, 0x96, 0x4c, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xce, 0x79, 0x00, 0xc6, 0x18, 0xab, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf0, 0xb5, 0x96, 0x23, 0xb5, 0x96, 0x00, 0xa4, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x59, 0x00, 0xc6, 0x18, 0x67, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xab, 0xbd, 0xb7, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xc6, 0x18, 0x17, 0xc6, 0x18, 0xec, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x57, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x74, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xd3, 0xb5, 0x76, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0xe0, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf8, 0xb5, 0x96, 0x33, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x54, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x9b, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x38, 0x00, 0xc6, 0x18, 0xa8, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xeb, 0xbd, 0xb7, 0x00, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x0c, 0xc6, 0x18, 0xe0, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x38, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x1c, 0xc6, 0x18, 0xec, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xbe, 0x18, 0xff, 0xb5, 0xf8, 0xff, 0xad, 0xd8, 0xff, 0xad, 0xd8, 0xff, 0xad, 0xb8, 0xff, 0xad, 0xb7, 0xff, 0xad, 0xb7, 0xff, 0xb5, 0x96, 0x6f, 0x9d, 0x77, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x27, 0xc6, 0x18, 0xf8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xb6, 0x39, 0xff, 0x75, 0xb9, 0xff, 0x45, 0x19, 0xff, 0x24, 0x97, 0xff, 0x04, 0x37, 0xff, 0x04, 0x16, 0xff, 0x04, 0x37, 0xff, 0x24, 0x77, 0xff, 0x44, 0xf8, 0xff, 0x5d, 0x79, 0xc7, 0x05, 0x9b, 0x14, 0x25, 0x5a, 0x00, 0x2d, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x2f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0x95, 0xf9, 0xff, 0x1c, 0xf8, 0xff, 0x03, 0xd6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xd8, 0xef, 0x25, 0x3a, 0x5c, 0x26, 0x3a, 0x03, 0x25, 0x5a, 0x00, 0x25, 0x7a, 0x00, 0x1d, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x1d, 0x99, 0x00, 0x35, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x33, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0x75, 0xb9, 0xff, 0x04, 0x37, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x37, 0xfc, 0x25, 0x3a, 0x8b, 0x25, 0x79, 0x00, 0x36, 0x1b, 0x07, 0x1d, 0x7c, 0x0c, 0x2d, 0x7c, 0x0b, 0x70, 0x1f, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x3a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x30, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x79, 0xff, 0x8d, 0xd9, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x1d, 0x19, 0xdb, 0x1c, 0xf9, 0xf7, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1d, 0x19, 0xdf, 0x1d, 0x39, 0x98, 0x25, 0x5a, 0x37, 0x2d, 0xdb, 0x04, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x2b, 0xc6, 0x18, 0xfb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xa6, 0x3a, 0xff, 0x04, 0x57, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 0xf7, 0x25, 0x5a, 0xa7, 0x25, 0xda, 0x10, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x20, 0xc5, 0xf8, 0xf0, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x7a, 0xff, 0x5d, 0x18, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x24, 0xf9, 0xc7, 0x25, 0x7a, 0x17, 0x2d, 0x7a, 0x00, 0x2d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x13, 0xc6, 0x18, 0xe4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xc6, 0x59, 0xff, 0x14, 0x36, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x19, 0xac, 0x15, 0x78, 0x00, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x03, 0xc5, 0xf8, 0xcb, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xbe, 0x7a, 0xff, 0x7d, 0xfa, 0xff, 0x4d, 0x99, 0xff, 0x2d, 0x39, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xff, 0x25, 0x7a, 0x5c, 0x25, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x70, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x7a, 0xff, 0x75, 0xfa, 0xff, 0x24, 0xb8, 0xff, 0x04, 0x36, 0xff, 0x04, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x97, 0xcc, 0x2e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x1b, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x9a, 0xff, 0x6d, 0xba, 0xff, 0x04, 0x36, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x9c, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xa6, 0x3a, 0xff, 0x04, 0x57, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x00, 0xbd, 0xf7, 0x28, 0xbd, 0xf7, 0xf3, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x79, 0xff, 0x35, 0x59, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0x63, 0x0c, 0x00, 0xbd, 0xd7, 0x97, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x79, 0xff, 0x04, 0x77, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xfc, 0x14, 0x56, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x00, 0xb5, 0xb6, 0x18, 0xbd, 0xf7, 0xd8, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0xef, 0x14, 0xb7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x33, 0xbd, 0xd7, 0xf7, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xce, 0x18, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xcf, 0x25, 0x79, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x38, 0x00, 0xbd, 0xd7, 0x60, 0xbd, 0xd7, 0xfb, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0x04, 0x97, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x97, 0x5f, 0x1c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xa5, 0x34, 0x00, 0xbd, 0xd7, 0x5b, 0xbd, 0xd7, 0xfb, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0x75, 0x57, 0xff, 0x04, 0x56, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xaf, 0x01, 0xb2, 0x00, 0x1d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xb7, 0x4c, 0xbd, 0xd7, 0xf0, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xb5, 0xf8, 0xff, 0x34, 0xb7, 0xff, 0x0c, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xcf, 0x1d, 0x17, 0x18, 0x36, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x23, 0xbd, 0xd7, 0xab, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xad, 0xb7, 0xff, 0x0c, 0xb7, 0xff, 0x04, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0x9c, 0x1c, 0xf7, 0x13, 0x0c, 0x55, 0x00, 0x25, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xb7, 0x57, 0xbd, 0xd7, 0xd3, 0xbd, 0xd7, 0xf8, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xd7, 0xff, 0x65, 0x17, 0xff, 0x2c, 0xb7, 0xff, 0x04, 0x97, 0xff, 0x04, 0x97, 0xff, 0x04, 0x97, 0xff, 0x0c, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xec, 0x14, 0x97, 0xbc, 0x14, 0x97, 0x47, 0x04, 0x36, 0x00, 0x00, 0x17, 0x00, 0x25, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x00, 0xde, 0xbb, 0x00, 0xbd, 0xd7, 0x00, 0xb5, 0xb6, 0x0c, 0xbd, 0xb7, 0x33, 0xbd, 0xb7, 0x9b, 0xbd, 0xb7, 0xeb, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0xad, 0x96, 0xff, 0xad, 0x96, 0xff, 0xa5, 0x76, 0xff, 0x9d, 0x56, 0xb7, 0x85, 0x16, 0x5f, 0x04, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x28, 0x14, 0x77, 0x1c, 0x14, 0xd7, 0x0b, 0x04, 0x14, 0x00, 0x24, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x00, 0xbd, 0xb7, 0x00, 0xbd, 0xb7, 0x00, 0xb5, 0x96, 0x38, 0xb5, 0xb6, 0x6f, 0xb5, 0xb6, 0x9b, 0xb5, 0xb6, 0xb8, 0xb5, 0xb6, 0xcb, 0xb5, 0xb6, 0xc0, 0xb5, 0xb6, 0xa7, 0xb5, 0x96, 0x7f, 0xb5, 0x96, 0x4c, 0xad, 0x75, 0x0f, 0xb5, 0x96, 0x00, 0xb5, 0x96, 0x00, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0xb6, 0x00, 0xb5, 0x96, 0x00, 0xb5, 0x96, 0x00, 0xb5, 0x96, 0x00, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 
+  0x09, 0xbd, 0xd7, 0x0c, 0xbd, 0xd7, 0x1c, 0xbd, 0xf7, 0x27, 0xbd, 0xf7, 0x2f, 0xbd, 0xd7, 0x33, 0xbd, 0xd7, 0x30, 0xbd, 0xd7, 0x2b, 0xbd, 0xd7, 0x20, 0xbd, 0xd7, 0x13, 0xc5, 0xf8, 0x03, 0xb3, 
+  0x00, 0x00, 0x00, 0x04, 0xbd, 0xf7, 0x54, 0xc5, 0xf8, 0xa8, 0xc5, 0xf8, 0xe0, 0xbd, 0xf7, 0xec, 0xc5, 0xf8, 0xf8, 0x81, 0xbd, 0xf7, 0xff, 0x06, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xfb, 0xbd, 0xd7, 
+  0xf0, 0xbd, 0xd7, 0xe4, 0xbd, 0xd7, 0xcb, 0xbd, 0xd7, 0x70, 0xb5, 0xb6, 0x1b, 0xae, 0x00, 0x00, 0x00, 0x03, 0xc5, 0xf8, 0x17, 0xc5, 0xf8, 0x74, 0xc5, 0xf8, 0xe0, 0xc6, 0x18, 0xff, 0x82, 0xc5, 
+  0xf8, 0xff, 0x00, 0xc6, 0x18, 0xff, 0x83, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x82, 0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0x9c, 0xb5, 0xb6, 0x28, 0xab, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 
+  0x67, 0xc6, 0x18, 0xec, 0x84, 0xc6, 0x18, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x84, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xd7, 0xf3, 
+  0xbd, 0xb7, 0x97, 0xb5, 0x96, 0x18, 0xa7, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 0x0c, 0xc5, 0xf8, 0xab, 0x82, 0xc6, 0x18, 0xff, 0x82, 0xc6, 0x38, 0xff, 0x00, 0xce, 0x39, 0xff, 0x83, 0xc6, 0x38, 
+  0xff, 0x84, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x03, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xd8, 0xb5, 0xb6, 0x33, 0xa5, 0x00, 0x00, 0x00, 0x01, 0xc6, 
+  0x18, 0x28, 0xc6, 0x18, 0xd7, 0x81, 0xc6, 0x18, 0xff, 0x83, 0xce, 0x39, 0xff, 0x84, 0xce, 0x59, 0xff, 0x82, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 
+  0xff, 0x81, 0xbd, 0xf7, 0xff, 0x03, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xf7, 0xb5, 0xb6, 0x60, 0xa3, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x28, 0xc6, 0x18, 0xd8, 0xc6, 0x18, 0xff, 
+  0xc6, 0x38, 0xff, 0x81, 0xce, 0x39, 0xff, 0x8a, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x03, 
+  0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xfb, 0xb5, 0xb6, 0x5b, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xc5, 0xf8, 0x0c, 0xc6, 0x18, 0xd7, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 
+  0x82, 0xce, 0x59, 0xff, 0x83, 0xce, 0x79, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x82, 0xce, 0x79, 0xff, 0x82, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 
+  0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xfb, 0xb5, 0x96, 0x4c, 0xa0, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0xab, 0xc6, 0x18, 0xff, 
+  0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x82, 0xd6, 0x7a, 0xff, 0x00, 0xce, 0x79, 0xff, 0x82, 0xce, 
+  0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf0, 0xb5, 
+  0x96, 0x23, 0x9e, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x67, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x03, 0xce, 0x39, 0xff, 0xc6, 
+  0x38, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0x84, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x00, 0xce, 0x79, 0xff, 0x82, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 
+  0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xab, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x17, 0xc6, 0x18, 0xec, 
+  0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x07, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 
+  0xd6, 0x9a, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 
+  0x18, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x57, 0x9c, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x74, 0xc6, 0x18, 0xff, 0xce, 
+  0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x03, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0x84, 0xce, 0x59, 0xff, 0x00, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x81, 
+  0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x82, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 
+  0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xd3, 0xb5, 0x76, 0x0c, 0x9b, 0x00, 0x00, 0x00, 0x07, 0xc6, 0x18, 0xe0, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 
+  0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x82, 0xce, 0x79, 0xff, 0x00, 0xce, 0x59, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 
+  0x81, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x02, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 
+  0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf8, 0xb5, 0x96, 0x33, 0x9a, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x54, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x59, 
+  0xff, 0x02, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x00, 0xce, 0x59, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x81, 
+  0xde, 0xbb, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x05, 0xc5, 
+  0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x9b, 0x9a, 0x00, 0x00, 0x00, 0x05, 0xc6, 0x18, 0xa8, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 
+  0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x01, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x01, 0xce, 0x79, 0xff, 0xd6, 0xba, 0xff, 0x83, 0xde, 
+  0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x04, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 
+  0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x01, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xeb, 0x99, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0x0c, 0xc6, 0x18, 0xe0, 0xc6, 
+  0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x03, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 
+  0xd6, 0xba, 0xff, 0x81, 0xde, 0xfb, 0xff, 0x01, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x81, 0xce, 
+  0x59, 0xff, 0x04, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x38, 
+  0x98, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xf8, 0x1c, 0xc6, 0x18, 0xec, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x01, 0xde, 0xbb, 0xff, 0xde, 0xdb, 
+  0xff, 0x81, 0xde, 0xfb, 0xff, 0x00, 0xe6, 0xfc, 0xff, 0x84, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x01, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 
+  0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x02, 0xc6, 0x38, 0xff, 0xbe, 0x18, 0xff, 0xb5, 0xf8, 0xff, 0x81, 0xad, 0xd8, 0xff, 0x00, 0xad, 0xb8, 0xff, 0x81, 0xad, 0xb7, 0xff, 0x00, 0xb5, 0x96, 
+  0x6f, 0x98, 0x00, 0x00, 0x00, 0x05, 0xc6, 0x18, 0x27, 0xc6, 0x18, 0xf8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0xba, 0xff, 
+  0xde, 0xbb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x85, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x01, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x0d, 0xd6, 0x7a, 0xff, 0xce, 0x79, 
+  0xff, 0xce, 0x59, 0xff, 0xb6, 0x39, 0xff, 0x75, 0xb9, 0xff, 0x45, 0x19, 0xff, 0x24, 0x97, 0xff, 0x04, 0x37, 0xff, 0x04, 0x16, 0xff, 0x04, 0x37, 0xff, 0x24, 0x77, 0xff, 0x44, 0xf8, 0xff, 0x5d, 
+  0x79, 0xc7, 0x05, 0x9b, 0x14, 0x97, 0x00, 0x00, 0x00, 0x09, 0xc6, 0x18, 0x2f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 
+  0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xfb, 0xff, 0x00, 0xe6, 0xfc, 0xff, 0x82, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x01, 0xde, 0xbb, 0xff, 
+  0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x04, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0x95, 0xf9, 0xff, 0x1c, 0xf8, 0xff, 0x03, 0xd6, 0xff, 0x85, 0x0b, 0x95, 0xff, 0x04, 0x0b, 0x75, 0xff, 0x0b, 
+  0xf6, 0xff, 0x1c, 0xd8, 0xef, 0x25, 0x3a, 0x5c, 0x26, 0x3a, 0x03, 0x95, 0x00, 0x00, 0x00, 0x09, 0xc6, 0x18, 0x33, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 
+  0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x83, 0xde, 0xdb, 0xff, 0x84, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x04, 0xd6, 
+  0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0x75, 0xb9, 0xff, 0x04, 0x37, 0xff, 0x8a, 0x0b, 0x95, 0xff, 0x05, 0x14, 0x37, 0xfc, 0x25, 0x3a, 0x8b, 0x00, 0x00, 0x00, 0x36, 0x1b, 0x07, 0x1d, 
+  0x7c, 0x0c, 0x2d, 0x7c, 0x0b, 0x91, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0x30, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 
+  0xd6, 0x9a, 0xff, 0x01, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x83, 0xde, 0xdb, 0xff, 0x82, 0xde, 0xfb, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x04, 0xd6, 
+  0x7a, 0xff, 0xd6, 0x79, 0xff, 0x8d, 0xd9, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x8a, 0x0b, 0xb5, 0xff, 0x03, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x1d, 0x19, 0xdb, 0x1c, 0xf9, 0xf7, 0x81, 
+  0x1c, 0xf9, 0xff, 0x03, 0x1d, 0x19, 0xdf, 0x1d, 0x39, 0x98, 0x25, 0x5a, 0x37, 0x2d, 0xdb, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x2b, 0xc6, 0x18, 0xfb, 0xc6, 0x38, 0xff, 0xce, 0x39, 
+  0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x87, 0xde, 0xdb, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x83, 0xd6, 0x9a, 
+  0xff, 0x01, 0xa6, 0x3a, 0xff, 0x04, 0x57, 0xff, 0x8e, 0x0b, 0xb5, 0xff, 0x00, 0x0b, 0xd6, 0xff, 0x82, 0x0b, 0xb5, 0xff, 0x04, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 0xf7, 0x25, 0x5a, 
+  0xa7, 0x25, 0xda, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xf7, 0x20, 0xc5, 0xf8, 0xf0, 0xc6, 0x18, 0xff, 0x81, 0xce, 0x39, 0xff, 0x02, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 
+  0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x86, 0xde, 0xdb, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x01, 0xce, 0x7a, 0xff, 0x5d, 0x18, 0xff, 0x96, 0x0b, 
+  0xb5, 0xff, 0x02, 0x13, 0xf6, 0xff, 0x24, 0xf9, 0xc7, 0x25, 0x7a, 0x17, 0x8b, 0x00, 0x00, 0x00, 0x05, 0xbd, 0xf7, 0x13, 0xc6, 0x18, 0xe4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 
+  0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x86, 0xde, 0xbb, 0xff, 0x84, 0xd6, 0x9a, 0xff, 0x01, 0xc6, 0x59, 0xff, 0x14, 0x36, 0xff, 0x97, 0x0b, 
+  0xd5, 0xff, 0x01, 0x0b, 0xf6, 0xff, 0x25, 0x19, 0xac, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 0x03, 0xc5, 0xf8, 0xcb, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x82, 0xce, 0x59, 0xff, 
+  0x00, 0xd6, 0x7a, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x85, 0xd6, 0xba, 0xff, 0x06, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xbe, 0x7a, 0xff, 0x7d, 0xfa, 0xff, 0x4d, 0x99, 0xff, 0x2d, 0x39, 0xff, 0x0b, 
+  0xf6, 0xff, 0x98, 0x0b, 0xd6, 0xff, 0x01, 0x14, 0x36, 0xff, 0x25, 0x7a, 0x5c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x70, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 
+  0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x04, 0xce, 0x7a, 0xff, 0x75, 0xfa, 0xff, 0x24, 
+  0xb8, 0xff, 0x04, 0x36, 0xff, 0x04, 0x16, 0xff, 0x9a, 0x0b, 0xf6, 0xff, 0x02, 0x0b, 0xd6, 0xff, 0x14, 0x97, 0xcc, 0x2e, 0x1c, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xf7, 0x1b, 0xc5, 0xf8, 
+  0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x01, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x85, 0xd6, 0x9a, 0xff, 0x02, 0xce, 0x9a, 0xff, 0x6d, 
+  0xba, 0xff, 0x04, 0x36, 0xff, 0x9e, 0x0b, 0xf6, 0xff, 0x01, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xf7, 0x9c, 0xc5, 0xf8, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 
+  0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x82, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xa6, 0x3a, 0xff, 0x04, 0x57, 0xff, 0x9f, 0x0c, 0x16, 
+  0xff, 0x01, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xf7, 0x28, 0xbd, 0xf7, 0xf3, 0xc5, 0xf8, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc6, 0x38, 0xff, 0xce, 0x39, 
+  0xff, 0x83, 0xce, 0x59, 0xff, 0x83, 0xce, 0x79, 0xff, 0x02, 0xd6, 0x79, 0xff, 0x35, 0x59, 0xff, 0x04, 0x16, 0xff, 0x9f, 0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x30, 0x8c, 0x00, 
+  0x00, 0x00, 0x00, 0xbd, 0xd7, 0x97, 0x81, 0xc5, 0xf8, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x82, 0xce, 0x39, 0xff, 0x84, 0xce, 0x59, 0xff, 0x01, 0xd6, 0x79, 0xff, 0x04, 0x77, 
+  0xff, 0xa0, 0x0c, 0x36, 0xff, 0x01, 0x0c, 0x36, 0xfc, 0x14, 0x56, 0x2b, 0x8c, 0x00, 0x00, 0x00, 0x03, 0xb5, 0xb6, 0x18, 0xbd, 0xf7, 0xd8, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0x82, 0xc6, 0x18, 
+  0xff, 0x81, 0xc6, 0x38, 0xff, 0x00, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x02, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x04, 0x16, 0xff, 0xa0, 0x0c, 0x36, 0xff, 0x01, 0x14, 0x56, 0xef, 0x14, 
+  0xb7, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xd7, 0x33, 0xbd, 0xd7, 0xf7, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0x83, 0xc6, 0x18, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x04, 0xce, 0x39, 0xff, 0xc6, 
+  0x18, 0xff, 0xc5, 0xf8, 0xff, 0xce, 0x18, 0xff, 0x04, 0x36, 0xff, 0xa0, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xcf, 0x25, 0x79, 0x08, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xd7, 0x60, 0xbd, 0xd7, 
+  0xfb, 0x81, 0xbd, 0xf7, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x84, 0xc6, 0x18, 0xff, 0x03, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x18, 0xff, 0x04, 0x97, 0xff, 0xa0, 0x0c, 0x56, 0xff, 0x00, 0x14, 
+  0x97, 0x5f, 0x90, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xd7, 0x5b, 0xbd, 0xd7, 0xfb, 0xbd, 0xd7, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 
+  0x81, 0xbd, 0xd7, 0xff, 0x01, 0x75, 0x57, 0xff, 0x04, 0x56, 0xff, 0x9e, 0x14, 0x76, 0xff, 0x00, 0x14, 0x77, 0xaf, 0x92, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xb7, 0x4c, 0xbd, 0xd7, 0xf0, 0x81, 0xbd, 
+  0xd7, 0xff, 0x82, 0xbd, 0xf7, 0xff, 0x83, 0xc5, 0xf8, 0xff, 0x02, 0xb5, 0xf8, 0xff, 0x34, 0xb7, 0xff, 0x0c, 0x76, 0xff, 0x9c, 0x14, 0x76, 0xff, 0x01, 0x14, 0x77, 0xcf, 0x1d, 0x17, 0x18, 0x93, 
+  0x00, 0x00, 0x00, 0x01, 0xbd, 0xd7, 0x23, 0xbd, 0xd7, 0xab, 0x87, 0xbd, 0xd7, 0xff, 0x03, 0xbd, 0xf7, 0xff, 0xad, 0xb7, 0xff, 0x0c, 0xb7, 0xff, 0x04, 0x76, 0xff, 0x9a, 0x14, 0x76, 0xff, 0x01, 
+  0x14, 0x77, 0x9c, 0x1c, 0xf7, 0x13, 0x96, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xb7, 0x57, 0xbd, 0xd7, 0xd3, 0xbd, 0xd7, 0xf8, 0x86, 0xbd, 0xd7, 0xff, 0x02, 0xb5, 0xd7, 0xff, 0x65, 0x17, 0xff, 0x2c, 
+  0xb7, 0xff, 0x82, 0x04, 0x97, 0xff, 0x00, 0x0c, 0x97, 0xff, 0x91, 0x14, 0x97, 0xff, 0x03, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xec, 0x14, 0x97, 0xbc, 0x14, 0x97, 0x47, 0x99, 0x00, 0x00, 0x00, 0x03, 
+  0xb5, 0xb6, 0x0c, 0xbd, 0xb7, 0x33, 0xbd, 0xb7, 0x9b, 0xbd, 0xb7, 0xeb, 0x85, 0xbd, 0xb7, 0xff, 0x00, 0xb5, 0xb7, 0xff, 0x81, 0xad, 0x96, 0xff, 0x03, 0xa5, 0x76, 0xff, 0x9d, 0x56, 0xb7, 0x85, 
+  0x16, 0x5f, 0x04, 0x97, 0x2f, 0x90, 0x14, 0x97, 0x2f, 0x02, 0x14, 0x97, 0x28, 0x14, 0x77, 0x1c, 0x14, 0xd7, 0x0b, 0x9e, 0x00, 0x00, 0x00, 0x09, 0xb5, 0x96, 0x38, 0xb5, 0xb6, 0x6f, 0xb5, 0xb6, 
+  0x9b, 0xb5, 0xb6, 0xb8, 0xb5, 0xb6, 0xcb, 0xb5, 0xb6, 0xc0, 0xb5, 0xb6, 0xa7, 0xb5, 0x96, 0x7f, 0xb5, 0x96, 0x4c, 0xad, 0x75, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xba, 0xba, 0xba, 0x0c, 0xb9, 0xb9, 0xb9, 0x1c, 0xbb, 0xbb, 0xbb, 0x27, 0xbb, 0xbb, 0xbb, 0x2f, 0xba, 0xba, 0xba, 0x33, 0xb9, 0xb9, 0xb9, 0x30, 0xb9, 0xb9, 0xb9, 0x2b, 0xb7, 0xb7, 0xb7, 0x20, 0xb7, 0xb7, 0xb7, 0x13, 0xbe, 0xbe, 0xbe, 0x03, 0xb7, 0xb7, 0xb7, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xbd, 0xbd, 0xbd, 0x00, 0xc1, 0xc1, 0xc1, 0x00, 0xbb, 0xbb, 0xbb, 0x54, 0xbd, 0xbd, 0xbd, 0xa8, 0xbd, 0xbd, 0xbd, 0xe0, 0xbc, 0xbc, 0xbc, 0xec, 0xbd, 0xbd, 0xbd, 0xf8, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xfb, 0xb9, 0xb9, 0xb9, 0xf0, 0xb9, 0xb9, 0xb9, 0xe4, 0xb7, 0xb7, 0xb7, 0xcb, 0xb7, 0xb7, 0xb7, 0x70, 0xb3, 0xb3, 0xb3, 0x1b, 0xb5, 0xb5, 0xb5, 0x00, 0xa9, 0xa9, 0xa9, 0x00, 0xae, 0xae, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x00, 0xc5, 0xc5, 0xc5, 0x00, 0xbe, 0xbe, 0xbe, 0x17, 0xbd, 0xbd, 0xbd, 0x74, 0xbe, 0xbe, 0xbe, 0xe0, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0x9c, 0xb3, 0xb3, 0xb3, 0x28, 0xa2, 0xa2, 0xa2, 0x00, 0xb2, 0xb2, 0xb2, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x00, 0x93, 0x93, 0x93, 0x00, 0xbf, 0xbf, 0xbf, 0x67, 0xbf, 0xbf, 0xbf, 0xec, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xf3, 0xb5, 0xb5, 0xb5, 0x97, 0xb1, 0xb1, 0xb1, 0x18, 0xb3, 0xb3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xc0, 0xc0, 0xc0, 0x0c, 0xbe, 0xbe, 0xbe, 0xab, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xd8, 0xb3, 0xb3, 0xb3, 0x33, 0x56, 0x56, 0x56, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x00, 0xc2, 0xc2, 0xc2, 0x00, 0xc0, 0xc0, 0xc0, 0x28, 0xc0, 0xc0, 0xc0, 0xd7, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xf7, 0xb4, 0xb4, 0xb4, 0x60, 0xbc, 0xbc, 0xbc, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xc0, 0xc0, 0xc0, 0x28, 0xbf, 0xbf, 0xbf, 0xd8, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xfb, 0xb4, 0xb4, 0xb4, 0x5b, 0xc0, 0xc0, 0xc0, 0x00, 0xa4, 0xa4, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x00, 0xbe, 0xbe, 0xbe, 0x0c, 0xc0, 0xc0, 0xc0, 0xd7, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xfb, 0xb2, 0xb2, 0xb2, 0x4c, 0xb2, 0xb2, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xcb, 0xcb, 0xcb, 0x00, 0xc0, 0xc0, 0xc0, 0xab, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xf0, 0xb2, 0xb2, 0xb2, 0x23, 0xb2, 0xb2, 0xb2, 0x00, 0x9e, 0x9e, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xc7, 0x00, 0xbf, 0xbf, 0xbf, 0x67, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xab, 0xb5, 0xb5, 0xb5, 0x00, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8, 0x00, 0xc0, 0xc0, 0xc0, 0x17, 0xc1, 0xc1, 0xc1, 0xec, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x57, 0xb2, 0xb2, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x00, 0xc0, 0xc0, 0xc0, 0x74, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xd3, 0xae, 0xae, 0xae, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0xe0, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xf8, 0xb2, 0xb2, 0xb2, 0x33, 0xb1, 0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0x54, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x9b, 0xb1, 0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0xc3, 0x00, 0xc1, 0xc1, 0xc1, 0xa8, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xeb, 0xb6, 0xb6, 0xb6, 0x00, 0xaf, 0xaf, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x0c, 0xc1, 0xc1, 0xc1, 0xe0, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xaf, 0xaf, 0xaf, 0x38, 0xb0, 0xb0, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x1c, 0xc1, 0xc1, 0xc1, 0xec, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc3, 0xc4, 0xc3, 0xff, 0xc2, 0xc0, 0xb9, 0xff, 0xc2, 0xbd, 0xb0, 0xff, 0xc1, 0xba, 0xac, 0xff, 0xbf, 0xb7, 0xa8, 0xff, 0xbd, 0xb6, 0xa8, 0xff, 0xb9, 0xb4, 0xa7, 0xff, 0xb5, 0xb3, 0xac, 0xff, 0xaf, 0xb0, 0xb0, 0x6f, 0xb8, 0xae, 0x9b, 0x00, 0xce, 0xa7, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x27, 0xc1, 0xc1, 0xc1, 0xf8, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xda, 0xda, 0xda, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc8, 0xc9, 0xcb, 0xff, 0xc8, 0xc5, 0xb3, 0xff, 0xcb, 0xb6, 0x71, 0xff, 0xc5, 0x9f, 0x41, 0xff, 0xbc, 0x8f, 0x1f, 0xff, 0xb6, 0x84, 0x00, 0xff, 0xb4, 0x80, 0x00, 0xff, 0xb6, 0x84, 0x00, 0xff, 0xbb, 0x8e, 0x1f, 0xff, 0xc4, 0x9d, 0x3e, 0xff, 0xc7, 0xac, 0x57, 0xc7, 0xd8, 0xaf, 0x00, 0x14, 0xd0, 0xaa, 0x1e, 0x00, 0xe2, 0xaa, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x2f, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xca, 0xc8, 0xff, 0xcb, 0xbe, 0x94, 0xff, 0xc4, 0x9b, 0x16, 0xff, 0xb1, 0x7a, 0x00, 0xff, 0xa8, 0x6f, 0x07, 0xff, 0xa8, 0x70, 0x08, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa7, 0x6d, 0x07, 0xff, 0xb2, 0x7d, 0x09, 0xff, 0xc3, 0x99, 0x1a, 0xef, 0xce, 0xa6, 0x1e, 0x5c, 0xd0, 0xc3, 0x22, 0x03, 0xce, 0xa7, 0x1d, 0x00, 0xd0, 0xae, 0x24, 0x00, 0xd3, 0xa8, 0x1c, 0x00, 0xd3, 0xa7, 0x22, 0x00, 0xc9, 0xaf, 0x1b, 0x00, 0xd9, 0xa8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x33, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xca, 0xff, 0xc9, 0xc9, 0xc7, 0xff, 0xcb, 0xb3, 0x70, 0xff, 0xb5, 0x83, 0x00, 0xff, 0xaa, 0x72, 0x06, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xb5, 0x83, 0x11, 0xfc, 0xcd, 0xa6, 0x1e, 0x8b, 0xc9, 0xae, 0x21, 0x00, 0xdb, 0xc2, 0x32, 0x07, 0xde, 0xae, 0x1c, 0x0c, 0xe0, 0xab, 0x2a, 0x0b, 0xff, 0x00, 0x72, 0x00, 0xd0, 0xab, 0x1d, 0x00, 0xce, 0xa6, 0x20, 0x00, 0xcf, 0xa7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x30, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xda, 0xda, 0xda, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcc, 0xcd, 0xff, 0xca, 0xb9, 0x86, 0xff, 0xb2, 0x7e, 0x00, 0xff, 0xa9, 0x72, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xa9, 0x72, 0x08, 0xff, 0xb3, 0x81, 0x0e, 0xff, 0xc9, 0xa1, 0x1c, 0xdb, 0xc7, 0x9e, 0x1b, 0xf7, 0xc5, 0x9b, 0x1a, 0xff, 0xc6, 0x9d, 0x1a, 0xff, 0xc7, 0xa1, 0x1b, 0xdf, 0xcc, 0xa4, 0x1c, 0x98, 0xd0, 0xaa, 0x20, 0x37, 0xda, 0xba, 0x29, 0x04, 0xd1, 0xb0, 0x22, 0x00, 0xd0, 0xaf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x2b, 0xc0, 0xc0, 0xc0, 0xfb, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xd0, 0xff, 0xcf, 0xc6, 0xa4, 0xff, 0xb7, 0x87, 0x00, 0xff, 0xab, 0x74, 0x08, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 0xba, 0x8c, 0x13, 0xf7, 0xce, 0xa8, 0x1d, 0xa7, 0xd4, 0xba, 0x24, 0x10, 0xd1, 0xb1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x20, 0xbe, 0xbe, 0xbe, 0xf0, 0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcc, 0xc8, 0xff, 0xc3, 0xa2, 0x55, 0xff, 0xa9, 0x73, 0x06, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xaa, 0x75, 0x09, 0xff, 0xb1, 0x7e, 0x0e, 0xff, 0xc8, 0x9d, 0x1d, 0xc7, 0xd1, 0xae, 0x24, 0x17, 0xd4, 0xae, 0x28, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x13, 0xbf, 0xbf, 0xbf, 0xe4, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd1, 0xd1, 0xff, 0xcf, 0xd0, 0xd3, 0xff, 0xcd, 0xcf, 0xd3, 0xff, 0xcb, 0xc8, 0xc1, 0xff, 0xb2, 0x84, 0x12, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xaf, 0x7d, 0x0c, 0xff, 0xc6, 0xa2, 0x1d, 0xac, 0xc4, 0xac, 0x12, 0x00, 0xdd, 0xa3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x03, 0xbe, 0xbe, 0xbe, 0xcb, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcd, 0xff, 0xd0, 0xcb, 0xb8, 0xff, 0xce, 0xbc, 0x7b, 0xff, 0xcc, 0xb2, 0x4c, 0xff, 0xc7, 0xa6, 0x26, 0xff, 0xae, 0x7b, 0x08, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xb3, 0x83, 0x0f, 0xff, 0xd1, 0xae, 0x23, 0x5c, 0xcb, 0xa5, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xbc, 0xbc, 0xbc, 0x70, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd3, 0xff, 0xcd, 0xcd, 0xcc, 0xff, 0xd0, 0xbb, 0x6f, 0xff, 0xbf, 0x96, 0x1d, 0xff, 0xb3, 0x83, 0x00, 0xff, 0xb0, 0x7f, 0x03, 0xff, 0xaf, 0x7d, 0x07, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xad, 0x7a, 0x09, 0xff, 0xbc, 0x90, 0x14, 0xcc, 0xe1, 0xc2, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xbb, 0xbb, 0xbb, 0x1b, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd0, 0xcc, 0xff, 0xcd, 0xb6, 0x65, 0xff, 0xb4, 0x84, 0x00, 0xff, 0xad, 0x7d, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xb2, 0x84, 0x0f, 0xef, 0xcb, 0xa6, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xbb, 0xbb, 0xbb, 0x9c, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xcf, 0xd0, 0xff, 0xcd, 0xc3, 0x9d, 0xff, 0xb5, 0x88, 0x00, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xb1, 0x83, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x00, 0xbb, 0xbb, 0xbb, 0x28, 0xbc, 0xbc, 0xbc, 0xf3, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcd, 0xd1, 0xff, 0xc5, 0xa8, 0x34, 0xff, 0xb0, 0x81, 0x04, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb4, 0x88, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0x5f, 0x5f, 0x5f, 0x00, 0xba, 0xba, 0xba, 0x97, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcd, 0xd0, 0xff, 0xb7, 0x8b, 0x00, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xfc, 0xb4, 0x87, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0xb4, 0xb4, 0xb4, 0x18, 0xbb, 0xbb, 0xbb, 0xd8, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xca, 0xcc, 0xff, 0xb0, 0x80, 0x00, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb3, 0x87, 0x0d, 0xef, 0xbc, 0x95, 0x14, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb7, 0xb7, 0x00, 0xb7, 0xb7, 0xb7, 0x00, 0xb9, 0xb9, 0xb9, 0x33, 0xba, 0xba, 0xba, 0xf7, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc2, 0xc5, 0xff, 0xb1, 0x84, 0x00, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb3, 0x89, 0x0d, 0xcf, 0xcc, 0xae, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xc4, 0x00, 0xb7, 0xb7, 0xb7, 0x60, 0xba, 0xba, 0xba, 0xfb, 0xbb, 0xbb, 0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xc1, 0xc4, 0xff, 0xb5, 0x91, 0x00, 0xff, 0xb2, 0x89, 0x0a, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb7, 0x90, 0x11, 0x5f, 0xbb, 0x8f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x00, 0xa4, 0xa4, 0xa4, 0x00, 0xb9, 0xb9, 0xb9, 0x5b, 0xb9, 0xb9, 0xb9, 0xfb, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb9, 0xba, 0xbc, 0xff, 0xba, 0xa9, 0x73, 0xff, 0xb3, 0x8a, 0x00, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb5, 0x8d, 0x0f, 0xaf, 0x8f, 0x33, 0x00, 0x00, 0xc1, 0xa4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x00, 0xb7, 0xb7, 0xb7, 0x00, 0xb5, 0xb5, 0xb5, 0x4c, 0xb7, 0xb7, 0xb7, 0xf0, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbb, 0xb1, 0xff, 0xb6, 0x94, 0x33, 0xff, 0xb4, 0x8c, 0x08, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb5, 0x8c, 0x0d, 0xcf, 0xbb, 0x9f, 0x19, 0x18, 0xc8, 0xce, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xb7, 0xb7, 0xb7, 0x00, 0xb8, 0xb8, 0xb8, 0x23, 0xb7, 0xb7, 0xb7, 0xab, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xb6, 0xa8, 0xff, 0xb5, 0x94, 0x0c, 0xff, 0xb4, 0x8d, 0x00, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb5, 0x8e, 0x0e, 0x9c, 0xb6, 0x9d, 0x16, 0x13, 0xac, 0x8a, 0x05, 0x00, 0xbf, 0xaf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xb6, 0xb6, 0xb6, 0x57, 0xb7, 0xb7, 0xb7, 0xd3, 0xb7, 0xb7, 0xb7, 0xf8, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb9, 0xff, 0xb8, 0xb7, 0xb0, 0xff, 0xb7, 0xa2, 0x61, 0xff, 0xb5, 0x93, 0x25, 0xff, 0xb5, 0x90, 0x00, 0xff, 0xb5, 0x8f, 0x00, 0xff, 0xb5, 0x8f, 0x00, 0xff, 0xb5, 0x90, 0x0c, 0xff, 0xb5, 0x8f, 0x0f, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xec, 0xb5, 0x8f, 0x0d, 0xbc, 0xb7, 0x90, 0x0d, 0x47, 0xb1, 0x84, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0x00, 0xd6, 0xd6, 0xd6, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0xb3, 0xb3, 0xb3, 0x0c, 0xb6, 0xb6, 0xb6, 0x33, 0xb5, 0xb5, 0xb5, 0x9b, 0xb5, 0xb5, 0xb5, 0xeb, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb6, 0xff, 0xb5, 0xb4, 0xb2, 0xff, 0xb4, 0xb1, 0xa8, 0xff, 0xb4, 0xaf, 0xa5, 0xff, 0xb3, 0xac, 0xa2, 0xff, 0xb2, 0xa9, 0x99, 0xb7, 0xb3, 0xa1, 0x7e, 0x5f, 0xb5, 0x90, 0x00, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8e, 0x0d, 0x1c, 0xba, 0x97, 0x14, 0x0b, 0xa3, 0x80, 0x00, 0x00, 0xbf, 0x9c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0xb6, 0xb6, 0xb6, 0x00, 0xb2, 0xb2, 0xb2, 0x38, 0xb4, 0xb4, 0xb4, 0x6f, 0xb4, 0xb4, 0xb4, 0x9b, 0xb4, 0xb4, 0xb4, 0xb8, 0xb3, 0xb3, 0xb3, 0xcb, 0xb3, 0xb3, 0xb3, 0xc0, 0xb3, 0xb3, 0xb3, 0xa7, 0xb2, 0xb2, 0xb2, 0x7f, 0xaf, 0xaf, 0xaf, 0x4c, 0xab, 0xab, 0xab, 0x0f, 0xb1, 0xb1, 0xb1, 0x00, 0xb1, 0xb1, 0xb1, 0x00, 0xb1, 0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0xb4, 0xb4, 0xb4, 0x00, 0xb4, 0xb4, 0xb4, 0x00, 0xb4, 0xb4, 0xb4, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0xb2, 0xb2, 0xb2, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0xaf, 0xaf, 0xaf, 0x00, 0xaf, 0xaf, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x09, 0xba, 0xba, 0xba, 0x0c, 0xb9, 0xb9, 0xb9, 0x1c, 0xbb, 0xbb, 0xbb, 0x27, 0xbb, 0xbb, 0xbb, 0x2f, 0xba, 0xba, 0xba, 0x33, 0xb9, 0xb9, 0xb9, 0x30, 
+  0xb9, 0xb9, 0xb9, 0x2b, 0xb7, 0xb7, 0xb7, 0x20, 0xb7, 0xb7, 0xb7, 0x13, 0xbe, 0xbe, 0xbe, 0x03, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbb, 0xbb, 0xbb, 0x54, 0xbd, 0xbd, 0xbd, 0xa8, 0xbd, 0xbd, 
+  0xbd, 0xe0, 0xbc, 0xbc, 0xbc, 0xec, 0xbd, 0xbd, 0xbd, 0xf8, 0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x06, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xfb, 0xb9, 0xb9, 0xb9, 0xf0, 0xb9, 0xb9, 0xb9, 0xe4, 
+  0xb7, 0xb7, 0xb7, 0xcb, 0xb7, 0xb7, 0xb7, 0x70, 0xb3, 0xb3, 0xb3, 0x1b, 0xae, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbe, 0xbe, 0xbe, 0x17, 0xbd, 0xbd, 0xbd, 0x74, 0xbe, 0xbe, 0xbe, 0xe0, 0xbf, 0xbf, 
+  0xbf, 0xff, 0x82, 0xbe, 0xbe, 0xbe, 0xff, 0x00, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xbe, 0xbe, 0xbe, 0xff, 0x81, 0xbd, 0xbd, 0xbd, 0xff, 0x06, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 
+  0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0x9c, 0xb3, 0xb3, 0xb3, 0x28, 0xab, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbf, 0xbf, 0xbf, 0x67, 0xbf, 0xbf, 0xbf, 
+  0xec, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x00, 0xc1, 0xc1, 0xc1, 0xff, 0x81, 0xc0, 
+  0xc0, 0xc0, 0xff, 0x08, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xf3, 
+  0xb5, 0xb5, 0xb5, 0x97, 0xb1, 0xb1, 0xb1, 0x18, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xc0, 0xc0, 0x0c, 0xbe, 0xbe, 0xbe, 0xab, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 
+  0xc2, 0xff, 0x81, 0xc3, 0xc3, 0xc3, 0xff, 0x03, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc4, 0xc4, 0xc4, 0xff, 0x81, 0xc2, 0xc2, 
+  0xc2, 0xff, 0x03, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x03, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 
+  0xff, 0xb5, 0xb5, 0xb5, 0xd8, 0xb3, 0xb3, 0xb3, 0x33, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0xc0, 0xc0, 0x28, 0xc0, 0xc0, 0xc0, 0xd7, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 
+  0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x05, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 
+  0xc6, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x0a, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 
+  0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xf7, 0xb4, 0xb4, 0xb4, 0x60, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc0, 0xc0, 0xc0, 0x28, 0xbf, 0xbf, 
+  0xbf, 0xd8, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x13, 0xca, 0xca, 0xca, 0xff, 
+  0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 
+  0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 
+  0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xfb, 0xb4, 0xb4, 0xb4, 0x5b, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xbe, 0xbe, 0xbe, 0x0c, 0xc0, 0xc0, 0xc0, 0xd7, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 
+  0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0x81, 0xcb, 0xcb, 0xcb, 0xff, 0x02, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 
+  0xcd, 0xcd, 0xcd, 0xff, 0x82, 0xcc, 0xcc, 0xcc, 0xff, 0x0e, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 
+  0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 
+  0xb5, 0xfb, 0xb2, 0xb2, 0xb2, 0x4c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xc0, 0xc0, 0xab, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 
+  0x81, 0xca, 0xca, 0xca, 0xff, 0x02, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0x83, 0xcf, 0xcf, 0xcf, 0xff, 0x00, 0xce, 0xce, 0xce, 0xff, 0x81, 0xcd, 0xcd, 0xcd, 
+  0xff, 0x0e, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 
+  0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xf0, 0xb2, 0xb2, 0xb2, 0x23, 0x9e, 0x00, 
+  0x00, 0x00, 0x00, 0x05, 0xbf, 0xbf, 0xbf, 0x67, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 
+  0xff, 0x05, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0x82, 0xd0, 0xd0, 0xd0, 0xff, 0x81, 
+  0xce, 0xce, 0xce, 0xff, 0x0d, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 
+  0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xab, 0x9d, 0x00, 0x00, 
+  0x00, 0x00, 0x0d, 0xc0, 0xc0, 0xc0, 0x17, 0xc1, 0xc1, 0xc1, 0xec, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 
+  0xcd, 0xcd, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xd3, 0xd3, 0xd3, 0xff, 
+  0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x10, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 
+  0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 
+  0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x57, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc0, 0xc0, 0xc0, 0x74, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 
+  0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 0xc8, 0xc8, 
+  0xc8, 0xff, 0x00, 0xd7, 0xd7, 0xd7, 0xff, 0x81, 0xd5, 0xd5, 0xd5, 0xff, 0x12, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 
+  0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 
+  0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xd3, 0xae, 0xae, 0xae, 0x0c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc0, 
+  0xc0, 0xc0, 0xe0, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 
+  0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x82, 0xcb, 0xcb, 0xcb, 0xff, 0x16, 0xc7, 0xc7, 0xc7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 
+  0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 
+  0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 
+  0xff, 0xb4, 0xb4, 0xb4, 0xf8, 0xb2, 0xb2, 0xb2, 0x33, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0xc0, 0xc0, 0x54, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 
+  0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 
+  0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x12, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 
+  0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 
+  0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 
+  0x9b, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xc1, 0xc1, 0xc1, 0xa8, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 
+  0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd3, 
+  0xd3, 0xd3, 0xff, 0x81, 0xd9, 0xd9, 0xd9, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x11, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 
+  0xd1, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 
+  0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xeb, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xbf, 0xbf, 0xbf, 0x0c, 
+  0xc1, 0xc1, 0xc1, 0xe0, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 
+  0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x15, 0xda, 0xda, 
+  0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 
+  0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 
+  0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xaf, 0xaf, 0xaf, 0x38, 0x98, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbe, 0xbe, 0xbe, 0x1c, 
+  0xc1, 0xc1, 0xc1, 0xec, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x01, 0xd5, 0xd5, 
+  0xd5, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x00, 0xdd, 0xdd, 0xdd, 0xff, 0x82, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x13, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 
+  0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 
+  0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc3, 0xc4, 0xc3, 0xff, 0xc2, 0xc0, 0xb9, 0xff, 0xc2, 0xbd, 0xb0, 0xff, 0xc1, 0xba, 0xac, 0xff, 0xbf, 0xb7, 0xa8, 0xff, 0xbd, 0xb6, 0xa8, 0xff, 0xb9, 
+  0xb4, 0xa7, 0xff, 0xb5, 0xb3, 0xac, 0xff, 0xaf, 0xb0, 0xb0, 0x6f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc0, 0xc0, 0xc0, 0x27, 0xc1, 0xc1, 0xc1, 0xf8, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 
+  0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0x81, 0xda, 0xda, 
+  0xda, 0xff, 0x00, 0xdb, 0xdb, 0xdb, 0xff, 0x82, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x14, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 
+  0xd6, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc8, 0xc9, 0xcb, 0xff, 0xc8, 0xc5, 0xb3, 0xff, 0xcb, 0xb6, 
+  0x71, 0xff, 0xc5, 0x9f, 0x41, 0xff, 0xbc, 0x8f, 0x1f, 0xff, 0xb6, 0x84, 0x00, 0xff, 0xb4, 0x80, 0x00, 0xff, 0xb6, 0x84, 0x00, 0xff, 0xbb, 0x8e, 0x1f, 0xff, 0xc4, 0x9d, 0x3e, 0xff, 0xc7, 0xac, 
+  0x57, 0xc7, 0xd8, 0xaf, 0x00, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0xc0, 0xc0, 0x2f, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 
+  0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 
+  0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0x81, 0xdc, 0xdc, 0xdc, 0xff, 0x0e, 0xdb, 0xdb, 0xdb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 
+  0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xca, 0xc8, 0xff, 0xcb, 0xbe, 0x94, 0xff, 0xc4, 0x9b, 
+  0x16, 0xff, 0xb1, 0x7a, 0x00, 0xff, 0xa8, 0x6f, 0x07, 0xff, 0xa8, 0x70, 0x08, 0xff, 0x81, 0xa9, 0x71, 0x09, 0xff, 0x06, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa7, 0x6d, 0x07, 0xff, 
+  0xb2, 0x7d, 0x09, 0xff, 0xc3, 0x99, 0x1a, 0xef, 0xce, 0xa6, 0x1e, 0x5c, 0xd0, 0xc3, 0x22, 0x03, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbf, 0xbf, 0xbf, 0x33, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 
+  0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 
+  0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0x82, 0xdb, 0xdb, 0xdb, 0xff, 0x0b, 0xd9, 0xd9, 0xd9, 0xff, 
+  0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xca, 0xff, 0xc9, 0xc9, 0xc7, 0xff, 0xcb, 0xb3, 0x70, 0xff, 
+  0xb5, 0x83, 0x00, 0xff, 0xaa, 0x72, 0x06, 0xff, 0xaa, 0x71, 0x09, 0xff, 0x86, 0xaa, 0x72, 0x09, 0xff, 0x07, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xb5, 0x83, 0x11, 0xfc, 0xcd, 0xa6, 
+  0x1e, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xc2, 0x32, 0x07, 0xde, 0xae, 0x1c, 0x0c, 0xe0, 0xab, 0x2a, 0x0b, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbf, 0xbf, 0xbf, 0x30, 0xc0, 0xc0, 0xc0, 0xff, 
+  0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 
+  0xd6, 0xd6, 0xd6, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x81, 0xda, 0xda, 0xda, 0xff, 0x82, 0xdb, 0xdb, 0xdb, 0xff, 0x03, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 
+  0xd4, 0xd4, 0xd4, 0xff, 0x81, 0xd0, 0xd0, 0xd0, 0xff, 0x04, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcc, 0xcd, 0xff, 0xca, 0xb9, 0x86, 0xff, 0xb2, 0x7e, 0x00, 0xff, 0xa9, 0x72, 0x09, 0xff, 0x8a, 0xaa, 
+  0x73, 0x09, 0xff, 0x09, 0xa9, 0x72, 0x08, 0xff, 0xb3, 0x81, 0x0e, 0xff, 0xc9, 0xa1, 0x1c, 0xdb, 0xc7, 0x9e, 0x1b, 0xf7, 0xc5, 0x9b, 0x1a, 0xff, 0xc6, 0x9d, 0x1a, 0xff, 0xc7, 0xa1, 0x1b, 0xdf, 
+  0xcc, 0xa4, 0x1c, 0x98, 0xd0, 0xaa, 0x20, 0x37, 0xda, 0xba, 0x29, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0xc0, 0xc0, 0x2b, 0xc0, 0xc0, 0xc0, 0xfb, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 
+  0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 
+  0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x01, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0x81, 0xd9, 0xd9, 0xd9, 0xff, 0x08, 0xd8, 0xd8, 0xd8, 0xff, 0xd4, 0xd4, 
+  0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xd0, 0xff, 0xcf, 0xc6, 0xa4, 0xff, 0xb7, 0x87, 0x00, 0xff, 0xab, 0x74, 0x08, 0xff, 0x8c, 0xab, 
+  0x75, 0x09, 0xff, 0x09, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 
+  0xba, 0x8c, 0x13, 0xf7, 0xce, 0xa8, 0x1d, 0xa7, 0xd4, 0xba, 0x24, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbc, 0xbc, 0xbc, 0x20, 0xbe, 0xbe, 0xbe, 0xf0, 0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 
+  0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 
+  0xd5, 0xff, 0x81, 0xd7, 0xd7, 0xd7, 0xff, 0x83, 0xd8, 0xd8, 0xd8, 0xff, 0x08, 0xd7, 0xd7, 0xd7, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 
+  0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcc, 0xc8, 0xff, 0xc3, 0xa2, 0x55, 0xff, 0xa9, 0x73, 0x06, 0xff, 0x94, 0xab, 0x76, 0x0a, 0xff, 0x03, 0xaa, 0x75, 0x09, 0xff, 0xb1, 0x7e, 0x0e, 0xff, 0xc8, 
+  0x9d, 0x1d, 0xc7, 0xd1, 0xae, 0x24, 0x17, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x07, 0xbc, 0xbc, 0xbc, 0x13, 0xbf, 0xbf, 0xbf, 0xe4, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 
+  0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xcf, 0xcf, 0xcf, 0xff, 0x01, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x82, 0xd5, 0xd5, 0xd5, 0xff, 
+  0x83, 0xd6, 0xd6, 0xd6, 0xff, 0x07, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd1, 0xd1, 0xff, 0xcf, 0xd0, 0xd3, 0xff, 0xcd, 0xcf, 0xd3, 0xff, 0xcb, 0xc8, 0xc1, 0xff, 0xb2, 0x84, 
+  0x12, 0xff, 0xac, 0x78, 0x0a, 0xff, 0x95, 0xac, 0x79, 0x0a, 0xff, 0x02, 0xac, 0x78, 0x0a, 0xff, 0xaf, 0x7d, 0x0c, 0xff, 0xc6, 0xa2, 0x1d, 0xac, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbf, 0xbf, 
+  0xbf, 0x03, 0xbe, 0xbe, 0xbe, 0xcb, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 
+  0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x85, 0xd4, 0xd4, 0xd4, 0xff, 0x06, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcd, 0xff, 0xd0, 0xcb, 0xb8, 
+  0xff, 0xce, 0xbc, 0x7b, 0xff, 0xcc, 0xb2, 0x4c, 0xff, 0xc7, 0xa6, 0x26, 0xff, 0xae, 0x7b, 0x08, 0xff, 0x98, 0xad, 0x7a, 0x0a, 0xff, 0x01, 0xb3, 0x83, 0x0f, 0xff, 0xd1, 0xae, 0x23, 0x5c, 0x8b, 
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xbc, 0xbc, 0xbc, 0x70, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 
+  0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x82, 0xd2, 0xd2, 
+  0xd2, 0xff, 0x06, 0xd2, 0xd2, 0xd3, 0xff, 0xcd, 0xcd, 0xcc, 0xff, 0xd0, 0xbb, 0x6f, 0xff, 0xbf, 0x96, 0x1d, 0xff, 0xb3, 0x83, 0x00, 0xff, 0xb0, 0x7f, 0x03, 0xff, 0xaf, 0x7d, 0x07, 0xff, 0x99, 
+  0xae, 0x7c, 0x0a, 0xff, 0x02, 0xad, 0x7a, 0x09, 0xff, 0xbc, 0x90, 0x14, 0xcc, 0xe1, 0xc2, 0x28, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbb, 0xbb, 0xbb, 0x1b, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 
+  0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 
+  0xce, 0xce, 0xff, 0x81, 0xcf, 0xcf, 0xcf, 0xff, 0x82, 0xd1, 0xd1, 0xd1, 0xff, 0x04, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd0, 0xcc, 0xff, 0xcd, 0xb6, 0x65, 0xff, 0xb4, 0x84, 0x00, 0xff, 0xad, 0x7d, 
+  0x0b, 0xff, 0x9d, 0xae, 0x7e, 0x0b, 0xff, 0x01, 0xb2, 0x84, 0x0f, 0xef, 0xcb, 0xa6, 0x20, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbb, 0xbb, 0xbb, 0x9c, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 
+  0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x00, 
+  0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xce, 0xce, 0xce, 0xff, 0x04, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xcf, 0xd0, 0xff, 0xcd, 0xc3, 0x9d, 0xff, 0xb5, 0x88, 0x00, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0x9e, 0xaf, 
+  0x80, 0x0b, 0xff, 0x01, 0xb1, 0x83, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbb, 0xbb, 0xbb, 0x28, 0xbc, 0xbc, 0xbc, 0xf3, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 
+  0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 
+  0xcb, 0xff, 0x82, 0xcc, 0xcc, 0xcc, 0xff, 0x02, 0xcc, 0xcd, 0xd1, 0xff, 0xc5, 0xa8, 0x34, 0xff, 0xb0, 0x81, 0x04, 0xff, 0x9f, 0xb0, 0x82, 0x0b, 0xff, 0x01, 0xb1, 0x84, 0x0c, 0xff, 0xb4, 0x88, 
+  0x0f, 0x30, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x06, 0xba, 0xba, 0xba, 0x97, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 
+  0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x01, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x03, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcd, 0xd0, 0xff, 
+  0xb7, 0x8b, 0x00, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0x9f, 0xb1, 0x84, 0x0c, 0xff, 0x01, 0xb1, 0x84, 0x0c, 0xfc, 0xb4, 0x87, 0x0d, 0x2b, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb4, 0xb4, 0xb4, 0x18, 
+  0xbb, 0xbb, 0xbb, 0xd8, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x02, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 
+  0xc6, 0xff, 0x82, 0xc7, 0xc7, 0xc7, 0xff, 0x02, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xca, 0xcc, 0xff, 0xb0, 0x80, 0x00, 0xff, 0xa0, 0xb1, 0x85, 0x0c, 0xff, 0x01, 0xb3, 0x87, 0x0d, 0xef, 0xbc, 0x95, 
+  0x14, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x07, 0xb9, 0xb9, 0xb9, 0x33, 0xba, 0xba, 0xba, 0xf7, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 
+  0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc4, 0xc4, 0xc4, 0xff, 0x04, 0xc5, 0xc5, 0xc5, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc2, 0xc5, 0xff, 0xb1, 0x84, 
+  0x00, 0xff, 0xa0, 0xb2, 0x88, 0x0c, 0xff, 0x01, 0xb3, 0x89, 0x0d, 0xcf, 0xcc, 0xae, 0x20, 0x08, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb7, 0xb7, 0xb7, 0x60, 0xba, 0xba, 0xba, 0xfb, 0xbb, 0xbb, 
+  0xbb, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x05, 0xc2, 0xc2, 0xc2, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 
+  0xff, 0xbf, 0xc1, 0xc4, 0xff, 0xb5, 0x91, 0x00, 0xff, 0xb2, 0x89, 0x0a, 0xff, 0x9f, 0xb2, 0x89, 0x0c, 0xff, 0x00, 0xb7, 0x90, 0x11, 0x5f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb9, 0xb9, 0xb9, 
+  0x5b, 0xb9, 0xb9, 0xb9, 0xfb, 0xba, 0xba, 0xba, 0xff, 0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x00, 0xbd, 0xbd, 0xbd, 0xff, 0x82, 0xbf, 0xbf, 0xbf, 0xff, 0x04, 0xbe, 0xbe, 0xbe, 0xff, 0xb9, 0xb9, 0xb9, 
+  0xff, 0xb9, 0xba, 0xbc, 0xff, 0xba, 0xa9, 0x73, 0xff, 0xb3, 0x8a, 0x00, 0xff, 0x9e, 0xb3, 0x8b, 0x0d, 0xff, 0x00, 0xb5, 0x8d, 0x0f, 0xaf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb5, 0xb5, 0xb5, 
+  0x4c, 0xb7, 0xb7, 0xb7, 0xf0, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x01, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x82, 0xbe, 0xbe, 0xbe, 0xff, 
+  0x02, 0xbe, 0xbb, 0xb1, 0xff, 0xb6, 0x94, 0x33, 0xff, 0xb4, 0x8c, 0x08, 0xff, 0x9c, 0xb4, 0x8c, 0x0d, 0xff, 0x01, 0xb5, 0x8c, 0x0d, 0xcf, 0xbb, 0x9f, 0x19, 0x18, 0x93, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0xb8, 0xb8, 0xb8, 0x23, 0xb7, 0xb7, 0xb7, 0xab, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0x81, 0xb9, 0xb9, 0xb9, 0xff, 0x83, 0xba, 0xba, 0xba, 0xff, 0x03, 0xbb, 0xbb, 0xbb, 0xff, 
+  0xba, 0xb6, 0xa8, 0xff, 0xb5, 0x94, 0x0c, 0xff, 0xb4, 0x8d, 0x00, 0xff, 0x9a, 0xb4, 0x8e, 0x0d, 0xff, 0x01, 0xb5, 0x8e, 0x0e, 0x9c, 0xb6, 0x9d, 0x16, 0x13, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0xb6, 0xb6, 0xb6, 0x57, 0xb7, 0xb7, 0xb7, 0xd3, 0xb7, 0xb7, 0xb7, 0xf8, 0xb7, 0xb7, 0xb7, 0xff, 0x82, 0xb8, 0xb8, 0xb8, 0xff, 0x81, 0xb9, 0xb9, 0xb9, 0xff, 0x04, 0xb8, 0xb8, 0xb9, 0xff, 0xb8, 
+  0xb7, 0xb0, 0xff, 0xb7, 0xa2, 0x61, 0xff, 0xb5, 0x93, 0x25, 0xff, 0xb5, 0x90, 0x00, 0xff, 0x81, 0xb5, 0x8f, 0x00, 0xff, 0x01, 0xb5, 0x90, 0x0c, 0xff, 0xb5, 0x8f, 0x0f, 0xff, 0x90, 0xb5, 0x8f, 
+  0x0d, 0xff, 0x03, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xec, 0xb5, 0x8f, 0x0d, 0xbc, 0xb7, 0x90, 0x0d, 0x47, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb3, 0xb3, 0xb3, 0x0c, 0xb6, 0xb6, 0xb6, 
+  0x33, 0xb5, 0xb5, 0xb5, 0x9b, 0xb5, 0xb5, 0xb5, 0xeb, 0x82, 0xb6, 0xb6, 0xb6, 0xff, 0x09, 0xb5, 0xb5, 0xb5, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb6, 0xff, 0xb5, 0xb4, 0xb2, 0xff, 0xb4, 
+  0xb1, 0xa8, 0xff, 0xb4, 0xaf, 0xa5, 0xff, 0xb3, 0xac, 0xa2, 0xff, 0xb2, 0xa9, 0x99, 0xb7, 0xb3, 0xa1, 0x7e, 0x5f, 0xb5, 0x90, 0x00, 0x2f, 0x90, 0xb5, 0x8f, 0x0d, 0x2f, 0x02, 0xb5, 0x8f, 0x0d, 
+  0x28, 0xb5, 0x8e, 0x0d, 0x1c, 0xba, 0x97, 0x14, 0x0b, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb2, 0xb2, 0xb2, 0x38, 0xb4, 0xb4, 0xb4, 0x6f, 0xb4, 0xb4, 0xb4, 0x9b, 0xb4, 0xb4, 0xb4, 0xb8, 0xb3, 
+  0xb3, 0xb3, 0xcb, 0xb3, 0xb3, 0xb3, 0xc0, 0xb3, 0xb3, 0xb3, 0xa7, 0xb2, 0xb2, 0xb2, 0x7f, 0xaf, 0xaf, 0xaf, 0x4c, 0xab, 0xab, 0xab, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +363,7 @@ const lv_img_dsc_t owm_02n_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_02n_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_02n_64px_map,
 };
-
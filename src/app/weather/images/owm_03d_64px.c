@@ -10,271 +10,361 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_03D_64PX uint8_t owm_03d_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x2b, 0xfc, 0x0c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xdc, 0xfc, 0x0c, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0xf4, 0xfc, 0x54, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x73, 0xfc, 0x58, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0x94, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x58, 0xfc, 0xff, 0xfc, 0xbc, 0xf4, 0x00, 0xfc, 0x97, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0x00, 0xfc, 0x54, 0xfc, 0xff, 0xfc, 0xcb, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x34, 0xfc, 0x58, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x33, 0xfc, 0xff, 0xfc, 0xcf, 0xfc, 0x0c, 0xfc, 0xbf, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd0, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xcc, 0xfc, 0xf4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x17, 0xfc, 0x7b, 0xfc, 0xfb, 0xfc, 0xa7, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x90, 0xfc, 0x20, 0xfc, 0x00, 0xfc, 0x5f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xdf, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xcc, 0xfc, 0x00, 0xfc, 0x0c, 0xfc, 0x4c, 0xfc, 0x34, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xaf, 0xfc, 0xa4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0x58, 0xfc, 0xdc, 0xfc, 0xff, 0xfc, 0x3b, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xd7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x2f, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x08, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x2b, 0xfc, 0xd7, 0xfc, 0x88, 0xfc, 0x28, 0xfc, 0xb8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x34, 0xfc, 0x63, 0xfc, 0xb8, 0xfc, 0xb7, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1b, 0xfc, 0xeb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x94, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0xd7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x3b, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x08, 0xfc, 0x67, 0xfc, 0x4b, 0xfc, 0x2f, 0xfc, 0xb4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x28, 0xfc, 0x37, 0xfc, 0x64, 0xfc, 0x34, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x37, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x34, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xcb, 0xfc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xd0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x30, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x1c, 0xfc, 0xb0, 0xfc, 0xdb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xde, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xbc, 0xfc, 0x5f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x83, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xdf, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0xde, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf0, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x07, 0xfc, 0xc8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0xbf, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x50, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x83, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xde, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x9b, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd8, 0xfc, 0x27, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x20, 0xfc, 0xab, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xde, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xfe, 0xe8, 0xfd, 0x67, 0xfc, 0x03, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x13, 0xfc, 0xc4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9b, 0xfb, 0x9f, 0x7c, 0xbf, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xa8, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9b, 0xb7, 0x9f, 0x1c, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x5c, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xc7, 0x9f, 0x1b, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x30, 0xfc, 0xc7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xab, 0x9f, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x6b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xfc, 0x9f, 0x50, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1f, 0xfc, 0xc0, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xde, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xc4, 0x7b, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x44, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x9f, 0x34, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x5f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xbf, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0x78, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x4b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xde, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xab, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xec, 0x03, 0xfc, 0x6f, 0xfc, 0xd0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x57, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xc7, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x98, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xb4, 0x7b, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x43, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x9b, 0xff, 0x7b, 0xd8, 0x9f, 0x54, 0x9f, 0x0c, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x23, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xfc, 0x9b, 0xd4, 0x9f, 0x37, 0x9f, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x2c, 0xfc, 0x50, 0xfc, 0xe3, 0xfd, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xf3, 0x9f, 0x47, 0x7b, 0x00, 0x9f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1b, 0xfc, 0xf3, 0xfd, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xe4, 0x9f, 0x1c, 0x9f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x8b, 0xfc, 0xff, 0xfc, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7f, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xa3, 0x9f, 0x00, 0x9b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0xe4, 0xfc, 0xbc, 0xfc, 0xb3, 0xdd, 0xd3, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x9f, 0x24, 0x9f, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xda, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0x74, 0x7b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x10, 0xfc, 0xe3, 0xfc, 0xff, 0xba, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7b, 0xa8, 0x5b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x2c, 0xfc, 0xec, 0xfc, 0xdb, 0xfc, 0x9f, 0xdd, 0xe0, 0x9b, 0xff, 0x5b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xc0, 0x5b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x0b, 0xfc, 0x20, 0xfc, 0x08, 0xfc, 0x00, 0xfc, 0xd0, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xa8, 0x5b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xe7, 0xfc, 0xff, 0xfc, 0xe3, 0xfc, 0xdc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0x74, 0x5b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xf4, 0xfc, 0x5b, 0xfc, 0x10, 0xfc, 0x6c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x7f, 0x24, 0x7b, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x44, 0xfc, 0xff, 0xfc, 0xf4, 0xfc, 0x77, 0xfc, 0xd3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf4, 0xbb, 0xfb, 0x3b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xa4, 0x5b, 0x00, 0x83, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x18, 0xfc, 0xf3, 0xfc, 0x28, 0xfc, 0x00, 0xfc, 0x80, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x24, 0xdd, 0xcc, 0x1b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xec, 0x5b, 0x20, 0x7f, 0x00, 0x57, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf4, 0x00, 0xfc, 0x07, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x13, 0xfc, 0xff, 0xfc, 0x34, 0xfc, 0x00, 0xfc, 0x30, 0xba, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xf4, 0x5b, 0x50, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x38, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x6f, 0x7b, 0xb3, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xd4, 0x5b, 0x33, 0x17, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x7b, 0x00, 0x5b, 0x5c, 0x5b, 0xd3, 0x5b, 0xf4, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xff, 0x5b, 0xfc, 0x5b, 0xf3, 0x5b, 0xd3, 0x5b, 0x70, 0x7b, 0x07, 0x5b, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x9f, 0x00, 0x13, 0x00, 0x5b, 0x10, 0x5b, 0x23, 0x5b, 0x2c, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2f, 0x5b, 0x2c, 0x3b, 0x20, 0x5b, 0x10, 0x01, 0x00, 0x5b, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0x82, 0x00, 0x00, 0x01, 0xfc, 0x2b, 0xfc, 0x0c, 0x81, 0x00, 
+  0x00, 0x01, 0xfc, 0x03, 0xfc, 0x04, 0xb5, 0x00, 0x00, 0x01, 0xfc, 0xdc, 0xfc, 0x0c, 0x81, 0x00, 0x00, 0x01, 0xfc, 0xf4, 0xfc, 0x54, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x73, 0xfc, 0x58, 0xb0, 0x00, 
+  0x00, 0x0e, 0xfc, 0x0f, 0xfc, 0x94, 0xfc, 0x04, 0x00, 0x00, 0xfc, 0x58, 0xfc, 0xff, 0xfc, 0xbc, 0x00, 0x00, 0xfc, 0x97, 0xfc, 0xff, 0xfc, 0xf7, 0x00, 0x00, 0xfc, 0x54, 0xfc, 0xff, 0xfc, 0xcb, 
+  0x81, 0x00, 0x00, 0x01, 0xfc, 0x34, 0xfc, 0x58, 0xac, 0x00, 0x00, 0x04, 0xfc, 0x33, 0xfc, 0xff, 0xfc, 0xcf, 0xfc, 0x0c, 0xfc, 0xbf, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xd0, 0xfc, 0xf3, 0x81, 0xfc, 
+  0xff, 0x01, 0xfc, 0xcc, 0xfc, 0xf4, 0x81, 0xfc, 0xff, 0x03, 0xfc, 0x17, 0xfc, 0x7b, 0xfc, 0xfb, 0xfc, 0xa7, 0xa9, 0x00, 0x00, 0x03, 0xfc, 0x90, 0xfc, 0x20, 0x00, 0x00, 0xfc, 0x5f, 0x82, 0xfc, 
+  0xff, 0x00, 0xfc, 0xf7, 0x89, 0xfc, 0xff, 0x00, 0xfc, 0xdf, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0xcc, 0x00, 0x00, 0xfc, 0x0c, 0xfc, 0x4c, 0xfc, 0x34, 0xa5, 0x00, 0x00, 0x81, 0xfc, 0xf3, 0x01, 0xfc, 
+  0xaf, 0xfc, 0xa4, 0x90, 0xfc, 0xff, 0x04, 0xfc, 0xf7, 0xfc, 0x58, 0xfc, 0xdc, 0xfc, 0xff, 0xfc, 0x3b, 0xa1, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x82, 0x00, 0x00, 0x00, 0xfc, 0xd7, 0x97, 0xfc, 0xff, 
+  0x00, 0xfc, 0x2f, 0x81, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x9e, 0x00, 0x00, 0x04, 0xfc, 0x2b, 0xfc, 0xd7, 0xfc, 0x88, 0xfc, 0x28, 0xfc, 0xb8, 0x96, 0xfc, 0xff, 0x04, 0xfc, 0xf8, 0xfc, 0x34, 0xfc, 
+  0x63, 0xfc, 0xb8, 0xfc, 0xb7, 0x9e, 0x00, 0x00, 0x01, 0xfc, 0x1b, 0xfc, 0xeb, 0x9d, 0xfc, 0xff, 0x00, 0xfc, 0x94, 0x9e, 0x00, 0x00, 0x01, 0xfc, 0x03, 0xfc, 0xd7, 0x9d, 0xfc, 0xff, 0x00, 0xfc, 
+  0x3b, 0x9b, 0x00, 0x00, 0x04, 0xfc, 0x08, 0xfc, 0x67, 0xfc, 0x4b, 0xfc, 0x2f, 0xfc, 0xb4, 0x9d, 0xfc, 0xff, 0x03, 0xfc, 0x28, 0xfc, 0x37, 0xfc, 0x64, 0xfc, 0x34, 0x99, 0x00, 0x00, 0x00, 0xfc, 
+  0xc8, 0xa3, 0xfc, 0xff, 0x00, 0xfc, 0x37, 0x99, 0x00, 0x00, 0x00, 0xfc, 0x34, 0xa2, 0xfc, 0xff, 0x01, 0xfc, 0xcb, 0xfc, 0x04, 0x9a, 0x00, 0x00, 0x00, 0xfc, 0xd0, 0xa1, 0xfc, 0xff, 0x00, 0xfc, 
+  0x30, 0x97, 0x00, 0x00, 0x02, 0xfc, 0x1c, 0xfc, 0xb0, 0xfc, 0xdb, 0x91, 0xfc, 0xff, 0x09, 0xfd, 0xff, 0xfe, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0xbf, 0xff, 0xde, 
+  0xff, 0xfe, 0xff, 0x88, 0xfc, 0xff, 0x02, 0xfc, 0xec, 0xfc, 0xbc, 0xfc, 0x5f, 0x95, 0x00, 0x00, 0x00, 0xfc, 0x83, 0x91, 0xfc, 0xff, 0x02, 0xdf, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x81, 0x5b, 0xff, 
+  0x81, 0x57, 0xff, 0x82, 0x5b, 0xff, 0x02, 0x7b, 0xff, 0x9b, 0xff, 0xde, 0xff, 0x87, 0xfc, 0xff, 0x01, 0xfc, 0xf0, 0xfc, 0x1f, 0x95, 0x00, 0x00, 0x01, 0xfc, 0x07, 0xfc, 0xc8, 0x8e, 0xfc, 0xff, 
+  0x01, 0xfe, 0xff, 0x9b, 0xff, 0x8c, 0x5b, 0xff, 0x01, 0xbf, 0xff, 0xfd, 0xff, 0x85, 0xfc, 0xff, 0x00, 0xfc, 0x50, 0x97, 0x00, 0x00, 0x00, 0xfc, 0x83, 0x8d, 0xfc, 0xff, 0x01, 0xde, 0xff, 0x7b, 
+  0xff, 0x8e, 0x5b, 0xff, 0x01, 0x9b, 0xff, 0xfd, 0xff, 0x83, 0xfc, 0xff, 0x01, 0xfc, 0xd8, 0xfc, 0x27, 0x94, 0x00, 0x00, 0x01, 0xfc, 0x20, 0xfc, 0xab, 0x8e, 0xfc, 0xff, 0x01, 0xde, 0xff, 0x7b, 
+  0xff, 0x90, 0x5b, 0xff, 0x09, 0x9b, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xfe, 0xe8, 0xfd, 0x67, 0xfc, 0x03, 0x91, 0x00, 0x00, 0x01, 0xfc, 0x13, 0xfc, 
+  0xc4, 0x8d, 0xfc, 0xff, 0x01, 0xfd, 0xff, 0x7b, 0xff, 0x98, 0x5b, 0xff, 0x03, 0x7b, 0xff, 0x9b, 0xfb, 0x9f, 0x7c, 0xbf, 0x07, 0x92, 0x00, 0x00, 0x01, 0xfc, 0xa8, 0xfc, 0xfc, 0x8b, 0xfc, 0xff, 
+  0x00, 0xbf, 0xff, 0x9b, 0x5b, 0xff, 0x02, 0x7b, 0xff, 0x9b, 0xb7, 0x9f, 0x1c, 0x91, 0x00, 0x00, 0x01, 0xfc, 0x5c, 0xfc, 0xfb, 0x8a, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x9e, 0x5b, 0xff, 0x01, 0x7b, 
+  0xc7, 0x9f, 0x1b, 0x8e, 0x00, 0x00, 0x01, 0xfc, 0x30, 0xfc, 0xc7, 0x8c, 0xfc, 0xff, 0x00, 0xbf, 0xff, 0x9f, 0x5b, 0xff, 0x01, 0x7b, 0xab, 0x9f, 0x07, 0x8d, 0x00, 0x00, 0x00, 0xfc, 0x6b, 0x8a, 
+  0xfc, 0xff, 0x03, 0xde, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0x9f, 0x5b, 0xff, 0x01, 0x5b, 0xfc, 0x9f, 0x50, 0x8e, 0x00, 0x00, 0x02, 0xfc, 0x1f, 0xfc, 0xc0, 0xfc, 0xfc, 0x85, 0xfc, 0xff, 
+  0x01, 0xde, 0xff, 0x9b, 0xff, 0xa4, 0x5b, 0xff, 0x00, 0x7b, 0xc4, 0x8f, 0x00, 0x00, 0x01, 0xfc, 0x44, 0xfc, 0xfc, 0x84, 0xfc, 0xff, 0x00, 0xbf, 0xff, 0xa7, 0x5b, 0xff, 0x00, 0x9f, 0x34, 0x8d, 
+  0x00, 0x00, 0x00, 0xfc, 0x5f, 0x85, 0xfc, 0xff, 0x00, 0xbf, 0xff, 0x9b, 0x5b, 0xff, 0x81, 0x7b, 0xff, 0x8a, 0x5b, 0xff, 0x00, 0x7b, 0x78, 0x8c, 0x00, 0x00, 0x00, 0xfc, 0x4b, 0x85, 0xfc, 0xff, 
+  0x00, 0xde, 0xff, 0x98, 0x5b, 0xff, 0x01, 0x7b, 0xff, 0x9b, 0xff, 0x86, 0x7b, 0xff, 0x87, 0x5b, 0xff, 0x00, 0x5b, 0xab, 0x8d, 0x00, 0x00, 0x02, 0xec, 0x03, 0xfc, 0x6f, 0xfc, 0xd0, 0x82, 0xfc, 
+  0xff, 0x00, 0x9b, 0xff, 0x97, 0x5b, 0xff, 0x81, 0x7b, 0xff, 0x01, 0x5b, 0xff, 0x57, 0xff, 0x83, 0x5b, 0xff, 0x01, 0x57, 0xff, 0x5b, 0xff, 0x81, 0x7b, 0xff, 0x85, 0x5b, 0xff, 0x00, 0x5b, 0xc7, 
+  0x8f, 0x00, 0x00, 0x00, 0xfc, 0x98, 0x81, 0xfc, 0xff, 0x01, 0xfd, 0xff, 0x7b, 0xff, 0x95, 0x5b, 0xff, 0x81, 0x7b, 0xff, 0x8b, 0x5b, 0xff, 0x00, 0x7b, 0xff, 0x84, 0x5b, 0xff, 0x00, 0x5b, 0xb4, 
+  0x8e, 0x00, 0x00, 0x01, 0xfc, 0x43, 0xfc, 0xfc, 0x81, 0xfc, 0xff, 0x00, 0xfe, 0xff, 0x96, 0x5b, 0xff, 0x00, 0x7b, 0xff, 0x8d, 0x5b, 0xff, 0x81, 0x7b, 0xff, 0x82, 0x9b, 0xff, 0x02, 0x7b, 0xd8, 
+  0x9f, 0x54, 0x9f, 0x0c, 0x8b, 0x00, 0x00, 0x00, 0xfc, 0x23, 0x83, 0xfc, 0xff, 0x01, 0xfe, 0xff, 0x3b, 0xff, 0x94, 0x5b, 0xff, 0x00, 0x7b, 0xff, 0x94, 0x5b, 0xff, 0x02, 0x7b, 0xfc, 0x9b, 0xd4, 
+  0x9f, 0x37, 0x8c, 0x00, 0x00, 0x03, 0xfc, 0x2c, 0xfc, 0x50, 0xfc, 0xe3, 0xfd, 0xff, 0xad, 0x5b, 0xff, 0x01, 0x7b, 0xf3, 0x9f, 0x47, 0x8c, 0x00, 0x00, 0x02, 0xfc, 0x1b, 0xfc, 0xf3, 0xfd, 0xff, 
+  0x93, 0x5b, 0xff, 0x01, 0x3b, 0xff, 0x7b, 0xff, 0x98, 0x5b, 0xff, 0x01, 0x7b, 0xe4, 0x9f, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0xfc, 0x8b, 0x81, 0xfc, 0xff, 0x00, 0x9b, 0xff, 0x90, 0x5b, 0xff, 0x81, 
+  0x7b, 0xff, 0x00, 0x7f, 0xff, 0x9a, 0x5b, 0xff, 0x00, 0x7b, 0xa3, 0x8a, 0x00, 0x00, 0x05, 0xfc, 0x10, 0xfc, 0xe4, 0xfc, 0xbc, 0xfc, 0xb3, 0xdd, 0xd3, 0x3b, 0xff, 0x8d, 0x5b, 0xff, 0x81, 0x7b, 
+  0xff, 0x9e, 0x5b, 0xff, 0x00, 0x9f, 0x24, 0x8d, 0x00, 0x00, 0x02, 0xfc, 0xc0, 0xda, 0xff, 0x3b, 0xff, 0x8c, 0x5b, 0xff, 0x00, 0x7b, 0xff, 0x9f, 0x5b, 0xff, 0x00, 0x7b, 0x74, 0x8c, 0x00, 0x00, 
+  0x03, 0xfc, 0x10, 0xfc, 0xe3, 0xfc, 0xff, 0xba, 0xff, 0x81, 0x3b, 0xff, 0x89, 0x5b, 0xff, 0x00, 0x7b, 0xff, 0xa0, 0x5b, 0xff, 0x00, 0x7b, 0xa8, 0x8c, 0x00, 0x00, 0x06, 0xfc, 0x2c, 0xfc, 0xec, 
+  0xfc, 0xdb, 0xfc, 0x9f, 0xdd, 0xe0, 0x9b, 0xff, 0x5b, 0xff, 0x87, 0x3b, 0xff, 0xa2, 0x5b, 0xff, 0x00, 0x5b, 0xc0, 0x8c, 0x00, 0x00, 0x05, 0xfc, 0x0b, 0xfc, 0x20, 0xfc, 0x08, 0x00, 0x00, 0xfc, 
+  0xd0, 0xfc, 0xff, 0x81, 0xfd, 0xff, 0x86, 0xfe, 0xff, 0x00, 0x9b, 0xff, 0xa1, 0x5b, 0xff, 0x00, 0x5b, 0xa8, 0x90, 0x00, 0x00, 0x03, 0xfc, 0xe7, 0xfc, 0xff, 0xfc, 0xe3, 0xfc, 0xdc, 0x86, 0xfc, 
+  0xff, 0x00, 0x9b, 0xff, 0xa1, 0x5b, 0xff, 0x00, 0x5b, 0x74, 0x90, 0x00, 0x00, 0x03, 0xfc, 0xf4, 0xfc, 0x5b, 0xfc, 0x10, 0xfc, 0x6c, 0x86, 0xfc, 0xff, 0x00, 0x9b, 0xff, 0xa1, 0x5b, 0xff, 0x00, 
+  0x7f, 0x24, 0x93, 0x00, 0x00, 0x04, 0xfc, 0x44, 0xfc, 0xff, 0xfc, 0xf4, 0xfc, 0x77, 0xfc, 0xd3, 0x81, 0xfc, 0xff, 0x02, 0xfc, 0xf4, 0xbb, 0xfb, 0x3b, 0xff, 0x9f, 0x5b, 0xff, 0x00, 0x5b, 0xa4, 
+  0x94, 0x00, 0x00, 0x04, 0xfc, 0x18, 0xfc, 0xf3, 0xfc, 0x28, 0x00, 0x00, 0xfc, 0x80, 0x81, 0xfc, 0xff, 0x02, 0xfc, 0x24, 0xdd, 0xcc, 0x1b, 0xff, 0x9e, 0x5b, 0xff, 0x01, 0x5b, 0xec, 0x5b, 0x20, 
+  0x95, 0x00, 0x00, 0x00, 0xfc, 0x07, 0x81, 0x00, 0x00, 0x05, 0xfc, 0x13, 0xfc, 0xff, 0xfc, 0x34, 0x00, 0x00, 0xfc, 0x30, 0xba, 0xff, 0x9d, 0x5b, 0xff, 0x01, 0x5b, 0xf4, 0x5b, 0x50, 0x9a, 0x00, 
+  0x00, 0x00, 0xfc, 0x38, 0x82, 0x00, 0x00, 0x01, 0xfc, 0x6f, 0x7b, 0xb3, 0x9b, 0x5b, 0xff, 0x01, 0x5b, 0xd4, 0x5b, 0x33, 0xa1, 0x00, 0x00, 0x02, 0x5b, 0x5c, 0x5b, 0xd3, 0x5b, 0xf4, 0x94, 0x5b, 
+  0xff, 0x04, 0x5b, 0xfc, 0x5b, 0xf3, 0x5b, 0xd3, 0x5b, 0x70, 0x7b, 0x07, 0xa3, 0x00, 0x00, 0x02, 0x5b, 0x10, 0x5b, 0x23, 0x5b, 0x2c, 0x93, 0x5b, 0x2f, 0x02, 0x5b, 0x2c, 0x3b, 0x20, 0x5b, 0x10, 
+  0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x86, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x00, 0x80, 0xff, 0x0f, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x2b, 0x40, 0xff, 0x0c, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x03, 0x80, 0xff, 0x04, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0xa0, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0x20, 0xff, 0xdc, 0x80, 0xff, 0x0c, 0x41, 0xff, 0x00, 0x61, 0xfe, 0x00, 0x20, 0xff, 0xf4, 0x20, 0xff, 0x54, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x73, 0x40, 0xff, 0x58, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x0f, 0x40, 0xff, 0x94, 0x60, 0xff, 0x04, 0x40, 0xff, 0x00, 0x60, 0xff, 0x58, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xbc, 0xa2, 0xec, 0x00, 0x41, 0xff, 0x97, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xf7, 0xe4, 0xff, 0x00, 0x60, 0xff, 0x54, 0x00, 0xff, 0xff, 0x00, 0xff, 0xcb, 0x20, 0xff, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x34, 0x40, 0xff, 0x58, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xff, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x33, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xcf, 0xa1, 0xff, 0x0c, 0x00, 0xff, 0xbf, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xd0, 0xe0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x41, 0xff, 0xcc, 0x00, 0xff, 0xf4, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc1, 0xff, 0x17, 0x60, 0xff, 0x7b, 0x00, 0xff, 0xfb, 0x00, 0xff, 0xa7, 0x20, 0xff, 0x00, 0x20, 0xff, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x90, 0x60, 0xff, 0x20, 0x20, 0xff, 0x00, 0x20, 0xff, 0x5f, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xf7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xdf, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xcc, 0x20, 0xff, 0x00, 0x81, 0xff, 0x0c, 0x40, 0xff, 0x4c, 0x40, 0xff, 0x34, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xf3, 0x00, 0xff, 0xf3, 0x60, 0xff, 0xaf, 0x20, 0xff, 0xa4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xf7, 0x61, 0xff, 0x58, 0x20, 0xff, 0xdc, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0x3b, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x40, 0xff, 0x04, 0xe0, 0xff, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xd7, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x2f, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x80, 0xff, 0x08, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0x2b, 0x40, 0xff, 0xd7, 0x60, 0xff, 0x88, 0x81, 0xff, 0x28, 0xe0, 0xfe, 0xb8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0x00, 0xff, 0x34, 0x60, 0xff, 0x63, 0x60, 0xff, 0xb8, 0x40, 0xff, 0xb7, 0xe0, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x1b, 0xc0, 0xfe, 0xeb, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x21, 0xff, 0xff, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x94, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x00, 0xe0, 0xff, 0x03, 0xc0, 0xfe, 0xd7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x3b, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xa0, 0xff, 0x08, 0x40, 0xff, 0x67, 0x60, 0xff, 0x4b, 0x81, 0xff, 0x2f, 0xe0, 0xfe, 0xb4, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xa1, 0xff, 0x28, 0x60, 0xff, 0x37, 0x40, 0xff, 0x64, 0x60, 0xff, 0x34, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0xe0, 0xfe, 0xc8, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0x37, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x00, 0xe0, 0xfe, 0x34, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xcb, 0x60, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x61, 0xff, 0x00, 0xc0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x30, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x1c, 0x40, 0xff, 0xb0, 0x40, 0xff, 0xdb, 0x40, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x47, 0xf7, 0xff, 0x0f, 0xdf, 0xff, 0xd4, 0xb6, 0xff, 0x9a, 0x96, 0xff, 0x7d, 0x7e, 0xff, 0x7f, 0x76, 0xff, 0x9c, 0x86, 0xff, 0xb8, 0x9e, 0xff, 0xd3, 0xbe, 0xff, 0x0c, 0xef, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xec, 0x40, 0xff, 0xbc, 0x40, 0xff, 0x5f, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0xe0, 0xfe, 0x83, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xf7, 0xff, 0xf4, 0xbe, 0xff, 0x5c, 0x7e, 0xff, 0xde, 0x55, 0xff, 0xbe, 0x4d, 0xff, 0x9e, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0xbe, 0x4d, 0xff, 0xbe, 0x4d, 0xff, 0xfd, 0x65, 0xff, 0x7b, 0x8e, 0xff, 0xee, 0xd6, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf0, 0x00, 0xff, 0x1f, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xa0, 0xfe, 0x07, 0xc0, 0xfe, 0xc8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0x7a, 0x8e, 0xff, 0xde, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0xff, 0x55, 0xff, 0xb6, 0xa6, 0xff, 0x07, 0xf7, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x50, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0xff, 0x83, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xff, 0x0f, 0xcf, 0xff, 0x1d, 0x6e, 0xff, 0x9e, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0xbe, 0x4d, 0xff, 0x5b, 0x86, 0xff, 0xe5, 0xee, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xd8, 0xc0, 0xff, 0x27, 0x28, 0xe7, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x20, 0x40, 0xff, 0xab, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x0e, 0xd7, 0xff, 0x1e, 0x56, 0xff, 0x9d, 0x45, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x5c, 0x76, 0xff, 0xb5, 0xae, 0xff, 0x9a, 0x8e, 0xff, 0x9e, 0x76, 0xff, 0x9e, 0x76, 0xff, 0x9a, 0x8e, 0xff, 0xd4, 0xb6, 0xff, 0x0f, 0xd7, 0xe8, 0x29, 0xef, 0x67, 0xe0, 0xff, 0x03, 0xff, 0x8e, 0x00, 0xdf, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x13, 0xc0, 0xfe, 0xc4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x28, 0xef, 0xff, 0x3b, 0x76, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbe, 0x4d, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xde, 0x4d, 0xff, 0xfd, 0x5d, 0xff, 0x7c, 0x86, 0xfb, 0xbe, 0x8e, 0x7c, 0x3f, 0x9f, 0x07, 0xdf, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0xa8, 0xc0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0xb6, 0xa6, 0xff, 0xbe, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xfe, 0x5d, 0xff, 0x9e, 0x7e, 0xb7, 0xdf, 0x8e, 0x1c, 0xdf, 0x86, 0x00, 0xbe, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x5c, 0xe0, 0xfe, 0xfb, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x29, 0xdf, 0xff, 0xde, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xde, 0x4d, 0xff, 0x7e, 0x76, 0xc7, 0xdf, 0x8e, 0x1b, 0xdf, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x60, 0xff, 0x30, 0x40, 0xff, 0xc7, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0xb6, 0xa6, 0xff, 0xbe, 0x3d, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xde, 0x4d, 0xff, 0x7e, 0x76, 0xab, 0x1f, 0x8f, 0x07, 0xde, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xff, 0x6b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0x20, 0xf7, 0xff, 0x0d, 0xd7, 0xff, 0x16, 0xbf, 0xff, 0xfb, 0xae, 0xff, 0xfd, 0x5d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xfe, 0x4d, 0xfc, 0x9e, 0x7e, 0x50, 0xde, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x1f, 0xc0, 0xfe, 0xc0, 0xc0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf0, 0xc6, 0xff, 0x9c, 0x76, 0xff, 0x1f, 0x4e, 0xff, 0xfe, 0x45, 0xff, 0xbd, 0x3d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0x5e, 0x66, 0xc4, 0x5d, 0x5e, 0x00, 0xdf, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x44, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xb9, 0x9e, 0xff, 0x1d, 0x4e, 0xff, 0xde, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xfe, 0x4d, 0xff, 0xff, 0x86, 0x34, 0xbf, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0xe0, 0xff, 0x00, 0x40, 0xff, 0x5f, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xd5, 0xa6, 0xff, 0xfe, 0x3d, 0xff, 0xdd, 0x3d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x3d, 0xff, 0xfd, 0x45, 0xff, 0xfe, 0x4d, 0xff, 0x1e, 0x56, 0xff, 0x1e, 0x56, 0xff, 0x1e, 0x56, 0xff, 0x1e, 0x56, 0xff, 0xfe, 0x4d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x3d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x3d, 0xff, 0x9e, 0x6e, 0x78, 0x7e, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x4b, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xec, 0xce, 0xff, 0x1e, 0x3e, 0xff, 0xde, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x3e, 0x66, 0xff, 0x7e, 0x76, 0xff, 0x3e, 0x6e, 0xff, 0xfe, 0x65, 0xff, 0xfe, 0x5d, 0xff, 0xfe, 0x65, 0xff, 0x1e, 0x66, 0xff, 0x3e, 0x6e, 0xff, 0x7e, 0x76, 0xff, 0x1e, 0x56, 0xff, 0xde, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xde, 0x3d, 0xff, 0x3e, 0x56, 0xab, 0x3e, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x20, 0xff, 0x00, 0xe0, 0xfa, 0x03, 0xc0, 0xfe, 0x6f, 0xc0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x7a, 0x7e, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x1e, 0x4e, 0xff, 0x5e, 0x6e, 0xff, 0xfe, 0x65, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0xbd, 0x55, 0xff, 0x3e, 0x6e, 0xff, 0x5e, 0x66, 0xff, 0xfe, 0x45, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x1e, 0x46, 0xc7, 0x1e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x00, 0x80, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0x98, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc8, 0xf6, 0xff, 0x1c, 0x56, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x3e, 0x56, 0xff, 0x1e, 0x66, 0xff, 0xbd, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x4d, 0xff, 0xde, 0x55, 0xff, 0x5e, 0x6e, 0xff, 0x1e, 0x46, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfd, 0x3d, 0xb4, 0x5e, 0x66, 0x00, 0xdf, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x43, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xcd, 0xee, 0xff, 0x1d, 0x3e, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x3e, 0x4e, 0xff, 0x3e, 0x66, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0x5e, 0x6e, 0xff, 0x7e, 0x76, 0xff, 0x7e, 0x7e, 0xff, 0x7e, 0x7e, 0xff, 0x7e, 0x76, 0xff, 0x7e, 0x76, 0xd8, 0xbf, 0x86, 0x54, 0xff, 0x96, 0x0c, 0xdf, 0x8e, 0x00, 0xbf, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x23, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xae, 0xee, 0xff, 0x1e, 0x2e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x46, 0xff, 0x3e, 0x5e, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x4d, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x4d, 0xff, 0xde, 0x4d, 0xff, 0xfe, 0x5d, 0xfc, 0x7e, 0x76, 0xd4, 0xbf, 0x8e, 0x37, 0xdf, 0x86, 0x00, 0xde, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x00, 0x20, 0xff, 0x00, 0xc0, 0xfe, 0x2c, 0xc0, 0xfe, 0x50, 0xc0, 0xfe, 0xe3, 0xab, 0xee, 0xff, 0x1d, 0x36, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x3e, 0x56, 0xff, 0xde, 0x4d, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0x5e, 0x6e, 0xf3, 0xde, 0x86, 0x47, 0x9e, 0x66, 0x00, 0xbf, 0x86, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0x80, 0xfe, 0x00, 0x41, 0xff, 0x1b, 0xe0, 0xfe, 0xf3, 0xc6, 0xf6, 0xff, 0x3c, 0x56, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0xfd, 0x2d, 0xff, 0x3e, 0x5e, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0xbd, 0x45, 0xff, 0x3e, 0x66, 0xe4, 0xdf, 0x86, 0x1c, 0x9f, 0x86, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x8b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x57, 0x86, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x36, 0xff, 0x3e, 0x46, 0xff, 0x5e, 0x56, 0xff, 0x7e, 0x66, 0xff, 0x9e, 0x6e, 0xff, 0xfe, 0x4d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0x7e, 0x76, 0xa3, 0xbf, 0x76, 0x00, 0x7d, 0x96, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0xc0, 0xff, 0x10, 0xe0, 0xfe, 0xe4, 0xc0, 0xfe, 0xbc, 0xc0, 0xfe, 0xb3, 0xa6, 0xd6, 0xd3, 0x3c, 0x2e, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x7e, 0x5e, 0xff, 0x7e, 0x66, 0xff, 0x1e, 0x56, 0xff, 0xfe, 0x4d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0x1e, 0x56, 0xff, 0x3f, 0x97, 0x24, 0xdf, 0x86, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0xc0, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0xe0, 0xfe, 0xc0, 0x8f, 0xb6, 0xff, 0x1d, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x5e, 0x4e, 0xff, 0x3e, 0x5e, 0xff, 0xdd, 0x3d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x3d, 0xff, 0x9e, 0x6e, 0x74, 0x7e, 0x6e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x10, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xff, 0x8f, 0xb6, 0xff, 0x3c, 0x26, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x5e, 0x3e, 0xff, 0x5e, 0x5e, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xde, 0x3d, 0xff, 0x3e, 0x56, 0xa8, 0x3e, 0x56, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x00, 0xff, 0x2c, 0xc0, 0xfe, 0xec, 0xc0, 0xfe, 0xdb, 0xc0, 0xfe, 0x9f, 0xa6, 0xd6, 0xe0, 0x57, 0x86, 0xff, 0x3c, 0x4e, 0xff, 0x3d, 0x2e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x1e, 0x1e, 0xff, 0x7e, 0x56, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x1e, 0x46, 0xc0, 0xfe, 0x45, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0xe0, 0xfe, 0x0b, 0xc0, 0xfe, 0x20, 0xc0, 0xfe, 0x08, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0xc6, 0xf6, 0xff, 0xcb, 0xee, 0xff, 0xae, 0xee, 0xff, 0xce, 0xee, 0xff, 0xce, 0xee, 0xff, 0xce, 0xee, 0xff, 0xce, 0xee, 0xff, 0xce, 0xee, 0xff, 0xce, 0xee, 0xff, 0x5b, 0x86, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x45, 0xa8, 0xfe, 0x45, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xe7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xdc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x3b, 0x86, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0xfe, 0x3d, 0xff, 0x3e, 0x4e, 0x74, 0x3e, 0x4e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xf4, 0xc0, 0xfe, 0x5b, 0xc0, 0xfe, 0x10, 0xe0, 0xfe, 0x6c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x3a, 0x8e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0xbe, 0x66, 0x24, 0x7e, 0x5e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x9f, 0x00, 0xe0, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x20, 0xff, 0x44, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0x77, 0xc0, 0xfe, 0xd3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf4, 0x74, 0x9e, 0xfb, 0x1e, 0x36, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x3e, 0x3e, 0xa4, 0xde, 0x45, 0x00, 0x18, 0x70, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0xa0, 0xfe, 0x00, 0x20, 0xff, 0x00, 0x80, 0xff, 0x18, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0x28, 0xa0, 0xfe, 0x00, 0xe0, 0xfe, 0x80, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x24, 0xa7, 0xce, 0xcc, 0x1d, 0x0e, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x3e, 0xec, 0x3e, 0x46, 0x20, 0xde, 0x5e, 0x00, 0x76, 0x3d, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfd, 0x00, 0xc0, 0xfc, 0x00, 0x40, 0xff, 0x07, 0xc0, 0xfe, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x13, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x34, 0xe0, 0xfe, 0x00, 0x00, 0xff, 0x30, 0x72, 0x9e, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xff, 0x1e, 0x36, 0xf4, 0x3e, 0x3e, 0x50, 0xfd, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf6, 0x00, 0x60, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x38, 0xe0, 0xfe, 0x00, 0xa2, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xf6, 0x6f, 0x3c, 0x66, 0xb3, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xd4, 0x5e, 0x3e, 0x33, 0x5e, 0x05, 0x00, 0xfe, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0x1c, 0x6e, 0x00, 0x3e, 0x36, 0x5c, 0x3e, 0x36, 0xd3, 0x3e, 0x36, 0xf4, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xff, 0x3e, 0x36, 0xfc, 0x3e, 0x36, 0xf3, 0x3e, 0x36, 0xd3, 0x3e, 0x36, 0x70, 0x7f, 0x66, 0x07, 0x7e, 0x46, 0x00, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x56, 0x00, 0xbc, 0x87, 0x00, 0xbc, 0x03, 0x00, 0x3e, 0x36, 0x10, 0x3e, 0x36, 0x23, 0x3e, 0x36, 0x2c, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2f, 0x3e, 0x36, 0x2c, 0x3e, 0x36, 0x20, 0x3e, 0x3e, 0x10, 0x0a, 0x00, 0x00, 0x5e, 0x4e, 0x00, 0x3e, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x0f, 0x82, 0x00, 0x00, 0x00, 
+  0x01, 0x60, 0xff, 0x2b, 0x40, 0xff, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x03, 0x80, 0xff, 0x04, 0xb5, 0x00, 0x00, 0x00, 0x01, 0x20, 0xff, 0xdc, 0x80, 0xff, 0x0c, 0x81, 0x00, 0x00, 
+  0x00, 0x01, 0x20, 0xff, 0xf4, 0x20, 0xff, 0x54, 0x81, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x73, 0x40, 0xff, 0x58, 0xb0, 0x00, 0x00, 0x00, 0x0e, 0x40, 0xff, 0x0f, 0x40, 0xff, 0x94, 0x60, 0xff, 
+  0x04, 0x00, 0x00, 0x00, 0x60, 0xff, 0x58, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x41, 0xff, 0x97, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x60, 0xff, 0x54, 0x00, 
+  0xff, 0xff, 0x00, 0xff, 0xcb, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x34, 0x40, 0xff, 0x58, 0xac, 0x00, 0x00, 0x00, 0x04, 0x60, 0xff, 0x33, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xcf, 0xa1, 0xff, 
+  0x0c, 0x00, 0xff, 0xbf, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x40, 0xff, 0xd0, 0xe0, 0xfe, 0xf3, 0x81, 0xc0, 0xfe, 0xff, 0x07, 0x41, 0xff, 0xcc, 0x00, 0xff, 0xf4, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 
+  0xc1, 0xff, 0x17, 0x60, 0xff, 0x7b, 0x00, 0xff, 0xfb, 0x00, 0xff, 0xa7, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x40, 0xff, 0x90, 0x60, 0xff, 0x20, 0x00, 0x00, 0x00, 0x20, 0xff, 0x5f, 0x81, 0xc0, 0xfe, 
+  0xff, 0x01, 0x20, 0xff, 0xff, 0xe0, 0xfe, 0xf7, 0x89, 0xc0, 0xfe, 0xff, 0x07, 0x20, 0xff, 0xdf, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xcc, 0x00, 0x00, 0x00, 0x81, 0xff, 0x0c, 0x40, 
+  0xff, 0x4c, 0x40, 0xff, 0x34, 0xa5, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xfe, 0xf3, 0x00, 0xff, 0xf3, 0x60, 0xff, 0xaf, 0x20, 0xff, 0xa4, 0x82, 0xc0, 0xfe, 0xff, 0x8b, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 
+  0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xf7, 0x61, 0xff, 0x58, 0x20, 0xff, 0xdc, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0x3b, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0xe0, 
+  0xfe, 0xd7, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x8f, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x2f, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x9e, 0x00, 0x00, 0x00, 0x04, 0x20, 0xff, 0x2b, 0x40, 0xff, 0xd7, 0x60, 0xff, 0x88, 0x81, 0xff, 0x28, 0xe0, 0xfe, 0xb8, 0x81, 0xc0, 0xfe, 0xff, 
+  0x85, 0xe0, 0xfe, 0xff, 0x87, 0xe1, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x05, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0x00, 0xff, 0x34, 0x60, 0xff, 0x63, 0x60, 0xff, 0xb8, 0x40, 0xff, 0xb7, 0x9e, 
+  0x00, 0x00, 0x00, 0x03, 0xc0, 0xfe, 0x1b, 0xc0, 0xfe, 0xeb, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x87, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 
+  0x85, 0xe0, 0xfe, 0xff, 0x03, 0x21, 0xff, 0xff, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x94, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xff, 0x03, 0xc0, 0xfe, 0xd7, 0x81, 0xc0, 0xfe, 0xff, 
+  0x84, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x8d, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0x20, 0xff, 0x3b, 0x9b, 0x00, 0x00, 0x00, 
+  0x05, 0xa0, 0xff, 0x08, 0x40, 0xff, 0x67, 0x60, 0xff, 0x4b, 0x81, 0xff, 0x2f, 0xe0, 0xfe, 0xb4, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x8f, 0x01, 0xff, 0xff, 0x81, 
+  0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x04, 0xc0, 0xfe, 0xff, 0xa1, 0xff, 0x28, 0x60, 0xff, 0x37, 0x40, 0xff, 0x64, 0x60, 0xff, 0x34, 0x99, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xc8, 0x86, 
+  0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x89, 0x21, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x00, 0x00, 0xff, 0x37, 0x99, 
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x34, 0x82, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x8b, 0x21, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 0x00, 
+  0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xcb, 0x60, 0xff, 0x04, 0x9a, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 
+  0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x83, 0x40, 0xff, 0xff, 0x83, 0x20, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 
+  0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x30, 0x97, 0x00, 0x00, 0x00, 0x05, 0x60, 0xff, 0x1c, 0x40, 0xff, 0xb0, 0x40, 0xff, 0xdb, 0x40, 0xff, 0xff, 0xe0, 0xfe, 0xff, 
+  0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x0e, 0x40, 0xff, 0xff, 0x47, 0xf7, 0xff, 0x0f, 0xdf, 
+  0xff, 0xd4, 0xb6, 0xff, 0x9a, 0x96, 0xff, 0x7d, 0x7e, 0xff, 0x7f, 0x76, 0xff, 0x9c, 0x86, 0xff, 0xb8, 0x9e, 0xff, 0xd3, 0xbe, 0xff, 0x0c, 0xef, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x04, 0xc0, 0xfe, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xec, 0x40, 0xff, 0xbc, 0x40, 0xff, 0x5f, 0x95, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 
+  0x83, 0x82, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x06, 0x40, 0xff, 0xff, 0x40, 0xf7, 0xff, 
+  0xf4, 0xbe, 0xff, 0x5c, 0x7e, 0xff, 0xde, 0x55, 0xff, 0xbe, 0x4d, 0xff, 0x9e, 0x4d, 0xff, 0x82, 0x9d, 0x4d, 0xff, 0x81, 0xbe, 0x4d, 0xff, 0x02, 0xfd, 0x65, 0xff, 0x7b, 0x8e, 0xff, 0xee, 0xd6, 
+  0xff, 0x81, 0x00, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xf0, 0x00, 0xff, 0x1f, 0x95, 0x00, 0x00, 0x00, 0x01, 0xa0, 0xfe, 0x07, 
+  0xc0, 0xfe, 0xc8, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x06, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xff, 0x0c, 0xdf, 0xff, 
+  0x7a, 0x8e, 0xff, 0xde, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x88, 0x9d, 0x4d, 0xff, 0x04, 0x9d, 0x45, 0xff, 0xff, 0x55, 0xff, 0xb6, 0xa6, 0xff, 0x07, 0xf7, 0xff, 0x00, 0xff, 0xff, 0x82, 0xe0, 0xfe, 
+  0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x50, 0x97, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0x83, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 
+  0x82, 0x21, 0xff, 0xff, 0x05, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xff, 0x0f, 0xcf, 0xff, 0x1d, 0x6e, 0xff, 0x9e, 0x4d, 0xff, 0x8c, 0x9d, 0x4d, 0xff, 0x03, 0xbe, 0x4d, 0xff, 0x5b, 
+  0x86, 0xff, 0xe5, 0xee, 0xff, 0x00, 0xff, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xd8, 0xc0, 0xff, 0x27, 0x94, 0x00, 0x00, 0x00, 0x04, 0x60, 0xff, 0x20, 0x40, 0xff, 0xab, 0x40, 0xff, 
+  0xff, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x04, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x0e, 0xd7, 
+  0xff, 0x1e, 0x56, 0xff, 0x9d, 0x45, 0xff, 0x8e, 0xbd, 0x4d, 0xff, 0x03, 0x9d, 0x45, 0xff, 0x5c, 0x76, 0xff, 0xb5, 0xae, 0xff, 0x9a, 0x8e, 0xff, 0x81, 0x9e, 0x76, 0xff, 0x04, 0x9a, 0x8e, 0xff, 
+  0xd4, 0xb6, 0xff, 0x0f, 0xd7, 0xe8, 0x29, 0xef, 0x67, 0xe0, 0xff, 0x03, 0x91, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x13, 0xc0, 0xfe, 0xc4, 0x82, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 
+  0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x03, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x28, 0xef, 0xff, 0x3b, 0x76, 0xff, 0x92, 0xbd, 0x45, 0xff, 0x00, 0xbe, 0x4d, 0xff, 
+  0x83, 0xbd, 0x45, 0xff, 0x04, 0xde, 0x4d, 0xff, 0xfd, 0x5d, 0xff, 0x7c, 0x86, 0xfb, 0xbe, 0x8e, 0x7c, 0x3f, 0x9f, 0x07, 0x92, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xfe, 0xa8, 0xc0, 0xfe, 0xfc, 0xc0, 
+  0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x03, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0xb6, 0xa6, 0xff, 0xbe, 0x45, 0xff, 0x9a, 
+  0xbd, 0x45, 0xff, 0x02, 0xfe, 0x5d, 0xff, 0x9e, 0x7e, 0xb7, 0xdf, 0x8e, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x02, 0x40, 0xff, 0x5c, 0xe0, 0xfe, 0xfb, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 
+  0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff, 0x03, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x29, 0xdf, 0xff, 0xde, 0x45, 0xff, 0x9c, 0xbd, 0x45, 0xff, 0x02, 0xde, 0x4d, 0xff, 
+  0x7e, 0x76, 0xc7, 0xdf, 0x8e, 0x1b, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x60, 0xff, 0x30, 0x40, 0xff, 0xc7, 0x00, 0xff, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 
+  0x82, 0x01, 0xff, 0xff, 0x01, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x81, 0x40, 0xff, 0xff, 0x01, 0xb6, 0xa6, 0xff, 0xbe, 0x3d, 0xff, 0x9d, 0xbd, 0x45, 0xff, 0x02, 0xde, 0x4d, 0xff, 0x7e, 0x76, 
+  0xab, 0x1f, 0x8f, 0x07, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x6b, 0x83, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xff, 0xff, 0x05, 0x00, 0xff, 0xff, 
+  0x20, 0xf7, 0xff, 0x0d, 0xd7, 0xff, 0x16, 0xbf, 0xff, 0xfb, 0xae, 0xff, 0xfd, 0x5d, 0xff, 0x9f, 0xdd, 0x45, 0xff, 0x01, 0xfe, 0x4d, 0xfc, 0x9e, 0x7e, 0x50, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xc0, 
+  0xfe, 0x1f, 0xc0, 0xfe, 0xc0, 0xc0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x00, 0xff, 0xff, 0x04, 0xf0, 0xc6, 0xff, 0x9c, 0x76, 0xff, 0x1f, 0x4e, 
+  0xff, 0xfe, 0x45, 0xff, 0xbd, 0x3d, 0xff, 0xa1, 0xdd, 0x45, 0xff, 0x00, 0x5e, 0x66, 0xc4, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x40, 0xff, 0x44, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 
+  0xff, 0x04, 0xe1, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xb9, 0x9e, 0xff, 0x1d, 0x4e, 0xff, 0xde, 0x45, 0xff, 0xa4, 0xdd, 0x45, 0xff, 0x01, 0xfe, 0x4d, 0xff, 0xff, 0x86, 0x34, 0x8d, 0x00, 0x00, 0x00, 
+  0x01, 0x40, 0xff, 0x5f, 0x00, 0xff, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x02, 0xd5, 0xa6, 0xff, 0xfe, 0x3d, 0xff, 0xdd, 0x3d, 0xff, 0x95, 0xdd, 0x45, 0xff, 0x02, 0xdd, 0x3d, 
+  0xff, 0xfd, 0x45, 0xff, 0xfe, 0x4d, 0xff, 0x83, 0x1e, 0x56, 0xff, 0x02, 0xfe, 0x4d, 0xff, 0xdd, 0x45, 0xff, 0xdd, 0x3d, 0xff, 0x85, 0xdd, 0x45, 0xff, 0x01, 0xdd, 0x3d, 0xff, 0x9e, 0x6e, 0x78, 
+  0x8c, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x4b, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x02, 0xec, 0xce, 0xff, 0x1e, 0x3e, 0xff, 0xde, 0x3d, 0xff, 0x96, 0xfe, 0x3d, 
+  0xff, 0x0a, 0x3e, 0x66, 0xff, 0x7e, 0x76, 0xff, 0x3e, 0x6e, 0xff, 0xfe, 0x65, 0xff, 0xfe, 0x5d, 0xff, 0xfe, 0x65, 0xff, 0x1e, 0x66, 0xff, 0x3e, 0x6e, 0xff, 0x7e, 0x76, 0xff, 0x1e, 0x56, 0xff, 
+  0xde, 0x3d, 0xff, 0x84, 0xfe, 0x3d, 0xff, 0x01, 0xde, 0x3d, 0xff, 0x3e, 0x56, 0xab, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xfa, 0x03, 0xc0, 0xfe, 0x6f, 0xc0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0x81, 
+  0xe0, 0xfe, 0xff, 0x00, 0x7a, 0x7e, 0xff, 0x96, 0xfe, 0x3d, 0xff, 0x04, 0x1e, 0x4e, 0xff, 0x5e, 0x6e, 0xff, 0xfe, 0x65, 0xff, 0x9d, 0x4d, 0xff, 0x9d, 0x45, 0xff, 0x83, 0x9d, 0x4d, 0xff, 0x04, 
+  0x9d, 0x45, 0xff, 0xbd, 0x55, 0xff, 0x3e, 0x6e, 0xff, 0x5e, 0x66, 0xff, 0xfe, 0x45, 0xff, 0x84, 0xfe, 0x3d, 0xff, 0x00, 0x1e, 0x46, 0xc7, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x98, 0x81, 
+  0xc0, 0xfe, 0xff, 0x01, 0xc8, 0xf6, 0xff, 0x1c, 0x56, 0xff, 0x95, 0xfe, 0x3d, 0xff, 0x02, 0x3e, 0x56, 0xff, 0x1e, 0x66, 0xff, 0xbd, 0x4d, 0xff, 0x89, 0x9d, 0x4d, 0xff, 0x02, 0xde, 0x55, 0xff, 
+  0x5e, 0x6e, 0xff, 0x1e, 0x46, 0xff, 0x83, 0xfe, 0x3d, 0xff, 0x00, 0xfd, 0x3d, 0xb4, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x43, 0xe0, 0xfe, 0xfc, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xcd, 0xee, 
+  0xff, 0x1d, 0x3e, 0xff, 0x94, 0xfe, 0x3d, 0xff, 0x02, 0x3e, 0x4e, 0xff, 0x3e, 0x66, 0xff, 0xbd, 0x45, 0xff, 0x8c, 0xbd, 0x4d, 0xff, 0x01, 0x5e, 0x6e, 0xff, 0x7e, 0x76, 0xff, 0x81, 0x7e, 0x7e, 
+  0xff, 0x03, 0x7e, 0x76, 0xff, 0x7e, 0x76, 0xd8, 0xbf, 0x86, 0x54, 0xff, 0x96, 0x0c, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x80, 0xff, 0x23, 0x00, 0xff, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x01, 0xae, 0xee, 
+  0xff, 0x1e, 0x2e, 0xff, 0x93, 0x1e, 0x3e, 0xff, 0x01, 0x1e, 0x46, 0xff, 0x3e, 0x5e, 0xff, 0x8e, 0xbd, 0x45, 0xff, 0x81, 0xbd, 0x4d, 0xff, 0x81, 0xbd, 0x45, 0xff, 0x04, 0xbd, 0x4d, 0xff, 0xde, 
+  0x4d, 0xff, 0xfe, 0x5d, 0xfc, 0x7e, 0x76, 0xd4, 0xbf, 0x8e, 0x37, 0x8c, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xfe, 0x2c, 0xc0, 0xfe, 0x50, 0xc0, 0xfe, 0xe3, 0xab, 0xee, 0xff, 0x1d, 0x36, 0xff, 0x93, 
+  0x1e, 0x3e, 0xff, 0x01, 0x3e, 0x56, 0xff, 0xde, 0x4d, 0xff, 0x96, 0xbd, 0x45, 0xff, 0x01, 0x5e, 0x6e, 0xf3, 0xde, 0x86, 0x47, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x41, 0xff, 0x1b, 0xe0, 0xfe, 0xf3, 
+  0xc6, 0xf6, 0xff, 0x3c, 0x56, 0xff, 0x90, 0x1e, 0x3e, 0xff, 0x81, 0x1e, 0x36, 0xff, 0x01, 0xfd, 0x2d, 0xff, 0x3e, 0x5e, 0xff, 0x98, 0xbd, 0x45, 0xff, 0x01, 0x3e, 0x66, 0xe4, 0xdf, 0x86, 0x1c, 
+  0x8b, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x8b, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x57, 0x86, 0xff, 0x1e, 0x36, 0xff, 0x8d, 0x1e, 0x3e, 0xff, 0x05, 0x1e, 0x36, 0xff, 0x3e, 0x46, 0xff, 0x5e, 0x56, 
+  0xff, 0x7e, 0x66, 0xff, 0x9e, 0x6e, 0xff, 0xfe, 0x4d, 0xff, 0x99, 0xdd, 0x45, 0xff, 0x00, 0x7e, 0x76, 0xa3, 0x8a, 0x00, 0x00, 0x00, 0x05, 0xc0, 0xff, 0x10, 0xe0, 0xfe, 0xe4, 0xc0, 0xfe, 0xbc, 
+  0xc0, 0xfe, 0xb3, 0xa6, 0xd6, 0xd3, 0x3c, 0x2e, 0xff, 0x8d, 0x1e, 0x36, 0xff, 0x03, 0x7e, 0x5e, 0xff, 0x7e, 0x66, 0xff, 0x1e, 0x56, 0xff, 0xfe, 0x4d, 0xff, 0x9b, 0xdd, 0x45, 0xff, 0x01, 0x1e, 
+  0x56, 0xff, 0x3f, 0x97, 0x24, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xe0, 0xfe, 0xc0, 0x8f, 0xb6, 0xff, 0x1d, 0x36, 0xff, 0x8b, 0x1e, 0x36, 0xff, 0x02, 0x5e, 0x4e, 0xff, 0x3e, 0x5e, 0xff, 0xdd, 0x3d, 
+  0xff, 0x9d, 0xdd, 0x45, 0xff, 0x01, 0xdd, 0x3d, 0xff, 0x9e, 0x6e, 0x74, 0x8c, 0x00, 0x00, 0x00, 0x04, 0x80, 0xff, 0x10, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xff, 0x8f, 0xb6, 0xff, 0x3c, 0x26, 0xff, 
+  0x89, 0x3e, 0x36, 0xff, 0x01, 0x5e, 0x3e, 0xff, 0x5e, 0x5e, 0xff, 0x9f, 0xfe, 0x3d, 0xff, 0x01, 0xde, 0x3d, 0xff, 0x3e, 0x56, 0xa8, 0x8c, 0x00, 0x00, 0x00, 0x07, 0x00, 0xff, 0x2c, 0xc0, 0xfe, 
+  0xec, 0xc0, 0xfe, 0xdb, 0xc0, 0xfe, 0x9f, 0xa6, 0xd6, 0xe0, 0x57, 0x86, 0xff, 0x3c, 0x4e, 0xff, 0x3d, 0x2e, 0xff, 0x85, 0x3e, 0x1e, 0xff, 0x01, 0x1e, 0x1e, 0xff, 0x7e, 0x56, 0xff, 0xa1, 0xfe, 
+  0x3d, 0xff, 0x00, 0x1e, 0x46, 0xc0, 0x8c, 0x00, 0x00, 0x00, 0x08, 0xe0, 0xfe, 0x0b, 0xc0, 0xfe, 0x20, 0xc0, 0xfe, 0x08, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0xc6, 0xf6, 0xff, 
+  0xcb, 0xee, 0xff, 0xae, 0xee, 0xff, 0x85, 0xce, 0xee, 0xff, 0x00, 0x5b, 0x86, 0xff, 0xa1, 0xfe, 0x3d, 0xff, 0x00, 0xfe, 0x45, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xfe, 0xe7, 0xc0, 0xfe, 
+  0xff, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xdc, 0x82, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0x3b, 0x86, 0xff, 0xa1, 0xfe, 0x3d, 0xff, 0x00, 0x3e, 0x4e, 0x74, 0x90, 0x00, 0x00, 0x00, 0x03, 
+  0xe0, 0xfe, 0xf4, 0xc0, 0xfe, 0x5b, 0xc0, 0xfe, 0x10, 0xe0, 0xfe, 0x6c, 0x85, 0xc0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xff, 0x3a, 0x8e, 0xff, 0xa1, 0x1e, 0x3e, 0xff, 0x00, 0xbe, 0x66, 0x24, 0x93, 
+  0x00, 0x00, 0x00, 0x04, 0x20, 0xff, 0x44, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0x77, 0xc0, 0xfe, 0xd3, 0x81, 0xc0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xf4, 0x74, 0x9e, 0xfb, 0x1e, 0x36, 
+  0xff, 0x9f, 0x1e, 0x3e, 0xff, 0x00, 0x3e, 0x3e, 0xa4, 0x94, 0x00, 0x00, 0x00, 0x04, 0x80, 0xff, 0x18, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0x28, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x80, 0x81, 0xc0, 0xfe, 
+  0xff, 0x02, 0xe0, 0xfe, 0x24, 0xa7, 0xce, 0xcc, 0x1d, 0x0e, 0xff, 0x9e, 0x1e, 0x36, 0xff, 0x01, 0x1e, 0x3e, 0xec, 0x3e, 0x46, 0x20, 0x95, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x07, 0x81, 0x00, 
+  0x00, 0x00, 0x05, 0x60, 0xff, 0x13, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x34, 0x00, 0x00, 0x00, 0x00, 0xff, 0x30, 0x72, 0x9e, 0xff, 0x9d, 0x1e, 0x36, 0xff, 0x01, 0x1e, 0x36, 0xf4, 0x3e, 0x3e, 0x50, 
+  0x9a, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x38, 0x82, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xf6, 0x6f, 0x3c, 0x66, 0xb3, 0x9b, 0x3e, 0x36, 0xff, 0x01, 0x3e, 0x36, 0xd4, 0x5e, 0x3e, 0x33, 0xa1, 0x00, 
+  0x00, 0x00, 0x02, 0x3e, 0x36, 0x5c, 0x3e, 0x36, 0xd3, 0x3e, 0x36, 0xf4, 0x94, 0x3e, 0x36, 0xff, 0x04, 0x3e, 0x36, 0xfc, 0x3e, 0x36, 0xf3, 0x3e, 0x36, 0xd3, 0x3e, 0x36, 0x70, 0x7f, 0x66, 0x07, 
+  0xa3, 0x00, 0x00, 0x00, 0x02, 0x3e, 0x36, 0x10, 0x3e, 0x36, 0x23, 0x3e, 0x36, 0x2c, 0x93, 0x3e, 0x36, 0x2f, 0x02, 0x3e, 0x36, 0x2c, 0x3e, 0x36, 0x20, 0x3e, 0x3e, 0x10, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x80, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x2b, 0xff, 0x40, 0x0c, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x03, 0xff, 0x80, 0x04, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0xa0, 0x00, 0xfe, 0xa0, 0x00, 0xff, 0x20, 0xdc, 0xff, 0x80, 0x0c, 0xff, 0x41, 0x00, 0xfe, 0x61, 0x00, 0xff, 0x20, 0xf4, 0xff, 0x20, 0x54, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x73, 0xff, 0x40, 0x58, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x0f, 0xff, 0x40, 0x94, 0xff, 0x60, 0x04, 0xff, 0x40, 0x00, 0xff, 0x60, 0x58, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xbc, 0xec, 0xa2, 0x00, 0xff, 0x41, 0x97, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xf7, 0xff, 0xe4, 0x00, 0xff, 0x60, 0x54, 0xff, 0x00, 0xff, 0xff, 0x00, 0xcb, 0xff, 0x20, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x34, 0xff, 0x40, 0x58, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0xe0, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x33, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xcf, 0xff, 0xa1, 0x0c, 0xff, 0x00, 0xbf, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xd0, 0xfe, 0xe0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x41, 0xcc, 0xff, 0x00, 0xf4, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0xc1, 0x17, 0xff, 0x60, 0x7b, 0xff, 0x00, 0xfb, 0xff, 0x00, 0xa7, 0xff, 0x20, 0x00, 0xff, 0x20, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x90, 0xff, 0x60, 0x20, 0xff, 0x20, 0x00, 0xff, 0x20, 0x5f, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xf7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xdf, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xcc, 0xff, 0x20, 0x00, 0xff, 0x81, 0x0c, 0xff, 0x40, 0x4c, 0xff, 0x40, 0x34, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xf3, 0xff, 0x00, 0xf3, 0xff, 0x60, 0xaf, 0xff, 0x20, 0xa4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xf7, 0xff, 0x61, 0x58, 0xff, 0x20, 0xdc, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0x3b, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x40, 0x04, 0xff, 0xe0, 0x00, 0xff, 0x60, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xd7, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x2f, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x80, 0x08, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x2b, 0xff, 0x40, 0xd7, 0xff, 0x60, 0x88, 0xff, 0x81, 0x28, 0xfe, 0xe0, 0xb8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 0xff, 0x00, 0x34, 0xff, 0x60, 0x63, 0xff, 0x60, 0xb8, 0xff, 0x40, 0xb7, 0xef, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x1b, 0xfe, 0xc0, 0xeb, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x21, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x94, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x00, 0xff, 0xe0, 0x03, 0xfe, 0xc0, 0xd7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x3b, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0xa0, 0x08, 0xff, 0x40, 0x67, 0xff, 0x60, 0x4b, 0xff, 0x81, 0x2f, 0xfe, 0xe0, 0xb4, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0xa1, 0x28, 0xff, 0x60, 0x37, 0xff, 0x40, 0x64, 0xff, 0x60, 0x34, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xe0, 0xc8, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0x37, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x00, 0xfe, 0xe0, 0x34, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xcb, 0xff, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x61, 0x00, 0xfe, 0xc0, 0xd0, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x30, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x1c, 0xff, 0x40, 0xb0, 0xff, 0x40, 0xdb, 0xff, 0x40, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xf7, 0x47, 0xff, 0xdf, 0x0f, 0xff, 0xb6, 0xd4, 0xff, 0x96, 0x9a, 0xff, 0x7e, 0x7d, 0xff, 0x76, 0x7f, 0xff, 0x86, 0x9c, 0xff, 0x9e, 0xb8, 0xff, 0xbe, 0xd3, 0xff, 0xef, 0x0c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xec, 0xff, 0x40, 0xbc, 0xff, 0x40, 0x5f, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xe0, 0x83, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xf7, 0x40, 0xff, 0xbe, 0xf4, 0xff, 0x7e, 0x5c, 0xff, 0x55, 0xde, 0xff, 0x4d, 0xbe, 0xff, 0x4d, 0x9e, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0xbe, 0xff, 0x4d, 0xbe, 0xff, 0x65, 0xfd, 0xff, 0x8e, 0x7b, 0xff, 0xd6, 0xee, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf0, 0xff, 0x00, 0x1f, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xa0, 0x07, 0xfe, 0xc0, 0xc8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xdf, 0x0c, 0xff, 0x8e, 0x7a, 0xff, 0x4d, 0xde, 0xff, 0x45, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x45, 0x9d, 0xff, 0x55, 0xff, 0xff, 0xa6, 0xb6, 0xff, 0xf7, 0x07, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x50, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xfe, 0x80, 0x00, 0xff, 0x00, 0x83, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xcf, 0x0f, 0xff, 0x6e, 0x1d, 0xff, 0x4d, 0x9e, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0xbe, 0xff, 0x86, 0x5b, 0xff, 0xee, 0xe5, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xd8, 0xff, 0xc0, 0x27, 0xe7, 0x28, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x20, 0xff, 0x40, 0xab, 0xff, 0x40, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xd7, 0x0e, 0xff, 0x56, 0x1e, 0xff, 0x45, 0x9d, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x45, 0x9d, 0xff, 0x76, 0x5c, 0xff, 0xae, 0xb5, 0xff, 0x8e, 0x9a, 0xff, 0x76, 0x9e, 0xff, 0x76, 0x9e, 0xff, 0x8e, 0x9a, 0xff, 0xb6, 0xd4, 0xff, 0xd7, 0x0f, 0xe8, 0xef, 0x29, 0x67, 0xff, 0xe0, 0x03, 0x8e, 0xff, 0x00, 0x8e, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x13, 0xfe, 0xc0, 0xc4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xef, 0x28, 0xff, 0x76, 0x3b, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xbe, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xde, 0xff, 0x5d, 0xfd, 0xff, 0x86, 0x7c, 0xfb, 0x8e, 0xbe, 0x7c, 0x9f, 0x3f, 0x07, 0x8e, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0xa8, 0xfe, 0xc0, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xa6, 0xb6, 0xff, 0x45, 0xbe, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x5d, 0xfe, 0xff, 0x7e, 0x9e, 0xb7, 0x8e, 0xdf, 0x1c, 0x86, 0xdf, 0x00, 0x86, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x5c, 0xfe, 0xe0, 0xfb, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xdf, 0x29, 0xff, 0x45, 0xde, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xde, 0xff, 0x76, 0x7e, 0xc7, 0x8e, 0xdf, 0x1b, 0x86, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x60, 0x30, 0xff, 0x40, 0xc7, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xa6, 0xb6, 0xff, 0x3d, 0xbe, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xde, 0xff, 0x76, 0x7e, 0xab, 0x8f, 0x1f, 0x07, 0x86, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x00, 0x6b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00, 0xff, 0xf7, 0x20, 0xff, 0xd7, 0x0d, 0xff, 0xbf, 0x16, 0xff, 0xae, 0xfb, 0xff, 0x5d, 0xfd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x4d, 0xfe, 0xfc, 0x7e, 0x9e, 0x50, 0x86, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x1f, 0xfe, 0xc0, 0xc0, 0xfe, 0xc0, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xc6, 0xf0, 0xff, 0x76, 0x9c, 0xff, 0x4e, 0x1f, 0xff, 0x45, 0xfe, 0xff, 0x3d, 0xbd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x66, 0x5e, 0xc4, 0x5e, 0x5d, 0x00, 0x86, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x44, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0xff, 0x9e, 0xb9, 0xff, 0x4e, 0x1d, 0xff, 0x45, 0xde, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x4d, 0xfe, 0xff, 0x86, 0xff, 0x34, 0x7e, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0xe0, 0x00, 0xff, 0x40, 0x5f, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xa6, 0xd5, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x3d, 0xdd, 0xff, 0x45, 0xfd, 0xff, 0x4d, 0xfe, 0xff, 0x56, 0x1e, 0xff, 0x56, 0x1e, 0xff, 0x56, 0x1e, 0xff, 0x56, 0x1e, 0xff, 0x4d, 0xfe, 0xff, 0x45, 0xdd, 0xff, 0x3d, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x3d, 0xdd, 0xff, 0x6e, 0x9e, 0x78, 0x66, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x4b, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xce, 0xec, 0xff, 0x3e, 0x1e, 0xff, 0x3d, 0xde, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x66, 0x3e, 0xff, 0x76, 0x7e, 0xff, 0x6e, 0x3e, 0xff, 0x65, 0xfe, 0xff, 0x5d, 0xfe, 0xff, 0x65, 0xfe, 0xff, 0x66, 0x1e, 0xff, 0x6e, 0x3e, 0xff, 0x76, 0x7e, 0xff, 0x56, 0x1e, 0xff, 0x3d, 0xde, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xde, 0xff, 0x56, 0x3e, 0xab, 0x56, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x20, 0x00, 0xfa, 0xe0, 0x03, 0xfe, 0xc0, 0x6f, 0xfe, 0xc0, 0xd0, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0x7e, 0x7a, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x4e, 0x1e, 0xff, 0x6e, 0x5e, 0xff, 0x65, 0xfe, 0xff, 0x4d, 0x9d, 0xff, 0x45, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x45, 0x9d, 0xff, 0x55, 0xbd, 0xff, 0x6e, 0x3e, 0xff, 0x66, 0x5e, 0xff, 0x45, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x46, 0x1e, 0xc7, 0x46, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0x80, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0x98, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xf6, 0xc8, 0xff, 0x56, 0x1c, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x56, 0x3e, 0xff, 0x66, 0x1e, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x4d, 0x9d, 0xff, 0x55, 0xde, 0xff, 0x6e, 0x5e, 0xff, 0x46, 0x1e, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfd, 0xb4, 0x66, 0x5e, 0x00, 0x8e, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x43, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xee, 0xcd, 0xff, 0x3e, 0x1d, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x4e, 0x3e, 0xff, 0x66, 0x3e, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x6e, 0x5e, 0xff, 0x76, 0x7e, 0xff, 0x7e, 0x7e, 0xff, 0x7e, 0x7e, 0xff, 0x76, 0x7e, 0xff, 0x76, 0x7e, 0xd8, 0x86, 0xbf, 0x54, 0x96, 0xff, 0x0c, 0x8e, 0xdf, 0x00, 0x86, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x23, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xee, 0xae, 0xff, 0x2e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x46, 0x1e, 0xff, 0x5e, 0x3e, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x4d, 0xbd, 0xff, 0x4d, 0xde, 0xff, 0x5d, 0xfe, 0xfc, 0x76, 0x7e, 0xd4, 0x8e, 0xbf, 0x37, 0x86, 0xdf, 0x00, 0x86, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xc0, 0x2c, 0xfe, 0xc0, 0x50, 0xfe, 0xc0, 0xe3, 0xee, 0xab, 0xff, 0x36, 0x1d, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x56, 0x3e, 0xff, 0x4d, 0xde, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x6e, 0x5e, 0xf3, 0x86, 0xde, 0x47, 0x66, 0x9e, 0x00, 0x86, 0xbf, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0x80, 0x00, 0xff, 0x41, 0x1b, 0xfe, 0xe0, 0xf3, 0xf6, 0xc6, 0xff, 0x56, 0x3c, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x2d, 0xfd, 0xff, 0x5e, 0x3e, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x45, 0xbd, 0xff, 0x66, 0x3e, 0xe4, 0x86, 0xdf, 0x1c, 0x86, 0x9f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x8b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0x86, 0x57, 0xff, 0x36, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x46, 0x3e, 0xff, 0x56, 0x5e, 0xff, 0x66, 0x7e, 0xff, 0x6e, 0x9e, 0xff, 0x4d, 0xfe, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x76, 0x7e, 0xa3, 0x76, 0xbf, 0x00, 0x96, 0x7d, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0xc0, 0x10, 0xfe, 0xe0, 0xe4, 0xfe, 0xc0, 0xbc, 0xfe, 0xc0, 0xb3, 0xd6, 0xa6, 0xd3, 0x2e, 0x3c, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x5e, 0x7e, 0xff, 0x66, 0x7e, 0xff, 0x56, 0x1e, 0xff, 0x4d, 0xfe, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x56, 0x1e, 0xff, 0x97, 0x3f, 0x24, 0x86, 0xdf, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xe0, 0xc0, 0xb6, 0x8f, 0xff, 0x36, 0x1d, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x4e, 0x5e, 0xff, 0x5e, 0x3e, 0xff, 0x3d, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x45, 0xdd, 0xff, 0x3d, 0xdd, 0xff, 0x6e, 0x9e, 0x74, 0x6e, 0x7e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x10, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xff, 0xb6, 0x8f, 0xff, 0x26, 0x3c, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x3e, 0x5e, 0xff, 0x5e, 0x5e, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xde, 0xff, 0x56, 0x3e, 0xa8, 0x56, 0x3e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x00, 0x2c, 0xfe, 0xc0, 0xec, 0xfe, 0xc0, 0xdb, 0xfe, 0xc0, 0x9f, 0xd6, 0xa6, 0xe0, 0x86, 0x57, 0xff, 0x4e, 0x3c, 0xff, 0x2e, 0x3d, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x3e, 0xff, 0x1e, 0x1e, 0xff, 0x56, 0x7e, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x46, 0x1e, 0xc0, 0x45, 0xfe, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xe0, 0x0b, 0xfe, 0xc0, 0x20, 0xfe, 0xc0, 0x08, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xd0, 0xfe, 0xc0, 0xff, 0xf6, 0xc6, 0xff, 0xee, 0xcb, 0xff, 0xee, 0xae, 0xff, 0xee, 0xce, 0xff, 0xee, 0xce, 0xff, 0xee, 0xce, 0xff, 0xee, 0xce, 0xff, 0xee, 0xce, 0xff, 0xee, 0xce, 0xff, 0x86, 0x5b, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x45, 0xfe, 0xa8, 0x45, 0xfe, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xe7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xdc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0x86, 0x3b, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xfe, 0xff, 0x4e, 0x3e, 0x74, 0x4e, 0x3e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xf4, 0xfe, 0xc0, 0x5b, 0xfe, 0xc0, 0x10, 0xfe, 0xe0, 0x6c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0x8e, 0x3a, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x66, 0xbe, 0x24, 0x5e, 0x7e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe0, 0x00, 0xff, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x20, 0x44, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0x77, 0xfe, 0xc0, 0xd3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf4, 0x9e, 0x74, 0xfb, 0x36, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x1e, 0xff, 0x3e, 0x3e, 0xa4, 0x45, 0xde, 0x00, 0x70, 0x18, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xa0, 0x00, 0xff, 0x20, 0x00, 0xff, 0x80, 0x18, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0x28, 0xfe, 0xa0, 0x00, 0xfe, 0xe0, 0x80, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x24, 0xce, 0xa7, 0xcc, 0x0e, 0x1d, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x3e, 0x1e, 0xec, 0x46, 0x3e, 0x20, 0x5e, 0xde, 0x00, 0x3d, 0x76, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xc0, 0x00, 0xfc, 0xc0, 0x00, 0xff, 0x40, 0x07, 0xfe, 0xc0, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x13, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x34, 0xfe, 0xe0, 0x00, 0xff, 0x00, 0x30, 0x9e, 0x72, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xff, 0x36, 0x1e, 0xf4, 0x3e, 0x3e, 0x50, 0x04, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x20, 0x00, 0xfe, 0x60, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x38, 0xfe, 0xe0, 0x00, 0xfe, 0xa2, 0x00, 0xfe, 0xc0, 0x00, 0xf6, 0xc0, 0x6f, 0x66, 0x3c, 0xb3, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xd4, 0x3e, 0x5e, 0x33, 0x05, 0x5e, 0x00, 0x6e, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x00, 0x6e, 0x1c, 0x00, 0x36, 0x3e, 0x5c, 0x36, 0x3e, 0xd3, 0x36, 0x3e, 0xf4, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xff, 0x36, 0x3e, 0xfc, 0x36, 0x3e, 0xf3, 0x36, 0x3e, 0xd3, 0x36, 0x3e, 0x70, 0x66, 0x7f, 0x07, 0x46, 0x7e, 0x00, 0x4e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x7d, 0x00, 0x87, 0xbc, 0x00, 0x03, 0xbc, 0x00, 0x36, 0x3e, 0x10, 0x36, 0x3e, 0x23, 0x36, 0x3e, 0x2c, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2f, 0x36, 0x3e, 0x2c, 0x36, 0x3e, 0x20, 0x3e, 0x3e, 0x10, 0x00, 0x0a, 0x00, 0x4e, 0x5e, 0x00, 0x46, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x0f, 0x82, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0x60, 0x2b, 0xff, 0x40, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x03, 0xff, 0x80, 0x04, 0xb5, 0x00, 0x00, 0x00, 0x01, 0xff, 0x20, 0xdc, 0xff, 0x80, 0x0c, 0x81, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0x20, 0xf4, 0xff, 0x20, 0x54, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x73, 0xff, 0x40, 0x58, 0xb0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x40, 0x0f, 0xff, 0x40, 0x94, 0xff, 0x60, 
+  0x04, 0x00, 0x00, 0x00, 0xff, 0x60, 0x58, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xbc, 0x00, 0x00, 0x00, 0xff, 0x41, 0x97, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xf7, 0x00, 0x00, 0x00, 0xff, 0x60, 0x54, 0xff, 
+  0x00, 0xff, 0xff, 0x00, 0xcb, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x34, 0xff, 0x40, 0x58, 0xac, 0x00, 0x00, 0x00, 0x04, 0xff, 0x60, 0x33, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xcf, 0xff, 0xa1, 
+  0x0c, 0xff, 0x00, 0xbf, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xff, 0x40, 0xd0, 0xfe, 0xe0, 0xf3, 0x81, 0xfe, 0xc0, 0xff, 0x07, 0xff, 0x41, 0xcc, 0xff, 0x00, 0xf4, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 
+  0xff, 0xc1, 0x17, 0xff, 0x60, 0x7b, 0xff, 0x00, 0xfb, 0xff, 0x00, 0xa7, 0xa9, 0x00, 0x00, 0x00, 0x03, 0xff, 0x40, 0x90, 0xff, 0x60, 0x20, 0x00, 0x00, 0x00, 0xff, 0x20, 0x5f, 0x81, 0xfe, 0xc0, 
+  0xff, 0x01, 0xff, 0x20, 0xff, 0xfe, 0xe0, 0xf7, 0x89, 0xfe, 0xc0, 0xff, 0x07, 0xff, 0x20, 0xdf, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xcc, 0x00, 0x00, 0x00, 0xff, 0x81, 0x0c, 0xff, 
+  0x40, 0x4c, 0xff, 0x40, 0x34, 0xa5, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xe0, 0xf3, 0xff, 0x00, 0xf3, 0xff, 0x60, 0xaf, 0xff, 0x20, 0xa4, 0x82, 0xfe, 0xc0, 0xff, 0x8b, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 
+  0xc0, 0xff, 0x04, 0xfe, 0xe0, 0xf7, 0xff, 0x61, 0x58, 0xff, 0x20, 0xdc, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0x3b, 0xa1, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0xfe, 
+  0xe0, 0xd7, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xc0, 0xff, 0x8f, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0x2f, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x08, 0x9e, 0x00, 0x00, 0x00, 0x04, 0xff, 0x20, 0x2b, 0xff, 0x40, 0xd7, 0xff, 0x60, 0x88, 0xff, 0x81, 0x28, 0xfe, 0xe0, 0xb8, 0x81, 0xfe, 0xc0, 0xff, 
+  0x85, 0xfe, 0xe0, 0xff, 0x87, 0xfe, 0xe1, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x05, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 0xff, 0x00, 0x34, 0xff, 0x60, 0x63, 0xff, 0x60, 0xb8, 0xff, 0x40, 0xb7, 0x9e, 
+  0x00, 0x00, 0x00, 0x03, 0xfe, 0xc0, 0x1b, 0xfe, 0xc0, 0xeb, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x87, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 
+  0x85, 0xfe, 0xe0, 0xff, 0x03, 0xff, 0x21, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x94, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x03, 0xfe, 0xc0, 0xd7, 0x81, 0xfe, 0xc0, 0xff, 
+  0x84, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x8d, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xff, 0x20, 0x3b, 0x9b, 0x00, 0x00, 0x00, 
+  0x05, 0xff, 0xa0, 0x08, 0xff, 0x40, 0x67, 0xff, 0x60, 0x4b, 0xff, 0x81, 0x2f, 0xfe, 0xe0, 0xb4, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x8f, 0xff, 0x01, 0xff, 0x81, 
+  0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xc0, 0xff, 0xff, 0xa1, 0x28, 0xff, 0x60, 0x37, 0xff, 0x40, 0x64, 0xff, 0x60, 0x34, 0x99, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0xc8, 0x86, 
+  0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 0x89, 0xff, 0x21, 0xff, 0x84, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x00, 0xff, 0x00, 0x37, 0x99, 
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x34, 0x82, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 0x8b, 0xff, 0x21, 0xff, 0x84, 0xff, 0x01, 0xff, 0x00, 
+  0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xc0, 0xcb, 0xff, 0x60, 0x04, 0x9a, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0xd0, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 
+  0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x83, 0xff, 0x40, 0xff, 0x83, 0xff, 0x20, 0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 
+  0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x30, 0x97, 0x00, 0x00, 0x00, 0x05, 0xff, 0x60, 0x1c, 0xff, 0x40, 0xb0, 0xff, 0x40, 0xdb, 0xff, 0x40, 0xff, 0xfe, 0xe0, 0xff, 
+  0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x0e, 0xff, 0x40, 0xff, 0xf7, 0x47, 0xff, 0xdf, 0x0f, 
+  0xff, 0xb6, 0xd4, 0xff, 0x96, 0x9a, 0xff, 0x7e, 0x7d, 0xff, 0x76, 0x7f, 0xff, 0x86, 0x9c, 0xff, 0x9e, 0xb8, 0xff, 0xbe, 0xd3, 0xff, 0xef, 0x0c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 
+  0x01, 0xff, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xc0, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xec, 0xff, 0x40, 0xbc, 0xff, 0x40, 0x5f, 0x95, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 
+  0x83, 0x82, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x06, 0xff, 0x40, 0xff, 0xf7, 0x40, 0xff, 
+  0xbe, 0xf4, 0xff, 0x7e, 0x5c, 0xff, 0x55, 0xde, 0xff, 0x4d, 0xbe, 0xff, 0x4d, 0x9e, 0xff, 0x82, 0x4d, 0x9d, 0xff, 0x81, 0x4d, 0xbe, 0xff, 0x02, 0x65, 0xfd, 0xff, 0x8e, 0x7b, 0xff, 0xd6, 0xee, 
+  0xff, 0x81, 0xff, 0x00, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xc0, 0xf0, 0xff, 0x00, 0x1f, 0x95, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xa0, 0x07, 
+  0xfe, 0xc0, 0xc8, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x06, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xdf, 0x0c, 0xff, 
+  0x8e, 0x7a, 0xff, 0x4d, 0xde, 0xff, 0x45, 0x9d, 0xff, 0x88, 0x4d, 0x9d, 0xff, 0x04, 0x45, 0x9d, 0xff, 0x55, 0xff, 0xff, 0xa6, 0xb6, 0xff, 0xf7, 0x07, 0xff, 0xff, 0x00, 0xff, 0x82, 0xfe, 0xe0, 
+  0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0x50, 0x97, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x83, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 
+  0x82, 0xff, 0x21, 0xff, 0x05, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x40, 0xff, 0xcf, 0x0f, 0xff, 0x6e, 0x1d, 0xff, 0x4d, 0x9e, 0xff, 0x8c, 0x4d, 0x9d, 0xff, 0x03, 0x4d, 0xbe, 0xff, 0x86, 
+  0x5b, 0xff, 0xee, 0xe5, 0xff, 0xff, 0x00, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xe0, 0xd8, 0xff, 0xc0, 0x27, 0x94, 0x00, 0x00, 0x00, 0x04, 0xff, 0x60, 0x20, 0xff, 0x40, 0xab, 0xff, 0x40, 
+  0xff, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x04, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xd7, 0x0e, 
+  0xff, 0x56, 0x1e, 0xff, 0x45, 0x9d, 0xff, 0x8e, 0x4d, 0xbd, 0xff, 0x03, 0x45, 0x9d, 0xff, 0x76, 0x5c, 0xff, 0xae, 0xb5, 0xff, 0x8e, 0x9a, 0xff, 0x81, 0x76, 0x9e, 0xff, 0x04, 0x8e, 0x9a, 0xff, 
+  0xb6, 0xd4, 0xff, 0xd7, 0x0f, 0xe8, 0xef, 0x29, 0x67, 0xff, 0xe0, 0x03, 0x91, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x13, 0xfe, 0xc0, 0xc4, 0x82, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 
+  0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x03, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xef, 0x28, 0xff, 0x76, 0x3b, 0xff, 0x92, 0x45, 0xbd, 0xff, 0x00, 0x4d, 0xbe, 0xff, 
+  0x83, 0x45, 0xbd, 0xff, 0x04, 0x4d, 0xde, 0xff, 0x5d, 0xfd, 0xff, 0x86, 0x7c, 0xfb, 0x8e, 0xbe, 0x7c, 0x9f, 0x3f, 0x07, 0x92, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xc0, 0xa8, 0xfe, 0xc0, 0xfc, 0xfe, 
+  0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x03, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xa6, 0xb6, 0xff, 0x45, 0xbe, 0xff, 0x9a, 
+  0x45, 0xbd, 0xff, 0x02, 0x5d, 0xfe, 0xff, 0x7e, 0x9e, 0xb7, 0x8e, 0xdf, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x02, 0xff, 0x40, 0x5c, 0xfe, 0xe0, 0xfb, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 
+  0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x81, 0xff, 0x21, 0xff, 0x03, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xdf, 0x29, 0xff, 0x45, 0xde, 0xff, 0x9c, 0x45, 0xbd, 0xff, 0x02, 0x4d, 0xde, 0xff, 
+  0x76, 0x7e, 0xc7, 0x8e, 0xdf, 0x1b, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xff, 0x60, 0x30, 0xff, 0x40, 0xc7, 0xff, 0x00, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 
+  0x82, 0xff, 0x01, 0xff, 0x01, 0xff, 0x21, 0xff, 0xff, 0x20, 0xff, 0x81, 0xff, 0x40, 0xff, 0x01, 0xa6, 0xb6, 0xff, 0x3d, 0xbe, 0xff, 0x9d, 0x45, 0xbd, 0xff, 0x02, 0x4d, 0xde, 0xff, 0x76, 0x7e, 
+  0xab, 0x8f, 0x1f, 0x07, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x6b, 0x83, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x01, 0xff, 0x05, 0xff, 0x00, 0xff, 
+  0xf7, 0x20, 0xff, 0xd7, 0x0d, 0xff, 0xbf, 0x16, 0xff, 0xae, 0xfb, 0xff, 0x5d, 0xfd, 0xff, 0x9f, 0x45, 0xdd, 0xff, 0x01, 0x4d, 0xfe, 0xfc, 0x7e, 0x9e, 0x50, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xfe, 
+  0xc0, 0x1f, 0xfe, 0xc0, 0xc0, 0xfe, 0xc0, 0xfc, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x00, 0xff, 0x04, 0xc6, 0xf0, 0xff, 0x76, 0x9c, 0xff, 0x4e, 0x1f, 
+  0xff, 0x45, 0xfe, 0xff, 0x3d, 0xbd, 0xff, 0xa1, 0x45, 0xdd, 0xff, 0x00, 0x66, 0x5e, 0xc4, 0x8f, 0x00, 0x00, 0x00, 0x02, 0xff, 0x40, 0x44, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 
+  0xff, 0x04, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0xff, 0x9e, 0xb9, 0xff, 0x4e, 0x1d, 0xff, 0x45, 0xde, 0xff, 0xa4, 0x45, 0xdd, 0xff, 0x01, 0x4d, 0xfe, 0xff, 0x86, 0xff, 0x34, 0x8d, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0x40, 0x5f, 0xff, 0x00, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x02, 0xa6, 0xd5, 0xff, 0x3d, 0xfe, 0xff, 0x3d, 0xdd, 0xff, 0x95, 0x45, 0xdd, 0xff, 0x02, 0x3d, 0xdd, 
+  0xff, 0x45, 0xfd, 0xff, 0x4d, 0xfe, 0xff, 0x83, 0x56, 0x1e, 0xff, 0x02, 0x4d, 0xfe, 0xff, 0x45, 0xdd, 0xff, 0x3d, 0xdd, 0xff, 0x85, 0x45, 0xdd, 0xff, 0x01, 0x3d, 0xdd, 0xff, 0x6e, 0x9e, 0x78, 
+  0x8c, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x4b, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x02, 0xce, 0xec, 0xff, 0x3e, 0x1e, 0xff, 0x3d, 0xde, 0xff, 0x96, 0x3d, 0xfe, 
+  0xff, 0x0a, 0x66, 0x3e, 0xff, 0x76, 0x7e, 0xff, 0x6e, 0x3e, 0xff, 0x65, 0xfe, 0xff, 0x5d, 0xfe, 0xff, 0x65, 0xfe, 0xff, 0x66, 0x1e, 0xff, 0x6e, 0x3e, 0xff, 0x76, 0x7e, 0xff, 0x56, 0x1e, 0xff, 
+  0x3d, 0xde, 0xff, 0x84, 0x3d, 0xfe, 0xff, 0x01, 0x3d, 0xde, 0xff, 0x56, 0x3e, 0xab, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xfa, 0xe0, 0x03, 0xfe, 0xc0, 0x6f, 0xfe, 0xc0, 0xd0, 0xfe, 0xc0, 0xff, 0x81, 
+  0xfe, 0xe0, 0xff, 0x00, 0x7e, 0x7a, 0xff, 0x96, 0x3d, 0xfe, 0xff, 0x04, 0x4e, 0x1e, 0xff, 0x6e, 0x5e, 0xff, 0x65, 0xfe, 0xff, 0x4d, 0x9d, 0xff, 0x45, 0x9d, 0xff, 0x83, 0x4d, 0x9d, 0xff, 0x04, 
+  0x45, 0x9d, 0xff, 0x55, 0xbd, 0xff, 0x6e, 0x3e, 0xff, 0x66, 0x5e, 0xff, 0x45, 0xfe, 0xff, 0x84, 0x3d, 0xfe, 0xff, 0x00, 0x46, 0x1e, 0xc7, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x98, 0x81, 
+  0xfe, 0xc0, 0xff, 0x01, 0xf6, 0xc8, 0xff, 0x56, 0x1c, 0xff, 0x95, 0x3d, 0xfe, 0xff, 0x02, 0x56, 0x3e, 0xff, 0x66, 0x1e, 0xff, 0x4d, 0xbd, 0xff, 0x89, 0x4d, 0x9d, 0xff, 0x02, 0x55, 0xde, 0xff, 
+  0x6e, 0x5e, 0xff, 0x46, 0x1e, 0xff, 0x83, 0x3d, 0xfe, 0xff, 0x00, 0x3d, 0xfd, 0xb4, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x43, 0xfe, 0xe0, 0xfc, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xee, 0xcd, 
+  0xff, 0x3e, 0x1d, 0xff, 0x94, 0x3d, 0xfe, 0xff, 0x02, 0x4e, 0x3e, 0xff, 0x66, 0x3e, 0xff, 0x45, 0xbd, 0xff, 0x8c, 0x4d, 0xbd, 0xff, 0x01, 0x6e, 0x5e, 0xff, 0x76, 0x7e, 0xff, 0x81, 0x7e, 0x7e, 
+  0xff, 0x03, 0x76, 0x7e, 0xff, 0x76, 0x7e, 0xd8, 0x86, 0xbf, 0x54, 0x96, 0xff, 0x0c, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x23, 0xff, 0x00, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x01, 0xee, 0xae, 
+  0xff, 0x2e, 0x1e, 0xff, 0x93, 0x3e, 0x1e, 0xff, 0x01, 0x46, 0x1e, 0xff, 0x5e, 0x3e, 0xff, 0x8e, 0x45, 0xbd, 0xff, 0x81, 0x4d, 0xbd, 0xff, 0x81, 0x45, 0xbd, 0xff, 0x04, 0x4d, 0xbd, 0xff, 0x4d, 
+  0xde, 0xff, 0x5d, 0xfe, 0xfc, 0x76, 0x7e, 0xd4, 0x8e, 0xbf, 0x37, 0x8c, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xc0, 0x2c, 0xfe, 0xc0, 0x50, 0xfe, 0xc0, 0xe3, 0xee, 0xab, 0xff, 0x36, 0x1d, 0xff, 0x93, 
+  0x3e, 0x1e, 0xff, 0x01, 0x56, 0x3e, 0xff, 0x4d, 0xde, 0xff, 0x96, 0x45, 0xbd, 0xff, 0x01, 0x6e, 0x5e, 0xf3, 0x86, 0xde, 0x47, 0x8c, 0x00, 0x00, 0x00, 0x03, 0xff, 0x41, 0x1b, 0xfe, 0xe0, 0xf3, 
+  0xf6, 0xc6, 0xff, 0x56, 0x3c, 0xff, 0x90, 0x3e, 0x1e, 0xff, 0x81, 0x36, 0x1e, 0xff, 0x01, 0x2d, 0xfd, 0xff, 0x5e, 0x3e, 0xff, 0x98, 0x45, 0xbd, 0xff, 0x01, 0x66, 0x3e, 0xe4, 0x86, 0xdf, 0x1c, 
+  0x8b, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x8b, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0x86, 0x57, 0xff, 0x36, 0x1e, 0xff, 0x8d, 0x3e, 0x1e, 0xff, 0x05, 0x36, 0x1e, 0xff, 0x46, 0x3e, 0xff, 0x56, 0x5e, 
+  0xff, 0x66, 0x7e, 0xff, 0x6e, 0x9e, 0xff, 0x4d, 0xfe, 0xff, 0x99, 0x45, 0xdd, 0xff, 0x00, 0x76, 0x7e, 0xa3, 0x8a, 0x00, 0x00, 0x00, 0x05, 0xff, 0xc0, 0x10, 0xfe, 0xe0, 0xe4, 0xfe, 0xc0, 0xbc, 
+  0xfe, 0xc0, 0xb3, 0xd6, 0xa6, 0xd3, 0x2e, 0x3c, 0xff, 0x8d, 0x36, 0x1e, 0xff, 0x03, 0x5e, 0x7e, 0xff, 0x66, 0x7e, 0xff, 0x56, 0x1e, 0xff, 0x4d, 0xfe, 0xff, 0x9b, 0x45, 0xdd, 0xff, 0x01, 0x56, 
+  0x1e, 0xff, 0x97, 0x3f, 0x24, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xe0, 0xc0, 0xb6, 0x8f, 0xff, 0x36, 0x1d, 0xff, 0x8b, 0x36, 0x1e, 0xff, 0x02, 0x4e, 0x5e, 0xff, 0x5e, 0x3e, 0xff, 0x3d, 0xdd, 
+  0xff, 0x9d, 0x45, 0xdd, 0xff, 0x01, 0x3d, 0xdd, 0xff, 0x6e, 0x9e, 0x74, 0x8c, 0x00, 0x00, 0x00, 0x04, 0xff, 0x80, 0x10, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xff, 0xb6, 0x8f, 0xff, 0x26, 0x3c, 0xff, 
+  0x89, 0x36, 0x3e, 0xff, 0x01, 0x3e, 0x5e, 0xff, 0x5e, 0x5e, 0xff, 0x9f, 0x3d, 0xfe, 0xff, 0x01, 0x3d, 0xde, 0xff, 0x56, 0x3e, 0xa8, 0x8c, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x2c, 0xfe, 0xc0, 
+  0xec, 0xfe, 0xc0, 0xdb, 0xfe, 0xc0, 0x9f, 0xd6, 0xa6, 0xe0, 0x86, 0x57, 0xff, 0x4e, 0x3c, 0xff, 0x2e, 0x3d, 0xff, 0x85, 0x1e, 0x3e, 0xff, 0x01, 0x1e, 0x1e, 0xff, 0x56, 0x7e, 0xff, 0xa1, 0x3d, 
+  0xfe, 0xff, 0x00, 0x46, 0x1e, 0xc0, 0x8c, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xe0, 0x0b, 0xfe, 0xc0, 0x20, 0xfe, 0xc0, 0x08, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0xd0, 0xfe, 0xc0, 0xff, 0xf6, 0xc6, 0xff, 
+  0xee, 0xcb, 0xff, 0xee, 0xae, 0xff, 0x85, 0xee, 0xce, 0xff, 0x00, 0x86, 0x5b, 0xff, 0xa1, 0x3d, 0xfe, 0xff, 0x00, 0x45, 0xfe, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xe0, 0xe7, 0xfe, 0xc0, 
+  0xff, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xdc, 0x82, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0x86, 0x3b, 0xff, 0xa1, 0x3d, 0xfe, 0xff, 0x00, 0x4e, 0x3e, 0x74, 0x90, 0x00, 0x00, 0x00, 0x03, 
+  0xfe, 0xe0, 0xf4, 0xfe, 0xc0, 0x5b, 0xfe, 0xc0, 0x10, 0xfe, 0xe0, 0x6c, 0x85, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xe0, 0xff, 0x8e, 0x3a, 0xff, 0xa1, 0x3e, 0x1e, 0xff, 0x00, 0x66, 0xbe, 0x24, 0x93, 
+  0x00, 0x00, 0x00, 0x04, 0xff, 0x20, 0x44, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0x77, 0xfe, 0xc0, 0xd3, 0x81, 0xfe, 0xc0, 0xff, 0x02, 0xfe, 0xc0, 0xf4, 0x9e, 0x74, 0xfb, 0x36, 0x1e, 
+  0xff, 0x9f, 0x3e, 0x1e, 0xff, 0x00, 0x3e, 0x3e, 0xa4, 0x94, 0x00, 0x00, 0x00, 0x04, 0xff, 0x80, 0x18, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0x28, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x80, 0x81, 0xfe, 0xc0, 
+  0xff, 0x02, 0xfe, 0xe0, 0x24, 0xce, 0xa7, 0xcc, 0x0e, 0x1d, 0xff, 0x9e, 0x36, 0x1e, 0xff, 0x01, 0x3e, 0x1e, 0xec, 0x46, 0x3e, 0x20, 0x95, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x07, 0x81, 0x00, 
+  0x00, 0x00, 0x05, 0xff, 0x60, 0x13, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x34, 0x00, 0x00, 0x00, 0xff, 0x00, 0x30, 0x9e, 0x72, 0xff, 0x9d, 0x36, 0x1e, 0xff, 0x01, 0x36, 0x1e, 0xf4, 0x3e, 0x3e, 0x50, 
+  0x9a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x38, 0x82, 0x00, 0x00, 0x00, 0x01, 0xf6, 0xc0, 0x6f, 0x66, 0x3c, 0xb3, 0x9b, 0x36, 0x3e, 0xff, 0x01, 0x36, 0x3e, 0xd4, 0x3e, 0x5e, 0x33, 0xa1, 0x00, 
+  0x00, 0x00, 0x02, 0x36, 0x3e, 0x5c, 0x36, 0x3e, 0xd3, 0x36, 0x3e, 0xf4, 0x94, 0x36, 0x3e, 0xff, 0x04, 0x36, 0x3e, 0xfc, 0x36, 0x3e, 0xf3, 0x36, 0x3e, 0xd3, 0x36, 0x3e, 0x70, 0x66, 0x7f, 0x07, 
+  0xa3, 0x00, 0x00, 0x00, 0x02, 0x36, 0x3e, 0x10, 0x36, 0x3e, 0x23, 0x36, 0x3e, 0x2c, 0x93, 0x36, 0x3e, 0x2f, 0x02, 0x36, 0x3e, 0x2c, 0x36, 0x3e, 0x20, 0x3e, 0x3e, 0x10, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xef, 0xff, 0x0f, 0x00, 0xea, 0xfe, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x2b, 0x00, 0xe8, 0xfe, 0x0c, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x03, 0x00, 0xf0, 0xff, 0x04, 0x00, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xd5, 0xfd, 0x00, 0x00, 0xe6, 0xfe, 0xdc, 0x00, 0xf0, 0xfb, 0x0c, 0x0c, 0xe9, 0xfd, 0x00, 0x09, 0xcc, 0xf9, 0x00, 0x00, 0xe3, 0xfe, 0xf4, 0x00, 0xe5, 0xff, 0x54, 0x00, 0xed, 0xff, 0x00, 0x01, 0xed, 0xff, 0x00, 0x00, 0xea, 0xff, 0x73, 0x00, 0xe8, 0xff, 0x58, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x0f, 0x00, 0xe8, 0xfd, 0x94, 0x00, 0xed, 0xff, 0x04, 0x01, 0xe9, 0xff, 0x00, 0x01, 0xed, 0xff, 0x58, 0x00, 0xd8, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xbc, 0x0e, 0x96, 0xec, 0x00, 0x05, 0xe8, 0xfd, 0x97, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe3, 0xfe, 0xf7, 0x20, 0xff, 0xff, 0x00, 0x03, 0xeb, 0xff, 0x54, 0x02, 0xdf, 0xfe, 0xff, 0x00, 0xe0, 0xfd, 0xcb, 0x01, 0xe3, 0xfd, 0x00, 0x03, 0xe7, 0xfd, 0x00, 0x00, 0xeb, 0xfe, 0x34, 0x00, 0xea, 0xff, 0x58, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xee, 0xff, 0x33, 0x00, 0xda, 0xfe, 0xff, 0x04, 0xe9, 0xfe, 0xcf, 0x05, 0xf4, 0xff, 0x0c, 0x02, 0xe0, 0xfe, 0xbf, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x03, 0xe9, 0xfe, 0xd0, 0x02, 0xdd, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x06, 0xe9, 0xfe, 0xcc, 0x02, 0xe0, 0xfe, 0xf4, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x06, 0xf7, 0xff, 0x17, 0x04, 0xee, 0xfe, 0x7b, 0x01, 0xe0, 0xfe, 0xfb, 0x00, 0xe0, 0xfe, 0xa7, 0x00, 0xe4, 0xfd, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xea, 0xff, 0x90, 0x00, 0xee, 0xfd, 0x20, 0x04, 0xe5, 0xfd, 0x00, 0x03, 0xe6, 0xff, 0x5f, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xf7, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xdf, 0x02, 0xde, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xde, 0xfd, 0xcc, 0x03, 0xe3, 0xfe, 0x00, 0x07, 0xf0, 0xff, 0x0c, 0x00, 0xea, 0xfe, 0x4c, 0x00, 0xe9, 0xff, 0x34, 0x00, 0xe9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xfe, 0x00, 0x00, 0xdc, 0xfe, 0xf3, 0x01, 0xe2, 0xfe, 0xf3, 0x04, 0xed, 0xfe, 0xaf, 0x03, 0xe4, 0xfe, 0xa4, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdd, 0xfe, 0xf7, 0x05, 0xee, 0xff, 0x58, 0x04, 0xe6, 0xfe, 0xdc, 0x00, 0xdd, 0xfe, 0xff, 0x00, 0xdc, 0xfe, 0x3b, 0x00, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xea, 0xff, 0x04, 0x00, 0xff, 0xff, 0x00, 0x01, 0xeb, 0xfe, 0x00, 0x03, 0xdd, 0xfe, 0x00, 0x02, 0xdb, 0xfe, 0xd7, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x03, 0xde, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x04, 0xe1, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0x2f, 0x04, 0xeb, 0xff, 0x00, 0x01, 0xe9, 0xfe, 0x00, 0x00, 0xef, 0xff, 0x08, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe5, 0xfe, 0x2b, 0x00, 0xea, 0xfe, 0xd7, 0x00, 0xed, 0xfe, 0x88, 0x06, 0xf2, 0xff, 0x28, 0x01, 0xdd, 0xfd, 0xb8, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf8, 0x02, 0xdf, 0xff, 0x34, 0x04, 0xed, 0xff, 0x63, 0x01, 0xed, 0xfe, 0xb8, 0x00, 0xe7, 0xfe, 0xb7, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xfd, 0x1b, 0x00, 0xd7, 0xfe, 0xeb, 0x02, 0xdd, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xff, 0x03, 0xde, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x06, 0xe5, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd7, 0xfe, 0x94, 0x00, 0xd8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xff, 0xff, 0x03, 0x01, 0xd9, 0xfe, 0xd7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0xe3, 0xfe, 0x3b, 0x03, 0xe0, 0xfe, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xf3, 0xff, 0x08, 0x00, 0xe9, 0xfe, 0x67, 0x00, 0xec, 0xfe, 0x4b, 0x05, 0xef, 0xfe, 0x2f, 0x01, 0xdb, 0xfe, 0xb4, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x05, 0xf4, 0xfe, 0x28, 0x04, 0xeb, 0xfe, 0x37, 0x00, 0xea, 0xfe, 0x64, 0x00, 0xeb, 0xff, 0x34, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xd5, 0xfd, 0x00, 0x00, 0xdd, 0xfd, 0xc8, 0x01, 0xdd, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xff, 0x00, 0xdf, 0xfe, 0x37, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x01, 0xdd, 0xfe, 0x34, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xcb, 0x00, 0xed, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xec, 0xfd, 0x00, 0x00, 0xeb, 0xfe, 0x00, 0x05, 0xed, 0xfe, 0x00, 0x01, 0xd9, 0xfe, 0xd0, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x02, 0xe7, 0xfd, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x06, 0xe2, 0xfe, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xff, 0x30, 0x04, 0xe9, 0xfe, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0xec, 0xfe, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x1c, 0x00, 0xe9, 0xfd, 0xb0, 0x00, 0xe8, 0xfe, 0xdb, 0x04, 0xe8, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x09, 0xe7, 0xfd, 0xff, 0x00, 0xe8, 0xfb, 0xff, 0x38, 0xe7, 0xf2, 0xff, 0x7c, 0xe0, 0xd5, 0xff, 0xa4, 0xd8, 0xad, 0xff, 0xcd, 0xd2, 0x8f, 0xff, 0xec, 0xce, 0x78, 0xff, 0xf7, 0xcc, 0x70, 0xff, 0xe3, 0xcf, 0x7e, 0xff, 0xbf, 0xd3, 0x98, 0xff, 0x96, 0xd9, 0xb9, 0xff, 0x64, 0xe0, 0xe6, 0xff, 0x1c, 0xe1, 0xf6, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x05, 0xe6, 0xfe, 0xff, 0x04, 0xe8, 0xfe, 0xec, 0x00, 0xe8, 0xfd, 0xbc, 0x00, 0xea, 0xfe, 0x5f, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xd4, 0xfe, 0x00, 0x00, 0xdc, 0xfe, 0x83, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x03, 0xe9, 0xfe, 0xff, 0x00, 0xe7, 0xf1, 0xff, 0xa4, 0xdc, 0xb7, 0xff, 0xe3, 0xc8, 0x7a, 0xff, 0xed, 0xb8, 0x53, 0xff, 0xee, 0xb4, 0x4a, 0xff, 0xed, 0xb2, 0x47, 0xff, 0xeb, 0xb0, 0x45, 0xff, 0xeb, 0xb0, 0x45, 0xff, 0xec, 0xb1, 0x46, 0xff, 0xed, 0xb3, 0x48, 0xff, 0xee, 0xb4, 0x4b, 0xff, 0xe8, 0xbe, 0x61, 0xff, 0xd8, 0xcd, 0x8c, 0xff, 0x72, 0xdd, 0xcd, 0xff, 0x00, 0xe1, 0xfc, 0xff, 0x04, 0xdf, 0xfe, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xf0, 0x00, 0xdf, 0xff, 0x1f, 0x00, 0xe6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0x00, 0x00, 0xd5, 0xff, 0x07, 0x01, 0xd9, 0xfe, 0xc8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x00, 0xe9, 0xfc, 0xff, 0x64, 0xe2, 0xd8, 0xff, 0xd2, 0xce, 0x85, 0xff, 0xf1, 0xb7, 0x49, 0xff, 0xea, 0xb1, 0x44, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x47, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb1, 0x44, 0xff, 0xf7, 0xbc, 0x4e, 0xff, 0xb0, 0xd4, 0xa3, 0xff, 0x38, 0xdf, 0xee, 0xff, 0x00, 0xdf, 0xfe, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xd8, 0xfd, 0x50, 0x01, 0xd9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0xd1, 0xfb, 0x00, 0x01, 0xe1, 0xfe, 0x83, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x00, 0xea, 0xff, 0xff, 0x7c, 0xe0, 0xcb, 0xff, 0xe5, 0xc0, 0x66, 0xff, 0xed, 0xb2, 0x45, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb1, 0x45, 0xff, 0xed, 0xb5, 0x4a, 0xff, 0xd9, 0xca, 0x7f, 0xff, 0x26, 0xde, 0xe6, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xd8, 0x00, 0xf9, 0xff, 0x27, 0x40, 0xe5, 0xdf, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x20, 0x00, 0xe8, 0xfd, 0xab, 0x01, 0xe7, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x00, 0xe9, 0xfc, 0xff, 0x6e, 0xe2, 0xcf, 0xff, 0xee, 0xbf, 0x53, 0xff, 0xeb, 0xb2, 0x43, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xec, 0xb2, 0x42, 0xff, 0xe0, 0xc8, 0x73, 0xff, 0xab, 0xd5, 0xa5, 0xff, 0xd1, 0xd2, 0x88, 0xff, 0xf2, 0xcf, 0x71, 0xff, 0xf2, 0xcf, 0x70, 0xff, 0xd0, 0xd2, 0x8a, 0xff, 0xa1, 0xd9, 0xaf, 0xff, 0x7c, 0xe2, 0xd1, 0xe8, 0x48, 0xe6, 0xea, 0x67, 0x00, 0xfd, 0xff, 0x03, 0xf8, 0xdb, 0x89, 0x00, 0xf7, 0xd9, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xea, 0xff, 0x13, 0x00, 0xda, 0xfe, 0xc4, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x42, 0xe6, 0xea, 0xff, 0xdc, 0xc4, 0x6e, 0xff, 0xeb, 0xb3, 0x42, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xeb, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xee, 0xb6, 0x46, 0xff, 0xec, 0xb5, 0x44, 0xff, 0xeb, 0xb3, 0x42, 0xff, 0xeb, 0xb3, 0x42, 0xff, 0xec, 0xb5, 0x44, 0xff, 0xee, 0xb7, 0x46, 0xff, 0xeb, 0xbc, 0x55, 0xff, 0xe0, 0xcc, 0x7d, 0xfb, 0xf2, 0xd6, 0x87, 0x7c, 0xfd, 0xe6, 0x98, 0x07, 0xf5, 0xd7, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0x00, 0x01, 0xdb, 0xfd, 0x00, 0x01, 0xd8, 0xfe, 0xa8, 0x01, 0xda, 0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x00, 0xe9, 0xfe, 0xff, 0xad, 0xd4, 0x9e, 0xff, 0xef, 0xb4, 0x40, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x43, 0xff, 0xec, 0xb3, 0x41, 0xff, 0xee, 0xbe, 0x56, 0xff, 0xf3, 0xd0, 0x77, 0xb7, 0xf5, 0xd8, 0x85, 0x1c, 0xf5, 0xd8, 0x84, 0x00, 0xf4, 0xd5, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x01, 0xec, 0xfe, 0x00, 0x03, 0xe8, 0xff, 0x5c, 0x02, 0xdb, 0xfe, 0xfb, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x02, 0xe8, 0xfd, 0xff, 0x46, 0xe4, 0xdb, 0xff, 0xef, 0xba, 0x41, 0xff, 0xec, 0xb5, 0x41, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb4, 0x41, 0xff, 0xed, 0xb8, 0x49, 0xff, 0xf2, 0xcc, 0x6d, 0xc7, 0xf5, 0xda, 0x8c, 0x1b, 0xf5, 0xd8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xd8, 0xfb, 0x00, 0x00, 0xeb, 0xfe, 0x30, 0x00, 0xe8, 0xfe, 0xc7, 0x02, 0xe1, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe4, 0xfd, 0xff, 0x00, 0xe5, 0xfd, 0xff, 0x00, 0xe7, 0xfe, 0xff, 0x00, 0xe9, 0xfe, 0xff, 0xb2, 0xd3, 0xa1, 0xff, 0xee, 0xb4, 0x3a, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x42, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xed, 0xb9, 0x46, 0xff, 0xf4, 0xcd, 0x6f, 0xab, 0xf9, 0xe1, 0x8a, 0x07, 0xf3, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xde, 0xfe, 0x00, 0x00, 0xe2, 0xfe, 0x6b, 0x00, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x08, 0xe1, 0xfd, 0xff, 0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xf2, 0xff, 0x6b, 0xe1, 0xce, 0xff, 0xb2, 0xdf, 0xb5, 0xff, 0xd8, 0xdd, 0xa5, 0xff, 0xea, 0xbe, 0x58, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xec, 0xb7, 0x40, 0xff, 0xed, 0xbc, 0x4b, 0xfc, 0xf2, 0xd2, 0x75, 0x50, 0xf3, 0xd8, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00, 0xdc, 0xff, 0x00, 0x00, 0xda, 0xff, 0x1f, 0x01, 0xd9, 0xfe, 0xc0, 0x02, 0xda, 0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x02, 0xdf, 0xfd, 0xff, 0x02, 0xe1, 0xf9, 0xff, 0x82, 0xdd, 0xc4, 0xff, 0xe2, 0xd0, 0x72, 0xff, 0xf6, 0xc2, 0x4a, 0xff, 0xef, 0xbb, 0x3f, 0xff, 0xec, 0xb6, 0x39, 0xff, 0xec, 0xb8, 0x3e, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xf1, 0xca, 0x62, 0xc4, 0xec, 0xc8, 0x56, 0x00, 0xf9, 0xd7, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x01, 0xe9, 0xff, 0x00, 0x03, 0xe7, 0xff, 0x44, 0x01, 0xdb, 0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x07, 0xde, 0xfd, 0xff, 0x00, 0xdf, 0xf9, 0xff, 0xc6, 0xd5, 0x98, 0xff, 0xeb, 0xc0, 0x4c, 0xff, 0xed, 0xb9, 0x3d, 0xff, 0xec, 0xb8, 0x3d, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xed, 0xbd, 0x47, 0xff, 0xf7, 0xdc, 0x82, 0x34, 0xf5, 0xd5, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xea, 0xff, 0x5f, 0x02, 0xe2, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0xde, 0xfd, 0xff, 0xa8, 0xd7, 0xa2, 0xff, 0xef, 0xbc, 0x39, 0xff, 0xec, 0xba, 0x3c, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3c, 0xff, 0xec, 0xbb, 0x3f, 0xff, 0xed, 0xbd, 0x48, 0xff, 0xee, 0xbf, 0x4f, 0xff, 0xee, 0xc0, 0x53, 0xff, 0xee, 0xc0, 0x52, 0xff, 0xee, 0xbf, 0x4d, 0xff, 0xed, 0xbd, 0x45, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3c, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xb9, 0x3a, 0xff, 0xf1, 0xd0, 0x67, 0x78, 0xf1, 0xcd, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x4b, 0x00, 0xdd, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x63, 0xdb, 0xcc, 0xff, 0xef, 0xc0, 0x3c, 0xff, 0xed, 0xba, 0x3b, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xf1, 0xc6, 0x5e, 0xff, 0xf2, 0xcb, 0x72, 0xff, 0xf0, 0xc4, 0x66, 0xff, 0xee, 0xbe, 0x5f, 0xff, 0xed, 0xbb, 0x5b, 0xff, 0xee, 0xbb, 0x5d, 0xff, 0xef, 0xc0, 0x61, 0xff, 0xf1, 0xc6, 0x6a, 0xff, 0xf2, 0xcb, 0x6f, 0xff, 0xef, 0xc2, 0x50, 0xff, 0xed, 0xba, 0x3a, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xba, 0x3b, 0xff, 0xef, 0xc5, 0x50, 0xab, 0xef, 0xc4, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xe4, 0xff, 0x00, 0x00, 0x5e, 0xff, 0x03, 0x00, 0xd9, 0xff, 0x6f, 0x01, 0xd9, 0xfe, 0xd0, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x00, 0xdc, 0xf7, 0xff, 0xd4, 0xcc, 0x7c, 0xff, 0xed, 0xbb, 0x38, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3a, 0xff, 0xef, 0xc1, 0x4b, 0xff, 0xf1, 0xc9, 0x6a, 0xff, 0xef, 0xbe, 0x5f, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb0, 0x44, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb1, 0x47, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb1, 0x45, 0xff, 0xeb, 0xb0, 0x43, 0xff, 0xec, 0xb5, 0x4d, 0xff, 0xf0, 0xc4, 0x69, 0xff, 0xf1, 0xc8, 0x61, 0xff, 0xed, 0xbe, 0x41, 0xff, 0xed, 0xbc, 0x3a, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0xed, 0xbc, 0x3a, 0xff, 0xed, 0xbc, 0x3a, 0xff, 0xed, 0xbc, 0x3a, 0xff, 0xee, 0xbf, 0x42, 0xc7, 0xee, 0xbf, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd0, 0xff, 0x00, 0x02, 0xe0, 0xfe, 0x00, 0x03, 0xe5, 0xfe, 0x98, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x42, 0xda, 0xee, 0xff, 0xe1, 0xc2, 0x51, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbc, 0x37, 0xff, 0xef, 0xc3, 0x51, 0xff, 0xef, 0xc2, 0x61, 0xff, 0xeb, 0xb4, 0x4a, 0xff, 0xeb, 0xb2, 0x45, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb2, 0x45, 0xff, 0xed, 0xb7, 0x50, 0xff, 0xf1, 0xc8, 0x66, 0xff, 0xee, 0xbf, 0x41, 0xff, 0xed, 0xbd, 0x38, 0xff, 0xed, 0xbe, 0x3b, 0xff, 0xed, 0xbe, 0x3b, 0xff, 0xed, 0xbd, 0x38, 0xff, 0xec, 0xbd, 0x36, 0xb4, 0xf0, 0xc8, 0x60, 0x00, 0xf7, 0xd7, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xee, 0xfe, 0x00, 0x00, 0xea, 0xfe, 0x43, 0x01, 0xdc, 0xfe, 0xfc, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x65, 0xd8, 0xe9, 0xff, 0xea, 0xbf, 0x35, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x38, 0xff, 0xef, 0xc3, 0x4a, 0xff, 0xef, 0xc4, 0x64, 0xff, 0xeb, 0xb3, 0x44, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb3, 0x45, 0xff, 0xeb, 0xb4, 0x48, 0xff, 0xf1, 0xca, 0x6c, 0xff, 0xf1, 0xcc, 0x70, 0xff, 0xf2, 0xcc, 0x76, 0xff, 0xf3, 0xcd, 0x76, 0xff, 0xf2, 0xcc, 0x71, 0xff, 0xf3, 0xce, 0x70, 0xd8, 0xf5, 0xd5, 0x83, 0x54, 0xf5, 0xdc, 0x8f, 0x0c, 0xf6, 0xd7, 0x86, 0x00, 0xf6, 0xd4, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xf2, 0xff, 0x23, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x70, 0xd6, 0xe7, 0xff, 0xee, 0xbf, 0x26, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xc1, 0x3d, 0xff, 0xf0, 0xc4, 0x5c, 0xff, 0xec, 0xb3, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb4, 0x44, 0xff, 0xec, 0xb5, 0x46, 0xff, 0xec, 0xb5, 0x46, 0xff, 0xec, 0xb3, 0x42, 0xff, 0xec, 0xb3, 0x42, 0xff, 0xec, 0xb4, 0x45, 0xff, 0xed, 0xb7, 0x4a, 0xff, 0xef, 0xbd, 0x57, 0xfc, 0xf2, 0xcc, 0x72, 0xd4, 0xf6, 0xd6, 0x87, 0x37, 0xf5, 0xd7, 0x84, 0x00, 0xf3, 0xd8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xf2, 0xff, 0x00, 0x00, 0xe5, 0xfd, 0x00, 0x00, 0xd8, 0xff, 0x2c, 0x01, 0xd7, 0xff, 0x50, 0x01, 0xd9, 0xfe, 0xe3, 0x59, 0xd6, 0xe9, 0xff, 0xe6, 0xc0, 0x33, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x36, 0xff, 0xef, 0xc4, 0x4d, 0xff, 0xed, 0xb8, 0x49, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x43, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xec, 0xb5, 0x42, 0xff, 0xf1, 0xc8, 0x68, 0xf3, 0xf4, 0xd7, 0x80, 0x47, 0xf2, 0xd0, 0x62, 0x00, 0xff, 0xd4, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xff, 0x00, 0x00, 0xd2, 0xff, 0x00, 0x05, 0xea, 0xfe, 0x1b, 0x01, 0xdb, 0xfe, 0xf3, 0x2f, 0xd8, 0xef, 0xff, 0xde, 0xc3, 0x50, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x35, 0xff, 0xed, 0xc0, 0x33, 0xff, 0xed, 0xbf, 0x31, 0xff, 0xec, 0xbe, 0x2a, 0xff, 0xf0, 0xc4, 0x57, 0xff, 0xec, 0xb5, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xec, 0xb6, 0x41, 0xff, 0xf0, 0xc3, 0x5d, 0xe4, 0xf8, 0xd7, 0x7f, 0x1c, 0xff, 0xd2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xe5, 0xfe, 0x8b, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd9, 0xfb, 0xff, 0xbb, 0xc9, 0x83, 0xff, 0xf1, 0xc1, 0x31, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x35, 0xff, 0xee, 0xc1, 0x33, 0xff, 0xef, 0xc4, 0x3f, 0xff, 0xf1, 0xca, 0x53, 0xff, 0xf2, 0xce, 0x61, 0xff, 0xf3, 0xd1, 0x6c, 0xff, 0xed, 0xbb, 0x48, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb7, 0x41, 0xff, 0xec, 0xb8, 0x43, 0xff, 0xf2, 0xcd, 0x6d, 0xa3, 0xf6, 0xd4, 0x71, 0x00, 0xeb, 0xcc, 0x90, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x10, 0x00, 0xdd, 0xfe, 0xe4, 0x00, 0xd8, 0xfd, 0xbc, 0x00, 0xd9, 0xff, 0xb3, 0x33, 0xd5, 0xce, 0xd3, 0xe1, 0xc3, 0x27, 0xff, 0xef, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x32, 0xff, 0xf1, 0xcc, 0x55, 0xff, 0xf2, 0xcb, 0x62, 0xff, 0xee, 0xbf, 0x4e, 0xff, 0xed, 0xbb, 0x46, 0xff, 0xec, 0xba, 0x43, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xec, 0xb8, 0x3f, 0xff, 0xee, 0xc0, 0x4e, 0xff, 0xf8, 0xe3, 0x8e, 0x24, 0xf5, 0xd9, 0x7f, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xdb, 0xfe, 0x00, 0x00, 0xd8, 0xfd, 0x00, 0x00, 0xd5, 0xfe, 0x00, 0x00, 0xdc, 0xff, 0xc0, 0x79, 0xd0, 0xb1, 0xff, 0xec, 0xc2, 0x2e, 0xff, 0xef, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x33, 0xff, 0xee, 0xc2, 0x32, 0xff, 0xf0, 0xc9, 0x4b, 0xff, 0xef, 0xc5, 0x56, 0xff, 0xeb, 0xb8, 0x3a, 0xff, 0xec, 0xb9, 0x3d, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3e, 0xff, 0xec, 0xb9, 0x3b, 0xff, 0xf2, 0xcf, 0x6c, 0x74, 0xf1, 0xcc, 0x67, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x10, 0x01, 0xda, 0xfe, 0xe3, 0x00, 0xd9, 0xfe, 0xff, 0x79, 0xd0, 0xaf, 0xff, 0xe1, 0xc4, 0x24, 0xff, 0xf1, 0xc3, 0x2e, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xef, 0xc7, 0x3b, 0xff, 0xf1, 0xc8, 0x55, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xbb, 0x3c, 0xff, 0xed, 0xba, 0x3b, 0xff, 0xef, 0xc6, 0x52, 0xa8, 0xef, 0xc5, 0x50, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xe2, 0xfe, 0x2c, 0x00, 0xda, 0xfe, 0xec, 0x01, 0xd8, 0xfe, 0xdb, 0x00, 0xda, 0xff, 0x9f, 0x30, 0xd5, 0xce, 0xe0, 0xbb, 0xc9, 0x7f, 0xff, 0xdf, 0xc5, 0x49, 0xff, 0xe7, 0xc4, 0x2b, 0xff, 0xf0, 0xc3, 0x19, 0xff, 0xf0, 0xc3, 0x18, 0xff, 0xf0, 0xc3, 0x18, 0xff, 0xf0, 0xc3, 0x18, 0xff, 0xf0, 0xc3, 0x18, 0xff, 0xf0, 0xc3, 0x18, 0xff, 0xf0, 0xc2, 0x15, 0xff, 0xf2, 0xcb, 0x4e, 0xff, 0xed, 0xbb, 0x3a, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3b, 0xff, 0xed, 0xbb, 0x3a, 0xff, 0xee, 0xbf, 0x42, 0xc0, 0xee, 0xbe, 0x41, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xdd, 0xfe, 0x0b, 0x00, 0xda, 0xfd, 0x20, 0x00, 0xd8, 0xff, 0x08, 0x00, 0xdc, 0xff, 0x00, 0x00, 0xdd, 0xff, 0xd0, 0x00, 0xd9, 0xfa, 0xff, 0x2e, 0xd7, 0xee, 0xff, 0x5a, 0xd7, 0xe9, 0xff, 0x72, 0xd6, 0xe7, 0xff, 0x74, 0xd7, 0xe7, 0xff, 0x74, 0xd7, 0xe6, 0xff, 0x74, 0xd7, 0xe6, 0xff, 0x74, 0xd7, 0xe6, 0xff, 0x74, 0xd8, 0xe6, 0xff, 0x6f, 0xd8, 0xe8, 0xff, 0xd7, 0xc9, 0x81, 0xff, 0xed, 0xbc, 0x38, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xed, 0xbd, 0x39, 0xff, 0xee, 0xbe, 0x3e, 0xa8, 0xee, 0xbe, 0x3d, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xfe, 0x00, 0x00, 0xdc, 0xfe, 0xe7, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xe3, 0x01, 0xd9, 0xfe, 0xdc, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x00, 0xdd, 0xff, 0xff, 0xd7, 0xc5, 0x84, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x38, 0xff, 0xed, 0xbe, 0x37, 0xff, 0xf0, 0xc5, 0x49, 0x74, 0xf0, 0xc4, 0x47, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xfe, 0x00, 0x00, 0xdb, 0xfe, 0xf4, 0x00, 0xd8, 0xfe, 0x5b, 0x03, 0xd8, 0xfc, 0x10, 0x02, 0xde, 0xfd, 0x6c, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xd2, 0xc5, 0x85, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x37, 0xff, 0xed, 0xbf, 0x36, 0xff, 0xf4, 0xd3, 0x63, 0x24, 0xf2, 0xcd, 0x58, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x00, 0xfb, 0xf7, 0x00, 0x00, 0xd8, 0xfe, 0x00, 0x00, 0xe1, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x44, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf4, 0x01, 0xd9, 0xfe, 0x77, 0x01, 0xd9, 0xfe, 0xd3, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xda, 0xff, 0xf4, 0xa4, 0xcb, 0x95, 0xfb, 0xf0, 0xc0, 0x30, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xed, 0xc0, 0x36, 0xff, 0xef, 0xc4, 0x3b, 0xa4, 0xed, 0xb8, 0x42, 0x00, 0xc4, 0x00, 0x72, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x18, 0x00, 0xd8, 0xfe, 0xf3, 0x00, 0xd7, 0xfe, 0x28, 0x00, 0xd6, 0xfd, 0x00, 0x00, 0xdb, 0xfd, 0x80, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0x24, 0x35, 0xd6, 0xcc, 0xcc, 0xec, 0xc0, 0x05, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x34, 0xff, 0xee, 0xc1, 0x35, 0xec, 0xef, 0xc6, 0x41, 0x20, 0xf2, 0xd7, 0x55, 0x00, 0xae, 0xae, 0x37, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x00, 0x00, 0x98, 0xfe, 0x00, 0x00, 0xe9, 0xff, 0x07, 0x00, 0xda, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0xed, 0xff, 0x13, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xda, 0xff, 0x34, 0x00, 0xdd, 0xfc, 0x00, 0x00, 0xe1, 0xff, 0x30, 0x91, 0xcd, 0x99, 0xff, 0xed, 0xc2, 0x31, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xff, 0xee, 0xc2, 0x34, 0xf4, 0xed, 0xc3, 0x39, 0x50, 0xeb, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xed, 0x00, 0x00, 0xce, 0xff, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xbf, 0xff, 0x00, 0x00, 0xd7, 0xfe, 0x00, 0x00, 0xda, 0xfe, 0x38, 0x00, 0xdd, 0xfc, 0x00, 0x0e, 0xd5, 0xf7, 0x00, 0x00, 0xd8, 0xf7, 0x00, 0x00, 0xd9, 0xef, 0x6f, 0xde, 0xc6, 0x60, 0xb3, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xd4, 0xf0, 0xc7, 0x38, 0x33, 0xed, 0xa9, 0x00, 0x00, 0xf2, 0xdb, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xdc, 0xf5, 0x00, 0xdf, 0xc0, 0x66, 0x00, 0xed, 0xc3, 0x34, 0x5c, 0xee, 0xc3, 0x32, 0xd3, 0xee, 0xc3, 0x32, 0xf4, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xff, 0xee, 0xc3, 0x32, 0xfc, 0xee, 0xc3, 0x32, 0xf3, 0xee, 0xc3, 0x32, 0xd3, 0xef, 0xc4, 0x33, 0x70, 0xf9, 0xce, 0x5e, 0x07, 0xf3, 0xcb, 0x3e, 0x00, 0xff, 0xdb, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xcc, 0x4d, 0x00, 0xe2, 0xf4, 0x82, 0x00, 0xde, 0x73, 0x00, 0x00, 0xee, 0xc5, 0x34, 0x10, 0xef, 0xc5, 0x32, 0x23, 0xee, 0xc4, 0x31, 0x2c, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2f, 0xee, 0xc4, 0x31, 0x2c, 0xee, 0xc4, 0x30, 0x20, 0xed, 0xc5, 0x36, 0x10, 0x4d, 0x00, 0x00, 0x00, 0xf4, 0xc9, 0x47, 0x00, 0xf1, 0xc6, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 
+  0xff, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xeb, 0xff, 0x2b, 0x00, 0xe8, 0xfe, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xec, 0xff, 0x03, 0x00, 0xf0, 0xff, 0x04, 0xb5, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xe6, 0xfe, 0xdc, 0x00, 0xf0, 0xfb, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe3, 0xfe, 0xf4, 0x00, 0xe5, 0xff, 0x54, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0xea, 0xff, 0x73, 0x00, 0xe8, 0xff, 0x58, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xe7, 0xff, 0x0f, 0x00, 0xe8, 0xfd, 0x94, 0x00, 0xed, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xed, 
+  0xff, 0x58, 0x00, 0xd8, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe8, 0xfd, 0x97, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe3, 0xfe, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xeb, 
+  0xff, 0x54, 0x02, 0xdf, 0xfe, 0xff, 0x00, 0xe0, 0xfd, 0xcb, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xeb, 0xfe, 0x34, 0x00, 0xea, 0xff, 0x58, 0xac, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0xee, 
+  0xff, 0x33, 0x00, 0xda, 0xfe, 0xff, 0x04, 0xe9, 0xfe, 0xcf, 0x05, 0xf4, 0xff, 0x0c, 0x02, 0xe0, 0xfe, 0xbf, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x03, 0xe9, 0xfe, 0xd0, 0x02, 0xdd, 
+  0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x06, 0xe9, 0xfe, 0xcc, 0x02, 0xe0, 0xfe, 0xf4, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x06, 0xf7, 0xff, 0x17, 0x04, 0xee, 
+  0xfe, 0x7b, 0x01, 0xe0, 0xfe, 0xfb, 0x00, 0xe0, 0xfe, 0xa7, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xea, 0xff, 0x90, 0x00, 0xee, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe6, 0xff, 0x5f, 
+  0x81, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0x03, 0xe6, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xf7, 0x88, 0x02, 0xda, 0xfe, 0xff, 0x08, 0x02, 0xd9, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xdf, 0x02, 0xde, 0xfe, 0xff, 
+  0x01, 0xd8, 0xfe, 0xff, 0x02, 0xde, 0xfd, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0xff, 0x0c, 0x00, 0xea, 0xfe, 0x4c, 0x00, 0xe9, 0xff, 0x34, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xdc, 
+  0xfe, 0xf3, 0x01, 0xe2, 0xfe, 0xf3, 0x04, 0xed, 0xfe, 0xaf, 0x03, 0xe4, 0xfe, 0xa4, 0x02, 0xd9, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 
+  0xff, 0x85, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x00, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x04, 0x03, 0xdd, 0xfe, 0xf7, 0x05, 0xee, 0xff, 0x58, 0x04, 0xe6, 
+  0xfe, 0xdc, 0x00, 0xdd, 0xfe, 0xff, 0x00, 0xdc, 0xfe, 0x3b, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x04, 0x82, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0xdb, 0xfe, 0xd7, 0x01, 0xd8, 
+  0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x03, 0xde, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x82, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 
+  0x83, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 0x82, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x04, 0xe1, 0xfe, 0xff, 
+  0x81, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0x01, 0xd9, 0xfe, 0x2f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x08, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe5, 0xfe, 0x2b, 0x00, 0xea, 
+  0xfe, 0xd7, 0x00, 0xed, 0xfe, 0x88, 0x06, 0xf2, 0xff, 0x28, 0x01, 0xdd, 0xfd, 0xb8, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x82, 0x04, 0xdd, 
+  0xfd, 0xff, 0x87, 0x05, 0xde, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x06, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf8, 0x02, 0xdf, 
+  0xff, 0x34, 0x04, 0xed, 0xff, 0x63, 0x01, 0xed, 0xfe, 0xb8, 0x00, 0xe7, 0xfe, 0xb7, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xda, 0xfd, 0x1b, 0x00, 0xd7, 0xfe, 0xeb, 0x02, 0xdd, 0xfe, 0xff, 
+  0x03, 0xe3, 0xfe, 0xff, 0x03, 0xde, 0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 
+  0xff, 0x83, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x03, 
+  0x06, 0xe5, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd7, 0xfe, 0x94, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xff, 0xff, 0x03, 0x01, 0xd9, 0xfe, 0xd7, 0x01, 0xd9, 
+  0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 
+  0x81, 0x06, 0xe0, 0xfd, 0xff, 0x00, 0x07, 0xe0, 0xfd, 0xff, 0x85, 0x07, 0xe1, 0xfd, 0xff, 0x00, 0x07, 0xe0, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x03, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 
+  0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0xe3, 0xfe, 0x3b, 
+  0x9b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf3, 0xff, 0x08, 0x00, 0xe9, 0xfe, 0x67, 0x00, 0xec, 0xfe, 0x4b, 0x05, 0xef, 0xfe, 0x2f, 0x01, 0xdb, 0xfe, 0xb4, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 
+  0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x02, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 
+  0x81, 0x07, 0xe1, 0xfd, 0xff, 0x00, 0x07, 0xe2, 0xfd, 0xff, 0x83, 0x08, 0xe2, 0xfd, 0xff, 0x00, 0x07, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x02, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 
+  0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x08, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 
+  0x05, 0xf4, 0xfe, 0x28, 0x04, 0xeb, 0xfe, 0x37, 0x00, 0xea, 0xfe, 0x64, 0x00, 0xeb, 0xff, 0x34, 0x99, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xdd, 0xfd, 0xc8, 0x01, 0xdd, 0xfe, 0xff, 0x02, 0xdd, 
+  0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x07, 0xe1, 
+  0xfd, 0xff, 0x01, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x09, 0xe3, 0xfd, 0xff, 0x00, 0x09, 0xe4, 0xfd, 0xff, 0x81, 0x09, 0xe4, 0xfc, 0xff, 0x00, 0x09, 0xe4, 0xfd, 0xff, 0x81, 
+  0x09, 0xe3, 0xfd, 0xff, 0x01, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x03, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 
+  0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xff, 0x00, 0xdf, 0xfe, 0x37, 0x99, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xdd, 0xfe, 0x34, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x09, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 
+  0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x81, 0x09, 0xe3, 0xfd, 0xff, 0x01, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 
+  0xe4, 0xfc, 0xff, 0x83, 0x0a, 0xe5, 0xfc, 0xff, 0x01, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x81, 0x09, 0xe3, 0xfd, 0xff, 0x0c, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 
+  0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 
+  0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xcb, 0x00, 0xed, 0xff, 0x04, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x01, 0xd9, 0xfe, 0xd0, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 
+  0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 
+  0xff, 0x81, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x81, 0x0b, 0xe7, 0xfc, 0xff, 0x00, 0x02, 0xe7, 0xfd, 0xff, 0x82, 0x00, 0xe7, 0xff, 0xff, 0x81, 0x00, 0xe6, 0xff, 0xff, 0x0b, 
+  0x00, 0xe5, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x06, 0xe2, 0xfe, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xd9, 0xff, 0x30, 0x97, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xeb, 0xff, 0x1c, 0x00, 0xe9, 0xfd, 0xb0, 0x00, 0xe8, 
+  0xfe, 0xdb, 0x04, 0xe8, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x1b, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 
+  0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 
+  0x09, 0xe7, 0xfd, 0xff, 0x00, 0xe8, 0xfb, 0xff, 0x38, 0xe7, 0xf2, 0xff, 0x7c, 0xe0, 0xd5, 0xff, 0xa4, 0xd8, 0xad, 0xff, 0xcd, 0xd2, 0x8f, 0xff, 0xec, 0xce, 0x78, 0xff, 0xf7, 0xcc, 0x70, 0xff, 
+  0xe3, 0xcf, 0x7e, 0xff, 0xbf, 0xd3, 0x98, 0xff, 0x96, 0xd9, 0xb9, 0xff, 0x64, 0xe0, 0xe6, 0xff, 0x1c, 0xe1, 0xf6, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 
+  0x04, 0xde, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0x02, 0xda, 0xfe, 0xff, 0x05, 0xe6, 0xfe, 0xff, 0x04, 0xe8, 0xfe, 0xec, 0x00, 0xe8, 0xfd, 0xbc, 0x00, 0xea, 0xfe, 0x5f, 0x95, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xfe, 0x83, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x14, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 
+  0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 
+  0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x03, 0xe9, 0xfe, 0xff, 0x00, 0xe7, 0xf1, 0xff, 0xa4, 0xdc, 0xb7, 0xff, 0xe3, 0xc8, 0x7a, 0xff, 0xed, 0xb8, 0x53, 0xff, 0xee, 0xb4, 0x4a, 0xff, 0xed, 0xb2, 
+  0x47, 0xff, 0x81, 0xeb, 0xb0, 0x45, 0xff, 0x0f, 0xec, 0xb1, 0x46, 0xff, 0xed, 0xb3, 0x48, 0xff, 0xee, 0xb4, 0x4b, 0xff, 0xe8, 0xbe, 0x61, 0xff, 0xd8, 0xcd, 0x8c, 0xff, 0x72, 0xdd, 0xcd, 0xff, 
+  0x00, 0xe1, 0xfc, 0xff, 0x04, 0xdf, 0xfe, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 
+  0x01, 0xda, 0xfe, 0xf0, 0x00, 0xdf, 0xff, 0x1f, 0x95, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xd5, 0xff, 0x07, 0x01, 0xd9, 0xfe, 0xc8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 
+  0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x0d, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 
+  0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x00, 0xe9, 0xfc, 0xff, 0x64, 0xe2, 0xd8, 0xff, 0xd2, 0xce, 0x85, 0xff, 0xf1, 0xb7, 0x49, 0xff, 0xea, 0xb1, 0x44, 0xff, 
+  0x87, 0xeb, 0xb2, 0x47, 0xff, 0x05, 0xeb, 0xb2, 0x46, 0xff, 0xeb, 0xb1, 0x44, 0xff, 0xf7, 0xbc, 0x4e, 0xff, 0xb0, 0xd4, 0xa3, 0xff, 0x38, 0xdf, 0xee, 0xff, 0x00, 0xdf, 0xfe, 0xff, 0x81, 0x04, 
+  0xdd, 0xfd, 0xff, 0x03, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xd8, 0xfd, 0x50, 0x97, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0xe1, 0xfe, 0x83, 0x01, 0xda, 
+  0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 
+  0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x00, 0xea, 0xff, 0xff, 0x7c, 0xe0, 0xcb, 0xff, 0xe5, 0xc0, 0x66, 0xff, 0xed, 0xb2, 
+  0x45, 0xff, 0x8b, 0xeb, 0xb2, 0x46, 0xff, 0x09, 0xeb, 0xb1, 0x45, 0xff, 0xed, 0xb5, 0x4a, 0xff, 0xd9, 0xca, 0x7f, 0xff, 0x26, 0xde, 0xe6, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 
+  0x00, 0xdc, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xd8, 0x00, 0xf9, 0xff, 0x27, 0x94, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xeb, 0xff, 0x20, 0x00, 0xe8, 0xfd, 0xab, 0x01, 0xe7, 
+  0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 
+  0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x00, 0xe9, 0xfc, 0xff, 0x6e, 0xe2, 0xcf, 0xff, 0xee, 0xbf, 
+  0x53, 0xff, 0xeb, 0xb2, 0x43, 0xff, 0x8e, 0xeb, 0xb3, 0x45, 0xff, 0x0a, 0xec, 0xb2, 0x42, 0xff, 0xe0, 0xc8, 0x73, 0xff, 0xab, 0xd5, 0xa5, 0xff, 0xd1, 0xd2, 0x88, 0xff, 0xf2, 0xcf, 0x71, 0xff, 
+  0xf2, 0xcf, 0x70, 0xff, 0xd0, 0xd2, 0x8a, 0xff, 0xa1, 0xd9, 0xaf, 0xff, 0x7c, 0xe2, 0xd1, 0xe8, 0x48, 0xe6, 0xea, 0x67, 0x00, 0xfd, 0xff, 0x03, 0x91, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0xea, 
+  0xff, 0x13, 0x00, 0xda, 0xfe, 0xc4, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 
+  0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x42, 0xe6, 
+  0xea, 0xff, 0xdc, 0xc4, 0x6e, 0xff, 0xeb, 0xb3, 0x42, 0xff, 0x90, 0xeb, 0xb4, 0x44, 0xff, 0x02, 0xec, 0xb4, 0x44, 0xff, 0xee, 0xb6, 0x46, 0xff, 0xec, 0xb5, 0x44, 0xff, 0x81, 0xeb, 0xb3, 0x42, 
+  0xff, 0x05, 0xec, 0xb5, 0x44, 0xff, 0xee, 0xb7, 0x46, 0xff, 0xeb, 0xbc, 0x55, 0xff, 0xe0, 0xcc, 0x7d, 0xfb, 0xf2, 0xd6, 0x87, 0x7c, 0xfd, 0xe6, 0x98, 0x07, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0f, 
+  0x01, 0xd8, 0xfe, 0xa8, 0x01, 0xda, 0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 
+  0x07, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x00, 0xe9, 0xfe, 0xff, 0xad, 0xd4, 0x9e, 0xff, 0xef, 0xb4, 0x40, 0xff, 
+  0x98, 0xec, 0xb4, 0x44, 0xff, 0x04, 0xec, 0xb4, 0x43, 0xff, 0xec, 0xb3, 0x41, 0xff, 0xee, 0xbe, 0x56, 0xff, 0xf3, 0xd0, 0x77, 0xb7, 0xf5, 0xd8, 0x85, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0f, 
+  0x03, 0xe8, 0xff, 0x5c, 0x02, 0xdb, 0xfe, 0xfb, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 
+  0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x02, 0xe8, 0xfd, 0xff, 0x46, 0xe4, 0xdb, 0xff, 0xef, 0xba, 0x41, 0xff, 0xec, 0xb5, 0x41, 0xff, 
+  0x9a, 0xec, 0xb5, 0x42, 0xff, 0x03, 0xec, 0xb4, 0x41, 0xff, 0xed, 0xb8, 0x49, 0xff, 0xf2, 0xcc, 0x6d, 0xc7, 0xf5, 0xda, 0x8c, 0x1b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xeb, 0xfe, 0x30, 
+  0x00, 0xe8, 0xfe, 0xc7, 0x02, 0xe1, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x0b, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 
+  0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe4, 0xfd, 0xff, 0x00, 0xe5, 0xfd, 0xff, 0x00, 0xe7, 0xfe, 0xff, 0x00, 0xe9, 0xfe, 0xff, 0xb2, 0xd3, 0xa1, 0xff, 0xee, 0xb4, 0x3a, 0xff, 0x9c, 0xec, 
+  0xb6, 0x42, 0xff, 0x03, 0xec, 0xb6, 0x41, 0xff, 0xed, 0xb9, 0x46, 0xff, 0xf4, 0xcd, 0x6f, 0xab, 0xf9, 0xe1, 0x8a, 0x07, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xe2, 0xfe, 0x6b, 0x00, 0xd9, 
+  0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x0a, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x08, 0xe1, 0xfd, 0xff, 
+  0x00, 0xe2, 0xff, 0xff, 0x00, 0xe3, 0xf2, 0xff, 0x6b, 0xe1, 0xce, 0xff, 0xb2, 0xdf, 0xb5, 0xff, 0xd8, 0xdd, 0xa5, 0xff, 0xea, 0xbe, 0x58, 0xff, 0x9f, 0xec, 0xb7, 0x40, 0xff, 0x01, 0xed, 0xbc, 
+  0x4b, 0xfc, 0xf2, 0xd2, 0x75, 0x50, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xda, 0xff, 0x1f, 0x01, 0xd9, 0xfe, 0xc0, 0x02, 0xda, 0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 
+  0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x02, 0xdf, 0xfd, 0xff, 0x02, 0xe1, 0xf9, 0xff, 0x82, 0xdd, 0xc4, 0xff, 0xe2, 0xd0, 0x72, 0xff, 0xf6, 0xc2, 0x4a, 0xff, 0xef, 0xbb, 0x3f, 0xff, 
+  0xec, 0xb6, 0x39, 0xff, 0xec, 0xb8, 0x3e, 0xff, 0xa0, 0xec, 0xb8, 0x3f, 0xff, 0x00, 0xf1, 0xca, 0x62, 0xc4, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x03, 0xe7, 0xff, 0x44, 0x01, 0xdb, 0xfe, 0xfc, 
+  0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x07, 0xde, 0xfd, 0xff, 0x00, 0xdf, 0xf9, 0xff, 0xc6, 0xd5, 0x98, 0xff, 0xeb, 0xc0, 0x4c, 0xff, 0xed, 0xb9, 0x3d, 0xff, 
+  0xec, 0xb8, 0x3d, 0xff, 0xa3, 0xec, 0xb9, 0x3e, 0xff, 0x01, 0xed, 0xbd, 0x47, 0xff, 0xf7, 0xdc, 0x82, 0x34, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xea, 0xff, 0x5f, 0x02, 0xe2, 0xfe, 0xff, 
+  0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0xde, 0xfd, 0xff, 0xa8, 0xd7, 0xa2, 0xff, 0xef, 0xbc, 0x39, 0xff, 0xec, 0xba, 0x3c, 0xff, 
+  0x95, 0xec, 0xba, 0x3d, 0xff, 0x09, 0xec, 0xba, 0x3c, 0xff, 0xec, 0xbb, 0x3f, 0xff, 0xed, 0xbd, 0x48, 0xff, 0xee, 0xbf, 0x4f, 0xff, 0xee, 0xc0, 0x53, 0xff, 0xee, 0xc0, 0x52, 0xff, 0xee, 0xbf, 
+  0x4d, 0xff, 0xed, 0xbd, 0x45, 0xff, 0xec, 0xba, 0x3d, 0xff, 0xec, 0xba, 0x3c, 0xff, 0x85, 0xec, 0xba, 0x3d, 0xff, 0x01, 0xec, 0xb9, 0x3a, 0xff, 0xf1, 0xd0, 0x67, 0x78, 0x8c, 0x00, 0x00, 0x00, 
+  0x00, 0x09, 0x00, 0xe7, 0xff, 0x4b, 0x00, 0xdd, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x63, 0xdb, 
+  0xcc, 0xff, 0xef, 0xc0, 0x3c, 0xff, 0xed, 0xba, 0x3b, 0xff, 0x95, 0xed, 0xbb, 0x3c, 0xff, 0x0b, 0xed, 0xbb, 0x3b, 0xff, 0xf1, 0xc6, 0x5e, 0xff, 0xf2, 0xcb, 0x72, 0xff, 0xf0, 0xc4, 0x66, 0xff, 
+  0xee, 0xbe, 0x5f, 0xff, 0xed, 0xbb, 0x5b, 0xff, 0xee, 0xbb, 0x5d, 0xff, 0xef, 0xc0, 0x61, 0xff, 0xf1, 0xc6, 0x6a, 0xff, 0xf2, 0xcb, 0x6f, 0xff, 0xef, 0xc2, 0x50, 0xff, 0xed, 0xba, 0x3a, 0xff, 
+  0x84, 0xed, 0xbb, 0x3c, 0xff, 0x01, 0xed, 0xba, 0x3b, 0xff, 0xef, 0xc5, 0x50, 0xab, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5e, 0xff, 0x03, 0x00, 0xd9, 0xff, 0x6f, 0x01, 0xd9, 0xfe, 0xd0, 
+  0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x00, 0xdc, 0xf7, 0xff, 0xd4, 0xcc, 0x7c, 0xff, 0xed, 0xbb, 0x38, 0xff, 0x94, 0xed, 0xbc, 0x3b, 0xff, 0x10, 0xed, 0xbc, 0x3a, 0xff, 0xef, 0xc1, 
+  0x4b, 0xff, 0xf1, 0xc9, 0x6a, 0xff, 0xef, 0xbe, 0x5f, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb0, 0x44, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb1, 0x47, 0xff, 0xeb, 0xb1, 0x46, 0xff, 0xeb, 0xb1, 
+  0x45, 0xff, 0xeb, 0xb0, 0x43, 0xff, 0xec, 0xb5, 0x4d, 0xff, 0xf0, 0xc4, 0x69, 0xff, 0xf1, 0xc8, 0x61, 0xff, 0xed, 0xbe, 0x41, 0xff, 0xed, 0xbc, 0x3a, 0xff, 0xed, 0xbc, 0x3b, 0xff, 0x82, 0xed, 
+  0xbc, 0x3a, 0xff, 0x00, 0xee, 0xbf, 0x42, 0xc7, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xe5, 0xfe, 0x98, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x42, 0xda, 0xee, 0xff, 0xe1, 0xc2, 
+  0x51, 0xff, 0x94, 0xed, 0xbd, 0x39, 0xff, 0x04, 0xed, 0xbc, 0x37, 0xff, 0xef, 0xc3, 0x51, 0xff, 0xef, 0xc2, 0x61, 0xff, 0xeb, 0xb4, 0x4a, 0xff, 0xeb, 0xb2, 0x45, 0xff, 0x87, 0xeb, 0xb2, 0x46, 
+  0xff, 0x04, 0xeb, 0xb2, 0x45, 0xff, 0xed, 0xb7, 0x50, 0xff, 0xf1, 0xc8, 0x66, 0xff, 0xee, 0xbf, 0x41, 0xff, 0xed, 0xbd, 0x38, 0xff, 0x81, 0xed, 0xbe, 0x3b, 0xff, 0x01, 0xed, 0xbd, 0x38, 0xff, 
+  0xec, 0xbd, 0x36, 0xb4, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xea, 0xfe, 0x43, 0x01, 0xdc, 0xfe, 0xfc, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x65, 0xd8, 0xe9, 0xff, 0xea, 0xbf, 
+  0x35, 0xff, 0x93, 0xed, 0xbd, 0x39, 0xff, 0x03, 0xed, 0xbd, 0x38, 0xff, 0xef, 0xc3, 0x4a, 0xff, 0xef, 0xc4, 0x64, 0xff, 0xeb, 0xb3, 0x44, 0xff, 0x8b, 0xeb, 0xb3, 0x45, 0xff, 0x08, 0xeb, 0xb4, 
+  0x48, 0xff, 0xf1, 0xca, 0x6c, 0xff, 0xf1, 0xcc, 0x70, 0xff, 0xf2, 0xcc, 0x76, 0xff, 0xf3, 0xcd, 0x76, 0xff, 0xf2, 0xcc, 0x71, 0xff, 0xf3, 0xce, 0x70, 0xd8, 0xf5, 0xd5, 0x83, 0x54, 0xf5, 0xdc, 
+  0x8f, 0x0c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xf2, 0xff, 0x23, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x70, 0xd6, 0xe7, 0xff, 
+  0xee, 0xbf, 0x26, 0xff, 0x93, 0xed, 0xbf, 0x37, 0xff, 0x02, 0xed, 0xc1, 0x3d, 0xff, 0xf0, 0xc4, 0x5c, 0xff, 0xec, 0xb3, 0x44, 0xff, 0x8d, 0xec, 0xb4, 0x44, 0xff, 0x81, 0xec, 0xb5, 0x46, 0xff, 
+  0x81, 0xec, 0xb3, 0x42, 0xff, 0x04, 0xec, 0xb4, 0x45, 0xff, 0xed, 0xb7, 0x4a, 0xff, 0xef, 0xbd, 0x57, 0xfc, 0xf2, 0xcc, 0x72, 0xd4, 0xf6, 0xd6, 0x87, 0x37, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x04, 
+  0x00, 0xd8, 0xff, 0x2c, 0x01, 0xd7, 0xff, 0x50, 0x01, 0xd9, 0xfe, 0xe3, 0x59, 0xd6, 0xe9, 0xff, 0xe6, 0xc0, 0x33, 0xff, 0x92, 0xed, 0xbf, 0x37, 0xff, 0x02, 0xed, 0xbf, 0x36, 0xff, 0xef, 0xc4, 
+  0x4d, 0xff, 0xed, 0xb8, 0x49, 0xff, 0x94, 0xec, 0xb5, 0x43, 0xff, 0x81, 0xec, 0xb5, 0x42, 0xff, 0x01, 0xf1, 0xc8, 0x68, 0xf3, 0xf4, 0xd7, 0x80, 0x47, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 
+  0xea, 0xfe, 0x1b, 0x01, 0xdb, 0xfe, 0xf3, 0x2f, 0xd8, 0xef, 0xff, 0xde, 0xc3, 0x50, 0xff, 0x90, 0xed, 0xc0, 0x35, 0xff, 0x04, 0xed, 0xc0, 0x33, 0xff, 0xed, 0xbf, 0x31, 0xff, 0xec, 0xbe, 0x2a, 
+  0xff, 0xf0, 0xc4, 0x57, 0xff, 0xec, 0xb5, 0x41, 0xff, 0x97, 0xec, 0xb6, 0x41, 0xff, 0x01, 0xf0, 0xc3, 0x5d, 0xe4, 0xf8, 0xd7, 0x7f, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe5, 0xfe, 
+  0x8b, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd9, 0xfb, 0xff, 0xbb, 0xc9, 0x83, 0xff, 0xf1, 0xc1, 0x31, 0xff, 0x8d, 0xee, 0xc1, 0x35, 0xff, 0x05, 0xee, 0xc1, 0x33, 0xff, 0xef, 0xc4, 0x3f, 0xff, 0xf1, 
+  0xca, 0x53, 0xff, 0xf2, 0xce, 0x61, 0xff, 0xf3, 0xd1, 0x6c, 0xff, 0xed, 0xbb, 0x48, 0xff, 0x98, 0xec, 0xb7, 0x41, 0xff, 0x01, 0xec, 0xb8, 0x43, 0xff, 0xf2, 0xcd, 0x6d, 0xa3, 0x8a, 0x00, 0x00, 
+  0x00, 0x00, 0x06, 0x00, 0xfa, 0xff, 0x10, 0x00, 0xdd, 0xfe, 0xe4, 0x00, 0xd8, 0xfd, 0xbc, 0x00, 0xd9, 0xff, 0xb3, 0x33, 0xd5, 0xce, 0xd3, 0xe1, 0xc3, 0x27, 0xff, 0xef, 0xc2, 0x34, 0xff, 0x8b, 
+  0xee, 0xc2, 0x34, 0xff, 0x05, 0xee, 0xc2, 0x32, 0xff, 0xf1, 0xcc, 0x55, 0xff, 0xf2, 0xcb, 0x62, 0xff, 0xee, 0xbf, 0x4e, 0xff, 0xed, 0xbb, 0x46, 0xff, 0xec, 0xba, 0x43, 0xff, 0x9a, 0xec, 0xb8, 
+  0x3f, 0xff, 0x01, 0xee, 0xc0, 0x4e, 0xff, 0xf8, 0xe3, 0x8e, 0x24, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xdc, 0xff, 0xc0, 0x79, 0xd0, 0xb1, 0xff, 0xec, 0xc2, 0x2e, 0xff, 0xef, 0xc2, 0x33, 
+  0xff, 0x89, 0xee, 0xc2, 0x33, 0xff, 0x04, 0xee, 0xc2, 0x32, 0xff, 0xf0, 0xc9, 0x4b, 0xff, 0xef, 0xc5, 0x56, 0xff, 0xeb, 0xb8, 0x3a, 0xff, 0xec, 0xb9, 0x3d, 0xff, 0x9c, 0xec, 0xb9, 0x3e, 0xff, 
+  0x01, 0xec, 0xb9, 0x3b, 0xff, 0xf2, 0xcf, 0x6c, 0x74, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xef, 0xff, 0x10, 0x01, 0xda, 0xfe, 0xe3, 0x00, 0xd9, 0xfe, 0xff, 0x79, 0xd0, 0xaf, 0xff, 0xe1, 
+  0xc4, 0x24, 0xff, 0xf1, 0xc3, 0x2e, 0xff, 0x88, 0xee, 0xc3, 0x32, 0xff, 0x01, 0xef, 0xc7, 0x3b, 0xff, 0xf1, 0xc8, 0x55, 0xff, 0x9f, 0xed, 0xbb, 0x3c, 0xff, 0x01, 0xed, 0xba, 0x3b, 0xff, 0xef, 
+  0xc6, 0x52, 0xa8, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xe2, 0xfe, 0x2c, 0x00, 0xda, 0xfe, 0xec, 0x01, 0xd8, 0xfe, 0xdb, 0x00, 0xda, 0xff, 0x9f, 0x30, 0xd5, 0xce, 0xe0, 0xbb, 0xc9, 0x7f, 
+  0xff, 0xdf, 0xc5, 0x49, 0xff, 0xe7, 0xc4, 0x2b, 0xff, 0xf0, 0xc3, 0x19, 0xff, 0x84, 0xf0, 0xc3, 0x18, 0xff, 0x02, 0xf0, 0xc2, 0x15, 0xff, 0xf2, 0xcb, 0x4e, 0xff, 0xed, 0xbb, 0x3a, 0xff, 0x9f, 
+  0xed, 0xbb, 0x3b, 0xff, 0x01, 0xed, 0xbb, 0x3a, 0xff, 0xee, 0xbf, 0x42, 0xc0, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xdd, 0xfe, 0x0b, 0x00, 0xda, 0xfd, 0x20, 0x00, 0xd8, 0xff, 0x08, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xdd, 0xff, 0xd0, 0x00, 0xd9, 0xfa, 0xff, 0x2e, 0xd7, 0xee, 0xff, 0x5a, 0xd7, 0xe9, 0xff, 0x72, 0xd6, 0xe7, 0xff, 0x74, 0xd7, 0xe7, 0xff, 0x82, 0x74, 0xd7, 0xe6, 0xff, 
+  0x03, 0x74, 0xd8, 0xe6, 0xff, 0x6f, 0xd8, 0xe8, 0xff, 0xd7, 0xc9, 0x81, 0xff, 0xed, 0xbc, 0x38, 0xff, 0xa0, 0xed, 0xbd, 0x39, 0xff, 0x00, 0xee, 0xbe, 0x3e, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0x00, 0xdc, 0xfe, 0xe7, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xe3, 0x01, 0xd9, 0xfe, 0xdc, 0x82, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 
+  0x01, 0x00, 0xdd, 0xff, 0xff, 0xd7, 0xc5, 0x84, 0xff, 0xa0, 0xed, 0xbe, 0x38, 0xff, 0x01, 0xed, 0xbe, 0x37, 0xff, 0xf0, 0xc5, 0x49, 0x74, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xdb, 0xfe, 
+  0xf4, 0x00, 0xd8, 0xfe, 0x5b, 0x03, 0xd8, 0xfc, 0x10, 0x02, 0xde, 0xfd, 0x6c, 0x82, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0x01, 0xda, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x01, 0x00, 0xdb, 0xff, 
+  0xff, 0xd2, 0xc5, 0x85, 0xff, 0xa0, 0xed, 0xbf, 0x37, 0xff, 0x01, 0xed, 0xbf, 0x36, 0xff, 0xf4, 0xd3, 0x63, 0x24, 0x93, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe3, 0xff, 0x44, 0x00, 0xd8, 0xfe, 
+  0xff, 0x01, 0xd9, 0xfe, 0xf4, 0x01, 0xd9, 0xfe, 0x77, 0x01, 0xd9, 0xfe, 0xd3, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0x00, 0xda, 0xff, 0xf4, 0xa4, 0xcb, 0x95, 0xfb, 0xf0, 0xc0, 0x30, 0xff, 0x9f, 
+  0xed, 0xc0, 0x36, 0xff, 0x00, 0xef, 0xc4, 0x3b, 0xa4, 0x94, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf0, 0xff, 0x18, 0x00, 0xd8, 0xfe, 0xf3, 0x00, 0xd7, 0xfe, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xdb, 0xfd, 0x80, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0x24, 0x35, 0xd6, 0xcc, 0xcc, 0xec, 0xc0, 0x05, 0xff, 0x9e, 0xee, 0xc1, 0x34, 0xff, 0x01, 0xee, 0xc1, 0x35, 
+  0xec, 0xef, 0xc6, 0x41, 0x20, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xed, 0xff, 0x13, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xda, 0xff, 
+  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xff, 0x30, 0x91, 0xcd, 0x99, 0xff, 0xed, 0xc2, 0x31, 0xff, 0x9c, 0xee, 0xc2, 0x34, 0xff, 0x01, 0xee, 0xc2, 0x34, 0xf4, 0xed, 0xc3, 0x39, 0x50, 0x9a, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xfe, 0x38, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd9, 0xef, 0x6f, 0xde, 0xc6, 0x60, 0xb3, 0x9b, 0xee, 0xc3, 0x32, 0xff, 0x01, 0xee, 0xc3, 0x32, 
+  0xd4, 0xf0, 0xc7, 0x38, 0x33, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xed, 0xc3, 0x34, 0x5c, 0xee, 0xc3, 0x32, 0xd3, 0xee, 0xc3, 0x32, 0xf4, 0x94, 0xee, 0xc3, 0x32, 0xff, 0x04, 0xee, 0xc3, 0x32, 
+  0xfc, 0xee, 0xc3, 0x32, 0xf3, 0xee, 0xc3, 0x32, 0xd3, 0xef, 0xc4, 0x33, 0x70, 0xf9, 0xce, 0x5e, 0x07, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x02, 0xee, 0xc5, 0x34, 0x10, 0xef, 0xc5, 0x32, 0x23, 0xee, 
+  0xc4, 0x31, 0x2c, 0x93, 0xee, 0xc4, 0x31, 0x2f, 0x02, 0xee, 0xc4, 0x31, 0x2c, 0xee, 0xc4, 0x30, 0x20, 0xed, 0xc5, 0x36, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +372,7 @@ const lv_img_dsc_t owm_03d_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_03d_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_03d_64px_map,
 };
-
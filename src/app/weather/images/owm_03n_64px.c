@@ -10,271 +10,309 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_03N_64PX uint8_t owm_03n_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x24, 0xdb, 0x5f, 0xdb, 0x8c, 0xdb, 0xb0, 0xdb, 0xc7, 0xdb, 0xc7, 0xdb, 0xb0, 0xdb, 0x8c, 0xdb, 0x5f, 0xdb, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x03, 0xdb, 0x1b, 0xdb, 0x7f, 0xdb, 0xd0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd0, 0xdb, 0x7f, 0xdb, 0x1b, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2f, 0xdb, 0xab, 0xdb, 0xf0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf0, 0xdb, 0xab, 0xdb, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x08, 0xdb, 0x7b, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x7b, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1b, 0xdb, 0xcb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xcb, 0xdb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2b, 0xdb, 0xd4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd4, 0xdb, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x23, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xdb, 0xb7, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0xdb, 0xc8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xc8, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0xdb, 0xa0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xa0, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x38, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x57, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x54, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9b, 0xff, 0x17, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x17, 0xff, 0x9b, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x07, 0xdb, 0xcb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xcb, 0xb7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1b, 0xdb, 0xec, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xef, 0x77, 0x43, 0x3b, 0x23, 0x3b, 0x13, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x53, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xf4, 0x37, 0xe7, 0x37, 0xa8, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x90, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0x8f, 0x37, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc4, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xeb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc4, 0x3b, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x5b, 0xff, 0x17, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x3b, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xa8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xe7, 0x3b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xb4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf4, 0x37, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33, 0xdb, 0xfb, 0xdb, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x14, 0xdb, 0xe7, 0xdb, 0xff, 0x97, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x37, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x9f, 0xdb, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xeb, 0x37, 0x97, 0x3b, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33, 0xdb, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xe0, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x9f, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xec, 0x37, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x18, 0x9b, 0xe8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xdc, 0x5b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x68, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xa7, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xe0, 0x3b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0x77, 0xc4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf4, 0x37, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x77, 0xbb, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x04, 0xbb, 0x74, 0x97, 0xfc, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x3b, 0xdb, 0xcf, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf8, 0x13, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0b, 0xdb, 0x47, 0xdb, 0xbf, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xeb, 0x37, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x38, 0xdb, 0x8b, 0xdb, 0xdc, 0xdb, 0xe8, 0xdb, 0xf4, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xb3, 0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x08, 0xdb, 0x17, 0xdb, 0x23, 0xdb, 0x23, 0x13, 0xd0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x53, 0x13, 0xfc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x07, 0x13, 0xa8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x88, 0x37, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x97, 0x13, 0xf3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0xdc, 0x13, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x3f, 0x13, 0xa4, 0x13, 0xe4, 0x13, 0xfc, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xe8, 0x13, 0xb7, 0x17, 0x64, 0x37, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x03, 0xdb, 0x24, 0xdb, 0x5f, 0xdb, 0x8c, 0xdb, 0xb0, 0x81, 
+  0xdb, 0xc7, 0x03, 0xdb, 0xb0, 0xdb, 0x8c, 0xdb, 0x5f, 0xdb, 0x24, 0xb1, 0x00, 0x00, 0x03, 0xdb, 0x03, 0xdb, 0x1b, 0xdb, 0x7f, 0xdb, 0xd0, 0x89, 0xdb, 0xff, 0x03, 0xdb, 0xd0, 0xdb, 0x7f, 0xdb, 
+  0x1b, 0xb7, 0x03, 0xac, 0x00, 0x00, 0x02, 0xdb, 0x2f, 0xdb, 0xab, 0xdb, 0xf0, 0x8d, 0xdb, 0xff, 0x02, 0xdb, 0xf0, 0xdb, 0xab, 0xdb, 0x2f, 0xa9, 0x00, 0x00, 0x01, 0xdb, 0x08, 0xdb, 0x7b, 0x93, 
+  0xdb, 0xff, 0x01, 0xdb, 0x7b, 0xdb, 0x08, 0xa6, 0x00, 0x00, 0x01, 0xdb, 0x1b, 0xdb, 0xcb, 0x95, 0xdb, 0xff, 0x01, 0xdb, 0xcb, 0xdb, 0x1b, 0xa4, 0x00, 0x00, 0x01, 0xdb, 0x2b, 0xdb, 0xd4, 0x97, 
+  0xdb, 0xff, 0x01, 0xdb, 0xd4, 0xdb, 0x2b, 0xa2, 0x00, 0x00, 0x01, 0xdb, 0x23, 0xdb, 0xdb, 0x99, 0xdb, 0xff, 0x01, 0xdb, 0xdb, 0xb7, 0x23, 0xa0, 0x00, 0x00, 0x01, 0xdb, 0x04, 0xdb, 0xc8, 0x9b, 
+  0xdb, 0xff, 0x01, 0xdb, 0xc8, 0xb7, 0x04, 0x9e, 0x00, 0x00, 0x01, 0xdb, 0x04, 0xdb, 0xa0, 0x9d, 0xdb, 0xff, 0x01, 0xdb, 0xa0, 0xdb, 0x04, 0x9d, 0x00, 0x00, 0x01, 0xdb, 0x38, 0xdb, 0xf8, 0x8a, 
+  0xdb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8d, 0xdb, 0xff, 0x01, 0xdb, 0xf8, 0xdb, 0x38, 0x9d, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0x8b, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x9b, 
+  0xff, 0x57, 0xff, 0x37, 0xff, 0x83, 0x13, 0xff, 0x03, 0x37, 0xff, 0x57, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0x84, 0xdb, 0xff, 0x00, 0xdb, 0xc4, 0x9c, 0x00, 0x00, 0x00, 0xdb, 0x54, 0x8c, 0xdb, 0xff, 
+  0x04, 0xff, 0xff, 0xdf, 0xff, 0x9b, 0xff, 0x17, 0xff, 0x13, 0xff, 0x87, 0x0f, 0xff, 0x02, 0x13, 0xff, 0x17, 0xff, 0x9b, 0xff, 0x84, 0xdb, 0xff, 0x00, 0xb7, 0x54, 0x9a, 0x00, 0x00, 0x01, 0xdb, 
+  0x07, 0xdb, 0xcb, 0x8d, 0xdb, 0xff, 0x00, 0x57, 0xff, 0x8d, 0x13, 0xff, 0x01, 0x57, 0xff, 0xbb, 0xff, 0x82, 0xdb, 0xff, 0x01, 0xdb, 0xcb, 0xb7, 0x07, 0x99, 0x00, 0x00, 0x01, 0xdb, 0x1b, 0xdb, 
+  0xec, 0x84, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x86, 0xdb, 0xff, 0x00, 0x37, 0xff, 0x8f, 0x13, 0xff, 0x00, 0x37, 0xff, 0x82, 0xbb, 0xff, 0x03, 0xbb, 0xef, 0x77, 0x43, 0x3b, 0x23, 0x3b, 0x13, 0x97, 
+  0x00, 0x00, 0x00, 0xdb, 0x53, 0x85, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x84, 0xdb, 0xff, 0x00, 0x57, 0xff, 0x91, 0x13, 0xff, 0x01, 0x33, 0xff, 0x37, 0xff, 0x82, 0x13, 0xff, 0x03, 0x33, 0xf4, 0x37, 
+  0xe7, 0x37, 0xa8, 0x37, 0x37, 0x95, 0x00, 0x00, 0x00, 0xdb, 0x90, 0x85, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x00, 0x77, 0xff, 0x9a, 0x13, 0xff, 0x02, 0x37, 0xff, 0x37, 0x8f, 0x37, 
+  0x14, 0x93, 0x00, 0x00, 0x00, 0xdb, 0xc4, 0x84, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x9d, 0x13, 0xff, 0x01, 0x37, 0xc4, 0x3b, 0x20, 0x92, 0x00, 0x00, 0x00, 0xdb, 0xeb, 0x85, 0xdb, 
+  0xff, 0x84, 0xff, 0xff, 0x00, 0x77, 0xff, 0x9e, 0x13, 0xff, 0x01, 0x37, 0xc4, 0x3b, 0x14, 0x91, 0x00, 0x00, 0x86, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xa0, 0x13, 0xff, 0x00, 0x37, 
+  0x8f, 0x91, 0x00, 0x00, 0x87, 0xdb, 0xff, 0x01, 0x9b, 0xff, 0x5b, 0xff, 0x81, 0x17, 0xff, 0xa0, 0x13, 0xff, 0x01, 0x33, 0xff, 0x3b, 0x37, 0x90, 0x00, 0x00, 0x84, 0xdb, 0xff, 0x02, 0xfb, 0xff, 
+  0x9b, 0xff, 0x57, 0xff, 0xa5, 0x13, 0xff, 0x00, 0x37, 0xa8, 0x90, 0x00, 0x00, 0x00, 0xdb, 0xe0, 0x83, 0xdb, 0xff, 0x00, 0x9b, 0xff, 0xa7, 0x13, 0xff, 0x01, 0x13, 0xe7, 0x3b, 0x13, 0x8f, 0x00, 
+  0x00, 0x00, 0xdb, 0xb4, 0x82, 0xdb, 0xff, 0x01, 0xbb, 0xff, 0x33, 0xff, 0x98, 0x13, 0xff, 0x00, 0x33, 0xff, 0x84, 0x37, 0xff, 0x88, 0x13, 0xff, 0x01, 0x13, 0xf4, 0x37, 0x23, 0x8f, 0x00, 0x00, 
+  0x00, 0xdb, 0x7f, 0x82, 0xdb, 0xff, 0x00, 0x57, 0xff, 0x97, 0x13, 0xff, 0x02, 0x33, 0xff, 0x37, 0xff, 0x33, 0xff, 0x81, 0x13, 0xff, 0x00, 0x0f, 0xff, 0x81, 0x13, 0xff, 0x02, 0x33, 0xff, 0x37, 
+  0xff, 0x33, 0xff, 0x86, 0x13, 0xff, 0x00, 0x33, 0x2f, 0x8f, 0x00, 0x00, 0x03, 0xdb, 0x33, 0xdb, 0xfb, 0xdb, 0xff, 0xbb, 0xff, 0x97, 0x13, 0xff, 0x00, 0x37, 0xff, 0x81, 0x13, 0xff, 0x81, 0x0f, 
+  0xff, 0x82, 0x13, 0xff, 0x81, 0x0f, 0xff, 0x81, 0x13, 0xff, 0x00, 0x37, 0xff, 0x85, 0x13, 0xff, 0x00, 0x13, 0x33, 0x8f, 0x00, 0x00, 0x03, 0xdb, 0x14, 0xdb, 0xe7, 0xdb, 0xff, 0x97, 0xff, 0x96, 
+  0x13, 0xff, 0x00, 0x37, 0xff, 0x8c, 0x13, 0xff, 0x01, 0x37, 0xff, 0x13, 0xff, 0x83, 0x33, 0xff, 0x00, 0x37, 0x3b, 0x90, 0x00, 0x00, 0x02, 0xdb, 0x9f, 0xdb, 0xff, 0x77, 0xff, 0x95, 0x13, 0xff, 
+  0x00, 0x37, 0xff, 0x8e, 0x13, 0xff, 0x81, 0x33, 0xff, 0x81, 0x13, 0xff, 0x03, 0x33, 0xff, 0x37, 0xeb, 0x37, 0x97, 0x3b, 0x14, 0x8e, 0x00, 0x00, 0x02, 0xdb, 0x33, 0xdb, 0xff, 0x77, 0xff, 0x94, 
+  0x13, 0xff, 0x00, 0x37, 0xff, 0x96, 0x13, 0xff, 0x01, 0x37, 0xe0, 0x37, 0x40, 0x8e, 0x00, 0x00, 0x01, 0xdb, 0x9f, 0x77, 0xff, 0x94, 0x13, 0xff, 0x00, 0x33, 0xff, 0x97, 0x13, 0xff, 0x01, 0x33, 
+  0xec, 0x37, 0x3c, 0x8d, 0x00, 0x00, 0x01, 0xdb, 0x18, 0x9b, 0xe8, 0x92, 0x13, 0xff, 0x01, 0x33, 0xff, 0x37, 0xff, 0x99, 0x13, 0xff, 0x01, 0x37, 0xdc, 0x5b, 0x0b, 0x8d, 0x00, 0x00, 0x01, 0xdb, 
+  0x68, 0x57, 0xff, 0x8f, 0x13, 0xff, 0x82, 0x37, 0xff, 0x00, 0x33, 0xff, 0x9a, 0x13, 0xff, 0x00, 0x37, 0x88, 0x8e, 0x00, 0x00, 0x01, 0x97, 0xa7, 0x33, 0xff, 0x8c, 0x13, 0xff, 0x81, 0x37, 0xff, 
+  0x9e, 0x13, 0xff, 0x01, 0x33, 0xe0, 0x3b, 0x0f, 0x8d, 0x00, 0x00, 0x01, 0xdb, 0x0c, 0x77, 0xc4, 0x8b, 0x13, 0xff, 0x01, 0x17, 0xff, 0x37, 0xff, 0x9f, 0x13, 0xff, 0x01, 0x13, 0xf4, 0x37, 0x23, 
+  0x8e, 0x00, 0x00, 0x02, 0xff, 0x03, 0x77, 0xbb, 0x37, 0xff, 0x89, 0x13, 0xff, 0x00, 0x37, 0xff, 0xa1, 0x13, 0xff, 0x00, 0x33, 0x2f, 0x8f, 0x00, 0x00, 0x03, 0xdb, 0x04, 0xbb, 0x74, 0x97, 0xfc, 
+  0x57, 0xff, 0x87, 0x13, 0xff, 0x00, 0x37, 0xff, 0xa1, 0x13, 0xff, 0x00, 0x13, 0x30, 0x91, 0x00, 0x00, 0x02, 0xdb, 0x3b, 0xdb, 0xcf, 0xdb, 0xf8, 0x86, 0xdb, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 
+  0xf8, 0x13, 0x27, 0x92, 0x00, 0x00, 0x02, 0xdb, 0x0b, 0xdb, 0x47, 0xdb, 0xbf, 0x85, 0xdb, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xeb, 0x37, 0x17, 0x95, 0x00, 0x00, 0x05, 0xdb, 0x38, 0xdb, 0x8b, 
+  0xdb, 0xdc, 0xdb, 0xe8, 0xdb, 0xf4, 0xdb, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xb3, 0x3f, 0x03, 0x97, 0x00, 0x00, 0x01, 0xdb, 0x08, 0xdb, 0x17, 0x81, 0xdb, 0x23, 0x00, 0x13, 0xd0, 0xa0, 0x13, 
+  0xff, 0x00, 0x37, 0x30, 0x9c, 0x00, 0x00, 0x01, 0x37, 0x53, 0x13, 0xfc, 0x9e, 0x13, 0xff, 0x00, 0x17, 0x77, 0x9d, 0x00, 0x00, 0x01, 0x37, 0x07, 0x13, 0xa8, 0x9d, 0x13, 0xff, 0x01, 0x13, 0x88, 
+  0x37, 0x07, 0x9f, 0x00, 0x00, 0x01, 0x13, 0x97, 0x13, 0xf3, 0x98, 0x13, 0xff, 0x02, 0x13, 0xfc, 0x13, 0xdc, 0x13, 0x5b, 0xa2, 0x00, 0x00, 0x03, 0x37, 0x3f, 0x13, 0xa4, 0x13, 0xe4, 0x13, 0xfc, 
+  0x93, 0x13, 0xfb, 0x03, 0x13, 0xe8, 0x13, 0xb7, 0x17, 0x64, 0x37, 0x13, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x88, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x24, 0xd7, 0xbd, 0x5f, 0xf7, 0xbd, 0x8c, 0xf7, 0xbd, 0xb0, 0xd7, 0xbd, 0xc7, 0xd7, 0xbd, 0xc7, 0xd7, 0xbd, 0xb0, 0xd7, 0xbd, 0x8c, 0xd7, 0xbd, 0x5f, 0xd7, 0xbd, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x03, 0xf8, 0xc5, 0x1b, 0xf8, 0xc5, 0x7f, 0xf8, 0xc5, 0xd0, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xd0, 0xb7, 0xbd, 0x7f, 0xb7, 0xbd, 0x1b, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x2f, 0xf8, 0xc5, 0xab, 0xf8, 0xc5, 0xf0, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xf0, 0xb7, 0xbd, 0xab, 0xb7, 0xbd, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x08, 0x18, 0xc6, 0x7b, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x7b, 0x96, 0xb5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x1b, 0x18, 0xc6, 0xcb, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xcb, 0xb7, 0xbd, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x2b, 0x18, 0xc6, 0xd4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xd4, 0xb6, 0xb5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x23, 0x18, 0xc6, 0xdb, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xdb, 0x96, 0xb5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x04, 0x18, 0xc6, 0xc8, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xc8, 0x55, 0xad, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x04, 0x18, 0xc6, 0xa0, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xa0, 0xb6, 0xb5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x38, 0x18, 0xc6, 0xf8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x5a, 0xbe, 0xff, 0x39, 0xbe, 0xff, 0x39, 0xbe, 0xff, 0x19, 0xb6, 0xff, 0x19, 0xbe, 0xff, 0x18, 0xbe, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf8, 0x96, 0xb5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xc4, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xde, 0xff, 0x7a, 0xbe, 0xff, 0x1a, 0x86, 0xff, 0x39, 0x4d, 0xff, 0xb8, 0x2c, 0xff, 0x57, 0x04, 0xff, 0x16, 0x04, 0xff, 0x16, 0x04, 0xff, 0x57, 0x04, 0xff, 0xb8, 0x2c, 0xff, 0x19, 0x45, 0xff, 0xd9, 0x7d, 0xff, 0xf8, 0xad, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x54, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0xba, 0xde, 0xff, 0xbb, 0xce, 0xff, 0xfa, 0x85, 0xff, 0xd8, 0x04, 0xff, 0xd6, 0x03, 0xff, 0x75, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xd6, 0x03, 0xff, 0xd8, 0x04, 0xff, 0x99, 0x75, 0xff, 0xf8, 0xb5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x07, 0x18, 0xc6, 0xcb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xb6, 0xff, 0x39, 0x4d, 0xff, 0xf6, 0x03, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xf6, 0x03, 0xff, 0x18, 0x45, 0xff, 0xd8, 0xa5, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xcb, 0x96, 0xb5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x1b, 0x18, 0xc6, 0xec, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x39, 0xb6, 0xff, 0xd8, 0x2c, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd8, 0x2c, 0xff, 0xd8, 0xa5, 0xff, 0xb7, 0xad, 0xff, 0xb7, 0xad, 0xff, 0x97, 0xa5, 0xef, 0x99, 0x6d, 0x43, 0x9b, 0x25, 0x23, 0x9a, 0x25, 0x13, 0x7d, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x53, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x5a, 0xbe, 0xff, 0xf8, 0x34, 0xff, 0xb5, 0x03, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x97, 0x24, 0xff, 0xb8, 0x2c, 0xff, 0x57, 0x04, 0xff, 0x36, 0x04, 0xff, 0x37, 0x14, 0xff, 0x77, 0x14, 0xf4, 0xd8, 0x1c, 0xe7, 0x5a, 0x25, 0xa8, 0x9a, 0x25, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x90, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xce, 0xff, 0x99, 0x6d, 0xff, 0xb5, 0x03, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xb8, 0x1c, 0xff, 0x5a, 0x25, 0x8f, 0x7a, 0x25, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xc4, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x9b, 0xbe, 0xff, 0x36, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x19, 0x1d, 0xc4, 0xbb, 0x2d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xeb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x99, 0x5d, 0xff, 0xb5, 0x03, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf9, 0x1c, 0xc4, 0x9a, 0x25, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xdb, 0xce, 0xff, 0x37, 0x04, 0xff, 0xd5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x39, 0x25, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xce, 0xff, 0x3a, 0x96, 0xff, 0xba, 0x4d, 0xff, 0x59, 0x05, 0xff, 0xf9, 0x04, 0xff, 0xd5, 0x13, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0x57, 0x14, 0xff, 0xbb, 0x2d, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xd6, 0xff, 0x3a, 0x96, 0xff, 0x39, 0x3d, 0xff, 0x36, 0x04, 0xff, 0xf6, 0x03, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd8, 0x1c, 0xa8, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xe0, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0xfa, 0x85, 0xff, 0x97, 0x04, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x56, 0x14, 0xe7, 0x9a, 0x2d, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0xb4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x19, 0xa6, 0xff, 0x77, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x19, 0x1d, 0xff, 0x19, 0x25, 0xff, 0xf9, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xf4, 0xf8, 0x1c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x7f, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x38, 0x3d, 0xff, 0x16, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x77, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x98, 0x1c, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x98, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x77, 0x14, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x33, 0x18, 0xc6, 0xfb, 0x18, 0xc6, 0xff, 0x19, 0x9e, 0xff, 0x36, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x37, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x17, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x14, 0xf8, 0xc5, 0xe7, 0x18, 0xc6, 0xff, 0x78, 0x75, 0xff, 0x16, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xb6, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x77, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x9f, 0x18, 0xc6, 0xff, 0xf7, 0x64, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xb8, 0x1c, 0xff, 0xd6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x57, 0x14, 0xff, 0x37, 0x14, 0xff, 0x16, 0x14, 0xff, 0x16, 0x14, 0xff, 0x57, 0x14, 0xff, 0xd8, 0x1c, 0xeb, 0x7a, 0x25, 0x97, 0xbb, 0x2d, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x33, 0xf7, 0xc5, 0xff, 0xd7, 0x64, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0xb8, 0x14, 0xff, 0xf6, 0x13, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0xf9, 0x1c, 0xe0, 0x7a, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc5, 0x9f, 0x37, 0x6d, 0xff, 0x56, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x57, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x77, 0x1c, 0xec, 0x7a, 0x25, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xc5, 0x18, 0xb8, 0x8d, 0xe8, 0x56, 0x04, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x77, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd8, 0x1c, 0xdc, 0xfc, 0x35, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x68, 0xd7, 0x3c, 0xff, 0x56, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x19, 0x1d, 0xff, 0xf9, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x39, 0x25, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x7d, 0xa7, 0x76, 0x1c, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x97, 0x14, 0xff, 0x19, 0x1d, 0xff, 0x57, 0x14, 0xff, 0xd6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x57, 0x14, 0xe0, 0xdb, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x0c, 0x17, 0x5d, 0xc4, 0x76, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x97, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xf4, 0xf8, 0x1c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x17, 0x65, 0xbb, 0xb7, 0x2c, 0xff, 0x76, 0x04, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x0c, 0xff, 0xd8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x77, 0x14, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xc6, 0x04, 0x97, 0xa5, 0x74, 0x57, 0x7d, 0xfc, 0xd7, 0x34, 0xff, 0x97, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x56, 0x04, 0xff, 0xb7, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xc5, 0x3b, 0xd7, 0xc5, 0xcf, 0xd7, 0xc5, 0xf8, 0xd7, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0x17, 0xce, 0xff, 0x56, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x14, 0xf8, 0x57, 0x14, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x0b, 0xb7, 0xbd, 0x47, 0xb7, 0xbd, 0xbf, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xc5, 0xff, 0x16, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xeb, 0xf8, 0x1c, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x38, 0xb7, 0xbd, 0x8b, 0xb7, 0xbd, 0xdc, 0xb7, 0xbd, 0xe8, 0xb7, 0xbd, 0xf4, 0xd7, 0xbd, 0xff, 0x56, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xb3, 0x9c, 0x36, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x08, 0xb6, 0xb5, 0x17, 0xb7, 0xbd, 0x23, 0xf6, 0xd5, 0x23, 0x97, 0x0c, 0xd0, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0xf8, 0x1c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x53, 0x76, 0x14, 0xfc, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x97, 0x14, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x07, 0x77, 0x14, 0xa8, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0x88, 0x58, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x97, 0x76, 0x14, 0xf3, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xfc, 0x76, 0x14, 0xdc, 0x97, 0x14, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x1c, 0x00, 0xb7, 0x14, 0x3f, 0x97, 0x14, 0xa4, 0x97, 0x14, 0xe4, 0x97, 0x14, 0xfc, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xe8, 0x77, 0x14, 0xb7, 0x97, 0x14, 0x64, 0xb8, 0x1c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x03, 0xd7, 0xbd, 0x24, 
+  0xd7, 0xbd, 0x5f, 0xf7, 0xbd, 0x8c, 0xf7, 0xbd, 0xb0, 0x81, 0xd7, 0xbd, 0xc7, 0x03, 0xd7, 0xbd, 0xb0, 0xd7, 0xbd, 0x8c, 0xd7, 0xbd, 0x5f, 0xd7, 0xbd, 0x24, 0xb1, 0x00, 0x00, 0x00, 0x04, 0xd7, 
+  0xbd, 0x03, 0xf8, 0xc5, 0x1b, 0xf8, 0xc5, 0x7f, 0xf8, 0xc5, 0xd0, 0xf7, 0xbd, 0xff, 0x82, 0xf8, 0xc5, 0xff, 0x83, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 0xd0, 0xb7, 0xbd, 
+  0x7f, 0xb7, 0xbd, 0x1b, 0x55, 0xad, 0x03, 0xac, 0x00, 0x00, 0x00, 0x02, 0xf8, 0xc5, 0x2f, 0xf8, 0xc5, 0xab, 0xf8, 0xc5, 0xf0, 0x87, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 
+  0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xd7, 0xbd, 0xf0, 0xb7, 0xbd, 0xab, 0xb7, 0xbd, 0x2f, 0xa9, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xbd, 0x08, 0x18, 0xc6, 0x7b, 0x85, 0x18, 0xc6, 0xff, 0x81, 0x38, 
+  0xc6, 0xff, 0x85, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x7b, 0x96, 0xb5, 0x08, 0xa6, 0x00, 0x00, 0x00, 
+  0x01, 0x18, 0xc6, 0x1b, 0x18, 0xc6, 0xcb, 0x81, 0x18, 0xc6, 0xff, 0x82, 0x38, 0xc6, 0xff, 0x82, 0x39, 0xce, 0xff, 0x01, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x38, 0xc6, 0xff, 0x82, 0x18, 
+  0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xcb, 0xb7, 0xbd, 0x1b, 0xa4, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x2b, 
+  0x18, 0xc6, 0xd4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x82, 0x39, 0xce, 0xff, 0x87, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 
+  0xff, 0x81, 0xf7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xd4, 0xb6, 0xb5, 0x2b, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x23, 0x18, 0xc6, 0xdb, 0x18, 0xc6, 0xff, 
+  0x38, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x83, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x86, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 
+  0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xdb, 0x96, 0xb5, 0x23, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xf8, 0xc5, 0x04, 0x18, 0xc6, 0xc8, 0x18, 0xc6, 0xff, 0x38, 0xc6, 
+  0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x83, 0x79, 0xce, 0xff, 0x82, 0x7a, 0xd6, 0xff, 0x82, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x38, 0xc6, 0xff, 
+  0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xc8, 0x55, 0xad, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x04, 0x18, 0xc6, 
+  0x04, 0x18, 0xc6, 0xa0, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x86, 0x9a, 0xd6, 0xff, 0x81, 0x7a, 0xd6, 
+  0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x81, 0xb7, 0xbd, 
+  0xff, 0x01, 0x96, 0xb5, 0xa0, 0xb6, 0xb5, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x38, 0x18, 0xc6, 0xf8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 
+  0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 0x59, 0xce, 0xff, 0x85, 0x9a, 0xd6, 0xff, 0x02, 0x7a, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x5a, 0xbe, 0xff, 0x81, 0x39, 0xbe, 0xff, 0x02, 
+  0x19, 0xb6, 0xff, 0x19, 0xbe, 0xff, 0x18, 0xbe, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf8, 0x96, 0xb5, 0x38, 0x9d, 
+  0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0xc4, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 
+  0xff, 0x81, 0xba, 0xd6, 0xff, 0x05, 0xba, 0xde, 0xff, 0x7a, 0xbe, 0xff, 0x1a, 0x86, 0xff, 0x39, 0x4d, 0xff, 0xb8, 0x2c, 0xff, 0x57, 0x04, 0xff, 0x81, 0x16, 0x04, 0xff, 0x07, 0x57, 0x04, 0xff, 
+  0xb8, 0x2c, 0xff, 0x19, 0x45, 0xff, 0xd9, 0x7d, 0xff, 0xf8, 0xad, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0x81, 0xb7, 0xbd, 0xff, 0x00, 0x96, 0xb5, 0xc4, 0x9c, 0x00, 0x00, 
+  0x00, 0x02, 0x18, 0xc6, 0x54, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x84, 0x59, 0xce, 0xff, 0x04, 
+  0xba, 0xde, 0xff, 0xbb, 0xce, 0xff, 0xfa, 0x85, 0xff, 0xd8, 0x04, 0xff, 0xd6, 0x03, 0xff, 0x81, 0x75, 0x0b, 0xff, 0x83, 0x95, 0x0b, 0xff, 0x81, 0x75, 0x0b, 0xff, 0x03, 0xd6, 0x03, 0xff, 0xd8, 
+  0x04, 0xff, 0x99, 0x75, 0xff, 0xf8, 0xb5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x54, 0x9a, 0x00, 0x00, 0x00, 0x04, 0x18, 0xc6, 0x07, 0x18, 0xc6, 
+  0xcb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x03, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x82, 0x79, 0xce, 0xff, 0x03, 
+  0x59, 0xce, 0xff, 0x7a, 0xb6, 0xff, 0x39, 0x4d, 0xff, 0xf6, 0x03, 0xff, 0x8b, 0x95, 0x0b, 0xff, 0x07, 0xf6, 0x03, 0xff, 0x18, 0x45, 0xff, 0xd8, 0xa5, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 
+  0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xcb, 0x96, 0xb5, 0x07, 0x99, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0x1b, 0x18, 0xc6, 0xec, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 
+  0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x02, 0x39, 0xb6, 0xff, 0xd8, 0x2c, 0xff, 0xb5, 0x0b, 0xff, 0x8d, 0x95, 0x0b, 
+  0xff, 0x02, 0xb5, 0x0b, 0xff, 0xd8, 0x2c, 0xff, 0xd8, 0xa5, 0xff, 0x81, 0xb7, 0xad, 0xff, 0x03, 0x97, 0xa5, 0xef, 0x99, 0x6d, 0x43, 0x9b, 0x25, 0x23, 0x9a, 0x25, 0x13, 0x97, 0x00, 0x00, 0x00, 
+  0x02, 0x18, 0xc6, 0x53, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x07, 0xba, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 
+  0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x5a, 0xbe, 0xff, 0xf8, 0x34, 0xff, 0xb5, 0x03, 0xff, 0x90, 0xb5, 0x0b, 0xff, 0x08, 0x97, 0x24, 0xff, 0xb8, 0x2c, 0xff, 0x57, 0x04, 0xff, 0x36, 0x04, 0xff, 
+  0x37, 0x14, 0xff, 0x77, 0x14, 0xf4, 0xd8, 0x1c, 0xe7, 0x5a, 0x25, 0xa8, 0x9a, 0x25, 0x37, 0x95, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x90, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 
+  0xff, 0x00, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x06, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xce, 0xff, 0x99, 0x6d, 0xff, 0xb5, 0x03, 0xff, 0x97, 
+  0xb5, 0x0b, 0xff, 0x04, 0x95, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xb8, 0x1c, 0xff, 0x5a, 0x25, 0x8f, 0x7a, 0x25, 0x14, 0x93, 0x00, 0x00, 0x00, 0x05, 0x18, 0xc6, 0xc4, 0x18, 0xc6, 0xff, 0x39, 0xce, 
+  0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x05, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x9b, 0xbe, 0xff, 0x36, 0x14, 
+  0xff, 0x9b, 0xb5, 0x0b, 0xff, 0x02, 0x16, 0x14, 0xff, 0x19, 0x1d, 0xc4, 0xbb, 0x2d, 0x20, 0x92, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0xeb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 
+  0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x02, 0xfb, 0xe6, 0xff, 0x99, 0x5d, 0xff, 0xb5, 0x03, 0xff, 0x9c, 0xd5, 0x0b, 0xff, 0x02, 
+  0xf6, 0x0b, 0xff, 0xf9, 0x1c, 0xc4, 0x9a, 0x25, 0x14, 0x91, 0x00, 0x00, 0x00, 0x0d, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 
+  0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xdb, 0xce, 0xff, 0x37, 0x04, 0xff, 0xd5, 0x0b, 0xff, 0x9d, 0xd6, 0x0b, 0xff, 0x01, 0x16, 0x14, 0xff, 
+  0x39, 0x25, 0x8f, 0x91, 0x00, 0x00, 0x00, 0x81, 0x18, 0xc6, 0xff, 0x01, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x06, 0x9a, 0xd6, 0xff, 0x9a, 0xce, 0xff, 0x3a, 0x96, 0xff, 
+  0xba, 0x4d, 0xff, 0x59, 0x05, 0xff, 0xf9, 0x04, 0xff, 0xd5, 0x13, 0xff, 0x9e, 0xd6, 0x0b, 0xff, 0x02, 0xd5, 0x0b, 0xff, 0x57, 0x14, 0xff, 0xbb, 0x2d, 0x37, 0x90, 0x00, 0x00, 0x00, 0x81, 0x18, 
+  0xc6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x04, 0x79, 0xd6, 0xff, 0x3a, 0x96, 0xff, 0x39, 0x3d, 0xff, 0x36, 0x04, 0xff, 0xf6, 0x03, 0xff, 0xa2, 0xf6, 0x0b, 0xff, 0x01, 0xd6, 
+  0x0b, 0xff, 0xd8, 0x1c, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0xe0, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0xfa, 0x85, 0xff, 0x97, 0x04, 0xff, 0xa6, 
+  0xf6, 0x0b, 0xff, 0x01, 0x56, 0x14, 0xe7, 0x9a, 0x2d, 0x13, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xf8, 0xc5, 0xb4, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x19, 0xa6, 0xff, 0x77, 0x1c, 
+  0xff, 0x98, 0x16, 0x0c, 0xff, 0x06, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x19, 0x1d, 0xff, 0x19, 0x25, 0xff, 0xf9, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x87, 0x16, 0x0c, 0xff, 0x01, 
+  0x36, 0x14, 0xf4, 0xf8, 0x1c, 0x23, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x7f, 0x81, 0x18, 0xc6, 0xff, 0x02, 0x39, 0xce, 0xff, 0x38, 0x3d, 0xff, 0x16, 0x04, 0xff, 0x95, 0x16, 0x0c, 0xff, 
+  0x0c, 0x36, 0x0c, 0xff, 0x77, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x98, 0x1c, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x98, 0x1c, 0xff, 0xd8, 
+  0x1c, 0xff, 0x77, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x84, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x77, 0x14, 0x2f, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xf8, 0xc5, 0x33, 0x18, 0xc6, 0xfb, 0x18, 0xc6, 
+  0xff, 0x19, 0x9e, 0xff, 0x36, 0x04, 0xff, 0x94, 0x36, 0x0c, 0xff, 0x04, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x37, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0x86, 0x95, 0x0b, 0xff, 0x04, 
+  0xb5, 0x0b, 0xff, 0x17, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x82, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0x33, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xf7, 
+  0xbd, 0x14, 0xf8, 0xc5, 0xe7, 0x18, 0xc6, 0xff, 0x78, 0x75, 0xff, 0x16, 0x04, 0xff, 0x94, 0x36, 0x0c, 0xff, 0x02, 0x56, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xb6, 0x0b, 0xff, 0x8a, 0x95, 0x0b, 0xff, 
+  0x01, 0xd6, 0x0b, 0xff, 0xb8, 0x1c, 0xff, 0x81, 0x77, 0x14, 0xff, 0x81, 0x97, 0x14, 0xff, 0x01, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0x3b, 0x90, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xbd, 0x9f, 0x18, 0xc6, 
+  0xff, 0xf7, 0x64, 0xff, 0x95, 0x36, 0x0c, 0xff, 0x01, 0xb8, 0x1c, 0xff, 0xd6, 0x0b, 0xff, 0x8c, 0xb5, 0x0b, 0xff, 0x02, 0xd6, 0x0b, 0xff, 0x57, 0x14, 0xff, 0x37, 0x14, 0xff, 0x81, 0x16, 0x14, 
+  0xff, 0x03, 0x57, 0x14, 0xff, 0xd8, 0x1c, 0xeb, 0x7a, 0x25, 0x97, 0xbb, 0x2d, 0x14, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xbd, 0x33, 0xf7, 0xc5, 0xff, 0xd7, 0x64, 0xff, 0x94, 0x56, 0x0c, 0xff, 
+  0x01, 0xb8, 0x14, 0xff, 0xf6, 0x13, 0xff, 0x93, 0xb5, 0x0b, 0xff, 0x03, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0xf9, 0x1c, 0xe0, 0x7a, 0x25, 0x40, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xc5, 0x9f, 
+  0x37, 0x6d, 0xff, 0x56, 0x04, 0xff, 0x92, 0x56, 0x0c, 0xff, 0x02, 0x76, 0x14, 0xff, 0x57, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0x94, 0xd5, 0x0b, 0xff, 0x03, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x77, 
+  0x1c, 0xec, 0x7a, 0x25, 0x3c, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xc5, 0x18, 0xb8, 0x8d, 0xe8, 0x56, 0x04, 0xff, 0x90, 0x56, 0x14, 0xff, 0x00, 0x77, 0x14, 0xff, 0x81, 0x97, 0x14, 0xff, 0x00, 
+  0xf6, 0x0b, 0xff, 0x98, 0xd5, 0x0b, 0xff, 0x01, 0xd8, 0x1c, 0xdc, 0xfc, 0x35, 0x0b, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xbd, 0x68, 0xd7, 0x3c, 0xff, 0x56, 0x0c, 0xff, 0x8e, 0x76, 0x14, 0xff, 
+  0x03, 0x19, 0x1d, 0xff, 0xf9, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x9a, 0xf6, 0x0b, 0xff, 0x00, 0x39, 0x25, 0x88, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x77, 0x7d, 0xa7, 0x76, 0x1c, 0xff, 
+  0x8c, 0x76, 0x14, 0xff, 0x03, 0x97, 0x14, 0xff, 0x19, 0x1d, 0xff, 0x57, 0x14, 0xff, 0xd6, 0x0b, 0xff, 0x9c, 0xf6, 0x0b, 0xff, 0x01, 0x57, 0x14, 0xe0, 0xdb, 0x2d, 0x0f, 0x8d, 0x00, 0x00, 0x00, 
+  0x02, 0xf7, 0xbd, 0x0c, 0x17, 0x5d, 0xc4, 0x76, 0x04, 0xff, 0x8a, 0x76, 0x14, 0xff, 0x03, 0x97, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0x9d, 0x16, 0x0c, 0xff, 0x01, 
+  0x36, 0x14, 0xf4, 0xf8, 0x1c, 0x23, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xfb, 0xff, 0x03, 0x17, 0x65, 0xbb, 0xb7, 0x2c, 0xff, 0x76, 0x04, 0xff, 0x81, 0x76, 0x0c, 0xff, 0x85, 0x76, 0x14, 0xff, 0x02, 
+  0x76, 0x0c, 0xff, 0xd8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x9f, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x77, 0x14, 0x2f, 0x8f, 0x00, 0x00, 0x00, 0x04, 0x37, 0xc6, 0x04, 0x97, 0xa5, 0x74, 0x57, 
+  0x7d, 0xfc, 0xd7, 0x34, 0xff, 0x97, 0x04, 0xff, 0x85, 0x77, 0x04, 0xff, 0x02, 0x56, 0x04, 0xff, 0xb7, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0xa0, 0x36, 0x0c, 0xff, 0x00, 0x36, 0x14, 0x30, 0x91, 0x00, 
+  0x00, 0x00, 0x03, 0xd7, 0xc5, 0x3b, 0xd7, 0xc5, 0xcf, 0xd7, 0xc5, 0xf8, 0xd7, 0xc5, 0xff, 0x84, 0xf7, 0xc5, 0xff, 0x01, 0x17, 0xce, 0xff, 0x56, 0x04, 0xff, 0xa0, 0x36, 0x0c, 0xff, 0x01, 0x36, 
+  0x14, 0xf8, 0x57, 0x14, 0x27, 0x92, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xbd, 0x0b, 0xb7, 0xbd, 0x47, 0xb7, 0xbd, 0xbf, 0x81, 0xb7, 0xbd, 0xff, 0x82, 0xd7, 0xbd, 0xff, 0x01, 0xd7, 0xc5, 0xff, 0x16, 
+  0x04, 0xff, 0xa0, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xeb, 0xf8, 0x1c, 0x17, 0x95, 0x00, 0x00, 0x00, 0x06, 0xb7, 0xbd, 0x38, 0xb7, 0xbd, 0x8b, 0xb7, 0xbd, 0xdc, 0xb7, 0xbd, 0xe8, 0xb7, 0xbd, 
+  0xf4, 0xd7, 0xbd, 0xff, 0x56, 0x04, 0xff, 0xa0, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xb3, 0x9c, 0x36, 0x03, 0x97, 0x00, 0x00, 0x00, 0x05, 0x96, 0xb5, 0x08, 0xb6, 0xb5, 0x17, 0xb7, 0xbd, 0x23, 
+  0xf6, 0xd5, 0x23, 0x97, 0x0c, 0xd0, 0x56, 0x0c, 0xff, 0x9f, 0x56, 0x14, 0xff, 0x00, 0xf8, 0x1c, 0x30, 0x9c, 0x00, 0x00, 0x00, 0x01, 0xb7, 0x14, 0x53, 0x76, 0x14, 0xfc, 0x9e, 0x76, 0x14, 0xff, 
+  0x00, 0x97, 0x14, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x59, 0x1d, 0x07, 0x77, 0x14, 0xa8, 0x9d, 0x76, 0x14, 0xff, 0x01, 0x77, 0x14, 0x88, 0x58, 0x25, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x01, 0x97, 
+  0x14, 0x97, 0x76, 0x14, 0xf3, 0x98, 0x76, 0x14, 0xff, 0x02, 0x76, 0x14, 0xfc, 0x76, 0x14, 0xdc, 0x97, 0x14, 0x5b, 0xa2, 0x00, 0x00, 0x00, 0x03, 0xb7, 0x14, 0x3f, 0x97, 0x14, 0xa4, 0x97, 0x14, 
+  0xe4, 0x97, 0x14, 0xfc, 0x93, 0x97, 0x14, 0xfb, 0x03, 0x97, 0x14, 0xe8, 0x77, 0x14, 0xb7, 0x97, 0x14, 0x64, 0xb8, 0x1c, 0x13, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x24, 0xbd, 0xd7, 0x5f, 0xbd, 0xf7, 0x8c, 0xbd, 0xf7, 0xb0, 0xbd, 0xd7, 0xc7, 0xbd, 0xd7, 0xc7, 0xbd, 0xd7, 0xb0, 0xbd, 0xd7, 0x8c, 0xbd, 0xd7, 0x5f, 0xbd, 0xd7, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x03, 0xc5, 0xf8, 0x1b, 0xc5, 0xf8, 0x7f, 0xc5, 0xf8, 0xd0, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xd0, 0xbd, 0xb7, 0x7f, 0xbd, 0xb7, 0x1b, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x2f, 0xc5, 0xf8, 0xab, 0xc5, 0xf8, 0xf0, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xf0, 0xbd, 0xb7, 0xab, 0xbd, 0xb7, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x08, 0xc6, 0x18, 0x7b, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x7b, 0xb5, 0x96, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x1b, 0xc6, 0x18, 0xcb, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xcb, 0xbd, 0xb7, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x2b, 0xc6, 0x18, 0xd4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xd4, 0xb5, 0xb6, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x23, 0xc6, 0x18, 0xdb, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xdb, 0xb5, 0x96, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x04, 0xc6, 0x18, 0xc8, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xc8, 0xad, 0x55, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x04, 0xc6, 0x18, 0xa0, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xa0, 0xb5, 0xb6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x38, 0xc6, 0x18, 0xf8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x7a, 0xff, 0xc6, 0x5a, 0xff, 0xbe, 0x5a, 0xff, 0xbe, 0x39, 0xff, 0xbe, 0x39, 0xff, 0xb6, 0x19, 0xff, 0xbe, 0x19, 0xff, 0xbe, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf8, 0xb5, 0x96, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xc4, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xba, 0xff, 0xbe, 0x7a, 0xff, 0x86, 0x1a, 0xff, 0x4d, 0x39, 0xff, 0x2c, 0xb8, 0xff, 0x04, 0x57, 0xff, 0x04, 0x16, 0xff, 0x04, 0x16, 0xff, 0x04, 0x57, 0xff, 0x2c, 0xb8, 0xff, 0x45, 0x19, 0xff, 0x7d, 0xd9, 0xff, 0xad, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x54, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xde, 0xba, 0xff, 0xce, 0xbb, 0xff, 0x85, 0xfa, 0xff, 0x04, 0xd8, 0xff, 0x03, 0xd6, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0x75, 0xff, 0x03, 0xd6, 0xff, 0x04, 0xd8, 0xff, 0x75, 0x99, 0xff, 0xb5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x07, 0xc6, 0x18, 0xcb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xb6, 0x7a, 0xff, 0x4d, 0x39, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x03, 0xf6, 0xff, 0x45, 0x18, 0xff, 0xa5, 0xd8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xcb, 0xb5, 0x96, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x1b, 0xc6, 0x18, 0xec, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xb6, 0x39, 0xff, 0x2c, 0xd8, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x2c, 0xd8, 0xff, 0xa5, 0xd8, 0xff, 0xad, 0xb7, 0xff, 0xad, 0xb7, 0xff, 0xa5, 0x97, 0xef, 0x6d, 0x99, 0x43, 0x25, 0x9b, 0x23, 0x25, 0x9a, 0x13, 0x3e, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x53, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xbe, 0x5a, 0xff, 0x34, 0xf8, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x24, 0x97, 0xff, 0x2c, 0xb8, 0xff, 0x04, 0x57, 0xff, 0x04, 0x36, 0xff, 0x14, 0x37, 0xff, 0x14, 0x77, 0xf4, 0x1c, 0xd8, 0xe7, 0x25, 0x5a, 0xa8, 0x25, 0x9a, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x90, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x9a, 0xff, 0x6d, 0x99, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xb8, 0xff, 0x25, 0x5a, 0x8f, 0x25, 0x7a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xc4, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xbe, 0x9b, 0xff, 0x14, 0x36, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x16, 0xff, 0x1d, 0x19, 0xc4, 0x2d, 0xbb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xeb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0x5d, 0x99, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xf9, 0xc4, 0x25, 0x9a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xce, 0xdb, 0xff, 0x04, 0x37, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x16, 0xff, 0x25, 0x39, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x9a, 0xff, 0x96, 0x3a, 0xff, 0x4d, 0xba, 0xff, 0x05, 0x59, 0xff, 0x04, 0xf9, 0xff, 0x13, 0xd5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd5, 0xff, 0x14, 0x57, 0xff, 0x2d, 0xbb, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x79, 0xff, 0x96, 0x3a, 0xff, 0x3d, 0x39, 0xff, 0x04, 0x36, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0xd8, 0xa8, 0x5f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xe0, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x85, 0xfa, 0xff, 0x04, 0x97, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x56, 0xe7, 0x2d, 0x9a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0xb4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xa6, 0x19, 0xff, 0x1c, 0x77, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0xff, 0x1d, 0x19, 0xff, 0x25, 0x19, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x57, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xf4, 0x1c, 0xf8, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x7f, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x3d, 0x38, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0x98, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x16, 0xff, 0x1c, 0x98, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x77, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x77, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x33, 0xc6, 0x18, 0xfb, 0xc6, 0x18, 0xff, 0x9e, 0x19, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x37, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x17, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x14, 0xc5, 0xf8, 0xe7, 0xc6, 0x18, 0xff, 0x75, 0x78, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0xff, 0x1c, 0xb8, 0xff, 0x0b, 0xb6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x77, 0xff, 0x14, 0x77, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x9f, 0xc6, 0x18, 0xff, 0x64, 0xf7, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x1c, 0xb8, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x57, 0xff, 0x14, 0x37, 0xff, 0x14, 0x16, 0xff, 0x14, 0x16, 0xff, 0x14, 0x57, 0xff, 0x1c, 0xd8, 0xeb, 0x25, 0x7a, 0x97, 0x2d, 0xbb, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x33, 0xc5, 0xf7, 0xff, 0x64, 0xd7, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0xb8, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x1c, 0xf9, 0xe0, 0x25, 0x7a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf7, 0x9f, 0x6d, 0x37, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x76, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0x77, 0xec, 0x25, 0x7a, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xd7, 0x18, 0x8d, 0xb8, 0xe8, 0x04, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x77, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x1c, 0xd8, 0xdc, 0x35, 0xfc, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x68, 0x3c, 0xd7, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x77, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x39, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x77, 0xa7, 0x1c, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x97, 0xff, 0x1d, 0x19, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x57, 0xe0, 0x2d, 0xdb, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x0c, 0x5d, 0x17, 0xc4, 0x04, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xd8, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xf4, 0x1c, 0xf8, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x03, 0x65, 0x17, 0xbb, 0x2c, 0xb7, 0xff, 0x04, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x77, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x37, 0x04, 0xa5, 0x97, 0x74, 0x7d, 0x57, 0xfc, 0x34, 0xd7, 0xff, 0x04, 0x97, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x56, 0xff, 0x1c, 0xb7, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x36, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xd7, 0x3b, 0xc5, 0xd7, 0xcf, 0xc5, 0xd7, 0xf8, 0xc5, 0xd7, 0xff, 0xc5, 0xf7, 0xff, 0xc5, 0xf7, 0xff, 0xc5, 0xf7, 0xff, 0xc5, 0xf7, 0xff, 0xc5, 0xf7, 0xff, 0xce, 0x17, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x36, 0xf8, 0x14, 0x57, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x0b, 0xbd, 0xb7, 0x47, 0xbd, 0xb7, 0xbf, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xc5, 0xd7, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xeb, 0x1c, 0xf8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x38, 0xbd, 0xb7, 0x8b, 0xbd, 0xb7, 0xdc, 0xbd, 0xb7, 0xe8, 0xbd, 0xb7, 0xf4, 0xbd, 0xd7, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xb3, 0x36, 0x9c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x96, 0x08, 0xb5, 0xb6, 0x17, 0xbd, 0xb7, 0x23, 0xd5, 0xf6, 0x23, 0x0c, 0x97, 0xd0, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x1c, 0xf8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x53, 0x14, 0x76, 0xfc, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x97, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x07, 0x14, 0x77, 0xa8, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0x88, 0x25, 0x58, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x97, 0x14, 0x76, 0xf3, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xfc, 0x14, 0x76, 0xdc, 0x14, 0x97, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xdf, 0x00, 0x14, 0xb7, 0x3f, 0x14, 0x97, 0xa4, 0x14, 0x97, 0xe4, 0x14, 0x97, 0xfc, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xe8, 0x14, 0x77, 0xb7, 0x14, 0x97, 0x64, 0x1c, 0xb8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xd7, 0x24, 
+  0xbd, 0xd7, 0x5f, 0xbd, 0xf7, 0x8c, 0xbd, 0xf7, 0xb0, 0x81, 0xbd, 0xd7, 0xc7, 0x03, 0xbd, 0xd7, 0xb0, 0xbd, 0xd7, 0x8c, 0xbd, 0xd7, 0x5f, 0xbd, 0xd7, 0x24, 0xb1, 0x00, 0x00, 0x00, 0x04, 0xbd, 
+  0xd7, 0x03, 0xc5, 0xf8, 0x1b, 0xc5, 0xf8, 0x7f, 0xc5, 0xf8, 0xd0, 0xbd, 0xf7, 0xff, 0x82, 0xc5, 0xf8, 0xff, 0x83, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x03, 0xbd, 0xd7, 0xd0, 0xbd, 0xb7, 
+  0x7f, 0xbd, 0xb7, 0x1b, 0xad, 0x55, 0x03, 0xac, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xf8, 0x2f, 0xc5, 0xf8, 0xab, 0xc5, 0xf8, 0xf0, 0x87, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 
+  0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xd7, 0xf0, 0xbd, 0xb7, 0xab, 0xbd, 0xb7, 0x2f, 0xa9, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xd7, 0x08, 0xc6, 0x18, 0x7b, 0x85, 0xc6, 0x18, 0xff, 0x81, 0xc6, 
+  0x38, 0xff, 0x85, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x7b, 0xb5, 0x96, 0x08, 0xa6, 0x00, 0x00, 0x00, 
+  0x01, 0xc6, 0x18, 0x1b, 0xc6, 0x18, 0xcb, 0x81, 0xc6, 0x18, 0xff, 0x82, 0xc6, 0x38, 0xff, 0x82, 0xce, 0x39, 0xff, 0x01, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 0xc6, 0x38, 0xff, 0x82, 0xc6, 
+  0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xcb, 0xbd, 0xb7, 0x1b, 0xa4, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x2b, 
+  0xc6, 0x18, 0xd4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0x82, 0xce, 0x39, 0xff, 0x87, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 
+  0xff, 0x81, 0xbd, 0xf7, 0xff, 0x03, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xd4, 0xb5, 0xb6, 0x2b, 0xa2, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x23, 0xc6, 0x18, 0xdb, 0xc6, 0x18, 0xff, 
+  0xc6, 0x38, 0xff, 0x81, 0xce, 0x39, 0xff, 0x83, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x86, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 
+  0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xdb, 0xb5, 0x96, 0x23, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xc5, 0xf8, 0x04, 0xc6, 0x18, 0xc8, 0xc6, 0x18, 0xff, 0xc6, 0x38, 
+  0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x83, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x7a, 0xff, 0x82, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x38, 0xff, 
+  0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xc8, 0xad, 0x55, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x04, 0xc6, 0x18, 
+  0x04, 0xc6, 0x18, 0xa0, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x86, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0x7a, 
+  0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x81, 0xbd, 0xb7, 
+  0xff, 0x01, 0xb5, 0x96, 0xa0, 0xb5, 0xb6, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x38, 0xc6, 0x18, 0xf8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 
+  0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xce, 0x59, 0xff, 0x85, 0xd6, 0x9a, 0xff, 0x02, 0xce, 0x7a, 0xff, 0xc6, 0x5a, 0xff, 0xbe, 0x5a, 0xff, 0x81, 0xbe, 0x39, 0xff, 0x02, 
+  0xb6, 0x19, 0xff, 0xbe, 0x19, 0xff, 0xbe, 0x18, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf8, 0xb5, 0x96, 0x38, 0x9d, 
+  0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0xc4, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 
+  0xff, 0x81, 0xd6, 0xba, 0xff, 0x05, 0xde, 0xba, 0xff, 0xbe, 0x7a, 0xff, 0x86, 0x1a, 0xff, 0x4d, 0x39, 0xff, 0x2c, 0xb8, 0xff, 0x04, 0x57, 0xff, 0x81, 0x04, 0x16, 0xff, 0x07, 0x04, 0x57, 0xff, 
+  0x2c, 0xb8, 0xff, 0x45, 0x19, 0xff, 0x7d, 0xd9, 0xff, 0xad, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0x81, 0xbd, 0xb7, 0xff, 0x00, 0xb5, 0x96, 0xc4, 0x9c, 0x00, 0x00, 
+  0x00, 0x02, 0xc6, 0x18, 0x54, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x00, 0xce, 0x39, 0xff, 0x84, 0xce, 0x59, 0xff, 0x04, 
+  0xde, 0xba, 0xff, 0xce, 0xbb, 0xff, 0x85, 0xfa, 0xff, 0x04, 0xd8, 0xff, 0x03, 0xd6, 0xff, 0x81, 0x0b, 0x75, 0xff, 0x83, 0x0b, 0x95, 0xff, 0x81, 0x0b, 0x75, 0xff, 0x03, 0x03, 0xd6, 0xff, 0x04, 
+  0xd8, 0xff, 0x75, 0x99, 0xff, 0xb5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x54, 0x9a, 0x00, 0x00, 0x00, 0x04, 0xc6, 0x18, 0x07, 0xc6, 0x18, 
+  0xcb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x03, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x82, 0xce, 0x79, 0xff, 0x03, 
+  0xce, 0x59, 0xff, 0xb6, 0x7a, 0xff, 0x4d, 0x39, 0xff, 0x03, 0xf6, 0xff, 0x8b, 0x0b, 0x95, 0xff, 0x07, 0x03, 0xf6, 0xff, 0x45, 0x18, 0xff, 0xa5, 0xd8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 
+  0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xcb, 0xb5, 0x96, 0x07, 0x99, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0x1b, 0xc6, 0x18, 0xec, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 
+  0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x02, 0xb6, 0x39, 0xff, 0x2c, 0xd8, 0xff, 0x0b, 0xb5, 0xff, 0x8d, 0x0b, 0x95, 
+  0xff, 0x02, 0x0b, 0xb5, 0xff, 0x2c, 0xd8, 0xff, 0xa5, 0xd8, 0xff, 0x81, 0xad, 0xb7, 0xff, 0x03, 0xa5, 0x97, 0xef, 0x6d, 0x99, 0x43, 0x25, 0x9b, 0x23, 0x25, 0x9a, 0x13, 0x97, 0x00, 0x00, 0x00, 
+  0x02, 0xc6, 0x18, 0x53, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x07, 0xd6, 0xba, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 
+  0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xbe, 0x5a, 0xff, 0x34, 0xf8, 0xff, 0x03, 0xb5, 0xff, 0x90, 0x0b, 0xb5, 0xff, 0x08, 0x24, 0x97, 0xff, 0x2c, 0xb8, 0xff, 0x04, 0x57, 0xff, 0x04, 0x36, 0xff, 
+  0x14, 0x37, 0xff, 0x14, 0x77, 0xf4, 0x1c, 0xd8, 0xe7, 0x25, 0x5a, 0xa8, 0x25, 0x9a, 0x37, 0x95, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x90, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 
+  0xff, 0x00, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x06, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x9a, 0xff, 0x6d, 0x99, 0xff, 0x03, 0xb5, 0xff, 0x97, 
+  0x0b, 0xb5, 0xff, 0x04, 0x0b, 0x95, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xb8, 0xff, 0x25, 0x5a, 0x8f, 0x25, 0x7a, 0x14, 0x93, 0x00, 0x00, 0x00, 0x05, 0xc6, 0x18, 0xc4, 0xc6, 0x18, 0xff, 0xce, 0x39, 
+  0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x05, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xbe, 0x9b, 0xff, 0x14, 0x36, 
+  0xff, 0x9b, 0x0b, 0xb5, 0xff, 0x02, 0x14, 0x16, 0xff, 0x1d, 0x19, 0xc4, 0x2d, 0xbb, 0x20, 0x92, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0xeb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 
+  0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x02, 0xe6, 0xfb, 0xff, 0x5d, 0x99, 0xff, 0x03, 0xb5, 0xff, 0x9c, 0x0b, 0xd5, 0xff, 0x02, 
+  0x0b, 0xf6, 0xff, 0x1c, 0xf9, 0xc4, 0x25, 0x9a, 0x14, 0x91, 0x00, 0x00, 0x00, 0x0d, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 
+  0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xce, 0xdb, 0xff, 0x04, 0x37, 0xff, 0x0b, 0xd5, 0xff, 0x9d, 0x0b, 0xd6, 0xff, 0x01, 0x14, 0x16, 0xff, 
+  0x25, 0x39, 0x8f, 0x91, 0x00, 0x00, 0x00, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x06, 0xd6, 0x9a, 0xff, 0xce, 0x9a, 0xff, 0x96, 0x3a, 0xff, 
+  0x4d, 0xba, 0xff, 0x05, 0x59, 0xff, 0x04, 0xf9, 0xff, 0x13, 0xd5, 0xff, 0x9e, 0x0b, 0xd6, 0xff, 0x02, 0x0b, 0xd5, 0xff, 0x14, 0x57, 0xff, 0x2d, 0xbb, 0x37, 0x90, 0x00, 0x00, 0x00, 0x81, 0xc6, 
+  0x18, 0xff, 0x00, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x04, 0xd6, 0x79, 0xff, 0x96, 0x3a, 0xff, 0x3d, 0x39, 0xff, 0x04, 0x36, 0xff, 0x03, 0xf6, 0xff, 0xa2, 0x0b, 0xf6, 0xff, 0x01, 0x0b, 
+  0xd6, 0xff, 0x1c, 0xd8, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0xe0, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x85, 0xfa, 0xff, 0x04, 0x97, 0xff, 0xa6, 
+  0x0b, 0xf6, 0xff, 0x01, 0x14, 0x56, 0xe7, 0x2d, 0x9a, 0x13, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xc5, 0xf8, 0xb4, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xa6, 0x19, 0xff, 0x1c, 0x77, 
+  0xff, 0x98, 0x0c, 0x16, 0xff, 0x06, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0xff, 0x1d, 0x19, 0xff, 0x25, 0x19, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x57, 0xff, 0x87, 0x0c, 0x16, 0xff, 0x01, 
+  0x14, 0x36, 0xf4, 0x1c, 0xf8, 0x23, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x7f, 0x81, 0xc6, 0x18, 0xff, 0x02, 0xce, 0x39, 0xff, 0x3d, 0x38, 0xff, 0x04, 0x16, 0xff, 0x95, 0x0c, 0x16, 0xff, 
+  0x0c, 0x0c, 0x36, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0x98, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x16, 0xff, 0x1c, 0x98, 0xff, 0x1c, 
+  0xd8, 0xff, 0x14, 0x77, 0xff, 0x0c, 0x36, 0xff, 0x84, 0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x77, 0x2f, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xc5, 0xf8, 0x33, 0xc6, 0x18, 0xfb, 0xc6, 0x18, 
+  0xff, 0x9e, 0x19, 0xff, 0x04, 0x36, 0xff, 0x94, 0x0c, 0x36, 0xff, 0x04, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x37, 0xff, 0x0b, 0xb5, 0xff, 0x86, 0x0b, 0x95, 0xff, 0x04, 
+  0x0b, 0xb5, 0xff, 0x14, 0x17, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x82, 0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0x33, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xbd, 
+  0xf7, 0x14, 0xc5, 0xf8, 0xe7, 0xc6, 0x18, 0xff, 0x75, 0x78, 0xff, 0x04, 0x16, 0xff, 0x94, 0x0c, 0x36, 0xff, 0x02, 0x14, 0x56, 0xff, 0x1c, 0xb8, 0xff, 0x0b, 0xb6, 0xff, 0x8a, 0x0b, 0x95, 0xff, 
+  0x01, 0x0b, 0xd6, 0xff, 0x1c, 0xb8, 0xff, 0x81, 0x14, 0x77, 0xff, 0x81, 0x14, 0x97, 0xff, 0x01, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0x3b, 0x90, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xf7, 0x9f, 0xc6, 0x18, 
+  0xff, 0x64, 0xf7, 0xff, 0x95, 0x0c, 0x36, 0xff, 0x01, 0x1c, 0xb8, 0xff, 0x0b, 0xd6, 0xff, 0x8c, 0x0b, 0xb5, 0xff, 0x02, 0x0b, 0xd6, 0xff, 0x14, 0x57, 0xff, 0x14, 0x37, 0xff, 0x81, 0x14, 0x16, 
+  0xff, 0x03, 0x14, 0x57, 0xff, 0x1c, 0xd8, 0xeb, 0x25, 0x7a, 0x97, 0x2d, 0xbb, 0x14, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xd7, 0x33, 0xc5, 0xf7, 0xff, 0x64, 0xd7, 0xff, 0x94, 0x0c, 0x56, 0xff, 
+  0x01, 0x14, 0xb8, 0xff, 0x13, 0xf6, 0xff, 0x93, 0x0b, 0xb5, 0xff, 0x03, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x1c, 0xf9, 0xe0, 0x25, 0x7a, 0x40, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xf7, 0x9f, 
+  0x6d, 0x37, 0xff, 0x04, 0x56, 0xff, 0x92, 0x0c, 0x56, 0xff, 0x02, 0x14, 0x76, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xb5, 0xff, 0x94, 0x0b, 0xd5, 0xff, 0x03, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 
+  0x77, 0xec, 0x25, 0x7a, 0x3c, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xd7, 0x18, 0x8d, 0xb8, 0xe8, 0x04, 0x56, 0xff, 0x90, 0x14, 0x56, 0xff, 0x00, 0x14, 0x77, 0xff, 0x81, 0x14, 0x97, 0xff, 0x00, 
+  0x0b, 0xf6, 0xff, 0x98, 0x0b, 0xd5, 0xff, 0x01, 0x1c, 0xd8, 0xdc, 0x35, 0xfc, 0x0b, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xf7, 0x68, 0x3c, 0xd7, 0xff, 0x0c, 0x56, 0xff, 0x8e, 0x14, 0x76, 0xff, 
+  0x03, 0x1d, 0x19, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x77, 0xff, 0x9a, 0x0b, 0xf6, 0xff, 0x00, 0x25, 0x39, 0x88, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x7d, 0x77, 0xa7, 0x1c, 0x76, 0xff, 
+  0x8c, 0x14, 0x76, 0xff, 0x03, 0x14, 0x97, 0xff, 0x1d, 0x19, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xd6, 0xff, 0x9c, 0x0b, 0xf6, 0xff, 0x01, 0x14, 0x57, 0xe0, 0x2d, 0xdb, 0x0f, 0x8d, 0x00, 0x00, 0x00, 
+  0x02, 0xbd, 0xf7, 0x0c, 0x5d, 0x17, 0xc4, 0x04, 0x76, 0xff, 0x8a, 0x14, 0x76, 0xff, 0x03, 0x14, 0x97, 0xff, 0x1c, 0xd8, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x9d, 0x0c, 0x16, 0xff, 0x01, 
+  0x14, 0x36, 0xf4, 0x1c, 0xf8, 0x23, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfb, 0x03, 0x65, 0x17, 0xbb, 0x2c, 0xb7, 0xff, 0x04, 0x76, 0xff, 0x81, 0x0c, 0x76, 0xff, 0x85, 0x14, 0x76, 0xff, 0x02, 
+  0x0c, 0x76, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x36, 0xff, 0x9f, 0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x77, 0x2f, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xc6, 0x37, 0x04, 0xa5, 0x97, 0x74, 0x7d, 
+  0x57, 0xfc, 0x34, 0xd7, 0xff, 0x04, 0x97, 0xff, 0x85, 0x04, 0x77, 0xff, 0x02, 0x04, 0x56, 0xff, 0x1c, 0xb7, 0xff, 0x0c, 0x16, 0xff, 0xa0, 0x0c, 0x36, 0xff, 0x00, 0x14, 0x36, 0x30, 0x91, 0x00, 
+  0x00, 0x00, 0x03, 0xc5, 0xd7, 0x3b, 0xc5, 0xd7, 0xcf, 0xc5, 0xd7, 0xf8, 0xc5, 0xd7, 0xff, 0x84, 0xc5, 0xf7, 0xff, 0x01, 0xce, 0x17, 0xff, 0x04, 0x56, 0xff, 0xa0, 0x0c, 0x36, 0xff, 0x01, 0x14, 
+  0x36, 0xf8, 0x14, 0x57, 0x27, 0x92, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xb7, 0x0b, 0xbd, 0xb7, 0x47, 0xbd, 0xb7, 0xbf, 0x81, 0xbd, 0xb7, 0xff, 0x82, 0xbd, 0xd7, 0xff, 0x01, 0xc5, 0xd7, 0xff, 0x04, 
+  0x16, 0xff, 0xa0, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xeb, 0x1c, 0xf8, 0x17, 0x95, 0x00, 0x00, 0x00, 0x06, 0xbd, 0xb7, 0x38, 0xbd, 0xb7, 0x8b, 0xbd, 0xb7, 0xdc, 0xbd, 0xb7, 0xe8, 0xbd, 0xb7, 
+  0xf4, 0xbd, 0xd7, 0xff, 0x04, 0x56, 0xff, 0xa0, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xb3, 0x36, 0x9c, 0x03, 0x97, 0x00, 0x00, 0x00, 0x05, 0xb5, 0x96, 0x08, 0xb5, 0xb6, 0x17, 0xbd, 0xb7, 0x23, 
+  0xd5, 0xf6, 0x23, 0x0c, 0x97, 0xd0, 0x0c, 0x56, 0xff, 0x9f, 0x14, 0x56, 0xff, 0x00, 0x1c, 0xf8, 0x30, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x14, 0xb7, 0x53, 0x14, 0x76, 0xfc, 0x9e, 0x14, 0x76, 0xff, 
+  0x00, 0x14, 0x97, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x59, 0x07, 0x14, 0x77, 0xa8, 0x9d, 0x14, 0x76, 0xff, 0x01, 0x14, 0x77, 0x88, 0x25, 0x58, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x01, 0x14, 
+  0x97, 0x97, 0x14, 0x76, 0xf3, 0x98, 0x14, 0x76, 0xff, 0x02, 0x14, 0x76, 0xfc, 0x14, 0x76, 0xdc, 0x14, 0x97, 0x5b, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x14, 0xb7, 0x3f, 0x14, 0x97, 0xa4, 0x14, 0x97, 
+  0xe4, 0x14, 0x97, 0xfc, 0x93, 0x14, 0x97, 0xfb, 0x03, 0x14, 0x97, 0xe8, 0x14, 0x77, 0xb7, 0x14, 0x97, 0x64, 0x1c, 0xb8, 0x13, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8, 0x24, 0xb8, 0xb8, 0xb8, 0x5f, 0xbb, 0xbb, 0xbb, 0x8c, 0xbb, 0xbb, 0xbb, 0xb0, 0xba, 0xba, 0xba, 0xc7, 0xb9, 0xb9, 0xb9, 0xc7, 0xb9, 0xb9, 0xb9, 0xb0, 0xb8, 0xb8, 0xb8, 0x8c, 0xb7, 0xb7, 0xb7, 0x5f, 0xb9, 0xb9, 0xb9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x03, 0xbd, 0xbd, 0xbd, 0x1b, 0xbd, 0xbd, 0xbd, 0x7f, 0xbd, 0xbd, 0xbd, 0xd0, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xd0, 0xb6, 0xb6, 0xb6, 0x7f, 0xb6, 0xb6, 0xb6, 0x1b, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x2f, 0xbe, 0xbe, 0xbe, 0xab, 0xbe, 0xbe, 0xbe, 0xf0, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xf0, 0xb6, 0xb6, 0xb6, 0xab, 0xb6, 0xb6, 0xb6, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x08, 0xbf, 0xbf, 0xbf, 0x7b, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x7b, 0xb1, 0xb1, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x1b, 0xbf, 0xbf, 0xbf, 0xcb, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xcb, 0xb6, 0xb6, 0xb6, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x2b, 0xc0, 0xc0, 0xc0, 0xd4, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xd4, 0xb3, 0xb3, 0xb3, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x23, 0xc0, 0xc0, 0xc0, 0xdb, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xdb, 0xb0, 0xb0, 0xb0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x04, 0xc0, 0xc0, 0xc0, 0xc8, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xc8, 0xa8, 0xa8, 0xa8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x04, 0xbf, 0xbf, 0xbf, 0xa0, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xa0, 0xb4, 0xb4, 0xb4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x38, 0xc2, 0xc2, 0xc2, 0xf8, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd1, 0xff, 0xcf, 0xcd, 0xc6, 0xff, 0xce, 0xc9, 0xbe, 0xff, 0xcd, 0xc7, 0xba, 0xff, 0xcc, 0xc5, 0xb7, 0xff, 0xcb, 0xc4, 0xb6, 0xff, 0xc8, 0xc2, 0xb4, 0xff, 0xc6, 0xc2, 0xb6, 0xff, 0xc4, 0xc2, 0xbb, 0xff, 0xc0, 0xc0, 0xc1, 0xff, 0xbe, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xf8, 0xb1, 0xb1, 0xb1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0xc4, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd4, 0xff, 0xd4, 0xd5, 0xd9, 0xff, 0xd3, 0xcd, 0xb9, 0xff, 0xd3, 0xbf, 0x7f, 0xff, 0xc8, 0xa3, 0x47, 0xff, 0xbf, 0x93, 0x28, 0xff, 0xb7, 0x87, 0x02, 0xff, 0xb3, 0x7f, 0x00, 0xff, 0xb3, 0x7f, 0x00, 0xff, 0xb7, 0x87, 0x03, 0xff, 0xbe, 0x93, 0x27, 0xff, 0xc7, 0xa1, 0x43, 0xff, 0xcb, 0xb7, 0x76, 0xff, 0xc2, 0xbd, 0xa9, 0xff, 0xbd, 0xbe, 0xc2, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x54, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xd4, 0xd4, 0xd5, 0xff, 0xd6, 0xd3, 0xca, 0xff, 0xd1, 0xbd, 0x80, 0xff, 0xc3, 0x98, 0x00, 0xff, 0xb1, 0x7a, 0x00, 0xff, 0xa6, 0x6c, 0x08, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xa8, 0x6f, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x09, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xa6, 0x6c, 0x08, 0xff, 0xb1, 0x7a, 0x00, 0xff, 0xc2, 0x98, 0x00, 0xff, 0xc5, 0xb1, 0x73, 0xff, 0xbe, 0xbc, 0xb2, 0xff, 0xba, 0xba, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb0, 0xb0, 0xb0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x07, 0xc0, 0xc0, 0xc0, 0xcb, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xcc, 0xff, 0xd4, 0xcd, 0xb1, 0xff, 0xc9, 0xa6, 0x48, 0xff, 0xb1, 0x7c, 0x00, 0xff, 0xaa, 0x72, 0x08, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x08, 0xff, 0xb1, 0x7c, 0x01, 0xff, 0xc4, 0xa1, 0x41, 0xff, 0xc0, 0xb9, 0x9e, 0xff, 0xb9, 0xb9, 0xbb, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xcb, 0xb0, 0xb0, 0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x1b, 0xc2, 0xc2, 0xc2, 0xec, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xce, 0xcf, 0xff, 0xcc, 0xc6, 0xb3, 0xff, 0xc2, 0x99, 0x27, 0xff, 0xab, 0x73, 0x06, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xab, 0x73, 0x06, 0xff, 0xc0, 0x97, 0x28, 0xff, 0xbe, 0xb7, 0xa1, 0xff, 0xba, 0xb6, 0xaa, 0xff, 0xbb, 0xb5, 0xa5, 0xff, 0xba, 0xb2, 0xa1, 0xef, 0xca, 0xb0, 0x6a, 0x43, 0xd5, 0xb1, 0x22, 0x23, 0xd4, 0xb1, 0x23, 0x13, 0xe5, 0xcc, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x53, 0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xce, 0xff, 0xcd, 0xc9, 0xb6, 0xff, 0xc2, 0x9e, 0x32, 0xff, 0xab, 0x75, 0x02, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xab, 0x75, 0x06, 0xff, 0xba, 0x8f, 0x1f, 0xff, 0xbd, 0x93, 0x25, 0xff, 0xb6, 0x88, 0x02, 0xff, 0xb4, 0x83, 0x00, 0xff, 0xb5, 0x86, 0x0f, 0xff, 0xba, 0x8d, 0x14, 0xf4, 0xc3, 0x99, 0x18, 0xe7, 0xcd, 0xaa, 0x1e, 0xa8, 0xd3, 0xb0, 0x22, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x90, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcc, 0xff, 0xca, 0xb0, 0x66, 0xff, 0xac, 0x75, 0x00, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xa9, 0x72, 0x08, 0xff, 0xaf, 0x7b, 0x0b, 0xff, 0xc0, 0x95, 0x16, 0xff, 0xcd, 0xa8, 0x1e, 0x8f, 0xd4, 0xae, 0x1e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xc4, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xda, 0xda, 0xda, 0xff, 0xda, 0xdb, 0xdc, 0xff, 0xd8, 0xd0, 0xb7, 0xff, 0xb3, 0x83, 0x0f, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x75, 0x09, 0xff, 0xb1, 0x7f, 0x0e, 0xff, 0xc5, 0x9f, 0x1c, 0xc4, 0xd8, 0xb6, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xeb, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xdb, 0xdc, 0xdf, 0xff, 0xcb, 0xaf, 0x5b, 0xff, 0xac, 0x76, 0x00, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xaf, 0x7b, 0x0b, 0xff, 0xc5, 0x9c, 0x1b, 0xc4, 0xd2, 0xb1, 0x24, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd5, 0xd7, 0xff, 0xd7, 0xd8, 0xdc, 0xff, 0xda, 0xdc, 0xe0, 0xff, 0xdb, 0xd8, 0xc7, 0xff, 0xb5, 0x83, 0x00, 0xff, 0xac, 0x78, 0x09, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x78, 0x0a, 0xff, 0xb1, 0x7f, 0x0d, 0xff, 0xca, 0xa3, 0x1e, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd0, 0xc7, 0xff, 0xd2, 0xc3, 0x8e, 0xff, 0xcf, 0xb4, 0x4a, 0xff, 0xcc, 0xa9, 0x00, 0xff, 0xc6, 0x9d, 0x00, 0xff, 0xab, 0x77, 0x0d, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xb8, 0x8a, 0x11, 0xff, 0xd6, 0xb3, 0x26, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcd, 0xd2, 0xff, 0xd1, 0xc3, 0x90, 0xff, 0xc6, 0xa3, 0x37, 0xff, 0xb4, 0x85, 0x00, 0xff, 0xb0, 0x7e, 0x03, 0xff, 0xae, 0x7b, 0x09, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xc3, 0x9a, 0x1b, 0xa8, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xe0, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcd, 0xbe, 0x83, 0xff, 0xbb, 0x8f, 0x00, 0xff, 0xad, 0x7c, 0x09, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xad, 0x7d, 0x0b, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xad, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xb4, 0x87, 0x10, 0xe7, 0xd4, 0xb2, 0x26, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0xb4, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc6, 0xc7, 0xff, 0xca, 0xc1, 0x9d, 0xff, 0xb8, 0x8e, 0x15, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xb8, 0x8b, 0x11, 0xff, 0xc1, 0x96, 0x17, 0xff, 0xc8, 0x9f, 0x1c, 0xff, 0xcb, 0xa2, 0x1d, 0xff, 0xc7, 0x9e, 0x1b, 0xff, 0xc1, 0x97, 0x17, 0xff, 0xb7, 0x8a, 0x10, 0xff, 0xae, 0x7f, 0x0a, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xb2, 0x84, 0x0e, 0xf4, 0xc2, 0x9c, 0x1a, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x7f, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xa6, 0x37, 0xff, 0xaf, 0x81, 0x04, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xb0, 0x83, 0x0c, 0xff, 0xba, 0x8e, 0x12, 0xff, 0xc3, 0x98, 0x18, 0xff, 0xbe, 0x8f, 0x15, 0xff, 0xb3, 0x7e, 0x0f, 0xff, 0xab, 0x72, 0x0a, 0xff, 0xa8, 0x6e, 0x07, 0xff, 0xab, 0x73, 0x0a, 0xff, 0xb3, 0x7f, 0x0f, 0xff, 0xbf, 0x90, 0x17, 0xff, 0xc3, 0x98, 0x18, 0xff, 0xb9, 0x8d, 0x12, 0xff, 0xb0, 0x83, 0x0c, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb8, 0x8e, 0x12, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x33, 0xbf, 0xbf, 0xbf, 0xfb, 0xc1, 0xc1, 0xc2, 0xff, 0xc9, 0xc0, 0x96, 0xff, 0xb2, 0x84, 0x00, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb3, 0x86, 0x0d, 0xff, 0xc3, 0x99, 0x18, 0xff, 0xb5, 0x83, 0x10, 0xff, 0xac, 0x74, 0x0a, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x70, 0x08, 0xff, 0xac, 0x74, 0x0a, 0xff, 0xb5, 0x82, 0x10, 0xff, 0xc3, 0x98, 0x17, 0xff, 0xb2, 0x86, 0x0d, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb2, 0x85, 0x0c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x14, 0xbd, 0xbd, 0xbd, 0xe7, 0xbf, 0xc0, 0xc1, 0xff, 0xc3, 0xae, 0x71, 0xff, 0xaf, 0x81, 0x00, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb3, 0x88, 0x0e, 0xff, 0xc1, 0x96, 0x17, 0xff, 0xad, 0x76, 0x0a, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xae, 0x77, 0x0c, 0xff, 0xc1, 0x96, 0x17, 0xff, 0xb6, 0x8c, 0x10, 0xff, 0xb9, 0x8e, 0x12, 0xff, 0xba, 0x90, 0x13, 0xff, 0xba, 0x90, 0x12, 0xff, 0xb7, 0x8d, 0x11, 0xff, 0xbf, 0x96, 0x16, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x9f, 0xbe, 0xbf, 0xc0, 0xff, 0xb9, 0x9e, 0x5f, 0xff, 0xb0, 0x85, 0x0a, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb0, 0x86, 0x0b, 0xff, 0xc0, 0x96, 0x15, 0xff, 0xad, 0x77, 0x0b, 0xff, 0xab, 0x73, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x73, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xba, 0x8a, 0x12, 0xff, 0xb6, 0x84, 0x11, 0xff, 0xb3, 0x80, 0x0f, 0xff, 0xb4, 0x82, 0x0f, 0xff, 0xb9, 0x8a, 0x12, 0xff, 0xc3, 0x97, 0x17, 0xeb, 0xd0, 0xab, 0x20, 0x97, 0xd6, 0xb4, 0x26, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x33, 0xbc, 0xbd, 0xbe, 0xff, 0xb5, 0x98, 0x5e, 0xff, 0xb2, 0x87, 0x0b, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xbe, 0x95, 0x14, 0xff, 0xb0, 0x7d, 0x0d, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xa9, 0x72, 0x08, 0xff, 0xb2, 0x7f, 0x0d, 0xff, 0xc6, 0x9d, 0x1a, 0xe0, 0xd0, 0xac, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbb, 0xbd, 0x9f, 0xb9, 0xa4, 0x6c, 0xff, 0xb1, 0x87, 0x01, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb4, 0x8c, 0x0e, 0xff, 0xb7, 0x88, 0x12, 0xff, 0xab, 0x76, 0x09, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xad, 0x78, 0x0b, 0xff, 0xbc, 0x8e, 0x15, 0xec, 0xd0, 0xab, 0x23, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xba, 0xc3, 0x18, 0xbe, 0xb3, 0x87, 0xe8, 0xb2, 0x87, 0x00, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb5, 0x8d, 0x0f, 0xff, 0xb7, 0x90, 0x11, 0xff, 0xba, 0x92, 0x13, 0xff, 0xaf, 0x7e, 0x0c, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xc0, 0x99, 0x19, 0xdc, 0xe3, 0xbe, 0x31, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xbc, 0xba, 0x68, 0xb5, 0x98, 0x3a, 0xff, 0xb3, 0x8a, 0x07, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb4, 0x8c, 0x0e, 0xff, 0xc5, 0xa2, 0x1b, 0xff, 0xc5, 0x9e, 0x1a, 0xff, 0xbf, 0x95, 0x16, 0xff, 0xba, 0x8d, 0x13, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xc9, 0xa3, 0x1d, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xab, 0x76, 0xa7, 0xb4, 0x8e, 0x15, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb9, 0x92, 0x12, 0xff, 0xc6, 0xa1, 0x1b, 0xff, 0xb6, 0x87, 0x10, 0xff, 0xad, 0x7a, 0x09, 0xff, 0xad, 0x7b, 0x09, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xb8, 0x8a, 0x11, 0xe0, 0xd8, 0xb7, 0x26, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xba, 0x0c, 0xb5, 0xa0, 0x55, 0xc4, 0xb4, 0x8c, 0x00, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb7, 0x92, 0x10, 0xff, 0xc0, 0x99, 0x18, 0xff, 0xb0, 0x80, 0x0c, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xb2, 0x84, 0x0e, 0xf4, 0xc4, 0x9e, 0x1c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xff, 0x03, 0xb6, 0xa1, 0x5d, 0xbb, 0xb5, 0x93, 0x2b, 0xff, 0xb4, 0x8e, 0x00, 0xff, 0xb4, 0x8e, 0x08, 0xff, 0xb4, 0x8e, 0x0c, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb3, 0x8d, 0x0c, 0xff, 0xbf, 0x99, 0x15, 0xff, 0xb1, 0x83, 0x0d, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xb1, 0x83, 0x0c, 0xff, 0xb8, 0x8e, 0x12, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xc3, 0xbd, 0x04, 0xb8, 0xb1, 0xa1, 0x74, 0xb6, 0xa7, 0x76, 0xfc, 0xb6, 0x99, 0x33, 0xff, 0xb6, 0x90, 0x00, 0xff, 0xb5, 0x8c, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb4, 0x8a, 0x00, 0xff, 0xbc, 0x95, 0x18, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb2, 0x86, 0x0d, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xba, 0xc3, 0x3b, 0xb7, 0xb9, 0xbd, 0xcf, 0xb7, 0xb9, 0xbd, 0xf8, 0xb8, 0xba, 0xbd, 0xff, 0xb9, 0xbb, 0xbe, 0xff, 0xba, 0xbc, 0xbf, 0xff, 0xba, 0xbc, 0xc0, 0xff, 0xba, 0xbc, 0xbf, 0xff, 0xba, 0xbc, 0xc0, 0xff, 0xbb, 0xbf, 0xc5, 0xff, 0xb4, 0x87, 0x00, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb2, 0x85, 0x0d, 0xf8, 0xb6, 0x8a, 0x0f, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x0b, 0xb5, 0xb5, 0xb5, 0x47, 0xb6, 0xb6, 0xb6, 0xbf, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb8, 0xba, 0xbd, 0xff, 0xb1, 0x82, 0x00, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb3, 0x89, 0x0d, 0xeb, 0xc0, 0x9b, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x38, 0xb5, 0xb5, 0xb5, 0x8b, 0xb5, 0xb5, 0xb5, 0xdc, 0xb6, 0xb6, 0xb6, 0xe8, 0xb6, 0xb6, 0xb6, 0xf4, 0xb5, 0xb7, 0xba, 0xff, 0xb2, 0x88, 0x00, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb3, 0x8a, 0x0d, 0xb3, 0xe2, 0xd2, 0x2e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x08, 0xb3, 0xb3, 0xb3, 0x17, 0xb5, 0xb5, 0xb5, 0x23, 0xb3, 0xbe, 0xce, 0x23, 0xb6, 0x90, 0x09, 0xd0, 0xb3, 0x8a, 0x0c, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb2, 0x89, 0x0d, 0xff, 0xbe, 0x9c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x96, 0x14, 0x53, 0xb3, 0x8b, 0x0d, 0xfc, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb7, 0x91, 0x10, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xa7, 0x17, 0x07, 0xb5, 0x8e, 0x0d, 0xa8, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb5, 0x8e, 0x0e, 0x88, 0xc2, 0xaa, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x8f, 0x0d, 0x97, 0xb4, 0x8e, 0x0d, 0xf3, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xfc, 0xb4, 0x8e, 0x0d, 0xdc, 0xb6, 0x8f, 0x0f, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x1c, 0x00, 0xbb, 0x94, 0x12, 0x3f, 0xb6, 0x90, 0x0d, 0xa4, 0xb5, 0x8f, 0x0d, 0xe4, 0xb5, 0x8f, 0x0d, 0xfc, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xe8, 0xb5, 0x8e, 0x0d, 0xb7, 0xb7, 0x92, 0x10, 0x64, 0xbe, 0x96, 0x16, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 
+  0x00, 0x00, 0x09, 0xb8, 0xb8, 0xb8, 0x24, 0xb8, 0xb8, 0xb8, 0x5f, 0xbb, 0xbb, 0xbb, 0x8c, 0xbb, 0xbb, 0xbb, 0xb0, 0xba, 0xba, 0xba, 0xc7, 0xb9, 0xb9, 0xb9, 0xc7, 0xb9, 0xb9, 0xb9, 0xb0, 0xb8, 
+  0xb8, 0xb8, 0x8c, 0xb7, 0xb7, 0xb7, 0x5f, 0xb9, 0xb9, 0xb9, 0x24, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xba, 0xba, 0xba, 0x03, 0xbd, 0xbd, 0xbd, 0x1b, 0xbd, 0xbd, 0xbd, 0x7f, 0xbd, 0xbd, 0xbd, 
+  0xd0, 0xbc, 0xbc, 0xbc, 0xff, 0x82, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x05, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 
+  0xd0, 0xb6, 0xb6, 0xb6, 0x7f, 0xb6, 0xb6, 0xb6, 0x1b, 0xaa, 0xaa, 0xaa, 0x03, 0xac, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xbd, 0xbd, 0x2f, 0xbe, 0xbe, 0xbe, 0xab, 0xbe, 0xbe, 0xbe, 0xf0, 0x81, 
+  0xbf, 0xbf, 0xbf, 0xff, 0x01, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xbf, 0xbf, 0xbf, 0xff, 0x01, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 
+  0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x04, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xf0, 0xb6, 0xb6, 0xb6, 0xab, 0xb6, 0xb6, 0xb6, 0x2f, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xba, 0xba, 0xba, 0x08, 0xbf, 0xbf, 0xbf, 0x7b, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x82, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 
+  0x00, 0xc1, 0xc1, 0xc1, 0xff, 0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x08, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 
+  0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x7b, 0xb1, 0xb1, 0xb1, 0x08, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc1, 0xc1, 0xc1, 0x1b, 0xbf, 0xbf, 0xbf, 0xcb, 0xc0, 0xc0, 0xc0, 
+  0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc4, 0xc4, 0xc4, 0xff, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x01, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 
+  0xff, 0x81, 0xc4, 0xc4, 0xc4, 0xff, 0x01, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x07, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 
+  0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xcb, 0xb6, 0xb6, 0xb6, 0x1b, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbf, 0xbf, 0xbf, 0x2b, 0xc0, 
+  0xc0, 0xc0, 0xd4, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x00, 0xc6, 0xc6, 0xc6, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x00, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 
+  0xc8, 0xc8, 0xc8, 0xff, 0x82, 0xc7, 0xc7, 0xc7, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x04, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 
+  0xbe, 0xbe, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x03, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xd4, 0xb3, 0xb3, 0xb3, 0x2b, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 
+  0xc0, 0xc0, 0x23, 0xc0, 0xc0, 0xc0, 0xdb, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 
+  0xca, 0xca, 0xca, 0xff, 0x00, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xca, 0xca, 0xca, 0xff, 0x02, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 
+  0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x00, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x06, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 
+  0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xdb, 0xb0, 0xb0, 0xb0, 0x23, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbd, 0xbd, 0xbd, 0x04, 0xc0, 0xc0, 0xc0, 0xc8, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 
+  0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0x82, 0xcc, 0xcc, 0xcc, 0xff, 0x82, 0xcd, 0xcd, 0xcd, 0xff, 
+  0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x0e, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 
+  0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xc8, 0xa8, 0xa8, 
+  0xa8, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbf, 0xbf, 0xbf, 0x04, 0xbf, 0xbf, 0xbf, 0xa0, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 
+  0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xd0, 0xd0, 0xd0, 0xff, 0x83, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xcd, 
+  0xcd, 0xcd, 0xff, 0x0e, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 
+  0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xa0, 0xb4, 0xb4, 0xb4, 0x04, 
+  0x9d, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbf, 0xbf, 0xbf, 0x38, 0xc2, 0xc2, 0xc2, 0xf8, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 
+  0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x01, 0xc7, 0xc7, 0xc7, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0x82, 0xd1, 0xd1, 0xd1, 0xff, 0x11, 0xd0, 0xd1, 
+  0xd1, 0xff, 0xd0, 0xd0, 0xd1, 0xff, 0xcf, 0xcd, 0xc6, 0xff, 0xce, 0xc9, 0xbe, 0xff, 0xcd, 0xc7, 0xba, 0xff, 0xcc, 0xc5, 0xb7, 0xff, 0xcb, 0xc4, 0xb6, 0xff, 0xc8, 0xc2, 0xb4, 0xff, 0xc6, 0xc2, 
+  0xb6, 0xff, 0xc4, 0xc2, 0xbb, 0xff, 0xc0, 0xc0, 0xc1, 0xff, 0xbe, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 
+  0xb4, 0xf8, 0xb1, 0xb1, 0xb1, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc1, 0xc1, 0xc1, 0xc4, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 
+  0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x03, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x07, 0xd4, 0xd4, 0xd4, 0xff, 
+  0xd3, 0xd3, 0xd4, 0xff, 0xd4, 0xd5, 0xd9, 0xff, 0xd3, 0xcd, 0xb9, 0xff, 0xd3, 0xbf, 0x7f, 0xff, 0xc8, 0xa3, 0x47, 0xff, 0xbf, 0x93, 0x28, 0xff, 0xb7, 0x87, 0x02, 0xff, 0x81, 0xb3, 0x7f, 0x00, 
+  0xff, 0x0a, 0xb7, 0x87, 0x03, 0xff, 0xbe, 0x93, 0x27, 0xff, 0xc7, 0xa1, 0x43, 0xff, 0xcb, 0xb7, 0x76, 0xff, 0xc2, 0xbd, 0xa9, 0xff, 0xbd, 0xbe, 0xc2, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 
+  0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xc4, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xbf, 0xbf, 0x54, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 
+  0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xcd, 0xcd, 0xcd, 0xff, 0x02, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 0xca, 
+  0xca, 0xca, 0xff, 0x08, 0xc8, 0xc8, 0xc8, 0xff, 0xd4, 0xd4, 0xd5, 0xff, 0xd6, 0xd3, 0xca, 0xff, 0xd1, 0xbd, 0x80, 0xff, 0xc3, 0x98, 0x00, 0xff, 0xb1, 0x7a, 0x00, 0xff, 0xa6, 0x6c, 0x08, 0xff, 
+  0xa8, 0x6e, 0x08, 0xff, 0xa8, 0x6f, 0x09, 0xff, 0x81, 0xa9, 0x70, 0x09, 0xff, 0x0b, 0xa8, 0x6f, 0x09, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xa6, 0x6c, 0x08, 0xff, 0xb1, 0x7a, 0x00, 0xff, 0xc2, 0x98, 
+  0x00, 0xff, 0xc5, 0xb1, 0x73, 0xff, 0xbe, 0xbc, 0xb2, 0xff, 0xba, 0xba, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb0, 0xb0, 0xb0, 0x54, 0x9a, 0x00, 
+  0x00, 0x00, 0x00, 0x0b, 0xc0, 0xc0, 0xc0, 0x07, 0xc0, 0xc0, 0xc0, 0xcb, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 
+  0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x05, 0xca, 0xca, 0xcc, 0xff, 0xd4, 0xcd, 
+  0xb1, 0xff, 0xc9, 0xa6, 0x48, 0xff, 0xb1, 0x7c, 0x00, 0xff, 0xaa, 0x72, 0x08, 0xff, 0xa9, 0x71, 0x09, 0xff, 0x87, 0xaa, 0x72, 0x09, 0xff, 0x09, 0xa9, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x08, 0xff, 
+  0xb1, 0x7c, 0x01, 0xff, 0xc4, 0xa1, 0x41, 0xff, 0xc0, 0xb9, 0x9e, 0xff, 0xb9, 0xb9, 0xbb, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xcb, 0xb0, 0xb0, 0xb0, 0x07, 
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x10, 0xc0, 0xc0, 0xc0, 0x1b, 0xc2, 0xc2, 0xc2, 0xec, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 
+  0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xce, 0xcf, 0xff, 0xcc, 0xc6, 
+  0xb3, 0xff, 0xc2, 0x99, 0x27, 0xff, 0xab, 0x73, 0x06, 0xff, 0x8d, 0xaa, 0x72, 0x09, 0xff, 0x08, 0xab, 0x73, 0x06, 0xff, 0xc0, 0x97, 0x28, 0xff, 0xbe, 0xb7, 0xa1, 0xff, 0xba, 0xb6, 0xaa, 0xff, 
+  0xbb, 0xb5, 0xa5, 0xff, 0xba, 0xb2, 0xa1, 0xef, 0xca, 0xb0, 0x6a, 0x43, 0xd5, 0xb1, 0x22, 0x23, 0xd4, 0xb1, 0x23, 0x13, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbf, 0xbf, 0xbf, 0x53, 0xc1, 0xc1, 
+  0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcc, 0xcc, 
+  0xcc, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xce, 0xff, 0xcd, 0xc9, 0xb6, 0xff, 0xc2, 0x9e, 0x32, 0xff, 0xab, 0x75, 0x02, 0xff, 0x8f, 0xaa, 0x74, 0x09, 0xff, 0x09, 
+  0xab, 0x75, 0x06, 0xff, 0xba, 0x8f, 0x1f, 0xff, 0xbd, 0x93, 0x25, 0xff, 0xb6, 0x88, 0x02, 0xff, 0xb4, 0x83, 0x00, 0xff, 0xb5, 0x86, 0x0f, 0xff, 0xba, 0x8d, 0x14, 0xf4, 0xc3, 0x99, 0x18, 0xe7, 
+  0xcd, 0xaa, 0x1e, 0xa8, 0xd3, 0xb0, 0x22, 0x37, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xc0, 0xc0, 0xc0, 0x90, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 
+  0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 
+  0xcc, 0xff, 0xca, 0xb0, 0x66, 0xff, 0xac, 0x75, 0x00, 0xff, 0x91, 0xab, 0x75, 0x09, 0xff, 0x81, 0xaa, 0x74, 0x08, 0xff, 0x82, 0xab, 0x75, 0x09, 0xff, 0x05, 0xaa, 0x74, 0x08, 0xff, 0xa9, 0x72, 
+  0x08, 0xff, 0xaf, 0x7b, 0x0b, 0xff, 0xc0, 0x95, 0x16, 0xff, 0xcd, 0xa8, 0x1e, 0x8f, 0xd4, 0xae, 0x1e, 0x14, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xbf, 0xbf, 0xbf, 0xc4, 0xc2, 0xc2, 0xc2, 0xff, 
+  0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 
+  0xda, 0xda, 0xda, 0xff, 0xda, 0xdb, 0xdc, 0xff, 0xd8, 0xd0, 0xb7, 0xff, 0xb3, 0x83, 0x0f, 0xff, 0x9a, 0xab, 0x76, 0x0a, 0xff, 0x03, 0xab, 0x75, 0x09, 0xff, 0xb1, 0x7f, 0x0e, 0xff, 0xc5, 0x9f, 
+  0x1c, 0xc4, 0xd8, 0xb6, 0x28, 0x20, 0x92, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc0, 0xc0, 0xc0, 0xeb, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 
+  0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x02, 0xdb, 0xdc, 0xdf, 0xff, 0xcb, 0xaf, 0x5b, 0xff, 0xac, 0x76, 
+  0x00, 0xff, 0x9c, 0xac, 0x77, 0x0a, 0xff, 0x02, 0xaf, 0x7b, 0x0b, 0xff, 0xc5, 0x9c, 0x1b, 0xc4, 0xd2, 0xb1, 0x24, 0x14, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xbf, 0xbf, 0xbf, 0xff, 0xc3, 0xc3, 
+  0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd5, 0xd7, 0xff, 0xd7, 0xd8, 
+  0xdc, 0xff, 0xda, 0xdc, 0xe0, 0xff, 0xdb, 0xd8, 0xc7, 0xff, 0xb5, 0x83, 0x00, 0xff, 0xac, 0x78, 0x09, 0xff, 0x9c, 0xad, 0x79, 0x0a, 0xff, 0x02, 0xad, 0x78, 0x0a, 0xff, 0xb1, 0x7f, 0x0d, 0xff, 
+  0xca, 0xa3, 0x1e, 0x8f, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 
+  0xcc, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd0, 0xc7, 0xff, 0xd2, 0xc3, 0x8e, 0xff, 0xcf, 0xb4, 0x4a, 0xff, 0xcc, 0xa9, 0x00, 0xff, 0xc6, 0x9d, 0x00, 0xff, 0xab, 0x77, 0x0d, 0xff, 0x9e, 0xad, 
+  0x7a, 0x0a, 0xff, 0x02, 0xac, 0x79, 0x0a, 0xff, 0xb8, 0x8a, 0x11, 0xff, 0xd6, 0xb3, 0x26, 0x37, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 
+  0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcd, 0xd2, 0xff, 0xd1, 0xc3, 0x90, 0xff, 0xc6, 0xa3, 0x37, 0xff, 0xb4, 0x85, 0x00, 0xff, 0xb0, 0x7e, 0x03, 0xff, 0xae, 0x7b, 
+  0x09, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xa0, 0xae, 0x7c, 0x0b, 0xff, 0x01, 0xad, 0x7a, 0x0a, 0xff, 0xc3, 0x9a, 0x1b, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xbf, 0xbf, 0xe0, 0xc1, 0xc1, 
+  0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcd, 0xbe, 0x83, 0xff, 0xbb, 0x8f, 0x00, 0xff, 0xad, 0x7c, 0x09, 0xff, 0x97, 0xae, 0x7d, 0x0b, 0xff, 0x00, 
+  0xad, 0x7d, 0x0b, 0xff, 0x82, 0xad, 0x7c, 0x0a, 0xff, 0x00, 0xad, 0x7d, 0x0b, 0xff, 0x88, 0xae, 0x7d, 0x0b, 0xff, 0x01, 0xb4, 0x87, 0x10, 0xe7, 0xd4, 0xb2, 0x26, 0x13, 0x8f, 0x00, 0x00, 0x00, 
+  0x00, 0x06, 0xbd, 0xbd, 0xbd, 0xb4, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc6, 0xc7, 0xff, 0xca, 0xc1, 0x9d, 0xff, 0xb8, 0x8e, 0x15, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0x95, 0xaf, 
+  0x80, 0x0b, 0xff, 0x0a, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xb8, 0x8b, 0x11, 0xff, 0xc1, 0x96, 0x17, 0xff, 0xc8, 0x9f, 0x1c, 0xff, 0xcb, 0xa2, 0x1d, 0xff, 0xc7, 0x9e, 0x1b, 0xff, 
+  0xc1, 0x97, 0x17, 0xff, 0xb7, 0x8a, 0x10, 0xff, 0xae, 0x7f, 0x0a, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0x85, 0xaf, 0x80, 0x0b, 0xff, 0x01, 0xb2, 0x84, 0x0e, 0xf4, 0xc2, 0x9c, 0x1a, 0x23, 0x8f, 0x00, 
+  0x00, 0x00, 0x00, 0x05, 0xbe, 0xbe, 0xbe, 0x7f, 0xbf, 0xbf, 0xbf, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xa6, 0x37, 0xff, 0xaf, 0x81, 0x04, 0xff, 0x95, 0xaf, 0x81, 0x0b, 
+  0xff, 0x0c, 0xb0, 0x83, 0x0c, 0xff, 0xba, 0x8e, 0x12, 0xff, 0xc3, 0x98, 0x18, 0xff, 0xbe, 0x8f, 0x15, 0xff, 0xb3, 0x7e, 0x0f, 0xff, 0xab, 0x72, 0x0a, 0xff, 0xa8, 0x6e, 0x07, 0xff, 0xab, 0x73, 
+  0x0a, 0xff, 0xb3, 0x7f, 0x0f, 0xff, 0xbf, 0x90, 0x17, 0xff, 0xc3, 0x98, 0x18, 0xff, 0xb9, 0x8d, 0x12, 0xff, 0xb0, 0x83, 0x0c, 0xff, 0x84, 0xaf, 0x81, 0x0b, 0xff, 0x01, 0xb1, 0x84, 0x0c, 0xff, 
+  0xb8, 0x8e, 0x12, 0x2f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbd, 0xbd, 0xbd, 0x33, 0xbf, 0xbf, 0xbf, 0xfb, 0xc1, 0xc1, 0xc2, 0xff, 0xc9, 0xc0, 0x96, 0xff, 0xb2, 0x84, 0x00, 0xff, 0x94, 0xb0, 
+  0x83, 0x0b, 0xff, 0x04, 0xb0, 0x82, 0x0b, 0xff, 0xb3, 0x86, 0x0d, 0xff, 0xc3, 0x99, 0x18, 0xff, 0xb5, 0x83, 0x10, 0xff, 0xac, 0x74, 0x0a, 0xff, 0x81, 0xa9, 0x70, 0x09, 0xff, 0x82, 0xaa, 0x71, 
+  0x09, 0xff, 0x06, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x70, 0x08, 0xff, 0xac, 0x74, 0x0a, 0xff, 0xb5, 0x82, 0x10, 0xff, 0xc3, 0x98, 0x17, 0xff, 0xb2, 0x86, 0x0d, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0x82, 
+  0xb0, 0x82, 0x0b, 0xff, 0x01, 0xb0, 0x83, 0x0b, 0xff, 0xb2, 0x85, 0x0c, 0x33, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbb, 0xbb, 0xbb, 0x14, 0xbd, 0xbd, 0xbd, 0xe7, 0xbf, 0xc0, 0xc1, 0xff, 0xc3, 
+  0xae, 0x71, 0xff, 0xaf, 0x81, 0x00, 0xff, 0x94, 0xb0, 0x84, 0x0c, 0xff, 0x03, 0xb3, 0x88, 0x0e, 0xff, 0xc1, 0x96, 0x17, 0xff, 0xad, 0x76, 0x0a, 0xff, 0xa9, 0x71, 0x09, 0xff, 0x88, 0xaa, 0x72, 
+  0x09, 0xff, 0x08, 0xa9, 0x71, 0x09, 0xff, 0xae, 0x77, 0x0c, 0xff, 0xc1, 0x96, 0x17, 0xff, 0xb6, 0x8c, 0x10, 0xff, 0xb9, 0x8e, 0x12, 0xff, 0xba, 0x90, 0x13, 0xff, 0xba, 0x90, 0x12, 0xff, 0xb7, 
+  0x8d, 0x11, 0xff, 0xbf, 0x96, 0x16, 0x3b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbc, 0xbc, 0xbc, 0x9f, 0xbe, 0xbf, 0xc0, 0xff, 0xb9, 0x9e, 0x5f, 0xff, 0xb0, 0x85, 0x0a, 0xff, 0x93, 0xb1, 0x86, 
+  0x0c, 0xff, 0x03, 0xb0, 0x86, 0x0b, 0xff, 0xc0, 0x96, 0x15, 0xff, 0xad, 0x77, 0x0b, 0xff, 0xab, 0x73, 0x09, 0xff, 0x8a, 0xab, 0x74, 0x09, 0xff, 0x09, 0xab, 0x73, 0x09, 0xff, 0xad, 0x77, 0x0a, 
+  0xff, 0xba, 0x8a, 0x12, 0xff, 0xb6, 0x84, 0x11, 0xff, 0xb3, 0x80, 0x0f, 0xff, 0xb4, 0x82, 0x0f, 0xff, 0xb9, 0x8a, 0x12, 0xff, 0xc3, 0x97, 0x17, 0xeb, 0xd0, 0xab, 0x20, 0x97, 0xd6, 0xb4, 0x26, 
+  0x14, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb9, 0xb9, 0xb9, 0x33, 0xbc, 0xbd, 0xbe, 0xff, 0xb5, 0x98, 0x5e, 0xff, 0xb2, 0x87, 0x0b, 0xff, 0x93, 0xb2, 0x87, 0x0c, 0xff, 0x01, 0xbe, 0x95, 0x14, 
+  0xff, 0xb0, 0x7d, 0x0d, 0xff, 0x8e, 0xab, 0x75, 0x09, 0xff, 0x00, 0xaa, 0x74, 0x09, 0xff, 0x82, 0xab, 0x75, 0x09, 0xff, 0x04, 0xaa, 0x74, 0x09, 0xff, 0xa9, 0x72, 0x08, 0xff, 0xb2, 0x7f, 0x0d, 
+  0xff, 0xc6, 0x9d, 0x1a, 0xe0, 0xd0, 0xac, 0x22, 0x40, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xba, 0xbb, 0xbd, 0x9f, 0xb9, 0xa4, 0x6c, 0xff, 0xb1, 0x87, 0x01, 0xff, 0x92, 0xb2, 0x89, 0x0c, 0xff, 
+  0x02, 0xb4, 0x8c, 0x0e, 0xff, 0xb7, 0x88, 0x12, 0xff, 0xab, 0x76, 0x09, 0xff, 0x94, 0xac, 0x77, 0x0a, 0xff, 0x03, 0xab, 0x76, 0x0a, 0xff, 0xad, 0x78, 0x0b, 0xff, 0xbc, 0x8e, 0x15, 0xec, 0xd0, 
+  0xab, 0x23, 0x3c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb6, 0xba, 0xc3, 0x18, 0xbe, 0xb3, 0x87, 0xe8, 0xb2, 0x87, 0x00, 0xff, 0x90, 0xb3, 0x8a, 0x0d, 0xff, 0x03, 0xb5, 0x8d, 0x0f, 0xff, 0xb7, 
+  0x90, 0x11, 0xff, 0xba, 0x92, 0x13, 0xff, 0xaf, 0x7e, 0x0c, 0xff, 0x98, 0xac, 0x79, 0x0a, 0xff, 0x01, 0xc0, 0x99, 0x19, 0xdc, 0xe3, 0xbe, 0x31, 0x0b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xba, 
+  0xbc, 0xba, 0x68, 0xb5, 0x98, 0x3a, 0xff, 0xb3, 0x8a, 0x07, 0xff, 0x8d, 0xb3, 0x8b, 0x0d, 0xff, 0x04, 0xb4, 0x8c, 0x0e, 0xff, 0xc5, 0xa2, 0x1b, 0xff, 0xc5, 0x9e, 0x1a, 0xff, 0xbf, 0x95, 0x16, 
+  0xff, 0xba, 0x8d, 0x13, 0xff, 0x99, 0xad, 0x7b, 0x0a, 0xff, 0x01, 0xae, 0x7c, 0x0a, 0xff, 0xc9, 0xa3, 0x1d, 0x88, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbb, 0xab, 0x76, 0xa7, 0xb4, 0x8e, 0x15, 
+  0xff, 0x8c, 0xb4, 0x8c, 0x0d, 0xff, 0x05, 0xb9, 0x92, 0x12, 0xff, 0xc6, 0xa1, 0x1b, 0xff, 0xb6, 0x87, 0x10, 0xff, 0xad, 0x7a, 0x09, 0xff, 0xad, 0x7b, 0x09, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0x9a, 
+  0xae, 0x7c, 0x0a, 0xff, 0x01, 0xb8, 0x8a, 0x11, 0xe0, 0xd8, 0xb7, 0x26, 0x0f, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbb, 0xbb, 0xba, 0x0c, 0xb5, 0xa0, 0x55, 0xc4, 0xb4, 0x8c, 0x00, 0xff, 0x8a, 
+  0xb4, 0x8e, 0x0d, 0xff, 0x03, 0xb7, 0x92, 0x10, 0xff, 0xc0, 0x99, 0x18, 0xff, 0xb0, 0x80, 0x0c, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0x9d, 0xaf, 0x7f, 0x0b, 0xff, 0x01, 0xb2, 0x84, 0x0e, 0xf4, 0xc4, 
+  0x9e, 0x1c, 0x23, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd7, 0xff, 0xff, 0x03, 0xb6, 0xa1, 0x5d, 0xbb, 0xb5, 0x93, 0x2b, 0xff, 0xb4, 0x8e, 0x00, 0xff, 0xb4, 0x8e, 0x08, 0xff, 0xb4, 0x8e, 0x0c, 
+  0xff, 0x85, 0xb4, 0x8e, 0x0d, 0xff, 0x03, 0xb3, 0x8d, 0x0c, 0xff, 0xbf, 0x99, 0x15, 0xff, 0xb1, 0x83, 0x0d, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0x9e, 0xaf, 0x80, 0x0b, 0xff, 0x01, 0xb1, 0x83, 0x0c, 
+  0xff, 0xb8, 0x8e, 0x12, 0x2f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbb, 0xc3, 0xbd, 0x04, 0xb8, 0xb1, 0xa1, 0x74, 0xb6, 0xa7, 0x76, 0xfc, 0xb6, 0x99, 0x33, 0xff, 0xb6, 0x90, 0x00, 0xff, 0xb5, 
+  0x8c, 0x00, 0xff, 0x84, 0xb5, 0x8b, 0x00, 0xff, 0x02, 0xb4, 0x8a, 0x00, 0xff, 0xbc, 0x95, 0x18, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xa0, 0xb0, 0x83, 0x0b, 0xff, 0x00, 0xb2, 0x86, 0x0d, 0x30, 0x91, 
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xb7, 0xba, 0xc3, 0x3b, 0xb7, 0xb9, 0xbd, 0xcf, 0xb7, 0xb9, 0xbd, 0xf8, 0xb8, 0xba, 0xbd, 0xff, 0xb9, 0xbb, 0xbe, 0xff, 0xba, 0xbc, 0xbf, 0xff, 0xba, 0xbc, 0xc0, 
+  0xff, 0xba, 0xbc, 0xbf, 0xff, 0xba, 0xbc, 0xc0, 0xff, 0xbb, 0xbf, 0xc5, 0xff, 0xb4, 0x87, 0x00, 0xff, 0xa0, 0xb1, 0x84, 0x0c, 0xff, 0x01, 0xb2, 0x85, 0x0d, 0xf8, 0xb6, 0x8a, 0x0f, 0x27, 0x92, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xb6, 0xb6, 0xb6, 0x0b, 0xb5, 0xb5, 0xb5, 0x47, 0xb6, 0xb6, 0xb6, 0xbf, 0x81, 0xb6, 0xb6, 0xb6, 0xff, 0x82, 0xb7, 0xb7, 0xb7, 0xff, 0x01, 0xb8, 0xba, 0xbd, 0xff, 
+  0xb1, 0x82, 0x00, 0xff, 0xa0, 0xb2, 0x87, 0x0c, 0xff, 0x01, 0xb3, 0x89, 0x0d, 0xeb, 0xc0, 0x9b, 0x17, 0x17, 0x95, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb5, 0xb5, 0xb5, 0x38, 0xb5, 0xb5, 0xb5, 0x8b, 
+  0xb5, 0xb5, 0xb5, 0xdc, 0xb6, 0xb6, 0xb6, 0xe8, 0xb6, 0xb6, 0xb6, 0xf4, 0xb5, 0xb7, 0xba, 0xff, 0xb2, 0x88, 0x00, 0xff, 0xa0, 0xb2, 0x88, 0x0c, 0xff, 0x01, 0xb3, 0x8a, 0x0d, 0xb3, 0xe2, 0xd2, 
+  0x2e, 0x03, 0x97, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb2, 0xb2, 0xb2, 0x08, 0xb3, 0xb3, 0xb3, 0x17, 0xb5, 0xb5, 0xb5, 0x23, 0xb3, 0xbe, 0xce, 0x23, 0xb6, 0x90, 0x09, 0xd0, 0xb3, 0x8a, 0x0c, 0xff, 
+  0x9e, 0xb3, 0x8a, 0x0d, 0xff, 0x01, 0xb2, 0x89, 0x0d, 0xff, 0xbe, 0x9c, 0x18, 0x30, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9, 0x96, 0x14, 0x53, 0xb3, 0x8b, 0x0d, 0xfc, 0x9e, 0xb3, 0x8b, 0x0d, 
+  0xff, 0x00, 0xb7, 0x91, 0x10, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xca, 0xa7, 0x17, 0x07, 0xb5, 0x8e, 0x0d, 0xa8, 0x9d, 0xb4, 0x8d, 0x0d, 0xff, 0x01, 0xb5, 0x8e, 0x0e, 0x88, 0xc2, 0xaa, 
+  0x1f, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb5, 0x8f, 0x0d, 0x97, 0xb4, 0x8e, 0x0d, 0xf3, 0x98, 0xb4, 0x8e, 0x0d, 0xff, 0x02, 0xb4, 0x8e, 0x0d, 0xfc, 0xb4, 0x8e, 0x0d, 0xdc, 0xb6, 0x8f, 
+  0x0f, 0x5b, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbb, 0x94, 0x12, 0x3f, 0xb6, 0x90, 0x0d, 0xa4, 0xb5, 0x8f, 0x0d, 0xe4, 0xb5, 0x8f, 0x0d, 0xfc, 0x93, 0xb5, 0x8f, 0x0d, 0xfb, 0x03, 0xb5, 0x8f, 
+  0x0d, 0xe8, 0xb5, 0x8e, 0x0d, 0xb7, 0xb7, 0x92, 0x10, 0x64, 0xbe, 0x96, 0x16, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +320,7 @@ const lv_img_dsc_t owm_03n_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_03n_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_03n_64px_map,
 };
-
@@ -10,271 +10,181 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_04D_64PX uint8_t owm_04d_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x3b, 0x07, 0x37, 0x23, 0x37, 0x78, 0x37, 0xb8, 0x37, 0xe8, 0x37, 0xff, 0x37, 0xff, 0x37, 0xe8, 0x37, 0xb8, 0x37, 0x78, 0x37, 0x23, 0x3b, 0x07, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x3f, 0x37, 0xbf, 0x33, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xf4, 0x37, 0xbf, 0x37, 0x3f, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x07, 0x37, 0x80, 0x33, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0x80, 0x3b, 0x07, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x07, 0x37, 0xb7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xb7, 0x5f, 0x04, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x5f, 0x00, 0x37, 0xa3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xcb, 0x37, 0xbb, 0x37, 0xf0, 0x37, 0xff, 0x37, 0xfc, 0x37, 0xd3, 0x37, 0x93, 0x37, 0x3f, 0x3b, 0x0c, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x37, 0x74, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xfb, 0x37, 0xd3, 0x3b, 0x4b, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x20, 0x33, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0x7c, 0x5b, 0x04, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x87, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x90, 0x3b, 0x04, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x37, 0x00, 0x02, 0x00, 0x33, 0xe8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x37, 0x57, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3b, 0x2c, 0x3b, 0x7b, 0x3b, 0xb0, 0x37, 0xcf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xe8, 0x3b, 0x18, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x3b, 0x20, 0x37, 0xa3, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x80, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x3b, 0x37, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xdb, 0x3b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x20, 0x37, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x37, 0xa3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x2c, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x7b, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x28, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xb0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xa3, 0x37, 0x37, 0x3b, 0x04, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xc4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xf7, 0x37, 0xa7, 0x3b, 0x10, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xa0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc7, 0x37, 0x17, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x63, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xac, 0x37, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x13, 0x13, 0xf3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x5c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x74, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xcc, 0x3b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x08, 0x13, 0xc3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x37, 0x08, 0x13, 0xa8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x5c, 0x13, 0xd7, 0x13, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x17, 0x0b, 0x13, 0x1f, 0x13, 0x2c, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x27, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x37, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xe0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x7b, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xaf, 0x0a, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x37, 0x17, 0x13, 0xdb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x37, 0x18, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x37, 0x20, 0x13, 0xd7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x9c, 0x37, 0x13, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x08, 0x13, 0x90, 0x13, 0xe4, 0x13, 0xf8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0xec, 0x13, 0xbc, 0x13, 0x47, 0x13, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x37, 0x00, 0x37, 0x04, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x03, 0x17, 0x18, 0x13, 0x28, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2c, 0x13, 0x2b, 0x13, 0x28, 0x13, 0x28, 0x13, 0x28, 0x13, 0x28, 0x13, 0x2b, 0x13, 0x2c, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x28, 0x13, 0x1c, 0x37, 0x0b, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x33, 0x00, 0x13, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x0f, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x03, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x17, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x13, 0x00, 0x13, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x37, 0x00, 0x33, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x13, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x5f, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x03, 0x13, 0x07, 0x13, 0x04, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x95, 0x00, 0x00, 0x04, 0x3b, 0x07, 0x37, 0x23, 0x37, 0x78, 0x37, 0xb8, 0x37, 0xe8, 0x81, 0x37, 
+  0xff, 0x04, 0x37, 0xe8, 0x37, 0xb8, 0x37, 0x78, 0x37, 0x23, 0x3b, 0x07, 0xb2, 0x00, 0x00, 0x02, 0x37, 0x3f, 0x37, 0xbf, 0x33, 0xf4, 0x82, 0x13, 0xff, 0x81, 0x0f, 0xff, 0x82, 0x13, 0xff, 0x02, 
+  0x33, 0xf4, 0x37, 0xbf, 0x37, 0x3f, 0xaf, 0x00, 0x00, 0x04, 0x3b, 0x07, 0x37, 0x80, 0x33, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x87, 0x13, 0xff, 0x04, 0x0f, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0x80, 
+  0x3b, 0x07, 0xac, 0x00, 0x00, 0x01, 0x3b, 0x07, 0x37, 0xb7, 0x8f, 0x13, 0xff, 0x01, 0x37, 0xb7, 0x5f, 0x04, 0xab, 0x00, 0x00, 0x00, 0x37, 0xa3, 0x91, 0x13, 0xff, 0x08, 0x37, 0xcb, 0x37, 0xbb, 
+  0x37, 0xf0, 0x37, 0xff, 0x37, 0xfc, 0x37, 0xd3, 0x37, 0x93, 0x37, 0x3f, 0x3b, 0x0c, 0xa2, 0x00, 0x00, 0x00, 0x37, 0x74, 0x99, 0x13, 0xff, 0x02, 0x33, 0xfb, 0x37, 0xd3, 0x3b, 0x4b, 0xa0, 0x00, 
+  0x00, 0x01, 0x37, 0x20, 0x33, 0xf0, 0x9b, 0x13, 0xff, 0x02, 0x33, 0xff, 0x37, 0x7c, 0x5b, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x37, 0x87, 0x9e, 0x13, 0xff, 0x01, 0x37, 0x90, 0x3b, 0x04, 0x9d, 0x00, 
+  0x00, 0x00, 0x33, 0xe8, 0x9e, 0x13, 0xff, 0x01, 0x13, 0xfb, 0x37, 0x57, 0x99, 0x00, 0x00, 0x03, 0x3b, 0x2c, 0x3b, 0x7b, 0x3b, 0xb0, 0x37, 0xcf, 0xa0, 0x13, 0xff, 0x01, 0x37, 0xe8, 0x3b, 0x18, 
+  0x96, 0x00, 0x00, 0x03, 0x3b, 0x20, 0x37, 0xa3, 0x37, 0xff, 0x33, 0xff, 0xa3, 0x13, 0xff, 0x00, 0x37, 0x80, 0x95, 0x00, 0x00, 0x01, 0x3b, 0x3b, 0x37, 0xec, 0xa6, 0x13, 0xff, 0x01, 0x33, 0xdb, 
+  0x3b, 0x0c, 0x93, 0x00, 0x00, 0x01, 0x3b, 0x20, 0x37, 0xec, 0x9a, 0x13, 0xff, 0x81, 0x33, 0xff, 0x8a, 0x13, 0xff, 0x01, 0x13, 0xef, 0x37, 0x1f, 0x93, 0x00, 0x00, 0x00, 0x37, 0xa3, 0x98, 0x13, 
+  0xff, 0x81, 0x37, 0xff, 0x84, 0x33, 0xff, 0x81, 0x37, 0xff, 0x86, 0x13, 0xff, 0x01, 0x13, 0xfc, 0x37, 0x2b, 0x92, 0x00, 0x00, 0x01, 0x3b, 0x2c, 0x33, 0xff, 0x96, 0x13, 0xff, 0x02, 0x33, 0xff, 
+  0x37, 0xff, 0x13, 0xff, 0x81, 0x0f, 0xff, 0x81, 0x13, 0xff, 0x82, 0x0f, 0xff, 0x02, 0x13, 0xff, 0x37, 0xff, 0x33, 0xff, 0x85, 0x13, 0xff, 0x00, 0x13, 0x33, 0x92, 0x00, 0x00, 0x00, 0x37, 0x7b, 
+  0x96, 0x13, 0xff, 0x00, 0x37, 0xff, 0x8b, 0x13, 0xff, 0x01, 0x33, 0xff, 0x37, 0xff, 0x84, 0x13, 0xff, 0x00, 0x13, 0x28, 0x92, 0x00, 0x00, 0x00, 0x37, 0xb0, 0x95, 0x13, 0xff, 0x00, 0x37, 0xff, 
+  0x8e, 0x13, 0xff, 0x84, 0x37, 0xff, 0x02, 0x37, 0xa3, 0x37, 0x37, 0x3b, 0x04, 0x90, 0x00, 0x00, 0x00, 0x13, 0xc4, 0x94, 0x13, 0xff, 0x00, 0x37, 0xff, 0x95, 0x13, 0xff, 0x02, 0x33, 0xf7, 0x37, 
+  0xa7, 0x3b, 0x10, 0x8f, 0x00, 0x00, 0x00, 0x13, 0xa0, 0x94, 0x13, 0xff, 0x00, 0x33, 0xff, 0x97, 0x13, 0xff, 0x01, 0x37, 0xc7, 0x37, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x37, 0x63, 0xae, 0x13, 0xff, 
+  0x00, 0x37, 0xac, 0x8e, 0x00, 0x00, 0x01, 0x3b, 0x13, 0x13, 0xf3, 0x8f, 0x13, 0xff, 0x83, 0x37, 0xff, 0x9a, 0x13, 0xff, 0x00, 0x37, 0x5c, 0x8e, 0x00, 0x00, 0x00, 0x37, 0x74, 0x8e, 0x13, 0xff, 
+  0x81, 0x37, 0xff, 0x9d, 0x13, 0xff, 0x01, 0x33, 0xcc, 0x3b, 0x08, 0x8d, 0x00, 0x00, 0x01, 0x17, 0x08, 0x13, 0xc3, 0x8c, 0x13, 0xff, 0x00, 0x37, 0xff, 0x9f, 0x13, 0xff, 0x01, 0x13, 0xef, 0x37, 
+  0x1c, 0x8e, 0x00, 0x00, 0x01, 0x37, 0x08, 0x13, 0xa8, 0x8a, 0x13, 0xff, 0x00, 0x37, 0xff, 0xa0, 0x13, 0xff, 0x01, 0x13, 0xfc, 0x37, 0x2b, 0x90, 0x00, 0x00, 0x02, 0x13, 0x5c, 0x13, 0xd7, 0x13, 
+  0xf0, 0x87, 0x13, 0xff, 0x00, 0x37, 0xff, 0xa1, 0x13, 0xff, 0x00, 0x13, 0x30, 0x91, 0x00, 0x00, 0x02, 0x17, 0x0b, 0x13, 0x1f, 0x13, 0x2c, 0x85, 0x13, 0x34, 0x01, 0x13, 0x27, 0x33, 0xff, 0xa0, 
+  0x13, 0xff, 0x01, 0x13, 0xfc, 0x13, 0x2b, 0x9b, 0x00, 0x00, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xef, 0x37, 0x1c, 0x9b, 0x00, 0x00, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xcf, 0x37, 0x08, 0x9b, 0x00, 0x00, 
+  0x00, 0x13, 0xe0, 0xa0, 0x13, 0xff, 0x00, 0x33, 0x5f, 0x9c, 0x00, 0x00, 0x00, 0x37, 0x7b, 0x9f, 0x13, 0xff, 0x00, 0x13, 0xaf, 0x9d, 0x00, 0x00, 0x01, 0x37, 0x17, 0x13, 0xdb, 0x9d, 0x13, 0xff, 
+  0x01, 0x13, 0xcf, 0x37, 0x18, 0x9e, 0x00, 0x00, 0x01, 0x37, 0x20, 0x13, 0xd7, 0x9b, 0x13, 0xff, 0x01, 0x13, 0x9c, 0x37, 0x13, 0xa0, 0x00, 0x00, 0x03, 0x37, 0x08, 0x13, 0x90, 0x13, 0xe4, 0x13, 
+  0xf8, 0x86, 0x13, 0xff, 0x82, 0x13, 0xfb, 0x00, 0x13, 0xfc, 0x89, 0x13, 0xff, 0x03, 0x13, 0xfb, 0x13, 0xec, 0x13, 0xbc, 0x13, 0x47, 0x9c, 0x00, 0x00, 0x00, 0x37, 0x04, 0x85, 0x00, 0x00, 0x02, 
+  0x37, 0x03, 0x17, 0x18, 0x13, 0x28, 0x84, 0x13, 0x2f, 0x01, 0x13, 0x2c, 0x13, 0x2b, 0x83, 0x13, 0x28, 0x01, 0x13, 0x2b, 0x13, 0x2c, 0x87, 0x13, 0x2f, 0x02, 0x13, 0x28, 0x13, 0x1c, 0x37, 0x0b, 
+  0xff, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x37, 0x03, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x85, 0x00, 
+  0x00, 0x02, 0x13, 0x03, 0x13, 0x07, 0x13, 0x04, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xce, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0xfe, 0x55, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0xfe, 0x55, 0x00, 0x5a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x25, 0x00, 0x7a, 0x25, 0x00, 0xbb, 0x25, 0x07, 0x7b, 0x25, 0x23, 0x39, 0x25, 0x78, 0x19, 0x1d, 0xb8, 0x19, 0x25, 0xe8, 0x19, 0x25, 0xff, 0x19, 0x25, 0xff, 0x19, 0x25, 0xe8, 0x19, 0x1d, 0xb8, 0x39, 0x25, 0x78, 0x7b, 0x25, 0x23, 0xbb, 0x25, 0x07, 0x7a, 0x25, 0x00, 0x7b, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x59, 0x25, 0x00, 0x9a, 0x25, 0x3f, 0x19, 0x1d, 0xbf, 0x57, 0x14, 0xf4, 0xd6, 0x13, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x13, 0xff, 0x57, 0x14, 0xf4, 0x19, 0x1d, 0xbf, 0x9a, 0x25, 0x3f, 0x59, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x1c, 0x2e, 0x07, 0x39, 0x25, 0x80, 0x98, 0x1c, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x98, 0x1c, 0xff, 0x39, 0x25, 0x80, 0x1c, 0x2e, 0x07, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x1c, 0x2e, 0x07, 0xf9, 0x1c, 0xb7, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x1c, 0xb7, 0x9d, 0x36, 0x04, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x25, 0x00, 0xdf, 0x3f, 0x00, 0x19, 0x1d, 0xa3, 0xd6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xf9, 0x1c, 0xcb, 0x39, 0x25, 0xbb, 0x39, 0x25, 0xf0, 0x19, 0x25, 0xff, 0x19, 0x25, 0xfc, 0x39, 0x25, 0xd3, 0x39, 0x25, 0x93, 0x7a, 0x25, 0x3f, 0x9b, 0x25, 0x0c, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, 0x39, 0x25, 0x74, 0x16, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x57, 0x14, 0xfb, 0x19, 0x1d, 0xd3, 0xbb, 0x25, 0x4b, 0x59, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x2d, 0x00, 0x7a, 0x25, 0x20, 0x57, 0x14, 0xf0, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x97, 0x14, 0xff, 0x39, 0x25, 0x7c, 0x3c, 0x36, 0x04, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x5a, 0x25, 0x00, 0xf9, 0x24, 0x87, 0xd6, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x39, 0x25, 0x90, 0x3c, 0x2e, 0x04, 0x7a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x9a, 0x2d, 0x00, 0x9a, 0x25, 0x00, 0x0d, 0x00, 0x00, 0x77, 0x14, 0xe8, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0x37, 0x14, 0xfb, 0x59, 0x25, 0x57, 0x7a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0xba, 0x25, 0x00, 0xdb, 0x2d, 0x2c, 0xbb, 0x2d, 0x7b, 0xbb, 0x2d, 0xb0, 0x7a, 0x25, 0xcf, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb8, 0x1c, 0xe8, 0x1c, 0x2e, 0x18, 0x9b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x2d, 0x00, 0xbb, 0x2d, 0x00, 0xba, 0x2d, 0x20, 0x7a, 0x25, 0xa3, 0xf8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x25, 0x80, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x2d, 0x00, 0xfb, 0x35, 0x3b, 0xf8, 0x1c, 0xec, 0x36, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 0xdb, 0xdc, 0x2d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x2d, 0x00, 0xba, 0x2d, 0x20, 0xd8, 0x1c, 0xec, 0xf5, 0x0b, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x14, 0xff, 0x36, 0x14, 0xff, 0x57, 0x14, 0xff, 0x57, 0x14, 0xff, 0x57, 0x14, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x2d, 0x00, 0x9a, 0x25, 0x00, 0x39, 0x25, 0xa3, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x37, 0x14, 0xff, 0x16, 0x14, 0xff, 0x37, 0x14, 0xff, 0x77, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x2d, 0x00, 0xfb, 0x2d, 0x2c, 0x97, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xb8, 0x1c, 0xff, 0x97, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x25, 0x00, 0x39, 0x25, 0x7b, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xd8, 0x1c, 0xff, 0x17, 0x14, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x37, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xf5, 0x0b, 0x28, 0x3a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x1c, 0x00, 0xb7, 0x1c, 0xb0, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0x19, 0x1d, 0xa3, 0x5a, 0x25, 0x37, 0xdb, 0x2d, 0x04, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0xc4, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0x57, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 0xf7, 0x5a, 0x25, 0xa7, 0xda, 0x25, 0x10, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0xa0, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xff, 0x97, 0x1c, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x24, 0xc7, 0x7a, 0x25, 0x17, 0x7a, 0x2d, 0x00, 0x5a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x1c, 0x00, 0xd8, 0x1c, 0x63, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x16, 0x14, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x25, 0xac, 0x78, 0x15, 0x00, 0x3c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0x00, 0xda, 0x2d, 0x13, 0x76, 0x14, 0xf3, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0xb7, 0x14, 0xff, 0xf8, 0x1c, 0xff, 0x19, 0x1d, 0xff, 0xf8, 0x1c, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xff, 0x7a, 0x25, 0x5c, 0x39, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x25, 0x00, 0xf8, 0x1c, 0x00, 0xb7, 0x14, 0x74, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x0c, 0xff, 0x19, 0x1d, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x97, 0x14, 0xcc, 0x1c, 0x2e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1d, 0x00, 0xd7, 0x14, 0x08, 0x77, 0x14, 0xc3, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xff, 0x19, 0x1d, 0xff, 0x57, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x08, 0x76, 0x14, 0xa8, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0xd7, 0x14, 0xff, 0x56, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x5c, 0x97, 0x14, 0xd7, 0x97, 0x14, 0xf0, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x76, 0x0c, 0xff, 0xd8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x0b, 0x97, 0x14, 0x1f, 0x97, 0x14, 0x2c, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x96, 0x0c, 0x27, 0x77, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xfc, 0x56, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0c, 0x00, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0xef, 0xb7, 0x14, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0c, 0x00, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xcf, 0x79, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0xe0, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x97, 0x14, 0x5f, 0x97, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1c, 0x00, 0xb7, 0x14, 0x7b, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xaf, 0xb2, 0x01, 0x00, 0x38, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x25, 0x00, 0xd8, 0x14, 0x17, 0x77, 0x14, 0xdb, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xcf, 0x17, 0x1d, 0x18, 0x79, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0xf5, 0x0b, 0x00, 0xb7, 0x14, 0x20, 0x76, 0x14, 0xd7, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0x9c, 0xf7, 0x1c, 0x13, 0x55, 0x0c, 0x00, 0x98, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x2c, 0x00, 0x3a, 0x0d, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1c, 0x00, 0x3a, 0x25, 0x00, 0xd9, 0x1c, 0x08, 0x97, 0x14, 0x90, 0x97, 0x0c, 0xe4, 0x97, 0x14, 0xf8, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfc, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xec, 0x97, 0x14, 0xbc, 0x97, 0x14, 0x47, 0x36, 0x04, 0x00, 0x17, 0x00, 0x00, 0xb7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x05, 0x00, 0x7a, 0x1d, 0x00, 0x7b, 0x25, 0x04, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x1c, 0x00, 0xd6, 0x1c, 0x00, 0x3a, 0x25, 0x03, 0x97, 0x14, 0x18, 0x97, 0x14, 0x28, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2c, 0x97, 0x14, 0x2b, 0x97, 0x14, 0x28, 0x97, 0x14, 0x28, 0x97, 0x14, 0x28, 0x97, 0x14, 0x28, 0x97, 0x14, 0x2b, 0x97, 0x14, 0x2c, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x28, 0x77, 0x14, 0x1c, 0xd7, 0x14, 0x0b, 0x14, 0x04, 0x00, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x1d, 0x00, 0x5a, 0x25, 0x00, 0x57, 0x14, 0x00, 0xbb, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0xfc, 0x2d, 0x00, 0x37, 0x14, 0x00, 0xd6, 0x0b, 0x00, 0xf9, 0x24, 0x00, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0xf8, 0x1c, 0x00, 0x16, 0x14, 0x00, 0xd6, 0x0b, 0x00, 0xb8, 0x1c, 0x00, 0x14, 0x03, 0x00, 0xba, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x7a, 0x2d, 0x00, 0x3a, 0x25, 0x00, 0x3a, 0x25, 0x03, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0x00, 0xf8, 0x1c, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0x9a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x45, 0x00, 0xb8, 0x14, 0x00, 0x98, 0x1c, 0x00, 0xd8, 0x1c, 0x00, 0x39, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x77, 0x14, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0xd8, 0x1c, 0x00, 0xb8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0xb5, 0x0b, 0x00, 0xf6, 0x0b, 0x00, 0x9a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x77, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x00, 0xf8, 0x1c, 0x00, 0xd7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x05, 0x00, 0x7b, 0x25, 0x00, 0x7b, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x00, 0x77, 0x14, 0x00, 0xf6, 0x0b, 0x00, 0xf6, 0x0b, 0x00, 0x97, 0x1c, 0x00, 0xfe, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x55, 0x04, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x97, 0x0c, 0x00, 0xb7, 0x14, 0x00, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x39, 0x1d, 0x00, 0xd8, 0x1c, 0x00, 0xd8, 0x1c, 0x00, 0x5a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1d, 0x00, 0x56, 0x14, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0x56, 0x14, 0x00, 0x59, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x77, 0x0c, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0xdb, 0x2d, 0x00, 0xf6, 0x13, 0x00, 0x36, 0x14, 0x00, 0x3c, 0x2e, 0x00, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x56, 0x0c, 0x00, 0x56, 0x0c, 0x00, 0x56, 0x0c, 0x00, 0x56, 0x14, 0x00, 0xb7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x87, 0x00, 0xb8, 0x1c, 0x00, 0xd5, 0x0b, 0x00, 0xd5, 0x0b, 0x00, 0xf9, 0x1c, 0x00, 0xf6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x1c, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x1b, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x15, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x25, 0x00, 0x56, 0x14, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0x57, 0x14, 0x00, 0xba, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x77, 0x14, 0x00, 0x97, 0x0c, 0x00, 0xb7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x1d, 0x00, 0x7b, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x56, 0x14, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x56, 0x14, 0x00, 0xd8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x5a, 0x25, 0x00, 0x57, 0x14, 0x00, 0x9a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x76, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x00, 0x76, 0x14, 0x00, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0x7a, 0x25, 0x00, 0xf9, 0x24, 0x00, 0xb5, 0x0b, 0x00, 0x77, 0x14, 0x00, 0x7d, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x77, 0x14, 0x00, 0x97, 0x0c, 0x00, 0xb7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0xbf, 0x47, 0x00, 0x77, 0x14, 0x00, 0xd6, 0x0b, 0x00, 0x16, 0x14, 0x00, 0x19, 0x25, 0x00, 0xba, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x77, 0x14, 0x00, 0x77, 0x0c, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0x00, 0x59, 0x25, 0x00, 0xf6, 0x0b, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0x19, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x97, 0x14, 0x00, 0xb8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x00, 0x97, 0x14, 0x00, 0xd7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x76, 0x14, 0x03, 0x76, 0x14, 0x07, 0x77, 0x14, 0x04, 0xf6, 0x03, 0x00, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x77, 0x14, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x04, 0xbb, 0x25, 0x07, 0x7b, 0x25, 0x23, 0x39, 
+  0x25, 0x78, 0x19, 0x1d, 0xb8, 0x19, 0x25, 0xe8, 0x81, 0x19, 0x25, 0xff, 0x04, 0x19, 0x25, 0xe8, 0x19, 0x1d, 0xb8, 0x39, 0x25, 0x78, 0x7b, 0x25, 0x23, 0xbb, 0x25, 0x07, 0xb2, 0x00, 0x00, 0x00, 
+  0x04, 0x9a, 0x25, 0x3f, 0x19, 0x1d, 0xbf, 0x57, 0x14, 0xf4, 0xd6, 0x13, 0xff, 0xb5, 0x0b, 0xff, 0x83, 0x95, 0x0b, 0xff, 0x04, 0xb5, 0x0b, 0xff, 0xd6, 0x13, 0xff, 0x57, 0x14, 0xf4, 0x19, 0x1d, 
+  0xbf, 0x9a, 0x25, 0x3f, 0xaf, 0x00, 0x00, 0x00, 0x03, 0x1c, 0x2e, 0x07, 0x39, 0x25, 0x80, 0x98, 0x1c, 0xff, 0xb5, 0x0b, 0xff, 0x89, 0x95, 0x0b, 0xff, 0x03, 0xb5, 0x0b, 0xff, 0x98, 0x1c, 0xff, 
+  0x39, 0x25, 0x80, 0x1c, 0x2e, 0x07, 0xac, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x2e, 0x07, 0xf9, 0x1c, 0xb7, 0xf6, 0x13, 0xff, 0x8d, 0x95, 0x0b, 0xff, 0x02, 0xf6, 0x13, 0xff, 0xf9, 0x1c, 0xb7, 0x9d, 
+  0x36, 0x04, 0xab, 0x00, 0x00, 0x00, 0x01, 0x19, 0x1d, 0xa3, 0xd6, 0x0b, 0xff, 0x8f, 0xb5, 0x0b, 0xff, 0x09, 0xd6, 0x0b, 0xff, 0xf9, 0x1c, 0xcb, 0x39, 0x25, 0xbb, 0x39, 0x25, 0xf0, 0x19, 0x25, 
+  0xff, 0x19, 0x25, 0xfc, 0x39, 0x25, 0xd3, 0x39, 0x25, 0x93, 0x7a, 0x25, 0x3f, 0x9b, 0x25, 0x0c, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x39, 0x25, 0x74, 0x16, 0x14, 0xff, 0x91, 0xb5, 0x0b, 0xff, 0x81, 
+  0xd6, 0x0b, 0xff, 0x82, 0xb5, 0x0b, 0xff, 0x04, 0xd6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x57, 0x14, 0xfb, 0x19, 0x1d, 0xd3, 0xbb, 0x25, 0x4b, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x7a, 0x25, 0x20, 0x57, 
+  0x14, 0xf0, 0x9b, 0xb5, 0x0b, 0xff, 0x02, 0x97, 0x14, 0xff, 0x39, 0x25, 0x7c, 0x3c, 0x36, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xf9, 0x24, 0x87, 0xd6, 0x0b, 0xff, 0x9b, 0xd5, 0x0b, 0xff, 0x03, 
+  0xb5, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x39, 0x25, 0x90, 0x3c, 0x2e, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x77, 0x14, 0xe8, 0x9e, 0xd5, 0x0b, 0xff, 0x01, 0x37, 0x14, 0xfb, 0x59, 0x25, 0x57, 0x99, 
+  0x00, 0x00, 0x00, 0x03, 0xdb, 0x2d, 0x2c, 0xbb, 0x2d, 0x7b, 0xbb, 0x2d, 0xb0, 0x7a, 0x25, 0xcf, 0xa0, 0xd6, 0x0b, 0xff, 0x01, 0xb8, 0x1c, 0xe8, 0x1c, 0x2e, 0x18, 0x96, 0x00, 0x00, 0x00, 0x05, 
+  0xba, 0x2d, 0x20, 0x7a, 0x25, 0xa3, 0xf8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xa1, 0xf6, 0x0b, 0xff, 0x00, 0x19, 0x25, 0x80, 0x95, 0x00, 0x00, 0x00, 0x02, 0xfb, 
+  0x35, 0x3b, 0xf8, 0x1c, 0xec, 0x36, 0x14, 0xff, 0xa5, 0xf6, 0x0b, 0xff, 0x01, 0x77, 0x14, 0xdb, 0xdc, 0x2d, 0x0c, 0x93, 0x00, 0x00, 0x00, 0x02, 0xba, 0x2d, 0x20, 0xd8, 0x1c, 0xec, 0xf5, 0x0b, 
+  0xff, 0x97, 0x16, 0x0c, 0xff, 0x01, 0x16, 0x14, 0xff, 0x36, 0x14, 0xff, 0x82, 0x57, 0x14, 0xff, 0x00, 0x36, 0x14, 0xff, 0x88, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1f, 0x93, 
+  0x00, 0x00, 0x00, 0x01, 0x39, 0x25, 0xa3, 0x36, 0x0c, 0xff, 0x96, 0x16, 0x0c, 0xff, 0x07, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x37, 0x14, 0xff, 0x16, 0x14, 
+  0xff, 0x37, 0x14, 0xff, 0x77, 0x14, 0xff, 0x81, 0xd8, 0x1c, 0xff, 0x00, 0x36, 0x14, 0xff, 0x85, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x92, 0x00, 0x00, 0x00, 0x01, 0xfb, 
+  0x2d, 0x2c, 0x97, 0x14, 0xff, 0x95, 0x16, 0x0c, 0xff, 0x03, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xf6, 0x13, 0xff, 0x85, 0x95, 0x0b, 0xff, 0x04, 0x75, 0x0b, 0xff, 0xf6, 0x13, 
+  0xff, 0xb8, 0x1c, 0xff, 0x97, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x83, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x33, 0x92, 0x00, 0x00, 0x00, 0x01, 0x39, 0x25, 0x7b, 0x16, 0x0c, 0xff, 
+  0x95, 0x36, 0x0c, 0xff, 0x01, 0xd8, 0x1c, 0xff, 0x17, 0x14, 0xff, 0x8a, 0x95, 0x0b, 0xff, 0x01, 0x37, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x81, 0x36, 0x0c, 0xff, 0x00, 0x36, 0x14, 0xff, 0x81, 0x36, 
+  0x0c, 0xff, 0x00, 0xf5, 0x0b, 0x28, 0x92, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x1c, 0xb0, 0x95, 0x36, 0x0c, 0xff, 0x02, 0x97, 0x14, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x8a, 0xb5, 0x0b, 0xff, 
+  0x01, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x84, 0xf9, 0x1c, 0xff, 0x02, 0x19, 0x1d, 0xa3, 0x5a, 0x25, 0x37, 0xdb, 0x2d, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0xc4, 0x93, 0x56, 0x0c, 
+  0xff, 0x02, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0x57, 0x14, 0xff, 0x8e, 0xb5, 0x0b, 0xff, 0x00, 0xd6, 0x0b, 0xff, 0x82, 0xb5, 0x0b, 0xff, 0x04, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 
+  0xf7, 0x5a, 0x25, 0xa7, 0xda, 0x25, 0x10, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0xa0, 0x93, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xff, 0x97, 0x1c, 0xff, 0x96, 0xb5, 0x0b, 0xff, 0x02, 0xf6, 
+  0x13, 0xff, 0xf9, 0x24, 0xc7, 0x7a, 0x25, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xd8, 0x1c, 0x63, 0x56, 0x0c, 0xff, 0x90, 0x56, 0x14, 0xff, 0x81, 0x56, 0x0c, 0xff, 0x01, 0x76, 0x14, 0xff, 0x16, 
+  0x14, 0xff, 0x97, 0xd5, 0x0b, 0xff, 0x01, 0xf6, 0x0b, 0xff, 0x19, 0x25, 0xac, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xda, 0x2d, 0x13, 0x76, 0x14, 0xf3, 0x8f, 0x76, 0x14, 0xff, 0x04, 0xb7, 0x14, 0xff, 
+  0xf8, 0x1c, 0xff, 0x19, 0x1d, 0xff, 0xf8, 0x1c, 0xff, 0xf6, 0x0b, 0xff, 0x98, 0xd6, 0x0b, 0xff, 0x01, 0x36, 0x14, 0xff, 0x7a, 0x25, 0x5c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x74, 0x8d, 
+  0x76, 0x14, 0xff, 0x04, 0x76, 0x0c, 0xff, 0x19, 0x1d, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x9a, 0xf6, 0x0b, 0xff, 0x02, 0xd6, 0x0b, 0xff, 0x97, 0x14, 0xcc, 0x1c, 0x2e, 
+  0x08, 0x8d, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x14, 0x08, 0x77, 0x14, 0xc3, 0x8b, 0x76, 0x14, 0xff, 0x02, 0x77, 0x14, 0xff, 0x19, 0x1d, 0xff, 0x57, 0x14, 0xff, 0x9e, 0xf6, 0x0b, 0xff, 0x01, 0x36, 
+  0x14, 0xef, 0x39, 0x25, 0x1c, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x97, 0x14, 0x08, 0x76, 0x14, 0xa8, 0x8a, 0x76, 0x14, 0xff, 0x01, 0xd7, 0x14, 0xff, 0x56, 0x14, 0xff, 0x9f, 0x16, 0x0c, 0xff, 0x01, 
+  0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x90, 0x00, 0x00, 0x00, 0x02, 0x97, 0x14, 0x5c, 0x97, 0x14, 0xd7, 0x97, 0x14, 0xf0, 0x86, 0x97, 0x14, 0xff, 0x01, 0x76, 0x0c, 0xff, 0xd8, 0x1c, 0xff, 0xa0, 
+  0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x30, 0x91, 0x00, 0x00, 0x00, 0x02, 0x97, 0x14, 0x0b, 0x97, 0x14, 0x1f, 0x97, 0x14, 0x2c, 0x85, 0x97, 0x14, 0x34, 0x01, 0x96, 0x0c, 0x27, 
+  0x77, 0x14, 0xff, 0xa0, 0x36, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xfc, 0x56, 0x14, 0x2b, 0x9b, 0x00, 0x00, 0x00, 0xa1, 0x36, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xef, 0xb7, 0x14, 0x1c, 0x9b, 0x00, 0x00, 
+  0x00, 0xa1, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xcf, 0x79, 0x25, 0x08, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0xe0, 0xa0, 0x56, 0x0c, 0xff, 0x00, 0x97, 0x14, 0x5f, 0x9c, 0x00, 0x00, 0x00, 
+  0x00, 0xb7, 0x14, 0x7b, 0x9f, 0x76, 0x14, 0xff, 0x00, 0x77, 0x14, 0xaf, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xd8, 0x14, 0x17, 0x77, 0x14, 0xdb, 0x9d, 0x76, 0x14, 0xff, 0x01, 0x77, 0x14, 0xcf, 0x17, 
+  0x1d, 0x18, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xb7, 0x14, 0x20, 0x76, 0x14, 0xd7, 0x9b, 0x76, 0x14, 0xff, 0x01, 0x77, 0x14, 0x9c, 0xf7, 0x1c, 0x13, 0xa0, 0x00, 0x00, 0x00, 0x03, 0xd9, 0x1c, 0x08, 
+  0x97, 0x14, 0x90, 0x97, 0x0c, 0xe4, 0x97, 0x14, 0xf8, 0x86, 0x97, 0x14, 0xff, 0x82, 0x97, 0x14, 0xfb, 0x00, 0x97, 0x14, 0xfc, 0x89, 0x97, 0x14, 0xff, 0x03, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xec, 
+  0x97, 0x14, 0xbc, 0x97, 0x14, 0x47, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x25, 0x04, 0x85, 0x00, 0x00, 0x00, 0x02, 0x3a, 0x25, 0x03, 0x97, 0x14, 0x18, 0x97, 0x14, 0x28, 0x84, 0x97, 0x14, 0x2f, 
+  0x01, 0x97, 0x14, 0x2c, 0x97, 0x14, 0x2b, 0x83, 0x97, 0x14, 0x28, 0x01, 0x97, 0x14, 0x2b, 0x97, 0x14, 0x2c, 0x87, 0x97, 0x14, 0x2f, 0x02, 0x97, 0x14, 0x28, 0x77, 0x14, 0x1c, 0xd7, 0x14, 0x0b, 
+  0xff, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x25, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x76, 0x14, 0x03, 0x76, 0x14, 0x07, 0x77, 0x14, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xce, 0x00, 
+  0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x55, 0xfe, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x55, 0xfe, 0x00, 0x2d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7b, 0x00, 0x25, 0x7a, 0x00, 0x25, 0xbb, 0x07, 0x25, 0x7b, 0x23, 0x25, 0x39, 0x78, 0x1d, 0x19, 0xb8, 0x25, 0x19, 0xe8, 0x25, 0x19, 0xff, 0x25, 0x19, 0xff, 0x25, 0x19, 0xe8, 0x1d, 0x19, 0xb8, 0x25, 0x39, 0x78, 0x25, 0x7b, 0x23, 0x25, 0xbb, 0x07, 0x25, 0x7a, 0x00, 0x25, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x59, 0x00, 0x25, 0x9a, 0x3f, 0x1d, 0x19, 0xbf, 0x14, 0x57, 0xf4, 0x13, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x13, 0xd6, 0xff, 0x14, 0x57, 0xf4, 0x1d, 0x19, 0xbf, 0x25, 0x9a, 0x3f, 0x25, 0x59, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x2e, 0x1c, 0x07, 0x25, 0x39, 0x80, 0x1c, 0x98, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x1c, 0x98, 0xff, 0x25, 0x39, 0x80, 0x2e, 0x1c, 0x07, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x2e, 0x1c, 0x07, 0x1c, 0xf9, 0xb7, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xf9, 0xb7, 0x36, 0x9d, 0x04, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x3f, 0xdf, 0x00, 0x1d, 0x19, 0xa3, 0x0b, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0xf9, 0xcb, 0x25, 0x39, 0xbb, 0x25, 0x39, 0xf0, 0x25, 0x19, 0xff, 0x25, 0x19, 0xfc, 0x25, 0x39, 0xd3, 0x25, 0x39, 0x93, 0x25, 0x7a, 0x3f, 0x25, 0x9b, 0x0c, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x25, 0x39, 0x74, 0x14, 0x16, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x57, 0xfb, 0x1d, 0x19, 0xd3, 0x25, 0xbb, 0x4b, 0x25, 0x59, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9b, 0x00, 0x25, 0x7a, 0x20, 0x14, 0x57, 0xf0, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x97, 0xff, 0x25, 0x39, 0x7c, 0x36, 0x3c, 0x04, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x24, 0xf9, 0x87, 0x0b, 0xd6, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x37, 0xff, 0x25, 0x39, 0x90, 0x2e, 0x3c, 0x04, 0x2d, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x2d, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x0d, 0x00, 0x14, 0x77, 0xe8, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x14, 0x37, 0xfb, 0x25, 0x59, 0x57, 0x25, 0x7a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9a, 0x00, 0x25, 0xba, 0x00, 0x2d, 0xdb, 0x2c, 0x2d, 0xbb, 0x7b, 0x2d, 0xbb, 0xb0, 0x25, 0x7a, 0xcf, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0xb8, 0xe8, 0x2e, 0x1c, 0x18, 0x2d, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xba, 0x00, 0x2d, 0xbb, 0x00, 0x2d, 0xba, 0x20, 0x25, 0x7a, 0xa3, 0x1c, 0xf8, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x19, 0x80, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xbb, 0x00, 0x35, 0xfb, 0x3b, 0x1c, 0xf8, 0xec, 0x14, 0x36, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 0xdb, 0x2d, 0xdc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xda, 0x00, 0x2d, 0xba, 0x20, 0x1c, 0xd8, 0xec, 0x0b, 0xf5, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x16, 0xff, 0x14, 0x36, 0xff, 0x14, 0x57, 0xff, 0x14, 0x57, 0xff, 0x14, 0x57, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xbb, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x39, 0xa3, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x57, 0xff, 0x14, 0x37, 0xff, 0x14, 0x16, 0xff, 0x14, 0x37, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xba, 0x00, 0x2d, 0xfb, 0x2c, 0x14, 0x97, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xb8, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x97, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x19, 0x00, 0x25, 0x39, 0x7b, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x17, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x37, 0xff, 0x1c, 0xb8, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0b, 0xf5, 0x28, 0x25, 0x3a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb7, 0x00, 0x1c, 0xb7, 0xb0, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1d, 0x19, 0xa3, 0x25, 0x5a, 0x37, 0x2d, 0xdb, 0x04, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0xc4, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 0xf7, 0x25, 0x5a, 0xa7, 0x25, 0xda, 0x10, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0xa0, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xff, 0x1c, 0x97, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x24, 0xf9, 0xc7, 0x25, 0x7a, 0x17, 0x2d, 0x7a, 0x00, 0x2d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd7, 0x00, 0x1c, 0xd8, 0x63, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x76, 0xff, 0x14, 0x16, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x19, 0xac, 0x15, 0x78, 0x00, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x39, 0x00, 0x2d, 0xda, 0x13, 0x14, 0x76, 0xf3, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0xb7, 0xff, 0x1c, 0xf8, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xf8, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xff, 0x25, 0x7a, 0x5c, 0x25, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x38, 0x00, 0x1c, 0xf8, 0x00, 0x14, 0xb7, 0x74, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x97, 0xcc, 0x2e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x18, 0x00, 0x14, 0xd7, 0x08, 0x14, 0x77, 0xc3, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xff, 0x1d, 0x19, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x08, 0x14, 0x76, 0xa8, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0xd7, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x5c, 0x14, 0x97, 0xd7, 0x14, 0x97, 0xf0, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x0c, 0x76, 0xff, 0x1c, 0xd8, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd7, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x0b, 0x14, 0x97, 0x1f, 0x14, 0x97, 0x2c, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x0c, 0x96, 0x27, 0x14, 0x77, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xfc, 0x14, 0x56, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0xef, 0x14, 0xb7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xcf, 0x25, 0x79, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0xe0, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x97, 0x5f, 0x1c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x14, 0xb7, 0x7b, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xaf, 0x01, 0xb2, 0x00, 0x1d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xda, 0x00, 0x14, 0xd8, 0x17, 0x14, 0x77, 0xdb, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xcf, 0x1d, 0x17, 0x18, 0x36, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x00, 0x0b, 0xf5, 0x00, 0x14, 0xb7, 0x20, 0x14, 0x76, 0xd7, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0x9c, 0x1c, 0xf7, 0x13, 0x0c, 0x55, 0x00, 0x25, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xf9, 0x00, 0x0d, 0x3a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x25, 0x3a, 0x00, 0x1c, 0xd9, 0x08, 0x14, 0x97, 0x90, 0x0c, 0x97, 0xe4, 0x14, 0x97, 0xf8, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfc, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xec, 0x14, 0x97, 0xbc, 0x14, 0x97, 0x47, 0x04, 0x36, 0x00, 0x00, 0x17, 0x00, 0x25, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x58, 0x00, 0x1d, 0x7a, 0x00, 0x25, 0x7b, 0x04, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd9, 0x00, 0x1c, 0xd6, 0x00, 0x25, 0x3a, 0x03, 0x14, 0x97, 0x18, 0x14, 0x97, 0x28, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2c, 0x14, 0x97, 0x2b, 0x14, 0x97, 0x28, 0x14, 0x97, 0x28, 0x14, 0x97, 0x28, 0x14, 0x97, 0x28, 0x14, 0x97, 0x2b, 0x14, 0x97, 0x2c, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x28, 0x14, 0x77, 0x1c, 0x14, 0xd7, 0x0b, 0x04, 0x14, 0x00, 0x24, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x39, 0x00, 0x25, 0x5a, 0x00, 0x14, 0x57, 0x00, 0x25, 0xbb, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x00, 0x2d, 0xfc, 0x00, 0x14, 0x37, 0x00, 0x0b, 0xd6, 0x00, 0x24, 0xf9, 0x00, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9a, 0x00, 0x1c, 0xf8, 0x00, 0x14, 0x16, 0x00, 0x0b, 0xd6, 0x00, 0x1c, 0xb8, 0x00, 0x03, 0x14, 0x00, 0x2d, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x2d, 0x7a, 0x00, 0x25, 0x3a, 0x00, 0x25, 0x3a, 0x03, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x39, 0x00, 0x1c, 0xf8, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x5d, 0x00, 0x14, 0xb8, 0x00, 0x1c, 0x98, 0x00, 0x1c, 0xd8, 0x00, 0x25, 0x39, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x1c, 0xd8, 0x00, 0x1c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x3a, 0x00, 0x25, 0x5a, 0x00, 0x0b, 0xb5, 0x00, 0x0b, 0xf6, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x77, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x00, 0x1c, 0xf8, 0x00, 0x1c, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x58, 0x00, 0x25, 0x7b, 0x00, 0x25, 0x7b, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3c, 0x00, 0x14, 0x77, 0x00, 0x0b, 0xf6, 0x00, 0x0b, 0xf6, 0x00, 0x1c, 0x97, 0x00, 0x3e, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x04, 0x55, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x0c, 0x97, 0x00, 0x14, 0xb7, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x48, 0x00, 0x1d, 0x39, 0x00, 0x1c, 0xd8, 0x00, 0x1c, 0xd8, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x18, 0x00, 0x14, 0x56, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x14, 0x56, 0x00, 0x25, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x0c, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x2d, 0xdb, 0x00, 0x13, 0xf6, 0x00, 0x14, 0x36, 0x00, 0x2e, 0x3c, 0x00, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x56, 0x00, 0x14, 0x56, 0x00, 0x14, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x00, 0x1c, 0xb8, 0x00, 0x0b, 0xd5, 0x00, 0x0b, 0xd5, 0x00, 0x1c, 0xf9, 0x00, 0x03, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd8, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x36, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x59, 0x00, 0x14, 0x56, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x14, 0x57, 0x00, 0x2d, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x97, 0x00, 0x14, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7a, 0x00, 0x25, 0x7b, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x56, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x14, 0x56, 0x00, 0x1c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x48, 0x00, 0x25, 0x5a, 0x00, 0x14, 0x57, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x76, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x00, 0x14, 0x76, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x00, 0x25, 0x7a, 0x00, 0x24, 0xf9, 0x00, 0x0b, 0xb5, 0x00, 0x14, 0x77, 0x00, 0x36, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x97, 0x00, 0x14, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9a, 0x00, 0x47, 0xbf, 0x00, 0x14, 0x77, 0x00, 0x0b, 0xd6, 0x00, 0x14, 0x16, 0x00, 0x25, 0x19, 0x00, 0x2d, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x39, 0x00, 0x25, 0x59, 0x00, 0x0b, 0xf6, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x25, 0x19, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x14, 0x97, 0x00, 0x1c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x00, 0x14, 0x97, 0x00, 0x1c, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x76, 0x03, 0x14, 0x76, 0x07, 0x14, 0x77, 0x04, 0x03, 0xf6, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x04, 0x25, 0xbb, 0x07, 0x25, 0x7b, 0x23, 0x25, 
+  0x39, 0x78, 0x1d, 0x19, 0xb8, 0x25, 0x19, 0xe8, 0x81, 0x25, 0x19, 0xff, 0x04, 0x25, 0x19, 0xe8, 0x1d, 0x19, 0xb8, 0x25, 0x39, 0x78, 0x25, 0x7b, 0x23, 0x25, 0xbb, 0x07, 0xb2, 0x00, 0x00, 0x00, 
+  0x04, 0x25, 0x9a, 0x3f, 0x1d, 0x19, 0xbf, 0x14, 0x57, 0xf4, 0x13, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x83, 0x0b, 0x95, 0xff, 0x04, 0x0b, 0xb5, 0xff, 0x13, 0xd6, 0xff, 0x14, 0x57, 0xf4, 0x1d, 0x19, 
+  0xbf, 0x25, 0x9a, 0x3f, 0xaf, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x1c, 0x07, 0x25, 0x39, 0x80, 0x1c, 0x98, 0xff, 0x0b, 0xb5, 0xff, 0x89, 0x0b, 0x95, 0xff, 0x03, 0x0b, 0xb5, 0xff, 0x1c, 0x98, 0xff, 
+  0x25, 0x39, 0x80, 0x2e, 0x1c, 0x07, 0xac, 0x00, 0x00, 0x00, 0x02, 0x2e, 0x1c, 0x07, 0x1c, 0xf9, 0xb7, 0x13, 0xf6, 0xff, 0x8d, 0x0b, 0x95, 0xff, 0x02, 0x13, 0xf6, 0xff, 0x1c, 0xf9, 0xb7, 0x36, 
+  0x9d, 0x04, 0xab, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x19, 0xa3, 0x0b, 0xd6, 0xff, 0x8f, 0x0b, 0xb5, 0xff, 0x09, 0x0b, 0xd6, 0xff, 0x1c, 0xf9, 0xcb, 0x25, 0x39, 0xbb, 0x25, 0x39, 0xf0, 0x25, 0x19, 
+  0xff, 0x25, 0x19, 0xfc, 0x25, 0x39, 0xd3, 0x25, 0x39, 0x93, 0x25, 0x7a, 0x3f, 0x25, 0x9b, 0x0c, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x25, 0x39, 0x74, 0x14, 0x16, 0xff, 0x91, 0x0b, 0xb5, 0xff, 0x81, 
+  0x0b, 0xd6, 0xff, 0x82, 0x0b, 0xb5, 0xff, 0x04, 0x0b, 0xd6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x57, 0xfb, 0x1d, 0x19, 0xd3, 0x25, 0xbb, 0x4b, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x25, 0x7a, 0x20, 0x14, 
+  0x57, 0xf0, 0x9b, 0x0b, 0xb5, 0xff, 0x02, 0x14, 0x97, 0xff, 0x25, 0x39, 0x7c, 0x36, 0x3c, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x01, 0x24, 0xf9, 0x87, 0x0b, 0xd6, 0xff, 0x9b, 0x0b, 0xd5, 0xff, 0x03, 
+  0x0b, 0xb5, 0xff, 0x14, 0x37, 0xff, 0x25, 0x39, 0x90, 0x2e, 0x3c, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 0xe8, 0x9e, 0x0b, 0xd5, 0xff, 0x01, 0x14, 0x37, 0xfb, 0x25, 0x59, 0x57, 0x99, 
+  0x00, 0x00, 0x00, 0x03, 0x2d, 0xdb, 0x2c, 0x2d, 0xbb, 0x7b, 0x2d, 0xbb, 0xb0, 0x25, 0x7a, 0xcf, 0xa0, 0x0b, 0xd6, 0xff, 0x01, 0x1c, 0xb8, 0xe8, 0x2e, 0x1c, 0x18, 0x96, 0x00, 0x00, 0x00, 0x05, 
+  0x2d, 0xba, 0x20, 0x25, 0x7a, 0xa3, 0x1c, 0xf8, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd5, 0xff, 0xa1, 0x0b, 0xf6, 0xff, 0x00, 0x25, 0x19, 0x80, 0x95, 0x00, 0x00, 0x00, 0x02, 0x35, 
+  0xfb, 0x3b, 0x1c, 0xf8, 0xec, 0x14, 0x36, 0xff, 0xa5, 0x0b, 0xf6, 0xff, 0x01, 0x14, 0x77, 0xdb, 0x2d, 0xdc, 0x0c, 0x93, 0x00, 0x00, 0x00, 0x02, 0x2d, 0xba, 0x20, 0x1c, 0xd8, 0xec, 0x0b, 0xf5, 
+  0xff, 0x97, 0x0c, 0x16, 0xff, 0x01, 0x14, 0x16, 0xff, 0x14, 0x36, 0xff, 0x82, 0x14, 0x57, 0xff, 0x00, 0x14, 0x36, 0xff, 0x88, 0x0c, 0x16, 0xff, 0x01, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1f, 0x93, 
+  0x00, 0x00, 0x00, 0x01, 0x25, 0x39, 0xa3, 0x0c, 0x36, 0xff, 0x96, 0x0c, 0x16, 0xff, 0x07, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x57, 0xff, 0x14, 0x37, 0xff, 0x14, 0x16, 
+  0xff, 0x14, 0x37, 0xff, 0x14, 0x77, 0xff, 0x81, 0x1c, 0xd8, 0xff, 0x00, 0x14, 0x36, 0xff, 0x85, 0x0c, 0x16, 0xff, 0x01, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x92, 0x00, 0x00, 0x00, 0x01, 0x2d, 
+  0xfb, 0x2c, 0x14, 0x97, 0xff, 0x95, 0x0c, 0x16, 0xff, 0x03, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xb8, 0xff, 0x13, 0xf6, 0xff, 0x85, 0x0b, 0x95, 0xff, 0x04, 0x0b, 0x75, 0xff, 0x13, 0xf6, 
+  0xff, 0x1c, 0xb8, 0xff, 0x14, 0x97, 0xff, 0x0c, 0x36, 0xff, 0x83, 0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x33, 0x92, 0x00, 0x00, 0x00, 0x01, 0x25, 0x39, 0x7b, 0x0c, 0x16, 0xff, 
+  0x95, 0x0c, 0x36, 0xff, 0x01, 0x1c, 0xd8, 0xff, 0x14, 0x17, 0xff, 0x8a, 0x0b, 0x95, 0xff, 0x01, 0x14, 0x37, 0xff, 0x1c, 0xb8, 0xff, 0x81, 0x0c, 0x36, 0xff, 0x00, 0x14, 0x36, 0xff, 0x81, 0x0c, 
+  0x36, 0xff, 0x00, 0x0b, 0xf5, 0x28, 0x92, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb7, 0xb0, 0x95, 0x0c, 0x36, 0xff, 0x02, 0x14, 0x97, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x8a, 0x0b, 0xb5, 0xff, 
+  0x01, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x84, 0x1c, 0xf9, 0xff, 0x02, 0x1d, 0x19, 0xa3, 0x25, 0x5a, 0x37, 0x2d, 0xdb, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0xc4, 0x93, 0x0c, 0x56, 
+  0xff, 0x02, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x14, 0x57, 0xff, 0x8e, 0x0b, 0xb5, 0xff, 0x00, 0x0b, 0xd6, 0xff, 0x82, 0x0b, 0xb5, 0xff, 0x04, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 
+  0xf7, 0x25, 0x5a, 0xa7, 0x25, 0xda, 0x10, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0xa0, 0x93, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xff, 0x1c, 0x97, 0xff, 0x96, 0x0b, 0xb5, 0xff, 0x02, 0x13, 
+  0xf6, 0xff, 0x24, 0xf9, 0xc7, 0x25, 0x7a, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x1c, 0xd8, 0x63, 0x0c, 0x56, 0xff, 0x90, 0x14, 0x56, 0xff, 0x81, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x76, 0xff, 0x14, 
+  0x16, 0xff, 0x97, 0x0b, 0xd5, 0xff, 0x01, 0x0b, 0xf6, 0xff, 0x25, 0x19, 0xac, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x2d, 0xda, 0x13, 0x14, 0x76, 0xf3, 0x8f, 0x14, 0x76, 0xff, 0x04, 0x14, 0xb7, 0xff, 
+  0x1c, 0xf8, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xf8, 0xff, 0x0b, 0xf6, 0xff, 0x98, 0x0b, 0xd6, 0xff, 0x01, 0x14, 0x36, 0xff, 0x25, 0x7a, 0x5c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x74, 0x8d, 
+  0x14, 0x76, 0xff, 0x04, 0x0c, 0x76, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x9a, 0x0b, 0xf6, 0xff, 0x02, 0x0b, 0xd6, 0xff, 0x14, 0x97, 0xcc, 0x2e, 0x1c, 
+  0x08, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x14, 0xd7, 0x08, 0x14, 0x77, 0xc3, 0x8b, 0x14, 0x76, 0xff, 0x02, 0x14, 0x77, 0xff, 0x1d, 0x19, 0xff, 0x14, 0x57, 0xff, 0x9e, 0x0b, 0xf6, 0xff, 0x01, 0x14, 
+  0x36, 0xef, 0x25, 0x39, 0x1c, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x14, 0x97, 0x08, 0x14, 0x76, 0xa8, 0x8a, 0x14, 0x76, 0xff, 0x01, 0x14, 0xd7, 0xff, 0x14, 0x56, 0xff, 0x9f, 0x0c, 0x16, 0xff, 0x01, 
+  0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x90, 0x00, 0x00, 0x00, 0x02, 0x14, 0x97, 0x5c, 0x14, 0x97, 0xd7, 0x14, 0x97, 0xf0, 0x86, 0x14, 0x97, 0xff, 0x01, 0x0c, 0x76, 0xff, 0x1c, 0xd8, 0xff, 0xa0, 
+  0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x30, 0x91, 0x00, 0x00, 0x00, 0x02, 0x14, 0x97, 0x0b, 0x14, 0x97, 0x1f, 0x14, 0x97, 0x2c, 0x85, 0x14, 0x97, 0x34, 0x01, 0x0c, 0x96, 0x27, 
+  0x14, 0x77, 0xff, 0xa0, 0x0c, 0x36, 0xff, 0x01, 0x0c, 0x36, 0xfc, 0x14, 0x56, 0x2b, 0x9b, 0x00, 0x00, 0x00, 0xa1, 0x0c, 0x36, 0xff, 0x01, 0x14, 0x56, 0xef, 0x14, 0xb7, 0x1c, 0x9b, 0x00, 0x00, 
+  0x00, 0xa1, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xcf, 0x25, 0x79, 0x08, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0xe0, 0xa0, 0x0c, 0x56, 0xff, 0x00, 0x14, 0x97, 0x5f, 0x9c, 0x00, 0x00, 0x00, 
+  0x00, 0x14, 0xb7, 0x7b, 0x9f, 0x14, 0x76, 0xff, 0x00, 0x14, 0x77, 0xaf, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x14, 0xd8, 0x17, 0x14, 0x77, 0xdb, 0x9d, 0x14, 0x76, 0xff, 0x01, 0x14, 0x77, 0xcf, 0x1d, 
+  0x17, 0x18, 0x9e, 0x00, 0x00, 0x00, 0x01, 0x14, 0xb7, 0x20, 0x14, 0x76, 0xd7, 0x9b, 0x14, 0x76, 0xff, 0x01, 0x14, 0x77, 0x9c, 0x1c, 0xf7, 0x13, 0xa0, 0x00, 0x00, 0x00, 0x03, 0x1c, 0xd9, 0x08, 
+  0x14, 0x97, 0x90, 0x0c, 0x97, 0xe4, 0x14, 0x97, 0xf8, 0x86, 0x14, 0x97, 0xff, 0x82, 0x14, 0x97, 0xfb, 0x00, 0x14, 0x97, 0xfc, 0x89, 0x14, 0x97, 0xff, 0x03, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xec, 
+  0x14, 0x97, 0xbc, 0x14, 0x97, 0x47, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7b, 0x04, 0x85, 0x00, 0x00, 0x00, 0x02, 0x25, 0x3a, 0x03, 0x14, 0x97, 0x18, 0x14, 0x97, 0x28, 0x84, 0x14, 0x97, 0x2f, 
+  0x01, 0x14, 0x97, 0x2c, 0x14, 0x97, 0x2b, 0x83, 0x14, 0x97, 0x28, 0x01, 0x14, 0x97, 0x2b, 0x14, 0x97, 0x2c, 0x87, 0x14, 0x97, 0x2f, 0x02, 0x14, 0x97, 0x28, 0x14, 0x77, 0x1c, 0x14, 0xd7, 0x0b, 
+  0xff, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x25, 0x3a, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x14, 0x76, 0x03, 0x14, 0x76, 0x07, 0x14, 0x77, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xce, 0x00, 
+  0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xf1, 0xbc, 0x4f, 0x00, 0xcf, 0xa7, 0x20, 0x00, 0xd0, 0xa7, 0x1f, 0x00, 0xd0, 0xa7, 0x20, 0x00, 0xd0, 0xa8, 0x20, 0x00, 0xd0, 0xa8, 0x20, 0x00, 0xd0, 0xa7, 0x20, 0x00, 0xd0, 0xa7, 0x1f, 0x00, 0xcf, 0xa7, 0x20, 0x00, 0xf1, 0xbc, 0x4f, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xab, 0x20, 0x00, 0xd1, 0xab, 0x20, 0x00, 0xd7, 0xb4, 0x23, 0x07, 0xd5, 0xae, 0x23, 0x23, 0xcb, 0xa3, 0x1e, 0x78, 0xca, 0xa0, 0x1c, 0xb8, 0xca, 0x9f, 0x1d, 0xe8, 0xc9, 0x9f, 0x1d, 0xff, 0xc9, 0x9f, 0x1d, 0xff, 0xca, 0x9f, 0x1d, 0xe8, 0xca, 0xa0, 0x1c, 0xb8, 0xcb, 0xa3, 0x1e, 0x78, 0xd5, 0xae, 0x23, 0x23, 0xd7, 0xb4, 0x23, 0x07, 0xd1, 0xab, 0x20, 0x00, 0xd9, 0xab, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xa9, 0x20, 0x00, 0xcb, 0xa8, 0x20, 0x00, 0xd4, 0xb0, 0x23, 0x3f, 0xca, 0xa0, 0x1c, 0xbf, 0xbb, 0x8a, 0x14, 0xf4, 0xaf, 0x79, 0x0d, 0xff, 0xac, 0x75, 0x0b, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xac, 0x75, 0x0b, 0xff, 0xaf, 0x79, 0x0d, 0xff, 0xbb, 0x8a, 0x14, 0xf4, 0xca, 0xa0, 0x1c, 0xbf, 0xd4, 0xb0, 0x23, 0x3f, 0xcb, 0xa8, 0x20, 0x00, 0xd0, 0xa9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xae, 0x22, 0x00, 0xe0, 0xbf, 0x29, 0x07, 0xcc, 0xa3, 0x1e, 0x80, 0xbd, 0x8f, 0x15, 0xff, 0xab, 0x73, 0x0a, 0xff, 0xa8, 0x70, 0x08, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa8, 0x70, 0x08, 0xff, 0xab, 0x73, 0x0a, 0xff, 0xbd, 0x8f, 0x15, 0xff, 0xcc, 0xa3, 0x1e, 0x80, 0xe0, 0xbf, 0x29, 0x07, 0xd2, 0xae, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xab, 0x21, 0x00, 0xdf, 0xc2, 0x2a, 0x07, 0xc7, 0x9d, 0x1b, 0xb7, 0xb2, 0x7e, 0x0f, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xb2, 0x7e, 0x0f, 0xff, 0xc7, 0x9d, 0x1b, 0xb7, 0xeb, 0xd1, 0x32, 0x04, 0xd0, 0xab, 0x21, 0x00, 0xd1, 0xab, 0x20, 0x00, 0xd0, 0xab, 0x20, 0x00, 0xd1, 0xab, 0x20, 0x00, 0xd1, 0xab, 0x20, 0x00, 0xcf, 0xaa, 0x20, 0x00, 0xcf, 0xad, 0x23, 0x00, 0xcf, 0xac, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaf, 0x21, 0x00, 0xff, 0xf9, 0x38, 0x00, 0xc8, 0x9f, 0x1b, 0xa3, 0xae, 0x7a, 0x0c, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xae, 0x79, 0x0c, 0xff, 0xc7, 0x9e, 0x1b, 0xcb, 0xca, 0xa3, 0x1e, 0xbb, 0xca, 0xa3, 0x1d, 0xf0, 0xc9, 0xa2, 0x1d, 0xff, 0xca, 0xa2, 0x1d, 0xfc, 0xcb, 0xa3, 0x1d, 0xd3, 0xcb, 0xa4, 0x1d, 0x93, 0xce, 0xab, 0x20, 0x3f, 0xd5, 0xb2, 0x23, 0x0c, 0xd2, 0xae, 0x20, 0x00, 0xd3, 0xab, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x70, 0x00, 0x00, 0xcb, 0xa5, 0x1d, 0x74, 0xb1, 0x7f, 0x0d, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xad, 0x78, 0x0a, 0xff, 0xae, 0x79, 0x0b, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xaf, 0x7c, 0x0c, 0xff, 0xb8, 0x89, 0x11, 0xfb, 0xc7, 0x9f, 0x1a, 0xd3, 0xd6, 0xb4, 0x23, 0x4b, 0xcc, 0xa9, 0x1f, 0x00, 0xd1, 0xab, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xaf, 0x28, 0x00, 0xcf, 0xab, 0x21, 0x20, 0xb8, 0x89, 0x11, 0xf0, 0xaa, 0x74, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xaa, 0x75, 0x09, 0xff, 0xab, 0x75, 0x08, 0xff, 0xbc, 0x8f, 0x14, 0xff, 0xcc, 0xa6, 0x1d, 0x7c, 0xe1, 0xc3, 0x32, 0x04, 0xd3, 0xb1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xcd, 0xa7, 0x22, 0x00, 0xc5, 0x9c, 0x1d, 0x87, 0xad, 0x79, 0x0b, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x76, 0x0a, 0xff, 0xb5, 0x84, 0x10, 0xff, 0xcc, 0xa5, 0x1f, 0x90, 0xdf, 0xc5, 0x28, 0x04, 0xd2, 0xac, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xb2, 0x24, 0x00, 0xd1, 0xb1, 0x24, 0x00, 0xd2, 0xb0, 0x25, 0x00, 0xd2, 0xb0, 0x23, 0x00, 0x67, 0x00, 0x00, 0x00, 0xba, 0x8d, 0x14, 0xe8, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xab, 0x77, 0x09, 0xff, 0xb5, 0x86, 0x10, 0xfb, 0xcc, 0xa7, 0x20, 0x57, 0xd2, 0xad, 0x24, 0x00, 0xd3, 0xaf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xaf, 0x27, 0x00, 0xd2, 0xb3, 0x24, 0x00, 0xd5, 0xb7, 0x26, 0x2c, 0xd5, 0xb4, 0x27, 0x7b, 0xd5, 0xb4, 0x25, 0xb0, 0xd0, 0xab, 0x21, 0xcf, 0xad, 0x79, 0x09, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xbe, 0x93, 0x16, 0xe8, 0xe0, 0xbf, 0x2b, 0x18, 0xd5, 0xb2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xb3, 0x28, 0x00, 0xd5, 0xb5, 0x28, 0x00, 0xd4, 0xb3, 0x27, 0x20, 0xce, 0xac, 0x21, 0xa3, 0xc3, 0x9b, 0x1a, 0xff, 0xb7, 0x8a, 0x11, 0xff, 0xaf, 0x7c, 0x0a, 0xff, 0xac, 0x78, 0x09, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xc9, 0xa2, 0x1e, 0x80, 0xbb, 0x8f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xb6, 0x28, 0x00, 0xda, 0xbd, 0x2d, 0x3b, 0xc4, 0x9d, 0x1b, 0xec, 0xb2, 0x83, 0x0f, 0xff, 0xad, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xb8, 0x8c, 0x13, 0xdb, 0xdd, 0xba, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xb8, 0x28, 0x00, 0xd4, 0xb5, 0x26, 0x20, 0xc1, 0x9a, 0x1a, 0xec, 0xac, 0x7c, 0x09, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xb1, 0x82, 0x0d, 0xff, 0xb3, 0x86, 0x0f, 0xff, 0xb5, 0x89, 0x11, 0xff, 0xb6, 0x89, 0x11, 0xff, 0xb5, 0x88, 0x10, 0xff, 0xb3, 0x86, 0x0f, 0xff, 0xb0, 0x82, 0x0c, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xb1, 0x84, 0x0e, 0xef, 0xc6, 0xa3, 0x1d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xb6, 0x29, 0x00, 0xce, 0xaf, 0x24, 0x00, 0xc6, 0xa4, 0x1e, 0xa3, 0xb0, 0x83, 0x0c, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xae, 0x80, 0x0a, 0xff, 0xb3, 0x86, 0x0e, 0xff, 0xc2, 0x98, 0x18, 0xff, 0xc3, 0x96, 0x17, 0xff, 0xbb, 0x8a, 0x14, 0xff, 0xb5, 0x83, 0x12, 0xff, 0xb4, 0x81, 0x11, 0xff, 0xb6, 0x84, 0x11, 0xff, 0xbb, 0x8b, 0x13, 0xff, 0xc3, 0x97, 0x19, 0xff, 0xc2, 0x97, 0x17, 0xff, 0xb2, 0x85, 0x0d, 0xff, 0xae, 0x80, 0x0a, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xb1, 0x84, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xb4, 0x27, 0x00, 0xdc, 0xbe, 0x2c, 0x2c, 0xb9, 0x90, 0x12, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0xbb, 0x8f, 0x13, 0xff, 0xc2, 0x96, 0x18, 0xff, 0xb2, 0x7c, 0x0e, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa8, 0x70, 0x08, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa7, 0x6d, 0x07, 0xff, 0xb2, 0x7e, 0x0f, 0xff, 0xc3, 0x96, 0x18, 0xff, 0xbb, 0x90, 0x12, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0xb3, 0x87, 0x0e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa1, 0x1d, 0x00, 0xc8, 0xa5, 0x1f, 0x7b, 0xaf, 0x82, 0x0b, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xc1, 0x97, 0x16, 0xff, 0xb5, 0x82, 0x10, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xb5, 0x83, 0x11, 0xff, 0xc0, 0x96, 0x16, 0xff, 0xaf, 0x83, 0x0a, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x86, 0x0d, 0xff, 0xb2, 0x85, 0x0c, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0xab, 0x7c, 0x08, 0x28, 0xce, 0xa6, 0x20, 0x00, 0xcf, 0xa7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x93, 0x15, 0x00, 0xbb, 0x94, 0x15, 0xb0, 0xb0, 0x84, 0x0b, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xbc, 0x92, 0x13, 0xff, 0xb2, 0x7e, 0x0e, 0xff, 0xa9, 0x72, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xa9, 0x72, 0x08, 0xff, 0xb4, 0x81, 0x0f, 0xff, 0xc6, 0x9d, 0x19, 0xff, 0xc6, 0x9c, 0x1a, 0xff, 0xc7, 0x9d, 0x1b, 0xff, 0xc6, 0x9d, 0x1a, 0xff, 0xc5, 0x9d, 0x1a, 0xff, 0xca, 0xa2, 0x1c, 0xa3, 0xd0, 0xaa, 0x20, 0x37, 0xda, 0xba, 0x29, 0x04, 0xd1, 0xb0, 0x22, 0x00, 0xd0, 0xaf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb4, 0x8a, 0x0d, 0xc4, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xbb, 0x92, 0x11, 0xff, 0xb7, 0x87, 0x10, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 0xba, 0x8c, 0x13, 0xf7, 0xce, 0xa8, 0x1d, 0xa7, 0xd4, 0xba, 0x24, 0x10, 0xd1, 0xb1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8b, 0x0e, 0x00, 0xb4, 0x8c, 0x0e, 0xa0, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xbc, 0x90, 0x15, 0xff, 0xa9, 0x74, 0x09, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xaa, 0x75, 0x09, 0xff, 0xb1, 0x7e, 0x0e, 0xff, 0xc8, 0x9d, 0x1d, 0xc7, 0xd1, 0xae, 0x24, 0x17, 0xd4, 0xae, 0x28, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x97, 0x16, 0x00, 0xbd, 0x99, 0x17, 0x63, 0xb2, 0x89, 0x0c, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb1, 0x88, 0x0b, 0xff, 0xb4, 0x8b, 0x0e, 0xff, 0xb1, 0x80, 0x0e, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xaf, 0x7d, 0x0c, 0xff, 0xc6, 0xa2, 0x1d, 0xac, 0xc4, 0xac, 0x12, 0x00, 0xdd, 0xa3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xa6, 0x22, 0x00, 0xd3, 0xb8, 0x2c, 0x13, 0xb3, 0x8b, 0x0d, 0xf3, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb9, 0x93, 0x12, 0xff, 0xc1, 0x9b, 0x17, 0xff, 0xc5, 0xa0, 0x1b, 0xff, 0xc4, 0x9d, 0x1b, 0xff, 0xae, 0x7b, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xb3, 0x83, 0x0f, 0xff, 0xd1, 0xae, 0x23, 0x5c, 0xcb, 0xa5, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xa4, 0x20, 0x00, 0xbe, 0x9c, 0x18, 0x00, 0xb9, 0x94, 0x13, 0x74, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8b, 0x0c, 0xff, 0xc6, 0xa1, 0x1a, 0xff, 0xbe, 0x93, 0x15, 0xff, 0xb3, 0x84, 0x0f, 0xff, 0xb0, 0x80, 0x0c, 0xff, 0xaf, 0x7d, 0x0b, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xad, 0x7a, 0x09, 0xff, 0xbc, 0x90, 0x14, 0xcc, 0xe1, 0xc2, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x9f, 0x19, 0x00, 0xbb, 0x99, 0x10, 0x08, 0xb5, 0x8e, 0x0e, 0xc3, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb5, 0x8e, 0x0e, 0xff, 0xc5, 0xa1, 0x1c, 0xff, 0xb5, 0x87, 0x10, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xb2, 0x84, 0x0f, 0xef, 0xcb, 0xa6, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x92, 0x10, 0x00, 0xb7, 0x91, 0x11, 0x08, 0xb4, 0x8e, 0x0d, 0xa8, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb3, 0x8d, 0x0d, 0xff, 0xbc, 0x97, 0x13, 0xff, 0xb4, 0x88, 0x10, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xb1, 0x83, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x90, 0x0e, 0x5c, 0xb5, 0x8f, 0x0d, 0xd7, 0xb5, 0x8f, 0x0d, 0xf0, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb4, 0x8e, 0x0c, 0xff, 0xc0, 0x9a, 0x17, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb4, 0x88, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x98, 0x12, 0x00, 0xb5, 0x90, 0x0e, 0x00, 0xb6, 0x92, 0x0e, 0x0b, 0xb6, 0x90, 0x0d, 0x1f, 0xb5, 0x8f, 0x0d, 0x2c, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb3, 0x8f, 0x0a, 0x27, 0xb7, 0x8d, 0x11, 0xff, 0xb1, 0x83, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xfc, 0xb4, 0x87, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x87, 0x0c, 0x00, 0xb2, 0x86, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb3, 0x87, 0x0d, 0xef, 0xbc, 0x95, 0x14, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x88, 0x0c, 0x00, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb3, 0x89, 0x0d, 0xcf, 0xcc, 0xae, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8c, 0x0e, 0x00, 0xb3, 0x8b, 0x0e, 0xe0, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb7, 0x90, 0x11, 0x5f, 0xbb, 0x8f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x9b, 0x17, 0x00, 0xb9, 0x95, 0x13, 0x7b, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb5, 0x8d, 0x0f, 0xaf, 0x8f, 0x33, 0x00, 0x00, 0xc1, 0xa4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xb8, 0x21, 0x00, 0xbe, 0x99, 0x12, 0x17, 0xb5, 0x8d, 0x0d, 0xdb, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb5, 0x8c, 0x0d, 0xcf, 0xbb, 0x9f, 0x19, 0x18, 0xc8, 0xce, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x1c, 0x00, 0xa7, 0x7b, 0x0a, 0x00, 0xbb, 0x96, 0x13, 0x20, 0xb4, 0x8e, 0x0d, 0xd7, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb5, 0x8e, 0x0e, 0x9c, 0xb6, 0x9d, 0x16, 0x13, 0xac, 0x8a, 0x05, 0x00, 0xbf, 0xaf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9e, 0x26, 0x00, 0xcd, 0xa6, 0x09, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x9e, 0x18, 0x00, 0xd0, 0xa5, 0x1f, 0x00, 0xcb, 0x97, 0x18, 0x08, 0xb6, 0x90, 0x0e, 0x90, 0xb5, 0x8f, 0x0c, 0xe4, 0xb5, 0x8f, 0x0d, 0xf8, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfc, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xec, 0xb5, 0x8f, 0x0d, 0xbc, 0xb7, 0x90, 0x0d, 0x47, 0xb1, 0x84, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xaa, 0x00, 0x00, 0xd0, 0xac, 0x1a, 0x00, 0xd5, 0xac, 0x21, 0x04, 0xd3, 0xac, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x99, 0x1a, 0x00, 0xb3, 0x97, 0x15, 0x00, 0xce, 0xa5, 0x21, 0x03, 0xb7, 0x92, 0x0d, 0x18, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2c, 0xb5, 0x8f, 0x0d, 0x2b, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x2b, 0xb5, 0x8f, 0x0d, 0x2c, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8e, 0x0d, 0x1c, 0xba, 0x97, 0x14, 0x0b, 0xa3, 0x80, 0x00, 0x00, 0xbf, 0x9c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xa4, 0x1c, 0x00, 0xcd, 0xa8, 0x1f, 0x00, 0xb8, 0x88, 0x13, 0x00, 0xd7, 0xb3, 0x24, 0x00, 0xd0, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x1c, 0x00, 0xdd, 0xbc, 0x2b, 0x00, 0xb6, 0x86, 0x12, 0x00, 0xad, 0x79, 0x0b, 0x00, 0xc6, 0x9e, 0x1d, 0x00, 0xd2, 0xb0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xd1, 0xa8, 0x21, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xb2, 0x26, 0x00, 0xc4, 0x9e, 0x1c, 0x00, 0xb0, 0x80, 0x0d, 0x00, 0xad, 0x7a, 0x0a, 0x00, 0xbe, 0x94, 0x17, 0x00, 0xa3, 0x5f, 0x00, 0x00, 0xd4, 0xb5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xd3, 0xae, 0x25, 0x00, 0xce, 0xa6, 0x1f, 0x00, 0xcd, 0xa3, 0x1e, 0x03, 0xd4, 0xb0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa4, 0x1e, 0x00, 0xc2, 0x9c, 0x1a, 0x00, 0xaf, 0x80, 0x0b, 0x00, 0xb0, 0x80, 0x0b, 0x00, 0xb0, 0x80, 0x0a, 0x00, 0xd2, 0xb1, 0x24, 0x00, 0xcd, 0xab, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xaa, 0x42, 0x00, 0xbe, 0x96, 0x0e, 0x00, 0xbe, 0x91, 0x16, 0x00, 0xc3, 0x98, 0x19, 0x00, 0xcc, 0xa6, 0x1f, 0x00, 0xd0, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x8f, 0x11, 0x00, 0xb6, 0x8d, 0x10, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb1, 0x85, 0x0b, 0x00, 0xbe, 0x98, 0x17, 0x00, 0xbd, 0x96, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xd1, 0xa8, 0x21, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xa6, 0x22, 0x00, 0xcf, 0xaa, 0x22, 0x00, 0xac, 0x76, 0x09, 0x00, 0xaf, 0x7b, 0x0c, 0x00, 0xd3, 0xb1, 0x24, 0x00, 0xce, 0xaa, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x8f, 0x10, 0x00, 0xb5, 0x8d, 0x0f, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xbe, 0x9b, 0x18, 0x00, 0xbb, 0x97, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xaa, 0x00, 0x00, 0xd6, 0xad, 0x23, 0x00, 0xd5, 0xad, 0x20, 0x00, 0xd0, 0xaa, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc5, 0x30, 0x00, 0xb7, 0x8b, 0x13, 0x00, 0xad, 0x7c, 0x0a, 0x00, 0xad, 0x7c, 0x0a, 0x00, 0xbc, 0x91, 0x16, 0x00, 0xf2, 0xdd, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x92, 0x12, 0x00, 0xaa, 0x87, 0x00, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb4, 0x8e, 0x0d, 0x00, 0xb6, 0x8f, 0x0c, 0x00, 0xbb, 0x96, 0x14, 0x00, 0xbe, 0x9b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xa9, 0x00, 0x00, 0xc9, 0xa4, 0x1b, 0x00, 0xc4, 0x9a, 0x1a, 0x00, 0xc4, 0x9a, 0x1a, 0x00, 0xce, 0xa8, 0x20, 0x00, 0xd0, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x9f, 0x1a, 0x00, 0xb4, 0x87, 0x0e, 0x00, 0xb0, 0x82, 0x0b, 0x00, 0xb0, 0x82, 0x0b, 0x00, 0xb4, 0x87, 0x0f, 0x00, 0xcc, 0xaa, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0b, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb4, 0x8e, 0x0d, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xad, 0x24, 0x00, 0xda, 0xb8, 0x29, 0x00, 0xb0, 0x7d, 0x0d, 0x00, 0xb4, 0x83, 0x10, 0x00, 0xe0, 0xc3, 0x2c, 0x00, 0xd2, 0xb0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8b, 0x0e, 0x00, 0xb2, 0x88, 0x0c, 0x00, 0xb2, 0x87, 0x0c, 0x00, 0xb2, 0x87, 0x0c, 0x00, 0xb3, 0x89, 0x0d, 0x00, 0xba, 0x95, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0xbe, 0x94, 0x16, 0x00, 0xac, 0x79, 0x09, 0x00, 0xab, 0x78, 0x08, 0x00, 0xc5, 0x9d, 0x1b, 0x00, 0xb0, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x9a, 0x17, 0x00, 0xb4, 0x8c, 0x0d, 0x00, 0xb3, 0x8c, 0x0d, 0x00, 0xb3, 0x8c, 0x0d, 0x00, 0xb4, 0x8c, 0x0e, 0x00, 0xda, 0xc1, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa7, 0x14, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xa9, 0x20, 0x00, 0xb4, 0x87, 0x0f, 0x00, 0xb0, 0x80, 0x0b, 0x00, 0xaf, 0x80, 0x0b, 0x00, 0xb5, 0x88, 0x10, 0x00, 0xd3, 0xb3, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x90, 0x10, 0x00, 0xb2, 0x8d, 0x0a, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb5, 0x8e, 0x0d, 0x00, 0xb9, 0x90, 0x09, 0x00, 0xbc, 0x96, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xac, 0x1b, 0x00, 0xd5, 0xac, 0x21, 0x00, 0xd3, 0xac, 0x21, 0x00, 0xd0, 0xaa, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x90, 0x12, 0x00, 0xb3, 0x88, 0x0d, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb4, 0x89, 0x0e, 0x00, 0xbf, 0x98, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xaa, 0x00, 0x00, 0xcf, 0xaa, 0x21, 0x00, 0xb9, 0x89, 0x13, 0x00, 0xd4, 0xaf, 0x23, 0x00, 0xce, 0xa8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x90, 0x11, 0x00, 0xb3, 0x8b, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8b, 0x0e, 0x00, 0xbf, 0x9d, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x1c, 0x00, 0xd1, 0xad, 0x24, 0x00, 0xc7, 0x9e, 0x1e, 0x00, 0xac, 0x76, 0x0a, 0x00, 0xba, 0x8c, 0x14, 0x00, 0xe6, 0xcb, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x90, 0x0f, 0x00, 0xb2, 0x8d, 0x0b, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb5, 0x8e, 0x0d, 0x00, 0xb8, 0x8f, 0x0a, 0x00, 0xbb, 0x95, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xb2, 0x26, 0x00, 0xfd, 0xf3, 0x41, 0x00, 0xb9, 0x8d, 0x13, 0x00, 0xad, 0x7a, 0x0a, 0x00, 0xb1, 0x81, 0x0e, 0x00, 0xc8, 0xa2, 0x1e, 0x00, 0xd4, 0xb5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0c, 0x00, 0xb3, 0x8d, 0x0b, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb5, 0x8e, 0x0d, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa4, 0x1e, 0x00, 0xcb, 0xa8, 0x1f, 0x00, 0xaf, 0x7e, 0x0a, 0x00, 0xb0, 0x80, 0x0b, 0x00, 0xaf, 0x80, 0x0b, 0x00, 0xc5, 0x9f, 0x1d, 0x00, 0xcd, 0xab, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x8f, 0x11, 0x00, 0xb8, 0x8f, 0x12, 0x00, 0xb1, 0x85, 0x0c, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb1, 0x85, 0x0c, 0x00, 0xba, 0x92, 0x14, 0x00, 0xbd, 0x96, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x8f, 0x10, 0x00, 0xb7, 0x90, 0x11, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb7, 0x92, 0x12, 0x00, 0xbb, 0x97, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x92, 0x12, 0x00, 0xb6, 0x90, 0x0f, 0x00, 0xb3, 0x8e, 0x0d, 0x03, 0xb4, 0x8e, 0x0d, 0x07, 0xb6, 0x8e, 0x0d, 0x04, 0xb0, 0x7b, 0x00, 0x00, 0xbe, 0x9b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0c, 0x00, 0xb3, 0x8d, 0x0d, 0x00, 0xb4, 0x8e, 0x0d, 0x00, 0xb5, 0x8e, 0x0d, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd7, 0xb4, 
+  0x23, 0x07, 0xd5, 0xae, 0x23, 0x23, 0xcb, 0xa3, 0x1e, 0x78, 0xca, 0xa0, 0x1c, 0xb8, 0xca, 0x9f, 0x1d, 0xe8, 0x81, 0xc9, 0x9f, 0x1d, 0xff, 0x04, 0xca, 0x9f, 0x1d, 0xe8, 0xca, 0xa0, 0x1c, 0xb8, 
+  0xcb, 0xa3, 0x1e, 0x78, 0xd5, 0xae, 0x23, 0x23, 0xd7, 0xb4, 0x23, 0x07, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd4, 0xb0, 0x23, 0x3f, 0xca, 0xa0, 0x1c, 0xbf, 0xbb, 0x8a, 0x14, 0xf4, 0xaf, 0x79, 
+  0x0d, 0xff, 0xac, 0x75, 0x0b, 0xff, 0xaa, 0x71, 0x09, 0xff, 0x81, 0xa8, 0x6f, 0x08, 0xff, 0x05, 0xaa, 0x71, 0x09, 0xff, 0xac, 0x75, 0x0b, 0xff, 0xaf, 0x79, 0x0d, 0xff, 0xbb, 0x8a, 0x14, 0xf4, 
+  0xca, 0xa0, 0x1c, 0xbf, 0xd4, 0xb0, 0x23, 0x3f, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xbf, 0x29, 0x07, 0xcc, 0xa3, 0x1e, 0x80, 0xbd, 0x8f, 0x15, 0xff, 0xab, 0x73, 0x0a, 0xff, 0xa8, 0x70, 
+  0x08, 0xff, 0x87, 0xa9, 0x71, 0x09, 0xff, 0x04, 0xa8, 0x70, 0x08, 0xff, 0xab, 0x73, 0x0a, 0xff, 0xbd, 0x8f, 0x15, 0xff, 0xcc, 0xa3, 0x1e, 0x80, 0xe0, 0xbf, 0x29, 0x07, 0xac, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xdf, 0xc2, 0x2a, 0x07, 0xc7, 0x9d, 0x1b, 0xb7, 0xb2, 0x7e, 0x0f, 0xff, 0x8d, 0xaa, 0x72, 0x09, 0xff, 0x02, 0xb2, 0x7e, 0x0f, 0xff, 0xc7, 0x9d, 0x1b, 0xb7, 0xeb, 0xd1, 0x32, 0x04, 
+  0xab, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc8, 0x9f, 0x1b, 0xa3, 0xae, 0x7a, 0x0c, 0xff, 0x8f, 0xaa, 0x73, 0x09, 0xff, 0x09, 0xae, 0x79, 0x0c, 0xff, 0xc7, 0x9e, 0x1b, 0xcb, 0xca, 0xa3, 0x1e, 0xbb, 
+  0xca, 0xa3, 0x1d, 0xf0, 0xc9, 0xa2, 0x1d, 0xff, 0xca, 0xa2, 0x1d, 0xfc, 0xcb, 0xa3, 0x1d, 0xd3, 0xcb, 0xa4, 0x1d, 0x93, 0xce, 0xab, 0x20, 0x3f, 0xd5, 0xb2, 0x23, 0x0c, 0xa2, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xcb, 0xa5, 0x1d, 0x74, 0xb1, 0x7f, 0x0d, 0xff, 0xab, 0x74, 0x09, 0xff, 0x90, 0xab, 0x75, 0x09, 0xff, 0x09, 0xad, 0x78, 0x0a, 0xff, 0xae, 0x79, 0x0b, 0xff, 0xab, 0x75, 0x09, 0xff, 
+  0xaa, 0x73, 0x08, 0xff, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xaf, 0x7c, 0x0c, 0xff, 0xb8, 0x89, 0x11, 0xfb, 0xc7, 0x9f, 0x1a, 0xd3, 0xd6, 0xb4, 0x23, 0x4b, 0xa0, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xcf, 0xab, 0x21, 0x20, 0xb8, 0x89, 0x11, 0xf0, 0xaa, 0x74, 0x09, 0xff, 0x98, 0xab, 0x76, 0x09, 0xff, 0x04, 0xaa, 0x75, 0x09, 0xff, 0xab, 0x75, 0x08, 0xff, 0xbc, 0x8f, 0x14, 0xff, 
+  0xcc, 0xa6, 0x1d, 0x7c, 0xe1, 0xc3, 0x32, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc5, 0x9c, 0x1d, 0x87, 0xad, 0x79, 0x0b, 0xff, 0x9b, 0xac, 0x77, 0x0a, 0xff, 0x03, 0xac, 0x76, 0x0a, 0xff, 
+  0xb5, 0x84, 0x10, 0xff, 0xcc, 0xa5, 0x1f, 0x90, 0xdf, 0xc5, 0x28, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x8d, 0x14, 0xe8, 0x9d, 0xac, 0x78, 0x0a, 0xff, 0x02, 0xab, 0x77, 0x09, 0xff, 
+  0xb5, 0x86, 0x10, 0xfb, 0xcc, 0xa7, 0x20, 0x57, 0x99, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd5, 0xb7, 0x26, 0x2c, 0xd5, 0xb4, 0x27, 0x7b, 0xd5, 0xb4, 0x25, 0xb0, 0xd0, 0xab, 0x21, 0xcf, 0xad, 0x79, 
+  0x09, 0xff, 0x9f, 0xad, 0x7a, 0x0a, 0xff, 0x01, 0xbe, 0x93, 0x16, 0xe8, 0xe0, 0xbf, 0x2b, 0x18, 0x96, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd4, 0xb3, 0x27, 0x20, 0xce, 0xac, 0x21, 0xa3, 0xc3, 0x9b, 
+  0x1a, 0xff, 0xb7, 0x8a, 0x11, 0xff, 0xaf, 0x7c, 0x0a, 0xff, 0xac, 0x78, 0x09, 0xff, 0xa0, 0xad, 0x7b, 0x0a, 0xff, 0x01, 0xad, 0x7c, 0x0a, 0xff, 0xc9, 0xa2, 0x1e, 0x80, 0x95, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xda, 0xbd, 0x2d, 0x3b, 0xc4, 0x9d, 0x1b, 0xec, 0xb2, 0x83, 0x0f, 0xff, 0xad, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xa2, 0xae, 0x7d, 0x0b, 0xff, 0x02, 0xae, 0x7c, 0x0b, 0xff, 
+  0xb8, 0x8c, 0x13, 0xdb, 0xdd, 0xba, 0x2b, 0x0c, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd4, 0xb5, 0x26, 0x20, 0xc1, 0x9a, 0x1a, 0xec, 0xac, 0x7c, 0x09, 0xff, 0x97, 0xae, 0x7f, 0x0b, 0xff, 0x06, 
+  0xb1, 0x82, 0x0d, 0xff, 0xb3, 0x86, 0x0f, 0xff, 0xb5, 0x89, 0x11, 0xff, 0xb6, 0x89, 0x11, 0xff, 0xb5, 0x88, 0x10, 0xff, 0xb3, 0x86, 0x0f, 0xff, 0xb0, 0x82, 0x0c, 0xff, 0x87, 0xae, 0x7f, 0x0b, 
+  0xff, 0x01, 0xb1, 0x84, 0x0e, 0xef, 0xc6, 0xa3, 0x1d, 0x1f, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc6, 0xa4, 0x1e, 0xa3, 0xb0, 0x83, 0x0c, 0xff, 0x95, 0xaf, 0x81, 0x0b, 0xff, 0x0c, 0xae, 0x80, 
+  0x0a, 0xff, 0xb3, 0x86, 0x0e, 0xff, 0xc2, 0x98, 0x18, 0xff, 0xc3, 0x96, 0x17, 0xff, 0xbb, 0x8a, 0x14, 0xff, 0xb5, 0x83, 0x12, 0xff, 0xb4, 0x81, 0x11, 0xff, 0xb6, 0x84, 0x11, 0xff, 0xbb, 0x8b, 
+  0x13, 0xff, 0xc3, 0x97, 0x19, 0xff, 0xc2, 0x97, 0x17, 0xff, 0xb2, 0x85, 0x0d, 0xff, 0xae, 0x80, 0x0a, 0xff, 0x84, 0xaf, 0x81, 0x0b, 0xff, 0x01, 0xb1, 0x84, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 
+  0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdc, 0xbe, 0x2c, 0x2c, 0xb9, 0x90, 0x12, 0xff, 0x95, 0xb0, 0x82, 0x0b, 0xff, 0x05, 0xb1, 0x83, 0x0b, 0xff, 0xbb, 0x8f, 0x13, 0xff, 0xc2, 0x96, 0x18, 0xff, 
+  0xb2, 0x7c, 0x0e, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa8, 0x70, 0x08, 0xff, 0x81, 0xa9, 0x71, 0x09, 0xff, 0x06, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa7, 0x6d, 0x07, 0xff, 0xb2, 0x7e, 
+  0x0f, 0xff, 0xc3, 0x96, 0x18, 0xff, 0xbb, 0x90, 0x12, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0x83, 0xb0, 0x82, 0x0b, 0xff, 0x01, 0xb1, 0x83, 0x0b, 0xff, 0xb3, 0x87, 0x0e, 0x33, 0x92, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xc8, 0xa5, 0x1f, 0x7b, 0xaf, 0x82, 0x0b, 0xff, 0x95, 0xb0, 0x84, 0x0c, 0xff, 0x03, 0xc1, 0x97, 0x16, 0xff, 0xb5, 0x82, 0x10, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 
+  0x86, 0xaa, 0x72, 0x09, 0xff, 0x09, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xb5, 0x83, 0x11, 0xff, 0xc0, 0x96, 0x16, 0xff, 0xaf, 0x83, 0x0a, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x86, 
+  0x0d, 0xff, 0xb2, 0x85, 0x0c, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0xab, 0x7c, 0x08, 0x28, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbb, 0x94, 0x15, 0xb0, 0xb0, 0x84, 0x0b, 0xff, 0x94, 0xb1, 0x85, 0x0c, 
+  0xff, 0x02, 0xbc, 0x92, 0x13, 0xff, 0xb2, 0x7e, 0x0e, 0xff, 0xa9, 0x72, 0x09, 0xff, 0x8a, 0xaa, 0x73, 0x09, 0xff, 0x09, 0xa9, 0x72, 0x08, 0xff, 0xb4, 0x81, 0x0f, 0xff, 0xc6, 0x9d, 0x19, 0xff, 
+  0xc6, 0x9c, 0x1a, 0xff, 0xc7, 0x9d, 0x1b, 0xff, 0xc6, 0x9d, 0x1a, 0xff, 0xc5, 0x9d, 0x1a, 0xff, 0xca, 0xa2, 0x1c, 0xa3, 0xd0, 0xaa, 0x20, 0x37, 0xda, 0xba, 0x29, 0x04, 0x90, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xb4, 0x8a, 0x0d, 0xc4, 0x93, 0xb2, 0x87, 0x0c, 0xff, 0x03, 0xb1, 0x86, 0x0c, 0xff, 0xbb, 0x92, 0x11, 0xff, 0xb7, 0x87, 0x10, 0xff, 0xab, 0x74, 0x09, 0xff, 0x8c, 0xab, 0x75, 0x09, 
+  0xff, 0x09, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 0xba, 0x8c, 
+  0x13, 0xf7, 0xce, 0xa8, 0x1d, 0xa7, 0xd4, 0xba, 0x24, 0x10, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8c, 0x0e, 0xa0, 0x93, 0xb2, 0x88, 0x0c, 0xff, 0x02, 0xb3, 0x8a, 0x0d, 0xff, 0xbc, 0x90, 
+  0x15, 0xff, 0xa9, 0x74, 0x09, 0xff, 0x94, 0xab, 0x76, 0x0a, 0xff, 0x03, 0xaa, 0x75, 0x09, 0xff, 0xb1, 0x7e, 0x0e, 0xff, 0xc8, 0x9d, 0x1d, 0xc7, 0xd1, 0xae, 0x24, 0x17, 0x8e, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xbd, 0x99, 0x17, 0x63, 0xb2, 0x89, 0x0c, 0xff, 0x90, 0xb3, 0x8a, 0x0d, 0xff, 0x04, 0xb2, 0x89, 0x0c, 0xff, 0xb1, 0x88, 0x0b, 0xff, 0xb4, 0x8b, 0x0e, 0xff, 0xb1, 0x80, 0x0e, 0xff, 
+  0xac, 0x78, 0x0a, 0xff, 0x95, 0xac, 0x79, 0x0a, 0xff, 0x02, 0xac, 0x78, 0x0a, 0xff, 0xaf, 0x7d, 0x0c, 0xff, 0xc6, 0xa2, 0x1d, 0xac, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd3, 0xb8, 0x2c, 0x13, 
+  0xb3, 0x8b, 0x0d, 0xf3, 0x8f, 0xb3, 0x8b, 0x0d, 0xff, 0x04, 0xb9, 0x93, 0x12, 0xff, 0xc1, 0x9b, 0x17, 0xff, 0xc5, 0xa0, 0x1b, 0xff, 0xc4, 0x9d, 0x1b, 0xff, 0xae, 0x7b, 0x0a, 0xff, 0x98, 0xad, 
+  0x7a, 0x0a, 0xff, 0x01, 0xb3, 0x83, 0x0f, 0xff, 0xd1, 0xae, 0x23, 0x5c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x94, 0x13, 0x74, 0x8d, 0xb4, 0x8c, 0x0d, 0xff, 0x05, 0xb4, 0x8b, 0x0c, 0xff, 
+  0xc6, 0xa1, 0x1a, 0xff, 0xbe, 0x93, 0x15, 0xff, 0xb3, 0x84, 0x0f, 0xff, 0xb0, 0x80, 0x0c, 0xff, 0xaf, 0x7d, 0x0b, 0xff, 0x99, 0xae, 0x7c, 0x0a, 0xff, 0x02, 0xad, 0x7a, 0x09, 0xff, 0xbc, 0x90, 
+  0x14, 0xcc, 0xe1, 0xc2, 0x28, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbb, 0x99, 0x10, 0x08, 0xb5, 0x8e, 0x0e, 0xc3, 0x8b, 0xb4, 0x8d, 0x0d, 0xff, 0x03, 0xb5, 0x8e, 0x0e, 0xff, 0xc5, 0xa1, 
+  0x1c, 0xff, 0xb5, 0x87, 0x10, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0x9d, 0xae, 0x7e, 0x0b, 0xff, 0x01, 0xb2, 0x84, 0x0f, 0xef, 0xcb, 0xa6, 0x20, 0x1c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb7, 0x91, 
+  0x11, 0x08, 0xb4, 0x8e, 0x0d, 0xa8, 0x89, 0xb4, 0x8e, 0x0d, 0xff, 0x03, 0xb3, 0x8d, 0x0d, 0xff, 0xbc, 0x97, 0x13, 0xff, 0xb4, 0x88, 0x10, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0x9e, 0xaf, 0x80, 0x0b, 
+  0xff, 0x01, 0xb1, 0x83, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb6, 0x90, 0x0e, 0x5c, 0xb5, 0x8f, 0x0d, 0xd7, 0xb5, 0x8f, 0x0d, 0xf0, 0x86, 0xb5, 0x8f, 0x0d, 
+  0xff, 0x01, 0xb4, 0x8e, 0x0c, 0xff, 0xc0, 0x9a, 0x17, 0xff, 0xa0, 0xb0, 0x82, 0x0b, 0xff, 0x01, 0xb1, 0x84, 0x0c, 0xff, 0xb4, 0x88, 0x0f, 0x30, 0x91, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb6, 0x92, 
+  0x0e, 0x0b, 0xb6, 0x90, 0x0d, 0x1f, 0xb5, 0x8f, 0x0d, 0x2c, 0x85, 0xb5, 0x8f, 0x0d, 0x34, 0x02, 0xb3, 0x8f, 0x0a, 0x27, 0xb7, 0x8d, 0x11, 0xff, 0xb1, 0x83, 0x0c, 0xff, 0x9f, 0xb1, 0x84, 0x0c, 
+  0xff, 0x01, 0xb1, 0x84, 0x0c, 0xfc, 0xb4, 0x87, 0x0d, 0x2b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x86, 0x0c, 0xff, 0xa0, 0xb1, 0x85, 0x0c, 0xff, 0x01, 0xb3, 0x87, 0x0d, 0xef, 0xbc, 0x95, 
+  0x14, 0x1c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb2, 0x88, 0x0c, 0xff, 0x01, 0xb3, 0x89, 0x0d, 0xcf, 0xcc, 0xae, 0x20, 0x08, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8b, 0x0e, 0xe0, 0xa0, 
+  0xb2, 0x89, 0x0c, 0xff, 0x00, 0xb7, 0x90, 0x11, 0x5f, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x95, 0x13, 0x7b, 0x9f, 0xb3, 0x8b, 0x0d, 0xff, 0x00, 0xb5, 0x8d, 0x0f, 0xaf, 0x9d, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0xbe, 0x99, 0x12, 0x17, 0xb5, 0x8d, 0x0d, 0xdb, 0x9d, 0xb4, 0x8c, 0x0d, 0xff, 0x01, 0xb5, 0x8c, 0x0d, 0xcf, 0xbb, 0x9f, 0x19, 0x18, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbb, 
+  0x96, 0x13, 0x20, 0xb4, 0x8e, 0x0d, 0xd7, 0x9b, 0xb4, 0x8e, 0x0d, 0xff, 0x01, 0xb5, 0x8e, 0x0e, 0x9c, 0xb6, 0x9d, 0x16, 0x13, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcb, 0x97, 0x18, 0x08, 0xb6, 
+  0x90, 0x0e, 0x90, 0xb5, 0x8f, 0x0c, 0xe4, 0xb5, 0x8f, 0x0d, 0xf8, 0x86, 0xb5, 0x8f, 0x0d, 0xff, 0x82, 0xb5, 0x8f, 0x0d, 0xfb, 0x00, 0xb5, 0x8f, 0x0d, 0xfc, 0x89, 0xb5, 0x8f, 0x0d, 0xff, 0x03, 
+  0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xec, 0xb5, 0x8f, 0x0d, 0xbc, 0xb7, 0x90, 0x0d, 0x47, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xac, 0x21, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xce, 0xa5, 0x21, 0x03, 0xb7, 0x92, 0x0d, 0x18, 0xb5, 0x8f, 0x0d, 0x28, 0x84, 0xb5, 0x8f, 0x0d, 0x2f, 0x01, 0xb5, 0x8f, 0x0d, 0x2c, 0xb5, 0x8f, 0x0d, 0x2b, 0x83, 0xb5, 0x8f, 0x0d, 0x28, 0x01, 
+  0xb5, 0x8f, 0x0d, 0x2b, 0xb5, 0x8f, 0x0d, 0x2c, 0x87, 0xb5, 0x8f, 0x0d, 0x2f, 0x02, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8e, 0x0d, 0x1c, 0xba, 0x97, 0x14, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb2, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xa3, 0x1e, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb3, 0x8e, 0x0d, 0x03, 0xb4, 0x8e, 0x0d, 0x07, 0xb6, 0x8e, 0x0d, 0x04, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +192,7 @@ const lv_img_dsc_t owm_04d_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_04d_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_04d_64px_map,
 };
-
@@ -10,271 +10,175 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_04N_64PX uint8_t owm_04n_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x3b, 0x03, 0x37, 0x18, 0x37, 0x5b, 0x37, 0xa4, 0x37, 0xdb, 0x37, 0xff, 0x37, 0xff, 0x37, 0xf7, 0x37, 0xcb, 0x37, 0x8f, 0x37, 0x38, 0x3b, 0x10, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x17, 0x37, 0x98, 0x37, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xfb, 0x37, 0xdb, 0x37, 0x6b, 0x5f, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x0f, 0x00, 0x37, 0x50, 0x37, 0xdf, 0x13, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x33, 0xff, 0x37, 0xb4, 0x37, 0x23, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x6f, 0x33, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xe3, 0x3b, 0x33, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x37, 0x63, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xef, 0x37, 0xb3, 0x37, 0xe3, 0x37, 0xff, 0x37, 0xff, 0x37, 0xe3, 0x37, 0xab, 0x37, 0x5b, 0x3b, 0x14, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x27, 0x33, 0xe8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xe4, 0x37, 0x7b, 0x37, 0x07, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x00, 0x37, 0xb0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xb7, 0x37, 0x1c, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x43, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc7, 0x3b, 0x1b, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0xa7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xab, 0x3b, 0x07, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3b, 0x13, 0x3b, 0x63, 0x3b, 0xa0, 0x3b, 0xc7, 0x13, 0xf8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x50, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x3b, 0x08, 0x37, 0x74, 0x37, 0xf3, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc4, 0x13, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x5b, 0x08, 0x37, 0xc3, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x3b, 0x34, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x02, 0x00, 0x37, 0xa8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x78, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x5c, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x37, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xab, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x0b, 0x37, 0xd7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x33, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x1f, 0x13, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xb4, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x2c, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xd8, 0x37, 0x54, 0x3b, 0x0c, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0xd4, 0x3b, 0x37, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x28, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xf3, 0x37, 0x47, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x18, 0x13, 0xeb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xe4, 0x37, 0x1c, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x04, 0x13, 0xb8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xa3, 0x37, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x37, 0x13, 0xf7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x3b, 0x24, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x17, 0x70, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x00, 0x13, 0x70, 0x13, 0xf7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xa8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x17, 0x00, 0x17, 0x37, 0x13, 0xb8, 0x13, 0xeb, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x00, 0x17, 0x04, 0x13, 0x18, 0x13, 0x28, 0x13, 0x33, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x34, 0x13, 0x2f, 0x33, 0xcf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xcc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xc7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x24, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x9b, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa4, 0x33, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x38, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xec, 0x37, 0x20, 0x37, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x13, 0x00, 0x13, 0x93, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf4, 0x13, 0x50, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x37, 0x08, 0x13, 0x9f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd4, 0x37, 0x33, 0x0e, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x12, 0x00, 0x13, 0x5c, 0x13, 0xd3, 0x13, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0xf3, 0x13, 0xd3, 0x13, 0x70, 0x37, 0x07, 0x37, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x0b, 0x37, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x10, 0x00, 0x17, 0x10, 0x13, 0x23, 0x13, 0x2c, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2c, 0x13, 0x20, 0x17, 0x10, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x37, 0x00, 0x13, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x03, 0x13, 0x00, 0x17, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x33, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x08, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0xbf, 0x00, 0x37, 0x08, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x07, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x33, 0x00, 0x13, 0x00, 0x13, 0x00, 0x33, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x13, 0x00, 0x13, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x94, 0x00, 0x00, 0x04, 0x3b, 0x03, 0x37, 0x18, 0x37, 0x5b, 0x37, 0xa4, 0x37, 0xdb, 0x81, 0x37, 
+  0xff, 0x04, 0x37, 0xf7, 0x37, 0xcb, 0x37, 0x8f, 0x37, 0x38, 0x3b, 0x10, 0xb2, 0x00, 0x00, 0x02, 0x37, 0x17, 0x37, 0x98, 0x37, 0xec, 0x82, 0x13, 0xff, 0x82, 0x0f, 0xff, 0x81, 0x13, 0xff, 0x02, 
+  0x33, 0xfb, 0x37, 0xdb, 0x37, 0x6b, 0xb0, 0x00, 0x00, 0x03, 0x37, 0x50, 0x37, 0xdf, 0x13, 0xff, 0x0f, 0xff, 0x88, 0x13, 0xff, 0x03, 0x0f, 0xff, 0x33, 0xff, 0x37, 0xb4, 0x37, 0x23, 0xad, 0x00, 
+  0x00, 0x01, 0x37, 0x6f, 0x33, 0xf4, 0x8e, 0x13, 0xff, 0x01, 0x37, 0xe3, 0x3b, 0x33, 0xab, 0x00, 0x00, 0x01, 0x37, 0x63, 0x33, 0xff, 0x90, 0x13, 0xff, 0x02, 0x37, 0xef, 0x37, 0xb3, 0x37, 0xe3, 
+  0x81, 0x37, 0xff, 0x03, 0x37, 0xe3, 0x37, 0xab, 0x37, 0x5b, 0x3b, 0x14, 0xa2, 0x00, 0x00, 0x01, 0x37, 0x27, 0x33, 0xe8, 0x99, 0x13, 0xff, 0x02, 0x37, 0xe4, 0x37, 0x7b, 0x37, 0x07, 0xa0, 0x00, 
+  0x00, 0x00, 0x37, 0xb0, 0x9c, 0x13, 0xff, 0x01, 0x37, 0xb7, 0x37, 0x1c, 0x9e, 0x00, 0x00, 0x00, 0x37, 0x43, 0x9e, 0x13, 0xff, 0x01, 0x37, 0xc7, 0x3b, 0x1b, 0x9d, 0x00, 0x00, 0x00, 0x37, 0xa7, 
+  0x9f, 0x13, 0xff, 0x01, 0x37, 0xab, 0x3b, 0x07, 0x98, 0x00, 0x00, 0x04, 0x3b, 0x13, 0x3b, 0x63, 0x3b, 0xa0, 0x3b, 0xc7, 0x13, 0xf8, 0x9f, 0x13, 0xff, 0x01, 0x13, 0xfc, 0x37, 0x50, 0x96, 0x00, 
+  0x00, 0x03, 0x3b, 0x08, 0x37, 0x74, 0x37, 0xf3, 0x33, 0xff, 0xa3, 0x13, 0xff, 0x00, 0x37, 0xc4, 0x95, 0x00, 0x00, 0x02, 0x5b, 0x08, 0x37, 0xc3, 0x33, 0xff, 0xa6, 0x13, 0xff, 0x00, 0x3b, 0x34, 
+  0x94, 0x00, 0x00, 0x00, 0x37, 0xa8, 0x9b, 0x13, 0xff, 0x81, 0x33, 0xff, 0x8a, 0x13, 0xff, 0x00, 0x37, 0x78, 0x93, 0x00, 0x00, 0x00, 0x3b, 0x5c, 0x98, 0x13, 0xff, 0x81, 0x37, 0xff, 0x84, 0x33, 
+  0xff, 0x81, 0x37, 0xff, 0x00, 0x33, 0xff, 0x86, 0x13, 0xff, 0x00, 0x37, 0xab, 0x92, 0x00, 0x00, 0x01, 0x3b, 0x0b, 0x37, 0xd7, 0x97, 0x13, 0xff, 0x01, 0x37, 0xff, 0x33, 0xff, 0x82, 0x0f, 0xff, 
+  0x81, 0x13, 0xff, 0x81, 0x0f, 0xff, 0x02, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x85, 0x13, 0xff, 0x00, 0x13, 0xc7, 0x92, 0x00, 0x00, 0x01, 0x37, 0x1f, 0x13, 0xf0, 0x95, 0x13, 0xff, 0x81, 0x33, 
+  0xff, 0x8b, 0x13, 0xff, 0x00, 0x37, 0xff, 0x84, 0x13, 0xff, 0x00, 0x13, 0xb4, 0x92, 0x00, 0x00, 0x00, 0x37, 0x2c, 0x96, 0x13, 0xff, 0x00, 0x33, 0xff, 0x8d, 0x13, 0xff, 0x84, 0x37, 0xff, 0x02, 
+  0x37, 0xd8, 0x37, 0x54, 0x3b, 0x0c, 0x90, 0x00, 0x00, 0x00, 0x13, 0x33, 0x95, 0x13, 0xff, 0x00, 0x33, 0xff, 0x94, 0x13, 0xff, 0x02, 0x13, 0xfc, 0x37, 0xd4, 0x3b, 0x37, 0x8f, 0x00, 0x00, 0x01, 
+  0x13, 0x28, 0x13, 0xfb, 0x93, 0x13, 0xff, 0x00, 0x33, 0xff, 0x97, 0x13, 0xff, 0x01, 0x37, 0xf3, 0x37, 0x47, 0x8e, 0x00, 0x00, 0x01, 0x37, 0x18, 0x13, 0xeb, 0x93, 0x13, 0xff, 0x00, 0x37, 0xff, 
+  0x98, 0x13, 0xff, 0x01, 0x33, 0xe4, 0x37, 0x1c, 0x8d, 0x00, 0x00, 0x01, 0x5b, 0x04, 0x13, 0xb8, 0x90, 0x13, 0xff, 0x82, 0x37, 0xff, 0x9a, 0x13, 0xff, 0x00, 0x37, 0xa3, 0x8e, 0x00, 0x00, 0x01, 
+  0x37, 0x37, 0x13, 0xf7, 0x8d, 0x13, 0xff, 0x81, 0x37, 0xff, 0x9e, 0x13, 0xff, 0x00, 0x3b, 0x24, 0x8e, 0x00, 0x00, 0x00, 0x17, 0x70, 0x8c, 0x13, 0xff, 0x81, 0x37, 0xff, 0x9f, 0x13, 0xff, 0x00, 
+  0x37, 0x74, 0x8f, 0x00, 0x00, 0x01, 0x13, 0x70, 0x13, 0xf7, 0x89, 0x13, 0xff, 0x01, 0x17, 0xff, 0x37, 0xff, 0xa0, 0x13, 0xff, 0x00, 0x37, 0xa8, 0x90, 0x00, 0x00, 0x03, 0x17, 0x37, 0x13, 0xb8, 
+  0x13, 0xeb, 0x13, 0xfb, 0x86, 0x13, 0xff, 0x00, 0x37, 0xff, 0xa1, 0x13, 0xff, 0x00, 0x13, 0xc0, 0x91, 0x00, 0x00, 0x03, 0x17, 0x04, 0x13, 0x18, 0x13, 0x28, 0x13, 0x33, 0x84, 0x13, 0x34, 0x01, 
+  0x13, 0x2f, 0x33, 0xcf, 0xa1, 0x13, 0xff, 0x00, 0x13, 0xa8, 0x9b, 0x00, 0x00, 0x00, 0x13, 0xcc, 0xa1, 0x13, 0xff, 0x00, 0x37, 0x74, 0x9b, 0x00, 0x00, 0x00, 0x13, 0xc7, 0xa1, 0x13, 0xff, 0x00, 
+  0x37, 0x24, 0x9b, 0x00, 0x00, 0x00, 0x13, 0x9b, 0xa0, 0x13, 0xff, 0x00, 0x13, 0xa4, 0x9c, 0x00, 0x00, 0x00, 0x37, 0x38, 0x9f, 0x13, 0xff, 0x01, 0x13, 0xec, 0x37, 0x20, 0x9d, 0x00, 0x00, 0x00, 
+  0x13, 0x93, 0x9d, 0x13, 0xff, 0x01, 0x13, 0xf4, 0x13, 0x50, 0x9e, 0x00, 0x00, 0x01, 0x37, 0x08, 0x13, 0x9f, 0x9b, 0x13, 0xff, 0x01, 0x13, 0xd4, 0x37, 0x33, 0xa1, 0x00, 0x00, 0x02, 0x13, 0x5c, 
+  0x13, 0xd3, 0x13, 0xf4, 0x94, 0x13, 0xff, 0x04, 0x13, 0xfc, 0x13, 0xf3, 0x13, 0xd3, 0x13, 0x70, 0x37, 0x07, 0x9b, 0x00, 0x00, 0x00, 0x37, 0x0b, 0x86, 0x00, 0x00, 0x02, 0x17, 0x10, 0x13, 0x23, 
+  0x13, 0x2c, 0x93, 0x13, 0x2f, 0x02, 0x13, 0x2c, 0x13, 0x20, 0x17, 0x10, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x13, 0x03, 0xbe, 0x00, 0x00, 0x00, 0x37, 0x08, 0x8b, 0x00, 
+  0x00, 0x00, 0x37, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x13, 0x07, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xee, 
+  0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x5d, 0x2e, 0x03, 0x9a, 0x25, 0x18, 0x3a, 0x25, 0x5b, 0x19, 0x25, 0xa4, 0x19, 0x25, 0xdb, 0x19, 0x25, 0xff, 0x19, 0x25, 0xff, 0x19, 0x25, 0xf7, 0x19, 0x1d, 0xcb, 0x19, 0x25, 0x8f, 0x5a, 0x25, 0x38, 0x9a, 0x25, 0x10, 0x19, 0x25, 0x00, 0x7b, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x9b, 0x25, 0x17, 0x5a, 0x25, 0x98, 0x98, 0x1c, 0xec, 0xf6, 0x13, 0xff, 0xb6, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x37, 0x14, 0xfb, 0xd8, 0x1c, 0xdb, 0x7a, 0x25, 0x6b, 0xff, 0x47, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x14, 0x03, 0x00, 0x3a, 0x25, 0x50, 0xd9, 0x1c, 0xdf, 0xf6, 0x13, 0xff, 0x75, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x19, 0x1d, 0xb4, 0x7a, 0x25, 0x23, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x5a, 0x25, 0x6f, 0x57, 0x14, 0xf4, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb8, 0x1c, 0xe3, 0xbb, 0x2d, 0x33, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0xd7, 0x13, 0x00, 0x5a, 0x25, 0x63, 0x57, 0x14, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb8, 0x1c, 0xef, 0x39, 0x25, 0xb3, 0x39, 0x25, 0xe3, 0x19, 0x25, 0xff, 0x19, 0x25, 0xff, 0x39, 0x25, 0xe3, 0x39, 0x25, 0xab, 0x5a, 0x25, 0x5b, 0xbb, 0x25, 0x14, 0x5a, 0x1d, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x25, 0x00, 0x5a, 0x25, 0x27, 0x57, 0x14, 0xe8, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xe4, 0x7a, 0x25, 0x7b, 0x9b, 0x25, 0x07, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x2d, 0x00, 0xb7, 0x04, 0x00, 0xf8, 0x1c, 0xb0, 0xd5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x19, 0x1d, 0xb7, 0x7a, 0x25, 0x1c, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x7a, 0x2d, 0x43, 0x16, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x1c, 0xc7, 0xdb, 0x2d, 0x1b, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0xd8, 0x1c, 0x00, 0xb8, 0x1c, 0xa7, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x1d, 0xab, 0xdb, 0x2d, 0x07, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0x9a, 0x2d, 0x00, 0xdb, 0x2d, 0x13, 0xbb, 0x2d, 0x63, 0xbb, 0x2d, 0xa0, 0x9a, 0x2d, 0xc7, 0x36, 0x14, 0xf8, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xfc, 0x5a, 0x25, 0x50, 0x9b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x2d, 0x00, 0x1c, 0x2e, 0x08, 0x7a, 0x25, 0x74, 0x19, 0x1d, 0xf3, 0x97, 0x14, 0xff, 0x16, 0x0c, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xb8, 0x1c, 0xc4, 0x37, 0x0c, 0x00, 0xbb, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x2d, 0x00, 0x3c, 0x36, 0x08, 0x39, 0x25, 0xc3, 0x57, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x36, 0x14, 0xff, 0xbb, 0x2d, 0x34, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x2d, 0x00, 0x10, 0x00, 0x00, 0x59, 0x25, 0xa8, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xff, 0x57, 0x14, 0xff, 0x57, 0x14, 0xff, 0x57, 0x14, 0xff, 0x56, 0x14, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x1d, 0x78, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x5c, 0x57, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0xb8, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0x78, 0x1c, 0xff, 0x37, 0x14, 0xff, 0x16, 0x14, 0xff, 0x17, 0x14, 0xff, 0x57, 0x14, 0xff, 0x98, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x97, 0x14, 0xab, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x0b, 0xd8, 0x1c, 0xd7, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x57, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x37, 0x14, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x98, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x56, 0x14, 0xc7, 0x56, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0x1f, 0x56, 0x14, 0xf0, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0x77, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xd6, 0x13, 0xff, 0xb8, 0x1c, 0xff, 0x56, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x14, 0xff, 0x36, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xb4, 0xb8, 0x1c, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x1c, 0x2c, 0x56, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x77, 0x14, 0xff, 0x98, 0x1c, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd8, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xd8, 0x5a, 0x25, 0x54, 0xbb, 0x2d, 0x0c, 0x7a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0x33, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xff, 0x97, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x37, 0x14, 0xfc, 0xf9, 0x1c, 0xd4, 0xba, 0x25, 0x37, 0x9a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x28, 0x56, 0x0c, 0xfb, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb8, 0x1c, 0xf3, 0x7a, 0x25, 0x47, 0xf9, 0x1c, 0x00, 0x5a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x1c, 0x18, 0x76, 0x14, 0xeb, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0x97, 0x1c, 0xe4, 0x7a, 0x2d, 0x1c, 0x3c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x36, 0x04, 0x76, 0x14, 0xb8, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x56, 0x14, 0xff, 0x97, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x18, 0x1d, 0xff, 0x39, 0x25, 0xff, 0x16, 0x0c, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x1d, 0xa3, 0x39, 0x25, 0x00, 0xda, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1c, 0x00, 0xf8, 0x1c, 0x37, 0x76, 0x14, 0xf7, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x0c, 0xff, 0xf8, 0x1c, 0xff, 0xf8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x16, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x57, 0x14, 0xff, 0xfc, 0x2d, 0x24, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1d, 0x00, 0xd8, 0x1c, 0x00, 0xb7, 0x14, 0x70, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x97, 0x1c, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x39, 0x25, 0x74, 0x19, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x00, 0xf7, 0x0c, 0x00, 0x76, 0x14, 0x70, 0x76, 0x14, 0xf7, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0xb7, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x97, 0x14, 0xa8, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x97, 0x14, 0x00, 0xb7, 0x14, 0x37, 0x97, 0x14, 0xb8, 0x97, 0x14, 0xeb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0xf8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x56, 0x14, 0xc0, 0x56, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x00, 0xb7, 0x14, 0x00, 0xd7, 0x14, 0x04, 0x77, 0x14, 0x18, 0x97, 0x14, 0x28, 0x97, 0x14, 0x33, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x14, 0x34, 0x97, 0x0c, 0x2f, 0x97, 0x14, 0xcf, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0xa8, 0x56, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0c, 0x00, 0x56, 0x14, 0xcc, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xb7, 0x14, 0x74, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0c, 0x00, 0x56, 0x0c, 0xc7, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x59, 0x25, 0x24, 0x18, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x9b, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x77, 0x14, 0xa4, 0x98, 0x1c, 0x00, 0x3f, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1c, 0x00, 0x18, 0x1d, 0x38, 0x56, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xec, 0xb7, 0x14, 0x20, 0x38, 0x1d, 0x00, 0xae, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x25, 0x00, 0xb5, 0x03, 0x00, 0x97, 0x14, 0x93, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xf4, 0x97, 0x14, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0xba, 0x25, 0x00, 0x18, 0x1d, 0x08, 0x97, 0x14, 0x9f, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xd4, 0xb7, 0x14, 0x33, 0x33, 0x03, 0x00, 0xf9, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x25, 0x00, 0x33, 0x04, 0x00, 0x97, 0x14, 0x5c, 0x97, 0x0c, 0xd3, 0x97, 0x14, 0xf4, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xfc, 0x97, 0x14, 0xf3, 0x97, 0x14, 0xd3, 0x97, 0x14, 0x70, 0x58, 0x2d, 0x07, 0xd7, 0x1c, 0x00, 0xb7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x0b, 0x5a, 0x25, 0x00, 0xb2, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x1c, 0x00, 0x3f, 0x2d, 0x00, 0xc4, 0x03, 0x00, 0xb7, 0x14, 0x10, 0x97, 0x14, 0x23, 0x97, 0x14, 0x2c, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2c, 0x77, 0x14, 0x20, 0x97, 0x14, 0x10, 0x00, 0x00, 0x00, 0xd8, 0x1c, 0x00, 0xb7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x1b, 0x1d, 0x00, 0x18, 0x25, 0x00, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x25, 0x00, 0x57, 0x14, 0x00, 0xd6, 0x0b, 0x00, 0x36, 0x14, 0x00, 0x70, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2d, 0x00, 0xf8, 0x1c, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x0a, 0x00, 0x76, 0x14, 0x00, 0x9d, 0x1d, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x12, 0x00, 0xf9, 0x24, 0x00, 0x37, 0x14, 0x00, 0x2b, 0x0a, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x14, 0x00, 0x77, 0x14, 0x03, 0x76, 0x14, 0x00, 0xd9, 0x14, 0x00, 0x36, 0x0c, 0x00, 0xd8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x13, 0x00, 0x37, 0x14, 0x00, 0xd5, 0x0b, 0x00, 0x7b, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x08, 0xf5, 0x0b, 0x00, 0x56, 0x14, 0x00, 0xf4, 0x0b, 0x00, 0xd3, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x2d, 0x00, 0x1f, 0xa7, 0x00, 0x5a, 0x25, 0x08, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x25, 0x00, 0xf6, 0x0b, 0x00, 0xf6, 0x0b, 0x00, 0x57, 0x14, 0x00, 0xb5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x76, 0x0c, 0x07, 0x97, 0x14, 0x00, 0x97, 0x0c, 0x00, 0x77, 0x0c, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x7b, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x1c, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0xf6, 0x0b, 0x00, 0xd7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x0c, 0x00, 0x97, 0x14, 0x00, 0x97, 0x0c, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x18, 0x25, 0x00, 0x1b, 0x1d, 0x00, 0x18, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x14, 0x00, 0x56, 0x0c, 0x00, 0x56, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x35, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x25, 0x00, 0xf6, 0x0b, 0x00, 0xd6, 0x0b, 0x00, 0xd8, 0x1c, 0x00, 0x2a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0x00, 0x77, 0x14, 0x00, 0x77, 0x14, 0x00, 0x77, 0x0c, 0x00, 0xf3, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0xf6, 0x0b, 0x00, 0x18, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x2b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2d, 0x00, 0xc9, 0x01, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x55, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x09, 0x00, 0x39, 0x1d, 0x00, 0x7b, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x0c, 0x00, 0x96, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x24, 0x00, 0xd6, 0x0b, 0x00, 0x17, 0x14, 0x00, 0x95, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x67, 0x01, 0x00, 0x14, 0x0c, 0x00, 0x14, 0x0c, 0x00, 0x35, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x0a, 0x00, 0xf8, 0x1c, 0x00, 0xd5, 0x0b, 0x00, 0xd5, 0x0b, 0x00, 0x97, 0x1c, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x0a, 0x00, 0x77, 0x14, 0x00, 0x16, 0x0c, 0x00, 0x16, 0x0c, 0x00, 0x77, 0x14, 0x00, 0xad, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x56, 0x14, 0x00, 0x36, 0x0c, 0x00, 0x36, 0x0c, 0x00, 0x77, 0x14, 0x00, 0x4b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x77, 0x14, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x00, 0x97, 0x14, 0x00, 0x6c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0b, 0x00, 0x14, 0x0c, 0x00, 0x14, 0x0c, 0x00, 0x92, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x04, 0x5d, 0x2e, 0x03, 0x9a, 0x25, 0x18, 0x3a, 
+  0x25, 0x5b, 0x19, 0x25, 0xa4, 0x19, 0x25, 0xdb, 0x81, 0x19, 0x25, 0xff, 0x04, 0x19, 0x25, 0xf7, 0x19, 0x1d, 0xcb, 0x19, 0x25, 0x8f, 0x5a, 0x25, 0x38, 0x9a, 0x25, 0x10, 0xb2, 0x00, 0x00, 0x00, 
+  0x04, 0x9b, 0x25, 0x17, 0x5a, 0x25, 0x98, 0x98, 0x1c, 0xec, 0xf6, 0x13, 0xff, 0xb6, 0x0b, 0xff, 0x81, 0x95, 0x0b, 0xff, 0x06, 0x75, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 
+  0xff, 0x37, 0x14, 0xfb, 0xd8, 0x1c, 0xdb, 0x7a, 0x25, 0x6b, 0xb0, 0x00, 0x00, 0x00, 0x03, 0x3a, 0x25, 0x50, 0xd9, 0x1c, 0xdf, 0xf6, 0x13, 0xff, 0x75, 0x0b, 0xff, 0x89, 0x95, 0x0b, 0xff, 0x02, 
+  0x37, 0x14, 0xff, 0x19, 0x1d, 0xb4, 0x7a, 0x25, 0x23, 0xad, 0x00, 0x00, 0x00, 0x02, 0x5a, 0x25, 0x6f, 0x57, 0x14, 0xf4, 0xb5, 0x0b, 0xff, 0x8c, 0x95, 0x0b, 0xff, 0x02, 0xd6, 0x0b, 0xff, 0xb8, 
+  0x1c, 0xe3, 0xbb, 0x2d, 0x33, 0xab, 0x00, 0x00, 0x00, 0x02, 0x5a, 0x25, 0x63, 0x57, 0x14, 0xff, 0x95, 0x0b, 0xff, 0x8e, 0xb5, 0x0b, 0xff, 0x03, 0x95, 0x0b, 0xff, 0xb8, 0x1c, 0xef, 0x39, 0x25, 
+  0xb3, 0x39, 0x25, 0xe3, 0x81, 0x19, 0x25, 0xff, 0x03, 0x39, 0x25, 0xe3, 0x39, 0x25, 0xab, 0x5a, 0x25, 0x5b, 0xbb, 0x25, 0x14, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x25, 0x27, 0x57, 0x14, 0xe8, 
+  0x92, 0xb5, 0x0b, 0xff, 0x00, 0xd6, 0x0b, 0xff, 0x83, 0xb5, 0x0b, 0xff, 0x04, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xe4, 0x7a, 0x25, 0x7b, 0x9b, 0x25, 0x07, 0xa0, 0x00, 0x00, 0x00, 
+  0x01, 0xf8, 0x1c, 0xb0, 0xd5, 0x0b, 0xff, 0x9a, 0xb5, 0x0b, 0xff, 0x02, 0x37, 0x14, 0xff, 0x19, 0x1d, 0xb7, 0x7a, 0x25, 0x1c, 0x9e, 0x00, 0x00, 0x00, 0x02, 0x7a, 0x2d, 0x43, 0x16, 0x14, 0xff, 
+  0xb5, 0x0b, 0xff, 0x9a, 0xd5, 0x0b, 0xff, 0x03, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x1c, 0xc7, 0xdb, 0x2d, 0x1b, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xb8, 0x1c, 0xa7, 0xb5, 0x0b, 0xff, 0x9d, 
+  0xd5, 0x0b, 0xff, 0x02, 0xf6, 0x0b, 0xff, 0x19, 0x1d, 0xab, 0xdb, 0x2d, 0x07, 0x98, 0x00, 0x00, 0x00, 0x04, 0xdb, 0x2d, 0x13, 0xbb, 0x2d, 0x63, 0xbb, 0x2d, 0xa0, 0x9a, 0x2d, 0xc7, 0x36, 0x14, 
+  0xf8, 0x9f, 0xd6, 0x0b, 0xff, 0x01, 0x36, 0x14, 0xfc, 0x5a, 0x25, 0x50, 0x96, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x2e, 0x08, 0x7a, 0x25, 0x74, 0x19, 0x1d, 0xf3, 0x97, 0x14, 0xff, 0x16, 0x0c, 0xff, 
+  0xd5, 0x0b, 0xff, 0xa1, 0xf6, 0x0b, 0xff, 0x00, 0xb8, 0x1c, 0xc4, 0x95, 0x00, 0x00, 0x00, 0x02, 0x3c, 0x36, 0x08, 0x39, 0x25, 0xc3, 0x57, 0x14, 0xff, 0xa5, 0xf6, 0x0b, 0xff, 0x01, 0x36, 0x14, 
+  0xff, 0xbb, 0x2d, 0x34, 0x94, 0x00, 0x00, 0x00, 0x01, 0x59, 0x25, 0xa8, 0x36, 0x14, 0xff, 0x98, 0x16, 0x0c, 0xff, 0x00, 0x36, 0x14, 0xff, 0x82, 0x57, 0x14, 0xff, 0x01, 0x56, 0x14, 0xff, 0x36, 
+  0x14, 0xff, 0x87, 0x16, 0x0c, 0xff, 0x01, 0xf6, 0x0b, 0xff, 0x19, 0x1d, 0x78, 0x93, 0x00, 0x00, 0x00, 0x01, 0x9a, 0x25, 0x5c, 0x57, 0x14, 0xff, 0x97, 0x16, 0x0c, 0xff, 0x09, 0xb8, 0x1c, 0xff, 
+  0xf9, 0x1c, 0xff, 0x78, 0x1c, 0xff, 0x37, 0x14, 0xff, 0x16, 0x14, 0xff, 0x17, 0x14, 0xff, 0x57, 0x14, 0xff, 0x98, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x86, 0x16, 0x0c, 0xff, 0x00, 
+  0x97, 0x14, 0xab, 0x92, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x36, 0x0b, 0xd8, 0x1c, 0xd7, 0x96, 0x16, 0x0c, 0xff, 0x02, 0x57, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x37, 0x14, 0xff, 0x85, 0x95, 0x0b, 0xff, 
+  0x04, 0x75, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x98, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x0c, 0xff, 0x84, 0x16, 0x0c, 0xff, 0x00, 0x56, 0x14, 0xc7, 0x92, 0x00, 0x00, 0x00, 0x01, 0x39, 0x25, 0x1f, 
+  0x56, 0x14, 0xf0, 0x95, 0x36, 0x0c, 0xff, 0x02, 0x97, 0x14, 0xff, 0x77, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0x89, 0x95, 0x0b, 0xff, 0x03, 0xd6, 0x13, 0xff, 0xb8, 0x1c, 0xff, 0x56, 0x14, 0xff, 0x36, 
+  0x0c, 0xff, 0x81, 0x36, 0x14, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xb4, 0x92, 0x00, 0x00, 0x00, 0x01, 0xb7, 0x1c, 0x2c, 0x56, 0x14, 0xff, 0x94, 0x36, 0x0c, 0xff, 0x02, 0x77, 0x14, 0xff, 
+  0x98, 0x1c, 0xff, 0x95, 0x0b, 0xff, 0x8c, 0xb5, 0x0b, 0xff, 0x00, 0xd8, 0x1c, 0xff, 0x83, 0xf9, 0x1c, 0xff, 0x02, 0xf9, 0x1c, 0xd8, 0x5a, 0x25, 0x54, 0xbb, 0x2d, 0x0c, 0x90, 0x00, 0x00, 0x00, 
+  0x00, 0x56, 0x14, 0x33, 0x94, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xff, 0x97, 0x14, 0xff, 0x93, 0xb5, 0x0b, 0xff, 0x03, 0xd6, 0x0b, 0xff, 0x37, 0x14, 0xfc, 0xf9, 0x1c, 0xd4, 0xba, 0x25, 0x37, 
+  0x8f, 0x00, 0x00, 0x00, 0x01, 0x76, 0x14, 0x28, 0x56, 0x0c, 0xfb, 0x93, 0x56, 0x0c, 0xff, 0x01, 0x97, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0x96, 0xb5, 0x0b, 0xff, 0x01, 0xb8, 0x1c, 0xf3, 0x7a, 0x25, 
+  0x47, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xd8, 0x1c, 0x18, 0x76, 0x14, 0xeb, 0x90, 0x56, 0x14, 0xff, 0x82, 0x56, 0x0c, 0xff, 0x00, 0x97, 0x14, 0xff, 0x98, 0xd5, 0x0b, 0xff, 0x01, 0x97, 0x1c, 0xe4, 
+  0x7a, 0x2d, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x36, 0x04, 0x76, 0x14, 0xb8, 0x8e, 0x76, 0x14, 0xff, 0x05, 0x56, 0x14, 0xff, 0x97, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x18, 0x1d, 0xff, 0x39, 
+  0x25, 0xff, 0x16, 0x0c, 0xff, 0x98, 0xd6, 0x0b, 0xff, 0x01, 0xf6, 0x0b, 0xff, 0x19, 0x1d, 0xa3, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x1c, 0x37, 0x76, 0x14, 0xf7, 0x8c, 0x76, 0x14, 0xff, 0x00, 
+  0x76, 0x0c, 0xff, 0x81, 0xf8, 0x1c, 0xff, 0x01, 0x57, 0x14, 0xff, 0x16, 0x14, 0xff, 0x9b, 0xf6, 0x0b, 0xff, 0x01, 0x57, 0x14, 0xff, 0xfc, 0x2d, 0x24, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 
+  0x70, 0x8c, 0x76, 0x14, 0xff, 0x01, 0xd8, 0x1c, 0xff, 0x97, 0x1c, 0xff, 0x9f, 0xf6, 0x0b, 0xff, 0x00, 0x39, 0x25, 0x74, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x76, 0x14, 0x70, 0x76, 0x14, 0xf7, 0x89, 
+  0x76, 0x14, 0xff, 0x01, 0xb7, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xa0, 0x16, 0x0c, 0xff, 0x00, 0x97, 0x14, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x03, 0xb7, 0x14, 0x37, 0x97, 0x14, 0xb8, 0x97, 0x14, 0xeb, 
+  0x97, 0x14, 0xfb, 0x86, 0x97, 0x14, 0xff, 0x00, 0xf8, 0x1c, 0xff, 0xa1, 0x16, 0x0c, 0xff, 0x00, 0x56, 0x14, 0xc0, 0x91, 0x00, 0x00, 0x00, 0x03, 0xd7, 0x14, 0x04, 0x77, 0x14, 0x18, 0x97, 0x14, 
+  0x28, 0x97, 0x14, 0x33, 0x84, 0x97, 0x14, 0x34, 0x01, 0x97, 0x0c, 0x2f, 0x97, 0x14, 0xcf, 0xa1, 0x36, 0x0c, 0xff, 0x00, 0x56, 0x14, 0xa8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0xcc, 0xa1, 
+  0x36, 0x0c, 0xff, 0x00, 0xb7, 0x14, 0x74, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x56, 0x0c, 0xc7, 0xa1, 0x56, 0x0c, 0xff, 0x00, 0x59, 0x25, 0x24, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x9b, 0xa0, 
+  0x56, 0x0c, 0xff, 0x00, 0x77, 0x14, 0xa4, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x18, 0x1d, 0x38, 0x56, 0x14, 0xff, 0x9e, 0x76, 0x14, 0xff, 0x01, 0x76, 0x14, 0xec, 0xb7, 0x14, 0x20, 0x9d, 0x00, 0x00, 
+  0x00, 0x00, 0x97, 0x14, 0x93, 0x9d, 0x76, 0x14, 0xff, 0x01, 0x76, 0x14, 0xf4, 0x97, 0x14, 0x50, 0x9e, 0x00, 0x00, 0x00, 0x01, 0x18, 0x1d, 0x08, 0x97, 0x14, 0x9f, 0x9b, 0x76, 0x14, 0xff, 0x01, 
+  0x76, 0x14, 0xd4, 0xb7, 0x14, 0x33, 0xa1, 0x00, 0x00, 0x00, 0x02, 0x97, 0x14, 0x5c, 0x97, 0x0c, 0xd3, 0x97, 0x14, 0xf4, 0x94, 0x97, 0x14, 0xff, 0x04, 0x97, 0x14, 0xfc, 0x97, 0x14, 0xf3, 0x97, 
+  0x14, 0xd3, 0x97, 0x14, 0x70, 0x58, 0x2d, 0x07, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x0b, 0x86, 0x00, 0x00, 0x00, 0x02, 0xb7, 0x14, 0x10, 0x97, 0x14, 0x23, 0x97, 0x14, 0x2c, 0x93, 0x97, 
+  0x14, 0x2f, 0x02, 0x97, 0x14, 0x2c, 0x77, 0x14, 0x20, 0x97, 0x14, 0x10, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x77, 0x14, 0x03, 0xbe, 0x00, 0x00, 0x00, 
+  0x00, 0x97, 0x14, 0x08, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x25, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x32, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x2d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x7a, 0x00, 0x2e, 0x5d, 0x03, 0x25, 0x9a, 0x18, 0x25, 0x3a, 0x5b, 0x25, 0x19, 0xa4, 0x25, 0x19, 0xdb, 0x25, 0x19, 0xff, 0x25, 0x19, 0xff, 0x25, 0x19, 0xf7, 0x1d, 0x19, 0xcb, 0x25, 0x19, 0x8f, 0x25, 0x5a, 0x38, 0x25, 0x9a, 0x10, 0x25, 0x19, 0x00, 0x25, 0x7b, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x9b, 0x17, 0x25, 0x5a, 0x98, 0x1c, 0x98, 0xec, 0x13, 0xf6, 0xff, 0x0b, 0xb6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x37, 0xfb, 0x1c, 0xd8, 0xdb, 0x25, 0x7a, 0x6b, 0x47, 0xff, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x03, 0x14, 0x00, 0x25, 0x3a, 0x50, 0x1c, 0xd9, 0xdf, 0x13, 0xf6, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x37, 0xff, 0x1d, 0x19, 0xb4, 0x25, 0x7a, 0x23, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x5a, 0x6f, 0x14, 0x57, 0xf4, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0xb8, 0xe3, 0x2d, 0xbb, 0x33, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x13, 0xd7, 0x00, 0x25, 0x5a, 0x63, 0x14, 0x57, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x1c, 0xb8, 0xef, 0x25, 0x39, 0xb3, 0x25, 0x39, 0xe3, 0x25, 0x19, 0xff, 0x25, 0x19, 0xff, 0x25, 0x39, 0xe3, 0x25, 0x39, 0xab, 0x25, 0x5a, 0x5b, 0x25, 0xbb, 0x14, 0x1d, 0x5a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7b, 0x00, 0x25, 0x5a, 0x27, 0x14, 0x57, 0xe8, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xe4, 0x25, 0x7a, 0x7b, 0x25, 0x9b, 0x07, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9b, 0x00, 0x04, 0xb7, 0x00, 0x1c, 0xf8, 0xb0, 0x0b, 0xd5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x37, 0xff, 0x1d, 0x19, 0xb7, 0x25, 0x7a, 0x1c, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x2d, 0x7a, 0x43, 0x14, 0x16, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xf9, 0xc7, 0x2d, 0xdb, 0x1b, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x1c, 0xd8, 0x00, 0x1c, 0xb8, 0xa7, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x1d, 0x19, 0xab, 0x2d, 0xdb, 0x07, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9a, 0x00, 0x2d, 0x9a, 0x00, 0x2d, 0xdb, 0x13, 0x2d, 0xbb, 0x63, 0x2d, 0xbb, 0xa0, 0x2d, 0x9a, 0xc7, 0x14, 0x36, 0xf8, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xfc, 0x25, 0x5a, 0x50, 0x2d, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xbb, 0x00, 0x2e, 0x1c, 0x08, 0x25, 0x7a, 0x74, 0x1d, 0x19, 0xf3, 0x14, 0x97, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xb8, 0xc4, 0x0c, 0x37, 0x00, 0x2d, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xba, 0x00, 0x36, 0x3c, 0x08, 0x25, 0x39, 0xc3, 0x14, 0x57, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x36, 0xff, 0x2d, 0xbb, 0x34, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xda, 0x00, 0x00, 0x10, 0x00, 0x25, 0x59, 0xa8, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xff, 0x14, 0x57, 0xff, 0x14, 0x57, 0xff, 0x14, 0x57, 0xff, 0x14, 0x56, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x1d, 0x19, 0x78, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x5c, 0x14, 0x57, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x1c, 0xb8, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0x78, 0xff, 0x14, 0x37, 0xff, 0x14, 0x16, 0xff, 0x14, 0x17, 0xff, 0x14, 0x57, 0xff, 0x1c, 0x98, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x77, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x97, 0xab, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3c, 0x0b, 0x1c, 0xd8, 0xd7, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x57, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x37, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0xb5, 0xff, 0x1c, 0x98, 0xff, 0x1c, 0xb8, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x56, 0xc7, 0x14, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x39, 0x1f, 0x14, 0x56, 0xf0, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x14, 0x77, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x13, 0xd6, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x36, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xb4, 0x1c, 0xb8, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb7, 0x2c, 0x14, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x77, 0xff, 0x1c, 0x98, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xd8, 0x25, 0x5a, 0x54, 0x2d, 0xbb, 0x0c, 0x25, 0x7a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0x33, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x97, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x37, 0xfc, 0x1c, 0xf9, 0xd4, 0x25, 0xba, 0x37, 0x25, 0x9a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x28, 0x0c, 0x56, 0xfb, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x97, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x1c, 0xb8, 0xf3, 0x25, 0x7a, 0x47, 0x1c, 0xf9, 0x00, 0x2d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd8, 0x18, 0x14, 0x76, 0xeb, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x97, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x1c, 0x97, 0xe4, 0x2d, 0x7a, 0x1c, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3b, 0x04, 0x14, 0x76, 0xb8, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x56, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xd8, 0xff, 0x1d, 0x18, 0xff, 0x25, 0x39, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xf6, 0xff, 0x1d, 0x19, 0xa3, 0x25, 0x39, 0x00, 0x1d, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x1c, 0xf8, 0x37, 0x14, 0x76, 0xf7, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x1c, 0xf8, 0xff, 0x1c, 0xf8, 0xff, 0x14, 0x57, 0xff, 0x14, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x57, 0xff, 0x2d, 0xfc, 0x24, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x18, 0x00, 0x1c, 0xd8, 0x00, 0x14, 0xb7, 0x70, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0x97, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x39, 0x74, 0x25, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x00, 0x0c, 0xf7, 0x00, 0x14, 0x76, 0x70, 0x14, 0x76, 0xf7, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0xb7, 0xff, 0x1c, 0xb8, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x97, 0xa8, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x00, 0x14, 0x97, 0x00, 0x14, 0xb7, 0x37, 0x14, 0x97, 0xb8, 0x14, 0x97, 0xeb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xf8, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x56, 0xc0, 0x14, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x00, 0x14, 0xb7, 0x00, 0x14, 0xd7, 0x04, 0x14, 0x77, 0x18, 0x14, 0x97, 0x28, 0x14, 0x97, 0x33, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x14, 0x97, 0x34, 0x0c, 0x97, 0x2f, 0x14, 0x97, 0xcf, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0xa8, 0x14, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x56, 0x00, 0x14, 0x56, 0xcc, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0xb7, 0x74, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x56, 0xc7, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x25, 0x59, 0x24, 0x1d, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x9b, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x77, 0xa4, 0x1c, 0x98, 0x00, 0x44, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x1d, 0x18, 0x38, 0x14, 0x56, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xec, 0x14, 0xb7, 0x20, 0x1d, 0x38, 0x00, 0x03, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xda, 0x00, 0x03, 0xb5, 0x00, 0x14, 0x97, 0x93, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xf4, 0x14, 0x97, 0x50, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x00, 0x25, 0xba, 0x00, 0x1d, 0x18, 0x08, 0x14, 0x97, 0x9f, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xd4, 0x14, 0xb7, 0x33, 0x03, 0x33, 0x00, 0x2d, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5b, 0x00, 0x04, 0x33, 0x00, 0x14, 0x97, 0x5c, 0x0c, 0x97, 0xd3, 0x14, 0x97, 0xf4, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xfc, 0x14, 0x97, 0xf3, 0x14, 0x97, 0xd3, 0x14, 0x97, 0x70, 0x2d, 0x58, 0x07, 0x1c, 0xd7, 0x00, 0x25, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x0b, 0x25, 0x5a, 0x00, 0x13, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd9, 0x00, 0x2d, 0x3f, 0x00, 0x03, 0xc4, 0x00, 0x14, 0xb7, 0x10, 0x14, 0x97, 0x23, 0x14, 0x97, 0x2c, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2c, 0x14, 0x77, 0x20, 0x14, 0x97, 0x10, 0x00, 0x00, 0x00, 0x1c, 0xd8, 0x00, 0x1c, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7b, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x1d, 0x1b, 0x00, 0x25, 0x18, 0x00, 0x13, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x17, 0x00, 0x14, 0x57, 0x00, 0x0b, 0xd6, 0x00, 0x14, 0x36, 0x00, 0x13, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x19, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xef, 0x00, 0x14, 0x76, 0x00, 0x1d, 0x9d, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x4b, 0x00, 0x24, 0xf9, 0x00, 0x14, 0x37, 0x00, 0x0a, 0x2b, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 0x00, 0x14, 0x77, 0x03, 0x14, 0x76, 0x00, 0x14, 0xd9, 0x00, 0x0c, 0x36, 0x00, 0x1c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x70, 0x00, 0x14, 0x37, 0x00, 0x0b, 0xd5, 0x00, 0x25, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x08, 0x0b, 0xf5, 0x00, 0x14, 0x56, 0x00, 0x0b, 0xf4, 0x00, 0x0b, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5b, 0x00, 0xa7, 0x1f, 0x00, 0x25, 0x5a, 0x08, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x0b, 0xf6, 0x00, 0x0b, 0xf6, 0x00, 0x14, 0x57, 0x00, 0x24, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x0c, 0x76, 0x07, 0x14, 0x97, 0x00, 0x0c, 0x97, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf9, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x0b, 0xf6, 0x00, 0x1c, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x97, 0x00, 0x0c, 0x97, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x13, 0x0f, 0x00, 0x25, 0x18, 0x00, 0x1d, 0x1b, 0x00, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x36, 0x00, 0x14, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x9a, 0x00, 0x0b, 0xf6, 0x00, 0x0b, 0xd6, 0x00, 0x1c, 0xd8, 0x00, 0x0a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0x00, 0x14, 0x77, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x13, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x39, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x0b, 0xf6, 0x00, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x02, 0x2b, 0x00, 0x02, 0x0b, 0x00, 0x02, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x19, 0x00, 0x01, 0xc9, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x14, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xea, 0x00, 0x1d, 0x39, 0x00, 0x25, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd8, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x00, 0x0c, 0x56, 0x00, 0x1c, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf8, 0x00, 0x0b, 0xd6, 0x00, 0x14, 0x17, 0x00, 0x1c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x67, 0x00, 0x0c, 0x14, 0x00, 0x0c, 0x14, 0x00, 0x0c, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xad, 0x00, 0x1c, 0xf8, 0x00, 0x0b, 0xd5, 0x00, 0x0b, 0xd5, 0x00, 0x1c, 0x97, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x8c, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x16, 0x00, 0x14, 0x77, 0x00, 0x0a, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x00, 0x14, 0x56, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x36, 0x00, 0x14, 0x77, 0x00, 0x0a, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x00, 0x14, 0x77, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x00, 0x14, 0x97, 0x00, 0x0a, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x92, 0x00, 0x0c, 0x14, 0x00, 0x0c, 0x14, 0x00, 0x0b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x04, 0x2e, 0x5d, 0x03, 0x25, 0x9a, 0x18, 0x25, 
+  0x3a, 0x5b, 0x25, 0x19, 0xa4, 0x25, 0x19, 0xdb, 0x81, 0x25, 0x19, 0xff, 0x04, 0x25, 0x19, 0xf7, 0x1d, 0x19, 0xcb, 0x25, 0x19, 0x8f, 0x25, 0x5a, 0x38, 0x25, 0x9a, 0x10, 0xb2, 0x00, 0x00, 0x00, 
+  0x04, 0x25, 0x9b, 0x17, 0x25, 0x5a, 0x98, 0x1c, 0x98, 0xec, 0x13, 0xf6, 0xff, 0x0b, 0xb6, 0xff, 0x81, 0x0b, 0x95, 0xff, 0x06, 0x0b, 0x75, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 
+  0xff, 0x14, 0x37, 0xfb, 0x1c, 0xd8, 0xdb, 0x25, 0x7a, 0x6b, 0xb0, 0x00, 0x00, 0x00, 0x03, 0x25, 0x3a, 0x50, 0x1c, 0xd9, 0xdf, 0x13, 0xf6, 0xff, 0x0b, 0x75, 0xff, 0x89, 0x0b, 0x95, 0xff, 0x02, 
+  0x14, 0x37, 0xff, 0x1d, 0x19, 0xb4, 0x25, 0x7a, 0x23, 0xad, 0x00, 0x00, 0x00, 0x02, 0x25, 0x5a, 0x6f, 0x14, 0x57, 0xf4, 0x0b, 0xb5, 0xff, 0x8c, 0x0b, 0x95, 0xff, 0x02, 0x0b, 0xd6, 0xff, 0x1c, 
+  0xb8, 0xe3, 0x2d, 0xbb, 0x33, 0xab, 0x00, 0x00, 0x00, 0x02, 0x25, 0x5a, 0x63, 0x14, 0x57, 0xff, 0x0b, 0x95, 0xff, 0x8e, 0x0b, 0xb5, 0xff, 0x03, 0x0b, 0x95, 0xff, 0x1c, 0xb8, 0xef, 0x25, 0x39, 
+  0xb3, 0x25, 0x39, 0xe3, 0x81, 0x25, 0x19, 0xff, 0x03, 0x25, 0x39, 0xe3, 0x25, 0x39, 0xab, 0x25, 0x5a, 0x5b, 0x25, 0xbb, 0x14, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x25, 0x5a, 0x27, 0x14, 0x57, 0xe8, 
+  0x92, 0x0b, 0xb5, 0xff, 0x00, 0x0b, 0xd6, 0xff, 0x83, 0x0b, 0xb5, 0xff, 0x04, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xe4, 0x25, 0x7a, 0x7b, 0x25, 0x9b, 0x07, 0xa0, 0x00, 0x00, 0x00, 
+  0x01, 0x1c, 0xf8, 0xb0, 0x0b, 0xd5, 0xff, 0x9a, 0x0b, 0xb5, 0xff, 0x02, 0x14, 0x37, 0xff, 0x1d, 0x19, 0xb7, 0x25, 0x7a, 0x1c, 0x9e, 0x00, 0x00, 0x00, 0x02, 0x2d, 0x7a, 0x43, 0x14, 0x16, 0xff, 
+  0x0b, 0xb5, 0xff, 0x9a, 0x0b, 0xd5, 0xff, 0x03, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xf9, 0xc7, 0x2d, 0xdb, 0x1b, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x1c, 0xb8, 0xa7, 0x0b, 0xb5, 0xff, 0x9d, 
+  0x0b, 0xd5, 0xff, 0x02, 0x0b, 0xf6, 0xff, 0x1d, 0x19, 0xab, 0x2d, 0xdb, 0x07, 0x98, 0x00, 0x00, 0x00, 0x04, 0x2d, 0xdb, 0x13, 0x2d, 0xbb, 0x63, 0x2d, 0xbb, 0xa0, 0x2d, 0x9a, 0xc7, 0x14, 0x36, 
+  0xf8, 0x9f, 0x0b, 0xd6, 0xff, 0x01, 0x14, 0x36, 0xfc, 0x25, 0x5a, 0x50, 0x96, 0x00, 0x00, 0x00, 0x05, 0x2e, 0x1c, 0x08, 0x25, 0x7a, 0x74, 0x1d, 0x19, 0xf3, 0x14, 0x97, 0xff, 0x0c, 0x16, 0xff, 
+  0x0b, 0xd5, 0xff, 0xa1, 0x0b, 0xf6, 0xff, 0x00, 0x1c, 0xb8, 0xc4, 0x95, 0x00, 0x00, 0x00, 0x02, 0x36, 0x3c, 0x08, 0x25, 0x39, 0xc3, 0x14, 0x57, 0xff, 0xa5, 0x0b, 0xf6, 0xff, 0x01, 0x14, 0x36, 
+  0xff, 0x2d, 0xbb, 0x34, 0x94, 0x00, 0x00, 0x00, 0x01, 0x25, 0x59, 0xa8, 0x14, 0x36, 0xff, 0x98, 0x0c, 0x16, 0xff, 0x00, 0x14, 0x36, 0xff, 0x82, 0x14, 0x57, 0xff, 0x01, 0x14, 0x56, 0xff, 0x14, 
+  0x36, 0xff, 0x87, 0x0c, 0x16, 0xff, 0x01, 0x0b, 0xf6, 0xff, 0x1d, 0x19, 0x78, 0x93, 0x00, 0x00, 0x00, 0x01, 0x25, 0x9a, 0x5c, 0x14, 0x57, 0xff, 0x97, 0x0c, 0x16, 0xff, 0x09, 0x1c, 0xb8, 0xff, 
+  0x1c, 0xf9, 0xff, 0x1c, 0x78, 0xff, 0x14, 0x37, 0xff, 0x14, 0x16, 0xff, 0x14, 0x17, 0xff, 0x14, 0x57, 0xff, 0x1c, 0x98, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x77, 0xff, 0x86, 0x0c, 0x16, 0xff, 0x00, 
+  0x14, 0x97, 0xab, 0x92, 0x00, 0x00, 0x00, 0x01, 0x36, 0x3c, 0x0b, 0x1c, 0xd8, 0xd7, 0x96, 0x0c, 0x16, 0xff, 0x02, 0x14, 0x57, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x37, 0xff, 0x85, 0x0b, 0x95, 0xff, 
+  0x04, 0x0b, 0x75, 0xff, 0x0b, 0xb5, 0xff, 0x1c, 0x98, 0xff, 0x1c, 0xb8, 0xff, 0x0c, 0x36, 0xff, 0x84, 0x0c, 0x16, 0xff, 0x00, 0x14, 0x56, 0xc7, 0x92, 0x00, 0x00, 0x00, 0x01, 0x25, 0x39, 0x1f, 
+  0x14, 0x56, 0xf0, 0x95, 0x0c, 0x36, 0xff, 0x02, 0x14, 0x97, 0xff, 0x14, 0x77, 0xff, 0x0b, 0xb5, 0xff, 0x89, 0x0b, 0x95, 0xff, 0x03, 0x13, 0xd6, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x56, 0xff, 0x0c, 
+  0x36, 0xff, 0x81, 0x14, 0x36, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xb4, 0x92, 0x00, 0x00, 0x00, 0x01, 0x1c, 0xb7, 0x2c, 0x14, 0x56, 0xff, 0x94, 0x0c, 0x36, 0xff, 0x02, 0x14, 0x77, 0xff, 
+  0x1c, 0x98, 0xff, 0x0b, 0x95, 0xff, 0x8c, 0x0b, 0xb5, 0xff, 0x00, 0x1c, 0xd8, 0xff, 0x83, 0x1c, 0xf9, 0xff, 0x02, 0x1c, 0xf9, 0xd8, 0x25, 0x5a, 0x54, 0x2d, 0xbb, 0x0c, 0x90, 0x00, 0x00, 0x00, 
+  0x00, 0x14, 0x56, 0x33, 0x94, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xff, 0x14, 0x97, 0xff, 0x93, 0x0b, 0xb5, 0xff, 0x03, 0x0b, 0xd6, 0xff, 0x14, 0x37, 0xfc, 0x1c, 0xf9, 0xd4, 0x25, 0xba, 0x37, 
+  0x8f, 0x00, 0x00, 0x00, 0x01, 0x14, 0x76, 0x28, 0x0c, 0x56, 0xfb, 0x93, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x97, 0xff, 0x0b, 0xf6, 0xff, 0x96, 0x0b, 0xb5, 0xff, 0x01, 0x1c, 0xb8, 0xf3, 0x25, 0x7a, 
+  0x47, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x1c, 0xd8, 0x18, 0x14, 0x76, 0xeb, 0x90, 0x14, 0x56, 0xff, 0x82, 0x0c, 0x56, 0xff, 0x00, 0x14, 0x97, 0xff, 0x98, 0x0b, 0xd5, 0xff, 0x01, 0x1c, 0x97, 0xe4, 
+  0x2d, 0x7a, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x36, 0x3b, 0x04, 0x14, 0x76, 0xb8, 0x8e, 0x14, 0x76, 0xff, 0x05, 0x14, 0x56, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xd8, 0xff, 0x1d, 0x18, 0xff, 0x25, 
+  0x39, 0xff, 0x0c, 0x16, 0xff, 0x98, 0x0b, 0xd6, 0xff, 0x01, 0x0b, 0xf6, 0xff, 0x1d, 0x19, 0xa3, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x1c, 0xf8, 0x37, 0x14, 0x76, 0xf7, 0x8c, 0x14, 0x76, 0xff, 0x00, 
+  0x0c, 0x76, 0xff, 0x81, 0x1c, 0xf8, 0xff, 0x01, 0x14, 0x57, 0xff, 0x14, 0x16, 0xff, 0x9b, 0x0b, 0xf6, 0xff, 0x01, 0x14, 0x57, 0xff, 0x2d, 0xfc, 0x24, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 
+  0x70, 0x8c, 0x14, 0x76, 0xff, 0x01, 0x1c, 0xd8, 0xff, 0x1c, 0x97, 0xff, 0x9f, 0x0b, 0xf6, 0xff, 0x00, 0x25, 0x39, 0x74, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x14, 0x76, 0x70, 0x14, 0x76, 0xf7, 0x89, 
+  0x14, 0x76, 0xff, 0x01, 0x14, 0xb7, 0xff, 0x1c, 0xb8, 0xff, 0xa0, 0x0c, 0x16, 0xff, 0x00, 0x14, 0x97, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x03, 0x14, 0xb7, 0x37, 0x14, 0x97, 0xb8, 0x14, 0x97, 0xeb, 
+  0x14, 0x97, 0xfb, 0x86, 0x14, 0x97, 0xff, 0x00, 0x1c, 0xf8, 0xff, 0xa1, 0x0c, 0x16, 0xff, 0x00, 0x14, 0x56, 0xc0, 0x91, 0x00, 0x00, 0x00, 0x03, 0x14, 0xd7, 0x04, 0x14, 0x77, 0x18, 0x14, 0x97, 
+  0x28, 0x14, 0x97, 0x33, 0x84, 0x14, 0x97, 0x34, 0x01, 0x0c, 0x97, 0x2f, 0x14, 0x97, 0xcf, 0xa1, 0x0c, 0x36, 0xff, 0x00, 0x14, 0x56, 0xa8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0xcc, 0xa1, 
+  0x0c, 0x36, 0xff, 0x00, 0x14, 0xb7, 0x74, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x56, 0xc7, 0xa1, 0x0c, 0x56, 0xff, 0x00, 0x25, 0x59, 0x24, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x9b, 0xa0, 
+  0x0c, 0x56, 0xff, 0x00, 0x14, 0x77, 0xa4, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x18, 0x38, 0x14, 0x56, 0xff, 0x9e, 0x14, 0x76, 0xff, 0x01, 0x14, 0x76, 0xec, 0x14, 0xb7, 0x20, 0x9d, 0x00, 0x00, 
+  0x00, 0x00, 0x14, 0x97, 0x93, 0x9d, 0x14, 0x76, 0xff, 0x01, 0x14, 0x76, 0xf4, 0x14, 0x97, 0x50, 0x9e, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x18, 0x08, 0x14, 0x97, 0x9f, 0x9b, 0x14, 0x76, 0xff, 0x01, 
+  0x14, 0x76, 0xd4, 0x14, 0xb7, 0x33, 0xa1, 0x00, 0x00, 0x00, 0x02, 0x14, 0x97, 0x5c, 0x0c, 0x97, 0xd3, 0x14, 0x97, 0xf4, 0x94, 0x14, 0x97, 0xff, 0x04, 0x14, 0x97, 0xfc, 0x14, 0x97, 0xf3, 0x14, 
+  0x97, 0xd3, 0x14, 0x97, 0x70, 0x2d, 0x58, 0x07, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x0b, 0x86, 0x00, 0x00, 0x00, 0x02, 0x14, 0xb7, 0x10, 0x14, 0x97, 0x23, 0x14, 0x97, 0x2c, 0x93, 0x14, 
+  0x97, 0x2f, 0x02, 0x14, 0x97, 0x2c, 0x14, 0x77, 0x20, 0x14, 0x97, 0x10, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 0x03, 0xbe, 0x00, 0x00, 0x00, 
+  0x00, 0x14, 0x97, 0x08, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x25, 0x5a, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x85, 0x00, 0x00, 0xcf, 0xa7, 0x20, 0x00, 0xcf, 0xa8, 0x21, 0x00, 0xd0, 0xa7, 0x20, 0x00, 0xd0, 0xa9, 0x20, 0x00, 0xd0, 0xa8, 0x20, 0x00, 0xd0, 0xa9, 0x20, 0x00, 0xd0, 0xa7, 0x1f, 0x00, 0xcf, 0xa8, 0x21, 0x00, 0xd1, 0xa8, 0x23, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x20, 0x00, 0xd2, 0xab, 0x20, 0x00, 0xe6, 0xc7, 0x27, 0x03, 0xd4, 0xaf, 0x23, 0x18, 0xcd, 0xa4, 0x1e, 0x5b, 0xca, 0xa1, 0x1d, 0xa4, 0xca, 0x9f, 0x1d, 0xdb, 0xc9, 0xa0, 0x1d, 0xff, 0xc9, 0x9f, 0x1d, 0xff, 0xca, 0xa0, 0x1d, 0xf7, 0xca, 0x9f, 0x1c, 0xcb, 0xca, 0xa1, 0x1e, 0x8f, 0xd1, 0xa9, 0x21, 0x38, 0xd4, 0xb1, 0x23, 0x10, 0xca, 0xa2, 0x1e, 0x00, 0xd7, 0xab, 0x20, 0x00, 0xd4, 0xaa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xa9, 0x20, 0x00, 0xd2, 0xaa, 0x20, 0x00, 0xd7, 0xb0, 0x23, 0x17, 0xcf, 0xa7, 0x1f, 0x98, 0xbf, 0x91, 0x16, 0xec, 0xb2, 0x7d, 0x0f, 0xff, 0xad, 0x76, 0x0c, 0xff, 0xaa, 0x72, 0x0a, 0xff, 0xa9, 0x6f, 0x09, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xab, 0x73, 0x0a, 0xff, 0xae, 0x78, 0x0c, 0xff, 0xb7, 0x84, 0x12, 0xfb, 0xc4, 0x98, 0x19, 0xdb, 0xd1, 0xab, 0x21, 0x6b, 0xff, 0xfd, 0x40, 0x00, 0xd2, 0xaa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xab, 0x21, 0x00, 0xa2, 0x61, 0x00, 0x00, 0xce, 0xa6, 0x1f, 0x50, 0xc5, 0x9a, 0x19, 0xdf, 0xb0, 0x7b, 0x0d, 0xff, 0xa7, 0x6e, 0x08, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa8, 0x70, 0x08, 0xff, 0xb7, 0x85, 0x11, 0xff, 0xca, 0xa1, 0x1c, 0xb4, 0xd1, 0xab, 0x21, 0x23, 0xd2, 0xad, 0x22, 0x00, 0xd0, 0xab, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xab, 0x21, 0x00, 0xd2, 0xad, 0x22, 0x00, 0xce, 0xa8, 0x20, 0x6f, 0xb8, 0x87, 0x12, 0xf4, 0xab, 0x73, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xae, 0x77, 0x0b, 0xff, 0xc1, 0x94, 0x17, 0xe3, 0xd7, 0xb6, 0x25, 0x33, 0xd0, 0xac, 0x21, 0x00, 0xd1, 0xab, 0x20, 0x00, 0xd0, 0xab, 0x20, 0x00, 0xd0, 0xab, 0x20, 0x00, 0xd1, 0xab, 0x20, 0x00, 0xd0, 0xab, 0x21, 0x00, 0xcf, 0xab, 0x21, 0x00, 0xcf, 0xac, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x20, 0x00, 0xb6, 0x79, 0x0e, 0x00, 0xcf, 0xaa, 0x20, 0x63, 0xb8, 0x88, 0x12, 0xff, 0xa9, 0x72, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xa9, 0x72, 0x08, 0xff, 0xbf, 0x93, 0x16, 0xef, 0xcb, 0xa4, 0x1e, 0xb3, 0xcb, 0xa3, 0x1d, 0xe3, 0xca, 0xa2, 0x1d, 0xff, 0xca, 0xa2, 0x1d, 0xff, 0xcb, 0xa3, 0x1d, 0xe3, 0xca, 0xa3, 0x1e, 0xab, 0xcd, 0xa8, 0x1f, 0x5b, 0xd6, 0xb3, 0x22, 0x14, 0xce, 0xa7, 0x1b, 0x00, 0xd2, 0xac, 0x1d, 0x00, 0xd2, 0xac, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xab, 0x21, 0x00, 0xcf, 0xa8, 0x1f, 0x27, 0xb8, 0x89, 0x12, 0xe8, 0xaa, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xae, 0x7a, 0x0b, 0xff, 0xac, 0x76, 0x0a, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xac, 0x76, 0x0a, 0xff, 0xae, 0x7a, 0x0c, 0xff, 0xb4, 0x83, 0x0f, 0xff, 0xc2, 0x97, 0x17, 0xe4, 0xd1, 0xae, 0x20, 0x7b, 0xd9, 0xb0, 0x1d, 0x07, 0xd2, 0xac, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xaf, 0x28, 0x00, 0xba, 0x94, 0x02, 0x00, 0xc4, 0x9b, 0x19, 0xb0, 0xac, 0x78, 0x0a, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xb6, 0x85, 0x10, 0xff, 0xc9, 0xa2, 0x1b, 0xb7, 0xd2, 0xae, 0x22, 0x1c, 0xd3, 0xb0, 0x24, 0x00, 0xd1, 0xaf, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xa7, 0x22, 0x00, 0xd2, 0xae, 0x25, 0x43, 0xb3, 0x81, 0x0f, 0xff, 0xac, 0x76, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xb0, 0x7d, 0x0d, 0xff, 0xc5, 0x9b, 0x1b, 0xc7, 0xd9, 0xba, 0x26, 0x1b, 0xd3, 0xb0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xb2, 0x24, 0x00, 0xd1, 0xb2, 0x24, 0x00, 0xd2, 0xb0, 0x24, 0x00, 0xd2, 0xb0, 0x23, 0x00, 0xc2, 0x98, 0x16, 0x00, 0xc0, 0x95, 0x17, 0xa7, 0xab, 0x76, 0x09, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xaf, 0x7c, 0x0b, 0xff, 0xc5, 0xa0, 0x1c, 0xab, 0xdc, 0xb7, 0x29, 0x07, 0xd3, 0xaf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xb0, 0x26, 0x00, 0xd2, 0xb2, 0x25, 0x00, 0xd5, 0xba, 0x27, 0x13, 0xd5, 0xb4, 0x26, 0x63, 0xd5, 0xb4, 0x25, 0xa0, 0xd4, 0xb2, 0x25, 0xc7, 0xb4, 0x85, 0x10, 0xf8, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xb3, 0x83, 0x0f, 0xfc, 0xcd, 0xa7, 0x20, 0x50, 0xd5, 0xb2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xb5, 0x28, 0x00, 0xe1, 0xc1, 0x2c, 0x08, 0xcf, 0xad, 0x23, 0x74, 0xc7, 0xa1, 0x1c, 0xf3, 0xbb, 0x8f, 0x14, 0xff, 0xb1, 0x80, 0x0c, 0xff, 0xab, 0x78, 0x08, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xc0, 0x96, 0x19, 0xc4, 0xb5, 0x86, 0x05, 0x00, 0xd8, 0xb6, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xb4, 0x26, 0x00, 0xe1, 0xc6, 0x33, 0x08, 0xca, 0xa6, 0x20, 0xc3, 0xb6, 0x89, 0x12, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xb3, 0x84, 0x0e, 0xff, 0xda, 0xb6, 0x29, 0x34, 0xd1, 0xac, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xb8, 0x28, 0x00, 0x7e, 0x00, 0x00, 0x00, 0xcb, 0xa8, 0x20, 0xa8, 0xb1, 0x83, 0x0d, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x81, 0x0c, 0xff, 0xb2, 0x85, 0x0e, 0xff, 0xb5, 0x88, 0x10, 0xff, 0xb6, 0x89, 0x11, 0xff, 0xb6, 0x89, 0x11, 0xff, 0xb4, 0x87, 0x0f, 0xff, 0xb1, 0x84, 0x0d, 0xff, 0xae, 0x80, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0xc5, 0xa1, 0x1c, 0x78, 0xc2, 0x9d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xaf, 0x24, 0x00, 0xce, 0xb1, 0x24, 0x5c, 0xb6, 0x8a, 0x10, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xbe, 0x93, 0x15, 0xff, 0xc5, 0x9b, 0x19, 0xff, 0xbd, 0x8d, 0x15, 0xff, 0xb7, 0x85, 0x12, 0xff, 0xb4, 0x81, 0x11, 0xff, 0xb5, 0x82, 0x11, 0xff, 0xb9, 0x88, 0x12, 0xff, 0xc0, 0x92, 0x16, 0xff, 0xc4, 0x9a, 0x18, 0xff, 0xb7, 0x8b, 0x11, 0xff, 0xae, 0x80, 0x0a, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xae, 0x80, 0x0a, 0xff, 0xba, 0x91, 0x14, 0xab, 0xb9, 0x90, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc3, 0x2f, 0x0b, 0xbf, 0x98, 0x16, 0xd7, 0xaf, 0x80, 0x0a, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb6, 0x8a, 0x10, 0xff, 0xc3, 0x98, 0x18, 0xff, 0xb8, 0x86, 0x12, 0xff, 0xa9, 0x70, 0x08, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa8, 0x70, 0x09, 0xff, 0xa7, 0x6e, 0x08, 0xff, 0xac, 0x76, 0x0b, 0xff, 0xbe, 0x8f, 0x16, 0xff, 0xbf, 0x95, 0x16, 0xff, 0xb2, 0x85, 0x0c, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb3, 0x87, 0x0d, 0xc7, 0xb3, 0x87, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xa6, 0x20, 0x1f, 0xb3, 0x89, 0x10, 0xf0, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xaf, 0x83, 0x0b, 0xff, 0xb9, 0x8f, 0x12, 0xff, 0xbb, 0x8c, 0x13, 0xff, 0xac, 0x75, 0x0a, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xb0, 0x7a, 0x0d, 0xff, 0xc0, 0x94, 0x16, 0xff, 0xb3, 0x88, 0x0e, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0xb1, 0x86, 0x0d, 0xff, 0xb1, 0x86, 0x0d, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0xb0, 0x83, 0x0c, 0xb4, 0xbe, 0x93, 0x16, 0x00, 0xcf, 0xa7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x95, 0x16, 0x2c, 0xb3, 0x88, 0x0e, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb8, 0x8d, 0x10, 0xff, 0xbd, 0x90, 0x15, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xc3, 0x98, 0x17, 0xff, 0xc5, 0x9c, 0x1a, 0xff, 0xc7, 0x9d, 0x1b, 0xff, 0xc7, 0x9d, 0x1b, 0xff, 0xc6, 0x9d, 0x1a, 0xff, 0xc7, 0x9e, 0x1a, 0xd8, 0xcf, 0xa7, 0x1f, 0x54, 0xd8, 0xb6, 0x26, 0x0c, 0xd0, 0xad, 0x1e, 0x00, 0xd0, 0xaf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8a, 0x0d, 0x33, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb4, 0x89, 0x0d, 0xff, 0xbb, 0x8f, 0x13, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xac, 0x76, 0x09, 0xff, 0xac, 0x76, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xac, 0x75, 0x09, 0xff, 0xae, 0x79, 0x0b, 0xff, 0xb5, 0x84, 0x10, 0xfc, 0xc7, 0x9d, 0x19, 0xd4, 0xd3, 0xb3, 0x22, 0x37, 0xd1, 0xb0, 0x23, 0x00, 0xd0, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8c, 0x0e, 0x28, 0xb2, 0x89, 0x0c, 0xfb, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xba, 0x90, 0x12, 0xff, 0xae, 0x7b, 0x0c, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xc1, 0x95, 0x19, 0xf3, 0xd0, 0xad, 0x23, 0x47, 0xc5, 0x9e, 0x19, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x9a, 0x17, 0x18, 0xb4, 0x8c, 0x0e, 0xeb, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb0, 0x87, 0x0a, 0xff, 0xbb, 0x91, 0x14, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xbb, 0x90, 0x15, 0xe4, 0xd1, 0xae, 0x25, 0x1c, 0xdd, 0xa3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xc3, 0x31, 0x04, 0xb4, 0x8d, 0x0f, 0xb8, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb6, 0x90, 0x10, 0xff, 0xbf, 0x98, 0x16, 0xff, 0xc4, 0x9f, 0x1a, 0xff, 0xc9, 0xa4, 0x1d, 0xff, 0xb1, 0x7f, 0x0c, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xc6, 0x9f, 0x1c, 0xa3, 0xcb, 0xa4, 0x22, 0x00, 0xd3, 0xba, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x9b, 0x18, 0x00, 0xbf, 0x9e, 0x18, 0x37, 0xb3, 0x8b, 0x0d, 0xf7, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb3, 0x8b, 0x0c, 0xff, 0xc1, 0x9c, 0x17, 0xff, 0xc4, 0x9c, 0x19, 0xff, 0xb6, 0x88, 0x10, 0xff, 0xb1, 0x81, 0x0d, 0xff, 0xb0, 0x7e, 0x0b, 0xff, 0xae, 0x7b, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xb7, 0x88, 0x10, 0xff, 0xdd, 0xbd, 0x26, 0x24, 0xd2, 0xaf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x9f, 0x19, 0x00, 0xbd, 0x9a, 0x15, 0x00, 0xb8, 0x93, 0x10, 0x70, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xbd, 0x98, 0x15, 0xff, 0xbc, 0x92, 0x16, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0xca, 0xa5, 0x1f, 0x74, 0xc7, 0xa0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x95, 0x11, 0x00, 0xbc, 0x9b, 0x0b, 0x00, 0xb4, 0x8e, 0x0e, 0x70, 0xb3, 0x8e, 0x0d, 0xf7, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb8, 0x93, 0x10, 0xff, 0xbe, 0x96, 0x16, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xae, 0x7f, 0x0a, 0xff, 0xbb, 0x91, 0x14, 0xa8, 0xb9, 0x90, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb6, 0x91, 0x0f, 0x00, 0xb8, 0x95, 0x10, 0x37, 0xb5, 0x8f, 0x0d, 0xb8, 0xb5, 0x8f, 0x0d, 0xeb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xc1, 0x9d, 0x17, 0xff, 0xb0, 0x82, 0x0a, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb4, 0x88, 0x0e, 0xc0, 0xb3, 0x88, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x96, 0x11, 0x00, 0xb7, 0x93, 0x0f, 0x00, 0xb8, 0x98, 0x10, 0x04, 0xb5, 0x8e, 0x0d, 0x18, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x33, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0d, 0x34, 0xb5, 0x8f, 0x0c, 0x2f, 0xb9, 0x90, 0x12, 0xcf, 0xb0, 0x83, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb3, 0x87, 0x0d, 0xa8, 0xb3, 0x87, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x87, 0x0c, 0x00, 0xb2, 0x87, 0x0d, 0xcc, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xbc, 0x94, 0x14, 0x74, 0xba, 0x92, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x88, 0x0c, 0x00, 0xb2, 0x88, 0x0c, 0xc7, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xc9, 0xaa, 0x1e, 0x24, 0xc2, 0xa0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8c, 0x0e, 0x00, 0xb3, 0x8c, 0x0e, 0x9b, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb5, 0x8d, 0x0f, 0xa4, 0xbd, 0x8f, 0x16, 0x00, 0xff, 0x85, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x9b, 0x17, 0x00, 0xbf, 0xa0, 0x19, 0x38, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xec, 0xba, 0x94, 0x13, 0x20, 0xc1, 0xa4, 0x1b, 0x00, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xb8, 0x21, 0x00, 0xab, 0x73, 0x00, 0x00, 0xb8, 0x90, 0x0e, 0x93, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xf4, 0xb8, 0x90, 0x10, 0x50, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x1c, 0x00, 0xd2, 0xb6, 0x1e, 0x00, 0xc3, 0xa0, 0x16, 0x08, 0xb5, 0x8f, 0x0d, 0x9f, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xd4, 0xb5, 0x94, 0x11, 0x33, 0x9a, 0x63, 0x00, 0x00, 0xc9, 0xbd, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xa8, 0x21, 0x00, 0x9b, 0x85, 0x00, 0x00, 0xb6, 0x8f, 0x0d, 0x5c, 0xb5, 0x90, 0x0c, 0xd3, 0xb5, 0x8f, 0x0d, 0xf4, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xfc, 0xb5, 0x8f, 0x0d, 0xf3, 0xb5, 0x8f, 0x0d, 0xd3, 0xb6, 0x90, 0x0d, 0x70, 0xc1, 0xaa, 0x25, 0x07, 0xb7, 0x9a, 0x17, 0x00, 0xb6, 0xb6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x0b, 0xd1, 0xa8, 0x1f, 0x00, 0x8d, 0x73, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x99, 0x1a, 0x00, 0xff, 0xa4, 0x26, 0x00, 0x1e, 0x78, 0x00, 0x00, 0xb9, 0x94, 0x0f, 0x10, 0xb6, 0x8f, 0x0e, 0x23, 0xb5, 0x8f, 0x0d, 0x2c, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0e, 0x2c, 0xb5, 0x8e, 0x0d, 0x20, 0xb8, 0x92, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x9a, 0x1b, 0x00, 0xb8, 0x95, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xad, 0x20, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd0, 0xaa, 0x22, 0x00, 0xd0, 0xaa, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xab, 0x24, 0x00, 0xd6, 0x9f, 0x18, 0x00, 0xc1, 0x9f, 0x20, 0x00, 0x79, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xa2, 0x1d, 0x00, 0xb8, 0x8a, 0x11, 0x00, 0xad, 0x7a, 0x0a, 0x00, 0xb3, 0x83, 0x0e, 0x00, 0x83, 0x6b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9f, 0x26, 0x00, 0xc4, 0x9b, 0x1b, 0x00, 0x1f, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x5d, 0x08, 0x00, 0xb3, 0x8c, 0x11, 0x00, 0xe9, 0xb2, 0x17, 0x00, 0xb0, 0x80, 0x0b, 0x00, 0xaf, 0x7f, 0x0a, 0x00, 0xd0, 0xab, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x48, 0x0d, 0x00, 0xc7, 0x9e, 0x1d, 0x00, 0xb5, 0x83, 0x10, 0x00, 0x55, 0x43, 0x06, 0x00, 0x0a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x8c, 0x0f, 0x00, 0xb5, 0x8c, 0x0f, 0x03, 0xb3, 0x8b, 0x0f, 0x00, 0xc7, 0x97, 0x0f, 0x00, 0xb1, 0x85, 0x0c, 0x00, 0xc0, 0x97, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x43, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x6d, 0x10, 0x00, 0xb6, 0x86, 0x12, 0x00, 0xac, 0x77, 0x0a, 0x00, 0xd5, 0xad, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x91, 0x11, 0x00, 0xb8, 0x91, 0x11, 0x08, 0xaa, 0x7e, 0x05, 0x00, 0xaf, 0x89, 0x0d, 0x00, 0xa1, 0x7e, 0x09, 0x00, 0x9b, 0x77, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xaa, 0x2b, 0x00, 0xff, 0xe0, 0xa2, 0x00, 0xd1, 0xa8, 0x1f, 0x08, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xb1, 0x24, 0x00, 0xae, 0x7d, 0x0b, 0x00, 0xad, 0x7d, 0x0b, 0x00, 0xb7, 0x89, 0x10, 0x00, 0xac, 0x93, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x92, 0x12, 0x00, 0xb6, 0x90, 0x10, 0x00, 0xb3, 0x8d, 0x0c, 0x07, 0xb5, 0x8f, 0x0f, 0x00, 0xb7, 0x8f, 0x0c, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xa9, 0x1f, 0x00, 0xce, 0xaa, 0x1f, 0x00, 0xd0, 0xa8, 0x1f, 0x00, 0xd5, 0xab, 0x20, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9c, 0x18, 0x00, 0xb0, 0x81, 0x0b, 0x00, 0xb0, 0x82, 0x0b, 0x00, 0xae, 0x7e, 0x09, 0x00, 0xb7, 0x97, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0c, 0x00, 0xb3, 0x8d, 0x0c, 0x00, 0xb5, 0x8f, 0x0f, 0x00, 0xb7, 0x8f, 0x0c, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07, 0x00, 0x00, 0x79, 0x62, 0x11, 0x00, 0xbe, 0x9f, 0x1e, 0x00, 0xd7, 0xa1, 0x18, 0x00, 0xc2, 0x9f, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x8e, 0x0e, 0x00, 0xb2, 0x87, 0x0c, 0x00, 0xb2, 0x87, 0x0c, 0x00, 0xb1, 0x86, 0x0b, 0x00, 0xa7, 0x85, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xb1, 0x1f, 0x00, 0xb0, 0x7e, 0x0c, 0x00, 0xad, 0x7a, 0x0a, 0x00, 0xc3, 0x98, 0x18, 0x00, 0x4e, 0x43, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x8a, 0x10, 0x00, 0xb5, 0x8e, 0x0d, 0x00, 0xb5, 0x8d, 0x0d, 0x00, 0xb6, 0x8d, 0x0c, 0x00, 0x9a, 0x7e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xa4, 0x1d, 0x00, 0xaf, 0x7f, 0x0a, 0x00, 0xb0, 0x80, 0x0b, 0x00, 0xae, 0x7e, 0x09, 0x00, 0xbe, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00, 0x57, 0x43, 0x03, 0x00, 0x56, 0x42, 0x03, 0x00, 0x5a, 0x45, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa0, 0x26, 0x00, 0x49, 0x39, 0x04, 0x00, 0x0a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x91, 0x11, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb0, 0x85, 0x0b, 0x00, 0xab, 0x88, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x3b, 0x0b, 0x00, 0xcb, 0xa4, 0x1c, 0x00, 0xd6, 0xac, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x98, 0x12, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb1, 0x89, 0x0c, 0x00, 0xb1, 0x90, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x9e, 0x22, 0x00, 0xae, 0x79, 0x0a, 0x00, 0xb5, 0x82, 0x0f, 0x00, 0xab, 0x8f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00, 0x3b, 0x2c, 0x01, 0x00, 0xa4, 0x81, 0x0b, 0x00, 0xa3, 0x80, 0x0b, 0x00, 0xaa, 0x85, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x56, 0x0a, 0x00, 0xc3, 0x9b, 0x18, 0x00, 0xac, 0x79, 0x09, 0x00, 0xab, 0x78, 0x08, 0x00, 0xb6, 0x92, 0x19, 0x00, 0x24, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x50, 0x0a, 0x00, 0xb8, 0x8b, 0x11, 0x00, 0xb0, 0x80, 0x0b, 0x00, 0xaf, 0x80, 0x0b, 0x00, 0xba, 0x8e, 0x13, 0x00, 0x66, 0x54, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x43, 0x04, 0x00, 0xb4, 0x89, 0x0e, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb1, 0x86, 0x0c, 0x00, 0xb6, 0x8b, 0x0f, 0x00, 0x5b, 0x47, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x46, 0x04, 0x00, 0xb7, 0x8e, 0x0e, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb8, 0x90, 0x10, 0x00, 0x5e, 0x4c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x71, 0x07, 0x00, 0xa3, 0x80, 0x0b, 0x00, 0xa3, 0x80, 0x0b, 0x00, 0x93, 0x72, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe6, 0xc7, 
+  0x27, 0x03, 0xd4, 0xaf, 0x23, 0x18, 0xcd, 0xa4, 0x1e, 0x5b, 0xca, 0xa1, 0x1d, 0xa4, 0xca, 0x9f, 0x1d, 0xdb, 0xc9, 0xa0, 0x1d, 0xff, 0xc9, 0x9f, 0x1d, 0xff, 0xca, 0xa0, 0x1d, 0xf7, 0xca, 0x9f, 
+  0x1c, 0xcb, 0xca, 0xa1, 0x1e, 0x8f, 0xd1, 0xa9, 0x21, 0x38, 0xd4, 0xb1, 0x23, 0x10, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xd7, 0xb0, 0x23, 0x17, 0xcf, 0xa7, 0x1f, 0x98, 0xbf, 0x91, 0x16, 0xec, 
+  0xb2, 0x7d, 0x0f, 0xff, 0xad, 0x76, 0x0c, 0xff, 0xaa, 0x72, 0x0a, 0xff, 0xa9, 0x6f, 0x09, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xab, 0x73, 0x0a, 0xff, 0xae, 0x78, 0x0c, 0xff, 
+  0xb7, 0x84, 0x12, 0xfb, 0xc4, 0x98, 0x19, 0xdb, 0xd1, 0xab, 0x21, 0x6b, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xce, 0xa6, 0x1f, 0x50, 0xc5, 0x9a, 0x19, 0xdf, 0xb0, 0x7b, 0x0d, 0xff, 0xa7, 0x6e, 
+  0x08, 0xff, 0x88, 0xa9, 0x71, 0x09, 0xff, 0x03, 0xa8, 0x70, 0x08, 0xff, 0xb7, 0x85, 0x11, 0xff, 0xca, 0xa1, 0x1c, 0xb4, 0xd1, 0xab, 0x21, 0x23, 0xad, 0x00, 0x00, 0x00, 0x00, 0x03, 0xce, 0xa8, 
+  0x20, 0x6f, 0xb8, 0x87, 0x12, 0xf4, 0xab, 0x73, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0x8a, 0xaa, 0x72, 0x09, 0xff, 0x03, 0xa9, 0x71, 0x09, 0xff, 0xae, 0x77, 0x0b, 0xff, 0xc1, 0x94, 0x17, 0xe3, 
+  0xd7, 0xb6, 0x25, 0x33, 0xab, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcf, 0xaa, 0x20, 0x63, 0xb8, 0x88, 0x12, 0xff, 0xa9, 0x72, 0x09, 0xff, 0x8e, 0xaa, 0x73, 0x09, 0xff, 0x03, 0xa9, 0x72, 0x08, 0xff, 
+  0xbf, 0x93, 0x16, 0xef, 0xcb, 0xa4, 0x1e, 0xb3, 0xcb, 0xa3, 0x1d, 0xe3, 0x81, 0xca, 0xa2, 0x1d, 0xff, 0x03, 0xcb, 0xa3, 0x1d, 0xe3, 0xca, 0xa3, 0x1e, 0xab, 0xcd, 0xa8, 0x1f, 0x5b, 0xd6, 0xb3, 
+  0x22, 0x14, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcf, 0xa8, 0x1f, 0x27, 0xb8, 0x89, 0x12, 0xe8, 0xaa, 0x74, 0x09, 0xff, 0x90, 0xab, 0x75, 0x09, 0xff, 0x02, 0xab, 0x76, 0x09, 0xff, 0xae, 0x7a, 
+  0x0b, 0xff, 0xac, 0x76, 0x0a, 0xff, 0x81, 0xaa, 0x74, 0x08, 0xff, 0x05, 0xac, 0x76, 0x0a, 0xff, 0xae, 0x7a, 0x0c, 0xff, 0xb4, 0x83, 0x0f, 0xff, 0xc2, 0x97, 0x17, 0xe4, 0xd1, 0xae, 0x20, 0x7b, 
+  0xd9, 0xb0, 0x1d, 0x07, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0x9b, 0x19, 0xb0, 0xac, 0x78, 0x0a, 0xff, 0x99, 0xab, 0x76, 0x09, 0xff, 0x03, 0xaa, 0x74, 0x08, 0xff, 0xb6, 0x85, 0x10, 0xff, 
+  0xc9, 0xa2, 0x1b, 0xb7, 0xd2, 0xae, 0x22, 0x1c, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0xae, 0x25, 0x43, 0xb3, 0x81, 0x0f, 0xff, 0xac, 0x76, 0x0a, 0xff, 0x9a, 0xac, 0x77, 0x0a, 0xff, 0x03, 
+  0xab, 0x76, 0x0a, 0xff, 0xb0, 0x7d, 0x0d, 0xff, 0xc5, 0x9b, 0x1b, 0xc7, 0xd9, 0xba, 0x26, 0x1b, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x95, 0x17, 0xa7, 0xab, 0x76, 0x09, 0xff, 0x9d, 0xac, 
+  0x78, 0x0a, 0xff, 0x02, 0xaf, 0x7c, 0x0b, 0xff, 0xc5, 0xa0, 0x1c, 0xab, 0xdc, 0xb7, 0x29, 0x07, 0x98, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd5, 0xba, 0x27, 0x13, 0xd5, 0xb4, 0x26, 0x63, 0xd5, 0xb4, 
+  0x25, 0xa0, 0xd4, 0xb2, 0x25, 0xc7, 0xb4, 0x85, 0x10, 0xf8, 0x9e, 0xad, 0x7a, 0x0a, 0xff, 0x02, 0xad, 0x79, 0x0a, 0xff, 0xb3, 0x83, 0x0f, 0xfc, 0xcd, 0xa7, 0x20, 0x50, 0x96, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0xe1, 0xc1, 0x2c, 0x08, 0xcf, 0xad, 0x23, 0x74, 0xc7, 0xa1, 0x1c, 0xf3, 0xbb, 0x8f, 0x14, 0xff, 0xb1, 0x80, 0x0c, 0xff, 0xab, 0x78, 0x08, 0xff, 0xa1, 0xad, 0x7b, 0x0a, 0xff, 0x00, 
+  0xc0, 0x96, 0x19, 0xc4, 0x95, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe1, 0xc6, 0x33, 0x08, 0xca, 0xa6, 0x20, 0xc3, 0xb6, 0x89, 0x12, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0x81, 0xae, 0x7c, 0x0b, 0xff, 0xa1, 
+  0xae, 0x7d, 0x0b, 0xff, 0x02, 0xae, 0x7c, 0x0b, 0xff, 0xb3, 0x84, 0x0e, 0xff, 0xda, 0xb6, 0x29, 0x34, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0xa8, 0x20, 0xa8, 0xb1, 0x83, 0x0d, 0xff, 0x97, 
+  0xae, 0x7f, 0x0b, 0xff, 0x02, 0xaf, 0x81, 0x0c, 0xff, 0xb2, 0x85, 0x0e, 0xff, 0xb5, 0x88, 0x10, 0xff, 0x81, 0xb6, 0x89, 0x11, 0xff, 0x02, 0xb4, 0x87, 0x0f, 0xff, 0xb1, 0x84, 0x0d, 0xff, 0xae, 
+  0x80, 0x0b, 0xff, 0x86, 0xae, 0x7f, 0x0b, 0xff, 0x01, 0xad, 0x7d, 0x0a, 0xff, 0xc5, 0xa1, 0x1c, 0x78, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0xce, 0xb1, 0x24, 0x5c, 0xb6, 0x8a, 0x10, 0xff, 0xaf, 
+  0x80, 0x0b, 0xff, 0x96, 0xaf, 0x81, 0x0b, 0xff, 0x0a, 0xbe, 0x93, 0x15, 0xff, 0xc5, 0x9b, 0x19, 0xff, 0xbd, 0x8d, 0x15, 0xff, 0xb7, 0x85, 0x12, 0xff, 0xb4, 0x81, 0x11, 0xff, 0xb5, 0x82, 0x11, 
+  0xff, 0xb9, 0x88, 0x12, 0xff, 0xc0, 0x92, 0x16, 0xff, 0xc4, 0x9a, 0x18, 0xff, 0xb7, 0x8b, 0x11, 0xff, 0xae, 0x80, 0x0a, 0xff, 0x84, 0xaf, 0x81, 0x0b, 0xff, 0x01, 0xae, 0x80, 0x0a, 0xff, 0xba, 
+  0x91, 0x14, 0xab, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xc3, 0x2f, 0x0b, 0xbf, 0x98, 0x16, 0xd7, 0xaf, 0x80, 0x0a, 0xff, 0x95, 0xb0, 0x82, 0x0b, 0xff, 0x05, 0xb6, 0x8a, 0x10, 0xff, 0xc3, 
+  0x98, 0x18, 0xff, 0xb8, 0x86, 0x12, 0xff, 0xa9, 0x70, 0x08, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa9, 0x70, 0x09, 0xff, 0x81, 0xa9, 0x71, 0x09, 0xff, 0x05, 0xa8, 0x70, 0x09, 0xff, 0xa7, 0x6e, 0x08, 
+  0xff, 0xac, 0x76, 0x0b, 0xff, 0xbe, 0x8f, 0x16, 0xff, 0xbf, 0x95, 0x16, 0xff, 0xb2, 0x85, 0x0c, 0xff, 0x84, 0xb0, 0x82, 0x0b, 0xff, 0x00, 0xb3, 0x87, 0x0d, 0xc7, 0x92, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0xc9, 0xa6, 0x20, 0x1f, 0xb3, 0x89, 0x10, 0xf0, 0x94, 0xb0, 0x84, 0x0c, 0xff, 0x04, 0xaf, 0x83, 0x0b, 0xff, 0xb9, 0x8f, 0x12, 0xff, 0xbb, 0x8c, 0x13, 0xff, 0xac, 0x75, 0x0a, 0xff, 0xaa, 
+  0x71, 0x09, 0xff, 0x86, 0xaa, 0x72, 0x09, 0xff, 0x81, 0xaa, 0x71, 0x09, 0xff, 0x03, 0xb0, 0x7a, 0x0d, 0xff, 0xc0, 0x94, 0x16, 0xff, 0xb3, 0x88, 0x0e, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0x81, 0xb1, 
+  0x86, 0x0d, 0xff, 0x01, 0xb0, 0x84, 0x0b, 0xff, 0xb0, 0x83, 0x0c, 0xb4, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbc, 0x95, 0x16, 0x2c, 0xb3, 0x88, 0x0e, 0xff, 0x94, 0xb1, 0x85, 0x0c, 0xff, 0x02, 
+  0xb8, 0x8d, 0x10, 0xff, 0xbd, 0x90, 0x15, 0xff, 0xaa, 0x72, 0x09, 0xff, 0x8b, 0xaa, 0x73, 0x09, 0xff, 0x02, 0xab, 0x76, 0x0a, 0xff, 0xc3, 0x98, 0x17, 0xff, 0xc5, 0x9c, 0x1a, 0xff, 0x81, 0xc7, 
+  0x9d, 0x1b, 0xff, 0x03, 0xc6, 0x9d, 0x1a, 0xff, 0xc7, 0x9e, 0x1a, 0xd8, 0xcf, 0xa7, 0x1f, 0x54, 0xd8, 0xb6, 0x26, 0x0c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8a, 0x0d, 0x33, 0x94, 0xb2, 
+  0x87, 0x0c, 0xff, 0x02, 0xb4, 0x89, 0x0d, 0xff, 0xbb, 0x8f, 0x13, 0xff, 0xab, 0x74, 0x09, 0xff, 0x8d, 0xab, 0x75, 0x09, 0xff, 0x81, 0xac, 0x76, 0x09, 0xff, 0x81, 0xaa, 0x73, 0x08, 0xff, 0x04, 
+  0xac, 0x75, 0x09, 0xff, 0xae, 0x79, 0x0b, 0xff, 0xb5, 0x84, 0x10, 0xfc, 0xc7, 0x9d, 0x19, 0xd4, 0xd3, 0xb3, 0x22, 0x37, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x8c, 0x0e, 0x28, 0xb2, 0x89, 
+  0x0c, 0xfb, 0x93, 0xb2, 0x88, 0x0c, 0xff, 0x01, 0xba, 0x90, 0x12, 0xff, 0xae, 0x7b, 0x0c, 0xff, 0x96, 0xab, 0x76, 0x0a, 0xff, 0x01, 0xc1, 0x95, 0x19, 0xf3, 0xd0, 0xad, 0x23, 0x47, 0x8e, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xbd, 0x9a, 0x17, 0x18, 0xb4, 0x8c, 0x0e, 0xeb, 0x90, 0xb3, 0x8a, 0x0d, 0xff, 0x04, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb0, 0x87, 0x0a, 0xff, 0xbb, 0x91, 
+  0x14, 0xff, 0xac, 0x78, 0x0a, 0xff, 0x95, 0xac, 0x79, 0x0a, 0xff, 0x03, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xbb, 0x90, 0x15, 0xe4, 0xd1, 0xae, 0x25, 0x1c, 0x8d, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xdb, 0xc3, 0x31, 0x04, 0xb4, 0x8d, 0x0f, 0xb8, 0x8e, 0xb3, 0x8b, 0x0d, 0xff, 0x05, 0xb3, 0x8a, 0x0d, 0xff, 0xb6, 0x90, 0x10, 0xff, 0xbf, 0x98, 0x16, 0xff, 0xc4, 0x9f, 0x1a, 0xff, 
+  0xc9, 0xa4, 0x1d, 0xff, 0xb1, 0x7f, 0x0c, 0xff, 0x98, 0xad, 0x7a, 0x0a, 0xff, 0x01, 0xae, 0x7c, 0x0b, 0xff, 0xc6, 0x9f, 0x1c, 0xa3, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0x9e, 0x18, 0x37, 
+  0xb3, 0x8b, 0x0d, 0xf7, 0x8c, 0xb4, 0x8c, 0x0d, 0xff, 0x06, 0xb3, 0x8b, 0x0c, 0xff, 0xc1, 0x9c, 0x17, 0xff, 0xc4, 0x9c, 0x19, 0xff, 0xb6, 0x88, 0x10, 0xff, 0xb1, 0x81, 0x0d, 0xff, 0xb0, 0x7e, 
+  0x0b, 0xff, 0xae, 0x7b, 0x0a, 0xff, 0x98, 0xae, 0x7c, 0x0a, 0xff, 0x02, 0xad, 0x7b, 0x0a, 0xff, 0xb7, 0x88, 0x10, 0xff, 0xdd, 0xbd, 0x26, 0x24, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x93, 
+  0x10, 0x70, 0x8c, 0xb4, 0x8d, 0x0d, 0xff, 0x02, 0xbd, 0x98, 0x15, 0xff, 0xbc, 0x92, 0x16, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0x9d, 0xae, 0x7e, 0x0b, 0xff, 0x01, 0xad, 0x7d, 0x0a, 0xff, 0xca, 0xa5, 
+  0x1f, 0x74, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x8e, 0x0e, 0x70, 0xb3, 0x8e, 0x0d, 0xf7, 0x89, 0xb4, 0x8e, 0x0d, 0xff, 0x02, 0xb8, 0x93, 0x10, 0xff, 0xbe, 0x96, 0x16, 0xff, 0xaf, 0x7f, 
+  0x0b, 0xff, 0x9e, 0xaf, 0x80, 0x0b, 0xff, 0x01, 0xae, 0x7f, 0x0a, 0xff, 0xbb, 0x91, 0x14, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb8, 0x95, 0x10, 0x37, 0xb5, 0x8f, 0x0d, 0xb8, 0xb5, 0x8f, 
+  0x0d, 0xeb, 0xb5, 0x8f, 0x0d, 0xfb, 0x86, 0xb5, 0x8f, 0x0d, 0xff, 0x01, 0xc1, 0x9d, 0x17, 0xff, 0xb0, 0x82, 0x0a, 0xff, 0xa0, 0xb0, 0x82, 0x0b, 0xff, 0x00, 0xb4, 0x88, 0x0e, 0xc0, 0x91, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0xb8, 0x98, 0x10, 0x04, 0xb5, 0x8e, 0x0d, 0x18, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x33, 0x84, 0xb5, 0x8f, 0x0d, 0x34, 0x02, 0xb5, 0x8f, 0x0c, 0x2f, 0xb9, 0x90, 
+  0x12, 0xcf, 0xb0, 0x83, 0x0b, 0xff, 0xa0, 0xb1, 0x84, 0x0c, 0xff, 0x00, 0xb3, 0x87, 0x0d, 0xa8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x87, 0x0d, 0xcc, 0xa1, 0xb1, 0x85, 0x0c, 0xff, 0x00, 
+  0xbc, 0x94, 0x14, 0x74, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x88, 0x0c, 0xc7, 0xa0, 0xb2, 0x88, 0x0c, 0xff, 0x01, 0xb2, 0x87, 0x0c, 0xff, 0xc9, 0xaa, 0x1e, 0x24, 0x9b, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xb3, 0x8c, 0x0e, 0x9b, 0xa0, 0xb2, 0x89, 0x0c, 0xff, 0x00, 0xb5, 0x8d, 0x0f, 0xa4, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xa0, 0x19, 0x38, 0xb3, 0x8a, 0x0d, 0xff, 0x9e, 0xb3, 
+  0x8b, 0x0d, 0xff, 0x01, 0xb3, 0x8b, 0x0d, 0xec, 0xba, 0x94, 0x13, 0x20, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x90, 0x0e, 0x93, 0x9d, 0xb4, 0x8c, 0x0d, 0xff, 0x01, 0xb4, 0x8c, 0x0d, 0xf4, 
+  0xb8, 0x90, 0x10, 0x50, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc3, 0xa0, 0x16, 0x08, 0xb5, 0x8f, 0x0d, 0x9f, 0x9b, 0xb4, 0x8e, 0x0d, 0xff, 0x01, 0xb4, 0x8d, 0x0d, 0xd4, 0xb5, 0x94, 0x11, 0x33, 
+  0xa1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb6, 0x8f, 0x0d, 0x5c, 0xb5, 0x90, 0x0c, 0xd3, 0xb5, 0x8f, 0x0d, 0xf4, 0x94, 0xb5, 0x8f, 0x0d, 0xff, 0x04, 0xb5, 0x8f, 0x0d, 0xfc, 0xb5, 0x8f, 0x0d, 0xf3, 
+  0xb5, 0x8f, 0x0d, 0xd3, 0xb6, 0x90, 0x0d, 0x70, 0xc1, 0xaa, 0x25, 0x07, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa8, 0x1f, 0x0b, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb9, 0x94, 0x0f, 0x10, 
+  0xb6, 0x8f, 0x0e, 0x23, 0xb5, 0x8f, 0x0d, 0x2c, 0x93, 0xb5, 0x8f, 0x0d, 0x2f, 0x02, 0xb5, 0x8f, 0x0e, 0x2c, 0xb5, 0x8e, 0x0d, 0x20, 0xb8, 0x92, 0x0f, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x8c, 0x0f, 0x03, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x91, 0x11, 0x08, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xa8, 
+  0x1f, 0x08, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0c, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +186,7 @@ const lv_img_dsc_t owm_04n_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_04n_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_04n_64px_map,
 };
-
@@ -10,271 +10,423 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_10D_64PX uint8_t owm_10d_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x0b, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x94, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x43, 0xfc, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x08, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x54, 0xfc, 0xd7, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x63, 0xfc, 0xff, 0xfc, 0x40, 0xfc, 0x00, 0xfc, 0x24, 0xfc, 0xff, 0xfc, 0x34, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0b, 0xfc, 0x08, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x5b, 0xfc, 0xb0, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc4, 0xfc, 0xff, 0xfc, 0xc3, 0xfc, 0x17, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd7, 0xfc, 0x17, 0xfc, 0xeb, 0xfc, 0xff, 0xfc, 0xac, 0xfc, 0x00, 0xfc, 0x0c, 0xfc, 0xd4, 0xfc, 0x40, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04, 0xfc, 0x04, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x87, 0xfc, 0xff, 0xfc, 0xdb, 0xfc, 0x2c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe0, 0xfc, 0x40, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0x6c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x2b, 0xfc, 0xd4, 0xfc, 0x47, 0xfc, 0x00, 0xfc, 0xb3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x97, 0xfc, 0x00, 0xfc, 0x67, 0xfc, 0xeb, 0xfc, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x28, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xbc, 0xfc, 0xe3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xdc, 0xfc, 0xe7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xfc, 0x30, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x20, 0xfc, 0xf4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xaf, 0xfc, 0xff, 0xfc, 0xb3, 0xfc, 0x74, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0x5c, 0xfc, 0xc3, 0xfc, 0xff, 0xfc, 0x40, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x4b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x04, 0xfc, 0x07, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd4, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x07, 0xfc, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x3c, 0xfc, 0xdb, 0xfc, 0xcf, 0xfc, 0xc8, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xcb, 0xfc, 0xcf, 0xfc, 0xe7, 0xfc, 0x23, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0xe3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xbf, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x83, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfb, 0xfc, 0x33, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0x1c, 0xfc, 0x2b, 0xfc, 0x2f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xba, 0xff, 0x7a, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x7a, 0xff, 0xba, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe0, 0xfc, 0x38, 0xfc, 0x27, 0xfc, 0x1b, 0xfc, 0x0b, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xfc, 0x00, 0xfc, 0x40, 0xfc, 0xef, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xdd, 0xff, 0x7b, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x7b, 0xff, 0xdd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xfb, 0xfc, 0x1c, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xfc, 0x00, 0xbc, 0x00, 0xfc, 0xb0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xba, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0xba, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x67, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xcb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x7a, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x7a, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xac, 0x3b, 0x00, 0x17, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x08, 0xfc, 0x20, 0xfc, 0x63, 0xfc, 0xd0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9a, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x56, 0xff, 0x7a, 0xff, 0x17, 0xff, 0x17, 0xff, 0x17, 0xff, 0x37, 0xf0, 0x57, 0xa0, 0x57, 0x44, 0x5b, 0x10, 0x3b, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x03, 0xfc, 0xaf, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xba, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xdc, 0x3b, 0x4b, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xbc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0x7c, 0x5b, 0x04, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0x8c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9a, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x90, 0x3b, 0x04, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x03, 0xfc, 0x3b, 0xfc, 0xdb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x37, 0x57, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x1f, 0xfc, 0xcc, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xba, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xe8, 0x3b, 0x18, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x03, 0xfc, 0x74, 0xfc, 0xe8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x9a, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x80, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x88, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xdd, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xdb, 0x3b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1c, 0xfc, 0xdb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x34, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x9a, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x04, 0xfc, 0x8f, 0xfc, 0xdb, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x07, 0xfc, 0x20, 0xfc, 0x98, 0xfc, 0xff, 0xfc, 0xff, 0xba, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x28, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x1f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x96, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xa3, 0x37, 0x37, 0x3b, 0x04, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xfc, 0x00, 0xfc, 0x0c, 0xfc, 0xd8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x96, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xf7, 0x37, 0xa7, 0x3b, 0x10, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xfc, 0x00, 0xfc, 0x5f, 0xfc, 0xd8, 0xfc, 0xdf, 0xfc, 0xe8, 0xfc, 0xff, 0x96, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc7, 0x37, 0x17, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf8, 0x03, 0xfc, 0x0c, 0xfc, 0x37, 0xfc, 0xff, 0xb9, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xac, 0x37, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xb0, 0xfc, 0xff, 0xfc, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x5c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x1f, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xb9, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xcc, 0x3b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x40, 0xfc, 0x8f, 0xfc, 0x73, 0xfc, 0x57, 0xfc, 0xe4, 0x76, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x0c, 0xfc, 0xff, 0xfc, 0xff, 0x76, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x67, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xb9, 0xff, 0x76, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0xb8, 0xfc, 0xa4, 0xfc, 0x4c, 0xfc, 0x3f, 0xfc, 0xf3, 0xfc, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x24, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x2b, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x54, 0xfc, 0xd4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x37, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x27, 0xfc, 0x87, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xa4, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x16, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x7b, 0xfc, 0xff, 0xfc, 0x83, 0x9b, 0x43, 0x76, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xb3, 0xba, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xaf, 0x0a, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x47, 0xfc, 0x53, 0xf8, 0x00, 0x37, 0xcf, 0x13, 0xff, 0xf9, 0xff, 0xfc, 0x8b, 0xf8, 0x00, 0xfc, 0xe4, 0x56, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x37, 0x18, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x37, 0x2b, 0x13, 0xfc, 0x13, 0xff, 0x77, 0xef, 0x17, 0x00, 0xfc, 0x00, 0xfc, 0x3f, 0xf8, 0xff, 0x13, 0xcf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x9c, 0x37, 0x13, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xa4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x3b, 0x37, 0x37, 0x00, 0xfc, 0x07, 0xfc, 0x48, 0x03, 0x04, 0x13, 0x90, 0x13, 0xe4, 0x13, 0xf8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0xec, 0x13, 0xbc, 0x13, 0x47, 0x13, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x98, 0x37, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x13, 0x00, 0x37, 0x03, 0x17, 0x18, 0x13, 0x28, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2c, 0x13, 0x2c, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x2f, 0x13, 0x28, 0x13, 0x1c, 0x37, 0x0b, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xdc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x70, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x3b, 0x37, 0x2f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x23, 0x13, 0xd3, 0x13, 0xff, 0x13, 0x87, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x37, 0x00, 0x37, 0x57, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x17, 0x00, 0x37, 0xec, 0x37, 0xcf, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x64, 0x33, 0xf0, 0x3b, 0x0c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x73, 0x13, 0xff, 0x13, 0xff, 0x3b, 0x4c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x0f, 0x33, 0xe0, 0x13, 0xff, 0x37, 0x63, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x0c, 0x33, 0xdc, 0x13, 0xff, 0x13, 0xff, 0x37, 0xcf, 0x5f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x58, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x37, 0x48, 0x13, 0xff, 0x13, 0xff, 0x37, 0xf3, 0x0f, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x2b, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf3, 0x37, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x37, 0x18, 0x33, 0xfc, 0x37, 0x3f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xcc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x3b, 0x60, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x30, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf7, 0x37, 0x27, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x84, 0x13, 0xff, 0x33, 0xd3, 0x3b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xa0, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x08, 0x13, 0xbc, 0x13, 0xff, 0x13, 0xfc, 0x13, 0xaf, 0x3b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x5f, 0x07, 0x33, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x34, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x9c, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x33, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x08, 0x13, 0x2c, 0x13, 0x2b, 0x13, 0x04, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x87, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xa7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x04, 0x13, 0x8b, 0x13, 0xc3, 0x13, 0x3c, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x33, 0xc4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xe7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x33, 0x53, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x7b, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x00, 0x13, 0x53, 0x13, 0xc7, 0x13, 0x7b, 0x13, 0x03, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xb9, 0x00, 0x00, 0x01, 0xfc, 0x10, 0xfc, 0x0b, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x10, 0xfc, 0x94, 0x82, 0x00, 0x00, 0x00, 0xfc, 0x43, 
+  0xb1, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x82, 0x00, 0x00, 0x0a, 0xfc, 0x54, 0xfc, 0xd7, 0xfc, 0x04, 0x00, 0x00, 0xfc, 0x63, 0xfc, 0xff, 0xfc, 0x40, 0x00, 0x00, 0xfc, 0x24, 0xfc, 0xff, 0xfc, 0x34, 
+  0x81, 0x00, 0x00, 0x01, 0xfc, 0x0b, 0xfc, 0x08, 0xac, 0x00, 0x00, 0x01, 0xfc, 0x5b, 0xfc, 0xb0, 0x81, 0x00, 0x00, 0x03, 0xfc, 0xc4, 0xfc, 0xff, 0xfc, 0xc3, 0xfc, 0x17, 0x81, 0xfc, 0xff, 0x08, 
+  0xfc, 0xd7, 0xfc, 0x17, 0xfc, 0xeb, 0xfc, 0xff, 0xfc, 0xac, 0x00, 0x00, 0xfc, 0x0c, 0xfc, 0xd4, 0xfc, 0x40, 0xa8, 0x00, 0x00, 0x81, 0xfc, 0x04, 0x81, 0x00, 0x00, 0x03, 0xfc, 0x87, 0xfc, 0xff, 
+  0xfc, 0xdb, 0xfc, 0x2c, 0x82, 0xfc, 0xff, 0x00, 0xfc, 0xf4, 0x82, 0xfc, 0xff, 0x00, 0xfc, 0xfb, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0xe0, 0xfc, 0x40, 0xfc, 0xf7, 0xfc, 0xff, 0xfc, 0x6c, 0x81, 0x00, 
+  0x00, 0x01, 0xfc, 0x0f, 0xfc, 0x03, 0xa4, 0x00, 0x00, 0x04, 0xfc, 0x2b, 0xfc, 0xd4, 0xfc, 0x47, 0x00, 0x00, 0xfc, 0xb3, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0xf8, 0x89, 0xfc, 0xff, 0x00, 0xfc, 0xfc, 
+  0x82, 0xfc, 0xff, 0x04, 0xfc, 0x97, 0x00, 0x00, 0xfc, 0x67, 0xfc, 0xeb, 0xfc, 0x03, 0xa4, 0x00, 0x00, 0x04, 0xfc, 0x28, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xbc, 0xfc, 0xe3, 0x90, 0xfc, 0xff, 0x01, 
+  0xfc, 0xdc, 0xfc, 0xe7, 0x81, 0xfc, 0xff, 0xa2, 0x00, 0x00, 0x00, 0xfc, 0x30, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x20, 0xfc, 0xf4, 0x96, 0xfc, 0xff, 0x00, 0xfc, 0xf8, 0x82, 0x00, 0x00, 0x00, 0xfc, 
+  0x1c, 0x9e, 0x00, 0x00, 0x04, 0xfc, 0xaf, 0xfc, 0xff, 0xfc, 0xb3, 0xfc, 0x74, 0xfc, 0xf0, 0x96, 0xfc, 0xff, 0x04, 0xfc, 0xe8, 0xfc, 0x5c, 0xfc, 0xc3, 0xfc, 0xff, 0xfc, 0x40, 0x9e, 0x00, 0x00, 
+  0x00, 0xfc, 0x4b, 0x9d, 0xfc, 0xff, 0x01, 0xfc, 0xef, 0xfc, 0x1c, 0x9b, 0x00, 0x00, 0x01, 0xfc, 0x04, 0xfc, 0x07, 0x81, 0x00, 0x00, 0x9d, 0xfc, 0xff, 0x00, 0xfc, 0xd4, 0x81, 0x00, 0x00, 0x01, 
+  0xfc, 0x07, 0xfc, 0x04, 0x98, 0x00, 0x00, 0x04, 0xfc, 0x3c, 0xfc, 0xdb, 0xfc, 0xcf, 0xfc, 0xc8, 0xfc, 0xfb, 0x9c, 0xfc, 0xff, 0x04, 0xfc, 0xf3, 0xfc, 0xcb, 0xfc, 0xcf, 0xfc, 0xe7, 0xfc, 0x23, 
+  0x98, 0x00, 0x00, 0x01, 0xfc, 0x10, 0xfc, 0xe3, 0xa2, 0xfc, 0xff, 0x00, 0xfc, 0xbf, 0x9a, 0x00, 0x00, 0x00, 0xfc, 0x83, 0xa1, 0xfc, 0xff, 0x01, 0xfc, 0xfb, 0xfc, 0x33, 0x97, 0x00, 0x00, 0x03, 
+  0xfc, 0x0f, 0xfc, 0x1c, 0xfc, 0x2b, 0xfc, 0x2f, 0x90, 0xfc, 0xff, 0x02, 0xfd, 0xff, 0xba, 0xff, 0x7a, 0xff, 0x83, 0x17, 0xff, 0x02, 0x7a, 0xff, 0xba, 0xff, 0xfd, 0xff, 0x86, 0xfc, 0xff, 0x04, 
+  0xfc, 0xe0, 0xfc, 0x38, 0xfc, 0x27, 0xfc, 0x1b, 0xfc, 0x0b, 0x94, 0x00, 0x00, 0x02, 0xfc, 0x40, 0xfc, 0xef, 0xfc, 0xfb, 0x8f, 0xfc, 0xff, 0x02, 0xdd, 0xff, 0x7b, 0xff, 0x33, 0xff, 0x81, 0x13, 
+  0xff, 0x83, 0x0f, 0xff, 0x81, 0x13, 0xff, 0x02, 0x33, 0xff, 0x7b, 0xff, 0xdd, 0xff, 0x86, 0xfc, 0xff, 0x02, 0xfc, 0xf7, 0xfc, 0xfb, 0xfc, 0x1c, 0x95, 0x00, 0x00, 0x00, 0xfc, 0xb0, 0x8f, 0xfc, 
+  0xff, 0x00, 0xba, 0xff, 0x81, 0x13, 0xff, 0x00, 0x0f, 0xff, 0x87, 0x13, 0xff, 0x00, 0x0f, 0xff, 0x81, 0x13, 0xff, 0x00, 0xba, 0xff, 0x86, 0xfc, 0xff, 0x00, 0xfc, 0x67, 0x97, 0x00, 0x00, 0x00, 
+  0xfc, 0xcb, 0x8d, 0xfc, 0xff, 0x00, 0x7a, 0xff, 0x8f, 0x13, 0xff, 0x00, 0x7a, 0xff, 0x84, 0xfc, 0xff, 0x00, 0xfc, 0xac, 0x95, 0x00, 0x00, 0x03, 0xfc, 0x08, 0xfc, 0x20, 0xfc, 0x63, 0xfc, 0xd0, 
+  0x8c, 0xfc, 0xff, 0x00, 0x9a, 0xff, 0x91, 0x13, 0xff, 0x01, 0x56, 0xff, 0x7a, 0xff, 0x82, 0x17, 0xff, 0x03, 0x37, 0xf0, 0x57, 0xa0, 0x57, 0x44, 0x5b, 0x10, 0x91, 0x00, 0x00, 0x02, 0xfc, 0x03, 
+  0xfc, 0xaf, 0xfc, 0xf7, 0x8d, 0xfc, 0xff, 0x00, 0xba, 0xff, 0x99, 0x13, 0xff, 0x02, 0x33, 0xff, 0x37, 0xdc, 0x3b, 0x4b, 0x92, 0x00, 0x00, 0x00, 0xfc, 0xbc, 0x8c, 0xfc, 0xff, 0x01, 0xfd, 0xff, 
+  0x33, 0xff, 0x9b, 0x13, 0xff, 0x02, 0x33, 0xff, 0x37, 0x7c, 0x5b, 0x04, 0x91, 0x00, 0x00, 0x00, 0xfc, 0x8c, 0x8b, 0xfc, 0xff, 0x00, 0x9a, 0xff, 0x9e, 0x13, 0xff, 0x01, 0x37, 0x90, 0x3b, 0x04, 
+  0x8e, 0x00, 0x00, 0x02, 0xfc, 0x03, 0xfc, 0x3b, 0xfc, 0xdb, 0x8b, 0xfc, 0xff, 0x00, 0x17, 0xff, 0x9e, 0x13, 0xff, 0x01, 0x13, 0xfb, 0x37, 0x57, 0x8d, 0x00, 0x00, 0x02, 0xfc, 0x1f, 0xfc, 0xcc, 
+  0xfc, 0xfc, 0x89, 0xfc, 0xff, 0x02, 0xba, 0xff, 0x9b, 0xff, 0x7b, 0xff, 0xa0, 0x13, 0xff, 0x01, 0x37, 0xe8, 0x3b, 0x18, 0x8c, 0x00, 0x00, 0x02, 0xfc, 0x03, 0xfc, 0x74, 0xfc, 0xe8, 0x86, 0xfc, 
+  0xff, 0x02, 0xfd, 0xff, 0x9a, 0xff, 0x17, 0xff, 0xa4, 0x13, 0xff, 0x00, 0x37, 0x80, 0x8e, 0x00, 0x00, 0x01, 0xfc, 0x10, 0xfc, 0x88, 0x84, 0xfc, 0xff, 0x01, 0xdd, 0xff, 0x57, 0xff, 0xa6, 0x13, 
+  0xff, 0x01, 0x33, 0xdb, 0x3b, 0x0c, 0x8d, 0x00, 0x00, 0x01, 0xfc, 0x1c, 0xfc, 0xdb, 0x83, 0xfc, 0xff, 0x01, 0xfd, 0xff, 0x57, 0xff, 0x9a, 0x13, 0xff, 0x81, 0x33, 0xff, 0x8a, 0x13, 0xff, 0x01, 
+  0x13, 0xef, 0x37, 0x1f, 0x8c, 0x00, 0x00, 0x01, 0xfc, 0x34, 0xfc, 0xf0, 0x84, 0xfc, 0xff, 0x00, 0x9a, 0xff, 0x98, 0x13, 0xff, 0x81, 0x37, 0xff, 0x84, 0x33, 0xff, 0x81, 0x37, 0xff, 0x86, 0x13, 
+  0xff, 0x01, 0x13, 0xfc, 0x37, 0x2b, 0x8b, 0x00, 0x00, 0x03, 0xfc, 0x04, 0xfc, 0x8f, 0xfc, 0xdb, 0xfc, 0xf7, 0x83, 0xfc, 0xff, 0x97, 0x13, 0xff, 0x02, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x81, 
+  0x0f, 0xff, 0x81, 0x13, 0xff, 0x82, 0x0f, 0xff, 0x02, 0x13, 0xff, 0x37, 0xff, 0x33, 0xff, 0x85, 0x13, 0xff, 0x00, 0x13, 0x33, 0x8d, 0x00, 0x00, 0x02, 0xfc, 0x07, 0xfc, 0x20, 0xfc, 0x98, 0x81, 
+  0xfc, 0xff, 0x00, 0xba, 0xff, 0x96, 0x13, 0xff, 0x00, 0x37, 0xff, 0x8b, 0x13, 0xff, 0x01, 0x33, 0xff, 0x37, 0xff, 0x84, 0x13, 0xff, 0x00, 0x13, 0x28, 0x8e, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0x82, 
+  0xfc, 0xff, 0x00, 0x96, 0xff, 0x95, 0x13, 0xff, 0x00, 0x37, 0xff, 0x8e, 0x13, 0xff, 0x84, 0x37, 0xff, 0x02, 0x37, 0xa3, 0x37, 0x37, 0x3b, 0x04, 0x8b, 0x00, 0x00, 0x01, 0xfc, 0x0c, 0xfc, 0xd8, 
+  0x82, 0xfc, 0xff, 0x00, 0x96, 0xff, 0x94, 0x13, 0xff, 0x00, 0x37, 0xff, 0x95, 0x13, 0xff, 0x02, 0x33, 0xf7, 0x37, 0xa7, 0x3b, 0x10, 0x8a, 0x00, 0x00, 0x05, 0xfc, 0x5f, 0xfc, 0xd8, 0xfc, 0xdf, 
+  0xfc, 0xe8, 0xfc, 0xff, 0x96, 0xff, 0x94, 0x13, 0xff, 0x00, 0x33, 0xff, 0x97, 0x13, 0xff, 0x01, 0x37, 0xc7, 0x37, 0x17, 0x8a, 0x00, 0x00, 0x04, 0xf8, 0x03, 0xfc, 0x0c, 0xfc, 0x37, 0xfc, 0xff, 
+  0xb9, 0xff, 0xae, 0x13, 0xff, 0x00, 0x37, 0xac, 0x8c, 0x00, 0x00, 0x00, 0xfc, 0xb0, 0x81, 0xfc, 0xff, 0x90, 0x13, 0xff, 0x83, 0x37, 0xff, 0x9a, 0x13, 0xff, 0x00, 0x37, 0x5c, 0x8a, 0x00, 0x00, 
+  0x01, 0xfc, 0x1f, 0xfc, 0xf7, 0x81, 0xfc, 0xff, 0x00, 0xb9, 0xff, 0x8e, 0x13, 0xff, 0x81, 0x37, 0xff, 0x9d, 0x13, 0xff, 0x01, 0x33, 0xcc, 0x3b, 0x08, 0x89, 0x00, 0x00, 0x05, 0xfc, 0x40, 0xfc, 
+  0x8f, 0xfc, 0x73, 0xfc, 0x57, 0xfc, 0xe4, 0x76, 0xff, 0x8c, 0x13, 0xff, 0x00, 0x37, 0xff, 0x9f, 0x13, 0xff, 0x01, 0x13, 0xef, 0x37, 0x1c, 0x8c, 0x00, 0x00, 0x00, 0xfc, 0x0c, 0x81, 0xfc, 0xff, 
+  0x00, 0x76, 0xff, 0x8a, 0x13, 0xff, 0x00, 0x37, 0xff, 0xa0, 0x13, 0xff, 0x01, 0x13, 0xfc, 0x37, 0x2b, 0x8c, 0x00, 0x00, 0x00, 0xfc, 0x67, 0x81, 0xfc, 0xff, 0x03, 0xfc, 0xf7, 0xb9, 0xff, 0x76, 
+  0xff, 0x37, 0xff, 0x87, 0x13, 0xff, 0x00, 0x37, 0xff, 0xa1, 0x13, 0xff, 0x00, 0x13, 0x30, 0x8c, 0x00, 0x00, 0x06, 0xfc, 0xb8, 0xfc, 0xa4, 0xfc, 0x4c, 0xfc, 0x3f, 0xfc, 0xf3, 0xfc, 0xff, 0xfd, 
+  0xff, 0x86, 0xf9, 0xff, 0x00, 0xfd, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xfc, 0x13, 0x2b, 0x8f, 0x00, 0x00, 0x01, 0xfc, 0x24, 0xfc, 0xf7, 0x89, 0xfc, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xef, 
+  0x37, 0x1c, 0x8f, 0x00, 0x00, 0x04, 0xfc, 0x2b, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x54, 0xfc, 0xd4, 0x86, 0xfc, 0xff, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xcf, 0x37, 0x08, 0x8f, 0x00, 0x00, 0x01, 0xfc, 
+  0x27, 0xfc, 0x87, 0x81, 0x00, 0x00, 0x00, 0xfc, 0xa4, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xe0, 0xfd, 0xff, 0x82, 0xfc, 0xff, 0x00, 0x16, 0xff, 0xa0, 0x13, 0xff, 0x00, 0x33, 0x5f, 0x94, 0x00, 0x00, 
+  0x08, 0xfc, 0x7b, 0xfc, 0xff, 0xfc, 0x83, 0x9b, 0x43, 0x76, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xb3, 0xba, 0xff, 0x9f, 0x13, 0xff, 0x00, 0x13, 0xaf, 0x95, 0x00, 0x00, 0x09, 0xfc, 0x47, 0xfc, 
+  0x53, 0x00, 0x00, 0x37, 0xcf, 0x13, 0xff, 0xf9, 0xff, 0xfc, 0x8b, 0x00, 0x00, 0xfc, 0xe4, 0x56, 0xff, 0x9d, 0x13, 0xff, 0x01, 0x13, 0xcf, 0x37, 0x18, 0x97, 0x00, 0x00, 0x03, 0x37, 0x2b, 0x13, 
+  0xfc, 0x13, 0xff, 0x77, 0xef, 0x81, 0x00, 0x00, 0x02, 0xfc, 0x3f, 0xf8, 0xff, 0x13, 0xcf, 0x9b, 0x13, 0xff, 0x01, 0x13, 0x9c, 0x37, 0x13, 0x98, 0x00, 0x00, 0x00, 0x37, 0xa4, 0x82, 0x13, 0xff, 
+  0x07, 0x3b, 0x37, 0x00, 0x00, 0xfc, 0x07, 0xfc, 0x48, 0x03, 0x04, 0x13, 0x90, 0x13, 0xe4, 0x13, 0xf8, 0x94, 0x13, 0xff, 0x03, 0x13, 0xfb, 0x13, 0xec, 0x13, 0xbc, 0x13, 0x47, 0x9a, 0x00, 0x00, 
+  0x00, 0x37, 0xff, 0x82, 0x13, 0xff, 0x00, 0x37, 0x98, 0x83, 0x00, 0x00, 0x02, 0x37, 0x03, 0x17, 0x18, 0x13, 0x28, 0x89, 0x13, 0x2f, 0x81, 0x13, 0x2c, 0x88, 0x13, 0x2f, 0x02, 0x13, 0x28, 0x13, 
+  0x1c, 0x37, 0x0b, 0x9b, 0x00, 0x00, 0x00, 0x13, 0xdc, 0x82, 0x13, 0xff, 0x00, 0x37, 0x70, 0x90, 0x00, 0x00, 0x01, 0x37, 0x3b, 0x37, 0x2f, 0xa7, 0x00, 0x00, 0x03, 0x13, 0x23, 0x13, 0xd3, 0x13, 
+  0xff, 0x13, 0x87, 0x89, 0x00, 0x00, 0x00, 0x37, 0x57, 0x86, 0x00, 0x00, 0x01, 0x37, 0xec, 0x37, 0xcf, 0xb4, 0x00, 0x00, 0x02, 0x37, 0x64, 0x33, 0xf0, 0x3b, 0x0c, 0x84, 0x00, 0x00, 0x00, 0x37, 
+  0x73, 0x81, 0x13, 0xff, 0x00, 0x3b, 0x4c, 0xb2, 0x00, 0x00, 0x03, 0x3b, 0x0f, 0x33, 0xe0, 0x13, 0xff, 0x37, 0x63, 0x83, 0x00, 0x00, 0x01, 0x3b, 0x0c, 0x33, 0xdc, 0x81, 0x13, 0xff, 0x01, 0x37, 
+  0xcf, 0x5f, 0x04, 0x84, 0x00, 0x00, 0x00, 0x37, 0x58, 0xab, 0x00, 0x00, 0x00, 0x37, 0x48, 0x81, 0x13, 0xff, 0x00, 0x37, 0xf3, 0x83, 0x00, 0x00, 0x01, 0x37, 0x2b, 0x13, 0xfb, 0x81, 0x13, 0xff, 
+  0x01, 0x13, 0xf3, 0x37, 0x20, 0x83, 0x00, 0x00, 0x02, 0x37, 0x18, 0x33, 0xfc, 0x37, 0x3f, 0xaa, 0x00, 0x00, 0x00, 0x37, 0xcc, 0x82, 0x13, 0xff, 0x00, 0x3b, 0x60, 0x82, 0x00, 0x00, 0x00, 0x13, 
+  0x30, 0x82, 0x13, 0xff, 0x01, 0x13, 0xf7, 0x37, 0x27, 0x83, 0x00, 0x00, 0x03, 0x37, 0x84, 0x13, 0xff, 0x33, 0xd3, 0x3b, 0x07, 0xa9, 0x00, 0x00, 0x83, 0x13, 0xff, 0x00, 0x37, 0xa0, 0x82, 0x00, 
+  0x00, 0x05, 0x37, 0x08, 0x13, 0xbc, 0x13, 0xff, 0x13, 0xfc, 0x13, 0xaf, 0x3b, 0x03, 0x82, 0x00, 0x00, 0x04, 0x5f, 0x07, 0x33, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x34, 0xa9, 0x00, 0x00, 0x00, 
+  0x13, 0x9c, 0x82, 0x13, 0xff, 0x00, 0x37, 0x33, 0x83, 0x00, 0x00, 0x03, 0x13, 0x08, 0x13, 0x2c, 0x13, 0x2b, 0x13, 0x04, 0x83, 0x00, 0x00, 0x00, 0x37, 0x87, 0x82, 0x13, 0xff, 0x00, 0x37, 0xa7, 
+  0xa9, 0x00, 0x00, 0x03, 0x13, 0x04, 0x13, 0x8b, 0x13, 0xc3, 0x13, 0x3c, 0x8c, 0x00, 0x00, 0x00, 0x33, 0xc4, 0x82, 0x13, 0xff, 0x00, 0x37, 0xe7, 0xba, 0x00, 0x00, 0x00, 0x33, 0x53, 0x82, 0x13, 
+  0xff, 0x00, 0x37, 0x7b, 0xbb, 0x00, 0x00, 0x03, 0x13, 0x53, 0x13, 0xc7, 0x13, 0x7b, 0x13, 0x03, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xcd, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x03, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x60, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x10, 0xa0, 0xff, 0x0b, 0x20, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x10, 0x40, 0xff, 0x94, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x43, 0x20, 0xff, 0x00, 0x40, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x08, 0xc0, 0xff, 0x00, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x20, 0xff, 0x54, 0x20, 0xff, 0xd7, 0xe2, 0xff, 0x04, 0x60, 0xff, 0x00, 0x20, 0xff, 0x63, 0xe0, 0xfe, 0xff, 0x60, 0xff, 0x40, 0x60, 0xff, 0x00, 0x60, 0xff, 0x24, 0x00, 0xff, 0xff, 0x60, 0xff, 0x34, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x0b, 0x80, 0xff, 0x08, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x20, 0xff, 0x5b, 0x40, 0xff, 0xb0, 0x81, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0xff, 0xc4, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xc3, 0xa1, 0xff, 0x17, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xd7, 0xc1, 0xff, 0x17, 0x20, 0xff, 0xeb, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xac, 0x20, 0xff, 0x00, 0xc0, 0xff, 0x0c, 0x20, 0xff, 0xd4, 0x40, 0xff, 0x40, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x04, 0xa0, 0xff, 0x04, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0xff, 0x87, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xdb, 0x80, 0xff, 0x2c, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xf4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xfb, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xe0, 0x60, 0xff, 0x40, 0x20, 0xff, 0xf7, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x6c, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x0f, 0x40, 0xff, 0x03, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x2b, 0x40, 0xff, 0xd4, 0x80, 0xff, 0x47, 0x20, 0xff, 0x00, 0x00, 0xff, 0xb3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xf8, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xfc, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0x97, 0x61, 0xff, 0x00, 0x60, 0xff, 0x67, 0x20, 0xff, 0xeb, 0x00, 0xff, 0x03, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xfe, 0x28, 0xc0, 0xfe, 0xfb, 0x00, 0xff, 0xff, 0x40, 0xff, 0xbc, 0xe0, 0xfe, 0xe3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xdc, 0x40, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0x80, 0xfe, 0x00, 0xe0, 0xff, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfe, 0x00, 0x60, 0xff, 0x30, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0xc0, 0xfe, 0x20, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0xe0, 0xfe, 0x00, 0x60, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x60, 0xff, 0x1c, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0xaf, 0x40, 0xff, 0xff, 0x40, 0xff, 0xb3, 0x40, 0xff, 0x74, 0xe0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xe8, 0x61, 0xff, 0x5c, 0x40, 0xff, 0xc3, 0x40, 0xff, 0xff, 0x20, 0xff, 0x40, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0xff, 0x4b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xef, 0xc0, 0xfe, 0x1c, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x04, 0x80, 0xff, 0x07, 0x20, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xd4, 0xe5, 0xff, 0x00, 0x61, 0xff, 0x00, 0x80, 0xff, 0x07, 0x60, 0xff, 0x04, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x40, 0xff, 0x3c, 0x40, 0xff, 0xdb, 0x60, 0xff, 0xcf, 0x61, 0xff, 0xc8, 0xe0, 0xfe, 0xfb, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xf3, 0x60, 0xff, 0xcb, 0x60, 0xff, 0xcf, 0x40, 0xff, 0xe7, 0x60, 0xff, 0x23, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xa0, 0xfe, 0x10, 0xc0, 0xfe, 0xe3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xbf, 0xe0, 0xfe, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xfe, 0x00, 0xc0, 0xfe, 0x83, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0x33, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x0f, 0x60, 0xff, 0x1c, 0x60, 0xff, 0x2b, 0x80, 0xff, 0x2f, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0x21, 0xff, 0xff, 0x08, 0xef, 0xff, 0x4e, 0xa6, 0xff, 0xb2, 0x5d, 0xff, 0x36, 0x05, 0xff, 0xf9, 0x04, 0xff, 0xf9, 0x04, 0xff, 0x36, 0x05, 0xff, 0xb2, 0x5d, 0xff, 0x2e, 0xa6, 0xff, 0xe8, 0xee, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xe0, 0x61, 0xff, 0x38, 0x60, 0xff, 0x27, 0x60, 0xff, 0x1b, 0x60, 0xff, 0x0b, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x40, 0x00, 0xff, 0xef, 0x00, 0xff, 0xfb, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0xc8, 0xce, 0xff, 0xb4, 0x6d, 0xff, 0x96, 0x1c, 0xff, 0xb6, 0x03, 0xff, 0xb6, 0x03, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb6, 0x03, 0xff, 0xb6, 0x03, 0xff, 0x96, 0x1c, 0xff, 0x94, 0x6d, 0xff, 0xa7, 0xce, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xf7, 0x00, 0xff, 0xfb, 0x60, 0xff, 0x1c, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xb7, 0x00, 0xc0, 0xfe, 0xb0, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x2e, 0x96, 0xff, 0x77, 0x04, 0xff, 0x96, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x96, 0x0b, 0xff, 0x77, 0x04, 0xff, 0x0e, 0x96, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x67, 0xe0, 0xfe, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xc2, 0xff, 0x00, 0xc0, 0xfe, 0xcb, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0xb3, 0x75, 0xff, 0xf6, 0x03, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xf6, 0x03, 0xff, 0x93, 0x75, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xac, 0x97, 0x25, 0x00, 0x3c, 0x05, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x20, 0xff, 0x00, 0x60, 0xff, 0x08, 0x60, 0xff, 0x20, 0x60, 0xff, 0x63, 0xe0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0xf1, 0x75, 0xff, 0xd6, 0x03, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x03, 0xff, 0x73, 0x4d, 0xff, 0xb2, 0x5d, 0xff, 0x37, 0x05, 0xff, 0xf9, 0x04, 0xff, 0x38, 0x05, 0xff, 0x75, 0x2d, 0xf0, 0x77, 0x3d, 0xa0, 0x98, 0x35, 0x44, 0x15, 0x56, 0x10, 0x99, 0x2d, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xc0, 0xff, 0x03, 0x20, 0xff, 0xaf, 0x00, 0xff, 0xf7, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x6e, 0xa6, 0xff, 0xf6, 0x03, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x03, 0xff, 0xd6, 0x03, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x76, 0x1c, 0xff, 0x18, 0x2d, 0xdc, 0xbb, 0x25, 0x4b, 0x59, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x40, 0xff, 0x00, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0xbc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x07, 0xef, 0xff, 0x96, 0x2c, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x97, 0x14, 0xff, 0x39, 0x25, 0x7c, 0x3c, 0x36, 0x04, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x60, 0xfe, 0x00, 0xc0, 0xfe, 0x8c, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0x2e, 0x96, 0xff, 0xd6, 0x03, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x39, 0x25, 0x90, 0x3c, 0x2e, 0x04, 0x7a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x60, 0xff, 0x00, 0xc0, 0xff, 0x03, 0x60, 0xff, 0x3b, 0x00, 0xff, 0xdb, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0xb5, 0x04, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0x37, 0x14, 0xfb, 0x59, 0x25, 0x57, 0x7a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x80, 0xff, 0x1f, 0x40, 0xff, 0xcc, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x20, 0xff, 0xff, 0xe3, 0xd6, 0xff, 0x6f, 0xa6, 0xff, 0x35, 0x8e, 0xff, 0xd7, 0x6d, 0xff, 0xb6, 0x03, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb8, 0x1c, 0xe8, 0x1c, 0x2e, 0x18, 0x9b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xff, 0x03, 0xa0, 0xfe, 0x74, 0xc0, 0xfe, 0xe8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xe6, 0xee, 0xff, 0x11, 0x76, 0xff, 0xd8, 0x04, 0xff, 0x37, 0x04, 0xff, 0xf6, 0x03, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x25, 0x80, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x40, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x10, 0xc0, 0xfe, 0x88, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xc7, 0xd6, 0xff, 0x17, 0x35, 0xff, 0x16, 0x04, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 0xdb, 0xdc, 0x2d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x1c, 0x00, 0xff, 0xdb, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc6, 0xee, 0xff, 0x16, 0x35, 0xff, 0xf6, 0x0b, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x14, 0xff, 0x36, 0x14, 0xff, 0x57, 0x14, 0xff, 0x57, 0x14, 0xff, 0x57, 0x14, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x60, 0xff, 0x00, 0x80, 0xff, 0x34, 0x20, 0xff, 0xf0, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xd0, 0x75, 0xff, 0x16, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x37, 0x14, 0xff, 0x16, 0x14, 0xff, 0x37, 0x14, 0xff, 0x77, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x60, 0xff, 0x04, 0x20, 0xff, 0x8f, 0xa0, 0xfe, 0xdb, 0xc0, 0xfe, 0xf7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc3, 0xd6, 0xff, 0x77, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xb8, 0x1c, 0xff, 0x97, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x60, 0xff, 0x00, 0x00, 0xff, 0x00, 0xa0, 0xfe, 0x07, 0xc0, 0xfe, 0x20, 0xc0, 0xfe, 0x98, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x0d, 0xa6, 0xff, 0x16, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xd8, 0x1c, 0xff, 0x17, 0x14, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x37, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xf5, 0x0b, 0x28, 0x3a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x1f, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x72, 0x85, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0xf9, 0x1c, 0xff, 0x19, 0x1d, 0xa3, 0x5a, 0x25, 0x37, 0xdb, 0x2d, 0x04, 0x9a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x0c, 0x00, 0xff, 0xd8, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x14, 0x85, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0x57, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 0xf7, 0x5a, 0x25, 0xa7, 0xda, 0x25, 0x10, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x5f, 0xc0, 0xfe, 0xd8, 0xc0, 0xfe, 0xdf, 0xc0, 0xfe, 0xe8, 0xe0, 0xfe, 0xff, 0x70, 0x8d, 0xff, 0x56, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xff, 0x97, 0x1c, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x24, 0xc7, 0x7a, 0x25, 0x17, 0x7a, 0x2d, 0x00, 0x5a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0x80, 0xfe, 0x03, 0xc0, 0xfe, 0x0c, 0xe0, 0xfe, 0x37, 0xc0, 0xfe, 0xff, 0x0a, 0xae, 0xff, 0x37, 0x04, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x16, 0x14, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x19, 0x25, 0xac, 0x78, 0x15, 0x00, 0x3c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0x20, 0xff, 0xb0, 0xc0, 0xfe, 0xff, 0xa0, 0xee, 0xff, 0x75, 0x04, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0xb7, 0x14, 0xff, 0xf8, 0x1c, 0xff, 0x19, 0x1d, 0xff, 0xf8, 0x1c, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xff, 0x7a, 0x25, 0x5c, 0x39, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x1f, 0xe0, 0xfe, 0xf7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xec, 0xa5, 0xff, 0x76, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x0c, 0xff, 0x19, 0x1d, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x97, 0x14, 0xcc, 0x1c, 0x2e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x40, 0xc0, 0xfe, 0x8f, 0xc0, 0xfe, 0x73, 0xc0, 0xfe, 0x57, 0xc0, 0xfe, 0xe4, 0x12, 0x65, 0xff, 0x77, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xff, 0x19, 0x1d, 0xff, 0x57, 0x14, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xff, 0x0c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x4f, 0x65, 0xff, 0x77, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0xd7, 0x14, 0xff, 0x56, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x40, 0xff, 0x67, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf7, 0x09, 0xae, 0xff, 0xf4, 0x5c, 0xff, 0xb5, 0x1c, 0xff, 0x96, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0xd8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0xb8, 0xc0, 0xfe, 0xa4, 0xc0, 0xfe, 0x4c, 0xc0, 0xfe, 0x3f, 0xe0, 0xfe, 0xf3, 0xa0, 0xf6, 0xff, 0x86, 0xee, 0xff, 0x89, 0xee, 0xff, 0x6b, 0xee, 0xff, 0x8b, 0xee, 0xff, 0x8b, 0xee, 0xff, 0x8b, 0xee, 0xff, 0x8b, 0xee, 0xff, 0x8b, 0xee, 0xff, 0xa9, 0xee, 0xff, 0x57, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xfc, 0x56, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x24, 0xc0, 0xfe, 0xf7, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xf7, 0x03, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0xef, 0xb7, 0x14, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x2b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0xc0, 0xfe, 0x54, 0xc0, 0xfe, 0xd4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x17, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xcf, 0x79, 0x25, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x27, 0xc0, 0xfe, 0x87, 0xa0, 0xfe, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0xa4, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xe0, 0xa5, 0xf6, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xb3, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x97, 0x14, 0x5f, 0x97, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xe0, 0xfe, 0x7b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x83, 0x17, 0x8e, 0x43, 0x34, 0x75, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xfc, 0xe0, 0xfe, 0xb3, 0xcd, 0xa5, 0xff, 0x56, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xaf, 0xb2, 0x01, 0x00, 0x38, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0xe0, 0xfe, 0x47, 0xc0, 0xfe, 0x53, 0x80, 0xfe, 0x00, 0x98, 0x1c, 0xcf, 0xd5, 0x03, 0xff, 0x6a, 0xde, 0xff, 0xc0, 0xfe, 0x8b, 0x80, 0xfe, 0x00, 0xa4, 0xee, 0xe4, 0xd4, 0x4c, 0xff, 0x77, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0xcf, 0x17, 0x1d, 0x18, 0x79, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfc, 0x00, 0x40, 0xfe, 0x00, 0x60, 0xfe, 0x00, 0xf8, 0x24, 0x2b, 0x16, 0x14, 0xfc, 0xd6, 0x03, 0xff, 0x35, 0x55, 0xef, 0x38, 0x05, 0x00, 0x20, 0xff, 0x00, 0xe0, 0xfe, 0x3f, 0x83, 0xe6, 0xff, 0x57, 0x04, 0xcf, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x14, 0x9c, 0xf7, 0x1c, 0x13, 0x55, 0x0c, 0x00, 0x98, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x19, 0x25, 0xa4, 0xf6, 0x0b, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xfb, 0x2d, 0x37, 0x9a, 0x1d, 0x00, 0x00, 0xff, 0x07, 0xc0, 0xfe, 0x48, 0x1f, 0x00, 0x04, 0x97, 0x14, 0x90, 0x97, 0x0c, 0xe4, 0x97, 0x14, 0xf8, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xec, 0x97, 0x14, 0xbc, 0x97, 0x14, 0x47, 0x36, 0x04, 0x00, 0x17, 0x00, 0x00, 0xb7, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x1c, 0x00, 0x97, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0xf8, 0x1c, 0x98, 0xf8, 0x1c, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0xd9, 0x03, 0x00, 0x3a, 0x25, 0x03, 0x97, 0x14, 0x18, 0x97, 0x14, 0x28, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x76, 0x0c, 0x2c, 0x76, 0x0c, 0x2c, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x2f, 0x97, 0x14, 0x28, 0x77, 0x14, 0x1c, 0xd7, 0x14, 0x0b, 0x14, 0x04, 0x00, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0xdc, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0xb7, 0x14, 0x70, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x2c, 0x00, 0x3a, 0x0d, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x7a, 0x2d, 0x00, 0x3a, 0x25, 0x3b, 0x3a, 0x25, 0x2f, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x00, 0x97, 0x14, 0x23, 0x76, 0x14, 0xd3, 0x76, 0x14, 0xff, 0x77, 0x14, 0x87, 0x00, 0x00, 0x00, 0x18, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x05, 0x00, 0x7a, 0x1d, 0x00, 0x7b, 0x25, 0x57, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x45, 0x00, 0xb8, 0x14, 0x00, 0x98, 0x1c, 0xec, 0xd8, 0x1c, 0xcf, 0x39, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x77, 0x0c, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x1d, 0x00, 0x5a, 0x25, 0x64, 0x57, 0x14, 0xf0, 0xbb, 0x25, 0x0c, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x25, 0x00, 0x5a, 0x25, 0x73, 0xb5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x9a, 0x25, 0x4c, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x15, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0xfc, 0x2d, 0x0f, 0x37, 0x14, 0xe0, 0xd6, 0x0b, 0xff, 0xf9, 0x24, 0x63, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x0c, 0x77, 0x14, 0xdc, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x97, 0x1c, 0xcf, 0xfe, 0x3e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x1d, 0x00, 0x7b, 0x25, 0x58, 0x7a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0xf8, 0x1c, 0x48, 0x16, 0x14, 0xff, 0xd6, 0x0b, 0xff, 0xb8, 0x1c, 0xf3, 0x14, 0x03, 0x00, 0xba, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1d, 0x2b, 0x56, 0x14, 0xfb, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x56, 0x14, 0xf3, 0x59, 0x25, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x5a, 0x25, 0x18, 0x57, 0x14, 0xfc, 0x9a, 0x25, 0x3f, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0x00, 0xf8, 0x1c, 0xcc, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x9a, 0x25, 0x60, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x30, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x14, 0xf7, 0xb7, 0x14, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0x7a, 0x25, 0x00, 0xf9, 0x24, 0x84, 0xb5, 0x0b, 0xff, 0x77, 0x14, 0xd3, 0x7d, 0x36, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x77, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xd8, 0x1c, 0xa0, 0xb8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x1c, 0x08, 0x76, 0x14, 0xbc, 0x76, 0x14, 0xff, 0x76, 0x14, 0xfc, 0x76, 0x14, 0xaf, 0x1b, 0x36, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x2d, 0x00, 0xbf, 0x47, 0x07, 0x77, 0x14, 0xff, 0xd6, 0x0b, 0xff, 0x16, 0x14, 0xfc, 0x19, 0x25, 0x34, 0xba, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x77, 0x14, 0x9c, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0xf8, 0x1c, 0x33, 0xd7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x76, 0x0c, 0x08, 0x76, 0x14, 0x2c, 0x77, 0x14, 0x2b, 0x97, 0x0c, 0x04, 0xb7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0x00, 0x59, 0x25, 0x87, 0xf6, 0x0b, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x19, 0x25, 0xa7, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x55, 0x04, 0x04, 0x76, 0x14, 0x8b, 0x76, 0x14, 0xc3, 0x97, 0x0c, 0x3c, 0xb7, 0x14, 0x00, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0xc4, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xe7, 0xb8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x77, 0x0c, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x53, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x97, 0x14, 0x7b, 0xd7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x76, 0x14, 0x53, 0x76, 0x14, 0xc7, 0x77, 0x14, 0x7b, 0xf6, 0x03, 0x03, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x77, 0x14, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x10, 0xa0, 0xff, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x10, 0x40, 
+  0xff, 0x94, 0x82, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x43, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x08, 0x82, 0x00, 0x00, 0x00, 0x0a, 0x20, 0xff, 0x54, 0x20, 0xff, 0xd7, 0xe2, 0xff, 0x04, 
+  0x00, 0x00, 0x00, 0x20, 0xff, 0x63, 0xe0, 0xfe, 0xff, 0x60, 0xff, 0x40, 0x00, 0x00, 0x00, 0x60, 0xff, 0x24, 0x00, 0xff, 0xff, 0x60, 0xff, 0x34, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x0b, 
+  0x80, 0xff, 0x08, 0xac, 0x00, 0x00, 0x00, 0x01, 0x20, 0xff, 0x5b, 0x40, 0xff, 0xb0, 0x81, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xff, 0xc4, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xc3, 0xa1, 0xff, 0x17, 0x00, 
+  0xff, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xd7, 0xc1, 0xff, 0x17, 0x20, 0xff, 0xeb, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xac, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x0c, 0x20, 0xff, 0xd4, 0x40, 0xff, 0x40, 
+  0xa8, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x04, 0xa0, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 0x07, 0x00, 0xff, 0x87, 0xc0, 0xfe, 0xff, 0x40, 0xff, 0xdb, 0x80, 0xff, 0x2c, 0xe0, 0xfe, 0xff, 0xc0, 
+  0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xf4, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xfb, 0x81, 0xc0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xe0, 0x60, 0xff, 0x40, 0x20, 0xff, 
+  0xf7, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x01, 0x80, 0xff, 0x0f, 0x40, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x04, 0x20, 0xff, 0x2b, 0x40, 0xff, 0xd4, 0x80, 0xff, 0x47, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb3, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xf8, 0xc0, 0xfe, 0xff, 0x88, 0xe0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xfc, 0x00, 0xff, 0xff, 0x81, 0xc0, 0xfe, 0xff, 
+  0x04, 0x00, 0xff, 0x97, 0x00, 0x00, 0x00, 0x60, 0xff, 0x67, 0x20, 0xff, 0xeb, 0x00, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xfe, 0x28, 0xc0, 0xfe, 0xfb, 0x00, 0xff, 0xff, 0x40, 0xff, 
+  0xbc, 0xe0, 0xfe, 0xe3, 0x81, 0xc0, 0xfe, 0xff, 0x8c, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x03, 0x00, 0xff, 0xdc, 0x40, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xa2, 0x00, 0x00, 
+  0x00, 0x00, 0x60, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xfe, 0x20, 0xc0, 0xfe, 0xf4, 0xc0, 0xfe, 0xff, 0x94, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0x82, 0x00, 
+  0x00, 0x00, 0x00, 0x60, 0xff, 0x1c, 0x9e, 0x00, 0x00, 0x00, 0x05, 0x20, 0xff, 0xaf, 0x40, 0xff, 0xff, 0x40, 0xff, 0xb3, 0x40, 0xff, 0x74, 0xe0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 
+  0xff, 0x86, 0xe1, 0xfe, 0xff, 0x86, 0xe0, 0xfe, 0xff, 0x05, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xe8, 0x61, 0xff, 0x5c, 0x40, 0xff, 0xc3, 0x40, 0xff, 0xff, 0x20, 0xff, 0x40, 0x9e, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x4b, 0x81, 0xc0, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x8a, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xff, 
+  0xc0, 0xfe, 0xef, 0xc0, 0xfe, 0x1c, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x04, 0x80, 0xff, 0x07, 0x81, 0x00, 0x00, 0x00, 0x82, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 
+  0xff, 0x8d, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xd4, 0x81, 0x00, 0x00, 0x00, 0x01, 0x80, 0xff, 0x07, 0x60, 0xff, 0x04, 0x98, 
+  0x00, 0x00, 0x00, 0x04, 0x40, 0xff, 0x3c, 0x40, 0xff, 0xdb, 0x60, 0xff, 0xcf, 0x61, 0xff, 0xc8, 0xe0, 0xfe, 0xfb, 0x83, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0x01, 0xff, 0xff, 0x84, 
+  0x21, 0xff, 0xff, 0x85, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xf3, 0x60, 0xff, 0xcb, 0x60, 0xff, 0xcf, 0x40, 0xff, 0xe7, 0x60, 0xff, 0x23, 0x98, 
+  0x00, 0x00, 0x00, 0x01, 0xa0, 0xfe, 0x10, 0xc0, 0xfe, 0xe3, 0x82, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x85, 0x01, 0xff, 0xff, 0x89, 0x21, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 0x00, 0xe1, 
+  0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xbf, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x83, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 
+  0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x86, 0x21, 0xff, 0xff, 0x84, 0x40, 0xff, 0xff, 0x82, 0x20, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 
+  0xfe, 0xff, 0xc0, 0xfe, 0xfb, 0xc0, 0xfe, 0x33, 0x97, 0x00, 0x00, 0x00, 0x04, 0x60, 0xff, 0x0f, 0x60, 0xff, 0x1c, 0x60, 0xff, 0x2b, 0x80, 0xff, 0x2f, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 
+  0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x05, 0x40, 0xff, 0xff, 0x21, 0xff, 0xff, 0x08, 0xef, 0xff, 0x4e, 0xa6, 0xff, 0xb2, 0x5d, 0xff, 0x36, 0x05, 0xff, 0x81, 
+  0xf9, 0x04, 0xff, 0x03, 0x36, 0x05, 0xff, 0xb2, 0x5d, 0xff, 0x2e, 0xa6, 0xff, 0xe8, 0xee, 0xff, 0x81, 0x00, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xe0, 
+  0x61, 0xff, 0x38, 0x60, 0xff, 0x27, 0x60, 0xff, 0x1b, 0x60, 0xff, 0x0b, 0x94, 0x00, 0x00, 0x00, 0x04, 0x20, 0xff, 0x40, 0x00, 0xff, 0xef, 0x00, 0xff, 0xfb, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 
+  0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x04, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0xc8, 0xce, 0xff, 0xb4, 0x6d, 0xff, 0x96, 0x1c, 0xff, 
+  0x81, 0xb6, 0x03, 0xff, 0x83, 0x95, 0x0b, 0xff, 0x81, 0xb6, 0x03, 0xff, 0x04, 0x96, 0x1c, 0xff, 0x94, 0x6d, 0xff, 0xa7, 0xce, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x84, 0xe0, 0xfe, 0xff, 
+  0x02, 0x00, 0xff, 0xf7, 0x00, 0xff, 0xfb, 0x60, 0xff, 0x1c, 0x95, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xb0, 0x82, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x82, 0x01, 
+  0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x81, 0x41, 0xff, 0xff, 0x03, 0x42, 0xff, 0xff, 0x2e, 0x96, 0xff, 0x77, 0x04, 0xff, 0x96, 0x0b, 0xff, 0x89, 0x95, 0x0b, 0xff, 0x02, 0x96, 0x0b, 0xff, 0x77, 
+  0x04, 0xff, 0x0e, 0x96, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x67, 0x97, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0xcb, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 
+  0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x81, 0x42, 0xff, 0xff, 0x01, 0xb3, 0x75, 0xff, 0xf6, 0x03, 0xff, 0x8d, 0x95, 0x0b, 0xff, 0x02, 
+  0xf6, 0x03, 0xff, 0x93, 0x75, 0xff, 0xe0, 0xfe, 0xff, 0x81, 0x00, 0xff, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xac, 0x95, 0x00, 0x00, 0x00, 0x04, 0x60, 0xff, 0x08, 0x60, 0xff, 0x20, 
+  0x60, 0xff, 0x63, 0xe0, 0xfe, 0xd0, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x03, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0xf1, 0x75, 0xff, 0xd6, 
+  0x03, 0xff, 0x8f, 0xb5, 0x0b, 0xff, 0x09, 0xd6, 0x03, 0xff, 0x73, 0x4d, 0xff, 0xb2, 0x5d, 0xff, 0x37, 0x05, 0xff, 0xf9, 0x04, 0xff, 0x38, 0x05, 0xff, 0x75, 0x2d, 0xf0, 0x77, 0x3d, 0xa0, 0x98, 
+  0x35, 0x44, 0x15, 0x56, 0x10, 0x91, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xff, 0x03, 0x20, 0xff, 0xaf, 0x00, 0xff, 0xf7, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x82, 0x01, 0xff, 
+  0xff, 0x82, 0x21, 0xff, 0xff, 0x03, 0x41, 0xff, 0xff, 0x40, 0xff, 0xff, 0x6e, 0xa6, 0xff, 0xf6, 0x03, 0xff, 0x91, 0xb5, 0x0b, 0xff, 0x81, 0xd6, 0x03, 0xff, 0x82, 0xb5, 0x0b, 0xff, 0x04, 0xd6, 
+  0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x76, 0x1c, 0xff, 0x18, 0x2d, 0xdc, 0xbb, 0x25, 0x4b, 0x92, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xbc, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 
+  0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x02, 0x41, 0xff, 0xff, 0x07, 0xef, 0xff, 0x96, 0x2c, 0xff, 0x9b, 0xb5, 0x0b, 0xff, 0x02, 0x97, 0x14, 0xff, 0x39, 0x25, 0x7c, 0x3c, 
+  0x36, 0x04, 0x91, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0x8c, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 0x02, 0x40, 0xff, 
+  0xff, 0x2e, 0x96, 0xff, 0xd6, 0x03, 0xff, 0x9b, 0xd5, 0x0b, 0xff, 0x03, 0xb5, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x39, 0x25, 0x90, 0x3c, 0x2e, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xc0, 0xff, 0x03, 
+  0x60, 0xff, 0x3b, 0x00, 0xff, 0xdb, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xff, 0xff, 0x81, 0x21, 0xff, 0xff, 0x82, 0x40, 0xff, 0xff, 0x00, 0xb5, 0x04, 
+  0xff, 0x9e, 0xd5, 0x0b, 0xff, 0x01, 0x37, 0x14, 0xfb, 0x59, 0x25, 0x57, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x80, 0xff, 0x1f, 0x40, 0xff, 0xcc, 0xe0, 0xfe, 0xfc, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 
+  0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x81, 0x01, 0xff, 0xff, 0x05, 0x20, 0xff, 0xff, 0xe3, 0xd6, 0xff, 0x6f, 0xa6, 0xff, 0x35, 0x8e, 0xff, 0xd7, 0x6d, 0xff, 0xb6, 0x03, 0xff, 0x9f, 0xd6, 0x0b, 
+  0xff, 0x01, 0xb8, 0x1c, 0xe8, 0x1c, 0x2e, 0x18, 0x8c, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0x03, 0xa0, 0xfe, 0x74, 0xc0, 0xfe, 0xe8, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x07, 0xe1, 
+  0xfe, 0xff, 0x00, 0xff, 0xff, 0xe6, 0xee, 0xff, 0x11, 0x76, 0xff, 0xd8, 0x04, 0xff, 0x37, 0x04, 0xff, 0xf6, 0x03, 0xff, 0xd5, 0x0b, 0xff, 0xa1, 0xf6, 0x0b, 0xff, 0x00, 0x19, 0x25, 0x80, 0x8e, 
+  0x00, 0x00, 0x00, 0x02, 0xc0, 0xfe, 0x10, 0xc0, 0xfe, 0x88, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x03, 0x00, 0xff, 0xff, 0xc7, 0xd6, 0xff, 0x17, 0x35, 0xff, 0x16, 0x04, 0xff, 0xa5, 0xf6, 
+  0x0b, 0xff, 0x01, 0x77, 0x14, 0xdb, 0xdc, 0x2d, 0x0c, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x60, 0xff, 0x1c, 0x00, 0xff, 0xdb, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x02, 0xc6, 0xee, 0xff, 0x16, 
+  0x35, 0xff, 0xf6, 0x0b, 0xff, 0x97, 0x16, 0x0c, 0xff, 0x01, 0x16, 0x14, 0xff, 0x36, 0x14, 0xff, 0x82, 0x57, 0x14, 0xff, 0x00, 0x36, 0x14, 0xff, 0x88, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x14, 0xef, 
+  0x39, 0x25, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x80, 0xff, 0x34, 0x20, 0xff, 0xf0, 0x81, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x02, 0x00, 0xff, 0xff, 0xd0, 0x75, 0xff, 0x16, 0x04, 0xff, 
+  0x96, 0x16, 0x0c, 0xff, 0x07, 0x36, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x37, 0x14, 0xff, 0x16, 0x14, 0xff, 0x37, 0x14, 0xff, 0x77, 0x14, 0xff, 0x81, 0xd8, 0x1c, 
+  0xff, 0x00, 0x36, 0x14, 0xff, 0x85, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x60, 0xff, 0x04, 0x20, 0xff, 0x8f, 0xa0, 0xfe, 0xdb, 0xc0, 0xfe, 
+  0xf7, 0x81, 0xc0, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xff, 0xc3, 0xd6, 0xff, 0x77, 0x04, 0xff, 0x95, 0x16, 0x0c, 0xff, 0x03, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xf6, 0x13, 0xff, 
+  0x85, 0x95, 0x0b, 0xff, 0x04, 0x75, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xb8, 0x1c, 0xff, 0x97, 0x14, 0xff, 0x36, 0x0c, 0xff, 0x83, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x33, 0x8d, 
+  0x00, 0x00, 0x00, 0x06, 0xa0, 0xfe, 0x07, 0xc0, 0xfe, 0x20, 0xc0, 0xfe, 0x98, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x0d, 0xa6, 0xff, 0x16, 0x04, 0xff, 0x95, 0x36, 0x0c, 0xff, 0x01, 0xd8, 0x1c, 
+  0xff, 0x17, 0x14, 0xff, 0x8a, 0x95, 0x0b, 0xff, 0x01, 0x37, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x81, 0x36, 0x0c, 0xff, 0x00, 0x36, 0x14, 0xff, 0x81, 0x36, 0x0c, 0xff, 0x00, 0xf5, 0x0b, 0x28, 0x8e, 
+  0x00, 0x00, 0x00, 0x04, 0x60, 0xff, 0x1f, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x72, 0x85, 0xff, 0x95, 0x36, 0x0c, 0xff, 0x02, 0x97, 0x14, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 
+  0xff, 0x8a, 0xb5, 0x0b, 0xff, 0x01, 0x95, 0x0b, 0xff, 0x16, 0x14, 0xff, 0x84, 0xf9, 0x1c, 0xff, 0x02, 0x19, 0x1d, 0xa3, 0x5a, 0x25, 0x37, 0xdb, 0x2d, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x80, 
+  0xff, 0x0c, 0x00, 0xff, 0xd8, 0x81, 0xc0, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xff, 0x14, 0x85, 0xff, 0x36, 0x0c, 0xff, 0x92, 0x56, 0x0c, 0xff, 0x02, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xff, 0x57, 0x14, 
+  0xff, 0x8e, 0xb5, 0x0b, 0xff, 0x00, 0xd6, 0x0b, 0xff, 0x82, 0xb5, 0x0b, 0xff, 0x04, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x77, 0x14, 0xf7, 0x5a, 0x25, 0xa7, 0xda, 0x25, 0x10, 0x8a, 0x00, 0x00, 
+  0x00, 0x06, 0x40, 0xff, 0x5f, 0xc0, 0xfe, 0xd8, 0xc0, 0xfe, 0xdf, 0xc0, 0xfe, 0xe8, 0xe0, 0xfe, 0xff, 0x70, 0x8d, 0xff, 0x56, 0x04, 0xff, 0x92, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xff, 0x97, 
+  0x1c, 0xff, 0x96, 0xb5, 0x0b, 0xff, 0x02, 0xf6, 0x13, 0xff, 0xf9, 0x24, 0xc7, 0x7a, 0x25, 0x17, 0x8a, 0x00, 0x00, 0x00, 0x05, 0x80, 0xfe, 0x03, 0xc0, 0xfe, 0x0c, 0xe0, 0xfe, 0x37, 0xc0, 0xfe, 
+  0xff, 0x0a, 0xae, 0xff, 0x37, 0x04, 0xff, 0x90, 0x56, 0x14, 0xff, 0x81, 0x56, 0x0c, 0xff, 0x01, 0x76, 0x14, 0xff, 0x16, 0x14, 0xff, 0x97, 0xd5, 0x0b, 0xff, 0x01, 0xf6, 0x0b, 0xff, 0x19, 0x25, 
+  0xac, 0x8c, 0x00, 0x00, 0x00, 0x04, 0x20, 0xff, 0xb0, 0xc0, 0xfe, 0xff, 0xa0, 0xee, 0xff, 0x75, 0x04, 0xff, 0x76, 0x0c, 0xff, 0x8e, 0x76, 0x14, 0xff, 0x04, 0xb7, 0x14, 0xff, 0xf8, 0x1c, 0xff, 
+  0x19, 0x1d, 0xff, 0xf8, 0x1c, 0xff, 0xf6, 0x0b, 0xff, 0x98, 0xd6, 0x0b, 0xff, 0x01, 0x36, 0x14, 0xff, 0x7a, 0x25, 0x5c, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x1f, 0xe0, 0xfe, 0xf7, 0x81, 
+  0xc0, 0xfe, 0xff, 0x01, 0xec, 0xa5, 0xff, 0x76, 0x04, 0xff, 0x8c, 0x76, 0x14, 0xff, 0x04, 0x76, 0x0c, 0xff, 0x19, 0x1d, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x9a, 0xf6, 
+  0x0b, 0xff, 0x02, 0xd6, 0x0b, 0xff, 0x97, 0x14, 0xcc, 0x1c, 0x2e, 0x08, 0x89, 0x00, 0x00, 0x00, 0x06, 0x20, 0xff, 0x40, 0xc0, 0xfe, 0x8f, 0xc0, 0xfe, 0x73, 0xc0, 0xfe, 0x57, 0xc0, 0xfe, 0xe4, 
+  0x12, 0x65, 0xff, 0x77, 0x04, 0xff, 0x8a, 0x76, 0x14, 0xff, 0x02, 0x77, 0x14, 0xff, 0x19, 0x1d, 0xff, 0x57, 0x14, 0xff, 0x9e, 0xf6, 0x0b, 0xff, 0x01, 0x36, 0x14, 0xef, 0x39, 0x25, 0x1c, 0x8c, 
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x0c, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x4f, 0x65, 0xff, 0x77, 0x04, 0xff, 0x89, 0x76, 0x14, 0xff, 0x01, 0xd7, 0x14, 0xff, 0x56, 0x14, 0xff, 0x9f, 0x16, 0x0c, 
+  0xff, 0x01, 0x36, 0x14, 0xfc, 0x97, 0x14, 0x2b, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x67, 0x81, 0xc0, 0xfe, 0xff, 0x04, 0xc0, 0xfe, 0xf7, 0x09, 0xae, 0xff, 0xf4, 0x5c, 0xff, 0xb5, 0x1c, 
+  0xff, 0x96, 0x04, 0xff, 0x86, 0x77, 0x04, 0xff, 0x00, 0xd8, 0x1c, 0xff, 0xa0, 0x16, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x56, 0x14, 0x30, 0x8c, 0x00, 0x00, 0x00, 0x08, 0xe0, 0xfe, 0xb8, 0xc0, 
+  0xfe, 0xa4, 0xc0, 0xfe, 0x4c, 0xc0, 0xfe, 0x3f, 0xe0, 0xfe, 0xf3, 0xa0, 0xf6, 0xff, 0x86, 0xee, 0xff, 0x89, 0xee, 0xff, 0x6b, 0xee, 0xff, 0x84, 0x8b, 0xee, 0xff, 0x01, 0xa9, 0xee, 0xff, 0x57, 
+  0x04, 0xff, 0xa0, 0x36, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xfc, 0x56, 0x14, 0x2b, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0x24, 0xc0, 0xfe, 0xf7, 0x82, 0xc0, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 
+  0x01, 0x00, 0xff, 0xff, 0xf7, 0x03, 0xff, 0xa0, 0x36, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xef, 0xb7, 0x14, 0x1c, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xfe, 0x2b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 
+  0xc0, 0xfe, 0x54, 0xc0, 0xfe, 0xd4, 0x83, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 0x17, 0x04, 0xff, 0xa0, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xcf, 0x79, 0x25, 0x08, 
+  0x8f, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xfe, 0x27, 0xc0, 0xfe, 0x87, 0x81, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0xa4, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xe0, 0xa5, 0xf6, 0xff, 0x81, 0xc0, 
+  0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xff, 0xb3, 0x04, 0xff, 0xa0, 0x56, 0x0c, 0xff, 0x00, 0x97, 0x14, 0x5f, 0x94, 0x00, 0x00, 0x00, 0x09, 0xe0, 0xfe, 0x7b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x83, 0x17, 
+  0x8e, 0x43, 0x34, 0x75, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xfc, 0xe0, 0xfe, 0xb3, 0xcd, 0xa5, 0xff, 0x56, 0x04, 0xff, 0x9e, 0x76, 0x14, 0xff, 0x00, 0x77, 0x14, 0xaf, 0x95, 0x00, 0x00, 0x00, 
+  0x0a, 0xe0, 0xfe, 0x47, 0xc0, 0xfe, 0x53, 0x00, 0x00, 0x00, 0x98, 0x1c, 0xcf, 0xd5, 0x03, 0xff, 0x6a, 0xde, 0xff, 0xc0, 0xfe, 0x8b, 0x00, 0x00, 0x00, 0xa4, 0xee, 0xe4, 0xd4, 0x4c, 0xff, 0x77, 
+  0x0c, 0xff, 0x9c, 0x76, 0x14, 0xff, 0x01, 0x77, 0x14, 0xcf, 0x17, 0x1d, 0x18, 0x97, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x24, 0x2b, 0x16, 0x14, 0xfc, 0xd6, 0x03, 0xff, 0x35, 0x55, 0xef, 0x81, 0x00, 
+  0x00, 0x00, 0x02, 0xe0, 0xfe, 0x3f, 0x83, 0xe6, 0xff, 0x57, 0x04, 0xcf, 0x9b, 0x76, 0x14, 0xff, 0x01, 0x77, 0x14, 0x9c, 0xf7, 0x1c, 0x13, 0x98, 0x00, 0x00, 0x00, 0x0b, 0x19, 0x25, 0xa4, 0xf6, 
+  0x0b, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xfb, 0x2d, 0x37, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xc0, 0xfe, 0x48, 0x1f, 0x00, 0x04, 0x97, 0x14, 0x90, 0x97, 0x0c, 0xe4, 0x97, 0x14, 0xf8, 
+  0x94, 0x97, 0x14, 0xff, 0x03, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xec, 0x97, 0x14, 0xbc, 0x97, 0x14, 0x47, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0xff, 0x81, 0x36, 0x0c, 0xff, 0x01, 0x16, 0x0c, 
+  0xff, 0xf8, 0x1c, 0x98, 0x83, 0x00, 0x00, 0x00, 0x02, 0x3a, 0x25, 0x03, 0x97, 0x14, 0x18, 0x97, 0x14, 0x28, 0x89, 0x97, 0x14, 0x2f, 0x81, 0x76, 0x0c, 0x2c, 0x88, 0x97, 0x14, 0x2f, 0x02, 0x97, 
+  0x14, 0x28, 0x77, 0x14, 0x1c, 0xd7, 0x14, 0x0b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0xdc, 0x82, 0x56, 0x0c, 0xff, 0x00, 0xb7, 0x14, 0x70, 0x90, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x25, 0x3b, 
+  0x3a, 0x25, 0x2f, 0xa7, 0x00, 0x00, 0x00, 0x03, 0x97, 0x14, 0x23, 0x76, 0x14, 0xd3, 0x76, 0x14, 0xff, 0x77, 0x14, 0x87, 0x89, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x25, 0x57, 0x86, 0x00, 0x00, 0x00, 
+  0x01, 0x98, 0x1c, 0xec, 0xd8, 0x1c, 0xcf, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x5a, 0x25, 0x64, 0x57, 0x14, 0xf0, 0xbb, 0x25, 0x0c, 0x84, 0x00, 0x00, 0x00, 0x03, 0x5a, 0x25, 0x73, 0xb5, 0x0b, 0xff, 
+  0xf6, 0x0b, 0xff, 0x9a, 0x25, 0x4c, 0xb2, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x2d, 0x0f, 0x37, 0x14, 0xe0, 0xd6, 0x0b, 0xff, 0xf9, 0x24, 0x63, 0x83, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x36, 0x0c, 0x77, 
+  0x14, 0xdc, 0x81, 0xf6, 0x0b, 0xff, 0x01, 0x97, 0x1c, 0xcf, 0xfe, 0x3e, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x25, 0x58, 0xab, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x1c, 0x48, 0x16, 0x14, 0xff, 
+  0xd6, 0x0b, 0xff, 0xb8, 0x1c, 0xf3, 0x83, 0x00, 0x00, 0x00, 0x01, 0x18, 0x1d, 0x2b, 0x56, 0x14, 0xfb, 0x81, 0x16, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xf3, 0x59, 0x25, 0x20, 0x83, 0x00, 0x00, 0x00, 
+  0x02, 0x5a, 0x25, 0x18, 0x57, 0x14, 0xfc, 0x9a, 0x25, 0x3f, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1c, 0xcc, 0x82, 0x16, 0x0c, 0xff, 0x00, 0x9a, 0x25, 0x60, 0x82, 0x00, 0x00, 0x00, 0x00, 0x76, 
+  0x14, 0x30, 0x82, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x14, 0xf7, 0xb7, 0x14, 0x27, 0x83, 0x00, 0x00, 0x00, 0x03, 0xf9, 0x24, 0x84, 0xb5, 0x0b, 0xff, 0x77, 0x14, 0xd3, 0x7d, 0x36, 0x07, 0xa9, 0x00, 
+  0x00, 0x00, 0x00, 0x77, 0x14, 0xff, 0x82, 0x36, 0x0c, 0xff, 0x00, 0xd8, 0x1c, 0xa0, 0x82, 0x00, 0x00, 0x00, 0x05, 0xd8, 0x1c, 0x08, 0x76, 0x14, 0xbc, 0x76, 0x14, 0xff, 0x76, 0x14, 0xfc, 0x76, 
+  0x14, 0xaf, 0x1b, 0x36, 0x03, 0x82, 0x00, 0x00, 0x00, 0x04, 0xbf, 0x47, 0x07, 0x77, 0x14, 0xff, 0xd6, 0x0b, 0xff, 0x16, 0x14, 0xfc, 0x19, 0x25, 0x34, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x77, 0x14, 
+  0x9c, 0x82, 0x56, 0x14, 0xff, 0x00, 0xf8, 0x1c, 0x33, 0x83, 0x00, 0x00, 0x00, 0x03, 0x76, 0x0c, 0x08, 0x76, 0x14, 0x2c, 0x77, 0x14, 0x2b, 0x97, 0x0c, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x59, 
+  0x25, 0x87, 0xf6, 0x0b, 0xff, 0x81, 0x16, 0x0c, 0xff, 0x00, 0x19, 0x25, 0xa7, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x55, 0x04, 0x04, 0x76, 0x14, 0x8b, 0x76, 0x14, 0xc3, 0x97, 0x0c, 0x3c, 0x8c, 0x00, 
+  0x00, 0x00, 0x00, 0x97, 0x14, 0xc4, 0x82, 0x36, 0x0c, 0xff, 0x00, 0x97, 0x14, 0xe7, 0xba, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x53, 0x82, 0x56, 0x14, 0xff, 0x00, 0x97, 0x14, 0x7b, 0xbb, 0x00, 
+  0x00, 0x00, 0x03, 0x76, 0x14, 0x53, 0x76, 0x14, 0xc7, 0x77, 0x14, 0x7b, 0xf6, 0x03, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x03, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0xfe, 0xe0, 0x00, 0xb5, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x10, 0xff, 0xa0, 0x0b, 0xff, 0x20, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x10, 0xff, 0x40, 0x94, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x43, 0xff, 0x20, 0x00, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x08, 0xff, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x20, 0x54, 0xff, 0x20, 0xd7, 0xff, 0xe2, 0x04, 0xff, 0x60, 0x00, 0xff, 0x20, 0x63, 0xfe, 0xe0, 0xff, 0xff, 0x60, 0x40, 0xff, 0x60, 0x00, 0xff, 0x60, 0x24, 0xff, 0x00, 0xff, 0xff, 0x60, 0x34, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x0b, 0xff, 0x80, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x20, 0x5b, 0xff, 0x40, 0xb0, 0xff, 0x81, 0x00, 0xff, 0x40, 0x00, 0xff, 0x00, 0xc4, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xc3, 0xff, 0xa1, 0x17, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xc1, 0x17, 0xff, 0x20, 0xeb, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xac, 0xff, 0x20, 0x00, 0xff, 0xc0, 0x0c, 0xff, 0x20, 0xd4, 0xff, 0x40, 0x40, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x04, 0xff, 0xa0, 0x04, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x00, 0x87, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xdb, 0xff, 0x80, 0x2c, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xf4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xfb, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xe0, 0xff, 0x60, 0x40, 0xff, 0x20, 0xf7, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x6c, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x0f, 0xff, 0x40, 0x03, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x2b, 0xff, 0x40, 0xd4, 0xff, 0x80, 0x47, 0xff, 0x20, 0x00, 0xff, 0x00, 0xb3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xf8, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xfc, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0x97, 0xff, 0x61, 0x00, 0xff, 0x60, 0x67, 0xff, 0x20, 0xeb, 0xff, 0x00, 0x03, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0xfe, 0xe0, 0x28, 0xfe, 0xc0, 0xfb, 0xff, 0x00, 0xff, 0xff, 0x40, 0xbc, 0xfe, 0xe0, 0xe3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xdc, 0xff, 0x40, 0xe7, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0x80, 0x00, 0xff, 0xe0, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x20, 0x00, 0xff, 0x60, 0x30, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xfe, 0xc0, 0x20, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 0xfe, 0xe0, 0x00, 0xff, 0x60, 0x00, 0xfe, 0x80, 0x00, 0xff, 0x60, 0x1c, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0xaf, 0xff, 0x40, 0xff, 0xff, 0x40, 0xb3, 0xff, 0x40, 0x74, 0xfe, 0xe0, 0xf0, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xe8, 0xff, 0x61, 0x5c, 0xff, 0x40, 0xc3, 0xff, 0x40, 0xff, 0xff, 0x20, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x00, 0x4b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xef, 0xfe, 0xc0, 0x1c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x04, 0xff, 0x80, 0x07, 0xff, 0x20, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xd4, 0xff, 0xe5, 0x00, 0xff, 0x61, 0x00, 0xff, 0x80, 0x07, 0xff, 0x60, 0x04, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x40, 0x3c, 0xff, 0x40, 0xdb, 0xff, 0x60, 0xcf, 0xff, 0x61, 0xc8, 0xfe, 0xe0, 0xfb, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xf3, 0xff, 0x60, 0xcb, 0xff, 0x60, 0xcf, 0xff, 0x40, 0xe7, 0xff, 0x60, 0x23, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xfe, 0xa0, 0x10, 0xfe, 0xc0, 0xe3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xbf, 0xfe, 0xe0, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xa0, 0x00, 0xfe, 0xc0, 0x83, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0x33, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x0f, 0xff, 0x60, 0x1c, 0xff, 0x60, 0x2b, 0xff, 0x80, 0x2f, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0x21, 0xff, 0xef, 0x08, 0xff, 0xa6, 0x4e, 0xff, 0x5d, 0xb2, 0xff, 0x05, 0x36, 0xff, 0x04, 0xf9, 0xff, 0x04, 0xf9, 0xff, 0x05, 0x36, 0xff, 0x5d, 0xb2, 0xff, 0xa6, 0x2e, 0xff, 0xee, 0xe8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xe0, 0xff, 0x61, 0x38, 0xff, 0x60, 0x27, 0xff, 0x60, 0x1b, 0xff, 0x60, 0x0b, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x40, 0xff, 0x00, 0xef, 0xff, 0x00, 0xfb, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xce, 0xc8, 0xff, 0x6d, 0xb4, 0xff, 0x1c, 0x96, 0xff, 0x03, 0xb6, 0xff, 0x03, 0xb6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x03, 0xb6, 0xff, 0x03, 0xb6, 0xff, 0x1c, 0x96, 0xff, 0x6d, 0x94, 0xff, 0xce, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x00, 0xfb, 0xff, 0x60, 0x1c, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xb7, 0xe0, 0x00, 0xfe, 0xc0, 0xb0, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0x96, 0x2e, 0xff, 0x04, 0x77, 0xff, 0x0b, 0x96, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x96, 0xff, 0x04, 0x77, 0xff, 0x96, 0x0e, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x67, 0xfe, 0xe0, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0xc2, 0x00, 0xfe, 0xc0, 0xcb, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0x75, 0xb3, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x03, 0xf6, 0xff, 0x75, 0x93, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xac, 0x25, 0x97, 0x00, 0x05, 0x3c, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x20, 0x00, 0xff, 0x60, 0x08, 0xff, 0x60, 0x20, 0xff, 0x60, 0x63, 0xfe, 0xe0, 0xd0, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0x75, 0xf1, 0xff, 0x03, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x03, 0xd6, 0xff, 0x4d, 0x73, 0xff, 0x5d, 0xb2, 0xff, 0x05, 0x37, 0xff, 0x04, 0xf9, 0xff, 0x05, 0x38, 0xff, 0x2d, 0x75, 0xf0, 0x3d, 0x77, 0xa0, 0x35, 0x98, 0x44, 0x56, 0x15, 0x10, 0x2d, 0x99, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xc0, 0x03, 0xff, 0x20, 0xaf, 0xff, 0x00, 0xf7, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xa6, 0x6e, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x03, 0xd6, 0xff, 0x03, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0x76, 0xff, 0x2d, 0x18, 0xdc, 0x25, 0xbb, 0x4b, 0x25, 0x59, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x40, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xc0, 0xbc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xef, 0x07, 0xff, 0x2c, 0x96, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x97, 0xff, 0x25, 0x39, 0x7c, 0x36, 0x3c, 0x04, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x60, 0x00, 0xfe, 0xc0, 0x8c, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0x96, 0x2e, 0xff, 0x03, 0xd6, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x37, 0xff, 0x25, 0x39, 0x90, 0x2e, 0x3c, 0x04, 0x2d, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x60, 0x00, 0xff, 0xc0, 0x03, 0xff, 0x60, 0x3b, 0xff, 0x00, 0xdb, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0x04, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x14, 0x37, 0xfb, 0x25, 0x59, 0x57, 0x25, 0x7a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x80, 0x1f, 0xff, 0x40, 0xcc, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x20, 0xff, 0xd6, 0xe3, 0xff, 0xa6, 0x6f, 0xff, 0x8e, 0x35, 0xff, 0x6d, 0xd7, 0xff, 0x03, 0xb6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0xb8, 0xe8, 0x2e, 0x1c, 0x18, 0x2d, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x00, 0x03, 0xfe, 0xa0, 0x74, 0xfe, 0xc0, 0xe8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0xff, 0xee, 0xe6, 0xff, 0x76, 0x11, 0xff, 0x04, 0xd8, 0xff, 0x04, 0x37, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x19, 0x80, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x40, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x10, 0xfe, 0xc0, 0x88, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xd6, 0xc7, 0xff, 0x35, 0x17, 0xff, 0x04, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 0xdb, 0x2d, 0xdc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x1c, 0xff, 0x00, 0xdb, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xee, 0xc6, 0xff, 0x35, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x16, 0xff, 0x14, 0x36, 0xff, 0x14, 0x57, 0xff, 0x14, 0x57, 0xff, 0x14, 0x57, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x60, 0x00, 0xff, 0x80, 0x34, 0xff, 0x20, 0xf0, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0x75, 0xd0, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x57, 0xff, 0x14, 0x37, 0xff, 0x14, 0x16, 0xff, 0x14, 0x37, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x60, 0x04, 0xff, 0x20, 0x8f, 0xfe, 0xa0, 0xdb, 0xfe, 0xc0, 0xf7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xd6, 0xc3, 0xff, 0x04, 0x77, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xb8, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x97, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x60, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xa0, 0x07, 0xfe, 0xc0, 0x20, 0xfe, 0xc0, 0x98, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xa6, 0x0d, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x17, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x37, 0xff, 0x1c, 0xb8, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0b, 0xf5, 0x28, 0x25, 0x3a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x1f, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0x85, 0x72, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xf9, 0xff, 0x1d, 0x19, 0xa3, 0x25, 0x5a, 0x37, 0x2d, 0xdb, 0x04, 0x25, 0x9a, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x0c, 0xff, 0x00, 0xd8, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0x85, 0x14, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 0xf7, 0x25, 0x5a, 0xa7, 0x25, 0xda, 0x10, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x5f, 0xfe, 0xc0, 0xd8, 0xfe, 0xc0, 0xdf, 0xfe, 0xc0, 0xe8, 0xfe, 0xe0, 0xff, 0x8d, 0x70, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xff, 0x1c, 0x97, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x24, 0xf9, 0xc7, 0x25, 0x7a, 0x17, 0x2d, 0x7a, 0x00, 0x2d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xfe, 0x80, 0x03, 0xfe, 0xc0, 0x0c, 0xfe, 0xe0, 0x37, 0xfe, 0xc0, 0xff, 0xae, 0x0a, 0xff, 0x04, 0x37, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x76, 0xff, 0x14, 0x16, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x19, 0xac, 0x15, 0x78, 0x00, 0x3d, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x20, 0xb0, 0xfe, 0xc0, 0xff, 0xee, 0xa0, 0xff, 0x04, 0x75, 0xff, 0x0c, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0xb7, 0xff, 0x1c, 0xf8, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xf8, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xff, 0x25, 0x7a, 0x5c, 0x25, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x1f, 0xfe, 0xe0, 0xf7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xa5, 0xec, 0xff, 0x04, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x97, 0xcc, 0x2e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x40, 0xfe, 0xc0, 0x8f, 0xfe, 0xc0, 0x73, 0xfe, 0xc0, 0x57, 0xfe, 0xc0, 0xe4, 0x65, 0x12, 0xff, 0x04, 0x77, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xff, 0x1d, 0x19, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0xe0, 0x0c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0x65, 0x4f, 0xff, 0x04, 0x77, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0xd7, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x40, 0x67, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf7, 0xae, 0x09, 0xff, 0x5c, 0xf4, 0xff, 0x1c, 0xb5, 0xff, 0x04, 0x96, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x1c, 0xd8, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0xb8, 0xfe, 0xc0, 0xa4, 0xfe, 0xc0, 0x4c, 0xfe, 0xc0, 0x3f, 0xfe, 0xe0, 0xf3, 0xf6, 0xa0, 0xff, 0xee, 0x86, 0xff, 0xee, 0x89, 0xff, 0xee, 0x6b, 0xff, 0xee, 0x8b, 0xff, 0xee, 0x8b, 0xff, 0xee, 0x8b, 0xff, 0xee, 0x8b, 0xff, 0xee, 0x8b, 0xff, 0xee, 0xa9, 0xff, 0x04, 0x57, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xfc, 0x14, 0x56, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x24, 0xfe, 0xc0, 0xf7, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0x03, 0xf7, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0xef, 0x14, 0xb7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x2b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 0xfe, 0xc0, 0x54, 0xfe, 0xc0, 0xd4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0x04, 0x17, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xcf, 0x25, 0x79, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x27, 0xfe, 0xc0, 0x87, 0xfe, 0xa0, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0xa4, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xe0, 0xf6, 0xa5, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0x04, 0xb3, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x97, 0x5f, 0x1c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xe0, 0x7b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x83, 0x8e, 0x17, 0x43, 0x75, 0x34, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xfc, 0xfe, 0xe0, 0xb3, 0xa5, 0xcd, 0xff, 0x04, 0x56, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xaf, 0x01, 0xb2, 0x00, 0x1d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xfe, 0xe0, 0x47, 0xfe, 0xc0, 0x53, 0xfe, 0x80, 0x00, 0x1c, 0x98, 0xcf, 0x03, 0xd5, 0xff, 0xde, 0x6a, 0xff, 0xfe, 0xc0, 0x8b, 0xfe, 0x80, 0x00, 0xee, 0xa4, 0xe4, 0x4c, 0xd4, 0xff, 0x0c, 0x77, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0xcf, 0x1d, 0x17, 0x18, 0x36, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x80, 0x00, 0xfe, 0x40, 0x00, 0xfe, 0x60, 0x00, 0x24, 0xf8, 0x2b, 0x14, 0x16, 0xfc, 0x03, 0xd6, 0xff, 0x55, 0x35, 0xef, 0x05, 0x38, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xe0, 0x3f, 0xe6, 0x83, 0xff, 0x04, 0x57, 0xcf, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x77, 0x9c, 0x1c, 0xf7, 0x13, 0x0c, 0x55, 0x00, 0x25, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x19, 0xa4, 0x0b, 0xf6, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x2d, 0xfb, 0x37, 0x1d, 0x9a, 0x00, 0xff, 0x00, 0x07, 0xfe, 0xc0, 0x48, 0x00, 0x1f, 0x04, 0x14, 0x97, 0x90, 0x0c, 0x97, 0xe4, 0x14, 0x97, 0xf8, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xec, 0x14, 0x97, 0xbc, 0x14, 0x97, 0x47, 0x04, 0x36, 0x00, 0x00, 0x17, 0x00, 0x25, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb7, 0x00, 0x14, 0x97, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x1c, 0xf8, 0x98, 0x1c, 0xf8, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x00, 0x03, 0xd9, 0x00, 0x25, 0x3a, 0x03, 0x14, 0x97, 0x18, 0x14, 0x97, 0x28, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x0c, 0x76, 0x2c, 0x0c, 0x76, 0x2c, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x2f, 0x14, 0x97, 0x28, 0x14, 0x77, 0x1c, 0x14, 0xd7, 0x0b, 0x04, 0x14, 0x00, 0x24, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0xdc, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0xb7, 0x70, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xf9, 0x00, 0x0d, 0x3a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x2d, 0x7a, 0x00, 0x25, 0x3a, 0x3b, 0x25, 0x3a, 0x2f, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x00, 0x14, 0x97, 0x23, 0x14, 0x76, 0xd3, 0x14, 0x76, 0xff, 0x14, 0x77, 0x87, 0x00, 0x00, 0x00, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x58, 0x00, 0x1d, 0x7a, 0x00, 0x25, 0x7b, 0x57, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x5d, 0x00, 0x14, 0xb8, 0x00, 0x1c, 0x98, 0xec, 0x1c, 0xd8, 0xcf, 0x25, 0x39, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x0c, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x39, 0x00, 0x25, 0x5a, 0x64, 0x14, 0x57, 0xf0, 0x25, 0xbb, 0x0c, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x3a, 0x00, 0x25, 0x5a, 0x73, 0x0b, 0xb5, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x9a, 0x4c, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x00, 0x2d, 0xfc, 0x0f, 0x14, 0x37, 0xe0, 0x0b, 0xd6, 0xff, 0x24, 0xf9, 0x63, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x3c, 0x0c, 0x14, 0x77, 0xdc, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0x97, 0xcf, 0x3e, 0xfe, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x7a, 0x00, 0x25, 0x7b, 0x58, 0x25, 0x7a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9a, 0x00, 0x1c, 0xf8, 0x48, 0x14, 0x16, 0xff, 0x0b, 0xd6, 0xff, 0x1c, 0xb8, 0xf3, 0x03, 0x14, 0x00, 0x2d, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x18, 0x2b, 0x14, 0x56, 0xfb, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x56, 0xf3, 0x25, 0x59, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x48, 0x00, 0x25, 0x5a, 0x18, 0x14, 0x57, 0xfc, 0x25, 0x9a, 0x3f, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x39, 0x00, 0x1c, 0xf8, 0xcc, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x25, 0x9a, 0x60, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x30, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x56, 0xf7, 0x14, 0xb7, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x00, 0x25, 0x7a, 0x00, 0x24, 0xf9, 0x84, 0x0b, 0xb5, 0xff, 0x14, 0x77, 0xd3, 0x36, 0x7d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x77, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x1c, 0xd8, 0xa0, 0x1c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd8, 0x08, 0x14, 0x76, 0xbc, 0x14, 0x76, 0xff, 0x14, 0x76, 0xfc, 0x14, 0x76, 0xaf, 0x36, 0x1b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x9a, 0x00, 0x47, 0xbf, 0x07, 0x14, 0x77, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x16, 0xfc, 0x25, 0x19, 0x34, 0x2d, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x77, 0x9c, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x1c, 0xf8, 0x33, 0x1c, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x0c, 0x76, 0x08, 0x14, 0x76, 0x2c, 0x14, 0x77, 0x2b, 0x0c, 0x97, 0x04, 0x14, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x39, 0x00, 0x25, 0x59, 0x87, 0x0b, 0xf6, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x25, 0x19, 0xa7, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x04, 0x55, 0x04, 0x14, 0x76, 0x8b, 0x14, 0x76, 0xc3, 0x0c, 0x97, 0x3c, 0x14, 0xb7, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0xc4, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xe7, 0x1c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x0c, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x53, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x97, 0x7b, 0x1c, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x76, 0x53, 0x14, 0x76, 0xc7, 0x14, 0x77, 0x7b, 0x03, 0xf6, 0x03, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x10, 0xff, 0xa0, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x10, 0xff, 
+  0x40, 0x94, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x43, 0xb1, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x08, 0x82, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x20, 0x54, 0xff, 0x20, 0xd7, 0xff, 0xe2, 0x04, 
+  0x00, 0x00, 0x00, 0xff, 0x20, 0x63, 0xfe, 0xe0, 0xff, 0xff, 0x60, 0x40, 0x00, 0x00, 0x00, 0xff, 0x60, 0x24, 0xff, 0x00, 0xff, 0xff, 0x60, 0x34, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x0b, 
+  0xff, 0x80, 0x08, 0xac, 0x00, 0x00, 0x00, 0x01, 0xff, 0x20, 0x5b, 0xff, 0x40, 0xb0, 0x81, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x00, 0xc4, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xc3, 0xff, 0xa1, 0x17, 0xff, 
+  0x00, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xc1, 0x17, 0xff, 0x20, 0xeb, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xac, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x0c, 0xff, 0x20, 0xd4, 0xff, 0x40, 0x40, 
+  0xa8, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x04, 0xff, 0xa0, 0x04, 0x81, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x87, 0xfe, 0xc0, 0xff, 0xff, 0x40, 0xdb, 0xff, 0x80, 0x2c, 0xfe, 0xe0, 0xff, 0xfe, 
+  0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xf4, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xfb, 0x81, 0xfe, 0xc0, 0xff, 0x04, 0xfe, 0xe0, 0xe0, 0xff, 0x60, 0x40, 0xff, 0x20, 
+  0xf7, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x0f, 0xff, 0x40, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xff, 0x20, 0x2b, 0xff, 0x40, 0xd4, 0xff, 0x80, 0x47, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0xb3, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xff, 0x00, 0xf8, 0xfe, 0xc0, 0xff, 0x88, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xe0, 0xfc, 0xff, 0x00, 0xff, 0x81, 0xfe, 0xc0, 0xff, 
+  0x04, 0xff, 0x00, 0x97, 0x00, 0x00, 0x00, 0xff, 0x60, 0x67, 0xff, 0x20, 0xeb, 0xff, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xe0, 0x28, 0xfe, 0xc0, 0xfb, 0xff, 0x00, 0xff, 0xff, 0x40, 
+  0xbc, 0xfe, 0xe0, 0xe3, 0x81, 0xfe, 0xc0, 0xff, 0x8c, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x03, 0xff, 0x00, 0xdc, 0xff, 0x40, 0xe7, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xa2, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x60, 0x30, 0x81, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xc0, 0x20, 0xfe, 0xc0, 0xf4, 0xfe, 0xc0, 0xff, 0x94, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 0x82, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0x60, 0x1c, 0x9e, 0x00, 0x00, 0x00, 0x05, 0xff, 0x20, 0xaf, 0xff, 0x40, 0xff, 0xff, 0x40, 0xb3, 0xff, 0x40, 0x74, 0xfe, 0xe0, 0xf0, 0xfe, 0xc0, 0xff, 0x86, 0xfe, 0xe0, 
+  0xff, 0x86, 0xfe, 0xe1, 0xff, 0x86, 0xfe, 0xe0, 0xff, 0x05, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xe8, 0xff, 0x61, 0x5c, 0xff, 0x40, 0xc3, 0xff, 0x40, 0xff, 0xff, 0x20, 0x40, 0x9e, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0x00, 0x4b, 0x81, 0xfe, 0xc0, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x8a, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xc0, 0xff, 
+  0xfe, 0xc0, 0xef, 0xfe, 0xc0, 0x1c, 0x9b, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x04, 0xff, 0x80, 0x07, 0x81, 0x00, 0x00, 0x00, 0x82, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 
+  0xff, 0x8d, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xd4, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x07, 0xff, 0x60, 0x04, 0x98, 
+  0x00, 0x00, 0x00, 0x04, 0xff, 0x40, 0x3c, 0xff, 0x40, 0xdb, 0xff, 0x60, 0xcf, 0xff, 0x61, 0xc8, 0xfe, 0xe0, 0xfb, 0x83, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xff, 0x01, 0xff, 0x84, 
+  0xff, 0x21, 0xff, 0x85, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xe0, 0xf3, 0xff, 0x60, 0xcb, 0xff, 0x60, 0xcf, 0xff, 0x40, 0xe7, 0xff, 0x60, 0x23, 0x98, 
+  0x00, 0x00, 0x00, 0x01, 0xfe, 0xa0, 0x10, 0xfe, 0xc0, 0xe3, 0x82, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x85, 0xff, 0x01, 0xff, 0x89, 0xff, 0x21, 0xff, 0x84, 0xff, 0x01, 0xff, 0x00, 0xfe, 
+  0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0xbf, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x83, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 
+  0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 0x86, 0xff, 0x21, 0xff, 0x84, 0xff, 0x40, 0xff, 0x82, 0xff, 0x20, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 
+  0xc0, 0xff, 0xfe, 0xc0, 0xfb, 0xfe, 0xc0, 0x33, 0x97, 0x00, 0x00, 0x00, 0x04, 0xff, 0x60, 0x0f, 0xff, 0x60, 0x1c, 0xff, 0x60, 0x2b, 0xff, 0x80, 0x2f, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 
+  0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 0x05, 0xff, 0x40, 0xff, 0xff, 0x21, 0xff, 0xef, 0x08, 0xff, 0xa6, 0x4e, 0xff, 0x5d, 0xb2, 0xff, 0x05, 0x36, 0xff, 0x81, 
+  0x04, 0xf9, 0xff, 0x03, 0x05, 0x36, 0xff, 0x5d, 0xb2, 0xff, 0xa6, 0x2e, 0xff, 0xee, 0xe8, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xe0, 0xe0, 
+  0xff, 0x61, 0x38, 0xff, 0x60, 0x27, 0xff, 0x60, 0x1b, 0xff, 0x60, 0x0b, 0x94, 0x00, 0x00, 0x00, 0x04, 0xff, 0x20, 0x40, 0xff, 0x00, 0xef, 0xff, 0x00, 0xfb, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 
+  0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x04, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xce, 0xc8, 0xff, 0x6d, 0xb4, 0xff, 0x1c, 0x96, 0xff, 
+  0x81, 0x03, 0xb6, 0xff, 0x83, 0x0b, 0x95, 0xff, 0x81, 0x03, 0xb6, 0xff, 0x04, 0x1c, 0x96, 0xff, 0x6d, 0x94, 0xff, 0xce, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x84, 0xfe, 0xe0, 0xff, 
+  0x02, 0xff, 0x00, 0xf7, 0xff, 0x00, 0xfb, 0xff, 0x60, 0x1c, 0x95, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xb0, 0x82, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x82, 0xff, 
+  0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x81, 0xff, 0x41, 0xff, 0x03, 0xff, 0x42, 0xff, 0x96, 0x2e, 0xff, 0x04, 0x77, 0xff, 0x0b, 0x96, 0xff, 0x89, 0x0b, 0x95, 0xff, 0x02, 0x0b, 0x96, 0xff, 0x04, 
+  0x77, 0xff, 0x96, 0x0e, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0x67, 0x97, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0xcb, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 
+  0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x00, 0xff, 0x41, 0xff, 0x81, 0xff, 0x42, 0xff, 0x01, 0x75, 0xb3, 0xff, 0x03, 0xf6, 0xff, 0x8d, 0x0b, 0x95, 0xff, 0x02, 
+  0x03, 0xf6, 0xff, 0x75, 0x93, 0xff, 0xfe, 0xe0, 0xff, 0x81, 0xff, 0x00, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe0, 0xac, 0x95, 0x00, 0x00, 0x00, 0x04, 0xff, 0x60, 0x08, 0xff, 0x60, 0x20, 
+  0xff, 0x60, 0x63, 0xfe, 0xe0, 0xd0, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x83, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x03, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0x75, 0xf1, 0xff, 0x03, 
+  0xd6, 0xff, 0x8f, 0x0b, 0xb5, 0xff, 0x09, 0x03, 0xd6, 0xff, 0x4d, 0x73, 0xff, 0x5d, 0xb2, 0xff, 0x05, 0x37, 0xff, 0x04, 0xf9, 0xff, 0x05, 0x38, 0xff, 0x2d, 0x75, 0xf0, 0x3d, 0x77, 0xa0, 0x35, 
+  0x98, 0x44, 0x56, 0x15, 0x10, 0x91, 0x00, 0x00, 0x00, 0x04, 0xff, 0xc0, 0x03, 0xff, 0x20, 0xaf, 0xff, 0x00, 0xf7, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x82, 0xff, 0x01, 
+  0xff, 0x82, 0xff, 0x21, 0xff, 0x03, 0xff, 0x41, 0xff, 0xff, 0x40, 0xff, 0xa6, 0x6e, 0xff, 0x03, 0xf6, 0xff, 0x91, 0x0b, 0xb5, 0xff, 0x81, 0x03, 0xd6, 0xff, 0x82, 0x0b, 0xb5, 0xff, 0x04, 0x0b, 
+  0xd6, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0x76, 0xff, 0x2d, 0x18, 0xdc, 0x25, 0xbb, 0x4b, 0x92, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xbc, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 
+  0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x82, 0xff, 0x21, 0xff, 0x02, 0xff, 0x41, 0xff, 0xef, 0x07, 0xff, 0x2c, 0x96, 0xff, 0x9b, 0x0b, 0xb5, 0xff, 0x02, 0x14, 0x97, 0xff, 0x25, 0x39, 0x7c, 0x36, 
+  0x3c, 0x04, 0x91, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0x8c, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 0x02, 0xff, 0x40, 
+  0xff, 0x96, 0x2e, 0xff, 0x03, 0xd6, 0xff, 0x9b, 0x0b, 0xd5, 0xff, 0x03, 0x0b, 0xb5, 0xff, 0x14, 0x37, 0xff, 0x25, 0x39, 0x90, 0x2e, 0x3c, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x03, 
+  0xff, 0x60, 0x3b, 0xff, 0x00, 0xdb, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x01, 0xff, 0x81, 0xff, 0x21, 0xff, 0x82, 0xff, 0x40, 0xff, 0x00, 0x04, 0xb5, 
+  0xff, 0x9e, 0x0b, 0xd5, 0xff, 0x01, 0x14, 0x37, 0xfb, 0x25, 0x59, 0x57, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0x80, 0x1f, 0xff, 0x40, 0xcc, 0xfe, 0xe0, 0xfc, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 
+  0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x81, 0xff, 0x01, 0xff, 0x05, 0xff, 0x20, 0xff, 0xd6, 0xe3, 0xff, 0xa6, 0x6f, 0xff, 0x8e, 0x35, 0xff, 0x6d, 0xd7, 0xff, 0x03, 0xb6, 0xff, 0x9f, 0x0b, 0xd6, 
+  0xff, 0x01, 0x1c, 0xb8, 0xe8, 0x2e, 0x1c, 0x18, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x03, 0xfe, 0xa0, 0x74, 0xfe, 0xc0, 0xe8, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x07, 0xfe, 
+  0xe1, 0xff, 0xff, 0x00, 0xff, 0xee, 0xe6, 0xff, 0x76, 0x11, 0xff, 0x04, 0xd8, 0xff, 0x04, 0x37, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0xd5, 0xff, 0xa1, 0x0b, 0xf6, 0xff, 0x00, 0x25, 0x19, 0x80, 0x8e, 
+  0x00, 0x00, 0x00, 0x02, 0xfe, 0xc0, 0x10, 0xfe, 0xc0, 0x88, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x03, 0xff, 0x00, 0xff, 0xd6, 0xc7, 0xff, 0x35, 0x17, 0xff, 0x04, 0x16, 0xff, 0xa5, 0x0b, 
+  0xf6, 0xff, 0x01, 0x14, 0x77, 0xdb, 0x2d, 0xdc, 0x0c, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0x60, 0x1c, 0xff, 0x00, 0xdb, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x02, 0xee, 0xc6, 0xff, 0x35, 
+  0x16, 0xff, 0x0b, 0xf6, 0xff, 0x97, 0x0c, 0x16, 0xff, 0x01, 0x14, 0x16, 0xff, 0x14, 0x36, 0xff, 0x82, 0x14, 0x57, 0xff, 0x00, 0x14, 0x36, 0xff, 0x88, 0x0c, 0x16, 0xff, 0x01, 0x14, 0x36, 0xef, 
+  0x25, 0x39, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x34, 0xff, 0x20, 0xf0, 0x81, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x02, 0xff, 0x00, 0xff, 0x75, 0xd0, 0xff, 0x04, 0x16, 0xff, 
+  0x96, 0x0c, 0x16, 0xff, 0x07, 0x14, 0x36, 0xff, 0x1c, 0xd8, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x57, 0xff, 0x14, 0x37, 0xff, 0x14, 0x16, 0xff, 0x14, 0x37, 0xff, 0x14, 0x77, 0xff, 0x81, 0x1c, 0xd8, 
+  0xff, 0x00, 0x14, 0x36, 0xff, 0x85, 0x0c, 0x16, 0xff, 0x01, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x8b, 0x00, 0x00, 0x00, 0x03, 0xff, 0x60, 0x04, 0xff, 0x20, 0x8f, 0xfe, 0xa0, 0xdb, 0xfe, 0xc0, 
+  0xf7, 0x81, 0xfe, 0xc0, 0xff, 0x02, 0xfe, 0xe0, 0xff, 0xd6, 0xc3, 0xff, 0x04, 0x77, 0xff, 0x95, 0x0c, 0x16, 0xff, 0x03, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xb8, 0xff, 0x13, 0xf6, 0xff, 
+  0x85, 0x0b, 0x95, 0xff, 0x04, 0x0b, 0x75, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x97, 0xff, 0x0c, 0x36, 0xff, 0x83, 0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x33, 0x8d, 
+  0x00, 0x00, 0x00, 0x06, 0xfe, 0xa0, 0x07, 0xfe, 0xc0, 0x20, 0xfe, 0xc0, 0x98, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xa6, 0x0d, 0xff, 0x04, 0x16, 0xff, 0x95, 0x0c, 0x36, 0xff, 0x01, 0x1c, 0xd8, 
+  0xff, 0x14, 0x17, 0xff, 0x8a, 0x0b, 0x95, 0xff, 0x01, 0x14, 0x37, 0xff, 0x1c, 0xb8, 0xff, 0x81, 0x0c, 0x36, 0xff, 0x00, 0x14, 0x36, 0xff, 0x81, 0x0c, 0x36, 0xff, 0x00, 0x0b, 0xf5, 0x28, 0x8e, 
+  0x00, 0x00, 0x00, 0x04, 0xff, 0x60, 0x1f, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0x85, 0x72, 0xff, 0x95, 0x0c, 0x36, 0xff, 0x02, 0x14, 0x97, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 
+  0xff, 0x8a, 0x0b, 0xb5, 0xff, 0x01, 0x0b, 0x95, 0xff, 0x14, 0x16, 0xff, 0x84, 0x1c, 0xf9, 0xff, 0x02, 0x1d, 0x19, 0xa3, 0x25, 0x5a, 0x37, 0x2d, 0xdb, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0x80, 0x0c, 0xff, 0x00, 0xd8, 0x81, 0xfe, 0xc0, 0xff, 0x02, 0xfe, 0xe0, 0xff, 0x85, 0x14, 0xff, 0x0c, 0x36, 0xff, 0x92, 0x0c, 0x56, 0xff, 0x02, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xff, 0x14, 0x57, 
+  0xff, 0x8e, 0x0b, 0xb5, 0xff, 0x00, 0x0b, 0xd6, 0xff, 0x82, 0x0b, 0xb5, 0xff, 0x04, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x77, 0xf7, 0x25, 0x5a, 0xa7, 0x25, 0xda, 0x10, 0x8a, 0x00, 0x00, 
+  0x00, 0x06, 0xff, 0x40, 0x5f, 0xfe, 0xc0, 0xd8, 0xfe, 0xc0, 0xdf, 0xfe, 0xc0, 0xe8, 0xfe, 0xe0, 0xff, 0x8d, 0x70, 0xff, 0x04, 0x56, 0xff, 0x92, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xff, 0x1c, 
+  0x97, 0xff, 0x96, 0x0b, 0xb5, 0xff, 0x02, 0x13, 0xf6, 0xff, 0x24, 0xf9, 0xc7, 0x25, 0x7a, 0x17, 0x8a, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x80, 0x03, 0xfe, 0xc0, 0x0c, 0xfe, 0xe0, 0x37, 0xfe, 0xc0, 
+  0xff, 0xae, 0x0a, 0xff, 0x04, 0x37, 0xff, 0x90, 0x14, 0x56, 0xff, 0x81, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x76, 0xff, 0x14, 0x16, 0xff, 0x97, 0x0b, 0xd5, 0xff, 0x01, 0x0b, 0xf6, 0xff, 0x25, 0x19, 
+  0xac, 0x8c, 0x00, 0x00, 0x00, 0x04, 0xff, 0x20, 0xb0, 0xfe, 0xc0, 0xff, 0xee, 0xa0, 0xff, 0x04, 0x75, 0xff, 0x0c, 0x76, 0xff, 0x8e, 0x14, 0x76, 0xff, 0x04, 0x14, 0xb7, 0xff, 0x1c, 0xf8, 0xff, 
+  0x1d, 0x19, 0xff, 0x1c, 0xf8, 0xff, 0x0b, 0xf6, 0xff, 0x98, 0x0b, 0xd6, 0xff, 0x01, 0x14, 0x36, 0xff, 0x25, 0x7a, 0x5c, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x1f, 0xfe, 0xe0, 0xf7, 0x81, 
+  0xfe, 0xc0, 0xff, 0x01, 0xa5, 0xec, 0xff, 0x04, 0x76, 0xff, 0x8c, 0x14, 0x76, 0xff, 0x04, 0x0c, 0x76, 0xff, 0x1d, 0x19, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x9a, 0x0b, 
+  0xf6, 0xff, 0x02, 0x0b, 0xd6, 0xff, 0x14, 0x97, 0xcc, 0x2e, 0x1c, 0x08, 0x89, 0x00, 0x00, 0x00, 0x06, 0xff, 0x20, 0x40, 0xfe, 0xc0, 0x8f, 0xfe, 0xc0, 0x73, 0xfe, 0xc0, 0x57, 0xfe, 0xc0, 0xe4, 
+  0x65, 0x12, 0xff, 0x04, 0x77, 0xff, 0x8a, 0x14, 0x76, 0xff, 0x02, 0x14, 0x77, 0xff, 0x1d, 0x19, 0xff, 0x14, 0x57, 0xff, 0x9e, 0x0b, 0xf6, 0xff, 0x01, 0x14, 0x36, 0xef, 0x25, 0x39, 0x1c, 0x8c, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0c, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0x65, 0x4f, 0xff, 0x04, 0x77, 0xff, 0x89, 0x14, 0x76, 0xff, 0x01, 0x14, 0xd7, 0xff, 0x14, 0x56, 0xff, 0x9f, 0x0c, 0x16, 
+  0xff, 0x01, 0x14, 0x36, 0xfc, 0x14, 0x97, 0x2b, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x67, 0x81, 0xfe, 0xc0, 0xff, 0x04, 0xfe, 0xc0, 0xf7, 0xae, 0x09, 0xff, 0x5c, 0xf4, 0xff, 0x1c, 0xb5, 
+  0xff, 0x04, 0x96, 0xff, 0x86, 0x04, 0x77, 0xff, 0x00, 0x1c, 0xd8, 0xff, 0xa0, 0x0c, 0x16, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x56, 0x30, 0x8c, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xe0, 0xb8, 0xfe, 
+  0xc0, 0xa4, 0xfe, 0xc0, 0x4c, 0xfe, 0xc0, 0x3f, 0xfe, 0xe0, 0xf3, 0xf6, 0xa0, 0xff, 0xee, 0x86, 0xff, 0xee, 0x89, 0xff, 0xee, 0x6b, 0xff, 0x84, 0xee, 0x8b, 0xff, 0x01, 0xee, 0xa9, 0xff, 0x04, 
+  0x57, 0xff, 0xa0, 0x0c, 0x36, 0xff, 0x01, 0x0c, 0x36, 0xfc, 0x14, 0x56, 0x2b, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x24, 0xfe, 0xc0, 0xf7, 0x82, 0xfe, 0xc0, 0xff, 0x85, 0xfe, 0xe0, 0xff, 
+  0x01, 0xff, 0x00, 0xff, 0x03, 0xf7, 0xff, 0xa0, 0x0c, 0x36, 0xff, 0x01, 0x14, 0x56, 0xef, 0x14, 0xb7, 0x1c, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xe0, 0x2b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf8, 
+  0xfe, 0xc0, 0x54, 0xfe, 0xc0, 0xd4, 0x83, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x01, 0xff, 0x00, 0xff, 0x04, 0x17, 0xff, 0xa0, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xcf, 0x25, 0x79, 0x08, 
+  0x8f, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xe0, 0x27, 0xfe, 0xc0, 0x87, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0xa4, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xc0, 0xe0, 0xf6, 0xa5, 0xff, 0x81, 0xfe, 
+  0xc0, 0xff, 0x01, 0xfe, 0xe0, 0xff, 0x04, 0xb3, 0xff, 0xa0, 0x0c, 0x56, 0xff, 0x00, 0x14, 0x97, 0x5f, 0x94, 0x00, 0x00, 0x00, 0x09, 0xfe, 0xe0, 0x7b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x83, 0x8e, 
+  0x17, 0x43, 0x75, 0x34, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xfc, 0xfe, 0xe0, 0xb3, 0xa5, 0xcd, 0xff, 0x04, 0x56, 0xff, 0x9e, 0x14, 0x76, 0xff, 0x00, 0x14, 0x77, 0xaf, 0x95, 0x00, 0x00, 0x00, 
+  0x0a, 0xfe, 0xe0, 0x47, 0xfe, 0xc0, 0x53, 0x00, 0x00, 0x00, 0x1c, 0x98, 0xcf, 0x03, 0xd5, 0xff, 0xde, 0x6a, 0xff, 0xfe, 0xc0, 0x8b, 0x00, 0x00, 0x00, 0xee, 0xa4, 0xe4, 0x4c, 0xd4, 0xff, 0x0c, 
+  0x77, 0xff, 0x9c, 0x14, 0x76, 0xff, 0x01, 0x14, 0x77, 0xcf, 0x1d, 0x17, 0x18, 0x97, 0x00, 0x00, 0x00, 0x03, 0x24, 0xf8, 0x2b, 0x14, 0x16, 0xfc, 0x03, 0xd6, 0xff, 0x55, 0x35, 0xef, 0x81, 0x00, 
+  0x00, 0x00, 0x02, 0xfe, 0xe0, 0x3f, 0xe6, 0x83, 0xff, 0x04, 0x57, 0xcf, 0x9b, 0x14, 0x76, 0xff, 0x01, 0x14, 0x77, 0x9c, 0x1c, 0xf7, 0x13, 0x98, 0x00, 0x00, 0x00, 0x0b, 0x25, 0x19, 0xa4, 0x0b, 
+  0xf6, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x2d, 0xfb, 0x37, 0x00, 0x00, 0x00, 0xff, 0x00, 0x07, 0xfe, 0xc0, 0x48, 0x00, 0x1f, 0x04, 0x14, 0x97, 0x90, 0x0c, 0x97, 0xe4, 0x14, 0x97, 0xf8, 
+  0x94, 0x14, 0x97, 0xff, 0x03, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xec, 0x14, 0x97, 0xbc, 0x14, 0x97, 0x47, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0xff, 0x81, 0x0c, 0x36, 0xff, 0x01, 0x0c, 0x16, 
+  0xff, 0x1c, 0xf8, 0x98, 0x83, 0x00, 0x00, 0x00, 0x02, 0x25, 0x3a, 0x03, 0x14, 0x97, 0x18, 0x14, 0x97, 0x28, 0x89, 0x14, 0x97, 0x2f, 0x81, 0x0c, 0x76, 0x2c, 0x88, 0x14, 0x97, 0x2f, 0x02, 0x14, 
+  0x97, 0x28, 0x14, 0x77, 0x1c, 0x14, 0xd7, 0x0b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0xdc, 0x82, 0x0c, 0x56, 0xff, 0x00, 0x14, 0xb7, 0x70, 0x90, 0x00, 0x00, 0x00, 0x01, 0x25, 0x3a, 0x3b, 
+  0x25, 0x3a, 0x2f, 0xa7, 0x00, 0x00, 0x00, 0x03, 0x14, 0x97, 0x23, 0x14, 0x76, 0xd3, 0x14, 0x76, 0xff, 0x14, 0x77, 0x87, 0x89, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7b, 0x57, 0x86, 0x00, 0x00, 0x00, 
+  0x01, 0x1c, 0x98, 0xec, 0x1c, 0xd8, 0xcf, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x25, 0x5a, 0x64, 0x14, 0x57, 0xf0, 0x25, 0xbb, 0x0c, 0x84, 0x00, 0x00, 0x00, 0x03, 0x25, 0x5a, 0x73, 0x0b, 0xb5, 0xff, 
+  0x0b, 0xf6, 0xff, 0x25, 0x9a, 0x4c, 0xb2, 0x00, 0x00, 0x00, 0x03, 0x2d, 0xfc, 0x0f, 0x14, 0x37, 0xe0, 0x0b, 0xd6, 0xff, 0x24, 0xf9, 0x63, 0x83, 0x00, 0x00, 0x00, 0x01, 0x36, 0x3c, 0x0c, 0x14, 
+  0x77, 0xdc, 0x81, 0x0b, 0xf6, 0xff, 0x01, 0x1c, 0x97, 0xcf, 0x3e, 0xfe, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7b, 0x58, 0xab, 0x00, 0x00, 0x00, 0x03, 0x1c, 0xf8, 0x48, 0x14, 0x16, 0xff, 
+  0x0b, 0xd6, 0xff, 0x1c, 0xb8, 0xf3, 0x83, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x18, 0x2b, 0x14, 0x56, 0xfb, 0x81, 0x0c, 0x16, 0xff, 0x01, 0x14, 0x56, 0xf3, 0x25, 0x59, 0x20, 0x83, 0x00, 0x00, 0x00, 
+  0x02, 0x25, 0x5a, 0x18, 0x14, 0x57, 0xfc, 0x25, 0x9a, 0x3f, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0xcc, 0x82, 0x0c, 0x16, 0xff, 0x00, 0x25, 0x9a, 0x60, 0x82, 0x00, 0x00, 0x00, 0x00, 0x14, 
+  0x76, 0x30, 0x82, 0x0c, 0x56, 0xff, 0x01, 0x14, 0x56, 0xf7, 0x14, 0xb7, 0x27, 0x83, 0x00, 0x00, 0x00, 0x03, 0x24, 0xf9, 0x84, 0x0b, 0xb5, 0xff, 0x14, 0x77, 0xd3, 0x36, 0x7d, 0x07, 0xa9, 0x00, 
+  0x00, 0x00, 0x00, 0x14, 0x77, 0xff, 0x82, 0x0c, 0x36, 0xff, 0x00, 0x1c, 0xd8, 0xa0, 0x82, 0x00, 0x00, 0x00, 0x05, 0x1c, 0xd8, 0x08, 0x14, 0x76, 0xbc, 0x14, 0x76, 0xff, 0x14, 0x76, 0xfc, 0x14, 
+  0x76, 0xaf, 0x36, 0x1b, 0x03, 0x82, 0x00, 0x00, 0x00, 0x04, 0x47, 0xbf, 0x07, 0x14, 0x77, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x16, 0xfc, 0x25, 0x19, 0x34, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 
+  0x9c, 0x82, 0x14, 0x56, 0xff, 0x00, 0x1c, 0xf8, 0x33, 0x83, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x76, 0x08, 0x14, 0x76, 0x2c, 0x14, 0x77, 0x2b, 0x0c, 0x97, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x25, 
+  0x59, 0x87, 0x0b, 0xf6, 0xff, 0x81, 0x0c, 0x16, 0xff, 0x00, 0x25, 0x19, 0xa7, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x04, 0x55, 0x04, 0x14, 0x76, 0x8b, 0x14, 0x76, 0xc3, 0x0c, 0x97, 0x3c, 0x8c, 0x00, 
+  0x00, 0x00, 0x00, 0x14, 0x97, 0xc4, 0x82, 0x0c, 0x36, 0xff, 0x00, 0x14, 0x97, 0xe7, 0xba, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x53, 0x82, 0x14, 0x56, 0xff, 0x00, 0x14, 0x97, 0x7b, 0xbb, 0x00, 
+  0x00, 0x00, 0x03, 0x14, 0x76, 0x53, 0x14, 0x76, 0xc7, 0x14, 0x77, 0x7b, 0x03, 0xf6, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x03, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0xae, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xee, 0xff, 0x10, 0x00, 0xf4, 0xff, 0x0b, 0x00, 0xe4, 0xfc, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xed, 0xff, 0x10, 0x00, 0xea, 0xfe, 0x94, 0x00, 0xea, 0xfe, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x43, 0x00, 0xe5, 0xff, 0x00, 0x00, 0xca, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xeb, 0xfe, 0x08, 0x00, 0xf7, 0xf9, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xe5, 0xfe, 0x54, 0x00, 0xe6, 0xfd, 0xd7, 0x0e, 0xfd, 0xff, 0x04, 0x03, 0xeb, 0xfe, 0x00, 0x02, 0xe6, 0xfe, 0x63, 0x00, 0xdd, 0xfe, 0xff, 0x01, 0xee, 0xff, 0x40, 0x03, 0xeb, 0xff, 0x00, 0x02, 0xec, 0xff, 0x24, 0x00, 0xe2, 0xfe, 0xff, 0x00, 0xec, 0xfe, 0x34, 0x00, 0xe9, 0xfe, 0x00, 0x00, 0xee, 0xfe, 0x00, 0x00, 0xee, 0xff, 0x0b, 0x00, 0xef, 0xff, 0x08, 0x00, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xe5, 0xfe, 0x5b, 0x00, 0xe9, 0xfe, 0xb0, 0x06, 0xf1, 0xfc, 0x00, 0x02, 0xe7, 0xfe, 0x00, 0x02, 0xe2, 0xfe, 0xc4, 0x01, 0xd9, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xc3, 0x05, 0xf4, 0xff, 0x17, 0x02, 0xdf, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xd7, 0x08, 0xf7, 0xff, 0x17, 0x03, 0xe4, 0xfe, 0xeb, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe2, 0xfe, 0xac, 0x01, 0xe4, 0xfe, 0x00, 0x00, 0xf8, 0xfc, 0x0c, 0x00, 0xe6, 0xfe, 0xd4, 0x00, 0xe8, 0xff, 0x40, 0x00, 0xe7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x04, 0x00, 0xf6, 0xff, 0x04, 0x00, 0xed, 0xfd, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xe1, 0xff, 0x87, 0x01, 0xda, 0xfe, 0xff, 0x04, 0xe8, 0xfe, 0xdb, 0x04, 0xf1, 0xff, 0x2c, 0x02, 0xdc, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xf4, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xfb, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xe0, 0x03, 0xee, 0xff, 0x40, 0x03, 0xe6, 0xfe, 0xf7, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xe4, 0xfd, 0x6c, 0x00, 0xe2, 0xfd, 0x00, 0x03, 0xed, 0xff, 0x00, 0x00, 0xef, 0xff, 0x0f, 0x00, 0xe9, 0xff, 0x03, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xfe, 0x2b, 0x00, 0xea, 0xfe, 0xd4, 0x00, 0xef, 0xfd, 0x47, 0x04, 0xe6, 0xfd, 0x00, 0x02, 0xe0, 0xfd, 0xb3, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x04, 0xe1, 0xfe, 0xf8, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xfc, 0x03, 0xdf, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0x97, 0x05, 0xeb, 0xfe, 0x00, 0x04, 0xed, 0xff, 0x67, 0x00, 0xe6, 0xfe, 0xeb, 0x00, 0xe2, 0xff, 0x03, 0x00, 0xe5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x01, 0xdb, 0xfe, 0x28, 0x00, 0xd8, 0xfe, 0xfb, 0x02, 0xe2, 0xfe, 0xff, 0x03, 0xe9, 0xfd, 0xbc, 0x03, 0xde, 0xfe, 0xe3, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdf, 0xfe, 0xdc, 0x04, 0xe8, 0xfe, 0xe7, 0x02, 0xdf, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xd2, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xfe, 0x00, 0x00, 0xee, 0xff, 0x30, 0x00, 0xe7, 0xfd, 0x00, 0x03, 0xeb, 0xfd, 0x00, 0x01, 0xda, 0xfe, 0x20, 0x01, 0xd9, 0xfe, 0xf4, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf8, 0x02, 0xdd, 0xfe, 0x00, 0x04, 0xeb, 0xfe, 0x00, 0x00, 0xd2, 0xfa, 0x00, 0x00, 0xed, 0xff, 0x1c, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xfe, 0x00, 0x00, 0xe3, 0xfe, 0xaf, 0x00, 0xe7, 0xfe, 0xff, 0x03, 0xe8, 0xfd, 0xb3, 0x03, 0xe7, 0xfe, 0x74, 0x01, 0xdb, 0xfe, 0xf0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xe8, 0x07, 0xeb, 0xff, 0x5c, 0x04, 0xe8, 0xfe, 0xc3, 0x00, 0xe7, 0xfe, 0xff, 0x00, 0xe3, 0xfe, 0x40, 0x00, 0xe2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfe, 0x00, 0x00, 0xdf, 0xfe, 0x4b, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdd, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xef, 0x01, 0xd9, 0xfd, 0x1c, 0x00, 0xe3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xee, 0xff, 0x04, 0x00, 0xef, 0xff, 0x07, 0x01, 0xe4, 0xfd, 0x00, 0x03, 0xd4, 0xfd, 0x00, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xd4, 0x2a, 0xff, 0xff, 0x00, 0x0a, 0xed, 0xfc, 0x00, 0x00, 0xef, 0xff, 0x07, 0x00, 0xec, 0xff, 0x04, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xea, 0xfe, 0x3c, 0x00, 0xe8, 0xfe, 0xdb, 0x01, 0xec, 0xfe, 0xcf, 0x05, 0xee, 0xfe, 0xc8, 0x02, 0xdb, 0xfe, 0xfb, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xf3, 0x04, 0xed, 0xfe, 0xcb, 0x03, 0xeb, 0xfe, 0xcf, 0x00, 0xe8, 0xfe, 0xe7, 0x00, 0xeb, 0xff, 0x23, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xd6, 0xfc, 0x10, 0x00, 0xd7, 0xfe, 0xe3, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xd7, 0xfe, 0xbf, 0x00, 0xdc, 0xfe, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd6, 0xfd, 0x00, 0x02, 0xda, 0xfd, 0x83, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xfb, 0x01, 0xda, 0xfe, 0x33, 0x00, 0xe2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xeb, 0xfe, 0x0f, 0x00, 0xee, 0xfd, 0x1c, 0x01, 0xed, 0xfe, 0x2b, 0x04, 0xf0, 0xff, 0x2f, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x07, 0xe6, 0xf5, 0xff, 0x43, 0xe1, 0xe7, 0xff, 0x74, 0xc8, 0xa0, 0xff, 0x92, 0xb4, 0x58, 0xff, 0xb3, 0xa5, 0x00, 0xff, 0xc9, 0x9b, 0x00, 0xff, 0xc9, 0x9b, 0x00, 0xff, 0xb3, 0xa5, 0x00, 0xff, 0x92, 0xb4, 0x59, 0xff, 0x73, 0xc5, 0xa1, 0xff, 0x42, 0xdc, 0xe8, 0xff, 0x01, 0xe0, 0xf6, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xe0, 0x05, 0xec, 0xfe, 0x38, 0x03, 0xed, 0xfe, 0x27, 0x00, 0xec, 0xfd, 0x1b, 0x00, 0xee, 0xff, 0x0b, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe6, 0xfe, 0x40, 0x00, 0xe2, 0xfe, 0xef, 0x02, 0xdf, 0xfe, 0xfb, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x00, 0xe9, 0xfe, 0xff, 0x3d, 0xda, 0xc6, 0xff, 0xa2, 0xb4, 0x68, 0xff, 0xb2, 0x90, 0x1b, 0xff, 0xb1, 0x76, 0x00, 0xff, 0xad, 0x73, 0x00, 0xff, 0xab, 0x70, 0x05, 0xff, 0xa9, 0x6f, 0x08, 0xff, 0xa9, 0x6f, 0x08, 0xff, 0xaa, 0x70, 0x05, 0xff, 0xae, 0x73, 0x00, 0xff, 0xb1, 0x76, 0x00, 0xff, 0xb2, 0x90, 0x1b, 0xff, 0xa1, 0xb2, 0x69, 0xff, 0x39, 0xd4, 0xc7, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xf7, 0x00, 0xe2, 0xfe, 0xfb, 0x00, 0xec, 0xff, 0x1c, 0x00, 0xe9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xff, 0xae, 0x00, 0x00, 0xd7, 0xfe, 0xb0, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x09, 0xe8, 0xfd, 0xff, 0x0d, 0xe7, 0xf6, 0xff, 0x74, 0xc6, 0x93, 0xff, 0xbb, 0x8e, 0x00, 0xff, 0xad, 0x72, 0x05, 0xff, 0xa8, 0x70, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa8, 0x70, 0x09, 0xff, 0xad, 0x72, 0x05, 0xff, 0xba, 0x8e, 0x00, 0xff, 0x72, 0xc2, 0x93, 0xff, 0x04, 0xde, 0xf7, 0xff, 0x03, 0xde, 0xfe, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xff, 0x67, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x0d, 0xf9, 0xf5, 0x00, 0x02, 0xd9, 0xfd, 0xcb, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 0xf6, 0xff, 0x9a, 0xb4, 0x6f, 0xff, 0xb1, 0x7e, 0x00, 0xff, 0xaa, 0x71, 0x07, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x07, 0xff, 0xb0, 0x7e, 0x00, 0xff, 0x98, 0xb2, 0x6f, 0xff, 0x00, 0xde, 0xf8, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xac, 0xba, 0xb2, 0x1f, 0x00, 0xdd, 0xa5, 0x00, 0x00, 0xcf, 0xac, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xe5, 0xff, 0x00, 0x00, 0xee, 0xff, 0x08, 0x00, 0xee, 0xfd, 0x20, 0x03, 0xeb, 0xff, 0x63, 0x01, 0xde, 0xfe, 0xd0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x00, 0xe9, 0xfa, 0xff, 0x86, 0xbb, 0x73, 0xff, 0xaf, 0x77, 0x00, 0xff, 0xa9, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xa9, 0x73, 0x09, 0xff, 0xaf, 0x78, 0x00, 0xff, 0x9c, 0xad, 0x47, 0xff, 0x93, 0xb3, 0x56, 0xff, 0xb7, 0xa6, 0x00, 0xff, 0xcc, 0x9e, 0x00, 0xff, 0xc0, 0xa3, 0x00, 0xff, 0xac, 0xab, 0x25, 0xf0, 0xbb, 0xab, 0x35, 0xa0, 0xc0, 0xb0, 0x34, 0x44, 0xa7, 0xc1, 0x4e, 0x10, 0xcb, 0xb1, 0x2a, 0x00, 0xd3, 0xab, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xf8, 0xff, 0x03, 0x00, 0xe6, 0xfe, 0xaf, 0x00, 0xe0, 0xfe, 0xf7, 0x01, 0xdc, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x00, 0xe8, 0xfb, 0xff, 0x6d, 0xcb, 0x9e, 0xff, 0xb2, 0x7d, 0x00, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xae, 0x77, 0x00, 0xff, 0xaf, 0x78, 0x00, 0xff, 0xac, 0x75, 0x06, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xab, 0x74, 0x07, 0xff, 0xad, 0x77, 0x06, 0xff, 0xb0, 0x7b, 0x0a, 0xff, 0xb3, 0x8b, 0x1c, 0xff, 0xc0, 0xa2, 0x25, 0xdc, 0xd8, 0xb4, 0x21, 0x4b, 0xcc, 0xa9, 0x1f, 0x00, 0xd1, 0xab, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xe8, 0xff, 0x00, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0xd7, 0xfe, 0xbc, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe8, 0xfc, 0xff, 0x35, 0xe2, 0xe5, 0xff, 0xae, 0x90, 0x2b, 0xff, 0xaa, 0x75, 0x0a, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xab, 0x76, 0x09, 0xff, 0xaa, 0x75, 0x09, 0xff, 0xab, 0x75, 0x08, 0xff, 0xbc, 0x8f, 0x14, 0xff, 0xcc, 0xa6, 0x1d, 0x7c, 0xe1, 0xc3, 0x32, 0x04, 0xd3, 0xb1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xdf, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xce, 0xff, 0x00, 0x02, 0xd8, 0xfd, 0x8c, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x00, 0xe9, 0xff, 0xff, 0x74, 0xc3, 0x8f, 0xff, 0xae, 0x77, 0x00, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x76, 0x0a, 0xff, 0xb5, 0x84, 0x10, 0xff, 0xcc, 0xa5, 0x1f, 0x90, 0xdf, 0xc5, 0x28, 0x04, 0xd2, 0xac, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xee, 0xfe, 0x00, 0x00, 0xf9, 0xff, 0x03, 0x01, 0xec, 0xfe, 0x3b, 0x02, 0xe1, 0xfe, 0xdb, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x05, 0xe5, 0xfe, 0xff, 0x00, 0xe7, 0xfe, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xf9, 0xff, 0xa6, 0x94, 0x00, 0xff, 0xac, 0x77, 0x06, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xab, 0x77, 0x09, 0xff, 0xb5, 0x86, 0x10, 0xfb, 0xcc, 0xa7, 0x20, 0x57, 0xd2, 0xad, 0x24, 0x00, 0xd3, 0xaf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xef, 0xfd, 0x1f, 0x00, 0xe9, 0xfe, 0xcc, 0x00, 0xde, 0xfe, 0xfc, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe1, 0xfe, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x1a, 0xdc, 0xd3, 0xff, 0x77, 0xce, 0x9f, 0xff, 0xaa, 0xc5, 0x87, 0xff, 0xb7, 0xb8, 0x6b, 0xff, 0xaf, 0x76, 0x00, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xbe, 0x93, 0x16, 0xe8, 0xe0, 0xbf, 0x2b, 0x18, 0xd5, 0xb2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xe0, 0xff, 0x03, 0x00, 0xd6, 0xfe, 0x74, 0x00, 0xd8, 0xfe, 0xe8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xde, 0xfd, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x32, 0xdb, 0xe5, 0xff, 0x87, 0xc0, 0x74, 0xff, 0xc4, 0x98, 0x00, 0xff, 0xbb, 0x86, 0x00, 0xff, 0xb0, 0x7b, 0x03, 0xff, 0xac, 0x78, 0x08, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xc9, 0xa2, 0x1e, 0x80, 0xbb, 0x8f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xe8, 0xff, 0x00, 0x00, 0xd9, 0xfe, 0x00, 0x00, 0xd8, 0xff, 0x10, 0x02, 0xd8, 0xfd, 0x88, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x38, 0xd8, 0xcd, 0xff, 0xb7, 0xa2, 0x32, 0xff, 0xb3, 0x82, 0x00, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xb8, 0x8c, 0x13, 0xdb, 0xdd, 0xba, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x03, 0xee, 0xff, 0x1c, 0x02, 0xe1, 0xfe, 0xdb, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdd, 0xfe, 0xff, 0x30, 0xd9, 0xe5, 0xff, 0xb4, 0xa0, 0x31, 0xff, 0xad, 0x7c, 0x0c, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xb1, 0x82, 0x0d, 0xff, 0xb3, 0x86, 0x0f, 0xff, 0xb5, 0x89, 0x11, 0xff, 0xb6, 0x89, 0x11, 0xff, 0xb5, 0x88, 0x10, 0xff, 0xb3, 0x86, 0x0f, 0xff, 0xb0, 0x82, 0x0c, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xb1, 0x84, 0x0e, 0xef, 0xc6, 0xa3, 0x1d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xec, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x34, 0x00, 0xe4, 0xfe, 0xf0, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x81, 0xba, 0x72, 0xff, 0xb1, 0x82, 0x00, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xae, 0x80, 0x0a, 0xff, 0xb3, 0x86, 0x0e, 0xff, 0xc2, 0x98, 0x18, 0xff, 0xc3, 0x96, 0x17, 0xff, 0xbb, 0x8a, 0x14, 0xff, 0xb5, 0x83, 0x12, 0xff, 0xb4, 0x81, 0x11, 0xff, 0xb6, 0x84, 0x11, 0xff, 0xbb, 0x8b, 0x13, 0xff, 0xc3, 0x97, 0x19, 0xff, 0xc2, 0x97, 0x17, 0xff, 0xb2, 0x85, 0x0d, 0xff, 0xae, 0x80, 0x0a, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xb1, 0x84, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xec, 0xff, 0x04, 0x00, 0xe4, 0xfe, 0x8f, 0x00, 0xd6, 0xfe, 0xdb, 0x01, 0xd9, 0xfe, 0xf7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdc, 0xfe, 0xff, 0x1a, 0xd7, 0xd4, 0xff, 0xba, 0x8b, 0x00, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0xbb, 0x8f, 0x13, 0xff, 0xc2, 0x96, 0x18, 0xff, 0xb2, 0x7c, 0x0e, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa8, 0x70, 0x08, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa7, 0x6d, 0x07, 0xff, 0xb2, 0x7e, 0x0f, 0xff, 0xc3, 0x96, 0x18, 0xff, 0xbb, 0x90, 0x12, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0xb3, 0x87, 0x0e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xec, 0xff, 0x00, 0x00, 0xe2, 0xfe, 0x00, 0x00, 0xd5, 0xff, 0x07, 0x01, 0xd9, 0xfe, 0x20, 0x00, 0xd8, 0xfe, 0x98, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x6c, 0xc2, 0x9d, 0xff, 0xb3, 0x7f, 0x00, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xc1, 0x97, 0x16, 0xff, 0xb5, 0x82, 0x10, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xb5, 0x83, 0x11, 0xff, 0xc0, 0x96, 0x16, 0xff, 0xaf, 0x83, 0x0a, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x86, 0x0d, 0xff, 0xb2, 0x85, 0x0c, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0xab, 0x7c, 0x08, 0x28, 0xce, 0xa6, 0x20, 0x00, 0xcf, 0xa7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xfe, 0x00, 0x00, 0xee, 0xff, 0x1f, 0x02, 0xe0, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x94, 0xac, 0x82, 0xff, 0xb2, 0x83, 0x06, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xbc, 0x92, 0x13, 0xff, 0xb2, 0x7e, 0x0e, 0xff, 0xa9, 0x72, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xa9, 0x72, 0x08, 0xff, 0xb4, 0x81, 0x0f, 0xff, 0xc6, 0x9d, 0x19, 0xff, 0xc6, 0x9c, 0x1a, 0xff, 0xc7, 0x9d, 0x1b, 0xff, 0xc6, 0x9d, 0x1a, 0xff, 0xc5, 0x9d, 0x1a, 0xff, 0xca, 0xa2, 0x1c, 0xa3, 0xd0, 0xaa, 0x20, 0x37, 0xda, 0xba, 0x29, 0x04, 0xd1, 0xb0, 0x22, 0x00, 0xd0, 0xaf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xf1, 0xfc, 0x0c, 0x00, 0xe1, 0xfe, 0xd8, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x9d, 0xa1, 0x7d, 0xff, 0xb2, 0x86, 0x0b, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xbb, 0x92, 0x11, 0xff, 0xb7, 0x87, 0x10, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 0xba, 0x8c, 0x13, 0xf7, 0xce, 0xa8, 0x1d, 0xa7, 0xd4, 0xba, 0x24, 0x10, 0xd1, 0xb1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x5f, 0x00, 0xd9, 0xfe, 0xd8, 0x00, 0xd8, 0xfe, 0xdf, 0x01, 0xd9, 0xfe, 0xe8, 0x00, 0xdb, 0xff, 0xff, 0x81, 0xab, 0x86, 0xff, 0xb4, 0x87, 0x03, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xbc, 0x90, 0x15, 0xff, 0xa9, 0x74, 0x09, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xaa, 0x75, 0x09, 0xff, 0xb1, 0x7e, 0x0e, 0xff, 0xc8, 0x9d, 0x1d, 0xc7, 0xd1, 0xae, 0x24, 0x17, 0xd4, 0xae, 0x28, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xd0, 0xff, 0x03, 0x00, 0xd7, 0xff, 0x0c, 0x03, 0xdd, 0xff, 0x37, 0x00, 0xda, 0xff, 0xff, 0x4f, 0xc2, 0xa9, 0xff, 0xb7, 0x85, 0x00, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb1, 0x88, 0x0b, 0xff, 0xb4, 0x8b, 0x0e, 0xff, 0xb1, 0x80, 0x0e, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x78, 0x0a, 0xff, 0xaf, 0x7d, 0x0c, 0xff, 0xc6, 0xa2, 0x1d, 0xac, 0xc4, 0xac, 0x12, 0x00, 0xdd, 0xa3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd8, 0xfd, 0x00, 0x02, 0xe5, 0xfe, 0xb0, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd6, 0xe9, 0xff, 0xa7, 0x8e, 0x00, 0xff, 0xb4, 0x8b, 0x0b, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb9, 0x93, 0x12, 0xff, 0xc1, 0x9b, 0x17, 0xff, 0xc5, 0xa0, 0x1b, 0xff, 0xc4, 0x9d, 0x1b, 0xff, 0xae, 0x7b, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xb3, 0x83, 0x0f, 0xff, 0xd1, 0xae, 0x23, 0x5c, 0xcb, 0xa5, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xea, 0xfe, 0x1f, 0x00, 0xdb, 0xfe, 0xf7, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xda, 0xff, 0xff, 0x5f, 0xbc, 0x9d, 0xff, 0xb2, 0x8b, 0x00, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8b, 0x0c, 0xff, 0xc6, 0xa1, 0x1a, 0xff, 0xbe, 0x93, 0x15, 0xff, 0xb3, 0x84, 0x0f, 0xff, 0xb0, 0x80, 0x0c, 0xff, 0xaf, 0x7d, 0x0b, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xad, 0x7a, 0x09, 0xff, 0xbc, 0x90, 0x14, 0xcc, 0xe1, 0xc2, 0x28, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xe4, 0xfe, 0x40, 0x00, 0xd8, 0xfe, 0x8f, 0x00, 0xd9, 0xfd, 0x73, 0x02, 0xd9, 0xfe, 0x57, 0x00, 0xd7, 0xf5, 0xe4, 0x93, 0xa2, 0x64, 0xff, 0xb6, 0x8c, 0x00, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb5, 0x8e, 0x0e, 0xff, 0xc5, 0xa1, 0x1c, 0xff, 0xb5, 0x87, 0x10, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xb2, 0x84, 0x0f, 0xef, 0xcb, 0xa6, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xe4, 0xfe, 0x00, 0x00, 0xd8, 0xfe, 0x00, 0x00, 0xdd, 0xfd, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xda, 0xff, 0xff, 0x00, 0xd7, 0xf7, 0xff, 0x7c, 0xa9, 0x62, 0xff, 0xb5, 0x8c, 0x00, 0xff, 0xb4, 0x8e, 0x0e, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb3, 0x8d, 0x0d, 0xff, 0xbc, 0x97, 0x13, 0xff, 0xb4, 0x88, 0x10, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xb1, 0x83, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x67, 0x00, 0xd7, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x00, 0xd9, 0xfd, 0xf7, 0x48, 0xbf, 0xac, 0xff, 0xa0, 0x9d, 0x55, 0xff, 0xab, 0x94, 0x19, 0xff, 0xb3, 0x8f, 0x00, 0xff, 0xb7, 0x8d, 0x00, 0xff, 0xb7, 0x8d, 0x00, 0xff, 0xb7, 0x8d, 0x00, 0xff, 0xb7, 0x8d, 0x00, 0xff, 0xb7, 0x8d, 0x00, 0xff, 0xb7, 0x8d, 0x00, 0xff, 0xb6, 0x8b, 0x00, 0xff, 0xc0, 0x9a, 0x1a, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb4, 0x88, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xfd, 0x00, 0x00, 0xdd, 0xfe, 0xb8, 0x00, 0xd8, 0xfd, 0xa4, 0x01, 0xd9, 0xfe, 0x4c, 0x01, 0xda, 0xfe, 0x3f, 0x00, 0xdb, 0xff, 0xf3, 0x00, 0xd6, 0xf4, 0xff, 0x2f, 0xd2, 0xea, 0xff, 0x4b, 0xd0, 0xe6, 0xff, 0x56, 0xce, 0xe5, 0xff, 0x57, 0xcf, 0xe5, 0xff, 0x57, 0xcf, 0xe5, 0xff, 0x57, 0xd0, 0xe5, 0xff, 0x57, 0xd0, 0xe5, 0xff, 0x57, 0xd0, 0xe5, 0xff, 0x4b, 0xd4, 0xec, 0xff, 0xb7, 0x89, 0x00, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xfc, 0xb4, 0x87, 0x0d, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfd, 0x00, 0x00, 0xdc, 0xfe, 0x00, 0x00, 0xd9, 0xfd, 0x00, 0x00, 0xda, 0xff, 0x00, 0x01, 0xdf, 0xfe, 0x24, 0x01, 0xda, 0xfe, 0xf7, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xb8, 0x7d, 0x00, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xb3, 0x87, 0x0d, 0xef, 0xbc, 0x95, 0x14, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xfe, 0x2b, 0x00, 0xd9, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0x54, 0x01, 0xd9, 0xfe, 0xd4, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xb5, 0x80, 0x00, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb3, 0x89, 0x0d, 0xcf, 0xcc, 0xae, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xfe, 0x27, 0x00, 0xd9, 0xfd, 0x87, 0x01, 0xd3, 0xfb, 0x00, 0x02, 0xdd, 0xfd, 0x00, 0x01, 0xdd, 0xfd, 0xa4, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xd9, 0xff, 0xe0, 0x29, 0xd6, 0xef, 0xff, 0x00, 0xda, 0xff, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x9a, 0x94, 0x00, 0xff, 0xb3, 0x89, 0x08, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb7, 0x90, 0x11, 0x5f, 0xbb, 0x8f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfa, 0x00, 0x00, 0xda, 0xfd, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xe2, 0xff, 0x00, 0x00, 0xde, 0xff, 0x7b, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xd8, 0xff, 0x83, 0xbb, 0xbf, 0x87, 0x43, 0xa0, 0xa4, 0x6f, 0xff, 0x00, 0xd9, 0xf9, 0xff, 0x01, 0xd9, 0xfe, 0xfc, 0x00, 0xdc, 0xff, 0xb3, 0x65, 0xba, 0x9e, 0xff, 0xb3, 0x8a, 0x00, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb5, 0x8d, 0x0f, 0xaf, 0x8f, 0x33, 0x00, 0x00, 0xc1, 0xa4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xde, 0xfe, 0x47, 0x00, 0xd8, 0xff, 0x53, 0x00, 0xd0, 0xff, 0x00, 0xbf, 0x92, 0x18, 0xcf, 0xaa, 0x79, 0x00, 0xff, 0x52, 0xcd, 0xdc, 0xff, 0x00, 0xda, 0xff, 0x8b, 0x02, 0xcf, 0xf9, 0x00, 0x1e, 0xd3, 0xea, 0xe4, 0x9e, 0x99, 0x47, 0xff, 0xb5, 0x8c, 0x0c, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb5, 0x8c, 0x0d, 0xcf, 0xbb, 0x9f, 0x19, 0x18, 0xc8, 0xce, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xce, 0xfb, 0x00, 0xc4, 0x9d, 0x1d, 0x2b, 0xb2, 0x80, 0x0e, 0xfc, 0xad, 0x78, 0x03, 0xff, 0xac, 0xa4, 0x51, 0xef, 0xc0, 0xa5, 0x00, 0x00, 0x00, 0xe5, 0xff, 0x00, 0x00, 0xdb, 0xff, 0x3f, 0x1c, 0xd0, 0xe2, 0xff, 0xb5, 0x89, 0x00, 0xcf, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb5, 0x8e, 0x0e, 0x9c, 0xb6, 0x9d, 0x16, 0x13, 0xac, 0x8a, 0x05, 0x00, 0xbf, 0xaf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xad, 0x24, 0x00, 0xc5, 0xa0, 0x1e, 0xa4, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xb3, 0x83, 0x0c, 0xff, 0xd8, 0xbb, 0x2b, 0x37, 0xd1, 0xaf, 0x1c, 0x00, 0x01, 0xdf, 0xfe, 0x07, 0x00, 0xda, 0xff, 0x48, 0xff, 0x00, 0x00, 0x04, 0xb6, 0x90, 0x0e, 0x90, 0xb5, 0x8f, 0x0c, 0xe4, 0xb5, 0x8f, 0x0d, 0xf8, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xff, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xec, 0xb5, 0x8f, 0x0d, 0xbc, 0xb7, 0x90, 0x0d, 0x47, 0xb1, 0x84, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x94, 0x15, 0x00, 0xb9, 0x91, 0x13, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xc3, 0x9e, 0x1b, 0x98, 0xc1, 0x9b, 0x1a, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x00, 0xc8, 0x7a, 0x00, 0x00, 0xce, 0xa5, 0x21, 0x03, 0xb7, 0x92, 0x0d, 0x18, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb3, 0x8d, 0x0b, 0x2c, 0xb3, 0x8e, 0x0c, 0x2c, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x2f, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8e, 0x0d, 0x1c, 0xba, 0x97, 0x14, 0x0b, 0xa3, 0x80, 0x00, 0x00, 0xbf, 0x9c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0xdc, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb9, 0x94, 0x12, 0x70, 0xb8, 0x92, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x9e, 0x26, 0x00, 0xcd, 0xa6, 0x09, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xd3, 0xae, 0x25, 0x00, 0xce, 0xa6, 0x1f, 0x3b, 0xcd, 0xa3, 0x1e, 0x2f, 0xd4, 0xb0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x95, 0x14, 0x00, 0xb6, 0x8f, 0x0f, 0x23, 0xb4, 0x8d, 0x0e, 0xd3, 0xb4, 0x8d, 0x0d, 0xff, 0xb5, 0x8d, 0x0d, 0x87, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xa0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xaa, 0x00, 0x00, 0xd0, 0xac, 0x1a, 0x00, 0xd5, 0xac, 0x21, 0x57, 0xd3, 0xac, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xaa, 0x42, 0x00, 0xbe, 0x96, 0x0e, 0x00, 0xbe, 0x91, 0x16, 0xec, 0xc3, 0x98, 0x19, 0xcf, 0xcc, 0xa6, 0x1f, 0x00, 0xd0, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0b, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb4, 0x8e, 0x0d, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xa4, 0x1c, 0x00, 0xcd, 0xa8, 0x1f, 0x64, 0xb8, 0x88, 0x13, 0xf0, 0xd7, 0xb3, 0x24, 0x0c, 0xd0, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xa6, 0x22, 0x00, 0xcf, 0xaa, 0x22, 0x73, 0xac, 0x76, 0x09, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 0xd3, 0xb1, 0x24, 0x4c, 0xce, 0xaa, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa7, 0x14, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x1c, 0x00, 0xdd, 0xbc, 0x2b, 0x0f, 0xb6, 0x86, 0x12, 0xe0, 0xad, 0x79, 0x0b, 0xff, 0xc6, 0x9e, 0x1d, 0x63, 0xd2, 0xb0, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc5, 0x30, 0x0c, 0xb7, 0x8b, 0x13, 0xdc, 0xad, 0x7c, 0x0a, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xbc, 0x91, 0x16, 0xcf, 0xf2, 0xdd, 0x3c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xac, 0x1b, 0x00, 0xd5, 0xac, 0x21, 0x58, 0xd3, 0xac, 0x21, 0x00, 0xd0, 0xaa, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xb2, 0x26, 0x00, 0xc4, 0x9e, 0x1c, 0x48, 0xb0, 0x80, 0x0d, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xbe, 0x94, 0x17, 0xf3, 0xa3, 0x5f, 0x00, 0x00, 0xd4, 0xb5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x9f, 0x1a, 0x2b, 0xb4, 0x87, 0x0e, 0xfb, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb4, 0x87, 0x0f, 0xf3, 0xcc, 0xaa, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xaa, 0x00, 0x00, 0xcf, 0xaa, 0x21, 0x18, 0xb9, 0x89, 0x13, 0xfc, 0xd4, 0xaf, 0x23, 0x3f, 0xce, 0xa8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa4, 0x1e, 0x00, 0xc2, 0x9c, 0x1a, 0xcc, 0xaf, 0x80, 0x0b, 0xff, 0xb0, 0x80, 0x0b, 0xff, 0xb0, 0x80, 0x0a, 0xff, 0xd2, 0xb1, 0x24, 0x60, 0xcd, 0xab, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8b, 0x0e, 0x30, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb3, 0x89, 0x0d, 0xf7, 0xba, 0x95, 0x13, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x1c, 0x00, 0xd1, 0xad, 0x24, 0x00, 0xc7, 0x9e, 0x1e, 0x84, 0xac, 0x76, 0x0a, 0xff, 0xba, 0x8c, 0x14, 0xd3, 0xe6, 0xcb, 0x2f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x8f, 0x11, 0x00, 0xb6, 0x8d, 0x10, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x85, 0x0b, 0xff, 0xbe, 0x98, 0x17, 0xa0, 0xbd, 0x96, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x9a, 0x17, 0x08, 0xb4, 0x8c, 0x0d, 0xbc, 0xb3, 0x8c, 0x0d, 0xff, 0xb3, 0x8c, 0x0d, 0xfc, 0xb4, 0x8c, 0x0e, 0xaf, 0xda, 0xc1, 0x2e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xb2, 0x26, 0x00, 0xfd, 0xf3, 0x41, 0x07, 0xb9, 0x8d, 0x13, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xb1, 0x81, 0x0e, 0xfc, 0xc8, 0xa2, 0x1e, 0x34, 0xd4, 0xb5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x8f, 0x10, 0x00, 0xb5, 0x8d, 0x0f, 0x9c, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xbe, 0x9b, 0x18, 0x33, 0xbb, 0x97, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x90, 0x10, 0x00, 0xb2, 0x8d, 0x0a, 0x08, 0xb4, 0x8e, 0x0e, 0x2c, 0xb5, 0x8e, 0x0d, 0x2b, 0xb9, 0x90, 0x09, 0x04, 0xbc, 0x96, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa4, 0x1e, 0x00, 0xcb, 0xa8, 0x1f, 0x87, 0xaf, 0x7e, 0x0a, 0xff, 0xb0, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xc5, 0x9f, 0x1d, 0xa7, 0xcd, 0xab, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x92, 0x12, 0x00, 0xaa, 0x87, 0x00, 0x04, 0xb4, 0x8e, 0x0e, 0x8b, 0xb4, 0x8e, 0x0d, 0xc3, 0xb6, 0x8f, 0x0c, 0x3c, 0xbb, 0x96, 0x14, 0x00, 0xbe, 0x9b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x8f, 0x11, 0x00, 0xb8, 0x8f, 0x12, 0xc4, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xba, 0x92, 0x14, 0xe7, 0xbd, 0x96, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0b, 0x00, 0xb4, 0x8e, 0x0e, 0x00, 0xb4, 0x8e, 0x0d, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x8f, 0x10, 0x00, 0xb7, 0x90, 0x11, 0x53, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb7, 0x92, 0x12, 0x7b, 0xbb, 0x97, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x92, 0x12, 0x00, 0xb6, 0x90, 0x0f, 0x00, 0xb3, 0x8e, 0x0d, 0x53, 0xb4, 0x8e, 0x0d, 0xc7, 0xb6, 0x8e, 0x0d, 0x7b, 0xb0, 0x7b, 0x00, 0x03, 0xbe, 0x9b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0c, 0x00, 0xb3, 0x8d, 0x0d, 0x00, 0xb4, 0x8e, 0x0d, 0x00, 0xb5, 0x8e, 0x0d, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x10, 0x00, 0xf4, 0xff, 0x0b, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0xed, 0xff, 0x10, 0x00, 0xea, 0xfe, 0x94, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0x43, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0x08, 0x82, 0x00, 
+  0x00, 0x00, 0x00, 0x0a, 0x00, 0xe5, 0xfe, 0x54, 0x00, 0xe6, 0xfd, 0xd7, 0x0e, 0xfd, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe6, 0xfe, 0x63, 0x00, 0xdd, 0xfe, 0xff, 0x01, 0xee, 0xff, 0x40, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xec, 0xff, 0x24, 0x00, 0xe2, 0xfe, 0xff, 0x00, 0xec, 0xfe, 0x34, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x0b, 0x00, 0xef, 0xff, 0x08, 0xac, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xe5, 0xfe, 0x5b, 0x00, 0xe9, 0xfe, 0xb0, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0xe2, 0xfe, 0xc4, 0x01, 0xd9, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xc3, 0x05, 0xf4, 
+  0xff, 0x17, 0x02, 0xdf, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xd7, 0x08, 0xf7, 0xff, 0x17, 0x03, 0xe4, 0xfe, 0xeb, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe2, 0xfe, 0xac, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xf8, 0xfc, 0x0c, 0x00, 0xe6, 0xfe, 0xd4, 0x00, 0xe8, 0xff, 0x40, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x04, 0x00, 0xf6, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x0b, 0x00, 0xe1, 0xff, 0x87, 0x01, 0xda, 0xfe, 0xff, 0x04, 0xe8, 0xfe, 0xdb, 0x04, 0xf1, 0xff, 0x2c, 0x02, 0xdc, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdb, 0xfe, 0xff, 0x03, 0xe6, 
+  0xfe, 0xf4, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xfb, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0x01, 0xdb, 0xfe, 0xe0, 0x03, 0xee, 0xff, 0x40, 
+  0x03, 0xe6, 0xfe, 0xf7, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xe4, 0xfd, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xef, 0xff, 0x0f, 0x00, 0xe9, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0xe3, 0xfe, 0x2b, 0x00, 0xea, 0xfe, 0xd4, 0x00, 0xef, 0xfd, 0x47, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe0, 0xfd, 0xb3, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x04, 0xe1, 0xfe, 0xf8, 
+  0x02, 0xd9, 0xfe, 0xff, 0x82, 0x02, 0xdb, 0xfe, 0xff, 0x82, 0x03, 0xdb, 0xfd, 0xff, 0x82, 0x02, 0xdb, 0xfe, 0xff, 0x08, 0x02, 0xdb, 0xfe, 0xfc, 0x03, 0xdf, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 
+  0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0x97, 0x00, 0x00, 0x00, 0x00, 0x04, 0xed, 0xff, 0x67, 0x00, 0xe6, 0xfe, 0xeb, 0x00, 0xe2, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xdb, 
+  0xfe, 0x28, 0x00, 0xd8, 0xfe, 0xfb, 0x02, 0xe2, 0xfe, 0xff, 0x03, 0xe9, 0xfd, 0xbc, 0x03, 0xde, 0xfe, 0xe3, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdb, 0xfd, 
+  0xff, 0x85, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x00, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x03, 0x03, 0xdf, 0xfe, 0xdc, 0x04, 0xe8, 0xfe, 0xe7, 0x02, 0xdf, 
+  0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xda, 0xfe, 0x20, 0x01, 0xd9, 0xfe, 0xf4, 0x01, 0xd9, 
+  0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x00, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 0x89, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 
+  0x00, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf8, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x1c, 0x9e, 0x00, 0x00, 
+  0x00, 0x00, 0x07, 0x00, 0xe3, 0xfe, 0xaf, 0x00, 0xe7, 0xfe, 0xff, 0x03, 0xe8, 0xfd, 0xb3, 0x03, 0xe7, 0xfe, 0x74, 0x01, 0xdb, 0xfe, 0xf0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 
+  0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x86, 0x05, 0xde, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 
+  0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x06, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xe8, 0x07, 0xeb, 0xff, 0x5c, 0x04, 0xe8, 0xfe, 0xc3, 0x00, 0xe7, 0xfe, 0xff, 0x00, 
+  0xe3, 0xfe, 0x40, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xdf, 0xfe, 0x4b, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 
+  0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x01, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x86, 0x06, 0xe0, 0xfd, 0xff, 
+  0x81, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdd, 0xfe, 0xff, 0x01, 0xda, 0xfe, 
+  0xff, 0x01, 0xd9, 0xfe, 0xef, 0x01, 0xd9, 0xfd, 0x1c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x04, 0x00, 0xef, 0xff, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd9, 0xfe, 
+  0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x01, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x00, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x06, 
+  0xe0, 0xfd, 0xff, 0x00, 0x07, 0xe0, 0xfd, 0xff, 0x85, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x09, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 
+  0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xd4, 0x81, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0xef, 0xff, 0x07, 0x00, 0xec, 0xff, 0x04, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xea, 0xfe, 0x3c, 0x00, 0xe8, 0xfe, 0xdb, 0x01, 0xec, 0xfe, 0xcf, 0x05, 0xee, 0xfe, 0xc8, 0x02, 
+  0xdb, 0xfe, 0xfb, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 0x07, 0xe1, 
+  0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x84, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x03, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 
+  0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x00, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x05, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xf3, 0x04, 0xed, 0xfe, 0xcb, 0x03, 0xeb, 
+  0xfe, 0xcf, 0x00, 0xe8, 0xfe, 0xe7, 0x00, 0xeb, 0xff, 0x23, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd6, 0xfc, 0x10, 0x00, 0xd7, 0xfe, 0xe3, 0x81, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0x02, 0xda, 
+  0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 
+  0x81, 0x08, 0xe2, 0xfd, 0xff, 0x01, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x81, 0x09, 0xe4, 0xfd, 0xff, 0x81, 0x09, 0xe4, 0xfc, 0xff, 0x01, 0x09, 0xe4, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 
+  0xff, 0x81, 0x08, 0xe3, 0xfd, 0xff, 0x01, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 
+  0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0x00, 0xd7, 0xfe, 0xbf, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02, 0xda, 0xfd, 
+  0x83, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 
+  0xff, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x01, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x82, 0x0a, 0xe5, 0xfc, 0xff, 0x01, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 
+  0xff, 0x81, 0x00, 0xe7, 0xff, 0xff, 0x81, 0x00, 0xe8, 0xff, 0xff, 0x0d, 0x00, 0xe7, 0xff, 0xff, 0x00, 0xe6, 0xff, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x00, 0xe3, 0xff, 0xff, 0x07, 0xe1, 0xfd, 0xff, 
+  0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xfb, 
+  0x01, 0xda, 0xfe, 0x33, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xeb, 0xfe, 0x0f, 0x00, 0xee, 0xfd, 0x1c, 0x01, 0xed, 0xfe, 0x2b, 0x04, 0xf0, 0xff, 0x2f, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 
+  0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x0b, 0x08, 0xe2, 0xfd, 0xff, 
+  0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x03, 0xe7, 0xfe, 0xff, 0x07, 0xe6, 0xf5, 0xff, 0x43, 0xe1, 0xe7, 0xff, 
+  0x74, 0xc8, 0xa0, 0xff, 0x92, 0xb4, 0x58, 0xff, 0xb3, 0xa5, 0x00, 0xff, 0x81, 0xc9, 0x9b, 0x00, 0xff, 0x05, 0xb3, 0xa5, 0x00, 0xff, 0x92, 0xb4, 0x59, 0xff, 0x73, 0xc5, 0xa1, 0xff, 0x42, 0xdc, 
+  0xe8, 0xff, 0x01, 0xe0, 0xf6, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x07, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xe0, 
+  0x05, 0xec, 0xfe, 0x38, 0x03, 0xed, 0xfe, 0x27, 0x00, 0xec, 0xfd, 0x1b, 0x00, 0xee, 0xff, 0x0b, 0x94, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xe6, 0xfe, 0x40, 0x00, 0xe2, 0xfe, 0xef, 0x02, 0xdf, 
+  0xfe, 0xfb, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 
+  0x08, 0xe2, 0xfd, 0xff, 0x01, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x07, 0x0c, 0xe7, 0xfc, 0xff, 0x00, 0xe9, 0xfe, 0xff, 0x3d, 0xda, 0xc6, 0xff, 0xa2, 
+  0xb4, 0x68, 0xff, 0xb2, 0x90, 0x1b, 0xff, 0xb1, 0x76, 0x00, 0xff, 0xad, 0x73, 0x00, 0xff, 0xab, 0x70, 0x05, 0xff, 0x81, 0xa9, 0x6f, 0x08, 0xff, 0x07, 0xaa, 0x70, 0x05, 0xff, 0xae, 0x73, 0x00, 
+  0xff, 0xb1, 0x76, 0x00, 0xff, 0xb2, 0x90, 0x1b, 0xff, 0xa1, 0xb2, 0x69, 0xff, 0x39, 0xd4, 0xc7, 0xff, 0x00, 0xe1, 0xff, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0x03, 
+  0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdd, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xf7, 0x00, 0xe2, 0xfe, 0xfb, 0x00, 0xec, 0xff, 0x1c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd7, 0xfe, 
+  0xb0, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x03, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 
+  0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x81, 0x0a, 0xe5, 0xfc, 0xff, 0x06, 0x0b, 0xe7, 0xfc, 0xff, 0x09, 0xe8, 0xfd, 0xff, 0x0d, 0xe7, 0xf6, 0xff, 0x74, 0xc6, 0x93, 0xff, 0xbb, 0x8e, 
+  0x00, 0xff, 0xad, 0x72, 0x05, 0xff, 0xa8, 0x70, 0x09, 0xff, 0x87, 0xa9, 0x71, 0x09, 0xff, 0x0b, 0xa8, 0x70, 0x09, 0xff, 0xad, 0x72, 0x05, 0xff, 0xba, 0x8e, 0x00, 0xff, 0x72, 0xc2, 0x93, 0xff, 
+  0x04, 0xde, 0xf7, 0xff, 0x03, 0xde, 0xfe, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xff, 0x67, 
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x11, 0x02, 0xd9, 0xfd, 0xcb, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 
+  0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0d, 0xe7, 0xfc, 0xff, 0x0d, 0xe8, 
+  0xf6, 0xff, 0x9a, 0xb4, 0x6f, 0xff, 0xb1, 0x7e, 0x00, 0xff, 0xaa, 0x71, 0x07, 0xff, 0x8b, 0xaa, 0x72, 0x09, 0xff, 0x08, 0xaa, 0x71, 0x07, 0xff, 0xb0, 0x7e, 0x00, 0xff, 0x98, 0xb2, 0x6f, 0xff, 
+  0x00, 0xde, 0xf8, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x00, 0xde, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x00, 0xdc, 0xff, 0xac, 0x95, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xee, 
+  0xff, 0x08, 0x00, 0xee, 0xfd, 0x20, 0x03, 0xeb, 0xff, 0x63, 0x01, 0xde, 0xfe, 0xd0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 
+  0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x00, 0xe9, 
+  0xfa, 0xff, 0x86, 0xbb, 0x73, 0xff, 0xaf, 0x77, 0x00, 0xff, 0xa9, 0x73, 0x09, 0xff, 0x8d, 0xaa, 0x73, 0x09, 0xff, 0x0a, 0xa9, 0x73, 0x09, 0xff, 0xaf, 0x78, 0x00, 0xff, 0x9c, 0xad, 0x47, 0xff, 
+  0x93, 0xb3, 0x56, 0xff, 0xb7, 0xa6, 0x00, 0xff, 0xcc, 0x9e, 0x00, 0xff, 0xc0, 0xa3, 0x00, 0xff, 0xac, 0xab, 0x25, 0xf0, 0xbb, 0xab, 0x35, 0xa0, 0xc0, 0xb0, 0x34, 0x44, 0xa7, 0xc1, 0x4e, 0x10, 
+  0x91, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xf8, 0xff, 0x03, 0x00, 0xe6, 0xfe, 0xaf, 0x00, 0xe0, 0xfe, 0xf7, 0x01, 0xdc, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 
+  0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 
+  0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x00, 0xe8, 0xfb, 0xff, 0x6d, 0xcb, 0x9e, 0xff, 0xb2, 0x7d, 0x00, 0xff, 0xab, 0x74, 0x09, 0xff, 0x90, 0xab, 0x75, 0x09, 0xff, 0x09, 0xae, 0x77, 0x00, 0xff, 
+  0xaf, 0x78, 0x00, 0xff, 0xac, 0x75, 0x06, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xab, 0x74, 0x07, 0xff, 0xad, 0x77, 0x06, 0xff, 0xb0, 0x7b, 0x0a, 0xff, 0xb3, 0x8b, 0x1c, 0xff, 0xc0, 0xa2, 0x25, 0xdc, 
+  0xd8, 0xb4, 0x21, 0x4b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfe, 0xbc, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x0d, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe8, 0xfc, 0xff, 
+  0x35, 0xe2, 0xe5, 0xff, 0xae, 0x90, 0x2b, 0xff, 0xaa, 0x75, 0x0a, 0xff, 0x98, 0xab, 0x76, 0x09, 0xff, 0x04, 0xaa, 0x75, 0x09, 0xff, 0xab, 0x75, 0x08, 0xff, 0xbc, 0x8f, 0x14, 0xff, 0xcc, 0xa6, 
+  0x1d, 0x7c, 0xe1, 0xc3, 0x32, 0x04, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0xd8, 0xfd, 0x8c, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfd, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x00, 0xe9, 0xff, 0xff, 
+  0x74, 0xc3, 0x8f, 0xff, 0xae, 0x77, 0x00, 0xff, 0x9b, 0xac, 0x77, 0x0a, 0xff, 0x03, 0xac, 0x76, 0x0a, 0xff, 0xb5, 0x84, 0x10, 0xff, 0xcc, 0xa5, 0x1f, 0x90, 0xdf, 0xc5, 0x28, 0x04, 0x8e, 0x00, 
+  0x00, 0x00, 0x00, 0x10, 0x00, 0xf9, 0xff, 0x03, 0x01, 0xec, 0xfe, 0x3b, 0x02, 0xe1, 0xfe, 0xdb, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x05, 0xe5, 0xfe, 0xff, 0x00, 0xe7, 0xfe, 0xff, 0x00, 0xe8, 0xff, 0xff, 0x00, 0xea, 0xf9, 0xff, 
+  0xa6, 0x94, 0x00, 0xff, 0xac, 0x77, 0x06, 0xff, 0x9c, 0xac, 0x78, 0x0a, 0xff, 0x02, 0xab, 0x77, 0x09, 0xff, 0xb5, 0x86, 0x10, 0xfb, 0xcc, 0xa7, 0x20, 0x57, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x10, 
+  0x00, 0xef, 0xfd, 0x1f, 0x00, 0xe9, 0xfe, 0xcc, 0x00, 0xde, 0xfe, 0xfc, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 
+  0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe1, 0xfe, 0xff, 0x00, 0xe5, 0xff, 0xff, 0x1a, 0xdc, 0xd3, 0xff, 0x77, 0xce, 0x9f, 0xff, 0xaa, 0xc5, 0x87, 0xff, 0xb7, 0xb8, 0x6b, 0xff, 
+  0xaf, 0x76, 0x00, 0xff, 0x9f, 0xad, 0x7a, 0x0a, 0xff, 0x01, 0xbe, 0x93, 0x16, 0xe8, 0xe0, 0xbf, 0x2b, 0x18, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xe0, 0xff, 0x03, 0x00, 0xd6, 0xfe, 0x74, 
+  0x00, 0xd8, 0xfe, 0xe8, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x06, 0xde, 0xfd, 0xff, 0x00, 0xe0, 0xff, 0xff, 
+  0x32, 0xdb, 0xe5, 0xff, 0x87, 0xc0, 0x74, 0xff, 0xc4, 0x98, 0x00, 0xff, 0xbb, 0x86, 0x00, 0xff, 0xb0, 0x7b, 0x03, 0xff, 0xac, 0x78, 0x08, 0xff, 0xa0, 0xad, 0x7b, 0x0a, 0xff, 0x01, 0xad, 0x7c, 
+  0x0a, 0xff, 0xc9, 0xa2, 0x1e, 0x80, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xd8, 0xff, 0x10, 0x02, 0xd8, 0xfd, 0x88, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 
+  0x04, 0xdd, 0xfd, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x38, 0xd8, 0xcd, 0xff, 0xb7, 0xa2, 0x32, 0xff, 0xb3, 0x82, 0x00, 0xff, 0x81, 0xae, 0x7c, 0x0b, 0xff, 0xa2, 0xae, 0x7d, 0x0b, 0xff, 0x02, 0xae, 
+  0x7c, 0x0b, 0xff, 0xb8, 0x8c, 0x13, 0xdb, 0xdd, 0xba, 0x2b, 0x0c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0xee, 0xff, 0x1c, 0x02, 0xe1, 0xfe, 0xdb, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 
+  0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdd, 0xfe, 0xff, 0x30, 0xd9, 0xe5, 0xff, 0xb4, 0xa0, 0x31, 0xff, 0xad, 0x7c, 0x0c, 0xff, 0x97, 0xae, 0x7f, 0x0b, 0xff, 0x06, 0xb1, 0x82, 0x0d, 0xff, 0xb3, 
+  0x86, 0x0f, 0xff, 0xb5, 0x89, 0x11, 0xff, 0xb6, 0x89, 0x11, 0xff, 0xb5, 0x88, 0x10, 0xff, 0xb3, 0x86, 0x0f, 0xff, 0xb0, 0x82, 0x0c, 0xff, 0x87, 0xae, 0x7f, 0x0b, 0xff, 0x01, 0xb1, 0x84, 0x0e, 
+  0xef, 0xc6, 0xa3, 0x1d, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf0, 0xff, 0x34, 0x00, 0xe4, 0xfe, 0xf0, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x04, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 
+  0xff, 0x00, 0xdf, 0xff, 0xff, 0x81, 0xba, 0x72, 0xff, 0xb1, 0x82, 0x00, 0xff, 0x95, 0xaf, 0x81, 0x0b, 0xff, 0x0c, 0xae, 0x80, 0x0a, 0xff, 0xb3, 0x86, 0x0e, 0xff, 0xc2, 0x98, 0x18, 0xff, 0xc3, 
+  0x96, 0x17, 0xff, 0xbb, 0x8a, 0x14, 0xff, 0xb5, 0x83, 0x12, 0xff, 0xb4, 0x81, 0x11, 0xff, 0xb6, 0x84, 0x11, 0xff, 0xbb, 0x8b, 0x13, 0xff, 0xc3, 0x97, 0x19, 0xff, 0xc2, 0x97, 0x17, 0xff, 0xb2, 
+  0x85, 0x0d, 0xff, 0xae, 0x80, 0x0a, 0xff, 0x84, 0xaf, 0x81, 0x0b, 0xff, 0x01, 0xb1, 0x84, 0x0d, 0xfc, 0xbb, 0x92, 0x14, 0x2b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xec, 0xff, 0x04, 0x00, 
+  0xe4, 0xfe, 0x8f, 0x00, 0xd6, 0xfe, 0xdb, 0x01, 0xd9, 0xfe, 0xf7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdc, 0xfe, 0xff, 0x1a, 0xd7, 0xd4, 0xff, 0xba, 0x8b, 0x00, 0xff, 0x95, 
+  0xb0, 0x82, 0x0b, 0xff, 0x05, 0xb1, 0x83, 0x0b, 0xff, 0xbb, 0x8f, 0x13, 0xff, 0xc2, 0x96, 0x18, 0xff, 0xb2, 0x7c, 0x0e, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa8, 0x70, 0x08, 0xff, 0x81, 0xa9, 0x71, 
+  0x09, 0xff, 0x06, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa7, 0x6d, 0x07, 0xff, 0xb2, 0x7e, 0x0f, 0xff, 0xc3, 0x96, 0x18, 0xff, 0xbb, 0x90, 0x12, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0x83, 
+  0xb0, 0x82, 0x0b, 0xff, 0x01, 0xb1, 0x83, 0x0b, 0xff, 0xb3, 0x87, 0x0e, 0x33, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xd5, 0xff, 0x07, 0x01, 0xd9, 0xfe, 0x20, 0x00, 0xd8, 0xfe, 0x98, 0x02, 
+  0xda, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x6c, 0xc2, 0x9d, 0xff, 0xb3, 0x7f, 0x00, 0xff, 0x95, 0xb0, 0x84, 0x0c, 0xff, 0x03, 0xc1, 0x97, 0x16, 0xff, 0xb5, 0x82, 0x10, 0xff, 0xaa, 0x72, 0x09, 
+  0xff, 0xaa, 0x71, 0x09, 0xff, 0x86, 0xaa, 0x72, 0x09, 0xff, 0x09, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xb5, 0x83, 0x11, 0xff, 0xc0, 0x96, 0x16, 0xff, 0xaf, 0x83, 0x0a, 0xff, 0xb1, 
+  0x85, 0x0c, 0xff, 0xb1, 0x86, 0x0d, 0xff, 0xb2, 0x85, 0x0c, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0xab, 0x7c, 0x08, 0x28, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xee, 0xff, 0x1f, 0x02, 0xe0, 0xfe, 
+  0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdb, 0xff, 0xff, 0x94, 0xac, 0x82, 0xff, 0xb2, 0x83, 0x06, 0xff, 0x94, 0xb1, 0x85, 0x0c, 0xff, 0x02, 0xbc, 0x92, 0x13, 0xff, 0xb2, 0x7e, 0x0e, 0xff, 0xa9, 
+  0x72, 0x09, 0xff, 0x8a, 0xaa, 0x73, 0x09, 0xff, 0x09, 0xa9, 0x72, 0x08, 0xff, 0xb4, 0x81, 0x0f, 0xff, 0xc6, 0x9d, 0x19, 0xff, 0xc6, 0x9c, 0x1a, 0xff, 0xc7, 0x9d, 0x1b, 0xff, 0xc6, 0x9d, 0x1a, 
+  0xff, 0xc5, 0x9d, 0x1a, 0xff, 0xca, 0xa2, 0x1c, 0xa3, 0xd0, 0xaa, 0x20, 0x37, 0xda, 0xba, 0x29, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xf1, 0xfc, 0x0c, 0x00, 0xe1, 0xfe, 0xd8, 0x01, 
+  0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x00, 0xdc, 0xff, 0xff, 0x9d, 0xa1, 0x7d, 0xff, 0xb2, 0x86, 0x0b, 0xff, 0x92, 0xb2, 0x87, 0x0c, 0xff, 0x03, 0xb1, 0x86, 0x0c, 0xff, 0xbb, 0x92, 0x11, 
+  0xff, 0xb7, 0x87, 0x10, 0xff, 0xab, 0x74, 0x09, 0xff, 0x8c, 0xab, 0x75, 0x09, 0xff, 0x09, 0xab, 0x74, 0x09, 0xff, 0xad, 0x77, 0x0a, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 
+  0x74, 0x08, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 0xba, 0x8c, 0x13, 0xf7, 0xce, 0xa8, 0x1d, 0xa7, 0xd4, 0xba, 0x24, 0x10, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xe8, 0xff, 
+  0x5f, 0x00, 0xd9, 0xfe, 0xd8, 0x00, 0xd8, 0xfe, 0xdf, 0x01, 0xd9, 0xfe, 0xe8, 0x00, 0xdb, 0xff, 0xff, 0x81, 0xab, 0x86, 0xff, 0xb4, 0x87, 0x03, 0xff, 0x92, 0xb2, 0x88, 0x0c, 0xff, 0x02, 0xb3, 
+  0x8a, 0x0d, 0xff, 0xbc, 0x90, 0x15, 0xff, 0xa9, 0x74, 0x09, 0xff, 0x94, 0xab, 0x76, 0x0a, 0xff, 0x03, 0xaa, 0x75, 0x09, 0xff, 0xb1, 0x7e, 0x0e, 0xff, 0xc8, 0x9d, 0x1d, 0xc7, 0xd1, 0xae, 0x24, 
+  0x17, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xd0, 0xff, 0x03, 0x00, 0xd7, 0xff, 0x0c, 0x03, 0xdd, 0xff, 0x37, 0x00, 0xda, 0xff, 0xff, 0x4f, 0xc2, 0xa9, 0xff, 0xb7, 0x85, 0x00, 0xff, 0x90, 
+  0xb3, 0x8a, 0x0d, 0xff, 0x04, 0xb2, 0x89, 0x0c, 0xff, 0xb1, 0x88, 0x0b, 0xff, 0xb4, 0x8b, 0x0e, 0xff, 0xb1, 0x80, 0x0e, 0xff, 0xac, 0x78, 0x0a, 0xff, 0x95, 0xac, 0x79, 0x0a, 0xff, 0x02, 0xac, 
+  0x78, 0x0a, 0xff, 0xaf, 0x7d, 0x0c, 0xff, 0xc6, 0xa2, 0x1d, 0xac, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0xe5, 0xfe, 0xb0, 0x00, 0xd8, 0xff, 0xff, 0x00, 0xd6, 0xe9, 0xff, 0xa7, 0x8e, 0x00, 
+  0xff, 0xb4, 0x8b, 0x0b, 0xff, 0x8e, 0xb3, 0x8b, 0x0d, 0xff, 0x04, 0xb9, 0x93, 0x12, 0xff, 0xc1, 0x9b, 0x17, 0xff, 0xc5, 0xa0, 0x1b, 0xff, 0xc4, 0x9d, 0x1b, 0xff, 0xae, 0x7b, 0x0a, 0xff, 0x98, 
+  0xad, 0x7a, 0x0a, 0xff, 0x01, 0xb3, 0x83, 0x0f, 0xff, 0xd1, 0xae, 0x23, 0x5c, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xea, 0xfe, 0x1f, 0x00, 0xdb, 0xfe, 0xf7, 0x00, 0xd8, 0xfe, 0xff, 0x00, 
+  0xda, 0xff, 0xff, 0x5f, 0xbc, 0x9d, 0xff, 0xb2, 0x8b, 0x00, 0xff, 0x8c, 0xb4, 0x8c, 0x0d, 0xff, 0x05, 0xb4, 0x8b, 0x0c, 0xff, 0xc6, 0xa1, 0x1a, 0xff, 0xbe, 0x93, 0x15, 0xff, 0xb3, 0x84, 0x0f, 
+  0xff, 0xb0, 0x80, 0x0c, 0xff, 0xaf, 0x7d, 0x0b, 0xff, 0x99, 0xae, 0x7c, 0x0a, 0xff, 0x02, 0xad, 0x7a, 0x09, 0xff, 0xbc, 0x90, 0x14, 0xcc, 0xe1, 0xc2, 0x28, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 
+  0x06, 0x00, 0xe4, 0xfe, 0x40, 0x00, 0xd8, 0xfe, 0x8f, 0x00, 0xd9, 0xfd, 0x73, 0x02, 0xd9, 0xfe, 0x57, 0x00, 0xd7, 0xf5, 0xe4, 0x93, 0xa2, 0x64, 0xff, 0xb6, 0x8c, 0x00, 0xff, 0x8a, 0xb4, 0x8d, 
+  0x0d, 0xff, 0x03, 0xb5, 0x8e, 0x0e, 0xff, 0xc5, 0xa1, 0x1c, 0xff, 0xb5, 0x87, 0x10, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0x9d, 0xae, 0x7e, 0x0b, 0xff, 0x01, 0xb2, 0x84, 0x0f, 0xef, 0xcb, 0xa6, 0x20, 
+  0x1c, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xff, 0xff, 0x0c, 0x00, 0xda, 0xff, 0xff, 0x00, 0xd7, 0xf7, 0xff, 0x7c, 0xa9, 0x62, 0xff, 0xb5, 0x8c, 0x00, 0xff, 0xb4, 0x8e, 0x0e, 0xff, 0x87, 
+  0xb4, 0x8e, 0x0d, 0xff, 0x03, 0xb3, 0x8d, 0x0d, 0xff, 0xbc, 0x97, 0x13, 0xff, 0xb4, 0x88, 0x10, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0x9e, 0xaf, 0x80, 0x0b, 0xff, 0x01, 0xb1, 0x83, 0x0d, 0xfc, 0xbb, 
+  0x92, 0x14, 0x2b, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xe9, 0xff, 0x67, 0x00, 0xd7, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x00, 0xd9, 0xfd, 0xf7, 0x48, 0xbf, 0xac, 0xff, 0xa0, 0x9d, 0x55, 
+  0xff, 0xab, 0x94, 0x19, 0xff, 0xb3, 0x8f, 0x00, 0xff, 0x85, 0xb7, 0x8d, 0x00, 0xff, 0x01, 0xb6, 0x8b, 0x00, 0xff, 0xc0, 0x9a, 0x1a, 0xff, 0xa0, 0xb0, 0x82, 0x0b, 0xff, 0x01, 0xb1, 0x84, 0x0c, 
+  0xff, 0xb4, 0x88, 0x0f, 0x30, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xdd, 0xfe, 0xb8, 0x00, 0xd8, 0xfd, 0xa4, 0x01, 0xd9, 0xfe, 0x4c, 0x01, 0xda, 0xfe, 0x3f, 0x00, 0xdb, 0xff, 0xf3, 0x00, 
+  0xd6, 0xf4, 0xff, 0x2f, 0xd2, 0xea, 0xff, 0x4b, 0xd0, 0xe6, 0xff, 0x56, 0xce, 0xe5, 0xff, 0x81, 0x57, 0xcf, 0xe5, 0xff, 0x82, 0x57, 0xd0, 0xe5, 0xff, 0x02, 0x4b, 0xd4, 0xec, 0xff, 0xb7, 0x89, 
+  0x00, 0xff, 0xb1, 0x83, 0x0b, 0xff, 0x9f, 0xb1, 0x84, 0x0c, 0xff, 0x01, 0xb1, 0x84, 0x0c, 0xfc, 0xb4, 0x87, 0x0d, 0x2b, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xdf, 0xfe, 0x24, 0x01, 0xda, 
+  0xfe, 0xf7, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x00, 0x03, 0xdb, 0xfd, 0xff, 0x82, 0x03, 0xdc, 0xfd, 0xff, 0x01, 0x00, 0xe0, 
+  0xff, 0xff, 0xb8, 0x7d, 0x00, 0xff, 0xa0, 0xb1, 0x85, 0x0c, 0xff, 0x01, 0xb3, 0x87, 0x0d, 0xef, 0xbc, 0x95, 0x14, 0x1c, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xdd, 0xfe, 0x2b, 0x00, 0xd9, 
+  0xfe, 0xff, 0x00, 0xd8, 0xfe, 0xf8, 0x01, 0xd9, 0xfe, 0x54, 0x01, 0xd9, 0xfe, 0xd4, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 
+  0x01, 0x00, 0xe0, 0xff, 0xff, 0xb5, 0x80, 0x00, 0xff, 0xa0, 0xb2, 0x88, 0x0c, 0xff, 0x01, 0xb3, 0x89, 0x0d, 0xcf, 0xcc, 0xae, 0x20, 0x08, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xdb, 0xfe, 
+  0x27, 0x00, 0xd9, 0xfd, 0x87, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdd, 0xfd, 0xa4, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x06, 0x00, 0xd9, 0xff, 0xe0, 0x29, 0xd6, 0xef, 0xff, 0x00, 0xda, 0xff, 
+  0xff, 0x02, 0xda, 0xfe, 0xff, 0x00, 0xdd, 0xff, 0xff, 0x9a, 0x94, 0x00, 0xff, 0xb3, 0x89, 0x08, 0xff, 0x9f, 0xb2, 0x89, 0x0c, 0xff, 0x00, 0xb7, 0x90, 0x11, 0x5f, 0x94, 0x00, 0x00, 0x00, 0x00, 
+  0x09, 0x00, 0xde, 0xff, 0x7b, 0x00, 0xd8, 0xfe, 0xff, 0x00, 0xd8, 0xff, 0x83, 0xbb, 0xbf, 0x87, 0x43, 0xa0, 0xa4, 0x6f, 0xff, 0x00, 0xd9, 0xf9, 0xff, 0x01, 0xd9, 0xfe, 0xfc, 0x00, 0xdc, 0xff, 
+  0xb3, 0x65, 0xba, 0x9e, 0xff, 0xb3, 0x8a, 0x00, 0xff, 0x9e, 0xb3, 0x8b, 0x0d, 0xff, 0x00, 0xb5, 0x8d, 0x0f, 0xaf, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xde, 0xfe, 0x47, 0x00, 0xd8, 0xff, 
+  0x53, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x92, 0x18, 0xcf, 0xaa, 0x79, 0x00, 0xff, 0x52, 0xcd, 0xdc, 0xff, 0x00, 0xda, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd3, 0xea, 0xe4, 0x9e, 0x99, 0x47, 
+  0xff, 0xb5, 0x8c, 0x0c, 0xff, 0x9c, 0xb4, 0x8c, 0x0d, 0xff, 0x01, 0xb5, 0x8c, 0x0d, 0xcf, 0xbb, 0x9f, 0x19, 0x18, 0x97, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc4, 0x9d, 0x1d, 0x2b, 0xb2, 0x80, 0x0e, 
+  0xfc, 0xad, 0x78, 0x03, 0xff, 0xac, 0xa4, 0x51, 0xef, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xdb, 0xff, 0x3f, 0x1c, 0xd0, 0xe2, 0xff, 0xb5, 0x89, 0x00, 0xcf, 0x9b, 0xb4, 0x8e, 0x0d, 0xff, 
+  0x01, 0xb5, 0x8e, 0x0e, 0x9c, 0xb6, 0x9d, 0x16, 0x13, 0x98, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xc5, 0xa0, 0x1e, 0xa4, 0xae, 0x7e, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xb3, 0x83, 0x0c, 0xff, 0xd8, 
+  0xbb, 0x2b, 0x37, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xfe, 0x07, 0x00, 0xda, 0xff, 0x48, 0xff, 0x00, 0x00, 0x04, 0xb6, 0x90, 0x0e, 0x90, 0xb5, 0x8f, 0x0c, 0xe4, 0xb5, 0x8f, 0x0d, 0xf8, 0x94, 
+  0xb5, 0x8f, 0x0d, 0xff, 0x03, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xec, 0xb5, 0x8f, 0x0d, 0xbc, 0xb7, 0x90, 0x0d, 0x47, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x91, 0x13, 0xff, 0x81, 
+  0xb1, 0x84, 0x0c, 0xff, 0x01, 0xb0, 0x82, 0x0b, 0xff, 0xc3, 0x9e, 0x1b, 0x98, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xce, 0xa5, 0x21, 0x03, 0xb7, 0x92, 0x0d, 0x18, 0xb5, 0x8f, 0x0d, 0x28, 0x89, 
+  0xb5, 0x8f, 0x0d, 0x2f, 0x01, 0xb3, 0x8d, 0x0b, 0x2c, 0xb3, 0x8e, 0x0c, 0x2c, 0x88, 0xb5, 0x8f, 0x0d, 0x2f, 0x02, 0xb5, 0x8f, 0x0d, 0x28, 0xb5, 0x8e, 0x0d, 0x1c, 0xba, 0x97, 0x14, 0x0b, 0x9b, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8a, 0x0d, 0xdc, 0x81, 0xb2, 0x89, 0x0c, 0xff, 0x01, 0xb2, 0x88, 0x0c, 0xff, 0xb9, 0x94, 0x12, 0x70, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xce, 0xa6, 0x1f, 
+  0x3b, 0xcd, 0xa3, 0x1e, 0x2f, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb6, 0x8f, 0x0f, 0x23, 0xb4, 0x8d, 0x0e, 0xd3, 0xb4, 0x8d, 0x0d, 0xff, 0xb5, 0x8d, 0x0d, 0x87, 0x89, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xd5, 0xac, 0x21, 0x57, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbe, 0x91, 0x16, 0xec, 0xc3, 0x98, 0x19, 0xcf, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcd, 0xa8, 0x1f, 0x64, 0xb8, 0x88, 0x13, 
+  0xf0, 0xd7, 0xb3, 0x24, 0x0c, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcf, 0xaa, 0x22, 0x73, 0xac, 0x76, 0x09, 0xff, 0xaf, 0x7b, 0x0c, 0xff, 0xd3, 0xb1, 0x24, 0x4c, 0xb2, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0xdd, 0xbc, 0x2b, 0x0f, 0xb6, 0x86, 0x12, 0xe0, 0xad, 0x79, 0x0b, 0xff, 0xc6, 0x9e, 0x1d, 0x63, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xc5, 0x30, 0x0c, 0xb7, 0x8b, 0x13, 0xdc, 0x81, 
+  0xad, 0x7c, 0x0a, 0xff, 0x01, 0xbc, 0x91, 0x16, 0xcf, 0xf2, 0xdd, 0x3c, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xac, 0x21, 0x58, 0xab, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc4, 0x9e, 0x1c, 
+  0x48, 0xb0, 0x80, 0x0d, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xbe, 0x94, 0x17, 0xf3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0x9f, 0x1a, 0x2b, 0xb4, 0x87, 0x0e, 0xfb, 0x81, 0xb0, 0x82, 0x0b, 0xff, 
+  0x01, 0xb4, 0x87, 0x0f, 0xf3, 0xcc, 0xaa, 0x21, 0x20, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcf, 0xaa, 0x21, 0x18, 0xb9, 0x89, 0x13, 0xfc, 0xd4, 0xaf, 0x23, 0x3f, 0xaa, 0x00, 0x00, 0x00, 0x00, 
+  0x04, 0xc2, 0x9c, 0x1a, 0xcc, 0xaf, 0x80, 0x0b, 0xff, 0xb0, 0x80, 0x0b, 0xff, 0xb0, 0x80, 0x0a, 0xff, 0xd2, 0xb1, 0x24, 0x60, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0x8b, 0x0e, 0x30, 0xb2, 
+  0x88, 0x0c, 0xff, 0x81, 0xb2, 0x87, 0x0c, 0xff, 0x01, 0xb3, 0x89, 0x0d, 0xf7, 0xba, 0x95, 0x13, 0x27, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc7, 0x9e, 0x1e, 0x84, 0xac, 0x76, 0x0a, 0xff, 0xba, 
+  0x8c, 0x14, 0xd3, 0xe6, 0xcb, 0x2f, 0x07, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x8d, 0x10, 0xff, 0x81, 0xb1, 0x86, 0x0c, 0xff, 0x01, 0xb1, 0x85, 0x0b, 0xff, 0xbe, 0x98, 0x17, 0xa0, 0x82, 
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xbf, 0x9a, 0x17, 0x08, 0xb4, 0x8c, 0x0d, 0xbc, 0xb3, 0x8c, 0x0d, 0xff, 0xb3, 0x8c, 0x0d, 0xfc, 0xb4, 0x8c, 0x0e, 0xaf, 0xda, 0xc1, 0x2e, 0x03, 0x82, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0xfd, 0xf3, 0x41, 0x07, 0xb9, 0x8d, 0x13, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xb1, 0x81, 0x0e, 0xfc, 0xc8, 0xa2, 0x1e, 0x34, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x8d, 0x0f, 
+  0x9c, 0x82, 0xb3, 0x8a, 0x0d, 0xff, 0x00, 0xbe, 0x9b, 0x18, 0x33, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb2, 0x8d, 0x0a, 0x08, 0xb4, 0x8e, 0x0e, 0x2c, 0xb5, 0x8e, 0x0d, 0x2b, 0xb9, 0x90, 0x09, 
+  0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0xa8, 0x1f, 0x87, 0xaf, 0x7e, 0x0a, 0xff, 0xb0, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xc5, 0x9f, 0x1d, 0xa7, 0xa9, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0xaa, 0x87, 0x00, 0x04, 0xb4, 0x8e, 0x0e, 0x8b, 0xb4, 0x8e, 0x0d, 0xc3, 0xb6, 0x8f, 0x0c, 0x3c, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb8, 0x8f, 0x12, 0xc4, 0xb1, 0x85, 0x0c, 0xff, 0xb1, 
+  0x86, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0xff, 0xba, 0x92, 0x14, 0xe7, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x90, 0x11, 0x53, 0x82, 0xb3, 0x8a, 0x0d, 0xff, 0x00, 0xb7, 0x92, 0x12, 0x7b, 0xbb, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xb3, 0x8e, 0x0d, 0x53, 0xb4, 0x8e, 0x0d, 0xc7, 0xb6, 0x8e, 0x0d, 0x7b, 0xb0, 0x7b, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xcd, 
+  0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +434,7 @@ const lv_img_dsc_t owm_10d_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_10d_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_10d_64px_map,
 };
-
@@ -10,271 +10,418 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_11N_64PX uint8_t owm_11n_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x38, 0xdb, 0x6f, 0xdb, 0x9b, 0xdb, 0xb8, 0xdb, 0xcb, 0xdb, 0xc0, 0xdb, 0xa7, 0xdb, 0x7f, 0xdb, 0x4c, 0xdb, 0x0f, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0xff, 0x00, 0xdb, 0x00, 0xdb, 0x0c, 0xdb, 0x33, 0xdb, 0x9b, 0xdb, 0xeb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xb7, 0xdb, 0x5c, 0xdb, 0x14, 0xdb, 0x00, 0xdb, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x57, 0xdb, 0xd3, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xeb, 0xdb, 0x80, 0xb7, 0x07, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x23, 0xdb, 0xab, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd7, 0xdb, 0x4c, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x4c, 0xdb, 0xf0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0x87, 0xff, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xb7, 0x00, 0xdb, 0x5b, 0xdb, 0xfb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9f, 0xdb, 0x0f, 0xb7, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xdb, 0x60, 0xdb, 0xfb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9f, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x33, 0xdb, 0xf7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x87, 0xdb, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x18, 0xdb, 0xd8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0x4c, 0xdb, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x92, 0x00, 0xdb, 0x97, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd7, 0xb7, 0x07, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x28, 0xdb, 0xf3, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x7b, 0xff, 0x57, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x57, 0xff, 0x77, 0xff, 0x9b, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x80, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x9c, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x37, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xeb, 0xb7, 0x14, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x1b, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x5c, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x70, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xbf, 0x17, 0x23, 0x3b, 0x1f, 0x3b, 0x0c, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x03, 0xdb, 0xcb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xfc, 0x33, 0xef, 0x37, 0xdb, 0x37, 0x80, 0x37, 0x18, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x13, 0xdb, 0xe4, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xe8, 0x37, 0x57, 0x3b, 0x04, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x20, 0xdb, 0xf0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xfb, 0x37, 0x90, 0x3b, 0x04, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2b, 0xdb, 0xfb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x7c, 0x17, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x30, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x3b, 0x4b, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x17, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xd3, 0x3b, 0x0c, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x2f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x76, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x37, 0x3f, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x27, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x53, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd1, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x93, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x1c, 0xdb, 0xec, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xb6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0x53, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xd3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x76, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x92, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x37, 0xff, 0x33, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0xa8, 0xdb, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xb1, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x54, 0xdb, 0xff, 0xdb, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xb6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd5, 0xff, 0xd6, 0xff, 0x76, 0xff, 0x13, 0xff, 0x33, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xf7, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0xe0, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x36, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd1, 0xff, 0x33, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xfc, 0x37, 0xd7, 0x37, 0x68, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x74, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x72, 0xff, 0x53, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x37, 0xb3, 0x37, 0x18, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x17, 0xdb, 0xec, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x96, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0x52, 0xff, 0x13, 0xff, 0x17, 0xff, 0x96, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0x72, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xc7, 0x3b, 0x0f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x67, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xb6, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x76, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd1, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x9f, 0x5b, 0x03, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x1b, 0x00, 0xb7, 0xac, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x96, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf4, 0x37, 0x2b, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x9b, 0x13, 0x57, 0xe3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xb6, 0xff, 0xf4, 0xff, 0xd6, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x92, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x72, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x84, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0xbb, 0x2f, 0x57, 0xf7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x36, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0x96, 0xff, 0x96, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xcf, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xbb, 0x2f, 0x57, 0xe3, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0x92, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x57, 0x00, 0x9b, 0x13, 0xb7, 0xac, 0x77, 0xff, 0x17, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xf8, 0xff, 0x56, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x72, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xb2, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x17, 0x00, 0xdb, 0x67, 0xdb, 0xec, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xd1, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xe0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x17, 0xdb, 0x74, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xf9, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x92, 0xff, 0x93, 0xff, 0x92, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xa4, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x54, 0xdb, 0xac, 0xf9, 0xe8, 0xdb, 0xec, 0xdb, 0xf8, 0xb7, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xb6, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0x53, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x37, 0x48, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xfa, 0x00, 0xfc, 0x2f, 0xfa, 0x23, 0xdb, 0x1b, 0xdb, 0x27, 0x97, 0x48, 0x13, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x76, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x37, 0x0b, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x14, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x04, 0x13, 0xb7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xd9, 0xff, 0xf4, 0xff, 0x96, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf7, 0x37, 0x38, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x37, 0x1b, 0x13, 0xe3, 0x13, 0xff, 0x77, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x37, 0x44, 0x0f, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x1c, 0x13, 0xc8, 0xd9, 0xff, 0xf9, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf7, 0x13, 0xc0, 0x37, 0x2b, 0x13, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0xfa, 0x00, 0xfd, 0x54, 0xf8, 0xff, 0x57, 0xc0, 0x13, 0xf0, 0x13, 0xfc, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xfb, 0x13, 0xdb, 0x13, 0xa0, 0x37, 0x47, 0x37, 0x07, 0x37, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0xfd, 0x07, 0xfc, 0xd7, 0xf8, 0x3f, 0x96, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x17, 0x00, 0x5f, 0x07, 0x37, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x37, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfc, 0x54, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x0b, 0x37, 0xdb, 0x3b, 0x10, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0xf8, 0x00, 0xfd, 0x78, 0xfd, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x00, 0x37, 0x4f, 0x13, 0xff, 0x37, 0xb7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x20, 0xfc, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xec, 0x13, 0xff, 0x13, 0xf4, 0x37, 0x1f, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x17, 0x00, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x5f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x7f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x3b, 0x08, 0x37, 0x94, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xbf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xdf, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xa4, 0x13, 0xf8, 0x37, 0x1c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x97, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xb7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x37, 0x1c, 0x13, 0xef, 0x13, 0xff, 0x37, 0x94, 0x37, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0x03, 0x13, 0x9b, 0x13, 0xff, 0x13, 0xc3, 0x37, 0x18, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x37, 0x78, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x5b, 0x14, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x37, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x83, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0x94, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x13, 0x5f, 0x13, 0xf8, 0x13, 0xff, 0x13, 0xe8, 0x3b, 0x0c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x12, 0x00, 0x13, 0x23, 0x13, 0x33, 0x13, 0x0f, 0x37, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x09, 0xdb, 0x38, 0xdb, 0x6f, 0xdb, 0x9b, 0xdb, 0xb8, 0xdb, 0xcb, 0xdb, 0xc0, 0xdb, 0xa7, 0xdb, 0x7f, 0xdb, 0x4c, 
+  0xdb, 0x0f, 0xb1, 0x00, 0x00, 0x03, 0xdb, 0x0c, 0xdb, 0x33, 0xdb, 0x9b, 0xdb, 0xeb, 0x89, 0xdb, 0xff, 0x02, 0xdb, 0xb7, 0xdb, 0x5c, 0xdb, 0x14, 0xad, 0x00, 0x00, 0x02, 0xdb, 0x57, 0xdb, 0xd3, 
+  0xdb, 0xf8, 0x8d, 0xdb, 0xff, 0x02, 0xdb, 0xeb, 0xdb, 0x80, 0xb7, 0x07, 0xa9, 0x00, 0x00, 0x01, 0xdb, 0x23, 0xdb, 0xab, 0x92, 0xdb, 0xff, 0x01, 0xdb, 0xd7, 0xdb, 0x4c, 0xa7, 0x00, 0x00, 0x01, 
+  0xdb, 0x4c, 0xdb, 0xf0, 0x94, 0xdb, 0xff, 0x01, 0xdb, 0xf8, 0xdb, 0x87, 0xa5, 0x00, 0x00, 0x01, 0xdb, 0x5b, 0xdb, 0xfb, 0x97, 0xdb, 0xff, 0x01, 0xdb, 0x9f, 0xdb, 0x0f, 0xa2, 0x00, 0x00, 0x01, 
+  0xdb, 0x60, 0xdb, 0xfb, 0x99, 0xdb, 0xff, 0x00, 0xdb, 0x9f, 0xa1, 0x00, 0x00, 0x01, 0xdb, 0x33, 0xdb, 0xf7, 0x9b, 0xdb, 0xff, 0x00, 0xdb, 0x87, 0x9f, 0x00, 0x00, 0x01, 0xdb, 0x18, 0xdb, 0xd8, 
+  0x9c, 0xdb, 0xff, 0x01, 0xdb, 0xf8, 0xdb, 0x4c, 0x9e, 0x00, 0x00, 0x00, 0xdb, 0x97, 0x8b, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x8e, 0xdb, 0xff, 0x01, 0xdb, 0xd7, 0xb7, 0x07, 0x9c, 0x00, 0x00, 0x01, 
+  0xdb, 0x28, 0xdb, 0xf3, 0x8b, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x03, 0xbb, 0xff, 0x7b, 0xff, 0x57, 0xff, 0x33, 0xff, 0x82, 0x13, 0xff, 0x03, 0x33, 0xff, 0x57, 0xff, 0x77, 0xff, 0x9b, 0xff, 0x85, 
+  0xdb, 0xff, 0x00, 0xdb, 0x80, 0x9c, 0x00, 0x00, 0x00, 0xdb, 0x9c, 0x8c, 0xdb, 0xff, 0x02, 0xff, 0xff, 0xdb, 0xff, 0x7b, 0xff, 0x81, 0x13, 0xff, 0x87, 0x0f, 0xff, 0x02, 0x13, 0xff, 0x37, 0xff, 
+  0xbb, 0xff, 0x83, 0xdb, 0xff, 0x01, 0xdb, 0xeb, 0xb7, 0x14, 0x9a, 0x00, 0x00, 0x00, 0xdb, 0x1b, 0x8d, 0xdb, 0xff, 0x01, 0xbb, 0xff, 0x37, 0xff, 0x8d, 0x13, 0xff, 0x00, 0x77, 0xff, 0x83, 0xdb, 
+  0xff, 0x00, 0xdb, 0x5c, 0x9a, 0x00, 0x00, 0x00, 0xdb, 0x70, 0x85, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x85, 0xdb, 0xff, 0x00, 0x9b, 0xff, 0x90, 0x13, 0xff, 0x00, 0x77, 0xff, 0x82, 0xbb, 0xff, 0x03, 
+  0xbb, 0xbf, 0x17, 0x23, 0x3b, 0x1f, 0x3b, 0x0c, 0x96, 0x00, 0x00, 0x01, 0xdb, 0x03, 0xdb, 0xcb, 0x85, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x01, 0xbb, 0xff, 0x33, 0xff, 0x91, 0x13, 
+  0xff, 0x01, 0x37, 0xff, 0x33, 0xff, 0x81, 0x13, 0xff, 0x04, 0x33, 0xfc, 0x33, 0xef, 0x37, 0xdb, 0x37, 0x80, 0x37, 0x18, 0x94, 0x00, 0x00, 0x01, 0xdb, 0x13, 0xdb, 0xe4, 0x84, 0xdb, 0xff, 0x83, 
+  0xff, 0xff, 0x82, 0xdb, 0xff, 0x00, 0x37, 0xff, 0x9a, 0x13, 0xff, 0x02, 0x37, 0xe8, 0x37, 0x57, 0x3b, 0x04, 0x92, 0x00, 0x00, 0x01, 0xdb, 0x20, 0xdb, 0xf0, 0x84, 0xdb, 0xff, 0x85, 0xff, 0xff, 
+  0x00, 0x9b, 0xff, 0x9c, 0x13, 0xff, 0x02, 0x33, 0xfb, 0x37, 0x90, 0x3b, 0x04, 0x91, 0x00, 0x00, 0x01, 0xdb, 0x2b, 0xdb, 0xfb, 0x84, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x33, 0xff, 
+  0x9e, 0x13, 0xff, 0x00, 0x37, 0x7c, 0x91, 0x00, 0x00, 0x00, 0xdb, 0x30, 0x85, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x00, 0xbb, 0xff, 0x9f, 0x13, 0xff, 0x01, 0x33, 0xff, 0x3b, 0x4b, 0x90, 0x00, 0x00, 
+  0x00, 0xdb, 0x33, 0x85, 0xdb, 0xff, 0x03, 0xdf, 0xff, 0xdb, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x81, 0x17, 0xff, 0xa0, 0x13, 0xff, 0x01, 0x37, 0xd3, 0x3b, 0x0c, 0x8f, 0x00, 0x00, 0x00, 0xdb, 0x2f, 
+  0x85, 0xdb, 0xff, 0x01, 0x7b, 0xff, 0x37, 0xff, 0x8b, 0x13, 0xff, 0x01, 0x76, 0xff, 0xd6, 0xff, 0x81, 0xb6, 0xff, 0x01, 0xd6, 0xff, 0x33, 0xff, 0x92, 0x13, 0xff, 0x01, 0x13, 0xfb, 0x37, 0x3f, 
+  0x8f, 0x00, 0x00, 0x01, 0xdb, 0x27, 0xdb, 0xf8, 0x83, 0xdb, 0xff, 0x00, 0x7b, 0xff, 0x8c, 0x13, 0xff, 0x01, 0x53, 0xff, 0xf5, 0xff, 0x82, 0xf0, 0xff, 0x00, 0xd1, 0xff, 0x94, 0x13, 0xff, 0x00, 
+  0x37, 0x93, 0x8f, 0x00, 0x00, 0x01, 0xdb, 0x1c, 0xdb, 0xec, 0x82, 0xdb, 0xff, 0x00, 0x7b, 0xff, 0x8d, 0x13, 0xff, 0x00, 0xb6, 0xff, 0x82, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0x53, 0xff, 0x85, 0x13, 
+  0xff, 0x00, 0x33, 0xff, 0x84, 0x37, 0xff, 0x88, 0x13, 0xff, 0x00, 0x37, 0xd3, 0x8f, 0x00, 0x00, 0x01, 0xdb, 0x0c, 0xdb, 0xe0, 0x81, 0xdb, 0xff, 0x01, 0xbb, 0xff, 0x33, 0xff, 0x8c, 0x13, 0xff, 
+  0x00, 0x76, 0xff, 0x83, 0xf0, 0xff, 0x00, 0x92, 0xff, 0x84, 0x13, 0xff, 0x81, 0x37, 0xff, 0x01, 0x33, 0xff, 0x13, 0xff, 0x81, 0x0f, 0xff, 0x01, 0x13, 0xff, 0x33, 0xff, 0x81, 0x37, 0xff, 0x86, 
+  0x13, 0xff, 0x00, 0x13, 0xfc, 0x90, 0x00, 0x00, 0x00, 0xdb, 0xa8, 0x81, 0xdb, 0xff, 0x00, 0x7b, 0xff, 0x8c, 0x13, 0xff, 0x01, 0x33, 0xff, 0xf5, 0xff, 0x82, 0xf0, 0xff, 0x00, 0xb1, 0xff, 0x83, 
+  0x13, 0xff, 0x01, 0x33, 0xff, 0x37, 0xff, 0x81, 0x13, 0xff, 0x00, 0x0f, 0xff, 0x83, 0x13, 0xff, 0x81, 0x0f, 0xff, 0x02, 0x13, 0xff, 0x33, 0xff, 0x37, 0xff, 0x85, 0x13, 0xff, 0x90, 0x00, 0x00, 
+  0x00, 0xdb, 0x54, 0x81, 0xdb, 0xff, 0x00, 0x37, 0xff, 0x8c, 0x13, 0xff, 0x00, 0xb6, 0xff, 0x83, 0xf0, 0xff, 0x03, 0xd5, 0xff, 0xd6, 0xff, 0x76, 0xff, 0x13, 0xff, 0x81, 0x33, 0xff, 0x8b, 0x13, 
+  0xff, 0x01, 0x33, 0xff, 0x37, 0xff, 0x83, 0x33, 0xff, 0x00, 0x33, 0xf7, 0x91, 0x00, 0x00, 0x01, 0xdb, 0xe0, 0xdb, 0xff, 0x8c, 0x13, 0xff, 0x01, 0x36, 0xff, 0xf4, 0xff, 0x84, 0xf0, 0xff, 0x03, 
+  0xd1, 0xff, 0x33, 0xff, 0x13, 0xff, 0x33, 0xff, 0x8e, 0x13, 0xff, 0x00, 0x33, 0xff, 0x82, 0x13, 0xff, 0x02, 0x33, 0xfc, 0x37, 0xd7, 0x37, 0x68, 0x8f, 0x00, 0x00, 0x01, 0xdb, 0x74, 0xdb, 0xff, 
+  0x8c, 0x13, 0xff, 0x00, 0xf5, 0xff, 0x84, 0xf0, 0xff, 0x00, 0xf1, 0xff, 0x81, 0x13, 0xff, 0x00, 0x37, 0xff, 0x82, 0x73, 0xff, 0x01, 0x72, 0xff, 0x53, 0xff, 0x90, 0x13, 0xff, 0x02, 0x33, 0xff, 
+  0x37, 0xb3, 0x37, 0x18, 0x8d, 0x00, 0x00, 0x02, 0xdb, 0x17, 0xdb, 0xec, 0x37, 0xff, 0x8a, 0x13, 0xff, 0x00, 0x96, 0xff, 0x84, 0xf4, 0xff, 0x04, 0xf5, 0xff, 0x52, 0xff, 0x13, 0xff, 0x17, 0xff, 
+  0x96, 0xff, 0x83, 0xf5, 0xff, 0x00, 0x72, 0xff, 0x92, 0x13, 0xff, 0x01, 0x37, 0xc7, 0x3b, 0x0f, 0x8d, 0x00, 0x00, 0x01, 0xdb, 0x67, 0x77, 0xff, 0x8d, 0x13, 0xff, 0x00, 0xb6, 0xff, 0x81, 0xf4, 
+  0xff, 0x00, 0x76, 0xff, 0x81, 0x13, 0xff, 0x01, 0x37, 0xff, 0xf4, 0xff, 0x82, 0xf0, 0xff, 0x00, 0xd1, 0xff, 0x94, 0x13, 0xff, 0x01, 0x37, 0x9f, 0x5b, 0x03, 0x8d, 0x00, 0x00, 0x01, 0xb7, 0xac, 
+  0x33, 0xff, 0x8b, 0x13, 0xff, 0x07, 0x77, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x96, 0xff, 0x17, 0xff, 0x37, 0xff, 0x17, 0xff, 0xd6, 0xff, 0x83, 0xf0, 0xff, 0x95, 0x13, 0xff, 0x01, 0x13, 0xf4, 0x37, 
+  0x2b, 0x8d, 0x00, 0x00, 0x01, 0x9b, 0x13, 0x57, 0xe3, 0x8b, 0x13, 0xff, 0x03, 0xb6, 0xff, 0xf4, 0xff, 0xd6, 0xff, 0x17, 0xff, 0x81, 0x13, 0xff, 0x00, 0x92, 0xff, 0x83, 0xf0, 0xff, 0x00, 0x72, 
+  0xff, 0x96, 0x13, 0xff, 0x00, 0x37, 0x84, 0x8e, 0x00, 0x00, 0x01, 0xbb, 0x2f, 0x57, 0xf7, 0x89, 0x13, 0xff, 0x02, 0x36, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x83, 0x13, 0xff, 0x00, 0xf5, 0xff, 0x82, 
+  0xf0, 0xff, 0x00, 0xf1, 0xff, 0x81, 0x96, 0xff, 0x00, 0x33, 0xff, 0x94, 0x13, 0xff, 0x00, 0x37, 0xcf, 0x8f, 0x00, 0x00, 0x02, 0xbb, 0x2f, 0x57, 0xe3, 0x33, 0xff, 0x87, 0x13, 0xff, 0x81, 0xf9, 
+  0xff, 0x00, 0x57, 0xff, 0x82, 0x13, 0xff, 0x00, 0xd6, 0xff, 0x84, 0xf0, 0xff, 0x01, 0xf4, 0xff, 0x92, 0xff, 0x95, 0x13, 0xff, 0x00, 0x13, 0xfb, 0x90, 0x00, 0x00, 0x03, 0x9b, 0x13, 0xb7, 0xac, 
+  0x77, 0xff, 0x17, 0xff, 0x84, 0x13, 0xff, 0x02, 0x77, 0xff, 0xf8, 0xff, 0x56, 0xff, 0x82, 0x13, 0xff, 0x01, 0x72, 0xff, 0xf5, 0xff, 0x84, 0xf0, 0xff, 0x00, 0xb2, 0xff, 0x97, 0x13, 0xff, 0x92, 
+  0x00, 0x00, 0x01, 0xdb, 0x67, 0xdb, 0xec, 0x84, 0xdb, 0xff, 0x02, 0xf9, 0xff, 0xfa, 0xff, 0xbb, 0xff, 0x82, 0x13, 0xff, 0x00, 0xf5, 0xff, 0x84, 0xf4, 0xff, 0x00, 0xd1, 0xff, 0x97, 0x13, 0xff, 
+  0x00, 0x13, 0xe0, 0x93, 0x00, 0x00, 0x02, 0xdb, 0x17, 0xdb, 0x74, 0xdb, 0xe0, 0x81, 0xdb, 0xff, 0x03, 0xda, 0xff, 0xf9, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x81, 0x13, 0xff, 0x03, 0x33, 0xff, 0x92, 
+  0xff, 0x93, 0xff, 0x92, 0xff, 0x81, 0xf4, 0xff, 0x00, 0xd4, 0xff, 0x98, 0x13, 0xff, 0x00, 0x37, 0xa4, 0x96, 0x00, 0x00, 0x05, 0xdb, 0x54, 0xdb, 0xac, 0xf9, 0xe8, 0xdb, 0xec, 0xdb, 0xf8, 0xb7, 
+  0xff, 0x84, 0x13, 0xff, 0x03, 0xb6, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0x53, 0xff, 0x97, 0x13, 0xff, 0x01, 0x13, 0xfc, 0x37, 0x48, 0x97, 0x00, 0x00, 0x05, 0xfc, 0x2f, 0xfa, 0x23, 0xdb, 0x1b, 0xdb, 
+  0x27, 0x97, 0x48, 0x13, 0xf4, 0x82, 0x13, 0xff, 0x00, 0x17, 0xff, 0x81, 0xf4, 0xff, 0x00, 0x76, 0xff, 0x98, 0x13, 0xff, 0x01, 0x13, 0xcf, 0x37, 0x0b, 0x97, 0x00, 0x00, 0x00, 0xfc, 0x14, 0x82, 
+  0x00, 0x00, 0x01, 0x3b, 0x04, 0x13, 0xb7, 0x82, 0x13, 0xff, 0x02, 0xd9, 0xff, 0xf4, 0xff, 0x96, 0xff, 0x98, 0x13, 0xff, 0x01, 0x13, 0xf7, 0x37, 0x38, 0x9d, 0x00, 0x00, 0x05, 0x37, 0x1b, 0x13, 
+  0xe3, 0x13, 0xff, 0x77, 0xff, 0xf8, 0xff, 0xd5, 0xff, 0x98, 0x13, 0xff, 0x01, 0x13, 0xef, 0x37, 0x44, 0x9f, 0x00, 0x00, 0x03, 0x37, 0x1c, 0x13, 0xc8, 0xd9, 0xff, 0xf9, 0xff, 0x97, 0x13, 0xff, 
+  0x02, 0x13, 0xf7, 0x13, 0xc0, 0x37, 0x2b, 0xa1, 0x00, 0x00, 0x04, 0xfd, 0x54, 0xf8, 0xff, 0x57, 0xc0, 0x13, 0xf0, 0x13, 0xfc, 0x93, 0x13, 0xfb, 0x03, 0x13, 0xdb, 0x13, 0xa0, 0x37, 0x47, 0x37, 
+  0x07, 0xa1, 0x00, 0x00, 0x02, 0xfd, 0x07, 0xfc, 0xd7, 0xf8, 0x3f, 0x8b, 0x00, 0x00, 0x00, 0x5f, 0x07, 0xaf, 0x00, 0x00, 0x01, 0xfd, 0x40, 0xfc, 0x54, 0x8b, 0x00, 0x00, 0x02, 0x3b, 0x0b, 0x37, 
+  0xdb, 0x3b, 0x10, 0xae, 0x00, 0x00, 0x00, 0xfd, 0x78, 0x8c, 0x00, 0x00, 0x02, 0x37, 0x4f, 0x13, 0xff, 0x37, 0xb7, 0xad, 0x00, 0x00, 0x01, 0xfc, 0x20, 0xfc, 0x07, 0x8c, 0x00, 0x00, 0x03, 0x37, 
+  0xec, 0x13, 0xff, 0x13, 0xf4, 0x37, 0x1f, 0xba, 0x00, 0x00, 0x00, 0x3b, 0x5f, 0x82, 0x13, 0xff, 0x00, 0x37, 0x7f, 0x84, 0x00, 0x00, 0x01, 0x3b, 0x08, 0x37, 0x94, 0xb3, 0x00, 0x00, 0x00, 0x37, 
+  0xbf, 0x82, 0x13, 0xff, 0x00, 0x37, 0xdf, 0x84, 0x00, 0x00, 0x02, 0x37, 0xa4, 0x13, 0xf8, 0x37, 0x1c, 0xb2, 0x00, 0x00, 0x00, 0x13, 0x97, 0x82, 0x13, 0xff, 0x00, 0x13, 0xb7, 0x83, 0x00, 0x00, 
+  0x03, 0x37, 0x1c, 0x13, 0xef, 0x13, 0xff, 0x37, 0x94, 0xb2, 0x00, 0x00, 0x04, 0x37, 0x03, 0x13, 0x9b, 0x13, 0xff, 0x13, 0xc3, 0x37, 0x18, 0x83, 0x00, 0x00, 0x00, 0x37, 0x78, 0x81, 0x13, 0xff, 
+  0x01, 0x33, 0xff, 0x5b, 0x14, 0xba, 0x00, 0x00, 0x00, 0x37, 0xec, 0x82, 0x13, 0xff, 0x00, 0x37, 0x83, 0xba, 0x00, 0x00, 0x83, 0x13, 0xff, 0x00, 0x37, 0x94, 0xba, 0x00, 0x00, 0x04, 0x13, 0x5f, 
+  0x13, 0xf8, 0x13, 0xff, 0x13, 0xe8, 0x3b, 0x0c, 0xbb, 0x00, 0x00, 0x02, 0x13, 0x23, 0x13, 0x33, 0x13, 0x0f, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x8d, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0x18, 0xc6, 0x00, 0xd7, 0xbd, 0x38, 0xd7, 0xbd, 0x6f, 0xf7, 0xbd, 0x9b, 0xf7, 0xbd, 0xb8, 0xd7, 0xbd, 0xcb, 0xd7, 0xbd, 0xc0, 0xd7, 0xbd, 0xa7, 0xd7, 0xbd, 0x7f, 0xd7, 0xbd, 0x4c, 0xf7, 0xbd, 0x0f, 0xd7, 0xbd, 0x00, 0xb7, 0xbd, 0x00, 0xb7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa4, 0x00, 0x9e, 0xf7, 0x00, 0x18, 0xc6, 0x00, 0xf7, 0xbd, 0x0c, 0xf8, 0xc5, 0x33, 0xf8, 0xc5, 0x9b, 0xf8, 0xc5, 0xeb, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xb7, 0xb7, 0xbd, 0x5c, 0xb7, 0xbd, 0x14, 0x38, 0xc6, 0x00, 0xb6, 0xb5, 0x00, 0x55, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0x39, 0xce, 0x00, 0xf8, 0xc5, 0x57, 0xf8, 0xc5, 0xd3, 0x18, 0xc6, 0xf8, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xeb, 0xb7, 0xbd, 0x80, 0x96, 0xb5, 0x07, 0x96, 0xb5, 0x00, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0x00, 0xf8, 0xc5, 0x00, 0xf8, 0xc5, 0x23, 0x18, 0xc6, 0xab, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xd7, 0xb6, 0xb5, 0x4c, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0xd7, 0xbd, 0x00, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xf0, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xf8, 0xb6, 0xb5, 0x87, 0x5d, 0xef, 0x00, 0xb7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x35, 0xad, 0x00, 0x18, 0xc6, 0x5b, 0x18, 0xc6, 0xfb, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x9f, 0xb6, 0xb5, 0x0f, 0x96, 0xb5, 0x00, 0x76, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x8c, 0x00, 0x18, 0xc6, 0x60, 0x18, 0xc6, 0xfb, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x9f, 0x00, 0x00, 0x00, 0x55, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x33, 0x18, 0xc6, 0xf7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x87, 0x18, 0xc6, 0x00, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x00, 0xf8, 0xc5, 0x18, 0x18, 0xc6, 0xd8, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf8, 0xb6, 0xb5, 0x4c, 0x96, 0xb5, 0x00, 0x55, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0x30, 0x84, 0x00, 0x18, 0xc6, 0x97, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xc6, 0xff, 0x5a, 0xbe, 0xff, 0x39, 0xbe, 0xff, 0x39, 0xbe, 0xff, 0x39, 0xbe, 0xff, 0x19, 0xb6, 0xff, 0x19, 0xbe, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xd7, 0x55, 0xad, 0x07, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0x18, 0xc6, 0x28, 0x18, 0xc6, 0xf3, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xde, 0xff, 0x5a, 0xa6, 0xff, 0xda, 0x75, 0xff, 0xf9, 0x44, 0xff, 0x97, 0x24, 0xff, 0x37, 0x04, 0xff, 0xf6, 0x03, 0xff, 0x16, 0x04, 0xff, 0x57, 0x14, 0xff, 0xd8, 0x34, 0xff, 0x59, 0x55, 0xff, 0xd9, 0x85, 0xff, 0xf8, 0xbd, 0xff, 0xf7, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x80, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x9c, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0xdb, 0xde, 0xff, 0x9b, 0xc6, 0xff, 0x9a, 0x5d, 0xff, 0x77, 0x04, 0xff, 0xb5, 0x03, 0xff, 0x75, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0x17, 0x04, 0xff, 0x19, 0x35, 0xff, 0xd8, 0x9d, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xeb, 0x96, 0xb5, 0x14, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x1b, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xd6, 0xff, 0x5b, 0x9e, 0xff, 0xb8, 0x2c, 0xff, 0xb5, 0x03, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb5, 0x03, 0xff, 0x57, 0x14, 0xff, 0x79, 0x65, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x5c, 0x96, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x00, 0x18, 0xc6, 0x70, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xd6, 0xff, 0xf9, 0x8d, 0xff, 0x57, 0x04, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xf6, 0x03, 0xff, 0x58, 0x55, 0xff, 0xd7, 0xb5, 0xff, 0xb7, 0xad, 0xff, 0xb7, 0xa5, 0xff, 0x97, 0x9d, 0xbf, 0x9b, 0x05, 0x23, 0x9b, 0x25, 0x1f, 0x9a, 0x25, 0x0c, 0x5a, 0x1d, 0x00, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x03, 0x18, 0xc6, 0xcb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x19, 0x9e, 0xff, 0x57, 0x1c, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd6, 0x03, 0xff, 0xb8, 0x2c, 0xff, 0x97, 0x1c, 0xff, 0x37, 0x04, 0xff, 0x36, 0x04, 0xff, 0x57, 0x14, 0xfc, 0x98, 0x1c, 0xef, 0xf9, 0x1c, 0xdb, 0x7a, 0x25, 0x80, 0x9a, 0x25, 0x18, 0x7a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x13, 0x18, 0xc6, 0xe4, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xc6, 0xff, 0xf8, 0x24, 0xff, 0xb5, 0x03, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x36, 0x14, 0xff, 0xf9, 0x1c, 0xe8, 0x5a, 0x25, 0x57, 0xbb, 0x25, 0x04, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x20, 0x18, 0xc6, 0xf0, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xda, 0x7d, 0xff, 0xb5, 0x03, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0x57, 0x14, 0xfb, 0x59, 0x25, 0x90, 0x1c, 0x36, 0x04, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x2b, 0x18, 0xc6, 0xfb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xce, 0xff, 0x77, 0x2c, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x39, 0x25, 0x7c, 0x58, 0x15, 0x00, 0x7b, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x30, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x5a, 0xae, 0xff, 0xf6, 0x03, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x57, 0x14, 0xff, 0x9b, 0x25, 0x4b, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x33, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xbe, 0xff, 0xfa, 0x7d, 0xff, 0x9a, 0x35, 0xff, 0x59, 0x05, 0xff, 0x98, 0x04, 0xff, 0xd5, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x03, 0xff, 0xd6, 0x03, 0xff, 0xd6, 0x03, 0xff, 0xd6, 0x03, 0xff, 0xd6, 0x03, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xb8, 0x1c, 0xd3, 0xbb, 0x2d, 0x0c, 0xbb, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x2f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xce, 0xff, 0xda, 0x75, 0xff, 0xd8, 0x24, 0xff, 0x16, 0x04, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x03, 0xff, 0xb2, 0x74, 0xff, 0x2f, 0xb5, 0xff, 0x2f, 0xb5, 0xff, 0x30, 0xb5, 0xff, 0x2f, 0xbd, 0xff, 0x34, 0x24, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x16, 0x14, 0xfb, 0x39, 0x25, 0x3f, 0xbb, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x27, 0x18, 0xc6, 0xf8, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x99, 0x55, 0xff, 0x36, 0x04, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x35, 0x34, 0xff, 0xa8, 0xe4, 0xff, 0x44, 0xf4, 0xff, 0x44, 0xf4, 0xff, 0x43, 0xf4, 0xff, 0x2a, 0xbc, 0xff, 0xf6, 0x03, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf8, 0x1c, 0x93, 0x59, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x1c, 0x18, 0xc6, 0xec, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xc6, 0xff, 0xb9, 0x6d, 0xff, 0x16, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0xf6, 0x03, 0xff, 0xce, 0xa4, 0xff, 0x23, 0xec, 0xff, 0x04, 0xec, 0xff, 0x04, 0xec, 0xff, 0x06, 0xe4, 0xff, 0x14, 0x3c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x97, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x19, 0x1d, 0xff, 0x19, 0x25, 0xff, 0xf9, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0xb7, 0x1c, 0xd3, 0xd8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x0c, 0x18, 0xc6, 0xe0, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x19, 0xb6, 0xff, 0x97, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x04, 0xff, 0x93, 0x5c, 0xff, 0x60, 0xfc, 0xff, 0x04, 0xec, 0xff, 0x04, 0xec, 0xff, 0x02, 0xf4, 0xff, 0x0f, 0x8c, 0xff, 0x16, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x14, 0xff, 0x98, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0xd6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x37, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x57, 0x14, 0xfc, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x00, 0xf8, 0xc5, 0xa8, 0x18, 0xc6, 0xff, 0x18, 0xce, 0xff, 0x99, 0x75, 0xff, 0x16, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x55, 0x24, 0xff, 0xaa, 0xdc, 0xff, 0x04, 0xec, 0xff, 0x24, 0xec, 0xff, 0x23, 0xec, 0xff, 0x2a, 0xb4, 0xff, 0x17, 0x04, 0xff, 0x16, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xf6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0xb6, 0x0b, 0xff, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf7, 0xbd, 0x54, 0xf8, 0xc5, 0xff, 0x18, 0xce, 0xff, 0xf8, 0x2c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x04, 0xff, 0xd1, 0x94, 0xff, 0x43, 0xec, 0xff, 0x44, 0xec, 0xff, 0x44, 0xec, 0xff, 0x23, 0xec, 0xff, 0xaa, 0xc4, 0xff, 0x2d, 0xb5, 0xff, 0xb2, 0x64, 0xff, 0x36, 0x04, 0xff, 0x97, 0x14, 0xff, 0x98, 0x1c, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x95, 0x0b, 0xff, 0x37, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x97, 0x14, 0xff, 0x77, 0x14, 0xf7, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x9a, 0x25, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xf8, 0xc5, 0x00, 0xf8, 0xc5, 0xe0, 0x18, 0xc6, 0xff, 0x77, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xb4, 0x24, 0xff, 0xc4, 0xf4, 0xff, 0x43, 0xec, 0xff, 0x44, 0xec, 0xff, 0x44, 0xec, 0xff, 0x44, 0xec, 0xff, 0x64, 0xf4, 0xff, 0x69, 0xcc, 0xff, 0x36, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x57, 0x14, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0x57, 0x14, 0xff, 0x16, 0x14, 0xff, 0x16, 0x14, 0xff, 0x37, 0x14, 0xff, 0x77, 0x14, 0xfc, 0xf9, 0x1c, 0xd7, 0x9a, 0x25, 0x68, 0x38, 0x04, 0x00, 0x9a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0xbd, 0x74, 0x18, 0xc6, 0xff, 0x36, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x2b, 0xdd, 0xff, 0x63, 0xec, 0xff, 0x83, 0xec, 0xff, 0x83, 0xec, 0xff, 0x83, 0xec, 0xff, 0x83, 0xec, 0xff, 0x86, 0xdc, 0xff, 0x55, 0x04, 0xff, 0x56, 0x14, 0xff, 0xb8, 0x24, 0xff, 0x34, 0x5c, 0xff, 0x34, 0x64, 0xff, 0x34, 0x64, 0xff, 0x34, 0x64, 0xff, 0xf5, 0x3b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0x57, 0x14, 0xff, 0x39, 0x25, 0xb3, 0x9a, 0x25, 0x18, 0x9a, 0x2d, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x00, 0xd7, 0xbd, 0x17, 0xf7, 0xc5, 0xec, 0xb7, 0x1c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x04, 0xff, 0xf1, 0x8c, 0xff, 0xc0, 0xfc, 0xff, 0xa0, 0xf4, 0xff, 0xa1, 0xf4, 0xff, 0xa3, 0xf4, 0xff, 0xa3, 0xec, 0xff, 0xa4, 0xe4, 0xff, 0x74, 0x44, 0xff, 0x56, 0x0c, 0xff, 0x98, 0x0c, 0xff, 0xb2, 0x7c, 0xff, 0xa7, 0xec, 0xff, 0xa7, 0xec, 0xff, 0xa7, 0xec, 0xff, 0xa7, 0xe4, 0xff, 0x13, 0x5c, 0xff, 0xb5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x1c, 0xc7, 0xdb, 0x2d, 0x0f, 0x7a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x00, 0xf7, 0xc5, 0x67, 0x57, 0x6d, 0xff, 0x56, 0x04, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x57, 0x04, 0xff, 0x57, 0x04, 0xff, 0x57, 0x04, 0xff, 0xcc, 0xac, 0xff, 0xe3, 0xf4, 0xff, 0xe0, 0xf4, 0xff, 0x90, 0x74, 0xff, 0x77, 0x04, 0xff, 0x97, 0x14, 0xff, 0xd6, 0x1c, 0xff, 0xc4, 0xec, 0xff, 0x04, 0xec, 0xff, 0x04, 0xec, 0xff, 0x03, 0xec, 0xff, 0x0c, 0xbc, 0xff, 0xd5, 0x03, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xd5, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x39, 0x25, 0x9f, 0x9f, 0x3e, 0x03, 0xba, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x00, 0x9e, 0x06, 0x00, 0x97, 0x9d, 0xac, 0x76, 0x24, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0xb5, 0x54, 0xff, 0x45, 0xed, 0xff, 0x00, 0xf5, 0xff, 0xf1, 0x94, 0xff, 0x39, 0x05, 0xff, 0xf8, 0x1c, 0xff, 0xb7, 0x04, 0xff, 0xed, 0xcc, 0xff, 0x03, 0xec, 0xff, 0x04, 0xec, 0xff, 0x04, 0xec, 0xff, 0x00, 0xd4, 0xff, 0xf5, 0x03, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xf4, 0x59, 0x25, 0x2b, 0xda, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0xd8, 0x85, 0x13, 0xf7, 0x4c, 0xe3, 0x76, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x57, 0x04, 0xff, 0x6d, 0xad, 0xff, 0x40, 0xfd, 0xff, 0x2c, 0xc5, 0xff, 0xf8, 0x04, 0xff, 0x16, 0x0c, 0xff, 0xd6, 0x03, 0xff, 0x73, 0x74, 0xff, 0x44, 0xec, 0xff, 0x04, 0xec, 0xff, 0x04, 0xec, 0xff, 0x03, 0xec, 0xff, 0x12, 0x64, 0xff, 0xf6, 0x03, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0xf9, 0x1c, 0x84, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x45, 0x00, 0xd7, 0xad, 0x2f, 0xd6, 0x44, 0xf7, 0x76, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x77, 0x0c, 0xff, 0xf4, 0x2c, 0xff, 0xa0, 0xfd, 0xff, 0x66, 0xcd, 0xff, 0x97, 0x04, 0xff, 0xf6, 0x0b, 0xff, 0xf6, 0x0b, 0xff, 0x15, 0x04, 0xff, 0xe7, 0xe4, 0xff, 0x23, 0xec, 0xff, 0x24, 0xec, 0xff, 0x24, 0xec, 0xff, 0x47, 0xdc, 0xff, 0xd0, 0x7c, 0xff, 0xd1, 0x84, 0xff, 0x15, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0xb8, 0x1c, 0xcf, 0xd8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0x17, 0xd6, 0x00, 0xb7, 0xad, 0x2f, 0xf7, 0x4c, 0xe3, 0x96, 0x1c, 0xff, 0x76, 0x04, 0xff, 0x76, 0x0c, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x96, 0x04, 0xff, 0xeb, 0xd5, 0xff, 0x85, 0xe5, 0xff, 0xd6, 0x44, 0xff, 0xf6, 0x13, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x04, 0xff, 0x0d, 0xbd, 0xff, 0x22, 0xec, 0xff, 0x44, 0xec, 0xff, 0x44, 0xec, 0xff, 0x44, 0xec, 0xff, 0x64, 0xec, 0xff, 0xc2, 0xf4, 0xff, 0x70, 0x8c, 0xff, 0x16, 0x04, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x57, 0x14, 0xfb, 0x77, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0x17, 0x3d, 0x00, 0x97, 0x7d, 0x13, 0x97, 0x9d, 0xac, 0x17, 0x65, 0xff, 0xb7, 0x14, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0x77, 0x04, 0xff, 0xf4, 0x5c, 0xff, 0x00, 0xf6, 0xff, 0xd3, 0x44, 0xff, 0x56, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x14, 0xff, 0x74, 0x64, 0xff, 0xa5, 0xec, 0xff, 0x63, 0xec, 0xff, 0x63, 0xec, 0xff, 0x63, 0xec, 0xff, 0x63, 0xec, 0xff, 0x61, 0xec, 0xff, 0x4f, 0x94, 0xff, 0x16, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x00, 0xd7, 0x04, 0x00, 0xd7, 0xc5, 0x67, 0xd7, 0xbd, 0xec, 0xd7, 0xc5, 0xff, 0xd7, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0x69, 0xf6, 0xff, 0xf0, 0xd5, 0xff, 0xb8, 0xad, 0xff, 0x36, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x04, 0xff, 0x68, 0xd5, 0xff, 0xa0, 0xf4, 0xff, 0xa1, 0xf4, 0xff, 0xa3, 0xec, 0xff, 0xa3, 0xec, 0xff, 0xa3, 0xf4, 0xff, 0x8a, 0xc4, 0xff, 0x36, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x14, 0xe0, 0x57, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x00, 0xf7, 0xbd, 0x00, 0xb7, 0xbd, 0x17, 0xb7, 0xbd, 0x74, 0xb7, 0xbd, 0xe0, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x51, 0xd6, 0xff, 0x2a, 0xe6, 0xff, 0xd7, 0xbd, 0xff, 0x97, 0xad, 0xff, 0x36, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x1c, 0xff, 0x74, 0x7c, 0xff, 0x54, 0x74, 0xff, 0x73, 0x8c, 0xff, 0xc3, 0xec, 0xff, 0xc3, 0xf4, 0xff, 0xc2, 0xcc, 0xff, 0x56, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xa4, 0xd8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xad, 0x00, 0xb6, 0xb5, 0x00, 0xd7, 0xbd, 0x00, 0xb7, 0xbd, 0x54, 0xd6, 0xbd, 0xac, 0x6a, 0xee, 0xe8, 0xb7, 0xb5, 0xec, 0xb7, 0xbd, 0xf8, 0x76, 0xa5, 0xff, 0x56, 0x04, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x37, 0x04, 0xff, 0x2e, 0xa5, 0xff, 0x02, 0xf5, 0xff, 0xe4, 0xe4, 0xff, 0x75, 0x4c, 0xff, 0x56, 0x14, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xfc, 0xb7, 0x14, 0x48, 0x38, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x00, 0x91, 0xde, 0x00, 0x40, 0xff, 0x2f, 0x6c, 0xe6, 0x23, 0xb7, 0xb5, 0x1b, 0xb6, 0xb5, 0x27, 0x37, 0x8d, 0x48, 0x76, 0x0c, 0xf4, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x0c, 0xff, 0xd4, 0x04, 0xff, 0x80, 0xf5, 0xff, 0x20, 0xfd, 0xff, 0x92, 0x5c, 0xff, 0x56, 0x04, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x56, 0x14, 0xff, 0x76, 0x14, 0xcf, 0xf8, 0x1c, 0x0b, 0xdc, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x00, 0x44, 0xff, 0x14, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x25, 0x04, 0x76, 0x14, 0xb7, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x04, 0xff, 0xab, 0xcd, 0xff, 0x60, 0xf5, 0xff, 0xcf, 0x7c, 0xff, 0x57, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xf7, 0xb7, 0x14, 0x38, 0xd7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x00, 0x44, 0xff, 0x00, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x00, 0x19, 0x15, 0x1b, 0x76, 0x14, 0xe3, 0x76, 0x14, 0xff, 0xd4, 0x64, 0xff, 0xc3, 0xf5, 0xff, 0x2a, 0xbd, 0xff, 0x76, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xef, 0x97, 0x14, 0x44, 0xb6, 0x02, 0x00, 0x5a, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x1d, 0x00, 0x7a, 0x1d, 0x00, 0xd8, 0x1c, 0x1c, 0x57, 0x04, 0xc8, 0xea, 0xbd, 0xff, 0x87, 0xd5, 0xff, 0x76, 0x04, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xff, 0x76, 0x14, 0xf7, 0x76, 0x14, 0xc0, 0xb7, 0x14, 0x2b, 0x37, 0x0c, 0x00, 0x38, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1c, 0x00, 0x6d, 0xd6, 0x00, 0xcb, 0xe6, 0x54, 0x03, 0xf6, 0xff, 0xb4, 0x44, 0xc0, 0x97, 0x14, 0xf0, 0x97, 0x14, 0xfc, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xfb, 0x97, 0x14, 0xdb, 0x97, 0x14, 0xa0, 0xb7, 0x14, 0x47, 0xd8, 0x1c, 0x07, 0xb7, 0x14, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0x00, 0x87, 0xff, 0x07, 0x84, 0xfe, 0xd7, 0x20, 0xfe, 0x3f, 0xf3, 0x7c, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x7f, 0x47, 0x07, 0xb7, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0x97, 0x14, 0x00, 0xd7, 0x1c, 0x00, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0x00, 0xe4, 0xfe, 0x40, 0xa3, 0xfe, 0x54, 0x42, 0xfe, 0x00, 0x22, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0xfb, 0x2d, 0x0b, 0xb8, 0x1c, 0xdb, 0x5d, 0x36, 0x10, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x00, 0x04, 0xfe, 0x00, 0x04, 0xff, 0x78, 0xea, 0xff, 0x00, 0xa3, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x1d, 0x00, 0x7a, 0x2d, 0x00, 0xf9, 0x24, 0x4f, 0xd5, 0x0b, 0xff, 0xf9, 0x1c, 0xb7, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x00, 0x44, 0xff, 0x20, 0xc0, 0xfe, 0x07, 0xc2, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x24, 0x00, 0xb8, 0x1c, 0xec, 0xd5, 0x0b, 0xff, 0x16, 0x14, 0xf4, 0x59, 0x25, 0x1f, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x2d, 0x00, 0x3a, 0x0d, 0x00, 0x5a, 0x25, 0x00, 0x5a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x00, 0x44, 0xff, 0x00, 0x44, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x25, 0x00, 0xba, 0x2d, 0x5f, 0xf6, 0x0b, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x19, 0x25, 0x7f, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x2d, 0x00, 0x1c, 0x36, 0x08, 0x19, 0x1d, 0x94, 0x98, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x1c, 0x00, 0xb7, 0x1c, 0xbf, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x0c, 0xff, 0xb8, 0x1c, 0xdf, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x14, 0x00, 0xf9, 0x1c, 0xa4, 0xf6, 0x13, 0xf8, 0x5a, 0x25, 0x1c, 0x7a, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0x00, 0x56, 0x14, 0x97, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x97, 0x14, 0xb7, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x4e, 0x00, 0x7a, 0x25, 0x1c, 0x16, 0x14, 0xef, 0xd6, 0x0b, 0xff, 0xf8, 0x1c, 0x94, 0x5a, 0x25, 0x00, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x00, 0x7a, 0x25, 0x03, 0x76, 0x14, 0x9b, 0x76, 0x14, 0xff, 0x77, 0x14, 0xc3, 0x97, 0x14, 0x18, 0x18, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x2d, 0x00, 0x19, 0x25, 0x78, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0x57, 0x14, 0xff, 0x7d, 0x3e, 0x14, 0xba, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0c, 0x00, 0x76, 0x14, 0x00, 0x76, 0x14, 0x00, 0x77, 0x14, 0x00, 0x77, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1c, 0x00, 0xd8, 0x1c, 0xec, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x0c, 0xff, 0x59, 0x25, 0x83, 0x39, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x14, 0x00, 0x56, 0x14, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0x56, 0x0c, 0xff, 0xb7, 0x14, 0x94, 0xb7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x14, 0x00, 0x97, 0x14, 0x5f, 0x76, 0x14, 0xf8, 0x76, 0x14, 0xff, 0x76, 0x14, 0xe8, 0x9a, 0x2d, 0x0c, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x14, 0x00, 0xf3, 0x03, 0x00, 0x76, 0x14, 0x23, 0x76, 0x14, 0x33, 0x97, 0x0c, 0x0f, 0xd7, 0x1c, 0x00, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x09, 0xd7, 0xbd, 0x38, 0xd7, 0xbd, 0x6f, 0xf7, 0xbd, 0x9b, 0xf7, 0xbd, 0xb8, 0xd7, 0xbd, 0xcb, 
+  0xd7, 0xbd, 0xc0, 0xd7, 0xbd, 0xa7, 0xd7, 0xbd, 0x7f, 0xd7, 0xbd, 0x4c, 0xf7, 0xbd, 0x0f, 0xb1, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xbd, 0x0c, 0xf8, 0xc5, 0x33, 0xf8, 0xc5, 0x9b, 0xf8, 0xc5, 0xeb, 
+  0x82, 0xf8, 0xc5, 0xff, 0x83, 0xf7, 0xbd, 0xff, 0x82, 0xd7, 0xbd, 0xff, 0x02, 0xd7, 0xbd, 0xb7, 0xb7, 0xbd, 0x5c, 0xb7, 0xbd, 0x14, 0xad, 0x00, 0x00, 0x00, 0x02, 0xf8, 0xc5, 0x57, 0xf8, 0xc5, 
+  0xd3, 0x18, 0xc6, 0xf8, 0x86, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x82, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xd7, 0xbd, 0xeb, 0xb7, 0xbd, 0x80, 0x96, 0xb5, 0x07, 0xa9, 0x00, 
+  0x00, 0x00, 0x01, 0xf8, 0xc5, 0x23, 0x18, 0xc6, 0xab, 0x83, 0x18, 0xc6, 0xff, 0x02, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x85, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x82, 
+  0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0xd7, 0xb6, 0xb5, 0x4c, 0xa7, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xf0, 0x81, 0x18, 0xc6, 0xff, 0x82, 0x38, 0xc6, 
+  0xff, 0x85, 0x39, 0xce, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0xf8, 0xb6, 0xb5, 0x87, 
+  0xa5, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x5b, 0x18, 0xc6, 0xfb, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x87, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x81, 0x38, 0xc6, 
+  0xff, 0x81, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x9f, 0xb6, 0xb5, 0x0f, 0xa2, 0x00, 0x00, 0x00, 0x04, 
+  0x18, 0xc6, 0x60, 0x18, 0xc6, 0xfb, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x85, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x85, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 
+  0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0x9f, 0xa1, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x33, 
+  0x18, 0xc6, 0xf7, 0x38, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x83, 0x79, 0xce, 0xff, 0x83, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x01, 0x39, 
+  0xce, 0xff, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x81, 0xb7, 0xbd, 0xff, 0x00, 0xb6, 0xb5, 0x87, 0x9f, 0x00, 0x00, 0x00, 0x02, 0xf8, 0xc5, 
+  0x18, 0x18, 0xc6, 0xd8, 0x18, 0xc6, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x86, 0x9a, 0xd6, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x81, 
+  0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x82, 0x18, 0xc6, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 
+  0xf8, 0xb6, 0xb5, 0x4c, 0x9e, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x97, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x05, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 
+  0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x85, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xc6, 0xff, 0x5a, 0xbe, 0xff, 0x82, 0x39, 0xbe, 0xff, 0x01, 0x19, 0xb6, 0xff, 0x19, 0xbe, 0xff, 0x81, 
+  0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xd7, 0x55, 0xad, 0x07, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x28, 
+  0x18, 0xc6, 0xf3, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x03, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x16, 0x39, 
+  0xce, 0xff, 0x79, 0xce, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xde, 0xff, 0x5a, 0xa6, 0xff, 0xda, 0x75, 0xff, 0xf9, 0x44, 0xff, 0x97, 0x24, 0xff, 0x37, 0x04, 0xff, 0xf6, 0x03, 0xff, 
+  0x16, 0x04, 0xff, 0x57, 0x14, 0xff, 0xd8, 0x34, 0xff, 0x59, 0x55, 0xff, 0xd9, 0x85, 0xff, 0xf8, 0xbd, 0xff, 0xf7, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 
+  0xff, 0x96, 0xb5, 0x80, 0x9c, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x9c, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x03, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 
+  0x39, 0xce, 0xff, 0x84, 0x59, 0xce, 0xff, 0x05, 0xdb, 0xde, 0xff, 0x9b, 0xc6, 0xff, 0x9a, 0x5d, 0xff, 0x77, 0x04, 0xff, 0xb5, 0x03, 0xff, 0x75, 0x0b, 0xff, 0x84, 0x95, 0x0b, 0xff, 0x81, 0x75, 
+  0x0b, 0xff, 0x03, 0x17, 0x04, 0xff, 0x19, 0x35, 0xff, 0xd8, 0x9d, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xeb, 0x96, 0xb5, 0x14, 0x9a, 0x00, 0x00, 
+  0x00, 0x08, 0x18, 0xc6, 0x1b, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 
+  0xff, 0x82, 0x79, 0xce, 0xff, 0x03, 0x59, 0xd6, 0xff, 0x5b, 0x9e, 0xff, 0xb8, 0x2c, 0xff, 0xb5, 0x03, 0xff, 0x8a, 0x95, 0x0b, 0xff, 0x02, 0xb5, 0x03, 0xff, 0x57, 0x14, 0xff, 0x79, 0x65, 0xff, 
+  0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x5c, 0x9a, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x70, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 
+  0x79, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x02, 0x79, 0xce, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x02, 0x79, 0xd6, 0xff, 0xf9, 0x8d, 0xff, 0x57, 0x04, 0xff, 0x8e, 
+  0x95, 0x0b, 0xff, 0x08, 0xf6, 0x03, 0xff, 0x58, 0x55, 0xff, 0xd7, 0xb5, 0xff, 0xb7, 0xad, 0xff, 0xb7, 0xa5, 0xff, 0x97, 0x9d, 0xbf, 0x9b, 0x05, 0x23, 0x9b, 0x25, 0x1f, 0x9a, 0x25, 0x0c, 0x96, 
+  0x00, 0x00, 0x00, 0x06, 0xd7, 0xbd, 0x03, 0x18, 0xc6, 0xcb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x00, 0xba, 0xd6, 
+  0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x01, 0x19, 0x9e, 0xff, 0x57, 0x1c, 0xff, 0x90, 0xb5, 0x0b, 0xff, 0x09, 0xd6, 0x03, 0xff, 0xb8, 0x2c, 0xff, 0x97, 0x1c, 0xff, 0x37, 0x04, 
+  0xff, 0x36, 0x04, 0xff, 0x57, 0x14, 0xfc, 0x98, 0x1c, 0xef, 0xf9, 0x1c, 0xdb, 0x7a, 0x25, 0x80, 0x9a, 0x25, 0x18, 0x94, 0x00, 0x00, 0x00, 0x06, 0x18, 0xc6, 0x13, 0x18, 0xc6, 0xe4, 0x38, 0xc6, 
+  0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x06, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xc6, 
+  0xff, 0xf8, 0x24, 0xff, 0xb5, 0x03, 0xff, 0x98, 0xb5, 0x0b, 0xff, 0x03, 0x36, 0x14, 0xff, 0xf9, 0x1c, 0xe8, 0x5a, 0x25, 0x57, 0xbb, 0x25, 0x04, 0x92, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x20, 
+  0x18, 0xc6, 0xf0, 0x38, 0xc6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x02, 0xfb, 0xde, 0xff, 0xda, 0x7d, 
+  0xff, 0xb5, 0x03, 0xff, 0x9a, 0xb5, 0x0b, 0xff, 0x03, 0xd5, 0x0b, 0xff, 0x57, 0x14, 0xfb, 0x59, 0x25, 0x90, 0x1c, 0x36, 0x04, 0x91, 0x00, 0x00, 0x00, 0x09, 0x18, 0xc6, 0x2b, 0x18, 0xc6, 0xfb, 
+  0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x01, 0xbb, 0xce, 0xff, 
+  0x77, 0x2c, 0xff, 0x9c, 0xd5, 0x0b, 0xff, 0x02, 0xb5, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x39, 0x25, 0x7c, 0x91, 0x00, 0x00, 0x00, 0x0d, 0x18, 0xc6, 0x30, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 
+  0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x5a, 0xae, 0xff, 0xf6, 0x03, 0xff, 
+  0x9e, 0xd6, 0x0b, 0xff, 0x01, 0x57, 0x14, 0xff, 0x9b, 0x25, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x0d, 0x18, 0xc6, 0x33, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 
+  0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xbe, 0xff, 0xfa, 0x7d, 0xff, 0x9a, 0x35, 0xff, 0x59, 0x05, 0xff, 0x98, 0x04, 0xff, 0xd5, 0x0b, 0xff, 0x86, 0xd6, 0x0b, 0xff, 0x84, 0xd6, 
+  0x03, 0xff, 0x92, 0xd6, 0x0b, 0xff, 0x02, 0xd5, 0x0b, 0xff, 0xb8, 0x1c, 0xd3, 0xbb, 0x2d, 0x0c, 0x8f, 0x00, 0x00, 0x00, 0x09, 0x18, 0xc6, 0x2f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 
+  0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xce, 0xff, 0xda, 0x75, 0xff, 0xd8, 0x24, 0xff, 0x16, 0x04, 0xff, 0x89, 0xf6, 0x0b, 0xff, 0x01, 0xf6, 0x03, 0xff, 0xb2, 0x74, 0xff, 0x81, 0x2f, 
+  0xb5, 0xff, 0x02, 0x30, 0xb5, 0xff, 0x2f, 0xbd, 0xff, 0x34, 0x24, 0xff, 0x92, 0xf6, 0x0b, 0xff, 0x01, 0x16, 0x14, 0xfb, 0x39, 0x25, 0x3f, 0x8f, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x27, 0x18, 
+  0xc6, 0xf8, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x99, 0x55, 0xff, 0x36, 0x04, 0xff, 0x8b, 0xf6, 0x0b, 0xff, 0x01, 0x35, 0x34, 0xff, 0xa8, 0xe4, 0xff, 0x81, 0x44, 
+  0xf4, 0xff, 0x02, 0x43, 0xf4, 0xff, 0x2a, 0xbc, 0xff, 0xf6, 0x03, 0xff, 0x93, 0xf6, 0x0b, 0xff, 0x00, 0xf8, 0x1c, 0x93, 0x8f, 0x00, 0x00, 0x00, 0x06, 0xf7, 0xbd, 0x1c, 0x18, 0xc6, 0xec, 0x18, 
+  0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xc6, 0xff, 0xb9, 0x6d, 0xff, 0x16, 0x04, 0xff, 0x8b, 0x16, 0x0c, 0xff, 0x02, 0xf6, 0x03, 0xff, 0xce, 0xa4, 0xff, 0x23, 0xec, 0xff, 0x81, 0x04, 0xec, 0xff, 
+  0x01, 0x06, 0xe4, 0xff, 0x14, 0x3c, 0xff, 0x85, 0x16, 0x0c, 0xff, 0x06, 0x97, 0x14, 0xff, 0xd8, 0x1c, 0xff, 0x19, 0x1d, 0xff, 0x19, 0x25, 0xff, 0xf9, 0x1c, 0xff, 0xb8, 0x1c, 0xff, 0x36, 0x14, 
+  0xff, 0x87, 0x16, 0x0c, 0xff, 0x00, 0xb7, 0x1c, 0xd3, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xf7, 0xbd, 0x0c, 0x18, 0xc6, 0xe0, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x19, 0xb6, 0xff, 0x97, 0x1c, 0xff, 
+  0x8b, 0x16, 0x0c, 0xff, 0x02, 0x16, 0x04, 0xff, 0x93, 0x5c, 0xff, 0x60, 0xfc, 0xff, 0x81, 0x04, 0xec, 0xff, 0x02, 0x02, 0xf4, 0xff, 0x0f, 0x8c, 0xff, 0x16, 0x04, 0xff, 0x82, 0x16, 0x0c, 0xff, 
+  0x08, 0x36, 0x14, 0xff, 0x98, 0x1c, 0xff, 0xd8, 0x1c, 0xff, 0x57, 0x14, 0xff, 0xd6, 0x13, 0xff, 0x95, 0x0b, 0xff, 0x75, 0x0b, 0xff, 0xd6, 0x0b, 0xff, 0x37, 0x14, 0xff, 0x81, 0xb8, 0x1c, 0xff, 
+  0x00, 0x57, 0x14, 0xff, 0x85, 0x16, 0x0c, 0xff, 0x00, 0x57, 0x14, 0xfc, 0x90, 0x00, 0x00, 0x00, 0x04, 0xf8, 0xc5, 0xa8, 0x18, 0xc6, 0xff, 0x18, 0xce, 0xff, 0x99, 0x75, 0xff, 0x16, 0x04, 0xff, 
+  0x8b, 0x36, 0x0c, 0xff, 0x0c, 0x55, 0x24, 0xff, 0xaa, 0xdc, 0xff, 0x04, 0xec, 0xff, 0x24, 0xec, 0xff, 0x23, 0xec, 0xff, 0x2a, 0xb4, 0xff, 0x17, 0x04, 0xff, 0x16, 0x04, 0xff, 0x36, 0x0c, 0xff, 
+  0x16, 0x0c, 0xff, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0xf6, 0x13, 0xff, 0x87, 0x95, 0x0b, 0xff, 0x04, 0xb6, 0x0b, 0xff, 0x77, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x16, 0x0c, 0xff, 0x36, 0x0c, 0xff, 
+  0x82, 0x16, 0x0c, 0xff, 0x00, 0x36, 0x0c, 0xff, 0x90, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xbd, 0x54, 0xf8, 0xc5, 0xff, 0x18, 0xce, 0xff, 0xf8, 0x2c, 0xff, 0x8b, 0x36, 0x0c, 0xff, 0x02, 0x36, 0x04, 
+  0xff, 0xd1, 0x94, 0xff, 0x43, 0xec, 0xff, 0x81, 0x44, 0xec, 0xff, 0x06, 0x23, 0xec, 0xff, 0xaa, 0xc4, 0xff, 0x2d, 0xb5, 0xff, 0xb2, 0x64, 0xff, 0x36, 0x04, 0xff, 0x97, 0x14, 0xff, 0x98, 0x1c, 
+  0xff, 0x8b, 0x95, 0x0b, 0xff, 0x02, 0x37, 0x14, 0xff, 0xb8, 0x1c, 0xff, 0x77, 0x14, 0xff, 0x82, 0x97, 0x14, 0xff, 0x00, 0x77, 0x14, 0xf7, 0x91, 0x00, 0x00, 0x00, 0x02, 0xf8, 0xc5, 0xe0, 0x18, 
+  0xc6, 0xff, 0x77, 0x04, 0xff, 0x8b, 0x36, 0x0c, 0xff, 0x02, 0xb4, 0x24, 0xff, 0xc4, 0xf4, 0xff, 0x43, 0xec, 0xff, 0x82, 0x44, 0xec, 0xff, 0x04, 0x64, 0xf4, 0xff, 0x69, 0xcc, 0xff, 0x36, 0x1c, 
+  0xff, 0x77, 0x14, 0xff, 0x57, 0x14, 0xff, 0x8d, 0xb5, 0x0b, 0xff, 0x01, 0xf6, 0x13, 0xff, 0x57, 0x14, 0xff, 0x81, 0x16, 0x14, 0xff, 0x03, 0x37, 0x14, 0xff, 0x77, 0x14, 0xfc, 0xf9, 0x1c, 0xd7, 
+  0x9a, 0x25, 0x68, 0x8f, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xbd, 0x74, 0x18, 0xc6, 0xff, 0x36, 0x04, 0xff, 0x8b, 0x56, 0x0c, 0xff, 0x01, 0x2b, 0xdd, 0xff, 0x63, 0xec, 0xff, 0x83, 0x83, 0xec, 0xff, 
+  0x04, 0x86, 0xdc, 0xff, 0x55, 0x04, 0xff, 0x56, 0x14, 0xff, 0xb8, 0x24, 0xff, 0x34, 0x5c, 0xff, 0x82, 0x34, 0x64, 0xff, 0x00, 0xf5, 0x3b, 0xff, 0x90, 0xb5, 0x0b, 0xff, 0x02, 0x57, 0x14, 0xff, 
+  0x39, 0x25, 0xb3, 0x9a, 0x25, 0x18, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xbd, 0x17, 0xf7, 0xc5, 0xec, 0xb7, 0x1c, 0xff, 0x89, 0x56, 0x0c, 0xff, 0x0b, 0x56, 0x04, 0xff, 0xf1, 0x8c, 0xff, 0xc0, 
+  0xfc, 0xff, 0xa0, 0xf4, 0xff, 0xa1, 0xf4, 0xff, 0xa3, 0xf4, 0xff, 0xa3, 0xec, 0xff, 0xa4, 0xe4, 0xff, 0x74, 0x44, 0xff, 0x56, 0x0c, 0xff, 0x98, 0x0c, 0xff, 0xb2, 0x7c, 0xff, 0x82, 0xa7, 0xec, 
+  0xff, 0x02, 0xa7, 0xe4, 0xff, 0x13, 0x5c, 0xff, 0xb5, 0x0b, 0xff, 0x8f, 0xd5, 0x0b, 0xff, 0x03, 0xb5, 0x0b, 0xff, 0xf6, 0x13, 0xff, 0xf9, 0x1c, 0xc7, 0xdb, 0x2d, 0x0f, 0x8d, 0x00, 0x00, 0x00, 
+  0x02, 0xf7, 0xc5, 0x67, 0x57, 0x6d, 0xff, 0x56, 0x04, 0xff, 0x89, 0x56, 0x14, 0xff, 0x82, 0x57, 0x04, 0xff, 0x07, 0xcc, 0xac, 0xff, 0xe3, 0xf4, 0xff, 0xe0, 0xf4, 0xff, 0x90, 0x74, 0xff, 0x77, 
+  0x04, 0xff, 0x97, 0x14, 0xff, 0xd6, 0x1c, 0xff, 0xc4, 0xec, 0xff, 0x81, 0x04, 0xec, 0xff, 0x02, 0x03, 0xec, 0xff, 0x0c, 0xbc, 0xff, 0xd5, 0x03, 0xff, 0x92, 0xd5, 0x0b, 0xff, 0x02, 0xf6, 0x0b, 
+  0xff, 0x39, 0x25, 0x9f, 0x9f, 0x3e, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x97, 0x9d, 0xac, 0x76, 0x24, 0xff, 0x8b, 0x76, 0x14, 0xff, 0x08, 0xb5, 0x54, 0xff, 0x45, 0xed, 0xff, 0x00, 0xf5, 0xff, 
+  0xf1, 0x94, 0xff, 0x39, 0x05, 0xff, 0xf8, 0x1c, 0xff, 0xb7, 0x04, 0xff, 0xed, 0xcc, 0xff, 0x03, 0xec, 0xff, 0x81, 0x04, 0xec, 0xff, 0x01, 0x00, 0xd4, 0xff, 0xf5, 0x03, 0xff, 0x93, 0xf6, 0x0b, 
+  0xff, 0x02, 0xd6, 0x0b, 0xff, 0x36, 0x14, 0xf4, 0x59, 0x25, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xd8, 0x85, 0x13, 0xf7, 0x4c, 0xe3, 0x76, 0x04, 0xff, 0x89, 0x76, 0x14, 0xff, 0x08, 0x57, 0x04, 
+  0xff, 0x6d, 0xad, 0xff, 0x40, 0xfd, 0xff, 0x2c, 0xc5, 0xff, 0xf8, 0x04, 0xff, 0x16, 0x0c, 0xff, 0xd6, 0x03, 0xff, 0x73, 0x74, 0xff, 0x44, 0xec, 0xff, 0x81, 0x04, 0xec, 0xff, 0x02, 0x03, 0xec, 
+  0xff, 0x12, 0x64, 0xff, 0xf6, 0x03, 0xff, 0x95, 0xf6, 0x0b, 0xff, 0x00, 0xf9, 0x1c, 0x84, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xad, 0x2f, 0xd6, 0x44, 0xf7, 0x76, 0x04, 0xff, 0x87, 0x76, 0x14, 
+  0xff, 0x04, 0x77, 0x0c, 0xff, 0xf4, 0x2c, 0xff, 0xa0, 0xfd, 0xff, 0x66, 0xcd, 0xff, 0x97, 0x04, 0xff, 0x81, 0xf6, 0x0b, 0xff, 0x02, 0x15, 0x04, 0xff, 0xe7, 0xe4, 0xff, 0x23, 0xec, 0xff, 0x81, 
+  0x24, 0xec, 0xff, 0x03, 0x47, 0xdc, 0xff, 0xd0, 0x7c, 0xff, 0xd1, 0x84, 0xff, 0x15, 0x1c, 0xff, 0x93, 0x16, 0x0c, 0xff, 0x01, 0xf6, 0x0b, 0xff, 0xb8, 0x1c, 0xcf, 0x8f, 0x00, 0x00, 0x00, 0x04, 
+  0xb7, 0xad, 0x2f, 0xf7, 0x4c, 0xe3, 0x96, 0x1c, 0xff, 0x76, 0x04, 0xff, 0x76, 0x0c, 0xff, 0x84, 0x76, 0x14, 0xff, 0x08, 0x96, 0x04, 0xff, 0xeb, 0xd5, 0xff, 0x85, 0xe5, 0xff, 0xd6, 0x44, 0xff, 
+  0xf6, 0x13, 0xff, 0x16, 0x0c, 0xff, 0x16, 0x04, 0xff, 0x0d, 0xbd, 0xff, 0x22, 0xec, 0xff, 0x82, 0x44, 0xec, 0xff, 0x03, 0x64, 0xec, 0xff, 0xc2, 0xf4, 0xff, 0x70, 0x8c, 0xff, 0x16, 0x04, 0xff, 
+  0x94, 0x16, 0x0c, 0xff, 0x00, 0x57, 0x14, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x03, 0x97, 0x7d, 0x13, 0x97, 0x9d, 0xac, 0x17, 0x65, 0xff, 0xb7, 0x14, 0xff, 0x84, 0x77, 0x04, 0xff, 0x07, 0xf4, 0x5c, 
+  0xff, 0x00, 0xf6, 0xff, 0xd3, 0x44, 0xff, 0x56, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x14, 0xff, 0x74, 0x64, 0xff, 0xa5, 0xec, 0xff, 0x83, 0x63, 0xec, 0xff, 0x02, 0x61, 0xec, 0xff, 0x4f, 0x94, 
+  0xff, 0x16, 0x04, 0xff, 0x96, 0x36, 0x0c, 0xff, 0x92, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xc5, 0x67, 0xd7, 0xbd, 0xec, 0x81, 0xd7, 0xc5, 0xff, 0x81, 0xf7, 0xc5, 0xff, 0x09, 0xf8, 0xc5, 0xff, 0x69, 
+  0xf6, 0xff, 0xf0, 0xd5, 0xff, 0xb8, 0xad, 0xff, 0x36, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x36, 0x04, 0xff, 0x68, 0xd5, 0xff, 0xa0, 0xf4, 0xff, 0xa1, 0xf4, 0xff, 0x81, 0xa3, 0xec, 0xff, 0x02, 0xa3, 
+  0xf4, 0xff, 0x8a, 0xc4, 0xff, 0x36, 0x04, 0xff, 0x96, 0x36, 0x0c, 0xff, 0x00, 0x56, 0x14, 0xe0, 0x93, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xbd, 0x17, 0xb7, 0xbd, 0x74, 0xb7, 0xbd, 0xe0, 0x81, 0xb7, 
+  0xbd, 0xff, 0x0e, 0x51, 0xd6, 0xff, 0x2a, 0xe6, 0xff, 0xd7, 0xbd, 0xff, 0x97, 0xad, 0xff, 0x36, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x56, 0x1c, 0xff, 0x74, 0x7c, 0xff, 0x54, 0x74, 0xff, 0x73, 0x8c, 
+  0xff, 0xc3, 0xec, 0xff, 0xc3, 0xf4, 0xff, 0xc2, 0xcc, 0xff, 0x56, 0x04, 0xff, 0x36, 0x0c, 0xff, 0x95, 0x56, 0x0c, 0xff, 0x01, 0x36, 0x0c, 0xff, 0x97, 0x14, 0xa4, 0x96, 0x00, 0x00, 0x00, 0x06, 
+  0xb7, 0xbd, 0x54, 0xd6, 0xbd, 0xac, 0x6a, 0xee, 0xe8, 0xb7, 0xb5, 0xec, 0xb7, 0xbd, 0xf8, 0x76, 0xa5, 0xff, 0x56, 0x04, 0xff, 0x82, 0x56, 0x0c, 0xff, 0x05, 0x37, 0x04, 0xff, 0x2e, 0xa5, 0xff, 
+  0x02, 0xf5, 0xff, 0xe4, 0xe4, 0xff, 0x75, 0x4c, 0xff, 0x56, 0x14, 0xff, 0x96, 0x56, 0x0c, 0xff, 0x01, 0x56, 0x0c, 0xfc, 0xb7, 0x14, 0x48, 0x97, 0x00, 0x00, 0x00, 0x05, 0x40, 0xff, 0x2f, 0x6c, 
+  0xe6, 0x23, 0xb7, 0xb5, 0x1b, 0xb6, 0xb5, 0x27, 0x37, 0x8d, 0x48, 0x76, 0x0c, 0xf4, 0x81, 0x56, 0x14, 0xff, 0x05, 0x56, 0x0c, 0xff, 0xd4, 0x04, 0xff, 0x80, 0xf5, 0xff, 0x20, 0xfd, 0xff, 0x92, 
+  0x5c, 0xff, 0x56, 0x04, 0xff, 0x97, 0x56, 0x14, 0xff, 0x01, 0x76, 0x14, 0xcf, 0xf8, 0x1c, 0x0b, 0x97, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x14, 0x82, 0x00, 0x00, 0x00, 0x01, 0xb9, 0x25, 0x04, 
+  0x76, 0x14, 0xb7, 0x81, 0x76, 0x14, 0xff, 0x04, 0x76, 0x04, 0xff, 0xab, 0xcd, 0xff, 0x60, 0xf5, 0xff, 0xcf, 0x7c, 0xff, 0x57, 0x04, 0xff, 0x97, 0x76, 0x14, 0xff, 0x01, 0x76, 0x14, 0xf7, 0xb7, 
+  0x14, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x06, 0x19, 0x15, 0x1b, 0x76, 0x14, 0xe3, 0x76, 0x14, 0xff, 0xd4, 0x64, 0xff, 0xc3, 0xf5, 0xff, 0x2a, 0xbd, 0xff, 0x76, 0x04, 0xff, 0x97, 0x76, 0x14, 0xff, 
+  0x01, 0x76, 0x14, 0xef, 0x97, 0x14, 0x44, 0x9f, 0x00, 0x00, 0x00, 0x04, 0xd8, 0x1c, 0x1c, 0x57, 0x04, 0xc8, 0xea, 0xbd, 0xff, 0x87, 0xd5, 0xff, 0x76, 0x04, 0xff, 0x96, 0x76, 0x14, 0xff, 0x02, 
+  0x76, 0x14, 0xf7, 0x76, 0x14, 0xc0, 0xb7, 0x14, 0x2b, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xcb, 0xe6, 0x54, 0x03, 0xf6, 0xff, 0xb4, 0x44, 0xc0, 0x97, 0x14, 0xf0, 0x97, 0x14, 0xfc, 0x93, 0x97, 0x14, 
+  0xfb, 0x03, 0x97, 0x14, 0xdb, 0x97, 0x14, 0xa0, 0xb7, 0x14, 0x47, 0xd8, 0x1c, 0x07, 0xa1, 0x00, 0x00, 0x00, 0x02, 0x87, 0xff, 0x07, 0x84, 0xfe, 0xd7, 0x20, 0xfe, 0x3f, 0x8b, 0x00, 0x00, 0x00, 
+  0x00, 0x7f, 0x47, 0x07, 0xaf, 0x00, 0x00, 0x00, 0x01, 0xe4, 0xfe, 0x40, 0xa3, 0xfe, 0x54, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xfb, 0x2d, 0x0b, 0xb8, 0x1c, 0xdb, 0x5d, 0x36, 0x10, 0xae, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0xff, 0x78, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xf9, 0x24, 0x4f, 0xd5, 0x0b, 0xff, 0xf9, 0x1c, 0xb7, 0xad, 0x00, 0x00, 0x00, 0x01, 0x44, 0xff, 0x20, 0xc0, 0xfe, 0x07, 0x8c, 0x00, 
+  0x00, 0x00, 0x03, 0xb8, 0x1c, 0xec, 0xd5, 0x0b, 0xff, 0x16, 0x14, 0xf4, 0x59, 0x25, 0x1f, 0xba, 0x00, 0x00, 0x00, 0x01, 0xba, 0x2d, 0x5f, 0xf6, 0x0b, 0xff, 0x81, 0x16, 0x0c, 0xff, 0x00, 0x19, 
+  0x25, 0x7f, 0x84, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x36, 0x08, 0x19, 0x1d, 0x94, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x1c, 0xbf, 0x82, 0x36, 0x0c, 0xff, 0x00, 0xb8, 0x1c, 0xdf, 0x84, 0x00, 0x00, 
+  0x00, 0x02, 0xf9, 0x1c, 0xa4, 0xf6, 0x13, 0xf8, 0x5a, 0x25, 0x1c, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0x97, 0x82, 0x56, 0x0c, 0xff, 0x00, 0x97, 0x14, 0xb7, 0x83, 0x00, 0x00, 0x00, 0x03, 
+  0x7a, 0x25, 0x1c, 0x16, 0x14, 0xef, 0xd6, 0x0b, 0xff, 0xf8, 0x1c, 0x94, 0xb2, 0x00, 0x00, 0x00, 0x04, 0x7a, 0x25, 0x03, 0x76, 0x14, 0x9b, 0x76, 0x14, 0xff, 0x77, 0x14, 0xc3, 0x97, 0x14, 0x18, 
+  0x83, 0x00, 0x00, 0x00, 0x04, 0x19, 0x25, 0x78, 0x16, 0x0c, 0xff, 0xf6, 0x0b, 0xff, 0x57, 0x14, 0xff, 0x7d, 0x3e, 0x14, 0xba, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x1c, 0xec, 0x82, 0x16, 0x0c, 0xff, 
+  0x00, 0x59, 0x25, 0x83, 0xba, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0xff, 0x82, 0x56, 0x0c, 0xff, 0x00, 0xb7, 0x14, 0x94, 0xba, 0x00, 0x00, 0x00, 0x04, 0x97, 0x14, 0x5f, 0x76, 0x14, 0xf8, 0x76, 
+  0x14, 0xff, 0x76, 0x14, 0xe8, 0x9a, 0x2d, 0x0c, 0xbb, 0x00, 0x00, 0x00, 0x02, 0x76, 0x14, 0x23, 0x76, 0x14, 0x33, 0x97, 0x0c, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x8d, 0x00, 
+  0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x00, 0xc6, 0x18, 0x00, 0xbd, 0xd7, 0x38, 0xbd, 0xd7, 0x6f, 0xbd, 0xf7, 0x9b, 0xbd, 0xf7, 0xb8, 0xbd, 0xd7, 0xcb, 0xbd, 0xd7, 0xc0, 0xbd, 0xd7, 0xa7, 0xbd, 0xd7, 0x7f, 0xbd, 0xd7, 0x4c, 0xbd, 0xf7, 0x0f, 0xbd, 0xd7, 0x00, 0xbd, 0xb7, 0x00, 0xbd, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xf4, 0x00, 0xf7, 0x9e, 0x00, 0xc6, 0x18, 0x00, 0xbd, 0xf7, 0x0c, 0xc5, 0xf8, 0x33, 0xc5, 0xf8, 0x9b, 0xc5, 0xf8, 0xeb, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xb7, 0xbd, 0xb7, 0x5c, 0xbd, 0xb7, 0x14, 0xc6, 0x38, 0x00, 0xb5, 0xb6, 0x00, 0xad, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xce, 0x39, 0x00, 0xc5, 0xf8, 0x57, 0xc5, 0xf8, 0xd3, 0xc6, 0x18, 0xf8, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xeb, 0xbd, 0xb7, 0x80, 0xb5, 0x96, 0x07, 0xb5, 0x96, 0x00, 0xb5, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0xc5, 0xf8, 0x00, 0xc5, 0xf8, 0x23, 0xc6, 0x18, 0xab, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xd7, 0xb5, 0xb6, 0x4c, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xbd, 0xd7, 0x00, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xf0, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xf8, 0xb5, 0xb6, 0x87, 0xef, 0x5d, 0x00, 0xbd, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xad, 0x35, 0x00, 0xc6, 0x18, 0x5b, 0xc6, 0x18, 0xfb, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x9f, 0xb5, 0xb6, 0x0f, 0xb5, 0x96, 0x00, 0xb5, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x31, 0x00, 0xc6, 0x18, 0x60, 0xc6, 0x18, 0xfb, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x9f, 0x00, 0x00, 0x00, 0xad, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x33, 0xc6, 0x18, 0xf7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x87, 0xc6, 0x18, 0x00, 0xb5, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x00, 0xc5, 0xf8, 0x18, 0xc6, 0x18, 0xd8, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf8, 0xb5, 0xb6, 0x4c, 0xb5, 0x96, 0x00, 0xad, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0x84, 0x30, 0x00, 0xc6, 0x18, 0x97, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xc6, 0x7a, 0xff, 0xbe, 0x5a, 0xff, 0xbe, 0x39, 0xff, 0xbe, 0x39, 0xff, 0xbe, 0x39, 0xff, 0xb6, 0x19, 0xff, 0xbe, 0x19, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xd7, 0xad, 0x55, 0x07, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xc6, 0x18, 0x28, 0xc6, 0x18, 0xf3, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xba, 0xff, 0xa6, 0x5a, 0xff, 0x75, 0xda, 0xff, 0x44, 0xf9, 0xff, 0x24, 0x97, 0xff, 0x04, 0x37, 0xff, 0x03, 0xf6, 0xff, 0x04, 0x16, 0xff, 0x14, 0x57, 0xff, 0x34, 0xd8, 0xff, 0x55, 0x59, 0xff, 0x85, 0xd9, 0xff, 0xbd, 0xf8, 0xff, 0xc5, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x80, 0xbd, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x9c, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xde, 0xdb, 0xff, 0xc6, 0x9b, 0xff, 0x5d, 0x9a, 0xff, 0x04, 0x77, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0x75, 0xff, 0x04, 0x17, 0xff, 0x35, 0x19, 0xff, 0x9d, 0xd8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xeb, 0xb5, 0x96, 0x14, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x1b, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x59, 0xff, 0x9e, 0x5b, 0xff, 0x2c, 0xb8, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x03, 0xb5, 0xff, 0x14, 0x57, 0xff, 0x65, 0x79, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x5c, 0xb5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x00, 0xc6, 0x18, 0x70, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x79, 0xff, 0x8d, 0xf9, 0xff, 0x04, 0x57, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x03, 0xf6, 0xff, 0x55, 0x58, 0xff, 0xb5, 0xd7, 0xff, 0xad, 0xb7, 0xff, 0xa5, 0xb7, 0xff, 0x9d, 0x97, 0xbf, 0x05, 0x9b, 0x23, 0x25, 0x9b, 0x1f, 0x25, 0x9a, 0x0c, 0x1d, 0x5a, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x03, 0xc6, 0x18, 0xcb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0x9e, 0x19, 0xff, 0x1c, 0x57, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x03, 0xd6, 0xff, 0x2c, 0xb8, 0xff, 0x1c, 0x97, 0xff, 0x04, 0x37, 0xff, 0x04, 0x36, 0xff, 0x14, 0x57, 0xfc, 0x1c, 0x98, 0xef, 0x1c, 0xf9, 0xdb, 0x25, 0x7a, 0x80, 0x25, 0x9a, 0x18, 0x25, 0x7a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x13, 0xc6, 0x18, 0xe4, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x7a, 0xff, 0x24, 0xf8, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x36, 0xff, 0x1c, 0xf9, 0xe8, 0x25, 0x5a, 0x57, 0x25, 0xbb, 0x04, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x20, 0xc6, 0x18, 0xf0, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0x7d, 0xda, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x14, 0x57, 0xfb, 0x25, 0x59, 0x90, 0x36, 0x1c, 0x04, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x2b, 0xc6, 0x18, 0xfb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xce, 0xbb, 0xff, 0x2c, 0x77, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x37, 0xff, 0x25, 0x39, 0x7c, 0x15, 0x58, 0x00, 0x2d, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x30, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xae, 0x5a, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x57, 0xff, 0x25, 0x9b, 0x4b, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x33, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xbe, 0x7a, 0xff, 0x7d, 0xfa, 0xff, 0x35, 0x9a, 0xff, 0x05, 0x59, 0xff, 0x04, 0x98, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x03, 0xd6, 0xff, 0x03, 0xd6, 0xff, 0x03, 0xd6, 0xff, 0x03, 0xd6, 0xff, 0x03, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd6, 0xff, 0x0b, 0xd5, 0xff, 0x1c, 0xb8, 0xd3, 0x2d, 0xbb, 0x0c, 0x2d, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x2f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x7a, 0xff, 0x75, 0xda, 0xff, 0x24, 0xd8, 0xff, 0x04, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x03, 0xf6, 0xff, 0x74, 0xb2, 0xff, 0xb5, 0x2f, 0xff, 0xb5, 0x2f, 0xff, 0xb5, 0x30, 0xff, 0xbd, 0x2f, 0xff, 0x24, 0x34, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x16, 0xfb, 0x25, 0x39, 0x3f, 0x2d, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x27, 0xc6, 0x18, 0xf8, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0x55, 0x99, 0xff, 0x04, 0x36, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x34, 0x35, 0xff, 0xe4, 0xa8, 0xff, 0xf4, 0x44, 0xff, 0xf4, 0x44, 0xff, 0xf4, 0x43, 0xff, 0xbc, 0x2a, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xf8, 0x93, 0x25, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x1c, 0xc6, 0x18, 0xec, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x39, 0xff, 0x6d, 0xb9, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x03, 0xf6, 0xff, 0xa4, 0xce, 0xff, 0xec, 0x23, 0xff, 0xec, 0x04, 0xff, 0xec, 0x04, 0xff, 0xe4, 0x06, 0xff, 0x3c, 0x14, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xd8, 0xff, 0x1d, 0x19, 0xff, 0x25, 0x19, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x1c, 0xb7, 0xd3, 0x1c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x0c, 0xc6, 0x18, 0xe0, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xb6, 0x19, 0xff, 0x1c, 0x97, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x04, 0x16, 0xff, 0x5c, 0x93, 0xff, 0xfc, 0x60, 0xff, 0xec, 0x04, 0xff, 0xec, 0x04, 0xff, 0xf4, 0x02, 0xff, 0x8c, 0x0f, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x36, 0xff, 0x1c, 0x98, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x57, 0xff, 0x13, 0xd6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x37, 0xff, 0x1c, 0xb8, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x57, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x57, 0xfc, 0x14, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x00, 0xc5, 0xf8, 0xa8, 0xc6, 0x18, 0xff, 0xce, 0x18, 0xff, 0x75, 0x99, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x24, 0x55, 0xff, 0xdc, 0xaa, 0xff, 0xec, 0x04, 0xff, 0xec, 0x24, 0xff, 0xec, 0x23, 0xff, 0xb4, 0x2a, 0xff, 0x04, 0x17, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0xff, 0x13, 0xf6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0xb6, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xf7, 0x54, 0xc5, 0xf8, 0xff, 0xce, 0x18, 0xff, 0x2c, 0xf8, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x04, 0x36, 0xff, 0x94, 0xd1, 0xff, 0xec, 0x43, 0xff, 0xec, 0x44, 0xff, 0xec, 0x44, 0xff, 0xec, 0x23, 0xff, 0xc4, 0xaa, 0xff, 0xb5, 0x2d, 0xff, 0x64, 0xb2, 0xff, 0x04, 0x36, 0xff, 0x14, 0x97, 0xff, 0x1c, 0x98, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x95, 0xff, 0x14, 0x37, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x77, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x97, 0xff, 0x14, 0x77, 0xf7, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x25, 0x9a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xc5, 0xf8, 0x00, 0xc5, 0xf8, 0xe0, 0xc6, 0x18, 0xff, 0x04, 0x77, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x24, 0xb4, 0xff, 0xf4, 0xc4, 0xff, 0xec, 0x43, 0xff, 0xec, 0x44, 0xff, 0xec, 0x44, 0xff, 0xec, 0x44, 0xff, 0xf4, 0x64, 0xff, 0xcc, 0x69, 0xff, 0x1c, 0x36, 0xff, 0x14, 0x77, 0xff, 0x14, 0x57, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x14, 0x57, 0xff, 0x14, 0x16, 0xff, 0x14, 0x16, 0xff, 0x14, 0x37, 0xff, 0x14, 0x77, 0xfc, 0x1c, 0xf9, 0xd7, 0x25, 0x9a, 0x68, 0x04, 0x38, 0x00, 0x25, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xd7, 0x74, 0xc6, 0x18, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0xdd, 0x2b, 0xff, 0xec, 0x63, 0xff, 0xec, 0x83, 0xff, 0xec, 0x83, 0xff, 0xec, 0x83, 0xff, 0xec, 0x83, 0xff, 0xdc, 0x86, 0xff, 0x04, 0x55, 0xff, 0x14, 0x56, 0xff, 0x24, 0xb8, 0xff, 0x5c, 0x34, 0xff, 0x64, 0x34, 0xff, 0x64, 0x34, 0xff, 0x64, 0x34, 0xff, 0x3b, 0xf5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xb5, 0xff, 0x14, 0x57, 0xff, 0x25, 0x39, 0xb3, 0x25, 0x9a, 0x18, 0x2d, 0x9a, 0x00, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x00, 0xbd, 0xd7, 0x17, 0xc5, 0xf7, 0xec, 0x1c, 0xb7, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x04, 0x56, 0xff, 0x8c, 0xf1, 0xff, 0xfc, 0xc0, 0xff, 0xf4, 0xa0, 0xff, 0xf4, 0xa1, 0xff, 0xf4, 0xa3, 0xff, 0xec, 0xa3, 0xff, 0xe4, 0xa4, 0xff, 0x44, 0x74, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x98, 0xff, 0x7c, 0xb2, 0xff, 0xec, 0xa7, 0xff, 0xec, 0xa7, 0xff, 0xec, 0xa7, 0xff, 0xe4, 0xa7, 0xff, 0x5c, 0x13, 0xff, 0x0b, 0xb5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xf9, 0xc7, 0x2d, 0xdb, 0x0f, 0x2d, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x00, 0xc5, 0xf7, 0x67, 0x6d, 0x57, 0xff, 0x04, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x04, 0x57, 0xff, 0x04, 0x57, 0xff, 0x04, 0x57, 0xff, 0xac, 0xcc, 0xff, 0xf4, 0xe3, 0xff, 0xf4, 0xe0, 0xff, 0x74, 0x90, 0xff, 0x04, 0x77, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xd6, 0xff, 0xec, 0xc4, 0xff, 0xec, 0x04, 0xff, 0xec, 0x04, 0xff, 0xec, 0x03, 0xff, 0xbc, 0x0c, 0xff, 0x03, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xd5, 0xff, 0x0b, 0xf6, 0xff, 0x25, 0x39, 0x9f, 0x3e, 0x9f, 0x03, 0x25, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x00, 0x06, 0x9e, 0x00, 0x9d, 0x97, 0xac, 0x24, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x54, 0xb5, 0xff, 0xed, 0x45, 0xff, 0xf5, 0x00, 0xff, 0x94, 0xf1, 0xff, 0x05, 0x39, 0xff, 0x1c, 0xf8, 0xff, 0x04, 0xb7, 0xff, 0xcc, 0xed, 0xff, 0xec, 0x03, 0xff, 0xec, 0x04, 0xff, 0xec, 0x04, 0xff, 0xd4, 0x00, 0xff, 0x03, 0xf5, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xf4, 0x25, 0x59, 0x2b, 0x1d, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0x85, 0xd8, 0x13, 0x4c, 0xf7, 0xe3, 0x04, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x04, 0x57, 0xff, 0xad, 0x6d, 0xff, 0xfd, 0x40, 0xff, 0xc5, 0x2c, 0xff, 0x04, 0xf8, 0xff, 0x0c, 0x16, 0xff, 0x03, 0xd6, 0xff, 0x74, 0x73, 0xff, 0xec, 0x44, 0xff, 0xec, 0x04, 0xff, 0xec, 0x04, 0xff, 0xec, 0x03, 0xff, 0x64, 0x12, 0xff, 0x03, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xf9, 0x84, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x58, 0x00, 0xad, 0xd7, 0x2f, 0x44, 0xd6, 0xf7, 0x04, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x0c, 0x77, 0xff, 0x2c, 0xf4, 0xff, 0xfd, 0xa0, 0xff, 0xcd, 0x66, 0xff, 0x04, 0x97, 0xff, 0x0b, 0xf6, 0xff, 0x0b, 0xf6, 0xff, 0x04, 0x15, 0xff, 0xe4, 0xe7, 0xff, 0xec, 0x23, 0xff, 0xec, 0x24, 0xff, 0xec, 0x24, 0xff, 0xdc, 0x47, 0xff, 0x7c, 0xd0, 0xff, 0x84, 0xd1, 0xff, 0x1c, 0x15, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x1c, 0xb8, 0xcf, 0x1c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0xd6, 0x17, 0x00, 0xad, 0xb7, 0x2f, 0x4c, 0xf7, 0xe3, 0x1c, 0x96, 0xff, 0x04, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x04, 0x96, 0xff, 0xd5, 0xeb, 0xff, 0xe5, 0x85, 0xff, 0x44, 0xd6, 0xff, 0x13, 0xf6, 0xff, 0x0c, 0x16, 0xff, 0x04, 0x16, 0xff, 0xbd, 0x0d, 0xff, 0xec, 0x22, 0xff, 0xec, 0x44, 0xff, 0xec, 0x44, 0xff, 0xec, 0x44, 0xff, 0xec, 0x64, 0xff, 0xf4, 0xc2, 0xff, 0x8c, 0x70, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x14, 0x57, 0xfb, 0x14, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0x3d, 0x17, 0x00, 0x7d, 0x97, 0x13, 0x9d, 0x97, 0xac, 0x65, 0x17, 0xff, 0x14, 0xb7, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x04, 0x77, 0xff, 0x5c, 0xf4, 0xff, 0xf6, 0x00, 0xff, 0x44, 0xd3, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x36, 0xff, 0x64, 0x74, 0xff, 0xec, 0xa5, 0xff, 0xec, 0x63, 0xff, 0xec, 0x63, 0xff, 0xec, 0x63, 0xff, 0xec, 0x63, 0xff, 0xec, 0x61, 0xff, 0x94, 0x4f, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0x00, 0x04, 0xd7, 0x00, 0xc5, 0xd7, 0x67, 0xbd, 0xd7, 0xec, 0xc5, 0xd7, 0xff, 0xc5, 0xd7, 0xff, 0xc5, 0xf7, 0xff, 0xc5, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xf6, 0x69, 0xff, 0xd5, 0xf0, 0xff, 0xad, 0xb8, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x04, 0x36, 0xff, 0xd5, 0x68, 0xff, 0xf4, 0xa0, 0xff, 0xf4, 0xa1, 0xff, 0xec, 0xa3, 0xff, 0xec, 0xa3, 0xff, 0xf4, 0xa3, 0xff, 0xc4, 0x8a, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x56, 0xe0, 0x14, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x00, 0xbd, 0xf7, 0x00, 0xbd, 0xb7, 0x17, 0xbd, 0xb7, 0x74, 0xbd, 0xb7, 0xe0, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xd6, 0x51, 0xff, 0xe6, 0x2a, 0xff, 0xbd, 0xd7, 0xff, 0xad, 0x97, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x1c, 0x56, 0xff, 0x7c, 0x74, 0xff, 0x74, 0x54, 0xff, 0x8c, 0x73, 0xff, 0xec, 0xc3, 0xff, 0xf4, 0xc3, 0xff, 0xcc, 0xc2, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xa4, 0x1c, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x35, 0x00, 0xb5, 0xb6, 0x00, 0xbd, 0xd7, 0x00, 0xbd, 0xb7, 0x54, 0xbd, 0xd6, 0xac, 0xee, 0x6a, 0xe8, 0xb5, 0xb7, 0xec, 0xbd, 0xb7, 0xf8, 0xa5, 0x76, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x04, 0x37, 0xff, 0xa5, 0x2e, 0xff, 0xf5, 0x02, 0xff, 0xe4, 0xe4, 0xff, 0x4c, 0x75, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xfc, 0x14, 0xb7, 0x48, 0x1d, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x00, 0xde, 0x91, 0x00, 0xff, 0x40, 0x2f, 0xe6, 0x6c, 0x23, 0xb5, 0xb7, 0x1b, 0xb5, 0xb6, 0x27, 0x8d, 0x37, 0x48, 0x0c, 0x76, 0xf4, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x04, 0xd4, 0xff, 0xf5, 0x80, 0xff, 0xfd, 0x20, 0xff, 0x5c, 0x92, 0xff, 0x04, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x56, 0xff, 0x14, 0x76, 0xcf, 0x1c, 0xf8, 0x0b, 0x34, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0x00, 0xff, 0x44, 0x14, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xb9, 0x04, 0x14, 0x76, 0xb7, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x04, 0x76, 0xff, 0xcd, 0xab, 0xff, 0xf5, 0x60, 0xff, 0x7c, 0xcf, 0xff, 0x04, 0x57, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xf7, 0x14, 0xb7, 0x38, 0x14, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0x00, 0xff, 0x44, 0x00, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x00, 0x15, 0x19, 0x1b, 0x14, 0x76, 0xe3, 0x14, 0x76, 0xff, 0x64, 0xd4, 0xff, 0xf5, 0xc3, 0xff, 0xbd, 0x2a, 0xff, 0x04, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xef, 0x14, 0x97, 0x44, 0x02, 0xb6, 0x00, 0x3f, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x39, 0x00, 0x1d, 0x7a, 0x00, 0x1c, 0xd8, 0x1c, 0x04, 0x57, 0xc8, 0xbd, 0xea, 0xff, 0xd5, 0x87, 0xff, 0x04, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xff, 0x14, 0x76, 0xf7, 0x14, 0x76, 0xc0, 0x14, 0xb7, 0x2b, 0x0c, 0x37, 0x00, 0x25, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0xd6, 0x6d, 0x00, 0xe6, 0xcb, 0x54, 0xf6, 0x03, 0xff, 0x44, 0xb4, 0xc0, 0x14, 0x97, 0xf0, 0x14, 0x97, 0xfc, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xfb, 0x14, 0x97, 0xdb, 0x14, 0x97, 0xa0, 0x14, 0xb7, 0x47, 0x1c, 0xd8, 0x07, 0x14, 0xb7, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x25, 0x00, 0xff, 0x87, 0x07, 0xfe, 0x84, 0xd7, 0xfe, 0x20, 0x3f, 0x7c, 0xf3, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x47, 0x7f, 0x07, 0x14, 0xb7, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x14, 0x97, 0x00, 0x1c, 0xd7, 0x00, 0x6f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x26, 0x00, 0xfe, 0xe4, 0x40, 0xfe, 0xa3, 0x54, 0xfe, 0x42, 0x00, 0xfe, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x2d, 0xfb, 0x0b, 0x1c, 0xb8, 0xdb, 0x36, 0x5d, 0x10, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0x00, 0xfe, 0x04, 0x00, 0xff, 0x04, 0x78, 0xff, 0xea, 0x00, 0xfe, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x59, 0x00, 0x2d, 0x7a, 0x00, 0x24, 0xf9, 0x4f, 0x0b, 0xd5, 0xff, 0x1c, 0xf9, 0xb7, 0x03, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0x00, 0xff, 0x44, 0x20, 0xfe, 0xc0, 0x07, 0xfe, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf9, 0x00, 0x1c, 0xb8, 0xec, 0x0b, 0xd5, 0xff, 0x14, 0x16, 0xf4, 0x25, 0x59, 0x1f, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x5a, 0x00, 0x0d, 0x3a, 0x00, 0x25, 0x5a, 0x00, 0x25, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0x00, 0xff, 0x44, 0x00, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7a, 0x00, 0x2d, 0xba, 0x5f, 0x0b, 0xf6, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x25, 0x19, 0x7f, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x7a, 0x00, 0x36, 0x1c, 0x08, 0x1d, 0x19, 0x94, 0x14, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb7, 0x00, 0x1c, 0xb7, 0xbf, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x1c, 0xb8, 0xdf, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd8, 0x00, 0x1c, 0xf9, 0xa4, 0x13, 0xf6, 0xf8, 0x25, 0x5a, 0x1c, 0x25, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0x00, 0x14, 0x56, 0x97, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0x97, 0xb7, 0x14, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x9f, 0x00, 0x25, 0x7a, 0x1c, 0x14, 0x16, 0xef, 0x0b, 0xd6, 0xff, 0x1c, 0xf8, 0x94, 0x25, 0x5a, 0x00, 0x2d, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x00, 0x25, 0x7a, 0x03, 0x14, 0x76, 0x9b, 0x14, 0x76, 0xff, 0x14, 0x77, 0xc3, 0x14, 0x97, 0x18, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xba, 0x00, 0x25, 0x19, 0x78, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x57, 0xff, 0x3e, 0x7d, 0x14, 0x2d, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x76, 0x00, 0x14, 0x77, 0x00, 0x0c, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0x00, 0x1c, 0xd8, 0xec, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x16, 0xff, 0x25, 0x59, 0x83, 0x25, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x76, 0x00, 0x14, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x56, 0xff, 0x14, 0xb7, 0x94, 0x14, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xb7, 0x00, 0x14, 0x97, 0x5f, 0x14, 0x76, 0xf8, 0x14, 0x76, 0xff, 0x14, 0x76, 0xe8, 0x2d, 0x9a, 0x0c, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x97, 0x00, 0x03, 0xf3, 0x00, 0x14, 0x76, 0x23, 0x14, 0x76, 0x33, 0x0c, 0x97, 0x0f, 0x1c, 0xd7, 0x00, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x09, 0xbd, 0xd7, 0x38, 0xbd, 0xd7, 0x6f, 0xbd, 0xf7, 0x9b, 0xbd, 0xf7, 0xb8, 0xbd, 0xd7, 0xcb, 
+  0xbd, 0xd7, 0xc0, 0xbd, 0xd7, 0xa7, 0xbd, 0xd7, 0x7f, 0xbd, 0xd7, 0x4c, 0xbd, 0xf7, 0x0f, 0xb1, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xf7, 0x0c, 0xc5, 0xf8, 0x33, 0xc5, 0xf8, 0x9b, 0xc5, 0xf8, 0xeb, 
+  0x82, 0xc5, 0xf8, 0xff, 0x83, 0xbd, 0xf7, 0xff, 0x82, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xd7, 0xb7, 0xbd, 0xb7, 0x5c, 0xbd, 0xb7, 0x14, 0xad, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xf8, 0x57, 0xc5, 0xf8, 
+  0xd3, 0xc6, 0x18, 0xf8, 0x86, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x82, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xd7, 0xeb, 0xbd, 0xb7, 0x80, 0xb5, 0x96, 0x07, 0xa9, 0x00, 
+  0x00, 0x00, 0x01, 0xc5, 0xf8, 0x23, 0xc6, 0x18, 0xab, 0x83, 0xc6, 0x18, 0xff, 0x02, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0x85, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x82, 
+  0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0xd7, 0xb5, 0xb6, 0x4c, 0xa7, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xf0, 0x81, 0xc6, 0x18, 0xff, 0x82, 0xc6, 0x38, 
+  0xff, 0x85, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0xf8, 0xb5, 0xb6, 0x87, 
+  0xa5, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x5b, 0xc6, 0x18, 0xfb, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x39, 0xff, 0x87, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x38, 
+  0xff, 0x81, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x9f, 0xb5, 0xb6, 0x0f, 0xa2, 0x00, 0x00, 0x00, 0x04, 
+  0xc6, 0x18, 0x60, 0xc6, 0x18, 0xfb, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x85, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x85, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 
+  0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0x9f, 0xa1, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x33, 
+  0xc6, 0x18, 0xf7, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x83, 0xce, 0x79, 0xff, 0x83, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x82, 0xce, 0x59, 0xff, 0x01, 0xce, 
+  0x39, 0xff, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x81, 0xbd, 0xb7, 0xff, 0x00, 0xb5, 0xb6, 0x87, 0x9f, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xf8, 
+  0x18, 0xc6, 0x18, 0xd8, 0xc6, 0x18, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x86, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x81, 
+  0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x82, 0xc6, 0x18, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 
+  0xf8, 0xb5, 0xb6, 0x4c, 0x9e, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x97, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x05, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 
+  0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0x85, 0xd6, 0x9a, 0xff, 0x01, 0xc6, 0x7a, 0xff, 0xbe, 0x5a, 0xff, 0x82, 0xbe, 0x39, 0xff, 0x01, 0xb6, 0x19, 0xff, 0xbe, 0x19, 0xff, 0x81, 
+  0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xd7, 0xad, 0x55, 0x07, 0x9c, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x28, 
+  0xc6, 0x18, 0xf3, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x03, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x16, 0xce, 
+  0x39, 0xff, 0xce, 0x79, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xba, 0xff, 0xa6, 0x5a, 0xff, 0x75, 0xda, 0xff, 0x44, 0xf9, 0xff, 0x24, 0x97, 0xff, 0x04, 0x37, 0xff, 0x03, 0xf6, 0xff, 
+  0x04, 0x16, 0xff, 0x14, 0x57, 0xff, 0x34, 0xd8, 0xff, 0x55, 0x59, 0xff, 0x85, 0xd9, 0xff, 0xbd, 0xf8, 0xff, 0xc5, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 
+  0xff, 0xb5, 0x96, 0x80, 0x9c, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x9c, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x03, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 
+  0xce, 0x39, 0xff, 0x84, 0xce, 0x59, 0xff, 0x05, 0xde, 0xdb, 0xff, 0xc6, 0x9b, 0xff, 0x5d, 0x9a, 0xff, 0x04, 0x77, 0xff, 0x03, 0xb5, 0xff, 0x0b, 0x75, 0xff, 0x84, 0x0b, 0x95, 0xff, 0x81, 0x0b, 
+  0x75, 0xff, 0x03, 0x04, 0x17, 0xff, 0x35, 0x19, 0xff, 0x9d, 0xd8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xeb, 0xb5, 0x96, 0x14, 0x9a, 0x00, 0x00, 
+  0x00, 0x08, 0xc6, 0x18, 0x1b, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 
+  0xff, 0x82, 0xce, 0x79, 0xff, 0x03, 0xd6, 0x59, 0xff, 0x9e, 0x5b, 0xff, 0x2c, 0xb8, 0xff, 0x03, 0xb5, 0xff, 0x8a, 0x0b, 0x95, 0xff, 0x02, 0x03, 0xb5, 0xff, 0x14, 0x57, 0xff, 0x65, 0x79, 0xff, 
+  0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x5c, 0x9a, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x70, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 
+  0xce, 0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x02, 0xce, 0x79, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x02, 0xd6, 0x79, 0xff, 0x8d, 0xf9, 0xff, 0x04, 0x57, 0xff, 0x8e, 
+  0x0b, 0x95, 0xff, 0x08, 0x03, 0xf6, 0xff, 0x55, 0x58, 0xff, 0xb5, 0xd7, 0xff, 0xad, 0xb7, 0xff, 0xa5, 0xb7, 0xff, 0x9d, 0x97, 0xbf, 0x05, 0x9b, 0x23, 0x25, 0x9b, 0x1f, 0x25, 0x9a, 0x0c, 0x96, 
+  0x00, 0x00, 0x00, 0x06, 0xbd, 0xd7, 0x03, 0xc6, 0x18, 0xcb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0xba, 
+  0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x01, 0x9e, 0x19, 0xff, 0x1c, 0x57, 0xff, 0x90, 0x0b, 0xb5, 0xff, 0x09, 0x03, 0xd6, 0xff, 0x2c, 0xb8, 0xff, 0x1c, 0x97, 0xff, 0x04, 0x37, 
+  0xff, 0x04, 0x36, 0xff, 0x14, 0x57, 0xfc, 0x1c, 0x98, 0xef, 0x1c, 0xf9, 0xdb, 0x25, 0x7a, 0x80, 0x25, 0x9a, 0x18, 0x94, 0x00, 0x00, 0x00, 0x06, 0xc6, 0x18, 0x13, 0xc6, 0x18, 0xe4, 0xc6, 0x38, 
+  0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x06, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x7a, 
+  0xff, 0x24, 0xf8, 0xff, 0x03, 0xb5, 0xff, 0x98, 0x0b, 0xb5, 0xff, 0x03, 0x14, 0x36, 0xff, 0x1c, 0xf9, 0xe8, 0x25, 0x5a, 0x57, 0x25, 0xbb, 0x04, 0x92, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x20, 
+  0xc6, 0x18, 0xf0, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x02, 0xde, 0xfb, 0xff, 0x7d, 0xda, 
+  0xff, 0x03, 0xb5, 0xff, 0x9a, 0x0b, 0xb5, 0xff, 0x03, 0x0b, 0xd5, 0xff, 0x14, 0x57, 0xfb, 0x25, 0x59, 0x90, 0x36, 0x1c, 0x04, 0x91, 0x00, 0x00, 0x00, 0x09, 0xc6, 0x18, 0x2b, 0xc6, 0x18, 0xfb, 
+  0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x01, 0xce, 0xbb, 0xff, 
+  0x2c, 0x77, 0xff, 0x9c, 0x0b, 0xd5, 0xff, 0x02, 0x0b, 0xb5, 0xff, 0x14, 0x37, 0xff, 0x25, 0x39, 0x7c, 0x91, 0x00, 0x00, 0x00, 0x0d, 0xc6, 0x18, 0x30, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 
+  0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xae, 0x5a, 0xff, 0x03, 0xf6, 0xff, 
+  0x9e, 0x0b, 0xd6, 0xff, 0x01, 0x14, 0x57, 0xff, 0x25, 0x9b, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x0d, 0xc6, 0x18, 0x33, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 
+  0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xbe, 0x7a, 0xff, 0x7d, 0xfa, 0xff, 0x35, 0x9a, 0xff, 0x05, 0x59, 0xff, 0x04, 0x98, 0xff, 0x0b, 0xd5, 0xff, 0x86, 0x0b, 0xd6, 0xff, 0x84, 0x03, 
+  0xd6, 0xff, 0x92, 0x0b, 0xd6, 0xff, 0x02, 0x0b, 0xd5, 0xff, 0x1c, 0xb8, 0xd3, 0x2d, 0xbb, 0x0c, 0x8f, 0x00, 0x00, 0x00, 0x09, 0xc6, 0x18, 0x2f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 
+  0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x7a, 0xff, 0x75, 0xda, 0xff, 0x24, 0xd8, 0xff, 0x04, 0x16, 0xff, 0x89, 0x0b, 0xf6, 0xff, 0x01, 0x03, 0xf6, 0xff, 0x74, 0xb2, 0xff, 0x81, 0xb5, 
+  0x2f, 0xff, 0x02, 0xb5, 0x30, 0xff, 0xbd, 0x2f, 0xff, 0x24, 0x34, 0xff, 0x92, 0x0b, 0xf6, 0xff, 0x01, 0x14, 0x16, 0xfb, 0x25, 0x39, 0x3f, 0x8f, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x27, 0xc6, 
+  0x18, 0xf8, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0x55, 0x99, 0xff, 0x04, 0x36, 0xff, 0x8b, 0x0b, 0xf6, 0xff, 0x01, 0x34, 0x35, 0xff, 0xe4, 0xa8, 0xff, 0x81, 0xf4, 
+  0x44, 0xff, 0x02, 0xf4, 0x43, 0xff, 0xbc, 0x2a, 0xff, 0x03, 0xf6, 0xff, 0x93, 0x0b, 0xf6, 0xff, 0x00, 0x1c, 0xf8, 0x93, 0x8f, 0x00, 0x00, 0x00, 0x06, 0xbd, 0xf7, 0x1c, 0xc6, 0x18, 0xec, 0xc6, 
+  0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x39, 0xff, 0x6d, 0xb9, 0xff, 0x04, 0x16, 0xff, 0x8b, 0x0c, 0x16, 0xff, 0x02, 0x03, 0xf6, 0xff, 0xa4, 0xce, 0xff, 0xec, 0x23, 0xff, 0x81, 0xec, 0x04, 0xff, 
+  0x01, 0xe4, 0x06, 0xff, 0x3c, 0x14, 0xff, 0x85, 0x0c, 0x16, 0xff, 0x06, 0x14, 0x97, 0xff, 0x1c, 0xd8, 0xff, 0x1d, 0x19, 0xff, 0x25, 0x19, 0xff, 0x1c, 0xf9, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x36, 
+  0xff, 0x87, 0x0c, 0x16, 0xff, 0x00, 0x1c, 0xb7, 0xd3, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xbd, 0xf7, 0x0c, 0xc6, 0x18, 0xe0, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xb6, 0x19, 0xff, 0x1c, 0x97, 0xff, 
+  0x8b, 0x0c, 0x16, 0xff, 0x02, 0x04, 0x16, 0xff, 0x5c, 0x93, 0xff, 0xfc, 0x60, 0xff, 0x81, 0xec, 0x04, 0xff, 0x02, 0xf4, 0x02, 0xff, 0x8c, 0x0f, 0xff, 0x04, 0x16, 0xff, 0x82, 0x0c, 0x16, 0xff, 
+  0x08, 0x14, 0x36, 0xff, 0x1c, 0x98, 0xff, 0x1c, 0xd8, 0xff, 0x14, 0x57, 0xff, 0x13, 0xd6, 0xff, 0x0b, 0x95, 0xff, 0x0b, 0x75, 0xff, 0x0b, 0xd6, 0xff, 0x14, 0x37, 0xff, 0x81, 0x1c, 0xb8, 0xff, 
+  0x00, 0x14, 0x57, 0xff, 0x85, 0x0c, 0x16, 0xff, 0x00, 0x14, 0x57, 0xfc, 0x90, 0x00, 0x00, 0x00, 0x04, 0xc5, 0xf8, 0xa8, 0xc6, 0x18, 0xff, 0xce, 0x18, 0xff, 0x75, 0x99, 0xff, 0x04, 0x16, 0xff, 
+  0x8b, 0x0c, 0x36, 0xff, 0x0c, 0x24, 0x55, 0xff, 0xdc, 0xaa, 0xff, 0xec, 0x04, 0xff, 0xec, 0x24, 0xff, 0xec, 0x23, 0xff, 0xb4, 0x2a, 0xff, 0x04, 0x17, 0xff, 0x04, 0x16, 0xff, 0x0c, 0x36, 0xff, 
+  0x0c, 0x16, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0xff, 0x13, 0xf6, 0xff, 0x87, 0x0b, 0x95, 0xff, 0x04, 0x0b, 0xb6, 0xff, 0x14, 0x77, 0xff, 0x1c, 0xb8, 0xff, 0x0c, 0x16, 0xff, 0x0c, 0x36, 0xff, 
+  0x82, 0x0c, 0x16, 0xff, 0x00, 0x0c, 0x36, 0xff, 0x90, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xf7, 0x54, 0xc5, 0xf8, 0xff, 0xce, 0x18, 0xff, 0x2c, 0xf8, 0xff, 0x8b, 0x0c, 0x36, 0xff, 0x02, 0x04, 0x36, 
+  0xff, 0x94, 0xd1, 0xff, 0xec, 0x43, 0xff, 0x81, 0xec, 0x44, 0xff, 0x06, 0xec, 0x23, 0xff, 0xc4, 0xaa, 0xff, 0xb5, 0x2d, 0xff, 0x64, 0xb2, 0xff, 0x04, 0x36, 0xff, 0x14, 0x97, 0xff, 0x1c, 0x98, 
+  0xff, 0x8b, 0x0b, 0x95, 0xff, 0x02, 0x14, 0x37, 0xff, 0x1c, 0xb8, 0xff, 0x14, 0x77, 0xff, 0x82, 0x14, 0x97, 0xff, 0x00, 0x14, 0x77, 0xf7, 0x91, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xf8, 0xe0, 0xc6, 
+  0x18, 0xff, 0x04, 0x77, 0xff, 0x8b, 0x0c, 0x36, 0xff, 0x02, 0x24, 0xb4, 0xff, 0xf4, 0xc4, 0xff, 0xec, 0x43, 0xff, 0x82, 0xec, 0x44, 0xff, 0x04, 0xf4, 0x64, 0xff, 0xcc, 0x69, 0xff, 0x1c, 0x36, 
+  0xff, 0x14, 0x77, 0xff, 0x14, 0x57, 0xff, 0x8d, 0x0b, 0xb5, 0xff, 0x01, 0x13, 0xf6, 0xff, 0x14, 0x57, 0xff, 0x81, 0x14, 0x16, 0xff, 0x03, 0x14, 0x37, 0xff, 0x14, 0x77, 0xfc, 0x1c, 0xf9, 0xd7, 
+  0x25, 0x9a, 0x68, 0x8f, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xd7, 0x74, 0xc6, 0x18, 0xff, 0x04, 0x36, 0xff, 0x8b, 0x0c, 0x56, 0xff, 0x01, 0xdd, 0x2b, 0xff, 0xec, 0x63, 0xff, 0x83, 0xec, 0x83, 0xff, 
+  0x04, 0xdc, 0x86, 0xff, 0x04, 0x55, 0xff, 0x14, 0x56, 0xff, 0x24, 0xb8, 0xff, 0x5c, 0x34, 0xff, 0x82, 0x64, 0x34, 0xff, 0x00, 0x3b, 0xf5, 0xff, 0x90, 0x0b, 0xb5, 0xff, 0x02, 0x14, 0x57, 0xff, 
+  0x25, 0x39, 0xb3, 0x25, 0x9a, 0x18, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xd7, 0x17, 0xc5, 0xf7, 0xec, 0x1c, 0xb7, 0xff, 0x89, 0x0c, 0x56, 0xff, 0x0b, 0x04, 0x56, 0xff, 0x8c, 0xf1, 0xff, 0xfc, 
+  0xc0, 0xff, 0xf4, 0xa0, 0xff, 0xf4, 0xa1, 0xff, 0xf4, 0xa3, 0xff, 0xec, 0xa3, 0xff, 0xe4, 0xa4, 0xff, 0x44, 0x74, 0xff, 0x0c, 0x56, 0xff, 0x0c, 0x98, 0xff, 0x7c, 0xb2, 0xff, 0x82, 0xec, 0xa7, 
+  0xff, 0x02, 0xe4, 0xa7, 0xff, 0x5c, 0x13, 0xff, 0x0b, 0xb5, 0xff, 0x8f, 0x0b, 0xd5, 0xff, 0x03, 0x0b, 0xb5, 0xff, 0x13, 0xf6, 0xff, 0x1c, 0xf9, 0xc7, 0x2d, 0xdb, 0x0f, 0x8d, 0x00, 0x00, 0x00, 
+  0x02, 0xc5, 0xf7, 0x67, 0x6d, 0x57, 0xff, 0x04, 0x56, 0xff, 0x89, 0x14, 0x56, 0xff, 0x82, 0x04, 0x57, 0xff, 0x07, 0xac, 0xcc, 0xff, 0xf4, 0xe3, 0xff, 0xf4, 0xe0, 0xff, 0x74, 0x90, 0xff, 0x04, 
+  0x77, 0xff, 0x14, 0x97, 0xff, 0x1c, 0xd6, 0xff, 0xec, 0xc4, 0xff, 0x81, 0xec, 0x04, 0xff, 0x02, 0xec, 0x03, 0xff, 0xbc, 0x0c, 0xff, 0x03, 0xd5, 0xff, 0x92, 0x0b, 0xd5, 0xff, 0x02, 0x0b, 0xf6, 
+  0xff, 0x25, 0x39, 0x9f, 0x3e, 0x9f, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x9d, 0x97, 0xac, 0x24, 0x76, 0xff, 0x8b, 0x14, 0x76, 0xff, 0x08, 0x54, 0xb5, 0xff, 0xed, 0x45, 0xff, 0xf5, 0x00, 0xff, 
+  0x94, 0xf1, 0xff, 0x05, 0x39, 0xff, 0x1c, 0xf8, 0xff, 0x04, 0xb7, 0xff, 0xcc, 0xed, 0xff, 0xec, 0x03, 0xff, 0x81, 0xec, 0x04, 0xff, 0x01, 0xd4, 0x00, 0xff, 0x03, 0xf5, 0xff, 0x93, 0x0b, 0xf6, 
+  0xff, 0x02, 0x0b, 0xd6, 0xff, 0x14, 0x36, 0xf4, 0x25, 0x59, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x85, 0xd8, 0x13, 0x4c, 0xf7, 0xe3, 0x04, 0x76, 0xff, 0x89, 0x14, 0x76, 0xff, 0x08, 0x04, 0x57, 
+  0xff, 0xad, 0x6d, 0xff, 0xfd, 0x40, 0xff, 0xc5, 0x2c, 0xff, 0x04, 0xf8, 0xff, 0x0c, 0x16, 0xff, 0x03, 0xd6, 0xff, 0x74, 0x73, 0xff, 0xec, 0x44, 0xff, 0x81, 0xec, 0x04, 0xff, 0x02, 0xec, 0x03, 
+  0xff, 0x64, 0x12, 0xff, 0x03, 0xf6, 0xff, 0x95, 0x0b, 0xf6, 0xff, 0x00, 0x1c, 0xf9, 0x84, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xad, 0xd7, 0x2f, 0x44, 0xd6, 0xf7, 0x04, 0x76, 0xff, 0x87, 0x14, 0x76, 
+  0xff, 0x04, 0x0c, 0x77, 0xff, 0x2c, 0xf4, 0xff, 0xfd, 0xa0, 0xff, 0xcd, 0x66, 0xff, 0x04, 0x97, 0xff, 0x81, 0x0b, 0xf6, 0xff, 0x02, 0x04, 0x15, 0xff, 0xe4, 0xe7, 0xff, 0xec, 0x23, 0xff, 0x81, 
+  0xec, 0x24, 0xff, 0x03, 0xdc, 0x47, 0xff, 0x7c, 0xd0, 0xff, 0x84, 0xd1, 0xff, 0x1c, 0x15, 0xff, 0x93, 0x0c, 0x16, 0xff, 0x01, 0x0b, 0xf6, 0xff, 0x1c, 0xb8, 0xcf, 0x8f, 0x00, 0x00, 0x00, 0x04, 
+  0xad, 0xb7, 0x2f, 0x4c, 0xf7, 0xe3, 0x1c, 0x96, 0xff, 0x04, 0x76, 0xff, 0x0c, 0x76, 0xff, 0x84, 0x14, 0x76, 0xff, 0x08, 0x04, 0x96, 0xff, 0xd5, 0xeb, 0xff, 0xe5, 0x85, 0xff, 0x44, 0xd6, 0xff, 
+  0x13, 0xf6, 0xff, 0x0c, 0x16, 0xff, 0x04, 0x16, 0xff, 0xbd, 0x0d, 0xff, 0xec, 0x22, 0xff, 0x82, 0xec, 0x44, 0xff, 0x03, 0xec, 0x64, 0xff, 0xf4, 0xc2, 0xff, 0x8c, 0x70, 0xff, 0x04, 0x16, 0xff, 
+  0x94, 0x0c, 0x16, 0xff, 0x00, 0x14, 0x57, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x03, 0x7d, 0x97, 0x13, 0x9d, 0x97, 0xac, 0x65, 0x17, 0xff, 0x14, 0xb7, 0xff, 0x84, 0x04, 0x77, 0xff, 0x07, 0x5c, 0xf4, 
+  0xff, 0xf6, 0x00, 0xff, 0x44, 0xd3, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x14, 0x36, 0xff, 0x64, 0x74, 0xff, 0xec, 0xa5, 0xff, 0x83, 0xec, 0x63, 0xff, 0x02, 0xec, 0x61, 0xff, 0x94, 0x4f, 
+  0xff, 0x04, 0x16, 0xff, 0x96, 0x0c, 0x36, 0xff, 0x92, 0x00, 0x00, 0x00, 0x01, 0xc5, 0xd7, 0x67, 0xbd, 0xd7, 0xec, 0x81, 0xc5, 0xd7, 0xff, 0x81, 0xc5, 0xf7, 0xff, 0x09, 0xc5, 0xf8, 0xff, 0xf6, 
+  0x69, 0xff, 0xd5, 0xf0, 0xff, 0xad, 0xb8, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x04, 0x36, 0xff, 0xd5, 0x68, 0xff, 0xf4, 0xa0, 0xff, 0xf4, 0xa1, 0xff, 0x81, 0xec, 0xa3, 0xff, 0x02, 0xf4, 
+  0xa3, 0xff, 0xc4, 0x8a, 0xff, 0x04, 0x36, 0xff, 0x96, 0x0c, 0x36, 0xff, 0x00, 0x14, 0x56, 0xe0, 0x93, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xb7, 0x17, 0xbd, 0xb7, 0x74, 0xbd, 0xb7, 0xe0, 0x81, 0xbd, 
+  0xb7, 0xff, 0x0e, 0xd6, 0x51, 0xff, 0xe6, 0x2a, 0xff, 0xbd, 0xd7, 0xff, 0xad, 0x97, 0xff, 0x04, 0x36, 0xff, 0x0c, 0x36, 0xff, 0x1c, 0x56, 0xff, 0x7c, 0x74, 0xff, 0x74, 0x54, 0xff, 0x8c, 0x73, 
+  0xff, 0xec, 0xc3, 0xff, 0xf4, 0xc3, 0xff, 0xcc, 0xc2, 0xff, 0x04, 0x56, 0xff, 0x0c, 0x36, 0xff, 0x95, 0x0c, 0x56, 0xff, 0x01, 0x0c, 0x36, 0xff, 0x14, 0x97, 0xa4, 0x96, 0x00, 0x00, 0x00, 0x06, 
+  0xbd, 0xb7, 0x54, 0xbd, 0xd6, 0xac, 0xee, 0x6a, 0xe8, 0xb5, 0xb7, 0xec, 0xbd, 0xb7, 0xf8, 0xa5, 0x76, 0xff, 0x04, 0x56, 0xff, 0x82, 0x0c, 0x56, 0xff, 0x05, 0x04, 0x37, 0xff, 0xa5, 0x2e, 0xff, 
+  0xf5, 0x02, 0xff, 0xe4, 0xe4, 0xff, 0x4c, 0x75, 0xff, 0x14, 0x56, 0xff, 0x96, 0x0c, 0x56, 0xff, 0x01, 0x0c, 0x56, 0xfc, 0x14, 0xb7, 0x48, 0x97, 0x00, 0x00, 0x00, 0x05, 0xff, 0x40, 0x2f, 0xe6, 
+  0x6c, 0x23, 0xb5, 0xb7, 0x1b, 0xb5, 0xb6, 0x27, 0x8d, 0x37, 0x48, 0x0c, 0x76, 0xf4, 0x81, 0x14, 0x56, 0xff, 0x05, 0x0c, 0x56, 0xff, 0x04, 0xd4, 0xff, 0xf5, 0x80, 0xff, 0xfd, 0x20, 0xff, 0x5c, 
+  0x92, 0xff, 0x04, 0x56, 0xff, 0x97, 0x14, 0x56, 0xff, 0x01, 0x14, 0x76, 0xcf, 0x1c, 0xf8, 0x0b, 0x97, 0x00, 0x00, 0x00, 0x00, 0xff, 0x44, 0x14, 0x82, 0x00, 0x00, 0x00, 0x01, 0x25, 0xb9, 0x04, 
+  0x14, 0x76, 0xb7, 0x81, 0x14, 0x76, 0xff, 0x04, 0x04, 0x76, 0xff, 0xcd, 0xab, 0xff, 0xf5, 0x60, 0xff, 0x7c, 0xcf, 0xff, 0x04, 0x57, 0xff, 0x97, 0x14, 0x76, 0xff, 0x01, 0x14, 0x76, 0xf7, 0x14, 
+  0xb7, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x06, 0x15, 0x19, 0x1b, 0x14, 0x76, 0xe3, 0x14, 0x76, 0xff, 0x64, 0xd4, 0xff, 0xf5, 0xc3, 0xff, 0xbd, 0x2a, 0xff, 0x04, 0x76, 0xff, 0x97, 0x14, 0x76, 0xff, 
+  0x01, 0x14, 0x76, 0xef, 0x14, 0x97, 0x44, 0x9f, 0x00, 0x00, 0x00, 0x04, 0x1c, 0xd8, 0x1c, 0x04, 0x57, 0xc8, 0xbd, 0xea, 0xff, 0xd5, 0x87, 0xff, 0x04, 0x76, 0xff, 0x96, 0x14, 0x76, 0xff, 0x02, 
+  0x14, 0x76, 0xf7, 0x14, 0x76, 0xc0, 0x14, 0xb7, 0x2b, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xe6, 0xcb, 0x54, 0xf6, 0x03, 0xff, 0x44, 0xb4, 0xc0, 0x14, 0x97, 0xf0, 0x14, 0x97, 0xfc, 0x93, 0x14, 0x97, 
+  0xfb, 0x03, 0x14, 0x97, 0xdb, 0x14, 0x97, 0xa0, 0x14, 0xb7, 0x47, 0x1c, 0xd8, 0x07, 0xa1, 0x00, 0x00, 0x00, 0x02, 0xff, 0x87, 0x07, 0xfe, 0x84, 0xd7, 0xfe, 0x20, 0x3f, 0x8b, 0x00, 0x00, 0x00, 
+  0x00, 0x47, 0x7f, 0x07, 0xaf, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xe4, 0x40, 0xfe, 0xa3, 0x54, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x2d, 0xfb, 0x0b, 0x1c, 0xb8, 0xdb, 0x36, 0x5d, 0x10, 0xae, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x04, 0x78, 0x8c, 0x00, 0x00, 0x00, 0x02, 0x24, 0xf9, 0x4f, 0x0b, 0xd5, 0xff, 0x1c, 0xf9, 0xb7, 0xad, 0x00, 0x00, 0x00, 0x01, 0xff, 0x44, 0x20, 0xfe, 0xc0, 0x07, 0x8c, 0x00, 
+  0x00, 0x00, 0x03, 0x1c, 0xb8, 0xec, 0x0b, 0xd5, 0xff, 0x14, 0x16, 0xf4, 0x25, 0x59, 0x1f, 0xba, 0x00, 0x00, 0x00, 0x01, 0x2d, 0xba, 0x5f, 0x0b, 0xf6, 0xff, 0x81, 0x0c, 0x16, 0xff, 0x00, 0x25, 
+  0x19, 0x7f, 0x84, 0x00, 0x00, 0x00, 0x01, 0x36, 0x1c, 0x08, 0x1d, 0x19, 0x94, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xb7, 0xbf, 0x82, 0x0c, 0x36, 0xff, 0x00, 0x1c, 0xb8, 0xdf, 0x84, 0x00, 0x00, 
+  0x00, 0x02, 0x1c, 0xf9, 0xa4, 0x13, 0xf6, 0xf8, 0x25, 0x5a, 0x1c, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0x97, 0x82, 0x0c, 0x56, 0xff, 0x00, 0x14, 0x97, 0xb7, 0x83, 0x00, 0x00, 0x00, 0x03, 
+  0x25, 0x7a, 0x1c, 0x14, 0x16, 0xef, 0x0b, 0xd6, 0xff, 0x1c, 0xf8, 0x94, 0xb2, 0x00, 0x00, 0x00, 0x04, 0x25, 0x7a, 0x03, 0x14, 0x76, 0x9b, 0x14, 0x76, 0xff, 0x14, 0x77, 0xc3, 0x14, 0x97, 0x18, 
+  0x83, 0x00, 0x00, 0x00, 0x04, 0x25, 0x19, 0x78, 0x0c, 0x16, 0xff, 0x0b, 0xf6, 0xff, 0x14, 0x57, 0xff, 0x3e, 0x7d, 0x14, 0xba, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd8, 0xec, 0x82, 0x0c, 0x16, 0xff, 
+  0x00, 0x25, 0x59, 0x83, 0xba, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0xff, 0x82, 0x0c, 0x56, 0xff, 0x00, 0x14, 0xb7, 0x94, 0xba, 0x00, 0x00, 0x00, 0x04, 0x14, 0x97, 0x5f, 0x14, 0x76, 0xf8, 0x14, 
+  0x76, 0xff, 0x14, 0x76, 0xe8, 0x2d, 0x9a, 0x0c, 0xbb, 0x00, 0x00, 0x00, 0x02, 0x14, 0x76, 0x23, 0x14, 0x76, 0x33, 0x0c, 0x97, 0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x8d, 0x00, 
+  0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xba, 0xba, 0xba, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0xb8, 0xb8, 0xb8, 0x00, 0xb8, 0xb8, 0xb8, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xc2, 0xc2, 0xc2, 0x00, 0xba, 0xba, 0xba, 0x38, 0xb9, 0xb9, 0xb9, 0x6f, 0xbb, 0xbb, 0xbb, 0x9b, 0xbb, 0xbb, 0xbb, 0xb8, 0xba, 0xba, 0xba, 0xcb, 0xb9, 0xb9, 0xb9, 0xc0, 0xb9, 0xb9, 0xb9, 0xa7, 0xb7, 0xb7, 0xb7, 0x7f, 0xb7, 0xb7, 0xb7, 0x4c, 0xbc, 0xbc, 0xbc, 0x0f, 0xb7, 0xb7, 0xb7, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x9e, 0x9e, 0x00, 0xef, 0xef, 0xef, 0x00, 0xbf, 0xbf, 0xbf, 0x00, 0xbc, 0xbc, 0xbc, 0x0c, 0xbd, 0xbd, 0xbd, 0x33, 0xbd, 0xbd, 0xbd, 0x9b, 0xbd, 0xbd, 0xbd, 0xeb, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb6, 0xb6, 0x5c, 0xb5, 0xb5, 0xb5, 0x14, 0xc4, 0xc4, 0xc4, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xc6, 0xc6, 0xc6, 0x00, 0xbe, 0xbe, 0xbe, 0x57, 0xbe, 0xbe, 0xbe, 0xd3, 0xbf, 0xbf, 0xbf, 0xf8, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xeb, 0xb6, 0xb6, 0xb6, 0x80, 0xb0, 0xb0, 0xb0, 0x07, 0xb2, 0xb2, 0xb2, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x00, 0xbe, 0xbe, 0xbe, 0x00, 0xbe, 0xbe, 0xbe, 0x23, 0xbf, 0xbf, 0xbf, 0xab, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xd7, 0xb3, 0xb3, 0xb3, 0x4c, 0xbb, 0xbb, 0xbb, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xb8, 0xb8, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x00, 0xba, 0xba, 0xba, 0x00, 0xbf, 0xbf, 0xbf, 0x4c, 0xbf, 0xbf, 0xbf, 0xf0, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xf8, 0xb4, 0xb4, 0xb4, 0x87, 0xe9, 0xe9, 0xe9, 0x00, 0xb6, 0xb6, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0x00, 0xa6, 0xa6, 0xa6, 0x00, 0xbf, 0xbf, 0xbf, 0x5b, 0xc0, 0xc0, 0xc0, 0xfb, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x9f, 0xb3, 0xb3, 0xb3, 0x0f, 0xaf, 0xaf, 0xaf, 0x00, 0xad, 0xad, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x85, 0x85, 0x00, 0xbf, 0xbf, 0xbf, 0x60, 0xc1, 0xc1, 0xc1, 0xfb, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x00, 0xbf, 0xbf, 0xbf, 0x00, 0xbf, 0xbf, 0xbf, 0x33, 0xc1, 0xc1, 0xc1, 0xf7, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0x87, 0xc0, 0xc0, 0xc0, 0x00, 0xb3, 0xb3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x00, 0xbe, 0xbe, 0xbe, 0x18, 0xc0, 0xc0, 0xc0, 0xd8, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xf8, 0xb3, 0xb3, 0xb3, 0x4c, 0xb2, 0xb2, 0xb2, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0x83, 0x83, 0x83, 0x00, 0xc0, 0xc0, 0xc0, 0x97, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xca, 0xca, 0xca, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd1, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcc, 0xc3, 0xff, 0xcd, 0xc8, 0xbc, 0xff, 0xcc, 0xc6, 0xb8, 0xff, 0xcc, 0xc5, 0xb7, 0xff, 0xca, 0xc3, 0xb5, 0xff, 0xc7, 0xc2, 0xb4, 0xff, 0xc6, 0xc2, 0xb8, 0xff, 0xc2, 0xc1, 0xbd, 0xff, 0xbf, 0xc0, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xd7, 0xa9, 0xa9, 0xa9, 0x07, 0xaf, 0xaf, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x00, 0xbf, 0xbf, 0xbf, 0x28, 0xc1, 0xc1, 0xc1, 0xf3, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd5, 0xff, 0xd3, 0xc9, 0xa3, 0xff, 0xd1, 0xb7, 0x6e, 0xff, 0xc5, 0x9e, 0x3d, 0xff, 0xbc, 0x8f, 0x1d, 0xff, 0xb6, 0x84, 0x00, 0xff, 0xb3, 0x7d, 0x00, 0xff, 0xb4, 0x81, 0x00, 0xff, 0xb9, 0x8a, 0x12, 0xff, 0xc1, 0x97, 0x31, 0xff, 0xc9, 0xa9, 0x53, 0xff, 0xc9, 0xba, 0x84, 0xff, 0xc0, 0xbe, 0xb6, 0xff, 0xbc, 0xbd, 0xbe, 0xff, 0xbb, 0xbb, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x80, 0xb8, 0xb8, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xbf, 0xbf, 0xbf, 0x00, 0xc0, 0xc0, 0xc0, 0x9c, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xcf, 0xbd, 0xff, 0xcd, 0xb1, 0x58, 0xff, 0xbc, 0x8b, 0x00, 0xff, 0xac, 0x73, 0x03, 0xff, 0xa7, 0x6d, 0x08, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6f, 0x09, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xa8, 0x6e, 0x06, 0xff, 0xb7, 0x82, 0x00, 0xff, 0xc5, 0xa1, 0x2e, 0xff, 0xc3, 0xb8, 0x95, 0xff, 0xbc, 0xbc, 0xb8, 0xff, 0xb9, 0xb9, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xeb, 0xb0, 0xb0, 0xb0, 0x14, 0xb1, 0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0x1b, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcb, 0xff, 0xc8, 0xca, 0xcf, 0xff, 0xd5, 0xc7, 0x96, 0xff, 0xc0, 0x96, 0x2c, 0xff, 0xac, 0x74, 0x00, 0xff, 0xa9, 0x71, 0x08, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xab, 0x73, 0x04, 0xff, 0xb8, 0x87, 0x0e, 0xff, 0xc5, 0xab, 0x62, 0xff, 0xbb, 0xba, 0xb7, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0x5c, 0xb1, 0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0x70, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcd, 0xcd, 0xff, 0xcc, 0xbc, 0x87, 0xff, 0xb9, 0x87, 0x00, 0xff, 0xa9, 0x71, 0x08, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x71, 0x09, 0xff, 0xb1, 0x7b, 0x00, 0xff, 0xc4, 0xa8, 0x54, 0xff, 0xbb, 0xb8, 0xaf, 0xff, 0xbb, 0xb6, 0xa8, 0xff, 0xbb, 0xb4, 0xa4, 0xff, 0xbb, 0xb1, 0x9b, 0xbf, 0xdc, 0xb0, 0x00, 0x23, 0xd5, 0xb1, 0x23, 0x1f, 0xd4, 0xb1, 0x23, 0x0c, 0xce, 0xa8, 0x1c, 0x00, 0xcf, 0xab, 0x20, 0x00, 0xcf, 0xab, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8, 0x03, 0xc0, 0xc0, 0xc0, 0xcb, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xd0, 0xff, 0xcb, 0xc0, 0x99, 0xff, 0xb6, 0x88, 0x15, 0xff, 0xa9, 0x73, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xae, 0x7a, 0x01, 0xff, 0xbe, 0x95, 0x26, 0xff, 0xba, 0x8f, 0x19, 0xff, 0xb5, 0x86, 0x00, 0xff, 0xb4, 0x83, 0x00, 0xff, 0xb7, 0x88, 0x13, 0xfc, 0xbd, 0x90, 0x15, 0xef, 0xc7, 0x9e, 0x1a, 0xdb, 0xd1, 0xae, 0x20, 0x80, 0xd2, 0xb0, 0x23, 0x18, 0xd2, 0xad, 0x20, 0x00, 0xd2, 0xac, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x13, 0xc1, 0xc1, 0xc1, 0xe4, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xcf, 0xff, 0xd0, 0xcd, 0xbe, 0xff, 0xc1, 0x9b, 0x20, 0xff, 0xab, 0x75, 0x04, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xb4, 0x83, 0x0f, 0xff, 0xc5, 0x9c, 0x19, 0xe8, 0xcf, 0xaa, 0x1e, 0x57, 0xdc, 0xb5, 0x1f, 0x04, 0xd3, 0xae, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x20, 0xc1, 0xc1, 0xc1, 0xf0, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xd9, 0xff, 0xce, 0xb8, 0x76, 0xff, 0xaa, 0x73, 0x00, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xab, 0x75, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xb7, 0x88, 0x12, 0xfb, 0xcb, 0xa7, 0x20, 0x90, 0xe1, 0xbf, 0x2f, 0x04, 0xd1, 0xaf, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x2b, 0xc1, 0xc1, 0xc1, 0xfb, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd5, 0xcb, 0xff, 0xb8, 0x8c, 0x2c, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xab, 0x76, 0x09, 0xff, 0xb5, 0x84, 0x10, 0xff, 0xca, 0xa6, 0x1e, 0x7c, 0xc3, 0xa8, 0x0f, 0x00, 0xd5, 0xae, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x30, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd4, 0xff, 0xd6, 0xd7, 0xda, 0xff, 0xd8, 0xda, 0xdd, 0xff, 0xda, 0xdc, 0xe2, 0xff, 0xd3, 0xc7, 0xa5, 0xff, 0xaf, 0x7b, 0x00, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x79, 0x0a, 0xff, 0xad, 0x78, 0x0a, 0xff, 0xb8, 0x8a, 0x12, 0xff, 0xd5, 0xb2, 0x24, 0x4b, 0xd1, 0xad, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x33, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd1, 0xcd, 0xff, 0xd3, 0xcd, 0xbc, 0xff, 0xd1, 0xbe, 0x77, 0xff, 0xce, 0xb0, 0x32, 0xff, 0xcc, 0xa7, 0x00, 0xff, 0xbe, 0x92, 0x00, 0xff, 0xac, 0x79, 0x0b, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0b, 0xff, 0xae, 0x79, 0x00, 0xff, 0xae, 0x79, 0x00, 0xff, 0xae, 0x79, 0x00, 0xff, 0xae, 0x79, 0x00, 0xff, 0xae, 0x79, 0x00, 0xff, 0xad, 0x7a, 0x09, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xab, 0x78, 0x09, 0xff, 0xbf, 0x94, 0x16, 0xd3, 0xd9, 0xb6, 0x27, 0x0c, 0xd6, 0xb3, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x2f, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcc, 0xc9, 0xff, 0xcf, 0xba, 0x6f, 0xff, 0xbf, 0x97, 0x1e, 0xff, 0xb2, 0x82, 0x00, 0xff, 0xaf, 0x7d, 0x06, 0xff, 0xad, 0x7b, 0x09, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xaf, 0x7b, 0x00, 0xff, 0x92, 0x93, 0x70, 0xff, 0x7c, 0xa5, 0xb1, 0xff, 0x7c, 0xa4, 0xaf, 0xff, 0x7d, 0xa4, 0xae, 0xff, 0x79, 0xa6, 0xb8, 0xff, 0xa1, 0x83, 0x1f, 0xff, 0xae, 0x7b, 0x07, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xae, 0x7c, 0x0b, 0xff, 0xb2, 0x82, 0x0e, 0xfb, 0xcb, 0xa4, 0x21, 0x3f, 0xd8, 0xb5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x27, 0xc0, 0xc0, 0xc0, 0xf8, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc8, 0xff, 0xca, 0xca, 0xc6, 0xff, 0xcb, 0xb2, 0x52, 0xff, 0xb4, 0x84, 0x00, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0c, 0xff, 0xa7, 0x83, 0x31, 0xff, 0x43, 0x94, 0xe1, 0xff, 0x1e, 0x87, 0xed, 0xff, 0x1e, 0x88, 0xed, 0xff, 0x1a, 0x88, 0xee, 0xff, 0x4f, 0x85, 0xb5, 0xff, 0xb3, 0x7c, 0x00, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0xad, 0x7d, 0x0a, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xc3, 0x9c, 0x1c, 0x93, 0xcc, 0xa8, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x1c, 0xbf, 0xbf, 0xbf, 0xec, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc6, 0xc3, 0xff, 0xca, 0xb4, 0x6a, 0xff, 0xb1, 0x81, 0x00, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xb3, 0x7d, 0x00, 0xff, 0x74, 0x9a, 0xa3, 0xff, 0x1a, 0x83, 0xeb, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x2d, 0x82, 0xde, 0xff, 0xa1, 0x80, 0x39, 0xff, 0xaf, 0x80, 0x0c, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xae, 0x7f, 0x0a, 0xff, 0xb0, 0x81, 0x0b, 0xff, 0xbc, 0x90, 0x13, 0xff, 0xc3, 0x9a, 0x19, 0xff, 0xc9, 0xa1, 0x1c, 0xff, 0xcb, 0xa2, 0x1d, 0xff, 0xc6, 0x9c, 0x1a, 0xff, 0xbe, 0x94, 0x15, 0xff, 0xb3, 0x85, 0x0e, 0xff, 0xae, 0x7f, 0x0a, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xbb, 0x93, 0x16, 0xd3, 0xbf, 0x98, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x0c, 0xbf, 0xbf, 0xbf, 0xe0, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc1, 0xb0, 0xff, 0xb7, 0x8f, 0x18, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xb0, 0x81, 0x00, 0xff, 0x99, 0x91, 0x55, 0xff, 0x04, 0x8e, 0xf5, 0xff, 0x1f, 0x81, 0xe9, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x0f, 0x82, 0xee, 0xff, 0x77, 0x82, 0x87, 0xff, 0xb1, 0x81, 0x00, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xb2, 0x85, 0x0d, 0xff, 0xbe, 0x92, 0x15, 0xff, 0xc4, 0x9a, 0x19, 0xff, 0xba, 0x88, 0x13, 0xff, 0xb0, 0x7a, 0x0d, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xae, 0x77, 0x0b, 0xff, 0xb6, 0x83, 0x11, 0xff, 0xc2, 0x95, 0x18, 0xff, 0xc0, 0x95, 0x16, 0xff, 0xb5, 0x89, 0x10, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xaf, 0x81, 0x0b, 0xff, 0xb5, 0x8a, 0x10, 0xfc, 0xb7, 0x8c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x00, 0xbd, 0xbd, 0xbd, 0xa8, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc2, 0xc5, 0xff, 0xc5, 0xb2, 0x6e, 0xff, 0xb0, 0x82, 0x00, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xac, 0x87, 0x22, 0xff, 0x4e, 0x94, 0xd6, 0xff, 0x1d, 0x82, 0xe9, 0xff, 0x1f, 0x83, 0xe9, 0xff, 0x1b, 0x83, 0xeb, 0xff, 0x4f, 0x83, 0xad, 0xff, 0xb5, 0x80, 0x00, 0xff, 0xb2, 0x81, 0x00, 0xff, 0xb0, 0x83, 0x0c, 0xff, 0xaf, 0x82, 0x0a, 0xff, 0xb9, 0x8d, 0x11, 0xff, 0xc0, 0x93, 0x16, 0xff, 0xb1, 0x7c, 0x0e, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xaa, 0x71, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xad, 0x76, 0x0c, 0xff, 0xba, 0x8b, 0x13, 0xff, 0xbf, 0x95, 0x15, 0xff, 0xaf, 0x81, 0x0a, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x85, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xbb, 0xbb, 0xbb, 0x54, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc2, 0xc6, 0xff, 0xbe, 0x9e, 0x26, 0xff, 0xb0, 0x83, 0x07, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0c, 0xff, 0xb2, 0x83, 0x00, 0xff, 0x85, 0x97, 0x92, 0xff, 0x16, 0x8a, 0xec, 0xff, 0x1e, 0x87, 0xe9, 0xff, 0x1e, 0x87, 0xe9, 0xff, 0x1b, 0x86, 0xea, 0xff, 0x54, 0x94, 0xbe, 0xff, 0x69, 0xa6, 0xb1, 0xff, 0x93, 0x94, 0x5f, 0xff, 0xb1, 0x83, 0x02, 0xff, 0xb9, 0x8f, 0x12, 0xff, 0xbe, 0x90, 0x15, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x71, 0x08, 0xff, 0xb6, 0x83, 0x11, 0xff, 0xc0, 0x96, 0x16, 0xff, 0xb7, 0x8c, 0x11, 0xff, 0xba, 0x8f, 0x12, 0xff, 0xba, 0x90, 0x13, 0xff, 0xb9, 0x8f, 0x12, 0xff, 0xb7, 0x8d, 0x12, 0xf7, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xad, 0x20, 0x00, 0xd1, 0xaf, 0x24, 0x00, 0xd1, 0xae, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xbd, 0xbd, 0xbd, 0x00, 0xbd, 0xbd, 0xbd, 0xe0, 0xbf, 0xc1, 0xc4, 0xff, 0xb6, 0x8c, 0x00, 0xff, 0xb1, 0x85, 0x0b, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb1, 0x86, 0x0c, 0xff, 0xb2, 0x85, 0x05, 0xff, 0x9f, 0x93, 0x23, 0xff, 0x1e, 0x98, 0xed, 0xff, 0x1c, 0x8a, 0xeb, 0xff, 0x1d, 0x8a, 0xeb, 0xff, 0x1d, 0x8a, 0xeb, 0xff, 0x1d, 0x8a, 0xeb, 0xff, 0x1f, 0x8e, 0xef, 0xff, 0x4b, 0x8d, 0xc8, 0xff, 0xae, 0x86, 0x15, 0xff, 0xb5, 0x8b, 0x0f, 0xff, 0xb9, 0x8a, 0x12, 0xff, 0xab, 0x73, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xab, 0x74, 0x09, 0xff, 0xaa, 0x73, 0x09, 0xff, 0xb1, 0x7e, 0x0d, 0xff, 0xba, 0x8a, 0x12, 0xff, 0xb4, 0x82, 0x10, 0xff, 0xb3, 0x80, 0x0f, 0xff, 0xb5, 0x84, 0x10, 0xff, 0xbc, 0x8d, 0x13, 0xfc, 0xc7, 0x9e, 0x1a, 0xd7, 0xd3, 0xaf, 0x22, 0x68, 0xc4, 0x83, 0x00, 0x00, 0xd1, 0xb0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x00, 0xba, 0xba, 0xba, 0x74, 0xbe, 0xc0, 0xc3, 0xff, 0xb2, 0x86, 0x00, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb0, 0x89, 0x05, 0xff, 0x56, 0xa5, 0xd9, 0xff, 0x19, 0x8e, 0xeb, 0xff, 0x1c, 0x90, 0xeb, 0xff, 0x1c, 0x90, 0xeb, 0xff, 0x1c, 0x90, 0xeb, 0xff, 0x19, 0x90, 0xec, 0xff, 0x2d, 0x8f, 0xd8, 0xff, 0xab, 0x88, 0x00, 0xff, 0xb2, 0x87, 0x0d, 0xff, 0xbe, 0x95, 0x20, 0xff, 0xa2, 0x83, 0x59, 0xff, 0xa1, 0x83, 0x5d, 0xff, 0xa1, 0x83, 0x5d, 0xff, 0xa0, 0x83, 0x5f, 0xff, 0xa5, 0x7b, 0x36, 0xff, 0xab, 0x75, 0x06, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xab, 0x75, 0x09, 0xff, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xb8, 0x88, 0x11, 0xff, 0xcb, 0xa4, 0x1d, 0xb3, 0xd2, 0xaf, 0x23, 0x18, 0xd2, 0xaf, 0x25, 0x00, 0xd0, 0xac, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x00, 0xb9, 0xb9, 0xb9, 0x17, 0xbb, 0xbd, 0xc1, 0xec, 0xb6, 0x95, 0x16, 0xff, 0xb2, 0x88, 0x08, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb4, 0x87, 0x00, 0xff, 0x85, 0x9e, 0x88, 0xff, 0x00, 0x9a, 0xf5, 0xff, 0x00, 0x96, 0xf4, 0xff, 0x07, 0x96, 0xf1, 0xff, 0x1b, 0x95, 0xed, 0xff, 0x1b, 0x95, 0xec, 0xff, 0x23, 0x95, 0xe4, 0xff, 0x9f, 0x8b, 0x42, 0xff, 0xb3, 0x88, 0x0a, 0xff, 0xbd, 0x92, 0x09, 0xff, 0x90, 0x93, 0x7a, 0xff, 0x36, 0x96, 0xe7, 0xff, 0x39, 0x94, 0xe6, 0xff, 0x39, 0x94, 0xe6, 0xff, 0x36, 0x94, 0xe0, 0xff, 0x9a, 0x7f, 0x5c, 0xff, 0xac, 0x76, 0x07, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xac, 0x77, 0x0a, 0xff, 0xab, 0x76, 0x0a, 0xff, 0xb0, 0x7d, 0x0d, 0xff, 0xc6, 0x9e, 0x1c, 0xc7, 0xd9, 0xb7, 0x2b, 0x0f, 0xd3, 0xad, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xbe, 0xbe, 0x00, 0xb9, 0xbb, 0xc2, 0x67, 0xbc, 0xa8, 0x68, 0xff, 0xb3, 0x89, 0x00, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0e, 0xff, 0xb6, 0x89, 0x00, 0xff, 0xb8, 0x89, 0x00, 0xff, 0xb9, 0x8a, 0x00, 0xff, 0x64, 0x97, 0xac, 0xff, 0x15, 0x9b, 0xf1, 0xff, 0x00, 0x9b, 0xee, 0xff, 0x83, 0x91, 0x6f, 0xff, 0xb8, 0x8e, 0x00, 0xff, 0xb8, 0x90, 0x0d, 0xff, 0xb3, 0x97, 0x18, 0xff, 0x1f, 0x97, 0xec, 0xff, 0x1d, 0x80, 0xe9, 0xff, 0x1e, 0x81, 0xe9, 0xff, 0x1a, 0x81, 0xec, 0xff, 0x5d, 0x7f, 0xb7, 0xff, 0xac, 0x79, 0x00, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xac, 0x79, 0x0a, 0xff, 0xae, 0x7d, 0x0b, 0xff, 0xc8, 0xa4, 0x1e, 0x9f, 0xf6, 0xd0, 0x3c, 0x03, 0xd2, 0xb4, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0xf0, 0xcf, 0x00, 0x00, 0xb9, 0xb0, 0x99, 0xac, 0xb4, 0x8e, 0x1d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0e, 0xff, 0xa8, 0x93, 0x52, 0xff, 0x2b, 0xa7, 0xe8, 0xff, 0x00, 0xa1, 0xef, 0xff, 0x89, 0x9c, 0x8e, 0xff, 0xc9, 0xa3, 0x00, 0xff, 0xc2, 0x9b, 0x19, 0xff, 0xbc, 0x94, 0x00, 0xff, 0x66, 0x9b, 0xcb, 0xff, 0x19, 0x80, 0xea, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x1f, 0x82, 0xea, 0xff, 0x00, 0x81, 0xd3, 0xff, 0xaa, 0x7b, 0x00, 0xff, 0xad, 0x7b, 0x08, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0xad, 0x7a, 0x0a, 0xff, 0xb3, 0x84, 0x0f, 0xf4, 0xcb, 0xa8, 0x1d, 0x2b, 0xd3, 0xb8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8, 0x00, 0xc0, 0xb8, 0x81, 0x13, 0xb7, 0x9c, 0x49, 0xe3, 0xb4, 0x8b, 0x02, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb4, 0x8c, 0x0d, 0xff, 0xb7, 0x89, 0x00, 0xff, 0x6b, 0xad, 0xa8, 0xff, 0x00, 0xa8, 0xf6, 0xff, 0x61, 0xa5, 0xc4, 0xff, 0xc0, 0x9b, 0x00, 0xff, 0xb1, 0x80, 0x0b, 0xff, 0xae, 0x79, 0x00, 0xff, 0x96, 0x8b, 0x74, 0xff, 0x20, 0x88, 0xe8, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x1c, 0x82, 0xe7, 0xff, 0x94, 0x7f, 0x5f, 0xff, 0xb0, 0x7b, 0x00, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xae, 0x7c, 0x0a, 0xff, 0xaf, 0x7e, 0x0b, 0xff, 0xc6, 0x9e, 0x1b, 0x84, 0xcf, 0xab, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xa8, 0x3f, 0x00, 0xbb, 0xb7, 0xa6, 0x2f, 0xb4, 0x99, 0x3e, 0xf7, 0xb4, 0x8d, 0x03, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb5, 0x8d, 0x06, 0xff, 0x9d, 0x9e, 0x26, 0xff, 0x00, 0xb6, 0xf9, 0xff, 0x2d, 0xad, 0xc7, 0xff, 0xb7, 0x90, 0x00, 0xff, 0xaf, 0x7e, 0x09, 0xff, 0xaf, 0x7e, 0x0c, 0xff, 0xab, 0x81, 0x00, 0xff, 0x39, 0x9c, 0xe4, 0xff, 0x1c, 0x85, 0xe9, 0xff, 0x1e, 0x85, 0xe9, 0xff, 0x1e, 0x85, 0xe9, 0xff, 0x37, 0x87, 0xd7, 0xff, 0x84, 0x9a, 0x7b, 0xff, 0x8b, 0x99, 0x7d, 0xff, 0xac, 0x81, 0x16, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xaf, 0x7f, 0x0b, 0xff, 0xae, 0x7e, 0x0b, 0xff, 0xbd, 0x94, 0x17, 0xcf, 0xc1, 0x9a, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x00, 0xbb, 0xc1, 0xcd, 0x00, 0xb9, 0xb3, 0xa5, 0x2f, 0xb6, 0x9c, 0x48, 0xe3, 0xb4, 0x90, 0x1c, 0xff, 0xb4, 0x8e, 0x00, 0xff, 0xb4, 0x8e, 0x0a, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb3, 0x8f, 0x00, 0xff, 0x55, 0xbc, 0xd4, 0xff, 0x25, 0xb1, 0xe4, 0xff, 0xb2, 0x99, 0x40, 0xff, 0xad, 0x7e, 0x0d, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x81, 0x00, 0xff, 0x6c, 0xa2, 0xb8, 0xff, 0x12, 0x86, 0xec, 0xff, 0x1d, 0x8a, 0xea, 0xff, 0x1d, 0x8a, 0xea, 0xff, 0x1d, 0x89, 0xea, 0xff, 0x20, 0x8e, 0xec, 0xff, 0x13, 0x9a, 0xf3, 0xff, 0x7f, 0x8d, 0x87, 0xff, 0xb1, 0x80, 0x00, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x80, 0x0b, 0xff, 0xb5, 0x8a, 0x10, 0xfb, 0xb7, 0x8c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xba, 0xba, 0x00, 0xb8, 0xa1, 0x35, 0x00, 0xb9, 0xb1, 0x79, 0x13, 0xb7, 0xaf, 0x97, 0xac, 0xb7, 0xa2, 0x62, 0xff, 0xb6, 0x95, 0x0e, 0xff, 0xb5, 0x8d, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xb5, 0x8b, 0x00, 0xff, 0xa2, 0x9c, 0x5a, 0xff, 0x00, 0xbf, 0xf2, 0xff, 0x99, 0x99, 0x40, 0xff, 0xb4, 0x88, 0x00, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0e, 0xff, 0x9f, 0x8e, 0x61, 0xff, 0x27, 0x96, 0xea, 0xff, 0x1c, 0x8e, 0xeb, 0xff, 0x1c, 0x8e, 0xeb, 0xff, 0x1c, 0x8e, 0xeb, 0xff, 0x1c, 0x8e, 0xeb, 0xff, 0x0c, 0x8e, 0xec, 0xff, 0x78, 0x88, 0x91, 0xff, 0xb2, 0x82, 0x00, 0xff, 0xb0, 0x83, 0x0c, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb2, 0x85, 0x0c, 0xff, 0xb2, 0x86, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xb8, 0xb8, 0x00, 0xbc, 0x98, 0x00, 0x00, 0xb7, 0xb9, 0xc0, 0x67, 0xb7, 0xb9, 0xbc, 0xec, 0xb8, 0xba, 0xbd, 0xff, 0xb8, 0xba, 0xbe, 0xff, 0xb9, 0xbb, 0xbe, 0xff, 0xba, 0xbc, 0xbf, 0xff, 0xbd, 0xbb, 0xbd, 0xff, 0x48, 0xce, 0xee, 0xff, 0x82, 0xbc, 0xd1, 0xff, 0xbd, 0xb4, 0xac, 0xff, 0xb2, 0x85, 0x00, 0xff, 0xb1, 0x84, 0x0b, 0xff, 0xb0, 0x85, 0x00, 0xff, 0x3f, 0xab, 0xd4, 0xff, 0x00, 0x94, 0xf0, 0xff, 0x08, 0x94, 0xee, 0xff, 0x1b, 0x94, 0xec, 0xff, 0x1b, 0x94, 0xec, 0xff, 0x16, 0x94, 0xef, 0xff, 0x52, 0x90, 0xc2, 0xff, 0xae, 0x85, 0x00, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb4, 0x88, 0x0e, 0xe0, 0xb5, 0x8a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb6, 0xb6, 0x00, 0xbb, 0xbb, 0xbb, 0x00, 0xb5, 0xb5, 0xb5, 0x17, 0xb5, 0xb5, 0xb5, 0x74, 0xb6, 0xb6, 0xb6, 0xe0, 0xb6, 0xb6, 0xb6, 0xff, 0xb8, 0xb6, 0xb5, 0xff, 0x8b, 0xc7, 0xd0, 0xff, 0x52, 0xc4, 0xe3, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xaf, 0xa6, 0xff, 0xb2, 0x85, 0x00, 0xff, 0xb2, 0x86, 0x0a, 0xff, 0xad, 0x8a, 0x19, 0xff, 0xa0, 0x8d, 0x7b, 0xff, 0xa1, 0x8a, 0x74, 0xff, 0x95, 0x8b, 0x86, 0xff, 0x16, 0x98, 0xe7, 0xff, 0x17, 0x99, 0xef, 0xff, 0x13, 0x97, 0xca, 0xff, 0xae, 0x87, 0x00, 0xff, 0xb2, 0x86, 0x09, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x86, 0x0c, 0xff, 0xba, 0x92, 0x13, 0xa4, 0xbe, 0x97, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0xa5, 0x00, 0xb4, 0xb4, 0xb4, 0x00, 0xb9, 0xb9, 0xb9, 0x00, 0xb5, 0xb5, 0xb5, 0x54, 0xae, 0xb8, 0xb9, 0xac, 0x4f, 0xcd, 0xe6, 0xe8, 0xb9, 0xb4, 0xb1, 0xec, 0xb6, 0xb6, 0xb6, 0xf8, 0xb4, 0xad, 0xa3, 0xff, 0xb2, 0x88, 0x00, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb5, 0x86, 0x00, 0xff, 0x74, 0xa6, 0xa0, 0xff, 0x0f, 0xa1, 0xf2, 0xff, 0x22, 0x9e, 0xe3, 0xff, 0xa6, 0x8b, 0x45, 0xff, 0xb2, 0x88, 0x10, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xff, 0xb2, 0x88, 0x0c, 0xfc, 0xba, 0x95, 0x14, 0x48, 0xc3, 0xa5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x00, 0x88, 0xd0, 0xd9, 0x00, 0x00, 0xe9, 0xff, 0x2f, 0x63, 0xcd, 0xe0, 0x23, 0xb7, 0xb4, 0xb3, 0x1b, 0xb4, 0xb4, 0xb4, 0x27, 0xb6, 0xa6, 0x86, 0x48, 0xb4, 0x8b, 0x0b, 0xf4, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x89, 0x08, 0xff, 0xa1, 0x97, 0x00, 0xff, 0x00, 0xaf, 0xf4, 0xff, 0x00, 0xa6, 0xf8, 0xff, 0x8e, 0x91, 0x59, 0xff, 0xb4, 0x8a, 0x00, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8a, 0x0d, 0xff, 0xb3, 0x8b, 0x0e, 0xcf, 0xbe, 0x9e, 0x18, 0x0b, 0xe4, 0x97, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe8, 0xff, 0x00, 0x1f, 0xe8, 0xff, 0x14, 0x18, 0xe2, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xb3, 0x21, 0x04, 0xb4, 0x8d, 0x0e, 0xb7, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8c, 0x00, 0xff, 0x5c, 0xb6, 0xcc, 0xff, 0x04, 0xab, 0xf3, 0xff, 0x78, 0x9a, 0x7c, 0xff, 0xb8, 0x8a, 0x00, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xf7, 0xbb, 0x96, 0x12, 0x38, 0xbb, 0x97, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe8, 0xff, 0x00, 0x1f, 0xe8, 0xff, 0x00, 0x1f, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x94, 0x0e, 0x00, 0xc6, 0xa1, 0x14, 0x1b, 0xb4, 0x8c, 0x0d, 0xe3, 0xb4, 0x8d, 0x0f, 0xff, 0xa4, 0x99, 0x5f, 0xff, 0x18, 0xb7, 0xf3, 0xff, 0x52, 0xa6, 0xb5, 0xff, 0xb3, 0x8d, 0x00, 0xff, 0xb4, 0x8d, 0x0e, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xff, 0xb4, 0x8d, 0x0d, 0xef, 0xb8, 0x92, 0x11, 0x44, 0xb1, 0x55, 0x00, 0x00, 0xcf, 0xe7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa6, 0x16, 0x00, 0xcd, 0xab, 0x1b, 0x00, 0xbe, 0x99, 0x17, 0x1c, 0xb8, 0x8a, 0x00, 0xc8, 0x54, 0xbb, 0xba, 0xff, 0x37, 0xb2, 0xd3, 0xff, 0xb4, 0x8d, 0x00, 0xff, 0xb4, 0x8e, 0x0e, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xff, 0xb4, 0x8e, 0x0d, 0xf7, 0xb4, 0x8d, 0x0d, 0xc0, 0xb7, 0x93, 0x13, 0x2b, 0xba, 0x83, 0x06, 0x00, 0xc3, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x9e, 0x18, 0x00, 0x68, 0xcc, 0xd4, 0x00, 0x57, 0xd8, 0xe2, 0x54, 0x1a, 0xc1, 0xed, 0xff, 0xa4, 0x96, 0x40, 0xc0, 0xb6, 0x8f, 0x0e, 0xf0, 0xb5, 0x8f, 0x0d, 0xfc, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0d, 0xfb, 0xb5, 0x8f, 0x0e, 0xfb, 0xb5, 0x8f, 0x0d, 0xdb, 0xb6, 0x8f, 0x0d, 0xa0, 0xb8, 0x93, 0x12, 0x47, 0xbe, 0x9a, 0x19, 0x07, 0xb7, 0x93, 0x12, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xe3, 0xf8, 0x00, 0x3c, 0xf1, 0xff, 0x07, 0x1d, 0xd2, 0xf9, 0xd7, 0x00, 0xc5, 0xfa, 0x3f, 0x9c, 0x9e, 0x78, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb7, 0x91, 0x0e, 0x00, 0xff, 0xee, 0x3e, 0x07, 0xba, 0x94, 0x12, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb5, 0x8f, 0x0e, 0x00, 0xb5, 0x8f, 0x0d, 0x00, 0xb6, 0x8f, 0x0e, 0x00, 0xba, 0x98, 0x16, 0x00, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xe3, 0xf7, 0x00, 0x22, 0xdc, 0xf9, 0x40, 0x16, 0xd3, 0xfa, 0x54, 0x0e, 0xc9, 0xf8, 0x00, 0x0e, 0xc6, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xd9, 0xbb, 0x26, 0x0b, 0xc1, 0x93, 0x17, 0xdb, 0xe5, 0xc7, 0x2f, 0x10, 0xd3, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xe8, 0xf8, 0x00, 0x1d, 0xc0, 0xff, 0x00, 0x21, 0xe2, 0xfb, 0x78, 0x4f, 0xff, 0xff, 0x00, 0x15, 0xd4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xaa, 0x1c, 0x00, 0xd2, 0xad, 0x26, 0x00, 0xc6, 0x9c, 0x1d, 0x4f, 0xac, 0x77, 0x0a, 0xff, 0xc6, 0x9c, 0x1a, 0xb7, 0xaa, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe8, 0xfd, 0x00, 0x20, 0xe8, 0xfd, 0x20, 0x00, 0xda, 0xfa, 0x07, 0x0e, 0xd9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x9d, 0x1f, 0x00, 0xbf, 0x94, 0x17, 0xec, 0xac, 0x78, 0x09, 0xff, 0xb3, 0x82, 0x0f, 0xf4, 0xcc, 0xa7, 0x1f, 0x1f, 0xd2, 0xb2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xaa, 0x2a, 0x00, 0xcd, 0xa6, 0x09, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0xd1, 0xa8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe8, 0xff, 0x00, 0x1f, 0xe8, 0xff, 0x00, 0x1f, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xad, 0x24, 0x00, 0xd3, 0xb4, 0x27, 0x5f, 0xae, 0x7e, 0x0a, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0c, 0xff, 0xc5, 0xa0, 0x1e, 0x7f, 0xd0, 0xaf, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xae, 0x25, 0x00, 0xdd, 0xc1, 0x2d, 0x08, 0xcb, 0xa1, 0x1c, 0x94, 0xc2, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x94, 0x15, 0x00, 0xbc, 0x95, 0x15, 0xbf, 0xb0, 0x83, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 0xb0, 0x84, 0x0b, 0xff, 0xbe, 0x96, 0x17, 0xdf, 0xc1, 0x9b, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x97, 0x11, 0x00, 0xc5, 0x9c, 0x1a, 0xa4, 0xb1, 0x7e, 0x0e, 0xf8, 0xcf, 0xa8, 0x1e, 0x1c, 0xd0, 0xad, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8a, 0x0d, 0x00, 0xb3, 0x8a, 0x0d, 0x97, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb2, 0x89, 0x0c, 0xff, 0xb6, 0x90, 0x10, 0xb7, 0xb8, 0x92, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xcf, 0x47, 0x00, 0xd0, 0xac, 0x22, 0x1c, 0xb2, 0x81, 0x0f, 0xef, 0xad, 0x78, 0x0a, 0xff, 0xc4, 0x9c, 0x1c, 0x94, 0xce, 0xaa, 0x22, 0x00, 0xd2, 0xb2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x95, 0x14, 0x00, 0xd1, 0xab, 0x21, 0x03, 0xb3, 0x8d, 0x0d, 0x9b, 0xb4, 0x8d, 0x0d, 0xff, 0xb5, 0x8d, 0x0d, 0xc3, 0xb8, 0x92, 0x12, 0x18, 0xc1, 0xa0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xb4, 0x28, 0x00, 0xc7, 0xa2, 0x20, 0x78, 0xaf, 0x7f, 0x0b, 0xff, 0xad, 0x7d, 0x0b, 0xff, 0xb7, 0x8a, 0x12, 0xff, 0xe7, 0xce, 0x36, 0x14, 0xd4, 0xb4, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8d, 0x0c, 0x00, 0xb3, 0x8d, 0x0d, 0x00, 0xb4, 0x8e, 0x0d, 0x00, 0xb5, 0x8e, 0x0d, 0x00, 0xb6, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x9c, 0x19, 0x00, 0xbe, 0x97, 0x16, 0xec, 0xb0, 0x81, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xaf, 0x7f, 0x09, 0xff, 0xcb, 0xa8, 0x20, 0x83, 0xc8, 0xa4, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x8b, 0x0e, 0x00, 0xb3, 0x8a, 0x0e, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb2, 0x87, 0x0c, 0xff, 0xb1, 0x87, 0x0c, 0xff, 0xba, 0x94, 0x13, 0x94, 0xb9, 0x93, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x94, 0x13, 0x00, 0xb7, 0x90, 0x10, 0x5f, 0xb3, 0x8c, 0x0d, 0xf8, 0xb3, 0x8c, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xe8, 0xce, 0xb1, 0x27, 0x0c, 0xc0, 0x9e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x92, 0x12, 0x00, 0x96, 0x7b, 0x00, 0x00, 0xb4, 0x8e, 0x0e, 0x23, 0xb4, 0x8e, 0x0d, 0x33, 0xb7, 0x8f, 0x0c, 0x0f, 0xbc, 0x97, 0x15, 0x00, 0xbe, 0x9b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x09, 0xba, 0xba, 0xba, 0x38, 0xb9, 0xb9, 0xb9, 0x6f, 0xbb, 0xbb, 0xbb, 0x9b, 
+  0xbb, 0xbb, 0xbb, 0xb8, 0xba, 0xba, 0xba, 0xcb, 0xb9, 0xb9, 0xb9, 0xc0, 0xb9, 0xb9, 0xb9, 0xa7, 0xb7, 0xb7, 0xb7, 0x7f, 0xb7, 0xb7, 0xb7, 0x4c, 0xbc, 0xbc, 0xbc, 0x0f, 0xb1, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0xbc, 0xbc, 0xbc, 0x0c, 0xbd, 0xbd, 0xbd, 0x33, 0xbd, 0xbd, 0xbd, 0x9b, 0xbd, 0xbd, 0xbd, 0xeb, 0x81, 0xbd, 0xbd, 0xbd, 0xff, 0x00, 0xbe, 0xbe, 0xbe, 0xff, 0x81, 0xbc, 0xbc, 0xbc, 
+  0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x81, 0xba, 0xba, 0xba, 0xff, 0x03, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xb7, 0xb6, 0xb6, 0xb6, 0x5c, 0xb5, 0xb5, 0xb5, 0x14, 0xad, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xbe, 0xbe, 0xbe, 0x57, 0xbe, 0xbe, 0xbe, 0xd3, 0xbf, 0xbf, 0xbf, 0xf8, 0x81, 0xbf, 0xbf, 0xbf, 0xff, 0x83, 0xc0, 0xc0, 0xc0, 0xff, 0x00, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xbe, 0xbe, 
+  0xbe, 0xff, 0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x05, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb7, 0xb7, 0xb7, 0xeb, 0xb6, 0xb6, 0xb6, 0x80, 0xb0, 0xb0, 0xb0, 0x07, 
+  0xa9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbe, 0xbe, 0xbe, 0x23, 0xbf, 0xbf, 0xbf, 0xab, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x02, 0xc3, 0xc3, 0xc3, 0xff, 
+  0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x82, 0xc2, 0xc2, 0xc2, 0xff, 0x04, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 
+  0xbc, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x03, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xd7, 0xb3, 0xb3, 0xb3, 0x4c, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xbf, 
+  0xbf, 0x4c, 0xbf, 0xbf, 0xbf, 0xf0, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc4, 0xc4, 0xc4, 0xff, 0x01, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 
+  0x83, 0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x07, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 
+  0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xf8, 0xb4, 0xb4, 0xb4, 0x87, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbf, 0xbf, 0xbf, 0x5b, 0xc0, 0xc0, 0xc0, 0xfb, 0xc2, 0xc2, 
+  0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x83, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x01, 
+  0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x07, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 
+  0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x9f, 0xb3, 0xb3, 0xb3, 0x0f, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 0x60, 0xc1, 0xc1, 0xc1, 0xfb, 0xc2, 0xc2, 0xc2, 0xff, 
+  0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x83, 0xca, 0xca, 0xca, 0xff, 0x00, 0xcb, 0xcb, 0xcb, 0xff, 0x82, 0xca, 0xca, 0xca, 0xff, 0x00, 
+  0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x0a, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 
+  0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0x9f, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 0x33, 
+  0xc1, 0xc1, 0xc1, 0xf7, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xcc, 0xcc, 
+  0xcc, 0xff, 0x01, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0x81, 0xcd, 0xcd, 0xcd, 0xff, 0x0f, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc8, 0xc8, 0xc8, 
+  0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 
+  0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0x87, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbe, 0xbe, 0xbe, 0x18, 0xc0, 0xc0, 0xc0, 0xd8, 0xc2, 
+  0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 0xcb, 0xcb, 0xcb, 0xff, 0x00, 0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xd0, 
+  0xd0, 0xd0, 0xff, 0x82, 0xcf, 0xcf, 0xcf, 0xff, 0x08, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc7, 0xc7, 0xc7, 
+  0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xbf, 0xbf, 0xbf, 0xff, 0x05, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 
+  0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xf8, 0xb3, 0xb3, 0xb3, 0x4c, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc0, 0xc0, 0xc0, 0x97, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 
+  0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xca, 0xca, 0xca, 
+  0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x81, 0xd1, 0xd1, 0xd1, 0xff, 0x11, 0xd0, 0xd1, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcc, 0xc3, 0xff, 0xcd, 0xc8, 0xbc, 0xff, 0xcc, 
+  0xc6, 0xb8, 0xff, 0xcc, 0xc5, 0xb7, 0xff, 0xca, 0xc3, 0xb5, 0xff, 0xc7, 0xc2, 0xb4, 0xff, 0xc6, 0xc2, 0xb8, 0xff, 0xc2, 0xc1, 0xbd, 0xff, 0xbf, 0xc0, 0xc1, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 
+  0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xd7, 0xa9, 0xa9, 0xa9, 0x07, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbf, 0xbf, 0xbf, 
+  0x28, 0xc1, 0xc1, 0xc1, 0xf3, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc1, 0xc1, 0xc1, 
+  0xff, 0xc6, 0xc6, 0xc6, 0xff, 0x81, 0xc7, 0xc7, 0xc7, 0xff, 0x16, 0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd5, 0xff, 0xd3, 
+  0xc9, 0xa3, 0xff, 0xd1, 0xb7, 0x6e, 0xff, 0xc5, 0x9e, 0x3d, 0xff, 0xbc, 0x8f, 0x1d, 0xff, 0xb6, 0x84, 0x00, 0xff, 0xb3, 0x7d, 0x00, 0xff, 0xb4, 0x81, 0x00, 0xff, 0xb9, 0x8a, 0x12, 0xff, 0xc1, 
+  0x97, 0x31, 0xff, 0xc9, 0xa9, 0x53, 0xff, 0xc9, 0xba, 0x84, 0xff, 0xc0, 0xbe, 0xb6, 0xff, 0xbc, 0xbd, 0xbe, 0xff, 0xbb, 0xbb, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 
+  0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x80, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc0, 0xc0, 0xc0, 0x9c, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 
+  0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x09, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 
+  0xc7, 0xc7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xcf, 0xbd, 0xff, 0xcd, 0xb1, 0x58, 0xff, 0xbc, 0x8b, 0x00, 0xff, 0xac, 0x73, 0x03, 0xff, 0xa7, 0x6d, 0x08, 0xff, 0xa8, 0x6f, 0x08, 0xff, 0x82, 
+  0xa9, 0x70, 0x09, 0xff, 0x0b, 0xa8, 0x6f, 0x09, 0xff, 0xa8, 0x6e, 0x08, 0xff, 0xa8, 0x6e, 0x06, 0xff, 0xb7, 0x82, 0x00, 0xff, 0xc5, 0xa1, 0x2e, 0xff, 0xc3, 0xb8, 0x95, 0xff, 0xbc, 0xbc, 0xb8, 
+  0xff, 0xb9, 0xb9, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xeb, 0xb0, 0xb0, 0xb0, 0x14, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x12, 0xc0, 0xc0, 0xc0, 0x1b, 0xc0, 
+  0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 
+  0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcb, 0xff, 0xc8, 0xca, 0xcf, 0xff, 0xd5, 0xc7, 0x96, 0xff, 0xc0, 0x96, 0x2c, 0xff, 0xac, 
+  0x74, 0x00, 0xff, 0xa9, 0x71, 0x08, 0xff, 0x88, 0xaa, 0x72, 0x09, 0xff, 0x08, 0xa9, 0x71, 0x09, 0xff, 0xab, 0x73, 0x04, 0xff, 0xb8, 0x87, 0x0e, 0xff, 0xc5, 0xab, 0x62, 0xff, 0xbb, 0xba, 0xb7, 
+  0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0x5c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x10, 0xc0, 0xc0, 0xc0, 0x70, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 
+  0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xcc, 
+  0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcd, 0xcd, 0xff, 0xcc, 0xbc, 0x87, 0xff, 0xb9, 0x87, 0x00, 0xff, 0xa9, 0x71, 0x08, 0xff, 0x8c, 0xaa, 0x72, 0x09, 0xff, 
+  0x09, 0xa9, 0x71, 0x09, 0xff, 0xb1, 0x7b, 0x00, 0xff, 0xc4, 0xa8, 0x54, 0xff, 0xbb, 0xb8, 0xaf, 0xff, 0xbb, 0xb6, 0xa8, 0xff, 0xbb, 0xb4, 0xa4, 0xff, 0xbb, 0xb1, 0x9b, 0xbf, 0xdc, 0xb0, 0x00, 
+  0x23, 0xd5, 0xb1, 0x23, 0x1f, 0xd4, 0xb1, 0x23, 0x0c, 0x96, 0x00, 0x00, 0x00, 0x00, 0x10, 0xb8, 0xb8, 0xb8, 0x03, 0xc0, 0xc0, 0xc0, 0xcb, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 
+  0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 
+  0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xd0, 0xff, 0xcb, 0xc0, 0x99, 0xff, 0xb6, 0x88, 0x15, 0xff, 0xa9, 0x73, 0x09, 0xff, 0x8e, 0xaa, 0x74, 0x09, 0xff, 0x0a, 0xaa, 0x73, 0x09, 0xff, 0xae, 0x7a, 0x01, 
+  0xff, 0xbe, 0x95, 0x26, 0xff, 0xba, 0x8f, 0x19, 0xff, 0xb5, 0x86, 0x00, 0xff, 0xb4, 0x83, 0x00, 0xff, 0xb7, 0x88, 0x13, 0xfc, 0xbd, 0x90, 0x15, 0xef, 0xc7, 0x9e, 0x1a, 0xdb, 0xd1, 0xae, 0x20, 
+  0x80, 0xd2, 0xb0, 0x23, 0x18, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbf, 0xbf, 0xbf, 0x13, 0xc1, 0xc1, 0xc1, 0xe4, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 
+  0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xcf, 0xff, 0xd0, 
+  0xcd, 0xbe, 0xff, 0xc1, 0x9b, 0x20, 0xff, 0xab, 0x75, 0x04, 0xff, 0x91, 0xab, 0x75, 0x09, 0xff, 0x01, 0xaa, 0x73, 0x08, 0xff, 0xaa, 0x74, 0x08, 0xff, 0x82, 0xab, 0x75, 0x09, 0xff, 0x05, 0xaa, 
+  0x74, 0x08, 0xff, 0xaa, 0x73, 0x08, 0xff, 0xb4, 0x83, 0x0f, 0xff, 0xc5, 0x9c, 0x19, 0xe8, 0xcf, 0xaa, 0x1e, 0x57, 0xdc, 0xb5, 0x1f, 0x04, 0x92, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 
+  0x20, 0xc1, 0xc1, 0xc1, 0xf0, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x05, 0xd5, 
+  0xd5, 0xd5, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdb, 0xdb, 0xd9, 0xff, 0xce, 0xb8, 0x76, 0xff, 0xaa, 0x73, 0x00, 0xff, 0x99, 0xab, 0x76, 0x0a, 0xff, 0x04, 0xab, 0x75, 0x0a, 
+  0xff, 0xac, 0x77, 0x0a, 0xff, 0xb7, 0x88, 0x12, 0xfb, 0xcb, 0xa7, 0x20, 0x90, 0xe1, 0xbf, 0x2f, 0x04, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc0, 0xc0, 0xc0, 0x2b, 0xc1, 0xc1, 0xc1, 0xfb, 0xc4, 
+  0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 
+  0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd5, 0xcb, 0xff, 0xb8, 0x8c, 0x2c, 0xff, 0x9c, 0xac, 0x77, 0x0a, 0xff, 0x02, 0xab, 0x76, 0x09, 0xff, 0xb5, 0x84, 0x10, 0xff, 0xca, 0xa6, 0x1e, 
+  0x7c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xbf, 0xbf, 0xbf, 0x30, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 
+  0xce, 0xce, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd4, 0xff, 0xd6, 0xd7, 0xda, 0xff, 0xd8, 0xda, 0xdd, 0xff, 0xda, 0xdc, 0xe2, 0xff, 0xd3, 0xc7, 0xa5, 0xff, 0xaf, 0x7b, 0x00, 0xff, 0x9d, 
+  0xad, 0x79, 0x0a, 0xff, 0x02, 0xad, 0x78, 0x0a, 0xff, 0xb8, 0x8a, 0x12, 0xff, 0xd5, 0xb2, 0x24, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xbf, 0xbf, 0xbf, 0x33, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 
+  0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd1, 0xcd, 0xff, 0xd3, 0xcd, 0xbc, 0xff, 0xd1, 0xbe, 0x77, 0xff, 0xce, 
+  0xb0, 0x32, 0xff, 0xcc, 0xa7, 0x00, 0xff, 0xbe, 0x92, 0x00, 0xff, 0xac, 0x79, 0x0b, 0xff, 0x85, 0xad, 0x7a, 0x0a, 0xff, 0x00, 0xad, 0x7a, 0x0b, 0xff, 0x84, 0xae, 0x79, 0x00, 0xff, 0x00, 0xad, 
+  0x7a, 0x09, 0xff, 0x91, 0xad, 0x7a, 0x0a, 0xff, 0x02, 0xab, 0x78, 0x09, 0xff, 0xbf, 0x94, 0x16, 0xd3, 0xd9, 0xb6, 0x27, 0x0c, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0xc0, 0xc0, 0x2f, 0xc0, 
+  0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcc, 0xc9, 0xff, 0xcf, 0xba, 0x6f, 0xff, 0xbf, 0x97, 0x1e, 0xff, 0xb2, 
+  0x82, 0x00, 0xff, 0xaf, 0x7d, 0x06, 0xff, 0xad, 0x7b, 0x09, 0xff, 0xad, 0x7b, 0x0a, 0xff, 0x86, 0xae, 0x7c, 0x0b, 0xff, 0x07, 0xaf, 0x7b, 0x00, 0xff, 0x92, 0x93, 0x70, 0xff, 0x7c, 0xa5, 0xb1, 
+  0xff, 0x7c, 0xa4, 0xaf, 0xff, 0x7d, 0xa4, 0xae, 0xff, 0x79, 0xa6, 0xb8, 0xff, 0xa1, 0x83, 0x1f, 0xff, 0xae, 0x7b, 0x07, 0xff, 0x91, 0xae, 0x7c, 0x0b, 0xff, 0x01, 0xb2, 0x82, 0x0e, 0xfb, 0xcb, 
+  0xa4, 0x21, 0x3f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbf, 0xbf, 0xbf, 0x27, 0xc0, 0xc0, 0xc0, 0xf8, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc8, 0xff, 0xca, 0xca, 0xc6, 
+  0xff, 0xcb, 0xb2, 0x52, 0xff, 0xb4, 0x84, 0x00, 0xff, 0xad, 0x7c, 0x0a, 0xff, 0x89, 0xae, 0x7d, 0x0b, 0xff, 0x07, 0xae, 0x7d, 0x0c, 0xff, 0xa7, 0x83, 0x31, 0xff, 0x43, 0x94, 0xe1, 0xff, 0x1e, 
+  0x87, 0xed, 0xff, 0x1e, 0x88, 0xed, 0xff, 0x1a, 0x88, 0xee, 0xff, 0x4f, 0x85, 0xb5, 0xff, 0xb3, 0x7c, 0x00, 0xff, 0x85, 0xae, 0x7d, 0x0b, 0xff, 0x00, 0xad, 0x7d, 0x0a, 0xff, 0x81, 0xad, 0x7c, 
+  0x0a, 0xff, 0x00, 0xad, 0x7d, 0x0a, 0xff, 0x88, 0xae, 0x7d, 0x0b, 0xff, 0x01, 0xae, 0x7e, 0x0b, 0xff, 0xc3, 0x9c, 0x1c, 0x93, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x07, 0xbc, 0xbc, 0xbc, 0x1c, 0xbf, 
+  0xbf, 0xbf, 0xec, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc6, 0xc3, 0xff, 0xca, 0xb4, 0x6a, 0xff, 0xb1, 0x81, 0x00, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0x8a, 0xaf, 0x80, 0x0b, 0xff, 
+  0x02, 0xb3, 0x7d, 0x00, 0xff, 0x74, 0x9a, 0xa3, 0xff, 0x1a, 0x83, 0xeb, 0xff, 0x81, 0x1f, 0x82, 0xe9, 0xff, 0x02, 0x2d, 0x82, 0xde, 0xff, 0xa1, 0x80, 0x39, 0xff, 0xaf, 0x80, 0x0c, 0xff, 0x82, 
+  0xaf, 0x80, 0x0b, 0xff, 0x09, 0xae, 0x7f, 0x0a, 0xff, 0xb0, 0x81, 0x0b, 0xff, 0xbc, 0x90, 0x13, 0xff, 0xc3, 0x9a, 0x19, 0xff, 0xc9, 0xa1, 0x1c, 0xff, 0xcb, 0xa2, 0x1d, 0xff, 0xc6, 0x9c, 0x1a, 
+  0xff, 0xbe, 0x94, 0x15, 0xff, 0xb3, 0x85, 0x0e, 0xff, 0xae, 0x7f, 0x0a, 0xff, 0x85, 0xaf, 0x80, 0x0b, 0xff, 0x01, 0xae, 0x7f, 0x0b, 0xff, 0xbb, 0x93, 0x16, 0xd3, 0x8f, 0x00, 0x00, 0x00, 0x00, 
+  0x05, 0xbc, 0xbc, 0xbc, 0x0c, 0xbf, 0xbf, 0xbf, 0xe0, 0xc0, 0xc0, 0xc0, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc1, 0xb0, 0xff, 0xb7, 0x8f, 0x18, 0xff, 0x8b, 0xaf, 0x81, 0x0b, 0xff, 0x07, 0xb0, 
+  0x81, 0x00, 0xff, 0x99, 0x91, 0x55, 0xff, 0x04, 0x8e, 0xf5, 0xff, 0x1f, 0x81, 0xe9, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x0f, 0x82, 0xee, 0xff, 0x77, 0x82, 0x87, 0xff, 0xb1, 0x81, 0x00, 0xff, 0x82, 
+  0xaf, 0x81, 0x0b, 0xff, 0x0b, 0xb2, 0x85, 0x0d, 0xff, 0xbe, 0x92, 0x15, 0xff, 0xc4, 0x9a, 0x19, 0xff, 0xba, 0x88, 0x13, 0xff, 0xb0, 0x7a, 0x0d, 0xff, 0xa9, 0x70, 0x09, 0xff, 0xa8, 0x6e, 0x08, 
+  0xff, 0xae, 0x77, 0x0b, 0xff, 0xb6, 0x83, 0x11, 0xff, 0xc2, 0x95, 0x18, 0xff, 0xc0, 0x95, 0x16, 0xff, 0xb5, 0x89, 0x10, 0xff, 0x85, 0xaf, 0x81, 0x0b, 0xff, 0x00, 0xb5, 0x8a, 0x10, 0xfc, 0x90, 
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xbd, 0xbd, 0xbd, 0xa8, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc2, 0xc5, 0xff, 0xc5, 0xb2, 0x6e, 0xff, 0xb0, 0x82, 0x00, 0xff, 0x8b, 0xb0, 0x83, 0x0b, 0xff, 0x0e, 0xac, 
+  0x87, 0x22, 0xff, 0x4e, 0x94, 0xd6, 0xff, 0x1d, 0x82, 0xe9, 0xff, 0x1f, 0x83, 0xe9, 0xff, 0x1b, 0x83, 0xeb, 0xff, 0x4f, 0x83, 0xad, 0xff, 0xb5, 0x80, 0x00, 0xff, 0xb2, 0x81, 0x00, 0xff, 0xb0, 
+  0x83, 0x0c, 0xff, 0xaf, 0x82, 0x0a, 0xff, 0xb9, 0x8d, 0x11, 0xff, 0xc0, 0x93, 0x16, 0xff, 0xb1, 0x7c, 0x0e, 0xff, 0xaa, 0x72, 0x09, 0xff, 0xa9, 0x70, 0x09, 0xff, 0x83, 0xaa, 0x71, 0x09, 0xff, 
+  0x81, 0xa9, 0x70, 0x09, 0xff, 0x04, 0xad, 0x76, 0x0c, 0xff, 0xba, 0x8b, 0x13, 0xff, 0xbf, 0x95, 0x15, 0xff, 0xaf, 0x81, 0x0a, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0x82, 0xb0, 0x82, 0x0b, 0xff, 0x00, 
+  0xb1, 0x84, 0x0c, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbb, 0xbb, 0xbb, 0x54, 0xbe, 0xbe, 0xbe, 0xff, 0xc0, 0xc2, 0xc6, 0xff, 0xbe, 0x9e, 0x26, 0xff, 0xb0, 0x83, 0x07, 0xff, 0x8a, 0xb0, 
+  0x84, 0x0c, 0xff, 0x02, 0xb2, 0x83, 0x00, 0xff, 0x85, 0x97, 0x92, 0xff, 0x16, 0x8a, 0xec, 0xff, 0x81, 0x1e, 0x87, 0xe9, 0xff, 0x06, 0x1b, 0x86, 0xea, 0xff, 0x54, 0x94, 0xbe, 0xff, 0x69, 0xa6, 
+  0xb1, 0xff, 0x93, 0x94, 0x5f, 0xff, 0xb1, 0x83, 0x02, 0xff, 0xb9, 0x8f, 0x12, 0xff, 0xbe, 0x90, 0x15, 0xff, 0x8a, 0xaa, 0x72, 0x09, 0xff, 0x07, 0xa9, 0x71, 0x08, 0xff, 0xb6, 0x83, 0x11, 0xff, 
+  0xc0, 0x96, 0x16, 0xff, 0xb7, 0x8c, 0x11, 0xff, 0xba, 0x8f, 0x12, 0xff, 0xba, 0x90, 0x13, 0xff, 0xb9, 0x8f, 0x12, 0xff, 0xb7, 0x8d, 0x12, 0xf7, 0x91, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xbd, 
+  0xbd, 0xe0, 0xbf, 0xc1, 0xc4, 0xff, 0xb6, 0x8c, 0x00, 0xff, 0xb1, 0x85, 0x0b, 0xff, 0x89, 0xb1, 0x86, 0x0c, 0xff, 0x03, 0xb2, 0x85, 0x05, 0xff, 0x9f, 0x93, 0x23, 0xff, 0x1e, 0x98, 0xed, 0xff, 
+  0x1c, 0x8a, 0xeb, 0xff, 0x82, 0x1d, 0x8a, 0xeb, 0xff, 0x05, 0x1f, 0x8e, 0xef, 0xff, 0x4b, 0x8d, 0xc8, 0xff, 0xae, 0x86, 0x15, 0xff, 0xb5, 0x8b, 0x0f, 0xff, 0xb9, 0x8a, 0x12, 0xff, 0xab, 0x73, 
+  0x09, 0xff, 0x8b, 0xab, 0x74, 0x09, 0xff, 0x08, 0xaa, 0x73, 0x09, 0xff, 0xb1, 0x7e, 0x0d, 0xff, 0xba, 0x8a, 0x12, 0xff, 0xb4, 0x82, 0x10, 0xff, 0xb3, 0x80, 0x0f, 0xff, 0xb5, 0x84, 0x10, 0xff, 
+  0xbc, 0x8d, 0x13, 0xfc, 0xc7, 0x9e, 0x1a, 0xd7, 0xd3, 0xaf, 0x22, 0x68, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xba, 0xba, 0xba, 0x74, 0xbe, 0xc0, 0xc3, 0xff, 0xb2, 0x86, 0x00, 0xff, 0x8a, 0xb2, 
+  0x87, 0x0c, 0xff, 0x02, 0xb0, 0x89, 0x05, 0xff, 0x56, 0xa5, 0xd9, 0xff, 0x19, 0x8e, 0xeb, 0xff, 0x82, 0x1c, 0x90, 0xeb, 0xff, 0x05, 0x19, 0x90, 0xec, 0xff, 0x2d, 0x8f, 0xd8, 0xff, 0xab, 0x88, 
+  0x00, 0xff, 0xb2, 0x87, 0x0d, 0xff, 0xbe, 0x95, 0x20, 0xff, 0xa2, 0x83, 0x59, 0xff, 0x81, 0xa1, 0x83, 0x5d, 0xff, 0x02, 0xa0, 0x83, 0x5f, 0xff, 0xa5, 0x7b, 0x36, 0xff, 0xab, 0x75, 0x06, 0xff, 
+  0x89, 0xab, 0x75, 0x09, 0xff, 0x00, 0xaa, 0x74, 0x09, 0xff, 0x82, 0xab, 0x75, 0x09, 0xff, 0x04, 0xaa, 0x74, 0x09, 0xff, 0xaa, 0x74, 0x08, 0xff, 0xb8, 0x88, 0x11, 0xff, 0xcb, 0xa4, 0x1d, 0xb3, 
+  0xd2, 0xaf, 0x23, 0x18, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb9, 0xb9, 0xb9, 0x17, 0xbb, 0xbd, 0xc1, 0xec, 0xb6, 0x95, 0x16, 0xff, 0xb2, 0x88, 0x08, 0xff, 0x88, 0xb2, 0x89, 0x0c, 0xff, 0x0c, 
+  0xb4, 0x87, 0x00, 0xff, 0x85, 0x9e, 0x88, 0xff, 0x00, 0x9a, 0xf5, 0xff, 0x00, 0x96, 0xf4, 0xff, 0x07, 0x96, 0xf1, 0xff, 0x1b, 0x95, 0xed, 0xff, 0x1b, 0x95, 0xec, 0xff, 0x23, 0x95, 0xe4, 0xff, 
+  0x9f, 0x8b, 0x42, 0xff, 0xb3, 0x88, 0x0a, 0xff, 0xbd, 0x92, 0x09, 0xff, 0x90, 0x93, 0x7a, 0xff, 0x36, 0x96, 0xe7, 0xff, 0x81, 0x39, 0x94, 0xe6, 0xff, 0x02, 0x36, 0x94, 0xe0, 0xff, 0x9a, 0x7f, 
+  0x5c, 0xff, 0xac, 0x76, 0x07, 0xff, 0x8f, 0xac, 0x77, 0x0a, 0xff, 0x03, 0xab, 0x76, 0x0a, 0xff, 0xb0, 0x7d, 0x0d, 0xff, 0xc6, 0x9e, 0x1c, 0xc7, 0xd9, 0xb7, 0x2b, 0x0f, 0x8d, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xb9, 0xbb, 0xc2, 0x67, 0xbc, 0xa8, 0x68, 0xff, 0xb3, 0x89, 0x00, 0xff, 0x88, 0xb3, 0x8a, 0x0d, 0xff, 0x10, 0xb3, 0x8a, 0x0e, 0xff, 0xb6, 0x89, 0x00, 0xff, 0xb8, 0x89, 0x00, 0xff, 
+  0xb9, 0x8a, 0x00, 0xff, 0x64, 0x97, 0xac, 0xff, 0x15, 0x9b, 0xf1, 0xff, 0x00, 0x9b, 0xee, 0xff, 0x83, 0x91, 0x6f, 0xff, 0xb8, 0x8e, 0x00, 0xff, 0xb8, 0x90, 0x0d, 0xff, 0xb3, 0x97, 0x18, 0xff, 
+  0x1f, 0x97, 0xec, 0xff, 0x1d, 0x80, 0xe9, 0xff, 0x1e, 0x81, 0xe9, 0xff, 0x1a, 0x81, 0xec, 0xff, 0x5d, 0x7f, 0xb7, 0xff, 0xac, 0x79, 0x00, 0xff, 0x92, 0xac, 0x79, 0x0a, 0xff, 0x02, 0xae, 0x7d, 
+  0x0b, 0xff, 0xc8, 0xa4, 0x1e, 0x9f, 0xf6, 0xd0, 0x3c, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9, 0xb0, 0x99, 0xac, 0xb4, 0x8e, 0x1d, 0xff, 0x8a, 0xb3, 0x8b, 0x0d, 0xff, 0x0e, 0xb3, 0x8b, 
+  0x0e, 0xff, 0xa8, 0x93, 0x52, 0xff, 0x2b, 0xa7, 0xe8, 0xff, 0x00, 0xa1, 0xef, 0xff, 0x89, 0x9c, 0x8e, 0xff, 0xc9, 0xa3, 0x00, 0xff, 0xc2, 0x9b, 0x19, 0xff, 0xbc, 0x94, 0x00, 0xff, 0x66, 0x9b, 
+  0xcb, 0xff, 0x19, 0x80, 0xea, 0xff, 0x1f, 0x82, 0xe9, 0xff, 0x1f, 0x82, 0xea, 0xff, 0x00, 0x81, 0xd3, 0xff, 0xaa, 0x7b, 0x00, 0xff, 0xad, 0x7b, 0x08, 0xff, 0x92, 0xad, 0x7b, 0x0a, 0xff, 0x02, 
+  0xad, 0x7a, 0x0a, 0xff, 0xb3, 0x84, 0x0f, 0xf4, 0xcb, 0xa8, 0x1d, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xb8, 0x81, 0x13, 0xb7, 0x9c, 0x49, 0xe3, 0xb4, 0x8b, 0x02, 0xff, 0x89, 0xb4, 
+  0x8c, 0x0d, 0xff, 0x08, 0xb7, 0x89, 0x00, 0xff, 0x6b, 0xad, 0xa8, 0xff, 0x00, 0xa8, 0xf6, 0xff, 0x61, 0xa5, 0xc4, 0xff, 0xc0, 0x9b, 0x00, 0xff, 0xb1, 0x80, 0x0b, 0xff, 0xae, 0x79, 0x00, 0xff, 
+  0x96, 0x8b, 0x74, 0xff, 0x20, 0x88, 0xe8, 0xff, 0x81, 0x1f, 0x82, 0xe9, 0xff, 0x02, 0x1c, 0x82, 0xe7, 0xff, 0x94, 0x7f, 0x5f, 0xff, 0xb0, 0x7b, 0x00, 0xff, 0x94, 0xae, 0x7c, 0x0a, 0xff, 0x01, 
+  0xaf, 0x7e, 0x0b, 0xff, 0xc6, 0x9e, 0x1b, 0x84, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbb, 0xb7, 0xa6, 0x2f, 0xb4, 0x99, 0x3e, 0xf7, 0xb4, 0x8d, 0x03, 0xff, 0x87, 0xb4, 0x8e, 0x0d, 0xff, 0x09, 
+  0xb5, 0x8d, 0x06, 0xff, 0x9d, 0x9e, 0x26, 0xff, 0x00, 0xb6, 0xf9, 0xff, 0x2d, 0xad, 0xc7, 0xff, 0xb7, 0x90, 0x00, 0xff, 0xaf, 0x7e, 0x09, 0xff, 0xaf, 0x7e, 0x0c, 0xff, 0xab, 0x81, 0x00, 0xff, 
+  0x39, 0x9c, 0xe4, 0xff, 0x1c, 0x85, 0xe9, 0xff, 0x81, 0x1e, 0x85, 0xe9, 0xff, 0x03, 0x37, 0x87, 0xd7, 0xff, 0x84, 0x9a, 0x7b, 0xff, 0x8b, 0x99, 0x7d, 0xff, 0xac, 0x81, 0x16, 0xff, 0x93, 0xaf, 
+  0x7f, 0x0b, 0xff, 0x01, 0xae, 0x7e, 0x0b, 0xff, 0xbd, 0x94, 0x17, 0xcf, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb9, 0xb3, 0xa5, 0x2f, 0xb6, 0x9c, 0x48, 0xe3, 0xb4, 0x90, 0x1c, 0xff, 0xb4, 0x8e, 
+  0x00, 0xff, 0xb4, 0x8e, 0x0a, 0xff, 0x84, 0xb4, 0x8e, 0x0d, 0xff, 0x08, 0xb3, 0x8f, 0x00, 0xff, 0x55, 0xbc, 0xd4, 0xff, 0x25, 0xb1, 0xe4, 0xff, 0xb2, 0x99, 0x40, 0xff, 0xad, 0x7e, 0x0d, 0xff, 
+  0xaf, 0x80, 0x0b, 0xff, 0xaf, 0x81, 0x00, 0xff, 0x6c, 0xa2, 0xb8, 0xff, 0x12, 0x86, 0xec, 0xff, 0x81, 0x1d, 0x8a, 0xea, 0xff, 0x04, 0x1d, 0x89, 0xea, 0xff, 0x20, 0x8e, 0xec, 0xff, 0x13, 0x9a, 
+  0xf3, 0xff, 0x7f, 0x8d, 0x87, 0xff, 0xb1, 0x80, 0x00, 0xff, 0x94, 0xaf, 0x80, 0x0b, 0xff, 0x00, 0xb5, 0x8a, 0x10, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb9, 0xb1, 0x79, 0x13, 0xb7, 0xaf, 
+  0x97, 0xac, 0xb7, 0xa2, 0x62, 0xff, 0xb6, 0x95, 0x0e, 0xff, 0xb5, 0x8d, 0x00, 0xff, 0x83, 0xb5, 0x8b, 0x00, 0xff, 0x07, 0xa2, 0x9c, 0x5a, 0xff, 0x00, 0xbf, 0xf2, 0xff, 0x99, 0x99, 0x40, 0xff, 
+  0xb4, 0x88, 0x00, 0xff, 0xb0, 0x83, 0x0b, 0xff, 0xb0, 0x83, 0x0e, 0xff, 0x9f, 0x8e, 0x61, 0xff, 0x27, 0x96, 0xea, 0xff, 0x83, 0x1c, 0x8e, 0xeb, 0xff, 0x03, 0x0c, 0x8e, 0xec, 0xff, 0x78, 0x88, 
+  0x91, 0xff, 0xb2, 0x82, 0x00, 0xff, 0xb0, 0x83, 0x0c, 0xff, 0x94, 0xb0, 0x83, 0x0b, 0xff, 0x00, 0xb2, 0x85, 0x0c, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb7, 0xb9, 0xc0, 0x67, 0xb7, 0xb9, 
+  0xbc, 0xec, 0xb8, 0xba, 0xbd, 0xff, 0xb8, 0xba, 0xbe, 0xff, 0xb9, 0xbb, 0xbe, 0xff, 0xba, 0xbc, 0xbf, 0xff, 0xbd, 0xbb, 0xbd, 0xff, 0x48, 0xce, 0xee, 0xff, 0x82, 0xbc, 0xd1, 0xff, 0xbd, 0xb4, 
+  0xac, 0xff, 0xb2, 0x85, 0x00, 0xff, 0xb1, 0x84, 0x0b, 0xff, 0xb0, 0x85, 0x00, 0xff, 0x3f, 0xab, 0xd4, 0xff, 0x00, 0x94, 0xf0, 0xff, 0x08, 0x94, 0xee, 0xff, 0x81, 0x1b, 0x94, 0xec, 0xff, 0x02, 
+  0x16, 0x94, 0xef, 0xff, 0x52, 0x90, 0xc2, 0xff, 0xae, 0x85, 0x00, 0xff, 0x96, 0xb1, 0x84, 0x0c, 0xff, 0x00, 0xb4, 0x88, 0x0e, 0xe0, 0x93, 0x00, 0x00, 0x00, 0x00, 0x13, 0xb5, 0xb5, 0xb5, 0x17, 
+  0xb5, 0xb5, 0xb5, 0x74, 0xb6, 0xb6, 0xb6, 0xe0, 0xb6, 0xb6, 0xb6, 0xff, 0xb8, 0xb6, 0xb5, 0xff, 0x8b, 0xc7, 0xd0, 0xff, 0x52, 0xc4, 0xe3, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb6, 0xaf, 0xa6, 0xff, 
+  0xb2, 0x85, 0x00, 0xff, 0xb2, 0x86, 0x0a, 0xff, 0xad, 0x8a, 0x19, 0xff, 0xa0, 0x8d, 0x7b, 0xff, 0xa1, 0x8a, 0x74, 0xff, 0x95, 0x8b, 0x86, 0xff, 0x16, 0x98, 0xe7, 0xff, 0x17, 0x99, 0xef, 0xff, 
+  0x13, 0x97, 0xca, 0xff, 0xae, 0x87, 0x00, 0xff, 0xb2, 0x86, 0x09, 0xff, 0x95, 0xb2, 0x87, 0x0c, 0xff, 0x01, 0xb2, 0x86, 0x0c, 0xff, 0xba, 0x92, 0x13, 0xa4, 0x96, 0x00, 0x00, 0x00, 0x00, 0x06, 
+  0xb5, 0xb5, 0xb5, 0x54, 0xae, 0xb8, 0xb9, 0xac, 0x4f, 0xcd, 0xe6, 0xe8, 0xb9, 0xb4, 0xb1, 0xec, 0xb6, 0xb6, 0xb6, 0xf8, 0xb4, 0xad, 0xa3, 0xff, 0xb2, 0x88, 0x00, 0xff, 0x82, 0xb2, 0x88, 0x0c, 
+  0xff, 0x05, 0xb5, 0x86, 0x00, 0xff, 0x74, 0xa6, 0xa0, 0xff, 0x0f, 0xa1, 0xf2, 0xff, 0x22, 0x9e, 0xe3, 0xff, 0xa6, 0x8b, 0x45, 0xff, 0xb2, 0x88, 0x10, 0xff, 0x96, 0xb2, 0x88, 0x0c, 0xff, 0x01, 
+  0xb2, 0x88, 0x0c, 0xfc, 0xba, 0x95, 0x14, 0x48, 0x97, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xe9, 0xff, 0x2f, 0x63, 0xcd, 0xe0, 0x23, 0xb7, 0xb4, 0xb3, 0x1b, 0xb4, 0xb4, 0xb4, 0x27, 0xb6, 0xa6, 
+  0x86, 0x48, 0xb4, 0x8b, 0x0b, 0xf4, 0x81, 0xb3, 0x8a, 0x0d, 0xff, 0x05, 0xb3, 0x89, 0x08, 0xff, 0xa1, 0x97, 0x00, 0xff, 0x00, 0xaf, 0xf4, 0xff, 0x00, 0xa6, 0xf8, 0xff, 0x8e, 0x91, 0x59, 0xff, 
+  0xb4, 0x8a, 0x00, 0xff, 0x97, 0xb3, 0x8a, 0x0d, 0xff, 0x01, 0xb3, 0x8b, 0x0e, 0xcf, 0xbe, 0x9e, 0x18, 0x0b, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe8, 0xff, 0x14, 0x82, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xca, 0xb3, 0x21, 0x04, 0xb4, 0x8d, 0x0e, 0xb7, 0x81, 0xb3, 0x8b, 0x0d, 0xff, 0x04, 0xb3, 0x8c, 0x00, 0xff, 0x5c, 0xb6, 0xcc, 0xff, 0x04, 0xab, 0xf3, 0xff, 0x78, 0x9a, 0x7c, 0xff, 
+  0xb8, 0x8a, 0x00, 0xff, 0x97, 0xb3, 0x8b, 0x0d, 0xff, 0x01, 0xb3, 0x8b, 0x0d, 0xf7, 0xbb, 0x96, 0x12, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc6, 0xa1, 0x14, 0x1b, 0xb4, 0x8c, 0x0d, 0xe3, 
+  0xb4, 0x8d, 0x0f, 0xff, 0xa4, 0x99, 0x5f, 0xff, 0x18, 0xb7, 0xf3, 0xff, 0x52, 0xa6, 0xb5, 0xff, 0xb3, 0x8d, 0x00, 0xff, 0xb4, 0x8d, 0x0e, 0xff, 0x96, 0xb4, 0x8d, 0x0d, 0xff, 0x01, 0xb4, 0x8d, 
+  0x0d, 0xef, 0xb8, 0x92, 0x11, 0x44, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbe, 0x99, 0x17, 0x1c, 0xb8, 0x8a, 0x00, 0xc8, 0x54, 0xbb, 0xba, 0xff, 0x37, 0xb2, 0xd3, 0xff, 0xb4, 0x8d, 0x00, 0xff, 
+  0xb4, 0x8e, 0x0e, 0xff, 0x95, 0xb4, 0x8e, 0x0d, 0xff, 0x02, 0xb4, 0x8e, 0x0d, 0xf7, 0xb4, 0x8d, 0x0d, 0xc0, 0xb7, 0x93, 0x13, 0x2b, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x04, 0x57, 0xd8, 0xe2, 0x54, 
+  0x1a, 0xc1, 0xed, 0xff, 0xa4, 0x96, 0x40, 0xc0, 0xb6, 0x8f, 0x0e, 0xf0, 0xb5, 0x8f, 0x0d, 0xfc, 0x92, 0xb5, 0x8f, 0x0d, 0xfb, 0x04, 0xb5, 0x8f, 0x0e, 0xfb, 0xb5, 0x8f, 0x0d, 0xdb, 0xb6, 0x8f, 
+  0x0d, 0xa0, 0xb8, 0x93, 0x12, 0x47, 0xbe, 0x9a, 0x19, 0x07, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3c, 0xf1, 0xff, 0x07, 0x1d, 0xd2, 0xf9, 0xd7, 0x00, 0xc5, 0xfa, 0x3f, 0x8b, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xee, 0x3e, 0x07, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0xdc, 0xf9, 0x40, 0x16, 0xd3, 0xfa, 0x54, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd9, 0xbb, 0x26, 0x0b, 0xc1, 0x93, 
+  0x17, 0xdb, 0xe5, 0xc7, 0x2f, 0x10, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xe2, 0xfb, 0x78, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x9c, 0x1d, 0x4f, 0xac, 0x77, 0x0a, 0xff, 0xc6, 0x9c, 
+  0x1a, 0xb7, 0xad, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0xe8, 0xfd, 0x20, 0x00, 0xda, 0xfa, 0x07, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbf, 0x94, 0x17, 0xec, 0xac, 0x78, 0x09, 0xff, 0xb3, 0x82, 
+  0x0f, 0xf4, 0xcc, 0xa7, 0x1f, 0x1f, 0xba, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd3, 0xb4, 0x27, 0x5f, 0xae, 0x7e, 0x0a, 0xff, 0xae, 0x7f, 0x0b, 0xff, 0xaf, 0x80, 0x0c, 0xff, 0xc5, 0xa0, 0x1e, 0x7f, 
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdd, 0xc1, 0x2d, 0x08, 0xcb, 0xa1, 0x1c, 0x94, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbc, 0x95, 0x15, 0xbf, 0xb0, 0x83, 0x0b, 0xff, 0xb1, 0x84, 0x0c, 0xff, 
+  0xb0, 0x84, 0x0b, 0xff, 0xbe, 0x96, 0x17, 0xdf, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc5, 0x9c, 0x1a, 0xa4, 0xb1, 0x7e, 0x0e, 0xf8, 0xcf, 0xa8, 0x1e, 0x1c, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xb3, 0x8a, 0x0d, 0x97, 0x82, 0xb2, 0x89, 0x0c, 0xff, 0x00, 0xb6, 0x90, 0x10, 0xb7, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd0, 0xac, 0x22, 0x1c, 0xb2, 0x81, 0x0f, 0xef, 0xad, 0x78, 0x0a, 0xff, 
+  0xc4, 0x9c, 0x1c, 0x94, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xab, 0x21, 0x03, 0xb3, 0x8d, 0x0d, 0x9b, 0xb4, 0x8d, 0x0d, 0xff, 0xb5, 0x8d, 0x0d, 0xc3, 0xb8, 0x92, 0x12, 0x18, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0x04, 0xc7, 0xa2, 0x20, 0x78, 0xaf, 0x7f, 0x0b, 0xff, 0xad, 0x7d, 0x0b, 0xff, 0xb7, 0x8a, 0x12, 0xff, 0xe7, 0xce, 0x36, 0x14, 0xba, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbe, 0x97, 
+  0x16, 0xec, 0xb0, 0x81, 0x0b, 0xff, 0xb0, 0x82, 0x0b, 0xff, 0xaf, 0x7f, 0x09, 0xff, 0xcb, 0xa8, 0x20, 0x83, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8a, 0x0e, 0xff, 0x81, 0xb2, 0x87, 0x0c, 
+  0xff, 0x01, 0xb1, 0x87, 0x0c, 0xff, 0xba, 0x94, 0x13, 0x94, 0xba, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb7, 0x90, 0x10, 0x5f, 0xb3, 0x8c, 0x0d, 0xf8, 0xb3, 0x8c, 0x0d, 0xff, 0xb3, 0x8b, 0x0d, 0xe8, 
+  0xce, 0xb1, 0x27, 0x0c, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb4, 0x8e, 0x0e, 0x23, 0xb4, 0x8e, 0x0d, 0x33, 0xb7, 0x8f, 0x0c, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x8d, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +429,7 @@ const lv_img_dsc_t owm_11n_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_11n_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_11n_64px_map,
 };
-
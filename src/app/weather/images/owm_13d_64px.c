@@ -10,271 +10,265 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_13D_64PX uint8_t owm_13d_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xff, 0x13, 0xff, 0x20, 0xff, 0x2c, 0xff, 0x33, 0xff, 0x2f, 0xff, 0x27, 0xff, 0x17, 0xff, 0x04, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xff, 0x00, 0xdf, 0x43, 0xdf, 0xa8, 0xdf, 0xe4, 0xdf, 0xf3, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xdf, 0xe8, 0xdf, 0xcc, 0xff, 0x64, 0xdf, 0x0b, 0xdf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xdf, 0x27, 0xdf, 0xb0, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xd7, 0xdf, 0x4c, 0xff, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xff, 0x00, 0xff, 0x63, 0xdf, 0xe8, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xfb, 0xdf, 0xa0, 0xff, 0x04, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xbb, 0x00, 0xdf, 0x6f, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xac, 0xff, 0x14, 0xff, 0x23, 0xff, 0x2f, 0xff, 0x33, 0xff, 0x2b, 0xff, 0x1f, 0xff, 0x0c, 0xff, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x50, 0xdf, 0xf4, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xec, 0xdf, 0xf4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfc, 0xdf, 0xef, 0xdf, 0xdb, 0xff, 0x80, 0xdf, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x17, 0xdf, 0xdf, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xe8, 0xdf, 0x57, 0xff, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xdf, 0x98, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xfb, 0xdf, 0x90, 0xff, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xdf, 0x18, 0xdf, 0xec, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0x7c, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x54, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0x4b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x2b, 0xff, 0x8f, 0xff, 0xd4, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xd3, 0xff, 0x0c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x9f, 0xdf, 0xf4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfb, 0xdf, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x04, 0xdf, 0xbb, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x93, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0xff, 0x9f, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xd3, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x2b, 0xdf, 0xf4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfc, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdf, 0x8f, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xd4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfc, 0xdf, 0xd7, 0xff, 0x68, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xb3, 0xff, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xd4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xc7, 0xff, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x8f, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x9f, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdf, 0x2b, 0xdf, 0xf4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf4, 0xdf, 0x2b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0xdf, 0x9f, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x84, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xff, 0x04, 0xdf, 0xbb, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xcf, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x04, 0xdf, 0x9f, 0xdf, 0xf4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfb, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xff, 0x04, 0xdf, 0x2b, 0xdf, 0x8f, 0xdf, 0xd4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x24, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xe0, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x34, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xa4, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x30, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfc, 0xdf, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x20, 0xdf, 0xf4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xcf, 0xdf, 0x0b, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0xdf, 0xb7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xdf, 0x38, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xff, 0x1b, 0xdf, 0xe3, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xef, 0xdf, 0x44, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x1c, 0xdf, 0xc8, 0xdf, 0xfb, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xdf, 0xc0, 0xdf, 0x2b, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xff, 0x0b, 0xdf, 0x63, 0xdf, 0xbc, 0xdf, 0xf0, 0xdf, 0xfc, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xdb, 0xdf, 0xa0, 0xdf, 0x47, 0xdf, 0x07, 0xdf, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x2c, 0xbf, 0x20, 0xbf, 0x18, 0xbf, 0x13, 0xbf, 0x20, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x9b, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x93, 0x00, 0xbf, 0xdb, 0xbf, 0xe0, 0xbf, 0x54, 0xbf, 0xe7, 0xbf, 0x6c, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0xbf, 0xab, 0xbf, 0xd7, 0xbf, 0x98, 0xbf, 0x20, 0xbf, 0xd7, 0xbf, 0xcb, 0xbf, 0x2c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x0c, 0xbf, 0x0c, 0xbf, 0x27, 0xbf, 0x1b, 0xbf, 0x17, 0xbf, 0x08, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x07, 0xbf, 0xc0, 0xbf, 0x00, 0xbf, 0xb3, 0xbf, 0xc3, 0xbf, 0x14, 0xbf, 0x44, 0xbf, 0x4f, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x3b, 0xbf, 0xd0, 0xbf, 0xb7, 0xbf, 0xc7, 0xbf, 0xcc, 0xbf, 0x23, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0xd4, 0xbf, 0xff, 0xbf, 0xdb, 0xbf, 0xf3, 0xbf, 0xff, 0xbf, 0xdf, 0xbf, 0xec, 0xbf, 0xef, 0xbf, 0x5c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x0b, 0xbf, 0xdb, 0xbf, 0xeb, 0xbf, 0x54, 0xbf, 0x94, 0xbf, 0xd8, 0xbf, 0xb0, 0xbf, 0x04, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x18, 0xbf, 0x7b, 0xbf, 0x00, 0xbf, 0xd0, 0xbf, 0x77, 0xbf, 0x43, 0xbf, 0x18, 0xbf, 0x63, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x4b, 0xbf, 0x9c, 0xbf, 0x00, 0xbf, 0xe7, 0xbf, 0xb8, 0xbf, 0x00, 0xbf, 0xc8, 0xbb, 0x08, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x97, 0xbf, 0xff, 0xbf, 0x9c, 0xbf, 0x1f, 0xbf, 0xff, 0xbf, 0xe0, 0xbf, 0x13, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x43, 0xbf, 0x78, 0xbf, 0xc8, 0xbf, 0xa3, 0xbf, 0x98, 0xbf, 0x28, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x27, 0xbf, 0xe4, 0xbf, 0xfb, 0xbf, 0xd8, 0xbf, 0xff, 0xbf, 0xf4, 0xbf, 0xdc, 0xbf, 0xff, 0xbf, 0xcc, 0xbf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0xe7, 0xbf, 0xc3, 0xbf, 0x73, 0xbf, 0x97, 0xbf, 0x97, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0x50, 0xbf, 0x90, 0xbf, 0xff, 0xbf, 0x9f, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x6f, 0xbf, 0x48, 0xbf, 0x30, 0xbf, 0xcf, 0xbf, 0xd7, 0xdf, 0x00, 0xbf, 0x87, 0xbf, 0x30, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x70, 0xbf, 0x48, 0xbf, 0x30, 0xbf, 0xcf, 0xbf, 0xd7, 0xdf, 0x00, 0xbf, 0x87, 0xbf, 0x30, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0x50, 0xbf, 0x90, 0xbf, 0xff, 0xbf, 0x9f, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x27, 0xbf, 0xe4, 0xbf, 0xfb, 0xbf, 0xd8, 0xbf, 0xff, 0xbf, 0xf4, 0xbf, 0xdc, 0xbf, 0xff, 0xbf, 0xcc, 0xbf, 0x17, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x43, 0xbf, 0x78, 0xbf, 0xc8, 0xbf, 0xa3, 0xbf, 0x9c, 0xbf, 0x28, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0xac, 0xbf, 0x83, 0xbf, 0x5f, 0xbf, 0x4f, 0xbf, 0x7f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x48, 0xbf, 0x9c, 0xbf, 0x00, 0xbf, 0xe7, 0xbf, 0xb8, 0xbf, 0x00, 0xbf, 0xc8, 0xbb, 0x08, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x34, 0xbf, 0xe7, 0xbf, 0xd4, 0xbf, 0x38, 0xbf, 0xff, 0xbf, 0x84, 0xbf, 0x07, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x0b, 0xbf, 0xdb, 0xbf, 0xeb, 0xbf, 0x54, 0xbf, 0x94, 0xbf, 0xd8, 0xbf, 0xb0, 0xbf, 0x04, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x18, 0xbf, 0x73, 0xbf, 0x44, 0xbf, 0xc8, 0xbf, 0x40, 0xbf, 0x83, 0xbf, 0x44, 0xbf, 0x57, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x3c, 0xbf, 0xd0, 0xbf, 0xb7, 0xbf, 0xc7, 0xbf, 0xcc, 0xbf, 0x23, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x44, 0xbf, 0xec, 0xbf, 0x30, 0xbf, 0xbf, 0xbf, 0xf0, 0xbf, 0x48, 0xbf, 0x8c, 0xbf, 0x7c, 0xbf, 0x17, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x0c, 0xbf, 0x0c, 0xbf, 0x27, 0xbf, 0x1b, 0xbf, 0x18, 0xbf, 0x08, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x44, 0xbf, 0xec, 0xbf, 0x30, 0xbf, 0xbf, 0xbf, 0xf0, 0xbf, 0x48, 0xbf, 0x8c, 0xbf, 0x7c, 0xbf, 0x17, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x17, 0xbf, 0x73, 0xbf, 0x44, 0xbf, 0xc8, 0xbf, 0x40, 0xbf, 0x83, 0xbf, 0x44, 0xbf, 0x57, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x38, 0xbf, 0xe7, 0xbf, 0xd4, 0xbf, 0x38, 0xbf, 0xff, 0xbf, 0x84, 0xbf, 0x07, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0xac, 0xbf, 0x83, 0xbf, 0x5f, 0xbf, 0x50, 0xbf, 0x7f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x96, 0x00, 0x00, 0x07, 0xff, 0x13, 0xff, 0x20, 0xff, 0x2c, 0xff, 0x33, 0xff, 0x2f, 0xff, 0x27, 0xff, 0x17, 0xff, 
+  0x04, 0xb5, 0x00, 0x00, 0x03, 0xdf, 0x43, 0xdf, 0xa8, 0xdf, 0xe4, 0xdf, 0xf3, 0x82, 0xdf, 0xff, 0x04, 0xdf, 0xf7, 0xdf, 0xe8, 0xdf, 0xcc, 0xff, 0x64, 0xdf, 0x0b, 0xb1, 0x00, 0x00, 0x02, 0xdf, 
+  0x27, 0xdf, 0xb0, 0xdf, 0xff, 0x88, 0xbf, 0xff, 0x03, 0xdf, 0xff, 0xdf, 0xd7, 0xdf, 0x4c, 0xff, 0x04, 0xae, 0x00, 0x00, 0x01, 0xff, 0x63, 0xdf, 0xe8, 0x8c, 0xbf, 0xff, 0x02, 0xdf, 0xfb, 0xdf, 
+  0xa0, 0xff, 0x04, 0xac, 0x00, 0x00, 0x01, 0xdf, 0x6f, 0xdf, 0xff, 0x8e, 0xbf, 0xff, 0x08, 0xdf, 0xff, 0xdf, 0xac, 0xff, 0x14, 0xff, 0x23, 0xff, 0x2f, 0xff, 0x33, 0xff, 0x2b, 0xff, 0x1f, 0xff, 
+  0x0c, 0xa4, 0x00, 0x00, 0x01, 0xdf, 0x50, 0xdf, 0xf4, 0x91, 0xbf, 0xff, 0x01, 0xdf, 0xec, 0xdf, 0xf4, 0x81, 0xdf, 0xff, 0x04, 0xdf, 0xfc, 0xdf, 0xef, 0xdf, 0xdb, 0xff, 0x80, 0xdf, 0x18, 0xa1, 
+  0x00, 0x00, 0x01, 0xff, 0x17, 0xdf, 0xdf, 0x99, 0xbf, 0xff, 0x03, 0xdf, 0xff, 0xdf, 0xe8, 0xdf, 0x57, 0xff, 0x04, 0x9e, 0x00, 0x00, 0x01, 0xff, 0x03, 0xdf, 0x98, 0x9c, 0xbf, 0xff, 0x02, 0xdf, 
+  0xfb, 0xdf, 0x90, 0xff, 0x04, 0x9d, 0x00, 0x00, 0x01, 0xdf, 0x18, 0xdf, 0xec, 0x9d, 0xbf, 0xff, 0x01, 0xdf, 0xff, 0xdf, 0x7c, 0x9d, 0x00, 0x00, 0x00, 0xdf, 0x54, 0xa0, 0xdf, 0xff, 0x00, 0xff, 
+  0x4b, 0x97, 0x00, 0x00, 0x04, 0xff, 0x04, 0xff, 0x2b, 0xff, 0x8f, 0xff, 0xd4, 0xff, 0xff, 0xa1, 0xdf, 0xff, 0x01, 0xdf, 0xd3, 0xff, 0x0c, 0x95, 0x00, 0x00, 0x02, 0xff, 0x04, 0xff, 0x9f, 0xdf, 
+  0xf4, 0xa4, 0xdf, 0xff, 0x01, 0xdf, 0xfb, 0xdf, 0x3f, 0x94, 0x00, 0x00, 0x01, 0xff, 0x04, 0xdf, 0xbb, 0xa7, 0xdf, 0xff, 0x00, 0xdf, 0x93, 0x93, 0x00, 0x00, 0x01, 0xff, 0x04, 0xff, 0x9f, 0xa8, 
+  0xdf, 0xff, 0x00, 0xdf, 0xd3, 0x93, 0x00, 0x00, 0x01, 0xff, 0x2b, 0xdf, 0xf4, 0x9a, 0xdf, 0xff, 0x83, 0xbf, 0xff, 0x89, 0xdf, 0xff, 0x00, 0xdf, 0xfc, 0x93, 0x00, 0x00, 0x00, 0xdf, 0x8f, 0x98, 
+  0xdf, 0xff, 0x89, 0xbf, 0xff, 0x87, 0xdf, 0xff, 0x93, 0x00, 0x00, 0x00, 0xdf, 0xd4, 0x97, 0xdf, 0xff, 0x8b, 0xbf, 0xff, 0x85, 0xdf, 0xff, 0x00, 0xdf, 0xf7, 0x93, 0x00, 0x00, 0x97, 0xdf, 0xff, 
+  0x8d, 0xbf, 0xff, 0x84, 0xdf, 0xff, 0x02, 0xdf, 0xfc, 0xdf, 0xd7, 0xff, 0x68, 0x91, 0x00, 0x00, 0x96, 0xdf, 0xff, 0x95, 0xbf, 0xff, 0x02, 0xdf, 0xff, 0xdf, 0xb3, 0xff, 0x18, 0x8f, 0x00, 0x00, 
+  0x00, 0xdf, 0xd4, 0x95, 0xdf, 0xff, 0x96, 0xbf, 0xff, 0x02, 0xdf, 0xff, 0xdf, 0xc7, 0xff, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0xdf, 0x8f, 0x94, 0xdf, 0xff, 0x00, 0xbf, 0xff, 0x98, 0xdf, 0xff, 0x01, 
+  0xdf, 0x9f, 0xff, 0x03, 0x8d, 0x00, 0x00, 0x01, 0xdf, 0x2b, 0xdf, 0xf4, 0xad, 0xdf, 0xff, 0x01, 0xdf, 0xf4, 0xdf, 0x2b, 0x8d, 0x00, 0x00, 0x01, 0xff, 0x04, 0xdf, 0x9f, 0xae, 0xdf, 0xff, 0x00, 
+  0xdf, 0x84, 0x8e, 0x00, 0x00, 0x01, 0xff, 0x04, 0xdf, 0xbb, 0xad, 0xdf, 0xff, 0x00, 0xdf, 0xcf, 0x8f, 0x00, 0x00, 0x02, 0xdf, 0x04, 0xdf, 0x9f, 0xdf, 0xf4, 0xab, 0xdf, 0xff, 0x00, 0xdf, 0xfb, 
+  0x90, 0x00, 0x00, 0x03, 0xff, 0x04, 0xdf, 0x2b, 0xdf, 0x8f, 0xdf, 0xd4, 0xaa, 0xdf, 0xff, 0x9b, 0x00, 0x00, 0x00, 0xdf, 0x24, 0xa1, 0xdf, 0xff, 0x00, 0xdf, 0xe0, 0x9b, 0x00, 0x00, 0x00, 0xdf, 
+  0x34, 0xa1, 0xdf, 0xff, 0x00, 0xdf, 0xa4, 0x9b, 0x00, 0x00, 0x00, 0xdf, 0x30, 0xa0, 0xdf, 0xff, 0x01, 0xdf, 0xfc, 0xdf, 0x48, 0x9b, 0x00, 0x00, 0x01, 0xdf, 0x20, 0xdf, 0xf4, 0x9f, 0xdf, 0xff, 
+  0x01, 0xdf, 0xcf, 0xdf, 0x0b, 0x9b, 0x00, 0x00, 0x01, 0xff, 0x04, 0xdf, 0xb7, 0x9e, 0xdf, 0xff, 0x01, 0xdf, 0xf7, 0xdf, 0x38, 0x9d, 0x00, 0x00, 0x01, 0xff, 0x1b, 0xdf, 0xe3, 0x9c, 0xdf, 0xff, 
+  0x01, 0xdf, 0xef, 0xdf, 0x44, 0x9f, 0x00, 0x00, 0x02, 0xdf, 0x1c, 0xdf, 0xc8, 0xdf, 0xfb, 0x98, 0xdf, 0xff, 0x02, 0xdf, 0xf7, 0xdf, 0xc0, 0xdf, 0x2b, 0xa1, 0x00, 0x00, 0x04, 0xff, 0x0b, 0xdf, 
+  0x63, 0xdf, 0xbc, 0xdf, 0xf0, 0xdf, 0xfc, 0x93, 0xdf, 0xfb, 0x03, 0xdf, 0xdb, 0xdf, 0xa0, 0xdf, 0x47, 0xdf, 0x07, 0x95, 0x00, 0x00, 0x04, 0xbf, 0x2c, 0xbf, 0x20, 0xbf, 0x18, 0xbf, 0x13, 0xbf, 
+  0x20, 0xba, 0x00, 0x00, 0x04, 0xbf, 0xdb, 0xbf, 0xe0, 0xbf, 0x54, 0xbf, 0xe7, 0xbf, 0x6c, 0xb8, 0x00, 0x00, 0x07, 0xbf, 0x03, 0xbf, 0xab, 0xbf, 0xd7, 0xbf, 0x98, 0xbf, 0x20, 0xbf, 0xd7, 0xbf, 
+  0xcb, 0xbf, 0x2c, 0x8f, 0x00, 0x00, 0x81, 0xbf, 0x0c, 0x03, 0xbf, 0x27, 0xbf, 0x1b, 0xbf, 0x17, 0xbf, 0x08, 0xa1, 0x00, 0x00, 0x07, 0xbf, 0x07, 0xbf, 0xc0, 0x00, 0x00, 0xbf, 0xb3, 0xbf, 0xc3, 
+  0xbf, 0x14, 0xbf, 0x44, 0xbf, 0x4f, 0x8f, 0x00, 0x00, 0x05, 0xbf, 0x3b, 0xbf, 0xd0, 0xbf, 0xb7, 0xbf, 0xc7, 0xbf, 0xcc, 0xbf, 0x23, 0xa1, 0x00, 0x00, 0x08, 0xbf, 0xd4, 0xbf, 0xff, 0xbf, 0xdb, 
+  0xbf, 0xf3, 0xbf, 0xff, 0xbf, 0xdf, 0xbf, 0xec, 0xbf, 0xef, 0xbf, 0x5c, 0x8d, 0x00, 0x00, 0x07, 0xbf, 0x0b, 0xbf, 0xdb, 0xbf, 0xeb, 0xbf, 0x54, 0xbf, 0x94, 0xbf, 0xd8, 0xbf, 0xb0, 0xbf, 0x04, 
+  0xa0, 0x00, 0x00, 0x07, 0xbf, 0x18, 0xbf, 0x7b, 0x00, 0x00, 0xbf, 0xd0, 0xbf, 0x77, 0xbf, 0x43, 0xbf, 0x18, 0xbf, 0x63, 0x8e, 0x00, 0x00, 0x07, 0xbf, 0x4b, 0xbf, 0x9c, 0x00, 0x00, 0xbf, 0xe7, 
+  0xbf, 0xb8, 0x00, 0x00, 0xbf, 0xc8, 0xbb, 0x08, 0xa1, 0x00, 0x00, 0x06, 0xbf, 0x97, 0xbf, 0xff, 0xbf, 0x9c, 0xbf, 0x1f, 0xbf, 0xff, 0xbf, 0xe0, 0xbf, 0x13, 0x85, 0x00, 0x00, 0x05, 0xbf, 0x43, 
+  0xbf, 0x78, 0xbf, 0xc8, 0xbf, 0xa3, 0xbf, 0x98, 0xbf, 0x28, 0x81, 0x00, 0x00, 0x09, 0xbf, 0x27, 0xbf, 0xe4, 0xbf, 0xfb, 0xbf, 0xd8, 0xbf, 0xff, 0xbf, 0xf4, 0xbf, 0xdc, 0xbf, 0xff, 0xbf, 0xcc, 
+  0xbf, 0x17, 0xa1, 0x00, 0x00, 0x02, 0xbf, 0xe7, 0xbf, 0xc3, 0xbf, 0x73, 0x81, 0xbf, 0x97, 0x86, 0x00, 0x00, 0x05, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0x50, 0xbf, 0x90, 0xbf, 0xff, 0xbf, 0x9f, 0x82, 
+  0x00, 0x00, 0x07, 0xbf, 0x6f, 0xbf, 0x48, 0xbf, 0x30, 0xbf, 0xcf, 0xbf, 0xd7, 0x00, 0x00, 0xbf, 0x87, 0xbf, 0x30, 0xad, 0x00, 0x00, 0x07, 0xbf, 0x70, 0xbf, 0x48, 0xbf, 0x30, 0xbf, 0xcf, 0xbf, 
+  0xd7, 0x00, 0x00, 0xbf, 0x87, 0xbf, 0x30, 0x82, 0x00, 0x00, 0x05, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0x50, 0xbf, 0x90, 0xbf, 0xff, 0xbf, 0x9f, 0xad, 0x00, 0x00, 0x09, 0xbf, 0x27, 0xbf, 0xe4, 0xbf, 
+  0xfb, 0xbf, 0xd8, 0xbf, 0xff, 0xbf, 0xf4, 0xbf, 0xdc, 0xbf, 0xff, 0xbf, 0xcc, 0xbf, 0x17, 0x81, 0x00, 0x00, 0x05, 0xbf, 0x43, 0xbf, 0x78, 0xbf, 0xc8, 0xbf, 0xa3, 0xbf, 0x9c, 0xbf, 0x28, 0x85, 
+  0x00, 0x00, 0x04, 0xbf, 0xac, 0xbf, 0x83, 0xbf, 0x5f, 0xbf, 0x4f, 0xbf, 0x7f, 0xa3, 0x00, 0x00, 0x07, 0xbf, 0x48, 0xbf, 0x9c, 0x00, 0x00, 0xbf, 0xe7, 0xbf, 0xb8, 0x00, 0x00, 0xbf, 0xc8, 0xbb, 
+  0x08, 0x8d, 0x00, 0x00, 0x06, 0xbf, 0x34, 0xbf, 0xe7, 0xbf, 0xd4, 0xbf, 0x38, 0xbf, 0xff, 0xbf, 0x84, 0xbf, 0x07, 0xa2, 0x00, 0x00, 0x07, 0xbf, 0x0b, 0xbf, 0xdb, 0xbf, 0xeb, 0xbf, 0x54, 0xbf, 
+  0x94, 0xbf, 0xd8, 0xbf, 0xb0, 0xbf, 0x04, 0x8c, 0x00, 0x00, 0x07, 0xbf, 0x18, 0xbf, 0x73, 0xbf, 0x44, 0xbf, 0xc8, 0xbf, 0x40, 0xbf, 0x83, 0xbf, 0x44, 0xbf, 0x57, 0xa3, 0x00, 0x00, 0x05, 0xbf, 
+  0x3c, 0xbf, 0xd0, 0xbf, 0xb7, 0xbf, 0xc7, 0xbf, 0xcc, 0xbf, 0x23, 0x8d, 0x00, 0x00, 0x08, 0xbf, 0x44, 0xbf, 0xec, 0xbf, 0x30, 0xbf, 0xbf, 0xbf, 0xf0, 0xbf, 0x48, 0xbf, 0x8c, 0xbf, 0x7c, 0xbf, 
+  0x17, 0xa2, 0x00, 0x00, 0x81, 0xbf, 0x0c, 0x03, 0xbf, 0x27, 0xbf, 0x1b, 0xbf, 0x18, 0xbf, 0x08, 0x8d, 0x00, 0x00, 0x08, 0xbf, 0x44, 0xbf, 0xec, 0xbf, 0x30, 0xbf, 0xbf, 0xbf, 0xf0, 0xbf, 0x48, 
+  0xbf, 0x8c, 0xbf, 0x7c, 0xbf, 0x17, 0xb6, 0x00, 0x00, 0x07, 0xbf, 0x17, 0xbf, 0x73, 0xbf, 0x44, 0xbf, 0xc8, 0xbf, 0x40, 0xbf, 0x83, 0xbf, 0x44, 0xbf, 0x57, 0xb8, 0x00, 0x00, 0x06, 0xbf, 0x38, 
+  0xbf, 0xe7, 0xbf, 0xd4, 0xbf, 0x38, 0xbf, 0xff, 0xbf, 0x84, 0xbf, 0x07, 0xb9, 0x00, 0x00, 0x04, 0xbf, 0xac, 0xbf, 0x83, 0xbf, 0x5f, 0xbf, 0x50, 0xbf, 0x7f, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0xce, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xcf, 0x00, 0x5f, 0xd7, 0x00, 0xff, 0xbf, 0x00, 0x7f, 0xd7, 0x13, 0x7f, 0xd7, 0x20, 0x7f, 0xd7, 0x2c, 0x7f, 0xd7, 0x33, 0x7f, 0xd7, 0x2f, 0x7f, 0xd7, 0x27, 0x7f, 0xd7, 0x17, 0x5f, 0xdf, 0x04, 0x5f, 0xd7, 0x00, 0x7f, 0xcf, 0x00, 0x7f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xcf, 0x00, 0x7f, 0xcf, 0x00, 0x1f, 0xd7, 0x00, 0x7f, 0xd7, 0x43, 0x5f, 0xd7, 0xa8, 0x3f, 0xc7, 0xe4, 0xff, 0xbe, 0xf3, 0xff, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xf7, 0x1f, 0xc7, 0xe8, 0x3f, 0xcf, 0xcc, 0x7f, 0xd7, 0x64, 0xbf, 0xcf, 0x0b, 0x5f, 0xd7, 0x00, 0x5f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0x5f, 0xc7, 0x00, 0x7f, 0xd7, 0x27, 0x3f, 0xcf, 0xb0, 0x1f, 0xbf, 0xff, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xd7, 0x5f, 0xd7, 0x4c, 0x7f, 0xdf, 0x04, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x5f, 0xd7, 0x63, 0x1f, 0xc7, 0xe8, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xff, 0xbe, 0xfb, 0x5f, 0xcf, 0xa0, 0xdf, 0xef, 0x04, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0x9e, 0x00, 0x5f, 0xd7, 0x6f, 0x1f, 0xbf, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x3f, 0xcf, 0xac, 0x7f, 0xdf, 0x14, 0x7f, 0xdf, 0x23, 0x7f, 0xdf, 0x2f, 0x7f, 0xdf, 0x33, 0x7f, 0xdf, 0x2b, 0x7f, 0xd7, 0x1f, 0x7f, 0xdf, 0x0c, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x00, 0x5f, 0xd7, 0x00, 0x5f, 0xd7, 0x50, 0xff, 0xbe, 0xf4, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xec, 0x1f, 0xbf, 0xf4, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xfc, 0x1f, 0xc7, 0xef, 0x3f, 0xcf, 0xdb, 0x7f, 0xd7, 0x80, 0x7f, 0xd7, 0x18, 0x5f, 0xd7, 0x00, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0xdf, 0x17, 0x3f, 0xc7, 0xdf, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xe8, 0x5f, 0xd7, 0x57, 0xbf, 0xdf, 0x04, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x3f, 0xcf, 0x98, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xbf, 0xfb, 0x5f, 0xd7, 0x90, 0x9f, 0xe7, 0x04, 0x7f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xc8, 0x00, 0x7f, 0xd7, 0x18, 0xff, 0xbe, 0xec, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0x5f, 0xd7, 0x7c, 0x9e, 0xd7, 0x00, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xdf, 0x00, 0x7f, 0xdf, 0x00, 0x7f, 0xdf, 0x00, 0x7f, 0xdf, 0x00, 0x3f, 0xcf, 0x54, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x1f, 0xbf, 0xff, 0x7f, 0xd7, 0x4b, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdf, 0x00, 0x9f, 0xdf, 0x04, 0x7f, 0xdf, 0x2b, 0x7f, 0xd7, 0x8f, 0x5f, 0xd7, 0xd4, 0x5f, 0xd7, 0xff, 0x3f, 0xc7, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xc7, 0xd3, 0x7f, 0xdf, 0x0c, 0x5f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xdf, 0x00, 0xbf, 0xe7, 0x04, 0x7f, 0xd7, 0x9f, 0x3f, 0xc7, 0xf4, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0x1f, 0xbf, 0xfb, 0x5f, 0xd7, 0x3f, 0x5f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdf, 0x00, 0xbf, 0xf7, 0x04, 0x5f, 0xd7, 0xbb, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0x5f, 0xcf, 0x93, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xef, 0x04, 0x7f, 0xd7, 0x9f, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x3f, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xd3, 0x3f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe7, 0x00, 0x7f, 0xdf, 0x2b, 0x3f, 0xc7, 0xf4, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0xff, 0xbe, 0xff, 0xdf, 0xb6, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0x1f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xfc, 0x3f, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdf, 0x00, 0x7f, 0xd7, 0x8f, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0xdf, 0xb6, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xcf, 0x00, 0x5f, 0xcf, 0xd4, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xf7, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0x3f, 0xd7, 0x00, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xcf, 0x00, 0x3f, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xff, 0xb6, 0xff, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0x1f, 0xbf, 0xfc, 0x5f, 0xcf, 0xd7, 0x7f, 0xd7, 0x68, 0xff, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 0x00, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xff, 0xbe, 0xff, 0x5f, 0xcf, 0xb3, 0x7f, 0xd7, 0x18, 0x7f, 0xdf, 0x00, 0x5f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0xd4, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x5f, 0xcf, 0xff, 0xff, 0xbe, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xc7, 0x7f, 0xe7, 0x0f, 0x5f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd7, 0x00, 0x5e, 0xcf, 0x8f, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x5f, 0xcf, 0x9f, 0xbf, 0xf7, 0x03, 0x9f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0x5e, 0xcf, 0x2b, 0x5e, 0xcf, 0xf4, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x7f, 0xd7, 0xff, 0x5f, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x1f, 0xbf, 0xf4, 0x7f, 0xd7, 0x2b, 0xbf, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xe7, 0x04, 0x5e, 0xcf, 0x9f, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0x5f, 0xcf, 0x84, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xd7, 0x00, 0x5e, 0xd7, 0x04, 0x5e, 0xcf, 0xbb, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x7e, 0xd7, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xcf, 0xcf, 0x5f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xd7, 0x04, 0x5e, 0xcf, 0x9f, 0x5e, 0xcf, 0xf4, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xfb, 0x3f, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x00, 0x7d, 0xd7, 0x04, 0x5e, 0xcf, 0x2b, 0x5e, 0xcf, 0x8f, 0x5e, 0xcf, 0xd4, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd7, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x1f, 0xc7, 0x24, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x3f, 0xc7, 0xe0, 0x3f, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 0x34, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x5f, 0xcf, 0xa4, 0x5f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 0x30, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xfc, 0x5e, 0xcf, 0x48, 0x5e, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x20, 0x3e, 0xc7, 0xf4, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xcf, 0x7f, 0xd7, 0x0b, 0xfc, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdf, 0x04, 0x5e, 0xcf, 0xb7, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xf7, 0x5e, 0xcf, 0x38, 0x5e, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc7, 0x00, 0x7f, 0xd7, 0x1b, 0x5e, 0xcf, 0xe3, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xef, 0x5e, 0xcf, 0x44, 0x1e, 0xc7, 0x00, 0xfd, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xd7, 0x00, 0x5f, 0xdf, 0x00, 0x5e, 0xcf, 0x1c, 0x5e, 0xcf, 0xc8, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xf7, 0x5e, 0xcf, 0xc0, 0x5e, 0xcf, 0x2b, 0x1d, 0xc7, 0x00, 0x9e, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xd7, 0x00, 0x7d, 0xcf, 0x00, 0x7e, 0xdf, 0x0b, 0x5e, 0xcf, 0x63, 0x5e, 0xcf, 0xbc, 0x5e, 0xcf, 0xf0, 0x5e, 0xcf, 0xfc, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xdb, 0x5e, 0xcf, 0xa0, 0x5e, 0xcf, 0x47, 0x7e, 0xd7, 0x07, 0x5e, 0xcf, 0x00, 0xf8, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x13, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xf7, 0x00, 0x7b, 0x7e, 0x00, 0x5e, 0xd7, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x7e, 0xcf, 0x00, 0x7e, 0xd7, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xae, 0x00, 0x3f, 0x94, 0x00, 0xbf, 0xae, 0xdb, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0x6c, 0x5f, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xb6, 0x03, 0xdf, 0xae, 0xab, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0xcb, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x0c, 0xbf, 0xae, 0x0c, 0xdf, 0xae, 0x27, 0xbf, 0xae, 0x1b, 0xdf, 0xae, 0x17, 0xdf, 0xae, 0x08, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x07, 0xdf, 0xae, 0xc0, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xb3, 0xdf, 0xae, 0xc3, 0xbf, 0xae, 0x14, 0xdf, 0xae, 0x44, 0xbf, 0xae, 0x4f, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xae, 0x00, 0xbf, 0xae, 0x3b, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0xb7, 0xdf, 0xae, 0xc7, 0xdf, 0xae, 0xcc, 0xdf, 0xae, 0x23, 0x1f, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdf, 0xdf, 0xae, 0xec, 0xdf, 0xae, 0xef, 0xbf, 0xae, 0x5c, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xb6, 0x0b, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xeb, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0x94, 0xdf, 0xae, 0xd8, 0xbf, 0xae, 0xb0, 0x1f, 0xa7, 0x04, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x7b, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0x77, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x63, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x4b, 0xdf, 0xae, 0x9c, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xe7, 0xbf, 0xae, 0xb8, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xc8, 0x9f, 0xae, 0x08, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x97, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xe0, 0xbf, 0xb6, 0x13, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x78, 0xdf, 0xae, 0xc8, 0xbf, 0xae, 0xa3, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x28, 0x5f, 0xa7, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x27, 0xdf, 0xae, 0xe4, 0xdf, 0xae, 0xfb, 0xdf, 0xae, 0xd8, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xf4, 0xdf, 0xae, 0xdc, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xcc, 0xbf, 0xae, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xc3, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0x97, 0xdf, 0xae, 0x97, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x50, 0xdf, 0xae, 0x90, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x9f, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x6f, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0xcf, 0xdf, 0xae, 0xd7, 0x3e, 0xb7, 0x00, 0xbf, 0xae, 0x87, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x70, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0xcf, 0xdf, 0xae, 0xd7, 0x3e, 0xb7, 0x00, 0xbf, 0xae, 0x87, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x50, 0xdf, 0xae, 0x90, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x9f, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x27, 0xdf, 0xae, 0xe4, 0xdf, 0xae, 0xfb, 0xdf, 0xae, 0xd8, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xf4, 0xdf, 0xae, 0xdc, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xcc, 0xbf, 0xae, 0x17, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x43, 0xbf, 0xae, 0x78, 0xdf, 0xae, 0xc8, 0xbf, 0xae, 0xa3, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x28, 0x5f, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xac, 0xdf, 0xae, 0x83, 0xdf, 0xae, 0x5f, 0xdf, 0xae, 0x4f, 0xdf, 0xae, 0x7f, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x9c, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xe7, 0xbf, 0xae, 0xb8, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xc8, 0x9f, 0xae, 0x08, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x34, 0xbf, 0xae, 0xe7, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0x38, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x84, 0xdf, 0xae, 0x07, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xbf, 0xb6, 0x0b, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xeb, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0x94, 0xdf, 0xae, 0xd8, 0xbf, 0xae, 0xb0, 0x1f, 0xa7, 0x04, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0xc8, 0xdf, 0xae, 0x40, 0xbf, 0xae, 0x83, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0x57, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x3c, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0xb7, 0xdf, 0xae, 0xc7, 0xdf, 0xae, 0xcc, 0xdf, 0xae, 0x23, 0x1f, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0xec, 0xbf, 0xae, 0x30, 0xdf, 0xae, 0xbf, 0xdf, 0xae, 0xf0, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x8c, 0xbf, 0xae, 0x7c, 0xbf, 0xae, 0x17, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xae, 0x00, 0xdf, 0xae, 0x0c, 0xbf, 0xae, 0x0c, 0xdf, 0xae, 0x27, 0xbf, 0xae, 0x1b, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x08, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0xec, 0xbf, 0xae, 0x30, 0xdf, 0xae, 0xbf, 0xdf, 0xae, 0xf0, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x8c, 0xbf, 0xae, 0x7c, 0xbf, 0xae, 0x17, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x17, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0xc8, 0xdf, 0xae, 0x40, 0xbf, 0xae, 0x83, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0x57, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x38, 0xbf, 0xae, 0xe7, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0x38, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x84, 0xdf, 0xae, 0x07, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xff, 0xae, 0x00, 0xdf, 0xae, 0xac, 0xdf, 0xae, 0x83, 0xdf, 0xae, 0x5f, 0xdf, 0xae, 0x50, 0xdf, 0xae, 0x7f, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x07, 0x7f, 0xd7, 0x13, 0x7f, 0xd7, 0x20, 0x7f, 0xd7, 0x2c, 0x7f, 0xd7, 
+  0x33, 0x7f, 0xd7, 0x2f, 0x7f, 0xd7, 0x27, 0x7f, 0xd7, 0x17, 0x5f, 0xdf, 0x04, 0xb5, 0x00, 0x00, 0x00, 0x0b, 0x7f, 0xd7, 0x43, 0x5f, 0xd7, 0xa8, 0x3f, 0xc7, 0xe4, 0xff, 0xbe, 0xf3, 0xff, 0xb6, 
+  0xff, 0xdf, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xf7, 0x1f, 0xc7, 0xe8, 0x3f, 0xcf, 0xcc, 0x7f, 0xd7, 0x64, 0xbf, 0xcf, 0x0b, 0xb1, 0x00, 0x00, 0x00, 0x03, 0x7f, 0xd7, 0x27, 0x3f, 0xcf, 
+  0xb0, 0x1f, 0xbf, 0xff, 0xdf, 0xae, 0xff, 0x87, 0xbf, 0xae, 0xff, 0x03, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xd7, 0x5f, 0xd7, 0x4c, 0x7f, 0xdf, 0x04, 0xae, 0x00, 0x00, 0x00, 0x02, 0x5f, 0xd7, 0x63, 
+  0x1f, 0xc7, 0xe8, 0xdf, 0xae, 0xff, 0x8a, 0xbf, 0xae, 0xff, 0x03, 0xdf, 0xae, 0xff, 0xff, 0xbe, 0xfb, 0x5f, 0xcf, 0xa0, 0xdf, 0xef, 0x04, 0xac, 0x00, 0x00, 0x00, 0x01, 0x5f, 0xd7, 0x6f, 0x1f, 
+  0xbf, 0xff, 0x8e, 0xdf, 0xae, 0xff, 0x08, 0xdf, 0xb6, 0xff, 0x3f, 0xcf, 0xac, 0x7f, 0xdf, 0x14, 0x7f, 0xdf, 0x23, 0x7f, 0xdf, 0x2f, 0x7f, 0xdf, 0x33, 0x7f, 0xdf, 0x2b, 0x7f, 0xd7, 0x1f, 0x7f, 
+  0xdf, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x5f, 0xd7, 0x50, 0xff, 0xbe, 0xf4, 0x90, 0xdf, 0xae, 0xff, 0x02, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xec, 0x1f, 0xbf, 0xf4, 0x81, 0xff, 0xbe, 0xff, 0x04, 
+  0xff, 0xbe, 0xfc, 0x1f, 0xc7, 0xef, 0x3f, 0xcf, 0xdb, 0x7f, 0xd7, 0x80, 0x7f, 0xd7, 0x18, 0xa1, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xdf, 0x17, 0x3f, 0xc7, 0xdf, 0x92, 0xdf, 0xb6, 0xff, 0x81, 0xdf, 
+  0xae, 0xff, 0x82, 0xdf, 0xb6, 0xff, 0x81, 0xdf, 0xae, 0xff, 0x03, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xe8, 0x5f, 0xd7, 0x57, 0xbf, 0xdf, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x03, 0x3f, 
+  0xcf, 0x98, 0x9c, 0xdf, 0xb6, 0xff, 0x02, 0x1f, 0xbf, 0xfb, 0x5f, 0xd7, 0x90, 0x9f, 0xe7, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xd7, 0x18, 0xff, 0xbe, 0xec, 0x9d, 0xdf, 0xb6, 0xff, 0x01, 
+  0xff, 0xbe, 0xff, 0x5f, 0xd7, 0x7c, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xcf, 0x54, 0x9f, 0xff, 0xb6, 0xff, 0x01, 0x1f, 0xbf, 0xff, 0x7f, 0xd7, 0x4b, 0x97, 0x00, 0x00, 0x00, 0x05, 0x9f, 0xdf, 
+  0x04, 0x7f, 0xdf, 0x2b, 0x7f, 0xd7, 0x8f, 0x5f, 0xd7, 0xd4, 0x5f, 0xd7, 0xff, 0x3f, 0xc7, 0xff, 0xa0, 0xff, 0xb6, 0xff, 0x01, 0x3f, 0xc7, 0xd3, 0x7f, 0xdf, 0x0c, 0x95, 0x00, 0x00, 0x00, 0x04, 
+  0xbf, 0xe7, 0x04, 0x7f, 0xd7, 0x9f, 0x3f, 0xc7, 0xf4, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0x81, 0xff, 0xb6, 0xff, 0xa0, 0xff, 0xbe, 0xff, 0x01, 0x1f, 0xbf, 0xfb, 0x5f, 0xd7, 0x3f, 0x94, 0x00, 
+  0x00, 0x00, 0x02, 0xbf, 0xf7, 0x04, 0x5f, 0xd7, 0xbb, 0x1f, 0xbf, 0xff, 0xa6, 0xff, 0xbe, 0xff, 0x00, 0x5f, 0xcf, 0x93, 0x93, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xef, 0x04, 0x7f, 0xd7, 0x9f, 0x99, 
+  0x1f, 0xbf, 0xff, 0x01, 0x3f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0x81, 0x5f, 0xcf, 0xff, 0x01, 0x3f, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0x88, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xc7, 0xd3, 0x93, 0x00, 0x00, 
+  0x00, 0x01, 0x7f, 0xdf, 0x2b, 0x3f, 0xc7, 0xf4, 0x97, 0x1f, 0xbf, 0xff, 0x81, 0x3f, 0xc7, 0xff, 0x01, 0xff, 0xbe, 0xff, 0xdf, 0xb6, 0xff, 0x81, 0xbf, 0xae, 0xff, 0x04, 0xdf, 0xb6, 0xff, 0xff, 
+  0xbe, 0xff, 0x1f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x85, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xc7, 0xfc, 0x93, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x8f, 0x96, 0x1f, 0xbf, 0xff, 0x02, 
+  0x3f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0xdf, 0xb6, 0xff, 0x87, 0xbf, 0xae, 0xff, 0x02, 0xdf, 0xae, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xcf, 0xff, 0x84, 0x1f, 0xbf, 0xff, 0x00, 0x1f, 0xc7, 0xff, 0x93, 
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0xcf, 0xd4, 0x95, 0x1f, 0xc7, 0xff, 0x01, 0x3f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x8b, 0xbf, 0xae, 0xff, 0x01, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xff, 0x83, 0x3f, 0xc7, 
+  0xff, 0x00, 0x3f, 0xc7, 0xf7, 0x93, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc7, 0xff, 0x94, 0x3e, 0xc7, 0xff, 0x01, 0x3f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x8d, 0xdf, 0xae, 0xff, 0x07, 0xff, 0xb6, 0xff, 
+  0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0x1f, 0xbf, 0xfc, 0x5f, 0xcf, 0xd7, 0x7f, 0xd7, 0x68, 0x91, 0x00, 0x00, 0x00, 0x95, 0x3e, 0xc7, 0xff, 0x00, 0x3f, 0xc7, 
+  0xff, 0x93, 0xdf, 0xb6, 0xff, 0x81, 0xdf, 0xae, 0xff, 0x02, 0xff, 0xbe, 0xff, 0x5f, 0xcf, 0xb3, 0x7f, 0xd7, 0x18, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0xd4, 0x93, 0x3e, 0xc7, 0xff, 0x01, 
+  0x5f, 0xcf, 0xff, 0xff, 0xbe, 0xff, 0x96, 0xdf, 0xb6, 0xff, 0x02, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xc7, 0x7f, 0xe7, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x8f, 0x91, 0x3e, 0xc7, 0xff, 
+  0x81, 0x5e, 0xcf, 0xff, 0x00, 0x3f, 0xc7, 0xff, 0x99, 0xff, 0xb6, 0xff, 0x01, 0x5f, 0xcf, 0x9f, 0xbf, 0xf7, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x5e, 0xcf, 0x2b, 0x5e, 0xcf, 0xf4, 0x8f, 0x5e, 
+  0xcf, 0xff, 0x03, 0x7f, 0xd7, 0xff, 0x5f, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0xff, 0xbe, 0xff, 0x99, 0xff, 0xb6, 0xff, 0x01, 0x1f, 0xbf, 0xf4, 0x7f, 0xd7, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x7e, 
+  0xe7, 0x04, 0x5e, 0xcf, 0x9f, 0x8d, 0x5e, 0xcf, 0xff, 0x81, 0x5f, 0xcf, 0xff, 0x01, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0x9c, 0xff, 0xbe, 0xff, 0x00, 0x5f, 0xcf, 0x84, 0x8e, 0x00, 0x00, 0x00, 
+  0x01, 0x5e, 0xd7, 0x04, 0x5e, 0xcf, 0xbb, 0x8b, 0x5e, 0xcf, 0xff, 0x01, 0x7e, 0xd7, 0xff, 0x3f, 0xc7, 0xff, 0x9f, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xcf, 0xcf, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x5e, 
+  0xd7, 0x04, 0x5e, 0xcf, 0x9f, 0x5e, 0xcf, 0xf4, 0x89, 0x5e, 0xcf, 0xff, 0x00, 0x5f, 0xcf, 0xff, 0xa0, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xc7, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x03, 0x7d, 0xd7, 0x04, 
+  0x5e, 0xcf, 0x2b, 0x5e, 0xcf, 0x8f, 0x5e, 0xcf, 0xd4, 0x87, 0x5e, 0xcf, 0xff, 0x00, 0x3f, 0xc7, 0xff, 0xa0, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xc7, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc7, 
+  0x24, 0xa1, 0x1f, 0xc7, 0xff, 0x00, 0x3f, 0xc7, 0xe0, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 0x34, 0xa1, 0x3e, 0xc7, 0xff, 0x00, 0x5f, 0xcf, 0xa4, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 
+  0x30, 0xa0, 0x3e, 0xc7, 0xff, 0x01, 0x3e, 0xc7, 0xfc, 0x5e, 0xcf, 0x48, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x5e, 0xcf, 0x20, 0x3e, 0xc7, 0xf4, 0x9f, 0x3e, 0xc7, 0xff, 0x01, 0x3e, 0xc7, 0xcf, 0x7f, 
+  0xd7, 0x0b, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xdf, 0x04, 0x5e, 0xcf, 0xb7, 0x9e, 0x5e, 0xcf, 0xff, 0x01, 0x5e, 0xcf, 0xf7, 0x5e, 0xcf, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xd7, 0x1b, 
+  0x5e, 0xcf, 0xe3, 0x9c, 0x5e, 0xcf, 0xff, 0x01, 0x5e, 0xcf, 0xef, 0x5e, 0xcf, 0x44, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x5e, 0xcf, 0x1c, 0x5e, 0xcf, 0xc8, 0x5e, 0xcf, 0xfb, 0x98, 0x5e, 0xcf, 0xff, 
+  0x02, 0x5e, 0xcf, 0xf7, 0x5e, 0xcf, 0xc0, 0x5e, 0xcf, 0x2b, 0xa1, 0x00, 0x00, 0x00, 0x04, 0x7e, 0xdf, 0x0b, 0x5e, 0xcf, 0x63, 0x5e, 0xcf, 0xbc, 0x5e, 0xcf, 0xf0, 0x5e, 0xcf, 0xfc, 0x93, 0x5e, 
+  0xcf, 0xfb, 0x03, 0x5e, 0xcf, 0xdb, 0x5e, 0xcf, 0xa0, 0x5e, 0xcf, 0x47, 0x7e, 0xd7, 0x07, 0x95, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x13, 
+  0xdf, 0xae, 0x20, 0xba, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xae, 0xdb, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0x6c, 0xb8, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xb6, 0x03, 0xdf, 
+  0xae, 0xab, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0xcb, 0xdf, 0xae, 0x2c, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xdf, 0xae, 0x0c, 0xbf, 0xae, 0x0c, 0xdf, 
+  0xae, 0x27, 0xbf, 0xae, 0x1b, 0xdf, 0xae, 0x17, 0xdf, 0xae, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 0x07, 0xdf, 0xae, 0xc0, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xb3, 0xdf, 0xae, 0xc3, 0xbf, 
+  0xae, 0x14, 0xdf, 0xae, 0x44, 0xbf, 0xae, 0x4f, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xae, 0x3b, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0xb7, 0xdf, 0xae, 0xc7, 0xdf, 0xae, 0xcc, 0xdf, 0xae, 0x23, 0xa1, 
+  0x00, 0x00, 0x00, 0x08, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdf, 0xdf, 0xae, 0xec, 0xdf, 0xae, 0xef, 0xbf, 0xae, 0x5c, 0x8d, 
+  0x00, 0x00, 0x00, 0x07, 0xdf, 0xb6, 0x0b, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xeb, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0x94, 0xdf, 0xae, 0xd8, 0xbf, 0xae, 0xb0, 0x1f, 0xa7, 0x04, 0xa0, 0x00, 0x00, 0x00, 
+  0x07, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x7b, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0x77, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x63, 0x8e, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 
+  0x4b, 0xdf, 0xae, 0x9c, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xe7, 0xbf, 0xae, 0xb8, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xc8, 0x9f, 0xae, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 0x97, 0xdf, 0xae, 
+  0xff, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xe0, 0xbf, 0xb6, 0x13, 0x85, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x78, 0xdf, 0xae, 0xc8, 0xbf, 0xae, 
+  0xa3, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x28, 0x81, 0x00, 0x00, 0x00, 0x09, 0xdf, 0xae, 0x27, 0xdf, 0xae, 0xe4, 0xdf, 0xae, 0xfb, 0xdf, 0xae, 0xd8, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xf4, 0xdf, 0xae, 
+  0xdc, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xcc, 0xbf, 0xae, 0x17, 0xa1, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xc3, 0xdf, 0xae, 0x73, 0x81, 0xdf, 0xae, 0x97, 0x86, 0x00, 0x00, 0x00, 
+  0x05, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x50, 0xdf, 0xae, 0x90, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x9f, 0x82, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xae, 0x6f, 0xdf, 0xae, 0x48, 0xdf, 0xae, 
+  0x30, 0xdf, 0xae, 0xcf, 0xdf, 0xae, 0xd7, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x87, 0xdf, 0xae, 0x30, 0xad, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 0x70, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x30, 0xdf, 0xae, 
+  0xcf, 0xdf, 0xae, 0xd7, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x87, 0xdf, 0xae, 0x30, 0x82, 0x00, 0x00, 0x00, 0x05, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x50, 0xdf, 0xae, 0x90, 0xdf, 0xae, 
+  0xff, 0xbf, 0xae, 0x9f, 0xad, 0x00, 0x00, 0x00, 0x09, 0xdf, 0xae, 0x27, 0xdf, 0xae, 0xe4, 0xdf, 0xae, 0xfb, 0xdf, 0xae, 0xd8, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xf4, 0xdf, 0xae, 0xdc, 0xdf, 0xae, 
+  0xff, 0xdf, 0xae, 0xcc, 0xbf, 0xae, 0x17, 0x81, 0x00, 0x00, 0x00, 0x05, 0xdf, 0xae, 0x43, 0xbf, 0xae, 0x78, 0xdf, 0xae, 0xc8, 0xbf, 0xae, 0xa3, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x28, 0x85, 0x00, 
+  0x00, 0x00, 0x04, 0xdf, 0xae, 0xac, 0xdf, 0xae, 0x83, 0xdf, 0xae, 0x5f, 0xdf, 0xae, 0x4f, 0xdf, 0xae, 0x7f, 0xa3, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x9c, 0x00, 0x00, 0x00, 
+  0xdf, 0xae, 0xe7, 0xbf, 0xae, 0xb8, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xc8, 0x9f, 0xae, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xae, 0x34, 0xbf, 0xae, 0xe7, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0x38, 
+  0xdf, 0xae, 0xff, 0xdf, 0xae, 0x84, 0xdf, 0xae, 0x07, 0xa2, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xb6, 0x0b, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xeb, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0x94, 0xdf, 0xae, 0xd8, 
+  0xbf, 0xae, 0xb0, 0x1f, 0xa7, 0x04, 0x8c, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0xc8, 0xdf, 0xae, 0x40, 0xbf, 0xae, 0x83, 0xdf, 0xae, 0x44, 
+  0xdf, 0xae, 0x57, 0xa3, 0x00, 0x00, 0x00, 0x05, 0xdf, 0xae, 0x3c, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0xb7, 0xdf, 0xae, 0xc7, 0xdf, 0xae, 0xcc, 0xdf, 0xae, 0x23, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xdf, 
+  0xae, 0x44, 0xdf, 0xae, 0xec, 0xbf, 0xae, 0x30, 0xdf, 0xae, 0xbf, 0xdf, 0xae, 0xf0, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x8c, 0xbf, 0xae, 0x7c, 0xbf, 0xae, 0x17, 0xa2, 0x00, 0x00, 0x00, 0x05, 0xdf, 
+  0xae, 0x0c, 0xbf, 0xae, 0x0c, 0xdf, 0xae, 0x27, 0xbf, 0xae, 0x1b, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0xec, 0xbf, 0xae, 0x30, 0xdf, 
+  0xae, 0xbf, 0xdf, 0xae, 0xf0, 0xdf, 0xae, 0x48, 0xdf, 0xae, 0x8c, 0xbf, 0xae, 0x7c, 0xbf, 0xae, 0x17, 0xb6, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xae, 0x17, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0x44, 0xdf, 
+  0xae, 0xc8, 0xdf, 0xae, 0x40, 0xbf, 0xae, 0x83, 0xdf, 0xae, 0x44, 0xdf, 0xae, 0x57, 0xb8, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 0x38, 0xbf, 0xae, 0xe7, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0x38, 0xdf, 
+  0xae, 0xff, 0xdf, 0xae, 0x84, 0xdf, 0xae, 0x07, 0xb9, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xae, 0xac, 0xdf, 0xae, 0x83, 0xdf, 0xae, 0x5f, 0xdf, 0xae, 0x50, 0xdf, 0xae, 0x7f, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7f, 0x00, 0xd7, 0x5f, 0x00, 0xbf, 0xff, 0x00, 0xd7, 0x7f, 0x13, 0xd7, 0x7f, 0x20, 0xd7, 0x7f, 0x2c, 0xd7, 0x7f, 0x33, 0xd7, 0x7f, 0x2f, 0xd7, 0x7f, 0x27, 0xd7, 0x7f, 0x17, 0xdf, 0x5f, 0x04, 0xd7, 0x5f, 0x00, 0xcf, 0x7f, 0x00, 0xcf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5f, 0x00, 0xcf, 0x7f, 0x00, 0xd7, 0x1f, 0x00, 0xd7, 0x7f, 0x43, 0xd7, 0x5f, 0xa8, 0xc7, 0x3f, 0xe4, 0xbe, 0xff, 0xf3, 0xb6, 0xff, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0xc7, 0x1f, 0xe8, 0xcf, 0x3f, 0xcc, 0xd7, 0x7f, 0x64, 0xcf, 0xbf, 0x0b, 0xd7, 0x5f, 0x00, 0xcf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xc7, 0x5f, 0x00, 0xd7, 0x7f, 0x27, 0xcf, 0x3f, 0xb0, 0xbf, 0x1f, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xd7, 0xd7, 0x5f, 0x4c, 0xdf, 0x7f, 0x04, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5f, 0x00, 0xd7, 0x7f, 0x00, 0xd7, 0x5f, 0x63, 0xc7, 0x1f, 0xe8, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xdf, 0xff, 0xbe, 0xff, 0xfb, 0xcf, 0x5f, 0xa0, 0xef, 0xdf, 0x04, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5f, 0x00, 0x9e, 0x7f, 0x00, 0xd7, 0x5f, 0x6f, 0xbf, 0x1f, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xcf, 0x3f, 0xac, 0xdf, 0x7f, 0x14, 0xdf, 0x7f, 0x23, 0xdf, 0x7f, 0x2f, 0xdf, 0x7f, 0x33, 0xdf, 0x7f, 0x2b, 0xd7, 0x7f, 0x1f, 0xdf, 0x7f, 0x0c, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5f, 0x00, 0xd7, 0x5f, 0x00, 0xd7, 0x5f, 0x50, 0xbe, 0xff, 0xf4, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xec, 0xbf, 0x1f, 0xf4, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xfc, 0xc7, 0x1f, 0xef, 0xcf, 0x3f, 0xdb, 0xd7, 0x7f, 0x80, 0xd7, 0x7f, 0x18, 0xd7, 0x5f, 0x00, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5f, 0x00, 0xdf, 0x7f, 0x17, 0xc7, 0x3f, 0xdf, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xe8, 0xd7, 0x5f, 0x57, 0xdf, 0xbf, 0x04, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xcf, 0x3f, 0x98, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xbf, 0x1f, 0xfb, 0xd7, 0x5f, 0x90, 0xe7, 0x9f, 0x04, 0xdf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x1a, 0x00, 0xd7, 0x7f, 0x18, 0xbe, 0xff, 0xec, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xbe, 0xff, 0xff, 0xd7, 0x5f, 0x7c, 0xd7, 0x9e, 0x00, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x7f, 0x00, 0xcf, 0x3f, 0x54, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbf, 0x1f, 0xff, 0xd7, 0x7f, 0x4b, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0xdf, 0x9f, 0x04, 0xdf, 0x7f, 0x2b, 0xd7, 0x7f, 0x8f, 0xd7, 0x5f, 0xd4, 0xd7, 0x5f, 0xff, 0xc7, 0x3f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xc7, 0x3f, 0xd3, 0xdf, 0x7f, 0x0c, 0xdf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7f, 0x00, 0xe7, 0xbf, 0x04, 0xd7, 0x7f, 0x9f, 0xc7, 0x3f, 0xf4, 0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbf, 0x1f, 0xfb, 0xd7, 0x5f, 0x3f, 0xdf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0xf7, 0xbf, 0x04, 0xd7, 0x5f, 0xbb, 0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x5f, 0x93, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xbf, 0x04, 0xd7, 0x7f, 0x9f, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xcf, 0x3f, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xd3, 0xcf, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x9f, 0x00, 0xdf, 0x7f, 0x2b, 0xc7, 0x3f, 0xf4, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xb6, 0xdf, 0xff, 0xbe, 0xff, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xfc, 0xc7, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0xd7, 0x7f, 0x8f, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xdf, 0xff, 0xbf, 0x1f, 0xff, 0xcf, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5f, 0x00, 0xcf, 0x5f, 0xd4, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xf7, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xd7, 0x3f, 0x00, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x3f, 0x00, 0xc7, 0x3f, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbf, 0x1f, 0xfc, 0xcf, 0x5f, 0xd7, 0xd7, 0x7f, 0x68, 0xd7, 0xff, 0x00, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x00, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3f, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x5f, 0xb3, 0xd7, 0x7f, 0x18, 0xdf, 0x7f, 0x00, 0xdf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0xd4, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xcf, 0x5f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xc7, 0xe7, 0x7f, 0x0f, 0xdf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7e, 0x00, 0xcf, 0x5e, 0x8f, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xc7, 0x3f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x5f, 0x9f, 0xf7, 0xbf, 0x03, 0xd7, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xcf, 0x5e, 0x2b, 0xcf, 0x5e, 0xf4, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x7f, 0xff, 0xcf, 0x5f, 0xff, 0xc7, 0x3f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbf, 0x1f, 0xf4, 0xd7, 0x7f, 0x2b, 0xd7, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x7e, 0x04, 0xcf, 0x5e, 0x9f, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x5f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x5f, 0x84, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5e, 0x00, 0xd7, 0x5e, 0x04, 0xcf, 0x5e, 0xbb, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x7e, 0xff, 0xc7, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xcf, 0x3f, 0xcf, 0xcf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x00, 0xd7, 0x5e, 0x04, 0xcf, 0x5e, 0x9f, 0xcf, 0x5e, 0xf4, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xfb, 0xc7, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x00, 0xd7, 0x7d, 0x04, 0xcf, 0x5e, 0x2b, 0xcf, 0x5e, 0x8f, 0xcf, 0x5e, 0xd4, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xc7, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xc7, 0x1f, 0x24, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x3f, 0xe0, 0xc7, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x34, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xcf, 0x5f, 0xa4, 0xcf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x30, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xfc, 0xcf, 0x5e, 0x48, 0xdf, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x20, 0xc7, 0x3e, 0xf4, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xcf, 0xd7, 0x7f, 0x0b, 0x5d, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x04, 0xcf, 0x5e, 0xb7, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xf7, 0xcf, 0x5e, 0x38, 0xcf, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x7e, 0x00, 0xd7, 0x7f, 0x1b, 0xcf, 0x5e, 0xe3, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xef, 0xcf, 0x5e, 0x44, 0xc7, 0x1e, 0x00, 0xe7, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5e, 0x00, 0xdf, 0x5f, 0x00, 0xcf, 0x5e, 0x1c, 0xcf, 0x5e, 0xc8, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xf7, 0xcf, 0x5e, 0xc0, 0xcf, 0x5e, 0x2b, 0xc7, 0x1d, 0x00, 0xd7, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5e, 0x00, 0xcf, 0x7d, 0x00, 0xdf, 0x7e, 0x0b, 0xcf, 0x5e, 0x63, 0xcf, 0x5e, 0xbc, 0xcf, 0x5e, 0xf0, 0xcf, 0x5e, 0xfc, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xdb, 0xcf, 0x5e, 0xa0, 0xcf, 0x5e, 0x47, 0xd7, 0x7e, 0x07, 0xcf, 0x5e, 0x00, 0x94, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x13, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x7e, 0x00, 0x7e, 0x7b, 0x00, 0xd7, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x7e, 0x00, 0xd7, 0x7e, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x9f, 0x00, 0x94, 0x3f, 0x00, 0xae, 0xbf, 0xdb, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0x6c, 0xb6, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xbf, 0x03, 0xae, 0xdf, 0xab, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0xcb, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x0c, 0xae, 0xbf, 0x0c, 0xae, 0xdf, 0x27, 0xae, 0xbf, 0x1b, 0xae, 0xdf, 0x17, 0xae, 0xdf, 0x08, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x07, 0xae, 0xdf, 0xc0, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xb3, 0xae, 0xdf, 0xc3, 0xae, 0xbf, 0x14, 0xae, 0xdf, 0x44, 0xae, 0xbf, 0x4f, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x9f, 0x00, 0xae, 0xbf, 0x3b, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0xb7, 0xae, 0xdf, 0xc7, 0xae, 0xdf, 0xcc, 0xae, 0xdf, 0x23, 0xaf, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdf, 0xae, 0xdf, 0xec, 0xae, 0xdf, 0xef, 0xae, 0xbf, 0x5c, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xb6, 0xdf, 0x0b, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xeb, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0x94, 0xae, 0xdf, 0xd8, 0xae, 0xbf, 0xb0, 0xa7, 0x1f, 0x04, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x7b, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0x77, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x63, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x4b, 0xae, 0xdf, 0x9c, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xe7, 0xae, 0xbf, 0xb8, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xc8, 0xae, 0x9f, 0x08, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x97, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xe0, 0xb6, 0xbf, 0x13, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x78, 0xae, 0xdf, 0xc8, 0xae, 0xbf, 0xa3, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x28, 0xa7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x27, 0xae, 0xdf, 0xe4, 0xae, 0xdf, 0xfb, 0xae, 0xdf, 0xd8, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xf4, 0xae, 0xdf, 0xdc, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xcc, 0xae, 0xbf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xc3, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0x97, 0xae, 0xdf, 0x97, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x50, 0xae, 0xdf, 0x90, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x9f, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x6f, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0xcf, 0xae, 0xdf, 0xd7, 0xb7, 0x3e, 0x00, 0xae, 0xbf, 0x87, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xff, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x70, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0xcf, 0xae, 0xdf, 0xd7, 0xb7, 0x3e, 0x00, 0xae, 0xbf, 0x87, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x50, 0xae, 0xdf, 0x90, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x9f, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xff, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x27, 0xae, 0xdf, 0xe4, 0xae, 0xdf, 0xfb, 0xae, 0xdf, 0xd8, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xf4, 0xae, 0xdf, 0xdc, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xcc, 0xae, 0xbf, 0x17, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x43, 0xae, 0xbf, 0x78, 0xae, 0xdf, 0xc8, 0xae, 0xbf, 0xa3, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x28, 0xa7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xac, 0xae, 0xdf, 0x83, 0xae, 0xdf, 0x5f, 0xae, 0xdf, 0x4f, 0xae, 0xdf, 0x7f, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x9c, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xe7, 0xae, 0xbf, 0xb8, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xc8, 0xae, 0x9f, 0x08, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x34, 0xae, 0xbf, 0xe7, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0x38, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x84, 0xae, 0xdf, 0x07, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xbf, 0x0b, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xeb, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0x94, 0xae, 0xdf, 0xd8, 0xae, 0xbf, 0xb0, 0xa7, 0x1f, 0x04, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0xc8, 0xae, 0xdf, 0x40, 0xae, 0xbf, 0x83, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0x57, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x3c, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0xb7, 0xae, 0xdf, 0xc7, 0xae, 0xdf, 0xcc, 0xae, 0xdf, 0x23, 0xaf, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0xec, 0xae, 0xbf, 0x30, 0xae, 0xdf, 0xbf, 0xae, 0xdf, 0xf0, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x8c, 0xae, 0xbf, 0x7c, 0xae, 0xbf, 0x17, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x9f, 0x00, 0xae, 0xdf, 0x0c, 0xae, 0xbf, 0x0c, 0xae, 0xdf, 0x27, 0xae, 0xbf, 0x1b, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x08, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0xec, 0xae, 0xbf, 0x30, 0xae, 0xdf, 0xbf, 0xae, 0xdf, 0xf0, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x8c, 0xae, 0xbf, 0x7c, 0xae, 0xbf, 0x17, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x17, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0xc8, 0xae, 0xdf, 0x40, 0xae, 0xbf, 0x83, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0x57, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x38, 0xae, 0xbf, 0xe7, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0x38, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x84, 0xae, 0xdf, 0x07, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xff, 0x00, 0xae, 0xdf, 0xac, 0xae, 0xdf, 0x83, 0xae, 0xdf, 0x5f, 0xae, 0xdf, 0x50, 0xae, 0xdf, 0x7f, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xff, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x07, 0xd7, 0x7f, 0x13, 0xd7, 0x7f, 0x20, 0xd7, 0x7f, 0x2c, 0xd7, 0x7f, 
+  0x33, 0xd7, 0x7f, 0x2f, 0xd7, 0x7f, 0x27, 0xd7, 0x7f, 0x17, 0xdf, 0x5f, 0x04, 0xb5, 0x00, 0x00, 0x00, 0x0b, 0xd7, 0x7f, 0x43, 0xd7, 0x5f, 0xa8, 0xc7, 0x3f, 0xe4, 0xbe, 0xff, 0xf3, 0xb6, 0xff, 
+  0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0xc7, 0x1f, 0xe8, 0xcf, 0x3f, 0xcc, 0xd7, 0x7f, 0x64, 0xcf, 0xbf, 0x0b, 0xb1, 0x00, 0x00, 0x00, 0x03, 0xd7, 0x7f, 0x27, 0xcf, 0x3f, 
+  0xb0, 0xbf, 0x1f, 0xff, 0xae, 0xdf, 0xff, 0x87, 0xae, 0xbf, 0xff, 0x03, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xd7, 0xd7, 0x5f, 0x4c, 0xdf, 0x7f, 0x04, 0xae, 0x00, 0x00, 0x00, 0x02, 0xd7, 0x5f, 0x63, 
+  0xc7, 0x1f, 0xe8, 0xae, 0xdf, 0xff, 0x8a, 0xae, 0xbf, 0xff, 0x03, 0xae, 0xdf, 0xff, 0xbe, 0xff, 0xfb, 0xcf, 0x5f, 0xa0, 0xef, 0xdf, 0x04, 0xac, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x5f, 0x6f, 0xbf, 
+  0x1f, 0xff, 0x8e, 0xae, 0xdf, 0xff, 0x08, 0xb6, 0xdf, 0xff, 0xcf, 0x3f, 0xac, 0xdf, 0x7f, 0x14, 0xdf, 0x7f, 0x23, 0xdf, 0x7f, 0x2f, 0xdf, 0x7f, 0x33, 0xdf, 0x7f, 0x2b, 0xd7, 0x7f, 0x1f, 0xdf, 
+  0x7f, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x5f, 0x50, 0xbe, 0xff, 0xf4, 0x90, 0xae, 0xdf, 0xff, 0x02, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xec, 0xbf, 0x1f, 0xf4, 0x81, 0xbe, 0xff, 0xff, 0x04, 
+  0xbe, 0xff, 0xfc, 0xc7, 0x1f, 0xef, 0xcf, 0x3f, 0xdb, 0xd7, 0x7f, 0x80, 0xd7, 0x7f, 0x18, 0xa1, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x7f, 0x17, 0xc7, 0x3f, 0xdf, 0x92, 0xb6, 0xdf, 0xff, 0x81, 0xae, 
+  0xdf, 0xff, 0x82, 0xb6, 0xdf, 0xff, 0x81, 0xae, 0xdf, 0xff, 0x03, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xe8, 0xd7, 0x5f, 0x57, 0xdf, 0xbf, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x03, 0xcf, 
+  0x3f, 0x98, 0x9c, 0xb6, 0xdf, 0xff, 0x02, 0xbf, 0x1f, 0xfb, 0xd7, 0x5f, 0x90, 0xe7, 0x9f, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x7f, 0x18, 0xbe, 0xff, 0xec, 0x9d, 0xb6, 0xdf, 0xff, 0x01, 
+  0xbe, 0xff, 0xff, 0xd7, 0x5f, 0x7c, 0x9d, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x3f, 0x54, 0x9f, 0xb6, 0xff, 0xff, 0x01, 0xbf, 0x1f, 0xff, 0xd7, 0x7f, 0x4b, 0x97, 0x00, 0x00, 0x00, 0x05, 0xdf, 0x9f, 
+  0x04, 0xdf, 0x7f, 0x2b, 0xd7, 0x7f, 0x8f, 0xd7, 0x5f, 0xd4, 0xd7, 0x5f, 0xff, 0xc7, 0x3f, 0xff, 0xa0, 0xb6, 0xff, 0xff, 0x01, 0xc7, 0x3f, 0xd3, 0xdf, 0x7f, 0x0c, 0x95, 0x00, 0x00, 0x00, 0x04, 
+  0xe7, 0xbf, 0x04, 0xd7, 0x7f, 0x9f, 0xc7, 0x3f, 0xf4, 0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0x81, 0xb6, 0xff, 0xff, 0xa0, 0xbe, 0xff, 0xff, 0x01, 0xbf, 0x1f, 0xfb, 0xd7, 0x5f, 0x3f, 0x94, 0x00, 
+  0x00, 0x00, 0x02, 0xf7, 0xbf, 0x04, 0xd7, 0x5f, 0xbb, 0xbf, 0x1f, 0xff, 0xa6, 0xbe, 0xff, 0xff, 0x00, 0xcf, 0x5f, 0x93, 0x93, 0x00, 0x00, 0x00, 0x01, 0xef, 0xbf, 0x04, 0xd7, 0x7f, 0x9f, 0x99, 
+  0xbf, 0x1f, 0xff, 0x01, 0xc7, 0x3f, 0xff, 0xcf, 0x3f, 0xff, 0x81, 0xcf, 0x5f, 0xff, 0x01, 0xcf, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0x88, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0xd3, 0x93, 0x00, 0x00, 
+  0x00, 0x01, 0xdf, 0x7f, 0x2b, 0xc7, 0x3f, 0xf4, 0x97, 0xbf, 0x1f, 0xff, 0x81, 0xc7, 0x3f, 0xff, 0x01, 0xbe, 0xff, 0xff, 0xb6, 0xdf, 0xff, 0x81, 0xae, 0xbf, 0xff, 0x04, 0xb6, 0xdf, 0xff, 0xbe, 
+  0xff, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0x85, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0xfc, 0x93, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x8f, 0x96, 0xbf, 0x1f, 0xff, 0x02, 
+  0xc7, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xb6, 0xdf, 0xff, 0x87, 0xae, 0xbf, 0xff, 0x02, 0xae, 0xdf, 0xff, 0xbf, 0x1f, 0xff, 0xcf, 0x3f, 0xff, 0x84, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x1f, 0xff, 0x93, 
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x5f, 0xd4, 0x95, 0xc7, 0x1f, 0xff, 0x01, 0xc7, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0x8b, 0xae, 0xbf, 0xff, 0x01, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xff, 0x83, 0xc7, 0x3f, 
+  0xff, 0x00, 0xc7, 0x3f, 0xf7, 0x93, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3f, 0xff, 0x94, 0xc7, 0x3e, 0xff, 0x01, 0xc7, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0x8d, 0xae, 0xdf, 0xff, 0x07, 0xb6, 0xff, 0xff, 
+  0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbf, 0x1f, 0xfc, 0xcf, 0x5f, 0xd7, 0xd7, 0x7f, 0x68, 0x91, 0x00, 0x00, 0x00, 0x95, 0xc7, 0x3e, 0xff, 0x00, 0xc7, 0x3f, 
+  0xff, 0x93, 0xb6, 0xdf, 0xff, 0x81, 0xae, 0xdf, 0xff, 0x02, 0xbe, 0xff, 0xff, 0xcf, 0x5f, 0xb3, 0xd7, 0x7f, 0x18, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0xd4, 0x93, 0xc7, 0x3e, 0xff, 0x01, 
+  0xcf, 0x5f, 0xff, 0xbe, 0xff, 0xff, 0x96, 0xb6, 0xdf, 0xff, 0x02, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xc7, 0xe7, 0x7f, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x8f, 0x91, 0xc7, 0x3e, 0xff, 
+  0x81, 0xcf, 0x5e, 0xff, 0x00, 0xc7, 0x3f, 0xff, 0x99, 0xb6, 0xff, 0xff, 0x01, 0xcf, 0x5f, 0x9f, 0xf7, 0xbf, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x5e, 0x2b, 0xcf, 0x5e, 0xf4, 0x8f, 0xcf, 
+  0x5e, 0xff, 0x03, 0xd7, 0x7f, 0xff, 0xcf, 0x5f, 0xff, 0xc7, 0x3f, 0xff, 0xbe, 0xff, 0xff, 0x99, 0xb6, 0xff, 0xff, 0x01, 0xbf, 0x1f, 0xf4, 0xd7, 0x7f, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x01, 0xe7, 
+  0x7e, 0x04, 0xcf, 0x5e, 0x9f, 0x8d, 0xcf, 0x5e, 0xff, 0x81, 0xcf, 0x5f, 0xff, 0x01, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0x9c, 0xbe, 0xff, 0xff, 0x00, 0xcf, 0x5f, 0x84, 0x8e, 0x00, 0x00, 0x00, 
+  0x01, 0xd7, 0x5e, 0x04, 0xcf, 0x5e, 0xbb, 0x8b, 0xcf, 0x5e, 0xff, 0x01, 0xd7, 0x7e, 0xff, 0xc7, 0x3f, 0xff, 0x9f, 0xbf, 0x1f, 0xff, 0x00, 0xcf, 0x3f, 0xcf, 0x8f, 0x00, 0x00, 0x00, 0x02, 0xd7, 
+  0x5e, 0x04, 0xcf, 0x5e, 0x9f, 0xcf, 0x5e, 0xf4, 0x89, 0xcf, 0x5e, 0xff, 0x00, 0xcf, 0x5f, 0xff, 0xa0, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x03, 0xd7, 0x7d, 0x04, 
+  0xcf, 0x5e, 0x2b, 0xcf, 0x5e, 0x8f, 0xcf, 0x5e, 0xd4, 0x87, 0xcf, 0x5e, 0xff, 0x00, 0xc7, 0x3f, 0xff, 0xa0, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x1f, 
+  0x24, 0xa1, 0xc7, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0xe0, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x34, 0xa1, 0xc7, 0x3e, 0xff, 0x00, 0xcf, 0x5f, 0xa4, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 
+  0x30, 0xa0, 0xc7, 0x3e, 0xff, 0x01, 0xc7, 0x3e, 0xfc, 0xcf, 0x5e, 0x48, 0x9b, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x5e, 0x20, 0xc7, 0x3e, 0xf4, 0x9f, 0xc7, 0x3e, 0xff, 0x01, 0xc7, 0x3e, 0xcf, 0xd7, 
+  0x7f, 0x0b, 0x9b, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x9f, 0x04, 0xcf, 0x5e, 0xb7, 0x9e, 0xcf, 0x5e, 0xff, 0x01, 0xcf, 0x5e, 0xf7, 0xcf, 0x5e, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x7f, 0x1b, 
+  0xcf, 0x5e, 0xe3, 0x9c, 0xcf, 0x5e, 0xff, 0x01, 0xcf, 0x5e, 0xef, 0xcf, 0x5e, 0x44, 0x9f, 0x00, 0x00, 0x00, 0x02, 0xcf, 0x5e, 0x1c, 0xcf, 0x5e, 0xc8, 0xcf, 0x5e, 0xfb, 0x98, 0xcf, 0x5e, 0xff, 
+  0x02, 0xcf, 0x5e, 0xf7, 0xcf, 0x5e, 0xc0, 0xcf, 0x5e, 0x2b, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xdf, 0x7e, 0x0b, 0xcf, 0x5e, 0x63, 0xcf, 0x5e, 0xbc, 0xcf, 0x5e, 0xf0, 0xcf, 0x5e, 0xfc, 0x93, 0xcf, 
+  0x5e, 0xfb, 0x03, 0xcf, 0x5e, 0xdb, 0xcf, 0x5e, 0xa0, 0xcf, 0x5e, 0x47, 0xd7, 0x7e, 0x07, 0x95, 0x00, 0x00, 0x00, 0x04, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x13, 
+  0xae, 0xdf, 0x20, 0xba, 0x00, 0x00, 0x00, 0x04, 0xae, 0xbf, 0xdb, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0x6c, 0xb8, 0x00, 0x00, 0x00, 0x07, 0xb6, 0xbf, 0x03, 0xae, 
+  0xdf, 0xab, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0xcb, 0xae, 0xdf, 0x2c, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xae, 0xdf, 0x0c, 0xae, 0xbf, 0x0c, 0xae, 
+  0xdf, 0x27, 0xae, 0xbf, 0x1b, 0xae, 0xdf, 0x17, 0xae, 0xdf, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 0x07, 0xae, 0xdf, 0xc0, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xb3, 0xae, 0xdf, 0xc3, 0xae, 
+  0xbf, 0x14, 0xae, 0xdf, 0x44, 0xae, 0xbf, 0x4f, 0x8f, 0x00, 0x00, 0x00, 0x05, 0xae, 0xbf, 0x3b, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0xb7, 0xae, 0xdf, 0xc7, 0xae, 0xdf, 0xcc, 0xae, 0xdf, 0x23, 0xa1, 
+  0x00, 0x00, 0x00, 0x08, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdf, 0xae, 0xdf, 0xec, 0xae, 0xdf, 0xef, 0xae, 0xbf, 0x5c, 0x8d, 
+  0x00, 0x00, 0x00, 0x07, 0xb6, 0xdf, 0x0b, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xeb, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0x94, 0xae, 0xdf, 0xd8, 0xae, 0xbf, 0xb0, 0xa7, 0x1f, 0x04, 0xa0, 0x00, 0x00, 0x00, 
+  0x07, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x7b, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0x77, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x63, 0x8e, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 
+  0x4b, 0xae, 0xdf, 0x9c, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xe7, 0xae, 0xbf, 0xb8, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xc8, 0xae, 0x9f, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 0x97, 0xae, 0xdf, 
+  0xff, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xe0, 0xb6, 0xbf, 0x13, 0x85, 0x00, 0x00, 0x00, 0x05, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x78, 0xae, 0xdf, 0xc8, 0xae, 0xbf, 
+  0xa3, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x28, 0x81, 0x00, 0x00, 0x00, 0x09, 0xae, 0xdf, 0x27, 0xae, 0xdf, 0xe4, 0xae, 0xdf, 0xfb, 0xae, 0xdf, 0xd8, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xf4, 0xae, 0xdf, 
+  0xdc, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xcc, 0xae, 0xbf, 0x17, 0xa1, 0x00, 0x00, 0x00, 0x02, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xc3, 0xae, 0xdf, 0x73, 0x81, 0xae, 0xdf, 0x97, 0x86, 0x00, 0x00, 0x00, 
+  0x05, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x50, 0xae, 0xdf, 0x90, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x9f, 0x82, 0x00, 0x00, 0x00, 0x07, 0xae, 0xbf, 0x6f, 0xae, 0xdf, 0x48, 0xae, 0xdf, 
+  0x30, 0xae, 0xdf, 0xcf, 0xae, 0xdf, 0xd7, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x87, 0xae, 0xdf, 0x30, 0xad, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 0x70, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x30, 0xae, 0xdf, 
+  0xcf, 0xae, 0xdf, 0xd7, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x87, 0xae, 0xdf, 0x30, 0x82, 0x00, 0x00, 0x00, 0x05, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x50, 0xae, 0xdf, 0x90, 0xae, 0xdf, 
+  0xff, 0xae, 0xbf, 0x9f, 0xad, 0x00, 0x00, 0x00, 0x09, 0xae, 0xdf, 0x27, 0xae, 0xdf, 0xe4, 0xae, 0xdf, 0xfb, 0xae, 0xdf, 0xd8, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xf4, 0xae, 0xdf, 0xdc, 0xae, 0xdf, 
+  0xff, 0xae, 0xdf, 0xcc, 0xae, 0xbf, 0x17, 0x81, 0x00, 0x00, 0x00, 0x05, 0xae, 0xdf, 0x43, 0xae, 0xbf, 0x78, 0xae, 0xdf, 0xc8, 0xae, 0xbf, 0xa3, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x28, 0x85, 0x00, 
+  0x00, 0x00, 0x04, 0xae, 0xdf, 0xac, 0xae, 0xdf, 0x83, 0xae, 0xdf, 0x5f, 0xae, 0xdf, 0x4f, 0xae, 0xdf, 0x7f, 0xa3, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x9c, 0x00, 0x00, 0x00, 
+  0xae, 0xdf, 0xe7, 0xae, 0xbf, 0xb8, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xc8, 0xae, 0x9f, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x06, 0xae, 0xbf, 0x34, 0xae, 0xbf, 0xe7, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0x38, 
+  0xae, 0xdf, 0xff, 0xae, 0xdf, 0x84, 0xae, 0xdf, 0x07, 0xa2, 0x00, 0x00, 0x00, 0x07, 0xb6, 0xbf, 0x0b, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xeb, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0x94, 0xae, 0xdf, 0xd8, 
+  0xae, 0xbf, 0xb0, 0xa7, 0x1f, 0x04, 0x8c, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0xc8, 0xae, 0xdf, 0x40, 0xae, 0xbf, 0x83, 0xae, 0xdf, 0x44, 
+  0xae, 0xdf, 0x57, 0xa3, 0x00, 0x00, 0x00, 0x05, 0xae, 0xdf, 0x3c, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0xb7, 0xae, 0xdf, 0xc7, 0xae, 0xdf, 0xcc, 0xae, 0xdf, 0x23, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xae, 
+  0xdf, 0x44, 0xae, 0xdf, 0xec, 0xae, 0xbf, 0x30, 0xae, 0xdf, 0xbf, 0xae, 0xdf, 0xf0, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x8c, 0xae, 0xbf, 0x7c, 0xae, 0xbf, 0x17, 0xa2, 0x00, 0x00, 0x00, 0x05, 0xae, 
+  0xdf, 0x0c, 0xae, 0xbf, 0x0c, 0xae, 0xdf, 0x27, 0xae, 0xbf, 0x1b, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0xec, 0xae, 0xbf, 0x30, 0xae, 
+  0xdf, 0xbf, 0xae, 0xdf, 0xf0, 0xae, 0xdf, 0x48, 0xae, 0xdf, 0x8c, 0xae, 0xbf, 0x7c, 0xae, 0xbf, 0x17, 0xb6, 0x00, 0x00, 0x00, 0x07, 0xae, 0xbf, 0x17, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0x44, 0xae, 
+  0xdf, 0xc8, 0xae, 0xdf, 0x40, 0xae, 0xbf, 0x83, 0xae, 0xdf, 0x44, 0xae, 0xdf, 0x57, 0xb8, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 0x38, 0xae, 0xbf, 0xe7, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0x38, 0xae, 
+  0xdf, 0xff, 0xae, 0xdf, 0x84, 0xae, 0xdf, 0x07, 0xb9, 0x00, 0x00, 0x00, 0x04, 0xae, 0xdf, 0xac, 0xae, 0xdf, 0x83, 0xae, 0xdf, 0x5f, 0xae, 0xdf, 0x50, 0xae, 0xdf, 0x7f, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0xcc, 0x00, 0xff, 0xe9, 0xcd, 0x00, 0xff, 0xfb, 0xb6, 0x00, 0xff, 0xeb, 0xd4, 0x13, 0xff, 0xeb, 0xd3, 0x20, 0xff, 0xeb, 0xd2, 0x2c, 0xff, 0xeb, 0xd2, 0x33, 0xff, 0xeb, 0xd2, 0x2f, 0xff, 0xeb, 0xd2, 0x27, 0xff, 0xec, 0xd4, 0x17, 0xff, 0xe7, 0xd8, 0x04, 0xff, 0xea, 0xcd, 0x00, 0xff, 0xed, 0xcc, 0x00, 0xff, 0xec, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xca, 0x00, 0xff, 0xeb, 0xc7, 0x00, 0xff, 0xe1, 0xd1, 0x00, 0xff, 0xeb, 0xd0, 0x43, 0xff, 0xe8, 0xce, 0xa8, 0xff, 0xe3, 0xc1, 0xe4, 0xff, 0xde, 0xb9, 0xf3, 0xff, 0xdb, 0xb4, 0xff, 0xff, 0xd9, 0xb1, 0xff, 0xff, 0xdb, 0xb3, 0xff, 0xff, 0xdd, 0xb7, 0xf7, 0xff, 0xe1, 0xbe, 0xe8, 0xff, 0xe6, 0xc9, 0xcc, 0xff, 0xeb, 0xd1, 0x64, 0xff, 0xf6, 0xcb, 0x0b, 0xff, 0xea, 0xcd, 0x00, 0xff, 0xea, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xd1, 0x00, 0xfd, 0xe9, 0xc0, 0x00, 0xfe, 0xeb, 0xd0, 0x27, 0xff, 0xe6, 0xc9, 0xb0, 0xff, 0xdf, 0xbc, 0xff, 0xff, 0xd7, 0xac, 0xff, 0xff, 0xd4, 0xa6, 0xff, 0xff, 0xd5, 0xa7, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd4, 0xa7, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xdd, 0xb6, 0xff, 0xff, 0xe4, 0xc7, 0xd7, 0xfe, 0xe9, 0xcd, 0x4c, 0xff, 0xec, 0xda, 0x04, 0xff, 0xeb, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xd0, 0x00, 0xff, 0xeb, 0xd2, 0x00, 0xff, 0xea, 0xd1, 0x63, 0xfe, 0xe0, 0xbd, 0xe8, 0xfe, 0xd8, 0xac, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xdd, 0xb7, 0xfb, 0xfe, 0xe7, 0xcb, 0xa0, 0xff, 0xf7, 0xe5, 0x04, 0xff, 0xea, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0xd0, 0x00, 0xfc, 0xcd, 0x9c, 0x00, 0xff, 0xe9, 0xce, 0x6f, 0xfe, 0xdf, 0xb9, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xa9, 0xff, 0xfe, 0xda, 0xb1, 0xff, 0xfe, 0xe6, 0xc8, 0xac, 0xfc, 0xee, 0xd8, 0x14, 0xfe, 0xec, 0xd5, 0x23, 0xfe, 0xeb, 0xd5, 0x2f, 0xfe, 0xec, 0xd5, 0x33, 0xfe, 0xeb, 0xd5, 0x2b, 0xfd, 0xec, 0xd4, 0x1f, 0xff, 0xec, 0xd8, 0x0c, 0xfc, 0xec, 0xd2, 0x00, 0xff, 0xeb, 0xce, 0x00, 0xff, 0xeb, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xd4, 0x00, 0xff, 0xea, 0xd3, 0x00, 0xff, 0xe8, 0xcd, 0x50, 0xfd, 0xdd, 0xb7, 0xf4, 0xfd, 0xd8, 0xab, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xda, 0xb0, 0xff, 0xfd, 0xe2, 0xc0, 0xec, 0xfd, 0xe0, 0xbc, 0xf4, 0xfd, 0xdd, 0xb7, 0xff, 0xfd, 0xdd, 0xb5, 0xff, 0xfd, 0xde, 0xb8, 0xfc, 0xfd, 0xe1, 0xbf, 0xef, 0xfe, 0xe6, 0xc8, 0xdb, 0xfd, 0xed, 0xd4, 0x80, 0xff, 0xed, 0xd0, 0x18, 0xfe, 0xea, 0xd1, 0x00, 0xff, 0xe8, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xea, 0xd3, 0x00, 0xfe, 0xed, 0xdb, 0x17, 0xfd, 0xe3, 0xc0, 0xdf, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd7, 0xac, 0xff, 0xfc, 0xdd, 0xb6, 0xff, 0xfd, 0xe5, 0xc6, 0xe8, 0xfe, 0xe9, 0xd0, 0x57, 0xf6, 0xf5, 0xd8, 0x04, 0xfb, 0xec, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x03, 0xfd, 0xe6, 0xc8, 0x98, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xae, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xdf, 0xbb, 0xfb, 0xfc, 0xe9, 0xcf, 0x90, 0xfd, 0xf2, 0xe3, 0x04, 0xfb, 0xec, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x00, 0xc9, 0x00, 0xfd, 0xeb, 0xd0, 0x18, 0xfb, 0xde, 0xb8, 0xec, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xaf, 0xff, 0xfb, 0xde, 0xb8, 0xff, 0xfc, 0xe9, 0xce, 0x7c, 0xf1, 0xf2, 0xcf, 0x00, 0xff, 0xe7, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xed, 0xd6, 0x00, 0xfd, 0xee, 0xd7, 0x00, 0xfc, 0xed, 0xd6, 0x00, 0xfc, 0xed, 0xd6, 0x00, 0xfb, 0xe6, 0xc9, 0x54, 0xfa, 0xdc, 0xb4, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfb, 0xe0, 0xbc, 0xff, 0xfb, 0xed, 0xd4, 0x4b, 0xfb, 0xeb, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xef, 0xd7, 0x00, 0xfa, 0xf2, 0xd8, 0x04, 0xfc, 0xee, 0xd8, 0x2b, 0xfc, 0xeb, 0xd2, 0x8f, 0xfb, 0xea, 0xd1, 0xd4, 0xfb, 0xea, 0xd1, 0xff, 0xfa, 0xe4, 0xc4, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfb, 0xe5, 0xc4, 0xd3, 0xfc, 0xed, 0xdc, 0x0c, 0xff, 0xea, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xee, 0xd7, 0x00, 0xff, 0xf6, 0xe1, 0x04, 0xfc, 0xeb, 0xd3, 0x9f, 0xfa, 0xe4, 0xc4, 0xf4, 0xf9, 0xdf, 0xb9, 0xff, 0xf9, 0xde, 0xb6, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdf, 0xb8, 0xfb, 0xfd, 0xe7, 0xce, 0x3f, 0xff, 0xe9, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xef, 0xdb, 0x00, 0xf9, 0xf6, 0xee, 0x04, 0xfa, 0xea, 0xd0, 0xbb, 0xf8, 0xe1, 0xbc, 0xff, 0xf8, 0xde, 0xb5, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb7, 0xff, 0xf9, 0xe7, 0xc9, 0x93, 0xfa, 0xeb, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf3, 0xe5, 0x04, 0xfa, 0xec, 0xd1, 0x9f, 0xf8, 0xe0, 0xbb, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xba, 0xff, 0xfa, 0xe3, 0xc1, 0xff, 0xfc, 0xe6, 0xc7, 0xff, 0xfd, 0xe8, 0xcb, 0xff, 0xfd, 0xe8, 0xcb, 0xff, 0xfd, 0xe6, 0xc8, 0xff, 0xfb, 0xe4, 0xc3, 0xff, 0xf8, 0xe1, 0xbc, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf8, 0xe3, 0xc4, 0xd3, 0xf8, 0xe5, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xf2, 0xdd, 0x00, 0xf9, 0xed, 0xd5, 0x2b, 0xf7, 0xe3, 0xc1, 0xf4, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe1, 0xbc, 0xff, 0xfa, 0xe3, 0xc3, 0xff, 0xfe, 0xe3, 0xc4, 0xff, 0xff, 0xdd, 0xb8, 0xff, 0xff, 0xd9, 0xaf, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd4, 0xa7, 0xff, 0xff, 0xd7, 0xad, 0xff, 0xff, 0xdc, 0xb5, 0xff, 0xff, 0xe2, 0xc1, 0xff, 0xfc, 0xe4, 0xc4, 0xff, 0xf7, 0xe2, 0xbe, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf7, 0xe3, 0xc0, 0xfc, 0xf7, 0xe4, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xef, 0xd6, 0x00, 0xf8, 0xeb, 0xce, 0x8f, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbb, 0xff, 0xf7, 0xe4, 0xc1, 0xff, 0xfd, 0xe2, 0xc1, 0xff, 0xfe, 0xda, 0xaf, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd7, 0xac, 0xff, 0xfd, 0xdf, 0xbb, 0xff, 0xf9, 0xe6, 0xc5, 0xff, 0xf5, 0xe1, 0xbb, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xe8, 0xcc, 0x00, 0xf7, 0xe7, 0xc8, 0xd4, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf7, 0xe4, 0xc3, 0xff, 0xfe, 0xe1, 0xbf, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xdc, 0xb5, 0xff, 0xfa, 0xe5, 0xc6, 0xff, 0xf7, 0xe4, 0xc1, 0xff, 0xf8, 0xe4, 0xc3, 0xff, 0xf8, 0xe4, 0xc4, 0xff, 0xf7, 0xe4, 0xc2, 0xff, 0xf6, 0xe4, 0xc1, 0xf7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0xd1, 0x00, 0xff, 0xe6, 0xd1, 0x00, 0xff, 0xe8, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xe6, 0xc5, 0x00, 0xf5, 0xe6, 0xc4, 0xff, 0xf4, 0xe4, 0xbf, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf6, 0xe4, 0xc2, 0xff, 0xfc, 0xe0, 0xbb, 0xff, 0xfd, 0xd8, 0xab, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xab, 0xff, 0xfd, 0xdb, 0xb1, 0xff, 0xfd, 0xdf, 0xba, 0xff, 0xfd, 0xdc, 0xb5, 0xff, 0xfd, 0xdb, 0xb3, 0xff, 0xfd, 0xdd, 0xb6, 0xff, 0xfd, 0xe1, 0xbc, 0xfc, 0xfe, 0xe7, 0xc8, 0xd7, 0xff, 0xec, 0xd3, 0x68, 0xf6, 0xff, 0xce, 0x00, 0xff, 0xeb, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe5, 0xc2, 0x00, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xfa, 0xe5, 0xc4, 0xff, 0xfc, 0xd9, 0xae, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfd, 0xde, 0xba, 0xff, 0xfe, 0xe8, 0xcc, 0xb3, 0xfd, 0xec, 0xd3, 0x18, 0xfd, 0xeb, 0xd6, 0x00, 0xff, 0xea, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe7, 0xc6, 0x00, 0xf3, 0xe7, 0xc5, 0xd4, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf5, 0xe7, 0xc8, 0xff, 0xfc, 0xdd, 0xb6, 0xff, 0xfb, 0xda, 0xaf, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xd9, 0xaf, 0xff, 0xfb, 0xdc, 0xb3, 0xff, 0xfd, 0xe6, 0xc9, 0xc7, 0xff, 0xec, 0xe1, 0x0f, 0xff, 0xea, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xeb, 0xcd, 0x00, 0xf4, 0xe9, 0xca, 0x8f, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf3, 0xe7, 0xc6, 0xff, 0xf3, 0xe7, 0xc7, 0xff, 0xf8, 0xe4, 0xc4, 0xff, 0xfa, 0xdb, 0xb0, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdc, 0xb4, 0xff, 0xfc, 0xe9, 0xcb, 0x9f, 0xff, 0xf5, 0xf1, 0x03, 0xff, 0xf0, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xee, 0xd2, 0x00, 0xf3, 0xe9, 0xca, 0x2b, 0xf1, 0xe7, 0xc6, 0xf4, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf3, 0xe8, 0xc9, 0xff, 0xf9, 0xeb, 0xcf, 0xff, 0xfa, 0xe7, 0xc9, 0xff, 0xfa, 0xe4, 0xc4, 0xff, 0xf9, 0xde, 0xb8, 0xff, 0xf9, 0xdc, 0xb3, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb3, 0xff, 0xfa, 0xdf, 0xba, 0xf4, 0xfd, 0xeb, 0xce, 0x2b, 0xff, 0xf3, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xec, 0xde, 0x04, 0xf1, 0xe9, 0xc7, 0x9f, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf5, 0xe9, 0xcb, 0xff, 0xfb, 0xe7, 0xc9, 0xff, 0xf9, 0xde, 0xb8, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xde, 0xb7, 0xff, 0xfb, 0xe7, 0xca, 0x84, 0xfb, 0xea, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xe9, 0xce, 0x00, 0xf3, 0xe8, 0xd1, 0x04, 0xf0, 0xe9, 0xc8, 0xbb, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf4, 0xeb, 0xcf, 0xff, 0xf8, 0xe4, 0xc3, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb7, 0xff, 0xf9, 0xe5, 0xc5, 0xcf, 0xfa, 0xe8, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xea, 0xc8, 0x00, 0xf4, 0xe8, 0xce, 0x04, 0xf0, 0xe9, 0xca, 0x9f, 0xf0, 0xe9, 0xc9, 0xf4, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xea, 0xca, 0xff, 0xf7, 0xe7, 0xc7, 0xff, 0xf7, 0xe0, 0xb8, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf8, 0xe3, 0xbf, 0xfb, 0xf8, 0xe4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xe9, 0xcb, 0x00, 0xec, 0xeb, 0xd2, 0x04, 0xef, 0xea, 0xca, 0x2b, 0xee, 0xea, 0xca, 0x8f, 0xef, 0xea, 0xca, 0xd4, 0xef, 0xe9, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xf0, 0xea, 0xca, 0xff, 0xf5, 0xe3, 0xbf, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe3, 0xbd, 0xff, 0xf5, 0xe3, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xee, 0xce, 0x00, 0xee, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xe9, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xf8, 0xe1, 0xbf, 0x24, 0xf5, 0xe2, 0xbf, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe3, 0xc0, 0xe0, 0xf5, 0xe4, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe4, 0xc0, 0x34, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf5, 0xe7, 0xc6, 0xa4, 0xf6, 0xe9, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe5, 0xc2, 0x30, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xfc, 0xf3, 0xe7, 0xcc, 0x48, 0xf4, 0xe9, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe7, 0xc8, 0x20, 0xf2, 0xe6, 0xc4, 0xf4, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf1, 0xe6, 0xc4, 0xcf, 0xf6, 0xec, 0xd0, 0x0b, 0xe1, 0xbe, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xef, 0xda, 0x04, 0xf1, 0xe8, 0xc6, 0xb7, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xf7, 0xf1, 0xe9, 0xca, 0x38, 0xf2, 0xe9, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xed, 0xc2, 0x00, 0xf5, 0xeb, 0xd1, 0x1b, 0xf1, 0xe8, 0xc7, 0xe3, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xef, 0xf0, 0xea, 0xc9, 0x44, 0xf4, 0xe1, 0xc3, 0x00, 0xea, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe9, 0xd3, 0x00, 0xf5, 0xe8, 0xd5, 0x00, 0xf3, 0xe8, 0xcc, 0x1c, 0xf0, 0xe9, 0xc9, 0xc8, 0xf0, 0xe9, 0xc8, 0xfb, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xf7, 0xf0, 0xe9, 0xc7, 0xc0, 0xef, 0xea, 0xcb, 0x2b, 0xe9, 0xe1, 0xc2, 0x00, 0xf0, 0xf0, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe7, 0xce, 0x00, 0xeb, 0xeb, 0xcc, 0x00, 0xf1, 0xee, 0xd5, 0x0b, 0xf0, 0xe9, 0xcb, 0x63, 0xef, 0xea, 0xcb, 0xbc, 0xef, 0xea, 0xca, 0xf0, 0xef, 0xea, 0xca, 0xfc, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xe9, 0xca, 0xdb, 0xef, 0xea, 0xca, 0xa0, 0xf0, 0xea, 0xcb, 0x47, 0xf4, 0xed, 0xd0, 0x07, 0xf0, 0xea, 0xcb, 0x00, 0xbd, 0x9d, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfb, 0xda, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x2c, 0xfc, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xaa, 0x18, 0xfd, 0xd7, 0xaa, 0x13, 0xfe, 0xd7, 0xab, 0x20, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xed, 0xed, 0x00, 0xdb, 0xcd, 0x7a, 0x00, 0xef, 0xe9, 0xcd, 0x00, 0xef, 0xea, 0xcb, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xe9, 0xca, 0x00, 0xef, 0xeb, 0xcb, 0x00, 0xf1, 0xec, 0xce, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0xa9, 0x00, 0xff, 0x85, 0x90, 0x00, 0xfc, 0xd6, 0xab, 0xdb, 0xfd, 0xd8, 0xab, 0xe0, 0xfe, 0xd7, 0xaa, 0x54, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xac, 0x6c, 0xf8, 0xca, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xaf, 0x03, 0xfd, 0xd7, 0xab, 0xab, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xaa, 0x98, 0xff, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xab, 0xcb, 0xfd, 0xd7, 0xac, 0x2c, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfd, 0xd7, 0xab, 0x0c, 0xff, 0xd5, 0xaa, 0x0c, 0xfc, 0xd7, 0xab, 0x27, 0xfd, 0xd6, 0xac, 0x1b, 0xfd, 0xd7, 0xaa, 0x17, 0xfe, 0xd7, 0xab, 0x08, 0xff, 0xdb, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xda, 0xa9, 0x07, 0xfd, 0xd7, 0xab, 0xc0, 0xfc, 0xd8, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xb3, 0xfd, 0xd7, 0xab, 0xc3, 0xfe, 0xd4, 0xac, 0x14, 0xfe, 0xd7, 0xab, 0x44, 0xfd, 0xd6, 0xab, 0x4f, 0xfd, 0xd6, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0xa9, 0x00, 0xfd, 0xd5, 0xaa, 0x3b, 0xfd, 0xd7, 0xab, 0xd0, 0xfd, 0xd8, 0xab, 0xb7, 0xfd, 0xd7, 0xab, 0xc7, 0xfd, 0xd7, 0xab, 0xcc, 0xfe, 0xd9, 0xab, 0x23, 0xff, 0xe2, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdf, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd7, 0xab, 0xef, 0xfd, 0xd6, 0xac, 0x5c, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xac, 0x00, 0xfd, 0xd7, 0xae, 0x0b, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xeb, 0xfd, 0xd8, 0xaa, 0x54, 0xfe, 0xd7, 0xab, 0x94, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd6, 0xac, 0xb0, 0xf8, 0xdf, 0xa4, 0x04, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x18, 0xfc, 0xd7, 0xab, 0x7b, 0xfc, 0xd8, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0xd0, 0xfe, 0xd8, 0xab, 0x77, 0xfe, 0xd5, 0xab, 0x43, 0xfe, 0xd6, 0xac, 0x18, 0xfd, 0xd7, 0xab, 0x63, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfe, 0xd6, 0xaa, 0x00, 0xfc, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd8, 0xaa, 0x4b, 0xfd, 0xd7, 0xab, 0x9c, 0xfc, 0xd8, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd6, 0xac, 0xb8, 0xfb, 0xd8, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xc8, 0xff, 0xd0, 0xa5, 0x08, 0xfd, 0xd6, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x97, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd8, 0xab, 0x9c, 0xfe, 0xd7, 0xab, 0x1f, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd5, 0xad, 0x13, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd3, 0xaa, 0x00, 0xfd, 0xd6, 0xab, 0x43, 0xfe, 0xd6, 0xab, 0x78, 0xfc, 0xd7, 0xab, 0xc8, 0xfd, 0xd6, 0xac, 0xa3, 0xfd, 0xd7, 0xaa, 0x98, 0xfe, 0xd7, 0xab, 0x28, 0xff, 0xe8, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x27, 0xfd, 0xd7, 0xab, 0xe4, 0xfd, 0xd7, 0xab, 0xfb, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xf4, 0xfd, 0xd7, 0xab, 0xdc, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xcc, 0xfd, 0xd6, 0xac, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0xaa, 0x00, 0xf6, 0xda, 0xae, 0x00, 0xfd, 0xd7, 0xab, 0xe7, 0xfc, 0xd7, 0xab, 0xc3, 0xfd, 0xd7, 0xaa, 0x73, 0xfd, 0xd7, 0xab, 0x97, 0xfe, 0xd7, 0xab, 0x97, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd9, 0xaa, 0x50, 0xfe, 0xd7, 0xab, 0x90, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x9f, 0xfd, 0xd7, 0xab, 0x00, 0xfc, 0xd8, 0xaa, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd6, 0xac, 0x6f, 0xfc, 0xd8, 0xaa, 0x48, 0xfd, 0xd7, 0xa9, 0x30, 0xfd, 0xd7, 0xab, 0xcf, 0xfd, 0xd7, 0xab, 0xd7, 0xf2, 0xe4, 0xb1, 0x00, 0xfd, 0xd6, 0xac, 0x87, 0xfc, 0xd8, 0xa9, 0x30, 0xfd, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfa, 0xdc, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfc, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd8, 0xaa, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xac, 0x00, 0xfd, 0xd7, 0xac, 0x70, 0xfc, 0xd8, 0xaa, 0x48, 0xfd, 0xd7, 0xa9, 0x30, 0xfd, 0xd7, 0xab, 0xcf, 0xfd, 0xd7, 0xab, 0xd7, 0xf2, 0xe4, 0xb1, 0x00, 0xfd, 0xd6, 0xac, 0x87, 0xfc, 0xd8, 0xa9, 0x30, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd9, 0xaa, 0x50, 0xfe, 0xd7, 0xab, 0x90, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x9f, 0xfd, 0xd7, 0xab, 0x00, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfa, 0xdc, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfc, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x27, 0xfd, 0xd7, 0xab, 0xe4, 0xfd, 0xd7, 0xab, 0xfb, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xf4, 0xfd, 0xd7, 0xab, 0xdc, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xcc, 0xfd, 0xd6, 0xac, 0x17, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0xaa, 0x00, 0xfd, 0xd7, 0xab, 0x43, 0xfe, 0xd6, 0xab, 0x78, 0xfc, 0xd7, 0xab, 0xc8, 0xfd, 0xd6, 0xac, 0xa3, 0xfd, 0xd8, 0xaa, 0x9c, 0xfe, 0xd7, 0xab, 0x28, 0xff, 0xe8, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfb, 0xda, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xac, 0xfc, 0xd7, 0xab, 0x83, 0xfd, 0xd7, 0xaa, 0x5f, 0xfd, 0xd7, 0xaa, 0x4f, 0xfe, 0xd7, 0xab, 0x7f, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd8, 0xaa, 0x48, 0xfd, 0xd7, 0xab, 0x9c, 0xfc, 0xd8, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd6, 0xac, 0xb8, 0xfb, 0xd8, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xc8, 0xff, 0xd0, 0xa5, 0x08, 0xfd, 0xd6, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfe, 0xd6, 0xaa, 0x00, 0xfc, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd8, 0xaa, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd6, 0xab, 0x00, 0xfe, 0xd6, 0xab, 0x34, 0xfc, 0xd6, 0xab, 0xe7, 0xfd, 0xd8, 0xab, 0xd4, 0xfe, 0xd7, 0xab, 0x38, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0x84, 0xff, 0xd8, 0xab, 0x07, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd4, 0xae, 0x0b, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xeb, 0xfd, 0xd8, 0xaa, 0x54, 0xfe, 0xd7, 0xab, 0x94, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd6, 0xac, 0xb0, 0xf8, 0xdf, 0xa4, 0x04, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xac, 0x18, 0xfc, 0xd8, 0xab, 0x73, 0xfd, 0xd7, 0xab, 0x44, 0xfd, 0xd7, 0xab, 0xc8, 0xfe, 0xd8, 0xaa, 0x40, 0xfe, 0xd6, 0xab, 0x83, 0xfd, 0xd7, 0xac, 0x44, 0xfc, 0xd7, 0xab, 0x57, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xa9, 0x00, 0xfd, 0xd7, 0xaa, 0x3c, 0xfd, 0xd7, 0xab, 0xd0, 0xfd, 0xd8, 0xab, 0xb7, 0xfd, 0xd7, 0xab, 0xc7, 0xfd, 0xd7, 0xab, 0xcc, 0xfe, 0xd9, 0xab, 0x23, 0xff, 0xe2, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x44, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd6, 0xab, 0x30, 0xfd, 0xd7, 0xab, 0xbf, 0xfd, 0xd7, 0xab, 0xf0, 0xfd, 0xd7, 0xab, 0x48, 0xfe, 0xd7, 0xab, 0x8c, 0xfd, 0xd6, 0xab, 0x7c, 0xfd, 0xd6, 0xac, 0x17, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0xaa, 0x00, 0xfd, 0xd7, 0xab, 0x0c, 0xff, 0xd5, 0xaa, 0x0c, 0xfc, 0xd7, 0xab, 0x27, 0xfd, 0xd6, 0xac, 0x1b, 0xfd, 0xd8, 0xaa, 0x18, 0xfe, 0xd7, 0xab, 0x08, 0xff, 0xdb, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x44, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd6, 0xab, 0x30, 0xfd, 0xd7, 0xab, 0xbf, 0xfd, 0xd7, 0xab, 0xf0, 0xfd, 0xd7, 0xab, 0x48, 0xfe, 0xd7, 0xab, 0x8c, 0xfd, 0xd6, 0xab, 0x7c, 0xfd, 0xd6, 0xac, 0x17, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0x17, 0xfc, 0xd7, 0xab, 0x73, 0xfd, 0xd7, 0xab, 0x44, 0xfd, 0xd7, 0xab, 0xc8, 0xfe, 0xd8, 0xaa, 0x40, 0xfe, 0xd6, 0xab, 0x83, 0xfd, 0xd7, 0xac, 0x44, 0xfc, 0xd7, 0xab, 0x57, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd8, 0xab, 0x38, 0xfc, 0xd6, 0xab, 0xe7, 0xfd, 0xd8, 0xab, 0xd4, 0xfe, 0xd7, 0xab, 0x38, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0x84, 0xff, 0xd8, 0xab, 0x07, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd3, 0xaa, 0x00, 0xfb, 0xdb, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xac, 0xfc, 0xd7, 0xab, 0x83, 0xfd, 0xd7, 0xaa, 0x5f, 0xfd, 0xd8, 0xaa, 0x50, 0xfe, 0xd7, 0xab, 0x7f, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfa, 0xdc, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfc, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd8, 0xaa, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xeb, 0xd4, 0x13, 0xff, 0xeb, 0xd3, 
+  0x20, 0xff, 0xeb, 0xd2, 0x2c, 0xff, 0xeb, 0xd2, 0x33, 0xff, 0xeb, 0xd2, 0x2f, 0xff, 0xeb, 0xd2, 0x27, 0xff, 0xec, 0xd4, 0x17, 0xff, 0xe7, 0xd8, 0x04, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 
+  0xeb, 0xd0, 0x43, 0xff, 0xe8, 0xce, 0xa8, 0xff, 0xe3, 0xc1, 0xe4, 0xff, 0xde, 0xb9, 0xf3, 0xff, 0xdb, 0xb4, 0xff, 0xff, 0xd9, 0xb1, 0xff, 0xff, 0xdb, 0xb3, 0xff, 0xff, 0xdd, 0xb7, 0xf7, 0xff, 
+  0xe1, 0xbe, 0xe8, 0xff, 0xe6, 0xc9, 0xcc, 0xff, 0xeb, 0xd1, 0x64, 0xff, 0xf6, 0xcb, 0x0b, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfe, 0xeb, 0xd0, 0x27, 0xff, 0xe6, 0xc9, 0xb0, 0xff, 0xdf, 0xbc, 
+  0xff, 0xff, 0xd7, 0xac, 0xff, 0xff, 0xd4, 0xa6, 0xff, 0xff, 0xd5, 0xa7, 0xff, 0x83, 0xff, 0xd5, 0xa8, 0xff, 0x05, 0xff, 0xd4, 0xa7, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xdd, 0xb6, 0xff, 0xff, 
+  0xe4, 0xc7, 0xd7, 0xfe, 0xe9, 0xcd, 0x4c, 0xff, 0xec, 0xda, 0x04, 0xae, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xea, 0xd1, 0x63, 0xfe, 0xe0, 0xbd, 0xe8, 0xfe, 0xd8, 0xac, 0xff, 0x89, 0xfe, 0xd6, 
+  0xa9, 0xff, 0x04, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xdd, 0xb7, 0xfb, 0xfe, 0xe7, 0xcb, 0xa0, 0xff, 0xf7, 0xe5, 0x04, 0xac, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe9, 0xce, 
+  0x6f, 0xfe, 0xdf, 0xb9, 0xff, 0x8d, 0xfe, 0xd7, 0xaa, 0xff, 0x09, 0xfe, 0xd7, 0xa9, 0xff, 0xfe, 0xda, 0xb1, 0xff, 0xfe, 0xe6, 0xc8, 0xac, 0xfc, 0xee, 0xd8, 0x14, 0xfe, 0xec, 0xd5, 0x23, 0xfe, 
+  0xeb, 0xd5, 0x2f, 0xfe, 0xec, 0xd5, 0x33, 0xfe, 0xeb, 0xd5, 0x2b, 0xfd, 0xec, 0xd4, 0x1f, 0xff, 0xec, 0xd8, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xe8, 0xcd, 0x50, 0xfd, 0xdd, 0xb7, 
+  0xf4, 0xfd, 0xd8, 0xab, 0xff, 0x8f, 0xfd, 0xd8, 0xac, 0xff, 0x09, 0xfd, 0xda, 0xb0, 0xff, 0xfd, 0xe2, 0xc0, 0xec, 0xfd, 0xe0, 0xbc, 0xf4, 0xfd, 0xdd, 0xb7, 0xff, 0xfd, 0xdd, 0xb5, 0xff, 0xfd, 
+  0xde, 0xb8, 0xfc, 0xfd, 0xe1, 0xbf, 0xef, 0xfe, 0xe6, 0xc8, 0xdb, 0xfd, 0xed, 0xd4, 0x80, 0xff, 0xed, 0xd0, 0x18, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xed, 0xdb, 0x17, 0xfd, 0xe3, 0xc0, 
+  0xdf, 0x92, 0xfc, 0xd8, 0xad, 0xff, 0x81, 0xfc, 0xd8, 0xac, 0xff, 0x82, 0xfc, 0xd8, 0xad, 0xff, 0x05, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd7, 0xac, 0xff, 0xfc, 0xdd, 0xb6, 0xff, 0xfd, 0xe5, 0xc6, 
+  0xe8, 0xfe, 0xe9, 0xd0, 0x57, 0xf6, 0xf5, 0xd8, 0x04, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x03, 0xfd, 0xe6, 0xc8, 0x98, 0x9a, 0xfc, 0xd9, 0xaf, 0xff, 0x04, 0xfc, 0xd9, 0xae, 
+  0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xdf, 0xbb, 0xfb, 0xfc, 0xe9, 0xcf, 0x90, 0xfd, 0xf2, 0xe3, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfd, 0xeb, 0xd0, 0x18, 0xfb, 0xde, 0xb8, 0xec, 0x9c, 
+  0xfb, 0xda, 0xb0, 0xff, 0x02, 0xfb, 0xda, 0xaf, 0xff, 0xfb, 0xde, 0xb8, 0xff, 0xfc, 0xe9, 0xce, 0x7c, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xe6, 0xc9, 0x54, 0xfa, 0xdc, 0xb4, 0xff, 0x9e, 
+  0xfa, 0xdb, 0xb2, 0xff, 0x01, 0xfb, 0xe0, 0xbc, 0xff, 0xfb, 0xed, 0xd4, 0x4b, 0x97, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfa, 0xf2, 0xd8, 0x04, 0xfc, 0xee, 0xd8, 0x2b, 0xfc, 0xeb, 0xd2, 0x8f, 0xfb, 
+  0xea, 0xd1, 0xd4, 0xfb, 0xea, 0xd1, 0xff, 0xfa, 0xe4, 0xc4, 0xff, 0x9f, 0xfa, 0xdc, 0xb3, 0xff, 0x02, 0xfa, 0xdb, 0xb2, 0xff, 0xfb, 0xe5, 0xc4, 0xd3, 0xfc, 0xed, 0xdc, 0x0c, 0x95, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0xff, 0xf6, 0xe1, 0x04, 0xfc, 0xeb, 0xd3, 0x9f, 0xfa, 0xe4, 0xc4, 0xf4, 0xf9, 0xdf, 0xb9, 0xff, 0xf9, 0xde, 0xb6, 0xff, 0x81, 0xf9, 0xdd, 0xb4, 0xff, 0xa0, 0xf9, 0xdd, 0xb5, 
+  0xff, 0x01, 0xf9, 0xdf, 0xb8, 0xfb, 0xfd, 0xe7, 0xce, 0x3f, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf9, 0xf6, 0xee, 0x04, 0xfa, 0xea, 0xd0, 0xbb, 0xf8, 0xe1, 0xbc, 0xff, 0xf8, 0xde, 0xb5, 0xff, 
+  0xa4, 0xf8, 0xde, 0xb6, 0xff, 0x01, 0xf8, 0xde, 0xb7, 0xff, 0xf9, 0xe7, 0xc9, 0x93, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xf3, 0xe5, 0x04, 0xfa, 0xec, 0xd1, 0x9f, 0xf8, 0xe0, 0xbb, 0xff, 
+  0x96, 0xf7, 0xdf, 0xb9, 0xff, 0x03, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xba, 0xff, 0xfa, 0xe3, 0xc1, 0xff, 0xfc, 0xe6, 0xc7, 0xff, 0x81, 0xfd, 0xe8, 0xcb, 0xff, 0x03, 0xfd, 0xe6, 0xc8, 0xff, 
+  0xfb, 0xe4, 0xc3, 0xff, 0xf8, 0xe1, 0xbc, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0x85, 0xf7, 0xdf, 0xb9, 0xff, 0x01, 0xf7, 0xdf, 0xb8, 0xff, 0xf8, 0xe3, 0xc4, 0xd3, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0xf9, 0xed, 0xd5, 0x2b, 0xf7, 0xe3, 0xc1, 0xf4, 0x96, 0xf6, 0xe0, 0xba, 0xff, 0x0b, 0xf6, 0xe1, 0xbc, 0xff, 0xfa, 0xe3, 0xc3, 0xff, 0xfe, 0xe3, 0xc4, 0xff, 0xff, 0xdd, 0xb8, 0xff, 0xff, 0xd9, 
+  0xaf, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd4, 0xa7, 0xff, 0xff, 0xd7, 0xad, 0xff, 0xff, 0xdc, 0xb5, 0xff, 0xff, 0xe2, 0xc1, 0xff, 0xfc, 0xe4, 0xc4, 0xff, 0xf7, 0xe2, 0xbe, 0xff, 0x85, 0xf6, 
+  0xe0, 0xba, 0xff, 0x00, 0xf7, 0xe3, 0xc0, 0xfc, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xeb, 0xce, 0x8f, 0x95, 0xf5, 0xe2, 0xbc, 0xff, 0x04, 0xf5, 0xe2, 0xbb, 0xff, 0xf7, 0xe4, 0xc1, 0xff, 
+  0xfd, 0xe2, 0xc1, 0xff, 0xfe, 0xda, 0xaf, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0x81, 0xfe, 0xd6, 0xa8, 0xff, 0x82, 0xfe, 0xd6, 0xa9, 0xff, 0x81, 0xfe, 0xd6, 0xa8, 0xff, 0x03, 0xfe, 0xd7, 0xac, 0xff, 
+  0xfd, 0xdf, 0xbb, 0xff, 0xf9, 0xe6, 0xc5, 0xff, 0xf5, 0xe1, 0xbb, 0xff, 0x83, 0xf5, 0xe2, 0xbc, 0xff, 0x00, 0xf5, 0xe2, 0xbd, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xe7, 0xc8, 0xd4, 
+  0x95, 0xf5, 0xe2, 0xbd, 0xff, 0x01, 0xf7, 0xe4, 0xc3, 0xff, 0xfe, 0xe1, 0xbf, 0xff, 0x8a, 0xfe, 0xd6, 0xaa, 0xff, 0x07, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xdc, 0xb5, 0xff, 0xfa, 0xe5, 0xc6, 0xff, 
+  0xf7, 0xe4, 0xc1, 0xff, 0xf8, 0xe4, 0xc3, 0xff, 0xf8, 0xe4, 0xc4, 0xff, 0xf7, 0xe4, 0xc2, 0xff, 0xf6, 0xe4, 0xc1, 0xf7, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0xe6, 0xc4, 0xff, 0xf4, 0xe4, 
+  0xbf, 0xff, 0x93, 0xf4, 0xe4, 0xc0, 0xff, 0x02, 0xf6, 0xe4, 0xc2, 0xff, 0xfc, 0xe0, 0xbb, 0xff, 0xfd, 0xd8, 0xab, 0xff, 0x8b, 0xfd, 0xd8, 0xac, 0xff, 0x08, 0xfd, 0xd8, 0xab, 0xff, 0xfd, 0xdb, 
+  0xb1, 0xff, 0xfd, 0xdf, 0xba, 0xff, 0xfd, 0xdc, 0xb5, 0xff, 0xfd, 0xdb, 0xb3, 0xff, 0xfd, 0xdd, 0xb6, 0xff, 0xfd, 0xe1, 0xbc, 0xfc, 0xfe, 0xe7, 0xc8, 0xd7, 0xff, 0xec, 0xd3, 0x68, 0x91, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xf3, 0xe5, 0xc2, 0xff, 0x94, 0xf3, 0xe4, 0xc1, 0xff, 0x01, 0xfa, 0xe5, 0xc4, 0xff, 0xfc, 0xd9, 0xae, 0xff, 0x92, 0xfc, 0xd8, 0xad, 0xff, 0x81, 0xfc, 0xd8, 0xac, 0xff, 
+  0x02, 0xfd, 0xde, 0xba, 0xff, 0xfe, 0xe8, 0xcc, 0xb3, 0xfd, 0xec, 0xd3, 0x18, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe7, 0xc5, 0xd4, 0x93, 0xf2, 0xe6, 0xc3, 0xff, 0x02, 0xf5, 0xe7, 0xc8, 
+  0xff, 0xfc, 0xdd, 0xb6, 0xff, 0xfb, 0xda, 0xaf, 0xff, 0x94, 0xfb, 0xda, 0xb0, 0xff, 0x03, 0xfb, 0xd9, 0xaf, 0xff, 0xfb, 0xdc, 0xb3, 0xff, 0xfd, 0xe6, 0xc9, 0xc7, 0xff, 0xec, 0xe1, 0x0f, 0x8e, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe9, 0xca, 0x8f, 0x91, 0xf2, 0xe6, 0xc4, 0xff, 0x03, 0xf3, 0xe7, 0xc6, 0xff, 0xf3, 0xe7, 0xc7, 0xff, 0xf8, 0xe4, 0xc4, 0xff, 0xfa, 0xdb, 0xb0, 0xff, 0x97, 
+  0xfa, 0xdb, 0xb1, 0xff, 0x02, 0xfa, 0xdc, 0xb4, 0xff, 0xfc, 0xe9, 0xcb, 0x9f, 0xff, 0xf5, 0xf1, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xe9, 0xca, 0x2b, 0xf1, 0xe7, 0xc6, 0xf4, 0x8e, 
+  0xf1, 0xe7, 0xc6, 0xff, 0x05, 0xf3, 0xe8, 0xc9, 0xff, 0xf9, 0xeb, 0xcf, 0xff, 0xfa, 0xe7, 0xc9, 0xff, 0xfa, 0xe4, 0xc4, 0xff, 0xf9, 0xde, 0xb8, 0xff, 0xf9, 0xdc, 0xb3, 0xff, 0x97, 0xf9, 0xdc, 
+  0xb4, 0xff, 0x02, 0xf9, 0xdc, 0xb3, 0xff, 0xfa, 0xdf, 0xba, 0xf4, 0xfd, 0xeb, 0xce, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xec, 0xde, 0x04, 0xf1, 0xe9, 0xc7, 0x9f, 0x8d, 0xf1, 0xe8, 
+  0xc6, 0xff, 0x03, 0xf5, 0xe9, 0xcb, 0xff, 0xfb, 0xe7, 0xc9, 0xff, 0xf9, 0xde, 0xb8, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0x9b, 0xf9, 0xdd, 0xb5, 0xff, 0x01, 0xf9, 0xde, 0xb7, 0xff, 0xfb, 0xe7, 0xca, 
+  0x84, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xe8, 0xd1, 0x04, 0xf0, 0xe9, 0xc8, 0xbb, 0x8b, 0xf0, 0xe9, 0xc8, 0xff, 0x01, 0xf4, 0xeb, 0xcf, 0xff, 0xf8, 0xe4, 0xc3, 0xff, 0x9e, 0xf7, 0xdf, 
+  0xb8, 0xff, 0x01, 0xf7, 0xdf, 0xb7, 0xff, 0xf9, 0xe5, 0xc5, 0xcf, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf4, 0xe8, 0xce, 0x04, 0xf0, 0xe9, 0xca, 0x9f, 0xf0, 0xe9, 0xc9, 0xf4, 0x88, 0xf0, 0xe9, 
+  0xc9, 0xff, 0x02, 0xf0, 0xea, 0xca, 0xff, 0xf7, 0xe7, 0xc7, 0xff, 0xf7, 0xe0, 0xb8, 0xff, 0x9f, 0xf7, 0xe0, 0xb9, 0xff, 0x00, 0xf8, 0xe3, 0xbf, 0xfb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 
+  0xeb, 0xd2, 0x04, 0xef, 0xea, 0xca, 0x2b, 0xee, 0xea, 0xca, 0x8f, 0xef, 0xea, 0xca, 0xd4, 0xef, 0xe9, 0xca, 0xff, 0x85, 0xef, 0xea, 0xca, 0xff, 0x01, 0xf0, 0xea, 0xca, 0xff, 0xf5, 0xe3, 0xbf, 
+  0xff, 0xa0, 0xf5, 0xe2, 0xbc, 0xff, 0x00, 0xf5, 0xe3, 0xbd, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xe1, 0xbf, 0x24, 0xf5, 0xe2, 0xbf, 0xff, 0xa0, 0xf5, 0xe2, 0xbe, 0xff, 0x00, 0xf5, 
+  0xe3, 0xc0, 0xe0, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe4, 0xc0, 0x34, 0xa1, 0xf4, 0xe4, 0xc0, 0xff, 0x00, 0xf5, 0xe7, 0xc6, 0xa4, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe5, 0xc2, 
+  0x30, 0xa0, 0xf3, 0xe5, 0xc2, 0xff, 0x01, 0xf3, 0xe5, 0xc2, 0xfc, 0xf3, 0xe7, 0xcc, 0x48, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0xe7, 0xc8, 0x20, 0xf2, 0xe6, 0xc4, 0xf4, 0x9f, 0xf2, 0xe6, 
+  0xc4, 0xff, 0x01, 0xf1, 0xe6, 0xc4, 0xcf, 0xf6, 0xec, 0xd0, 0x0b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0xef, 0xda, 0x04, 0xf1, 0xe8, 0xc6, 0xb7, 0x9e, 0xf1, 0xe7, 0xc5, 0xff, 0x01, 0xf1, 
+  0xe7, 0xc5, 0xf7, 0xf1, 0xe9, 0xca, 0x38, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0xeb, 0xd1, 0x1b, 0xf1, 0xe8, 0xc7, 0xe3, 0x9c, 0xf0, 0xe8, 0xc7, 0xff, 0x01, 0xf0, 0xe8, 0xc7, 0xef, 0xf0, 
+  0xea, 0xc9, 0x44, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf3, 0xe8, 0xcc, 0x1c, 0xf0, 0xe9, 0xc9, 0xc8, 0xf0, 0xe9, 0xc8, 0xfb, 0x98, 0xf0, 0xe9, 0xc8, 0xff, 0x02, 0xf0, 0xe9, 0xc8, 0xf7, 0xf0, 
+  0xe9, 0xc7, 0xc0, 0xef, 0xea, 0xcb, 0x2b, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf1, 0xee, 0xd5, 0x0b, 0xf0, 0xe9, 0xcb, 0x63, 0xef, 0xea, 0xcb, 0xbc, 0xef, 0xea, 0xca, 0xf0, 0xef, 0xea, 0xca, 
+  0xfc, 0x93, 0xef, 0xea, 0xca, 0xfb, 0x03, 0xef, 0xe9, 0xca, 0xdb, 0xef, 0xea, 0xca, 0xa0, 0xf0, 0xea, 0xcb, 0x47, 0xf4, 0xed, 0xd0, 0x07, 0x95, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 
+  0x2c, 0xfc, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xaa, 0x18, 0xfd, 0xd7, 0xaa, 0x13, 0xfe, 0xd7, 0xab, 0x20, 0xba, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfc, 0xd6, 0xab, 0xdb, 0xfd, 0xd8, 0xab, 0xe0, 0xfe, 
+  0xd7, 0xaa, 0x54, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xac, 0x6c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd6, 0xaf, 0x03, 0xfd, 0xd7, 0xab, 0xab, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xaa, 
+  0x98, 0xff, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xab, 0xcb, 0xfd, 0xd7, 0xac, 0x2c, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xd7, 0xab, 0x0c, 0xff, 0xd5, 0xaa, 0x0c, 0xfc, 
+  0xd7, 0xab, 0x27, 0xfd, 0xd6, 0xac, 0x1b, 0xfd, 0xd7, 0xaa, 0x17, 0xfe, 0xd7, 0xab, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xda, 0xa9, 0x07, 0xfd, 0xd7, 0xab, 0xc0, 0x00, 0x00, 0x00, 
+  0x00, 0xfd, 0xd7, 0xab, 0xb3, 0xfd, 0xd7, 0xab, 0xc3, 0xfe, 0xd4, 0xac, 0x14, 0xfe, 0xd7, 0xab, 0x44, 0xfd, 0xd6, 0xab, 0x4f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xd5, 0xaa, 0x3b, 0xfd, 
+  0xd7, 0xab, 0xd0, 0xfd, 0xd8, 0xab, 0xb7, 0xfd, 0xd7, 0xab, 0xc7, 0xfd, 0xd7, 0xab, 0xcc, 0xfe, 0xd9, 0xab, 0x23, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xd7, 0xab, 
+  0xff, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdf, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd7, 0xab, 0xef, 0xfd, 0xd6, 0xac, 0x5c, 0x8d, 0x00, 0x00, 
+  0x00, 0x00, 0x07, 0xfd, 0xd7, 0xae, 0x0b, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xeb, 0xfd, 0xd8, 0xaa, 0x54, 0xfe, 0xd7, 0xab, 0x94, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd6, 0xac, 0xb0, 0xf8, 
+  0xdf, 0xa4, 0x04, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd6, 0xac, 0x18, 0xfc, 0xd7, 0xab, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xd0, 0xfe, 0xd8, 0xab, 0x77, 0xfe, 0xd5, 0xab, 
+  0x43, 0xfe, 0xd6, 0xac, 0x18, 0xfd, 0xd7, 0xab, 0x63, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd8, 0xaa, 0x4b, 0xfd, 0xd7, 0xab, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 
+  0xd6, 0xac, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xc8, 0xff, 0xd0, 0xa5, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0xd7, 0xab, 0x97, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd8, 0xab, 
+  0x9c, 0xfe, 0xd7, 0xab, 0x1f, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd5, 0xad, 0x13, 0x85, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xd6, 0xab, 0x43, 0xfe, 0xd6, 0xab, 0x78, 0xfc, 
+  0xd7, 0xab, 0xc8, 0xfd, 0xd6, 0xac, 0xa3, 0xfd, 0xd7, 0xaa, 0x98, 0xfe, 0xd7, 0xab, 0x28, 0x81, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0xd7, 0xab, 0x27, 0xfd, 0xd7, 0xab, 0xe4, 0xfd, 0xd7, 0xab, 
+  0xfb, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xf4, 0xfd, 0xd7, 0xab, 0xdc, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xcc, 0xfd, 0xd6, 0xac, 0x17, 0xa1, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0xe7, 0xfc, 0xd7, 0xab, 0xc3, 0xfd, 0xd7, 0xaa, 0x73, 0xfd, 0xd7, 0xab, 0x97, 0xfe, 0xd7, 0xab, 0x97, 0x86, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xd7, 0xab, 
+  0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd9, 0xaa, 0x50, 0xfe, 0xd7, 0xab, 0x90, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x9f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd6, 0xac, 0x6f, 0xfc, 
+  0xd8, 0xaa, 0x48, 0xfd, 0xd7, 0xa9, 0x30, 0xfd, 0xd7, 0xab, 0xcf, 0xfd, 0xd7, 0xab, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0x87, 0xfc, 0xd8, 0xa9, 0x30, 0xad, 0x00, 0x00, 0x00, 0x00, 
+  0x07, 0xfd, 0xd7, 0xac, 0x70, 0xfc, 0xd8, 0xaa, 0x48, 0xfd, 0xd7, 0xa9, 0x30, 0xfd, 0xd7, 0xab, 0xcf, 0xfd, 0xd7, 0xab, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0x87, 0xfc, 0xd8, 0xa9, 
+  0x30, 0x82, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd9, 0xaa, 0x50, 0xfe, 0xd7, 0xab, 0x90, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x9f, 0xad, 
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xfd, 0xd7, 0xab, 0x27, 0xfd, 0xd7, 0xab, 0xe4, 0xfd, 0xd7, 0xab, 0xfb, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xf4, 0xfd, 0xd7, 0xab, 
+  0xdc, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xcc, 0xfd, 0xd6, 0xac, 0x17, 0x81, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xd7, 0xab, 0x43, 0xfe, 0xd6, 0xab, 0x78, 0xfc, 0xd7, 0xab, 0xc8, 0xfd, 
+  0xd6, 0xac, 0xa3, 0xfd, 0xd8, 0xaa, 0x9c, 0xfe, 0xd7, 0xab, 0x28, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0xac, 0xfc, 0xd7, 0xab, 0x83, 0xfd, 0xd7, 0xaa, 0x5f, 0xfd, 0xd7, 0xaa, 
+  0x4f, 0xfe, 0xd7, 0xab, 0x7f, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd8, 0xaa, 0x48, 0xfd, 0xd7, 0xab, 0x9c, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd6, 0xac, 0xb8, 0x00, 
+  0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xc8, 0xff, 0xd0, 0xa5, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xd6, 0xab, 0x34, 0xfc, 0xd6, 0xab, 0xe7, 0xfd, 0xd8, 0xab, 0xd4, 0xfe, 0xd7, 0xab, 
+  0x38, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0x84, 0xff, 0xd8, 0xab, 0x07, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd4, 0xae, 0x0b, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xeb, 0xfd, 
+  0xd8, 0xaa, 0x54, 0xfe, 0xd7, 0xab, 0x94, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd6, 0xac, 0xb0, 0xf8, 0xdf, 0xa4, 0x04, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd7, 0xac, 0x18, 0xfc, 0xd8, 0xab, 
+  0x73, 0xfd, 0xd7, 0xab, 0x44, 0xfd, 0xd7, 0xab, 0xc8, 0xfe, 0xd8, 0xaa, 0x40, 0xfe, 0xd6, 0xab, 0x83, 0xfd, 0xd7, 0xac, 0x44, 0xfc, 0xd7, 0xab, 0x57, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 
+  0xd7, 0xaa, 0x3c, 0xfd, 0xd7, 0xab, 0xd0, 0xfd, 0xd8, 0xab, 0xb7, 0xfd, 0xd7, 0xab, 0xc7, 0xfd, 0xd7, 0xab, 0xcc, 0xfe, 0xd9, 0xab, 0x23, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 0xd7, 0xab, 
+  0x44, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd6, 0xab, 0x30, 0xfd, 0xd7, 0xab, 0xbf, 0xfd, 0xd7, 0xab, 0xf0, 0xfd, 0xd7, 0xab, 0x48, 0xfe, 0xd7, 0xab, 0x8c, 0xfd, 0xd6, 0xab, 0x7c, 0xfd, 0xd6, 0xac, 
+  0x17, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xd7, 0xab, 0x0c, 0xff, 0xd5, 0xaa, 0x0c, 0xfc, 0xd7, 0xab, 0x27, 0xfd, 0xd6, 0xac, 0x1b, 0xfd, 0xd8, 0xaa, 0x18, 0xfe, 0xd7, 0xab, 0x08, 0x8d, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 0xd7, 0xab, 0x44, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd6, 0xab, 0x30, 0xfd, 0xd7, 0xab, 0xbf, 0xfd, 0xd7, 0xab, 0xf0, 0xfd, 0xd7, 0xab, 0x48, 0xfe, 0xd7, 0xab, 
+  0x8c, 0xfd, 0xd6, 0xab, 0x7c, 0xfd, 0xd6, 0xac, 0x17, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd6, 0xac, 0x17, 0xfc, 0xd7, 0xab, 0x73, 0xfd, 0xd7, 0xab, 0x44, 0xfd, 0xd7, 0xab, 0xc8, 0xfe, 
+  0xd8, 0xaa, 0x40, 0xfe, 0xd6, 0xab, 0x83, 0xfd, 0xd7, 0xac, 0x44, 0xfc, 0xd7, 0xab, 0x57, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xd8, 0xab, 0x38, 0xfc, 0xd6, 0xab, 0xe7, 0xfd, 0xd8, 0xab, 
+  0xd4, 0xfe, 0xd7, 0xab, 0x38, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0x84, 0xff, 0xd8, 0xab, 0x07, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0xac, 0xfc, 0xd7, 0xab, 0x83, 0xfd, 
+  0xd7, 0xaa, 0x5f, 0xfd, 0xd8, 0xaa, 0x50, 0xfe, 0xd7, 0xab, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +276,7 @@ const lv_img_dsc_t owm_13d_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_13d_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_13d_64px_map,
 };
-
@@ -10,271 +10,261 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_13N_64PX uint8_t owm_13n_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xff, 0x0c, 0xff, 0x1c, 0xff, 0x28, 0xff, 0x33, 0xff, 0x33, 0xff, 0x28, 0xff, 0x1c, 0xff, 0x0c, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x20, 0xff, 0x84, 0xdf, 0xe0, 0xdf, 0xef, 0xdf, 0xfb, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfb, 0xdf, 0xef, 0xdf, 0xe0, 0xff, 0x84, 0xdf, 0x20, 0xdf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xdf, 0x83, 0xdf, 0xf3, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xf3, 0xdf, 0x83, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x2f, 0xdf, 0xcc, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xcc, 0xff, 0x2f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xff, 0x00, 0xff, 0x2b, 0xdf, 0xe7, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xe7, 0xff, 0x33, 0xff, 0x1c, 0xff, 0x2b, 0xff, 0x33, 0xff, 0x2f, 0xff, 0x23, 0xff, 0x13, 0xff, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x1c, 0xdf, 0xd7, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xf3, 0xdf, 0xef, 0xdf, 0xfc, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf4, 0xdf, 0xe7, 0xdf, 0xa8, 0xff, 0x37, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x04, 0xdf, 0xa4, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x8f, 0xff, 0x14, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdf, 0x3c, 0xdf, 0xf7, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xc4, 0xff, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0xdf, 0x00, 0xdf, 0xab, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xc4, 0xff, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x8f, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0xff, 0x70, 0xff, 0xc0, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0x37, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x64, 0xdf, 0xe4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x9f, 0x00, 0xff, 0x78, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xe7, 0xff, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x4b, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf4, 0xdf, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xbf, 0x00, 0xdf, 0xcc, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x48, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x8f, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x3b, 0xf7, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xbf, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xeb, 0xdf, 0x97, 0xff, 0x14, 0xff, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xbf, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xdf, 0xe0, 0xdf, 0x40, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x8f, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xec, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x48, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xdc, 0xff, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xbf, 0x00, 0xdf, 0xcc, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x88, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdf, 0x4b, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xe0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdf, 0x00, 0xdf, 0x78, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf4, 0xdf, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x64, 0xdf, 0xe4, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x14, 0xdf, 0x70, 0xdf, 0xc0, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf8, 0xdf, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xeb, 0xdf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xb3, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0xcb, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x30, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xdf, 0x53, 0xdf, 0xfc, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x77, 0xdf, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0xff, 0x07, 0xdf, 0xa8, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0x88, 0xff, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xbf, 0x00, 0xdf, 0x97, 0xdf, 0xf3, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xfc, 0xdf, 0xdc, 0xdf, 0x5b, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x3f, 0xdf, 0xa4, 0xdf, 0xe4, 0xdf, 0xfc, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xe8, 0xdf, 0xb7, 0xdf, 0x64, 0xdf, 0x13, 0xdf, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x2c, 0xbf, 0x08, 0xbf, 0x1c, 0xbf, 0x18, 0xbf, 0x24, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xdf, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0xbf, 0xa8, 0xbf, 0xd3, 0xbf, 0x50, 0xbf, 0xf7, 0xbf, 0xa7, 0xdb, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x43, 0xbf, 0xd0, 0xbf, 0xd4, 0xbf, 0x0c, 0xbf, 0xd3, 0xbf, 0xd8, 0xbf, 0x7c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x2c, 0xbf, 0x20, 0xbf, 0x18, 0xbf, 0x13, 0xbf, 0x20, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x88, 0xbf, 0x1c, 0xbf, 0x34, 0xbf, 0xd3, 0xbf, 0x7c, 0xdf, 0x00, 0xbf, 0xcb, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x93, 0x00, 0xbf, 0xdb, 0xbf, 0xe0, 0xbf, 0x54, 0xbf, 0xe7, 0xbf, 0x6c, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x94, 0xbf, 0xf3, 0xbf, 0xe7, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0xe8, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0x98, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0xbf, 0xab, 0xbf, 0xd7, 0xbf, 0x98, 0xbf, 0x20, 0xbf, 0xd7, 0xbf, 0xcb, 0xbf, 0x2c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x8f, 0xbf, 0x00, 0xbf, 0x78, 0xbf, 0x73, 0xbf, 0xc7, 0xbf, 0x00, 0xbf, 0xa0, 0xbf, 0x08, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x07, 0xbf, 0xc0, 0xbf, 0x00, 0xbf, 0xb3, 0xbf, 0xc3, 0xbf, 0x14, 0xbf, 0x44, 0xbf, 0x4f, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x1f, 0xbf, 0xfb, 0xbf, 0xf0, 0xbf, 0x08, 0xbf, 0xdc, 0xbf, 0xff, 0xbf, 0x5b, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0xe7, 0xbf, 0xc3, 0xbf, 0x73, 0xbf, 0x94, 0xbf, 0x97, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0xd4, 0xbf, 0xff, 0xbf, 0xdb, 0xbf, 0xf3, 0xbf, 0xff, 0xbf, 0xdf, 0xbf, 0xec, 0xbf, 0xef, 0xbf, 0x5c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0xd4, 0xbf, 0x6c, 0xbf, 0x80, 0xbf, 0xaf, 0xbf, 0xbf, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x97, 0xbf, 0xff, 0xbf, 0x9c, 0xbf, 0x1f, 0xbf, 0xff, 0xbf, 0xe0, 0xbf, 0x13, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x18, 0xbf, 0x7b, 0xbf, 0x00, 0xbf, 0xd0, 0xbf, 0x77, 0xbf, 0x43, 0xbf, 0x18, 0xbf, 0x63, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x18, 0xbf, 0x7b, 0xbf, 0x00, 0xbf, 0xd0, 0xbf, 0x77, 0xbf, 0x43, 0xbf, 0x18, 0xbf, 0x63, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x97, 0xbf, 0xff, 0xbf, 0x9c, 0xbf, 0x1f, 0xbf, 0xff, 0xbf, 0xe0, 0xbf, 0x13, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0xd4, 0xbf, 0xff, 0xbf, 0xdb, 0xbf, 0xf3, 0xbf, 0xff, 0xbf, 0xdf, 0xbf, 0xec, 0xbf, 0xef, 0xbf, 0x5c, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0xe7, 0xbf, 0xc3, 0xbf, 0x73, 0xbf, 0x97, 0xbf, 0x97, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0xab, 0xbf, 0x28, 0xbf, 0x6f, 0xbf, 0x64, 0xbf, 0x93, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x07, 0xbf, 0xc0, 0xbf, 0x00, 0xbf, 0xb3, 0xbf, 0xc3, 0xbf, 0x14, 0xbf, 0x44, 0xbf, 0x4f, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x0b, 0xbf, 0xb7, 0xbf, 0xff, 0xbf, 0x28, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0x1f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0xbf, 0xab, 0xbf, 0xd7, 0xbf, 0x98, 0xbf, 0x20, 0xbf, 0xd7, 0xbf, 0xcb, 0xbf, 0x2c, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x7b, 0xbf, 0x38, 0xbf, 0xaf, 0xbf, 0x30, 0xbf, 0xe3, 0xbf, 0x33, 0xbf, 0x84, 0xbf, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x03, 0xbf, 0xdb, 0xbf, 0xe0, 0xbf, 0x54, 0xbf, 0xe7, 0xbf, 0x6c, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x20, 0xbf, 0xa8, 0xbf, 0x6b, 0xbf, 0x58, 0xbf, 0xff, 0xbf, 0x88, 0xbf, 0x4f, 0xbf, 0xeb, 0xbf, 0x28, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x2c, 0xbf, 0x20, 0xbf, 0x18, 0xbf, 0x14, 0xbf, 0x20, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x20, 0xbf, 0xa8, 0xbf, 0x6b, 0xbf, 0x58, 0xbf, 0xff, 0xbf, 0x88, 0xbf, 0x4f, 0xbf, 0xeb, 0xbf, 0x28, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x78, 0xbf, 0x38, 0xbf, 0xaf, 0xbf, 0x30, 0xbf, 0xe3, 0xbf, 0x33, 0xbf, 0x84, 0xbf, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x0b, 0xbf, 0xb7, 0xbf, 0xff, 0xbf, 0x28, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0x1f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0xab, 0xbf, 0x28, 0xbf, 0x6f, 0xbf, 0x64, 0xbf, 0x93, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x97, 0x00, 0x00, 0x02, 0xff, 0x0c, 0xff, 0x1c, 0xff, 0x28, 0x81, 0xff, 0x33, 0x02, 0xff, 0x28, 0xff, 0x1c, 0xff, 
+  0x0c, 0xb5, 0x00, 0x00, 0x04, 0xdf, 0x20, 0xff, 0x84, 0xdf, 0xe0, 0xdf, 0xef, 0xdf, 0xfb, 0x81, 0xdf, 0xff, 0x04, 0xdf, 0xfb, 0xdf, 0xef, 0xdf, 0xe0, 0xff, 0x84, 0xdf, 0x20, 0xb1, 0x00, 0x00, 
+  0x03, 0xff, 0x13, 0xdf, 0x83, 0xdf, 0xf3, 0xdf, 0xff, 0x87, 0xbf, 0xff, 0x03, 0xdf, 0xff, 0xdf, 0xf3, 0xdf, 0x83, 0xff, 0x13, 0xae, 0x00, 0x00, 0x01, 0xff, 0x2f, 0xdf, 0xcc, 0x8d, 0xbf, 0xff, 
+  0x01, 0xdf, 0xcc, 0xff, 0x2f, 0xac, 0x00, 0x00, 0x01, 0xff, 0x2b, 0xdf, 0xe7, 0x8f, 0xbf, 0xff, 0x07, 0xdf, 0xe7, 0xff, 0x33, 0xff, 0x1c, 0xff, 0x2b, 0xff, 0x33, 0xff, 0x2f, 0xff, 0x23, 0xff, 
+  0x13, 0xa4, 0x00, 0x00, 0x01, 0xff, 0x1c, 0xdf, 0xd7, 0x91, 0xbf, 0xff, 0x02, 0xdf, 0xf3, 0xdf, 0xef, 0xdf, 0xfc, 0x81, 0xdf, 0xff, 0x03, 0xdf, 0xf4, 0xdf, 0xe7, 0xdf, 0xa8, 0xff, 0x37, 0xa1, 
+  0x00, 0x00, 0x01, 0xff, 0x04, 0xdf, 0xa4, 0x99, 0xbf, 0xff, 0x81, 0xdf, 0xff, 0x01, 0xdf, 0x8f, 0xff, 0x14, 0x9f, 0x00, 0x00, 0x01, 0xdf, 0x3c, 0xdf, 0xf7, 0x9b, 0xbf, 0xff, 0x02, 0xdf, 0xff, 
+  0xdf, 0xc4, 0xff, 0x20, 0x9e, 0x00, 0x00, 0x01, 0xdf, 0xab, 0xdf, 0xff, 0x9c, 0xbf, 0xff, 0x02, 0xdf, 0xff, 0xdf, 0xc4, 0xff, 0x14, 0x9c, 0x00, 0x00, 0x00, 0xff, 0x0c, 0xa0, 0xdf, 0xff, 0x00, 
+  0xdf, 0x8f, 0x98, 0x00, 0x00, 0x03, 0xff, 0x14, 0xff, 0x70, 0xff, 0xc0, 0xdf, 0xf7, 0xa2, 0xdf, 0xff, 0x00, 0xff, 0x37, 0x96, 0x00, 0x00, 0x01, 0xff, 0x64, 0xdf, 0xe4, 0xa5, 0xdf, 0xff, 0x00, 
+  0xdf, 0xa8, 0x95, 0x00, 0x00, 0x00, 0xff, 0x78, 0xa7, 0xdf, 0xff, 0x01, 0xdf, 0xe7, 0xff, 0x13, 0x93, 0x00, 0x00, 0x01, 0xff, 0x4b, 0xdf, 0xf7, 0xa7, 0xdf, 0xff, 0x01, 0xdf, 0xf4, 0xdf, 0x23, 
+  0x93, 0x00, 0x00, 0x00, 0xdf, 0xcc, 0x9b, 0xdf, 0xff, 0x82, 0xbf, 0xff, 0x8a, 0xdf, 0xff, 0x00, 0xdf, 0x2f, 0x92, 0x00, 0x00, 0x00, 0xff, 0x48, 0x99, 0xdf, 0xff, 0x88, 0xbf, 0xff, 0x87, 0xdf, 
+  0xff, 0x00, 0xdf, 0x33, 0x92, 0x00, 0x00, 0x00, 0xdf, 0x8f, 0x97, 0xdf, 0xff, 0x8c, 0xbf, 0xff, 0x85, 0xdf, 0xff, 0x00, 0xdf, 0x3b, 0x92, 0x00, 0x00, 0x00, 0xdf, 0xbf, 0x96, 0xdf, 0xff, 0x8e, 
+  0xbf, 0xff, 0x84, 0xdf, 0xff, 0x02, 0xdf, 0xeb, 0xdf, 0x97, 0xff, 0x14, 0x90, 0x00, 0x00, 0x00, 0xdf, 0xbf, 0x96, 0xdf, 0xff, 0x94, 0xbf, 0xff, 0x02, 0xdf, 0xff, 0xdf, 0xe0, 0xdf, 0x40, 0x8f, 
+  0x00, 0x00, 0x00, 0xdf, 0x8f, 0x95, 0xdf, 0xff, 0x97, 0xbf, 0xff, 0x01, 0xdf, 0xec, 0xff, 0x3c, 0x8e, 0x00, 0x00, 0x00, 0xdf, 0x48, 0xae, 0xdf, 0xff, 0x01, 0xdf, 0xdc, 0xff, 0x0b, 0x8e, 0x00, 
+  0x00, 0x00, 0xdf, 0xcc, 0xae, 0xdf, 0xff, 0x00, 0xdf, 0x88, 0x8e, 0x00, 0x00, 0x01, 0xdf, 0x4b, 0xdf, 0xf7, 0xad, 0xdf, 0xff, 0x01, 0xdf, 0xe0, 0xff, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0xdf, 0x78, 
+  0xad, 0xdf, 0xff, 0x01, 0xdf, 0xf4, 0xdf, 0x23, 0x8f, 0x00, 0x00, 0x01, 0xdf, 0x64, 0xdf, 0xe4, 0xac, 0xdf, 0xff, 0x00, 0xdf, 0x2f, 0x90, 0x00, 0x00, 0x03, 0xdf, 0x14, 0xdf, 0x70, 0xdf, 0xc0, 
+  0xdf, 0xf7, 0xa9, 0xdf, 0xff, 0x00, 0xdf, 0x30, 0x9b, 0x00, 0x00, 0xa1, 0xdf, 0xff, 0x01, 0xdf, 0xf8, 0xdf, 0x27, 0x9b, 0x00, 0x00, 0xa1, 0xdf, 0xff, 0x01, 0xdf, 0xeb, 0xdf, 0x17, 0x9b, 0x00, 
+  0x00, 0xa1, 0xdf, 0xff, 0x01, 0xdf, 0xb3, 0xff, 0x03, 0x9b, 0x00, 0x00, 0x00, 0xdf, 0xcb, 0xa0, 0xdf, 0xff, 0x00, 0xdf, 0x30, 0x9c, 0x00, 0x00, 0x01, 0xdf, 0x53, 0xdf, 0xfc, 0x9e, 0xdf, 0xff, 
+  0x00, 0xdf, 0x77, 0x9d, 0x00, 0x00, 0x01, 0xff, 0x07, 0xdf, 0xa8, 0x9d, 0xdf, 0xff, 0x01, 0xdf, 0x88, 0xff, 0x07, 0x9f, 0x00, 0x00, 0x01, 0xdf, 0x97, 0xdf, 0xf3, 0x98, 0xdf, 0xff, 0x02, 0xdf, 
+  0xfc, 0xdf, 0xdc, 0xdf, 0x5b, 0xa2, 0x00, 0x00, 0x03, 0xdf, 0x3f, 0xdf, 0xa4, 0xdf, 0xe4, 0xdf, 0xfc, 0x93, 0xdf, 0xfb, 0x03, 0xdf, 0xe8, 0xdf, 0xb7, 0xdf, 0x64, 0xdf, 0x13, 0x95, 0x00, 0x00, 
+  0x04, 0xbf, 0x2c, 0xbf, 0x08, 0xbf, 0x1c, 0xbf, 0x18, 0xbf, 0x24, 0xba, 0x00, 0x00, 0x04, 0xbf, 0xa8, 0xbf, 0xd3, 0xbf, 0x50, 0xbf, 0xf7, 0xbf, 0xa7, 0xb9, 0x00, 0x00, 0x06, 0xbf, 0x43, 0xbf, 
+  0xd0, 0xbf, 0xd4, 0xbf, 0x0c, 0xbf, 0xd3, 0xbf, 0xd8, 0xbf, 0x7c, 0x90, 0x00, 0x00, 0x04, 0xbf, 0x2c, 0xbf, 0x20, 0xbf, 0x18, 0xbf, 0x13, 0xbf, 0x20, 0xa2, 0x00, 0x00, 0x06, 0xbf, 0x88, 0xbf, 
+  0x1c, 0xbf, 0x34, 0xbf, 0xd3, 0xbf, 0x7c, 0x00, 0x00, 0xbf, 0xcb, 0x90, 0x00, 0x00, 0x04, 0xbf, 0xdb, 0xbf, 0xe0, 0xbf, 0x54, 0xbf, 0xe7, 0xbf, 0x6c, 0xa1, 0x00, 0x00, 0x08, 0xbf, 0x94, 0xbf, 
+  0xf3, 0xbf, 0xe7, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0xe8, 0xbf, 0xe0, 0xbf, 0xff, 0xbf, 0x98, 0x8d, 0x00, 0x00, 0x07, 0xbf, 0x03, 0xbf, 0xab, 0xbf, 0xd7, 0xbf, 0x98, 0xbf, 0x20, 0xbf, 0xd7, 0xbf, 
+  0xcb, 0xbf, 0x2c, 0xa1, 0x00, 0x00, 0x07, 0xbf, 0x8f, 0x00, 0x00, 0xbf, 0x78, 0xbf, 0x73, 0xbf, 0xc7, 0x00, 0x00, 0xbf, 0xa0, 0xbf, 0x08, 0x8d, 0x00, 0x00, 0x07, 0xbf, 0x07, 0xbf, 0xc0, 0x00, 
+  0x00, 0xbf, 0xb3, 0xbf, 0xc3, 0xbf, 0x14, 0xbf, 0x44, 0xbf, 0x4f, 0xa1, 0x00, 0x00, 0x06, 0xbf, 0x1f, 0xbf, 0xfb, 0xbf, 0xf0, 0xbf, 0x08, 0xbf, 0xdc, 0xbf, 0xff, 0xbf, 0x5b, 0x86, 0x00, 0x00, 
+  0x04, 0xbf, 0xe7, 0xbf, 0xc3, 0xbf, 0x73, 0xbf, 0x94, 0xbf, 0x97, 0x82, 0x00, 0x00, 0x08, 0xbf, 0xd4, 0xbf, 0xff, 0xbf, 0xdb, 0xbf, 0xf3, 0xbf, 0xff, 0xbf, 0xdf, 0xbf, 0xec, 0xbf, 0xef, 0xbf, 
+  0x5c, 0xa1, 0x00, 0x00, 0x04, 0xbf, 0xd4, 0xbf, 0x6c, 0xbf, 0x80, 0xbf, 0xaf, 0xbf, 0xbf, 0x86, 0x00, 0x00, 0x06, 0xbf, 0x97, 0xbf, 0xff, 0xbf, 0x9c, 0xbf, 0x1f, 0xbf, 0xff, 0xbf, 0xe0, 0xbf, 
+  0x13, 0x81, 0x00, 0x00, 0x07, 0xbf, 0x18, 0xbf, 0x7b, 0x00, 0x00, 0xbf, 0xd0, 0xbf, 0x77, 0xbf, 0x43, 0xbf, 0x18, 0xbf, 0x63, 0xad, 0x00, 0x00, 0x07, 0xbf, 0x18, 0xbf, 0x7b, 0x00, 0x00, 0xbf, 
+  0xd0, 0xbf, 0x77, 0xbf, 0x43, 0xbf, 0x18, 0xbf, 0x63, 0x82, 0x00, 0x00, 0x06, 0xbf, 0x97, 0xbf, 0xff, 0xbf, 0x9c, 0xbf, 0x1f, 0xbf, 0xff, 0xbf, 0xe0, 0xbf, 0x13, 0xad, 0x00, 0x00, 0x08, 0xbf, 
+  0xd4, 0xbf, 0xff, 0xbf, 0xdb, 0xbf, 0xf3, 0xbf, 0xff, 0xbf, 0xdf, 0xbf, 0xec, 0xbf, 0xef, 0xbf, 0x5c, 0x82, 0x00, 0x00, 0x02, 0xbf, 0xe7, 0xbf, 0xc3, 0xbf, 0x73, 0x81, 0xbf, 0x97, 0x85, 0x00, 
+  0x00, 0x04, 0xbf, 0xab, 0xbf, 0x28, 0xbf, 0x6f, 0xbf, 0x64, 0xbf, 0x93, 0xa3, 0x00, 0x00, 0x07, 0xbf, 0x07, 0xbf, 0xc0, 0x00, 0x00, 0xbf, 0xb3, 0xbf, 0xc3, 0xbf, 0x14, 0xbf, 0x44, 0xbf, 0x4f, 
+  0x8d, 0x00, 0x00, 0x06, 0xbf, 0x0b, 0xbf, 0xb7, 0xbf, 0xff, 0xbf, 0x28, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0x1f, 0xa2, 0x00, 0x00, 0x07, 0xbf, 0x03, 0xbf, 0xab, 0xbf, 0xd7, 0xbf, 0x98, 0xbf, 0x20, 
+  0xbf, 0xd7, 0xbf, 0xcb, 0xbf, 0x2c, 0x8d, 0x00, 0x00, 0x07, 0xbf, 0x7b, 0xbf, 0x38, 0xbf, 0xaf, 0xbf, 0x30, 0xbf, 0xe3, 0xbf, 0x33, 0xbf, 0x84, 0xbf, 0x0b, 0xa2, 0x00, 0x00, 0x05, 0xbf, 0x03, 
+  0xbf, 0xdb, 0xbf, 0xe0, 0xbf, 0x54, 0xbf, 0xe7, 0xbf, 0x6c, 0x8d, 0x00, 0x00, 0x08, 0xbf, 0x20, 0xbf, 0xa8, 0xbf, 0x6b, 0xbf, 0x58, 0xbf, 0xff, 0xbf, 0x88, 0xbf, 0x4f, 0xbf, 0xeb, 0xbf, 0x28, 
+  0xa3, 0x00, 0x00, 0x04, 0xbf, 0x2c, 0xbf, 0x20, 0xbf, 0x18, 0xbf, 0x14, 0xbf, 0x20, 0x8d, 0x00, 0x00, 0x08, 0xbf, 0x20, 0xbf, 0xa8, 0xbf, 0x6b, 0xbf, 0x58, 0xbf, 0xff, 0xbf, 0x88, 0xbf, 0x4f, 
+  0xbf, 0xeb, 0xbf, 0x28, 0xb7, 0x00, 0x00, 0x07, 0xbf, 0x78, 0xbf, 0x38, 0xbf, 0xaf, 0xbf, 0x30, 0xbf, 0xe3, 0xbf, 0x33, 0xbf, 0x84, 0xbf, 0x0b, 0xb7, 0x00, 0x00, 0x06, 0xbf, 0x0b, 0xbf, 0xb7, 
+  0xbf, 0xff, 0xbf, 0x28, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0x1f, 0xb9, 0x00, 0x00, 0x04, 0xbf, 0xab, 0xbf, 0x28, 0xbf, 0x6f, 0xbf, 0x64, 0xbf, 0x93, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xcd, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xcf, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0xcf, 0x00, 0x5f, 0xdf, 0x0c, 0x7f, 0xd7, 0x1c, 0x7f, 0xd7, 0x28, 0x7f, 0xd7, 0x33, 0x7f, 0xd7, 0x33, 0x7f, 0xd7, 0x28, 0x7f, 0xd7, 0x1c, 0x5f, 0xdf, 0x0c, 0x7f, 0xcf, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xcf, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0xd7, 0x20, 0x5f, 0xd7, 0x84, 0x3f, 0xcf, 0xe0, 0x1f, 0xbf, 0xef, 0xff, 0xbe, 0xfb, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xff, 0xbe, 0xfb, 0x1f, 0xbf, 0xef, 0x3f, 0xcf, 0xe0, 0x5f, 0xd7, 0x84, 0x7f, 0xd7, 0x20, 0x5f, 0xd7, 0x00, 0x7f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x13, 0x5f, 0xcf, 0x83, 0x1f, 0xc7, 0xf3, 0xdf, 0xb6, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xf3, 0x5f, 0xcf, 0x83, 0x7f, 0xd7, 0x13, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0x9f, 0xdf, 0x2f, 0x3f, 0xcf, 0xcc, 0xdf, 0xb6, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x3f, 0xcf, 0xcc, 0x9f, 0xdf, 0x2f, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x2b, 0x1f, 0xc7, 0xe7, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0x1f, 0xc7, 0xe7, 0x7f, 0xd7, 0x33, 0x7f, 0xd7, 0x1c, 0x7f, 0xdf, 0x2b, 0x7f, 0xdf, 0x33, 0x7f, 0xdf, 0x2f, 0x7f, 0xdf, 0x23, 0x7f, 0xdf, 0x13, 0x9f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x00, 0x7f, 0xdf, 0x1c, 0x3f, 0xc7, 0xd7, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xbf, 0xf3, 0x1f, 0xc7, 0xef, 0xff, 0xbe, 0xfc, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0x1f, 0xbf, 0xf4, 0x3f, 0xcf, 0xe7, 0x5f, 0xd7, 0xa8, 0x7f, 0xd7, 0x37, 0x7f, 0xd7, 0x00, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0x9f, 0xe7, 0x04, 0x5f, 0xcf, 0xa4, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xff, 0x5f, 0xd7, 0x8f, 0x7f, 0xd7, 0x14, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0x5f, 0xcf, 0x3c, 0xff, 0xbe, 0xf7, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xc4, 0x7f, 0xdf, 0x20, 0x7f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xb8, 0x00, 0x3f, 0xcf, 0x00, 0x3f, 0xcf, 0xab, 0xff, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xc4, 0x7f, 0xdf, 0x14, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xdf, 0x00, 0x7f, 0xdf, 0x00, 0x7f, 0xdf, 0x00, 0x7f, 0xdf, 0x00, 0xff, 0xf7, 0x0c, 0x1f, 0xbf, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0x5f, 0xcf, 0x8f, 0x7f, 0xd7, 0x00, 0x7f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xdf, 0x00, 0x5f, 0xd7, 0x00, 0x9f, 0xe7, 0x14, 0x7f, 0xd7, 0x70, 0x7f, 0xd7, 0xc0, 0x5f, 0xd7, 0xf7, 0x5f, 0xcf, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x1f, 0xc7, 0xff, 0x7f, 0xdf, 0x37, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xdf, 0x00, 0x9f, 0xdf, 0x00, 0x7f, 0xdf, 0x64, 0x3f, 0xcf, 0xe4, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xa8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xdf, 0x00, 0xdf, 0x8e, 0x00, 0x7f, 0xdf, 0x78, 0x3f, 0xc7, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0x1f, 0xbf, 0xe7, 0x9f, 0xdf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdf, 0x00, 0x7f, 0xdf, 0x4b, 0x1f, 0xc7, 0xf7, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xf4, 0x3f, 0xcf, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xe7, 0x00, 0xde, 0xae, 0x00, 0x5f, 0xcf, 0xcc, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0xdf, 0xb6, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xdf, 0x00, 0x9f, 0xdf, 0x48, 0x3f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0xff, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xc7, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xcf, 0x00, 0x5f, 0xd7, 0x8f, 0x1f, 0xbf, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0xdf, 0xb6, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xbf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xc7, 0xff, 0x3f, 0xcf, 0x3b, 0xdf, 0xdc, 0x00, 0x5f, 0xd7, 0x00, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xcf, 0x00, 0x3f, 0xcf, 0xbf, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xeb, 0x7f, 0xd7, 0x97, 0x7f, 0xdf, 0x14, 0x7f, 0xd7, 0x00, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 0x00, 0x3e, 0xc7, 0xbf, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x5f, 0xcf, 0xff, 0xff, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xe0, 0x7f, 0xd7, 0x40, 0x1f, 0xbf, 0x00, 0x5f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x8f, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xec, 0x5f, 0xd7, 0x3c, 0x5f, 0xdf, 0x00, 0x5f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd7, 0x00, 0x7f, 0xd7, 0x48, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xc7, 0xdc, 0x9f, 0xe7, 0x0b, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xd7, 0x00, 0xdd, 0xae, 0x00, 0x5e, 0xcf, 0xcc, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x7f, 0xd7, 0xff, 0x5f, 0xcf, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0x5f, 0xd7, 0x88, 0xdf, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd7, 0x00, 0x5e, 0xd7, 0x4b, 0x5e, 0xcf, 0xf7, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5f, 0xd7, 0xff, 0x1f, 0xbf, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0x1f, 0xc7, 0xe0, 0x7f, 0xdf, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xd7, 0x00, 0x7e, 0xc7, 0x00, 0x5e, 0xcf, 0x78, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xf4, 0x5f, 0xcf, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x64, 0x5e, 0xcf, 0xe4, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5f, 0xd7, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x00, 0x3f, 0xbf, 0x00, 0x5e, 0xcf, 0x14, 0x7e, 0xcf, 0x70, 0x5e, 0xcf, 0xc0, 0x5e, 0xcf, 0xf7, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5f, 0xcf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd7, 0x00, 0x7e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x3f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xff, 0x1f, 0xc7, 0xf8, 0x3f, 0xc7, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 0x00, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xeb, 0x5f, 0xcf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc7, 0x00, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xcf, 0xb3, 0x9f, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0xcb, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x3e, 0xc7, 0xff, 0x5f, 0xd7, 0x30, 0x5e, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd7, 0x00, 0x5e, 0xcf, 0x53, 0x5e, 0xcf, 0xfc, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0x77, 0x5e, 0xcf, 0x00, 0x7f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x5f, 0xdf, 0x07, 0x5e, 0xcf, 0xa8, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0x88, 0x9e, 0xd7, 0x07, 0xfd, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xdf, 0x00, 0x7d, 0xb7, 0x00, 0x5e, 0xcf, 0x97, 0x5e, 0xcf, 0xf3, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xff, 0x5e, 0xcf, 0xfc, 0x5e, 0xcf, 0xdc, 0x5e, 0xcf, 0x5b, 0xdc, 0xbe, 0x00, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xd7, 0x00, 0x3f, 0xd7, 0x00, 0x9f, 0xf7, 0x00, 0x5e, 0xcf, 0x3f, 0x5e, 0xcf, 0xa4, 0x5e, 0xcf, 0xe4, 0x5e, 0xcf, 0xfc, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xfb, 0x5e, 0xcf, 0xe8, 0x7e, 0xcf, 0xb7, 0x5e, 0xcf, 0x64, 0x7f, 0xd7, 0x13, 0x5e, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x2c, 0xbf, 0xae, 0x08, 0xdf, 0xae, 0x1c, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x24, 0xdf, 0xae, 0x00, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xa6, 0x00, 0x5e, 0xd7, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x5e, 0xcf, 0x00, 0x7e, 0xcf, 0x00, 0x7e, 0xcf, 0x00, 0xff, 0xe7, 0x00, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xbf, 0x00, 0xbf, 0xae, 0xa8, 0xdf, 0xae, 0xd3, 0xdf, 0xae, 0x50, 0xdf, 0xae, 0xf7, 0xdf, 0xae, 0xa7, 0x1e, 0xbe, 0x00, 0x1f, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x43, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0x0c, 0xdf, 0xae, 0xd3, 0xdf, 0xae, 0xd8, 0xbf, 0xae, 0x7c, 0xfc, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x13, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x88, 0xbf, 0xae, 0x1c, 0xdf, 0xae, 0x34, 0xdf, 0xae, 0xd3, 0xbf, 0xae, 0x7c, 0xdd, 0xb6, 0x00, 0xdf, 0xae, 0xcb, 0xdf, 0xb6, 0x00, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xae, 0x00, 0x3f, 0x94, 0x00, 0xbf, 0xae, 0xdb, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0x6c, 0x5f, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x94, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xe8, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x98, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xb6, 0x03, 0xdf, 0xae, 0xab, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0xcb, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x8f, 0xbf, 0xb6, 0x00, 0xdf, 0xae, 0x78, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0xc7, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0xa0, 0xdf, 0xae, 0x08, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x07, 0xdf, 0xae, 0xc0, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xb3, 0xdf, 0xae, 0xc3, 0xbf, 0xae, 0x14, 0xdf, 0xae, 0x44, 0xbf, 0xae, 0x4f, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0xfb, 0xdf, 0xae, 0xf0, 0xff, 0xae, 0x08, 0xdf, 0xae, 0xdc, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x5b, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xc3, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0x94, 0xdf, 0xae, 0x97, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdf, 0xdf, 0xae, 0xec, 0xdf, 0xae, 0xef, 0xbf, 0xae, 0x5c, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xd4, 0xbf, 0xae, 0x6c, 0xdf, 0xae, 0x80, 0xdf, 0xae, 0xaf, 0xdf, 0xae, 0xbf, 0xbf, 0xae, 0x00, 0x5f, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x97, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xe0, 0xbf, 0xb6, 0x13, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x7b, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0x77, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x63, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x7b, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0x77, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x63, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x97, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xe0, 0xbf, 0xb6, 0x13, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdf, 0xdf, 0xae, 0xec, 0xdf, 0xae, 0xef, 0xbf, 0xae, 0x5c, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xb6, 0x00, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xc3, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0x97, 0xdf, 0xae, 0x97, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xab, 0xbf, 0xae, 0x28, 0xdf, 0xae, 0x6f, 0xbf, 0xae, 0x64, 0xdf, 0xae, 0x93, 0xdf, 0xae, 0x00, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x07, 0xdf, 0xae, 0xc0, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xb3, 0xdf, 0xae, 0xc3, 0xbf, 0xae, 0x14, 0xdf, 0xae, 0x44, 0xbf, 0xae, 0x4f, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xff, 0xb6, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x0b, 0xbf, 0xae, 0xb7, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x28, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xbf, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb6, 0x03, 0xdf, 0xae, 0xab, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0xcb, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x7b, 0xdf, 0xae, 0x38, 0xdf, 0xae, 0xaf, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0xe3, 0xdf, 0xae, 0x33, 0xbf, 0xae, 0x84, 0xdf, 0xae, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0x1f, 0xa7, 0x03, 0xbf, 0xae, 0xdb, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0x6c, 0x5f, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xa8, 0xdf, 0xae, 0x6b, 0xdf, 0xae, 0x58, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x88, 0xdf, 0xae, 0x4f, 0xdf, 0xae, 0xeb, 0xbf, 0xae, 0x28, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xae, 0x00, 0xff, 0xae, 0x00, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x14, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xa8, 0xdf, 0xae, 0x6b, 0xdf, 0xae, 0x58, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x88, 0xdf, 0xae, 0x4f, 0xdf, 0xae, 0xeb, 0xbf, 0xae, 0x28, 0xbf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xbf, 0xae, 0x78, 0xdf, 0xae, 0x38, 0xdf, 0xae, 0xaf, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0xe3, 0xdf, 0xae, 0x33, 0xbf, 0xae, 0x84, 0xdf, 0xae, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x0b, 0xbf, 0xae, 0xb7, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x28, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xbf, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0xab, 0xbf, 0xae, 0x28, 0xdf, 0xae, 0x6f, 0xbf, 0xae, 0x64, 0xdf, 0xae, 0x93, 0xdf, 0xae, 0x00, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xbf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0xdf, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x02, 0x5f, 0xdf, 0x0c, 0x7f, 0xd7, 0x1c, 0x7f, 0xd7, 0x28, 0x81, 0x7f, 
+  0xd7, 0x33, 0x02, 0x7f, 0xd7, 0x28, 0x7f, 0xd7, 0x1c, 0x5f, 0xdf, 0x0c, 0xb5, 0x00, 0x00, 0x00, 0x04, 0x7f, 0xd7, 0x20, 0x5f, 0xd7, 0x84, 0x3f, 0xcf, 0xe0, 0x1f, 0xbf, 0xef, 0xff, 0xbe, 0xfb, 
+  0x81, 0xdf, 0xb6, 0xff, 0x04, 0xff, 0xbe, 0xfb, 0x1f, 0xbf, 0xef, 0x3f, 0xcf, 0xe0, 0x5f, 0xd7, 0x84, 0x7f, 0xd7, 0x20, 0xb1, 0x00, 0x00, 0x00, 0x03, 0x7f, 0xd7, 0x13, 0x5f, 0xcf, 0x83, 0x1f, 
+  0xc7, 0xf3, 0xdf, 0xb6, 0xff, 0x87, 0xbf, 0xae, 0xff, 0x03, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xf3, 0x5f, 0xcf, 0x83, 0x7f, 0xd7, 0x13, 0xae, 0x00, 0x00, 0x00, 0x02, 0x9f, 0xdf, 0x2f, 0x3f, 0xcf, 
+  0xcc, 0xdf, 0xb6, 0xff, 0x8b, 0xbf, 0xae, 0xff, 0x02, 0xdf, 0xb6, 0xff, 0x3f, 0xcf, 0xcc, 0x9f, 0xdf, 0x2f, 0xac, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xd7, 0x2b, 0x1f, 0xc7, 0xe7, 0x8f, 0xdf, 0xae, 
+  0xff, 0x07, 0x1f, 0xc7, 0xe7, 0x7f, 0xd7, 0x33, 0x7f, 0xd7, 0x1c, 0x7f, 0xdf, 0x2b, 0x7f, 0xdf, 0x33, 0x7f, 0xdf, 0x2f, 0x7f, 0xdf, 0x23, 0x7f, 0xdf, 0x13, 0xa4, 0x00, 0x00, 0x00, 0x02, 0x7f, 
+  0xdf, 0x1c, 0x3f, 0xc7, 0xd7, 0xdf, 0xb6, 0xff, 0x8f, 0xdf, 0xae, 0xff, 0x03, 0xdf, 0xb6, 0xff, 0x1f, 0xbf, 0xf3, 0x1f, 0xc7, 0xef, 0xff, 0xbe, 0xfc, 0x81, 0xff, 0xbe, 0xff, 0x03, 0x1f, 0xbf, 
+  0xf4, 0x3f, 0xcf, 0xe7, 0x5f, 0xd7, 0xa8, 0x7f, 0xd7, 0x37, 0xa1, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xe7, 0x04, 0x5f, 0xcf, 0xa4, 0x92, 0xdf, 0xb6, 0xff, 0x81, 0xdf, 0xae, 0xff, 0x82, 0xdf, 0xb6, 
+  0xff, 0x81, 0xdf, 0xae, 0xff, 0x03, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xff, 0x5f, 0xd7, 0x8f, 0x7f, 0xd7, 0x14, 0x9f, 0x00, 0x00, 0x00, 0x01, 0x5f, 0xcf, 0x3c, 0xff, 0xbe, 0xf7, 0x9b, 0xdf, 0xb6, 
+  0xff, 0x02, 0xff, 0xbe, 0xff, 0x3f, 0xcf, 0xc4, 0x7f, 0xdf, 0x20, 0x9e, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xcf, 0xab, 0xff, 0xb6, 0xff, 0x9c, 0xdf, 0xb6, 0xff, 0x02, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 
+  0xc4, 0x7f, 0xdf, 0x14, 0x9c, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf7, 0x0c, 0x1f, 0xbf, 0xff, 0x9e, 0xff, 0xb6, 0xff, 0x01, 0xff, 0xbe, 0xff, 0x5f, 0xcf, 0x8f, 0x98, 0x00, 0x00, 0x00, 0x04, 0x9f, 
+  0xe7, 0x14, 0x7f, 0xd7, 0x70, 0x7f, 0xd7, 0xc0, 0x5f, 0xd7, 0xf7, 0x5f, 0xcf, 0xff, 0xa0, 0xff, 0xb6, 0xff, 0x01, 0x1f, 0xc7, 0xff, 0x7f, 0xdf, 0x37, 0x96, 0x00, 0x00, 0x00, 0x02, 0x7f, 0xdf, 
+  0x64, 0x3f, 0xcf, 0xe4, 0x1f, 0xbf, 0xff, 0x81, 0xff, 0xbe, 0xff, 0x00, 0xff, 0xb6, 0xff, 0xa0, 0xff, 0xbe, 0xff, 0x01, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xa8, 0x95, 0x00, 0x00, 0x00, 0x01, 0x7f, 
+  0xdf, 0x78, 0x3f, 0xc7, 0xff, 0xa6, 0xff, 0xbe, 0xff, 0x01, 0x1f, 0xbf, 0xe7, 0x9f, 0xdf, 0x13, 0x93, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xdf, 0x4b, 0x1f, 0xc7, 0xf7, 0x98, 0x1f, 0xbf, 0xff, 0x01, 
+  0x1f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0x82, 0x5f, 0xcf, 0xff, 0x01, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0x87, 0x1f, 0xbf, 0xff, 0x01, 0x1f, 0xbf, 0xf4, 0x3f, 0xcf, 0x23, 0x93, 0x00, 0x00, 0x00, 
+  0x00, 0x5f, 0xcf, 0xcc, 0x97, 0x1f, 0xbf, 0xff, 0x03, 0x3f, 0xc7, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0xdf, 0xb6, 0xff, 0x82, 0xbf, 0xae, 0xff, 0x03, 0xdf, 0xb6, 0xff, 0x1f, 0xc7, 0xff, 
+  0x3f, 0xcf, 0xff, 0x3f, 0xc7, 0xff, 0x86, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xc7, 0x2f, 0x92, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xdf, 0x48, 0x3f, 0xc7, 0xff, 0x95, 0x1f, 0xbf, 0xff, 0x03, 0x3f, 0xc7, 
+  0xff, 0x3f, 0xcf, 0xff, 0xff, 0xb6, 0xff, 0xdf, 0xae, 0xff, 0x86, 0xbf, 0xae, 0xff, 0x03, 0xdf, 0xae, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0x84, 0x1f, 0xbf, 0xff, 0x00, 
+  0x1f, 0xc7, 0x33, 0x92, 0x00, 0x00, 0x00, 0x01, 0x5f, 0xd7, 0x8f, 0x1f, 0xbf, 0xff, 0x94, 0x1f, 0xc7, 0xff, 0x81, 0x3f, 0xc7, 0xff, 0x00, 0xdf, 0xb6, 0xff, 0x8a, 0xbf, 0xae, 0xff, 0x00, 0xdf, 
+  0xb6, 0xff, 0x85, 0x3f, 0xc7, 0xff, 0x00, 0x3f, 0xcf, 0x3b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xcf, 0xbf, 0x95, 0x3e, 0xc7, 0xff, 0x01, 0x3f, 0xcf, 0xff, 0xdf, 0xb6, 0xff, 0x8c, 0xdf, 0xae, 
+  0xff, 0x02, 0xdf, 0xb6, 0xff, 0x1f, 0xbf, 0xff, 0xff, 0xbe, 0xff, 0x81, 0xff, 0xb6, 0xff, 0x03, 0x1f, 0xbf, 0xff, 0x3f, 0xc7, 0xeb, 0x7f, 0xd7, 0x97, 0x7f, 0xdf, 0x14, 0x90, 0x00, 0x00, 0x00, 
+  0x00, 0x3e, 0xc7, 0xbf, 0x94, 0x3e, 0xc7, 0xff, 0x01, 0x5f, 0xcf, 0xff, 0xff, 0xb6, 0xff, 0x93, 0xdf, 0xb6, 0xff, 0x03, 0xdf, 0xae, 0xff, 0xff, 0xb6, 0xff, 0x3f, 0xcf, 0xe0, 0x7f, 0xd7, 0x40, 
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x8f, 0x94, 0x3e, 0xc7, 0xff, 0x00, 0x1f, 0xc7, 0xff, 0x97, 0xdf, 0xb6, 0xff, 0x01, 0x1f, 0xc7, 0xec, 0x5f, 0xd7, 0x3c, 0x8e, 0x00, 0x00, 0x00, 0x00, 
+  0x7f, 0xd7, 0x48, 0x91, 0x3e, 0xc7, 0xff, 0x81, 0x5e, 0xcf, 0xff, 0x00, 0x5f, 0xcf, 0xff, 0x99, 0xff, 0xb6, 0xff, 0x01, 0x3f, 0xc7, 0xdc, 0x9f, 0xe7, 0x0b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x5e, 
+  0xcf, 0xcc, 0x8f, 0x5e, 0xcf, 0xff, 0x03, 0x7f, 0xd7, 0xff, 0x5f, 0xcf, 0xff, 0x3f, 0xcf, 0xff, 0x1f, 0xc7, 0xff, 0x9a, 0xff, 0xb6, 0xff, 0x00, 0x5f, 0xd7, 0x88, 0x8e, 0x00, 0x00, 0x00, 0x01, 
+  0x5e, 0xd7, 0x4b, 0x5e, 0xcf, 0xf7, 0x8d, 0x5e, 0xcf, 0xff, 0x01, 0x5f, 0xd7, 0xff, 0x1f, 0xbf, 0xff, 0x81, 0xff, 0xb6, 0xff, 0x9b, 0xff, 0xbe, 0xff, 0x01, 0x1f, 0xc7, 0xe0, 0x7f, 0xdf, 0x0f, 
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0x78, 0x8c, 0x5e, 0xcf, 0xff, 0x00, 0x5f, 0xcf, 0xff, 0x9f, 0x1f, 0xbf, 0xff, 0x01, 0x1f, 0xbf, 0xf4, 0x5f, 0xcf, 0x23, 0x8f, 0x00, 0x00, 0x00, 0x01, 
+  0x5e, 0xcf, 0x64, 0x5e, 0xcf, 0xe4, 0x89, 0x5e, 0xcf, 0xff, 0x00, 0x5f, 0xd7, 0xff, 0xa1, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xc7, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x03, 0x5e, 0xcf, 0x14, 0x7e, 0xcf, 
+  0x70, 0x5e, 0xcf, 0xc0, 0x5e, 0xcf, 0xf7, 0x86, 0x5e, 0xcf, 0xff, 0x00, 0x5f, 0xcf, 0xff, 0xa1, 0x1f, 0xbf, 0xff, 0x00, 0x3f, 0xc7, 0x30, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc7, 0xff, 0xa0, 
+  0x1f, 0xc7, 0xff, 0x01, 0x1f, 0xc7, 0xf8, 0x3f, 0xc7, 0x27, 0x9b, 0x00, 0x00, 0x00, 0xa1, 0x3e, 0xc7, 0xff, 0x01, 0x3e, 0xc7, 0xeb, 0x5f, 0xcf, 0x17, 0x9b, 0x00, 0x00, 0x00, 0xa1, 0x3e, 0xc7, 
+  0xff, 0x01, 0x3e, 0xcf, 0xb3, 0x9f, 0xff, 0x03, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcf, 0xcb, 0xa0, 0x3e, 0xc7, 0xff, 0x00, 0x5f, 0xd7, 0x30, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x5e, 0xcf, 0x53, 
+  0x5e, 0xcf, 0xfc, 0x9e, 0x5e, 0xcf, 0xff, 0x00, 0x5e, 0xcf, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x5f, 0xdf, 0x07, 0x5e, 0xcf, 0xa8, 0x9d, 0x5e, 0xcf, 0xff, 0x01, 0x5e, 0xcf, 0x88, 0x9e, 0xd7, 
+  0x07, 0x9f, 0x00, 0x00, 0x00, 0x01, 0x5e, 0xcf, 0x97, 0x5e, 0xcf, 0xf3, 0x98, 0x5e, 0xcf, 0xff, 0x02, 0x5e, 0xcf, 0xfc, 0x5e, 0xcf, 0xdc, 0x5e, 0xcf, 0x5b, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x5e, 
+  0xcf, 0x3f, 0x5e, 0xcf, 0xa4, 0x5e, 0xcf, 0xe4, 0x5e, 0xcf, 0xfc, 0x93, 0x5e, 0xcf, 0xfb, 0x03, 0x5e, 0xcf, 0xe8, 0x7e, 0xcf, 0xb7, 0x5e, 0xcf, 0x64, 0x7f, 0xd7, 0x13, 0x95, 0x00, 0x00, 0x00, 
+  0x04, 0xdf, 0xae, 0x2c, 0xbf, 0xae, 0x08, 0xdf, 0xae, 0x1c, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x24, 0xba, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xae, 0xa8, 0xdf, 0xae, 0xd3, 0xdf, 0xae, 0x50, 0xdf, 0xae, 
+  0xf7, 0xdf, 0xae, 0xa7, 0xb9, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 0x43, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0x0c, 0xdf, 0xae, 0xd3, 0xdf, 0xae, 0xd8, 0xbf, 0xae, 0x7c, 0x90, 0x00, 
+  0x00, 0x00, 0x04, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x13, 0xdf, 0xae, 0x20, 0xa2, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 0x88, 0xbf, 0xae, 0x1c, 0xdf, 0xae, 0x34, 
+  0xdf, 0xae, 0xd3, 0xbf, 0xae, 0x7c, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xcb, 0x90, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xae, 0xdb, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0x6c, 
+  0xa1, 0x00, 0x00, 0x00, 0x08, 0xdf, 0xae, 0x94, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xe8, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x98, 
+  0x8d, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xb6, 0x03, 0xdf, 0xae, 0xab, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0xcb, 0xdf, 0xae, 0x2c, 0xa1, 0x00, 0x00, 
+  0x00, 0x07, 0xdf, 0xae, 0x8f, 0x00, 0x00, 0x00, 0xdf, 0xae, 0x78, 0xdf, 0xae, 0x73, 0xdf, 0xae, 0xc7, 0x00, 0x00, 0x00, 0xbf, 0xae, 0xa0, 0xdf, 0xae, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x07, 0xdf, 
+  0xae, 0x07, 0xdf, 0xae, 0xc0, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xb3, 0xdf, 0xae, 0xc3, 0xbf, 0xae, 0x14, 0xdf, 0xae, 0x44, 0xbf, 0xae, 0x4f, 0xa1, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 0x1f, 0xdf, 
+  0xae, 0xfb, 0xdf, 0xae, 0xf0, 0xff, 0xae, 0x08, 0xdf, 0xae, 0xdc, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x5b, 0x86, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xc3, 0xdf, 0xae, 0x73, 0xdf, 
+  0xae, 0x94, 0xdf, 0xae, 0x97, 0x82, 0x00, 0x00, 0x00, 0x08, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdf, 0xdf, 0xae, 0xec, 0xdf, 
+  0xae, 0xef, 0xbf, 0xae, 0x5c, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xae, 0xd4, 0xbf, 0xae, 0x6c, 0xdf, 0xae, 0x80, 0xdf, 0xae, 0xaf, 0xdf, 0xae, 0xbf, 0x86, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 
+  0x97, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xe0, 0xbf, 0xb6, 0x13, 0x81, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x7b, 0x00, 0x00, 
+  0x00, 0xdf, 0xae, 0xd0, 0xdf, 0xae, 0x77, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x63, 0xad, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 0x18, 0xdf, 0xae, 0x7b, 0x00, 0x00, 0x00, 0xdf, 0xae, 
+  0xd0, 0xdf, 0xae, 0x77, 0xbf, 0xae, 0x43, 0xbf, 0xae, 0x18, 0xdf, 0xae, 0x63, 0x82, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 0x97, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x9c, 0xdf, 0xae, 0x1f, 0xdf, 0xae, 
+  0xff, 0xdf, 0xae, 0xe0, 0xbf, 0xb6, 0x13, 0xad, 0x00, 0x00, 0x00, 0x08, 0xdf, 0xae, 0xd4, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdb, 0xdf, 0xae, 0xf3, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xdf, 0xdf, 0xae, 
+  0xec, 0xdf, 0xae, 0xef, 0xbf, 0xae, 0x5c, 0x82, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0xc3, 0xdf, 0xae, 0x73, 0x81, 0xdf, 0xae, 0x97, 0x85, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xae, 
+  0xab, 0xbf, 0xae, 0x28, 0xdf, 0xae, 0x6f, 0xbf, 0xae, 0x64, 0xdf, 0xae, 0x93, 0xa3, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 0x07, 0xdf, 0xae, 0xc0, 0x00, 0x00, 0x00, 0xdf, 0xae, 0xb3, 0xdf, 0xae, 
+  0xc3, 0xbf, 0xae, 0x14, 0xdf, 0xae, 0x44, 0xbf, 0xae, 0x4f, 0x8d, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xae, 0x0b, 0xbf, 0xae, 0xb7, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x28, 0xdf, 0xae, 0xff, 0xdf, 0xae, 
+  0xbf, 0xdf, 0xae, 0x1f, 0xa2, 0x00, 0x00, 0x00, 0x07, 0x9f, 0xb6, 0x03, 0xdf, 0xae, 0xab, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0x98, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xd7, 0xdf, 0xae, 0xcb, 0xdf, 0xae, 
+  0x2c, 0x8d, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xae, 0x7b, 0xdf, 0xae, 0x38, 0xdf, 0xae, 0xaf, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0xe3, 0xdf, 0xae, 0x33, 0xbf, 0xae, 0x84, 0xdf, 0xae, 0x0b, 0xa2, 0x00, 
+  0x00, 0x00, 0x05, 0x1f, 0xa7, 0x03, 0xbf, 0xae, 0xdb, 0xdf, 0xae, 0xe0, 0xdf, 0xae, 0x54, 0xdf, 0xae, 0xe7, 0xdf, 0xae, 0x6c, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xa8, 
+  0xdf, 0xae, 0x6b, 0xdf, 0xae, 0x58, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x88, 0xdf, 0xae, 0x4f, 0xdf, 0xae, 0xeb, 0xbf, 0xae, 0x28, 0xa3, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xae, 0x2c, 0xdf, 0xae, 0x20, 
+  0xdf, 0xae, 0x18, 0xdf, 0xae, 0x14, 0xdf, 0xae, 0x20, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xdf, 0xae, 0x20, 0xdf, 0xae, 0xa8, 0xdf, 0xae, 0x6b, 0xdf, 0xae, 0x58, 0xdf, 0xae, 0xff, 0xbf, 0xae, 0x88, 
+  0xdf, 0xae, 0x4f, 0xdf, 0xae, 0xeb, 0xbf, 0xae, 0x28, 0xb7, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xae, 0x78, 0xdf, 0xae, 0x38, 0xdf, 0xae, 0xaf, 0xdf, 0xae, 0x30, 0xdf, 0xae, 0xe3, 0xdf, 0xae, 0x33, 
+  0xbf, 0xae, 0x84, 0xdf, 0xae, 0x0b, 0xb7, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xae, 0x0b, 0xbf, 0xae, 0xb7, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0x28, 0xdf, 0xae, 0xff, 0xdf, 0xae, 0xbf, 0xdf, 0xae, 0x1f, 
+  0xb9, 0x00, 0x00, 0x00, 0x04, 0xdf, 0xae, 0xab, 0xbf, 0xae, 0x28, 0xdf, 0xae, 0x6f, 0xbf, 0xae, 0x64, 0xdf, 0xae, 0x93, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xcd, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7f, 0x00, 0xd7, 0x5f, 0x00, 0xcf, 0x7f, 0x00, 0xdf, 0x5f, 0x0c, 0xd7, 0x7f, 0x1c, 0xd7, 0x7f, 0x28, 0xd7, 0x7f, 0x33, 0xd7, 0x7f, 0x33, 0xd7, 0x7f, 0x28, 0xd7, 0x7f, 0x1c, 0xdf, 0x5f, 0x0c, 0xcf, 0x7f, 0x00, 0xd7, 0x5f, 0x00, 0xcf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7f, 0x00, 0xd7, 0x5f, 0x00, 0xd7, 0x7f, 0x20, 0xd7, 0x5f, 0x84, 0xcf, 0x3f, 0xe0, 0xbf, 0x1f, 0xef, 0xbe, 0xff, 0xfb, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xbe, 0xff, 0xfb, 0xbf, 0x1f, 0xef, 0xcf, 0x3f, 0xe0, 0xd7, 0x5f, 0x84, 0xd7, 0x7f, 0x20, 0xd7, 0x5f, 0x00, 0xcf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x13, 0xcf, 0x5f, 0x83, 0xc7, 0x1f, 0xf3, 0xb6, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xf3, 0xcf, 0x5f, 0x83, 0xd7, 0x7f, 0x13, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xdf, 0x9f, 0x2f, 0xcf, 0x3f, 0xcc, 0xb6, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xb6, 0xdf, 0xff, 0xcf, 0x3f, 0xcc, 0xdf, 0x9f, 0x2f, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5f, 0x00, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x2b, 0xc7, 0x1f, 0xe7, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xc7, 0x1f, 0xe7, 0xd7, 0x7f, 0x33, 0xd7, 0x7f, 0x1c, 0xdf, 0x7f, 0x2b, 0xdf, 0x7f, 0x33, 0xdf, 0x7f, 0x2f, 0xdf, 0x7f, 0x23, 0xdf, 0x7f, 0x13, 0xd7, 0x9f, 0x00, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5f, 0x00, 0xdf, 0x7f, 0x1c, 0xc7, 0x3f, 0xd7, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xbf, 0x1f, 0xf3, 0xc7, 0x1f, 0xef, 0xbe, 0xff, 0xfc, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbf, 0x1f, 0xf4, 0xcf, 0x3f, 0xe7, 0xd7, 0x5f, 0xa8, 0xd7, 0x7f, 0x37, 0xd7, 0x7f, 0x00, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xe7, 0x9f, 0x04, 0xcf, 0x5f, 0xa4, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xff, 0xd7, 0x5f, 0x8f, 0xd7, 0x7f, 0x14, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xcf, 0x5f, 0x3c, 0xbe, 0xff, 0xf7, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xc4, 0xdf, 0x7f, 0x20, 0xdf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x18, 0x00, 0xcf, 0x3f, 0x00, 0xcf, 0x3f, 0xab, 0xb6, 0xff, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xc4, 0xdf, 0x7f, 0x14, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x7f, 0x00, 0xf7, 0xff, 0x0c, 0xbf, 0x1f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xcf, 0x5f, 0x8f, 0xd7, 0x7f, 0x00, 0xdf, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7f, 0x00, 0xd7, 0x5f, 0x00, 0xe7, 0x9f, 0x14, 0xd7, 0x7f, 0x70, 0xd7, 0x7f, 0xc0, 0xd7, 0x5f, 0xf7, 0xcf, 0x5f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xc7, 0x1f, 0xff, 0xdf, 0x7f, 0x37, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7f, 0x00, 0xdf, 0x9f, 0x00, 0xdf, 0x7f, 0x64, 0xcf, 0x3f, 0xe4, 0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xa8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7f, 0x00, 0x8e, 0xdf, 0x00, 0xdf, 0x7f, 0x78, 0xc7, 0x3f, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbf, 0x1f, 0xe7, 0xdf, 0x9f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0xdf, 0x7f, 0x4b, 0xc7, 0x1f, 0xf7, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xcf, 0x3f, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xf4, 0xcf, 0x3f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x9f, 0x00, 0xae, 0xde, 0x00, 0xcf, 0x5f, 0xcc, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0xdf, 0x9f, 0x48, 0xc7, 0x3f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xcf, 0x3f, 0xff, 0xb6, 0xff, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x1f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5f, 0x00, 0xd7, 0x5f, 0x8f, 0xbf, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xae, 0xbf, 0xff, 0xb6, 0xdf, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0xcf, 0x3f, 0x3b, 0xdc, 0xdf, 0x00, 0xd7, 0x5f, 0x00, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x3f, 0x00, 0xcf, 0x3f, 0xbf, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xcf, 0x3f, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xeb, 0xd7, 0x7f, 0x97, 0xdf, 0x7f, 0x14, 0xd7, 0x7f, 0x00, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x00, 0xc7, 0x3e, 0xbf, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xcf, 0x5f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xae, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xe0, 0xd7, 0x7f, 0x40, 0xbf, 0x1f, 0x00, 0xdf, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x8f, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x1f, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xec, 0xd7, 0x5f, 0x3c, 0xdf, 0x5f, 0x00, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7e, 0x00, 0xd7, 0x7f, 0x48, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xc7, 0x3f, 0xdc, 0xe7, 0x9f, 0x0b, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7f, 0x00, 0xae, 0xdd, 0x00, 0xcf, 0x5e, 0xcc, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x7f, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xd7, 0x5f, 0x88, 0xc6, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7e, 0x00, 0xd7, 0x5e, 0x4b, 0xcf, 0x5e, 0xf7, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x5f, 0xff, 0xbf, 0x1f, 0xff, 0xb6, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xc7, 0x1f, 0xe0, 0xdf, 0x7f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5e, 0x00, 0xc7, 0x7e, 0x00, 0xcf, 0x5e, 0x78, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xf4, 0xcf, 0x5f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x64, 0xcf, 0x5e, 0xe4, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xd7, 0x5f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x00, 0xbf, 0x3f, 0x00, 0xcf, 0x5e, 0x14, 0xcf, 0x7e, 0x70, 0xcf, 0x5e, 0xc0, 0xcf, 0x5e, 0xf7, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7e, 0x00, 0xcf, 0x7e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xc7, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xff, 0xc7, 0x1f, 0xf8, 0xc7, 0x3f, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x00, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xeb, 0xcf, 0x5f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3e, 0x00, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xcf, 0x3e, 0xb3, 0xff, 0x9f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0xcb, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xc7, 0x3e, 0xff, 0xd7, 0x5f, 0x30, 0xcf, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x7e, 0x00, 0xcf, 0x5e, 0x53, 0xcf, 0x5e, 0xfc, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0x77, 0xcf, 0x5e, 0x00, 0xd7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0xdf, 0x5f, 0x07, 0xcf, 0x5e, 0xa8, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0x88, 0xd7, 0x9e, 0x07, 0xe7, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x5f, 0x00, 0xb7, 0x7d, 0x00, 0xcf, 0x5e, 0x97, 0xcf, 0x5e, 0xf3, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xff, 0xcf, 0x5e, 0xfc, 0xcf, 0x5e, 0xdc, 0xcf, 0x5e, 0x5b, 0xbe, 0xdc, 0x00, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x5e, 0x00, 0xd7, 0x3f, 0x00, 0xf7, 0x9f, 0x00, 0xcf, 0x5e, 0x3f, 0xcf, 0x5e, 0xa4, 0xcf, 0x5e, 0xe4, 0xcf, 0x5e, 0xfc, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xfb, 0xcf, 0x5e, 0xe8, 0xcf, 0x7e, 0xb7, 0xcf, 0x5e, 0x64, 0xd7, 0x7f, 0x13, 0xcf, 0x5e, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x2c, 0xae, 0xbf, 0x08, 0xae, 0xdf, 0x1c, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x24, 0xae, 0xdf, 0x00, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xdc, 0x00, 0xd7, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x5e, 0x00, 0xcf, 0x7e, 0x00, 0xcf, 0x7e, 0x00, 0xe7, 0xff, 0x00, 0xd7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x9c, 0x00, 0xae, 0xbf, 0xa8, 0xae, 0xdf, 0xd3, 0xae, 0xdf, 0x50, 0xae, 0xdf, 0xf7, 0xae, 0xdf, 0xa7, 0xbe, 0x1e, 0x00, 0xaf, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x43, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0x0c, 0xae, 0xdf, 0xd3, 0xae, 0xdf, 0xd8, 0xae, 0xbf, 0x7c, 0x77, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x13, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x88, 0xae, 0xbf, 0x1c, 0xae, 0xdf, 0x34, 0xae, 0xdf, 0xd3, 0xae, 0xbf, 0x7c, 0xb6, 0xdd, 0x00, 0xae, 0xdf, 0xcb, 0xb6, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x9f, 0x00, 0x94, 0x3f, 0x00, 0xae, 0xbf, 0xdb, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0x6c, 0xb6, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x94, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xe8, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x98, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xbf, 0x03, 0xae, 0xdf, 0xab, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0xcb, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x8f, 0xb6, 0xbf, 0x00, 0xae, 0xdf, 0x78, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0xc7, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0xa0, 0xae, 0xdf, 0x08, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xff, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x07, 0xae, 0xdf, 0xc0, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xb3, 0xae, 0xdf, 0xc3, 0xae, 0xbf, 0x14, 0xae, 0xdf, 0x44, 0xae, 0xbf, 0x4f, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0xfb, 0xae, 0xdf, 0xf0, 0xae, 0xff, 0x08, 0xae, 0xdf, 0xdc, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x5b, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xff, 0x00, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xc3, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0x94, 0xae, 0xdf, 0x97, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdf, 0xae, 0xdf, 0xec, 0xae, 0xdf, 0xef, 0xae, 0xbf, 0x5c, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xd4, 0xae, 0xbf, 0x6c, 0xae, 0xdf, 0x80, 0xae, 0xdf, 0xaf, 0xae, 0xdf, 0xbf, 0xae, 0xbf, 0x00, 0xa7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x97, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xe0, 0xb6, 0xbf, 0x13, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x7b, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0x77, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x63, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x7b, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0x77, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x63, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x97, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xe0, 0xb6, 0xbf, 0x13, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdf, 0xae, 0xdf, 0xec, 0xae, 0xdf, 0xef, 0xae, 0xbf, 0x5c, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xdf, 0x00, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xc3, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0x97, 0xae, 0xdf, 0x97, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xab, 0xae, 0xbf, 0x28, 0xae, 0xdf, 0x6f, 0xae, 0xbf, 0x64, 0xae, 0xdf, 0x93, 0xae, 0xdf, 0x00, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x07, 0xae, 0xdf, 0xc0, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xb3, 0xae, 0xdf, 0xc3, 0xae, 0xbf, 0x14, 0xae, 0xdf, 0x44, 0xae, 0xbf, 0x4f, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x00, 0xb6, 0xff, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x0b, 0xae, 0xbf, 0xb7, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x28, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xbf, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x9f, 0x03, 0xae, 0xdf, 0xab, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0xcb, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x7b, 0xae, 0xdf, 0x38, 0xae, 0xdf, 0xaf, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0xe3, 0xae, 0xdf, 0x33, 0xae, 0xbf, 0x84, 0xae, 0xdf, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xa7, 0x1f, 0x03, 0xae, 0xbf, 0xdb, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0x6c, 0xb6, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xa8, 0xae, 0xdf, 0x6b, 0xae, 0xdf, 0x58, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x88, 0xae, 0xdf, 0x4f, 0xae, 0xdf, 0xeb, 0xae, 0xbf, 0x28, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x9f, 0x00, 0xae, 0xff, 0x00, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x14, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xa8, 0xae, 0xdf, 0x6b, 0xae, 0xdf, 0x58, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x88, 0xae, 0xdf, 0x4f, 0xae, 0xdf, 0xeb, 0xae, 0xbf, 0x28, 0xae, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xbf, 0x78, 0xae, 0xdf, 0x38, 0xae, 0xdf, 0xaf, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0xe3, 0xae, 0xdf, 0x33, 0xae, 0xbf, 0x84, 0xae, 0xdf, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x0b, 0xae, 0xbf, 0xb7, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x28, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xbf, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0xab, 0xae, 0xbf, 0x28, 0xae, 0xdf, 0x6f, 0xae, 0xbf, 0x64, 0xae, 0xdf, 0x93, 0xae, 0xdf, 0x00, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xbf, 0x00, 0xae, 0xdf, 0x00, 0xae, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x02, 0xdf, 0x5f, 0x0c, 0xd7, 0x7f, 0x1c, 0xd7, 0x7f, 0x28, 0x81, 0xd7, 
+  0x7f, 0x33, 0x02, 0xd7, 0x7f, 0x28, 0xd7, 0x7f, 0x1c, 0xdf, 0x5f, 0x0c, 0xb5, 0x00, 0x00, 0x00, 0x04, 0xd7, 0x7f, 0x20, 0xd7, 0x5f, 0x84, 0xcf, 0x3f, 0xe0, 0xbf, 0x1f, 0xef, 0xbe, 0xff, 0xfb, 
+  0x81, 0xb6, 0xdf, 0xff, 0x04, 0xbe, 0xff, 0xfb, 0xbf, 0x1f, 0xef, 0xcf, 0x3f, 0xe0, 0xd7, 0x5f, 0x84, 0xd7, 0x7f, 0x20, 0xb1, 0x00, 0x00, 0x00, 0x03, 0xd7, 0x7f, 0x13, 0xcf, 0x5f, 0x83, 0xc7, 
+  0x1f, 0xf3, 0xb6, 0xdf, 0xff, 0x87, 0xae, 0xbf, 0xff, 0x03, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xf3, 0xcf, 0x5f, 0x83, 0xd7, 0x7f, 0x13, 0xae, 0x00, 0x00, 0x00, 0x02, 0xdf, 0x9f, 0x2f, 0xcf, 0x3f, 
+  0xcc, 0xb6, 0xdf, 0xff, 0x8b, 0xae, 0xbf, 0xff, 0x02, 0xb6, 0xdf, 0xff, 0xcf, 0x3f, 0xcc, 0xdf, 0x9f, 0x2f, 0xac, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x7f, 0x2b, 0xc7, 0x1f, 0xe7, 0x8f, 0xae, 0xdf, 
+  0xff, 0x07, 0xc7, 0x1f, 0xe7, 0xd7, 0x7f, 0x33, 0xd7, 0x7f, 0x1c, 0xdf, 0x7f, 0x2b, 0xdf, 0x7f, 0x33, 0xdf, 0x7f, 0x2f, 0xdf, 0x7f, 0x23, 0xdf, 0x7f, 0x13, 0xa4, 0x00, 0x00, 0x00, 0x02, 0xdf, 
+  0x7f, 0x1c, 0xc7, 0x3f, 0xd7, 0xb6, 0xdf, 0xff, 0x8f, 0xae, 0xdf, 0xff, 0x03, 0xb6, 0xdf, 0xff, 0xbf, 0x1f, 0xf3, 0xc7, 0x1f, 0xef, 0xbe, 0xff, 0xfc, 0x81, 0xbe, 0xff, 0xff, 0x03, 0xbf, 0x1f, 
+  0xf4, 0xcf, 0x3f, 0xe7, 0xd7, 0x5f, 0xa8, 0xd7, 0x7f, 0x37, 0xa1, 0x00, 0x00, 0x00, 0x01, 0xe7, 0x9f, 0x04, 0xcf, 0x5f, 0xa4, 0x92, 0xb6, 0xdf, 0xff, 0x81, 0xae, 0xdf, 0xff, 0x82, 0xb6, 0xdf, 
+  0xff, 0x81, 0xae, 0xdf, 0xff, 0x03, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xff, 0xd7, 0x5f, 0x8f, 0xd7, 0x7f, 0x14, 0x9f, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x5f, 0x3c, 0xbe, 0xff, 0xf7, 0x9b, 0xb6, 0xdf, 
+  0xff, 0x02, 0xbe, 0xff, 0xff, 0xcf, 0x3f, 0xc4, 0xdf, 0x7f, 0x20, 0x9e, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x3f, 0xab, 0xb6, 0xff, 0xff, 0x9c, 0xb6, 0xdf, 0xff, 0x02, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 
+  0xc4, 0xdf, 0x7f, 0x14, 0x9c, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xff, 0x0c, 0xbf, 0x1f, 0xff, 0x9e, 0xb6, 0xff, 0xff, 0x01, 0xbe, 0xff, 0xff, 0xcf, 0x5f, 0x8f, 0x98, 0x00, 0x00, 0x00, 0x04, 0xe7, 
+  0x9f, 0x14, 0xd7, 0x7f, 0x70, 0xd7, 0x7f, 0xc0, 0xd7, 0x5f, 0xf7, 0xcf, 0x5f, 0xff, 0xa0, 0xb6, 0xff, 0xff, 0x01, 0xc7, 0x1f, 0xff, 0xdf, 0x7f, 0x37, 0x96, 0x00, 0x00, 0x00, 0x02, 0xdf, 0x7f, 
+  0x64, 0xcf, 0x3f, 0xe4, 0xbf, 0x1f, 0xff, 0x81, 0xbe, 0xff, 0xff, 0x00, 0xb6, 0xff, 0xff, 0xa0, 0xbe, 0xff, 0xff, 0x01, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xa8, 0x95, 0x00, 0x00, 0x00, 0x01, 0xdf, 
+  0x7f, 0x78, 0xc7, 0x3f, 0xff, 0xa6, 0xbe, 0xff, 0xff, 0x01, 0xbf, 0x1f, 0xe7, 0xdf, 0x9f, 0x13, 0x93, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x7f, 0x4b, 0xc7, 0x1f, 0xf7, 0x98, 0xbf, 0x1f, 0xff, 0x01, 
+  0xc7, 0x1f, 0xff, 0xcf, 0x3f, 0xff, 0x82, 0xcf, 0x5f, 0xff, 0x01, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0x87, 0xbf, 0x1f, 0xff, 0x01, 0xbf, 0x1f, 0xf4, 0xcf, 0x3f, 0x23, 0x93, 0x00, 0x00, 0x00, 
+  0x00, 0xcf, 0x5f, 0xcc, 0x97, 0xbf, 0x1f, 0xff, 0x03, 0xc7, 0x3f, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0xb6, 0xdf, 0xff, 0x82, 0xae, 0xbf, 0xff, 0x03, 0xb6, 0xdf, 0xff, 0xc7, 0x1f, 0xff, 
+  0xcf, 0x3f, 0xff, 0xc7, 0x3f, 0xff, 0x86, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0x2f, 0x92, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x9f, 0x48, 0xc7, 0x3f, 0xff, 0x95, 0xbf, 0x1f, 0xff, 0x03, 0xc7, 0x3f, 
+  0xff, 0xcf, 0x3f, 0xff, 0xb6, 0xff, 0xff, 0xae, 0xdf, 0xff, 0x86, 0xae, 0xbf, 0xff, 0x03, 0xae, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0x84, 0xbf, 0x1f, 0xff, 0x00, 
+  0xc7, 0x1f, 0x33, 0x92, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x5f, 0x8f, 0xbf, 0x1f, 0xff, 0x94, 0xc7, 0x1f, 0xff, 0x81, 0xc7, 0x3f, 0xff, 0x00, 0xb6, 0xdf, 0xff, 0x8a, 0xae, 0xbf, 0xff, 0x00, 0xb6, 
+  0xdf, 0xff, 0x85, 0xc7, 0x3f, 0xff, 0x00, 0xcf, 0x3f, 0x3b, 0x92, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x3f, 0xbf, 0x95, 0xc7, 0x3e, 0xff, 0x01, 0xcf, 0x3f, 0xff, 0xb6, 0xdf, 0xff, 0x8c, 0xae, 0xdf, 
+  0xff, 0x02, 0xb6, 0xdf, 0xff, 0xbf, 0x1f, 0xff, 0xbe, 0xff, 0xff, 0x81, 0xb6, 0xff, 0xff, 0x03, 0xbf, 0x1f, 0xff, 0xc7, 0x3f, 0xeb, 0xd7, 0x7f, 0x97, 0xdf, 0x7f, 0x14, 0x90, 0x00, 0x00, 0x00, 
+  0x00, 0xc7, 0x3e, 0xbf, 0x94, 0xc7, 0x3e, 0xff, 0x01, 0xcf, 0x5f, 0xff, 0xb6, 0xff, 0xff, 0x93, 0xb6, 0xdf, 0xff, 0x03, 0xae, 0xdf, 0xff, 0xb6, 0xff, 0xff, 0xcf, 0x3f, 0xe0, 0xd7, 0x7f, 0x40, 
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x8f, 0x94, 0xc7, 0x3e, 0xff, 0x00, 0xc7, 0x1f, 0xff, 0x97, 0xb6, 0xdf, 0xff, 0x01, 0xc7, 0x1f, 0xec, 0xd7, 0x5f, 0x3c, 0x8e, 0x00, 0x00, 0x00, 0x00, 
+  0xd7, 0x7f, 0x48, 0x91, 0xc7, 0x3e, 0xff, 0x81, 0xcf, 0x5e, 0xff, 0x00, 0xcf, 0x5f, 0xff, 0x99, 0xb6, 0xff, 0xff, 0x01, 0xc7, 0x3f, 0xdc, 0xe7, 0x9f, 0x0b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xcf, 
+  0x5e, 0xcc, 0x8f, 0xcf, 0x5e, 0xff, 0x03, 0xd7, 0x7f, 0xff, 0xcf, 0x5f, 0xff, 0xcf, 0x3f, 0xff, 0xc7, 0x1f, 0xff, 0x9a, 0xb6, 0xff, 0xff, 0x00, 0xd7, 0x5f, 0x88, 0x8e, 0x00, 0x00, 0x00, 0x01, 
+  0xd7, 0x5e, 0x4b, 0xcf, 0x5e, 0xf7, 0x8d, 0xcf, 0x5e, 0xff, 0x01, 0xd7, 0x5f, 0xff, 0xbf, 0x1f, 0xff, 0x81, 0xb6, 0xff, 0xff, 0x9b, 0xbe, 0xff, 0xff, 0x01, 0xc7, 0x1f, 0xe0, 0xdf, 0x7f, 0x0f, 
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0x78, 0x8c, 0xcf, 0x5e, 0xff, 0x00, 0xcf, 0x5f, 0xff, 0x9f, 0xbf, 0x1f, 0xff, 0x01, 0xbf, 0x1f, 0xf4, 0xcf, 0x5f, 0x23, 0x8f, 0x00, 0x00, 0x00, 0x01, 
+  0xcf, 0x5e, 0x64, 0xcf, 0x5e, 0xe4, 0x89, 0xcf, 0x5e, 0xff, 0x00, 0xd7, 0x5f, 0xff, 0xa1, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x03, 0xcf, 0x5e, 0x14, 0xcf, 0x7e, 
+  0x70, 0xcf, 0x5e, 0xc0, 0xcf, 0x5e, 0xf7, 0x86, 0xcf, 0x5e, 0xff, 0x00, 0xcf, 0x5f, 0xff, 0xa1, 0xbf, 0x1f, 0xff, 0x00, 0xc7, 0x3f, 0x30, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x3f, 0xff, 0xa0, 
+  0xc7, 0x1f, 0xff, 0x01, 0xc7, 0x1f, 0xf8, 0xc7, 0x3f, 0x27, 0x9b, 0x00, 0x00, 0x00, 0xa1, 0xc7, 0x3e, 0xff, 0x01, 0xc7, 0x3e, 0xeb, 0xcf, 0x5f, 0x17, 0x9b, 0x00, 0x00, 0x00, 0xa1, 0xc7, 0x3e, 
+  0xff, 0x01, 0xcf, 0x3e, 0xb3, 0xff, 0x9f, 0x03, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x5e, 0xcb, 0xa0, 0xc7, 0x3e, 0xff, 0x00, 0xd7, 0x5f, 0x30, 0x9c, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x5e, 0x53, 
+  0xcf, 0x5e, 0xfc, 0x9e, 0xcf, 0x5e, 0xff, 0x00, 0xcf, 0x5e, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x5f, 0x07, 0xcf, 0x5e, 0xa8, 0x9d, 0xcf, 0x5e, 0xff, 0x01, 0xcf, 0x5e, 0x88, 0xd7, 0x9e, 
+  0x07, 0x9f, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x5e, 0x97, 0xcf, 0x5e, 0xf3, 0x98, 0xcf, 0x5e, 0xff, 0x02, 0xcf, 0x5e, 0xfc, 0xcf, 0x5e, 0xdc, 0xcf, 0x5e, 0x5b, 0xa2, 0x00, 0x00, 0x00, 0x03, 0xcf, 
+  0x5e, 0x3f, 0xcf, 0x5e, 0xa4, 0xcf, 0x5e, 0xe4, 0xcf, 0x5e, 0xfc, 0x93, 0xcf, 0x5e, 0xfb, 0x03, 0xcf, 0x5e, 0xe8, 0xcf, 0x7e, 0xb7, 0xcf, 0x5e, 0x64, 0xd7, 0x7f, 0x13, 0x95, 0x00, 0x00, 0x00, 
+  0x04, 0xae, 0xdf, 0x2c, 0xae, 0xbf, 0x08, 0xae, 0xdf, 0x1c, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x24, 0xba, 0x00, 0x00, 0x00, 0x04, 0xae, 0xbf, 0xa8, 0xae, 0xdf, 0xd3, 0xae, 0xdf, 0x50, 0xae, 0xdf, 
+  0xf7, 0xae, 0xdf, 0xa7, 0xb9, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 0x43, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0x0c, 0xae, 0xdf, 0xd3, 0xae, 0xdf, 0xd8, 0xae, 0xbf, 0x7c, 0x90, 0x00, 
+  0x00, 0x00, 0x04, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x13, 0xae, 0xdf, 0x20, 0xa2, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 0x88, 0xae, 0xbf, 0x1c, 0xae, 0xdf, 0x34, 
+  0xae, 0xdf, 0xd3, 0xae, 0xbf, 0x7c, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xcb, 0x90, 0x00, 0x00, 0x00, 0x04, 0xae, 0xbf, 0xdb, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0x6c, 
+  0xa1, 0x00, 0x00, 0x00, 0x08, 0xae, 0xdf, 0x94, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xe8, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x98, 
+  0x8d, 0x00, 0x00, 0x00, 0x07, 0xb6, 0xbf, 0x03, 0xae, 0xdf, 0xab, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0xcb, 0xae, 0xdf, 0x2c, 0xa1, 0x00, 0x00, 
+  0x00, 0x07, 0xae, 0xdf, 0x8f, 0x00, 0x00, 0x00, 0xae, 0xdf, 0x78, 0xae, 0xdf, 0x73, 0xae, 0xdf, 0xc7, 0x00, 0x00, 0x00, 0xae, 0xbf, 0xa0, 0xae, 0xdf, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x07, 0xae, 
+  0xdf, 0x07, 0xae, 0xdf, 0xc0, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xb3, 0xae, 0xdf, 0xc3, 0xae, 0xbf, 0x14, 0xae, 0xdf, 0x44, 0xae, 0xbf, 0x4f, 0xa1, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 0x1f, 0xae, 
+  0xdf, 0xfb, 0xae, 0xdf, 0xf0, 0xae, 0xff, 0x08, 0xae, 0xdf, 0xdc, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x5b, 0x86, 0x00, 0x00, 0x00, 0x04, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xc3, 0xae, 0xdf, 0x73, 0xae, 
+  0xdf, 0x94, 0xae, 0xdf, 0x97, 0x82, 0x00, 0x00, 0x00, 0x08, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdf, 0xae, 0xdf, 0xec, 0xae, 
+  0xdf, 0xef, 0xae, 0xbf, 0x5c, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xae, 0xdf, 0xd4, 0xae, 0xbf, 0x6c, 0xae, 0xdf, 0x80, 0xae, 0xdf, 0xaf, 0xae, 0xdf, 0xbf, 0x86, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 
+  0x97, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xe0, 0xb6, 0xbf, 0x13, 0x81, 0x00, 0x00, 0x00, 0x07, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x7b, 0x00, 0x00, 
+  0x00, 0xae, 0xdf, 0xd0, 0xae, 0xdf, 0x77, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x63, 0xad, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 0x18, 0xae, 0xdf, 0x7b, 0x00, 0x00, 0x00, 0xae, 0xdf, 
+  0xd0, 0xae, 0xdf, 0x77, 0xae, 0xbf, 0x43, 0xae, 0xbf, 0x18, 0xae, 0xdf, 0x63, 0x82, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 0x97, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x9c, 0xae, 0xdf, 0x1f, 0xae, 0xdf, 
+  0xff, 0xae, 0xdf, 0xe0, 0xb6, 0xbf, 0x13, 0xad, 0x00, 0x00, 0x00, 0x08, 0xae, 0xdf, 0xd4, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdb, 0xae, 0xdf, 0xf3, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xdf, 0xae, 0xdf, 
+  0xec, 0xae, 0xdf, 0xef, 0xae, 0xbf, 0x5c, 0x82, 0x00, 0x00, 0x00, 0x02, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0xc3, 0xae, 0xdf, 0x73, 0x81, 0xae, 0xdf, 0x97, 0x85, 0x00, 0x00, 0x00, 0x04, 0xae, 0xdf, 
+  0xab, 0xae, 0xbf, 0x28, 0xae, 0xdf, 0x6f, 0xae, 0xbf, 0x64, 0xae, 0xdf, 0x93, 0xa3, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 0x07, 0xae, 0xdf, 0xc0, 0x00, 0x00, 0x00, 0xae, 0xdf, 0xb3, 0xae, 0xdf, 
+  0xc3, 0xae, 0xbf, 0x14, 0xae, 0xdf, 0x44, 0xae, 0xbf, 0x4f, 0x8d, 0x00, 0x00, 0x00, 0x06, 0xae, 0xbf, 0x0b, 0xae, 0xbf, 0xb7, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x28, 0xae, 0xdf, 0xff, 0xae, 0xdf, 
+  0xbf, 0xae, 0xdf, 0x1f, 0xa2, 0x00, 0x00, 0x00, 0x07, 0xb6, 0x9f, 0x03, 0xae, 0xdf, 0xab, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0x98, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xd7, 0xae, 0xdf, 0xcb, 0xae, 0xdf, 
+  0x2c, 0x8d, 0x00, 0x00, 0x00, 0x07, 0xae, 0xdf, 0x7b, 0xae, 0xdf, 0x38, 0xae, 0xdf, 0xaf, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0xe3, 0xae, 0xdf, 0x33, 0xae, 0xbf, 0x84, 0xae, 0xdf, 0x0b, 0xa2, 0x00, 
+  0x00, 0x00, 0x05, 0xa7, 0x1f, 0x03, 0xae, 0xbf, 0xdb, 0xae, 0xdf, 0xe0, 0xae, 0xdf, 0x54, 0xae, 0xdf, 0xe7, 0xae, 0xdf, 0x6c, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xa8, 
+  0xae, 0xdf, 0x6b, 0xae, 0xdf, 0x58, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x88, 0xae, 0xdf, 0x4f, 0xae, 0xdf, 0xeb, 0xae, 0xbf, 0x28, 0xa3, 0x00, 0x00, 0x00, 0x04, 0xae, 0xdf, 0x2c, 0xae, 0xdf, 0x20, 
+  0xae, 0xdf, 0x18, 0xae, 0xdf, 0x14, 0xae, 0xdf, 0x20, 0x8d, 0x00, 0x00, 0x00, 0x08, 0xae, 0xdf, 0x20, 0xae, 0xdf, 0xa8, 0xae, 0xdf, 0x6b, 0xae, 0xdf, 0x58, 0xae, 0xdf, 0xff, 0xae, 0xbf, 0x88, 
+  0xae, 0xdf, 0x4f, 0xae, 0xdf, 0xeb, 0xae, 0xbf, 0x28, 0xb7, 0x00, 0x00, 0x00, 0x07, 0xae, 0xbf, 0x78, 0xae, 0xdf, 0x38, 0xae, 0xdf, 0xaf, 0xae, 0xdf, 0x30, 0xae, 0xdf, 0xe3, 0xae, 0xdf, 0x33, 
+  0xae, 0xbf, 0x84, 0xae, 0xdf, 0x0b, 0xb7, 0x00, 0x00, 0x00, 0x06, 0xae, 0xdf, 0x0b, 0xae, 0xbf, 0xb7, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0x28, 0xae, 0xdf, 0xff, 0xae, 0xdf, 0xbf, 0xae, 0xdf, 0x1f, 
+  0xb9, 0x00, 0x00, 0x00, 0x04, 0xae, 0xdf, 0xab, 0xae, 0xbf, 0x28, 0xae, 0xdf, 0x6f, 0xae, 0xbf, 0x64, 0xae, 0xdf, 0x93, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xcd, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0xcc, 0x00, 0xff, 0xea, 0xcd, 0x00, 0xff, 0xee, 0xcc, 0x00, 0xff, 0xea, 0xd5, 0x0c, 0xff, 0xeb, 0xd4, 0x1c, 0xff, 0xeb, 0xd2, 0x28, 0xff, 0xeb, 0xd2, 0x33, 0xff, 0xeb, 0xd2, 0x33, 0xff, 0xeb, 0xd2, 0x28, 0xff, 0xeb, 0xd4, 0x1c, 0xff, 0xea, 0xd5, 0x0c, 0xff, 0xee, 0xcc, 0x00, 0xff, 0xea, 0xcd, 0x00, 0xff, 0xec, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xc5, 0x00, 0xff, 0xea, 0xcf, 0x00, 0xff, 0xee, 0xcf, 0x20, 0xff, 0xea, 0xd1, 0x84, 0xff, 0xe5, 0xc5, 0xe0, 0xff, 0xdf, 0xbb, 0xef, 0xff, 0xdc, 0xb5, 0xfb, 0xff, 0xda, 0xb1, 0xff, 0xff, 0xda, 0xb1, 0xff, 0xff, 0xdc, 0xb5, 0xfb, 0xff, 0xdf, 0xbb, 0xef, 0xff, 0xe5, 0xc5, 0xe0, 0xff, 0xea, 0xd1, 0x84, 0xff, 0xee, 0xcf, 0x20, 0xff, 0xea, 0xcf, 0x00, 0xff, 0xeb, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xd1, 0x00, 0xff, 0xeb, 0xd2, 0x00, 0xff, 0xeb, 0xd2, 0x13, 0xff, 0xe8, 0xcb, 0x83, 0xff, 0xe1, 0xc2, 0xf3, 0xff, 0xda, 0xb1, 0xff, 0xff, 0xd4, 0xa5, 0xff, 0xff, 0xd5, 0xa7, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd5, 0xa8, 0xff, 0xff, 0xd5, 0xa7, 0xff, 0xff, 0xd4, 0xa5, 0xff, 0xff, 0xda, 0xb1, 0xff, 0xff, 0xe1, 0xc2, 0xf3, 0xff, 0xe8, 0xcb, 0x83, 0xff, 0xeb, 0xd2, 0x13, 0xff, 0xeb, 0xd2, 0x00, 0xff, 0xeb, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xd2, 0x00, 0xff, 0xef, 0xd8, 0x2f, 0xfe, 0xe4, 0xc5, 0xcc, 0xfe, 0xd9, 0xb0, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd9, 0xb0, 0xff, 0xfe, 0xe4, 0xc5, 0xcc, 0xff, 0xef, 0xd8, 0x2f, 0xff, 0xeb, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0xd0, 0x00, 0xff, 0xeb, 0xd2, 0x00, 0xff, 0xeb, 0xd1, 0x2b, 0xfe, 0xe2, 0xc0, 0xe7, 0xfe, 0xd8, 0xac, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd7, 0xaa, 0xff, 0xfe, 0xd8, 0xac, 0xff, 0xfe, 0xe2, 0xc0, 0xe7, 0xfe, 0xeb, 0xd1, 0x33, 0xfd, 0xec, 0xd4, 0x1c, 0xfe, 0xeb, 0xd5, 0x2b, 0xfe, 0xec, 0xd5, 0x33, 0xfe, 0xeb, 0xd5, 0x2f, 0xfe, 0xec, 0xd5, 0x23, 0xff, 0xec, 0xd6, 0x13, 0xff, 0xf0, 0xd1, 0x00, 0xfe, 0xeb, 0xd0, 0x00, 0xff, 0xeb, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xd2, 0x00, 0xff, 0xeb, 0xd8, 0x1c, 0xfe, 0xe3, 0xc1, 0xd7, 0xfd, 0xd8, 0xad, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xad, 0xff, 0xfd, 0xe0, 0xbc, 0xf3, 0xfd, 0xe2, 0xbf, 0xef, 0xfd, 0xde, 0xb8, 0xfc, 0xfd, 0xdd, 0xb5, 0xff, 0xfd, 0xdd, 0xb7, 0xff, 0xfd, 0xe0, 0xbc, 0xf4, 0xfe, 0xe5, 0xc5, 0xe7, 0xfe, 0xea, 0xd0, 0xa8, 0xff, 0xee, 0xd3, 0x37, 0xfe, 0xeb, 0xd1, 0x00, 0xff, 0xe7, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0xd2, 0x00, 0xfe, 0xef, 0xe2, 0x04, 0xfe, 0xe7, 0xc7, 0xa4, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd7, 0xab, 0xff, 0xfc, 0xda, 0xb1, 0xff, 0xfd, 0xe2, 0xc2, 0xff, 0xfd, 0xe8, 0xce, 0x8f, 0xfd, 0xec, 0xd3, 0x14, 0xfc, 0xec, 0xd4, 0x00, 0xfc, 0xeb, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0xd4, 0x00, 0xfe, 0xe9, 0xcc, 0x3c, 0xfc, 0xdc, 0xb5, 0xf7, 0xfc, 0xd9, 0xae, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xaf, 0xff, 0xfc, 0xd9, 0xae, 0xff, 0xfc, 0xdc, 0xb5, 0xff, 0xfc, 0xe6, 0xc9, 0xc4, 0xfc, 0xee, 0xdb, 0x20, 0xfc, 0xec, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xbb, 0x00, 0xfc, 0xe5, 0xcb, 0x00, 0xfc, 0xe4, 0xc5, 0xab, 0xfb, 0xdb, 0xb1, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xdc, 0xb3, 0xff, 0xfc, 0xe6, 0xc8, 0xc4, 0xfd, 0xec, 0xd6, 0x14, 0xff, 0xe7, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xed, 0xd6, 0x00, 0xfb, 0xed, 0xd6, 0x00, 0xfc, 0xed, 0xd6, 0x00, 0xfb, 0xed, 0xd6, 0x00, 0xfc, 0xfc, 0xf0, 0x0c, 0xfa, 0xdf, 0xbb, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdb, 0xb2, 0xff, 0xfa, 0xdd, 0xb5, 0xff, 0xfb, 0xe8, 0xcb, 0x8f, 0xfb, 0xeb, 0xd3, 0x00, 0xfb, 0xeb, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xee, 0xd6, 0x00, 0xff, 0xe8, 0xd4, 0x00, 0xfd, 0xf0, 0xdd, 0x14, 0xfb, 0xec, 0xd3, 0x70, 0xfc, 0xeb, 0xd1, 0xc0, 0xfb, 0xea, 0xd0, 0xf7, 0xfb, 0xe8, 0xcb, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xdc, 0xb3, 0xff, 0xfa, 0xe2, 0xbe, 0xff, 0xfc, 0xec, 0xd9, 0x37, 0xfc, 0xea, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xee, 0xd7, 0x00, 0xfc, 0xef, 0xd8, 0x00, 0xfd, 0xee, 0xd7, 0x64, 0xfb, 0xe6, 0xca, 0xe4, 0xf9, 0xe0, 0xbb, 0xff, 0xf9, 0xde, 0xb7, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xfb, 0xe6, 0xc8, 0xa8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xee, 0xd9, 0x00, 0xff, 0xd7, 0x8a, 0x00, 0xfb, 0xed, 0xd5, 0x78, 0xf9, 0xe4, 0xc3, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xde, 0xb6, 0xff, 0xf8, 0xe1, 0xbc, 0xe7, 0xfb, 0xef, 0xd8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xef, 0xdb, 0x00, 0xfb, 0xed, 0xd6, 0x4b, 0xf8, 0xe2, 0xc1, 0xf7, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf9, 0xe2, 0xbf, 0xff, 0xfb, 0xe5, 0xc5, 0xff, 0xfd, 0xe7, 0xca, 0xff, 0xfd, 0xe8, 0xcb, 0xff, 0xfd, 0xe7, 0xc9, 0xff, 0xfb, 0xe5, 0xc5, 0xff, 0xf9, 0xe2, 0xbf, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xe0, 0xbb, 0xf4, 0xf9, 0xe6, 0xca, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xf2, 0xdd, 0x00, 0xf3, 0xd8, 0xac, 0x00, 0xf8, 0xe8, 0xcb, 0xcc, 0xf6, 0xe0, 0xbb, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe1, 0xbb, 0xff, 0xf8, 0xe3, 0xc1, 0xff, 0xfd, 0xe4, 0xc5, 0xff, 0xff, 0xe0, 0xbd, 0xff, 0xff, 0xda, 0xb1, 0xff, 0xff, 0xd6, 0xaa, 0xff, 0xff, 0xd4, 0xa7, 0xff, 0xff, 0xd6, 0xaa, 0xff, 0xff, 0xda, 0xb2, 0xff, 0xff, 0xe0, 0xbd, 0xff, 0xfd, 0xe4, 0xc5, 0xff, 0xf9, 0xe3, 0xc0, 0xff, 0xf6, 0xe1, 0xbb, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe0, 0xba, 0xff, 0xf6, 0xe1, 0xbc, 0xff, 0xf7, 0xe4, 0xc2, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xef, 0xd6, 0x00, 0xfa, 0xf2, 0xdb, 0x48, 0xf5, 0xe3, 0xbe, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf6, 0xe3, 0xbe, 0xff, 0xfc, 0xe5, 0xc6, 0xff, 0xfe, 0xdc, 0xb4, 0xff, 0xfe, 0xd7, 0xab, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa9, 0xff, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd5, 0xa8, 0xff, 0xfe, 0xd7, 0xab, 0xff, 0xfe, 0xdb, 0xb4, 0xff, 0xfb, 0xe6, 0xc5, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbd, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xe8, 0xcc, 0x00, 0xf8, 0xe9, 0xcd, 0x8f, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf5, 0xe2, 0xbd, 0xff, 0xf6, 0xe3, 0xbf, 0xff, 0xfc, 0xe4, 0xc4, 0xff, 0xfe, 0xd8, 0xad, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd6, 0xaa, 0xff, 0xfe, 0xd7, 0xae, 0xff, 0xfc, 0xe4, 0xc4, 0xff, 0xf7, 0xe4, 0xc1, 0xff, 0xf7, 0xe4, 0xc2, 0xff, 0xf8, 0xe4, 0xc4, 0xff, 0xf8, 0xe4, 0xc3, 0xff, 0xf7, 0xe4, 0xc1, 0xff, 0xf8, 0xe6, 0xc7, 0x3b, 0xff, 0x97, 0xdb, 0x00, 0xff, 0xe9, 0xd1, 0x00, 0xff, 0xe8, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xe6, 0xc5, 0x00, 0xf5, 0xe6, 0xc5, 0xbf, 0xf4, 0xe4, 0xbf, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe3, 0xbf, 0xff, 0xfb, 0xe5, 0xc5, 0xff, 0xfd, 0xd9, 0xae, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd8, 0xac, 0xff, 0xfd, 0xd9, 0xae, 0xff, 0xfd, 0xdf, 0xba, 0xff, 0xfd, 0xdd, 0xb7, 0xff, 0xfd, 0xdb, 0xb3, 0xff, 0xfd, 0xdc, 0xb4, 0xff, 0xfd, 0xe0, 0xba, 0xff, 0xfe, 0xe4, 0xc4, 0xeb, 0xfe, 0xeb, 0xd0, 0x97, 0xff, 0xec, 0xd5, 0x14, 0xff, 0xeb, 0xd1, 0x00, 0xff, 0xec, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe5, 0xc2, 0x00, 0xf3, 0xe5, 0xc2, 0xbf, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf3, 0xe4, 0xc1, 0xff, 0xf7, 0xe7, 0xc7, 0xff, 0xfc, 0xdb, 0xb2, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd8, 0xad, 0xff, 0xfc, 0xd7, 0xab, 0xff, 0xfc, 0xdb, 0xb4, 0xff, 0xfd, 0xe5, 0xc7, 0xe0, 0xfe, 0xeb, 0xd0, 0x40, 0xff, 0xe2, 0xba, 0x00, 0xff, 0xea, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe7, 0xc6, 0x00, 0xf3, 0xe8, 0xc6, 0x8f, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf2, 0xe6, 0xc3, 0xff, 0xf3, 0xe6, 0xc4, 0xff, 0xfa, 0xe0, 0xbd, 0xff, 0xfb, 0xd9, 0xaf, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfb, 0xda, 0xaf, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfc, 0xe2, 0xbf, 0xec, 0xff, 0xea, 0xd4, 0x3c, 0xff, 0xea, 0xd7, 0x00, 0xff, 0xea, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xeb, 0xcd, 0x00, 0xf5, 0xec, 0xcf, 0x48, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf3, 0xe7, 0xc6, 0xff, 0xf3, 0xe7, 0xc7, 0xff, 0xf5, 0xe7, 0xc7, 0xff, 0xfa, 0xdd, 0xb4, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0xfb, 0xe5, 0xc4, 0xdc, 0xff, 0xf0, 0xe1, 0x0b, 0xfe, 0xec, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xee, 0xd2, 0x00, 0xe7, 0xda, 0xa9, 0x00, 0xf2, 0xe8, 0xc7, 0xcc, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc6, 0xff, 0xf1, 0xe7, 0xc7, 0xff, 0xf8, 0xeb, 0xcf, 0xff, 0xfa, 0xe8, 0xcb, 0xff, 0xfa, 0xe5, 0xc5, 0xff, 0xfa, 0xe1, 0xc0, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xf9, 0xdc, 0xb3, 0xff, 0xf9, 0xdc, 0xb4, 0xff, 0xfc, 0xe9, 0xcd, 0x88, 0xf6, 0xda, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xd3, 0x00, 0xf2, 0xea, 0xcd, 0x4b, 0xf1, 0xe8, 0xc6, 0xf7, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf1, 0xe8, 0xc6, 0xff, 0xf2, 0xe9, 0xc9, 0xff, 0xfa, 0xe9, 0xcd, 0xff, 0xfa, 0xe0, 0xbc, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xfa, 0xe1, 0xbe, 0xe0, 0xfc, 0xee, 0xdb, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xea, 0xd1, 0x00, 0xed, 0xed, 0xc3, 0x00, 0xf0, 0xe9, 0xc8, 0x78, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf1, 0xe9, 0xca, 0xff, 0xf8, 0xe7, 0xc9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0xf8, 0xe0, 0xbb, 0xf4, 0xfb, 0xe9, 0xcb, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xea, 0xc8, 0x00, 0xf1, 0xea, 0xc9, 0x00, 0xf1, 0xe9, 0xca, 0x64, 0xf0, 0xe9, 0xc9, 0xe4, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf0, 0xe9, 0xc9, 0xff, 0xf5, 0xea, 0xcd, 0xff, 0xf7, 0xe1, 0xbb, 0xff, 0xf7, 0xe0, 0xba, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe0, 0xb9, 0xff, 0xf7, 0xe1, 0xbb, 0xff, 0xf8, 0xe4, 0xc1, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xe9, 0xca, 0x00, 0xf8, 0xe5, 0xbc, 0x00, 0xed, 0xe8, 0xc9, 0x14, 0xf0, 0xeb, 0xcb, 0x70, 0xef, 0xea, 0xca, 0xc0, 0xee, 0xea, 0xca, 0xf7, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xef, 0xea, 0xca, 0xff, 0xf6, 0xe7, 0xc7, 0xff, 0xf5, 0xe2, 0xbb, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe2, 0xbc, 0xff, 0xf5, 0xe3, 0xbd, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xed, 0xcd, 0x00, 0xf0, 0xec, 0xcc, 0x00, 0xef, 0xea, 0xca, 0x00, 0xee, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xf2, 0xe7, 0xc6, 0x00, 0xf5, 0xe3, 0xc1, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0xf5, 0xe2, 0xbf, 0xf8, 0xf5, 0xe4, 0xc1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe4, 0xc0, 0x00, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc0, 0xff, 0xf4, 0xe4, 0xc1, 0xeb, 0xf6, 0xea, 0xcb, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe5, 0xc2, 0x00, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc2, 0xff, 0xf3, 0xe5, 0xc5, 0xb3, 0xf5, 0xf2, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xe7, 0xc7, 0x00, 0xf3, 0xe7, 0xc7, 0xcb, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf2, 0xe6, 0xc4, 0xff, 0xf1, 0xe6, 0xc4, 0xff, 0xf5, 0xea, 0xcd, 0x30, 0xf3, 0xe7, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xeb, 0xd0, 0x00, 0xf2, 0xe9, 0xcb, 0x53, 0xf1, 0xe7, 0xc5, 0xfc, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe7, 0xc5, 0xff, 0xf1, 0xe8, 0xc8, 0x77, 0xf2, 0xe9, 0xcb, 0x00, 0xf5, 0xeb, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0xff, 0x00, 0xf9, 0xe9, 0xd8, 0x07, 0xf1, 0xe8, 0xc7, 0xa8, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc7, 0xff, 0xf0, 0xe8, 0xc6, 0x88, 0xf0, 0xf0, 0xd3, 0x07, 0xea, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xe8, 0xd6, 0x00, 0xea, 0xee, 0xad, 0x00, 0xf1, 0xe9, 0xc9, 0x97, 0xf0, 0xe9, 0xc8, 0xf3, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xff, 0xf0, 0xe9, 0xc8, 0xfc, 0xf0, 0xe9, 0xc8, 0xdc, 0xef, 0xe9, 0xc9, 0x5b, 0xe4, 0xd8, 0xb9, 0x00, 0xfb, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe7, 0xce, 0x00, 0xfb, 0xe5, 0xd2, 0x00, 0xff, 0xf1, 0xee, 0x00, 0xef, 0xe9, 0xcc, 0x3f, 0xf0, 0xe9, 0xca, 0xa4, 0xef, 0xea, 0xca, 0xe4, 0xef, 0xea, 0xca, 0xfc, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xea, 0xca, 0xfb, 0xef, 0xe9, 0xca, 0xe8, 0xef, 0xeb, 0xca, 0xb7, 0xf0, 0xea, 0xcb, 0x64, 0xf5, 0xee, 0xcd, 0x13, 0xef, 0xe9, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xd9, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x2c, 0xfe, 0xd4, 0xaa, 0x08, 0xfd, 0xd7, 0xaa, 0x1c, 0xfd, 0xd6, 0xac, 0x18, 0xfe, 0xd7, 0xab, 0x24, 0xfe, 0xd8, 0xab, 0x00, 0xff, 0xdb, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xd8, 0xa0, 0x00, 0xef, 0xe9, 0xd0, 0x00, 0xf0, 0xe9, 0xcb, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xea, 0xca, 0x00, 0xef, 0xe9, 0xca, 0x00, 0xef, 0xeb, 0xca, 0x00, 0xf0, 0xeb, 0xcc, 0x00, 0xff, 0xff, 0xe3, 0x00, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xef, 0xb5, 0x00, 0xfc, 0xd6, 0xab, 0xa8, 0xfd, 0xd7, 0xab, 0xd3, 0xfe, 0xd8, 0xaa, 0x50, 0xfd, 0xd7, 0xab, 0xf7, 0xfd, 0xd7, 0xac, 0xa7, 0xf4, 0xbf, 0xb5, 0x00, 0xff, 0xe2, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x43, 0xfd, 0xd7, 0xab, 0xd0, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xda, 0xa9, 0x0c, 0xfe, 0xd7, 0xab, 0xd3, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd6, 0xac, 0x7c, 0xe2, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfb, 0xda, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x2c, 0xfc, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xaa, 0x18, 0xfd, 0xd7, 0xaa, 0x13, 0xfe, 0xd7, 0xab, 0x20, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd8, 0xab, 0x88, 0xfd, 0xd6, 0xab, 0x1c, 0xfd, 0xd7, 0xab, 0x34, 0xfd, 0xd7, 0xab, 0xd3, 0xfd, 0xd6, 0xac, 0x7c, 0xec, 0xd7, 0xb4, 0x00, 0xfd, 0xd7, 0xab, 0xcb, 0xfc, 0xd8, 0xae, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0xa9, 0x00, 0xff, 0x85, 0x90, 0x00, 0xfc, 0xd6, 0xab, 0xdb, 0xfd, 0xd8, 0xab, 0xe0, 0xfe, 0xd7, 0xaa, 0x54, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xac, 0x6c, 0xf8, 0xca, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x94, 0xfd, 0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe8, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x98, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xaf, 0x03, 0xfd, 0xd7, 0xab, 0xab, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xaa, 0x98, 0xff, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xab, 0xcb, 0xfd, 0xd7, 0xac, 0x2c, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x8f, 0xff, 0xd4, 0xae, 0x00, 0xfd, 0xd7, 0xaa, 0x78, 0xfe, 0xd8, 0xab, 0x73, 0xfd, 0xd7, 0xab, 0xc7, 0xfb, 0xd8, 0xac, 0x00, 0xfd, 0xd6, 0xac, 0xa0, 0xfc, 0xd9, 0xa8, 0x08, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfa, 0xdc, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfc, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xda, 0xa9, 0x07, 0xfd, 0xd7, 0xab, 0xc0, 0xfc, 0xd8, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xb3, 0xfd, 0xd7, 0xab, 0xc3, 0xfe, 0xd4, 0xac, 0x14, 0xfe, 0xd7, 0xab, 0x44, 0xfd, 0xd6, 0xab, 0x4f, 0xfd, 0xd6, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x1f, 0xfd, 0xd7, 0xab, 0xfb, 0xfd, 0xd7, 0xab, 0xf0, 0xfd, 0xdb, 0xa8, 0x08, 0xfe, 0xd7, 0xab, 0xdc, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x5b, 0xfd, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd3, 0xaa, 0x00, 0xf7, 0xde, 0xae, 0x00, 0xfd, 0xd7, 0xab, 0xe7, 0xfc, 0xd7, 0xab, 0xc3, 0xfd, 0xd7, 0xaa, 0x73, 0xfd, 0xd7, 0xab, 0x94, 0xfe, 0xd7, 0xab, 0x97, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdf, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd7, 0xab, 0xef, 0xfd, 0xd6, 0xac, 0x5c, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xd8, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xd6, 0xab, 0x6c, 0xfd, 0xd7, 0xaa, 0x80, 0xfd, 0xd7, 0xac, 0xaf, 0xfe, 0xd7, 0xab, 0xbf, 0xfd, 0xd5, 0xac, 0x00, 0xff, 0xe8, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x97, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd8, 0xab, 0x9c, 0xfe, 0xd7, 0xab, 0x1f, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd5, 0xad, 0x13, 0xfc, 0xd8, 0xaa, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x18, 0xfc, 0xd7, 0xab, 0x7b, 0xfc, 0xd8, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0xd0, 0xfe, 0xd8, 0xab, 0x77, 0xfe, 0xd5, 0xab, 0x43, 0xfe, 0xd6, 0xac, 0x18, 0xfd, 0xd7, 0xab, 0x63, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xda, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfe, 0xd5, 0xaa, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xac, 0x18, 0xfc, 0xd8, 0xab, 0x7b, 0xfc, 0xd8, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0xd0, 0xfe, 0xd8, 0xab, 0x77, 0xfe, 0xd5, 0xab, 0x43, 0xfe, 0xd6, 0xac, 0x18, 0xfd, 0xd7, 0xab, 0x63, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x97, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd8, 0xab, 0x9c, 0xfe, 0xd7, 0xab, 0x1f, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd5, 0xad, 0x13, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xda, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfe, 0xd5, 0xaa, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdf, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd7, 0xab, 0xef, 0xfd, 0xd6, 0xac, 0x5c, 0xfd, 0xd6, 0xac, 0x00, 0xff, 0xd5, 0xaa, 0x00, 0xf6, 0xda, 0xae, 0x00, 0xfd, 0xd7, 0xab, 0xe7, 0xfc, 0xd7, 0xab, 0xc3, 0xfd, 0xd7, 0xaa, 0x73, 0xfd, 0xd7, 0xab, 0x97, 0xfe, 0xd7, 0xab, 0x97, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xd9, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xab, 0xfe, 0xd4, 0xaa, 0x28, 0xfd, 0xd7, 0xaa, 0x6f, 0xfd, 0xd6, 0xac, 0x64, 0xfe, 0xd7, 0xab, 0x93, 0xfe, 0xd7, 0xab, 0x00, 0xff, 0xdb, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd9, 0xa9, 0x07, 0xfd, 0xd7, 0xab, 0xc0, 0xfc, 0xd8, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xb3, 0xfd, 0xd7, 0xab, 0xc3, 0xfe, 0xd4, 0xac, 0x14, 0xfe, 0xd7, 0xab, 0x44, 0xfd, 0xd6, 0xab, 0x4f, 0xfd, 0xd6, 0xab, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xff, 0xd4, 0xaa, 0x00, 0xfa, 0xdc, 0xad, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfc, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd8, 0xaa, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xac, 0x00, 0xff, 0xd5, 0xaa, 0x0b, 0xfc, 0xd6, 0xab, 0xb7, 0xfd, 0xd7, 0xab, 0xff, 0xfe, 0xd9, 0xaa, 0x28, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0xbf, 0xfe, 0xd8, 0xab, 0x1f, 0xfd, 0xd8, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd2, 0xb0, 0x03, 0xfd, 0xd7, 0xab, 0xab, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xaa, 0x98, 0xff, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xab, 0xcb, 0xfd, 0xd7, 0xac, 0x2c, 0xfc, 0xd8, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xac, 0x00, 0xfd, 0xd7, 0xac, 0x7b, 0xfd, 0xd7, 0xab, 0x38, 0xfd, 0xd7, 0xaa, 0xaf, 0xff, 0xd9, 0xaa, 0x30, 0xfd, 0xd7, 0xab, 0xe3, 0xfd, 0xd7, 0xab, 0x33, 0xfd, 0xd6, 0xac, 0x84, 0xfc, 0xd9, 0xa9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xa9, 0x00, 0xff, 0xe1, 0xa2, 0x03, 0xfc, 0xd6, 0xab, 0xdb, 0xfd, 0xd8, 0xab, 0xe0, 0xfe, 0xd7, 0xaa, 0x54, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xac, 0x6c, 0xf8, 0xca, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xa8, 0xfd, 0xd7, 0xab, 0x6b, 0xfd, 0xd7, 0xab, 0x58, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x88, 0xfe, 0xd7, 0xab, 0x4f, 0xfd, 0xd7, 0xab, 0xeb, 0xfd, 0xd6, 0xac, 0x28, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0xaa, 0x00, 0xfc, 0xdb, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x2c, 0xfc, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xaa, 0x18, 0xfd, 0xd8, 0xaa, 0x14, 0xfe, 0xd7, 0xab, 0x20, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfd, 0xd7, 0xab, 0x20, 0xfd, 0xd8, 0xab, 0xa8, 0xfd, 0xd7, 0xab, 0x6b, 0xfd, 0xd7, 0xab, 0x58, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x88, 0xfe, 0xd7, 0xab, 0x4f, 0xfd, 0xd7, 0xab, 0xeb, 0xfd, 0xd6, 0xac, 0x28, 0xfd, 0xd6, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfd, 0xd6, 0xac, 0x78, 0xfd, 0xd7, 0xab, 0x38, 0xfd, 0xd7, 0xaa, 0xaf, 0xff, 0xd9, 0xaa, 0x30, 0xfd, 0xd7, 0xab, 0xe3, 0xfd, 0xd7, 0xab, 0x33, 0xfd, 0xd6, 0xac, 0x84, 0xfc, 0xd9, 0xa9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xff, 0xd8, 0xaa, 0x0b, 0xfc, 0xd6, 0xab, 0xb7, 0xfd, 0xd7, 0xab, 0xff, 0xfe, 0xd9, 0xaa, 0x28, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0xbf, 0xfe, 0xd8, 0xab, 0x1f, 0xfd, 0xd8, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xda, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0xab, 0xfe, 0xd4, 0xaa, 0x28, 0xfd, 0xd7, 0xaa, 0x6f, 0xfd, 0xd6, 0xac, 0x64, 0xfe, 0xd7, 0xab, 0x93, 0xfe, 0xd7, 0xab, 0x00, 0xff, 0xdb, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xda, 0xac, 0x00, 0xfd, 0xd7, 0xab, 0x00, 0xfe, 0xd5, 0xaa, 0x00, 0xfd, 0xd7, 0xaa, 0x00, 0xfd, 0xd6, 0xac, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0xfe, 0xd7, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xea, 0xd5, 0x0c, 0xff, 0xeb, 0xd4, 
+  0x1c, 0xff, 0xeb, 0xd2, 0x28, 0x81, 0xff, 0xeb, 0xd2, 0x33, 0x02, 0xff, 0xeb, 0xd2, 0x28, 0xff, 0xeb, 0xd4, 0x1c, 0xff, 0xea, 0xd5, 0x0c, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xee, 0xcf, 
+  0x20, 0xff, 0xea, 0xd1, 0x84, 0xff, 0xe5, 0xc5, 0xe0, 0xff, 0xdf, 0xbb, 0xef, 0xff, 0xdc, 0xb5, 0xfb, 0x81, 0xff, 0xda, 0xb1, 0xff, 0x04, 0xff, 0xdc, 0xb5, 0xfb, 0xff, 0xdf, 0xbb, 0xef, 0xff, 
+  0xe5, 0xc5, 0xe0, 0xff, 0xea, 0xd1, 0x84, 0xff, 0xee, 0xcf, 0x20, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xeb, 0xd2, 0x13, 0xff, 0xe8, 0xcb, 0x83, 0xff, 0xe1, 0xc2, 0xf3, 0xff, 0xda, 0xb1, 
+  0xff, 0xff, 0xd4, 0xa5, 0xff, 0xff, 0xd5, 0xa7, 0xff, 0x83, 0xff, 0xd5, 0xa8, 0xff, 0x05, 0xff, 0xd5, 0xa7, 0xff, 0xff, 0xd4, 0xa5, 0xff, 0xff, 0xda, 0xb1, 0xff, 0xff, 0xe1, 0xc2, 0xf3, 0xff, 
+  0xe8, 0xcb, 0x83, 0xff, 0xeb, 0xd2, 0x13, 0xae, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xef, 0xd8, 0x2f, 0xfe, 0xe4, 0xc5, 0xcc, 0xfe, 0xd9, 0xb0, 0xff, 0x8b, 0xfe, 0xd6, 0xa9, 0xff, 0x02, 0xfe, 
+  0xd9, 0xb0, 0xff, 0xfe, 0xe4, 0xc5, 0xcc, 0xff, 0xef, 0xd8, 0x2f, 0xac, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xeb, 0xd1, 0x2b, 0xfe, 0xe2, 0xc0, 0xe7, 0xfe, 0xd8, 0xac, 0xff, 0x8d, 0xfe, 0xd7, 
+  0xaa, 0xff, 0x08, 0xfe, 0xd8, 0xac, 0xff, 0xfe, 0xe2, 0xc0, 0xe7, 0xfe, 0xeb, 0xd1, 0x33, 0xfd, 0xec, 0xd4, 0x1c, 0xfe, 0xeb, 0xd5, 0x2b, 0xfe, 0xec, 0xd5, 0x33, 0xfe, 0xeb, 0xd5, 0x2f, 0xfe, 
+  0xec, 0xd5, 0x23, 0xff, 0xec, 0xd6, 0x13, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xeb, 0xd8, 0x1c, 0xfe, 0xe3, 0xc1, 0xd7, 0xfd, 0xd8, 0xad, 0xff, 0x8f, 0xfd, 0xd8, 0xac, 0xff, 0x09, 0xfd, 
+  0xd8, 0xad, 0xff, 0xfd, 0xe0, 0xbc, 0xf3, 0xfd, 0xe2, 0xbf, 0xef, 0xfd, 0xde, 0xb8, 0xfc, 0xfd, 0xdd, 0xb5, 0xff, 0xfd, 0xdd, 0xb7, 0xff, 0xfd, 0xe0, 0xbc, 0xf4, 0xfe, 0xe5, 0xc5, 0xe7, 0xfe, 
+  0xea, 0xd0, 0xa8, 0xff, 0xee, 0xd3, 0x37, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xef, 0xe2, 0x04, 0xfe, 0xe7, 0xc7, 0xa4, 0xfc, 0xd9, 0xaf, 0xff, 0x91, 0xfc, 0xd8, 0xad, 0xff, 0x81, 0xfc, 
+  0xd8, 0xac, 0xff, 0x82, 0xfc, 0xd8, 0xad, 0xff, 0x05, 0xfc, 0xd8, 0xac, 0xff, 0xfc, 0xd7, 0xab, 0xff, 0xfc, 0xda, 0xb1, 0xff, 0xfd, 0xe2, 0xc2, 0xff, 0xfd, 0xe8, 0xce, 0x8f, 0xfd, 0xec, 0xd3, 
+  0x14, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xe9, 0xcc, 0x3c, 0xfc, 0xdc, 0xb5, 0xf7, 0xfc, 0xd9, 0xae, 0xff, 0x99, 0xfc, 0xd9, 0xaf, 0xff, 0x03, 0xfc, 0xd9, 0xae, 0xff, 0xfc, 0xdc, 0xb5, 
+  0xff, 0xfc, 0xe6, 0xc9, 0xc4, 0xfc, 0xee, 0xdb, 0x20, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0xe4, 0xc5, 0xab, 0xfb, 0xdb, 0xb1, 0xff, 0x9c, 0xfb, 0xda, 0xb0, 0xff, 0x02, 0xfb, 0xdc, 0xb3, 
+  0xff, 0xfc, 0xe6, 0xc8, 0xc4, 0xfd, 0xec, 0xd6, 0x14, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xfc, 0xf0, 0x0c, 0xfa, 0xdf, 0xbb, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0x9d, 0xfa, 0xdb, 0xb2, 0xff, 
+  0x01, 0xfa, 0xdd, 0xb5, 0xff, 0xfb, 0xe8, 0xcb, 0x8f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xf0, 0xdd, 0x14, 0xfb, 0xec, 0xd3, 0x70, 0xfc, 0xeb, 0xd1, 0xc0, 0xfb, 0xea, 0xd0, 0xf7, 0xfb, 
+  0xe8, 0xcb, 0xff, 0xfa, 0xdb, 0xb1, 0xff, 0x9f, 0xfa, 0xdc, 0xb3, 0xff, 0x01, 0xfa, 0xe2, 0xbe, 0xff, 0xfc, 0xec, 0xd9, 0x37, 0x96, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xee, 0xd7, 0x64, 0xfb, 
+  0xe6, 0xca, 0xe4, 0xf9, 0xe0, 0xbb, 0xff, 0xf9, 0xde, 0xb7, 0xff, 0xf9, 0xdd, 0xb5, 0xff, 0xf9, 0xdd, 0xb4, 0xff, 0xa0, 0xf9, 0xdd, 0xb5, 0xff, 0x01, 0xf9, 0xdd, 0xb4, 0xff, 0xfb, 0xe6, 0xc8, 
+  0xa8, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xed, 0xd5, 0x78, 0xf9, 0xe4, 0xc3, 0xff, 0xa6, 0xf8, 0xde, 0xb6, 0xff, 0x01, 0xf8, 0xe1, 0xbc, 0xe7, 0xfb, 0xef, 0xd8, 0x13, 0x93, 0x00, 0x00, 
+  0x00, 0x00, 0x02, 0xfb, 0xed, 0xd6, 0x4b, 0xf8, 0xe2, 0xc1, 0xf7, 0xf7, 0xdf, 0xb8, 0xff, 0x95, 0xf7, 0xdf, 0xb9, 0xff, 0x09, 0xf7, 0xdf, 0xb8, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0xf9, 0xe2, 0xbf, 
+  0xff, 0xfb, 0xe5, 0xc5, 0xff, 0xfd, 0xe7, 0xca, 0xff, 0xfd, 0xe8, 0xcb, 0xff, 0xfd, 0xe7, 0xc9, 0xff, 0xfb, 0xe5, 0xc5, 0xff, 0xf9, 0xe2, 0xbf, 0xff, 0xf7, 0xdf, 0xb8, 0xff, 0x86, 0xf7, 0xdf, 
+  0xb9, 0xff, 0x01, 0xf7, 0xe0, 0xbb, 0xf4, 0xf9, 0xe6, 0xca, 0x23, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xe8, 0xcb, 0xcc, 0xf6, 0xe0, 0xbb, 0xff, 0x95, 0xf6, 0xe0, 0xba, 0xff, 0x0c, 0xf6, 
+  0xe1, 0xbb, 0xff, 0xf8, 0xe3, 0xc1, 0xff, 0xfd, 0xe4, 0xc5, 0xff, 0xff, 0xe0, 0xbd, 0xff, 0xff, 0xda, 0xb1, 0xff, 0xff, 0xd6, 0xaa, 0xff, 0xff, 0xd4, 0xa7, 0xff, 0xff, 0xd6, 0xaa, 0xff, 0xff, 
+  0xda, 0xb2, 0xff, 0xff, 0xe0, 0xbd, 0xff, 0xfd, 0xe4, 0xc5, 0xff, 0xf9, 0xe3, 0xc0, 0xff, 0xf6, 0xe1, 0xbb, 0xff, 0x84, 0xf6, 0xe0, 0xba, 0xff, 0x01, 0xf6, 0xe1, 0xbc, 0xff, 0xf7, 0xe4, 0xc2, 
+  0x2f, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfa, 0xf2, 0xdb, 0x48, 0xf5, 0xe3, 0xbe, 0xff, 0x95, 0xf5, 0xe2, 0xbc, 0xff, 0x03, 0xf6, 0xe3, 0xbe, 0xff, 0xfc, 0xe5, 0xc6, 0xff, 0xfe, 0xdc, 0xb4, 
+  0xff, 0xfe, 0xd7, 0xab, 0xff, 0x81, 0xfe, 0xd6, 0xa8, 0xff, 0x82, 0xfe, 0xd6, 0xa9, 0xff, 0x05, 0xfe, 0xd6, 0xa8, 0xff, 0xfe, 0xd5, 0xa8, 0xff, 0xfe, 0xd7, 0xab, 0xff, 0xfe, 0xdb, 0xb4, 0xff, 
+  0xfb, 0xe6, 0xc5, 0xff, 0xf5, 0xe2, 0xbe, 0xff, 0x84, 0xf5, 0xe2, 0xbc, 0xff, 0x00, 0xf5, 0xe2, 0xbd, 0x33, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xe9, 0xcd, 0x8f, 0xf5, 0xe2, 0xbc, 0xff, 
+  0x94, 0xf5, 0xe2, 0xbd, 0xff, 0x02, 0xf6, 0xe3, 0xbf, 0xff, 0xfc, 0xe4, 0xc4, 0xff, 0xfe, 0xd8, 0xad, 0xff, 0x8a, 0xfe, 0xd6, 0xaa, 0xff, 0x07, 0xfe, 0xd7, 0xae, 0xff, 0xfc, 0xe4, 0xc4, 0xff, 
+  0xf7, 0xe4, 0xc1, 0xff, 0xf7, 0xe4, 0xc2, 0xff, 0xf8, 0xe4, 0xc4, 0xff, 0xf8, 0xe4, 0xc3, 0xff, 0xf7, 0xe4, 0xc1, 0xff, 0xf8, 0xe6, 0xc7, 0x3b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf5, 0xe6, 
+  0xc5, 0xbf, 0xf4, 0xe4, 0xbf, 0xff, 0x93, 0xf4, 0xe4, 0xc0, 0xff, 0x02, 0xf4, 0xe3, 0xbf, 0xff, 0xfb, 0xe5, 0xc5, 0xff, 0xfd, 0xd9, 0xae, 0xff, 0x8c, 0xfd, 0xd8, 0xac, 0xff, 0x08, 0xfd, 0xd9, 
+  0xae, 0xff, 0xfd, 0xdf, 0xba, 0xff, 0xfd, 0xdd, 0xb7, 0xff, 0xfd, 0xdb, 0xb3, 0xff, 0xfd, 0xdc, 0xb4, 0xff, 0xfd, 0xe0, 0xba, 0xff, 0xfe, 0xe4, 0xc4, 0xeb, 0xfe, 0xeb, 0xd0, 0x97, 0xff, 0xec, 
+  0xd5, 0x14, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe5, 0xc2, 0xbf, 0x94, 0xf3, 0xe4, 0xc1, 0xff, 0x01, 0xf7, 0xe7, 0xc7, 0xff, 0xfc, 0xdb, 0xb2, 0xff, 0x93, 0xfc, 0xd8, 0xad, 0xff, 0x03, 
+  0xfc, 0xd7, 0xab, 0xff, 0xfc, 0xdb, 0xb4, 0xff, 0xfd, 0xe5, 0xc7, 0xe0, 0xfe, 0xeb, 0xd0, 0x40, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xe8, 0xc6, 0x8f, 0x93, 0xf2, 0xe6, 0xc3, 0xff, 0x02, 
+  0xf3, 0xe6, 0xc4, 0xff, 0xfa, 0xe0, 0xbd, 0xff, 0xfb, 0xd9, 0xaf, 0xff, 0x94, 0xfb, 0xda, 0xb0, 0xff, 0x03, 0xfb, 0xda, 0xaf, 0xff, 0xfb, 0xda, 0xb0, 0xff, 0xfc, 0xe2, 0xbf, 0xec, 0xff, 0xea, 
+  0xd4, 0x3c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xec, 0xcf, 0x48, 0x91, 0xf2, 0xe6, 0xc4, 0xff, 0x03, 0xf3, 0xe7, 0xc6, 0xff, 0xf3, 0xe7, 0xc7, 0xff, 0xf5, 0xe7, 0xc7, 0xff, 0xfa, 0xdd, 
+  0xb4, 0xff, 0x98, 0xfa, 0xdb, 0xb1, 0xff, 0x01, 0xfb, 0xe5, 0xc4, 0xdc, 0xff, 0xf0, 0xe1, 0x0b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xe8, 0xc7, 0xcc, 0x8e, 0xf1, 0xe7, 0xc6, 0xff, 0x04, 
+  0xf1, 0xe7, 0xc7, 0xff, 0xf8, 0xeb, 0xcf, 0xff, 0xfa, 0xe8, 0xcb, 0xff, 0xfa, 0xe5, 0xc5, 0xff, 0xfa, 0xe1, 0xc0, 0xff, 0x98, 0xf9, 0xdc, 0xb4, 0xff, 0x02, 0xf9, 0xdc, 0xb3, 0xff, 0xf9, 0xdc, 
+  0xb4, 0xff, 0xfc, 0xe9, 0xcd, 0x88, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf2, 0xea, 0xcd, 0x4b, 0xf1, 0xe8, 0xc6, 0xf7, 0x8c, 0xf1, 0xe8, 0xc6, 0xff, 0x02, 0xf2, 0xe9, 0xc9, 0xff, 0xfa, 0xe9, 
+  0xcd, 0xff, 0xfa, 0xe0, 0xbc, 0xff, 0x81, 0xf9, 0xdd, 0xb4, 0xff, 0x9b, 0xf9, 0xdd, 0xb5, 0xff, 0x01, 0xfa, 0xe1, 0xbe, 0xe0, 0xfc, 0xee, 0xdb, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 
+  0xe9, 0xc8, 0x78, 0x8b, 0xf0, 0xe9, 0xc8, 0xff, 0x02, 0xf1, 0xe9, 0xca, 0xff, 0xf8, 0xe7, 0xc9, 0xff, 0xf7, 0xdf, 0xb9, 0xff, 0x9e, 0xf7, 0xdf, 0xb8, 0xff, 0x01, 0xf8, 0xe0, 0xbb, 0xf4, 0xfb, 
+  0xe9, 0xcb, 0x23, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf1, 0xe9, 0xca, 0x64, 0xf0, 0xe9, 0xc9, 0xe4, 0x89, 0xf0, 0xe9, 0xc9, 0xff, 0x02, 0xf5, 0xea, 0xcd, 0xff, 0xf7, 0xe1, 0xbb, 0xff, 0xf7, 
+  0xe0, 0xba, 0xff, 0x9e, 0xf7, 0xe0, 0xb9, 0xff, 0x01, 0xf7, 0xe1, 0xbb, 0xff, 0xf8, 0xe4, 0xc1, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xed, 0xe8, 0xc9, 0x14, 0xf0, 0xeb, 0xcb, 0x70, 0xef, 
+  0xea, 0xca, 0xc0, 0xee, 0xea, 0xca, 0xf7, 0x86, 0xef, 0xea, 0xca, 0xff, 0x01, 0xf6, 0xe7, 0xc7, 0xff, 0xf5, 0xe2, 0xbb, 0xff, 0xa0, 0xf5, 0xe2, 0xbc, 0xff, 0x00, 0xf5, 0xe3, 0xbd, 0x30, 0x9b, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xe3, 0xc1, 0xff, 0xa0, 0xf5, 0xe2, 0xbe, 0xff, 0x01, 0xf5, 0xe2, 0xbf, 0xf8, 0xf5, 0xe4, 0xc1, 0x27, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xf4, 0xe4, 0xc0, 
+  0xff, 0x01, 0xf4, 0xe4, 0xc1, 0xeb, 0xf6, 0xea, 0xcb, 0x17, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xf3, 0xe5, 0xc2, 0xff, 0x01, 0xf3, 0xe5, 0xc5, 0xb3, 0xf5, 0xf2, 0xfa, 0x03, 0x9b, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xf3, 0xe7, 0xc7, 0xcb, 0x9f, 0xf2, 0xe6, 0xc4, 0xff, 0x01, 0xf1, 0xe6, 0xc4, 0xff, 0xf5, 0xea, 0xcd, 0x30, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf2, 0xe9, 0xcb, 0x53, 0xf1, 
+  0xe7, 0xc5, 0xfc, 0x9e, 0xf1, 0xe7, 0xc5, 0xff, 0x00, 0xf1, 0xe8, 0xc8, 0x77, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf9, 0xe9, 0xd8, 0x07, 0xf1, 0xe8, 0xc7, 0xa8, 0x9d, 0xf0, 0xe8, 0xc7, 0xff, 
+  0x01, 0xf0, 0xe8, 0xc6, 0x88, 0xf0, 0xf0, 0xd3, 0x07, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf1, 0xe9, 0xc9, 0x97, 0xf0, 0xe9, 0xc8, 0xf3, 0x98, 0xf0, 0xe9, 0xc8, 0xff, 0x02, 0xf0, 0xe9, 0xc8, 
+  0xfc, 0xf0, 0xe9, 0xc8, 0xdc, 0xef, 0xe9, 0xc9, 0x5b, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xef, 0xe9, 0xcc, 0x3f, 0xf0, 0xe9, 0xca, 0xa4, 0xef, 0xea, 0xca, 0xe4, 0xef, 0xea, 0xca, 0xfc, 0x93, 
+  0xef, 0xea, 0xca, 0xfb, 0x03, 0xef, 0xe9, 0xca, 0xe8, 0xef, 0xeb, 0xca, 0xb7, 0xf0, 0xea, 0xcb, 0x64, 0xf5, 0xee, 0xcd, 0x13, 0x95, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0x2c, 0xfe, 
+  0xd4, 0xaa, 0x08, 0xfd, 0xd7, 0xaa, 0x1c, 0xfd, 0xd6, 0xac, 0x18, 0xfe, 0xd7, 0xab, 0x24, 0xba, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfc, 0xd6, 0xab, 0xa8, 0xfd, 0xd7, 0xab, 0xd3, 0xfe, 0xd8, 0xaa, 
+  0x50, 0xfd, 0xd7, 0xab, 0xf7, 0xfd, 0xd7, 0xac, 0xa7, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0xd7, 0xab, 0x43, 0xfd, 0xd7, 0xab, 0xd0, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xda, 0xa9, 0x0c, 0xfe, 
+  0xd7, 0xab, 0xd3, 0xfd, 0xd7, 0xab, 0xd8, 0xfd, 0xd6, 0xac, 0x7c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0x2c, 0xfc, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xaa, 0x18, 0xfd, 0xd7, 0xaa, 
+  0x13, 0xfe, 0xd7, 0xab, 0x20, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0xd8, 0xab, 0x88, 0xfd, 0xd6, 0xab, 0x1c, 0xfd, 0xd7, 0xab, 0x34, 0xfd, 0xd7, 0xab, 0xd3, 0xfd, 0xd6, 0xac, 0x7c, 0x00, 
+  0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xcb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfc, 0xd6, 0xab, 0xdb, 0xfd, 0xd8, 0xab, 0xe0, 0xfe, 0xd7, 0xaa, 0x54, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xac, 
+  0x6c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 0xd7, 0xab, 0x94, 0xfd, 0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe8, 0xfd, 
+  0xd7, 0xab, 0xe0, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x98, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd6, 0xaf, 0x03, 0xfd, 0xd7, 0xab, 0xab, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xaa, 
+  0x98, 0xff, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xab, 0xcb, 0xfd, 0xd7, 0xac, 0x2c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd7, 0xab, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xfd, 
+  0xd7, 0xaa, 0x78, 0xfe, 0xd8, 0xab, 0x73, 0xfd, 0xd7, 0xab, 0xc7, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd6, 0xac, 0xa0, 0xfc, 0xd9, 0xa8, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xda, 0xa9, 
+  0x07, 0xfd, 0xd7, 0xab, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xb3, 0xfd, 0xd7, 0xab, 0xc3, 0xfe, 0xd4, 0xac, 0x14, 0xfe, 0xd7, 0xab, 0x44, 0xfd, 0xd6, 0xab, 0x4f, 0xa1, 0x00, 0x00, 
+  0x00, 0x00, 0x06, 0xfd, 0xd7, 0xab, 0x1f, 0xfd, 0xd7, 0xab, 0xfb, 0xfd, 0xd7, 0xab, 0xf0, 0xfd, 0xdb, 0xa8, 0x08, 0xfe, 0xd7, 0xab, 0xdc, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x5b, 0x86, 
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0xe7, 0xfc, 0xd7, 0xab, 0xc3, 0xfd, 0xd7, 0xaa, 0x73, 0xfd, 0xd7, 0xab, 0x94, 0xfe, 0xd7, 0xab, 0x97, 0x82, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 
+  0xd7, 0xab, 0xd4, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdf, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd7, 0xab, 0xef, 0xfd, 
+  0xd6, 0xac, 0x5c, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xd6, 0xab, 0x6c, 0xfd, 0xd7, 0xaa, 0x80, 0xfd, 0xd7, 0xac, 0xaf, 0xfe, 0xd7, 0xab, 0xbf, 0x86, 0x00, 0x00, 
+  0x00, 0x00, 0x06, 0xfd, 0xd7, 0xab, 0x97, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd8, 0xab, 0x9c, 0xfe, 0xd7, 0xab, 0x1f, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd5, 0xad, 0x13, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd6, 0xac, 0x18, 0xfc, 0xd7, 0xab, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xd0, 0xfe, 0xd8, 0xab, 0x77, 0xfe, 0xd5, 0xab, 0x43, 0xfe, 0xd6, 0xac, 
+  0x18, 0xfd, 0xd7, 0xab, 0x63, 0xad, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd7, 0xac, 0x18, 0xfc, 0xd8, 0xab, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 0xd0, 0xfe, 0xd8, 0xab, 0x77, 0xfe, 
+  0xd5, 0xab, 0x43, 0xfe, 0xd6, 0xac, 0x18, 0xfd, 0xd7, 0xab, 0x63, 0x82, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0xd7, 0xab, 0x97, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd8, 0xab, 0x9c, 0xfe, 0xd7, 0xab, 
+  0x1f, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xe0, 0xfd, 0xd5, 0xad, 0x13, 0xad, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 0xd7, 0xab, 0xd4, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdb, 0xfd, 
+  0xd7, 0xab, 0xf3, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xab, 0xdf, 0xfd, 0xd7, 0xab, 0xec, 0xfd, 0xd7, 0xab, 0xef, 0xfd, 0xd6, 0xac, 0x5c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 
+  0xe7, 0xfc, 0xd7, 0xab, 0xc3, 0xfd, 0xd7, 0xaa, 0x73, 0xfd, 0xd7, 0xab, 0x97, 0xfe, 0xd7, 0xab, 0x97, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0xab, 0xfe, 0xd4, 0xaa, 0x28, 0xfd, 
+  0xd7, 0xaa, 0x6f, 0xfd, 0xd6, 0xac, 0x64, 0xfe, 0xd7, 0xab, 0x93, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd9, 0xa9, 0x07, 0xfd, 0xd7, 0xab, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0xab, 
+  0xb3, 0xfd, 0xd7, 0xab, 0xc3, 0xfe, 0xd4, 0xac, 0x14, 0xfe, 0xd7, 0xab, 0x44, 0xfd, 0xd6, 0xab, 0x4f, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xd5, 0xaa, 0x0b, 0xfc, 0xd6, 0xab, 0xb7, 0xfd, 
+  0xd7, 0xab, 0xff, 0xfe, 0xd9, 0xaa, 0x28, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0xbf, 0xfe, 0xd8, 0xab, 0x1f, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd2, 0xb0, 0x03, 0xfd, 0xd7, 0xab, 
+  0xab, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xaa, 0x98, 0xff, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xd7, 0xfd, 0xd7, 0xab, 0xcb, 0xfd, 0xd7, 0xac, 0x2c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 
+  0xd7, 0xac, 0x7b, 0xfd, 0xd7, 0xab, 0x38, 0xfd, 0xd7, 0xaa, 0xaf, 0xff, 0xd9, 0xaa, 0x30, 0xfd, 0xd7, 0xab, 0xe3, 0xfd, 0xd7, 0xab, 0x33, 0xfd, 0xd6, 0xac, 0x84, 0xfc, 0xd9, 0xa9, 0x0b, 0xa2, 
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xe1, 0xa2, 0x03, 0xfc, 0xd6, 0xab, 0xdb, 0xfd, 0xd8, 0xab, 0xe0, 0xfe, 0xd7, 0xaa, 0x54, 0xfd, 0xd7, 0xab, 0xe7, 0xfd, 0xd7, 0xac, 0x6c, 0x8d, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0xfd, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xab, 0xa8, 0xfd, 0xd7, 0xab, 0x6b, 0xfd, 0xd7, 0xab, 0x58, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x88, 0xfe, 0xd7, 0xab, 0x4f, 0xfd, 
+  0xd7, 0xab, 0xeb, 0xfd, 0xd6, 0xac, 0x28, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0x2c, 0xfc, 0xd7, 0xab, 0x20, 0xfd, 0xd7, 0xaa, 0x18, 0xfd, 0xd8, 0xaa, 0x14, 0xfe, 0xd7, 0xab, 
+  0x20, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfd, 0xd7, 0xab, 0x20, 0xfd, 0xd8, 0xab, 0xa8, 0xfd, 0xd7, 0xab, 0x6b, 0xfd, 0xd7, 0xab, 0x58, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd6, 0xac, 0x88, 0xfe, 
+  0xd7, 0xab, 0x4f, 0xfd, 0xd7, 0xab, 0xeb, 0xfd, 0xd6, 0xac, 0x28, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xd6, 0xac, 0x78, 0xfd, 0xd7, 0xab, 0x38, 0xfd, 0xd7, 0xaa, 0xaf, 0xff, 0xd9, 0xaa, 
+  0x30, 0xfd, 0xd7, 0xab, 0xe3, 0xfd, 0xd7, 0xab, 0x33, 0xfd, 0xd6, 0xac, 0x84, 0xfc, 0xd9, 0xa9, 0x0b, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xd8, 0xaa, 0x0b, 0xfc, 0xd6, 0xab, 0xb7, 0xfd, 
+  0xd7, 0xab, 0xff, 0xfe, 0xd9, 0xaa, 0x28, 0xfd, 0xd7, 0xab, 0xff, 0xfd, 0xd7, 0xac, 0xbf, 0xfe, 0xd8, 0xab, 0x1f, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xd7, 0xab, 0xab, 0xfe, 0xd4, 0xaa, 
+  0x28, 0xfd, 0xd7, 0xaa, 0x6f, 0xfd, 0xd6, 0xac, 0x64, 0xfe, 0xd7, 0xab, 0x93, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 
+  0x00, 
 #endif
 };
 
@@ -282,8 +272,7 @@ const lv_img_dsc_t owm_13n_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_13n_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_13n_64px_map,
 };
-
@@ -10,271 +10,577 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_50D_64PX uint8_t owm_50d_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x23, 0xfc, 0x3c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x20, 0xfc, 0xd4, 0xfc, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0x84, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x23, 0xfc, 0x0b, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x7b, 0xfc, 0xff, 0xfc, 0x38, 0xfc, 0x00, 0xfc, 0xa7, 0xfc, 0xff, 0xfc, 0x84, 0xfc, 0x00, 0xfc, 0x58, 0xfc, 0xff, 0xfc, 0x5c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x2f, 0xfc, 0x20, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x6f, 0xfc, 0xef, 0xfc, 0x2b, 0xfc, 0x00, 0xfc, 0xe7, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0x58, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xeb, 0xfc, 0x58, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xc7, 0xfc, 0x00, 0xfc, 0x4b, 0xfc, 0xff, 0xfc, 0x4f, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x14, 0xfc, 0x13, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x97, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x9b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0xb8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x78, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x3f, 0xfc, 0x0c, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x2f, 0xfc, 0xff, 0xfc, 0x8c, 0xfc, 0x17, 0xfc, 0xc0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xab, 0xfc, 0x24, 0xfc, 0xac, 0xfc, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x27, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x63, 0xfc, 0x38, 0xfc, 0x1b, 0xfc, 0x27, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xef, 0xf8, 0x00, 0xfc, 0x1f, 0xfc, 0x43, 0xfc, 0x30, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x8b, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xdc, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0xd7, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0x30, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x2c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xe7, 0xfc, 0x14, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0xfc, 0x1c, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xc7, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x1c, 0xfc, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x3c, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x03, 0xfc, 0xd3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x84, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x47, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0x14, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x37, 0xfc, 0x70, 0xfc, 0xa7, 0xfc, 0xc7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xc4, 0xfc, 0x97, 0xfc, 0x6b, 0xfc, 0x2b, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x2f, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0x0c, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x64, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0x30, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xfc, 0xb7, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x9f, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x23, 0xfc, 0x88, 0xfc, 0xd7, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0xd3, 0xfc, 0x74, 0xfc, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04, 0xfc, 0xa0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x63, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x54, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x33, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0xdb, 0x00, 0xfc, 0x00, 0xfc, 0x80, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x3b, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x00, 0xfd, 0x00, 0xfe, 0x18, 0xfd, 0xbc, 0xfd, 0xf8, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0x94, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xdb, 0x07, 0xfc, 0x20, 0xfc, 0xf0, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xd4, 0xfc, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0xdb, 0x17, 0xdb, 0x13, 0xdb, 0x10, 0xfe, 0x30, 0xfd, 0xb0, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x7b, 0xfc, 0x13, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x28, 0xdb, 0x1b, 0xff, 0x1f, 0xff, 0x2c, 0xff, 0x48, 0xfe, 0xb8, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x37, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x13, 0xff, 0x47, 0xff, 0x27, 0xff, 0x1f, 0xdf, 0x27, 0xfe, 0x8b, 0xfd, 0xfb, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf0, 0xfc, 0x3f, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x08, 0xff, 0x33, 0xff, 0x30, 0xff, 0x23, 0xfd, 0x80, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x3b, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x18, 0xff, 0x20, 0xfe, 0x3b, 0xfe, 0x8b, 0xfd, 0xeb, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xc4, 0xfc, 0x58, 0xfc, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x0b, 0xdb, 0x10, 0xff, 0x1b, 0xdb, 0x1c, 0xfd, 0xaf, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0x8c, 0xfc, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x03, 0xff, 0x07, 0xff, 0x0b, 0xdb, 0x0b, 0xfd, 0x7b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xf8, 0xfe, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x07, 0xff, 0x08, 0xff, 0x0b, 0xff, 0x0c, 0xfe, 0x3f, 0xfc, 0xfb, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xf0, 0xfc, 0x08, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x07, 0xdb, 0x10, 0xdb, 0x18, 0xdb, 0x17, 0xfe, 0x2f, 0xfd, 0x6c, 0xfd, 0x8c, 0xfd, 0xb3, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xa7, 0xfc, 0x83, 0xfd, 0x53, 0xfc, 0x13, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xdb, 0x13, 0xff, 0x24, 0xff, 0x2c, 0xff, 0x2c, 0xff, 0x24, 0xdf, 0x24, 0xfe, 0x60, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xec, 0xfe, 0x1b, 0x9b, 0x04, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x04, 0xff, 0x13, 0xff, 0x1c, 0xff, 0x34, 0xff, 0x58, 0xff, 0x5f, 0xff, 0x4f, 0xff, 0x4f, 0xfd, 0xdf, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x83, 0xfc, 0x00, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0xdb, 0x18, 0xff, 0x1c, 0xff, 0x28, 0xff, 0x54, 0xff, 0x67, 0xff, 0x64, 0xff, 0x80, 0xfe, 0xf8, 0xfe, 0xf8, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xec, 0xfc, 0xef, 0xfc, 0xff, 0xfc, 0x08, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x0b, 0xff, 0x20, 0xff, 0x24, 0xff, 0x2f, 0xff, 0x3f, 0xff, 0x43, 0xff, 0x4b, 0xff, 0x5c, 0xff, 0x7c, 0xff, 0x9f, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xd3, 0xfd, 0x1c, 0xfc, 0x1c, 0xfc, 0x28, 0xfc, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x2b, 0xff, 0x33, 0xff, 0x3b, 0xff, 0x40, 0xff, 0x3b, 0xff, 0x34, 0xff, 0x3f, 0xff, 0x54, 0xff, 0x74, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xe7, 0xfd, 0x18, 0xff, 0x03, 0xff, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x20, 0xff, 0x30, 0xff, 0x3c, 0xff, 0x50, 0xff, 0x50, 0xff, 0x40, 0xff, 0x38, 0xff, 0x4b, 0xff, 0x63, 0xfe, 0xc4, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xf3, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xe3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x2c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xdb, 0x03, 0xff, 0x0f, 0xdb, 0x18, 0xff, 0x23, 0xff, 0x43, 0xff, 0x53, 0xff, 0x4b, 0xff, 0x3c, 0xff, 0x37, 0xff, 0x40, 0xfe, 0xa8, 0xfe, 0x9f, 0xff, 0x83, 0xff, 0xa0, 0xfe, 0xf8, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0x9f, 0x0f, 0xfe, 0x37, 0xfd, 0x7f, 0xfc, 0x48, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x08, 0xff, 0x0b, 0xff, 0x0f, 0xff, 0x28, 0xff, 0x38, 0xff, 0x3c, 0xff, 0x2c, 0xff, 0x1f, 0xdb, 0x13, 0xff, 0x28, 0xff, 0x47, 0xff, 0x88, 0xfe, 0xfb, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x1b, 0x07, 0xdf, 0x0f, 0xdf, 0x0c, 0xdf, 0x04, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x03, 0xdb, 0x03, 0xdb, 0x04, 0xdb, 0x0c, 0xff, 0x17, 0xff, 0x20, 0xff, 0x0c, 0xff, 0x07, 0xff, 0x0b, 0xff, 0x1b, 0xff, 0x60, 0xfd, 0xf4, 0xfd, 0xc7, 0xfe, 0x2f, 0xfc, 0xc4, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xa4, 0xfc, 0x3b, 0xfc, 0xcc, 0xfc, 0xff, 0xbf, 0x04, 0xff, 0x00, 0xdb, 0x03, 0xff, 0x07, 0xdb, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x07, 0xff, 0x04, 0xdb, 0x04, 0xff, 0x03, 0xff, 0x08, 0xff, 0x1f, 0xfe, 0x38, 0xff, 0x24, 0xdf, 0x1f, 0xfc, 0xa3, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x8b, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xac, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x7b, 0xfc, 0x00, 0xfd, 0x00, 0xfc, 0x37, 0xfd, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0xdb, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x03, 0xdb, 0x04, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x04, 0xff, 0x07, 0xff, 0x0c, 0xdf, 0x1c, 0xfd, 0x83, 0xfc, 0xf0, 0xfc, 0x43, 0xfc, 0x00, 0xfc, 0xef, 0xfc, 0xff, 0xfc, 0xeb, 0xfc, 0x73, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0x78, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xc8, 0xfc, 0x00, 0xfc, 0x5f, 0xfc, 0xff, 0xfc, 0x50, 0xfc, 0x00, 0xf8, 0x00, 0xfd, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xfd, 0x2b, 0xfe, 0x28, 0x17, 0x00, 0xfc, 0x00, 0xfc, 0x7b, 0xfc, 0xff, 0xfc, 0x33, 0xfc, 0x00, 0xfc, 0xa7, 0xfc, 0xff, 0xfc, 0x8c, 0xf8, 0x00, 0xfc, 0x5b, 0xfc, 0xff, 0xfc, 0x60, 0xf8, 0x00, 0xf8, 0x00, 0xfc, 0x2c, 0xfc, 0x1b, 0xfc, 0x00, 0x00, 0x00, 0xb7, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x08, 0xdb, 0x03, 0xff, 0x00, 0xfc, 0x27, 0xfc, 0x44, 0xf8, 0x00, 0xff, 0x00, 0xfc, 0x1f, 0xfc, 0xdf, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xfc, 0x9f, 0xfc, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x13, 0xfc, 0x00, 0xff, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0xb9, 0x00, 0x00, 0x01, 0xfc, 0x23, 0xfc, 0x3c, 0x81, 0x00, 0x00, 0x01, 0xfc, 
+  0x20, 0xfc, 0xd4, 0x82, 0x00, 0x00, 0x00, 0xfc, 0x84, 0xb1, 0x00, 0x00, 0x01, 0xfc, 0x23, 0xfc, 0x0b, 0x81, 0x00, 0x00, 0x0a, 0xfc, 0x7b, 0xfc, 0xff, 0xfc, 0x38, 0x00, 0x00, 0xfc, 0xa7, 0xfc, 
+  0xff, 0xfc, 0x84, 0x00, 0x00, 0xfc, 0x58, 0xfc, 0xff, 0xfc, 0x5c, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x2f, 0xfc, 0x20, 0xac, 0x00, 0x00, 0x07, 0xfc, 0x6f, 0xfc, 0xef, 0xfc, 0x2b, 0x00, 0x00, 0xfc, 
+  0xe7, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0x58, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xeb, 0xfc, 0x58, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0xc7, 0x00, 0x00, 0xfc, 0x4b, 0xfc, 0xff, 0xfc, 0x4f, 0xa8, 0x00, 0x00, 
+  0x01, 0xfc, 0x14, 0xfc, 0x13, 0x81, 0x00, 0x00, 0x03, 0xfc, 0x97, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x9b, 0x82, 0xfc, 0xff, 0x00, 0xfc, 0xfc, 0x85, 0xfc, 0xff, 0x01, 0xfc, 0xef, 0xfc, 0xb8, 0x81, 
+  0xfc, 0xff, 0x00, 0xfc, 0x78, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x3f, 0xfc, 0x0c, 0xa4, 0x00, 0x00, 0x04, 0xfc, 0x2f, 0xfc, 0xff, 0xfc, 0x8c, 0xfc, 0x17, 0xfc, 0xc0, 0x90, 0xfc, 0xff, 0x03, 0xfc, 
+  0xab, 0xfc, 0x24, 0xfc, 0xac, 0xfc, 0xff, 0xa5, 0x00, 0x00, 0x04, 0xfc, 0x27, 0xfc, 0xf8, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0xf8, 0x90, 0xfc, 0xff, 0x01, 0xfc, 0xf7, 0xfc, 0xfb, 0x81, 0xfc, 0xff, 
+  0xa2, 0x00, 0x00, 0x04, 0xfc, 0x63, 0xfc, 0x38, 0xfc, 0x1b, 0xfc, 0x27, 0xfc, 0xf3, 0x96, 0xfc, 0xff, 0x04, 0xfc, 0xef, 0x00, 0x00, 0xfc, 0x1f, 0xfc, 0x43, 0xfc, 0x30, 0x9e, 0x00, 0x00, 0x04, 
+  0xfc, 0x8b, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xdc, 0xfc, 0xfb, 0x96, 0xfc, 0xff, 0x04, 0xfc, 0xf8, 0xfc, 0xd7, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0x30, 0x9e, 0x00, 0x00, 0x00, 0xfc, 0x2c, 0x9d, 0xfc, 
+  0xff, 0x01, 0xfc, 0xe7, 0xfc, 0x14, 0x9b, 0x00, 0x00, 0x01, 0xfc, 0x10, 0xfc, 0x1c, 0x81, 0x00, 0x00, 0x00, 0xfc, 0xf0, 0x9c, 0xfc, 0xff, 0x00, 0xfc, 0xc7, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x1c, 
+  0xfc, 0x0f, 0x98, 0x00, 0x00, 0x00, 0xfc, 0x3c, 0xa4, 0xfc, 0xff, 0x00, 0xfc, 0x18, 0x98, 0x00, 0x00, 0x01, 0xfc, 0x03, 0xfc, 0xd3, 0xa2, 0xfc, 0xff, 0x00, 0xfc, 0x84, 0x9a, 0x00, 0x00, 0x00, 
+  0xfc, 0x47, 0xa1, 0xfc, 0xff, 0x01, 0xfc, 0xef, 0xfc, 0x14, 0x97, 0x00, 0x00, 0x03, 0xfc, 0x37, 0xfc, 0x70, 0xfc, 0xa7, 0xfc, 0xc7, 0xa1, 0xfc, 0xff, 0x04, 0xfc, 0xf7, 0xfc, 0xc4, 0xfc, 0x97, 
+  0xfc, 0x6b, 0xfc, 0x2b, 0x94, 0x00, 0x00, 0x00, 0xfc, 0x2f, 0xa7, 0xfc, 0xff, 0x01, 0xfc, 0xf7, 0xfc, 0x0c, 0x95, 0x00, 0x00, 0x00, 0xfc, 0x64, 0x96, 0xfc, 0xff, 0x83, 0xfd, 0xff, 0x8a, 0xfc, 
+  0xff, 0x01, 0xfc, 0xf7, 0xfc, 0x30, 0x97, 0x00, 0x00, 0x00, 0xfc, 0xb7, 0x88, 0xfc, 0xff, 0x84, 0xfd, 0xff, 0x88, 0xfc, 0xff, 0x85, 0xfd, 0xff, 0x87, 0xfc, 0xff, 0x00, 0xfc, 0x9f, 0x95, 0x00, 
+  0x00, 0x03, 0xfc, 0x23, 0xfc, 0x88, 0xfc, 0xd7, 0xfc, 0xf3, 0x88, 0xfc, 0xff, 0x81, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x83, 0xfd, 0xff, 0x86, 0xfc, 0xff, 0x81, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x84, 
+  0xfd, 0xff, 0x84, 0xfc, 0xff, 0x03, 0xfc, 0xef, 0xfc, 0xd3, 0xfc, 0x74, 0xfc, 0x0f, 0x91, 0x00, 0x00, 0x01, 0xfc, 0x04, 0xfc, 0xa0, 0x88, 0xfc, 0xff, 0x01, 0xfd, 0xff, 0xfc, 0xff, 0x81, 0xfd, 
+  0xff, 0x85, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x82, 0xfc, 0xff, 0x83, 0xfd, 0xff, 0x84, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x86, 0xfc, 0xff, 0x00, 0xfc, 0x63, 0x93, 0x00, 0x00, 0x00, 0xfc, 0x54, 0x86, 
+  0xfc, 0xff, 0x83, 0xfd, 0xff, 0x88, 0xfe, 0xff, 0x85, 0xfd, 0xff, 0x86, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x85, 0xfc, 0xff, 0x00, 0xfc, 0x33, 0x95, 0x00, 0x00, 0x00, 0xfc, 0x80, 0x85, 0xfc, 0xff, 
+  0x83, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x83, 0xff, 0xff, 0x85, 0xfe, 0xff, 0x83, 0xfd, 0xff, 0x87, 0xfe, 0xff, 0x00, 0xfd, 0xff, 0x83, 0xfc, 0xff, 0x01, 0xfc, 0xf8, 0xfc, 0x3b, 0x94, 0x00, 0x00, 
+  0x03, 0xfe, 0x18, 0xfd, 0xbc, 0xfd, 0xf8, 0xfd, 0xff, 0x83, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x84, 0xfe, 0xff, 0x86, 0xff, 0xff, 0x85, 0xfe, 0xff, 0x00, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0x83, 0xff, 
+  0xff, 0x01, 0xfe, 0xff, 0xfd, 0xff, 0x84, 0xfc, 0xff, 0x01, 0xfc, 0xef, 0xfc, 0x94, 0x90, 0x00, 0x00, 0x03, 0xff, 0x08, 0xdb, 0x07, 0xfc, 0x20, 0xfc, 0xf0, 0x85, 0xfd, 0xff, 0x01, 0xfc, 0xff, 
+  0xfd, 0xff, 0x84, 0xfe, 0xff, 0x8b, 0xff, 0xff, 0x84, 0xfe, 0xff, 0x83, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x84, 0xfc, 0xff, 0x01, 0xfc, 0xd4, 0xfc, 0x04, 0x8d, 0x00, 0x00, 0x05, 
+  0xff, 0x07, 0xdb, 0x17, 0xdb, 0x13, 0xdb, 0x10, 0xfe, 0x30, 0xfd, 0xb0, 0x84, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x92, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x83, 0xff, 0xff, 0x81, 0xfe, 
+  0xff, 0x81, 0xfd, 0xff, 0x82, 0xfc, 0xff, 0x01, 0xfc, 0x7b, 0xfc, 0x13, 0x8e, 0x00, 0x00, 0x06, 0xff, 0x0f, 0xff, 0x28, 0xdb, 0x1b, 0xff, 0x1f, 0xff, 0x2c, 0xff, 0x48, 0xfe, 0xb8, 0x86, 0xfe, 
+  0xff, 0x93, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x83, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x03, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xf8, 0xfc, 0x37, 0x90, 0x00, 0x00, 0x09, 0xdb, 0x13, 0xff, 0x47, 0xff, 0x27, 
+  0xff, 0x1f, 0xdf, 0x27, 0xfe, 0x8b, 0xfd, 0xfb, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x94, 0xff, 0xff, 0x84, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x00, 0xfd, 0xff, 
+  0x81, 0xfc, 0xff, 0x01, 0xfc, 0xf0, 0xfc, 0x3f, 0x8f, 0x00, 0x00, 0x04, 0xff, 0x08, 0xff, 0x33, 0xff, 0x30, 0xff, 0x23, 0xfd, 0x80, 0x83, 0xfd, 0xff, 0x84, 0xfe, 0xff, 0x94, 0xff, 0xff, 0x84, 
+  0xfe, 0xff, 0x00, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x00, 0xfd, 0xff, 0x83, 0xfc, 0xff, 0x00, 0xfc, 0x3b, 0x8f, 0x00, 0x00, 0x05, 0xff, 0x0b, 0xff, 0x18, 0xff, 0x20, 0xfe, 0x3b, 0xfe, 0x8b, 0xfd, 
+  0xeb, 0x82, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0x95, 0xff, 0xff, 0x87, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x03, 0xfc, 0xff, 0xfc, 0xc4, 0xfc, 0x58, 0xfc, 0x18, 0x90, 0x00, 0x00, 0x05, 0xff, 0x04, 0xff, 
+  0x0b, 0xdb, 0x10, 0xff, 0x1b, 0xdb, 0x1c, 0xfd, 0xaf, 0x83, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x95, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0x01, 0xfd, 0xff, 0xfd, 0x8c, 
+  0x93, 0x00, 0x00, 0x04, 0xdb, 0x03, 0xff, 0x07, 0xff, 0x0b, 0xdb, 0x0b, 0xfd, 0x7b, 0x82, 0xfc, 0xff, 0x82, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x8f, 0xff, 0xff, 0x87, 0xfe, 0xff, 0x85, 0xfd, 0xff, 
+  0x01, 0xfd, 0xf8, 0xfe, 0x40, 0x91, 0x00, 0x00, 0x05, 0xdb, 0x07, 0xff, 0x08, 0xff, 0x0b, 0xff, 0x0c, 0xfe, 0x3f, 0xfc, 0xfb, 0x82, 0xfc, 0xff, 0x82, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x8e, 0xff, 
+  0xff, 0x87, 0xfe, 0xff, 0x87, 0xfd, 0xff, 0x01, 0xfd, 0xf0, 0xfc, 0x08, 0x90, 0x00, 0x00, 0x07, 0xdb, 0x07, 0xdb, 0x10, 0xdb, 0x18, 0xdb, 0x17, 0xfe, 0x2f, 0xfd, 0x6c, 0xfd, 0x8c, 0xfd, 0xb3, 
+  0x83, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x8e, 0xff, 0xff, 0x85, 0xfe, 0xff, 0x83, 0xfd, 0xff, 0x82, 0xfc, 0xff, 0x04, 0xfc, 0xf3, 0xfc, 0xa7, 0xfc, 0x83, 0xfd, 0x53, 0xfc, 0x13, 0x90, 0x00, 0x00, 
+  0x02, 0xff, 0x07, 0xdb, 0x13, 0xff, 0x24, 0x81, 0xff, 0x2c, 0x02, 0xff, 0x24, 0xdf, 0x24, 0xfe, 0x60, 0x82, 0xfd, 0xff, 0x81, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0x88, 0xfe, 0xff, 0x82, 0xfd, 0xff, 
+  0x82, 0xfc, 0xff, 0x02, 0xfc, 0xec, 0xfe, 0x1b, 0x9b, 0x04, 0x91, 0x00, 0x00, 0x05, 0xdb, 0x04, 0xff, 0x13, 0xff, 0x1c, 0xff, 0x34, 0xff, 0x58, 0xff, 0x5f, 0x81, 0xff, 0x4f, 0x00, 0xfd, 0xdf, 
+  0x82, 0xfe, 0xff, 0x88, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x85, 0xff, 0xff, 0x88, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x83, 0xfc, 0xff, 0x02, 0xfc, 0x83, 0x00, 0x00, 0xff, 0x03, 0x90, 0x00, 0x00, 0x07, 
+  0xff, 0x07, 0xdb, 0x18, 0xff, 0x1c, 0xff, 0x28, 0xff, 0x54, 0xff, 0x67, 0xff, 0x64, 0xff, 0x80, 0x81, 0xfe, 0xf8, 0x01, 0xff, 0xfb, 0xff, 0xfc, 0x88, 0xff, 0xff, 0x02, 0xfe, 0xff, 0xfd, 0xff, 
+  0xfe, 0xff, 0x85, 0xff, 0xff, 0x88, 0xfe, 0xff, 0x06, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xf7, 0xfc, 0xec, 0xfc, 0xef, 0xfc, 0xff, 0xfc, 0x08, 0x91, 0x00, 0x00, 0x0a, 0xdb, 0x0b, 0xff, 0x20, 0xff, 
+  0x24, 0xff, 0x2f, 0xff, 0x3f, 0xff, 0x43, 0xff, 0x4b, 0xff, 0x5c, 0xff, 0x7c, 0xff, 0x9f, 0xff, 0xc7, 0x89, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xff, 0x81, 
+  0xfe, 0xff, 0x00, 0xff, 0xff, 0x89, 0xfe, 0xff, 0x06, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xd3, 0xfd, 0x1c, 0xfc, 0x1c, 0xfc, 0x28, 0xfc, 0x0f, 0x91, 0x00, 0x00, 0x0a, 0xff, 0x0c, 0xff, 0x2b, 0xff, 
+  0x33, 0xff, 0x3b, 0xff, 0x40, 0xff, 0x3b, 0xff, 0x34, 0xff, 0x3f, 0xff, 0x54, 0xff, 0x74, 0xff, 0xbb, 0x84, 0xff, 0xff, 0x85, 0xfe, 0xff, 0x02, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x81, 0xfe, 
+  0xff, 0x00, 0xfd, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xfd, 0xff, 0x83, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x03, 0xfc, 0xff, 0xfc, 0xe7, 0xfd, 0x18, 0xff, 0x03, 0x93, 0x00, 0x00, 0x03, 0xff, 0x07, 0xff, 
+  0x20, 0xff, 0x30, 0xff, 0x3c, 0x81, 0xff, 0x50, 0x04, 0xff, 0x40, 0xff, 0x38, 0xff, 0x4b, 0xff, 0x63, 0xfe, 0xc4, 0x81, 0xfe, 0xff, 0x01, 0xfe, 0xf3, 0xfe, 0xfc, 0x86, 0xfe, 0xff, 0x86, 0xfd, 
+  0xff, 0x81, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x00, 0xfe, 0xff, 0x82, 0xfd, 0xff, 0x01, 0xfd, 0xf7, 0xfd, 0xe3, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0x2c, 0x94, 0x00, 0x00, 0x0e, 0xdb, 0x03, 0xff, 0x0f, 
+  0xdb, 0x18, 0xff, 0x23, 0xff, 0x43, 0xff, 0x53, 0xff, 0x4b, 0xff, 0x3c, 0xff, 0x37, 0xff, 0x40, 0xfe, 0xa8, 0xfe, 0x9f, 0xff, 0x83, 0xff, 0xa0, 0xfe, 0xf8, 0x83, 0xfd, 0xff, 0x82, 0xfe, 0xff, 
+  0x82, 0xfd, 0xff, 0x83, 0xfc, 0xff, 0x82, 0xfd, 0xff, 0x00, 0xfc, 0xff, 0x81, 0xfd, 0xff, 0x82, 0xfc, 0xff, 0x04, 0xfc, 0xf3, 0x9f, 0x0f, 0xfe, 0x37, 0xfd, 0x7f, 0xfc, 0x48, 0x95, 0x00, 0x00, 
+  0x10, 0xff, 0x03, 0xff, 0x08, 0xff, 0x0b, 0xff, 0x0f, 0xff, 0x28, 0xff, 0x38, 0xff, 0x3c, 0xff, 0x2c, 0xff, 0x1f, 0xdb, 0x13, 0xff, 0x28, 0xff, 0x47, 0xff, 0x88, 0xfe, 0xfb, 0xfd, 0xff, 0xfc, 
+  0xff, 0xfd, 0xfb, 0x87, 0xfd, 0xff, 0x83, 0xfc, 0xff, 0x81, 0xfd, 0xff, 0x86, 0xfc, 0xff, 0x03, 0x1b, 0x07, 0xdf, 0x0f, 0xdf, 0x0c, 0xdf, 0x04, 0x97, 0x00, 0x00, 0x81, 0xdb, 0x03, 0x0c, 0xdb, 
+  0x04, 0xdb, 0x0c, 0xff, 0x17, 0xff, 0x20, 0xff, 0x0c, 0xff, 0x07, 0xff, 0x0b, 0xff, 0x1b, 0xff, 0x60, 0xfd, 0xf4, 0xfd, 0xc7, 0xfe, 0x2f, 0xfc, 0xc4, 0x81, 0xfc, 0xff, 0x85, 0xfd, 0xff, 0x88, 
+  0xfc, 0xff, 0x08, 0xfc, 0xa4, 0xfc, 0x3b, 0xfc, 0xcc, 0xfc, 0xff, 0xbf, 0x04, 0x00, 0x00, 0xdb, 0x03, 0xff, 0x07, 0xdb, 0x03, 0x97, 0x00, 0x00, 0x82, 0xff, 0x03, 0x0a, 0xdb, 0x04, 0xff, 0x07, 
+  0xff, 0x04, 0xdb, 0x04, 0xff, 0x03, 0xff, 0x08, 0xff, 0x1f, 0xfe, 0x38, 0xff, 0x24, 0xdf, 0x1f, 0xfc, 0xa3, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0x8b, 0x83, 0xfc, 0xff, 0x00, 0xfd, 0xff, 0x84, 0xfc, 
+  0xff, 0x01, 0xfc, 0xec, 0xfc, 0xac, 0x81, 0xfc, 0xff, 0x00, 0xfc, 0x7b, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x37, 0xfd, 0x08, 0x9b, 0x00, 0x00, 0x01, 0xff, 0x03, 0x00, 0x00, 0x81, 0xff, 0x03, 0x01, 
+  0xdb, 0x03, 0xdb, 0x04, 0x81, 0xff, 0x03, 0x0c, 0xdb, 0x04, 0xff, 0x04, 0xff, 0x07, 0xff, 0x0c, 0xdf, 0x1c, 0xfd, 0x83, 0xfc, 0xf0, 0xfc, 0x43, 0x00, 0x00, 0xfc, 0xef, 0xfc, 0xff, 0xfc, 0xeb, 
+  0xfc, 0x73, 0x81, 0xfc, 0xff, 0x01, 0xfc, 0xec, 0xfc, 0x78, 0x81, 0xfc, 0xff, 0x04, 0xfc, 0xc8, 0x00, 0x00, 0xfc, 0x5f, 0xfc, 0xff, 0xfc, 0x50, 0xa2, 0x00, 0x00, 0x82, 0xff, 0x03, 0x00, 0xdb, 
+  0x04, 0x81, 0xff, 0x03, 0x00, 0xdb, 0x04, 0x81, 0xff, 0x03, 0x02, 0xdb, 0x04, 0xfd, 0x2b, 0xfe, 0x28, 0x81, 0x00, 0x00, 0x0a, 0xfc, 0x7b, 0xfc, 0xff, 0xfc, 0x33, 0x00, 0x00, 0xfc, 0xa7, 0xfc, 
+  0xff, 0xfc, 0x8c, 0x00, 0x00, 0xfc, 0x5b, 0xfc, 0xff, 0xfc, 0x60, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x2c, 0xfc, 0x1b, 0xa5, 0x00, 0x00, 0x83, 0xff, 0x03, 0x00, 0x00, 0x00, 0x81, 0xff, 0x03, 0x05, 
+  0xdb, 0x04, 0xff, 0x08, 0xdb, 0x03, 0x00, 0x00, 0xfc, 0x27, 0xfc, 0x44, 0x81, 0x00, 0x00, 0x01, 0xfc, 0x1f, 0xfc, 0xdf, 0x82, 0x00, 0x00, 0x00, 0xfc, 0x9f, 0xb1, 0x00, 0x00, 0x82, 0xff, 0x03, 
+  0x85, 0x00, 0x00, 0x00, 0xfc, 0x13, 0xb7, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe4, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x40, 0xff, 0x0f, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x40, 0xff, 0x23, 0x60, 0xff, 0x3c, 0x60, 0xff, 0x00, 0xa0, 0xff, 0x00, 0x40, 0xff, 0x20, 0x20, 0xff, 0xd4, 0xe0, 0xfe, 0x00, 0x80, 0xff, 0x00, 0x81, 0xfe, 0x00, 0x40, 0xff, 0x84, 0xe0, 0xff, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x23, 0x80, 0xff, 0x0b, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x81, 0xff, 0x38, 0x61, 0xff, 0x00, 0x20, 0xff, 0xa7, 0xc0, 0xfe, 0xff, 0x60, 0xff, 0x84, 0x40, 0xff, 0x00, 0x40, 0xff, 0x58, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x5c, 0x20, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x2f, 0x60, 0xff, 0x20, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x00, 0x40, 0xff, 0x00, 0x20, 0xff, 0x6f, 0x20, 0xff, 0xef, 0x60, 0xff, 0x2b, 0x00, 0xff, 0x00, 0x00, 0xff, 0xe7, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xef, 0x60, 0xff, 0x58, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xeb, 0x61, 0xff, 0x58, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xc7, 0xa1, 0xfe, 0x00, 0x60, 0xff, 0x4b, 0x00, 0xff, 0xff, 0x20, 0xff, 0x4f, 0x20, 0xff, 0x00, 0xe0, 0xff, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x14, 0xa0, 0xff, 0x13, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0x00, 0xff, 0x97, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xf8, 0x60, 0xff, 0x9b, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xfc, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xef, 0x60, 0xff, 0xb8, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x78, 0x00, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x3f, 0x40, 0xff, 0x0c, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2f, 0x20, 0xff, 0xff, 0x40, 0xff, 0x8c, 0xa1, 0xff, 0x17, 0x00, 0xff, 0xc0, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xab, 0x60, 0xff, 0x24, 0x40, 0xff, 0xac, 0x00, 0xff, 0xff, 0xc0, 0xfe, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x60, 0xff, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xfe, 0x27, 0xc0, 0xfe, 0xf8, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xef, 0xe0, 0xfe, 0xf8, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xf7, 0x00, 0xff, 0xfb, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x00, 0x40, 0xff, 0x63, 0x60, 0xff, 0x38, 0x60, 0xff, 0x1b, 0x00, 0xff, 0x27, 0xc0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xef, 0x40, 0xfe, 0x00, 0x61, 0xff, 0x1f, 0x60, 0xff, 0x43, 0x40, 0xff, 0x30, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0xe0, 0xfe, 0x8b, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xec, 0x40, 0xff, 0xdc, 0xe0, 0xfe, 0xfb, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xf8, 0x41, 0xff, 0xd7, 0x00, 0xff, 0xf0, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0x30, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0x20, 0xff, 0x2c, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xe7, 0xe0, 0xfe, 0x14, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x10, 0x60, 0xff, 0x1c, 0xe0, 0xfe, 0x00, 0x20, 0xff, 0x00, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xc7, 0x40, 0xff, 0x00, 0xa3, 0xff, 0x00, 0x60, 0xff, 0x1c, 0x60, 0xff, 0x0f, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x40, 0xff, 0x3c, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x60, 0xff, 0x18, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x20, 0xff, 0x03, 0xc0, 0xfe, 0xd3, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x84, 0xe0, 0xfe, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x20, 0xff, 0x00, 0xe0, 0xfe, 0x47, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xef, 0xa0, 0xfe, 0x14, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x60, 0xff, 0x37, 0x60, 0xff, 0x70, 0x60, 0xff, 0xa7, 0x61, 0xff, 0xc7, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xf7, 0x61, 0xff, 0xc4, 0x60, 0xff, 0x97, 0x60, 0xff, 0x6b, 0x60, 0xff, 0x2b, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x20, 0xff, 0x2f, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x22, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xf7, 0x60, 0xff, 0x0c, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0xc0, 0xfe, 0x64, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x03, 0xff, 0xff, 0x23, 0xff, 0xff, 0x23, 0xff, 0xff, 0x23, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x43, 0xff, 0xff, 0x44, 0xff, 0xff, 0x26, 0xff, 0xff, 0x26, 0xff, 0xff, 0x25, 0xff, 0xff, 0x23, 0xff, 0xff, 0x02, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf7, 0xc0, 0xfe, 0x30, 0xe0, 0xfe, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x60, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0xfe, 0x00, 0xc0, 0xfe, 0xb7, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x05, 0xff, 0xff, 0x29, 0xf7, 0xff, 0x29, 0xf7, 0xff, 0x27, 0xf7, 0xff, 0x45, 0xff, 0xff, 0x44, 0xff, 0xff, 0x43, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x45, 0xff, 0xff, 0x29, 0xf7, 0xff, 0x29, 0xf7, 0xff, 0x28, 0xf7, 0xff, 0x06, 0xff, 0xff, 0x05, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x9f, 0x61, 0xfe, 0x00, 0x60, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x00, 0x60, 0xff, 0x23, 0x60, 0xff, 0x88, 0x40, 0xff, 0xd7, 0xe0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff, 0x02, 0xff, 0xff, 0x02, 0xff, 0xff, 0x21, 0xff, 0xff, 0x26, 0xff, 0xff, 0x2b, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x28, 0xf7, 0xff, 0x46, 0xff, 0xff, 0x44, 0xff, 0xff, 0x64, 0xff, 0xff, 0x63, 0xff, 0xff, 0x63, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x61, 0xff, 0xff, 0x43, 0xff, 0xff, 0x27, 0xf7, 0xff, 0x2b, 0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0x09, 0xf7, 0xff, 0x08, 0xf7, 0xff, 0x07, 0xf7, 0xff, 0x05, 0xff, 0xff, 0xe3, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xef, 0x40, 0xff, 0xd3, 0x60, 0xff, 0x74, 0x40, 0xff, 0x0f, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x04, 0x20, 0xff, 0xa0, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x25, 0xff, 0xff, 0x09, 0xf7, 0xff, 0x2d, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x2d, 0xf7, 0xff, 0x4a, 0xf7, 0xff, 0x47, 0xf7, 0xff, 0x65, 0xff, 0xff, 0x64, 0xff, 0xff, 0x64, 0xff, 0xff, 0x64, 0xff, 0xff, 0x45, 0xff, 0xff, 0x48, 0xf7, 0xff, 0x29, 0xf7, 0xff, 0x2b, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0x09, 0xf7, 0xff, 0xe4, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x63, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x54, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x08, 0xf7, 0xff, 0x07, 0xf7, 0xff, 0x06, 0xff, 0xff, 0x08, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x52, 0xf7, 0xff, 0x51, 0xf7, 0xff, 0x51, 0xf7, 0xff, 0x4f, 0xf7, 0xff, 0x4d, 0xf7, 0xff, 0x4a, 0xf7, 0xff, 0x47, 0xf7, 0xff, 0x65, 0xff, 0xff, 0x64, 0xff, 0xff, 0x45, 0xff, 0xff, 0x49, 0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x2d, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0x05, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x33, 0x80, 0xff, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb6, 0x00, 0x7f, 0xc6, 0x00, 0xe0, 0xfe, 0x00, 0xe1, 0xfe, 0x80, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0x0a, 0xf7, 0xff, 0x0a, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x52, 0xf7, 0xff, 0x51, 0xf7, 0xff, 0x50, 0xf7, 0xff, 0x50, 0xf7, 0xff, 0x4e, 0xf7, 0xff, 0x4a, 0xf7, 0xff, 0x47, 0xf7, 0xff, 0x46, 0xff, 0xff, 0x48, 0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x06, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xf8, 0x20, 0xff, 0x3b, 0x40, 0xff, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0x00, 0xff, 0xff, 0x00, 0x9a, 0xd6, 0x00, 0xf9, 0xbd, 0x00, 0x45, 0xff, 0x00, 0x0d, 0xef, 0x18, 0x47, 0xff, 0xbc, 0xe6, 0xfe, 0xf8, 0xc4, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe5, 0xfe, 0xff, 0x0c, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x52, 0xf7, 0xff, 0x4f, 0xf7, 0xff, 0x4d, 0xf7, 0xff, 0x4c, 0xf7, 0xff, 0x2d, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xe4, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xef, 0x60, 0xff, 0x94, 0x00, 0xff, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x00, 0xbe, 0xf7, 0x00, 0x9a, 0xd6, 0x08, 0x5a, 0xc6, 0x07, 0x43, 0xff, 0x20, 0x21, 0xff, 0xf0, 0xc7, 0xfe, 0xff, 0xcb, 0xf6, 0xff, 0xec, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xe4, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x51, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0xd4, 0x60, 0xff, 0x04, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x00, 0x9a, 0xd6, 0x07, 0x79, 0xce, 0x17, 0x79, 0xce, 0x13, 0x79, 0xd6, 0x10, 0xb4, 0xee, 0x30, 0xc9, 0xf6, 0xb0, 0xed, 0xf6, 0xff, 0x10, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xec, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0x0c, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x9a, 0xf7, 0xff, 0x9c, 0xf7, 0xff, 0x9c, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0xeb, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x7b, 0xc0, 0xfe, 0x13, 0x00, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd6, 0x00, 0x9a, 0xd6, 0x0f, 0xdb, 0xde, 0x28, 0x7a, 0xd6, 0x1b, 0xba, 0xd6, 0x1f, 0xba, 0xde, 0x2c, 0xfd, 0xde, 0x48, 0xf3, 0xee, 0xb8, 0xf0, 0xf6, 0xff, 0x12, 0xf7, 0xff, 0x13, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xe8, 0xf6, 0xff, 0xe0, 0xfe, 0xff, 0xc1, 0xfe, 0xf8, 0x02, 0xff, 0x37, 0x01, 0xff, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xd6, 0x00, 0x59, 0xce, 0x13, 0xdb, 0xde, 0x47, 0xdb, 0xde, 0x27, 0xbb, 0xde, 0x1f, 0x9e, 0xd6, 0x27, 0x10, 0xef, 0x8b, 0xea, 0xf6, 0xfb, 0xeb, 0xf6, 0xff, 0x12, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0xe8, 0xf6, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xf0, 0x81, 0xff, 0x3f, 0x60, 0xff, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x00, 0x1c, 0xe7, 0x08, 0xba, 0xd6, 0x33, 0xbb, 0xde, 0x30, 0xfc, 0xde, 0x23, 0x28, 0xf7, 0x80, 0xe6, 0xfe, 0xff, 0xc8, 0xf6, 0xff, 0xc7, 0xf6, 0xff, 0xec, 0xf6, 0xff, 0x12, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x9b, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0xee, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xe2, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x60, 0xff, 0x3b, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x00, 0xbe, 0xf7, 0x00, 0xbb, 0xde, 0x0b, 0xba, 0xd6, 0x18, 0xb9, 0xd6, 0x20, 0xf1, 0xee, 0x3b, 0xcd, 0xf6, 0x8b, 0xc9, 0xf6, 0xeb, 0xc8, 0xf6, 0xff, 0xc7, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0x10, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xc4, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xc4, 0xc0, 0xfe, 0x58, 0x20, 0xff, 0x18, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0x00, 0xff, 0xff, 0x00, 0x7d, 0xef, 0x00, 0x1c, 0xe7, 0x04, 0xba, 0xd6, 0x0b, 0x79, 0xce, 0x10, 0xdd, 0xd6, 0x1b, 0x9f, 0xbe, 0x1c, 0xe9, 0xf6, 0xaf, 0xc5, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xea, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0xed, 0xf6, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0a, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0x0e, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0xed, 0xf6, 0xff, 0xc8, 0xf6, 0xff, 0xc8, 0xf6, 0x8c, 0xe0, 0xff, 0x00, 0xcc, 0xfe, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x79, 0xce, 0x03, 0xdb, 0xde, 0x07, 0xbb, 0xde, 0x0b, 0x9f, 0xce, 0x0b, 0x47, 0xff, 0x7b, 0xe3, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc4, 0xfe, 0xff, 0xe5, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0xe7, 0xf6, 0xff, 0x10, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0xe8, 0xf6, 0xff, 0xe8, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe9, 0xf6, 0xf8, 0x0f, 0xef, 0x40, 0xd5, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7a, 0xd6, 0x07, 0xfb, 0xde, 0x08, 0xdb, 0xde, 0x0b, 0xbc, 0xd6, 0x0c, 0x2c, 0xf7, 0x3f, 0xe2, 0xfe, 0xfb, 0xc3, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc4, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0x0e, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0xe6, 0xfe, 0xff, 0xe5, 0xfe, 0xff, 0xe5, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0xc6, 0xfe, 0xff, 0xc6, 0xfe, 0xff, 0xc6, 0xfe, 0xff, 0x04, 0xff, 0xf0, 0xc0, 0xff, 0x08, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9a, 0xd6, 0x07, 0x7a, 0xd6, 0x10, 0x7a, 0xd6, 0x18, 0x7a, 0xce, 0x17, 0xf2, 0xee, 0x2f, 0xc9, 0xf6, 0x6c, 0xc6, 0xfe, 0x8c, 0xc5, 0xfe, 0xb3, 0xc5, 0xfe, 0xff, 0xc6, 0xfe, 0xff, 0xc7, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xe8, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xc3, 0xfe, 0xf3, 0xc3, 0xfe, 0xa7, 0xc3, 0xfe, 0x83, 0xc5, 0xfe, 0x53, 0x80, 0xff, 0x13, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0x00, 0x5d, 0xef, 0x00, 0xba, 0xd6, 0x07, 0x7a, 0xd6, 0x13, 0xdb, 0xde, 0x24, 0xdb, 0xde, 0x2c, 0xdb, 0xde, 0x2c, 0xfd, 0xde, 0x24, 0xde, 0xd6, 0x24, 0xee, 0xee, 0x60, 0xc6, 0xfe, 0xff, 0xc9, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xee, 0xf6, 0xff, 0x33, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x59, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0xeb, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xec, 0x2f, 0xff, 0x1b, 0x7f, 0x8e, 0x04, 0xff, 0xef, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x00, 0x7a, 0xd6, 0x04, 0xba, 0xd6, 0x13, 0xbb, 0xde, 0x1c, 0xfb, 0xde, 0x34, 0xfc, 0xe6, 0x58, 0xfb, 0xde, 0x5f, 0xfb, 0xde, 0x4f, 0xfa, 0xde, 0x4f, 0xec, 0xf6, 0xdf, 0xed, 0xf6, 0xff, 0xf0, 0xf6, 0xff, 0x12, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x36, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7b, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xeb, 0xf6, 0xff, 0xe6, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x83, 0x80, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x00, 0x1c, 0xe7, 0x07, 0x7a, 0xd6, 0x18, 0xba, 0xd6, 0x1c, 0xdb, 0xde, 0x28, 0xfb, 0xde, 0x54, 0xfc, 0xe6, 0x67, 0xfc, 0xe6, 0x64, 0x16, 0xef, 0x80, 0xee, 0xf6, 0xf8, 0x12, 0xf7, 0xf8, 0x36, 0xf7, 0xfb, 0x36, 0xf7, 0xfc, 0x58, 0xf7, 0xff, 0x59, 0xf7, 0xff, 0x59, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x59, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x9c, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xc4, 0xfe, 0xff, 0xc1, 0xfe, 0xf7, 0xc0, 0xfe, 0xec, 0xc0, 0xfe, 0xef, 0xe0, 0xfe, 0xff, 0xe0, 0xff, 0x08, 0x6f, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x00, 0x7a, 0xd6, 0x0b, 0xbb, 0xde, 0x20, 0xdb, 0xde, 0x24, 0xba, 0xd6, 0x2f, 0xdb, 0xde, 0x3f, 0xfb, 0xde, 0x43, 0xfb, 0xde, 0x4b, 0xf9, 0xe6, 0x5c, 0xf8, 0xe6, 0x7c, 0x1b, 0xef, 0x9f, 0x5d, 0xef, 0xc7, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x36, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x36, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0xe6, 0xfe, 0xff, 0xe7, 0xf6, 0xff, 0x10, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xef, 0xf6, 0xff, 0xee, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0xc4, 0xfe, 0xff, 0xc1, 0xfe, 0xd3, 0xe8, 0xfe, 0x1c, 0xc0, 0xfe, 0x1c, 0xc0, 0xfe, 0x28, 0x60, 0xff, 0x0f, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x00, 0xbb, 0xde, 0x0c, 0xdb, 0xde, 0x2b, 0xbb, 0xde, 0x33, 0xfb, 0xde, 0x3b, 0xdb, 0xde, 0x40, 0xdb, 0xde, 0x3b, 0xdb, 0xde, 0x34, 0xdb, 0xde, 0x3f, 0xdb, 0xde, 0x54, 0x1c, 0xe7, 0x74, 0x3a, 0xef, 0xbb, 0x34, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x36, 0xf7, 0xff, 0x36, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x13, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xe7, 0xf6, 0xff, 0x04, 0xff, 0xff, 0xe7, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0xe8, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0x33, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0xed, 0xf6, 0xff, 0xec, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xc8, 0xf6, 0xff, 0xc3, 0xfe, 0xff, 0xc1, 0xfe, 0xe7, 0x49, 0xff, 0x18, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x76, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0x00, 0x5d, 0xef, 0x07, 0xba, 0xd6, 0x20, 0xba, 0xd6, 0x30, 0xdb, 0xde, 0x3c, 0xfb, 0xde, 0x50, 0xfb, 0xde, 0x50, 0xdb, 0xde, 0x40, 0xbb, 0xde, 0x38, 0xdb, 0xde, 0x4b, 0x1c, 0xe7, 0x63, 0x12, 0xef, 0xc4, 0xf0, 0xf6, 0xff, 0x11, 0xf7, 0xff, 0x14, 0xf7, 0xf3, 0x12, 0xf7, 0xfc, 0xef, 0xf6, 0xff, 0xed, 0xf6, 0xff, 0xed, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0xee, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xe4, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xe7, 0xfe, 0xff, 0xe7, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0x0d, 0xf7, 0xff, 0xec, 0xf6, 0xff, 0xe8, 0xf6, 0xff, 0xe6, 0xfe, 0xff, 0xea, 0xf6, 0xff, 0xed, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xc5, 0xfe, 0xff, 0xc6, 0xfe, 0xff, 0xc5, 0xfe, 0xf7, 0xc5, 0xfe, 0xe3, 0xc2, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0x23, 0xff, 0x2c, 0xdf, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x00, 0x39, 0xce, 0x03, 0xdb, 0xde, 0x0f, 0x9a, 0xd6, 0x18, 0xdb, 0xde, 0x23, 0xdb, 0xde, 0x43, 0xdb, 0xde, 0x53, 0xdb, 0xde, 0x4b, 0xdb, 0xde, 0x3c, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x40, 0xee, 0xf6, 0xa8, 0xf2, 0xee, 0x9f, 0x1b, 0xe7, 0x83, 0x1b, 0xe7, 0xa0, 0xee, 0xf6, 0xf8, 0xc8, 0xf6, 0xff, 0xc7, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0xee, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0xec, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe8, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc3, 0xfe, 0xf3, 0xdf, 0x76, 0x0f, 0xb0, 0xee, 0x37, 0xc5, 0xfe, 0x7f, 0x03, 0xff, 0x48, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x03, 0xdb, 0xde, 0x08, 0xfb, 0xde, 0x0b, 0xfb, 0xde, 0x0f, 0xba, 0xd6, 0x28, 0xdb, 0xde, 0x38, 0xdb, 0xde, 0x3c, 0xdb, 0xde, 0x2c, 0xbb, 0xde, 0x1f, 0x7c, 0xce, 0x13, 0xdc, 0xde, 0x28, 0xdb, 0xde, 0x47, 0x19, 0xe7, 0x88, 0xed, 0xf6, 0xfb, 0xc8, 0xf6, 0xff, 0xc4, 0xfe, 0xff, 0xc5, 0xfe, 0xfb, 0xc7, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xe4, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xc7, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0x9f, 0x05, 0x07, 0x9b, 0xd6, 0x0f, 0xde, 0xce, 0x0c, 0xbf, 0xce, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x76, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf8, 0xc5, 0x03, 0x39, 0xce, 0x03, 0x79, 0xce, 0x04, 0x39, 0xce, 0x0c, 0x9a, 0xd6, 0x17, 0xfb, 0xde, 0x20, 0xba, 0xd6, 0x0c, 0xfc, 0xe6, 0x07, 0x9a, 0xd6, 0x0b, 0xfb, 0xde, 0x1b, 0xd4, 0xee, 0x60, 0xc7, 0xf6, 0xf4, 0xca, 0xf6, 0xc7, 0xb3, 0xe6, 0x2f, 0xc2, 0xfe, 0xc4, 0xc2, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc4, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0xc9, 0xf6, 0xff, 0xe7, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xa4, 0xe2, 0xfe, 0x3b, 0xc0, 0xfe, 0xcc, 0xc1, 0xfe, 0xff, 0xfc, 0x9f, 0x04, 0xff, 0xff, 0x00, 0x38, 0xc6, 0x03, 0xdb, 0xde, 0x07, 0x59, 0xce, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0x03, 0xff, 0xff, 0x03, 0x59, 0xce, 0x04, 0xbb, 0xde, 0x07, 0x9a, 0xd6, 0x04, 0xd7, 0xbd, 0x04, 0x5d, 0xef, 0x03, 0xdb, 0xde, 0x08, 0xd4, 0xee, 0x1f, 0xae, 0xee, 0x38, 0xbb, 0xd6, 0x24, 0xdf, 0xd6, 0x1f, 0xe2, 0xfe, 0xa3, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc1, 0xfe, 0x8b, 0xc1, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc4, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xc4, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xec, 0xc1, 0xfe, 0xac, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe1, 0xfe, 0x7b, 0xa0, 0xfe, 0x00, 0xab, 0xfe, 0x00, 0xc3, 0xfe, 0x37, 0x49, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1c, 0xe7, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0x00, 0x96, 0xb5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0x7a, 0xd6, 0x03, 0x59, 0xce, 0x04, 0x3c, 0xe7, 0x03, 0x9e, 0xf7, 0x03, 0x7a, 0xd6, 0x04, 0xbb, 0xd6, 0x04, 0x1d, 0xe7, 0x07, 0xba, 0xd6, 0x0c, 0xbd, 0xd6, 0x1c, 0xe8, 0xf6, 0x83, 0xc1, 0xfe, 0xf0, 0xc4, 0xfe, 0x43, 0x80, 0xfe, 0x00, 0xc0, 0xfe, 0xef, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xeb, 0xc3, 0xfe, 0x73, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc2, 0xfe, 0xec, 0xc1, 0xfe, 0x78, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xc8, 0xe0, 0xfe, 0x00, 0xc1, 0xfe, 0x5f, 0xc0, 0xfe, 0xff, 0x01, 0xff, 0x50, 0xe0, 0xfe, 0x00, 0x80, 0xfd, 0x00, 0xeb, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x76, 0xb5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0x7e, 0xf7, 0x03, 0x18, 0xc6, 0x04, 0xff, 0xff, 0x03, 0xbf, 0xff, 0x03, 0x39, 0xce, 0x04, 0xfc, 0xe6, 0x03, 0x3d, 0xef, 0x03, 0x5c, 0xc6, 0x04, 0xcc, 0xf6, 0x2b, 0xcf, 0xf6, 0x28, 0x5f, 0x05, 0x00, 0xc0, 0xfe, 0x00, 0xe0, 0xfe, 0x7b, 0xc0, 0xfe, 0xff, 0xc3, 0xfe, 0x33, 0xc0, 0xfe, 0x00, 0xc0, 0xfe, 0xa7, 0xc0, 0xfe, 0xff, 0xc2, 0xfe, 0x8c, 0x80, 0xfe, 0x00, 0xc0, 0xfe, 0x5b, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x60, 0x20, 0xfe, 0x00, 0xa0, 0xfd, 0x00, 0xc0, 0xfe, 0x2c, 0x40, 0xff, 0x1b, 0x22, 0xff, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x76, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x3c, 0xe7, 0x03, 0xdf, 0xff, 0x03, 0x1c, 0xbe, 0x04, 0x3d, 0xe7, 0x08, 0x18, 0xc6, 0x03, 0xff, 0xff, 0x00, 0xe3, 0xfe, 0x27, 0xc1, 0xfe, 0x44, 0x60, 0xfe, 0x00, 0x9b, 0xff, 0x00, 0xe0, 0xfe, 0x1f, 0xc0, 0xfe, 0xdf, 0x20, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x60, 0xfe, 0x00, 0xc0, 0xfe, 0x9f, 0xe1, 0xff, 0x00, 0x4d, 0xff, 0x00, 0xff, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x40, 0xff, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xef, 0x03, 0x7d, 0xef, 0x03, 0x7e, 0xf7, 0x03, 0xff, 0xff, 0x00, 0xf9, 0xff, 0x00, 0x40, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xc0, 0xfe, 0x13, 0xe1, 0xfe, 0x00, 0xff, 0xff, 0x00, 0x2c, 0xff, 0x00, 0xe4, 0xff, 0x00, 0x40, 0xff, 0x00, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x0f, 0xb9, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x23, 
+  0x60, 0xff, 0x3c, 0x81, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x20, 0x20, 0xff, 0xd4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x84, 0xb1, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x23, 0x80, 0xff, 
+  0x0b, 0x81, 0x00, 0x00, 0x00, 0x0a, 0x20, 0xff, 0x7b, 0x00, 0xff, 0xff, 0x81, 0xff, 0x38, 0x00, 0x00, 0x00, 0x20, 0xff, 0xa7, 0xc0, 0xfe, 0xff, 0x60, 0xff, 0x84, 0x00, 0x00, 0x00, 0x40, 0xff, 
+  0x58, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x5c, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x2f, 0x60, 0xff, 0x20, 0xac, 0x00, 0x00, 0x00, 0x12, 0x20, 0xff, 0x6f, 0x20, 0xff, 0xef, 0x60, 0xff, 0x2b, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xef, 0x60, 0xff, 0x58, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xeb, 0x61, 0xff, 0x58, 0x00, 0xff, 0xff, 0xc0, 0xfe, 
+  0xff, 0x00, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x60, 0xff, 0x4b, 0x00, 0xff, 0xff, 0x20, 0xff, 0x4f, 0xa8, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x14, 0xa0, 0xff, 0x13, 0x81, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0xff, 0x97, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xf8, 0x60, 0xff, 0x9b, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xfc, 0x82, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 
+  0x04, 0xe0, 0xfe, 0xef, 0x60, 0xff, 0xb8, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x78, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x3f, 0x40, 0xff, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x04, 
+  0x00, 0xff, 0x2f, 0x20, 0xff, 0xff, 0x40, 0xff, 0x8c, 0xa1, 0xff, 0x17, 0x00, 0xff, 0xc0, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x8a, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 
+  0xfe, 0xff, 0x03, 0x00, 0xff, 0xab, 0x60, 0xff, 0x24, 0x40, 0xff, 0xac, 0x00, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xfe, 0x27, 0xc0, 0xfe, 0xf8, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xef, 
+  0xe0, 0xfe, 0xf8, 0x90, 0xe0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xf7, 0x00, 0xff, 0xfb, 0x81, 0xc0, 0xfe, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x04, 0x40, 0xff, 0x63, 0x60, 0xff, 0x38, 0x60, 0xff, 0x1b, 
+  0x00, 0xff, 0x27, 0xc0, 0xfe, 0xf3, 0x81, 0xc0, 0xfe, 0xff, 0x92, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x04, 0xc0, 0xfe, 0xef, 0x00, 0x00, 0x00, 0x61, 0xff, 0x1f, 0x60, 0xff, 0x43, 0x40, 
+  0xff, 0x30, 0x9e, 0x00, 0x00, 0x00, 0x04, 0xe0, 0xfe, 0x8b, 0xe0, 0xfe, 0xff, 0x20, 0xff, 0xec, 0x40, 0xff, 0xdc, 0xe0, 0xfe, 0xfb, 0x85, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x86, 0x01, 
+  0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0xe0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xf8, 0x41, 0xff, 0xd7, 0x00, 0xff, 0xf0, 0xe0, 0xfe, 0xff, 0xe0, 0xfe, 0x30, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x20, 
+  0xff, 0x2c, 0x82, 0xc0, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x8a, 0x01, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 
+  0xfe, 0xe7, 0xe0, 0xfe, 0x14, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x10, 0x60, 0xff, 0x1c, 0x81, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xfe, 0xf0, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 
+  0xe1, 0xfe, 0xff, 0x90, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xc7, 0x81, 0x00, 0x00, 0x00, 0x01, 0x60, 0xff, 0x1c, 0x60, 0xff, 
+  0x0f, 0x98, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x3c, 0x20, 0xff, 0xff, 0x81, 0x40, 0xff, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x85, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 
+  0x86, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0xe0, 0xfe, 0xff, 0x00, 0x40, 0xff, 0xff, 0x81, 0x20, 0xff, 0xff, 0x00, 0x60, 0xff, 0x18, 0x98, 0x00, 0x00, 0x00, 0x01, 0x20, 0xff, 0x03, 
+  0xc0, 0xfe, 0xd3, 0x82, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x8c, 0x21, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x81, 
+  0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x84, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfe, 0x47, 0x81, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x84, 0x01, 0xff, 0xff, 0x8d, 
+  0x21, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xef, 0xa0, 0xfe, 0x14, 0x97, 0x00, 0x00, 0x00, 0x04, 0x60, 0xff, 
+  0x37, 0x60, 0xff, 0x70, 0x60, 0xff, 0xa7, 0x61, 0xff, 0xc7, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0x01, 0xff, 0xff, 0x84, 0x21, 0xff, 0xff, 0x86, 0x41, 0xff, 
+  0xff, 0x85, 0x21, 0xff, 0xff, 0x82, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x04, 0xe0, 0xfe, 0xf7, 0x61, 0xff, 0xc4, 0x60, 0xff, 0x97, 0x60, 0xff, 0x6b, 0x60, 0xff, 
+  0x2b, 0x94, 0x00, 0x00, 0x00, 0x01, 0x20, 0xff, 0x2f, 0xe0, 0xfe, 0xff, 0x82, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x83, 0x21, 0xff, 0xff, 
+  0x82, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x00, 0x41, 0xff, 0xff, 0x82, 0x42, 0xff, 0xff, 0x00, 0x22, 0xff, 0xff, 0x82, 0x21, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x83, 0xe0, 0xfe, 0xff, 
+  0x03, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xff, 0xf7, 0x60, 0xff, 0x0c, 0x95, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x64, 0x82, 0xc0, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 
+  0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x82, 0x23, 0xff, 0xff, 0x87, 0x42, 0xff, 0xff, 0x01, 0x43, 0xff, 0xff, 0x44, 0xff, 0xff, 0x81, 0x26, 0xff, 0xff, 0x02, 0x25, 0xff, 0xff, 
+  0x23, 0xff, 0xff, 0x02, 0xff, 0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xf7, 0xc0, 0xfe, 0x30, 0x97, 0x00, 0x00, 0x00, 
+  0x01, 0xc0, 0xfe, 0xb7, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x83, 0x01, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x81, 0x29, 0xf7, 0xff, 0x04, 0x27, 0xf7, 0xff, 0x45, 
+  0xff, 0xff, 0x44, 0xff, 0xff, 0x43, 0xff, 0xff, 0x42, 0xff, 0xff, 0x84, 0x62, 0xff, 0xff, 0x01, 0x42, 0xff, 0xff, 0x45, 0xff, 0xff, 0x81, 0x29, 0xf7, 0xff, 0x05, 0x28, 0xf7, 0xff, 0x06, 0xff, 
+  0xff, 0x05, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x02, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x9f, 0x95, 0x00, 0x00, 0x00, 
+  0x04, 0x60, 0xff, 0x23, 0x60, 0xff, 0x88, 0x40, 0xff, 0xd7, 0xe0, 0xfe, 0xf3, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x00, 0x01, 0xff, 0xff, 0x82, 0x02, 0xff, 0xff, 0x09, 0x21, 0xff, 0xff, 
+  0x26, 0xff, 0xff, 0x2b, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x28, 0xf7, 0xff, 0x46, 0xff, 0xff, 0x44, 0xff, 0xff, 0x64, 0xff, 0xff, 0x81, 0x63, 0xff, 0xff, 0x81, 
+  0x62, 0xff, 0xff, 0x0a, 0x61, 0xff, 0xff, 0x43, 0xff, 0xff, 0x27, 0xf7, 0xff, 0x2b, 0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0x09, 0xf7, 0xff, 0x08, 0xf7, 0xff, 0x07, 0xf7, 0xff, 0x05, 
+  0xff, 0xff, 0xe3, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x05, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xef, 0x40, 0xff, 0xd3, 0x60, 0xff, 0x74, 0x40, 0xff, 0x0f, 0x91, 0x00, 0x00, 0x00, 
+  0x02, 0xc0, 0xff, 0x04, 0x20, 0xff, 0xa0, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x83, 0xe0, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x82, 0x04, 0xff, 0xff, 0x03, 0x25, 0xff, 0xff, 0x09, 0xf7, 
+  0xff, 0x2d, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x81, 0x31, 0xf7, 0xff, 0x04, 0x2f, 0xf7, 0xff, 0x2d, 0xf7, 0xff, 0x4a, 0xf7, 0xff, 0x47, 0xf7, 0xff, 0x65, 0xff, 0xff, 0x82, 0x64, 0xff, 0xff, 0x03, 
+  0x45, 0xff, 0xff, 0x48, 0xf7, 0xff, 0x29, 0xf7, 0xff, 0x2b, 0xf7, 0xff, 0x82, 0x2e, 0xf7, 0xff, 0x04, 0x0e, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0x09, 0xf7, 0xff, 0xe4, 0xfe, 0xff, 0xe0, 0xfe, 0xff, 
+  0x81, 0xe1, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0x63, 0x93, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x54, 0x81, 0xc0, 0xfe, 0xff, 0x82, 
+  0xe0, 0xfe, 0xff, 0x0a, 0xe1, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x08, 0xf7, 0xff, 0x07, 0xf7, 0xff, 0x06, 0xff, 0xff, 0x08, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x53, 
+  0xf7, 0xff, 0x52, 0xf7, 0xff, 0x81, 0x51, 0xf7, 0xff, 0x0b, 0x4f, 0xf7, 0xff, 0x4d, 0xf7, 0xff, 0x4a, 0xf7, 0xff, 0x47, 0xf7, 0xff, 0x65, 0xff, 0xff, 0x64, 0xff, 0xff, 0x45, 0xff, 0xff, 0x49, 
+  0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x2d, 0xf7, 0xff, 0x2e, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x81, 0x30, 0xf7, 0xff, 0x04, 0x10, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0x05, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe1, 
+  0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x33, 0x95, 0x00, 0x00, 0x00, 0x01, 0xe1, 0xfe, 0x80, 0xc0, 0xfe, 0xff, 0x82, 0xe0, 0xfe, 0xff, 0x01, 0xe1, 0xfe, 
+  0xff, 0x00, 0xff, 0xff, 0x81, 0x0b, 0xf7, 0xff, 0x81, 0x0a, 0xf7, 0xff, 0x07, 0x2f, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x52, 
+  0xf7, 0xff, 0x51, 0xf7, 0xff, 0x81, 0x50, 0xf7, 0xff, 0x06, 0x4e, 0xf7, 0xff, 0x4a, 0xf7, 0xff, 0x47, 0xf7, 0xff, 0x46, 0xff, 0xff, 0x48, 0xf7, 0xff, 0x2c, 0xf7, 0xff, 0x2f, 0xf7, 0xff, 0x81, 
+  0x30, 0xf7, 0xff, 0x00, 0x31, 0xf7, 0xff, 0x81, 0x32, 0xf7, 0xff, 0x01, 0x0d, 0xf7, 0xff, 0x06, 0xff, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x01, 0xc0, 0xfe, 0xf8, 0x20, 0xff, 
+  0x3b, 0x94, 0x00, 0x00, 0x00, 0x05, 0x0d, 0xef, 0x18, 0x47, 0xff, 0xbc, 0xe6, 0xfe, 0xf8, 0xc4, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 0xff, 0x02, 0xe5, 0xfe, 0xff, 
+  0x0c, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x81, 0x0c, 0xf7, 0xff, 0x02, 0x30, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x81, 0x7a, 0xf7, 0xff, 0x02, 0x78, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x54, 
+  0xf7, 0xff, 0x82, 0x53, 0xf7, 0xff, 0x06, 0x52, 0xf7, 0xff, 0x4f, 0xf7, 0xff, 0x4d, 0xf7, 0xff, 0x4c, 0xf7, 0xff, 0x2d, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x82, 0x55, 0xf7, 0xff, 
+  0x04, 0x34, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xe4, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0x81, 0xe0, 0xfe, 0xff, 0x02, 0xc0, 0xfe, 0xff, 0x00, 0xff, 0xef, 0x60, 0xff, 0x94, 0x90, 0x00, 
+  0x00, 0x00, 0x0d, 0x9a, 0xd6, 0x08, 0x5a, 0xc6, 0x07, 0x43, 0xff, 0x20, 0x21, 0xff, 0xf0, 0xc7, 0xfe, 0xff, 0xcb, 0xf6, 0xff, 0xec, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xe4, 0xfe, 
+  0xff, 0xe2, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x81, 0x30, 0xf7, 0xff, 0x03, 0x32, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x81, 0x9b, 
+  0xf7, 0xff, 0x08, 0x7a, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0x51, 0xf7, 0xff, 0x81, 0x30, 
+  0xf7, 0xff, 0x01, 0x32, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x04, 0x56, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0x81, 0xe1, 0xfe, 
+  0xff, 0x81, 0xc0, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xff, 0x40, 0xff, 0xd4, 0x60, 0xff, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x06, 0x9a, 0xd6, 0x07, 0x79, 0xce, 0x17, 0x79, 0xce, 0x13, 0x79, 0xd6, 0x10, 
+  0xb4, 0xee, 0x30, 0xc9, 0xf6, 0xb0, 0xed, 0xf6, 0xff, 0x81, 0x10, 0xf7, 0xff, 0x06, 0x0f, 0xf7, 0xff, 0xec, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0x0c, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x35, 0xf7, 0xff, 
+  0x54, 0xf7, 0xff, 0x81, 0x55, 0xf7, 0xff, 0x03, 0x56, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x9a, 0xf7, 0xff, 0x81, 0x9c, 0xf7, 0xff, 0x03, 0x9b, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x78, 
+  0xf7, 0xff, 0x77, 0xf7, 0xff, 0x81, 0x55, 0xf7, 0xff, 0x00, 0x56, 0xf7, 0xff, 0x81, 0x55, 0xf7, 0xff, 0x0f, 0x53, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x57, 0xf7, 
+  0xff, 0x58, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0xeb, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0x7b, 0xc0, 
+  0xfe, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x0a, 0x9a, 0xd6, 0x0f, 0xdb, 0xde, 0x28, 0x7a, 0xd6, 0x1b, 0xba, 0xd6, 0x1f, 0xba, 0xde, 0x2c, 0xfd, 0xde, 0x48, 0xf3, 0xee, 0xb8, 0xf0, 0xf6, 0xff, 0x12, 
+  0xf7, 0xff, 0x13, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x81, 0x10, 0xf7, 0xff, 0x00, 0x33, 0xf7, 0xff, 0x81, 0x56, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x00, 0x78, 0xf7, 0xff, 0x81, 0x79, 0xf7, 0xff, 
+  0x00, 0x7a, 0xf7, 0xff, 0x84, 0x9b, 0xf7, 0xff, 0x01, 0x79, 0xf7, 0xff, 0x77, 0xf7, 0xff, 0x82, 0x56, 0xf7, 0xff, 0x81, 0x55, 0xf7, 0xff, 0x00, 0x33, 0xf7, 0xff, 0x81, 0x32, 0xf7, 0xff, 0x09, 
+  0x55, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xe8, 0xf6, 0xff, 0xe0, 0xfe, 0xff, 0xc1, 0xfe, 0xf8, 0x02, 0xff, 0x37, 0x90, 0x00, 
+  0x00, 0x00, 0x0d, 0x59, 0xce, 0x13, 0xdb, 0xde, 0x47, 0xdb, 0xde, 0x27, 0xbb, 0xde, 0x1f, 0x9e, 0xd6, 0x27, 0x10, 0xef, 0x8b, 0xea, 0xf6, 0xfb, 0xeb, 0xf6, 0xff, 0x12, 0xf7, 0xff, 0x35, 0xf7, 
+  0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x00, 0x79, 0xf7, 0xff, 0x82, 0x78, 0xf7, 0xff, 0x01, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 
+  0x84, 0x9b, 0xf7, 0xff, 0x01, 0x7a, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x81, 0x77, 0xf7, 0xff, 0x00, 0x56, 0xf7, 0xff, 0x81, 0x55, 0xf7, 0xff, 0x0d, 0x33, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x2f, 0xf7, 
+  0xff, 0x31, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0xe8, 0xf6, 0xff, 0xe0, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0xf0, 0x81, 
+  0xff, 0x3f, 0x8f, 0x00, 0x00, 0x00, 0x0f, 0x1c, 0xe7, 0x08, 0xba, 0xd6, 0x33, 0xbb, 0xde, 0x30, 0xfc, 0xde, 0x23, 0x28, 0xf7, 0x80, 0xe6, 0xfe, 0xff, 0xc8, 0xf6, 0xff, 0xc7, 0xf6, 0xff, 0xec, 
+  0xf6, 0xff, 0x12, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x81, 0x79, 0xf7, 0xff, 0x81, 0x78, 0xf7, 0xff, 0x02, 
+  0x77, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x83, 0x9b, 0xf7, 0xff, 0x00, 0x79, 0xf7, 0xff, 0x81, 0x78, 0xf7, 0xff, 0x81, 0x77, 0xf7, 0xff, 0x0c, 0x57, 0xf7, 0xff, 0x56, 0xf7, 0xff, 
+  0x54, 0xf7, 0xff, 0x30, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0xee, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xe2, 0xfe, 
+  0xff, 0x81, 0xc0, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 0x60, 0xff, 0x3b, 0x8f, 0x00, 0x00, 0x00, 0x0e, 0xbb, 0xde, 0x0b, 0xba, 0xd6, 0x18, 0xb9, 0xd6, 0x20, 0xf1, 0xee, 0x3b, 0xcd, 0xf6, 0x8b, 
+  0xc9, 0xf6, 0xeb, 0xc8, 0xf6, 0xff, 0xc7, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0x10, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x82, 0x79, 
+  0xf7, 0xff, 0x81, 0x78, 0xf7, 0xff, 0x00, 0x79, 0xf7, 0xff, 0x84, 0x7a, 0xf7, 0xff, 0x01, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x82, 0x56, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x0e, 0x56, 0xf7, 
+  0xff, 0x33, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xc4, 0xfe, 0xff, 0xc0, 
+  0xfe, 0xff, 0xc0, 0xfe, 0xc4, 0xc0, 0xfe, 0x58, 0x20, 0xff, 0x18, 0x90, 0x00, 0x00, 0x00, 0x05, 0x1c, 0xe7, 0x04, 0xba, 0xd6, 0x0b, 0x79, 0xce, 0x10, 0xdd, 0xd6, 0x1b, 0x9f, 0xbe, 0x1c, 0xe9, 
+  0xf6, 0xaf, 0x81, 0xc5, 0xfe, 0xff, 0x06, 0xea, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0xed, 0xf6, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x83, 0x79, 0xf7, 0xff, 
+  0x81, 0x78, 0xf7, 0xff, 0x81, 0x79, 0xf7, 0xff, 0x81, 0x7a, 0xf7, 0xff, 0x03, 0x79, 0xf7, 0xff, 0x78, 0xf7, 0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x81, 0x54, 0xf7, 0xff, 0x0c, 0x55, 0xf7, 
+  0xff, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0a, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0x0e, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0xed, 0xf6, 0xff, 0xc8, 
+  0xf6, 0xff, 0xc8, 0xf6, 0x8c, 0x93, 0x00, 0x00, 0x00, 0x0d, 0x79, 0xce, 0x03, 0xdb, 0xde, 0x07, 0xbb, 0xde, 0x0b, 0x9f, 0xce, 0x0b, 0x47, 0xff, 0x7b, 0xe3, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc4, 
+  0xfe, 0xff, 0xe5, 0xfe, 0xff, 0xe6, 0xfe, 0xff, 0xe7, 0xf6, 0xff, 0x10, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x00, 0x58, 0xf7, 0xff, 0x85, 0x78, 0xf7, 0xff, 
+  0x82, 0x79, 0xf7, 0xff, 0x0a, 0x78, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x33, 0xf7, 0xff, 
+  0x30, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0x81, 0xe8, 0xf6, 0xff, 0x00, 0xea, 0xf6, 0xff, 0x81, 0xeb, 0xf6, 0xff, 0x02, 0xea, 0xf6, 0xff, 0xe9, 0xf6, 0xf8, 0x0f, 0xef, 0x40, 0x91, 0x00, 0x00, 0x00, 
+  0x05, 0x7a, 0xd6, 0x07, 0xfb, 0xde, 0x08, 0xdb, 0xde, 0x0b, 0xbc, 0xd6, 0x0c, 0x2c, 0xf7, 0x3f, 0xe2, 0xfe, 0xfb, 0x81, 0xc3, 0xfe, 0xff, 0x01, 0xc4, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0x81, 0xe6, 
+  0xfe, 0xff, 0x02, 0x0e, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x83, 0x56, 0xf7, 0xff, 0x87, 0x57, 0xf7, 0xff, 0x04, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x31, 0xf7, 
+  0xff, 0x2e, 0xf7, 0xff, 0x81, 0x2f, 0xf7, 0xff, 0x04, 0x0f, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x0c, 0xf7, 0xff, 0xe6, 0xfe, 0xff, 0x81, 0xe5, 0xfe, 0xff, 0x00, 0xe6, 0xfe, 0xff, 
+  0x82, 0xc6, 0xfe, 0xff, 0x01, 0x04, 0xff, 0xf0, 0xc0, 0xff, 0x08, 0x90, 0x00, 0x00, 0x00, 0x0f, 0x9a, 0xd6, 0x07, 0x7a, 0xd6, 0x10, 0x7a, 0xd6, 0x18, 0x7a, 0xce, 0x17, 0xf2, 0xee, 0x2f, 0xc9, 
+  0xf6, 0x6c, 0xc6, 0xfe, 0x8c, 0xc5, 0xfe, 0xb3, 0xc5, 0xfe, 0xff, 0xc6, 0xfe, 0xff, 0xc7, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x57, 0xf7, 0xff, 
+  0x81, 0x58, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x00, 0x56, 0xf7, 0xff, 0x82, 0x57, 0xf7, 0xff, 0x81, 0x56, 0xf7, 0xff, 0x00, 0x55, 0xf7, 0xff, 0x81, 0x54, 0xf7, 0xff, 0x01, 0x33, 0xf7, 0xff, 
+  0x31, 0xf7, 0xff, 0x81, 0x0e, 0xf7, 0xff, 0x81, 0x0d, 0xf7, 0xff, 0x04, 0x0b, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0xe8, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0x81, 0xe2, 0xfe, 0xff, 0x04, 
+  0xc3, 0xfe, 0xf3, 0xc3, 0xfe, 0xa7, 0xc3, 0xfe, 0x83, 0xc5, 0xfe, 0x53, 0x80, 0xff, 0x13, 0x90, 0x00, 0x00, 0x00, 0x02, 0xba, 0xd6, 0x07, 0x7a, 0xd6, 0x13, 0xdb, 0xde, 0x24, 0x81, 0xdb, 0xde, 
+  0x2c, 0x10, 0xfd, 0xde, 0x24, 0xde, 0xd6, 0x24, 0xee, 0xee, 0x60, 0xc6, 0xfe, 0xff, 0xc9, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xee, 0xf6, 0xff, 0x33, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x35, 0xf7, 0xff, 
+  0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x59, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x82, 0x57, 0xf7, 0xff, 0x02, 0x56, 0xf7, 0xff, 0x55, 0xf7, 0xff, 
+  0x34, 0xf7, 0xff, 0x82, 0x33, 0xf7, 0xff, 0x08, 0x31, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0x0e, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0xeb, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 
+  0xe3, 0xfe, 0xff, 0x81, 0xc1, 0xfe, 0xff, 0x02, 0xc1, 0xfe, 0xec, 0x2f, 0xff, 0x1b, 0x7f, 0x8e, 0x04, 0x91, 0x00, 0x00, 0x00, 0x14, 0x7a, 0xd6, 0x04, 0xba, 0xd6, 0x13, 0xbb, 0xde, 0x1c, 0xfb, 
+  0xde, 0x34, 0xfc, 0xe6, 0x58, 0xfb, 0xde, 0x5f, 0xfb, 0xde, 0x4f, 0xfa, 0xde, 0x4f, 0xec, 0xf6, 0xdf, 0xed, 0xf6, 0xff, 0xf0, 0xf6, 0xff, 0x12, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x57, 0xf7, 0xff, 
+  0x56, 0xf7, 0xff, 0x36, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x7b, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x81, 0x33, 0xf7, 0xff, 0x01, 0x57, 0xf7, 0xff, 0x58, 0xf7, 0xff, 
+  0x82, 0x57, 0xf7, 0xff, 0x01, 0x56, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x83, 0x32, 0xf7, 0xff, 0x0c, 0x11, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xeb, 0xf6, 0xff, 0xe6, 
+  0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0x20, 0xff, 0x83, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x90, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0xe7, 0x07, 0x7a, 
+  0xd6, 0x18, 0xba, 0xd6, 0x1c, 0xdb, 0xde, 0x28, 0xfb, 0xde, 0x54, 0xfc, 0xe6, 0x67, 0xfc, 0xe6, 0x64, 0x16, 0xef, 0x80, 0xee, 0xf6, 0xf8, 0x12, 0xf7, 0xf8, 0x36, 0xf7, 0xfb, 0x36, 0xf7, 0xfc, 
+  0x58, 0xf7, 0xff, 0x81, 0x59, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x07, 0x58, 0xf7, 0xff, 0x59, 0xf7, 0xff, 0x7a, 0xf7, 0xff, 0x9c, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x0b, 0xf7, 0xff, 0x32, 0xf7, 
+  0xff, 0x57, 0xf7, 0xff, 0x83, 0x58, 0xf7, 0xff, 0x02, 0x57, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x31, 0xf7, 0xff, 0x82, 0x32, 0xf7, 0xff, 0x82, 0x11, 0xf7, 0xff, 0x07, 0x0f, 0xf7, 0xff, 0xea, 0xf6, 
+  0xff, 0xc4, 0xfe, 0xff, 0xc1, 0xfe, 0xf7, 0xc0, 0xfe, 0xec, 0xc0, 0xfe, 0xef, 0xe0, 0xfe, 0xff, 0xe0, 0xff, 0x08, 0x91, 0x00, 0x00, 0x00, 0x0b, 0x7a, 0xd6, 0x0b, 0xbb, 0xde, 0x20, 0xdb, 0xde, 
+  0x24, 0xba, 0xd6, 0x2f, 0xdb, 0xde, 0x3f, 0xfb, 0xde, 0x43, 0xfb, 0xde, 0x4b, 0xf9, 0xe6, 0x5c, 0xf8, 0xe6, 0x7c, 0x1b, 0xef, 0x9f, 0x5d, 0xef, 0xc7, 0x57, 0xf7, 0xff, 0x83, 0x58, 0xf7, 0xff, 
+  0x02, 0x36, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x36, 0xf7, 0xff, 0x81, 0x57, 0xf7, 0xff, 0x18, 0x11, 0xf7, 0xff, 0xe6, 0xfe, 0xff, 0xe7, 0xf6, 0xff, 0x10, 0xf7, 0xff, 0x34, 0xf7, 0xff, 0x31, 0xf7, 
+  0xff, 0x33, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0x32, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 0xef, 
+  0xf6, 0xff, 0xee, 0xf6, 0xff, 0xeb, 0xf6, 0xff, 0xc4, 0xfe, 0xff, 0xc1, 0xfe, 0xd3, 0xe8, 0xfe, 0x1c, 0xc0, 0xfe, 0x1c, 0xc0, 0xfe, 0x28, 0x60, 0xff, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x0c, 0xbb, 
+  0xde, 0x0c, 0xdb, 0xde, 0x2b, 0xbb, 0xde, 0x33, 0xfb, 0xde, 0x3b, 0xdb, 0xde, 0x40, 0xdb, 0xde, 0x3b, 0xdb, 0xde, 0x34, 0xdb, 0xde, 0x3f, 0xdb, 0xde, 0x54, 0x1c, 0xe7, 0x74, 0x3a, 0xef, 0xbb, 
+  0x34, 0xf7, 0xff, 0x35, 0xf7, 0xff, 0x81, 0x36, 0xf7, 0xff, 0x1c, 0x56, 0xf7, 0xff, 0x33, 0xf7, 0xff, 0x11, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x13, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0x0f, 0xf7, 0xff, 
+  0xe7, 0xf6, 0xff, 0x04, 0xff, 0xff, 0xe7, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0xea, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0x10, 0xf7, 0xff, 0x0d, 0xf7, 0xff, 0xe8, 0xf6, 0xff, 0xeb, 0xf6, 
+  0xff, 0x33, 0xf7, 0xff, 0x12, 0xf7, 0xff, 0xed, 0xf6, 0xff, 0xec, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0xc8, 0xf6, 0xff, 0xc3, 0xfe, 0xff, 0xc1, 0xfe, 0xe7, 0x49, 0xff, 0x18, 0xff, 
+  0xff, 0x03, 0x93, 0x00, 0x00, 0x00, 0x03, 0x5d, 0xef, 0x07, 0xba, 0xd6, 0x20, 0xba, 0xd6, 0x30, 0xdb, 0xde, 0x3c, 0x81, 0xfb, 0xde, 0x50, 0x09, 0xdb, 0xde, 0x40, 0xbb, 0xde, 0x38, 0xdb, 0xde, 
+  0x4b, 0x1c, 0xe7, 0x63, 0x12, 0xef, 0xc4, 0xf0, 0xf6, 0xff, 0x11, 0xf7, 0xff, 0x14, 0xf7, 0xf3, 0x12, 0xf7, 0xfc, 0xef, 0xf6, 0xff, 0x81, 0xed, 0xf6, 0xff, 0x00, 0x0f, 0xf7, 0xff, 0x81, 0x11, 
+  0xf7, 0xff, 0x01, 0xee, 0xf6, 0xff, 0xe9, 0xf6, 0xff, 0x81, 0xe4, 0xfe, 0xff, 0x11, 0xe7, 0xfe, 0xff, 0xe7, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0x0d, 0xf7, 0xff, 0xec, 0xf6, 0xff, 
+  0xe8, 0xf6, 0xff, 0xe6, 0xfe, 0xff, 0xea, 0xf6, 0xff, 0xed, 0xf6, 0xff, 0xe7, 0xf6, 0xff, 0xc5, 0xfe, 0xff, 0xc6, 0xfe, 0xff, 0xc5, 0xfe, 0xf7, 0xc5, 0xfe, 0xe3, 0xc2, 0xfe, 0xff, 0xc1, 0xfe, 
+  0xff, 0x23, 0xff, 0x2c, 0x94, 0x00, 0x00, 0x00, 0x1f, 0x39, 0xce, 0x03, 0xdb, 0xde, 0x0f, 0x9a, 0xd6, 0x18, 0xdb, 0xde, 0x23, 0xdb, 0xde, 0x43, 0xdb, 0xde, 0x53, 0xdb, 0xde, 0x4b, 0xdb, 0xde, 
+  0x3c, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x40, 0xee, 0xf6, 0xa8, 0xf2, 0xee, 0x9f, 0x1b, 0xe7, 0x83, 0x1b, 0xe7, 0xa0, 0xee, 0xf6, 0xf8, 0xc8, 0xf6, 0xff, 0xc7, 0xfe, 0xff, 0xe8, 0xf6, 0xff, 0xeb, 
+  0xf6, 0xff, 0xee, 0xf6, 0xff, 0x0f, 0xf7, 0xff, 0xec, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe8, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 
+  0xe8, 0xf6, 0xff, 0xea, 0xf6, 0xff, 0xe5, 0xfe, 0xff, 0x81, 0xe4, 0xfe, 0xff, 0x08, 0xe6, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xc3, 0xfe, 0xf3, 0xdf, 0x76, 0x0f, 
+  0xb0, 0xee, 0x37, 0xc5, 0xfe, 0x7f, 0x03, 0xff, 0x48, 0x95, 0x00, 0x00, 0x00, 0x11, 0xfc, 0xe6, 0x03, 0xdb, 0xde, 0x08, 0xfb, 0xde, 0x0b, 0xfb, 0xde, 0x0f, 0xba, 0xd6, 0x28, 0xdb, 0xde, 0x38, 
+  0xdb, 0xde, 0x3c, 0xdb, 0xde, 0x2c, 0xbb, 0xde, 0x1f, 0x7c, 0xce, 0x13, 0xdc, 0xde, 0x28, 0xdb, 0xde, 0x47, 0x19, 0xe7, 0x88, 0xed, 0xf6, 0xfb, 0xc8, 0xf6, 0xff, 0xc4, 0xfe, 0xff, 0xc5, 0xfe, 
+  0xfb, 0xc7, 0xf6, 0xff, 0x81, 0xea, 0xf6, 0xff, 0x82, 0xe9, 0xf6, 0xff, 0x09, 0xe7, 0xf6, 0xff, 0xe4, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xe4, 0xfe, 0xff, 0xc7, 
+  0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0x82, 0xc1, 0xfe, 0xff, 0x81, 0xc2, 0xfe, 0xff, 0x03, 0x9f, 0x05, 0x07, 0x9b, 0xd6, 0x0f, 0xde, 0xce, 0x0c, 0xbf, 0xce, 0x04, 
+  0x97, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0xc5, 0x03, 0x39, 0xce, 0x03, 0x79, 0xce, 0x04, 0x39, 0xce, 0x0c, 0x9a, 0xd6, 0x17, 0xfb, 0xde, 0x20, 0xba, 0xd6, 0x0c, 0xfc, 0xe6, 0x07, 0x9a, 0xd6, 0x0b, 
+  0xfb, 0xde, 0x1b, 0xd4, 0xee, 0x60, 0xc7, 0xf6, 0xf4, 0xca, 0xf6, 0xc7, 0xb3, 0xe6, 0x2f, 0xc2, 0xfe, 0xc4, 0xc2, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc4, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xe6, 0xfe, 
+  0xff, 0xe8, 0xf6, 0xff, 0xc9, 0xf6, 0xff, 0xe7, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 0xe1, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xe2, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0x81, 0xc1, 0xfe, 0xff, 
+  0x09, 0xc0, 0xfe, 0xff, 0xc0, 0xfe, 0xa4, 0xe2, 0xfe, 0x3b, 0xc0, 0xfe, 0xcc, 0xc1, 0xfe, 0xff, 0xfc, 0x9f, 0x04, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x03, 0xdb, 0xde, 0x07, 0x59, 0xce, 0x03, 0x97, 
+  0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0x03, 0xff, 0xff, 0x03, 0x59, 0xce, 0x04, 0xbb, 0xde, 0x07, 0x9a, 0xd6, 0x04, 0xd7, 0xbd, 0x04, 0x5d, 0xef, 0x03, 0xdb, 0xde, 0x08, 0xd4, 
+  0xee, 0x1f, 0xae, 0xee, 0x38, 0xbb, 0xd6, 0x24, 0xdf, 0xd6, 0x1f, 0xe2, 0xfe, 0xa3, 0xc1, 0xfe, 0xff, 0xc0, 0xfe, 0xff, 0xc1, 0xfe, 0x8b, 0xc1, 0xfe, 0xff, 0xc2, 0xfe, 0xff, 0xc3, 0xfe, 0xff, 
+  0xc4, 0xfe, 0xff, 0xc5, 0xfe, 0xff, 0xc4, 0xfe, 0xff, 0xc1, 0xfe, 0xff, 0x81, 0xc0, 0xfe, 0xff, 0x02, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xec, 0xc1, 0xfe, 0xac, 0x81, 0xc0, 0xfe, 0xff, 0x00, 0xe1, 
+  0xfe, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x01, 0xc3, 0xfe, 0x37, 0x49, 0xff, 0x08, 0x9b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x03, 0x10, 0x7a, 0xd6, 0x03, 
+  0x59, 0xce, 0x04, 0x3c, 0xe7, 0x03, 0x9e, 0xf7, 0x03, 0x7a, 0xd6, 0x04, 0xbb, 0xd6, 0x04, 0x1d, 0xe7, 0x07, 0xba, 0xd6, 0x0c, 0xbd, 0xd6, 0x1c, 0xe8, 0xf6, 0x83, 0xc1, 0xfe, 0xf0, 0xc4, 0xfe, 
+  0x43, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xef, 0xc1, 0xfe, 0xff, 0xc1, 0xfe, 0xeb, 0xc3, 0xfe, 0x73, 0x81, 0xc1, 0xfe, 0xff, 0x01, 0xc2, 0xfe, 0xec, 0xc1, 0xfe, 0x78, 0x81, 0xc0, 0xfe, 0xff, 0x04, 
+  0xc0, 0xfe, 0xc8, 0x00, 0x00, 0x00, 0xc1, 0xfe, 0x5f, 0xc0, 0xfe, 0xff, 0x01, 0xff, 0x50, 0xa2, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x03, 0x09, 0x7e, 0xf7, 0x03, 0x18, 0xc6, 0x04, 0xff, 0xff, 
+  0x03, 0xbf, 0xff, 0x03, 0x39, 0xce, 0x04, 0xfc, 0xe6, 0x03, 0x3d, 0xef, 0x03, 0x5c, 0xc6, 0x04, 0xcc, 0xf6, 0x2b, 0xcf, 0xf6, 0x28, 0x81, 0x00, 0x00, 0x00, 0x0a, 0xe0, 0xfe, 0x7b, 0xc0, 0xfe, 
+  0xff, 0xc3, 0xfe, 0x33, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0xa7, 0xc0, 0xfe, 0xff, 0xc2, 0xfe, 0x8c, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x5b, 0xc0, 0xfe, 0xff, 0xe0, 0xfe, 0x60, 0x81, 0x00, 0x00, 0x00, 
+  0x01, 0xc0, 0xfe, 0x2c, 0x40, 0xff, 0x1b, 0xa5, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0x03, 0x08, 0x00, 0x00, 0x00, 0x3c, 0xe7, 0x03, 0xdf, 0xff, 0x03, 0x1c, 0xbe, 0x04, 0x3d, 0xe7, 0x08, 0x18, 
+  0xc6, 0x03, 0x00, 0x00, 0x00, 0xe3, 0xfe, 0x27, 0xc1, 0xfe, 0x44, 0x81, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xfe, 0x1f, 0xc0, 0xfe, 0xdf, 0x82, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x9f, 0xb1, 0x00, 
+  0x00, 0x00, 0x02, 0x5d, 0xef, 0x03, 0x7d, 0xef, 0x03, 0x7e, 0xf7, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0xff, 0x40, 0x0f, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0xff, 0x40, 0x23, 0xff, 0x60, 0x3c, 0xff, 0x60, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x40, 0x20, 0xff, 0x20, 0xd4, 0xfe, 0xe0, 0x00, 0xff, 0x80, 0x00, 0xfe, 0x81, 0x00, 0xff, 0x40, 0x84, 0xff, 0xe0, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x23, 0xff, 0x80, 0x0b, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x81, 0x38, 0xff, 0x61, 0x00, 0xff, 0x20, 0xa7, 0xfe, 0xc0, 0xff, 0xff, 0x60, 0x84, 0xff, 0x40, 0x00, 0xff, 0x40, 0x58, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x5c, 0xff, 0x20, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x2f, 0xff, 0x60, 0x20, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x00, 0xff, 0x40, 0x00, 0xff, 0x20, 0x6f, 0xff, 0x20, 0xef, 0xff, 0x60, 0x2b, 0xff, 0x00, 0x00, 0xff, 0x00, 0xe7, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xef, 0xff, 0x60, 0x58, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xeb, 0xff, 0x61, 0x58, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xc7, 0xfe, 0xa1, 0x00, 0xff, 0x60, 0x4b, 0xff, 0x00, 0xff, 0xff, 0x20, 0x4f, 0xff, 0x20, 0x00, 0xff, 0xe0, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x14, 0xff, 0xa0, 0x13, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xff, 0x00, 0x97, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0x60, 0x9b, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xfc, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xef, 0xff, 0x60, 0xb8, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x78, 0xff, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x3f, 0xff, 0x40, 0x0c, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2f, 0xff, 0x20, 0xff, 0xff, 0x40, 0x8c, 0xff, 0xa1, 0x17, 0xff, 0x00, 0xc0, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xab, 0xff, 0x60, 0x24, 0xff, 0x40, 0xac, 0xff, 0x00, 0xff, 0xfe, 0xc0, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0xfe, 0xe0, 0x27, 0xfe, 0xc0, 0xf8, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xef, 0xfe, 0xe0, 0xf8, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x00, 0xff, 0x40, 0x63, 0xff, 0x60, 0x38, 0xff, 0x60, 0x1b, 0xff, 0x00, 0x27, 0xfe, 0xc0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xef, 0xfe, 0x40, 0x00, 0xff, 0x61, 0x1f, 0xff, 0x60, 0x43, 0xff, 0x40, 0x30, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe0, 0x8b, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xec, 0xff, 0x40, 0xdc, 0xfe, 0xe0, 0xfb, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xf8, 0xff, 0x41, 0xd7, 0xff, 0x00, 0xf0, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xff, 0x20, 0x2c, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xe7, 0xfe, 0xe0, 0x14, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x10, 0xff, 0x60, 0x1c, 0xfe, 0xe0, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xc7, 0xff, 0x40, 0x00, 0xff, 0xa3, 0x00, 0xff, 0x60, 0x1c, 0xff, 0x60, 0x0f, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x40, 0x3c, 0xff, 0x20, 0xff, 0xff, 0x40, 0xff, 0xff, 0x40, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x60, 0x18, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x20, 0x03, 0xfe, 0xc0, 0xd3, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x84, 0xfe, 0xe0, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xff, 0x20, 0x00, 0xfe, 0xe0, 0x47, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xef, 0xfe, 0xa0, 0x14, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x60, 0x37, 0xff, 0x60, 0x70, 0xff, 0x60, 0xa7, 0xff, 0x61, 0xc7, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xf7, 0xff, 0x61, 0xc4, 0xff, 0x60, 0x97, 0xff, 0x60, 0x6b, 0xff, 0x60, 0x2b, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xff, 0x20, 0x2f, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x41, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x22, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x21, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x60, 0x0c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xc0, 0x64, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x03, 0xff, 0xff, 0x23, 0xff, 0xff, 0x23, 0xff, 0xff, 0x23, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x42, 0xff, 0xff, 0x43, 0xff, 0xff, 0x44, 0xff, 0xff, 0x26, 0xff, 0xff, 0x26, 0xff, 0xff, 0x25, 0xff, 0xff, 0x23, 0xff, 0xff, 0x02, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf7, 0xfe, 0xc0, 0x30, 0xfe, 0xe0, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x00, 0xff, 0x60, 0x00, 0xff, 0x60, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0xc0, 0xb7, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x05, 0xff, 0xf7, 0x29, 0xff, 0xf7, 0x29, 0xff, 0xf7, 0x27, 0xff, 0xff, 0x45, 0xff, 0xff, 0x44, 0xff, 0xff, 0x43, 0xff, 0xff, 0x42, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x42, 0xff, 0xff, 0x45, 0xff, 0xf7, 0x29, 0xff, 0xf7, 0x29, 0xff, 0xf7, 0x28, 0xff, 0xff, 0x06, 0xff, 0xff, 0x05, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x02, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x9f, 0xfe, 0x61, 0x00, 0xff, 0x60, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x00, 0xff, 0x60, 0x23, 0xff, 0x60, 0x88, 0xff, 0x40, 0xd7, 0xfe, 0xe0, 0xf3, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff, 0x02, 0xff, 0xff, 0x02, 0xff, 0xff, 0x21, 0xff, 0xff, 0x26, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x28, 0xff, 0xff, 0x46, 0xff, 0xff, 0x44, 0xff, 0xff, 0x64, 0xff, 0xff, 0x63, 0xff, 0xff, 0x63, 0xff, 0xff, 0x62, 0xff, 0xff, 0x62, 0xff, 0xff, 0x61, 0xff, 0xff, 0x43, 0xff, 0xf7, 0x27, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x0b, 0xff, 0xf7, 0x09, 0xff, 0xf7, 0x08, 0xff, 0xf7, 0x07, 0xff, 0xff, 0x05, 0xff, 0xfe, 0xe3, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xef, 0xff, 0x40, 0xd3, 0xff, 0x60, 0x74, 0xff, 0x40, 0x0f, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x04, 0xff, 0x20, 0xa0, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x25, 0xff, 0xf7, 0x09, 0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x4a, 0xff, 0xf7, 0x47, 0xff, 0xff, 0x65, 0xff, 0xff, 0x64, 0xff, 0xff, 0x64, 0xff, 0xff, 0x64, 0xff, 0xff, 0x45, 0xff, 0xf7, 0x48, 0xff, 0xf7, 0x29, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x09, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x63, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xc0, 0x54, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0xff, 0xf7, 0x08, 0xff, 0xf7, 0x07, 0xff, 0xff, 0x06, 0xff, 0xf7, 0x08, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x52, 0xff, 0xf7, 0x51, 0xff, 0xf7, 0x51, 0xff, 0xf7, 0x4f, 0xff, 0xf7, 0x4d, 0xff, 0xf7, 0x4a, 0xff, 0xf7, 0x47, 0xff, 0xff, 0x65, 0xff, 0xff, 0x64, 0xff, 0xff, 0x45, 0xff, 0xf7, 0x49, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0b, 0xff, 0xff, 0x05, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x33, 0xff, 0x80, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x5f, 0x00, 0xc6, 0x7f, 0x00, 0xfe, 0xe0, 0x00, 0xfe, 0xe1, 0x80, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0xff, 0xf7, 0x0b, 0xff, 0xf7, 0x0b, 0xff, 0xf7, 0x0a, 0xff, 0xf7, 0x0a, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x52, 0xff, 0xf7, 0x51, 0xff, 0xf7, 0x50, 0xff, 0xf7, 0x50, 0xff, 0xf7, 0x4e, 0xff, 0xf7, 0x4a, 0xff, 0xf7, 0x47, 0xff, 0xff, 0x46, 0xff, 0xf7, 0x48, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x0d, 0xff, 0xff, 0x06, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xf8, 0xff, 0x20, 0x3b, 0xff, 0x40, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x76, 0x00, 0xff, 0xff, 0x00, 0xd6, 0x9a, 0x00, 0xbd, 0xf9, 0x00, 0xff, 0x45, 0x00, 0xef, 0x0d, 0x18, 0xff, 0x47, 0xbc, 0xfe, 0xe6, 0xf8, 0xfe, 0xc4, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe5, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x52, 0xff, 0xf7, 0x4f, 0xff, 0xf7, 0x4d, 0xff, 0xf7, 0x4c, 0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x10, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xef, 0xff, 0x60, 0x94, 0xff, 0x00, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x00, 0xf7, 0xbe, 0x00, 0xd6, 0x9a, 0x08, 0xc6, 0x5a, 0x07, 0xff, 0x43, 0x20, 0xff, 0x21, 0xf0, 0xfe, 0xc7, 0xff, 0xf6, 0xcb, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe2, 0xff, 0xf6, 0xe8, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x51, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0xd4, 0xff, 0x60, 0x04, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x00, 0xd6, 0x9a, 0x07, 0xce, 0x79, 0x17, 0xce, 0x79, 0x13, 0xd6, 0x79, 0x10, 0xee, 0xb4, 0x30, 0xf6, 0xc9, 0xb0, 0xf6, 0xed, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xe9, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x9a, 0xff, 0xf7, 0x9c, 0xff, 0xf7, 0x9c, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x10, 0xff, 0xf6, 0xeb, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x7b, 0xfe, 0xc0, 0x13, 0xff, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xba, 0x00, 0xd6, 0x9a, 0x0f, 0xde, 0xdb, 0x28, 0xd6, 0x7a, 0x1b, 0xd6, 0xba, 0x1f, 0xde, 0xba, 0x2c, 0xde, 0xfd, 0x48, 0xee, 0xf3, 0xb8, 0xf6, 0xf0, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x13, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc1, 0xf8, 0xff, 0x02, 0x37, 0xff, 0x01, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7a, 0x00, 0xce, 0x59, 0x13, 0xde, 0xdb, 0x47, 0xde, 0xdb, 0x27, 0xde, 0xbb, 0x1f, 0xd6, 0x9e, 0x27, 0xef, 0x10, 0x8b, 0xf6, 0xea, 0xfb, 0xf6, 0xeb, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0e, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xf0, 0xff, 0x81, 0x3f, 0xff, 0x60, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0x00, 0xe7, 0x1c, 0x08, 0xd6, 0xba, 0x33, 0xde, 0xbb, 0x30, 0xde, 0xfc, 0x23, 0xf7, 0x28, 0x80, 0xfe, 0xe6, 0xff, 0xf6, 0xc8, 0xff, 0xf6, 0xc7, 0xff, 0xf6, 0xec, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x9b, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf6, 0xee, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x60, 0x3b, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x00, 0xf7, 0xbe, 0x00, 0xde, 0xbb, 0x0b, 0xd6, 0xba, 0x18, 0xd6, 0xb9, 0x20, 0xee, 0xf1, 0x3b, 0xf6, 0xcd, 0x8b, 0xf6, 0xc9, 0xeb, 0xf6, 0xc8, 0xff, 0xf6, 0xc7, 0xff, 0xf6, 0xeb, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x11, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xc4, 0xfe, 0xc0, 0x58, 0xff, 0x20, 0x18, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7d, 0x00, 0xe7, 0x1c, 0x04, 0xd6, 0xba, 0x0b, 0xce, 0x79, 0x10, 0xd6, 0xdd, 0x1b, 0xbe, 0x9f, 0x1c, 0xf6, 0xe9, 0xaf, 0xfe, 0xc5, 0xff, 0xfe, 0xc5, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xed, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0a, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xeb, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x10, 0xff, 0xf6, 0xed, 0xff, 0xf6, 0xc8, 0xff, 0xf6, 0xc8, 0x8c, 0xff, 0xe0, 0x00, 0xfe, 0xcc, 0x00, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x79, 0x03, 0xde, 0xdb, 0x07, 0xde, 0xbb, 0x0b, 0xce, 0x9f, 0x0b, 0xff, 0x47, 0x7b, 0xfe, 0xe3, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe6, 0xff, 0xf6, 0xe7, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x0c, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe9, 0xf8, 0xef, 0x0f, 0x40, 0xde, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0x7a, 0x07, 0xde, 0xfb, 0x08, 0xde, 0xdb, 0x0b, 0xd6, 0xbc, 0x0c, 0xf7, 0x2c, 0x3f, 0xfe, 0xe2, 0xfb, 0xfe, 0xc3, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xe6, 0xff, 0xfe, 0xe6, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0c, 0xff, 0xfe, 0xe6, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe6, 0xff, 0xfe, 0xc6, 0xff, 0xfe, 0xc6, 0xff, 0xfe, 0xc6, 0xff, 0xff, 0x04, 0xf0, 0xff, 0xc0, 0x08, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0x9a, 0x07, 0xd6, 0x7a, 0x10, 0xd6, 0x7a, 0x18, 0xce, 0x7a, 0x17, 0xee, 0xf2, 0x2f, 0xf6, 0xc9, 0x6c, 0xfe, 0xc6, 0x8c, 0xfe, 0xc5, 0xb3, 0xfe, 0xc5, 0xff, 0xfe, 0xc6, 0xff, 0xf6, 0xc7, 0xff, 0xf6, 0xea, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0b, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe3, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xc3, 0xf3, 0xfe, 0xc3, 0xa7, 0xfe, 0xc3, 0x83, 0xfe, 0xc5, 0x53, 0xff, 0x80, 0x13, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x1c, 0x00, 0xef, 0x5d, 0x00, 0xd6, 0xba, 0x07, 0xd6, 0x7a, 0x13, 0xde, 0xdb, 0x24, 0xde, 0xdb, 0x2c, 0xde, 0xdb, 0x2c, 0xde, 0xfd, 0x24, 0xd6, 0xde, 0x24, 0xee, 0xee, 0x60, 0xfe, 0xc6, 0xff, 0xf6, 0xc9, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xee, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x59, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xe9, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe3, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xec, 0xff, 0x2f, 0x1b, 0x8e, 0x7f, 0x04, 0xef, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x00, 0xd6, 0x7a, 0x04, 0xd6, 0xba, 0x13, 0xde, 0xbb, 0x1c, 0xde, 0xfb, 0x34, 0xe6, 0xfc, 0x58, 0xde, 0xfb, 0x5f, 0xde, 0xfb, 0x4f, 0xde, 0xfa, 0x4f, 0xf6, 0xec, 0xdf, 0xf6, 0xed, 0xff, 0xf6, 0xf0, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x36, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7b, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xeb, 0xff, 0xfe, 0xe6, 0xff, 0xfe, 0xe3, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x83, 0xff, 0x80, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x00, 0xe7, 0x1c, 0x07, 0xd6, 0x7a, 0x18, 0xd6, 0xba, 0x1c, 0xde, 0xdb, 0x28, 0xde, 0xfb, 0x54, 0xe6, 0xfc, 0x67, 0xe6, 0xfc, 0x64, 0xef, 0x16, 0x80, 0xf6, 0xee, 0xf8, 0xf7, 0x12, 0xf8, 0xf7, 0x36, 0xfb, 0xf7, 0x36, 0xfc, 0xf7, 0x58, 0xff, 0xf7, 0x59, 0xff, 0xf7, 0x59, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x59, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x9c, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x0b, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc1, 0xf7, 0xfe, 0xc0, 0xec, 0xfe, 0xc0, 0xef, 0xfe, 0xe0, 0xff, 0xff, 0xe0, 0x08, 0xff, 0x6f, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x00, 0xd6, 0x7a, 0x0b, 0xde, 0xbb, 0x20, 0xde, 0xdb, 0x24, 0xd6, 0xba, 0x2f, 0xde, 0xdb, 0x3f, 0xde, 0xfb, 0x43, 0xde, 0xfb, 0x4b, 0xe6, 0xf9, 0x5c, 0xe6, 0xf8, 0x7c, 0xef, 0x1b, 0x9f, 0xef, 0x5d, 0xc7, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x36, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x36, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x11, 0xff, 0xfe, 0xe6, 0xff, 0xf6, 0xe7, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xef, 0xff, 0xf6, 0xee, 0xff, 0xf6, 0xeb, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc1, 0xd3, 0xfe, 0xe8, 0x1c, 0xfe, 0xc0, 0x1c, 0xfe, 0xc0, 0x28, 0xff, 0x60, 0x0f, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x00, 0xde, 0xbb, 0x0c, 0xde, 0xdb, 0x2b, 0xde, 0xbb, 0x33, 0xde, 0xfb, 0x3b, 0xde, 0xdb, 0x40, 0xde, 0xdb, 0x3b, 0xde, 0xdb, 0x34, 0xde, 0xdb, 0x3f, 0xde, 0xdb, 0x54, 0xe7, 0x1c, 0x74, 0xef, 0x3a, 0xbb, 0xf7, 0x34, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x36, 0xff, 0xf7, 0x36, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x13, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xe7, 0xff, 0xff, 0x04, 0xff, 0xf6, 0xe7, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xea, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xeb, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x12, 0xff, 0xf6, 0xed, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe9, 0xff, 0xf6, 0xc8, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc1, 0xe7, 0xff, 0x49, 0x18, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xb5, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x1c, 0x00, 0xef, 0x5d, 0x07, 0xd6, 0xba, 0x20, 0xd6, 0xba, 0x30, 0xde, 0xdb, 0x3c, 0xde, 0xfb, 0x50, 0xde, 0xfb, 0x50, 0xde, 0xdb, 0x40, 0xde, 0xbb, 0x38, 0xde, 0xdb, 0x4b, 0xe7, 0x1c, 0x63, 0xef, 0x12, 0xc4, 0xf6, 0xf0, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x14, 0xf3, 0xf7, 0x12, 0xfc, 0xf6, 0xef, 0xff, 0xf6, 0xed, 0xff, 0xf6, 0xed, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x11, 0xff, 0xf6, 0xee, 0xff, 0xf6, 0xe9, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe7, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe5, 0xff, 0xf6, 0xe8, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe6, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xed, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xc6, 0xff, 0xfe, 0xc5, 0xf7, 0xfe, 0xc5, 0xe3, 0xfe, 0xc2, 0xff, 0xfe, 0xc1, 0xff, 0xff, 0x23, 0x2c, 0xff, 0xdf, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x79, 0x00, 0xce, 0x39, 0x03, 0xde, 0xdb, 0x0f, 0xd6, 0x9a, 0x18, 0xde, 0xdb, 0x23, 0xde, 0xdb, 0x43, 0xde, 0xdb, 0x53, 0xde, 0xdb, 0x4b, 0xde, 0xdb, 0x3c, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x40, 0xf6, 0xee, 0xa8, 0xee, 0xf2, 0x9f, 0xe7, 0x1b, 0x83, 0xe7, 0x1b, 0xa0, 0xf6, 0xee, 0xf8, 0xf6, 0xc8, 0xff, 0xfe, 0xc7, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xee, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe3, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe4, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe6, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc3, 0xf3, 0x76, 0xdf, 0x0f, 0xee, 0xb0, 0x37, 0xfe, 0xc5, 0x7f, 0xff, 0x03, 0x48, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0x03, 0xde, 0xdb, 0x08, 0xde, 0xfb, 0x0b, 0xde, 0xfb, 0x0f, 0xd6, 0xba, 0x28, 0xde, 0xdb, 0x38, 0xde, 0xdb, 0x3c, 0xde, 0xdb, 0x2c, 0xde, 0xbb, 0x1f, 0xce, 0x7c, 0x13, 0xde, 0xdc, 0x28, 0xde, 0xdb, 0x47, 0xe7, 0x19, 0x88, 0xf6, 0xed, 0xfb, 0xf6, 0xc8, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc5, 0xfb, 0xf6, 0xc7, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe9, 0xff, 0xf6, 0xe9, 0xff, 0xf6, 0xe9, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xc7, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xc2, 0xff, 0x05, 0x9f, 0x07, 0xd6, 0x9b, 0x0f, 0xce, 0xde, 0x0c, 0xce, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xc5, 0xf8, 0x03, 0xce, 0x39, 0x03, 0xce, 0x79, 0x04, 0xce, 0x39, 0x0c, 0xd6, 0x9a, 0x17, 0xde, 0xfb, 0x20, 0xd6, 0xba, 0x0c, 0xe6, 0xfc, 0x07, 0xd6, 0x9a, 0x0b, 0xde, 0xfb, 0x1b, 0xee, 0xd4, 0x60, 0xf6, 0xc7, 0xf4, 0xf6, 0xca, 0xc7, 0xe6, 0xb3, 0x2f, 0xfe, 0xc2, 0xc4, 0xfe, 0xc2, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xe6, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xc9, 0xff, 0xfe, 0xe7, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xa4, 0xfe, 0xe2, 0x3b, 0xfe, 0xc0, 0xcc, 0xfe, 0xc1, 0xff, 0x9f, 0xfc, 0x04, 0xff, 0xff, 0x00, 0xc6, 0x38, 0x03, 0xde, 0xdb, 0x07, 0xce, 0x59, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xf7, 0x9e, 0x03, 0xff, 0xff, 0x03, 0xce, 0x59, 0x04, 0xde, 0xbb, 0x07, 0xd6, 0x9a, 0x04, 0xbd, 0xd7, 0x04, 0xef, 0x5d, 0x03, 0xde, 0xdb, 0x08, 0xee, 0xd4, 0x1f, 0xee, 0xae, 0x38, 0xd6, 0xbb, 0x24, 0xd6, 0xdf, 0x1f, 0xfe, 0xe2, 0xa3, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc1, 0x8b, 0xfe, 0xc1, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xec, 0xfe, 0xc1, 0xac, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe1, 0x7b, 0xfe, 0xa0, 0x00, 0xfe, 0xab, 0x00, 0xfe, 0xc3, 0x37, 0xff, 0x49, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x1c, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x76, 0x00, 0xb5, 0x96, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xd6, 0x7a, 0x03, 0xce, 0x59, 0x04, 0xe7, 0x3c, 0x03, 0xf7, 0x9e, 0x03, 0xd6, 0x7a, 0x04, 0xd6, 0xbb, 0x04, 0xe7, 0x1d, 0x07, 0xd6, 0xba, 0x0c, 0xd6, 0xbd, 0x1c, 0xf6, 0xe8, 0x83, 0xfe, 0xc1, 0xf0, 0xfe, 0xc4, 0x43, 0xfe, 0x80, 0x00, 0xfe, 0xc0, 0xef, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xeb, 0xfe, 0xc3, 0x73, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc2, 0xec, 0xfe, 0xc1, 0x78, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xc8, 0xfe, 0xe0, 0x00, 0xfe, 0xc1, 0x5f, 0xfe, 0xc0, 0xff, 0xff, 0x01, 0x50, 0xfe, 0xe0, 0x00, 0xfd, 0x80, 0x00, 0xfe, 0xeb, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0x76, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xf7, 0x7e, 0x03, 0xc6, 0x18, 0x04, 0xff, 0xff, 0x03, 0xff, 0xbf, 0x03, 0xce, 0x39, 0x04, 0xe6, 0xfc, 0x03, 0xef, 0x3d, 0x03, 0xc6, 0x5c, 0x04, 0xf6, 0xcc, 0x2b, 0xf6, 0xcf, 0x28, 0x05, 0x5f, 0x00, 0xfe, 0xc0, 0x00, 0xfe, 0xe0, 0x7b, 0xfe, 0xc0, 0xff, 0xfe, 0xc3, 0x33, 0xfe, 0xc0, 0x00, 0xfe, 0xc0, 0xa7, 0xfe, 0xc0, 0xff, 0xfe, 0xc2, 0x8c, 0xfe, 0x80, 0x00, 0xfe, 0xc0, 0x5b, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x60, 0xfe, 0x20, 0x00, 0xfd, 0xa0, 0x00, 0xfe, 0xc0, 0x2c, 0xff, 0x40, 0x1b, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x76, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xe7, 0x3c, 0x03, 0xff, 0xdf, 0x03, 0xbe, 0x1c, 0x04, 0xe7, 0x3d, 0x08, 0xc6, 0x18, 0x03, 0xff, 0xff, 0x00, 0xfe, 0xe3, 0x27, 0xfe, 0xc1, 0x44, 0xfe, 0x60, 0x00, 0xff, 0x9b, 0x00, 0xfe, 0xe0, 0x1f, 0xfe, 0xc0, 0xdf, 0xfe, 0x20, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x60, 0x00, 0xfe, 0xc0, 0x9f, 0xff, 0xe1, 0x00, 0xff, 0x4d, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x80, 0x00, 0xff, 0x40, 0x00, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x76, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5d, 0x03, 0xef, 0x7d, 0x03, 0xf7, 0x7e, 0x03, 0xff, 0xff, 0x00, 0xff, 0xf9, 0x00, 0xfe, 0x40, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xc0, 0x13, 0xfe, 0xe1, 0x00, 0xff, 0xff, 0x00, 0xff, 0x2c, 0x00, 0xff, 0xe4, 0x00, 0xff, 0x40, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x76, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x0f, 0xb9, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x23, 
+  0xff, 0x60, 0x3c, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x20, 0xff, 0x20, 0xd4, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x84, 0xb1, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x23, 0xff, 0x80, 
+  0x0b, 0x81, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x20, 0x7b, 0xff, 0x00, 0xff, 0xff, 0x81, 0x38, 0x00, 0x00, 0x00, 0xff, 0x20, 0xa7, 0xfe, 0xc0, 0xff, 0xff, 0x60, 0x84, 0x00, 0x00, 0x00, 0xff, 0x40, 
+  0x58, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x5c, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x2f, 0xff, 0x60, 0x20, 0xac, 0x00, 0x00, 0x00, 0x12, 0xff, 0x20, 0x6f, 0xff, 0x20, 0xef, 0xff, 0x60, 0x2b, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0xe7, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xef, 0xff, 0x60, 0x58, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xeb, 0xff, 0x61, 0x58, 0xff, 0x00, 0xff, 0xfe, 0xc0, 
+  0xff, 0xff, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xff, 0x60, 0x4b, 0xff, 0x00, 0xff, 0xff, 0x20, 0x4f, 0xa8, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x14, 0xff, 0xa0, 0x13, 0x81, 0x00, 0x00, 0x00, 0x03, 
+  0xff, 0x00, 0x97, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0x60, 0x9b, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xe0, 0xfc, 0x82, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 
+  0x04, 0xfe, 0xe0, 0xef, 0xff, 0x60, 0xb8, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x78, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x3f, 0xff, 0x40, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x04, 
+  0xff, 0x00, 0x2f, 0xff, 0x20, 0xff, 0xff, 0x40, 0x8c, 0xff, 0xa1, 0x17, 0xff, 0x00, 0xc0, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0x8a, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 
+  0xc0, 0xff, 0x03, 0xff, 0x00, 0xab, 0xff, 0x60, 0x24, 0xff, 0x40, 0xac, 0xff, 0x00, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xe0, 0x27, 0xfe, 0xc0, 0xf8, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xef, 
+  0xfe, 0xe0, 0xf8, 0x90, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xe0, 0xf7, 0xff, 0x00, 0xfb, 0x81, 0xfe, 0xc0, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x04, 0xff, 0x40, 0x63, 0xff, 0x60, 0x38, 0xff, 0x60, 0x1b, 
+  0xff, 0x00, 0x27, 0xfe, 0xc0, 0xf3, 0x81, 0xfe, 0xc0, 0xff, 0x92, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x04, 0xfe, 0xc0, 0xef, 0x00, 0x00, 0x00, 0xff, 0x61, 0x1f, 0xff, 0x60, 0x43, 0xff, 
+  0x40, 0x30, 0x9e, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xe0, 0x8b, 0xfe, 0xe0, 0xff, 0xff, 0x20, 0xec, 0xff, 0x40, 0xdc, 0xfe, 0xe0, 0xfb, 0x85, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x86, 0xff, 
+  0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xe0, 0xf8, 0xff, 0x41, 0xd7, 0xff, 0x00, 0xf0, 0xfe, 0xe0, 0xff, 0xfe, 0xe0, 0x30, 0x9e, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0x20, 0x2c, 0x82, 0xfe, 0xc0, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x8a, 0xff, 0x01, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 
+  0xc0, 0xe7, 0xfe, 0xe0, 0x14, 0x9b, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x10, 0xff, 0x60, 0x1c, 0x81, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0xf0, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 
+  0xfe, 0xe1, 0xff, 0x90, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xc7, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0x60, 0x1c, 0xff, 0x60, 
+  0x0f, 0x98, 0x00, 0x00, 0x00, 0x01, 0xff, 0x40, 0x3c, 0xff, 0x20, 0xff, 0x81, 0xff, 0x40, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x85, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 
+  0x86, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xfe, 0xe0, 0xff, 0x00, 0xff, 0x40, 0xff, 0x81, 0xff, 0x20, 0xff, 0x00, 0xff, 0x60, 0x18, 0x98, 0x00, 0x00, 0x00, 0x01, 0xff, 0x20, 0x03, 
+  0xfe, 0xc0, 0xd3, 0x82, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x8c, 0xff, 0x21, 0xff, 0x84, 0xff, 0x01, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x81, 
+  0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0x84, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0x47, 0x81, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x84, 0xff, 0x01, 0xff, 0x8d, 
+  0xff, 0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xef, 0xfe, 0xa0, 0x14, 0x97, 0x00, 0x00, 0x00, 0x04, 0xff, 0x60, 
+  0x37, 0xff, 0x60, 0x70, 0xff, 0x60, 0xa7, 0xff, 0x61, 0xc7, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xff, 0x01, 0xff, 0x84, 0xff, 0x21, 0xff, 0x86, 0xff, 0x41, 
+  0xff, 0x85, 0xff, 0x21, 0xff, 0x82, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x04, 0xfe, 0xe0, 0xf7, 0xff, 0x61, 0xc4, 0xff, 0x60, 0x97, 0xff, 0x60, 0x6b, 0xff, 0x60, 
+  0x2b, 0x94, 0x00, 0x00, 0x00, 0x01, 0xff, 0x20, 0x2f, 0xfe, 0xe0, 0xff, 0x82, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x83, 0xff, 0x21, 0xff, 
+  0x82, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x00, 0xff, 0x41, 0xff, 0x82, 0xff, 0x42, 0xff, 0x00, 0xff, 0x22, 0xff, 0x82, 0xff, 0x21, 0xff, 0x83, 0xff, 0x01, 0xff, 0x83, 0xfe, 0xe0, 0xff, 
+  0x03, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x60, 0x0c, 0x95, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x64, 0x82, 0xfe, 0xc0, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 
+  0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0xff, 0x82, 0xff, 0x23, 0xff, 0x87, 0xff, 0x42, 0xff, 0x01, 0xff, 0x43, 0xff, 0xff, 0x44, 0xff, 0x81, 0xff, 0x26, 0xff, 0x02, 0xff, 0x25, 0xff, 
+  0xff, 0x23, 0xff, 0xff, 0x02, 0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xf7, 0xfe, 0xc0, 0x30, 0x97, 0x00, 0x00, 0x00, 
+  0x01, 0xfe, 0xc0, 0xb7, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xfe, 0xe1, 0xff, 0x83, 0xff, 0x01, 0xff, 0x00, 0xff, 0x05, 0xff, 0x81, 0xf7, 0x29, 0xff, 0x04, 0xf7, 0x27, 0xff, 0xff, 
+  0x45, 0xff, 0xff, 0x44, 0xff, 0xff, 0x43, 0xff, 0xff, 0x42, 0xff, 0x84, 0xff, 0x62, 0xff, 0x01, 0xff, 0x42, 0xff, 0xff, 0x45, 0xff, 0x81, 0xf7, 0x29, 0xff, 0x05, 0xf7, 0x28, 0xff, 0xff, 0x06, 
+  0xff, 0xff, 0x05, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x02, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x9f, 0x95, 0x00, 0x00, 0x00, 
+  0x04, 0xff, 0x60, 0x23, 0xff, 0x60, 0x88, 0xff, 0x40, 0xd7, 0xfe, 0xe0, 0xf3, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x00, 0xff, 0x01, 0xff, 0x82, 0xff, 0x02, 0xff, 0x09, 0xff, 0x21, 0xff, 
+  0xff, 0x26, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x2f, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x28, 0xff, 0xff, 0x46, 0xff, 0xff, 0x44, 0xff, 0xff, 0x64, 0xff, 0x81, 0xff, 0x63, 0xff, 0x81, 
+  0xff, 0x62, 0xff, 0x0a, 0xff, 0x61, 0xff, 0xff, 0x43, 0xff, 0xf7, 0x27, 0xff, 0xf7, 0x2b, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x0b, 0xff, 0xf7, 0x09, 0xff, 0xf7, 0x08, 0xff, 0xf7, 0x07, 0xff, 0xff, 
+  0x05, 0xff, 0xfe, 0xe3, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x05, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xef, 0xff, 0x40, 0xd3, 0xff, 0x60, 0x74, 0xff, 0x40, 0x0f, 0x91, 0x00, 0x00, 0x00, 
+  0x02, 0xff, 0xc0, 0x04, 0xff, 0x20, 0xa0, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x83, 0xfe, 0xe0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x82, 0xff, 0x04, 0xff, 0x03, 0xff, 0x25, 0xff, 0xf7, 0x09, 
+  0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x32, 0xff, 0x81, 0xf7, 0x31, 0xff, 0x04, 0xf7, 0x2f, 0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x4a, 0xff, 0xf7, 0x47, 0xff, 0xff, 0x65, 0xff, 0x82, 0xff, 0x64, 0xff, 0x03, 
+  0xff, 0x45, 0xff, 0xf7, 0x48, 0xff, 0xf7, 0x29, 0xff, 0xf7, 0x2b, 0xff, 0x82, 0xf7, 0x2e, 0xff, 0x04, 0xf7, 0x0e, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x09, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe0, 0xff, 
+  0x81, 0xfe, 0xe1, 0xff, 0x00, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0x63, 0x93, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x54, 0x81, 0xfe, 0xc0, 0xff, 0x82, 
+  0xfe, 0xe0, 0xff, 0x0a, 0xfe, 0xe1, 0xff, 0xff, 0x00, 0xff, 0xf7, 0x08, 0xff, 0xf7, 0x07, 0xff, 0xff, 0x06, 0xff, 0xf7, 0x08, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x54, 0xff, 0xf7, 
+  0x53, 0xff, 0xf7, 0x52, 0xff, 0x81, 0xf7, 0x51, 0xff, 0x0b, 0xf7, 0x4f, 0xff, 0xf7, 0x4d, 0xff, 0xf7, 0x4a, 0xff, 0xf7, 0x47, 0xff, 0xff, 0x65, 0xff, 0xff, 0x64, 0xff, 0xff, 0x45, 0xff, 0xf7, 
+  0x49, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x2e, 0xff, 0xf7, 0x2f, 0xff, 0x81, 0xf7, 0x30, 0xff, 0x04, 0xf7, 0x10, 0xff, 0xf7, 0x0b, 0xff, 0xff, 0x05, 0xff, 0xff, 0x00, 0xff, 0xfe, 
+  0xe1, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 0xc0, 0x33, 0x95, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xe1, 0x80, 0xfe, 0xc0, 0xff, 0x82, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xe1, 
+  0xff, 0xff, 0x00, 0xff, 0x81, 0xf7, 0x0b, 0xff, 0x81, 0xf7, 0x0a, 0xff, 0x07, 0xf7, 0x2f, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 
+  0x52, 0xff, 0xf7, 0x51, 0xff, 0x81, 0xf7, 0x50, 0xff, 0x06, 0xf7, 0x4e, 0xff, 0xf7, 0x4a, 0xff, 0xf7, 0x47, 0xff, 0xff, 0x46, 0xff, 0xf7, 0x48, 0xff, 0xf7, 0x2c, 0xff, 0xf7, 0x2f, 0xff, 0x81, 
+  0xf7, 0x30, 0xff, 0x00, 0xf7, 0x31, 0xff, 0x81, 0xf7, 0x32, 0xff, 0x01, 0xf7, 0x0d, 0xff, 0xff, 0x06, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x01, 0xfe, 0xc0, 0xf8, 0xff, 0x20, 
+  0x3b, 0x94, 0x00, 0x00, 0x00, 0x05, 0xef, 0x0d, 0x18, 0xff, 0x47, 0xbc, 0xfe, 0xe6, 0xf8, 0xfe, 0xc4, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xe2, 0xff, 0x81, 0xfe, 0xe1, 0xff, 0x02, 0xfe, 0xe5, 0xff, 
+  0xf7, 0x0c, 0xff, 0xf7, 0x0d, 0xff, 0x81, 0xf7, 0x0c, 0xff, 0x02, 0xf7, 0x30, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x79, 0xff, 0x81, 0xf7, 0x7a, 0xff, 0x02, 0xf7, 0x78, 0xff, 0xf7, 0x56, 0xff, 0xf7, 
+  0x54, 0xff, 0x82, 0xf7, 0x53, 0xff, 0x06, 0xf7, 0x52, 0xff, 0xf7, 0x4f, 0xff, 0xf7, 0x4d, 0xff, 0xf7, 0x4c, 0xff, 0xf7, 0x2d, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x53, 0xff, 0x82, 0xf7, 0x55, 0xff, 
+  0x04, 0xf7, 0x34, 0xff, 0xf7, 0x10, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe2, 0xff, 0x81, 0xfe, 0xe0, 0xff, 0x02, 0xfe, 0xc0, 0xff, 0xff, 0x00, 0xef, 0xff, 0x60, 0x94, 0x90, 0x00, 
+  0x00, 0x00, 0x0d, 0xd6, 0x9a, 0x08, 0xc6, 0x5a, 0x07, 0xff, 0x43, 0x20, 0xff, 0x21, 0xf0, 0xfe, 0xc7, 0xff, 0xf6, 0xcb, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe4, 
+  0xff, 0xfe, 0xe2, 0xff, 0xf6, 0xe8, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x31, 0xff, 0x81, 0xf7, 0x30, 0xff, 0x03, 0xf7, 0x32, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x7a, 0xff, 0x81, 0xf7, 
+  0x9b, 0xff, 0x08, 0xf7, 0x7a, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x51, 0xff, 0x81, 0xf7, 
+  0x30, 0xff, 0x01, 0xf7, 0x32, 0xff, 0xf7, 0x55, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x04, 0xf7, 0x56, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xe5, 0xff, 0x81, 0xfe, 0xe1, 
+  0xff, 0x81, 0xfe, 0xc0, 0xff, 0x02, 0xfe, 0xe0, 0xff, 0xff, 0x40, 0xd4, 0xff, 0x60, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x06, 0xd6, 0x9a, 0x07, 0xce, 0x79, 0x17, 0xce, 0x79, 0x13, 0xd6, 0x79, 0x10, 
+  0xee, 0xb4, 0x30, 0xf6, 0xc9, 0xb0, 0xf6, 0xed, 0xff, 0x81, 0xf7, 0x10, 0xff, 0x06, 0xf7, 0x0f, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xe9, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x35, 0xff, 
+  0xf7, 0x54, 0xff, 0x81, 0xf7, 0x55, 0xff, 0x03, 0xf7, 0x56, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x9a, 0xff, 0x81, 0xf7, 0x9c, 0xff, 0x03, 0xf7, 0x9b, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 
+  0x78, 0xff, 0xf7, 0x77, 0xff, 0x81, 0xf7, 0x55, 0xff, 0x00, 0xf7, 0x56, 0xff, 0x81, 0xf7, 0x55, 0xff, 0x0f, 0xf7, 0x53, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x57, 
+  0xff, 0xf7, 0x58, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x10, 0xff, 0xf6, 0xeb, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0x7b, 0xfe, 
+  0xc0, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x0a, 0xd6, 0x9a, 0x0f, 0xde, 0xdb, 0x28, 0xd6, 0x7a, 0x1b, 0xd6, 0xba, 0x1f, 0xde, 0xba, 0x2c, 0xde, 0xfd, 0x48, 0xee, 0xf3, 0xb8, 0xf6, 0xf0, 0xff, 0xf7, 
+  0x12, 0xff, 0xf7, 0x13, 0xff, 0xf7, 0x12, 0xff, 0x81, 0xf7, 0x10, 0xff, 0x00, 0xf7, 0x33, 0xff, 0x81, 0xf7, 0x56, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x00, 0xf7, 0x78, 0xff, 0x81, 0xf7, 0x79, 0xff, 
+  0x00, 0xf7, 0x7a, 0xff, 0x84, 0xf7, 0x9b, 0xff, 0x01, 0xf7, 0x79, 0xff, 0xf7, 0x77, 0xff, 0x82, 0xf7, 0x56, 0xff, 0x81, 0xf7, 0x55, 0xff, 0x00, 0xf7, 0x33, 0xff, 0x81, 0xf7, 0x32, 0xff, 0x09, 
+  0xf7, 0x55, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc1, 0xf8, 0xff, 0x02, 0x37, 0x90, 0x00, 
+  0x00, 0x00, 0x0d, 0xce, 0x59, 0x13, 0xde, 0xdb, 0x47, 0xde, 0xdb, 0x27, 0xde, 0xbb, 0x1f, 0xd6, 0x9e, 0x27, 0xef, 0x10, 0x8b, 0xf6, 0xea, 0xfb, 0xf6, 0xeb, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x35, 
+  0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x00, 0xf7, 0x79, 0xff, 0x82, 0xf7, 0x78, 0xff, 0x01, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 
+  0x84, 0xf7, 0x9b, 0xff, 0x01, 0xf7, 0x7a, 0xff, 0xf7, 0x78, 0xff, 0x81, 0xf7, 0x77, 0xff, 0x00, 0xf7, 0x56, 0xff, 0x81, 0xf7, 0x55, 0xff, 0x0d, 0xf7, 0x33, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x2f, 
+  0xff, 0xf7, 0x31, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0e, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe0, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0xf0, 0xff, 
+  0x81, 0x3f, 0x8f, 0x00, 0x00, 0x00, 0x0f, 0xe7, 0x1c, 0x08, 0xd6, 0xba, 0x33, 0xde, 0xbb, 0x30, 0xde, 0xfc, 0x23, 0xf7, 0x28, 0x80, 0xfe, 0xe6, 0xff, 0xf6, 0xc8, 0xff, 0xf6, 0xc7, 0xff, 0xf6, 
+  0xec, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0x81, 0xf7, 0x79, 0xff, 0x81, 0xf7, 0x78, 0xff, 0x02, 
+  0xf7, 0x77, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0x83, 0xf7, 0x9b, 0xff, 0x00, 0xf7, 0x79, 0xff, 0x81, 0xf7, 0x78, 0xff, 0x81, 0xf7, 0x77, 0xff, 0x0c, 0xf7, 0x57, 0xff, 0xf7, 0x56, 0xff, 
+  0xf7, 0x54, 0xff, 0xf7, 0x30, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 0xf6, 0xee, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe2, 
+  0xff, 0x81, 0xfe, 0xc0, 0xff, 0x01, 0xff, 0x00, 0xff, 0xff, 0x60, 0x3b, 0x8f, 0x00, 0x00, 0x00, 0x0e, 0xde, 0xbb, 0x0b, 0xd6, 0xba, 0x18, 0xd6, 0xb9, 0x20, 0xee, 0xf1, 0x3b, 0xf6, 0xcd, 0x8b, 
+  0xf6, 0xc9, 0xeb, 0xf6, 0xc8, 0xff, 0xf6, 0xc7, 0xff, 0xf6, 0xeb, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0x82, 0xf7, 
+  0x79, 0xff, 0x81, 0xf7, 0x78, 0xff, 0x00, 0xf7, 0x79, 0xff, 0x84, 0xf7, 0x7a, 0xff, 0x01, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0x82, 0xf7, 0x56, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x0e, 0xf7, 0x56, 
+  0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0c, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x11, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 
+  0xc0, 0xff, 0xfe, 0xc0, 0xc4, 0xfe, 0xc0, 0x58, 0xff, 0x20, 0x18, 0x90, 0x00, 0x00, 0x00, 0x05, 0xe7, 0x1c, 0x04, 0xd6, 0xba, 0x0b, 0xce, 0x79, 0x10, 0xd6, 0xdd, 0x1b, 0xbe, 0x9f, 0x1c, 0xf6, 
+  0xe9, 0xaf, 0x81, 0xfe, 0xc5, 0xff, 0x06, 0xf6, 0xea, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xed, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x78, 0xff, 0x83, 0xf7, 0x79, 0xff, 
+  0x81, 0xf7, 0x78, 0xff, 0x81, 0xf7, 0x79, 0xff, 0x81, 0xf7, 0x7a, 0xff, 0x03, 0xf7, 0x79, 0xff, 0xf7, 0x78, 0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0x81, 0xf7, 0x54, 0xff, 0x0c, 0xf7, 0x55, 
+  0xff, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0a, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xeb, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x10, 0xff, 0xf6, 0xed, 0xff, 0xf6, 
+  0xc8, 0xff, 0xf6, 0xc8, 0x8c, 0x93, 0x00, 0x00, 0x00, 0x0d, 0xce, 0x79, 0x03, 0xde, 0xdb, 0x07, 0xde, 0xbb, 0x0b, 0xce, 0x9f, 0x0b, 0xff, 0x47, 0x7b, 0xfe, 0xe3, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 
+  0xc4, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe6, 0xff, 0xf6, 0xe7, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x55, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x00, 0xf7, 0x58, 0xff, 0x85, 0xf7, 0x78, 0xff, 
+  0x82, 0xf7, 0x79, 0xff, 0x0a, 0xf7, 0x78, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x31, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x33, 0xff, 
+  0xf7, 0x30, 0xff, 0xf7, 0x0c, 0xff, 0x81, 0xf6, 0xe8, 0xff, 0x00, 0xf6, 0xea, 0xff, 0x81, 0xf6, 0xeb, 0xff, 0x02, 0xf6, 0xea, 0xff, 0xf6, 0xe9, 0xf8, 0xef, 0x0f, 0x40, 0x91, 0x00, 0x00, 0x00, 
+  0x05, 0xd6, 0x7a, 0x07, 0xde, 0xfb, 0x08, 0xde, 0xdb, 0x0b, 0xd6, 0xbc, 0x0c, 0xf7, 0x2c, 0x3f, 0xfe, 0xe2, 0xfb, 0x81, 0xfe, 0xc3, 0xff, 0x01, 0xfe, 0xc4, 0xff, 0xfe, 0xc5, 0xff, 0x81, 0xfe, 
+  0xe6, 0xff, 0x02, 0xf7, 0x0e, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x34, 0xff, 0x83, 0xf7, 0x56, 0xff, 0x87, 0xf7, 0x57, 0xff, 0x04, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x31, 
+  0xff, 0xf7, 0x2e, 0xff, 0x81, 0xf7, 0x2f, 0xff, 0x04, 0xf7, 0x0f, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x0c, 0xff, 0xfe, 0xe6, 0xff, 0x81, 0xfe, 0xe5, 0xff, 0x00, 0xfe, 0xe6, 0xff, 
+  0x82, 0xfe, 0xc6, 0xff, 0x01, 0xff, 0x04, 0xf0, 0xff, 0xc0, 0x08, 0x90, 0x00, 0x00, 0x00, 0x0f, 0xd6, 0x9a, 0x07, 0xd6, 0x7a, 0x10, 0xd6, 0x7a, 0x18, 0xce, 0x7a, 0x17, 0xee, 0xf2, 0x2f, 0xf6, 
+  0xc9, 0x6c, 0xfe, 0xc6, 0x8c, 0xfe, 0xc5, 0xb3, 0xfe, 0xc5, 0xff, 0xfe, 0xc6, 0xff, 0xf6, 0xc7, 0xff, 0xf6, 0xea, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x57, 0xff, 
+  0x81, 0xf7, 0x58, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x00, 0xf7, 0x56, 0xff, 0x82, 0xf7, 0x57, 0xff, 0x81, 0xf7, 0x56, 0xff, 0x00, 0xf7, 0x55, 0xff, 0x81, 0xf7, 0x54, 0xff, 0x01, 0xf7, 0x33, 0xff, 
+  0xf7, 0x31, 0xff, 0x81, 0xf7, 0x0e, 0xff, 0x81, 0xf7, 0x0d, 0xff, 0x04, 0xf7, 0x0b, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe3, 0xff, 0x81, 0xfe, 0xe2, 0xff, 0x04, 
+  0xfe, 0xc3, 0xf3, 0xfe, 0xc3, 0xa7, 0xfe, 0xc3, 0x83, 0xfe, 0xc5, 0x53, 0xff, 0x80, 0x13, 0x90, 0x00, 0x00, 0x00, 0x02, 0xd6, 0xba, 0x07, 0xd6, 0x7a, 0x13, 0xde, 0xdb, 0x24, 0x81, 0xde, 0xdb, 
+  0x2c, 0x10, 0xde, 0xfd, 0x24, 0xd6, 0xde, 0x24, 0xee, 0xee, 0x60, 0xfe, 0xc6, 0xff, 0xf6, 0xc9, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xee, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x35, 0xff, 
+  0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x59, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 0x82, 0xf7, 0x57, 0xff, 0x02, 0xf7, 0x56, 0xff, 0xf7, 0x55, 0xff, 
+  0xf7, 0x34, 0xff, 0x82, 0xf7, 0x33, 0xff, 0x08, 0xf7, 0x31, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0e, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xeb, 0xff, 0xf6, 0xe9, 0xff, 0xfe, 0xe5, 0xff, 
+  0xfe, 0xe3, 0xff, 0x81, 0xfe, 0xc1, 0xff, 0x02, 0xfe, 0xc1, 0xec, 0xff, 0x2f, 0x1b, 0x8e, 0x7f, 0x04, 0x91, 0x00, 0x00, 0x00, 0x14, 0xd6, 0x7a, 0x04, 0xd6, 0xba, 0x13, 0xde, 0xbb, 0x1c, 0xde, 
+  0xfb, 0x34, 0xe6, 0xfc, 0x58, 0xde, 0xfb, 0x5f, 0xde, 0xfb, 0x4f, 0xde, 0xfa, 0x4f, 0xf6, 0xec, 0xdf, 0xf6, 0xed, 0xff, 0xf6, 0xf0, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x57, 0xff, 
+  0xf7, 0x56, 0xff, 0xf7, 0x36, 0xff, 0xf7, 0x58, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x7b, 0xff, 0xf7, 0x7a, 0xff, 0x81, 0xf7, 0x33, 0xff, 0x01, 0xf7, 0x57, 0xff, 0xf7, 0x58, 0xff, 
+  0x82, 0xf7, 0x57, 0xff, 0x01, 0xf7, 0x56, 0xff, 0xf7, 0x34, 0xff, 0x83, 0xf7, 0x32, 0xff, 0x0c, 0xf7, 0x11, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xeb, 0xff, 0xfe, 
+  0xe6, 0xff, 0xfe, 0xe3, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xff, 0x20, 0x83, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x90, 0x00, 0x00, 0x00, 0x0c, 0xe7, 0x1c, 0x07, 0xd6, 
+  0x7a, 0x18, 0xd6, 0xba, 0x1c, 0xde, 0xdb, 0x28, 0xde, 0xfb, 0x54, 0xe6, 0xfc, 0x67, 0xe6, 0xfc, 0x64, 0xef, 0x16, 0x80, 0xf6, 0xee, 0xf8, 0xf7, 0x12, 0xf8, 0xf7, 0x36, 0xfb, 0xf7, 0x36, 0xfc, 
+  0xf7, 0x58, 0xff, 0x81, 0xf7, 0x59, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x07, 0xf7, 0x58, 0xff, 0xf7, 0x59, 0xff, 0xf7, 0x7a, 0xff, 0xf7, 0x9c, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x0b, 0xff, 0xf7, 0x32, 
+  0xff, 0xf7, 0x57, 0xff, 0x83, 0xf7, 0x58, 0xff, 0x02, 0xf7, 0x57, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x31, 0xff, 0x82, 0xf7, 0x32, 0xff, 0x82, 0xf7, 0x11, 0xff, 0x07, 0xf7, 0x0f, 0xff, 0xf6, 0xea, 
+  0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc1, 0xf7, 0xfe, 0xc0, 0xec, 0xfe, 0xc0, 0xef, 0xfe, 0xe0, 0xff, 0xff, 0xe0, 0x08, 0x91, 0x00, 0x00, 0x00, 0x0b, 0xd6, 0x7a, 0x0b, 0xde, 0xbb, 0x20, 0xde, 0xdb, 
+  0x24, 0xd6, 0xba, 0x2f, 0xde, 0xdb, 0x3f, 0xde, 0xfb, 0x43, 0xde, 0xfb, 0x4b, 0xe6, 0xf9, 0x5c, 0xe6, 0xf8, 0x7c, 0xef, 0x1b, 0x9f, 0xef, 0x5d, 0xc7, 0xf7, 0x57, 0xff, 0x83, 0xf7, 0x58, 0xff, 
+  0x02, 0xf7, 0x36, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x36, 0xff, 0x81, 0xf7, 0x57, 0xff, 0x18, 0xf7, 0x11, 0xff, 0xfe, 0xe6, 0xff, 0xf6, 0xe7, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x34, 0xff, 0xf7, 0x31, 
+  0xff, 0xf7, 0x33, 0xff, 0xf7, 0x35, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0d, 0xff, 0xf7, 0x32, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 
+  0xef, 0xff, 0xf6, 0xee, 0xff, 0xf6, 0xeb, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc1, 0xd3, 0xfe, 0xe8, 0x1c, 0xfe, 0xc0, 0x1c, 0xfe, 0xc0, 0x28, 0xff, 0x60, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x0c, 0xde, 
+  0xbb, 0x0c, 0xde, 0xdb, 0x2b, 0xde, 0xbb, 0x33, 0xde, 0xfb, 0x3b, 0xde, 0xdb, 0x40, 0xde, 0xdb, 0x3b, 0xde, 0xdb, 0x34, 0xde, 0xdb, 0x3f, 0xde, 0xdb, 0x54, 0xe7, 0x1c, 0x74, 0xef, 0x3a, 0xbb, 
+  0xf7, 0x34, 0xff, 0xf7, 0x35, 0xff, 0x81, 0xf7, 0x36, 0xff, 0x1c, 0xf7, 0x56, 0xff, 0xf7, 0x33, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x13, 0xff, 0xf7, 0x12, 0xff, 0xf7, 0x0f, 0xff, 
+  0xf6, 0xe7, 0xff, 0xff, 0x04, 0xff, 0xf6, 0xe7, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xea, 0xff, 0xf7, 0x0f, 0xff, 0xf7, 0x10, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xeb, 
+  0xff, 0xf7, 0x33, 0xff, 0xf7, 0x12, 0xff, 0xf6, 0xed, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe9, 0xff, 0xf6, 0xc8, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc1, 0xe7, 0xff, 0x49, 0x18, 0xff, 
+  0xff, 0x03, 0x93, 0x00, 0x00, 0x00, 0x03, 0xef, 0x5d, 0x07, 0xd6, 0xba, 0x20, 0xd6, 0xba, 0x30, 0xde, 0xdb, 0x3c, 0x81, 0xde, 0xfb, 0x50, 0x09, 0xde, 0xdb, 0x40, 0xde, 0xbb, 0x38, 0xde, 0xdb, 
+  0x4b, 0xe7, 0x1c, 0x63, 0xef, 0x12, 0xc4, 0xf6, 0xf0, 0xff, 0xf7, 0x11, 0xff, 0xf7, 0x14, 0xf3, 0xf7, 0x12, 0xfc, 0xf6, 0xef, 0xff, 0x81, 0xf6, 0xed, 0xff, 0x00, 0xf7, 0x0f, 0xff, 0x81, 0xf7, 
+  0x11, 0xff, 0x01, 0xf6, 0xee, 0xff, 0xf6, 0xe9, 0xff, 0x81, 0xfe, 0xe4, 0xff, 0x11, 0xfe, 0xe7, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xe5, 0xff, 0xf6, 0xe8, 0xff, 0xf7, 0x0d, 0xff, 0xf6, 0xec, 0xff, 
+  0xf6, 0xe8, 0xff, 0xfe, 0xe6, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xed, 0xff, 0xf6, 0xe7, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xc6, 0xff, 0xfe, 0xc5, 0xf7, 0xfe, 0xc5, 0xe3, 0xfe, 0xc2, 0xff, 0xfe, 0xc1, 
+  0xff, 0xff, 0x23, 0x2c, 0x94, 0x00, 0x00, 0x00, 0x1f, 0xce, 0x39, 0x03, 0xde, 0xdb, 0x0f, 0xd6, 0x9a, 0x18, 0xde, 0xdb, 0x23, 0xde, 0xdb, 0x43, 0xde, 0xdb, 0x53, 0xde, 0xdb, 0x4b, 0xde, 0xdb, 
+  0x3c, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x40, 0xf6, 0xee, 0xa8, 0xee, 0xf2, 0x9f, 0xe7, 0x1b, 0x83, 0xe7, 0x1b, 0xa0, 0xf6, 0xee, 0xf8, 0xf6, 0xc8, 0xff, 0xfe, 0xc7, 0xff, 0xf6, 0xe8, 0xff, 0xf6, 
+  0xeb, 0xff, 0xf6, 0xee, 0xff, 0xf7, 0x0f, 0xff, 0xf6, 0xec, 0xff, 0xf6, 0xea, 0xff, 0xf6, 0xe8, 0xff, 0xfe, 0xe5, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe3, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe4, 0xff, 
+  0xf6, 0xe8, 0xff, 0xf6, 0xea, 0xff, 0xfe, 0xe5, 0xff, 0x81, 0xfe, 0xe4, 0xff, 0x08, 0xfe, 0xe6, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xc3, 0xf3, 0x76, 0xdf, 0x0f, 
+  0xee, 0xb0, 0x37, 0xfe, 0xc5, 0x7f, 0xff, 0x03, 0x48, 0x95, 0x00, 0x00, 0x00, 0x11, 0xe6, 0xfc, 0x03, 0xde, 0xdb, 0x08, 0xde, 0xfb, 0x0b, 0xde, 0xfb, 0x0f, 0xd6, 0xba, 0x28, 0xde, 0xdb, 0x38, 
+  0xde, 0xdb, 0x3c, 0xde, 0xdb, 0x2c, 0xde, 0xbb, 0x1f, 0xce, 0x7c, 0x13, 0xde, 0xdc, 0x28, 0xde, 0xdb, 0x47, 0xe7, 0x19, 0x88, 0xf6, 0xed, 0xfb, 0xf6, 0xc8, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc5, 
+  0xfb, 0xf6, 0xc7, 0xff, 0x81, 0xf6, 0xea, 0xff, 0x82, 0xf6, 0xe9, 0xff, 0x09, 0xf6, 0xe7, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xe4, 0xff, 0xfe, 
+  0xc7, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xc2, 0xff, 0x82, 0xfe, 0xc1, 0xff, 0x81, 0xfe, 0xc2, 0xff, 0x03, 0x05, 0x9f, 0x07, 0xd6, 0x9b, 0x0f, 0xce, 0xde, 0x0c, 0xce, 0xbf, 0x04, 
+  0x97, 0x00, 0x00, 0x00, 0x1c, 0xc5, 0xf8, 0x03, 0xce, 0x39, 0x03, 0xce, 0x79, 0x04, 0xce, 0x39, 0x0c, 0xd6, 0x9a, 0x17, 0xde, 0xfb, 0x20, 0xd6, 0xba, 0x0c, 0xe6, 0xfc, 0x07, 0xd6, 0x9a, 0x0b, 
+  0xde, 0xfb, 0x1b, 0xee, 0xd4, 0x60, 0xf6, 0xc7, 0xf4, 0xf6, 0xca, 0xc7, 0xe6, 0xb3, 0x2f, 0xfe, 0xc2, 0xc4, 0xfe, 0xc2, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xe6, 
+  0xff, 0xf6, 0xe8, 0xff, 0xf6, 0xc9, 0xff, 0xfe, 0xe7, 0xff, 0xfe, 0xc3, 0xff, 0xfe, 0xe1, 0xff, 0xfe, 0xc1, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xe2, 0xff, 0xfe, 0xc2, 0xff, 0x81, 0xfe, 0xc1, 0xff, 
+  0x09, 0xfe, 0xc0, 0xff, 0xfe, 0xc0, 0xa4, 0xfe, 0xe2, 0x3b, 0xfe, 0xc0, 0xcc, 0xfe, 0xc1, 0xff, 0x9f, 0xfc, 0x04, 0x00, 0x00, 0x00, 0xc6, 0x38, 0x03, 0xde, 0xdb, 0x07, 0xce, 0x59, 0x03, 0x97, 
+  0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0x03, 0xf7, 0x9e, 0x03, 0xff, 0xff, 0x03, 0xce, 0x59, 0x04, 0xde, 0xbb, 0x07, 0xd6, 0x9a, 0x04, 0xbd, 0xd7, 0x04, 0xef, 0x5d, 0x03, 0xde, 0xdb, 0x08, 0xee, 
+  0xd4, 0x1f, 0xee, 0xae, 0x38, 0xd6, 0xbb, 0x24, 0xd6, 0xdf, 0x1f, 0xfe, 0xe2, 0xa3, 0xfe, 0xc1, 0xff, 0xfe, 0xc0, 0xff, 0xfe, 0xc1, 0x8b, 0xfe, 0xc1, 0xff, 0xfe, 0xc2, 0xff, 0xfe, 0xc3, 0xff, 
+  0xfe, 0xc4, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xc4, 0xff, 0xfe, 0xc1, 0xff, 0x81, 0xfe, 0xc0, 0xff, 0x02, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xec, 0xfe, 0xc1, 0xac, 0x81, 0xfe, 0xc0, 0xff, 0x00, 0xfe, 
+  0xe1, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc3, 0x37, 0xff, 0x49, 0x08, 0x9b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x03, 0x10, 0xd6, 0x7a, 0x03, 
+  0xce, 0x59, 0x04, 0xe7, 0x3c, 0x03, 0xf7, 0x9e, 0x03, 0xd6, 0x7a, 0x04, 0xd6, 0xbb, 0x04, 0xe7, 0x1d, 0x07, 0xd6, 0xba, 0x0c, 0xd6, 0xbd, 0x1c, 0xf6, 0xe8, 0x83, 0xfe, 0xc1, 0xf0, 0xfe, 0xc4, 
+  0x43, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xef, 0xfe, 0xc1, 0xff, 0xfe, 0xc1, 0xeb, 0xfe, 0xc3, 0x73, 0x81, 0xfe, 0xc1, 0xff, 0x01, 0xfe, 0xc2, 0xec, 0xfe, 0xc1, 0x78, 0x81, 0xfe, 0xc0, 0xff, 0x04, 
+  0xfe, 0xc0, 0xc8, 0x00, 0x00, 0x00, 0xfe, 0xc1, 0x5f, 0xfe, 0xc0, 0xff, 0xff, 0x01, 0x50, 0xa2, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x03, 0x09, 0xf7, 0x7e, 0x03, 0xc6, 0x18, 0x04, 0xff, 0xff, 
+  0x03, 0xff, 0xbf, 0x03, 0xce, 0x39, 0x04, 0xe6, 0xfc, 0x03, 0xef, 0x3d, 0x03, 0xc6, 0x5c, 0x04, 0xf6, 0xcc, 0x2b, 0xf6, 0xcf, 0x28, 0x81, 0x00, 0x00, 0x00, 0x0a, 0xfe, 0xe0, 0x7b, 0xfe, 0xc0, 
+  0xff, 0xfe, 0xc3, 0x33, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0xa7, 0xfe, 0xc0, 0xff, 0xfe, 0xc2, 0x8c, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x5b, 0xfe, 0xc0, 0xff, 0xfe, 0xe0, 0x60, 0x81, 0x00, 0x00, 0x00, 
+  0x01, 0xfe, 0xc0, 0x2c, 0xff, 0x40, 0x1b, 0xa5, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0x03, 0x08, 0x00, 0x00, 0x00, 0xe7, 0x3c, 0x03, 0xff, 0xdf, 0x03, 0xbe, 0x1c, 0x04, 0xe7, 0x3d, 0x08, 0xc6, 
+  0x18, 0x03, 0x00, 0x00, 0x00, 0xfe, 0xe3, 0x27, 0xfe, 0xc1, 0x44, 0x81, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xe0, 0x1f, 0xfe, 0xc0, 0xdf, 0x82, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x9f, 0xb1, 0x00, 
+  0x00, 0x00, 0x02, 0xef, 0x5d, 0x03, 0xef, 0x7d, 0x03, 0xf7, 0x7e, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xc0, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x0f, 0x00, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xde, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xe9, 0xfe, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0xea, 0xff, 0x23, 0x00, 0xec, 0xfe, 0x3c, 0x02, 0xed, 0xfe, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x20, 0x00, 0xe6, 0xfe, 0xd4, 0x01, 0xdc, 0xfc, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x09, 0xcf, 0xfc, 0x00, 0x00, 0xe8, 0xff, 0x84, 0x00, 0xff, 0xff, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0x00, 0x00, 0xeb, 0xfe, 0x23, 0x00, 0xf0, 0xfb, 0x0b, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe4, 0xff, 0x7b, 0x00, 0xe0, 0xfe, 0xff, 0x05, 0xf1, 0xff, 0x38, 0x05, 0xeb, 0xfe, 0x00, 0x04, 0xe6, 0xfd, 0xa7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xeb, 0xfe, 0x84, 0x04, 0xea, 0xff, 0x00, 0x03, 0xea, 0xff, 0x58, 0x00, 0xdc, 0xfe, 0xff, 0x00, 0xe9, 0xfd, 0x5c, 0x00, 0xe6, 0xfd, 0x00, 0x00, 0xee, 0xfe, 0x00, 0x00, 0xed, 0xff, 0x2f, 0x00, 0xee, 0xff, 0x20, 0x00, 0xee, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xe4, 0xff, 0x6f, 0x00, 0xe5, 0xfe, 0xef, 0x04, 0xec, 0xfe, 0x2b, 0x04, 0xe0, 0xfe, 0x00, 0x02, 0xe0, 0xfe, 0xe7, 0x01, 0xd8, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xef, 0x04, 0xed, 0xff, 0x58, 0x02, 0xdc, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x03, 0xdd, 0xfe, 0xeb, 0x05, 0xed, 0xff, 0x58, 0x02, 0xe1, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xc7, 0x07, 0xd5, 0xfc, 0x00, 0x02, 0xec, 0xfe, 0x4b, 0x00, 0xe2, 0xfe, 0xff, 0x00, 0xe6, 0xff, 0x4f, 0x00, 0xe5, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x14, 0x00, 0xf3, 0xff, 0x13, 0x00, 0xed, 0xfd, 0x00, 0x02, 0xe5, 0xff, 0x00, 0x01, 0xe1, 0xff, 0x97, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xe0, 0xfe, 0xf8, 0x04, 0xec, 0xfe, 0x9b, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xde, 0xfe, 0xfc, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xef, 0x04, 0xeb, 0xfe, 0xb8, 0x02, 0xde, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe3, 0xfd, 0x78, 0x01, 0xe0, 0xfd, 0x00, 0x03, 0xed, 0xff, 0x00, 0x00, 0xee, 0xff, 0x3f, 0x00, 0xe9, 0xff, 0x0c, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfe, 0x2f, 0x00, 0xe5, 0xfe, 0xff, 0x01, 0xea, 0xfd, 0x8c, 0x05, 0xf3, 0xfd, 0x17, 0x03, 0xe0, 0xfd, 0xc0, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x03, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xab, 0x04, 0xed, 0xfe, 0x24, 0x03, 0xe9, 0xfe, 0xac, 0x00, 0xe2, 0xfe, 0xff, 0x00, 0xda, 0xfc, 0x00, 0x00, 0xe4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xee, 0xff, 0x00, 0x03, 0xdb, 0xfe, 0x27, 0x01, 0xd9, 0xfe, 0xf8, 0x01, 0xdb, 0xfe, 0xff, 0x02, 0xe3, 0xfe, 0xef, 0x03, 0xdd, 0xfe, 0xf8, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xde, 0xfe, 0xf7, 0x02, 0xe0, 0xfe, 0xfb, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd7, 0xfe, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xfe, 0x00, 0x00, 0xe9, 0xff, 0x63, 0x00, 0xed, 0xfe, 0x38, 0x03, 0xed, 0xfd, 0x1b, 0x02, 0xe0, 0xfe, 0x27, 0x01, 0xda, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xef, 0x00, 0xca, 0xfc, 0x00, 0x05, 0xed, 0xfe, 0x1f, 0x00, 0xec, 0xfe, 0x43, 0x00, 0xea, 0xff, 0x30, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xfd, 0x00, 0x00, 0xdd, 0xfd, 0x8b, 0x00, 0xdd, 0xfe, 0xff, 0x02, 0xe3, 0xfe, 0xec, 0x03, 0xe7, 0xfe, 0xdc, 0x02, 0xdb, 0xfe, 0xfb, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xf8, 0x07, 0xea, 0xfe, 0xd7, 0x03, 0xe1, 0xfe, 0xf0, 0x01, 0xdd, 0xfe, 0xff, 0x00, 0xdb, 0xfe, 0x30, 0x00, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xe4, 0xff, 0x00, 0x00, 0xe5, 0xff, 0x2c, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xe7, 0x03, 0xdd, 0xfd, 0x14, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xee, 0xff, 0x10, 0x00, 0xed, 0xff, 0x1c, 0x02, 0xde, 0xfd, 0x00, 0x03, 0xe3, 0xfe, 0x00, 0x01, 0xd9, 0xfe, 0xf0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xc7, 0x04, 0xe8, 0xfe, 0x00, 0x16, 0xf5, 0xf7, 0x00, 0x00, 0xee, 0xff, 0x1c, 0x00, 0xec, 0xff, 0x0f, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xe8, 0xfe, 0x3c, 0x00, 0xe4, 0xfe, 0xff, 0x01, 0xe7, 0xfe, 0xff, 0x04, 0xe8, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x03, 0xe8, 0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xff, 0x00, 0xe4, 0xfe, 0xff, 0x00, 0xee, 0xff, 0x18, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xe4, 0xfd, 0x03, 0x01, 0xd8, 0xfe, 0xd3, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xda, 0xfe, 0x84, 0x00, 0xde, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xeb, 0xfe, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x01, 0xe6, 0xfe, 0x00, 0x02, 0xdb, 0xfd, 0x47, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe1, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xef, 0x01, 0xd4, 0xfe, 0x14, 0x04, 0xec, 0xfe, 0x00, 0x00, 0xea, 0xfd, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xeb, 0xfe, 0x37, 0x00, 0xed, 0xfd, 0x70, 0x01, 0xed, 0xfe, 0xa7, 0x05, 0xec, 0xfe, 0xc7, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfe, 0xf7, 0x05, 0xec, 0xfe, 0xc4, 0x03, 0xed, 0xfe, 0x97, 0x00, 0xec, 0xfd, 0x6b, 0x00, 0xee, 0xff, 0x2b, 0x00, 0xed, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0xe3, 0xfe, 0x2f, 0x00, 0xde, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x0b, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0e, 0xe7, 0xfc, 0xff, 0x0e, 0xe7, 0xfb, 0xff, 0x0e, 0xe6, 0xfb, 0xff, 0x0c, 0xe5, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x00, 0xdf, 0xfe, 0xf7, 0x00, 0xee, 0xff, 0x0c, 0x00, 0xe6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x00, 0x00, 0xdd, 0xfe, 0x00, 0x00, 0xd7, 0xff, 0x64, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe2, 0xfc, 0xff, 0x19, 0xe2, 0xfa, 0xff, 0x1b, 0xe4, 0xf9, 0xff, 0x18, 0xe4, 0xf9, 0xff, 0x17, 0xe5, 0xfa, 0xff, 0x12, 0xe7, 0xfb, 0xff, 0x0f, 0xe8, 0xfb, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x0e, 0xea, 0xfc, 0xff, 0x10, 0xe9, 0xfb, 0xff, 0x15, 0xe9, 0xfb, 0xff, 0x23, 0xe7, 0xf8, 0xff, 0x33, 0xe5, 0xf5, 0xff, 0x34, 0xe4, 0xf5, 0xff, 0x28, 0xe4, 0xf7, 0xff, 0x1b, 0xe4, 0xf9, 0xff, 0x12, 0xe2, 0xfa, 0xff, 0x09, 0xe2, 0xfc, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf7, 0x01, 0xd8, 0xfe, 0x30, 0x00, 0xde, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xff, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0xeb, 0xfd, 0x00, 0x00, 0xc0, 0xfc, 0x00, 0x02, 0xda, 0xfd, 0xb7, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x07, 0xdf, 0xfd, 0xff, 0x08, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0b, 0xe2, 0xfc, 0xff, 0x2c, 0xe2, 0xf6, 0xff, 0x49, 0xe3, 0xf1, 0xff, 0x47, 0xe3, 0xf2, 0xff, 0x38, 0xe5, 0xf4, 0xff, 0x2a, 0xe7, 0xf7, 0xff, 0x1f, 0xe8, 0xf9, 0xff, 0x17, 0xe9, 0xfb, 0xff, 0x14, 0xea, 0xfb, 0xff, 0x12, 0xeb, 0xfc, 0xff, 0x10, 0xeb, 0xfc, 0xff, 0x10, 0xeb, 0xfc, 0xff, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x12, 0xe9, 0xfb, 0xff, 0x26, 0xe7, 0xf8, 0xff, 0x48, 0xe4, 0xf2, 0xff, 0x4a, 0xe3, 0xf2, 0xff, 0x3e, 0xe3, 0xf3, 0xff, 0x32, 0xe2, 0xf5, 0xff, 0x25, 0xe2, 0xf7, 0xff, 0x20, 0xe1, 0xf8, 0xff, 0x18, 0xe0, 0xfa, 0xff, 0x0e, 0xdf, 0xfc, 0xff, 0x07, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0x9f, 0x05, 0xcb, 0xfb, 0x00, 0x00, 0xeb, 0xfe, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x00, 0x00, 0xed, 0xff, 0x23, 0x00, 0xed, 0xfd, 0x88, 0x03, 0xe9, 0xfe, 0xd7, 0x02, 0xde, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x11, 0xdf, 0xfb, 0xff, 0x12, 0xe0, 0xfb, 0xff, 0x0e, 0xe2, 0xfc, 0xff, 0x0b, 0xe3, 0xfb, 0xff, 0x2d, 0xe3, 0xf6, 0xff, 0x5c, 0xe3, 0xf0, 0xff, 0x7f, 0xe5, 0xee, 0xff, 0x75, 0xe5, 0xee, 0xff, 0x60, 0xe5, 0xf0, 0xff, 0x43, 0xe6, 0xf3, 0xff, 0x2e, 0xe8, 0xf5, 0xff, 0x24, 0xe9, 0xf8, 0xff, 0x1d, 0xeb, 0xf9, 0xff, 0x18, 0xeb, 0xfa, 0xff, 0x15, 0xec, 0xfa, 0xff, 0x11, 0xec, 0xfc, 0xff, 0x0d, 0xec, 0xfc, 0xff, 0x0b, 0xeb, 0xfc, 0xff, 0x17, 0xe8, 0xfa, 0xff, 0x37, 0xe5, 0xf4, 0xff, 0x56, 0xe4, 0xf1, 0xff, 0x62, 0xe3, 0xef, 0xff, 0x56, 0xe2, 0xf1, 0xff, 0x47, 0xe1, 0xf2, 0xff, 0x44, 0xe1, 0xf4, 0xff, 0x38, 0xe0, 0xf4, 0xff, 0x2a, 0xdf, 0xf6, 0xff, 0x16, 0xde, 0xfa, 0xff, 0x09, 0xdd, 0xfc, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe0, 0xfe, 0xef, 0x04, 0xea, 0xfe, 0xd3, 0x00, 0xed, 0xfe, 0x74, 0x00, 0xea, 0xff, 0x0f, 0x00, 0xe9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0x04, 0x00, 0xe6, 0xfe, 0xa0, 0x00, 0xdc, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x03, 0xdf, 0xfd, 0xff, 0x20, 0xdf, 0xf8, 0xff, 0x22, 0xe0, 0xf8, 0xff, 0x1f, 0xe2, 0xf9, 0xff, 0x28, 0xe3, 0xf7, 0xff, 0x45, 0xe2, 0xf2, 0xff, 0x6b, 0xe3, 0xef, 0xff, 0x8e, 0xe6, 0xee, 0xff, 0x8b, 0xe6, 0xed, 0xff, 0x86, 0xe6, 0xee, 0xff, 0x7a, 0xe6, 0xee, 0xff, 0x66, 0xe6, 0xef, 0xff, 0x4e, 0xe8, 0xf2, 0xff, 0x3a, 0xe9, 0xf3, 0xff, 0x2a, 0xeb, 0xf6, 0xff, 0x20, 0xec, 0xf8, 0xff, 0x1e, 0xeb, 0xf8, 0xff, 0x1f, 0xeb, 0xf8, 0xff, 0x2c, 0xe9, 0xf7, 0xff, 0x3d, 0xe7, 0xf3, 0xff, 0x46, 0xe6, 0xf3, 0xff, 0x56, 0xe4, 0xf1, 0xff, 0x6e, 0xe4, 0xef, 0xff, 0x74, 0xe3, 0xee, 0xff, 0x72, 0xe3, 0xee, 0xff, 0x70, 0xe2, 0xef, 0xff, 0x64, 0xe0, 0xf0, 0xff, 0x45, 0xdf, 0xf3, 0xff, 0x23, 0xde, 0xf8, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x0a, 0xdd, 0xfc, 0xff, 0x08, 0xdc, 0xfc, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xde, 0xfe, 0xff, 0x00, 0xe9, 0xff, 0x63, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0xdf, 0xfd, 0x00, 0x01, 0xd7, 0xfe, 0x54, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x3d, 0xdf, 0xf4, 0xff, 0x3c, 0xe0, 0xf4, 0xff, 0x34, 0xe0, 0xf5, 0xff, 0x42, 0xe2, 0xf3, 0xff, 0x6e, 0xe3, 0xef, 0xff, 0x8e, 0xe5, 0xed, 0xff, 0xa0, 0xe8, 0xee, 0xff, 0x97, 0xe7, 0xed, 0xff, 0x92, 0xe7, 0xed, 0xff, 0x8c, 0xe7, 0xed, 0xff, 0x88, 0xe8, 0xed, 0xff, 0x7b, 0xe7, 0xee, 0xff, 0x65, 0xe8, 0xef, 0xff, 0x52, 0xe8, 0xf1, 0xff, 0x3b, 0xea, 0xf3, 0xff, 0x2c, 0xeb, 0xf6, 0xff, 0x23, 0xeb, 0xf7, 0xff, 0x29, 0xea, 0xf6, 0xff, 0x46, 0xe7, 0xf2, 0xff, 0x61, 0xe6, 0xf0, 0xff, 0x66, 0xe5, 0xef, 0xff, 0x6d, 0xe4, 0xef, 0xff, 0x78, 0xe4, 0xee, 0xff, 0x81, 0xe4, 0xee, 0xff, 0x83, 0xe3, 0xed, 0xff, 0x82, 0xe2, 0xee, 0xff, 0x57, 0xe0, 0xf1, 0xff, 0x28, 0xdf, 0xf7, 0xff, 0x04, 0xdf, 0xfd, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd7, 0xff, 0x33, 0x01, 0xef, 0xfe, 0x00, 0x00, 0xeb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc7, 0xae, 0x00, 0xff, 0xce, 0xc0, 0x00, 0x00, 0xdc, 0xff, 0x00, 0x08, 0xdc, 0xfc, 0x80, 0x03, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x00, 0xdf, 0xfc, 0xff, 0x55, 0xdf, 0xf1, 0xff, 0x5a, 0xe0, 0xf0, 0xff, 0x4f, 0xe2, 0xf3, 0xff, 0x52, 0xe2, 0xf1, 0xff, 0x7a, 0xe4, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xbe, 0xeb, 0xee, 0xff, 0xb9, 0xeb, 0xee, 0xff, 0xac, 0xe9, 0xee, 0xff, 0x9d, 0xe8, 0xed, 0xff, 0x92, 0xe8, 0xed, 0xff, 0x87, 0xe8, 0xed, 0xff, 0x7f, 0xe8, 0xee, 0xff, 0x7e, 0xe8, 0xee, 0xff, 0x6f, 0xe8, 0xef, 0xff, 0x52, 0xe9, 0xf1, 0xff, 0x3b, 0xea, 0xf4, 0xff, 0x31, 0xea, 0xf5, 0xff, 0x40, 0xe8, 0xf3, 0xff, 0x61, 0xe5, 0xf0, 0xff, 0x7c, 0xe5, 0xee, 0xff, 0x7e, 0xe5, 0xee, 0xff, 0x80, 0xe4, 0xee, 0xff, 0x89, 0xe4, 0xee, 0xff, 0x92, 0xe4, 0xed, 0xff, 0x92, 0xe5, 0xee, 0xff, 0x68, 0xe1, 0xef, 0xff, 0x34, 0xdf, 0xf6, 0xff, 0x05, 0xde, 0xfc, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf8, 0x02, 0xe3, 0xff, 0x3b, 0x03, 0xe9, 0xff, 0x00, 0x00, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd2, 0xd2, 0xd2, 0x00, 0xcc, 0xbe, 0xb8, 0x00, 0x2c, 0xe8, 0xfa, 0x00, 0x68, 0xe2, 0xec, 0x18, 0x3c, 0xe7, 0xf5, 0xbc, 0x2f, 0xdd, 0xf6, 0xf8, 0x23, 0xd9, 0xf8, 0xff, 0x17, 0xda, 0xf9, 0xff, 0x0e, 0xdc, 0xfb, 0xff, 0x09, 0xdd, 0xfc, 0xff, 0x07, 0xdd, 0xfc, 0xff, 0x28, 0xde, 0xf6, 0xff, 0x61, 0xe0, 0xf0, 0xff, 0x69, 0xe1, 0xef, 0xff, 0x62, 0xe2, 0xf0, 0xff, 0x64, 0xe2, 0xf0, 0xff, 0x7e, 0xe4, 0xee, 0xff, 0xad, 0xe9, 0xee, 0xff, 0xc7, 0xec, 0xef, 0xff, 0xd0, 0xee, 0xf0, 0xff, 0xcf, 0xee, 0xf0, 0xff, 0xc3, 0xed, 0xef, 0xff, 0xb3, 0xea, 0xee, 0xff, 0xa1, 0xe9, 0xed, 0xff, 0x95, 0xe9, 0xed, 0xff, 0x95, 0xe9, 0xed, 0xff, 0x9a, 0xe9, 0xed, 0xff, 0x91, 0xe8, 0xed, 0xff, 0x7b, 0xe8, 0xed, 0xff, 0x66, 0xe7, 0xef, 0xff, 0x5e, 0xe7, 0xf0, 0xff, 0x65, 0xe6, 0xef, 0xff, 0x7d, 0xe5, 0xee, 0xff, 0x97, 0xe7, 0xed, 0xff, 0xa5, 0xe8, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xaa, 0xe7, 0xee, 0xff, 0xa3, 0xe6, 0xee, 0xff, 0x83, 0xe2, 0xee, 0xff, 0x51, 0xde, 0xf2, 0xff, 0x1d, 0xdd, 0xf8, 0xff, 0x0f, 0xdc, 0xfb, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xef, 0x03, 0xec, 0xfe, 0x94, 0x03, 0xe1, 0xfa, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe9, 0xe9, 0x00, 0xf3, 0xf3, 0xf3, 0x00, 0xd2, 0xd2, 0xd2, 0x08, 0xcf, 0xc7, 0xc4, 0x07, 0x18, 0xe9, 0xfe, 0x20, 0x06, 0xe5, 0xfb, 0xf0, 0x36, 0xd9, 0xf5, 0xff, 0x5a, 0xda, 0xf1, 0xff, 0x5f, 0xdc, 0xf1, 0xff, 0x51, 0xdb, 0xf2, 0xff, 0x3b, 0xdb, 0xf3, 0xff, 0x24, 0xdd, 0xf7, 0xff, 0x12, 0xde, 0xfa, 0xff, 0x44, 0xde, 0xf4, 0xff, 0x7c, 0xe2, 0xee, 0xff, 0x89, 0xe4, 0xee, 0xff, 0x83, 0xe4, 0xee, 0xff, 0x82, 0xe4, 0xee, 0xff, 0x8e, 0xe5, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xba, 0xea, 0xef, 0xff, 0xcd, 0xed, 0xf0, 0xff, 0xd7, 0xef, 0xf1, 0xff, 0xd8, 0xef, 0xf0, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xc3, 0xed, 0xee, 0xff, 0xb9, 0xeb, 0xee, 0xff, 0xaa, 0xea, 0xed, 0xff, 0xa4, 0xea, 0xed, 0xff, 0xa8, 0xea, 0xed, 0xff, 0xa4, 0xea, 0xee, 0xff, 0x9a, 0xe9, 0xed, 0xff, 0x8a, 0xe7, 0xed, 0xff, 0x81, 0xe6, 0xee, 0xff, 0x81, 0xe6, 0xee, 0xff, 0x8f, 0xe6, 0xed, 0xff, 0xa6, 0xe8, 0xee, 0xff, 0xb5, 0xe9, 0xee, 0xff, 0xbb, 0xe9, 0xee, 0xff, 0xb4, 0xe8, 0xee, 0xff, 0x9e, 0xe5, 0xee, 0xff, 0x79, 0xe1, 0xee, 0xff, 0x4f, 0xdd, 0xf2, 0xff, 0x2a, 0xdd, 0xf6, 0xff, 0x0c, 0xdc, 0xfc, 0xff, 0x06, 0xdb, 0xfc, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xff, 0x00, 0xe8, 0xfe, 0xd4, 0x00, 0xeb, 0xff, 0x04, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd1, 0x00, 0xd2, 0xd2, 0xd2, 0x07, 0xcb, 0xcb, 0xcb, 0x17, 0xcc, 0xcc, 0xcc, 0x13, 0xcb, 0xce, 0xcf, 0x10, 0x9d, 0xd6, 0xea, 0x30, 0x4b, 0xd8, 0xf1, 0xb0, 0x68, 0xdc, 0xf0, 0xff, 0x83, 0xdf, 0xee, 0xff, 0x81, 0xdf, 0xee, 0xff, 0x79, 0xdf, 0xee, 0xff, 0x64, 0xde, 0xf0, 0xff, 0x48, 0xde, 0xf3, 0xff, 0x5e, 0xdf, 0xf1, 0xff, 0x8e, 0xe3, 0xee, 0xff, 0xa7, 0xe6, 0xee, 0xff, 0xa4, 0xe7, 0xee, 0xff, 0xa5, 0xe7, 0xee, 0xff, 0xa6, 0xe8, 0xee, 0xff, 0xaf, 0xe8, 0xee, 0xff, 0xb6, 0xea, 0xee, 0xff, 0xc4, 0xec, 0xef, 0xff, 0xd3, 0xef, 0xf0, 0xff, 0xdd, 0xf0, 0xf1, 0xff, 0xdd, 0xf0, 0xf1, 0xff, 0xd5, 0xef, 0xf0, 0xff, 0xd2, 0xee, 0xf0, 0xff, 0xc4, 0xed, 0xef, 0xff, 0xb6, 0xeb, 0xee, 0xff, 0xab, 0xea, 0xed, 0xff, 0xab, 0xea, 0xed, 0xff, 0xae, 0xea, 0xee, 0xff, 0xaa, 0xe9, 0xee, 0xff, 0xa5, 0xe8, 0xee, 0xff, 0x9c, 0xe8, 0xee, 0xff, 0x93, 0xe6, 0xed, 0xff, 0x99, 0xe6, 0xed, 0xff, 0xa7, 0xe7, 0xee, 0xff, 0xbc, 0xea, 0xee, 0xff, 0xbe, 0xea, 0xef, 0xff, 0xb1, 0xe7, 0xee, 0xff, 0x9e, 0xe4, 0xee, 0xff, 0x82, 0xe1, 0xee, 0xff, 0x5c, 0xdd, 0xf0, 0xff, 0x29, 0xdc, 0xf6, 0xff, 0x07, 0xdb, 0xfc, 0xff, 0x06, 0xda, 0xfd, 0xff, 0x04, 0xd9, 0xfd, 0xff, 0x00, 0xd9, 0xff, 0x7b, 0x00, 0xd8, 0xff, 0x13, 0x00, 0xdf, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xd3, 0xd3, 0x00, 0xd1, 0xd1, 0xd1, 0x0f, 0xd8, 0xd8, 0xd8, 0x28, 0xce, 0xce, 0xce, 0x1b, 0xd3, 0xd3, 0xd3, 0x1f, 0xd4, 0xd5, 0xd6, 0x2c, 0xea, 0xdc, 0xd8, 0x48, 0x96, 0xde, 0xeb, 0xb8, 0x80, 0xde, 0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0x98, 0xe2, 0xee, 0xff, 0x8d, 0xe2, 0xee, 0xff, 0x83, 0xe1, 0xee, 0xff, 0x7f, 0xe1, 0xee, 0xff, 0x99, 0xe5, 0xee, 0xff, 0xae, 0xe8, 0xee, 0xff, 0xb0, 0xe8, 0xee, 0xff, 0xb9, 0xe9, 0xee, 0xff, 0xba, 0xe9, 0xee, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xc5, 0xeb, 0xef, 0xff, 0xc9, 0xed, 0xef, 0xff, 0xd4, 0xee, 0xf0, 0xff, 0xdb, 0xf0, 0xf1, 0xff, 0xdc, 0xf0, 0xf1, 0xff, 0xdb, 0xf0, 0xf1, 0xff, 0xda, 0xef, 0xf1, 0xff, 0xd7, 0xef, 0xf0, 0xff, 0xca, 0xed, 0xef, 0xff, 0xb8, 0xeb, 0xee, 0xff, 0xb1, 0xea, 0xee, 0xff, 0xaf, 0xea, 0xee, 0xff, 0xae, 0xe9, 0xee, 0xff, 0xab, 0xe9, 0xee, 0xff, 0xaa, 0xe9, 0xee, 0xff, 0x9c, 0xe6, 0xed, 0xff, 0x90, 0xe5, 0xed, 0xff, 0x91, 0xe5, 0xed, 0xff, 0xa9, 0xe7, 0xee, 0xff, 0xb7, 0xe9, 0xef, 0xff, 0xb3, 0xe8, 0xee, 0xff, 0xa6, 0xe5, 0xee, 0xff, 0x9a, 0xe4, 0xee, 0xff, 0x78, 0xdf, 0xef, 0xff, 0x44, 0xdb, 0xf3, 0xff, 0x04, 0xdb, 0xfd, 0xff, 0x05, 0xd9, 0xfd, 0xf8, 0x0e, 0xe1, 0xfe, 0x37, 0x05, 0xe0, 0xff, 0x00, 0x02, 0xe4, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x00, 0xca, 0xca, 0xca, 0x13, 0xda, 0xda, 0xda, 0x47, 0xd7, 0xd7, 0xd7, 0x27, 0xd5, 0xd6, 0xd6, 0x1f, 0xf3, 0xd2, 0xcf, 0x27, 0x7e, 0xe2, 0xea, 0x8b, 0x53, 0xde, 0xf2, 0xfb, 0x58, 0xdb, 0xf1, 0xff, 0x8f, 0xe1, 0xee, 0xff, 0xa8, 0xe4, 0xee, 0xff, 0xa0, 0xe4, 0xee, 0xff, 0x9a, 0xe4, 0xee, 0xff, 0x92, 0xe3, 0xee, 0xff, 0xa4, 0xe6, 0xee, 0xff, 0xb6, 0xe8, 0xef, 0xff, 0xb7, 0xe9, 0xef, 0xff, 0xc5, 0xec, 0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0xc8, 0xec, 0xef, 0xff, 0xd1, 0xee, 0xf0, 0xff, 0xd8, 0xef, 0xf1, 0xff, 0xd9, 0xef, 0xf1, 0xff, 0xdb, 0xf0, 0xf1, 0xff, 0xdb, 0xef, 0xf1, 0xff, 0xd9, 0xf0, 0xf0, 0xff, 0xce, 0xee, 0xf0, 0xff, 0xc2, 0xec, 0xef, 0xff, 0xbc, 0xec, 0xee, 0xff, 0xb5, 0xeb, 0xee, 0xff, 0xaf, 0xe9, 0xee, 0xff, 0xaa, 0xe9, 0xee, 0xff, 0xab, 0xe8, 0xee, 0xff, 0x9b, 0xe6, 0xed, 0xff, 0x82, 0xe5, 0xee, 0xff, 0x77, 0xe3, 0xef, 0xff, 0x88, 0xe4, 0xee, 0xff, 0xa0, 0xe5, 0xee, 0xff, 0xa8, 0xe6, 0xee, 0xff, 0xa3, 0xe5, 0xee, 0xff, 0x98, 0xe3, 0xee, 0xff, 0x6f, 0xdf, 0xef, 0xff, 0x42, 0xdc, 0xf4, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xf0, 0x05, 0xef, 0xfc, 0x3f, 0x02, 0xee, 0xfd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xde, 0xde, 0x00, 0xe2, 0xe2, 0xe2, 0x08, 0xd4, 0xd4, 0xd4, 0x33, 0xd6, 0xd6, 0xd6, 0x30, 0xdd, 0xdc, 0xdb, 0x23, 0x44, 0xe5, 0xf2, 0x80, 0x2e, 0xde, 0xf6, 0xff, 0x43, 0xd9, 0xf3, 0xff, 0x3c, 0xd9, 0xf4, 0xff, 0x5f, 0xdc, 0xf1, 0xff, 0x91, 0xe1, 0xee, 0xff, 0xa0, 0xe4, 0xee, 0xff, 0x9c, 0xe3, 0xee, 0xff, 0x94, 0xe3, 0xee, 0xff, 0xa0, 0xe5, 0xee, 0xff, 0xb7, 0xe9, 0xef, 0xff, 0xbe, 0xe9, 0xef, 0xff, 0xc8, 0xeb, 0xef, 0xff, 0xc6, 0xeb, 0xef, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xbf, 0xeb, 0xef, 0xff, 0xbc, 0xeb, 0xef, 0xff, 0xc6, 0xec, 0xef, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xd5, 0xef, 0xf1, 0xff, 0xd6, 0xef, 0xf0, 0xff, 0xd9, 0xef, 0xf1, 0xff, 0xd6, 0xef, 0xf0, 0xff, 0xcb, 0xee, 0xf0, 0xff, 0xc0, 0xec, 0xef, 0xff, 0xbd, 0xec, 0xee, 0xff, 0xbc, 0xeb, 0xee, 0xff, 0xba, 0xeb, 0xef, 0xff, 0xb6, 0xea, 0xee, 0xff, 0xb2, 0xe9, 0xee, 0xff, 0xa2, 0xe7, 0xed, 0xff, 0x84, 0xe4, 0xed, 0xff, 0x6b, 0xe2, 0xef, 0xff, 0x6f, 0xe2, 0xee, 0xff, 0x86, 0xe3, 0xee, 0xff, 0x97, 0xe4, 0xee, 0xff, 0xa1, 0xe5, 0xee, 0xff, 0x98, 0xe3, 0xee, 0xff, 0x71, 0xde, 0xee, 0xff, 0x3c, 0xdb, 0xf4, 0xff, 0x0d, 0xdb, 0xfc, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x00, 0xec, 0xfe, 0x3b, 0x00, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0xe8, 0x00, 0xf4, 0xf4, 0xf4, 0x00, 0xd5, 0xd5, 0xd5, 0x0b, 0xd3, 0xd3, 0xd3, 0x18, 0xcb, 0xd3, 0xd3, 0x20, 0x8b, 0xdc, 0xea, 0x3b, 0x68, 0xd8, 0xed, 0x8b, 0x4b, 0xda, 0xf2, 0xeb, 0x41, 0xd9, 0xf4, 0xff, 0x39, 0xda, 0xf4, 0xff, 0x57, 0xdc, 0xf1, 0xff, 0x80, 0xdf, 0xee, 0xff, 0x86, 0xe1, 0xee, 0xff, 0x8d, 0xe2, 0xee, 0xff, 0xa1, 0xe5, 0xee, 0xff, 0xb5, 0xe8, 0xef, 0xff, 0xbf, 0xea, 0xef, 0xff, 0xc9, 0xec, 0xf0, 0xff, 0xca, 0xec, 0xf0, 0xff, 0xc9, 0xec, 0xef, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xbf, 0xeb, 0xef, 0xff, 0xc5, 0xeb, 0xef, 0xff, 0xcd, 0xed, 0xf0, 0xff, 0xd1, 0xee, 0xf0, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xd4, 0xee, 0xf0, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xcb, 0xed, 0xf0, 0xff, 0xc0, 0xeb, 0xef, 0xff, 0xb3, 0xea, 0xee, 0xff, 0xb2, 0xe9, 0xee, 0xff, 0xb4, 0xe9, 0xee, 0xff, 0xb5, 0xea, 0xee, 0xff, 0xb8, 0xe9, 0xee, 0xff, 0xb1, 0xe8, 0xee, 0xff, 0x9a, 0xe6, 0xee, 0xff, 0x76, 0xe2, 0xee, 0xff, 0x64, 0xe1, 0xf0, 0xff, 0x66, 0xe0, 0xf0, 0xff, 0x73, 0xe1, 0xef, 0xff, 0x84, 0xe1, 0xee, 0xff, 0x8e, 0xe1, 0xee, 0xff, 0x86, 0xe0, 0xee, 0xff, 0x54, 0xdc, 0xf1, 0xff, 0x22, 0xd9, 0xf7, 0xff, 0x03, 0xd9, 0xfd, 0xff, 0x00, 0xd9, 0xfd, 0xc4, 0x00, 0xd8, 0xff, 0x58, 0x00, 0xe6, 0xff, 0x18, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xec, 0xec, 0xec, 0x00, 0xe1, 0xe1, 0xe1, 0x04, 0xd4, 0xd4, 0xd4, 0x0b, 0xcb, 0xcc, 0xcc, 0x10, 0xe9, 0xd8, 0xd3, 0x1b, 0xff, 0xcf, 0xb6, 0x1c, 0x48, 0xdb, 0xf2, 0xaf, 0x2b, 0xd9, 0xf6, 0xff, 0x2b, 0xda, 0xf6, 0xff, 0x4f, 0xdc, 0xf2, 0xff, 0x59, 0xdd, 0xf1, 0xff, 0x66, 0xde, 0xf0, 0xff, 0x92, 0xe3, 0xee, 0xff, 0xa4, 0xe5, 0xee, 0xff, 0xb6, 0xe8, 0xee, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0xc8, 0xec, 0xef, 0xff, 0xcb, 0xec, 0xf0, 0xff, 0xc8, 0xec, 0xef, 0xff, 0xc5, 0xeb, 0xef, 0xff, 0xc3, 0xeb, 0xef, 0xff, 0xc4, 0xec, 0xef, 0xff, 0xc8, 0xec, 0xef, 0xff, 0xcb, 0xed, 0xf0, 0xff, 0xcf, 0xed, 0xf0, 0xff, 0xd0, 0xee, 0xf0, 0xff, 0xcc, 0xed, 0xf0, 0xff, 0xc3, 0xec, 0xef, 0xff, 0xb3, 0xea, 0xee, 0xff, 0xa7, 0xe8, 0xee, 0xff, 0xa3, 0xe8, 0xee, 0xff, 0xa4, 0xe7, 0xee, 0xff, 0xac, 0xe8, 0xee, 0xff, 0xb2, 0xe9, 0xee, 0xff, 0xab, 0xe7, 0xee, 0xff, 0x92, 0xe4, 0xee, 0xff, 0x70, 0xe1, 0xef, 0xff, 0x53, 0xdf, 0xf1, 0xff, 0x4f, 0xde, 0xf2, 0xff, 0x5b, 0xde, 0xf1, 0xff, 0x6f, 0xdf, 0xef, 0xff, 0x7f, 0xe0, 0xee, 0xff, 0x68, 0xdc, 0xef, 0xff, 0x42, 0xda, 0xf3, 0xff, 0x40, 0xda, 0xf2, 0x8c, 0x00, 0xfb, 0xff, 0x00, 0x5d, 0xd7, 0xf9, 0x00, 0x00, 0xd9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xff, 0xff, 0xff, 0x00, 0xcb, 0xcb, 0xcb, 0x03, 0xd7, 0xd7, 0xd7, 0x07, 0xd5, 0xd5, 0xd5, 0x0b, 0xfa, 0xcf, 0xc5, 0x0b, 0x37, 0xe7, 0xf5, 0x7b, 0x17, 0xdb, 0xf9, 0xff, 0x1b, 0xda, 0xf9, 0xff, 0x1d, 0xd9, 0xf8, 0xff, 0x2c, 0xdb, 0xf6, 0xff, 0x32, 0xdb, 0xf5, 0xff, 0x39, 0xdd, 0xf4, 0xff, 0x80, 0xe0, 0xee, 0xff, 0x9e, 0xe4, 0xee, 0xff, 0xa9, 0xe7, 0xee, 0xff, 0xb7, 0xe8, 0xee, 0xff, 0xbb, 0xe9, 0xef, 0xff, 0xbf, 0xea, 0xee, 0xff, 0xc1, 0xeb, 0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0xc1, 0xeb, 0xef, 0xff, 0xc1, 0xeb, 0xef, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0xc7, 0xec, 0xef, 0xff, 0xc7, 0xec, 0xef, 0xff, 0xc6, 0xeb, 0xef, 0xff, 0xc1, 0xeb, 0xef, 0xff, 0xb5, 0xea, 0xee, 0xff, 0xa4, 0xe8, 0xee, 0xff, 0x92, 0xe6, 0xed, 0xff, 0x8c, 0xe5, 0xee, 0xff, 0x90, 0xe5, 0xed, 0xff, 0x9b, 0xe6, 0xed, 0xff, 0x9d, 0xe6, 0xed, 0xff, 0x97, 0xe5, 0xee, 0xff, 0x84, 0xe3, 0xee, 0xff, 0x64, 0xdf, 0xf0, 0xff, 0x41, 0xde, 0xf3, 0xff, 0x3e, 0xdd, 0xf4, 0xff, 0x4d, 0xdc, 0xf2, 0xff, 0x59, 0xdc, 0xf1, 0xff, 0x59, 0xdc, 0xf1, 0xff, 0x51, 0xdb, 0xf2, 0xff, 0x46, 0xdc, 0xf3, 0xf8, 0x77, 0xdf, 0xe8, 0x40, 0xa9, 0xd7, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xce, 0xce, 0xce, 0x07, 0xdc, 0xdc, 0xdc, 0x08, 0xd9, 0xd9, 0xd9, 0x0b, 0xe0, 0xd5, 0xd3, 0x0c, 0x64, 0xe4, 0xf1, 0x3f, 0x0e, 0xdd, 0xfa, 0xfb, 0x16, 0xd8, 0xf9, 0xff, 0x1b, 0xd8, 0xf8, 0xff, 0x20, 0xda, 0xf8, 0xff, 0x2a, 0xda, 0xf6, 0xff, 0x2d, 0xdb, 0xf6, 0xff, 0x30, 0xdc, 0xf5, 0xff, 0x71, 0xe0, 0xee, 0xff, 0x92, 0xe3, 0xee, 0xff, 0xa4, 0xe5, 0xee, 0xff, 0xaf, 0xe7, 0xee, 0xff, 0xb4, 0xe8, 0xef, 0xff, 0xb3, 0xe8, 0xee, 0xff, 0xb4, 0xe9, 0xee, 0xff, 0xb7, 0xe9, 0xee, 0xff, 0xb5, 0xe9, 0xee, 0xff, 0xb9, 0xea, 0xee, 0xff, 0xbc, 0xea, 0xee, 0xff, 0xbb, 0xea, 0xee, 0xff, 0xb7, 0xea, 0xee, 0xff, 0xb7, 0xea, 0xee, 0xff, 0xb6, 0xe9, 0xee, 0xff, 0xb0, 0xe9, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0x9c, 0xe6, 0xed, 0xff, 0x86, 0xe5, 0xed, 0xff, 0x73, 0xe3, 0xee, 0xff, 0x75, 0xe3, 0xee, 0xff, 0x78, 0xe3, 0xee, 0xff, 0x77, 0xe2, 0xee, 0xff, 0x6f, 0xe1, 0xef, 0xff, 0x65, 0xdf, 0xf0, 0xff, 0x5d, 0xdf, 0xf0, 0xff, 0x30, 0xdd, 0xf5, 0xff, 0x26, 0xdc, 0xf7, 0xff, 0x2a, 0xdb, 0xf6, 0xff, 0x2f, 0xdb, 0xf5, 0xff, 0x31, 0xda, 0xf6, 0xff, 0x2f, 0xd9, 0xf6, 0xff, 0x31, 0xd9, 0xf5, 0xff, 0x24, 0xe2, 0xf7, 0xf0, 0x00, 0xf9, 0xff, 0x08, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x07, 0xcd, 0xcd, 0xcd, 0x10, 0xce, 0xce, 0xce, 0x18, 0xd1, 0xcb, 0xca, 0x17, 0x93, 0xdc, 0xe6, 0x2f, 0x4a, 0xd8, 0xf1, 0x6c, 0x2d, 0xd8, 0xf5, 0x8c, 0x27, 0xd9, 0xf7, 0xb3, 0x25, 0xd9, 0xf7, 0xff, 0x33, 0xda, 0xf5, 0xff, 0x3c, 0xda, 0xf3, 0xff, 0x4d, 0xdb, 0xf1, 0xff, 0x7b, 0xe0, 0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0xa7, 0xe5, 0xee, 0xff, 0xb7, 0xe8, 0xef, 0xff, 0xbd, 0xe9, 0xef, 0xff, 0xbe, 0xea, 0xef, 0xff, 0xba, 0xe9, 0xef, 0xff, 0xb5, 0xe9, 0xee, 0xff, 0xb2, 0xe8, 0xee, 0xff, 0xb5, 0xe9, 0xee, 0xff, 0xb8, 0xe9, 0xee, 0xff, 0xb8, 0xe9, 0xee, 0xff, 0xb4, 0xe9, 0xee, 0xff, 0xad, 0xe8, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xa3, 0xe7, 0xee, 0xff, 0xa2, 0xe7, 0xee, 0xff, 0x9c, 0xe6, 0xed, 0xff, 0x89, 0xe4, 0xed, 0xff, 0x74, 0xe2, 0xee, 0xff, 0x6d, 0xe2, 0xef, 0xff, 0x6c, 0xe1, 0xef, 0xff, 0x67, 0xe1, 0xef, 0xff, 0x58, 0xdf, 0xf1, 0xff, 0x4d, 0xde, 0xf2, 0xff, 0x40, 0xdd, 0xf3, 0xff, 0x26, 0xdd, 0xf7, 0xff, 0x17, 0xdc, 0xf9, 0xff, 0x11, 0xdb, 0xfb, 0xff, 0x13, 0xdb, 0xfa, 0xff, 0x16, 0xd9, 0xfa, 0xf3, 0x1a, 0xd8, 0xf8, 0xa7, 0x1b, 0xd8, 0xf7, 0x83, 0x2a, 0xd9, 0xf7, 0x53, 0x00, 0xf1, 0xff, 0x13, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xe1, 0xe1, 0x00, 0xe9, 0xe9, 0xe9, 0x00, 0xd3, 0xd3, 0xd3, 0x07, 0xce, 0xce, 0xce, 0x13, 0xd9, 0xd9, 0xd9, 0x24, 0xd8, 0xd8, 0xd8, 0x2c, 0xd9, 0xd9, 0xd9, 0x2c, 0xe5, 0xdd, 0xdb, 0x24, 0xf1, 0xd7, 0xd0, 0x24, 0x73, 0xde, 0xea, 0x60, 0x34, 0xd8, 0xf5, 0xff, 0x48, 0xda, 0xf3, 0xff, 0x53, 0xdb, 0xf2, 0xff, 0x73, 0xde, 0xef, 0xff, 0x99, 0xe3, 0xee, 0xff, 0xa1, 0xe4, 0xee, 0xff, 0xab, 0xe6, 0xee, 0xff, 0xba, 0xe9, 0xef, 0xff, 0xc3, 0xea, 0xef, 0xff, 0xc5, 0xea, 0xef, 0xff, 0xc7, 0xeb, 0xef, 0xff, 0xc1, 0xea, 0xef, 0xff, 0xbb, 0xe9, 0xee, 0xff, 0xbd, 0xea, 0xef, 0xff, 0xbc, 0xea, 0xee, 0xff, 0xbc, 0xea, 0xee, 0xff, 0xba, 0xea, 0xef, 0xff, 0xb0, 0xe8, 0xee, 0xff, 0xa7, 0xe7, 0xee, 0xff, 0x9e, 0xe6, 0xed, 0xff, 0x98, 0xe6, 0xed, 0xff, 0x98, 0xe6, 0xed, 0xff, 0x95, 0xe5, 0xed, 0xff, 0x8b, 0xe3, 0xee, 0xff, 0x7e, 0xe2, 0xee, 0xff, 0x76, 0xe1, 0xef, 0xff, 0x74, 0xe0, 0xef, 0xff, 0x6b, 0xdf, 0xf0, 0xff, 0x5c, 0xde, 0xf0, 0xff, 0x46, 0xdd, 0xf3, 0xff, 0x2a, 0xdc, 0xf6, 0xff, 0x19, 0xdc, 0xf9, 0xff, 0x0b, 0xda, 0xfc, 0xff, 0x08, 0xda, 0xfd, 0xff, 0x06, 0xda, 0xfd, 0xec, 0x76, 0xe4, 0xf8, 0x1b, 0xff, 0xcb, 0x8c, 0x04, 0xff, 0xff, 0xe8, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x00, 0xce, 0xce, 0xce, 0x04, 0xd3, 0xd3, 0xd3, 0x13, 0xd6, 0xd6, 0xd6, 0x1c, 0xdb, 0xdb, 0xdb, 0x34, 0xdd, 0xdd, 0xdd, 0x58, 0xdc, 0xdc, 0xdc, 0x5f, 0xdb, 0xdb, 0xdb, 0x4f, 0xcf, 0xdb, 0xda, 0x4f, 0x60, 0xde, 0xf0, 0xdf, 0x66, 0xdb, 0xf0, 0xff, 0x7d, 0xde, 0xef, 0xff, 0x91, 0xe1, 0xee, 0xff, 0xa6, 0xe4, 0xee, 0xff, 0xb5, 0xe7, 0xef, 0xff, 0xb4, 0xe7, 0xee, 0xff, 0xaf, 0xe6, 0xee, 0xff, 0xbd, 0xe9, 0xef, 0xff, 0xc9, 0xeb, 0xef, 0xff, 0xd2, 0xed, 0xf1, 0xff, 0xd9, 0xee, 0xf1, 0xff, 0xd1, 0xec, 0xf0, 0xff, 0x9a, 0xe5, 0xee, 0xff, 0x97, 0xe5, 0xee, 0xff, 0xb8, 0xe9, 0xee, 0xff, 0xbd, 0xe9, 0xef, 0xff, 0xbc, 0xe9, 0xef, 0xff, 0xbc, 0xea, 0xef, 0xff, 0xbb, 0xe9, 0xef, 0xff, 0xaf, 0xe8, 0xee, 0xff, 0xa0, 0xe5, 0xee, 0xff, 0x93, 0xe4, 0xee, 0xff, 0x8e, 0xe4, 0xee, 0xff, 0x8f, 0xe4, 0xee, 0xff, 0x90, 0xe4, 0xee, 0xff, 0x8b, 0xe2, 0xee, 0xff, 0x8d, 0xe3, 0xee, 0xff, 0x89, 0xe2, 0xee, 0xff, 0x7b, 0xe0, 0xee, 0xff, 0x5a, 0xdd, 0xf1, 0xff, 0x34, 0xdc, 0xf5, 0xff, 0x19, 0xdb, 0xf9, 0xff, 0x08, 0xdb, 0xfd, 0xff, 0x07, 0xd9, 0xfd, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x00, 0xe6, 0xff, 0x83, 0x00, 0xef, 0xff, 0x00, 0xfa, 0xfb, 0xfb, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdc, 0xdc, 0x00, 0xe0, 0xe0, 0xe0, 0x07, 0xce, 0xce, 0xce, 0x18, 0xd4, 0xd4, 0xd4, 0x1c, 0xd7, 0xd7, 0xd7, 0x28, 0xdb, 0xdb, 0xdb, 0x54, 0xdd, 0xdd, 0xdd, 0x67, 0xdf, 0xde, 0xde, 0x64, 0xb3, 0xdf, 0xe5, 0x80, 0x72, 0xde, 0xef, 0xf8, 0x93, 0xe0, 0xee, 0xf8, 0xad, 0xe5, 0xee, 0xfb, 0xb3, 0xe6, 0xee, 0xfc, 0xbf, 0xe9, 0xef, 0xff, 0xc9, 0xea, 0xef, 0xff, 0xc6, 0xea, 0xef, 0xff, 0xb7, 0xe7, 0xee, 0xff, 0xbb, 0xe8, 0xef, 0xff, 0xc3, 0xea, 0xef, 0xff, 0xc6, 0xea, 0xf0, 0xff, 0xce, 0xec, 0xf0, 0xff, 0xdf, 0xef, 0xf1, 0xff, 0x9d, 0xe5, 0xee, 0xff, 0x5b, 0xdf, 0xf0, 0xff, 0x8d, 0xe3, 0xee, 0xff, 0xb6, 0xe8, 0xef, 0xff, 0xbe, 0xea, 0xef, 0xff, 0xc1, 0xea, 0xef, 0xff, 0xc3, 0xea, 0xef, 0xff, 0xc2, 0xea, 0xef, 0xff, 0xb7, 0xe8, 0xef, 0xff, 0x8e, 0xe3, 0xee, 0xff, 0x86, 0xe3, 0xee, 0xff, 0x91, 0xe3, 0xee, 0xff, 0x92, 0xe3, 0xee, 0xff, 0x90, 0xe3, 0xee, 0xff, 0x89, 0xe2, 0xee, 0xff, 0x8c, 0xe2, 0xee, 0xff, 0x8b, 0xe1, 0xee, 0xff, 0x76, 0xdf, 0xef, 0xff, 0x52, 0xdb, 0xf1, 0xff, 0x1f, 0xda, 0xf8, 0xff, 0x09, 0xd9, 0xfc, 0xf7, 0x04, 0xd8, 0xfd, 0xec, 0x02, 0xd9, 0xfe, 0xef, 0x00, 0xde, 0xfe, 0xff, 0x00, 0xfb, 0xff, 0x08, 0x75, 0xee, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x00, 0xcd, 0xcd, 0xcd, 0x0b, 0xd6, 0xd6, 0xd6, 0x20, 0xda, 0xda, 0xda, 0x24, 0xd4, 0xd4, 0xd4, 0x2f, 0xd9, 0xd9, 0xd9, 0x3f, 0xdb, 0xdb, 0xdb, 0x43, 0xdc, 0xdb, 0xdb, 0x4b, 0xc6, 0xdb, 0xdf, 0x5c, 0xc3, 0xdd, 0xe3, 0x7c, 0xd5, 0xe2, 0xe5, 0x9f, 0xe8, 0xea, 0xeb, 0xc7, 0xb9, 0xe8, 0xef, 0xff, 0xbe, 0xe8, 0xef, 0xff, 0xc1, 0xe9, 0xef, 0xff, 0xc1, 0xe9, 0xef, 0xff, 0xc3, 0xea, 0xef, 0xff, 0xaf, 0xe6, 0xee, 0xff, 0xab, 0xe6, 0xee, 0xff, 0xae, 0xe6, 0xee, 0xff, 0xb7, 0xe8, 0xee, 0xff, 0xbb, 0xe9, 0xef, 0xff, 0x86, 0xe2, 0xee, 0xff, 0x33, 0xde, 0xf5, 0xff, 0x3c, 0xde, 0xf4, 0xff, 0x7e, 0xe1, 0xee, 0xff, 0xa3, 0xe5, 0xee, 0xff, 0x8a, 0xe3, 0xef, 0xff, 0x98, 0xe4, 0xee, 0xff, 0xa9, 0xe6, 0xee, 0xff, 0x9c, 0xe4, 0xee, 0xff, 0x79, 0xe1, 0xee, 0xff, 0x66, 0xe0, 0xf0, 0xff, 0x90, 0xe3, 0xee, 0xff, 0x96, 0xe3, 0xee, 0xff, 0x8c, 0xe2, 0xee, 0xff, 0x82, 0xe1, 0xee, 0xff, 0x7c, 0xe0, 0xee, 0xff, 0x78, 0xde, 0xef, 0xff, 0x6d, 0xdd, 0xef, 0xff, 0x56, 0xdc, 0xf2, 0xff, 0x1d, 0xd9, 0xf9, 0xff, 0x0b, 0xd9, 0xfc, 0xd3, 0x42, 0xdc, 0xfc, 0x1c, 0x00, 0xd8, 0xfd, 0x1c, 0x00, 0xd7, 0xfe, 0x28, 0x00, 0xee, 0xff, 0x0f, 0x00, 0xea, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0x00, 0xd5, 0xd5, 0xd5, 0x0c, 0xd9, 0xd9, 0xd9, 0x2b, 0xd5, 0xd5, 0xd5, 0x33, 0xdb, 0xdb, 0xdb, 0x3b, 0xda, 0xda, 0xda, 0x40, 0xd8, 0xd8, 0xd8, 0x3b, 0xd9, 0xd9, 0xd9, 0x34, 0xd9, 0xd9, 0xd9, 0x3f, 0xda, 0xda, 0xda, 0x54, 0xe0, 0xdf, 0xdf, 0x74, 0xd4, 0xe6, 0xe8, 0xbb, 0xa1, 0xe3, 0xee, 0xff, 0xaa, 0xe4, 0xee, 0xff, 0xb3, 0xe6, 0xef, 0xff, 0xb1, 0xe6, 0xef, 0xff, 0xb3, 0xe7, 0xef, 0xff, 0x9b, 0xe3, 0xee, 0xff, 0x89, 0xe0, 0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0x95, 0xe2, 0xee, 0xff, 0x90, 0xe2, 0xee, 0xff, 0x7c, 0xe0, 0xef, 0xff, 0x3a, 0xdd, 0xf4, 0xff, 0x1f, 0xdf, 0xf8, 0xff, 0x3b, 0xde, 0xf4, 0xff, 0x78, 0xe1, 0xee, 0xff, 0x68, 0xdf, 0xf0, 0xff, 0x51, 0xde, 0xf1, 0xff, 0x78, 0xe1, 0xef, 0xff, 0x82, 0xe1, 0xee, 0xff, 0x69, 0xdf, 0xef, 0xff, 0x3d, 0xde, 0xf4, 0xff, 0x5b, 0xde, 0xf1, 0xff, 0x98, 0xe3, 0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0x6c, 0xde, 0xf0, 0xff, 0x61, 0xdd, 0xf0, 0xff, 0x54, 0xdc, 0xf1, 0xff, 0x48, 0xdb, 0xf3, 0xff, 0x3d, 0xd9, 0xf4, 0xff, 0x17, 0xd9, 0xfa, 0xff, 0x07, 0xda, 0xfd, 0xe7, 0x4c, 0xe9, 0xfa, 0x18, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xae, 0xae, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe2, 0xe2, 0x00, 0xe7, 0xe7, 0xe7, 0x07, 0xd3, 0xd3, 0xd3, 0x20, 0xd4, 0xd4, 0xd4, 0x30, 0xda, 0xda, 0xda, 0x3c, 0xdb, 0xdb, 0xdb, 0x50, 0xdb, 0xdb, 0xdb, 0x50, 0xd8, 0xd8, 0xd8, 0x40, 0xd6, 0xd6, 0xd6, 0x38, 0xda, 0xda, 0xda, 0x4b, 0xe3, 0xdf, 0xde, 0x63, 0x94, 0xe2, 0xeb, 0xc4, 0x7d, 0xde, 0xef, 0xff, 0x8a, 0xe0, 0xee, 0xff, 0xa0, 0xe2, 0xed, 0xf3, 0x91, 0xe1, 0xee, 0xfc, 0x78, 0xde, 0xef, 0xff, 0x6c, 0xdd, 0xef, 0xff, 0x6a, 0xdd, 0xef, 0xff, 0x77, 0xdf, 0xee, 0xff, 0x87, 0xe1, 0xee, 0xff, 0x8b, 0xe1, 0xee, 0xff, 0x6d, 0xde, 0xef, 0xff, 0x46, 0xdd, 0xf3, 0xff, 0x24, 0xdd, 0xf7, 0xff, 0x22, 0xdd, 0xf7, 0xff, 0x39, 0xdd, 0xf5, 0xff, 0x3b, 0xdd, 0xf4, 0xff, 0x28, 0xdd, 0xf7, 0xff, 0x43, 0xdd, 0xf3, 0xff, 0x67, 0xdf, 0xef, 0xff, 0x64, 0xde, 0xef, 0xff, 0x3e, 0xdc, 0xf3, 0xff, 0x30, 0xdc, 0xf5, 0xff, 0x53, 0xdd, 0xf1, 0xff, 0x69, 0xdd, 0xef, 0xff, 0x3a, 0xdb, 0xf4, 0xff, 0x2c, 0xda, 0xf6, 0xff, 0x32, 0xda, 0xf5, 0xff, 0x2a, 0xda, 0xf7, 0xf7, 0x27, 0xd8, 0xf6, 0xe3, 0x12, 0xd9, 0xfa, 0xff, 0x05, 0xda, 0xfd, 0xff, 0x1a, 0xe3, 0xfe, 0x2c, 0xfc, 0xfa, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xcb, 0xcb, 0x00, 0xc5, 0xc5, 0xc5, 0x03, 0xd9, 0xd9, 0xd9, 0x0f, 0xcf, 0xcf, 0xcf, 0x18, 0xd8, 0xd8, 0xd8, 0x23, 0xda, 0xda, 0xda, 0x43, 0xda, 0xda, 0xda, 0x53, 0xda, 0xda, 0xda, 0x4b, 0xda, 0xda, 0xda, 0x3c, 0xda, 0xda, 0xda, 0x37, 0xda, 0xd9, 0xd8, 0x40, 0x6d, 0xdc, 0xee, 0xa8, 0x93, 0xdb, 0xea, 0x9f, 0xd7, 0xe0, 0xe1, 0x83, 0xd8, 0xe2, 0xe4, 0xa0, 0x74, 0xdd, 0xef, 0xf8, 0x44, 0xda, 0xf3, 0xff, 0x35, 0xda, 0xf5, 0xff, 0x41, 0xdb, 0xf4, 0xff, 0x59, 0xdb, 0xf1, 0xff, 0x74, 0xde, 0xef, 0xff, 0x78, 0xdf, 0xee, 0xff, 0x62, 0xdd, 0xf0, 0xff, 0x54, 0xdc, 0xf1, 0xff, 0x3d, 0xdc, 0xf4, 0xff, 0x26, 0xdc, 0xf7, 0xff, 0x20, 0xdc, 0xf7, 0xff, 0x19, 0xdc, 0xf9, 0xff, 0x11, 0xdd, 0xfa, 0xff, 0x1e, 0xdc, 0xf8, 0xff, 0x3f, 0xdc, 0xf3, 0xff, 0x4f, 0xdd, 0xf2, 0xff, 0x2b, 0xdc, 0xf6, 0xff, 0x1d, 0xdb, 0xf8, 0xff, 0x21, 0xdb, 0xf7, 0xff, 0x2f, 0xdb, 0xf5, 0xff, 0x19, 0xda, 0xf9, 0xff, 0x12, 0xd9, 0xfb, 0xff, 0x1b, 0xd9, 0xf8, 0xff, 0x16, 0xd9, 0xf8, 0xf3, 0xff, 0xd9, 0x73, 0x0f, 0x7e, 0xd5, 0xe6, 0x37, 0x29, 0xd7, 0xfa, 0x7f, 0x16, 0xe2, 0xfe, 0x48, 0x00, 0xe1, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xde, 0xde, 0x03, 0xd7, 0xd7, 0xd7, 0x08, 0xdb, 0xdb, 0xdb, 0x0b, 0xdb, 0xdb, 0xdb, 0x0f, 0xd3, 0xd3, 0xd3, 0x28, 0xda, 0xda, 0xda, 0x38, 0xda, 0xda, 0xda, 0x3c, 0xda, 0xda, 0xda, 0x2c, 0xd5, 0xd5, 0xd5, 0x1f, 0xe0, 0xcb, 0xc6, 0x13, 0xde, 0xd8, 0xd6, 0x28, 0xdb, 0xda, 0xda, 0x47, 0xc6, 0xdf, 0xe4, 0x88, 0x6c, 0xdc, 0xef, 0xfb, 0x40, 0xd9, 0xf4, 0xff, 0x20, 0xd9, 0xf8, 0xff, 0x25, 0xd9, 0xf7, 0xfb, 0x3a, 0xda, 0xf4, 0xff, 0x50, 0xdb, 0xf2, 0xff, 0x54, 0xdb, 0xf2, 0xff, 0x48, 0xdb, 0xf2, 0xff, 0x4c, 0xdb, 0xf2, 0xff, 0x4b, 0xdb, 0xf2, 0xff, 0x38, 0xdc, 0xf4, 0xff, 0x22, 0xdb, 0xf7, 0xff, 0x11, 0xdb, 0xfa, 0xff, 0x0a, 0xdc, 0xfc, 0xff, 0x0d, 0xdb, 0xfb, 0xff, 0x1d, 0xdc, 0xf9, 0xff, 0x37, 0xda, 0xf5, 0xff, 0x2a, 0xda, 0xf6, 0xff, 0x12, 0xdb, 0xfa, 0xff, 0x0d, 0xd9, 0xfc, 0xff, 0x0a, 0xda, 0xfc, 0xff, 0x09, 0xda, 0xfd, 0xff, 0x06, 0xd9, 0xfd, 0xff, 0x0e, 0xd8, 0xfb, 0xff, 0x0f, 0xda, 0xf9, 0xff, 0xff, 0xb1, 0x00, 0x07, 0xdb, 0xd2, 0xcf, 0x0f, 0xf4, 0xd9, 0xcc, 0x0c, 0xfc, 0xd3, 0xc5, 0x04, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0xae, 0xae, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xbe, 0xbe, 0xbe, 0x03, 0xc5, 0xc5, 0xc5, 0x03, 0xcc, 0xcc, 0xcc, 0x04, 0xc5, 0xc5, 0xc5, 0x0c, 0xd1, 0xd1, 0xd1, 0x17, 0xdc, 0xdc, 0xdc, 0x20, 0xd4, 0xd4, 0xd4, 0x0c, 0xdd, 0xdd, 0xdd, 0x07, 0xd1, 0xd1, 0xd1, 0x0b, 0xdb, 0xdb, 0xdb, 0x1b, 0xa3, 0xda, 0xe7, 0x60, 0x3b, 0xd9, 0xf4, 0xf4, 0x50, 0xd9, 0xf2, 0xc7, 0x98, 0xd5, 0xe0, 0x2f, 0x10, 0xda, 0xfa, 0xc4, 0x0d, 0xd8, 0xfb, 0xff, 0x09, 0xda, 0xfb, 0xff, 0x24, 0xd9, 0xf8, 0xff, 0x2c, 0xd9, 0xf6, 0xff, 0x32, 0xdb, 0xf5, 0xff, 0x41, 0xdb, 0xf4, 0xff, 0x49, 0xda, 0xf3, 0xff, 0x39, 0xdb, 0xf5, 0xff, 0x15, 0xda, 0xfa, 0xff, 0x08, 0xdb, 0xfc, 0xff, 0x07, 0xda, 0xfd, 0xff, 0x0d, 0xda, 0xfc, 0xff, 0x14, 0xdb, 0xfa, 0xff, 0x10, 0xda, 0xfb, 0xff, 0x0a, 0xd9, 0xfc, 0xff, 0x08, 0xda, 0xfd, 0xff, 0x04, 0xd8, 0xfd, 0xff, 0x04, 0xd9, 0xfd, 0xa4, 0x10, 0xdb, 0xff, 0x3b, 0x04, 0xd7, 0xfd, 0xcc, 0x08, 0xd8, 0xfd, 0xff, 0xe4, 0xfd, 0x96, 0x04, 0xff, 0xff, 0xff, 0x00, 0xc4, 0xc4, 0xc4, 0x03, 0xda, 0xda, 0xda, 0x07, 0xc8, 0xc8, 0xc8, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xf0, 0xf0, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xca, 0xca, 0xca, 0x04, 0xd6, 0xd6, 0xd6, 0x07, 0xd1, 0xd1, 0xd1, 0x04, 0xba, 0xba, 0xba, 0x04, 0xea, 0xea, 0xea, 0x03, 0xda, 0xda, 0xda, 0x08, 0xa2, 0xd9, 0xe6, 0x1f, 0x74, 0xd5, 0xea, 0x38, 0xda, 0xd6, 0xd4, 0x24, 0xf6, 0xd7, 0xcd, 0x1f, 0x10, 0xdc, 0xf8, 0xa3, 0x08, 0xd8, 0xfd, 0xff, 0x04, 0xd8, 0xfd, 0xff, 0x08, 0xd8, 0xfb, 0x8b, 0x0c, 0xd9, 0xfc, 0xff, 0x12, 0xd9, 0xfb, 0xff, 0x1c, 0xd9, 0xf8, 0xff, 0x20, 0xd9, 0xf8, 0xff, 0x25, 0xd9, 0xf7, 0xff, 0x1f, 0xd9, 0xf8, 0xff, 0x0b, 0xda, 0xfd, 0xff, 0x04, 0xd9, 0xfd, 0xff, 0x04, 0xda, 0xfe, 0xff, 0x07, 0xd9, 0xfd, 0xff, 0x08, 0xd9, 0xfd, 0xec, 0x06, 0xd9, 0xfd, 0xac, 0x04, 0xd8, 0xfd, 0xff, 0x02, 0xd8, 0xfe, 0xff, 0x08, 0xde, 0xfd, 0x7b, 0x00, 0xd3, 0xfe, 0x00, 0x5a, 0xd6, 0xf8, 0x00, 0x16, 0xd8, 0xfd, 0x37, 0x4b, 0xea, 0xfb, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe1, 0xe1, 0xe1, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x00, 0xb1, 0xb1, 0xb1, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x03, 0xce, 0xce, 0xce, 0x03, 0xc9, 0xc9, 0xc9, 0x04, 0xe3, 0xe3, 0xe3, 0x03, 0xf1, 0xf1, 0xf1, 0x03, 0xcd, 0xcd, 0xcd, 0x04, 0xdc, 0xd4, 0xd2, 0x04, 0xe6, 0xdf, 0xde, 0x07, 0xd3, 0xd3, 0xd3, 0x0c, 0xe8, 0xd4, 0xd0, 0x1c, 0x41, 0xdc, 0xf4, 0x83, 0x07, 0xd8, 0xfc, 0xf0, 0x20, 0xd8, 0xfc, 0x43, 0x00, 0xd1, 0xfc, 0x00, 0x02, 0xd9, 0xfe, 0xef, 0x06, 0xd8, 0xfd, 0xff, 0x0a, 0xd8, 0xfc, 0xeb, 0x17, 0xd8, 0xf8, 0x73, 0x07, 0xd8, 0xfd, 0xff, 0x0c, 0xd9, 0xfc, 0xff, 0x0d, 0xd9, 0xfc, 0xec, 0x09, 0xd9, 0xfd, 0x78, 0x02, 0xd9, 0xfe, 0xff, 0x03, 0xd9, 0xfe, 0xff, 0x04, 0xd9, 0xfe, 0xc8, 0x00, 0xdc, 0xff, 0x00, 0x05, 0xd8, 0xff, 0x5f, 0x01, 0xd8, 0xfe, 0xff, 0x0a, 0xe1, 0xff, 0x50, 0x00, 0xde, 0xff, 0x00, 0x00, 0xb2, 0xff, 0x00, 0x59, 0xde, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xfd, 0xff, 0x00, 0xae, 0xae, 0xae, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xee, 0xee, 0xee, 0x03, 0xc0, 0xc0, 0xc0, 0x04, 0xff, 0xff, 0xff, 0x03, 0xf5, 0xf5, 0xf5, 0x03, 0xc6, 0xc6, 0xc6, 0x04, 0xde, 0xde, 0xde, 0x03, 0xe5, 0xe5, 0xe5, 0x03, 0xe2, 0xc8, 0xc1, 0x04, 0x60, 0xd8, 0xee, 0x2b, 0x79, 0xd8, 0xee, 0x28, 0xff, 0xa9, 0x00, 0x00, 0x00, 0xd8, 0xfd, 0x00, 0x00, 0xdc, 0xfe, 0x7b, 0x02, 0xd8, 0xfe, 0xff, 0x15, 0xd9, 0xfa, 0x33, 0x00, 0xd7, 0xff, 0x00, 0x01, 0xd8, 0xfe, 0xa7, 0x02, 0xd8, 0xfe, 0xff, 0x0e, 0xd8, 0xfd, 0x8c, 0x00, 0xcf, 0xff, 0x00, 0x00, 0xd9, 0xfe, 0x5b, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xdc, 0xff, 0x60, 0x00, 0xc4, 0xfc, 0x00, 0x00, 0xb4, 0xfe, 0x00, 0x00, 0xd7, 0xfe, 0x2c, 0x01, 0xe7, 0xff, 0x1b, 0x14, 0xe5, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xae, 0xae, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xe4, 0xe4, 0xe4, 0x03, 0xf7, 0xf9, 0xfa, 0x03, 0xe4, 0xc2, 0xb6, 0x04, 0xea, 0xe3, 0xe1, 0x08, 0xc1, 0xc1, 0xc1, 0x03, 0xfd, 0xfd, 0xff, 0x00, 0x15, 0xdb, 0xfe, 0x27, 0x0b, 0xda, 0xff, 0x44, 0x00, 0xce, 0xfb, 0x00, 0xd9, 0xef, 0xff, 0x00, 0x00, 0xdb, 0xfe, 0x1f, 0x01, 0xd8, 0xfe, 0xdf, 0x00, 0xc3, 0xfb, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xcd, 0xfc, 0x00, 0x00, 0xd8, 0xfe, 0x9f, 0x08, 0xff, 0xff, 0x00, 0x66, 0xe9, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xd0, 0xff, 0x00, 0x00, 0xe8, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xea, 0xea, 0xea, 0x03, 0xeb, 0xeb, 0xeb, 0x03, 0xee, 0xee, 0xee, 0x03, 0xff, 0xff, 0xff, 0x00, 0xc9, 0xff, 0xff, 0x00, 0x00, 0xc9, 0xfe, 0x00, 0xf4, 0xfc, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x04, 0xe1, 0xff, 0x00, 0x00, 0xd9, 0xff, 0x13, 0x0c, 0xdb, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x5e, 0xe3, 0xff, 0x00, 0x1d, 0xff, 0xff, 0x00, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xe3, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x69, 0x69, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x0f, 0xb9, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0xea, 0xff, 0x23, 0x00, 0xec, 0xfe, 0x3c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe9, 0xff, 0x20, 0x00, 0xe6, 0xfe, 0xd4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xe8, 0xff, 0x84, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xeb, 0xfe, 0x23, 0x00, 0xf0, 0xfb, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xe4, 0xff, 0x7b, 0x00, 0xe0, 0xfe, 0xff, 0x05, 
+  0xf1, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe6, 0xfd, 0xa7, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xeb, 0xfe, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0xea, 0xff, 0x58, 0x00, 0xdc, 0xfe, 0xff, 0x00, 
+  0xe9, 0xfd, 0x5c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xed, 0xff, 0x2f, 0x00, 0xee, 0xff, 0x20, 0xac, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0xe4, 0xff, 0x6f, 0x00, 0xe5, 0xfe, 0xef, 0x04, 
+  0xec, 0xfe, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe0, 0xfe, 0xe7, 0x01, 0xd8, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xef, 0x04, 0xed, 0xff, 0x58, 0x02, 0xdc, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x03, 
+  0xdd, 0xfe, 0xeb, 0x05, 0xed, 0xff, 0x58, 0x02, 0xe1, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x02, 0xec, 0xfe, 0x4b, 0x00, 0xe2, 0xfe, 0xff, 0x00, 
+  0xe6, 0xff, 0x4f, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x14, 0x00, 0xf3, 0xff, 0x13, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xe1, 0xff, 0x97, 0x01, 0xd9, 0xfe, 0xff, 0x02, 
+  0xe0, 0xfe, 0xf8, 0x04, 0xec, 0xfe, 0x9b, 0x01, 0xda, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x03, 0xde, 0xfe, 0xfc, 0x82, 0x02, 0xda, 0xfe, 0xff, 0x00, 0x02, 0xde, 0xfe, 0xff, 0x81, 
+  0x02, 0xda, 0xfe, 0xff, 0x04, 0x02, 0xdc, 0xfe, 0xef, 0x04, 0xeb, 0xfe, 0xb8, 0x02, 0xde, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xe3, 0xfd, 0x78, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0xee, 0xff, 0x3f, 0x00, 0xe9, 0xff, 0x0c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xdf, 0xfe, 0x2f, 0x00, 0xe5, 0xfe, 0xff, 0x01, 0xea, 0xfd, 0x8c, 0x05, 0xf3, 0xfd, 0x17, 0x03, 0xe0, 0xfd, 
+  0xc0, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x03, 0xdd, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x82, 0x02, 0xdb, 0xfe, 0xff, 0x82, 0x03, 0xdb, 0xfd, 0xff, 0x84, 0x02, 0xdb, 0xfe, 0xff, 
+  0x05, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdf, 0xfe, 0xab, 0x04, 0xed, 0xfe, 0x24, 0x03, 0xe9, 0xfe, 0xac, 0x00, 0xe2, 0xfe, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 
+  0xdb, 0xfe, 0x27, 0x01, 0xd9, 0xfe, 0xf8, 0x01, 0xdb, 0xfe, 0xff, 0x02, 0xe3, 0xfe, 0xef, 0x03, 0xdd, 0xfe, 0xf8, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x00, 0x03, 0xdb, 0xfd, 0xff, 0x82, 0x03, 0xdc, 
+  0xfd, 0xff, 0x00, 0x04, 0xdc, 0xfd, 0xff, 0x82, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x04, 0xdc, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0x02, 0xdb, 0xfe, 0xff, 
+  0x03, 0xde, 0xfe, 0xf7, 0x02, 0xe0, 0xfe, 0xfb, 0x01, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xe9, 0xff, 0x63, 0x00, 0xed, 0xfe, 0x38, 0x03, 0xed, 
+  0xfd, 0x1b, 0x02, 0xe0, 0xfe, 0x27, 0x01, 0xda, 0xfe, 0xf3, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x00, 
+  0x04, 0xdc, 0xfd, 0xff, 0x89, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x01, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x02, 0xda, 0xfe, 0xff, 0x04, 0x01, 0xda, 0xfe, 
+  0xef, 0x00, 0x00, 0x00, 0x00, 0x05, 0xed, 0xfe, 0x1f, 0x00, 0xec, 0xfe, 0x43, 0x00, 0xea, 0xff, 0x30, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xdd, 0xfd, 0x8b, 0x00, 0xdd, 0xfe, 0xff, 0x02, 
+  0xe3, 0xfe, 0xec, 0x03, 0xe7, 0xfe, 0xdc, 0x02, 0xdb, 0xfe, 0xfb, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 
+  0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 0xff, 0x82, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x00, 0x04, 0xde, 0xfd, 0xff, 0x81, 
+  0x04, 0xdd, 0xfd, 0xff, 0x07, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xf8, 0x07, 0xea, 0xfe, 0xd7, 0x03, 0xe1, 0xfe, 0xf0, 0x01, 0xdd, 0xfe, 
+  0xff, 0x00, 0xdb, 0xfe, 0x30, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xff, 0x2c, 0x81, 0x01, 0xd9, 0xfe, 0xff, 0x05, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 
+  0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x01, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x86, 0x06, 0xe0, 0xfd, 0xff, 
+  0x81, 0x06, 0xdf, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 
+  0xff, 0x01, 0xd9, 0xfe, 0xe7, 0x03, 0xdd, 0xfd, 0x14, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x10, 0x00, 0xed, 0xff, 0x1c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xd9, 0xfe, 
+  0xf0, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x05, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 
+  0xe0, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x84, 0x08, 0xe2, 0xfd, 0xff, 0x00, 0x07, 0xe2, 0xfd, 0xff, 0x81, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 
+  0x01, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xc7, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xee, 0xff, 0x1c, 0x00, 0xec, 0xff, 0x0f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe8, 0xfe, 0x3c, 0x00, 0xe4, 0xfe, 0xff, 0x01, 0xe7, 0xfe, 0xff, 0x04, 
+  0xe8, 0xfe, 0xff, 0x81, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x81, 
+  0x07, 0xe1, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x84, 0x08, 0xe3, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x06, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 
+  0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x05, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xde, 0xfe, 0xff, 0x03, 0xe8, 
+  0xfe, 0xff, 0x03, 0xe6, 0xfe, 0xff, 0x00, 0xe4, 0xfe, 0xff, 0x00, 0xee, 0xff, 0x18, 0x98, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe4, 0xfd, 0x03, 0x01, 0xd8, 0xfe, 0xd3, 0x01, 0xd9, 0xfe, 0xff, 
+  0x02, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x81, 0x03, 0xdc, 0xfd, 0xff, 0x07, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe0, 
+  0xfd, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x81, 0x09, 0xe4, 0xfc, 0xff, 0x84, 0x0a, 0xe5, 0xfc, 0xff, 0x08, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe4, 0xfc, 
+  0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x06, 0xdf, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x04, 0xdd, 
+  0xfd, 0xff, 0x04, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xda, 0xfe, 0x84, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x09, 0x02, 0xdb, 0xfd, 
+  0x47, 0x01, 0xd9, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 
+  0xff, 0x07, 0xe1, 0xfd, 0xff, 0x81, 0x08, 0xe2, 0xfd, 0xff, 0x01, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 0xfc, 0xff, 0x82, 0x0a, 0xe5, 0xfc, 0xff, 0x00, 0x0a, 0xe6, 0xfc, 0xff, 0x81, 0x0b, 0xe6, 
+  0xfc, 0xff, 0x82, 0x0a, 0xe5, 0xfc, 0xff, 0x0d, 0x09, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe1, 0xfd, 0xff, 
+  0x06, 0xdf, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xef, 0x01, 0xd4, 0xfe, 0x14, 
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0xeb, 0xfe, 0x37, 0x00, 0xed, 0xfd, 0x70, 0x01, 0xed, 0xfe, 0xa7, 0x05, 0xec, 0xfe, 0xc7, 0x02, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 
+  0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x09, 0xe4, 
+  0xfc, 0xff, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe6, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0b, 0xe7, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x82, 0x0c, 0xe8, 0xfc, 0xff, 0x81, 0x0c, 0xe7, 0xfc, 0xff, 
+  0x81, 0x0b, 0xe6, 0xfc, 0xff, 0x0f, 0x0a, 0xe5, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 0xfd, 0xff, 0x08, 0xe3, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 
+  0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfe, 0xf7, 0x05, 0xec, 0xfe, 0xc4, 0x03, 0xed, 0xfe, 0x97, 0x00, 0xec, 
+  0xfd, 0x6b, 0x00, 0xee, 0xff, 0x2b, 0x94, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xe3, 0xfe, 0x2f, 0x00, 0xde, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 
+  0x03, 0xdb, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x81, 0x06, 0xe0, 0xfd, 0xff, 0x06, 0x08, 0xe2, 0xfd, 0xff, 0x09, 0xe2, 0xfd, 0xff, 0x0a, 0xe4, 
+  0xfc, 0xff, 0x0b, 0xe5, 0xfc, 0xff, 0x0b, 0xe6, 0xfc, 0xff, 0x0c, 0xe6, 0xfc, 0xff, 0x0c, 0xe7, 0xfc, 0xff, 0x81, 0x0c, 0xe8, 0xfc, 0xff, 0x00, 0x0d, 0xe8, 0xfc, 0xff, 0x81, 0x0d, 0xe9, 0xfc, 
+  0xff, 0x0b, 0x0c, 0xe8, 0xfc, 0xff, 0x0d, 0xe8, 0xfc, 0xff, 0x0e, 0xe7, 0xfc, 0xff, 0x0e, 0xe7, 0xfb, 0xff, 0x0e, 0xe6, 0xfb, 0xff, 0x0c, 0xe5, 0xfc, 0xff, 0x0a, 0xe4, 0xfc, 0xff, 0x09, 0xe3, 
+  0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x06, 0xe0, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 
+  0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x00, 0xdf, 0xfe, 0xf7, 0x00, 0xee, 0xff, 0x0c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd7, 0xff, 0x64, 0x01, 0xd9, 0xfe, 0xff, 0x81, 0x02, 
+  0xda, 0xfe, 0xff, 0x0e, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x05, 0xdf, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x07, 0xe1, 0xfd, 0xff, 0x09, 0xe2, 0xfc, 0xff, 
+  0x19, 0xe2, 0xfa, 0xff, 0x1b, 0xe4, 0xf9, 0xff, 0x18, 0xe4, 0xf9, 0xff, 0x17, 0xe5, 0xfa, 0xff, 0x12, 0xe7, 0xfb, 0xff, 0x0f, 0xe8, 0xfb, 0xff, 0x0d, 0xe9, 0xfc, 0xff, 0x0d, 0xea, 0xfc, 0xff, 
+  0x82, 0x0e, 0xea, 0xfc, 0xff, 0x12, 0x10, 0xe9, 0xfb, 0xff, 0x15, 0xe9, 0xfb, 0xff, 0x23, 0xe7, 0xf8, 0xff, 0x33, 0xe5, 0xf5, 0xff, 0x34, 0xe4, 0xf5, 0xff, 0x28, 0xe4, 0xf7, 0xff, 0x1b, 0xe4, 
+  0xf9, 0xff, 0x12, 0xe2, 0xfa, 0xff, 0x09, 0xe2, 0xfc, 0xff, 0x07, 0xe2, 0xfd, 0xff, 0x07, 0xe0, 0xfd, 0xff, 0x05, 0xe0, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 
+  0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xf7, 0x01, 0xd8, 0xfe, 0x30, 0x97, 0x00, 0x00, 0x00, 0x00, 0x12, 0x02, 0xda, 0xfd, 0xb7, 0x02, 0xda, 0xfe, 0xff, 
+  0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x07, 0xdf, 0xfd, 0xff, 0x08, 0xe1, 0xfd, 0xff, 0x08, 0xe2, 0xfd, 0xff, 0x0b, 0xe2, 0xfc, 0xff, 
+  0x2c, 0xe2, 0xf6, 0xff, 0x49, 0xe3, 0xf1, 0xff, 0x47, 0xe3, 0xf2, 0xff, 0x38, 0xe5, 0xf4, 0xff, 0x2a, 0xe7, 0xf7, 0xff, 0x1f, 0xe8, 0xf9, 0xff, 0x17, 0xe9, 0xfb, 0xff, 0x14, 0xea, 0xfb, 0xff, 
+  0x12, 0xeb, 0xfc, 0xff, 0x81, 0x10, 0xeb, 0xfc, 0xff, 0x11, 0x0e, 0xeb, 0xfc, 0xff, 0x0f, 0xeb, 0xfc, 0xff, 0x12, 0xe9, 0xfb, 0xff, 0x26, 0xe7, 0xf8, 0xff, 0x48, 0xe4, 0xf2, 0xff, 0x4a, 0xe3, 
+  0xf2, 0xff, 0x3e, 0xe3, 0xf3, 0xff, 0x32, 0xe2, 0xf5, 0xff, 0x25, 0xe2, 0xf7, 0xff, 0x20, 0xe1, 0xf8, 0xff, 0x18, 0xe0, 0xfa, 0xff, 0x0e, 0xdf, 0xfc, 0xff, 0x07, 0xde, 0xfd, 0xff, 0x05, 0xde, 
+  0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0x9f, 0x95, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xed, 0xff, 0x23, 0x00, 0xed, 0xfd, 0x88, 
+  0x03, 0xe9, 0xfe, 0xd7, 0x02, 0xde, 0xfe, 0xf3, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x81, 0x04, 0xdd, 0xfd, 0xff, 0x24, 0x05, 0xdf, 0xfd, 0xff, 0x11, 0xdf, 0xfb, 0xff, 0x12, 0xe0, 
+  0xfb, 0xff, 0x0e, 0xe2, 0xfc, 0xff, 0x0b, 0xe3, 0xfb, 0xff, 0x2d, 0xe3, 0xf6, 0xff, 0x5c, 0xe3, 0xf0, 0xff, 0x7f, 0xe5, 0xee, 0xff, 0x75, 0xe5, 0xee, 0xff, 0x60, 0xe5, 0xf0, 0xff, 0x43, 0xe6, 
+  0xf3, 0xff, 0x2e, 0xe8, 0xf5, 0xff, 0x24, 0xe9, 0xf8, 0xff, 0x1d, 0xeb, 0xf9, 0xff, 0x18, 0xeb, 0xfa, 0xff, 0x15, 0xec, 0xfa, 0xff, 0x11, 0xec, 0xfc, 0xff, 0x0d, 0xec, 0xfc, 0xff, 0x0b, 0xeb, 
+  0xfc, 0xff, 0x17, 0xe8, 0xfa, 0xff, 0x37, 0xe5, 0xf4, 0xff, 0x56, 0xe4, 0xf1, 0xff, 0x62, 0xe3, 0xef, 0xff, 0x56, 0xe2, 0xf1, 0xff, 0x47, 0xe1, 0xf2, 0xff, 0x44, 0xe1, 0xf4, 0xff, 0x38, 0xe0, 
+  0xf4, 0xff, 0x2a, 0xdf, 0xf6, 0xff, 0x16, 0xde, 0xfa, 0xff, 0x09, 0xdd, 0xfc, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x03, 0xdc, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe0, 0xfe, 0xef, 0x04, 0xea, 
+  0xfe, 0xd3, 0x00, 0xed, 0xfe, 0x74, 0x00, 0xea, 0xff, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0xf7, 0xff, 0x04, 0x00, 0xe6, 0xfe, 0xa0, 0x00, 0xdc, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 
+  0x01, 0xd9, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x03, 0xdf, 0xfd, 0xff, 0x20, 0xdf, 0xf8, 0xff, 0x22, 0xe0, 0xf8, 0xff, 
+  0x1f, 0xe2, 0xf9, 0xff, 0x28, 0xe3, 0xf7, 0xff, 0x45, 0xe2, 0xf2, 0xff, 0x6b, 0xe3, 0xef, 0xff, 0x8e, 0xe6, 0xee, 0xff, 0x8b, 0xe6, 0xed, 0xff, 0x86, 0xe6, 0xee, 0xff, 0x7a, 0xe6, 0xee, 0xff, 
+  0x66, 0xe6, 0xef, 0xff, 0x4e, 0xe8, 0xf2, 0xff, 0x3a, 0xe9, 0xf3, 0xff, 0x2a, 0xeb, 0xf6, 0xff, 0x20, 0xec, 0xf8, 0xff, 0x1e, 0xeb, 0xf8, 0xff, 0x1f, 0xeb, 0xf8, 0xff, 0x2c, 0xe9, 0xf7, 0xff, 
+  0x3d, 0xe7, 0xf3, 0xff, 0x46, 0xe6, 0xf3, 0xff, 0x56, 0xe4, 0xf1, 0xff, 0x6e, 0xe4, 0xef, 0xff, 0x74, 0xe3, 0xee, 0xff, 0x72, 0xe3, 0xee, 0xff, 0x70, 0xe2, 0xef, 0xff, 0x64, 0xe0, 0xf0, 0xff, 
+  0x45, 0xdf, 0xf3, 0xff, 0x23, 0xde, 0xf8, 0xff, 0x04, 0xde, 0xfd, 0xff, 0x0a, 0xdd, 0xfc, 0xff, 0x08, 0xdc, 0xfc, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 
+  0x00, 0xde, 0xfe, 0xff, 0x00, 0xe9, 0xff, 0x63, 0x93, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x01, 0xd7, 0xfe, 0x54, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xda, 0xfe, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x03, 0xdc, 
+  0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x3d, 0xdf, 0xf4, 0xff, 0x3c, 0xe0, 0xf4, 0xff, 0x34, 0xe0, 0xf5, 0xff, 0x42, 0xe2, 0xf3, 0xff, 0x6e, 0xe3, 
+  0xef, 0xff, 0x8e, 0xe5, 0xed, 0xff, 0xa0, 0xe8, 0xee, 0xff, 0x97, 0xe7, 0xed, 0xff, 0x92, 0xe7, 0xed, 0xff, 0x8c, 0xe7, 0xed, 0xff, 0x88, 0xe8, 0xed, 0xff, 0x7b, 0xe7, 0xee, 0xff, 0x65, 0xe8, 
+  0xef, 0xff, 0x52, 0xe8, 0xf1, 0xff, 0x3b, 0xea, 0xf3, 0xff, 0x2c, 0xeb, 0xf6, 0xff, 0x23, 0xeb, 0xf7, 0xff, 0x29, 0xea, 0xf6, 0xff, 0x46, 0xe7, 0xf2, 0xff, 0x61, 0xe6, 0xf0, 0xff, 0x66, 0xe5, 
+  0xef, 0xff, 0x6d, 0xe4, 0xef, 0xff, 0x78, 0xe4, 0xee, 0xff, 0x81, 0xe4, 0xee, 0xff, 0x83, 0xe3, 0xed, 0xff, 0x82, 0xe2, 0xee, 0xff, 0x57, 0xe0, 0xf1, 0xff, 0x28, 0xdf, 0xf7, 0xff, 0x04, 0xdf, 
+  0xfd, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xd7, 0xff, 0x33, 0x95, 0x00, 0x00, 0x00, 0x00, 0x28, 
+  0x08, 0xdc, 0xfc, 0x80, 0x03, 0xda, 0xfe, 0xff, 0x03, 0xdb, 0xfe, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x05, 0xde, 0xfd, 0xff, 0x00, 0xdf, 0xfc, 0xff, 0x55, 0xdf, 0xf1, 0xff, 
+  0x5a, 0xe0, 0xf0, 0xff, 0x4f, 0xe2, 0xf3, 0xff, 0x52, 0xe2, 0xf1, 0xff, 0x7a, 0xe4, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xbe, 0xeb, 0xee, 0xff, 0xb9, 0xeb, 0xee, 0xff, 0xac, 0xe9, 0xee, 0xff, 
+  0x9d, 0xe8, 0xed, 0xff, 0x92, 0xe8, 0xed, 0xff, 0x87, 0xe8, 0xed, 0xff, 0x7f, 0xe8, 0xee, 0xff, 0x7e, 0xe8, 0xee, 0xff, 0x6f, 0xe8, 0xef, 0xff, 0x52, 0xe9, 0xf1, 0xff, 0x3b, 0xea, 0xf4, 0xff, 
+  0x31, 0xea, 0xf5, 0xff, 0x40, 0xe8, 0xf3, 0xff, 0x61, 0xe5, 0xf0, 0xff, 0x7c, 0xe5, 0xee, 0xff, 0x7e, 0xe5, 0xee, 0xff, 0x80, 0xe4, 0xee, 0xff, 0x89, 0xe4, 0xee, 0xff, 0x92, 0xe4, 0xed, 0xff, 
+  0x92, 0xe5, 0xee, 0xff, 0x68, 0xe1, 0xef, 0xff, 0x34, 0xdf, 0xf6, 0xff, 0x05, 0xde, 0xfc, 0xff, 0x05, 0xdd, 0xfd, 0xff, 0x04, 0xdc, 0xfd, 0xff, 0x02, 0xdb, 0xfe, 0xff, 0x02, 0xda, 0xfe, 0xf8, 
+  0x02, 0xe3, 0xff, 0x3b, 0x94, 0x00, 0x00, 0x00, 0x00, 0x14, 0x68, 0xe2, 0xec, 0x18, 0x3c, 0xe7, 0xf5, 0xbc, 0x2f, 0xdd, 0xf6, 0xf8, 0x23, 0xd9, 0xf8, 0xff, 0x17, 0xda, 0xf9, 0xff, 0x0e, 0xdc, 
+  0xfb, 0xff, 0x09, 0xdd, 0xfc, 0xff, 0x07, 0xdd, 0xfc, 0xff, 0x28, 0xde, 0xf6, 0xff, 0x61, 0xe0, 0xf0, 0xff, 0x69, 0xe1, 0xef, 0xff, 0x62, 0xe2, 0xf0, 0xff, 0x64, 0xe2, 0xf0, 0xff, 0x7e, 0xe4, 
+  0xee, 0xff, 0xad, 0xe9, 0xee, 0xff, 0xc7, 0xec, 0xef, 0xff, 0xd0, 0xee, 0xf0, 0xff, 0xcf, 0xee, 0xf0, 0xff, 0xc3, 0xed, 0xef, 0xff, 0xb3, 0xea, 0xee, 0xff, 0xa1, 0xe9, 0xed, 0xff, 0x81, 0x95, 
+  0xe9, 0xed, 0xff, 0x14, 0x9a, 0xe9, 0xed, 0xff, 0x91, 0xe8, 0xed, 0xff, 0x7b, 0xe8, 0xed, 0xff, 0x66, 0xe7, 0xef, 0xff, 0x5e, 0xe7, 0xf0, 0xff, 0x65, 0xe6, 0xef, 0xff, 0x7d, 0xe5, 0xee, 0xff, 
+  0x97, 0xe7, 0xed, 0xff, 0xa5, 0xe8, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xaa, 0xe7, 0xee, 0xff, 0xa3, 0xe6, 0xee, 0xff, 0x83, 0xe2, 0xee, 0xff, 0x51, 0xde, 0xf2, 0xff, 0x1d, 0xdd, 0xf8, 0xff, 
+  0x0f, 0xdc, 0xfb, 0xff, 0x04, 0xdd, 0xfd, 0xff, 0x03, 0xdb, 0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe2, 0xfe, 0xef, 0x03, 0xec, 0xfe, 0x94, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd2, 0xd2, 
+  0xd2, 0x08, 0xcf, 0xc7, 0xc4, 0x07, 0x18, 0xe9, 0xfe, 0x20, 0x06, 0xe5, 0xfb, 0xf0, 0x36, 0xd9, 0xf5, 0xff, 0x5a, 0xda, 0xf1, 0xff, 0x5f, 0xdc, 0xf1, 0xff, 0x51, 0xdb, 0xf2, 0xff, 0x3b, 0xdb, 
+  0xf3, 0xff, 0x24, 0xdd, 0xf7, 0xff, 0x12, 0xde, 0xfa, 0xff, 0x44, 0xde, 0xf4, 0xff, 0x7c, 0xe2, 0xee, 0xff, 0x89, 0xe4, 0xee, 0xff, 0x83, 0xe4, 0xee, 0xff, 0x82, 0xe4, 0xee, 0xff, 0x8e, 0xe5, 
+  0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xba, 0xea, 0xef, 0xff, 0xcd, 0xed, 0xf0, 0xff, 0xd7, 0xef, 0xf1, 0xff, 0xd8, 0xef, 0xf0, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xc3, 0xed, 0xee, 0xff, 0xb9, 0xeb, 
+  0xee, 0xff, 0xaa, 0xea, 0xed, 0xff, 0xa4, 0xea, 0xed, 0xff, 0xa8, 0xea, 0xed, 0xff, 0xa4, 0xea, 0xee, 0xff, 0x9a, 0xe9, 0xed, 0xff, 0x8a, 0xe7, 0xed, 0xff, 0x81, 0x81, 0xe6, 0xee, 0xff, 0x0f, 
+  0x8f, 0xe6, 0xed, 0xff, 0xa6, 0xe8, 0xee, 0xff, 0xb5, 0xe9, 0xee, 0xff, 0xbb, 0xe9, 0xee, 0xff, 0xb4, 0xe8, 0xee, 0xff, 0x9e, 0xe5, 0xee, 0xff, 0x79, 0xe1, 0xee, 0xff, 0x4f, 0xdd, 0xf2, 0xff, 
+  0x2a, 0xdd, 0xf6, 0xff, 0x0c, 0xdc, 0xfc, 0xff, 0x06, 0xdb, 0xfc, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd9, 0xfe, 0xff, 0x01, 0xdc, 0xfe, 0xff, 0x00, 0xe8, 0xfe, 0xd4, 0x00, 0xeb, 0xff, 0x04, 
+  0x8d, 0x00, 0x00, 0x00, 0x00, 0x15, 0xd2, 0xd2, 0xd2, 0x07, 0xcb, 0xcb, 0xcb, 0x17, 0xcc, 0xcc, 0xcc, 0x13, 0xcb, 0xce, 0xcf, 0x10, 0x9d, 0xd6, 0xea, 0x30, 0x4b, 0xd8, 0xf1, 0xb0, 0x68, 0xdc, 
+  0xf0, 0xff, 0x83, 0xdf, 0xee, 0xff, 0x81, 0xdf, 0xee, 0xff, 0x79, 0xdf, 0xee, 0xff, 0x64, 0xde, 0xf0, 0xff, 0x48, 0xde, 0xf3, 0xff, 0x5e, 0xdf, 0xf1, 0xff, 0x8e, 0xe3, 0xee, 0xff, 0xa7, 0xe6, 
+  0xee, 0xff, 0xa4, 0xe7, 0xee, 0xff, 0xa5, 0xe7, 0xee, 0xff, 0xa6, 0xe8, 0xee, 0xff, 0xaf, 0xe8, 0xee, 0xff, 0xb6, 0xea, 0xee, 0xff, 0xc4, 0xec, 0xef, 0xff, 0xd3, 0xef, 0xf0, 0xff, 0x81, 0xdd, 
+  0xf0, 0xf1, 0xff, 0x03, 0xd5, 0xef, 0xf0, 0xff, 0xd2, 0xee, 0xf0, 0xff, 0xc4, 0xed, 0xef, 0xff, 0xb6, 0xeb, 0xee, 0xff, 0x81, 0xab, 0xea, 0xed, 0xff, 0x12, 0xae, 0xea, 0xee, 0xff, 0xaa, 0xe9, 
+  0xee, 0xff, 0xa5, 0xe8, 0xee, 0xff, 0x9c, 0xe8, 0xee, 0xff, 0x93, 0xe6, 0xed, 0xff, 0x99, 0xe6, 0xed, 0xff, 0xa7, 0xe7, 0xee, 0xff, 0xbc, 0xea, 0xee, 0xff, 0xbe, 0xea, 0xef, 0xff, 0xb1, 0xe7, 
+  0xee, 0xff, 0x9e, 0xe4, 0xee, 0xff, 0x82, 0xe1, 0xee, 0xff, 0x5c, 0xdd, 0xf0, 0xff, 0x29, 0xdc, 0xf6, 0xff, 0x07, 0xdb, 0xfc, 0xff, 0x06, 0xda, 0xfd, 0xff, 0x04, 0xd9, 0xfd, 0xff, 0x00, 0xd9, 
+  0xff, 0x7b, 0x00, 0xd8, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xd1, 0xd1, 0xd1, 0x0f, 0xd8, 0xd8, 0xd8, 0x28, 0xce, 0xce, 0xce, 0x1b, 0xd3, 0xd3, 0xd3, 0x1f, 0xd4, 0xd5, 0xd6, 0x2c, 
+  0xea, 0xdc, 0xd8, 0x48, 0x96, 0xde, 0xeb, 0xb8, 0x80, 0xde, 0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0x98, 0xe2, 0xee, 0xff, 0x8d, 0xe2, 0xee, 0xff, 0x83, 0xe1, 0xee, 0xff, 0x7f, 0xe1, 0xee, 0xff, 
+  0x99, 0xe5, 0xee, 0xff, 0xae, 0xe8, 0xee, 0xff, 0xb0, 0xe8, 0xee, 0xff, 0xb9, 0xe9, 0xee, 0xff, 0xba, 0xe9, 0xee, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xc5, 0xeb, 0xef, 0xff, 0xc9, 0xed, 0xef, 0xff, 
+  0xd4, 0xee, 0xf0, 0xff, 0xdb, 0xf0, 0xf1, 0xff, 0xdc, 0xf0, 0xf1, 0xff, 0xdb, 0xf0, 0xf1, 0xff, 0xda, 0xef, 0xf1, 0xff, 0xd7, 0xef, 0xf0, 0xff, 0xca, 0xed, 0xef, 0xff, 0xb8, 0xeb, 0xee, 0xff, 
+  0xb1, 0xea, 0xee, 0xff, 0xaf, 0xea, 0xee, 0xff, 0xae, 0xe9, 0xee, 0xff, 0xab, 0xe9, 0xee, 0xff, 0xaa, 0xe9, 0xee, 0xff, 0x9c, 0xe6, 0xed, 0xff, 0x90, 0xe5, 0xed, 0xff, 0x91, 0xe5, 0xed, 0xff, 
+  0xa9, 0xe7, 0xee, 0xff, 0xb7, 0xe9, 0xef, 0xff, 0xb3, 0xe8, 0xee, 0xff, 0xa6, 0xe5, 0xee, 0xff, 0x9a, 0xe4, 0xee, 0xff, 0x78, 0xdf, 0xef, 0xff, 0x44, 0xdb, 0xf3, 0xff, 0x04, 0xdb, 0xfd, 0xff, 
+  0x05, 0xd9, 0xfd, 0xf8, 0x0e, 0xe1, 0xfe, 0x37, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xca, 0xca, 0xca, 0x13, 0xda, 0xda, 0xda, 0x47, 0xd7, 0xd7, 0xd7, 0x27, 0xd5, 0xd6, 0xd6, 0x1f, 0xf3, 0xd2, 
+  0xcf, 0x27, 0x7e, 0xe2, 0xea, 0x8b, 0x53, 0xde, 0xf2, 0xfb, 0x58, 0xdb, 0xf1, 0xff, 0x8f, 0xe1, 0xee, 0xff, 0xa8, 0xe4, 0xee, 0xff, 0xa0, 0xe4, 0xee, 0xff, 0x9a, 0xe4, 0xee, 0xff, 0x92, 0xe3, 
+  0xee, 0xff, 0xa4, 0xe6, 0xee, 0xff, 0xb6, 0xe8, 0xef, 0xff, 0xb7, 0xe9, 0xef, 0xff, 0xc5, 0xec, 0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0xc8, 0xec, 
+  0xef, 0xff, 0xd1, 0xee, 0xf0, 0xff, 0xd8, 0xef, 0xf1, 0xff, 0xd9, 0xef, 0xf1, 0xff, 0xdb, 0xf0, 0xf1, 0xff, 0xdb, 0xef, 0xf1, 0xff, 0xd9, 0xf0, 0xf0, 0xff, 0xce, 0xee, 0xf0, 0xff, 0xc2, 0xec, 
+  0xef, 0xff, 0xbc, 0xec, 0xee, 0xff, 0xb5, 0xeb, 0xee, 0xff, 0xaf, 0xe9, 0xee, 0xff, 0xaa, 0xe9, 0xee, 0xff, 0xab, 0xe8, 0xee, 0xff, 0x9b, 0xe6, 0xed, 0xff, 0x82, 0xe5, 0xee, 0xff, 0x77, 0xe3, 
+  0xef, 0xff, 0x88, 0xe4, 0xee, 0xff, 0xa0, 0xe5, 0xee, 0xff, 0xa8, 0xe6, 0xee, 0xff, 0xa3, 0xe5, 0xee, 0xff, 0x98, 0xe3, 0xee, 0xff, 0x6f, 0xdf, 0xef, 0xff, 0x42, 0xdc, 0xf4, 0xff, 0x03, 0xdb, 
+  0xfd, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x03, 0xe3, 0xfe, 0xf0, 0x05, 0xef, 0xfc, 0x3f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe2, 0xe2, 0xe2, 0x08, 0xd4, 0xd4, 0xd4, 0x33, 0xd6, 0xd6, 0xd6, 0x30, 
+  0xdd, 0xdc, 0xdb, 0x23, 0x44, 0xe5, 0xf2, 0x80, 0x2e, 0xde, 0xf6, 0xff, 0x43, 0xd9, 0xf3, 0xff, 0x3c, 0xd9, 0xf4, 0xff, 0x5f, 0xdc, 0xf1, 0xff, 0x91, 0xe1, 0xee, 0xff, 0xa0, 0xe4, 0xee, 0xff, 
+  0x9c, 0xe3, 0xee, 0xff, 0x94, 0xe3, 0xee, 0xff, 0xa0, 0xe5, 0xee, 0xff, 0xb7, 0xe9, 0xef, 0xff, 0xbe, 0xe9, 0xef, 0xff, 0xc8, 0xeb, 0xef, 0xff, 0xc6, 0xeb, 0xef, 0xff, 0xc2, 0xeb, 0xef, 0xff, 
+  0xbf, 0xeb, 0xef, 0xff, 0xbc, 0xeb, 0xef, 0xff, 0xc6, 0xec, 0xef, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xd5, 0xef, 0xf1, 0xff, 0xd6, 0xef, 0xf0, 0xff, 0xd9, 0xef, 0xf1, 0xff, 0xd6, 0xef, 0xf0, 0xff, 
+  0xcb, 0xee, 0xf0, 0xff, 0xc0, 0xec, 0xef, 0xff, 0xbd, 0xec, 0xee, 0xff, 0xbc, 0xeb, 0xee, 0xff, 0xba, 0xeb, 0xef, 0xff, 0xb6, 0xea, 0xee, 0xff, 0xb2, 0xe9, 0xee, 0xff, 0xa2, 0xe7, 0xed, 0xff, 
+  0x84, 0xe4, 0xed, 0xff, 0x6b, 0xe2, 0xef, 0xff, 0x6f, 0xe2, 0xee, 0xff, 0x86, 0xe3, 0xee, 0xff, 0x97, 0xe4, 0xee, 0xff, 0xa1, 0xe5, 0xee, 0xff, 0x98, 0xe3, 0xee, 0xff, 0x71, 0xde, 0xee, 0xff, 
+  0x3c, 0xdb, 0xf4, 0xff, 0x0d, 0xdb, 0xfc, 0xff, 0x02, 0xda, 0xfe, 0xff, 0x01, 0xd8, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x00, 0xec, 0xfe, 0x3b, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd5, 0xd5, 
+  0xd5, 0x0b, 0xd3, 0xd3, 0xd3, 0x18, 0xcb, 0xd3, 0xd3, 0x20, 0x8b, 0xdc, 0xea, 0x3b, 0x68, 0xd8, 0xed, 0x8b, 0x4b, 0xda, 0xf2, 0xeb, 0x41, 0xd9, 0xf4, 0xff, 0x39, 0xda, 0xf4, 0xff, 0x57, 0xdc, 
+  0xf1, 0xff, 0x80, 0xdf, 0xee, 0xff, 0x86, 0xe1, 0xee, 0xff, 0x8d, 0xe2, 0xee, 0xff, 0xa1, 0xe5, 0xee, 0xff, 0xb5, 0xe8, 0xef, 0xff, 0xbf, 0xea, 0xef, 0xff, 0xc9, 0xec, 0xf0, 0xff, 0xca, 0xec, 
+  0xf0, 0xff, 0xc9, 0xec, 0xef, 0xff, 0xc2, 0xeb, 0xef, 0xff, 0xbf, 0xeb, 0xef, 0xff, 0xc5, 0xeb, 0xef, 0xff, 0xcd, 0xed, 0xf0, 0xff, 0xd1, 0xee, 0xf0, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xd4, 0xee, 
+  0xf0, 0xff, 0xd3, 0xee, 0xf0, 0xff, 0xcb, 0xed, 0xf0, 0xff, 0xc0, 0xeb, 0xef, 0xff, 0xb3, 0xea, 0xee, 0xff, 0xb2, 0xe9, 0xee, 0xff, 0xb4, 0xe9, 0xee, 0xff, 0xb5, 0xea, 0xee, 0xff, 0xb8, 0xe9, 
+  0xee, 0xff, 0xb1, 0xe8, 0xee, 0xff, 0x9a, 0xe6, 0xee, 0xff, 0x76, 0xe2, 0xee, 0xff, 0x64, 0xe1, 0xf0, 0xff, 0x66, 0xe0, 0xf0, 0xff, 0x73, 0xe1, 0xef, 0xff, 0x84, 0xe1, 0xee, 0xff, 0x8e, 0xe1, 
+  0xee, 0xff, 0x86, 0xe0, 0xee, 0xff, 0x54, 0xdc, 0xf1, 0xff, 0x22, 0xd9, 0xf7, 0xff, 0x03, 0xd9, 0xfd, 0xff, 0x00, 0xd9, 0xfd, 0xc4, 0x00, 0xd8, 0xff, 0x58, 0x00, 0xe6, 0xff, 0x18, 0x90, 0x00, 
+  0x00, 0x00, 0x00, 0x2b, 0xe1, 0xe1, 0xe1, 0x04, 0xd4, 0xd4, 0xd4, 0x0b, 0xcb, 0xcc, 0xcc, 0x10, 0xe9, 0xd8, 0xd3, 0x1b, 0xff, 0xcf, 0xb6, 0x1c, 0x48, 0xdb, 0xf2, 0xaf, 0x2b, 0xd9, 0xf6, 0xff, 
+  0x2b, 0xda, 0xf6, 0xff, 0x4f, 0xdc, 0xf2, 0xff, 0x59, 0xdd, 0xf1, 0xff, 0x66, 0xde, 0xf0, 0xff, 0x92, 0xe3, 0xee, 0xff, 0xa4, 0xe5, 0xee, 0xff, 0xb6, 0xe8, 0xee, 0xff, 0xc4, 0xeb, 0xef, 0xff, 
+  0xc8, 0xec, 0xef, 0xff, 0xcb, 0xec, 0xf0, 0xff, 0xc8, 0xec, 0xef, 0xff, 0xc5, 0xeb, 0xef, 0xff, 0xc3, 0xeb, 0xef, 0xff, 0xc4, 0xec, 0xef, 0xff, 0xc8, 0xec, 0xef, 0xff, 0xcb, 0xed, 0xf0, 0xff, 
+  0xcf, 0xed, 0xf0, 0xff, 0xd0, 0xee, 0xf0, 0xff, 0xcc, 0xed, 0xf0, 0xff, 0xc3, 0xec, 0xef, 0xff, 0xb3, 0xea, 0xee, 0xff, 0xa7, 0xe8, 0xee, 0xff, 0xa3, 0xe8, 0xee, 0xff, 0xa4, 0xe7, 0xee, 0xff, 
+  0xac, 0xe8, 0xee, 0xff, 0xb2, 0xe9, 0xee, 0xff, 0xab, 0xe7, 0xee, 0xff, 0x92, 0xe4, 0xee, 0xff, 0x70, 0xe1, 0xef, 0xff, 0x53, 0xdf, 0xf1, 0xff, 0x4f, 0xde, 0xf2, 0xff, 0x5b, 0xde, 0xf1, 0xff, 
+  0x6f, 0xdf, 0xef, 0xff, 0x7f, 0xe0, 0xee, 0xff, 0x68, 0xdc, 0xef, 0xff, 0x42, 0xda, 0xf3, 0xff, 0x40, 0xda, 0xf2, 0x8c, 0x93, 0x00, 0x00, 0x00, 0x00, 0x12, 0xcb, 0xcb, 0xcb, 0x03, 0xd7, 0xd7, 
+  0xd7, 0x07, 0xd5, 0xd5, 0xd5, 0x0b, 0xfa, 0xcf, 0xc5, 0x0b, 0x37, 0xe7, 0xf5, 0x7b, 0x17, 0xdb, 0xf9, 0xff, 0x1b, 0xda, 0xf9, 0xff, 0x1d, 0xd9, 0xf8, 0xff, 0x2c, 0xdb, 0xf6, 0xff, 0x32, 0xdb, 
+  0xf5, 0xff, 0x39, 0xdd, 0xf4, 0xff, 0x80, 0xe0, 0xee, 0xff, 0x9e, 0xe4, 0xee, 0xff, 0xa9, 0xe7, 0xee, 0xff, 0xb7, 0xe8, 0xee, 0xff, 0xbb, 0xe9, 0xef, 0xff, 0xbf, 0xea, 0xee, 0xff, 0xc1, 0xeb, 
+  0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0x81, 0xc1, 0xeb, 0xef, 0xff, 0x01, 0xc2, 0xeb, 0xef, 0xff, 0xc4, 0xeb, 0xef, 0xff, 0x81, 0xc7, 0xec, 0xef, 0xff, 0x0e, 0xc6, 0xeb, 0xef, 0xff, 0xc1, 0xeb, 
+  0xef, 0xff, 0xb5, 0xea, 0xee, 0xff, 0xa4, 0xe8, 0xee, 0xff, 0x92, 0xe6, 0xed, 0xff, 0x8c, 0xe5, 0xee, 0xff, 0x90, 0xe5, 0xed, 0xff, 0x9b, 0xe6, 0xed, 0xff, 0x9d, 0xe6, 0xed, 0xff, 0x97, 0xe5, 
+  0xee, 0xff, 0x84, 0xe3, 0xee, 0xff, 0x64, 0xdf, 0xf0, 0xff, 0x41, 0xde, 0xf3, 0xff, 0x3e, 0xdd, 0xf4, 0xff, 0x4d, 0xdc, 0xf2, 0xff, 0x81, 0x59, 0xdc, 0xf1, 0xff, 0x02, 0x51, 0xdb, 0xf2, 0xff, 
+  0x46, 0xdc, 0xf3, 0xf8, 0x77, 0xdf, 0xe8, 0x40, 0x91, 0x00, 0x00, 0x00, 0x00, 0x17, 0xce, 0xce, 0xce, 0x07, 0xdc, 0xdc, 0xdc, 0x08, 0xd9, 0xd9, 0xd9, 0x0b, 0xe0, 0xd5, 0xd3, 0x0c, 0x64, 0xe4, 
+  0xf1, 0x3f, 0x0e, 0xdd, 0xfa, 0xfb, 0x16, 0xd8, 0xf9, 0xff, 0x1b, 0xd8, 0xf8, 0xff, 0x20, 0xda, 0xf8, 0xff, 0x2a, 0xda, 0xf6, 0xff, 0x2d, 0xdb, 0xf6, 0xff, 0x30, 0xdc, 0xf5, 0xff, 0x71, 0xe0, 
+  0xee, 0xff, 0x92, 0xe3, 0xee, 0xff, 0xa4, 0xe5, 0xee, 0xff, 0xaf, 0xe7, 0xee, 0xff, 0xb4, 0xe8, 0xef, 0xff, 0xb3, 0xe8, 0xee, 0xff, 0xb4, 0xe9, 0xee, 0xff, 0xb7, 0xe9, 0xee, 0xff, 0xb5, 0xe9, 
+  0xee, 0xff, 0xb9, 0xea, 0xee, 0xff, 0xbc, 0xea, 0xee, 0xff, 0xbb, 0xea, 0xee, 0xff, 0x81, 0xb7, 0xea, 0xee, 0xff, 0x14, 0xb6, 0xe9, 0xee, 0xff, 0xb0, 0xe9, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 
+  0x9c, 0xe6, 0xed, 0xff, 0x86, 0xe5, 0xed, 0xff, 0x73, 0xe3, 0xee, 0xff, 0x75, 0xe3, 0xee, 0xff, 0x78, 0xe3, 0xee, 0xff, 0x77, 0xe2, 0xee, 0xff, 0x6f, 0xe1, 0xef, 0xff, 0x65, 0xdf, 0xf0, 0xff, 
+  0x5d, 0xdf, 0xf0, 0xff, 0x30, 0xdd, 0xf5, 0xff, 0x26, 0xdc, 0xf7, 0xff, 0x2a, 0xdb, 0xf6, 0xff, 0x2f, 0xdb, 0xf5, 0xff, 0x31, 0xda, 0xf6, 0xff, 0x2f, 0xd9, 0xf6, 0xff, 0x31, 0xd9, 0xf5, 0xff, 
+  0x24, 0xe2, 0xf7, 0xf0, 0x00, 0xf9, 0xff, 0x08, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0xcf, 0xcf, 0xcf, 0x07, 0xcd, 0xcd, 0xcd, 0x10, 0xce, 0xce, 0xce, 0x18, 0xd1, 0xcb, 0xca, 0x17, 0x93, 0xdc, 
+  0xe6, 0x2f, 0x4a, 0xd8, 0xf1, 0x6c, 0x2d, 0xd8, 0xf5, 0x8c, 0x27, 0xd9, 0xf7, 0xb3, 0x25, 0xd9, 0xf7, 0xff, 0x33, 0xda, 0xf5, 0xff, 0x3c, 0xda, 0xf3, 0xff, 0x4d, 0xdb, 0xf1, 0xff, 0x7b, 0xe0, 
+  0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0xa7, 0xe5, 0xee, 0xff, 0xb7, 0xe8, 0xef, 0xff, 0xbd, 0xe9, 0xef, 0xff, 0xbe, 0xea, 0xef, 0xff, 0xba, 0xe9, 0xef, 0xff, 0xb5, 0xe9, 0xee, 0xff, 0xb2, 0xe8, 
+  0xee, 0xff, 0xb5, 0xe9, 0xee, 0xff, 0x81, 0xb8, 0xe9, 0xee, 0xff, 0x16, 0xb4, 0xe9, 0xee, 0xff, 0xad, 0xe8, 0xee, 0xff, 0xa8, 0xe8, 0xee, 0xff, 0xa3, 0xe7, 0xee, 0xff, 0xa2, 0xe7, 0xee, 0xff, 
+  0x9c, 0xe6, 0xed, 0xff, 0x89, 0xe4, 0xed, 0xff, 0x74, 0xe2, 0xee, 0xff, 0x6d, 0xe2, 0xef, 0xff, 0x6c, 0xe1, 0xef, 0xff, 0x67, 0xe1, 0xef, 0xff, 0x58, 0xdf, 0xf1, 0xff, 0x4d, 0xde, 0xf2, 0xff, 
+  0x40, 0xdd, 0xf3, 0xff, 0x26, 0xdd, 0xf7, 0xff, 0x17, 0xdc, 0xf9, 0xff, 0x11, 0xdb, 0xfb, 0xff, 0x13, 0xdb, 0xfa, 0xff, 0x16, 0xd9, 0xfa, 0xf3, 0x1a, 0xd8, 0xf8, 0xa7, 0x1b, 0xd8, 0xf7, 0x83, 
+  0x2a, 0xd9, 0xf7, 0x53, 0x00, 0xf1, 0xff, 0x13, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0xd3, 0xd3, 0xd3, 0x07, 0xce, 0xce, 0xce, 0x13, 0xd9, 0xd9, 0xd9, 0x24, 0xd8, 0xd8, 0xd8, 0x2c, 0xd9, 0xd9, 
+  0xd9, 0x2c, 0xe5, 0xdd, 0xdb, 0x24, 0xf1, 0xd7, 0xd0, 0x24, 0x73, 0xde, 0xea, 0x60, 0x34, 0xd8, 0xf5, 0xff, 0x48, 0xda, 0xf3, 0xff, 0x53, 0xdb, 0xf2, 0xff, 0x73, 0xde, 0xef, 0xff, 0x99, 0xe3, 
+  0xee, 0xff, 0xa1, 0xe4, 0xee, 0xff, 0xab, 0xe6, 0xee, 0xff, 0xba, 0xe9, 0xef, 0xff, 0xc3, 0xea, 0xef, 0xff, 0xc5, 0xea, 0xef, 0xff, 0xc7, 0xeb, 0xef, 0xff, 0xc1, 0xea, 0xef, 0xff, 0xbb, 0xe9, 
+  0xee, 0xff, 0xbd, 0xea, 0xef, 0xff, 0x81, 0xbc, 0xea, 0xee, 0xff, 0x03, 0xba, 0xea, 0xef, 0xff, 0xb0, 0xe8, 0xee, 0xff, 0xa7, 0xe7, 0xee, 0xff, 0x9e, 0xe6, 0xed, 0xff, 0x81, 0x98, 0xe6, 0xed, 
+  0xff, 0x0e, 0x95, 0xe5, 0xed, 0xff, 0x8b, 0xe3, 0xee, 0xff, 0x7e, 0xe2, 0xee, 0xff, 0x76, 0xe1, 0xef, 0xff, 0x74, 0xe0, 0xef, 0xff, 0x6b, 0xdf, 0xf0, 0xff, 0x5c, 0xde, 0xf0, 0xff, 0x46, 0xdd, 
+  0xf3, 0xff, 0x2a, 0xdc, 0xf6, 0xff, 0x19, 0xdc, 0xf9, 0xff, 0x0b, 0xda, 0xfc, 0xff, 0x08, 0xda, 0xfd, 0xff, 0x06, 0xda, 0xfd, 0xec, 0x76, 0xe4, 0xf8, 0x1b, 0xff, 0xcb, 0x8c, 0x04, 0x91, 0x00, 
+  0x00, 0x00, 0x00, 0x2e, 0xce, 0xce, 0xce, 0x04, 0xd3, 0xd3, 0xd3, 0x13, 0xd6, 0xd6, 0xd6, 0x1c, 0xdb, 0xdb, 0xdb, 0x34, 0xdd, 0xdd, 0xdd, 0x58, 0xdc, 0xdc, 0xdc, 0x5f, 0xdb, 0xdb, 0xdb, 0x4f, 
+  0xcf, 0xdb, 0xda, 0x4f, 0x60, 0xde, 0xf0, 0xdf, 0x66, 0xdb, 0xf0, 0xff, 0x7d, 0xde, 0xef, 0xff, 0x91, 0xe1, 0xee, 0xff, 0xa6, 0xe4, 0xee, 0xff, 0xb5, 0xe7, 0xef, 0xff, 0xb4, 0xe7, 0xee, 0xff, 
+  0xaf, 0xe6, 0xee, 0xff, 0xbd, 0xe9, 0xef, 0xff, 0xc9, 0xeb, 0xef, 0xff, 0xd2, 0xed, 0xf1, 0xff, 0xd9, 0xee, 0xf1, 0xff, 0xd1, 0xec, 0xf0, 0xff, 0x9a, 0xe5, 0xee, 0xff, 0x97, 0xe5, 0xee, 0xff, 
+  0xb8, 0xe9, 0xee, 0xff, 0xbd, 0xe9, 0xef, 0xff, 0xbc, 0xe9, 0xef, 0xff, 0xbc, 0xea, 0xef, 0xff, 0xbb, 0xe9, 0xef, 0xff, 0xaf, 0xe8, 0xee, 0xff, 0xa0, 0xe5, 0xee, 0xff, 0x93, 0xe4, 0xee, 0xff, 
+  0x8e, 0xe4, 0xee, 0xff, 0x8f, 0xe4, 0xee, 0xff, 0x90, 0xe4, 0xee, 0xff, 0x8b, 0xe2, 0xee, 0xff, 0x8d, 0xe3, 0xee, 0xff, 0x89, 0xe2, 0xee, 0xff, 0x7b, 0xe0, 0xee, 0xff, 0x5a, 0xdd, 0xf1, 0xff, 
+  0x34, 0xdc, 0xf5, 0xff, 0x19, 0xdb, 0xf9, 0xff, 0x08, 0xdb, 0xfd, 0xff, 0x07, 0xd9, 0xfd, 0xff, 0x02, 0xd9, 0xfe, 0xff, 0x00, 0xe6, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfb, 0xfb, 0x03, 
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xe0, 0xe0, 0xe0, 0x07, 0xce, 0xce, 0xce, 0x18, 0xd4, 0xd4, 0xd4, 0x1c, 0xd7, 0xd7, 0xd7, 0x28, 0xdb, 0xdb, 0xdb, 0x54, 0xdd, 0xdd, 0xdd, 0x67, 0xdf, 0xde, 
+  0xde, 0x64, 0xb3, 0xdf, 0xe5, 0x80, 0x72, 0xde, 0xef, 0xf8, 0x93, 0xe0, 0xee, 0xf8, 0xad, 0xe5, 0xee, 0xfb, 0xb3, 0xe6, 0xee, 0xfc, 0xbf, 0xe9, 0xef, 0xff, 0xc9, 0xea, 0xef, 0xff, 0xc6, 0xea, 
+  0xef, 0xff, 0xb7, 0xe7, 0xee, 0xff, 0xbb, 0xe8, 0xef, 0xff, 0xc3, 0xea, 0xef, 0xff, 0xc6, 0xea, 0xf0, 0xff, 0xce, 0xec, 0xf0, 0xff, 0xdf, 0xef, 0xf1, 0xff, 0x9d, 0xe5, 0xee, 0xff, 0x5b, 0xdf, 
+  0xf0, 0xff, 0x8d, 0xe3, 0xee, 0xff, 0xb6, 0xe8, 0xef, 0xff, 0xbe, 0xea, 0xef, 0xff, 0xc1, 0xea, 0xef, 0xff, 0xc3, 0xea, 0xef, 0xff, 0xc2, 0xea, 0xef, 0xff, 0xb7, 0xe8, 0xef, 0xff, 0x8e, 0xe3, 
+  0xee, 0xff, 0x86, 0xe3, 0xee, 0xff, 0x91, 0xe3, 0xee, 0xff, 0x92, 0xe3, 0xee, 0xff, 0x90, 0xe3, 0xee, 0xff, 0x89, 0xe2, 0xee, 0xff, 0x8c, 0xe2, 0xee, 0xff, 0x8b, 0xe1, 0xee, 0xff, 0x76, 0xdf, 
+  0xef, 0xff, 0x52, 0xdb, 0xf1, 0xff, 0x1f, 0xda, 0xf8, 0xff, 0x09, 0xd9, 0xfc, 0xf7, 0x04, 0xd8, 0xfd, 0xec, 0x02, 0xd9, 0xfe, 0xef, 0x00, 0xde, 0xfe, 0xff, 0x00, 0xfb, 0xff, 0x08, 0x91, 0x00, 
+  0x00, 0x00, 0x00, 0x0c, 0xcd, 0xcd, 0xcd, 0x0b, 0xd6, 0xd6, 0xd6, 0x20, 0xda, 0xda, 0xda, 0x24, 0xd4, 0xd4, 0xd4, 0x2f, 0xd9, 0xd9, 0xd9, 0x3f, 0xdb, 0xdb, 0xdb, 0x43, 0xdc, 0xdb, 0xdb, 0x4b, 
+  0xc6, 0xdb, 0xdf, 0x5c, 0xc3, 0xdd, 0xe3, 0x7c, 0xd5, 0xe2, 0xe5, 0x9f, 0xe8, 0xea, 0xeb, 0xc7, 0xb9, 0xe8, 0xef, 0xff, 0xbe, 0xe8, 0xef, 0xff, 0x81, 0xc1, 0xe9, 0xef, 0xff, 0x1e, 0xc3, 0xea, 
+  0xef, 0xff, 0xaf, 0xe6, 0xee, 0xff, 0xab, 0xe6, 0xee, 0xff, 0xae, 0xe6, 0xee, 0xff, 0xb7, 0xe8, 0xee, 0xff, 0xbb, 0xe9, 0xef, 0xff, 0x86, 0xe2, 0xee, 0xff, 0x33, 0xde, 0xf5, 0xff, 0x3c, 0xde, 
+  0xf4, 0xff, 0x7e, 0xe1, 0xee, 0xff, 0xa3, 0xe5, 0xee, 0xff, 0x8a, 0xe3, 0xef, 0xff, 0x98, 0xe4, 0xee, 0xff, 0xa9, 0xe6, 0xee, 0xff, 0x9c, 0xe4, 0xee, 0xff, 0x79, 0xe1, 0xee, 0xff, 0x66, 0xe0, 
+  0xf0, 0xff, 0x90, 0xe3, 0xee, 0xff, 0x96, 0xe3, 0xee, 0xff, 0x8c, 0xe2, 0xee, 0xff, 0x82, 0xe1, 0xee, 0xff, 0x7c, 0xe0, 0xee, 0xff, 0x78, 0xde, 0xef, 0xff, 0x6d, 0xdd, 0xef, 0xff, 0x56, 0xdc, 
+  0xf2, 0xff, 0x1d, 0xd9, 0xf9, 0xff, 0x0b, 0xd9, 0xfc, 0xd3, 0x42, 0xdc, 0xfc, 0x1c, 0x00, 0xd8, 0xfd, 0x1c, 0x00, 0xd7, 0xfe, 0x28, 0x00, 0xee, 0xff, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x00, 0x2b, 
+  0xd5, 0xd5, 0xd5, 0x0c, 0xd9, 0xd9, 0xd9, 0x2b, 0xd5, 0xd5, 0xd5, 0x33, 0xdb, 0xdb, 0xdb, 0x3b, 0xda, 0xda, 0xda, 0x40, 0xd8, 0xd8, 0xd8, 0x3b, 0xd9, 0xd9, 0xd9, 0x34, 0xd9, 0xd9, 0xd9, 0x3f, 
+  0xda, 0xda, 0xda, 0x54, 0xe0, 0xdf, 0xdf, 0x74, 0xd4, 0xe6, 0xe8, 0xbb, 0xa1, 0xe3, 0xee, 0xff, 0xaa, 0xe4, 0xee, 0xff, 0xb3, 0xe6, 0xef, 0xff, 0xb1, 0xe6, 0xef, 0xff, 0xb3, 0xe7, 0xef, 0xff, 
+  0x9b, 0xe3, 0xee, 0xff, 0x89, 0xe0, 0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0x95, 0xe2, 0xee, 0xff, 0x90, 0xe2, 0xee, 0xff, 0x7c, 0xe0, 0xef, 0xff, 0x3a, 0xdd, 0xf4, 0xff, 0x1f, 0xdf, 0xf8, 0xff, 
+  0x3b, 0xde, 0xf4, 0xff, 0x78, 0xe1, 0xee, 0xff, 0x68, 0xdf, 0xf0, 0xff, 0x51, 0xde, 0xf1, 0xff, 0x78, 0xe1, 0xef, 0xff, 0x82, 0xe1, 0xee, 0xff, 0x69, 0xdf, 0xef, 0xff, 0x3d, 0xde, 0xf4, 0xff, 
+  0x5b, 0xde, 0xf1, 0xff, 0x98, 0xe3, 0xee, 0xff, 0x92, 0xe2, 0xee, 0xff, 0x6c, 0xde, 0xf0, 0xff, 0x61, 0xdd, 0xf0, 0xff, 0x54, 0xdc, 0xf1, 0xff, 0x48, 0xdb, 0xf3, 0xff, 0x3d, 0xd9, 0xf4, 0xff, 
+  0x17, 0xd9, 0xfa, 0xff, 0x07, 0xda, 0xfd, 0xe7, 0x4c, 0xe9, 0xfa, 0x18, 0xff, 0xff, 0xff, 0x03, 0x93, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe7, 0xe7, 0xe7, 0x07, 0xd3, 0xd3, 0xd3, 0x20, 0xd4, 0xd4, 
+  0xd4, 0x30, 0xda, 0xda, 0xda, 0x3c, 0x81, 0xdb, 0xdb, 0xdb, 0x50, 0x24, 0xd8, 0xd8, 0xd8, 0x40, 0xd6, 0xd6, 0xd6, 0x38, 0xda, 0xda, 0xda, 0x4b, 0xe3, 0xdf, 0xde, 0x63, 0x94, 0xe2, 0xeb, 0xc4, 
+  0x7d, 0xde, 0xef, 0xff, 0x8a, 0xe0, 0xee, 0xff, 0xa0, 0xe2, 0xed, 0xf3, 0x91, 0xe1, 0xee, 0xfc, 0x78, 0xde, 0xef, 0xff, 0x6c, 0xdd, 0xef, 0xff, 0x6a, 0xdd, 0xef, 0xff, 0x77, 0xdf, 0xee, 0xff, 
+  0x87, 0xe1, 0xee, 0xff, 0x8b, 0xe1, 0xee, 0xff, 0x6d, 0xde, 0xef, 0xff, 0x46, 0xdd, 0xf3, 0xff, 0x24, 0xdd, 0xf7, 0xff, 0x22, 0xdd, 0xf7, 0xff, 0x39, 0xdd, 0xf5, 0xff, 0x3b, 0xdd, 0xf4, 0xff, 
+  0x28, 0xdd, 0xf7, 0xff, 0x43, 0xdd, 0xf3, 0xff, 0x67, 0xdf, 0xef, 0xff, 0x64, 0xde, 0xef, 0xff, 0x3e, 0xdc, 0xf3, 0xff, 0x30, 0xdc, 0xf5, 0xff, 0x53, 0xdd, 0xf1, 0xff, 0x69, 0xdd, 0xef, 0xff, 
+  0x3a, 0xdb, 0xf4, 0xff, 0x2c, 0xda, 0xf6, 0xff, 0x32, 0xda, 0xf5, 0xff, 0x2a, 0xda, 0xf7, 0xf7, 0x27, 0xd8, 0xf6, 0xe3, 0x12, 0xd9, 0xfa, 0xff, 0x05, 0xda, 0xfd, 0xff, 0x1a, 0xe3, 0xfe, 0x2c, 
+  0x94, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xc5, 0xc5, 0xc5, 0x03, 0xd9, 0xd9, 0xd9, 0x0f, 0xcf, 0xcf, 0xcf, 0x18, 0xd8, 0xd8, 0xd8, 0x23, 0xda, 0xda, 0xda, 0x43, 0xda, 0xda, 0xda, 0x53, 0xda, 0xda, 
+  0xda, 0x4b, 0xda, 0xda, 0xda, 0x3c, 0xda, 0xda, 0xda, 0x37, 0xda, 0xd9, 0xd8, 0x40, 0x6d, 0xdc, 0xee, 0xa8, 0x93, 0xdb, 0xea, 0x9f, 0xd7, 0xe0, 0xe1, 0x83, 0xd8, 0xe2, 0xe4, 0xa0, 0x74, 0xdd, 
+  0xef, 0xf8, 0x44, 0xda, 0xf3, 0xff, 0x35, 0xda, 0xf5, 0xff, 0x41, 0xdb, 0xf4, 0xff, 0x59, 0xdb, 0xf1, 0xff, 0x74, 0xde, 0xef, 0xff, 0x78, 0xdf, 0xee, 0xff, 0x62, 0xdd, 0xf0, 0xff, 0x54, 0xdc, 
+  0xf1, 0xff, 0x3d, 0xdc, 0xf4, 0xff, 0x26, 0xdc, 0xf7, 0xff, 0x20, 0xdc, 0xf7, 0xff, 0x19, 0xdc, 0xf9, 0xff, 0x11, 0xdd, 0xfa, 0xff, 0x1e, 0xdc, 0xf8, 0xff, 0x3f, 0xdc, 0xf3, 0xff, 0x4f, 0xdd, 
+  0xf2, 0xff, 0x2b, 0xdc, 0xf6, 0xff, 0x1d, 0xdb, 0xf8, 0xff, 0x21, 0xdb, 0xf7, 0xff, 0x2f, 0xdb, 0xf5, 0xff, 0x19, 0xda, 0xf9, 0xff, 0x12, 0xd9, 0xfb, 0xff, 0x1b, 0xd9, 0xf8, 0xff, 0x16, 0xd9, 
+  0xf8, 0xf3, 0xff, 0xd9, 0x73, 0x0f, 0x7e, 0xd5, 0xe6, 0x37, 0x29, 0xd7, 0xfa, 0x7f, 0x16, 0xe2, 0xfe, 0x48, 0x95, 0x00, 0x00, 0x00, 0x00, 0x29, 0xde, 0xde, 0xde, 0x03, 0xd7, 0xd7, 0xd7, 0x08, 
+  0xdb, 0xdb, 0xdb, 0x0b, 0xdb, 0xdb, 0xdb, 0x0f, 0xd3, 0xd3, 0xd3, 0x28, 0xda, 0xda, 0xda, 0x38, 0xda, 0xda, 0xda, 0x3c, 0xda, 0xda, 0xda, 0x2c, 0xd5, 0xd5, 0xd5, 0x1f, 0xe0, 0xcb, 0xc6, 0x13, 
+  0xde, 0xd8, 0xd6, 0x28, 0xdb, 0xda, 0xda, 0x47, 0xc6, 0xdf, 0xe4, 0x88, 0x6c, 0xdc, 0xef, 0xfb, 0x40, 0xd9, 0xf4, 0xff, 0x20, 0xd9, 0xf8, 0xff, 0x25, 0xd9, 0xf7, 0xfb, 0x3a, 0xda, 0xf4, 0xff, 
+  0x50, 0xdb, 0xf2, 0xff, 0x54, 0xdb, 0xf2, 0xff, 0x48, 0xdb, 0xf2, 0xff, 0x4c, 0xdb, 0xf2, 0xff, 0x4b, 0xdb, 0xf2, 0xff, 0x38, 0xdc, 0xf4, 0xff, 0x22, 0xdb, 0xf7, 0xff, 0x11, 0xdb, 0xfa, 0xff, 
+  0x0a, 0xdc, 0xfc, 0xff, 0x0d, 0xdb, 0xfb, 0xff, 0x1d, 0xdc, 0xf9, 0xff, 0x37, 0xda, 0xf5, 0xff, 0x2a, 0xda, 0xf6, 0xff, 0x12, 0xdb, 0xfa, 0xff, 0x0d, 0xd9, 0xfc, 0xff, 0x0a, 0xda, 0xfc, 0xff, 
+  0x09, 0xda, 0xfd, 0xff, 0x06, 0xd9, 0xfd, 0xff, 0x0e, 0xd8, 0xfb, 0xff, 0x0f, 0xda, 0xf9, 0xff, 0xff, 0xb1, 0x00, 0x07, 0xdb, 0xd2, 0xcf, 0x0f, 0xf4, 0xd9, 0xcc, 0x0c, 0xfc, 0xd3, 0xc5, 0x04, 
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x28, 0xbe, 0xbe, 0xbe, 0x03, 0xc5, 0xc5, 0xc5, 0x03, 0xcc, 0xcc, 0xcc, 0x04, 0xc5, 0xc5, 0xc5, 0x0c, 0xd1, 0xd1, 0xd1, 0x17, 0xdc, 0xdc, 0xdc, 0x20, 0xd4, 0xd4, 
+  0xd4, 0x0c, 0xdd, 0xdd, 0xdd, 0x07, 0xd1, 0xd1, 0xd1, 0x0b, 0xdb, 0xdb, 0xdb, 0x1b, 0xa3, 0xda, 0xe7, 0x60, 0x3b, 0xd9, 0xf4, 0xf4, 0x50, 0xd9, 0xf2, 0xc7, 0x98, 0xd5, 0xe0, 0x2f, 0x10, 0xda, 
+  0xfa, 0xc4, 0x0d, 0xd8, 0xfb, 0xff, 0x09, 0xda, 0xfb, 0xff, 0x24, 0xd9, 0xf8, 0xff, 0x2c, 0xd9, 0xf6, 0xff, 0x32, 0xdb, 0xf5, 0xff, 0x41, 0xdb, 0xf4, 0xff, 0x49, 0xda, 0xf3, 0xff, 0x39, 0xdb, 
+  0xf5, 0xff, 0x15, 0xda, 0xfa, 0xff, 0x08, 0xdb, 0xfc, 0xff, 0x07, 0xda, 0xfd, 0xff, 0x0d, 0xda, 0xfc, 0xff, 0x14, 0xdb, 0xfa, 0xff, 0x10, 0xda, 0xfb, 0xff, 0x0a, 0xd9, 0xfc, 0xff, 0x08, 0xda, 
+  0xfd, 0xff, 0x04, 0xd8, 0xfd, 0xff, 0x04, 0xd9, 0xfd, 0xa4, 0x10, 0xdb, 0xff, 0x3b, 0x04, 0xd7, 0xfd, 0xcc, 0x08, 0xd8, 0xfd, 0xff, 0xe4, 0xfd, 0x96, 0x04, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 
+  0xc4, 0x03, 0xda, 0xda, 0xda, 0x07, 0xc8, 0xc8, 0xc8, 0x03, 0x97, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xf0, 0xf0, 0x03, 0xfb, 0xfb, 0xfb, 0x03, 0xca, 0xca, 0xca, 0x04, 
+  0xd6, 0xd6, 0xd6, 0x07, 0xd1, 0xd1, 0xd1, 0x04, 0xba, 0xba, 0xba, 0x04, 0xea, 0xea, 0xea, 0x03, 0xda, 0xda, 0xda, 0x08, 0xa2, 0xd9, 0xe6, 0x1f, 0x74, 0xd5, 0xea, 0x38, 0xda, 0xd6, 0xd4, 0x24, 
+  0xf6, 0xd7, 0xcd, 0x1f, 0x10, 0xdc, 0xf8, 0xa3, 0x08, 0xd8, 0xfd, 0xff, 0x04, 0xd8, 0xfd, 0xff, 0x08, 0xd8, 0xfb, 0x8b, 0x0c, 0xd9, 0xfc, 0xff, 0x12, 0xd9, 0xfb, 0xff, 0x1c, 0xd9, 0xf8, 0xff, 
+  0x20, 0xd9, 0xf8, 0xff, 0x25, 0xd9, 0xf7, 0xff, 0x1f, 0xd9, 0xf8, 0xff, 0x0b, 0xda, 0xfd, 0xff, 0x04, 0xd9, 0xfd, 0xff, 0x04, 0xda, 0xfe, 0xff, 0x07, 0xd9, 0xfd, 0xff, 0x08, 0xd9, 0xfd, 0xec, 
+  0x06, 0xd9, 0xfd, 0xac, 0x04, 0xd8, 0xfd, 0xff, 0x02, 0xd8, 0xfe, 0xff, 0x08, 0xde, 0xfd, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0xd8, 0xfd, 0x37, 0x4b, 0xea, 0xfb, 0x08, 0x9b, 0x00, 
+  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x03, 0xce, 0xce, 0xce, 0x03, 0xc9, 0xc9, 0xc9, 0x04, 0xe3, 0xe3, 0xe3, 0x03, 
+  0xf1, 0xf1, 0xf1, 0x03, 0xcd, 0xcd, 0xcd, 0x04, 0xdc, 0xd4, 0xd2, 0x04, 0xe6, 0xdf, 0xde, 0x07, 0xd3, 0xd3, 0xd3, 0x0c, 0xe8, 0xd4, 0xd0, 0x1c, 0x41, 0xdc, 0xf4, 0x83, 0x07, 0xd8, 0xfc, 0xf0, 
+  0x20, 0xd8, 0xfc, 0x43, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd9, 0xfe, 0xef, 0x06, 0xd8, 0xfd, 0xff, 0x0a, 0xd8, 0xfc, 0xeb, 0x17, 0xd8, 0xf8, 0x73, 0x07, 0xd8, 0xfd, 0xff, 0x0c, 0xd9, 0xfc, 0xff, 
+  0x0d, 0xd9, 0xfc, 0xec, 0x09, 0xd9, 0xfd, 0x78, 0x02, 0xd9, 0xfe, 0xff, 0x03, 0xd9, 0xfe, 0xff, 0x04, 0xd9, 0xfe, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd8, 0xff, 0x5f, 0x01, 0xd8, 0xfe, 0xff, 
+  0x0a, 0xe1, 0xff, 0x50, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0x03, 0x09, 0xee, 0xee, 0xee, 0x03, 0xc0, 0xc0, 0xc0, 0x04, 0xff, 0xff, 0xff, 0x03, 0xf5, 0xf5, 0xf5, 0x03, 0xc6, 
+  0xc6, 0xc6, 0x04, 0xde, 0xde, 0xde, 0x03, 0xe5, 0xe5, 0xe5, 0x03, 0xe2, 0xc8, 0xc1, 0x04, 0x60, 0xd8, 0xee, 0x2b, 0x79, 0xd8, 0xee, 0x28, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xdc, 0xfe, 
+  0x7b, 0x02, 0xd8, 0xfe, 0xff, 0x15, 0xd9, 0xfa, 0x33, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd8, 0xfe, 0xa7, 0x02, 0xd8, 0xfe, 0xff, 0x0e, 0xd8, 0xfd, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xfe, 
+  0x5b, 0x00, 0xd8, 0xfe, 0xff, 0x01, 0xdc, 0xff, 0x60, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd7, 0xfe, 0x2c, 0x01, 0xe7, 0xff, 0x1b, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0x03, 0x81, 0xfe, 0xfe, 0xfe, 0x03, 0x09, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe4, 0xe4, 0x03, 0xf7, 0xf9, 0xfa, 0x03, 0xe4, 0xc2, 0xb6, 0x04, 0xea, 0xe3, 0xe1, 0x08, 0xc1, 
+  0xc1, 0xc1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x15, 0xdb, 0xfe, 0x27, 0x0b, 0xda, 0xff, 0x44, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xdb, 0xfe, 0x1f, 0x01, 0xd8, 0xfe, 0xdf, 0x82, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xd8, 0xfe, 0x9f, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xea, 0xea, 0xea, 0x03, 0xeb, 0xeb, 0xeb, 0x03, 0xee, 0xee, 0xee, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xd9, 0xff, 0x13, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +588,7 @@ const lv_img_dsc_t owm_50d_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_50d_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_50d_64px_map,
 };
-
@@ -10,271 +10,511 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OWM_50N_64PX uint8_t owm_50n_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0f, 0xdb, 0x4c, 0xdb, 0x7f, 0xdb, 0xa7, 0xdb, 0xc0, 0xdb, 0xcb, 0xdb, 0xb8, 0xdb, 0x9b, 0xdb, 0x6f, 0xdb, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x14, 0xdb, 0x5c, 0xdb, 0xb7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xeb, 0xdb, 0x9b, 0xdb, 0x33, 0xdb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x07, 0xdb, 0x80, 0xdb, 0xeb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0xd3, 0xdb, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x4c, 0xdb, 0xd7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xab, 0xdb, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdb, 0x87, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf0, 0xdb, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0f, 0xdb, 0x9f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xfb, 0xdb, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xdb, 0x9f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xfb, 0xdb, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x87, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf7, 0xdb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x4c, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd8, 0xdb, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x07, 0xdb, 0xd7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x80, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf3, 0xb7, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x14, 0xdb, 0xeb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x5c, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xb7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xcb, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x4c, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe4, 0xb7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x7f, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf0, 0xb7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xdb, 0x04, 0x00, 0x00, 0xdb, 0xa7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xfb, 0xdb, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0xff, 0x37, 0xff, 0x2c, 0xdb, 0xcb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x07, 0xdb, 0x04, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x53, 0xff, 0x68, 0xdb, 0xe0, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0xdb, 0x13, 0xdb, 0x13, 0xdb, 0x0f, 0xff, 0x24, 0xff, 0x53, 0xff, 0x84, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x34, 0xdb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1b, 0xff, 0x20, 0xdb, 0x1b, 0xff, 0x20, 0xff, 0x37, 0xff, 0x5f, 0xff, 0x83, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0x2b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x27, 0xff, 0x3c, 0xff, 0x20, 0xff, 0x20, 0xff, 0x38, 0xff, 0x57, 0xff, 0x5c, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xec, 0xb7, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x14, 0xff, 0x37, 0xff, 0x2c, 0xff, 0x23, 0xff, 0x2c, 0xff, 0x44, 0xff, 0x4c, 0xdb, 0x73, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe0, 0xb7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x10, 0xff, 0x1b, 0xff, 0x1f, 0xff, 0x23, 0xff, 0x44, 0xff, 0x57, 0xff, 0x3f, 0xdb, 0xf0, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xb0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x03, 0xff, 0x07, 0xff, 0x0c, 0xdb, 0x14, 0xff, 0x23, 0xff, 0x30, 0xff, 0x2f, 0xdb, 0xaf, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x7f, 0xff, 0x1b, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x04, 0xff, 0x07, 0xff, 0x0c, 0xff, 0x13, 0xff, 0x18, 0xff, 0x1c, 0xdb, 0x4b, 0xdb, 0xf8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xec, 0xff, 0x58, 0xff, 0x3f, 0xdb, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x07, 0xff, 0x08, 0xff, 0x0b, 0xff, 0x10, 0xff, 0x13, 0xdb, 0x18, 0xff, 0x1c, 0xff, 0x2c, 0xdb, 0xd8, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x93, 0xff, 0x33, 0xff, 0x3b, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x08, 0xdb, 0x14, 0xdb, 0x17, 0xdb, 0x18, 0xff, 0x1b, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x23, 0xdb, 0x77, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xef, 0xdb, 0x2c, 0xff, 0x14, 0xff, 0x14, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x08, 0xdb, 0x18, 0xff, 0x28, 0xff, 0x2c, 0xff, 0x2b, 0xff, 0x28, 0xff, 0x2b, 0xff, 0x34, 0xff, 0x3c, 0xdb, 0xc8, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0x6b, 0xff, 0x04, 0xff, 0x08, 0xff, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0xff, 0x14, 0xff, 0x24, 0xff, 0x3b, 0xff, 0x63, 0xff, 0x5b, 0xff, 0x4c, 0xff, 0x4c, 0xff, 0x67, 0xff, 0x7b, 0xff, 0xa3, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xaf, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0xdb, 0x1b, 0xff, 0x20, 0xff, 0x2f, 0xff, 0x60, 0xff, 0x68, 0xff, 0x63, 0xff, 0x64, 0xff, 0x8c, 0xff, 0xaf, 0xff, 0xbb, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xd8, 0xdb, 0x13, 0xdb, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0xff, 0x20, 0xff, 0x28, 0xff, 0x33, 0xff, 0x40, 0xff, 0x47, 0xff, 0x4c, 0xff, 0x57, 0xff, 0x74, 0xff, 0xb4, 0xff, 0xc7, 0xff, 0xc8, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe3, 0xdb, 0x3b, 0xff, 0x07, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x17, 0xff, 0x2f, 0xff, 0x34, 0xff, 0x3f, 0xff, 0x40, 0xff, 0x37, 0xff, 0x37, 0xff, 0x44, 0xff, 0x5b, 0xff, 0x9b, 0xff, 0xac, 0xff, 0xb8, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe0, 0xdb, 0x54, 0xff, 0x0c, 0xdb, 0x04, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xff, 0x27, 0xff, 0x34, 0xff, 0x47, 0xff, 0x54, 0xff, 0x4b, 0xff, 0x3c, 0xff, 0x38, 0xff, 0x54, 0xff, 0x73, 0xff, 0x83, 0xff, 0x98, 0xff, 0xa4, 0xff, 0xab, 0xff, 0xab, 0xdb, 0xef, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xbc, 0xff, 0x38, 0xff, 0x27, 0xff, 0x13, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xdb, 0x14, 0xff, 0x1b, 0xff, 0x2f, 0xff, 0x48, 0xff, 0x53, 0xff, 0x47, 0xff, 0x37, 0xff, 0x38, 0xff, 0x44, 0xff, 0x54, 0xff, 0x70, 0xff, 0x88, 0xff, 0x94, 0xff, 0x70, 0xff, 0x57, 0xdb, 0xb0, 0xdb, 0xf7, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xec, 0xdb, 0x73, 0xff, 0x20, 0xff, 0x24, 0xff, 0x27, 0xff, 0x1b, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x14, 0xff, 0x34, 0xff, 0x38, 0xff, 0x38, 0xff, 0x27, 0xff, 0x18, 0xdb, 0x1b, 0xff, 0x33, 0xff, 0x57, 0xff, 0x77, 0xff, 0x73, 0xff, 0x3b, 0xff, 0x27, 0xdb, 0x50, 0xdb, 0xbb, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe0, 0xdb, 0x7b, 0xdb, 0x1c, 0xff, 0x04, 0xdb, 0x14, 0xff, 0x1c, 0xff, 0x10, 0xff, 0x10, 0xff, 0x0f, 0xff, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xdb, 0x04, 0xdb, 0x03, 0xff, 0x04, 0xdb, 0x10, 0xff, 0x1b, 0xff, 0x1c, 0xff, 0x0b, 0xff, 0x07, 0xff, 0x0f, 0xff, 0x24, 0xff, 0x3f, 0xff, 0x48, 0xff, 0x3b, 0xff, 0x1b, 0xdb, 0x14, 0xff, 0x08, 0xdb, 0x34, 0xdb, 0x88, 0xdb, 0xd3, 0xdb, 0xe8, 0xdb, 0xf4, 0xdb, 0xfc, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xf8, 0xdb, 0xef, 0xdb, 0xe3, 0xdb, 0xac, 0xdb, 0x5b, 0xff, 0x03, 0x00, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x07, 0xff, 0x0f, 0xff, 0x07, 0xff, 0x00, 0xff, 0x04, 0xff, 0x07, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x07, 0xff, 0x07, 0xdb, 0x04, 0xdb, 0x04, 0xff, 0x04, 0xff, 0x0b, 0xff, 0x18, 0xff, 0x1c, 0xff, 0x2b, 0xff, 0x23, 0xff, 0x10, 0xff, 0x07, 0xff, 0x03, 0xff, 0x07, 0xff, 0x13, 0xdb, 0x28, 0xdb, 0x3f, 0xdb, 0x48, 0xdb, 0x50, 0xdb, 0x4b, 0xdb, 0x34, 0xdb, 0x2b, 0xdb, 0x20, 0xdb, 0x14, 0xff, 0x04, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xdb, 0x04, 0xff, 0x03, 0xdb, 0x03, 0xdb, 0x07, 0xff, 0x07, 0xff, 0x07, 0xdb, 0x13, 0xff, 0x24, 0xff, 0x1c, 0xff, 0x07, 0xff, 0x03, 0xff, 0x00, 0xdb, 0x03, 0xff, 0x07, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x0f, 0xff, 0x08, 0xdb, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xdb, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x03, 0xdb, 0x04, 0xdb, 0x08, 0xff, 0x14, 0xff, 0x0c, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x04, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xdb, 0x03, 0xff, 0x03, 0xff, 0x07, 0xff, 0x07, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xda, 0x00, 0x00, 0x09, 0xdb, 0x0f, 0xdb, 0x4c, 0xdb, 0x7f, 
+  0xdb, 0xa7, 0xdb, 0xc0, 0xdb, 0xcb, 0xdb, 0xb8, 0xdb, 0x9b, 0xdb, 0x6f, 0xdb, 0x38, 0xb2, 0x00, 0x00, 0x02, 0xdb, 0x14, 0xdb, 0x5c, 0xdb, 0xb7, 0x89, 0xdb, 0xff, 0x03, 0xdb, 0xeb, 0xdb, 0x9b, 
+  0xdb, 0x33, 0xdb, 0x0c, 0xac, 0x00, 0x00, 0x02, 0xb7, 0x07, 0xdb, 0x80, 0xdb, 0xeb, 0x8d, 0xdb, 0xff, 0x02, 0xdb, 0xf8, 0xdb, 0xd3, 0xdb, 0x57, 0xaa, 0x00, 0x00, 0x01, 0xdb, 0x4c, 0xdb, 0xd7, 
+  0x92, 0xdb, 0xff, 0x01, 0xdb, 0xab, 0xdb, 0x23, 0xa7, 0x00, 0x00, 0x01, 0xdb, 0x87, 0xdb, 0xf8, 0x94, 0xdb, 0xff, 0x01, 0xdb, 0xf0, 0xdb, 0x4c, 0xa4, 0x00, 0x00, 0x01, 0xdb, 0x0f, 0xdb, 0x9f, 
+  0x97, 0xdb, 0xff, 0x01, 0xdb, 0xfb, 0xdb, 0x5b, 0xa3, 0x00, 0x00, 0x00, 0xdb, 0x9f, 0x99, 0xdb, 0xff, 0x01, 0xdb, 0xfb, 0xdb, 0x60, 0xa1, 0x00, 0x00, 0x00, 0xdb, 0x87, 0x9b, 0xdb, 0xff, 0x01, 
+  0xdb, 0xf7, 0xdb, 0x33, 0x9f, 0x00, 0x00, 0x01, 0xdb, 0x4c, 0xdb, 0xf8, 0x9c, 0xdb, 0xff, 0x01, 0xdb, 0xd8, 0xdb, 0x18, 0x9d, 0x00, 0x00, 0x01, 0xdb, 0x07, 0xdb, 0xd7, 0x8a, 0xdb, 0xff, 0x83, 
+  0xff, 0xff, 0x8f, 0xdb, 0xff, 0x00, 0xdb, 0x97, 0x9d, 0x00, 0x00, 0x00, 0xdb, 0x80, 0x8c, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x8d, 0xdb, 0xff, 0x01, 0xdb, 0xf3, 0xb7, 0x28, 0x9b, 0x00, 0x00, 0x01, 
+  0xdb, 0x14, 0xdb, 0xeb, 0x8c, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x8d, 0xdb, 0xff, 0x00, 0xdb, 0x9c, 0x9b, 0x00, 0x00, 0x00, 0xdb, 0x5c, 0x85, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x86, 0xdb, 0xff, 0x87, 
+  0xff, 0xff, 0x8c, 0xdb, 0xff, 0x00, 0xb7, 0x1b, 0x9a, 0x00, 0x00, 0x00, 0xdb, 0xb7, 0x85, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x87, 0xff, 0xff, 
+  0x01, 0xdb, 0xff, 0xff, 0xff, 0x8a, 0xdb, 0xff, 0x00, 0xdb, 0x70, 0x99, 0x00, 0x00, 0x00, 0xdb, 0x0f, 0x86, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xdb, 0xff, 
+  0x81, 0xff, 0xff, 0x88, 0xdb, 0xff, 0x01, 0xdb, 0xcb, 0xb7, 0x03, 0x98, 0x00, 0x00, 0x00, 0xdb, 0x4c, 0x85, 0xdb, 0xff, 0x97, 0xff, 0xff, 0x85, 0xdb, 0xff, 0x01, 0xdb, 0xe4, 0xb7, 0x13, 0x98, 
+  0x00, 0x00, 0x00, 0xdb, 0x7f, 0x84, 0xdb, 0xff, 0x99, 0xff, 0xff, 0x84, 0xdb, 0xff, 0x01, 0xdb, 0xf0, 0xb7, 0x20, 0x95, 0x00, 0x00, 0x03, 0xff, 0x03, 0xdb, 0x04, 0x00, 0x00, 0xdb, 0xa7, 0x84, 
+  0xdb, 0xff, 0x99, 0xff, 0xff, 0x84, 0xdb, 0xff, 0x01, 0xdb, 0xfb, 0xdb, 0x2b, 0x95, 0x00, 0x00, 0x03, 0xff, 0x18, 0xff, 0x37, 0xff, 0x2c, 0xdb, 0xcb, 0x84, 0xdb, 0xff, 0x99, 0xff, 0xff, 0x85, 
+  0xdb, 0xff, 0x00, 0xdb, 0x30, 0x91, 0x00, 0x00, 0x07, 0xff, 0x03, 0xff, 0x07, 0xdb, 0x04, 0x00, 0x00, 0xff, 0x1f, 0xff, 0x53, 0xff, 0x68, 0xdb, 0xe0, 0x83, 0xdb, 0xff, 0x9b, 0xff, 0xff, 0x84, 
+  0xdb, 0xff, 0x00, 0xdb, 0x33, 0x91, 0x00, 0x00, 0x00, 0xdb, 0x0c, 0x81, 0xdb, 0x13, 0x04, 0xdb, 0x0f, 0xff, 0x24, 0xff, 0x53, 0xff, 0x84, 0xff, 0xe3, 0x81, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x9c, 
+  0xff, 0xff, 0x83, 0xdb, 0xff, 0x01, 0xdb, 0x34, 0xdb, 0x03, 0x90, 0x00, 0x00, 0x07, 0xff, 0x1b, 0xff, 0x20, 0xdb, 0x1b, 0xff, 0x20, 0xff, 0x37, 0xff, 0x5f, 0xff, 0x83, 0xff, 0xd4, 0xa1, 0xff, 
+  0xff, 0x81, 0xdb, 0xff, 0x01, 0xdb, 0xf8, 0xdb, 0x2b, 0x91, 0x00, 0x00, 0x01, 0xff, 0x27, 0xff, 0x3c, 0x81, 0xff, 0x20, 0x03, 0xff, 0x38, 0xff, 0x57, 0xff, 0x5c, 0xff, 0xaf, 0xa1, 0xff, 0xff, 
+  0x81, 0xdb, 0xff, 0x01, 0xdb, 0xec, 0xb7, 0x1c, 0x91, 0x00, 0x00, 0x08, 0xff, 0x14, 0xff, 0x37, 0xff, 0x2c, 0xff, 0x23, 0xff, 0x2c, 0xff, 0x44, 0xff, 0x4c, 0xdb, 0x73, 0xdb, 0xff, 0x9a, 0xff, 
+  0xff, 0x81, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xdb, 0xe0, 0xb7, 0x0f, 0x91, 0x00, 0x00, 0x09, 0xff, 0x03, 0xff, 0x10, 0xff, 0x1b, 0xff, 0x1f, 0xff, 0x23, 0xff, 0x44, 0xff, 
+  0x57, 0xff, 0x3f, 0xdb, 0xf0, 0xdb, 0xff, 0x99, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xdb, 0xb0, 0xff, 0x03, 0x92, 0x00, 0x00, 0x07, 0xdb, 0x03, 0xff, 0x07, 
+  0xff, 0x0c, 0xdb, 0x14, 0xff, 0x23, 0xff, 0x30, 0xff, 0x2f, 0xdb, 0xaf, 0x82, 0xdb, 0xff, 0x98, 0xff, 0xff, 0x86, 0xdb, 0xff, 0x02, 0xdb, 0x7f, 0xff, 0x1b, 0xff, 0x04, 0x92, 0x00, 0x00, 0x07, 
+  0xdb, 0x04, 0xff, 0x07, 0xff, 0x0c, 0xff, 0x13, 0xff, 0x18, 0xff, 0x1c, 0xdb, 0x4b, 0xdb, 0xf8, 0x82, 0xdb, 0xff, 0x97, 0xff, 0xff, 0x85, 0xdb, 0xff, 0x03, 0xdb, 0xec, 0xff, 0x58, 0xff, 0x3f, 
+  0xdb, 0x13, 0x90, 0x00, 0x00, 0x09, 0xff, 0x03, 0xff, 0x07, 0xff, 0x08, 0xff, 0x0b, 0xff, 0x10, 0xff, 0x13, 0xdb, 0x18, 0xff, 0x1c, 0xff, 0x2c, 0xdb, 0xd8, 0x82, 0xdb, 0xff, 0x95, 0xff, 0xff, 
+  0x87, 0xdb, 0xff, 0x03, 0xdb, 0x93, 0xff, 0x33, 0xff, 0x3b, 0xff, 0x1b, 0x90, 0x00, 0x00, 0x05, 0xff, 0x03, 0xff, 0x08, 0xdb, 0x14, 0xdb, 0x17, 0xdb, 0x18, 0xff, 0x1b, 0x81, 0xff, 0x1f, 0x01, 
+  0xff, 0x23, 0xdb, 0x77, 0x82, 0xdb, 0xff, 0x92, 0xff, 0xff, 0x89, 0xdb, 0xff, 0x01, 0xdb, 0xef, 0xdb, 0x2c, 0x81, 0xff, 0x14, 0x00, 0xff, 0x08, 0x90, 0x00, 0x00, 0x0b, 0xff, 0x03, 0xff, 0x08, 
+  0xdb, 0x18, 0xff, 0x28, 0xff, 0x2c, 0xff, 0x2b, 0xff, 0x28, 0xff, 0x2b, 0xff, 0x34, 0xff, 0x3c, 0xdb, 0xc8, 0xdb, 0xff, 0x95, 0xff, 0xff, 0x87, 0xdb, 0xff, 0x03, 0xdb, 0x6b, 0xff, 0x04, 0xff, 
+  0x08, 0xff, 0x07, 0x91, 0x00, 0x00, 0x05, 0xff, 0x08, 0xff, 0x14, 0xff, 0x24, 0xff, 0x3b, 0xff, 0x63, 0xff, 0x5b, 0x81, 0xff, 0x4c, 0x03, 0xff, 0x67, 0xff, 0x7b, 0xff, 0xa3, 0xff, 0xf8, 0x98, 
+  0xff, 0xff, 0x83, 0xdb, 0xff, 0x01, 0xdb, 0xaf, 0xdb, 0x04, 0x81, 0x00, 0x00, 0x81, 0xff, 0x03, 0x90, 0x00, 0x00, 0x0b, 0xff, 0x0c, 0xdb, 0x1b, 0xff, 0x20, 0xff, 0x2f, 0xff, 0x60, 0xff, 0x68, 
+  0xff, 0x63, 0xff, 0x64, 0xff, 0x8c, 0xff, 0xaf, 0xff, 0xbb, 0xff, 0xd7, 0x89, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x8d, 0xff, 0xff, 0x82, 0xdb, 0xff, 0x02, 0xdb, 0xd8, 0xdb, 0x13, 0xdb, 0x04, 0x94, 
+  0x00, 0x00, 0x0c, 0xff, 0x13, 0xff, 0x20, 0xff, 0x28, 0xff, 0x33, 0xff, 0x40, 0xff, 0x47, 0xff, 0x4c, 0xff, 0x57, 0xff, 0x74, 0xff, 0xb4, 0xff, 0xc7, 0xff, 0xc8, 0xff, 0xe0, 0x87, 0xff, 0xff, 
+  0x82, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x03, 0xdb, 0xe3, 0xdb, 0x3b, 0xff, 0x07, 0xff, 0x03, 0x94, 0x00, 0x00, 0x04, 0xff, 0x17, 0xff, 0x2f, 
+  0xff, 0x34, 0xff, 0x3f, 0xff, 0x40, 0x81, 0xff, 0x37, 0x07, 0xff, 0x44, 0xff, 0x5b, 0xff, 0x9b, 0xff, 0xac, 0xff, 0xb8, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xfc, 0x85, 0xff, 0xff, 0x83, 0xdb, 0xff, 
+  0x00, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x00, 0xff, 0xff, 0x83, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x82, 0xdb, 0xff, 0x04, 0xdb, 0xe0, 0xdb, 0x54, 0xff, 0x0c, 0xdb, 0x04, 0xff, 0x03, 0x94, 0x00, 0x00, 
+  0x0c, 0xff, 0x0f, 0xff, 0x27, 0xff, 0x34, 0xff, 0x47, 0xff, 0x54, 0xff, 0x4b, 0xff, 0x3c, 0xff, 0x38, 0xff, 0x54, 0xff, 0x73, 0xff, 0x83, 0xff, 0x98, 0xff, 0xa4, 0x81, 0xff, 0xab, 0x00, 0xdb, 
+  0xef, 0x82, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x8f, 0xdb, 0xff, 0x04, 0xdb, 0xbc, 0xff, 0x38, 0xff, 0x27, 0xff, 0x13, 0xff, 0x03, 0x95, 0x00, 0x00, 0x11, 0xff, 0x07, 0xdb, 0x14, 0xff, 0x1b, 0xff, 
+  0x2f, 0xff, 0x48, 0xff, 0x53, 0xff, 0x47, 0xff, 0x37, 0xff, 0x38, 0xff, 0x44, 0xff, 0x54, 0xff, 0x70, 0xff, 0x88, 0xff, 0x94, 0xff, 0x70, 0xff, 0x57, 0xdb, 0xb0, 0xdb, 0xf7, 0x90, 0xdb, 0xff, 
+  0x06, 0xdb, 0xec, 0xdb, 0x73, 0xff, 0x20, 0xff, 0x24, 0xff, 0x27, 0xff, 0x1b, 0xff, 0x08, 0x96, 0x00, 0x00, 0x00, 0xff, 0x07, 0x81, 0xff, 0x0b, 0x01, 0xff, 0x14, 0xff, 0x34, 0x81, 0xff, 0x38, 
+  0x0a, 0xff, 0x27, 0xff, 0x18, 0xdb, 0x1b, 0xff, 0x33, 0xff, 0x57, 0xff, 0x77, 0xff, 0x73, 0xff, 0x3b, 0xff, 0x27, 0xdb, 0x50, 0xdb, 0xbb, 0x8d, 0xdb, 0xff, 0x05, 0xdb, 0xe0, 0xdb, 0x7b, 0xdb, 
+  0x1c, 0xff, 0x04, 0xdb, 0x14, 0xff, 0x1c, 0x81, 0xff, 0x10, 0x01, 0xff, 0x0f, 0xff, 0x04, 0x96, 0x00, 0x00, 0x16, 0xff, 0x03, 0xdb, 0x04, 0xdb, 0x03, 0xff, 0x04, 0xdb, 0x10, 0xff, 0x1b, 0xff, 
+  0x1c, 0xff, 0x0b, 0xff, 0x07, 0xff, 0x0f, 0xff, 0x24, 0xff, 0x3f, 0xff, 0x48, 0xff, 0x3b, 0xff, 0x1b, 0xdb, 0x14, 0xff, 0x08, 0xdb, 0x34, 0xdb, 0x88, 0xdb, 0xd3, 0xdb, 0xe8, 0xdb, 0xf4, 0xdb, 
+  0xfc, 0x82, 0xdb, 0xff, 0x05, 0xdb, 0xf8, 0xdb, 0xef, 0xdb, 0xe3, 0xdb, 0xac, 0xdb, 0x5b, 0xff, 0x03, 0x81, 0x00, 0x00, 0x07, 0xff, 0x03, 0xff, 0x07, 0xff, 0x0f, 0xff, 0x07, 0x00, 0x00, 0xff, 
+  0x04, 0xff, 0x07, 0xff, 0x03, 0x96, 0x00, 0x00, 0x83, 0xff, 0x03, 0x01, 0xdb, 0x07, 0xff, 0x07, 0x81, 0xdb, 0x04, 0x14, 0xff, 0x04, 0xff, 0x0b, 0xff, 0x18, 0xff, 0x1c, 0xff, 0x2b, 0xff, 0x23, 
+  0xff, 0x10, 0xff, 0x07, 0xff, 0x03, 0xff, 0x07, 0xff, 0x13, 0xdb, 0x28, 0xdb, 0x3f, 0xdb, 0x48, 0xdb, 0x50, 0xdb, 0x4b, 0xdb, 0x34, 0xdb, 0x2b, 0xdb, 0x20, 0xdb, 0x14, 0xff, 0x04, 0x81, 0xff, 
+  0x03, 0x83, 0x00, 0x00, 0x81, 0xff, 0x03, 0x81, 0x00, 0x00, 0x00, 0xff, 0x03, 0x98, 0x00, 0x00, 0x01, 0xff, 0x03, 0x00, 0x00, 0x81, 0xff, 0x03, 0x81, 0xdb, 0x04, 0x02, 0xff, 0x03, 0xdb, 0x03, 
+  0xdb, 0x07, 0x81, 0xff, 0x07, 0x07, 0xdb, 0x13, 0xff, 0x24, 0xff, 0x1c, 0xff, 0x07, 0xff, 0x03, 0x00, 0x00, 0xdb, 0x03, 0xff, 0x07, 0x82, 0xff, 0x0b, 0x02, 0xff, 0x0f, 0xff, 0x08, 0xdb, 0x03, 
+  0x81, 0x00, 0x00, 0x01, 0xff, 0x04, 0xdb, 0x03, 0xa6, 0x00, 0x00, 0x81, 0xff, 0x03, 0x00, 0xdb, 0x04, 0x81, 0xff, 0x03, 0x06, 0xdb, 0x04, 0xff, 0x03, 0xdb, 0x04, 0xdb, 0x08, 0xff, 0x14, 0xff, 
+  0x0c, 0xff, 0x03, 0x81, 0x00, 0x00, 0x84, 0xff, 0x03, 0x01, 0xdb, 0x04, 0xff, 0x03, 0xab, 0x00, 0x00, 0x84, 0xff, 0x03, 0x02, 0x00, 0x00, 0xdb, 0x03, 0xff, 0x03, 0x81, 0xff, 0x07, 0x00, 0xff, 
+  0x03, 0x81, 0x00, 0x00, 0x00, 0xff, 0x03, 0xb9, 0x00, 0x00, 0x81, 0xff, 0x03, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xa6, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xbd, 0x0f, 0xd7, 0xbd, 0x4c, 0xd7, 0xbd, 0x7f, 0xf7, 0xbd, 0xa7, 0xd7, 0xbd, 0xc0, 0xd7, 0xbd, 0xcb, 0xd7, 0xbd, 0xb8, 0xd7, 0xbd, 0x9b, 0xd7, 0xbd, 0x6f, 0xd7, 0xbd, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc5, 0x14, 0xf8, 0xc5, 0x5c, 0xf8, 0xc5, 0xb7, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xeb, 0xd7, 0xbd, 0x9b, 0xb7, 0xbd, 0x33, 0xb6, 0xb5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0x07, 0xf8, 0xc5, 0x80, 0xf8, 0xc5, 0xeb, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xf8, 0xd7, 0xbd, 0xd3, 0xb7, 0xbd, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xd7, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xab, 0xb6, 0xb5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x00, 0x18, 0xc6, 0x87, 0x18, 0xc6, 0xf8, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xf0, 0xb6, 0xb5, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x0f, 0x18, 0xc6, 0x9f, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xfb, 0xb6, 0xb5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x00, 0x18, 0xc6, 0x9f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xfb, 0xb6, 0xb5, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x87, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xf7, 0x96, 0xb5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xf8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xd8, 0xb6, 0xb5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0x07, 0x18, 0xc6, 0xd7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x80, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf3, 0x96, 0xb5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x14, 0x18, 0xc6, 0xeb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x5c, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xb7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x0f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xcb, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x38, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xe4, 0x96, 0xb5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x7f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xf0, 0x96, 0xb5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x03, 0x79, 0xce, 0x04, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xa7, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xfb, 0x96, 0xb5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x18, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x2c, 0x38, 0xc6, 0xcb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x03, 0x9a, 0xd6, 0x07, 0x59, 0xce, 0x04, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x1f, 0xfb, 0xde, 0x53, 0x1c, 0xe7, 0x68, 0x7a, 0xd6, 0xe0, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x0c, 0x79, 0xce, 0x13, 0x7a, 0xd6, 0x13, 0x59, 0xce, 0x0f, 0xdb, 0xde, 0x24, 0xfc, 0xe6, 0x53, 0x1c, 0xe7, 0x84, 0xbb, 0xde, 0xe3, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xd7, 0xbd, 0x34, 0xb7, 0xbd, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x1b, 0xbb, 0xde, 0x20, 0x7a, 0xd6, 0x1b, 0xdb, 0xde, 0x20, 0xdb, 0xde, 0x37, 0xfc, 0xe6, 0x5f, 0x1c, 0xe7, 0x83, 0xbb, 0xde, 0xd4, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xd7, 0xbd, 0xff, 0x96, 0xb5, 0xf8, 0x96, 0xb5, 0x2b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x27, 0xdb, 0xde, 0x3c, 0xbb, 0xde, 0x20, 0xdb, 0xde, 0x20, 0xdb, 0xde, 0x38, 0xfb, 0xde, 0x57, 0xfc, 0xe6, 0x5c, 0xba, 0xd6, 0xaf, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xd7, 0xbd, 0xff, 0x96, 0xb5, 0xec, 0x96, 0xb5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x14, 0xdb, 0xde, 0x37, 0xbb, 0xde, 0x2c, 0xdb, 0xde, 0x23, 0xdb, 0xde, 0x2c, 0xdb, 0xde, 0x44, 0xfb, 0xde, 0x4c, 0x7a, 0xd6, 0x73, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xd7, 0xbd, 0xff, 0x96, 0xb5, 0xe0, 0x96, 0xb5, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x03, 0xdb, 0xde, 0x10, 0x9a, 0xd6, 0x1b, 0xba, 0xd6, 0x1f, 0xbb, 0xde, 0x23, 0xdb, 0xde, 0x44, 0xdb, 0xde, 0x57, 0xdb, 0xde, 0x3f, 0x39, 0xce, 0xf0, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0xf8, 0xc5, 0xff, 0xb7, 0xbd, 0xb0, 0x9e, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x03, 0x1c, 0xe7, 0x07, 0x9a, 0xd6, 0x0c, 0x9a, 0xd6, 0x14, 0xdb, 0xde, 0x23, 0xba, 0xd6, 0x30, 0x1c, 0xe7, 0x2f, 0x38, 0xc6, 0xaf, 0x38, 0xc6, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0x7f, 0xba, 0xd6, 0x1b, 0xba, 0xd6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x39, 0xce, 0x04, 0x1c, 0xe7, 0x07, 0xbb, 0xde, 0x0c, 0xba, 0xd6, 0x13, 0x9a, 0xd6, 0x18, 0xba, 0xd6, 0x1c, 0x59, 0xce, 0x4b, 0x18, 0xc6, 0xf8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xec, 0xfc, 0xe6, 0x58, 0xdb, 0xde, 0x3f, 0x9a, 0xd6, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x03, 0xba, 0xd6, 0x07, 0xfc, 0xe6, 0x08, 0xbb, 0xde, 0x0b, 0xbb, 0xde, 0x10, 0xba, 0xd6, 0x13, 0x9a, 0xd6, 0x18, 0x9a, 0xd6, 0x1c, 0x9a, 0xd6, 0x2c, 0x18, 0xc6, 0xd8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0x18, 0xc6, 0x93, 0xfc, 0xe6, 0x33, 0xdb, 0xde, 0x3b, 0xdb, 0xde, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x03, 0x9a, 0xd6, 0x08, 0x79, 0xce, 0x14, 0x9a, 0xd6, 0x17, 0x79, 0xce, 0x18, 0x9a, 0xd6, 0x1b, 0xbb, 0xde, 0x1f, 0xbb, 0xde, 0x1f, 0xfc, 0xe6, 0x23, 0x38, 0xc6, 0x77, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xef, 0x18, 0xc6, 0x2c, 0xdb, 0xde, 0x14, 0xfb, 0xde, 0x14, 0xbb, 0xde, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x03, 0xfb, 0xde, 0x08, 0x9a, 0xd6, 0x18, 0xdb, 0xde, 0x28, 0xdb, 0xde, 0x2c, 0xfb, 0xde, 0x2b, 0xfb, 0xde, 0x28, 0xdb, 0xde, 0x2b, 0xbb, 0xde, 0x34, 0xfb, 0xde, 0x3c, 0x59, 0xce, 0xc8, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0x6b, 0xff, 0xff, 0x04, 0x1c, 0xe7, 0x08, 0xba, 0xd6, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x08, 0x9a, 0xd6, 0x14, 0xdb, 0xde, 0x24, 0xdb, 0xde, 0x3b, 0xfc, 0xe6, 0x63, 0xfc, 0xe6, 0x5b, 0xdb, 0xde, 0x4c, 0xdb, 0xde, 0x4c, 0xfc, 0xe6, 0x67, 0x1c, 0xe7, 0x7b, 0x1c, 0xe7, 0xa3, 0xdb, 0xde, 0xf8, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x38, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xaf, 0x7a, 0xd6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x03, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x0c, 0x7a, 0xd6, 0x1b, 0xdb, 0xde, 0x20, 0xba, 0xd6, 0x2f, 0xfc, 0xe6, 0x60, 0xfc, 0xe6, 0x68, 0xfc, 0xe6, 0x63, 0xfb, 0xde, 0x64, 0x1c, 0xe7, 0x8c, 0x5d, 0xef, 0xaf, 0x5d, 0xef, 0xbb, 0x3d, 0xef, 0xd7, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xbb, 0xde, 0xff, 0x59, 0xce, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xf8, 0xc5, 0xff, 0xb7, 0xbd, 0xd8, 0xf7, 0xbd, 0x13, 0x18, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x13, 0xdb, 0xde, 0x20, 0xdb, 0xde, 0x28, 0xba, 0xd6, 0x33, 0xfb, 0xde, 0x40, 0xdb, 0xde, 0x47, 0xfb, 0xde, 0x4c, 0xfb, 0xde, 0x57, 0x1c, 0xe7, 0x74, 0x5d, 0xef, 0xb4, 0x5d, 0xef, 0xc7, 0x7d, 0xef, 0xc8, 0x5d, 0xef, 0xe0, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x7a, 0xd6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0xf8, 0xc5, 0xe3, 0xf7, 0xbd, 0x3b, 0xdb, 0xde, 0x07, 0x9e, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x17, 0xdb, 0xde, 0x2f, 0xdb, 0xde, 0x34, 0xdb, 0xde, 0x3f, 0xdb, 0xde, 0x40, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x44, 0xfb, 0xde, 0x5b, 0x3c, 0xe7, 0x9b, 0x5d, 0xef, 0xac, 0x5d, 0xef, 0xb8, 0x5d, 0xef, 0xbf, 0x3d, 0xef, 0xdb, 0xfc, 0xe6, 0xfc, 0xfc, 0xe6, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x79, 0xce, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x39, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x59, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x7a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xe0, 0x59, 0xce, 0x54, 0xbb, 0xde, 0x0c, 0x7a, 0xd6, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x0f, 0xdb, 0xde, 0x27, 0xbb, 0xde, 0x34, 0xdb, 0xde, 0x47, 0xfb, 0xde, 0x54, 0xdb, 0xde, 0x4b, 0xbb, 0xde, 0x3c, 0xdb, 0xde, 0x38, 0xfb, 0xde, 0x54, 0x1c, 0xe7, 0x73, 0x1c, 0xe7, 0x83, 0x3c, 0xe7, 0x98, 0x3c, 0xe7, 0xa4, 0x5d, 0xef, 0xab, 0x1c, 0xe7, 0xab, 0x7a, 0xd6, 0xef, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xbc, 0xba, 0xd6, 0x38, 0xdb, 0xde, 0x27, 0x9a, 0xd6, 0x13, 0x7d, 0xef, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x07, 0x9a, 0xd6, 0x14, 0xba, 0xd6, 0x1b, 0xdb, 0xde, 0x2f, 0xfb, 0xde, 0x48, 0xdb, 0xde, 0x53, 0xfb, 0xde, 0x47, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x38, 0xdb, 0xde, 0x44, 0xfc, 0xe6, 0x54, 0xfc, 0xe6, 0x70, 0x1c, 0xe7, 0x88, 0x3c, 0xe7, 0x94, 0xfc, 0xe6, 0x70, 0x9a, 0xd6, 0x57, 0x38, 0xc6, 0xb0, 0x38, 0xc6, 0xf7, 0x59, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xec, 0xd7, 0xbd, 0x73, 0xdb, 0xde, 0x20, 0xfb, 0xde, 0x24, 0xdb, 0xde, 0x27, 0x9a, 0xd6, 0x1b, 0xba, 0xd6, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd6, 0x07, 0xdb, 0xde, 0x0b, 0xdb, 0xde, 0x0b, 0xdb, 0xde, 0x14, 0xbb, 0xde, 0x34, 0xfb, 0xde, 0x38, 0xdb, 0xde, 0x38, 0xdb, 0xde, 0x27, 0xba, 0xd6, 0x18, 0x9a, 0xd6, 0x1b, 0xdb, 0xde, 0x33, 0xfb, 0xde, 0x57, 0x1c, 0xe7, 0x77, 0x1c, 0xe7, 0x73, 0xbb, 0xde, 0x3b, 0xfb, 0xde, 0x27, 0x59, 0xce, 0x50, 0x39, 0xce, 0xbb, 0x38, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xe0, 0x96, 0xb5, 0x7b, 0xd7, 0xbd, 0x1c, 0x3c, 0xe7, 0x04, 0x7a, 0xd6, 0x14, 0x9a, 0xd6, 0x1c, 0xba, 0xd6, 0x10, 0xba, 0xd6, 0x10, 0xdb, 0xde, 0x0f, 0xdb, 0xde, 0x04, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xf7, 0x03, 0x79, 0xce, 0x04, 0x18, 0xc6, 0x03, 0xba, 0xd6, 0x04, 0x39, 0xce, 0x10, 0xdb, 0xde, 0x1b, 0xfb, 0xde, 0x1c, 0x9a, 0xd6, 0x0b, 0xfc, 0xe6, 0x07, 0x9a, 0xd6, 0x0f, 0xfb, 0xde, 0x24, 0xfb, 0xde, 0x3f, 0xdb, 0xde, 0x48, 0xdb, 0xde, 0x3b, 0xba, 0xd6, 0x1b, 0x79, 0xce, 0x14, 0x1c, 0xe7, 0x08, 0x39, 0xce, 0x34, 0x18, 0xc6, 0x88, 0xf8, 0xc5, 0xd3, 0x18, 0xc6, 0xe8, 0x18, 0xc6, 0xf4, 0x18, 0xc6, 0xfc, 0xf7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xf8, 0xb7, 0xbd, 0xef, 0xb7, 0xbd, 0xe3, 0xb7, 0xbd, 0xac, 0xb7, 0xbd, 0x5b, 0x5d, 0xef, 0x03, 0x00, 0x00, 0x00, 0xbe, 0xf7, 0x00, 0xbf, 0xff, 0x03, 0x1c, 0xe7, 0x07, 0x9a, 0xd6, 0x0f, 0xba, 0xd6, 0x07, 0xff, 0xff, 0x00, 0xdb, 0xde, 0x04, 0xbb, 0xde, 0x07, 0x3d, 0xef, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0x3d, 0xef, 0x03, 0x79, 0xce, 0x07, 0xdb, 0xde, 0x07, 0x59, 0xce, 0x04, 0x18, 0xc6, 0x04, 0xdb, 0xde, 0x04, 0xfb, 0xde, 0x0b, 0x9a, 0xd6, 0x18, 0x9a, 0xd6, 0x1c, 0xdb, 0xde, 0x2b, 0xbb, 0xde, 0x23, 0xdb, 0xde, 0x10, 0xbb, 0xde, 0x07, 0xff, 0xff, 0x03, 0xdb, 0xde, 0x07, 0x9a, 0xd6, 0x13, 0x38, 0xc6, 0x28, 0x59, 0xce, 0x3f, 0x59, 0xce, 0x48, 0x59, 0xce, 0x50, 0x18, 0xc6, 0x4b, 0xd7, 0xbd, 0x34, 0xb6, 0xb5, 0x2b, 0xb6, 0xb5, 0x20, 0x18, 0xc6, 0x14, 0x9e, 0xf7, 0x04, 0x3d, 0xef, 0x03, 0x3d, 0xef, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1c, 0xe7, 0x00, 0x9e, 0xf7, 0x03, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0x39, 0xce, 0x04, 0x18, 0xc6, 0x04, 0xff, 0xff, 0x03, 0x7a, 0xd6, 0x03, 0x9a, 0xd6, 0x07, 0xfc, 0xe6, 0x07, 0xfc, 0xe6, 0x07, 0x7a, 0xd6, 0x13, 0xdb, 0xde, 0x24, 0xba, 0xd6, 0x1c, 0xfc, 0xe6, 0x07, 0x3c, 0xe7, 0x03, 0xff, 0xff, 0x00, 0x59, 0xce, 0x03, 0xfc, 0xe6, 0x07, 0xfb, 0xde, 0x0b, 0xfb, 0xde, 0x0b, 0xfb, 0xde, 0x0b, 0xba, 0xd6, 0x0f, 0xdb, 0xde, 0x08, 0x59, 0xce, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xba, 0xd6, 0x04, 0x9a, 0xd6, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0x03, 0x18, 0xc6, 0x04, 0xff, 0xff, 0x03, 0x1c, 0xe7, 0x03, 0xf7, 0xbd, 0x04, 0xbe, 0xf7, 0x03, 0x9a, 0xd6, 0x04, 0x9a, 0xd6, 0x08, 0x9a, 0xd6, 0x14, 0xdb, 0xde, 0x0c, 0x7e, 0xf7, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1c, 0xe7, 0x03, 0xbb, 0xde, 0x03, 0x3d, 0xef, 0x03, 0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x03, 0x18, 0xc6, 0x04, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x59, 0xce, 0x03, 0xdf, 0xff, 0x03, 0xfc, 0xe6, 0x07, 0xfb, 0xde, 0x07, 0x7d, 0xef, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x00, 0x1c, 0xe7, 0x03, 0x7e, 0xf7, 0x03, 0xdf, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 
+  0x09, 0xb7, 0xbd, 0x0f, 0xd7, 0xbd, 0x4c, 0xd7, 0xbd, 0x7f, 0xf7, 0xbd, 0xa7, 0xd7, 0xbd, 0xc0, 0xd7, 0xbd, 0xcb, 0xd7, 0xbd, 0xb8, 0xd7, 0xbd, 0x9b, 0xd7, 0xbd, 0x6f, 0xd7, 0xbd, 0x38, 0xb2, 
+  0x00, 0x00, 0x00, 0x03, 0xf8, 0xc5, 0x14, 0xf8, 0xc5, 0x5c, 0xf8, 0xc5, 0xb7, 0xf7, 0xbd, 0xff, 0x82, 0xf8, 0xc5, 0xff, 0x82, 0xf7, 0xbd, 0xff, 0x82, 0xd7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 0xeb, 
+  0xd7, 0xbd, 0x9b, 0xb7, 0xbd, 0x33, 0xb6, 0xb5, 0x0c, 0xac, 0x00, 0x00, 0x00, 0x02, 0x76, 0xb5, 0x07, 0xf8, 0xc5, 0x80, 0xf8, 0xc5, 0xeb, 0x86, 0x18, 0xc6, 0xff, 0x82, 0xf8, 0xc5, 0xff, 0x81, 
+  0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xd7, 0xbd, 0xf8, 0xd7, 0xbd, 0xd3, 0xb7, 0xbd, 0x57, 0xaa, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xd7, 0x83, 0x18, 0xc6, 0xff, 
+  0x82, 0x38, 0xc6, 0xff, 0x85, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x00, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xab, 0xb6, 0xb5, 0x23, 0xa7, 0x00, 
+  0x00, 0x00, 0x01, 0x18, 0xc6, 0x87, 0x18, 0xc6, 0xf8, 0x81, 0x18, 0xc6, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x85, 0x39, 0xce, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x83, 0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 
+  0xff, 0x81, 0xf7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xf0, 0xb6, 0xb5, 0x4c, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 0x0f, 0x18, 0xc6, 0x9f, 0x81, 0x18, 0xc6, 
+  0xff, 0x00, 0x38, 0xc6, 0xff, 0x82, 0x39, 0xce, 0xff, 0x85, 0x59, 0xce, 0xff, 0x82, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x83, 0x18, 0xc6, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x03, 0xd7, 0xbd, 
+  0xff, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xfb, 0xb6, 0xb5, 0x5b, 0xa3, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 0x9f, 0x18, 0xc6, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x00, 0x39, 0xce, 0xff, 0x83, 0x59, 0xce, 
+  0xff, 0x02, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x84, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x81, 0xf8, 0xc5, 0xff, 0x82, 
+  0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0xfb, 0xb6, 0xb5, 0x60, 0xa1, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x87, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x83, 
+  0x79, 0xce, 0xff, 0x83, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x39, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 
+  0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb7, 0xbd, 0xf7, 0x96, 0xb5, 0x33, 0x9f, 0x00, 0x00, 0x00, 0x03, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xf8, 0x38, 0xc6, 0xff, 0x39, 0xce, 
+  0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x86, 0x9a, 0xd6, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 
+  0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xd8, 0xb6, 0xb5, 0x18, 0x9d, 0x00, 0x00, 
+  0x00, 0x03, 0xb6, 0xb5, 0x07, 0x18, 0xc6, 0xd7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x04, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 
+  0x39, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x85, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 
+  0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0x97, 0x9d, 0x00, 0x00, 0x00, 0x01, 0x18, 0xc6, 0x80, 0x18, 0xc6, 0xff, 0x81, 0x39, 0xce, 
+  0xff, 0x04, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x82, 0x59, 0xce, 0xff, 0x01, 0x38, 0xc6, 0xff, 0x9a, 0xd6, 0xff, 0x82, 0xba, 0xd6, 0xff, 
+  0x82, 0x9a, 0xd6, 0xff, 0x00, 0x7a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x01, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x81, 0x38, 0xc6, 0xff, 0x02, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 
+  0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xf3, 0x96, 0xb5, 0x28, 0x9b, 0x00, 0x00, 0x00, 0x08, 0x18, 0xc6, 0x14, 0x18, 0xc6, 0xeb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 
+  0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0x84, 0x59, 0xce, 0xff, 0x01, 0x79, 0xce, 0xff, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x81, 0xba, 
+  0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x82, 0x59, 0xce, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 
+  0x81, 0xd7, 0xbd, 0xff, 0x01, 0xb7, 0xbd, 0xff, 0x96, 0xb5, 0x9c, 0x9b, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x5c, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x04, 0x79, 0xce, 
+  0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0x59, 0xce, 0xff, 0x84, 0x79, 0xce, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x83, 0x9a, 0xd6, 
+  0xff, 0x03, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x01, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb7, 0xbd, 
+  0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x1b, 0x9a, 0x00, 0x00, 0x00, 0x09, 0x18, 0xc6, 0xb7, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 
+  0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x01, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x00, 0xba, 0xd6, 
+  0xff, 0x83, 0x9a, 0xd6, 0xff, 0x0b, 0x7a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 
+  0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0x70, 0x99, 0x00, 0x00, 0x00, 0x06, 0xf7, 0xbd, 0x0f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x79, 0xce, 
+  0xff, 0x7a, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x04, 0x79, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x84, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 
+  0x00, 0xba, 0xd6, 0xff, 0x85, 0x9a, 0xd6, 0xff, 0x04, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb6, 0xb5, 0xff, 
+  0x96, 0xb5, 0xcb, 0x55, 0xad, 0x03, 0x98, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x4c, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 
+  0x01, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x02, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xff, 0x83, 0xdb, 0xde, 0xff, 0x00, 0xbb, 0xde, 
+  0xff, 0x81, 0xba, 0xd6, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x01, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x03, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x38, 0xc6, 0xff, 0xf8, 0xc5, 
+  0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xe4, 0x96, 0xb5, 0x13, 0x98, 0x00, 0x00, 0x00, 0x02, 0x18, 0xc6, 0x7f, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x59, 0xce, 
+  0xff, 0x00, 0x7a, 0xd6, 0xff, 0x82, 0xba, 0xd6, 0xff, 0x03, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x83, 0x1c, 0xe7, 0xff, 0x01, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 
+  0xff, 0x82, 0xdb, 0xde, 0xff, 0x82, 0xba, 0xd6, 0xff, 0x84, 0xbb, 0xde, 0xff, 0x03, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xf8, 0xc5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb6, 
+  0xb5, 0xff, 0x96, 0xb5, 0xf0, 0x96, 0xb5, 0x20, 0x95, 0x00, 0x00, 0x00, 0x08, 0xdb, 0xde, 0x03, 0x79, 0xce, 0x04, 0x00, 0x00, 0x00, 0x18, 0xc6, 0xa7, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 
+  0xce, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x82, 0xbb, 0xde, 0xff, 0x05, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x83, 
+  0x1c, 0xe7, 0xff, 0x00, 0xfc, 0xe6, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x81, 0xba, 0xd6, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x00, 0xbb, 0xde, 0xff, 0x81, 
+  0xdb, 0xde, 0xff, 0x02, 0xbb, 0xde, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xfb, 0x96, 0xb5, 0x2b, 0x95, 0x00, 0x00, 0x00, 0x05, 
+  0x9a, 0xd6, 0x18, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x2c, 0x38, 0xc6, 0xcb, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x82, 0xdb, 0xde, 
+  0xff, 0x03, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x00, 0x3d, 0xef, 0xff, 0x83, 0x1c, 0xe7, 0xff, 0x00, 0xfc, 0xe6, 0xff, 0x81, 0xdb, 
+  0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x02, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x81, 0xfc, 0xe6, 0xff, 0x04, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x39, 0xce, 0xff, 0xf7, 0xbd, 
+  0xff, 0xd7, 0xbd, 0xff, 0x81, 0xb6, 0xb5, 0xff, 0x00, 0x96, 0xb5, 0x30, 0x91, 0x00, 0x00, 0x00, 0x07, 0xfc, 0xe6, 0x03, 0x9a, 0xd6, 0x07, 0x59, 0xce, 0x04, 0x00, 0x00, 0x00, 0xbb, 0xde, 0x1f, 
+  0xfb, 0xde, 0x53, 0x1c, 0xe7, 0x68, 0x7a, 0xd6, 0xe0, 0x82, 0x59, 0xce, 0xff, 0x02, 0x79, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x04, 0xfc, 0xe6, 0xff, 0x1c, 
+  0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x81, 0x7e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x81, 0x1c, 0xe7, 
+  0xff, 0x00, 0xfb, 0xde, 0xff, 0x83, 0xdb, 0xde, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x08, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 
+  0xb7, 0xbd, 0xff, 0x96, 0xb5, 0xff, 0x96, 0xb5, 0x33, 0x91, 0x00, 0x00, 0x00, 0x07, 0x9a, 0xd6, 0x0c, 0x79, 0xce, 0x13, 0x7a, 0xd6, 0x13, 0x59, 0xce, 0x0f, 0xdb, 0xde, 0x24, 0xfc, 0xe6, 0x53, 
+  0x1c, 0xe7, 0x84, 0xbb, 0xde, 0xe3, 0x81, 0xba, 0xd6, 0xff, 0x03, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x82, 0x1c, 0xe7, 0xff, 0x00, 0x3c, 0xe7, 0xff, 0x81, 
+  0x3d, 0xef, 0xff, 0x00, 0x5d, 0xef, 0xff, 0x82, 0x7e, 0xf7, 0xff, 0x81, 0x7d, 0xef, 0xff, 0x01, 0x5d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x84, 0x1c, 0xe7, 0xff, 0x00, 0xfb, 0xde, 0xff, 0x81, 0xdb, 
+  0xde, 0xff, 0x0a, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x38, 0xc6, 0xff, 0xd7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xd7, 0xbd, 
+  0x34, 0xb7, 0xbd, 0x03, 0x90, 0x00, 0x00, 0x00, 0x07, 0xbb, 0xde, 0x1b, 0xbb, 0xde, 0x20, 0x7a, 0xd6, 0x1b, 0xdb, 0xde, 0x20, 0xdb, 0xde, 0x37, 0xfc, 0xe6, 0x5f, 0x1c, 0xe7, 0x83, 0xbb, 0xde, 
+  0xd4, 0x82, 0xdb, 0xde, 0xff, 0x02, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x81, 0x3d, 0xef, 0xff, 0x82, 0x5d, 0xef, 0xff, 0x00, 0x7d, 0xef, 0xff, 0x83, 
+  0x7e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x84, 0x1c, 0xe7, 0xff, 0x82, 0xdb, 0xde, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x06, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 
+  0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xd7, 0xbd, 0xff, 0x96, 0xb5, 0xf8, 0x96, 0xb5, 0x2b, 0x91, 0x00, 0x00, 0x00, 0x09, 0x9a, 0xd6, 0x27, 0xdb, 0xde, 0x3c, 0xbb, 0xde, 0x20, 0xdb, 0xde, 0x20, 
+  0xdb, 0xde, 0x38, 0xfb, 0xde, 0x57, 0xfc, 0xe6, 0x5c, 0xba, 0xd6, 0xaf, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x82, 0xfb, 0xde, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x84, 0x5d, 
+  0xef, 0xff, 0x00, 0x7d, 0xef, 0xff, 0x83, 0x7e, 0xf7, 0xff, 0x01, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x81, 0x3d, 0xef, 0xff, 0x83, 0x1c, 0xe7, 0xff, 0x03, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 
+  0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x05, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xd7, 0xbd, 0xff, 0x96, 0xb5, 0xec, 0x96, 0xb5, 0x1c, 0x91, 0x00, 0x00, 
+  0x00, 0x09, 0xdb, 0xde, 0x14, 0xdb, 0xde, 0x37, 0xbb, 0xde, 0x2c, 0xdb, 0xde, 0x23, 0xdb, 0xde, 0x2c, 0xdb, 0xde, 0x44, 0xfb, 0xde, 0x4c, 0x7a, 0xd6, 0x73, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 
+  0x82, 0xfb, 0xde, 0xff, 0x02, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x85, 0x5d, 0xef, 0xff, 0x82, 0x7d, 0xef, 0xff, 0x00, 0x7e, 0xf7, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x82, 0x3d, 
+  0xef, 0xff, 0x00, 0x3c, 0xe7, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x04, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x04, 0xba, 
+  0xd6, 0xff, 0x59, 0xce, 0xff, 0xd7, 0xbd, 0xff, 0x96, 0xb5, 0xe0, 0x96, 0xb5, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x0a, 0xfc, 0xe6, 0x03, 0xdb, 0xde, 0x10, 0x9a, 0xd6, 0x1b, 0xba, 0xd6, 0x1f, 0xbb, 
+  0xde, 0x23, 0xdb, 0xde, 0x44, 0xdb, 0xde, 0x57, 0xdb, 0xde, 0x3f, 0x39, 0xce, 0xf0, 0x9a, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x01, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x87, 
+  0x5d, 0xef, 0xff, 0x82, 0x7d, 0xef, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x00, 0x3c, 0xe7, 0xff, 0x85, 0x1c, 0xe7, 0xff, 0x01, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x81, 0x9a, 
+  0xd6, 0xff, 0x04, 0xba, 0xd6, 0xff, 0x7a, 0xd6, 0xff, 0xf8, 0xc5, 0xff, 0xb7, 0xbd, 0xb0, 0x9e, 0xf7, 0x03, 0x92, 0x00, 0x00, 0x00, 0x0e, 0x79, 0xce, 0x03, 0x1c, 0xe7, 0x07, 0x9a, 0xd6, 0x0c, 
+  0x9a, 0xd6, 0x14, 0xdb, 0xde, 0x23, 0xba, 0xd6, 0x30, 0x1c, 0xe7, 0x2f, 0x38, 0xc6, 0xaf, 0x38, 0xc6, 0xff, 0x79, 0xce, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 
+  0xff, 0x3c, 0xe7, 0xff, 0x88, 0x5d, 0xef, 0xff, 0x00, 0x7d, 0xef, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x01, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x82, 0xfc, 0xe6, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x01, 
+  0xfb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x01, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x79, 0xce, 0xff, 0x03, 0x38, 0xc6, 0xff, 0x39, 0xce, 0x7f, 0xba, 0xd6, 0x1b, 0xba, 
+  0xd6, 0x04, 0x92, 0x00, 0x00, 0x00, 0x0d, 0x39, 0xce, 0x04, 0x1c, 0xe7, 0x07, 0xbb, 0xde, 0x0c, 0xba, 0xd6, 0x13, 0x9a, 0xd6, 0x18, 0xba, 0xd6, 0x1c, 0x59, 0xce, 0x4b, 0x18, 0xc6, 0xf8, 0x38, 
+  0xc6, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x81, 0x3d, 0xef, 0xff, 0x00, 0x5d, 0xef, 0xff, 0x82, 0x3d, 0xef, 
+  0xff, 0x83, 0x5d, 0xef, 0xff, 0x02, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xde, 0xff, 0x84, 0xdb, 0xde, 0xff, 0x02, 0xbb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x81, 0x18, 0xc6, 
+  0xff, 0x81, 0x38, 0xc6, 0xff, 0x03, 0x38, 0xc6, 0xec, 0xfc, 0xe6, 0x58, 0xdb, 0xde, 0x3f, 0x9a, 0xd6, 0x13, 0x90, 0x00, 0x00, 0x00, 0x0e, 0x5d, 0xef, 0x03, 0xba, 0xd6, 0x07, 0xfc, 0xe6, 0x08, 
+  0xbb, 0xde, 0x0b, 0xbb, 0xde, 0x10, 0xba, 0xd6, 0x13, 0x9a, 0xd6, 0x18, 0x9a, 0xd6, 0x1c, 0x9a, 0xd6, 0x2c, 0x18, 0xc6, 0xd8, 0x38, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x59, 0xce, 0xff, 0xba, 0xd6, 
+  0xff, 0xfb, 0xde, 0xff, 0x83, 0x1c, 0xe7, 0xff, 0x83, 0x3c, 0xe7, 0xff, 0x00, 0x3d, 0xef, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x82, 0x1c, 0xe7, 0xff, 0x02, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0xba, 
+  0xd6, 0xff, 0x83, 0x9a, 0xd6, 0xff, 0x00, 0x79, 0xce, 0xff, 0x81, 0x59, 0xce, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x04, 0xd7, 0xbd, 0xff, 0x18, 0xc6, 0x93, 0xfc, 0xe6, 0x33, 
+  0xdb, 0xde, 0x3b, 0xdb, 0xde, 0x1b, 0x90, 0x00, 0x00, 0x00, 0x05, 0x5d, 0xef, 0x03, 0x9a, 0xd6, 0x08, 0x79, 0xce, 0x14, 0x9a, 0xd6, 0x17, 0x79, 0xce, 0x18, 0x9a, 0xd6, 0x1b, 0x81, 0xbb, 0xde, 
+  0x1f, 0x07, 0xfc, 0xe6, 0x23, 0x38, 0xc6, 0x77, 0x18, 0xc6, 0xff, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xfb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x01, 0x3d, 
+  0xef, 0xff, 0x3c, 0xe7, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x82, 0x3c, 0xe7, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x00, 0xfc, 0xe6, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x01, 0xdb, 0xde, 0xff, 0xba, 0xd6, 0xff, 
+  0x81, 0x9a, 0xd6, 0xff, 0x0c, 0x7a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xef, 
+  0x18, 0xc6, 0x2c, 0xdb, 0xde, 0x14, 0xfb, 0xde, 0x14, 0xbb, 0xde, 0x08, 0x90, 0x00, 0x00, 0x00, 0x10, 0xdb, 0xde, 0x03, 0xfb, 0xde, 0x08, 0x9a, 0xd6, 0x18, 0xdb, 0xde, 0x28, 0xdb, 0xde, 0x2c, 
+  0xfb, 0xde, 0x2b, 0xfb, 0xde, 0x28, 0xdb, 0xde, 0x2b, 0xbb, 0xde, 0x34, 0xfb, 0xde, 0x3c, 0x59, 0xce, 0xc8, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 
+  0xff, 0x3c, 0xe7, 0xff, 0x82, 0x3d, 0xef, 0xff, 0x85, 0x3c, 0xe7, 0xff, 0x01, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0x83, 0xdb, 0xde, 0xff, 0x0d, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x7a, 0xd6, 
+  0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0x6b, 0xff, 0xff, 0x04, 0x1c, 0xe7, 0x08, 0xba, 
+  0xd6, 0x07, 0x91, 0x00, 0x00, 0x00, 0x05, 0x9a, 0xd6, 0x08, 0x9a, 0xd6, 0x14, 0xdb, 0xde, 0x24, 0xdb, 0xde, 0x3b, 0xfc, 0xe6, 0x63, 0xfc, 0xe6, 0x5b, 0x81, 0xdb, 0xde, 0x4c, 0x04, 0xfc, 0xe6, 
+  0x67, 0x1c, 0xe7, 0x7b, 0x1c, 0xe7, 0xa3, 0xdb, 0xde, 0xf8, 0xfc, 0xe6, 0xff, 0x82, 0x1c, 0xe7, 0xff, 0x00, 0x3c, 0xe7, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x03, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 
+  0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x02, 0x1c, 0xe7, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xff, 0x81, 0xbb, 0xde, 0xff, 0x83, 0xba, 0xd6, 0xff, 
+  0x06, 0x9a, 0xd6, 0xff, 0x79, 0xce, 0xff, 0x38, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xaf, 0x7a, 0xd6, 0x04, 0x81, 0x00, 0x00, 0x00, 0x01, 0x5d, 0xef, 0x03, 0xff, 0xff, 
+  0x03, 0x90, 0x00, 0x00, 0x00, 0x10, 0xdb, 0xde, 0x0c, 0x7a, 0xd6, 0x1b, 0xdb, 0xde, 0x20, 0xba, 0xd6, 0x2f, 0xfc, 0xe6, 0x60, 0xfc, 0xe6, 0x68, 0xfc, 0xe6, 0x63, 0xfb, 0xde, 0x64, 0x1c, 0xe7, 
+  0x8c, 0x5d, 0xef, 0xaf, 0x5d, 0xef, 0xbb, 0x3d, 0xef, 0xd7, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x81, 0x3d, 0xef, 0xff, 0x81, 0x5d, 0xef, 
+  0xff, 0x02, 0xbb, 0xde, 0xff, 0x59, 0xce, 0xff, 0xdb, 0xde, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x04, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xba, 0xd6, 0xff, 0x82, 
+  0xbb, 0xde, 0xff, 0x00, 0xba, 0xd6, 0xff, 0x82, 0x9a, 0xd6, 0xff, 0x04, 0x59, 0xce, 0xff, 0xf8, 0xc5, 0xff, 0xb7, 0xbd, 0xd8, 0xf7, 0xbd, 0x13, 0x18, 0xc6, 0x04, 0x94, 0x00, 0x00, 0x00, 0x0c, 
+  0x9a, 0xd6, 0x13, 0xdb, 0xde, 0x20, 0xdb, 0xde, 0x28, 0xba, 0xd6, 0x33, 0xfb, 0xde, 0x40, 0xdb, 0xde, 0x47, 0xfb, 0xde, 0x4c, 0xfb, 0xde, 0x57, 0x1c, 0xe7, 0x74, 0x5d, 0xef, 0xb4, 0x5d, 0xef, 
+  0xc7, 0x7d, 0xef, 0xc8, 0x5d, 0xef, 0xe0, 0x81, 0x3c, 0xe7, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0xfc, 0xe6, 0xff, 0x82, 0x1c, 0xe7, 0xff, 0x05, 0x7a, 0xd6, 0xff, 0x18, 0xc6, 0xff, 0x39, 0xce, 
+  0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x81, 0xfb, 0xde, 0xff, 0x04, 0xdb, 0xde, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x81, 0x9a, 
+  0xd6, 0xff, 0x81, 0x79, 0xce, 0xff, 0x04, 0x59, 0xce, 0xff, 0xf8, 0xc5, 0xe3, 0xf7, 0xbd, 0x3b, 0xdb, 0xde, 0x07, 0x9e, 0xf7, 0x03, 0x94, 0x00, 0x00, 0x00, 0x04, 0xdb, 0xde, 0x17, 0xdb, 0xde, 
+  0x2f, 0xdb, 0xde, 0x34, 0xdb, 0xde, 0x3f, 0xdb, 0xde, 0x40, 0x81, 0xdb, 0xde, 0x37, 0x0a, 0xdb, 0xde, 0x44, 0xfb, 0xde, 0x5b, 0x3c, 0xe7, 0x9b, 0x5d, 0xef, 0xac, 0x5d, 0xef, 0xb8, 0x5d, 0xef, 
+  0xbf, 0x3d, 0xef, 0xdb, 0xfc, 0xe6, 0xfc, 0xfc, 0xe6, 0xff, 0xbb, 0xde, 0xff, 0xba, 0xd6, 0xff, 0x81, 0xdb, 0xde, 0xff, 0x05, 0xbb, 0xde, 0xff, 0x79, 0xce, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 
+  0xff, 0x39, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x81, 0x59, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x0c, 0x59, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x7a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x59, 
+  0xce, 0xff, 0x39, 0xce, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xe0, 0x59, 0xce, 0x54, 0xbb, 0xde, 0x0c, 0x7a, 0xd6, 0x04, 0xff, 0xff, 0x03, 0x94, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0xde, 0x0f, 0xdb, 
+  0xde, 0x27, 0xbb, 0xde, 0x34, 0xdb, 0xde, 0x47, 0xfb, 0xde, 0x54, 0xdb, 0xde, 0x4b, 0xbb, 0xde, 0x3c, 0xdb, 0xde, 0x38, 0xfb, 0xde, 0x54, 0x1c, 0xe7, 0x73, 0x1c, 0xe7, 0x83, 0x3c, 0xe7, 0x98, 
+  0x3c, 0xe7, 0xa4, 0x5d, 0xef, 0xab, 0x1c, 0xe7, 0xab, 0x7a, 0xd6, 0xef, 0x81, 0x79, 0xce, 0xff, 0x04, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0x38, 0xc6, 0xff, 
+  0x81, 0x18, 0xc6, 0xff, 0x00, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x02, 0x39, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x08, 0x59, 0xce, 0xff, 0x39, 0xce, 
+  0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xbc, 0xba, 0xd6, 0x38, 0xdb, 0xde, 0x27, 0x9a, 0xd6, 0x13, 0x7d, 0xef, 0x03, 0x95, 0x00, 0x00, 0x00, 0x12, 0xbb, 0xde, 0x07, 0x9a, 0xd6, 
+  0x14, 0xba, 0xd6, 0x1b, 0xdb, 0xde, 0x2f, 0xfb, 0xde, 0x48, 0xdb, 0xde, 0x53, 0xfb, 0xde, 0x47, 0xdb, 0xde, 0x37, 0xdb, 0xde, 0x38, 0xdb, 0xde, 0x44, 0xfc, 0xe6, 0x54, 0xfc, 0xe6, 0x70, 0x1c, 
+  0xe7, 0x88, 0x3c, 0xe7, 0x94, 0xfc, 0xe6, 0x70, 0x9a, 0xd6, 0x57, 0x38, 0xc6, 0xb0, 0x38, 0xc6, 0xf7, 0x59, 0xce, 0xff, 0x81, 0x7a, 0xd6, 0xff, 0x01, 0x59, 0xce, 0xff, 0x39, 0xce, 0xff, 0x81, 
+  0x18, 0xc6, 0xff, 0x00, 0xf8, 0xc5, 0xff, 0x81, 0xf7, 0xbd, 0xff, 0x0d, 0xf8, 0xc5, 0xff, 0x38, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xf7, 0xbd, 0xff, 0xd7, 0xbd, 
+  0xff, 0xb7, 0xbd, 0xec, 0xd7, 0xbd, 0x73, 0xdb, 0xde, 0x20, 0xfb, 0xde, 0x24, 0xdb, 0xde, 0x27, 0x9a, 0xd6, 0x1b, 0xba, 0xd6, 0x08, 0x96, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd6, 0x07, 0x81, 0xdb, 
+  0xde, 0x0b, 0x0e, 0xdb, 0xde, 0x14, 0xbb, 0xde, 0x34, 0xfb, 0xde, 0x38, 0xdb, 0xde, 0x38, 0xdb, 0xde, 0x27, 0xba, 0xd6, 0x18, 0x9a, 0xd6, 0x1b, 0xdb, 0xde, 0x33, 0xfb, 0xde, 0x57, 0x1c, 0xe7, 
+  0x77, 0x1c, 0xe7, 0x73, 0xbb, 0xde, 0x3b, 0xfb, 0xde, 0x27, 0x59, 0xce, 0x50, 0x39, 0xce, 0xbb, 0x81, 0x38, 0xc6, 0xff, 0x01, 0x18, 0xc6, 0xff, 0x38, 0xc6, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x00, 
+  0xf7, 0xbd, 0xff, 0x83, 0xd7, 0xbd, 0xff, 0x08, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xb7, 0xbd, 0xff, 0xb6, 0xb5, 0xe0, 0x96, 0xb5, 0x7b, 0xd7, 0xbd, 0x1c, 0x3c, 0xe7, 0x04, 0x7a, 0xd6, 0x14, 
+  0x9a, 0xd6, 0x1c, 0x81, 0xba, 0xd6, 0x10, 0x01, 0xdb, 0xde, 0x0f, 0xdb, 0xde, 0x04, 0x96, 0x00, 0x00, 0x00, 0x17, 0xbe, 0xf7, 0x03, 0x79, 0xce, 0x04, 0x18, 0xc6, 0x03, 0xba, 0xd6, 0x04, 0x39, 
+  0xce, 0x10, 0xdb, 0xde, 0x1b, 0xfb, 0xde, 0x1c, 0x9a, 0xd6, 0x0b, 0xfc, 0xe6, 0x07, 0x9a, 0xd6, 0x0f, 0xfb, 0xde, 0x24, 0xfb, 0xde, 0x3f, 0xdb, 0xde, 0x48, 0xdb, 0xde, 0x3b, 0xba, 0xd6, 0x1b, 
+  0x79, 0xce, 0x14, 0x1c, 0xe7, 0x08, 0x39, 0xce, 0x34, 0x18, 0xc6, 0x88, 0xf8, 0xc5, 0xd3, 0x18, 0xc6, 0xe8, 0x18, 0xc6, 0xf4, 0x18, 0xc6, 0xfc, 0xf7, 0xbd, 0xff, 0x81, 0xb7, 0xbd, 0xff, 0x05, 
+  0xb7, 0xbd, 0xf8, 0xb7, 0xbd, 0xef, 0xb7, 0xbd, 0xe3, 0xb7, 0xbd, 0xac, 0xb7, 0xbd, 0x5b, 0x5d, 0xef, 0x03, 0x81, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xff, 0x03, 0x1c, 0xe7, 0x07, 0x9a, 0xd6, 0x0f, 
+  0xba, 0xd6, 0x07, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x04, 0xbb, 0xde, 0x07, 0x3d, 0xef, 0x03, 0x96, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0x03, 0x19, 0x3d, 0xef, 0x03, 0x79, 0xce, 0x07, 0xdb, 0xde, 
+  0x07, 0x59, 0xce, 0x04, 0x18, 0xc6, 0x04, 0xdb, 0xde, 0x04, 0xfb, 0xde, 0x0b, 0x9a, 0xd6, 0x18, 0x9a, 0xd6, 0x1c, 0xdb, 0xde, 0x2b, 0xbb, 0xde, 0x23, 0xdb, 0xde, 0x10, 0xbb, 0xde, 0x07, 0xff, 
+  0xff, 0x03, 0xdb, 0xde, 0x07, 0x9a, 0xd6, 0x13, 0x38, 0xc6, 0x28, 0x59, 0xce, 0x3f, 0x59, 0xce, 0x48, 0x59, 0xce, 0x50, 0x18, 0xc6, 0x4b, 0xd7, 0xbd, 0x34, 0xb6, 0xb5, 0x2b, 0xb6, 0xb5, 0x20, 
+  0x18, 0xc6, 0x14, 0x9e, 0xf7, 0x04, 0x81, 0x3d, 0xef, 0x03, 0x83, 0x00, 0x00, 0x00, 0x01, 0x9e, 0xf7, 0x03, 0xff, 0xff, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x03, 0x98, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x03, 0x04, 0x39, 0xce, 0x04, 0x18, 0xc6, 0x04, 0xff, 0xff, 0x03, 0x7a, 0xd6, 0x03, 0x9a, 0xd6, 0x07, 0x81, 0xfc, 0xe6, 0x07, 
+  0x07, 0x7a, 0xd6, 0x13, 0xdb, 0xde, 0x24, 0xba, 0xd6, 0x1c, 0xfc, 0xe6, 0x07, 0x3c, 0xe7, 0x03, 0x00, 0x00, 0x00, 0x59, 0xce, 0x03, 0xfc, 0xe6, 0x07, 0x82, 0xfb, 0xde, 0x0b, 0x02, 0xba, 0xd6, 
+  0x0f, 0xdb, 0xde, 0x08, 0x59, 0xce, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0xba, 0xd6, 0x04, 0x9a, 0xd6, 0x03, 0xa6, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0x03, 0x18, 0xc6, 0x04, 
+  0xff, 0xff, 0x03, 0x1c, 0xe7, 0x03, 0xf7, 0xbd, 0x04, 0xbe, 0xf7, 0x03, 0x9a, 0xd6, 0x04, 0x9a, 0xd6, 0x08, 0x9a, 0xd6, 0x14, 0xdb, 0xde, 0x0c, 0x7e, 0xf7, 0x03, 0x81, 0x00, 0x00, 0x00, 0x06, 
+  0x1c, 0xe7, 0x03, 0xbb, 0xde, 0x03, 0x3d, 0xef, 0x03, 0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x03, 0x18, 0xc6, 0x04, 0xff, 0xff, 0x03, 0xab, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0x03, 0x05, 0x00, 0x00, 
+  0x00, 0x59, 0xce, 0x03, 0xdf, 0xff, 0x03, 0xfc, 0xe6, 0x07, 0xfb, 0xde, 0x07, 0x7d, 0xef, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x01, 0x1c, 0xe7, 0x03, 
+  0x7e, 0xf7, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xb7, 0x0f, 0xbd, 0xd7, 0x4c, 0xbd, 0xd7, 0x7f, 0xbd, 0xf7, 0xa7, 0xbd, 0xd7, 0xc0, 0xbd, 0xd7, 0xcb, 0xbd, 0xd7, 0xb8, 0xbd, 0xd7, 0x9b, 0xbd, 0xd7, 0x6f, 0xbd, 0xd7, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf8, 0x14, 0xc5, 0xf8, 0x5c, 0xc5, 0xf8, 0xb7, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xeb, 0xbd, 0xd7, 0x9b, 0xbd, 0xb7, 0x33, 0xb5, 0xb6, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x76, 0x07, 0xc5, 0xf8, 0x80, 0xc5, 0xf8, 0xeb, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xf8, 0xbd, 0xd7, 0xd3, 0xbd, 0xb7, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xd7, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xab, 0xb5, 0xb6, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x00, 0xc6, 0x18, 0x87, 0xc6, 0x18, 0xf8, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xf0, 0xb5, 0xb6, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x0f, 0xc6, 0x18, 0x9f, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xfb, 0xb5, 0xb6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x00, 0xc6, 0x18, 0x9f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xfb, 0xb5, 0xb6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x87, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xf7, 0xb5, 0x96, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xf8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xd8, 0xb5, 0xb6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb6, 0x07, 0xc6, 0x18, 0xd7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x80, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf3, 0xb5, 0x96, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x14, 0xc6, 0x18, 0xeb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x5c, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xb7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x0f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xcb, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x38, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xe4, 0xb5, 0x96, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x18, 0x7f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xf0, 0xb5, 0x96, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x03, 0xce, 0x79, 0x04, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xa7, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xfb, 0xb5, 0x96, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x18, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x2c, 0xc6, 0x38, 0xcb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0x03, 0xd6, 0x9a, 0x07, 0xce, 0x59, 0x04, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x1f, 0xde, 0xfb, 0x53, 0xe7, 0x1c, 0x68, 0xd6, 0x7a, 0xe0, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x38, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x0c, 0xce, 0x79, 0x13, 0xd6, 0x7a, 0x13, 0xce, 0x59, 0x0f, 0xde, 0xdb, 0x24, 0xe6, 0xfc, 0x53, 0xe7, 0x1c, 0x84, 0xde, 0xbb, 0xe3, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xde, 0xbb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x38, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xbd, 0xd7, 0x34, 0xbd, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x1b, 0xde, 0xbb, 0x20, 0xd6, 0x7a, 0x1b, 0xde, 0xdb, 0x20, 0xde, 0xdb, 0x37, 0xe6, 0xfc, 0x5f, 0xe7, 0x1c, 0x83, 0xde, 0xbb, 0xd4, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0x96, 0xf8, 0xb5, 0x96, 0x2b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x27, 0xde, 0xdb, 0x3c, 0xde, 0xbb, 0x20, 0xde, 0xdb, 0x20, 0xde, 0xdb, 0x38, 0xde, 0xfb, 0x57, 0xe6, 0xfc, 0x5c, 0xd6, 0xba, 0xaf, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0x96, 0xec, 0xb5, 0x96, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x14, 0xde, 0xdb, 0x37, 0xde, 0xbb, 0x2c, 0xde, 0xdb, 0x23, 0xde, 0xdb, 0x2c, 0xde, 0xdb, 0x44, 0xde, 0xfb, 0x4c, 0xd6, 0x7a, 0x73, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0x96, 0xe0, 0xb5, 0x96, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0x03, 0xde, 0xdb, 0x10, 0xd6, 0x9a, 0x1b, 0xd6, 0xba, 0x1f, 0xde, 0xbb, 0x23, 0xde, 0xdb, 0x44, 0xde, 0xdb, 0x57, 0xde, 0xdb, 0x3f, 0xce, 0x39, 0xf0, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x7a, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xb7, 0xb0, 0xf7, 0x9e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x79, 0x03, 0xe7, 0x1c, 0x07, 0xd6, 0x9a, 0x0c, 0xd6, 0x9a, 0x14, 0xde, 0xdb, 0x23, 0xd6, 0xba, 0x30, 0xe7, 0x1c, 0x2f, 0xc6, 0x38, 0xaf, 0xc6, 0x38, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xfb, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0x7f, 0xd6, 0xba, 0x1b, 0xd6, 0xba, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x39, 0x04, 0xe7, 0x1c, 0x07, 0xde, 0xbb, 0x0c, 0xd6, 0xba, 0x13, 0xd6, 0x9a, 0x18, 0xd6, 0xba, 0x1c, 0xce, 0x59, 0x4b, 0xc6, 0x18, 0xf8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xec, 0xe6, 0xfc, 0x58, 0xde, 0xdb, 0x3f, 0xd6, 0x9a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x03, 0xd6, 0xba, 0x07, 0xe6, 0xfc, 0x08, 0xde, 0xbb, 0x0b, 0xde, 0xbb, 0x10, 0xd6, 0xba, 0x13, 0xd6, 0x9a, 0x18, 0xd6, 0x9a, 0x1c, 0xd6, 0x9a, 0x2c, 0xc6, 0x18, 0xd8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xc6, 0x18, 0x93, 0xe6, 0xfc, 0x33, 0xde, 0xdb, 0x3b, 0xde, 0xdb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x03, 0xd6, 0x9a, 0x08, 0xce, 0x79, 0x14, 0xd6, 0x9a, 0x17, 0xce, 0x79, 0x18, 0xd6, 0x9a, 0x1b, 0xde, 0xbb, 0x1f, 0xde, 0xbb, 0x1f, 0xe6, 0xfc, 0x23, 0xc6, 0x38, 0x77, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xef, 0xc6, 0x18, 0x2c, 0xde, 0xdb, 0x14, 0xde, 0xfb, 0x14, 0xde, 0xbb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x03, 0xde, 0xfb, 0x08, 0xd6, 0x9a, 0x18, 0xde, 0xdb, 0x28, 0xde, 0xdb, 0x2c, 0xde, 0xfb, 0x2b, 0xde, 0xfb, 0x28, 0xde, 0xdb, 0x2b, 0xde, 0xbb, 0x34, 0xde, 0xfb, 0x3c, 0xce, 0x59, 0xc8, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0x6b, 0xff, 0xff, 0x04, 0xe7, 0x1c, 0x08, 0xd6, 0xba, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x08, 0xd6, 0x9a, 0x14, 0xde, 0xdb, 0x24, 0xde, 0xdb, 0x3b, 0xe6, 0xfc, 0x63, 0xe6, 0xfc, 0x5b, 0xde, 0xdb, 0x4c, 0xde, 0xdb, 0x4c, 0xe6, 0xfc, 0x67, 0xe7, 0x1c, 0x7b, 0xe7, 0x1c, 0xa3, 0xde, 0xdb, 0xf8, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x38, 0xff, 0xbd, 0xf7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xaf, 0xd6, 0x7a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x03, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x0c, 0xd6, 0x7a, 0x1b, 0xde, 0xdb, 0x20, 0xd6, 0xba, 0x2f, 0xe6, 0xfc, 0x60, 0xe6, 0xfc, 0x68, 0xe6, 0xfc, 0x63, 0xde, 0xfb, 0x64, 0xe7, 0x1c, 0x8c, 0xef, 0x5d, 0xaf, 0xef, 0x5d, 0xbb, 0xef, 0x3d, 0xd7, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xbb, 0xff, 0xce, 0x59, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xb7, 0xd8, 0xbd, 0xf7, 0x13, 0xc6, 0x18, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9a, 0x13, 0xde, 0xdb, 0x20, 0xde, 0xdb, 0x28, 0xd6, 0xba, 0x33, 0xde, 0xfb, 0x40, 0xde, 0xdb, 0x47, 0xde, 0xfb, 0x4c, 0xde, 0xfb, 0x57, 0xe7, 0x1c, 0x74, 0xef, 0x5d, 0xb4, 0xef, 0x5d, 0xc7, 0xef, 0x7d, 0xc8, 0xef, 0x5d, 0xe0, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xfb, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc5, 0xf8, 0xe3, 0xbd, 0xf7, 0x3b, 0xde, 0xdb, 0x07, 0xf7, 0x9e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x17, 0xde, 0xdb, 0x2f, 0xde, 0xdb, 0x34, 0xde, 0xdb, 0x3f, 0xde, 0xdb, 0x40, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x44, 0xde, 0xfb, 0x5b, 0xe7, 0x3c, 0x9b, 0xef, 0x5d, 0xac, 0xef, 0x5d, 0xb8, 0xef, 0x5d, 0xbf, 0xef, 0x3d, 0xdb, 0xe6, 0xfc, 0xfc, 0xe6, 0xfc, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xce, 0x39, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0xd6, 0x7a, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xe0, 0xce, 0x59, 0x54, 0xde, 0xbb, 0x0c, 0xd6, 0x7a, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x0f, 0xde, 0xdb, 0x27, 0xde, 0xbb, 0x34, 0xde, 0xdb, 0x47, 0xde, 0xfb, 0x54, 0xde, 0xdb, 0x4b, 0xde, 0xbb, 0x3c, 0xde, 0xdb, 0x38, 0xde, 0xfb, 0x54, 0xe7, 0x1c, 0x73, 0xe7, 0x1c, 0x83, 0xe7, 0x3c, 0x98, 0xe7, 0x3c, 0xa4, 0xef, 0x5d, 0xab, 0xe7, 0x1c, 0xab, 0xd6, 0x7a, 0xef, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xbc, 0xd6, 0xba, 0x38, 0xde, 0xdb, 0x27, 0xd6, 0x9a, 0x13, 0xef, 0x7d, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x07, 0xd6, 0x9a, 0x14, 0xd6, 0xba, 0x1b, 0xde, 0xdb, 0x2f, 0xde, 0xfb, 0x48, 0xde, 0xdb, 0x53, 0xde, 0xfb, 0x47, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x38, 0xde, 0xdb, 0x44, 0xe6, 0xfc, 0x54, 0xe6, 0xfc, 0x70, 0xe7, 0x1c, 0x88, 0xe7, 0x3c, 0x94, 0xe6, 0xfc, 0x70, 0xd6, 0x9a, 0x57, 0xc6, 0x38, 0xb0, 0xc6, 0x38, 0xf7, 0xce, 0x59, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xf7, 0xff, 0xc5, 0xf8, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xec, 0xbd, 0xd7, 0x73, 0xde, 0xdb, 0x20, 0xde, 0xfb, 0x24, 0xde, 0xdb, 0x27, 0xd6, 0x9a, 0x1b, 0xd6, 0xba, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xba, 0x07, 0xde, 0xdb, 0x0b, 0xde, 0xdb, 0x0b, 0xde, 0xdb, 0x14, 0xde, 0xbb, 0x34, 0xde, 0xfb, 0x38, 0xde, 0xdb, 0x38, 0xde, 0xdb, 0x27, 0xd6, 0xba, 0x18, 0xd6, 0x9a, 0x1b, 0xde, 0xdb, 0x33, 0xde, 0xfb, 0x57, 0xe7, 0x1c, 0x77, 0xe7, 0x1c, 0x73, 0xde, 0xbb, 0x3b, 0xde, 0xfb, 0x27, 0xce, 0x59, 0x50, 0xce, 0x39, 0xbb, 0xc6, 0x38, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xe0, 0xb5, 0x96, 0x7b, 0xbd, 0xd7, 0x1c, 0xe7, 0x3c, 0x04, 0xd6, 0x7a, 0x14, 0xd6, 0x9a, 0x1c, 0xd6, 0xba, 0x10, 0xd6, 0xba, 0x10, 0xde, 0xdb, 0x0f, 0xde, 0xdb, 0x04, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbe, 0x03, 0xce, 0x79, 0x04, 0xc6, 0x18, 0x03, 0xd6, 0xba, 0x04, 0xce, 0x39, 0x10, 0xde, 0xdb, 0x1b, 0xde, 0xfb, 0x1c, 0xd6, 0x9a, 0x0b, 0xe6, 0xfc, 0x07, 0xd6, 0x9a, 0x0f, 0xde, 0xfb, 0x24, 0xde, 0xfb, 0x3f, 0xde, 0xdb, 0x48, 0xde, 0xdb, 0x3b, 0xd6, 0xba, 0x1b, 0xce, 0x79, 0x14, 0xe7, 0x1c, 0x08, 0xce, 0x39, 0x34, 0xc6, 0x18, 0x88, 0xc5, 0xf8, 0xd3, 0xc6, 0x18, 0xe8, 0xc6, 0x18, 0xf4, 0xc6, 0x18, 0xfc, 0xbd, 0xf7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xf8, 0xbd, 0xb7, 0xef, 0xbd, 0xb7, 0xe3, 0xbd, 0xb7, 0xac, 0xbd, 0xb7, 0x5b, 0xef, 0x5d, 0x03, 0x00, 0x00, 0x00, 0xf7, 0xbe, 0x00, 0xff, 0xbf, 0x03, 0xe7, 0x1c, 0x07, 0xd6, 0x9a, 0x0f, 0xd6, 0xba, 0x07, 0xff, 0xff, 0x00, 0xde, 0xdb, 0x04, 0xde, 0xbb, 0x07, 0xef, 0x3d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xef, 0x3d, 0x03, 0xce, 0x79, 0x07, 0xde, 0xdb, 0x07, 0xce, 0x59, 0x04, 0xc6, 0x18, 0x04, 0xde, 0xdb, 0x04, 0xde, 0xfb, 0x0b, 0xd6, 0x9a, 0x18, 0xd6, 0x9a, 0x1c, 0xde, 0xdb, 0x2b, 0xde, 0xbb, 0x23, 0xde, 0xdb, 0x10, 0xde, 0xbb, 0x07, 0xff, 0xff, 0x03, 0xde, 0xdb, 0x07, 0xd6, 0x9a, 0x13, 0xc6, 0x38, 0x28, 0xce, 0x59, 0x3f, 0xce, 0x59, 0x48, 0xce, 0x59, 0x50, 0xc6, 0x18, 0x4b, 0xbd, 0xd7, 0x34, 0xb5, 0xb6, 0x2b, 0xb5, 0xb6, 0x20, 0xc6, 0x18, 0x14, 0xf7, 0x9e, 0x04, 0xef, 0x3d, 0x03, 0xef, 0x3d, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x1c, 0x00, 0xf7, 0x9e, 0x03, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xce, 0x39, 0x04, 0xc6, 0x18, 0x04, 0xff, 0xff, 0x03, 0xd6, 0x7a, 0x03, 0xd6, 0x9a, 0x07, 0xe6, 0xfc, 0x07, 0xe6, 0xfc, 0x07, 0xd6, 0x7a, 0x13, 0xde, 0xdb, 0x24, 0xd6, 0xba, 0x1c, 0xe6, 0xfc, 0x07, 0xe7, 0x3c, 0x03, 0xff, 0xff, 0x00, 0xce, 0x59, 0x03, 0xe6, 0xfc, 0x07, 0xde, 0xfb, 0x0b, 0xde, 0xfb, 0x0b, 0xde, 0xfb, 0x0b, 0xd6, 0xba, 0x0f, 0xde, 0xdb, 0x08, 0xce, 0x59, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0xba, 0x04, 0xd6, 0x9a, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xf7, 0x9e, 0x03, 0xc6, 0x18, 0x04, 0xff, 0xff, 0x03, 0xe7, 0x1c, 0x03, 0xbd, 0xf7, 0x04, 0xf7, 0xbe, 0x03, 0xd6, 0x9a, 0x04, 0xd6, 0x9a, 0x08, 0xd6, 0x9a, 0x14, 0xde, 0xdb, 0x0c, 0xf7, 0x7e, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x1c, 0x03, 0xde, 0xbb, 0x03, 0xef, 0x3d, 0x03, 0xe7, 0x3c, 0x03, 0xef, 0x5d, 0x03, 0xc6, 0x18, 0x04, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xce, 0x59, 0x03, 0xff, 0xdf, 0x03, 0xe6, 0xfc, 0x07, 0xde, 0xfb, 0x07, 0xef, 0x7d, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x00, 0xe7, 0x1c, 0x03, 0xf7, 0x7e, 0x03, 0xff, 0xdf, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 
+  0x09, 0xbd, 0xb7, 0x0f, 0xbd, 0xd7, 0x4c, 0xbd, 0xd7, 0x7f, 0xbd, 0xf7, 0xa7, 0xbd, 0xd7, 0xc0, 0xbd, 0xd7, 0xcb, 0xbd, 0xd7, 0xb8, 0xbd, 0xd7, 0x9b, 0xbd, 0xd7, 0x6f, 0xbd, 0xd7, 0x38, 0xb2, 
+  0x00, 0x00, 0x00, 0x03, 0xc5, 0xf8, 0x14, 0xc5, 0xf8, 0x5c, 0xc5, 0xf8, 0xb7, 0xbd, 0xf7, 0xff, 0x82, 0xc5, 0xf8, 0xff, 0x82, 0xbd, 0xf7, 0xff, 0x82, 0xbd, 0xd7, 0xff, 0x03, 0xbd, 0xd7, 0xeb, 
+  0xbd, 0xd7, 0x9b, 0xbd, 0xb7, 0x33, 0xb5, 0xb6, 0x0c, 0xac, 0x00, 0x00, 0x00, 0x02, 0xb5, 0x76, 0x07, 0xc5, 0xf8, 0x80, 0xc5, 0xf8, 0xeb, 0x86, 0xc6, 0x18, 0xff, 0x82, 0xc5, 0xf8, 0xff, 0x81, 
+  0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xd7, 0xf8, 0xbd, 0xd7, 0xd3, 0xbd, 0xb7, 0x57, 0xaa, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xd7, 0x83, 0xc6, 0x18, 0xff, 
+  0x82, 0xc6, 0x38, 0xff, 0x85, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x00, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xab, 0xb5, 0xb6, 0x23, 0xa7, 0x00, 
+  0x00, 0x00, 0x01, 0xc6, 0x18, 0x87, 0xc6, 0x18, 0xf8, 0x81, 0xc6, 0x18, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x85, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x83, 0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 
+  0xff, 0x81, 0xbd, 0xf7, 0xff, 0x03, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xf0, 0xb5, 0xb6, 0x4c, 0xa4, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 0x0f, 0xc6, 0x18, 0x9f, 0x81, 0xc6, 0x18, 
+  0xff, 0x00, 0xc6, 0x38, 0xff, 0x82, 0xce, 0x39, 0xff, 0x85, 0xce, 0x59, 0xff, 0x82, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x83, 0xc6, 0x18, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x03, 0xbd, 0xd7, 
+  0xff, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xfb, 0xb5, 0xb6, 0x5b, 0xa3, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 0x9f, 0xc6, 0x18, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x00, 0xce, 0x39, 0xff, 0x83, 0xce, 0x59, 
+  0xff, 0x02, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0x84, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x81, 0xc5, 0xf8, 0xff, 0x82, 
+  0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0xfb, 0xb5, 0xb6, 0x60, 0xa1, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x87, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x82, 0xce, 0x59, 0xff, 0x83, 
+  0xce, 0x79, 0xff, 0x83, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x39, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 
+  0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xbd, 0xb7, 0xf7, 0xb5, 0x96, 0x33, 0x9f, 0x00, 0x00, 0x00, 0x03, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xf8, 0xc6, 0x38, 0xff, 0xce, 0x39, 
+  0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x86, 0xd6, 0x9a, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 
+  0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xd8, 0xb5, 0xb6, 0x18, 0x9d, 0x00, 0x00, 
+  0x00, 0x03, 0xb5, 0xb6, 0x07, 0xc6, 0x18, 0xd7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x04, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 
+  0xce, 0x39, 0xff, 0xd6, 0x7a, 0xff, 0x85, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x82, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 
+  0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0x97, 0x9d, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x18, 0x80, 0xc6, 0x18, 0xff, 0x81, 0xce, 0x39, 
+  0xff, 0x04, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0x82, 0xce, 0x59, 0xff, 0x01, 0xc6, 0x38, 0xff, 0xd6, 0x9a, 0xff, 0x82, 0xd6, 0xba, 0xff, 
+  0x82, 0xd6, 0x9a, 0xff, 0x00, 0xd6, 0x7a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x01, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x38, 0xff, 0x02, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 
+  0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xf3, 0xb5, 0x96, 0x28, 0x9b, 0x00, 0x00, 0x00, 0x08, 0xc6, 0x18, 0x14, 0xc6, 0x18, 0xeb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 
+  0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xc6, 0x38, 0xff, 0x84, 0xce, 0x59, 0xff, 0x01, 0xce, 0x79, 0xff, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x81, 0xd6, 
+  0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0x82, 0xce, 0x59, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 
+  0x81, 0xbd, 0xd7, 0xff, 0x01, 0xbd, 0xb7, 0xff, 0xb5, 0x96, 0x9c, 0x9b, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x5c, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x04, 0xce, 0x79, 
+  0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x59, 0xff, 0x84, 0xce, 0x79, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x83, 0xd6, 0x9a, 
+  0xff, 0x03, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x01, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xb7, 
+  0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x1b, 0x9a, 0x00, 0x00, 0x00, 0x09, 0xc6, 0x18, 0xb7, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 
+  0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x00, 0xd6, 0xba, 
+  0xff, 0x83, 0xd6, 0x9a, 0xff, 0x0b, 0xd6, 0x7a, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 
+  0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0x70, 0x99, 0x00, 0x00, 0x00, 0x06, 0xbd, 0xf7, 0x0f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xce, 0x79, 
+  0xff, 0xd6, 0x7a, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x04, 0xce, 0x79, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0xff, 0x84, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 
+  0x00, 0xd6, 0xba, 0xff, 0x85, 0xd6, 0x9a, 0xff, 0x04, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xb5, 0xb6, 0xff, 
+  0xb5, 0x96, 0xcb, 0xad, 0x55, 0x03, 0x98, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x4c, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xd6, 0x9a, 0xff, 
+  0x01, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xfb, 0xff, 0x02, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xff, 0x83, 0xde, 0xdb, 0xff, 0x00, 0xde, 0xbb, 
+  0xff, 0x81, 0xd6, 0xba, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x01, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x03, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x38, 0xff, 0xc5, 0xf8, 
+  0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xe4, 0xb5, 0x96, 0x13, 0x98, 0x00, 0x00, 0x00, 0x02, 0xc6, 0x18, 0x7f, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xce, 0x59, 
+  0xff, 0x00, 0xd6, 0x7a, 0xff, 0x82, 0xd6, 0xba, 0xff, 0x03, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0x83, 0xe7, 0x1c, 0xff, 0x01, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 
+  0xff, 0x82, 0xde, 0xdb, 0xff, 0x82, 0xd6, 0xba, 0xff, 0x84, 0xde, 0xbb, 0xff, 0x03, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xb5, 
+  0xb6, 0xff, 0xb5, 0x96, 0xf0, 0xb5, 0x96, 0x20, 0x95, 0x00, 0x00, 0x00, 0x08, 0xde, 0xdb, 0x03, 0xce, 0x79, 0x04, 0x00, 0x00, 0x00, 0xc6, 0x18, 0xa7, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 
+  0x59, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0x82, 0xde, 0xbb, 0xff, 0x05, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x83, 
+  0xe7, 0x1c, 0xff, 0x00, 0xe6, 0xfc, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x81, 0xd6, 0xba, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x00, 0xde, 0xbb, 0xff, 0x81, 
+  0xde, 0xdb, 0xff, 0x02, 0xde, 0xbb, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xfb, 0xb5, 0x96, 0x2b, 0x95, 0x00, 0x00, 0x00, 0x05, 
+  0xd6, 0x9a, 0x18, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x2c, 0xc6, 0x38, 0xcb, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0x82, 0xde, 0xdb, 
+  0xff, 0x03, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x00, 0xef, 0x3d, 0xff, 0x83, 0xe7, 0x1c, 0xff, 0x00, 0xe6, 0xfc, 0xff, 0x81, 0xde, 
+  0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x02, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0x81, 0xe6, 0xfc, 0xff, 0x04, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x39, 0xff, 0xbd, 0xf7, 
+  0xff, 0xbd, 0xd7, 0xff, 0x81, 0xb5, 0xb6, 0xff, 0x00, 0xb5, 0x96, 0x30, 0x91, 0x00, 0x00, 0x00, 0x07, 0xe6, 0xfc, 0x03, 0xd6, 0x9a, 0x07, 0xce, 0x59, 0x04, 0x00, 0x00, 0x00, 0xde, 0xbb, 0x1f, 
+  0xde, 0xfb, 0x53, 0xe7, 0x1c, 0x68, 0xd6, 0x7a, 0xe0, 0x82, 0xce, 0x59, 0xff, 0x02, 0xce, 0x79, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xfb, 0xff, 0x04, 0xe6, 0xfc, 0xff, 0xe7, 
+  0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0x81, 0xf7, 0x7e, 0xff, 0x02, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x81, 0xe7, 0x1c, 
+  0xff, 0x00, 0xde, 0xfb, 0xff, 0x83, 0xde, 0xdb, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x08, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x38, 0xff, 0xbd, 0xf7, 0xff, 
+  0xbd, 0xb7, 0xff, 0xb5, 0x96, 0xff, 0xb5, 0x96, 0x33, 0x91, 0x00, 0x00, 0x00, 0x07, 0xd6, 0x9a, 0x0c, 0xce, 0x79, 0x13, 0xd6, 0x7a, 0x13, 0xce, 0x59, 0x0f, 0xde, 0xdb, 0x24, 0xe6, 0xfc, 0x53, 
+  0xe7, 0x1c, 0x84, 0xde, 0xbb, 0xe3, 0x81, 0xd6, 0xba, 0xff, 0x03, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 0xff, 0xde, 0xbb, 0xff, 0xe6, 0xfc, 0xff, 0x82, 0xe7, 0x1c, 0xff, 0x00, 0xe7, 0x3c, 0xff, 0x81, 
+  0xef, 0x3d, 0xff, 0x00, 0xef, 0x5d, 0xff, 0x82, 0xf7, 0x7e, 0xff, 0x81, 0xef, 0x7d, 0xff, 0x01, 0xef, 0x5d, 0xff, 0xe7, 0x3c, 0xff, 0x84, 0xe7, 0x1c, 0xff, 0x00, 0xde, 0xfb, 0xff, 0x81, 0xde, 
+  0xdb, 0xff, 0x0a, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x7a, 0xff, 0xc6, 0x38, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0xb6, 0xff, 0xbd, 0xd7, 
+  0x34, 0xbd, 0xb7, 0x03, 0x90, 0x00, 0x00, 0x00, 0x07, 0xde, 0xbb, 0x1b, 0xde, 0xbb, 0x20, 0xd6, 0x7a, 0x1b, 0xde, 0xdb, 0x20, 0xde, 0xdb, 0x37, 0xe6, 0xfc, 0x5f, 0xe7, 0x1c, 0x83, 0xde, 0xbb, 
+  0xd4, 0x82, 0xde, 0xdb, 0xff, 0x02, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x81, 0xef, 0x3d, 0xff, 0x82, 0xef, 0x5d, 0xff, 0x00, 0xef, 0x7d, 0xff, 0x83, 
+  0xf7, 0x7e, 0xff, 0x02, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x84, 0xe7, 0x1c, 0xff, 0x82, 0xde, 0xdb, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x06, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 
+  0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0x96, 0xf8, 0xb5, 0x96, 0x2b, 0x91, 0x00, 0x00, 0x00, 0x09, 0xd6, 0x9a, 0x27, 0xde, 0xdb, 0x3c, 0xde, 0xbb, 0x20, 0xde, 0xdb, 0x20, 
+  0xde, 0xdb, 0x38, 0xde, 0xfb, 0x57, 0xe6, 0xfc, 0x5c, 0xd6, 0xba, 0xaf, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0x82, 0xde, 0xfb, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x84, 0xef, 
+  0x5d, 0xff, 0x00, 0xef, 0x7d, 0xff, 0x83, 0xf7, 0x7e, 0xff, 0x01, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0x81, 0xef, 0x3d, 0xff, 0x83, 0xe7, 0x1c, 0xff, 0x03, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 
+  0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xfb, 0xff, 0x05, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xce, 0x59, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0x96, 0xec, 0xb5, 0x96, 0x1c, 0x91, 0x00, 0x00, 
+  0x00, 0x09, 0xde, 0xdb, 0x14, 0xde, 0xdb, 0x37, 0xde, 0xbb, 0x2c, 0xde, 0xdb, 0x23, 0xde, 0xdb, 0x2c, 0xde, 0xdb, 0x44, 0xde, 0xfb, 0x4c, 0xd6, 0x7a, 0x73, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 
+  0x82, 0xde, 0xfb, 0xff, 0x02, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0x85, 0xef, 0x5d, 0xff, 0x82, 0xef, 0x7d, 0xff, 0x00, 0xf7, 0x7e, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x82, 0xef, 
+  0x3d, 0xff, 0x00, 0xe7, 0x3c, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x04, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x04, 0xd6, 
+  0xba, 0xff, 0xce, 0x59, 0xff, 0xbd, 0xd7, 0xff, 0xb5, 0x96, 0xe0, 0xb5, 0x96, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x0a, 0xe6, 0xfc, 0x03, 0xde, 0xdb, 0x10, 0xd6, 0x9a, 0x1b, 0xd6, 0xba, 0x1f, 0xde, 
+  0xbb, 0x23, 0xde, 0xdb, 0x44, 0xde, 0xdb, 0x57, 0xde, 0xdb, 0x3f, 0xce, 0x39, 0xf0, 0xd6, 0x9a, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x01, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0x87, 
+  0xef, 0x5d, 0xff, 0x82, 0xef, 0x7d, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x00, 0xe7, 0x3c, 0xff, 0x85, 0xe7, 0x1c, 0xff, 0x01, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x81, 0xd6, 
+  0x9a, 0xff, 0x04, 0xd6, 0xba, 0xff, 0xd6, 0x7a, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xb7, 0xb0, 0xf7, 0x9e, 0x03, 0x92, 0x00, 0x00, 0x00, 0x0e, 0xce, 0x79, 0x03, 0xe7, 0x1c, 0x07, 0xd6, 0x9a, 0x0c, 
+  0xd6, 0x9a, 0x14, 0xde, 0xdb, 0x23, 0xd6, 0xba, 0x30, 0xe7, 0x1c, 0x2f, 0xc6, 0x38, 0xaf, 0xc6, 0x38, 0xff, 0xce, 0x79, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 
+  0xff, 0xe7, 0x3c, 0xff, 0x88, 0xef, 0x5d, 0xff, 0x00, 0xef, 0x7d, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x01, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0x82, 0xe6, 0xfc, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x01, 
+  0xde, 0xfb, 0xff, 0xd6, 0xba, 0xff, 0x81, 0xce, 0x59, 0xff, 0x01, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0x81, 0xce, 0x79, 0xff, 0x03, 0xc6, 0x38, 0xff, 0xce, 0x39, 0x7f, 0xd6, 0xba, 0x1b, 0xd6, 
+  0xba, 0x04, 0x92, 0x00, 0x00, 0x00, 0x0d, 0xce, 0x39, 0x04, 0xe7, 0x1c, 0x07, 0xde, 0xbb, 0x0c, 0xd6, 0xba, 0x13, 0xd6, 0x9a, 0x18, 0xd6, 0xba, 0x1c, 0xce, 0x59, 0x4b, 0xc6, 0x18, 0xf8, 0xc6, 
+  0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x81, 0xef, 0x3d, 0xff, 0x00, 0xef, 0x5d, 0xff, 0x82, 0xef, 0x3d, 
+  0xff, 0x83, 0xef, 0x5d, 0xff, 0x02, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xfb, 0xff, 0x84, 0xde, 0xdb, 0xff, 0x02, 0xde, 0xbb, 0xff, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0x81, 0xc6, 0x18, 
+  0xff, 0x81, 0xc6, 0x38, 0xff, 0x03, 0xc6, 0x38, 0xec, 0xe6, 0xfc, 0x58, 0xde, 0xdb, 0x3f, 0xd6, 0x9a, 0x13, 0x90, 0x00, 0x00, 0x00, 0x0e, 0xef, 0x5d, 0x03, 0xd6, 0xba, 0x07, 0xe6, 0xfc, 0x08, 
+  0xde, 0xbb, 0x0b, 0xde, 0xbb, 0x10, 0xd6, 0xba, 0x13, 0xd6, 0x9a, 0x18, 0xd6, 0x9a, 0x1c, 0xd6, 0x9a, 0x2c, 0xc6, 0x18, 0xd8, 0xc6, 0x38, 0xff, 0xce, 0x39, 0xff, 0xce, 0x59, 0xff, 0xd6, 0xba, 
+  0xff, 0xde, 0xfb, 0xff, 0x83, 0xe7, 0x1c, 0xff, 0x83, 0xe7, 0x3c, 0xff, 0x00, 0xef, 0x3d, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x82, 0xe7, 0x1c, 0xff, 0x02, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0xd6, 
+  0xba, 0xff, 0x83, 0xd6, 0x9a, 0xff, 0x00, 0xce, 0x79, 0xff, 0x81, 0xce, 0x59, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x04, 0xbd, 0xd7, 0xff, 0xc6, 0x18, 0x93, 0xe6, 0xfc, 0x33, 
+  0xde, 0xdb, 0x3b, 0xde, 0xdb, 0x1b, 0x90, 0x00, 0x00, 0x00, 0x05, 0xef, 0x5d, 0x03, 0xd6, 0x9a, 0x08, 0xce, 0x79, 0x14, 0xd6, 0x9a, 0x17, 0xce, 0x79, 0x18, 0xd6, 0x9a, 0x1b, 0x81, 0xde, 0xbb, 
+  0x1f, 0x07, 0xe6, 0xfc, 0x23, 0xc6, 0x38, 0x77, 0xc6, 0x18, 0xff, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x01, 0xef, 
+  0x3d, 0xff, 0xe7, 0x3c, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x82, 0xe7, 0x3c, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x00, 0xe6, 0xfc, 0xff, 0x81, 0xde, 0xfb, 0xff, 0x01, 0xde, 0xdb, 0xff, 0xd6, 0xba, 0xff, 
+  0x81, 0xd6, 0x9a, 0xff, 0x0c, 0xd6, 0x7a, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xef, 
+  0xc6, 0x18, 0x2c, 0xde, 0xdb, 0x14, 0xde, 0xfb, 0x14, 0xde, 0xbb, 0x08, 0x90, 0x00, 0x00, 0x00, 0x10, 0xde, 0xdb, 0x03, 0xde, 0xfb, 0x08, 0xd6, 0x9a, 0x18, 0xde, 0xdb, 0x28, 0xde, 0xdb, 0x2c, 
+  0xde, 0xfb, 0x2b, 0xde, 0xfb, 0x28, 0xde, 0xdb, 0x2b, 0xde, 0xbb, 0x34, 0xde, 0xfb, 0x3c, 0xce, 0x59, 0xc8, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 
+  0xff, 0xe7, 0x3c, 0xff, 0x82, 0xef, 0x3d, 0xff, 0x85, 0xe7, 0x3c, 0xff, 0x01, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0x83, 0xde, 0xdb, 0xff, 0x0d, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x7a, 
+  0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0x6b, 0xff, 0xff, 0x04, 0xe7, 0x1c, 0x08, 0xd6, 
+  0xba, 0x07, 0x91, 0x00, 0x00, 0x00, 0x05, 0xd6, 0x9a, 0x08, 0xd6, 0x9a, 0x14, 0xde, 0xdb, 0x24, 0xde, 0xdb, 0x3b, 0xe6, 0xfc, 0x63, 0xe6, 0xfc, 0x5b, 0x81, 0xde, 0xdb, 0x4c, 0x04, 0xe6, 0xfc, 
+  0x67, 0xe7, 0x1c, 0x7b, 0xe7, 0x1c, 0xa3, 0xde, 0xdb, 0xf8, 0xe6, 0xfc, 0xff, 0x82, 0xe7, 0x1c, 0xff, 0x00, 0xe7, 0x3c, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x03, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 
+  0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x02, 0xe7, 0x1c, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xff, 0x81, 0xde, 0xbb, 0xff, 0x83, 0xd6, 0xba, 0xff, 
+  0x06, 0xd6, 0x9a, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x38, 0xff, 0xbd, 0xf7, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xaf, 0xd6, 0x7a, 0x04, 0x81, 0x00, 0x00, 0x00, 0x01, 0xef, 0x5d, 0x03, 0xff, 0xff, 
+  0x03, 0x90, 0x00, 0x00, 0x00, 0x10, 0xde, 0xdb, 0x0c, 0xd6, 0x7a, 0x1b, 0xde, 0xdb, 0x20, 0xd6, 0xba, 0x2f, 0xe6, 0xfc, 0x60, 0xe6, 0xfc, 0x68, 0xe6, 0xfc, 0x63, 0xde, 0xfb, 0x64, 0xe7, 0x1c, 
+  0x8c, 0xef, 0x5d, 0xaf, 0xef, 0x5d, 0xbb, 0xef, 0x3d, 0xd7, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0x81, 0xef, 0x3d, 0xff, 0x81, 0xef, 0x5d, 
+  0xff, 0x02, 0xde, 0xbb, 0xff, 0xce, 0x59, 0xff, 0xde, 0xdb, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x04, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xd6, 0xba, 0xff, 0x82, 
+  0xde, 0xbb, 0xff, 0x00, 0xd6, 0xba, 0xff, 0x82, 0xd6, 0x9a, 0xff, 0x04, 0xce, 0x59, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xb7, 0xd8, 0xbd, 0xf7, 0x13, 0xc6, 0x18, 0x04, 0x94, 0x00, 0x00, 0x00, 0x0c, 
+  0xd6, 0x9a, 0x13, 0xde, 0xdb, 0x20, 0xde, 0xdb, 0x28, 0xd6, 0xba, 0x33, 0xde, 0xfb, 0x40, 0xde, 0xdb, 0x47, 0xde, 0xfb, 0x4c, 0xde, 0xfb, 0x57, 0xe7, 0x1c, 0x74, 0xef, 0x5d, 0xb4, 0xef, 0x5d, 
+  0xc7, 0xef, 0x7d, 0xc8, 0xef, 0x5d, 0xe0, 0x81, 0xe7, 0x3c, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xe6, 0xfc, 0xff, 0x82, 0xe7, 0x1c, 0xff, 0x05, 0xd6, 0x7a, 0xff, 0xc6, 0x18, 0xff, 0xce, 0x39, 
+  0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xde, 0xfb, 0xff, 0x04, 0xde, 0xdb, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0x81, 0xd6, 
+  0x9a, 0xff, 0x81, 0xce, 0x79, 0xff, 0x04, 0xce, 0x59, 0xff, 0xc5, 0xf8, 0xe3, 0xbd, 0xf7, 0x3b, 0xde, 0xdb, 0x07, 0xf7, 0x9e, 0x03, 0x94, 0x00, 0x00, 0x00, 0x04, 0xde, 0xdb, 0x17, 0xde, 0xdb, 
+  0x2f, 0xde, 0xdb, 0x34, 0xde, 0xdb, 0x3f, 0xde, 0xdb, 0x40, 0x81, 0xde, 0xdb, 0x37, 0x0a, 0xde, 0xdb, 0x44, 0xde, 0xfb, 0x5b, 0xe7, 0x3c, 0x9b, 0xef, 0x5d, 0xac, 0xef, 0x5d, 0xb8, 0xef, 0x5d, 
+  0xbf, 0xef, 0x3d, 0xdb, 0xe6, 0xfc, 0xfc, 0xe6, 0xfc, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0xba, 0xff, 0x81, 0xde, 0xdb, 0xff, 0x05, 0xde, 0xbb, 0xff, 0xce, 0x79, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 
+  0xff, 0xce, 0x39, 0xff, 0xd6, 0x9a, 0xff, 0x81, 0xce, 0x59, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x0c, 0xce, 0x59, 0xff, 0xc6, 0x18, 0xff, 0xd6, 0x7a, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xce, 
+  0x59, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xe0, 0xce, 0x59, 0x54, 0xde, 0xbb, 0x0c, 0xd6, 0x7a, 0x04, 0xff, 0xff, 0x03, 0x94, 0x00, 0x00, 0x00, 0x0f, 0xde, 0xfb, 0x0f, 0xde, 
+  0xdb, 0x27, 0xde, 0xbb, 0x34, 0xde, 0xdb, 0x47, 0xde, 0xfb, 0x54, 0xde, 0xdb, 0x4b, 0xde, 0xbb, 0x3c, 0xde, 0xdb, 0x38, 0xde, 0xfb, 0x54, 0xe7, 0x1c, 0x73, 0xe7, 0x1c, 0x83, 0xe7, 0x3c, 0x98, 
+  0xe7, 0x3c, 0xa4, 0xef, 0x5d, 0xab, 0xe7, 0x1c, 0xab, 0xd6, 0x7a, 0xef, 0x81, 0xce, 0x79, 0xff, 0x04, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x38, 0xff, 
+  0x81, 0xc6, 0x18, 0xff, 0x00, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x02, 0xce, 0x39, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x08, 0xce, 0x59, 0xff, 0xce, 0x39, 
+  0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xbc, 0xd6, 0xba, 0x38, 0xde, 0xdb, 0x27, 0xd6, 0x9a, 0x13, 0xef, 0x7d, 0x03, 0x95, 0x00, 0x00, 0x00, 0x12, 0xde, 0xbb, 0x07, 0xd6, 0x9a, 
+  0x14, 0xd6, 0xba, 0x1b, 0xde, 0xdb, 0x2f, 0xde, 0xfb, 0x48, 0xde, 0xdb, 0x53, 0xde, 0xfb, 0x47, 0xde, 0xdb, 0x37, 0xde, 0xdb, 0x38, 0xde, 0xdb, 0x44, 0xe6, 0xfc, 0x54, 0xe6, 0xfc, 0x70, 0xe7, 
+  0x1c, 0x88, 0xe7, 0x3c, 0x94, 0xe6, 0xfc, 0x70, 0xd6, 0x9a, 0x57, 0xc6, 0x38, 0xb0, 0xc6, 0x38, 0xf7, 0xce, 0x59, 0xff, 0x81, 0xd6, 0x7a, 0xff, 0x01, 0xce, 0x59, 0xff, 0xce, 0x39, 0xff, 0x81, 
+  0xc6, 0x18, 0xff, 0x00, 0xc5, 0xf8, 0xff, 0x81, 0xbd, 0xf7, 0xff, 0x0d, 0xc5, 0xf8, 0xff, 0xc6, 0x38, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xf7, 0xff, 0xbd, 0xd7, 
+  0xff, 0xbd, 0xb7, 0xec, 0xbd, 0xd7, 0x73, 0xde, 0xdb, 0x20, 0xde, 0xfb, 0x24, 0xde, 0xdb, 0x27, 0xd6, 0x9a, 0x1b, 0xd6, 0xba, 0x08, 0x96, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xba, 0x07, 0x81, 0xde, 
+  0xdb, 0x0b, 0x0e, 0xde, 0xdb, 0x14, 0xde, 0xbb, 0x34, 0xde, 0xfb, 0x38, 0xde, 0xdb, 0x38, 0xde, 0xdb, 0x27, 0xd6, 0xba, 0x18, 0xd6, 0x9a, 0x1b, 0xde, 0xdb, 0x33, 0xde, 0xfb, 0x57, 0xe7, 0x1c, 
+  0x77, 0xe7, 0x1c, 0x73, 0xde, 0xbb, 0x3b, 0xde, 0xfb, 0x27, 0xce, 0x59, 0x50, 0xce, 0x39, 0xbb, 0x81, 0xc6, 0x38, 0xff, 0x01, 0xc6, 0x18, 0xff, 0xc6, 0x38, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x00, 
+  0xbd, 0xf7, 0xff, 0x83, 0xbd, 0xd7, 0xff, 0x08, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xb7, 0xff, 0xb5, 0xb6, 0xe0, 0xb5, 0x96, 0x7b, 0xbd, 0xd7, 0x1c, 0xe7, 0x3c, 0x04, 0xd6, 0x7a, 0x14, 
+  0xd6, 0x9a, 0x1c, 0x81, 0xd6, 0xba, 0x10, 0x01, 0xde, 0xdb, 0x0f, 0xde, 0xdb, 0x04, 0x96, 0x00, 0x00, 0x00, 0x17, 0xf7, 0xbe, 0x03, 0xce, 0x79, 0x04, 0xc6, 0x18, 0x03, 0xd6, 0xba, 0x04, 0xce, 
+  0x39, 0x10, 0xde, 0xdb, 0x1b, 0xde, 0xfb, 0x1c, 0xd6, 0x9a, 0x0b, 0xe6, 0xfc, 0x07, 0xd6, 0x9a, 0x0f, 0xde, 0xfb, 0x24, 0xde, 0xfb, 0x3f, 0xde, 0xdb, 0x48, 0xde, 0xdb, 0x3b, 0xd6, 0xba, 0x1b, 
+  0xce, 0x79, 0x14, 0xe7, 0x1c, 0x08, 0xce, 0x39, 0x34, 0xc6, 0x18, 0x88, 0xc5, 0xf8, 0xd3, 0xc6, 0x18, 0xe8, 0xc6, 0x18, 0xf4, 0xc6, 0x18, 0xfc, 0xbd, 0xf7, 0xff, 0x81, 0xbd, 0xb7, 0xff, 0x05, 
+  0xbd, 0xb7, 0xf8, 0xbd, 0xb7, 0xef, 0xbd, 0xb7, 0xe3, 0xbd, 0xb7, 0xac, 0xbd, 0xb7, 0x5b, 0xef, 0x5d, 0x03, 0x81, 0x00, 0x00, 0x00, 0x07, 0xff, 0xbf, 0x03, 0xe7, 0x1c, 0x07, 0xd6, 0x9a, 0x0f, 
+  0xd6, 0xba, 0x07, 0x00, 0x00, 0x00, 0xde, 0xdb, 0x04, 0xde, 0xbb, 0x07, 0xef, 0x3d, 0x03, 0x96, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0x03, 0x19, 0xef, 0x3d, 0x03, 0xce, 0x79, 0x07, 0xde, 0xdb, 
+  0x07, 0xce, 0x59, 0x04, 0xc6, 0x18, 0x04, 0xde, 0xdb, 0x04, 0xde, 0xfb, 0x0b, 0xd6, 0x9a, 0x18, 0xd6, 0x9a, 0x1c, 0xde, 0xdb, 0x2b, 0xde, 0xbb, 0x23, 0xde, 0xdb, 0x10, 0xde, 0xbb, 0x07, 0xff, 
+  0xff, 0x03, 0xde, 0xdb, 0x07, 0xd6, 0x9a, 0x13, 0xc6, 0x38, 0x28, 0xce, 0x59, 0x3f, 0xce, 0x59, 0x48, 0xce, 0x59, 0x50, 0xc6, 0x18, 0x4b, 0xbd, 0xd7, 0x34, 0xb5, 0xb6, 0x2b, 0xb5, 0xb6, 0x20, 
+  0xc6, 0x18, 0x14, 0xf7, 0x9e, 0x04, 0x81, 0xef, 0x3d, 0x03, 0x83, 0x00, 0x00, 0x00, 0x01, 0xf7, 0x9e, 0x03, 0xff, 0xff, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0xef, 0x5d, 0x03, 0x98, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x03, 0x04, 0xce, 0x39, 0x04, 0xc6, 0x18, 0x04, 0xff, 0xff, 0x03, 0xd6, 0x7a, 0x03, 0xd6, 0x9a, 0x07, 0x81, 0xe6, 0xfc, 0x07, 
+  0x07, 0xd6, 0x7a, 0x13, 0xde, 0xdb, 0x24, 0xd6, 0xba, 0x1c, 0xe6, 0xfc, 0x07, 0xe7, 0x3c, 0x03, 0x00, 0x00, 0x00, 0xce, 0x59, 0x03, 0xe6, 0xfc, 0x07, 0x82, 0xde, 0xfb, 0x0b, 0x02, 0xd6, 0xba, 
+  0x0f, 0xde, 0xdb, 0x08, 0xce, 0x59, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0xd6, 0xba, 0x04, 0xd6, 0x9a, 0x03, 0xa6, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x03, 0xf7, 0x9e, 0x03, 0xc6, 0x18, 0x04, 
+  0xff, 0xff, 0x03, 0xe7, 0x1c, 0x03, 0xbd, 0xf7, 0x04, 0xf7, 0xbe, 0x03, 0xd6, 0x9a, 0x04, 0xd6, 0x9a, 0x08, 0xd6, 0x9a, 0x14, 0xde, 0xdb, 0x0c, 0xf7, 0x7e, 0x03, 0x81, 0x00, 0x00, 0x00, 0x06, 
+  0xe7, 0x1c, 0x03, 0xde, 0xbb, 0x03, 0xef, 0x3d, 0x03, 0xe7, 0x3c, 0x03, 0xef, 0x5d, 0x03, 0xc6, 0x18, 0x04, 0xff, 0xff, 0x03, 0xab, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0x03, 0x05, 0x00, 0x00, 
+  0x00, 0xce, 0x59, 0x03, 0xff, 0xdf, 0x03, 0xe6, 0xfc, 0x07, 0xde, 0xfb, 0x07, 0xef, 0x7d, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x01, 0xe7, 0x1c, 0x03, 
+  0xf7, 0x7e, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x0f, 0xba, 0xba, 0xba, 0x4c, 0xba, 0xba, 0xba, 0x7f, 0xbb, 0xbb, 0xbb, 0xa7, 0xba, 0xba, 0xba, 0xc0, 0xba, 0xba, 0xba, 0xcb, 0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0x9b, 0xb7, 0xb7, 0xb7, 0x6f, 0xb8, 0xb8, 0xb8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbd, 0xbd, 0x14, 0xbd, 0xbd, 0xbd, 0x5c, 0xbd, 0xbd, 0xbd, 0xb7, 0xbc, 0xbc, 0xbc, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xeb, 0xb7, 0xb7, 0xb7, 0x9b, 0xb6, 0xb6, 0xb6, 0x33, 0xb3, 0xb3, 0xb3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xae, 0xae, 0x07, 0xbe, 0xbe, 0xbe, 0x80, 0xbe, 0xbe, 0xbe, 0xeb, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xf8, 0xb7, 0xb7, 0xb7, 0xd3, 0xb6, 0xb6, 0xb6, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x4c, 0xbf, 0xbf, 0xbf, 0xd7, 0xbf, 0xbf, 0xbf, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xab, 0xb3, 0xb3, 0xb3, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0xe7, 0x00, 0xbf, 0xbf, 0xbf, 0x87, 0xbf, 0xbf, 0xbf, 0xf8, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xf0, 0xb4, 0xb4, 0xb4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x0f, 0xbf, 0xbf, 0xbf, 0x9f, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xfb, 0xb4, 0xb4, 0xb4, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0xe8, 0x00, 0xbf, 0xbf, 0xbf, 0x9f, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xfb, 0xb3, 0xb3, 0xb3, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x87, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xf7, 0xb2, 0xb2, 0xb2, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x4c, 0xc1, 0xc1, 0xc1, 0xf8, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xd8, 0xb4, 0xb4, 0xb4, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x07, 0xc1, 0xc1, 0xc1, 0xd7, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0x80, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xf3, 0xb0, 0xb0, 0xb0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x14, 0xc1, 0xc1, 0xc1, 0xeb, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb1, 0xb1, 0xb1, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x5c, 0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0xb7, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xbb, 0x0f, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xcb, 0xa8, 0xa8, 0xa8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x4c, 0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xe4, 0xaf, 0xaf, 0xaf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0x7f, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xf0, 0xaf, 0xaf, 0xaf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xd8, 0x03, 0xcb, 0xcb, 0xcb, 0x04, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xa7, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xfb, 0xb1, 0xb1, 0xb1, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd1, 0x18, 0xd8, 0xd8, 0xd8, 0x37, 0xd9, 0xd9, 0xd9, 0x2c, 0xc3, 0xc3, 0xc3, 0xcb, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xda, 0xda, 0xda, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xea, 0xea, 0xea, 0xff, 0xec, 0xec, 0xec, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xda, 0xda, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xde, 0xde, 0x03, 0xd2, 0xd2, 0xd2, 0x07, 0xc9, 0xc9, 0xc9, 0x04, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xd5, 0xd5, 0x1f, 0xdc, 0xdc, 0xdc, 0x53, 0xdf, 0xdf, 0xdf, 0x68, 0xcd, 0xcd, 0xcd, 0xe0, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xed, 0xed, 0xed, 0xff, 0xed, 0xed, 0xed, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x0c, 0xcb, 0xcb, 0xcb, 0x13, 0xcd, 0xcd, 0xcd, 0x13, 0xca, 0xca, 0xca, 0x0f, 0xd7, 0xd7, 0xd7, 0x24, 0xdd, 0xdd, 0xdd, 0x53, 0xe0, 0xe0, 0xe0, 0x84, 0xd6, 0xd6, 0xd6, 0xe3, 0xd3, 0xd3, 0xd3, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xea, 0xea, 0xea, 0xff, 0xed, 0xed, 0xed, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xec, 0xec, 0xec, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb7, 0xb7, 0xb7, 0x34, 0xb6, 0xb6, 0xb6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xd5, 0xd5, 0x1b, 0xd5, 0xd5, 0xd5, 0x20, 0xcd, 0xcd, 0xcd, 0x1b, 0xd8, 0xd8, 0xd8, 0x20, 0xd7, 0xd7, 0xd7, 0x37, 0xde, 0xde, 0xde, 0x5f, 0xe1, 0xe1, 0xe1, 0x83, 0xd6, 0xd6, 0xd6, 0xd4, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xea, 0xea, 0xea, 0xff, 0xec, 0xec, 0xec, 0xff, 0xee, 0xee, 0xee, 0xff, 0xee, 0xee, 0xee, 0xff, 0xed, 0xed, 0xed, 0xff, 0xed, 0xed, 0xed, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb1, 0xb1, 0xb1, 0xf8, 0xb2, 0xb2, 0xb2, 0x2b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd2, 0xd2, 0x27, 0xd9, 0xd9, 0xd9, 0x3c, 0xd6, 0xd6, 0xd6, 0x20, 0xd9, 0xd9, 0xd9, 0x20, 0xd7, 0xd7, 0xd7, 0x38, 0xdc, 0xdc, 0xdc, 0x57, 0xde, 0xde, 0xde, 0x5c, 0xd3, 0xd3, 0xd3, 0xaf, 0xd9, 0xd9, 0xd9, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xea, 0xea, 0xea, 0xff, 0xec, 0xec, 0xec, 0xff, 0xed, 0xed, 0xed, 0xff, 0xed, 0xed, 0xed, 0xff, 0xed, 0xed, 0xed, 0xff, 0xee, 0xee, 0xee, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb1, 0xb1, 0xb1, 0xec, 0xaf, 0xaf, 0xaf, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xd9, 0xd9, 0x14, 0xd7, 0xd7, 0xd7, 0x37, 0xd6, 0xd6, 0xd6, 0x2c, 0xda, 0xda, 0xda, 0x23, 0xda, 0xda, 0xda, 0x2c, 0xd8, 0xd8, 0xd8, 0x44, 0xdc, 0xdc, 0xdc, 0x4c, 0xce, 0xce, 0xce, 0x73, 0xcf, 0xcf, 0xcf, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xea, 0xea, 0xea, 0xff, 0xec, 0xec, 0xec, 0xff, 0xec, 0xec, 0xec, 0xff, 0xec, 0xec, 0xec, 0xff, 0xed, 0xed, 0xed, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb1, 0xb1, 0xb1, 0xe0, 0xb0, 0xb0, 0xb0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0xdd, 0x03, 0xda, 0xda, 0xda, 0x10, 0xd1, 0xd1, 0xd1, 0x1b, 0xd3, 0xd3, 0xd3, 0x1f, 0xd5, 0xd5, 0xd5, 0x23, 0xda, 0xda, 0xda, 0x44, 0xda, 0xda, 0xda, 0x57, 0xda, 0xda, 0xda, 0x3f, 0xc6, 0xc6, 0xc6, 0xf0, 0xcf, 0xcf, 0xcf, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb6, 0xb6, 0xb6, 0xb0, 0xf2, 0xf2, 0xf2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x03, 0xe0, 0xe0, 0xe0, 0x07, 0xd2, 0xd2, 0xd2, 0x0c, 0xcf, 0xcf, 0xcf, 0x14, 0xd9, 0xd9, 0xd9, 0x23, 0xd4, 0xd4, 0xd4, 0x30, 0xdf, 0xdf, 0xdf, 0x2f, 0xc3, 0xc3, 0xc3, 0xaf, 0xc4, 0xc4, 0xc4, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0x7f, 0xd3, 0xd3, 0xd3, 0x1b, 0xd3, 0xd3, 0xd3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xc5, 0xc5, 0xc5, 0x04, 0xe0, 0xe0, 0xe0, 0x07, 0xd5, 0xd5, 0xd5, 0x0c, 0xd3, 0xd3, 0xd3, 0x13, 0xd2, 0xd2, 0xd2, 0x18, 0xd3, 0xd3, 0xd3, 0x1c, 0xc8, 0xc8, 0xc8, 0x4b, 0xc0, 0xc0, 0xc0, 0xf8, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xec, 0xdd, 0xdd, 0xdd, 0x58, 0xda, 0xda, 0xda, 0x3f, 0xd0, 0xd0, 0xd0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0xe7, 0x03, 0xd3, 0xd3, 0xd3, 0x07, 0xdd, 0xdd, 0xdd, 0x08, 0xd5, 0xd5, 0xd5, 0x0b, 0xd6, 0xd6, 0xd6, 0x10, 0xd3, 0xd3, 0xd3, 0x13, 0xcf, 0xcf, 0xcf, 0x18, 0xd2, 0xd2, 0xd2, 0x1c, 0xd1, 0xd1, 0xd1, 0x2c, 0xc0, 0xc0, 0xc0, 0xd8, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xc0, 0xc0, 0xc0, 0x93, 0xdd, 0xdd, 0xdd, 0x33, 0xd9, 0xd9, 0xd9, 0x3b, 0xd9, 0xd9, 0xd9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe9, 0xe9, 0x03, 0xd2, 0xd2, 0xd2, 0x08, 0xcc, 0xcc, 0xcc, 0x14, 0xcf, 0xcf, 0xcf, 0x17, 0xcc, 0xcc, 0xcc, 0x18, 0xd1, 0xd1, 0xd1, 0x1b, 0xd6, 0xd6, 0xd6, 0x1f, 0xd6, 0xd6, 0xd6, 0x1f, 0xdd, 0xdd, 0xdd, 0x23, 0xc4, 0xc4, 0xc4, 0x77, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xef, 0xbf, 0xbf, 0xbf, 0x2c, 0xd8, 0xd8, 0xd8, 0x14, 0xdb, 0xdb, 0xdb, 0x14, 0xd6, 0xd6, 0xd6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xd8, 0x03, 0xdb, 0xdb, 0xdb, 0x08, 0xd0, 0xd0, 0xd0, 0x18, 0xd9, 0xd9, 0xd9, 0x28, 0xd8, 0xd8, 0xd8, 0x2c, 0xdb, 0xdb, 0xdb, 0x2b, 0xdb, 0xdb, 0xdb, 0x28, 0xd9, 0xd9, 0xd9, 0x2b, 0xd6, 0xd6, 0xd6, 0x34, 0xdc, 0xdc, 0xdc, 0x3c, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb4, 0xb4, 0xb4, 0x6b, 0xff, 0xff, 0xff, 0x04, 0xe2, 0xe2, 0xe2, 0x08, 0xd4, 0xd4, 0xd4, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd2, 0xd2, 0x08, 0xd1, 0xd1, 0xd1, 0x14, 0xd9, 0xd9, 0xd9, 0x24, 0xd9, 0xd9, 0xd9, 0x3b, 0xdd, 0xdd, 0xdd, 0x63, 0xdd, 0xdd, 0xdd, 0x5b, 0xd9, 0xd9, 0xd9, 0x4c, 0xda, 0xda, 0xda, 0x4c, 0xdd, 0xdd, 0xdd, 0x67, 0xdf, 0xdf, 0xdf, 0x7b, 0xe0, 0xe0, 0xe0, 0xa3, 0xd7, 0xd7, 0xd7, 0xf8, 0xdd, 0xdd, 0xdd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xaf, 0xce, 0xce, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xe8, 0xe8, 0x03, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xd8, 0x0c, 0xcd, 0xcd, 0xcd, 0x1b, 0xd7, 0xd7, 0xd7, 0x20, 0xd3, 0xd3, 0xd3, 0x2f, 0xdd, 0xdd, 0xdd, 0x60, 0xdd, 0xdd, 0xdd, 0x68, 0xde, 0xde, 0xde, 0x63, 0xdc, 0xdc, 0xdc, 0x64, 0xe2, 0xe2, 0xe2, 0x8c, 0xe7, 0xe7, 0xe7, 0xaf, 0xea, 0xea, 0xea, 0xbb, 0xe6, 0xe6, 0xe6, 0xd7, 0xe3, 0xe3, 0xe3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xea, 0xea, 0xea, 0xff, 0xea, 0xea, 0xea, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb5, 0xb5, 0xb5, 0xd8, 0xbc, 0xbc, 0xbc, 0x13, 0xc1, 0xc1, 0xc1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd1, 0x13, 0xd9, 0xd9, 0xd9, 0x20, 0xd8, 0xd8, 0xd8, 0x28, 0xd3, 0xd3, 0xd3, 0x33, 0xdb, 0xdb, 0xdb, 0x40, 0xda, 0xda, 0xda, 0x47, 0xdb, 0xdb, 0xdb, 0x4c, 0xdb, 0xdb, 0xdb, 0x57, 0xdf, 0xdf, 0xdf, 0x74, 0xe9, 0xe9, 0xe9, 0xb4, 0xe9, 0xe9, 0xe9, 0xc7, 0xeb, 0xeb, 0xeb, 0xc8, 0xe9, 0xe9, 0xe9, 0xe0, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbd, 0xbd, 0xbd, 0xe3, 0xbb, 0xbb, 0xbb, 0x3b, 0xd9, 0xd9, 0xd9, 0x07, 0xf1, 0xf1, 0xf1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xd7, 0xd7, 0x17, 0xd8, 0xd8, 0xd8, 0x2f, 0xd7, 0xd7, 0xd7, 0x34, 0xda, 0xda, 0xda, 0x3f, 0xda, 0xda, 0xda, 0x40, 0xd8, 0xd8, 0xd8, 0x37, 0xd9, 0xd9, 0xd9, 0x37, 0xda, 0xda, 0xda, 0x44, 0xdb, 0xdb, 0xdb, 0x5b, 0xe4, 0xe4, 0xe4, 0x9b, 0xe8, 0xe8, 0xe8, 0xac, 0xe8, 0xe8, 0xe8, 0xb8, 0xe7, 0xe7, 0xe7, 0xbf, 0xe5, 0xe5, 0xe5, 0xdb, 0xde, 0xde, 0xde, 0xfc, 0xdd, 0xdd, 0xdd, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xca, 0xca, 0xca, 0xff, 0xca, 0xca, 0xca, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xe0, 0xc9, 0xc9, 0xc9, 0x54, 0xd5, 0xd5, 0xd5, 0x0c, 0xce, 0xce, 0xce, 0x04, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdc, 0xdc, 0x0f, 0xd7, 0xd7, 0xd7, 0x27, 0xd5, 0xd5, 0xd5, 0x34, 0xda, 0xda, 0xda, 0x47, 0xdb, 0xdb, 0xdb, 0x54, 0xda, 0xda, 0xda, 0x4b, 0xd6, 0xd6, 0xd6, 0x3c, 0xd8, 0xd8, 0xd8, 0x38, 0xdc, 0xdc, 0xdc, 0x54, 0xe0, 0xe0, 0xe0, 0x73, 0xe2, 0xe2, 0xe2, 0x83, 0xe4, 0xe4, 0xe4, 0x98, 0xe4, 0xe4, 0xe4, 0xa4, 0xe7, 0xe7, 0xe7, 0xab, 0xdf, 0xdf, 0xdf, 0xab, 0xcd, 0xcd, 0xcd, 0xef, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xbc, 0xd3, 0xd3, 0xd3, 0x38, 0xda, 0xda, 0xda, 0x27, 0xd2, 0xd2, 0xd2, 0x13, 0xec, 0xec, 0xec, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xd5, 0xd5, 0x07, 0xcf, 0xcf, 0xcf, 0x14, 0xd3, 0xd3, 0xd3, 0x1b, 0xd7, 0xd7, 0xd7, 0x2f, 0xdb, 0xdb, 0xdb, 0x48, 0xd9, 0xd9, 0xd9, 0x53, 0xdb, 0xdb, 0xdb, 0x47, 0xd9, 0xd9, 0xd9, 0x37, 0xda, 0xda, 0xda, 0x38, 0xd9, 0xd9, 0xd9, 0x44, 0xdd, 0xdd, 0xdd, 0x54, 0xdd, 0xdd, 0xdd, 0x70, 0xe1, 0xe1, 0xe1, 0x88, 0xe3, 0xe3, 0xe3, 0x94, 0xde, 0xde, 0xde, 0x70, 0xd2, 0xd2, 0xd2, 0x57, 0xc4, 0xc4, 0xc4, 0xb0, 0xc3, 0xc3, 0xc3, 0xf7, 0xc8, 0xc8, 0xc8, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb5, 0xb5, 0xb5, 0xec, 0xb7, 0xb7, 0xb7, 0x73, 0xd8, 0xd8, 0xd8, 0x20, 0xdc, 0xdc, 0xdc, 0x24, 0xd7, 0xd7, 0xd7, 0x27, 0xd2, 0xd2, 0xd2, 0x1b, 0xd3, 0xd3, 0xd3, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xd4, 0x07, 0xd9, 0xd9, 0xd9, 0x0b, 0xd9, 0xd9, 0xd9, 0x0b, 0xd7, 0xd7, 0xd7, 0x14, 0xd5, 0xd5, 0xd5, 0x34, 0xdb, 0xdb, 0xdb, 0x38, 0xd8, 0xd8, 0xd8, 0x38, 0xda, 0xda, 0xda, 0x27, 0xd3, 0xd3, 0xd3, 0x18, 0xd0, 0xd0, 0xd0, 0x1b, 0xd9, 0xd9, 0xd9, 0x33, 0xdc, 0xdc, 0xdc, 0x57, 0xdf, 0xdf, 0xdf, 0x77, 0xe0, 0xe0, 0xe0, 0x73, 0xd5, 0xd5, 0xd5, 0x3b, 0xdb, 0xdb, 0xdb, 0x27, 0xca, 0xca, 0xca, 0x50, 0xc5, 0xc5, 0xc5, 0xbb, 0xc4, 0xc4, 0xc4, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xe0, 0xb2, 0xb2, 0xb2, 0x7b, 0xb7, 0xb7, 0xb7, 0x1c, 0xe3, 0xe3, 0xe3, 0x04, 0xcd, 0xcd, 0xcd, 0x14, 0xd2, 0xd2, 0xd2, 0x1c, 0xd3, 0xd3, 0xd3, 0x10, 0xd3, 0xd3, 0xd3, 0x10, 0xda, 0xda, 0xda, 0x0f, 0xda, 0xda, 0xda, 0x04, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf3, 0xf3, 0x03, 0xcc, 0xcc, 0xcc, 0x04, 0xc0, 0xc0, 0xc0, 0x03, 0xd4, 0xd4, 0xd4, 0x04, 0xc6, 0xc6, 0xc6, 0x10, 0xd7, 0xd7, 0xd7, 0x1b, 0xdc, 0xdc, 0xdc, 0x1c, 0xd2, 0xd2, 0xd2, 0x0b, 0xdd, 0xdd, 0xdd, 0x07, 0xd1, 0xd1, 0xd1, 0x0f, 0xdb, 0xdb, 0xdb, 0x24, 0xdb, 0xdb, 0xdb, 0x3f, 0xd8, 0xd8, 0xd8, 0x48, 0xda, 0xda, 0xda, 0x3b, 0xd4, 0xd4, 0xd4, 0x1b, 0xcc, 0xcc, 0xcc, 0x14, 0xe2, 0xe2, 0xe2, 0x08, 0xc6, 0xc6, 0xc6, 0x34, 0xbf, 0xbf, 0xbf, 0x88, 0xbd, 0xbd, 0xbd, 0xd3, 0xbf, 0xbf, 0xbf, 0xe8, 0xc2, 0xc2, 0xc2, 0xf4, 0xc1, 0xc1, 0xc1, 0xfc, 0xbb, 0xbb, 0xbb, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xf8, 0xb6, 0xb6, 0xb6, 0xef, 0xb6, 0xb6, 0xb6, 0xe3, 0xb5, 0xb5, 0xb5, 0xac, 0xb5, 0xb5, 0xb5, 0x5b, 0xe7, 0xe7, 0xe7, 0x03, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf3, 0xf3, 0x00, 0xf5, 0xf5, 0xf5, 0x03, 0xe2, 0xe2, 0xe2, 0x07, 0xd1, 0xd1, 0xd1, 0x0f, 0xd4, 0xd4, 0xd4, 0x07, 0xff, 0xff, 0xff, 0x00, 0xd9, 0xd9, 0xd9, 0x04, 0xd5, 0xd5, 0xd5, 0x07, 0xe6, 0xe6, 0xe6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x03, 0xe5, 0xe5, 0xe5, 0x03, 0xcb, 0xcb, 0xcb, 0x07, 0xd8, 0xd8, 0xd8, 0x07, 0xc9, 0xc9, 0xc9, 0x04, 0xc2, 0xc2, 0xc2, 0x04, 0xd8, 0xd8, 0xd8, 0x04, 0xdc, 0xdc, 0xdc, 0x0b, 0xd2, 0xd2, 0xd2, 0x18, 0xd2, 0xd2, 0xd2, 0x1c, 0xd9, 0xd9, 0xd9, 0x2b, 0xd6, 0xd6, 0xd6, 0x23, 0xd8, 0xd8, 0xd8, 0x10, 0xd6, 0xd6, 0xd6, 0x07, 0xff, 0xff, 0xff, 0x03, 0xd9, 0xd9, 0xd9, 0x07, 0xd2, 0xd2, 0xd2, 0x13, 0xc4, 0xc4, 0xc4, 0x28, 0xc9, 0xc9, 0xc9, 0x3f, 0xc8, 0xc8, 0xc8, 0x48, 0xc9, 0xc9, 0xc9, 0x50, 0xc0, 0xc0, 0xc0, 0x4b, 0xb7, 0xb7, 0xb7, 0x34, 0xb4, 0xb4, 0xb4, 0x2b, 0xb4, 0xb4, 0xb4, 0x20, 0xbf, 0xbf, 0xbf, 0x14, 0xf0, 0xf0, 0xf0, 0x04, 0xe6, 0xe6, 0xe6, 0x03, 0xe6, 0xe6, 0xe6, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xdf, 0xdf, 0x00, 0xf2, 0xf2, 0xf2, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0xe7, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xc5, 0xc5, 0xc5, 0x04, 0xc2, 0xc2, 0xc2, 0x04, 0xfc, 0xfc, 0xfc, 0x03, 0xce, 0xce, 0xce, 0x03, 0xcf, 0xcf, 0xcf, 0x07, 0xdd, 0xdd, 0xdd, 0x07, 0xdd, 0xdd, 0xdd, 0x07, 0xce, 0xce, 0xce, 0x13, 0xd8, 0xd8, 0xd8, 0x24, 0xd3, 0xd3, 0xd3, 0x1c, 0xdd, 0xdd, 0xdd, 0x07, 0xe3, 0xe3, 0xe3, 0x03, 0xff, 0xff, 0xff, 0x00, 0xc7, 0xc7, 0xc7, 0x03, 0xdd, 0xdd, 0xdd, 0x07, 0xdb, 0xdb, 0xdb, 0x0b, 0xdb, 0xdb, 0xdb, 0x0b, 0xdb, 0xdb, 0xdb, 0x0b, 0xd3, 0xd3, 0xd3, 0x0f, 0xda, 0xda, 0xda, 0x08, 0xc7, 0xc7, 0xc7, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd4, 0xd4, 0xd4, 0x04, 0xcf, 0xcf, 0xcf, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x03, 0xf2, 0xf2, 0xf2, 0x03, 0xc1, 0xc1, 0xc1, 0x04, 0xff, 0xff, 0xff, 0x03, 0xe0, 0xe0, 0xe0, 0x03, 0xbc, 0xbc, 0xbc, 0x04, 0xf3, 0xf3, 0xf3, 0x03, 0xd0, 0xd0, 0xd0, 0x04, 0xd0, 0xd0, 0xd0, 0x08, 0xd1, 0xd1, 0xd1, 0x14, 0xda, 0xda, 0xda, 0x0c, 0xed, 0xed, 0xed, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xdf, 0xdf, 0x03, 0xd6, 0xd6, 0xd6, 0x03, 0xe5, 0xe5, 0xe5, 0x03, 0xe4, 0xe4, 0xe4, 0x03, 0xe7, 0xe7, 0xe7, 0x03, 0xc1, 0xc1, 0xc1, 0x04, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xc9, 0xc9, 0xc9, 0x03, 0xf7, 0xf7, 0xf7, 0x03, 0xdd, 0xdd, 0xdd, 0x07, 0xdc, 0xdc, 0xdc, 0x07, 0xeb, 0xeb, 0xeb, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf9, 0xf9, 0x00, 0xe2, 0xe2, 0xe2, 0x03, 0xed, 0xed, 0xed, 0x03, 0xf9, 0xf9, 0xf9, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb5, 0xb5, 0xb5, 0x0f, 0xba, 0xba, 0xba, 0x4c, 0xba, 0xba, 0xba, 0x7f, 0xbb, 0xbb, 0xbb, 0xa7, 0xba, 0xba, 0xba, 0xc0, 0xba, 0xba, 0xba, 0xcb, 
+  0xb9, 0xb9, 0xb9, 0xb8, 0xb9, 0xb9, 0xb9, 0x9b, 0xb7, 0xb7, 0xb7, 0x6f, 0xb8, 0xb8, 0xb8, 0x38, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xbd, 0xbd, 0x14, 0xbd, 0xbd, 0xbd, 0x5c, 0xbd, 0xbd, 
+  0xbd, 0xb7, 0xbc, 0xbc, 0xbc, 0xff, 0x82, 0xbd, 0xbd, 0xbd, 0xff, 0x82, 0xbc, 0xbc, 0xbc, 0xff, 0x81, 0xba, 0xba, 0xba, 0xff, 0x04, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xeb, 0xb7, 0xb7, 
+  0xb7, 0x9b, 0xb6, 0xb6, 0xb6, 0x33, 0xb3, 0xb3, 0xb3, 0x0c, 0xac, 0x00, 0x00, 0x00, 0x00, 0x02, 0xae, 0xae, 0xae, 0x07, 0xbe, 0xbe, 0xbe, 0x80, 0xbe, 0xbe, 0xbe, 0xeb, 0x83, 0xbf, 0xbf, 0xbf, 
+  0xff, 0x82, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xbe, 0xbe, 0xbe, 0xff, 0x00, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0xbc, 0xbc, 0xbc, 0xff, 0x04, 0xba, 0xba, 0xba, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 
+  0xb7, 0xf8, 0xb7, 0xb7, 0xb7, 0xd3, 0xb6, 0xb6, 0xb6, 0x57, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbf, 0xbf, 0xbf, 0x4c, 0xbf, 0xbf, 0xbf, 0xd7, 0xbf, 0xbf, 0xbf, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 
+  0xff, 0x00, 0xc2, 0xc2, 0xc2, 0xff, 0x82, 0xc3, 0xc3, 0xc3, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x81, 0xbd, 0xbd, 0xbd, 0xff, 0x05, 
+  0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xab, 0xb3, 0xb3, 0xb3, 0x23, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xbf, 
+  0xbf, 0x87, 0xbf, 0xbf, 0xbf, 0xf8, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc4, 0xc4, 0xc4, 0xff, 0x81, 0xc5, 0xc5, 0xc5, 0xff, 0x00, 0xc6, 0xc6, 0xc6, 0xff, 0x82, 0xc5, 0xc5, 0xc5, 0xff, 0x81, 
+  0xc4, 0xc4, 0xc4, 0xff, 0x00, 0xc2, 0xc2, 0xc2, 0xff, 0x81, 0xc1, 0xc1, 0xc1, 0xff, 0x01, 0xbf, 0xbf, 0xbf, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x03, 0xb9, 0xb9, 0xb9, 
+  0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xf0, 0xb4, 0xb4, 0xb4, 0x4c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc0, 0xc0, 0xc0, 0x0f, 0xbf, 0xbf, 0xbf, 0x9f, 0xc0, 0xc0, 0xc0, 0xff, 0xc2, 
+  0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x84, 0xc8, 0xc8, 0xc8, 0xff, 0x00, 0xc7, 0xc7, 0xc7, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 0xff, 0x0b, 
+  0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 
+  0xb9, 0xb9, 0xb9, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb6, 0xb6, 0xb6, 0xfb, 0xb4, 0xb4, 0xb4, 0x5b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 0x9f, 0xc1, 0xc1, 0xc1, 0xff, 0xc3, 0xc3, 
+  0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 0xca, 0xca, 0xca, 0xff, 0x02, 0xcb, 0xcb, 0xcb, 0xff, 0xca, 0xca, 0xca, 0xff, 
+  0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xca, 0xca, 0xca, 0xff, 0x0e, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc3, 0xc3, 
+  0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 
+  0xb5, 0xfb, 0xb3, 0xb3, 0xb3, 0x60, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xbf, 0xbf, 0x87, 0xc2, 0xc2, 0xc2, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 
+  0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x81, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x83, 0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x0d, 0xc9, 0xc9, 0xc9, 0xff, 0xc8, 0xc8, 
+  0xc8, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 
+  0xba, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xf7, 0xb2, 0xb2, 0xb2, 0x33, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbf, 0xbf, 0xbf, 0x4c, 0xc1, 0xc1, 0xc1, 0xf8, 
+  0xc3, 0xc3, 0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xce, 0xce, 0xce, 0xff, 0x81, 0xcf, 0xcf, 0xcf, 
+  0xff, 0x81, 0xd0, 0xd0, 0xd0, 0xff, 0x82, 0xcf, 0xcf, 0xcf, 0xff, 0x81, 0xcd, 0xcd, 0xcd, 0xff, 0x0e, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 
+  0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 
+  0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xd8, 0xb4, 0xb4, 0xb4, 0x18, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb3, 0xb3, 0xb3, 0x07, 0xc1, 0xc1, 0xc1, 0xd7, 0xc3, 0xc3, 0xc3, 0xff, 0xc6, 
+  0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc6, 
+  0xc6, 0xc6, 0xff, 0xce, 0xce, 0xce, 0xff, 0x81, 0xd1, 0xd1, 0xd1, 0xff, 0x12, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 
+  0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 
+  0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0x97, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc1, 
+  0xc1, 0xc1, 0x80, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc3, 
+  0xc3, 0xc3, 0xff, 0x82, 0xc7, 0xc7, 0xc7, 0xff, 0x01, 0xc4, 0xc4, 0xc4, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0x81, 0xd4, 0xd4, 0xd4, 0xff, 0x12, 0xd3, 0xd3, 0xd3, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd1, 
+  0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 
+  0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb3, 0xb3, 0xb3, 0xf3, 0xb0, 
+  0xb0, 0xb0, 0x28, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbf, 0xbf, 0xbf, 0x14, 0xc1, 0xc1, 0xc1, 0xeb, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 
+  0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0x81, 0xc9, 0xc9, 0xc9, 0xff, 0x03, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 
+  0xcb, 0xcb, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x81, 0xd5, 0xd5, 0xd5, 0xff, 0x11, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 
+  0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbe, 0xbe, 0xbe, 
+  0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb1, 0xb1, 0xb1, 0x9c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc0, 0xc0, 0xc0, 0x5c, 0xc1, 
+  0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc9, 
+  0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x81, 0xcb, 0xcb, 0xcb, 0xff, 0x05, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 
+  0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x81, 0xd1, 0xd1, 0xd1, 0xff, 0x0d, 0xd0, 0xd0, 0xd0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 
+  0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 
+  0xb2, 0xb2, 0xb2, 0xff, 0xb0, 0xb0, 0xb0, 0x1b, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc1, 0xc1, 0xc1, 0xb7, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xcb, 0xcb, 
+  0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0x81, 0xd0, 0xd0, 0xd0, 0xff, 0x02, 
+  0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0x81, 0xd7, 0xd7, 0xd7, 0xff, 0x02, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x81, 0xd1, 
+  0xd1, 0xd1, 0xff, 0x0d, 0xd0, 0xd0, 0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 
+  0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0x70, 0x99, 0x00, 0x00, 0x00, 
+  0x00, 0x0f, 0xbb, 0xbb, 0xbb, 0x0f, 0xc0, 0xc0, 0xc0, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd0, 0xd0, 
+  0xd0, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xda, 0xda, 
+  0xda, 0xff, 0x82, 0xd9, 0xd9, 0xd9, 0xff, 0x03, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x81, 0xd1, 0xd1, 0xd1, 0xff, 0x0d, 0xd0, 0xd0, 
+  0xd0, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 
+  0xbd, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xcb, 0xa8, 0xa8, 0xa8, 0x03, 0x98, 0x00, 0x00, 0x00, 0x00, 0x17, 0xc0, 0xc0, 0xc0, 0x4c, 
+  0xc1, 0xc1, 0xc1, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 
+  0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 
+  0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 
+  0xff, 0x07, 0xd3, 0xd3, 0xd3, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xbe, 0xbe, 
+  0xbe, 0xff, 0x81, 0xb8, 0xb8, 0xb8, 0xff, 0x02, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xe4, 0xaf, 0xaf, 0xaf, 0x13, 0x98, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xbf, 0xbf, 0x7f, 0xc1, 0xc1, 
+  0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xca, 0xca, 0xca, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xd3, 0xd3, 0xd3, 0xff, 0x06, 0xd4, 0xd4, 0xd4, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 
+  0xdd, 0xdd, 0xdd, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x81, 0xe0, 0xe0, 0xe0, 0xff, 0x02, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 
+  0xdc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0x81, 0xd7, 0xd7, 0xd7, 0xff, 0x02, 0xd4, 0xd4, 0xd4, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0x84, 0xd5, 0xd5, 0xd5, 0xff, 0x03, 0xd4, 0xd4, 
+  0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0x81, 0xb8, 0xb8, 0xb8, 0xff, 0x02, 0xb4, 0xb4, 0xb4, 0xff, 0xb2, 0xb2, 0xb2, 0xf0, 0xaf, 0xaf, 0xaf, 0x20, 
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x08, 0xd8, 0xd8, 0xd8, 0x03, 0xcb, 0xcb, 0xcb, 0x04, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xa7, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc8, 0xc8, 
+  0xc8, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0x81, 0xd5, 0xd5, 0xd5, 0xff, 0x08, 0xd6, 0xd6, 0xd6, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 
+  0xe8, 0xe8, 0xe8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x81, 0xdf, 0xdf, 0xdf, 0xff, 0x03, 0xdd, 0xdd, 0xdd, 0xff, 0xda, 0xda, 
+  0xda, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0x81, 0xd4, 0xd4, 0xd4, 0xff, 0x0d, 0xd6, 0xd6, 0xd6, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 
+  0xd8, 0xd8, 0xd8, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 
+  0xb3, 0xb3, 0xb3, 0xfb, 0xb1, 0xb1, 0xb1, 0x2b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd1, 0xd1, 0xd1, 0x18, 0xd8, 0xd8, 0xd8, 0x37, 0xd9, 0xd9, 0xd9, 0x2c, 0xc3, 0xc3, 0xc3, 0xcb, 0xc3, 0xc3, 
+  0xc3, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xca, 0xca, 0xca, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x08, 0xda, 0xda, 0xda, 0xff, 
+  0xe0, 0xe0, 0xe0, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xea, 0xea, 0xea, 0xff, 0xec, 0xec, 0xec, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 
+  0x82, 0xe1, 0xe1, 0xe1, 0xff, 0x02, 0xde, 0xde, 0xde, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0x81, 0xd6, 0xd6, 0xd6, 0xff, 0x02, 0xd9, 0xd9, 0xd9, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 
+  0xdf, 0xdf, 0xdf, 0xff, 0x81, 0xde, 0xde, 0xde, 0xff, 0x07, 0xda, 0xda, 0xda, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb4, 0xb4, 
+  0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb1, 0xb1, 0xb1, 0x30, 0x91, 0x00, 0x00, 0x00, 0x00, 0x07, 0xde, 0xde, 0xde, 0x03, 0xd2, 0xd2, 0xd2, 0x07, 0xc9, 0xc9, 0xc9, 0x04, 0x00, 0x00, 0x00, 0x00, 
+  0xd5, 0xd5, 0xd5, 0x1f, 0xdc, 0xdc, 0xdc, 0x53, 0xdf, 0xdf, 0xdf, 0x68, 0xcd, 0xcd, 0xcd, 0xe0, 0x82, 0xc9, 0xc9, 0xc9, 0xff, 0x09, 0xcb, 0xcb, 0xcb, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd9, 0xd9, 
+  0xd9, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x81, 0xed, 
+  0xed, 0xed, 0xff, 0x02, 0xeb, 0xeb, 0xeb, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x81, 0xe3, 0xe3, 0xe3, 0xff, 0x03, 0xe2, 0xe2, 0xe2, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdc, 0xdc, 
+  0xdc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0x81, 0xd7, 0xd7, 0xd7, 0xff, 0x0b, 0xda, 0xda, 0xda, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 
+  0xd7, 0xd7, 0xd7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb2, 0xb2, 0xb2, 0xff, 0xb1, 0xb1, 0xb1, 0x33, 0x91, 0x00, 0x00, 0x00, 
+  0x00, 0x07, 0xcf, 0xcf, 0xcf, 0x0c, 0xcb, 0xcb, 0xcb, 0x13, 0xcd, 0xcd, 0xcd, 0x13, 0xca, 0xca, 0xca, 0x0f, 0xd7, 0xd7, 0xd7, 0x24, 0xdd, 0xdd, 0xdd, 0x53, 0xe0, 0xe0, 0xe0, 0x84, 0xd6, 0xd6, 
+  0xd6, 0xe3, 0x81, 0xd3, 0xd3, 0xd3, 0xff, 0x0b, 0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 
+  0xe1, 0xe1, 0xe1, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xea, 0xea, 0xea, 0xff, 0xed, 0xed, 0xed, 0xff, 0x81, 0xee, 0xee, 0xee, 0xff, 0x06, 0xec, 0xec, 
+  0xec, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x81, 0xdf, 0xdf, 0xdf, 0xff, 0x0d, 
+  0xdc, 0xdc, 0xdc, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 
+  0xcd, 0xcd, 0xcd, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb7, 0xb7, 0xb7, 0x34, 0xb6, 0xb6, 0xb6, 0x03, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xd5, 0xd5, 
+  0xd5, 0x1b, 0xd5, 0xd5, 0xd5, 0x20, 0xcd, 0xcd, 0xcd, 0x1b, 0xd8, 0xd8, 0xd8, 0x20, 0xd7, 0xd7, 0xd7, 0x37, 0xde, 0xde, 0xde, 0x5f, 0xe1, 0xe1, 0xe1, 0x83, 0xd6, 0xd6, 0xd6, 0xd4, 0xd9, 0xd9, 
+  0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0x81, 0xe6, 
+  0xe6, 0xe6, 0xff, 0x03, 0xe8, 0xe8, 0xe8, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xea, 0xea, 0xea, 0xff, 0xec, 0xec, 0xec, 0xff, 0x81, 0xee, 0xee, 0xee, 0xff, 0x81, 0xed, 0xed, 0xed, 0xff, 0x02, 0xeb, 
+  0xeb, 0xeb, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0x81, 0xe2, 0xe2, 0xe2, 0xff, 0x0e, 0xe1, 0xe1, 0xe1, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xda, 0xda, 0xda, 
+  0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xc9, 0xc9, 0xc9, 
+  0xff, 0xba, 0xba, 0xba, 0xff, 0xb1, 0xb1, 0xb1, 0xf8, 0xb2, 0xb2, 0xb2, 0x2b, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd2, 0xd2, 0xd2, 0x27, 0xd9, 0xd9, 0xd9, 0x3c, 0xd6, 0xd6, 0xd6, 0x20, 0xd9, 
+  0xd9, 0xd9, 0x20, 0xd7, 0xd7, 0xd7, 0x38, 0xdc, 0xdc, 0xdc, 0x57, 0xde, 0xde, 0xde, 0x5c, 0xd3, 0xd3, 0xd3, 0xaf, 0xd9, 0xd9, 0xd9, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 
+  0xdb, 0xdb, 0xdb, 0xff, 0x00, 0xe0, 0xe0, 0xe0, 0xff, 0x81, 0xe4, 0xe4, 0xe4, 0xff, 0x05, 0xe9, 0xe9, 0xe9, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xea, 
+  0xea, 0xea, 0xff, 0xec, 0xec, 0xec, 0xff, 0x82, 0xed, 0xed, 0xed, 0xff, 0x14, 0xee, 0xee, 0xee, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xe5, 0xe5, 0xe5, 
+  0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd5, 0xd5, 0xd5, 
+  0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb1, 0xb1, 0xb1, 0xec, 0xaf, 0xaf, 0xaf, 
+  0x1c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd9, 0xd9, 0xd9, 0x14, 0xd7, 0xd7, 0xd7, 0x37, 0xd6, 0xd6, 0xd6, 0x2c, 0xda, 0xda, 0xda, 0x23, 0xda, 0xda, 0xda, 0x2c, 0xd8, 0xd8, 0xd8, 0x44, 0xdc, 
+  0xdc, 0xdc, 0x4c, 0xce, 0xce, 0xce, 0x73, 0xcf, 0xcf, 0xcf, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xdb, 0xdb, 0xdb, 0xff, 0x02, 0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 
+  0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x81, 0xe8, 0xe8, 0xe8, 0xff, 0x82, 0xe7, 0xe7, 0xe7, 0xff, 0x00, 0xea, 0xea, 0xea, 0xff, 0x82, 0xec, 0xec, 0xec, 0xff, 0x02, 0xed, 0xed, 0xed, 0xff, 0xea, 0xea, 
+  0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0x82, 0xe5, 0xe5, 0xe5, 0xff, 0x07, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 
+  0xce, 0xce, 0xce, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0x81, 0xd9, 0xd9, 0xd9, 0xff, 0x04, 0xd3, 0xd3, 0xd3, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb1, 0xb1, 
+  0xb1, 0xe0, 0xb0, 0xb0, 0xb0, 0x0f, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xdd, 0xdd, 0xdd, 0x03, 0xda, 0xda, 0xda, 0x10, 0xd1, 0xd1, 0xd1, 0x1b, 0xd3, 0xd3, 0xd3, 0x1f, 0xd5, 0xd5, 0xd5, 0x23, 
+  0xda, 0xda, 0xda, 0x44, 0xda, 0xda, 0xda, 0x57, 0xda, 0xda, 0xda, 0x3f, 0xc6, 0xc6, 0xc6, 0xf0, 0xcf, 0xcf, 0xcf, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xda, 0xda, 0xda, 0xff, 
+  0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0x81, 0xe9, 0xe9, 0xe9, 0xff, 0x00, 0xe8, 0xe8, 0xe8, 0xff, 0x81, 0xe7, 0xe7, 0xe7, 0xff, 0x01, 0xe9, 0xe9, 0xe9, 0xff, 
+  0xea, 0xea, 0xea, 0xff, 0x82, 0xeb, 0xeb, 0xeb, 0xff, 0x04, 0xea, 0xea, 0xea, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x82, 0xe2, 
+  0xe2, 0xe2, 0xff, 0x0b, 0xdf, 0xdf, 0xdf, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 
+  0xd3, 0xd3, 0xd3, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb6, 0xb6, 0xb6, 0xb0, 0xf2, 0xf2, 0xf2, 0x03, 0x92, 0x00, 0x00, 0x00, 0x00, 0x11, 0xcc, 0xcc, 0xcc, 0x03, 0xe0, 0xe0, 
+  0xe0, 0x07, 0xd2, 0xd2, 0xd2, 0x0c, 0xcf, 0xcf, 0xcf, 0x14, 0xd9, 0xd9, 0xd9, 0x23, 0xd4, 0xd4, 0xd4, 0x30, 0xdf, 0xdf, 0xdf, 0x2f, 0xc3, 0xc3, 0xc3, 0xaf, 0xc4, 0xc4, 0xc4, 0xff, 0xcb, 0xcb, 
+  0xcb, 0xff, 0xce, 0xce, 0xce, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe9, 0xe9, 
+  0xe9, 0xff, 0x83, 0xe8, 0xe8, 0xe8, 0xff, 0x09, 0xe9, 0xe9, 0xe9, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 
+  0xe1, 0xe1, 0xe1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0x81, 0xe0, 0xe0, 0xe0, 0xff, 0x05, 0xdc, 0xdc, 0xdc, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xc9, 0xc9, 
+  0xc9, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x03, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0x7f, 0xd3, 0xd3, 0xd3, 0x1b, 
+  0xd3, 0xd3, 0xd3, 0x04, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc5, 0xc5, 0xc5, 0x04, 0xe0, 0xe0, 0xe0, 0x07, 0xd5, 0xd5, 0xd5, 0x0c, 0xd3, 0xd3, 0xd3, 0x13, 0xd2, 0xd2, 0xd2, 0x18, 0xd3, 0xd3, 
+  0xd3, 0x1c, 0xc8, 0xc8, 0xc8, 0x4b, 0xc0, 0xc0, 0xc0, 0xf8, 0xc4, 0xc4, 0xc4, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe1, 
+  0xe1, 0xff, 0x81, 0xe4, 0xe4, 0xe4, 0xff, 0x81, 0xe6, 0xe6, 0xe6, 0xff, 0x00, 0xe7, 0xe7, 0xe7, 0xff, 0x82, 0xe6, 0xe6, 0xe6, 0xff, 0x81, 0xe8, 0xe8, 0xe8, 0xff, 0x81, 0xe7, 0xe7, 0xe7, 0xff, 
+  0x02, 0xe5, 0xe5, 0xe5, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x05, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xd6, 
+  0xd6, 0xd6, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x81, 0xc2, 0xc2, 0xc2, 0xff, 0x05, 0xc3, 0xc3, 0xc3, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc3, 0xc3, 0xc3, 0xec, 0xdd, 0xdd, 0xdd, 
+  0x58, 0xda, 0xda, 0xda, 0x3f, 0xd0, 0xd0, 0xd0, 0x13, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe7, 0xe7, 0xe7, 0x03, 0xd3, 0xd3, 0xd3, 0x07, 0xdd, 0xdd, 0xdd, 0x08, 0xd5, 0xd5, 0xd5, 0x0b, 0xd6, 
+  0xd6, 0xd6, 0x10, 0xd3, 0xd3, 0xd3, 0x13, 0xcf, 0xcf, 0xcf, 0x18, 0xd2, 0xd2, 0xd2, 0x1c, 0xd1, 0xd1, 0xd1, 0x2c, 0xc0, 0xc0, 0xc0, 0xd8, 0xc3, 0xc3, 0xc3, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc9, 
+  0xc9, 0xc9, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0x81, 0xe2, 0xe2, 0xe2, 0xff, 0x82, 0xe3, 0xe3, 0xe3, 0xff, 0x03, 0xe4, 0xe4, 
+  0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0x81, 0xe2, 0xe2, 0xe2, 0xff, 0x04, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xda, 0xda, 0xff, 
+  0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x81, 0xd1, 0xd1, 0xd1, 0xff, 0x04, 0xcf, 0xcf, 0xcf, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0xbe, 0xbe, 
+  0xbe, 0xff, 0x81, 0xbb, 0xbb, 0xbb, 0xff, 0x04, 0xba, 0xba, 0xba, 0xff, 0xc0, 0xc0, 0xc0, 0x93, 0xdd, 0xdd, 0xdd, 0x33, 0xd9, 0xd9, 0xd9, 0x3b, 0xd9, 0xd9, 0xd9, 0x1b, 0x90, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0xe9, 0xe9, 0xe9, 0x03, 0xd2, 0xd2, 0xd2, 0x08, 0xcc, 0xcc, 0xcc, 0x14, 0xcf, 0xcf, 0xcf, 0x17, 0xcc, 0xcc, 0xcc, 0x18, 0xd1, 0xd1, 0xd1, 0x1b, 0x81, 0xd6, 0xd6, 0xd6, 0x1f, 0x0b, 
+  0xdd, 0xdd, 0xdd, 0x23, 0xc4, 0xc4, 0xc4, 0x77, 0xc2, 0xc2, 0xc2, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 
+  0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0x81, 0xe2, 0xe2, 0xe2, 0xff, 0x05, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 
+  0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0x81, 0xdc, 0xdc, 0xdc, 0xff, 0x10, 0xda, 0xda, 0xda, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 
+  0xcf, 0xcf, 0xcf, 0xff, 0xce, 0xce, 0xce, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb8, 0xb8, 0xb8, 0xff, 
+  0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xef, 0xbf, 0xbf, 0xbf, 0x2c, 0xd8, 0xd8, 0xd8, 0x14, 0xdb, 0xdb, 0xdb, 0x14, 0xd6, 0xd6, 0xd6, 0x08, 0x90, 0x00, 0x00, 0x00, 0x00, 0x11, 0xd8, 0xd8, 
+  0xd8, 0x03, 0xdb, 0xdb, 0xdb, 0x08, 0xd0, 0xd0, 0xd0, 0x18, 0xd9, 0xd9, 0xd9, 0x28, 0xd8, 0xd8, 0xd8, 0x2c, 0xdb, 0xdb, 0xdb, 0x2b, 0xdb, 0xdb, 0xdb, 0x28, 0xd9, 0xd9, 0xd9, 0x2b, 0xd6, 0xd6, 
+  0xd6, 0x34, 0xdc, 0xdc, 0xdc, 0x3c, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xc9, 0xc9, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 
+  0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0x81, 0xe6, 0xe6, 0xe6, 0xff, 0x01, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0x81, 0xe4, 0xe4, 0xe4, 0xff, 0x81, 0xe3, 0xe3, 0xe3, 0xff, 0x03, 0xe0, 
+  0xe0, 0xe0, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x0d, 0xd4, 0xd4, 0xd4, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xce, 0xce, 0xce, 
+  0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb3, 0xb3, 0xb3, 0xff, 0xb4, 0xb4, 0xb4, 
+  0x6b, 0xff, 0xff, 0xff, 0x04, 0xe2, 0xe2, 0xe2, 0x08, 0xd4, 0xd4, 0xd4, 0x07, 0x91, 0x00, 0x00, 0x00, 0x00, 0x16, 0xd2, 0xd2, 0xd2, 0x08, 0xd1, 0xd1, 0xd1, 0x14, 0xd9, 0xd9, 0xd9, 0x24, 0xd9, 
+  0xd9, 0xd9, 0x3b, 0xdd, 0xdd, 0xdd, 0x63, 0xdd, 0xdd, 0xdd, 0x5b, 0xd9, 0xd9, 0xd9, 0x4c, 0xda, 0xda, 0xda, 0x4c, 0xdd, 0xdd, 0xdd, 0x67, 0xdf, 0xdf, 0xdf, 0x7b, 0xe0, 0xe0, 0xe0, 0xa3, 0xd7, 
+  0xd7, 0xd7, 0xf8, 0xdd, 0xdd, 0xdd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 
+  0xeb, 0xeb, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0x81, 0xe2, 0xe2, 0xe2, 0xff, 0x06, 0xe3, 0xe3, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 
+  0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0x81, 0xd4, 0xd4, 0xd4, 0xff, 0x81, 0xd3, 0xd3, 0xd3, 0xff, 0x06, 0xd1, 0xd1, 0xd1, 0xff, 
+  0xcb, 0xcb, 0xcb, 0xff, 0xc3, 0xc3, 0xc3, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb3, 0xb3, 0xb3, 0xaf, 0xce, 0xce, 0xce, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe8, 0xe8, 
+  0xe8, 0x03, 0xff, 0xff, 0xff, 0x03, 0x90, 0x00, 0x00, 0x00, 0x00, 0x12, 0xd8, 0xd8, 0xd8, 0x0c, 0xcd, 0xcd, 0xcd, 0x1b, 0xd7, 0xd7, 0xd7, 0x20, 0xd3, 0xd3, 0xd3, 0x2f, 0xdd, 0xdd, 0xdd, 0x60, 
+  0xdd, 0xdd, 0xdd, 0x68, 0xde, 0xde, 0xde, 0x63, 0xdc, 0xdc, 0xdc, 0x64, 0xe2, 0xe2, 0xe2, 0x8c, 0xe7, 0xe7, 0xe7, 0xaf, 0xea, 0xea, 0xea, 0xbb, 0xe6, 0xe6, 0xe6, 0xd7, 0xe3, 0xe3, 0xe3, 0xff, 
+  0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x81, 0xea, 0xea, 0xea, 0xff, 0x02, 0xd5, 0xd5, 
+  0xd5, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xda, 0xda, 0xda, 0xff, 0x81, 0xe2, 0xe2, 0xe2, 0xff, 0x08, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 
+  0xd4, 0xd4, 0xd4, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x05, 0xd0, 0xd0, 0xd0, 0xff, 0xc8, 0xc8, 
+  0xc8, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb5, 0xb5, 0xb5, 0xd8, 0xbc, 0xbc, 0xbc, 0x13, 0xc1, 0xc1, 0xc1, 0x04, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xd1, 0xd1, 0xd1, 0x13, 0xd9, 0xd9, 0xd9, 0x20, 
+  0xd8, 0xd8, 0xd8, 0x28, 0xd3, 0xd3, 0xd3, 0x33, 0xdb, 0xdb, 0xdb, 0x40, 0xda, 0xda, 0xda, 0x47, 0xdb, 0xdb, 0xdb, 0x4c, 0xdb, 0xdb, 0xdb, 0x57, 0xdf, 0xdf, 0xdf, 0x74, 0xe9, 0xe9, 0xe9, 0xb4, 
+  0xe9, 0xe9, 0xe9, 0xc7, 0xeb, 0xeb, 0xeb, 0xc8, 0xe9, 0xe9, 0xe9, 0xe0, 0x81, 0xe3, 0xe3, 0xe3, 0xff, 0x00, 0xe1, 0xe1, 0xe1, 0xff, 0x81, 0xdd, 0xdd, 0xdd, 0xff, 0x08, 0xdf, 0xdf, 0xdf, 0xff, 
+  0xe2, 0xe2, 0xe2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xce, 0xce, 0xce, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 
+  0x81, 0xdc, 0xdc, 0xdc, 0xff, 0x06, 0xd7, 0xd7, 0xd7, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xcf, 0xcf, 0xcf, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 
+  0xd0, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x04, 0xc7, 0xc7, 0xc7, 0xff, 0xbd, 0xbd, 0xbd, 0xe3, 0xbb, 0xbb, 0xbb, 0x3b, 0xd9, 0xd9, 0xd9, 0x07, 0xf1, 0xf1, 0xf1, 0x03, 0x94, 0x00, 0x00, 0x00, 
+  0x00, 0x11, 0xd7, 0xd7, 0xd7, 0x17, 0xd8, 0xd8, 0xd8, 0x2f, 0xd7, 0xd7, 0xd7, 0x34, 0xda, 0xda, 0xda, 0x3f, 0xda, 0xda, 0xda, 0x40, 0xd8, 0xd8, 0xd8, 0x37, 0xd9, 0xd9, 0xd9, 0x37, 0xda, 0xda, 
+  0xda, 0x44, 0xdb, 0xdb, 0xdb, 0x5b, 0xe4, 0xe4, 0xe4, 0x9b, 0xe8, 0xe8, 0xe8, 0xac, 0xe8, 0xe8, 0xe8, 0xb8, 0xe7, 0xe7, 0xe7, 0xbf, 0xe5, 0xe5, 0xe5, 0xdb, 0xde, 0xde, 0xde, 0xfc, 0xdd, 0xdd, 
+  0xdd, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0x81, 0xd7, 0xd7, 0xd7, 0xff, 0x05, 0xd5, 0xd5, 0xd5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 
+  0xc6, 0xc6, 0xc6, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x81, 0xca, 0xca, 0xca, 0xff, 0x0e, 0xd2, 0xd2, 0xd2, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xcd, 0xcd, 
+  0xcd, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc0, 0xc0, 0xc0, 0xe0, 0xc9, 0xc9, 0xc9, 0x54, 0xd5, 0xd5, 
+  0xd5, 0x0c, 0xce, 0xce, 0xce, 0x04, 0xff, 0xff, 0xff, 0x03, 0x94, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xdc, 0xdc, 0xdc, 0x0f, 0xd7, 0xd7, 0xd7, 0x27, 0xd5, 0xd5, 0xd5, 0x34, 0xda, 0xda, 0xda, 0x47, 
+  0xdb, 0xdb, 0xdb, 0x54, 0xda, 0xda, 0xda, 0x4b, 0xd6, 0xd6, 0xd6, 0x3c, 0xd8, 0xd8, 0xd8, 0x38, 0xdc, 0xdc, 0xdc, 0x54, 0xe0, 0xe0, 0xe0, 0x73, 0xe2, 0xe2, 0xe2, 0x83, 0xe4, 0xe4, 0xe4, 0x98, 
+  0xe4, 0xe4, 0xe4, 0xa4, 0xe7, 0xe7, 0xe7, 0xab, 0xdf, 0xdf, 0xdf, 0xab, 0xcd, 0xcd, 0xcd, 0xef, 0xcb, 0xcb, 0xcb, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xd0, 0xd0, 0xd0, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 
+  0xd2, 0xd2, 0xd2, 0xff, 0xca, 0xca, 0xca, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 
+  0xc5, 0xc5, 0xc5, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc7, 0xc7, 0xc7, 0xff, 0x81, 0xbf, 0xbf, 0xbf, 0xff, 0x08, 0xc7, 0xc7, 0xc7, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 
+  0xba, 0xff, 0xbc, 0xbc, 0xbc, 0xbc, 0xd3, 0xd3, 0xd3, 0x38, 0xda, 0xda, 0xda, 0x27, 0xd2, 0xd2, 0xd2, 0x13, 0xec, 0xec, 0xec, 0x03, 0x95, 0x00, 0x00, 0x00, 0x00, 0x29, 0xd5, 0xd5, 0xd5, 0x07, 
+  0xcf, 0xcf, 0xcf, 0x14, 0xd3, 0xd3, 0xd3, 0x1b, 0xd7, 0xd7, 0xd7, 0x2f, 0xdb, 0xdb, 0xdb, 0x48, 0xd9, 0xd9, 0xd9, 0x53, 0xdb, 0xdb, 0xdb, 0x47, 0xd9, 0xd9, 0xd9, 0x37, 0xda, 0xda, 0xda, 0x38, 
+  0xd9, 0xd9, 0xd9, 0x44, 0xdd, 0xdd, 0xdd, 0x54, 0xdd, 0xdd, 0xdd, 0x70, 0xe1, 0xe1, 0xe1, 0x88, 0xe3, 0xe3, 0xe3, 0x94, 0xde, 0xde, 0xde, 0x70, 0xd2, 0xd2, 0xd2, 0x57, 0xc4, 0xc4, 0xc4, 0xb0, 
+  0xc3, 0xc3, 0xc3, 0xf7, 0xc8, 0xc8, 0xc8, 0xff, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc5, 0xc5, 0xc5, 0xff, 0xc1, 0xc1, 0xc1, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 
+  0xbe, 0xbe, 0xbe, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 0xc2, 0xff, 0xbc, 0xbc, 0xbc, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 
+  0xbb, 0xbb, 0xbb, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb5, 0xb5, 0xb5, 0xec, 0xb7, 0xb7, 0xb7, 0x73, 0xd8, 0xd8, 0xd8, 0x20, 0xdc, 0xdc, 0xdc, 0x24, 0xd7, 0xd7, 0xd7, 0x27, 0xd2, 0xd2, 0xd2, 0x1b, 
+  0xd3, 0xd3, 0xd3, 0x08, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xd4, 0xd4, 0x07, 0x81, 0xd9, 0xd9, 0xd9, 0x0b, 0x0e, 0xd7, 0xd7, 0xd7, 0x14, 0xd5, 0xd5, 0xd5, 0x34, 0xdb, 0xdb, 0xdb, 0x38, 
+  0xd8, 0xd8, 0xd8, 0x38, 0xda, 0xda, 0xda, 0x27, 0xd3, 0xd3, 0xd3, 0x18, 0xd0, 0xd0, 0xd0, 0x1b, 0xd9, 0xd9, 0xd9, 0x33, 0xdc, 0xdc, 0xdc, 0x57, 0xdf, 0xdf, 0xdf, 0x77, 0xe0, 0xe0, 0xe0, 0x73, 
+  0xd5, 0xd5, 0xd5, 0x3b, 0xdb, 0xdb, 0xdb, 0x27, 0xca, 0xca, 0xca, 0x50, 0xc5, 0xc5, 0xc5, 0xbb, 0x81, 0xc4, 0xc4, 0xc4, 0xff, 0x11, 0xc2, 0xc2, 0xc2, 0xff, 0xc4, 0xc4, 0xc4, 0xff, 0xc2, 0xc2, 
+  0xc2, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0xbb, 0xbb, 0xbb, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xb7, 0xb7, 0xb7, 0xff, 0xb9, 0xb9, 0xb9, 0xff, 0xba, 0xba, 0xba, 0xff, 0xbe, 0xbe, 0xbe, 0xff, 0xb8, 0xb8, 
+  0xb8, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb4, 0xb4, 0xb4, 0xe0, 0xb2, 0xb2, 0xb2, 0x7b, 0xb7, 0xb7, 0xb7, 0x1c, 0xe3, 0xe3, 0xe3, 0x04, 0xcd, 0xcd, 0xcd, 0x14, 0xd2, 0xd2, 0xd2, 0x1c, 0x81, 0xd3, 
+  0xd3, 0xd3, 0x10, 0x01, 0xda, 0xda, 0xda, 0x0f, 0xda, 0xda, 0xda, 0x04, 0x96, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xf3, 0xf3, 0x03, 0xcc, 0xcc, 0xcc, 0x04, 0xc0, 0xc0, 0xc0, 0x03, 0xd4, 0xd4, 
+  0xd4, 0x04, 0xc6, 0xc6, 0xc6, 0x10, 0xd7, 0xd7, 0xd7, 0x1b, 0xdc, 0xdc, 0xdc, 0x1c, 0xd2, 0xd2, 0xd2, 0x0b, 0xdd, 0xdd, 0xdd, 0x07, 0xd1, 0xd1, 0xd1, 0x0f, 0xdb, 0xdb, 0xdb, 0x24, 0xdb, 0xdb, 
+  0xdb, 0x3f, 0xd8, 0xd8, 0xd8, 0x48, 0xda, 0xda, 0xda, 0x3b, 0xd4, 0xd4, 0xd4, 0x1b, 0xcc, 0xcc, 0xcc, 0x14, 0xe2, 0xe2, 0xe2, 0x08, 0xc6, 0xc6, 0xc6, 0x34, 0xbf, 0xbf, 0xbf, 0x88, 0xbd, 0xbd, 
+  0xbd, 0xd3, 0xbf, 0xbf, 0xbf, 0xe8, 0xc2, 0xc2, 0xc2, 0xf4, 0xc1, 0xc1, 0xc1, 0xfc, 0xbb, 0xbb, 0xbb, 0xff, 0xb6, 0xb6, 0xb6, 0xff, 0xb5, 0xb5, 0xb5, 0xff, 0xb5, 0xb5, 0xb5, 0xf8, 0xb6, 0xb6, 
+  0xb6, 0xef, 0xb6, 0xb6, 0xb6, 0xe3, 0xb5, 0xb5, 0xb5, 0xac, 0xb5, 0xb5, 0xb5, 0x5b, 0xe7, 0xe7, 0xe7, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf5, 0xf5, 0xf5, 0x03, 0xe2, 0xe2, 0xe2, 0x07, 
+  0xd1, 0xd1, 0xd1, 0x0f, 0xd4, 0xd4, 0xd4, 0x07, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xd9, 0xd9, 0x04, 0xd5, 0xd5, 0xd5, 0x07, 0xe6, 0xe6, 0xe6, 0x03, 0x96, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 
+  0xff, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x03, 0xe5, 0xe5, 0xe5, 0x03, 0xcb, 0xcb, 0xcb, 0x07, 0xd8, 0xd8, 0xd8, 0x07, 0xc9, 0xc9, 0xc9, 0x04, 0xc2, 0xc2, 0xc2, 0x04, 0xd8, 0xd8, 
+  0xd8, 0x04, 0xdc, 0xdc, 0xdc, 0x0b, 0xd2, 0xd2, 0xd2, 0x18, 0xd2, 0xd2, 0xd2, 0x1c, 0xd9, 0xd9, 0xd9, 0x2b, 0xd6, 0xd6, 0xd6, 0x23, 0xd8, 0xd8, 0xd8, 0x10, 0xd6, 0xd6, 0xd6, 0x07, 0xff, 0xff, 
+  0xff, 0x03, 0xd9, 0xd9, 0xd9, 0x07, 0xd2, 0xd2, 0xd2, 0x13, 0xc4, 0xc4, 0xc4, 0x28, 0xc9, 0xc9, 0xc9, 0x3f, 0xc8, 0xc8, 0xc8, 0x48, 0xc9, 0xc9, 0xc9, 0x50, 0xc0, 0xc0, 0xc0, 0x4b, 0xb7, 0xb7, 
+  0xb7, 0x34, 0xb4, 0xb4, 0xb4, 0x2b, 0xb4, 0xb4, 0xb4, 0x20, 0xbf, 0xbf, 0xbf, 0x14, 0xf0, 0xf0, 0xf0, 0x04, 0x81, 0xe6, 0xe6, 0xe6, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf2, 0xf2, 0xf2, 
+  0x03, 0xfc, 0xfc, 0xfc, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0xe7, 0x03, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 
+  0xff, 0x03, 0x04, 0xc5, 0xc5, 0xc5, 0x04, 0xc2, 0xc2, 0xc2, 0x04, 0xfc, 0xfc, 0xfc, 0x03, 0xce, 0xce, 0xce, 0x03, 0xcf, 0xcf, 0xcf, 0x07, 0x81, 0xdd, 0xdd, 0xdd, 0x07, 0x07, 0xce, 0xce, 0xce, 
+  0x13, 0xd8, 0xd8, 0xd8, 0x24, 0xd3, 0xd3, 0xd3, 0x1c, 0xdd, 0xdd, 0xdd, 0x07, 0xe3, 0xe3, 0xe3, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xc7, 0x03, 0xdd, 0xdd, 0xdd, 0x07, 0x82, 0xdb, 0xdb, 
+  0xdb, 0x0b, 0x02, 0xd3, 0xd3, 0xd3, 0x0f, 0xda, 0xda, 0xda, 0x08, 0xc7, 0xc7, 0xc7, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd4, 0xd4, 0xd4, 0x04, 0xcf, 0xcf, 0xcf, 0x03, 0xa6, 0x00, 0x00, 
+  0x00, 0x00, 0x0b, 0xfd, 0xfd, 0xfd, 0x03, 0xf2, 0xf2, 0xf2, 0x03, 0xc1, 0xc1, 0xc1, 0x04, 0xff, 0xff, 0xff, 0x03, 0xe0, 0xe0, 0xe0, 0x03, 0xbc, 0xbc, 0xbc, 0x04, 0xf3, 0xf3, 0xf3, 0x03, 0xd0, 
+  0xd0, 0xd0, 0x04, 0xd0, 0xd0, 0xd0, 0x08, 0xd1, 0xd1, 0xd1, 0x14, 0xda, 0xda, 0xda, 0x0c, 0xed, 0xed, 0xed, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xdf, 0xdf, 0x03, 0xd6, 0xd6, 0xd6, 
+  0x03, 0xe5, 0xe5, 0xe5, 0x03, 0xe4, 0xe4, 0xe4, 0x03, 0xe7, 0xe7, 0xe7, 0x03, 0xc1, 0xc1, 0xc1, 0x04, 0xff, 0xff, 0xff, 0x03, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0x83, 
+  0xff, 0xff, 0xff, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xc9, 0xc9, 0x03, 0xf7, 0xf7, 0xf7, 0x03, 0xdd, 0xdd, 0xdd, 0x07, 0xdc, 0xdc, 0xdc, 0x07, 0xeb, 0xeb, 0xeb, 0x03, 0x81, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe2, 0xe2, 0xe2, 0x03, 0xed, 0xed, 0xed, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +522,7 @@ const lv_img_dsc_t owm_50n_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( owm_50n_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = owm_50n_64px_map,
 };
-
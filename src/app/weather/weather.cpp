@@ -37,10 +37,10 @@
 
 #include "hardware/json_psram_allocator.h"
 #include "hardware/wifictl.h"
+#include "hardware/config_store.h"
+#include "hardware/jobqueue.h"
 
-EventGroupHandle_t weather_widget_event_handle = NULL;
-TaskHandle_t _weather_widget_sync_Task;
-void weather_widget_sync_Task( void * pvParameters );
+static void weather_widget_sync_job( void *arg );
 
 weather_config_t weather_config;
 weather_forcast_t weather_today;
@@ -52,6 +52,8 @@ icon_t *weather_app = NULL;
 icon_t * weather_widget = NULL;
 
 static void enter_weather_widget_event_cb( lv_obj_t * obj, lv_event_t event );
+static void weather_app_create_cb( void );
+static void weather_app_destroy_cb( void );
 bool weather_widget_wifictl_event_cb( EventBits_t event, void *arg );
 
 LV_IMG_DECLARE(owm_01d_64px);
@@ -67,9 +69,11 @@ void weather_app_setup( void ) {
     weather_app_tile_num = mainbar_add_app_tile( 1, 2, "Weather App" );
     weather_app_setup_tile_num = weather_app_tile_num + 1;
 
-    // init forecast and setup tile
-    weather_forecast_tile_setup( weather_app_tile_num );
-    weather_setup_tile_setup( weather_app_setup_tile_num );
+    // forecast and setup tile are build on the first use and deleted when not used for a while,
+    // the forecast data and the wifictl/blectl callbacks are needed before and set up now
+    weather_forecast_setup();
+    weather_setup_register_cb();
+    mainbar_add_app_tile_lifecycle_cb( weather_app_tile_num, weather_app_create_cb, weather_app_destroy_cb );
 
     weather_app = app_register( "weather", &owm_01d_64px, enter_weather_widget_event_cb );    
 
@@ -82,11 +86,25 @@ void weather_app_setup( void ) {
         widget_set_extended_label( weather_widget, "n/a" );
     }
 
-    weather_widget_event_handle = xEventGroupCreate();
-
     wifictl_register_cb( WIFICTL_OFF | WIFICTL_CONNECT, weather_widget_wifictl_event_cb, "weather" );
 }
 
+/*
+ * init forecast and setup tile, see weather_forecast.cpp and weather_setup.cpp
+ */
+static void weather_app_create_cb( void ) {
+    weather_forecast_tile_setup( weather_app_tile_num );
+    weather_setup_tile_setup( weather_app_setup_tile_num );
+}
+
+/*
+ * forget all objects, the tiles are already cleaned
+ */
+static void weather_app_destroy_cb( void ) {
+    weather_forecast_tile_destroy();
+    weather_setup_tile_destroy();
+}
+
 bool weather_widget_wifictl_event_cb( EventBits_t event, void *arg ) {
     switch( event ) {
         case WIFICTL_CONNECT:       if ( weather_config.autosync ) {
@@ -126,85 +144,47 @@ void weather_jump_to_setup( void ) {
 }
 
 void weather_widget_sync_request( void ) {
-    if ( xEventGroupGetBits( weather_widget_event_handle ) & WEATHER_WIDGET_SYNC_REQUEST ) {
-        return;
-    }
-    else {
-        xEventGroupSetBits( weather_widget_event_handle, WEATHER_WIDGET_SYNC_REQUEST );
-        widget_hide_indicator( weather_widget );
-        xTaskCreate(    weather_widget_sync_Task,       /* Function to implement the task */
-                        "weather widget sync Task",     /* Name of the task */
-                        5000,                           /* Stack size in words */
-                        NULL,                           /* Task input parameter */
-                        1,                              /* Priority of the task */
-                        &_weather_widget_sync_Task );   /* Task handle. */
-    }
+    jobqueue_submit( weather_widget_sync_job, NULL, JOBQUEUE_PRIO_NORMAL, JOBQUEUE_NETWORK, "weather widget sync" );
 }
 
 weather_config_t *weather_get_config( void ) {
     return( &weather_config );
 }
 
-void weather_widget_sync_Task( void * pvParameters ) {
-    log_i("start weather widget task, heap: %d", ESP.getFreeHeap() );
+static void weather_widget_sync_job( void *arg ) {
+    log_i("start weather widget job, heap: %d", ESP.getFreeHeap() );
 
+    widget_hide_indicator( weather_widget );
     vTaskDelay( 250 );
 
-    if ( xEventGroupGetBits( weather_widget_event_handle ) & WEATHER_WIDGET_SYNC_REQUEST ) {       
-        uint32_t retval = weather_fetch_today( &weather_config, &weather_today );
-        if ( retval == 200 ) {
-            widget_set_label( weather_widget, weather_today.temp );
-            widget_set_icon( weather_widget, (lv_obj_t*)resolve_owm_icon( weather_today.icon ) );
-            widget_set_indicator( weather_widget, ICON_INDICATOR_OK );
+    uint32_t retval = weather_fetch_today( &weather_config, &weather_today );
+    if ( retval == 200 ) {
+        widget_set_label( weather_widget, weather_today.temp );
+        widget_set_icon( weather_widget, (lv_obj_t*)resolve_owm_icon( weather_today.icon ) );
+        widget_set_indicator( weather_widget, ICON_INDICATOR_OK );
 
-            if ( weather_config.showWind ) {
-                widget_set_extended_label( weather_widget, weather_today.wind );
-            }
-            else {
-                widget_set_extended_label( weather_widget, "" );
-            }
+        if ( weather_config.showWind ) {
+            widget_set_extended_label( weather_widget, weather_today.wind );
         }
         else {
-            widget_set_indicator( weather_widget, ICON_INDICATOR_FAIL );
+            widget_set_extended_label( weather_widget, "" );
         }
-        lv_obj_invalidate( lv_scr_act() );
     }
-    xEventGroupClearBits( weather_widget_event_handle, WEATHER_WIDGET_SYNC_REQUEST );
-    log_i("finish weather widget task, heap: %d", ESP.getFreeHeap() );
-    vTaskDelete( NULL );
+    else {
+        widget_set_indicator( weather_widget, ICON_INDICATOR_FAIL );
+    }
+    lv_obj_invalidate( lv_scr_act() );
+    log_i("finish weather widget job, heap: %d", ESP.getFreeHeap() );
 }
 
 void weather_save_config( void ) {
-    if ( SPIFFS.exists( WEATHER_CONFIG_FILE ) ) {
-        SPIFFS.remove( WEATHER_CONFIG_FILE );
-        log_i("remove old binary weather config");
-    }
-
-    fs::File file = SPIFFS.open( WEATHER_JSON_CONFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", WEATHER_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["apikey"] = weather_config.apikey;
-        doc["lat"] = weather_config.lat;
-        doc["lon"] = weather_config.lon;
-        doc["autosync"] = weather_config.autosync;
-        doc["showWind"] = weather_config.showWind;
-        doc["imperial"] = weather_config.imperial;
-        doc["widget"] = weather_config.widget;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &weather_config );
 }
 
-void weather_load_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void weather_load_json_config( void ) {
     if ( SPIFFS.exists( WEATHER_JSON_CONFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( WEATHER_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -254,3 +234,7 @@ void weather_load_config( void ) {
     }
 }
 
+void weather_load_config( void ) {
+    config_store_register( "weather", &weather_config, sizeof( weather_config ), weather_load_json_config );
+}
+
@@ -27,8 +27,6 @@
     #define WEATHER_CONFIG_FILE             "/weather.cfg"
     #define WEATHER_JSON_CONFIG_FILE        "/weather.json"
 
-    #define WEATHER_WIDGET_SYNC_REQUEST    _BV(0)
-
     typedef struct {
         char version = 2;
         char apikey[64] = "";
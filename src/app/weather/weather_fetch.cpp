@@ -21,95 +21,92 @@
  */
 #include "config.h"
 #include "HTTPClient.h"
+#include <esp_timer.h>
 
 #include "weather.h"
 #include "weather_fetch.h"
+#include "weather_filter.h"
 #include "weather_forecast.h"
 
 #include "hardware/powermgm.h"
 #include "hardware/json_psram_allocator.h"
+#include "hardware/http_cache.h"
 
 /* Utility function to convert numbers to directions */
 static void weather_wind_to_string( weather_forcast_t* container, int speed, int directionDegree);
+static bool weather_today_parse( HTTPClient *today_client, void *data, void *arg );
+static bool weather_forecast_parse( HTTPClient *forecast_client, void *data, void *arg );
 
 int weather_fetch_today( weather_config_t *weather_config, weather_forcast_t *weather_today ) {
     char url[512]="";
-    int httpcode = -1;
-    const char* weather_units_symbol = weather_config->imperial ? "F" : "C";
     const char* weather_units_char = weather_config->imperial ? "imperial" : "metric";
     
     snprintf( url, sizeof( url ), "http://%s/data/2.5/weather?lat=%s&lon=%s&appid=%s&units=%s", OWM_HOST, weather_config->lat, weather_config->lon, weather_config->apikey, weather_units_char);
 
-    HTTPClient today_client;
+    return( http_cache_get( url, weather_today, sizeof( weather_forcast_t ), weather_today_parse, weather_config, 0 ) );
+}
 
-    today_client.useHTTP10( true );
-    today_client.begin( url );
-    httpcode = today_client.GET();
+static bool weather_today_parse( HTTPClient *today_client, void *data, void *arg ) {
+    weather_config_t *weather_config = (weather_config_t *)arg;
+    weather_forcast_t *weather_today = (weather_forcast_t *)data;
+    const char* weather_units_symbol = weather_config->imperial ? "F" : "C";
 
-    if ( httpcode != 200 ) {
-        log_e("HTTPClient error %d", httpcode, url );
-        today_client.end();
-        return( -1 );
-    }
+    uint64_t start = esp_timer_get_time();
+    SpiRamJsonDocument filter( WEATHER_FILTER_BUFFER_SIZE );
+    weather_today_filter( filter );
 
-    SpiRamJsonDocument doc( today_client.getSize() * 2 );
+    SpiRamJsonDocument doc( WEATHER_TODAY_BUFFER_SIZE );
 
-    DeserializationError error = deserializeJson( doc, today_client.getStream() );
+    DeserializationError error = deserializeJson( doc, today_client->getStream(), DeserializationOption::Filter( filter ) );
     if (error) {
         log_e("weather today deserializeJson() failed: %s", error.c_str() );
         doc.clear();
-        today_client.end();
-        return( -1 );
+        return( false );
     }
-
-    today_client.end();
+    log_d("weather today decoded in %dus, %d bytes json memory", (uint32_t)( esp_timer_get_time() - start ), doc.memoryUsage() );
 
     weather_today->valide = true;
     snprintf( weather_today->temp, sizeof( weather_today->temp ), "%0.1f°%s", doc["main"]["temp"].as<float>(), weather_units_symbol);
     snprintf( weather_today->humidity, sizeof( weather_today->humidity ),"%f%%", doc["main"]["humidity"].as<float>() );
     snprintf( weather_today->pressure, sizeof( weather_today->pressure ),"%fpha", doc["main"]["pressure"].as<float>() );
-    strcpy( weather_today->icon, doc["weather"][0]["icon"] );
-    strcpy( weather_today->name, doc["name"] );
+    strlcpy( weather_today->icon, doc["weather"][0]["icon"] | "n/a", sizeof( weather_today->icon ) );
+    strlcpy( weather_today->name, doc["name"] | "n/a", sizeof( weather_today->name ) );
 
     int directionDegree = doc["wind"]["deg"].as<int>();
     int speed = doc["wind"]["speed"].as<int>();
     weather_wind_to_string( weather_today, speed, directionDegree );
 
     doc.clear();
-    return( httpcode );
+    return( true );
 }
 
 int weather_fetch_forecast( weather_config_t *weather_config, weather_forcast_t * weather_forecast ) {
     char url[512]="";
-    int httpcode = -1;
-    const char* weather_units_symbol = weather_config->imperial ? "F" : "C";
     const char* weather_units_char = weather_config->imperial ? "imperial" : "metric";
 
     snprintf( url, sizeof( url ), "http://%s/data/2.5/forecast?cnt=%d&lat=%s&lon=%s&appid=%s&units=%s", OWM_HOST, WEATHER_MAX_FORECAST, weather_config->lat, weather_config->lon, weather_config->apikey, weather_units_char);
 
-    HTTPClient forecast_client;
+    return( http_cache_get( url, weather_forecast, sizeof( weather_forcast_t ) * WEATHER_MAX_FORECAST, weather_forecast_parse, weather_config, 0 ) );
+}
 
-    forecast_client.useHTTP10( true );
-    forecast_client.begin( url );
-    httpcode = forecast_client.GET();
+static bool weather_forecast_parse( HTTPClient *forecast_client, void *data, void *arg ) {
+    weather_config_t *weather_config = (weather_config_t *)arg;
+    weather_forcast_t *weather_forecast = (weather_forcast_t *)data;
+    const char* weather_units_symbol = weather_config->imperial ? "F" : "C";
 
-    if ( httpcode != 200 ) {
-        log_e("HTTPClient error %d", httpcode, url );
-        forecast_client.end();
-        return( -1 );
-    }
+    uint64_t start = esp_timer_get_time();
+    SpiRamJsonDocument filter( WEATHER_FILTER_BUFFER_SIZE );
+    weather_forecast_filter( filter );
 
-    SpiRamJsonDocument doc( forecast_client.getSize() * 2 );
+    SpiRamJsonDocument doc( WEATHER_FORECAST_BUFFER_SIZE );
 
-    DeserializationError error = deserializeJson( doc, forecast_client.getStream() );
+    DeserializationError error = deserializeJson( doc, forecast_client->getStream(), DeserializationOption::Filter( filter ) );
     if (error) {
         log_e("weather forecast deserializeJson() failed: %s", error.c_str() );
         doc.clear();
-        forecast_client.end();
-        return( -1 );
+        return( false );
     }
-
-    forecast_client.end();
+    log_d("weather forecast decoded in %dus, %d bytes json memory", (uint32_t)( esp_timer_get_time() - start ), doc.memoryUsage() );
 
     weather_forecast[0].valide = true;
     for ( int i = 0 ; i < WEATHER_MAX_FORECAST ; i++ ) {
@@ -126,7 +123,7 @@ int weather_fetch_forecast( weather_config_t *weather_config, weather_forcast_t
     }
 
     doc.clear();
-    return( httpcode );
+    return( true );
 }
 
 void weather_wind_to_string( weather_forcast_t* container, int speed, int directionDegree )
@@ -25,9 +25,6 @@
     #define OWM_HOST    "api.openweathermap.org"
     #define OWM_PORT    80
 
-    #define WEATHER_TODAY_BUFFER_SIZE       10000
-    #define WEATHER_FORECAST_BUFFER_SIZE    40000
-
     int weather_fetch_today( weather_config_t * weather_config, weather_forcast_t * weather_today );
     int weather_fetch_forecast( weather_config_t *weather_config, weather_forcast_t * weather_forecast );
 
@@ -0,0 +1,50 @@
+/****************************************************************************
+ *   Nov 06 09:14:52 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "weather_filter.h"
+
+/*
+ * only keep the fields we use, the document size is independent of the response size
+ */
+void weather_today_filter( JsonDocument &filter ) {
+    filter["name"] = true;
+    filter["main"]["temp"] = true;
+    filter["main"]["humidity"] = true;
+    filter["main"]["pressure"] = true;
+    filter["weather"][0]["icon"] = true;
+    filter["wind"]["speed"] = true;
+    filter["wind"]["deg"] = true;
+}
+
+/*
+ * the filter is applied while the stream is read, only the picked fields of
+ * the WEATHER_MAX_FORECAST list entrys end up in the document
+ */
+void weather_forecast_filter( JsonDocument &filter ) {
+    filter["city"]["name"] = true;
+    filter["list"][0]["dt"] = true;
+    filter["list"][0]["main"]["temp"] = true;
+    filter["list"][0]["main"]["humidity"] = true;
+    filter["list"][0]["main"]["pressure"] = true;
+    filter["list"][0]["weather"][0]["icon"] = true;
+    filter["list"][0]["wind"]["speed"] = true;
+    filter["list"][0]["wind"]["deg"] = true;
+}
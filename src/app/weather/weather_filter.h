@@ -0,0 +1,48 @@
+/****************************************************************************
+ *   Nov 06 09:14:52 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _WEATHER_FILTER_H
+    #define _WEATHER_FILTER_H
+
+    #include <ArduinoJson.h>
+
+    #define WEATHER_FILTER_BUFFER_SIZE      1000    // json filter with the picked fields
+    #define WEATHER_TODAY_BUFFER_SIZE       1000    // filtered weather response
+    /**
+     * filtered forecast response with WEATHER_MAX_FORECAST entrys, not measured on the
+     * watch, check the usage with tools/weather_forecast_bench.cpp before shrinking it
+     */
+    #define WEATHER_FORECAST_BUFFER_SIZE    8000
+
+    /**
+     * @brief   build the filter for the openweathermap current weather response
+     *
+     * @param   filter      json document with WEATHER_FILTER_BUFFER_SIZE
+     */
+    void weather_today_filter( JsonDocument &filter );
+    /**
+     * @brief   build the filter for the openweathermap forecast response
+     *
+     * @param   filter      json document with WEATHER_FILTER_BUFFER_SIZE
+     */
+    void weather_forecast_filter( JsonDocument &filter );
+
+#endif // _WEATHER_FILTER_H
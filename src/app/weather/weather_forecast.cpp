@@ -34,9 +34,7 @@
 
 #include "hardware/powermgm.h"
 #include "hardware/wifictl.h"
-
-EventGroupHandle_t weather_forecast_event_handle = NULL;
-TaskHandle_t _weather_forecast_sync_Task;
+#include "hardware/jobqueue.h"
 
 lv_obj_t *weather_forecast_tile = NULL;
 lv_style_t weather_forecast_style;
@@ -49,9 +47,17 @@ lv_obj_t *weather_forecast_icon_imgbtn[ WEATHER_MAX_FORECAST ];
 lv_obj_t *weather_forecast_temperature_label[ WEATHER_MAX_FORECAST ];
 lv_obj_t *weather_forecast_wind_label[ WEATHER_MAX_FORECAST ];
 
-static weather_forcast_t *weather_forecast = NULL;
-
-void weather_forecast_sync_Task( void * pvParameters );
+static lv_task_t *weather_forecast_task = NULL;
+static SemaphoreHandle_t weather_forecast_mutex = NULL;
+static weather_forcast_t *weather_forecast = NULL;           // shown on the tile, under weather_forecast_mutex
+static weather_forcast_t *weather_forecast_fetch = NULL;     // written by the sync job only
+static bool weather_forecast_valid = false;
+static volatile bool weather_forecast_changed = false;
+static char weather_forecast_update[64] = "";
+
+static void weather_forecast_sync_job( void *arg );
+static void weather_forecast_task_cb( lv_task_t *task );
+static void weather_forecast_tile_update( void );
 bool weather_forecast_wifictl_event_cb( EventBits_t event, void *arg );
 
 LV_IMG_DECLARE(exit_32px);
@@ -63,14 +69,21 @@ static void exit_weather_widget_event_cb( lv_obj_t * obj, lv_event_t event );
 static void setup_weather_widget_event_cb( lv_obj_t * obj, lv_event_t event );
 static void refresh_weather_widget_event_cb( lv_obj_t * obj, lv_event_t event );
 
-void weather_forecast_tile_setup( uint32_t tile_num ) {
+void weather_forecast_setup( void ) {
 
     weather_forecast = (weather_forcast_t*)ps_calloc( sizeof( weather_forcast_t ) * WEATHER_MAX_FORECAST , 1 );
-    if( !weather_forecast ) {
+    weather_forecast_fetch = (weather_forcast_t*)ps_calloc( sizeof( weather_forcast_t ) * WEATHER_MAX_FORECAST , 1 );
+    weather_forecast_mutex = xSemaphoreCreateMutex();
+    if( !weather_forecast || !weather_forecast_fetch || !weather_forecast_mutex ) {
       log_e("weather forecast calloc faild");
       while(true);
     }
 
+    wifictl_register_cb( WIFICTL_OFF | WIFICTL_CONNECT, weather_forecast_wifictl_event_cb, "weather forcecast" );
+}
+
+void weather_forecast_tile_setup( uint32_t tile_num ) {
+
     weather_forecast_tile_num = tile_num;
     weather_forecast_tile = mainbar_get_tile_obj( weather_forecast_tile_num );
     lv_style_copy( &weather_forecast_style, mainbar_get_style() );
@@ -142,9 +155,30 @@ void weather_forecast_tile_setup( uint32_t tile_num ) {
         lv_obj_align( weather_forecast_time_label[ i ], weather_forecast_icon_imgbtn[ i ], LV_ALIGN_OUT_TOP_MID, 0, 0);
     }
 
-    weather_forecast_event_handle = xEventGroupCreate();
+    // show the last forecast fetched while the tile did not exist
+    weather_forecast_tile_update();
+    weather_forecast_task = lv_task_create( weather_forecast_task_cb, 500, LV_TASK_PRIO_LOWEST, NULL );
+}
 
-    wifictl_register_cb( WIFICTL_OFF | WIFICTL_CONNECT, weather_forecast_wifictl_event_cb, "weather forcecast" );
+void weather_forecast_tile_destroy( void ) {
+    /*
+     * a running sync job only stores the forecast, no need to wait for it
+     */
+    jobqueue_cancel_job( weather_forecast_sync_job, NULL );
+    if ( weather_forecast_task ) {
+        lv_task_del( weather_forecast_task );
+        weather_forecast_task = NULL;
+    }
+    lv_style_reset( &weather_forecast_style );
+    weather_forecast_tile = NULL;
+    weather_forecast_location_label = NULL;
+    weather_forecast_update_label = NULL;
+    for ( int i = 0 ; i < WEATHER_MAX_FORECAST / 4 ; i++ ) {
+        weather_forecast_time_label[ i ] = NULL;
+        weather_forecast_icon_imgbtn[ i ] = NULL;
+        weather_forecast_temperature_label[ i ] = NULL;
+        weather_forecast_wind_label[ i ] = NULL;
+    }
 }
 
 bool weather_forecast_wifictl_event_cb( EventBits_t event, void *arg ) {
@@ -181,73 +215,90 @@ static void refresh_weather_widget_event_cb( lv_obj_t * obj, lv_event_t event )
 }
 
 void weather_forecast_sync_request( void ) {
-    if ( xEventGroupGetBits( weather_forecast_event_handle ) & WEATHER_FORECAST_SYNC_REQUEST ) {
-        return;
-    }
-    else {
-        xEventGroupSetBits( weather_forecast_event_handle, WEATHER_FORECAST_SYNC_REQUEST );
-        xTaskCreate(    weather_forecast_sync_Task,      /* Function to implement the task */
-                        "weather forecast sync Task",    /* Name of the task */
-                        5000,                            /* Stack size in words */
-                        NULL,                            /* Task input parameter */
-                        1,                               /* Priority of the task */
-                        &_weather_forecast_sync_Task );  /* Task handle. */ 
-    }
+    jobqueue_submit( weather_forecast_sync_job, NULL, JOBQUEUE_PRIO_NORMAL, JOBQUEUE_NETWORK, "weather forecast sync" );
 }
 
-void weather_forecast_sync_Task( void * pvParameters ) {
+static void weather_forecast_sync_job( void *arg ) {
     weather_config_t *weather_config = weather_get_config();
     int32_t retval = -1;
 
-    log_i("start weather forecast task, heap: %d", ESP.getFreeHeap() );
+    log_i("start weather forecast job, heap: %d", ESP.getFreeHeap() );
 
     vTaskDelay( 250 );
 
-    if ( xEventGroupGetBits( weather_forecast_event_handle ) & WEATHER_FORECAST_SYNC_REQUEST ) {   
-        if ( weather_config->autosync ) {
-            retval = weather_fetch_forecast( weather_get_config() , &weather_forecast[ 0 ] );
-            if ( retval == 200 ) {
-                time_t now;
-                struct tm info;
-                char buf[64];
-
-                lv_label_set_text( weather_forecast_location_label, weather_forecast[ 0 ].name );
-
-                for( int i = 0 ; i < WEATHER_MAX_FORECAST / 4 ; i++ ) {
-                    lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_RELEASED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
-                    lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_PRESSED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
-                    lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_CHECKED_RELEASED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
-                    lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_CHECKED_PRESSED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
-
-                    lv_label_set_text( weather_forecast_temperature_label[ i ], weather_forecast[ i * 2 ].temp );
-
-                    if(weather_config->showWind)
-                    {
-                        lv_obj_align(weather_forecast_temperature_label[i], weather_forecast_icon_imgbtn[i], LV_ALIGN_OUT_BOTTOM_MID, 0, -22);
-                        lv_label_set_text(weather_forecast_wind_label[i], weather_forecast[i * 2].wind);
-                        lv_obj_align(weather_forecast_wind_label[i], weather_forecast_icon_imgbtn[i], LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
-                    }
-                    else
-                    {
-                        lv_obj_align(weather_forecast_temperature_label[i], weather_forecast_icon_imgbtn[i], LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
-                        lv_label_set_text(weather_forecast_wind_label[i], "");
-                    }
-
-                    localtime_r( &weather_forecast[ i * 2 ].timestamp, &info );
-                    strftime( buf, sizeof(buf), "%H:%M", &info );
-                    lv_label_set_text( weather_forecast_time_label[ i ], buf );
-                    lv_obj_align( weather_forecast_time_label[ i ], weather_forecast_icon_imgbtn[ i ], LV_ALIGN_OUT_TOP_MID, 0, 0);
-                }
-
-                time( &now );
-                localtime_r( &now, &info );
-                strftime( buf, sizeof(buf), "updated: %d.%b %H:%M", &info );
-                lv_label_set_text( weather_forecast_update_label, buf );
-                lv_obj_invalidate( lv_scr_act() );
-            }
+    /*
+     * runs on a jobqueue worker, the tile is updated from the gui task, see weather_forecast_task_cb()
+     */
+    if ( weather_config->autosync ) {
+        retval = weather_fetch_forecast( weather_get_config() , &weather_forecast_fetch[ 0 ] );
+        if ( retval == 200 ) {
+            time_t now;
+            struct tm info;
+
+            time( &now );
+            localtime_r( &now, &info );
+            xSemaphoreTake( weather_forecast_mutex, portMAX_DELAY );
+            memcpy( weather_forecast, weather_forecast_fetch, sizeof( weather_forcast_t ) * WEATHER_MAX_FORECAST );
+            strftime( weather_forecast_update, sizeof( weather_forecast_update ), "updated: %d.%b %H:%M", &info );
+            weather_forecast_valid = true;
+            xSemaphoreGive( weather_forecast_mutex );
+            weather_forecast_changed = true;
+        }
+    }
+    log_i("finish weather forecast job, heap: %d", ESP.getFreeHeap() );
+}
+
+static void weather_forecast_task_cb( lv_task_t *task ) {
+    if ( weather_forecast_changed ) {
+        weather_forecast_changed = false;
+        weather_forecast_tile_update();
+    }
+}
+
+static void weather_forecast_tile_update( void ) {
+    weather_config_t *weather_config = weather_get_config();
+    struct tm info;
+    char buf[64];
+
+    if ( weather_forecast_tile == NULL ) {
+        return;
+    }
+
+    xSemaphoreTake( weather_forecast_mutex, portMAX_DELAY );
+    if ( !weather_forecast_valid ) {
+        xSemaphoreGive( weather_forecast_mutex );
+        return;
+    }
+
+    lv_label_set_text( weather_forecast_location_label, weather_forecast[ 0 ].name );
+
+    for( int i = 0 ; i < WEATHER_MAX_FORECAST / 4 ; i++ ) {
+        lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_RELEASED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
+        lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_PRESSED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
+        lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_CHECKED_RELEASED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
+        lv_imgbtn_set_src( weather_forecast_icon_imgbtn[ i ], LV_BTN_STATE_CHECKED_PRESSED, resolve_owm_icon( weather_forecast[ i * 2 ].icon ) );
+
+        lv_label_set_text( weather_forecast_temperature_label[ i ], weather_forecast[ i * 2 ].temp );
+
+        if(weather_config->showWind)
+        {
+            lv_obj_align(weather_forecast_temperature_label[i], weather_forecast_icon_imgbtn[i], LV_ALIGN_OUT_BOTTOM_MID, 0, -22);
+            lv_label_set_text(weather_forecast_wind_label[i], weather_forecast[i * 2].wind);
+            lv_obj_align(weather_forecast_wind_label[i], weather_forecast_icon_imgbtn[i], LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
         }
+        else
+        {
+            lv_obj_align(weather_forecast_temperature_label[i], weather_forecast_icon_imgbtn[i], LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
+            lv_label_set_text(weather_forecast_wind_label[i], "");
+        }
+
+        localtime_r( &weather_forecast[ i * 2 ].timestamp, &info );
+        strftime( buf, sizeof(buf), "%H:%M", &info );
+        lv_label_set_text( weather_forecast_time_label[ i ], buf );
+        lv_obj_align( weather_forecast_time_label[ i ], weather_forecast_icon_imgbtn[ i ], LV_ALIGN_OUT_TOP_MID, 0, 0);
     }
-    xEventGroupClearBits( weather_forecast_event_handle, WEATHER_FORECAST_SYNC_REQUEST );
-    log_i("finsh weather forecast task, heap: %d", ESP.getFreeHeap() );
-    vTaskDelete( NULL );
+
+    lv_label_set_text( weather_forecast_update_label, weather_forecast_update );
+    xSemaphoreGive( weather_forecast_mutex );
+    lv_obj_invalidate( lv_scr_act() );
 }
@@ -3,10 +3,25 @@
 
     #include <TTGO.h>
 
-    #define WEATHER_FORECAST_SYNC_REQUEST   _BV(0)
     #define WEATHER_MAX_FORECAST            16
 
+    /**
+     * @brief alloc the forecast data and register the wifictl callback, must be called at setup time
+     */
+    void weather_forecast_setup( void );
+    /**
+     * @brief build the forecast tile, called on the first use of the app
+     *
+     * @param   tile_num    tile number of the forecast tile
+     */
     void weather_forecast_tile_setup( uint32_t tile_num );
+    /**
+     * @brief forget all objects of the forecast tile after the tile is cleaned
+     */
+    void weather_forecast_tile_destroy( void );
+    /**
+     * @brief fetch the forecast in the background, the tile is updated if it exists
+     */
     void weather_forecast_sync_request( void );
 
 #endif // _WEATHER_FORECAST_H
\ No newline at end of file
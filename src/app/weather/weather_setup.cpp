@@ -33,6 +33,7 @@
 #include "hardware/blectl.h"
 #include "hardware/motor.h"
 #include "hardware/json_psram_allocator.h"
+#include "hardware/json_msg.h"
 
 lv_obj_t *weather_setup_tile = NULL;
 lv_style_t weather_setup_style;
@@ -58,7 +59,7 @@ static void weather_imperial_onoff_event_handler( lv_obj_t *obj, lv_event_t even
 static void weather_widget_onoff_event_handler(lv_obj_t *obj, lv_event_t event);
 
 bool weather_bluetooth_message_event_cb( EventBits_t event, void *arg );
-static void weather_bluetooth_message_msg_pharse( const char* msg );
+static void weather_bluetooth_message_msg_pharse( JsonDocument &doc );
 
 void weather_setup_tile_setup( uint32_t tile_num ) {
 
@@ -232,8 +233,23 @@ void weather_setup_tile_setup( uint32_t tile_num ) {
         lv_switch_on( weather_widget_onoff, LV_ANIM_OFF );
     else
         lv_switch_off( weather_widget_onoff, LV_ANIM_OFF );
+}
+
+void weather_setup_tile_destroy( void ) {
+    lv_style_reset( &weather_setup_style );
+    weather_setup_tile = NULL;
+    weather_geolocation_onoff = NULL;
+    weather_apikey_textfield = NULL;
+    weather_lat_textfield = NULL;
+    weather_lon_textfield = NULL;
+    weather_autosync_onoff = NULL;
+    weather_wind_onoff = NULL;
+    weather_imperial_onoff = NULL;
+    weather_widget_onoff = NULL;
+}
 
-    blectl_register_cb( BLECTL_MSG, weather_bluetooth_message_event_cb, "weather setup" );
+void weather_setup_register_cb( void ) {
+    blectl_register_cb( BLECTL_MSG_JSON, weather_bluetooth_message_event_cb, "weather setup" );
 }
 
 static void weather_textarea_event_cb( lv_obj_t * obj, lv_event_t event ) {
@@ -295,21 +311,15 @@ static void exit_weather_widget_setup_event_cb( lv_obj_t * obj, lv_event_t event
 
 bool weather_bluetooth_message_event_cb( EventBits_t event, void *arg ) {
     switch( event ) {
-        case BLECTL_MSG:            weather_bluetooth_message_msg_pharse( (const char*)arg );
+        case BLECTL_MSG_JSON:       weather_bluetooth_message_msg_pharse( *(JsonDocument*)arg );
                                     break;
     }
     return( true );
 }
 
-void weather_bluetooth_message_msg_pharse( const char* msg ) {
+void weather_bluetooth_message_msg_pharse( JsonDocument &doc ) {
 
-    SpiRamJsonDocument doc( strlen( msg ) * 4 );
-
-    DeserializationError error = deserializeJson( doc, msg );
-    if ( error ) {
-        log_e("bluetooth message deserializeJson() failed: %s", error.c_str() );
-    }
-    else {
+    if ( doc["t"] && doc["app"] ) {
         if( !strcmp( doc["t"], "conf" ) ) {
             if ( !strcmp( doc["app"], "weather" ) ) {
 
@@ -319,14 +329,16 @@ void weather_bluetooth_message_msg_pharse( const char* msg ) {
                 strlcpy( weather_config->lon, doc["lon"] | "", sizeof( weather_config->lon ) );
                 weather_save_config();
 
-                lv_textarea_set_text( weather_apikey_textfield, weather_config->apikey );
-                lv_textarea_set_text( weather_lat_textfield, weather_config->lat );
-                lv_textarea_set_text( weather_lon_textfield, weather_config->lon );
+                // the setup tile is only build while the app is in use
+                if ( weather_setup_tile != NULL ) {
+                    lv_textarea_set_text( weather_apikey_textfield, weather_config->apikey );
+                    lv_textarea_set_text( weather_lat_textfield, weather_config->lat );
+                    lv_textarea_set_text( weather_lon_textfield, weather_config->lon );
+                }
 
                 motor_vibe(100);
             }
 
         }
-    }        
-    doc.clear();
+    }
 }
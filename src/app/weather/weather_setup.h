@@ -3,6 +3,19 @@
 
     #include <TTGO.h>
 
+    /**
+     * @brief build the setup tile, called on the first use of the app
+     *
+     * @param   tile_num    tile number of the setup tile
+     */
     void weather_setup_tile_setup( uint32_t tile_num );
+    /**
+     * @brief forget all objects of the setup tile after the tile is cleaned
+     */
+    void weather_setup_tile_destroy( void );
+    /**
+     * @brief register the bluetooth callback for the weather config, must be called at setup time
+     */
+    void weather_setup_register_cb( void );
 
 #endif // _WEATHER_SETUP_H
\ No newline at end of file
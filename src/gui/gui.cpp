@@ -147,14 +147,14 @@ void gui_set_background_image ( uint32_t background_image ) {
 bool gui_powermgm_loop_event_cb( EventBits_t event, void *arg ) {
     switch ( event ) {
         case POWERMGM_WAKEUP:           if ( lv_disp_get_inactive_time( NULL ) < display_get_timeout() * 1000 || display_get_timeout() == DISPLAY_MAX_TIMEOUT ) {
-                                            lv_task_handler();
+                                            powermgm_set_next_deadline( lv_task_handler() );
                                         }
                                         else {
                                             powermgm_set_event( POWERMGM_STANDBY_REQUEST );
                                         }
                                         break;
         case POWERMGM_SILENCE_WAKEUP:   if ( lv_disp_get_inactive_time( NULL ) < display_get_timeout() * 1000 ) {
-                                            lv_task_handler();
+                                            powermgm_set_next_deadline( lv_task_handler() );
                                         }
                                         else {
                                             powermgm_set_event( POWERMGM_STANDBY_REQUEST );
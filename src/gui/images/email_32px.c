@@ -10,143 +10,157 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_EMAIL_32PX uint8_t email_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x03, 0xe9, 0x2c, 0xed, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xed, 0x38, 0xe9, 0x2c, 0xe9, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0x1b, 0xe9, 0xd0, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd0, 0xe9, 0x1c, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xab, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xab, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xe7, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0xab, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xab, 0x00, 0x00, 
-  0x00, 0x00, 0xe9, 0x1b, 0xe9, 0xd0, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xd0, 0xe9, 0x1b, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x03, 0xe9, 0x2c, 0xf2, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xf2, 0x38, 0xe9, 0x2c, 0xe9, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x81, 0x00, 0x00, 0x02, 0xe9, 0x03, 0xe9, 0x2c, 0xed, 0x38, 0x95, 0xff, 0x38, 0x02, 0xed, 0x38, 0xe9, 0x2c, 0xe9, 0x03, 0x82, 0x00, 0x00, 0x01, 0xe9, 
+  0x1b, 0xe9, 0xd0, 0x81, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x93, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x81, 0xe9, 0xff, 0x01, 0xe9, 0xd0, 0xe9, 0x1c, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xab, 0x83, 0xe9, 0xff, 
+  0x00, 0xf2, 0xff, 0x91, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x83, 0xe9, 0xff, 0x00, 0xe9, 0xab, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe7, 0x84, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xed, 
+  0xff, 0x84, 0xe9, 0xff, 0x00, 0xe9, 0xe7, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x86, 0xe9, 0xff, 0x00, 0xfb, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x86, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 
+  0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x89, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x81, 0xe9, 0xff, 
+  0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x02, 0xf2, 0xff, 0xff, 0xff, 0xed, 0xff, 0x83, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x87, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x83, 
+  0xe9, 0xff, 0x02, 0xed, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf2, 
+  0xff, 0x83, 0xe9, 0xff, 0x01, 0xed, 0xff, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xed, 0xff, 0x83, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 
+  0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x82, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x81, 0xff, 0xff, 0x00, 0xfb, 
+  0xff, 0x84, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x83, 
+  0xff, 0xff, 0x01, 0xfb, 0xff, 0xed, 0xff, 0x83, 0xe9, 0xff, 0x81, 0xf2, 0xff, 0x83, 0xe9, 0xff, 0x01, 0xed, 0xff, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 
+  0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x85, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x87, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x85, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 
+  0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x86, 0xff, 0xff, 
+  0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x87, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xe9, 0xff, 0x00, 0xfb, 
+  0xff, 0x87, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x89, 0xff, 0xff, 0x81, 0xee, 0xff, 0x00, 
+  0xfb, 0xff, 0x88, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 
+  0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 
+  0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 
+  0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 
+  0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe8, 0x81, 0x00, 
+  0x00, 0x00, 0xe9, 0xe7, 0x81, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xe7, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xab, 0x81, 0xe9, 0xff, 0x00, 
+  0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xe9, 0xab, 0x81, 0x00, 0x00, 0x03, 0xe9, 0x1b, 0xe9, 0xd0, 0xe9, 0xff, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x03, 0xf2, 0xff, 
+  0xe9, 0xff, 0xe9, 0xd0, 0xe9, 0x1b, 0x82, 0x00, 0x00, 0x02, 0xe9, 0x03, 0xe9, 0x2c, 0xf2, 0x38, 0x95, 0xff, 0x38, 0x02, 0xf2, 0x38, 0xe9, 0x2c, 0xe9, 0x03, 0xff, 0x00, 0x00, 0x81, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x03, 0x27, 0xfa, 0x2c, 0xea, 0xfa, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xea, 0xfa, 0x38, 0x27, 0xfa, 0x2c, 0x27, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0x1b, 0x27, 0xfa, 0xd0, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xf3, 0xfc, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xf3, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd0, 0x27, 0xfa, 0x1c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xab, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xcf, 0xfb, 0xff, 0x3d, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xf7, 0xff, 0xcf, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xab, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe7, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xea, 0xfa, 0xff, 0x9a, 0xf6, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xba, 0xf6, 0xff, 0xea, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe7, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x47, 0xfa, 0xff, 0xd7, 0xfd, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xd7, 0xfd, 0xff, 0x47, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xa9, 0xfa, 0xff, 0x47, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xb2, 0xfc, 0xff, 0x7e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xb2, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x47, 0xfa, 0xff, 0x89, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xdb, 0xf6, 0xff, 0x2b, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xae, 0xfb, 0xff, 0x1c, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x1c, 0xf7, 0xff, 0xae, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x0b, 0xfb, 0xff, 0x59, 0xe6, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xf7, 0xff, 0x50, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xaa, 0xfa, 0xff, 0x7a, 0xf6, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7a, 0xf6, 0xff, 0xaa, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xf4, 0xff, 0xfc, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x75, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x96, 0xfd, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x96, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xf5, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7a, 0xf6, 0xff, 0xca, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x91, 0xfc, 0xff, 0x91, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xa9, 0xfa, 0xff, 0x18, 0xee, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x3c, 0xf7, 0xff, 0xcf, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xae, 0xf3, 0xff, 0xbb, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x14, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xb3, 0xf4, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x18, 0xf6, 0xff, 0x68, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x68, 0xfa, 0xff, 0xd7, 0xed, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xfc, 0xf6, 0xff, 0x6d, 0xfb, 0xff, 0x4c, 0xfb, 0xff, 0x9a, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe7, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe7, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0xab, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xab, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0xfa, 0x1b, 0x27, 0xfa, 0xd0, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd0, 0x27, 0xfa, 0x1b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x03, 0x27, 0xfa, 0x2c, 0x10, 0xfc, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xbf, 0xf7, 0x38, 0xef, 0xfb, 0x38, 0x27, 0xfa, 0x2c, 0x27, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x02, 0x27, 0xfa, 0x03, 0x27, 0xfa, 0x2c, 0xea, 0xfa, 0x38, 0x95, 0xbf, 0xf7, 0x38, 0x02, 0xea, 0xfa, 0x38, 0x27, 0xfa, 
+  0x2c, 0x27, 0xfa, 0x03, 0x82, 0x00, 0x00, 0x00, 0x01, 0x27, 0xfa, 0x1b, 0x27, 0xfa, 0xd0, 0x81, 0x27, 0xfa, 0xff, 0x01, 0xf3, 0xfc, 0xff, 0x9e, 0xf7, 0xff, 0x91, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 
+  0xf7, 0xff, 0xf3, 0xfc, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x01, 0x27, 0xfa, 0xd0, 0x27, 0xfa, 0x1c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xab, 0x83, 0x27, 0xfa, 0xff, 0x01, 0xcf, 0xfb, 0xff, 
+  0x3d, 0xf7, 0xff, 0x8f, 0xbf, 0xf7, 0xff, 0x01, 0x3d, 0xf7, 0xff, 0xcf, 0xfb, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xab, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe7, 0x84, 0x27, 
+  0xfa, 0xff, 0x01, 0xea, 0xfa, 0xff, 0x9a, 0xf6, 0xff, 0x8d, 0xbf, 0xf7, 0xff, 0x01, 0xba, 0xf6, 0xff, 0xea, 0xfa, 0xff, 0x84, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe7, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x27, 0xfa, 0xe8, 0x85, 0x27, 0xfa, 0xff, 0x01, 0x47, 0xfa, 0xff, 0xd7, 0xfd, 0xff, 0x8b, 0xbf, 0xf7, 0xff, 0x01, 0xd7, 0xfd, 0xff, 0x47, 0xfa, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 
+  0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x01, 0xa9, 0xfa, 0xff, 0x47, 0xfa, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x7e, 0xf7, 0xff, 
+  0x87, 0xbf, 0xf7, 0xff, 0x01, 0x7e, 0xf7, 0xff, 0xb2, 0xfc, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x01, 0x47, 0xfa, 0xff, 0x89, 0xfa, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x02, 0x10, 0xfc, 0xff, 0xdb, 0xf6, 0xff, 0x2b, 0xfb, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x01, 0xae, 0xfb, 0xff, 0x1c, 0xf7, 0xff, 0x85, 
+  0xbf, 0xf7, 0xff, 0x01, 0x1c, 0xf7, 0xff, 0xae, 0xfb, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x02, 0x0b, 0xfb, 0xff, 0x59, 0xe6, 0xff, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x03, 0x10, 0xfc, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xf7, 0xff, 0x50, 0xfc, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x01, 0xaa, 0xfa, 
+  0xff, 0x7a, 0xf6, 0xff, 0x83, 0xbf, 0xf7, 0xff, 0x01, 0x7a, 0xf6, 0xff, 0xaa, 0xfa, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x03, 0x10, 0xf4, 0xff, 0xfc, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 0xff, 
+  0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x81, 0xbf, 0xf7, 0xff, 0x01, 0xbe, 0xf7, 0xff, 
+  0x75, 0xfd, 0xff, 0x84, 0x27, 0xfa, 0xff, 0x00, 0x96, 0xfd, 0xff, 0x81, 0xbf, 0xf7, 0xff, 0x00, 0x96, 0xfd, 0xff, 0x84, 0x27, 0xfa, 0xff, 0x01, 0x34, 0xf5, 0xff, 0x3d, 0xe7, 0xff, 0x81, 0x3d, 
+  0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x83, 0xbf, 
+  0xf7, 0xff, 0x01, 0x7a, 0xf6, 0xff, 0xca, 0xfa, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x81, 0x91, 0xfc, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x01, 0xa9, 0xfa, 0xff, 0x18, 0xee, 0xff, 0x83, 0x3d, 0xdf, 0xff, 
+  0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x84, 0xbf, 0xf7, 0xff, 
+  0x01, 0x3c, 0xf7, 0xff, 0xcf, 0xfb, 0xff, 0x87, 0x27, 0xfa, 0xff, 0x01, 0xae, 0xf3, 0xff, 0xbb, 0xe6, 0xff, 0x84, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 
+  0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x85, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xf7, 0xff, 0x14, 0xfd, 0xff, 0x85, 0x27, 0xfa, 
+  0xff, 0x01, 0xb3, 0xf4, 0xff, 0x1d, 0xe7, 0xff, 0x85, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 
+  0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x87, 0xbf, 0xf7, 0xff, 0x01, 0x18, 0xf6, 0xff, 0x68, 0xfa, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x01, 0x68, 0xfa, 0xff, 0xd7, 0xed, 0xff, 0x87, 0x3d, 
+  0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x88, 0xbf, 
+  0xf7, 0xff, 0x03, 0xfc, 0xf6, 0xff, 0x6d, 0xfb, 0xff, 0x4c, 0xfb, 0xff, 0x9a, 0xe6, 0xff, 0x88, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x89, 0xbf, 0xf7, 0xff, 0x01, 0x7e, 0xf7, 0xff, 0x1d, 0xe7, 0xff, 0x89, 0x3d, 0xdf, 0xff, 0x00, 0xef, 
+  0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x8b, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 
+  0xef, 0xff, 0x88, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 
+  0xfc, 0xff, 0x8c, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x86, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 
+  0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x8d, 0xbf, 0xf7, 0xff, 0x01, 0x9f, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x85, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 
+  0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x8f, 0xbf, 0xf7, 0xff, 0x00, 0x5e, 0xe7, 0xff, 
+  0x84, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 
+  0x90, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 0xef, 0xff, 0x83, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xe7, 
+  0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x91, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x81, 0x3d, 0xdf, 0xff, 0x00, 0xef, 0xf3, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 
+  0x27, 0xfa, 0xe7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xab, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x10, 0xfc, 0xff, 0x93, 0xbf, 0xf7, 0xff, 0x02, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0xef, 0xf3, 
+  0xff, 0x81, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xab, 0x81, 0x00, 0x00, 0x00, 0x03, 0x27, 0xfa, 0x1b, 0x27, 0xfa, 0xd0, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0x94, 0xbf, 0xf7, 0xff, 0x04, 0x7e, 
+  0xe7, 0xff, 0xef, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd0, 0x27, 0xfa, 0x1b, 0x82, 0x00, 0x00, 0x00, 0x02, 0x27, 0xfa, 0x03, 0x27, 0xfa, 0x2c, 0x10, 0xfc, 0x38, 0x95, 0xbf, 0xf7, 0x38, 
+  0x02, 0xef, 0xfb, 0x38, 0x27, 0xfa, 0x2c, 0x27, 0xfa, 0x03, 0xff, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x03, 0xfa, 0x27, 0x2c, 0xfa, 0xea, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xfa, 0xea, 0x38, 0xfa, 0x27, 0x2c, 0xfa, 0x27, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0x1b, 0xfa, 0x27, 0xd0, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0xf3, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfc, 0xf3, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd0, 0xfa, 0x27, 0x1c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xab, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0xcf, 0xff, 0xf7, 0x3d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x3d, 0xff, 0xfb, 0xcf, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xab, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe7, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0xea, 0xff, 0xf6, 0x9a, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0xba, 0xff, 0xfa, 0xea, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe7, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x47, 0xff, 0xfd, 0xd7, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xfd, 0xd7, 0xff, 0xfa, 0x47, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0xa9, 0xff, 0xfa, 0x47, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0xb2, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0xfc, 0xb2, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x47, 0xff, 0xfa, 0x89, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf6, 0xdb, 0xff, 0xfb, 0x2b, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0xae, 0xff, 0xf7, 0x1c, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x1c, 0xff, 0xfb, 0xae, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0x0b, 0xff, 0xe6, 0x59, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x5d, 0xff, 0xfc, 0x50, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0xaa, 0xff, 0xf6, 0x7a, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x7a, 0xff, 0xfa, 0xaa, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf4, 0x10, 0xff, 0xe6, 0xfc, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xfd, 0x75, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x96, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xfd, 0x96, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf5, 0x34, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x7a, 0xff, 0xfa, 0xca, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x91, 0xff, 0xfc, 0x91, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0xa9, 0xff, 0xee, 0x18, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x3c, 0xff, 0xfb, 0xcf, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf3, 0xae, 0xff, 0xe6, 0xbb, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfd, 0x14, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf4, 0xb3, 0xff, 0xe7, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x18, 0xff, 0xfa, 0x68, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x68, 0xff, 0xed, 0xd7, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0xfc, 0xff, 0xfb, 0x6d, 0xff, 0xfb, 0x4c, 0xff, 0xe6, 0x9a, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0xe7, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9f, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe7, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe7, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0xab, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xab, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfa, 0x27, 0x1b, 0xfa, 0x27, 0xd0, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x7e, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd0, 0xfa, 0x27, 0x1b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x03, 0xfa, 0x27, 0x2c, 0xfc, 0x10, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xf7, 0xbf, 0x38, 0xfb, 0xef, 0x38, 0xfa, 0x27, 0x2c, 0xfa, 0x27, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x02, 0xfa, 0x27, 0x03, 0xfa, 0x27, 0x2c, 0xfa, 0xea, 0x38, 0x95, 0xf7, 0xbf, 0x38, 0x02, 0xfa, 0xea, 0x38, 0xfa, 0x27, 
+  0x2c, 0xfa, 0x27, 0x03, 0x82, 0x00, 0x00, 0x00, 0x01, 0xfa, 0x27, 0x1b, 0xfa, 0x27, 0xd0, 0x81, 0xfa, 0x27, 0xff, 0x01, 0xfc, 0xf3, 0xff, 0xf7, 0x9e, 0xff, 0x91, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 
+  0x9e, 0xff, 0xfc, 0xf3, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x27, 0xd0, 0xfa, 0x27, 0x1c, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xab, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0xcf, 0xff, 
+  0xf7, 0x3d, 0xff, 0x8f, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x3d, 0xff, 0xfb, 0xcf, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xab, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe7, 0x84, 0xfa, 
+  0x27, 0xff, 0x01, 0xfa, 0xea, 0xff, 0xf6, 0x9a, 0xff, 0x8d, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0xba, 0xff, 0xfa, 0xea, 0xff, 0x84, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe7, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0xfa, 0x27, 0xe8, 0x85, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x47, 0xff, 0xfd, 0xd7, 0xff, 0x8b, 0xf7, 0xbf, 0xff, 0x01, 0xfd, 0xd7, 0xff, 0xfa, 0x47, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 
+  0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0xa9, 0xff, 0xfa, 0x47, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfc, 0xb2, 0xff, 0xf7, 0x7e, 0xff, 
+  0x87, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x7e, 0xff, 0xfc, 0xb2, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x47, 0xff, 0xfa, 0x89, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x02, 0xfc, 0x10, 0xff, 0xf6, 0xdb, 0xff, 0xfb, 0x2b, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0xae, 0xff, 0xf7, 0x1c, 0xff, 0x85, 
+  0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x1c, 0xff, 0xfb, 0xae, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x02, 0xfb, 0x0b, 0xff, 0xe6, 0x59, 0xff, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x03, 0xfc, 0x10, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x5d, 0xff, 0xfc, 0x50, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0xaa, 
+  0xff, 0xf6, 0x7a, 0xff, 0x83, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0x7a, 0xff, 0xfa, 0xaa, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x03, 0xf4, 0x10, 0xff, 0xe6, 0xfc, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 0xff, 
+  0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x81, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0xbe, 0xff, 
+  0xfd, 0x75, 0xff, 0x84, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x96, 0xff, 0x81, 0xf7, 0xbf, 0xff, 0x00, 0xfd, 0x96, 0xff, 0x84, 0xfa, 0x27, 0xff, 0x01, 0xf5, 0x34, 0xff, 0xe7, 0x3d, 0xff, 0x81, 0xdf, 
+  0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x83, 0xf7, 
+  0xbf, 0xff, 0x01, 0xf6, 0x7a, 0xff, 0xfa, 0xca, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x81, 0xfc, 0x91, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0xa9, 0xff, 0xee, 0x18, 0xff, 0x83, 0xdf, 0x3d, 0xff, 
+  0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x84, 0xf7, 0xbf, 0xff, 
+  0x01, 0xf7, 0x3c, 0xff, 0xfb, 0xcf, 0xff, 0x87, 0xfa, 0x27, 0xff, 0x01, 0xf3, 0xae, 0xff, 0xe6, 0xbb, 0xff, 0x84, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 
+  0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x85, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x9e, 0xff, 0xfd, 0x14, 0xff, 0x85, 0xfa, 0x27, 
+  0xff, 0x01, 0xf4, 0xb3, 0xff, 0xe7, 0x1d, 0xff, 0x85, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 
+  0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x87, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0x18, 0xff, 0xfa, 0x68, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x68, 0xff, 0xed, 0xd7, 0xff, 0x87, 0xdf, 
+  0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x88, 0xf7, 
+  0xbf, 0xff, 0x03, 0xf6, 0xfc, 0xff, 0xfb, 0x6d, 0xff, 0xfb, 0x4c, 0xff, 0xe6, 0x9a, 0xff, 0x88, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x89, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x7e, 0xff, 0xe7, 0x1d, 0xff, 0x89, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 
+  0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x8b, 0xf7, 0xbf, 0xff, 0x00, 0xef, 
+  0x7e, 0xff, 0x88, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 
+  0x10, 0xff, 0x8c, 0xf7, 0xbf, 0xff, 0x01, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0x86, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 
+  0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x8d, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x9f, 0xff, 0xe7, 0x5d, 0xff, 0x85, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 
+  0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x8f, 0xf7, 0xbf, 0xff, 0x00, 0xe7, 0x5e, 0xff, 
+  0x84, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 
+  0x90, 0xf7, 0xbf, 0xff, 0x00, 0xef, 0x7e, 0xff, 0x83, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xe7, 
+  0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x91, 0xf7, 0xbf, 0xff, 0x01, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0x81, 0xdf, 0x3d, 0xff, 0x00, 0xf3, 0xef, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 
+  0xfa, 0x27, 0xe7, 0x81, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xab, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfc, 0x10, 0xff, 0x93, 0xf7, 0xbf, 0xff, 0x02, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xf3, 0xef, 
+  0xff, 0x81, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xab, 0x81, 0x00, 0x00, 0x00, 0x03, 0xfa, 0x27, 0x1b, 0xfa, 0x27, 0xd0, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0x94, 0xf7, 0xbf, 0xff, 0x04, 0xe7, 
+  0x7e, 0xff, 0xf3, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd0, 0xfa, 0x27, 0x1b, 0x82, 0x00, 0x00, 0x00, 0x02, 0xfa, 0x27, 0x03, 0xfa, 0x27, 0x2c, 0xfc, 0x10, 0x38, 0x95, 0xf7, 0xbf, 0x38, 
+  0x02, 0xfb, 0xef, 0x38, 0xfa, 0x27, 0x2c, 0xfa, 0x27, 0x03, 0xff, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x43, 0xf8, 0x03, 0x37, 0x44, 0xf8, 0x2c, 0x54, 0x5d, 0xf8, 0x38, 0xf5, 0xf3, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf5, 0xf3, 0xf1, 0x38, 0x54, 0x5c, 0xf8, 0x38, 0x37, 0x44, 0xf8, 0x2c, 0x37, 0x44, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x1b, 0x37, 0x44, 0xf8, 0xd0, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x9a, 0x9c, 0xf6, 0xff, 0xf2, 0xf0, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf2, 0xf0, 0xf1, 0xff, 0x9a, 0x9d, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd0, 0x37, 0x44, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xab, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x76, 0x7a, 0xf7, 0xff, 0xe6, 0xe5, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xe6, 0xe5, 0xf2, 0xff, 0x76, 0x7a, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xab, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe7, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x53, 0x5b, 0xf8, 0xff, 0xd3, 0xd2, 0xf3, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xd3, 0xd3, 0xf3, 0xff, 0x53, 0x5b, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe7, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x3a, 0x47, 0xf8, 0xff, 0xb6, 0xb7, 0xf5, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0xb6, 0xb7, 0xf5, 0xff, 0x3a, 0x47, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x4b, 0x54, 0xf8, 0xff, 0x3c, 0x48, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x92, 0x95, 0xf6, 0xff, 0xf0, 0xee, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf0, 0xee, 0xf2, 0xff, 0x93, 0x95, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x3c, 0x48, 0xf8, 0xff, 0x49, 0x52, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xd8, 0xd7, 0xf3, 0xff, 0x5c, 0x63, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x6f, 0x74, 0xf7, 0xff, 0xe3, 0xe2, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xe3, 0xe2, 0xf2, 0xff, 0x6f, 0x74, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x58, 0x5f, 0xf6, 0xff, 0xcc, 0xca, 0xe4, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xea, 0xe9, 0xf2, 0xff, 0x84, 0x87, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x4d, 0x56, 0xf8, 0xff, 0xce, 0xcd, 0xf4, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xce, 0xce, 0xf4, 0xff, 0x4d, 0x56, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf2, 0xff, 0xde, 0xdb, 0xe0, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf4, 0xf3, 0xf1, 0xff, 0xac, 0xad, 0xf5, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xaf, 0xb0, 0xf5, 0xff, 0xf5, 0xf4, 0xf1, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0xb0, 0xb1, 0xf5, 0xff, 0x38, 0x45, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa3, 0xa3, 0xed, 0xff, 0xe8, 0xe4, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xce, 0xcd, 0xf4, 0xff, 0x4f, 0x57, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x8c, 0x8f, 0xf6, 0xff, 0x8c, 0x8f, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x4c, 0x55, 0xf7, 0xff, 0xc3, 0xc1, 0xe6, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xe4, 0xe3, 0xf2, 0xff, 0x75, 0x79, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x6f, 0x73, 0xf4, 0xff, 0xd8, 0xd6, 0xe1, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf2, 0xf0, 0xf1, 0xff, 0x9d, 0x9f, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x95, 0x96, 0xef, 0xff, 0xe5, 0xe1, 0xde, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xc2, 0xc2, 0xf4, 0xff, 0x43, 0x4e, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x41, 0x4c, 0xf8, 0xff, 0xb8, 0xb7, 0xe9, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xde, 0xdc, 0xf3, 0xff, 0x66, 0x6c, 0xf7, 0xff, 0x62, 0x67, 0xf5, 0xff, 0xd2, 0xcf, 0xe3, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xee, 0xec, 0xf2, 0xff, 0xe5, 0xe2, 0xe4, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf0, 0xed, 0xe6, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf3, 0xf0, 0xea, 0xff, 0xeb, 0xe7, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf5, 0xf2, 0xee, 0xff, 0xec, 0xe8, 0xdf, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf4, 0xf0, 0xff, 0xee, 0xea, 0xe3, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf1, 0xee, 0xe7, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe7, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf3, 0xf1, 0xeb, 0xff, 0xeb, 0xe7, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe7, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xab, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf5, 0xf3, 0xee, 0xff, 0xec, 0xe9, 0xe0, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xab, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x1b, 0x37, 0x44, 0xf8, 0xd0, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xef, 0xeb, 0xe3, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd0, 0x37, 0x44, 0xf8, 0x1b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x43, 0xf8, 0x03, 0x37, 0x44, 0xf8, 0x2c, 0x7d, 0x80, 0xf7, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0xf7, 0xf5, 0xf1, 0x38, 0x7a, 0x7d, 0xf5, 0x38, 0x37, 0x44, 0xf8, 0x2c, 0x37, 0x45, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0x36, 0x43, 0xf8, 0x03, 0x37, 0x44, 0xf8, 0x2c, 0x54, 0x5d, 0xf8, 0x38, 0xf5, 0xf3, 0xf1, 0x38, 0x93, 
+  0xf7, 0xf5, 0xf1, 0x38, 0x03, 0xf5, 0xf3, 0xf1, 0x38, 0x54, 0x5c, 0xf8, 0x38, 0x37, 0x44, 0xf8, 0x2c, 0x37, 0x44, 0xf7, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x37, 0x44, 0xf8, 0x1b, 0x37, 
+  0x44, 0xf8, 0xd0, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x9a, 0x9c, 0xf6, 0xff, 0xf2, 0xf0, 0xf1, 0xff, 0x91, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf2, 0xf0, 0xf1, 0xff, 0x9a, 0x9d, 0xf6, 0xff, 0x81, 
+  0x37, 0x44, 0xf8, 0xff, 0x01, 0x37, 0x44, 0xf8, 0xd0, 0x37, 0x44, 0xf8, 0x1c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xab, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x76, 0x7a, 0xf7, 
+  0xff, 0xe6, 0xe5, 0xf2, 0xff, 0x8f, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xe6, 0xe5, 0xf2, 0xff, 0x76, 0x7a, 0xf7, 0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xab, 0x81, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe7, 0x84, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x53, 0x5b, 0xf8, 0xff, 0xd3, 0xd2, 0xf3, 0xff, 0x8d, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xd3, 0xd3, 0xf3, 0xff, 0x53, 
+  0x5b, 0xf8, 0xff, 0x84, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x02, 0x3a, 0x47, 0xf8, 
+  0xff, 0xb6, 0xb7, 0xf5, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0x89, 0xf7, 0xf5, 0xf1, 0xff, 0x02, 0xf6, 0xf4, 0xf1, 0xff, 0xb6, 0xb7, 0xf5, 0xff, 0x3a, 0x47, 0xf8, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 
+  0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x4b, 0x54, 0xf8, 0xff, 0x3c, 0x48, 0xf8, 0xff, 0x83, 0x37, 0x44, 
+  0xf8, 0xff, 0x01, 0x92, 0x95, 0xf6, 0xff, 0xf0, 0xee, 0xf2, 0xff, 0x87, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf0, 0xee, 0xf2, 0xff, 0x93, 0x95, 0xf6, 0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x3c, 
+  0x48, 0xf8, 0xff, 0x49, 0x52, 0xf7, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 
+  0x02, 0x7d, 0x80, 0xf7, 0xff, 0xd8, 0xd7, 0xf3, 0xff, 0x5c, 0x63, 0xf8, 0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x6f, 0x74, 0xf7, 0xff, 0xe3, 0xe2, 0xf2, 0xff, 0x85, 0xf7, 0xf5, 0xf1, 0xff, 
+  0x01, 0xe3, 0xe2, 0xf2, 0xff, 0x6f, 0x74, 0xf7, 0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x02, 0x58, 0x5f, 0xf6, 0xff, 0xcc, 0xca, 0xe4, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 
+  0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x03, 0x7d, 0x80, 0xf7, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xea, 0xe9, 0xf2, 
+  0xff, 0x84, 0x87, 0xf7, 0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x4d, 0x56, 0xf8, 0xff, 0xce, 0xcd, 0xf4, 0xff, 0x83, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xce, 0xce, 0xf4, 0xff, 0x4d, 0x56, 0xf8, 
+  0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x03, 0x7d, 0x80, 0xf2, 0xff, 0xde, 0xdb, 0xe0, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 
+  0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x81, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf4, 0xf3, 0xf1, 0xff, 0xac, 
+  0xad, 0xf5, 0xff, 0x84, 0x37, 0x44, 0xf8, 0xff, 0x04, 0xaf, 0xb0, 0xf5, 0xff, 0xf5, 0xf4, 0xf1, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0xb0, 0xb1, 0xf5, 0xff, 0x38, 0x45, 0xf8, 0xff, 0x83, 0x37, 0x44, 
+  0xf8, 0xff, 0x01, 0xa3, 0xa3, 0xed, 0xff, 0xe8, 0xe4, 0xdd, 0xff, 0x81, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x83, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xce, 0xcd, 0xf4, 0xff, 0x4f, 0x57, 0xf8, 
+  0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x81, 0x8c, 0x8f, 0xf6, 0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x4c, 0x55, 0xf7, 0xff, 0xc3, 0xc1, 0xe6, 0xff, 0x83, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 
+  0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 
+  0xff, 0x84, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xe4, 0xe3, 0xf2, 0xff, 0x75, 0x79, 0xf7, 0xff, 0x87, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x6f, 0x73, 0xf4, 0xff, 0xd8, 0xd6, 0xe1, 0xff, 0x84, 0xea, 0xe6, 
+  0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 
+  0x00, 0x7d, 0x80, 0xf7, 0xff, 0x85, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf2, 0xf0, 0xf1, 0xff, 0x9d, 0x9f, 0xf6, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x95, 0x96, 0xef, 0xff, 0xe5, 0xe1, 0xde, 
+  0xff, 0x85, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 
+  0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x87, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xc2, 0xc2, 0xf4, 0xff, 0x43, 0x4e, 0xf8, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x41, 0x4c, 0xf8, 
+  0xff, 0xb8, 0xb7, 0xe9, 0xff, 0x87, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 
+  0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x88, 0xf7, 0xf5, 0xf1, 0xff, 0x03, 0xde, 0xdc, 0xf3, 0xff, 0x66, 0x6c, 0xf7, 0xff, 0x62, 0x67, 0xf5, 0xff, 0xd2, 
+  0xcf, 0xe3, 0xff, 0x88, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 
+  0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x89, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xee, 0xec, 0xf2, 0xff, 0xe5, 0xe2, 0xe4, 0xff, 0x89, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 
+  0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 
+  0xff, 0x8b, 0xf7, 0xf5, 0xf1, 0xff, 0x00, 0xf0, 0xed, 0xe6, 0xff, 0x88, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x8c, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf3, 0xf0, 0xea, 0xff, 0xeb, 0xe7, 0xdd, 
+  0xff, 0x86, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 
+  0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x8d, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf5, 0xf2, 0xee, 0xff, 0xec, 0xe8, 0xdf, 0xff, 0x85, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 
+  0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x8e, 
+  0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf6, 0xf4, 0xf0, 0xff, 0xee, 0xea, 0xe3, 0xff, 0x84, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 
+  0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x90, 0xf7, 0xf5, 0xf1, 0xff, 0x00, 0xf1, 0xee, 0xe7, 0xff, 0x83, 
+  0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xe7, 0x81, 0x37, 0x44, 
+  0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x91, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf3, 0xf1, 0xeb, 0xff, 0xeb, 0xe7, 0xdd, 0xff, 0x81, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x78, 0x7b, 0xf3, 0xff, 0x81, 
+  0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xe7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xab, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x7d, 0x80, 0xf7, 0xff, 0x92, 0xf7, 0xf5, 
+  0xf1, 0xff, 0x03, 0xf5, 0xf3, 0xee, 0xff, 0xec, 0xe9, 0xe0, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x78, 0x7b, 0xf3, 0xff, 0x81, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xab, 0x81, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x37, 0x44, 0xf8, 0x1b, 0x37, 0x44, 0xf8, 0xd0, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x80, 0xf7, 0xff, 0x93, 0xf7, 0xf5, 0xf1, 0xff, 0x05, 0xf7, 0xf4, 0xf0, 0xff, 0xef, 0xeb, 0xe3, 
+  0xff, 0x78, 0x7b, 0xf3, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd0, 0x37, 0x44, 0xf8, 0x1b, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x36, 0x43, 0xf8, 0x03, 0x37, 0x44, 0xf8, 0x2c, 0x7d, 
+  0x80, 0xf7, 0x38, 0x95, 0xf7, 0xf5, 0xf1, 0x38, 0x02, 0x7a, 0x7d, 0xf5, 0x38, 0x37, 0x44, 0xf8, 0x2c, 0x37, 0x45, 0xf8, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +168,7 @@ const lv_img_dsc_t email_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( email_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = email_32px_map,
 };
-
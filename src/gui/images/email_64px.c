@@ -10,271 +10,299 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_EMAIL_64PX uint8_t email_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x07, 0xe9, 0x44, 0xe9, 0x6c, 0xe9, 0x70, 0xee, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xee, 0x70, 0xe9, 0x70, 0xe9, 0x6c, 0xe9, 0x44, 0xe9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0xe9, 0x58, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0xe9, 0x58, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0xe9, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6f, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x27, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x8c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xc8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0xc8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x8c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x27, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0xe9, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6c, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0xe9, 0x58, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0xe9, 0x58, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x07, 0xe9, 0x44, 0xe9, 0x6c, 0xe9, 0x70, 0xf7, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xf6, 0x70, 0xe9, 0x70, 0xe9, 0x6c, 0xe9, 0x44, 0xe9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x04, 0xe9, 0x07, 0xe9, 0x44, 0xe9, 0x6c, 0xe9, 0x70, 0xee, 0x70, 0xab, 0xff, 
+  0x70, 0x04, 0xee, 0x70, 0xe9, 0x70, 0xe9, 0x6c, 0xe9, 0x44, 0xe9, 0x07, 0x88, 0x00, 0x00, 0x01, 0xe9, 0x58, 0xe9, 0xe8, 0x83, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0xa9, 0xff, 0xff, 0x00, 0xf2, 0xff, 
+  0x83, 0xe9, 0xff, 0x01, 0xe9, 0xe8, 0xe9, 0x58, 0x86, 0x00, 0x00, 0x00, 0xe9, 0x6c, 0x86, 0xe9, 0xff, 0x00, 0xee, 0xff, 0xa7, 0xff, 0xff, 0x00, 0xee, 0xff, 0x86, 0xe9, 0xff, 0x00, 0xe9, 0x6f, 
+  0x84, 0x00, 0x00, 0x01, 0xe9, 0x27, 0xe9, 0xfb, 0x87, 0xe9, 0xff, 0x01, 0xed, 0xff, 0xfb, 0xff, 0xa3, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xed, 0xff, 0x87, 0xe9, 0xff, 0x01, 0xe9, 0xfb, 0xe9, 0x27, 
+  0x83, 0x00, 0x00, 0x00, 0xe9, 0x8c, 0x8a, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0xa1, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xe9, 0x8c, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xc8, 0x8b, 0xe9, 
+  0xff, 0x00, 0xf2, 0xff, 0x9f, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x8b, 0xe9, 0xff, 0x00, 0xe9, 0xc8, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x8c, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x9d, 0xff, 0xff, 0x00, 
+  0xee, 0xff, 0x8c, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x8e, 0xe9, 0xff, 0x00, 0xfb, 0xff, 0x99, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8e, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x8f, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x97, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x8f, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x90, 0xe9, 
+  0xff, 0x00, 0xf2, 0xff, 0x95, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x90, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x01, 0xf2, 0xff, 0xed, 0xff, 0x89, 0xe9, 
+  0xff, 0x00, 0xed, 0xff, 0x93, 0xff, 0xff, 0x00, 0xed, 0xff, 0x89, 0xe9, 0xff, 0x01, 0xed, 0xff, 0xf2, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 
+  0xff, 0x02, 0xf7, 0xfc, 0xff, 0xff, 0xf2, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xfb, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8a, 0xe9, 0xff, 0x02, 0xee, 0xff, 0xff, 0xff, 0xf6, 0xff, 0x85, 0xe9, 
+  0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x81, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x8d, 0xff, 0xff, 0x00, 
+  0xf6, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 
+  0x82, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 
+  0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x84, 0xff, 0xff, 0x00, 0xee, 0xff, 0x89, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x89, 0xff, 0xff, 0x00, 
+  0xed, 0xff, 0x89, 0xe9, 0xff, 0x01, 0xed, 0xff, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 
+  0xf7, 0xfc, 0x85, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xfb, 0xff, 0x85, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x85, 0xff, 0xff, 0x00, 0xf6, 0xff, 
+  0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x86, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x83, 0xff, 
+  0xff, 0x00, 0xf6, 0xff, 0x8a, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 
+  0xf7, 0xfc, 0x88, 0xff, 0xff, 0x00, 0xed, 0xff, 0x89, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x89, 0xe9, 0xff, 0x01, 0xed, 0xff, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x00, 
+  0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x89, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x89, 0xe9, 0xff, 0x81, 0xed, 0xff, 
+  0x89, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x89, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x8a, 0xff, 
+  0xff, 0x00, 0xf7, 0xff, 0x93, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 
+  0xf7, 0xfc, 0x8b, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xed, 0xff, 0x90, 0xe9, 0xff, 0x00, 0xfb, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 
+  0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x8d, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x8d, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x8e, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8b, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x8e, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 
+  0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x89, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x8f, 0xff, 0xff, 0x00, 
+  0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x91, 0xff, 0xff, 0x00, 0xed, 0xff, 0x85, 0xe9, 0xff, 0x01, 0xed, 0xff, 
+  0xfb, 0xff, 0x90, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x92, 0xff, 0xff, 0x00, 0xf2, 0xff, 
+  0x83, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x92, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0x93, 0xff, 
+  0xff, 0x00, 0xf7, 0xff, 0x81, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x93, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 
+  0xf7, 0xfc, 0x94, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x94, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 
+  0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 
+  0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 
+  0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 
+  0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 
+  0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 
+  0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 
+  0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 
+  0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 
+  0xe9, 0xd3, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xd3, 0x83, 0x00, 0x00, 0x00, 0xe9, 0xc8, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 
+  0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xe9, 0xc8, 0x83, 0x00, 0x00, 0x00, 0xe9, 0x8c, 0x85, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xe9, 
+  0xff, 0x00, 0xe9, 0x8c, 0x83, 0x00, 0x00, 0x01, 0xe9, 0x27, 0xe9, 0xfb, 0x84, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x84, 0xe9, 0xff, 0x01, 0xe9, 0xfb, 0xe9, 0x24, 
+  0x84, 0x00, 0x00, 0x00, 0xe9, 0x6c, 0x84, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xe9, 0x6c, 0x86, 0x00, 0x00, 0x01, 0xe9, 0x58, 0xe9, 0xe8, 
+  0x82, 0xe9, 0xff, 0x00, 0xf7, 0xfc, 0xab, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x82, 0xe9, 0xff, 0x01, 0xe9, 0xe8, 0xe9, 0x58, 0x88, 0x00, 0x00, 0x04, 0xe9, 0x07, 0xe9, 0x44, 0xe9, 0x6c, 0xe9, 0x70, 
+  0xf7, 0x70, 0xab, 0xff, 0x70, 0x04, 0xf6, 0x70, 0xe9, 0x70, 0xe9, 0x6c, 0xe9, 0x44, 0xe9, 0x07, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xc4, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x07, 0x27, 0xfa, 0x44, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0x70, 0x8d, 0xfb, 0x70, 0x9e, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0x9e, 0xf7, 0x70, 0x6d, 0xfb, 0x70, 0x27, 0xfa, 0x70, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0x44, 0x27, 0xfa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x00, 0x27, 0xfa, 0x58, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x91, 0xfc, 0xff, 0x7e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x92, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0x58, 0x27, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x6d, 0xfb, 0xff, 0x1c, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x1c, 0xf7, 0xff, 0x6d, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0x6f, 0x27, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x27, 0x27, 0xfa, 0xfb, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x89, 0xfa, 0xff, 0x59, 0xf6, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x59, 0xf6, 0xff, 0x89, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xfb, 0x27, 0xfa, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x8c, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x55, 0xfd, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x75, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xc8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x51, 0xfc, 0xff, 0x5d, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xf7, 0xff, 0x51, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x4c, 0xfb, 0xff, 0xfb, 0xf6, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xfc, 0xf6, 0xff, 0x4c, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x68, 0xfa, 0xff, 0x38, 0xf6, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x38, 0xf6, 0xff, 0x68, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x34, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0x5d, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xf7, 0xff, 0x10, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xae, 0xfb, 0xff, 0xa9, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x0b, 0xfb, 0xff, 0xdb, 0xf6, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdb, 0xf6, 0xff, 0x0b, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x89, 0xfa, 0xff, 0x8e, 0xf3, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0x1c, 0xf7, 0xff, 0xae, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x48, 0xfa, 0xff, 0xf8, 0xf5, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xf8, 0xf5, 0xff, 0x48, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x8d, 0xf3, 0xff, 0xbb, 0xe6, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd3, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xf3, 0xfc, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xf3, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x92, 0xf4, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xf8, 0xf5, 0xff, 0x68, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xcf, 0xfb, 0xff, 0x3d, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xf7, 0xff, 0xef, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x68, 0xfa, 0xff, 0xb6, 0xed, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdb, 0xf6, 0xff, 0x4c, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xca, 0xfa, 0xff, 0xba, 0xf6, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xba, 0xf6, 0xff, 0xea, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x2c, 0xfb, 0xff, 0x7a, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x71, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xd7, 0xf5, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xd7, 0xf5, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x30, 0xf4, 0xff, 0xfc, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xb6, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xb2, 0xfc, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd2, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x55, 0xed, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9a, 0xf6, 0xff, 0xca, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xae, 0xfb, 0xff, 0x3c, 0xf7, 0xff, 0x3c, 0xf7, 0xff, 0xae, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xca, 0xfa, 0xff, 0x39, 0xee, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xf7, 0xff, 0xef, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xaa, 0xfa, 0xff, 0xaa, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xce, 0xf3, 0xff, 0xdb, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x34, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0xf3, 0xf4, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x59, 0xf6, 0xff, 0x89, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x89, 0xfa, 0xff, 0xf7, 0xed, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x1c, 0xf7, 0xff, 0x8d, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x6d, 0xfb, 0xff, 0x9b, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xb2, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xf7, 0xf5, 0xff, 0x48, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x48, 0xfa, 0xff, 0x96, 0xed, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdb, 0xf6, 0xff, 0x2c, 0xfb, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x0b, 0xfb, 0xff, 0x7a, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xf7, 0xff, 0x51, 0xfc, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x10, 0xf4, 0xff, 0xfc, 0xe6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x76, 0xfd, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xf5, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7a, 0xf6, 0xff, 0x39, 0xee, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xc8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x8c, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x27, 0x27, 0xfa, 0xfb, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xfb, 0x27, 0xfa, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x00, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0x6c, 0x46, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x00, 0x27, 0xfa, 0x58, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0xf4, 0xf4, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xff, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0x58, 0x27, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x07, 0x27, 0xfa, 0x44, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0x70, 0x34, 0xfd, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0xbf, 0xf7, 0x70, 0x14, 0xf5, 0x70, 0x27, 0xfa, 0x70, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0x44, 0x27, 0xfa, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x05, 0x27, 0xfa, 0x07, 0x27, 0xfa, 0x44, 0x27, 
+  0xfa, 0x6c, 0x27, 0xfa, 0x70, 0x8d, 0xfb, 0x70, 0x9e, 0xf7, 0x70, 0xa9, 0xbf, 0xf7, 0x70, 0x05, 0x9e, 0xf7, 0x70, 0x6d, 0xfb, 0x70, 0x27, 0xfa, 0x70, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0x44, 0x27, 
+  0xfa, 0x07, 0x88, 0x00, 0x00, 0x00, 0x01, 0x27, 0xfa, 0x58, 0x27, 0xfa, 0xe8, 0x83, 0x27, 0xfa, 0xff, 0x01, 0x91, 0xfc, 0xff, 0x7e, 0xf7, 0xff, 0xa7, 0xbf, 0xf7, 0xff, 0x01, 0x7e, 0xf7, 0xff, 
+  0x92, 0xfc, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x01, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0x58, 0x86, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x6c, 0x86, 0x27, 0xfa, 0xff, 0x01, 0x6d, 0xfb, 0xff, 0x1c, 0xf7, 
+  0xff, 0xa5, 0xbf, 0xf7, 0xff, 0x01, 0x1c, 0xf7, 0xff, 0x6d, 0xfb, 0xff, 0x86, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0x6f, 0x84, 0x00, 0x00, 0x00, 0x01, 0x27, 0xfa, 0x27, 0x27, 0xfa, 0xfb, 0x87, 
+  0x27, 0xfa, 0xff, 0x01, 0x89, 0xfa, 0xff, 0x59, 0xf6, 0xff, 0xa3, 0xbf, 0xf7, 0xff, 0x01, 0x59, 0xf6, 0xff, 0x89, 0xfa, 0xff, 0x87, 0x27, 0xfa, 0xff, 0x01, 0x27, 0xfa, 0xfb, 0x27, 0xfa, 0x27, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x8c, 0x8a, 0x27, 0xfa, 0xff, 0x01, 0x55, 0xfd, 0xff, 0xbe, 0xf7, 0xff, 0x9f, 0xbf, 0xf7, 0xff, 0x01, 0xbe, 0xf7, 0xff, 0x75, 0xfd, 0xff, 0x8a, 0x27, 
+  0xfa, 0xff, 0x00, 0x27, 0xfa, 0x8c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xc8, 0x8b, 0x27, 0xfa, 0xff, 0x01, 0x51, 0xfc, 0xff, 0x5d, 0xf7, 0xff, 0x9d, 0xbf, 0xf7, 0xff, 0x01, 0x5d, 0xf7, 
+  0xff, 0x51, 0xfc, 0xff, 0x8b, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xc8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x8c, 0x27, 0xfa, 0xff, 0x01, 0x4c, 0xfb, 0xff, 0xfb, 0xf6, 0xff, 0x9b, 
+  0xbf, 0xf7, 0xff, 0x01, 0xfc, 0xf6, 0xff, 0x4c, 0xfb, 0xff, 0x8c, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x8d, 0x27, 0xfa, 0xff, 0x01, 0x68, 
+  0xfa, 0xff, 0x38, 0xf6, 0xff, 0x99, 0xbf, 0xf7, 0xff, 0x01, 0x38, 0xf6, 0xff, 0x68, 0xfa, 0xff, 0x8d, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 
+  0x8f, 0x27, 0xfa, 0xff, 0x01, 0x34, 0xfd, 0xff, 0x9e, 0xf7, 0xff, 0x95, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xf7, 0xff, 0x34, 0xfd, 0xff, 0x8f, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x90, 0x27, 0xfa, 0xff, 0x01, 0x10, 0xfc, 0xff, 0x5d, 0xf7, 0xff, 0x93, 0xbf, 0xf7, 0xff, 0x01, 0x5d, 0xf7, 0xff, 0x10, 0xfc, 0xff, 0x90, 0x27, 0xfa, 0xff, 
+  0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x01, 0xae, 0xfb, 0xff, 0xa9, 0xfa, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 0x0b, 0xfb, 0xff, 0xdb, 
+  0xf6, 0xff, 0x91, 0xbf, 0xf7, 0xff, 0x01, 0xdb, 0xf6, 0xff, 0x0b, 0xfb, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 0x89, 0xfa, 0xff, 0x8e, 0xf3, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x02, 0x34, 0xfd, 0xfc, 0x1c, 0xf7, 0xff, 0xae, 0xfb, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 0x48, 0xfa, 0xff, 0xf8, 0xf5, 
+  0xff, 0x8f, 0xbf, 0xf7, 0xff, 0x01, 0xf8, 0xf5, 0xff, 0x48, 0xfa, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x02, 0x8d, 0xf3, 0xff, 0xbb, 0xe6, 0xff, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 
+  0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x03, 0x34, 0xfd, 0xfc, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd3, 0xfc, 0xff, 0x8a, 0x27, 0xfa, 0xff, 0x01, 
+  0xf3, 0xfc, 0xff, 0x9e, 0xf7, 0xff, 0x8b, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xf7, 0xff, 0xf3, 0xfc, 0xff, 0x8a, 0x27, 0xfa, 0xff, 0x03, 0x92, 0xf4, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 
+  0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x82, 0xbf, 0xf7, 0xff, 0x01, 0xf8, 
+  0xf5, 0xff, 0x68, 0xfa, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 0xcf, 0xfb, 0xff, 0x3d, 0xf7, 0xff, 0x89, 0xbf, 0xf7, 0xff, 0x01, 0x3d, 0xf7, 0xff, 0xef, 0xfb, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 
+  0x68, 0xfa, 0xff, 0xb6, 0xed, 0xff, 0x82, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 
+  0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x83, 0xbf, 0xf7, 0xff, 0x01, 0xdb, 0xf6, 0xff, 0x4c, 0xfb, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 0xca, 0xfa, 0xff, 0xba, 0xf6, 0xff, 0x87, 0xbf, 0xf7, 0xff, 
+  0x01, 0xba, 0xf6, 0xff, 0xea, 0xfa, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 0x2c, 0xfb, 0xff, 0x7a, 0xe6, 0xff, 0x83, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 
+  0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x84, 0xbf, 0xf7, 0xff, 0x01, 0x7d, 0xf7, 0xff, 0x71, 0xfc, 0xff, 0x8a, 0x27, 0xfa, 
+  0xff, 0x00, 0xd7, 0xf5, 0xff, 0x85, 0xbf, 0xf7, 0xff, 0x00, 0xd7, 0xf5, 0xff, 0x8a, 0x27, 0xfa, 0xff, 0x01, 0x30, 0xf4, 0xff, 0xfc, 0xe6, 0xff, 0x84, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 
+  0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x86, 0xbf, 0xf7, 0xff, 0x00, 0xb6, 0xfd, 0xff, 
+  0x8a, 0x27, 0xfa, 0xff, 0x01, 0xb2, 0xfc, 0xff, 0x9e, 0xf7, 0xff, 0x81, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xf7, 0xff, 0xd2, 0xfc, 0xff, 0x8a, 0x27, 0xfa, 0xff, 0x01, 0x55, 0xed, 0xff, 0x3d, 0xe7, 
+  0xff, 0x85, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 
+  0xfc, 0x87, 0xbf, 0xf7, 0xff, 0x01, 0x9a, 0xf6, 0xff, 0xca, 0xfa, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x00, 0xae, 0xfb, 0xff, 0x81, 0x3c, 0xf7, 0xff, 0x00, 0xae, 0xfb, 0xff, 0x89, 0x27, 0xfa, 0xff, 
+  0x01, 0xca, 0xfa, 0xff, 0x39, 0xee, 0xff, 0x87, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 
+  0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x88, 0xbf, 0xf7, 0xff, 0x01, 0x3d, 0xf7, 0xff, 0xef, 0xfb, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x81, 0xaa, 0xfa, 0xff, 0x89, 0x27, 0xfa, 0xff, 0x01, 0xce, 
+  0xf3, 0xff, 0xdb, 0xe6, 0xff, 0x88, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 
+  0xff, 0x00, 0x34, 0xfd, 0xfc, 0x89, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xf7, 0xff, 0x34, 0xfd, 0xff, 0x93, 0x27, 0xfa, 0xff, 0x01, 0xf3, 0xf4, 0xff, 0x3d, 0xe7, 0xff, 0x89, 0x3d, 0xdf, 0xff, 0x00, 
+  0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x8b, 0xbf, 0xf7, 0xff, 0x01, 
+  0x59, 0xf6, 0xff, 0x89, 0xfa, 0xff, 0x8f, 0x27, 0xfa, 0xff, 0x01, 0x89, 0xfa, 0xff, 0xf7, 0xed, 0xff, 0x8b, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 
+  0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x8c, 0xbf, 0xf7, 0xff, 0x01, 0x1c, 0xf7, 0xff, 0x8d, 0xfb, 0xff, 0x8d, 0x27, 0xfa, 0xff, 
+  0x01, 0x6d, 0xfb, 0xff, 0x9b, 0xe6, 0xff, 0x8c, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 
+  0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x8d, 0xbf, 0xf7, 0xff, 0x01, 0x7e, 0xf7, 0xff, 0xb2, 0xfc, 0xff, 0x8b, 0x27, 0xfa, 0xff, 0x01, 0x71, 0xf4, 0xff, 0x1c, 0xe7, 0xff, 0x8d, 0x3d, 0xdf, 
+  0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x8f, 0xbf, 0xf7, 
+  0xff, 0x01, 0xf7, 0xf5, 0xff, 0x48, 0xfa, 0xff, 0x87, 0x27, 0xfa, 0xff, 0x01, 0x48, 0xfa, 0xff, 0x96, 0xed, 0xff, 0x8f, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 
+  0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x90, 0xbf, 0xf7, 0xff, 0x01, 0xdb, 0xf6, 0xff, 0x2c, 0xfb, 0xff, 0x85, 0x27, 
+  0xfa, 0xff, 0x01, 0x0b, 0xfb, 0xff, 0x7a, 0xe6, 0xff, 0x90, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 
+  0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x91, 0xbf, 0xf7, 0xff, 0x01, 0x5d, 0xf7, 0xff, 0x51, 0xfc, 0xff, 0x83, 0x27, 0xfa, 0xff, 0x01, 0x10, 0xf4, 0xff, 0xfc, 0xe6, 0xff, 0x91, 
+  0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x93, 
+  0xbf, 0xf7, 0xff, 0x00, 0x76, 0xfd, 0xff, 0x81, 0x27, 0xfa, 0xff, 0x01, 0x34, 0xf5, 0xff, 0x3d, 0xe7, 0xff, 0x92, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 
+  0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x94, 0xbf, 0xf7, 0xff, 0x01, 0x7a, 0xf6, 0xff, 0x39, 0xee, 0xff, 0x94, 0x3d, 0xdf, 
+  0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x96, 0xbf, 0xf7, 
+  0xff, 0x00, 0x5d, 0xe7, 0xff, 0x93, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 
+  0xff, 0x00, 0x34, 0xfd, 0xfc, 0x97, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 0xe7, 0xff, 0x92, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 
+  0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x98, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 0xef, 0xff, 0x91, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 
+  0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x99, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 
+  0x8f, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 
+  0x9b, 0xbf, 0xf7, 0xff, 0x00, 0x5d, 0xe7, 0xff, 0x8e, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 
+  0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x9c, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 0xe7, 0xff, 0x8d, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x9d, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 0xef, 0xff, 0x8c, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 
+  0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0x9e, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xef, 0xff, 
+  0x5d, 0xe7, 0xff, 0x8a, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 
+  0x34, 0xfd, 0xfc, 0xa0, 0xbf, 0xf7, 0xff, 0x00, 0x5e, 0xe7, 0xff, 0x89, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 
+  0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xa1, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 0xe7, 0xff, 0x88, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 
+  0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xa2, 0xbf, 0xf7, 0xff, 0x01, 0x9e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x86, 0x3d, 
+  0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0xd3, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xa3, 0xbf, 
+  0xf7, 0xff, 0x01, 0x9e, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x85, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 
+  0xc8, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xa5, 0xbf, 0xf7, 0xff, 0x00, 0x5e, 0xe7, 0xff, 0x84, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 
+  0xc8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfa, 0x8c, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xa6, 0xbf, 0xf7, 0xff, 0x00, 0x7e, 0xef, 0xff, 0x83, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 
+  0xff, 0x85, 0x27, 0xfa, 0xff, 0x00, 0x27, 0xfa, 0x8c, 0x83, 0x00, 0x00, 0x00, 0x01, 0x27, 0xfa, 0x27, 0x27, 0xfa, 0xfb, 0x84, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xa7, 0xbf, 0xf7, 0xff, 
+  0x01, 0x9e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x81, 0x3d, 0xdf, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x84, 0x27, 0xfa, 0xff, 0x01, 0x27, 0xfa, 0xfb, 0x27, 0xfa, 0x24, 0x84, 0x00, 0x00, 0x00, 0x00, 0x27, 
+  0xfa, 0x6c, 0x84, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xa8, 0xbf, 0xf7, 0xff, 0x03, 0x9f, 0xf7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0xf4, 0xf4, 0xff, 0x84, 0x27, 0xfa, 0xff, 0x00, 
+  0x27, 0xfa, 0x6c, 0x86, 0x00, 0x00, 0x00, 0x01, 0x27, 0xfa, 0x58, 0x27, 0xfa, 0xe8, 0x82, 0x27, 0xfa, 0xff, 0x00, 0x34, 0xfd, 0xfc, 0xaa, 0xbf, 0xf7, 0xff, 0x01, 0x5e, 0xe7, 0xff, 0xf4, 0xf4, 
+  0xff, 0x82, 0x27, 0xfa, 0xff, 0x01, 0x27, 0xfa, 0xe8, 0x27, 0xfa, 0x58, 0x88, 0x00, 0x00, 0x00, 0x04, 0x27, 0xfa, 0x07, 0x27, 0xfa, 0x44, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0x70, 0x34, 0xfd, 0x70, 
+  0xab, 0xbf, 0xf7, 0x70, 0x04, 0x14, 0xf5, 0x70, 0x27, 0xfa, 0x70, 0x27, 0xfa, 0x6c, 0x27, 0xfa, 0x44, 0x27, 0xfa, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x07, 0xfa, 0x27, 0x44, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0x70, 0xfb, 0x8d, 0x70, 0xf7, 0x9e, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0x9e, 0x70, 0xfb, 0x6d, 0x70, 0xfa, 0x27, 0x70, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0x44, 0xfa, 0x27, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x00, 0xfa, 0x27, 0x58, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x91, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0xfc, 0x92, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0x58, 0xfa, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x07, 0x00, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0x6d, 0xff, 0xf7, 0x1c, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x1c, 0xff, 0xfb, 0x6d, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0x6f, 0xfa, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x27, 0xfa, 0x27, 0xfb, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x89, 0xff, 0xf6, 0x59, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x59, 0xff, 0xfa, 0x89, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xfb, 0xfa, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x8c, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x55, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xfd, 0x75, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xc8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x51, 0xff, 0xf7, 0x5d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x5d, 0xff, 0xfc, 0x51, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0x4c, 0xff, 0xf6, 0xfb, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0xfc, 0xff, 0xfb, 0x4c, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x68, 0xff, 0xf6, 0x38, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x38, 0xff, 0xfa, 0x68, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfd, 0x34, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0x10, 0xff, 0xf7, 0x5d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x5d, 0xff, 0xfc, 0x10, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0xae, 0xff, 0xfa, 0xa9, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0x0b, 0xff, 0xf6, 0xdb, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0xdb, 0xff, 0xfb, 0x0b, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x89, 0xff, 0xf3, 0x8e, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0x1c, 0xff, 0xfb, 0xae, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x48, 0xff, 0xf5, 0xf8, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf5, 0xf8, 0xff, 0xfa, 0x48, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf3, 0x8d, 0xff, 0xe6, 0xbb, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfc, 0xd3, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0xf3, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfc, 0xf3, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf4, 0x92, 0xff, 0xe7, 0x1c, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf5, 0xf8, 0xff, 0xfa, 0x68, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0xcf, 0xff, 0xf7, 0x3d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x3d, 0xff, 0xfb, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x68, 0xff, 0xed, 0xb6, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0xdb, 0xff, 0xfb, 0x4c, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0xca, 0xff, 0xf6, 0xba, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0xba, 0xff, 0xfa, 0xea, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0x2c, 0xff, 0xe6, 0x7a, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x7d, 0xff, 0xfc, 0x71, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf5, 0xd7, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf5, 0xd7, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf4, 0x30, 0xff, 0xe6, 0xfc, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xfd, 0xb6, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfc, 0xb2, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfc, 0xd2, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xed, 0x55, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x9a, 0xff, 0xfa, 0xca, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0xae, 0xff, 0xf7, 0x3c, 0xff, 0xf7, 0x3c, 0xff, 0xfb, 0xae, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0xca, 0xff, 0xee, 0x39, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x3d, 0xff, 0xfb, 0xef, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0xaa, 0xff, 0xfa, 0xaa, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf3, 0xce, 0xff, 0xe6, 0xdb, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfd, 0x34, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf4, 0xf3, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x59, 0xff, 0xfa, 0x89, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x89, 0xff, 0xed, 0xf7, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x1c, 0xff, 0xfb, 0x8d, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0x6d, 0xff, 0xe6, 0x9b, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x7e, 0xff, 0xfc, 0xb2, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf4, 0x71, 0xff, 0xe7, 0x1c, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf5, 0xf7, 0xff, 0xfa, 0x48, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x48, 0xff, 0xed, 0x96, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0xdb, 0xff, 0xfb, 0x2c, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfb, 0x0b, 0xff, 0xe6, 0x7a, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x5d, 0xff, 0xfc, 0x51, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf4, 0x10, 0xff, 0xe6, 0xfc, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xfd, 0x76, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xf5, 0x34, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf6, 0x7a, 0xff, 0xee, 0x39, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xc8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x8c, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x27, 0xfa, 0x27, 0xfb, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xfb, 0xfa, 0x27, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x00, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9f, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0x6c, 0xfa, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x00, 0xfa, 0x27, 0x58, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5e, 0xff, 0xf4, 0xf4, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xff, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0x58, 0xfa, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x07, 0xfa, 0x27, 0x44, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0x70, 0xfd, 0x34, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf7, 0xbf, 0x70, 0xf5, 0x14, 0x70, 0xfa, 0x27, 0x70, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0x44, 0xfa, 0x27, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x05, 0xfa, 0x27, 0x07, 0xfa, 0x27, 0x44, 0xfa, 
+  0x27, 0x6c, 0xfa, 0x27, 0x70, 0xfb, 0x8d, 0x70, 0xf7, 0x9e, 0x70, 0xa9, 0xf7, 0xbf, 0x70, 0x05, 0xf7, 0x9e, 0x70, 0xfb, 0x6d, 0x70, 0xfa, 0x27, 0x70, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0x44, 0xfa, 
+  0x27, 0x07, 0x88, 0x00, 0x00, 0x00, 0x01, 0xfa, 0x27, 0x58, 0xfa, 0x27, 0xe8, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfc, 0x91, 0xff, 0xf7, 0x7e, 0xff, 0xa7, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x7e, 0xff, 
+  0xfc, 0x92, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0x58, 0x86, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x6c, 0x86, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0x6d, 0xff, 0xf7, 0x1c, 
+  0xff, 0xa5, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x1c, 0xff, 0xfb, 0x6d, 0xff, 0x86, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0x6f, 0x84, 0x00, 0x00, 0x00, 0x01, 0xfa, 0x27, 0x27, 0xfa, 0x27, 0xfb, 0x87, 
+  0xfa, 0x27, 0xff, 0x01, 0xfa, 0x89, 0xff, 0xf6, 0x59, 0xff, 0xa3, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0x59, 0xff, 0xfa, 0x89, 0xff, 0x87, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x27, 0xfb, 0xfa, 0x27, 0x27, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x8c, 0x8a, 0xfa, 0x27, 0xff, 0x01, 0xfd, 0x55, 0xff, 0xf7, 0xbe, 0xff, 0x9f, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0xbe, 0xff, 0xfd, 0x75, 0xff, 0x8a, 0xfa, 
+  0x27, 0xff, 0x00, 0xfa, 0x27, 0x8c, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xc8, 0x8b, 0xfa, 0x27, 0xff, 0x01, 0xfc, 0x51, 0xff, 0xf7, 0x5d, 0xff, 0x9d, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x5d, 
+  0xff, 0xfc, 0x51, 0xff, 0x8b, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xc8, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x8c, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0x4c, 0xff, 0xf6, 0xfb, 0xff, 0x9b, 
+  0xf7, 0xbf, 0xff, 0x01, 0xf6, 0xfc, 0xff, 0xfb, 0x4c, 0xff, 0x8c, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x8d, 0xfa, 0x27, 0xff, 0x01, 0xfa, 
+  0x68, 0xff, 0xf6, 0x38, 0xff, 0x99, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0x38, 0xff, 0xfa, 0x68, 0xff, 0x8d, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 
+  0x8f, 0xfa, 0x27, 0xff, 0x01, 0xfd, 0x34, 0xff, 0xf7, 0x9e, 0xff, 0x95, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x9e, 0xff, 0xfd, 0x34, 0xff, 0x8f, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x90, 0xfa, 0x27, 0xff, 0x01, 0xfc, 0x10, 0xff, 0xf7, 0x5d, 0xff, 0x93, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x5d, 0xff, 0xfc, 0x10, 0xff, 0x90, 0xfa, 0x27, 0xff, 
+  0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0xae, 0xff, 0xfa, 0xa9, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0x0b, 0xff, 0xf6, 
+  0xdb, 0xff, 0x91, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0xdb, 0xff, 0xfb, 0x0b, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x89, 0xff, 0xf3, 0x8e, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x02, 0xfd, 0x34, 0xfc, 0xf7, 0x1c, 0xff, 0xfb, 0xae, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x48, 0xff, 0xf5, 0xf8, 
+  0xff, 0x8f, 0xf7, 0xbf, 0xff, 0x01, 0xf5, 0xf8, 0xff, 0xfa, 0x48, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x02, 0xf3, 0x8d, 0xff, 0xe6, 0xbb, 0xff, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 
+  0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x03, 0xfd, 0x34, 0xfc, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xfc, 0xd3, 0xff, 0x8a, 0xfa, 0x27, 0xff, 0x01, 
+  0xfc, 0xf3, 0xff, 0xf7, 0x9e, 0xff, 0x8b, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x9e, 0xff, 0xfc, 0xf3, 0xff, 0x8a, 0xfa, 0x27, 0xff, 0x03, 0xf4, 0x92, 0xff, 0xe7, 0x1c, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 
+  0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x82, 0xf7, 0xbf, 0xff, 0x01, 0xf5, 
+  0xf8, 0xff, 0xfa, 0x68, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0xcf, 0xff, 0xf7, 0x3d, 0xff, 0x89, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x3d, 0xff, 0xfb, 0xef, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 
+  0xfa, 0x68, 0xff, 0xed, 0xb6, 0xff, 0x82, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 
+  0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x83, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0xdb, 0xff, 0xfb, 0x4c, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0xca, 0xff, 0xf6, 0xba, 0xff, 0x87, 0xf7, 0xbf, 0xff, 
+  0x01, 0xf6, 0xba, 0xff, 0xfa, 0xea, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 0xfb, 0x2c, 0xff, 0xe6, 0x7a, 0xff, 0x83, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 
+  0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x84, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x7d, 0xff, 0xfc, 0x71, 0xff, 0x8a, 0xfa, 0x27, 
+  0xff, 0x00, 0xf5, 0xd7, 0xff, 0x85, 0xf7, 0xbf, 0xff, 0x00, 0xf5, 0xd7, 0xff, 0x8a, 0xfa, 0x27, 0xff, 0x01, 0xf4, 0x30, 0xff, 0xe6, 0xfc, 0xff, 0x84, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 
+  0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x86, 0xf7, 0xbf, 0xff, 0x00, 0xfd, 0xb6, 0xff, 
+  0x8a, 0xfa, 0x27, 0xff, 0x01, 0xfc, 0xb2, 0xff, 0xf7, 0x9e, 0xff, 0x81, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x9e, 0xff, 0xfc, 0xd2, 0xff, 0x8a, 0xfa, 0x27, 0xff, 0x01, 0xed, 0x55, 0xff, 0xe7, 0x3d, 
+  0xff, 0x85, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 
+  0xfc, 0x87, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0x9a, 0xff, 0xfa, 0xca, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x00, 0xfb, 0xae, 0xff, 0x81, 0xf7, 0x3c, 0xff, 0x00, 0xfb, 0xae, 0xff, 0x89, 0xfa, 0x27, 0xff, 
+  0x01, 0xfa, 0xca, 0xff, 0xee, 0x39, 0xff, 0x87, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 
+  0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x88, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x3d, 0xff, 0xfb, 0xef, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x81, 0xfa, 0xaa, 0xff, 0x89, 0xfa, 0x27, 0xff, 0x01, 0xf3, 
+  0xce, 0xff, 0xe6, 0xdb, 0xff, 0x88, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 
+  0xff, 0x00, 0xfd, 0x34, 0xfc, 0x89, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x9e, 0xff, 0xfd, 0x34, 0xff, 0x93, 0xfa, 0x27, 0xff, 0x01, 0xf4, 0xf3, 0xff, 0xe7, 0x3d, 0xff, 0x89, 0xdf, 0x3d, 0xff, 0x00, 
+  0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x8b, 0xf7, 0xbf, 0xff, 0x01, 
+  0xf6, 0x59, 0xff, 0xfa, 0x89, 0xff, 0x8f, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x89, 0xff, 0xed, 0xf7, 0xff, 0x8b, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 
+  0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x8c, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x1c, 0xff, 0xfb, 0x8d, 0xff, 0x8d, 0xfa, 0x27, 0xff, 
+  0x01, 0xfb, 0x6d, 0xff, 0xe6, 0x9b, 0xff, 0x8c, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 
+  0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x8d, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x7e, 0xff, 0xfc, 0xb2, 0xff, 0x8b, 0xfa, 0x27, 0xff, 0x01, 0xf4, 0x71, 0xff, 0xe7, 0x1c, 0xff, 0x8d, 0xdf, 0x3d, 
+  0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x8f, 0xf7, 0xbf, 
+  0xff, 0x01, 0xf5, 0xf7, 0xff, 0xfa, 0x48, 0xff, 0x87, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x48, 0xff, 0xed, 0x96, 0xff, 0x8f, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 
+  0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x90, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0xdb, 0xff, 0xfb, 0x2c, 0xff, 0x85, 0xfa, 
+  0x27, 0xff, 0x01, 0xfb, 0x0b, 0xff, 0xe6, 0x7a, 0xff, 0x90, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 
+  0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x91, 0xf7, 0xbf, 0xff, 0x01, 0xf7, 0x5d, 0xff, 0xfc, 0x51, 0xff, 0x83, 0xfa, 0x27, 0xff, 0x01, 0xf4, 0x10, 0xff, 0xe6, 0xfc, 0xff, 0x91, 
+  0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x93, 
+  0xf7, 0xbf, 0xff, 0x00, 0xfd, 0x76, 0xff, 0x81, 0xfa, 0x27, 0xff, 0x01, 0xf5, 0x34, 0xff, 0xe7, 0x3d, 0xff, 0x92, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 
+  0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x94, 0xf7, 0xbf, 0xff, 0x01, 0xf6, 0x7a, 0xff, 0xee, 0x39, 0xff, 0x94, 0xdf, 0x3d, 
+  0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x96, 0xf7, 0xbf, 
+  0xff, 0x00, 0xe7, 0x5d, 0xff, 0x93, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 
+  0xff, 0x00, 0xfd, 0x34, 0xfc, 0x97, 0xf7, 0xbf, 0xff, 0x00, 0xe7, 0x7e, 0xff, 0x92, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 
+  0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x98, 0xf7, 0xbf, 0xff, 0x00, 0xef, 0x7e, 0xff, 0x91, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 
+  0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x99, 0xf7, 0xbf, 0xff, 0x01, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 
+  0x8f, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 
+  0x9b, 0xf7, 0xbf, 0xff, 0x00, 0xe7, 0x5d, 0xff, 0x8e, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 
+  0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x9c, 0xf7, 0xbf, 0xff, 0x00, 0xe7, 0x7e, 0xff, 0x8d, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x9d, 0xf7, 0xbf, 0xff, 0x00, 0xef, 0x7e, 0xff, 0x8c, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 
+  0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0x9e, 0xf7, 0xbf, 0xff, 0x01, 0xef, 0x9e, 0xff, 
+  0xe7, 0x5d, 0xff, 0x8a, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 
+  0xfd, 0x34, 0xfc, 0xa0, 0xf7, 0xbf, 0xff, 0x00, 0xe7, 0x5e, 0xff, 0x89, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 
+  0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xa1, 0xf7, 0xbf, 0xff, 0x00, 0xe7, 0x7e, 0xff, 0x88, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 
+  0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xa2, 0xf7, 0xbf, 0xff, 0x01, 0xef, 0x9e, 0xff, 0xe7, 0x3d, 0xff, 0x86, 0xdf, 
+  0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0xd3, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xa3, 0xf7, 
+  0xbf, 0xff, 0x01, 0xf7, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0x85, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 
+  0xc8, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xa5, 0xf7, 0xbf, 0xff, 0x00, 0xe7, 0x5e, 0xff, 0x84, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 
+  0xc8, 0x83, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x27, 0x8c, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xa6, 0xf7, 0xbf, 0xff, 0x00, 0xef, 0x7e, 0xff, 0x83, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 
+  0xff, 0x85, 0xfa, 0x27, 0xff, 0x00, 0xfa, 0x27, 0x8c, 0x83, 0x00, 0x00, 0x00, 0x01, 0xfa, 0x27, 0x27, 0xfa, 0x27, 0xfb, 0x84, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xa7, 0xf7, 0xbf, 0xff, 
+  0x01, 0xef, 0x9e, 0xff, 0xe7, 0x5d, 0xff, 0x81, 0xdf, 0x3d, 0xff, 0x00, 0xf4, 0xf4, 0xff, 0x84, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x27, 0xfb, 0xfa, 0x27, 0x24, 0x84, 0x00, 0x00, 0x00, 0x00, 0xfa, 
+  0x27, 0x6c, 0x84, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xa8, 0xf7, 0xbf, 0xff, 0x03, 0xf7, 0x9f, 0xff, 0xe7, 0x5d, 0xff, 0xdf, 0x3d, 0xff, 0xf4, 0xf4, 0xff, 0x84, 0xfa, 0x27, 0xff, 0x00, 
+  0xfa, 0x27, 0x6c, 0x86, 0x00, 0x00, 0x00, 0x01, 0xfa, 0x27, 0x58, 0xfa, 0x27, 0xe8, 0x82, 0xfa, 0x27, 0xff, 0x00, 0xfd, 0x34, 0xfc, 0xaa, 0xf7, 0xbf, 0xff, 0x01, 0xe7, 0x5e, 0xff, 0xf4, 0xf4, 
+  0xff, 0x82, 0xfa, 0x27, 0xff, 0x01, 0xfa, 0x27, 0xe8, 0xfa, 0x27, 0x58, 0x88, 0x00, 0x00, 0x00, 0x04, 0xfa, 0x27, 0x07, 0xfa, 0x27, 0x44, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0x70, 0xfd, 0x34, 0x70, 
+  0xab, 0xf7, 0xbf, 0x70, 0x04, 0xf5, 0x14, 0x70, 0xfa, 0x27, 0x70, 0xfa, 0x27, 0x6c, 0xfa, 0x27, 0x44, 0xfa, 0x27, 0x07, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x43, 0xf8, 0x07, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x70, 0x69, 0x6f, 0xf7, 0x70, 0xf3, 0xf1, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf3, 0xf1, 0xf1, 0x70, 0x69, 0x6e, 0xf7, 0x70, 0x37, 0x44, 0xf8, 0x70, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x44, 0xf7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf7, 0x00, 0x37, 0x44, 0xf8, 0x58, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x8c, 0x8f, 0xf6, 0xff, 0xee, 0xec, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xee, 0xed, 0xf1, 0xff, 0x8d, 0x90, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0x58, 0x36, 0x45, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0xf6, 0x00, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x68, 0x6e, 0xf7, 0xff, 0xe0, 0xdf, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xe0, 0xdf, 0xf2, 0xff, 0x69, 0x6e, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0x6f, 0x3b, 0x45, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x27, 0x37, 0x44, 0xf8, 0xfb, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x47, 0x51, 0xf8, 0xff, 0xc9, 0xc9, 0xf4, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xca, 0xc9, 0xf4, 0xff, 0x47, 0x51, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xfb, 0x37, 0x44, 0xf8, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x8c, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x35, 0x43, 0xf8, 0xff, 0xa9, 0xaa, 0xf5, 0xff, 0xf4, 0xf3, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf4, 0xf3, 0xf1, 0xff, 0xaa, 0xab, 0xf5, 0xff, 0x35, 0x43, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xc8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x85, 0x88, 0xf6, 0xff, 0xec, 0xea, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xec, 0xea, 0xf2, 0xff, 0x85, 0x88, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x62, 0x68, 0xf7, 0xff, 0xdc, 0xdb, 0xf3, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xdd, 0xdc, 0xf3, 0xff, 0x62, 0x69, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x43, 0x4e, 0xf8, 0xff, 0xc3, 0xc3, 0xf4, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xc4, 0xc4, 0xf4, 0xff, 0x43, 0x4e, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x36, 0x44, 0xf8, 0xff, 0xa2, 0xa3, 0xf5, 0xff, 0xf4, 0xf2, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf4, 0xf2, 0xf1, 0xff, 0xa2, 0xa4, 0xf5, 0xff, 0x36, 0x43, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7d, 0x81, 0xf7, 0xff, 0xe9, 0xe8, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xea, 0xe8, 0xf2, 0xff, 0x7e, 0x82, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x71, 0x76, 0xf7, 0xff, 0x49, 0x53, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x59, 0x60, 0xf7, 0xff, 0xd8, 0xd7, 0xf3, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xd9, 0xd8, 0xf3, 0xff, 0x5a, 0x62, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x48, 0x51, 0xf7, 0xff, 0x6d, 0x71, 0xf4, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xe3, 0xe2, 0xf2, 0xff, 0x70, 0x75, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x3e, 0x4a, 0xf8, 0xff, 0xbd, 0xbd, 0xf4, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xbe, 0xbe, 0xf4, 0xff, 0x3f, 0x4a, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x6b, 0x70, 0xf4, 0xff, 0xd7, 0xd4, 0xe1, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf1, 0xef, 0xf1, 0xff, 0x98, 0x9a, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x9a, 0x9c, 0xf6, 0xff, 0xf2, 0xf1, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf2, 0xf1, 0xf1, 0xff, 0x9b, 0x9d, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x90, 0x92, 0xf0, 0xff, 0xe4, 0xe1, 0xde, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xbe, 0xbe, 0xf4, 0xff, 0x41, 0x4c, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x76, 0x7a, 0xf7, 0xff, 0xe7, 0xe5, 0xf2, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xe7, 0xe6, 0xf2, 0xff, 0x77, 0x7b, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x40, 0x4b, 0xf8, 0xff, 0xb4, 0xb3, 0xea, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xdb, 0xda, 0xf3, 0xff, 0x62, 0x68, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x52, 0x5a, 0xf8, 0xff, 0xd4, 0xd3, 0xf3, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xd4, 0xd4, 0xf3, 0xff, 0x53, 0x5b, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x5e, 0x64, 0xf6, 0xff, 0xcf, 0xcd, 0xe3, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xec, 0xeb, 0xf2, 0xff, 0x89, 0x8c, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x38, 0x45, 0xf8, 0xff, 0xb7, 0xb8, 0xf4, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0xb8, 0xb9, 0xf4, 0xff, 0x39, 0x46, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x83, 0x85, 0xf2, 0xff, 0xe0, 0xdd, 0xdf, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xb2, 0xb3, 0xf5, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x93, 0x96, 0xf6, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf1, 0xef, 0xf1, 0xff, 0x94, 0x97, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa9, 0xa8, 0xec, 0xff, 0xe8, 0xe4, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xd2, 0xd2, 0xf3, 0xff, 0x52, 0x5a, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x6f, 0x74, 0xf7, 0xff, 0xe4, 0xe3, 0xf2, 0xff, 0xe4, 0xe3, 0xf2, 0xff, 0x70, 0x75, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x4f, 0x57, 0xf7, 0xff, 0xc7, 0xc5, 0xe5, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xe7, 0xe6, 0xf2, 0xff, 0x7a, 0x7e, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x4d, 0x56, 0xf8, 0xff, 0x4d, 0x56, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x74, 0x78, 0xf3, 0xff, 0xdb, 0xd8, 0xe0, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf3, 0xf1, 0xf1, 0xff, 0xa2, 0xa4, 0xf5, 0xff, 0x36, 0x43, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x36, 0x43, 0xf8, 0xff, 0x9a, 0x9b, 0xee, 0xff, 0xe6, 0xe3, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xc7, 0xc7, 0xf4, 0xff, 0x47, 0x51, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x45, 0x4f, 0xf7, 0xff, 0xbc, 0xbb, 0xe8, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xe1, 0xdf, 0xf2, 0xff, 0x6c, 0x71, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x67, 0x6c, 0xf5, 0xff, 0xd5, 0xd2, 0xe2, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf0, 0xee, 0xf1, 0xff, 0x94, 0x96, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x8c, 0x8e, 0xf1, 0xff, 0xe3, 0xe0, 0xde, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0xba, 0xbb, 0xf4, 0xff, 0x3d, 0x49, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x3d, 0x48, 0xf8, 0xff, 0xb1, 0xb0, 0xea, 0xff, 0xe9, 0xe5, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xd8, 0xd8, 0xf3, 0xff, 0x5d, 0x64, 0xf7, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x59, 0x60, 0xf6, 0xff, 0xcd, 0xcb, 0xe4, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xeb, 0xe9, 0xf2, 0xff, 0x85, 0x88, 0xf6, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x7e, 0x81, 0xf2, 0xff, 0xde, 0xdb, 0xdf, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xad, 0xae, 0xf5, 0xff, 0x35, 0x43, 0xf8, 0xff, 0x36, 0x43, 0xf8, 0xff, 0xa4, 0xa4, 0xed, 0xff, 0xe8, 0xe4, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xcf, 0xce, 0xf3, 0xff, 0xc5, 0xc3, 0xe7, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf5, 0xf3, 0xee, 0xff, 0xec, 0xe8, 0xdf, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf4, 0xf0, 0xff, 0xee, 0xeb, 0xe3, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf1, 0xee, 0xe7, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf3, 0xf1, 0xeb, 0xff, 0xeb, 0xe7, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf5, 0xf3, 0xee, 0xff, 0xec, 0xe9, 0xe0, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xef, 0xeb, 0xe4, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf1, 0xee, 0xe8, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf4, 0xf1, 0xec, 0xff, 0xeb, 0xe7, 0xde, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf3, 0xef, 0xff, 0xed, 0xe9, 0xe1, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf0, 0xff, 0xef, 0xec, 0xe4, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf2, 0xef, 0xe9, 0xff, 0xea, 0xe6, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf4, 0xf2, 0xed, 0xff, 0xeb, 0xe8, 0xde, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xc8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf4, 0xef, 0xff, 0xed, 0xea, 0xe1, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x8c, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf0, 0xed, 0xe5, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x27, 0x37, 0x44, 0xf8, 0xfb, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf2, 0xf0, 0xea, 0xff, 0xea, 0xe7, 0xdd, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xfb, 0x37, 0x44, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x45, 0xf5, 0x00, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf5, 0xf2, 0xed, 0xff, 0xec, 0xe8, 0xdf, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0x6c, 0x33, 0x47, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x45, 0xf7, 0x00, 0x37, 0x44, 0xf8, 0x58, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf6, 0xf4, 0xf0, 0xff, 0xee, 0xea, 0xe2, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xff, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0x58, 0x38, 0x44, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x43, 0xf8, 0x07, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x70, 0xa4, 0xa5, 0xf5, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf1, 0x70, 0xf7, 0xf5, 0xf0, 0x70, 0xa0, 0xa0, 0xf1, 0x70, 0x37, 0x44, 0xf8, 0x70, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x45, 0xf8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x36, 0x43, 
+  0xf8, 0x07, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x70, 0x69, 0x6f, 0xf7, 0x70, 0xf3, 0xf1, 0xf1, 0x70, 0xa9, 0xf7, 0xf5, 0xf1, 0x70, 0x05, 0xf3, 0xf1, 0xf1, 0x70, 
+  0x69, 0x6e, 0xf7, 0x70, 0x37, 0x44, 0xf8, 0x70, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x44, 0xf7, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x37, 0x44, 0xf8, 0x58, 0x37, 0x44, 
+  0xf8, 0xe8, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x8c, 0x8f, 0xf6, 0xff, 0xee, 0xec, 0xf2, 0xff, 0xa7, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xee, 0xed, 0xf1, 0xff, 0x8d, 0x90, 0xf6, 0xff, 0x83, 0x37, 
+  0x44, 0xf8, 0xff, 0x01, 0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0x58, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x6c, 0x86, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x68, 0x6e, 0xf7, 0xff, 
+  0xe0, 0xdf, 0xf2, 0xff, 0xa5, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xe0, 0xdf, 0xf2, 0xff, 0x69, 0x6e, 0xf7, 0xff, 0x86, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0x6f, 0x84, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x37, 0x44, 0xf8, 0x27, 0x37, 0x44, 0xf8, 0xfb, 0x87, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x47, 0x51, 0xf8, 0xff, 0xc9, 0xc9, 0xf4, 0xff, 0xa3, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xca, 0xc9, 
+  0xf4, 0xff, 0x47, 0x51, 0xf8, 0xff, 0x87, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x37, 0x44, 0xf8, 0xfb, 0x37, 0x44, 0xf8, 0x27, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x8c, 0x89, 0x37, 
+  0x44, 0xf8, 0xff, 0x02, 0x35, 0x43, 0xf8, 0xff, 0xa9, 0xaa, 0xf5, 0xff, 0xf4, 0xf3, 0xf1, 0xff, 0x9f, 0xf7, 0xf5, 0xf1, 0xff, 0x02, 0xf4, 0xf3, 0xf1, 0xff, 0xaa, 0xab, 0xf5, 0xff, 0x35, 0x43, 
+  0xf8, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0x8c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xc8, 0x8b, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x85, 0x88, 0xf6, 0xff, 
+  0xec, 0xea, 0xf2, 0xff, 0x9d, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xec, 0xea, 0xf2, 0xff, 0x85, 0x88, 0xf6, 0xff, 0x8b, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xc8, 0x83, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x8c, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x62, 0x68, 0xf7, 0xff, 0xdc, 0xdb, 0xf3, 0xff, 0x9b, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xdd, 0xdc, 0xf3, 0xff, 0x62, 0x69, 
+  0xf7, 0xff, 0x8c, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x8d, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x43, 0x4e, 0xf8, 0xff, 
+  0xc3, 0xc3, 0xf4, 0xff, 0x99, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xc4, 0xc4, 0xf4, 0xff, 0x43, 0x4e, 0xf8, 0xff, 0x8d, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x8e, 0x37, 0x44, 0xf8, 0xff, 0x02, 0x36, 0x44, 0xf8, 0xff, 0xa2, 0xa3, 0xf5, 0xff, 0xf4, 0xf2, 0xf1, 0xff, 0x95, 0xf7, 0xf5, 0xf1, 0xff, 0x02, 0xf4, 0xf2, 
+  0xf1, 0xff, 0xa2, 0xa4, 0xf5, 0xff, 0x36, 0x43, 0xf8, 0xff, 0x8e, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x90, 0x37, 
+  0x44, 0xf8, 0xff, 0x01, 0x7d, 0x81, 0xf7, 0xff, 0xe9, 0xe8, 0xf2, 0xff, 0x93, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xea, 0xe8, 0xf2, 0xff, 0x7e, 0x82, 0xf7, 0xff, 0x90, 0x37, 0x44, 0xf8, 0xff, 0x00, 
+  0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x71, 0x76, 0xf7, 0xff, 0x49, 0x53, 0xf8, 0xff, 0x89, 0x37, 0x44, 0xf8, 
+  0xff, 0x01, 0x59, 0x60, 0xf7, 0xff, 0xd8, 0xd7, 0xf3, 0xff, 0x91, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xd9, 0xd8, 0xf3, 0xff, 0x5a, 0x62, 0xf7, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x48, 0x51, 
+  0xf7, 0xff, 0x6d, 0x71, 0xf4, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x02, 
+  0xa4, 0xa5, 0xf5, 0xfc, 0xe3, 0xe2, 0xf2, 0xff, 0x70, 0x75, 0xf7, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x3e, 0x4a, 0xf8, 0xff, 0xbd, 0xbd, 0xf4, 0xff, 0x8f, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 
+  0xbe, 0xbe, 0xf4, 0xff, 0x3f, 0x4a, 0xf8, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x02, 0x6b, 0x70, 0xf4, 0xff, 0xd7, 0xd4, 0xe1, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 
+  0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x03, 0xa4, 0xa5, 0xf5, 0xfc, 0xf7, 0xf5, 0xf1, 0xff, 0xf1, 0xef, 0xf1, 0xff, 
+  0x98, 0x9a, 0xf6, 0xff, 0x8a, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x9a, 0x9c, 0xf6, 0xff, 0xf2, 0xf1, 0xf1, 0xff, 0x8b, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf2, 0xf1, 0xf1, 0xff, 0x9b, 0x9d, 0xf6, 0xff, 
+  0x8a, 0x37, 0x44, 0xf8, 0xff, 0x03, 0x90, 0x92, 0xf0, 0xff, 0xe4, 0xe1, 0xde, 0xff, 0xea, 0xe6, 0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x82, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xbe, 0xbe, 0xf4, 0xff, 0x41, 0x4c, 
+  0xf8, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x76, 0x7a, 0xf7, 0xff, 0xe7, 0xe5, 0xf2, 0xff, 0x89, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xe7, 0xe6, 0xf2, 0xff, 0x77, 0x7b, 0xf7, 0xff, 0x89, 0x37, 
+  0x44, 0xf8, 0xff, 0x01, 0x40, 0x4b, 0xf8, 0xff, 0xb4, 0xb3, 0xea, 0xff, 0x82, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x83, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xdb, 0xda, 0xf3, 0xff, 0x62, 0x68, 
+  0xf7, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x52, 0x5a, 0xf8, 0xff, 0xd4, 0xd3, 0xf3, 0xff, 0x87, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xd4, 0xd4, 0xf3, 0xff, 0x53, 0x5b, 0xf8, 0xff, 0x89, 0x37, 
+  0x44, 0xf8, 0xff, 0x01, 0x5e, 0x64, 0xf6, 0xff, 0xcf, 0xcd, 0xe3, 0xff, 0x83, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x84, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xec, 0xeb, 0xf2, 0xff, 0x89, 0x8c, 
+  0xf6, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x02, 0x38, 0x45, 0xf8, 0xff, 0xb7, 0xb8, 0xf4, 0xff, 0xf6, 0xf4, 0xf1, 0xff, 0x83, 0xf7, 0xf5, 0xf1, 0xff, 0x02, 0xf6, 0xf4, 0xf1, 0xff, 0xb8, 0xb9, 
+  0xf4, 0xff, 0x39, 0x46, 0xf8, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x83, 0x85, 0xf2, 0xff, 0xe0, 0xdd, 0xdf, 0xff, 0x84, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 
+  0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x85, 0xf7, 0xf5, 0xf1, 
+  0xff, 0x01, 0xf5, 0xf3, 0xf1, 0xff, 0xb2, 0xb3, 0xf5, 0xff, 0x8a, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x93, 0x96, 0xf6, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0x81, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf1, 0xef, 
+  0xf1, 0xff, 0x94, 0x97, 0xf6, 0xff, 0x8a, 0x37, 0x44, 0xf8, 0xff, 0x01, 0xa9, 0xa8, 0xec, 0xff, 0xe8, 0xe4, 0xdd, 0xff, 0x85, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 
+  0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x87, 0xf7, 0xf5, 0xf1, 
+  0xff, 0x01, 0xd2, 0xd2, 0xf3, 0xff, 0x52, 0x5a, 0xf8, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x6f, 0x74, 0xf7, 0xff, 0x81, 0xe4, 0xe3, 0xf2, 0xff, 0x00, 0x70, 0x75, 0xf7, 0xff, 0x89, 0x37, 
+  0x44, 0xf8, 0xff, 0x01, 0x4f, 0x57, 0xf7, 0xff, 0xc7, 0xc5, 0xe5, 0xff, 0x87, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x88, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xe7, 0xe6, 0xf2, 0xff, 0x7a, 0x7e, 
+  0xf7, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x81, 0x4d, 0x56, 0xf8, 0xff, 0x89, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x74, 0x78, 0xf3, 0xff, 0xdb, 0xd8, 0xe0, 0xff, 0x88, 0xea, 0xe6, 0xdc, 0xff, 0x00, 
+  0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 
+  0xf5, 0xfc, 0x89, 0xf7, 0xf5, 0xf1, 0xff, 0x02, 0xf3, 0xf1, 0xf1, 0xff, 0xa2, 0xa4, 0xf5, 0xff, 0x36, 0x43, 0xf8, 0xff, 0x91, 0x37, 0x44, 0xf8, 0xff, 0x02, 0x36, 0x43, 0xf8, 0xff, 0x9a, 0x9b, 
+  0xee, 0xff, 0xe6, 0xe3, 0xdd, 0xff, 0x89, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x8b, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xc7, 0xc7, 0xf4, 0xff, 0x47, 0x51, 0xf8, 0xff, 0x8f, 0x37, 0x44, 0xf8, 
+  0xff, 0x01, 0x45, 0x4f, 0xf7, 0xff, 0xbc, 0xbb, 0xe8, 0xff, 0x8b, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x8c, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xe1, 0xdf, 0xf2, 0xff, 0x6c, 0x71, 0xf7, 0xff, 
+  0x8d, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x67, 0x6c, 0xf5, 0xff, 0xd5, 0xd2, 0xe2, 0xff, 0x8c, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 
+  0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x8d, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf0, 0xee, 0xf1, 0xff, 
+  0x94, 0x96, 0xf6, 0xff, 0x8b, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x8c, 0x8e, 0xf1, 0xff, 0xe3, 0xe0, 0xde, 0xff, 0x8d, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 
+  0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x8e, 0xf7, 0xf5, 0xf1, 0xff, 0x02, 
+  0xf6, 0xf4, 0xf1, 0xff, 0xba, 0xbb, 0xf4, 0xff, 0x3d, 0x49, 0xf8, 0xff, 0x87, 0x37, 0x44, 0xf8, 0xff, 0x02, 0x3d, 0x48, 0xf8, 0xff, 0xb1, 0xb0, 0xea, 0xff, 0xe9, 0xe5, 0xdc, 0xff, 0x8e, 0xea, 
+  0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 
+  0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x90, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xd8, 0xd8, 0xf3, 0xff, 0x5d, 0x64, 0xf7, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x59, 0x60, 0xf6, 0xff, 0xcd, 0xcb, 
+  0xe4, 0xff, 0x90, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x91, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xeb, 0xe9, 0xf2, 0xff, 0x85, 0x88, 0xf6, 0xff, 0x83, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x7e, 0x81, 
+  0xf2, 0xff, 0xde, 0xdb, 0xdf, 0xff, 0x91, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x92, 0xf7, 0xf5, 0xf1, 0xff, 0x05, 0xf5, 0xf3, 0xf1, 0xff, 0xad, 0xae, 0xf5, 0xff, 0x35, 0x43, 0xf8, 0xff, 
+  0x36, 0x43, 0xf8, 0xff, 0xa4, 0xa4, 0xed, 0xff, 0xe8, 0xe4, 0xdd, 0xff, 0x92, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x94, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xcf, 0xce, 0xf3, 0xff, 0xc5, 0xc3, 
+  0xe7, 0xff, 0x94, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x95, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf5, 0xf3, 0xee, 0xff, 0xec, 0xe8, 0xdf, 0xff, 0x93, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 
+  0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 
+  0x96, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf6, 0xf4, 0xf0, 0xff, 0xee, 0xeb, 0xe3, 0xff, 0x92, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 
+  0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x98, 0xf7, 0xf5, 0xf1, 0xff, 0x00, 0xf1, 0xee, 0xe7, 0xff, 
+  0x91, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 
+  0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x99, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf3, 0xf1, 0xeb, 0xff, 0xeb, 0xe7, 0xdd, 0xff, 0x8f, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 
+  0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x9a, 0xf7, 
+  0xf5, 0xf1, 0xff, 0x01, 0xf5, 0xf3, 0xee, 0xff, 0xec, 0xe9, 0xe0, 0xff, 0x8e, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x9b, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf7, 0xf4, 0xf0, 0xff, 0xef, 0xeb, 
+  0xe4, 0xff, 0x8d, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x9d, 0xf7, 0xf5, 0xf1, 0xff, 0x00, 0xf1, 0xee, 0xe8, 0xff, 0x8c, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 
+  0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x9e, 0xf7, 0xf5, 0xf1, 
+  0xff, 0x01, 0xf4, 0xf1, 0xec, 0xff, 0xeb, 0xe7, 0xde, 0xff, 0x8a, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0x9f, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf6, 0xf3, 0xef, 0xff, 0xed, 0xe9, 0xe1, 0xff, 
+  0x89, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 
+  0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0xa0, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf7, 0xf5, 0xf0, 0xff, 0xef, 0xec, 0xe4, 0xff, 0x88, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 
+  0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0xa2, 0xf7, 
+  0xf5, 0xf1, 0xff, 0x01, 0xf2, 0xef, 0xe9, 0xff, 0xea, 0xe6, 0xdd, 0xff, 0x86, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0xa3, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf4, 0xf2, 0xed, 0xff, 0xeb, 0xe8, 
+  0xde, 0xff, 0x85, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0xc8, 
+  0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0xa4, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf6, 0xf4, 0xef, 0xff, 0xed, 0xea, 0xe1, 0xff, 0x84, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 
+  0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0xc8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0xf8, 0x8c, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 
+  0xa6, 0xf7, 0xf5, 0xf1, 0xff, 0x00, 0xf0, 0xed, 0xe5, 0xff, 0x83, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x85, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0x8c, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x37, 0x44, 0xf8, 0x27, 0x37, 0x44, 0xf8, 0xfb, 0x84, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0xa7, 0xf7, 0xf5, 0xf1, 0xff, 0x01, 0xf2, 0xf0, 0xea, 0xff, 
+  0xea, 0xe7, 0xdd, 0xff, 0x81, 0xea, 0xe6, 0xdc, 0xff, 0x00, 0x9d, 0x9d, 0xee, 0xff, 0x84, 0x37, 0x44, 0xf8, 0xff, 0x01, 0x37, 0x44, 0xf8, 0xfb, 0x37, 0x44, 0xf8, 0x24, 0x84, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x37, 0x44, 0xf8, 0x6c, 0x84, 0x37, 0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0xa8, 0xf7, 0xf5, 0xf1, 0xff, 0x03, 0xf5, 0xf2, 0xed, 0xff, 0xec, 0xe8, 0xdf, 0xff, 0xea, 0xe6, 
+  0xdc, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x84, 0x37, 0x44, 0xf8, 0xff, 0x00, 0x37, 0x44, 0xf8, 0x6c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0x37, 0x44, 0xf8, 0x58, 0x37, 0x44, 0xf8, 0xe8, 0x82, 0x37, 
+  0x44, 0xf8, 0xff, 0x00, 0xa4, 0xa5, 0xf5, 0xfc, 0xa9, 0xf7, 0xf5, 0xf1, 0xff, 0x02, 0xf6, 0xf4, 0xf0, 0xff, 0xee, 0xea, 0xe2, 0xff, 0x9d, 0x9d, 0xee, 0xff, 0x82, 0x37, 0x44, 0xf8, 0xff, 0x01, 
+  0x37, 0x44, 0xf8, 0xe8, 0x37, 0x44, 0xf8, 0x58, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0x36, 0x43, 0xf8, 0x07, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x70, 0xa4, 0xa5, 
+  0xf5, 0x70, 0xaa, 0xf7, 0xf5, 0xf1, 0x70, 0x05, 0xf7, 0xf5, 0xf0, 0x70, 0xa0, 0xa0, 0xf1, 0x70, 0x37, 0x44, 0xf8, 0x70, 0x37, 0x44, 0xf8, 0x6c, 0x37, 0x44, 0xf8, 0x44, 0x37, 0x45, 0xf8, 0x07, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +310,7 @@ const lv_img_dsc_t email_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( email_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = email_64px_map,
 };
-
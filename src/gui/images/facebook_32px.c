@@ -10,143 +10,133 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_FACEBOOK_32PX uint8_t facebook_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x4a, 0x00, 0x4e, 0x30, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x6f, 0x4e, 0x47, 0x4a, 0x00, 
-  0x4e, 0x2f, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x50, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xc4, 0x4e, 0x7b, 0x4e, 0x4c, 0x4e, 0x40, 0x4e, 0x4c, 0x4e, 0x60, 0x4e, 0x9f, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf0, 0x4e, 0x48, 0x4e, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x44, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xaf, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x4e, 0x07, 0x4e, 0x48, 0x4e, 0x68, 0x4e, 0x68, 0x4e, 0x94, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4e, 0xcb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x14, 0x4e, 0xf8, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x1b, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x1b, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x80, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe4, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe3, 0x4e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x17, 0x4e, 0xe0, 0x4e, 0xe4, 0x4e, 0xe4, 0x4e, 0xe4, 0x4e, 0xf3, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x80, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x1c, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x4a, 0x00, 0x4e, 0x8b, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x80, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x4e, 0xb0, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x80, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x4e, 0xd0, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x80, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x04, 0x4e, 0xe7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x80, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x87, 0x4e, 0x77, 0x4e, 0x77, 0x4e, 0x78, 0x4e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0b, 0x4e, 0x70, 0x4e, 0x73, 0x4e, 0x73, 0x4e, 0x77, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x80, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x68, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x83, 
-  0x4e, 0x37, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x18, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x54, 
-  0x4a, 0x00, 0x4e, 0x40, 0x4e, 0x78, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7b, 0x4e, 0x7c, 0x4e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0c, 0x4e, 0x7c, 0x4e, 0x7f, 0x4e, 0x7f, 0x4e, 0x7f, 0x4e, 0x7f, 0x4e, 0x7f, 0x4e, 0x7f, 0x4e, 0x7f, 0x4e, 0x54, 0x4e, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x01, 0x00, 0x00, 0x4e, 0x30, 0x9b, 0x4e, 0x6f, 0x02, 0x4e, 0x47, 0x00, 0x00, 0x4e, 0x2f, 0x9d, 0x4e, 0xff, 0x01, 0x4e, 0x50, 0x4e, 0x68, 0x9d, 0x4e, 0xff, 0x01, 0x4e, 
+  0x83, 0x4e, 0x68, 0x9d, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x9d, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x92, 0x4e, 0xff, 0x06, 0x4e, 0xc4, 0x4e, 0x7b, 0x4e, 0x4c, 0x4e, 0x40, 0x4e, 
+  0x4c, 0x4e, 0x60, 0x4e, 0x9f, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x90, 0x4e, 0xff, 0x01, 0x4e, 0xf0, 0x4e, 0x48, 0x85, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x83, 0x4e, 0xff, 0x01, 0x4e, 
+  0x83, 0x4e, 0x68, 0x90, 0x4e, 0xff, 0x00, 0x4e, 0x44, 0x86, 0x00, 0x00, 0x00, 0x4e, 0x4b, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0xaf, 0x87, 0x00, 0x00, 
+  0x00, 0x4e, 0x4b, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x68, 0x83, 0x00, 0x00, 0x01, 0x4e, 0x07, 0x4e, 0x48, 0x81, 0x4e, 0x68, 0x00, 0x4e, 0x94, 0x83, 
+  0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x33, 0x83, 0x00, 0x00, 0x00, 0x4e, 0xcb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 
+  0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x14, 0x4e, 0xf8, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x1c, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x1b, 0x4e, 0xfb, 0x87, 
+  0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x1c, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x1b, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x80, 0x4e, 0x68, 0x8b, 0x4e, 0xff, 
+  0x00, 0x4e, 0xe4, 0x81, 0x4e, 0xe0, 0x01, 0x4e, 0xe3, 0x4e, 0x17, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x17, 0x4e, 0xe0, 0x82, 0x4e, 0xe4, 0x00, 0x4e, 0xf3, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x80, 0x4e, 
+  0x68, 0x8b, 0x4e, 0xff, 0x00, 0x4e, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x4e, 0x8b, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x80, 0x4e, 0x68, 0x8b, 0x4e, 0xff, 0x00, 0x4e, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x4e, 
+  0xb0, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x80, 0x4e, 0x68, 0x8b, 0x4e, 0xff, 0x00, 0x4e, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x4e, 0xd0, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x80, 0x4e, 0x68, 0x8b, 0x4e, 0xff, 
+  0x00, 0x4e, 0x1f, 0x8a, 0x00, 0x00, 0x01, 0x4e, 0x04, 0x4e, 0xe7, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x80, 0x4e, 0x68, 0x8b, 0x4e, 0xff, 0x00, 0x4e, 0x87, 0x81, 0x4e, 0x77, 0x01, 0x4e, 0x78, 0x4e, 
+  0x0f, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x0b, 0x4e, 0x70, 0x81, 0x4e, 0x73, 0x01, 0x4e, 0x77, 0x4e, 0xfb, 0x83, 0x4e, 0xff, 0x01, 0x4e, 0x80, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 
+  0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 
+  0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 
+  0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 
+  0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 
+  0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 
+  0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x68, 0x8f, 
+  0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x01, 0x4e, 0x83, 0x4e, 0x37, 0x8f, 0x4e, 0xff, 0x00, 0x4e, 0x20, 0x82, 0x00, 0x00, 0x01, 0x4e, 
+  0x18, 0x4e, 0xfb, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0x54, 0x00, 0x00, 0x4e, 0x40, 0x4e, 0x78, 0x8c, 0x4e, 0x7b, 0x01, 0x4e, 0x7c, 0x4e, 0x0f, 0x82, 0x00, 0x00, 0x01, 0x4e, 0x0c, 0x4e, 0x7c, 0x86, 
+  0x4e, 0x7f, 0x01, 0x4e, 0x54, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x71, 0x32, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x47, 0x70, 0x32, 0x00, 
-  0xd3, 0x3a, 0x2f, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x50, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xc4, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x4c, 0xd3, 0x3a, 0x40, 0xd3, 0x3a, 0x4c, 0xd3, 0x3a, 0x60, 0xd3, 0x3a, 0x9f, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xf0, 0xd3, 0x3a, 0x48, 0xf2, 0x3a, 0x00, 0x2a, 0x32, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x4b, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x44, 0xee, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x4b, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xaf, 0x71, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x4b, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x19, 0x00, 0xd3, 0x3a, 0x07, 0xd3, 0x3a, 0x48, 0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0x94, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x08, 0x00, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0xf8, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xf3, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x80, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe4, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe3, 0xd3, 0x3a, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x17, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe4, 0xd3, 0x3a, 0xe4, 0xd3, 0x3a, 0xe4, 0xd3, 0x3a, 0xf3, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x80, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x1c, 0x0e, 0x2a, 0x00, 0x0e, 0x2a, 0x00, 0x0e, 0x2a, 0x00, 0xee, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x19, 0x00, 0x0e, 0x2a, 0x00, 0x0e, 0x2a, 0x00, 0x0e, 0x2a, 0x00, 0x71, 0x32, 0x00, 0xd3, 0x3a, 0x8b, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x80, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x00, 0xd3, 0x3a, 0xb0, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x80, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x2a, 0x00, 0xd3, 0x3a, 0xd0, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x80, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x80, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x87, 0xd3, 0x3a, 0x77, 0xd3, 0x3a, 0x77, 0xd3, 0x3a, 0x78, 0xd3, 0x3a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x0b, 0xd3, 0x3a, 0x70, 0xd3, 0x3a, 0x73, 0xd3, 0x3a, 0x73, 0xd3, 0x3a, 0x77, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x80, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x68, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x83, 
-  0xd3, 0x3a, 0x37, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x54, 
-  0x70, 0x32, 0x00, 0xd3, 0x3a, 0x40, 0xd3, 0x3a, 0x78, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x7c, 0xd3, 0x3a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x0c, 0xd3, 0x3a, 0x7c, 0xd3, 0x3a, 0x7f, 0xd3, 0x3a, 0x7f, 0xd3, 0x3a, 0x7f, 0xd3, 0x3a, 0x7f, 0xd3, 0x3a, 0x7f, 0xd3, 0x3a, 0x7f, 0xd3, 0x3a, 0x7f, 0xd3, 0x3a, 0x54, 0x90, 0x3a, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x01, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0x9b, 0xd3, 0x3a, 0x6f, 0x02, 0xd3, 0x3a, 0x47, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x2f, 0x9d, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 
+  0x50, 0xd3, 0x3a, 0x68, 0x9d, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x9d, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x9d, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 
+  0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x92, 0xd3, 0x3a, 0xff, 0x06, 0xd3, 0x3a, 0xc4, 0xd3, 0x3a, 0x7b, 0xd3, 0x3a, 0x4c, 0xd3, 0x3a, 0x40, 0xd3, 0x3a, 0x4c, 0xd3, 0x3a, 0x60, 0xd3, 0x3a, 0x9f, 0x83, 
+  0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x90, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0xf0, 0xd3, 0x3a, 0x48, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x4b, 0x83, 0xd3, 0x3a, 
+  0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x90, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x44, 0x86, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x4b, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 
+  0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0xaf, 0x87, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x4b, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 
+  0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x68, 0x83, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x07, 0xd3, 0x3a, 0x48, 0x81, 0xd3, 0x3a, 0x68, 0x00, 0xd3, 0x3a, 0x94, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 
+  0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x33, 0x83, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xcb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 
+  0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0xf8, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 
+  0xff, 0x00, 0xd3, 0x3a, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 
+  0xf3, 0x3a, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x68, 0x8b, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 
+  0xe4, 0x81, 0xd3, 0x3a, 0xe0, 0x01, 0xd3, 0x3a, 0xe3, 0xd3, 0x3a, 0x17, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x17, 0xd3, 0x3a, 0xe0, 0x82, 0xd3, 0x3a, 0xe4, 0x00, 0xd3, 0x3a, 0xf3, 0x83, 
+  0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x68, 0x8b, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x8b, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 
+  0x3a, 0x80, 0xd3, 0x3a, 0x68, 0x8b, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xb0, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x68, 
+  0x8b, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xd0, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x68, 0x8b, 0xd3, 0x3a, 0xff, 0x00, 
+  0xd3, 0x3a, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xe7, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x68, 0x8b, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 
+  0x87, 0x81, 0xd3, 0x3a, 0x77, 0x01, 0xd3, 0x3a, 0x78, 0xd3, 0x3a, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x0b, 0xd3, 0x3a, 0x70, 0x81, 0xd3, 0x3a, 0x73, 0x01, 0xd3, 0x3a, 0x77, 0xd3, 
+  0x3a, 0xfb, 0x83, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 
+  0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 
+  0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 
+  0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 
+  0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 
+  0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 
+  0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 
+  0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 
+  0xff, 0x00, 0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x68, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 
+  0xd3, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x37, 0x8f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 
+  0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0xfb, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0x54, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x40, 0xd3, 0x3a, 0x78, 0x8c, 0xd3, 0x3a, 
+  0x7b, 0x01, 0xd3, 0x3a, 0x7c, 0xd3, 0x3a, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x0c, 0xd3, 0x3a, 0x7c, 0x86, 0xd3, 0x3a, 0x7f, 0x01, 0xd3, 0x3a, 0x54, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x32, 0x71, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x47, 0x32, 0x70, 0x00, 
-  0x3a, 0xd3, 0x2f, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x50, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xc4, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x4c, 0x3a, 0xd3, 0x40, 0x3a, 0xd3, 0x4c, 0x3a, 0xd3, 0x60, 0x3a, 0xd3, 0x9f, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xf0, 0x3a, 0xd3, 0x48, 0x3a, 0xf2, 0x00, 0x32, 0x2a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x4b, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x44, 0x29, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x4b, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xaf, 0x32, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x4b, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x08, 0x00, 0x3a, 0xd3, 0x07, 0x3a, 0xd3, 0x48, 0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0x94, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x00, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0xf8, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xf3, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x80, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe4, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe3, 0x3a, 0xd3, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x17, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe4, 0x3a, 0xd3, 0xe4, 0x3a, 0xd3, 0xe4, 0x3a, 0xd3, 0xf3, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x80, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x1c, 0x2a, 0x0e, 0x00, 0x2a, 0x0e, 0x00, 0x2a, 0x0e, 0x00, 0x29, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6a, 0x00, 0x2a, 0x0e, 0x00, 0x2a, 0x0e, 0x00, 0x2a, 0x0e, 0x00, 0x32, 0x71, 0x00, 0x3a, 0xd3, 0x8b, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x80, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x0e, 0x00, 0x3a, 0xd3, 0xb0, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x80, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x72, 0x00, 0x3a, 0xd3, 0xd0, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x80, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x80, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x87, 0x3a, 0xd3, 0x77, 0x3a, 0xd3, 0x77, 0x3a, 0xd3, 0x78, 0x3a, 0xd3, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x0b, 0x3a, 0xd3, 0x70, 0x3a, 0xd3, 0x73, 0x3a, 0xd3, 0x73, 0x3a, 0xd3, 0x77, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x80, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x68, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x83, 
-  0x3a, 0xd3, 0x37, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x54, 
-  0x32, 0x70, 0x00, 0x3a, 0xd3, 0x40, 0x3a, 0xd3, 0x78, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x7c, 0x3a, 0xd3, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x0c, 0x3a, 0xd3, 0x7c, 0x3a, 0xd3, 0x7f, 0x3a, 0xd3, 0x7f, 0x3a, 0xd3, 0x7f, 0x3a, 0xd3, 0x7f, 0x3a, 0xd3, 0x7f, 0x3a, 0xd3, 0x7f, 0x3a, 0xd3, 0x7f, 0x3a, 0xd3, 0x54, 0x3a, 0x90, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x01, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x9b, 0x3a, 0xd3, 0x6f, 0x02, 0x3a, 0xd3, 0x47, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x2f, 0x9d, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 
+  0x50, 0x3a, 0xd3, 0x68, 0x9d, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x9d, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x9d, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 
+  0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x92, 0x3a, 0xd3, 0xff, 0x06, 0x3a, 0xd3, 0xc4, 0x3a, 0xd3, 0x7b, 0x3a, 0xd3, 0x4c, 0x3a, 0xd3, 0x40, 0x3a, 0xd3, 0x4c, 0x3a, 0xd3, 0x60, 0x3a, 0xd3, 0x9f, 0x83, 
+  0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x90, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0xf0, 0x3a, 0xd3, 0x48, 0x85, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x4b, 0x83, 0x3a, 0xd3, 
+  0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x90, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x44, 0x86, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x4b, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 
+  0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0xaf, 0x87, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x4b, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 
+  0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x68, 0x83, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x07, 0x3a, 0xd3, 0x48, 0x81, 0x3a, 0xd3, 0x68, 0x00, 0x3a, 0xd3, 0x94, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 
+  0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x33, 0x83, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0xcb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 
+  0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0xf8, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 
+  0xff, 0x00, 0x3a, 0xd3, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 
+  0x3a, 0xf3, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x68, 0x8b, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 
+  0xe4, 0x81, 0x3a, 0xd3, 0xe0, 0x01, 0x3a, 0xd3, 0xe3, 0x3a, 0xd3, 0x17, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x17, 0x3a, 0xd3, 0xe0, 0x82, 0x3a, 0xd3, 0xe4, 0x00, 0x3a, 0xd3, 0xf3, 0x83, 
+  0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x68, 0x8b, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x8b, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 
+  0xd3, 0x80, 0x3a, 0xd3, 0x68, 0x8b, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0xb0, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x68, 
+  0x8b, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0xd0, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x68, 0x8b, 0x3a, 0xd3, 0xff, 0x00, 
+  0x3a, 0xd3, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xe7, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x68, 0x8b, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 
+  0x87, 0x81, 0x3a, 0xd3, 0x77, 0x01, 0x3a, 0xd3, 0x78, 0x3a, 0xd3, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x0b, 0x3a, 0xd3, 0x70, 0x81, 0x3a, 0xd3, 0x73, 0x01, 0x3a, 0xd3, 0x77, 0x3a, 
+  0xd3, 0xfb, 0x83, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 
+  0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 
+  0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 
+  0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 
+  0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 
+  0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 
+  0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 
+  0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 
+  0xff, 0x00, 0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x68, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 
+  0x3a, 0xd3, 0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x37, 0x8f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 
+  0x20, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0xfb, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0x54, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x40, 0x3a, 0xd3, 0x78, 0x8c, 0x3a, 0xd3, 
+  0x7b, 0x01, 0x3a, 0xd3, 0x7c, 0x3a, 0xd3, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x0c, 0x3a, 0xd3, 0x7c, 0x86, 0x3a, 0xd3, 0x7f, 0x01, 0x3a, 0xd3, 0x54, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x86, 0x4b, 0x33, 0x00, 0x97, 0x59, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x6f, 0x97, 0x59, 0x3b, 0x47, 0x84, 0x4d, 0x32, 0x00, 
-  0x97, 0x59, 0x3c, 0x2f, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x50, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xc4, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x4c, 0x96, 0x5a, 0x3b, 0x40, 0x98, 0x5a, 0x3b, 0x4c, 0x97, 0x59, 0x3b, 0x60, 0x97, 0x59, 0x3b, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xf0, 0x97, 0x59, 0x3b, 0x48, 0x94, 0x5b, 0x39, 0x00, 0x51, 0x46, 0x2e, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x4b, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x44, 0x6f, 0x3d, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x4b, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xaf, 0x85, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x4b, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x21, 0x16, 0x00, 0x97, 0x5a, 0x3b, 0x07, 0x97, 0x59, 0x3b, 0x48, 0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3a, 0x68, 0x97, 0x59, 0x3b, 0x94, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x01, 0x07, 0x00, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x14, 0x97, 0x59, 0x3b, 0xf8, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x1b, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x5c, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x1b, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x80, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe4, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe3, 0x97, 0x5a, 0x3b, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x17, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe4, 0x97, 0x59, 0x3b, 0xe4, 0x97, 0x59, 0x3b, 0xe4, 0x97, 0x59, 0x3b, 0xf3, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x80, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x1c, 0x6e, 0x3f, 0x29, 0x00, 0x6e, 0x3f, 0x29, 0x00, 0x6e, 0x3f, 0x29, 0x00, 0x6e, 0x3d, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x2c, 0x1b, 0x00, 0x6e, 0x3f, 0x29, 0x00, 0x6e, 0x3f, 0x29, 0x00, 0x6e, 0x3f, 0x29, 0x00, 0x85, 0x4d, 0x33, 0x00, 0x97, 0x59, 0x3b, 0x8b, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x80, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x3f, 0x29, 0x00, 0x97, 0x59, 0x3b, 0xb0, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x80, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x4b, 0x2a, 0x00, 0x97, 0x59, 0x3b, 0xd0, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x80, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x80, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x87, 0x97, 0x59, 0x3b, 0x77, 0x97, 0x59, 0x3b, 0x77, 0x97, 0x59, 0x3b, 0x78, 0x98, 0x58, 0x3a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x0b, 0x97, 0x59, 0x3b, 0x70, 0x97, 0x59, 0x3b, 0x73, 0x97, 0x59, 0x3b, 0x73, 0x97, 0x59, 0x3b, 0x77, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x80, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x83, 
-  0x97, 0x59, 0x3b, 0x37, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x54, 
-  0x84, 0x4c, 0x32, 0x00, 0x97, 0x59, 0x3b, 0x40, 0x97, 0x59, 0x3b, 0x78, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x7c, 0x98, 0x58, 0x3a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x0c, 0x97, 0x59, 0x3b, 0x7c, 0x97, 0x59, 0x3b, 0x7f, 0x97, 0x59, 0x3b, 0x7f, 0x97, 0x59, 0x3b, 0x7f, 0x97, 0x59, 0x3b, 0x7f, 0x97, 0x59, 0x3b, 0x7f, 0x97, 0x59, 0x3b, 0x7f, 0x97, 0x59, 0x3b, 0x7f, 0x97, 0x59, 0x3b, 0x54, 0x81, 0x51, 0x35, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x30, 0x9b, 0x97, 0x59, 0x3b, 0x6f, 0x02, 0x97, 0x59, 0x3b, 0x47, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3c, 0x2f, 0x9d, 
+  0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x50, 0x97, 0x59, 0x3b, 0x68, 0x9d, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x9d, 0x97, 0x59, 0x3b, 0xff, 
+  0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x9d, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x92, 0x97, 0x59, 0x3b, 0xff, 0x06, 0x97, 0x59, 0x3b, 
+  0xc4, 0x97, 0x59, 0x3b, 0x7b, 0x97, 0x59, 0x3b, 0x4c, 0x96, 0x5a, 0x3b, 0x40, 0x98, 0x5a, 0x3b, 0x4c, 0x97, 0x59, 0x3b, 0x60, 0x97, 0x59, 0x3b, 0x9f, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 
+  0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0xf0, 0x97, 0x59, 0x3b, 0x48, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x4b, 0x83, 
+  0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 0x44, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 
+  0x4b, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 0xaf, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 
+  0x59, 0x3a, 0x4b, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 0x68, 0x83, 0x00, 0x00, 0x00, 0x00, 
+  0x04, 0x97, 0x5a, 0x3b, 0x07, 0x97, 0x59, 0x3b, 0x48, 0x97, 0x59, 0x3b, 0x68, 0x97, 0x59, 0x3a, 0x68, 0x97, 0x59, 0x3b, 0x94, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 
+  0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x33, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0xcb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 
+  0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x14, 0x97, 0x59, 0x3b, 0xf8, 0x87, 0x97, 0x59, 
+  0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x5a, 0x3b, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x1b, 0x97, 
+  0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x5c, 0x3c, 0x1c, 0x82, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x97, 0x59, 0x3b, 0x1b, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x80, 0x97, 0x59, 0x3b, 0x68, 0x8b, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 
+  0xe4, 0x81, 0x97, 0x59, 0x3b, 0xe0, 0x01, 0x97, 0x59, 0x3b, 0xe3, 0x97, 0x5a, 0x3b, 0x17, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x17, 0x97, 0x59, 0x3b, 0xe0, 0x82, 0x97, 0x59, 
+  0x3b, 0xe4, 0x00, 0x97, 0x59, 0x3b, 0xf3, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x80, 0x97, 0x59, 0x3b, 0x68, 0x8b, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3c, 0x1c, 0x8b, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x8b, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x80, 0x97, 0x59, 0x3b, 0x68, 0x8b, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3c, 
+  0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0xb0, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x80, 0x97, 0x59, 0x3b, 0x68, 0x8b, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 
+  0x59, 0x3c, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0xd0, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x80, 0x97, 0x59, 0x3b, 0x68, 0x8b, 0x97, 0x59, 0x3b, 0xff, 
+  0x00, 0x97, 0x59, 0x3c, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xe7, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x80, 0x97, 0x59, 0x3b, 
+  0x68, 0x8b, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 0x87, 0x81, 0x97, 0x59, 0x3b, 0x77, 0x01, 0x97, 0x59, 0x3b, 0x78, 0x98, 0x58, 0x3a, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 
+  0x5a, 0x3b, 0x0b, 0x97, 0x59, 0x3b, 0x70, 0x81, 0x97, 0x59, 0x3b, 0x73, 0x01, 0x97, 0x59, 0x3b, 0x77, 0x97, 0x59, 0x3b, 0xfb, 0x83, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x80, 0x97, 
+  0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 
+  0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 
+  0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 
+  0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 
+  0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 
+  0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 
+  0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 
+  0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 
+  0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x68, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 
+  0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0x83, 0x97, 0x59, 0x3b, 0x37, 0x8f, 
+  0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x18, 0x97, 0x59, 0x3b, 0xfb, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 
+  0x54, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x40, 0x97, 0x59, 0x3b, 0x78, 0x8c, 0x97, 0x59, 0x3b, 0x7b, 0x01, 0x97, 0x59, 0x3b, 0x7c, 0x98, 0x58, 0x3a, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x98, 0x5a, 0x3b, 0x0c, 0x97, 0x59, 0x3b, 0x7c, 0x86, 0x97, 0x59, 0x3b, 0x7f, 0x01, 0x97, 0x59, 0x3b, 0x54, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +144,7 @@ const lv_img_dsc_t facebook_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( facebook_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = facebook_32px_map,
 };
-
@@ -10,271 +10,292 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_FACEBOOK_64PX uint8_t facebook_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x0b, 0x4e, 0x03, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 
-  0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x10, 0x4e, 0xb0, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xd4, 0x4e, 0xc7, 0x4e, 0x4f, 0x4e, 0x00, 0x4e, 0x00, 
-  0x4e, 0x00, 0x4e, 0x10, 0x4e, 0xfc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x5b, 0x4e, 0x00, 
-  0x4e, 0x00, 0x4e, 0xa7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xdb, 0x4e, 0x0c, 
-  0x4e, 0x04, 0x4e, 0xcb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x07, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe0, 0x4e, 0xab, 0x4e, 0x88, 0x4e, 0x80, 0x4e, 0x83, 0x4e, 0x93, 0x4e, 0xa0, 0x4e, 0xb4, 0x4e, 0xcb, 0x4e, 0xe4, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xb7, 0x4e, 0x5c, 0x4e, 0x08, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xef, 0x4e, 0x33, 0x4e, 0x03, 0x4e, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xc8, 0x47, 0x03, 0x4e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xeb, 0x4e, 0x0c, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x1f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x8f, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf7, 0x4e, 0x33, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x90, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xb0, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x4e, 0x00, 0x4e, 0x1b, 0x4e, 0x74, 0x4e, 0xac, 0x4e, 0xcf, 0x4e, 0xd0, 0x4e, 0xd0, 0x4e, 0xd0, 0x4e, 0xcf, 0x4e, 0xf3, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x7c, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x4b, 0x4e, 0xf8, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x50, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4e, 0xeb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x44, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x20, 0x4e, 0xf3, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x2f, 0x4e, 0xf4, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3b, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x33, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x38, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x33, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x38, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x33, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x38, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x33, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x38, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x33, 0x4e, 0xf8, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xd7, 0x4e, 0xc0, 0x4e, 0xc0, 0x4e, 0xc0, 0x4e, 0xc0, 0x4e, 0xc0, 0x4e, 0xc0, 0x4e, 0xcb, 0x4e, 0x24, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x24, 0x4e, 0xc0, 0x4e, 0xc8, 0x4e, 0xc8, 0x4e, 0xc8, 0x4e, 0xc8, 0x4e, 0xc8, 0x4e, 0xc8, 0x4e, 0xc8, 0x4e, 0xcb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x34, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x52, 0x00, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x2f, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x53, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x74, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x97, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x4e, 0xaf, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x07, 0x4e, 0xc3, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0b, 0x4e, 0xd7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x43, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x04, 0x4e, 0x14, 0x4e, 0xeb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x18, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xef, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xf0, 0x4e, 0x34, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x28, 0x4e, 0xd7, 0x4e, 0xdf, 0x4e, 0xdf, 0x4e, 0xdf, 0x4e, 0xdf, 0x4e, 0xdf, 0x4e, 0xdf, 0x4e, 0xe3, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x04, 0x4e, 0xcc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xe8, 0x4e, 0x1b, 
-  0x4e, 0x00, 0x4e, 0xb3, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xd8, 0x4e, 0x0b, 
-  0x4e, 0x00, 0x4e, 0x24, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x3f, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x6f, 0x4e, 0x00, 
-  0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x33, 0x4e, 0xcb, 0x4e, 0xdf, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xe0, 0x4e, 0xec, 0x4e, 0x37, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x2c, 0x4e, 0xdf, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xe7, 0x4e, 0xdb, 0x4e, 0x6c, 0x4e, 0x00, 0x4e, 0x00, 
-  0x00, 0x00, 0x4e, 0x00, 0x4e, 0x00, 0x4e, 0x04, 0x4e, 0x13, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x14, 0x4e, 0x04, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x04, 0x4e, 0x17, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x18, 0x4e, 0x0c, 0x4e, 0x00, 0x4e, 0x00, 0x01, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0xb7, 0x4e, 0x0b, 0x00, 0x4e, 0x03, 0x84, 0x00, 0x00, 0x01, 0x4e, 0x10, 0x4e, 0xb0, 0xb7, 0x4e, 0xd4, 0x01, 0x4e, 0xc7, 0x4e, 0x4f, 0x82, 0x00, 0x00, 
+  0x01, 0x4e, 0x10, 0x4e, 0xfc, 0xba, 0x4e, 0xff, 0x00, 0x4e, 0x5b, 0x81, 0x00, 0x00, 0x00, 0x4e, 0xa7, 0xbb, 0x4e, 0xff, 0x03, 0x4e, 0xdb, 0x4e, 0x0c, 0x4e, 0x04, 0x4e, 0xcb, 0xbb, 0x4e, 0xff, 
+  0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x07, 0x4e, 0xcc, 0xbb, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xbb, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 
+  0xcc, 0xbb, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xbb, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xbb, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 
+  0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xa8, 0x4e, 0xff, 0x09, 0x4e, 0xe0, 0x4e, 0xab, 0x4e, 0x88, 0x4e, 0x80, 0x4e, 0x83, 0x4e, 0x93, 0x4e, 0xa0, 0x4e, 0xb4, 0x4e, 0xcb, 0x4e, 0xe4, 0x88, 0x4e, 0xff, 
+  0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xa5, 0x4e, 0xff, 0x02, 0x4e, 0xb7, 0x4e, 0x5c, 0x4e, 0x08, 0x89, 0x00, 0x00, 0x00, 0x4e, 0x97, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 
+  0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xa3, 0x4e, 0xff, 0x02, 0x4e, 0xef, 0x4e, 0x33, 0x4e, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x4e, 0x97, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 
+  0xcc, 0xa2, 0x4e, 0xff, 0x01, 0x4e, 0xc8, 0x47, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x4e, 0x97, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xa1, 0x4e, 0xff, 0x01, 0x4e, 
+  0xeb, 0x4e, 0x0c, 0x8e, 0x00, 0x00, 0x00, 0x4e, 0x97, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xa1, 0x4e, 0xff, 0x00, 0x4e, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x4e, 
+  0x97, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0xa0, 0x4e, 0xff, 0x00, 0x4e, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x4e, 0x97, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 
+  0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x01, 0x4e, 0xf7, 0x4e, 0x33, 0x90, 0x00, 0x00, 0x00, 0x4e, 0x97, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 
+  0x4e, 0xff, 0x01, 0x4e, 0xe8, 0x4e, 0x07, 0x90, 0x00, 0x00, 0x00, 0x4e, 0x90, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0xb0, 0x89, 
+  0x00, 0x00, 0x03, 0x4e, 0x1b, 0x4e, 0x74, 0x4e, 0xac, 0x4e, 0xcf, 0x82, 0x4e, 0xd0, 0x01, 0x4e, 0xcf, 0x4e, 0xf3, 0x87, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 
+  0x4e, 0xff, 0x00, 0x4e, 0x7c, 0x88, 0x00, 0x00, 0x01, 0x4e, 0x4b, 0x4e, 0xf8, 0x8f, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x50, 0x88, 
+  0x00, 0x00, 0x00, 0x4e, 0xeb, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x44, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x20, 0x4e, 0xf3, 0x90, 
+  0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x2f, 0x4e, 0xf4, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 
+  0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3b, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x33, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 
+  0x4e, 0xff, 0x00, 0x4e, 0x38, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x33, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x38, 0x87, 
+  0x00, 0x00, 0x01, 0x4e, 0x33, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x38, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x33, 0x4e, 
+  0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x38, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x33, 0x4e, 0xf8, 0x90, 0x4e, 0xff, 0x03, 0x4e, 
+  0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0xd7, 0x85, 0x4e, 0xc0, 0x01, 0x4e, 0xcb, 0x4e, 0x24, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x24, 0x4e, 0xc0, 0x86, 0x4e, 0xc8, 
+  0x00, 0x4e, 0xcb, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0x34, 0x99, 0x00, 0x00, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 
+  0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x4e, 0x2f, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 
+  0x4e, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x4e, 0x74, 
+  0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x4e, 0x97, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 
+  0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x4e, 0xaf, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 
+  0x4e, 0x3f, 0x97, 0x00, 0x00, 0x01, 0x4e, 0x07, 0x4e, 0xc3, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x97, 0x00, 0x00, 0x01, 
+  0x4e, 0x0b, 0x4e, 0xd7, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0x43, 0x86, 0x4e, 0x04, 0x89, 0x00, 0x00, 0x86, 0x4e, 0x04, 0x01, 
+  0x4e, 0x14, 0x4e, 0xeb, 0x88, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x18, 0x4e, 0x04, 0x4e, 0xcc, 0x97, 0x4e, 0xff, 0x00, 0x4e, 0xef, 0x85, 0x4e, 0xe7, 0x01, 0x4e, 0xf0, 0x4e, 0x34, 0x87, 0x00, 
+  0x00, 0x01, 0x4e, 0x28, 0x4e, 0xd7, 0x85, 0x4e, 0xdf, 0x00, 0x4e, 0xe3, 0x89, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 
+  0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 
+  0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 
+  0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 
+  0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 
+  0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 
+  0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 
+  0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 
+  0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 
+  0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 
+  0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 
+  0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 
+  0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 
+  0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 
+  0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 
+  0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 
+  0x4e, 0x1b, 0x4e, 0x04, 0x4e, 0xcc, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xe8, 0x4e, 0x1b, 0x00, 0x00, 0x4e, 0xb3, 
+  0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x03, 0x4e, 0xd8, 0x4e, 0x0b, 0x00, 0x00, 0x4e, 0x24, 0x9f, 0x4e, 0xff, 0x00, 0x4e, 0x3f, 
+  0x87, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x4e, 0xf7, 0x90, 0x4e, 0xff, 0x00, 0x4e, 0x6f, 0x82, 0x00, 0x00, 0x02, 0x4e, 0x33, 0x4e, 0xcb, 0x4e, 0xdf, 0x9b, 0x4e, 0xe0, 0x01, 0x4e, 0xec, 0x4e, 0x37, 
+  0x87, 0x00, 0x00, 0x01, 0x4e, 0x2c, 0x4e, 0xdf, 0x8e, 0x4e, 0xe7, 0x01, 0x4e, 0xdb, 0x4e, 0x6c, 0x84, 0x00, 0x00, 0x01, 0x4e, 0x04, 0x4e, 0x13, 0x9c, 0x4e, 0x14, 0x00, 0x4e, 0x04, 0x87, 0x00, 
+  0x00, 0x01, 0x4e, 0x04, 0x4e, 0x17, 0x8e, 0x4e, 0x18, 0x00, 0x4e, 0x0c, 0x82, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xb2, 0x3a, 0x00, 0xd3, 0x3a, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xf3, 0x42, 0x0b, 0xd3, 0x3a, 0x0b, 0xf3, 0x3a, 0x03, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 
-  0xb3, 0x42, 0x00, 0xb3, 0x3a, 0x00, 0xd3, 0x3a, 0x10, 0xd3, 0x3a, 0xb0, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xd4, 0xd3, 0x3a, 0xc7, 0xd3, 0x3a, 0x4f, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 
-  0xd3, 0x42, 0x00, 0xb3, 0x42, 0x10, 0xd3, 0x3a, 0xfc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x5b, 0xd3, 0x3a, 0x00, 
-  0xd2, 0x42, 0x00, 0xd3, 0x3a, 0xa7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xdb, 0xd3, 0x3a, 0x0c, 
-  0xf3, 0x42, 0x04, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x07, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xab, 0xd3, 0x3a, 0x88, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x93, 0xd3, 0x3a, 0xa0, 0xd3, 0x3a, 0xb4, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0xe4, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xb7, 0xd3, 0x3a, 0x5c, 0xf2, 0x42, 0x08, 0xf2, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xef, 0xd3, 0x3a, 0x33, 0xf2, 0x3a, 0x03, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0x45, 0x4b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xc8, 0x95, 0x41, 0x03, 0xd3, 0x42, 0x00, 0x20, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xeb, 0xf3, 0x3a, 0x0c, 0xb3, 0x42, 0x00, 0xb3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x1f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x8f, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x90, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xb0, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x32, 0x00, 0xb2, 0x3a, 0x00, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x74, 0xd3, 0x3a, 0xac, 0xd3, 0x3a, 0xcf, 0xd3, 0x3a, 0xd0, 0xd3, 0x3a, 0xd0, 0xd3, 0x3a, 0xd0, 0xd3, 0x3a, 0xcf, 0xd3, 0x3a, 0xf3, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x7c, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x42, 0x4b, 0xd3, 0x3a, 0xf8, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x50, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x08, 0x00, 0xd3, 0x3a, 0xeb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x44, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x20, 0xd3, 0x3a, 0xf3, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x2f, 0xd3, 0x3a, 0xf4, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3b, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xf3, 0x3a, 0x38, 0xf3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xf3, 0x3a, 0x38, 0xf3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xf3, 0x3a, 0x38, 0xf3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xf3, 0x3a, 0x38, 0xf3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf8, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xd7, 0xd3, 0x3a, 0xc0, 0xd3, 0x3a, 0xc0, 0xd3, 0x3a, 0xc0, 0xd3, 0x3a, 0xc0, 0xd3, 0x3a, 0xc0, 0xd3, 0x3a, 0xc0, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0x24, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x24, 0xd3, 0x3a, 0xc0, 0xd3, 0x3a, 0xc8, 0xd3, 0x3a, 0xc8, 0xd3, 0x3a, 0xc8, 0xd3, 0x3a, 0xc8, 0xd3, 0x3a, 0xc8, 0xd3, 0x3a, 0xc8, 0xd3, 0x3a, 0xc8, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x42, 0x34, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xb3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xae, 0x33, 0x00, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x2f, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x53, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x74, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x97, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x2a, 0x00, 0xd3, 0x3a, 0xaf, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x07, 0xd3, 0x3a, 0xc3, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x0b, 0xd3, 0x3a, 0xd7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x43, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0xeb, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xef, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xf0, 0xd3, 0x3a, 0x34, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x28, 0xd3, 0x3a, 0xd7, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xe3, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xb3, 0x42, 0x04, 0xd3, 0x3a, 0xcc, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 
-  0xf3, 0x42, 0x00, 0xd3, 0x3a, 0xb3, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xd8, 0xd3, 0x3a, 0x0b, 
-  0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x24, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x3f, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0xff, 0xd3, 0x3a, 0x6f, 0xd3, 0x3a, 0x00, 
-  0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x00, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xec, 0xd3, 0x3a, 0x37, 0xd3, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x2c, 0xd3, 0x3a, 0xdf, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xe7, 0xd3, 0x3a, 0xdb, 0xd3, 0x3a, 0x6c, 0xf2, 0x3a, 0x00, 0xf1, 0x42, 0x00, 
-  0x00, 0x00, 0x00, 0xd3, 0x3a, 0x00, 0xd2, 0x3a, 0x00, 0xf3, 0x3a, 0x04, 0xd3, 0x3a, 0x13, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xd3, 0x3a, 0x14, 0xf3, 0x42, 0x04, 0xf3, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x42, 0x04, 0xd3, 0x3a, 0x17, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x0c, 0xd3, 0x3a, 0x00, 0xf1, 0x42, 0x00, 0x0c, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x0b, 0xb5, 0xf3, 0x42, 0x0b, 0x01, 0xd3, 0x3a, 0x0b, 0xf3, 0x3a, 0x03, 0x84, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x10, 0xd3, 
+  0x3a, 0xb0, 0xb7, 0xd3, 0x3a, 0xd4, 0x01, 0xd3, 0x3a, 0xc7, 0xd3, 0x3a, 0x4f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xb3, 0x42, 0x10, 0xd3, 0x3a, 0xfc, 0xba, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x5b, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xa7, 0xbb, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xdb, 0xd3, 0x3a, 0x0c, 0xf3, 0x42, 0x04, 0xd3, 0x3a, 0xcb, 0xbb, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 
+  0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x07, 0xd3, 0x3a, 0xcc, 0xbb, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xbb, 0xd3, 0x3a, 0xff, 0x03, 
+  0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xbb, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xbb, 0xd3, 0x3a, 
+  0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xbb, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xa8, 
+  0xd3, 0x3a, 0xff, 0x09, 0xd3, 0x3a, 0xe0, 0xd3, 0x3a, 0xab, 0xd3, 0x3a, 0x88, 0xd3, 0x3a, 0x80, 0xd3, 0x3a, 0x83, 0xd3, 0x3a, 0x93, 0xd3, 0x3a, 0xa0, 0xd3, 0x3a, 0xb4, 0xd3, 0x3a, 0xcb, 0xd3, 
+  0x3a, 0xe4, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xa5, 0xd3, 0x3a, 0xff, 0x02, 0xd3, 0x3a, 0xb7, 0xd3, 0x3a, 0x5c, 0xf2, 0x42, 
+  0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xa3, 0xd3, 0x3a, 0xff, 0x02, 0xd3, 
+  0x3a, 0xef, 0xd3, 0x3a, 0x33, 0xf2, 0x3a, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 
+  0xcc, 0xa2, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0xc8, 0x95, 0x41, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 
+  0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xa1, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0xeb, 0xf3, 0x3a, 0x0c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 
+  0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xa1, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 
+  0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0xa0, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 
+  0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0xf7, 0xd3, 0x3a, 0x33, 0x90, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x87, 0xd3, 
+  0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x01, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0xd3, 
+  0x3a, 0x90, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0xb0, 0x89, 0x00, 0x00, 0x00, 0x03, 
+  0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x74, 0xd3, 0x3a, 0xac, 0xd3, 0x3a, 0xcf, 0x82, 0xd3, 0x3a, 0xd0, 0x01, 0xd3, 0x3a, 0xcf, 0xd3, 0x3a, 0xf3, 0x87, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 
+  0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x7c, 0x88, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x42, 0x4b, 0xd3, 0x3a, 0xf8, 0x8f, 0xd3, 0x3a, 0xff, 0x03, 
+  0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xeb, 0x90, 0xd3, 0x3a, 0xff, 
+  0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x44, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x20, 0xd3, 0x3a, 0xf3, 
+  0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 
+  0x2f, 0xd3, 0x3a, 0xf4, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3b, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xf3, 0x3a, 
+  0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 
+  0xff, 0x00, 0xf3, 0x3a, 0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 
+  0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xf3, 0x3a, 0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 
+  0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xf3, 0x3a, 0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xf8, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 
+  0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0xd7, 0x85, 0xd3, 0x3a, 0xc0, 0x01, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0x24, 0x87, 0x00, 0x00, 0x00, 
+  0x01, 0xd3, 0x3a, 0x24, 0xd3, 0x3a, 0xc0, 0x86, 0xd3, 0x3a, 0xc8, 0x00, 0xd3, 0x3a, 0xcb, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 
+  0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x42, 0x34, 0x99, 0x00, 0x00, 0x00, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x97, 0xd3, 0x3a, 
+  0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x2f, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x97, 0xd3, 
+  0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x53, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x97, 
+  0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x74, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 
+  0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0x97, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 
+  0xcc, 0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xaf, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 
+  0x3a, 0xcc, 0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x97, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x07, 0xd3, 0x3a, 0xc3, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 
+  0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x97, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x0b, 0xd3, 0x3a, 0xd7, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 
+  0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x43, 0x86, 0xd3, 0x3a, 0x04, 0x89, 0x00, 0x00, 0x00, 0x86, 0xd3, 0x3a, 0x04, 0x01, 0xd3, 
+  0x3a, 0x14, 0xd3, 0x3a, 0xeb, 0x88, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x18, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x97, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0xef, 0x85, 0xd3, 
+  0x3a, 0xe7, 0x01, 0xd3, 0x3a, 0xf0, 0xd3, 0x3a, 0x34, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x28, 0xd3, 0x3a, 0xd7, 0x85, 0xd3, 0x3a, 0xdf, 0x00, 0xd3, 0x3a, 0xe3, 0x89, 0xd3, 0x3a, 0xff, 
+  0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 
+  0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 
+  0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 
+  0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 
+  0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 
+  0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 
+  0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 
+  0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 
+  0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 
+  0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 
+  0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 
+  0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 
+  0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 
+  0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 
+  0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 
+  0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 
+  0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 
+  0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 
+  0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xd3, 0x3a, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0xb3, 0x42, 0x04, 0xd3, 0x3a, 0xcc, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 
+  0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xe8, 0xd3, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0xd3, 0x3a, 0xb3, 0x9f, 0xd3, 0x3a, 
+  0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x03, 0xd3, 0x3a, 0xd8, 0xd3, 0x3a, 0x0b, 0x00, 0x00, 0x00, 0xd3, 0x3a, 
+  0x24, 0x9f, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x30, 0xd3, 0x3a, 0xf7, 0x90, 0xd3, 0x3a, 0xff, 0x00, 0xd3, 0x3a, 0x6f, 0x82, 0x00, 0x00, 0x00, 
+  0x02, 0xd3, 0x3a, 0x33, 0xd3, 0x3a, 0xcb, 0xd3, 0x3a, 0xdf, 0x9b, 0xd3, 0x3a, 0xe0, 0x01, 0xd3, 0x3a, 0xec, 0xd3, 0x3a, 0x37, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x3a, 0x2c, 0xd3, 0x3a, 0xdf, 
+  0x8e, 0xd3, 0x3a, 0xe7, 0x01, 0xd3, 0x3a, 0xdb, 0xd3, 0x3a, 0x6c, 0x84, 0x00, 0x00, 0x00, 0x01, 0xf3, 0x3a, 0x04, 0xd3, 0x3a, 0x13, 0x9c, 0xd3, 0x3a, 0x14, 0x00, 0xf3, 0x42, 0x04, 0x87, 0x00, 
+  0x00, 0x00, 0x01, 0xf3, 0x42, 0x04, 0xd3, 0x3a, 0x17, 0x8e, 0xd3, 0x3a, 0x18, 0x00, 0xd3, 0x3a, 0x0c, 0x82, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xb2, 0x00, 0x3a, 0xd3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x42, 0xf3, 0x0b, 0x3a, 0xd3, 0x0b, 0x3a, 0xf3, 0x03, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 
-  0x42, 0xb3, 0x00, 0x3a, 0xb3, 0x00, 0x3a, 0xd3, 0x10, 0x3a, 0xd3, 0xb0, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xd4, 0x3a, 0xd3, 0xc7, 0x3a, 0xd3, 0x4f, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 
-  0x42, 0xd3, 0x00, 0x42, 0xb3, 0x10, 0x3a, 0xd3, 0xfc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x5b, 0x3a, 0xd3, 0x00, 
-  0x42, 0xd2, 0x00, 0x3a, 0xd3, 0xa7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xdb, 0x3a, 0xd3, 0x0c, 
-  0x42, 0xf3, 0x04, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x07, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xab, 0x3a, 0xd3, 0x88, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x93, 0x3a, 0xd3, 0xa0, 0x3a, 0xd3, 0xb4, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0xe4, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xb7, 0x3a, 0xd3, 0x5c, 0x42, 0xf2, 0x08, 0x3a, 0xf2, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xef, 0x3a, 0xd3, 0x33, 0x3a, 0xf2, 0x03, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x4b, 0x45, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xc8, 0x41, 0x95, 0x03, 0x42, 0xd3, 0x00, 0x19, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xeb, 0x3a, 0xf3, 0x0c, 0x42, 0xb3, 0x00, 0x3a, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x1f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x8f, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xf3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x90, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xb0, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x31, 0x00, 0x3a, 0xb2, 0x00, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x74, 0x3a, 0xd3, 0xac, 0x3a, 0xd3, 0xcf, 0x3a, 0xd3, 0xd0, 0x3a, 0xd3, 0xd0, 0x3a, 0xd3, 0xd0, 0x3a, 0xd3, 0xcf, 0x3a, 0xd3, 0xf3, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x7c, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x42, 0xd3, 0x4b, 0x3a, 0xd3, 0xf8, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x50, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x00, 0x3a, 0xd3, 0xeb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x44, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x20, 0x3a, 0xd3, 0xf3, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x2f, 0x3a, 0xd3, 0xf4, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3b, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xf3, 0x38, 0x3a, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xf3, 0x38, 0x3a, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xf3, 0x38, 0x3a, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xf3, 0x38, 0x3a, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf8, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xd7, 0x3a, 0xd3, 0xc0, 0x3a, 0xd3, 0xc0, 0x3a, 0xd3, 0xc0, 0x3a, 0xd3, 0xc0, 0x3a, 0xd3, 0xc0, 0x3a, 0xd3, 0xc0, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0x24, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x24, 0x3a, 0xd3, 0xc0, 0x3a, 0xd3, 0xc8, 0x3a, 0xd3, 0xc8, 0x3a, 0xd3, 0xc8, 0x3a, 0xd3, 0xc8, 0x3a, 0xd3, 0xc8, 0x3a, 0xd3, 0xc8, 0x3a, 0xd3, 0xc8, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x42, 0xd3, 0x34, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xb3, 0x00, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x33, 0xae, 0x00, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x2f, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x53, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x74, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x97, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x72, 0x00, 0x3a, 0xd3, 0xaf, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x07, 0x3a, 0xd3, 0xc3, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x0b, 0x3a, 0xd3, 0xd7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x43, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0xeb, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xef, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xf0, 0x3a, 0xd3, 0x34, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x28, 0x3a, 0xd3, 0xd7, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xe3, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x42, 0xb3, 0x04, 0x3a, 0xd3, 0xcc, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 
-  0x42, 0xf3, 0x00, 0x3a, 0xd3, 0xb3, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xd8, 0x3a, 0xd3, 0x0b, 
-  0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x24, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x3f, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0xff, 0x3a, 0xd3, 0x6f, 0x3a, 0xd3, 0x00, 
-  0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xec, 0x3a, 0xd3, 0x37, 0x3a, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x2c, 0x3a, 0xd3, 0xdf, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xe7, 0x3a, 0xd3, 0xdb, 0x3a, 0xd3, 0x6c, 0x3a, 0xf2, 0x00, 0x42, 0xf1, 0x00, 
-  0x00, 0x00, 0x00, 0x3a, 0xd3, 0x00, 0x3a, 0xd2, 0x00, 0x3a, 0xf3, 0x04, 0x3a, 0xd3, 0x13, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x3a, 0xd3, 0x14, 0x42, 0xf3, 0x04, 0x42, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xf3, 0x04, 0x3a, 0xd3, 0x17, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x0c, 0x3a, 0xd3, 0x00, 0x42, 0xf1, 0x00, 0x00, 0x0c, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x0b, 0xb5, 0x42, 0xf3, 0x0b, 0x01, 0x3a, 0xd3, 0x0b, 0x3a, 0xf3, 0x03, 0x84, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x10, 0x3a, 
+  0xd3, 0xb0, 0xb7, 0x3a, 0xd3, 0xd4, 0x01, 0x3a, 0xd3, 0xc7, 0x3a, 0xd3, 0x4f, 0x82, 0x00, 0x00, 0x00, 0x01, 0x42, 0xb3, 0x10, 0x3a, 0xd3, 0xfc, 0xba, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x5b, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0xa7, 0xbb, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xdb, 0x3a, 0xd3, 0x0c, 0x42, 0xf3, 0x04, 0x3a, 0xd3, 0xcb, 0xbb, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 
+  0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x07, 0x3a, 0xd3, 0xcc, 0xbb, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xbb, 0x3a, 0xd3, 0xff, 0x03, 
+  0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xbb, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xbb, 0x3a, 0xd3, 
+  0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xbb, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xa8, 
+  0x3a, 0xd3, 0xff, 0x09, 0x3a, 0xd3, 0xe0, 0x3a, 0xd3, 0xab, 0x3a, 0xd3, 0x88, 0x3a, 0xd3, 0x80, 0x3a, 0xd3, 0x83, 0x3a, 0xd3, 0x93, 0x3a, 0xd3, 0xa0, 0x3a, 0xd3, 0xb4, 0x3a, 0xd3, 0xcb, 0x3a, 
+  0xd3, 0xe4, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xa5, 0x3a, 0xd3, 0xff, 0x02, 0x3a, 0xd3, 0xb7, 0x3a, 0xd3, 0x5c, 0x42, 0xf2, 
+  0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xa3, 0x3a, 0xd3, 0xff, 0x02, 0x3a, 
+  0xd3, 0xef, 0x3a, 0xd3, 0x33, 0x3a, 0xf2, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 
+  0xcc, 0xa2, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0xc8, 0x41, 0x95, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 
+  0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xa1, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0xeb, 0x3a, 0xf3, 0x0c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 
+  0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xa1, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 
+  0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0xa0, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 
+  0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0xf7, 0x3a, 0xd3, 0x33, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x87, 0x3a, 
+  0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x01, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3a, 
+  0xd3, 0x90, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0xb0, 0x89, 0x00, 0x00, 0x00, 0x03, 
+  0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x74, 0x3a, 0xd3, 0xac, 0x3a, 0xd3, 0xcf, 0x82, 0x3a, 0xd3, 0xd0, 0x01, 0x3a, 0xd3, 0xcf, 0x3a, 0xd3, 0xf3, 0x87, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 
+  0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x7c, 0x88, 0x00, 0x00, 0x00, 0x01, 0x42, 0xd3, 0x4b, 0x3a, 0xd3, 0xf8, 0x8f, 0x3a, 0xd3, 0xff, 0x03, 
+  0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0xeb, 0x90, 0x3a, 0xd3, 0xff, 
+  0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x44, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x20, 0x3a, 0xd3, 0xf3, 
+  0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 
+  0x2f, 0x3a, 0xd3, 0xf4, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3b, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xf3, 
+  0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 
+  0xff, 0x00, 0x3a, 0xf3, 0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 
+  0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xf3, 0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 
+  0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xf3, 0x38, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xf8, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 
+  0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x97, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0xd7, 0x85, 0x3a, 0xd3, 0xc0, 0x01, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0x24, 0x87, 0x00, 0x00, 0x00, 
+  0x01, 0x3a, 0xd3, 0x24, 0x3a, 0xd3, 0xc0, 0x86, 0x3a, 0xd3, 0xc8, 0x00, 0x3a, 0xd3, 0xcb, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 
+  0x97, 0x3a, 0xd3, 0xff, 0x00, 0x42, 0xd3, 0x34, 0x99, 0x00, 0x00, 0x00, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x97, 0x3a, 0xd3, 
+  0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x2f, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x97, 0x3a, 
+  0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x53, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x97, 
+  0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x74, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 
+  0x97, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0x97, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 
+  0xcc, 0x97, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0xaf, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 
+  0xd3, 0xcc, 0x97, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x97, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x07, 0x3a, 0xd3, 0xc3, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 
+  0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x97, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x97, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x0b, 0x3a, 0xd3, 0xd7, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 
+  0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x97, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x43, 0x86, 0x3a, 0xd3, 0x04, 0x89, 0x00, 0x00, 0x00, 0x86, 0x3a, 0xd3, 0x04, 0x01, 0x3a, 
+  0xd3, 0x14, 0x3a, 0xd3, 0xeb, 0x88, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x18, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x97, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0xef, 0x85, 0x3a, 
+  0xd3, 0xe7, 0x01, 0x3a, 0xd3, 0xf0, 0x3a, 0xd3, 0x34, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x28, 0x3a, 0xd3, 0xd7, 0x85, 0x3a, 0xd3, 0xdf, 0x00, 0x3a, 0xd3, 0xe3, 0x89, 0x3a, 0xd3, 0xff, 
+  0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 
+  0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 
+  0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 
+  0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 
+  0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 
+  0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 
+  0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 
+  0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 
+  0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 
+  0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 
+  0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 
+  0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 
+  0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 
+  0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 
+  0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 
+  0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 
+  0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 
+  0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 
+  0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x3a, 0xd3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 
+  0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x42, 0xb3, 0x04, 0x3a, 0xd3, 0xcc, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 
+  0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xe8, 0x3a, 0xd3, 0x1b, 0x00, 0x00, 0x00, 0x3a, 0xd3, 0xb3, 0x9f, 0x3a, 0xd3, 
+  0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x03, 0x3a, 0xd3, 0xd8, 0x3a, 0xd3, 0x0b, 0x00, 0x00, 0x00, 0x3a, 0xd3, 
+  0x24, 0x9f, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x30, 0x3a, 0xd3, 0xf7, 0x90, 0x3a, 0xd3, 0xff, 0x00, 0x3a, 0xd3, 0x6f, 0x82, 0x00, 0x00, 0x00, 
+  0x02, 0x3a, 0xd3, 0x33, 0x3a, 0xd3, 0xcb, 0x3a, 0xd3, 0xdf, 0x9b, 0x3a, 0xd3, 0xe0, 0x01, 0x3a, 0xd3, 0xec, 0x3a, 0xd3, 0x37, 0x87, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xd3, 0x2c, 0x3a, 0xd3, 0xdf, 
+  0x8e, 0x3a, 0xd3, 0xe7, 0x01, 0x3a, 0xd3, 0xdb, 0x3a, 0xd3, 0x6c, 0x84, 0x00, 0x00, 0x00, 0x01, 0x3a, 0xf3, 0x04, 0x3a, 0xd3, 0x13, 0x9c, 0x3a, 0xd3, 0x14, 0x00, 0x42, 0xf3, 0x04, 0x87, 0x00, 
+  0x00, 0x00, 0x01, 0x42, 0xf3, 0x04, 0x3a, 0xd3, 0x17, 0x8e, 0x3a, 0xd3, 0x18, 0x00, 0x3a, 0xd3, 0x0c, 0x82, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x9b, 0x59, 0x37, 0x00, 0x99, 0x59, 0x39, 0x00, 0x93, 0x53, 0x37, 0x00, 0x96, 0x58, 0x3a, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x97, 0x5c, 0x3d, 0x0b, 0x96, 0x58, 0x3a, 0x0b, 0x98, 0x5d, 0x3c, 0x03, 0x95, 0x59, 0x3b, 0x00, 0x96, 0x59, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x95, 0x55, 0x40, 0x00, 0x99, 0x55, 0x3c, 0x00, 0x9b, 0x59, 0x37, 0x10, 0x97, 0x59, 0x3b, 0xb0, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xd4, 0x97, 0x59, 0x3b, 0xc7, 0x96, 0x59, 0x3a, 0x4f, 0x96, 0x58, 0x3a, 0x00, 0x97, 0x58, 0x3a, 0x00, 
-  0x97, 0x57, 0x3e, 0x00, 0x96, 0x54, 0x42, 0x10, 0x97, 0x59, 0x3b, 0xfc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x58, 0x3a, 0x5b, 0x97, 0x59, 0x3b, 0x00, 
-  0x93, 0x5a, 0x3e, 0x00, 0x97, 0x59, 0x3b, 0xa7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xdb, 0x98, 0x59, 0x39, 0x0c, 
-  0x99, 0x5d, 0x40, 0x04, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x07, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe0, 0x96, 0x58, 0x3b, 0xab, 0x98, 0x5a, 0x3a, 0x88, 0x97, 0x59, 0x3a, 0x80, 0x96, 0x5a, 0x3c, 0x83, 0x98, 0x59, 0x3b, 0x93, 0x98, 0x5a, 0x3b, 0xa0, 0x97, 0x58, 0x3b, 0xb4, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x59, 0x3c, 0xe4, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xb7, 0x97, 0x59, 0x3c, 0x5c, 0x94, 0x5c, 0x3d, 0x08, 0x93, 0x5b, 0x3c, 0x00, 0x96, 0x58, 0x3b, 0x00, 0x98, 0x5a, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x96, 0x5a, 0x3c, 0x00, 0x98, 0x59, 0x3b, 0x00, 0x98, 0x5a, 0x3b, 0x00, 0x97, 0x58, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3c, 0x00, 0x97, 0x58, 0x3b, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x59, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xef, 0x98, 0x59, 0x3c, 0x33, 0x94, 0x5b, 0x39, 0x03, 0x97, 0x59, 0x3b, 0x00, 0x96, 0x5a, 0x3c, 0x00, 0x2c, 0x6a, 0x47, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xc8, 0xa5, 0x30, 0x42, 0x03, 0x99, 0x57, 0x3d, 0x00, 0x00, 0x25, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xeb, 0x9a, 0x5c, 0x39, 0x0c, 0x98, 0x56, 0x3d, 0x00, 0x99, 0x55, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x99, 0x59, 0x3b, 0x1f, 0x99, 0x5a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x8f, 0x98, 0x58, 0x3b, 0x00, 0x98, 0x59, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0x33, 0x98, 0x57, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x57, 0x37, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x5d, 0x3b, 0x00, 0x97, 0x5a, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3a, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x5a, 0x3b, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xb0, 0x97, 0x59, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x45, 0x33, 0x00, 0x91, 0x53, 0x38, 0x00, 0x97, 0x5a, 0x3b, 0x1b, 0x97, 0x5a, 0x3b, 0x74, 0x97, 0x59, 0x3b, 0xac, 0x97, 0x59, 0x3b, 0xcf, 0x97, 0x59, 0x3a, 0xd0, 0x97, 0x59, 0x3a, 0xd0, 0x97, 0x59, 0x3a, 0xd0, 0x97, 0x59, 0x3b, 0xcf, 0x97, 0x59, 0x3b, 0xf3, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x7c, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x58, 0x3c, 0x00, 0x97, 0x58, 0x3d, 0x4b, 0x97, 0x59, 0x3b, 0xf8, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0x50, 0x97, 0x59, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x06, 0x00, 0x97, 0x59, 0x3b, 0xeb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x96, 0x5a, 0x3a, 0x44, 0x96, 0x5a, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x59, 0x3a, 0x20, 0x97, 0x59, 0x3b, 0xf3, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x59, 0x3b, 0x2f, 0x97, 0x59, 0x3b, 0xf4, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x5a, 0x3b, 0x3b, 0x98, 0x5a, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x5b, 0x3c, 0x38, 0x97, 0x5b, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x5c, 0x3c, 0x38, 0x97, 0x5b, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x5c, 0x3c, 0x38, 0x97, 0x5b, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x5c, 0x3c, 0x38, 0x97, 0x5b, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf8, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x96, 0x58, 0x3b, 0xd7, 0x97, 0x59, 0x3b, 0xc0, 0x97, 0x59, 0x3b, 0xc0, 0x97, 0x59, 0x3b, 0xc0, 0x97, 0x59, 0x3b, 0xc0, 0x97, 0x59, 0x3b, 0xc0, 0x97, 0x59, 0x3b, 0xc0, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x57, 0x3a, 0x24, 0x97, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x24, 0x98, 0x59, 0x3c, 0xc0, 0x98, 0x59, 0x3c, 0xc8, 0x98, 0x59, 0x3c, 0xc8, 0x98, 0x59, 0x3c, 0xc8, 0x98, 0x59, 0x3c, 0xc8, 0x98, 0x59, 0x3c, 0xc8, 0x98, 0x59, 0x3c, 0xc8, 0x98, 0x59, 0x3c, 0xc8, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3d, 0x34, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x00, 0x97, 0x56, 0x3a, 0x00, 0x97, 0x57, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x98, 0x59, 0x3c, 0x00, 0x74, 0x73, 0x31, 0x00, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x58, 0x3a, 0x00, 0x97, 0x57, 0x3a, 0x2f, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x59, 0x3b, 0x00, 0x96, 0x59, 0x3b, 0x53, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x58, 0x3b, 0x00, 0x97, 0x58, 0x3b, 0x74, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x5a, 0x3b, 0x00, 0x97, 0x59, 0x3b, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x4b, 0x2a, 0x00, 0x97, 0x59, 0x3b, 0xaf, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x07, 0x97, 0x59, 0x3b, 0xc3, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0x0b, 0x97, 0x59, 0x3b, 0xd7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x59, 0x3b, 0x43, 0x98, 0x59, 0x3c, 0x04, 0x98, 0x59, 0x3c, 0x04, 0x98, 0x59, 0x3c, 0x04, 0x98, 0x59, 0x3c, 0x04, 0x98, 0x59, 0x3c, 0x04, 0x98, 0x59, 0x3c, 0x04, 0x98, 0x59, 0x3c, 0x04, 0x98, 0x58, 0x3b, 0x00, 0x98, 0x58, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x59, 0x3c, 0x00, 0x96, 0x5a, 0x3b, 0x04, 0x96, 0x5a, 0x3b, 0x04, 0x96, 0x5a, 0x3b, 0x04, 0x96, 0x5a, 0x3b, 0x04, 0x96, 0x5a, 0x3b, 0x04, 0x96, 0x5a, 0x3b, 0x04, 0x96, 0x5a, 0x3b, 0x04, 0x96, 0x58, 0x3b, 0x14, 0x97, 0x59, 0x3b, 0xeb, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xef, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xf0, 0x98, 0x58, 0x3a, 0x34, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x28, 0x97, 0x59, 0x3b, 0xd7, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xe3, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x59, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
-  0x99, 0x55, 0x3d, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3b, 0x1b, 
-  0x96, 0x5b, 0x40, 0x00, 0x97, 0x59, 0x3b, 0xb3, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xd8, 0x99, 0x59, 0x3c, 0x0b, 
-  0x97, 0x58, 0x3a, 0x00, 0x97, 0x58, 0x39, 0x24, 0x97, 0x5a, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x98, 0x58, 0x3a, 0x3f, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x97, 0x59, 0x3b, 0xff, 0x96, 0x59, 0x3b, 0x6f, 0x95, 0x5a, 0x3c, 0x00, 
-  0x97, 0x58, 0x39, 0x00, 0x96, 0x57, 0x3a, 0x00, 0x96, 0x58, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xe0, 0x97, 0x59, 0x3b, 0xec, 0x98, 0x58, 0x3a, 0x37, 0x98, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x5a, 0x3b, 0x2c, 0x97, 0x59, 0x3b, 0xdf, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xe7, 0x97, 0x59, 0x3b, 0xdb, 0x98, 0x5a, 0x3a, 0x6c, 0x8f, 0x5c, 0x3c, 0x00, 0x87, 0x5d, 0x3e, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x96, 0x58, 0x3b, 0x00, 0x94, 0x59, 0x3c, 0x00, 0x99, 0x5d, 0x3c, 0x04, 0x96, 0x59, 0x3b, 0x13, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x97, 0x59, 0x3c, 0x14, 0x95, 0x5b, 0x3d, 0x04, 0x95, 0x5b, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x5c, 0x3d, 0x04, 0x97, 0x59, 0x3a, 0x17, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x97, 0x59, 0x3a, 0x18, 0x99, 0x58, 0x3b, 0x0c, 0x97, 0x59, 0x3b, 0x00, 0x89, 0x5e, 0x3d, 0x00, 0x5f, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x58, 0x3a, 0x0b, 0xb5, 0x97, 0x5c, 0x3d, 0x0b, 0x01, 0x96, 0x58, 0x3a, 0x0b, 0x98, 0x5d, 0x3c, 0x03, 0x84, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x9b, 0x59, 0x37, 0x10, 0x97, 0x59, 0x3b, 0xb0, 0xb7, 0x97, 0x59, 0x3b, 0xd4, 0x01, 0x97, 0x59, 0x3b, 0xc7, 0x96, 0x59, 0x3a, 0x4f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96, 0x54, 
+  0x42, 0x10, 0x97, 0x59, 0x3b, 0xfc, 0xba, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x58, 0x3a, 0x5b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0xa7, 0xbb, 0x97, 0x59, 0x3b, 0xff, 0x03, 
+  0x97, 0x59, 0x3b, 0xdb, 0x98, 0x59, 0x39, 0x0c, 0x99, 0x5d, 0x40, 0x04, 0x97, 0x59, 0x3b, 0xcb, 0xbb, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3b, 0x1b, 0x99, 0x57, 
+  0x3b, 0x07, 0x97, 0x59, 0x3b, 0xcc, 0xbb, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xbb, 0x97, 0x59, 0x3b, 
+  0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xbb, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 
+  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xbb, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xbb, 0x97, 
+  0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xa8, 0x97, 0x59, 0x3b, 0xff, 0x09, 0x97, 0x59, 0x3b, 0xe0, 0x96, 0x58, 
+  0x3b, 0xab, 0x98, 0x5a, 0x3a, 0x88, 0x97, 0x59, 0x3a, 0x80, 0x96, 0x5a, 0x3c, 0x83, 0x98, 0x59, 0x3b, 0x93, 0x98, 0x5a, 0x3b, 0xa0, 0x97, 0x58, 0x3b, 0xb4, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x59, 
+  0x3c, 0xe4, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xa5, 0x97, 0x59, 0x3b, 0xff, 0x02, 0x97, 0x59, 
+  0x3b, 0xb7, 0x97, 0x59, 0x3c, 0x5c, 0x94, 0x5c, 0x3d, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x58, 0x3b, 0x97, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x59, 
+  0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xa3, 0x97, 0x59, 0x3b, 0xff, 0x02, 0x97, 0x59, 0x3b, 0xef, 0x98, 0x59, 0x3c, 0x33, 0x94, 0x5b, 0x39, 0x03, 0x8b, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xa2, 0x97, 0x59, 0x3b, 
+  0xff, 0x01, 0x97, 0x59, 0x3b, 0xc8, 0xa5, 0x30, 0x42, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 
+  0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xa1, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0xeb, 0x9a, 0x5c, 0x39, 0x0c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 
+  0x3a, 0x97, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0xa1, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x99, 0x59, 
+  0x3b, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 
+  0x3b, 0xcc, 0xa0, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3a, 0x97, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 
+  0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x01, 0x97, 0x59, 0x3b, 0xf7, 0x97, 0x59, 0x3b, 0x33, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x59, 0x3a, 0x97, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x01, 
+  0x97, 0x59, 0x3b, 0xe8, 0x97, 0x57, 0x37, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x5a, 0x3b, 0x90, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3b, 0x1b, 
+  0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 0xb0, 0x89, 0x00, 0x00, 0x00, 0x00, 0x03, 0x97, 0x5a, 0x3b, 0x1b, 0x97, 0x5a, 0x3b, 0x74, 
+  0x97, 0x59, 0x3b, 0xac, 0x97, 0x59, 0x3b, 0xcf, 0x82, 0x97, 0x59, 0x3a, 0xd0, 0x01, 0x97, 0x59, 0x3b, 0xcf, 0x97, 0x59, 0x3b, 0xf3, 0x87, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 
+  0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x7c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x58, 0x3d, 0x4b, 
+  0x97, 0x59, 0x3b, 0xf8, 0x8f, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 
+  0x97, 0x59, 0x3b, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0xeb, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 
+  0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x96, 0x5a, 0x3a, 0x44, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96, 0x59, 0x3a, 0x20, 0x97, 0x59, 0x3b, 0xf3, 0x90, 0x97, 0x59, 0x3b, 
+  0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x98, 0x59, 0x3b, 0x2f, 0x97, 0x59, 0x3b, 0xf4, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 
+  0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x5a, 0x3b, 0x3b, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 
+  0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x5b, 0x3c, 0x38, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 
+  0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 
+  0xff, 0x00, 0x97, 0x5c, 0x3c, 0x38, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 
+  0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x5c, 0x3c, 0x38, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 
+  0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x5c, 
+  0x3c, 0x38, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0x59, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xf8, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 
+  0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x96, 0x58, 0x3b, 0xd7, 0x85, 0x97, 0x59, 0x3b, 0xc0, 0x01, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x57, 0x3a, 0x24, 0x87, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x24, 0x98, 0x59, 0x3c, 0xc0, 0x86, 0x98, 0x59, 0x3c, 0xc8, 0x00, 0x97, 0x59, 0x3b, 0xcb, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 
+  0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3d, 0x34, 0x99, 0x00, 0x00, 0x00, 0x00, 0x88, 0x97, 0x59, 0x3b, 0xff, 
+  0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3c, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x97, 0x57, 0x3a, 0x2f, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 
+  0x00, 0x97, 0x59, 0x3c, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x59, 0x3b, 0x53, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 
+  0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3c, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x58, 0x3b, 0x74, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 
+  0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3c, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 
+  0x59, 0x3b, 0x97, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 
+  0x59, 0x3c, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0xaf, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 
+  0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x07, 0x97, 0x59, 0x3b, 0xc3, 0x88, 0x97, 0x59, 0x3b, 0xff, 
+  0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3c, 0x3f, 0x97, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x97, 0x59, 0x3b, 0x0b, 0x97, 0x59, 0x3b, 0xd7, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 
+  0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x59, 0x3b, 0x43, 0x86, 0x98, 0x59, 0x3c, 0x04, 0x89, 0x00, 0x00, 0x00, 0x00, 0x86, 0x96, 0x5a, 0x3b, 0x04, 0x01, 0x96, 0x58, 0x3b, 0x14, 0x97, 0x59, 0x3b, 
+  0xeb, 0x88, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x98, 0x5a, 0x3b, 0x18, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x97, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x97, 0x59, 0x3b, 
+  0xef, 0x85, 0x97, 0x59, 0x3b, 0xe7, 0x01, 0x97, 0x59, 0x3b, 0xf0, 0x98, 0x58, 0x3a, 0x34, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x28, 0x97, 0x59, 0x3b, 0xd7, 0x85, 0x97, 0x59, 
+  0x3b, 0xdf, 0x00, 0x97, 0x59, 0x3b, 0xe3, 0x89, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 
+  0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 
+  0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 
+  0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 
+  0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 
+  0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 
+  0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3a, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 
+  0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 
+  0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x59, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 
+  0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 
+  0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 
+  0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 
+  0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 
+  0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 
+  0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 
+  0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3c, 0x1b, 0x99, 0x57, 0x3b, 
+  0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 
+  0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x59, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 
+  0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 
+  0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 
+  0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 
+  0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 
+  0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 
+  0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 0x57, 0x3b, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 
+  0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x96, 0x5a, 0x3b, 0x1b, 0x99, 
+  0x55, 0x3d, 0x04, 0x97, 0x59, 0x3b, 0xcc, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 
+  0x97, 0x59, 0x3b, 0xff, 0x03, 0x97, 0x59, 0x3b, 0xe8, 0x97, 0x58, 0x3b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x3b, 0xb3, 0x9f, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 0x97, 0x59, 0x3b, 0xff, 0x04, 0x97, 0x59, 0x3b, 0xd8, 0x99, 0x59, 0x3c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x97, 
+  0x58, 0x39, 0x24, 0x97, 0x5a, 0x3b, 0xff, 0x9e, 0x97, 0x59, 0x3b, 0xff, 0x00, 0x98, 0x58, 0x3a, 0x3f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x30, 0x97, 0x59, 0x3b, 0xf7, 0x90, 
+  0x97, 0x59, 0x3b, 0xff, 0x00, 0x96, 0x59, 0x3b, 0x6f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x96, 0x58, 0x3b, 0x33, 0x97, 0x59, 0x3b, 0xcb, 0x97, 0x59, 0x3b, 0xdf, 0x9b, 0x97, 0x59, 0x3b, 0xe0, 
+  0x01, 0x97, 0x59, 0x3b, 0xec, 0x98, 0x58, 0x3a, 0x37, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x5a, 0x3b, 0x2c, 0x97, 0x59, 0x3b, 0xdf, 0x8e, 0x97, 0x59, 0x3b, 0xe7, 0x01, 0x97, 0x59, 0x3b, 
+  0xdb, 0x98, 0x5a, 0x3a, 0x6c, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x5d, 0x3c, 0x04, 0x96, 0x59, 0x3b, 0x13, 0x9c, 0x97, 0x59, 0x3c, 0x14, 0x00, 0x95, 0x5b, 0x3d, 0x04, 0x87, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x97, 0x5c, 0x3d, 0x04, 0x97, 0x59, 0x3a, 0x17, 0x8e, 0x97, 0x59, 0x3a, 0x18, 0x00, 0x99, 0x58, 0x3b, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +303,7 @@ const lv_img_dsc_t facebook_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( facebook_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = facebook_64px_map,
 };
-
@@ -10,79 +10,72 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_FOOT_16PX uint8_t foot_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x38, 0xff, 0x88, 0xff, 0x70, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xff, 0xe0, 0xff, 0xa7, 0xff, 0x00, 0xff, 0x58, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x9f, 0xff, 0x5f, 0xff, 0x44, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x00, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfb, 0xff, 0xb0, 0xff, 0x17, 0xff, 0xfb, 0xff, 0x68, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x13, 0xff, 0xcf, 0xff, 0x27, 0xff, 0x9f, 0xff, 0x94, 0xff, 0x00, 0xff, 0x33, 0xff, 0x03, 0xff, 0x00, 0xff, 0xaf, 0xff, 0xb4, 0xff, 0x27, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x0f, 0xff, 0xf7, 0xff, 0x7f, 0xff, 0x03, 0xff, 0x07, 0xff, 0x0b, 0xff, 0x47, 0xff, 0x67, 0xff, 0x68, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x4b, 0xff, 0x48, 0xff, 0x1b, 0xff, 0x9b, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2b, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x70, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x03, 0xff, 0x08, 0xff, 0x50, 0xff, 0x5c, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x00, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x5f, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xd3, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x77, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0xff, 0x6f, 0xff, 0x90, 0xff, 0x67, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x86, 0x00, 0x00, 0x00, 0xff, 0x03, 0x82, 0x00, 0x00, 0x02, 0xff, 0x38, 0xff, 0x88, 0xff, 0x70, 0x87, 0x00, 0x00, 0x05, 0xff, 0x13, 0xff, 0xe0, 0xff, 0xa7, 0x00, 0x00, 
+  0xff, 0x58, 0xff, 0xfc, 0x81, 0xff, 0xff, 0x00, 0xff, 0x1f, 0x84, 0x00, 0x00, 0x06, 0xff, 0x9f, 0xff, 0x5f, 0xff, 0x44, 0xff, 0xff, 0xff, 0xbb, 0x00, 0x00, 0xff, 0xe0, 0x81, 0xff, 0xff, 0x00, 
+  0xff, 0xcb, 0x85, 0x00, 0x00, 0x05, 0xff, 0xfb, 0xff, 0xb0, 0xff, 0x17, 0xff, 0xfb, 0xff, 0x68, 0xff, 0x0c, 0x81, 0xff, 0xff, 0x01, 0xff, 0xeb, 0xff, 0x28, 0x82, 0x00, 0x00, 0x0b, 0xff, 0x13, 
+  0xff, 0xcf, 0xff, 0x27, 0xff, 0x9f, 0xff, 0x94, 0x00, 0x00, 0xff, 0x33, 0xff, 0x03, 0x00, 0x00, 0xff, 0xaf, 0xff, 0xb4, 0xff, 0x27, 0x83, 0x00, 0x00, 0x09, 0xff, 0x0f, 0xff, 0xf7, 0xff, 0x7f, 
+  0xff, 0x03, 0xff, 0x07, 0xff, 0x0b, 0xff, 0x47, 0xff, 0x67, 0xff, 0x68, 0xff, 0x3c, 0x86, 0x00, 0x00, 0x04, 0xff, 0x4b, 0xff, 0x48, 0xff, 0x1b, 0xff, 0x9b, 0xff, 0xf8, 0x83, 0xff, 0xff, 0x00, 
+  0xff, 0xb3, 0x86, 0x00, 0x00, 0x01, 0xff, 0x2b, 0xff, 0xe4, 0x85, 0xff, 0xff, 0x00, 0xff, 0xf4, 0x86, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x86, 0xff, 0xff, 0x00, 0xff, 0x7c, 0x85, 0x00, 0x00, 0x00, 
+  0xff, 0x17, 0x85, 0xff, 0xff, 0x01, 0xff, 0xf8, 0xff, 0x70, 0x86, 0x00, 0x00, 0x00, 0xff, 0x14, 0x84, 0xff, 0xff, 0x01, 0xff, 0xc4, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0xff, 0xcf, 0x82, 0xff, 
+  0xff, 0x05, 0xff, 0x8f, 0xff, 0x03, 0xff, 0x08, 0xff, 0x50, 0xff, 0x5c, 0xff, 0x08, 0x85, 0x00, 0x00, 0x00, 0xff, 0x4f, 0x82, 0xff, 0xff, 0x02, 0xff, 0x10, 0x00, 0x00, 0xff, 0x98, 0x81, 0xff, 
+  0xff, 0x00, 0xff, 0x38, 0x86, 0x00, 0x00, 0x00, 0xff, 0x8c, 0x81, 0xff, 0xff, 0x04, 0xff, 0xc0, 0xff, 0x5f, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xd3, 0x88, 0x00, 0x00, 0x01, 0xff, 0x77, 0xff, 0xf8, 
+  0x82, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xff, 0x23, 0x89, 0x00, 0x00, 0x04, 0xff, 0x18, 0xff, 0x6f, 0xff, 0x90, 0xff, 0x67, 0xff, 0x08, 0x84, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x38, 0xff, 0xff, 0x88, 0xff, 0xff, 0x70, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x58, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x17, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x27, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x94, 0xff, 0xff, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xb4, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x07, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x47, 0xff, 0xff, 0x67, 0xff, 0xff, 0x68, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x48, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x70, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x08, 0xff, 0xff, 0x50, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x77, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x18, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x90, 0xff, 0xff, 0x67, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x82, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x38, 0xff, 0xff, 0x88, 0xff, 0xff, 0x70, 0x87, 0x00, 0x00, 0x00, 0x05, 0xff, 
+  0xff, 0x13, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00, 0xff, 0xff, 0x58, 0xff, 0xff, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 
+  0x9f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xcb, 0x85, 0x00, 0x00, 0x00, 0x05, 
+  0xff, 0xff, 0xfb, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x17, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x0c, 0x81, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x28, 0x82, 0x00, 0x00, 
+  0x00, 0x0b, 0xff, 0xff, 0x13, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x27, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xaf, 
+  0xff, 0xff, 0xb4, 0xff, 0xff, 0x27, 0x83, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x07, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x47, 
+  0xff, 0xff, 0x67, 0xff, 0xff, 0x68, 0xff, 0xff, 0x3c, 0x86, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x48, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xf8, 0x83, 0xff, 0xff, 
+  0xff, 0x00, 0xff, 0xff, 0xb3, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xe4, 0x85, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf4, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcf, 
+  0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7c, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x17, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x70, 0x86, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0x14, 0x84, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcf, 0x82, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0x8f, 0xff, 0xff, 
+  0x03, 0xff, 0xff, 0x08, 0xff, 0xff, 0x50, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4f, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x38, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8c, 0x81, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x5f, 0xff, 0xff, 
+  0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x77, 0xff, 0xff, 0xf8, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x23, 0x89, 0x00, 0x00, 
+  0x00, 0x04, 0xff, 0xff, 0x18, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x90, 0xff, 0xff, 0x67, 0xff, 0xff, 0x08, 0x84, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x38, 0xff, 0xff, 0x88, 0xff, 0xff, 0x70, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x58, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x00, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x17, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x27, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x94, 0xff, 0xff, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xb4, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x07, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x47, 0xff, 0xff, 0x67, 0xff, 0xff, 0x68, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x48, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x70, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x08, 0xff, 0xff, 0x50, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x77, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x18, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x90, 0xff, 0xff, 0x67, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x82, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x38, 0xff, 0xff, 0x88, 0xff, 0xff, 0x70, 0x87, 0x00, 0x00, 0x00, 0x05, 0xff, 
+  0xff, 0x13, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00, 0xff, 0xff, 0x58, 0xff, 0xff, 0xfc, 0x81, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 
+  0x9f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xcb, 0x85, 0x00, 0x00, 0x00, 0x05, 
+  0xff, 0xff, 0xfb, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x17, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x0c, 0x81, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x28, 0x82, 0x00, 0x00, 
+  0x00, 0x0b, 0xff, 0xff, 0x13, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x27, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xaf, 
+  0xff, 0xff, 0xb4, 0xff, 0xff, 0x27, 0x83, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x07, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x47, 
+  0xff, 0xff, 0x67, 0xff, 0xff, 0x68, 0xff, 0xff, 0x3c, 0x86, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x48, 0xff, 0xff, 0x1b, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xf8, 0x83, 0xff, 0xff, 
+  0xff, 0x00, 0xff, 0xff, 0xb3, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xe4, 0x85, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf4, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcf, 
+  0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7c, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x17, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x70, 0x86, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0x14, 0x84, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcf, 0x82, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0x8f, 0xff, 0xff, 
+  0x03, 0xff, 0xff, 0x08, 0xff, 0xff, 0x50, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x4f, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x38, 0x86, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8c, 0x81, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x5f, 0xff, 0xff, 
+  0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x77, 0xff, 0xff, 0xf8, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x23, 0x89, 0x00, 0x00, 
+  0x00, 0x04, 0xff, 0xff, 0x18, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x90, 0xff, 0xff, 0x67, 0xff, 0xff, 0x08, 0x84, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x70, 
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xfc, 0x81, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xcb, 0x85, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 
+  0xff, 0xb0, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x0c, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0x28, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0x33, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0x27, 0x83, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x0f, 
+  0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0x68, 
+  0xff, 0xff, 0xff, 0x3c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xf8, 0x83, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xb3, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0xe4, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xf4, 
+  0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcf, 0x86, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x17, 0x85, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x70, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x14, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc4, 
+  0xff, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcf, 0x82, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x08, 
+  0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x5c, 0xff, 0xff, 0xff, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4f, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x10, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x38, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 0x81, 0xff, 0xff, 0xff, 
+  0xff, 0x04, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x77, 
+  0xff, 0xff, 0xff, 0xf8, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x23, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x6f, 
+  0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +83,7 @@ const lv_img_dsc_t foot_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( foot_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = foot_16px_map,
 };
-
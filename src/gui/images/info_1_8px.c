@@ -10,47 +10,41 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_1_8PX uint8_t info_1_8px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x10, 0x00, 0x18, 0x2f, 0x18, 0xb7, 0x18, 0xf4, 0x18, 0xf0, 0x18, 0xab, 0x18, 0x23, 0x00, 0x00, 
-  0x18, 0x30, 0x18, 0xf4, 0x9e, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x18, 0xff, 0x18, 0xe8, 0x18, 0x1f, 
-  0x18, 0xbc, 0x18, 0xff, 0x59, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xa0, 
-  0x18, 0xfb, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xe0, 
-  0x18, 0xfb, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xe0, 
-  0x18, 0xbc, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xa0, 
-  0x18, 0x30, 0x18, 0xf4, 0x9e, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0x18, 0xe8, 0x18, 0x1f, 
-  0x10, 0x00, 0x18, 0x2f, 0x18, 0xb7, 0x18, 0xf4, 0x18, 0xf0, 0x18, 0xab, 0x18, 0x23, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x14, 0x00, 0x00, 0x18, 0x2f, 0x18, 0xb7, 0x18, 0xf4, 0x18, 0xf0, 0x18, 0xab, 0x18, 0x23, 0x00, 0x00, 0x18, 0x30, 0x18, 0xf4, 0x9e, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x18, 
+  0xff, 0x18, 0xe8, 0x18, 0x1f, 0x18, 0xbc, 0x18, 0xff, 0x59, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x81, 0x18, 0xff, 0x01, 0x18, 0xa0, 0x18, 0xfb, 0x81, 0x18, 0xff, 0x01, 0x9e, 0xff, 0xbf, 0xff, 0x81, 
+  0x18, 0xff, 0x01, 0x18, 0xe0, 0x18, 0xfb, 0x81, 0x18, 0xff, 0x01, 0x9e, 0xff, 0xbf, 0xff, 0x81, 0x18, 0xff, 0x01, 0x18, 0xe0, 0x18, 0xbc, 0x81, 0x18, 0xff, 0x01, 0x9e, 0xff, 0xbf, 0xff, 0x81, 
+  0x18, 0xff, 0x03, 0x18, 0xa0, 0x18, 0x30, 0x18, 0xf4, 0x9e, 0xff, 0x81, 0xdf, 0xff, 0x0a, 0xbe, 0xff, 0x18, 0xe8, 0x18, 0x1f, 0x00, 0x00, 0x18, 0x2f, 0x18, 0xb7, 0x18, 0xf4, 0x18, 0xf0, 0x18, 
+  0xab, 0x18, 0x23, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x40, 0x04, 0x00, 0x40, 0x06, 0x2f, 0x40, 0x06, 0xb7, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xab, 0x40, 0x06, 0x23, 0x00, 0x00, 0x00, 
-  0x40, 0x06, 0x30, 0x40, 0x06, 0xf4, 0xd1, 0x8e, 0xff, 0x79, 0xcf, 0xff, 0xd1, 0x8e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xe8, 0x40, 0x06, 0x1f, 
-  0x40, 0x06, 0xbc, 0x40, 0x06, 0xff, 0x69, 0x4e, 0xff, 0xd1, 0x8e, 0xff, 0x15, 0xaf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xa0, 
-  0x40, 0x06, 0xfb, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xd1, 0x8e, 0xff, 0x15, 0xaf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xe0, 
-  0x40, 0x06, 0xfb, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xd1, 0x8e, 0xff, 0x15, 0xaf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xe0, 
-  0x40, 0x06, 0xbc, 0x40, 0x06, 0xff, 0x41, 0x0e, 0xff, 0xd1, 0x8e, 0xff, 0x35, 0xaf, 0xff, 0x42, 0x16, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xa0, 
-  0x40, 0x06, 0x30, 0x40, 0x06, 0xf4, 0xd1, 0x8e, 0xff, 0x59, 0xcf, 0xff, 0x59, 0xcf, 0xff, 0xf3, 0x9e, 0xff, 0x40, 0x06, 0xe8, 0x40, 0x06, 0x1f, 
-  0x40, 0x04, 0x00, 0x40, 0x06, 0x2f, 0x40, 0x06, 0xb7, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xab, 0x40, 0x06, 0x23, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x14, 0x00, 0x00, 0x00, 0x40, 0x06, 0x2f, 0x40, 0x06, 0xb7, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xab, 0x40, 0x06, 0x23, 0x00, 0x00, 0x00, 0x40, 0x06, 0x30, 
+  0x40, 0x06, 0xf4, 0xd1, 0x8e, 0xff, 0x79, 0xcf, 0xff, 0xd1, 0x8e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xe8, 0x40, 0x06, 0x1f, 0x40, 0x06, 0xbc, 0x40, 0x06, 0xff, 0x69, 0x4e, 0xff, 0xd1, 0x8e, 
+  0xff, 0x15, 0xaf, 0xff, 0x81, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xa0, 0x40, 0x06, 0xfb, 0x81, 0x40, 0x06, 0xff, 0x01, 0xd1, 0x8e, 0xff, 0x15, 0xaf, 0xff, 0x81, 0x40, 0x06, 0xff, 0x01, 0x40, 
+  0x06, 0xe0, 0x40, 0x06, 0xfb, 0x81, 0x40, 0x06, 0xff, 0x01, 0xd1, 0x8e, 0xff, 0x15, 0xaf, 0xff, 0x81, 0x40, 0x06, 0xff, 0x0b, 0x40, 0x06, 0xe0, 0x40, 0x06, 0xbc, 0x40, 0x06, 0xff, 0x41, 0x0e, 
+  0xff, 0xd1, 0x8e, 0xff, 0x35, 0xaf, 0xff, 0x42, 0x16, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xa0, 0x40, 0x06, 0x30, 0x40, 0x06, 0xf4, 0xd1, 0x8e, 0xff, 0x81, 0x59, 0xcf, 0xff, 0x0a, 0xf3, 0x9e, 
+  0xff, 0x40, 0x06, 0xe8, 0x40, 0x06, 0x1f, 0x00, 0x00, 0x00, 0x40, 0x06, 0x2f, 0x40, 0x06, 0xb7, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xab, 0x40, 0x06, 0x23, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x04, 0x40, 0x00, 0x06, 0x40, 0x2f, 0x06, 0x40, 0xb7, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xab, 0x06, 0x40, 0x23, 0x00, 0x00, 0x00, 
-  0x06, 0x40, 0x30, 0x06, 0x40, 0xf4, 0x8e, 0xd1, 0xff, 0xcf, 0x79, 0xff, 0x8e, 0xd1, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xe8, 0x06, 0x40, 0x1f, 
-  0x06, 0x40, 0xbc, 0x06, 0x40, 0xff, 0x4e, 0x69, 0xff, 0x8e, 0xd1, 0xff, 0xaf, 0x15, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xa0, 
-  0x06, 0x40, 0xfb, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x8e, 0xd1, 0xff, 0xaf, 0x15, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xe0, 
-  0x06, 0x40, 0xfb, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x8e, 0xd1, 0xff, 0xaf, 0x15, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xe0, 
-  0x06, 0x40, 0xbc, 0x06, 0x40, 0xff, 0x0e, 0x41, 0xff, 0x8e, 0xd1, 0xff, 0xaf, 0x35, 0xff, 0x16, 0x42, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xa0, 
-  0x06, 0x40, 0x30, 0x06, 0x40, 0xf4, 0x8e, 0xd1, 0xff, 0xcf, 0x59, 0xff, 0xcf, 0x59, 0xff, 0x9e, 0xf3, 0xff, 0x06, 0x40, 0xe8, 0x06, 0x40, 0x1f, 
-  0x04, 0x40, 0x00, 0x06, 0x40, 0x2f, 0x06, 0x40, 0xb7, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xab, 0x06, 0x40, 0x23, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x14, 0x00, 0x00, 0x00, 0x06, 0x40, 0x2f, 0x06, 0x40, 0xb7, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xab, 0x06, 0x40, 0x23, 0x00, 0x00, 0x00, 0x06, 0x40, 0x30, 
+  0x06, 0x40, 0xf4, 0x8e, 0xd1, 0xff, 0xcf, 0x79, 0xff, 0x8e, 0xd1, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xe8, 0x06, 0x40, 0x1f, 0x06, 0x40, 0xbc, 0x06, 0x40, 0xff, 0x4e, 0x69, 0xff, 0x8e, 0xd1, 
+  0xff, 0xaf, 0x15, 0xff, 0x81, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xa0, 0x06, 0x40, 0xfb, 0x81, 0x06, 0x40, 0xff, 0x01, 0x8e, 0xd1, 0xff, 0xaf, 0x15, 0xff, 0x81, 0x06, 0x40, 0xff, 0x01, 0x06, 
+  0x40, 0xe0, 0x06, 0x40, 0xfb, 0x81, 0x06, 0x40, 0xff, 0x01, 0x8e, 0xd1, 0xff, 0xaf, 0x15, 0xff, 0x81, 0x06, 0x40, 0xff, 0x0b, 0x06, 0x40, 0xe0, 0x06, 0x40, 0xbc, 0x06, 0x40, 0xff, 0x0e, 0x41, 
+  0xff, 0x8e, 0xd1, 0xff, 0xaf, 0x35, 0xff, 0x16, 0x42, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xa0, 0x06, 0x40, 0x30, 0x06, 0x40, 0xf4, 0x8e, 0xd1, 0xff, 0x81, 0xcf, 0x59, 0xff, 0x0a, 0x9e, 0xf3, 
+  0xff, 0x06, 0x40, 0xe8, 0x06, 0x40, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x40, 0x2f, 0x06, 0x40, 0xb7, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xab, 0x06, 0x40, 0x23, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x89, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xab, 0x00, 0xc8, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xc8, 0x00, 0x30, 0x00, 0xc8, 0x00, 0xf4, 0x87, 0xd9, 0x87, 0xff, 0xcc, 0xed, 0xcc, 0xff, 0x8c, 0xda, 0x8c, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xe8, 0x00, 0xc8, 0x00, 0x1f, 
-  0x00, 0xc8, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xff, 0x4a, 0xcd, 0x4a, 0xff, 0x89, 0xd9, 0x89, 0xff, 0xaa, 0xe1, 0xaa, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xa0, 
-  0x00, 0xc8, 0x00, 0xfb, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x88, 0xd8, 0x88, 0xff, 0xaa, 0xe1, 0xaa, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xe0, 
-  0x00, 0xc8, 0x00, 0xfb, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x88, 0xd8, 0x88, 0xff, 0xaa, 0xe1, 0xaa, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xe0, 
-  0x00, 0xc8, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xff, 0x0b, 0xc9, 0x0b, 0xff, 0x8a, 0xda, 0x8a, 0xff, 0xab, 0xe3, 0xab, 0xff, 0x0f, 0xca, 0x0f, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xa0, 
-  0x00, 0xc8, 0x00, 0x30, 0x00, 0xc8, 0x00, 0xf4, 0x85, 0xd7, 0x85, 0xff, 0xc6, 0xea, 0xc6, 0xff, 0xc6, 0xe9, 0xc6, 0xff, 0x97, 0xdc, 0x97, 0xff, 0x00, 0xc8, 0x00, 0xe8, 0x00, 0xc8, 0x00, 0x1f, 
-  0x00, 0x89, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xab, 0x00, 0xc8, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xab, 0x00, 0xc8, 0x00, 
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x30, 0x00, 0xc8, 0x00, 0xf4, 0x87, 0xd9, 0x87, 0xff, 0xcc, 0xed, 0xcc, 0xff, 0x8c, 0xda, 0x8c, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 
+  0xe8, 0x00, 0xc8, 0x00, 0x1f, 0x00, 0xc8, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xff, 0x4a, 0xcd, 0x4a, 0xff, 0x89, 0xd9, 0x89, 0xff, 0xaa, 0xe1, 0xaa, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 
+  0xc8, 0x00, 0xa0, 0x00, 0xc8, 0x00, 0xfb, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x88, 0xd8, 0x88, 0xff, 0xaa, 0xe1, 0xaa, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xe0, 0x00, 
+  0xc8, 0x00, 0xfb, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x88, 0xd8, 0x88, 0xff, 0xaa, 0xe1, 0xaa, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x18, 0x00, 0xc8, 0x00, 0xe0, 0x00, 0xc8, 0x00, 0xbc, 0x00, 
+  0xc8, 0x00, 0xff, 0x0b, 0xc9, 0x0b, 0xff, 0x8a, 0xda, 0x8a, 0xff, 0xab, 0xe3, 0xab, 0xff, 0x0f, 0xca, 0x0f, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xa0, 0x00, 0xc8, 0x00, 0x30, 0x00, 
+  0xc8, 0x00, 0xf4, 0x85, 0xd7, 0x85, 0xff, 0xc6, 0xea, 0xc6, 0xff, 0xc6, 0xe9, 0xc6, 0xff, 0x97, 0xdc, 0x97, 0xff, 0x00, 0xc8, 0x00, 0xe8, 0x00, 0xc8, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0xb7, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xab, 0x00, 0xc8, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -58,8 +52,7 @@ const lv_img_dsc_t info_1_8px = {
   .header.always_zero = 0,
   .header.w = 8,
   .header.h = 8,
-  .data_size = 64 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_1_8px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_1_8px_map,
 };
-
@@ -10,79 +10,80 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_2_16PX uint8_t info_2_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x24, 0x18, 0x8b, 0x18, 0xd0, 0x18, 0xf7, 0x18, 0xfb, 0x18, 0xdb, 0x18, 0x9c, 0x18, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x18, 0x83, 0x18, 0xfc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xac, 0x18, 0x0f, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0x03, 0x18, 0xa8, 0x18, 0xff, 0x18, 0xff, 0x59, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xd3, 0x18, 0x10, 0x04, 0x00, 
-  0x18, 0x00, 0x18, 0x78, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xb3, 0x18, 0x00, 
-  0x18, 0x18, 0x18, 0xf7, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x48, 
-  0x18, 0x74, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xab, 
-  0x18, 0xb4, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x7e, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xef, 
-  0x18, 0xd7, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 
-  0x18, 0xd7, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 
-  0x18, 0xb4, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xef, 
-  0x18, 0x74, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x38, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x59, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xab, 
-  0x18, 0x18, 0x18, 0xf7, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x7e, 0xff, 0x39, 0xff, 0x39, 0xff, 0x39, 0xff, 0x38, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x47, 
-  0x18, 0x00, 0x18, 0x77, 0x18, 0xff, 0x18, 0xff, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xb3, 0x18, 0x00, 
-  0x00, 0x00, 0x18, 0x03, 0x18, 0xa8, 0x18, 0xff, 0x18, 0xff, 0x59, 0xff, 0x59, 0xff, 0x59, 0xff, 0x59, 0xff, 0x59, 0xff, 0x59, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xd3, 0x18, 0x10, 0x04, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x18, 0x83, 0x18, 0xfb, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xab, 0x18, 0x0f, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x24, 0x18, 0x8b, 0x18, 0xd0, 0x18, 0xf7, 0x18, 0xfb, 0x18, 0xdb, 0x18, 0x9c, 0x18, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x07, 0x18, 0x24, 0x18, 0x8b, 0x18, 0xd0, 0x18, 0xf7, 0x18, 0xfb, 0x18, 0xdb, 0x18, 0x9c, 0x18, 0x3c, 0x85, 0x00, 0x00, 0x02, 0x18, 0x03, 0x18, 0x83, 
+  0x18, 0xfc, 0x86, 0x18, 0xff, 0x01, 0x18, 0xac, 0x18, 0x0f, 0x82, 0x00, 0x00, 0x01, 0x18, 0x03, 0x18, 0xa8, 0x81, 0x18, 0xff, 0x01, 0x59, 0xff, 0xbe, 0xff, 0x81, 0xdf, 0xff, 0x00, 0x9e, 0xff, 
+  0x82, 0x18, 0xff, 0x01, 0x18, 0xd3, 0x18, 0x10, 0x81, 0x00, 0x00, 0x00, 0x18, 0x78, 0x82, 0x18, 0xff, 0x81, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x81, 0xff, 0xff, 0x82, 0x18, 0xff, 0x03, 0x18, 0xb3, 
+  0x00, 0x00, 0x18, 0x18, 0x18, 0xf7, 0x82, 0x18, 0xff, 0x00, 0x9e, 0xff, 0x82, 0x18, 0xff, 0x02, 0x9e, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x82, 0x18, 0xff, 0x01, 0x18, 0x48, 0x18, 0x74, 0x88, 0x18, 
+  0xff, 0x01, 0xff, 0xff, 0xdf, 0xff, 0x82, 0x18, 0xff, 0x01, 0x18, 0xab, 0x18, 0xb4, 0x87, 0x18, 0xff, 0x02, 0x7e, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x82, 0x18, 0xff, 0x01, 0x18, 0xef, 0x18, 0xd7, 
+  0x86, 0x18, 0xff, 0x00, 0x39, 0xff, 0x81, 0xff, 0xff, 0x84, 0x18, 0xff, 0x00, 0x18, 0xd7, 0x85, 0x18, 0xff, 0x00, 0x39, 0xff, 0x81, 0xff, 0xff, 0x00, 0x59, 0xff, 0x84, 0x18, 0xff, 0x00, 0x18, 
+  0xb4, 0x84, 0x18, 0xff, 0x00, 0x38, 0xff, 0x81, 0xff, 0xff, 0x00, 0x59, 0xff, 0x84, 0x18, 0xff, 0x01, 0x18, 0xef, 0x18, 0x74, 0x83, 0x18, 0xff, 0x03, 0x38, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x59, 
+  0xff, 0x85, 0x18, 0xff, 0x02, 0x18, 0xab, 0x18, 0x18, 0x18, 0xf7, 0x82, 0x18, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0x7e, 0xff, 0x82, 0x39, 0xff, 0x00, 0x38, 0xff, 0x82, 0x18, 0xff, 0x02, 0x18, 
+  0x47, 0x00, 0x00, 0x18, 0x77, 0x81, 0x18, 0xff, 0x00, 0x59, 0xff, 0x85, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0x18, 0xff, 0x00, 0x18, 0xb3, 0x81, 0x00, 0x00, 0x01, 0x18, 0x03, 0x18, 0xa8, 0x81, 
+  0x18, 0xff, 0x85, 0x59, 0xff, 0x03, 0x39, 0xff, 0x18, 0xff, 0x18, 0xd3, 0x18, 0x10, 0x82, 0x00, 0x00, 0x02, 0x18, 0x03, 0x18, 0x83, 0x18, 0xfb, 0x86, 0x18, 0xff, 0x01, 0x18, 0xab, 0x18, 0x0f, 
+  0x85, 0x00, 0x00, 0x07, 0x18, 0x24, 0x18, 0x8b, 0x18, 0xd0, 0x18, 0xf7, 0x18, 0xfb, 0x18, 0xdb, 0x18, 0x9c, 0x18, 0x3c, 0x83, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x24, 0x40, 0x06, 0x8b, 0x40, 0x06, 0xd0, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xdb, 0x40, 0x06, 0x9c, 0x40, 0x06, 0x3c, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x03, 0x40, 0x06, 0x83, 0x40, 0x06, 0xfc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xac, 0x40, 0x06, 0x0f, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x03, 0x40, 0x06, 0xa8, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x67, 0x3e, 0xff, 0x13, 0x9f, 0xff, 0x58, 0xc7, 0xff, 0x57, 0xbf, 0xff, 0xf1, 0x8e, 0xff, 0x42, 0x16, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xd3, 0x40, 0x06, 0x10, 0x00, 0x01, 0x00, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x78, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xff, 0x79, 0xcf, 0xff, 0x7a, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xdf, 0xff, 0x41, 0x0e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xb3, 0x20, 0x06, 0x00, 
-  0x40, 0x06, 0x18, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xd0, 0x86, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xcf, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x48, 
-  0x40, 0x06, 0x74, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xfe, 0xf7, 0xff, 0x36, 0xb7, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xab, 
-  0x40, 0x06, 0xb4, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xae, 0x76, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x8e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xef, 
-  0x40, 0x06, 0xd7, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x66, 0x36, 0xff, 0xbd, 0xef, 0xff, 0x9b, 0xdf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 
-  0x40, 0x06, 0xd7, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x44, 0x26, 0xff, 0x9b, 0xdf, 0xff, 0xdd, 0xef, 0xff, 0x67, 0x3e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 
-  0x40, 0x06, 0xb4, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x43, 0x1e, 0xff, 0x9a, 0xd7, 0xff, 0xdd, 0xef, 0xff, 0x69, 0x4e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xef, 
-  0x40, 0x06, 0x74, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x43, 0x1e, 0xff, 0x9a, 0xd7, 0xff, 0xdd, 0xef, 0xff, 0x8a, 0x56, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xab, 
-  0x40, 0x06, 0x18, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x9a, 0xd7, 0xff, 0xfe, 0xf7, 0xff, 0xac, 0x66, 0xff, 0x65, 0x2e, 0xff, 0x65, 0x2e, 0xff, 0x65, 0x2e, 0xff, 0x63, 0x1e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x47, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x77, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x88, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xbf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xb3, 0x40, 0x06, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x03, 0x40, 0x06, 0xa8, 0x40, 0x06, 0xff, 0x41, 0x0e, 0xff, 0x66, 0x36, 0xff, 0x66, 0x36, 0xff, 0x66, 0x36, 0xff, 0x66, 0x36, 0xff, 0x66, 0x36, 0xff, 0x66, 0x36, 0xff, 0x44, 0x26, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xd3, 0x40, 0x06, 0x10, 0x00, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x03, 0x40, 0x06, 0x83, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xab, 0x40, 0x06, 0x0f, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x24, 0x40, 0x06, 0x8b, 0x40, 0x06, 0xd0, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xdb, 0x40, 0x06, 0x9c, 0x40, 0x06, 0x3c, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0x40, 0x06, 0x24, 0x40, 0x06, 0x8b, 0x40, 0x06, 0xd0, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xdb, 0x40, 0x06, 0x9c, 0x40, 0x06, 
+  0x3c, 0x85, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x03, 0x40, 0x06, 0x83, 0x40, 0x06, 0xfc, 0x86, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xac, 0x40, 0x06, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0x40, 
+  0x06, 0x03, 0x40, 0x06, 0xa8, 0x81, 0x40, 0x06, 0xff, 0x05, 0x67, 0x3e, 0xff, 0x13, 0x9f, 0xff, 0x58, 0xc7, 0xff, 0x57, 0xbf, 0xff, 0xf1, 0x8e, 0xff, 0x42, 0x16, 0xff, 0x81, 0x40, 0x06, 0xff, 
+  0x01, 0x40, 0x06, 0xd3, 0x40, 0x06, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x78, 0x82, 0x40, 0x06, 0xff, 0x06, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xff, 0x79, 0xcf, 0xff, 0x7a, 0xd7, 0xff, 
+  0xff, 0xff, 0xff, 0x9b, 0xdf, 0xff, 0x41, 0x0e, 0xff, 0x81, 0x40, 0x06, 0xff, 0x03, 0x40, 0x06, 0xb3, 0x00, 0x00, 0x00, 0x40, 0x06, 0x18, 0x40, 0x06, 0xf7, 0x82, 0x40, 0x06, 0xff, 0x00, 0xd0, 
+  0x86, 0xff, 0x82, 0x40, 0x06, 0xff, 0x02, 0xcf, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9e, 0xff, 0x82, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x48, 0x40, 0x06, 0x74, 0x88, 0x40, 0x06, 0xff, 0x01, 
+  0xfe, 0xf7, 0xff, 0x36, 0xb7, 0xff, 0x82, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xab, 0x40, 0x06, 0xb4, 0x87, 0x40, 0x06, 0xff, 0x02, 0xae, 0x76, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x8e, 0xff, 0x82, 
+  0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xef, 0x40, 0x06, 0xd7, 0x86, 0x40, 0x06, 0xff, 0x02, 0x66, 0x36, 0xff, 0xbd, 0xef, 0xff, 0x9b, 0xdf, 0xff, 0x84, 0x40, 0x06, 0xff, 0x00, 0x40, 0x06, 0xd7, 
+  0x85, 0x40, 0x06, 0xff, 0x03, 0x44, 0x26, 0xff, 0x9b, 0xdf, 0xff, 0xdd, 0xef, 0xff, 0x67, 0x3e, 0xff, 0x84, 0x40, 0x06, 0xff, 0x00, 0x40, 0x06, 0xb4, 0x84, 0x40, 0x06, 0xff, 0x03, 0x43, 0x1e, 
+  0xff, 0x9a, 0xd7, 0xff, 0xdd, 0xef, 0xff, 0x69, 0x4e, 0xff, 0x84, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xef, 0x40, 0x06, 0x74, 0x83, 0x40, 0x06, 0xff, 0x03, 0x43, 0x1e, 0xff, 0x9a, 0xd7, 0xff, 
+  0xdd, 0xef, 0xff, 0x8a, 0x56, 0xff, 0x85, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0xab, 0x40, 0x06, 0x18, 0x40, 0x06, 0xf7, 0x82, 0x40, 0x06, 0xff, 0x02, 0x9a, 0xd7, 0xff, 0xfe, 0xf7, 0xff, 0xac, 
+  0x66, 0xff, 0x82, 0x65, 0x2e, 0xff, 0x00, 0x63, 0x1e, 0xff, 0x82, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0x47, 0x00, 0x00, 0x00, 0x40, 0x06, 0x77, 0x81, 0x40, 0x06, 0xff, 0x00, 0x88, 0x46, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0x00, 0x57, 0xbf, 0xff, 0x81, 0x40, 0x06, 0xff, 0x00, 0x40, 0x06, 0xb3, 0x81, 0x00, 0x00, 0x00, 0x03, 0x40, 0x06, 0x03, 0x40, 0x06, 0xa8, 0x40, 0x06, 0xff, 0x41, 0x0e, 
+  0xff, 0x85, 0x66, 0x36, 0xff, 0x03, 0x44, 0x26, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xd3, 0x40, 0x06, 0x10, 0x82, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x03, 0x40, 0x06, 0x83, 0x40, 0x06, 0xfb, 
+  0x86, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xab, 0x40, 0x06, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x07, 0x40, 0x06, 0x24, 0x40, 0x06, 0x8b, 0x40, 0x06, 0xd0, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xfb, 0x40, 
+  0x06, 0xdb, 0x40, 0x06, 0x9c, 0x40, 0x06, 0x3c, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x24, 0x06, 0x40, 0x8b, 0x06, 0x40, 0xd0, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xdb, 0x06, 0x40, 0x9c, 0x06, 0x40, 0x3c, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x03, 0x06, 0x40, 0x83, 0x06, 0x40, 0xfc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xac, 0x06, 0x40, 0x0f, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x03, 0x06, 0x40, 0xa8, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x3e, 0x67, 0xff, 0x9f, 0x13, 0xff, 0xc7, 0x58, 0xff, 0xbf, 0x57, 0xff, 0x8e, 0xf1, 0xff, 0x16, 0x42, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xd3, 0x06, 0x40, 0x10, 0x01, 0x00, 0x00, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x78, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xcf, 0x79, 0xff, 0xd7, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9b, 0xff, 0x0e, 0x41, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xb3, 0x06, 0x20, 0x00, 
-  0x06, 0x40, 0x18, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x86, 0xd0, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x7e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf3, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x48, 
-  0x06, 0x40, 0x74, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xf7, 0xfe, 0xff, 0xb7, 0x36, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xab, 
-  0x06, 0x40, 0xb4, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x76, 0xae, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xd1, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xef, 
-  0x06, 0x40, 0xd7, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x36, 0x66, 0xff, 0xef, 0xbd, 0xff, 0xdf, 0x9b, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 
-  0x06, 0x40, 0xd7, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x26, 0x44, 0xff, 0xdf, 0x9b, 0xff, 0xef, 0xdd, 0xff, 0x3e, 0x67, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 
-  0x06, 0x40, 0xb4, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x1e, 0x43, 0xff, 0xd7, 0x9a, 0xff, 0xef, 0xdd, 0xff, 0x4e, 0x69, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xef, 
-  0x06, 0x40, 0x74, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x1e, 0x43, 0xff, 0xd7, 0x9a, 0xff, 0xef, 0xdd, 0xff, 0x56, 0x8a, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xab, 
-  0x06, 0x40, 0x18, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xd7, 0x9a, 0xff, 0xf7, 0xfe, 0xff, 0x66, 0xac, 0xff, 0x2e, 0x65, 0xff, 0x2e, 0x65, 0xff, 0x2e, 0x65, 0xff, 0x1e, 0x63, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x47, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x77, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x46, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x57, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xb3, 0x06, 0x40, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x03, 0x06, 0x40, 0xa8, 0x06, 0x40, 0xff, 0x0e, 0x41, 0xff, 0x36, 0x66, 0xff, 0x36, 0x66, 0xff, 0x36, 0x66, 0xff, 0x36, 0x66, 0xff, 0x36, 0x66, 0xff, 0x36, 0x66, 0xff, 0x26, 0x44, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xd3, 0x06, 0x40, 0x10, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x03, 0x06, 0x40, 0x83, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xab, 0x06, 0x40, 0x0f, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x24, 0x06, 0x40, 0x8b, 0x06, 0x40, 0xd0, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xdb, 0x06, 0x40, 0x9c, 0x06, 0x40, 0x3c, 0x06, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0x06, 0x40, 0x24, 0x06, 0x40, 0x8b, 0x06, 0x40, 0xd0, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xdb, 0x06, 0x40, 0x9c, 0x06, 0x40, 
+  0x3c, 0x85, 0x00, 0x00, 0x00, 0x02, 0x06, 0x40, 0x03, 0x06, 0x40, 0x83, 0x06, 0x40, 0xfc, 0x86, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xac, 0x06, 0x40, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0x06, 
+  0x40, 0x03, 0x06, 0x40, 0xa8, 0x81, 0x06, 0x40, 0xff, 0x05, 0x3e, 0x67, 0xff, 0x9f, 0x13, 0xff, 0xc7, 0x58, 0xff, 0xbf, 0x57, 0xff, 0x8e, 0xf1, 0xff, 0x16, 0x42, 0xff, 0x81, 0x06, 0x40, 0xff, 
+  0x01, 0x06, 0x40, 0xd3, 0x06, 0x40, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x78, 0x82, 0x06, 0x40, 0xff, 0x06, 0xff, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xcf, 0x79, 0xff, 0xd7, 0x7a, 0xff, 
+  0xff, 0xff, 0xff, 0xdf, 0x9b, 0xff, 0x0e, 0x41, 0xff, 0x81, 0x06, 0x40, 0xff, 0x03, 0x06, 0x40, 0xb3, 0x00, 0x00, 0x00, 0x06, 0x40, 0x18, 0x06, 0x40, 0xf7, 0x82, 0x06, 0x40, 0xff, 0x00, 0x86, 
+  0xd0, 0xff, 0x82, 0x06, 0x40, 0xff, 0x02, 0x7e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf3, 0xff, 0x82, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x48, 0x06, 0x40, 0x74, 0x88, 0x06, 0x40, 0xff, 0x01, 
+  0xf7, 0xfe, 0xff, 0xb7, 0x36, 0xff, 0x82, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xab, 0x06, 0x40, 0xb4, 0x87, 0x06, 0x40, 0xff, 0x02, 0x76, 0xae, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xd1, 0xff, 0x82, 
+  0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xef, 0x06, 0x40, 0xd7, 0x86, 0x06, 0x40, 0xff, 0x02, 0x36, 0x66, 0xff, 0xef, 0xbd, 0xff, 0xdf, 0x9b, 0xff, 0x84, 0x06, 0x40, 0xff, 0x00, 0x06, 0x40, 0xd7, 
+  0x85, 0x06, 0x40, 0xff, 0x03, 0x26, 0x44, 0xff, 0xdf, 0x9b, 0xff, 0xef, 0xdd, 0xff, 0x3e, 0x67, 0xff, 0x84, 0x06, 0x40, 0xff, 0x00, 0x06, 0x40, 0xb4, 0x84, 0x06, 0x40, 0xff, 0x03, 0x1e, 0x43, 
+  0xff, 0xd7, 0x9a, 0xff, 0xef, 0xdd, 0xff, 0x4e, 0x69, 0xff, 0x84, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xef, 0x06, 0x40, 0x74, 0x83, 0x06, 0x40, 0xff, 0x03, 0x1e, 0x43, 0xff, 0xd7, 0x9a, 0xff, 
+  0xef, 0xdd, 0xff, 0x56, 0x8a, 0xff, 0x85, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0xab, 0x06, 0x40, 0x18, 0x06, 0x40, 0xf7, 0x82, 0x06, 0x40, 0xff, 0x02, 0xd7, 0x9a, 0xff, 0xf7, 0xfe, 0xff, 0x66, 
+  0xac, 0xff, 0x82, 0x2e, 0x65, 0xff, 0x00, 0x1e, 0x63, 0xff, 0x82, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0x47, 0x00, 0x00, 0x00, 0x06, 0x40, 0x77, 0x81, 0x06, 0x40, 0xff, 0x00, 0x46, 0x88, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0x00, 0xbf, 0x57, 0xff, 0x81, 0x06, 0x40, 0xff, 0x00, 0x06, 0x40, 0xb3, 0x81, 0x00, 0x00, 0x00, 0x03, 0x06, 0x40, 0x03, 0x06, 0x40, 0xa8, 0x06, 0x40, 0xff, 0x0e, 0x41, 
+  0xff, 0x85, 0x36, 0x66, 0xff, 0x03, 0x26, 0x44, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xd3, 0x06, 0x40, 0x10, 0x82, 0x00, 0x00, 0x00, 0x02, 0x06, 0x40, 0x03, 0x06, 0x40, 0x83, 0x06, 0x40, 0xfb, 
+  0x86, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xab, 0x06, 0x40, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x07, 0x06, 0x40, 0x24, 0x06, 0x40, 0x8b, 0x06, 0x40, 0xd0, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xfb, 0x06, 
+  0x40, 0xdb, 0x06, 0x40, 0x9c, 0x06, 0x40, 0x3c, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x03, 0x00, 0x00, 0xc8, 0x02, 0x24, 0x00, 0xc8, 0x02, 0x8b, 0x00, 0xc8, 0x01, 0xd0, 0x00, 0xc8, 0x01, 0xf7, 0x00, 0xc8, 0x01, 0xfb, 0x00, 0xc8, 0x01, 0xdb, 0x00, 0xc8, 0x01, 0x9c, 0x00, 0xc8, 0x02, 0x3c, 0x00, 0xcc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x03, 0x00, 0xc8, 0x02, 0x83, 0x00, 0xc8, 0x01, 0xfc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x02, 0xac, 0x00, 0xc7, 0x01, 0x0f, 0x00, 0xc9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x03, 0x03, 0x00, 0xc8, 0x01, 0xa8, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x3b, 0xcd, 0x3b, 0xff, 0x9b, 0xdf, 0x9b, 0xff, 0xbe, 0xe9, 0xbe, 0xff, 0xbc, 0xe8, 0xbc, 0xff, 0x8b, 0xdb, 0x8b, 0xff, 0x0e, 0xc9, 0x0e, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xd3, 0x00, 0xc7, 0x02, 0x10, 0x00, 0x20, 0x00, 0x00, 
-  0x00, 0xca, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x78, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xca, 0x00, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0xea, 0xf9, 0xea, 0xff, 0xc9, 0xed, 0xc9, 0xff, 0xcd, 0xee, 0xcd, 0xff, 0xfb, 0xfe, 0xfb, 0xff, 0xd7, 0xf2, 0xd7, 0xff, 0x08, 0xc9, 0x08, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xb3, 0x00, 0xc4, 0x04, 0x00, 
-  0x00, 0xc8, 0x02, 0x18, 0x00, 0xc8, 0x01, 0xf7, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x04, 0xca, 0x04, 0xff, 0x7f, 0xd9, 0x7f, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x79, 0xd7, 0x79, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x96, 0xdd, 0x96, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x02, 0x48, 
-  0x00, 0xc8, 0x02, 0x74, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc9, 0x00, 0xff, 0xf3, 0xfb, 0xf3, 0xff, 0xb4, 0xe4, 0xb4, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xab, 
-  0x00, 0xc8, 0x01, 0xb4, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x6d, 0xd4, 0x6d, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x85, 0xd9, 0x85, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xef, 
-  0x00, 0xc8, 0x01, 0xd7, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x2e, 0xcb, 0x2e, 0xff, 0xe5, 0xf6, 0xe5, 0xff, 0xd8, 0xf2, 0xd8, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xff, 
-  0x00, 0xc8, 0x01, 0xd7, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x22, 0xca, 0x22, 0xff, 0xd8, 0xf2, 0xd8, 0xff, 0xe6, 0xf7, 0xe6, 0xff, 0x3b, 0xcc, 0x3b, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xff, 
-  0x00, 0xc8, 0x01, 0xb4, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x1c, 0xc9, 0x1c, 0xff, 0xd4, 0xf1, 0xd4, 0xff, 0xe9, 0xf8, 0xe9, 0xff, 0x45, 0xce, 0x45, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xef, 
-  0x00, 0xc8, 0x02, 0x74, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x16, 0xc9, 0x16, 0xff, 0xd0, 0xf0, 0xd0, 0xff, 0xec, 0xf9, 0xec, 0xff, 0x50, 0xcf, 0x50, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xab, 
-  0x00, 0xc8, 0x02, 0x18, 0x00, 0xc8, 0x01, 0xf7, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc9, 0x00, 0xff, 0xce, 0xef, 0xce, 0xff, 0xf2, 0xfb, 0xf2, 0xff, 0x61, 0xd5, 0x61, 0xff, 0x2a, 0xce, 0x2a, 0xff, 0x2a, 0xce, 0x2a, 0xff, 0x2a, 0xce, 0x2a, 0xff, 0x1c, 0xcb, 0x1c, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x02, 0x47, 
-  0x00, 0xc9, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x77, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x3e, 0xcf, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe9, 0xbc, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xb3, 0x00, 0xc7, 0x04, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x03, 0x00, 0xc8, 0x01, 0xa8, 0x00, 0xc8, 0x00, 0xff, 0x05, 0xc8, 0x05, 0xff, 0x32, 0xcc, 0x32, 0xff, 0x33, 0xcc, 0x33, 0xff, 0x33, 0xcc, 0x33, 0xff, 0x33, 0xcc, 0x33, 0xff, 0x33, 0xcc, 0x33, 0xff, 0x33, 0xcc, 0x33, 0xff, 0x22, 0xca, 0x22, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xd3, 0x00, 0xc7, 0x01, 0x10, 0x00, 0x20, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x03, 0x00, 0xc8, 0x02, 0x83, 0x00, 0xc8, 0x01, 0xfb, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x02, 0xab, 0x00, 0xc9, 0x01, 0x0f, 0x00, 0xc9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, 0xc8, 0x02, 0x24, 0x00, 0xc8, 0x02, 0x8b, 0x00, 0xc8, 0x01, 0xd0, 0x00, 0xc8, 0x01, 0xf7, 0x00, 0xc8, 0x01, 0xfb, 0x00, 0xc8, 0x01, 0xdb, 0x00, 0xc8, 0x01, 0x9c, 0x00, 0xc8, 0x02, 0x3c, 0x00, 0xc4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc8, 0x02, 0x24, 0x00, 0xc8, 0x02, 0x8b, 0x00, 0xc8, 0x01, 0xd0, 0x00, 0xc8, 0x01, 0xf7, 0x00, 0xc8, 0x01, 0xfb, 0x00, 0xc8, 
+  0x01, 0xdb, 0x00, 0xc8, 0x01, 0x9c, 0x00, 0xc8, 0x02, 0x3c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x04, 0x03, 0x00, 0xc8, 0x02, 0x83, 0x00, 0xc8, 0x01, 0xfc, 0x86, 0x00, 0xc8, 0x00, 
+  0xff, 0x01, 0x00, 0xc8, 0x02, 0xac, 0x00, 0xc7, 0x01, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xca, 0x03, 0x03, 0x00, 0xc8, 0x01, 0xa8, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x05, 0x3b, 0xcd, 
+  0x3b, 0xff, 0x9b, 0xdf, 0x9b, 0xff, 0xbe, 0xe9, 0xbe, 0xff, 0xbc, 0xe8, 0xbc, 0xff, 0x8b, 0xdb, 0x8b, 0xff, 0x0e, 0xc9, 0x0e, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x01, 0xd3, 
+  0x00, 0xc7, 0x02, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x78, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x07, 0x00, 0xca, 0x00, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0xea, 0xf9, 0xea, 0xff, 
+  0xc9, 0xed, 0xc9, 0xff, 0xcd, 0xee, 0xcd, 0xff, 0xfb, 0xfe, 0xfb, 0xff, 0xd7, 0xf2, 0xd7, 0xff, 0x08, 0xc9, 0x08, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x03, 0x00, 0xc8, 0x01, 0xb3, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xc8, 0x02, 0x18, 0x00, 0xc8, 0x01, 0xf7, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x04, 0xca, 0x04, 0xff, 0x7f, 0xd9, 0x7f, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x79, 0xd7, 
+  0x79, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x96, 0xdd, 0x96, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x02, 0x48, 0x00, 0xc8, 0x02, 0x74, 0x87, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc9, 
+  0x00, 0xff, 0xf3, 0xfb, 0xf3, 0xff, 0xb4, 0xe4, 0xb4, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x01, 0xab, 0x00, 0xc8, 0x01, 0xb4, 0x87, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x6d, 0xd4, 
+  0x6d, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x85, 0xd9, 0x85, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x01, 0xef, 0x00, 0xc8, 0x01, 0xd7, 0x86, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x2e, 0xcb, 
+  0x2e, 0xff, 0xe5, 0xf6, 0xe5, 0xff, 0xd8, 0xf2, 0xd8, 0xff, 0x83, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x01, 0xff, 0x00, 0xc8, 0x01, 0xd7, 0x85, 0x00, 0xc8, 0x00, 0xff, 0x03, 0x22, 0xca, 
+  0x22, 0xff, 0xd8, 0xf2, 0xd8, 0xff, 0xe6, 0xf7, 0xe6, 0xff, 0x3b, 0xcc, 0x3b, 0xff, 0x83, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x01, 0xff, 0x00, 0xc8, 0x01, 0xb4, 0x84, 0x00, 0xc8, 0x00, 
+  0xff, 0x03, 0x1c, 0xc9, 0x1c, 0xff, 0xd4, 0xf1, 0xd4, 0xff, 0xe9, 0xf8, 0xe9, 0xff, 0x45, 0xce, 0x45, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x01, 0xef, 0x00, 0xc8, 0x02, 0x74, 
+  0x83, 0x00, 0xc8, 0x00, 0xff, 0x03, 0x16, 0xc9, 0x16, 0xff, 0xd0, 0xf0, 0xd0, 0xff, 0xec, 0xf9, 0xec, 0xff, 0x50, 0xcf, 0x50, 0xff, 0x85, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x01, 0xab, 
+  0x00, 0xc8, 0x02, 0x18, 0x00, 0xc8, 0x01, 0xf7, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x03, 0x00, 0xc9, 0x00, 0xff, 0xce, 0xef, 0xce, 0xff, 0xf2, 0xfb, 0xf2, 0xff, 0x61, 0xd5, 0x61, 0xff, 0x82, 0x2a, 
+  0xce, 0x2a, 0xff, 0x00, 0x1c, 0xcb, 0x1c, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x02, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x77, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x00, 
+  0x3e, 0xcf, 0x3e, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xbc, 0xe9, 0xbc, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x00, 0x00, 0xc8, 0x01, 0xb3, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc8, 
+  0x03, 0x03, 0x00, 0xc8, 0x01, 0xa8, 0x00, 0xc8, 0x00, 0xff, 0x05, 0xc8, 0x05, 0xff, 0x32, 0xcc, 0x32, 0xff, 0x84, 0x33, 0xcc, 0x33, 0xff, 0x03, 0x22, 0xca, 0x22, 0xff, 0x00, 0xc8, 0x00, 0xff, 
+  0x00, 0xc8, 0x01, 0xd3, 0x00, 0xc7, 0x01, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x04, 0x03, 0x00, 0xc8, 0x02, 0x83, 0x00, 0xc8, 0x01, 0xfb, 0x86, 0x00, 0xc8, 0x00, 0xff, 0x01, 
+  0x00, 0xc8, 0x02, 0xab, 0x00, 0xc9, 0x01, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc8, 0x02, 0x24, 0x00, 0xc8, 0x02, 0x8b, 0x00, 0xc8, 0x01, 0xd0, 0x00, 0xc8, 0x01, 0xf7, 0x00, 0xc8, 
+  0x01, 0xfb, 0x00, 0xc8, 0x01, 0xdb, 0x00, 0xc8, 0x01, 0x9c, 0x00, 0xc8, 0x02, 0x3c, 0x83, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +91,7 @@ const lv_img_dsc_t info_2_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_2_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_2_16px_map,
 };
-
@@ -10,47 +10,41 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_2_8PX uint8_t info_2_8px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x18, 0x23, 0x18, 0xab, 0x18, 0xf0, 0x18, 0xf4, 0x18, 0xb7, 0x18, 0x2f, 0x10, 0x00, 
-  0x18, 0x1f, 0x18, 0xe8, 0x9e, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x18, 0xf4, 0x18, 0x30, 
-  0x18, 0xa0, 0x18, 0xff, 0x59, 0xff, 0x18, 0xff, 0x59, 0xff, 0xff, 0xff, 0x18, 0xff, 0x18, 0xbc, 
-  0x18, 0xe0, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0x18, 0xff, 0x18, 0xfb, 
-  0x18, 0xe0, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0x38, 0xff, 0x18, 0xff, 0x18, 0xfb, 
-  0x18, 0xa0, 0x18, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0x39, 0xff, 0x38, 0xff, 0x18, 0xff, 0x18, 0xbc, 
-  0x18, 0x1f, 0x18, 0xe8, 0x9e, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x18, 0xf4, 0x18, 0x30, 
-  0x00, 0x00, 0x18, 0x23, 0x18, 0xab, 0x18, 0xf0, 0x18, 0xf4, 0x18, 0xb7, 0x18, 0x2f, 0x10, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x0a, 0x00, 0x00, 0x18, 0x23, 0x18, 0xab, 0x18, 0xf0, 0x18, 0xf4, 0x18, 0xb7, 0x18, 0x2f, 0x00, 0x00, 0x18, 0x1f, 0x18, 0xe8, 0x9e, 0xff, 0x81, 0xdf, 0xff, 0x0b, 0x9e, 
+  0xff, 0x18, 0xf4, 0x18, 0x30, 0x18, 0xa0, 0x18, 0xff, 0x59, 0xff, 0x18, 0xff, 0x59, 0xff, 0xff, 0xff, 0x18, 0xff, 0x18, 0xbc, 0x18, 0xe0, 0x82, 0x18, 0xff, 0x04, 0x9e, 0xff, 0xdf, 0xff, 0x18, 
+  0xff, 0x18, 0xfb, 0x18, 0xe0, 0x81, 0x18, 0xff, 0x0f, 0x9e, 0xff, 0xdf, 0xff, 0x38, 0xff, 0x18, 0xff, 0x18, 0xfb, 0x18, 0xa0, 0x18, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0x39, 0xff, 0x38, 0xff, 0x18, 
+  0xff, 0x18, 0xbc, 0x18, 0x1f, 0x18, 0xe8, 0x9e, 0xff, 0x81, 0xdf, 0xff, 0x0a, 0xbf, 0xff, 0x18, 0xf4, 0x18, 0x30, 0x00, 0x00, 0x18, 0x23, 0x18, 0xab, 0x18, 0xf0, 0x18, 0xf4, 0x18, 0xb7, 0x18, 
+  0x2f, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x23, 0x40, 0x06, 0xab, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xb7, 0x40, 0x06, 0x2f, 0x40, 0x04, 0x00, 
-  0x40, 0x06, 0x1f, 0x40, 0x06, 0xe8, 0xd1, 0x8e, 0xff, 0x78, 0xc7, 0xff, 0x79, 0xcf, 0xff, 0xae, 0x76, 0xff, 0x40, 0x06, 0xf4, 0x40, 0x06, 0x30, 
-  0x40, 0x06, 0xa0, 0x40, 0x06, 0xff, 0x68, 0x46, 0xff, 0x40, 0x06, 0xff, 0x67, 0x3e, 0xff, 0x9b, 0xdf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xbc, 
-  0x40, 0x06, 0xe0, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xd1, 0x8e, 0xff, 0x37, 0xbf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xfb, 
-  0x40, 0x06, 0xe0, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xae, 0x76, 0xff, 0x79, 0xcf, 0xff, 0x43, 0x1e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xfb, 
-  0x40, 0x06, 0xa0, 0x40, 0x06, 0xff, 0xae, 0x76, 0xff, 0x9a, 0xd7, 0xff, 0x66, 0x36, 0xff, 0x42, 0x16, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xbc, 
-  0x40, 0x06, 0x1f, 0x40, 0x06, 0xe8, 0xd2, 0x96, 0xff, 0x59, 0xcf, 0xff, 0x59, 0xcf, 0xff, 0x36, 0xb7, 0xff, 0x40, 0x06, 0xf4, 0x40, 0x06, 0x30, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x23, 0x40, 0x06, 0xab, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xb7, 0x40, 0x06, 0x2f, 0x40, 0x04, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x18, 0x00, 0x00, 0x00, 0x40, 0x06, 0x23, 0x40, 0x06, 0xab, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xb7, 0x40, 0x06, 0x2f, 0x00, 0x00, 0x00, 0x40, 0x06, 0x1f, 
+  0x40, 0x06, 0xe8, 0xd1, 0x8e, 0xff, 0x78, 0xc7, 0xff, 0x79, 0xcf, 0xff, 0xae, 0x76, 0xff, 0x40, 0x06, 0xf4, 0x40, 0x06, 0x30, 0x40, 0x06, 0xa0, 0x40, 0x06, 0xff, 0x68, 0x46, 0xff, 0x40, 0x06, 
+  0xff, 0x67, 0x3e, 0xff, 0x9b, 0xdf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xbc, 0x40, 0x06, 0xe0, 0x82, 0x40, 0x06, 0xff, 0x04, 0xd1, 0x8e, 0xff, 0x37, 0xbf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 
+  0xfb, 0x40, 0x06, 0xe0, 0x81, 0x40, 0x06, 0xff, 0x0f, 0xae, 0x76, 0xff, 0x79, 0xcf, 0xff, 0x43, 0x1e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xa0, 0x40, 0x06, 0xff, 0xae, 0x76, 
+  0xff, 0x9a, 0xd7, 0xff, 0x66, 0x36, 0xff, 0x42, 0x16, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xbc, 0x40, 0x06, 0x1f, 0x40, 0x06, 0xe8, 0xd2, 0x96, 0xff, 0x81, 0x59, 0xcf, 0xff, 0x0a, 0x36, 0xb7, 
+  0xff, 0x40, 0x06, 0xf4, 0x40, 0x06, 0x30, 0x00, 0x00, 0x00, 0x40, 0x06, 0x23, 0x40, 0x06, 0xab, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xf4, 0x40, 0x06, 0xb7, 0x40, 0x06, 0x2f, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x23, 0x06, 0x40, 0xab, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xb7, 0x06, 0x40, 0x2f, 0x04, 0x40, 0x00, 
-  0x06, 0x40, 0x1f, 0x06, 0x40, 0xe8, 0x8e, 0xd1, 0xff, 0xc7, 0x78, 0xff, 0xcf, 0x79, 0xff, 0x76, 0xae, 0xff, 0x06, 0x40, 0xf4, 0x06, 0x40, 0x30, 
-  0x06, 0x40, 0xa0, 0x06, 0x40, 0xff, 0x46, 0x68, 0xff, 0x06, 0x40, 0xff, 0x3e, 0x67, 0xff, 0xdf, 0x9b, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xbc, 
-  0x06, 0x40, 0xe0, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x8e, 0xd1, 0xff, 0xbf, 0x37, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xfb, 
-  0x06, 0x40, 0xe0, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x76, 0xae, 0xff, 0xcf, 0x79, 0xff, 0x1e, 0x43, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xfb, 
-  0x06, 0x40, 0xa0, 0x06, 0x40, 0xff, 0x76, 0xae, 0xff, 0xd7, 0x9a, 0xff, 0x36, 0x66, 0xff, 0x16, 0x42, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xbc, 
-  0x06, 0x40, 0x1f, 0x06, 0x40, 0xe8, 0x96, 0xd2, 0xff, 0xcf, 0x59, 0xff, 0xcf, 0x59, 0xff, 0xb7, 0x36, 0xff, 0x06, 0x40, 0xf4, 0x06, 0x40, 0x30, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x23, 0x06, 0x40, 0xab, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xb7, 0x06, 0x40, 0x2f, 0x04, 0x40, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x18, 0x00, 0x00, 0x00, 0x06, 0x40, 0x23, 0x06, 0x40, 0xab, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xb7, 0x06, 0x40, 0x2f, 0x00, 0x00, 0x00, 0x06, 0x40, 0x1f, 
+  0x06, 0x40, 0xe8, 0x8e, 0xd1, 0xff, 0xc7, 0x78, 0xff, 0xcf, 0x79, 0xff, 0x76, 0xae, 0xff, 0x06, 0x40, 0xf4, 0x06, 0x40, 0x30, 0x06, 0x40, 0xa0, 0x06, 0x40, 0xff, 0x46, 0x68, 0xff, 0x06, 0x40, 
+  0xff, 0x3e, 0x67, 0xff, 0xdf, 0x9b, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xbc, 0x06, 0x40, 0xe0, 0x82, 0x06, 0x40, 0xff, 0x04, 0x8e, 0xd1, 0xff, 0xbf, 0x37, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 
+  0xfb, 0x06, 0x40, 0xe0, 0x81, 0x06, 0x40, 0xff, 0x0f, 0x76, 0xae, 0xff, 0xcf, 0x79, 0xff, 0x1e, 0x43, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xa0, 0x06, 0x40, 0xff, 0x76, 0xae, 
+  0xff, 0xd7, 0x9a, 0xff, 0x36, 0x66, 0xff, 0x16, 0x42, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xbc, 0x06, 0x40, 0x1f, 0x06, 0x40, 0xe8, 0x96, 0xd2, 0xff, 0x81, 0xcf, 0x59, 0xff, 0x0a, 0xb7, 0x36, 
+  0xff, 0x06, 0x40, 0xf4, 0x06, 0x40, 0x30, 0x00, 0x00, 0x00, 0x06, 0x40, 0x23, 0x06, 0x40, 0xab, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xf4, 0x06, 0x40, 0xb7, 0x06, 0x40, 0x2f, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x23, 0x00, 0xc8, 0x01, 0xab, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x01, 0xb7, 0x00, 0xc8, 0x01, 0x2f, 0x00, 0x89, 0x01, 0x00, 
-  0x00, 0xc8, 0x02, 0x1f, 0x00, 0xc8, 0x00, 0xe8, 0x88, 0xd9, 0x88, 0xff, 0xc3, 0xeb, 0xc3, 0xff, 0xc8, 0xec, 0xc8, 0xff, 0x72, 0xd4, 0x72, 0xff, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x01, 0x30, 
-  0x00, 0xc8, 0x01, 0xa0, 0x00, 0xc8, 0x00, 0xff, 0x3f, 0xcc, 0x3f, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x3c, 0xcc, 0x3c, 0xff, 0xd8, 0xf1, 0xd8, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xbc, 
-  0x00, 0xc8, 0x00, 0xe0, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x85, 0xd8, 0x85, 0xff, 0xb7, 0xe6, 0xb7, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfb, 
-  0x00, 0xc8, 0x00, 0xe0, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x72, 0xd4, 0x72, 0xff, 0xca, 0xed, 0xca, 0xff, 0x18, 0xc9, 0x18, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfb, 
-  0x00, 0xc8, 0x01, 0xa0, 0x00, 0xc8, 0x00, 0xff, 0x6d, 0xd3, 0x6d, 0xff, 0xce, 0xef, 0xce, 0xff, 0x2e, 0xcd, 0x2e, 0xff, 0x13, 0xca, 0x13, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xbc, 
-  0x00, 0xc8, 0x02, 0x1f, 0x00, 0xc8, 0x00, 0xe8, 0x8f, 0xda, 0x8f, 0xff, 0xc6, 0xe9, 0xc6, 0xff, 0xc7, 0xea, 0xc7, 0xff, 0xb0, 0xe3, 0xb0, 0xff, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x01, 0x30, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x23, 0x00, 0xc8, 0x01, 0xab, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x01, 0xb7, 0x00, 0xc8, 0x01, 0x2f, 0x00, 0x89, 0x01, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x23, 0x00, 0xc8, 0x01, 0xab, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x01, 0xb7, 0x00, 0xc8, 0x01, 
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x1f, 0x00, 0xc8, 0x00, 0xe8, 0x88, 0xd9, 0x88, 0xff, 0xc3, 0xeb, 0xc3, 0xff, 0xc8, 0xec, 0xc8, 0xff, 0x72, 0xd4, 0x72, 0xff, 0x00, 0xc8, 0x00, 
+  0xf4, 0x00, 0xc8, 0x01, 0x30, 0x00, 0xc8, 0x01, 0xa0, 0x00, 0xc8, 0x00, 0xff, 0x3f, 0xcc, 0x3f, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x3c, 0xcc, 0x3c, 0xff, 0xd8, 0xf1, 0xd8, 0xff, 0x00, 0xc8, 0x00, 
+  0xff, 0x00, 0xc8, 0x01, 0xbc, 0x00, 0xc8, 0x00, 0xe0, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x04, 0x85, 0xd8, 0x85, 0xff, 0xb7, 0xe6, 0xb7, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfb, 0x00, 
+  0xc8, 0x00, 0xe0, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x1c, 0x72, 0xd4, 0x72, 0xff, 0xca, 0xed, 0xca, 0xff, 0x18, 0xc9, 0x18, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfb, 0x00, 0xc8, 0x01, 
+  0xa0, 0x00, 0xc8, 0x00, 0xff, 0x6d, 0xd3, 0x6d, 0xff, 0xce, 0xef, 0xce, 0xff, 0x2e, 0xcd, 0x2e, 0xff, 0x13, 0xca, 0x13, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x01, 0xbc, 0x00, 0xc8, 0x02, 
+  0x1f, 0x00, 0xc8, 0x00, 0xe8, 0x8f, 0xda, 0x8f, 0xff, 0xc6, 0xe9, 0xc6, 0xff, 0xc7, 0xea, 0xc7, 0xff, 0xb0, 0xe3, 0xb0, 0xff, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x01, 0x30, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xc8, 0x02, 0x23, 0x00, 0xc8, 0x01, 0xab, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xc8, 0x01, 0xb7, 0x00, 0xc8, 0x01, 0x2f, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -58,8 +52,7 @@ const lv_img_dsc_t info_2_8px = {
   .header.always_zero = 0,
   .header.w = 8,
   .header.h = 8,
-  .data_size = 64 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_2_8px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_2_8px_map,
 };
-
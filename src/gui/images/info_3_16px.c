@@ -10,79 +10,81 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_3_16PX uint8_t info_3_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x2b, 0x18, 0x8f, 0x18, 0xd3, 0x18, 0xf7, 0x18, 0xfb, 0x18, 0xd8, 0x18, 0x98, 0x18, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0c, 0x00, 0x18, 0x04, 0x18, 0x8c, 0x18, 0xfc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xa3, 0x18, 0x0c, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0x04, 0x18, 0xb3, 0x18, 0xff, 0x18, 0xff, 0x39, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xcb, 0x18, 0x0c, 0x00, 0x00, 
-  0x18, 0x00, 0x18, 0x84, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xa7, 0x18, 0x00, 
-  0x18, 0x20, 0x18, 0xfb, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x59, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x3c, 
-  0x18, 0x80, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x9f, 
-  0x18, 0xc0, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x38, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xe3, 
-  0x18, 0xe3, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 
-  0x18, 0xe3, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x39, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 
-  0x18, 0xc0, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xe3, 
-  0x18, 0x80, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x9f, 
-  0x18, 0x20, 0x18, 0xfb, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x7e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x3c, 
-  0x18, 0x00, 0x18, 0x84, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xa7, 0x18, 0x00, 
-  0x00, 0x00, 0x18, 0x04, 0x18, 0xb3, 0x18, 0xff, 0x18, 0xff, 0x59, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0xbe, 0xff, 0x7e, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xcb, 0x18, 0x0c, 0x00, 0x00, 
-  0x00, 0x00, 0x0c, 0x00, 0x18, 0x04, 0x18, 0x8b, 0x18, 0xfc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xa3, 0x18, 0x0c, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x2b, 0x18, 0x8f, 0x18, 0xd3, 0x18, 0xf7, 0x18, 0xf8, 0x18, 0xd8, 0x18, 0x98, 0x18, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x07, 0x18, 0x2b, 0x18, 0x8f, 0x18, 0xd3, 0x18, 0xf7, 0x18, 0xfb, 0x18, 0xd8, 0x18, 0x98, 0x18, 0x38, 0x85, 0x00, 0x00, 0x02, 0x18, 0x04, 0x18, 0x8c, 
+  0x18, 0xfc, 0x86, 0x18, 0xff, 0x01, 0x18, 0xa3, 0x18, 0x0c, 0x82, 0x00, 0x00, 0x01, 0x18, 0x04, 0x18, 0xb3, 0x81, 0x18, 0xff, 0x04, 0x39, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xbf, 0xff, 0x9e, 0xff, 
+  0x82, 0x18, 0xff, 0x01, 0x18, 0xcb, 0x18, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x18, 0x84, 0x82, 0x18, 0xff, 0x85, 0xff, 0xff, 0x00, 0x59, 0xff, 0x81, 0x18, 0xff, 0x03, 0x18, 0xa7, 0x00, 0x00, 0x18, 
+  0x20, 0x18, 0xfb, 0x82, 0x18, 0xff, 0x00, 0x59, 0xff, 0x82, 0x18, 0xff, 0x02, 0x7d, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x82, 0x18, 0xff, 0x01, 0x18, 0x3c, 0x18, 0x80, 0x88, 0x18, 0xff, 0x01, 0xff, 
+  0xff, 0xdf, 0xff, 0x82, 0x18, 0xff, 0x01, 0x18, 0x9f, 0x18, 0xc0, 0x86, 0x18, 0xff, 0x03, 0x38, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x82, 0x18, 0xff, 0x81, 0x18, 0xe3, 0x84, 0x18, 0xff, 
+  0x00, 0x7d, 0xff, 0x82, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x84, 0x18, 0xff, 0x00, 0x18, 0xe3, 0x84, 0x18, 0xff, 0x00, 0x39, 0xff, 0x81, 0x9e, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x83, 
+  0x18, 0xff, 0x00, 0x18, 0xc0, 0x88, 0x18, 0xff, 0x81, 0xff, 0xff, 0x82, 0x18, 0xff, 0x01, 0x18, 0xe3, 0x18, 0x80, 0x88, 0x18, 0xff, 0x01, 0xdf, 0xff, 0xff, 0xff, 0x82, 0x18, 0xff, 0x02, 0x18, 
+  0x9f, 0x18, 0x20, 0x18, 0xfb, 0x82, 0x18, 0xff, 0x00, 0x7e, 0xff, 0x82, 0x18, 0xff, 0x02, 0x7d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x82, 0x18, 0xff, 0x02, 0x18, 0x3c, 0x00, 0x00, 0x18, 0x84, 0x82, 
+  0x18, 0xff, 0x85, 0xff, 0xff, 0x00, 0x59, 0xff, 0x81, 0x18, 0xff, 0x00, 0x18, 0xa7, 0x81, 0x00, 0x00, 0x01, 0x18, 0x04, 0x18, 0xb3, 0x81, 0x18, 0xff, 0x04, 0x59, 0xff, 0x9e, 0xff, 0xbf, 0xff, 
+  0xbe, 0xff, 0x7e, 0xff, 0x82, 0x18, 0xff, 0x01, 0x18, 0xcb, 0x18, 0x0c, 0x82, 0x00, 0x00, 0x02, 0x18, 0x04, 0x18, 0x8b, 0x18, 0xfc, 0x86, 0x18, 0xff, 0x01, 0x18, 0xa3, 0x18, 0x0c, 0x85, 0x00, 
+  0x00, 0x07, 0x18, 0x2b, 0x18, 0x8f, 0x18, 0xd3, 0x18, 0xf7, 0x18, 0xf8, 0x18, 0xd8, 0x18, 0x98, 0x18, 0x37, 0x83, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x2b, 0x40, 0x06, 0x8f, 0x40, 0x06, 0xd3, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xd8, 0x40, 0x06, 0x98, 0x40, 0x06, 0x38, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x40, 0x06, 0x04, 0x40, 0x06, 0x8c, 0x40, 0x06, 0xfc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xa3, 0x20, 0x06, 0x0c, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x04, 0x40, 0x06, 0xb3, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x45, 0x2e, 0xff, 0xcf, 0x7e, 0xff, 0x14, 0xa7, 0xff, 0x14, 0xa7, 0xff, 0xaf, 0x7e, 0xff, 0x42, 0x16, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xcb, 0x40, 0x06, 0x0c, 0x00, 0x00, 0x00, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x84, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x9b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0xff, 0xbc, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0xff, 0x67, 0x3e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xa7, 0x40, 0x06, 0x00, 
-  0x40, 0x06, 0x20, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x89, 0x4e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x8c, 0x66, 0xff, 0xff, 0xff, 0xff, 0x36, 0xb7, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x3c, 
-  0x40, 0x06, 0x80, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xbc, 0xe7, 0xff, 0x58, 0xc7, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x9f, 
-  0x40, 0x06, 0xc0, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x42, 0x16, 0xff, 0x43, 0x1e, 0xff, 0xd0, 0x86, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x86, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xe3, 
-  0x40, 0x06, 0xe3, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xab, 0x5e, 0xff, 0xfe, 0xf7, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x13, 0x9f, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 
-  0x40, 0x06, 0xe3, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x64, 0x26, 0xff, 0xae, 0x76, 0xff, 0xd1, 0x8e, 0xff, 0x58, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x86, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 
-  0x40, 0x06, 0xc0, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x9a, 0xd7, 0xff, 0xbb, 0xdf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xe3, 
-  0x40, 0x06, 0x80, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x58, 0xc7, 0xff, 0xdc, 0xe7, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x9f, 
-  0x40, 0x06, 0x20, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xad, 0x6e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x8b, 0x5e, 0xff, 0xfe, 0xf7, 0xff, 0x78, 0xc7, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x3c, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x84, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xff, 0xbc, 0xe7, 0xff, 0xbc, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0xff, 0x68, 0x46, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xa7, 0x60, 0x06, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x04, 0x40, 0x06, 0xb3, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x67, 0x3e, 0xff, 0xf2, 0x96, 0xff, 0x14, 0xa7, 0xff, 0x14, 0xa7, 0xff, 0xad, 0x6e, 0xff, 0x41, 0x0e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xcb, 0x40, 0x06, 0x0c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x40, 0x06, 0x04, 0x40, 0x06, 0x8b, 0x40, 0x06, 0xfc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xa3, 0x40, 0x06, 0x0c, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x40, 0x06, 0x2b, 0x40, 0x06, 0x8f, 0x40, 0x06, 0xd3, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xd8, 0x40, 0x06, 0x98, 0x40, 0x06, 0x37, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0x40, 0x06, 0x2b, 0x40, 0x06, 0x8f, 0x40, 0x06, 0xd3, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xfb, 0x40, 0x06, 0xd8, 0x40, 0x06, 0x98, 0x40, 0x06, 
+  0x38, 0x85, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x04, 0x40, 0x06, 0x8c, 0x40, 0x06, 0xfc, 0x86, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xa3, 0x20, 0x06, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x01, 0x40, 
+  0x06, 0x04, 0x40, 0x06, 0xb3, 0x81, 0x40, 0x06, 0xff, 0x01, 0x45, 0x2e, 0xff, 0xcf, 0x7e, 0xff, 0x81, 0x14, 0xa7, 0xff, 0x01, 0xaf, 0x7e, 0xff, 0x42, 0x16, 0xff, 0x81, 0x40, 0x06, 0xff, 0x01, 
+  0x40, 0x06, 0xcb, 0x40, 0x06, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x84, 0x82, 0x40, 0x06, 0xff, 0x01, 0x9b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x81, 0xbc, 0xe7, 0xff, 0x02, 0xff, 0xff, 
+  0xff, 0xbc, 0xe7, 0xff, 0x67, 0x3e, 0xff, 0x81, 0x40, 0x06, 0xff, 0x03, 0x40, 0x06, 0xa7, 0x00, 0x00, 0x00, 0x40, 0x06, 0x20, 0x40, 0x06, 0xfb, 0x82, 0x40, 0x06, 0xff, 0x00, 0x89, 0x4e, 0xff, 
+  0x82, 0x40, 0x06, 0xff, 0x02, 0x8c, 0x66, 0xff, 0xff, 0xff, 0xff, 0x36, 0xb7, 0xff, 0x82, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x3c, 0x40, 0x06, 0x80, 0x88, 0x40, 0x06, 0xff, 0x01, 0xbc, 0xe7, 
+  0xff, 0x58, 0xc7, 0xff, 0x82, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x9f, 0x40, 0x06, 0xc0, 0x85, 0x40, 0x06, 0xff, 0x04, 0x42, 0x16, 0xff, 0x43, 0x1e, 0xff, 0xd0, 0x86, 0xff, 0xff, 0xff, 0xff, 
+  0xd0, 0x86, 0xff, 0x82, 0x40, 0x06, 0xff, 0x81, 0x40, 0x06, 0xe3, 0x84, 0x40, 0x06, 0xff, 0x00, 0xab, 0x5e, 0xff, 0x81, 0xfe, 0xf7, 0xff, 0x01, 0xff, 0xff, 0xff, 0x13, 0x9f, 0xff, 0x84, 0x40, 
+  0x06, 0xff, 0x00, 0x40, 0x06, 0xe3, 0x84, 0x40, 0x06, 0xff, 0x05, 0x64, 0x26, 0xff, 0xae, 0x76, 0xff, 0xd1, 0x8e, 0xff, 0x58, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x86, 0xff, 0x83, 0x40, 0x06, 
+  0xff, 0x00, 0x40, 0x06, 0xc0, 0x88, 0x40, 0x06, 0xff, 0x01, 0x9a, 0xd7, 0xff, 0xbb, 0xdf, 0xff, 0x82, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xe3, 0x40, 0x06, 0x80, 0x88, 0x40, 0x06, 0xff, 0x01, 
+  0x58, 0xc7, 0xff, 0xdc, 0xe7, 0xff, 0x82, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0x9f, 0x40, 0x06, 0x20, 0x40, 0x06, 0xfb, 0x82, 0x40, 0x06, 0xff, 0x00, 0xad, 0x6e, 0xff, 0x82, 0x40, 0x06, 0xff, 
+  0x02, 0x8b, 0x5e, 0xff, 0xfe, 0xf7, 0xff, 0x78, 0xc7, 0xff, 0x82, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0x3c, 0x00, 0x00, 0x00, 0x40, 0x06, 0x84, 0x82, 0x40, 0x06, 0xff, 0x01, 0xff, 0xff, 0xff, 
+  0xdd, 0xef, 0xff, 0x81, 0xbc, 0xe7, 0xff, 0x02, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0xff, 0x68, 0x46, 0xff, 0x81, 0x40, 0x06, 0xff, 0x00, 0x40, 0x06, 0xa7, 0x81, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 
+  0x04, 0x40, 0x06, 0xb3, 0x81, 0x40, 0x06, 0xff, 0x01, 0x67, 0x3e, 0xff, 0xf2, 0x96, 0xff, 0x81, 0x14, 0xa7, 0xff, 0x01, 0xad, 0x6e, 0xff, 0x41, 0x0e, 0xff, 0x81, 0x40, 0x06, 0xff, 0x01, 0x40, 
+  0x06, 0xcb, 0x40, 0x06, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x04, 0x40, 0x06, 0x8b, 0x40, 0x06, 0xfc, 0x86, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xa3, 0x40, 0x06, 0x0c, 0x85, 0x00, 
+  0x00, 0x00, 0x07, 0x40, 0x06, 0x2b, 0x40, 0x06, 0x8f, 0x40, 0x06, 0xd3, 0x40, 0x06, 0xf7, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xd8, 0x40, 0x06, 0x98, 0x40, 0x06, 0x37, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x2b, 0x06, 0x40, 0x8f, 0x06, 0x40, 0xd3, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xd8, 0x06, 0x40, 0x98, 0x06, 0x40, 0x38, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0xe0, 0x00, 0x06, 0x40, 0x04, 0x06, 0x40, 0x8c, 0x06, 0x40, 0xfc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xa3, 0x06, 0x20, 0x0c, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x04, 0x06, 0x40, 0xb3, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x2e, 0x45, 0xff, 0x7e, 0xcf, 0xff, 0xa7, 0x14, 0xff, 0xa7, 0x14, 0xff, 0x7e, 0xaf, 0xff, 0x16, 0x42, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xcb, 0x06, 0x40, 0x0c, 0x00, 0x00, 0x00, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x84, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xdf, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbc, 0xff, 0xe7, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbc, 0xff, 0x3e, 0x67, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xa7, 0x06, 0x40, 0x00, 
-  0x06, 0x40, 0x20, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x4e, 0x89, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x66, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x36, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x3c, 
-  0x06, 0x40, 0x80, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xe7, 0xbc, 0xff, 0xc7, 0x58, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x9f, 
-  0x06, 0x40, 0xc0, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x16, 0x42, 0xff, 0x1e, 0x43, 0xff, 0x86, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x86, 0xd0, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xe3, 
-  0x06, 0x40, 0xe3, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x5e, 0xab, 0xff, 0xf7, 0xfe, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x13, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 
-  0x06, 0x40, 0xe3, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x26, 0x64, 0xff, 0x76, 0xae, 0xff, 0x8e, 0xd1, 0xff, 0xc7, 0x58, 0xff, 0xff, 0xff, 0xff, 0x86, 0xd0, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 
-  0x06, 0x40, 0xc0, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xd7, 0x9a, 0xff, 0xdf, 0xbb, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xe3, 
-  0x06, 0x40, 0x80, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xc7, 0x58, 0xff, 0xe7, 0xdc, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x9f, 
-  0x06, 0x40, 0x20, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x6e, 0xad, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x5e, 0x8b, 0xff, 0xf7, 0xfe, 0xff, 0xc7, 0x78, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x3c, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x84, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xe7, 0xbc, 0xff, 0xe7, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbc, 0xff, 0x46, 0x68, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xa7, 0x06, 0x60, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x04, 0x06, 0x40, 0xb3, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x3e, 0x67, 0xff, 0x96, 0xf2, 0xff, 0xa7, 0x14, 0xff, 0xa7, 0x14, 0xff, 0x6e, 0xad, 0xff, 0x0e, 0x41, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xcb, 0x06, 0x40, 0x0c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0xe0, 0x00, 0x06, 0x40, 0x04, 0x06, 0x40, 0x8b, 0x06, 0x40, 0xfc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xa3, 0x06, 0x40, 0x0c, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20, 0x00, 0x06, 0x40, 0x2b, 0x06, 0x40, 0x8f, 0x06, 0x40, 0xd3, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xd8, 0x06, 0x40, 0x98, 0x06, 0x40, 0x37, 0x06, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0x06, 0x40, 0x2b, 0x06, 0x40, 0x8f, 0x06, 0x40, 0xd3, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xfb, 0x06, 0x40, 0xd8, 0x06, 0x40, 0x98, 0x06, 0x40, 
+  0x38, 0x85, 0x00, 0x00, 0x00, 0x02, 0x06, 0x40, 0x04, 0x06, 0x40, 0x8c, 0x06, 0x40, 0xfc, 0x86, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xa3, 0x06, 0x20, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x01, 0x06, 
+  0x40, 0x04, 0x06, 0x40, 0xb3, 0x81, 0x06, 0x40, 0xff, 0x01, 0x2e, 0x45, 0xff, 0x7e, 0xcf, 0xff, 0x81, 0xa7, 0x14, 0xff, 0x01, 0x7e, 0xaf, 0xff, 0x16, 0x42, 0xff, 0x81, 0x06, 0x40, 0xff, 0x01, 
+  0x06, 0x40, 0xcb, 0x06, 0x40, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x84, 0x82, 0x06, 0x40, 0xff, 0x01, 0xdf, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x81, 0xe7, 0xbc, 0xff, 0x02, 0xff, 0xff, 
+  0xff, 0xe7, 0xbc, 0xff, 0x3e, 0x67, 0xff, 0x81, 0x06, 0x40, 0xff, 0x03, 0x06, 0x40, 0xa7, 0x00, 0x00, 0x00, 0x06, 0x40, 0x20, 0x06, 0x40, 0xfb, 0x82, 0x06, 0x40, 0xff, 0x00, 0x4e, 0x89, 0xff, 
+  0x82, 0x06, 0x40, 0xff, 0x02, 0x66, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x36, 0xff, 0x82, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x3c, 0x06, 0x40, 0x80, 0x88, 0x06, 0x40, 0xff, 0x01, 0xe7, 0xbc, 
+  0xff, 0xc7, 0x58, 0xff, 0x82, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x9f, 0x06, 0x40, 0xc0, 0x85, 0x06, 0x40, 0xff, 0x04, 0x16, 0x42, 0xff, 0x1e, 0x43, 0xff, 0x86, 0xd0, 0xff, 0xff, 0xff, 0xff, 
+  0x86, 0xd0, 0xff, 0x82, 0x06, 0x40, 0xff, 0x81, 0x06, 0x40, 0xe3, 0x84, 0x06, 0x40, 0xff, 0x00, 0x5e, 0xab, 0xff, 0x81, 0xf7, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xff, 0x9f, 0x13, 0xff, 0x84, 0x06, 
+  0x40, 0xff, 0x00, 0x06, 0x40, 0xe3, 0x84, 0x06, 0x40, 0xff, 0x05, 0x26, 0x64, 0xff, 0x76, 0xae, 0xff, 0x8e, 0xd1, 0xff, 0xc7, 0x58, 0xff, 0xff, 0xff, 0xff, 0x86, 0xd0, 0xff, 0x83, 0x06, 0x40, 
+  0xff, 0x00, 0x06, 0x40, 0xc0, 0x88, 0x06, 0x40, 0xff, 0x01, 0xd7, 0x9a, 0xff, 0xdf, 0xbb, 0xff, 0x82, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xe3, 0x06, 0x40, 0x80, 0x88, 0x06, 0x40, 0xff, 0x01, 
+  0xc7, 0x58, 0xff, 0xe7, 0xdc, 0xff, 0x82, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0x9f, 0x06, 0x40, 0x20, 0x06, 0x40, 0xfb, 0x82, 0x06, 0x40, 0xff, 0x00, 0x6e, 0xad, 0xff, 0x82, 0x06, 0x40, 0xff, 
+  0x02, 0x5e, 0x8b, 0xff, 0xf7, 0xfe, 0xff, 0xc7, 0x78, 0xff, 0x82, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0x3c, 0x00, 0x00, 0x00, 0x06, 0x40, 0x84, 0x82, 0x06, 0x40, 0xff, 0x01, 0xff, 0xff, 0xff, 
+  0xef, 0xdd, 0xff, 0x81, 0xe7, 0xbc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xe7, 0xbc, 0xff, 0x46, 0x68, 0xff, 0x81, 0x06, 0x40, 0xff, 0x00, 0x06, 0x40, 0xa7, 0x81, 0x00, 0x00, 0x00, 0x01, 0x06, 0x40, 
+  0x04, 0x06, 0x40, 0xb3, 0x81, 0x06, 0x40, 0xff, 0x01, 0x3e, 0x67, 0xff, 0x96, 0xf2, 0xff, 0x81, 0xa7, 0x14, 0xff, 0x01, 0x6e, 0xad, 0xff, 0x0e, 0x41, 0xff, 0x81, 0x06, 0x40, 0xff, 0x01, 0x06, 
+  0x40, 0xcb, 0x06, 0x40, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x02, 0x06, 0x40, 0x04, 0x06, 0x40, 0x8b, 0x06, 0x40, 0xfc, 0x86, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xa3, 0x06, 0x40, 0x0c, 0x85, 0x00, 
+  0x00, 0x00, 0x07, 0x06, 0x40, 0x2b, 0x06, 0x40, 0x8f, 0x06, 0x40, 0xd3, 0x06, 0x40, 0xf7, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xd8, 0x06, 0x40, 0x98, 0x06, 0x40, 0x37, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0x8f, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xc8, 0x00, 0xf7, 0x00, 0xc8, 0x00, 0xfb, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0xc8, 0x00, 0x98, 0x00, 0xc8, 0x00, 0x38, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x8c, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xa3, 0x00, 0xc6, 0x00, 0x0c, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x04, 0x00, 0xc8, 0x00, 0xb3, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x27, 0xca, 0x27, 0xff, 0x7a, 0xd7, 0x7a, 0xff, 0xa0, 0xe0, 0xa0, 0xff, 0xa1, 0xe1, 0xa1, 0xff, 0x78, 0xd6, 0x78, 0xff, 0x0d, 0xc9, 0x0d, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xcb, 0x00, 0xc8, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xca, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xd6, 0xf1, 0xd6, 0xff, 0xf5, 0xfc, 0xf5, 0xff, 0xde, 0xf4, 0xde, 0xff, 0xdf, 0xf5, 0xdf, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xde, 0xf4, 0xde, 0xff, 0x3b, 0xcc, 0x3b, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xa7, 0x00, 0xc8, 0x00, 0x00, 
-  0x00, 0xc8, 0x00, 0x20, 0x00, 0xc8, 0x00, 0xfb, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x4c, 0xd0, 0x4c, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x5e, 0xd2, 0x5e, 0xff, 0xf9, 0xfd, 0xf9, 0xff, 0xaf, 0xe4, 0xaf, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x3c, 
-  0x00, 0xc8, 0x00, 0x80, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc7, 0x00, 0xff, 0xe4, 0xf6, 0xe4, 0xff, 0xbf, 0xea, 0xbf, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x9f, 
-  0x00, 0xc8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x02, 0xc8, 0x02, 0xff, 0x10, 0xc9, 0x10, 0xff, 0x1b, 0xc9, 0x1b, 0xff, 0x83, 0xda, 0x83, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x84, 0xd9, 0x84, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xe3, 
-  0x00, 0xc8, 0x00, 0xe3, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x55, 0xd3, 0x55, 0xff, 0xf0, 0xfb, 0xf0, 0xff, 0xf3, 0xfc, 0xf3, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0x95, 0xdf, 0x95, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 
-  0x00, 0xc8, 0x00, 0xe3, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x24, 0xcb, 0x24, 0xff, 0x71, 0xd5, 0x71, 0xff, 0x88, 0xd9, 0x88, 0xff, 0xbf, 0xea, 0xbf, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x83, 0xd9, 0x83, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 
-  0x00, 0xc8, 0x00, 0xc0, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xd3, 0xf0, 0xd3, 0xff, 0xdb, 0xf3, 0xdb, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xe3, 
-  0x00, 0xc8, 0x00, 0x80, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xc4, 0xea, 0xc4, 0xff, 0xe2, 0xf7, 0xe2, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x9f, 
-  0x00, 0xc8, 0x00, 0x20, 0x00, 0xc8, 0x00, 0xfb, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x01, 0xc9, 0x01, 0xff, 0x66, 0xd4, 0x66, 0xff, 0x00, 0xc7, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x5b, 0xd1, 0x5b, 0xff, 0xf1, 0xfb, 0xf1, 0xff, 0xc4, 0xeb, 0xc4, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x3c, 
-  0x00, 0xc9, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xca, 0x00, 0xff, 0xfb, 0xfe, 0xfb, 0xff, 0xea, 0xf9, 0xea, 0xff, 0xdd, 0xf3, 0xdd, 0xff, 0xe0, 0xf5, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf4, 0xdd, 0xff, 0x40, 0xcd, 0x40, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xa7, 0x00, 0xcb, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x04, 0x00, 0xc8, 0x00, 0xb3, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x39, 0xcd, 0x39, 0xff, 0x90, 0xdb, 0x90, 0xff, 0xa3, 0xe2, 0xa3, 0xff, 0xa0, 0xe0, 0xa0, 0xff, 0x6c, 0xd4, 0x6c, 0xff, 0x0a, 0xc8, 0x0a, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xcb, 0x00, 0xc8, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x8b, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xa3, 0x00, 0xc8, 0x00, 0x0c, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0x8f, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xc8, 0x00, 0xf7, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0xc8, 0x00, 0x98, 0x00, 0xc8, 0x00, 0x37, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc8, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0x8f, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xc8, 0x00, 0xf7, 0x00, 0xc8, 0x00, 0xfb, 0x00, 0xc8, 
+  0x00, 0xd8, 0x00, 0xc8, 0x00, 0x98, 0x00, 0xc8, 0x00, 0x38, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x8c, 0x00, 0xc8, 0x00, 0xfc, 0x86, 0x00, 0xc8, 0x00, 
+  0xff, 0x01, 0x00, 0xc8, 0x00, 0xa3, 0x00, 0xc6, 0x00, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc7, 0x00, 0x04, 0x00, 0xc8, 0x00, 0xb3, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x05, 0x27, 0xca, 
+  0x27, 0xff, 0x7a, 0xd7, 0x7a, 0xff, 0xa0, 0xe0, 0xa0, 0xff, 0xa1, 0xe1, 0xa1, 0xff, 0x78, 0xd6, 0x78, 0xff, 0x0d, 0xc9, 0x0d, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xcb, 
+  0x00, 0xc8, 0x00, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x84, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x06, 0xd6, 0xf1, 0xd6, 0xff, 0xf5, 0xfc, 0xf5, 0xff, 0xde, 0xf4, 0xde, 0xff, 
+  0xdf, 0xf5, 0xdf, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xde, 0xf4, 0xde, 0xff, 0x3b, 0xcc, 0x3b, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x03, 0x00, 0xc8, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 
+  0x00, 0x20, 0x00, 0xc8, 0x00, 0xfb, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x00, 0x4c, 0xd0, 0x4c, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x5e, 0xd2, 0x5e, 0xff, 0xf9, 0xfd, 0xf9, 0xff, 0xaf, 0xe4, 
+  0xaf, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0x3c, 0x00, 0xc8, 0x00, 0x80, 0x87, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc7, 0x00, 0xff, 0xe4, 0xf6, 0xe4, 0xff, 0xbf, 0xea, 
+  0xbf, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0x9f, 0x00, 0xc8, 0x00, 0xc0, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x05, 0x02, 0xc8, 0x02, 0xff, 0x10, 0xc9, 0x10, 0xff, 0x1b, 0xc9, 
+  0x1b, 0xff, 0x83, 0xda, 0x83, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x84, 0xd9, 0x84, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xe3, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x04, 0x55, 0xd3, 
+  0x55, 0xff, 0xf0, 0xfb, 0xf0, 0xff, 0xf3, 0xfc, 0xf3, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0x95, 0xdf, 0x95, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x00, 0x00, 0xc8, 0x00, 0xe3, 0x84, 0x00, 0xc8, 0x00, 
+  0xff, 0x05, 0x24, 0xcb, 0x24, 0xff, 0x71, 0xd5, 0x71, 0xff, 0x88, 0xd9, 0x88, 0xff, 0xbf, 0xea, 0xbf, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x83, 0xd9, 0x83, 0xff, 0x83, 0x00, 0xc8, 0x00, 0xff, 0x00, 
+  0x00, 0xc8, 0x00, 0xc0, 0x88, 0x00, 0xc8, 0x00, 0xff, 0x01, 0xd3, 0xf0, 0xd3, 0xff, 0xdb, 0xf3, 0xdb, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xe3, 0x00, 0xc8, 0x00, 0x80, 
+  0x88, 0x00, 0xc8, 0x00, 0xff, 0x01, 0xc4, 0xea, 0xc4, 0xff, 0xe2, 0xf7, 0xe2, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0x9f, 0x00, 0xc8, 0x00, 0x20, 0x00, 0xc8, 0x00, 0xfb, 
+  0x81, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x01, 0xc9, 0x01, 0xff, 0x66, 0xd4, 0x66, 0xff, 0x00, 0xc7, 0x00, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x5b, 0xd1, 0x5b, 0xff, 0xf1, 0xfb, 0xf1, 0xff, 
+  0xc4, 0xeb, 0xc4, 0xff, 0x82, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x84, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x07, 0x00, 0xca, 0x00, 0xff, 
+  0xfb, 0xfe, 0xfb, 0xff, 0xea, 0xf9, 0xea, 0xff, 0xdd, 0xf3, 0xdd, 0xff, 0xe0, 0xf5, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf4, 0xdd, 0xff, 0x40, 0xcd, 0x40, 0xff, 0x81, 0x00, 0xc8, 0x00, 
+  0xff, 0x00, 0x00, 0xc8, 0x00, 0xa7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x04, 0x00, 0xc8, 0x00, 0xb3, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x05, 0x39, 0xcd, 0x39, 0xff, 0x90, 0xdb, 
+  0x90, 0xff, 0xa3, 0xe2, 0xa3, 0xff, 0xa0, 0xe0, 0xa0, 0xff, 0x6c, 0xd4, 0x6c, 0xff, 0x0a, 0xc8, 0x0a, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xcb, 0x00, 0xc8, 0x00, 0x0c, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc7, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x8b, 0x00, 0xc8, 0x00, 0xfc, 0x86, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xa3, 0x00, 0xc8, 0x00, 0x0c, 
+  0x85, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc9, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0x8f, 0x00, 0xc8, 0x00, 0xd3, 0x00, 0xc8, 0x00, 0xf7, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0xc8, 
+  0x00, 0x98, 0x00, 0xc8, 0x00, 0x37, 0x83, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +92,7 @@ const lv_img_dsc_t info_3_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_3_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_3_16px_map,
 };
-
@@ -10,79 +10,53 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_FAIL_16PX uint8_t info_fail_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x38, 0xe0, 0x98, 0xe0, 0xd8, 0xe0, 0xfb, 0xe0, 0xf7, 0xe0, 0xd3, 0xe0, 0x8f, 0xe0, 0x2b, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe0, 0x00, 0xe0, 0x0c, 0xe0, 0xa4, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfc, 0xe0, 0x8b, 0xe0, 0x04, 0x60, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe0, 0x0c, 0xe0, 0xcb, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xb3, 0xe0, 0x04, 0x00, 0x00, 
-  0xe0, 0x00, 0xe0, 0xa8, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x84, 0xe0, 0x00, 
-  0xe0, 0x3c, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfb, 0xe0, 0x20, 
-  0xe0, 0xa0, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x80, 
-  0xe0, 0xe3, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xc0, 
-  0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 
-  0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 
-  0xe0, 0xe3, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xc0, 
-  0xe0, 0xa0, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x80, 
-  0xe0, 0x3c, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfb, 0xe0, 0x20, 
-  0xe0, 0x00, 0xe0, 0xa7, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x83, 0xe0, 0x00, 
-  0x00, 0x00, 0xe0, 0x0c, 0xe0, 0xcb, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xb3, 0xe0, 0x04, 0x00, 0x00, 
-  0x00, 0x00, 0xe0, 0x00, 0xe0, 0x0b, 0xe0, 0xa3, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfc, 0xe0, 0x8b, 0xe0, 0x04, 0x60, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x38, 0xe0, 0x98, 0xe0, 0xd8, 0xe0, 0xfb, 0xe0, 0xf7, 0xe0, 0xd3, 0xe0, 0x8f, 0xe0, 0x28, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x07, 0xe0, 0x38, 0xe0, 0x98, 0xe0, 0xd8, 0xe0, 0xfb, 0xe0, 0xf7, 0xe0, 0xd3, 0xe0, 0x8f, 0xe0, 0x2b, 0x85, 0x00, 0x00, 0x01, 0xe0, 0x0c, 0xe0, 0xa4, 
+  0x86, 0xe0, 0xff, 0x02, 0xe0, 0xfc, 0xe0, 0x8b, 0xe0, 0x04, 0x82, 0x00, 0x00, 0x01, 0xe0, 0x0c, 0xe0, 0xcb, 0x89, 0xe0, 0xff, 0x01, 0xe0, 0xb3, 0xe0, 0x04, 0x81, 0x00, 0x00, 0x00, 0xe0, 0xa8, 
+  0x8b, 0xe0, 0xff, 0x02, 0xe0, 0x84, 0x00, 0x00, 0xe0, 0x3c, 0x8c, 0xe0, 0xff, 0x02, 0xe0, 0xfb, 0xe0, 0x20, 0xe0, 0xa0, 0x8d, 0xe0, 0xff, 0x01, 0xe0, 0x80, 0xe0, 0xe3, 0x8d, 0xe0, 0xff, 0x00, 
+  0xe0, 0xc0, 0x8e, 0xe0, 0xff, 0x00, 0xe0, 0xe0, 0x8e, 0xe0, 0xff, 0x01, 0xe0, 0xe0, 0xe0, 0xe3, 0x8d, 0xe0, 0xff, 0x01, 0xe0, 0xc0, 0xe0, 0xa0, 0x8d, 0xe0, 0xff, 0x01, 0xe0, 0x80, 0xe0, 0x3c, 
+  0x8c, 0xe0, 0xff, 0x03, 0xe0, 0xfb, 0xe0, 0x20, 0x00, 0x00, 0xe0, 0xa7, 0x8b, 0xe0, 0xff, 0x00, 0xe0, 0x83, 0x81, 0x00, 0x00, 0x01, 0xe0, 0x0c, 0xe0, 0xcb, 0x89, 0xe0, 0xff, 0x01, 0xe0, 0xb3, 
+  0xe0, 0x04, 0x82, 0x00, 0x00, 0x01, 0xe0, 0x0b, 0xe0, 0xa3, 0x86, 0xe0, 0xff, 0x02, 0xe0, 0xfc, 0xe0, 0x8b, 0xe0, 0x04, 0x85, 0x00, 0x00, 0x07, 0xe0, 0x38, 0xe0, 0x98, 0xe0, 0xd8, 0xe0, 0xfb, 
+  0xe0, 0xf7, 0xe0, 0xd3, 0xe0, 0x8f, 0xe0, 0x28, 0x83, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x38, 0x00, 0xf8, 0x98, 0x00, 0xf8, 0xd8, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0xf7, 0x00, 0xf8, 0xd3, 0x00, 0xf8, 0x8f, 0x00, 0xf8, 0x2b, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x0c, 0x00, 0xf8, 0xa4, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0xf8, 0x8b, 0x00, 0xf8, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0x00, 0xf8, 0xcb, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xb3, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0xf8, 0x00, 0x00, 0xf8, 0xa8, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0x84, 0x00, 0xf8, 0x00, 
-  0x00, 0xf8, 0x3c, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0x20, 
-  0x00, 0xf8, 0xa0, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0x80, 
-  0x00, 0xf8, 0xe3, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xc0, 
-  0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xe0, 
-  0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xe0, 
-  0x00, 0xf8, 0xe3, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xc0, 
-  0x00, 0xf8, 0xa0, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0x80, 
-  0x00, 0xf8, 0x3c, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0x20, 
-  0x00, 0xf8, 0x00, 0x00, 0xf8, 0xa7, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0x83, 0x00, 0xf8, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0x0c, 0x00, 0xf8, 0xcb, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xb3, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0xf8, 0xa3, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0xf8, 0x8b, 0x00, 0xf8, 0x04, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x38, 0x00, 0xf8, 0x98, 0x00, 0xf8, 0xd8, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0xf7, 0x00, 0xf8, 0xd3, 0x00, 0xf8, 0x8f, 0x00, 0xf8, 0x28, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf8, 0x38, 0x00, 0xf8, 0x98, 0x00, 0xf8, 0xd8, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0xf7, 0x00, 0xf8, 0xd3, 0x00, 0xf8, 0x8f, 0x00, 0xf8, 
+  0x2b, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf8, 0x0c, 0x00, 0xf8, 0xa4, 0x86, 0x00, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xfc, 0x00, 0xf8, 0x8b, 0x00, 0xf8, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0xf8, 0x0c, 0x00, 0xf8, 0xcb, 0x89, 0x00, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xb3, 0x00, 0xf8, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xa8, 0x8b, 0x00, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0x84, 
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0x3c, 0x8c, 0x00, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0x20, 0x00, 0xf8, 0xa0, 0x8d, 0x00, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0x80, 0x00, 0xf8, 0xe3, 0x8d, 
+  0x00, 0xf8, 0xff, 0x00, 0x00, 0xf8, 0xc0, 0x8e, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xf8, 0xe0, 0x8e, 0x00, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xe0, 0x00, 0xf8, 0xe3, 0x8d, 0x00, 0xf8, 0xff, 0x01, 0x00, 
+  0xf8, 0xc0, 0x00, 0xf8, 0xa0, 0x8d, 0x00, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0x80, 0x00, 0xf8, 0x3c, 0x8c, 0x00, 0xf8, 0xff, 0x03, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0x20, 0x00, 0x00, 0x00, 0x00, 0xf8, 
+  0xa7, 0x8b, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xf8, 0x83, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf8, 0x0c, 0x00, 0xf8, 0xcb, 0x89, 0x00, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xb3, 0x00, 0xf8, 0x04, 0x82, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xf8, 0x0b, 0x00, 0xf8, 0xa3, 0x86, 0x00, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xfc, 0x00, 0xf8, 0x8b, 0x00, 0xf8, 0x04, 0x85, 0x00, 0x00, 0x00, 0x07, 0x00, 0xf8, 0x38, 
+  0x00, 0xf8, 0x98, 0x00, 0xf8, 0xd8, 0x00, 0xf8, 0xfb, 0x00, 0xf8, 0xf7, 0x00, 0xf8, 0xd3, 0x00, 0xf8, 0x8f, 0x00, 0xf8, 0x28, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x38, 0xf8, 0x00, 0x98, 0xf8, 0x00, 0xd8, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0xf7, 0xf8, 0x00, 0xd3, 0xf8, 0x00, 0x8f, 0xf8, 0x00, 0x2b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x0c, 0xf8, 0x00, 0xa4, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xfc, 0xf8, 0x00, 0x8b, 0xf8, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf8, 0x00, 0x0c, 0xf8, 0x00, 0xcb, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xb3, 0xf8, 0x00, 0x04, 0x00, 0x00, 0x00, 
-  0xf8, 0x00, 0x00, 0xf8, 0x00, 0xa8, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0x84, 0xf8, 0x00, 0x00, 
-  0xf8, 0x00, 0x3c, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0x20, 
-  0xf8, 0x00, 0xa0, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0x80, 
-  0xf8, 0x00, 0xe3, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xc0, 
-  0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xe0, 
-  0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xe0, 
-  0xf8, 0x00, 0xe3, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xc0, 
-  0xf8, 0x00, 0xa0, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0x80, 
-  0xf8, 0x00, 0x3c, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0x20, 
-  0xf8, 0x00, 0x00, 0xf8, 0x00, 0xa7, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0x83, 0xf8, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf8, 0x00, 0x0c, 0xf8, 0x00, 0xcb, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xb3, 0xf8, 0x00, 0x04, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x0b, 0xf8, 0x00, 0xa3, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xfc, 0xf8, 0x00, 0x8b, 0xf8, 0x00, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x38, 0xf8, 0x00, 0x98, 0xf8, 0x00, 0xd8, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0xf7, 0xf8, 0x00, 0xd3, 0xf8, 0x00, 0x8f, 0xf8, 0x00, 0x28, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x38, 0xf8, 0x00, 0x98, 0xf8, 0x00, 0xd8, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0xf7, 0xf8, 0x00, 0xd3, 0xf8, 0x00, 0x8f, 0xf8, 0x00, 
+  0x2b, 0x85, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x0c, 0xf8, 0x00, 0xa4, 0x86, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0x00, 0xfc, 0xf8, 0x00, 0x8b, 0xf8, 0x00, 0x04, 0x82, 0x00, 0x00, 0x00, 0x01, 0xf8, 
+  0x00, 0x0c, 0xf8, 0x00, 0xcb, 0x89, 0xf8, 0x00, 0xff, 0x01, 0xf8, 0x00, 0xb3, 0xf8, 0x00, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa8, 0x8b, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0x00, 0x84, 
+  0x00, 0x00, 0x00, 0xf8, 0x00, 0x3c, 0x8c, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0x20, 0xf8, 0x00, 0xa0, 0x8d, 0xf8, 0x00, 0xff, 0x01, 0xf8, 0x00, 0x80, 0xf8, 0x00, 0xe3, 0x8d, 
+  0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xc0, 0x8e, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0xe0, 0x8e, 0xf8, 0x00, 0xff, 0x01, 0xf8, 0x00, 0xe0, 0xf8, 0x00, 0xe3, 0x8d, 0xf8, 0x00, 0xff, 0x01, 0xf8, 
+  0x00, 0xc0, 0xf8, 0x00, 0xa0, 0x8d, 0xf8, 0x00, 0xff, 0x01, 0xf8, 0x00, 0x80, 0xf8, 0x00, 0x3c, 0x8c, 0xf8, 0x00, 0xff, 0x03, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf8, 0x00, 
+  0xa7, 0x8b, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x00, 0x83, 0x81, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x0c, 0xf8, 0x00, 0xcb, 0x89, 0xf8, 0x00, 0xff, 0x01, 0xf8, 0x00, 0xb3, 0xf8, 0x00, 0x04, 0x82, 
+  0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x0b, 0xf8, 0x00, 0xa3, 0x86, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0x00, 0xfc, 0xf8, 0x00, 0x8b, 0xf8, 0x00, 0x04, 0x85, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x38, 
+  0xf8, 0x00, 0x98, 0xf8, 0x00, 0xd8, 0xf8, 0x00, 0xfb, 0xf8, 0x00, 0xf7, 0xf8, 0x00, 0xd3, 0xf8, 0x00, 0x8f, 0xf8, 0x00, 0x28, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x98, 0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xd3, 0x00, 0x00, 0xff, 0x8f, 0x00, 0x00, 0xff, 0x2b, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0xa4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0x8b, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0xcb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xb3, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xa8, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x84, 0x00, 0x00, 0xff, 0x00, 
-  0x00, 0x00, 0xff, 0x3c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0x20, 
-  0x00, 0x00, 0xff, 0xa0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 
-  0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xc0, 
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xe0, 
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xe0, 
-  0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xc0, 
-  0x00, 0x00, 0xff, 0xa0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 
-  0x00, 0x00, 0xff, 0x3c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0x20, 
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x83, 0x00, 0x00, 0xff, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0xcb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xb3, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xa3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0x8b, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x98, 0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xd3, 0x00, 0x00, 0xff, 0x8f, 0x00, 0x00, 0xff, 0x28, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x98, 0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 
+  0xff, 0xd3, 0x00, 0x00, 0xff, 0x8f, 0x00, 0x00, 0xff, 0x2b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0xa4, 0x86, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 
+  0xff, 0xfc, 0x00, 0x00, 0xff, 0x8b, 0x00, 0x00, 0xff, 0x04, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0xcb, 0x89, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 
+  0xff, 0xb3, 0x00, 0x00, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa8, 0x8b, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0x3c, 0x8c, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0x20, 0x00, 0x00, 0xff, 0xa0, 0x8d, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 
+  0xff, 0xe3, 0x8d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x8e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x8e, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0xff, 0xe0, 
+  0x00, 0x00, 0xff, 0xe3, 0x8d, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xa0, 0x8d, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x3c, 
+  0x8c, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa7, 0x8b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x83, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xff, 0xcb, 0x89, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0xff, 0xb3, 0x00, 0x00, 0xff, 0x04, 0x82, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xa3, 0x86, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0x8b, 0x00, 0x00, 0xff, 0x04, 0x85, 0x00, 0x00, 0x00, 
+  0x00, 0x07, 0x00, 0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x98, 0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xd3, 0x00, 0x00, 0xff, 0x8f, 0x00, 0x00, 
+  0xff, 0x28, 0x83, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +64,7 @@ const lv_img_dsc_t info_fail_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_fail_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_fail_16px_map,
 };
-
@@ -10,79 +10,73 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_N_16PX uint8_t info_n_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x2f, 0x18, 0x93, 0x18, 0xd4, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0xd7, 0x18, 0x94, 0x18, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x14, 0x00, 0x18, 0x07, 0x18, 0x94, 0x18, 0xfc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x9b, 0x18, 0x08, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0x07, 0x18, 0xbc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xc3, 0x18, 0x08, 0x00, 0x00, 
-  0x18, 0x00, 0x18, 0x93, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0x38, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x9b, 0x18, 0x00, 
-  0x18, 0x2b, 0x18, 0xfc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x30, 
-  0x18, 0x8c, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x94, 
-  0x18, 0xcf, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xd4, 
-  0x18, 0xf0, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xf8, 
-  0x18, 0xf0, 0x18, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xf8, 
-  0x18, 0xcf, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xd4, 
-  0x18, 0x8c, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x93, 
-  0x18, 0x2b, 0x18, 0xfc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x30, 
-  0x18, 0x00, 0x18, 0x90, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0x38, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x98, 0x18, 0x00, 
-  0x00, 0x00, 0x18, 0x07, 0x18, 0xbc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xc3, 0x18, 0x08, 0x00, 0x00, 
-  0x00, 0x00, 0x14, 0x00, 0x18, 0x07, 0x18, 0x94, 0x18, 0xfc, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x98, 0x18, 0x08, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x2f, 0x18, 0x93, 0x18, 0xd4, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0xd7, 0x18, 0x94, 0x18, 0x33, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x02, 0x18, 0x2f, 0x18, 0x93, 0x18, 0xd4, 0x81, 0x18, 0xf8, 0x02, 0x18, 0xd7, 0x18, 0x94, 0x18, 0x33, 0x85, 0x00, 0x00, 0x02, 0x18, 0x07, 0x18, 0x94, 
+  0x18, 0xfc, 0x86, 0x18, 0xff, 0x01, 0x18, 0x9b, 0x18, 0x08, 0x82, 0x00, 0x00, 0x01, 0x18, 0x07, 0x18, 0xbc, 0x89, 0x18, 0xff, 0x01, 0x18, 0xc3, 0x18, 0x08, 0x81, 0x00, 0x00, 0x00, 0x18, 0x93, 
+  0x84, 0x18, 0xff, 0x02, 0x9e, 0xff, 0xbf, 0xff, 0x38, 0xff, 0x83, 0x18, 0xff, 0x03, 0x18, 0x9b, 0x00, 0x00, 0x18, 0x2b, 0x18, 0xfc, 0x84, 0x18, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 
+  0x84, 0x18, 0xff, 0x01, 0x18, 0x30, 0x18, 0x8c, 0x85, 0x18, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x84, 0x18, 0xff, 0x01, 0x18, 0x94, 0x18, 0xcf, 0x85, 0x18, 0xff, 0x02, 0xdf, 0xff, 
+  0xff, 0xff, 0x39, 0xff, 0x84, 0x18, 0xff, 0x01, 0x18, 0xd4, 0x18, 0xf0, 0x81, 0x18, 0xff, 0x00, 0x9e, 0xff, 0x87, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0x18, 0xff, 0x01, 0x18, 0xf8, 0x18, 0xf0, 
+  0x81, 0x18, 0xff, 0x00, 0x9e, 0xff, 0x87, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0x18, 0xff, 0x01, 0x18, 0xf8, 0x18, 0xcf, 0x85, 0x18, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x84, 0x18, 
+  0xff, 0x01, 0x18, 0xd4, 0x18, 0x8c, 0x85, 0x18, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xff, 0x39, 0xff, 0x84, 0x18, 0xff, 0x02, 0x18, 0x93, 0x18, 0x2b, 0x18, 0xfc, 0x84, 0x18, 0xff, 0x02, 0xdf, 0xff, 
+  0xff, 0xff, 0x39, 0xff, 0x84, 0x18, 0xff, 0x02, 0x18, 0x30, 0x00, 0x00, 0x18, 0x90, 0x84, 0x18, 0xff, 0x02, 0xbe, 0xff, 0xdf, 0xff, 0x38, 0xff, 0x83, 0x18, 0xff, 0x00, 0x18, 0x98, 0x81, 0x00, 
+  0x00, 0x01, 0x18, 0x07, 0x18, 0xbc, 0x89, 0x18, 0xff, 0x01, 0x18, 0xc3, 0x18, 0x08, 0x82, 0x00, 0x00, 0x02, 0x18, 0x07, 0x18, 0x94, 0x18, 0xfc, 0x86, 0x18, 0xff, 0x01, 0x18, 0x98, 0x18, 0x08, 
+  0x85, 0x00, 0x00, 0x02, 0x18, 0x2f, 0x18, 0x93, 0x18, 0xd4, 0x81, 0x18, 0xf8, 0x02, 0x18, 0xd7, 0x18, 0x94, 0x18, 0x33, 0x83, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x2f, 0x40, 0x06, 0x93, 0x40, 0x06, 0xd4, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xd7, 0x40, 0x06, 0x94, 0x40, 0x06, 0x33, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x20, 0x06, 0x07, 0x40, 0x06, 0x94, 0x40, 0x06, 0xfc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x9b, 0x20, 0x06, 0x08, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x07, 0x40, 0x06, 0xbc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xc3, 0x40, 0x06, 0x08, 0x00, 0x00, 0x00, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x93, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xf1, 0x8e, 0xff, 0x36, 0xb7, 0xff, 0x43, 0x1e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x9b, 0x40, 0x06, 0x00, 
-  0x40, 0x06, 0x2b, 0x40, 0x06, 0xfc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x30, 
-  0x40, 0x06, 0x8c, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x94, 
-  0x40, 0x06, 0xcf, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xd4, 
-  0x40, 0x06, 0xf0, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xd0, 0x86, 0xff, 0xbd, 0xef, 0xff, 0xbd, 0xef, 0xff, 0xbd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xef, 0xff, 0xbd, 0xef, 0xff, 0xbd, 0xef, 0xff, 0x57, 0xbf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xf8, 
-  0x40, 0x06, 0xf0, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xd0, 0x86, 0xff, 0xdd, 0xef, 0xff, 0xdd, 0xef, 0xff, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xff, 0xdd, 0xef, 0xff, 0xdd, 0xef, 0xff, 0x57, 0xbf, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xf8, 
-  0x40, 0x06, 0xcf, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xd4, 
-  0x40, 0x06, 0x8c, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x93, 
-  0x40, 0x06, 0x2b, 0x40, 0x06, 0xfc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x30, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x90, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0xf3, 0x9e, 0xff, 0x58, 0xc7, 0xff, 0x43, 0x1e, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x98, 0x40, 0x06, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x07, 0x40, 0x06, 0xbc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xc3, 0x20, 0x06, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x40, 0x06, 0x07, 0x40, 0x06, 0x94, 0x40, 0x06, 0xfc, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x98, 0x40, 0x06, 0x08, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x2f, 0x40, 0x06, 0x93, 0x40, 0x06, 0xd4, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xd7, 0x40, 0x06, 0x94, 0x40, 0x06, 0x33, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x2f, 0x40, 0x06, 0x93, 0x40, 0x06, 0xd4, 0x81, 0x40, 0x06, 0xf8, 0x02, 0x40, 0x06, 0xd7, 0x40, 0x06, 0x94, 0x40, 0x06, 0x33, 
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x20, 0x06, 0x07, 0x40, 0x06, 0x94, 0x40, 0x06, 0xfc, 0x86, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x9b, 0x20, 0x06, 0x08, 0x82, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 
+  0x07, 0x40, 0x06, 0xbc, 0x89, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xc3, 0x40, 0x06, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x93, 0x84, 0x40, 0x06, 0xff, 0x02, 0xf1, 0x8e, 0xff, 0x36, 
+  0xb7, 0xff, 0x43, 0x1e, 0xff, 0x83, 0x40, 0x06, 0xff, 0x03, 0x40, 0x06, 0x9b, 0x00, 0x00, 0x00, 0x40, 0x06, 0x2b, 0x40, 0x06, 0xfc, 0x84, 0x40, 0x06, 0xff, 0x02, 0x79, 0xcf, 0xff, 0xff, 0xff, 
+  0xff, 0x45, 0x2e, 0xff, 0x84, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x30, 0x40, 0x06, 0x8c, 0x85, 0x40, 0x06, 0xff, 0x02, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x84, 0x40, 0x06, 
+  0xff, 0x01, 0x40, 0x06, 0x94, 0x40, 0x06, 0xcf, 0x85, 0x40, 0x06, 0xff, 0x02, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xff, 0x84, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xd4, 0x40, 0x06, 
+  0xf0, 0x81, 0x40, 0x06, 0xff, 0x00, 0xd0, 0x86, 0xff, 0x82, 0xbd, 0xef, 0xff, 0x81, 0xff, 0xff, 0xff, 0x82, 0xbd, 0xef, 0xff, 0x00, 0x57, 0xbf, 0xff, 0x81, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 
+  0xf8, 0x40, 0x06, 0xf0, 0x81, 0x40, 0x06, 0xff, 0x00, 0xd0, 0x86, 0xff, 0x82, 0xdd, 0xef, 0xff, 0x81, 0xff, 0xff, 0xff, 0x82, 0xdd, 0xef, 0xff, 0x00, 0x57, 0xbf, 0xff, 0x81, 0x40, 0x06, 0xff, 
+  0x01, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xcf, 0x85, 0x40, 0x06, 0xff, 0x02, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x84, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xd4, 0x40, 0x06, 0x8c, 
+  0x85, 0x40, 0x06, 0xff, 0x02, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x84, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0x93, 0x40, 0x06, 0x2b, 0x40, 0x06, 0xfc, 0x84, 0x40, 0x06, 0xff, 
+  0x02, 0x79, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x45, 0x2e, 0xff, 0x84, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0x30, 0x00, 0x00, 0x00, 0x40, 0x06, 0x90, 0x84, 0x40, 0x06, 0xff, 0x02, 0xf3, 0x9e, 0xff, 
+  0x58, 0xc7, 0xff, 0x43, 0x1e, 0xff, 0x83, 0x40, 0x06, 0xff, 0x00, 0x40, 0x06, 0x98, 0x81, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x07, 0x40, 0x06, 0xbc, 0x89, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 
+  0xc3, 0x20, 0x06, 0x08, 0x82, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x07, 0x40, 0x06, 0x94, 0x40, 0x06, 0xfc, 0x86, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x98, 0x40, 0x06, 0x08, 0x85, 0x00, 0x00, 
+  0x00, 0x02, 0x40, 0x06, 0x2f, 0x40, 0x06, 0x93, 0x40, 0x06, 0xd4, 0x81, 0x40, 0x06, 0xf8, 0x02, 0x40, 0x06, 0xd7, 0x40, 0x06, 0x94, 0x40, 0x06, 0x33, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x2f, 0x06, 0x40, 0x93, 0x06, 0x40, 0xd4, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xd7, 0x06, 0x40, 0x94, 0x06, 0x40, 0x33, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x06, 0x20, 0x07, 0x06, 0x40, 0x94, 0x06, 0x40, 0xfc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x9b, 0x06, 0x20, 0x08, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x07, 0x06, 0x40, 0xbc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xc3, 0x06, 0x40, 0x08, 0x00, 0x00, 0x00, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x93, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x8e, 0xf1, 0xff, 0xb7, 0x36, 0xff, 0x1e, 0x43, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x9b, 0x06, 0x40, 0x00, 
-  0x06, 0x40, 0x2b, 0x06, 0x40, 0xfc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x30, 
-  0x06, 0x40, 0x8c, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x94, 
-  0x06, 0x40, 0xcf, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x26, 0x44, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xd4, 
-  0x06, 0x40, 0xf0, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x86, 0xd0, 0xff, 0xef, 0xbd, 0xff, 0xef, 0xbd, 0xff, 0xef, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbd, 0xff, 0xef, 0xbd, 0xff, 0xef, 0xbd, 0xff, 0xbf, 0x57, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xf8, 
-  0x06, 0x40, 0xf0, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x86, 0xd0, 0xff, 0xef, 0xdd, 0xff, 0xef, 0xdd, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xef, 0xdd, 0xff, 0xef, 0xdd, 0xff, 0xbf, 0x57, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xf8, 
-  0x06, 0x40, 0xcf, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xd4, 
-  0x06, 0x40, 0x8c, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x93, 
-  0x06, 0x40, 0x2b, 0x06, 0x40, 0xfc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x30, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x90, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x9e, 0xf3, 0xff, 0xc7, 0x58, 0xff, 0x1e, 0x43, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x98, 0x06, 0x40, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x07, 0x06, 0x40, 0xbc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xc3, 0x06, 0x20, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x06, 0x40, 0x07, 0x06, 0x40, 0x94, 0x06, 0x40, 0xfc, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x98, 0x06, 0x40, 0x08, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x2f, 0x06, 0x40, 0x93, 0x06, 0x40, 0xd4, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xd7, 0x06, 0x40, 0x94, 0x06, 0x40, 0x33, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x02, 0x06, 0x40, 0x2f, 0x06, 0x40, 0x93, 0x06, 0x40, 0xd4, 0x81, 0x06, 0x40, 0xf8, 0x02, 0x06, 0x40, 0xd7, 0x06, 0x40, 0x94, 0x06, 0x40, 0x33, 
+  0x85, 0x00, 0x00, 0x00, 0x02, 0x06, 0x20, 0x07, 0x06, 0x40, 0x94, 0x06, 0x40, 0xfc, 0x86, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x9b, 0x06, 0x20, 0x08, 0x82, 0x00, 0x00, 0x00, 0x01, 0x06, 0x40, 
+  0x07, 0x06, 0x40, 0xbc, 0x89, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xc3, 0x06, 0x40, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x93, 0x84, 0x06, 0x40, 0xff, 0x02, 0x8e, 0xf1, 0xff, 0xb7, 
+  0x36, 0xff, 0x1e, 0x43, 0xff, 0x83, 0x06, 0x40, 0xff, 0x03, 0x06, 0x40, 0x9b, 0x00, 0x00, 0x00, 0x06, 0x40, 0x2b, 0x06, 0x40, 0xfc, 0x84, 0x06, 0x40, 0xff, 0x02, 0xcf, 0x79, 0xff, 0xff, 0xff, 
+  0xff, 0x2e, 0x45, 0xff, 0x84, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x30, 0x06, 0x40, 0x8c, 0x85, 0x06, 0x40, 0xff, 0x02, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x84, 0x06, 0x40, 
+  0xff, 0x01, 0x06, 0x40, 0x94, 0x06, 0x40, 0xcf, 0x85, 0x06, 0x40, 0xff, 0x02, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x26, 0x44, 0xff, 0x84, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xd4, 0x06, 0x40, 
+  0xf0, 0x81, 0x06, 0x40, 0xff, 0x00, 0x86, 0xd0, 0xff, 0x82, 0xef, 0xbd, 0xff, 0x81, 0xff, 0xff, 0xff, 0x82, 0xef, 0xbd, 0xff, 0x00, 0xbf, 0x57, 0xff, 0x81, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 
+  0xf8, 0x06, 0x40, 0xf0, 0x81, 0x06, 0x40, 0xff, 0x00, 0x86, 0xd0, 0xff, 0x82, 0xef, 0xdd, 0xff, 0x81, 0xff, 0xff, 0xff, 0x82, 0xef, 0xdd, 0xff, 0x00, 0xbf, 0x57, 0xff, 0x81, 0x06, 0x40, 0xff, 
+  0x01, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xcf, 0x85, 0x06, 0x40, 0xff, 0x02, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x84, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xd4, 0x06, 0x40, 0x8c, 
+  0x85, 0x06, 0x40, 0xff, 0x02, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x84, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0x93, 0x06, 0x40, 0x2b, 0x06, 0x40, 0xfc, 0x84, 0x06, 0x40, 0xff, 
+  0x02, 0xcf, 0x79, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x45, 0xff, 0x84, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0x30, 0x00, 0x00, 0x00, 0x06, 0x40, 0x90, 0x84, 0x06, 0x40, 0xff, 0x02, 0x9e, 0xf3, 0xff, 
+  0xc7, 0x58, 0xff, 0x1e, 0x43, 0xff, 0x83, 0x06, 0x40, 0xff, 0x00, 0x06, 0x40, 0x98, 0x81, 0x00, 0x00, 0x00, 0x01, 0x06, 0x40, 0x07, 0x06, 0x40, 0xbc, 0x89, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 
+  0xc3, 0x06, 0x20, 0x08, 0x82, 0x00, 0x00, 0x00, 0x02, 0x06, 0x40, 0x07, 0x06, 0x40, 0x94, 0x06, 0x40, 0xfc, 0x86, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x98, 0x06, 0x40, 0x08, 0x85, 0x00, 0x00, 
+  0x00, 0x02, 0x06, 0x40, 0x2f, 0x06, 0x40, 0x93, 0x06, 0x40, 0xd4, 0x81, 0x06, 0x40, 0xf8, 0x02, 0x06, 0x40, 0xd7, 0x06, 0x40, 0x94, 0x06, 0x40, 0x33, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0x33, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x07, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x9b, 0x00, 0xc6, 0x00, 0x08, 0x00, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x07, 0x00, 0xc8, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xc3, 0x00, 0xc8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xc9, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x89, 0xdb, 0x89, 0xff, 0xad, 0xe4, 0xad, 0xff, 0x16, 0xc9, 0x16, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x9b, 0x00, 0xc8, 0x00, 0x00, 
-  0x00, 0xc8, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x30, 
-  0x00, 0xc8, 0x00, 0x8c, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x94, 
-  0x00, 0xc8, 0x00, 0xcf, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x23, 0xc9, 0x23, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xd4, 
-  0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x83, 0xd7, 0x83, 0xff, 0xe6, 0xf5, 0xe6, 0xff, 0xe6, 0xf5, 0xe6, 0xff, 0xe6, 0xf5, 0xe6, 0xff, 0xf5, 0xfb, 0xf5, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xe6, 0xf5, 0xe6, 0xff, 0xe6, 0xf5, 0xe6, 0xff, 0xe6, 0xf5, 0xe6, 0xff, 0xb9, 0xe8, 0xb9, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xf8, 
-  0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x84, 0xd8, 0x84, 0xff, 0xe8, 0xf7, 0xe8, 0xff, 0xe8, 0xf7, 0xe8, 0xff, 0xe8, 0xf7, 0xe8, 0xff, 0xf6, 0xfc, 0xf6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xe9, 0xf8, 0xe9, 0xff, 0xe8, 0xf7, 0xe8, 0xff, 0xe8, 0xf7, 0xe8, 0xff, 0xbb, 0xea, 0xbb, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xf8, 
-  0x00, 0xc8, 0x00, 0xcf, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x25, 0xca, 0x25, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xd4, 
-  0x00, 0xc8, 0x00, 0x8c, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x93, 
-  0x00, 0xc8, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x30, 
-  0x00, 0xc7, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x90, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x97, 0xdd, 0x97, 0xff, 0xbe, 0xe8, 0xbe, 0xff, 0x1a, 0xc9, 0x1a, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x98, 0x00, 0xc7, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x00, 0x07, 0x00, 0xc8, 0x00, 0xbc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xc3, 0x00, 0xc6, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x07, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x98, 0x00, 0xc7, 0x00, 0x08, 0x00, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc9, 0x00, 0x33, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0xd4, 0x81, 0x00, 0xc8, 0x00, 0xf8, 0x02, 0x00, 0xc8, 0x00, 0xd7, 
+  0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0x33, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc6, 0x00, 0x07, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xfc, 0x86, 0x00, 0xc8, 0x00, 0xff, 0x01, 
+  0x00, 0xc8, 0x00, 0x9b, 0x00, 0xc6, 0x00, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc9, 0x00, 0x07, 0x00, 0xc8, 0x00, 0xbc, 0x89, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xc3, 
+  0x00, 0xc8, 0x00, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x93, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x89, 0xdb, 0x89, 0xff, 0xad, 0xe4, 0xad, 0xff, 0x16, 0xc9, 0x16, 0xff, 
+  0x83, 0x00, 0xc8, 0x00, 0xff, 0x03, 0x00, 0xc8, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0xfc, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x02, 0xc8, 0xed, 0xc8, 0xff, 
+  0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0x30, 0x00, 0xc8, 0x00, 0x8c, 0x85, 0x00, 0xc8, 0x00, 0xff, 0x02, 0xc8, 0xed, 0xc8, 0xff, 
+  0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xcf, 0x85, 0x00, 0xc8, 0x00, 0xff, 0x02, 0xc8, 0xed, 0xc8, 0xff, 
+  0xfa, 0xfe, 0xfa, 0xff, 0x23, 0xc9, 0x23, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xc8, 0x00, 0xf0, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x00, 0x83, 0xd7, 0x83, 0xff, 
+  0x82, 0xe6, 0xf5, 0xe6, 0xff, 0x01, 0xf5, 0xfb, 0xf5, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x82, 0xe6, 0xf5, 0xe6, 0xff, 0x00, 0xb9, 0xe8, 0xb9, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 
+  0x00, 0xf8, 0x00, 0xc8, 0x00, 0xf0, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x00, 0x84, 0xd8, 0x84, 0xff, 0x82, 0xe8, 0xf7, 0xe8, 0xff, 0x02, 0xf6, 0xfc, 0xf6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xe9, 0xf8, 
+  0xe9, 0xff, 0x81, 0xe8, 0xf7, 0xe8, 0xff, 0x00, 0xbb, 0xea, 0xbb, 0xff, 0x81, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xcf, 0x85, 0x00, 0xc8, 0x00, 0xff, 0x02, 
+  0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x25, 0xca, 0x25, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xc8, 0x00, 0x8c, 0x85, 0x00, 0xc8, 0x00, 0xff, 0x02, 
+  0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0xfc, 0x84, 0x00, 
+  0xc8, 0x00, 0xff, 0x02, 0xc8, 0xed, 0xc8, 0xff, 0xfa, 0xfe, 0xfa, 0xff, 0x26, 0xc9, 0x26, 0xff, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 
+  0x00, 0x90, 0x84, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x97, 0xdd, 0x97, 0xff, 0xbe, 0xe8, 0xbe, 0xff, 0x1a, 0xc9, 0x1a, 0xff, 0x83, 0x00, 0xc8, 0x00, 0xff, 0x00, 0x00, 0xc8, 0x00, 0x98, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xca, 0x00, 0x07, 0x00, 0xc8, 0x00, 0xbc, 0x89, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xc3, 0x00, 0xc6, 0x00, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0xc8, 0x00, 0x07, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xfc, 0x86, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0x98, 0x00, 0xc7, 0x00, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0xd4, 0x81, 0x00, 0xc8, 0x00, 0xf8, 0x02, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc9, 0x00, 0x33, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +84,7 @@ const lv_img_dsc_t info_n_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_n_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_n_16px_map,
 };
-
@@ -10,79 +10,53 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_OK_16PX uint8_t info_ok_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x33, 0x18, 0x94, 0x18, 0xd7, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0xd4, 0x18, 0x93, 0x18, 0x2f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0x00, 0x18, 0x08, 0x18, 0x9b, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xfc, 0x18, 0x94, 0x18, 0x07, 0x14, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0x08, 0x18, 0xc3, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xbc, 0x18, 0x07, 0x00, 0x00, 
-  0x18, 0x00, 0x18, 0x9b, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x90, 0x18, 0x00, 
-  0x18, 0x33, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xfc, 0x18, 0x2b, 
-  0x18, 0x94, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x8c, 
-  0x18, 0xd7, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xcc, 
-  0x18, 0xf8, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xf0, 
-  0x18, 0xf8, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xf0, 
-  0x18, 0xd7, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xcc, 
-  0x18, 0x94, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x8c, 
-  0x18, 0x33, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xfc, 0x18, 0x2b, 
-  0x18, 0x00, 0x18, 0x9b, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0x90, 0x18, 0x00, 
-  0x00, 0x00, 0x18, 0x08, 0x18, 0xc3, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xbc, 0x18, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0x00, 0x18, 0x08, 0x18, 0x9b, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xfc, 0x18, 0x93, 0x18, 0x07, 0x14, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x33, 0x18, 0x94, 0x18, 0xd7, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0xd4, 0x18, 0x93, 0x18, 0x2f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x02, 0x18, 0x33, 0x18, 0x94, 0x18, 0xd7, 0x81, 0x18, 0xf8, 0x02, 0x18, 0xd4, 0x18, 0x93, 0x18, 0x2f, 0x85, 0x00, 0x00, 0x01, 0x18, 0x08, 0x18, 0x9b, 
+  0x86, 0x18, 0xff, 0x02, 0x18, 0xfc, 0x18, 0x94, 0x18, 0x07, 0x82, 0x00, 0x00, 0x01, 0x18, 0x08, 0x18, 0xc3, 0x89, 0x18, 0xff, 0x01, 0x18, 0xbc, 0x18, 0x07, 0x81, 0x00, 0x00, 0x00, 0x18, 0x9b, 
+  0x8b, 0x18, 0xff, 0x02, 0x18, 0x90, 0x00, 0x00, 0x18, 0x33, 0x8c, 0x18, 0xff, 0x02, 0x18, 0xfc, 0x18, 0x2b, 0x18, 0x94, 0x8d, 0x18, 0xff, 0x01, 0x18, 0x8c, 0x18, 0xd7, 0x8d, 0x18, 0xff, 0x01, 
+  0x18, 0xcc, 0x18, 0xf8, 0x8d, 0x18, 0xff, 0x01, 0x18, 0xf0, 0x18, 0xf8, 0x8d, 0x18, 0xff, 0x01, 0x18, 0xf0, 0x18, 0xd7, 0x8d, 0x18, 0xff, 0x01, 0x18, 0xcc, 0x18, 0x94, 0x8d, 0x18, 0xff, 0x01, 
+  0x18, 0x8c, 0x18, 0x33, 0x8c, 0x18, 0xff, 0x03, 0x18, 0xfc, 0x18, 0x2b, 0x00, 0x00, 0x18, 0x9b, 0x8b, 0x18, 0xff, 0x00, 0x18, 0x90, 0x81, 0x00, 0x00, 0x01, 0x18, 0x08, 0x18, 0xc3, 0x89, 0x18, 
+  0xff, 0x01, 0x18, 0xbc, 0x18, 0x07, 0x82, 0x00, 0x00, 0x01, 0x18, 0x08, 0x18, 0x9b, 0x86, 0x18, 0xff, 0x02, 0x18, 0xfc, 0x18, 0x93, 0x18, 0x07, 0x85, 0x00, 0x00, 0x02, 0x18, 0x33, 0x18, 0x94, 
+  0x18, 0xd7, 0x81, 0x18, 0xf8, 0x02, 0x18, 0xd4, 0x18, 0x93, 0x18, 0x2f, 0x83, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x33, 0x40, 0x06, 0x94, 0x40, 0x06, 0xd7, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xd4, 0x40, 0x06, 0x93, 0x40, 0x06, 0x2f, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x08, 0x40, 0x06, 0x9b, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x94, 0x40, 0x06, 0x07, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x08, 0x40, 0x06, 0xc3, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xbc, 0x60, 0x06, 0x07, 0x00, 0x00, 0x00, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x9b, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x90, 0x40, 0x06, 0x00, 
-  0x40, 0x06, 0x33, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x2b, 
-  0x40, 0x06, 0x94, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x8c, 
-  0x40, 0x06, 0xd7, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xcc, 
-  0x40, 0x06, 0xf8, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xf0, 
-  0x40, 0x06, 0xf8, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xf0, 
-  0x40, 0x06, 0xd7, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xcc, 
-  0x40, 0x06, 0x94, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x8c, 
-  0x40, 0x06, 0x33, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x2b, 
-  0x40, 0x06, 0x00, 0x40, 0x06, 0x9b, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0x90, 0x40, 0x06, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x08, 0x40, 0x06, 0xc3, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xbc, 0x40, 0x06, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x08, 0x40, 0x06, 0x9b, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xff, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x93, 0x40, 0x06, 0x07, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x40, 0x06, 0x33, 0x40, 0x06, 0x94, 0x40, 0x06, 0xd7, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xf8, 0x40, 0x06, 0xd4, 0x40, 0x06, 0x93, 0x40, 0x06, 0x2f, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x33, 0x40, 0x06, 0x94, 0x40, 0x06, 0xd7, 0x81, 0x40, 0x06, 0xf8, 0x02, 0x40, 0x06, 0xd4, 0x40, 0x06, 0x93, 0x40, 0x06, 0x2f, 
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x08, 0x40, 0x06, 0x9b, 0x86, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x94, 0x40, 0x06, 0x07, 0x82, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 
+  0x08, 0x40, 0x06, 0xc3, 0x89, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xbc, 0x60, 0x06, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x9b, 0x8b, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0x90, 0x00, 
+  0x00, 0x00, 0x40, 0x06, 0x33, 0x8c, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x2b, 0x40, 0x06, 0x94, 0x8d, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x8c, 0x40, 0x06, 0xd7, 0x8d, 0x40, 
+  0x06, 0xff, 0x01, 0x40, 0x06, 0xcc, 0x40, 0x06, 0xf8, 0x8d, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xf8, 0x8d, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xf0, 0x40, 0x06, 0xd7, 0x8d, 
+  0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0xcc, 0x40, 0x06, 0x94, 0x8d, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 0x8c, 0x40, 0x06, 0x33, 0x8c, 0x40, 0x06, 0xff, 0x03, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x2b, 
+  0x00, 0x00, 0x00, 0x40, 0x06, 0x9b, 0x8b, 0x40, 0x06, 0xff, 0x00, 0x40, 0x06, 0x90, 0x81, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x08, 0x40, 0x06, 0xc3, 0x89, 0x40, 0x06, 0xff, 0x01, 0x40, 0x06, 
+  0xbc, 0x40, 0x06, 0x07, 0x82, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x08, 0x40, 0x06, 0x9b, 0x86, 0x40, 0x06, 0xff, 0x02, 0x40, 0x06, 0xfc, 0x40, 0x06, 0x93, 0x40, 0x06, 0x07, 0x85, 0x00, 0x00, 
+  0x00, 0x02, 0x40, 0x06, 0x33, 0x40, 0x06, 0x94, 0x40, 0x06, 0xd7, 0x81, 0x40, 0x06, 0xf8, 0x02, 0x40, 0x06, 0xd4, 0x40, 0x06, 0x93, 0x40, 0x06, 0x2f, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x33, 0x06, 0x40, 0x94, 0x06, 0x40, 0xd7, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xd4, 0x06, 0x40, 0x93, 0x06, 0x40, 0x2f, 0x06, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x08, 0x06, 0x40, 0x9b, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x94, 0x06, 0x40, 0x07, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x08, 0x06, 0x40, 0xc3, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xbc, 0x06, 0x60, 0x07, 0x00, 0x00, 0x00, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x9b, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x90, 0x06, 0x40, 0x00, 
-  0x06, 0x40, 0x33, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x2b, 
-  0x06, 0x40, 0x94, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x8c, 
-  0x06, 0x40, 0xd7, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xcc, 
-  0x06, 0x40, 0xf8, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xf0, 
-  0x06, 0x40, 0xf8, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xf0, 
-  0x06, 0x40, 0xd7, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xcc, 
-  0x06, 0x40, 0x94, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x8c, 
-  0x06, 0x40, 0x33, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x2b, 
-  0x06, 0x40, 0x00, 0x06, 0x40, 0x9b, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0x90, 0x06, 0x40, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x08, 0x06, 0x40, 0xc3, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xbc, 0x06, 0x40, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x08, 0x06, 0x40, 0x9b, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xff, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x93, 0x06, 0x40, 0x07, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x06, 0x40, 0x33, 0x06, 0x40, 0x94, 0x06, 0x40, 0xd7, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xf8, 0x06, 0x40, 0xd4, 0x06, 0x40, 0x93, 0x06, 0x40, 0x2f, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x02, 0x06, 0x40, 0x33, 0x06, 0x40, 0x94, 0x06, 0x40, 0xd7, 0x81, 0x06, 0x40, 0xf8, 0x02, 0x06, 0x40, 0xd4, 0x06, 0x40, 0x93, 0x06, 0x40, 0x2f, 
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x06, 0x40, 0x08, 0x06, 0x40, 0x9b, 0x86, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x94, 0x06, 0x40, 0x07, 0x82, 0x00, 0x00, 0x00, 0x01, 0x06, 0x40, 
+  0x08, 0x06, 0x40, 0xc3, 0x89, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xbc, 0x06, 0x60, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x9b, 0x8b, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0x90, 0x00, 
+  0x00, 0x00, 0x06, 0x40, 0x33, 0x8c, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x2b, 0x06, 0x40, 0x94, 0x8d, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x8c, 0x06, 0x40, 0xd7, 0x8d, 0x06, 
+  0x40, 0xff, 0x01, 0x06, 0x40, 0xcc, 0x06, 0x40, 0xf8, 0x8d, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xf8, 0x8d, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xf0, 0x06, 0x40, 0xd7, 0x8d, 
+  0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0xcc, 0x06, 0x40, 0x94, 0x8d, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 0x8c, 0x06, 0x40, 0x33, 0x8c, 0x06, 0x40, 0xff, 0x03, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x2b, 
+  0x00, 0x00, 0x00, 0x06, 0x40, 0x9b, 0x8b, 0x06, 0x40, 0xff, 0x00, 0x06, 0x40, 0x90, 0x81, 0x00, 0x00, 0x00, 0x01, 0x06, 0x40, 0x08, 0x06, 0x40, 0xc3, 0x89, 0x06, 0x40, 0xff, 0x01, 0x06, 0x40, 
+  0xbc, 0x06, 0x40, 0x07, 0x82, 0x00, 0x00, 0x00, 0x01, 0x06, 0x40, 0x08, 0x06, 0x40, 0x9b, 0x86, 0x06, 0x40, 0xff, 0x02, 0x06, 0x40, 0xfc, 0x06, 0x40, 0x93, 0x06, 0x40, 0x07, 0x85, 0x00, 0x00, 
+  0x00, 0x02, 0x06, 0x40, 0x33, 0x06, 0x40, 0x94, 0x06, 0x40, 0xd7, 0x81, 0x06, 0x40, 0xf8, 0x02, 0x06, 0x40, 0xd4, 0x06, 0x40, 0x93, 0x06, 0x40, 0x2f, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x33, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x08, 0x00, 0xc8, 0x00, 0x9b, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc7, 0x00, 0x07, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x08, 0x00, 0xc8, 0x00, 0xc3, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xbc, 0x00, 0xcb, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x9b, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x90, 0x00, 0xc7, 0x00, 0x00, 
-  0x00, 0xc8, 0x00, 0x33, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0x2b, 
-  0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x8c, 
-  0x00, 0xc8, 0x00, 0xd7, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xcc, 
-  0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xf0, 
-  0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xf0, 
-  0x00, 0xc8, 0x00, 0xd7, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xcc, 
-  0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x8c, 
-  0x00, 0xc8, 0x00, 0x33, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc9, 0x00, 0x2b, 
-  0x00, 0xc9, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x9b, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x90, 0x00, 0xc9, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x08, 0x00, 0xc8, 0x00, 0xc3, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xbc, 0x00, 0xca, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x08, 0x00, 0xc8, 0x00, 0x9b, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xff, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc9, 0x00, 0x07, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x33, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xd7, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xf8, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0x2f, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x33, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xd7, 0x81, 0x00, 0xc8, 0x00, 0xf8, 0x02, 0x00, 0xc8, 0x00, 0xd4, 
+  0x00, 0xc8, 0x00, 0x93, 0x00, 0xc8, 0x00, 0x2f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc7, 0x00, 0x08, 0x00, 0xc8, 0x00, 0x9b, 0x86, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0xfc, 
+  0x00, 0xc8, 0x00, 0x94, 0x00, 0xc7, 0x00, 0x07, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc7, 0x00, 0x08, 0x00, 0xc8, 0x00, 0xc3, 0x89, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xbc, 
+  0x00, 0xcb, 0x00, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x9b, 0x8b, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x33, 
+  0x8c, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0x2b, 0x00, 0xc8, 0x00, 0x94, 0x8d, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0x8c, 0x00, 0xc8, 0x00, 0xd7, 
+  0x8d, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xcc, 0x00, 0xc8, 0x00, 0xf8, 0x8d, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xf8, 0x8d, 0x00, 0xc8, 0x00, 
+  0xff, 0x01, 0x00, 0xc8, 0x00, 0xf0, 0x00, 0xc8, 0x00, 0xd7, 0x8d, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xcc, 0x00, 0xc8, 0x00, 0x94, 0x8d, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 
+  0x00, 0x8c, 0x00, 0xc8, 0x00, 0x33, 0x8c, 0x00, 0xc8, 0x00, 0xff, 0x03, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc9, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x9b, 0x8b, 0x00, 0xc8, 0x00, 
+  0xff, 0x00, 0x00, 0xc8, 0x00, 0x90, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x00, 0x08, 0x00, 0xc8, 0x00, 0xc3, 0x89, 0x00, 0xc8, 0x00, 0xff, 0x01, 0x00, 0xc8, 0x00, 0xbc, 0x00, 0xca, 
+  0x00, 0x07, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc7, 0x00, 0x08, 0x00, 0xc8, 0x00, 0x9b, 0x86, 0x00, 0xc8, 0x00, 0xff, 0x02, 0x00, 0xc8, 0x00, 0xfc, 0x00, 0xc8, 0x00, 0x93, 0x00, 0xc9, 
+  0x00, 0x07, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc8, 0x00, 0x33, 0x00, 0xc8, 0x00, 0x94, 0x00, 0xc8, 0x00, 0xd7, 0x81, 0x00, 0xc8, 0x00, 0xf8, 0x02, 0x00, 0xc8, 0x00, 0xd4, 0x00, 0xc8, 
+  0x00, 0x93, 0x00, 0xc8, 0x00, 0x2f, 0x83, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +64,7 @@ const lv_img_dsc_t info_ok_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_ok_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_ok_16px_map,
 };
-
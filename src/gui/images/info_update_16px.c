@@ -10,79 +10,53 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INFO_UPDATE_16PX uint8_t info_update_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x3c, 0x13, 0x9c, 0x13, 0xdb, 0x13, 0xfb, 0x13, 0xf7, 0x13, 0xd0, 0x13, 0x8b, 0x13, 0x24, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x13, 0x00, 0x13, 0x0f, 0x13, 0xab, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0x83, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x13, 0x0f, 0x13, 0xd0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa7, 0x13, 0x03, 0x00, 0x00, 
-  0x13, 0x00, 0x13, 0xb0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x77, 0x13, 0x00, 
-  0x13, 0x47, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf7, 0x13, 0x18, 
-  0x13, 0xa8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x73, 
-  0x13, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xb3, 
-  0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd4, 
-  0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd4, 
-  0x13, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xb3, 
-  0x13, 0xa8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x73, 
-  0x13, 0x44, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf7, 0x13, 0x18, 
-  0x13, 0x00, 0x13, 0xb0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x74, 0x13, 0x00, 
-  0x00, 0x00, 0x13, 0x0f, 0x13, 0xd0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa7, 0x13, 0x03, 0x00, 0x00, 
-  0x00, 0x00, 0x13, 0x00, 0x13, 0x0f, 0x13, 0xab, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0x80, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x3c, 0x13, 0x9b, 0x13, 0xdb, 0x13, 0xfb, 0x13, 0xf7, 0x13, 0xcf, 0x13, 0x8b, 0x13, 0x24, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x07, 0x13, 0x3c, 0x13, 0x9c, 0x13, 0xdb, 0x13, 0xfb, 0x13, 0xf7, 0x13, 0xd0, 0x13, 0x8b, 0x13, 0x24, 0x85, 0x00, 0x00, 0x01, 0x13, 0x0f, 0x13, 0xab, 
+  0x86, 0x13, 0xff, 0x02, 0x13, 0xfb, 0x13, 0x83, 0x13, 0x03, 0x82, 0x00, 0x00, 0x01, 0x13, 0x0f, 0x13, 0xd0, 0x89, 0x13, 0xff, 0x01, 0x13, 0xa7, 0x13, 0x03, 0x81, 0x00, 0x00, 0x00, 0x13, 0xb0, 
+  0x8b, 0x13, 0xff, 0x02, 0x13, 0x77, 0x00, 0x00, 0x13, 0x47, 0x8c, 0x13, 0xff, 0x02, 0x13, 0xf7, 0x13, 0x18, 0x13, 0xa8, 0x8d, 0x13, 0xff, 0x01, 0x13, 0x73, 0x13, 0xec, 0x8d, 0x13, 0xff, 0x00, 
+  0x13, 0xb3, 0x8e, 0x13, 0xff, 0x00, 0x13, 0xd4, 0x8e, 0x13, 0xff, 0x01, 0x13, 0xd4, 0x13, 0xec, 0x8d, 0x13, 0xff, 0x01, 0x13, 0xb3, 0x13, 0xa8, 0x8d, 0x13, 0xff, 0x01, 0x13, 0x73, 0x13, 0x44, 
+  0x8c, 0x13, 0xff, 0x03, 0x13, 0xf7, 0x13, 0x18, 0x00, 0x00, 0x13, 0xb0, 0x8b, 0x13, 0xff, 0x00, 0x13, 0x74, 0x81, 0x00, 0x00, 0x01, 0x13, 0x0f, 0x13, 0xd0, 0x89, 0x13, 0xff, 0x01, 0x13, 0xa7, 
+  0x13, 0x03, 0x82, 0x00, 0x00, 0x01, 0x13, 0x0f, 0x13, 0xab, 0x86, 0x13, 0xff, 0x02, 0x13, 0xfb, 0x13, 0x80, 0x13, 0x03, 0x85, 0x00, 0x00, 0x07, 0x13, 0x3c, 0x13, 0x9b, 0x13, 0xdb, 0x13, 0xfb, 
+  0x13, 0xf7, 0x13, 0xcf, 0x13, 0x8b, 0x13, 0x24, 0x83, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x1f, 0x04, 0x3c, 0x1f, 0x04, 0x9c, 0x1f, 0x04, 0xdb, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0xd0, 0x1f, 0x04, 0x8b, 0x1f, 0x04, 0x24, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x1f, 0x04, 0x0f, 0x1f, 0x04, 0xab, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0x83, 0x1f, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0x04, 0x0f, 0x1f, 0x04, 0xd0, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xa7, 0x1f, 0x04, 0x03, 0x00, 0x00, 0x00, 
-  0x1f, 0x04, 0x00, 0x1f, 0x04, 0xb0, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0x77, 0x3f, 0x04, 0x00, 
-  0x1f, 0x04, 0x47, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0x18, 
-  0x1f, 0x04, 0xa8, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0x73, 
-  0x1f, 0x04, 0xec, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xb3, 
-  0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xd4, 
-  0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xd4, 
-  0x1f, 0x04, 0xec, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xb3, 
-  0x1f, 0x04, 0xa8, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0x73, 
-  0x1f, 0x04, 0x44, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0x18, 
-  0xff, 0x03, 0x00, 0x1f, 0x04, 0xb0, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0x74, 0x3f, 0x04, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0x04, 0x0f, 0x1f, 0x04, 0xd0, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xa7, 0x1f, 0x04, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x1f, 0x04, 0x0f, 0x1f, 0x04, 0xab, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xff, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0x80, 0x1f, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x1f, 0x04, 0x3c, 0x1f, 0x04, 0x9b, 0x1f, 0x04, 0xdb, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0xcf, 0x1f, 0x04, 0x8b, 0x1f, 0x04, 0x24, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x04, 0x3c, 0x1f, 0x04, 0x9c, 0x1f, 0x04, 0xdb, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0xd0, 0x1f, 0x04, 0x8b, 0x1f, 0x04, 
+  0x24, 0x85, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x04, 0x0f, 0x1f, 0x04, 0xab, 0x86, 0x1f, 0x04, 0xff, 0x02, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0x83, 0x1f, 0x04, 0x03, 0x82, 0x00, 0x00, 0x00, 0x01, 0x1f, 
+  0x04, 0x0f, 0x1f, 0x04, 0xd0, 0x89, 0x1f, 0x04, 0xff, 0x01, 0x1f, 0x04, 0xa7, 0x1f, 0x04, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0xb0, 0x8b, 0x1f, 0x04, 0xff, 0x02, 0x1f, 0x04, 0x77, 
+  0x00, 0x00, 0x00, 0x1f, 0x04, 0x47, 0x8c, 0x1f, 0x04, 0xff, 0x02, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0x18, 0x1f, 0x04, 0xa8, 0x8d, 0x1f, 0x04, 0xff, 0x01, 0x1f, 0x04, 0x73, 0x1f, 0x04, 0xec, 0x8d, 
+  0x1f, 0x04, 0xff, 0x00, 0x1f, 0x04, 0xb3, 0x8e, 0x1f, 0x04, 0xff, 0x00, 0x1f, 0x04, 0xd4, 0x8e, 0x1f, 0x04, 0xff, 0x01, 0x1f, 0x04, 0xd4, 0x1f, 0x04, 0xec, 0x8d, 0x1f, 0x04, 0xff, 0x01, 0x1f, 
+  0x04, 0xb3, 0x1f, 0x04, 0xa8, 0x8d, 0x1f, 0x04, 0xff, 0x01, 0x1f, 0x04, 0x73, 0x1f, 0x04, 0x44, 0x8c, 0x1f, 0x04, 0xff, 0x03, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0x18, 0x00, 0x00, 0x00, 0x1f, 0x04, 
+  0xb0, 0x8b, 0x1f, 0x04, 0xff, 0x00, 0x1f, 0x04, 0x74, 0x81, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x04, 0x0f, 0x1f, 0x04, 0xd0, 0x89, 0x1f, 0x04, 0xff, 0x01, 0x1f, 0x04, 0xa7, 0x1f, 0x04, 0x03, 0x82, 
+  0x00, 0x00, 0x00, 0x01, 0x1f, 0x04, 0x0f, 0x1f, 0x04, 0xab, 0x86, 0x1f, 0x04, 0xff, 0x02, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0x80, 0x1f, 0x04, 0x03, 0x85, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x04, 0x3c, 
+  0x1f, 0x04, 0x9b, 0x1f, 0x04, 0xdb, 0x1f, 0x04, 0xfb, 0x1f, 0x04, 0xf7, 0x1f, 0x04, 0xcf, 0x1f, 0x04, 0x8b, 0x1f, 0x04, 0x24, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x04, 0x1f, 0x3c, 0x04, 0x1f, 0x9c, 0x04, 0x1f, 0xdb, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0xd0, 0x04, 0x1f, 0x8b, 0x04, 0x1f, 0x24, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x1f, 0x00, 0x04, 0x1f, 0x0f, 0x04, 0x1f, 0xab, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0x83, 0x04, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x1f, 0x0f, 0x04, 0x1f, 0xd0, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xa7, 0x04, 0x1f, 0x03, 0x00, 0x00, 0x00, 
-  0x04, 0x1f, 0x00, 0x04, 0x1f, 0xb0, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0x77, 0x04, 0x3f, 0x00, 
-  0x04, 0x1f, 0x47, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0x18, 
-  0x04, 0x1f, 0xa8, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0x73, 
-  0x04, 0x1f, 0xec, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xb3, 
-  0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xd4, 
-  0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xd4, 
-  0x04, 0x1f, 0xec, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xb3, 
-  0x04, 0x1f, 0xa8, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0x73, 
-  0x04, 0x1f, 0x44, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0x18, 
-  0x03, 0xff, 0x00, 0x04, 0x1f, 0xb0, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0x74, 0x04, 0x3f, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x1f, 0x0f, 0x04, 0x1f, 0xd0, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xa7, 0x04, 0x1f, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x1f, 0x00, 0x04, 0x1f, 0x0f, 0x04, 0x1f, 0xab, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xff, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0x80, 0x04, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x04, 0x1f, 0x3c, 0x04, 0x1f, 0x9b, 0x04, 0x1f, 0xdb, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0xcf, 0x04, 0x1f, 0x8b, 0x04, 0x1f, 0x24, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x07, 0x04, 0x1f, 0x3c, 0x04, 0x1f, 0x9c, 0x04, 0x1f, 0xdb, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0xd0, 0x04, 0x1f, 0x8b, 0x04, 0x1f, 
+  0x24, 0x85, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1f, 0x0f, 0x04, 0x1f, 0xab, 0x86, 0x04, 0x1f, 0xff, 0x02, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0x83, 0x04, 0x1f, 0x03, 0x82, 0x00, 0x00, 0x00, 0x01, 0x04, 
+  0x1f, 0x0f, 0x04, 0x1f, 0xd0, 0x89, 0x04, 0x1f, 0xff, 0x01, 0x04, 0x1f, 0xa7, 0x04, 0x1f, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0xb0, 0x8b, 0x04, 0x1f, 0xff, 0x02, 0x04, 0x1f, 0x77, 
+  0x00, 0x00, 0x00, 0x04, 0x1f, 0x47, 0x8c, 0x04, 0x1f, 0xff, 0x02, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0x18, 0x04, 0x1f, 0xa8, 0x8d, 0x04, 0x1f, 0xff, 0x01, 0x04, 0x1f, 0x73, 0x04, 0x1f, 0xec, 0x8d, 
+  0x04, 0x1f, 0xff, 0x00, 0x04, 0x1f, 0xb3, 0x8e, 0x04, 0x1f, 0xff, 0x00, 0x04, 0x1f, 0xd4, 0x8e, 0x04, 0x1f, 0xff, 0x01, 0x04, 0x1f, 0xd4, 0x04, 0x1f, 0xec, 0x8d, 0x04, 0x1f, 0xff, 0x01, 0x04, 
+  0x1f, 0xb3, 0x04, 0x1f, 0xa8, 0x8d, 0x04, 0x1f, 0xff, 0x01, 0x04, 0x1f, 0x73, 0x04, 0x1f, 0x44, 0x8c, 0x04, 0x1f, 0xff, 0x03, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0x18, 0x00, 0x00, 0x00, 0x04, 0x1f, 
+  0xb0, 0x8b, 0x04, 0x1f, 0xff, 0x00, 0x04, 0x1f, 0x74, 0x81, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1f, 0x0f, 0x04, 0x1f, 0xd0, 0x89, 0x04, 0x1f, 0xff, 0x01, 0x04, 0x1f, 0xa7, 0x04, 0x1f, 0x03, 0x82, 
+  0x00, 0x00, 0x00, 0x01, 0x04, 0x1f, 0x0f, 0x04, 0x1f, 0xab, 0x86, 0x04, 0x1f, 0xff, 0x02, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0x80, 0x04, 0x1f, 0x03, 0x85, 0x00, 0x00, 0x00, 0x07, 0x04, 0x1f, 0x3c, 
+  0x04, 0x1f, 0x9b, 0x04, 0x1f, 0xdb, 0x04, 0x1f, 0xfb, 0x04, 0x1f, 0xf7, 0x04, 0x1f, 0xcf, 0x04, 0x1f, 0x8b, 0x04, 0x1f, 0x24, 0x83, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x00, 0x00, 0xff, 0x80, 0x00, 0x3c, 0xff, 0x80, 0x00, 0x9c, 0xff, 0x80, 0x00, 0xdb, 0xff, 0x80, 0x00, 0xfb, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 0x00, 0xd0, 0xff, 0x80, 0x00, 0x8b, 0xff, 0x80, 0x00, 0x24, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xff, 0x81, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xab, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xfb, 0xff, 0x80, 0x00, 0x83, 0xff, 0x81, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xd0, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xa7, 0xff, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0xb0, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0x77, 0xff, 0x83, 0x00, 0x00, 
-  0xff, 0x80, 0x00, 0x47, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x18, 
-  0xff, 0x80, 0x00, 0xa8, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0x73, 
-  0xff, 0x80, 0x00, 0xec, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xb3, 
-  0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xd4, 
-  0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xd4, 
-  0xff, 0x80, 0x00, 0xec, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xb3, 
-  0xff, 0x80, 0x00, 0xa8, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0x73, 
-  0xff, 0x80, 0x00, 0x44, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x18, 
-  0xff, 0x7c, 0x00, 0x00, 0xff, 0x80, 0x00, 0xb0, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0x74, 0xff, 0x83, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xd0, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xa7, 0xff, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x81, 0x00, 0x00, 0xff, 0x81, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xab, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xfb, 0xff, 0x80, 0x00, 0x80, 0xff, 0x81, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x00, 0x00, 0xff, 0x80, 0x00, 0x3c, 0xff, 0x80, 0x00, 0x9b, 0xff, 0x80, 0x00, 0xdb, 0xff, 0x80, 0x00, 0xfb, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 0x00, 0xcf, 0xff, 0x81, 0x00, 0x8b, 0xff, 0x80, 0x00, 0x24, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x3c, 0xff, 0x80, 0x00, 0x9c, 0xff, 0x80, 0x00, 0xdb, 0xff, 0x80, 0x00, 0xfb, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 
+  0x00, 0xd0, 0xff, 0x80, 0x00, 0x8b, 0xff, 0x80, 0x00, 0x24, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x81, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xab, 0x86, 0xff, 0x80, 0x00, 0xff, 0x02, 0xff, 0x80, 
+  0x00, 0xfb, 0xff, 0x80, 0x00, 0x83, 0xff, 0x81, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xd0, 0x89, 0xff, 0x80, 0x00, 0xff, 0x01, 0xff, 0x80, 
+  0x00, 0xa7, 0xff, 0x80, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xb0, 0x8b, 0xff, 0x80, 0x00, 0xff, 0x02, 0xff, 0x80, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 
+  0x00, 0x47, 0x8c, 0xff, 0x80, 0x00, 0xff, 0x02, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x18, 0xff, 0x80, 0x00, 0xa8, 0x8d, 0xff, 0x80, 0x00, 0xff, 0x01, 0xff, 0x80, 0x00, 0x73, 0xff, 0x80, 
+  0x00, 0xec, 0x8d, 0xff, 0x80, 0x00, 0xff, 0x00, 0xff, 0x80, 0x00, 0xb3, 0x8e, 0xff, 0x80, 0x00, 0xff, 0x00, 0xff, 0x80, 0x00, 0xd4, 0x8e, 0xff, 0x80, 0x00, 0xff, 0x01, 0xff, 0x80, 0x00, 0xd4, 
+  0xff, 0x80, 0x00, 0xec, 0x8d, 0xff, 0x80, 0x00, 0xff, 0x01, 0xff, 0x80, 0x00, 0xb3, 0xff, 0x80, 0x00, 0xa8, 0x8d, 0xff, 0x80, 0x00, 0xff, 0x01, 0xff, 0x80, 0x00, 0x73, 0xff, 0x80, 0x00, 0x44, 
+  0x8c, 0xff, 0x80, 0x00, 0xff, 0x03, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0xb0, 0x8b, 0xff, 0x80, 0x00, 0xff, 0x00, 0xff, 0x80, 0x00, 0x74, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xd0, 0x89, 0xff, 0x80, 0x00, 0xff, 0x01, 0xff, 0x80, 0x00, 0xa7, 0xff, 0x80, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0x81, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xab, 0x86, 0xff, 0x80, 0x00, 0xff, 0x02, 0xff, 0x80, 0x00, 0xfb, 0xff, 0x80, 0x00, 0x80, 0xff, 0x81, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 
+  0x00, 0x07, 0xff, 0x80, 0x00, 0x3c, 0xff, 0x80, 0x00, 0x9b, 0xff, 0x80, 0x00, 0xdb, 0xff, 0x80, 0x00, 0xfb, 0xff, 0x80, 0x00, 0xf7, 0xff, 0x80, 0x00, 0xcf, 0xff, 0x81, 0x00, 0x8b, 0xff, 0x80, 
+  0x00, 0x24, 0x83, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +64,7 @@ const lv_img_dsc_t info_update_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( info_update_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = info_update_16px_map,
 };
-
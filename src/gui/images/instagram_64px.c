@@ -10,271 +10,939 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_INSTAGRAM_64PX uint8_t instagram_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x0c, 0x4f, 0x17, 0x4f, 0x1f, 0x4f, 0x24, 0x6f, 0x27, 0x6f, 0x28, 0x6f, 0x2b, 0x6f, 0x2b, 0x6f, 0x2c, 0x6f, 0x2c, 0x6f, 0x2c, 0x6f, 0x2f, 0x6f, 0x2f, 0x6f, 0x2f, 0x6f, 0x2f, 0x6f, 0x30, 0x6f, 0x2b, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x34, 0x6b, 0x2f, 0x6b, 0x2f, 0x6b, 0x2f, 0x6b, 0x2c, 0x8b, 0x2c, 0x6b, 0x2b, 0x6b, 0x2b, 0x8b, 0x2b, 0x8b, 0x2c, 0x8b, 0x2b, 0x8b, 0x2b, 0x8b, 0x27, 0x8b, 0x24, 0x8b, 0x23, 0x8b, 0x1c, 0x8b, 0x14, 0x8b, 0x04, 0x8b, 0x00, 0x8b, 0x00, 0x4b, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x4f, 0x4f, 0x4f, 0x9f, 0x4f, 0xcf, 0x4f, 0xe3, 0x4f, 0xf7, 0x4f, 0xeb, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6b, 0xf0, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xe4, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x8b, 0xec, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xfc, 0x8b, 0xf0, 0x8b, 0xdc, 0x8b, 0xbc, 0x8b, 0x78, 0x8b, 0x24, 0x8b, 0x00, 0xa7, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x37, 0x4f, 0xe7, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xd4, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xf7, 0x6b, 0xe3, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfb, 0x6b, 0xd8, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfc, 0x8b, 0xef, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xfc, 0x8b, 0xd4, 0xa7, 0xa7, 0xa7, 0x0f, 0xc3, 0x00, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0x10, 0x4f, 0xaf, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xf0, 0x4f, 0xef, 0x6f, 0xfb, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xfb, 0x6b, 0xeb, 0x6b, 0xf7, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfc, 0x6b, 0xec, 0x6b, 0xe3, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfb, 0x8b, 0xf4, 0x8b, 0xf3, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xeb, 0x8b, 0xec, 0xa7, 0xec, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xef, 0xa7, 0x58, 0x87, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x4f, 0x00, 0x4f, 0x0b, 0x4f, 0xe0, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xe3, 0x6f, 0xf8, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xe7, 0x6b, 0xf8, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xf3, 0x6b, 0xd3, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xe4, 0x8b, 0xf8, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xd8, 0xa7, 0xf3, 0xa7, 0xfc, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0x7f, 0xa7, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x4f, 0x0f, 0x4f, 0xe8, 0x4f, 0xff, 0x4f, 0xff, 0x4f, 0xfb, 0x4f, 0xf8, 0x4f, 0xdc, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xfc, 0x6f, 0xfb, 0x6b, 0xdf, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xef, 0x6b, 0xe7, 0x6b, 0xf8, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfb, 0x6b, 0xf8, 0x8b, 0xec, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xf7, 0x8b, 0xec, 0x8b, 0xdf, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0x6b, 0xa7, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x4f, 0x00, 0x4f, 0x00, 0x4f, 0xa3, 0x4f, 0xff, 0x4f, 0xf8, 0x4f, 0xd7, 0x6f, 0xfc, 0x6f, 0xfb, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xdc, 0x6b, 0xfc, 0x6b, 0xfb, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xef, 0x6b, 0xeb, 0x6b, 0xf3, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xe7, 0x8b, 0xf7, 0x8b, 0xfb, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xdb, 0xa7, 0xf8, 0xa7, 0xf8, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xfc, 0xa7, 0x4c, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x6f, 0x00, 0x4f, 0x00, 0x4f, 0x43, 0x4f, 0xff, 0x4f, 0xd0, 0x6f, 0xf3, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xfc, 0x6f, 0xff, 0x6f, 0xe3, 0x6b, 0xf0, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xf8, 0x6b, 0xd8, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfc, 0x6b, 0xf8, 0x8b, 0xf0, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xfb, 0x8b, 0xeb, 0x8b, 0xe3, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xd3, 0xab, 0x07, 0x8b, 0x00, 0x00, 0x00, 
-  0x6b, 0x00, 0x6f, 0x00, 0x6f, 0xdf, 0x6f, 0xf8, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xf0, 0x6b, 0xec, 0x6b, 0xf4, 0x6b, 0xf7, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x67, 0xff, 0x63, 0xff, 0x6b, 0xf7, 0x8b, 0xef, 0x67, 0xd8, 0x8b, 0xd0, 0x8b, 0xe0, 0x87, 0xe3, 0x87, 0xe3, 0x8b, 0xe3, 0xaf, 0xdb, 0xb3, 0xd0, 0xb3, 0xdf, 0xb3, 0xe0, 0xb3, 0xe0, 0xb3, 0xe3, 0xb3, 0xe3, 0xaf, 0xe3, 0xaf, 0xe4, 0xaf, 0xe7, 0xaf, 0xe8, 0x8f, 0xec, 0x8b, 0xdf, 0x83, 0xf0, 0x83, 0xec, 0x83, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xab, 0x57, 0xa7, 0x00, 0x62, 0x00, 
-  0x6f, 0x00, 0x6f, 0x44, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xe3, 0x6b, 0xe4, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x8f, 0xf4, 0xdb, 0xcf, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xd7, 0xd3, 0xe0, 0xab, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xe0, 0xab, 0xe0, 0xcb, 0x00, 0x82, 0x00, 
-  0x6f, 0x00, 0x6f, 0xa3, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xff, 0x6f, 0xfb, 0x6f, 0xeb, 0x6b, 0xfb, 0x6b, 0xe4, 0x6b, 0xf0, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfb, 0xd7, 0xf0, 0xff, 0xdf, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xec, 0xd3, 0xf4, 0xa3, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xef, 0xab, 0xf0, 0xab, 0xe4, 0xcb, 0xff, 0xab, 0xff, 0xab, 0x33, 0xab, 0x00, 
-  0x6f, 0x0b, 0x6f, 0xcc, 0x6f, 0xff, 0x6f, 0xe7, 0x6b, 0xdf, 0x6b, 0xff, 0x6b, 0xfb, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xe8, 0xff, 0xef, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb, 0x83, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xe0, 0xab, 0xf4, 0xab, 0xfb, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xcb, 0x78, 0xcb, 0x00, 
-  0x6b, 0x17, 0x6b, 0xc8, 0x6b, 0xf8, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x93, 0xec, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xab, 0xfc, 0xa7, 0xf4, 0xa7, 0xef, 0xab, 0xe3, 0xcb, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xa7, 0xcb, 0x00, 
-  0x6b, 0x1f, 0x6b, 0xf4, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xe7, 0x8b, 0xd7, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd7, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0x8f, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xaf, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xaf, 0xff, 0xd3, 0xff, 0xd7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xa3, 0xf7, 0xcb, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xb8, 0xab, 0x03, 
-  0x6b, 0x23, 0x6b, 0xfb, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xff, 0x6b, 0xfb, 0x6b, 0xff, 0x6b, 0xec, 0x8b, 0xd7, 0x8b, 0xfc, 0x87, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff, 0x87, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0xaf, 0xff, 0xab, 0xff, 0xab, 0xff, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xab, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa7, 0xff, 0xa3, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc3, 0xcb, 0x08, 
-  0x6b, 0x24, 0x6b, 0xff, 0x6b, 0xe7, 0x8b, 0xeb, 0x8b, 0xfb, 0x8b, 0xe8, 0x8b, 0xf7, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0xd7, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x87, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0xab, 0xff, 0xab, 0xff, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xa7, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcb, 0xf3, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc7, 0xab, 0x08, 
-  0x8b, 0x24, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xaf, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xaf, 0xff, 0xcf, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xa7, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf7, 0xf8, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc7, 0xab, 0x08, 
-  0x8b, 0x27, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xf0, 0x8b, 0xec, 0x8b, 0xfc, 0x8b, 0xe7, 0xab, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xab, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xab, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc7, 0xcb, 0x0b, 
-  0x8b, 0x27, 0x8b, 0xff, 0x8b, 0xeb, 0x8b, 0xd3, 0x8b, 0xf7, 0x8b, 0xfb, 0x8b, 0xf8, 0x8b, 0xff, 0x87, 0xff, 0xd7, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xab, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xff, 0xca, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xab, 0xff, 0xa7, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc7, 0xcb, 0x0b, 
-  0x8b, 0x20, 0x8b, 0xf3, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x83, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xca, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xff, 0xca, 0xff, 0xcf, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xca, 0xff, 0xc6, 0xff, 0xca, 0xff, 0xca, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xab, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf8, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc8, 0xab, 0x0b, 
-  0x8b, 0x28, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x83, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xa2, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xca, 0xff, 0xc6, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xca, 0xff, 0xcb, 0xff, 0xa7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdc, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc8, 0xab, 0x0b, 
-  0x8b, 0x28, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xfc, 0xab, 0xff, 0xab, 0xf4, 0xaa, 0xdb, 0xa2, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xff, 0xce, 0xff, 0xce, 0xff, 0xca, 0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xab, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd8, 0xa7, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc8, 0xab, 0x0b, 
-  0xab, 0x24, 0xab, 0xef, 0xaa, 0xf0, 0xaa, 0xfc, 0xaa, 0xeb, 0xaa, 0xf4, 0xaa, 0xff, 0xaa, 0xff, 0xa6, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xca, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xa3, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc8, 0xab, 0x0b, 
-  0xaa, 0x27, 0xaa, 0xff, 0xaa, 0xfc, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xa3, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc8, 0xab, 0x0b, 
-  0xaa, 0x28, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xf7, 0xce, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xa3, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc8, 0xab, 0x0b, 
-  0xaa, 0x28, 0xaa, 0xff, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xeb, 0xca, 0xdb, 0xca, 0xfb, 0xca, 0xfb, 0xce, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xce, 0xff, 0xce, 0xff, 0xca, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xc9, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xa3, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xc8, 0xcb, 0x0b, 
-  0xaa, 0x28, 0xca, 0xff, 0xca, 0xd7, 0xca, 0xec, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xce, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xc9, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xa2, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xcb, 0xab, 0x0b, 
-  0xca, 0x27, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xce, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xc9, 0xff, 0xee, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xca, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xc2, 0xeb, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xcb, 0xab, 0x0b, 
-  0xca, 0x28, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xfc, 0xca, 0xd7, 0xc9, 0xdb, 0xf2, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xc2, 0xff, 0xca, 0xdb, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xcb, 0xab, 0x0b, 
-  0xca, 0x27, 0xca, 0xf4, 0xca, 0xf3, 0xca, 0xf3, 0xe9, 0xe0, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xee, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xe7, 0xab, 0xfc, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xcb, 0xab, 0x0b, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xfb, 0xcb, 0xf8, 0xab, 0xff, 0xab, 0xff, 0xab, 0xff, 0xab, 0xcb, 0xab, 0x0c, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xea, 0xff, 0xca, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xec, 0xcb, 0xf7, 0xab, 0xff, 0xab, 0xff, 0xab, 0xcb, 0xab, 0x0c, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf3, 0xcb, 0xf7, 0xab, 0xff, 0xab, 0xcc, 0xcb, 0x0c, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf4, 0xab, 0xff, 0xab, 0xcc, 0xab, 0x0c, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf4, 0xcb, 0xf0, 0xab, 0xcc, 0xab, 0x0c, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xee, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xec, 0xab, 0xcf, 0xab, 0x0c, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0xef, 0xed, 0xf3, 0xf2, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xbc, 0xab, 0x0f, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe3, 0xed, 0xef, 0xed, 0xf8, 0xed, 0xff, 0xf1, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xdb, 0xca, 0x13, 
-  0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xf8, 0xed, 0xe8, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf1, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xce, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xc2, 0xe7, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xd0, 0xca, 0x0f, 
-  0xe9, 0x20, 0xed, 0xf3, 0xed, 0xf7, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xce, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xc2, 0xf4, 0xca, 0xfc, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcc, 0xca, 0x0c, 
-  0xed, 0x28, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xca, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xc6, 0xff, 0xca, 0xe3, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcc, 0xca, 0x0c, 
-  0xed, 0x28, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xec, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd7, 0xc6, 0xff, 0xca, 0xfb, 0xca, 0xeb, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcc, 0xca, 0x0c, 
-  0xed, 0x28, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdc, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf7, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcc, 0xca, 0x0c, 
-  0xed, 0x27, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xf1, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xe4, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xef, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf8, 0xca, 0xf4, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcc, 0xca, 0x0c, 
-  0xed, 0x27, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xec, 0xfc, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xe0, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcc, 0xca, 0x0c, 
-  0xed, 0x27, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xfb, 0xf1, 0xeb, 0xf1, 0xf3, 0xf6, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf4, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcb, 0xca, 0x0c, 
-  0xed, 0x27, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf1, 0xe7, 0xf1, 0xf0, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xe3, 0xca, 0xff, 0xca, 0xff, 0xca, 0xcb, 0xca, 0x0c, 
-  0xed, 0x27, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf1, 0xe0, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0xd0, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xfc, 0xca, 0xef, 0xca, 0xff, 0xca, 0xcb, 0xca, 0x0b, 
-  0xed, 0x27, 0xed, 0xff, 0xed, 0xf0, 0xf1, 0xf4, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf6, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xe5, 0xfb, 0xca, 0xec, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf4, 0xca, 0xff, 0xca, 0xc7, 0xca, 0x0b, 
-  0xed, 0x23, 0xed, 0xe4, 0xf1, 0xfc, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xea, 0xfc, 0xe9, 0xff, 0xea, 0xd3, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xe7, 0xca, 0xff, 0xca, 0xc3, 0xca, 0x07, 
-  0xf1, 0x17, 0xf1, 0xe3, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xf8, 0xf5, 0xf4, 0xf5, 0xf0, 0xf5, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf2, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xca, 0xef, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xf7, 0xca, 0xfc, 0xca, 0xb4, 0xe6, 0x00, 
-  0xf1, 0x0f, 0xf1, 0xd0, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf5, 0xf0, 0xf5, 0xf7, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xf2, 0xe7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xca, 0xf0, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xdc, 0xca, 0x98, 0xca, 0x00, 
-  0xf1, 0x00, 0xf1, 0xb3, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf5, 0xe4, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xdb, 0xff, 0xf7, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe8, 0xe9, 0xfc, 0xe9, 0xfb, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xca, 0xf3, 0xca, 0xfb, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xe8, 0xca, 0x60, 0xca, 0x00, 
-  0xf1, 0x00, 0xf1, 0x6f, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf5, 0xeb, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xe8, 0xf5, 0xf7, 0xf9, 0xef, 0xf9, 0xf8, 0xf9, 0xfb, 0xff, 0xfb, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xe8, 0xfb, 0xf4, 0xf2, 0xeb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xca, 0xfc, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0x0c, 0xca, 0x00, 
-  0xf1, 0x00, 0xf0, 0x00, 0xf1, 0xff, 0xf1, 0xff, 0xf5, 0xdf, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xe7, 0xf9, 0xfc, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xe3, 0xf9, 0xd4, 0xf9, 0xdf, 0xf9, 0xe3, 0xf9, 0xd7, 0xfa, 0xdb, 0xfe, 0xdc, 0xff, 0xd3, 0xff, 0xd0, 0xff, 0xd3, 0xff, 0xd0, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xdc, 0xff, 0xd4, 0xff, 0xd4, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xdc, 0xff, 0xdb, 0xff, 0xd8, 0xff, 0xd7, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xfb, 0xd8, 0xfb, 0xd4, 0xf6, 0xdc, 0xf2, 0xfb, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xca, 0xf0, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xaf, 0xca, 0x00, 0x00, 0x00, 
-  0xf1, 0x00, 0xf1, 0x00, 0xf1, 0x6c, 0xf5, 0xf7, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xf8, 0xf9, 0xe0, 0xf9, 0xff, 0xf9, 0xef, 0xf9, 0xef, 0xf9, 0xf3, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xf7, 0xf9, 0xf4, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xe4, 0xf9, 0xf7, 0xf9, 0xfb, 0xf5, 0xeb, 0xf5, 0xf0, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xe7, 0xf1, 0xfc, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xf3, 0xf0, 0xf3, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xe4, 0xec, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xf0, 0xe9, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xca, 0xd3, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0x1c, 0xca, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xf1, 0x00, 0xf5, 0x08, 0xf5, 0xdc, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xf0, 0xf9, 0xf7, 0xf9, 0xff, 0xf9, 0xe8, 0xf9, 0xfb, 0xf9, 0xff, 0xf9, 0xe8, 0xf9, 0xdf, 0xf9, 0xff, 0xf9, 0xfc, 0xf9, 0xfb, 0xf9, 0xff, 0xf9, 0xe8, 0xf9, 0xd0, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xf8, 0xf9, 0xe7, 0xf9, 0xf8, 0xf5, 0xdb, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xf4, 0xf5, 0xfc, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xf0, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xfc, 0xed, 0xf0, 0xed, 0xff, 0xed, 0xff, 0xed, 0xe3, 0xed, 0xfc, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xca, 0xff, 0xca, 0xff, 0xca, 0xff, 0xca, 0x8c, 0xca, 0x00, 0xca, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x50, 0xf5, 0xfc, 0xf5, 0xff, 0xf5, 0xf8, 0xf9, 0xf0, 0xf9, 0xfc, 0xf9, 0xd8, 0xf9, 0xff, 0xf9, 0xfb, 0xf9, 0xdf, 0xf9, 0xfc, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xf4, 0xf9, 0xe8, 0xf9, 0xfc, 0xf9, 0xf4, 0xf9, 0xf0, 0xf9, 0xfc, 0xf5, 0xeb, 0xf5, 0xff, 0xf5, 0xf8, 0xf5, 0xf4, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xfc, 0xf1, 0xeb, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xe4, 0xed, 0xff, 0xed, 0xff, 0xed, 0xf4, 0xed, 0xf7, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xdc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xca, 0xe8, 0xca, 0xff, 0xca, 0xdf, 0xca, 0x0c, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf5, 0x5c, 0xf5, 0xff, 0xf9, 0xf0, 0xf9, 0xff, 0xf9, 0xec, 0xf9, 0xff, 0xf9, 0xef, 0xf9, 0xf4, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xfc, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf8, 0xf9, 0xe8, 0xf9, 0xe8, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xf4, 0xf5, 0xf8, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xe7, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xf8, 0xed, 0xf4, 0xed, 0xff, 0xed, 0xff, 0xed, 0xcc, 0xe9, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xfb, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xca, 0xdc, 0xca, 0xdb, 0xca, 0x1c, 0xca, 0x00, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xf5, 0x00, 0xf9, 0x57, 0xf9, 0xf7, 0xf9, 0xe7, 0xf9, 0xff, 0xf9, 0xe4, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xf0, 0xf9, 0xf8, 0xf9, 0xfb, 0xf9, 0xf4, 0xf5, 0xd3, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xe4, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xf7, 0xf1, 0xfc, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xf8, 0xed, 0xf7, 0xed, 0xff, 0xed, 0xff, 0xed, 0xf0, 0xe9, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xcb, 0xca, 0x1b, 0xaa, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x00, 0xf9, 0x00, 0xf9, 0x2f, 0xf9, 0xb0, 0xf9, 0xf7, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xe3, 0xf9, 0xff, 0xf9, 0xef, 0xf9, 0xff, 0xf5, 0xe0, 0xf5, 0xff, 0xf5, 0xf8, 0xf5, 0xf7, 0xf5, 0xff, 0xf5, 0xff, 0xf1, 0xdb, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xed, 0xec, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xeb, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x7f, 0xe9, 0x08, 0xca, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0xf9, 0x00, 0xf9, 0x03, 0xf9, 0x38, 0xf9, 0xcf, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xd4, 0xf9, 0xff, 0xf9, 0xef, 0xf9, 0xf4, 0xf5, 0xff, 0xf5, 0xfc, 0xf5, 0xfc, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xf4, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xd8, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xdb, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0xe4, 0xe9, 0x8b, 0xe9, 0x10, 0xe9, 0x00, 0xe9, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x10, 0xf9, 0x50, 0xf9, 0x8c, 0xf9, 0xa8, 0xf9, 0xb3, 0xf9, 0xbc, 0xf9, 0xbf, 0xf9, 0xbf, 0xf9, 0xc0, 0xf9, 0xc0, 0xf9, 0xc0, 0xf9, 0xc3, 0xf9, 0xc3, 0xf9, 0xc3, 0xf9, 0xc3, 0xf9, 0xc4, 0xf9, 0xbf, 0xf9, 0xc3, 0xf9, 0xa4, 0xf9, 0xb3, 0xf5, 0xbf, 0xf5, 0xc3, 0xf5, 0xb4, 0xf5, 0xc7, 0xf5, 0xc4, 0xf5, 0xc4, 0xf1, 0xb7, 0xf1, 0xc4, 0xf1, 0xc4, 0xf1, 0xbc, 0xed, 0xc4, 0xed, 0xc4, 0xed, 0xc4, 0xed, 0xb8, 0xed, 0xc4, 0xed, 0xc4, 0xed, 0xc3, 0xed, 0xc3, 0xe9, 0xbc, 0xe9, 0xb0, 0xe9, 0xa4, 0xe9, 0x78, 0xe9, 0x43, 0xf0, 0x00, 0xe9, 0x00, 0xc9, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0xe3, 0x00, 0xf9, 0x04, 0xf9, 0x07, 0xf9, 0x07, 0xf9, 0x07, 0xf9, 0x07, 0xf9, 0x07, 0xf9, 0x07, 0xf9, 0x07, 0xf9, 0x08, 0xf9, 0x08, 0xf9, 0x08, 0xf9, 0x08, 0xf9, 0x07, 0xf9, 0x08, 0xf9, 0x07, 0xf5, 0x07, 0xf5, 0x07, 0xf5, 0x08, 0xf5, 0x08, 0xf5, 0x08, 0xf5, 0x08, 0xf1, 0x08, 0xf1, 0x08, 0xf1, 0x08, 0xf1, 0x08, 0xed, 0x08, 0xed, 0x08, 0xed, 0x08, 0xed, 0x08, 0xed, 0x08, 0xed, 0x08, 0xed, 0x08, 0xed, 0x07, 0xed, 0x04, 0xe5, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8a, 0x00, 0x00, 0x05, 0x4f, 0x0c, 0x4f, 0x17, 0x4f, 0x1f, 0x4f, 0x24, 0x6f, 0x27, 0x6f, 0x28, 0x81, 0x6f, 0x2b, 0x82, 0x6f, 0x2c, 0x83, 0x6f, 0x2f, 0x01, 0x6f, 0x30, 
+  0x6f, 0x2b, 0x87, 0x6b, 0x34, 0x82, 0x6b, 0x2f, 0x01, 0x6b, 0x2c, 0x8b, 0x2c, 0x81, 0x6b, 0x2b, 0x01, 0x8b, 0x2b, 0x8b, 0x2c, 0x81, 0x8b, 0x2b, 0x05, 0x8b, 0x27, 0x8b, 0x24, 0x8b, 0x23, 0x8b, 
+  0x1c, 0x8b, 0x14, 0x8b, 0x04, 0x93, 0x00, 0x00, 0x05, 0x4f, 0x4f, 0x4f, 0x9f, 0x4f, 0xcf, 0x4f, 0xe3, 0x4f, 0xf7, 0x4f, 0xeb, 0x8b, 0x6f, 0xff, 0x00, 0x6b, 0xf0, 0x86, 0x6b, 0xff, 0x00, 0x6b, 
+  0xe4, 0x85, 0x6b, 0xff, 0x00, 0x8b, 0xec, 0x85, 0x8b, 0xff, 0x05, 0x8b, 0xfc, 0x8b, 0xf0, 0x8b, 0xdc, 0x8b, 0xbc, 0x8b, 0x78, 0x8b, 0x24, 0x8f, 0x00, 0x00, 0x01, 0x4f, 0x37, 0x4f, 0xe7, 0x83, 
+  0x4f, 0xff, 0x00, 0x4f, 0xd4, 0x8a, 0x6f, 0xff, 0x01, 0x6f, 0xf7, 0x6b, 0xe3, 0x85, 0x6b, 0xff, 0x01, 0x6b, 0xfb, 0x6b, 0xd8, 0x84, 0x6b, 0xff, 0x01, 0x6b, 0xfc, 0x8b, 0xef, 0x8a, 0x8b, 0xff, 
+  0x03, 0x8b, 0xfc, 0x8b, 0xd4, 0xa7, 0xa7, 0xa7, 0x0f, 0x8b, 0x00, 0x00, 0x01, 0x4f, 0x10, 0x4f, 0xaf, 0x83, 0x4f, 0xff, 0x02, 0x4f, 0xf0, 0x4f, 0xef, 0x6f, 0xfb, 0x88, 0x6f, 0xff, 0x02, 0x6f, 
+  0xfb, 0x6b, 0xeb, 0x6b, 0xf7, 0x84, 0x6b, 0xff, 0x02, 0x6b, 0xfc, 0x6b, 0xec, 0x6b, 0xe3, 0x83, 0x6b, 0xff, 0x02, 0x6b, 0xfb, 0x8b, 0xf4, 0x8b, 0xf3, 0x89, 0x8b, 0xff, 0x02, 0x8b, 0xeb, 0x8b, 
+  0xec, 0xa7, 0xec, 0x81, 0xa7, 0xff, 0x01, 0xa7, 0xef, 0xa7, 0x58, 0x89, 0x00, 0x00, 0x01, 0x4f, 0x0b, 0x4f, 0xe0, 0x83, 0x4f, 0xff, 0x01, 0x4f, 0xe3, 0x6f, 0xf8, 0x89, 0x6f, 0xff, 0x01, 0x6f, 
+  0xe7, 0x6b, 0xf8, 0x85, 0x6b, 0xff, 0x01, 0x6b, 0xf3, 0x6b, 0xd3, 0x84, 0x6b, 0xff, 0x01, 0x6b, 0xe4, 0x8b, 0xf8, 0x8a, 0x8b, 0xff, 0x02, 0x8b, 0xd8, 0xa7, 0xf3, 0xa7, 0xfc, 0x84, 0xa7, 0xff, 
+  0x00, 0xa7, 0x7f, 0x87, 0x00, 0x00, 0x01, 0x4f, 0x0f, 0x4f, 0xe8, 0x81, 0x4f, 0xff, 0x02, 0x4f, 0xfb, 0x4f, 0xf8, 0x4f, 0xdc, 0x88, 0x6f, 0xff, 0x02, 0x6f, 0xfc, 0x6f, 0xfb, 0x6b, 0xdf, 0x85, 
+  0x6b, 0xff, 0x02, 0x6b, 0xef, 0x6b, 0xe7, 0x6b, 0xf8, 0x82, 0x6b, 0xff, 0x02, 0x6b, 0xfb, 0x6b, 0xf8, 0x8b, 0xec, 0x89, 0x8b, 0xff, 0x02, 0x8b, 0xf7, 0x8b, 0xec, 0x8b, 0xdf, 0x88, 0xa7, 0xff, 
+  0x00, 0xa7, 0x6b, 0x86, 0x00, 0x00, 0x05, 0x4f, 0xa3, 0x4f, 0xff, 0x4f, 0xf8, 0x4f, 0xd7, 0x6f, 0xfc, 0x6f, 0xfb, 0x88, 0x6f, 0xff, 0x02, 0x6f, 0xdc, 0x6b, 0xfc, 0x6b, 0xfb, 0x84, 0x6b, 0xff, 
+  0x02, 0x6b, 0xef, 0x6b, 0xeb, 0x6b, 0xf3, 0x83, 0x6b, 0xff, 0x02, 0x6b, 0xe7, 0x8b, 0xf7, 0x8b, 0xfb, 0x89, 0x8b, 0xff, 0x00, 0x8b, 0xdb, 0x81, 0xa7, 0xf8, 0x89, 0xa7, 0xff, 0x01, 0xa7, 0xfc, 
+  0xa7, 0x4c, 0x84, 0x00, 0x00, 0x03, 0x4f, 0x43, 0x4f, 0xff, 0x4f, 0xd0, 0x6f, 0xf3, 0x87, 0x6f, 0xff, 0x03, 0x6f, 0xfc, 0x6f, 0xff, 0x6f, 0xe3, 0x6b, 0xf0, 0x85, 0x6b, 0xff, 0x01, 0x6b, 0xf8, 
+  0x6b, 0xd8, 0x83, 0x6b, 0xff, 0x02, 0x6b, 0xfc, 0x6b, 0xf8, 0x8b, 0xf0, 0x89, 0x8b, 0xff, 0x02, 0x8b, 0xfb, 0x8b, 0xeb, 0x8b, 0xe3, 0x8d, 0xa7, 0xff, 0x01, 0xa7, 0xd3, 0xab, 0x07, 0x83, 0x00, 
+  0x00, 0x01, 0x6f, 0xdf, 0x6f, 0xf8, 0x87, 0x6f, 0xff, 0x03, 0x6f, 0xf0, 0x6b, 0xec, 0x6b, 0xf4, 0x6b, 0xf7, 0x82, 0x6b, 0xff, 0x06, 0x67, 0xff, 0x63, 0xff, 0x6b, 0xf7, 0x8b, 0xef, 0x67, 0xd8, 
+  0x8b, 0xd0, 0x8b, 0xe0, 0x81, 0x87, 0xe3, 0x03, 0x8b, 0xe3, 0xaf, 0xdb, 0xb3, 0xd0, 0xb3, 0xdf, 0x81, 0xb3, 0xe0, 0x81, 0xb3, 0xe3, 0x08, 0xaf, 0xe3, 0xaf, 0xe4, 0xaf, 0xe7, 0xaf, 0xe8, 0x8f, 
+  0xec, 0x8b, 0xdf, 0x83, 0xf0, 0x83, 0xec, 0x83, 0xff, 0x8f, 0xa7, 0xff, 0x00, 0xab, 0x57, 0x82, 0x00, 0x00, 0x00, 0x6f, 0x44, 0x87, 0x6f, 0xff, 0x01, 0x6f, 0xe3, 0x6b, 0xe4, 0x84, 0x6b, 0xff, 
+  0x03, 0x8f, 0xf4, 0xdb, 0xcf, 0xff, 0xdb, 0xff, 0xfb, 0x95, 0xff, 0xff, 0x03, 0xff, 0xf4, 0xff, 0xd7, 0xd3, 0xe0, 0xab, 0xff, 0x8c, 0xa7, 0xff, 0x01, 0xa7, 0xe0, 0xab, 0xe0, 0x82, 0x00, 0x00, 
+  0x00, 0x6f, 0xa3, 0x82, 0x6f, 0xff, 0x04, 0x6f, 0xfb, 0x6f, 0xeb, 0x6b, 0xfb, 0x6b, 0xe4, 0x6b, 0xf0, 0x83, 0x6b, 0xff, 0x03, 0x6b, 0xfb, 0xd7, 0xf0, 0xff, 0xdf, 0xff, 0xfc, 0x9b, 0xff, 0xff, 
+  0x03, 0xff, 0xef, 0xfb, 0xec, 0xd3, 0xf4, 0xa3, 0xff, 0x86, 0xa7, 0xff, 0x0d, 0xa7, 0xef, 0xab, 0xf0, 0xab, 0xe4, 0xcb, 0xff, 0xab, 0xff, 0xab, 0x33, 0x00, 0x00, 0x6f, 0x0b, 0x6f, 0xcc, 0x6f, 
+  0xff, 0x6f, 0xe7, 0x6b, 0xdf, 0x6b, 0xff, 0x6b, 0xfb, 0x85, 0x6b, 0xff, 0x02, 0x6b, 0xe8, 0xff, 0xef, 0xff, 0xfc, 0xa0, 0xff, 0xff, 0x01, 0xfb, 0xdb, 0x83, 0xff, 0x83, 0xa7, 0xff, 0x02, 0xa7, 
+  0xe0, 0xab, 0xf4, 0xab, 0xfb, 0x83, 0xab, 0xff, 0x04, 0xcb, 0x78, 0x00, 0x00, 0x6b, 0x17, 0x6b, 0xc8, 0x6b, 0xf8, 0x88, 0x6b, 0xff, 0x01, 0x93, 0xec, 0xff, 0xf4, 0xa3, 0xff, 0xff, 0x05, 0xff, 
+  0xe4, 0xab, 0xfc, 0xa7, 0xf4, 0xa7, 0xef, 0xab, 0xe3, 0xcb, 0xff, 0x85, 0xab, 0xff, 0x03, 0xab, 0xa7, 0x00, 0x00, 0x6b, 0x1f, 0x6b, 0xf4, 0x87, 0x6b, 0xff, 0x02, 0x6b, 0xe7, 0x8b, 0xd7, 0xff, 
+  0xf4, 0x84, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xd7, 0xff, 0x81, 0xb3, 0xff, 0x81, 0xaf, 0xff, 0x00, 0x8f, 0xff, 0x82, 0xaf, 0xff, 0x89, 0xab, 0xff, 0x00, 0xaf, 0xff, 0x81, 0xcf, 0xff, 0x03, 0xaf, 
+  0xff, 0xd3, 0xff, 0xd7, 0xff, 0xf7, 0xff, 0x85, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xa3, 0xf7, 0xcb, 0xff, 0x87, 0xab, 0xff, 0x03, 0xab, 0xb8, 0xab, 0x03, 0x6b, 0x23, 0x6b, 0xfb, 0x82, 0x6b, 0xff, 
+  0x06, 0x6b, 0xfb, 0x6b, 0xff, 0x6b, 0xec, 0x8b, 0xd7, 0x8b, 0xfc, 0x87, 0xff, 0xff, 0xeb, 0x84, 0xff, 0xff, 0x01, 0xab, 0xff, 0x87, 0xff, 0x83, 0x8b, 0xff, 0x00, 0xaf, 0xff, 0x81, 0xab, 0xff, 
+  0x00, 0xa7, 0xff, 0x87, 0xab, 0xff, 0x81, 0xaf, 0xff, 0x00, 0xab, 0xff, 0x86, 0xa7, 0xff, 0x01, 0xa3, 0xff, 0xf7, 0xff, 0x84, 0xff, 0xff, 0x01, 0xf7, 0xe0, 0xa7, 0xff, 0x87, 0xab, 0xff, 0x08, 
+  0xab, 0xc3, 0xcb, 0x08, 0x6b, 0x24, 0x6b, 0xff, 0x6b, 0xe7, 0x8b, 0xeb, 0x8b, 0xfb, 0x8b, 0xe8, 0x8b, 0xf7, 0x82, 0x8b, 0xff, 0x01, 0xd7, 0xf0, 0xff, 0xfc, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 
+  0x87, 0xff, 0x82, 0x8b, 0xff, 0x81, 0xab, 0xff, 0x00, 0xa7, 0xff, 0x96, 0xab, 0xff, 0x01, 0xa7, 0xff, 0xd3, 0xff, 0x83, 0xff, 0xff, 0x01, 0xff, 0xfb, 0xcb, 0xf3, 0x87, 0xab, 0xff, 0x02, 0xab, 
+  0xc7, 0xab, 0x08, 0x8b, 0x24, 0x88, 0x8b, 0xff, 0x00, 0xff, 0xdc, 0x83, 0xff, 0xff, 0x84, 0xab, 0xff, 0x00, 0xaf, 0xff, 0x8b, 0xab, 0xff, 0x01, 0xaf, 0xff, 0xcf, 0xff, 0x86, 0xab, 0xff, 0x00, 
+  0xa7, 0xff, 0x81, 0xcb, 0xff, 0x00, 0xa7, 0xff, 0x81, 0xab, 0xff, 0x00, 0xd3, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xfc, 0xf7, 0xf8, 0x87, 0xab, 0xff, 0x02, 0xab, 0xc7, 0xab, 0x08, 0x8b, 0x27, 
+  0x83, 0x8b, 0xff, 0x04, 0x8b, 0xf0, 0x8b, 0xec, 0x8b, 0xfc, 0x8b, 0xe7, 0xab, 0xd7, 0x83, 0xff, 0xff, 0x00, 0xaf, 0xff, 0x8e, 0xab, 0xff, 0x89, 0xcb, 0xff, 0x01, 0xab, 0xff, 0xcf, 0xff, 0x83, 
+  0xff, 0xff, 0x02, 0xcf, 0xff, 0xab, 0xff, 0xa3, 0xff, 0x83, 0xff, 0xff, 0x00, 0xff, 0xe7, 0x87, 0xab, 0xff, 0x0b, 0xab, 0xc7, 0xcb, 0x0b, 0x8b, 0x27, 0x8b, 0xff, 0x8b, 0xeb, 0x8b, 0xd3, 0x8b, 
+  0xf7, 0x8b, 0xfb, 0x8b, 0xf8, 0x8b, 0xff, 0x87, 0xff, 0xd7, 0xd0, 0x83, 0xff, 0xff, 0x00, 0xa7, 0xff, 0x86, 0xab, 0xff, 0x81, 0xcf, 0xff, 0x00, 0xab, 0xff, 0x81, 0xaa, 0xff, 0x81, 0xca, 0xff, 
+  0x8b, 0xaa, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x03, 0xfb, 0xff, 0xab, 0xff, 0xa7, 0xff, 0xcf, 0xff, 0x82, 0xff, 0xff, 0x00, 0xff, 0xf3, 0x87, 0xab, 0xff, 0x03, 0xab, 0xc7, 0xcb, 0x0b, 
+  0x8b, 0x20, 0x8b, 0xf3, 0x85, 0x8b, 0xff, 0x01, 0x83, 0xff, 0xff, 0xd8, 0x82, 0xff, 0xff, 0x00, 0xd7, 0xff, 0x83, 0xab, 0xff, 0x81, 0xcf, 0xff, 0x00, 0xca, 0xff, 0x85, 0xaa, 0xff, 0x81, 0xca, 
+  0xff, 0x00, 0xcf, 0xff, 0x83, 0xd3, 0xff, 0x01, 0xca, 0xff, 0xc6, 0xff, 0x81, 0xca, 0xff, 0x81, 0xcb, 0xff, 0x00, 0xcf, 0xff, 0x85, 0xff, 0xff, 0x02, 0xa7, 0xff, 0xab, 0xff, 0xa3, 0xff, 0x83, 
+  0xff, 0xff, 0x01, 0xcf, 0xf8, 0xa7, 0xff, 0x85, 0xab, 0xff, 0x02, 0xab, 0xc8, 0xab, 0x0b, 0x8b, 0x28, 0x86, 0x8b, 0xff, 0x01, 0x83, 0xff, 0xff, 0xf8, 0x82, 0xff, 0xff, 0x00, 0xd3, 0xff, 0x8b, 
+  0xaa, 0xff, 0x01, 0xa2, 0xff, 0xd7, 0xff, 0x86, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xca, 0xff, 0xc6, 0xff, 0x82, 0xca, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x04, 0xfb, 0xff, 0xca, 0xff, 0xcb, 
+  0xff, 0xa7, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xf7, 0xdc, 0xa7, 0xff, 0x85, 0xab, 0xff, 0x02, 0xab, 0xc8, 0xab, 0x0b, 0x8b, 0x28, 0x82, 0x8b, 0xff, 0x04, 0x8b, 0xfc, 0xab, 0xff, 0xab, 
+  0xf4, 0xaa, 0xdb, 0xa2, 0xf0, 0x83, 0xff, 0xff, 0x00, 0xd3, 0xff, 0x86, 0xaa, 0xff, 0x00, 0xca, 0xff, 0x81, 0xce, 0xff, 0x01, 0xca, 0xff, 0xce, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 
+  0xca, 0xff, 0x83, 0xff, 0xff, 0x00, 0xce, 0xff, 0x81, 0xca, 0xff, 0x01, 0xab, 0xff, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xd8, 0xa7, 0xff, 0x85, 0xab, 0xff, 0x07, 0xab, 0xc8, 0xab, 0x0b, 
+  0xab, 0x24, 0xab, 0xef, 0xaa, 0xf0, 0xaa, 0xfc, 0xaa, 0xeb, 0xaa, 0xf4, 0x81, 0xaa, 0xff, 0x00, 0xa6, 0xf7, 0x83, 0xff, 0xff, 0x00, 0xcf, 0xff, 0x88, 0xca, 0xff, 0x01, 0xc2, 0xff, 0xfb, 0xff, 
+  0x8d, 0xff, 0xff, 0x00, 0xd3, 0xff, 0x81, 0xca, 0xff, 0x03, 0xc2, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xc2, 0xff, 0x83, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xdc, 0xa3, 0xff, 
+  0x85, 0xab, 0xff, 0x04, 0xab, 0xc8, 0xab, 0x0b, 0xaa, 0x27, 0xaa, 0xff, 0xaa, 0xfc, 0x84, 0xaa, 0xff, 0x00, 0xca, 0xef, 0x83, 0xff, 0xff, 0x00, 0xce, 0xff, 0x87, 0xca, 0xff, 0x00, 0xc2, 0xff, 
+  0x90, 0xff, 0xff, 0x00, 0xce, 0xff, 0x88, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xdb, 0xa3, 0xff, 0x85, 0xab, 0xff, 0x02, 0xab, 0xc8, 0xab, 0x0b, 0xaa, 0x28, 0x85, 0xaa, 
+  0xff, 0x01, 0xaa, 0xf7, 0xce, 0xdc, 0x83, 0xff, 0xff, 0x00, 0xce, 0xff, 0x87, 0xca, 0xff, 0x00, 0xfb, 0xff, 0x85, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xf2, 0xff, 0x81, 0xee, 0xff, 0x00, 0xf7, 0xff, 
+  0x86, 0xff, 0xff, 0x00, 0xd3, 0xff, 0x87, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xd8, 0xa3, 0xff, 0x85, 0xab, 0xff, 0x02, 0xab, 0xc8, 0xab, 0x0b, 0xaa, 0x28, 0x82, 0xaa, 
+  0xff, 0x01, 0xca, 0xeb, 0xca, 0xdb, 0x81, 0xca, 0xfb, 0x00, 0xce, 0xdb, 0x83, 0xff, 0xff, 0x00, 0xce, 0xff, 0x81, 0xca, 0xff, 0x81, 0xce, 0xff, 0x00, 0xca, 0xff, 0x81, 0xea, 0xff, 0x00, 0xee, 
+  0xff, 0x84, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xee, 0xff, 0xc9, 0xff, 0x84, 0xca, 0xff, 0x01, 0xee, 0xff, 0xfb, 0xff, 0x84, 0xff, 0xff, 0x00, 0xce, 0xff, 0x86, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 
+  0xff, 0xff, 0x01, 0xff, 0xdb, 0xa3, 0xff, 0x85, 0xab, 0xff, 0x05, 0xab, 0xc8, 0xcb, 0x0b, 0xaa, 0x28, 0xca, 0xff, 0xca, 0xd7, 0xca, 0xec, 0x83, 0xca, 0xff, 0x00, 0xce, 0xe0, 0x83, 0xff, 0xff, 
+  0x01, 0xee, 0xff, 0xea, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xe5, 0xff, 0x84, 0xff, 0xff, 0x01, 0xf2, 0xff, 0xc9, 0xff, 0x87, 0xca, 0xff, 0x00, 0xc9, 0xff, 0x84, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x86, 
+  0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xa2, 0xff, 0x85, 0xab, 0xff, 0x02, 0xab, 0xcb, 0xab, 0x0b, 0xca, 0x27, 0x86, 0xca, 0xff, 0x00, 0xce, 0xe0, 0x83, 0xff, 0xff, 
+  0x00, 0xee, 0xff, 0x85, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x83, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xc9, 0xff, 0xee, 0xff, 0x88, 0xca, 0xff, 0x00, 0xc5, 0xff, 0x84, 0xff, 0xff, 0x02, 0xc2, 0xff, 0xca, 
+  0xff, 0xce, 0xff, 0x83, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe4, 0xc2, 0xeb, 0x85, 0xab, 0xff, 0x02, 0xab, 0xcb, 0xab, 0x0b, 0xca, 0x28, 0x83, 0xca, 0xff, 0x03, 0xca, 
+  0xfc, 0xca, 0xd7, 0xc9, 0xdb, 0xf2, 0xdb, 0x83, 0xff, 0xff, 0x00, 0xee, 0xff, 0x85, 0xe9, 0xff, 0x84, 0xff, 0xff, 0x00, 0xee, 0xff, 0x82, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x87, 0xca, 0xff, 0x00, 
+  0xf2, 0xff, 0x83, 0xff, 0xff, 0x00, 0xee, 0xff, 0x85, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe8, 0xc2, 0xff, 0xca, 0xdb, 0x84, 0xab, 0xff, 0x03, 0xab, 0xcb, 0xab, 0x0b, 
+  0xca, 0x27, 0xca, 0xf4, 0x81, 0xca, 0xf3, 0x01, 0xe9, 0xe0, 0xe9, 0xf8, 0x81, 0xe9, 0xff, 0x00, 0xee, 0xe3, 0x83, 0xff, 0xff, 0x00, 0xee, 0xff, 0x85, 0xe9, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 
+  0xff, 0x85, 0xe9, 0xff, 0x81, 0xee, 0xff, 0x84, 0xca, 0xff, 0x00, 0xee, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x85, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x04, 0xff, 0xeb, 0xc2, 
+  0xff, 0xca, 0xff, 0xca, 0xe7, 0xab, 0xfc, 0x82, 0xab, 0xff, 0x04, 0xab, 0xcb, 0xab, 0x0b, 0xe9, 0x28, 0xe9, 0xff, 0xe9, 0xfc, 0x84, 0xe9, 0xff, 0x00, 0xee, 0xe0, 0x83, 0xff, 0xff, 0x00, 0xee, 
+  0xff, 0x84, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x88, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x83, 0xca, 0xff, 0x84, 0xff, 0xff, 0x85, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 
+  0xff, 0xff, 0x04, 0xff, 0xe8, 0xc2, 0xff, 0xca, 0xff, 0xca, 0xfb, 0xcb, 0xf8, 0x82, 0xab, 0xff, 0x02, 0xab, 0xcb, 0xab, 0x0c, 0xe9, 0x28, 0x86, 0xe9, 0xff, 0x00, 0xee, 0xe0, 0x83, 0xff, 0xff, 
+  0x00, 0xee, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x83, 0xff, 0xff, 0x01, 0xf2, 0xff, 0xed, 0xff, 0x88, 0xe9, 0xff, 0x03, 0xee, 0xff, 0xea, 0xff, 0xca, 0xff, 0xc9, 0xff, 0x84, 0xff, 0xff, 
+  0x85, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe8, 0xc2, 0xff, 0x81, 0xca, 0xff, 0x01, 0xca, 0xec, 0xcb, 0xf7, 0x81, 0xab, 0xff, 0x02, 0xab, 0xcb, 0xab, 0x0c, 0xe9, 0x28, 
+  0x86, 0xe9, 0xff, 0x00, 0xee, 0xe0, 0x83, 0xff, 0xff, 0x01, 0xf2, 0xff, 0xee, 0xff, 0x83, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x82, 0xed, 0xff, 0x00, 0xee, 0xff, 
+  0x87, 0xe9, 0xff, 0x01, 0xee, 0xff, 0xca, 0xff, 0x84, 0xff, 0xff, 0x85, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe7, 0xc2, 0xff, 0x82, 0xca, 0xff, 0x05, 0xca, 0xf3, 0xcb, 
+  0xf7, 0xab, 0xff, 0xab, 0xcc, 0xcb, 0x0c, 0xe9, 0x28, 0x86, 0xe9, 0xff, 0x00, 0xee, 0xe0, 0x83, 0xff, 0xff, 0x86, 0xed, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x83, 0xe9, 0xff, 0x81, 0xed, 
+  0xff, 0x86, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x85, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe7, 0xc2, 0xff, 0x83, 0xca, 0xff, 0x04, 0xca, 
+  0xf4, 0xab, 0xff, 0xab, 0xcc, 0xab, 0x0c, 0xe9, 0x28, 0x86, 0xe9, 0xff, 0x00, 0xee, 0xe0, 0x83, 0xff, 0xff, 0x85, 0xed, 0xff, 0x00, 0xe9, 0xff, 0x84, 0xff, 0xff, 0x85, 0xe9, 0xff, 0x01, 0xed, 
+  0xff, 0xee, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x85, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe4, 0xc2, 0xff, 0x83, 0xca, 0xff, 
+  0x04, 0xca, 0xf4, 0xcb, 0xf0, 0xab, 0xcc, 0xab, 0x0c, 0xe9, 0x28, 0x86, 0xe9, 0xff, 0x00, 0xf2, 0xdf, 0x83, 0xff, 0xff, 0x86, 0xed, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 
+  0x86, 0xe9, 0xff, 0x01, 0xed, 0xff, 0xee, 0xff, 0x82, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x83, 0xff, 0xff, 0x01, 0xe5, 0xff, 0xee, 0xff, 0x84, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 
+  0xff, 0xe4, 0xc2, 0xff, 0x84, 0xca, 0xff, 0x03, 0xca, 0xec, 0xab, 0xcf, 0xab, 0x0c, 0xe9, 0x28, 0x83, 0xe9, 0xff, 0x03, 0xe9, 0xfb, 0xe9, 0xef, 0xed, 0xf3, 0xf2, 0xcb, 0x83, 0xff, 0xff, 0x86, 
+  0xed, 0xff, 0x00, 0xe8, 0xff, 0x84, 0xff, 0xff, 0x87, 0xe9, 0xff, 0x81, 0xed, 0xff, 0x01, 0xe9, 0xff, 0xf2, 0xff, 0x83, 0xff, 0xff, 0x03, 0xfb, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xee, 0xff, 0x83, 
+  0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe4, 0xc2, 0xff, 0x85, 0xca, 0xff, 0x02, 0xca, 0xbc, 0xab, 0x0f, 0xe9, 0x28, 0x82, 0xe9, 0xff, 0x04, 0xe9, 0xe3, 0xed, 0xef, 0xed, 
+  0xf8, 0xed, 0xff, 0xf1, 0xe4, 0x83, 0xff, 0xff, 0x86, 0xed, 0xff, 0x01, 0xe9, 0xff, 0xf7, 0xff, 0x84, 0xff, 0xff, 0x88, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x84, 0xff, 0xff, 0x00, 0xee, 0xff, 0x82, 
+  0xe9, 0xff, 0x00, 0xce, 0xff, 0x82, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe3, 0xc2, 0xff, 0x85, 0xca, 0xff, 0x05, 0xca, 0xdb, 0xca, 0x13, 0xe9, 0x28, 0xe9, 0xff, 0xe9, 
+  0xf8, 0xed, 0xe8, 0x83, 0xed, 0xff, 0x00, 0xf1, 0xe7, 0x83, 0xff, 0xff, 0x88, 0xed, 0xff, 0x85, 0xff, 0xff, 0x01, 0xf2, 0xff, 0xed, 0xff, 0x82, 0xe9, 0xff, 0x02, 0xed, 0xff, 0xf2, 0xff, 0xfb, 
+  0xff, 0x84, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xce, 0xff, 0x81, 0xca, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xe3, 0xc2, 0xe7, 0x85, 0xca, 0xff, 0x04, 0xca, 
+  0xd0, 0xca, 0x0f, 0xe9, 0x20, 0xed, 0xf3, 0xed, 0xf7, 0x84, 0xed, 0xff, 0x00, 0xf1, 0xeb, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x87, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x90, 0xff, 0xff, 0x00, 0xfb, 
+  0xff, 0x86, 0xe9, 0xff, 0x02, 0xce, 0xff, 0xca, 0xff, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe3, 0xc2, 0xf4, 0xca, 0xfc, 0x84, 0xca, 0xff, 0x02, 0xca, 0xcc, 0xca, 0x0c, 0xed, 0x28, 0x86, 
+  0xed, 0xff, 0x00, 0xed, 0xf0, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x88, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x8f, 0xff, 0xff, 0x87, 0xe9, 0xff, 0x02, 0xee, 0xff, 0xca, 0xff, 0xf7, 0xff, 0x82, 0xff, 
+  0xff, 0x02, 0xff, 0xdb, 0xc6, 0xff, 0xca, 0xe3, 0x84, 0xca, 0xff, 0x02, 0xca, 0xcc, 0xca, 0x0c, 0xed, 0x28, 0x86, 0xed, 0xff, 0x00, 0xec, 0xf8, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x89, 0xed, 
+  0xff, 0x00, 0xf2, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xed, 0xff, 0x87, 0xe9, 0xff, 0x01, 0xea, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x03, 0xfb, 0xd7, 0xc6, 0xff, 0xca, 0xfb, 0xca, 
+  0xeb, 0x83, 0xca, 0xff, 0x02, 0xca, 0xcc, 0xca, 0x0c, 0xed, 0x28, 0x86, 0xed, 0xff, 0x00, 0xe8, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x83, 0xf2, 0xff, 0x02, 0xf1, 0xff, 0xf2, 0xff, 0xf1, 
+  0xff, 0x84, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x88, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xed, 0xff, 0x81, 0xe9, 0xff, 0x81, 0xed, 0xff, 0x87, 0xe9, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x00, 0xfb, 
+  0xdc, 0x81, 0xca, 0xff, 0x00, 0xca, 0xf7, 0x83, 0xca, 0xff, 0x02, 0xca, 0xcc, 0xca, 0x0c, 0xed, 0x27, 0x86, 0xed, 0xff, 0x01, 0xe8, 0xff, 0xff, 0xe8, 0x82, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x89, 
+  0xf1, 0xff, 0x82, 0xed, 0xff, 0x01, 0xe8, 0xff, 0xf1, 0xff, 0x81, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xf2, 0xff, 0xe4, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x87, 0xe9, 0xff, 
+  0x83, 0xff, 0xff, 0x00, 0xf2, 0xef, 0x81, 0xca, 0xff, 0x01, 0xca, 0xf8, 0xca, 0xf4, 0x82, 0xca, 0xff, 0x02, 0xca, 0xcc, 0xca, 0x0c, 0xed, 0x27, 0x86, 0xed, 0xff, 0x01, 0xec, 0xfc, 0xff, 0xc8, 
+  0x83, 0xff, 0xff, 0x8c, 0xf1, 0xff, 0x86, 0xed, 0xff, 0x87, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x86, 0xe9, 0xff, 0x83, 0xff, 0xff, 0x83, 0xca, 0xff, 0x00, 0xca, 0xe0, 0x82, 0xca, 0xff, 0x02, 0xca, 
+  0xcc, 0xca, 0x0c, 0xed, 0x27, 0x84, 0xed, 0xff, 0x03, 0xed, 0xfb, 0xf1, 0xeb, 0xf1, 0xf3, 0xf6, 0xeb, 0x83, 0xff, 0xff, 0x86, 0xf1, 0xff, 0x00, 0xf6, 0xff, 0x86, 0xf1, 0xff, 0x85, 0xed, 0xff, 
+  0x87, 0xe9, 0xff, 0x00, 0xee, 0xff, 0x84, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x00, 0xff, 0xe7, 0x84, 0xca, 0xff, 0x00, 0xca, 0xf4, 0x81, 0xca, 0xff, 0x02, 0xca, 0xcb, 0xca, 0x0c, 
+  0xed, 0x27, 0x83, 0xed, 0xff, 0x01, 0xf1, 0xe7, 0xf1, 0xf0, 0x82, 0xf1, 0xff, 0x00, 0xff, 0xeb, 0x83, 0xff, 0xff, 0x8f, 0xf1, 0xff, 0x84, 0xed, 0xff, 0x86, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x83, 
+  0xe9, 0xff, 0x00, 0xee, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0x84, 0xca, 0xff, 0x00, 0xca, 0xe3, 0x81, 0xca, 0xff, 0x02, 0xca, 0xcb, 0xca, 0x0c, 0xed, 0x27, 0x82, 0xed, 0xff, 0x00, 0xf1, 
+  0xe0, 0x84, 0xf1, 0xff, 0x00, 0xff, 0xf3, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xf6, 0xff, 0x00, 0xf5, 0xff, 0x8a, 0xf1, 0xff, 0x84, 0xed, 0xff, 0x86, 0xe9, 0xff, 0x00, 0xed, 0xff, 0x82, 
+  0xe9, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0xfb, 0xf7, 0xd0, 0x84, 0xca, 0xff, 0x08, 0xca, 0xfc, 0xca, 0xef, 0xca, 0xff, 0xca, 0xcb, 0xca, 0x0b, 0xed, 0x27, 0xed, 0xff, 0xed, 
+  0xf0, 0xf1, 0xf4, 0x85, 0xf1, 0xff, 0x00, 0xf6, 0xf4, 0x84, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x84, 0xf5, 0xff, 0x00, 0xf6, 0xff, 0x81, 0xf5, 0xff, 0x87, 0xf1, 0xff, 0x84, 0xed, 0xff, 0x86, 0xe9, 
+  0xff, 0x02, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x02, 0xff, 0xec, 0xe5, 0xfb, 0xca, 0xec, 0x84, 0xca, 0xff, 0x06, 0xca, 0xf4, 0xca, 0xff, 0xca, 0xc7, 0xca, 0x0b, 0xed, 0x23, 
+  0xed, 0xe4, 0xf1, 0xfc, 0x87, 0xf1, 0xff, 0x00, 0xff, 0xd0, 0x85, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x85, 0xf5, 0xff, 0x00, 0xf6, 0xff, 0x87, 0xf1, 0xff, 0x84, 0xed, 0xff, 0x84, 0xe9, 0xff, 0x01, 
+  0xed, 0xff, 0xfb, 0xff, 0x84, 0xff, 0xff, 0x03, 0xff, 0xeb, 0xea, 0xfc, 0xe9, 0xff, 0xea, 0xd3, 0x84, 0xca, 0xff, 0x05, 0xca, 0xe7, 0xca, 0xff, 0xca, 0xc3, 0xca, 0x07, 0xf1, 0x17, 0xf1, 0xe3, 
+  0x85, 0xf1, 0xff, 0x04, 0xf1, 0xf8, 0xf5, 0xf4, 0xf5, 0xf0, 0xf5, 0xff, 0xff, 0xdf, 0x89, 0xff, 0xff, 0x8f, 0xfb, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xfb, 0xff, 0x86, 0xff, 0xff, 0x01, 0xff, 0xf8, 
+  0xf2, 0xfb, 0x82, 0xe9, 0xff, 0x00, 0xca, 0xef, 0x83, 0xca, 0xff, 0x05, 0xca, 0xf7, 0xca, 0xfc, 0xca, 0xb4, 0x00, 0x00, 0xf1, 0x0f, 0xf1, 0xd0, 0x84, 0xf1, 0xff, 0x01, 0xf5, 0xf0, 0xf5, 0xf7, 
+  0x83, 0xf5, 0xff, 0x00, 0xff, 0xe0, 0xa2, 0xff, 0xff, 0x01, 0xff, 0xe7, 0xf2, 0xe7, 0x83, 0xe9, 0xff, 0x00, 0xca, 0xf0, 0x84, 0xca, 0xff, 0x01, 0xca, 0xdc, 0xca, 0x98, 0x81, 0x00, 0x00, 0x00, 
+  0xf1, 0xb3, 0x83, 0xf1, 0xff, 0x00, 0xf5, 0xe4, 0x86, 0xf5, 0xff, 0x02, 0xfa, 0xdb, 0xff, 0xf7, 0xff, 0xfc, 0x9d, 0xff, 0xff, 0x04, 0xff, 0xfb, 0xff, 0xe8, 0xe9, 0xfc, 0xe9, 0xfb, 0xe9, 0xf8, 
+  0x82, 0xe9, 0xff, 0x01, 0xca, 0xf3, 0xca, 0xfb, 0x83, 0xca, 0xff, 0x01, 0xca, 0xe8, 0xca, 0x60, 0x81, 0x00, 0x00, 0x00, 0xf1, 0x6f, 0x82, 0xf1, 0xff, 0x00, 0xf5, 0xeb, 0x84, 0xf5, 0xff, 0x05, 
+  0xf5, 0xe8, 0xf5, 0xf7, 0xf9, 0xef, 0xf9, 0xf8, 0xf9, 0xfb, 0xff, 0xfb, 0x81, 0xff, 0xeb, 0x98, 0xff, 0xff, 0x03, 0xff, 0xfc, 0xff, 0xe8, 0xfb, 0xf4, 0xf2, 0xeb, 0x81, 0xe9, 0xff, 0x01, 0xe9, 
+  0xf8, 0xe9, 0xfb, 0x82, 0xe9, 0xff, 0x01, 0xe9, 0xf3, 0xca, 0xfc, 0x84, 0xca, 0xff, 0x00, 0xca, 0x0c, 0x82, 0x00, 0x00, 0x81, 0xf1, 0xff, 0x00, 0xf5, 0xdf, 0x84, 0xf5, 0xff, 0x01, 0xf5, 0xe7, 
+  0xf9, 0xfc, 0x81, 0xf9, 0xff, 0x0a, 0xf9, 0xe3, 0xf9, 0xd4, 0xf9, 0xdf, 0xf9, 0xe3, 0xf9, 0xd7, 0xfa, 0xdb, 0xfe, 0xdc, 0xff, 0xd3, 0xff, 0xd0, 0xff, 0xd3, 0xff, 0xd0, 0x82, 0xff, 0xd8, 0x00, 
+  0xff, 0xdc, 0x81, 0xff, 0xd4, 0x81, 0xff, 0xd3, 0x03, 0xff, 0xdc, 0xff, 0xdb, 0xff, 0xd8, 0xff, 0xd7, 0x82, 0xff, 0xd8, 0x03, 0xfb, 0xd8, 0xfb, 0xd4, 0xf6, 0xdc, 0xf2, 0xfb, 0x81, 0xed, 0xff, 
+  0x00, 0xe9, 0xef, 0x83, 0xe9, 0xff, 0x00, 0xe9, 0xef, 0x83, 0xe9, 0xff, 0x00, 0xca, 0xf0, 0x83, 0xca, 0xff, 0x00, 0xca, 0xaf, 0x83, 0x00, 0x00, 0x01, 0xf1, 0x6c, 0xf5, 0xf7, 0x83, 0xf5, 0xff, 
+  0x02, 0xf5, 0xf8, 0xf9, 0xe0, 0xf9, 0xff, 0x81, 0xf9, 0xef, 0x00, 0xf9, 0xf3, 0x81, 0xf9, 0xff, 0x01, 0xf9, 0xf7, 0xf9, 0xf4, 0x82, 0xf9, 0xff, 0x04, 0xf9, 0xe4, 0xf9, 0xf7, 0xf9, 0xfb, 0xf5, 
+  0xeb, 0xf5, 0xf0, 0x81, 0xf5, 0xff, 0x01, 0xf5, 0xe7, 0xf1, 0xfc, 0x81, 0xf1, 0xff, 0x01, 0xf1, 0xf3, 0xf0, 0xf3, 0x82, 0xf0, 0xff, 0x01, 0xec, 0xe4, 0xec, 0xff, 0x81, 0xed, 0xff, 0x00, 0xe9, 
+  0xf0, 0x81, 0xe9, 0xff, 0x81, 0xed, 0xff, 0x00, 0xed, 0xec, 0x83, 0xe9, 0xff, 0x00, 0xe9, 0xe0, 0x83, 0xe9, 0xff, 0x00, 0xca, 0xd3, 0x83, 0xca, 0xff, 0x00, 0xca, 0x1c, 0x83, 0x00, 0x00, 0x01, 
+  0xf5, 0x08, 0xf5, 0xdc, 0x82, 0xf5, 0xff, 0x0d, 0xf5, 0xf0, 0xf9, 0xf7, 0xf9, 0xff, 0xf9, 0xe8, 0xf9, 0xfb, 0xf9, 0xff, 0xf9, 0xe8, 0xf9, 0xdf, 0xf9, 0xff, 0xf9, 0xfc, 0xf9, 0xfb, 0xf9, 0xff, 
+  0xf9, 0xe8, 0xf9, 0xd0, 0x81, 0xf9, 0xff, 0x03, 0xf9, 0xf8, 0xf9, 0xe7, 0xf9, 0xf8, 0xf5, 0xdb, 0x81, 0xf5, 0xff, 0x01, 0xf5, 0xf4, 0xf5, 0xfc, 0x81, 0xf5, 0xff, 0x00, 0xf5, 0xf0, 0x82, 0xf1, 
+  0xff, 0x01, 0xf1, 0xfc, 0xed, 0xf0, 0x81, 0xed, 0xff, 0x01, 0xed, 0xe3, 0xed, 0xfc, 0x83, 0xed, 0xff, 0x00, 0xe9, 0xf3, 0x83, 0xe9, 0xff, 0x00, 0xe9, 0xef, 0x82, 0xe9, 0xff, 0x00, 0xe9, 0xf8, 
+  0x82, 0xca, 0xff, 0x00, 0xca, 0x8c, 0x85, 0x00, 0x00, 0x0a, 0xf5, 0x50, 0xf5, 0xfc, 0xf5, 0xff, 0xf5, 0xf8, 0xf9, 0xf0, 0xf9, 0xfc, 0xf9, 0xd8, 0xf9, 0xff, 0xf9, 0xfb, 0xf9, 0xdf, 0xf9, 0xfc, 
+  0x86, 0xf9, 0xff, 0x09, 0xf9, 0xf4, 0xf9, 0xe8, 0xf9, 0xfc, 0xf9, 0xf4, 0xf9, 0xf0, 0xf9, 0xfc, 0xf5, 0xeb, 0xf5, 0xff, 0xf5, 0xf8, 0xf5, 0xf4, 0x81, 0xf5, 0xff, 0x01, 0xf5, 0xfc, 0xf1, 0xeb, 
+  0x82, 0xf1, 0xff, 0x00, 0xed, 0xe4, 0x81, 0xed, 0xff, 0x01, 0xed, 0xf4, 0xed, 0xf7, 0x83, 0xed, 0xff, 0x00, 0xe9, 0xdc, 0x83, 0xe9, 0xff, 0x00, 0xe9, 0xcf, 0x83, 0xe9, 0xff, 0x03, 0xca, 0xe8, 
+  0xca, 0xff, 0xca, 0xdf, 0xca, 0x0c, 0x86, 0x00, 0x00, 0x07, 0xf5, 0x5c, 0xf5, 0xff, 0xf9, 0xf0, 0xf9, 0xff, 0xf9, 0xec, 0xf9, 0xff, 0xf9, 0xef, 0xf9, 0xf4, 0x89, 0xf9, 0xff, 0x00, 0xf9, 0xfc, 
+  0x81, 0xf9, 0xf4, 0x00, 0xf9, 0xf8, 0x81, 0xf9, 0xe8, 0x81, 0xf5, 0xff, 0x01, 0xf5, 0xf4, 0xf5, 0xf8, 0x81, 0xf5, 0xff, 0x00, 0xf5, 0xe7, 0x82, 0xf1, 0xff, 0x01, 0xf1, 0xf8, 0xed, 0xf4, 0x81, 
+  0xed, 0xff, 0x01, 0xed, 0xcc, 0xe9, 0xff, 0x82, 0xed, 0xff, 0x01, 0xed, 0xfb, 0xe9, 0xfb, 0x82, 0xe9, 0xff, 0x00, 0xe9, 0xf3, 0x83, 0xe9, 0xff, 0x02, 0xca, 0xdc, 0xca, 0xdb, 0xca, 0x1c, 0x88, 
+  0x00, 0x00, 0x04, 0xf9, 0x57, 0xf9, 0xf7, 0xf9, 0xe7, 0xf9, 0xff, 0xf9, 0xe4, 0x8d, 0xf9, 0xff, 0x04, 0xf9, 0xf0, 0xf9, 0xf8, 0xf9, 0xfb, 0xf9, 0xf4, 0xf5, 0xd3, 0x81, 0xf5, 0xff, 0x00, 0xf5, 
+  0xe4, 0x81, 0xf5, 0xff, 0x01, 0xf5, 0xf7, 0xf1, 0xfc, 0x81, 0xf1, 0xff, 0x01, 0xf1, 0xf8, 0xed, 0xf7, 0x81, 0xed, 0xff, 0x01, 0xed, 0xf0, 0xe9, 0xff, 0x83, 0xed, 0xff, 0x00, 0xe9, 0xe8, 0x83, 
+  0xe9, 0xff, 0x00, 0xe9, 0xfb, 0x82, 0xe9, 0xff, 0x01, 0xea, 0xcb, 0xca, 0x1b, 0x8a, 0x00, 0x00, 0x02, 0xf9, 0x2f, 0xf9, 0xb0, 0xf9, 0xf7, 0x8f, 0xf9, 0xff, 0x07, 0xf9, 0xe3, 0xf9, 0xff, 0xf9, 
+  0xef, 0xf9, 0xff, 0xf5, 0xe0, 0xf5, 0xff, 0xf5, 0xf8, 0xf5, 0xf7, 0x81, 0xf5, 0xff, 0x00, 0xf1, 0xdb, 0x82, 0xf1, 0xff, 0x00, 0xed, 0xec, 0x82, 0xed, 0xff, 0x00, 0xed, 0xeb, 0x83, 0xed, 0xff, 
+  0x00, 0xe9, 0xe8, 0x82, 0xe9, 0xff, 0x05, 0xe9, 0xfb, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x7f, 0xe9, 0x08, 0x8c, 0x00, 0x00, 0x02, 0xf9, 0x03, 0xf9, 0x38, 0xf9, 0xcf, 0x8f, 0xf9, 0xff, 
+  0x04, 0xf9, 0xd4, 0xf9, 0xff, 0xf9, 0xef, 0xf9, 0xf4, 0xf5, 0xff, 0x81, 0xf5, 0xfc, 0x81, 0xf5, 0xff, 0x00, 0xf5, 0xf4, 0x82, 0xf1, 0xff, 0x00, 0xf1, 0xd8, 0x82, 0xed, 0xff, 0x00, 0xed, 0xdb, 
+  0x83, 0xed, 0xff, 0x83, 0xe9, 0xff, 0x03, 0xe9, 0xfc, 0xe9, 0xe4, 0xe9, 0x8b, 0xe9, 0x10, 0x91, 0x00, 0x00, 0x05, 0xf9, 0x10, 0xf9, 0x50, 0xf9, 0x8c, 0xf9, 0xa8, 0xf9, 0xb3, 0xf9, 0xbc, 0x81, 
+  0xf9, 0xbf, 0x82, 0xf9, 0xc0, 0x83, 0xf9, 0xc3, 0x08, 0xf9, 0xc4, 0xf9, 0xbf, 0xf9, 0xc3, 0xf9, 0xa4, 0xf9, 0xb3, 0xf5, 0xbf, 0xf5, 0xc3, 0xf5, 0xb4, 0xf5, 0xc7, 0x81, 0xf5, 0xc4, 0x00, 0xf1, 
+  0xb7, 0x81, 0xf1, 0xc4, 0x00, 0xf1, 0xbc, 0x82, 0xed, 0xc4, 0x00, 0xed, 0xb8, 0x81, 0xed, 0xc4, 0x81, 0xed, 0xc3, 0x04, 0xe9, 0xbc, 0xe9, 0xb0, 0xe9, 0xa4, 0xe9, 0x78, 0xe9, 0x43, 0x99, 0x00, 
+  0x00, 0x00, 0xf9, 0x04, 0x86, 0xf9, 0x07, 0x83, 0xf9, 0x08, 0x02, 0xf9, 0x07, 0xf9, 0x08, 0xf9, 0x07, 0x81, 0xf5, 0x07, 0x83, 0xf5, 0x08, 0x83, 0xf1, 0x08, 0x86, 0xed, 0x08, 0x01, 0xed, 0x07, 
+  0xed, 0x04, 0x8e, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x4b, 0x00, 0x19, 0x4b, 0x00, 0x39, 0x4b, 0x00, 0x39, 0x53, 0x00, 0x59, 0x4b, 0x0c, 0x39, 0x4b, 0x17, 0x39, 0x4b, 0x1f, 0x39, 0x4b, 0x24, 0xb9, 0x52, 0x27, 0xb9, 0x52, 0x28, 0xba, 0x52, 0x2b, 0xba, 0x5a, 0x2b, 0xb9, 0x52, 0x2c, 0xb9, 0x52, 0x2c, 0xb9, 0x52, 0x2c, 0xb9, 0x5a, 0x2f, 0xb9, 0x52, 0x2f, 0xb9, 0x52, 0x2f, 0x9a, 0x52, 0x2f, 0xb9, 0x5a, 0x30, 0xb9, 0x5a, 0x2b, 0x18, 0x6a, 0x34, 0x18, 0x6a, 0x34, 0x18, 0x6a, 0x34, 0x18, 0x6a, 0x34, 0x18, 0x6a, 0x34, 0x18, 0x6a, 0x34, 0x18, 0x6a, 0x34, 0x38, 0x6a, 0x34, 0x19, 0x6a, 0x2f, 0xf9, 0x71, 0x2f, 0xf9, 0x71, 0x2f, 0xf9, 0x71, 0x2c, 0xf9, 0x71, 0x2c, 0xd9, 0x71, 0x2b, 0xd9, 0x71, 0x2b, 0xd9, 0x71, 0x2b, 0xd9, 0x79, 0x2c, 0xb9, 0x79, 0x2b, 0xb9, 0x79, 0x2b, 0xb9, 0x79, 0x27, 0xb9, 0x79, 0x24, 0xb9, 0x79, 0x23, 0xb9, 0x79, 0x1c, 0xb9, 0x79, 0x14, 0xd9, 0x71, 0x04, 0xb9, 0x79, 0x00, 0xb9, 0x79, 0x00, 0xd8, 0x49, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x53, 0x00, 0x39, 0x4b, 0x00, 0x17, 0x54, 0x00, 0x39, 0x4b, 0x4f, 0x39, 0x4b, 0x9f, 0x39, 0x4b, 0xcf, 0x39, 0x4b, 0xe3, 0x39, 0x4b, 0xf7, 0x19, 0x53, 0xeb, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0x79, 0x62, 0xf0, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x19, 0x6a, 0xe4, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xd9, 0x71, 0xec, 0xd9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xfc, 0xb9, 0x79, 0xf0, 0xb9, 0x79, 0xdc, 0xb9, 0x79, 0xbc, 0xb9, 0x79, 0x78, 0xb9, 0x71, 0x24, 0x98, 0x89, 0x00, 0x79, 0xa9, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x21, 0x00, 0x59, 0x4b, 0x00, 0xf9, 0x4a, 0x00, 0x39, 0x4b, 0x37, 0x39, 0x4b, 0xe7, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x19, 0x53, 0xd4, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xf7, 0x59, 0x62, 0xe3, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xfb, 0xf9, 0x69, 0xd8, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xfc, 0xd9, 0x71, 0xef, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xfc, 0x98, 0x89, 0xd4, 0x98, 0x99, 0xa7, 0x78, 0xa1, 0x0f, 0x1b, 0xc8, 0x00, 0xb7, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x4b, 0x00, 0x39, 0x4b, 0x00, 0x39, 0x4b, 0x10, 0x39, 0x4b, 0xaf, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xf0, 0xf9, 0x52, 0xef, 0xb9, 0x52, 0xfb, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xfb, 0x99, 0x5a, 0xeb, 0x38, 0x6a, 0xf7, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xfc, 0x19, 0x6a, 0xec, 0xf9, 0x71, 0xe3, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xfb, 0xd9, 0x71, 0xf4, 0xd9, 0x79, 0xf3, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xeb, 0xb8, 0x89, 0xec, 0x98, 0x91, 0xec, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xef, 0x98, 0x99, 0x58, 0x99, 0x91, 0x00, 0x98, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x21, 0x00, 0x39, 0x4b, 0x00, 0x18, 0x4b, 0x0b, 0x39, 0x4b, 0xe0, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xe3, 0xb9, 0x52, 0xf8, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xe7, 0x59, 0x62, 0xf8, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xf3, 0xf9, 0x71, 0xd3, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xe4, 0xd9, 0x79, 0xf8, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x81, 0xd8, 0x98, 0x91, 0xf3, 0x98, 0x99, 0xfc, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0x7f, 0x98, 0x99, 0x00, 0x97, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x53, 0x00, 0x39, 0x4b, 0x0f, 0x39, 0x4b, 0xe8, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xfb, 0x19, 0x4b, 0xf8, 0xf9, 0x52, 0xdc, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xfc, 0x99, 0x5a, 0xfb, 0x79, 0x62, 0xdf, 0x18, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x19, 0x6a, 0xef, 0x19, 0x6a, 0xe7, 0xf9, 0x71, 0xf8, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xfb, 0xd9, 0x71, 0xf8, 0xd9, 0x71, 0xec, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xf7, 0xb9, 0x81, 0xec, 0x98, 0x91, 0xdf, 0x97, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0x6b, 0x57, 0x91, 0x00, 0x77, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x39, 0x4b, 0x00, 0x5a, 0x4b, 0x00, 0x39, 0x4b, 0xa3, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xf8, 0x19, 0x4b, 0xd7, 0xd9, 0x52, 0xfc, 0xb9, 0x52, 0xfb, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x5a, 0xdc, 0x59, 0x62, 0xfc, 0x38, 0x6a, 0xfb, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x39, 0x6a, 0xef, 0xf9, 0x69, 0xeb, 0xf9, 0x71, 0xf3, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xff, 0xf9, 0x71, 0xe7, 0xd9, 0x79, 0xf7, 0xb9, 0x79, 0xfb, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x81, 0xdb, 0x98, 0x91, 0xf8, 0x98, 0x99, 0xf8, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xfc, 0x98, 0x99, 0x4c, 0xb8, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x99, 0x52, 0x00, 0x39, 0x4b, 0x00, 0x39, 0x4b, 0x43, 0x39, 0x4b, 0xff, 0x19, 0x53, 0xd0, 0xb9, 0x52, 0xf3, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xfc, 0xb9, 0x52, 0xff, 0x99, 0x5a, 0xe3, 0x39, 0x62, 0xf0, 0x18, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0x18, 0x6a, 0xf8, 0xf9, 0x69, 0xd8, 0xd9, 0x71, 0xff, 0xd9, 0x71, 0xff, 0xd9, 0x71, 0xff, 0xd9, 0x71, 0xff, 0xd9, 0x71, 0xfc, 0xd9, 0x71, 0xf8, 0xb9, 0x71, 0xf0, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xff, 0xb9, 0x79, 0xfb, 0xb9, 0x79, 0xeb, 0x98, 0x91, 0xe3, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xd3, 0x98, 0x99, 0x07, 0xf7, 0x91, 0x00, 0x00, 0x00, 0x00, 
-  0x9a, 0x52, 0x00, 0xf9, 0x52, 0x00, 0xd9, 0x52, 0xdf, 0xb9, 0x52, 0xf8, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xf0, 0x99, 0x5a, 0xec, 0x59, 0x62, 0xf4, 0x39, 0x6a, 0xf7, 0x18, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0x98, 0x61, 0xff, 0x98, 0x50, 0xff, 0x78, 0x58, 0xff, 0xd9, 0x69, 0xf7, 0x79, 0x72, 0xef, 0x59, 0x69, 0xd8, 0xfa, 0x79, 0xd0, 0xba, 0x79, 0xe0, 0x99, 0x71, 0xe3, 0x99, 0x71, 0xe3, 0xba, 0x79, 0xe3, 0x7b, 0x9b, 0xdb, 0xdb, 0xa3, 0xd0, 0xdb, 0xa3, 0xdf, 0xdb, 0xa3, 0xe0, 0xdb, 0xa3, 0xe0, 0xbb, 0xa3, 0xe3, 0x9b, 0xa3, 0xe3, 0x9b, 0x9b, 0xe3, 0x7b, 0x9b, 0xe4, 0x5a, 0x9b, 0xe7, 0x1a, 0x9b, 0xe8, 0xba, 0x92, 0xec, 0x5a, 0x8a, 0xdf, 0x99, 0x88, 0xf0, 0x17, 0x88, 0xec, 0x17, 0x90, 0xff, 0x17, 0x91, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x91, 0x57, 0x98, 0x91, 0x00, 0x0d, 0x68, 0x00, 
-  0xb9, 0x52, 0x00, 0xb9, 0x52, 0x44, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0x99, 0x52, 0xe3, 0x79, 0x62, 0xe4, 0x19, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0xf9, 0x7a, 0xf4, 0xfd, 0xcd, 0xcf, 0xbf, 0xff, 0xdb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfe, 0xf6, 0xd7, 0x7b, 0xcc, 0xe0, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x97, 0x99, 0xe0, 0xb6, 0xb1, 0xe0, 0xd6, 0xb1, 0x00, 0x71, 0x88, 0x00, 
-  0xba, 0x52, 0x00, 0xb9, 0x52, 0xa3, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xfb, 0xb9, 0x52, 0xeb, 0x79, 0x5a, 0xfb, 0x59, 0x62, 0xe4, 0x39, 0x6a, 0xf0, 0x18, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0xb8, 0x61, 0xfb, 0x3c, 0xb5, 0xf0, 0x5f, 0xf7, 0xdf, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xe6, 0xec, 0xd9, 0xb3, 0xf4, 0x77, 0x90, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x97, 0x99, 0xef, 0x97, 0xa1, 0xf0, 0xb6, 0xa9, 0xe4, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0x33, 0xb5, 0xb1, 0x00, 
-  0xb9, 0x52, 0x0b, 0xb9, 0x52, 0xcc, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xe7, 0x79, 0x5a, 0xdf, 0x38, 0x62, 0xff, 0x38, 0x6a, 0xfb, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0xf9, 0x69, 0xe8, 0xbf, 0xff, 0xef, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xe6, 0xdb, 0x17, 0x90, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x98, 0x99, 0xff, 0x97, 0x99, 0xe0, 0xb6, 0xa9, 0xf4, 0xb5, 0xb1, 0xfb, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0x78, 0xb5, 0xb1, 0x00, 
-  0x79, 0x62, 0x17, 0x79, 0x62, 0xc8, 0x39, 0x6a, 0xf8, 0x18, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0x9a, 0x8b, 0xec, 0xdf, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xee, 0xe4, 0xd8, 0x99, 0xfc, 0x97, 0x99, 0xf4, 0x97, 0xa1, 0xef, 0xb6, 0xa9, 0xe3, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xa7, 0xb6, 0xb1, 0x00, 
-  0x39, 0x6a, 0x1f, 0x38, 0x6a, 0xf4, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x39, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xe7, 0xf8, 0x79, 0xd7, 0xdf, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe6, 0xff, 0xfb, 0xbc, 0xff, 0x59, 0xac, 0xff, 0xb9, 0xa3, 0xff, 0x18, 0x9b, 0xff, 0xd8, 0x92, 0xff, 0xb8, 0x92, 0xff, 0xd8, 0x92, 0xff, 0x39, 0xa3, 0xff, 0xb8, 0xa2, 0xff, 0x57, 0x9a, 0xff, 0x77, 0xa2, 0xff, 0x57, 0xa2, 0xff, 0x37, 0xa2, 0xff, 0x37, 0xa2, 0xff, 0x37, 0xa2, 0xff, 0x37, 0x9a, 0xff, 0x37, 0x9a, 0xff, 0x37, 0x9a, 0xff, 0x57, 0x9a, 0xff, 0xb8, 0xaa, 0xff, 0x39, 0xb3, 0xff, 0x39, 0xb3, 0xff, 0x38, 0xb3, 0xff, 0xd9, 0xbb, 0xff, 0x99, 0xc4, 0xff, 0x5b, 0xd5, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xee, 0xdf, 0x15, 0xa8, 0xf7, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xb8, 0xd5, 0xa9, 0x03, 
-  0x38, 0x6a, 0x23, 0x38, 0x6a, 0xfb, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x38, 0x6a, 0xfb, 0x38, 0x6a, 0xff, 0x18, 0x72, 0xec, 0xf7, 0x79, 0xd7, 0xf7, 0x79, 0xfc, 0x57, 0x79, 0xff, 0x9f, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0xff, 0x78, 0x92, 0xff, 0x56, 0x79, 0xff, 0xd7, 0x81, 0xff, 0xf7, 0x81, 0xff, 0xd7, 0x81, 0xff, 0x17, 0x8a, 0xff, 0xd8, 0x9a, 0xff, 0x57, 0x9a, 0xff, 0x96, 0x91, 0xff, 0x96, 0x91, 0xff, 0x96, 0x91, 0xff, 0xb6, 0x91, 0xff, 0xb7, 0x91, 0xff, 0xb7, 0x91, 0xff, 0xd7, 0x99, 0xff, 0xd7, 0x99, 0xff, 0xb6, 0x99, 0xff, 0x17, 0xa2, 0xff, 0xd8, 0xb2, 0xff, 0x98, 0xb2, 0xff, 0x96, 0xa1, 0xff, 0x96, 0xa1, 0xff, 0x76, 0xa1, 0xff, 0x76, 0xa1, 0xff, 0x96, 0xa1, 0xff, 0x96, 0xa1, 0xff, 0x96, 0xa1, 0xff, 0x56, 0xa1, 0xff, 0x56, 0xa0, 0xff, 0x1b, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xdc, 0xe0, 0x55, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc3, 0xd5, 0xb1, 0x08, 
-  0x18, 0x6a, 0x24, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xe7, 0x18, 0x72, 0xeb, 0xf8, 0x71, 0xfb, 0xf7, 0x79, 0xe8, 0xf7, 0x79, 0xf7, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0x1b, 0xbd, 0xf0, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xde, 0xff, 0x17, 0x81, 0xff, 0x78, 0x92, 0xff, 0x37, 0x92, 0xff, 0xb7, 0x89, 0xff, 0x37, 0x9a, 0xff, 0xf7, 0x99, 0xff, 0x96, 0x91, 0xff, 0xd7, 0x99, 0xff, 0x57, 0xa2, 0xff, 0x57, 0xa2, 0xff, 0x16, 0x9a, 0xff, 0xb6, 0x99, 0xff, 0xd6, 0x99, 0xff, 0x16, 0xa2, 0xff, 0x36, 0xa2, 0xff, 0x56, 0xa2, 0xff, 0x56, 0xa2, 0xff, 0xb6, 0xa1, 0xff, 0x16, 0xa2, 0xff, 0x37, 0xaa, 0xff, 0x17, 0xaa, 0xff, 0x37, 0xaa, 0xff, 0x37, 0xaa, 0xff, 0x37, 0xaa, 0xff, 0x37, 0xaa, 0xff, 0x17, 0xaa, 0xff, 0xf6, 0xa9, 0xff, 0xd6, 0xa9, 0xff, 0xd6, 0xa9, 0xff, 0xd6, 0xa9, 0xff, 0x96, 0xa0, 0xff, 0x3a, 0xcc, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfb, 0x56, 0xba, 0xf3, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x08, 
-  0xf7, 0x79, 0x24, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0x3f, 0xf7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x38, 0x9a, 0xff, 0xb6, 0x91, 0xff, 0xb6, 0x91, 0xff, 0xb6, 0x91, 0xff, 0x78, 0xa2, 0xff, 0xd8, 0xaa, 0xff, 0x77, 0xa2, 0xff, 0xd5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xd5, 0x99, 0xff, 0xd5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0x96, 0xb2, 0xff, 0xb7, 0xba, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0x75, 0xb1, 0xff, 0x16, 0xb2, 0xff, 0x16, 0xba, 0xff, 0x55, 0xa9, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0x79, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7a, 0xdd, 0xf8, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x08, 
-  0xf7, 0x79, 0x27, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xf0, 0xf7, 0x81, 0xec, 0xd7, 0x81, 0xfc, 0xd6, 0x81, 0xe7, 0x97, 0x9a, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xaa, 0xff, 0x96, 0x99, 0xff, 0x77, 0xa2, 0xff, 0x56, 0xa2, 0xff, 0xd5, 0x99, 0xff, 0xb4, 0x99, 0xff, 0xb4, 0x99, 0xff, 0xb4, 0x99, 0xff, 0xb4, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xf5, 0xa1, 0xff, 0x55, 0xaa, 0xff, 0x55, 0xaa, 0xff, 0x35, 0xaa, 0xff, 0xd4, 0xa9, 0xff, 0x55, 0xb2, 0xff, 0x95, 0xba, 0xff, 0x55, 0xba, 0xff, 0x55, 0xba, 0xff, 0x75, 0xba, 0xff, 0x75, 0xba, 0xff, 0x75, 0xba, 0xff, 0x55, 0xba, 0xff, 0x55, 0xba, 0xff, 0x35, 0xba, 0xff, 0xd5, 0xb1, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xf7, 0xff, 0xf6, 0xba, 0xff, 0xb5, 0xb1, 0xff, 0x15, 0xa8, 0xff, 0xbd, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xe7, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x0b, 
-  0xf7, 0x79, 0x27, 0xf7, 0x79, 0xff, 0xf7, 0x79, 0xeb, 0xd7, 0x81, 0xd3, 0xd6, 0x89, 0xf7, 0xd6, 0x91, 0xfb, 0xd5, 0x91, 0xf8, 0xd5, 0x91, 0xff, 0x35, 0x89, 0xff, 0x7b, 0xd5, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xee, 0xff, 0x14, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb4, 0x99, 0xff, 0xb5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0x15, 0xa2, 0xff, 0xd6, 0xb2, 0xff, 0xb6, 0xba, 0xff, 0x14, 0xb2, 0xff, 0xd4, 0xb1, 0xff, 0xf4, 0xb1, 0xff, 0xf4, 0xb1, 0xff, 0xd4, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0x93, 0xb1, 0xff, 0x93, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0xb3, 0xb1, 0xff, 0x93, 0xb1, 0xff, 0xfb, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xe5, 0xff, 0x95, 0xb1, 0xff, 0x75, 0xb1, 0xff, 0xb7, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x0b, 
-  0xd6, 0x89, 0x20, 0xd6, 0x89, 0xf3, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0x15, 0x88, 0xff, 0x7f, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xcd, 0xff, 0xd5, 0x99, 0xff, 0x15, 0xa2, 0xff, 0xf4, 0xa1, 0xff, 0xf4, 0xa1, 0xff, 0xd5, 0xb2, 0xff, 0xd5, 0xba, 0xff, 0x53, 0xb2, 0xff, 0xf3, 0xb1, 0xff, 0xd2, 0xa9, 0xff, 0xb2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xf3, 0xb1, 0xff, 0x33, 0xb2, 0xff, 0x54, 0xb2, 0xff, 0x34, 0xb2, 0xff, 0xf5, 0xba, 0xff, 0xb6, 0xc3, 0xff, 0xf7, 0xcb, 0xff, 0xd7, 0xcb, 0xff, 0x96, 0xc3, 0xff, 0x14, 0xba, 0xff, 0x73, 0xb1, 0xff, 0x13, 0xba, 0xff, 0x54, 0xba, 0xff, 0x74, 0xba, 0xff, 0x74, 0xba, 0xff, 0x94, 0xba, 0xff, 0xbd, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0x95, 0xb1, 0xff, 0x95, 0xb1, 0xff, 0x14, 0xa8, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xc3, 0xf8, 0x95, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc8, 0xd5, 0xb1, 0x0b, 
-  0xd5, 0x91, 0x28, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0x15, 0x80, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xc4, 0xff, 0x13, 0xaa, 0xff, 0x53, 0xb2, 0xff, 0x13, 0xb2, 0xff, 0xd2, 0xa9, 0xff, 0xb2, 0xa9, 0xff, 0xb2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xb2, 0xa9, 0xff, 0xb2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xb2, 0xa9, 0xff, 0x11, 0xa8, 0xff, 0xd8, 0xd4, 0xff, 0xdc, 0xee, 0xff, 0x3e, 0xf7, 0xff, 0x9f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0x1a, 0xee, 0xff, 0x73, 0xca, 0xff, 0x10, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xd1, 0xc1, 0xff, 0x3a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xed, 0xff, 0x13, 0xc2, 0xff, 0x16, 0xb2, 0xff, 0x35, 0xa9, 0xff, 0x1c, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xdc, 0xdc, 0x55, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 
-  0xd5, 0x91, 0x28, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xff, 0xd5, 0x91, 0xfc, 0xd5, 0x91, 0xff, 0xd4, 0x99, 0xf4, 0xd3, 0xa9, 0xdb, 0x12, 0xa8, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0xc3, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xf2, 0xb1, 0xff, 0x92, 0xc2, 0xff, 0x92, 0xc2, 0xff, 0x51, 0xc2, 0xff, 0x33, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xed, 0xff, 0x11, 0xc2, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xb2, 0xc1, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xb3, 0xca, 0xff, 0xf1, 0xc1, 0xff, 0x73, 0xc2, 0xff, 0xb5, 0xb1, 0xff, 0x7b, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe5, 0xd8, 0xd5, 0xb0, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 
-  0xd5, 0x91, 0x24, 0xd5, 0x99, 0xef, 0xd4, 0x99, 0xf0, 0xd3, 0xa1, 0xfc, 0xd2, 0xa9, 0xeb, 0xd2, 0xb1, 0xf4, 0xd2, 0xb1, 0xff, 0xd2, 0xa9, 0xff, 0x52, 0xb1, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x55, 0xbb, 0xff, 0x73, 0xba, 0xff, 0x52, 0xba, 0xff, 0xf1, 0xb1, 0xff, 0x31, 0xba, 0xff, 0x71, 0xc2, 0xff, 0x50, 0xc2, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0x0e, 0xb8, 0xff, 0x1a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xd5, 0xd3, 0xff, 0xb1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0x10, 0xc0, 0xff, 0x77, 0xdc, 0xff, 0x97, 0xdc, 0xff, 0x70, 0xc0, 0xff, 0xd1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xd1, 0xc1, 0xff, 0x53, 0xc2, 0xff, 0x3a, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf6, 0xdc, 0x15, 0xa8, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 
-  0xd2, 0xa9, 0x27, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xfc, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0x13, 0xb2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xf2, 0xca, 0xff, 0x10, 0xc2, 0xff, 0x10, 0xc2, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0x0e, 0xb8, 0xff, 0x1d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xd2, 0xff, 0xd1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xd1, 0xc1, 0xff, 0x18, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xdb, 0x14, 0xa8, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 
-  0xd2, 0xa9, 0x28, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xb1, 0xf7, 0xb4, 0xc2, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xf2, 0xca, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xc1, 0xff, 0xf0, 0xb9, 0xff, 0xf0, 0xb9, 0xff, 0xf0, 0xb9, 0xff, 0x10, 0xc2, 0xff, 0x51, 0xc2, 0xff, 0x70, 0xc2, 0xff, 0x3a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xf9, 0xed, 0xff, 0x33, 0xe4, 0xff, 0xf0, 0xda, 0xff, 0x51, 0xdb, 0xff, 0xb5, 0xe4, 0xff, 0xbb, 0xf6, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xd3, 0xff, 0xd1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xd1, 0xc1, 0xff, 0xf8, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xd8, 0x14, 0xa8, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 
-  0xd2, 0xa9, 0x28, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xd1, 0xb1, 0xeb, 0xf0, 0xb9, 0xdb, 0xef, 0xc1, 0xfb, 0xef, 0xc1, 0xfb, 0x52, 0xd3, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x91, 0xc2, 0xff, 0xf0, 0xb9, 0xff, 0x51, 0xc2, 0xff, 0xf2, 0xca, 0xff, 0xd0, 0xd2, 0xff, 0x4d, 0xd2, 0xff, 0x4c, 0xd2, 0xff, 0x6d, 0xd2, 0xff, 0x70, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xe5, 0xff, 0xae, 0xd2, 0xff, 0xcc, 0xd1, 0xff, 0x0c, 0xd2, 0xff, 0x0d, 0xd2, 0xff, 0x0c, 0xd2, 0xff, 0xec, 0xd1, 0xff, 0xcc, 0xd1, 0xff, 0x70, 0xdb, 0xff, 0x9b, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf6, 0xff, 0xf2, 0xd2, 0xff, 0xd1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xdb, 0x14, 0xa8, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 
-  0xd2, 0xb1, 0x28, 0xd1, 0xb1, 0xff, 0xef, 0xb9, 0xd7, 0x0e, 0xc2, 0xec, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0xee, 0xc1, 0xff, 0x72, 0xd3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x51, 0xdb, 0xff, 0x6c, 0xd2, 0xff, 0x4b, 0xda, 0xff, 0x2b, 0xda, 0xff, 0x2b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xe8, 0xd0, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xe4, 0xff, 0xab, 0xc9, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x8c, 0xd1, 0xff, 0xdc, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xd3, 0xff, 0x70, 0xca, 0xff, 0x31, 0xc2, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xdf, 0x14, 0xa8, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 
-  0x0e, 0xc2, 0x27, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0xee, 0xc1, 0xff, 0x73, 0xd3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xed, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x2b, 0xda, 0xff, 0x52, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xed, 0xff, 0xeb, 0xd1, 0xff, 0x0f, 0xdb, 0xff, 0x2d, 0xd2, 0xff, 0x0c, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x6c, 0xd1, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x0c, 0xc0, 0xff, 0x50, 0xca, 0xff, 0xb2, 0xca, 0xff, 0xd1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe4, 0x11, 0xb8, 0xeb, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 
-  0x0e, 0xc2, 0x28, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xff, 0x0e, 0xc2, 0xfc, 0x0e, 0xca, 0xd7, 0x2c, 0xd2, 0xdb, 0xb0, 0xe3, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xed, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xea, 0xd1, 0xff, 0xbb, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xcd, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x2f, 0xdb, 0xff, 0x6d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x32, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xd2, 0xff, 0x0e, 0xca, 0xff, 0x2f, 0xca, 0xff, 0x71, 0xca, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xd7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe8, 0x10, 0xb8, 0xff, 0xd2, 0xb9, 0xdb, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 
-  0xef, 0xc1, 0x27, 0x0e, 0xc2, 0xf4, 0x0d, 0xca, 0xf3, 0x2d, 0xca, 0xf3, 0x2b, 0xd2, 0xe0, 0x4a, 0xda, 0xf8, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x8f, 0xe3, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xed, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xf6, 0xff, 0xea, 0xd1, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x2b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xee, 0xda, 0xff, 0xce, 0xd2, 0xff, 0x6e, 0xd2, 0xff, 0x0d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0xce, 0xd2, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xed, 0xff, 0xce, 0xc9, 0xff, 0x0f, 0xca, 0xff, 0x4f, 0xca, 0xff, 0x71, 0xca, 0xff, 0x11, 0xc2, 0xff, 0xf1, 0xc1, 0xff, 0xd7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xeb, 0x10, 0xb8, 0xff, 0xf1, 0xc1, 0xff, 0xd3, 0xb9, 0xe7, 0xb5, 0xb1, 0xfc, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 
-  0x4b, 0xda, 0x28, 0x4b, 0xda, 0xff, 0x4a, 0xda, 0xfc, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x8f, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xee, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x2e, 0xdb, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0xe4, 0xff, 0x2b, 0xd2, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x6b, 0xda, 0xff, 0x6c, 0xda, 0xff, 0xef, 0xda, 0xff, 0x0d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0xec, 0xd1, 0xff, 0xfc, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xf6, 0xff, 0xae, 0xc9, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x2f, 0xca, 0xff, 0x91, 0xca, 0xff, 0xf1, 0xc1, 0xff, 0xd7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe8, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xfb, 0xd4, 0xb9, 0xf8, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0c, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x8f, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xed, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x6f, 0xdb, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xe3, 0xff, 0x8b, 0xda, 0xff, 0x6b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x2a, 0xda, 0xff, 0x4f, 0xdb, 0xff, 0x6e, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0xac, 0xd1, 0xff, 0xbb, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xf6, 0xff, 0xae, 0xc9, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x2f, 0xca, 0xff, 0x71, 0xca, 0xff, 0xd7, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xe8, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf1, 0xc1, 0xec, 0xb5, 0xb1, 0xf7, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcb, 0xd5, 0xb1, 0x0c, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x8f, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x8f, 0xe3, 0xff, 0x2d, 0xe3, 0xff, 0x0c, 0xe3, 0xff, 0xca, 0xe2, 0xff, 0xeb, 0xe2, 0xff, 0xeb, 0xe2, 0xff, 0xf0, 0xe3, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xeb, 0xff, 0xaa, 0xe2, 0xff, 0x8a, 0xda, 0xff, 0xec, 0xe2, 0xff, 0x0d, 0xdb, 0xff, 0x2b, 0xd2, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x8c, 0xda, 0xff, 0x0f, 0xdb, 0xff, 0x0d, 0xd2, 0xff, 0xdb, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xf6, 0xff, 0xae, 0xc9, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x2f, 0xca, 0xff, 0xf6, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xe7, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xd2, 0xc1, 0xf3, 0xb5, 0xb1, 0xf7, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcc, 0xb5, 0xb1, 0x0c, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x8f, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x4b, 0xeb, 0xff, 0xa7, 0xe2, 0xff, 0xa7, 0xe2, 0xff, 0xc7, 0xe2, 0xff, 0xc7, 0xe2, 0xff, 0xa7, 0xe2, 0xff, 0x29, 0xeb, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xec, 0xff, 0x48, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x0c, 0xe3, 0xff, 0x8b, 0xda, 0xff, 0x6b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x2b, 0xda, 0xff, 0xad, 0xda, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xee, 0xff, 0xae, 0xc9, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0e, 0xca, 0xff, 0xf6, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe7, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xd3, 0xb9, 0xf4, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcc, 0xb5, 0xb1, 0x0c, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x8f, 0xe3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x4b, 0xeb, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0x86, 0xe2, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0x48, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0xcb, 0xe2, 0xff, 0x0c, 0xdb, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x6f, 0xdb, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xed, 0xff, 0xee, 0xc9, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0e, 0xca, 0xff, 0xf6, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe4, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf1, 0xc1, 0xf4, 0xb5, 0xb1, 0xf0, 0xb5, 0xb1, 0xcc, 0xb5, 0xb1, 0x0c, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x8f, 0xe3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x6b, 0xeb, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0x86, 0xe2, 0xff, 0x17, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xce, 0xe3, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0xca, 0xe2, 0xff, 0xac, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x0a, 0xd2, 0xff, 0x56, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xd1, 0xff, 0x10, 0xd3, 0xff, 0xee, 0xc9, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0e, 0xca, 0xff, 0xf6, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe4, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xd2, 0xc1, 0xec, 0xb5, 0xb1, 0xcf, 0xb5, 0xb1, 0x0c, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xfb, 0x6a, 0xda, 0xef, 0xa9, 0xda, 0xf3, 0x2e, 0xec, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x6b, 0xeb, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xa7, 0xe2, 0xff, 0x64, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0x28, 0xe2, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0xca, 0xe2, 0xff, 0x8b, 0xda, 0xff, 0x2a, 0xda, 0xff, 0x32, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xf6, 0xff, 0x68, 0xd1, 0xff, 0x2a, 0xda, 0xff, 0xf0, 0xd2, 0xff, 0x2f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0e, 0xca, 0xff, 0xf6, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe4, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xd3, 0xb9, 0xbc, 0xd5, 0xb1, 0x0f, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xff, 0x4a, 0xda, 0xe3, 0xe8, 0xe2, 0xef, 0x08, 0xe3, 0xf8, 0x08, 0xe3, 0xff, 0xec, 0xeb, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x6b, 0xeb, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0x65, 0xe2, 0xff, 0x74, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x69, 0xe2, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x69, 0xda, 0xff, 0x28, 0xda, 0xff, 0x51, 0xec, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xcd, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xaf, 0xd2, 0xff, 0x0e, 0xca, 0xff, 0x0f, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x16, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xe3, 0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xd2, 0xc1, 0xdb, 0xd4, 0xb9, 0x13, 
-  0x4a, 0xda, 0x28, 0x4a, 0xda, 0xff, 0x6a, 0xda, 0xf8, 0xc9, 0xe2, 0xe8, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0xab, 0xeb, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x8c, 0xeb, 0xff, 0xa7, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xa8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0xc8, 0xe2, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x92, 0xec, 0xff, 0x2c, 0xe3, 0xff, 0x69, 0xda, 0xff, 0x28, 0xda, 0xff, 0x28, 0xda, 0xff, 0xaa, 0xe2, 0xff, 0xae, 0xe3, 0xff, 0xb6, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xed, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xb0, 0xd2, 0xff, 0x0f, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x17, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xe3, 0x0e, 0xc0, 0xe7, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xd2, 0xc1, 0xd0, 0xd2, 0xb9, 0x0f, 
-  0x6a, 0xda, 0x20, 0xc9, 0xe2, 0xf3, 0x08, 0xe3, 0xf7, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x8a, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x0e, 0xec, 0xff, 0x6a, 0xeb, 0xff, 0x28, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x29, 0xeb, 0xff, 0x6a, 0xeb, 0xff, 0x6b, 0xeb, 0xff, 0x2f, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xf6, 0xff, 0x2a, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x6c, 0xda, 0xff, 0x90, 0xd2, 0xff, 0xee, 0xc9, 0xff, 0x37, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xe3, 0x2c, 0xc0, 0xf4, 0xf1, 0xc1, 0xfc, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcc, 0xf2, 0xc1, 0x0c, 
-  0x08, 0xe3, 0x28, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x48, 0xeb, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x2d, 0xec, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x27, 0xe3, 0xff, 0x8e, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0xff, 0xa9, 0xd1, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xae, 0xda, 0xff, 0x0f, 0xca, 0xff, 0x58, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xdb, 0xec, 0xc8, 0xff, 0x10, 0xca, 0xe3, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcc, 0xf2, 0xc1, 0x0c, 
-  0x08, 0xe3, 0x28, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0xc4, 0xea, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x4e, 0xec, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x27, 0xe3, 0xff, 0xec, 0xeb, 0xff, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xb6, 0xf5, 0xff, 0xea, 0xe2, 0xff, 0xac, 0xda, 0xff, 0x2b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x2a, 0xda, 0xff, 0x6e, 0xd2, 0xff, 0x98, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xf6, 0xd7, 0x4d, 0xc9, 0xff, 0x0e, 0xca, 0xfb, 0xf1, 0xc1, 0xeb, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcc, 0xf1, 0xc1, 0x0c, 
-  0x08, 0xe3, 0x28, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x40, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0xf5, 0xff, 0x6d, 0xec, 0xff, 0x6d, 0xec, 0xff, 0x6d, 0xec, 0xff, 0x6c, 0xec, 0xff, 0x6c, 0xec, 0xff, 0x6d, 0xec, 0xff, 0x2c, 0xec, 0xff, 0x48, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x49, 0xe3, 0xff, 0x4e, 0xec, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xf6, 0xff, 0x0a, 0xe3, 0xff, 0x68, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x89, 0xe2, 0xff, 0x8b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x0a, 0xd2, 0xff, 0xf9, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xed, 0xdc, 0x8d, 0xc9, 0xff, 0x0e, 0xca, 0xff, 0x0f, 0xca, 0xf7, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcc, 0xf1, 0xc1, 0x0c, 
-  0x08, 0xe3, 0x27, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x40, 0xe2, 0xff, 0xdf, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0xf5, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xa8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0x2a, 0xec, 0xff, 0x4c, 0xec, 0xff, 0x89, 0xeb, 0xff, 0x69, 0xeb, 0xff, 0x27, 0xe3, 0xff, 0x80, 0xe2, 0xff, 0x89, 0xeb, 0xff, 0xb4, 0xf5, 0xff, 0x79, 0xf6, 0xff, 0xba, 0xfe, 0xff, 0xdb, 0xfe, 0xff, 0x59, 0xf6, 0xff, 0x71, 0xec, 0xff, 0x60, 0xe1, 0xff, 0xe5, 0xe1, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0xaa, 0xe2, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xc9, 0xd1, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xdc, 0xef, 0xee, 0xc9, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xf8, 0xf1, 0xc1, 0xf4, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcc, 0xd2, 0xc1, 0x0c, 
-  0x08, 0xe3, 0x27, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0xa4, 0xe2, 0xfc, 0x3c, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xfe, 0xff, 0xa7, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0x2a, 0xec, 0xff, 0x4b, 0xec, 0xff, 0x2a, 0xec, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0x2b, 0xec, 0xff, 0x89, 0xeb, 0xff, 0x28, 0xe3, 0xff, 0x27, 0xe3, 0xff, 0x07, 0xe3, 0xff, 0x07, 0xe3, 0xff, 0x07, 0xe3, 0xff, 0x4a, 0xe3, 0xff, 0x47, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x0b, 0xe3, 0xff, 0x2b, 0xd2, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xc9, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xd2, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0f, 0xca, 0xe0, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcc, 0xf1, 0xc1, 0x0c, 
-  0x08, 0xe3, 0x27, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x28, 0xe3, 0xfb, 0xa8, 0xeb, 0xeb, 0x48, 0xec, 0xf3, 0x6f, 0xf5, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x8b, 0xec, 0xff, 0xac, 0xec, 0xff, 0x4b, 0xec, 0xff, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0x0a, 0xec, 0xff, 0xea, 0xeb, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x4b, 0xe3, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x68, 0xe2, 0xff, 0x2c, 0xe3, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xc9, 0xd1, 0xff, 0x15, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xe7, 0x2e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x2e, 0xca, 0xff, 0xf1, 0xc1, 0xf4, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcb, 0xf2, 0xc1, 0x0c, 
-  0x08, 0xe3, 0x27, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0xa8, 0xeb, 0xe7, 0x29, 0xec, 0xf0, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xfe, 0xff, 0xc4, 0xeb, 0xff, 0x08, 0xec, 0xff, 0x08, 0xec, 0xff, 0x08, 0xec, 0xff, 0x08, 0xec, 0xff, 0x28, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x6a, 0xec, 0xff, 0x4a, 0xec, 0xff, 0x8c, 0xec, 0xff, 0xe9, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xea, 0xeb, 0xff, 0xca, 0xeb, 0xff, 0x28, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x49, 0xeb, 0xff, 0x4a, 0xe3, 0xff, 0x68, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0xa9, 0xe2, 0xff, 0x6b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xac, 0xda, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xee, 0xfb, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0f, 0xca, 0xe3, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcb, 0xf1, 0xb9, 0x0c, 
-  0x08, 0xe3, 0x27, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x08, 0xe3, 0xff, 0x29, 0xec, 0xe0, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0xb8, 0xfe, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf6, 0xff, 0x4d, 0xf5, 0xff, 0x4d, 0xf5, 0xff, 0x4d, 0xf5, 0xff, 0x4e, 0xf5, 0xff, 0xcc, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x4a, 0xec, 0xff, 0x4b, 0xec, 0xff, 0xc9, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0x0b, 0xec, 0xff, 0x28, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x6b, 0xe3, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x68, 0xe2, 0xff, 0x4c, 0xe3, 0xff, 0x2b, 0xd2, 0xff, 0x4b, 0xda, 0xff, 0x6b, 0xda, 0xff, 0x59, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf5, 0xe4, 0xd0, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xfc, 0xf1, 0xc1, 0xef, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcb, 0xd2, 0xc1, 0x0b, 
-  0x08, 0xe3, 0x27, 0x08, 0xe3, 0xff, 0x48, 0xe3, 0xf0, 0x29, 0xec, 0xf4, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x0f, 0xed, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x14, 0xf6, 0xff, 0xa6, 0xec, 0xff, 0xa8, 0xec, 0xff, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0xea, 0xec, 0xff, 0x2c, 0xed, 0xff, 0x8a, 0xec, 0xff, 0xab, 0xec, 0xff, 0x29, 0xec, 0xff, 0x29, 0xec, 0xff, 0x49, 0xec, 0xff, 0x6b, 0xec, 0xff, 0x0a, 0xec, 0xff, 0xc8, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xea, 0xeb, 0xff, 0x28, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x48, 0xe3, 0xff, 0x69, 0xeb, 0xff, 0x4b, 0xe3, 0xff, 0x68, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x47, 0xe2, 0xff, 0xab, 0xda, 0xff, 0xcd, 0xda, 0xff, 0x59, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xec, 0x8a, 0xd1, 0xfb, 0x0e, 0xca, 0xec, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0xf0, 0xc1, 0xf4, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xc7, 0xd1, 0xc1, 0x0b, 
-  0xe8, 0xe2, 0x23, 0x48, 0xe3, 0xe4, 0x49, 0xec, 0xfc, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x27, 0xec, 0xff, 0xb7, 0xfe, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xf1, 0xf5, 0xff, 0xa7, 0xec, 0xff, 0xa8, 0xec, 0xff, 0xa8, 0xec, 0xff, 0xa9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0x2c, 0xed, 0xff, 0x4a, 0xec, 0xff, 0x28, 0xec, 0xff, 0x29, 0xec, 0xff, 0x4a, 0xec, 0xff, 0x0a, 0xec, 0xff, 0xc8, 0xeb, 0xff, 0xc8, 0xeb, 0xff, 0x2b, 0xec, 0xff, 0x27, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x2b, 0xe3, 0xff, 0x47, 0xe2, 0xff, 0x67, 0xe2, 0xff, 0x47, 0xe2, 0xff, 0x47, 0xe2, 0xff, 0xe5, 0xe1, 0xff, 0xe9, 0xe2, 0xff, 0xd6, 0xf5, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x2c, 0xd2, 0xfc, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xd3, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0f, 0xca, 0xe7, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xc3, 0xf2, 0xc1, 0x07, 
-  0x29, 0xec, 0x17, 0x49, 0xec, 0xe3, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x69, 0xec, 0xf8, 0xa9, 0xec, 0xf4, 0x2a, 0xf5, 0xf0, 0xe7, 0xec, 0xff, 0x3a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0x96, 0xfe, 0xff, 0x75, 0xf6, 0xff, 0x55, 0xf6, 0xff, 0x35, 0xf6, 0xff, 0x15, 0xf6, 0xff, 0x15, 0xf6, 0xff, 0xf4, 0xf5, 0xff, 0x15, 0xf6, 0xff, 0xd4, 0xf5, 0xff, 0xd4, 0xf5, 0xff, 0xd4, 0xf5, 0xff, 0xd5, 0xf5, 0xff, 0xb4, 0xf5, 0xff, 0xb4, 0xf5, 0xff, 0xb4, 0xf5, 0xff, 0x94, 0xf5, 0xff, 0x95, 0xf5, 0xff, 0xb6, 0xf5, 0xff, 0xf7, 0xf5, 0xff, 0x59, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf1, 0xdb, 0xfb, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x0e, 0xca, 0xef, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xf7, 0xf1, 0xc1, 0xfc, 0xf2, 0xc1, 0xb4, 0xf3, 0xd0, 0x00, 
-  0x49, 0xec, 0x0f, 0x49, 0xec, 0xd0, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0xa9, 0xec, 0xf0, 0x0a, 0xed, 0xf7, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x19, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x31, 0xe4, 0xe7, 0x0b, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2d, 0xd2, 0xf0, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0xf0, 0xc1, 0xdc, 0xf2, 0xc1, 0x98, 0xf1, 0xc1, 0x00, 
-  0xc9, 0xfb, 0x00, 0x49, 0xec, 0xb3, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0xc9, 0xec, 0xe4, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x08, 0xed, 0xff, 0x52, 0xf6, 0xdb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1c, 0xff, 0xe8, 0x4a, 0xda, 0xfc, 0x4a, 0xda, 0xfb, 0x2c, 0xd2, 0xf8, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xf3, 0x0e, 0xca, 0xfb, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xe8, 0xd2, 0xb9, 0x60, 0xf1, 0xc1, 0x00, 
-  0x49, 0xec, 0x00, 0x49, 0xec, 0x6f, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0xe9, 0xec, 0xeb, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x4a, 0xf5, 0xe8, 0x8a, 0xf5, 0xf7, 0xaa, 0xf5, 0xef, 0xa9, 0xf5, 0xf8, 0xeb, 0xf5, 0xfb, 0xb6, 0xfe, 0xfb, 0x5a, 0xff, 0xeb, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9d, 0xff, 0xe8, 0x39, 0xf6, 0xf4, 0x31, 0xe4, 0xeb, 0xa7, 0xd9, 0xff, 0x4a, 0xda, 0xff, 0x6a, 0xda, 0xf8, 0x4c, 0xd2, 0xfb, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xf3, 0x0e, 0xca, 0xfc, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0xd0, 0xc1, 0x0c, 0xef, 0xc9, 0x00, 
-  0x49, 0xec, 0x00, 0x43, 0xfc, 0x00, 0x49, 0xec, 0xff, 0x49, 0xec, 0xff, 0xe9, 0xec, 0xdf, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x8a, 0xf5, 0xe7, 0xca, 0xf5, 0xfc, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xe3, 0xca, 0xf5, 0xd4, 0xca, 0xf5, 0xdf, 0xca, 0xf5, 0xe3, 0xca, 0xf5, 0xd7, 0x2e, 0xf6, 0xdb, 0xd4, 0xfe, 0xdc, 0x38, 0xff, 0xd3, 0x7a, 0xff, 0xd0, 0x9b, 0xff, 0xd3, 0x9c, 0xff, 0xd0, 0x9d, 0xff, 0xd8, 0x9d, 0xff, 0xd8, 0xbd, 0xff, 0xd8, 0x9d, 0xff, 0xdc, 0xbe, 0xff, 0xd4, 0xbd, 0xff, 0xd4, 0xbd, 0xff, 0xd3, 0xbd, 0xff, 0xd3, 0x7d, 0xff, 0xdc, 0x9d, 0xff, 0xdb, 0x9d, 0xff, 0xd8, 0x9d, 0xff, 0xd7, 0x7d, 0xff, 0xd8, 0x3b, 0xff, 0xd8, 0xda, 0xfe, 0xd8, 0x99, 0xfe, 0xd8, 0x38, 0xfe, 0xd4, 0x54, 0xf5, 0xdc, 0xcd, 0xeb, 0xfb, 0xc9, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x89, 0xe2, 0xef, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x4b, 0xda, 0xef, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2d, 0xca, 0xf0, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xaf, 0x0e, 0xca, 0x00, 0x00, 0x00, 0x00, 
-  0x49, 0xec, 0x00, 0x49, 0xec, 0x00, 0x49, 0xec, 0x6c, 0xa9, 0xec, 0xf7, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x4a, 0xf5, 0xf8, 0xaa, 0xf5, 0xe0, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xef, 0xca, 0xf5, 0xef, 0xea, 0xf5, 0xf3, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xf7, 0xca, 0xf5, 0xf4, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xff, 0xc9, 0xf5, 0xff, 0xa9, 0xf5, 0xe4, 0xa8, 0xf5, 0xf7, 0xa8, 0xf5, 0xfb, 0x67, 0xed, 0xeb, 0x26, 0xed, 0xf0, 0x27, 0xed, 0xff, 0x27, 0xed, 0xff, 0x06, 0xed, 0xe7, 0x85, 0xec, 0xfc, 0x85, 0xec, 0xff, 0x85, 0xec, 0xff, 0x85, 0xec, 0xf3, 0xa4, 0xe3, 0xf3, 0x84, 0xeb, 0xff, 0x84, 0xeb, 0xff, 0xa4, 0xeb, 0xff, 0xe2, 0xe2, 0xe4, 0xc4, 0xe2, 0xff, 0xc5, 0xe2, 0xff, 0xc5, 0xe2, 0xff, 0x85, 0xe2, 0xf0, 0x46, 0xe2, 0xff, 0x67, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x87, 0xe2, 0xec, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xe0, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xd3, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0x1c, 0x0e, 0xca, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x28, 0xec, 0x00, 0xc9, 0xec, 0x08, 0x2a, 0xed, 0xdc, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x2a, 0xed, 0xff, 0x4a, 0xed, 0xf0, 0xca, 0xf5, 0xf7, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xe8, 0xca, 0xf5, 0xfb, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xe8, 0x2b, 0xf6, 0xdf, 0x4b, 0xf6, 0xff, 0x4b, 0xf6, 0xfc, 0x4b, 0xf6, 0xfb, 0x4b, 0xf6, 0xff, 0x2b, 0xf6, 0xe8, 0xea, 0xf5, 0xd0, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xf8, 0xca, 0xf5, 0xe7, 0xca, 0xf5, 0xf8, 0x4a, 0xf5, 0xdb, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xff, 0x2a, 0xed, 0xf4, 0xc9, 0xec, 0xfc, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0xa9, 0xec, 0xf0, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xfc, 0x28, 0xe3, 0xf0, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xe3, 0x88, 0xe2, 0xfc, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x87, 0xe2, 0xff, 0x69, 0xda, 0xf3, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x2b, 0xd2, 0xef, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xf8, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0x8c, 0x2e, 0xca, 0x00, 0x0e, 0xca, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xf5, 0x00, 0x2a, 0xed, 0x50, 0x2a, 0xed, 0xfc, 0x2a, 0xed, 0xff, 0x4a, 0xf5, 0xf8, 0xca, 0xf5, 0xf0, 0xca, 0xf5, 0xfc, 0xca, 0xf5, 0xd8, 0xca, 0xf5, 0xff, 0xea, 0xf5, 0xfb, 0x2a, 0xf6, 0xdf, 0x6b, 0xf6, 0xfc, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x4b, 0xf6, 0xf4, 0xea, 0xf5, 0xe8, 0xca, 0xf5, 0xfc, 0xca, 0xf5, 0xf4, 0xca, 0xf5, 0xf0, 0xaa, 0xf5, 0xfc, 0x4a, 0xf5, 0xeb, 0x4a, 0xf5, 0xff, 0x6a, 0xf5, 0xf8, 0xe9, 0xec, 0xf4, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xfc, 0x49, 0xec, 0xeb, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0x09, 0xec, 0xff, 0x88, 0xeb, 0xe4, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x48, 0xe3, 0xf4, 0xa8, 0xe2, 0xf7, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xdc, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x4b, 0xda, 0xcf, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2e, 0xca, 0xe8, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xdf, 0x0e, 0xca, 0x0c, 0x0e, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xed, 0x00, 0x09, 0xf5, 0x00, 0x2a, 0xed, 0x5c, 0x2a, 0xed, 0xff, 0xaa, 0xf5, 0xf0, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xec, 0xca, 0xf5, 0xff, 0xeb, 0xf5, 0xef, 0x4b, 0xf6, 0xf4, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xfc, 0x2b, 0xf6, 0xf4, 0xca, 0xf5, 0xf4, 0xca, 0xf5, 0xf8, 0xca, 0xf5, 0xe8, 0xaa, 0xf5, 0xe8, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xf4, 0xc9, 0xec, 0xf8, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0x89, 0xec, 0xe7, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xc8, 0xeb, 0xf8, 0x28, 0xe3, 0xf4, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x08, 0xe3, 0xcc, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xfb, 0x6a, 0xda, 0xfb, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x4a, 0xda, 0xf3, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2d, 0xd2, 0xdc, 0x0e, 0xca, 0xdb, 0x0e, 0xca, 0x1c, 0x0e, 0xca, 0x00, 0x0e, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xed, 0x00, 0x4a, 0xf5, 0x00, 0xaa, 0xf5, 0x57, 0xca, 0xf5, 0xf7, 0xca, 0xf5, 0xe7, 0xca, 0xf5, 0xff, 0xea, 0xf5, 0xe4, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x4b, 0xf6, 0xf0, 0xca, 0xf5, 0xf8, 0xca, 0xf5, 0xfb, 0xca, 0xf5, 0xf4, 0x6a, 0xf5, 0xd3, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xff, 0x2a, 0xf5, 0xe4, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xf7, 0x09, 0xec, 0xfc, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xf8, 0x48, 0xe3, 0xf7, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xf0, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x69, 0xda, 0xe8, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x4c, 0xd2, 0xfb, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xcb, 0x0f, 0xca, 0x1b, 0x91, 0xa2, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xf5, 0x00, 0xaa, 0xf5, 0x00, 0xaa, 0xf5, 0x2f, 0xca, 0xf5, 0xb0, 0xea, 0xf5, 0xf7, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x0b, 0xf6, 0xe3, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xef, 0xca, 0xf5, 0xff, 0x6a, 0xf5, 0xe0, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xf8, 0xc9, 0xec, 0xf7, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0x69, 0xec, 0xdb, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0x88, 0xe3, 0xec, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0xa8, 0xe2, 0xeb, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x69, 0xe2, 0xe8, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xfb, 0x4b, 0xd2, 0xec, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xfb, 0x2c, 0xd2, 0x7f, 0x8c, 0xda, 0x08, 0x2e, 0xca, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xa3, 0x00, 0xca, 0xf5, 0x00, 0xea, 0xf5, 0x03, 0x4b, 0xf6, 0x38, 0x6b, 0xf6, 0xcf, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0x6b, 0xf6, 0xff, 0xca, 0xf5, 0xd4, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xef, 0x8a, 0xf5, 0xf4, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xfc, 0xe9, 0xec, 0xfc, 0xc9, 0xec, 0xff, 0xc9, 0xec, 0xff, 0xa9, 0xec, 0xf4, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xa8, 0xeb, 0xd8, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0x28, 0xe3, 0xff, 0xe8, 0xe2, 0xdb, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x89, 0xe2, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xff, 0x6a, 0xda, 0xfc, 0x4b, 0xd2, 0xe4, 0x2c, 0xd2, 0x8b, 0x4b, 0xd2, 0x10, 0xcb, 0xd9, 0x00, 0x2c, 0xd2, 0x00, 0x0b, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbd, 0x00, 0x6b, 0xf6, 0x00, 0x6b, 0xf6, 0x00, 0x6b, 0xfe, 0x10, 0x6b, 0xf6, 0x50, 0x6b, 0xf6, 0x8c, 0x6b, 0xf6, 0xa8, 0x6b, 0xf6, 0xb3, 0x6b, 0xf6, 0xbc, 0x6b, 0xf6, 0xbf, 0x6b, 0xf6, 0xbf, 0x6b, 0xf6, 0xc0, 0x6b, 0xf6, 0xc0, 0x6b, 0xf6, 0xc0, 0x6b, 0xf6, 0xc3, 0x6b, 0xf6, 0xc3, 0x6b, 0xf6, 0xc3, 0x6b, 0xf6, 0xc3, 0x6b, 0xf6, 0xc4, 0x4b, 0xf6, 0xbf, 0xca, 0xf5, 0xc3, 0xca, 0xf5, 0xa4, 0xaa, 0xf5, 0xb3, 0x4a, 0xf5, 0xbf, 0x4a, 0xf5, 0xc3, 0x0a, 0xed, 0xb4, 0xc9, 0xec, 0xc7, 0xc9, 0xec, 0xc4, 0xc9, 0xec, 0xc4, 0x29, 0xec, 0xb7, 0xe9, 0xeb, 0xc4, 0xe9, 0xeb, 0xc4, 0xe9, 0xeb, 0xbc, 0x28, 0xe3, 0xc4, 0x28, 0xe3, 0xc4, 0x28, 0xe3, 0xc4, 0x08, 0xe3, 0xb8, 0x88, 0xe2, 0xc4, 0x88, 0xe2, 0xc4, 0x88, 0xe2, 0xc3, 0x88, 0xe2, 0xc3, 0x89, 0xe2, 0xbc, 0x6a, 0xda, 0xb0, 0x6a, 0xda, 0xa4, 0x6a, 0xda, 0x78, 0x6a, 0xda, 0x43, 0x00, 0xfc, 0x00, 0x2c, 0xd2, 0x00, 0x6b, 0xd2, 0x00, 0x4b, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xf6, 0x00, 0x6b, 0xf6, 0x00, 0x6b, 0xf6, 0x00, 0x4b, 0xf6, 0x00, 0x17, 0xf8, 0x00, 0x6b, 0xf6, 0x04, 0x8a, 0xf6, 0x07, 0x4b, 0xf6, 0x07, 0x6a, 0xf6, 0x07, 0x6b, 0xf6, 0x07, 0x6a, 0xf6, 0x07, 0x4b, 0xf6, 0x07, 0x6b, 0xf6, 0x07, 0x8b, 0xfe, 0x08, 0x4b, 0xf6, 0x08, 0x6b, 0xf6, 0x08, 0x6b, 0xf6, 0x08, 0x0b, 0xf6, 0x07, 0xea, 0xed, 0x08, 0xca, 0xf5, 0x07, 0x6a, 0xed, 0x07, 0x6a, 0xed, 0x07, 0x49, 0xf5, 0x08, 0xc9, 0xec, 0x08, 0xc9, 0xec, 0x08, 0xc9, 0xec, 0x08, 0x49, 0xec, 0x08, 0xe8, 0xeb, 0x08, 0x09, 0xec, 0x08, 0x29, 0xec, 0x08, 0x88, 0xe3, 0x08, 0x28, 0xe3, 0x08, 0x28, 0xeb, 0x08, 0x48, 0xeb, 0x08, 0x08, 0xe3, 0x08, 0xc8, 0xe2, 0x08, 0x08, 0xe3, 0x08, 0x08, 0xeb, 0x07, 0xc8, 0xea, 0x04, 0xe9, 0xe0, 0x00, 0x6a, 0xda, 0x00, 0x6a, 0xda, 0x00, 0x6a, 0xda, 0x00, 0x6a, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8a, 0x00, 0x00, 0x00, 0x07, 0x59, 0x4b, 0x0c, 0x39, 0x4b, 0x17, 0x39, 0x4b, 0x1f, 0x39, 0x4b, 0x24, 0xb9, 0x52, 0x27, 0xb9, 0x52, 0x28, 0xba, 0x52, 0x2b, 0xba, 0x5a, 
+  0x2b, 0x82, 0xb9, 0x52, 0x2c, 0x00, 0xb9, 0x5a, 0x2f, 0x81, 0xb9, 0x52, 0x2f, 0x02, 0x9a, 0x52, 0x2f, 0xb9, 0x5a, 0x30, 0xb9, 0x5a, 0x2b, 0x86, 0x18, 0x6a, 0x34, 0x01, 0x38, 0x6a, 0x34, 0x19, 
+  0x6a, 0x2f, 0x81, 0xf9, 0x71, 0x2f, 0x81, 0xf9, 0x71, 0x2c, 0x82, 0xd9, 0x71, 0x2b, 0x00, 0xd9, 0x79, 0x2c, 0x81, 0xb9, 0x79, 0x2b, 0x05, 0xb9, 0x79, 0x27, 0xb9, 0x79, 0x24, 0xb9, 0x79, 0x23, 
+  0xb9, 0x79, 0x1c, 0xb9, 0x79, 0x14, 0xd9, 0x71, 0x04, 0x93, 0x00, 0x00, 0x00, 0x05, 0x39, 0x4b, 0x4f, 0x39, 0x4b, 0x9f, 0x39, 0x4b, 0xcf, 0x39, 0x4b, 0xe3, 0x39, 0x4b, 0xf7, 0x19, 0x53, 0xeb, 
+  0x8b, 0xb9, 0x52, 0xff, 0x00, 0x79, 0x62, 0xf0, 0x86, 0x38, 0x6a, 0xff, 0x00, 0x19, 0x6a, 0xe4, 0x85, 0xf9, 0x71, 0xff, 0x01, 0xd9, 0x71, 0xec, 0xd9, 0x79, 0xff, 0x84, 0xb9, 0x79, 0xff, 0x05, 
+  0xb9, 0x79, 0xfc, 0xb9, 0x79, 0xf0, 0xb9, 0x79, 0xdc, 0xb9, 0x79, 0xbc, 0xb9, 0x79, 0x78, 0xb9, 0x71, 0x24, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x39, 0x4b, 0x37, 0x39, 0x4b, 0xe7, 0x83, 0x39, 0x4b, 
+  0xff, 0x00, 0x19, 0x53, 0xd4, 0x8a, 0xb9, 0x52, 0xff, 0x01, 0xb9, 0x52, 0xf7, 0x59, 0x62, 0xe3, 0x85, 0x38, 0x6a, 0xff, 0x01, 0x38, 0x6a, 0xfb, 0xf9, 0x69, 0xd8, 0x84, 0xf9, 0x71, 0xff, 0x01, 
+  0xf9, 0x71, 0xfc, 0xd9, 0x71, 0xef, 0x8a, 0xb9, 0x79, 0xff, 0x03, 0xb9, 0x79, 0xfc, 0x98, 0x89, 0xd4, 0x98, 0x99, 0xa7, 0x78, 0xa1, 0x0f, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x39, 0x4b, 0x10, 0x39, 
+  0x4b, 0xaf, 0x83, 0x39, 0x4b, 0xff, 0x02, 0x39, 0x4b, 0xf0, 0xf9, 0x52, 0xef, 0xb9, 0x52, 0xfb, 0x88, 0xb9, 0x52, 0xff, 0x02, 0xb9, 0x52, 0xfb, 0x99, 0x5a, 0xeb, 0x38, 0x6a, 0xf7, 0x84, 0x38, 
+  0x6a, 0xff, 0x02, 0x38, 0x6a, 0xfc, 0x19, 0x6a, 0xec, 0xf9, 0x71, 0xe3, 0x83, 0xf9, 0x71, 0xff, 0x02, 0xf9, 0x71, 0xfb, 0xd9, 0x71, 0xf4, 0xd9, 0x79, 0xf3, 0x89, 0xb9, 0x79, 0xff, 0x02, 0xb9, 
+  0x79, 0xeb, 0xb8, 0x89, 0xec, 0x98, 0x91, 0xec, 0x81, 0x98, 0x99, 0xff, 0x01, 0x98, 0x99, 0xef, 0x98, 0x99, 0x58, 0x89, 0x00, 0x00, 0x00, 0x01, 0x18, 0x4b, 0x0b, 0x39, 0x4b, 0xe0, 0x83, 0x39, 
+  0x4b, 0xff, 0x01, 0x39, 0x4b, 0xe3, 0xb9, 0x52, 0xf8, 0x89, 0xb9, 0x52, 0xff, 0x01, 0xb9, 0x52, 0xe7, 0x59, 0x62, 0xf8, 0x85, 0x38, 0x6a, 0xff, 0x01, 0x18, 0x6a, 0xf3, 0xf9, 0x71, 0xd3, 0x84, 
+  0xf9, 0x71, 0xff, 0x01, 0xf9, 0x71, 0xe4, 0xd9, 0x79, 0xf8, 0x8a, 0xb9, 0x79, 0xff, 0x02, 0xb9, 0x81, 0xd8, 0x98, 0x91, 0xf3, 0x98, 0x99, 0xfc, 0x84, 0x98, 0x99, 0xff, 0x00, 0x98, 0x99, 0x7f, 
+  0x87, 0x00, 0x00, 0x00, 0x01, 0x39, 0x4b, 0x0f, 0x39, 0x4b, 0xe8, 0x81, 0x39, 0x4b, 0xff, 0x02, 0x39, 0x4b, 0xfb, 0x19, 0x4b, 0xf8, 0xf9, 0x52, 0xdc, 0x88, 0xb9, 0x52, 0xff, 0x03, 0xb9, 0x52, 
+  0xfc, 0x99, 0x5a, 0xfb, 0x79, 0x62, 0xdf, 0x18, 0x6a, 0xff, 0x84, 0x38, 0x6a, 0xff, 0x02, 0x19, 0x6a, 0xef, 0x19, 0x6a, 0xe7, 0xf9, 0x71, 0xf8, 0x82, 0xf9, 0x71, 0xff, 0x02, 0xf9, 0x71, 0xfb, 
+  0xd9, 0x71, 0xf8, 0xd9, 0x71, 0xec, 0x89, 0xb9, 0x79, 0xff, 0x03, 0xb9, 0x79, 0xf7, 0xb9, 0x81, 0xec, 0x98, 0x91, 0xdf, 0x97, 0x99, 0xff, 0x87, 0x98, 0x99, 0xff, 0x00, 0x98, 0x99, 0x6b, 0x86, 
+  0x00, 0x00, 0x00, 0x05, 0x39, 0x4b, 0xa3, 0x39, 0x4b, 0xff, 0x39, 0x4b, 0xf8, 0x19, 0x4b, 0xd7, 0xd9, 0x52, 0xfc, 0xb9, 0x52, 0xfb, 0x88, 0xb9, 0x52, 0xff, 0x02, 0xb9, 0x5a, 0xdc, 0x59, 0x62, 
+  0xfc, 0x38, 0x6a, 0xfb, 0x84, 0x38, 0x6a, 0xff, 0x02, 0x39, 0x6a, 0xef, 0xf9, 0x69, 0xeb, 0xf9, 0x71, 0xf3, 0x83, 0xf9, 0x71, 0xff, 0x02, 0xf9, 0x71, 0xe7, 0xd9, 0x79, 0xf7, 0xb9, 0x79, 0xfb, 
+  0x89, 0xb9, 0x79, 0xff, 0x02, 0xb9, 0x81, 0xdb, 0x98, 0x91, 0xf8, 0x98, 0x99, 0xf8, 0x89, 0x98, 0x99, 0xff, 0x01, 0x98, 0x99, 0xfc, 0x98, 0x99, 0x4c, 0x84, 0x00, 0x00, 0x00, 0x03, 0x39, 0x4b, 
+  0x43, 0x39, 0x4b, 0xff, 0x19, 0x53, 0xd0, 0xb9, 0x52, 0xf3, 0x87, 0xb9, 0x52, 0xff, 0x04, 0xb9, 0x52, 0xfc, 0xb9, 0x52, 0xff, 0x99, 0x5a, 0xe3, 0x39, 0x62, 0xf0, 0x18, 0x6a, 0xff, 0x81, 0x38, 
+  0x6a, 0xff, 0x82, 0x18, 0x6a, 0xff, 0x01, 0x18, 0x6a, 0xf8, 0xf9, 0x69, 0xd8, 0x83, 0xd9, 0x71, 0xff, 0x02, 0xd9, 0x71, 0xfc, 0xd9, 0x71, 0xf8, 0xb9, 0x71, 0xf0, 0x89, 0xb9, 0x79, 0xff, 0x02, 
+  0xb9, 0x79, 0xfb, 0xb9, 0x79, 0xeb, 0x98, 0x91, 0xe3, 0x8d, 0x98, 0x99, 0xff, 0x01, 0x98, 0x99, 0xd3, 0x98, 0x99, 0x07, 0x83, 0x00, 0x00, 0x00, 0x01, 0xd9, 0x52, 0xdf, 0xb9, 0x52, 0xf8, 0x87, 
+  0xb9, 0x52, 0xff, 0x03, 0xb9, 0x52, 0xf0, 0x99, 0x5a, 0xec, 0x59, 0x62, 0xf4, 0x39, 0x6a, 0xf7, 0x81, 0x18, 0x6a, 0xff, 0x07, 0x98, 0x61, 0xff, 0x98, 0x50, 0xff, 0x78, 0x58, 0xff, 0xd9, 0x69, 
+  0xf7, 0x79, 0x72, 0xef, 0x59, 0x69, 0xd8, 0xfa, 0x79, 0xd0, 0xba, 0x79, 0xe0, 0x81, 0x99, 0x71, 0xe3, 0x03, 0xba, 0x79, 0xe3, 0x7b, 0x9b, 0xdb, 0xdb, 0xa3, 0xd0, 0xdb, 0xa3, 0xdf, 0x81, 0xdb, 
+  0xa3, 0xe0, 0x0b, 0xbb, 0xa3, 0xe3, 0x9b, 0xa3, 0xe3, 0x9b, 0x9b, 0xe3, 0x7b, 0x9b, 0xe4, 0x5a, 0x9b, 0xe7, 0x1a, 0x9b, 0xe8, 0xba, 0x92, 0xec, 0x5a, 0x8a, 0xdf, 0x99, 0x88, 0xf0, 0x17, 0x88, 
+  0xec, 0x17, 0x90, 0xff, 0x17, 0x91, 0xff, 0x8e, 0x98, 0x99, 0xff, 0x00, 0x98, 0x91, 0x57, 0x82, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x52, 0x44, 0x87, 0xb9, 0x52, 0xff, 0x02, 0x99, 0x52, 0xe3, 0x79, 
+  0x62, 0xe4, 0x19, 0x6a, 0xff, 0x83, 0x38, 0x6a, 0xff, 0x03, 0xf9, 0x7a, 0xf4, 0xfd, 0xcd, 0xcf, 0xbf, 0xff, 0xdb, 0xff, 0xff, 0xfb, 0x95, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf4, 0xfe, 0xf6, 
+  0xd7, 0x7b, 0xcc, 0xe0, 0x8d, 0x98, 0x99, 0xff, 0x01, 0x97, 0x99, 0xe0, 0xb6, 0xb1, 0xe0, 0x82, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x52, 0xa3, 0x82, 0xb9, 0x52, 0xff, 0x04, 0xb9, 0x52, 0xfb, 0xb9, 
+  0x52, 0xeb, 0x79, 0x5a, 0xfb, 0x59, 0x62, 0xe4, 0x39, 0x6a, 0xf0, 0x81, 0x18, 0x6a, 0xff, 0x05, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xff, 0xb8, 0x61, 0xfb, 0x3c, 0xb5, 0xf0, 0x5f, 0xf7, 0xdf, 0xff, 
+  0xff, 0xfc, 0x9b, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xef, 0x5d, 0xe6, 0xec, 0xd9, 0xb3, 0xf4, 0x77, 0x90, 0xff, 0x86, 0x98, 0x99, 0xff, 0x02, 0x97, 0x99, 0xef, 0x97, 0xa1, 0xf0, 0xb6, 0xa9, 
+  0xe4, 0x81, 0xb5, 0xb1, 0xff, 0x08, 0xb5, 0xb1, 0x33, 0x00, 0x00, 0x00, 0xb9, 0x52, 0x0b, 0xb9, 0x52, 0xcc, 0xb9, 0x52, 0xff, 0xb9, 0x52, 0xe7, 0x79, 0x5a, 0xdf, 0x38, 0x62, 0xff, 0x38, 0x6a, 
+  0xfb, 0x84, 0x38, 0x6a, 0xff, 0x03, 0x18, 0x6a, 0xff, 0xf9, 0x69, 0xe8, 0xbf, 0xff, 0xef, 0xff, 0xff, 0xfc, 0xa0, 0xff, 0xff, 0xff, 0x01, 0x1d, 0xe6, 0xdb, 0x17, 0x90, 0xff, 0x83, 0x98, 0x99, 
+  0xff, 0x02, 0x97, 0x99, 0xe0, 0xb6, 0xa9, 0xf4, 0xb5, 0xb1, 0xfb, 0x83, 0xb5, 0xb1, 0xff, 0x04, 0xb5, 0xb1, 0x78, 0x00, 0x00, 0x00, 0x79, 0x62, 0x17, 0x79, 0x62, 0xc8, 0x39, 0x6a, 0xf8, 0x81, 
+  0x18, 0x6a, 0xff, 0x85, 0x38, 0x6a, 0xff, 0x02, 0x18, 0x6a, 0xff, 0x9a, 0x8b, 0xec, 0xdf, 0xff, 0xf4, 0x86, 0xff, 0xff, 0xff, 0x00, 0xbf, 0xff, 0xff, 0x81, 0x9f, 0xff, 0xff, 0x8e, 0x7f, 0xf7, 
+  0xff, 0x00, 0x7f, 0xff, 0xff, 0x81, 0x9f, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x04, 0xbe, 0xee, 0xe4, 0xd8, 0x99, 0xfc, 0x97, 0x99, 0xf4, 0x97, 0xa1, 0xef, 0xb6, 0xa9, 
+  0xe3, 0x86, 0xb5, 0xb1, 0xff, 0x03, 0xb5, 0xb1, 0xa7, 0x00, 0x00, 0x00, 0x39, 0x6a, 0x1f, 0x38, 0x6a, 0xf4, 0x85, 0x38, 0x6a, 0xff, 0x04, 0x39, 0x6a, 0xff, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xe7, 
+  0xf8, 0x79, 0xd7, 0xdf, 0xff, 0xf4, 0x84, 0xff, 0xff, 0xff, 0x0c, 0x5d, 0xe6, 0xff, 0xfb, 0xbc, 0xff, 0x59, 0xac, 0xff, 0xb9, 0xa3, 0xff, 0x18, 0x9b, 0xff, 0xd8, 0x92, 0xff, 0xb8, 0x92, 0xff, 
+  0xd8, 0x92, 0xff, 0x39, 0xa3, 0xff, 0xb8, 0xa2, 0xff, 0x57, 0x9a, 0xff, 0x77, 0xa2, 0xff, 0x57, 0xa2, 0xff, 0x82, 0x37, 0xa2, 0xff, 0x82, 0x37, 0x9a, 0xff, 0x01, 0x57, 0x9a, 0xff, 0xb8, 0xaa, 
+  0xff, 0x81, 0x39, 0xb3, 0xff, 0x04, 0x38, 0xb3, 0xff, 0xd9, 0xbb, 0xff, 0x99, 0xc4, 0xff, 0x5b, 0xd5, 0xff, 0x5f, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xde, 0xee, 0xdf, 0x15, 0xa8, 0xf7, 
+  0x88, 0xb5, 0xb1, 0xff, 0x03, 0xb5, 0xb1, 0xb8, 0xd5, 0xa9, 0x03, 0x38, 0x6a, 0x23, 0x38, 0x6a, 0xfb, 0x82, 0x38, 0x6a, 0xff, 0x06, 0x38, 0x6a, 0xfb, 0x38, 0x6a, 0xff, 0x18, 0x72, 0xec, 0xf7, 
+  0x79, 0xd7, 0xf7, 0x79, 0xfc, 0x57, 0x79, 0xff, 0x9f, 0xff, 0xeb, 0x83, 0xff, 0xff, 0xff, 0x08, 0x5f, 0xf7, 0xff, 0x78, 0x92, 0xff, 0x56, 0x79, 0xff, 0xd7, 0x81, 0xff, 0xf7, 0x81, 0xff, 0xd7, 
+  0x81, 0xff, 0x17, 0x8a, 0xff, 0xd8, 0x9a, 0xff, 0x57, 0x9a, 0xff, 0x82, 0x96, 0x91, 0xff, 0x00, 0xb6, 0x91, 0xff, 0x81, 0xb7, 0x91, 0xff, 0x81, 0xd7, 0x99, 0xff, 0x03, 0xb6, 0x99, 0xff, 0x17, 
+  0xa2, 0xff, 0xd8, 0xb2, 0xff, 0x98, 0xb2, 0xff, 0x81, 0x96, 0xa1, 0xff, 0x81, 0x76, 0xa1, 0xff, 0x82, 0x96, 0xa1, 0xff, 0x02, 0x56, 0xa1, 0xff, 0x56, 0xa0, 0xff, 0x1b, 0xd5, 0xff, 0x84, 0xff, 
+  0xff, 0xff, 0x01, 0xba, 0xdc, 0xe0, 0x55, 0xb1, 0xff, 0x87, 0xb5, 0xb1, 0xff, 0x08, 0xb5, 0xb1, 0xc3, 0xd5, 0xb1, 0x08, 0x18, 0x6a, 0x24, 0x38, 0x6a, 0xff, 0x18, 0x6a, 0xe7, 0x18, 0x72, 0xeb, 
+  0xf8, 0x71, 0xfb, 0xf7, 0x79, 0xe8, 0xf7, 0x79, 0xf7, 0x82, 0xf7, 0x79, 0xff, 0x01, 0x1b, 0xbd, 0xf0, 0xff, 0xff, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x08, 0x3d, 0xde, 0xff, 0x17, 0x81, 0xff, 0x78, 
+  0x92, 0xff, 0x37, 0x92, 0xff, 0xb7, 0x89, 0xff, 0x37, 0x9a, 0xff, 0xf7, 0x99, 0xff, 0x96, 0x91, 0xff, 0xd7, 0x99, 0xff, 0x81, 0x57, 0xa2, 0xff, 0x04, 0x16, 0x9a, 0xff, 0xb6, 0x99, 0xff, 0xd6, 
+  0x99, 0xff, 0x16, 0xa2, 0xff, 0x36, 0xa2, 0xff, 0x81, 0x56, 0xa2, 0xff, 0x03, 0xb6, 0xa1, 0xff, 0x16, 0xa2, 0xff, 0x37, 0xaa, 0xff, 0x17, 0xaa, 0xff, 0x83, 0x37, 0xaa, 0xff, 0x01, 0x17, 0xaa, 
+  0xff, 0xf6, 0xa9, 0xff, 0x82, 0xd6, 0xa9, 0xff, 0x02, 0x96, 0xa0, 0xff, 0x3a, 0xcc, 0xff, 0x7f, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xfb, 0x56, 0xba, 0xf3, 0x87, 0xb5, 0xb1, 
+  0xff, 0x02, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x08, 0xf7, 0x79, 0x24, 0x88, 0xf7, 0x79, 0xff, 0x00, 0x3f, 0xf7, 0xdc, 0x82, 0xff, 0xff, 0xff, 0x01, 0x7f, 0xff, 0xff, 0x38, 0x9a, 0xff, 0x82, 0xb6, 
+  0x91, 0xff, 0x04, 0x78, 0xa2, 0xff, 0xd8, 0xaa, 0xff, 0x77, 0xa2, 0xff, 0xd5, 0x99, 0xff, 0xb5, 0x99, 0xff, 0x81, 0xd5, 0x99, 0xff, 0x86, 0xb5, 0x99, 0xff, 0x01, 0x96, 0xb2, 0xff, 0xb7, 0xba, 
+  0xff, 0x86, 0xb5, 0xb1, 0xff, 0x03, 0x75, 0xb1, 0xff, 0x16, 0xb2, 0xff, 0x16, 0xba, 0xff, 0x55, 0xa9, 0xff, 0x81, 0xb5, 0xb1, 0xff, 0x00, 0x79, 0xcc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 
+  0xff, 0xfc, 0x7a, 0xdd, 0xf8, 0x87, 0xb5, 0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x08, 0xf7, 0x79, 0x27, 0x83, 0xf7, 0x79, 0xff, 0x04, 0xf7, 0x79, 0xf0, 0xf7, 0x81, 0xec, 0xd7, 0x81, 
+  0xfc, 0xd6, 0x81, 0xe7, 0x97, 0x9a, 0xd7, 0x83, 0xff, 0xff, 0xff, 0x04, 0xb8, 0xaa, 0xff, 0x96, 0x99, 0xff, 0x77, 0xa2, 0xff, 0x56, 0xa2, 0xff, 0xd5, 0x99, 0xff, 0x83, 0xb4, 0x99, 0xff, 0x81, 
+  0xb5, 0x99, 0xff, 0x00, 0xf5, 0xa1, 0xff, 0x81, 0x55, 0xaa, 0xff, 0x03, 0x35, 0xaa, 0xff, 0xd4, 0xa9, 0xff, 0x55, 0xb2, 0xff, 0x95, 0xba, 0xff, 0x81, 0x55, 0xba, 0xff, 0x82, 0x75, 0xba, 0xff, 
+  0x81, 0x55, 0xba, 0xff, 0x03, 0x35, 0xba, 0xff, 0xd5, 0xb1, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xf6, 0xff, 0x81, 0xff, 0xff, 0xff, 0x04, 0x3e, 0xf7, 0xff, 0xf6, 0xba, 0xff, 0xb5, 0xb1, 0xff, 0x15, 
+  0xa8, 0xff, 0xbd, 0xee, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xf6, 0xe7, 0x87, 0xb5, 0xb1, 0xff, 0x0b, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x0b, 0xf7, 0x79, 0x27, 0xf7, 0x79, 0xff, 0xf7, 0x79, 
+  0xeb, 0xd7, 0x81, 0xd3, 0xd6, 0x89, 0xf7, 0xd6, 0x91, 0xfb, 0xd5, 0x91, 0xf8, 0xd5, 0x91, 0xff, 0x35, 0x89, 0xff, 0x7b, 0xd5, 0xd0, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9d, 0xee, 0xff, 0x14, 0x99, 
+  0xff, 0x82, 0xb5, 0x99, 0xff, 0x00, 0xb4, 0x99, 0xff, 0x81, 0xb5, 0x99, 0xff, 0x04, 0x15, 0xa2, 0xff, 0xd6, 0xb2, 0xff, 0xb6, 0xba, 0xff, 0x14, 0xb2, 0xff, 0xd4, 0xb1, 0xff, 0x81, 0xf4, 0xb1, 
+  0xff, 0x00, 0xd4, 0xb1, 0xff, 0x81, 0xb3, 0xb1, 0xff, 0x81, 0x93, 0xb1, 0xff, 0x86, 0xb3, 0xb1, 0xff, 0x01, 0x93, 0xb1, 0xff, 0xfb, 0xe5, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xdc, 0xe5, 0xff, 
+  0x95, 0xb1, 0xff, 0x75, 0xb1, 0xff, 0xb7, 0xc2, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf3, 0x87, 0xb5, 0xb1, 0xff, 0x03, 0xb5, 0xb1, 0xc7, 0xb5, 0xb1, 0x0b, 0xd6, 0x89, 0x20, 0xd6, 
+  0x89, 0xf3, 0x85, 0xd5, 0x91, 0xff, 0x01, 0x15, 0x88, 0xff, 0x7f, 0xff, 0xd8, 0x82, 0xff, 0xff, 0xff, 0x02, 0x1a, 0xcd, 0xff, 0xd5, 0x99, 0xff, 0x15, 0xa2, 0xff, 0x81, 0xf4, 0xa1, 0xff, 0x13, 
+  0xd5, 0xb2, 0xff, 0xd5, 0xba, 0xff, 0x53, 0xb2, 0xff, 0xf3, 0xb1, 0xff, 0xd2, 0xa9, 0xff, 0xb2, 0xa9, 0xff, 0xd2, 0xa9, 0xff, 0xf3, 0xb1, 0xff, 0x33, 0xb2, 0xff, 0x54, 0xb2, 0xff, 0x34, 0xb2, 
+  0xff, 0xf5, 0xba, 0xff, 0xb6, 0xc3, 0xff, 0xf7, 0xcb, 0xff, 0xd7, 0xcb, 0xff, 0x96, 0xc3, 0xff, 0x14, 0xba, 0xff, 0x73, 0xb1, 0xff, 0x13, 0xba, 0xff, 0x54, 0xba, 0xff, 0x81, 0x74, 0xba, 0xff, 
+  0x01, 0x94, 0xba, 0xff, 0xbd, 0xf6, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xf6, 0xff, 0x81, 0x95, 0xb1, 0xff, 0x01, 0x14, 0xa8, 0xff, 0x9f, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x58, 
+  0xc3, 0xf8, 0x95, 0xb1, 0xff, 0x85, 0xb5, 0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xc8, 0xd5, 0xb1, 0x0b, 0xd5, 0x91, 0x28, 0x86, 0xd5, 0x91, 0xff, 0x01, 0x15, 0x80, 0xff, 0xff, 0xff, 0xf8, 0x82, 0xff, 
+  0xff, 0xff, 0x04, 0x57, 0xc4, 0xff, 0x13, 0xaa, 0xff, 0x53, 0xb2, 0xff, 0x13, 0xb2, 0xff, 0xd2, 0xa9, 0xff, 0x81, 0xb2, 0xa9, 0xff, 0x81, 0xd2, 0xa9, 0xff, 0x81, 0xb2, 0xa9, 0xff, 0x06, 0xd2, 
+  0xa9, 0xff, 0xb2, 0xa9, 0xff, 0x11, 0xa8, 0xff, 0xd8, 0xd4, 0xff, 0xdc, 0xee, 0xff, 0x3e, 0xf7, 0xff, 0x9f, 0xff, 0xff, 0x81, 0xbf, 0xff, 0xff, 0x04, 0x9f, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0x1a, 
+  0xee, 0xff, 0x73, 0xca, 0xff, 0x10, 0xc1, 0xff, 0x81, 0xf1, 0xc1, 0xff, 0x01, 0xd1, 0xc1, 0xff, 0x3a, 0xee, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xfa, 0xed, 0xff, 0x13, 0xc2, 0xff, 0x16, 0xb2, 
+  0xff, 0x35, 0xa9, 0xff, 0x1c, 0xee, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xba, 0xdc, 0xdc, 0x55, 0xb1, 0xff, 0x85, 0xb5, 0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 0xd5, 0x91, 0x28, 
+  0x82, 0xd5, 0x91, 0xff, 0x04, 0xd5, 0x91, 0xfc, 0xd5, 0x91, 0xff, 0xd4, 0x99, 0xf4, 0xd3, 0xa9, 0xdb, 0x12, 0xa8, 0xf0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xff, 0xb5, 0xc3, 0xff, 0x86, 
+  0xd2, 0xa9, 0xff, 0x00, 0xf2, 0xb1, 0xff, 0x81, 0x92, 0xc2, 0xff, 0x01, 0x51, 0xc2, 0xff, 0x33, 0xcb, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xba, 0xed, 0xff, 0x11, 0xc2, 0xff, 0x81, 0xf1, 0xc1, 
+  0xff, 0x01, 0xb2, 0xc1, 0xff, 0x9f, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0x7e, 0xff, 0xff, 0xb3, 0xca, 0xff, 0xf1, 0xc1, 0xff, 0x73, 0xc2, 0xff, 0xb5, 0xb1, 0xff, 0x7b, 0xdd, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0xbc, 0xe5, 0xd8, 0xd5, 0xb0, 0xff, 0x85, 0xb5, 0xb1, 0xff, 0x0a, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 0xd5, 0x91, 0x24, 0xd5, 0x99, 0xef, 0xd4, 0x99, 0xf0, 0xd3, 0xa1, 
+  0xfc, 0xd2, 0xa9, 0xeb, 0xd2, 0xb1, 0xf4, 0xd2, 0xb1, 0xff, 0xd2, 0xa9, 0xff, 0x52, 0xb1, 0xf7, 0x82, 0xff, 0xff, 0xff, 0x07, 0x9f, 0xff, 0xff, 0x55, 0xbb, 0xff, 0x73, 0xba, 0xff, 0x52, 0xba, 
+  0xff, 0xf1, 0xb1, 0xff, 0x31, 0xba, 0xff, 0x71, 0xc2, 0xff, 0x50, 0xc2, 0xff, 0x82, 0xf0, 0xc1, 0xff, 0x01, 0x0e, 0xb8, 0xff, 0x1a, 0xee, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x0c, 0x9f, 0xff, 0xff, 
+  0xd5, 0xd3, 0xff, 0xb1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0x10, 0xc0, 0xff, 0x77, 0xdc, 0xff, 0x97, 0xdc, 0xff, 0x70, 0xc0, 0xff, 0xd1, 0xc1, 0xff, 0xf1, 0xc1, 0xff, 0xd1, 0xc1, 0xff, 0x53, 0xc2, 
+  0xff, 0x3a, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9e, 0xf6, 0xdc, 0x15, 0xa8, 0xff, 0x85, 0xb5, 0xb1, 0xff, 0x04, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 0xd2, 0xa9, 0x27, 0xd2, 0xa9, 0xff, 
+  0xd2, 0xa9, 0xfc, 0x84, 0xd2, 0xa9, 0xff, 0x00, 0x13, 0xb2, 0xef, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xff, 0xf2, 0xca, 0xff, 0x81, 0x10, 0xc2, 0xff, 0x85, 0xf0, 0xc1, 0xff, 0x01, 0x0e, 
+  0xb8, 0xff, 0x1d, 0xf7, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xd4, 0xd2, 0xff, 0xd1, 0xc1, 0xff, 0x86, 0xf1, 0xc1, 0xff, 0x01, 0xd1, 0xc1, 0xff, 0x18, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 
+  0xfe, 0xf6, 0xdb, 0x14, 0xa8, 0xff, 0x85, 0xb5, 0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 0xd2, 0xa9, 0x28, 0x85, 0xd2, 0xa9, 0xff, 0x01, 0xd2, 0xb1, 0xf7, 0xb4, 0xc2, 0xdc, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0xf2, 0xca, 0xff, 0x81, 0xf0, 0xc1, 0xff, 0x82, 0xf0, 0xb9, 0xff, 0x03, 0x10, 0xc2, 0xff, 0x51, 0xc2, 0xff, 0x70, 0xc2, 0xff, 0x3a, 0xee, 0xff, 0x84, 
+  0xff, 0xff, 0xff, 0x07, 0x3d, 0xff, 0xff, 0xf9, 0xed, 0xff, 0x33, 0xe4, 0xff, 0xf0, 0xda, 0xff, 0x51, 0xdb, 0xff, 0xb5, 0xe4, 0xff, 0xbb, 0xf6, 0xff, 0xbf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 
+  0x01, 0x94, 0xd3, 0xff, 0xd1, 0xc1, 0xff, 0x85, 0xf1, 0xc1, 0xff, 0x01, 0xd1, 0xc1, 0xff, 0xf8, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x3e, 0xff, 0xd8, 0x14, 0xa8, 0xff, 0x85, 0xb5, 0xb1, 
+  0xff, 0x02, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 0xd2, 0xa9, 0x28, 0x82, 0xd2, 0xa9, 0xff, 0x01, 0xd1, 0xb1, 0xeb, 0xf0, 0xb9, 0xdb, 0x81, 0xef, 0xc1, 0xfb, 0x00, 0x52, 0xd3, 0xdb, 0x82, 0xff, 
+  0xff, 0xff, 0x09, 0x7e, 0xff, 0xff, 0x91, 0xc2, 0xff, 0xf0, 0xb9, 0xff, 0x51, 0xc2, 0xff, 0xf2, 0xca, 0xff, 0xd0, 0xd2, 0xff, 0x4d, 0xd2, 0xff, 0x4c, 0xd2, 0xff, 0x6d, 0xd2, 0xff, 0x70, 0xdb, 
+  0xff, 0x84, 0xff, 0xff, 0xff, 0x09, 0x16, 0xe5, 0xff, 0xae, 0xd2, 0xff, 0xcc, 0xd1, 0xff, 0x0c, 0xd2, 0xff, 0x0d, 0xd2, 0xff, 0x0c, 0xd2, 0xff, 0xec, 0xd1, 0xff, 0xcc, 0xd1, 0xff, 0x70, 0xdb, 
+  0xff, 0x9b, 0xf6, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xf6, 0xff, 0xf2, 0xd2, 0xff, 0xd1, 0xc1, 0xff, 0x85, 0xf1, 0xc1, 0xff, 0x00, 0xf7, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x5f, 
+  0xff, 0xdb, 0x14, 0xa8, 0xff, 0x85, 0xb5, 0xb1, 0xff, 0x05, 0xb5, 0xb1, 0xc8, 0xb5, 0xb1, 0x0b, 0xd2, 0xb1, 0x28, 0xd1, 0xb1, 0xff, 0xef, 0xb9, 0xd7, 0x0e, 0xc2, 0xec, 0x82, 0x0e, 0xc2, 0xff, 
+  0x01, 0xee, 0xc1, 0xff, 0x72, 0xd3, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x03, 0x7e, 0xff, 0xff, 0x51, 0xdb, 0xff, 0x6c, 0xd2, 0xff, 0x4b, 0xda, 0xff, 0x81, 0x2b, 0xda, 0xff, 0x81, 0x4b, 0xda, 0xff, 
+  0x01, 0xe8, 0xd0, 0xff, 0x7e, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x33, 0xe4, 0xff, 0xab, 0xc9, 0xff, 0x87, 0x2d, 0xd2, 0xff, 0x01, 0x8c, 0xd1, 0xff, 0xdc, 0xf6, 0xff, 0x83, 0xff, 0xff, 
+  0xff, 0x02, 0xb3, 0xd3, 0xff, 0x70, 0xca, 0xff, 0x31, 0xc2, 0xff, 0x84, 0xf1, 0xc1, 0xff, 0x00, 0xf7, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x5f, 0xff, 0xdf, 0x14, 0xa8, 0xff, 0x85, 0xb5, 
+  0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 0x0e, 0xc2, 0x27, 0x85, 0x0e, 0xc2, 0xff, 0x01, 0xee, 0xc1, 0xff, 0x73, 0xd3, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0xed, 
+  0xda, 0xff, 0x84, 0x4b, 0xda, 0xff, 0x01, 0x2b, 0xda, 0xff, 0x52, 0xe4, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0x56, 0xed, 0xff, 0xeb, 0xd1, 0xff, 0x0f, 0xdb, 0xff, 0x2d, 0xd2, 0xff, 0x0c, 0xd2, 
+  0xff, 0x86, 0x2d, 0xd2, 0xff, 0x01, 0x6c, 0xd1, 0xff, 0x3d, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0x7e, 0xff, 0xff, 0x0c, 0xc0, 0xff, 0x50, 0xca, 0xff, 0xb2, 0xca, 0xff, 0xd1, 0xc1, 0xff, 
+  0x82, 0xf1, 0xc1, 0xff, 0x00, 0xf7, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x7f, 0xff, 0xe4, 0x11, 0xb8, 0xeb, 0x85, 0xb5, 0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 0x0e, 0xc2, 
+  0x28, 0x83, 0x0e, 0xc2, 0xff, 0x03, 0x0e, 0xc2, 0xfc, 0x0e, 0xca, 0xd7, 0x2c, 0xd2, 0xdb, 0xb0, 0xe3, 0xdb, 0x82, 0xff, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0xed, 0xda, 0xff, 0x84, 0x4b, 0xda, 
+  0xff, 0x01, 0xea, 0xd1, 0xff, 0xbb, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x5d, 0xff, 0xff, 0xcd, 0xda, 0xff, 0x82, 0x4b, 0xda, 0xff, 0x01, 0x2f, 0xdb, 0xff, 0x6d, 0xd2, 0xff, 0x86, 0x2d, 
+  0xd2, 0xff, 0x00, 0x32, 0xdc, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xf1, 0xd2, 0xff, 0x0e, 0xca, 0xff, 0x2f, 0xca, 0xff, 0x71, 0xca, 0xff, 0x82, 0xf1, 0xc1, 0xff, 0x00, 0xd7, 0xdc, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0x02, 0x7f, 0xff, 0xe8, 0x10, 0xb8, 0xff, 0xd2, 0xb9, 0xdb, 0x84, 0xb5, 0xb1, 0xff, 0x07, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 0xef, 0xc1, 0x27, 0x0e, 0xc2, 0xf4, 0x0d, 0xca, 
+  0xf3, 0x2d, 0xca, 0xf3, 0x2b, 0xd2, 0xe0, 0x4a, 0xda, 0xf8, 0x81, 0x4a, 0xda, 0xff, 0x00, 0x8f, 0xe3, 0xe3, 0x82, 0xff, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0xed, 0xda, 0xff, 0x85, 0x4b, 0xda, 
+  0xff, 0x00, 0x1c, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x39, 0xf6, 0xff, 0xea, 0xd1, 0xff, 0x82, 0x4b, 0xda, 0xff, 0x05, 0x2b, 0xda, 0xff, 0x4b, 0xda, 0xff, 0xee, 0xda, 0xff, 0xce, 0xd2, 
+  0xff, 0x6e, 0xd2, 0xff, 0x0d, 0xd2, 0xff, 0x82, 0x2d, 0xd2, 0xff, 0x01, 0xce, 0xd2, 0xff, 0x5d, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x07, 0xb9, 0xed, 0xff, 0xce, 0xc9, 0xff, 0x0f, 0xca, 0xff, 
+  0x4f, 0xca, 0xff, 0x71, 0xca, 0xff, 0x11, 0xc2, 0xff, 0xf1, 0xc1, 0xff, 0xd7, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0x9f, 0xff, 0xeb, 0x10, 0xb8, 0xff, 0xf1, 0xc1, 0xff, 0xd3, 0xb9, 0xe7, 
+  0xb5, 0xb1, 0xfc, 0x82, 0xb5, 0xb1, 0xff, 0x04, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0b, 0x4b, 0xda, 0x28, 0x4b, 0xda, 0xff, 0x4a, 0xda, 0xfc, 0x84, 0x4a, 0xda, 0xff, 0x00, 0x8f, 0xe3, 0xe0, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0xee, 0xda, 0xff, 0x84, 0x4b, 0xda, 0xff, 0x01, 0x2e, 0xdb, 0xff, 0x7e, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x52, 0xe4, 0xff, 0x2b, 0xd2, 0xff, 
+  0x85, 0x4b, 0xda, 0xff, 0x03, 0x6b, 0xda, 0xff, 0x6c, 0xda, 0xff, 0xef, 0xda, 0xff, 0x0d, 0xd2, 0xff, 0x81, 0x2d, 0xd2, 0xff, 0x01, 0xec, 0xd1, 0xff, 0xfc, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0x01, 0xbb, 0xf6, 0xff, 0xae, 0xc9, 0xff, 0x81, 0x0f, 0xca, 0xff, 0x03, 0x2f, 0xca, 0xff, 0x91, 0xca, 0xff, 0xf1, 0xc1, 0xff, 0xd7, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xe8, 
+  0x10, 0xb8, 0xff, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xfb, 0xd4, 0xb9, 0xf8, 0x82, 0xb5, 0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xcb, 0xb5, 0xb1, 0x0c, 0x4a, 0xda, 0x28, 0x86, 0x4a, 0xda, 0xff, 0x00, 0x8f, 
+  0xe3, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0xed, 0xda, 0xff, 0x84, 0x4b, 0xda, 0xff, 0x01, 0x6f, 0xdb, 0xff, 0x9e, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x8f, 0xe3, 0xff, 
+  0x8b, 0xda, 0xff, 0x6b, 0xda, 0xff, 0x86, 0x4b, 0xda, 0xff, 0x05, 0x2a, 0xda, 0xff, 0x4f, 0xdb, 0xff, 0x6e, 0xd2, 0xff, 0x2d, 0xd2, 0xff, 0xac, 0xd1, 0xff, 0xbb, 0xf6, 0xff, 0x82, 0xff, 0xff, 
+  0xff, 0x01, 0xdc, 0xf6, 0xff, 0xae, 0xc9, 0xff, 0x82, 0x0f, 0xca, 0xff, 0x02, 0x2f, 0xca, 0xff, 0x71, 0xca, 0xff, 0xd7, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xbf, 0xff, 0xe8, 0x10, 0xb8, 
+  0xff, 0x81, 0xf2, 0xc1, 0xff, 0x01, 0xf1, 0xc1, 0xec, 0xb5, 0xb1, 0xf7, 0x81, 0xb5, 0xb1, 0xff, 0x02, 0xb5, 0xb1, 0xcb, 0xd5, 0xb1, 0x0c, 0x4a, 0xda, 0x28, 0x86, 0x4a, 0xda, 0xff, 0x00, 0x8f, 
+  0xe3, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x04, 0x7e, 0xff, 0xff, 0x8f, 0xe3, 0xff, 0x2d, 0xe3, 0xff, 0x0c, 0xe3, 0xff, 0xca, 0xe2, 0xff, 0x81, 0xeb, 0xe2, 0xff, 0x01, 0xf0, 0xe3, 0xff, 0xbf, 0xff, 
+  0xff, 0x82, 0xff, 0xff, 0xff, 0x05, 0xef, 0xeb, 0xff, 0xaa, 0xe2, 0xff, 0x8a, 0xda, 0xff, 0xec, 0xe2, 0xff, 0x0d, 0xdb, 0xff, 0x2b, 0xd2, 0xff, 0x85, 0x4b, 0xda, 0xff, 0x03, 0x8c, 0xda, 0xff, 
+  0x0f, 0xdb, 0xff, 0x0d, 0xd2, 0xff, 0xdb, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xbc, 0xf6, 0xff, 0xae, 0xc9, 0xff, 0x83, 0x0f, 0xca, 0xff, 0x01, 0x2f, 0xca, 0xff, 0xf6, 0xdc, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0xbf, 0xff, 0xe7, 0x10, 0xb8, 0xff, 0x82, 0xf2, 0xc1, 0xff, 0x05, 0xd2, 0xc1, 0xf3, 0xb5, 0xb1, 0xf7, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcc, 0xb5, 0xb1, 0x0c, 0x4a, 0xda, 
+  0x28, 0x86, 0x4a, 0xda, 0xff, 0x00, 0x8f, 0xe3, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xff, 0x4b, 0xeb, 0xff, 0x81, 0xa7, 0xe2, 0xff, 0x81, 0xc7, 0xe2, 0xff, 0x02, 0xa7, 0xe2, 0xff, 
+  0x29, 0xeb, 0xff, 0x5d, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xf3, 0xec, 0xff, 0x48, 0xda, 0xff, 0x82, 0x69, 0xda, 0xff, 0x02, 0x0c, 0xe3, 0xff, 0x8b, 0xda, 0xff, 0x6b, 0xda, 0xff, 0x84, 
+  0x4b, 0xda, 0xff, 0x02, 0x2b, 0xda, 0xff, 0xad, 0xda, 0xff, 0x3d, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x3a, 0xee, 0xff, 0xae, 0xc9, 0xff, 0x83, 0x0f, 0xca, 0xff, 0x01, 0x0e, 0xca, 0xff, 
+  0xf6, 0xe4, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xff, 0xe7, 0x10, 0xb8, 0xff, 0x83, 0xf2, 0xc1, 0xff, 0x04, 0xd3, 0xb9, 0xf4, 0xb5, 0xb1, 0xff, 0xb5, 0xb1, 0xcc, 0xb5, 0xb1, 0x0c, 0x4a, 
+  0xda, 0x28, 0x86, 0x4a, 0xda, 0xff, 0x00, 0x8f, 0xe3, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xff, 0x4b, 0xeb, 0xff, 0x84, 0xc8, 0xe2, 0xff, 0x01, 0x86, 0xe2, 0xff, 0xfb, 0xfe, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xfe, 0xff, 0x48, 0xda, 0xff, 0x84, 0x69, 0xda, 0xff, 0x01, 0xcb, 0xe2, 0xff, 0x0c, 0xdb, 0xff, 0x84, 0x4b, 0xda, 0xff, 0x01, 0x6f, 0xdb, 0xff, 0xbe, 0xff, 
+  0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x37, 0xed, 0xff, 0xee, 0xc9, 0xff, 0x83, 0x0f, 0xca, 0xff, 0x01, 0x0e, 0xca, 0xff, 0xf6, 0xe4, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xff, 0xe4, 0x10, 
+  0xb8, 0xff, 0x83, 0xf2, 0xc1, 0xff, 0x04, 0xf1, 0xc1, 0xf4, 0xb5, 0xb1, 0xf0, 0xb5, 0xb1, 0xcc, 0xb5, 0xb1, 0x0c, 0x4a, 0xda, 0x28, 0x86, 0x4a, 0xda, 0xff, 0x00, 0x8f, 0xe3, 0xdf, 0x82, 0xff, 
+  0xff, 0xff, 0x01, 0x9e, 0xff, 0xff, 0x6b, 0xeb, 0xff, 0x84, 0xc8, 0xe2, 0xff, 0x01, 0x86, 0xe2, 0xff, 0x17, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xff, 0xce, 0xe3, 0xff, 0x86, 
+  0x69, 0xda, 0xff, 0x01, 0xca, 0xe2, 0xff, 0xac, 0xda, 0xff, 0x81, 0x4b, 0xda, 0xff, 0x01, 0x0a, 0xd2, 0xff, 0x56, 0xed, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0x48, 0xd1, 0xff, 0x10, 0xd3, 0xff, 
+  0xee, 0xc9, 0xff, 0x82, 0x0f, 0xca, 0xff, 0x01, 0x0e, 0xca, 0xff, 0xf6, 0xe4, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xff, 0xe4, 0x10, 0xb8, 0xff, 0x84, 0xf2, 0xc1, 0xff, 0x03, 0xd2, 0xc1, 
+  0xec, 0xb5, 0xb1, 0xcf, 0xb5, 0xb1, 0x0c, 0x4a, 0xda, 0x28, 0x83, 0x4a, 0xda, 0xff, 0x03, 0x4a, 0xda, 0xfb, 0x6a, 0xda, 0xef, 0xa9, 0xda, 0xf3, 0x2e, 0xec, 0xcb, 0x82, 0xff, 0xff, 0xff, 0x01, 
+  0x9e, 0xff, 0xff, 0x6b, 0xeb, 0xff, 0x84, 0xc8, 0xe2, 0xff, 0x01, 0xa7, 0xe2, 0xff, 0x64, 0xe2, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xfe, 0xff, 0x28, 0xe2, 0xff, 0x86, 0x69, 0xda, 0xff, 
+  0x03, 0xca, 0xe2, 0xff, 0x8b, 0xda, 0xff, 0x2a, 0xda, 0xff, 0x32, 0xe4, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0x7a, 0xf6, 0xff, 0x68, 0xd1, 0xff, 0x2a, 0xda, 0xff, 0xf0, 0xd2, 0xff, 0x2f, 0xca, 
+  0xff, 0x81, 0x0f, 0xca, 0xff, 0x01, 0x0e, 0xca, 0xff, 0xf6, 0xe4, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xff, 0xe4, 0x10, 0xb8, 0xff, 0x85, 0xf2, 0xc1, 0xff, 0x02, 0xd3, 0xb9, 0xbc, 0xd5, 
+  0xb1, 0x0f, 0x4a, 0xda, 0x28, 0x82, 0x4a, 0xda, 0xff, 0x04, 0x4a, 0xda, 0xe3, 0xe8, 0xe2, 0xef, 0x08, 0xe3, 0xf8, 0x08, 0xe3, 0xff, 0xec, 0xeb, 0xe4, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9e, 0xff, 
+  0xff, 0x6b, 0xeb, 0xff, 0x85, 0xc8, 0xe2, 0xff, 0x01, 0x65, 0xe2, 0xff, 0x74, 0xf5, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x1c, 0xff, 0xff, 0x69, 0xe2, 0xff, 0x86, 0x69, 0xda, 0xff, 0x02, 0x28, 
+  0xda, 0xff, 0x51, 0xec, 0xff, 0xbf, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xff, 0xcd, 0xda, 0xff, 0x82, 0x4b, 0xda, 0xff, 0x04, 0xaf, 0xd2, 0xff, 0x0e, 0xca, 0xff, 0x0f, 0xca, 
+  0xff, 0x0e, 0xca, 0xff, 0x16, 0xe5, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x7f, 0xff, 0xe3, 0x10, 0xb8, 0xff, 0x85, 0xf2, 0xc1, 0xff, 0x05, 0xd2, 0xc1, 0xdb, 0xd4, 0xb9, 0x13, 0x4a, 0xda, 0x28, 
+  0x4a, 0xda, 0xff, 0x6a, 0xda, 0xf8, 0xc9, 0xe2, 0xe8, 0x83, 0x08, 0xe3, 0xff, 0x00, 0xab, 0xeb, 0xe7, 0x82, 0xff, 0xff, 0xff, 0x02, 0x9e, 0xff, 0xff, 0x8c, 0xeb, 0xff, 0xa7, 0xe2, 0xff, 0x83, 
+  0xc8, 0xe2, 0xff, 0x00, 0xa8, 0xe2, 0xff, 0x81, 0xc8, 0xe2, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0x5d, 0xff, 0xff, 0x92, 0xec, 0xff, 0x2c, 0xe3, 0xff, 0x69, 0xda, 0xff, 
+  0x81, 0x28, 0xda, 0xff, 0x02, 0xaa, 0xe2, 0xff, 0xae, 0xe3, 0xff, 0xb6, 0xf5, 0xff, 0x84, 0xff, 0xff, 0xff, 0x00, 0xb7, 0xed, 0xff, 0x84, 0x4b, 0xda, 0xff, 0x03, 0xb0, 0xd2, 0xff, 0x0f, 0xca, 
+  0xff, 0x0e, 0xca, 0xff, 0x17, 0xe5, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9e, 0xff, 0xe3, 0x0e, 0xc0, 0xe7, 0x85, 0xf2, 0xc1, 0xff, 0x04, 0xd2, 0xc1, 0xd0, 0xd2, 0xb9, 0x0f, 0x6a, 0xda, 0x20, 
+  0xc9, 0xe2, 0xf3, 0x08, 0xe3, 0xf7, 0x84, 0x08, 0xe3, 0xff, 0x00, 0x8a, 0xeb, 0xeb, 0x82, 0xff, 0xff, 0xff, 0x03, 0x9e, 0xff, 0xff, 0x0e, 0xec, 0xff, 0x6a, 0xeb, 0xff, 0x28, 0xe3, 0xff, 0x82, 
+  0x08, 0xe3, 0xff, 0x03, 0x29, 0xeb, 0xff, 0x6a, 0xeb, 0xff, 0x6b, 0xeb, 0xff, 0x2f, 0xec, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x81, 0xfc, 0xfe, 0xff, 0x01, 
+  0x3c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0x39, 0xf6, 0xff, 0x2a, 0xda, 0xff, 0x84, 0x4b, 0xda, 0xff, 0x03, 0x6c, 0xda, 0xff, 0x90, 0xd2, 0xff, 0xee, 0xc9, 0xff, 0x37, 
+  0xe5, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x9e, 0xff, 0xe3, 0x2c, 0xc0, 0xf4, 0xf1, 0xc1, 0xfc, 0x84, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcc, 0xf2, 0xc1, 0x0c, 0x08, 0xe3, 0x28, 0x86, 0x08, 
+  0xe3, 0xff, 0x00, 0x48, 0xeb, 0xf0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xbe, 0xff, 0xff, 0x2d, 0xec, 0xff, 0x85, 0x48, 0xe3, 0xff, 0x81, 0x28, 0xe3, 0xff, 0x01, 0x27, 0xe3, 0xff, 0x8e, 0xec, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0x01, 0xbb, 0xfe, 0xff, 0xa9, 0xd1, 0xff, 0x86, 0x4b, 0xda, 0xff, 0x02, 0xae, 0xda, 0xff, 0x0f, 0xca, 0xff, 0x58, 0xe5, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x3d, 0xff, 
+  0xdb, 0xec, 0xc8, 0xff, 0x10, 0xca, 0xe3, 0x84, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcc, 0xf2, 0xc1, 0x0c, 0x08, 0xe3, 0x28, 0x86, 0x08, 0xe3, 0xff, 0x00, 0xc4, 0xea, 0xf8, 0x82, 0xff, 0xff, 
+  0xff, 0x01, 0xdf, 0xff, 0xff, 0x4e, 0xec, 0xff, 0x86, 0x28, 0xe3, 0xff, 0x81, 0x48, 0xe3, 0xff, 0x02, 0x27, 0xe3, 0xff, 0xec, 0xeb, 0xff, 0xda, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x04, 0xdf, 
+  0xff, 0xff, 0xb6, 0xf5, 0xff, 0xea, 0xe2, 0xff, 0xac, 0xda, 0xff, 0x2b, 0xda, 0xff, 0x85, 0x4b, 0xda, 0xff, 0x02, 0x2a, 0xda, 0xff, 0x6e, 0xd2, 0xff, 0x98, 0xed, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0x03, 0x9b, 0xf6, 0xd7, 0x4d, 0xc9, 0xff, 0x0e, 0xca, 0xfb, 0xf1, 0xc1, 0xeb, 0x83, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcc, 0xf1, 0xc1, 0x0c, 0x08, 0xe3, 0x28, 0x86, 0x08, 0xe3, 0xff, 0x00, 
+  0x40, 0xe2, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x52, 0xf5, 0xff, 0x82, 0x6d, 0xec, 0xff, 0x81, 0x6c, 0xec, 0xff, 0x02, 0x6d, 0xec, 0xff, 0x2c, 0xec, 0xff, 0x48, 0xe3, 0xff, 0x81, 0x28, 0xe3, 
+  0xff, 0x03, 0x48, 0xe3, 0xff, 0x49, 0xe3, 0xff, 0x4e, 0xec, 0xff, 0x7d, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x05, 0x17, 0xf6, 0xff, 0x0a, 0xe3, 0xff, 0x68, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x89, 
+  0xe2, 0xff, 0x8b, 0xda, 0xff, 0x86, 0x4b, 0xda, 0xff, 0x01, 0x0a, 0xd2, 0xff, 0xf9, 0xf5, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xb9, 0xed, 0xdc, 0x8d, 0xc9, 0xff, 0x0e, 0xca, 0xff, 0x0f, 0xca, 
+  0xf7, 0x83, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcc, 0xf1, 0xc1, 0x0c, 0x08, 0xe3, 0x27, 0x86, 0x08, 0xe3, 0xff, 0x01, 0x40, 0xe2, 0xff, 0xdf, 0xff, 0xe8, 0x82, 0xff, 0xff, 0xff, 0x00, 0x73, 
+  0xf5, 0xff, 0x82, 0xc8, 0xeb, 0xff, 0x00, 0xa8, 0xeb, 0xff, 0x83, 0xc8, 0xeb, 0xff, 0x0e, 0x2a, 0xec, 0xff, 0x4c, 0xec, 0xff, 0x89, 0xeb, 0xff, 0x69, 0xeb, 0xff, 0x27, 0xe3, 0xff, 0x80, 0xe2, 
+  0xff, 0x89, 0xeb, 0xff, 0xb4, 0xf5, 0xff, 0x79, 0xf6, 0xff, 0xba, 0xfe, 0xff, 0xdb, 0xfe, 0xff, 0x59, 0xf6, 0xff, 0x71, 0xec, 0xff, 0x60, 0xe1, 0xff, 0xe5, 0xe1, 0xff, 0x83, 0x88, 0xe2, 0xff, 
+  0x00, 0xaa, 0xe2, 0xff, 0x86, 0x4b, 0xda, 0xff, 0x01, 0xc9, 0xd1, 0xff, 0xfc, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0x14, 0xdc, 0xef, 0xee, 0xc9, 0xff, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xf8, 
+  0xf1, 0xc1, 0xf4, 0x82, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcc, 0xd2, 0xc1, 0x0c, 0x08, 0xe3, 0x27, 0x86, 0x08, 0xe3, 0xff, 0x01, 0xa4, 0xe2, 0xfc, 0x3c, 0xff, 0xc8, 0x82, 0xff, 0xff, 0xff, 
+  0x05, 0x98, 0xfe, 0xff, 0xa7, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0x2a, 0xec, 0xff, 0x4b, 0xec, 0xff, 0x2a, 0xec, 0xff, 0x84, 0xc8, 0xeb, 0xff, 0x05, 0xe9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0x2b, 0xec, 
+  0xff, 0x89, 0xeb, 0xff, 0x28, 0xe3, 0xff, 0x27, 0xe3, 0xff, 0x82, 0x07, 0xe3, 0xff, 0x01, 0x4a, 0xe3, 0xff, 0x47, 0xe2, 0xff, 0x86, 0x88, 0xe2, 0xff, 0x01, 0x0b, 0xe3, 0xff, 0x2b, 0xd2, 0xff, 
+  0x84, 0x4b, 0xda, 0xff, 0x00, 0xc9, 0xd9, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x8f, 0xd2, 0xff, 0x82, 0x0e, 0xca, 0xff, 0x00, 0x0f, 0xca, 0xe0, 0x82, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcc, 
+  0xf1, 0xc1, 0x0c, 0x08, 0xe3, 0x27, 0x84, 0x08, 0xe3, 0xff, 0x03, 0x28, 0xe3, 0xfb, 0xa8, 0xeb, 0xeb, 0x48, 0xec, 0xf3, 0x6f, 0xf5, 0xeb, 0x83, 0xff, 0xff, 0xff, 0x00, 0x48, 0xec, 0xff, 0x84, 
+  0x29, 0xec, 0xff, 0x02, 0x8b, 0xec, 0xff, 0xac, 0xec, 0xff, 0x4b, 0xec, 0xff, 0x81, 0xe9, 0xeb, 0xff, 0x81, 0xc8, 0xeb, 0xff, 0x01, 0x0a, 0xec, 0xff, 0xea, 0xeb, 0xff, 0x84, 0x48, 0xe3, 0xff, 
+  0x00, 0x4b, 0xe3, 0xff, 0x86, 0x88, 0xe2, 0xff, 0x01, 0x68, 0xe2, 0xff, 0x2c, 0xe3, 0xff, 0x83, 0x4b, 0xda, 0xff, 0x01, 0xc9, 0xd1, 0xff, 0x15, 0xed, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9f, 
+  0xff, 0xe7, 0x2e, 0xca, 0xff, 0x82, 0x0e, 0xca, 0xff, 0x01, 0x2e, 0xca, 0xff, 0xf1, 0xc1, 0xf4, 0x81, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcb, 0xf2, 0xc1, 0x0c, 0x08, 0xe3, 0x27, 0x83, 0x08, 
+  0xe3, 0xff, 0x01, 0xa8, 0xeb, 0xe7, 0x29, 0xec, 0xf0, 0x82, 0x49, 0xec, 0xff, 0x00, 0xff, 0xff, 0xeb, 0x82, 0xff, 0xff, 0xff, 0x01, 0xb8, 0xfe, 0xff, 0xc4, 0xeb, 0xff, 0x83, 0x08, 0xec, 0xff, 
+  0x00, 0x28, 0xec, 0xff, 0x81, 0x29, 0xec, 0xff, 0x03, 0x6a, 0xec, 0xff, 0x4a, 0xec, 0xff, 0x8c, 0xec, 0xff, 0xe9, 0xeb, 0xff, 0x81, 0xc8, 0xeb, 0xff, 0x02, 0xea, 0xeb, 0xff, 0xca, 0xeb, 0xff, 
+  0x28, 0xe3, 0xff, 0x81, 0x48, 0xe3, 0xff, 0x02, 0x49, 0xeb, 0xff, 0x4a, 0xe3, 0xff, 0x68, 0xe2, 0xff, 0x85, 0x88, 0xe2, 0xff, 0x01, 0xa9, 0xe2, 0xff, 0x6b, 0xda, 0xff, 0x82, 0x4b, 0xda, 0xff, 
+  0x01, 0xac, 0xda, 0xff, 0xbf, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0x1a, 0xee, 0xfb, 0x84, 0x0e, 0xca, 0xff, 0x00, 0x0f, 0xca, 0xe3, 0x81, 0xf2, 0xc1, 0xff, 0x02, 0xf2, 0xc1, 0xcb, 0xf1, 
+  0xb9, 0x0c, 0x08, 0xe3, 0x27, 0x82, 0x08, 0xe3, 0xff, 0x00, 0x29, 0xec, 0xe0, 0x84, 0x49, 0xec, 0xff, 0x00, 0xb8, 0xfe, 0xf3, 0x83, 0xff, 0xff, 0xff, 0x00, 0x34, 0xf6, 0xff, 0x82, 0x4d, 0xf5, 
+  0xff, 0x01, 0x4e, 0xf5, 0xff, 0xcc, 0xec, 0xff, 0x84, 0x29, 0xec, 0xff, 0x02, 0x4a, 0xec, 0xff, 0x4b, 0xec, 0xff, 0xc9, 0xeb, 0xff, 0x81, 0xc8, 0xeb, 0xff, 0x01, 0x0b, 0xec, 0xff, 0x28, 0xe3, 
+  0xff, 0x82, 0x48, 0xe3, 0xff, 0x00, 0x6b, 0xe3, 0xff, 0x85, 0x88, 0xe2, 0xff, 0x05, 0x68, 0xe2, 0xff, 0x4c, 0xe3, 0xff, 0x2b, 0xd2, 0xff, 0x4b, 0xda, 0xff, 0x6b, 0xda, 0xff, 0x59, 0xf6, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfb, 0xf5, 0xe4, 0xd0, 0x84, 0x0e, 0xca, 0xff, 0x08, 0x0e, 0xca, 0xfc, 0xf1, 0xc1, 0xef, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xcb, 0xd2, 0xc1, 0x0b, 0x08, 
+  0xe3, 0x27, 0x08, 0xe3, 0xff, 0x48, 0xe3, 0xf0, 0x29, 0xec, 0xf4, 0x85, 0x49, 0xec, 0xff, 0x00, 0x0f, 0xed, 0xf4, 0x83, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0x14, 0xf6, 0xff, 0xa6, 0xec, 
+  0xff, 0xa8, 0xec, 0xff, 0x81, 0xc9, 0xec, 0xff, 0x03, 0xea, 0xec, 0xff, 0x2c, 0xed, 0xff, 0x8a, 0xec, 0xff, 0xab, 0xec, 0xff, 0x81, 0x29, 0xec, 0xff, 0x06, 0x49, 0xec, 0xff, 0x6b, 0xec, 0xff, 
+  0x0a, 0xec, 0xff, 0xc8, 0xeb, 0xff, 0xe9, 0xeb, 0xff, 0xea, 0xeb, 0xff, 0x28, 0xe3, 0xff, 0x81, 0x48, 0xe3, 0xff, 0x02, 0x69, 0xeb, 0xff, 0x4b, 0xe3, 0xff, 0x68, 0xe2, 0xff, 0x84, 0x88, 0xe2, 
+  0xff, 0x03, 0x47, 0xe2, 0xff, 0xab, 0xda, 0xff, 0xcd, 0xda, 0xff, 0x59, 0xf6, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0x3d, 0xff, 0xec, 0x8a, 0xd1, 0xfb, 0x0e, 0xca, 0xec, 0x84, 0x0e, 0xca, 0xff, 
+  0x06, 0xf0, 0xc1, 0xf4, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xc7, 0xd1, 0xc1, 0x0b, 0xe8, 0xe2, 0x23, 0x48, 0xe3, 0xe4, 0x49, 0xec, 0xfc, 0x86, 0x49, 0xec, 0xff, 0x01, 0x27, 0xec, 0xff, 0xb7, 0xfe, 
+  0xd0, 0x84, 0xff, 0xff, 0xff, 0x02, 0x9d, 0xff, 0xff, 0xf1, 0xf5, 0xff, 0xa7, 0xec, 0xff, 0x81, 0xa8, 0xec, 0xff, 0x00, 0xa9, 0xec, 0xff, 0x81, 0xc9, 0xec, 0xff, 0x05, 0x2c, 0xed, 0xff, 0x4a, 
+  0xec, 0xff, 0x28, 0xec, 0xff, 0x29, 0xec, 0xff, 0x4a, 0xec, 0xff, 0x0a, 0xec, 0xff, 0x81, 0xc8, 0xeb, 0xff, 0x01, 0x2b, 0xec, 0xff, 0x27, 0xe3, 0xff, 0x82, 0x28, 0xe3, 0xff, 0x02, 0x2b, 0xe3, 
+  0xff, 0x47, 0xe2, 0xff, 0x67, 0xe2, 0xff, 0x81, 0x47, 0xe2, 0xff, 0x03, 0xe5, 0xe1, 0xff, 0xe9, 0xe2, 0xff, 0xd6, 0xf5, 0xff, 0xbf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xeb, 
+  0x2c, 0xd2, 0xfc, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xd3, 0x84, 0x0e, 0xca, 0xff, 0x05, 0x0f, 0xca, 0xe7, 0xf2, 0xc1, 0xff, 0xf2, 0xc1, 0xc3, 0xf2, 0xc1, 0x07, 0x29, 0xec, 0x17, 0x49, 0xec, 0xe3, 
+  0x85, 0x49, 0xec, 0xff, 0x04, 0x69, 0xec, 0xf8, 0xa9, 0xec, 0xf4, 0x2a, 0xf5, 0xf0, 0xe7, 0xec, 0xff, 0x3a, 0xff, 0xdf, 0x86, 0xff, 0xff, 0xff, 0x06, 0x5b, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xb7, 
+  0xfe, 0xff, 0x96, 0xfe, 0xff, 0x75, 0xf6, 0xff, 0x55, 0xf6, 0xff, 0x35, 0xf6, 0xff, 0x81, 0x15, 0xf6, 0xff, 0x01, 0xf4, 0xf5, 0xff, 0x15, 0xf6, 0xff, 0x82, 0xd4, 0xf5, 0xff, 0x00, 0xd5, 0xf5, 
+  0xff, 0x82, 0xb4, 0xf5, 0xff, 0x05, 0x94, 0xf5, 0xff, 0x95, 0xf5, 0xff, 0xb6, 0xf5, 0xff, 0xf7, 0xf5, 0xff, 0x59, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf8, 
+  0xf1, 0xdb, 0xfb, 0x82, 0x2c, 0xd2, 0xff, 0x00, 0x0e, 0xca, 0xef, 0x83, 0x0e, 0xca, 0xff, 0x05, 0x0e, 0xca, 0xf7, 0xf1, 0xc1, 0xfc, 0xf2, 0xc1, 0xb4, 0x00, 0x00, 0x00, 0x49, 0xec, 0x0f, 0x49, 
+  0xec, 0xd0, 0x84, 0x49, 0xec, 0xff, 0x01, 0xa9, 0xec, 0xf0, 0x0a, 0xed, 0xf7, 0x83, 0x2a, 0xed, 0xff, 0x00, 0x19, 0xff, 0xe0, 0xa2, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe7, 0x31, 0xe4, 0xe7, 
+  0x0b, 0xd2, 0xff, 0x82, 0x2c, 0xd2, 0xff, 0x00, 0x2d, 0xd2, 0xf0, 0x84, 0x0e, 0xca, 0xff, 0x01, 0xf0, 0xc1, 0xdc, 0xf2, 0xc1, 0x98, 0x81, 0x00, 0x00, 0x00, 0x00, 0x49, 0xec, 0xb3, 0x83, 0x49, 
+  0xec, 0xff, 0x00, 0xc9, 0xec, 0xe4, 0x85, 0x2a, 0xed, 0xff, 0x03, 0x08, 0xed, 0xff, 0x52, 0xf6, 0xdb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0x9d, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xfb, 0x1c, 
+  0xff, 0xe8, 0x4a, 0xda, 0xfc, 0x4a, 0xda, 0xfb, 0x2c, 0xd2, 0xf8, 0x82, 0x2c, 0xd2, 0xff, 0x01, 0x2c, 0xd2, 0xf3, 0x0e, 0xca, 0xfb, 0x83, 0x0e, 0xca, 0xff, 0x01, 0x0e, 0xca, 0xe8, 0xd2, 0xb9, 
+  0x60, 0x81, 0x00, 0x00, 0x00, 0x00, 0x49, 0xec, 0x6f, 0x82, 0x49, 0xec, 0xff, 0x00, 0xe9, 0xec, 0xeb, 0x84, 0x2a, 0xed, 0xff, 0x07, 0x4a, 0xf5, 0xe8, 0x8a, 0xf5, 0xf7, 0xaa, 0xf5, 0xef, 0xa9, 
+  0xf5, 0xf8, 0xeb, 0xf5, 0xfb, 0xb6, 0xfe, 0xfb, 0x5a, 0xff, 0xeb, 0xff, 0xff, 0xeb, 0x98, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xfc, 0x9d, 0xff, 0xe8, 0x39, 0xf6, 0xf4, 0x31, 0xe4, 0xeb, 0xa7, 
+  0xd9, 0xff, 0x4a, 0xda, 0xff, 0x6a, 0xda, 0xf8, 0x4c, 0xd2, 0xfb, 0x82, 0x2c, 0xd2, 0xff, 0x01, 0x2c, 0xd2, 0xf3, 0x0e, 0xca, 0xfc, 0x84, 0x0e, 0xca, 0xff, 0x00, 0xd0, 0xc1, 0x0c, 0x82, 0x00, 
+  0x00, 0x00, 0x81, 0x49, 0xec, 0xff, 0x00, 0xe9, 0xec, 0xdf, 0x84, 0x2a, 0xed, 0xff, 0x01, 0x8a, 0xf5, 0xe7, 0xca, 0xf5, 0xfc, 0x81, 0xca, 0xf5, 0xff, 0x0a, 0xca, 0xf5, 0xe3, 0xca, 0xf5, 0xd4, 
+  0xca, 0xf5, 0xdf, 0xca, 0xf5, 0xe3, 0xca, 0xf5, 0xd7, 0x2e, 0xf6, 0xdb, 0xd4, 0xfe, 0xdc, 0x38, 0xff, 0xd3, 0x7a, 0xff, 0xd0, 0x9b, 0xff, 0xd3, 0x9c, 0xff, 0xd0, 0x81, 0x9d, 0xff, 0xd8, 0x03, 
+  0xbd, 0xff, 0xd8, 0x9d, 0xff, 0xdc, 0xbe, 0xff, 0xd4, 0xbd, 0xff, 0xd4, 0x81, 0xbd, 0xff, 0xd3, 0x0d, 0x7d, 0xff, 0xdc, 0x9d, 0xff, 0xdb, 0x9d, 0xff, 0xd8, 0x9d, 0xff, 0xd7, 0x7d, 0xff, 0xd8, 
+  0x3b, 0xff, 0xd8, 0xda, 0xfe, 0xd8, 0x99, 0xfe, 0xd8, 0x38, 0xfe, 0xd4, 0x54, 0xf5, 0xdc, 0xcd, 0xeb, 0xfb, 0xc9, 0xe2, 0xff, 0x88, 0xe2, 0xff, 0x89, 0xe2, 0xef, 0x83, 0x6a, 0xda, 0xff, 0x00, 
+  0x4b, 0xda, 0xef, 0x83, 0x2c, 0xd2, 0xff, 0x00, 0x2d, 0xca, 0xf0, 0x83, 0x0e, 0xca, 0xff, 0x00, 0x0e, 0xca, 0xaf, 0x83, 0x00, 0x00, 0x00, 0x01, 0x49, 0xec, 0x6c, 0xa9, 0xec, 0xf7, 0x83, 0x2a, 
+  0xed, 0xff, 0x02, 0x4a, 0xf5, 0xf8, 0xaa, 0xf5, 0xe0, 0xca, 0xf5, 0xff, 0x81, 0xca, 0xf5, 0xef, 0x00, 0xea, 0xf5, 0xf3, 0x81, 0xca, 0xf5, 0xff, 0x01, 0xca, 0xf5, 0xf7, 0xca, 0xf5, 0xf4, 0x81, 
+  0xca, 0xf5, 0xff, 0x05, 0xc9, 0xf5, 0xff, 0xa9, 0xf5, 0xe4, 0xa8, 0xf5, 0xf7, 0xa8, 0xf5, 0xfb, 0x67, 0xed, 0xeb, 0x26, 0xed, 0xf0, 0x81, 0x27, 0xed, 0xff, 0x01, 0x06, 0xed, 0xe7, 0x85, 0xec, 
+  0xfc, 0x81, 0x85, 0xec, 0xff, 0x01, 0x85, 0xec, 0xf3, 0xa4, 0xe3, 0xf3, 0x81, 0x84, 0xeb, 0xff, 0x02, 0xa4, 0xeb, 0xff, 0xe2, 0xe2, 0xe4, 0xc4, 0xe2, 0xff, 0x81, 0xc5, 0xe2, 0xff, 0x02, 0x85, 
+  0xe2, 0xf0, 0x46, 0xe2, 0xff, 0x67, 0xe2, 0xff, 0x81, 0x88, 0xe2, 0xff, 0x00, 0x87, 0xe2, 0xec, 0x83, 0x6a, 0xda, 0xff, 0x00, 0x6a, 0xda, 0xe0, 0x83, 0x2c, 0xd2, 0xff, 0x00, 0x2c, 0xd2, 0xd3, 
+  0x83, 0x0e, 0xca, 0xff, 0x00, 0x0e, 0xca, 0x1c, 0x83, 0x00, 0x00, 0x00, 0x01, 0xc9, 0xec, 0x08, 0x2a, 0xed, 0xdc, 0x82, 0x2a, 0xed, 0xff, 0x0d, 0x4a, 0xed, 0xf0, 0xca, 0xf5, 0xf7, 0xca, 0xf5, 
+  0xff, 0xca, 0xf5, 0xe8, 0xca, 0xf5, 0xfb, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xe8, 0x2b, 0xf6, 0xdf, 0x4b, 0xf6, 0xff, 0x4b, 0xf6, 0xfc, 0x4b, 0xf6, 0xfb, 0x4b, 0xf6, 0xff, 0x2b, 0xf6, 0xe8, 0xea, 
+  0xf5, 0xd0, 0x81, 0xca, 0xf5, 0xff, 0x03, 0xca, 0xf5, 0xf8, 0xca, 0xf5, 0xe7, 0xca, 0xf5, 0xf8, 0x4a, 0xf5, 0xdb, 0x81, 0x4a, 0xf5, 0xff, 0x01, 0x2a, 0xed, 0xf4, 0xc9, 0xec, 0xfc, 0x81, 0xc9, 
+  0xec, 0xff, 0x00, 0xa9, 0xec, 0xf0, 0x82, 0xe9, 0xeb, 0xff, 0x01, 0xe9, 0xeb, 0xfc, 0x28, 0xe3, 0xf0, 0x81, 0x28, 0xe3, 0xff, 0x01, 0x28, 0xe3, 0xe3, 0x88, 0xe2, 0xfc, 0x82, 0x88, 0xe2, 0xff, 
+  0x01, 0x87, 0xe2, 0xff, 0x69, 0xda, 0xf3, 0x83, 0x6a, 0xda, 0xff, 0x00, 0x2b, 0xd2, 0xef, 0x82, 0x2c, 0xd2, 0xff, 0x00, 0x2c, 0xd2, 0xf8, 0x82, 0x0e, 0xca, 0xff, 0x00, 0x0e, 0xca, 0x8c, 0x85, 
+  0x00, 0x00, 0x00, 0x0a, 0x2a, 0xed, 0x50, 0x2a, 0xed, 0xfc, 0x2a, 0xed, 0xff, 0x4a, 0xf5, 0xf8, 0xca, 0xf5, 0xf0, 0xca, 0xf5, 0xfc, 0xca, 0xf5, 0xd8, 0xca, 0xf5, 0xff, 0xea, 0xf5, 0xfb, 0x2a, 
+  0xf6, 0xdf, 0x6b, 0xf6, 0xfc, 0x86, 0x6b, 0xf6, 0xff, 0x09, 0x4b, 0xf6, 0xf4, 0xea, 0xf5, 0xe8, 0xca, 0xf5, 0xfc, 0xca, 0xf5, 0xf4, 0xca, 0xf5, 0xf0, 0xaa, 0xf5, 0xfc, 0x4a, 0xf5, 0xeb, 0x4a, 
+  0xf5, 0xff, 0x6a, 0xf5, 0xf8, 0xe9, 0xec, 0xf4, 0x81, 0xc9, 0xec, 0xff, 0x01, 0xc9, 0xec, 0xfc, 0x49, 0xec, 0xeb, 0x81, 0xe9, 0xeb, 0xff, 0x01, 0x09, 0xec, 0xff, 0x88, 0xeb, 0xe4, 0x81, 0x28, 
+  0xe3, 0xff, 0x01, 0x48, 0xe3, 0xf4, 0xa8, 0xe2, 0xf7, 0x83, 0x88, 0xe2, 0xff, 0x00, 0x88, 0xe2, 0xdc, 0x83, 0x6a, 0xda, 0xff, 0x00, 0x4b, 0xda, 0xcf, 0x83, 0x2c, 0xd2, 0xff, 0x03, 0x2e, 0xca, 
+  0xe8, 0x0e, 0xca, 0xff, 0x0e, 0xca, 0xdf, 0x0e, 0xca, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x07, 0x2a, 0xed, 0x5c, 0x2a, 0xed, 0xff, 0xaa, 0xf5, 0xf0, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xec, 0xca, 0xf5, 
+  0xff, 0xeb, 0xf5, 0xef, 0x4b, 0xf6, 0xf4, 0x89, 0x6b, 0xf6, 0xff, 0x05, 0x6b, 0xf6, 0xfc, 0x2b, 0xf6, 0xf4, 0xca, 0xf5, 0xf4, 0xca, 0xf5, 0xf8, 0xca, 0xf5, 0xe8, 0xaa, 0xf5, 0xe8, 0x81, 0x4a, 
+  0xf5, 0xff, 0x01, 0x4a, 0xf5, 0xf4, 0xc9, 0xec, 0xf8, 0x81, 0xc9, 0xec, 0xff, 0x00, 0x89, 0xec, 0xe7, 0x82, 0xe9, 0xeb, 0xff, 0x01, 0xc8, 0xeb, 0xf8, 0x28, 0xe3, 0xf4, 0x81, 0x28, 0xe3, 0xff, 
+  0x00, 0x08, 0xe3, 0xcc, 0x83, 0x88, 0xe2, 0xff, 0x01, 0x88, 0xe2, 0xfb, 0x6a, 0xda, 0xfb, 0x82, 0x6a, 0xda, 0xff, 0x00, 0x4a, 0xda, 0xf3, 0x83, 0x2c, 0xd2, 0xff, 0x02, 0x2d, 0xd2, 0xdc, 0x0e, 
+  0xca, 0xdb, 0x0e, 0xca, 0x1c, 0x88, 0x00, 0x00, 0x00, 0x04, 0xaa, 0xf5, 0x57, 0xca, 0xf5, 0xf7, 0xca, 0xf5, 0xe7, 0xca, 0xf5, 0xff, 0xea, 0xf5, 0xe4, 0x8d, 0x6b, 0xf6, 0xff, 0x04, 0x4b, 0xf6, 
+  0xf0, 0xca, 0xf5, 0xf8, 0xca, 0xf5, 0xfb, 0xca, 0xf5, 0xf4, 0x6a, 0xf5, 0xd3, 0x81, 0x4a, 0xf5, 0xff, 0x00, 0x2a, 0xf5, 0xe4, 0x81, 0xc9, 0xec, 0xff, 0x01, 0xc9, 0xec, 0xf7, 0x09, 0xec, 0xfc, 
+  0x81, 0xe9, 0xeb, 0xff, 0x01, 0xe9, 0xeb, 0xf8, 0x48, 0xe3, 0xf7, 0x81, 0x28, 0xe3, 0xff, 0x00, 0x28, 0xe3, 0xf0, 0x84, 0x88, 0xe2, 0xff, 0x00, 0x69, 0xda, 0xe8, 0x83, 0x6a, 0xda, 0xff, 0x00, 
+  0x4c, 0xd2, 0xfb, 0x82, 0x2c, 0xd2, 0xff, 0x01, 0x2c, 0xd2, 0xcb, 0x0f, 0xca, 0x1b, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xaa, 0xf5, 0x2f, 0xca, 0xf5, 0xb0, 0xea, 0xf5, 0xf7, 0x8f, 0x6b, 0xf6, 0xff, 
+  0x07, 0x0b, 0xf6, 0xe3, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xef, 0xca, 0xf5, 0xff, 0x6a, 0xf5, 0xe0, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xf8, 0xc9, 0xec, 0xf7, 0x81, 0xc9, 0xec, 0xff, 0x00, 0x69, 0xec, 
+  0xdb, 0x82, 0xe9, 0xeb, 0xff, 0x00, 0x88, 0xe3, 0xec, 0x82, 0x28, 0xe3, 0xff, 0x00, 0xa8, 0xe2, 0xeb, 0x83, 0x88, 0xe2, 0xff, 0x00, 0x69, 0xe2, 0xe8, 0x82, 0x6a, 0xda, 0xff, 0x05, 0x6a, 0xda, 
+  0xfb, 0x4b, 0xd2, 0xec, 0x2c, 0xd2, 0xff, 0x2c, 0xd2, 0xfb, 0x2c, 0xd2, 0x7f, 0x8c, 0xda, 0x08, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xea, 0xf5, 0x03, 0x4b, 0xf6, 0x38, 0x6b, 0xf6, 0xcf, 0x8f, 0x6b, 
+  0xf6, 0xff, 0x06, 0xca, 0xf5, 0xd4, 0xca, 0xf5, 0xff, 0xca, 0xf5, 0xef, 0x8a, 0xf5, 0xf4, 0x4a, 0xf5, 0xff, 0x4a, 0xf5, 0xfc, 0xe9, 0xec, 0xfc, 0x81, 0xc9, 0xec, 0xff, 0x00, 0xa9, 0xec, 0xf4, 
+  0x82, 0xe9, 0xeb, 0xff, 0x00, 0xa8, 0xeb, 0xd8, 0x82, 0x28, 0xe3, 0xff, 0x00, 0xe8, 0xe2, 0xdb, 0x83, 0x88, 0xe2, 0xff, 0x00, 0x89, 0xe2, 0xff, 0x82, 0x6a, 0xda, 0xff, 0x03, 0x6a, 0xda, 0xfc, 
+  0x4b, 0xd2, 0xe4, 0x2c, 0xd2, 0x8b, 0x4b, 0xd2, 0x10, 0x91, 0x00, 0x00, 0x00, 0x05, 0x6b, 0xfe, 0x10, 0x6b, 0xf6, 0x50, 0x6b, 0xf6, 0x8c, 0x6b, 0xf6, 0xa8, 0x6b, 0xf6, 0xb3, 0x6b, 0xf6, 0xbc, 
+  0x81, 0x6b, 0xf6, 0xbf, 0x82, 0x6b, 0xf6, 0xc0, 0x83, 0x6b, 0xf6, 0xc3, 0x08, 0x6b, 0xf6, 0xc4, 0x4b, 0xf6, 0xbf, 0xca, 0xf5, 0xc3, 0xca, 0xf5, 0xa4, 0xaa, 0xf5, 0xb3, 0x4a, 0xf5, 0xbf, 0x4a, 
+  0xf5, 0xc3, 0x0a, 0xed, 0xb4, 0xc9, 0xec, 0xc7, 0x81, 0xc9, 0xec, 0xc4, 0x00, 0x29, 0xec, 0xb7, 0x81, 0xe9, 0xeb, 0xc4, 0x00, 0xe9, 0xeb, 0xbc, 0x82, 0x28, 0xe3, 0xc4, 0x00, 0x08, 0xe3, 0xb8, 
+  0x81, 0x88, 0xe2, 0xc4, 0x81, 0x88, 0xe2, 0xc3, 0x04, 0x89, 0xe2, 0xbc, 0x6a, 0xda, 0xb0, 0x6a, 0xda, 0xa4, 0x6a, 0xda, 0x78, 0x6a, 0xda, 0x43, 0x99, 0x00, 0x00, 0x00, 0x09, 0x6b, 0xf6, 0x04, 
+  0x8a, 0xf6, 0x07, 0x4b, 0xf6, 0x07, 0x6a, 0xf6, 0x07, 0x6b, 0xf6, 0x07, 0x6a, 0xf6, 0x07, 0x4b, 0xf6, 0x07, 0x6b, 0xf6, 0x07, 0x8b, 0xfe, 0x08, 0x4b, 0xf6, 0x08, 0x81, 0x6b, 0xf6, 0x08, 0x02, 
+  0x0b, 0xf6, 0x07, 0xea, 0xed, 0x08, 0xca, 0xf5, 0x07, 0x81, 0x6a, 0xed, 0x07, 0x00, 0x49, 0xf5, 0x08, 0x82, 0xc9, 0xec, 0x08, 0x0c, 0x49, 0xec, 0x08, 0xe8, 0xeb, 0x08, 0x09, 0xec, 0x08, 0x29, 
+  0xec, 0x08, 0x88, 0xe3, 0x08, 0x28, 0xe3, 0x08, 0x28, 0xeb, 0x08, 0x48, 0xeb, 0x08, 0x08, 0xe3, 0x08, 0xc8, 0xe2, 0x08, 0x08, 0xe3, 0x08, 0x08, 0xeb, 0x07, 0xc8, 0xea, 0x04, 0x8e, 0x00, 0x00, 
+  0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x39, 0x00, 0x4b, 0x19, 0x00, 0x4b, 0x39, 0x00, 0x53, 0x39, 0x00, 0x4b, 0x59, 0x0c, 0x4b, 0x39, 0x17, 0x4b, 0x39, 0x1f, 0x4b, 0x39, 0x24, 0x52, 0xb9, 0x27, 0x52, 0xb9, 0x28, 0x52, 0xba, 0x2b, 0x5a, 0xba, 0x2b, 0x52, 0xb9, 0x2c, 0x52, 0xb9, 0x2c, 0x52, 0xb9, 0x2c, 0x5a, 0xb9, 0x2f, 0x52, 0xb9, 0x2f, 0x52, 0xb9, 0x2f, 0x52, 0x9a, 0x2f, 0x5a, 0xb9, 0x30, 0x5a, 0xb9, 0x2b, 0x6a, 0x18, 0x34, 0x6a, 0x18, 0x34, 0x6a, 0x18, 0x34, 0x6a, 0x18, 0x34, 0x6a, 0x18, 0x34, 0x6a, 0x18, 0x34, 0x6a, 0x18, 0x34, 0x6a, 0x38, 0x34, 0x6a, 0x19, 0x2f, 0x71, 0xf9, 0x2f, 0x71, 0xf9, 0x2f, 0x71, 0xf9, 0x2c, 0x71, 0xf9, 0x2c, 0x71, 0xd9, 0x2b, 0x71, 0xd9, 0x2b, 0x71, 0xd9, 0x2b, 0x79, 0xd9, 0x2c, 0x79, 0xb9, 0x2b, 0x79, 0xb9, 0x2b, 0x79, 0xb9, 0x27, 0x79, 0xb9, 0x24, 0x79, 0xb9, 0x23, 0x79, 0xb9, 0x1c, 0x79, 0xb9, 0x14, 0x71, 0xd9, 0x04, 0x79, 0xb9, 0x00, 0x79, 0xb9, 0x00, 0x49, 0xd8, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x39, 0x00, 0x4b, 0x39, 0x00, 0x54, 0x17, 0x00, 0x4b, 0x39, 0x4f, 0x4b, 0x39, 0x9f, 0x4b, 0x39, 0xcf, 0x4b, 0x39, 0xe3, 0x4b, 0x39, 0xf7, 0x53, 0x19, 0xeb, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x62, 0x79, 0xf0, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x19, 0xe4, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xd9, 0xec, 0x79, 0xd9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xfc, 0x79, 0xb9, 0xf0, 0x79, 0xb9, 0xdc, 0x79, 0xb9, 0xbc, 0x79, 0xb9, 0x78, 0x71, 0xb9, 0x24, 0x89, 0x98, 0x00, 0xa9, 0x79, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x8d, 0x00, 0x4b, 0x59, 0x00, 0x4a, 0xf9, 0x00, 0x4b, 0x39, 0x37, 0x4b, 0x39, 0xe7, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x53, 0x19, 0xd4, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xf7, 0x62, 0x59, 0xe3, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xfb, 0x69, 0xf9, 0xd8, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xfc, 0x71, 0xd9, 0xef, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xfc, 0x89, 0x98, 0xd4, 0x99, 0x98, 0xa7, 0xa1, 0x78, 0x0f, 0xc8, 0x1b, 0x00, 0x99, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x39, 0x00, 0x4b, 0x39, 0x00, 0x4b, 0x39, 0x10, 0x4b, 0x39, 0xaf, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xf0, 0x52, 0xf9, 0xef, 0x52, 0xb9, 0xfb, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xfb, 0x5a, 0x99, 0xeb, 0x6a, 0x38, 0xf7, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xfc, 0x6a, 0x19, 0xec, 0x71, 0xf9, 0xe3, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xfb, 0x71, 0xd9, 0xf4, 0x79, 0xd9, 0xf3, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xeb, 0x89, 0xb8, 0xec, 0x91, 0x98, 0xec, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xef, 0x99, 0x98, 0x58, 0x91, 0x99, 0x00, 0x99, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xad, 0x00, 0x4b, 0x39, 0x00, 0x4b, 0x18, 0x0b, 0x4b, 0x39, 0xe0, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xe3, 0x52, 0xb9, 0xf8, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xe7, 0x62, 0x59, 0xf8, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xf3, 0x71, 0xf9, 0xd3, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xe4, 0x79, 0xd9, 0xf8, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x81, 0xb9, 0xd8, 0x91, 0x98, 0xf3, 0x99, 0x98, 0xfc, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0x7f, 0x99, 0x98, 0x00, 0x99, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x59, 0x00, 0x4b, 0x39, 0x0f, 0x4b, 0x39, 0xe8, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xfb, 0x4b, 0x19, 0xf8, 0x52, 0xf9, 0xdc, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xfc, 0x5a, 0x99, 0xfb, 0x62, 0x79, 0xdf, 0x6a, 0x18, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x19, 0xef, 0x6a, 0x19, 0xe7, 0x71, 0xf9, 0xf8, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xfb, 0x71, 0xd9, 0xf8, 0x71, 0xd9, 0xec, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xf7, 0x81, 0xb9, 0xec, 0x91, 0x98, 0xdf, 0x99, 0x97, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0x6b, 0x91, 0x57, 0x00, 0x99, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4b, 0x39, 0x00, 0x4b, 0x5a, 0x00, 0x4b, 0x39, 0xa3, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xf8, 0x4b, 0x19, 0xd7, 0x52, 0xd9, 0xfc, 0x52, 0xb9, 0xfb, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x5a, 0xb9, 0xdc, 0x62, 0x59, 0xfc, 0x6a, 0x38, 0xfb, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x39, 0xef, 0x69, 0xf9, 0xeb, 0x71, 0xf9, 0xf3, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xff, 0x71, 0xf9, 0xe7, 0x79, 0xd9, 0xf7, 0x79, 0xb9, 0xfb, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x81, 0xb9, 0xdb, 0x91, 0x98, 0xf8, 0x99, 0x98, 0xf8, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xfc, 0x99, 0x98, 0x4c, 0x99, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x52, 0x99, 0x00, 0x4b, 0x39, 0x00, 0x4b, 0x39, 0x43, 0x4b, 0x39, 0xff, 0x53, 0x19, 0xd0, 0x52, 0xb9, 0xf3, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xfc, 0x52, 0xb9, 0xff, 0x5a, 0x99, 0xe3, 0x62, 0x39, 0xf0, 0x6a, 0x18, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xff, 0x6a, 0x18, 0xff, 0x6a, 0x18, 0xff, 0x6a, 0x18, 0xf8, 0x69, 0xf9, 0xd8, 0x71, 0xd9, 0xff, 0x71, 0xd9, 0xff, 0x71, 0xd9, 0xff, 0x71, 0xd9, 0xff, 0x71, 0xd9, 0xfc, 0x71, 0xd9, 0xf8, 0x71, 0xb9, 0xf0, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xff, 0x79, 0xb9, 0xfb, 0x79, 0xb9, 0xeb, 0x91, 0x98, 0xe3, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xd3, 0x99, 0x98, 0x07, 0x91, 0xf7, 0x00, 0x00, 0x00, 0x00, 
-  0x52, 0x9a, 0x00, 0x52, 0xf9, 0x00, 0x52, 0xd9, 0xdf, 0x52, 0xb9, 0xf8, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xf0, 0x5a, 0x99, 0xec, 0x62, 0x59, 0xf4, 0x6a, 0x39, 0xf7, 0x6a, 0x18, 0xff, 0x6a, 0x18, 0xff, 0x61, 0x98, 0xff, 0x50, 0x98, 0xff, 0x58, 0x78, 0xff, 0x69, 0xd9, 0xf7, 0x72, 0x79, 0xef, 0x69, 0x59, 0xd8, 0x79, 0xfa, 0xd0, 0x79, 0xba, 0xe0, 0x71, 0x99, 0xe3, 0x71, 0x99, 0xe3, 0x79, 0xba, 0xe3, 0x9b, 0x7b, 0xdb, 0xa3, 0xdb, 0xd0, 0xa3, 0xdb, 0xdf, 0xa3, 0xdb, 0xe0, 0xa3, 0xdb, 0xe0, 0xa3, 0xbb, 0xe3, 0xa3, 0x9b, 0xe3, 0x9b, 0x9b, 0xe3, 0x9b, 0x7b, 0xe4, 0x9b, 0x5a, 0xe7, 0x9b, 0x1a, 0xe8, 0x92, 0xba, 0xec, 0x8a, 0x5a, 0xdf, 0x88, 0x99, 0xf0, 0x88, 0x17, 0xec, 0x90, 0x17, 0xff, 0x91, 0x17, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x91, 0x98, 0x57, 0x91, 0x98, 0x00, 0x68, 0x0d, 0x00, 
-  0x52, 0xb9, 0x00, 0x52, 0xb9, 0x44, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0x99, 0xe3, 0x62, 0x79, 0xe4, 0x6a, 0x19, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x7a, 0xf9, 0xf4, 0xcd, 0xfd, 0xcf, 0xff, 0xbf, 0xdb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf6, 0xfe, 0xd7, 0xcc, 0x7b, 0xe0, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x97, 0xe0, 0xb1, 0xb6, 0xe0, 0xb1, 0xd6, 0x00, 0x88, 0x71, 0x00, 
-  0x52, 0xba, 0x00, 0x52, 0xb9, 0xa3, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xfb, 0x52, 0xb9, 0xeb, 0x5a, 0x79, 0xfb, 0x62, 0x59, 0xe4, 0x6a, 0x39, 0xf0, 0x6a, 0x18, 0xff, 0x6a, 0x18, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xff, 0x61, 0xb8, 0xfb, 0xb5, 0x3c, 0xf0, 0xf7, 0x5f, 0xdf, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xe6, 0x5d, 0xec, 0xb3, 0xd9, 0xf4, 0x90, 0x77, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x97, 0xef, 0xa1, 0x97, 0xf0, 0xa9, 0xb6, 0xe4, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0x33, 0xb1, 0xb5, 0x00, 
-  0x52, 0xb9, 0x0b, 0x52, 0xb9, 0xcc, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xe7, 0x5a, 0x79, 0xdf, 0x62, 0x38, 0xff, 0x6a, 0x38, 0xfb, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xff, 0x69, 0xf9, 0xe8, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x1d, 0xdb, 0x90, 0x17, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x98, 0xff, 0x99, 0x97, 0xe0, 0xa9, 0xb6, 0xf4, 0xb1, 0xb5, 0xfb, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0x78, 0xb1, 0xb5, 0x00, 
-  0x62, 0x79, 0x17, 0x62, 0x79, 0xc8, 0x6a, 0x39, 0xf8, 0x6a, 0x18, 0xff, 0x6a, 0x18, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xff, 0x8b, 0x9a, 0xec, 0xff, 0xdf, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xf7, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xbe, 0xe4, 0x99, 0xd8, 0xfc, 0x99, 0x97, 0xf4, 0xa1, 0x97, 0xef, 0xa9, 0xb6, 0xe3, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xa7, 0xb1, 0xb6, 0x00, 
-  0x6a, 0x39, 0x1f, 0x6a, 0x38, 0xf4, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x39, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xe7, 0x79, 0xf8, 0xd7, 0xff, 0xdf, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x5d, 0xff, 0xbc, 0xfb, 0xff, 0xac, 0x59, 0xff, 0xa3, 0xb9, 0xff, 0x9b, 0x18, 0xff, 0x92, 0xd8, 0xff, 0x92, 0xb8, 0xff, 0x92, 0xd8, 0xff, 0xa3, 0x39, 0xff, 0xa2, 0xb8, 0xff, 0x9a, 0x57, 0xff, 0xa2, 0x77, 0xff, 0xa2, 0x57, 0xff, 0xa2, 0x37, 0xff, 0xa2, 0x37, 0xff, 0xa2, 0x37, 0xff, 0x9a, 0x37, 0xff, 0x9a, 0x37, 0xff, 0x9a, 0x37, 0xff, 0x9a, 0x57, 0xff, 0xaa, 0xb8, 0xff, 0xb3, 0x39, 0xff, 0xb3, 0x39, 0xff, 0xb3, 0x38, 0xff, 0xbb, 0xd9, 0xff, 0xc4, 0x99, 0xff, 0xd5, 0x5b, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xde, 0xdf, 0xa8, 0x15, 0xf7, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xb8, 0xa9, 0xd5, 0x03, 
-  0x6a, 0x38, 0x23, 0x6a, 0x38, 0xfb, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x38, 0xfb, 0x6a, 0x38, 0xff, 0x72, 0x18, 0xec, 0x79, 0xf7, 0xd7, 0x79, 0xf7, 0xfc, 0x79, 0x57, 0xff, 0xff, 0x9f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0x92, 0x78, 0xff, 0x79, 0x56, 0xff, 0x81, 0xd7, 0xff, 0x81, 0xf7, 0xff, 0x81, 0xd7, 0xff, 0x8a, 0x17, 0xff, 0x9a, 0xd8, 0xff, 0x9a, 0x57, 0xff, 0x91, 0x96, 0xff, 0x91, 0x96, 0xff, 0x91, 0x96, 0xff, 0x91, 0xb6, 0xff, 0x91, 0xb7, 0xff, 0x91, 0xb7, 0xff, 0x99, 0xd7, 0xff, 0x99, 0xd7, 0xff, 0x99, 0xb6, 0xff, 0xa2, 0x17, 0xff, 0xb2, 0xd8, 0xff, 0xb2, 0x98, 0xff, 0xa1, 0x96, 0xff, 0xa1, 0x96, 0xff, 0xa1, 0x76, 0xff, 0xa1, 0x76, 0xff, 0xa1, 0x96, 0xff, 0xa1, 0x96, 0xff, 0xa1, 0x96, 0xff, 0xa1, 0x56, 0xff, 0xa0, 0x56, 0xff, 0xd5, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xba, 0xe0, 0xb1, 0x55, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc3, 0xb1, 0xd5, 0x08, 
-  0x6a, 0x18, 0x24, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xe7, 0x72, 0x18, 0xeb, 0x71, 0xf8, 0xfb, 0x79, 0xf7, 0xe8, 0x79, 0xf7, 0xf7, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0xbd, 0x1b, 0xf0, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x3d, 0xff, 0x81, 0x17, 0xff, 0x92, 0x78, 0xff, 0x92, 0x37, 0xff, 0x89, 0xb7, 0xff, 0x9a, 0x37, 0xff, 0x99, 0xf7, 0xff, 0x91, 0x96, 0xff, 0x99, 0xd7, 0xff, 0xa2, 0x57, 0xff, 0xa2, 0x57, 0xff, 0x9a, 0x16, 0xff, 0x99, 0xb6, 0xff, 0x99, 0xd6, 0xff, 0xa2, 0x16, 0xff, 0xa2, 0x36, 0xff, 0xa2, 0x56, 0xff, 0xa2, 0x56, 0xff, 0xa1, 0xb6, 0xff, 0xa2, 0x16, 0xff, 0xaa, 0x37, 0xff, 0xaa, 0x17, 0xff, 0xaa, 0x37, 0xff, 0xaa, 0x37, 0xff, 0xaa, 0x37, 0xff, 0xaa, 0x37, 0xff, 0xaa, 0x17, 0xff, 0xa9, 0xf6, 0xff, 0xa9, 0xd6, 0xff, 0xa9, 0xd6, 0xff, 0xa9, 0xd6, 0xff, 0xa0, 0x96, 0xff, 0xcc, 0x3a, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfb, 0xba, 0x56, 0xf3, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x08, 
-  0x79, 0xf7, 0x24, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0xf7, 0x3f, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x9a, 0x38, 0xff, 0x91, 0xb6, 0xff, 0x91, 0xb6, 0xff, 0x91, 0xb6, 0xff, 0xa2, 0x78, 0xff, 0xaa, 0xd8, 0xff, 0xa2, 0x77, 0xff, 0x99, 0xd5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xd5, 0xff, 0x99, 0xd5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0xb2, 0x96, 0xff, 0xba, 0xb7, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0x75, 0xff, 0xb2, 0x16, 0xff, 0xba, 0x16, 0xff, 0xa9, 0x55, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xcc, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdd, 0x7a, 0xf8, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x08, 
-  0x79, 0xf7, 0x27, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xf0, 0x81, 0xf7, 0xec, 0x81, 0xd7, 0xfc, 0x81, 0xd6, 0xe7, 0x9a, 0x97, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xb8, 0xff, 0x99, 0x96, 0xff, 0xa2, 0x77, 0xff, 0xa2, 0x56, 0xff, 0x99, 0xd5, 0xff, 0x99, 0xb4, 0xff, 0x99, 0xb4, 0xff, 0x99, 0xb4, 0xff, 0x99, 0xb4, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0xa1, 0xf5, 0xff, 0xaa, 0x55, 0xff, 0xaa, 0x55, 0xff, 0xaa, 0x35, 0xff, 0xa9, 0xd4, 0xff, 0xb2, 0x55, 0xff, 0xba, 0x95, 0xff, 0xba, 0x55, 0xff, 0xba, 0x55, 0xff, 0xba, 0x75, 0xff, 0xba, 0x75, 0xff, 0xba, 0x75, 0xff, 0xba, 0x55, 0xff, 0xba, 0x55, 0xff, 0xba, 0x35, 0xff, 0xb1, 0xd5, 0xff, 0xba, 0xd6, 0xff, 0xf6, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3e, 0xff, 0xba, 0xf6, 0xff, 0xb1, 0xb5, 0xff, 0xa8, 0x15, 0xff, 0xee, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xe7, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x0b, 
-  0x79, 0xf7, 0x27, 0x79, 0xf7, 0xff, 0x79, 0xf7, 0xeb, 0x81, 0xd7, 0xd3, 0x89, 0xd6, 0xf7, 0x91, 0xd6, 0xfb, 0x91, 0xd5, 0xf8, 0x91, 0xd5, 0xff, 0x89, 0x35, 0xff, 0xd5, 0x7b, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x9d, 0xff, 0x99, 0x14, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb4, 0xff, 0x99, 0xb5, 0xff, 0x99, 0xb5, 0xff, 0xa2, 0x15, 0xff, 0xb2, 0xd6, 0xff, 0xba, 0xb6, 0xff, 0xb2, 0x14, 0xff, 0xb1, 0xd4, 0xff, 0xb1, 0xf4, 0xff, 0xb1, 0xf4, 0xff, 0xb1, 0xd4, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0x93, 0xff, 0xb1, 0x93, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0xb3, 0xff, 0xb1, 0x93, 0xff, 0xe5, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xdc, 0xff, 0xb1, 0x95, 0xff, 0xb1, 0x75, 0xff, 0xc2, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x0b, 
-  0x89, 0xd6, 0x20, 0x89, 0xd6, 0xf3, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x88, 0x15, 0xff, 0xff, 0x7f, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x1a, 0xff, 0x99, 0xd5, 0xff, 0xa2, 0x15, 0xff, 0xa1, 0xf4, 0xff, 0xa1, 0xf4, 0xff, 0xb2, 0xd5, 0xff, 0xba, 0xd5, 0xff, 0xb2, 0x53, 0xff, 0xb1, 0xf3, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xb2, 0xff, 0xa9, 0xd2, 0xff, 0xb1, 0xf3, 0xff, 0xb2, 0x33, 0xff, 0xb2, 0x54, 0xff, 0xb2, 0x34, 0xff, 0xba, 0xf5, 0xff, 0xc3, 0xb6, 0xff, 0xcb, 0xf7, 0xff, 0xcb, 0xd7, 0xff, 0xc3, 0x96, 0xff, 0xba, 0x14, 0xff, 0xb1, 0x73, 0xff, 0xba, 0x13, 0xff, 0xba, 0x54, 0xff, 0xba, 0x74, 0xff, 0xba, 0x74, 0xff, 0xba, 0x94, 0xff, 0xf6, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xb1, 0x95, 0xff, 0xb1, 0x95, 0xff, 0xa8, 0x14, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x58, 0xf8, 0xb1, 0x95, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc8, 0xb1, 0xd5, 0x0b, 
-  0x91, 0xd5, 0x28, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x80, 0x15, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x57, 0xff, 0xaa, 0x13, 0xff, 0xb2, 0x53, 0xff, 0xb2, 0x13, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xb2, 0xff, 0xa9, 0xb2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xb2, 0xff, 0xa9, 0xb2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xb2, 0xff, 0xa8, 0x11, 0xff, 0xd4, 0xd8, 0xff, 0xee, 0xdc, 0xff, 0xf7, 0x3e, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9f, 0xff, 0xf6, 0xfd, 0xff, 0xee, 0x1a, 0xff, 0xca, 0x73, 0xff, 0xc1, 0x10, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xd1, 0xff, 0xee, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xfa, 0xff, 0xc2, 0x13, 0xff, 0xb2, 0x16, 0xff, 0xa9, 0x35, 0xff, 0xee, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xba, 0xdc, 0xb1, 0x55, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 
-  0x91, 0xd5, 0x28, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xff, 0x91, 0xd5, 0xfc, 0x91, 0xd5, 0xff, 0x99, 0xd4, 0xf4, 0xa9, 0xd3, 0xdb, 0xa8, 0x12, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc3, 0xb5, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xb1, 0xf2, 0xff, 0xc2, 0x92, 0xff, 0xc2, 0x92, 0xff, 0xc2, 0x51, 0xff, 0xcb, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xba, 0xff, 0xc2, 0x11, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xb2, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xca, 0xb3, 0xff, 0xc1, 0xf1, 0xff, 0xc2, 0x73, 0xff, 0xb1, 0xb5, 0xff, 0xdd, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xbc, 0xd8, 0xb0, 0xd5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 
-  0x91, 0xd5, 0x24, 0x99, 0xd5, 0xef, 0x99, 0xd4, 0xf0, 0xa1, 0xd3, 0xfc, 0xa9, 0xd2, 0xeb, 0xb1, 0xd2, 0xf4, 0xb1, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xb1, 0x52, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xbb, 0x55, 0xff, 0xba, 0x73, 0xff, 0xba, 0x52, 0xff, 0xb1, 0xf1, 0xff, 0xba, 0x31, 0xff, 0xc2, 0x71, 0xff, 0xc2, 0x50, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xb8, 0x0e, 0xff, 0xee, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xd3, 0xd5, 0xff, 0xc1, 0xb1, 0xff, 0xc1, 0xf1, 0xff, 0xc0, 0x10, 0xff, 0xdc, 0x77, 0xff, 0xdc, 0x97, 0xff, 0xc0, 0x70, 0xff, 0xc1, 0xd1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xd1, 0xff, 0xc2, 0x53, 0xff, 0xdd, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9e, 0xdc, 0xa8, 0x15, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 
-  0xa9, 0xd2, 0x27, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xfc, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xb2, 0x13, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xca, 0xf2, 0xff, 0xc2, 0x10, 0xff, 0xc2, 0x10, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xb8, 0x0e, 0xff, 0xf7, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xd4, 0xff, 0xc1, 0xd1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xd1, 0xff, 0xdd, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xdb, 0xa8, 0x14, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 
-  0xa9, 0xd2, 0x28, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xb1, 0xd2, 0xf7, 0xc2, 0xb4, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xca, 0xf2, 0xff, 0xc1, 0xf0, 0xff, 0xc1, 0xf0, 0xff, 0xb9, 0xf0, 0xff, 0xb9, 0xf0, 0xff, 0xb9, 0xf0, 0xff, 0xc2, 0x10, 0xff, 0xc2, 0x51, 0xff, 0xc2, 0x70, 0xff, 0xee, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xed, 0xf9, 0xff, 0xe4, 0x33, 0xff, 0xda, 0xf0, 0xff, 0xdb, 0x51, 0xff, 0xe4, 0xb5, 0xff, 0xf6, 0xbb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x94, 0xff, 0xc1, 0xd1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xd1, 0xff, 0xdc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xd8, 0xa8, 0x14, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 
-  0xa9, 0xd2, 0x28, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xb1, 0xd1, 0xeb, 0xb9, 0xf0, 0xdb, 0xc1, 0xef, 0xfb, 0xc1, 0xef, 0xfb, 0xd3, 0x52, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xc2, 0x91, 0xff, 0xb9, 0xf0, 0xff, 0xc2, 0x51, 0xff, 0xca, 0xf2, 0xff, 0xd2, 0xd0, 0xff, 0xd2, 0x4d, 0xff, 0xd2, 0x4c, 0xff, 0xd2, 0x6d, 0xff, 0xdb, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x16, 0xff, 0xd2, 0xae, 0xff, 0xd1, 0xcc, 0xff, 0xd2, 0x0c, 0xff, 0xd2, 0x0d, 0xff, 0xd2, 0x0c, 0xff, 0xd1, 0xec, 0xff, 0xd1, 0xcc, 0xff, 0xdb, 0x70, 0xff, 0xf6, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0xff, 0xd2, 0xf2, 0xff, 0xc1, 0xd1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xdb, 0xa8, 0x14, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 
-  0xb1, 0xd2, 0x28, 0xb1, 0xd1, 0xff, 0xb9, 0xef, 0xd7, 0xc2, 0x0e, 0xec, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc1, 0xee, 0xff, 0xd3, 0x72, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xdb, 0x51, 0xff, 0xd2, 0x6c, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x2b, 0xff, 0xda, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd0, 0xe8, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x33, 0xff, 0xc9, 0xab, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd1, 0x8c, 0xff, 0xf6, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xb3, 0xff, 0xca, 0x70, 0xff, 0xc2, 0x31, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xdf, 0xa8, 0x14, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 
-  0xc2, 0x0e, 0x27, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc1, 0xee, 0xff, 0xd3, 0x73, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xda, 0xed, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x2b, 0xff, 0xe4, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x56, 0xff, 0xd1, 0xeb, 0xff, 0xdb, 0x0f, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x0c, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd1, 0x6c, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xc0, 0x0c, 0xff, 0xca, 0x50, 0xff, 0xca, 0xb2, 0xff, 0xc1, 0xd1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe4, 0xb8, 0x11, 0xeb, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 
-  0xc2, 0x0e, 0x28, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xff, 0xc2, 0x0e, 0xfc, 0xca, 0x0e, 0xd7, 0xd2, 0x2c, 0xdb, 0xe3, 0xb0, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xda, 0xed, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd1, 0xea, 0xff, 0xf6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xda, 0xcd, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xdb, 0x2f, 0xff, 0xd2, 0x6d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xdc, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf1, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x2f, 0xff, 0xca, 0x71, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe8, 0xb8, 0x10, 0xff, 0xb9, 0xd2, 0xdb, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 
-  0xc1, 0xef, 0x27, 0xc2, 0x0e, 0xf4, 0xca, 0x0d, 0xf3, 0xca, 0x2d, 0xf3, 0xd2, 0x2b, 0xe0, 0xda, 0x4a, 0xf8, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xe3, 0x8f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xda, 0xed, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x39, 0xff, 0xd1, 0xea, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0xee, 0xff, 0xd2, 0xce, 0xff, 0xd2, 0x6e, 0xff, 0xd2, 0x0d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0xce, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb9, 0xff, 0xc9, 0xce, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x4f, 0xff, 0xca, 0x71, 0xff, 0xc2, 0x11, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xeb, 0xb8, 0x10, 0xff, 0xc1, 0xf1, 0xff, 0xb9, 0xd3, 0xe7, 0xb1, 0xb5, 0xfc, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 
-  0xda, 0x4b, 0x28, 0xda, 0x4b, 0xff, 0xda, 0x4a, 0xfc, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xe3, 0x8f, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xda, 0xee, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xdb, 0x2e, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x52, 0xff, 0xd2, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x6b, 0xff, 0xda, 0x6c, 0xff, 0xda, 0xef, 0xff, 0xd2, 0x0d, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xd1, 0xec, 0xff, 0xf6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbb, 0xff, 0xc9, 0xae, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x2f, 0xff, 0xca, 0x91, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe8, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xfb, 0xb9, 0xd4, 0xf8, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0c, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xe3, 0x8f, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xda, 0xed, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xdb, 0x6f, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x8f, 0xff, 0xda, 0x8b, 0xff, 0xda, 0x6b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x2a, 0xff, 0xdb, 0x4f, 0xff, 0xd2, 0x6e, 0xff, 0xd2, 0x2d, 0xff, 0xd1, 0xac, 0xff, 0xf6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdc, 0xff, 0xc9, 0xae, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x2f, 0xff, 0xca, 0x71, 0xff, 0xdc, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe8, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf1, 0xec, 0xb1, 0xb5, 0xf7, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcb, 0xb1, 0xd5, 0x0c, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xe3, 0x8f, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xe3, 0x8f, 0xff, 0xe3, 0x2d, 0xff, 0xe3, 0x0c, 0xff, 0xe2, 0xca, 0xff, 0xe2, 0xeb, 0xff, 0xe2, 0xeb, 0xff, 0xe3, 0xf0, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xef, 0xff, 0xe2, 0xaa, 0xff, 0xda, 0x8a, 0xff, 0xe2, 0xec, 0xff, 0xdb, 0x0d, 0xff, 0xd2, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x8c, 0xff, 0xdb, 0x0f, 0xff, 0xd2, 0x0d, 0xff, 0xf6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbc, 0xff, 0xc9, 0xae, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x2f, 0xff, 0xdc, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe7, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xd2, 0xf3, 0xb1, 0xb5, 0xf7, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcc, 0xb1, 0xb5, 0x0c, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xe3, 0x8f, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xeb, 0x4b, 0xff, 0xe2, 0xa7, 0xff, 0xe2, 0xa7, 0xff, 0xe2, 0xc7, 0xff, 0xe2, 0xc7, 0xff, 0xe2, 0xa7, 0xff, 0xeb, 0x29, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf3, 0xff, 0xda, 0x48, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xe3, 0x0c, 0xff, 0xda, 0x8b, 0xff, 0xda, 0x6b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x2b, 0xff, 0xda, 0xad, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x3a, 0xff, 0xc9, 0xae, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0e, 0xff, 0xe4, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xb9, 0xd3, 0xf4, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcc, 0xb1, 0xb5, 0x0c, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xe3, 0x8f, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xeb, 0x4b, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0x86, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xda, 0x48, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xe2, 0xcb, 0xff, 0xdb, 0x0c, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xdb, 0x6f, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x37, 0xff, 0xc9, 0xee, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0e, 0xff, 0xe4, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe4, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf1, 0xf4, 0xb1, 0xb5, 0xf0, 0xb1, 0xb5, 0xcc, 0xb1, 0xb5, 0x0c, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xe3, 0x8f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xeb, 0x6b, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0x86, 0xff, 0xf6, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe3, 0xce, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xe2, 0xca, 0xff, 0xda, 0xac, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd2, 0x0a, 0xff, 0xed, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x48, 0xff, 0xd3, 0x10, 0xff, 0xc9, 0xee, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0e, 0xff, 0xe4, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe4, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xd2, 0xec, 0xb1, 0xb5, 0xcf, 0xb1, 0xb5, 0x0c, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xfb, 0xda, 0x6a, 0xef, 0xda, 0xa9, 0xf3, 0xec, 0x2e, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xeb, 0x6b, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xa7, 0xff, 0xe2, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xe2, 0x28, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xe2, 0xca, 0xff, 0xda, 0x8b, 0xff, 0xda, 0x2a, 0xff, 0xe4, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7a, 0xff, 0xd1, 0x68, 0xff, 0xda, 0x2a, 0xff, 0xd2, 0xf0, 0xff, 0xca, 0x2f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0e, 0xff, 0xe4, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe4, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xb9, 0xd3, 0xbc, 0xb1, 0xd5, 0x0f, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x4a, 0xe3, 0xe2, 0xe8, 0xef, 0xe3, 0x08, 0xf8, 0xe3, 0x08, 0xff, 0xeb, 0xec, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xeb, 0x6b, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0x65, 0xff, 0xf5, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xe2, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x69, 0xff, 0xda, 0x28, 0xff, 0xec, 0x51, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xda, 0xcd, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd2, 0xaf, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0e, 0xff, 0xe5, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe3, 0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xd2, 0xdb, 0xb9, 0xd4, 0x13, 
-  0xda, 0x4a, 0x28, 0xda, 0x4a, 0xff, 0xda, 0x6a, 0xf8, 0xe2, 0xc9, 0xe8, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xeb, 0xab, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xeb, 0x8c, 0xff, 0xe2, 0xa7, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xa8, 0xff, 0xe2, 0xc8, 0xff, 0xe2, 0xc8, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xec, 0x92, 0xff, 0xe3, 0x2c, 0xff, 0xda, 0x69, 0xff, 0xda, 0x28, 0xff, 0xda, 0x28, 0xff, 0xe2, 0xaa, 0xff, 0xe3, 0xae, 0xff, 0xf5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb7, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd2, 0xb0, 0xff, 0xca, 0x0f, 0xff, 0xca, 0x0e, 0xff, 0xe5, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xe3, 0xc0, 0x0e, 0xe7, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xd2, 0xd0, 0xb9, 0xd2, 0x0f, 
-  0xda, 0x6a, 0x20, 0xe2, 0xc9, 0xf3, 0xe3, 0x08, 0xf7, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xeb, 0x8a, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xec, 0x0e, 0xff, 0xeb, 0x6a, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xeb, 0x29, 0xff, 0xeb, 0x6a, 0xff, 0xeb, 0x6b, 0xff, 0xec, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0xfe, 0xfc, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x39, 0xff, 0xda, 0x2a, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x6c, 0xff, 0xd2, 0x90, 0xff, 0xc9, 0xee, 0xff, 0xe5, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xe3, 0xc0, 0x2c, 0xf4, 0xc1, 0xf1, 0xfc, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcc, 0xc1, 0xf2, 0x0c, 
-  0xe3, 0x08, 0x28, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xeb, 0x48, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xec, 0x2d, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x27, 0xff, 0xec, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbb, 0xff, 0xd1, 0xa9, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0xae, 0xff, 0xca, 0x0f, 0xff, 0xe5, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xdb, 0xc8, 0xec, 0xff, 0xca, 0x10, 0xe3, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcc, 0xc1, 0xf2, 0x0c, 
-  0xe3, 0x08, 0x28, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xea, 0xc4, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xec, 0x4e, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x27, 0xff, 0xeb, 0xec, 0xff, 0xfe, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf5, 0xb6, 0xff, 0xe2, 0xea, 0xff, 0xda, 0xac, 0xff, 0xda, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x2a, 0xff, 0xd2, 0x6e, 0xff, 0xed, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9b, 0xd7, 0xc9, 0x4d, 0xff, 0xca, 0x0e, 0xfb, 0xc1, 0xf1, 0xeb, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcc, 0xc1, 0xf1, 0x0c, 
-  0xe3, 0x08, 0x28, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe2, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x52, 0xff, 0xec, 0x6d, 0xff, 0xec, 0x6d, 0xff, 0xec, 0x6d, 0xff, 0xec, 0x6c, 0xff, 0xec, 0x6c, 0xff, 0xec, 0x6d, 0xff, 0xec, 0x2c, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x49, 0xff, 0xec, 0x4e, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x17, 0xff, 0xe3, 0x0a, 0xff, 0xe2, 0x68, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x89, 0xff, 0xda, 0x8b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd2, 0x0a, 0xff, 0xf5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xb9, 0xdc, 0xc9, 0x8d, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0f, 0xf7, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcc, 0xc1, 0xf1, 0x0c, 
-  0xe3, 0x08, 0x27, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe2, 0x40, 0xff, 0xff, 0xdf, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x73, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xa8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xec, 0x2a, 0xff, 0xec, 0x4c, 0xff, 0xeb, 0x89, 0xff, 0xeb, 0x69, 0xff, 0xe3, 0x27, 0xff, 0xe2, 0x80, 0xff, 0xeb, 0x89, 0xff, 0xf5, 0xb4, 0xff, 0xf6, 0x79, 0xff, 0xfe, 0xba, 0xff, 0xfe, 0xdb, 0xff, 0xf6, 0x59, 0xff, 0xec, 0x71, 0xff, 0xe1, 0x60, 0xff, 0xe1, 0xe5, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0xaa, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd1, 0xc9, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x14, 0xef, 0xc9, 0xee, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xf8, 0xc1, 0xf1, 0xf4, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcc, 0xc1, 0xd2, 0x0c, 
-  0xe3, 0x08, 0x27, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe2, 0xa4, 0xfc, 0xff, 0x3c, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x98, 0xff, 0xeb, 0xa7, 0xff, 0xeb, 0xe9, 0xff, 0xec, 0x2a, 0xff, 0xec, 0x4b, 0xff, 0xec, 0x2a, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xc9, 0xff, 0xec, 0x2b, 0xff, 0xeb, 0x89, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x27, 0xff, 0xe3, 0x07, 0xff, 0xe3, 0x07, 0xff, 0xe3, 0x07, 0xff, 0xe3, 0x4a, 0xff, 0xe2, 0x47, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe3, 0x0b, 0xff, 0xd2, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x8f, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0f, 0xe0, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcc, 0xc1, 0xf1, 0x0c, 
-  0xe3, 0x08, 0x27, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x28, 0xfb, 0xeb, 0xa8, 0xeb, 0xec, 0x48, 0xf3, 0xf5, 0x6f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x48, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x8b, 0xff, 0xec, 0xac, 0xff, 0xec, 0x4b, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xec, 0x0a, 0xff, 0xeb, 0xea, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x4b, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x68, 0xff, 0xe3, 0x2c, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xd1, 0xc9, 0xff, 0xed, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xca, 0x2e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x2e, 0xff, 0xc1, 0xf1, 0xf4, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcb, 0xc1, 0xf2, 0x0c, 
-  0xe3, 0x08, 0x27, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xeb, 0xa8, 0xe7, 0xec, 0x29, 0xf0, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb8, 0xff, 0xeb, 0xc4, 0xff, 0xec, 0x08, 0xff, 0xec, 0x08, 0xff, 0xec, 0x08, 0xff, 0xec, 0x08, 0xff, 0xec, 0x28, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x6a, 0xff, 0xec, 0x4a, 0xff, 0xec, 0x8c, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xea, 0xff, 0xeb, 0xca, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xeb, 0x49, 0xff, 0xe3, 0x4a, 0xff, 0xe2, 0x68, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0xa9, 0xff, 0xda, 0x6b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0xac, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x1a, 0xfb, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0f, 0xe3, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcb, 0xb9, 0xf1, 0x0c, 
-  0xe3, 0x08, 0x27, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xe3, 0x08, 0xff, 0xec, 0x29, 0xe0, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xfe, 0xb8, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x34, 0xff, 0xf5, 0x4d, 0xff, 0xf5, 0x4d, 0xff, 0xf5, 0x4d, 0xff, 0xf5, 0x4e, 0xff, 0xec, 0xcc, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x4a, 0xff, 0xec, 0x4b, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xec, 0x0b, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x6b, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x68, 0xff, 0xe3, 0x4c, 0xff, 0xd2, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x6b, 0xff, 0xf6, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe4, 0xf5, 0xd0, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xfc, 0xc1, 0xf1, 0xef, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcb, 0xc1, 0xd2, 0x0b, 
-  0xe3, 0x08, 0x27, 0xe3, 0x08, 0xff, 0xe3, 0x48, 0xf0, 0xec, 0x29, 0xf4, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xed, 0x0f, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf6, 0x14, 0xff, 0xec, 0xa6, 0xff, 0xec, 0xa8, 0xff, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0xea, 0xff, 0xed, 0x2c, 0xff, 0xec, 0x8a, 0xff, 0xec, 0xab, 0xff, 0xec, 0x29, 0xff, 0xec, 0x29, 0xff, 0xec, 0x49, 0xff, 0xec, 0x6b, 0xff, 0xec, 0x0a, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xea, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x48, 0xff, 0xe3, 0x48, 0xff, 0xeb, 0x69, 0xff, 0xe3, 0x4b, 0xff, 0xe2, 0x68, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x47, 0xff, 0xda, 0xab, 0xff, 0xda, 0xcd, 0xff, 0xf6, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xec, 0xd1, 0x8a, 0xfb, 0xca, 0x0e, 0xec, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xc1, 0xf0, 0xf4, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xc7, 0xc1, 0xd1, 0x0b, 
-  0xe2, 0xe8, 0x23, 0xe3, 0x48, 0xe4, 0xec, 0x49, 0xfc, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x27, 0xff, 0xfe, 0xb7, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xf5, 0xf1, 0xff, 0xec, 0xa7, 0xff, 0xec, 0xa8, 0xff, 0xec, 0xa8, 0xff, 0xec, 0xa9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xed, 0x2c, 0xff, 0xec, 0x4a, 0xff, 0xec, 0x28, 0xff, 0xec, 0x29, 0xff, 0xec, 0x4a, 0xff, 0xec, 0x0a, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xc8, 0xff, 0xec, 0x2b, 0xff, 0xe3, 0x27, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x2b, 0xff, 0xe2, 0x47, 0xff, 0xe2, 0x67, 0xff, 0xe2, 0x47, 0xff, 0xe2, 0x47, 0xff, 0xe1, 0xe5, 0xff, 0xe2, 0xe9, 0xff, 0xf5, 0xd6, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xd2, 0x2c, 0xfc, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xd3, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0f, 0xe7, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xc3, 0xc1, 0xf2, 0x07, 
-  0xec, 0x29, 0x17, 0xec, 0x49, 0xe3, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x69, 0xf8, 0xec, 0xa9, 0xf4, 0xf5, 0x2a, 0xf0, 0xec, 0xe7, 0xff, 0xff, 0x3a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0x96, 0xff, 0xf6, 0x75, 0xff, 0xf6, 0x55, 0xff, 0xf6, 0x35, 0xff, 0xf6, 0x15, 0xff, 0xf6, 0x15, 0xff, 0xf5, 0xf4, 0xff, 0xf6, 0x15, 0xff, 0xf5, 0xd4, 0xff, 0xf5, 0xd4, 0xff, 0xf5, 0xd4, 0xff, 0xf5, 0xd5, 0xff, 0xf5, 0xb4, 0xff, 0xf5, 0xb4, 0xff, 0xf5, 0xb4, 0xff, 0xf5, 0x94, 0xff, 0xf5, 0x95, 0xff, 0xf5, 0xb6, 0xff, 0xf5, 0xf7, 0xff, 0xfe, 0x59, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xdb, 0xf1, 0xfb, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xca, 0x0e, 0xef, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xf7, 0xc1, 0xf1, 0xfc, 0xc1, 0xf2, 0xb4, 0xd0, 0xf3, 0x00, 
-  0xec, 0x49, 0x0f, 0xec, 0x49, 0xd0, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0xa9, 0xf0, 0xed, 0x0a, 0xf7, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xff, 0x19, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe4, 0x31, 0xe7, 0xd2, 0x0b, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2d, 0xf0, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xc1, 0xf0, 0xdc, 0xc1, 0xf2, 0x98, 0xc1, 0xf1, 0x00, 
-  0xfb, 0xc9, 0x00, 0xec, 0x49, 0xb3, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0xc9, 0xe4, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x08, 0xff, 0xf6, 0x52, 0xdb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x1c, 0xe8, 0xda, 0x4a, 0xfc, 0xda, 0x4a, 0xfb, 0xd2, 0x2c, 0xf8, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xf3, 0xca, 0x0e, 0xfb, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xe8, 0xb9, 0xd2, 0x60, 0xc1, 0xf1, 0x00, 
-  0xec, 0x49, 0x00, 0xec, 0x49, 0x6f, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0xe9, 0xeb, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xf5, 0x4a, 0xe8, 0xf5, 0x8a, 0xf7, 0xf5, 0xaa, 0xef, 0xf5, 0xa9, 0xf8, 0xf5, 0xeb, 0xfb, 0xfe, 0xb6, 0xfb, 0xff, 0x5a, 0xeb, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x9d, 0xe8, 0xf6, 0x39, 0xf4, 0xe4, 0x31, 0xeb, 0xd9, 0xa7, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x6a, 0xf8, 0xd2, 0x4c, 0xfb, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xf3, 0xca, 0x0e, 0xfc, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xc1, 0xd0, 0x0c, 0xc9, 0xef, 0x00, 
-  0xec, 0x49, 0x00, 0xfc, 0x43, 0x00, 0xec, 0x49, 0xff, 0xec, 0x49, 0xff, 0xec, 0xe9, 0xdf, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xf5, 0x8a, 0xe7, 0xf5, 0xca, 0xfc, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xe3, 0xf5, 0xca, 0xd4, 0xf5, 0xca, 0xdf, 0xf5, 0xca, 0xe3, 0xf5, 0xca, 0xd7, 0xf6, 0x2e, 0xdb, 0xfe, 0xd4, 0xdc, 0xff, 0x38, 0xd3, 0xff, 0x7a, 0xd0, 0xff, 0x9b, 0xd3, 0xff, 0x9c, 0xd0, 0xff, 0x9d, 0xd8, 0xff, 0x9d, 0xd8, 0xff, 0xbd, 0xd8, 0xff, 0x9d, 0xdc, 0xff, 0xbe, 0xd4, 0xff, 0xbd, 0xd4, 0xff, 0xbd, 0xd3, 0xff, 0xbd, 0xd3, 0xff, 0x7d, 0xdc, 0xff, 0x9d, 0xdb, 0xff, 0x9d, 0xd8, 0xff, 0x9d, 0xd7, 0xff, 0x7d, 0xd8, 0xff, 0x3b, 0xd8, 0xfe, 0xda, 0xd8, 0xfe, 0x99, 0xd8, 0xfe, 0x38, 0xd4, 0xf5, 0x54, 0xdc, 0xeb, 0xcd, 0xfb, 0xe2, 0xc9, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x89, 0xef, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x4b, 0xef, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xca, 0x2d, 0xf0, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xaf, 0xca, 0x0e, 0x00, 0x00, 0x00, 0x00, 
-  0xec, 0x49, 0x00, 0xec, 0x49, 0x00, 0xec, 0x49, 0x6c, 0xec, 0xa9, 0xf7, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xf5, 0x4a, 0xf8, 0xf5, 0xaa, 0xe0, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xef, 0xf5, 0xca, 0xef, 0xf5, 0xea, 0xf3, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xf7, 0xf5, 0xca, 0xf4, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xff, 0xf5, 0xc9, 0xff, 0xf5, 0xa9, 0xe4, 0xf5, 0xa8, 0xf7, 0xf5, 0xa8, 0xfb, 0xed, 0x67, 0xeb, 0xed, 0x26, 0xf0, 0xed, 0x27, 0xff, 0xed, 0x27, 0xff, 0xed, 0x06, 0xe7, 0xec, 0x85, 0xfc, 0xec, 0x85, 0xff, 0xec, 0x85, 0xff, 0xec, 0x85, 0xf3, 0xe3, 0xa4, 0xf3, 0xeb, 0x84, 0xff, 0xeb, 0x84, 0xff, 0xeb, 0xa4, 0xff, 0xe2, 0xe2, 0xe4, 0xe2, 0xc4, 0xff, 0xe2, 0xc5, 0xff, 0xe2, 0xc5, 0xff, 0xe2, 0x85, 0xf0, 0xe2, 0x46, 0xff, 0xe2, 0x67, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x87, 0xec, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xe0, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xd3, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0x1c, 0xca, 0x0e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xec, 0x28, 0x00, 0xec, 0xc9, 0x08, 0xed, 0x2a, 0xdc, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x2a, 0xff, 0xed, 0x4a, 0xf0, 0xf5, 0xca, 0xf7, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xe8, 0xf5, 0xca, 0xfb, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xe8, 0xf6, 0x2b, 0xdf, 0xf6, 0x4b, 0xff, 0xf6, 0x4b, 0xfc, 0xf6, 0x4b, 0xfb, 0xf6, 0x4b, 0xff, 0xf6, 0x2b, 0xe8, 0xf5, 0xea, 0xd0, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xf8, 0xf5, 0xca, 0xe7, 0xf5, 0xca, 0xf8, 0xf5, 0x4a, 0xdb, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xff, 0xed, 0x2a, 0xf4, 0xec, 0xc9, 0xfc, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0xa9, 0xf0, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xfc, 0xe3, 0x28, 0xf0, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xe3, 0xe2, 0x88, 0xfc, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x87, 0xff, 0xda, 0x69, 0xf3, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xd2, 0x2b, 0xef, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xf8, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0x8c, 0xca, 0x2e, 0x00, 0xca, 0x0e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x2b, 0x00, 0xed, 0x2a, 0x50, 0xed, 0x2a, 0xfc, 0xed, 0x2a, 0xff, 0xf5, 0x4a, 0xf8, 0xf5, 0xca, 0xf0, 0xf5, 0xca, 0xfc, 0xf5, 0xca, 0xd8, 0xf5, 0xca, 0xff, 0xf5, 0xea, 0xfb, 0xf6, 0x2a, 0xdf, 0xf6, 0x6b, 0xfc, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x4b, 0xf4, 0xf5, 0xea, 0xe8, 0xf5, 0xca, 0xfc, 0xf5, 0xca, 0xf4, 0xf5, 0xca, 0xf0, 0xf5, 0xaa, 0xfc, 0xf5, 0x4a, 0xeb, 0xf5, 0x4a, 0xff, 0xf5, 0x6a, 0xf8, 0xec, 0xe9, 0xf4, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xfc, 0xec, 0x49, 0xeb, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xec, 0x09, 0xff, 0xeb, 0x88, 0xe4, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x48, 0xf4, 0xe2, 0xa8, 0xf7, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xdc, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x4b, 0xcf, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xca, 0x2e, 0xe8, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xdf, 0xca, 0x0e, 0x0c, 0xca, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x29, 0x00, 0xf5, 0x09, 0x00, 0xed, 0x2a, 0x5c, 0xed, 0x2a, 0xff, 0xf5, 0xaa, 0xf0, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xec, 0xf5, 0xca, 0xff, 0xf5, 0xeb, 0xef, 0xf6, 0x4b, 0xf4, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xfc, 0xf6, 0x2b, 0xf4, 0xf5, 0xca, 0xf4, 0xf5, 0xca, 0xf8, 0xf5, 0xca, 0xe8, 0xf5, 0xaa, 0xe8, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xf4, 0xec, 0xc9, 0xf8, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0x89, 0xe7, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xc8, 0xf8, 0xe3, 0x28, 0xf4, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x08, 0xcc, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xfb, 0xda, 0x6a, 0xfb, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x4a, 0xf3, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2d, 0xdc, 0xca, 0x0e, 0xdb, 0xca, 0x0e, 0x1c, 0xca, 0x0e, 0x00, 0xca, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x2a, 0x00, 0xf5, 0x4a, 0x00, 0xf5, 0xaa, 0x57, 0xf5, 0xca, 0xf7, 0xf5, 0xca, 0xe7, 0xf5, 0xca, 0xff, 0xf5, 0xea, 0xe4, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x4b, 0xf0, 0xf5, 0xca, 0xf8, 0xf5, 0xca, 0xfb, 0xf5, 0xca, 0xf4, 0xf5, 0x6a, 0xd3, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xff, 0xf5, 0x2a, 0xe4, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xf7, 0xec, 0x09, 0xfc, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xf8, 0xe3, 0x48, 0xf7, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xf0, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xda, 0x69, 0xe8, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xd2, 0x4c, 0xfb, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xcb, 0xca, 0x0f, 0x1b, 0xa2, 0x91, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x6a, 0x00, 0xf5, 0xaa, 0x00, 0xf5, 0xaa, 0x2f, 0xf5, 0xca, 0xb0, 0xf5, 0xea, 0xf7, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x0b, 0xe3, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xef, 0xf5, 0xca, 0xff, 0xf5, 0x6a, 0xe0, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xf8, 0xec, 0xc9, 0xf7, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0x69, 0xdb, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xe3, 0x88, 0xec, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe2, 0xa8, 0xeb, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x69, 0xe8, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xfb, 0xd2, 0x4b, 0xec, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xfb, 0xd2, 0x2c, 0x7f, 0xda, 0x8c, 0x08, 0xca, 0x2e, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xc0, 0x00, 0xf5, 0xca, 0x00, 0xf5, 0xea, 0x03, 0xf6, 0x4b, 0x38, 0xf6, 0x6b, 0xcf, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf6, 0x6b, 0xff, 0xf5, 0xca, 0xd4, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xef, 0xf5, 0x8a, 0xf4, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xfc, 0xec, 0xe9, 0xfc, 0xec, 0xc9, 0xff, 0xec, 0xc9, 0xff, 0xec, 0xa9, 0xf4, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xa8, 0xd8, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x28, 0xff, 0xe2, 0xe8, 0xdb, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x89, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xff, 0xda, 0x6a, 0xfc, 0xd2, 0x4b, 0xe4, 0xd2, 0x2c, 0x8b, 0xd2, 0x4b, 0x10, 0xd9, 0xcb, 0x00, 0xd2, 0x2c, 0x00, 0xc2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x0b, 0x00, 0xf6, 0x6b, 0x00, 0xf6, 0x6b, 0x00, 0xfe, 0x6b, 0x10, 0xf6, 0x6b, 0x50, 0xf6, 0x6b, 0x8c, 0xf6, 0x6b, 0xa8, 0xf6, 0x6b, 0xb3, 0xf6, 0x6b, 0xbc, 0xf6, 0x6b, 0xbf, 0xf6, 0x6b, 0xbf, 0xf6, 0x6b, 0xc0, 0xf6, 0x6b, 0xc0, 0xf6, 0x6b, 0xc0, 0xf6, 0x6b, 0xc3, 0xf6, 0x6b, 0xc3, 0xf6, 0x6b, 0xc3, 0xf6, 0x6b, 0xc3, 0xf6, 0x6b, 0xc4, 0xf6, 0x4b, 0xbf, 0xf5, 0xca, 0xc3, 0xf5, 0xca, 0xa4, 0xf5, 0xaa, 0xb3, 0xf5, 0x4a, 0xbf, 0xf5, 0x4a, 0xc3, 0xed, 0x0a, 0xb4, 0xec, 0xc9, 0xc7, 0xec, 0xc9, 0xc4, 0xec, 0xc9, 0xc4, 0xec, 0x29, 0xb7, 0xeb, 0xe9, 0xc4, 0xeb, 0xe9, 0xc4, 0xeb, 0xe9, 0xbc, 0xe3, 0x28, 0xc4, 0xe3, 0x28, 0xc4, 0xe3, 0x28, 0xc4, 0xe3, 0x08, 0xb8, 0xe2, 0x88, 0xc4, 0xe2, 0x88, 0xc4, 0xe2, 0x88, 0xc3, 0xe2, 0x88, 0xc3, 0xe2, 0x89, 0xbc, 0xda, 0x6a, 0xb0, 0xda, 0x6a, 0xa4, 0xda, 0x6a, 0x78, 0xda, 0x6a, 0x43, 0xfc, 0x00, 0x00, 0xd2, 0x2c, 0x00, 0xd2, 0x6b, 0x00, 0xd2, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x6b, 0x00, 0xf6, 0x6b, 0x00, 0xf6, 0x6b, 0x00, 0xf6, 0x4b, 0x00, 0xf8, 0x17, 0x00, 0xf6, 0x6b, 0x04, 0xf6, 0x8a, 0x07, 0xf6, 0x4b, 0x07, 0xf6, 0x6a, 0x07, 0xf6, 0x6b, 0x07, 0xf6, 0x6a, 0x07, 0xf6, 0x4b, 0x07, 0xf6, 0x6b, 0x07, 0xfe, 0x8b, 0x08, 0xf6, 0x4b, 0x08, 0xf6, 0x6b, 0x08, 0xf6, 0x6b, 0x08, 0xf6, 0x0b, 0x07, 0xed, 0xea, 0x08, 0xf5, 0xca, 0x07, 0xed, 0x6a, 0x07, 0xed, 0x6a, 0x07, 0xf5, 0x49, 0x08, 0xec, 0xc9, 0x08, 0xec, 0xc9, 0x08, 0xec, 0xc9, 0x08, 0xec, 0x49, 0x08, 0xeb, 0xe8, 0x08, 0xec, 0x09, 0x08, 0xec, 0x29, 0x08, 0xe3, 0x88, 0x08, 0xe3, 0x28, 0x08, 0xeb, 0x28, 0x08, 0xeb, 0x48, 0x08, 0xe3, 0x08, 0x08, 0xe2, 0xc8, 0x08, 0xe3, 0x08, 0x08, 0xeb, 0x08, 0x07, 0xea, 0xc8, 0x04, 0xe0, 0xe9, 0x00, 0xda, 0x6a, 0x00, 0xda, 0x6a, 0x00, 0xda, 0x6a, 0x00, 0xda, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8a, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x59, 0x0c, 0x4b, 0x39, 0x17, 0x4b, 0x39, 0x1f, 0x4b, 0x39, 0x24, 0x52, 0xb9, 0x27, 0x52, 0xb9, 0x28, 0x52, 0xba, 0x2b, 0x5a, 0xba, 
+  0x2b, 0x82, 0x52, 0xb9, 0x2c, 0x00, 0x5a, 0xb9, 0x2f, 0x81, 0x52, 0xb9, 0x2f, 0x02, 0x52, 0x9a, 0x2f, 0x5a, 0xb9, 0x30, 0x5a, 0xb9, 0x2b, 0x86, 0x6a, 0x18, 0x34, 0x01, 0x6a, 0x38, 0x34, 0x6a, 
+  0x19, 0x2f, 0x81, 0x71, 0xf9, 0x2f, 0x81, 0x71, 0xf9, 0x2c, 0x82, 0x71, 0xd9, 0x2b, 0x00, 0x79, 0xd9, 0x2c, 0x81, 0x79, 0xb9, 0x2b, 0x05, 0x79, 0xb9, 0x27, 0x79, 0xb9, 0x24, 0x79, 0xb9, 0x23, 
+  0x79, 0xb9, 0x1c, 0x79, 0xb9, 0x14, 0x71, 0xd9, 0x04, 0x93, 0x00, 0x00, 0x00, 0x05, 0x4b, 0x39, 0x4f, 0x4b, 0x39, 0x9f, 0x4b, 0x39, 0xcf, 0x4b, 0x39, 0xe3, 0x4b, 0x39, 0xf7, 0x53, 0x19, 0xeb, 
+  0x8b, 0x52, 0xb9, 0xff, 0x00, 0x62, 0x79, 0xf0, 0x86, 0x6a, 0x38, 0xff, 0x00, 0x6a, 0x19, 0xe4, 0x85, 0x71, 0xf9, 0xff, 0x01, 0x71, 0xd9, 0xec, 0x79, 0xd9, 0xff, 0x84, 0x79, 0xb9, 0xff, 0x05, 
+  0x79, 0xb9, 0xfc, 0x79, 0xb9, 0xf0, 0x79, 0xb9, 0xdc, 0x79, 0xb9, 0xbc, 0x79, 0xb9, 0x78, 0x71, 0xb9, 0x24, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x39, 0x37, 0x4b, 0x39, 0xe7, 0x83, 0x4b, 0x39, 
+  0xff, 0x00, 0x53, 0x19, 0xd4, 0x8a, 0x52, 0xb9, 0xff, 0x01, 0x52, 0xb9, 0xf7, 0x62, 0x59, 0xe3, 0x85, 0x6a, 0x38, 0xff, 0x01, 0x6a, 0x38, 0xfb, 0x69, 0xf9, 0xd8, 0x84, 0x71, 0xf9, 0xff, 0x01, 
+  0x71, 0xf9, 0xfc, 0x71, 0xd9, 0xef, 0x8a, 0x79, 0xb9, 0xff, 0x03, 0x79, 0xb9, 0xfc, 0x89, 0x98, 0xd4, 0x99, 0x98, 0xa7, 0xa1, 0x78, 0x0f, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x39, 0x10, 0x4b, 
+  0x39, 0xaf, 0x83, 0x4b, 0x39, 0xff, 0x02, 0x4b, 0x39, 0xf0, 0x52, 0xf9, 0xef, 0x52, 0xb9, 0xfb, 0x88, 0x52, 0xb9, 0xff, 0x02, 0x52, 0xb9, 0xfb, 0x5a, 0x99, 0xeb, 0x6a, 0x38, 0xf7, 0x84, 0x6a, 
+  0x38, 0xff, 0x02, 0x6a, 0x38, 0xfc, 0x6a, 0x19, 0xec, 0x71, 0xf9, 0xe3, 0x83, 0x71, 0xf9, 0xff, 0x02, 0x71, 0xf9, 0xfb, 0x71, 0xd9, 0xf4, 0x79, 0xd9, 0xf3, 0x89, 0x79, 0xb9, 0xff, 0x02, 0x79, 
+  0xb9, 0xeb, 0x89, 0xb8, 0xec, 0x91, 0x98, 0xec, 0x81, 0x99, 0x98, 0xff, 0x01, 0x99, 0x98, 0xef, 0x99, 0x98, 0x58, 0x89, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x18, 0x0b, 0x4b, 0x39, 0xe0, 0x83, 0x4b, 
+  0x39, 0xff, 0x01, 0x4b, 0x39, 0xe3, 0x52, 0xb9, 0xf8, 0x89, 0x52, 0xb9, 0xff, 0x01, 0x52, 0xb9, 0xe7, 0x62, 0x59, 0xf8, 0x85, 0x6a, 0x38, 0xff, 0x01, 0x6a, 0x18, 0xf3, 0x71, 0xf9, 0xd3, 0x84, 
+  0x71, 0xf9, 0xff, 0x01, 0x71, 0xf9, 0xe4, 0x79, 0xd9, 0xf8, 0x8a, 0x79, 0xb9, 0xff, 0x02, 0x81, 0xb9, 0xd8, 0x91, 0x98, 0xf3, 0x99, 0x98, 0xfc, 0x84, 0x99, 0x98, 0xff, 0x00, 0x99, 0x98, 0x7f, 
+  0x87, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x39, 0x0f, 0x4b, 0x39, 0xe8, 0x81, 0x4b, 0x39, 0xff, 0x02, 0x4b, 0x39, 0xfb, 0x4b, 0x19, 0xf8, 0x52, 0xf9, 0xdc, 0x88, 0x52, 0xb9, 0xff, 0x03, 0x52, 0xb9, 
+  0xfc, 0x5a, 0x99, 0xfb, 0x62, 0x79, 0xdf, 0x6a, 0x18, 0xff, 0x84, 0x6a, 0x38, 0xff, 0x02, 0x6a, 0x19, 0xef, 0x6a, 0x19, 0xe7, 0x71, 0xf9, 0xf8, 0x82, 0x71, 0xf9, 0xff, 0x02, 0x71, 0xf9, 0xfb, 
+  0x71, 0xd9, 0xf8, 0x71, 0xd9, 0xec, 0x89, 0x79, 0xb9, 0xff, 0x03, 0x79, 0xb9, 0xf7, 0x81, 0xb9, 0xec, 0x91, 0x98, 0xdf, 0x99, 0x97, 0xff, 0x87, 0x99, 0x98, 0xff, 0x00, 0x99, 0x98, 0x6b, 0x86, 
+  0x00, 0x00, 0x00, 0x05, 0x4b, 0x39, 0xa3, 0x4b, 0x39, 0xff, 0x4b, 0x39, 0xf8, 0x4b, 0x19, 0xd7, 0x52, 0xd9, 0xfc, 0x52, 0xb9, 0xfb, 0x88, 0x52, 0xb9, 0xff, 0x02, 0x5a, 0xb9, 0xdc, 0x62, 0x59, 
+  0xfc, 0x6a, 0x38, 0xfb, 0x84, 0x6a, 0x38, 0xff, 0x02, 0x6a, 0x39, 0xef, 0x69, 0xf9, 0xeb, 0x71, 0xf9, 0xf3, 0x83, 0x71, 0xf9, 0xff, 0x02, 0x71, 0xf9, 0xe7, 0x79, 0xd9, 0xf7, 0x79, 0xb9, 0xfb, 
+  0x89, 0x79, 0xb9, 0xff, 0x02, 0x81, 0xb9, 0xdb, 0x91, 0x98, 0xf8, 0x99, 0x98, 0xf8, 0x89, 0x99, 0x98, 0xff, 0x01, 0x99, 0x98, 0xfc, 0x99, 0x98, 0x4c, 0x84, 0x00, 0x00, 0x00, 0x03, 0x4b, 0x39, 
+  0x43, 0x4b, 0x39, 0xff, 0x53, 0x19, 0xd0, 0x52, 0xb9, 0xf3, 0x87, 0x52, 0xb9, 0xff, 0x04, 0x52, 0xb9, 0xfc, 0x52, 0xb9, 0xff, 0x5a, 0x99, 0xe3, 0x62, 0x39, 0xf0, 0x6a, 0x18, 0xff, 0x81, 0x6a, 
+  0x38, 0xff, 0x82, 0x6a, 0x18, 0xff, 0x01, 0x6a, 0x18, 0xf8, 0x69, 0xf9, 0xd8, 0x83, 0x71, 0xd9, 0xff, 0x02, 0x71, 0xd9, 0xfc, 0x71, 0xd9, 0xf8, 0x71, 0xb9, 0xf0, 0x89, 0x79, 0xb9, 0xff, 0x02, 
+  0x79, 0xb9, 0xfb, 0x79, 0xb9, 0xeb, 0x91, 0x98, 0xe3, 0x8d, 0x99, 0x98, 0xff, 0x01, 0x99, 0x98, 0xd3, 0x99, 0x98, 0x07, 0x83, 0x00, 0x00, 0x00, 0x01, 0x52, 0xd9, 0xdf, 0x52, 0xb9, 0xf8, 0x87, 
+  0x52, 0xb9, 0xff, 0x03, 0x52, 0xb9, 0xf0, 0x5a, 0x99, 0xec, 0x62, 0x59, 0xf4, 0x6a, 0x39, 0xf7, 0x81, 0x6a, 0x18, 0xff, 0x07, 0x61, 0x98, 0xff, 0x50, 0x98, 0xff, 0x58, 0x78, 0xff, 0x69, 0xd9, 
+  0xf7, 0x72, 0x79, 0xef, 0x69, 0x59, 0xd8, 0x79, 0xfa, 0xd0, 0x79, 0xba, 0xe0, 0x81, 0x71, 0x99, 0xe3, 0x03, 0x79, 0xba, 0xe3, 0x9b, 0x7b, 0xdb, 0xa3, 0xdb, 0xd0, 0xa3, 0xdb, 0xdf, 0x81, 0xa3, 
+  0xdb, 0xe0, 0x0b, 0xa3, 0xbb, 0xe3, 0xa3, 0x9b, 0xe3, 0x9b, 0x9b, 0xe3, 0x9b, 0x7b, 0xe4, 0x9b, 0x5a, 0xe7, 0x9b, 0x1a, 0xe8, 0x92, 0xba, 0xec, 0x8a, 0x5a, 0xdf, 0x88, 0x99, 0xf0, 0x88, 0x17, 
+  0xec, 0x90, 0x17, 0xff, 0x91, 0x17, 0xff, 0x8e, 0x99, 0x98, 0xff, 0x00, 0x91, 0x98, 0x57, 0x82, 0x00, 0x00, 0x00, 0x00, 0x52, 0xb9, 0x44, 0x87, 0x52, 0xb9, 0xff, 0x02, 0x52, 0x99, 0xe3, 0x62, 
+  0x79, 0xe4, 0x6a, 0x19, 0xff, 0x83, 0x6a, 0x38, 0xff, 0x03, 0x7a, 0xf9, 0xf4, 0xcd, 0xfd, 0xcf, 0xff, 0xbf, 0xdb, 0xff, 0xff, 0xfb, 0x95, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf4, 0xf6, 0xfe, 
+  0xd7, 0xcc, 0x7b, 0xe0, 0x8d, 0x99, 0x98, 0xff, 0x01, 0x99, 0x97, 0xe0, 0xb1, 0xb6, 0xe0, 0x82, 0x00, 0x00, 0x00, 0x00, 0x52, 0xb9, 0xa3, 0x82, 0x52, 0xb9, 0xff, 0x04, 0x52, 0xb9, 0xfb, 0x52, 
+  0xb9, 0xeb, 0x5a, 0x79, 0xfb, 0x62, 0x59, 0xe4, 0x6a, 0x39, 0xf0, 0x81, 0x6a, 0x18, 0xff, 0x05, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xff, 0x61, 0xb8, 0xfb, 0xb5, 0x3c, 0xf0, 0xf7, 0x5f, 0xdf, 0xff, 
+  0xff, 0xfc, 0x9b, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xef, 0xe6, 0x5d, 0xec, 0xb3, 0xd9, 0xf4, 0x90, 0x77, 0xff, 0x86, 0x99, 0x98, 0xff, 0x02, 0x99, 0x97, 0xef, 0xa1, 0x97, 0xf0, 0xa9, 0xb6, 
+  0xe4, 0x81, 0xb1, 0xb5, 0xff, 0x08, 0xb1, 0xb5, 0x33, 0x00, 0x00, 0x00, 0x52, 0xb9, 0x0b, 0x52, 0xb9, 0xcc, 0x52, 0xb9, 0xff, 0x52, 0xb9, 0xe7, 0x5a, 0x79, 0xdf, 0x62, 0x38, 0xff, 0x6a, 0x38, 
+  0xfb, 0x84, 0x6a, 0x38, 0xff, 0x03, 0x6a, 0x18, 0xff, 0x69, 0xf9, 0xe8, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xfc, 0xa0, 0xff, 0xff, 0xff, 0x01, 0xe6, 0x1d, 0xdb, 0x90, 0x17, 0xff, 0x83, 0x99, 0x98, 
+  0xff, 0x02, 0x99, 0x97, 0xe0, 0xa9, 0xb6, 0xf4, 0xb1, 0xb5, 0xfb, 0x83, 0xb1, 0xb5, 0xff, 0x04, 0xb1, 0xb5, 0x78, 0x00, 0x00, 0x00, 0x62, 0x79, 0x17, 0x62, 0x79, 0xc8, 0x6a, 0x39, 0xf8, 0x81, 
+  0x6a, 0x18, 0xff, 0x85, 0x6a, 0x38, 0xff, 0x02, 0x6a, 0x18, 0xff, 0x8b, 0x9a, 0xec, 0xff, 0xdf, 0xf4, 0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0xbf, 0xff, 0x81, 0xff, 0x9f, 0xff, 0x8e, 0xf7, 0x7f, 
+  0xff, 0x00, 0xff, 0x7f, 0xff, 0x81, 0xff, 0x9f, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x04, 0xee, 0xbe, 0xe4, 0x99, 0xd8, 0xfc, 0x99, 0x97, 0xf4, 0xa1, 0x97, 0xef, 0xa9, 0xb6, 
+  0xe3, 0x86, 0xb1, 0xb5, 0xff, 0x03, 0xb1, 0xb5, 0xa7, 0x00, 0x00, 0x00, 0x6a, 0x39, 0x1f, 0x6a, 0x38, 0xf4, 0x85, 0x6a, 0x38, 0xff, 0x04, 0x6a, 0x39, 0xff, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xe7, 
+  0x79, 0xf8, 0xd7, 0xff, 0xdf, 0xf4, 0x84, 0xff, 0xff, 0xff, 0x0c, 0xe6, 0x5d, 0xff, 0xbc, 0xfb, 0xff, 0xac, 0x59, 0xff, 0xa3, 0xb9, 0xff, 0x9b, 0x18, 0xff, 0x92, 0xd8, 0xff, 0x92, 0xb8, 0xff, 
+  0x92, 0xd8, 0xff, 0xa3, 0x39, 0xff, 0xa2, 0xb8, 0xff, 0x9a, 0x57, 0xff, 0xa2, 0x77, 0xff, 0xa2, 0x57, 0xff, 0x82, 0xa2, 0x37, 0xff, 0x82, 0x9a, 0x37, 0xff, 0x01, 0x9a, 0x57, 0xff, 0xaa, 0xb8, 
+  0xff, 0x81, 0xb3, 0x39, 0xff, 0x04, 0xb3, 0x38, 0xff, 0xbb, 0xd9, 0xff, 0xc4, 0x99, 0xff, 0xd5, 0x5b, 0xff, 0xff, 0x5f, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xee, 0xde, 0xdf, 0xa8, 0x15, 0xf7, 
+  0x88, 0xb1, 0xb5, 0xff, 0x03, 0xb1, 0xb5, 0xb8, 0xa9, 0xd5, 0x03, 0x6a, 0x38, 0x23, 0x6a, 0x38, 0xfb, 0x82, 0x6a, 0x38, 0xff, 0x06, 0x6a, 0x38, 0xfb, 0x6a, 0x38, 0xff, 0x72, 0x18, 0xec, 0x79, 
+  0xf7, 0xd7, 0x79, 0xf7, 0xfc, 0x79, 0x57, 0xff, 0xff, 0x9f, 0xeb, 0x83, 0xff, 0xff, 0xff, 0x08, 0xf7, 0x5f, 0xff, 0x92, 0x78, 0xff, 0x79, 0x56, 0xff, 0x81, 0xd7, 0xff, 0x81, 0xf7, 0xff, 0x81, 
+  0xd7, 0xff, 0x8a, 0x17, 0xff, 0x9a, 0xd8, 0xff, 0x9a, 0x57, 0xff, 0x82, 0x91, 0x96, 0xff, 0x00, 0x91, 0xb6, 0xff, 0x81, 0x91, 0xb7, 0xff, 0x81, 0x99, 0xd7, 0xff, 0x03, 0x99, 0xb6, 0xff, 0xa2, 
+  0x17, 0xff, 0xb2, 0xd8, 0xff, 0xb2, 0x98, 0xff, 0x81, 0xa1, 0x96, 0xff, 0x81, 0xa1, 0x76, 0xff, 0x82, 0xa1, 0x96, 0xff, 0x02, 0xa1, 0x56, 0xff, 0xa0, 0x56, 0xff, 0xd5, 0x1b, 0xff, 0x84, 0xff, 
+  0xff, 0xff, 0x01, 0xdc, 0xba, 0xe0, 0xb1, 0x55, 0xff, 0x87, 0xb1, 0xb5, 0xff, 0x08, 0xb1, 0xb5, 0xc3, 0xb1, 0xd5, 0x08, 0x6a, 0x18, 0x24, 0x6a, 0x38, 0xff, 0x6a, 0x18, 0xe7, 0x72, 0x18, 0xeb, 
+  0x71, 0xf8, 0xfb, 0x79, 0xf7, 0xe8, 0x79, 0xf7, 0xf7, 0x82, 0x79, 0xf7, 0xff, 0x01, 0xbd, 0x1b, 0xf0, 0xff, 0xff, 0xfc, 0x82, 0xff, 0xff, 0xff, 0x08, 0xde, 0x3d, 0xff, 0x81, 0x17, 0xff, 0x92, 
+  0x78, 0xff, 0x92, 0x37, 0xff, 0x89, 0xb7, 0xff, 0x9a, 0x37, 0xff, 0x99, 0xf7, 0xff, 0x91, 0x96, 0xff, 0x99, 0xd7, 0xff, 0x81, 0xa2, 0x57, 0xff, 0x04, 0x9a, 0x16, 0xff, 0x99, 0xb6, 0xff, 0x99, 
+  0xd6, 0xff, 0xa2, 0x16, 0xff, 0xa2, 0x36, 0xff, 0x81, 0xa2, 0x56, 0xff, 0x03, 0xa1, 0xb6, 0xff, 0xa2, 0x16, 0xff, 0xaa, 0x37, 0xff, 0xaa, 0x17, 0xff, 0x83, 0xaa, 0x37, 0xff, 0x01, 0xaa, 0x17, 
+  0xff, 0xa9, 0xf6, 0xff, 0x82, 0xa9, 0xd6, 0xff, 0x02, 0xa0, 0x96, 0xff, 0xcc, 0x3a, 0xff, 0xff, 0x7f, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xfb, 0xba, 0x56, 0xf3, 0x87, 0xb1, 0xb5, 
+  0xff, 0x02, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x08, 0x79, 0xf7, 0x24, 0x88, 0x79, 0xf7, 0xff, 0x00, 0xf7, 0x3f, 0xdc, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7f, 0xff, 0x9a, 0x38, 0xff, 0x82, 0x91, 
+  0xb6, 0xff, 0x04, 0xa2, 0x78, 0xff, 0xaa, 0xd8, 0xff, 0xa2, 0x77, 0xff, 0x99, 0xd5, 0xff, 0x99, 0xb5, 0xff, 0x81, 0x99, 0xd5, 0xff, 0x86, 0x99, 0xb5, 0xff, 0x01, 0xb2, 0x96, 0xff, 0xba, 0xb7, 
+  0xff, 0x86, 0xb1, 0xb5, 0xff, 0x03, 0xb1, 0x75, 0xff, 0xb2, 0x16, 0xff, 0xba, 0x16, 0xff, 0xa9, 0x55, 0xff, 0x81, 0xb1, 0xb5, 0xff, 0x00, 0xcc, 0x79, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 
+  0xff, 0xfc, 0xdd, 0x7a, 0xf8, 0x87, 0xb1, 0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x08, 0x79, 0xf7, 0x27, 0x83, 0x79, 0xf7, 0xff, 0x04, 0x79, 0xf7, 0xf0, 0x81, 0xf7, 0xec, 0x81, 0xd7, 
+  0xfc, 0x81, 0xd6, 0xe7, 0x9a, 0x97, 0xd7, 0x83, 0xff, 0xff, 0xff, 0x04, 0xaa, 0xb8, 0xff, 0x99, 0x96, 0xff, 0xa2, 0x77, 0xff, 0xa2, 0x56, 0xff, 0x99, 0xd5, 0xff, 0x83, 0x99, 0xb4, 0xff, 0x81, 
+  0x99, 0xb5, 0xff, 0x00, 0xa1, 0xf5, 0xff, 0x81, 0xaa, 0x55, 0xff, 0x03, 0xaa, 0x35, 0xff, 0xa9, 0xd4, 0xff, 0xb2, 0x55, 0xff, 0xba, 0x95, 0xff, 0x81, 0xba, 0x55, 0xff, 0x82, 0xba, 0x75, 0xff, 
+  0x81, 0xba, 0x55, 0xff, 0x03, 0xba, 0x35, 0xff, 0xb1, 0xd5, 0xff, 0xba, 0xd6, 0xff, 0xf6, 0xde, 0xff, 0x81, 0xff, 0xff, 0xff, 0x04, 0xf7, 0x3e, 0xff, 0xba, 0xf6, 0xff, 0xb1, 0xb5, 0xff, 0xa8, 
+  0x15, 0xff, 0xee, 0xbd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xfe, 0xe7, 0x87, 0xb1, 0xb5, 0xff, 0x0b, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x0b, 0x79, 0xf7, 0x27, 0x79, 0xf7, 0xff, 0x79, 0xf7, 
+  0xeb, 0x81, 0xd7, 0xd3, 0x89, 0xd6, 0xf7, 0x91, 0xd6, 0xfb, 0x91, 0xd5, 0xf8, 0x91, 0xd5, 0xff, 0x89, 0x35, 0xff, 0xd5, 0x7b, 0xd0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xee, 0x9d, 0xff, 0x99, 0x14, 
+  0xff, 0x82, 0x99, 0xb5, 0xff, 0x00, 0x99, 0xb4, 0xff, 0x81, 0x99, 0xb5, 0xff, 0x04, 0xa2, 0x15, 0xff, 0xb2, 0xd6, 0xff, 0xba, 0xb6, 0xff, 0xb2, 0x14, 0xff, 0xb1, 0xd4, 0xff, 0x81, 0xb1, 0xf4, 
+  0xff, 0x00, 0xb1, 0xd4, 0xff, 0x81, 0xb1, 0xb3, 0xff, 0x81, 0xb1, 0x93, 0xff, 0x86, 0xb1, 0xb3, 0xff, 0x01, 0xb1, 0x93, 0xff, 0xe5, 0xfb, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xe5, 0xdc, 0xff, 
+  0xb1, 0x95, 0xff, 0xb1, 0x75, 0xff, 0xc2, 0xb7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf3, 0x87, 0xb1, 0xb5, 0xff, 0x03, 0xb1, 0xb5, 0xc7, 0xb1, 0xb5, 0x0b, 0x89, 0xd6, 0x20, 0x89, 
+  0xd6, 0xf3, 0x85, 0x91, 0xd5, 0xff, 0x01, 0x88, 0x15, 0xff, 0xff, 0x7f, 0xd8, 0x82, 0xff, 0xff, 0xff, 0x02, 0xcd, 0x1a, 0xff, 0x99, 0xd5, 0xff, 0xa2, 0x15, 0xff, 0x81, 0xa1, 0xf4, 0xff, 0x13, 
+  0xb2, 0xd5, 0xff, 0xba, 0xd5, 0xff, 0xb2, 0x53, 0xff, 0xb1, 0xf3, 0xff, 0xa9, 0xd2, 0xff, 0xa9, 0xb2, 0xff, 0xa9, 0xd2, 0xff, 0xb1, 0xf3, 0xff, 0xb2, 0x33, 0xff, 0xb2, 0x54, 0xff, 0xb2, 0x34, 
+  0xff, 0xba, 0xf5, 0xff, 0xc3, 0xb6, 0xff, 0xcb, 0xf7, 0xff, 0xcb, 0xd7, 0xff, 0xc3, 0x96, 0xff, 0xba, 0x14, 0xff, 0xb1, 0x73, 0xff, 0xba, 0x13, 0xff, 0xba, 0x54, 0xff, 0x81, 0xba, 0x74, 0xff, 
+  0x01, 0xba, 0x94, 0xff, 0xf6, 0xbd, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xfe, 0xff, 0x81, 0xb1, 0x95, 0xff, 0x01, 0xa8, 0x14, 0xff, 0xff, 0x9f, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xc3, 
+  0x58, 0xf8, 0xb1, 0x95, 0xff, 0x85, 0xb1, 0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xc8, 0xb1, 0xd5, 0x0b, 0x91, 0xd5, 0x28, 0x86, 0x91, 0xd5, 0xff, 0x01, 0x80, 0x15, 0xff, 0xff, 0xff, 0xf8, 0x82, 0xff, 
+  0xff, 0xff, 0x04, 0xc4, 0x57, 0xff, 0xaa, 0x13, 0xff, 0xb2, 0x53, 0xff, 0xb2, 0x13, 0xff, 0xa9, 0xd2, 0xff, 0x81, 0xa9, 0xb2, 0xff, 0x81, 0xa9, 0xd2, 0xff, 0x81, 0xa9, 0xb2, 0xff, 0x06, 0xa9, 
+  0xd2, 0xff, 0xa9, 0xb2, 0xff, 0xa8, 0x11, 0xff, 0xd4, 0xd8, 0xff, 0xee, 0xdc, 0xff, 0xf7, 0x3e, 0xff, 0xff, 0x9f, 0xff, 0x81, 0xff, 0xbf, 0xff, 0x04, 0xff, 0x9f, 0xff, 0xf6, 0xfd, 0xff, 0xee, 
+  0x1a, 0xff, 0xca, 0x73, 0xff, 0xc1, 0x10, 0xff, 0x81, 0xc1, 0xf1, 0xff, 0x01, 0xc1, 0xd1, 0xff, 0xee, 0x3a, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xed, 0xfa, 0xff, 0xc2, 0x13, 0xff, 0xb2, 0x16, 
+  0xff, 0xa9, 0x35, 0xff, 0xee, 0x1c, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xdc, 0xba, 0xdc, 0xb1, 0x55, 0xff, 0x85, 0xb1, 0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 0x91, 0xd5, 0x28, 
+  0x82, 0x91, 0xd5, 0xff, 0x04, 0x91, 0xd5, 0xfc, 0x91, 0xd5, 0xff, 0x99, 0xd4, 0xf4, 0xa9, 0xd3, 0xdb, 0xa8, 0x12, 0xf0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xff, 0xc3, 0xb5, 0xff, 0x86, 
+  0xa9, 0xd2, 0xff, 0x00, 0xb1, 0xf2, 0xff, 0x81, 0xc2, 0x92, 0xff, 0x01, 0xc2, 0x51, 0xff, 0xcb, 0x33, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xed, 0xba, 0xff, 0xc2, 0x11, 0xff, 0x81, 0xc1, 0xf1, 
+  0xff, 0x01, 0xc1, 0xb2, 0xff, 0xff, 0x9f, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0xff, 0x7e, 0xff, 0xca, 0xb3, 0xff, 0xc1, 0xf1, 0xff, 0xc2, 0x73, 0xff, 0xb1, 0xb5, 0xff, 0xdd, 0x7b, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0xe5, 0xbc, 0xd8, 0xb0, 0xd5, 0xff, 0x85, 0xb1, 0xb5, 0xff, 0x0a, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 0x91, 0xd5, 0x24, 0x99, 0xd5, 0xef, 0x99, 0xd4, 0xf0, 0xa1, 0xd3, 
+  0xfc, 0xa9, 0xd2, 0xeb, 0xb1, 0xd2, 0xf4, 0xb1, 0xd2, 0xff, 0xa9, 0xd2, 0xff, 0xb1, 0x52, 0xf7, 0x82, 0xff, 0xff, 0xff, 0x07, 0xff, 0x9f, 0xff, 0xbb, 0x55, 0xff, 0xba, 0x73, 0xff, 0xba, 0x52, 
+  0xff, 0xb1, 0xf1, 0xff, 0xba, 0x31, 0xff, 0xc2, 0x71, 0xff, 0xc2, 0x50, 0xff, 0x82, 0xc1, 0xf0, 0xff, 0x01, 0xb8, 0x0e, 0xff, 0xee, 0x1a, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x0c, 0xff, 0x9f, 0xff, 
+  0xd3, 0xd5, 0xff, 0xc1, 0xb1, 0xff, 0xc1, 0xf1, 0xff, 0xc0, 0x10, 0xff, 0xdc, 0x77, 0xff, 0xdc, 0x97, 0xff, 0xc0, 0x70, 0xff, 0xc1, 0xd1, 0xff, 0xc1, 0xf1, 0xff, 0xc1, 0xd1, 0xff, 0xc2, 0x53, 
+  0xff, 0xdd, 0x3a, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xf6, 0x9e, 0xdc, 0xa8, 0x15, 0xff, 0x85, 0xb1, 0xb5, 0xff, 0x04, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 0xa9, 0xd2, 0x27, 0xa9, 0xd2, 0xff, 
+  0xa9, 0xd2, 0xfc, 0x84, 0xa9, 0xd2, 0xff, 0x00, 0xb2, 0x13, 0xef, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9e, 0xff, 0xca, 0xf2, 0xff, 0x81, 0xc2, 0x10, 0xff, 0x85, 0xc1, 0xf0, 0xff, 0x01, 0xb8, 
+  0x0e, 0xff, 0xf7, 0x1d, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xd2, 0xd4, 0xff, 0xc1, 0xd1, 0xff, 0x86, 0xc1, 0xf1, 0xff, 0x01, 0xc1, 0xd1, 0xff, 0xdd, 0x18, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 
+  0xf6, 0xfe, 0xdb, 0xa8, 0x14, 0xff, 0x85, 0xb1, 0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 0xa9, 0xd2, 0x28, 0x85, 0xa9, 0xd2, 0xff, 0x01, 0xb1, 0xd2, 0xf7, 0xc2, 0xb4, 0xdc, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0x7e, 0xff, 0xca, 0xf2, 0xff, 0x81, 0xc1, 0xf0, 0xff, 0x82, 0xb9, 0xf0, 0xff, 0x03, 0xc2, 0x10, 0xff, 0xc2, 0x51, 0xff, 0xc2, 0x70, 0xff, 0xee, 0x3a, 0xff, 0x84, 
+  0xff, 0xff, 0xff, 0x07, 0xff, 0x3d, 0xff, 0xed, 0xf9, 0xff, 0xe4, 0x33, 0xff, 0xda, 0xf0, 0xff, 0xdb, 0x51, 0xff, 0xe4, 0xb5, 0xff, 0xf6, 0xbb, 0xff, 0xff, 0xbf, 0xff, 0x84, 0xff, 0xff, 0xff, 
+  0x01, 0xd3, 0x94, 0xff, 0xc1, 0xd1, 0xff, 0x85, 0xc1, 0xf1, 0xff, 0x01, 0xc1, 0xd1, 0xff, 0xdc, 0xf8, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x3e, 0xd8, 0xa8, 0x14, 0xff, 0x85, 0xb1, 0xb5, 
+  0xff, 0x02, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 0xa9, 0xd2, 0x28, 0x82, 0xa9, 0xd2, 0xff, 0x01, 0xb1, 0xd1, 0xeb, 0xb9, 0xf0, 0xdb, 0x81, 0xc1, 0xef, 0xfb, 0x00, 0xd3, 0x52, 0xdb, 0x82, 0xff, 
+  0xff, 0xff, 0x09, 0xff, 0x7e, 0xff, 0xc2, 0x91, 0xff, 0xb9, 0xf0, 0xff, 0xc2, 0x51, 0xff, 0xca, 0xf2, 0xff, 0xd2, 0xd0, 0xff, 0xd2, 0x4d, 0xff, 0xd2, 0x4c, 0xff, 0xd2, 0x6d, 0xff, 0xdb, 0x70, 
+  0xff, 0x84, 0xff, 0xff, 0xff, 0x09, 0xe5, 0x16, 0xff, 0xd2, 0xae, 0xff, 0xd1, 0xcc, 0xff, 0xd2, 0x0c, 0xff, 0xd2, 0x0d, 0xff, 0xd2, 0x0c, 0xff, 0xd1, 0xec, 0xff, 0xd1, 0xcc, 0xff, 0xdb, 0x70, 
+  0xff, 0xf6, 0x9b, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xf6, 0xfc, 0xff, 0xd2, 0xf2, 0xff, 0xc1, 0xd1, 0xff, 0x85, 0xc1, 0xf1, 0xff, 0x00, 0xdc, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 
+  0x5f, 0xdb, 0xa8, 0x14, 0xff, 0x85, 0xb1, 0xb5, 0xff, 0x05, 0xb1, 0xb5, 0xc8, 0xb1, 0xb5, 0x0b, 0xb1, 0xd2, 0x28, 0xb1, 0xd1, 0xff, 0xb9, 0xef, 0xd7, 0xc2, 0x0e, 0xec, 0x82, 0xc2, 0x0e, 0xff, 
+  0x01, 0xc1, 0xee, 0xff, 0xd3, 0x72, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x03, 0xff, 0x7e, 0xff, 0xdb, 0x51, 0xff, 0xd2, 0x6c, 0xff, 0xda, 0x4b, 0xff, 0x81, 0xda, 0x2b, 0xff, 0x81, 0xda, 0x4b, 0xff, 
+  0x01, 0xd0, 0xe8, 0xff, 0xff, 0x7e, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xe4, 0x33, 0xff, 0xc9, 0xab, 0xff, 0x87, 0xd2, 0x2d, 0xff, 0x01, 0xd1, 0x8c, 0xff, 0xf6, 0xdc, 0xff, 0x83, 0xff, 0xff, 
+  0xff, 0x02, 0xd3, 0xb3, 0xff, 0xca, 0x70, 0xff, 0xc2, 0x31, 0xff, 0x84, 0xc1, 0xf1, 0xff, 0x00, 0xdc, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x5f, 0xdf, 0xa8, 0x14, 0xff, 0x85, 0xb1, 
+  0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 0xc2, 0x0e, 0x27, 0x85, 0xc2, 0x0e, 0xff, 0x01, 0xc1, 0xee, 0xff, 0xd3, 0x73, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7e, 0xff, 0xda, 
+  0xed, 0xff, 0x84, 0xda, 0x4b, 0xff, 0x01, 0xda, 0x2b, 0xff, 0xe4, 0x52, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xed, 0x56, 0xff, 0xd1, 0xeb, 0xff, 0xdb, 0x0f, 0xff, 0xd2, 0x2d, 0xff, 0xd2, 0x0c, 
+  0xff, 0x86, 0xd2, 0x2d, 0xff, 0x01, 0xd1, 0x6c, 0xff, 0xff, 0x3d, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xff, 0x7e, 0xff, 0xc0, 0x0c, 0xff, 0xca, 0x50, 0xff, 0xca, 0xb2, 0xff, 0xc1, 0xd1, 0xff, 
+  0x82, 0xc1, 0xf1, 0xff, 0x00, 0xdc, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7f, 0xe4, 0xb8, 0x11, 0xeb, 0x85, 0xb1, 0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 0xc2, 0x0e, 
+  0x28, 0x83, 0xc2, 0x0e, 0xff, 0x03, 0xc2, 0x0e, 0xfc, 0xca, 0x0e, 0xd7, 0xd2, 0x2c, 0xdb, 0xe3, 0xb0, 0xdb, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7e, 0xff, 0xda, 0xed, 0xff, 0x84, 0xda, 0x4b, 
+  0xff, 0x01, 0xd1, 0xea, 0xff, 0xf6, 0xbb, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x5d, 0xff, 0xda, 0xcd, 0xff, 0x82, 0xda, 0x4b, 0xff, 0x01, 0xdb, 0x2f, 0xff, 0xd2, 0x6d, 0xff, 0x86, 0xd2, 
+  0x2d, 0xff, 0x00, 0xdc, 0x32, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xd2, 0xf1, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x2f, 0xff, 0xca, 0x71, 0xff, 0x82, 0xc1, 0xf1, 0xff, 0x00, 0xdc, 0xd7, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0x02, 0xff, 0x7f, 0xe8, 0xb8, 0x10, 0xff, 0xb9, 0xd2, 0xdb, 0x84, 0xb1, 0xb5, 0xff, 0x07, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 0xc1, 0xef, 0x27, 0xc2, 0x0e, 0xf4, 0xca, 0x0d, 
+  0xf3, 0xca, 0x2d, 0xf3, 0xd2, 0x2b, 0xe0, 0xda, 0x4a, 0xf8, 0x81, 0xda, 0x4a, 0xff, 0x00, 0xe3, 0x8f, 0xe3, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7e, 0xff, 0xda, 0xed, 0xff, 0x85, 0xda, 0x4b, 
+  0xff, 0x00, 0xff, 0x1c, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xf6, 0x39, 0xff, 0xd1, 0xea, 0xff, 0x82, 0xda, 0x4b, 0xff, 0x05, 0xda, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0xee, 0xff, 0xd2, 0xce, 
+  0xff, 0xd2, 0x6e, 0xff, 0xd2, 0x0d, 0xff, 0x82, 0xd2, 0x2d, 0xff, 0x01, 0xd2, 0xce, 0xff, 0xff, 0x5d, 0xff, 0x82, 0xff, 0xff, 0xff, 0x07, 0xed, 0xb9, 0xff, 0xc9, 0xce, 0xff, 0xca, 0x0f, 0xff, 
+  0xca, 0x4f, 0xff, 0xca, 0x71, 0xff, 0xc2, 0x11, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xd7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xff, 0x9f, 0xeb, 0xb8, 0x10, 0xff, 0xc1, 0xf1, 0xff, 0xb9, 0xd3, 0xe7, 
+  0xb1, 0xb5, 0xfc, 0x82, 0xb1, 0xb5, 0xff, 0x04, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0b, 0xda, 0x4b, 0x28, 0xda, 0x4b, 0xff, 0xda, 0x4a, 0xfc, 0x84, 0xda, 0x4a, 0xff, 0x00, 0xe3, 0x8f, 0xe0, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0x7e, 0xff, 0xda, 0xee, 0xff, 0x84, 0xda, 0x4b, 0xff, 0x01, 0xdb, 0x2e, 0xff, 0xff, 0x7e, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xe4, 0x52, 0xff, 0xd2, 0x2b, 0xff, 
+  0x85, 0xda, 0x4b, 0xff, 0x03, 0xda, 0x6b, 0xff, 0xda, 0x6c, 0xff, 0xda, 0xef, 0xff, 0xd2, 0x0d, 0xff, 0x81, 0xd2, 0x2d, 0xff, 0x01, 0xd1, 0xec, 0xff, 0xf6, 0xfc, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0x01, 0xf6, 0xbb, 0xff, 0xc9, 0xae, 0xff, 0x81, 0xca, 0x0f, 0xff, 0x03, 0xca, 0x2f, 0xff, 0xca, 0x91, 0xff, 0xc1, 0xf1, 0xff, 0xdc, 0xd7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xe8, 
+  0xb8, 0x10, 0xff, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xfb, 0xb9, 0xd4, 0xf8, 0x82, 0xb1, 0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xcb, 0xb1, 0xb5, 0x0c, 0xda, 0x4a, 0x28, 0x86, 0xda, 0x4a, 0xff, 0x00, 0xe3, 
+  0x8f, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7e, 0xff, 0xda, 0xed, 0xff, 0x84, 0xda, 0x4b, 0xff, 0x01, 0xdb, 0x6f, 0xff, 0xff, 0x9e, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xe3, 0x8f, 0xff, 
+  0xda, 0x8b, 0xff, 0xda, 0x6b, 0xff, 0x86, 0xda, 0x4b, 0xff, 0x05, 0xda, 0x2a, 0xff, 0xdb, 0x4f, 0xff, 0xd2, 0x6e, 0xff, 0xd2, 0x2d, 0xff, 0xd1, 0xac, 0xff, 0xf6, 0xbb, 0xff, 0x82, 0xff, 0xff, 
+  0xff, 0x01, 0xf6, 0xdc, 0xff, 0xc9, 0xae, 0xff, 0x82, 0xca, 0x0f, 0xff, 0x02, 0xca, 0x2f, 0xff, 0xca, 0x71, 0xff, 0xdc, 0xd7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xbf, 0xe8, 0xb8, 0x10, 
+  0xff, 0x81, 0xc1, 0xf2, 0xff, 0x01, 0xc1, 0xf1, 0xec, 0xb1, 0xb5, 0xf7, 0x81, 0xb1, 0xb5, 0xff, 0x02, 0xb1, 0xb5, 0xcb, 0xb1, 0xd5, 0x0c, 0xda, 0x4a, 0x28, 0x86, 0xda, 0x4a, 0xff, 0x00, 0xe3, 
+  0x8f, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x04, 0xff, 0x7e, 0xff, 0xe3, 0x8f, 0xff, 0xe3, 0x2d, 0xff, 0xe3, 0x0c, 0xff, 0xe2, 0xca, 0xff, 0x81, 0xe2, 0xeb, 0xff, 0x01, 0xe3, 0xf0, 0xff, 0xff, 0xbf, 
+  0xff, 0x82, 0xff, 0xff, 0xff, 0x05, 0xeb, 0xef, 0xff, 0xe2, 0xaa, 0xff, 0xda, 0x8a, 0xff, 0xe2, 0xec, 0xff, 0xdb, 0x0d, 0xff, 0xd2, 0x2b, 0xff, 0x85, 0xda, 0x4b, 0xff, 0x03, 0xda, 0x8c, 0xff, 
+  0xdb, 0x0f, 0xff, 0xd2, 0x0d, 0xff, 0xf6, 0xdb, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xbc, 0xff, 0xc9, 0xae, 0xff, 0x83, 0xca, 0x0f, 0xff, 0x01, 0xca, 0x2f, 0xff, 0xdc, 0xf6, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xbf, 0xe7, 0xb8, 0x10, 0xff, 0x82, 0xc1, 0xf2, 0xff, 0x05, 0xc1, 0xd2, 0xf3, 0xb1, 0xb5, 0xf7, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcc, 0xb1, 0xb5, 0x0c, 0xda, 0x4a, 
+  0x28, 0x86, 0xda, 0x4a, 0xff, 0x00, 0xe3, 0x8f, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9e, 0xff, 0xeb, 0x4b, 0xff, 0x81, 0xe2, 0xa7, 0xff, 0x81, 0xe2, 0xc7, 0xff, 0x02, 0xe2, 0xa7, 0xff, 
+  0xeb, 0x29, 0xff, 0xff, 0x5d, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xec, 0xf3, 0xff, 0xda, 0x48, 0xff, 0x82, 0xda, 0x69, 0xff, 0x02, 0xe3, 0x0c, 0xff, 0xda, 0x8b, 0xff, 0xda, 0x6b, 0xff, 0x84, 
+  0xda, 0x4b, 0xff, 0x02, 0xda, 0x2b, 0xff, 0xda, 0xad, 0xff, 0xff, 0x3d, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xee, 0x3a, 0xff, 0xc9, 0xae, 0xff, 0x83, 0xca, 0x0f, 0xff, 0x01, 0xca, 0x0e, 0xff, 
+  0xe4, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9f, 0xe7, 0xb8, 0x10, 0xff, 0x83, 0xc1, 0xf2, 0xff, 0x04, 0xb9, 0xd3, 0xf4, 0xb1, 0xb5, 0xff, 0xb1, 0xb5, 0xcc, 0xb1, 0xb5, 0x0c, 0xda, 
+  0x4a, 0x28, 0x86, 0xda, 0x4a, 0xff, 0x00, 0xe3, 0x8f, 0xe0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9e, 0xff, 0xeb, 0x4b, 0xff, 0x84, 0xe2, 0xc8, 0xff, 0x01, 0xe2, 0x86, 0xff, 0xfe, 0xfb, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfb, 0xff, 0xda, 0x48, 0xff, 0x84, 0xda, 0x69, 0xff, 0x01, 0xe2, 0xcb, 0xff, 0xdb, 0x0c, 0xff, 0x84, 0xda, 0x4b, 0xff, 0x01, 0xdb, 0x6f, 0xff, 0xff, 0xbe, 
+  0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xed, 0x37, 0xff, 0xc9, 0xee, 0xff, 0x83, 0xca, 0x0f, 0xff, 0x01, 0xca, 0x0e, 0xff, 0xe4, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9f, 0xe4, 0xb8, 
+  0x10, 0xff, 0x83, 0xc1, 0xf2, 0xff, 0x04, 0xc1, 0xf1, 0xf4, 0xb1, 0xb5, 0xf0, 0xb1, 0xb5, 0xcc, 0xb1, 0xb5, 0x0c, 0xda, 0x4a, 0x28, 0x86, 0xda, 0x4a, 0xff, 0x00, 0xe3, 0x8f, 0xdf, 0x82, 0xff, 
+  0xff, 0xff, 0x01, 0xff, 0x9e, 0xff, 0xeb, 0x6b, 0xff, 0x84, 0xe2, 0xc8, 0xff, 0x01, 0xe2, 0x86, 0xff, 0xf6, 0x17, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xff, 0xe3, 0xce, 0xff, 0x86, 
+  0xda, 0x69, 0xff, 0x01, 0xe2, 0xca, 0xff, 0xda, 0xac, 0xff, 0x81, 0xda, 0x4b, 0xff, 0x01, 0xd2, 0x0a, 0xff, 0xed, 0x56, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xd1, 0x48, 0xff, 0xd3, 0x10, 0xff, 
+  0xc9, 0xee, 0xff, 0x82, 0xca, 0x0f, 0xff, 0x01, 0xca, 0x0e, 0xff, 0xe4, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9f, 0xe4, 0xb8, 0x10, 0xff, 0x84, 0xc1, 0xf2, 0xff, 0x03, 0xc1, 0xd2, 
+  0xec, 0xb1, 0xb5, 0xcf, 0xb1, 0xb5, 0x0c, 0xda, 0x4a, 0x28, 0x83, 0xda, 0x4a, 0xff, 0x03, 0xda, 0x4a, 0xfb, 0xda, 0x6a, 0xef, 0xda, 0xa9, 0xf3, 0xec, 0x2e, 0xcb, 0x82, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0x9e, 0xff, 0xeb, 0x6b, 0xff, 0x84, 0xe2, 0xc8, 0xff, 0x01, 0xe2, 0xa7, 0xff, 0xe2, 0x64, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfb, 0xff, 0xe2, 0x28, 0xff, 0x86, 0xda, 0x69, 0xff, 
+  0x03, 0xe2, 0xca, 0xff, 0xda, 0x8b, 0xff, 0xda, 0x2a, 0xff, 0xe4, 0x32, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xf6, 0x7a, 0xff, 0xd1, 0x68, 0xff, 0xda, 0x2a, 0xff, 0xd2, 0xf0, 0xff, 0xca, 0x2f, 
+  0xff, 0x81, 0xca, 0x0f, 0xff, 0x01, 0xca, 0x0e, 0xff, 0xe4, 0xf6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9f, 0xe4, 0xb8, 0x10, 0xff, 0x85, 0xc1, 0xf2, 0xff, 0x02, 0xb9, 0xd3, 0xbc, 0xb1, 
+  0xd5, 0x0f, 0xda, 0x4a, 0x28, 0x82, 0xda, 0x4a, 0xff, 0x04, 0xda, 0x4a, 0xe3, 0xe2, 0xe8, 0xef, 0xe3, 0x08, 0xf8, 0xe3, 0x08, 0xff, 0xeb, 0xec, 0xe4, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9e, 
+  0xff, 0xeb, 0x6b, 0xff, 0x85, 0xe2, 0xc8, 0xff, 0x01, 0xe2, 0x65, 0xff, 0xf5, 0x74, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xff, 0x1c, 0xff, 0xe2, 0x69, 0xff, 0x86, 0xda, 0x69, 0xff, 0x02, 0xda, 
+  0x28, 0xff, 0xec, 0x51, 0xff, 0xff, 0xbf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xff, 0xda, 0xcd, 0xff, 0x82, 0xda, 0x4b, 0xff, 0x04, 0xd2, 0xaf, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0f, 
+  0xff, 0xca, 0x0e, 0xff, 0xe5, 0x16, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7f, 0xe3, 0xb8, 0x10, 0xff, 0x85, 0xc1, 0xf2, 0xff, 0x05, 0xc1, 0xd2, 0xdb, 0xb9, 0xd4, 0x13, 0xda, 0x4a, 0x28, 
+  0xda, 0x4a, 0xff, 0xda, 0x6a, 0xf8, 0xe2, 0xc9, 0xe8, 0x83, 0xe3, 0x08, 0xff, 0x00, 0xeb, 0xab, 0xe7, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0x9e, 0xff, 0xeb, 0x8c, 0xff, 0xe2, 0xa7, 0xff, 0x83, 
+  0xe2, 0xc8, 0xff, 0x00, 0xe2, 0xa8, 0xff, 0x81, 0xe2, 0xc8, 0xff, 0x00, 0xff, 0x7d, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xff, 0x5d, 0xff, 0xec, 0x92, 0xff, 0xe3, 0x2c, 0xff, 0xda, 0x69, 0xff, 
+  0x81, 0xda, 0x28, 0xff, 0x02, 0xe2, 0xaa, 0xff, 0xe3, 0xae, 0xff, 0xf5, 0xb6, 0xff, 0x84, 0xff, 0xff, 0xff, 0x00, 0xed, 0xb7, 0xff, 0x84, 0xda, 0x4b, 0xff, 0x03, 0xd2, 0xb0, 0xff, 0xca, 0x0f, 
+  0xff, 0xca, 0x0e, 0xff, 0xe5, 0x17, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9e, 0xe3, 0xc0, 0x0e, 0xe7, 0x85, 0xc1, 0xf2, 0xff, 0x04, 0xc1, 0xd2, 0xd0, 0xb9, 0xd2, 0x0f, 0xda, 0x6a, 0x20, 
+  0xe2, 0xc9, 0xf3, 0xe3, 0x08, 0xf7, 0x84, 0xe3, 0x08, 0xff, 0x00, 0xeb, 0x8a, 0xeb, 0x82, 0xff, 0xff, 0xff, 0x03, 0xff, 0x9e, 0xff, 0xec, 0x0e, 0xff, 0xeb, 0x6a, 0xff, 0xe3, 0x28, 0xff, 0x82, 
+  0xe3, 0x08, 0xff, 0x03, 0xeb, 0x29, 0xff, 0xeb, 0x6a, 0xff, 0xeb, 0x6b, 0xff, 0xec, 0x2f, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0x81, 0xfe, 0xfc, 0xff, 0x01, 
+  0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xf6, 0x39, 0xff, 0xda, 0x2a, 0xff, 0x84, 0xda, 0x4b, 0xff, 0x03, 0xda, 0x6c, 0xff, 0xd2, 0x90, 0xff, 0xc9, 0xee, 0xff, 0xe5, 
+  0x37, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0x9e, 0xe3, 0xc0, 0x2c, 0xf4, 0xc1, 0xf1, 0xfc, 0x84, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcc, 0xc1, 0xf2, 0x0c, 0xe3, 0x08, 0x28, 0x86, 0xe3, 
+  0x08, 0xff, 0x00, 0xeb, 0x48, 0xf0, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xbe, 0xff, 0xec, 0x2d, 0xff, 0x85, 0xe3, 0x48, 0xff, 0x81, 0xe3, 0x28, 0xff, 0x01, 0xe3, 0x27, 0xff, 0xec, 0x8e, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xbb, 0xff, 0xd1, 0xa9, 0xff, 0x86, 0xda, 0x4b, 0xff, 0x02, 0xda, 0xae, 0xff, 0xca, 0x0f, 0xff, 0xe5, 0x58, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0x3d, 
+  0xdb, 0xc8, 0xec, 0xff, 0xca, 0x10, 0xe3, 0x84, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcc, 0xc1, 0xf2, 0x0c, 0xe3, 0x08, 0x28, 0x86, 0xe3, 0x08, 0xff, 0x00, 0xea, 0xc4, 0xf8, 0x82, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xdf, 0xff, 0xec, 0x4e, 0xff, 0x86, 0xe3, 0x28, 0xff, 0x81, 0xe3, 0x48, 0xff, 0x02, 0xe3, 0x27, 0xff, 0xeb, 0xec, 0xff, 0xfe, 0xda, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x04, 0xff, 
+  0xdf, 0xff, 0xf5, 0xb6, 0xff, 0xe2, 0xea, 0xff, 0xda, 0xac, 0xff, 0xda, 0x2b, 0xff, 0x85, 0xda, 0x4b, 0xff, 0x02, 0xda, 0x2a, 0xff, 0xd2, 0x6e, 0xff, 0xed, 0x98, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0x03, 0xf6, 0x9b, 0xd7, 0xc9, 0x4d, 0xff, 0xca, 0x0e, 0xfb, 0xc1, 0xf1, 0xeb, 0x83, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcc, 0xc1, 0xf1, 0x0c, 0xe3, 0x08, 0x28, 0x86, 0xe3, 0x08, 0xff, 0x00, 
+  0xe2, 0x40, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xf5, 0x52, 0xff, 0x82, 0xec, 0x6d, 0xff, 0x81, 0xec, 0x6c, 0xff, 0x02, 0xec, 0x6d, 0xff, 0xec, 0x2c, 0xff, 0xe3, 0x48, 0xff, 0x81, 0xe3, 0x28, 
+  0xff, 0x03, 0xe3, 0x48, 0xff, 0xe3, 0x49, 0xff, 0xec, 0x4e, 0xff, 0xff, 0x7d, 0xff, 0x87, 0xff, 0xff, 0xff, 0x05, 0xf6, 0x17, 0xff, 0xe3, 0x0a, 0xff, 0xe2, 0x68, 0xff, 0xe2, 0x88, 0xff, 0xe2, 
+  0x89, 0xff, 0xda, 0x8b, 0xff, 0x86, 0xda, 0x4b, 0xff, 0x01, 0xd2, 0x0a, 0xff, 0xf5, 0xf9, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xed, 0xb9, 0xdc, 0xc9, 0x8d, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0f, 
+  0xf7, 0x83, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcc, 0xc1, 0xf1, 0x0c, 0xe3, 0x08, 0x27, 0x86, 0xe3, 0x08, 0xff, 0x01, 0xe2, 0x40, 0xff, 0xff, 0xdf, 0xe8, 0x82, 0xff, 0xff, 0xff, 0x00, 0xf5, 
+  0x73, 0xff, 0x82, 0xeb, 0xc8, 0xff, 0x00, 0xeb, 0xa8, 0xff, 0x83, 0xeb, 0xc8, 0xff, 0x0e, 0xec, 0x2a, 0xff, 0xec, 0x4c, 0xff, 0xeb, 0x89, 0xff, 0xeb, 0x69, 0xff, 0xe3, 0x27, 0xff, 0xe2, 0x80, 
+  0xff, 0xeb, 0x89, 0xff, 0xf5, 0xb4, 0xff, 0xf6, 0x79, 0xff, 0xfe, 0xba, 0xff, 0xfe, 0xdb, 0xff, 0xf6, 0x59, 0xff, 0xec, 0x71, 0xff, 0xe1, 0x60, 0xff, 0xe1, 0xe5, 0xff, 0x83, 0xe2, 0x88, 0xff, 
+  0x00, 0xe2, 0xaa, 0xff, 0x86, 0xda, 0x4b, 0xff, 0x01, 0xd1, 0xc9, 0xff, 0xfe, 0xfc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xdc, 0x14, 0xef, 0xc9, 0xee, 0xff, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xf8, 
+  0xc1, 0xf1, 0xf4, 0x82, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcc, 0xc1, 0xd2, 0x0c, 0xe3, 0x08, 0x27, 0x86, 0xe3, 0x08, 0xff, 0x01, 0xe2, 0xa4, 0xfc, 0xff, 0x3c, 0xc8, 0x82, 0xff, 0xff, 0xff, 
+  0x05, 0xfe, 0x98, 0xff, 0xeb, 0xa7, 0xff, 0xeb, 0xe9, 0xff, 0xec, 0x2a, 0xff, 0xec, 0x4b, 0xff, 0xec, 0x2a, 0xff, 0x84, 0xeb, 0xc8, 0xff, 0x05, 0xeb, 0xe9, 0xff, 0xeb, 0xc9, 0xff, 0xec, 0x2b, 
+  0xff, 0xeb, 0x89, 0xff, 0xe3, 0x28, 0xff, 0xe3, 0x27, 0xff, 0x82, 0xe3, 0x07, 0xff, 0x01, 0xe3, 0x4a, 0xff, 0xe2, 0x47, 0xff, 0x86, 0xe2, 0x88, 0xff, 0x01, 0xe3, 0x0b, 0xff, 0xd2, 0x2b, 0xff, 
+  0x84, 0xda, 0x4b, 0xff, 0x00, 0xd9, 0xc9, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xd2, 0x8f, 0xff, 0x82, 0xca, 0x0e, 0xff, 0x00, 0xca, 0x0f, 0xe0, 0x82, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcc, 
+  0xc1, 0xf1, 0x0c, 0xe3, 0x08, 0x27, 0x84, 0xe3, 0x08, 0xff, 0x03, 0xe3, 0x28, 0xfb, 0xeb, 0xa8, 0xeb, 0xec, 0x48, 0xf3, 0xf5, 0x6f, 0xeb, 0x83, 0xff, 0xff, 0xff, 0x00, 0xec, 0x48, 0xff, 0x84, 
+  0xec, 0x29, 0xff, 0x02, 0xec, 0x8b, 0xff, 0xec, 0xac, 0xff, 0xec, 0x4b, 0xff, 0x81, 0xeb, 0xe9, 0xff, 0x81, 0xeb, 0xc8, 0xff, 0x01, 0xec, 0x0a, 0xff, 0xeb, 0xea, 0xff, 0x84, 0xe3, 0x48, 0xff, 
+  0x00, 0xe3, 0x4b, 0xff, 0x86, 0xe2, 0x88, 0xff, 0x01, 0xe2, 0x68, 0xff, 0xe3, 0x2c, 0xff, 0x83, 0xda, 0x4b, 0xff, 0x01, 0xd1, 0xc9, 0xff, 0xed, 0x15, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 
+  0x9f, 0xe7, 0xca, 0x2e, 0xff, 0x82, 0xca, 0x0e, 0xff, 0x01, 0xca, 0x2e, 0xff, 0xc1, 0xf1, 0xf4, 0x81, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcb, 0xc1, 0xf2, 0x0c, 0xe3, 0x08, 0x27, 0x83, 0xe3, 
+  0x08, 0xff, 0x01, 0xeb, 0xa8, 0xe7, 0xec, 0x29, 0xf0, 0x82, 0xec, 0x49, 0xff, 0x00, 0xff, 0xff, 0xeb, 0x82, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xb8, 0xff, 0xeb, 0xc4, 0xff, 0x83, 0xec, 0x08, 0xff, 
+  0x00, 0xec, 0x28, 0xff, 0x81, 0xec, 0x29, 0xff, 0x03, 0xec, 0x6a, 0xff, 0xec, 0x4a, 0xff, 0xec, 0x8c, 0xff, 0xeb, 0xe9, 0xff, 0x81, 0xeb, 0xc8, 0xff, 0x02, 0xeb, 0xea, 0xff, 0xeb, 0xca, 0xff, 
+  0xe3, 0x28, 0xff, 0x81, 0xe3, 0x48, 0xff, 0x02, 0xeb, 0x49, 0xff, 0xe3, 0x4a, 0xff, 0xe2, 0x68, 0xff, 0x85, 0xe2, 0x88, 0xff, 0x01, 0xe2, 0xa9, 0xff, 0xda, 0x6b, 0xff, 0x82, 0xda, 0x4b, 0xff, 
+  0x01, 0xda, 0xac, 0xff, 0xff, 0xbf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xee, 0x1a, 0xfb, 0x84, 0xca, 0x0e, 0xff, 0x00, 0xca, 0x0f, 0xe3, 0x81, 0xc1, 0xf2, 0xff, 0x02, 0xc1, 0xf2, 0xcb, 0xb9, 
+  0xf1, 0x0c, 0xe3, 0x08, 0x27, 0x82, 0xe3, 0x08, 0xff, 0x00, 0xec, 0x29, 0xe0, 0x84, 0xec, 0x49, 0xff, 0x00, 0xfe, 0xb8, 0xf3, 0x83, 0xff, 0xff, 0xff, 0x00, 0xf6, 0x34, 0xff, 0x82, 0xf5, 0x4d, 
+  0xff, 0x01, 0xf5, 0x4e, 0xff, 0xec, 0xcc, 0xff, 0x84, 0xec, 0x29, 0xff, 0x02, 0xec, 0x4a, 0xff, 0xec, 0x4b, 0xff, 0xeb, 0xc9, 0xff, 0x81, 0xeb, 0xc8, 0xff, 0x01, 0xec, 0x0b, 0xff, 0xe3, 0x28, 
+  0xff, 0x82, 0xe3, 0x48, 0xff, 0x00, 0xe3, 0x6b, 0xff, 0x85, 0xe2, 0x88, 0xff, 0x05, 0xe2, 0x68, 0xff, 0xe3, 0x4c, 0xff, 0xd2, 0x2b, 0xff, 0xda, 0x4b, 0xff, 0xda, 0x6b, 0xff, 0xf6, 0x59, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfb, 0xe4, 0xf5, 0xd0, 0x84, 0xca, 0x0e, 0xff, 0x08, 0xca, 0x0e, 0xfc, 0xc1, 0xf1, 0xef, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xcb, 0xc1, 0xd2, 0x0b, 0xe3, 
+  0x08, 0x27, 0xe3, 0x08, 0xff, 0xe3, 0x48, 0xf0, 0xec, 0x29, 0xf4, 0x85, 0xec, 0x49, 0xff, 0x00, 0xed, 0x0f, 0xf4, 0x83, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xf6, 0x14, 0xff, 0xec, 0xa6, 
+  0xff, 0xec, 0xa8, 0xff, 0x81, 0xec, 0xc9, 0xff, 0x03, 0xec, 0xea, 0xff, 0xed, 0x2c, 0xff, 0xec, 0x8a, 0xff, 0xec, 0xab, 0xff, 0x81, 0xec, 0x29, 0xff, 0x06, 0xec, 0x49, 0xff, 0xec, 0x6b, 0xff, 
+  0xec, 0x0a, 0xff, 0xeb, 0xc8, 0xff, 0xeb, 0xe9, 0xff, 0xeb, 0xea, 0xff, 0xe3, 0x28, 0xff, 0x81, 0xe3, 0x48, 0xff, 0x02, 0xeb, 0x69, 0xff, 0xe3, 0x4b, 0xff, 0xe2, 0x68, 0xff, 0x84, 0xe2, 0x88, 
+  0xff, 0x03, 0xe2, 0x47, 0xff, 0xda, 0xab, 0xff, 0xda, 0xcd, 0xff, 0xf6, 0x59, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xff, 0x3d, 0xec, 0xd1, 0x8a, 0xfb, 0xca, 0x0e, 0xec, 0x84, 0xca, 0x0e, 0xff, 
+  0x06, 0xc1, 0xf0, 0xf4, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xc7, 0xc1, 0xd1, 0x0b, 0xe2, 0xe8, 0x23, 0xe3, 0x48, 0xe4, 0xec, 0x49, 0xfc, 0x86, 0xec, 0x49, 0xff, 0x01, 0xec, 0x27, 0xff, 0xfe, 0xb7, 
+  0xd0, 0x84, 0xff, 0xff, 0xff, 0x02, 0xff, 0x9d, 0xff, 0xf5, 0xf1, 0xff, 0xec, 0xa7, 0xff, 0x81, 0xec, 0xa8, 0xff, 0x00, 0xec, 0xa9, 0xff, 0x81, 0xec, 0xc9, 0xff, 0x05, 0xed, 0x2c, 0xff, 0xec, 
+  0x4a, 0xff, 0xec, 0x28, 0xff, 0xec, 0x29, 0xff, 0xec, 0x4a, 0xff, 0xec, 0x0a, 0xff, 0x81, 0xeb, 0xc8, 0xff, 0x01, 0xec, 0x2b, 0xff, 0xe3, 0x27, 0xff, 0x82, 0xe3, 0x28, 0xff, 0x02, 0xe3, 0x2b, 
+  0xff, 0xe2, 0x47, 0xff, 0xe2, 0x67, 0xff, 0x81, 0xe2, 0x47, 0xff, 0x03, 0xe1, 0xe5, 0xff, 0xe2, 0xe9, 0xff, 0xf5, 0xd6, 0xff, 0xff, 0xbf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xeb, 
+  0xd2, 0x2c, 0xfc, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xd3, 0x84, 0xca, 0x0e, 0xff, 0x05, 0xca, 0x0f, 0xe7, 0xc1, 0xf2, 0xff, 0xc1, 0xf2, 0xc3, 0xc1, 0xf2, 0x07, 0xec, 0x29, 0x17, 0xec, 0x49, 0xe3, 
+  0x85, 0xec, 0x49, 0xff, 0x04, 0xec, 0x69, 0xf8, 0xec, 0xa9, 0xf4, 0xf5, 0x2a, 0xf0, 0xec, 0xe7, 0xff, 0xff, 0x3a, 0xdf, 0x86, 0xff, 0xff, 0xff, 0x06, 0xff, 0x5b, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 
+  0xb7, 0xff, 0xfe, 0x96, 0xff, 0xf6, 0x75, 0xff, 0xf6, 0x55, 0xff, 0xf6, 0x35, 0xff, 0x81, 0xf6, 0x15, 0xff, 0x01, 0xf5, 0xf4, 0xff, 0xf6, 0x15, 0xff, 0x82, 0xf5, 0xd4, 0xff, 0x00, 0xf5, 0xd5, 
+  0xff, 0x82, 0xf5, 0xb4, 0xff, 0x05, 0xf5, 0x94, 0xff, 0xf5, 0x95, 0xff, 0xf5, 0xb6, 0xff, 0xf5, 0xf7, 0xff, 0xfe, 0x59, 0xff, 0xff, 0x5d, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf8, 
+  0xdb, 0xf1, 0xfb, 0x82, 0xd2, 0x2c, 0xff, 0x00, 0xca, 0x0e, 0xef, 0x83, 0xca, 0x0e, 0xff, 0x05, 0xca, 0x0e, 0xf7, 0xc1, 0xf1, 0xfc, 0xc1, 0xf2, 0xb4, 0x00, 0x00, 0x00, 0xec, 0x49, 0x0f, 0xec, 
+  0x49, 0xd0, 0x84, 0xec, 0x49, 0xff, 0x01, 0xec, 0xa9, 0xf0, 0xed, 0x0a, 0xf7, 0x83, 0xed, 0x2a, 0xff, 0x00, 0xff, 0x19, 0xe0, 0xa2, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe7, 0xe4, 0x31, 0xe7, 
+  0xd2, 0x0b, 0xff, 0x82, 0xd2, 0x2c, 0xff, 0x00, 0xd2, 0x2d, 0xf0, 0x84, 0xca, 0x0e, 0xff, 0x01, 0xc1, 0xf0, 0xdc, 0xc1, 0xf2, 0x98, 0x81, 0x00, 0x00, 0x00, 0x00, 0xec, 0x49, 0xb3, 0x83, 0xec, 
+  0x49, 0xff, 0x00, 0xec, 0xc9, 0xe4, 0x85, 0xed, 0x2a, 0xff, 0x03, 0xed, 0x08, 0xff, 0xf6, 0x52, 0xdb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0x9d, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xfb, 0xff, 
+  0x1c, 0xe8, 0xda, 0x4a, 0xfc, 0xda, 0x4a, 0xfb, 0xd2, 0x2c, 0xf8, 0x82, 0xd2, 0x2c, 0xff, 0x01, 0xd2, 0x2c, 0xf3, 0xca, 0x0e, 0xfb, 0x83, 0xca, 0x0e, 0xff, 0x01, 0xca, 0x0e, 0xe8, 0xb9, 0xd2, 
+  0x60, 0x81, 0x00, 0x00, 0x00, 0x00, 0xec, 0x49, 0x6f, 0x82, 0xec, 0x49, 0xff, 0x00, 0xec, 0xe9, 0xeb, 0x84, 0xed, 0x2a, 0xff, 0x07, 0xf5, 0x4a, 0xe8, 0xf5, 0x8a, 0xf7, 0xf5, 0xaa, 0xef, 0xf5, 
+  0xa9, 0xf8, 0xf5, 0xeb, 0xfb, 0xfe, 0xb6, 0xfb, 0xff, 0x5a, 0xeb, 0xff, 0xff, 0xeb, 0x98, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xfc, 0xff, 0x9d, 0xe8, 0xf6, 0x39, 0xf4, 0xe4, 0x31, 0xeb, 0xd9, 
+  0xa7, 0xff, 0xda, 0x4a, 0xff, 0xda, 0x6a, 0xf8, 0xd2, 0x4c, 0xfb, 0x82, 0xd2, 0x2c, 0xff, 0x01, 0xd2, 0x2c, 0xf3, 0xca, 0x0e, 0xfc, 0x84, 0xca, 0x0e, 0xff, 0x00, 0xc1, 0xd0, 0x0c, 0x82, 0x00, 
+  0x00, 0x00, 0x81, 0xec, 0x49, 0xff, 0x00, 0xec, 0xe9, 0xdf, 0x84, 0xed, 0x2a, 0xff, 0x01, 0xf5, 0x8a, 0xe7, 0xf5, 0xca, 0xfc, 0x81, 0xf5, 0xca, 0xff, 0x0a, 0xf5, 0xca, 0xe3, 0xf5, 0xca, 0xd4, 
+  0xf5, 0xca, 0xdf, 0xf5, 0xca, 0xe3, 0xf5, 0xca, 0xd7, 0xf6, 0x2e, 0xdb, 0xfe, 0xd4, 0xdc, 0xff, 0x38, 0xd3, 0xff, 0x7a, 0xd0, 0xff, 0x9b, 0xd3, 0xff, 0x9c, 0xd0, 0x81, 0xff, 0x9d, 0xd8, 0x03, 
+  0xff, 0xbd, 0xd8, 0xff, 0x9d, 0xdc, 0xff, 0xbe, 0xd4, 0xff, 0xbd, 0xd4, 0x81, 0xff, 0xbd, 0xd3, 0x0d, 0xff, 0x7d, 0xdc, 0xff, 0x9d, 0xdb, 0xff, 0x9d, 0xd8, 0xff, 0x9d, 0xd7, 0xff, 0x7d, 0xd8, 
+  0xff, 0x3b, 0xd8, 0xfe, 0xda, 0xd8, 0xfe, 0x99, 0xd8, 0xfe, 0x38, 0xd4, 0xf5, 0x54, 0xdc, 0xeb, 0xcd, 0xfb, 0xe2, 0xc9, 0xff, 0xe2, 0x88, 0xff, 0xe2, 0x89, 0xef, 0x83, 0xda, 0x6a, 0xff, 0x00, 
+  0xda, 0x4b, 0xef, 0x83, 0xd2, 0x2c, 0xff, 0x00, 0xca, 0x2d, 0xf0, 0x83, 0xca, 0x0e, 0xff, 0x00, 0xca, 0x0e, 0xaf, 0x83, 0x00, 0x00, 0x00, 0x01, 0xec, 0x49, 0x6c, 0xec, 0xa9, 0xf7, 0x83, 0xed, 
+  0x2a, 0xff, 0x02, 0xf5, 0x4a, 0xf8, 0xf5, 0xaa, 0xe0, 0xf5, 0xca, 0xff, 0x81, 0xf5, 0xca, 0xef, 0x00, 0xf5, 0xea, 0xf3, 0x81, 0xf5, 0xca, 0xff, 0x01, 0xf5, 0xca, 0xf7, 0xf5, 0xca, 0xf4, 0x81, 
+  0xf5, 0xca, 0xff, 0x05, 0xf5, 0xc9, 0xff, 0xf5, 0xa9, 0xe4, 0xf5, 0xa8, 0xf7, 0xf5, 0xa8, 0xfb, 0xed, 0x67, 0xeb, 0xed, 0x26, 0xf0, 0x81, 0xed, 0x27, 0xff, 0x01, 0xed, 0x06, 0xe7, 0xec, 0x85, 
+  0xfc, 0x81, 0xec, 0x85, 0xff, 0x01, 0xec, 0x85, 0xf3, 0xe3, 0xa4, 0xf3, 0x81, 0xeb, 0x84, 0xff, 0x02, 0xeb, 0xa4, 0xff, 0xe2, 0xe2, 0xe4, 0xe2, 0xc4, 0xff, 0x81, 0xe2, 0xc5, 0xff, 0x02, 0xe2, 
+  0x85, 0xf0, 0xe2, 0x46, 0xff, 0xe2, 0x67, 0xff, 0x81, 0xe2, 0x88, 0xff, 0x00, 0xe2, 0x87, 0xec, 0x83, 0xda, 0x6a, 0xff, 0x00, 0xda, 0x6a, 0xe0, 0x83, 0xd2, 0x2c, 0xff, 0x00, 0xd2, 0x2c, 0xd3, 
+  0x83, 0xca, 0x0e, 0xff, 0x00, 0xca, 0x0e, 0x1c, 0x83, 0x00, 0x00, 0x00, 0x01, 0xec, 0xc9, 0x08, 0xed, 0x2a, 0xdc, 0x82, 0xed, 0x2a, 0xff, 0x0d, 0xed, 0x4a, 0xf0, 0xf5, 0xca, 0xf7, 0xf5, 0xca, 
+  0xff, 0xf5, 0xca, 0xe8, 0xf5, 0xca, 0xfb, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xe8, 0xf6, 0x2b, 0xdf, 0xf6, 0x4b, 0xff, 0xf6, 0x4b, 0xfc, 0xf6, 0x4b, 0xfb, 0xf6, 0x4b, 0xff, 0xf6, 0x2b, 0xe8, 0xf5, 
+  0xea, 0xd0, 0x81, 0xf5, 0xca, 0xff, 0x03, 0xf5, 0xca, 0xf8, 0xf5, 0xca, 0xe7, 0xf5, 0xca, 0xf8, 0xf5, 0x4a, 0xdb, 0x81, 0xf5, 0x4a, 0xff, 0x01, 0xed, 0x2a, 0xf4, 0xec, 0xc9, 0xfc, 0x81, 0xec, 
+  0xc9, 0xff, 0x00, 0xec, 0xa9, 0xf0, 0x82, 0xeb, 0xe9, 0xff, 0x01, 0xeb, 0xe9, 0xfc, 0xe3, 0x28, 0xf0, 0x81, 0xe3, 0x28, 0xff, 0x01, 0xe3, 0x28, 0xe3, 0xe2, 0x88, 0xfc, 0x82, 0xe2, 0x88, 0xff, 
+  0x01, 0xe2, 0x87, 0xff, 0xda, 0x69, 0xf3, 0x83, 0xda, 0x6a, 0xff, 0x00, 0xd2, 0x2b, 0xef, 0x82, 0xd2, 0x2c, 0xff, 0x00, 0xd2, 0x2c, 0xf8, 0x82, 0xca, 0x0e, 0xff, 0x00, 0xca, 0x0e, 0x8c, 0x85, 
+  0x00, 0x00, 0x00, 0x0a, 0xed, 0x2a, 0x50, 0xed, 0x2a, 0xfc, 0xed, 0x2a, 0xff, 0xf5, 0x4a, 0xf8, 0xf5, 0xca, 0xf0, 0xf5, 0xca, 0xfc, 0xf5, 0xca, 0xd8, 0xf5, 0xca, 0xff, 0xf5, 0xea, 0xfb, 0xf6, 
+  0x2a, 0xdf, 0xf6, 0x6b, 0xfc, 0x86, 0xf6, 0x6b, 0xff, 0x09, 0xf6, 0x4b, 0xf4, 0xf5, 0xea, 0xe8, 0xf5, 0xca, 0xfc, 0xf5, 0xca, 0xf4, 0xf5, 0xca, 0xf0, 0xf5, 0xaa, 0xfc, 0xf5, 0x4a, 0xeb, 0xf5, 
+  0x4a, 0xff, 0xf5, 0x6a, 0xf8, 0xec, 0xe9, 0xf4, 0x81, 0xec, 0xc9, 0xff, 0x01, 0xec, 0xc9, 0xfc, 0xec, 0x49, 0xeb, 0x81, 0xeb, 0xe9, 0xff, 0x01, 0xec, 0x09, 0xff, 0xeb, 0x88, 0xe4, 0x81, 0xe3, 
+  0x28, 0xff, 0x01, 0xe3, 0x48, 0xf4, 0xe2, 0xa8, 0xf7, 0x83, 0xe2, 0x88, 0xff, 0x00, 0xe2, 0x88, 0xdc, 0x83, 0xda, 0x6a, 0xff, 0x00, 0xda, 0x4b, 0xcf, 0x83, 0xd2, 0x2c, 0xff, 0x03, 0xca, 0x2e, 
+  0xe8, 0xca, 0x0e, 0xff, 0xca, 0x0e, 0xdf, 0xca, 0x0e, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x07, 0xed, 0x2a, 0x5c, 0xed, 0x2a, 0xff, 0xf5, 0xaa, 0xf0, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xec, 0xf5, 0xca, 
+  0xff, 0xf5, 0xeb, 0xef, 0xf6, 0x4b, 0xf4, 0x89, 0xf6, 0x6b, 0xff, 0x05, 0xf6, 0x6b, 0xfc, 0xf6, 0x2b, 0xf4, 0xf5, 0xca, 0xf4, 0xf5, 0xca, 0xf8, 0xf5, 0xca, 0xe8, 0xf5, 0xaa, 0xe8, 0x81, 0xf5, 
+  0x4a, 0xff, 0x01, 0xf5, 0x4a, 0xf4, 0xec, 0xc9, 0xf8, 0x81, 0xec, 0xc9, 0xff, 0x00, 0xec, 0x89, 0xe7, 0x82, 0xeb, 0xe9, 0xff, 0x01, 0xeb, 0xc8, 0xf8, 0xe3, 0x28, 0xf4, 0x81, 0xe3, 0x28, 0xff, 
+  0x00, 0xe3, 0x08, 0xcc, 0x83, 0xe2, 0x88, 0xff, 0x01, 0xe2, 0x88, 0xfb, 0xda, 0x6a, 0xfb, 0x82, 0xda, 0x6a, 0xff, 0x00, 0xda, 0x4a, 0xf3, 0x83, 0xd2, 0x2c, 0xff, 0x02, 0xd2, 0x2d, 0xdc, 0xca, 
+  0x0e, 0xdb, 0xca, 0x0e, 0x1c, 0x88, 0x00, 0x00, 0x00, 0x04, 0xf5, 0xaa, 0x57, 0xf5, 0xca, 0xf7, 0xf5, 0xca, 0xe7, 0xf5, 0xca, 0xff, 0xf5, 0xea, 0xe4, 0x8d, 0xf6, 0x6b, 0xff, 0x04, 0xf6, 0x4b, 
+  0xf0, 0xf5, 0xca, 0xf8, 0xf5, 0xca, 0xfb, 0xf5, 0xca, 0xf4, 0xf5, 0x6a, 0xd3, 0x81, 0xf5, 0x4a, 0xff, 0x00, 0xf5, 0x2a, 0xe4, 0x81, 0xec, 0xc9, 0xff, 0x01, 0xec, 0xc9, 0xf7, 0xec, 0x09, 0xfc, 
+  0x81, 0xeb, 0xe9, 0xff, 0x01, 0xeb, 0xe9, 0xf8, 0xe3, 0x48, 0xf7, 0x81, 0xe3, 0x28, 0xff, 0x00, 0xe3, 0x28, 0xf0, 0x84, 0xe2, 0x88, 0xff, 0x00, 0xda, 0x69, 0xe8, 0x83, 0xda, 0x6a, 0xff, 0x00, 
+  0xd2, 0x4c, 0xfb, 0x82, 0xd2, 0x2c, 0xff, 0x01, 0xd2, 0x2c, 0xcb, 0xca, 0x0f, 0x1b, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xf5, 0xaa, 0x2f, 0xf5, 0xca, 0xb0, 0xf5, 0xea, 0xf7, 0x8f, 0xf6, 0x6b, 0xff, 
+  0x07, 0xf6, 0x0b, 0xe3, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xef, 0xf5, 0xca, 0xff, 0xf5, 0x6a, 0xe0, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xf8, 0xec, 0xc9, 0xf7, 0x81, 0xec, 0xc9, 0xff, 0x00, 0xec, 0x69, 
+  0xdb, 0x82, 0xeb, 0xe9, 0xff, 0x00, 0xe3, 0x88, 0xec, 0x82, 0xe3, 0x28, 0xff, 0x00, 0xe2, 0xa8, 0xeb, 0x83, 0xe2, 0x88, 0xff, 0x00, 0xe2, 0x69, 0xe8, 0x82, 0xda, 0x6a, 0xff, 0x05, 0xda, 0x6a, 
+  0xfb, 0xd2, 0x4b, 0xec, 0xd2, 0x2c, 0xff, 0xd2, 0x2c, 0xfb, 0xd2, 0x2c, 0x7f, 0xda, 0x8c, 0x08, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xf5, 0xea, 0x03, 0xf6, 0x4b, 0x38, 0xf6, 0x6b, 0xcf, 0x8f, 0xf6, 
+  0x6b, 0xff, 0x06, 0xf5, 0xca, 0xd4, 0xf5, 0xca, 0xff, 0xf5, 0xca, 0xef, 0xf5, 0x8a, 0xf4, 0xf5, 0x4a, 0xff, 0xf5, 0x4a, 0xfc, 0xec, 0xe9, 0xfc, 0x81, 0xec, 0xc9, 0xff, 0x00, 0xec, 0xa9, 0xf4, 
+  0x82, 0xeb, 0xe9, 0xff, 0x00, 0xeb, 0xa8, 0xd8, 0x82, 0xe3, 0x28, 0xff, 0x00, 0xe2, 0xe8, 0xdb, 0x83, 0xe2, 0x88, 0xff, 0x00, 0xe2, 0x89, 0xff, 0x82, 0xda, 0x6a, 0xff, 0x03, 0xda, 0x6a, 0xfc, 
+  0xd2, 0x4b, 0xe4, 0xd2, 0x2c, 0x8b, 0xd2, 0x4b, 0x10, 0x91, 0x00, 0x00, 0x00, 0x05, 0xfe, 0x6b, 0x10, 0xf6, 0x6b, 0x50, 0xf6, 0x6b, 0x8c, 0xf6, 0x6b, 0xa8, 0xf6, 0x6b, 0xb3, 0xf6, 0x6b, 0xbc, 
+  0x81, 0xf6, 0x6b, 0xbf, 0x82, 0xf6, 0x6b, 0xc0, 0x83, 0xf6, 0x6b, 0xc3, 0x08, 0xf6, 0x6b, 0xc4, 0xf6, 0x4b, 0xbf, 0xf5, 0xca, 0xc3, 0xf5, 0xca, 0xa4, 0xf5, 0xaa, 0xb3, 0xf5, 0x4a, 0xbf, 0xf5, 
+  0x4a, 0xc3, 0xed, 0x0a, 0xb4, 0xec, 0xc9, 0xc7, 0x81, 0xec, 0xc9, 0xc4, 0x00, 0xec, 0x29, 0xb7, 0x81, 0xeb, 0xe9, 0xc4, 0x00, 0xeb, 0xe9, 0xbc, 0x82, 0xe3, 0x28, 0xc4, 0x00, 0xe3, 0x08, 0xb8, 
+  0x81, 0xe2, 0x88, 0xc4, 0x81, 0xe2, 0x88, 0xc3, 0x04, 0xe2, 0x89, 0xbc, 0xda, 0x6a, 0xb0, 0xda, 0x6a, 0xa4, 0xda, 0x6a, 0x78, 0xda, 0x6a, 0x43, 0x99, 0x00, 0x00, 0x00, 0x09, 0xf6, 0x6b, 0x04, 
+  0xf6, 0x8a, 0x07, 0xf6, 0x4b, 0x07, 0xf6, 0x6a, 0x07, 0xf6, 0x6b, 0x07, 0xf6, 0x6a, 0x07, 0xf6, 0x4b, 0x07, 0xf6, 0x6b, 0x07, 0xfe, 0x8b, 0x08, 0xf6, 0x4b, 0x08, 0x81, 0xf6, 0x6b, 0x08, 0x02, 
+  0xf6, 0x0b, 0x07, 0xed, 0xea, 0x08, 0xf5, 0xca, 0x07, 0x81, 0xed, 0x6a, 0x07, 0x00, 0xf5, 0x49, 0x08, 0x82, 0xec, 0xc9, 0x08, 0x0c, 0xec, 0x49, 0x08, 0xeb, 0xe8, 0x08, 0xec, 0x09, 0x08, 0xec, 
+  0x29, 0x08, 0xe3, 0x88, 0x08, 0xe3, 0x28, 0x08, 0xeb, 0x28, 0x08, 0xeb, 0x48, 0x08, 0xe3, 0x08, 0x08, 0xe2, 0xc8, 0x08, 0xe3, 0x08, 0x08, 0xeb, 0x08, 0x07, 0xea, 0xc8, 0x04, 0x8e, 0x00, 0x00, 
+  0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x63, 0x4b, 0x00, 0xcb, 0x62, 0x4b, 0x00, 0xca, 0x65, 0x4c, 0x00, 0xc7, 0x65, 0x4e, 0x00, 0xca, 0x67, 0x4b, 0x0c, 0xca, 0x64, 0x4b, 0x17, 0xca, 0x65, 0x4b, 0x1f, 0xca, 0x66, 0x4a, 0x24, 0xcb, 0x54, 0x53, 0x27, 0xcb, 0x54, 0x53, 0x28, 0xcd, 0x54, 0x53, 0x2b, 0xce, 0x56, 0x55, 0x2b, 0xc9, 0x54, 0x53, 0x2c, 0xca, 0x53, 0x52, 0x2c, 0xca, 0x53, 0x52, 0x2c, 0xcb, 0x56, 0x55, 0x2f, 0xcc, 0x54, 0x53, 0x2f, 0xcc, 0x54, 0x53, 0x2f, 0xcd, 0x52, 0x52, 0x2f, 0xc9, 0x56, 0x55, 0x30, 0xca, 0x56, 0x55, 0x2b, 0xc3, 0x42, 0x68, 0x34, 0xc3, 0x42, 0x68, 0x34, 0xc3, 0x42, 0x68, 0x34, 0xc3, 0x42, 0x68, 0x34, 0xc3, 0x42, 0x68, 0x34, 0xc3, 0x42, 0x68, 0x34, 0xc3, 0x42, 0x68, 0x34, 0xc3, 0x43, 0x67, 0x34, 0xc5, 0x40, 0x6a, 0x2f, 0xc7, 0x3c, 0x6d, 0x2f, 0xc8, 0x3c, 0x6d, 0x2f, 0xc9, 0x3b, 0x6d, 0x2c, 0xc7, 0x3c, 0x72, 0x2c, 0xc8, 0x3a, 0x70, 0x2b, 0xca, 0x3a, 0x70, 0x2b, 0xc8, 0x39, 0x72, 0x2b, 0xc5, 0x38, 0x76, 0x2c, 0xca, 0x35, 0x77, 0x2b, 0xc7, 0x36, 0x77, 0x2b, 0xc7, 0x36, 0x77, 0x27, 0xc7, 0x36, 0x77, 0x24, 0xc7, 0x36, 0x77, 0x23, 0xc7, 0x36, 0x77, 0x1c, 0xc7, 0x35, 0x77, 0x14, 0xcb, 0x37, 0x72, 0x04, 0xc9, 0x33, 0x78, 0x00, 0xc8, 0x34, 0x7a, 0x00, 0xbd, 0x38, 0x48, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x4d, 0x00, 0xcb, 0x66, 0x4c, 0x00, 0xba, 0x81, 0x4f, 0x00, 0xca, 0x65, 0x4c, 0x4f, 0xca, 0x66, 0x4b, 0x9f, 0xca, 0x65, 0x4b, 0xcf, 0xca, 0x65, 0x4b, 0xe3, 0xca, 0x66, 0x4b, 0xf7, 0xcb, 0x60, 0x4d, 0xeb, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x52, 0xff, 0xc8, 0x4c, 0x5e, 0xf0, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc6, 0x41, 0x6a, 0xe4, 0xc8, 0x3c, 0x6d, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xca, 0x3b, 0x6e, 0xff, 0xc9, 0x39, 0x71, 0xec, 0xc7, 0x37, 0x76, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xfc, 0xc7, 0x36, 0x77, 0xf0, 0xc7, 0x36, 0x77, 0xdc, 0xc7, 0x36, 0x77, 0xbc, 0xc6, 0x36, 0x76, 0x78, 0xca, 0x35, 0x74, 0x24, 0xbd, 0x31, 0x8c, 0x00, 0xc8, 0x2b, 0xa7, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x30, 0x1e, 0x00, 0xc6, 0x69, 0x47, 0x00, 0xc6, 0x5d, 0x4b, 0x00, 0xcb, 0x66, 0x4c, 0x37, 0xca, 0x65, 0x4b, 0xe7, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x61, 0x4d, 0xd4, 0xcb, 0x53, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcc, 0x54, 0x53, 0xf7, 0xc5, 0x47, 0x62, 0xe3, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xfb, 0xc7, 0x3e, 0x6c, 0xd8, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xfc, 0xc8, 0x38, 0x72, 0xef, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc8, 0x35, 0x77, 0xfc, 0xc2, 0x32, 0x87, 0xd4, 0xbd, 0x2f, 0x98, 0xa7, 0xc3, 0x2d, 0xa0, 0x0f, 0xd7, 0x00, 0xc6, 0x00, 0xbb, 0x33, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x64, 0x49, 0x00, 0xc8, 0x64, 0x47, 0x00, 0xcb, 0x65, 0x49, 0x10, 0xca, 0x65, 0x4b, 0xaf, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xc9, 0x66, 0x4a, 0xf0, 0xca, 0x5e, 0x4e, 0xef, 0xcb, 0x54, 0x53, 0xfb, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x55, 0x52, 0xfb, 0xc9, 0x4f, 0x59, 0xeb, 0xc4, 0x45, 0x65, 0xf7, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xfc, 0xc5, 0x41, 0x69, 0xec, 0xc8, 0x3c, 0x6d, 0xe3, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xfb, 0xc9, 0x3a, 0x71, 0xf4, 0xc7, 0x37, 0x76, 0xf3, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x75, 0xeb, 0xc3, 0x33, 0x85, 0xec, 0xbe, 0x30, 0x94, 0xec, 0xbd, 0x2f, 0x98, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xef, 0xbd, 0x30, 0x97, 0x58, 0xc5, 0x30, 0x8f, 0x00, 0xbe, 0x2f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x35, 0x24, 0x00, 0xc6, 0x65, 0x49, 0x00, 0xc4, 0x61, 0x45, 0x0b, 0xca, 0x65, 0x4b, 0xe0, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x64, 0x4b, 0xe3, 0xcb, 0x56, 0x51, 0xf8, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xe7, 0xc6, 0x47, 0x64, 0xf8, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x42, 0x66, 0xf3, 0xc8, 0x3c, 0x6d, 0xd3, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6f, 0xe4, 0xc7, 0x38, 0x75, 0xf8, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x76, 0xff, 0xc5, 0x35, 0x7d, 0xd8, 0xbe, 0x30, 0x94, 0xf3, 0xbd, 0x2f, 0x97, 0xfc, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbe, 0x2f, 0x97, 0x7f, 0xbd, 0x2f, 0x96, 0x00, 0xbc, 0x2f, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x68, 0x4d, 0x00, 0xc8, 0x66, 0x4b, 0x0f, 0xca, 0x66, 0x4b, 0xe8, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x65, 0x4b, 0xfb, 0xca, 0x62, 0x4c, 0xf8, 0xca, 0x5c, 0x4f, 0xdc, 0xcb, 0x53, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x52, 0xfc, 0xca, 0x52, 0x56, 0xfb, 0xc8, 0x4c, 0x5e, 0xdf, 0xc4, 0x42, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc5, 0x42, 0x68, 0xef, 0xc6, 0x3f, 0x6b, 0xe7, 0xc9, 0x3b, 0x6e, 0xf8, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xfb, 0xc9, 0x3a, 0x6f, 0xf8, 0xc8, 0x38, 0x72, 0xec, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x76, 0xf7, 0xc5, 0x35, 0x7e, 0xec, 0xc0, 0x31, 0x8d, 0xdf, 0xbc, 0x2f, 0x98, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x96, 0x6b, 0xb9, 0x29, 0x92, 0x00, 0xbb, 0x2d, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x4a, 0x00, 0xd1, 0x69, 0x47, 0x00, 0xca, 0x65, 0x4b, 0xa3, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x66, 0x4a, 0xf8, 0xca, 0x61, 0x4c, 0xd7, 0xcb, 0x58, 0x51, 0xfc, 0xcb, 0x54, 0x53, 0xfb, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcc, 0x55, 0x52, 0xff, 0xcb, 0x53, 0x56, 0xdc, 0xc6, 0x48, 0x62, 0xfc, 0xc4, 0x44, 0x66, 0xfb, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc5, 0x43, 0x68, 0xef, 0xc8, 0x3d, 0x6c, 0xeb, 0xc9, 0x3b, 0x6e, 0xf3, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6e, 0xff, 0xc9, 0x3b, 0x6f, 0xe7, 0xc8, 0x37, 0x75, 0xf7, 0xc7, 0x36, 0x77, 0xfb, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x77, 0xff, 0xc7, 0x36, 0x75, 0xff, 0xc5, 0x35, 0x7d, 0xdb, 0xbf, 0x30, 0x91, 0xf8, 0xbd, 0x2f, 0x96, 0xf8, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xfc, 0xbd, 0x2f, 0x97, 0x4c, 0xc2, 0x34, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xcc, 0x52, 0x52, 0x00, 0xcb, 0x64, 0x4b, 0x00, 0xcb, 0x65, 0x4a, 0x43, 0xca, 0x63, 0x4c, 0xff, 0xca, 0x5f, 0x4e, 0xd0, 0xca, 0x56, 0x52, 0xf3, 0xcb, 0x53, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xfc, 0xcb, 0x53, 0x54, 0xff, 0xca, 0x51, 0x58, 0xe3, 0xc5, 0x46, 0x63, 0xf0, 0xc4, 0x42, 0x68, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x42, 0x67, 0xff, 0xc4, 0x42, 0x66, 0xff, 0xc4, 0x42, 0x67, 0xff, 0xc4, 0x41, 0x67, 0xf8, 0xc8, 0x3c, 0x6c, 0xd8, 0xc9, 0x3a, 0x6e, 0xff, 0xc9, 0x3a, 0x6e, 0xff, 0xc9, 0x3a, 0x6e, 0xff, 0xc9, 0x39, 0x6d, 0xff, 0xc9, 0x39, 0x6d, 0xfc, 0xc8, 0x38, 0x6e, 0xf8, 0xc8, 0x36, 0x73, 0xf0, 0xc7, 0x33, 0x76, 0xff, 0xc7, 0x33, 0x76, 0xff, 0xc7, 0x34, 0x76, 0xff, 0xc7, 0x34, 0x76, 0xff, 0xc7, 0x34, 0x76, 0xff, 0xc7, 0x34, 0x76, 0xff, 0xc7, 0x34, 0x76, 0xff, 0xc7, 0x34, 0x76, 0xff, 0xc7, 0x35, 0x76, 0xff, 0xc7, 0x36, 0x76, 0xff, 0xc7, 0x36, 0x78, 0xfb, 0xc6, 0x35, 0x7c, 0xeb, 0xbf, 0x31, 0x8f, 0xe3, 0xbd, 0x2f, 0x98, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xd3, 0xbe, 0x32, 0x95, 0x07, 0xbc, 0x3c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xcd, 0x4f, 0x51, 0x00, 0xc9, 0x5c, 0x51, 0x00, 0xca, 0x57, 0x51, 0xdf, 0xcb, 0x54, 0x53, 0xf8, 0xcb, 0x53, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x55, 0x52, 0xff, 0xcb, 0x55, 0x52, 0xf0, 0xc9, 0x4f, 0x59, 0xec, 0xc6, 0x49, 0x61, 0xf4, 0xc5, 0x44, 0x65, 0xf7, 0xc4, 0x42, 0x68, 0xff, 0xc3, 0x41, 0x66, 0xff, 0xc2, 0x31, 0x5d, 0xff, 0xc0, 0x11, 0x54, 0xff, 0xc1, 0x0c, 0x56, 0xff, 0xc7, 0x38, 0x67, 0xf7, 0xcb, 0x4c, 0x74, 0xef, 0xc9, 0x2a, 0x6b, 0xd8, 0xcf, 0x3d, 0x79, 0xd0, 0xcd, 0x33, 0x75, 0xe0, 0xcc, 0x30, 0x73, 0xe3, 0xcc, 0x30, 0x74, 0xe3, 0xcd, 0x35, 0x76, 0xe3, 0xd6, 0x6b, 0x95, 0xdb, 0xd9, 0x7a, 0xa0, 0xd0, 0xd7, 0x77, 0xa0, 0xdf, 0xd8, 0x78, 0xa1, 0xe0, 0xd7, 0x78, 0xa1, 0xe0, 0xd7, 0x75, 0x9f, 0xe3, 0xd7, 0x71, 0x9f, 0xe3, 0xd6, 0x6f, 0x9c, 0xe3, 0xd5, 0x6b, 0x9b, 0xe4, 0xd4, 0x68, 0x98, 0xe7, 0xd3, 0x62, 0x95, 0xe8, 0xd1, 0x56, 0x8e, 0xec, 0xcf, 0x48, 0x89, 0xdf, 0xc5, 0x0f, 0x8a, 0xf0, 0xba, 0x00, 0x86, 0xec, 0xb9, 0x00, 0x90, 0xff, 0xbb, 0x20, 0x94, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbf, 0x31, 0x93, 0x57, 0xbe, 0x30, 0x92, 0x00, 0x68, 0x00, 0x68, 0x00, 
-  0xcb, 0x55, 0x53, 0x00, 0xcb, 0x55, 0x53, 0x44, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xca, 0x52, 0x54, 0xe3, 0xc7, 0x4b, 0x60, 0xe4, 0xc5, 0x42, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x44, 0x68, 0xff, 0xcb, 0x5c, 0x7a, 0xf4, 0xea, 0xbc, 0xc9, 0xcf, 0xfc, 0xf3, 0xf6, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xf4, 0xf4, 0xdc, 0xed, 0xd7, 0xda, 0x8c, 0xc5, 0xe0, 0xbe, 0x32, 0x99, 0xff, 0xbd, 0x30, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xb9, 0x30, 0x9a, 0xe0, 0xad, 0x34, 0xae, 0xe0, 0xb1, 0x37, 0xb2, 0x00, 0x85, 0x0c, 0x86, 0x00, 
-  0xcf, 0x55, 0x52, 0x00, 0xcc, 0x54, 0x53, 0xa3, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x53, 0xff, 0xcb, 0x54, 0x52, 0xff, 0xcb, 0x55, 0x52, 0xfb, 0xcb, 0x53, 0x54, 0xeb, 0xc9, 0x4e, 0x5a, 0xfb, 0xc7, 0x4a, 0x5f, 0xe4, 0xc5, 0x44, 0x65, 0xf0, 0xc4, 0x42, 0x68, 0xff, 0xc4, 0x42, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc3, 0x41, 0x66, 0xff, 0xc4, 0x35, 0x62, 0xfb, 0xde, 0xa6, 0xb3, 0xf0, 0xfa, 0xea, 0xee, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xeb, 0xc9, 0xe1, 0xec, 0xcc, 0x77, 0xb1, 0xf4, 0xbb, 0x0b, 0x93, 0xff, 0xbd, 0x30, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbe, 0x2f, 0x96, 0xff, 0xbc, 0x2f, 0x98, 0xef, 0xb6, 0x32, 0xa2, 0xf0, 0xae, 0x34, 0xab, 0xe4, 0xa9, 0x35, 0xb1, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xac, 0x36, 0xb0, 0x33, 0xab, 0x36, 0xb0, 0x00, 
-  0xcb, 0x55, 0x54, 0x0b, 0xcb, 0x54, 0x53, 0xcc, 0xcb, 0x55, 0x52, 0xff, 0xcc, 0x54, 0x53, 0xe7, 0xc8, 0x4c, 0x5c, 0xdf, 0xc4, 0x46, 0x64, 0xff, 0xc4, 0x44, 0x66, 0xfb, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc3, 0x40, 0x65, 0xff, 0xc9, 0x3c, 0x6c, 0xe8, 0xfc, 0xf6, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xea, 0xc0, 0xde, 0xdb, 0xb9, 0x00, 0x8f, 0xff, 0xbd, 0x30, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbe, 0x2f, 0x96, 0xff, 0xbc, 0x30, 0x98, 0xe0, 0xb0, 0x33, 0xa8, 0xf4, 0xab, 0x35, 0xaf, 0xfb, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x36, 0xb1, 0x78, 0xaa, 0x36, 0xb1, 0x00, 
-  0xca, 0x4c, 0x5f, 0x17, 0xc8, 0x4b, 0x5f, 0xc8, 0xc5, 0x46, 0x66, 0xf8, 0xc3, 0x42, 0x68, 0xff, 0xc4, 0x42, 0x68, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x40, 0x65, 0xff, 0xd0, 0x72, 0x8a, 0xec, 0xfd, 0xf8, 0xfa, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfc, 0xf6, 0xfa, 0xff, 0xfa, 0xf1, 0xf6, 0xff, 0xf9, 0xef, 0xf5, 0xff, 0xf8, 0xee, 0xf3, 0xff, 0xf7, 0xed, 0xf2, 0xff, 0xf7, 0xec, 0xf2, 0xff, 0xf7, 0xec, 0xf2, 0xff, 0xf6, 0xeb, 0xf1, 0xff, 0xf7, 0xec, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf6, 0xeb, 0xf3, 0xff, 0xf7, 0xec, 0xf4, 0xff, 0xf7, 0xed, 0xf5, 0xff, 0xf8, 0xef, 0xf6, 0xff, 0xfa, 0xf2, 0xf8, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xd6, 0xe8, 0xe4, 0xbf, 0x37, 0x9a, 0xfc, 0xbc, 0x30, 0x98, 0xf4, 0xb8, 0x30, 0x9d, 0xef, 0xae, 0x34, 0xa8, 0xe3, 0xa9, 0x35, 0xb2, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xa7, 0xad, 0x36, 0xb2, 0x00, 
-  0xc5, 0x43, 0x67, 0x1f, 0xc4, 0x43, 0x67, 0xf4, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc5, 0x43, 0x66, 0xff, 0xc4, 0x44, 0x66, 0xff, 0xc0, 0x3f, 0x6c, 0xe7, 0xc4, 0x3b, 0x7b, 0xd7, 0xfe, 0xf9, 0xfa, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xc9, 0xdd, 0xff, 0xd5, 0x9c, 0xba, 0xff, 0xca, 0x87, 0xa8, 0xff, 0xc6, 0x73, 0x9f, 0xff, 0xc2, 0x62, 0x97, 0xff, 0xc0, 0x5a, 0x93, 0xff, 0xbf, 0x54, 0x90, 0xff, 0xc2, 0x57, 0x94, 0xff, 0xc8, 0x65, 0xa1, 0xff, 0xc2, 0x56, 0x9e, 0xff, 0xbb, 0x47, 0x99, 0xff, 0xbc, 0x4c, 0x9d, 0xff, 0xbb, 0x47, 0x9d, 0xff, 0xbb, 0x46, 0x9d, 0xff, 0xbb, 0x46, 0x9d, 0xff, 0xbb, 0x46, 0x9d, 0xff, 0xbb, 0x46, 0x9c, 0xff, 0xba, 0x45, 0x9b, 0xff, 0xba, 0x45, 0x9b, 0xff, 0xbb, 0x47, 0x9c, 0xff, 0xc0, 0x54, 0xa8, 0xff, 0xc6, 0x64, 0xb3, 0xff, 0xc6, 0x66, 0xb4, 0xff, 0xc0, 0x64, 0xb0, 0xff, 0xc5, 0x79, 0xb8, 0xff, 0xcc, 0x91, 0xc0, 0xff, 0xdc, 0xa8, 0xd3, 0xff, 0xf7, 0xe7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xd7, 0xea, 0xdf, 0xa6, 0x00, 0xa7, 0xf7, 0xaa, 0x36, 0xb1, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xb8, 0xa5, 0x39, 0xac, 0x03, 
-  0xc3, 0x43, 0x66, 0x23, 0xc4, 0x43, 0x67, 0xfb, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc4, 0x43, 0x68, 0xfb, 0xc4, 0x43, 0x68, 0xff, 0xc0, 0x40, 0x6e, 0xec, 0xbc, 0x3c, 0x78, 0xd7, 0xb9, 0x3b, 0x7b, 0xfc, 0xb9, 0x27, 0x78, 0xff, 0xfa, 0xf1, 0xf6, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe8, 0xf0, 0xff, 0xc2, 0x4c, 0x94, 0xff, 0xb4, 0x27, 0x7c, 0xff, 0xb7, 0x37, 0x81, 0xff, 0xb8, 0x3b, 0x84, 0xff, 0xb7, 0x3a, 0x84, 0xff, 0xba, 0x40, 0x89, 0xff, 0xc2, 0x57, 0x9b, 0xff, 0xbb, 0x48, 0x99, 0xff, 0xb4, 0x32, 0x93, 0xff, 0xb3, 0x30, 0x92, 0xff, 0xb4, 0x32, 0x93, 0xff, 0xb4, 0x33, 0x93, 0xff, 0xb5, 0x35, 0x94, 0xff, 0xb5, 0x36, 0x94, 0xff, 0xb5, 0x37, 0x95, 0xff, 0xb5, 0x37, 0x95, 0xff, 0xb4, 0x33, 0x95, 0xff, 0xb9, 0x40, 0x9e, 0xff, 0xc1, 0x58, 0xae, 0xff, 0xbf, 0x51, 0xae, 0xff, 0xb4, 0x32, 0xa2, 0xff, 0xb3, 0x2f, 0xa0, 0xff, 0xb2, 0x2d, 0x9f, 0xff, 0xb2, 0x2e, 0x9f, 0xff, 0xb3, 0x30, 0xa0, 0xff, 0xb3, 0x30, 0xa0, 0xff, 0xb3, 0x30, 0xa0, 0xff, 0xb2, 0x2a, 0x9e, 0xff, 0xb1, 0x08, 0x9d, 0xff, 0xda, 0xa2, 0xd1, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x95, 0xd5, 0xe0, 0xa8, 0x27, 0xae, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc3, 0xaa, 0x37, 0xb3, 0x08, 
-  0xc3, 0x42, 0x67, 0x24, 0xc4, 0x43, 0x67, 0xff, 0xc1, 0x41, 0x6c, 0xe7, 0xbf, 0x3f, 0x71, 0xeb, 0xbe, 0x3e, 0x74, 0xfb, 0xbb, 0x3b, 0x79, 0xe8, 0xba, 0x3b, 0x7c, 0xf7, 0xba, 0x3b, 0x7c, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xd7, 0xa0, 0xb7, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xc6, 0xd6, 0xff, 0xb7, 0x22, 0x7f, 0xff, 0xbe, 0x4b, 0x8e, 0xff, 0xbb, 0x44, 0x8f, 0xff, 0xb5, 0x35, 0x8b, 0xff, 0xba, 0x45, 0x96, 0xff, 0xb8, 0x3d, 0x95, 0xff, 0xb4, 0x30, 0x92, 0xff, 0xb7, 0x38, 0x96, 0xff, 0xba, 0x47, 0x9d, 0xff, 0xb8, 0x48, 0x9e, 0xff, 0xb4, 0x40, 0x9b, 0xff, 0xae, 0x35, 0x97, 0xff, 0xad, 0x37, 0x98, 0xff, 0xb0, 0x41, 0x9d, 0xff, 0xb0, 0x45, 0x9f, 0xff, 0xb1, 0x49, 0xa1, 0xff, 0xb2, 0x48, 0xa4, 0xff, 0xad, 0x34, 0x9f, 0xff, 0xb4, 0x42, 0xa4, 0xff, 0xb9, 0x45, 0xa8, 0xff, 0xb8, 0x41, 0xa7, 0xff, 0xba, 0x45, 0xaa, 0xff, 0xba, 0x46, 0xab, 0xff, 0xb9, 0x46, 0xac, 0xff, 0xb7, 0x43, 0xac, 0xff, 0xb5, 0x40, 0xaa, 0xff, 0xb4, 0x3b, 0xa9, 0xff, 0xb2, 0x37, 0xa7, 0xff, 0xb2, 0x37, 0xa7, 0xff, 0xb2, 0x37, 0xa8, 0xff, 0xaf, 0x12, 0xa3, 0xff, 0xcd, 0x85, 0xc7, 0xff, 0xf7, 0xed, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xfd, 0xfb, 0xb2, 0x48, 0xb7, 0xf3, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc7, 0xaa, 0x36, 0xae, 0x08, 
-  0xba, 0x3b, 0x7b, 0x24, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3c, 0x7b, 0xff, 0xf7, 0xe5, 0xee, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xee, 0xf5, 0xff, 0xbe, 0x43, 0x9a, 0xff, 0xb4, 0x33, 0x92, 0xff, 0xb4, 0x33, 0x93, 0xff, 0xb4, 0x33, 0x92, 0xff, 0xbd, 0x4d, 0xa1, 0xff, 0xbe, 0x57, 0xa7, 0xff, 0xb6, 0x4b, 0xa2, 0xff, 0xa8, 0x38, 0x9a, 0xff, 0xa5, 0x36, 0x9a, 0xff, 0xa6, 0x37, 0x9a, 0xff, 0xa5, 0x37, 0x9a, 0xff, 0xa5, 0x36, 0x9a, 0xff, 0xa5, 0x36, 0x9a, 0xff, 0xa5, 0x36, 0x9a, 0xff, 0xa5, 0x36, 0x9a, 0xff, 0xa5, 0x35, 0x9a, 0xff, 0xa5, 0x35, 0x99, 0xff, 0xa5, 0x34, 0x9a, 0xff, 0xb4, 0x52, 0xae, 0xff, 0xb7, 0x55, 0xb8, 0xff, 0xaa, 0x35, 0xae, 0xff, 0xaa, 0x33, 0xae, 0xff, 0xaa, 0x33, 0xae, 0xff, 0xaa, 0x33, 0xae, 0xff, 0xaa, 0x33, 0xae, 0xff, 0xaa, 0x34, 0xae, 0xff, 0xaa, 0x34, 0xae, 0xff, 0xa9, 0x2c, 0xad, 0xff, 0xb1, 0x3f, 0xb4, 0xff, 0xb1, 0x40, 0xb5, 0xff, 0xa8, 0x28, 0xac, 0xff, 0xaa, 0x34, 0xae, 0xff, 0xaa, 0x33, 0xae, 0xff, 0xc8, 0x8b, 0xca, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd2, 0xac, 0xd5, 0xf8, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc7, 0xa8, 0x35, 0xb0, 0x08, 
-  0xba, 0x3b, 0x7b, 0x27, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7b, 0xff, 0xba, 0x3b, 0x7a, 0xff, 0xba, 0x3b, 0x7b, 0xf0, 0xb8, 0x3b, 0x7e, 0xec, 0xb5, 0x3a, 0x81, 0xfc, 0xb3, 0x37, 0x84, 0xe7, 0xb9, 0x50, 0x97, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x54, 0xa9, 0xff, 0xaf, 0x31, 0x96, 0xff, 0xb5, 0x4b, 0xa2, 0xff, 0xb1, 0x4a, 0xa3, 0xff, 0xa5, 0x37, 0x9b, 0xff, 0xa3, 0x34, 0x99, 0xff, 0xa3, 0x33, 0x99, 0xff, 0xa4, 0x33, 0x99, 0xff, 0xa4, 0x34, 0x99, 0xff, 0xa5, 0x34, 0x98, 0xff, 0xa5, 0x35, 0x99, 0xff, 0xa8, 0x3d, 0x9e, 0xff, 0xab, 0x48, 0xa5, 0xff, 0xab, 0x4a, 0xa8, 0xff, 0xa7, 0x43, 0xa6, 0xff, 0xa2, 0x39, 0xa5, 0xff, 0xa8, 0x4a, 0xb1, 0xff, 0xac, 0x50, 0xb8, 0xff, 0xa9, 0x48, 0xb7, 0xff, 0xa9, 0x47, 0xb6, 0xff, 0xa9, 0x4b, 0xb7, 0xff, 0xa9, 0x4b, 0xb7, 0xff, 0xa9, 0x4b, 0xb7, 0xff, 0xa9, 0x49, 0xb6, 0xff, 0xa9, 0x48, 0xb6, 0xff, 0xa8, 0x43, 0xb5, 0xff, 0xa5, 0x39, 0xb0, 0xff, 0xaf, 0x5a, 0xb8, 0xff, 0xf0, 0xda, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe4, 0xf4, 0xff, 0xb4, 0x5d, 0xb7, 0xff, 0xaa, 0x33, 0xae, 0xff, 0xa6, 0x00, 0xaa, 0xff, 0xea, 0xd3, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xde, 0xf2, 0xe7, 0xaa, 0x36, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc7, 0xaa, 0x33, 0xb2, 0x0b, 
-  0xba, 0x3b, 0x7a, 0x27, 0xbb, 0x3b, 0x7a, 0xff, 0xbb, 0x3b, 0x7a, 0xeb, 0xb6, 0x3a, 0x80, 0xd3, 0xb0, 0x39, 0x8a, 0xf7, 0xad, 0x38, 0x8d, 0xfb, 0xac, 0x38, 0x8e, 0xf8, 0xab, 0x38, 0x8f, 0xff, 0xa8, 0x25, 0x8a, 0xff, 0xda, 0xab, 0xcf, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xd1, 0xe8, 0xff, 0xa1, 0x21, 0x96, 0xff, 0xa5, 0x36, 0x9a, 0xff, 0xa5, 0x35, 0x9a, 0xff, 0xa5, 0x35, 0x99, 0xff, 0xa4, 0x33, 0x98, 0xff, 0xa5, 0x33, 0x98, 0xff, 0xa5, 0x34, 0x98, 0xff, 0xa9, 0x42, 0xa3, 0xff, 0xb1, 0x57, 0xb3, 0xff, 0xad, 0x55, 0xb6, 0xff, 0xa2, 0x40, 0xb0, 0xff, 0x9e, 0x38, 0xae, 0xff, 0x9f, 0x3d, 0xb0, 0xff, 0x9e, 0x3e, 0xb1, 0xff, 0x9d, 0x3a, 0xb1, 0xff, 0x9a, 0x34, 0xaf, 0xff, 0x9a, 0x33, 0xae, 0xff, 0x9a, 0x32, 0xae, 0xff, 0x9a, 0x32, 0xae, 0xff, 0x9a, 0x33, 0xae, 0xff, 0x9a, 0x34, 0xae, 0xff, 0x9b, 0x35, 0xaf, 0xff, 0x9a, 0x35, 0xaf, 0xff, 0x9a, 0x34, 0xae, 0xff, 0x9a, 0x33, 0xae, 0xff, 0x9a, 0x34, 0xae, 0xff, 0x9a, 0x32, 0xae, 0xff, 0xd6, 0xbd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xb7, 0xdf, 0xff, 0xa9, 0x31, 0xad, 0xff, 0xa9, 0x2e, 0xad, 0xff, 0xba, 0x53, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaa, 0x36, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc7, 0xab, 0x33, 0xb3, 0x0b, 
-  0xb1, 0x39, 0x87, 0x20, 0xad, 0x39, 0x8a, 0xf3, 0xaa, 0x38, 0x8f, 0xff, 0xaa, 0x38, 0x90, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xa5, 0x00, 0x85, 0xff, 0xf7, 0xed, 0xf5, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xa0, 0xc9, 0xff, 0xa5, 0x38, 0x9c, 0xff, 0xa7, 0x40, 0xa0, 0xff, 0xa4, 0x3c, 0x9f, 0xff, 0xa3, 0x3e, 0xa2, 0xff, 0xa9, 0x57, 0xb2, 0xff, 0xa5, 0x58, 0xb6, 0xff, 0x9a, 0x47, 0xb1, 0xff, 0x97, 0x3d, 0xaf, 0xff, 0x94, 0x37, 0xab, 0xff, 0x92, 0x35, 0xaa, 0xff, 0x94, 0x39, 0xab, 0xff, 0x97, 0x3d, 0xad, 0xff, 0x9a, 0x43, 0xaf, 0xff, 0x9e, 0x48, 0xb3, 0xff, 0x9e, 0x43, 0xb3, 0xff, 0xa9, 0x5b, 0xbb, 0xff, 0xb3, 0x75, 0xc3, 0xff, 0xb8, 0x7d, 0xc6, 0xff, 0xb7, 0x7a, 0xc6, 0xff, 0xb4, 0x71, 0xc4, 0xff, 0x9f, 0x41, 0xb8, 0xff, 0x95, 0x2c, 0xb1, 0xff, 0x9c, 0x3f, 0xb6, 0xff, 0xa0, 0x47, 0xb9, 0xff, 0xa3, 0x4e, 0xbc, 0xff, 0xa2, 0x4d, 0xbb, 0xff, 0xa4, 0x51, 0xbc, 0xff, 0xe8, 0xd6, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xdc, 0xf2, 0xff, 0xab, 0x30, 0xae, 0xff, 0xaa, 0x32, 0xae, 0xff, 0xa4, 0x00, 0xa9, 0xff, 0xf9, 0xef, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x67, 0xc4, 0xf8, 0xa9, 0x30, 0xaf, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc8, 0xa8, 0x37, 0xae, 0x0b, 
-  0xab, 0x38, 0x8f, 0x28, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xac, 0x38, 0x8e, 0xff, 0xac, 0x38, 0x8d, 0xff, 0xa6, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xb8, 0x8a, 0xc0, 0xff, 0x9b, 0x40, 0xaa, 0xff, 0x9c, 0x49, 0xaf, 0xff, 0x97, 0x41, 0xae, 0xff, 0x92, 0x37, 0xaa, 0xff, 0x92, 0x36, 0xaa, 0xff, 0x92, 0x36, 0xa9, 0xff, 0x93, 0x37, 0xaa, 0xff, 0x93, 0x37, 0xa9, 0xff, 0x93, 0x35, 0xa8, 0xff, 0x93, 0x35, 0xa8, 0xff, 0x94, 0x37, 0xa8, 0xff, 0x91, 0x35, 0xa9, 0xff, 0x8a, 0x00, 0xaa, 0xff, 0xc2, 0x98, 0xce, 0xff, 0xe2, 0xd7, 0xe8, 0xff, 0xef, 0xe5, 0xf2, 0xff, 0xf8, 0xf2, 0xf9, 0xff, 0xfa, 0xf6, 0xfb, 0xff, 0xfa, 0xf5, 0xfb, 0xff, 0xf6, 0xef, 0xf9, 0xff, 0xe6, 0xdd, 0xf1, 0xff, 0xd4, 0xc1, 0xe6, 0xff, 0x96, 0x4b, 0xc8, 0xff, 0x80, 0x1f, 0xbd, 0xff, 0x88, 0x3c, 0xc0, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0x88, 0x3a, 0xc0, 0xff, 0xd4, 0xc3, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xbe, 0xe5, 0xff, 0x9c, 0x42, 0xbd, 0xff, 0xb1, 0x41, 0xb2, 0xff, 0xa8, 0x25, 0xac, 0xff, 0xe4, 0xc1, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x94, 0xd6, 0xdc, 0xa7, 0x27, 0xad, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc8, 0xaa, 0x36, 0xb0, 0x0b, 
-  0xab, 0x38, 0x8f, 0x28, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xab, 0x38, 0x8f, 0xff, 0xaa, 0x38, 0x90, 0xfc, 0xaa, 0x38, 0x91, 0xff, 0xa2, 0x39, 0x9a, 0xf4, 0x96, 0x39, 0xa6, 0xdb, 0x8d, 0x01, 0xac, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0xfc, 0xff, 0xac, 0x75, 0xbd, 0xff, 0x93, 0x38, 0xaa, 0xff, 0x93, 0x38, 0xaa, 0xff, 0x93, 0x38, 0xaa, 0xff, 0x93, 0x39, 0xab, 0xff, 0x93, 0x3a, 0xab, 0xff, 0x93, 0x39, 0xab, 0xff, 0x90, 0x38, 0xac, 0xff, 0x8e, 0x3d, 0xb1, 0xff, 0x94, 0x52, 0xbe, 0xff, 0x90, 0x52, 0xc2, 0xff, 0x85, 0x47, 0xc1, 0xff, 0x98, 0x65, 0xcb, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xb6, 0xe7, 0xff, 0x8a, 0x41, 0xc0, 0xff, 0x89, 0x3b, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x8d, 0x33, 0xc4, 0xff, 0xf6, 0xf2, 0xfa, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xf3, 0xee, 0xf9, 0xff, 0x98, 0x54, 0xc8, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x9c, 0x4d, 0xc2, 0xff, 0xa9, 0x34, 0xaf, 0xff, 0xd9, 0xab, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xb5, 0xe1, 0xd8, 0xa6, 0x1a, 0xad, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc8, 0xaa, 0x36, 0xb0, 0x0b, 
-  0xa9, 0x38, 0x92, 0x24, 0xa6, 0x38, 0x95, 0xef, 0xa0, 0x38, 0x9c, 0xf0, 0x9b, 0x39, 0xa1, 0xfc, 0x93, 0x39, 0xa9, 0xeb, 0x8f, 0x39, 0xad, 0xf4, 0x8f, 0x39, 0xad, 0xff, 0x8f, 0x38, 0xac, 0xff, 0x94, 0x2a, 0xb0, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf2, 0xf9, 0xff, 0xa7, 0x69, 0xbb, 0xff, 0x98, 0x4b, 0xb5, 0xff, 0x92, 0x49, 0xb7, 0xff, 0x88, 0x3b, 0xb4, 0xff, 0x89, 0x43, 0xba, 0xff, 0x8a, 0x4d, 0xc0, 0xff, 0x84, 0x47, 0xc0, 0xff, 0x7d, 0x3e, 0xbe, 0xff, 0x7d, 0x3d, 0xbe, 0xff, 0x7d, 0x3d, 0xbd, 0xff, 0x70, 0x00, 0xb8, 0xff, 0xd0, 0xc0, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf1, 0xfb, 0xff, 0xa8, 0x78, 0xd0, 0xff, 0x86, 0x36, 0xbf, 0xff, 0x88, 0x3c, 0xc0, 0xff, 0x82, 0x00, 0xbd, 0xff, 0xb5, 0x8d, 0xd6, 0xff, 0xb7, 0x91, 0xd7, 0xff, 0x84, 0x0b, 0xbf, 0xff, 0x87, 0x38, 0xbf, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x86, 0x3a, 0xc0, 0xff, 0x95, 0x49, 0xc2, 0xff, 0xce, 0xa6, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xd2, 0xee, 0xdc, 0xa5, 0x00, 0xab, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc8, 0xaa, 0x34, 0xb0, 0x0b, 
-  0x91, 0x39, 0xab, 0x27, 0x91, 0x39, 0xab, 0xff, 0x90, 0x39, 0xac, 0xfc, 0x90, 0x39, 0xac, 0xff, 0x90, 0x39, 0xac, 0xff, 0x90, 0x39, 0xac, 0xff, 0x90, 0x39, 0xac, 0xff, 0x90, 0x38, 0xac, 0xff, 0x99, 0x3f, 0xb3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xef, 0xf9, 0xff, 0x92, 0x5e, 0xc5, 0xff, 0x80, 0x3f, 0xbd, 0xff, 0x7f, 0x3f, 0xbd, 0xff, 0x7e, 0x3d, 0xbd, 0xff, 0x7e, 0x3d, 0xbd, 0xff, 0x7e, 0x3d, 0xbd, 0xff, 0x7e, 0x3d, 0xbd, 0xff, 0x7e, 0x3d, 0xbd, 0xff, 0x7e, 0x3d, 0xbd, 0xff, 0x73, 0x00, 0xba, 0xff, 0xe9, 0xe2, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x5a, 0xcd, 0xff, 0x87, 0x37, 0xbf, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3b, 0xc0, 0xff, 0x89, 0x3b, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x88, 0x3a, 0xbf, 0xff, 0xc0, 0xa1, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xde, 0xf2, 0xdb, 0xa4, 0x00, 0xab, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc8, 0xa9, 0x34, 0xaf, 0x0b, 
-  0x90, 0x39, 0xac, 0x28, 0x90, 0x39, 0xac, 0xff, 0x90, 0x39, 0xac, 0xff, 0x90, 0x39, 0xac, 0xff, 0x90, 0x39, 0xac, 0xff, 0x91, 0x39, 0xab, 0xff, 0x91, 0x39, 0xac, 0xff, 0x8d, 0x38, 0xae, 0xf7, 0x9e, 0x56, 0xbd, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xee, 0xf9, 0xff, 0x8f, 0x5b, 0xc5, 0xff, 0x7e, 0x3d, 0xbd, 0xff, 0x7e, 0x3c, 0xbd, 0xff, 0x7d, 0x3b, 0xbc, 0xff, 0x7e, 0x3b, 0xbc, 0xff, 0x7f, 0x3c, 0xbc, 0xff, 0x81, 0x3f, 0xbd, 0xff, 0x85, 0x49, 0xc1, 0xff, 0x83, 0x4d, 0xc3, 0xff, 0xd3, 0xc5, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xe6, 0xf8, 0xff, 0xc7, 0xbd, 0xea, 0xff, 0x98, 0x83, 0xde, 0xff, 0x7d, 0x5d, 0xd6, 0xff, 0x86, 0x6a, 0xd9, 0xff, 0xa5, 0x93, 0xe1, 0xff, 0xda, 0xd5, 0xf1, 0xff, 0xf6, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x72, 0xce, 0xff, 0x88, 0x3a, 0xbf, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x88, 0x3a, 0xc0, 0xff, 0xbd, 0x9e, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe6, 0xf5, 0xd8, 0xa4, 0x00, 0xab, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc8, 0xaa, 0x33, 0xb0, 0x0b, 
-  0x90, 0x39, 0xac, 0x28, 0x90, 0x39, 0xac, 0xff, 0x91, 0x39, 0xab, 0xff, 0x91, 0x39, 0xab, 0xff, 0x8a, 0x3a, 0xb1, 0xeb, 0x7f, 0x3c, 0xb9, 0xdb, 0x7a, 0x3e, 0xbe, 0xfb, 0x76, 0x3d, 0xc0, 0xfb, 0x94, 0x6a, 0xcf, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xec, 0xf8, 0xff, 0x8b, 0x51, 0xc2, 0xff, 0x80, 0x3c, 0xbb, 0xff, 0x87, 0x48, 0xbf, 0xff, 0x8d, 0x5b, 0xc8, 0xff, 0x82, 0x5a, 0xcd, 0xff, 0x6c, 0x49, 0xce, 0xff, 0x62, 0x47, 0xd1, 0xff, 0x65, 0x4c, 0xd3, 0xff, 0x80, 0x6d, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xa1, 0xe3, 0xff, 0x72, 0x53, 0xd1, 0xff, 0x60, 0x39, 0xcd, 0xff, 0x63, 0x40, 0xcd, 0xff, 0x65, 0x42, 0xce, 0xff, 0x64, 0x41, 0xce, 0xff, 0x63, 0x3e, 0xcd, 0xff, 0x61, 0x39, 0xcd, 0xff, 0x83, 0x6d, 0xd5, 0xff, 0xd7, 0xcf, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xdc, 0xf4, 0xff, 0x8f, 0x5e, 0xce, 0xff, 0x88, 0x38, 0xbf, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0xbb, 0x9c, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe9, 0xf7, 0xdb, 0xa4, 0x00, 0xaa, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xc8, 0xab, 0x36, 0xb1, 0x0b, 
-  0x8e, 0x3a, 0xaf, 0x28, 0x89, 0x3a, 0xb1, 0xff, 0x7b, 0x3d, 0xbb, 0xd7, 0x73, 0x3f, 0xc3, 0xec, 0x73, 0x3f, 0xc3, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x73, 0x3d, 0xc2, 0xff, 0x94, 0x6c, 0xd0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xed, 0xf9, 0xff, 0x87, 0x68, 0xd6, 0xff, 0x61, 0x4b, 0xd4, 0xff, 0x55, 0x48, 0xd6, 0xff, 0x55, 0x46, 0xd6, 0xff, 0x56, 0x46, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x3f, 0x1d, 0xd2, 0xff, 0xee, 0xec, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x84, 0xdf, 0xff, 0x5c, 0x33, 0xcc, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x60, 0x31, 0xce, 0xff, 0xde, 0xd8, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x75, 0xd4, 0xff, 0x80, 0x4b, 0xca, 0xff, 0x8a, 0x43, 0xc2, 0xff, 0x89, 0x3b, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0xba, 0x9b, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xea, 0xf7, 0xdf, 0xa0, 0x00, 0xac, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcb, 0xa8, 0x35, 0xae, 0x0b, 
-  0x73, 0x3f, 0xc3, 0x27, 0x73, 0x3f, 0xc3, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3d, 0xc1, 0xff, 0x97, 0x6e, 0xcf, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfa, 0xff, 0x6b, 0x5d, 0xd9, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x56, 0x44, 0xd5, 0xff, 0x91, 0x87, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xa7, 0xe8, 0xff, 0x59, 0x3d, 0xd0, 0xff, 0x79, 0x5f, 0xd5, 0xff, 0x69, 0x46, 0xce, 0xff, 0x64, 0x41, 0xcd, 0xff, 0x66, 0x43, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x65, 0x43, 0xce, 0xff, 0x5e, 0x2c, 0xce, 0xff, 0xe9, 0xe4, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xee, 0xfb, 0xff, 0x61, 0x00, 0xc3, 0xff, 0x7d, 0x49, 0xca, 0xff, 0x8f, 0x54, 0xc8, 0xff, 0x88, 0x39, 0xbf, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0xba, 0x9b, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xeb, 0xf8, 0xe4, 0x87, 0x00, 0xb7, 0xeb, 0xa9, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcb, 0xa9, 0x35, 0xaf, 0x0b, 
-  0x74, 0x3f, 0xc2, 0x28, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xff, 0x74, 0x3f, 0xc2, 0xfc, 0x6f, 0x40, 0xc5, 0xd7, 0x5f, 0x43, 0xce, 0xdb, 0x7e, 0x73, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfa, 0xff, 0x6c, 0x5e, 0xd9, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x51, 0x3e, 0xd4, 0xff, 0xd6, 0xd4, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe7, 0xf9, 0xff, 0x65, 0x57, 0xd8, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x59, 0x47, 0xd5, 0xff, 0x7c, 0x65, 0xd9, 0xff, 0x6c, 0x4b, 0xd0, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x94, 0x83, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x5b, 0xd2, 0xff, 0x74, 0x3f, 0xc8, 0xff, 0x78, 0x46, 0xc9, 0xff, 0x8b, 0x4e, 0xc7, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0xba, 0x9a, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xed, 0xf7, 0xe8, 0x82, 0x00, 0xba, 0xff, 0x93, 0x3a, 0xba, 0xdb, 0xab, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcb, 0xaa, 0x35, 0xb0, 0x0b, 
-  0x75, 0x3e, 0xc1, 0x27, 0x73, 0x3f, 0xc2, 0xf4, 0x6c, 0x42, 0xc8, 0xf3, 0x66, 0x43, 0xcc, 0xf3, 0x5c, 0x46, 0xd1, 0xe0, 0x52, 0x49, 0xd7, 0xf8, 0x51, 0x49, 0xd8, 0xff, 0x51, 0x48, 0xd7, 0xff, 0x76, 0x6f, 0xdf, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfa, 0xff, 0x6c, 0x5e, 0xd9, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x5b, 0x4a, 0xd6, 0xff, 0xe2, 0xe0, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xc4, 0xef, 0xff, 0x51, 0x3e, 0xd4, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x55, 0x45, 0xd5, 0xff, 0x58, 0x48, 0xd6, 0xff, 0x71, 0x5d, 0xd7, 0xff, 0x70, 0x57, 0xd4, 0xff, 0x6d, 0x4d, 0xd0, 0xff, 0x65, 0x42, 0xcd, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x74, 0x57, 0xd2, 0xff, 0xec, 0xe9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xb4, 0xe6, 0xff, 0x71, 0x39, 0xc7, 0xff, 0x75, 0x40, 0xc8, 0xff, 0x79, 0x49, 0xcb, 0xff, 0x89, 0x4d, 0xc8, 0xff, 0x8b, 0x3f, 0xc1, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0xb9, 0x9a, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf1, 0xfa, 0xeb, 0x82, 0x00, 0xb9, 0xff, 0x8c, 0x3b, 0xbe, 0xff, 0x99, 0x39, 0xb9, 0xe7, 0xaa, 0x35, 0xb0, 0xfc, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcb, 0xaa, 0x34, 0xb0, 0x0b, 
-  0x56, 0x48, 0xd5, 0x28, 0x56, 0x48, 0xd6, 0xff, 0x54, 0x49, 0xd7, 0xfc, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfa, 0xff, 0x6d, 0x5e, 0xd9, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x70, 0x63, 0xd9, 0xff, 0xee, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x89, 0xe3, 0xff, 0x55, 0x44, 0xd4, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x5b, 0x4b, 0xd6, 0xff, 0x5e, 0x4c, 0xd5, 0xff, 0x76, 0x5c, 0xd5, 0xff, 0x65, 0x41, 0xcd, 0xff, 0x66, 0x44, 0xce, 0xff, 0x66, 0x44, 0xce, 0xff, 0x62, 0x3c, 0xce, 0xff, 0xe1, 0xde, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd5, 0xee, 0xff, 0x70, 0x34, 0xc7, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x77, 0x43, 0xc9, 0xff, 0x8a, 0x50, 0xca, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0xb8, 0x99, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0xfd, 0xe8, 0x81, 0x00, 0xb9, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xfb, 0xa1, 0x37, 0xb5, 0xf8, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcb, 0xa9, 0x33, 0xaf, 0x0c, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfa, 0xff, 0x6c, 0x5d, 0xd9, 0xff, 0x59, 0x47, 0xd5, 0xff, 0x59, 0x47, 0xd5, 0xff, 0x59, 0x47, 0xd5, 0xff, 0x59, 0x47, 0xd5, 0xff, 0x59, 0x47, 0xd5, 0xff, 0x77, 0x6b, 0xda, 0xff, 0xf3, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x72, 0xe0, 0xff, 0x5b, 0x51, 0xd8, 0xff, 0x5c, 0x4e, 0xd6, 0xff, 0x57, 0x47, 0xd5, 0xff, 0x57, 0x47, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x53, 0x43, 0xd5, 0xff, 0x7a, 0x67, 0xda, 0xff, 0x6d, 0x4e, 0xd1, 0xff, 0x67, 0x45, 0xce, 0xff, 0x5e, 0x36, 0xcd, 0xff, 0xda, 0xd6, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd9, 0xef, 0xff, 0x70, 0x34, 0xc7, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x76, 0x45, 0xc9, 0xff, 0x89, 0x4c, 0xc8, 0xff, 0xb8, 0x99, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf6, 0xfc, 0xe8, 0x82, 0x00, 0xb9, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8a, 0x3b, 0xbe, 0xec, 0xa7, 0x36, 0xb1, 0xf7, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcb, 0xaa, 0x37, 0xb0, 0x0c, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfb, 0xff, 0x78, 0x71, 0xe0, 0xff, 0x66, 0x64, 0xdd, 0xff, 0x5d, 0x5f, 0xde, 0xff, 0x54, 0x59, 0xde, 0xff, 0x57, 0x5c, 0xde, 0xff, 0x5c, 0x5e, 0xde, 0xff, 0x7d, 0x7c, 0xe2, 0xff, 0xf5, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x7e, 0xe6, 0xff, 0x4f, 0x54, 0xdd, 0xff, 0x50, 0x51, 0xdc, 0xff, 0x5d, 0x5d, 0xdd, 0xff, 0x69, 0x5f, 0xdb, 0xff, 0x56, 0x44, 0xd4, 0xff, 0x58, 0x47, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x56, 0x47, 0xd5, 0xff, 0x5f, 0x4f, 0xd6, 0xff, 0x77, 0x61, 0xd9, 0xff, 0x68, 0x42, 0xce, 0xff, 0xdc, 0xd9, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xd6, 0xee, 0xff, 0x70, 0x34, 0xc7, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x76, 0x43, 0xc9, 0xff, 0xb3, 0x9c, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf5, 0xfc, 0xe7, 0x82, 0x00, 0xb9, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x90, 0x3a, 0xbd, 0xf3, 0xa9, 0x35, 0xb1, 0xf7, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcc, 0xab, 0x35, 0xb1, 0x0c, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xef, 0xfc, 0xff, 0x55, 0x6a, 0xe6, 0xff, 0x3a, 0x56, 0xe3, 0xff, 0x3b, 0x56, 0xe3, 0xff, 0x3c, 0x57, 0xe3, 0xff, 0x3c, 0x57, 0xe3, 0xff, 0x3b, 0x56, 0xe3, 0xff, 0x4c, 0x64, 0xe5, 0xff, 0xe5, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x9d, 0xeb, 0xff, 0x42, 0x48, 0xdb, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x47, 0x4c, 0xdc, 0xff, 0x46, 0x4c, 0xdc, 0xff, 0x5e, 0x61, 0xdf, 0xff, 0x5b, 0x52, 0xd9, 0xff, 0x5a, 0x4b, 0xd6, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x56, 0x46, 0xd5, 0xff, 0x66, 0x53, 0xd7, 0xff, 0xe7, 0xe4, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xc6, 0xeb, 0xff, 0x71, 0x36, 0xc7, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x74, 0x40, 0xc8, 0xff, 0xb0, 0x9c, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf2, 0xfb, 0xe7, 0x82, 0x00, 0xb9, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x9b, 0x38, 0xb8, 0xf4, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcc, 0xa8, 0x35, 0xae, 0x0c, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xef, 0xfc, 0xff, 0x57, 0x6a, 0xe5, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x30, 0x50, 0xe3, 0xff, 0xda, 0xdc, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xdb, 0xf6, 0xff, 0x44, 0x4a, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x46, 0x4c, 0xdc, 0xff, 0x46, 0x4c, 0xdc, 0xff, 0x58, 0x5a, 0xde, 0xff, 0x63, 0x5f, 0xdc, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x57, 0x47, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x75, 0x6b, 0xda, 0xff, 0xf4, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xa5, 0xe5, 0xff, 0x74, 0x3d, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x74, 0x40, 0xc8, 0xff, 0xb1, 0x9d, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf2, 0xfb, 0xe4, 0x82, 0x00, 0xb9, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8c, 0x3b, 0xbe, 0xf4, 0xa5, 0x36, 0xb3, 0xf0, 0xaa, 0x35, 0xb0, 0xcc, 0xa9, 0x34, 0xaf, 0x0c, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x52, 0x48, 0xd7, 0xff, 0x79, 0x71, 0xe0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xef, 0xfc, 0xff, 0x57, 0x6b, 0xe6, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x33, 0x51, 0xe3, 0xff, 0xb9, 0xc0, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf7, 0xfd, 0xff, 0x74, 0x77, 0xe1, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x54, 0x58, 0xde, 0xff, 0x61, 0x56, 0xd9, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x53, 0x41, 0xd4, 0xff, 0xb1, 0xaa, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0x2a, 0xd4, 0xff, 0x84, 0x60, 0xd4, 0xff, 0x73, 0x3e, 0xc7, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x74, 0x40, 0xc8, 0xff, 0xb2, 0x9e, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf0, 0xf9, 0xe4, 0x82, 0x00, 0xb9, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3a, 0xbd, 0xec, 0xaa, 0x35, 0xb0, 0xcf, 0xab, 0x33, 0xae, 0x0c, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x54, 0x48, 0xd7, 0xfb, 0x51, 0x4c, 0xd9, 0xef, 0x4a, 0x53, 0xdc, 0xf3, 0x71, 0x83, 0xe7, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xef, 0xfc, 0xff, 0x57, 0x6b, 0xe6, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3c, 0x56, 0xe3, 0xff, 0x1e, 0x4d, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xdb, 0xf8, 0xff, 0x3d, 0x44, 0xdd, 0xff, 0x45, 0x4b, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x47, 0x4c, 0xdc, 0xff, 0x52, 0x58, 0xde, 0xff, 0x58, 0x52, 0xdb, 0xff, 0x54, 0x44, 0xd6, 0xff, 0x8d, 0x83, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcb, 0xf2, 0xff, 0x44, 0x2d, 0xd3, 0xff, 0x50, 0x45, 0xd5, 0xff, 0x7f, 0x5e, 0xd3, 0xff, 0x78, 0x45, 0xc9, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x74, 0x40, 0xc8, 0xff, 0xb2, 0x9e, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xef, 0xf9, 0xe4, 0x83, 0x00, 0xb9, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x95, 0x39, 0xba, 0xbc, 0xac, 0x37, 0xaf, 0x0f, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x49, 0xd7, 0xff, 0x53, 0x48, 0xd7, 0xff, 0x52, 0x4a, 0xd8, 0xe3, 0x44, 0x5b, 0xe0, 0xef, 0x40, 0x60, 0xe3, 0xf8, 0x3d, 0x60, 0xe4, 0xff, 0x5d, 0x7d, 0xe8, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xef, 0xfc, 0xff, 0x57, 0x6b, 0xe6, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x2c, 0x4c, 0xe2, 0xff, 0xa2, 0xae, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xe1, 0xf8, 0xff, 0x45, 0x4b, 0xde, 0xff, 0x47, 0x4c, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x40, 0x45, 0xdb, 0xff, 0x89, 0x88, 0xe6, 0xff, 0xf6, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xfe, 0xff, 0x66, 0x5a, 0xd8, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x7b, 0x55, 0xd0, 0xff, 0x74, 0x40, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x74, 0x3f, 0xc8, 0xff, 0xb4, 0x9f, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xed, 0xf8, 0xe3, 0x82, 0x00, 0xba, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x90, 0x3a, 0xbd, 0xdb, 0x9d, 0x38, 0xb7, 0x13, 
-  0x53, 0x49, 0xd7, 0x28, 0x53, 0x48, 0xd7, 0xff, 0x51, 0x4c, 0xd8, 0xf8, 0x49, 0x57, 0xde, 0xe8, 0x3e, 0x62, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3e, 0x60, 0xe4, 0xff, 0x55, 0x76, 0xe9, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf1, 0xfd, 0xff, 0x5d, 0x70, 0xe7, 0xff, 0x3c, 0x56, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x3d, 0x56, 0xe3, 0xff, 0x3d, 0x57, 0xe3, 0xff, 0x41, 0x59, 0xe3, 0xff, 0xe9, 0xec, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xfc, 0xff, 0x8e, 0x90, 0xe6, 0xff, 0x5f, 0x63, 0xdf, 0xff, 0x46, 0x4b, 0xdc, 0xff, 0x3d, 0x43, 0xdb, 0xff, 0x40, 0x46, 0xdc, 0xff, 0x4f, 0x54, 0xde, 0xff, 0x72, 0x75, 0xe1, 0xff, 0xb3, 0xb4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb3, 0xea, 0xff, 0x56, 0x47, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x56, 0x49, 0xd6, 0xff, 0x7d, 0x53, 0xce, 0xff, 0x75, 0x3f, 0xc7, 0xff, 0x74, 0x3f, 0xc8, 0xff, 0xb5, 0xa1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf0, 0xfa, 0xe3, 0x72, 0x00, 0xbe, 0xe7, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8e, 0x3a, 0xbd, 0xd0, 0x93, 0x37, 0xb9, 0x0f, 
-  0x4e, 0x4d, 0xd9, 0x20, 0x49, 0x57, 0xde, 0xf3, 0x41, 0x5f, 0xe3, 0xf7, 0x3e, 0x62, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3e, 0x60, 0xe4, 0xff, 0x4d, 0x71, 0xe8, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf2, 0xfd, 0xff, 0x6d, 0x82, 0xe9, 0xff, 0x50, 0x6c, 0xe5, 0xff, 0x42, 0x63, 0xe4, 0xff, 0x40, 0x62, 0xe4, 0xff, 0x40, 0x61, 0xe4, 0xff, 0x40, 0x60, 0xe4, 0xff, 0x47, 0x66, 0xe5, 0xff, 0x54, 0x6e, 0xe7, 0xff, 0x55, 0x6d, 0xe7, 0xff, 0x75, 0x85, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xec, 0xfb, 0xff, 0xe0, 0xe0, 0xf7, 0xff, 0xdd, 0xde, 0xf6, 0xff, 0xde, 0xde, 0xf6, 0xff, 0xe4, 0xe4, 0xf9, 0xff, 0xf7, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xc6, 0xf2, 0xff, 0x54, 0x43, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x56, 0x47, 0xd5, 0xff, 0x5f, 0x4e, 0xd6, 0xff, 0x7d, 0x52, 0xce, 0xff, 0x73, 0x3e, 0xc7, 0xff, 0xb7, 0xa3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xef, 0xfa, 0xe3, 0x63, 0x04, 0xc4, 0xf4, 0x8b, 0x3b, 0xbe, 0xfc, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcc, 0x8e, 0x3c, 0xbf, 0x0c, 
-  0x3f, 0x61, 0xe4, 0x28, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3e, 0x60, 0xe4, 0xff, 0x41, 0x68, 0xe6, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf5, 0xfd, 0xff, 0x6c, 0x86, 0xe8, 0xff, 0x40, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x40, 0x66, 0xe4, 0xff, 0x40, 0x66, 0xe4, 0xff, 0x39, 0x63, 0xe3, 0xff, 0x74, 0x8f, 0xec, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xd5, 0xf6, 0xff, 0x4a, 0x36, 0xd3, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x6f, 0x56, 0xd5, 0xff, 0x75, 0x42, 0xc8, 0xff, 0xbe, 0xaa, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xe5, 0xf8, 0xdb, 0x64, 0x1c, 0xc6, 0xff, 0x7e, 0x40, 0xc5, 0xe3, 0x8e, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcc, 0x8e, 0x3b, 0xbf, 0x0c, 
-  0x3f, 0x61, 0xe4, 0x28, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x20, 0x58, 0xe5, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf8, 0xfe, 0xff, 0x73, 0x8a, 0xe9, 0xff, 0x3e, 0x64, 0xe4, 0xff, 0x3e, 0x64, 0xe4, 0xff, 0x3e, 0x64, 0xe4, 0xff, 0x3e, 0x64, 0xe4, 0xff, 0x3e, 0x64, 0xe4, 0xff, 0x3e, 0x64, 0xe4, 0xff, 0x3f, 0x65, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x3a, 0x63, 0xe3, 0xff, 0x62, 0x7e, 0xe7, 0xff, 0xd2, 0xda, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfa, 0xff, 0xff, 0xb1, 0xb4, 0xef, 0xff, 0x54, 0x5c, 0xe0, 0xff, 0x5f, 0x55, 0xd9, 0xff, 0x56, 0x46, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x54, 0x46, 0xd5, 0xff, 0x71, 0x4e, 0xd1, 0xff, 0xc4, 0xb1, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xd0, 0xf1, 0xd7, 0x67, 0x27, 0xc6, 0xff, 0x70, 0x42, 0xca, 0xfb, 0x88, 0x3c, 0xc0, 0xeb, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcc, 0x8c, 0x3c, 0xbd, 0x0c, 
-  0x3f, 0x61, 0xe4, 0x28, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x00, 0x48, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xfe, 0xff, 0x91, 0xa7, 0xee, 0xff, 0x65, 0x8c, 0xea, 0xff, 0x65, 0x8e, 0xea, 0xff, 0x65, 0x8e, 0xea, 0xff, 0x62, 0x8d, 0xea, 0xff, 0x60, 0x8b, 0xe9, 0xff, 0x65, 0x8c, 0xea, 0xff, 0x5e, 0x83, 0xe9, 0xff, 0x42, 0x69, 0xe4, 0xff, 0x40, 0x66, 0xe4, 0xff, 0x40, 0x66, 0xe4, 0xff, 0x40, 0x67, 0xe4, 0xff, 0x45, 0x6a, 0xe4, 0xff, 0x6f, 0x87, 0xe8, 0xff, 0xe7, 0xec, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xbf, 0xf2, 0xff, 0x54, 0x5f, 0xe1, 0xff, 0x40, 0x4e, 0xdf, 0xff, 0x40, 0x4f, 0xdf, 0xff, 0x47, 0x52, 0xdf, 0xff, 0x5c, 0x51, 0xd7, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x51, 0x42, 0xd4, 0xff, 0xc8, 0xbd, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xb3, 0xea, 0xdc, 0x6a, 0x31, 0xc7, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x78, 0x40, 0xc7, 0xf7, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcc, 0x8c, 0x3c, 0xbd, 0x0c, 
-  0x3f, 0x61, 0xe4, 0x27, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x00, 0x48, 0xe2, 0xff, 0xf9, 0xfa, 0xfe, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xae, 0xee, 0xff, 0x40, 0x77, 0xe6, 0xff, 0x40, 0x77, 0xe6, 0xff, 0x40, 0x77, 0xe6, 0xff, 0x40, 0x76, 0xe6, 0xff, 0x41, 0x77, 0xe6, 0xff, 0x41, 0x77, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x44, 0x7a, 0xe6, 0xff, 0x53, 0x84, 0xe8, 0xff, 0x5d, 0x87, 0xe9, 0xff, 0x45, 0x70, 0xe5, 0xff, 0x49, 0x6e, 0xe5, 0xff, 0x3c, 0x63, 0xe3, 0xff, 0x00, 0x50, 0xe2, 0xff, 0x45, 0x71, 0xe7, 0xff, 0xa4, 0xb3, 0xf1, 0xff, 0xc7, 0xce, 0xf4, 0xff, 0xd1, 0xd6, 0xf6, 0xff, 0xd7, 0xda, 0xf7, 0xff, 0xc5, 0xc8, 0xf2, 0xff, 0x85, 0x8d, 0xe9, 0xff, 0x00, 0x2c, 0xdd, 0xff, 0x2a, 0x3d, 0xde, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x4f, 0x56, 0xde, 0xff, 0x58, 0x4a, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x4c, 0x39, 0xd3, 0xff, 0xde, 0xdb, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x80, 0xda, 0xef, 0x6e, 0x3b, 0xc8, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xf8, 0x87, 0x3d, 0xc0, 0xf4, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcc, 0x8d, 0x3a, 0xc0, 0x0c, 
-  0x3f, 0x61, 0xe4, 0x27, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x60, 0xe4, 0xff, 0x1d, 0x53, 0xe3, 0xfc, 0xdf, 0xe6, 0xfb, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xd1, 0xf6, 0xff, 0x3b, 0x74, 0xe5, 0xff, 0x48, 0x7e, 0xe6, 0xff, 0x53, 0x86, 0xe8, 0xff, 0x59, 0x8a, 0xe9, 0xff, 0x50, 0x83, 0xe7, 0xff, 0x44, 0x79, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x41, 0x77, 0xe6, 0xff, 0x42, 0x77, 0xe6, 0xff, 0x43, 0x79, 0xe6, 0xff, 0x46, 0x7b, 0xe6, 0xff, 0x46, 0x79, 0xe6, 0xff, 0x5b, 0x86, 0xe9, 0xff, 0x4c, 0x70, 0xe5, 0xff, 0x3e, 0x65, 0xe4, 0xff, 0x3a, 0x63, 0xe4, 0xff, 0x36, 0x62, 0xe3, 0xff, 0x35, 0x61, 0xe3, 0xff, 0x3a, 0x62, 0xe4, 0xff, 0x52, 0x67, 0xe3, 0xff, 0x3a, 0x47, 0xde, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x40, 0x4f, 0xdf, 0xff, 0x5b, 0x62, 0xe1, 0xff, 0x55, 0x43, 0xd3, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x4b, 0x37, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x50, 0xcd, 0xff, 0x71, 0x41, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x78, 0x40, 0xc6, 0xe0, 0x8e, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcc, 0x8b, 0x3b, 0xbf, 0x0c, 
-  0x3f, 0x61, 0xe3, 0x27, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x40, 0x64, 0xe4, 0xfb, 0x43, 0x74, 0xe6, 0xeb, 0x42, 0x88, 0xe7, 0xf3, 0x7b, 0xab, 0xee, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfc, 0xff, 0xff, 0x43, 0x88, 0xe8, 0xff, 0x46, 0x85, 0xe7, 0xff, 0x46, 0x85, 0xe7, 0xff, 0x45, 0x84, 0xe7, 0xff, 0x46, 0x85, 0xe7, 0xff, 0x47, 0x86, 0xe7, 0xff, 0x55, 0x8f, 0xe9, 0xff, 0x62, 0x95, 0xea, 0xff, 0x55, 0x8a, 0xe9, 0xff, 0x48, 0x7d, 0xe6, 0xff, 0x48, 0x7c, 0xe6, 0xff, 0x43, 0x78, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x4f, 0x81, 0xe7, 0xff, 0x52, 0x7b, 0xe7, 0xff, 0x44, 0x6a, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x42, 0x68, 0xe4, 0xff, 0x55, 0x6a, 0xe4, 0xff, 0x42, 0x50, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x3e, 0x4c, 0xdf, 0xff, 0x61, 0x63, 0xdf, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x4c, 0x3a, 0xd3, 0xff, 0xa9, 0xa2, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf1, 0xfc, 0xe7, 0x72, 0x43, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x70, 0x43, 0xca, 0xff, 0x8a, 0x3b, 0xc0, 0xf4, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcb, 0x8e, 0x3c, 0xbe, 0x0c, 
-  0x3f, 0x61, 0xe4, 0x27, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3e, 0x5f, 0xe4, 0xff, 0x42, 0x73, 0xe5, 0xe7, 0x47, 0x86, 0xe7, 0xf0, 0x47, 0x8a, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x48, 0x8a, 0xe7, 0xff, 0xfd, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xd3, 0xf6, 0xff, 0x24, 0x7a, 0xe6, 0xff, 0x44, 0x82, 0xe7, 0xff, 0x44, 0x82, 0xe7, 0xff, 0x44, 0x82, 0xe7, 0xff, 0x43, 0x82, 0xe6, 0xff, 0x44, 0x83, 0xe7, 0xff, 0x45, 0x84, 0xe7, 0xff, 0x46, 0x84, 0xe7, 0xff, 0x50, 0x8b, 0xe8, 0xff, 0x4f, 0x89, 0xe8, 0xff, 0x60, 0x90, 0xea, 0xff, 0x46, 0x7b, 0xe6, 0xff, 0x42, 0x77, 0xe6, 0xff, 0x43, 0x79, 0xe6, 0xff, 0x4d, 0x7d, 0xe7, 0xff, 0x51, 0x78, 0xe7, 0xff, 0x3d, 0x63, 0xe3, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x45, 0x6a, 0xe5, 0xff, 0x4f, 0x67, 0xe4, 0xff, 0x42, 0x4e, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x47, 0x54, 0xe0, 0xff, 0x57, 0x4c, 0xd7, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x64, 0x56, 0xd9, 0xff, 0xf5, 0xf4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xc2, 0xe9, 0xfb, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x78, 0x40, 0xc7, 0xe3, 0x8e, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcb, 0x8b, 0x3d, 0xbc, 0x0c, 
-  0x3f, 0x62, 0xe4, 0x27, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x61, 0xe4, 0xff, 0x3f, 0x62, 0xe4, 0xff, 0x47, 0x83, 0xe7, 0xe0, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0xc1, 0xd3, 0xf5, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xff, 0xa2, 0xc4, 0xf3, 0xff, 0x69, 0xa7, 0xed, 0xff, 0x6a, 0xa9, 0xed, 0xff, 0x6a, 0xa7, 0xed, 0xff, 0x70, 0xa8, 0xee, 0xff, 0x5e, 0x99, 0xeb, 0xff, 0x47, 0x86, 0xe7, 0xff, 0x48, 0x86, 0xe7, 0xff, 0x47, 0x85, 0xe7, 0xff, 0x47, 0x85, 0xe7, 0xff, 0x46, 0x84, 0xe7, 0xff, 0x50, 0x8a, 0xe8, 0xff, 0x55, 0x87, 0xe8, 0xff, 0x45, 0x7a, 0xe6, 0xff, 0x44, 0x79, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x58, 0x80, 0xe8, 0xff, 0x40, 0x66, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x40, 0x67, 0xe4, 0xff, 0x56, 0x6c, 0xe4, 0xff, 0x42, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x3f, 0x4e, 0xdf, 0xff, 0x5e, 0x67, 0xe2, 0xff, 0x56, 0x46, 0xd4, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x59, 0x4b, 0xd6, 0xff, 0xcb, 0xc8, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfb, 0xa6, 0x9b, 0xe0, 0xd0, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x73, 0x42, 0xc9, 0xfc, 0x89, 0x3c, 0xbf, 0xef, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcb, 0x8e, 0x3a, 0xbf, 0x0b, 
-  0x3f, 0x61, 0xe4, 0x27, 0x3f, 0x60, 0xe4, 0xff, 0x41, 0x68, 0xe4, 0xf0, 0x46, 0x84, 0xe7, 0xf4, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x78, 0xa2, 0xeb, 0xf4, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfa, 0xfe, 0xff, 0x9e, 0xc2, 0xf1, 0xff, 0x30, 0x94, 0xe9, 0xff, 0x3f, 0x94, 0xe9, 0xff, 0x46, 0x97, 0xea, 0xff, 0x48, 0x98, 0xea, 0xff, 0x4e, 0x9b, 0xeb, 0xff, 0x63, 0xa4, 0xec, 0xff, 0x4d, 0x92, 0xe9, 0xff, 0x59, 0x95, 0xea, 0xff, 0x47, 0x84, 0xe7, 0xff, 0x46, 0x84, 0xe7, 0xff, 0x4b, 0x88, 0xe8, 0xff, 0x58, 0x8d, 0xe9, 0xff, 0x4d, 0x81, 0xe7, 0xff, 0x43, 0x78, 0xe6, 0xff, 0x47, 0x7b, 0xe7, 0xff, 0x54, 0x7e, 0xe8, 0xff, 0x3f, 0x65, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xff, 0x4a, 0x6d, 0xe5, 0xff, 0x59, 0x6a, 0xe4, 0xff, 0x3d, 0x4b, 0xde, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x41, 0x4f, 0xdf, 0xff, 0x39, 0x49, 0xdf, 0xff, 0x55, 0x54, 0xdc, 0xff, 0x68, 0x59, 0xd9, 0xff, 0xcc, 0xc9, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe3, 0xf7, 0xec, 0x52, 0x2f, 0xd2, 0xfb, 0x6e, 0x42, 0xca, 0xec, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x81, 0x3e, 0xc4, 0xf4, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xc7, 0x8b, 0x3a, 0xbe, 0x0b, 
-  0x3e, 0x5d, 0xe4, 0x23, 0x42, 0x6a, 0xe4, 0xe4, 0x47, 0x88, 0xe7, 0xfc, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x3b, 0x85, 0xe6, 0xff, 0xb8, 0xd6, 0xf7, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xe6, 0xef, 0xfb, 0xff, 0x88, 0xbc, 0xf1, 0xff, 0x35, 0x94, 0xe9, 0xff, 0x3d, 0x94, 0xe9, 0xff, 0x42, 0x95, 0xea, 0xff, 0x45, 0x96, 0xea, 0xff, 0x46, 0x97, 0xea, 0xff, 0x49, 0x97, 0xea, 0xff, 0x62, 0xa3, 0xec, 0xff, 0x4d, 0x8a, 0xe8, 0xff, 0x44, 0x83, 0xe7, 0xff, 0x45, 0x84, 0xe7, 0xff, 0x4f, 0x8a, 0xe8, 0xff, 0x4f, 0x82, 0xe8, 0xff, 0x41, 0x77, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x5a, 0x86, 0xe8, 0xff, 0x3c, 0x63, 0xe3, 0xff, 0x3f, 0x65, 0xe4, 0xff, 0x3e, 0x65, 0xe4, 0xff, 0x41, 0x66, 0xe3, 0xff, 0x57, 0x64, 0xe2, 0xff, 0x3c, 0x4a, 0xde, 0xff, 0x3c, 0x4b, 0xde, 0xff, 0x3b, 0x4a, 0xde, 0xff, 0x37, 0x47, 0xde, 0xff, 0x29, 0x3d, 0xde, 0xff, 0x4b, 0x5b, 0xe2, 0xff, 0xb2, 0xb7, 0xf1, 0xff, 0xf5, 0xf4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x62, 0x46, 0xd4, 0xfc, 0x5e, 0x45, 0xd2, 0xff, 0x62, 0x45, 0xd2, 0xd3, 0x73, 0x42, 0xc8, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x76, 0x41, 0xc7, 0xe7, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xc3, 0x8e, 0x3e, 0xbe, 0x07, 
-  0x47, 0x83, 0xe7, 0x17, 0x47, 0x89, 0xe7, 0xe3, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x48, 0x8c, 0xe8, 0xf8, 0x4b, 0x96, 0xea, 0xf4, 0x4f, 0xa6, 0xed, 0xf0, 0x35, 0x9e, 0xeb, 0xff, 0xd2, 0xe5, 0xfa, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd8, 0xe9, 0xfb, 0xff, 0xc4, 0xdd, 0xf8, 0xff, 0xb6, 0xd3, 0xf6, 0xff, 0xb1, 0xcf, 0xf5, 0xff, 0xac, 0xcc, 0xf4, 0xff, 0xa6, 0xc7, 0xf3, 0xff, 0xa5, 0xc6, 0xf3, 0xff, 0xa7, 0xc0, 0xf2, 0xff, 0xa5, 0xbf, 0xf1, 0xff, 0xa4, 0xbe, 0xf1, 0xff, 0xa8, 0xc1, 0xf1, 0xff, 0xa4, 0xb9, 0xf0, 0xff, 0xa1, 0xb8, 0xf0, 0xff, 0xa2, 0xb8, 0xf1, 0xff, 0xa7, 0xb8, 0xf1, 0xff, 0xa3, 0xb3, 0xf0, 0xff, 0xa3, 0xb3, 0xf0, 0xff, 0xa4, 0xb4, 0xf0, 0xff, 0xa4, 0xb1, 0xef, 0xff, 0xaa, 0xb0, 0xef, 0xff, 0xb0, 0xb5, 0xf1, 0xff, 0xb6, 0xbb, 0xf2, 0xff, 0xc5, 0xca, 0xf5, 0xff, 0xe5, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfe, 0xf8, 0x8a, 0x7b, 0xdc, 0xfb, 0x5e, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x70, 0x42, 0xca, 0xef, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x70, 0x42, 0xc9, 0xf7, 0x8b, 0x3c, 0xc0, 0xfc, 0x8d, 0x3b, 0xbe, 0xb4, 0x9b, 0x1c, 0xd4, 0x00, 
-  0x47, 0x8a, 0xe6, 0x0f, 0x47, 0x89, 0xe7, 0xd0, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x87, 0xe7, 0xff, 0x4a, 0x93, 0xe9, 0xf0, 0x4e, 0xa2, 0xec, 0xf7, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x52, 0xa6, 0xec, 0xff, 0xcc, 0xe2, 0xf9, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x8a, 0x83, 0xe0, 0xe7, 0x5c, 0x41, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x68, 0x44, 0xcf, 0xf0, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x71, 0x42, 0xc9, 0xff, 0x7e, 0x3e, 0xc2, 0xdc, 0x8e, 0x3b, 0xbe, 0x98, 0x8c, 0x3b, 0xbd, 0x00, 
-  0x47, 0x79, 0xfd, 0x00, 0x47, 0x89, 0xe7, 0xb3, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x4c, 0x9a, 0xea, 0xe4, 0x4e, 0xa5, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x3e, 0xa0, 0xeb, 0xff, 0x93, 0xc9, 0xf3, 0xdb, 0xf9, 0xfc, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xfb, 0xe2, 0xe2, 0xf8, 0xe8, 0x4f, 0x4a, 0xd9, 0xfc, 0x52, 0x4a, 0xd7, 0xfb, 0x5e, 0x46, 0xd2, 0xf8, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x63, 0x45, 0xd0, 0xf3, 0x71, 0x42, 0xc9, 0xfb, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x73, 0x41, 0xc9, 0xe8, 0x90, 0x3a, 0xbc, 0x60, 0x8c, 0x3b, 0xbe, 0x00, 
-  0x47, 0x89, 0xe7, 0x00, 0x47, 0x8a, 0xe7, 0x6f, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x88, 0xe7, 0xff, 0x4c, 0x9c, 0xeb, 0xeb, 0x4e, 0xa5, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa3, 0xec, 0xff, 0x4f, 0xa8, 0xed, 0xe8, 0x51, 0xb0, 0xed, 0xf7, 0x52, 0xb5, 0xed, 0xef, 0x4b, 0xb5, 0xed, 0xf8, 0x58, 0xbb, 0xef, 0xfb, 0xae, 0xd6, 0xf5, 0xfb, 0xd2, 0xea, 0xfa, 0xeb, 0xfc, 0xfe, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xec, 0xef, 0xfd, 0xe8, 0xc5, 0xc6, 0xf0, 0xf4, 0x88, 0x85, 0xe1, 0xeb, 0x3c, 0x34, 0xd7, 0xff, 0x4f, 0x4a, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xf8, 0x5d, 0x47, 0xd3, 0xfb, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5e, 0x46, 0xd2, 0xf3, 0x71, 0x42, 0xca, 0xfc, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x83, 0x37, 0xbf, 0x0c, 0x79, 0x3e, 0xc5, 0x00, 
-  0x45, 0x89, 0xeb, 0x00, 0x17, 0x89, 0xff, 0x00, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x88, 0xe7, 0xff, 0x4c, 0x9d, 0xeb, 0xdf, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x51, 0xaf, 0xed, 0xe7, 0x52, 0xb7, 0xee, 0xfc, 0x52, 0xb7, 0xee, 0xff, 0x52, 0xb7, 0xee, 0xff, 0x52, 0xb7, 0xee, 0xe3, 0x53, 0xb8, 0xf0, 0xd4, 0x53, 0xb8, 0xee, 0xdf, 0x52, 0xb9, 0xef, 0xe3, 0x52, 0xb9, 0xf0, 0xd7, 0x71, 0xc5, 0xf2, 0xdb, 0x9e, 0xd7, 0xf5, 0xdc, 0xbe, 0xe4, 0xf9, 0xd3, 0xd1, 0xec, 0xfb, 0xd0, 0xd9, 0xef, 0xfb, 0xd3, 0xe1, 0xf1, 0xfc, 0xd0, 0xe5, 0xf2, 0xfd, 0xd8, 0xe6, 0xf2, 0xfd, 0xd8, 0xe7, 0xf3, 0xfd, 0xd8, 0xe7, 0xf2, 0xfc, 0xdc, 0xee, 0xf5, 0xfe, 0xd4, 0xec, 0xf3, 0xfd, 0xd4, 0xe9, 0xf3, 0xfd, 0xd3, 0xea, 0xf3, 0xfd, 0xd3, 0xe5, 0xee, 0xfc, 0xdc, 0xea, 0xf1, 0xfd, 0xdb, 0xeb, 0xf0, 0xfb, 0xd8, 0xec, 0xf2, 0xfd, 0xd7, 0xe7, 0xec, 0xfb, 0xd8, 0xdc, 0xe3, 0xfa, 0xd8, 0xd0, 0xda, 0xf8, 0xd8, 0xc5, 0xd0, 0xf7, 0xd8, 0xbd, 0xc5, 0xf5, 0xd4, 0xa0, 0xa9, 0xf1, 0xdc, 0x69, 0x79, 0xe8, 0xfb, 0x45, 0x57, 0xe3, 0xff, 0x3e, 0x52, 0xe2, 0xff, 0x45, 0x4f, 0xde, 0xef, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x57, 0x49, 0xd5, 0xef, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5e, 0x46, 0xd2, 0xff, 0x6a, 0x43, 0xcc, 0xf0, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x73, 0x42, 0xca, 0xaf, 0x73, 0x42, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x45, 0x89, 0xeb, 0x00, 0x45, 0x8a, 0xe9, 0x00, 0x46, 0x8a, 0xe8, 0x6c, 0x4a, 0x96, 0xe9, 0xf7, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4f, 0xa8, 0xed, 0xf8, 0x52, 0xb6, 0xee, 0xe0, 0x52, 0xb8, 0xee, 0xff, 0x52, 0xb8, 0xee, 0xef, 0x52, 0xb8, 0xef, 0xef, 0x54, 0xbb, 0xef, 0xf3, 0x53, 0xba, 0xef, 0xff, 0x53, 0xb9, 0xef, 0xff, 0x53, 0xb9, 0xee, 0xf7, 0x53, 0xba, 0xef, 0xf4, 0x53, 0xb9, 0xef, 0xff, 0x51, 0xb9, 0xef, 0xff, 0x4c, 0xb8, 0xef, 0xff, 0x45, 0xb6, 0xee, 0xe4, 0x41, 0xb4, 0xee, 0xf7, 0x3e, 0xb3, 0xed, 0xfb, 0x38, 0xad, 0xec, 0xeb, 0x33, 0xa4, 0xec, 0xf0, 0x36, 0xa4, 0xec, 0xff, 0x35, 0xa5, 0xec, 0xff, 0x2e, 0x9f, 0xeb, 0xe7, 0x29, 0x8f, 0xe9, 0xfc, 0x2b, 0x8f, 0xe9, 0xff, 0x2c, 0x8f, 0xe9, 0xff, 0x2a, 0x90, 0xea, 0xf3, 0x20, 0x74, 0xe4, 0xf3, 0x1f, 0x72, 0xe5, 0xff, 0x1f, 0x72, 0xe5, 0xff, 0x1f, 0x73, 0xe5, 0xff, 0x12, 0x5e, 0xe3, 0xe4, 0x20, 0x57, 0xe3, 0xff, 0x25, 0x59, 0xe3, 0xff, 0x2a, 0x5a, 0xe3, 0xff, 0x29, 0x4f, 0xe2, 0xf0, 0x2f, 0x47, 0xe1, 0xff, 0x39, 0x4d, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3c, 0x51, 0xe2, 0xec, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x51, 0x4b, 0xd9, 0xe0, 0x60, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x62, 0x46, 0xd0, 0xd3, 0x73, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x6f, 0x40, 0xca, 0x1c, 0x6e, 0x3f, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x43, 0x85, 0xea, 0x00, 0x4a, 0x99, 0xeb, 0x08, 0x4e, 0xa3, 0xec, 0xdc, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4e, 0xa4, 0xec, 0xff, 0x4f, 0xa8, 0xec, 0xf0, 0x52, 0xb7, 0xee, 0xf7, 0x52, 0xb7, 0xee, 0xff, 0x52, 0xb8, 0xee, 0xe8, 0x53, 0xba, 0xef, 0xfb, 0x53, 0xba, 0xef, 0xff, 0x53, 0xb9, 0xef, 0xe8, 0x55, 0xc3, 0xf0, 0xdf, 0x57, 0xc9, 0xf2, 0xff, 0x57, 0xca, 0xf2, 0xfc, 0x57, 0xca, 0xf2, 0xfb, 0x57, 0xca, 0xf2, 0xff, 0x55, 0xc6, 0xf0, 0xe8, 0x53, 0xbd, 0xf0, 0xd0, 0x53, 0xb9, 0xef, 0xff, 0x53, 0xba, 0xef, 0xff, 0x53, 0xba, 0xef, 0xf8, 0x52, 0xb7, 0xee, 0xe7, 0x52, 0xb7, 0xee, 0xf8, 0x4f, 0xaa, 0xed, 0xdb, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xaa, 0xed, 0xff, 0x4d, 0xa3, 0xec, 0xf4, 0x4a, 0x97, 0xea, 0xfc, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x93, 0xe8, 0xf0, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe5, 0xfc, 0x41, 0x64, 0xe4, 0xf0, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x63, 0xe4, 0xe3, 0x3d, 0x51, 0xe2, 0xfc, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3c, 0x51, 0xe3, 0xff, 0x4a, 0x4d, 0xda, 0xf3, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x4f, 0x4b, 0xd8, 0xff, 0x5c, 0x46, 0xd2, 0xef, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5e, 0x46, 0xd2, 0xf8, 0x73, 0x42, 0xc8, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0x8c, 0x70, 0x46, 0xc6, 0x00, 0x70, 0x40, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xa6, 0xf0, 0x00, 0x4e, 0xa4, 0xec, 0x50, 0x4e, 0xa4, 0xec, 0xfc, 0x4e, 0xa4, 0xec, 0xff, 0x4f, 0xa8, 0xed, 0xf8, 0x52, 0xb8, 0xee, 0xf0, 0x52, 0xb7, 0xee, 0xfc, 0x52, 0xb9, 0xee, 0xd8, 0x53, 0xba, 0xef, 0xff, 0x53, 0xbb, 0xef, 0xfb, 0x54, 0xc3, 0xf1, 0xdf, 0x57, 0xcc, 0xf2, 0xfc, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcd, 0xf2, 0xff, 0x56, 0xca, 0xf1, 0xf4, 0x54, 0xbe, 0xf0, 0xe8, 0x53, 0xba, 0xef, 0xfc, 0x53, 0xba, 0xef, 0xf4, 0x52, 0xb8, 0xee, 0xf0, 0x52, 0xb6, 0xee, 0xfc, 0x4f, 0xaa, 0xed, 0xeb, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xab, 0xed, 0xf8, 0x4b, 0x9c, 0xeb, 0xf4, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x97, 0xea, 0xfc, 0x47, 0x87, 0xe7, 0xeb, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7f, 0xe6, 0xff, 0x43, 0x70, 0xe5, 0xe4, 0x41, 0x65, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xf4, 0x3d, 0x53, 0xe2, 0xf7, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x41, 0x50, 0xdf, 0xdc, 0x51, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x56, 0x48, 0xd6, 0xcf, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5e, 0x46, 0xd2, 0xff, 0x6d, 0x44, 0xcc, 0xe8, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xdf, 0x6f, 0x42, 0xc9, 0x0c, 0x70, 0x42, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xa4, 0xe8, 0x00, 0x45, 0xa0, 0xf1, 0x00, 0x4e, 0xa4, 0xec, 0x5c, 0x4e, 0xa5, 0xec, 0xff, 0x51, 0xb5, 0xee, 0xf0, 0x52, 0xb7, 0xee, 0xff, 0x53, 0xb8, 0xee, 0xec, 0x53, 0xba, 0xef, 0xff, 0x55, 0xbe, 0xf0, 0xef, 0x57, 0xca, 0xf1, 0xf4, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xfc, 0x55, 0xc6, 0xf0, 0xf4, 0x53, 0xb9, 0xef, 0xf4, 0x53, 0xba, 0xef, 0xf8, 0x52, 0xb7, 0xef, 0xe8, 0x51, 0xb4, 0xee, 0xe8, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xaa, 0xed, 0xf4, 0x4a, 0x97, 0xea, 0xf8, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x97, 0xea, 0xff, 0x49, 0x91, 0xe9, 0xe7, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x44, 0x7a, 0xe6, 0xf8, 0x41, 0x66, 0xe4, 0xf4, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x40, 0x5f, 0xe3, 0xcc, 0x3d, 0x50, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3e, 0x51, 0xe2, 0xfb, 0x4f, 0x4b, 0xd8, 0xfb, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x52, 0x4a, 0xd7, 0xf3, 0x60, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x68, 0x44, 0xce, 0xdc, 0x72, 0x42, 0xc9, 0xdb, 0x72, 0x41, 0xc9, 0x1c, 0x72, 0x42, 0xc9, 0x00, 0x71, 0x42, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xa3, 0xeb, 0x00, 0x4d, 0xa9, 0xee, 0x00, 0x50, 0xb4, 0xf0, 0x57, 0x52, 0xb7, 0xee, 0xf7, 0x52, 0xb9, 0xee, 0xe7, 0x53, 0xba, 0xef, 0xff, 0x54, 0xbc, 0xef, 0xe4, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x56, 0xc7, 0xf1, 0xf0, 0x53, 0xba, 0xef, 0xf8, 0x53, 0xba, 0xef, 0xfb, 0x52, 0xb8, 0xee, 0xf4, 0x51, 0xae, 0xed, 0xd3, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xaa, 0xed, 0xff, 0x4d, 0xa3, 0xed, 0xe4, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x98, 0xeb, 0xf7, 0x45, 0x80, 0xe6, 0xfc, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7d, 0xe6, 0xf8, 0x42, 0x6a, 0xe4, 0xf7, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xf0, 0x3d, 0x50, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x4c, 0x4c, 0xda, 0xe8, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x51, 0x4b, 0xd8, 0xff, 0x5e, 0x47, 0xd2, 0xfb, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xff, 0x62, 0x46, 0xd1, 0xcb, 0x77, 0x40, 0xc6, 0x1b, 0x8a, 0x50, 0xa4, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xad, 0xf0, 0x00, 0x4d, 0xb3, 0xf0, 0x00, 0x52, 0xb5, 0xef, 0x2f, 0x53, 0xba, 0xef, 0xb0, 0x54, 0xbd, 0xef, 0xf7, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x55, 0xc2, 0xf0, 0xe3, 0x53, 0xba, 0xef, 0xff, 0x53, 0xb8, 0xef, 0xef, 0x52, 0xb7, 0xee, 0xff, 0x4f, 0xab, 0xed, 0xe0, 0x4f, 0xaa, 0xed, 0xff, 0x4e, 0xa8, 0xed, 0xf8, 0x4a, 0x99, 0xea, 0xf7, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x98, 0xea, 0xff, 0x47, 0x8d, 0xe8, 0xdb, 0x45, 0x7d, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x43, 0x6f, 0xe4, 0xec, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x3e, 0x54, 0xe2, 0xeb, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x49, 0x4e, 0xdd, 0xe8, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xfb, 0x5c, 0x47, 0xd3, 0xec, 0x5f, 0x46, 0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xfb, 0x5e, 0x46, 0xd2, 0x7f, 0x5e, 0x4f, 0xd8, 0x08, 0x6e, 0x43, 0xcc, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0xa3, 0x00, 0x53, 0xb8, 0xef, 0x00, 0x53, 0xbc, 0xf4, 0x03, 0x56, 0xca, 0xf1, 0x38, 0x57, 0xcc, 0xf2, 0xcf, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcc, 0xf2, 0xff, 0x57, 0xcd, 0xf2, 0xff, 0x53, 0xba, 0xef, 0xd4, 0x53, 0xba, 0xef, 0xff, 0x52, 0xb7, 0xee, 0xef, 0x51, 0xb2, 0xee, 0xf4, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xaa, 0xed, 0xfc, 0x4b, 0x9c, 0xea, 0xfc, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x97, 0xea, 0xff, 0x4b, 0x96, 0xea, 0xf4, 0x45, 0x7d, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x45, 0x7e, 0xe6, 0xff, 0x44, 0x75, 0xe5, 0xd8, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x3f, 0x5b, 0xe3, 0xdb, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x3d, 0x51, 0xe2, 0xff, 0x46, 0x4f, 0xde, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xfc, 0x5b, 0x48, 0xd3, 0xe4, 0x5f, 0x46, 0xd2, 0x8b, 0x5a, 0x49, 0xd1, 0x10, 0x56, 0x3a, 0xd9, 0x00, 0x5d, 0x46, 0xd4, 0x00, 0x57, 0x41, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xa2, 0xb6, 0x00, 0x56, 0xcb, 0xf2, 0x00, 0x57, 0xcc, 0xf2, 0x00, 0x5c, 0xcb, 0xf6, 0x10, 0x57, 0xcb, 0xf3, 0x50, 0x57, 0xcd, 0xf2, 0x8c, 0x57, 0xcc, 0xf2, 0xa8, 0x57, 0xcc, 0xf2, 0xb3, 0x57, 0xcc, 0xf2, 0xbc, 0x57, 0xcc, 0xf2, 0xbf, 0x57, 0xcc, 0xf2, 0xbf, 0x57, 0xcc, 0xf2, 0xc0, 0x57, 0xcc, 0xf2, 0xc0, 0x57, 0xcc, 0xf2, 0xc0, 0x57, 0xcc, 0xf2, 0xc3, 0x57, 0xcc, 0xf2, 0xc3, 0x57, 0xcc, 0xf2, 0xc3, 0x57, 0xcc, 0xf2, 0xc3, 0x57, 0xcc, 0xf2, 0xc4, 0x56, 0xc8, 0xf1, 0xbf, 0x53, 0xb9, 0xef, 0xc3, 0x53, 0xb9, 0xee, 0xa4, 0x51, 0xb4, 0xee, 0xb3, 0x4f, 0xaa, 0xed, 0xbf, 0x4f, 0xaa, 0xed, 0xc3, 0x4e, 0xa2, 0xec, 0xb4, 0x4a, 0x97, 0xea, 0xc7, 0x4a, 0x97, 0xea, 0xc4, 0x4a, 0x97, 0xea, 0xc4, 0x46, 0x84, 0xe8, 0xb7, 0x45, 0x7e, 0xe6, 0xc4, 0x45, 0x7e, 0xe6, 0xc4, 0x45, 0x7d, 0xe6, 0xbc, 0x41, 0x66, 0xe4, 0xc4, 0x41, 0x66, 0xe4, 0xc4, 0x41, 0x66, 0xe4, 0xc4, 0x40, 0x5f, 0xe4, 0xb8, 0x3d, 0x52, 0xe2, 0xc4, 0x3d, 0x52, 0xe2, 0xc4, 0x3d, 0x52, 0xe2, 0xc3, 0x3d, 0x52, 0xe2, 0xc3, 0x46, 0x4f, 0xde, 0xbc, 0x50, 0x4b, 0xd8, 0xb0, 0x50, 0x4b, 0xd8, 0xa4, 0x50, 0x4b, 0xd8, 0x78, 0x51, 0x4b, 0xd8, 0x43, 0x00, 0x82, 0xff, 0x00, 0x5f, 0x46, 0xd2, 0x00, 0x57, 0x4c, 0xd0, 0x00, 0x5b, 0x49, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xcb, 0xf4, 0x00, 0x57, 0xcb, 0xf3, 0x00, 0x57, 0xcd, 0xf2, 0x00, 0x58, 0xca, 0xef, 0x00, 0xb9, 0x00, 0xff, 0x00, 0x57, 0xce, 0xf1, 0x04, 0x53, 0xd0, 0xf2, 0x07, 0x58, 0xc9, 0xf2, 0x07, 0x53, 0xcc, 0xf2, 0x07, 0x58, 0xce, 0xf2, 0x07, 0x54, 0xcb, 0xf4, 0x07, 0x59, 0xca, 0xf4, 0x07, 0x58, 0xcd, 0xf4, 0x07, 0x59, 0xcf, 0xf5, 0x08, 0x57, 0xca, 0xf3, 0x08, 0x56, 0xcd, 0xf0, 0x08, 0x5b, 0xce, 0xf1, 0x08, 0x58, 0xc0, 0xef, 0x07, 0x52, 0xbe, 0xea, 0x08, 0x52, 0xb8, 0xef, 0x07, 0x50, 0xad, 0xea, 0x07, 0x51, 0xac, 0xea, 0x07, 0x4a, 0xa8, 0xed, 0x08, 0x4a, 0x98, 0xea, 0x08, 0x4a, 0x99, 0xea, 0x08, 0x4a, 0x99, 0xea, 0x08, 0x49, 0x88, 0xe7, 0x08, 0x43, 0x7e, 0xe6, 0x08, 0x45, 0x81, 0xe6, 0x08, 0x46, 0x84, 0xe8, 0x08, 0x42, 0x6f, 0xe1, 0x08, 0x42, 0x64, 0xe4, 0x08, 0x43, 0x66, 0xe7, 0x08, 0x43, 0x67, 0xe5, 0x08, 0x40, 0x61, 0xe4, 0x08, 0x40, 0x5a, 0xdf, 0x08, 0x40, 0x5f, 0xe1, 0x08, 0x40, 0x5f, 0xe5, 0x07, 0x42, 0x5a, 0xe8, 0x04, 0x4b, 0x1c, 0xdf, 0x00, 0x52, 0x4d, 0xdb, 0x00, 0x50, 0x4b, 0xd8, 0x00, 0x51, 0x4b, 0xd8, 0x00, 0x52, 0x4e, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x08, 0xca, 0x67, 0x4b, 0x0c, 0xca, 0x64, 0x4b, 0x17, 0xca, 0x65, 0x4b, 0x1f, 0xca, 0x66, 0x4a, 0x24, 0xcb, 0x54, 0x53, 0x27, 0xcb, 0x54, 
+  0x53, 0x28, 0xcd, 0x54, 0x53, 0x2b, 0xce, 0x56, 0x55, 0x2b, 0xc9, 0x54, 0x53, 0x2c, 0x81, 0xca, 0x53, 0x52, 0x2c, 0x00, 0xcb, 0x56, 0x55, 0x2f, 0x81, 0xcc, 0x54, 0x53, 0x2f, 0x02, 0xcd, 0x52, 
+  0x52, 0x2f, 0xc9, 0x56, 0x55, 0x30, 0xca, 0x56, 0x55, 0x2b, 0x86, 0xc3, 0x42, 0x68, 0x34, 0x11, 0xc3, 0x43, 0x67, 0x34, 0xc5, 0x40, 0x6a, 0x2f, 0xc7, 0x3c, 0x6d, 0x2f, 0xc8, 0x3c, 0x6d, 0x2f, 
+  0xc9, 0x3b, 0x6d, 0x2c, 0xc7, 0x3c, 0x72, 0x2c, 0xc8, 0x3a, 0x70, 0x2b, 0xca, 0x3a, 0x70, 0x2b, 0xc8, 0x39, 0x72, 0x2b, 0xc5, 0x38, 0x76, 0x2c, 0xca, 0x35, 0x77, 0x2b, 0xc7, 0x36, 0x77, 0x2b, 
+  0xc7, 0x36, 0x77, 0x27, 0xc7, 0x36, 0x77, 0x24, 0xc7, 0x36, 0x77, 0x23, 0xc7, 0x36, 0x77, 0x1c, 0xc7, 0x35, 0x77, 0x14, 0xcb, 0x37, 0x72, 0x04, 0x93, 0x00, 0x00, 0x00, 0x00, 0x05, 0xca, 0x65, 
+  0x4c, 0x4f, 0xca, 0x66, 0x4b, 0x9f, 0xca, 0x65, 0x4b, 0xcf, 0xca, 0x65, 0x4b, 0xe3, 0xca, 0x66, 0x4b, 0xf7, 0xcb, 0x60, 0x4d, 0xeb, 0x8a, 0xcb, 0x54, 0x53, 0xff, 0x01, 0xcb, 0x54, 0x52, 0xff, 
+  0xc8, 0x4c, 0x5e, 0xf0, 0x86, 0xc4, 0x43, 0x67, 0xff, 0x01, 0xc6, 0x41, 0x6a, 0xe4, 0xc8, 0x3c, 0x6d, 0xff, 0x83, 0xc9, 0x3b, 0x6e, 0xff, 0x02, 0xca, 0x3b, 0x6e, 0xff, 0xc9, 0x39, 0x71, 0xec, 
+  0xc7, 0x37, 0x76, 0xff, 0x84, 0xc7, 0x36, 0x77, 0xff, 0x05, 0xc7, 0x36, 0x77, 0xfc, 0xc7, 0x36, 0x77, 0xf0, 0xc7, 0x36, 0x77, 0xdc, 0xc7, 0x36, 0x77, 0xbc, 0xc6, 0x36, 0x76, 0x78, 0xca, 0x35, 
+  0x74, 0x24, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x66, 0x4c, 0x37, 0xca, 0x65, 0x4b, 0xe7, 0x83, 0xca, 0x65, 0x4b, 0xff, 0x01, 0xca, 0x61, 0x4d, 0xd4, 0xcb, 0x53, 0x53, 0xff, 0x89, 0xcb, 
+  0x54, 0x53, 0xff, 0x01, 0xcc, 0x54, 0x53, 0xf7, 0xc5, 0x47, 0x62, 0xe3, 0x85, 0xc4, 0x43, 0x67, 0xff, 0x01, 0xc4, 0x43, 0x67, 0xfb, 0xc7, 0x3e, 0x6c, 0xd8, 0x84, 0xc9, 0x3b, 0x6e, 0xff, 0x01, 
+  0xc9, 0x3b, 0x6e, 0xfc, 0xc8, 0x38, 0x72, 0xef, 0x8a, 0xc7, 0x36, 0x77, 0xff, 0x03, 0xc8, 0x35, 0x77, 0xfc, 0xc2, 0x32, 0x87, 0xd4, 0xbd, 0x2f, 0x98, 0xa7, 0xc3, 0x2d, 0xa0, 0x0f, 0x8b, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xcb, 0x65, 0x49, 0x10, 0xca, 0x65, 0x4b, 0xaf, 0x83, 0xca, 0x65, 0x4b, 0xff, 0x02, 0xc9, 0x66, 0x4a, 0xf0, 0xca, 0x5e, 0x4e, 0xef, 0xcb, 0x54, 0x53, 0xfb, 0x88, 0xcb, 
+  0x54, 0x53, 0xff, 0x02, 0xcb, 0x55, 0x52, 0xfb, 0xc9, 0x4f, 0x59, 0xeb, 0xc4, 0x45, 0x65, 0xf7, 0x84, 0xc4, 0x43, 0x67, 0xff, 0x02, 0xc4, 0x43, 0x67, 0xfc, 0xc5, 0x41, 0x69, 0xec, 0xc8, 0x3c, 
+  0x6d, 0xe3, 0x83, 0xc9, 0x3b, 0x6e, 0xff, 0x02, 0xc9, 0x3b, 0x6e, 0xfb, 0xc9, 0x3a, 0x71, 0xf4, 0xc7, 0x37, 0x76, 0xf3, 0x89, 0xc7, 0x36, 0x77, 0xff, 0x06, 0xc7, 0x36, 0x75, 0xeb, 0xc3, 0x33, 
+  0x85, 0xec, 0xbe, 0x30, 0x94, 0xec, 0xbd, 0x2f, 0x98, 0xff, 0xbd, 0x2f, 0x97, 0xff, 0xbd, 0x2f, 0x97, 0xef, 0xbd, 0x30, 0x97, 0x58, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0x61, 0x45, 0x0b, 
+  0xca, 0x65, 0x4b, 0xe0, 0x83, 0xca, 0x65, 0x4b, 0xff, 0x01, 0xca, 0x64, 0x4b, 0xe3, 0xcb, 0x56, 0x51, 0xf8, 0x89, 0xcb, 0x54, 0x53, 0xff, 0x01, 0xcb, 0x54, 0x53, 0xe7, 0xc6, 0x47, 0x64, 0xf8, 
+  0x85, 0xc4, 0x43, 0x67, 0xff, 0x01, 0xc4, 0x42, 0x66, 0xf3, 0xc8, 0x3c, 0x6d, 0xd3, 0x84, 0xc9, 0x3b, 0x6e, 0xff, 0x01, 0xc9, 0x3b, 0x6f, 0xe4, 0xc7, 0x38, 0x75, 0xf8, 0x89, 0xc7, 0x36, 0x77, 
+  0xff, 0x03, 0xc7, 0x36, 0x76, 0xff, 0xc5, 0x35, 0x7d, 0xd8, 0xbe, 0x30, 0x94, 0xf3, 0xbd, 0x2f, 0x97, 0xfc, 0x84, 0xbd, 0x2f, 0x97, 0xff, 0x00, 0xbe, 0x2f, 0x97, 0x7f, 0x87, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xc8, 0x66, 0x4b, 0x0f, 0xca, 0x66, 0x4b, 0xe8, 0x81, 0xca, 0x65, 0x4b, 0xff, 0x03, 0xca, 0x65, 0x4b, 0xfb, 0xca, 0x62, 0x4c, 0xf8, 0xca, 0x5c, 0x4f, 0xdc, 0xcb, 0x53, 0x53, 0xff, 
+  0x87, 0xcb, 0x54, 0x53, 0xff, 0x03, 0xcb, 0x54, 0x52, 0xfc, 0xca, 0x52, 0x56, 0xfb, 0xc8, 0x4c, 0x5e, 0xdf, 0xc4, 0x42, 0x67, 0xff, 0x84, 0xc4, 0x43, 0x67, 0xff, 0x02, 0xc5, 0x42, 0x68, 0xef, 
+  0xc6, 0x3f, 0x6b, 0xe7, 0xc9, 0x3b, 0x6e, 0xf8, 0x82, 0xc9, 0x3b, 0x6e, 0xff, 0x02, 0xc9, 0x3b, 0x6e, 0xfb, 0xc9, 0x3a, 0x6f, 0xf8, 0xc8, 0x38, 0x72, 0xec, 0x89, 0xc7, 0x36, 0x77, 0xff, 0x03, 
+  0xc7, 0x36, 0x76, 0xf7, 0xc5, 0x35, 0x7e, 0xec, 0xc0, 0x31, 0x8d, 0xdf, 0xbc, 0x2f, 0x98, 0xff, 0x87, 0xbd, 0x2f, 0x97, 0xff, 0x00, 0xbd, 0x2f, 0x96, 0x6b, 0x86, 0x00, 0x00, 0x00, 0x00, 0x05, 
+  0xca, 0x65, 0x4b, 0xa3, 0xca, 0x65, 0x4b, 0xff, 0xca, 0x66, 0x4a, 0xf8, 0xca, 0x61, 0x4c, 0xd7, 0xcb, 0x58, 0x51, 0xfc, 0xcb, 0x54, 0x53, 0xfb, 0x87, 0xcb, 0x54, 0x53, 0xff, 0x03, 0xcc, 0x55, 
+  0x52, 0xff, 0xcb, 0x53, 0x56, 0xdc, 0xc6, 0x48, 0x62, 0xfc, 0xc4, 0x44, 0x66, 0xfb, 0x84, 0xc4, 0x43, 0x67, 0xff, 0x02, 0xc5, 0x43, 0x68, 0xef, 0xc8, 0x3d, 0x6c, 0xeb, 0xc9, 0x3b, 0x6e, 0xf3, 
+  0x83, 0xc9, 0x3b, 0x6e, 0xff, 0x02, 0xc9, 0x3b, 0x6f, 0xe7, 0xc8, 0x37, 0x75, 0xf7, 0xc7, 0x36, 0x77, 0xfb, 0x88, 0xc7, 0x36, 0x77, 0xff, 0x03, 0xc7, 0x36, 0x75, 0xff, 0xc5, 0x35, 0x7d, 0xdb, 
+  0xbf, 0x30, 0x91, 0xf8, 0xbd, 0x2f, 0x96, 0xf8, 0x89, 0xbd, 0x2f, 0x97, 0xff, 0x01, 0xbd, 0x2f, 0x97, 0xfc, 0xbd, 0x2f, 0x97, 0x4c, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0x65, 0x4a, 0x43, 
+  0xca, 0x63, 0x4c, 0xff, 0xca, 0x5f, 0x4e, 0xd0, 0xca, 0x56, 0x52, 0xf3, 0xcb, 0x53, 0x53, 0xff, 0x86, 0xcb, 0x54, 0x53, 0xff, 0x04, 0xcb, 0x54, 0x53, 0xfc, 0xcb, 0x53, 0x54, 0xff, 0xca, 0x51, 
+  0x58, 0xe3, 0xc5, 0x46, 0x63, 0xf0, 0xc4, 0x42, 0x68, 0xff, 0x81, 0xc4, 0x43, 0x67, 0xff, 0x04, 0xc4, 0x42, 0x67, 0xff, 0xc4, 0x42, 0x66, 0xff, 0xc4, 0x42, 0x67, 0xff, 0xc4, 0x41, 0x67, 0xf8, 
+  0xc8, 0x3c, 0x6c, 0xd8, 0x82, 0xc9, 0x3a, 0x6e, 0xff, 0x03, 0xc9, 0x39, 0x6d, 0xff, 0xc9, 0x39, 0x6d, 0xfc, 0xc8, 0x38, 0x6e, 0xf8, 0xc8, 0x36, 0x73, 0xf0, 0x81, 0xc7, 0x33, 0x76, 0xff, 0x85, 
+  0xc7, 0x34, 0x76, 0xff, 0x05, 0xc7, 0x35, 0x76, 0xff, 0xc7, 0x36, 0x76, 0xff, 0xc7, 0x36, 0x78, 0xfb, 0xc6, 0x35, 0x7c, 0xeb, 0xbf, 0x31, 0x8f, 0xe3, 0xbd, 0x2f, 0x98, 0xff, 0x8c, 0xbd, 0x2f, 
+  0x97, 0xff, 0x01, 0xbd, 0x2f, 0x97, 0xd3, 0xbe, 0x32, 0x95, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xca, 0x57, 0x51, 0xdf, 0xcb, 0x54, 0x53, 0xf8, 0xcb, 0x53, 0x53, 0xff, 0x85, 0xcb, 0x54, 
+  0x53, 0xff, 0x22, 0xcb, 0x55, 0x52, 0xff, 0xcb, 0x55, 0x52, 0xf0, 0xc9, 0x4f, 0x59, 0xec, 0xc6, 0x49, 0x61, 0xf4, 0xc5, 0x44, 0x65, 0xf7, 0xc4, 0x42, 0x68, 0xff, 0xc3, 0x41, 0x66, 0xff, 0xc2, 
+  0x31, 0x5d, 0xff, 0xc0, 0x11, 0x54, 0xff, 0xc1, 0x0c, 0x56, 0xff, 0xc7, 0x38, 0x67, 0xf7, 0xcb, 0x4c, 0x74, 0xef, 0xc9, 0x2a, 0x6b, 0xd8, 0xcf, 0x3d, 0x79, 0xd0, 0xcd, 0x33, 0x75, 0xe0, 0xcc, 
+  0x30, 0x73, 0xe3, 0xcc, 0x30, 0x74, 0xe3, 0xcd, 0x35, 0x76, 0xe3, 0xd6, 0x6b, 0x95, 0xdb, 0xd9, 0x7a, 0xa0, 0xd0, 0xd7, 0x77, 0xa0, 0xdf, 0xd8, 0x78, 0xa1, 0xe0, 0xd7, 0x78, 0xa1, 0xe0, 0xd7, 
+  0x75, 0x9f, 0xe3, 0xd7, 0x71, 0x9f, 0xe3, 0xd6, 0x6f, 0x9c, 0xe3, 0xd5, 0x6b, 0x9b, 0xe4, 0xd4, 0x68, 0x98, 0xe7, 0xd3, 0x62, 0x95, 0xe8, 0xd1, 0x56, 0x8e, 0xec, 0xcf, 0x48, 0x89, 0xdf, 0xc5, 
+  0x0f, 0x8a, 0xf0, 0xba, 0x00, 0x86, 0xec, 0xb9, 0x00, 0x90, 0xff, 0xbb, 0x20, 0x94, 0xff, 0x8e, 0xbd, 0x2f, 0x97, 0xff, 0x00, 0xbf, 0x31, 0x93, 0x57, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 
+  0x55, 0x53, 0x44, 0x87, 0xcb, 0x54, 0x53, 0xff, 0x02, 0xca, 0x52, 0x54, 0xe3, 0xc7, 0x4b, 0x60, 0xe4, 0xc5, 0x42, 0x67, 0xff, 0x82, 0xc4, 0x43, 0x67, 0xff, 0x04, 0xc4, 0x44, 0x68, 0xff, 0xcb, 
+  0x5c, 0x7a, 0xf4, 0xea, 0xbc, 0xc9, 0xcf, 0xfc, 0xf3, 0xf6, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0x95, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfd, 0xfe, 0xf4, 0xf4, 0xdc, 0xed, 0xd7, 0xda, 0x8c, 0xc5, 
+  0xe0, 0xbe, 0x32, 0x99, 0xff, 0xbd, 0x30, 0x97, 0xff, 0x8b, 0xbd, 0x2f, 0x97, 0xff, 0x01, 0xb9, 0x30, 0x9a, 0xe0, 0xad, 0x34, 0xae, 0xe0, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x54, 0x53, 
+  0xa3, 0x81, 0xcb, 0x54, 0x53, 0xff, 0x0d, 0xcb, 0x54, 0x52, 0xff, 0xcb, 0x55, 0x52, 0xfb, 0xcb, 0x53, 0x54, 0xeb, 0xc9, 0x4e, 0x5a, 0xfb, 0xc7, 0x4a, 0x5f, 0xe4, 0xc5, 0x44, 0x65, 0xf0, 0xc4, 
+  0x42, 0x68, 0xff, 0xc4, 0x42, 0x67, 0xff, 0xc4, 0x43, 0x67, 0xff, 0xc3, 0x41, 0x66, 0xff, 0xc4, 0x35, 0x62, 0xfb, 0xde, 0xa6, 0xb3, 0xf0, 0xfa, 0xea, 0xee, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0x9b, 
+  0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xef, 0xeb, 0xc9, 0xe1, 0xec, 0xcc, 0x77, 0xb1, 0xf4, 0xbb, 0x0b, 0x93, 0xff, 0xbd, 0x30, 0x97, 0xff, 0x84, 0xbd, 0x2f, 0x97, 0xff, 0x0e, 0xbe, 
+  0x2f, 0x96, 0xff, 0xbc, 0x2f, 0x98, 0xef, 0xb6, 0x32, 0xa2, 0xf0, 0xae, 0x34, 0xab, 0xe4, 0xa9, 0x35, 0xb1, 0xff, 0xaa, 0x35, 0xb0, 0xff, 0xac, 0x36, 0xb0, 0x33, 0x00, 0x00, 0x00, 0x00, 0xcb, 
+  0x55, 0x54, 0x0b, 0xcb, 0x54, 0x53, 0xcc, 0xcb, 0x55, 0x52, 0xff, 0xcc, 0x54, 0x53, 0xe7, 0xc8, 0x4c, 0x5c, 0xdf, 0xc4, 0x46, 0x64, 0xff, 0xc4, 0x44, 0x66, 0xfb, 0x84, 0xc4, 0x43, 0x67, 0xff, 
+  0x03, 0xc3, 0x40, 0x65, 0xff, 0xc9, 0x3c, 0x6c, 0xe8, 0xfc, 0xf6, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfd, 0xfe, 0xff, 0xea, 0xc0, 0xde, 0xdb, 0xb9, 
+  0x00, 0x8f, 0xff, 0xbd, 0x30, 0x97, 0xff, 0x81, 0xbd, 0x2f, 0x97, 0xff, 0x03, 0xbe, 0x2f, 0x96, 0xff, 0xbc, 0x30, 0x98, 0xe0, 0xb0, 0x33, 0xa8, 0xf4, 0xab, 0x35, 0xaf, 0xfb, 0x83, 0xaa, 0x35, 
+  0xb0, 0xff, 0x06, 0xaa, 0x36, 0xb1, 0x78, 0x00, 0x00, 0x00, 0x00, 0xca, 0x4c, 0x5f, 0x17, 0xc8, 0x4b, 0x5f, 0xc8, 0xc5, 0x46, 0x66, 0xf8, 0xc3, 0x42, 0x68, 0xff, 0xc4, 0x42, 0x68, 0xff, 0x85, 
+  0xc4, 0x43, 0x67, 0xff, 0x02, 0xc4, 0x40, 0x65, 0xff, 0xd0, 0x72, 0x8a, 0xec, 0xfd, 0xf8, 0xfa, 0xf4, 0x85, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xfd, 0xfe, 0xff, 0xfc, 0xf6, 0xfa, 0xff, 0xfa, 
+  0xf1, 0xf6, 0xff, 0xf9, 0xef, 0xf5, 0xff, 0xf8, 0xee, 0xf3, 0xff, 0xf7, 0xed, 0xf2, 0xff, 0x81, 0xf7, 0xec, 0xf2, 0xff, 0x01, 0xf6, 0xeb, 0xf1, 0xff, 0xf7, 0xec, 0xf3, 0xff, 0x87, 0xf6, 0xeb, 
+  0xf3, 0xff, 0x04, 0xf7, 0xec, 0xf4, 0xff, 0xf7, 0xed, 0xf5, 0xff, 0xf8, 0xef, 0xf6, 0xff, 0xfa, 0xf2, 0xf8, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf0, 0xd6, 0xe8, 
+  0xe4, 0xbf, 0x37, 0x9a, 0xfc, 0xbc, 0x30, 0x98, 0xf4, 0xb8, 0x30, 0x9d, 0xef, 0xae, 0x34, 0xa8, 0xe3, 0xa9, 0x35, 0xb2, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x03, 0xaa, 0x35, 0xb0, 0xa7, 0x00, 
+  0x00, 0x00, 0x00, 0xc5, 0x43, 0x67, 0x1f, 0xc4, 0x43, 0x67, 0xf4, 0x85, 0xc4, 0x43, 0x67, 0xff, 0x04, 0xc5, 0x43, 0x66, 0xff, 0xc4, 0x44, 0x66, 0xff, 0xc0, 0x3f, 0x6c, 0xe7, 0xc4, 0x3b, 0x7b, 
+  0xd7, 0xfe, 0xf9, 0xfa, 0xf4, 0x84, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xeb, 0xc9, 0xdd, 0xff, 0xd5, 0x9c, 0xba, 0xff, 0xca, 0x87, 0xa8, 0xff, 0xc6, 0x73, 0x9f, 0xff, 0xc2, 0x62, 0x97, 0xff, 0xc0, 
+  0x5a, 0x93, 0xff, 0xbf, 0x54, 0x90, 0xff, 0xc2, 0x57, 0x94, 0xff, 0xc8, 0x65, 0xa1, 0xff, 0xc2, 0x56, 0x9e, 0xff, 0xbb, 0x47, 0x99, 0xff, 0xbc, 0x4c, 0x9d, 0xff, 0xbb, 0x47, 0x9d, 0xff, 0x82, 
+  0xbb, 0x46, 0x9d, 0xff, 0x00, 0xbb, 0x46, 0x9c, 0xff, 0x81, 0xba, 0x45, 0x9b, 0xff, 0x08, 0xbb, 0x47, 0x9c, 0xff, 0xc0, 0x54, 0xa8, 0xff, 0xc6, 0x64, 0xb3, 0xff, 0xc6, 0x66, 0xb4, 0xff, 0xc0, 
+  0x64, 0xb0, 0xff, 0xc5, 0x79, 0xb8, 0xff, 0xcc, 0x91, 0xc0, 0xff, 0xdc, 0xa8, 0xd3, 0xff, 0xf7, 0xe7, 0xf5, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x02, 0xef, 0xd7, 0xea, 0xdf, 0xa6, 0x00, 0xa7, 
+  0xf7, 0xaa, 0x36, 0xb1, 0xff, 0x87, 0xaa, 0x35, 0xb0, 0xff, 0x03, 0xaa, 0x35, 0xb0, 0xb8, 0xa5, 0x39, 0xac, 0x03, 0xc3, 0x43, 0x66, 0x23, 0xc4, 0x43, 0x67, 0xfb, 0x82, 0xc4, 0x43, 0x67, 0xff, 
+  0x06, 0xc4, 0x43, 0x68, 0xfb, 0xc4, 0x43, 0x68, 0xff, 0xc0, 0x40, 0x6e, 0xec, 0xbc, 0x3c, 0x78, 0xd7, 0xb9, 0x3b, 0x7b, 0xfc, 0xb9, 0x27, 0x78, 0xff, 0xfa, 0xf1, 0xf6, 0xeb, 0x83, 0xff, 0xff, 
+  0xff, 0xff, 0x0e, 0xf6, 0xe8, 0xf0, 0xff, 0xc2, 0x4c, 0x94, 0xff, 0xb4, 0x27, 0x7c, 0xff, 0xb7, 0x37, 0x81, 0xff, 0xb8, 0x3b, 0x84, 0xff, 0xb7, 0x3a, 0x84, 0xff, 0xba, 0x40, 0x89, 0xff, 0xc2, 
+  0x57, 0x9b, 0xff, 0xbb, 0x48, 0x99, 0xff, 0xb4, 0x32, 0x93, 0xff, 0xb3, 0x30, 0x92, 0xff, 0xb4, 0x32, 0x93, 0xff, 0xb4, 0x33, 0x93, 0xff, 0xb5, 0x35, 0x94, 0xff, 0xb5, 0x36, 0x94, 0xff, 0x81, 
+  0xb5, 0x37, 0x95, 0xff, 0x07, 0xb4, 0x33, 0x95, 0xff, 0xb9, 0x40, 0x9e, 0xff, 0xc1, 0x58, 0xae, 0xff, 0xbf, 0x51, 0xae, 0xff, 0xb4, 0x32, 0xa2, 0xff, 0xb3, 0x2f, 0xa0, 0xff, 0xb2, 0x2d, 0x9f, 
+  0xff, 0xb2, 0x2e, 0x9f, 0xff, 0x82, 0xb3, 0x30, 0xa0, 0xff, 0x03, 0xb2, 0x2a, 0x9e, 0xff, 0xb1, 0x08, 0x9d, 0xff, 0xda, 0xa2, 0xd1, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0xd1, 0x95, 0xd5, 0xe0, 0xa8, 0x27, 0xae, 0xff, 0x87, 0xaa, 0x35, 0xb0, 0xff, 0x09, 0xaa, 0x35, 0xb0, 0xc3, 0xaa, 0x37, 0xb3, 0x08, 0xc3, 0x42, 0x67, 0x24, 0xc4, 0x43, 0x67, 0xff, 0xc1, 
+  0x41, 0x6c, 0xe7, 0xbf, 0x3f, 0x71, 0xeb, 0xbe, 0x3e, 0x74, 0xfb, 0xbb, 0x3b, 0x79, 0xe8, 0xba, 0x3b, 0x7c, 0xf7, 0xba, 0x3b, 0x7c, 0xff, 0x81, 0xba, 0x3b, 0x7b, 0xff, 0x01, 0xd7, 0xa0, 0xb7, 
+  0xf0, 0xff, 0xff, 0xff, 0xfc, 0x82, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xe6, 0xc6, 0xd6, 0xff, 0xb7, 0x22, 0x7f, 0xff, 0xbe, 0x4b, 0x8e, 0xff, 0xbb, 0x44, 0x8f, 0xff, 0xb5, 0x35, 0x8b, 0xff, 0xba, 
+  0x45, 0x96, 0xff, 0xb8, 0x3d, 0x95, 0xff, 0xb4, 0x30, 0x92, 0xff, 0xb7, 0x38, 0x96, 0xff, 0xba, 0x47, 0x9d, 0xff, 0xb8, 0x48, 0x9e, 0xff, 0xb4, 0x40, 0x9b, 0xff, 0xae, 0x35, 0x97, 0xff, 0xad, 
+  0x37, 0x98, 0xff, 0xb0, 0x41, 0x9d, 0xff, 0xb0, 0x45, 0x9f, 0xff, 0xb1, 0x49, 0xa1, 0xff, 0xb2, 0x48, 0xa4, 0xff, 0xad, 0x34, 0x9f, 0xff, 0xb4, 0x42, 0xa4, 0xff, 0xb9, 0x45, 0xa8, 0xff, 0xb8, 
+  0x41, 0xa7, 0xff, 0xba, 0x45, 0xaa, 0xff, 0xba, 0x46, 0xab, 0xff, 0xb9, 0x46, 0xac, 0xff, 0xb7, 0x43, 0xac, 0xff, 0xb5, 0x40, 0xaa, 0xff, 0xb4, 0x3b, 0xa9, 0xff, 0x81, 0xb2, 0x37, 0xa7, 0xff, 
+  0x03, 0xb2, 0x37, 0xa8, 0xff, 0xaf, 0x12, 0xa3, 0xff, 0xcd, 0x85, 0xc7, 0xff, 0xf7, 0xed, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xfa, 0xfd, 0xfb, 0xb2, 0x48, 0xb7, 0xf3, 0x87, 
+  0xaa, 0x35, 0xb0, 0xff, 0x02, 0xaa, 0x35, 0xb0, 0xc7, 0xaa, 0x36, 0xae, 0x08, 0xba, 0x3b, 0x7b, 0x24, 0x87, 0xba, 0x3b, 0x7b, 0xff, 0x01, 0xba, 0x3c, 0x7b, 0xff, 0xf7, 0xe5, 0xee, 0xdc, 0x82, 
+  0xff, 0xff, 0xff, 0xff, 0x0b, 0xf8, 0xee, 0xf5, 0xff, 0xbe, 0x43, 0x9a, 0xff, 0xb4, 0x33, 0x92, 0xff, 0xb4, 0x33, 0x93, 0xff, 0xb4, 0x33, 0x92, 0xff, 0xbd, 0x4d, 0xa1, 0xff, 0xbe, 0x57, 0xa7, 
+  0xff, 0xb6, 0x4b, 0xa2, 0xff, 0xa8, 0x38, 0x9a, 0xff, 0xa5, 0x36, 0x9a, 0xff, 0xa6, 0x37, 0x9a, 0xff, 0xa5, 0x37, 0x9a, 0xff, 0x83, 0xa5, 0x36, 0x9a, 0xff, 0x05, 0xa5, 0x35, 0x9a, 0xff, 0xa5, 
+  0x35, 0x99, 0xff, 0xa5, 0x34, 0x9a, 0xff, 0xb4, 0x52, 0xae, 0xff, 0xb7, 0x55, 0xb8, 0xff, 0xaa, 0x35, 0xae, 0xff, 0x83, 0xaa, 0x33, 0xae, 0xff, 0x81, 0xaa, 0x34, 0xae, 0xff, 0x07, 0xa9, 0x2c, 
+  0xad, 0xff, 0xb1, 0x3f, 0xb4, 0xff, 0xb1, 0x40, 0xb5, 0xff, 0xa8, 0x28, 0xac, 0xff, 0xaa, 0x34, 0xae, 0xff, 0xaa, 0x33, 0xae, 0xff, 0xc8, 0x8b, 0xca, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0x81, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfc, 0xd2, 0xac, 0xd5, 0xf8, 0x87, 0xaa, 0x35, 0xb0, 0xff, 0x02, 0xaa, 0x35, 0xb0, 0xc7, 0xa8, 0x35, 0xb0, 0x08, 0xba, 0x3b, 0x7b, 0x27, 0x82, 0xba, 
+  0x3b, 0x7b, 0xff, 0x05, 0xba, 0x3b, 0x7a, 0xff, 0xba, 0x3b, 0x7b, 0xf0, 0xb8, 0x3b, 0x7e, 0xec, 0xb5, 0x3a, 0x81, 0xfc, 0xb3, 0x37, 0x84, 0xe7, 0xb9, 0x50, 0x97, 0xd7, 0x83, 0xff, 0xff, 0xff, 
+  0xff, 0x13, 0xbe, 0x54, 0xa9, 0xff, 0xaf, 0x31, 0x96, 0xff, 0xb5, 0x4b, 0xa2, 0xff, 0xb1, 0x4a, 0xa3, 0xff, 0xa5, 0x37, 0x9b, 0xff, 0xa3, 0x34, 0x99, 0xff, 0xa3, 0x33, 0x99, 0xff, 0xa4, 0x33, 
+  0x99, 0xff, 0xa4, 0x34, 0x99, 0xff, 0xa5, 0x34, 0x98, 0xff, 0xa5, 0x35, 0x99, 0xff, 0xa8, 0x3d, 0x9e, 0xff, 0xab, 0x48, 0xa5, 0xff, 0xab, 0x4a, 0xa8, 0xff, 0xa7, 0x43, 0xa6, 0xff, 0xa2, 0x39, 
+  0xa5, 0xff, 0xa8, 0x4a, 0xb1, 0xff, 0xac, 0x50, 0xb8, 0xff, 0xa9, 0x48, 0xb7, 0xff, 0xa9, 0x47, 0xb6, 0xff, 0x82, 0xa9, 0x4b, 0xb7, 0xff, 0x05, 0xa9, 0x49, 0xb6, 0xff, 0xa9, 0x48, 0xb6, 0xff, 
+  0xa8, 0x43, 0xb5, 0xff, 0xa5, 0x39, 0xb0, 0xff, 0xaf, 0x5a, 0xb8, 0xff, 0xf0, 0xda, 0xf0, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x04, 0xf4, 0xe4, 0xf4, 0xff, 0xb4, 0x5d, 0xb7, 0xff, 0xaa, 0x33, 
+  0xae, 0xff, 0xa6, 0x00, 0xaa, 0xff, 0xea, 0xd3, 0xec, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf1, 0xde, 0xf2, 0xe7, 0xaa, 0x36, 0xb0, 0xff, 0x86, 0xaa, 0x35, 0xb0, 0xff, 0x0b, 0xaa, 0x35, 
+  0xb0, 0xc7, 0xaa, 0x33, 0xb2, 0x0b, 0xba, 0x3b, 0x7a, 0x27, 0xbb, 0x3b, 0x7a, 0xff, 0xbb, 0x3b, 0x7a, 0xeb, 0xb6, 0x3a, 0x80, 0xd3, 0xb0, 0x39, 0x8a, 0xf7, 0xad, 0x38, 0x8d, 0xfb, 0xac, 0x38, 
+  0x8e, 0xf8, 0xab, 0x38, 0x8f, 0xff, 0xa8, 0x25, 0x8a, 0xff, 0xda, 0xab, 0xcf, 0xd0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x11, 0xea, 0xd1, 0xe8, 0xff, 0xa1, 0x21, 0x96, 0xff, 0xa5, 0x36, 0x9a, 0xff, 
+  0xa5, 0x35, 0x9a, 0xff, 0xa5, 0x35, 0x99, 0xff, 0xa4, 0x33, 0x98, 0xff, 0xa5, 0x33, 0x98, 0xff, 0xa5, 0x34, 0x98, 0xff, 0xa9, 0x42, 0xa3, 0xff, 0xb1, 0x57, 0xb3, 0xff, 0xad, 0x55, 0xb6, 0xff, 
+  0xa2, 0x40, 0xb0, 0xff, 0x9e, 0x38, 0xae, 0xff, 0x9f, 0x3d, 0xb0, 0xff, 0x9e, 0x3e, 0xb1, 0xff, 0x9d, 0x3a, 0xb1, 0xff, 0x9a, 0x34, 0xaf, 0xff, 0x9a, 0x33, 0xae, 0xff, 0x81, 0x9a, 0x32, 0xae, 
+  0xff, 0x08, 0x9a, 0x33, 0xae, 0xff, 0x9a, 0x34, 0xae, 0xff, 0x9b, 0x35, 0xaf, 0xff, 0x9a, 0x35, 0xaf, 0xff, 0x9a, 0x34, 0xae, 0xff, 0x9a, 0x33, 0xae, 0xff, 0x9a, 0x34, 0xae, 0xff, 0x9a, 0x32, 
+  0xae, 0xff, 0xd6, 0xbd, 0xdd, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0xdd, 0xb7, 0xdf, 0xff, 0xa9, 0x31, 0xad, 0xff, 0xa9, 0x2e, 0xad, 0xff, 0xba, 0x53, 0xbd, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xff, 0xff, 0xf3, 0xaa, 0x36, 0xb0, 0xff, 0x86, 0xaa, 0x35, 0xb0, 0xff, 0x05, 0xaa, 0x35, 0xb0, 0xc7, 0xab, 0x33, 0xb3, 0x0b, 0xb1, 0x39, 0x87, 0x20, 0xad, 0x39, 0x8a, 0xf3, 
+  0xaa, 0x38, 0x8f, 0xff, 0xaa, 0x38, 0x90, 0xff, 0x83, 0xab, 0x38, 0x8f, 0xff, 0x01, 0xa5, 0x00, 0x85, 0xff, 0xf7, 0xed, 0xf5, 0xd8, 0x82, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xcf, 0xa0, 0xc9, 0xff, 
+  0xa5, 0x38, 0x9c, 0xff, 0xa7, 0x40, 0xa0, 0xff, 0xa4, 0x3c, 0x9f, 0xff, 0xa3, 0x3e, 0xa2, 0xff, 0xa9, 0x57, 0xb2, 0xff, 0xa5, 0x58, 0xb6, 0xff, 0x9a, 0x47, 0xb1, 0xff, 0x97, 0x3d, 0xaf, 0xff, 
+  0x94, 0x37, 0xab, 0xff, 0x92, 0x35, 0xaa, 0xff, 0x94, 0x39, 0xab, 0xff, 0x97, 0x3d, 0xad, 0xff, 0x9a, 0x43, 0xaf, 0xff, 0x9e, 0x48, 0xb3, 0xff, 0x9e, 0x43, 0xb3, 0xff, 0xa9, 0x5b, 0xbb, 0xff, 
+  0xb3, 0x75, 0xc3, 0xff, 0xb8, 0x7d, 0xc6, 0xff, 0xb7, 0x7a, 0xc6, 0xff, 0xb4, 0x71, 0xc4, 0xff, 0x9f, 0x41, 0xb8, 0xff, 0x95, 0x2c, 0xb1, 0xff, 0x9c, 0x3f, 0xb6, 0xff, 0xa0, 0x47, 0xb9, 0xff, 
+  0xa3, 0x4e, 0xbc, 0xff, 0xa2, 0x4d, 0xbb, 0xff, 0xa4, 0x51, 0xbc, 0xff, 0xe8, 0xd6, 0xee, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x04, 0xf0, 0xdc, 0xf2, 0xff, 0xab, 0x30, 0xae, 0xff, 0xaa, 0x32, 
+  0xae, 0xff, 0xa4, 0x00, 0xa9, 0xff, 0xf9, 0xef, 0xfa, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xbe, 0x67, 0xc4, 0xf8, 0xa9, 0x30, 0xaf, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x02, 0xaa, 0x35, 
+  0xb0, 0xc8, 0xa8, 0x37, 0xae, 0x0b, 0xab, 0x38, 0x8f, 0x28, 0x84, 0xab, 0x38, 0x8f, 0xff, 0x03, 0xac, 0x38, 0x8e, 0xff, 0xac, 0x38, 0x8d, 0xff, 0xa6, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0xf8, 
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff, 0xfe, 0xff, 0xff, 0xb8, 0x8a, 0xc0, 0xff, 0x9b, 0x40, 0xaa, 0xff, 0x9c, 0x49, 0xaf, 0xff, 0x97, 0x41, 0xae, 0xff, 0x92, 0x37, 0xaa, 0xff, 0x92, 0x36, 
+  0xaa, 0xff, 0x92, 0x36, 0xa9, 0xff, 0x93, 0x37, 0xaa, 0xff, 0x93, 0x37, 0xa9, 0xff, 0x81, 0x93, 0x35, 0xa8, 0xff, 0x11, 0x94, 0x37, 0xa8, 0xff, 0x91, 0x35, 0xa9, 0xff, 0x8a, 0x00, 0xaa, 0xff, 
+  0xc2, 0x98, 0xce, 0xff, 0xe2, 0xd7, 0xe8, 0xff, 0xef, 0xe5, 0xf2, 0xff, 0xf8, 0xf2, 0xf9, 0xff, 0xfa, 0xf6, 0xfb, 0xff, 0xfa, 0xf5, 0xfb, 0xff, 0xf6, 0xef, 0xf9, 0xff, 0xe6, 0xdd, 0xf1, 0xff, 
+  0xd4, 0xc1, 0xe6, 0xff, 0x96, 0x4b, 0xc8, 0xff, 0x80, 0x1f, 0xbd, 0xff, 0x88, 0x3c, 0xc0, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0x88, 0x3a, 0xc0, 0xff, 0xd4, 0xc3, 0xe6, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0xff, 0x04, 0xd2, 0xbe, 0xe5, 0xff, 0x9c, 0x42, 0xbd, 0xff, 0xb1, 0x41, 0xb2, 0xff, 0xa8, 0x25, 0xac, 0xff, 0xe4, 0xc1, 0xe6, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xd3, 0x94, 0xd6, 0xdc, 
+  0xa7, 0x27, 0xad, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x02, 0xaa, 0x35, 0xb0, 0xc8, 0xaa, 0x36, 0xb0, 0x0b, 0xab, 0x38, 0x8f, 0x28, 0x82, 0xab, 0x38, 0x8f, 0xff, 0x04, 0xaa, 0x38, 0x90, 0xfc, 
+  0xaa, 0x38, 0x91, 0xff, 0xa2, 0x39, 0x9a, 0xf4, 0x96, 0x39, 0xa6, 0xdb, 0x8d, 0x01, 0xac, 0xf0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xf7, 0xfc, 0xff, 0xac, 0x75, 0xbd, 0xff, 0x82, 0x93, 
+  0x38, 0xaa, 0xff, 0x09, 0x93, 0x39, 0xab, 0xff, 0x93, 0x3a, 0xab, 0xff, 0x93, 0x39, 0xab, 0xff, 0x90, 0x38, 0xac, 0xff, 0x8e, 0x3d, 0xb1, 0xff, 0x94, 0x52, 0xbe, 0xff, 0x90, 0x52, 0xc2, 0xff, 
+  0x85, 0x47, 0xc1, 0xff, 0x98, 0x65, 0xcb, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x05, 0xd3, 0xb6, 0xe7, 0xff, 0x8a, 0x41, 0xc0, 0xff, 0x89, 0x3b, 0xc0, 0xff, 0x89, 0x3c, 
+  0xc0, 0xff, 0x8d, 0x33, 0xc4, 0xff, 0xf6, 0xf2, 0xfa, 0xff, 0x81, 0xfe, 0xfd, 0xfe, 0xff, 0x05, 0xf3, 0xee, 0xf9, 0xff, 0x98, 0x54, 0xc8, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x9c, 0x4d, 0xc2, 0xff, 
+  0xa9, 0x34, 0xaf, 0xff, 0xd9, 0xab, 0xda, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xe0, 0xb5, 0xe1, 0xd8, 0xa6, 0x1a, 0xad, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x0a, 0xaa, 0x35, 0xb0, 0xc8, 
+  0xaa, 0x36, 0xb0, 0x0b, 0xa9, 0x38, 0x92, 0x24, 0xa6, 0x38, 0x95, 0xef, 0xa0, 0x38, 0x9c, 0xf0, 0x9b, 0x39, 0xa1, 0xfc, 0x93, 0x39, 0xa9, 0xeb, 0x8f, 0x39, 0xad, 0xf4, 0x8f, 0x39, 0xad, 0xff, 
+  0x8f, 0x38, 0xac, 0xff, 0x94, 0x2a, 0xb0, 0xf7, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xf8, 0xf2, 0xf9, 0xff, 0xa7, 0x69, 0xbb, 0xff, 0x98, 0x4b, 0xb5, 0xff, 0x92, 0x49, 0xb7, 0xff, 0x88, 0x3b, 
+  0xb4, 0xff, 0x89, 0x43, 0xba, 0xff, 0x8a, 0x4d, 0xc0, 0xff, 0x84, 0x47, 0xc0, 0xff, 0x7d, 0x3e, 0xbe, 0xff, 0x7d, 0x3d, 0xbe, 0xff, 0x7d, 0x3d, 0xbd, 0xff, 0x70, 0x00, 0xb8, 0xff, 0xd0, 0xc0, 
+  0xe5, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xf6, 0xf1, 0xfb, 0xff, 0xa8, 0x78, 0xd0, 0xff, 0x86, 0x36, 0xbf, 0xff, 0x88, 0x3c, 0xc0, 0xff, 0x82, 0x00, 0xbd, 0xff, 0xb5, 0x8d, 0xd6, 0xff, 
+  0xb7, 0x91, 0xd7, 0xff, 0x84, 0x0b, 0xbf, 0xff, 0x87, 0x38, 0xbf, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x86, 0x3a, 0xc0, 0xff, 0x95, 0x49, 0xc2, 0xff, 0xce, 0xa6, 0xd9, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0xed, 0xd2, 0xee, 0xdc, 0xa5, 0x00, 0xab, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x04, 0xaa, 0x35, 0xb0, 0xc8, 0xaa, 0x34, 0xb0, 0x0b, 0x91, 0x39, 0xab, 0x27, 0x91, 0x39, 0xab, 0xff, 
+  0x90, 0x39, 0xac, 0xfc, 0x83, 0x90, 0x39, 0xac, 0xff, 0x01, 0x90, 0x38, 0xac, 0xff, 0x99, 0x3f, 0xb3, 0xef, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf4, 0xef, 0xf9, 0xff, 0x92, 0x5e, 0xc5, 0xff, 
+  0x80, 0x3f, 0xbd, 0xff, 0x7f, 0x3f, 0xbd, 0xff, 0x85, 0x7e, 0x3d, 0xbd, 0xff, 0x01, 0x73, 0x00, 0xba, 0xff, 0xe9, 0xe2, 0xf3, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x02, 0x9f, 0x5a, 0xcd, 0xff, 
+  0x87, 0x37, 0xbf, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0x81, 0x89, 0x3b, 0xc0, 0xff, 0x83, 0x89, 0x3c, 0xc0, 0xff, 0x01, 0x88, 0x3a, 0xbf, 0xff, 0xc0, 0xa1, 0xdb, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0xf1, 0xde, 0xf2, 0xdb, 0xa4, 0x00, 0xab, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x02, 0xaa, 0x35, 0xb0, 0xc8, 0xa9, 0x34, 0xaf, 0x0b, 0x90, 0x39, 0xac, 0x28, 0x83, 0x90, 0x39, 0xac, 0xff, 
+  0x03, 0x91, 0x39, 0xab, 0xff, 0x91, 0x39, 0xac, 0xff, 0x8d, 0x38, 0xae, 0xf7, 0x9e, 0x56, 0xbd, 0xdc, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xf3, 0xee, 0xf9, 0xff, 0x8f, 0x5b, 0xc5, 0xff, 0x7e, 
+  0x3d, 0xbd, 0xff, 0x7e, 0x3c, 0xbd, 0xff, 0x7d, 0x3b, 0xbc, 0xff, 0x7e, 0x3b, 0xbc, 0xff, 0x7f, 0x3c, 0xbc, 0xff, 0x81, 0x3f, 0xbd, 0xff, 0x85, 0x49, 0xc1, 0xff, 0x83, 0x4d, 0xc3, 0xff, 0xd3, 
+  0xc5, 0xe7, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x07, 0xea, 0xe6, 0xf8, 0xff, 0xc7, 0xbd, 0xea, 0xff, 0x98, 0x83, 0xde, 0xff, 0x7d, 0x5d, 0xd6, 0xff, 0x86, 0x6a, 0xd9, 0xff, 0xa5, 0x93, 0xe1, 
+  0xff, 0xda, 0xd5, 0xf1, 0xff, 0xf6, 0xf3, 0xfc, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xa3, 0x72, 0xce, 0xff, 0x88, 0x3a, 0xbf, 0xff, 0x85, 0x89, 0x3c, 0xc0, 0xff, 0x01, 0x88, 0x3a, 0xc0, 
+  0xff, 0xbd, 0x9e, 0xda, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf4, 0xe6, 0xf5, 0xd8, 0xa4, 0x00, 0xab, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x03, 0xaa, 0x35, 0xb0, 0xc8, 0xaa, 0x33, 0xb0, 
+  0x0b, 0x90, 0x39, 0xac, 0x28, 0x90, 0x39, 0xac, 0xff, 0x81, 0x91, 0x39, 0xab, 0xff, 0x04, 0x8a, 0x3a, 0xb1, 0xeb, 0x7f, 0x3c, 0xb9, 0xdb, 0x7a, 0x3e, 0xbe, 0xfb, 0x76, 0x3d, 0xc0, 0xfb, 0x94, 
+  0x6a, 0xcf, 0xdb, 0x82, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf2, 0xec, 0xf8, 0xff, 0x8b, 0x51, 0xc2, 0xff, 0x80, 0x3c, 0xbb, 0xff, 0x87, 0x48, 0xbf, 0xff, 0x8d, 0x5b, 0xc8, 0xff, 0x82, 0x5a, 0xcd, 
+  0xff, 0x6c, 0x49, 0xce, 0xff, 0x62, 0x47, 0xd1, 0xff, 0x65, 0x4c, 0xd3, 0xff, 0x80, 0x6d, 0xdc, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x09, 0xaf, 0xa1, 0xe3, 0xff, 0x72, 0x53, 0xd1, 0xff, 0x60, 
+  0x39, 0xcd, 0xff, 0x63, 0x40, 0xcd, 0xff, 0x65, 0x42, 0xce, 0xff, 0x64, 0x41, 0xce, 0xff, 0x63, 0x3e, 0xcd, 0xff, 0x61, 0x39, 0xcd, 0xff, 0x83, 0x6d, 0xd5, 0xff, 0xd7, 0xcf, 0xf1, 0xff, 0x83, 
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xe4, 0xdc, 0xf4, 0xff, 0x8f, 0x5e, 0xce, 0xff, 0x88, 0x38, 0xbf, 0xff, 0x84, 0x89, 0x3c, 0xc0, 0xff, 0x01, 0x88, 0x3b, 0xc0, 0xff, 0xbb, 0x9c, 0xd8, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xe9, 0xf7, 0xdb, 0xa4, 0x00, 0xaa, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x06, 0xaa, 0x35, 0xb0, 0xc8, 0xab, 0x36, 0xb1, 0x0b, 0x8e, 0x3a, 0xaf, 0x28, 0x89, 
+  0x3a, 0xb1, 0xff, 0x7b, 0x3d, 0xbb, 0xd7, 0x73, 0x3f, 0xc3, 0xec, 0x73, 0x3f, 0xc3, 0xff, 0x81, 0x74, 0x3f, 0xc2, 0xff, 0x01, 0x73, 0x3d, 0xc2, 0xff, 0x94, 0x6c, 0xd0, 0xe0, 0x82, 0xff, 0xff, 
+  0xff, 0xff, 0x09, 0xf0, 0xed, 0xf9, 0xff, 0x87, 0x68, 0xd6, 0xff, 0x61, 0x4b, 0xd4, 0xff, 0x55, 0x48, 0xd6, 0xff, 0x55, 0x46, 0xd6, 0xff, 0x56, 0x46, 0xd5, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x59, 
+  0x48, 0xd5, 0xff, 0x3f, 0x1d, 0xd2, 0xff, 0xee, 0xec, 0xfb, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0x9b, 0x84, 0xdf, 0xff, 0x5c, 0x33, 0xcc, 0xff, 0x87, 0x66, 0x44, 0xce, 0xff, 0x01, 0x60, 
+  0x31, 0xce, 0xff, 0xde, 0xd8, 0xf3, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0x96, 0x75, 0xd4, 0xff, 0x80, 0x4b, 0xca, 0xff, 0x8a, 0x43, 0xc2, 0xff, 0x89, 0x3b, 0xc0, 0xff, 0x82, 0x89, 0x3c, 
+  0xc0, 0xff, 0x01, 0x88, 0x3b, 0xc0, 0xff, 0xba, 0x9b, 0xd8, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xea, 0xf7, 0xdf, 0xa0, 0x00, 0xac, 0xff, 0x85, 0xaa, 0x35, 0xb0, 0xff, 0x03, 0xaa, 
+  0x35, 0xb0, 0xcb, 0xa8, 0x35, 0xae, 0x0b, 0x73, 0x3f, 0xc3, 0x27, 0x73, 0x3f, 0xc3, 0xff, 0x84, 0x74, 0x3f, 0xc2, 0xff, 0x01, 0x74, 0x3d, 0xc1, 0xff, 0x97, 0x6e, 0xcf, 0xe0, 0x82, 0xff, 0xff, 
+  0xff, 0xff, 0x02, 0xef, 0xee, 0xfa, 0xff, 0x6b, 0x5d, 0xd9, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x83, 0x59, 0x48, 0xd5, 0xff, 0x01, 0x56, 0x44, 0xd5, 0xff, 0x91, 0x87, 0xe2, 0xff, 0x83, 0xff, 0xff, 
+  0xff, 0xff, 0x05, 0xae, 0xa7, 0xe8, 0xff, 0x59, 0x3d, 0xd0, 0xff, 0x79, 0x5f, 0xd5, 0xff, 0x69, 0x46, 0xce, 0xff, 0x64, 0x41, 0xcd, 0xff, 0x66, 0x43, 0xce, 0xff, 0x84, 0x66, 0x44, 0xce, 0xff, 
+  0x02, 0x65, 0x43, 0xce, 0xff, 0x5e, 0x2c, 0xce, 0xff, 0xe9, 0xe4, 0xf8, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x04, 0xf3, 0xee, 0xfb, 0xff, 0x61, 0x00, 0xc3, 0xff, 0x7d, 0x49, 0xca, 0xff, 0x8f, 
+  0x54, 0xc8, 0xff, 0x88, 0x39, 0xbf, 0xff, 0x81, 0x89, 0x3c, 0xc0, 0xff, 0x01, 0x88, 0x3b, 0xc0, 0xff, 0xba, 0x9b, 0xd8, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf6, 0xeb, 0xf8, 0xe4, 0x87, 
+  0x00, 0xb7, 0xeb, 0xa9, 0x35, 0xb0, 0xff, 0x84, 0xaa, 0x35, 0xb0, 0xff, 0x02, 0xaa, 0x35, 0xb0, 0xcb, 0xa9, 0x35, 0xaf, 0x0b, 0x74, 0x3f, 0xc2, 0x28, 0x83, 0x74, 0x3f, 0xc2, 0xff, 0x03, 0x74, 
+  0x3f, 0xc2, 0xfc, 0x6f, 0x40, 0xc5, 0xd7, 0x5f, 0x43, 0xce, 0xdb, 0x7e, 0x73, 0xde, 0xdb, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xef, 0xee, 0xfa, 0xff, 0x6c, 0x5e, 0xd9, 0xff, 0x84, 0x59, 0x48, 
+  0xd5, 0xff, 0x01, 0x51, 0x3e, 0xd4, 0xff, 0xd6, 0xd4, 0xf1, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x06, 0xe9, 0xe7, 0xf9, 0xff, 0x65, 0x57, 0xd8, 0xff, 0x58, 0x48, 0xd5, 0xff, 0x57, 0x48, 0xd5, 
+  0xff, 0x59, 0x47, 0xd5, 0xff, 0x7c, 0x65, 0xd9, 0xff, 0x6c, 0x4b, 0xd0, 0xff, 0x86, 0x66, 0x44, 0xce, 0xff, 0x00, 0x94, 0x83, 0xd9, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0x8b, 0x5b, 0xd2, 
+  0xff, 0x74, 0x3f, 0xc8, 0xff, 0x78, 0x46, 0xc9, 0xff, 0x8b, 0x4e, 0xc7, 0xff, 0x81, 0x89, 0x3c, 0xc0, 0xff, 0x01, 0x88, 0x3b, 0xc0, 0xff, 0xba, 0x9a, 0xd7, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 
+  0x03, 0xf5, 0xed, 0xf7, 0xe8, 0x82, 0x00, 0xba, 0xff, 0x93, 0x3a, 0xba, 0xdb, 0xab, 0x35, 0xb0, 0xff, 0x83, 0xaa, 0x35, 0xb0, 0xff, 0x0a, 0xaa, 0x35, 0xb0, 0xcb, 0xaa, 0x35, 0xb0, 0x0b, 0x75, 
+  0x3e, 0xc1, 0x27, 0x73, 0x3f, 0xc2, 0xf4, 0x6c, 0x42, 0xc8, 0xf3, 0x66, 0x43, 0xcc, 0xf3, 0x5c, 0x46, 0xd1, 0xe0, 0x52, 0x49, 0xd7, 0xf8, 0x51, 0x49, 0xd8, 0xff, 0x51, 0x48, 0xd7, 0xff, 0x76, 
+  0x6f, 0xdf, 0xe3, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xef, 0xee, 0xfa, 0xff, 0x6c, 0x5e, 0xd9, 0xff, 0x84, 0x59, 0x48, 0xd5, 0xff, 0x01, 0x5b, 0x4a, 0xd6, 0xff, 0xe2, 0xe0, 0xf6, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0xc7, 0xc4, 0xef, 0xff, 0x51, 0x3e, 0xd4, 0xff, 0x82, 0x58, 0x48, 0xd5, 0xff, 0x05, 0x55, 0x45, 0xd5, 0xff, 0x58, 0x48, 0xd6, 0xff, 0x71, 0x5d, 0xd7, 0xff, 0x70, 
+  0x57, 0xd4, 0xff, 0x6d, 0x4d, 0xd0, 0xff, 0x65, 0x42, 0xcd, 0xff, 0x82, 0x66, 0x44, 0xce, 0xff, 0x01, 0x74, 0x57, 0xd2, 0xff, 0xec, 0xe9, 0xf8, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc5, 
+  0xb4, 0xe6, 0xff, 0x71, 0x39, 0xc7, 0xff, 0x75, 0x40, 0xc8, 0xff, 0x79, 0x49, 0xcb, 0xff, 0x89, 0x4d, 0xc8, 0xff, 0x8b, 0x3f, 0xc1, 0xff, 0x88, 0x3b, 0xc0, 0xff, 0xb9, 0x9a, 0xd7, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0xff, 0x04, 0xf9, 0xf1, 0xfa, 0xeb, 0x82, 0x00, 0xb9, 0xff, 0x8c, 0x3b, 0xbe, 0xff, 0x99, 0x39, 0xb9, 0xe7, 0xaa, 0x35, 0xb0, 0xfc, 0x82, 0xaa, 0x35, 0xb0, 0xff, 0x04, 0xaa, 
+  0x35, 0xb0, 0xcb, 0xaa, 0x34, 0xb0, 0x0b, 0x56, 0x48, 0xd5, 0x28, 0x56, 0x48, 0xd6, 0xff, 0x54, 0x49, 0xd7, 0xfc, 0x83, 0x53, 0x49, 0xd7, 0xff, 0x01, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 
+  0xe0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xef, 0xee, 0xfa, 0xff, 0x6d, 0x5e, 0xd9, 0xff, 0x84, 0x59, 0x48, 0xd5, 0xff, 0x01, 0x70, 0x63, 0xd9, 0xff, 0xee, 0xed, 0xfb, 0xff, 0x82, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0x93, 0x89, 0xe3, 0xff, 0x55, 0x44, 0xd4, 0xff, 0x85, 0x58, 0x48, 0xd5, 0xff, 0x03, 0x5b, 0x4b, 0xd6, 0xff, 0x5e, 0x4c, 0xd5, 0xff, 0x76, 0x5c, 0xd5, 0xff, 0x65, 0x41, 0xcd, 
+  0xff, 0x81, 0x66, 0x44, 0xce, 0xff, 0x01, 0x62, 0x3c, 0xce, 0xff, 0xe1, 0xde, 0xf3, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xdc, 0xd5, 0xee, 0xff, 0x70, 0x34, 0xc7, 0xff, 0x81, 0x75, 0x41, 
+  0xc8, 0xff, 0x03, 0x77, 0x43, 0xc9, 0xff, 0x8a, 0x50, 0xca, 0xff, 0x89, 0x3c, 0xc0, 0xff, 0xb8, 0x99, 0xd7, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfb, 0xf7, 0xfd, 0xe8, 0x81, 0x00, 0xb9, 
+  0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xfb, 0xa1, 0x37, 0xb5, 0xf8, 0x82, 0xaa, 0x35, 0xb0, 0xff, 0x02, 0xaa, 0x35, 0xb0, 0xcb, 0xa9, 0x33, 0xaf, 0x0c, 0x53, 0x49, 0xd7, 0x28, 0x85, 
+  0x53, 0x49, 0xd7, 0xff, 0x01, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xef, 0xee, 0xfa, 0xff, 0x6c, 0x5d, 0xd9, 0xff, 0x84, 0x59, 0x47, 0xd5, 0xff, 
+  0x01, 0x77, 0x6b, 0xda, 0xff, 0xf3, 0xf2, 0xfc, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0x7a, 0x72, 0xe0, 0xff, 0x5b, 0x51, 0xd8, 0xff, 0x5c, 0x4e, 0xd6, 0xff, 0x81, 0x57, 0x47, 0xd5, 0xff, 
+  0x84, 0x58, 0x48, 0xd5, 0xff, 0x05, 0x53, 0x43, 0xd5, 0xff, 0x7a, 0x67, 0xda, 0xff, 0x6d, 0x4e, 0xd1, 0xff, 0x67, 0x45, 0xce, 0xff, 0x5e, 0x36, 0xcd, 0xff, 0xda, 0xd6, 0xf0, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xde, 0xd9, 0xef, 0xff, 0x70, 0x34, 0xc7, 0xff, 0x82, 0x75, 0x41, 0xc8, 0xff, 0x02, 0x76, 0x45, 0xc9, 0xff, 0x89, 0x4c, 0xc8, 0xff, 0xb8, 0x99, 0xd7, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xfa, 0xf6, 0xfc, 0xe8, 0x82, 0x00, 0xb9, 0xff, 0x81, 0x8d, 0x3b, 0xbe, 0xff, 0x01, 0x8a, 0x3b, 0xbe, 0xec, 0xa7, 0x36, 0xb1, 0xf7, 0x81, 0xaa, 0x35, 0xb0, 0xff, 0x02, 
+  0xaa, 0x35, 0xb0, 0xcb, 0xaa, 0x37, 0xb0, 0x0c, 0x53, 0x49, 0xd7, 0x28, 0x85, 0x53, 0x49, 0xd7, 0xff, 0x01, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x08, 
+  0xef, 0xee, 0xfb, 0xff, 0x78, 0x71, 0xe0, 0xff, 0x66, 0x64, 0xdd, 0xff, 0x5d, 0x5f, 0xde, 0xff, 0x54, 0x59, 0xde, 0xff, 0x57, 0x5c, 0xde, 0xff, 0x5c, 0x5e, 0xde, 0xff, 0x7d, 0x7c, 0xe2, 0xff, 
+  0xf5, 0xf5, 0xfd, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x06, 0x7a, 0x7e, 0xe6, 0xff, 0x4f, 0x54, 0xdd, 0xff, 0x50, 0x51, 0xdc, 0xff, 0x5d, 0x5d, 0xdd, 0xff, 0x69, 0x5f, 0xdb, 0xff, 0x56, 0x44, 
+  0xd4, 0xff, 0x58, 0x47, 0xd5, 0xff, 0x83, 0x58, 0x48, 0xd5, 0xff, 0x04, 0x56, 0x47, 0xd5, 0xff, 0x5f, 0x4f, 0xd6, 0xff, 0x77, 0x61, 0xd9, 0xff, 0x68, 0x42, 0xce, 0xff, 0xdc, 0xd9, 0xf1, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xdd, 0xd6, 0xee, 0xff, 0x70, 0x34, 0xc7, 0xff, 0x83, 0x75, 0x41, 0xc8, 0xff, 0x01, 0x76, 0x43, 0xc9, 0xff, 0xb3, 0x9c, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0xf9, 0xf5, 0xfc, 0xe7, 0x82, 0x00, 0xb9, 0xff, 0x82, 0x8d, 0x3b, 0xbe, 0xff, 0x05, 0x90, 0x3a, 0xbd, 0xf3, 0xa9, 0x35, 0xb1, 0xf7, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcc, 
+  0xab, 0x35, 0xb1, 0x0c, 0x53, 0x49, 0xd7, 0x28, 0x85, 0x53, 0x49, 0xd7, 0xff, 0x01, 0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xed, 0xef, 0xfc, 0xff, 
+  0x55, 0x6a, 0xe6, 0xff, 0x3a, 0x56, 0xe3, 0xff, 0x3b, 0x56, 0xe3, 0xff, 0x81, 0x3c, 0x57, 0xe3, 0xff, 0x02, 0x3b, 0x56, 0xe3, 0xff, 0x4c, 0x64, 0xe5, 0xff, 0xe5, 0xe8, 0xfa, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0xff, 0x07, 0x9b, 0x9d, 0xeb, 0xff, 0x42, 0x48, 0xdb, 0xff, 0x48, 0x4d, 0xdc, 0xff, 0x47, 0x4c, 0xdc, 0xff, 0x46, 0x4c, 0xdc, 0xff, 0x5e, 0x61, 0xdf, 0xff, 0x5b, 0x52, 0xd9, 0xff, 
+  0x5a, 0x4b, 0xd6, 0xff, 0x84, 0x58, 0x48, 0xd5, 0xff, 0x02, 0x56, 0x46, 0xd5, 0xff, 0x66, 0x53, 0xd7, 0xff, 0xe7, 0xe4, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xd1, 0xc6, 0xeb, 0xff, 
+  0x71, 0x36, 0xc7, 0xff, 0x83, 0x75, 0x41, 0xc8, 0xff, 0x01, 0x74, 0x40, 0xc8, 0xff, 0xb0, 0x9c, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xf2, 0xfb, 0xe7, 0x82, 0x00, 0xb9, 0xff, 
+  0x83, 0x8d, 0x3b, 0xbe, 0xff, 0x04, 0x9b, 0x38, 0xb8, 0xf4, 0xaa, 0x35, 0xb0, 0xff, 0xaa, 0x35, 0xb0, 0xcc, 0xa8, 0x35, 0xae, 0x0c, 0x53, 0x49, 0xd7, 0x28, 0x85, 0x53, 0x49, 0xd7, 0xff, 0x01, 
+  0x52, 0x48, 0xd7, 0xff, 0x77, 0x6f, 0xdf, 0xe0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xed, 0xef, 0xfc, 0xff, 0x57, 0x6a, 0xe5, 0xff, 0x84, 0x3d, 0x57, 0xe3, 0xff, 0x01, 0x30, 0x50, 0xe3, 0xff, 
+  0xda, 0xdc, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xda, 0xdb, 0xf6, 0xff, 0x44, 0x4a, 0xdc, 0xff, 0x82, 0x48, 0x4d, 0xdc, 0xff, 0x81, 0x46, 0x4c, 0xdc, 0xff, 0x03, 0x58, 0x5a, 0xde, 
+  0xff, 0x63, 0x5f, 0xdc, 0xff, 0x59, 0x48, 0xd5, 0xff, 0x57, 0x47, 0xd5, 0xff, 0x82, 0x58, 0x48, 0xd5, 0xff, 0x01, 0x75, 0x6b, 0xda, 0xff, 0xf4, 0xf3, 0xfc, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0xb6, 0xa5, 0xe5, 0xff, 0x74, 0x3d, 0xc8, 0xff, 0x83, 0x75, 0x41, 0xc8, 0xff, 0x01, 0x74, 0x40, 0xc8, 0xff, 0xb1, 0x9d, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xf2, 0xfb, 
+  0xe4, 0x82, 0x00, 0xb9, 0xff, 0x83, 0x8d, 0x3b, 0xbe, 0xff, 0x04, 0x8c, 0x3b, 0xbe, 0xf4, 0xa5, 0x36, 0xb3, 0xf0, 0xaa, 0x35, 0xb0, 0xcc, 0xa9, 0x34, 0xaf, 0x0c, 0x53, 0x49, 0xd7, 0x28, 0x85, 
+  0x53, 0x49, 0xd7, 0xff, 0x01, 0x52, 0x48, 0xd7, 0xff, 0x79, 0x71, 0xe0, 0xdf, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xee, 0xef, 0xfc, 0xff, 0x57, 0x6b, 0xe6, 0xff, 0x84, 0x3d, 0x57, 0xe3, 0xff, 
+  0x01, 0x33, 0x51, 0xe3, 0xff, 0xb9, 0xc0, 0xf3, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xf7, 0xfd, 0xff, 0x74, 0x77, 0xe1, 0xff, 0x86, 0x48, 0x4d, 0xdc, 0xff, 0x01, 0x54, 0x58, 0xde, 
+  0xff, 0x61, 0x56, 0xd9, 0xff, 0x81, 0x58, 0x48, 0xd5, 0xff, 0x01, 0x53, 0x41, 0xd4, 0xff, 0xb1, 0xaa, 0xea, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x02, 0x42, 0x2a, 0xd4, 0xff, 0x84, 0x60, 0xd4, 
+  0xff, 0x73, 0x3e, 0xc7, 0xff, 0x82, 0x75, 0x41, 0xc8, 0xff, 0x01, 0x74, 0x40, 0xc8, 0xff, 0xb2, 0x9e, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xf0, 0xf9, 0xe4, 0x82, 0x00, 0xb9, 
+  0xff, 0x84, 0x8d, 0x3b, 0xbe, 0xff, 0x03, 0x8d, 0x3a, 0xbd, 0xec, 0xaa, 0x35, 0xb0, 0xcf, 0xab, 0x33, 0xae, 0x0c, 0x53, 0x49, 0xd7, 0x28, 0x83, 0x53, 0x49, 0xd7, 0xff, 0x03, 0x54, 0x48, 0xd7, 
+  0xfb, 0x51, 0x4c, 0xd9, 0xef, 0x4a, 0x53, 0xdc, 0xf3, 0x71, 0x83, 0xe7, 0xcb, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xee, 0xef, 0xfc, 0xff, 0x57, 0x6b, 0xe6, 0xff, 0x84, 0x3d, 0x57, 0xe3, 0xff, 
+  0x01, 0x3c, 0x56, 0xe3, 0xff, 0x1e, 0x4d, 0xe4, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x02, 0xda, 0xdb, 0xf8, 0xff, 0x3d, 0x44, 0xdd, 0xff, 0x45, 0x4b, 0xdc, 0xff, 0x84, 0x48, 0x4d, 0xdc, 0xff, 
+  0x04, 0x47, 0x4c, 0xdc, 0xff, 0x52, 0x58, 0xde, 0xff, 0x58, 0x52, 0xdb, 0xff, 0x54, 0x44, 0xd6, 0xff, 0x8d, 0x83, 0xe0, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x04, 0xce, 0xcb, 0xf2, 0xff, 0x44, 
+  0x2d, 0xd3, 0xff, 0x50, 0x45, 0xd5, 0xff, 0x7f, 0x5e, 0xd3, 0xff, 0x78, 0x45, 0xc9, 0xff, 0x81, 0x75, 0x41, 0xc8, 0xff, 0x01, 0x74, 0x40, 0xc8, 0xff, 0xb2, 0x9e, 0xde, 0xff, 0x82, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0xf5, 0xef, 0xf9, 0xe4, 0x83, 0x00, 0xb9, 0xff, 0x85, 0x8d, 0x3b, 0xbe, 0xff, 0x02, 0x95, 0x39, 0xba, 0xbc, 0xac, 0x37, 0xaf, 0x0f, 0x53, 0x49, 0xd7, 0x28, 0x81, 0x53, 0x49, 
+  0xd7, 0xff, 0x05, 0x53, 0x48, 0xd7, 0xff, 0x52, 0x4a, 0xd8, 0xe3, 0x44, 0x5b, 0xe0, 0xef, 0x40, 0x60, 0xe3, 0xf8, 0x3d, 0x60, 0xe4, 0xff, 0x5d, 0x7d, 0xe8, 0xe4, 0x82, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0xee, 0xef, 0xfc, 0xff, 0x57, 0x6b, 0xe6, 0xff, 0x85, 0x3d, 0x57, 0xe3, 0xff, 0x01, 0x2c, 0x4c, 0xe2, 0xff, 0xa2, 0xae, 0xf1, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe1, 0xe1, 0xf8, 
+  0xff, 0x45, 0x4b, 0xde, 0xff, 0x47, 0x4c, 0xdc, 0xff, 0x85, 0x48, 0x4d, 0xdc, 0xff, 0x02, 0x40, 0x45, 0xdb, 0xff, 0x89, 0x88, 0xe6, 0xff, 0xf6, 0xf5, 0xfd, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0xf8, 0xf7, 0xfe, 0xff, 0x66, 0x5a, 0xd8, 0xff, 0x81, 0x57, 0x48, 0xd5, 0xff, 0x05, 0x58, 0x48, 0xd5, 0xff, 0x7b, 0x55, 0xd0, 0xff, 0x74, 0x40, 0xc8, 0xff, 0x75, 0x41, 0xc8, 0xff, 0x74, 
+  0x3f, 0xc8, 0xff, 0xb4, 0x9f, 0xde, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf5, 0xed, 0xf8, 0xe3, 0x82, 0x00, 0xba, 0xff, 0x85, 0x8d, 0x3b, 0xbe, 0xff, 0x06, 0x90, 0x3a, 0xbd, 0xdb, 0x9d, 
+  0x38, 0xb7, 0x13, 0x53, 0x49, 0xd7, 0x28, 0x53, 0x48, 0xd7, 0xff, 0x51, 0x4c, 0xd8, 0xf8, 0x49, 0x57, 0xde, 0xe8, 0x3e, 0x62, 0xe4, 0xff, 0x81, 0x3f, 0x61, 0xe4, 0xff, 0x01, 0x3e, 0x60, 0xe4, 
+  0xff, 0x55, 0x76, 0xe9, 0xe7, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xef, 0xf1, 0xfd, 0xff, 0x5d, 0x70, 0xe7, 0xff, 0x3c, 0x56, 0xe3, 0xff, 0x83, 0x3d, 0x57, 0xe3, 0xff, 0x03, 0x3d, 0x56, 0xe3, 
+  0xff, 0x3d, 0x57, 0xe3, 0xff, 0x41, 0x59, 0xe3, 0xff, 0xe9, 0xec, 0xfc, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x08, 0xea, 0xea, 0xfc, 0xff, 0x8e, 0x90, 0xe6, 0xff, 0x5f, 0x63, 0xdf, 0xff, 0x46, 
+  0x4b, 0xdc, 0xff, 0x3d, 0x43, 0xdb, 0xff, 0x40, 0x46, 0xdc, 0xff, 0x4f, 0x54, 0xde, 0xff, 0x72, 0x75, 0xe1, 0xff, 0xb3, 0xb4, 0xf0, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xb7, 0xb3, 0xea, 
+  0xff, 0x56, 0x47, 0xd5, 0xff, 0x82, 0x57, 0x48, 0xd5, 0xff, 0x04, 0x56, 0x49, 0xd6, 0xff, 0x7d, 0x53, 0xce, 0xff, 0x75, 0x3f, 0xc7, 0xff, 0x74, 0x3f, 0xc8, 0xff, 0xb5, 0xa1, 0xdf, 0xff, 0x82, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0xf4, 0xf0, 0xfa, 0xe3, 0x72, 0x00, 0xbe, 0xe7, 0x85, 0x8d, 0x3b, 0xbe, 0xff, 0x05, 0x8e, 0x3a, 0xbd, 0xd0, 0x93, 0x37, 0xb9, 0x0f, 0x4e, 0x4d, 0xd9, 0x20, 0x49, 
+  0x57, 0xde, 0xf3, 0x41, 0x5f, 0xe3, 0xf7, 0x3e, 0x62, 0xe4, 0xff, 0x82, 0x3f, 0x61, 0xe4, 0xff, 0x01, 0x3e, 0x60, 0xe4, 0xff, 0x4d, 0x71, 0xe8, 0xeb, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xf0, 
+  0xf2, 0xfd, 0xff, 0x6d, 0x82, 0xe9, 0xff, 0x50, 0x6c, 0xe5, 0xff, 0x42, 0x63, 0xe4, 0xff, 0x40, 0x62, 0xe4, 0xff, 0x40, 0x61, 0xe4, 0xff, 0x40, 0x60, 0xe4, 0xff, 0x47, 0x66, 0xe5, 0xff, 0x54, 
+  0x6e, 0xe7, 0xff, 0x55, 0x6d, 0xe7, 0xff, 0x75, 0x85, 0xea, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x05, 0xeb, 0xec, 0xfb, 0xff, 0xe0, 0xe0, 0xf7, 0xff, 0xdd, 0xde, 0xf6, 0xff, 0xde, 0xde, 0xf6, 
+  0xff, 0xe4, 0xe4, 0xf9, 0xff, 0xf7, 0xf8, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xca, 0xc6, 0xf2, 0xff, 0x54, 0x43, 0xd5, 0xff, 0x83, 0x57, 0x48, 0xd5, 0xff, 0x04, 0x56, 0x47, 0xd5, 
+  0xff, 0x5f, 0x4e, 0xd6, 0xff, 0x7d, 0x52, 0xce, 0xff, 0x73, 0x3e, 0xc7, 0xff, 0xb7, 0xa3, 0xe0, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf2, 0xef, 0xfa, 0xe3, 0x63, 0x04, 0xc4, 0xf4, 0x8b, 
+  0x3b, 0xbe, 0xfc, 0x84, 0x8d, 0x3b, 0xbe, 0xff, 0x02, 0x8d, 0x3b, 0xbe, 0xcc, 0x8e, 0x3c, 0xbf, 0x0c, 0x3f, 0x61, 0xe4, 0x28, 0x85, 0x3f, 0x61, 0xe4, 0xff, 0x01, 0x3e, 0x60, 0xe4, 0xff, 0x41, 
+  0x68, 0xe6, 0xf0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf3, 0xf5, 0xfd, 0xff, 0x6c, 0x86, 0xe8, 0xff, 0x40, 0x67, 0xe4, 0xff, 0x84, 0x41, 0x67, 0xe4, 0xff, 0x81, 0x40, 0x66, 0xe4, 0xff, 0x02, 
+  0x39, 0x63, 0xe3, 0xff, 0x74, 0x8f, 0xec, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xd8, 0xd5, 0xf6, 0xff, 0x4a, 0x36, 0xd3, 0xff, 0x86, 0x57, 0x48, 0xd5, 0xff, 0x02, 
+  0x6f, 0x56, 0xd5, 0xff, 0x75, 0x42, 0xc8, 0xff, 0xbe, 0xaa, 0xe4, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xeb, 0xe5, 0xf8, 0xdb, 0x64, 0x1c, 0xc6, 0xff, 0x7e, 0x40, 0xc5, 0xe3, 0x8e, 0x3b, 
+  0xbe, 0xff, 0x83, 0x8d, 0x3b, 0xbe, 0xff, 0x02, 0x8d, 0x3b, 0xbe, 0xcc, 0x8e, 0x3b, 0xbf, 0x0c, 0x3f, 0x61, 0xe4, 0x28, 0x86, 0x3f, 0x61, 0xe4, 0xff, 0x00, 0x20, 0x58, 0xe5, 0xf8, 0x82, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xf5, 0xf8, 0xfe, 0xff, 0x73, 0x8a, 0xe9, 0xff, 0x85, 0x3e, 0x64, 0xe4, 0xff, 0x00, 0x3f, 0x65, 0xe4, 0xff, 0x81, 0x41, 0x67, 0xe4, 0xff, 0x02, 0x3a, 0x63, 0xe3, 0xff, 
+  0x62, 0x7e, 0xe7, 0xff, 0xd2, 0xda, 0xf8, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x04, 0xf9, 0xfa, 0xff, 0xff, 0xb1, 0xb4, 0xef, 0xff, 0x54, 0x5c, 0xe0, 0xff, 0x5f, 0x55, 0xd9, 0xff, 0x56, 0x46, 
+  0xd5, 0xff, 0x85, 0x57, 0x48, 0xd5, 0xff, 0x02, 0x54, 0x46, 0xd5, 0xff, 0x71, 0x4e, 0xd1, 0xff, 0xc4, 0xb1, 0xe6, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xdb, 0xd0, 0xf1, 0xd7, 0x67, 0x27, 
+  0xc6, 0xff, 0x70, 0x42, 0xca, 0xfb, 0x88, 0x3c, 0xc0, 0xeb, 0x83, 0x8d, 0x3b, 0xbe, 0xff, 0x02, 0x8d, 0x3b, 0xbe, 0xcc, 0x8c, 0x3c, 0xbd, 0x0c, 0x3f, 0x61, 0xe4, 0x28, 0x86, 0x3f, 0x61, 0xe4, 
+  0xff, 0x00, 0x00, 0x48, 0xe3, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfb, 0xfc, 0xfe, 0xff, 0x91, 0xa7, 0xee, 0xff, 0x65, 0x8c, 0xea, 0xff, 0x81, 0x65, 0x8e, 0xea, 0xff, 0x04, 0x62, 0x8d, 
+  0xea, 0xff, 0x60, 0x8b, 0xe9, 0xff, 0x65, 0x8c, 0xea, 0xff, 0x5e, 0x83, 0xe9, 0xff, 0x42, 0x69, 0xe4, 0xff, 0x81, 0x40, 0x66, 0xe4, 0xff, 0x03, 0x40, 0x67, 0xe4, 0xff, 0x45, 0x6a, 0xe4, 0xff, 
+  0x6f, 0x87, 0xe8, 0xff, 0xe7, 0xec, 0xfc, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x05, 0xb9, 0xbf, 0xf2, 0xff, 0x54, 0x5f, 0xe1, 0xff, 0x40, 0x4e, 0xdf, 0xff, 0x40, 0x4f, 0xdf, 0xff, 0x47, 0x52, 
+  0xdf, 0xff, 0x5c, 0x51, 0xd7, 0xff, 0x86, 0x57, 0x48, 0xd5, 0xff, 0x01, 0x51, 0x42, 0xd4, 0xff, 0xc8, 0xbd, 0xed, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc6, 0xb3, 0xea, 0xdc, 0x6a, 0x31, 
+  0xc7, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x78, 0x40, 0xc7, 0xf7, 0x83, 0x8d, 0x3b, 0xbe, 0xff, 0x02, 0x8d, 0x3b, 0xbe, 0xcc, 0x8c, 0x3c, 0xbd, 0x0c, 0x3f, 0x61, 0xe4, 0x27, 0x86, 0x3f, 0x61, 0xe4, 
+  0xff, 0x01, 0x00, 0x48, 0xe2, 0xff, 0xf9, 0xfa, 0xfe, 0xe8, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0x99, 0xae, 0xee, 0xff, 0x82, 0x40, 0x77, 0xe6, 0xff, 0x00, 0x40, 0x76, 0xe6, 0xff, 0x81, 0x41, 
+  0x77, 0xe6, 0xff, 0x10, 0x42, 0x78, 0xe6, 0xff, 0x44, 0x7a, 0xe6, 0xff, 0x53, 0x84, 0xe8, 0xff, 0x5d, 0x87, 0xe9, 0xff, 0x45, 0x70, 0xe5, 0xff, 0x49, 0x6e, 0xe5, 0xff, 0x3c, 0x63, 0xe3, 0xff, 
+  0x00, 0x50, 0xe2, 0xff, 0x45, 0x71, 0xe7, 0xff, 0xa4, 0xb3, 0xf1, 0xff, 0xc7, 0xce, 0xf4, 0xff, 0xd1, 0xd6, 0xf6, 0xff, 0xd7, 0xda, 0xf7, 0xff, 0xc5, 0xc8, 0xf2, 0xff, 0x85, 0x8d, 0xe9, 0xff, 
+  0x00, 0x2c, 0xdd, 0xff, 0x2a, 0x3d, 0xde, 0xff, 0x83, 0x41, 0x4f, 0xdf, 0xff, 0x01, 0x4f, 0x56, 0xde, 0xff, 0x58, 0x4a, 0xd5, 0xff, 0x85, 0x57, 0x48, 0xd5, 0xff, 0x01, 0x4c, 0x39, 0xd3, 0xff, 
+  0xde, 0xdb, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x04, 0xa0, 0x80, 0xda, 0xef, 0x6e, 0x3b, 0xc8, 0xff, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xf8, 0x87, 0x3d, 0xc0, 0xf4, 0x82, 0x8d, 
+  0x3b, 0xbe, 0xff, 0x02, 0x8d, 0x3b, 0xbe, 0xcc, 0x8d, 0x3a, 0xc0, 0x0c, 0x3f, 0x61, 0xe4, 0x27, 0x85, 0x3f, 0x61, 0xe4, 0xff, 0x02, 0x3f, 0x60, 0xe4, 0xff, 0x1d, 0x53, 0xe3, 0xfc, 0xdf, 0xe6, 
+  0xfb, 0xc8, 0x82, 0xff, 0xff, 0xff, 0xff, 0x15, 0xc0, 0xd1, 0xf6, 0xff, 0x3b, 0x74, 0xe5, 0xff, 0x48, 0x7e, 0xe6, 0xff, 0x53, 0x86, 0xe8, 0xff, 0x59, 0x8a, 0xe9, 0xff, 0x50, 0x83, 0xe7, 0xff, 
+  0x44, 0x79, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x41, 0x77, 0xe6, 0xff, 0x42, 0x77, 0xe6, 0xff, 0x43, 0x79, 0xe6, 0xff, 0x46, 0x7b, 0xe6, 0xff, 0x46, 0x79, 0xe6, 0xff, 0x5b, 0x86, 0xe9, 0xff, 
+  0x4c, 0x70, 0xe5, 0xff, 0x3e, 0x65, 0xe4, 0xff, 0x3a, 0x63, 0xe4, 0xff, 0x36, 0x62, 0xe3, 0xff, 0x35, 0x61, 0xe3, 0xff, 0x3a, 0x62, 0xe4, 0xff, 0x52, 0x67, 0xe3, 0xff, 0x3a, 0x47, 0xde, 0xff, 
+  0x85, 0x41, 0x4f, 0xdf, 0xff, 0x02, 0x40, 0x4f, 0xdf, 0xff, 0x5b, 0x62, 0xe1, 0xff, 0x55, 0x43, 0xd3, 0xff, 0x84, 0x57, 0x48, 0xd5, 0xff, 0x00, 0x4b, 0x37, 0xd5, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0x7c, 0x50, 0xcd, 0xff, 0x71, 0x41, 0xc9, 0xff, 0x81, 0x72, 0x42, 0xc9, 0xff, 0x01, 0x78, 0x40, 0xc6, 0xe0, 0x8e, 0x3b, 0xbe, 0xff, 0x81, 0x8d, 0x3b, 0xbe, 0xff, 0x02, 0x8d, 0x3b, 
+  0xbe, 0xcc, 0x8b, 0x3b, 0xbf, 0x0c, 0x3f, 0x61, 0xe3, 0x27, 0x84, 0x3f, 0x61, 0xe4, 0xff, 0x03, 0x40, 0x64, 0xe4, 0xfb, 0x43, 0x74, 0xe6, 0xeb, 0x42, 0x88, 0xe7, 0xf3, 0x7b, 0xab, 0xee, 0xeb, 
+  0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf8, 0xfc, 0xff, 0xff, 0x43, 0x88, 0xe8, 0xff, 0x81, 0x46, 0x85, 0xe7, 0xff, 0x0c, 0x45, 0x84, 0xe7, 0xff, 0x46, 0x85, 0xe7, 0xff, 0x47, 0x86, 0xe7, 0xff, 
+  0x55, 0x8f, 0xe9, 0xff, 0x62, 0x95, 0xea, 0xff, 0x55, 0x8a, 0xe9, 0xff, 0x48, 0x7d, 0xe6, 0xff, 0x48, 0x7c, 0xe6, 0xff, 0x43, 0x78, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x4f, 0x81, 0xe7, 0xff, 
+  0x52, 0x7b, 0xe7, 0xff, 0x44, 0x6a, 0xe4, 0xff, 0x82, 0x41, 0x67, 0xe4, 0xff, 0x02, 0x42, 0x68, 0xe4, 0xff, 0x55, 0x6a, 0xe4, 0xff, 0x42, 0x50, 0xdf, 0xff, 0x85, 0x41, 0x4f, 0xdf, 0xff, 0x01, 
+  0x3e, 0x4c, 0xdf, 0xff, 0x61, 0x63, 0xdf, 0xff, 0x83, 0x57, 0x48, 0xd5, 0xff, 0x01, 0x4c, 0x3a, 0xd3, 0xff, 0xa9, 0xa2, 0xe9, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xf1, 0xfc, 0xe7, 
+  0x72, 0x43, 0xc9, 0xff, 0x82, 0x72, 0x42, 0xc9, 0xff, 0x01, 0x70, 0x43, 0xca, 0xff, 0x8a, 0x3b, 0xc0, 0xf4, 0x81, 0x8d, 0x3b, 0xbe, 0xff, 0x02, 0x8d, 0x3b, 0xbe, 0xcb, 0x8e, 0x3c, 0xbe, 0x0c, 
+  0x3f, 0x61, 0xe4, 0x27, 0x82, 0x3f, 0x61, 0xe4, 0xff, 0x06, 0x3e, 0x5f, 0xe4, 0xff, 0x42, 0x73, 0xe5, 0xe7, 0x47, 0x86, 0xe7, 0xf0, 0x47, 0x8a, 0xe7, 0xff, 0x47, 0x89, 0xe7, 0xff, 0x48, 0x8a, 
+  0xe7, 0xff, 0xfd, 0xff, 0xff, 0xeb, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xbe, 0xd3, 0xf6, 0xff, 0x24, 0x7a, 0xe6, 0xff, 0x82, 0x44, 0x82, 0xe7, 0xff, 0x0c, 0x43, 0x82, 0xe6, 0xff, 0x44, 0x83, 
+  0xe7, 0xff, 0x45, 0x84, 0xe7, 0xff, 0x46, 0x84, 0xe7, 0xff, 0x50, 0x8b, 0xe8, 0xff, 0x4f, 0x89, 0xe8, 0xff, 0x60, 0x90, 0xea, 0xff, 0x46, 0x7b, 0xe6, 0xff, 0x42, 0x77, 0xe6, 0xff, 0x43, 0x79, 
+  0xe6, 0xff, 0x4d, 0x7d, 0xe7, 0xff, 0x51, 0x78, 0xe7, 0xff, 0x3d, 0x63, 0xe3, 0xff, 0x81, 0x41, 0x67, 0xe4, 0xff, 0x02, 0x45, 0x6a, 0xe5, 0xff, 0x4f, 0x67, 0xe4, 0xff, 0x42, 0x4e, 0xdf, 0xff, 
+  0x85, 0x41, 0x4f, 0xdf, 0xff, 0x01, 0x47, 0x54, 0xe0, 0xff, 0x57, 0x4c, 0xd7, 0xff, 0x82, 0x57, 0x48, 0xd5, 0xff, 0x01, 0x64, 0x56, 0xd9, 0xff, 0xf5, 0xf4, 0xfc, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0xff, 0x00, 0xce, 0xc2, 0xe9, 0xfb, 0x84, 0x72, 0x42, 0xc9, 0xff, 0x05, 0x78, 0x40, 0xc7, 0xe3, 0x8e, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcb, 0x8b, 0x3d, 0xbc, 0x0c, 
+  0x3f, 0x62, 0xe4, 0x27, 0x81, 0x3f, 0x61, 0xe4, 0xff, 0x01, 0x3f, 0x62, 0xe4, 0xff, 0x47, 0x83, 0xe7, 0xe0, 0x84, 0x47, 0x89, 0xe7, 0xff, 0x00, 0xc1, 0xd3, 0xf5, 0xf3, 0x82, 0xff, 0xff, 0xff, 
+  0xff, 0x08, 0xfc, 0xfd, 0xff, 0xff, 0xa2, 0xc4, 0xf3, 0xff, 0x69, 0xa7, 0xed, 0xff, 0x6a, 0xa9, 0xed, 0xff, 0x6a, 0xa7, 0xed, 0xff, 0x70, 0xa8, 0xee, 0xff, 0x5e, 0x99, 0xeb, 0xff, 0x47, 0x86, 
+  0xe7, 0xff, 0x48, 0x86, 0xe7, 0xff, 0x81, 0x47, 0x85, 0xe7, 0xff, 0x07, 0x46, 0x84, 0xe7, 0xff, 0x50, 0x8a, 0xe8, 0xff, 0x55, 0x87, 0xe8, 0xff, 0x45, 0x7a, 0xe6, 0xff, 0x44, 0x79, 0xe6, 0xff, 
+  0x42, 0x78, 0xe6, 0xff, 0x58, 0x80, 0xe8, 0xff, 0x40, 0x66, 0xe4, 0xff, 0x81, 0x41, 0x67, 0xe4, 0xff, 0x02, 0x40, 0x67, 0xe4, 0xff, 0x56, 0x6c, 0xe4, 0xff, 0x42, 0x4f, 0xdf, 0xff, 0x84, 0x41, 
+  0x4f, 0xdf, 0xff, 0x05, 0x3f, 0x4e, 0xdf, 0xff, 0x5e, 0x67, 0xe2, 0xff, 0x56, 0x46, 0xd4, 0xff, 0x57, 0x48, 0xd5, 0xff, 0x59, 0x4b, 0xd6, 0xff, 0xcb, 0xc8, 0xf1, 0xff, 0x82, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0xfd, 0xfd, 0xff, 0xfb, 0xa6, 0x9b, 0xe0, 0xd0, 0x84, 0x72, 0x42, 0xc9, 0xff, 0x08, 0x73, 0x42, 0xc9, 0xfc, 0x89, 0x3c, 0xbf, 0xef, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xcb, 
+  0x8e, 0x3a, 0xbf, 0x0b, 0x3f, 0x61, 0xe4, 0x27, 0x3f, 0x60, 0xe4, 0xff, 0x41, 0x68, 0xe4, 0xf0, 0x46, 0x84, 0xe7, 0xf4, 0x85, 0x47, 0x89, 0xe7, 0xff, 0x01, 0x78, 0xa2, 0xeb, 0xf4, 0xfc, 0xfd, 
+  0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x12, 0xf6, 0xfa, 0xfe, 0xff, 0x9e, 0xc2, 0xf1, 0xff, 0x30, 0x94, 0xe9, 0xff, 0x3f, 0x94, 0xe9, 0xff, 0x46, 0x97, 0xea, 0xff, 0x48, 0x98, 0xea, 0xff, 
+  0x4e, 0x9b, 0xeb, 0xff, 0x63, 0xa4, 0xec, 0xff, 0x4d, 0x92, 0xe9, 0xff, 0x59, 0x95, 0xea, 0xff, 0x47, 0x84, 0xe7, 0xff, 0x46, 0x84, 0xe7, 0xff, 0x4b, 0x88, 0xe8, 0xff, 0x58, 0x8d, 0xe9, 0xff, 
+  0x4d, 0x81, 0xe7, 0xff, 0x43, 0x78, 0xe6, 0xff, 0x47, 0x7b, 0xe7, 0xff, 0x54, 0x7e, 0xe8, 0xff, 0x3f, 0x65, 0xe4, 0xff, 0x81, 0x41, 0x67, 0xe4, 0xff, 0x02, 0x4a, 0x6d, 0xe5, 0xff, 0x59, 0x6a, 
+  0xe4, 0xff, 0x3d, 0x4b, 0xde, 0xff, 0x84, 0x41, 0x4f, 0xdf, 0xff, 0x03, 0x39, 0x49, 0xdf, 0xff, 0x55, 0x54, 0xdc, 0xff, 0x68, 0x59, 0xd9, 0xff, 0xcc, 0xc9, 0xf1, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0xff, 0x02, 0xe7, 0xe3, 0xf7, 0xec, 0x52, 0x2f, 0xd2, 0xfb, 0x6e, 0x42, 0xca, 0xec, 0x84, 0x72, 0x42, 0xc9, 0xff, 0x06, 0x81, 0x3e, 0xc4, 0xf4, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xc7, 
+  0x8b, 0x3a, 0xbe, 0x0b, 0x3e, 0x5d, 0xe4, 0x23, 0x42, 0x6a, 0xe4, 0xe4, 0x47, 0x88, 0xe7, 0xfc, 0x86, 0x47, 0x89, 0xe7, 0xff, 0x01, 0x3b, 0x85, 0xe6, 0xff, 0xb8, 0xd6, 0xf7, 0xd0, 0x83, 0xff, 
+  0xff, 0xff, 0xff, 0x1e, 0xfd, 0xfe, 0xff, 0xff, 0xe6, 0xef, 0xfb, 0xff, 0x88, 0xbc, 0xf1, 0xff, 0x35, 0x94, 0xe9, 0xff, 0x3d, 0x94, 0xe9, 0xff, 0x42, 0x95, 0xea, 0xff, 0x45, 0x96, 0xea, 0xff, 
+  0x46, 0x97, 0xea, 0xff, 0x49, 0x97, 0xea, 0xff, 0x62, 0xa3, 0xec, 0xff, 0x4d, 0x8a, 0xe8, 0xff, 0x44, 0x83, 0xe7, 0xff, 0x45, 0x84, 0xe7, 0xff, 0x4f, 0x8a, 0xe8, 0xff, 0x4f, 0x82, 0xe8, 0xff, 
+  0x41, 0x77, 0xe6, 0xff, 0x42, 0x78, 0xe6, 0xff, 0x5a, 0x86, 0xe8, 0xff, 0x3c, 0x63, 0xe3, 0xff, 0x3f, 0x65, 0xe4, 0xff, 0x3e, 0x65, 0xe4, 0xff, 0x41, 0x66, 0xe3, 0xff, 0x57, 0x64, 0xe2, 0xff, 
+  0x3c, 0x4a, 0xde, 0xff, 0x3c, 0x4b, 0xde, 0xff, 0x3b, 0x4a, 0xde, 0xff, 0x37, 0x47, 0xde, 0xff, 0x29, 0x3d, 0xde, 0xff, 0x4b, 0x5b, 0xe2, 0xff, 0xb2, 0xb7, 0xf1, 0xff, 0xf5, 0xf4, 0xfc, 0xff, 
+  0x83, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xeb, 0x62, 0x46, 0xd4, 0xfc, 0x5e, 0x45, 0xd2, 0xff, 0x62, 0x45, 0xd2, 0xd3, 0x73, 0x42, 0xc8, 0xff, 0x83, 0x72, 0x42, 0xc9, 0xff, 0x05, 
+  0x76, 0x41, 0xc7, 0xe7, 0x8d, 0x3b, 0xbe, 0xff, 0x8d, 0x3b, 0xbe, 0xc3, 0x8e, 0x3e, 0xbe, 0x07, 0x47, 0x83, 0xe7, 0x17, 0x47, 0x89, 0xe7, 0xe3, 0x85, 0x47, 0x89, 0xe7, 0xff, 0x04, 0x48, 0x8c, 
+  0xe8, 0xf8, 0x4b, 0x96, 0xea, 0xf4, 0x4f, 0xa6, 0xed, 0xf0, 0x35, 0x9e, 0xeb, 0xff, 0xd2, 0xe5, 0xfa, 0xdf, 0x85, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0xff, 0xff, 0xd8, 0xe9, 0xfb, 0xff, 
+  0xc4, 0xdd, 0xf8, 0xff, 0xb6, 0xd3, 0xf6, 0xff, 0xb1, 0xcf, 0xf5, 0xff, 0xac, 0xcc, 0xf4, 0xff, 0xa6, 0xc7, 0xf3, 0xff, 0xa5, 0xc6, 0xf3, 0xff, 0xa7, 0xc0, 0xf2, 0xff, 0xa5, 0xbf, 0xf1, 0xff, 
+  0xa4, 0xbe, 0xf1, 0xff, 0xa8, 0xc1, 0xf1, 0xff, 0xa4, 0xb9, 0xf0, 0xff, 0xa1, 0xb8, 0xf0, 0xff, 0xa2, 0xb8, 0xf1, 0xff, 0xa7, 0xb8, 0xf1, 0xff, 0x81, 0xa3, 0xb3, 0xf0, 0xff, 0x06, 0xa4, 0xb4, 
+  0xf0, 0xff, 0xa4, 0xb1, 0xef, 0xff, 0xaa, 0xb0, 0xef, 0xff, 0xb0, 0xb5, 0xf1, 0xff, 0xb6, 0xbb, 0xf2, 0xff, 0xc5, 0xca, 0xf5, 0xff, 0xe5, 0xe7, 0xfb, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xfd, 0xfc, 0xfe, 0xf8, 0x8a, 0x7b, 0xdc, 0xfb, 0x5e, 0x46, 0xd2, 0xff, 0x81, 0x5f, 0x46, 0xd2, 0xff, 0x00, 0x70, 0x42, 0xca, 0xef, 0x83, 0x72, 0x42, 0xc9, 0xff, 0x05, 0x70, 0x42, 0xc9, 0xf7, 
+  0x8b, 0x3c, 0xc0, 0xfc, 0x8d, 0x3b, 0xbe, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x47, 0x8a, 0xe6, 0x0f, 0x47, 0x89, 0xe7, 0xd0, 0x83, 0x47, 0x89, 0xe7, 0xff, 0x02, 0x47, 0x87, 0xe7, 0xff, 0x4a, 0x93, 
+  0xe9, 0xf0, 0x4e, 0xa2, 0xec, 0xf7, 0x82, 0x4e, 0xa4, 0xec, 0xff, 0x01, 0x52, 0xa6, 0xec, 0xff, 0xcc, 0xe2, 0xf9, 0xe0, 0xa2, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xe7, 0x8a, 0x83, 
+  0xe0, 0xe7, 0x5c, 0x41, 0xd2, 0xff, 0x82, 0x5f, 0x46, 0xd2, 0xff, 0x00, 0x68, 0x44, 0xcf, 0xf0, 0x83, 0x72, 0x42, 0xc9, 0xff, 0x02, 0x71, 0x42, 0xc9, 0xff, 0x7e, 0x3e, 0xc2, 0xdc, 0x8e, 0x3b, 
+  0xbe, 0x98, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x89, 0xe7, 0xb3, 0x83, 0x47, 0x89, 0xe7, 0xff, 0x01, 0x4c, 0x9a, 0xea, 0xe4, 0x4e, 0xa5, 0xec, 0xff, 0x84, 0x4e, 0xa4, 0xec, 0xff, 0x03, 
+  0x3e, 0xa0, 0xeb, 0xff, 0x93, 0xc9, 0xf3, 0xdb, 0xf9, 0xfc, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0x9d, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfc, 0xfc, 0xfe, 0xfb, 0xe2, 0xe2, 0xf8, 0xe8, 0x4f, 0x4a, 
+  0xd9, 0xfc, 0x52, 0x4a, 0xd7, 0xfb, 0x5e, 0x46, 0xd2, 0xf8, 0x82, 0x5f, 0x46, 0xd2, 0xff, 0x01, 0x63, 0x45, 0xd0, 0xf3, 0x71, 0x42, 0xc9, 0xfb, 0x83, 0x72, 0x42, 0xc9, 0xff, 0x01, 0x73, 0x41, 
+  0xc9, 0xe8, 0x90, 0x3a, 0xbc, 0x60, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x8a, 0xe7, 0x6f, 0x81, 0x47, 0x89, 0xe7, 0xff, 0x02, 0x47, 0x88, 0xe7, 0xff, 0x4c, 0x9c, 0xeb, 0xeb, 0x4e, 0xa5, 
+  0xec, 0xff, 0x82, 0x4e, 0xa4, 0xec, 0xff, 0x08, 0x4e, 0xa3, 0xec, 0xff, 0x4f, 0xa8, 0xed, 0xe8, 0x51, 0xb0, 0xed, 0xf7, 0x52, 0xb5, 0xed, 0xef, 0x4b, 0xb5, 0xed, 0xf8, 0x58, 0xbb, 0xef, 0xfb, 
+  0xae, 0xd6, 0xf5, 0xfb, 0xd2, 0xea, 0xfa, 0xeb, 0xfc, 0xfe, 0xff, 0xeb, 0x98, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xfc, 0xec, 0xef, 0xfd, 0xe8, 0xc5, 0xc6, 0xf0, 0xf4, 0x88, 0x85, 
+  0xe1, 0xeb, 0x3c, 0x34, 0xd7, 0xff, 0x4f, 0x4a, 0xd8, 0xff, 0x50, 0x4b, 0xd8, 0xf8, 0x5d, 0x47, 0xd3, 0xfb, 0x82, 0x5f, 0x46, 0xd2, 0xff, 0x01, 0x5e, 0x46, 0xd2, 0xf3, 0x71, 0x42, 0xca, 0xfc, 
+  0x84, 0x72, 0x42, 0xc9, 0xff, 0x00, 0x83, 0x37, 0xbf, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x47, 0x89, 0xe7, 0xff, 0x47, 0x88, 0xe7, 0xff, 0x4c, 0x9d, 0xeb, 0xdf, 0x84, 0x4e, 0xa4, 0xec, 
+  0xff, 0x01, 0x51, 0xaf, 0xed, 0xe7, 0x52, 0xb7, 0xee, 0xfc, 0x81, 0x52, 0xb7, 0xee, 0xff, 0x20, 0x52, 0xb7, 0xee, 0xe3, 0x53, 0xb8, 0xf0, 0xd4, 0x53, 0xb8, 0xee, 0xdf, 0x52, 0xb9, 0xef, 0xe3, 
+  0x52, 0xb9, 0xf0, 0xd7, 0x71, 0xc5, 0xf2, 0xdb, 0x9e, 0xd7, 0xf5, 0xdc, 0xbe, 0xe4, 0xf9, 0xd3, 0xd1, 0xec, 0xfb, 0xd0, 0xd9, 0xef, 0xfb, 0xd3, 0xe1, 0xf1, 0xfc, 0xd0, 0xe5, 0xf2, 0xfd, 0xd8, 
+  0xe6, 0xf2, 0xfd, 0xd8, 0xe7, 0xf3, 0xfd, 0xd8, 0xe7, 0xf2, 0xfc, 0xdc, 0xee, 0xf5, 0xfe, 0xd4, 0xec, 0xf3, 0xfd, 0xd4, 0xe9, 0xf3, 0xfd, 0xd3, 0xea, 0xf3, 0xfd, 0xd3, 0xe5, 0xee, 0xfc, 0xdc, 
+  0xea, 0xf1, 0xfd, 0xdb, 0xeb, 0xf0, 0xfb, 0xd8, 0xec, 0xf2, 0xfd, 0xd7, 0xe7, 0xec, 0xfb, 0xd8, 0xdc, 0xe3, 0xfa, 0xd8, 0xd0, 0xda, 0xf8, 0xd8, 0xc5, 0xd0, 0xf7, 0xd8, 0xbd, 0xc5, 0xf5, 0xd4, 
+  0xa0, 0xa9, 0xf1, 0xdc, 0x69, 0x79, 0xe8, 0xfb, 0x45, 0x57, 0xe3, 0xff, 0x3e, 0x52, 0xe2, 0xff, 0x45, 0x4f, 0xde, 0xef, 0x83, 0x50, 0x4b, 0xd8, 0xff, 0x00, 0x57, 0x49, 0xd5, 0xef, 0x82, 0x5f, 
+  0x46, 0xd2, 0xff, 0x01, 0x5e, 0x46, 0xd2, 0xff, 0x6a, 0x43, 0xcc, 0xf0, 0x83, 0x72, 0x42, 0xc9, 0xff, 0x00, 0x73, 0x42, 0xca, 0xaf, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x46, 0x8a, 0xe8, 0x6c, 
+  0x4a, 0x96, 0xe9, 0xf7, 0x83, 0x4e, 0xa4, 0xec, 0xff, 0x19, 0x4f, 0xa8, 0xed, 0xf8, 0x52, 0xb6, 0xee, 0xe0, 0x52, 0xb8, 0xee, 0xff, 0x52, 0xb8, 0xee, 0xef, 0x52, 0xb8, 0xef, 0xef, 0x54, 0xbb, 
+  0xef, 0xf3, 0x53, 0xba, 0xef, 0xff, 0x53, 0xb9, 0xef, 0xff, 0x53, 0xb9, 0xee, 0xf7, 0x53, 0xba, 0xef, 0xf4, 0x53, 0xb9, 0xef, 0xff, 0x51, 0xb9, 0xef, 0xff, 0x4c, 0xb8, 0xef, 0xff, 0x45, 0xb6, 
+  0xee, 0xe4, 0x41, 0xb4, 0xee, 0xf7, 0x3e, 0xb3, 0xed, 0xfb, 0x38, 0xad, 0xec, 0xeb, 0x33, 0xa4, 0xec, 0xf0, 0x36, 0xa4, 0xec, 0xff, 0x35, 0xa5, 0xec, 0xff, 0x2e, 0x9f, 0xeb, 0xe7, 0x29, 0x8f, 
+  0xe9, 0xfc, 0x2b, 0x8f, 0xe9, 0xff, 0x2c, 0x8f, 0xe9, 0xff, 0x2a, 0x90, 0xea, 0xf3, 0x20, 0x74, 0xe4, 0xf3, 0x81, 0x1f, 0x72, 0xe5, 0xff, 0x07, 0x1f, 0x73, 0xe5, 0xff, 0x12, 0x5e, 0xe3, 0xe4, 
+  0x20, 0x57, 0xe3, 0xff, 0x25, 0x59, 0xe3, 0xff, 0x2a, 0x5a, 0xe3, 0xff, 0x29, 0x4f, 0xe2, 0xf0, 0x2f, 0x47, 0xe1, 0xff, 0x39, 0x4d, 0xe2, 0xff, 0x81, 0x3d, 0x51, 0xe2, 0xff, 0x00, 0x3c, 0x51, 
+  0xe2, 0xec, 0x83, 0x50, 0x4b, 0xd8, 0xff, 0x01, 0x51, 0x4b, 0xd9, 0xe0, 0x60, 0x46, 0xd2, 0xff, 0x82, 0x5f, 0x46, 0xd2, 0xff, 0x01, 0x62, 0x46, 0xd0, 0xd3, 0x73, 0x42, 0xc9, 0xff, 0x82, 0x72, 
+  0x42, 0xc9, 0xff, 0x00, 0x6f, 0x40, 0xca, 0x1c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x99, 0xeb, 0x08, 0x4e, 0xa3, 0xec, 0xdc, 0x82, 0x4e, 0xa4, 0xec, 0xff, 0x13, 0x4f, 0xa8, 0xec, 0xf0, 
+  0x52, 0xb7, 0xee, 0xf7, 0x52, 0xb7, 0xee, 0xff, 0x52, 0xb8, 0xee, 0xe8, 0x53, 0xba, 0xef, 0xfb, 0x53, 0xba, 0xef, 0xff, 0x53, 0xb9, 0xef, 0xe8, 0x55, 0xc3, 0xf0, 0xdf, 0x57, 0xc9, 0xf2, 0xff, 
+  0x57, 0xca, 0xf2, 0xfc, 0x57, 0xca, 0xf2, 0xfb, 0x57, 0xca, 0xf2, 0xff, 0x55, 0xc6, 0xf0, 0xe8, 0x53, 0xbd, 0xf0, 0xd0, 0x53, 0xb9, 0xef, 0xff, 0x53, 0xba, 0xef, 0xff, 0x53, 0xba, 0xef, 0xf8, 
+  0x52, 0xb7, 0xee, 0xe7, 0x52, 0xb7, 0xee, 0xf8, 0x4f, 0xaa, 0xed, 0xdb, 0x81, 0x4f, 0xaa, 0xed, 0xff, 0x01, 0x4d, 0xa3, 0xec, 0xf4, 0x4a, 0x97, 0xea, 0xfc, 0x81, 0x4a, 0x97, 0xea, 0xff, 0x00, 
+  0x4a, 0x93, 0xe8, 0xf0, 0x82, 0x45, 0x7e, 0xe6, 0xff, 0x01, 0x45, 0x7e, 0xe5, 0xfc, 0x41, 0x64, 0xe4, 0xf0, 0x81, 0x41, 0x66, 0xe4, 0xff, 0x01, 0x41, 0x63, 0xe4, 0xe3, 0x3d, 0x51, 0xe2, 0xfc, 
+  0x82, 0x3d, 0x51, 0xe2, 0xff, 0x01, 0x3c, 0x51, 0xe3, 0xff, 0x4a, 0x4d, 0xda, 0xf3, 0x82, 0x50, 0x4b, 0xd8, 0xff, 0x01, 0x4f, 0x4b, 0xd8, 0xff, 0x5c, 0x46, 0xd2, 0xef, 0x82, 0x5f, 0x46, 0xd2, 
+  0xff, 0x01, 0x5e, 0x46, 0xd2, 0xf8, 0x73, 0x42, 0xc8, 0xff, 0x81, 0x72, 0x42, 0xc9, 0xff, 0x00, 0x72, 0x42, 0xc9, 0x8c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x4e, 0xa4, 0xec, 0x50, 0x4e, 0xa4, 
+  0xec, 0xfc, 0x4e, 0xa4, 0xec, 0xff, 0x4f, 0xa8, 0xed, 0xf8, 0x52, 0xb8, 0xee, 0xf0, 0x52, 0xb7, 0xee, 0xfc, 0x52, 0xb9, 0xee, 0xd8, 0x53, 0xba, 0xef, 0xff, 0x53, 0xbb, 0xef, 0xfb, 0x54, 0xc3, 
+  0xf1, 0xdf, 0x57, 0xcc, 0xf2, 0xfc, 0x85, 0x57, 0xcc, 0xf2, 0xff, 0x0a, 0x57, 0xcd, 0xf2, 0xff, 0x56, 0xca, 0xf1, 0xf4, 0x54, 0xbe, 0xf0, 0xe8, 0x53, 0xba, 0xef, 0xfc, 0x53, 0xba, 0xef, 0xf4, 
+  0x52, 0xb8, 0xee, 0xf0, 0x52, 0xb6, 0xee, 0xfc, 0x4f, 0xaa, 0xed, 0xeb, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xab, 0xed, 0xf8, 0x4b, 0x9c, 0xeb, 0xf4, 0x81, 0x4a, 0x97, 0xea, 0xff, 0x01, 0x4a, 0x97, 
+  0xea, 0xfc, 0x47, 0x87, 0xe7, 0xeb, 0x81, 0x45, 0x7e, 0xe6, 0xff, 0x05, 0x45, 0x7f, 0xe6, 0xff, 0x43, 0x70, 0xe5, 0xe4, 0x41, 0x65, 0xe4, 0xff, 0x41, 0x66, 0xe4, 0xff, 0x41, 0x67, 0xe4, 0xf4, 
+  0x3d, 0x53, 0xe2, 0xf7, 0x83, 0x3d, 0x51, 0xe2, 0xff, 0x01, 0x41, 0x50, 0xdf, 0xdc, 0x51, 0x4b, 0xd8, 0xff, 0x82, 0x50, 0x4b, 0xd8, 0xff, 0x00, 0x56, 0x48, 0xd6, 0xcf, 0x82, 0x5f, 0x46, 0xd2, 
+  0xff, 0x04, 0x5e, 0x46, 0xd2, 0xff, 0x6d, 0x44, 0xcc, 0xe8, 0x72, 0x42, 0xc9, 0xff, 0x72, 0x42, 0xc9, 0xdf, 0x6f, 0x42, 0xc9, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4e, 0xa4, 0xec, 0x5c, 
+  0x4e, 0xa5, 0xec, 0xff, 0x51, 0xb5, 0xee, 0xf0, 0x52, 0xb7, 0xee, 0xff, 0x53, 0xb8, 0xee, 0xec, 0x53, 0xba, 0xef, 0xff, 0x55, 0xbe, 0xf0, 0xef, 0x57, 0xca, 0xf1, 0xf4, 0x89, 0x57, 0xcc, 0xf2, 
+  0xff, 0x05, 0x57, 0xcc, 0xf2, 0xfc, 0x55, 0xc6, 0xf0, 0xf4, 0x53, 0xb9, 0xef, 0xf4, 0x53, 0xba, 0xef, 0xf8, 0x52, 0xb7, 0xef, 0xe8, 0x51, 0xb4, 0xee, 0xe8, 0x81, 0x4f, 0xaa, 0xed, 0xff, 0x01, 
+  0x4f, 0xaa, 0xed, 0xf4, 0x4a, 0x97, 0xea, 0xf8, 0x81, 0x4a, 0x97, 0xea, 0xff, 0x00, 0x49, 0x91, 0xe9, 0xe7, 0x82, 0x45, 0x7e, 0xe6, 0xff, 0x01, 0x44, 0x7a, 0xe6, 0xf8, 0x41, 0x66, 0xe4, 0xf4, 
+  0x81, 0x41, 0x66, 0xe4, 0xff, 0x01, 0x40, 0x5f, 0xe3, 0xcc, 0x3d, 0x50, 0xe2, 0xff, 0x82, 0x3d, 0x51, 0xe2, 0xff, 0x01, 0x3e, 0x51, 0xe2, 0xfb, 0x4f, 0x4b, 0xd8, 0xfb, 0x82, 0x50, 0x4b, 0xd8, 
+  0xff, 0x01, 0x52, 0x4a, 0xd7, 0xf3, 0x60, 0x46, 0xd2, 0xff, 0x82, 0x5f, 0x46, 0xd2, 0xff, 0x02, 0x68, 0x44, 0xce, 0xdc, 0x72, 0x42, 0xc9, 0xdb, 0x72, 0x41, 0xc9, 0x1c, 0x88, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0x50, 0xb4, 0xf0, 0x57, 0x52, 0xb7, 0xee, 0xf7, 0x52, 0xb9, 0xee, 0xe7, 0x53, 0xba, 0xef, 0xff, 0x54, 0xbc, 0xef, 0xe4, 0x8d, 0x57, 0xcc, 0xf2, 0xff, 0x04, 0x56, 0xc7, 0xf1, 0xf0, 
+  0x53, 0xba, 0xef, 0xf8, 0x53, 0xba, 0xef, 0xfb, 0x52, 0xb8, 0xee, 0xf4, 0x51, 0xae, 0xed, 0xd3, 0x81, 0x4f, 0xaa, 0xed, 0xff, 0x00, 0x4d, 0xa3, 0xed, 0xe4, 0x81, 0x4a, 0x97, 0xea, 0xff, 0x01, 
+  0x4a, 0x98, 0xeb, 0xf7, 0x45, 0x80, 0xe6, 0xfc, 0x81, 0x45, 0x7e, 0xe6, 0xff, 0x01, 0x45, 0x7d, 0xe6, 0xf8, 0x42, 0x6a, 0xe4, 0xf7, 0x81, 0x41, 0x66, 0xe4, 0xff, 0x01, 0x41, 0x66, 0xe4, 0xf0, 
+  0x3d, 0x50, 0xe2, 0xff, 0x83, 0x3d, 0x51, 0xe2, 0xff, 0x00, 0x4c, 0x4c, 0xda, 0xe8, 0x82, 0x50, 0x4b, 0xd8, 0xff, 0x01, 0x51, 0x4b, 0xd8, 0xff, 0x5e, 0x47, 0xd2, 0xfb, 0x82, 0x5f, 0x46, 0xd2, 
+  0xff, 0x01, 0x62, 0x46, 0xd1, 0xcb, 0x77, 0x40, 0xc6, 0x1b, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x52, 0xb5, 0xef, 0x2f, 0x53, 0xba, 0xef, 0xb0, 0x54, 0xbd, 0xef, 0xf7, 0x8f, 0x57, 0xcc, 0xf2, 
+  0xff, 0x0b, 0x55, 0xc2, 0xf0, 0xe3, 0x53, 0xba, 0xef, 0xff, 0x53, 0xb8, 0xef, 0xef, 0x52, 0xb7, 0xee, 0xff, 0x4f, 0xab, 0xed, 0xe0, 0x4f, 0xaa, 0xed, 0xff, 0x4e, 0xa8, 0xed, 0xf8, 0x4a, 0x99, 
+  0xea, 0xf7, 0x4a, 0x97, 0xea, 0xff, 0x4a, 0x98, 0xea, 0xff, 0x47, 0x8d, 0xe8, 0xdb, 0x45, 0x7d, 0xe6, 0xff, 0x81, 0x45, 0x7e, 0xe6, 0xff, 0x00, 0x43, 0x6f, 0xe4, 0xec, 0x82, 0x41, 0x66, 0xe4, 
+  0xff, 0x00, 0x3e, 0x54, 0xe2, 0xeb, 0x83, 0x3d, 0x51, 0xe2, 0xff, 0x00, 0x49, 0x4e, 0xdd, 0xe8, 0x82, 0x50, 0x4b, 0xd8, 0xff, 0x05, 0x50, 0x4b, 0xd8, 0xfb, 0x5c, 0x47, 0xd3, 0xec, 0x5f, 0x46, 
+  0xd2, 0xff, 0x5f, 0x46, 0xd2, 0xfb, 0x5e, 0x46, 0xd2, 0x7f, 0x5e, 0x4f, 0xd8, 0x08, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x53, 0xbc, 0xf4, 0x03, 0x56, 0xca, 0xf1, 0x38, 0x57, 0xcc, 0xf2, 0xcf, 
+  0x8e, 0x57, 0xcc, 0xf2, 0xff, 0x07, 0x57, 0xcd, 0xf2, 0xff, 0x53, 0xba, 0xef, 0xd4, 0x53, 0xba, 0xef, 0xff, 0x52, 0xb7, 0xee, 0xef, 0x51, 0xb2, 0xee, 0xf4, 0x4f, 0xaa, 0xed, 0xff, 0x4f, 0xaa, 
+  0xed, 0xfc, 0x4b, 0x9c, 0xea, 0xfc, 0x81, 0x4a, 0x97, 0xea, 0xff, 0x01, 0x4b, 0x96, 0xea, 0xf4, 0x45, 0x7d, 0xe6, 0xff, 0x81, 0x45, 0x7e, 0xe6, 0xff, 0x00, 0x44, 0x75, 0xe5, 0xd8, 0x82, 0x41, 
+  0x66, 0xe4, 0xff, 0x00, 0x3f, 0x5b, 0xe3, 0xdb, 0x83, 0x3d, 0x51, 0xe2, 0xff, 0x00, 0x46, 0x4f, 0xde, 0xff, 0x82, 0x50, 0x4b, 0xd8, 0xff, 0x03, 0x50, 0x4b, 0xd8, 0xfc, 0x5b, 0x48, 0xd3, 0xe4, 
+  0x5f, 0x46, 0xd2, 0x8b, 0x5a, 0x49, 0xd1, 0x10, 0x91, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5c, 0xcb, 0xf6, 0x10, 0x57, 0xcb, 0xf3, 0x50, 0x57, 0xcd, 0xf2, 0x8c, 0x57, 0xcc, 0xf2, 0xa8, 0x57, 0xcc, 
+  0xf2, 0xb3, 0x57, 0xcc, 0xf2, 0xbc, 0x81, 0x57, 0xcc, 0xf2, 0xbf, 0x82, 0x57, 0xcc, 0xf2, 0xc0, 0x83, 0x57, 0xcc, 0xf2, 0xc3, 0x08, 0x57, 0xcc, 0xf2, 0xc4, 0x56, 0xc8, 0xf1, 0xbf, 0x53, 0xb9, 
+  0xef, 0xc3, 0x53, 0xb9, 0xee, 0xa4, 0x51, 0xb4, 0xee, 0xb3, 0x4f, 0xaa, 0xed, 0xbf, 0x4f, 0xaa, 0xed, 0xc3, 0x4e, 0xa2, 0xec, 0xb4, 0x4a, 0x97, 0xea, 0xc7, 0x81, 0x4a, 0x97, 0xea, 0xc4, 0x00, 
+  0x46, 0x84, 0xe8, 0xb7, 0x81, 0x45, 0x7e, 0xe6, 0xc4, 0x00, 0x45, 0x7d, 0xe6, 0xbc, 0x82, 0x41, 0x66, 0xe4, 0xc4, 0x00, 0x40, 0x5f, 0xe4, 0xb8, 0x81, 0x3d, 0x52, 0xe2, 0xc4, 0x81, 0x3d, 0x52, 
+  0xe2, 0xc3, 0x04, 0x46, 0x4f, 0xde, 0xbc, 0x50, 0x4b, 0xd8, 0xb0, 0x50, 0x4b, 0xd8, 0xa4, 0x50, 0x4b, 0xd8, 0x78, 0x51, 0x4b, 0xd8, 0x43, 0x99, 0x00, 0x00, 0x00, 0x00, 0x12, 0x57, 0xce, 0xf1, 
+  0x04, 0x53, 0xd0, 0xf2, 0x07, 0x58, 0xc9, 0xf2, 0x07, 0x53, 0xcc, 0xf2, 0x07, 0x58, 0xce, 0xf2, 0x07, 0x54, 0xcb, 0xf4, 0x07, 0x59, 0xca, 0xf4, 0x07, 0x58, 0xcd, 0xf4, 0x07, 0x59, 0xcf, 0xf5, 
+  0x08, 0x57, 0xca, 0xf3, 0x08, 0x56, 0xcd, 0xf0, 0x08, 0x5b, 0xce, 0xf1, 0x08, 0x58, 0xc0, 0xef, 0x07, 0x52, 0xbe, 0xea, 0x08, 0x52, 0xb8, 0xef, 0x07, 0x50, 0xad, 0xea, 0x07, 0x51, 0xac, 0xea, 
+  0x07, 0x4a, 0xa8, 0xed, 0x08, 0x4a, 0x98, 0xea, 0x08, 0x81, 0x4a, 0x99, 0xea, 0x08, 0x0c, 0x49, 0x88, 0xe7, 0x08, 0x43, 0x7e, 0xe6, 0x08, 0x45, 0x81, 0xe6, 0x08, 0x46, 0x84, 0xe8, 0x08, 0x42, 
+  0x6f, 0xe1, 0x08, 0x42, 0x64, 0xe4, 0x08, 0x43, 0x66, 0xe7, 0x08, 0x43, 0x67, 0xe5, 0x08, 0x40, 0x61, 0xe4, 0x08, 0x40, 0x5a, 0xdf, 0x08, 0x40, 0x5f, 0xe1, 0x08, 0x40, 0x5f, 0xe5, 0x07, 0x42, 
+  0x5a, 0xe8, 0x04, 0x8e, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +950,7 @@ const lv_img_dsc_t instagram_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( instagram_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = instagram_64px_map,
 };
-
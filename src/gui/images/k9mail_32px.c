@@ -10,143 +10,207 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_K9MAIL_32PX uint8_t k9mail_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x48, 0x96, 0xb3, 0x96, 0xb7, 0x96, 0xb7, 0x96, 0xb7, 0x96, 0xa7, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1b, 0x96, 0xa7, 0x96, 0xb7, 0x96, 0xb7, 0x96, 0xb7, 0x96, 0xb3, 0x92, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x92, 0xb3, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x72, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x63, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xb3, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x92, 0xb7, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x72, 0x64, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0x64, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xb4, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x57, 0x72, 0xbf, 0x72, 0xc3, 0x72, 0xd8, 0x72, 0xff, 0x72, 0xb4, 0x4e, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x27, 0x72, 0xb4, 0x72, 0xff, 0x72, 0xd8, 0x72, 0xc3, 0x72, 0xbf, 0x72, 0x58, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x1f, 0x49, 0x74, 0x49, 0xff, 0x00, 0x24, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x24, 0x49, 0xff, 0x29, 0x74, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x24, 0xea, 0xd0, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd0, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe9, 0x9f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xb7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xb7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xb7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe5, 0xb0, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe5, 0x5f, 0xe5, 0xfc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xfc, 0xe5, 0x5f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xa5, 0x4b, 0xa9, 0xc0, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xa9, 0xc0, 0xa5, 0x4b, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x29, 0x2c, 0x72, 0xe4, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xe4, 0x25, 0x2c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4e, 0x5c, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0x5c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x72, 0xa4, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xa4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x29, 0x27, 0x72, 0xe0, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xe0, 0x29, 0x27, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4e, 0x58, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x29, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x4e, 0x58, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x72, 0xa0, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xa0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x25, 0x1c, 0x6e, 0x94, 0x72, 0xc4, 0x72, 0xc4, 0x72, 0xc7, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x72, 0xc7, 0x72, 0xc4, 0x72, 0xc4, 0x6e, 0x94, 0x25, 0x1c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x18, 0x00, 0x1c, 0x29, 0xd7, 0x29, 0xff, 0x29, 0xff, 0x29, 0xd7, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x25, 0x34, 0x29, 0xac, 0x29, 0xac, 0x25, 0x34, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x87, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x04, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x04, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x01, 
+  0x96, 0x48, 0x96, 0xb3, 0x82, 0x96, 0xb7, 0x01, 0x96, 0xa7, 0x92, 0x1b, 0x83, 0x00, 0x00, 0x01, 0x92, 0x1b, 0x96, 0xa7, 0x82, 0x96, 0xb7, 0x01, 0x96, 0xb3, 0x92, 0x48, 0x8c, 0x00, 0x00, 0x01, 
+  0x00, 0x04, 0x92, 0xb3, 0x84, 0x96, 0xff, 0x00, 0x72, 0x63, 0x83, 0x00, 0x00, 0x00, 0x72, 0x63, 0x84, 0x92, 0xff, 0x01, 0x92, 0xb3, 0x00, 0x04, 0x8b, 0x00, 0x00, 0x01, 0x00, 0x07, 0x92, 0xb7, 
+  0x84, 0x96, 0xff, 0x01, 0x72, 0x64, 0x00, 0x03, 0x81, 0x00, 0x00, 0x01, 0x00, 0x03, 0x72, 0x64, 0x84, 0x92, 0xff, 0x01, 0x72, 0xb4, 0x00, 0x07, 0x8b, 0x00, 0x00, 0x07, 0x00, 0x04, 0x72, 0x57, 
+  0x72, 0xbf, 0x72, 0xc3, 0x72, 0xd8, 0x72, 0xff, 0x72, 0xb4, 0x4e, 0x27, 0x83, 0x00, 0x00, 0x07, 0x4e, 0x27, 0x72, 0xb4, 0x72, 0xff, 0x72, 0xd8, 0x72, 0xc3, 0x72, 0xbf, 0x72, 0x58, 0x00, 0x04, 
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x07, 0x06, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x1f, 0x49, 0x74, 0x49, 0xff, 0x00, 0x24, 0x00, 0x0b, 0x83, 0x00, 0x07, 0x06, 0x00, 0x0b, 0x00, 0x24, 
+  0x49, 0xff, 0x29, 0x74, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x0f, 0x81, 0x00, 0x07, 0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x01, 0xea, 0x24, 0xea, 0xd0, 0x92, 0xea, 0xff, 0x82, 0xe9, 0xff, 0x01, 0xe9, 
+  0xd0, 0xe9, 0x24, 0x84, 0x00, 0x00, 0x01, 0x00, 0x03, 0xe9, 0x9f, 0x97, 0xe9, 0xff, 0x01, 0xe9, 0x9f, 0x00, 0x03, 0x83, 0x00, 0x00, 0x05, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xf7, 0xff, 0xfb, 
+  0xff, 0xee, 0xff, 0x8f, 0xe9, 0xff, 0x05, 0xee, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x07, 0x00, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xea, 0xff, 0xf7, 
+  0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0x8b, 0xe9, 0xff, 0x07, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 
+  0x04, 0xe9, 0xb7, 0x82, 0xe9, 0xff, 0x04, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0x87, 0xe9, 0xff, 0x04, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0x82, 
+  0xe5, 0xff, 0x01, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe9, 0xb7, 0x84, 0xe9, 0xff, 0x04, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0x84, 0xe9, 0xff, 
+  0x03, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0x84, 0xe5, 0xff, 0x01, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe9, 0xb7, 0x86, 0xe9, 0xff, 0x03, 0xf2, 0xff, 0xfb, 
+  0xff, 0xff, 0xff, 0xf7, 0xff, 0x81, 0xe9, 0xff, 0x03, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0x86, 0xe5, 0xff, 0x01, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe9, 
+  0xb7, 0x88, 0xe9, 0xff, 0x01, 0xf2, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x88, 0xe5, 0xff, 0x01, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe5, 0xb7, 0x88, 
+  0xe9, 0xff, 0x81, 0xe5, 0xff, 0x81, 0xf2, 0xff, 0x8a, 0xe5, 0xff, 0x01, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe5, 0xb7, 0x83, 0xe9, 0xff, 0x93, 0xe5, 0xff, 0x01, 0xe5, 
+  0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe5, 0xb7, 0x97, 0xe5, 0xff, 0x01, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe5, 0xb7, 0x97, 0xe5, 0xff, 0x01, 0xe5, 
+  0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe5, 0xb7, 0x97, 0xe5, 0xff, 0x01, 0xe5, 0xb7, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe5, 0xb0, 0x97, 0xe5, 0xff, 0x01, 0xe5, 
+  0xb0, 0x00, 0x04, 0x83, 0x00, 0x00, 0x02, 0x00, 0x03, 0xe5, 0x5f, 0xe5, 0xfc, 0x95, 0xe5, 0xff, 0x02, 0xe5, 0xfc, 0xe5, 0x5f, 0x00, 0x03, 0x84, 0x00, 0x00, 0x02, 0x00, 0x0c, 0xa5, 0x4b, 0xa9, 
+  0xc0, 0x93, 0xae, 0xff, 0x02, 0xa9, 0xc0, 0xa5, 0x4b, 0x00, 0x0c, 0x86, 0x00, 0x00, 0x02, 0x00, 0x07, 0x29, 0x2c, 0x72, 0xe4, 0x91, 0x72, 0xff, 0x02, 0x72, 0xe4, 0x25, 0x2c, 0x00, 0x07, 0x88, 
+  0x00, 0x00, 0x02, 0x00, 0x07, 0x4e, 0x5c, 0x72, 0xfc, 0x90, 0x72, 0xff, 0x01, 0x4e, 0x5c, 0x00, 0x07, 0x8a, 0x00, 0x00, 0x01, 0x00, 0x10, 0x72, 0xa4, 0x8f, 0x72, 0xff, 0x01, 0x72, 0xa4, 0x00, 
+  0x10, 0x8b, 0x00, 0x00, 0x02, 0x00, 0x03, 0x29, 0x27, 0x72, 0xe0, 0x84, 0x72, 0xff, 0x00, 0x6e, 0xff, 0x81, 0x4e, 0xff, 0x00, 0x6e, 0xff, 0x84, 0x72, 0xff, 0x02, 0x72, 0xe0, 0x29, 0x27, 0x00, 
+  0x03, 0x8c, 0x00, 0x00, 0x02, 0x00, 0x07, 0x4e, 0x58, 0x72, 0xfc, 0x83, 0x72, 0xff, 0x82, 0x49, 0xff, 0x00, 0x29, 0xff, 0x83, 0x72, 0xff, 0x02, 0x72, 0xfc, 0x4e, 0x58, 0x00, 0x07, 0x8e, 0x00, 
+  0x00, 0x01, 0x00, 0x10, 0x72, 0xa0, 0x83, 0x72, 0xff, 0x83, 0x29, 0xff, 0x83, 0x72, 0xff, 0x01, 0x72, 0xa0, 0x00, 0x10, 0x8f, 0x00, 0x00, 0x02, 0x00, 0x03, 0x25, 0x1c, 0x6e, 0x94, 0x81, 0x72, 
+  0xc4, 0x00, 0x72, 0xc7, 0x83, 0x29, 0xff, 0x00, 0x72, 0xc7, 0x81, 0x72, 0xc4, 0x02, 0x6e, 0x94, 0x25, 0x1c, 0x00, 0x03, 0x90, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x18, 
+  0x00, 0x1c, 0x29, 0xd7, 0x81, 0x29, 0xff, 0x05, 0x29, 0xd7, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x03, 0x95, 0x00, 0x00, 0x01, 0x00, 0x03, 0x25, 0x34, 0x81, 0x29, 0xac, 0x01, 
+  0x25, 0x34, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x8d, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x84, 0x48, 0xb4, 0x84, 0xb3, 0xb4, 0x84, 0xb7, 0xb4, 0x84, 0xb7, 0xb4, 0x84, 0xb7, 0xb4, 0x84, 0xa7, 0x32, 0x74, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x74, 0x1b, 0xb4, 0x7c, 0xa7, 0x94, 0x7c, 0xb7, 0x94, 0x7c, 0xb7, 0x94, 0x7c, 0xb7, 0x93, 0x7c, 0xb3, 0x73, 0x7c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x93, 0x7c, 0xb3, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x52, 0x74, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x74, 0x63, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x53, 0x74, 0xb3, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x7c, 0xb7, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x32, 0x6c, 0x64, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x6c, 0x64, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x52, 0x74, 0xb4, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd0, 0x63, 0x57, 0x32, 0x74, 0xbf, 0x32, 0x74, 0xc3, 0x11, 0x6c, 0xd8, 0xf1, 0x6b, 0xff, 0x32, 0x74, 0xb4, 0xed, 0x4a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x4a, 0x27, 0x11, 0x6c, 0xb4, 0xf0, 0x6b, 0xff, 0x11, 0x6c, 0xd8, 0x32, 0x6c, 0xc3, 0x12, 0x6c, 0xbf, 0xb0, 0x63, 0x58, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x09, 0x32, 0x74, 0x8a, 0x42, 0xff, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x6a, 0x42, 0xff, 0x08, 0x32, 0x74, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xea, 0x24, 0x2d, 0xfa, 0xd0, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x0c, 0xfa, 0xff, 0x0c, 0xfa, 0xff, 0x0c, 0xfa, 0xff, 0x0c, 0xfa, 0xff, 0x0c, 0xfa, 0xff, 0x0c, 0xfa, 0xff, 0xec, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xec, 0xf9, 0xd0, 0x0c, 0xea, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0xf9, 0x9f, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0x9f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0xf9, 0xb7, 0xcc, 0xf9, 0xff, 0xd4, 0xfc, 0xff, 0x18, 0xfe, 0xff, 0x2f, 0xfb, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x2f, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0xb4, 0xfc, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xab, 0xf9, 0xb7, 0xcc, 0xf9, 0xff, 0x6d, 0xfa, 0xff, 0x97, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0xd8, 0xfd, 0xff, 0xce, 0xfa, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xae, 0xfa, 0xff, 0xd7, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x76, 0xfd, 0xff, 0x4d, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x6a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xab, 0xf9, 0xb7, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xce, 0xfa, 0xff, 0xd8, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x77, 0xfd, 0xff, 0x6d, 0xfa, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x4d, 0xfa, 0xff, 0x76, 0xfd, 0xff, 0x1c, 0xff, 0xff, 0xd7, 0xfd, 0xff, 0xae, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xab, 0xf9, 0xb7, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x2f, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0x1c, 0xff, 0xff, 0x35, 0xfd, 0xff, 0x0c, 0xfa, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0x35, 0xfd, 0xff, 0x1c, 0xff, 0xff, 0x18, 0xfe, 0xff, 0x2f, 0xfb, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x90, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xd4, 0xfc, 0xff, 0xcb, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xd4, 0xfc, 0xff, 0xfb, 0xfe, 0xff, 0x59, 0xfe, 0xff, 0x90, 0xfb, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x11, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0xdb, 0xfe, 0xff, 0xdb, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0xf1, 0xfb, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x73, 0xfc, 0xff, 0x73, 0xfc, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0xf9, 0xb7, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0xf9, 0xb7, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0xf9, 0xb7, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0xf9, 0xb0, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x29, 0xf9, 0xb0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x29, 0xd9, 0x5f, 0x6a, 0xf9, 0xfc, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xfc, 0x08, 0xd9, 0x5f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xe7, 0xa8, 0x4b, 0x2b, 0xaa, 0xc0, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0xcd, 0xa2, 0xff, 0x0a, 0xaa, 0xc0, 0xc6, 0xa8, 0x4b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x87, 0x29, 0x2c, 0xd1, 0x63, 0xe4, 0x11, 0x6c, 0xff, 0x11, 0x6c, 0xff, 0xf1, 0x6b, 0xff, 0xf1, 0x6b, 0xff, 0xf1, 0x6b, 0xff, 0xf1, 0x6b, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xb0, 0x63, 0xe4, 0x87, 0x29, 0x2c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2e, 0x53, 0x5c, 0x32, 0x6c, 0xfc, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x0d, 0x4b, 0x5c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd0, 0x63, 0xa4, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xb0, 0x5b, 0xa4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa7, 0x29, 0x27, 0xf1, 0x63, 0xe0, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x4e, 0x53, 0xff, 0xec, 0x4a, 0xff, 0xec, 0x4a, 0xff, 0x4e, 0x53, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xf1, 0x63, 0xe0, 0xa7, 0x29, 0x27, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x4b, 0x58, 0x12, 0x6c, 0xfc, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0x12, 0x64, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xfc, 0x0d, 0x4b, 0x58, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xb0, 0x5b, 0xa0, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x64, 0xff, 0xc8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0x11, 0x64, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x90, 0x5b, 0xa0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x19, 0x1c, 0x6f, 0x5b, 0x94, 0xb0, 0x5b, 0xc4, 0xb0, 0x5b, 0xc4, 0xb0, 0x5b, 0xc7, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0x90, 0x5b, 0xc7, 0xb0, 0x5b, 0xc4, 0xb0, 0x5b, 0xc4, 0x6f, 0x53, 0x94, 0x04, 0x19, 0x1c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c, 0xc7, 0x29, 0xd7, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xa7, 0x29, 0xd7, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x25, 0x19, 0x34, 0x87, 0x29, 0xac, 0x87, 0x29, 0xac, 0x25, 0x19, 0x34, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x04, 
+  0x00, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x93, 0x84, 0x48, 0xb4, 0x84, 0xb3, 0x82, 0xb4, 0x84, 0xb7, 0x01, 0xb4, 0x84, 0xa7, 0x32, 0x74, 0x1b, 0x83, 0x00, 0x00, 0x00, 0x01, 0x32, 
+  0x74, 0x1b, 0xb4, 0x7c, 0xa7, 0x82, 0x94, 0x7c, 0xb7, 0x01, 0x93, 0x7c, 0xb3, 0x73, 0x7c, 0x48, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x93, 0x7c, 0xb3, 0x84, 0x94, 0x7c, 0xff, 0x00, 
+  0x52, 0x74, 0x63, 0x83, 0x00, 0x00, 0x00, 0x00, 0x32, 0x74, 0x63, 0x83, 0x93, 0x7c, 0xff, 0x02, 0x73, 0x7c, 0xff, 0x53, 0x74, 0xb3, 0x00, 0x00, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x07, 0x73, 0x7c, 0xb7, 0x84, 0x94, 0x7c, 0xff, 0x01, 0x32, 0x6c, 0x64, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x12, 0x6c, 0x64, 0x82, 0x93, 0x7c, 0xff, 0x81, 0x73, 
+  0x7c, 0xff, 0x01, 0x52, 0x74, 0xb4, 0x00, 0x00, 0x07, 0x8b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0xd0, 0x63, 0x57, 0x32, 0x74, 0xbf, 0x32, 0x74, 0xc3, 0x11, 0x6c, 0xd8, 0xf1, 0x6b, 0xff, 
+  0x32, 0x74, 0xb4, 0xed, 0x4a, 0x27, 0x83, 0x00, 0x00, 0x00, 0x07, 0xec, 0x4a, 0x27, 0x11, 0x6c, 0xb4, 0xf0, 0x6b, 0xff, 0x11, 0x6c, 0xd8, 0x32, 0x6c, 0xc3, 0x12, 0x6c, 0xbf, 0xb0, 0x63, 0x58, 
+  0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x09, 0x32, 0x74, 0x8a, 0x42, 0xff, 0x00, 
+  0x00, 0x24, 0x00, 0x00, 0x0b, 0x83, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x6a, 0x42, 0xff, 0x08, 0x32, 0x74, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x0f, 0x81, 
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x00, 0x01, 0x2c, 0xea, 0x24, 0x2d, 0xfa, 0xd0, 0x81, 0x2d, 0xfa, 0xff, 0x84, 0x0d, 0xfa, 0xff, 0x85, 0x0c, 0xfa, 0xff, 0x87, 0xec, 
+  0xf9, 0xff, 0x02, 0xcc, 0xf9, 0xff, 0xec, 0xf9, 0xd0, 0x0c, 0xea, 0x24, 0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xec, 0xf9, 0x9f, 0x88, 0xcc, 0xf9, 0xff, 0x83, 0xac, 0xf9, 0xff, 0x85, 
+  0xab, 0xf9, 0xff, 0x84, 0x8b, 0xf9, 0xff, 0x01, 0x8b, 0xf9, 0x9f, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0xcb, 0xf9, 0xb7, 0xcc, 0xf9, 0xff, 0xd4, 0xfc, 0xff, 0x18, 
+  0xfe, 0xff, 0x2f, 0xfb, 0xff, 0x81, 0xcc, 0xf9, 0xff, 0x82, 0xac, 0xf9, 0xff, 0x01, 0xab, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0x85, 0xab, 0xf9, 0xff, 0x82, 0x8b, 0xf9, 0xff, 0x05, 0x2f, 0xfb, 0xff, 
+  0x18, 0xfe, 0xff, 0xb4, 0xfc, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0xab, 0xf9, 0xb7, 0xcc, 0xf9, 0xff, 0x6d, 0xfa, 0xff, 
+  0x97, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0xd8, 0xfd, 0xff, 0xce, 0xfa, 0xff, 0x8a, 0xab, 0xf9, 0xff, 0x08, 0x8b, 0xf9, 0xff, 0xae, 0xfa, 0xff, 0xd7, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x76, 0xfd, 0xff, 
+  0x4d, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x6a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xab, 0xf9, 0xb7, 0x82, 0xac, 0xf9, 0xff, 0x04, 0xce, 0xfa, 0xff, 0xd8, 
+  0xfd, 0xff, 0x3c, 0xff, 0xff, 0x77, 0xfd, 0xff, 0x6d, 0xfa, 0xff, 0x85, 0xab, 0xf9, 0xff, 0x81, 0x8b, 0xf9, 0xff, 0x05, 0x4d, 0xfa, 0xff, 0x76, 0xfd, 0xff, 0x1c, 0xff, 0xff, 0xd7, 0xfd, 0xff, 
+  0xae, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x81, 0x6b, 0xf9, 0xff, 0x01, 0x6a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xab, 0xf9, 0xb7, 0x84, 0xab, 0xf9, 0xff, 
+  0x05, 0x2f, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0x1c, 0xff, 0xff, 0x35, 0xfd, 0xff, 0x0c, 0xfa, 0xff, 0xab, 0xf9, 0xff, 0x82, 0x8b, 0xf9, 0xff, 0x05, 0xec, 0xf9, 0xff, 0x35, 0xfd, 0xff, 0x1c, 0xff, 
+  0xff, 0x18, 0xfe, 0xff, 0x2f, 0xfb, 0xff, 0x8b, 0xf9, 0xff, 0x83, 0x6b, 0xf9, 0xff, 0x01, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 
+  0x86, 0xab, 0xf9, 0xff, 0x09, 0x90, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0xfc, 0xfe, 0xff, 0xd4, 0xfc, 0xff, 0xcb, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xd4, 0xfc, 0xff, 0xfb, 0xfe, 0xff, 0x59, 0xfe, 0xff, 
+  0x90, 0xfb, 0xff, 0x81, 0x8b, 0xf9, 0xff, 0x84, 0x6b, 0xf9, 0xff, 0x01, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 0x82, 0xab, 0xf9, 
+  0xff, 0x81, 0x8b, 0xf9, 0xff, 0x81, 0xab, 0xf9, 0xff, 0x81, 0x8b, 0xf9, 0xff, 0x01, 0x11, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0x81, 0xdb, 0xfe, 0xff, 0x02, 0x9a, 0xfe, 0xff, 0xf1, 0xfb, 0xff, 0x8b, 
+  0xf9, 0xff, 0x87, 0x6b, 0xf9, 0xff, 0x01, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 0x8a, 0x8b, 0xf9, 0xff, 0x81, 0x73, 0xfc, 0xff, 
+  0x00, 0x8b, 0xf9, 0xff, 0x87, 0x6b, 0xf9, 0xff, 0x81, 0x4a, 0xf9, 0xff, 0x01, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x8b, 0xf9, 0xb7, 0x89, 0x8b, 
+  0xf9, 0xff, 0x86, 0x6b, 0xf9, 0xff, 0x82, 0x6a, 0xf9, 0xff, 0x83, 0x4a, 0xf9, 0xff, 0x01, 0x4a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x6b, 0xf9, 0xb7, 
+  0x85, 0x8b, 0xf9, 0xff, 0x87, 0x6b, 0xf9, 0xff, 0x82, 0x6a, 0xf9, 0xff, 0x86, 0x4a, 0xf9, 0xff, 0x01, 0x2a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x6a, 
+  0xf9, 0xb7, 0x82, 0x8b, 0xf9, 0xff, 0x89, 0x6b, 0xf9, 0xff, 0x82, 0x6a, 0xf9, 0xff, 0x87, 0x4a, 0xf9, 0xff, 0x01, 0x2a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x04, 0x6a, 0xf9, 0xb7, 0x8b, 0x6b, 0xf9, 0xff, 0x82, 0x6a, 0xf9, 0xff, 0x88, 0x4a, 0xf9, 0xff, 0x01, 0x2a, 0xf9, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x6a, 
+  0xf9, 0xb0, 0x87, 0x6b, 0xf9, 0xff, 0x82, 0x6a, 0xf9, 0xff, 0x89, 0x4a, 0xf9, 0xff, 0x82, 0x2a, 0xf9, 0xff, 0x01, 0x29, 0xf9, 0xb0, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x03, 0x29, 0xd9, 0x5f, 0x6a, 0xf9, 0xfc, 0x84, 0x6a, 0xf9, 0xff, 0x8b, 0x4a, 0xf9, 0xff, 0x84, 0x2a, 0xf9, 0xff, 0x02, 0x2a, 0xf9, 0xfc, 0x08, 0xd9, 0x5f, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x0c, 0xe7, 0xa8, 0x4b, 0x2b, 0xaa, 0xc0, 0x93, 0xcd, 0xa2, 0xff, 0x02, 0x0a, 0xaa, 0xc0, 0xc6, 0xa8, 0x4b, 0x00, 0x00, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x07, 0x87, 0x29, 0x2c, 0xd1, 0x63, 0xe4, 0x81, 0x11, 0x6c, 0xff, 0x83, 0xf1, 0x6b, 0xff, 0x8b, 0xf1, 0x63, 0xff, 0x02, 0xb0, 0x63, 0xe4, 0x87, 0x29, 0x2c, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x07, 0x2e, 0x53, 0x5c, 0x32, 0x6c, 0xfc, 0x8f, 0x32, 0x6c, 0xff, 0x02, 0x12, 0x6c, 0xff, 0x0d, 0x4b, 0x5c, 0x00, 0x00, 0x07, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x10, 0xd0, 0x63, 0xa4, 0x8e, 0x32, 0x6c, 0xff, 0x02, 0x12, 0x6c, 0xff, 0xb0, 0x5b, 0xa4, 0x00, 0x00, 0x10, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0xa7, 0x29, 0x27, 0xf1, 0x63, 0xe0, 
+  0x84, 0x32, 0x6c, 0xff, 0x00, 0x4e, 0x53, 0xff, 0x81, 0xec, 0x4a, 0xff, 0x00, 0x4e, 0x53, 0xff, 0x84, 0x12, 0x6c, 0xff, 0x02, 0xf1, 0x63, 0xe0, 0xa7, 0x29, 0x27, 0x00, 0x00, 0x03, 0x8c, 0x00, 
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x0d, 0x4b, 0x58, 0x12, 0x6c, 0xfc, 0x82, 0x32, 0x6c, 0xff, 0x00, 0x12, 0x6c, 0xff, 0x83, 0xe8, 0x31, 0xff, 0x00, 0x12, 0x64, 0xff, 0x82, 0x12, 0x6c, 0xff, 
+  0x02, 0x12, 0x6c, 0xfc, 0x0d, 0x4b, 0x58, 0x00, 0x00, 0x07, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0xb0, 0x5b, 0xa0, 0x32, 0x6c, 0xff, 0x81, 0x12, 0x6c, 0xff, 0x01, 0x12, 0x64, 0xff, 
+  0xc8, 0x31, 0xff, 0x81, 0xe8, 0x31, 0xff, 0x01, 0xc8, 0x31, 0xff, 0x11, 0x64, 0xff, 0x82, 0x12, 0x6c, 0xff, 0x01, 0x90, 0x5b, 0xa0, 0x00, 0x00, 0x10, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x03, 0x04, 0x19, 0x1c, 0x6f, 0x5b, 0x94, 0x81, 0xb0, 0x5b, 0xc4, 0x00, 0xb0, 0x5b, 0xc7, 0x83, 0xc8, 0x31, 0xff, 0x00, 0x90, 0x5b, 0xc7, 0x81, 0xb0, 0x5b, 0xc4, 0x02, 0x6f, 0x53, 0x94, 0x04, 
+  0x19, 0x1c, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c, 0xc7, 0x29, 0xd7, 0x81, 0xc8, 0x31, 0xff, 
+  0x05, 0xa7, 0x29, 0xd7, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x95, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x25, 0x19, 0x34, 0x81, 0x87, 
+  0x29, 0xac, 0x01, 0x25, 0x19, 0x34, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x8d, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x93, 0x48, 0x84, 0xb4, 0xb3, 0x84, 0xb4, 0xb7, 0x84, 0xb4, 0xb7, 0x84, 0xb4, 0xb7, 0x84, 0xb4, 0xa7, 0x74, 0x32, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x32, 0x1b, 0x7c, 0xb4, 0xa7, 0x7c, 0x94, 0xb7, 0x7c, 0x94, 0xb7, 0x7c, 0x94, 0xb7, 0x7c, 0x93, 0xb3, 0x7c, 0x73, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7c, 0x93, 0xb3, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x74, 0x52, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x32, 0x63, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xff, 0x74, 0x53, 0xb3, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7c, 0x73, 0xb7, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x6c, 0x32, 0x64, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6c, 0x12, 0x64, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x73, 0xff, 0x74, 0x52, 0xb4, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x63, 0xd0, 0x57, 0x74, 0x32, 0xbf, 0x74, 0x32, 0xc3, 0x6c, 0x11, 0xd8, 0x6b, 0xf1, 0xff, 0x74, 0x32, 0xb4, 0x4a, 0xed, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xec, 0x27, 0x6c, 0x11, 0xb4, 0x6b, 0xf0, 0xff, 0x6c, 0x11, 0xd8, 0x6c, 0x32, 0xc3, 0x6c, 0x12, 0xbf, 0x63, 0xb0, 0x58, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x32, 0x09, 0x74, 0x42, 0x8a, 0xff, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x42, 0x6a, 0xff, 0x32, 0x08, 0x74, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x2c, 0x24, 0xfa, 0x2d, 0xd0, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x0c, 0xff, 0xfa, 0x0c, 0xff, 0xfa, 0x0c, 0xff, 0xfa, 0x0c, 0xff, 0xfa, 0x0c, 0xff, 0xfa, 0x0c, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xec, 0xd0, 0xea, 0x0c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf9, 0xec, 0x9f, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0x9f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0xcb, 0xb7, 0xf9, 0xcc, 0xff, 0xfc, 0xd4, 0xff, 0xfe, 0x18, 0xff, 0xfb, 0x2f, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfb, 0x2f, 0xff, 0xfe, 0x18, 0xff, 0xfc, 0xb4, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0xab, 0xb7, 0xf9, 0xcc, 0xff, 0xfa, 0x6d, 0xff, 0xfd, 0x97, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0xd8, 0xff, 0xfa, 0xce, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xfa, 0xae, 0xff, 0xfd, 0xd7, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x76, 0xff, 0xfa, 0x4d, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0xab, 0xb7, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xfa, 0xce, 0xff, 0xfd, 0xd8, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x77, 0xff, 0xfa, 0x6d, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfa, 0x4d, 0xff, 0xfd, 0x76, 0xff, 0xff, 0x1c, 0xff, 0xfd, 0xd7, 0xff, 0xfa, 0xae, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0xab, 0xb7, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xfb, 0x2f, 0xff, 0xfe, 0x18, 0xff, 0xff, 0x1c, 0xff, 0xfd, 0x35, 0xff, 0xfa, 0x0c, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xec, 0xff, 0xfd, 0x35, 0xff, 0xff, 0x1c, 0xff, 0xfe, 0x18, 0xff, 0xfb, 0x2f, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xfb, 0x90, 0xff, 0xfe, 0x59, 0xff, 0xfe, 0xfc, 0xff, 0xfc, 0xd4, 0xff, 0xf9, 0xcb, 0xff, 0xf9, 0xab, 0xff, 0xfc, 0xd4, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0x59, 0xff, 0xfb, 0x90, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfc, 0x11, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0xdb, 0xff, 0xfe, 0xdb, 0xff, 0xfe, 0x9a, 0xff, 0xfb, 0xf1, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfc, 0x73, 0xff, 0xfc, 0x73, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x6b, 0xb7, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x6a, 0xb7, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x6a, 0xb7, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xb7, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf9, 0x6a, 0xb0, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x29, 0xb0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd9, 0x29, 0x5f, 0xf9, 0x6a, 0xfc, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xfc, 0xd9, 0x08, 0x5f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xa8, 0xe7, 0x4b, 0xaa, 0x2b, 0xc0, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xa2, 0xcd, 0xff, 0xaa, 0x0a, 0xc0, 0xa8, 0xc6, 0x4b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x29, 0x87, 0x2c, 0x63, 0xd1, 0xe4, 0x6c, 0x11, 0xff, 0x6c, 0x11, 0xff, 0x6b, 0xf1, 0xff, 0x6b, 0xf1, 0xff, 0x6b, 0xf1, 0xff, 0x6b, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xb0, 0xe4, 0x29, 0x87, 0x2c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x53, 0x2e, 0x5c, 0x6c, 0x32, 0xfc, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x4b, 0x0d, 0x5c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x63, 0xd0, 0xa4, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x5b, 0xb0, 0xa4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x29, 0xa7, 0x27, 0x63, 0xf1, 0xe0, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x53, 0x4e, 0xff, 0x4a, 0xec, 0xff, 0x4a, 0xec, 0xff, 0x53, 0x4e, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xf1, 0xe0, 0x29, 0xa7, 0x27, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x0d, 0x58, 0x6c, 0x12, 0xfc, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x64, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xfc, 0x4b, 0x0d, 0x58, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x5b, 0xb0, 0xa0, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x64, 0x12, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xc8, 0xff, 0x64, 0x11, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x5b, 0x90, 0xa0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x19, 0x04, 0x1c, 0x5b, 0x6f, 0x94, 0x5b, 0xb0, 0xc4, 0x5b, 0xb0, 0xc4, 0x5b, 0xb0, 0xc7, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x5b, 0x90, 0xc7, 0x5b, 0xb0, 0xc4, 0x5b, 0xb0, 0xc4, 0x53, 0x6f, 0x94, 0x19, 0x04, 0x1c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c, 0x29, 0xc7, 0xd7, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x29, 0xa7, 0xd7, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x19, 0x25, 0x34, 0x29, 0x87, 0xac, 0x29, 0x87, 0xac, 0x19, 0x25, 0x34, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x04, 
+  0x00, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x84, 0x93, 0x48, 0x84, 0xb4, 0xb3, 0x82, 0x84, 0xb4, 0xb7, 0x01, 0x84, 0xb4, 0xa7, 0x74, 0x32, 0x1b, 0x83, 0x00, 0x00, 0x00, 0x01, 0x74, 
+  0x32, 0x1b, 0x7c, 0xb4, 0xa7, 0x82, 0x7c, 0x94, 0xb7, 0x01, 0x7c, 0x93, 0xb3, 0x7c, 0x73, 0x48, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x7c, 0x93, 0xb3, 0x84, 0x7c, 0x94, 0xff, 0x00, 
+  0x74, 0x52, 0x63, 0x83, 0x00, 0x00, 0x00, 0x00, 0x74, 0x32, 0x63, 0x83, 0x7c, 0x93, 0xff, 0x02, 0x7c, 0x73, 0xff, 0x74, 0x53, 0xb3, 0x00, 0x00, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x07, 0x7c, 0x73, 0xb7, 0x84, 0x7c, 0x94, 0xff, 0x01, 0x6c, 0x32, 0x64, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x6c, 0x12, 0x64, 0x82, 0x7c, 0x93, 0xff, 0x81, 0x7c, 
+  0x73, 0xff, 0x01, 0x74, 0x52, 0xb4, 0x00, 0x00, 0x07, 0x8b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x63, 0xd0, 0x57, 0x74, 0x32, 0xbf, 0x74, 0x32, 0xc3, 0x6c, 0x11, 0xd8, 0x6b, 0xf1, 0xff, 
+  0x74, 0x32, 0xb4, 0x4a, 0xed, 0x27, 0x83, 0x00, 0x00, 0x00, 0x07, 0x4a, 0xec, 0x27, 0x6c, 0x11, 0xb4, 0x6b, 0xf0, 0xff, 0x6c, 0x11, 0xd8, 0x6c, 0x32, 0xc3, 0x6c, 0x12, 0xbf, 0x63, 0xb0, 0x58, 
+  0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x32, 0x09, 0x74, 0x42, 0x8a, 0xff, 0x00, 
+  0x00, 0x24, 0x00, 0x00, 0x0b, 0x83, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x42, 0x6a, 0xff, 0x32, 0x08, 0x74, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x0f, 0x81, 
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x00, 0x01, 0xea, 0x2c, 0x24, 0xfa, 0x2d, 0xd0, 0x81, 0xfa, 0x2d, 0xff, 0x84, 0xfa, 0x0d, 0xff, 0x85, 0xfa, 0x0c, 0xff, 0x87, 0xf9, 
+  0xec, 0xff, 0x02, 0xf9, 0xcc, 0xff, 0xf9, 0xec, 0xd0, 0xea, 0x0c, 0x24, 0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xf9, 0xec, 0x9f, 0x88, 0xf9, 0xcc, 0xff, 0x83, 0xf9, 0xac, 0xff, 0x85, 
+  0xf9, 0xab, 0xff, 0x84, 0xf9, 0x8b, 0xff, 0x01, 0xf9, 0x8b, 0x9f, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0xf9, 0xcb, 0xb7, 0xf9, 0xcc, 0xff, 0xfc, 0xd4, 0xff, 0xfe, 
+  0x18, 0xff, 0xfb, 0x2f, 0xff, 0x81, 0xf9, 0xcc, 0xff, 0x82, 0xf9, 0xac, 0xff, 0x01, 0xf9, 0xab, 0xff, 0xf9, 0xac, 0xff, 0x85, 0xf9, 0xab, 0xff, 0x82, 0xf9, 0x8b, 0xff, 0x05, 0xfb, 0x2f, 0xff, 
+  0xfe, 0x18, 0xff, 0xfc, 0xb4, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0xf9, 0xab, 0xb7, 0xf9, 0xcc, 0xff, 0xfa, 0x6d, 0xff, 
+  0xfd, 0x97, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0xd8, 0xff, 0xfa, 0xce, 0xff, 0x8a, 0xf9, 0xab, 0xff, 0x08, 0xf9, 0x8b, 0xff, 0xfa, 0xae, 0xff, 0xfd, 0xd7, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x76, 0xff, 
+  0xfa, 0x4d, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 0xab, 0xb7, 0x82, 0xf9, 0xac, 0xff, 0x04, 0xfa, 0xce, 0xff, 0xfd, 
+  0xd8, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x77, 0xff, 0xfa, 0x6d, 0xff, 0x85, 0xf9, 0xab, 0xff, 0x81, 0xf9, 0x8b, 0xff, 0x05, 0xfa, 0x4d, 0xff, 0xfd, 0x76, 0xff, 0xff, 0x1c, 0xff, 0xfd, 0xd7, 0xff, 
+  0xfa, 0xae, 0xff, 0xf9, 0x8b, 0xff, 0x81, 0xf9, 0x6b, 0xff, 0x01, 0xf9, 0x6a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 0xab, 0xb7, 0x84, 0xf9, 0xab, 0xff, 
+  0x05, 0xfb, 0x2f, 0xff, 0xfe, 0x18, 0xff, 0xff, 0x1c, 0xff, 0xfd, 0x35, 0xff, 0xfa, 0x0c, 0xff, 0xf9, 0xab, 0xff, 0x82, 0xf9, 0x8b, 0xff, 0x05, 0xf9, 0xec, 0xff, 0xfd, 0x35, 0xff, 0xff, 0x1c, 
+  0xff, 0xfe, 0x18, 0xff, 0xfb, 0x2f, 0xff, 0xf9, 0x8b, 0xff, 0x83, 0xf9, 0x6b, 0xff, 0x01, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 
+  0x86, 0xf9, 0xab, 0xff, 0x09, 0xfb, 0x90, 0xff, 0xfe, 0x59, 0xff, 0xfe, 0xfc, 0xff, 0xfc, 0xd4, 0xff, 0xf9, 0xcb, 0xff, 0xf9, 0xab, 0xff, 0xfc, 0xd4, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0x59, 0xff, 
+  0xfb, 0x90, 0xff, 0x81, 0xf9, 0x8b, 0xff, 0x84, 0xf9, 0x6b, 0xff, 0x01, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 0x82, 0xf9, 0xab, 
+  0xff, 0x81, 0xf9, 0x8b, 0xff, 0x81, 0xf9, 0xab, 0xff, 0x81, 0xf9, 0x8b, 0xff, 0x01, 0xfc, 0x11, 0xff, 0xfe, 0x9a, 0xff, 0x81, 0xfe, 0xdb, 0xff, 0x02, 0xfe, 0x9a, 0xff, 0xfb, 0xf1, 0xff, 0xf9, 
+  0x8b, 0xff, 0x87, 0xf9, 0x6b, 0xff, 0x01, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 0x8a, 0xf9, 0x8b, 0xff, 0x81, 0xfc, 0x73, 0xff, 
+  0x00, 0xf9, 0x8b, 0xff, 0x87, 0xf9, 0x6b, 0xff, 0x81, 0xf9, 0x4a, 0xff, 0x01, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 0x8b, 0xb7, 0x89, 0xf9, 
+  0x8b, 0xff, 0x86, 0xf9, 0x6b, 0xff, 0x82, 0xf9, 0x6a, 0xff, 0x83, 0xf9, 0x4a, 0xff, 0x01, 0xf9, 0x4a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 0x6b, 0xb7, 
+  0x85, 0xf9, 0x8b, 0xff, 0x87, 0xf9, 0x6b, 0xff, 0x82, 0xf9, 0x6a, 0xff, 0x86, 0xf9, 0x4a, 0xff, 0x01, 0xf9, 0x2a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 
+  0x6a, 0xb7, 0x82, 0xf9, 0x8b, 0xff, 0x89, 0xf9, 0x6b, 0xff, 0x82, 0xf9, 0x6a, 0xff, 0x87, 0xf9, 0x4a, 0xff, 0x01, 0xf9, 0x2a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x04, 0xf9, 0x6a, 0xb7, 0x8b, 0xf9, 0x6b, 0xff, 0x82, 0xf9, 0x6a, 0xff, 0x88, 0xf9, 0x4a, 0xff, 0x01, 0xf9, 0x2a, 0xb7, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xf9, 
+  0x6a, 0xb0, 0x87, 0xf9, 0x6b, 0xff, 0x82, 0xf9, 0x6a, 0xff, 0x89, 0xf9, 0x4a, 0xff, 0x82, 0xf9, 0x2a, 0xff, 0x01, 0xf9, 0x29, 0xb0, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x03, 0xd9, 0x29, 0x5f, 0xf9, 0x6a, 0xfc, 0x84, 0xf9, 0x6a, 0xff, 0x8b, 0xf9, 0x4a, 0xff, 0x84, 0xf9, 0x2a, 0xff, 0x02, 0xf9, 0x2a, 0xfc, 0xd9, 0x08, 0x5f, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x0c, 0xa8, 0xe7, 0x4b, 0xaa, 0x2b, 0xc0, 0x93, 0xa2, 0xcd, 0xff, 0x02, 0xaa, 0x0a, 0xc0, 0xa8, 0xc6, 0x4b, 0x00, 0x00, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x07, 0x29, 0x87, 0x2c, 0x63, 0xd1, 0xe4, 0x81, 0x6c, 0x11, 0xff, 0x83, 0x6b, 0xf1, 0xff, 0x8b, 0x63, 0xf1, 0xff, 0x02, 0x63, 0xb0, 0xe4, 0x29, 0x87, 0x2c, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x07, 0x53, 0x2e, 0x5c, 0x6c, 0x32, 0xfc, 0x8f, 0x6c, 0x32, 0xff, 0x02, 0x6c, 0x12, 0xff, 0x4b, 0x0d, 0x5c, 0x00, 0x00, 0x07, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x10, 0x63, 0xd0, 0xa4, 0x8e, 0x6c, 0x32, 0xff, 0x02, 0x6c, 0x12, 0xff, 0x5b, 0xb0, 0xa4, 0x00, 0x00, 0x10, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x29, 0xa7, 0x27, 0x63, 0xf1, 0xe0, 
+  0x84, 0x6c, 0x32, 0xff, 0x00, 0x53, 0x4e, 0xff, 0x81, 0x4a, 0xec, 0xff, 0x00, 0x53, 0x4e, 0xff, 0x84, 0x6c, 0x12, 0xff, 0x02, 0x63, 0xf1, 0xe0, 0x29, 0xa7, 0x27, 0x00, 0x00, 0x03, 0x8c, 0x00, 
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x4b, 0x0d, 0x58, 0x6c, 0x12, 0xfc, 0x82, 0x6c, 0x32, 0xff, 0x00, 0x6c, 0x12, 0xff, 0x83, 0x31, 0xe8, 0xff, 0x00, 0x64, 0x12, 0xff, 0x82, 0x6c, 0x12, 0xff, 
+  0x02, 0x6c, 0x12, 0xfc, 0x4b, 0x0d, 0x58, 0x00, 0x00, 0x07, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x10, 0x5b, 0xb0, 0xa0, 0x6c, 0x32, 0xff, 0x81, 0x6c, 0x12, 0xff, 0x01, 0x64, 0x12, 0xff, 
+  0x31, 0xc8, 0xff, 0x81, 0x31, 0xe8, 0xff, 0x01, 0x31, 0xc8, 0xff, 0x64, 0x11, 0xff, 0x82, 0x6c, 0x12, 0xff, 0x01, 0x5b, 0x90, 0xa0, 0x00, 0x00, 0x10, 0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x03, 0x19, 0x04, 0x1c, 0x5b, 0x6f, 0x94, 0x81, 0x5b, 0xb0, 0xc4, 0x00, 0x5b, 0xb0, 0xc7, 0x83, 0x31, 0xc8, 0xff, 0x00, 0x5b, 0x90, 0xc7, 0x81, 0x5b, 0xb0, 0xc4, 0x02, 0x53, 0x6f, 0x94, 0x19, 
+  0x04, 0x1c, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1c, 0x29, 0xc7, 0xd7, 0x81, 0x31, 0xc8, 0xff, 
+  0x05, 0x29, 0xa7, 0xd7, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x95, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x19, 0x25, 0x34, 0x81, 0x29, 
+  0x87, 0xac, 0x01, 0x19, 0x25, 0x34, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x8d, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x92, 0x7d, 0x48, 0xa0, 0x95, 0x7f, 0xb3, 0xa0, 0x95, 0x7e, 0xb7, 0x9f, 0x95, 0x7e, 0xb7, 0xa0, 0x95, 0x7e, 0xb7, 0x9f, 0x94, 0x7e, 0xa7, 0x8f, 0x86, 0x73, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x85, 0x71, 0x1b, 0x9d, 0x93, 0x7c, 0xa7, 0x9d, 0x92, 0x7b, 0xb7, 0x9d, 0x92, 0x7b, 0xb7, 0x9d, 0x92, 0x7a, 0xb7, 0x9c, 0x92, 0x7a, 0xb3, 0x98, 0x8e, 0x78, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9b, 0x8f, 0x77, 0xb3, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x92, 0x87, 0x70, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x86, 0x6f, 0x63, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x96, 0x8a, 0x72, 0xb3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x98, 0x8c, 0x75, 0xb7, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x8d, 0x83, 0x6c, 0x64, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8d, 0x81, 0x6a, 0x64, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x94, 0x88, 0x6f, 0xb4, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x77, 0x62, 0x57, 0x91, 0x86, 0x6f, 0xbf, 0x90, 0x85, 0x6f, 0xc3, 0x8c, 0x81, 0x6c, 0xd8, 0x87, 0x7c, 0x68, 0xff, 0x8d, 0x83, 0x6d, 0xb4, 0x65, 0x5d, 0x4c, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x5c, 0x4b, 0x27, 0x8c, 0x82, 0x6a, 0xb4, 0x84, 0x7b, 0x65, 0xff, 0x89, 0x7f, 0x68, 0xd8, 0x8d, 0x83, 0x6a, 0xc3, 0x8e, 0x82, 0x6a, 0xbf, 0x7d, 0x73, 0x5e, 0x58, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1f, 0x46, 0x42, 0x34, 0x74, 0x53, 0x4f, 0x41, 0xff, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x24, 0x50, 0x4b, 0x3d, 0xff, 0x43, 0x3f, 0x30, 0x74, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x46, 0xe6, 0x24, 0x66, 0x44, 0xfd, 0xd0, 0x66, 0x43, 0xfe, 0xff, 0x66, 0x43, 0xff, 0xff, 0x66, 0x42, 0xff, 0xff, 0x66, 0x42, 0xff, 0xff, 0x66, 0x42, 0xff, 0xff, 0x65, 0x41, 0xff, 0xff, 0x65, 0x41, 0xff, 0xff, 0x64, 0x40, 0xfe, 0xff, 0x64, 0x40, 0xff, 0xff, 0x64, 0x3f, 0xfe, 0xff, 0x64, 0x40, 0xff, 0xff, 0x63, 0x3f, 0xfe, 0xff, 0x63, 0x3f, 0xff, 0xff, 0x62, 0x3e, 0xff, 0xff, 0x62, 0x3e, 0xff, 0xff, 0x62, 0x3d, 0xff, 0xff, 0x62, 0x3d, 0xff, 0xff, 0x61, 0x3c, 0xff, 0xff, 0x61, 0x3c, 0xff, 0xff, 0x60, 0x3b, 0xff, 0xff, 0x60, 0x3b, 0xff, 0xff, 0x60, 0x3a, 0xff, 0xff, 0x60, 0x3b, 0xfc, 0xd0, 0x5e, 0x3f, 0xe6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x3b, 0xf8, 0x9f, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x3a, 0xff, 0xff, 0x60, 0x39, 0xfe, 0xff, 0x60, 0x39, 0xfe, 0xff, 0x60, 0x39, 0xff, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x59, 0x32, 0xf8, 0x9f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5c, 0x37, 0xf7, 0xb7, 0x60, 0x39, 0xff, 0xff, 0xa1, 0x97, 0xfd, 0xff, 0xc4, 0xc0, 0xfc, 0xff, 0x7b, 0x66, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x78, 0x64, 0xfe, 0xff, 0xc3, 0xc0, 0xfc, 0xff, 0x9e, 0x95, 0xfd, 0xff, 0x58, 0x30, 0xff, 0xff, 0x55, 0x2e, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5b, 0x35, 0xf6, 0xb7, 0x5e, 0x37, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0xb6, 0xaf, 0xfd, 0xff, 0xe3, 0xe3, 0xfb, 0xff, 0xbd, 0xb8, 0xfc, 0xff, 0x71, 0x59, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x6e, 0x56, 0xfe, 0xff, 0xbb, 0xb7, 0xfc, 0xff, 0xe2, 0xe3, 0xfb, 0xff, 0xb4, 0xae, 0xfd, 0xff, 0x65, 0x48, 0xfe, 0xff, 0x58, 0x2f, 0xff, 0xff, 0x54, 0x2d, 0xf6, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5b, 0x34, 0xf7, 0xb7, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x5d, 0x35, 0xfe, 0xff, 0x71, 0x58, 0xff, 0xff, 0xbd, 0xb9, 0xfc, 0xff, 0xe2, 0xe3, 0xfb, 0xff, 0xb5, 0xae, 0xfd, 0xff, 0x68, 0x4b, 0xfe, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x66, 0x49, 0xfe, 0xff, 0xb4, 0xae, 0xfd, 0xff, 0xe2, 0xe2, 0xfb, 0xff, 0xbc, 0xb8, 0xfd, 0xff, 0x6e, 0x56, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x53, 0x2b, 0xf6, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x33, 0xf6, 0xb7, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x79, 0x64, 0xfe, 0xff, 0xc4, 0xc0, 0xfc, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0xac, 0xa4, 0xfd, 0xff, 0x61, 0x3f, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x5f, 0x3e, 0xff, 0xff, 0xaa, 0xa3, 0xfc, 0xff, 0xe0, 0xe1, 0xfb, 0xff, 0xc4, 0xc1, 0xfc, 0xff, 0x77, 0x63, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x52, 0x2a, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x58, 0x32, 0xf7, 0xb7, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x82, 0x72, 0xfe, 0xff, 0xcb, 0xc8, 0xfc, 0xff, 0xdd, 0xdd, 0xfb, 0xff, 0xa2, 0x99, 0xfd, 0xff, 0x5b, 0x37, 0xff, 0xff, 0x5b, 0x36, 0xff, 0xff, 0xa1, 0x99, 0xfd, 0xff, 0xdc, 0xdd, 0xfb, 0xff, 0xcb, 0xc9, 0xfc, 0xff, 0x81, 0x71, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x52, 0x2a, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x57, 0x31, 0xf6, 0xb7, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x8c, 0x7f, 0xfe, 0xff, 0xd1, 0xd0, 0xfb, 0xff, 0xd8, 0xd8, 0xfb, 0xff, 0xd7, 0xd7, 0xfb, 0xff, 0xd2, 0xd1, 0xfc, 0xff, 0x8c, 0x7e, 0xfd, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x51, 0x29, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x57, 0x30, 0xf7, 0xb7, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x96, 0x8b, 0xfd, 0xff, 0x97, 0x8c, 0xfe, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x51, 0x28, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x56, 0x2f, 0xf7, 0xb7, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x4f, 0x28, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x55, 0x2e, 0xf7, 0xb7, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x4f, 0x26, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x54, 0x2d, 0xf6, 0xb7, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xfe, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x4e, 0x26, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x54, 0x2c, 0xf7, 0xb7, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x4d, 0x24, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x52, 0x2b, 0xf5, 0xb0, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4c, 0x23, 0xf5, 0xb0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x47, 0x25, 0xd7, 0x5f, 0x53, 0x2c, 0xfc, 0xfc, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4e, 0x24, 0xfc, 0xfc, 0x42, 0x1f, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x37, 0x1d, 0xa8, 0x4b, 0x58, 0x46, 0xac, 0xc0, 0x69, 0x5a, 0xa0, 0xff, 0x69, 0x5a, 0xa0, 0xff, 0x69, 0x5a, 0xa0, 0xff, 0x69, 0x5a, 0xa0, 0xff, 0x69, 0x5a, 0xa0, 0xff, 0x69, 0x5a, 0xa0, 0xff, 0x68, 0x59, 0xa0, 0xff, 0x68, 0x59, 0xa0, 0xff, 0x68, 0x59, 0x9f, 0xff, 0x68, 0x59, 0x9f, 0xff, 0x67, 0x59, 0x9f, 0xff, 0x67, 0x59, 0x9f, 0xff, 0x67, 0x58, 0x9f, 0xff, 0x67, 0x58, 0x9f, 0xff, 0x67, 0x58, 0x9f, 0xff, 0x66, 0x57, 0x9f, 0xff, 0x66, 0x57, 0x9f, 0xff, 0x66, 0x57, 0x9f, 0xff, 0x65, 0x57, 0x9f, 0xff, 0x65, 0x57, 0x9f, 0xff, 0x54, 0x42, 0xaa, 0xc0, 0x34, 0x18, 0xa8, 0x4b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x37, 0x32, 0x26, 0x2c, 0x85, 0x79, 0x61, 0xe4, 0x8b, 0x7f, 0x66, 0xff, 0x8b, 0x7f, 0x66, 0xff, 0x8a, 0x7e, 0x65, 0xff, 0x8a, 0x7e, 0x65, 0xff, 0x8a, 0x7e, 0x65, 0xff, 0x8a, 0x7e, 0x65, 0xff, 0x8a, 0x7e, 0x64, 0xff, 0x8a, 0x7d, 0x64, 0xff, 0x8a, 0x7e, 0x64, 0xff, 0x89, 0x7d, 0x64, 0xff, 0x89, 0x7d, 0x64, 0xff, 0x89, 0x7d, 0x64, 0xff, 0x89, 0x7d, 0x63, 0xff, 0x89, 0x7c, 0x63, 0xff, 0x89, 0x7c, 0x63, 0xff, 0x88, 0x7c, 0x62, 0xff, 0x88, 0x7c, 0x62, 0xff, 0x88, 0x7c, 0x62, 0xff, 0x82, 0x76, 0x5d, 0xe4, 0x36, 0x30, 0x25, 0x2c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6e, 0x63, 0x4f, 0x5c, 0x91, 0x83, 0x69, 0xfc, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x90, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x8f, 0x83, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x6c, 0x62, 0x4c, 0x5c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x77, 0x5e, 0xa4, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x80, 0x74, 0x5b, 0xa4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3a, 0x35, 0x28, 0x27, 0x8b, 0x7e, 0x64, 0xe0, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x74, 0x6a, 0x54, 0xff, 0x64, 0x5b, 0x49, 0xff, 0x64, 0x5b, 0x49, 0xff, 0x74, 0x69, 0x53, 0xff, 0x90, 0x82, 0x67, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x89, 0x7d, 0x62, 0xe0, 0x39, 0x34, 0x28, 0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6b, 0x60, 0x4c, 0x58, 0x8f, 0x82, 0x66, 0xfc, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x68, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x41, 0x3c, 0x30, 0xff, 0x8d, 0x81, 0x64, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xfc, 0x69, 0x5f, 0x4b, 0x58, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7f, 0x73, 0x5b, 0xa0, 0x90, 0x83, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x66, 0xff, 0x8d, 0x7f, 0x64, 0xff, 0x40, 0x3a, 0x2f, 0xff, 0x40, 0x3b, 0x2f, 0xff, 0x40, 0x3b, 0x2f, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x8c, 0x7f, 0x63, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x7e, 0x71, 0x58, 0xa0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0x21, 0x18, 0x1c, 0x78, 0x6d, 0x56, 0x94, 0x82, 0x75, 0x5c, 0xc4, 0x82, 0x75, 0x5c, 0xc4, 0x7f, 0x73, 0x5a, 0xc7, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x7e, 0x72, 0x59, 0xc7, 0x81, 0x75, 0x5b, 0xc4, 0x81, 0x75, 0x5b, 0xc4, 0x77, 0x6c, 0x54, 0x94, 0x24, 0x1f, 0x17, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x3c, 0x37, 0x2b, 0xd7, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3c, 0x36, 0x2a, 0xd7, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x27, 0x23, 0x1a, 0x34, 0x36, 0x31, 0x26, 0xac, 0x36, 0x31, 0x26, 0xac, 0x27, 0x23, 0x19, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0x82, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9c, 0x92, 0x7d, 0x48, 0xa0, 0x95, 0x7f, 0xb3, 0xa0, 0x95, 0x7e, 0xb7, 0x9f, 0x95, 
+  0x7e, 0xb7, 0xa0, 0x95, 0x7e, 0xb7, 0x9f, 0x94, 0x7e, 0xa7, 0x8f, 0x86, 0x73, 0x1b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8e, 0x85, 0x71, 0x1b, 0x9d, 0x93, 0x7c, 0xa7, 0x81, 0x9d, 0x92, 0x7b, 
+  0xb7, 0x02, 0x9d, 0x92, 0x7a, 0xb7, 0x9c, 0x92, 0x7a, 0xb3, 0x98, 0x8e, 0x78, 0x48, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x9b, 0x8f, 0x77, 0xb3, 0x81, 0x9e, 0x92, 0x79, 
+  0xff, 0x81, 0x9d, 0x91, 0x79, 0xff, 0x01, 0x9d, 0x91, 0x78, 0xff, 0x92, 0x87, 0x70, 0x63, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x86, 0x6f, 0x63, 0x82, 0x9b, 0x8f, 0x76, 0xff, 0x03, 0x9a, 
+  0x8f, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x96, 0x8a, 0x72, 0xb3, 0x00, 0x00, 0x00, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x98, 0x8c, 0x75, 0xb7, 0x9e, 0x92, 0x79, 
+  0xff, 0x9d, 0x91, 0x78, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x81, 0x9d, 0x91, 0x78, 0xff, 0x01, 0x8d, 0x83, 0x6c, 0x64, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+  0x03, 0x8d, 0x81, 0x6a, 0x64, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x81, 0x9a, 0x8e, 0x75, 0xff, 0x01, 0x94, 0x88, 0x6f, 0xb4, 0x00, 0x00, 0x00, 0x07, 0x8b, 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x80, 0x77, 0x62, 0x57, 0x91, 0x86, 0x6f, 0xbf, 0x90, 0x85, 0x6f, 0xc3, 0x8c, 0x81, 0x6c, 0xd8, 0x87, 0x7c, 0x68, 0xff, 0x8d, 0x83, 0x6d, 
+  0xb4, 0x65, 0x5d, 0x4c, 0x27, 0x83, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x5c, 0x4b, 0x27, 0x8c, 0x82, 0x6a, 0xb4, 0x84, 0x7b, 0x65, 0xff, 0x89, 0x7f, 0x68, 0xd8, 0x8d, 0x83, 0x6a, 0xc3, 0x8e, 
+  0x82, 0x6a, 0xbf, 0x7d, 0x73, 0x5e, 0x58, 0x00, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x00, 0x0f, 0x00, 
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1f, 0x46, 0x42, 0x34, 0x74, 0x53, 0x4f, 0x41, 0xff, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x83, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x00, 
+  0x0b, 0x00, 0x00, 0x00, 0x24, 0x50, 0x4b, 0x3d, 0xff, 0x43, 0x3f, 0x30, 0x74, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0x86, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0x46, 0xe6, 0x24, 0x66, 0x44, 0xfd, 0xd0, 0x66, 0x43, 0xfe, 0xff, 0x66, 0x43, 0xff, 0xff, 0x82, 0x66, 0x42, 0xff, 0xff, 0x81, 0x65, 
+  0x41, 0xff, 0xff, 0x05, 0x64, 0x40, 0xfe, 0xff, 0x64, 0x40, 0xff, 0xff, 0x64, 0x3f, 0xfe, 0xff, 0x64, 0x40, 0xff, 0xff, 0x63, 0x3f, 0xfe, 0xff, 0x63, 0x3f, 0xff, 0xff, 0x81, 0x62, 0x3e, 0xff, 
+  0xff, 0x81, 0x62, 0x3d, 0xff, 0xff, 0x81, 0x61, 0x3c, 0xff, 0xff, 0x81, 0x60, 0x3b, 0xff, 0xff, 0x02, 0x60, 0x3a, 0xff, 0xff, 0x60, 0x3b, 0xfc, 0xd0, 0x5e, 0x3f, 0xe6, 0x24, 0x84, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x3b, 0xf8, 0x9f, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x3a, 0xff, 0xff, 0x81, 0x60, 0x39, 0xfe, 0xff, 0x15, 0x60, 0x39, 0xff, 0xff, 0x5f, 0x38, 0xfe, 
+  0xff, 0x5f, 0x38, 0xff, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 
+  0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x31, 0xfe, 
+  0xff, 0x59, 0x31, 0xff, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x59, 0x32, 0xf8, 0x9f, 0x00, 0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x5c, 0x37, 0xf7, 0xb7, 0x60, 
+  0x39, 0xff, 0xff, 0xa1, 0x97, 0xfd, 0xff, 0xc4, 0xc0, 0xfc, 0xff, 0x7b, 0x66, 0xfe, 0xff, 0x81, 0x5e, 0x37, 0xfe, 0xff, 0x13, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 
+  0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5b, 0x33, 0xff, 
+  0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x78, 0x64, 0xfe, 0xff, 0xc3, 0xc0, 0xfc, 0xff, 0x9e, 0x95, 0xfd, 0xff, 0x58, 0x30, 0xff, 0xff, 0x55, 0x2e, 0xf7, 
+  0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x5b, 0x35, 0xf6, 0xb7, 0x5e, 0x37, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0xb6, 0xaf, 0xfd, 0xff, 0xe3, 
+  0xe3, 0xfb, 0xff, 0xbd, 0xb8, 0xfc, 0xff, 0x71, 0x59, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 
+  0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x83, 0x5a, 0x33, 0xff, 0xff, 0x08, 0x5a, 0x32, 0xff, 0xff, 0x6e, 0x56, 0xfe, 0xff, 0xbb, 0xb7, 0xfc, 0xff, 0xe2, 0xe3, 0xfb, 0xff, 0xb4, 0xae, 0xfd, 
+  0xff, 0x65, 0x48, 0xfe, 0xff, 0x58, 0x2f, 0xff, 0xff, 0x54, 0x2d, 0xf6, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x5b, 0x34, 0xf7, 0xb7, 0x81, 
+  0x5e, 0x36, 0xff, 0xff, 0x05, 0x5d, 0x35, 0xfe, 0xff, 0x71, 0x58, 0xff, 0xff, 0xbd, 0xb9, 0xfc, 0xff, 0xe2, 0xe3, 0xfb, 0xff, 0xb5, 0xae, 0xfd, 0xff, 0x68, 0x4b, 0xfe, 0xff, 0x81, 0x5c, 0x34, 
+  0xff, 0xff, 0x81, 0x5b, 0x34, 0xff, 0xff, 0x81, 0x5a, 0x33, 0xff, 0xff, 0x81, 0x5a, 0x32, 0xff, 0xff, 0x05, 0x66, 0x49, 0xfe, 0xff, 0xb4, 0xae, 0xfd, 0xff, 0xe2, 0xe2, 0xfb, 0xff, 0xbc, 0xb8, 
+  0xfd, 0xff, 0x6e, 0x56, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x81, 0x57, 0x2e, 0xff, 0xff, 0x01, 0x53, 0x2b, 0xf6, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x00, 0x04, 0x59, 0x33, 0xf6, 0xb7, 0x5c, 0x35, 0xfe, 0xff, 0x81, 0x5c, 0x35, 0xff, 0xff, 0x12, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x79, 0x64, 0xfe, 0xff, 0xc4, 0xc0, 0xfc, 0xff, 
+  0xe1, 0xe1, 0xfb, 0xff, 0xac, 0xa4, 0xfd, 0xff, 0x61, 0x3f, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x5f, 0x3e, 0xff, 0xff, 
+  0xaa, 0xa3, 0xfc, 0xff, 0xe0, 0xe1, 0xfb, 0xff, 0xc4, 0xc1, 0xfc, 0xff, 0x77, 0x63, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x81, 0x56, 0x2d, 0xff, 
+  0xff, 0x01, 0x52, 0x2a, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x58, 0x32, 0xf7, 0xb7, 0x5c, 0x35, 0xff, 0xff, 0x81, 0x5b, 0x34, 0xfe, 
+  0xff, 0x81, 0x5b, 0x34, 0xff, 0xff, 0x14, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x82, 0x72, 0xfe, 0xff, 0xcb, 0xc8, 0xfc, 0xff, 0xdd, 0xdd, 0xfb, 0xff, 0xa2, 0x99, 0xfd, 0xff, 0x5b, 
+  0x37, 0xff, 0xff, 0x5b, 0x36, 0xff, 0xff, 0xa1, 0x99, 0xfd, 0xff, 0xdc, 0xdd, 0xfb, 0xff, 0xcb, 0xc9, 0xfc, 0xff, 0x81, 0x71, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x56, 
+  0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x52, 0x2a, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x57, 0x31, 0xf6, 0xb7, 0x5a, 0x33, 0xfe, 0xff, 0x81, 0x5a, 0x33, 0xff, 0xff, 0x81, 0x5a, 0x32, 0xfe, 0xff, 0x81, 0x5a, 0x33, 0xff, 0xff, 0x0a, 0x59, 0x32, 0xfe, 
+  0xff, 0x59, 0x32, 0xff, 0xff, 0x8c, 0x7f, 0xfe, 0xff, 0xd1, 0xd0, 0xfb, 0xff, 0xd8, 0xd8, 0xfb, 0xff, 0xd7, 0xd7, 0xfb, 0xff, 0xd2, 0xd1, 0xfc, 0xff, 0x8c, 0x7e, 0xfd, 0xff, 0x57, 0x2f, 0xff, 
+  0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x81, 0x56, 0x2d, 0xff, 0xff, 0x81, 0x56, 0x2c, 0xff, 0xff, 0x81, 0x55, 0x2b, 0xff, 0xff, 0x01, 0x51, 0x29, 0xf7, 0xb7, 0x00, 0x00, 0x00, 
+  0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x57, 0x30, 0xf7, 0xb7, 0x81, 0x5a, 0x32, 0xff, 0xff, 0x00, 0x5a, 0x32, 0xfe, 0xff, 0x82, 0x5a, 0x32, 0xff, 0xff, 0x81, 0x59, 
+  0x31, 0xff, 0xff, 0x00, 0x59, 0x31, 0xfe, 0xff, 0x81, 0x58, 0x30, 0xff, 0xff, 0x02, 0x96, 0x8b, 0xfd, 0xff, 0x97, 0x8c, 0xfe, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x81, 0x57, 0x2e, 0xff, 0xff, 0x81, 
+  0x56, 0x2d, 0xff, 0xff, 0x81, 0x55, 0x2c, 0xff, 0xff, 0x81, 0x55, 0x2b, 0xff, 0xff, 0x81, 0x54, 0x2a, 0xff, 0xff, 0x01, 0x51, 0x28, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x56, 0x2f, 0xf7, 0xb7, 0x83, 0x59, 0x31, 0xff, 0xff, 0x82, 0x58, 0x30, 0xff, 0xff, 0x82, 0x57, 0x2f, 0xff, 0xff, 0x00, 0x57, 0x2e, 0xfe, 0xff, 0x81, 0x57, 
+  0x2e, 0xff, 0xff, 0x81, 0x56, 0x2d, 0xff, 0xff, 0x81, 0x55, 0x2c, 0xff, 0xff, 0x82, 0x54, 0x2b, 0xff, 0xff, 0x81, 0x54, 0x2a, 0xff, 0xff, 0x81, 0x53, 0x29, 0xff, 0xff, 0x01, 0x4f, 0x28, 0xf7, 
+  0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x55, 0x2e, 0xf7, 0xb7, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x82, 0x57, 0x2f, 0xff, 0xff, 
+  0x00, 0x57, 0x2f, 0xfe, 0xff, 0x82, 0x56, 0x2e, 0xff, 0xff, 0x82, 0x56, 0x2d, 0xff, 0xff, 0x81, 0x55, 0x2c, 0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x81, 0x54, 0x2b, 0xff, 0xff, 0x83, 0x53, 
+  0x2a, 0xff, 0xff, 0x81, 0x53, 0x29, 0xff, 0xff, 0x02, 0x52, 0x28, 0xff, 0xff, 0x4f, 0x26, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x54, 
+  0x2d, 0xf6, 0xb7, 0x82, 0x57, 0x2f, 0xff, 0xff, 0x01, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x81, 0x56, 0x2e, 0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x81, 0x56, 0x2d, 0xff, 0xff, 
+  0x00, 0x56, 0x2d, 0xfe, 0xff, 0x81, 0x55, 0x2c, 0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x81, 0x54, 0x2b, 0xff, 0xff, 0x83, 0x53, 0x2a, 0xff, 0xff, 0x01, 0x53, 0x29, 0xfe, 0xff, 0x53, 0x29, 
+  0xff, 0xff, 0x81, 0x52, 0x28, 0xff, 0xff, 0x01, 0x4e, 0x26, 0xf7, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x54, 0x2c, 0xf7, 0xb7, 0x57, 0x2e, 
+  0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x83, 0x56, 0x2d, 0xff, 0xff, 0x00, 0x55, 0x2c, 0xfe, 0xff, 0x81, 0x56, 0x2c, 0xff, 0xff, 0x00, 0x55, 0x2c, 0xfe, 0xff, 0x81, 0x55, 0x2c, 0xff, 0xff, 0x82, 
+  0x54, 0x2b, 0xff, 0xff, 0x81, 0x53, 0x2a, 0xff, 0xff, 0x81, 0x53, 0x29, 0xff, 0xff, 0x82, 0x52, 0x28, 0xff, 0xff, 0x81, 0x51, 0x27, 0xff, 0xff, 0x01, 0x4d, 0x24, 0xf7, 0xb7, 0x00, 0x00, 0x00, 
+  0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x52, 0x2b, 0xf5, 0xb0, 0x83, 0x55, 0x2d, 0xff, 0xff, 0x00, 0x55, 0x2c, 0xfe, 0xff, 0x82, 0x55, 0x2c, 0xff, 0xff, 0x82, 0x54, 
+  0x2b, 0xff, 0xff, 0x82, 0x53, 0x2a, 0xff, 0xff, 0x81, 0x52, 0x29, 0xff, 0xff, 0x82, 0x52, 0x28, 0xff, 0xff, 0x81, 0x51, 0x27, 0xff, 0xff, 0x81, 0x50, 0x26, 0xff, 0xff, 0x02, 0x4f, 0x25, 0xff, 
+  0xff, 0x4c, 0x23, 0xf5, 0xb0, 0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x47, 0x25, 0xd7, 0x5f, 0x53, 0x2c, 0xfc, 0xfc, 0x84, 0x54, 0x2b, 0xff, 0xff, 
+  0x83, 0x53, 0x2a, 0xff, 0xff, 0x82, 0x52, 0x29, 0xff, 0xff, 0x81, 0x51, 0x28, 0xff, 0xff, 0x82, 0x51, 0x27, 0xff, 0xff, 0x81, 0x50, 0x26, 0xff, 0xff, 0x82, 0x4f, 0x25, 0xff, 0xff, 0x02, 0x4e, 
+  0x24, 0xfc, 0xfc, 0x42, 0x1f, 0xd7, 0x5f, 0x00, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x37, 0x1d, 0xa8, 0x4b, 0x58, 0x46, 0xac, 0xc0, 0x85, 0x69, 0x5a, 
+  0xa0, 0xff, 0x81, 0x68, 0x59, 0xa0, 0xff, 0x81, 0x68, 0x59, 0x9f, 0xff, 0x81, 0x67, 0x59, 0x9f, 0xff, 0x82, 0x67, 0x58, 0x9f, 0xff, 0x82, 0x66, 0x57, 0x9f, 0xff, 0x81, 0x65, 0x57, 0x9f, 0xff, 
+  0x02, 0x54, 0x42, 0xaa, 0xc0, 0x34, 0x18, 0xa8, 0x4b, 0x00, 0x00, 0x00, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x37, 0x32, 0x26, 0x2c, 0x85, 0x79, 0x61, 0xe4, 0x81, 
+  0x8b, 0x7f, 0x66, 0xff, 0x83, 0x8a, 0x7e, 0x65, 0xff, 0x02, 0x8a, 0x7e, 0x64, 0xff, 0x8a, 0x7d, 0x64, 0xff, 0x8a, 0x7e, 0x64, 0xff, 0x82, 0x89, 0x7d, 0x64, 0xff, 0x00, 0x89, 0x7d, 0x63, 0xff, 
+  0x81, 0x89, 0x7c, 0x63, 0xff, 0x82, 0x88, 0x7c, 0x62, 0xff, 0x02, 0x82, 0x76, 0x5d, 0xe4, 0x36, 0x30, 0x25, 0x2c, 0x00, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+  0x07, 0x6e, 0x63, 0x4f, 0x5c, 0x91, 0x83, 0x69, 0xfc, 0x82, 0x92, 0x85, 0x6a, 0xff, 0x81, 0x91, 0x84, 0x69, 0xff, 0x02, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 
+  0x81, 0x91, 0x84, 0x69, 0xff, 0x00, 0x90, 0x83, 0x68, 0xff, 0x81, 0x91, 0x83, 0x68, 0xff, 0x81, 0x90, 0x83, 0x67, 0xff, 0x03, 0x8f, 0x83, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x6c, 0x62, 0x4c, 
+  0x5c, 0x00, 0x00, 0x00, 0x07, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x82, 0x77, 0x5e, 0xa4, 0x81, 0x92, 0x85, 0x6a, 0xff, 0x83, 0x92, 0x84, 0x69, 0xff, 0x82, 0x91, 0x84, 
+  0x69, 0xff, 0x82, 0x91, 0x83, 0x68, 0xff, 0x82, 0x90, 0x83, 0x67, 0xff, 0x02, 0x90, 0x82, 0x67, 0xff, 0x80, 0x74, 0x5b, 0xa4, 0x00, 0x00, 0x00, 0x10, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0x00, 0x00, 0x03, 0x3a, 0x35, 0x28, 0x27, 0x8b, 0x7e, 0x64, 0xe0, 0x82, 0x91, 0x83, 0x68, 0xff, 0x81, 0x90, 0x83, 0x68, 0xff, 0x00, 0x74, 0x6a, 0x54, 0xff, 0x81, 0x64, 0x5b, 0x49, 0xff, 0x01, 
+  0x74, 0x69, 0x53, 0xff, 0x90, 0x82, 0x67, 0xff, 0x83, 0x8f, 0x82, 0x66, 0xff, 0x02, 0x89, 0x7d, 0x62, 0xe0, 0x39, 0x34, 0x28, 0x27, 0x00, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0x00, 0x00, 0x07, 0x6b, 0x60, 0x4c, 0x58, 0x8f, 0x82, 0x66, 0xfc, 0x81, 0x90, 0x83, 0x67, 0xff, 0x01, 0x90, 0x83, 0x68, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x82, 0x42, 0x3c, 0x31, 0xff, 0x02, 
+  0x41, 0x3c, 0x30, 0xff, 0x8d, 0x81, 0x64, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x81, 0x8f, 0x82, 0x65, 0xff, 0x02, 0x8e, 0x81, 0x65, 0xfc, 0x69, 0x5f, 0x4b, 0x58, 0x00, 0x00, 0x00, 0x07, 0x8e, 0x00, 
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x7f, 0x73, 0x5b, 0xa0, 0x90, 0x83, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x66, 0xff, 0x8d, 0x7f, 0x64, 0xff, 0x40, 0x3a, 0x2f, 0xff, 
+  0x81, 0x40, 0x3b, 0x2f, 0xff, 0x01, 0x3f, 0x3a, 0x2e, 0xff, 0x8c, 0x7f, 0x63, 0xff, 0x82, 0x8f, 0x81, 0x65, 0xff, 0x01, 0x7e, 0x71, 0x58, 0xa0, 0x00, 0x00, 0x00, 0x10, 0x8f, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x24, 0x21, 0x18, 0x1c, 0x78, 0x6d, 0x56, 0x94, 0x81, 0x82, 0x75, 0x5c, 0xc4, 0x00, 0x7f, 0x73, 0x5a, 0xc7, 0x82, 0x3f, 0x3a, 0x2e, 0xff, 0x01, 0x3f, 0x39, 
+  0x2d, 0xff, 0x7e, 0x72, 0x59, 0xc7, 0x81, 0x81, 0x75, 0x5b, 0xc4, 0x02, 0x77, 0x6c, 0x54, 0x94, 0x24, 0x1f, 0x17, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x3c, 0x37, 0x2b, 0xd7, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3c, 0x36, 
+  0x2a, 0xd7, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 
+  0x27, 0x23, 0x1a, 0x34, 0x81, 0x36, 0x31, 0x26, 0xac, 0x01, 0x27, 0x23, 0x19, 0x34, 0x00, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00, 
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8d, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +218,7 @@ const lv_img_dsc_t k9mail_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( k9mail_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = k9mail_32px_map,
 };
-
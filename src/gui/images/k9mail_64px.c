@@ -10,271 +10,522 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_K9MAIL_64PX uint8_t k9mail_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x72, 0x1c, 0x97, 0x63, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6b, 0x92, 0x34, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x92, 0x34, 0x97, 0x6b, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x6c, 0x97, 0x63, 0x72, 0x1c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x1f, 0x97, 0xe3, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x97, 0xfb, 0x96, 0x58, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x92, 0x57, 0x96, 0xfb, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x96, 0xe3, 0x72, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x92, 0x63, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xb0, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x92, 0xb0, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0x63, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x6c, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xb7, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0x92, 0xb7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0x6c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x72, 0x6f, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xb8, 0x00, 0x13, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0x72, 0xb8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0x6f, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x6b, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xb4, 0x00, 0x13, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0x72, 0xb4, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0x68, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x49, 0x2c, 0x92, 0xe7, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x96, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xfc, 0x72, 0x64, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x6e, 0x64, 0x92, 0xfc, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xe7, 0x49, 0x2c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x49, 0x37, 0x6e, 0x78, 0x6e, 0x84, 0x6e, 0x84, 0x6e, 0x84, 0x6e, 0x88, 0x6e, 0xdb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0x87, 0x4d, 0x50, 0x00, 0x1c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1b, 0x4d, 0x50, 0x6e, 0x87, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xd8, 0x6e, 0x88, 0x6e, 0x84, 0x6e, 0x84, 0x6e, 0x84, 0x6e, 0x78, 0x49, 0x37, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x23, 0x00, 0x24, 0x00, 0x30, 0x49, 0xbf, 0x49, 0xff, 0x49, 0xff, 0x00, 0x30, 0x00, 0x1c, 0x00, 0x0f, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x30, 0x49, 0xff, 0x49, 0xff, 0x49, 0xbf, 0x00, 0x30, 0x00, 0x24, 0x00, 0x23, 0x00, 0x23, 0x00, 0x1f, 0x00, 0x14, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x14, 0x00, 0x17, 0x00, 0x18, 0x00, 0x27, 0x49, 0xbc, 0x49, 0xff, 0x49, 0xff, 0x00, 0x2b, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x2b, 0x49, 0xff, 0x49, 0xff, 0x29, 0xbc, 0x00, 0x27, 0x00, 0x18, 0x00, 0x17, 0x00, 0x14, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0xea, 0x68, 0xea, 0xd8, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xd8, 0xea, 0x68, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xea, 0x80, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0x83, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc9, 0x24, 0xea, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xc9, 0x24, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0x5f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x5f, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe9, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6b, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe9, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x6c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc5, 0x57, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xc5, 0x57, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x60, 0x23, 0xe5, 0xe7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xe7, 0x60, 0x23, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0xc5, 0x5b, 0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf3, 0xc5, 0x5b, 0x00, 0x13, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1c, 0x85, 0x44, 0xc5, 0xa3, 0xe5, 0xd7, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xe5, 0xd7, 0xc5, 0xa3, 0x85, 0x44, 0x00, 0x1c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x4c, 0x4e, 0xdc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xdc, 0x00, 0x4c, 0x00, 0x2b, 0x00, 0x18, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x23, 0x49, 0x60, 0x72, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x49, 0x60, 0x00, 0x23, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x24, 0x6e, 0x98, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0x98, 0x00, 0x24, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x04, 0x33, 0x72, 0xd4, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xd4, 0x04, 0x33, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x49, 0x54, 0x72, 0xf8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x49, 0x57, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x23, 0x6e, 0x93, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0x94, 0x00, 0x23, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x30, 0x72, 0xd0, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xd0, 0x00, 0x30, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x49, 0x53, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x49, 0x53, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x23, 0x6e, 0x8f, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x4e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0x8f, 0x00, 0x23, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x2f, 0x72, 0xcc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xcf, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x18, 0x49, 0x50, 0x72, 0xf4, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x49, 0x50, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x23, 0x4e, 0x88, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0x8b, 0x00, 0x23, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x2c, 0x72, 0xc8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xc8, 0x00, 0x2c, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x17, 0x25, 0x3f, 0x72, 0xc8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xc8, 0x25, 0x3f, 0x00, 0x17, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x2f, 0x49, 0x5c, 0x4e, 0x87, 0x4e, 0x8b, 0x4e, 0x8b, 0x4e, 0x8b, 0x4e, 0x8b, 0x4d, 0x90, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x4d, 0x90, 0x4e, 0x8b, 0x4e, 0x8b, 0x4e, 0x8b, 0x4e, 0x8b, 0x4e, 0x87, 0x49, 0x5c, 0x00, 0x2f, 0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x2c, 0x29, 0xe0, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xe0, 0x00, 0x2c, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x23, 0x00, 0x1c, 0x00, 0x13, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x10, 0x25, 0x7b, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0x78, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x1b, 0x25, 0x90, 0x29, 0xfb, 0x29, 0xff, 0x29, 0xff, 0x29, 0xfb, 0x25, 0x93, 0x00, 0x1b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x04, 0x40, 0x25, 0x74, 0x25, 0x74, 0x04, 0x40, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xce, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x87, 0x00, 0x07, 0x01, 0x00, 0x04, 0x00, 0x03, 0x89, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x87, 0x00, 0x07, 0x01, 
+  0x00, 0x04, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x02, 0x00, 0x07, 0x72, 0x1c, 0x97, 0x63, 0x86, 0x97, 0x6c, 0x03, 0x97, 0x6b, 0x92, 0x34, 0x00, 0x08, 0x00, 0x03, 0x87, 0x00, 0x00, 0x03, 0x00, 0x03, 
+  0x00, 0x08, 0x92, 0x34, 0x97, 0x6b, 0x86, 0x97, 0x6c, 0x02, 0x97, 0x63, 0x72, 0x1c, 0x00, 0x07, 0x9a, 0x00, 0x00, 0x02, 0x00, 0x04, 0x72, 0x1f, 0x97, 0xe3, 0x88, 0x96, 0xff, 0x02, 0x97, 0xfb, 
+  0x96, 0x58, 0x00, 0x07, 0x87, 0x00, 0x00, 0x02, 0x00, 0x07, 0x92, 0x57, 0x96, 0xfb, 0x88, 0x92, 0xff, 0x02, 0x96, 0xe3, 0x72, 0x1f, 0x00, 0x04, 0x99, 0x00, 0x00, 0x01, 0x00, 0x08, 0x92, 0x63, 
+  0x88, 0x96, 0xff, 0x81, 0x92, 0xff, 0x02, 0x92, 0xb0, 0x00, 0x0c, 0x00, 0x03, 0x85, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x0c, 0x92, 0xb0, 0x8a, 0x92, 0xff, 0x01, 0x72, 0x63, 0x00, 0x08, 0x99, 
+  0x00, 0x00, 0x01, 0x00, 0x0b, 0x72, 0x6c, 0x8a, 0x96, 0xff, 0x02, 0x92, 0xb7, 0x00, 0x10, 0x00, 0x03, 0x85, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x13, 0x92, 0xb7, 0x8a, 0x92, 0xff, 0x01, 0x72, 
+  0x6c, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x72, 0x6f, 0x8a, 0x96, 0xff, 0x02, 0x92, 0xb8, 0x00, 0x13, 0x00, 0x03, 0x85, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x13, 0x72, 0xb8, 0x8a, 
+  0x92, 0xff, 0x01, 0x72, 0x6f, 0x00, 0x0c, 0x99, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x72, 0x6b, 0x83, 0x96, 0xff, 0x00, 0x92, 0xff, 0x82, 0x96, 0xff, 0x82, 0x92, 0xff, 0x02, 0x72, 0xb4, 0x00, 0x13, 
+  0x00, 0x03, 0x85, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x13, 0x72, 0xb4, 0x8a, 0x92, 0xff, 0x01, 0x72, 0x68, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x02, 0x00, 0x08, 0x49, 0x2c, 0x92, 0xe7, 0x86, 0x96, 
+  0xff, 0x81, 0x92, 0xff, 0x03, 0x92, 0xfc, 0x72, 0x64, 0x00, 0x0f, 0x00, 0x03, 0x85, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0f, 0x6e, 0x64, 0x92, 0xfc, 0x88, 0x92, 0xff, 0x02, 0x72, 0xe7, 0x49, 
+  0x2c, 0x00, 0x08, 0x99, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x14, 0x49, 0x37, 0x6e, 0x78, 0x82, 0x6e, 0x84, 0x01, 0x6e, 0x88, 0x6e, 0xdb, 0x81, 0x6e, 0xff, 0x03, 0x6e, 0x87, 0x4d, 0x50, 0x00, 
+  0x1c, 0x00, 0x08, 0x87, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x1b, 0x4d, 0x50, 0x6e, 0x87, 0x81, 0x6e, 0xff, 0x01, 0x6e, 0xd8, 0x6e, 0x88, 0x82, 0x6e, 0x84, 0x03, 0x6e, 0x78, 0x49, 0x37, 0x00, 
+  0x14, 0x00, 0x04, 0x99, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1f, 0x81, 0x00, 0x23, 0x02, 0x00, 0x24, 0x00, 0x30, 0x49, 0xbf, 0x81, 0x49, 0xff, 0x03, 0x00, 0x30, 0x00, 
+  0x1c, 0x00, 0x0f, 0x00, 0x04, 0x87, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x30, 0x81, 0x49, 0xff, 0x02, 0x49, 0xbf, 0x00, 0x30, 0x00, 0x24, 0x81, 0x00, 0x23, 0x03, 0x00, 
+  0x1f, 0x00, 0x14, 0x00, 0x0b, 0x00, 0x03, 0x93, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x84, 0x00, 0x0b, 0x01, 0x00, 0x0c, 0x00, 0x10, 0x81, 0x00, 0x14, 0x03, 0x00, 0x17, 0x00, 0x18, 0x00, 
+  0x27, 0x49, 0xbc, 0x81, 0x49, 0xff, 0x03, 0x00, 0x2b, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x0c, 0x87, 0x00, 0x0b, 0x03, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x2b, 0x81, 0x49, 0xff, 0x03, 0x29, 
+  0xbc, 0x00, 0x27, 0x00, 0x18, 0x00, 0x17, 0x81, 0x00, 0x14, 0x01, 0x00, 0x10, 0x00, 0x0c, 0x84, 0x00, 0x0b, 0x01, 0x00, 0x04, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x08, 0xea, 
+  0x68, 0xea, 0xd8, 0xab, 0xea, 0xff, 0x03, 0xea, 0xd8, 0xea, 0x68, 0x00, 0x08, 0x00, 0x03, 0x8b, 0x00, 0x00, 0x02, 0x00, 0x08, 0xea, 0x80, 0xea, 0xff, 0xae, 0xe9, 0xff, 0x01, 0xea, 0x83, 0x00, 
+  0x08, 0x8a, 0x00, 0x00, 0x02, 0x00, 0x03, 0xc9, 0x24, 0xea, 0xf8, 0xaf, 0xe9, 0xff, 0x02, 0xe9, 0xf8, 0xc9, 0x24, 0x00, 0x03, 0x89, 0x00, 0x00, 0x01, 0x00, 0x04, 0xe9, 0x5f, 0xae, 0xe9, 0xff, 
+  0x82, 0xe5, 0xff, 0x01, 0xe5, 0x5f, 0x00, 0x04, 0x89, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe9, 0x6c, 0x83, 0xe9, 0xff, 0x81, 0xf7, 0xff, 0x00, 0xee, 0xff, 0xa3, 0xe9, 0xff, 0x00, 0xea, 0xff, 0x81, 
+  0xf7, 0xff, 0x00, 0xe9, 0xff, 0x82, 0xe5, 0xff, 0x01, 0xe5, 0x6b, 0x00, 0x07, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe9, 0x6c, 0x83, 0xe9, 0xff, 0x82, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xea, 0xff, 
+  0x9f, 0xe9, 0xff, 0x01, 0xea, 0xff, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x83, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x83, 0xe9, 0xff, 0x01, 0xf2, 
+  0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xea, 0xff, 0x9c, 0xe9, 0xff, 0x00, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xf2, 0xff, 0x83, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 
+  0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x85, 0xe9, 0xff, 0x00, 0xf2, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x98, 0xe9, 0xff, 0x01, 0xe5, 0xff, 0xf2, 0xff, 0x83, 0xff, 0xff, 
+  0x00, 0xf2, 0xff, 0x85, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x87, 0xe9, 0xff, 0x00, 0xf6, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x94, 
+  0xe9, 0xff, 0x01, 0xe5, 0xff, 0xf2, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x87, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x88, 0xe9, 0xff, 
+  0x01, 0xea, 0xff, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xf2, 0xff, 0x91, 0xe9, 0xff, 0x01, 0xf2, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xe9, 0xff, 0x88, 0xe5, 0xff, 
+  0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x8a, 0xe9, 0xff, 0x01, 0xea, 0xff, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 0xff, 0x8d, 0xe9, 0xff, 
+  0x01, 0xee, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xea, 0xff, 0x8a, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x8c, 0xe9, 0xff, 
+  0x01, 0xea, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 0xff, 0x89, 0xe9, 0xff, 0x01, 0xee, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xea, 0xff, 0x8c, 0xe5, 0xff, 
+  0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x8e, 0xe9, 0xff, 0x01, 0xee, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xea, 0xff, 0x85, 0xe9, 0xff, 
+  0x01, 0xea, 0xff, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 0xff, 0x8e, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x90, 0xe9, 0xff, 
+  0x01, 0xee, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xea, 0xff, 0x81, 0xe9, 0xff, 0x01, 0xea, 0xff, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 0xff, 0x90, 0xe5, 0xff, 
+  0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6f, 0x92, 0xe9, 0xff, 0x01, 0xf2, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x81, 0xf7, 0xff, 0x82, 0xff, 0xff, 0x01, 0xfb, 
+  0xff, 0xf2, 0xff, 0x92, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0x93, 0xe9, 0xff, 0x01, 0xe5, 0xff, 0xf2, 0xff, 0x85, 0xff, 0xff, 0x00, 0xf2, 
+  0xff, 0x94, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0x92, 0xe9, 0xff, 0x83, 0xe5, 0xff, 0x00, 0xf2, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf2, 0xff, 
+  0x96, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0x90, 0xe9, 0xff, 0x86, 0xe5, 0xff, 0x81, 0xe9, 0xff, 0x97, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 
+  0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0x81, 0xe5, 0xff, 0x87, 0xe9, 0xff, 0xa7, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0x87, 
+  0xe9, 0xff, 0xa9, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 
+  0xe5, 0x6c, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 
+  0xe5, 0x6c, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 
+  0xe5, 0x6c, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe5, 0x6c, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0x6c, 0x00, 0x08, 0x89, 0x00, 0x00, 0x01, 0x00, 0x07, 
+  0xc5, 0x57, 0xb1, 0xe5, 0xff, 0x01, 0xc5, 0x57, 0x00, 0x07, 0x89, 0x00, 0x00, 0x02, 0x00, 0x04, 0x60, 0x23, 0xe5, 0xe7, 0xaf, 0xe5, 0xff, 0x02, 0xe5, 0xe7, 0x60, 0x23, 0x00, 0x04, 0x89, 0x00, 
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x13, 0xc5, 0x5b, 0xe5, 0xf4, 0xad, 0xe5, 0xff, 0x03, 0xe5, 0xf3, 0xc5, 0x5b, 0x00, 0x13, 0x00, 0x03, 0x8a, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x1c, 0x85, 0x44, 
+  0xc5, 0xa3, 0xe5, 0xd7, 0xa9, 0xc9, 0xff, 0x04, 0xe5, 0xd7, 0xc5, 0xa3, 0x85, 0x44, 0x00, 0x1c, 0x00, 0x08, 0x8b, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x08, 0x00, 0x18, 0x00, 0x2b, 0x00, 0x4c, 
+  0x4e, 0xdc, 0xa7, 0x6e, 0xff, 0x05, 0x4e, 0xdc, 0x00, 0x4c, 0x00, 0x2b, 0x00, 0x18, 0x00, 0x08, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x23, 0x49, 0x60, 
+  0x72, 0xfb, 0xa5, 0x72, 0xff, 0x05, 0x72, 0xfb, 0x49, 0x60, 0x00, 0x23, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x03, 0x8f, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x24, 0x6e, 0x98, 0xa5, 0x72, 
+  0xff, 0x03, 0x6e, 0x98, 0x00, 0x24, 0x00, 0x0b, 0x00, 0x03, 0x92, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x10, 0x04, 0x33, 0x72, 0xd4, 0xa3, 0x72, 0xff, 0x03, 0x72, 0xd4, 0x04, 0x33, 0x00, 0x10, 
+  0x00, 0x04, 0x94, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x18, 0x49, 0x54, 0x72, 0xf8, 0xa1, 0x72, 0xff, 0x03, 0x72, 0xf8, 0x49, 0x57, 0x00, 0x18, 0x00, 0x07, 0x95, 0x00, 0x00, 0x03, 0x00, 0x03, 
+  0x00, 0x0b, 0x00, 0x23, 0x6e, 0x93, 0xa1, 0x72, 0xff, 0x03, 0x6e, 0x94, 0x00, 0x23, 0x00, 0x0b, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x10, 0x00, 0x30, 0x72, 0xd0, 0x9f, 0x72, 
+  0xff, 0x03, 0x72, 0xd0, 0x00, 0x30, 0x00, 0x10, 0x00, 0x03, 0x98, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x18, 0x49, 0x53, 0x72, 0xf7, 0x9d, 0x72, 0xff, 0x03, 0x72, 0xf7, 0x49, 0x53, 0x00, 0x18, 
+  0x00, 0x07, 0x99, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x23, 0x6e, 0x8f, 0x8a, 0x72, 0xff, 0x00, 0x4e, 0xff, 0x85, 0x49, 0xff, 0x00, 0x4e, 0xff, 0x8a, 0x72, 0xff, 0x03, 0x4e, 0x8f, 
+  0x00, 0x23, 0x00, 0x0b, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x10, 0x00, 0x2f, 0x72, 0xcc, 0x89, 0x72, 0xff, 0x87, 0x49, 0xff, 0x89, 0x72, 0xff, 0x03, 0x72, 0xcf, 0x00, 0x2f, 
+  0x00, 0x10, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x18, 0x49, 0x50, 0x72, 0xf4, 0x88, 0x72, 0xff, 0x87, 0x29, 0xff, 0x88, 0x72, 0xff, 0x03, 0x72, 0xf7, 0x49, 0x50, 0x00, 0x18, 
+  0x00, 0x07, 0x9d, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x23, 0x4e, 0x88, 0x88, 0x72, 0xff, 0x87, 0x29, 0xff, 0x88, 0x72, 0xff, 0x03, 0x4e, 0x8b, 0x00, 0x23, 0x00, 0x0b, 0x00, 0x03, 
+  0x9e, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x2c, 0x72, 0xc8, 0x87, 0x72, 0xff, 0x87, 0x29, 0xff, 0x87, 0x72, 0xff, 0x03, 0x72, 0xc8, 0x00, 0x2c, 0x00, 0x0f, 0x00, 0x03, 0xa0, 0x00, 
+  0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x25, 0x3f, 0x72, 0xc8, 0x86, 0x72, 0xff, 0x87, 0x29, 0xff, 0x86, 0x72, 0xff, 0x03, 0x6e, 0xc8, 0x25, 0x3f, 0x00, 0x17, 0x00, 0x07, 0xa2, 0x00, 0x00, 0x04, 
+  0x00, 0x08, 0x00, 0x18, 0x00, 0x2f, 0x49, 0x5c, 0x4e, 0x87, 0x83, 0x4e, 0x8b, 0x00, 0x4d, 0x90, 0x87, 0x29, 0xff, 0x00, 0x4d, 0x90, 0x83, 0x4e, 0x8b, 0x04, 0x4e, 0x87, 0x49, 0x5c, 0x00, 0x2f, 
+  0x00, 0x18, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x08, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x23, 0x83, 0x00, 0x24, 0x01, 0x00, 0x2c, 0x29, 0xe0, 0x85, 0x29, 0xff, 0x01, 0x29, 0xe0, 
+  0x00, 0x2c, 0x83, 0x00, 0x24, 0x04, 0x00, 0x23, 0x00, 0x1c, 0x00, 0x13, 0x00, 0x08, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x84, 0x00, 0x0b, 0x01, 0x00, 0x10, 
+  0x25, 0x7b, 0x85, 0x29, 0xff, 0x01, 0x25, 0x78, 0x00, 0x10, 0x84, 0x00, 0x0b, 0x02, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0xa9, 0x00, 0x00, 0x83, 0x00, 0x03, 0x03, 0x00, 0x04, 0x00, 0x1b, 0x25, 
+  0x90, 0x29, 0xfb, 0x81, 0x29, 0xff, 0x03, 0x29, 0xfb, 0x25, 0x93, 0x00, 0x1b, 0x00, 0x04, 0x83, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x20, 0x04, 0x40, 0x81, 0x25, 0x74, 0x02, 
+  0x04, 0x40, 0x00, 0x20, 0x00, 0x08, 0xb8, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x14, 0x81, 0x00, 0x1c, 0x01, 0x00, 0x14, 0x00, 0x07, 0xbb, 0x00, 0x00, 0x81, 0x00, 0x03, 0x9e, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x6b, 0x1c, 0xf4, 0x8c, 0x63, 0xf4, 0x8c, 0x6c, 0xf4, 0x8c, 0x6c, 0xf4, 0x8c, 0x6c, 0xf4, 0x8c, 0x6c, 0xf4, 0x8c, 0x6c, 0xf4, 0x8c, 0x6c, 0xf4, 0x8c, 0x6c, 0xf4, 0x8c, 0x6b, 0x73, 0x7c, 0x34, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x73, 0x7c, 0x34, 0xd4, 0x8c, 0x6b, 0xd4, 0x8c, 0x6c, 0xd4, 0x8c, 0x6c, 0xd4, 0x8c, 0x6c, 0xd4, 0x8c, 0x6c, 0xd4, 0x8c, 0x6c, 0xd4, 0x84, 0x6c, 0xd4, 0x8c, 0x6c, 0xd4, 0x8c, 0x63, 0xd0, 0x6b, 0x1c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd0, 0x6b, 0x1f, 0xd4, 0x84, 0xe3, 0xb4, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0xb4, 0x84, 0xfb, 0x93, 0x84, 0x58, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x93, 0x7c, 0x57, 0xb4, 0x7c, 0xfb, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0xb4, 0x84, 0xe3, 0xaf, 0x63, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x52, 0x74, 0x63, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xb0, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x73, 0x74, 0xb0, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x74, 0xff, 0x73, 0x74, 0xff, 0x73, 0x74, 0xff, 0x73, 0x74, 0xff, 0x32, 0x74, 0x63, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x32, 0x74, 0x6c, 0xb4, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x73, 0x74, 0xb7, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x53, 0x74, 0xb7, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0xf1, 0x6b, 0x6c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x6c, 0x6f, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x53, 0x74, 0xb8, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x52, 0x74, 0xb8, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x74, 0xff, 0xf1, 0x6b, 0x6f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf1, 0x6b, 0x6b, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x52, 0x74, 0xb4, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x32, 0x74, 0xb4, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xff, 0x73, 0x74, 0xff, 0x73, 0x74, 0xff, 0x73, 0x74, 0xff, 0x73, 0x74, 0xff, 0xd0, 0x63, 0x68, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0x42, 0x2c, 0x52, 0x74, 0xe7, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x94, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x7c, 0xfc, 0x8f, 0x63, 0x64, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x8f, 0x5b, 0x64, 0x73, 0x74, 0xfc, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x93, 0x7c, 0xff, 0x73, 0x74, 0xff, 0x73, 0x74, 0xff, 0x73, 0x74, 0xff, 0x32, 0x74, 0xe7, 0x4a, 0x3a, 0x2c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x29, 0x3a, 0x37, 0x4e, 0x5b, 0x78, 0x4e, 0x5b, 0x84, 0x4e, 0x5b, 0x84, 0x4e, 0x5b, 0x84, 0x4e, 0x5b, 0x88, 0x2d, 0x53, 0xdb, 0x2d, 0x53, 0xff, 0x2d, 0x53, 0xff, 0x4e, 0x5b, 0x87, 0xac, 0x4a, 0x50, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1b, 0xab, 0x4a, 0x50, 0x2e, 0x53, 0x87, 0x0d, 0x53, 0xff, 0x0d, 0x53, 0xff, 0x0d, 0x53, 0xd8, 0x2e, 0x53, 0x88, 0x4e, 0x53, 0x84, 0x4e, 0x53, 0x84, 0x4e, 0x53, 0x84, 0x2e, 0x53, 0x78, 0x09, 0x3a, 0x37, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x6a, 0x42, 0xbf, 0x8b, 0x4a, 0xff, 0x8b, 0x4a, 0xff, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x30, 0x6a, 0x42, 0xff, 0x6a, 0x42, 0xff, 0x49, 0x42, 0xbf, 0x00, 0x00, 0x30, 0x00, 0x00, 0x24, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x27, 0x49, 0x32, 0xbc, 0x6a, 0x3a, 0xff, 0x6a, 0x3a, 0xff, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x2b, 0x4a, 0x3a, 0xff, 0x4a, 0x3a, 0xff, 0x29, 0x2a, 0xbc, 0x00, 0x00, 0x27, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x8e, 0xf2, 0x68, 0x6d, 0xfa, 0xd8, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x2d, 0xfa, 0xd8, 0x4d, 0xf2, 0x68, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6d, 0xf2, 0x80, 0x0c, 0xfa, 0xff, 0xec, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x2c, 0xf2, 0x83, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xeb, 0xc1, 0x24, 0x0c, 0xfa, 0xf8, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xab, 0xf9, 0xf8, 0xaa, 0xc1, 0x24, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcb, 0xe9, 0x5f, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8a, 0xe9, 0x5f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8b, 0xe9, 0x6c, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0x56, 0xfd, 0xff, 0x97, 0xfd, 0xff, 0x8e, 0xfa, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6d, 0xfa, 0xff, 0x76, 0xfd, 0xff, 0x35, 0xfd, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6a, 0xe9, 0x6b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6c, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x56, 0xfd, 0xff, 0x2d, 0xfa, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x0c, 0xfa, 0xff, 0x56, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x4a, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x4a, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6f, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xb1, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xec, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xf4, 0xfc, 0xff, 0x1c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7a, 0xfe, 0xff, 0xb0, 0xfb, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x49, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6f, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xcc, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0x32, 0xfc, 0xff, 0xbb, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0x94, 0xfc, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x93, 0xfc, 0xff, 0xdb, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xbb, 0xfe, 0xff, 0x32, 0xfc, 0xff, 0x6b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x49, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6f, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0x94, 0xfc, 0xff, 0xfb, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xbb, 0xfe, 0xff, 0x32, 0xfc, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x32, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xdb, 0xfe, 0xff, 0x93, 0xfc, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x49, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6f, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xec, 0xf9, 0xff, 0xf5, 0xfc, 0xff, 0x1c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7a, 0xfe, 0xff, 0xb1, 0xfb, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xb1, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xcb, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x49, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0xac, 0xf9, 0xff, 0xac, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x2c, 0xfa, 0xff, 0x56, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x39, 0xfe, 0xff, 0x50, 0xfb, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x2f, 0xfb, 0xff, 0x39, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x56, 0xfd, 0xff, 0x0c, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8d, 0xfa, 0xff, 0x97, 0xfd, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xce, 0xfa, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xce, 0xfa, 0xff, 0xf8, 0xfd, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xb7, 0xfd, 0xff, 0x6d, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xee, 0xfa, 0xff, 0xf8, 0xfd, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x3d, 0xff, 0xff, 0x97, 0xfd, 0xff, 0x6d, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6d, 0xfa, 0xff, 0x97, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xce, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x4f, 0xfb, 0xff, 0x39, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x56, 0xfd, 0xff, 0x2c, 0xfa, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x0c, 0xfa, 0xff, 0x56, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x39, 0xfe, 0xff, 0x4f, 0xfb, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xb1, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xf4, 0xfc, 0xff, 0x1c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7a, 0xfe, 0xff, 0xb1, 0xfb, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x32, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xba, 0xfe, 0xff, 0x32, 0xfc, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x93, 0xfc, 0xff, 0xdb, 0xfe, 0xff, 0xdb, 0xfe, 0xff, 0x93, 0xfc, 0xff, 0x6b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0xab, 0xf9, 0xff, 0xcb, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4a, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4a, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4a, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4a, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x49, 0xe1, 0x6c, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x49, 0xe1, 0x6c, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x49, 0xe1, 0x6c, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x49, 0xe1, 0x6c, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x29, 0xe1, 0x6c, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x28, 0xd1, 0x57, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6b, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0xe8, 0xd0, 0x57, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x43, 0x58, 0x23, 0x6a, 0xf1, 0xe7, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x29, 0xf1, 0xe7, 0x43, 0x58, 0x23, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x07, 0xb9, 0x5b, 0x6a, 0xf1, 0xf4, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x6a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x4a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x2a, 0xf9, 0xff, 0x29, 0xf1, 0xf3, 0xe7, 0xb8, 0x5b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1c, 0xc5, 0x88, 0x44, 0x29, 0xd1, 0xa3, 0x69, 0xd9, 0xd7, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xd2, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0x0b, 0xca, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0xeb, 0xc9, 0xff, 0x49, 0xd1, 0xd7, 0x08, 0xd1, 0xa3, 0xa5, 0x88, 0x44, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2b, 0x82, 0x08, 0x4c, 0x2e, 0x53, 0xdc, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6e, 0x5b, 0xff, 0x4e, 0x5b, 0xff, 0x4e, 0x5b, 0xff, 0x4e, 0x5b, 0xff, 0x4e, 0x5b, 0xff, 0x4e, 0x53, 0xff, 0x4e, 0x53, 0xff, 0x4e, 0x53, 0xff, 0x4e, 0x53, 0xff, 0x4e, 0x53, 0xff, 0x4e, 0x53, 0xff, 0x0d, 0x4b, 0xdc, 0x82, 0x08, 0x4c, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x23, 0x29, 0x3a, 0x60, 0xd0, 0x63, 0xfb, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xf1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xd0, 0x63, 0xff, 0xb0, 0x5b, 0xfb, 0x29, 0x32, 0x60, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x4e, 0x53, 0x98, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x11, 0x6c, 0xff, 0x11, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x11, 0x64, 0xff, 0x11, 0x64, 0xff, 0x11, 0x64, 0xff, 0x11, 0x64, 0xff, 0x11, 0x64, 0xff, 0x11, 0x64, 0xff, 0x11, 0x64, 0xff, 0x4e, 0x53, 0x98, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0xa3, 0x10, 0x33, 0xd1, 0x63, 0xd4, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xd0, 0x63, 0xd4, 0xa3, 0x10, 0x33, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x6a, 0x3a, 0x54, 0x12, 0x6c, 0xf8, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x11, 0x64, 0xf8, 0x4a, 0x3a, 0x57, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x4e, 0x53, 0x93, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x4e, 0x53, 0x94, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x21, 0x00, 0x30, 0xd1, 0x63, 0xd0, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xb0, 0x63, 0xd0, 0x21, 0x00, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x4a, 0x3a, 0x53, 0x11, 0x6c, 0xf7, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xb0, 0x63, 0xff, 0x8f, 0x5b, 0xff, 0x8f, 0x5b, 0xff, 0x8f, 0x5b, 0xff, 0x8f, 0x5b, 0xff, 0xb0, 0x63, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xf1, 0x63, 0xf7, 0x4a, 0x3a, 0x53, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x4e, 0x53, 0x8f, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x0d, 0x53, 0xff, 0x09, 0x32, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0x0d, 0x53, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x2e, 0x53, 0x8f, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2f, 0xb0, 0x63, 0xcc, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0x12, 0x64, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xb0, 0x5b, 0xcf, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x29, 0x3a, 0x50, 0xf1, 0x63, 0xf4, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0xf1, 0x63, 0xff, 0xc8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xf1, 0x63, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xf1, 0x63, 0xf7, 0x29, 0x32, 0x50, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x2e, 0x53, 0x88, 0x12, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x32, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xf1, 0x63, 0xff, 0xc8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xe8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xf1, 0x63, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x64, 0xff, 0x2e, 0x53, 0x8b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2c, 0xb0, 0x5b, 0xc8, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xf1, 0x63, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xf1, 0x63, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x90, 0x5b, 0xc8, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x86, 0x21, 0x3f, 0x8f, 0x5b, 0xc8, 0xf1, 0x63, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xf1, 0x63, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xf1, 0x63, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0x12, 0x6c, 0xff, 0xf1, 0x63, 0xff, 0x8f, 0x5b, 0xc8, 0x66, 0x21, 0x3f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2f, 0x4a, 0x3a, 0x5c, 0xcc, 0x4a, 0x87, 0xcc, 0x4a, 0x8b, 0xcc, 0x4a, 0x8b, 0xcc, 0x4a, 0x8b, 0xcc, 0x4a, 0x8b, 0xac, 0x42, 0x90, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x29, 0xff, 0xac, 0x42, 0x90, 0xcc, 0x4a, 0x8b, 0xcc, 0x4a, 0x8b, 0xcc, 0x4a, 0x8b, 0xcc, 0x4a, 0x8b, 0xcc, 0x42, 0x87, 0x2a, 0x3a, 0x5c, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x13, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x23, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x2c, 0xa7, 0x29, 0xe0, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xa7, 0x29, 0xe0, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x10, 0x66, 0x21, 0x7b, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x31, 0xff, 0xc8, 0x29, 0xff, 0x66, 0x21, 0x78, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1b, 0x66, 0x21, 0x90, 0xa7, 0x29, 0xfb, 0xc8, 0x29, 0xff, 0xc8, 0x29, 0xff, 0xa7, 0x29, 0xfb, 0x66, 0x21, 0x93, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0xa3, 0x10, 0x40, 0x05, 0x19, 0x74, 0x05, 0x19, 0x74, 0xa3, 0x10, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0xf0, 0x6b, 0x1c, 0xf4, 0x8c, 0x63, 0x86, 0xf4, 
+  0x8c, 0x6c, 0x03, 0xf4, 0x8c, 0x6b, 0x73, 0x7c, 0x34, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x73, 0x7c, 0x34, 0xd4, 0x8c, 0x6b, 
+  0x84, 0xd4, 0x8c, 0x6c, 0x04, 0xd4, 0x84, 0x6c, 0xd4, 0x8c, 0x6c, 0xd4, 0x8c, 0x63, 0xd0, 0x6b, 0x1c, 0x00, 0x00, 0x07, 0x9a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0xd0, 0x6b, 0x1f, 0xd4, 
+  0x84, 0xe3, 0xb4, 0x7c, 0xff, 0x87, 0x94, 0x7c, 0xff, 0x02, 0xb4, 0x84, 0xfb, 0x93, 0x84, 0x58, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x93, 0x7c, 0x57, 0xb4, 0x7c, 
+  0xfb, 0x88, 0x93, 0x7c, 0xff, 0x02, 0xb4, 0x84, 0xe3, 0xaf, 0x63, 0x1f, 0x00, 0x00, 0x04, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x52, 0x74, 0x63, 0x88, 0x94, 0x7c, 0xff, 0x81, 0x93, 
+  0x7c, 0xff, 0x02, 0x73, 0x7c, 0xb0, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x73, 0x74, 0xb0, 0x86, 0x93, 0x7c, 0xff, 0x00, 0x93, 
+  0x74, 0xff, 0x82, 0x73, 0x74, 0xff, 0x01, 0x32, 0x74, 0x63, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x32, 0x74, 0x6c, 0xb4, 0x7c, 0xff, 0x89, 0x94, 0x7c, 0xff, 0x02, 
+  0x73, 0x74, 0xb7, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x53, 0x74, 0xb7, 0x86, 0x93, 0x7c, 0xff, 0x83, 0x73, 0x7c, 0xff, 0x01, 
+  0xf1, 0x6b, 0x6c, 0x00, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x12, 0x6c, 0x6f, 0x8a, 0x94, 0x7c, 0xff, 0x02, 0x53, 0x74, 0xb8, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x85, 
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x52, 0x74, 0xb8, 0x82, 0x93, 0x7c, 0xff, 0x00, 0x73, 0x7c, 0xff, 0x82, 0x93, 0x7c, 0xff, 0x82, 0x73, 0x7c, 0xff, 0x02, 0x73, 0x74, 
+  0xff, 0xf1, 0x6b, 0x6f, 0x00, 0x00, 0x0c, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0b, 0xf1, 0x6b, 0x6b, 0x83, 0x94, 0x7c, 0xff, 0x00, 0x93, 0x7c, 0xff, 0x82, 0x94, 0x7c, 0xff, 0x82, 0x93, 
+  0x7c, 0xff, 0x02, 0x52, 0x74, 0xb4, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x32, 0x74, 0xb4, 0x82, 0x93, 0x7c, 0xff, 0x00, 0x73, 
+  0x7c, 0xff, 0x81, 0x93, 0x7c, 0xff, 0x00, 0x73, 0x7c, 0xff, 0x83, 0x73, 0x74, 0xff, 0x01, 0xd0, 0x63, 0x68, 0x00, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x6a, 0x42, 0x2c, 
+  0x52, 0x74, 0xe7, 0x86, 0x94, 0x7c, 0xff, 0x81, 0x93, 0x7c, 0xff, 0x03, 0x73, 0x7c, 0xfc, 0x8f, 0x63, 0x64, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x0f, 0x8f, 0x5b, 0x64, 0x73, 0x74, 0xfc, 0x85, 0x93, 0x7c, 0xff, 0x82, 0x73, 0x74, 0xff, 0x02, 0x32, 0x74, 0xe7, 0x4a, 0x3a, 0x2c, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x29, 0x3a, 0x37, 0x4e, 0x5b, 0x78, 0x82, 0x4e, 0x5b, 0x84, 0x01, 0x4e, 0x5b, 0x88, 0x2d, 0x53, 0xdb, 0x81, 0x2d, 0x53, 0xff, 0x03, 0x4e, 0x5b, 0x87, 0xac, 
+  0x4a, 0x50, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x87, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1b, 0xab, 0x4a, 0x50, 0x2e, 0x53, 0x87, 0x81, 0x0d, 0x53, 0xff, 0x01, 0x0d, 0x53, 
+  0xd8, 0x2e, 0x53, 0x88, 0x82, 0x4e, 0x53, 0x84, 0x03, 0x2e, 0x53, 0x78, 0x09, 0x3a, 0x37, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x99, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x1f, 0x81, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x6a, 0x42, 0xbf, 0x81, 0x8b, 0x4a, 0xff, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1c, 0x00, 
+  0x00, 0x0f, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x30, 0x81, 0x6a, 0x42, 0xff, 0x02, 0x49, 0x42, 0xbf, 0x00, 0x00, 
+  0x30, 0x00, 0x00, 0x24, 0x81, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x93, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 
+  0x84, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x27, 0x49, 0x32, 0xbc, 0x81, 0x6a, 0x3a, 0xff, 
+  0x03, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x87, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x2b, 0x81, 0x4a, 
+  0x3a, 0xff, 0x03, 0x29, 0x2a, 0xbc, 0x00, 0x00, 0x27, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x81, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x0b, 0x01, 0x00, 
+  0x00, 0x04, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x8e, 0xf2, 0x68, 0x6d, 0xfa, 0xd8, 0x96, 0x4d, 0xfa, 0xff, 0x92, 0x2d, 0xfa, 0xff, 0x81, 0x0d, 
+  0xfa, 0xff, 0x03, 0x2d, 0xfa, 0xd8, 0x4d, 0xf2, 0x68, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x6d, 0xf2, 0x80, 0x0c, 0xfa, 0xff, 0xec, 0xf9, 0xff, 
+  0x91, 0xcc, 0xf9, 0xff, 0x00, 0xac, 0xf9, 0xff, 0x82, 0xcc, 0xf9, 0xff, 0x83, 0xac, 0xf9, 0xff, 0x8a, 0xab, 0xf9, 0xff, 0x87, 0x8b, 0xf9, 0xff, 0x02, 0xab, 0xf9, 0xff, 0x2c, 0xf2, 0x83, 0x00, 
+  0x00, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0xeb, 0xc1, 0x24, 0x0c, 0xfa, 0xf8, 0x92, 0xcc, 0xf9, 0xff, 0x81, 0xac, 0xf9, 0xff, 0x81, 0xcc, 0xf9, 0xff, 0x83, 0xac, 0xf9, 0xff, 
+  0x8a, 0xab, 0xf9, 0xff, 0x89, 0x8b, 0xf9, 0xff, 0x02, 0xab, 0xf9, 0xf8, 0xaa, 0xc1, 0x24, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xcb, 0xe9, 0x5f, 0x8f, 0xcc, 0xf9, 
+  0xff, 0x83, 0xac, 0xf9, 0xff, 0x00, 0xab, 0xf9, 0xff, 0x82, 0xac, 0xf9, 0xff, 0x8b, 0xab, 0xf9, 0xff, 0x8d, 0x8b, 0xf9, 0xff, 0x01, 0x8a, 0xe9, 0x5f, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x07, 0x8b, 0xe9, 0x6c, 0x83, 0xcc, 0xf9, 0xff, 0x02, 0x56, 0xfd, 0xff, 0x97, 0xfd, 0xff, 0x8e, 0xfa, 0xff, 0x87, 0xcc, 0xf9, 0xff, 0x88, 0xac, 0xf9, 0xff, 0x8b, 0xab, 0xf9, 
+  0xff, 0x86, 0x8b, 0xf9, 0xff, 0x02, 0x6d, 0xfa, 0xff, 0x76, 0xfd, 0xff, 0x35, 0xfd, 0xff, 0x83, 0x8b, 0xf9, 0xff, 0x01, 0x6a, 0xe9, 0x6b, 0x00, 0x00, 0x07, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x08, 0x8a, 0xe1, 0x6c, 0x82, 0xcc, 0xf9, 0xff, 0x06, 0xab, 0xf9, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x56, 0xfd, 0xff, 0x2d, 0xfa, 0xff, 0xcc, 0xf9, 0xff, 0x83, 
+  0xac, 0xf9, 0xff, 0x91, 0xab, 0xf9, 0xff, 0x88, 0x8b, 0xf9, 0xff, 0x05, 0x0c, 0xfa, 0xff, 0x56, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x4a, 0xf9, 0xff, 0x82, 0x8b, 
+  0xf9, 0xff, 0x01, 0x4a, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6f, 0x83, 0xcc, 0xf9, 0xff, 0x01, 0xb1, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0x81, 
+  0x7d, 0xff, 0xff, 0x02, 0x1c, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xec, 0xf9, 0xff, 0x82, 0xac, 0xf9, 0xff, 0x94, 0xab, 0xf9, 0xff, 0x83, 0x8b, 0xf9, 0xff, 0x02, 0xcc, 0xf9, 0xff, 0xf4, 0xfc, 0xff, 
+  0x1c, 0xff, 0xff, 0x81, 0x7d, 0xff, 0xff, 0x01, 0x7a, 0xfe, 0xff, 0xb0, 0xfb, 0xff, 0x83, 0x8b, 0xf9, 0xff, 0x01, 0x49, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0x8a, 0xe1, 0x6f, 0x84, 0xcc, 0xf9, 0xff, 0x02, 0xac, 0xf9, 0xff, 0x32, 0xfc, 0xff, 0xbb, 0xfe, 0xff, 0x81, 0x7d, 0xff, 0xff, 0x01, 0xfb, 0xfe, 0xff, 0x94, 0xfc, 0xff, 0x95, 0xab, 0xf9, 
+  0xff, 0x83, 0x8b, 0xf9, 0xff, 0x06, 0x93, 0xfc, 0xff, 0xdb, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xbb, 0xfe, 0xff, 0x32, 0xfc, 0xff, 0x6b, 0xf9, 0xff, 0x83, 0x8b, 0xf9, 0xff, 0x02, 
+  0x6b, 0xf9, 0xff, 0x49, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6f, 0x87, 0xac, 0xf9, 0xff, 0x01, 0x94, 0xfc, 0xff, 0xfb, 0xfe, 0xff, 0x81, 
+  0x7d, 0xff, 0xff, 0x01, 0xbb, 0xfe, 0xff, 0x32, 0xfc, 0xff, 0x8f, 0xab, 0xf9, 0xff, 0x85, 0x8b, 0xf9, 0xff, 0x01, 0x32, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0x81, 0x7d, 0xff, 0xff, 0x01, 0xdb, 0xfe, 
+  0xff, 0x93, 0xfc, 0xff, 0x83, 0x8b, 0xf9, 0xff, 0x83, 0x6b, 0xf9, 0xff, 0x01, 0x49, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x8a, 0xe1, 0x6f, 0x88, 0xac, 
+  0xf9, 0xff, 0x02, 0xec, 0xf9, 0xff, 0xf5, 0xfc, 0xff, 0x1c, 0xff, 0xff, 0x81, 0x7d, 0xff, 0xff, 0x01, 0x7a, 0xfe, 0xff, 0xb1, 0xfb, 0xff, 0x8c, 0xab, 0xf9, 0xff, 0x84, 0x8b, 0xf9, 0xff, 0x06, 
+  0xb1, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xcb, 0xf9, 0xff, 0x83, 0x8b, 0xf9, 0xff, 0x84, 0x6b, 0xf9, 0xff, 0x01, 0x49, 0xe1, 
+  0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0x81, 0xac, 0xf9, 0xff, 0x88, 0xab, 0xf9, 0xff, 0x02, 0x2c, 0xfa, 0xff, 0x56, 0xfd, 0xff, 0x3c, 0xff, 
+  0xff, 0x81, 0x5d, 0xff, 0xff, 0x01, 0x39, 0xfe, 0xff, 0x50, 0xfb, 0xff, 0x85, 0xab, 0xf9, 0xff, 0x87, 0x8b, 0xf9, 0xff, 0x06, 0x2f, 0xfb, 0xff, 0x39, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 
+  0xff, 0x3c, 0xff, 0xff, 0x56, 0xfd, 0xff, 0x0c, 0xfa, 0xff, 0x81, 0x8b, 0xf9, 0xff, 0x88, 0x6b, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0x6a, 0xe1, 0x6f, 0x8c, 0xab, 0xf9, 0xff, 0x06, 0x8d, 0xfa, 0xff, 0x97, 0xfd, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0xce, 0xfa, 0xff, 0x82, 0xab, 
+  0xf9, 0xff, 0x86, 0x8b, 0xf9, 0xff, 0x06, 0xce, 0xfa, 0xff, 0xf8, 0xfd, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xb7, 0xfd, 0xff, 0x6d, 0xfa, 0xff, 0x82, 0x8b, 0xf9, 0xff, 
+  0x89, 0x6b, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0x8e, 0xab, 0xf9, 0xff, 0x01, 0xee, 0xfa, 0xff, 0xf8, 0xfd, 
+  0xff, 0x81, 0x5d, 0xff, 0xff, 0x02, 0x3d, 0xff, 0xff, 0x97, 0xfd, 0xff, 0x6d, 0xfa, 0xff, 0x85, 0x8b, 0xf9, 0xff, 0x02, 0x6d, 0xfa, 0xff, 0x97, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x81, 0x5d, 0xff, 
+  0xff, 0x01, 0xf8, 0xfd, 0xff, 0xce, 0xfa, 0xff, 0x83, 0x8b, 0xf9, 0xff, 0x8a, 0x6b, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x6a, 
+  0xe1, 0x6f, 0x8a, 0xab, 0xf9, 0xff, 0x00, 0x8b, 0xf9, 0xff, 0x84, 0xab, 0xf9, 0xff, 0x06, 0x4f, 0xfb, 0xff, 0x39, 0xfe, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x56, 0xfd, 
+  0xff, 0x2c, 0xfa, 0xff, 0x81, 0x8b, 0xf9, 0xff, 0x06, 0x0c, 0xfa, 0xff, 0x56, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x39, 0xfe, 0xff, 0x4f, 0xfb, 0xff, 0x81, 0x8b, 
+  0xf9, 0xff, 0x8e, 0x6b, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6f, 0x89, 0xab, 0xf9, 0xff, 0x00, 0x8b, 0xf9, 0xff, 
+  0x84, 0xab, 0xf9, 0xff, 0x82, 0x8b, 0xf9, 0xff, 0x01, 0xb1, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0x81, 0x7d, 0xff, 0xff, 0x03, 0x1c, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xf4, 0xfc, 0xff, 0x1c, 0xff, 0xff, 
+  0x81, 0x7d, 0xff, 0xff, 0x01, 0x7a, 0xfe, 0xff, 0xb1, 0xfb, 0xff, 0x82, 0x8b, 0xf9, 0xff, 0x8f, 0x6b, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x08, 0x6a, 0xe1, 0x6c, 0x94, 0x8b, 0xf9, 0xff, 0x02, 0x32, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0x7d, 0xff, 0xff, 0x81, 0x5d, 0xff, 0xff, 0x02, 0x7d, 0xff, 0xff, 0xba, 0xfe, 0xff, 0x32, 0xfc, 
+  0xff, 0x90, 0x6b, 0xf9, 0xff, 0x83, 0x4a, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6c, 0x96, 0x8b, 0xf9, 0xff, 0x00, 
+  0x93, 0xfc, 0xff, 0x81, 0xdb, 0xfe, 0xff, 0x02, 0x93, 0xfc, 0xff, 0x6b, 0xf9, 0xff, 0x8b, 0xf9, 0xff, 0x90, 0x6b, 0xf9, 0xff, 0x83, 0x4a, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 
+  0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x6a, 0xe1, 0x6c, 0x97, 0x8b, 0xf9, 0xff, 0x01, 0xab, 0xf9, 0xff, 0xcb, 0xf9, 0xff, 0x81, 0x8b, 0xf9, 0xff, 0x8c, 0x6b, 0xf9, 0xff, 0x00, 0x6a, 
+  0xf9, 0xff, 0x82, 0x6b, 0xf9, 0xff, 0x84, 0x4a, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x4a, 0xe1, 0x6c, 0x95, 0x8b, 0xf9, 0xff, 
+  0x8d, 0x6b, 0xf9, 0xff, 0x83, 0x6a, 0xf9, 0xff, 0x89, 0x4a, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x4a, 0xe1, 0x6c, 0x94, 0x8b, 
+  0xf9, 0xff, 0x8d, 0x6b, 0xf9, 0xff, 0x84, 0x6a, 0xf9, 0xff, 0x89, 0x4a, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x4a, 0xe1, 0x6c, 
+  0x8d, 0x8b, 0xf9, 0xff, 0x8f, 0x6b, 0xf9, 0xff, 0x84, 0x6a, 0xf9, 0xff, 0x8e, 0x4a, 0xf9, 0xff, 0x01, 0x29, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x4a, 
+  0xe1, 0x6c, 0x8b, 0x8b, 0xf9, 0xff, 0x90, 0x6b, 0xf9, 0xff, 0x84, 0x6a, 0xf9, 0xff, 0x8f, 0x4a, 0xf9, 0xff, 0x01, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0x49, 0xe1, 0x6c, 0x88, 0x8b, 0xf9, 0xff, 0x92, 0x6b, 0xf9, 0xff, 0x84, 0x6a, 0xf9, 0xff, 0x90, 0x4a, 0xf9, 0xff, 0x01, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x08, 0x49, 0xe1, 0x6c, 0x9a, 0x6b, 0xf9, 0xff, 0x84, 0x6a, 0xf9, 0xff, 0x91, 0x4a, 0xf9, 0xff, 0x01, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0x49, 0xe1, 0x6c, 0x99, 0x6b, 0xf9, 0xff, 0x84, 0x6a, 0xf9, 0xff, 0x91, 0x4a, 0xf9, 0xff, 0x02, 0x2a, 0xf9, 0xff, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x08, 0x49, 0xe1, 0x6c, 0x93, 0x6b, 0xf9, 0xff, 0x84, 0x6a, 0xf9, 0xff, 0x93, 0x4a, 0xf9, 0xff, 0x84, 0x2a, 0xf9, 0xff, 0x01, 0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x08, 0x29, 0xe1, 0x6c, 0x89, 0x6b, 0xf9, 0xff, 0x00, 0x6a, 0xf9, 0xff, 0x85, 0x6b, 0xf9, 0xff, 0x86, 0x6a, 0xf9, 0xff, 0x93, 0x4a, 0xf9, 0xff, 0x85, 0x2a, 0xf9, 0xff, 0x01, 
+  0x09, 0xe1, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x28, 0xd1, 0x57, 0x86, 0x6b, 0xf9, 0xff, 0x81, 0x6a, 0xf9, 0xff, 0x86, 0x6b, 0xf9, 0xff, 0x85, 0x6a, 0xf9, 
+  0xff, 0x94, 0x4a, 0xf9, 0xff, 0x86, 0x2a, 0xf9, 0xff, 0x01, 0xe8, 0xd0, 0x57, 0x00, 0x00, 0x07, 0x89, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x43, 0x58, 0x23, 0x6a, 0xf1, 0xe7, 0x8c, 0x6a, 
+  0xf9, 0xff, 0x96, 0x4a, 0xf9, 0xff, 0x8b, 0x2a, 0xf9, 0xff, 0x02, 0x29, 0xf1, 0xe7, 0x43, 0x58, 0x23, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x07, 
+  0xb9, 0x5b, 0x6a, 0xf1, 0xf4, 0x89, 0x6a, 0xf9, 0xff, 0x97, 0x4a, 0xf9, 0xff, 0x8b, 0x2a, 0xf9, 0xff, 0x03, 0x29, 0xf1, 0xf3, 0xe7, 0xb8, 0x5b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x8a, 0x00, 
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1c, 0xc5, 0x88, 0x44, 0x29, 0xd1, 0xa3, 0x69, 0xd9, 0xd7, 0x84, 0x0b, 0xd2, 0xff, 0x82, 0x0b, 0xca, 0xff, 0x84, 0x0b, 0xd2, 0xff, 0x8c, 0x0b, 
+  0xca, 0xff, 0x8f, 0xeb, 0xc9, 0xff, 0x04, 0x49, 0xd1, 0xd7, 0x08, 0xd1, 0xa3, 0xa5, 0x88, 0x44, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x8b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2b, 0x82, 0x08, 0x4c, 0x2e, 0x53, 0xdc, 0x9c, 0x6f, 0x5b, 0xff, 0x00, 0x6e, 0x5b, 0xff, 0x83, 0x4e, 0x5b, 0xff, 0x85, 0x4e, 0x53, 0xff, 0x05, 0x0d, 0x4b, 
+  0xdc, 0x82, 0x08, 0x4c, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 
+  0x23, 0x29, 0x3a, 0x60, 0xd0, 0x63, 0xfb, 0x86, 0xf1, 0x63, 0xff, 0x93, 0xd1, 0x63, 0xff, 0x8a, 0xd0, 0x63, 0xff, 0x05, 0xb0, 0x5b, 0xfb, 0x29, 0x32, 0x60, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0f, 
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x4e, 0x53, 0x98, 0x98, 0x12, 0x6c, 0xff, 0x81, 0x11, 0x6c, 0xff, 0x83, 
+  0x12, 0x6c, 0xff, 0x86, 0x11, 0x64, 0xff, 0x03, 0x4e, 0x53, 0x98, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x92, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0xa3, 
+  0x10, 0x33, 0xd1, 0x63, 0xd4, 0xa2, 0x32, 0x6c, 0xff, 0x04, 0x12, 0x6c, 0xff, 0xd0, 0x63, 0xd4, 0xa3, 0x10, 0x33, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x94, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x07, 0x00, 0x00, 0x18, 0x6a, 0x3a, 0x54, 0x12, 0x6c, 0xf8, 0xa1, 0x32, 0x6c, 0xff, 0x03, 0x11, 0x64, 0xf8, 0x4a, 0x3a, 0x57, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x95, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x4e, 0x53, 0x93, 0x9e, 0x32, 0x6c, 0xff, 0x82, 0x12, 0x6c, 0xff, 0x03, 0x4e, 0x53, 0x94, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+  0x03, 0x96, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x21, 0x00, 0x30, 0xd1, 0x63, 0xd0, 0x9c, 0x32, 0x6c, 0xff, 0x82, 0x12, 0x6c, 0xff, 0x03, 0xb0, 0x63, 0xd0, 0x21, 0x00, 
+  0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x4a, 0x3a, 0x53, 0x11, 0x6c, 0xf7, 0x8a, 0x32, 0x6c, 0xff, 0x01, 0x12, 0x6c, 0xff, 
+  0xb0, 0x63, 0xff, 0x83, 0x8f, 0x5b, 0xff, 0x00, 0xb0, 0x63, 0xff, 0x8b, 0x12, 0x6c, 0xff, 0x03, 0xf1, 0x63, 0xf7, 0x4a, 0x3a, 0x53, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x99, 0x00, 0x00, 0x00, 
+  0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x4e, 0x53, 0x8f, 0x8a, 0x32, 0x6c, 0xff, 0x01, 0x0d, 0x53, 0xff, 0x09, 0x32, 0xff, 0x84, 0xe8, 0x31, 0xff, 0x00, 0x0d, 0x53, 0xff, 
+  0x8a, 0x12, 0x6c, 0xff, 0x03, 0x2e, 0x53, 0x8f, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2f, 0xb0, 
+  0x63, 0xcc, 0x81, 0x32, 0x6c, 0xff, 0x81, 0x12, 0x6c, 0xff, 0x84, 0x32, 0x6c, 0xff, 0x00, 0x12, 0x6c, 0xff, 0x87, 0xe8, 0x31, 0xff, 0x00, 0x12, 0x64, 0xff, 0x88, 0x12, 0x6c, 0xff, 0x03, 0xb0, 
+  0x5b, 0xcf, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x29, 0x3a, 0x50, 0xf1, 0x63, 0xf4, 0x87, 0x32, 0x6c, 0xff, 
+  0x01, 0xf1, 0x63, 0xff, 0xc8, 0x31, 0xff, 0x85, 0xe8, 0x31, 0xff, 0x01, 0xc8, 0x31, 0xff, 0xf1, 0x63, 0xff, 0x87, 0x12, 0x6c, 0xff, 0x03, 0xf1, 0x63, 0xf7, 0x29, 0x32, 0x50, 0x00, 0x00, 0x18, 
+  0x00, 0x00, 0x07, 0x9d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x2e, 0x53, 0x88, 0x12, 0x6c, 0xff, 0x84, 0x32, 0x6c, 0xff, 0x81, 0x12, 0x6c, 0xff, 0x01, 
+  0xf1, 0x63, 0xff, 0xc8, 0x31, 0xff, 0x85, 0xe8, 0x31, 0xff, 0x01, 0xc8, 0x31, 0xff, 0xf1, 0x63, 0xff, 0x86, 0x12, 0x6c, 0xff, 0x04, 0x12, 0x64, 0xff, 0x2e, 0x53, 0x8b, 0x00, 0x00, 0x23, 0x00, 
+  0x00, 0x0b, 0x00, 0x00, 0x03, 0x9e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2c, 0xb0, 0x5b, 0xc8, 0x86, 0x12, 0x6c, 0xff, 0x00, 0xf1, 0x63, 0xff, 0x87, 0xc8, 
+  0x31, 0xff, 0x00, 0xf1, 0x63, 0xff, 0x86, 0x12, 0x6c, 0xff, 0x03, 0x90, 0x5b, 0xc8, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 
+  0x00, 0x17, 0x86, 0x21, 0x3f, 0x8f, 0x5b, 0xc8, 0xf1, 0x63, 0xff, 0x84, 0x12, 0x6c, 0xff, 0x00, 0xf1, 0x63, 0xff, 0x87, 0xc8, 0x31, 0xff, 0x00, 0xf1, 0x63, 0xff, 0x84, 0x12, 0x6c, 0xff, 0x04, 
+  0xf1, 0x63, 0xff, 0x8f, 0x5b, 0xc8, 0x66, 0x21, 0x3f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0xa2, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2f, 0x4a, 0x3a, 0x5c, 
+  0xcc, 0x4a, 0x87, 0x83, 0xcc, 0x4a, 0x8b, 0x00, 0xac, 0x42, 0x90, 0x86, 0xc8, 0x31, 0xff, 0x01, 0xc8, 0x29, 0xff, 0xac, 0x42, 0x90, 0x83, 0xcc, 0x4a, 0x8b, 0x04, 0xcc, 0x42, 0x87, 0x2a, 0x3a, 
+  0x5c, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x13, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x23, 0x83, 0x00, 
+  0x00, 0x24, 0x01, 0x00, 0x00, 0x2c, 0xa7, 0x29, 0xe0, 0x85, 0xc8, 0x31, 0xff, 0x01, 0xa7, 0x29, 0xe0, 0x00, 0x00, 0x2c, 0x83, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 
+  0x00, 0x13, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x10, 0x66, 0x21, 
+  0x7b, 0x84, 0xc8, 0x31, 0xff, 0x02, 0xc8, 0x29, 0xff, 0x66, 0x21, 0x78, 0x00, 0x00, 0x10, 0x84, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xa9, 0x00, 0x00, 
+  0x00, 0x83, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1b, 0x66, 0x21, 0x90, 0xa7, 0x29, 0xfb, 0x81, 0xc8, 0x29, 0xff, 0x03, 0xa7, 0x29, 0xfb, 0x66, 0x21, 0x93, 0x00, 0x00, 0x1b, 
+  0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0xa3, 0x10, 0x40, 0x81, 0x05, 0x19, 0x74, 0x02, 0xa3, 0x10, 0x40, 0x00, 0x00, 0x20, 
+  0x00, 0x00, 0x08, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x14, 0x81, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xbb, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 
+  0x03, 0x9e, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6b, 0xf0, 0x1c, 0x8c, 0xf4, 0x63, 0x8c, 0xf4, 0x6c, 0x8c, 0xf4, 0x6c, 0x8c, 0xf4, 0x6c, 0x8c, 0xf4, 0x6c, 0x8c, 0xf4, 0x6c, 0x8c, 0xf4, 0x6c, 0x8c, 0xf4, 0x6c, 0x8c, 0xf4, 0x6b, 0x7c, 0x73, 0x34, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x7c, 0x73, 0x34, 0x8c, 0xd4, 0x6b, 0x8c, 0xd4, 0x6c, 0x8c, 0xd4, 0x6c, 0x8c, 0xd4, 0x6c, 0x8c, 0xd4, 0x6c, 0x8c, 0xd4, 0x6c, 0x84, 0xd4, 0x6c, 0x8c, 0xd4, 0x6c, 0x8c, 0xd4, 0x63, 0x6b, 0xd0, 0x1c, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0xd0, 0x1f, 0x84, 0xd4, 0xe3, 0x7c, 0xb4, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x84, 0xb4, 0xfb, 0x84, 0x93, 0x58, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7c, 0x93, 0x57, 0x7c, 0xb4, 0xfb, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x84, 0xb4, 0xe3, 0x63, 0xaf, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x52, 0x63, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xb0, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x74, 0x73, 0xb0, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x74, 0x93, 0xff, 0x74, 0x73, 0xff, 0x74, 0x73, 0xff, 0x74, 0x73, 0xff, 0x74, 0x32, 0x63, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x74, 0x32, 0x6c, 0x7c, 0xb4, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x74, 0x73, 0xb7, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x74, 0x53, 0xb7, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x73, 0xff, 0x6b, 0xf1, 0x6c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x6c, 0x12, 0x6f, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x74, 0x53, 0xb8, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x74, 0x52, 0xb8, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x73, 0xff, 0x74, 0x73, 0xff, 0x6b, 0xf1, 0x6f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x6b, 0xf1, 0x6b, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x74, 0x52, 0xb4, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x74, 0x32, 0xb4, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xff, 0x74, 0x73, 0xff, 0x74, 0x73, 0xff, 0x74, 0x73, 0xff, 0x74, 0x73, 0xff, 0x63, 0xd0, 0x68, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x6a, 0x2c, 0x74, 0x52, 0xe7, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x94, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x73, 0xfc, 0x63, 0x8f, 0x64, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x5b, 0x8f, 0x64, 0x74, 0x73, 0xfc, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x7c, 0x93, 0xff, 0x74, 0x73, 0xff, 0x74, 0x73, 0xff, 0x74, 0x73, 0xff, 0x74, 0x32, 0xe7, 0x3a, 0x4a, 0x2c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x3a, 0x29, 0x37, 0x5b, 0x4e, 0x78, 0x5b, 0x4e, 0x84, 0x5b, 0x4e, 0x84, 0x5b, 0x4e, 0x84, 0x5b, 0x4e, 0x88, 0x53, 0x2d, 0xdb, 0x53, 0x2d, 0xff, 0x53, 0x2d, 0xff, 0x5b, 0x4e, 0x87, 0x4a, 0xac, 0x50, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1b, 0x4a, 0xab, 0x50, 0x53, 0x2e, 0x87, 0x53, 0x0d, 0xff, 0x53, 0x0d, 0xff, 0x53, 0x0d, 0xd8, 0x53, 0x2e, 0x88, 0x53, 0x4e, 0x84, 0x53, 0x4e, 0x84, 0x53, 0x4e, 0x84, 0x53, 0x2e, 0x78, 0x3a, 0x09, 0x37, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x42, 0x6a, 0xbf, 0x4a, 0x8b, 0xff, 0x4a, 0x8b, 0xff, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x30, 0x42, 0x6a, 0xff, 0x42, 0x6a, 0xff, 0x42, 0x49, 0xbf, 0x00, 0x00, 0x30, 0x00, 0x00, 0x24, 0x00, 0x00, 0x23, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x27, 0x32, 0x49, 0xbc, 0x3a, 0x6a, 0xff, 0x3a, 0x6a, 0xff, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x2b, 0x3a, 0x4a, 0xff, 0x3a, 0x4a, 0xff, 0x2a, 0x29, 0xbc, 0x00, 0x00, 0x27, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0xf2, 0x8e, 0x68, 0xfa, 0x6d, 0xd8, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x2d, 0xd8, 0xf2, 0x4d, 0x68, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf2, 0x6d, 0x80, 0xfa, 0x0c, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xab, 0xff, 0xf2, 0x2c, 0x83, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc1, 0xeb, 0x24, 0xfa, 0x0c, 0xf8, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xab, 0xf8, 0xc1, 0xaa, 0x24, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe9, 0xcb, 0x5f, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xe9, 0x8a, 0x5f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe9, 0x8b, 0x6c, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xfd, 0x56, 0xff, 0xfd, 0x97, 0xff, 0xfa, 0x8e, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfa, 0x6d, 0xff, 0xfd, 0x76, 0xff, 0xfd, 0x35, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xe9, 0x6a, 0x6b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6c, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xab, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x56, 0xff, 0xfa, 0x2d, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfa, 0x0c, 0xff, 0xfd, 0x56, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xe1, 0x4a, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6f, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xfb, 0xb1, 0xff, 0xfe, 0x7a, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0xfc, 0xf5, 0xff, 0xf9, 0xec, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xcc, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0x7a, 0xff, 0xfb, 0xb0, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xe1, 0x49, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6f, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xcc, 0xff, 0xf9, 0xac, 0xff, 0xfc, 0x32, 0xff, 0xfe, 0xbb, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0xfb, 0xff, 0xfc, 0x94, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfc, 0x93, 0xff, 0xfe, 0xdb, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0xbb, 0xff, 0xfc, 0x32, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x49, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6f, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xfc, 0x94, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0xbb, 0xff, 0xfc, 0x32, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfc, 0x32, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0xdb, 0xff, 0xfc, 0x93, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x49, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6f, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xec, 0xff, 0xfc, 0xf5, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0x7a, 0xff, 0xfb, 0xb1, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfb, 0xb1, 0xff, 0xfe, 0x7a, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x1c, 0xff, 0xfc, 0xf5, 0xff, 0xf9, 0xcb, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x49, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0xf9, 0xac, 0xff, 0xf9, 0xac, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xfa, 0x2c, 0xff, 0xfd, 0x56, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xfe, 0x39, 0xff, 0xfb, 0x50, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfb, 0x2f, 0xff, 0xfe, 0x39, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x56, 0xff, 0xfa, 0x0c, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xfa, 0x8d, 0xff, 0xfd, 0x97, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xfd, 0xf8, 0xff, 0xfa, 0xce, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfa, 0xce, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xfd, 0xb7, 0xff, 0xfa, 0x6d, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xfa, 0xee, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x3d, 0xff, 0xfd, 0x97, 0xff, 0xfa, 0x6d, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfa, 0x6d, 0xff, 0xfd, 0x97, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xfd, 0xf8, 0xff, 0xfa, 0xce, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xfb, 0x4f, 0xff, 0xfe, 0x39, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x56, 0xff, 0xfa, 0x2c, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfa, 0x0c, 0xff, 0xfd, 0x56, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xfe, 0x39, 0xff, 0xfb, 0x4f, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfb, 0xb1, 0xff, 0xfe, 0x7a, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x1c, 0xff, 0xfc, 0xf5, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0x7a, 0xff, 0xfb, 0xb1, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfc, 0x32, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0xba, 0xff, 0xfc, 0x32, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xfc, 0x93, 0xff, 0xfe, 0xdb, 0xff, 0xfe, 0xdb, 0xff, 0xfc, 0x93, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0xab, 0xff, 0xf9, 0xcb, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x4a, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x4a, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x4a, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x4a, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x49, 0x6c, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x8b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x49, 0x6c, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x49, 0x6c, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x49, 0x6c, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x29, 0x6c, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd1, 0x28, 0x57, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xd0, 0xe8, 0x57, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x58, 0x43, 0x23, 0xf1, 0x6a, 0xe7, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf1, 0x29, 0xe7, 0x58, 0x43, 0x23, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0xb9, 0x07, 0x5b, 0xf1, 0x6a, 0xf4, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x6a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x4a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf9, 0x2a, 0xff, 0xf1, 0x29, 0xf3, 0xb8, 0xe7, 0x5b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1c, 0x88, 0xc5, 0x44, 0xd1, 0x29, 0xa3, 0xd9, 0x69, 0xd7, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xd2, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xca, 0x0b, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xc9, 0xeb, 0xff, 0xd1, 0x49, 0xd7, 0xd1, 0x08, 0xa3, 0x88, 0xa5, 0x44, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2b, 0x08, 0x82, 0x4c, 0x53, 0x2e, 0xdc, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6e, 0xff, 0x5b, 0x4e, 0xff, 0x5b, 0x4e, 0xff, 0x5b, 0x4e, 0xff, 0x5b, 0x4e, 0xff, 0x53, 0x4e, 0xff, 0x53, 0x4e, 0xff, 0x53, 0x4e, 0xff, 0x53, 0x4e, 0xff, 0x53, 0x4e, 0xff, 0x53, 0x4e, 0xff, 0x4b, 0x0d, 0xdc, 0x08, 0x82, 0x4c, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x23, 0x3a, 0x29, 0x60, 0x63, 0xd0, 0xfb, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xf1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x63, 0xd0, 0xff, 0x5b, 0xb0, 0xfb, 0x32, 0x29, 0x60, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x53, 0x4e, 0x98, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x11, 0xff, 0x6c, 0x11, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x64, 0x11, 0xff, 0x64, 0x11, 0xff, 0x64, 0x11, 0xff, 0x64, 0x11, 0xff, 0x64, 0x11, 0xff, 0x64, 0x11, 0xff, 0x64, 0x11, 0xff, 0x53, 0x4e, 0x98, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x10, 0xa3, 0x33, 0x63, 0xd1, 0xd4, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xd0, 0xd4, 0x10, 0xa3, 0x33, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x3a, 0x6a, 0x54, 0x6c, 0x12, 0xf8, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x64, 0x11, 0xf8, 0x3a, 0x4a, 0x57, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x53, 0x4e, 0x93, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x53, 0x4e, 0x94, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x21, 0x30, 0x63, 0xd1, 0xd0, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xb0, 0xd0, 0x00, 0x21, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x3a, 0x4a, 0x53, 0x6c, 0x11, 0xf7, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xb0, 0xff, 0x5b, 0x8f, 0xff, 0x5b, 0x8f, 0xff, 0x5b, 0x8f, 0xff, 0x5b, 0x8f, 0xff, 0x63, 0xb0, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xf1, 0xf7, 0x3a, 0x4a, 0x53, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x53, 0x4e, 0x8f, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x53, 0x0d, 0xff, 0x32, 0x09, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x53, 0x0d, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x53, 0x2e, 0x8f, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2f, 0x63, 0xb0, 0xcc, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x64, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x5b, 0xb0, 0xcf, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x3a, 0x29, 0x50, 0x63, 0xf1, 0xf4, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x63, 0xf1, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xc8, 0xff, 0x63, 0xf1, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xf1, 0xf7, 0x32, 0x29, 0x50, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x53, 0x2e, 0x88, 0x6c, 0x12, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x32, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xf1, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xe8, 0xff, 0x31, 0xc8, 0xff, 0x63, 0xf1, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x64, 0x12, 0xff, 0x53, 0x2e, 0x8b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2c, 0x5b, 0xb0, 0xc8, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xf1, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x63, 0xf1, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x5b, 0x90, 0xc8, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x17, 0x21, 0x86, 0x3f, 0x5b, 0x8f, 0xc8, 0x63, 0xf1, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xf1, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x63, 0xf1, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x6c, 0x12, 0xff, 0x63, 0xf1, 0xff, 0x5b, 0x8f, 0xc8, 0x21, 0x66, 0x3f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2f, 0x3a, 0x4a, 0x5c, 0x4a, 0xcc, 0x87, 0x4a, 0xcc, 0x8b, 0x4a, 0xcc, 0x8b, 0x4a, 0xcc, 0x8b, 0x4a, 0xcc, 0x8b, 0x42, 0xac, 0x90, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x29, 0xc8, 0xff, 0x42, 0xac, 0x90, 0x4a, 0xcc, 0x8b, 0x4a, 0xcc, 0x8b, 0x4a, 0xcc, 0x8b, 0x4a, 0xcc, 0x8b, 0x42, 0xcc, 0x87, 0x3a, 0x2a, 0x5c, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x13, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x23, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x2c, 0x29, 0xa7, 0xe0, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x29, 0xa7, 0xe0, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x10, 0x21, 0x66, 0x7b, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x31, 0xc8, 0xff, 0x29, 0xc8, 0xff, 0x21, 0x66, 0x78, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1b, 0x21, 0x66, 0x90, 0x29, 0xa7, 0xfb, 0x29, 0xc8, 0xff, 0x29, 0xc8, 0xff, 0x29, 0xa7, 0xfb, 0x21, 0x66, 0x93, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x10, 0xa3, 0x40, 0x19, 0x05, 0x74, 0x19, 0x05, 0x74, 0x10, 0xa3, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xce, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x6b, 0xf0, 0x1c, 0x8c, 0xf4, 0x63, 0x86, 0x8c, 
+  0xf4, 0x6c, 0x03, 0x8c, 0xf4, 0x6b, 0x7c, 0x73, 0x34, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x7c, 0x73, 0x34, 0x8c, 0xd4, 0x6b, 
+  0x84, 0x8c, 0xd4, 0x6c, 0x04, 0x84, 0xd4, 0x6c, 0x8c, 0xd4, 0x6c, 0x8c, 0xd4, 0x63, 0x6b, 0xd0, 0x1c, 0x00, 0x00, 0x07, 0x9a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x6b, 0xd0, 0x1f, 0x84, 
+  0xd4, 0xe3, 0x7c, 0xb4, 0xff, 0x87, 0x7c, 0x94, 0xff, 0x02, 0x84, 0xb4, 0xfb, 0x84, 0x93, 0x58, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0x7c, 0x93, 0x57, 0x7c, 0xb4, 
+  0xfb, 0x88, 0x7c, 0x93, 0xff, 0x02, 0x84, 0xb4, 0xe3, 0x63, 0xaf, 0x1f, 0x00, 0x00, 0x04, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x74, 0x52, 0x63, 0x88, 0x7c, 0x94, 0xff, 0x81, 0x7c, 
+  0x93, 0xff, 0x02, 0x7c, 0x73, 0xb0, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x74, 0x73, 0xb0, 0x86, 0x7c, 0x93, 0xff, 0x00, 0x74, 
+  0x93, 0xff, 0x82, 0x74, 0x73, 0xff, 0x01, 0x74, 0x32, 0x63, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x74, 0x32, 0x6c, 0x7c, 0xb4, 0xff, 0x89, 0x7c, 0x94, 0xff, 0x02, 
+  0x74, 0x73, 0xb7, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x74, 0x53, 0xb7, 0x86, 0x7c, 0x93, 0xff, 0x83, 0x7c, 0x73, 0xff, 0x01, 
+  0x6b, 0xf1, 0x6c, 0x00, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x6c, 0x12, 0x6f, 0x8a, 0x7c, 0x94, 0xff, 0x02, 0x74, 0x53, 0xb8, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x85, 
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x74, 0x52, 0xb8, 0x82, 0x7c, 0x93, 0xff, 0x00, 0x7c, 0x73, 0xff, 0x82, 0x7c, 0x93, 0xff, 0x82, 0x7c, 0x73, 0xff, 0x02, 0x74, 0x73, 
+  0xff, 0x6b, 0xf1, 0x6f, 0x00, 0x00, 0x0c, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0b, 0x6b, 0xf1, 0x6b, 0x83, 0x7c, 0x94, 0xff, 0x00, 0x7c, 0x93, 0xff, 0x82, 0x7c, 0x94, 0xff, 0x82, 0x7c, 
+  0x93, 0xff, 0x02, 0x74, 0x52, 0xb4, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0x74, 0x32, 0xb4, 0x82, 0x7c, 0x93, 0xff, 0x00, 0x7c, 
+  0x73, 0xff, 0x81, 0x7c, 0x93, 0xff, 0x00, 0x7c, 0x73, 0xff, 0x83, 0x74, 0x73, 0xff, 0x01, 0x63, 0xd0, 0x68, 0x00, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x42, 0x6a, 0x2c, 
+  0x74, 0x52, 0xe7, 0x86, 0x7c, 0x94, 0xff, 0x81, 0x7c, 0x93, 0xff, 0x03, 0x7c, 0x73, 0xfc, 0x63, 0x8f, 0x64, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x0f, 0x5b, 0x8f, 0x64, 0x74, 0x73, 0xfc, 0x85, 0x7c, 0x93, 0xff, 0x82, 0x74, 0x73, 0xff, 0x02, 0x74, 0x32, 0xe7, 0x3a, 0x4a, 0x2c, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x3a, 0x29, 0x37, 0x5b, 0x4e, 0x78, 0x82, 0x5b, 0x4e, 0x84, 0x01, 0x5b, 0x4e, 0x88, 0x53, 0x2d, 0xdb, 0x81, 0x53, 0x2d, 0xff, 0x03, 0x5b, 0x4e, 0x87, 0x4a, 
+  0xac, 0x50, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x87, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1b, 0x4a, 0xab, 0x50, 0x53, 0x2e, 0x87, 0x81, 0x53, 0x0d, 0xff, 0x01, 0x53, 0x0d, 
+  0xd8, 0x53, 0x2e, 0x88, 0x82, 0x53, 0x4e, 0x84, 0x03, 0x53, 0x2e, 0x78, 0x3a, 0x09, 0x37, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x99, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x1f, 0x81, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x30, 0x42, 0x6a, 0xbf, 0x81, 0x4a, 0x8b, 0xff, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x1c, 0x00, 
+  0x00, 0x0f, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x30, 0x81, 0x42, 0x6a, 0xff, 0x02, 0x42, 0x49, 0xbf, 0x00, 0x00, 
+  0x30, 0x00, 0x00, 0x24, 0x81, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x93, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 
+  0x84, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x00, 0x27, 0x32, 0x49, 0xbc, 0x81, 0x3a, 0x6a, 0xff, 
+  0x03, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x87, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x2b, 0x81, 0x3a, 
+  0x4a, 0xff, 0x03, 0x2a, 0x29, 0xbc, 0x00, 0x00, 0x27, 0x00, 0x00, 0x18, 0x00, 0x00, 0x17, 0x81, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x0b, 0x01, 0x00, 
+  0x00, 0x04, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0xf2, 0x8e, 0x68, 0xfa, 0x6d, 0xd8, 0x96, 0xfa, 0x4d, 0xff, 0x92, 0xfa, 0x2d, 0xff, 0x81, 0xfa, 
+  0x0d, 0xff, 0x03, 0xfa, 0x2d, 0xd8, 0xf2, 0x4d, 0x68, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0xf2, 0x6d, 0x80, 0xfa, 0x0c, 0xff, 0xf9, 0xec, 0xff, 
+  0x91, 0xf9, 0xcc, 0xff, 0x00, 0xf9, 0xac, 0xff, 0x82, 0xf9, 0xcc, 0xff, 0x83, 0xf9, 0xac, 0xff, 0x8a, 0xf9, 0xab, 0xff, 0x87, 0xf9, 0x8b, 0xff, 0x02, 0xf9, 0xab, 0xff, 0xf2, 0x2c, 0x83, 0x00, 
+  0x00, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0xc1, 0xeb, 0x24, 0xfa, 0x0c, 0xf8, 0x92, 0xf9, 0xcc, 0xff, 0x81, 0xf9, 0xac, 0xff, 0x81, 0xf9, 0xcc, 0xff, 0x83, 0xf9, 0xac, 0xff, 
+  0x8a, 0xf9, 0xab, 0xff, 0x89, 0xf9, 0x8b, 0xff, 0x02, 0xf9, 0xab, 0xf8, 0xc1, 0xaa, 0x24, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xe9, 0xcb, 0x5f, 0x8f, 0xf9, 0xcc, 
+  0xff, 0x83, 0xf9, 0xac, 0xff, 0x00, 0xf9, 0xab, 0xff, 0x82, 0xf9, 0xac, 0xff, 0x8b, 0xf9, 0xab, 0xff, 0x8d, 0xf9, 0x8b, 0xff, 0x01, 0xe9, 0x8a, 0x5f, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x07, 0xe9, 0x8b, 0x6c, 0x83, 0xf9, 0xcc, 0xff, 0x02, 0xfd, 0x56, 0xff, 0xfd, 0x97, 0xff, 0xfa, 0x8e, 0xff, 0x87, 0xf9, 0xcc, 0xff, 0x88, 0xf9, 0xac, 0xff, 0x8b, 0xf9, 0xab, 
+  0xff, 0x86, 0xf9, 0x8b, 0xff, 0x02, 0xfa, 0x6d, 0xff, 0xfd, 0x76, 0xff, 0xfd, 0x35, 0xff, 0x83, 0xf9, 0x8b, 0xff, 0x01, 0xe9, 0x6a, 0x6b, 0x00, 0x00, 0x07, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x08, 0xe1, 0x8a, 0x6c, 0x82, 0xf9, 0xcc, 0xff, 0x06, 0xf9, 0xab, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x56, 0xff, 0xfa, 0x2d, 0xff, 0xf9, 0xcc, 0xff, 0x83, 
+  0xf9, 0xac, 0xff, 0x91, 0xf9, 0xab, 0xff, 0x88, 0xf9, 0x8b, 0xff, 0x05, 0xfa, 0x0c, 0xff, 0xfd, 0x56, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xf9, 0x4a, 0xff, 0x82, 0xf9, 
+  0x8b, 0xff, 0x01, 0xe1, 0x4a, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6f, 0x83, 0xf9, 0xcc, 0xff, 0x01, 0xfb, 0xb1, 0xff, 0xfe, 0x7a, 0xff, 0x81, 
+  0xff, 0x7d, 0xff, 0x02, 0xff, 0x1c, 0xff, 0xfc, 0xf5, 0xff, 0xf9, 0xec, 0xff, 0x82, 0xf9, 0xac, 0xff, 0x94, 0xf9, 0xab, 0xff, 0x83, 0xf9, 0x8b, 0xff, 0x02, 0xf9, 0xcc, 0xff, 0xfc, 0xf4, 0xff, 
+  0xff, 0x1c, 0xff, 0x81, 0xff, 0x7d, 0xff, 0x01, 0xfe, 0x7a, 0xff, 0xfb, 0xb0, 0xff, 0x83, 0xf9, 0x8b, 0xff, 0x01, 0xe1, 0x49, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0xe1, 0x8a, 0x6f, 0x84, 0xf9, 0xcc, 0xff, 0x02, 0xf9, 0xac, 0xff, 0xfc, 0x32, 0xff, 0xfe, 0xbb, 0xff, 0x81, 0xff, 0x7d, 0xff, 0x01, 0xfe, 0xfb, 0xff, 0xfc, 0x94, 0xff, 0x95, 0xf9, 0xab, 
+  0xff, 0x83, 0xf9, 0x8b, 0xff, 0x06, 0xfc, 0x93, 0xff, 0xfe, 0xdb, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xfe, 0xbb, 0xff, 0xfc, 0x32, 0xff, 0xf9, 0x6b, 0xff, 0x83, 0xf9, 0x8b, 0xff, 0x02, 
+  0xf9, 0x6b, 0xff, 0xe1, 0x49, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6f, 0x87, 0xf9, 0xac, 0xff, 0x01, 0xfc, 0x94, 0xff, 0xfe, 0xfb, 0xff, 0x81, 
+  0xff, 0x7d, 0xff, 0x01, 0xfe, 0xbb, 0xff, 0xfc, 0x32, 0xff, 0x8f, 0xf9, 0xab, 0xff, 0x85, 0xf9, 0x8b, 0xff, 0x01, 0xfc, 0x32, 0xff, 0xfe, 0x9a, 0xff, 0x81, 0xff, 0x7d, 0xff, 0x01, 0xfe, 0xdb, 
+  0xff, 0xfc, 0x93, 0xff, 0x83, 0xf9, 0x8b, 0xff, 0x83, 0xf9, 0x6b, 0xff, 0x01, 0xe1, 0x49, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x8a, 0x6f, 0x88, 0xf9, 
+  0xac, 0xff, 0x02, 0xf9, 0xec, 0xff, 0xfc, 0xf5, 0xff, 0xff, 0x1c, 0xff, 0x81, 0xff, 0x7d, 0xff, 0x01, 0xfe, 0x7a, 0xff, 0xfb, 0xb1, 0xff, 0x8c, 0xf9, 0xab, 0xff, 0x84, 0xf9, 0x8b, 0xff, 0x06, 
+  0xfb, 0xb1, 0xff, 0xfe, 0x7a, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x1c, 0xff, 0xfc, 0xf5, 0xff, 0xf9, 0xcb, 0xff, 0x83, 0xf9, 0x8b, 0xff, 0x84, 0xf9, 0x6b, 0xff, 0x01, 0xe1, 0x49, 
+  0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0x81, 0xf9, 0xac, 0xff, 0x88, 0xf9, 0xab, 0xff, 0x02, 0xfa, 0x2c, 0xff, 0xfd, 0x56, 0xff, 0xff, 0x3c, 
+  0xff, 0x81, 0xff, 0x5d, 0xff, 0x01, 0xfe, 0x39, 0xff, 0xfb, 0x50, 0xff, 0x85, 0xf9, 0xab, 0xff, 0x87, 0xf9, 0x8b, 0xff, 0x06, 0xfb, 0x2f, 0xff, 0xfe, 0x39, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 
+  0xff, 0xff, 0x3c, 0xff, 0xfd, 0x56, 0xff, 0xfa, 0x0c, 0xff, 0x81, 0xf9, 0x8b, 0xff, 0x88, 0xf9, 0x6b, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0xe1, 0x6a, 0x6f, 0x8c, 0xf9, 0xab, 0xff, 0x06, 0xfa, 0x8d, 0xff, 0xfd, 0x97, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xfd, 0xf8, 0xff, 0xfa, 0xce, 0xff, 0x82, 0xf9, 
+  0xab, 0xff, 0x86, 0xf9, 0x8b, 0xff, 0x06, 0xfa, 0xce, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xfd, 0xb7, 0xff, 0xfa, 0x6d, 0xff, 0x82, 0xf9, 0x8b, 0xff, 
+  0x89, 0xf9, 0x6b, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0x8e, 0xf9, 0xab, 0xff, 0x01, 0xfa, 0xee, 0xff, 0xfd, 0xf8, 
+  0xff, 0x81, 0xff, 0x5d, 0xff, 0x02, 0xff, 0x3d, 0xff, 0xfd, 0x97, 0xff, 0xfa, 0x6d, 0xff, 0x85, 0xf9, 0x8b, 0xff, 0x02, 0xfa, 0x6d, 0xff, 0xfd, 0x97, 0xff, 0xff, 0x3c, 0xff, 0x81, 0xff, 0x5d, 
+  0xff, 0x01, 0xfd, 0xf8, 0xff, 0xfa, 0xce, 0xff, 0x83, 0xf9, 0x8b, 0xff, 0x8a, 0xf9, 0x6b, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 
+  0x6a, 0x6f, 0x8a, 0xf9, 0xab, 0xff, 0x00, 0xf9, 0x8b, 0xff, 0x84, 0xf9, 0xab, 0xff, 0x06, 0xfb, 0x4f, 0xff, 0xfe, 0x39, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0x56, 
+  0xff, 0xfa, 0x2c, 0xff, 0x81, 0xf9, 0x8b, 0xff, 0x06, 0xfa, 0x0c, 0xff, 0xfd, 0x56, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x5d, 0xff, 0xfe, 0x39, 0xff, 0xfb, 0x4f, 0xff, 0x81, 0xf9, 
+  0x8b, 0xff, 0x8e, 0xf9, 0x6b, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6f, 0x89, 0xf9, 0xab, 0xff, 0x00, 0xf9, 0x8b, 0xff, 
+  0x84, 0xf9, 0xab, 0xff, 0x82, 0xf9, 0x8b, 0xff, 0x01, 0xfb, 0xb1, 0xff, 0xfe, 0x7a, 0xff, 0x81, 0xff, 0x7d, 0xff, 0x03, 0xff, 0x1c, 0xff, 0xfc, 0xf5, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0x1c, 0xff, 
+  0x81, 0xff, 0x7d, 0xff, 0x01, 0xfe, 0x7a, 0xff, 0xfb, 0xb1, 0xff, 0x82, 0xf9, 0x8b, 0xff, 0x8f, 0xf9, 0x6b, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x08, 0xe1, 0x6a, 0x6c, 0x94, 0xf9, 0x8b, 0xff, 0x02, 0xfc, 0x32, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0x7d, 0xff, 0x81, 0xff, 0x5d, 0xff, 0x02, 0xff, 0x7d, 0xff, 0xfe, 0xba, 0xff, 0xfc, 0x32, 
+  0xff, 0x90, 0xf9, 0x6b, 0xff, 0x83, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6c, 0x96, 0xf9, 0x8b, 0xff, 0x00, 
+  0xfc, 0x93, 0xff, 0x81, 0xfe, 0xdb, 0xff, 0x02, 0xfc, 0x93, 0xff, 0xf9, 0x6b, 0xff, 0xf9, 0x8b, 0xff, 0x90, 0xf9, 0x6b, 0xff, 0x83, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 
+  0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x6a, 0x6c, 0x97, 0xf9, 0x8b, 0xff, 0x01, 0xf9, 0xab, 0xff, 0xf9, 0xcb, 0xff, 0x81, 0xf9, 0x8b, 0xff, 0x8c, 0xf9, 0x6b, 0xff, 0x00, 0xf9, 
+  0x6a, 0xff, 0x82, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x4a, 0x6c, 0x95, 0xf9, 0x8b, 0xff, 
+  0x8d, 0xf9, 0x6b, 0xff, 0x83, 0xf9, 0x6a, 0xff, 0x89, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x4a, 0x6c, 0x94, 0xf9, 
+  0x8b, 0xff, 0x8d, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x6a, 0xff, 0x89, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 0x4a, 0x6c, 
+  0x8d, 0xf9, 0x8b, 0xff, 0x8f, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x6a, 0xff, 0x8e, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x29, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe1, 
+  0x4a, 0x6c, 0x8b, 0xf9, 0x8b, 0xff, 0x90, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x6a, 0xff, 0x8f, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0xe1, 0x49, 0x6c, 0x88, 0xf9, 0x8b, 0xff, 0x92, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x6a, 0xff, 0x90, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x08, 0xe1, 0x49, 0x6c, 0x9a, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x6a, 0xff, 0x91, 0xf9, 0x4a, 0xff, 0x01, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x08, 0xe1, 0x49, 0x6c, 0x99, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x6a, 0xff, 0x91, 0xf9, 0x4a, 0xff, 0x02, 0xf9, 0x2a, 0xff, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x08, 0xe1, 0x49, 0x6c, 0x93, 0xf9, 0x6b, 0xff, 0x84, 0xf9, 0x6a, 0xff, 0x93, 0xf9, 0x4a, 0xff, 0x84, 0xf9, 0x2a, 0xff, 0x01, 0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x08, 0xe1, 0x29, 0x6c, 0x89, 0xf9, 0x6b, 0xff, 0x00, 0xf9, 0x6a, 0xff, 0x85, 0xf9, 0x6b, 0xff, 0x86, 0xf9, 0x6a, 0xff, 0x93, 0xf9, 0x4a, 0xff, 0x85, 0xf9, 0x2a, 0xff, 0x01, 
+  0xe1, 0x09, 0x6c, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xd1, 0x28, 0x57, 0x86, 0xf9, 0x6b, 0xff, 0x81, 0xf9, 0x6a, 0xff, 0x86, 0xf9, 0x6b, 0xff, 0x85, 0xf9, 0x6a, 
+  0xff, 0x94, 0xf9, 0x4a, 0xff, 0x86, 0xf9, 0x2a, 0xff, 0x01, 0xd0, 0xe8, 0x57, 0x00, 0x00, 0x07, 0x89, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x58, 0x43, 0x23, 0xf1, 0x6a, 0xe7, 0x8c, 0xf9, 
+  0x6a, 0xff, 0x96, 0xf9, 0x4a, 0xff, 0x8b, 0xf9, 0x2a, 0xff, 0x02, 0xf1, 0x29, 0xe7, 0x58, 0x43, 0x23, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x13, 0xb9, 
+  0x07, 0x5b, 0xf1, 0x6a, 0xf4, 0x89, 0xf9, 0x6a, 0xff, 0x97, 0xf9, 0x4a, 0xff, 0x8b, 0xf9, 0x2a, 0xff, 0x03, 0xf1, 0x29, 0xf3, 0xb8, 0xe7, 0x5b, 0x00, 0x00, 0x13, 0x00, 0x00, 0x03, 0x8a, 0x00, 
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1c, 0x88, 0xc5, 0x44, 0xd1, 0x29, 0xa3, 0xd9, 0x69, 0xd7, 0x84, 0xd2, 0x0b, 0xff, 0x82, 0xca, 0x0b, 0xff, 0x84, 0xd2, 0x0b, 0xff, 0x8c, 0xca, 
+  0x0b, 0xff, 0x8f, 0xc9, 0xeb, 0xff, 0x04, 0xd1, 0x49, 0xd7, 0xd1, 0x08, 0xa3, 0x88, 0xa5, 0x44, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x08, 0x8b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2b, 0x08, 0x82, 0x4c, 0x53, 0x2e, 0xdc, 0x9c, 0x5b, 0x6f, 0xff, 0x00, 0x5b, 0x6e, 0xff, 0x83, 0x5b, 0x4e, 0xff, 0x85, 0x53, 0x4e, 0xff, 0x05, 0x4b, 0x0d, 
+  0xdc, 0x08, 0x82, 0x4c, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 
+  0x23, 0x3a, 0x29, 0x60, 0x63, 0xd0, 0xfb, 0x86, 0x63, 0xf1, 0xff, 0x93, 0x63, 0xd1, 0xff, 0x8a, 0x63, 0xd0, 0xff, 0x05, 0x5b, 0xb0, 0xfb, 0x32, 0x29, 0x60, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0f, 
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x24, 0x53, 0x4e, 0x98, 0x98, 0x6c, 0x12, 0xff, 0x81, 0x6c, 0x11, 0xff, 0x83, 
+  0x6c, 0x12, 0xff, 0x86, 0x64, 0x11, 0xff, 0x03, 0x53, 0x4e, 0x98, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x92, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x10, 
+  0xa3, 0x33, 0x63, 0xd1, 0xd4, 0xa2, 0x6c, 0x32, 0xff, 0x04, 0x6c, 0x12, 0xff, 0x63, 0xd0, 0xd4, 0x10, 0xa3, 0x33, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x94, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x07, 0x00, 0x00, 0x18, 0x3a, 0x6a, 0x54, 0x6c, 0x12, 0xf8, 0xa1, 0x6c, 0x32, 0xff, 0x03, 0x64, 0x11, 0xf8, 0x3a, 0x4a, 0x57, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x95, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x53, 0x4e, 0x93, 0x9e, 0x6c, 0x32, 0xff, 0x82, 0x6c, 0x12, 0xff, 0x03, 0x53, 0x4e, 0x94, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+  0x03, 0x96, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x21, 0x30, 0x63, 0xd1, 0xd0, 0x9c, 0x6c, 0x32, 0xff, 0x82, 0x6c, 0x12, 0xff, 0x03, 0x63, 0xb0, 0xd0, 0x00, 0x21, 
+  0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x98, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x3a, 0x4a, 0x53, 0x6c, 0x11, 0xf7, 0x8a, 0x6c, 0x32, 0xff, 0x01, 0x6c, 0x12, 0xff, 
+  0x63, 0xb0, 0xff, 0x83, 0x5b, 0x8f, 0xff, 0x00, 0x63, 0xb0, 0xff, 0x8b, 0x6c, 0x12, 0xff, 0x03, 0x63, 0xf1, 0xf7, 0x3a, 0x4a, 0x53, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x99, 0x00, 0x00, 0x00, 
+  0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x53, 0x4e, 0x8f, 0x8a, 0x6c, 0x32, 0xff, 0x01, 0x53, 0x0d, 0xff, 0x32, 0x09, 0xff, 0x84, 0x31, 0xe8, 0xff, 0x00, 0x53, 0x0d, 0xff, 
+  0x8a, 0x6c, 0x12, 0xff, 0x03, 0x53, 0x2e, 0x8f, 0x00, 0x00, 0x23, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2f, 0x63, 
+  0xb0, 0xcc, 0x81, 0x6c, 0x32, 0xff, 0x81, 0x6c, 0x12, 0xff, 0x84, 0x6c, 0x32, 0xff, 0x00, 0x6c, 0x12, 0xff, 0x87, 0x31, 0xe8, 0xff, 0x00, 0x64, 0x12, 0xff, 0x88, 0x6c, 0x12, 0xff, 0x03, 0x5b, 
+  0xb0, 0xcf, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x18, 0x3a, 0x29, 0x50, 0x63, 0xf1, 0xf4, 0x87, 0x6c, 0x32, 0xff, 
+  0x01, 0x63, 0xf1, 0xff, 0x31, 0xc8, 0xff, 0x85, 0x31, 0xe8, 0xff, 0x01, 0x31, 0xc8, 0xff, 0x63, 0xf1, 0xff, 0x87, 0x6c, 0x12, 0xff, 0x03, 0x63, 0xf1, 0xf7, 0x32, 0x29, 0x50, 0x00, 0x00, 0x18, 
+  0x00, 0x00, 0x07, 0x9d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x23, 0x53, 0x2e, 0x88, 0x6c, 0x12, 0xff, 0x84, 0x6c, 0x32, 0xff, 0x81, 0x6c, 0x12, 0xff, 0x01, 
+  0x63, 0xf1, 0xff, 0x31, 0xc8, 0xff, 0x85, 0x31, 0xe8, 0xff, 0x01, 0x31, 0xc8, 0xff, 0x63, 0xf1, 0xff, 0x86, 0x6c, 0x12, 0xff, 0x04, 0x64, 0x12, 0xff, 0x53, 0x2e, 0x8b, 0x00, 0x00, 0x23, 0x00, 
+  0x00, 0x0b, 0x00, 0x00, 0x03, 0x9e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2c, 0x5b, 0xb0, 0xc8, 0x86, 0x6c, 0x12, 0xff, 0x00, 0x63, 0xf1, 0xff, 0x87, 0x31, 
+  0xc8, 0xff, 0x00, 0x63, 0xf1, 0xff, 0x86, 0x6c, 0x12, 0xff, 0x03, 0x5b, 0x90, 0xc8, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 
+  0x00, 0x17, 0x21, 0x86, 0x3f, 0x5b, 0x8f, 0xc8, 0x63, 0xf1, 0xff, 0x84, 0x6c, 0x12, 0xff, 0x00, 0x63, 0xf1, 0xff, 0x87, 0x31, 0xc8, 0xff, 0x00, 0x63, 0xf1, 0xff, 0x84, 0x6c, 0x12, 0xff, 0x04, 
+  0x63, 0xf1, 0xff, 0x5b, 0x8f, 0xc8, 0x21, 0x66, 0x3f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x07, 0xa2, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x2f, 0x3a, 0x4a, 0x5c, 
+  0x4a, 0xcc, 0x87, 0x83, 0x4a, 0xcc, 0x8b, 0x00, 0x42, 0xac, 0x90, 0x86, 0x31, 0xc8, 0xff, 0x01, 0x29, 0xc8, 0xff, 0x42, 0xac, 0x90, 0x83, 0x4a, 0xcc, 0x8b, 0x04, 0x42, 0xcc, 0x87, 0x3a, 0x2a, 
+  0x5c, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x13, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x23, 0x83, 0x00, 
+  0x00, 0x24, 0x01, 0x00, 0x00, 0x2c, 0x29, 0xa7, 0xe0, 0x85, 0x31, 0xc8, 0xff, 0x01, 0x29, 0xa7, 0xe0, 0x00, 0x00, 0x2c, 0x83, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 
+  0x00, 0x13, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x10, 0x21, 0x66, 
+  0x7b, 0x84, 0x31, 0xc8, 0xff, 0x02, 0x29, 0xc8, 0xff, 0x21, 0x66, 0x78, 0x00, 0x00, 0x10, 0x84, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xa9, 0x00, 0x00, 
+  0x00, 0x83, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1b, 0x21, 0x66, 0x90, 0x29, 0xa7, 0xfb, 0x81, 0x29, 0xc8, 0xff, 0x03, 0x29, 0xa7, 0xfb, 0x21, 0x66, 0x93, 0x00, 0x00, 0x1b, 
+  0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x20, 0x10, 0xa3, 0x40, 0x81, 0x19, 0x05, 0x74, 0x02, 0x10, 0xa3, 0x40, 0x00, 0x00, 0x20, 
+  0x00, 0x00, 0x08, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x14, 0x81, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xbb, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 
+  0x03, 0x9e, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0x7b, 0x6b, 0x1c, 0xa4, 0x9b, 0x88, 0x63, 0xa4, 0x9c, 0x88, 0x6c, 0xa4, 0x9c, 0x89, 0x6c, 0xa4, 0x9c, 0x89, 0x6c, 0xa4, 0x9b, 0x88, 0x6c, 0xa4, 0x9c, 0x88, 0x6c, 0xa4, 0x9c, 0x88, 0x6c, 0xa4, 0x9c, 0x88, 0x6c, 0xa4, 0x9b, 0x88, 0x6b, 0x97, 0x8e, 0x7c, 0x34, 0x01, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x08, 0x95, 0x8c, 0x7a, 0x34, 0xa3, 0x9a, 0x86, 0x6b, 0xa2, 0x99, 0x85, 0x6c, 0xa2, 0x99, 0x85, 0x6c, 0xa2, 0x99, 0x85, 0x6c, 0xa2, 0x99, 0x85, 0x6c, 0xa2, 0x99, 0x85, 0x6c, 0xa2, 0x98, 0x84, 0x6c, 0xa2, 0x99, 0x85, 0x6c, 0xa1, 0x98, 0x85, 0x63, 0x81, 0x79, 0x68, 0x1c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7f, 0x78, 0x68, 0x1f, 0xa4, 0x99, 0x83, 0xe3, 0x9f, 0x93, 0x7b, 0xff, 0x9e, 0x92, 0x7a, 0xff, 0x9e, 0x92, 0x7a, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9e, 0x92, 0x7a, 0xff, 0x9e, 0x92, 0x7a, 0xff, 0x9e, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0xa1, 0x95, 0x7e, 0xfb, 0x9b, 0x91, 0x7d, 0x58, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9a, 0x90, 0x7b, 0x57, 0x9f, 0x94, 0x7c, 0xfb, 0x9b, 0x90, 0x77, 0xff, 0x9b, 0x90, 0x77, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9b, 0x90, 0x76, 0xff, 0x9b, 0x90, 0x76, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0xa0, 0x95, 0x7e, 0xe3, 0x7c, 0x74, 0x63, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x93, 0x88, 0x73, 0x63, 0x9e, 0x92, 0x7a, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x99, 0x8d, 0x76, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x98, 0x8c, 0x74, 0xb0, 0x9b, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x74, 0xff, 0x99, 0x8e, 0x74, 0xff, 0x99, 0x8e, 0x74, 0xff, 0x99, 0x8e, 0x74, 0xff, 0x8f, 0x84, 0x6d, 0x63, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x8e, 0x83, 0x6d, 0x6c, 0x9f, 0x93, 0x7a, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x96, 0x8b, 0x73, 0xb7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x95, 0x8a, 0x72, 0xb7, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x77, 0xff, 0x9b, 0x8f, 0x77, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x89, 0x7e, 0x67, 0x6c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x8d, 0x81, 0x6b, 0x6f, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9e, 0x92, 0x78, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x95, 0x8a, 0x72, 0xb8, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x94, 0x89, 0x70, 0xb8, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x77, 0xff, 0x9b, 0x8f, 0x77, 0xff, 0x9a, 0x8e, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x74, 0xff, 0x87, 0x7d, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x87, 0x7d, 0x67, 0x6b, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x93, 0x88, 0x70, 0xb4, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x92, 0x86, 0x6e, 0xb4, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8e, 0x75, 0xff, 0x9a, 0x8e, 0x74, 0xff, 0x9a, 0x8e, 0x74, 0xff, 0x9a, 0x8e, 0x74, 0xff, 0x99, 0x8d, 0x73, 0xff, 0x82, 0x78, 0x62, 0x68, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x52, 0x4c, 0x3e, 0x2c, 0x94, 0x89, 0x72, 0xe7, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x97, 0x8c, 0x75, 0xfc, 0x7b, 0x71, 0x5d, 0x64, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x79, 0x70, 0x5b, 0x64, 0x96, 0x8b, 0x72, 0xfc, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8f, 0x75, 0xff, 0x9a, 0x8e, 0x74, 0xff, 0x9a, 0x8e, 0x74, 0xff, 0x9a, 0x8e, 0x74, 0xff, 0x90, 0x85, 0x6d, 0xe7, 0x4e, 0x48, 0x3a, 0x2c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x49, 0x43, 0x37, 0x37, 0x71, 0x69, 0x56, 0x78, 0x73, 0x6a, 0x57, 0x84, 0x72, 0x6a, 0x57, 0x84, 0x72, 0x69, 0x56, 0x84, 0x71, 0x68, 0x55, 0x88, 0x6c, 0x64, 0x54, 0xdb, 0x6b, 0x63, 0x54, 0xff, 0x6b, 0x63, 0x54, 0xff, 0x6f, 0x68, 0x55, 0x87, 0x5e, 0x56, 0x47, 0x50, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x5c, 0x55, 0x45, 0x50, 0x6e, 0x66, 0x52, 0x87, 0x69, 0x61, 0x52, 0xff, 0x68, 0x61, 0x51, 0xff, 0x68, 0x61, 0x51, 0xd8, 0x6e, 0x66, 0x53, 0x88, 0x70, 0x67, 0x53, 0x84, 0x70, 0x67, 0x53, 0x84, 0x70, 0x67, 0x53, 0x84, 0x6e, 0x65, 0x52, 0x78, 0x48, 0x42, 0x35, 0x37, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x30, 0x50, 0x4b, 0x41, 0xbf, 0x55, 0x50, 0x46, 0xff, 0x55, 0x50, 0x46, 0xff, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x52, 0x4d, 0x42, 0xff, 0x52, 0x4c, 0x42, 0xff, 0x4c, 0x47, 0x3d, 0xbf, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x27, 0x4b, 0x48, 0x32, 0xbc, 0x51, 0x4e, 0x3b, 0xff, 0x52, 0x4e, 0x3c, 0xff, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2b, 0x4f, 0x4a, 0x37, 0xff, 0x4e, 0x4a, 0x36, 0xff, 0x48, 0x44, 0x2c, 0xbc, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x6f, 0x50, 0xf1, 0x68, 0x6c, 0x4b, 0xfc, 0xd8, 0x6c, 0x4a, 0xfe, 0xff, 0x6c, 0x4a, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6c, 0x4a, 0xff, 0xff, 0x6c, 0x4a, 0xff, 0xff, 0x6c, 0x4a, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x49, 0xff, 0xff, 0x6b, 0x49, 0xff, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x48, 0xff, 0xff, 0x6b, 0x48, 0xff, 0xff, 0x6b, 0x48, 0xff, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0x6a, 0x47, 0xfe, 0xff, 0x6a, 0x47, 0xff, 0xff, 0x6a, 0x47, 0xff, 0xff, 0x6a, 0x47, 0xfe, 0xff, 0x6a, 0x47, 0xfe, 0xff, 0x6a, 0x47, 0xff, 0xff, 0x6a, 0x47, 0xff, 0xff, 0x69, 0x47, 0xfe, 0xff, 0x69, 0x46, 0xfe, 0xff, 0x69, 0x46, 0xff, 0xff, 0x69, 0x46, 0xff, 0xff, 0x69, 0x46, 0xfe, 0xff, 0x68, 0x45, 0xff, 0xff, 0x68, 0x45, 0xff, 0xff, 0x69, 0x45, 0xff, 0xff, 0x68, 0x45, 0xff, 0xff, 0x69, 0x44, 0xff, 0xff, 0x68, 0x45, 0xff, 0xff, 0x68, 0x45, 0xfe, 0xff, 0x67, 0x44, 0xfe, 0xff, 0x67, 0x44, 0xff, 0xff, 0x67, 0x44, 0xff, 0xff, 0x67, 0x44, 0xfe, 0xff, 0x66, 0x43, 0xff, 0xff, 0x66, 0x43, 0xff, 0xff, 0x66, 0x43, 0xff, 0xff, 0x66, 0x43, 0xfe, 0xff, 0x66, 0x42, 0xff, 0xff, 0x66, 0x42, 0xfe, 0xff, 0x66, 0x43, 0xfc, 0xd8, 0x69, 0x49, 0xf0, 0x68, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6b, 0x4b, 0xf4, 0x80, 0x63, 0x3f, 0xff, 0xff, 0x60, 0x3b, 0xff, 0xff, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x3a, 0xff, 0xff, 0x60, 0x3a, 0xff, 0xff, 0x60, 0x3a, 0xff, 0xff, 0x60, 0x39, 0xfe, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xfe, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x64, 0x43, 0xf4, 0x83, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x56, 0x3c, 0xc2, 0x24, 0x63, 0x3f, 0xfe, 0xf8, 0x60, 0x3a, 0xfd, 0xff, 0x60, 0x3a, 0xfd, 0xff, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x3a, 0xfe, 0xff, 0x60, 0x39, 0xfd, 0xff, 0x60, 0x39, 0xfe, 0xff, 0x60, 0x39, 0xfe, 0xff, 0x60, 0x39, 0xfe, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xfd, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5e, 0x37, 0xfd, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfd, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x34, 0xfe, 0xff, 0x5c, 0x34, 0xfe, 0xff, 0x5b, 0x33, 0xfd, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xf8, 0x51, 0x36, 0xc2, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x38, 0xe6, 0x5f, 0x5f, 0x39, 0xfe, 0xff, 0x5f, 0x39, 0xfe, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x58, 0x31, 0xff, 0xff, 0x58, 0x31, 0xff, 0xff, 0x58, 0x31, 0xff, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x53, 0x30, 0xe6, 0x5f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x55, 0x32, 0xe5, 0x6c, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0x60, 0x39, 0xff, 0xff, 0xaf, 0xa7, 0xfd, 0xff, 0xb5, 0xaf, 0xfc, 0xff, 0x6e, 0x52, 0xfe, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5e, 0x37, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x68, 0x4e, 0xfe, 0xff, 0xb4, 0xae, 0xfd, 0xff, 0xac, 0xa5, 0xfd, 0xff, 0x58, 0x31, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x4e, 0x2b, 0xe5, 0x6b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x31, 0xe3, 0x6c, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5c, 0x33, 0xfe, 0xff, 0xe3, 0xe4, 0xfa, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xe4, 0xe4, 0xfb, 0xff, 0xb0, 0xa8, 0xfd, 0xff, 0x67, 0x46, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x62, 0x42, 0xfe, 0xff, 0xae, 0xa7, 0xfc, 0xff, 0xe3, 0xe4, 0xfa, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0xe3, 0xe4, 0xfb, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x4d, 0x29, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x30, 0xe3, 0x6f, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x87, 0x75, 0xfe, 0xff, 0xd0, 0xcd, 0xfc, 0xff, 0xeb, 0xec, 0xfb, 0xff, 0xeb, 0xec, 0xfb, 0xff, 0xe0, 0xe0, 0xfb, 0xff, 0xa7, 0x9e, 0xfd, 0xff, 0x61, 0x3d, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5d, 0x38, 0xff, 0xff, 0xa4, 0x9b, 0xfd, 0xff, 0xe0, 0xdf, 0xfb, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xcf, 0xcc, 0xfc, 0xff, 0x84, 0x73, 0xfe, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x58, 0x2f, 0xff, 0xff, 0x58, 0x2f, 0xff, 0xff, 0x58, 0x2f, 0xff, 0xff, 0x4c, 0x28, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x52, 0x30, 0xe2, 0x6f, 0x5e, 0x37, 0xfd, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x93, 0x86, 0xfd, 0xff, 0xd5, 0xd4, 0xfa, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xdc, 0xdb, 0xfb, 0xff, 0x9d, 0x92, 0xfd, 0xff, 0x5c, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x30, 0xfe, 0xff, 0x9a, 0x8f, 0xfc, 0xff, 0xda, 0xd9, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xd5, 0xd4, 0xfb, 0xff, 0x91, 0x85, 0xfd, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x4c, 0x27, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x2f, 0xe2, 0x6f, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x5d, 0x35, 0xfe, 0xff, 0x5d, 0x34, 0xff, 0xff, 0x9d, 0x92, 0xfe, 0xff, 0xdb, 0xdb, 0xfb, 0xff, 0xea, 0xec, 0xfb, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xd5, 0xd3, 0xfb, 0xff, 0x93, 0x85, 0xfe, 0xff, 0x5b, 0x33, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x30, 0xff, 0xff, 0x90, 0x83, 0xfe, 0xff, 0xd4, 0xd2, 0xfb, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xdb, 0xda, 0xfb, 0xff, 0x9c, 0x91, 0xfd, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x4b, 0x27, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x53, 0x2f, 0xe2, 0x6f, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xff, 0xff, 0x5e, 0x36, 0xfe, 0xff, 0x5d, 0x35, 0xfe, 0xff, 0x5d, 0x35, 0xfe, 0xff, 0x5d, 0x35, 0xff, 0xff, 0x5d, 0x35, 0xff, 0xff, 0x5d, 0x35, 0xff, 0xff, 0x61, 0x3c, 0xff, 0xff, 0xa6, 0x9d, 0xfc, 0xff, 0xe0, 0xe0, 0xfb, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xcf, 0xcc, 0xfc, 0xff, 0x87, 0x76, 0xfd, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x85, 0x74, 0xfe, 0xff, 0xce, 0xcb, 0xfc, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe0, 0xe0, 0xfb, 0xff, 0xa6, 0x9d, 0xfd, 0xff, 0x5c, 0x38, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x4b, 0x27, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x52, 0x2e, 0xe2, 0x6f, 0x5d, 0x35, 0xfe, 0xff, 0x5d, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfd, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfd, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x64, 0x44, 0xfe, 0xff, 0xaf, 0xa7, 0xfd, 0xff, 0xe3, 0xe3, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xc7, 0xc4, 0xfc, 0xff, 0x7d, 0x68, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x7a, 0x66, 0xfd, 0xff, 0xc6, 0xc3, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0xe3, 0xe3, 0xfa, 0xff, 0xae, 0xa7, 0xfc, 0xff, 0x61, 0x41, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x4b, 0x26, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x51, 0x2e, 0xe2, 0x6f, 0x5c, 0x35, 0xfe, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x6b, 0x4f, 0xfe, 0xff, 0xb7, 0xb2, 0xfc, 0xff, 0xe6, 0xe7, 0xfb, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xe8, 0xe9, 0xfb, 0xff, 0xc0, 0xbb, 0xfc, 0xff, 0x72, 0x5a, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x70, 0x58, 0xff, 0xff, 0xbf, 0xbb, 0xfc, 0xff, 0xe7, 0xe8, 0xfa, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xe5, 0xe7, 0xfb, 0xff, 0xb8, 0xb3, 0xfd, 0xff, 0x68, 0x4e, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x4b, 0x26, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x51, 0x2d, 0xe2, 0x6f, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xff, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x72, 0x5b, 0xfe, 0xff, 0xc0, 0xbc, 0xfc, 0xff, 0xe8, 0xe8, 0xfa, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe5, 0xe6, 0xfb, 0xff, 0xb7, 0xb1, 0xfc, 0xff, 0x6a, 0x4e, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x68, 0x4c, 0xfe, 0xff, 0xb6, 0xb0, 0xfc, 0xff, 0xe4, 0xe6, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe7, 0xe9, 0xfa, 0xff, 0xc0, 0xbc, 0xfc, 0xff, 0x71, 0x5a, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x4a, 0x26, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x50, 0x2d, 0xe3, 0x6f, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xff, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x7b, 0x67, 0xfe, 0xff, 0xc6, 0xc4, 0xfc, 0xff, 0xe8, 0xea, 0xfb, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xe3, 0xe4, 0xfb, 0xff, 0xae, 0xa8, 0xfc, 0xff, 0x62, 0x43, 0xff, 0xff, 0x58, 0x31, 0xff, 0xff, 0x58, 0x31, 0xff, 0xff, 0x61, 0x41, 0xfe, 0xff, 0xad, 0xa7, 0xfd, 0xff, 0xe3, 0xe4, 0xfb, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xe8, 0xea, 0xfa, 0xff, 0xc6, 0xc4, 0xfc, 0xff, 0x7b, 0x68, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x55, 0x2b, 0xfe, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x4a, 0x25, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x50, 0x2d, 0xe2, 0x6f, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xff, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xff, 0xff, 0x59, 0x32, 0xff, 0xff, 0x86, 0x76, 0xfe, 0xff, 0xcd, 0xcc, 0xfc, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xdf, 0xe0, 0xfb, 0xff, 0xa5, 0x9d, 0xfd, 0xff, 0xa4, 0x9c, 0xfd, 0xff, 0xdf, 0xdf, 0xfb, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xce, 0xcc, 0xfc, 0xff, 0x86, 0x76, 0xfd, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x4a, 0x25, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4e, 0x2b, 0xe2, 0x6c, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfd, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x90, 0x83, 0xfd, 0xff, 0xd3, 0xd2, 0xfb, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0xe8, 0xea, 0xfa, 0xff, 0xe8, 0xea, 0xfa, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0xd4, 0xd3, 0xfb, 0xff, 0x91, 0x84, 0xfd, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2b, 0xfe, 0xff, 0x55, 0x2b, 0xfe, 0xff, 0x55, 0x2b, 0xfe, 0xff, 0x55, 0x2b, 0xfe, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x49, 0x24, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x2b, 0xe3, 0x6c, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x2f, 0xff, 0xff, 0x9a, 0x8f, 0xfd, 0xff, 0xd9, 0xd9, 0xfb, 0xff, 0xda, 0xda, 0xfc, 0xff, 0x9b, 0x90, 0xfe, 0xff, 0x58, 0x2e, 0xff, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x49, 0x24, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x2b, 0xe3, 0x6c, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xff, 0xff, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x5c, 0x36, 0xff, 0xff, 0x5c, 0x37, 0xff, 0xff, 0x58, 0x2f, 0xff, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x55, 0x2b, 0xff, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xfe, 0xff, 0x49, 0x23, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4e, 0x2a, 0xe3, 0x6c, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x48, 0x24, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4e, 0x2a, 0xe3, 0x6c, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x54, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x48, 0x24, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4d, 0x2a, 0xe3, 0x6c, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xfe, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xfe, 0xff, 0x52, 0x28, 0xfe, 0xff, 0x52, 0x28, 0xff, 0xff, 0x48, 0x23, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4d, 0x29, 0xe3, 0x6c, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xff, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x48, 0x22, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x28, 0xe2, 0x6c, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x57, 0x2f, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x29, 0xfe, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xfe, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x47, 0x22, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x27, 0xe2, 0x6c, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xfe, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x46, 0x21, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x27, 0xe3, 0x6c, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xff, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xff, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x56, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x53, 0x29, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x46, 0x21, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x27, 0xe2, 0x6c, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xfe, 0xff, 0x51, 0x27, 0xfe, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xfe, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xfe, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x46, 0x20, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4b, 0x26, 0xe2, 0x6c, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x54, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x51, 0x28, 0xfe, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x45, 0x20, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x44, 0x24, 0xcf, 0x57, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xff, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x54, 0x2c, 0xfe, 0xff, 0x54, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xff, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x51, 0x28, 0xfe, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x52, 0x28, 0xff, 0xff, 0x51, 0x27, 0xfe, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xfe, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x4f, 0x25, 0xfe, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x40, 0x1e, 0xcf, 0x57, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x08, 0x5c, 0x23, 0x51, 0x2b, 0xf4, 0xe7, 0x54, 0x2c, 0xff, 0xff, 0x54, 0x2c, 0xff, 0xff, 0x54, 0x2c, 0xfe, 0xff, 0x53, 0x2b, 0xfe, 0xff, 0x53, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x51, 0x28, 0xfe, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x50, 0x27, 0xfe, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x50, 0x26, 0xfe, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x4f, 0x25, 0xfe, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xfe, 0xff, 0x4e, 0x24, 0xff, 0xff, 0x4e, 0x24, 0xff, 0xff, 0x4b, 0x24, 0xf4, 0xe7, 0x17, 0x07, 0x5a, 0x23, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x3c, 0x21, 0xb5, 0x5b, 0x51, 0x2b, 0xf3, 0xf4, 0x53, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x54, 0x2b, 0xff, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x53, 0x2a, 0xff, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xff, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x51, 0x28, 0xff, 0xff, 0x50, 0x27, 0xfe, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x51, 0x27, 0xff, 0xff, 0x50, 0x26, 0xfe, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x50, 0x26, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x4e, 0x24, 0xff, 0xff, 0x4e, 0x24, 0xff, 0xff, 0x4c, 0x24, 0xf4, 0xf3, 0x39, 0x1b, 0xb6, 0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x2b, 0x17, 0x85, 0x44, 0x45, 0x26, 0xcf, 0xa3, 0x4c, 0x2e, 0xd5, 0xd7, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcc, 0xff, 0x59, 0x41, 0xcc, 0xff, 0x59, 0x41, 0xcc, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x59, 0x41, 0xcd, 0xff, 0x58, 0x40, 0xcc, 0xff, 0x58, 0x40, 0xcc, 0xff, 0x58, 0x40, 0xcc, 0xff, 0x58, 0x40, 0xcc, 0xff, 0x58, 0x40, 0xcc, 0xff, 0x58, 0x40, 0xcc, 0xff, 0x58, 0x40, 0xcc, 0xff, 0x57, 0x3f, 0xcc, 0xff, 0x57, 0x3f, 0xcc, 0xff, 0x57, 0x3f, 0xcc, 0xff, 0x57, 0x3f, 0xcc, 0xff, 0x57, 0x3f, 0xcc, 0xff, 0x57, 0x3f, 0xcc, 0xff, 0x57, 0x3e, 0xcc, 0xff, 0x57, 0x3e, 0xcc, 0xff, 0x57, 0x3e, 0xcc, 0xff, 0x57, 0x3e, 0xcc, 0xff, 0x57, 0x3e, 0xcc, 0xff, 0x56, 0x3d, 0xcb, 0xff, 0x56, 0x3d, 0xcc, 0xff, 0x56, 0x3d, 0xcc, 0xff, 0x56, 0x3d, 0xcc, 0xff, 0x56, 0x3d, 0xcc, 0xff, 0x55, 0x3d, 0xcb, 0xff, 0x55, 0x3d, 0xcc, 0xff, 0x55, 0x3d, 0xcc, 0xff, 0x55, 0x3d, 0xcc, 0xff, 0x55, 0x3d, 0xcc, 0xff, 0x55, 0x3c, 0xcb, 0xff, 0x48, 0x28, 0xd4, 0xd7, 0x41, 0x20, 0xce, 0xa3, 0x29, 0x13, 0x85, 0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2b, 0x11, 0x10, 0x0a, 0x4c, 0x6d, 0x63, 0x50, 0xdc, 0x77, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6c, 0x57, 0xff, 0x76, 0x6c, 0x56, 0xff, 0x75, 0x6b, 0x56, 0xff, 0x75, 0x6b, 0x56, 0xff, 0x75, 0x6c, 0x56, 0xff, 0x75, 0x6c, 0x56, 0xff, 0x75, 0x6c, 0x56, 0xff, 0x75, 0x6b, 0x56, 0xff, 0x75, 0x6b, 0x55, 0xff, 0x75, 0x6b, 0x55, 0xff, 0x75, 0x6b, 0x55, 0xff, 0x75, 0x6b, 0x55, 0xff, 0x75, 0x6b, 0x55, 0xff, 0x74, 0x6b, 0x55, 0xff, 0x74, 0x6a, 0x55, 0xff, 0x74, 0x6a, 0x55, 0xff, 0x74, 0x6a, 0x55, 0xff, 0x74, 0x6a, 0x55, 0xff, 0x74, 0x6a, 0x54, 0xff, 0x73, 0x6a, 0x54, 0xff, 0x73, 0x6a, 0x54, 0xff, 0x73, 0x6a, 0x54, 0xff, 0x73, 0x6a, 0x54, 0xff, 0x73, 0x69, 0x53, 0xff, 0x69, 0x60, 0x4c, 0xdc, 0x10, 0x0f, 0x09, 0x4c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x23, 0x4b, 0x45, 0x36, 0x60, 0x83, 0x78, 0x60, 0xfb, 0x86, 0x7b, 0x63, 0xff, 0x86, 0x7b, 0x63, 0xff, 0x86, 0x7b, 0x63, 0xff, 0x86, 0x7b, 0x63, 0xff, 0x86, 0x7b, 0x63, 0xff, 0x86, 0x7b, 0x63, 0xff, 0x86, 0x7b, 0x63, 0xff, 0x86, 0x7a, 0x62, 0xff, 0x85, 0x7a, 0x62, 0xff, 0x86, 0x7a, 0x62, 0xff, 0x86, 0x7a, 0x62, 0xff, 0x86, 0x7a, 0x62, 0xff, 0x86, 0x7a, 0x62, 0xff, 0x86, 0x7a, 0x62, 0xff, 0x86, 0x7a, 0x61, 0xff, 0x86, 0x79, 0x61, 0xff, 0x85, 0x79, 0x61, 0xff, 0x85, 0x7a, 0x62, 0xff, 0x85, 0x7a, 0x62, 0xff, 0x85, 0x7a, 0x62, 0xff, 0x85, 0x7a, 0x62, 0xff, 0x85, 0x79, 0x61, 0xff, 0x85, 0x79, 0x61, 0xff, 0x85, 0x79, 0x61, 0xff, 0x85, 0x79, 0x61, 0xff, 0x85, 0x79, 0x61, 0xff, 0x85, 0x79, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x5f, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x84, 0x78, 0x60, 0xff, 0x83, 0x77, 0x5f, 0xff, 0x80, 0x74, 0x5c, 0xfb, 0x4a, 0x43, 0x34, 0x60, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x24, 0x73, 0x69, 0x54, 0x98, 0x8e, 0x82, 0x68, 0xff, 0x8f, 0x82, 0x68, 0xff, 0x8f, 0x82, 0x68, 0xff, 0x8f, 0x82, 0x68, 0xff, 0x8f, 0x82, 0x68, 0xff, 0x8e, 0x82, 0x67, 0xff, 0x8e, 0x81, 0x67, 0xff, 0x8e, 0x82, 0x67, 0xff, 0x8e, 0x82, 0x67, 0xff, 0x8e, 0x82, 0x67, 0xff, 0x8e, 0x82, 0x67, 0xff, 0x8e, 0x82, 0x67, 0xff, 0x8e, 0x82, 0x67, 0xff, 0x8d, 0x82, 0x67, 0xff, 0x8d, 0x81, 0x66, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x8d, 0x80, 0x65, 0xff, 0x8d, 0x81, 0x66, 0xff, 0x8d, 0x81, 0x66, 0xff, 0x8d, 0x81, 0x66, 0xff, 0x8d, 0x81, 0x66, 0xff, 0x8c, 0x81, 0x66, 0xff, 0x8c, 0x80, 0x65, 0xff, 0x8d, 0x80, 0x65, 0xff, 0x8d, 0x80, 0x65, 0xff, 0x8d, 0x80, 0x65, 0xff, 0x8d, 0x80, 0x65, 0xff, 0x8c, 0x80, 0x64, 0xff, 0x8c, 0x80, 0x64, 0xff, 0x8c, 0x80, 0x64, 0xff, 0x8c, 0x80, 0x64, 0xff, 0x8c, 0x80, 0x64, 0xff, 0x8b, 0x7f, 0x64, 0xff, 0x8b, 0x7f, 0x64, 0xff, 0x71, 0x67, 0x51, 0x98, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x17, 0x14, 0x0d, 0x33, 0x85, 0x79, 0x61, 0xd4, 0x92, 0x84, 0x6a, 0xff, 0x92, 0x84, 0x6a, 0xff, 0x92, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x66, 0xff, 0x8f, 0x83, 0x66, 0xff, 0x8f, 0x83, 0x66, 0xff, 0x8f, 0x83, 0x66, 0xff, 0x8f, 0x83, 0x66, 0xff, 0x8f, 0x83, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x83, 0x77, 0x5d, 0xd4, 0x17, 0x13, 0x0d, 0x33, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x53, 0x4b, 0x3b, 0x54, 0x8e, 0x81, 0x67, 0xf8, 0x92, 0x84, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x8f, 0x83, 0x66, 0xff, 0x90, 0x83, 0x67, 0xff, 0x8c, 0x7f, 0x64, 0xf8, 0x51, 0x4a, 0x39, 0x57, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x23, 0x74, 0x69, 0x54, 0x93, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x72, 0x67, 0x51, 0x94, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x05, 0x04, 0x03, 0x30, 0x85, 0x79, 0x60, 0xd0, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x85, 0x6a, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x92, 0x84, 0x69, 0xff, 0x91, 0x84, 0x68, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x84, 0x69, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x83, 0x76, 0x5d, 0xd0, 0x08, 0x06, 0x04, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x4f, 0x48, 0x38, 0x53, 0x8c, 0x7f, 0x65, 0xf7, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x8f, 0x82, 0x67, 0xff, 0x81, 0x76, 0x5e, 0xff, 0x7c, 0x71, 0x5a, 0xff, 0x7c, 0x71, 0x5a, 0xff, 0x7c, 0x71, 0x5a, 0xff, 0x7c, 0x71, 0x59, 0xff, 0x81, 0x75, 0x5d, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8b, 0x7e, 0x63, 0xf7, 0x4e, 0x47, 0x37, 0x53, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x23, 0x71, 0x67, 0x51, 0x8f, 0x90, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x68, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x6b, 0x62, 0x4e, 0xff, 0x45, 0x3f, 0x33, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x44, 0x3e, 0x33, 0xff, 0x6a, 0x61, 0x4d, 0xff, 0x90, 0x82, 0x67, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8e, 0x82, 0x66, 0xff, 0x70, 0x65, 0x50, 0x8f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2f, 0x83, 0x76, 0x5e, 0xcc, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x82, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x90, 0x83, 0x68, 0xff, 0x8e, 0x81, 0x66, 0xff, 0x44, 0x3e, 0x32, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x42, 0x3c, 0x31, 0xff, 0x43, 0x3d, 0x31, 0xff, 0x8d, 0x80, 0x64, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x81, 0x75, 0x5c, 0xcf, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x4c, 0x45, 0x35, 0x50, 0x8b, 0x7e, 0x63, 0xf4, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x8b, 0x7e, 0x63, 0xff, 0x40, 0x3a, 0x2f, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x40, 0x3b, 0x2f, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x8a, 0x7e, 0x62, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8a, 0x7d, 0x62, 0xf7, 0x4b, 0x44, 0x34, 0x50, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x23, 0x6f, 0x64, 0x4f, 0x88, 0x8f, 0x82, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x83, 0x67, 0xff, 0x90, 0x82, 0x66, 0xff, 0x90, 0x82, 0x66, 0xff, 0x8a, 0x7d, 0x62, 0xff, 0x40, 0x3a, 0x2f, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x41, 0x3b, 0x30, 0xff, 0x40, 0x3b, 0x2f, 0xff, 0x40, 0x3b, 0x2f, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x89, 0x7d, 0x62, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x82, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8f, 0x81, 0x65, 0xff, 0x8e, 0x80, 0x64, 0xff, 0x6e, 0x63, 0x4d, 0x8b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x2c, 0x80, 0x74, 0x5b, 0xc8, 0x8f, 0x82, 0x67, 0xff, 0x8f, 0x82, 0x67, 0xff, 0x8f, 0x82, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x89, 0x7d, 0x62, 0xff, 0x3f, 0x39, 0x2e, 0xff, 0x40, 0x3a, 0x2f, 0xff, 0x40, 0x3a, 0x2f, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3e, 0x39, 0x2d, 0xff, 0x88, 0x7c, 0x61, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x7e, 0x72, 0x59, 0xc8, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x33, 0x2f, 0x23, 0x3f, 0x7c, 0x71, 0x59, 0xc8, 0x8a, 0x7d, 0x63, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x8f, 0x81, 0x66, 0xff, 0x89, 0x7d, 0x62, 0xff, 0x3e, 0x39, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3e, 0x39, 0x2d, 0xff, 0x88, 0x7c, 0x61, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x8e, 0x81, 0x65, 0xff, 0x89, 0x7d, 0x61, 0xff, 0x7b, 0x6f, 0x56, 0xc8, 0x33, 0x2d, 0x22, 0x3f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2f, 0x4e, 0x47, 0x37, 0x5c, 0x62, 0x59, 0x45, 0x87, 0x63, 0x5a, 0x46, 0x8b, 0x63, 0x5a, 0x46, 0x8b, 0x63, 0x5a, 0x46, 0x8b, 0x63, 0x5a, 0x46, 0x8b, 0x5e, 0x54, 0x41, 0x90, 0x3e, 0x39, 0x2d, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3e, 0x38, 0x2c, 0xff, 0x5d, 0x54, 0x40, 0x90, 0x62, 0x59, 0x45, 0x8b, 0x62, 0x59, 0x45, 0x8b, 0x62, 0x59, 0x45, 0x8b, 0x62, 0x5a, 0x45, 0x8b, 0x61, 0x58, 0x44, 0x87, 0x4d, 0x45, 0x35, 0x5c, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2c, 0x3b, 0x36, 0x2b, 0xe0, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3b, 0x35, 0x2a, 0xe0, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x30, 0x2b, 0x22, 0x7b, 0x3e, 0x39, 0x2d, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3f, 0x39, 0x2d, 0xff, 0x3e, 0x38, 0x2c, 0xff, 0x30, 0x2b, 0x21, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1b, 0x30, 0x2b, 0x21, 0x90, 0x3a, 0x35, 0x29, 0xfb, 0x3e, 0x38, 0x2c, 0xff, 0x3e, 0x38, 0x2c, 0xff, 0x3a, 0x35, 0x29, 0xfb, 0x30, 0x2b, 0x20, 0x93, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x18, 0x15, 0x0e, 0x40, 0x26, 0x22, 0x19, 0x74, 0x26, 0x22, 0x19, 0x74, 0x18, 0x15, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xce, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x83, 0x7b, 0x6b, 0x1c, 0xa4, 0x9b, 0x88, 0x63, 0xa4, 0x9c, 0x88, 0x6c, 0x81, 0xa4, 0x9c, 0x89, 0x6c, 0x00, 0xa4, 0x9b, 0x88, 0x6c, 0x82, 0xa4, 0x9c, 0x88, 
+  0x6c, 0x03, 0xa4, 0x9b, 0x88, 0x6b, 0x97, 0x8e, 0x7c, 0x34, 0x01, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x08, 
+  0x95, 0x8c, 0x7a, 0x34, 0xa3, 0x9a, 0x86, 0x6b, 0x84, 0xa2, 0x99, 0x85, 0x6c, 0x04, 0xa2, 0x98, 0x84, 0x6c, 0xa2, 0x99, 0x85, 0x6c, 0xa1, 0x98, 0x85, 0x63, 0x81, 0x79, 0x68, 0x1c, 0x00, 0x00, 
+  0x00, 0x07, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x7f, 0x78, 0x68, 0x1f, 0xa4, 0x99, 0x83, 0xe3, 0x9f, 0x93, 0x7b, 0xff, 0x81, 0x9e, 0x92, 0x7a, 0xff, 0x01, 0x9e, 0x92, 
+  0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x81, 0x9e, 0x92, 0x7a, 0xff, 0x04, 0x9e, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x79, 0xff, 0xa1, 0x95, 0x7e, 0xfb, 0x9b, 0x91, 0x7d, 0x58, 0x00, 0x00, 0x00, 0x07, 
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x9a, 0x90, 0x7b, 0x57, 0x9f, 0x94, 0x7c, 0xfb, 0x81, 0x9b, 0x90, 0x77, 0xff, 0x01, 0x9b, 0x8f, 0x76, 0xff, 0x9a, 0x8f, 0x76, 0xff, 
+  0x81, 0x9b, 0x90, 0x76, 0xff, 0x81, 0x9a, 0x8f, 0x75, 0xff, 0x03, 0x9a, 0x8f, 0x76, 0xff, 0xa0, 0x95, 0x7e, 0xe3, 0x7c, 0x74, 0x63, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x99, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0x00, 0x00, 0x00, 0x08, 0x93, 0x88, 0x73, 0x63, 0x9e, 0x92, 0x7a, 0xff, 0x9e, 0x92, 0x79, 0xff, 0x82, 0x9d, 0x91, 0x79, 0xff, 0x00, 0x9d, 0x91, 0x78, 0xff, 0x82, 0x9d, 0x91, 0x79, 0xff, 
+  0x81, 0x9c, 0x90, 0x78, 0xff, 0x02, 0x99, 0x8d, 0x76, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 
+  0x98, 0x8c, 0x74, 0xb0, 0x9b, 0x8f, 0x75, 0xff, 0x82, 0x9a, 0x8f, 0x76, 0xff, 0x82, 0x9a, 0x8f, 0x75, 0xff, 0x00, 0x9a, 0x8f, 0x74, 0xff, 0x82, 0x99, 0x8e, 0x74, 0xff, 0x01, 0x8f, 0x84, 0x6d, 
+  0x63, 0x00, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x8e, 0x83, 0x6d, 0x6c, 0x9f, 0x93, 0x7a, 0xff, 0x82, 0x9e, 0x92, 0x79, 0xff, 0x01, 0x9e, 0x92, 0x78, 
+  0xff, 0x9d, 0x91, 0x78, 0xff, 0x81, 0x9e, 0x92, 0x79, 0xff, 0x82, 0x9d, 0x91, 0x78, 0xff, 0x02, 0x96, 0x8b, 0x73, 0xb7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x95, 0x8a, 0x72, 0xb7, 0x9b, 0x8f, 0x76, 0xff, 0x81, 0x9b, 0x8f, 0x77, 0xff, 0x83, 0x9b, 0x8f, 0x76, 0xff, 0x83, 0x9a, 0x8e, 0x75, 
+  0xff, 0x01, 0x89, 0x7e, 0x67, 0x6c, 0x00, 0x00, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x8d, 0x81, 0x6b, 0x6f, 0x83, 0x9e, 0x92, 0x79, 0xff, 0x01, 0x9d, 0x91, 
+  0x78, 0xff, 0x9e, 0x92, 0x78, 0xff, 0x81, 0x9e, 0x92, 0x79, 0xff, 0x82, 0x9d, 0x91, 0x78, 0xff, 0x02, 0x95, 0x8a, 0x72, 0xb8, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x94, 0x89, 0x70, 0xb8, 0x9b, 0x8f, 0x76, 0xff, 0x81, 0x9b, 0x8f, 0x77, 0xff, 0x00, 0x9a, 0x8e, 0x76, 0xff, 0x82, 0x9b, 0x8f, 
+  0x76, 0xff, 0x82, 0x9a, 0x8e, 0x75, 0xff, 0x02, 0x9a, 0x8e, 0x74, 0xff, 0x87, 0x7d, 0x66, 0x6f, 0x00, 0x00, 0x00, 0x0c, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x87, 0x7d, 
+  0x67, 0x6b, 0x82, 0x9d, 0x91, 0x79, 0xff, 0x04, 0x9d, 0x91, 0x78, 0xff, 0x9c, 0x90, 0x78, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x9d, 0x91, 0x79, 0xff, 0x9d, 0x91, 0x78, 0xff, 0x82, 0x9c, 0x90, 0x78, 
+  0xff, 0x02, 0x93, 0x88, 0x70, 0xb4, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x92, 0x86, 0x6e, 0xb4, 
+  0x82, 0x9a, 0x8f, 0x76, 0xff, 0x00, 0x9a, 0x8e, 0x75, 0xff, 0x81, 0x9a, 0x8f, 0x75, 0xff, 0x00, 0x9a, 0x8e, 0x75, 0xff, 0x82, 0x9a, 0x8e, 0x74, 0xff, 0x02, 0x99, 0x8d, 0x73, 0xff, 0x82, 0x78, 
+  0x62, 0x68, 0x00, 0x00, 0x00, 0x0b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x52, 0x4c, 0x3e, 0x2c, 0x94, 0x89, 0x72, 0xe7, 0x85, 0x9d, 0x91, 0x79, 0xff, 0x00, 0x9d, 0x91, 
+  0x78, 0xff, 0x81, 0x9c, 0x90, 0x78, 0xff, 0x03, 0x97, 0x8c, 0x75, 0xfc, 0x7b, 0x71, 0x5d, 0x64, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x79, 0x70, 0x5b, 0x64, 0x96, 0x8b, 0x72, 0xfc, 0x81, 0x9a, 0x8f, 0x76, 0xff, 0x83, 0x9a, 0x8f, 0x75, 0xff, 0x82, 0x9a, 0x8e, 0x74, 0xff, 0x02, 0x90, 0x85, 
+  0x6d, 0xe7, 0x4e, 0x48, 0x3a, 0x2c, 0x00, 0x00, 0x00, 0x08, 0x99, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x49, 0x43, 0x37, 0x37, 0x71, 0x69, 0x56, 0x78, 
+  0x73, 0x6a, 0x57, 0x84, 0x72, 0x6a, 0x57, 0x84, 0x72, 0x69, 0x56, 0x84, 0x71, 0x68, 0x55, 0x88, 0x6c, 0x64, 0x54, 0xdb, 0x81, 0x6b, 0x63, 0x54, 0xff, 0x03, 0x6f, 0x68, 0x55, 0x87, 0x5e, 0x56, 
+  0x47, 0x50, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x87, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x5c, 0x55, 0x45, 0x50, 0x6e, 0x66, 0x52, 0x87, 
+  0x69, 0x61, 0x52, 0xff, 0x68, 0x61, 0x51, 0xff, 0x68, 0x61, 0x51, 0xd8, 0x6e, 0x66, 0x53, 0x88, 0x82, 0x70, 0x67, 0x53, 0x84, 0x03, 0x6e, 0x65, 0x52, 0x78, 0x48, 0x42, 0x35, 0x37, 0x00, 0x00, 
+  0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1f, 0x81, 0x00, 0x00, 0x00, 
+  0x23, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x30, 0x50, 0x4b, 0x41, 0xbf, 0x81, 0x55, 0x50, 0x46, 0xff, 0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0f, 
+  0x00, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x52, 0x4d, 0x42, 0xff, 0x52, 0x4c, 
+  0x42, 0xff, 0x4c, 0x47, 0x3d, 0xbf, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x24, 0x81, 0x00, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 
+  0x00, 0x00, 0x00, 0x03, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 
+  0x81, 0x00, 0x00, 0x00, 0x14, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x27, 0x4b, 0x48, 0x32, 0xbc, 0x51, 0x4e, 0x3b, 0xff, 0x52, 0x4e, 0x3c, 0xff, 0x00, 0x00, 
+  0x00, 0x2b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x87, 0x00, 0x00, 0x00, 0x0b, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x17, 
+  0x00, 0x00, 0x00, 0x2b, 0x4f, 0x4a, 0x37, 0xff, 0x4e, 0x4a, 0x36, 0xff, 0x48, 0x44, 0x2c, 0xbc, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x81, 0x00, 0x00, 0x00, 
+  0x14, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x6f, 0x50, 0xf1, 0x68, 0x6c, 0x4b, 0xfc, 0xd8, 0x81, 0x6c, 0x4a, 0xfe, 0xff, 0x00, 0x6b, 0x4a, 0xfe, 0xff, 0x81, 0x6c, 0x4a, 0xff, 0xff, 0x02, 0x6c, 0x4a, 
+  0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x81, 0x6b, 0x49, 0xff, 0xff, 0x00, 0x6b, 0x49, 0xfe, 0xff, 0x82, 0x6b, 0x48, 0xff, 0xff, 0x01, 0x6b, 0x48, 0xfe, 0xff, 0x6a, 0x47, 
+  0xfe, 0xff, 0x81, 0x6a, 0x47, 0xff, 0xff, 0x81, 0x6a, 0x47, 0xfe, 0xff, 0x81, 0x6a, 0x47, 0xff, 0xff, 0x01, 0x69, 0x47, 0xfe, 0xff, 0x69, 0x46, 0xfe, 0xff, 0x81, 0x69, 0x46, 0xff, 0xff, 0x00, 
+  0x69, 0x46, 0xfe, 0xff, 0x81, 0x68, 0x45, 0xff, 0xff, 0x05, 0x69, 0x45, 0xff, 0xff, 0x68, 0x45, 0xff, 0xff, 0x69, 0x44, 0xff, 0xff, 0x68, 0x45, 0xff, 0xff, 0x68, 0x45, 0xfe, 0xff, 0x67, 0x44, 
+  0xfe, 0xff, 0x81, 0x67, 0x44, 0xff, 0xff, 0x00, 0x67, 0x44, 0xfe, 0xff, 0x82, 0x66, 0x43, 0xff, 0xff, 0x06, 0x66, 0x43, 0xfe, 0xff, 0x66, 0x42, 0xff, 0xff, 0x66, 0x42, 0xfe, 0xff, 0x66, 0x43, 
+  0xfc, 0xd8, 0x69, 0x49, 0xf0, 0x68, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x6b, 0x4b, 0xf4, 0x80, 0x63, 0x3f, 0xff, 0xff, 
+  0x60, 0x3b, 0xff, 0xff, 0x81, 0x60, 0x3a, 0xfe, 0xff, 0x82, 0x60, 0x3a, 0xff, 0xff, 0x00, 0x60, 0x39, 0xfe, 0xff, 0x83, 0x60, 0x39, 0xff, 0xff, 0x00, 0x5f, 0x38, 0xfe, 0xff, 0x82, 0x5f, 0x38, 
+  0xff, 0xff, 0x00, 0x5e, 0x37, 0xfe, 0xff, 0x82, 0x5e, 0x37, 0xff, 0xff, 0x00, 0x5d, 0x36, 0xfe, 0xff, 0x82, 0x5e, 0x37, 0xff, 0xff, 0x00, 0x5d, 0x36, 0xfe, 0xff, 0x82, 0x5d, 0x36, 0xff, 0xff, 
+  0x00, 0x5c, 0x35, 0xfe, 0xff, 0x82, 0x5c, 0x35, 0xff, 0xff, 0x82, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x5c, 0x34, 0xfe, 0xff, 0x82, 0x5b, 0x33, 0xff, 0xff, 0x00, 0x5a, 0x32, 0xfe, 0xff, 0x82, 0x5a, 
+  0x32, 0xff, 0xff, 0x00, 0x59, 0x31, 0xfe, 0xff, 0x82, 0x59, 0x31, 0xff, 0xff, 0x02, 0x5c, 0x35, 0xff, 0xff, 0x64, 0x43, 0xf4, 0x83, 0x00, 0x00, 0x00, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0x00, 0x00, 0x03, 0x56, 0x3c, 0xc2, 0x24, 0x63, 0x3f, 0xfe, 0xf8, 0x81, 0x60, 0x3a, 0xfd, 0xff, 0x83, 0x60, 0x3a, 0xfe, 0xff, 0x00, 0x60, 0x39, 0xfd, 0xff, 0x82, 0x60, 0x39, 0xfe, 0xff, 
+  0x01, 0x5f, 0x38, 0xfe, 0xff, 0x5f, 0x38, 0xfd, 0xff, 0x82, 0x5f, 0x38, 0xfe, 0xff, 0x00, 0x5e, 0x37, 0xfd, 0xff, 0x82, 0x5e, 0x37, 0xfe, 0xff, 0x81, 0x5d, 0x36, 0xfe, 0xff, 0x81, 0x5e, 0x37, 
+  0xfe, 0xff, 0x83, 0x5d, 0x36, 0xfe, 0xff, 0x83, 0x5c, 0x35, 0xfe, 0xff, 0x01, 0x5b, 0x34, 0xfd, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x81, 0x5c, 0x34, 0xfe, 0xff, 0x00, 0x5b, 0x33, 0xfd, 0xff, 0x81, 
+  0x5b, 0x33, 0xfe, 0xff, 0x83, 0x5a, 0x32, 0xfe, 0xff, 0x83, 0x59, 0x31, 0xfe, 0xff, 0x04, 0x58, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xf8, 0x51, 0x36, 0xc2, 0x24, 0x00, 
+  0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x59, 0x38, 0xe6, 0x5f, 0x81, 0x5f, 0x39, 0xfe, 0xff, 0x83, 0x60, 0x39, 0xff, 0xff, 0x81, 0x5f, 0x38, 0xfe, 0xff, 
+  0x82, 0x5f, 0x38, 0xff, 0xff, 0x81, 0x5e, 0x37, 0xfe, 0xff, 0x81, 0x5e, 0x37, 0xff, 0xff, 0x01, 0x5e, 0x37, 0xfe, 0xff, 0x5d, 0x36, 0xfe, 0xff, 0x82, 0x5d, 0x36, 0xff, 0xff, 0x00, 0x5c, 0x35, 
+  0xfe, 0xff, 0x82, 0x5d, 0x36, 0xff, 0xff, 0x00, 0x5c, 0x35, 0xfe, 0xff, 0x82, 0x5c, 0x35, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5b, 0x34, 0xff, 0xff, 0x00, 0x5a, 0x33, 0xfe, 0xff, 
+  0x82, 0x5b, 0x33, 0xff, 0xff, 0x00, 0x5a, 0x32, 0xfe, 0xff, 0x81, 0x5a, 0x32, 0xff, 0xff, 0x00, 0x5a, 0x32, 0xfe, 0xff, 0x82, 0x59, 0x32, 0xff, 0xff, 0x00, 0x58, 0x31, 0xfe, 0xff, 0x82, 0x58, 
+  0x31, 0xff, 0xff, 0x00, 0x58, 0x30, 0xfe, 0xff, 0x81, 0x58, 0x30, 0xff, 0xff, 0x01, 0x53, 0x30, 0xe6, 0x5f, 0x00, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 
+  0x55, 0x32, 0xe5, 0x6c, 0x83, 0x60, 0x39, 0xff, 0xff, 0x02, 0xaf, 0xa7, 0xfd, 0xff, 0xb5, 0xaf, 0xfc, 0xff, 0x6e, 0x52, 0xfe, 0xff, 0x82, 0x5f, 0x38, 0xff, 0xff, 0x01, 0x5f, 0x38, 0xfe, 0xff, 
+  0x5e, 0x37, 0xfe, 0xff, 0x82, 0x5e, 0x37, 0xff, 0xff, 0x00, 0x5d, 0x36, 0xfe, 0xff, 0x82, 0x5d, 0x36, 0xff, 0xff, 0x81, 0x5d, 0x36, 0xfe, 0xff, 0x81, 0x5d, 0x36, 0xff, 0xff, 0x01, 0x5d, 0x36, 
+  0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x81, 0x5c, 0x35, 0xff, 0xff, 0x01, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x81, 0x5b, 0x34, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5b, 
+  0x33, 0xff, 0xff, 0x00, 0x5b, 0x33, 0xfe, 0xff, 0x82, 0x5a, 0x32, 0xff, 0xff, 0x00, 0x59, 0x32, 0xfe, 0xff, 0x82, 0x59, 0x32, 0xff, 0xff, 0x03, 0x68, 0x4e, 0xfe, 0xff, 0xb4, 0xae, 0xfd, 0xff, 
+  0xac, 0xa5, 0xfd, 0xff, 0x58, 0x31, 0xff, 0xff, 0x82, 0x58, 0x30, 0xff, 0xff, 0x01, 0x4e, 0x2b, 0xe5, 0x6b, 0x00, 0x00, 0x00, 0x07, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 
+  0x53, 0x31, 0xe3, 0x6c, 0x82, 0x5f, 0x38, 0xfe, 0xff, 0x06, 0x5c, 0x33, 0xfe, 0xff, 0xe3, 0xe4, 0xfa, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xe4, 0xe4, 0xfb, 0xff, 0xb0, 0xa8, 0xfd, 0xff, 0x67, 0x46, 
+  0xfe, 0xff, 0x5e, 0x37, 0xfe, 0xff, 0x83, 0x5d, 0x36, 0xfe, 0xff, 0x84, 0x5c, 0x35, 0xfe, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5c, 0x35, 0xfe, 0xff, 0x83, 0x5b, 0x34, 0xfe, 0xff, 0x84, 
+  0x5a, 0x33, 0xfe, 0xff, 0x82, 0x5a, 0x32, 0xfe, 0xff, 0x83, 0x59, 0x31, 0xfe, 0xff, 0x81, 0x58, 0x31, 0xfe, 0xff, 0x05, 0x62, 0x42, 0xfe, 0xff, 0xae, 0xa7, 0xfc, 0xff, 0xe3, 0xe4, 0xfa, 0xff, 
+  0xe9, 0xeb, 0xfa, 0xff, 0xe3, 0xe4, 0xfb, 0xff, 0x54, 0x2a, 0xfe, 0xff, 0x82, 0x57, 0x2f, 0xfe, 0xff, 0x01, 0x4d, 0x29, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x00, 0x08, 0x53, 0x30, 0xe3, 0x6f, 0x5f, 0x38, 0xff, 0xff, 0x5f, 0x38, 0xfe, 0xff, 0x81, 0x5e, 0x37, 0xfe, 0xff, 0x01, 0x87, 0x75, 0xfe, 0xff, 0xd0, 0xcd, 0xfc, 0xff, 0x81, 0xeb, 
+  0xec, 0xfb, 0xff, 0x02, 0xe0, 0xe0, 0xfb, 0xff, 0xa7, 0x9e, 0xfd, 0xff, 0x61, 0x3d, 0xff, 0xff, 0x81, 0x5d, 0x36, 0xff, 0xff, 0x01, 0x5d, 0x36, 0xfe, 0xff, 0x5c, 0x35, 0xfe, 0xff, 0x82, 0x5c, 
+  0x35, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5c, 0x35, 0xff, 0xff, 0x00, 0x5c, 0x35, 0xfe, 0xff, 0x82, 0x5b, 0x34, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x87, 0x5a, 0x33, 0xff, 
+  0xff, 0x82, 0x5a, 0x32, 0xff, 0xff, 0x08, 0x5a, 0x32, 0xfe, 0xff, 0x5d, 0x38, 0xff, 0xff, 0xa4, 0x9b, 0xfd, 0xff, 0xe0, 0xdf, 0xfb, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xcf, 
+  0xcc, 0xfc, 0xff, 0x84, 0x73, 0xfe, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x82, 0x58, 0x2f, 0xff, 0xff, 0x01, 0x4c, 0x28, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0x00, 0x00, 0x08, 0x52, 0x30, 0xe2, 0x6f, 0x5e, 0x37, 0xfd, 0xff, 0x83, 0x5e, 0x37, 0xfe, 0xff, 0x02, 0x5d, 0x36, 0xfe, 0xff, 0x93, 0x86, 0xfd, 0xff, 0xd5, 0xd4, 0xfa, 0xff, 0x81, 0xea, 0xeb, 
+  0xfa, 0xff, 0x03, 0xdc, 0xdb, 0xfb, 0xff, 0x9d, 0x92, 0xfd, 0xff, 0x5c, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5c, 0x35, 0xfe, 0xff, 0x81, 0x5b, 0x34, 0xfe, 0xff, 0x81, 0x5c, 0x35, 
+  0xfe, 0xff, 0x83, 0x5b, 0x34, 0xfe, 0xff, 0x88, 0x5a, 0x33, 0xfe, 0xff, 0x82, 0x5a, 0x32, 0xfe, 0xff, 0x07, 0x59, 0x30, 0xfe, 0xff, 0x9a, 0x8f, 0xfc, 0xff, 0xda, 0xd9, 0xfb, 0xff, 0xe9, 0xea, 
+  0xfa, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xd5, 0xd4, 0xfb, 0xff, 0x91, 0x85, 0xfd, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x81, 0x57, 0x2f, 0xfe, 0xff, 0x81, 0x58, 0x2f, 0xfe, 0xff, 0x02, 0x57, 0x2e, 0xfe, 
+  0xff, 0x4c, 0x27, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x53, 0x2f, 0xe2, 0x6f, 0x84, 0x5e, 0x36, 0xff, 0xff, 0x0a, 0x5d, 0x36, 0xfe, 
+  0xff, 0x5d, 0x35, 0xfe, 0xff, 0x5d, 0x34, 0xff, 0xff, 0x9d, 0x92, 0xfe, 0xff, 0xdb, 0xdb, 0xfb, 0xff, 0xea, 0xec, 0xfb, 0xff, 0xea, 0xeb, 0xfa, 0xff, 0xd5, 0xd3, 0xfb, 0xff, 0x93, 0x85, 0xfe, 
+  0xff, 0x5b, 0x33, 0xff, 0xff, 0x5c, 0x34, 0xff, 0xff, 0x81, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5b, 0x34, 0xff, 0xff, 0x00, 0x5a, 0x33, 
+  0xfe, 0xff, 0x82, 0x5a, 0x33, 0xff, 0xff, 0x00, 0x5a, 0x33, 0xfe, 0xff, 0x82, 0x5a, 0x32, 0xff, 0xff, 0x04, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x59, 0x30, 0xff, 0xff, 0x90, 0x83, 
+  0xfe, 0xff, 0xd4, 0xd2, 0xfb, 0xff, 0x81, 0xea, 0xeb, 0xfb, 0xff, 0x01, 0xdb, 0xda, 0xfb, 0xff, 0x9c, 0x91, 0xfd, 0xff, 0x82, 0x57, 0x2f, 0xff, 0xff, 0x00, 0x57, 0x2f, 0xfe, 0xff, 0x82, 0x57, 
+  0x2e, 0xff, 0xff, 0x02, 0x56, 0x2d, 0xfe, 0xff, 0x4b, 0x27, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x53, 0x2f, 0xe2, 0x6f, 0x82, 0x5e, 
+  0x36, 0xff, 0xff, 0x00, 0x5e, 0x36, 0xfe, 0xff, 0x81, 0x5d, 0x35, 0xfe, 0xff, 0x82, 0x5d, 0x35, 0xff, 0xff, 0x02, 0x61, 0x3c, 0xff, 0xff, 0xa6, 0x9d, 0xfc, 0xff, 0xe0, 0xe0, 0xfb, 0xff, 0x81, 
+  0xea, 0xeb, 0xfb, 0xff, 0x02, 0xcf, 0xcc, 0xfc, 0xff, 0x87, 0x76, 0xfd, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5c, 0x34, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x82, 0x5b, 0x34, 0xff, 0xff, 
+  0x01, 0x5b, 0x34, 0xfe, 0xff, 0x5a, 0x33, 0xfe, 0xff, 0x82, 0x5a, 0x33, 0xff, 0xff, 0x00, 0x59, 0x32, 0xfe, 0xff, 0x82, 0x5a, 0x32, 0xff, 0xff, 0x08, 0x59, 0x31, 0xfe, 0xff, 0x85, 0x74, 0xfe, 
+  0xff, 0xce, 0xcb, 0xfc, 0xff, 0xea, 0xeb, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe0, 0xe0, 0xfb, 0xff, 0xa6, 0x9d, 0xfd, 0xff, 0x5c, 0x38, 0xff, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x82, 0x57, 0x2f, 
+  0xff, 0xff, 0x00, 0x57, 0x2e, 0xfe, 0xff, 0x82, 0x57, 0x2e, 0xff, 0xff, 0x02, 0x56, 0x2d, 0xfe, 0xff, 0x4b, 0x27, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x08, 0x52, 0x2e, 0xe2, 0x6f, 0x81, 0x5d, 0x35, 0xfe, 0xff, 0x00, 0x5c, 0x35, 0xfd, 0xff, 0x84, 0x5c, 0x35, 0xfe, 0xff, 0x0b, 0x5c, 0x34, 0xfe, 0xff, 0x5b, 0x34, 0xfd, 0xff, 0x5b, 
+  0x34, 0xfe, 0xff, 0x64, 0x44, 0xfe, 0xff, 0xaf, 0xa7, 0xfd, 0xff, 0xe3, 0xe3, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xc7, 0xc4, 0xfc, 0xff, 0x7d, 0x68, 0xfe, 0xff, 0x5b, 
+  0x34, 0xfe, 0xff, 0x5b, 0x33, 0xfe, 0xff, 0x83, 0x5a, 0x33, 0xfe, 0xff, 0x84, 0x59, 0x32, 0xfe, 0xff, 0x82, 0x59, 0x31, 0xfe, 0xff, 0x06, 0x7a, 0x66, 0xfd, 0xff, 0xc6, 0xc3, 0xfb, 0xff, 0xe9, 
+  0xea, 0xfa, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0xe3, 0xe3, 0xfa, 0xff, 0xae, 0xa7, 0xfc, 0xff, 0x61, 0x41, 0xfe, 0xff, 0x81, 0x57, 0x2f, 0xfe, 0xff, 0x83, 0x56, 0x2e, 0xfe, 0xff, 0x83, 0x56, 0x2d, 
+  0xfe, 0xff, 0x02, 0x55, 0x2c, 0xfe, 0xff, 0x4b, 0x26, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x51, 0x2e, 0xe2, 0x6f, 0x5c, 0x35, 0xfe, 
+  0xff, 0x85, 0x5c, 0x35, 0xff, 0xff, 0x01, 0x5c, 0x35, 0xfe, 0xff, 0x5b, 0x34, 0xfe, 0xff, 0x83, 0x5b, 0x34, 0xff, 0xff, 0x06, 0x6b, 0x4f, 0xfe, 0xff, 0xb7, 0xb2, 0xfc, 0xff, 0xe6, 0xe7, 0xfb, 
+  0xff, 0xea, 0xeb, 0xfb, 0xff, 0xe8, 0xe9, 0xfb, 0xff, 0xc0, 0xbb, 0xfc, 0xff, 0x72, 0x5a, 0xfe, 0xff, 0x82, 0x5a, 0x33, 0xff, 0xff, 0x00, 0x59, 0x32, 0xfe, 0xff, 0x83, 0x59, 0x32, 0xff, 0xff, 
+  0x08, 0x58, 0x31, 0xfe, 0xff, 0x59, 0x31, 0xff, 0xff, 0x70, 0x58, 0xff, 0xff, 0xbf, 0xbb, 0xfc, 0xff, 0xe7, 0xe8, 0xfa, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xe5, 0xe7, 0xfb, 0xff, 0xb8, 0xb3, 0xfd, 
+  0xff, 0x68, 0x4e, 0xfe, 0xff, 0x82, 0x57, 0x2f, 0xff, 0xff, 0x00, 0x56, 0x2e, 0xfe, 0xff, 0x82, 0x56, 0x2e, 0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x82, 0x56, 0x2d, 0xff, 0xff, 0x81, 0x55, 
+  0x2c, 0xff, 0xff, 0x01, 0x4b, 0x26, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x51, 0x2d, 0xe2, 0x6f, 0x83, 0x5c, 0x35, 0xff, 0xff, 0x00, 
+  0x5c, 0x35, 0xfe, 0xff, 0x83, 0x5b, 0x34, 0xfe, 0xff, 0x81, 0x5b, 0x34, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x81, 0x5a, 0x33, 0xfe, 0xff, 0x07, 0x5b, 0x34, 0xff, 0xff, 0x72, 0x5b, 0xfe, 
+  0xff, 0xc0, 0xbc, 0xfc, 0xff, 0xe8, 0xe8, 0xfa, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe5, 0xe6, 0xfb, 0xff, 0xb7, 0xb1, 0xfc, 0xff, 0x6a, 0x4e, 0xfe, 0xff, 0x81, 0x59, 0x32, 0xfe, 0xff, 0x81, 0x59, 
+  0x32, 0xff, 0xff, 0x08, 0x59, 0x32, 0xfe, 0xff, 0x58, 0x31, 0xfe, 0xff, 0x68, 0x4c, 0xfe, 0xff, 0xb6, 0xb0, 0xfc, 0xff, 0xe4, 0xe6, 0xfb, 0xff, 0xe9, 0xea, 0xfa, 0xff, 0xe7, 0xe9, 0xfa, 0xff, 
+  0xc0, 0xbc, 0xfc, 0xff, 0x71, 0x5a, 0xfe, 0xff, 0x81, 0x57, 0x2f, 0xfe, 0xff, 0x81, 0x57, 0x2f, 0xff, 0xff, 0x81, 0x56, 0x2e, 0xfe, 0xff, 0x81, 0x56, 0x2e, 0xff, 0xff, 0x81, 0x55, 0x2d, 0xfe, 
+  0xff, 0x81, 0x56, 0x2d, 0xff, 0xff, 0x81, 0x55, 0x2c, 0xfe, 0xff, 0x02, 0x55, 0x2c, 0xff, 0xff, 0x4a, 0x26, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x08, 0x50, 0x2d, 0xe3, 0x6f, 0x82, 0x5b, 0x34, 0xff, 0xff, 0x00, 0x5b, 0x34, 0xfe, 0xff, 0x81, 0x5a, 0x33, 0xfe, 0xff, 0x83, 0x5a, 0x33, 0xff, 0xff, 0x01, 0x5a, 0x33, 0xfe, 0xff, 0x59, 
+  0x32, 0xfe, 0xff, 0x83, 0x5a, 0x33, 0xff, 0xff, 0x07, 0x5a, 0x33, 0xfe, 0xff, 0x7b, 0x67, 0xfe, 0xff, 0xc6, 0xc4, 0xfc, 0xff, 0xe8, 0xea, 0xfb, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xe3, 0xe4, 0xfb, 
+  0xff, 0xae, 0xa8, 0xfc, 0xff, 0x62, 0x43, 0xff, 0xff, 0x81, 0x58, 0x31, 0xff, 0xff, 0x06, 0x61, 0x41, 0xfe, 0xff, 0xad, 0xa7, 0xfd, 0xff, 0xe3, 0xe4, 0xfb, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xe8, 
+  0xea, 0xfa, 0xff, 0xc6, 0xc4, 0xfc, 0xff, 0x7b, 0x68, 0xfe, 0xff, 0x81, 0x57, 0x2f, 0xff, 0xff, 0x00, 0x57, 0x2e, 0xfe, 0xff, 0x82, 0x57, 0x2e, 0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x82, 
+  0x56, 0x2d, 0xff, 0xff, 0x00, 0x55, 0x2c, 0xfe, 0xff, 0x82, 0x56, 0x2c, 0xff, 0xff, 0x00, 0x55, 0x2b, 0xfe, 0xff, 0x81, 0x55, 0x2b, 0xff, 0xff, 0x01, 0x4a, 0x25, 0xe3, 0x6c, 0x00, 0x00, 0x00, 
+  0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x50, 0x2d, 0xe2, 0x6f, 0x5b, 0x34, 0xfe, 0xff, 0x81, 0x5a, 0x33, 0xfe, 0xff, 0x85, 0x5a, 0x33, 0xff, 0xff, 0x01, 0x5a, 0x33, 
+  0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x83, 0x5a, 0x33, 0xff, 0xff, 0x01, 0x5a, 0x33, 0xfe, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x81, 0x59, 0x32, 0xff, 0xff, 0x07, 0x86, 0x76, 0xfe, 0xff, 0xcd, 0xcc, 
+  0xfc, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0xe9, 0xeb, 0xfb, 0xff, 0xdf, 0xe0, 0xfb, 0xff, 0xa5, 0x9d, 0xfd, 0xff, 0xa4, 0x9c, 0xfd, 0xff, 0xdf, 0xdf, 0xfb, 0xff, 0x81, 0xe9, 0xeb, 0xfb, 0xff, 0x01, 
+  0xce, 0xcc, 0xfc, 0xff, 0x86, 0x76, 0xfd, 0xff, 0x82, 0x57, 0x2f, 0xff, 0xff, 0x00, 0x57, 0x2e, 0xfe, 0xff, 0x83, 0x57, 0x2e, 0xff, 0xff, 0x83, 0x56, 0x2d, 0xff, 0xff, 0x83, 0x56, 0x2c, 0xff, 
+  0xff, 0x82, 0x55, 0x2b, 0xff, 0xff, 0x01, 0x4a, 0x25, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4e, 0x2b, 0xe2, 0x6c, 0x86, 0x5a, 0x32, 
+  0xfe, 0xff, 0x02, 0x59, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfd, 0xff, 0x59, 0x32, 0xfe, 0xff, 0x83, 0x5a, 0x32, 0xfe, 0xff, 0x00, 0x59, 0x32, 0xfe, 0xff, 0x83, 0x59, 0x31, 0xfe, 0xff, 0x04, 0x58, 
+  0x31, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x90, 0x83, 0xfd, 0xff, 0xd3, 0xd2, 0xfb, 0xff, 0xe9, 0xeb, 0xfa, 0xff, 0x81, 0xe8, 0xea, 0xfa, 0xff, 0x03, 0xe9, 0xeb, 0xfa, 0xff, 0xd4, 0xd3, 0xfb, 
+  0xff, 0x91, 0x84, 0xfd, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x82, 0x57, 0x2e, 0xfe, 0xff, 0x00, 0x56, 0x2e, 0xfe, 0xff, 0x83, 0x56, 0x2d, 0xfe, 0xff, 0x83, 0x55, 0x2c, 0xfe, 0xff, 0x83, 0x55, 0x2b, 
+  0xfe, 0xff, 0x83, 0x54, 0x2a, 0xfe, 0xff, 0x01, 0x49, 0x24, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x2b, 0xe3, 0x6c, 0x84, 0x5a, 
+  0x32, 0xff, 0xff, 0x01, 0x5a, 0x32, 0xfe, 0xff, 0x59, 0x31, 0xfe, 0xff, 0x85, 0x5a, 0x32, 0xff, 0xff, 0x00, 0x59, 0x31, 0xfe, 0xff, 0x83, 0x59, 0x31, 0xff, 0xff, 0x01, 0x59, 0x31, 0xfe, 0xff, 
+  0x58, 0x30, 0xfe, 0xff, 0x81, 0x58, 0x30, 0xff, 0xff, 0x06, 0x58, 0x2f, 0xff, 0xff, 0x9a, 0x8f, 0xfd, 0xff, 0xd9, 0xd9, 0xfb, 0xff, 0xda, 0xda, 0xfc, 0xff, 0x9b, 0x90, 0xfe, 0xff, 0x58, 0x2e, 
+  0xff, 0xff, 0x58, 0x2f, 0xfe, 0xff, 0x83, 0x57, 0x2e, 0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x82, 0x56, 0x2d, 0xff, 0xff, 0x00, 0x55, 0x2c, 0xfe, 0xff, 0x83, 0x55, 0x2c, 0xff, 0xff, 0x83, 
+  0x55, 0x2b, 0xff, 0xff, 0x83, 0x54, 0x2a, 0xff, 0xff, 0x01, 0x49, 0x24, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x4f, 0x2b, 0xe3, 0x6c, 
+  0x5a, 0x32, 0xff, 0xff, 0x81, 0x5a, 0x32, 0xfe, 0xff, 0x82, 0x59, 0x31, 0xfe, 0xff, 0x83, 0x5a, 0x32, 0xff, 0xff, 0x00, 0x5a, 0x32, 0xfe, 0xff, 0x81, 0x59, 0x31, 0xfe, 0xff, 0x83, 0x59, 0x31, 
+  0xff, 0xff, 0x81, 0x58, 0x30, 0xfe, 0xff, 0x82, 0x58, 0x30, 0xff, 0xff, 0x06, 0x58, 0x30, 0xfe, 0xff, 0x57, 0x2f, 0xfe, 0xff, 0x5c, 0x36, 0xff, 0xff, 0x5c, 0x37, 0xff, 0xff, 0x58, 0x2f, 0xff, 
+  0xff, 0x58, 0x2f, 0xfe, 0xff, 0x57, 0x2e, 0xfe, 0xff, 0x82, 0x57, 0x2e, 0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x82, 0x56, 0x2d, 0xff, 0xff, 0x01, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 
+  0xff, 0x81, 0x55, 0x2c, 0xff, 0xff, 0x01, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x82, 0x55, 0x2b, 0xff, 0xff, 0x00, 0x54, 0x2a, 0xfe, 0xff, 0x82, 0x54, 0x2a, 0xff, 0xff, 0x02, 0x53, 
+  0x29, 0xfe, 0xff, 0x49, 0x23, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4e, 0x2a, 0xe3, 0x6c, 0x81, 0x58, 0x30, 0xfe, 0xff, 0x00, 0x59, 
+  0x31, 0xfe, 0xff, 0x85, 0x59, 0x31, 0xff, 0xff, 0x01, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x84, 0x58, 0x30, 0xff, 0xff, 0x81, 0x57, 0x2f, 0xfe, 0xff, 0x82, 0x57, 0x2f, 0xff, 0xff, 
+  0x01, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x83, 0x57, 0x2e, 0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x82, 0x56, 0x2d, 0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x83, 0x55, 0x2c, 
+  0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x82, 0x54, 0x2b, 0xff, 0xff, 0x00, 0x54, 0x2a, 0xfe, 0xff, 0x82, 0x54, 0x2a, 0xff, 0xff, 0x00, 0x54, 0x2a, 0xfe, 0xff, 0x83, 0x53, 0x29, 0xff, 0xff, 
+  0x02, 0x52, 0x29, 0xff, 0xff, 0x48, 0x24, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4e, 0x2a, 0xe3, 0x6c, 0x86, 0x59, 0x31, 0xff, 0xff, 
+  0x01, 0x59, 0x31, 0xfe, 0xff, 0x58, 0x30, 0xfe, 0xff, 0x85, 0x58, 0x30, 0xff, 0xff, 0x00, 0x57, 0x2f, 0xfe, 0xff, 0x84, 0x57, 0x2f, 0xff, 0xff, 0x00, 0x56, 0x2e, 0xfe, 0xff, 0x83, 0x57, 0x2e, 
+  0xff, 0xff, 0x00, 0x56, 0x2d, 0xfe, 0xff, 0x83, 0x56, 0x2d, 0xff, 0xff, 0x83, 0x55, 0x2c, 0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x83, 0x54, 0x2b, 0xff, 0xff, 0x83, 0x54, 0x2a, 0xff, 0xff, 
+  0x83, 0x53, 0x29, 0xff, 0xff, 0x81, 0x52, 0x29, 0xff, 0xff, 0x01, 0x48, 0x24, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4d, 0x2a, 0xe3, 
+  0x6c, 0x82, 0x58, 0x30, 0xff, 0xff, 0x82, 0x58, 0x30, 0xfe, 0xff, 0x81, 0x57, 0x2f, 0xfe, 0xff, 0x83, 0x57, 0x2f, 0xff, 0xff, 0x81, 0x57, 0x2f, 0xfe, 0xff, 0x00, 0x56, 0x2e, 0xfe, 0xff, 0x83, 
+  0x56, 0x2e, 0xff, 0xff, 0x01, 0x56, 0x2e, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 0xff, 0x82, 0x56, 0x2d, 0xff, 0xff, 0x01, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x82, 0x55, 0x2c, 0xff, 0xff, 
+  0x01, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x82, 0x54, 0x2b, 0xff, 0xff, 0x01, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x81, 0x53, 0x2a, 0xff, 0xff, 0x81, 0x53, 0x2a, 0xfe, 
+  0xff, 0x82, 0x53, 0x2a, 0xff, 0xff, 0x00, 0x53, 0x29, 0xfe, 0xff, 0x82, 0x53, 0x29, 0xff, 0xff, 0x81, 0x52, 0x28, 0xfe, 0xff, 0x02, 0x52, 0x28, 0xff, 0xff, 0x48, 0x23, 0xe3, 0x6c, 0x00, 0x00, 
+  0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4d, 0x29, 0xe3, 0x6c, 0x81, 0x58, 0x30, 0xff, 0xff, 0x00, 0x58, 0x30, 0xfe, 0xff, 0x81, 0x57, 0x2f, 0xfe, 0xff, 0x85, 
+  0x57, 0x2f, 0xff, 0xff, 0x01, 0x57, 0x2f, 0xfe, 0xff, 0x56, 0x2e, 0xfe, 0xff, 0x84, 0x56, 0x2e, 0xff, 0xff, 0x00, 0x55, 0x2d, 0xfe, 0xff, 0x84, 0x56, 0x2d, 0xff, 0xff, 0x00, 0x55, 0x2c, 0xfe, 
+  0xff, 0x83, 0x55, 0x2c, 0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x83, 0x54, 0x2b, 0xff, 0xff, 0x83, 0x53, 0x2a, 0xff, 0xff, 0x00, 0x53, 0x2a, 0xfe, 0xff, 0x83, 0x53, 0x2a, 0xff, 0xff, 0x83, 
+  0x53, 0x29, 0xff, 0xff, 0x82, 0x52, 0x28, 0xff, 0xff, 0x01, 0x48, 0x22, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x28, 0xe2, 0x6c, 
+  0x82, 0x57, 0x2f, 0xfe, 0xff, 0x85, 0x57, 0x2f, 0xff, 0xff, 0x82, 0x56, 0x2e, 0xfe, 0xff, 0x83, 0x56, 0x2e, 0xff, 0xff, 0x02, 0x56, 0x2e, 0xfe, 0xff, 0x55, 0x2d, 0xfe, 0xff, 0x56, 0x2d, 0xfe, 
+  0xff, 0x82, 0x56, 0x2d, 0xff, 0xff, 0x01, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x82, 0x55, 0x2c, 0xff, 0xff, 0x01, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x82, 0x54, 0x2b, 
+  0xff, 0xff, 0x01, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x82, 0x53, 0x2a, 0xff, 0xff, 0x81, 0x53, 0x2a, 0xfe, 0xff, 0x81, 0x53, 0x2a, 0xff, 0xff, 0x01, 0x53, 0x2a, 0xfe, 0xff, 0x53, 
+  0x29, 0xfe, 0xff, 0x82, 0x53, 0x29, 0xff, 0xff, 0x00, 0x52, 0x28, 0xfe, 0xff, 0x82, 0x52, 0x28, 0xff, 0xff, 0x01, 0x47, 0x22, 0xe3, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x27, 0xe2, 0x6c, 0x86, 0x57, 0x2e, 0xff, 0xff, 0x00, 0x56, 0x2e, 0xfe, 0xff, 0x81, 0x56, 0x2d, 0xfe, 0xff, 0x84, 0x56, 0x2d, 0xff, 0xff, 0x01, 0x55, 0x2d, 
+  0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x83, 0x56, 0x2c, 0xff, 0xff, 0x81, 0x55, 0x2c, 0xfe, 0xff, 0x83, 0x55, 0x2c, 0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x83, 0x54, 0x2b, 0xff, 0xff, 0x00, 
+  0x53, 0x2a, 0xfe, 0xff, 0x82, 0x53, 0x2a, 0xff, 0xff, 0x00, 0x53, 0x2a, 0xfe, 0xff, 0x83, 0x53, 0x29, 0xff, 0xff, 0x00, 0x52, 0x28, 0xfe, 0xff, 0x83, 0x52, 0x28, 0xff, 0xff, 0x83, 0x51, 0x27, 
+  0xff, 0xff, 0x01, 0x46, 0x21, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4c, 0x27, 0xe3, 0x6c, 0x83, 0x57, 0x2e, 0xff, 0xff, 0x00, 0x57, 
+  0x2e, 0xfe, 0xff, 0x81, 0x56, 0x2d, 0xfe, 0xff, 0x85, 0x56, 0x2d, 0xff, 0xff, 0x01, 0x56, 0x2d, 0xfe, 0xff, 0x55, 0x2c, 0xfe, 0xff, 0x84, 0x56, 0x2c, 0xff, 0xff, 0x00, 0x55, 0x2c, 0xfe, 0xff, 
+  0x84, 0x55, 0x2c, 0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x83, 0x54, 0x2b, 0xff, 0xff, 0x00, 0x53, 0x2a, 0xfe, 0xff, 0x83, 0x53, 0x2a, 0xff, 0xff, 0x84, 0x53, 0x29, 0xff, 0xff, 0x83, 0x52, 
+  0x28, 0xff, 0xff, 0x83, 0x51, 0x27, 0xff, 0xff, 0x02, 0x50, 0x26, 0xff, 0xff, 0x46, 0x21, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4c, 
+  0x27, 0xe2, 0x6c, 0x82, 0x56, 0x2d, 0xfe, 0xff, 0x81, 0x55, 0x2d, 0xfe, 0xff, 0x85, 0x55, 0x2d, 0xff, 0xff, 0x00, 0x55, 0x2d, 0xfe, 0xff, 0x81, 0x55, 0x2c, 0xfe, 0xff, 0x83, 0x55, 0x2c, 0xff, 
+  0xff, 0x02, 0x55, 0x2c, 0xfe, 0xff, 0x55, 0x2b, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x82, 0x54, 0x2b, 0xff, 0xff, 0x01, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x82, 0x53, 0x2a, 0xff, 
+  0xff, 0x81, 0x53, 0x2a, 0xfe, 0xff, 0x82, 0x52, 0x29, 0xff, 0xff, 0x81, 0x52, 0x29, 0xfe, 0xff, 0x82, 0x52, 0x28, 0xff, 0xff, 0x01, 0x52, 0x28, 0xfe, 0xff, 0x51, 0x27, 0xfe, 0xff, 0x82, 0x51, 
+  0x27, 0xff, 0xff, 0x00, 0x51, 0x27, 0xfe, 0xff, 0x82, 0x50, 0x26, 0xff, 0xff, 0x03, 0x50, 0x26, 0xfe, 0xff, 0x4f, 0x25, 0xff, 0xff, 0x46, 0x20, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4b, 0x26, 0xe2, 0x6c, 0x88, 0x55, 0x2d, 0xff, 0xff, 0x01, 0x55, 0x2d, 0xfe, 0xff, 0x54, 0x2c, 0xfe, 0xff, 0x85, 0x55, 0x2c, 0xff, 0xff, 0x00, 
+  0x54, 0x2b, 0xfe, 0xff, 0x84, 0x54, 0x2b, 0xff, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x84, 0x53, 0x2a, 0xff, 0xff, 0x00, 0x52, 0x29, 0xfe, 0xff, 0x83, 0x52, 0x29, 0xff, 0xff, 0x00, 0x51, 0x28, 
+  0xfe, 0xff, 0x83, 0x52, 0x28, 0xff, 0xff, 0x84, 0x51, 0x27, 0xff, 0xff, 0x83, 0x50, 0x26, 0xff, 0xff, 0x81, 0x4f, 0x25, 0xff, 0xff, 0x01, 0x45, 0x20, 0xe2, 0x6c, 0x00, 0x00, 0x00, 0x08, 0x89, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x44, 0x24, 0xcf, 0x57, 0x85, 0x55, 0x2d, 0xff, 0xff, 0x00, 0x55, 0x2d, 0xfe, 0xff, 0x81, 0x54, 0x2c, 0xfe, 0xff, 0x00, 0x55, 0x2c, 0xfe, 
+  0xff, 0x84, 0x55, 0x2c, 0xff, 0xff, 0x01, 0x55, 0x2c, 0xfe, 0xff, 0x54, 0x2b, 0xfe, 0xff, 0x84, 0x54, 0x2b, 0xff, 0xff, 0x00, 0x53, 0x2a, 0xfe, 0xff, 0x84, 0x53, 0x2a, 0xff, 0xff, 0x00, 0x52, 
+  0x29, 0xfe, 0xff, 0x83, 0x52, 0x29, 0xff, 0xff, 0x00, 0x51, 0x28, 0xfe, 0xff, 0x83, 0x52, 0x28, 0xff, 0xff, 0x00, 0x51, 0x27, 0xfe, 0xff, 0x82, 0x51, 0x27, 0xff, 0xff, 0x00, 0x51, 0x27, 0xfe, 
+  0xff, 0x83, 0x50, 0x26, 0xff, 0xff, 0x00, 0x4f, 0x25, 0xfe, 0xff, 0x81, 0x4f, 0x25, 0xff, 0xff, 0x01, 0x40, 0x1e, 0xcf, 0x57, 0x00, 0x00, 0x00, 0x07, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0x00, 0x00, 0x04, 0x19, 0x08, 0x5c, 0x23, 0x51, 0x2b, 0xf4, 0xe7, 0x81, 0x54, 0x2c, 0xff, 0xff, 0x00, 0x54, 0x2c, 0xfe, 0xff, 0x81, 0x53, 0x2b, 0xfe, 0xff, 0x00, 0x54, 0x2b, 0xfe, 0xff, 0x85, 
+  0x54, 0x2b, 0xff, 0xff, 0x01, 0x54, 0x2b, 0xfe, 0xff, 0x53, 0x2a, 0xfe, 0xff, 0x84, 0x53, 0x2a, 0xff, 0xff, 0x01, 0x53, 0x2a, 0xfe, 0xff, 0x52, 0x29, 0xfe, 0xff, 0x83, 0x52, 0x29, 0xff, 0xff, 
+  0x01, 0x52, 0x29, 0xfe, 0xff, 0x51, 0x28, 0xfe, 0xff, 0x83, 0x51, 0x28, 0xff, 0xff, 0x00, 0x50, 0x27, 0xfe, 0xff, 0x83, 0x51, 0x27, 0xff, 0xff, 0x00, 0x50, 0x26, 0xfe, 0xff, 0x83, 0x50, 0x26, 
+  0xff, 0xff, 0x00, 0x4f, 0x25, 0xfe, 0xff, 0x82, 0x4f, 0x25, 0xff, 0xff, 0x00, 0x4f, 0x25, 0xfe, 0xff, 0x81, 0x4e, 0x24, 0xff, 0xff, 0x02, 0x4b, 0x24, 0xf4, 0xe7, 0x17, 0x07, 0x5a, 0x23, 0x00, 
+  0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x3c, 0x21, 0xb5, 0x5b, 0x51, 0x2b, 0xf3, 0xf4, 0x53, 0x2b, 0xff, 0xff, 0x88, 0x54, 0x2b, 
+  0xff, 0xff, 0x00, 0x53, 0x2a, 0xfe, 0xff, 0x85, 0x53, 0x2a, 0xff, 0xff, 0x00, 0x52, 0x29, 0xfe, 0xff, 0x84, 0x52, 0x29, 0xff, 0xff, 0x00, 0x52, 0x29, 0xfe, 0xff, 0x84, 0x51, 0x28, 0xff, 0xff, 
+  0x00, 0x50, 0x27, 0xfe, 0xff, 0x83, 0x51, 0x27, 0xff, 0xff, 0x00, 0x50, 0x26, 0xfe, 0xff, 0x83, 0x50, 0x26, 0xff, 0xff, 0x84, 0x4f, 0x25, 0xff, 0xff, 0x81, 0x4e, 0x24, 0xff, 0xff, 0x03, 0x4c, 
+  0x24, 0xf4, 0xf3, 0x39, 0x1b, 0xb6, 0x5b, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x2b, 0x17, 0x85, 
+  0x44, 0x45, 0x26, 0xcf, 0xa3, 0x4c, 0x2e, 0xd5, 0xd7, 0x84, 0x59, 0x41, 0xcd, 0xff, 0x82, 0x59, 0x41, 0xcc, 0xff, 0x84, 0x59, 0x41, 0xcd, 0xff, 0x86, 0x58, 0x40, 0xcc, 0xff, 0x85, 0x57, 0x3f, 
+  0xcc, 0xff, 0x84, 0x57, 0x3e, 0xcc, 0xff, 0x00, 0x56, 0x3d, 0xcb, 0xff, 0x83, 0x56, 0x3d, 0xcc, 0xff, 0x00, 0x55, 0x3d, 0xcb, 0xff, 0x83, 0x55, 0x3d, 0xcc, 0xff, 0x05, 0x55, 0x3c, 0xcb, 0xff, 
+  0x48, 0x28, 0xd4, 0xd7, 0x41, 0x20, 0xce, 0xa3, 0x29, 0x13, 0x85, 0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2b, 0x11, 0x10, 0x0a, 0x4c, 0x6d, 0x63, 0x50, 0xdc, 0x77, 0x6d, 0x57, 0xff, 0x76, 0x6d, 0x57, 0xff, 0x81, 0x76, 0x6c, 0x57, 0xff, 0x86, 
+  0x76, 0x6d, 0x57, 0xff, 0x85, 0x76, 0x6c, 0x57, 0xff, 0x00, 0x76, 0x6c, 0x56, 0xff, 0x81, 0x75, 0x6b, 0x56, 0xff, 0x82, 0x75, 0x6c, 0x56, 0xff, 0x00, 0x75, 0x6b, 0x56, 0xff, 0x84, 0x75, 0x6b, 
+  0x55, 0xff, 0x00, 0x74, 0x6b, 0x55, 0xff, 0x83, 0x74, 0x6a, 0x55, 0xff, 0x00, 0x74, 0x6a, 0x54, 0xff, 0x83, 0x73, 0x6a, 0x54, 0xff, 0x06, 0x73, 0x69, 0x53, 0xff, 0x69, 0x60, 0x4c, 0xdc, 0x10, 
+  0x0f, 0x09, 0x4c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+  0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x23, 0x4b, 0x45, 0x36, 0x60, 0x83, 0x78, 0x60, 0xfb, 0x86, 0x86, 0x7b, 0x63, 0xff, 0x01, 0x86, 0x7a, 0x62, 0xff, 0x85, 0x7a, 0x62, 0xff, 0x84, 
+  0x86, 0x7a, 0x62, 0xff, 0x02, 0x86, 0x7a, 0x61, 0xff, 0x86, 0x79, 0x61, 0xff, 0x85, 0x79, 0x61, 0xff, 0x83, 0x85, 0x7a, 0x62, 0xff, 0x84, 0x85, 0x79, 0x61, 0xff, 0x00, 0x85, 0x79, 0x60, 0xff, 
+  0x84, 0x84, 0x78, 0x60, 0xff, 0x00, 0x84, 0x78, 0x5f, 0xff, 0x83, 0x84, 0x78, 0x60, 0xff, 0x06, 0x83, 0x77, 0x5f, 0xff, 0x80, 0x74, 0x5c, 0xfb, 0x4a, 0x43, 0x34, 0x60, 0x00, 0x00, 0x00, 0x23, 
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x24, 0x73, 0x69, 
+  0x54, 0x98, 0x8e, 0x82, 0x68, 0xff, 0x83, 0x8f, 0x82, 0x68, 0xff, 0x01, 0x8e, 0x82, 0x67, 0xff, 0x8e, 0x81, 0x67, 0xff, 0x85, 0x8e, 0x82, 0x67, 0xff, 0x01, 0x8d, 0x82, 0x67, 0xff, 0x8d, 0x81, 
+  0x66, 0xff, 0x84, 0x8e, 0x81, 0x66, 0xff, 0x00, 0x8d, 0x80, 0x65, 0xff, 0x83, 0x8d, 0x81, 0x66, 0xff, 0x01, 0x8c, 0x81, 0x66, 0xff, 0x8c, 0x80, 0x65, 0xff, 0x83, 0x8d, 0x80, 0x65, 0xff, 0x84, 
+  0x8c, 0x80, 0x64, 0xff, 0x81, 0x8b, 0x7f, 0x64, 0xff, 0x03, 0x71, 0x67, 0x51, 0x98, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x17, 0x14, 0x0d, 0x33, 0x85, 0x79, 0x61, 0xd4, 0x81, 0x92, 0x84, 0x6a, 0xff, 0x00, 0x92, 0x84, 0x69, 0xff, 0x87, 0x91, 0x84, 0x69, 0xff, 0x86, 
+  0x91, 0x83, 0x68, 0xff, 0x85, 0x90, 0x83, 0x68, 0xff, 0x84, 0x90, 0x83, 0x67, 0xff, 0x00, 0x90, 0x83, 0x66, 0xff, 0x84, 0x8f, 0x83, 0x66, 0xff, 0x04, 0x8f, 0x82, 0x66, 0xff, 0x83, 0x77, 0x5d, 
+  0xd4, 0x17, 0x13, 0x0d, 0x33, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x94, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x53, 0x4b, 0x3b, 0x54, 0x8e, 
+  0x81, 0x67, 0xf8, 0x92, 0x84, 0x6a, 0xff, 0x85, 0x92, 0x85, 0x6a, 0xff, 0x82, 0x91, 0x84, 0x69, 0xff, 0x83, 0x92, 0x84, 0x69, 0xff, 0x00, 0x92, 0x84, 0x68, 0xff, 0x81, 0x91, 0x83, 0x68, 0xff, 
+  0x83, 0x91, 0x84, 0x69, 0xff, 0x81, 0x90, 0x83, 0x68, 0xff, 0x83, 0x91, 0x83, 0x68, 0xff, 0x84, 0x90, 0x83, 0x67, 0xff, 0x05, 0x8f, 0x83, 0x66, 0xff, 0x90, 0x83, 0x67, 0xff, 0x8c, 0x7f, 0x64, 
+  0xf8, 0x51, 0x4a, 0x39, 0x57, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x95, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x23, 0x74, 
+  0x69, 0x54, 0x93, 0x84, 0x92, 0x85, 0x6a, 0xff, 0x00, 0x92, 0x85, 0x69, 0xff, 0x87, 0x92, 0x84, 0x69, 0xff, 0x85, 0x91, 0x84, 0x69, 0xff, 0x85, 0x91, 0x83, 0x68, 0xff, 0x84, 0x90, 0x83, 0x67, 
+  0xff, 0x82, 0x90, 0x82, 0x67, 0xff, 0x03, 0x72, 0x67, 0x51, 0x94, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x05, 0x04, 0x03, 0x30, 0x85, 0x79, 0x60, 0xd0, 0x81, 0x92, 0x85, 0x6a, 0xff, 0x88, 0x92, 0x84, 0x69, 0xff, 0x00, 0x91, 0x84, 0x68, 0xff, 0x85, 0x91, 0x84, 0x69, 
+  0xff, 0x85, 0x91, 0x83, 0x68, 0xff, 0x84, 0x90, 0x83, 0x67, 0xff, 0x82, 0x90, 0x82, 0x67, 0xff, 0x03, 0x83, 0x76, 0x5d, 0xd0, 0x08, 0x06, 0x04, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+  0x03, 0x98, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x4f, 0x48, 0x38, 0x53, 0x8c, 0x7f, 0x65, 0xf7, 0x87, 0x91, 0x83, 0x68, 0xff, 0x00, 0x90, 0x83, 0x67, 
+  0xff, 0x81, 0x90, 0x83, 0x68, 0xff, 0x01, 0x8f, 0x82, 0x67, 0xff, 0x81, 0x76, 0x5e, 0xff, 0x82, 0x7c, 0x71, 0x5a, 0xff, 0x02, 0x7c, 0x71, 0x59, 0xff, 0x81, 0x75, 0x5d, 0xff, 0x8f, 0x81, 0x66, 
+  0xff, 0x81, 0x90, 0x82, 0x67, 0xff, 0x00, 0x90, 0x82, 0x66, 0xff, 0x87, 0x8f, 0x82, 0x66, 0xff, 0x03, 0x8b, 0x7e, 0x63, 0xf7, 0x4e, 0x47, 0x37, 0x53, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
+  0x07, 0x99, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x23, 0x71, 0x67, 0x51, 0x8f, 0x90, 0x83, 0x68, 0xff, 0x84, 0x91, 0x83, 0x68, 0xff, 
+  0x00, 0x90, 0x83, 0x67, 0xff, 0x83, 0x90, 0x83, 0x68, 0xff, 0x01, 0x6b, 0x62, 0x4e, 0xff, 0x45, 0x3f, 0x33, 0xff, 0x83, 0x42, 0x3c, 0x31, 0xff, 0x02, 0x44, 0x3e, 0x33, 0xff, 0x6a, 0x61, 0x4d, 
+  0xff, 0x90, 0x82, 0x67, 0xff, 0x88, 0x8f, 0x82, 0x66, 0xff, 0x04, 0x8e, 0x82, 0x66, 0xff, 0x70, 0x65, 0x50, 0x8f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x9a, 
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2f, 0x83, 0x76, 0x5e, 0xcc, 0x91, 0x83, 0x68, 0xff, 0x91, 0x83, 0x67, 0xff, 0x81, 0x90, 0x82, 
+  0x67, 0xff, 0x00, 0x90, 0x83, 0x67, 0xff, 0x83, 0x90, 0x83, 0x68, 0xff, 0x01, 0x8e, 0x81, 0x66, 0xff, 0x44, 0x3e, 0x32, 0xff, 0x85, 0x42, 0x3c, 0x31, 0xff, 0x01, 0x43, 0x3d, 0x31, 0xff, 0x8d, 
+  0x80, 0x64, 0xff, 0x83, 0x8f, 0x82, 0x66, 0xff, 0x81, 0x8f, 0x82, 0x65, 0xff, 0x82, 0x8f, 0x82, 0x66, 0xff, 0x03, 0x81, 0x75, 0x5c, 0xcf, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x10, 0x00, 
+  0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x4c, 0x45, 0x35, 0x50, 0x8b, 0x7e, 0x63, 0xf4, 0x87, 0x90, 0x83, 0x67, 0xff, 0x01, 0x8b, 
+  0x7e, 0x63, 0xff, 0x40, 0x3a, 0x2f, 0xff, 0x84, 0x41, 0x3b, 0x30, 0xff, 0x02, 0x40, 0x3b, 0x2f, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x8a, 0x7e, 0x62, 0xff, 0x83, 0x8f, 0x82, 0x65, 0xff, 0x83, 0x8f, 
+  0x81, 0x65, 0xff, 0x03, 0x8a, 0x7d, 0x62, 0xf7, 0x4b, 0x44, 0x34, 0x50, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x00, 0x0b, 0x00, 0x00, 0x00, 0x23, 0x6f, 0x64, 0x4f, 0x88, 0x8f, 0x82, 0x67, 0xff, 0x84, 0x90, 0x83, 0x67, 0xff, 0x81, 0x90, 0x82, 0x66, 0xff, 0x01, 0x8a, 0x7d, 0x62, 0xff, 0x40, 0x3a, 0x2f, 
+  0xff, 0x83, 0x41, 0x3b, 0x30, 0xff, 0x81, 0x40, 0x3b, 0x2f, 0xff, 0x01, 0x3f, 0x3a, 0x2e, 0xff, 0x89, 0x7d, 0x62, 0xff, 0x81, 0x8f, 0x82, 0x65, 0xff, 0x84, 0x8f, 0x81, 0x65, 0xff, 0x04, 0x8e, 
+  0x80, 0x64, 0xff, 0x6e, 0x63, 0x4d, 0x8b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+  0x0f, 0x00, 0x00, 0x00, 0x2c, 0x80, 0x74, 0x5b, 0xc8, 0x81, 0x8f, 0x82, 0x67, 0xff, 0x00, 0x8f, 0x82, 0x66, 0xff, 0x83, 0x8f, 0x81, 0x66, 0xff, 0x01, 0x89, 0x7d, 0x62, 0xff, 0x3f, 0x39, 0x2e, 
+  0xff, 0x81, 0x40, 0x3a, 0x2f, 0xff, 0x83, 0x3f, 0x3a, 0x2e, 0xff, 0x01, 0x3e, 0x39, 0x2d, 0xff, 0x88, 0x7c, 0x61, 0xff, 0x86, 0x8e, 0x81, 0x65, 0xff, 0x03, 0x7e, 0x72, 0x59, 0xc8, 0x00, 0x00, 
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x33, 0x2f, 0x23, 0x3f, 0x7c, 0x71, 0x59, 0xc8, 
+  0x8a, 0x7d, 0x63, 0xff, 0x84, 0x8f, 0x81, 0x66, 0xff, 0x01, 0x89, 0x7d, 0x62, 0xff, 0x3e, 0x39, 0x2e, 0xff, 0x85, 0x3f, 0x3a, 0x2e, 0xff, 0x01, 0x3e, 0x39, 0x2d, 0xff, 0x88, 0x7c, 0x61, 0xff, 
+  0x84, 0x8e, 0x81, 0x65, 0xff, 0x04, 0x89, 0x7d, 0x61, 0xff, 0x7b, 0x6f, 0x56, 0xc8, 0x33, 0x2d, 0x22, 0x3f, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x07, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x04, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2f, 0x4e, 0x47, 0x37, 0x5c, 0x62, 0x59, 0x45, 0x87, 0x83, 0x63, 0x5a, 0x46, 0x8b, 0x01, 0x5e, 0x54, 0x41, 0x90, 0x3e, 0x39, 
+  0x2d, 0xff, 0x84, 0x3f, 0x3a, 0x2e, 0xff, 0x02, 0x3f, 0x39, 0x2d, 0xff, 0x3e, 0x38, 0x2c, 0xff, 0x5d, 0x54, 0x40, 0x90, 0x82, 0x62, 0x59, 0x45, 0x8b, 0x05, 0x62, 0x5a, 0x45, 0x8b, 0x61, 0x58, 
+  0x44, 0x87, 0x4d, 0x45, 0x35, 0x5c, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x23, 0x83, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x3b, 0x36, 0x2b, 0xe0, 0x83, 0x3f, 0x3a, 0x2e, 0xff, 0x81, 
+  0x3f, 0x39, 0x2d, 0xff, 0x01, 0x3b, 0x35, 0x2a, 0xe0, 0x00, 0x00, 0x00, 0x2c, 0x83, 0x00, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x00, 0x0b, 0x03, 0x00, 
+  0x00, 0x00, 0x10, 0x30, 0x2b, 0x22, 0x7b, 0x3e, 0x39, 0x2d, 0xff, 0x3f, 0x3a, 0x2e, 0xff, 0x82, 0x3f, 0x39, 0x2d, 0xff, 0x02, 0x3e, 0x38, 0x2c, 0xff, 0x30, 0x2b, 0x21, 0x78, 0x00, 0x00, 0x00, 
+  0x10, 0x84, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x1b, 0x30, 0x2b, 0x21, 0x90, 0x3a, 0x35, 0x29, 0xfb, 0x81, 0x3e, 0x38, 0x2c, 0xff, 0x03, 0x3a, 0x35, 0x29, 0xfb, 0x30, 0x2b, 0x20, 0x93, 0x00, 0x00, 0x00, 0x1b, 
+  0x00, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x00, 0x03, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x18, 0x15, 0x0e, 0x40, 0x81, 0x26, 0x22, 0x19, 0x74, 
+  0x02, 0x18, 0x15, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x81, 0x00, 0x00, 0x00, 0x1c, 
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x03, 0x9e, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +533,7 @@ const lv_img_dsc_t k9mail_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( k9mail_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = k9mail_64px_map,
 };
-
@@ -10,79 +10,80 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_LOCK_16PX uint8_t lock_16px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0xaf, 0x00, 0xf3, 0x00, 0xf3, 0x00, 0xaf, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0x84, 0x00, 0x84, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0xf3, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf3, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0xa8, 0x00, 0xef, 0x00, 0xe7, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xab, 0x00, 0xe0, 0x00, 0xef, 0x00, 0xa8, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0b, 0x00, 0xf8, 0x00, 0xeb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xdb, 0x00, 0xeb, 0x00, 0xf8, 0x00, 0x0c, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xbb, 0x00, 0xbb, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0xff, 0x00, 0xff, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x14, 0x00, 0xff, 0x00, 0xb8, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0x84, 0x00, 0xb8, 0x00, 0xff, 0x00, 0x14, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x84, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0xaf, 0x81, 0x00, 0xf3, 0x01, 0x00, 0xaf, 0x00, 0x24, 0x88, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x81, 0x00, 0xe8, 0x81, 0x00, 0x84, 
+  0x81, 0x00, 0xe8, 0x00, 0x00, 0x1b, 0x87, 0x00, 0x00, 0x02, 0x00, 0x90, 0x00, 0xf3, 0x00, 0x20, 0x81, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0xf3, 0x00, 0x90, 0x87, 0x00, 0x00, 0x01, 0x00, 0xc8, 
+  0x00, 0xb0, 0x83, 0x00, 0x00, 0x01, 0x00, 0xac, 0x00, 0xc8, 0x87, 0x00, 0x00, 0x01, 0x00, 0xcf, 0x00, 0xb7, 0x83, 0x00, 0x00, 0x01, 0x00, 0xa3, 0x00, 0xcf, 0x85, 0x00, 0x00, 0x03, 0x00, 0x4f, 
+  0x00, 0xa8, 0x00, 0xef, 0x00, 0xe7, 0x83, 0x00, 0xab, 0x03, 0x00, 0xe0, 0x00, 0xef, 0x00, 0xa8, 0x00, 0x4f, 0x82, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x00, 0xf8, 0x00, 0xeb, 0x87, 0x00, 0xdb, 0x02, 
+  0x00, 0xeb, 0x00, 0xf8, 0x00, 0x0c, 0x81, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 0x00, 0x18, 
+  0x00, 0xff, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 
+  0xbb, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x81, 0x00, 
+  0xff, 0x00, 0x00, 0x7b, 0x81, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x81, 0x00, 
+  0xf8, 0x00, 0x00, 0x3f, 0x81, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x82, 0x00, 0x00, 0x81, 0x00, 0x17, 0x82, 0x00, 
+  0x00, 0x02, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0xff, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x02, 0x00, 0x6c, 0x00, 0xff, 0x00, 0x18, 0x81, 0x00, 0x00, 0x02, 
+  0x00, 0x14, 0x00, 0xff, 0x00, 0xb8, 0x87, 0x00, 0x84, 0x02, 0x00, 0xb8, 0x00, 0xff, 0x00, 0x14, 0x82, 0x00, 0x00, 0x01, 0x00, 0x9c, 0x00, 0xfc, 0x87, 0x00, 0xff, 0x01, 0x00, 0xfc, 0x00, 0x9c, 
+  0x81, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xef, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xab, 0x00, 0x00, 0xab, 0x00, 0x00, 0xab, 0x00, 0x00, 0xab, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xef, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xbb, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xff, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xff, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xaf, 0x81, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x24, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1b, 0x81, 0x00, 0x00, 0xe8, 0x81, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x1b, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x90, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x20, 
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x90, 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xb0, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0xac, 0x00, 0x00, 0xc8, 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xb7, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 
+  0x00, 0x4f, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xef, 0x00, 0x00, 0xe7, 0x83, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xef, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x4f, 0x82, 0x00, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xeb, 0x87, 0x00, 0x00, 0xdb, 0x02, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x81, 0x00, 
+  0x00, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x6c, 0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x17, 0x82, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xb8, 0x87, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xff, 0x00, 0x00, 0x14, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9c, 0x00, 0x00, 0xfc, 0x87, 0x00, 0x00, 0xff, 0x01, 
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0x9c, 0x81, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xef, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xab, 0x00, 0x00, 0xab, 0x00, 0x00, 0xab, 0x00, 0x00, 0xab, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xef, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xbb, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xff, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0x84, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xff, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x84, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xaf, 0x81, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x24, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x1b, 0x81, 0x00, 0x00, 0xe8, 0x81, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x1b, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x90, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x20, 
+  0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x90, 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xb0, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0xac, 0x00, 0x00, 0xc8, 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xb7, 0x83, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x03, 0x00, 
+  0x00, 0x4f, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xef, 0x00, 0x00, 0xe7, 0x83, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xef, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x4f, 0x82, 0x00, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xeb, 0x87, 0x00, 0x00, 0xdb, 0x02, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x81, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 
+  0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x81, 0x00, 
+  0x00, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0x6c, 0x82, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x17, 0x82, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x18, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0xff, 0x00, 
+  0x00, 0xb8, 0x87, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0xb8, 0x00, 0x00, 0xff, 0x00, 0x00, 0x14, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9c, 0x00, 0x00, 0xfc, 0x87, 0x00, 0x00, 0xff, 0x01, 
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0x9c, 0x81, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xaf, 0x81, 0x00, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x24, 
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x81, 0x00, 0x00, 0x00, 0xe8, 0x81, 0x00, 0x00, 0x00, 0x84, 0x81, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x87, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 
+  0x00, 0x90, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xb0, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xc8, 0x87, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xb7, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xe7, 0x83, 0x00, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 
+  0x00, 0xa8, 0x00, 0x00, 0x00, 0x4f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xeb, 0x87, 0x00, 0x00, 0x00, 0xdb, 0x02, 0x00, 0x00, 
+  0x00, 0xeb, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x0c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 
+  0x00, 0x00, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x81, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x81, 0x00, 
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x17, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xb8, 0x87, 0x00, 
+  0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xfc, 0x87, 0x00, 
+  0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x9c, 0x81, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -90,8 +91,7 @@ const lv_img_dsc_t lock_16px = {
   .header.always_zero = 0,
   .header.w = 16,
   .header.h = 16,
-  .data_size = 256 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( lock_16px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = lock_16px_map,
 };
-
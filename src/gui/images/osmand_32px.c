@@ -10,143 +10,312 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OSMAND_32PX uint8_t osmand_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x0b, 0xfa, 0x43, 0xfa, 0x6f, 0xfa, 0x83, 0xfe, 0x83, 0xfa, 0x6c, 0xfa, 0x40, 0xf5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x2f, 0xf5, 0xa3, 0xf5, 0xf4, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf5, 0xf4, 0xf5, 0xa3, 0xf5, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x20, 0x03, 0x20, 0x03, 0x44, 0x03, 0xf0, 0x0c, 0xf0, 0x94, 0xf0, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xfc, 0xf5, 0x93, 0xf1, 0x0b, 0x44, 0x03, 0x20, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 
-  0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xd2, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd2, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0x78, 
-  0xdb, 0xb8, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd2, 0xff, 0xd6, 0xff, 0xd7, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd7, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xda, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xb6, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xdb, 0x78, 
-  0xdb, 0xb8, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd9, 0xff, 0xd6, 0xff, 0xda, 0xff, 0xda, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd1, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xdb, 0x78, 
-  0xb7, 0xb8, 0xdb, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xd9, 0xff, 0xb5, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0xb1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb1, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xb7, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd1, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd1, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd1, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xd5, 0xff, 0xed, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb1, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xda, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xd1, 0xff, 0xcd, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd2, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xed, 0xff, 0xed, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0x63, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xd8, 0xff, 0xc8, 0xff, 0xb7, 0xff, 0xa3, 0xff, 0x8f, 0xff, 0x7b, 0xdb, 0x67, 0xdb, 0x53, 0xdb, 0x3f, 0x92, 0x28, 0x25, 0x17, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x03, 
-  0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xd0, 0xff, 0xbf, 0xff, 0xac, 0xff, 0x98, 0xff, 0x84, 0xff, 0x70, 0xff, 0x5c, 0xdb, 0x48, 0xb7, 0x34, 0x6d, 0x1f, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xdb, 0x37, 0xdb, 0x3f, 0x92, 0x28, 0x25, 0x17, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8b, 0x00, 0x00, 0x07, 0xf5, 0x0b, 0xfa, 0x43, 0xfa, 0x6f, 0xfa, 0x83, 0xfe, 0x83, 0xfa, 0x6c, 0xfa, 0x40, 0xf5, 0x0b, 0x95, 0x00, 0x00, 0x03, 0xf5, 0x2f, 0xf5, 0xa3, 
+  0xf5, 0xf4, 0xf5, 0xff, 0x83, 0xf0, 0xff, 0x03, 0xf5, 0xff, 0xf5, 0xf4, 0xf5, 0xa3, 0xf5, 0x2c, 0x8a, 0x00, 0x00, 0x83, 0x00, 0x03, 0x81, 0x20, 0x03, 0x03, 0x44, 0x03, 0xf0, 0x0c, 0xf0, 0x94, 
+  0xf0, 0xfc, 0x89, 0xf0, 0xff, 0x04, 0xf5, 0xfc, 0xf5, 0x93, 0xf1, 0x0b, 0x44, 0x03, 0x20, 0x03, 0x84, 0x00, 0x03, 0x01, 0x00, 0x00, 0xff, 0xb7, 0x86, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8d, 0xf0, 
+  0xff, 0x00, 0xf6, 0xff, 0x86, 0xff, 0xff, 0x01, 0xff, 0x77, 0xff, 0xb8, 0x85, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8f, 0xf0, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xff, 0xff, 0x01, 0xff, 0x78, 0xff, 0xb8, 
+  0x84, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xd2, 0xff, 0x81, 0xd1, 0xff, 0x01, 0xd2, 0xff, 0xf1, 0xff, 0x85, 0xf0, 0xff, 0x00, 0xf6, 0xff, 0x82, 0xfe, 0xff, 0x81, 
+  0xff, 0xff, 0x01, 0xff, 0x78, 0xff, 0xb8, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x84, 0xf0, 0xff, 0x02, 0xf1, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xdb, 0xff, 
+  0xd6, 0xff, 0xf1, 0xff, 0x84, 0xf0, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x01, 0xff, 0x78, 0xff, 0xb8, 0x83, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x83, 0xf0, 0xff, 0x01, 0xf1, 
+  0xff, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x02, 0xff, 0xff, 0xd7, 0xff, 0xf1, 0xff, 0x83, 0xf0, 0xff, 0x02, 0xf5, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xff, 0x78, 
+  0xff, 0xb8, 0x82, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x81, 0xfe, 0xff, 0x01, 0xff, 0xff, 
+  0xd6, 0xff, 0x84, 0xf0, 0xff, 0x00, 0xfa, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0x78, 0xff, 0xb8, 0x82, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x83, 0xf0, 0xff, 0x00, 0xf6, 0xff, 0x83, 0xff, 0xff, 0x81, 
+  0xfb, 0xff, 0x81, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xf5, 0xff, 0x83, 0xf0, 0xff, 0x00, 0xf6, 0xff, 0x82, 0xff, 0xff, 0x01, 0xff, 0x78, 0xff, 0xb8, 0x82, 0xff, 
+  0xff, 0x00, 0xf6, 0xff, 0x83, 0xf0, 0xff, 0x00, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xfe, 0xff, 0x00, 0xd6, 0xff, 0x83, 0xf0, 0xff, 0x01, 
+  0xf1, 0xff, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xff, 0x78, 0xff, 0xb8, 0x82, 0xff, 0xff, 0x00, 0xf1, 0xff, 0x83, 0xf0, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x01, 0xff, 
+  0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xfa, 0xff, 0x82, 0xfe, 0xff, 0x83, 0xf0, 0xff, 0x05, 0xf1, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xb8, 0x81, 0xff, 
+  0xff, 0x01, 0xfb, 0xff, 0xf1, 0xff, 0x82, 0xf0, 0xff, 0x00, 0xf1, 0xff, 0x81, 0xff, 0xff, 0x86, 0xdb, 0xff, 0x02, 0xda, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0x81, 0xfe, 0xff, 0x83, 0xf0, 0xff, 0x06, 
+  0xf1, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x00, 0xf1, 0xff, 0x83, 0xf0, 0xff, 0x01, 0xdb, 0xff, 0xd6, 0xff, 0x83, 0xdb, 0xff, 0x81, 
+  0xd6, 0xff, 0x02, 0xda, 0xff, 0xfe, 0xff, 0xda, 0xff, 0x81, 0xfe, 0xff, 0x00, 0xd6, 0xff, 0x83, 0xf0, 0xff, 0x00, 0xf1, 0xff, 0x81, 0xdb, 0xff, 0x02, 0xff, 0xff, 0xdb, 0x78, 0xdb, 0xb8, 0x81, 
+  0xdb, 0xff, 0x01, 0xd6, 0xff, 0xf1, 0xff, 0x83, 0xf0, 0xff, 0x02, 0xd2, 0xff, 0xd6, 0xff, 0xd7, 0xff, 0x81, 0xd6, 0xff, 0x00, 0xd7, 0xff, 0x81, 0xd6, 0xff, 0x00, 0xfe, 0xff, 0x81, 0xda, 0xff, 
+  0x00, 0xfa, 0xff, 0x81, 0xd6, 0xff, 0x83, 0xf0, 0xff, 0x05, 0xf1, 0xff, 0xb6, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xdb, 0x78, 0xdb, 0xb8, 0x81, 0xdb, 0xff, 0x01, 0xd6, 0xff, 0xd1, 0xff, 0x83, 0xf0, 
+  0xff, 0x00, 0xf1, 0xff, 0x85, 0xb6, 0xff, 0x01, 0xd9, 0xff, 0xd6, 0xff, 0x81, 0xda, 0xff, 0x02, 0xd6, 0xff, 0xb6, 0xff, 0xf1, 0xff, 0x81, 0xf0, 0xff, 0x81, 0xec, 0xff, 0x00, 0xd1, 0xff, 0x81, 
+  0xb6, 0xff, 0x06, 0xdb, 0xff, 0xdb, 0x78, 0xb7, 0xb8, 0xdb, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb2, 0xff, 0x81, 0xec, 0xff, 0x82, 0xf0, 0xff, 0x00, 0xd2, 0xff, 0x83, 0xb2, 0xff, 0x01, 0xd9, 0xff, 
+  0xb5, 0xff, 0x81, 0xd5, 0xff, 0x02, 0xb6, 0xff, 0xb2, 0xff, 0xb1, 0xff, 0x81, 0xf0, 0xff, 0x82, 0xec, 0xff, 0x07, 0xb1, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xb7, 0x78, 0xff, 0xb8, 0xff, 
+  0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x82, 0xec, 0xff, 0x01, 0xf0, 0xff, 0xf1, 0xff, 0x82, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x03, 0xff, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xf1, 0xff, 
+  0x83, 0xec, 0xff, 0x00, 0xf1, 0xff, 0x81, 0xfe, 0xff, 0x05, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0xde, 0xff, 0x81, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x84, 0xec, 0xff, 0x02, 
+  0xf1, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x84, 0xff, 0xff, 0x01, 0xfa, 0xff, 0xf1, 0xff, 0x84, 0xec, 0xff, 0x02, 0xd6, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x07, 0xff, 0x78, 0xff, 0xb8, 
+  0xff, 0xff, 0xda, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xd6, 0xff, 0x84, 0xec, 0xff, 0x03, 0xf0, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x81, 0xfa, 0xff, 0x01, 0xf5, 0xff, 0xf0, 0xff, 
+  0x84, 0xec, 0xff, 0x01, 0xd1, 0xff, 0xda, 0xff, 0x83, 0xff, 0xff, 0x02, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0x82, 0xda, 0xff, 0x02, 0xdb, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0x8f, 0xec, 0xff, 0x01, 
+  0xd1, 0xff, 0xba, 0xff, 0x81, 0xda, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0x83, 0xda, 0xff, 0x81, 0xdb, 0xff, 0x00, 0xd2, 0xff, 0x8d, 0xec, 0xff, 0x01, 0xd1, 0xff, 
+  0xba, 0xff, 0x83, 0xda, 0xff, 0x81, 0xff, 0xff, 0x02, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0x84, 0xda, 0xff, 0x03, 0xff, 0xff, 0xfa, 0xff, 0xd5, 0xff, 0xed, 0xff, 0x8a, 0xec, 0xff, 0x01, 0xb1, 
+  0xff, 0xba, 0xff, 0x84, 0xda, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0x81, 0xba, 0xff, 0x02, 0xda, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xff, 
+  0x02, 0xda, 0xff, 0xd1, 0xff, 0xcd, 0xff, 0x84, 0xec, 0xff, 0x04, 0xed, 0xff, 0xf1, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xba, 0xff, 0x81, 0xda, 0xff, 0x83, 0xba, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xff, 
+  0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0x81, 0xba, 0xff, 0x81, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xb7, 0xff, 0xd2, 0xff, 0x81, 0xec, 0xff, 0x02, 0xd2, 0xff, 0xb6, 
+  0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x00, 0xda, 0xff, 0x84, 0xba, 0xff, 0x07, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0x81, 0xff, 0xff, 
+  0x83, 0xfe, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xed, 0xff, 0x00, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x00, 0xda, 0xff, 0x82, 0xba, 0xff, 0x81, 0xbb, 0xff, 0x05, 0xdf, 
+  0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xb8, 0xff, 0xff, 0xda, 0xff, 0x81, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x85, 0xff, 0xff, 0x81, 0xd7, 0xff, 0x86, 0xff, 0xff, 0x01, 0xda, 0xff, 0xba, 0xff, 0x82, 
+  0xbb, 0xff, 0x03, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xb8, 0x82, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x96, 0xff, 0xff, 0x01, 0xff, 0x78, 0xff, 0xb8, 0x81, 0xff, 
+  0xff, 0x83, 0xfe, 0xff, 0x94, 0xff, 0xff, 0x04, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0x63, 0xff, 0xb8, 0x8e, 0xff, 0xff, 0x10, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xd8, 0xff, 0xc8, 0xff, 0xb7, 
+  0xff, 0xa3, 0xff, 0x8f, 0xff, 0x7b, 0xdb, 0x67, 0xdb, 0x53, 0xdb, 0x3f, 0x92, 0x28, 0x25, 0x17, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x03, 0xff, 0xb8, 0x81, 0xff, 0xff, 0x11, 0xff, 0xfc, 0xff, 0xf0, 
+  0xff, 0xe0, 0xff, 0xd0, 0xff, 0xbf, 0xff, 0xac, 0xff, 0x98, 0xff, 0x84, 0xff, 0x70, 0xff, 0x5c, 0xdb, 0x48, 0xb7, 0x34, 0x6d, 0x1f, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 
+  0x8a, 0x00, 0x00, 0x06, 0xdb, 0x37, 0xdb, 0x3f, 0x92, 0x28, 0x25, 0x17, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x07, 0x81, 0x00, 0x03, 0x96, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xe4, 0x0b, 0xcd, 0xfd, 0x43, 0x2f, 0xfe, 0x6f, 0x91, 0xfe, 0x83, 0x92, 0xfe, 0x83, 0x50, 0xfe, 0x6c, 0x0e, 0xfe, 0x40, 0x4c, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf4, 0x2f, 0xe7, 0xfc, 0xa3, 0xc7, 0xfc, 0xf4, 0xa6, 0xfc, 0xff, 0x43, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x20, 0xfc, 0xff, 0x43, 0xfc, 0xff, 0xa7, 0xfc, 0xff, 0x09, 0xfd, 0xf4, 0x4a, 0xfd, 0xa3, 0x49, 0xf5, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x40, 0x10, 0x03, 0x61, 0x20, 0x03, 0xa1, 0x30, 0x03, 0xa2, 0xdb, 0x0c, 0x43, 0xfc, 0x94, 0x43, 0xfc, 0xfc, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x85, 0xfc, 0xfc, 0xe7, 0xfc, 0x93, 0x25, 0xdc, 0x0b, 0x81, 0x30, 0x03, 0x61, 0x20, 0x03, 0x20, 0x10, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-  0xbe, 0xf7, 0xb7, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x2e, 0xfd, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x01, 0xfc, 0xff, 0x6f, 0xfd, 0xff, 0x9d, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0x77, 
-  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xec, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x0d, 0xfd, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xef, 0xff, 0x7c, 0xf7, 0xff, 0x5c, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x7d, 0xff, 0xff, 0x7c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x90, 0xfd, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe8, 0xdb, 0xff, 0x0c, 0xbc, 0xff, 0x89, 0xb4, 0xff, 0x69, 0xb4, 0xff, 0x0c, 0xbc, 0xff, 0xc8, 0xdb, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x4d, 0xfd, 0xff, 0xef, 0xff, 0xff, 0x33, 0xf7, 0xff, 0xb1, 0xff, 0xff, 0x96, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x77, 0xf6, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe7, 0xeb, 0xff, 0xf2, 0xbc, 0xff, 0x58, 0xd6, 0xff, 0xda, 0xee, 0xff, 0xf9, 0xee, 0xff, 0x90, 0xf7, 0xff, 0xf1, 0xee, 0xff, 0xf6, 0xcd, 0xff, 0xb1, 0xb4, 0xff, 0xe7, 0xeb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0x4f, 0xf6, 0xff, 0x91, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xd9, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xaa, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x08, 0xec, 0xff, 0xd6, 0xc5, 0xff, 0x3c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x96, 0xe6, 0xff, 0x8f, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0xda, 0xee, 0xff, 0x74, 0xbd, 0xff, 0x08, 0xec, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0x90, 0xf7, 0xff, 0x77, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x77, 0xf6, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x04, 0xfc, 0xff, 0xb5, 0xc5, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x78, 0xde, 0xff, 0x99, 0xe6, 0xff, 0x75, 0xde, 0xff, 0xaf, 0xff, 0xff, 0x73, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x33, 0xc5, 0xff, 0xe2, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xd4, 0xdd, 0xff, 0xba, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0x72, 0xf5, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xae, 0xd4, 0xff, 0xfb, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x78, 0xde, 0xff, 0x78, 0xde, 0xff, 0xda, 0xe6, 0xff, 0xb9, 0xe6, 0xff, 0x75, 0xde, 0xff, 0xd0, 0xff, 0xff, 0x53, 0xf7, 0xff, 0x95, 0xe6, 0xff, 0xa7, 0xdc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0x31, 0xed, 0xff, 0xda, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x1a, 0xef, 0xff, 0xce, 0xf4, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xb4, 0xcd, 0xff, 0xfa, 0xf6, 0xff, 0x3c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x3c, 0xef, 0xff, 0x57, 0xde, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xb9, 0xe6, 0xff, 0x55, 0xde, 0xff, 0xd0, 0xff, 0xff, 0xaf, 0xff, 0xff, 0x8d, 0xcd, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x6c, 0xf4, 0xff, 0x57, 0xde, 0xff, 0xb9, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x5d, 0xef, 0xb8, 0x7e, 0xf7, 0xff, 0xd9, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x49, 0xfc, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe3, 0xfb, 0xff, 0x16, 0xd6, 0xff, 0xfa, 0xee, 0xff, 0x5d, 0xef, 0xff, 0x37, 0xde, 0xff, 0x37, 0xd6, 0xff, 0x1b, 0xef, 0xff, 0x17, 0xd6, 0xff, 0x99, 0xde, 0xff, 0xb9, 0xe6, 0xff, 0x58, 0xde, 0xff, 0x53, 0xde, 0xff, 0x6f, 0xf7, 0xff, 0xaf, 0xff, 0xff, 0xae, 0xde, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x08, 0xf4, 0xff, 0xf6, 0xd5, 0xff, 0x99, 0xde, 0xff, 0x7e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 
-  0xfc, 0xe6, 0xb8, 0x1c, 0xe7, 0xff, 0x99, 0xe6, 0xff, 0x98, 0xde, 0xff, 0xe7, 0xf3, 0xff, 0xa0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe4, 0xf3, 0xff, 0xba, 0xde, 0xff, 0x1c, 0xef, 0xff, 0xd5, 0xcd, 0xff, 0x17, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0xd6, 0xcd, 0xff, 0x17, 0xce, 0xff, 0xd5, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xf2, 0xcd, 0xff, 0x4e, 0xf7, 0xff, 0x70, 0xde, 0xff, 0x0f, 0xef, 0xff, 0xce, 0xe6, 0xff, 0xe1, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc6, 0xf3, 0xff, 0x94, 0xc5, 0xff, 0x37, 0xd6, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0x78, 
-  0x9a, 0xd6, 0xb8, 0xbb, 0xde, 0xff, 0xf6, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0xe8, 0xf3, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc2, 0xfb, 0xff, 0x59, 0xd6, 0xff, 0x74, 0xc5, 0xff, 0xb5, 0xcd, 0xff, 0xd6, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xb5, 0xc5, 0xff, 0x73, 0xbd, 0xff, 0x74, 0xbd, 0xff, 0xb1, 0xc5, 0xff, 0xed, 0xe6, 0xff, 0x2f, 0xd6, 0xff, 0x8e, 0xde, 0xff, 0xae, 0xe6, 0xff, 0x70, 0xc5, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xc8, 0xeb, 0xff, 0xf7, 0xcd, 0xff, 0xb6, 0xc5, 0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0x78, 
-  0x39, 0xce, 0xb8, 0x59, 0xce, 0xff, 0x94, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0xea, 0xe3, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x8f, 0xc4, 0xff, 0x33, 0xbd, 0xff, 0x74, 0xc5, 0xff, 0x12, 0xb5, 0xff, 0x33, 0xbd, 0xff, 0x74, 0xbd, 0xff, 0x13, 0xb5, 0xff, 0x4f, 0xbd, 0xff, 0x8c, 0xd6, 0xff, 0xce, 0xc5, 0xff, 0x2d, 0xd6, 0xff, 0x4d, 0xd6, 0xff, 0x72, 0xcd, 0xff, 0xcf, 0xcc, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xea, 0xdb, 0xff, 0xf2, 0xb4, 0xff, 0x74, 0xbd, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0x78, 
-  0xd7, 0xbd, 0xb8, 0xf8, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0x53, 0xb5, 0xff, 0xec, 0xc3, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x2a, 0xe4, 0xff, 0x90, 0xac, 0xff, 0xd1, 0xb4, 0xff, 0xb1, 0xac, 0xff, 0x90, 0xac, 0xff, 0xb1, 0xac, 0xff, 0xee, 0xac, 0xff, 0x2c, 0xce, 0xff, 0x6d, 0xbd, 0xff, 0xcc, 0xc5, 0xff, 0xec, 0xcd, 0xff, 0x11, 0xbd, 0xff, 0xce, 0xa4, 0xff, 0x27, 0xe4, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xab, 0xc3, 0xff, 0x90, 0xa4, 0xff, 0x13, 0xad, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0x78, 
-  0x76, 0xb5, 0xb8, 0x96, 0xb5, 0xff, 0xf2, 0xac, 0xff, 0x75, 0xb5, 0xff, 0x50, 0xa4, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa1, 0xfb, 0xff, 0x8e, 0xc4, 0xff, 0x2f, 0xa4, 0xff, 0x2f, 0xa4, 0xff, 0x2f, 0xa4, 0xff, 0x8d, 0xa4, 0xff, 0xab, 0xc5, 0xff, 0x0c, 0xb5, 0xff, 0x4b, 0xb5, 0xff, 0x6b, 0xbd, 0xff, 0xaf, 0xb4, 0xff, 0x6d, 0x9c, 0xff, 0x69, 0xb4, 0xff, 0xc2, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x4a, 0x9c, 0xff, 0x4f, 0x9c, 0xff, 0xb2, 0xa4, 0xff, 0x96, 0xb5, 0xff, 0x75, 0xad, 0x78, 
-  0x5d, 0xef, 0xb8, 0x7d, 0xef, 0xff, 0x76, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0x3d, 0xef, 0xff, 0x6e, 0xe4, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x06, 0xfc, 0xff, 0x36, 0xe6, 0xff, 0x37, 0xde, 0xff, 0x75, 0xde, 0xff, 0xb3, 0xff, 0xff, 0xd4, 0xee, 0xff, 0x53, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0xb8, 0xee, 0xff, 0x75, 0xd6, 0xff, 0x10, 0xd6, 0xff, 0x26, 0xfc, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x0a, 0xe4, 0xff, 0x32, 0xef, 0xff, 0xf3, 0xe6, 0xff, 0x99, 0xde, 0xff, 0x7d, 0xef, 0xff, 0x3c, 0xe7, 0x78, 
-  0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0xb4, 0xc6, 0xff, 0xb6, 0xd6, 0xff, 0x1a, 0xef, 0xff, 0x38, 0xd6, 0xff, 0x63, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x26, 0xfc, 0xff, 0xf1, 0xf5, 0xff, 0xb3, 0xff, 0xff, 0x15, 0xf7, 0xff, 0x94, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xd8, 0xee, 0xff, 0x96, 0xde, 0xff, 0x0f, 0xe6, 0xff, 0x46, 0xfc, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x62, 0xfb, 0xff, 0x73, 0xc5, 0xff, 0xf7, 0xee, 0xff, 0xb3, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0x93, 0xc6, 0xff, 0x92, 0xbe, 0xff, 0xb5, 0xd6, 0xff, 0xb9, 0xe6, 0xff, 0xf1, 0xd4, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0xa3, 0xfb, 0xff, 0xc9, 0xfc, 0xff, 0x0f, 0xfe, 0xff, 0xf2, 0xfe, 0xff, 0x73, 0xfe, 0xff, 0xf1, 0xfd, 0xff, 0xea, 0xfc, 0xff, 0xa3, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x4a, 0xbc, 0xff, 0x51, 0xbe, 0xff, 0xb7, 0xde, 0xff, 0xf7, 0xee, 0xff, 0x77, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0x93, 0xc6, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x95, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x4e, 0xd4, 0xff, 0x40, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0xc8, 0xc3, 0xff, 0xcf, 0xad, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0xb7, 0xde, 0xff, 0xfa, 0xee, 0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0x72, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x75, 0xce, 0xff, 0x16, 0xd6, 0xff, 0x4f, 0xcc, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0xc8, 0xbb, 0xff, 0xae, 0xa5, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0xd8, 0xde, 0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
-  0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0x72, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x97, 0xe6, 0xff, 0x53, 0xd6, 0xff, 0x2a, 0xc5, 0xff, 0x45, 0xe3, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x44, 0xe3, 0xff, 0x2a, 0x9c, 0xff, 0xce, 0xa5, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0xb6, 0xce, 0xff, 0xbe, 0xf7, 0xff, 0x5d, 0xef, 0x78, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x72, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x96, 0xd6, 0xff, 0xf5, 0xee, 0xff, 0xf0, 0xff, 0xff, 0xb1, 0xe6, 0xff, 0x2e, 0xce, 0xff, 0x8a, 0xbc, 0xff, 0x28, 0xd3, 0xff, 0x24, 0xeb, 0xff, 0x20, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x24, 0xeb, 0xff, 0xab, 0xd3, 0xff, 0x0e, 0xb4, 0xff, 0x2f, 0x9d, 0xff, 0x0f, 0xae, 0xff, 0x50, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x6f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0xb9, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x51, 0xbe, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0xb7, 0xde, 0xff, 0xf6, 0xee, 0xff, 0xf0, 0xff, 0xff, 0x12, 0xef, 0xff, 0x70, 0xf7, 0xff, 0x70, 0xf7, 0xff, 0x15, 0xd6, 0xff, 0xd6, 0xc5, 0xff, 0x54, 0xb5, 0xff, 0xed, 0xc3, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0xed, 0xbb, 0xff, 0xf2, 0xac, 0xff, 0x79, 0xd6, 0xff, 0x5c, 0xef, 0xff, 0xd9, 0xee, 0xff, 0x72, 0xbe, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x38, 0xae, 0xff, 0x9c, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x51, 0xbe, 0xff, 0x4f, 0xb6, 0xff, 0xf8, 0xde, 0xff, 0x37, 0xf7, 0xff, 0xef, 0xff, 0xff, 0x33, 0xef, 0xff, 0x91, 0xff, 0xff, 0xb1, 0xf7, 0xff, 0x98, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0xda, 0xe6, 0xff, 0xf7, 0xc5, 0xff, 0x68, 0xe3, 0xff, 0x89, 0xe3, 0xff, 0x58, 0xce, 0xff, 0xb9, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x3b, 0xef, 0xff, 0x72, 0xbe, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xae, 0xff, 0x38, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x9c, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x51, 0xbe, 0xff, 0x39, 0xe7, 0xff, 0x79, 0xf7, 0xff, 0xcf, 0xff, 0xff, 0x54, 0xf7, 0xff, 0xb1, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x1a, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xe6, 0xff, 0xdb, 0xe6, 0xff, 0x95, 0xc5, 0xff, 0x95, 0xc5, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0xfb, 0xe6, 0xff, 0x5d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x93, 0xbe, 0xff, 0x4f, 0xae, 0xff, 0x18, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x9c, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x5b, 0xef, 0xff, 0x9a, 0xf7, 0xff, 0xae, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0xb1, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x1b, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x9d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0xf9, 0xde, 0xff, 0x1c, 0xdf, 0xff, 0x3d, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0xef, 0xff, 0xff, 0x54, 0xf7, 0xff, 0x91, 0xf7, 0xff, 0x91, 0xf7, 0xff, 0xfa, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xfc, 0x7d, 0xef, 0xf0, 0x5d, 0xef, 0xe0, 0x1c, 0xe7, 0x63, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7c, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x5d, 0xef, 0xd8, 0x3d, 0xef, 0xc8, 0x1c, 0xe7, 0xb7, 0xfc, 0xe6, 0xa3, 0xfc, 0xe6, 0x8f, 0xbb, 0xde, 0x7b, 0x9a, 0xd6, 0x67, 0x9a, 0xd6, 0x53, 0xd7, 0xbd, 0x3f, 0x51, 0x8c, 0x28, 0x45, 0x29, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 
-  0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xfc, 0x7d, 0xef, 0xf0, 0x5d, 0xef, 0xe0, 0x5d, 0xef, 0xd0, 0x3c, 0xe7, 0xbf, 0x1c, 0xe7, 0xac, 0x1c, 0xe7, 0x98, 0xdb, 0xde, 0x84, 0x9a, 0xd6, 0x70, 0x9a, 0xd6, 0x5c, 0x39, 0xce, 0x48, 0x34, 0xa5, 0x34, 0x0c, 0x63, 0x1f, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x79, 0xce, 0x37, 0xd7, 0xbd, 0x3f, 0x51, 0x8c, 0x28, 0x45, 0x29, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8b, 0x00, 0x00, 0x00, 0x07, 0xea, 0xe4, 0x0b, 0xcd, 0xfd, 0x43, 0x2f, 0xfe, 0x6f, 0x91, 0xfe, 0x83, 0x92, 0xfe, 0x83, 0x50, 0xfe, 0x6c, 0x0e, 0xfe, 0x40, 0x4c, 0xe5, 
+  0x0b, 0x95, 0x00, 0x00, 0x00, 0x0b, 0xa6, 0xf4, 0x2f, 0xe7, 0xfc, 0xa3, 0xc7, 0xfc, 0xf4, 0xa6, 0xfc, 0xff, 0x43, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x20, 0xfc, 0xff, 0x43, 0xfc, 0xff, 0xa7, 0xfc, 
+  0xff, 0x09, 0xfd, 0xf4, 0x4a, 0xfd, 0xa3, 0x49, 0xf5, 0x2c, 0x8a, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x05, 0x40, 0x10, 0x03, 0x61, 0x20, 0x03, 0xa1, 0x30, 0x03, 0xa2, 0xdb, 0x0c, 0x43, 
+  0xfc, 0x94, 0x43, 0xfc, 0xfc, 0x89, 0x00, 0xfc, 0xff, 0x05, 0x85, 0xfc, 0xfc, 0xe7, 0xfc, 0x93, 0x25, 0xdc, 0x0b, 0x81, 0x30, 0x03, 0x61, 0x20, 0x03, 0x20, 0x10, 0x03, 0x83, 0x00, 0x00, 0x03, 
+  0x01, 0x00, 0x00, 0x00, 0xbe, 0xf7, 0xb7, 0x85, 0xbf, 0xff, 0xff, 0x01, 0x9d, 0xff, 0xff, 0x2e, 0xfd, 0xff, 0x8c, 0x00, 0xfc, 0xff, 0x02, 0x01, 0xfc, 0xff, 0x6f, 0xfd, 0xff, 0x9d, 0xff, 0xff, 
+  0x85, 0xbf, 0xff, 0xff, 0x04, 0x9e, 0xf7, 0x77, 0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x81, 0x7d, 0xf7, 0xff, 0x01, 0x5c, 0xf7, 0xff, 0xec, 0xfc, 0xff, 0x8f, 
+  0x00, 0xfc, 0xff, 0x0e, 0x0d, 0xfd, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xef, 0xff, 0x7c, 0xf7, 0xff, 0x5c, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0x9e, 
+  0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x7d, 0xff, 0xff, 0x7c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x90, 0xfd, 0xff, 0x84, 0x00, 0xfc, 0xff, 0x07, 0xe0, 0xfb, 0xff, 0xe8, 0xdb, 0xff, 0x0c, 0xbc, 0xff, 0x89, 
+  0xb4, 0xff, 0x69, 0xb4, 0xff, 0x0c, 0xbc, 0xff, 0xc8, 0xdb, 0xff, 0xe0, 0xfb, 0xff, 0x84, 0x00, 0xfc, 0xff, 0x0c, 0x4d, 0xfd, 0xff, 0xef, 0xff, 0xff, 0x33, 0xf7, 0xff, 0xb1, 0xff, 0xff, 0x96, 
+  0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x77, 0xf6, 0xff, 0x84, 0x00, 0xfc, 0xff, 0x09, 0xe7, 
+  0xeb, 0xff, 0xf2, 0xbc, 0xff, 0x58, 0xd6, 0xff, 0xda, 0xee, 0xff, 0xf9, 0xee, 0xff, 0x90, 0xf7, 0xff, 0xf1, 0xee, 0xff, 0xf6, 0xcd, 0xff, 0xb1, 0xb4, 0xff, 0xe7, 0xeb, 0xff, 0x83, 0x00, 0xfc, 
+  0xff, 0x0d, 0xe0, 0xfb, 0xff, 0x4f, 0xf6, 0xff, 0x91, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xd9, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 
+  0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xaa, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0x82, 0x00, 0xfc, 0xff, 0x0b, 0x08, 0xec, 0xff, 0xd6, 0xc5, 0xff, 0x3c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 
+  0xbe, 0xff, 0xff, 0x96, 0xe6, 0xff, 0x8f, 0xf7, 0xff, 0x53, 0xf7, 0xff, 0xda, 0xee, 0xff, 0x74, 0xbd, 0xff, 0x08, 0xec, 0xff, 0x81, 0x00, 0xfc, 0xff, 0x81, 0xe0, 0xfb, 0xff, 0x0a, 0xe6, 0xfc, 
+  0xff, 0x90, 0xf7, 0xff, 0x77, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x77, 0xf6, 0xff, 0x82, 
+  0xe0, 0xfb, 0xff, 0x0e, 0x00, 0xfc, 0xff, 0x04, 0xfc, 0xff, 0xb5, 0xc5, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x78, 0xde, 0xff, 0x99, 0xe6, 0xff, 0x75, 
+  0xde, 0xff, 0xaf, 0xff, 0xff, 0x73, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x33, 0xc5, 0xff, 0xe2, 0xfb, 0xff, 0x82, 0xe0, 0xfb, 0xff, 0x0b, 0xc0, 0xfb, 0xff, 0xd4, 0xdd, 0xff, 0xba, 0xe6, 0xff, 0x1b, 
+  0xef, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0x72, 0xf5, 0xff, 0xc0, 0xfb, 0xff, 0x82, 0xe0, 0xfb, 0xff, 0x04, 0xae, 
+  0xd4, 0xff, 0xfb, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x81, 0x78, 0xde, 0xff, 0x06, 0xda, 0xe6, 0xff, 0xb9, 0xe6, 0xff, 0x75, 0xde, 0xff, 0xd0, 0xff, 0xff, 0x53, 
+  0xf7, 0xff, 0x95, 0xe6, 0xff, 0xa7, 0xdc, 0xff, 0x81, 0xe0, 0xfb, 0xff, 0x81, 0xc0, 0xfb, 0xff, 0x09, 0x31, 0xed, 0xff, 0xda, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 
+  0x7e, 0xf7, 0xb8, 0x9e, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x1a, 0xef, 0xff, 0xce, 0xf4, 0xff, 0x81, 0xc0, 0xfb, 0xff, 0x81, 0xe0, 0xfb, 0xff, 0x05, 0xb4, 0xcd, 0xff, 0xfa, 0xf6, 0xff, 0x3c, 0xf7, 
+  0xff, 0xbe, 0xff, 0xff, 0x3c, 0xef, 0xff, 0x57, 0xde, 0xff, 0x82, 0xda, 0xe6, 0xff, 0x05, 0xb9, 0xe6, 0xff, 0x55, 0xde, 0xff, 0xd0, 0xff, 0xff, 0xaf, 0xff, 0xff, 0x8d, 0xcd, 0xff, 0xe0, 0xfb, 
+  0xff, 0x81, 0xc0, 0xfb, 0xff, 0x0a, 0xa0, 0xfb, 0xff, 0x6c, 0xf4, 0xff, 0x57, 0xde, 0xff, 0xb9, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x5d, 0xef, 0xb8, 0x7e, 0xf7, 0xff, 0xd9, 0xe6, 
+  0xff, 0x1b, 0xef, 0xff, 0x49, 0xfc, 0xff, 0x82, 0xc0, 0xfb, 0xff, 0x0e, 0xe3, 0xfb, 0xff, 0x16, 0xd6, 0xff, 0xfa, 0xee, 0xff, 0x5d, 0xef, 0xff, 0x37, 0xde, 0xff, 0x37, 0xd6, 0xff, 0x1b, 0xef, 
+  0xff, 0x17, 0xd6, 0xff, 0x99, 0xde, 0xff, 0xb9, 0xe6, 0xff, 0x58, 0xde, 0xff, 0x53, 0xde, 0xff, 0x6f, 0xf7, 0xff, 0xaf, 0xff, 0xff, 0xae, 0xde, 0xff, 0x81, 0xc0, 0xfb, 0xff, 0x81, 0xa0, 0xfb, 
+  0xff, 0x0a, 0x08, 0xf4, 0xff, 0xf6, 0xd5, 0xff, 0x99, 0xde, 0xff, 0x7e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 0xfc, 0xe6, 0xb8, 0x1c, 0xe7, 0xff, 0x99, 0xe6, 0xff, 0x98, 0xde, 0xff, 0xe7, 0xf3, 0xff, 
+  0xa0, 0xfb, 0xff, 0x81, 0xc0, 0xfb, 0xff, 0x0f, 0xe4, 0xf3, 0xff, 0xba, 0xde, 0xff, 0x1c, 0xef, 0xff, 0xd5, 0xcd, 0xff, 0x17, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0xd6, 0xcd, 0xff, 0x17, 0xce, 0xff, 
+  0xd5, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xf2, 0xcd, 0xff, 0x4e, 0xf7, 0xff, 0x70, 0xde, 0xff, 0x0f, 0xef, 0xff, 0xce, 0xe6, 0xff, 0xe1, 0xfb, 0xff, 0x82, 0xa0, 0xfb, 0xff, 0x09, 0xc6, 0xf3, 0xff, 
+  0x94, 0xc5, 0xff, 0x37, 0xd6, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0x78, 0x9a, 0xd6, 0xb8, 0xbb, 0xde, 0xff, 0xf6, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0xe8, 0xf3, 0xff, 0x82, 0xa0, 0xfb, 0xff, 0x0f, 
+  0xc2, 0xfb, 0xff, 0x59, 0xd6, 0xff, 0x74, 0xc5, 0xff, 0xb5, 0xcd, 0xff, 0xd6, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xb5, 0xc5, 0xff, 0x73, 0xbd, 0xff, 0x74, 0xbd, 0xff, 0xb1, 0xc5, 0xff, 0xed, 0xe6, 
+  0xff, 0x2f, 0xd6, 0xff, 0x8e, 0xde, 0xff, 0xae, 0xe6, 0xff, 0x70, 0xc5, 0xff, 0xc0, 0xfb, 0xff, 0x81, 0xa0, 0xfb, 0xff, 0x0b, 0x80, 0xfb, 0xff, 0xc8, 0xeb, 0xff, 0xf7, 0xcd, 0xff, 0xb6, 0xc5, 
+  0xff, 0xbb, 0xde, 0xff, 0x9a, 0xd6, 0x78, 0x39, 0xce, 0xb8, 0x59, 0xce, 0xff, 0x94, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0xea, 0xe3, 0xff, 0x80, 0xfb, 0xff, 0x82, 0xa0, 0xfb, 0xff, 0x0d, 0x8f, 0xc4, 
+  0xff, 0x33, 0xbd, 0xff, 0x74, 0xc5, 0xff, 0x12, 0xb5, 0xff, 0x33, 0xbd, 0xff, 0x74, 0xbd, 0xff, 0x13, 0xb5, 0xff, 0x4f, 0xbd, 0xff, 0x8c, 0xd6, 0xff, 0xce, 0xc5, 0xff, 0x2d, 0xd6, 0xff, 0x4d, 
+  0xd6, 0xff, 0x72, 0xcd, 0xff, 0xcf, 0xcc, 0xff, 0x81, 0xa0, 0xfb, 0xff, 0x81, 0x80, 0xfb, 0xff, 0x09, 0xea, 0xdb, 0xff, 0xf2, 0xb4, 0xff, 0x74, 0xbd, 0xff, 0x59, 0xce, 0xff, 0x18, 0xc6, 0x78, 
+  0xd7, 0xbd, 0xb8, 0xf8, 0xc5, 0xff, 0xf7, 0xc5, 0xff, 0x53, 0xb5, 0xff, 0xec, 0xc3, 0xff, 0x81, 0x80, 0xfb, 0xff, 0x81, 0xa0, 0xfb, 0xff, 0x0e, 0x2a, 0xe4, 0xff, 0x90, 0xac, 0xff, 0xd1, 0xb4, 
+  0xff, 0xb1, 0xac, 0xff, 0x90, 0xac, 0xff, 0xb1, 0xac, 0xff, 0xee, 0xac, 0xff, 0x2c, 0xce, 0xff, 0x6d, 0xbd, 0xff, 0xcc, 0xc5, 0xff, 0xec, 0xcd, 0xff, 0x11, 0xbd, 0xff, 0xce, 0xa4, 0xff, 0x27, 
+  0xe4, 0xff, 0xa0, 0xfb, 0xff, 0x82, 0x80, 0xfb, 0xff, 0x0a, 0xab, 0xc3, 0xff, 0x90, 0xa4, 0xff, 0x13, 0xad, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0x78, 0x76, 0xb5, 0xb8, 0x96, 0xb5, 0xff, 0xf2, 
+  0xac, 0xff, 0x75, 0xb5, 0xff, 0x50, 0xa4, 0xff, 0x60, 0xfb, 0xff, 0x82, 0x80, 0xfb, 0xff, 0x01, 0xa1, 0xfb, 0xff, 0x8e, 0xc4, 0xff, 0x82, 0x2f, 0xa4, 0xff, 0x08, 0x8d, 0xa4, 0xff, 0xab, 0xc5, 
+  0xff, 0x0c, 0xb5, 0xff, 0x4b, 0xb5, 0xff, 0x6b, 0xbd, 0xff, 0xaf, 0xb4, 0xff, 0x6d, 0x9c, 0xff, 0x69, 0xb4, 0xff, 0xc2, 0xfb, 0xff, 0x82, 0x80, 0xfb, 0xff, 0x0c, 0x60, 0xfb, 0xff, 0x4a, 0x9c, 
+  0xff, 0x4f, 0x9c, 0xff, 0xb2, 0xa4, 0xff, 0x96, 0xb5, 0xff, 0x75, 0xad, 0x78, 0x5d, 0xef, 0xb8, 0x7d, 0xef, 0xff, 0x76, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0x3d, 0xef, 0xff, 0x6e, 0xe4, 0xff, 0x60, 
+  0xfb, 0xff, 0x82, 0x80, 0xfb, 0xff, 0x05, 0x06, 0xfc, 0xff, 0x36, 0xe6, 0xff, 0x37, 0xde, 0xff, 0x75, 0xde, 0xff, 0xb3, 0xff, 0xff, 0xd4, 0xee, 0xff, 0x81, 0x53, 0xf7, 0xff, 0x03, 0xb8, 0xee, 
+  0xff, 0x75, 0xd6, 0xff, 0x10, 0xd6, 0xff, 0x26, 0xfc, 0xff, 0x81, 0x80, 0xfb, 0xff, 0x81, 0x60, 0xfb, 0xff, 0x0c, 0x0a, 0xe4, 0xff, 0x32, 0xef, 0xff, 0xf3, 0xe6, 0xff, 0x99, 0xde, 0xff, 0x7d, 
+  0xef, 0xff, 0x3c, 0xe7, 0x78, 0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0xb4, 0xc6, 0xff, 0xb6, 0xd6, 0xff, 0x1a, 0xef, 0xff, 0x38, 0xd6, 0xff, 0x63, 0xfb, 0xff, 0x81, 0x60, 0xfb, 0xff, 0x81, 0x80, 
+  0xfb, 0xff, 0x0a, 0x26, 0xfc, 0xff, 0xf1, 0xf5, 0xff, 0xb3, 0xff, 0xff, 0x15, 0xf7, 0xff, 0x94, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xd8, 0xee, 0xff, 0x96, 0xde, 0xff, 0x0f, 0xe6, 0xff, 0x46, 0xfc, 
+  0xff, 0x80, 0xfb, 0xff, 0x82, 0x60, 0xfb, 0xff, 0x0d, 0x62, 0xfb, 0xff, 0x73, 0xc5, 0xff, 0xf7, 0xee, 0xff, 0xb3, 0xff, 0xff, 0x77, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 
+  0xb8, 0xbe, 0xf7, 0xff, 0x93, 0xc6, 0xff, 0x92, 0xbe, 0xff, 0xb5, 0xd6, 0xff, 0xb9, 0xe6, 0xff, 0xf1, 0xd4, 0xff, 0x84, 0x60, 0xfb, 0xff, 0x07, 0xa3, 0xfb, 0xff, 0xc9, 0xfc, 0xff, 0x0f, 0xfe, 
+  0xff, 0xf2, 0xfe, 0xff, 0x73, 0xfe, 0xff, 0xf1, 0xfd, 0xff, 0xea, 0xfc, 0xff, 0xa3, 0xfb, 0xff, 0x83, 0x60, 0xfb, 0xff, 0x0a, 0x40, 0xfb, 0xff, 0x4a, 0xbc, 0xff, 0x51, 0xbe, 0xff, 0xb7, 0xde, 
+  0xff, 0xf7, 0xee, 0xff, 0x77, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0x93, 0xc6, 0xff, 0x81, 0x91, 0xbe, 0xff, 0x03, 0x95, 0xd6, 0xff, 0x37, 0xd6, 
+  0xff, 0x4e, 0xd4, 0xff, 0x40, 0xfb, 0xff, 0x8c, 0x60, 0xfb, 0xff, 0x81, 0x40, 0xfb, 0xff, 0x01, 0xc8, 0xc3, 0xff, 0xcf, 0xad, 0xff, 0x81, 0x91, 0xbe, 0xff, 0x0c, 0xb7, 0xde, 0xff, 0xfa, 0xee, 
+  0xff, 0xbe, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0x72, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x75, 0xce, 0xff, 0x16, 0xd6, 0xff, 0x4f, 
+  0xcc, 0xff, 0x82, 0x40, 0xfb, 0xff, 0x86, 0x60, 0xfb, 0xff, 0x83, 0x40, 0xfb, 0xff, 0x01, 0xc8, 0xbb, 0xff, 0xae, 0xa5, 0xff, 0x82, 0x70, 0xbe, 0xff, 0x06, 0x71, 0xbe, 0xff, 0xd8, 0xde, 0xff, 
+  0xbe, 0xf7, 0xff, 0x7d, 0xef, 0x78, 0x7e, 0xf7, 0xb8, 0xbe, 0xf7, 0xff, 0x72, 0xbe, 0xff, 0x83, 0x70, 0xb6, 0xff, 0x03, 0x97, 0xe6, 0xff, 0x53, 0xd6, 0xff, 0x2a, 0xc5, 0xff, 0x45, 0xe3, 0xff, 
+  0x89, 0x40, 0xfb, 0xff, 0x02, 0x44, 0xe3, 0xff, 0x2a, 0x9c, 0xff, 0xce, 0xa5, 0xff, 0x84, 0x70, 0xb6, 0xff, 0x11, 0xb6, 0xce, 0xff, 0xbe, 0xf7, 0xff, 0x5d, 0xef, 0x78, 0x7d, 0xef, 0xb8, 0x9e, 
+  0xf7, 0xff, 0x72, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x96, 0xd6, 0xff, 0xf5, 0xee, 0xff, 0xf0, 0xff, 0xff, 0xb1, 0xe6, 0xff, 0x2e, 0xce, 0xff, 0x8a, 0xbc, 0xff, 
+  0x28, 0xd3, 0xff, 0x24, 0xeb, 0xff, 0x20, 0xfb, 0xff, 0x81, 0x40, 0xfb, 0xff, 0x05, 0x20, 0xfb, 0xff, 0x24, 0xeb, 0xff, 0xab, 0xd3, 0xff, 0x0e, 0xb4, 0xff, 0x2f, 0x9d, 0xff, 0x0f, 0xae, 0xff, 
+  0x81, 0x50, 0xb6, 0xff, 0x09, 0x4f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x6f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0xb9, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 
+  0x51, 0xbe, 0xff, 0x81, 0x4f, 0xb6, 0xff, 0x03, 0xb7, 0xde, 0xff, 0xf6, 0xee, 0xff, 0xf0, 0xff, 0xff, 0x12, 0xef, 0xff, 0x81, 0x70, 0xf7, 0xff, 0x03, 0x15, 0xd6, 0xff, 0xd6, 0xc5, 0xff, 0x54, 
+  0xb5, 0xff, 0xed, 0xc3, 0xff, 0x81, 0x20, 0xfb, 0xff, 0x05, 0xed, 0xbb, 0xff, 0xf2, 0xac, 0xff, 0x79, 0xd6, 0xff, 0x5c, 0xef, 0xff, 0xd9, 0xee, 0xff, 0x72, 0xbe, 0xff, 0x84, 0x4f, 0xb6, 0xff, 
+  0x1b, 0x38, 0xae, 0xff, 0x9c, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x51, 0xbe, 0xff, 0x4f, 0xb6, 0xff, 0xf8, 0xde, 0xff, 0x37, 0xf7, 0xff, 0xef, 
+  0xff, 0xff, 0x33, 0xef, 0xff, 0x91, 0xff, 0xff, 0xb1, 0xf7, 0xff, 0x98, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0xda, 0xe6, 0xff, 0xf7, 0xc5, 0xff, 0x68, 0xe3, 0xff, 0x89, 0xe3, 0xff, 
+  0x58, 0xce, 0xff, 0xb9, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x3b, 0xef, 0xff, 0x72, 0xbe, 0xff, 0x81, 0x4f, 0xb6, 0xff, 0x14, 0x4f, 0xae, 0xff, 0x38, 0xae, 0xff, 
+  0x1c, 0xae, 0xff, 0x9c, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x51, 0xbe, 0xff, 0x39, 0xe7, 0xff, 0x79, 0xf7, 0xff, 0xcf, 0xff, 0xff, 0x54, 0xf7, 
+  0xff, 0xb1, 0xff, 0xff, 0xb0, 0xff, 0xff, 0x1a, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xe6, 0xff, 0xdb, 0xe6, 0xff, 0x81, 0x95, 0xc5, 0xff, 0x09, 0xfb, 0xe6, 
+  0xff, 0x1b, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0xfb, 0xe6, 0xff, 0x5d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x93, 0xbe, 0xff, 0x4f, 0xae, 0xff, 0x18, 0xae, 0xff, 0x81, 0x1c, 0xae, 0xff, 
+  0x0c, 0x9c, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0x78, 0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x5b, 0xef, 0xff, 0x9a, 0xf7, 0xff, 0xae, 0xf7, 0xff, 0x54, 0xf7, 0xff, 0xb1, 0xff, 0xff, 0xb0, 
+  0xff, 0xff, 0x1b, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x04, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xfb, 0xde, 0xff, 0x81, 0xfb, 0xe6, 0xff, 
+  0x82, 0x1c, 0xe7, 0xff, 0x0e, 0x9d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0xf9, 0xde, 0xff, 0x1c, 0xdf, 0xff, 0x3d, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 
+  0x5d, 0xef, 0x78, 0x7d, 0xef, 0xb8, 0x9e, 0xf7, 0xff, 0x58, 0xf7, 0xff, 0xef, 0xff, 0xff, 0x54, 0xf7, 0xff, 0x81, 0x91, 0xf7, 0xff, 0x02, 0xfa, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 
+  0x82, 0x3c, 0xef, 0xff, 0x82, 0x5d, 0xef, 0xff, 0x00, 0x7d, 0xef, 0xff, 0x8a, 0x9e, 0xf7, 0xff, 0x05, 0x9e, 0xf7, 0xfc, 0x7d, 0xef, 0xf0, 0x5d, 0xef, 0xe0, 0x1c, 0xe7, 0x63, 0x7d, 0xef, 0xb8, 
+  0x9e, 0xf7, 0xff, 0x81, 0x7c, 0xf7, 0xff, 0x00, 0x7d, 0xf7, 0xff, 0x8a, 0x9e, 0xf7, 0xff, 0x10, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x5d, 0xef, 0xd8, 0x3d, 0xef, 0xc8, 0x1c, 0xe7, 0xb7, 0xfc, 
+  0xe6, 0xa3, 0xfc, 0xe6, 0x8f, 0xbb, 0xde, 0x7b, 0x9a, 0xd6, 0x67, 0x9a, 0xd6, 0x53, 0xd7, 0xbd, 0x3f, 0x51, 0x8c, 0x28, 0x45, 0x29, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 
+  0x7d, 0xef, 0xb8, 0x81, 0x9e, 0xf7, 0xff, 0x11, 0x9e, 0xf7, 0xfc, 0x7d, 0xef, 0xf0, 0x5d, 0xef, 0xe0, 0x5d, 0xef, 0xd0, 0x3c, 0xe7, 0xbf, 0x1c, 0xe7, 0xac, 0x1c, 0xe7, 0x98, 0xdb, 0xde, 0x84, 
+  0x9a, 0xd6, 0x70, 0x9a, 0xd6, 0x5c, 0x39, 0xce, 0x48, 0x34, 0xa5, 0x34, 0x0c, 0x63, 0x1f, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x8a, 0x00, 
+  0x00, 0x00, 0x06, 0x79, 0xce, 0x37, 0xd7, 0xbd, 0x3f, 0x51, 0x8c, 0x28, 0x45, 0x29, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x81, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xea, 0x0b, 0xfd, 0xcd, 0x43, 0xfe, 0x2f, 0x6f, 0xfe, 0x91, 0x83, 0xfe, 0x92, 0x83, 0xfe, 0x50, 0x6c, 0xfe, 0x0e, 0x40, 0xe5, 0x4c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xa6, 0x2f, 0xfc, 0xe7, 0xa3, 0xfc, 0xc7, 0xf4, 0xfc, 0xa6, 0xff, 0xfc, 0x43, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x20, 0xff, 0xfc, 0x43, 0xff, 0xfc, 0xa7, 0xff, 0xfd, 0x09, 0xf4, 0xfd, 0x4a, 0xa3, 0xf5, 0x49, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x40, 0x03, 0x20, 0x61, 0x03, 0x30, 0xa1, 0x03, 0xdb, 0xa2, 0x0c, 0xfc, 0x43, 0x94, 0xfc, 0x43, 0xfc, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x85, 0xfc, 0xfc, 0xe7, 0x93, 0xdc, 0x25, 0x0b, 0x30, 0x81, 0x03, 0x20, 0x61, 0x03, 0x10, 0x20, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-  0xf7, 0xbe, 0xb7, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9d, 0xff, 0xfd, 0x2e, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x01, 0xff, 0xfd, 0x6f, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0x77, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x5c, 0xff, 0xfc, 0xec, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfd, 0x0d, 0xff, 0xf7, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xf7, 0x7c, 0xff, 0xef, 0x5c, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0x7d, 0xff, 0xf7, 0x7c, 0xff, 0xff, 0xbe, 0xff, 0xfd, 0x90, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xdb, 0xe8, 0xff, 0xbc, 0x0c, 0xff, 0xb4, 0x89, 0xff, 0xb4, 0x69, 0xff, 0xbc, 0x0c, 0xff, 0xdb, 0xc8, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfd, 0x4d, 0xff, 0xff, 0xef, 0xff, 0xf7, 0x33, 0xff, 0xff, 0xb1, 0xff, 0xf7, 0x96, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf6, 0x77, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xeb, 0xe7, 0xff, 0xbc, 0xf2, 0xff, 0xd6, 0x58, 0xff, 0xee, 0xda, 0xff, 0xee, 0xf9, 0xff, 0xf7, 0x90, 0xff, 0xee, 0xf1, 0xff, 0xcd, 0xf6, 0xff, 0xb4, 0xb1, 0xff, 0xeb, 0xe7, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x91, 0xff, 0xff, 0xb0, 0xff, 0xe6, 0xd9, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xfc, 0xaa, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xec, 0x08, 0xff, 0xc5, 0xd6, 0xff, 0xf7, 0x3c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xbe, 0xff, 0xe6, 0x96, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x53, 0xff, 0xee, 0xda, 0xff, 0xbd, 0x74, 0xff, 0xec, 0x08, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0xe6, 0xff, 0xf7, 0x90, 0xff, 0xde, 0x77, 0xff, 0xe6, 0xda, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf6, 0x77, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x04, 0xff, 0xc5, 0xb5, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xbe, 0xff, 0xde, 0x78, 0xff, 0xe6, 0x99, 0xff, 0xde, 0x75, 0xff, 0xff, 0xaf, 0xff, 0xf7, 0x73, 0xff, 0xee, 0xfa, 0xff, 0xc5, 0x33, 0xff, 0xfb, 0xe2, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xdd, 0xd4, 0xff, 0xe6, 0xba, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x1a, 0xff, 0xf5, 0x72, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xd4, 0xae, 0xff, 0xee, 0xfb, 0xff, 0xf7, 0x1a, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xbe, 0xff, 0xde, 0x78, 0xff, 0xde, 0x78, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x75, 0xff, 0xff, 0xd0, 0xff, 0xf7, 0x53, 0xff, 0xe6, 0x95, 0xff, 0xdc, 0xa7, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xed, 0x31, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xfb, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xee, 0xfa, 0xff, 0xef, 0x1a, 0xff, 0xf4, 0xce, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xcd, 0xb4, 0xff, 0xf6, 0xfa, 0xff, 0xf7, 0x3c, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x3c, 0xff, 0xde, 0x57, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x55, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xaf, 0xff, 0xcd, 0x8d, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xf4, 0x6c, 0xff, 0xde, 0x57, 0xff, 0xe6, 0xb9, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
-  0xef, 0x5d, 0xb8, 0xf7, 0x7e, 0xff, 0xe6, 0xd9, 0xff, 0xef, 0x1b, 0xff, 0xfc, 0x49, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe3, 0xff, 0xd6, 0x16, 0xff, 0xee, 0xfa, 0xff, 0xef, 0x5d, 0xff, 0xde, 0x37, 0xff, 0xd6, 0x37, 0xff, 0xef, 0x1b, 0xff, 0xd6, 0x17, 0xff, 0xde, 0x99, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x58, 0xff, 0xde, 0x53, 0xff, 0xf7, 0x6f, 0xff, 0xff, 0xaf, 0xff, 0xde, 0xae, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xf4, 0x08, 0xff, 0xd5, 0xf6, 0xff, 0xde, 0x99, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x5d, 0x78, 
-  0xe6, 0xfc, 0xb8, 0xe7, 0x1c, 0xff, 0xe6, 0x99, 0xff, 0xde, 0x98, 0xff, 0xf3, 0xe7, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xf3, 0xe4, 0xff, 0xde, 0xba, 0xff, 0xef, 0x1c, 0xff, 0xcd, 0xd5, 0xff, 0xd6, 0x17, 0xff, 0xd6, 0x16, 0xff, 0xcd, 0xd6, 0xff, 0xce, 0x17, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xf2, 0xff, 0xf7, 0x4e, 0xff, 0xde, 0x70, 0xff, 0xef, 0x0f, 0xff, 0xe6, 0xce, 0xff, 0xfb, 0xe1, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xf3, 0xc6, 0xff, 0xc5, 0x94, 0xff, 0xd6, 0x37, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0x78, 
-  0xd6, 0x9a, 0xb8, 0xde, 0xbb, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xd5, 0xff, 0xf3, 0xe8, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc2, 0xff, 0xd6, 0x59, 0xff, 0xc5, 0x74, 0xff, 0xcd, 0xb5, 0xff, 0xcd, 0xd6, 0xff, 0xcd, 0xf6, 0xff, 0xc5, 0xb5, 0xff, 0xbd, 0x73, 0xff, 0xbd, 0x74, 0xff, 0xc5, 0xb1, 0xff, 0xe6, 0xed, 0xff, 0xd6, 0x2f, 0xff, 0xde, 0x8e, 0xff, 0xe6, 0xae, 0xff, 0xc5, 0x70, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xeb, 0xc8, 0xff, 0xcd, 0xf7, 0xff, 0xc5, 0xb6, 0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0x78, 
-  0xce, 0x39, 0xb8, 0xce, 0x59, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x74, 0xff, 0xe3, 0xea, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xc4, 0x8f, 0xff, 0xbd, 0x33, 0xff, 0xc5, 0x74, 0xff, 0xb5, 0x12, 0xff, 0xbd, 0x33, 0xff, 0xbd, 0x74, 0xff, 0xb5, 0x13, 0xff, 0xbd, 0x4f, 0xff, 0xd6, 0x8c, 0xff, 0xc5, 0xce, 0xff, 0xd6, 0x2d, 0xff, 0xd6, 0x4d, 0xff, 0xcd, 0x72, 0xff, 0xcc, 0xcf, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xdb, 0xea, 0xff, 0xb4, 0xf2, 0xff, 0xbd, 0x74, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0x78, 
-  0xbd, 0xd7, 0xb8, 0xc5, 0xf8, 0xff, 0xc5, 0xf7, 0xff, 0xb5, 0x53, 0xff, 0xc3, 0xec, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xe4, 0x2a, 0xff, 0xac, 0x90, 0xff, 0xb4, 0xd1, 0xff, 0xac, 0xb1, 0xff, 0xac, 0x90, 0xff, 0xac, 0xb1, 0xff, 0xac, 0xee, 0xff, 0xce, 0x2c, 0xff, 0xbd, 0x6d, 0xff, 0xc5, 0xcc, 0xff, 0xcd, 0xec, 0xff, 0xbd, 0x11, 0xff, 0xa4, 0xce, 0xff, 0xe4, 0x27, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xc3, 0xab, 0xff, 0xa4, 0x90, 0xff, 0xad, 0x13, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0x78, 
-  0xb5, 0x76, 0xb8, 0xb5, 0x96, 0xff, 0xac, 0xf2, 0xff, 0xb5, 0x75, 0xff, 0xa4, 0x50, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa1, 0xff, 0xc4, 0x8e, 0xff, 0xa4, 0x2f, 0xff, 0xa4, 0x2f, 0xff, 0xa4, 0x2f, 0xff, 0xa4, 0x8d, 0xff, 0xc5, 0xab, 0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x4b, 0xff, 0xbd, 0x6b, 0xff, 0xb4, 0xaf, 0xff, 0x9c, 0x6d, 0xff, 0xb4, 0x69, 0xff, 0xfb, 0xc2, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0x9c, 0x4a, 0xff, 0x9c, 0x4f, 0xff, 0xa4, 0xb2, 0xff, 0xb5, 0x96, 0xff, 0xad, 0x75, 0x78, 
-  0xef, 0x5d, 0xb8, 0xef, 0x7d, 0xff, 0xd6, 0x76, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x3d, 0xff, 0xe4, 0x6e, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfc, 0x06, 0xff, 0xe6, 0x36, 0xff, 0xde, 0x37, 0xff, 0xde, 0x75, 0xff, 0xff, 0xb3, 0xff, 0xee, 0xd4, 0xff, 0xf7, 0x53, 0xff, 0xf7, 0x53, 0xff, 0xee, 0xb8, 0xff, 0xd6, 0x75, 0xff, 0xd6, 0x10, 0xff, 0xfc, 0x26, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xe4, 0x0a, 0xff, 0xef, 0x32, 0xff, 0xe6, 0xf3, 0xff, 0xde, 0x99, 0xff, 0xef, 0x7d, 0xff, 0xe7, 0x3c, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xc6, 0xb4, 0xff, 0xd6, 0xb6, 0xff, 0xef, 0x1a, 0xff, 0xd6, 0x38, 0xff, 0xfb, 0x63, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfc, 0x26, 0xff, 0xf5, 0xf1, 0xff, 0xff, 0xb3, 0xff, 0xf7, 0x15, 0xff, 0xff, 0x94, 0xff, 0xff, 0xb4, 0xff, 0xee, 0xd8, 0xff, 0xde, 0x96, 0xff, 0xe6, 0x0f, 0xff, 0xfc, 0x46, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x62, 0xff, 0xc5, 0x73, 0xff, 0xee, 0xf7, 0xff, 0xff, 0xb3, 0xff, 0xf7, 0x77, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xc6, 0x93, 0xff, 0xbe, 0x92, 0xff, 0xd6, 0xb5, 0xff, 0xe6, 0xb9, 0xff, 0xd4, 0xf1, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0xa3, 0xff, 0xfc, 0xc9, 0xff, 0xfe, 0x0f, 0xff, 0xfe, 0xf2, 0xff, 0xfe, 0x73, 0xff, 0xfd, 0xf1, 0xff, 0xfc, 0xea, 0xff, 0xfb, 0xa3, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x40, 0xff, 0xbc, 0x4a, 0xff, 0xbe, 0x51, 0xff, 0xde, 0xb7, 0xff, 0xee, 0xf7, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xc6, 0x93, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xd6, 0x95, 0xff, 0xd6, 0x37, 0xff, 0xd4, 0x4e, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xc3, 0xc8, 0xff, 0xad, 0xcf, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xde, 0xb7, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xbe, 0x72, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x70, 0xff, 0xce, 0x75, 0xff, 0xd6, 0x16, 0xff, 0xcc, 0x4f, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xbb, 0xc8, 0xff, 0xa5, 0xae, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x71, 0xff, 0xde, 0xd8, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x7d, 0x78, 
-  0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xbe, 0x72, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xe6, 0x97, 0xff, 0xd6, 0x53, 0xff, 0xc5, 0x2a, 0xff, 0xe3, 0x45, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xe3, 0x44, 0xff, 0x9c, 0x2a, 0xff, 0xa5, 0xce, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xce, 0xb6, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x5d, 0x78, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xbe, 0x72, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x50, 0xff, 0xd6, 0x96, 0xff, 0xee, 0xf5, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0xb1, 0xff, 0xce, 0x2e, 0xff, 0xbc, 0x8a, 0xff, 0xd3, 0x28, 0xff, 0xeb, 0x24, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x20, 0xff, 0xeb, 0x24, 0xff, 0xd3, 0xab, 0xff, 0xb4, 0x0e, 0xff, 0x9d, 0x2f, 0xff, 0xae, 0x0f, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x6f, 0xff, 0xb6, 0x50, 0xff, 0xce, 0xb9, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xbe, 0x51, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xde, 0xb7, 0xff, 0xee, 0xf6, 0xff, 0xff, 0xf0, 0xff, 0xef, 0x12, 0xff, 0xf7, 0x70, 0xff, 0xf7, 0x70, 0xff, 0xd6, 0x15, 0xff, 0xc5, 0xd6, 0xff, 0xb5, 0x54, 0xff, 0xc3, 0xed, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xbb, 0xed, 0xff, 0xac, 0xf2, 0xff, 0xd6, 0x79, 0xff, 0xef, 0x5c, 0xff, 0xee, 0xd9, 0xff, 0xbe, 0x72, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xae, 0x38, 0xff, 0xce, 0x9c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xbe, 0x51, 0xff, 0xb6, 0x4f, 0xff, 0xde, 0xf8, 0xff, 0xf7, 0x37, 0xff, 0xff, 0xef, 0xff, 0xef, 0x33, 0xff, 0xff, 0x91, 0xff, 0xf7, 0xb1, 0xff, 0xde, 0x98, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x1b, 0xff, 0xe6, 0xda, 0xff, 0xc5, 0xf7, 0xff, 0xe3, 0x68, 0xff, 0xe3, 0x89, 0xff, 0xce, 0x58, 0xff, 0xde, 0xb9, 0xff, 0xe6, 0xfb, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x5d, 0xff, 0xef, 0x3b, 0xff, 0xbe, 0x72, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x38, 0xff, 0xae, 0x1c, 0xff, 0xce, 0x9c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xbe, 0x51, 0xff, 0xe7, 0x39, 0xff, 0xf7, 0x79, 0xff, 0xff, 0xcf, 0xff, 0xf7, 0x54, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xb0, 0xff, 0xe7, 0x1a, 0xff, 0xef, 0x3c, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xdb, 0xff, 0xc5, 0x95, 0xff, 0xc5, 0x95, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x3c, 0xff, 0xe6, 0xfb, 0xff, 0xf7, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xbe, 0x93, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x18, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xce, 0x9c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xef, 0x5b, 0xff, 0xf7, 0x9a, 0xff, 0xf7, 0xae, 0xff, 0xf7, 0x54, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xb0, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xde, 0xf9, 0xff, 0xdf, 0x1c, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x58, 0xff, 0xff, 0xef, 0xff, 0xf7, 0x54, 0xff, 0xf7, 0x91, 0xff, 0xf7, 0x91, 0xff, 0xe6, 0xfa, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xfc, 0xef, 0x7d, 0xf0, 0xef, 0x5d, 0xe0, 0xe7, 0x1c, 0x63, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7c, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xef, 0x5d, 0xd8, 0xef, 0x3d, 0xc8, 0xe7, 0x1c, 0xb7, 0xe6, 0xfc, 0xa3, 0xe6, 0xfc, 0x8f, 0xde, 0xbb, 0x7b, 0xd6, 0x9a, 0x67, 0xd6, 0x9a, 0x53, 0xbd, 0xd7, 0x3f, 0x8c, 0x51, 0x28, 0x29, 0x45, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 
-  0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xfc, 0xef, 0x7d, 0xf0, 0xef, 0x5d, 0xe0, 0xef, 0x5d, 0xd0, 0xe7, 0x3c, 0xbf, 0xe7, 0x1c, 0xac, 0xe7, 0x1c, 0x98, 0xde, 0xdb, 0x84, 0xd6, 0x9a, 0x70, 0xd6, 0x9a, 0x5c, 0xce, 0x39, 0x48, 0xa5, 0x34, 0x34, 0x63, 0x0c, 0x1f, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xce, 0x79, 0x37, 0xbd, 0xd7, 0x3f, 0x8c, 0x51, 0x28, 0x29, 0x45, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8b, 0x00, 0x00, 0x00, 0x07, 0xe4, 0xea, 0x0b, 0xfd, 0xcd, 0x43, 0xfe, 0x2f, 0x6f, 0xfe, 0x91, 0x83, 0xfe, 0x92, 0x83, 0xfe, 0x50, 0x6c, 0xfe, 0x0e, 0x40, 0xe5, 0x4c, 
+  0x0b, 0x95, 0x00, 0x00, 0x00, 0x0b, 0xf4, 0xa6, 0x2f, 0xfc, 0xe7, 0xa3, 0xfc, 0xc7, 0xf4, 0xfc, 0xa6, 0xff, 0xfc, 0x43, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x20, 0xff, 0xfc, 0x43, 0xff, 0xfc, 0xa7, 
+  0xff, 0xfd, 0x09, 0xf4, 0xfd, 0x4a, 0xa3, 0xf5, 0x49, 0x2c, 0x8a, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x03, 0x05, 0x10, 0x40, 0x03, 0x20, 0x61, 0x03, 0x30, 0xa1, 0x03, 0xdb, 0xa2, 0x0c, 0xfc, 
+  0x43, 0x94, 0xfc, 0x43, 0xfc, 0x89, 0xfc, 0x00, 0xff, 0x05, 0xfc, 0x85, 0xfc, 0xfc, 0xe7, 0x93, 0xdc, 0x25, 0x0b, 0x30, 0x81, 0x03, 0x20, 0x61, 0x03, 0x10, 0x20, 0x03, 0x83, 0x00, 0x00, 0x03, 
+  0x01, 0x00, 0x00, 0x00, 0xf7, 0xbe, 0xb7, 0x85, 0xff, 0xbf, 0xff, 0x01, 0xff, 0x9d, 0xff, 0xfd, 0x2e, 0xff, 0x8c, 0xfc, 0x00, 0xff, 0x02, 0xfc, 0x01, 0xff, 0xfd, 0x6f, 0xff, 0xff, 0x9d, 0xff, 
+  0x85, 0xff, 0xbf, 0xff, 0x04, 0xf7, 0x9e, 0x77, 0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0x81, 0xf7, 0x7d, 0xff, 0x01, 0xf7, 0x5c, 0xff, 0xfc, 0xec, 0xff, 0x8f, 
+  0xfc, 0x00, 0xff, 0x0e, 0xfd, 0x0d, 0xff, 0xf7, 0x5c, 0xff, 0xef, 0x5c, 0xff, 0xf7, 0x7c, 0xff, 0xef, 0x5c, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 
+  0x9e, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0x7d, 0xff, 0xf7, 0x7c, 0xff, 0xff, 0xbe, 0xff, 0xfd, 0x90, 0xff, 0x84, 0xfc, 0x00, 0xff, 0x07, 0xfb, 0xe0, 0xff, 0xdb, 0xe8, 0xff, 0xbc, 0x0c, 0xff, 0xb4, 
+  0x89, 0xff, 0xb4, 0x69, 0xff, 0xbc, 0x0c, 0xff, 0xdb, 0xc8, 0xff, 0xfb, 0xe0, 0xff, 0x84, 0xfc, 0x00, 0xff, 0x0c, 0xfd, 0x4d, 0xff, 0xff, 0xef, 0xff, 0xf7, 0x33, 0xff, 0xff, 0xb1, 0xff, 0xf7, 
+  0x96, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf6, 0x77, 0xff, 0x84, 0xfc, 0x00, 0xff, 0x09, 0xeb, 
+  0xe7, 0xff, 0xbc, 0xf2, 0xff, 0xd6, 0x58, 0xff, 0xee, 0xda, 0xff, 0xee, 0xf9, 0xff, 0xf7, 0x90, 0xff, 0xee, 0xf1, 0xff, 0xcd, 0xf6, 0xff, 0xb4, 0xb1, 0xff, 0xeb, 0xe7, 0xff, 0x83, 0xfc, 0x00, 
+  0xff, 0x0d, 0xfb, 0xe0, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x91, 0xff, 0xff, 0xb0, 0xff, 0xe6, 0xd9, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 
+  0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xfc, 0xaa, 0xff, 0xfb, 0xe0, 0xff, 0x82, 0xfc, 0x00, 0xff, 0x0b, 0xec, 0x08, 0xff, 0xc5, 0xd6, 0xff, 0xf7, 0x3c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 
+  0xff, 0xbe, 0xff, 0xe6, 0x96, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x53, 0xff, 0xee, 0xda, 0xff, 0xbd, 0x74, 0xff, 0xec, 0x08, 0xff, 0x81, 0xfc, 0x00, 0xff, 0x81, 0xfb, 0xe0, 0xff, 0x0a, 0xfc, 0xe6, 
+  0xff, 0xf7, 0x90, 0xff, 0xde, 0x77, 0xff, 0xe6, 0xda, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf6, 0x77, 0xff, 0x82, 
+  0xfb, 0xe0, 0xff, 0x0e, 0xfc, 0x00, 0xff, 0xfc, 0x04, 0xff, 0xc5, 0xb5, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xbe, 0xff, 0xde, 0x78, 0xff, 0xe6, 0x99, 0xff, 0xde, 
+  0x75, 0xff, 0xff, 0xaf, 0xff, 0xf7, 0x73, 0xff, 0xee, 0xfa, 0xff, 0xc5, 0x33, 0xff, 0xfb, 0xe2, 0xff, 0x82, 0xfb, 0xe0, 0xff, 0x0b, 0xfb, 0xc0, 0xff, 0xdd, 0xd4, 0xff, 0xe6, 0xba, 0xff, 0xef, 
+  0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x1a, 0xff, 0xf5, 0x72, 0xff, 0xfb, 0xc0, 0xff, 0x82, 0xfb, 0xe0, 0xff, 0x04, 0xd4, 
+  0xae, 0xff, 0xee, 0xfb, 0xff, 0xf7, 0x1a, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xbe, 0xff, 0x81, 0xde, 0x78, 0xff, 0x06, 0xe6, 0xda, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x75, 0xff, 0xff, 0xd0, 0xff, 0xf7, 
+  0x53, 0xff, 0xe6, 0x95, 0xff, 0xdc, 0xa7, 0xff, 0x81, 0xfb, 0xe0, 0xff, 0x81, 0xfb, 0xc0, 0xff, 0x09, 0xed, 0x31, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xfb, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 
+  0xf7, 0x7e, 0xb8, 0xf7, 0x9e, 0xff, 0xee, 0xfa, 0xff, 0xef, 0x1a, 0xff, 0xf4, 0xce, 0xff, 0x81, 0xfb, 0xc0, 0xff, 0x81, 0xfb, 0xe0, 0xff, 0x05, 0xcd, 0xb4, 0xff, 0xf6, 0xfa, 0xff, 0xf7, 0x3c, 
+  0xff, 0xff, 0xbe, 0xff, 0xef, 0x3c, 0xff, 0xde, 0x57, 0xff, 0x82, 0xe6, 0xda, 0xff, 0x05, 0xe6, 0xb9, 0xff, 0xde, 0x55, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xaf, 0xff, 0xcd, 0x8d, 0xff, 0xfb, 0xe0, 
+  0xff, 0x81, 0xfb, 0xc0, 0xff, 0x0a, 0xfb, 0xa0, 0xff, 0xf4, 0x6c, 0xff, 0xde, 0x57, 0xff, 0xe6, 0xb9, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0x78, 0xef, 0x5d, 0xb8, 0xf7, 0x7e, 0xff, 0xe6, 0xd9, 
+  0xff, 0xef, 0x1b, 0xff, 0xfc, 0x49, 0xff, 0x82, 0xfb, 0xc0, 0xff, 0x0e, 0xfb, 0xe3, 0xff, 0xd6, 0x16, 0xff, 0xee, 0xfa, 0xff, 0xef, 0x5d, 0xff, 0xde, 0x37, 0xff, 0xd6, 0x37, 0xff, 0xef, 0x1b, 
+  0xff, 0xd6, 0x17, 0xff, 0xde, 0x99, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x58, 0xff, 0xde, 0x53, 0xff, 0xf7, 0x6f, 0xff, 0xff, 0xaf, 0xff, 0xde, 0xae, 0xff, 0x81, 0xfb, 0xc0, 0xff, 0x81, 0xfb, 0xa0, 
+  0xff, 0x0a, 0xf4, 0x08, 0xff, 0xd5, 0xf6, 0xff, 0xde, 0x99, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x5d, 0x78, 0xe6, 0xfc, 0xb8, 0xe7, 0x1c, 0xff, 0xe6, 0x99, 0xff, 0xde, 0x98, 0xff, 0xf3, 0xe7, 0xff, 
+  0xfb, 0xa0, 0xff, 0x81, 0xfb, 0xc0, 0xff, 0x0f, 0xf3, 0xe4, 0xff, 0xde, 0xba, 0xff, 0xef, 0x1c, 0xff, 0xcd, 0xd5, 0xff, 0xd6, 0x17, 0xff, 0xd6, 0x16, 0xff, 0xcd, 0xd6, 0xff, 0xce, 0x17, 0xff, 
+  0xcd, 0xd5, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xf2, 0xff, 0xf7, 0x4e, 0xff, 0xde, 0x70, 0xff, 0xef, 0x0f, 0xff, 0xe6, 0xce, 0xff, 0xfb, 0xe1, 0xff, 0x82, 0xfb, 0xa0, 0xff, 0x09, 0xf3, 0xc6, 0xff, 
+  0xc5, 0x94, 0xff, 0xd6, 0x37, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0x78, 0xd6, 0x9a, 0xb8, 0xde, 0xbb, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xd5, 0xff, 0xf3, 0xe8, 0xff, 0x82, 0xfb, 0xa0, 0xff, 0x0f, 
+  0xfb, 0xc2, 0xff, 0xd6, 0x59, 0xff, 0xc5, 0x74, 0xff, 0xcd, 0xb5, 0xff, 0xcd, 0xd6, 0xff, 0xcd, 0xf6, 0xff, 0xc5, 0xb5, 0xff, 0xbd, 0x73, 0xff, 0xbd, 0x74, 0xff, 0xc5, 0xb1, 0xff, 0xe6, 0xed, 
+  0xff, 0xd6, 0x2f, 0xff, 0xde, 0x8e, 0xff, 0xe6, 0xae, 0xff, 0xc5, 0x70, 0xff, 0xfb, 0xc0, 0xff, 0x81, 0xfb, 0xa0, 0xff, 0x0b, 0xfb, 0x80, 0xff, 0xeb, 0xc8, 0xff, 0xcd, 0xf7, 0xff, 0xc5, 0xb6, 
+  0xff, 0xde, 0xbb, 0xff, 0xd6, 0x9a, 0x78, 0xce, 0x39, 0xb8, 0xce, 0x59, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x74, 0xff, 0xe3, 0xea, 0xff, 0xfb, 0x80, 0xff, 0x82, 0xfb, 0xa0, 0xff, 0x0d, 0xc4, 0x8f, 
+  0xff, 0xbd, 0x33, 0xff, 0xc5, 0x74, 0xff, 0xb5, 0x12, 0xff, 0xbd, 0x33, 0xff, 0xbd, 0x74, 0xff, 0xb5, 0x13, 0xff, 0xbd, 0x4f, 0xff, 0xd6, 0x8c, 0xff, 0xc5, 0xce, 0xff, 0xd6, 0x2d, 0xff, 0xd6, 
+  0x4d, 0xff, 0xcd, 0x72, 0xff, 0xcc, 0xcf, 0xff, 0x81, 0xfb, 0xa0, 0xff, 0x81, 0xfb, 0x80, 0xff, 0x09, 0xdb, 0xea, 0xff, 0xb4, 0xf2, 0xff, 0xbd, 0x74, 0xff, 0xce, 0x59, 0xff, 0xc6, 0x18, 0x78, 
+  0xbd, 0xd7, 0xb8, 0xc5, 0xf8, 0xff, 0xc5, 0xf7, 0xff, 0xb5, 0x53, 0xff, 0xc3, 0xec, 0xff, 0x81, 0xfb, 0x80, 0xff, 0x81, 0xfb, 0xa0, 0xff, 0x0e, 0xe4, 0x2a, 0xff, 0xac, 0x90, 0xff, 0xb4, 0xd1, 
+  0xff, 0xac, 0xb1, 0xff, 0xac, 0x90, 0xff, 0xac, 0xb1, 0xff, 0xac, 0xee, 0xff, 0xce, 0x2c, 0xff, 0xbd, 0x6d, 0xff, 0xc5, 0xcc, 0xff, 0xcd, 0xec, 0xff, 0xbd, 0x11, 0xff, 0xa4, 0xce, 0xff, 0xe4, 
+  0x27, 0xff, 0xfb, 0xa0, 0xff, 0x82, 0xfb, 0x80, 0xff, 0x0a, 0xc3, 0xab, 0xff, 0xa4, 0x90, 0xff, 0xad, 0x13, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0x78, 0xb5, 0x76, 0xb8, 0xb5, 0x96, 0xff, 0xac, 
+  0xf2, 0xff, 0xb5, 0x75, 0xff, 0xa4, 0x50, 0xff, 0xfb, 0x60, 0xff, 0x82, 0xfb, 0x80, 0xff, 0x01, 0xfb, 0xa1, 0xff, 0xc4, 0x8e, 0xff, 0x82, 0xa4, 0x2f, 0xff, 0x08, 0xa4, 0x8d, 0xff, 0xc5, 0xab, 
+  0xff, 0xb5, 0x0c, 0xff, 0xb5, 0x4b, 0xff, 0xbd, 0x6b, 0xff, 0xb4, 0xaf, 0xff, 0x9c, 0x6d, 0xff, 0xb4, 0x69, 0xff, 0xfb, 0xc2, 0xff, 0x82, 0xfb, 0x80, 0xff, 0x0c, 0xfb, 0x60, 0xff, 0x9c, 0x4a, 
+  0xff, 0x9c, 0x4f, 0xff, 0xa4, 0xb2, 0xff, 0xb5, 0x96, 0xff, 0xad, 0x75, 0x78, 0xef, 0x5d, 0xb8, 0xef, 0x7d, 0xff, 0xd6, 0x76, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x3d, 0xff, 0xe4, 0x6e, 0xff, 0xfb, 
+  0x60, 0xff, 0x82, 0xfb, 0x80, 0xff, 0x05, 0xfc, 0x06, 0xff, 0xe6, 0x36, 0xff, 0xde, 0x37, 0xff, 0xde, 0x75, 0xff, 0xff, 0xb3, 0xff, 0xee, 0xd4, 0xff, 0x81, 0xf7, 0x53, 0xff, 0x03, 0xee, 0xb8, 
+  0xff, 0xd6, 0x75, 0xff, 0xd6, 0x10, 0xff, 0xfc, 0x26, 0xff, 0x81, 0xfb, 0x80, 0xff, 0x81, 0xfb, 0x60, 0xff, 0x0c, 0xe4, 0x0a, 0xff, 0xef, 0x32, 0xff, 0xe6, 0xf3, 0xff, 0xde, 0x99, 0xff, 0xef, 
+  0x7d, 0xff, 0xe7, 0x3c, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xc6, 0xb4, 0xff, 0xd6, 0xb6, 0xff, 0xef, 0x1a, 0xff, 0xd6, 0x38, 0xff, 0xfb, 0x63, 0xff, 0x81, 0xfb, 0x60, 0xff, 0x81, 0xfb, 
+  0x80, 0xff, 0x0a, 0xfc, 0x26, 0xff, 0xf5, 0xf1, 0xff, 0xff, 0xb3, 0xff, 0xf7, 0x15, 0xff, 0xff, 0x94, 0xff, 0xff, 0xb4, 0xff, 0xee, 0xd8, 0xff, 0xde, 0x96, 0xff, 0xe6, 0x0f, 0xff, 0xfc, 0x46, 
+  0xff, 0xfb, 0x80, 0xff, 0x82, 0xfb, 0x60, 0xff, 0x0d, 0xfb, 0x62, 0xff, 0xc5, 0x73, 0xff, 0xee, 0xf7, 0xff, 0xff, 0xb3, 0xff, 0xf7, 0x77, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 
+  0xb8, 0xf7, 0xbe, 0xff, 0xc6, 0x93, 0xff, 0xbe, 0x92, 0xff, 0xd6, 0xb5, 0xff, 0xe6, 0xb9, 0xff, 0xd4, 0xf1, 0xff, 0x84, 0xfb, 0x60, 0xff, 0x07, 0xfb, 0xa3, 0xff, 0xfc, 0xc9, 0xff, 0xfe, 0x0f, 
+  0xff, 0xfe, 0xf2, 0xff, 0xfe, 0x73, 0xff, 0xfd, 0xf1, 0xff, 0xfc, 0xea, 0xff, 0xfb, 0xa3, 0xff, 0x83, 0xfb, 0x60, 0xff, 0x0a, 0xfb, 0x40, 0xff, 0xbc, 0x4a, 0xff, 0xbe, 0x51, 0xff, 0xde, 0xb7, 
+  0xff, 0xee, 0xf7, 0xff, 0xf7, 0x77, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xc6, 0x93, 0xff, 0x81, 0xbe, 0x91, 0xff, 0x03, 0xd6, 0x95, 0xff, 0xd6, 0x37, 
+  0xff, 0xd4, 0x4e, 0xff, 0xfb, 0x40, 0xff, 0x8c, 0xfb, 0x60, 0xff, 0x81, 0xfb, 0x40, 0xff, 0x01, 0xc3, 0xc8, 0xff, 0xad, 0xcf, 0xff, 0x81, 0xbe, 0x91, 0xff, 0x0c, 0xde, 0xb7, 0xff, 0xee, 0xfa, 
+  0xff, 0xf7, 0xbe, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xbe, 0x72, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x70, 0xff, 0xce, 0x75, 0xff, 0xd6, 0x16, 0xff, 0xcc, 
+  0x4f, 0xff, 0x82, 0xfb, 0x40, 0xff, 0x86, 0xfb, 0x60, 0xff, 0x83, 0xfb, 0x40, 0xff, 0x01, 0xbb, 0xc8, 0xff, 0xa5, 0xae, 0xff, 0x82, 0xbe, 0x70, 0xff, 0x06, 0xbe, 0x71, 0xff, 0xde, 0xd8, 0xff, 
+  0xf7, 0xbe, 0xff, 0xef, 0x7d, 0x78, 0xf7, 0x7e, 0xb8, 0xf7, 0xbe, 0xff, 0xbe, 0x72, 0xff, 0x83, 0xb6, 0x70, 0xff, 0x03, 0xe6, 0x97, 0xff, 0xd6, 0x53, 0xff, 0xc5, 0x2a, 0xff, 0xe3, 0x45, 0xff, 
+  0x89, 0xfb, 0x40, 0xff, 0x02, 0xe3, 0x44, 0xff, 0x9c, 0x2a, 0xff, 0xa5, 0xce, 0xff, 0x84, 0xb6, 0x70, 0xff, 0x11, 0xce, 0xb6, 0xff, 0xf7, 0xbe, 0xff, 0xef, 0x5d, 0x78, 0xef, 0x7d, 0xb8, 0xf7, 
+  0x9e, 0xff, 0xbe, 0x72, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x50, 0xff, 0xd6, 0x96, 0xff, 0xee, 0xf5, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0xb1, 0xff, 0xce, 0x2e, 0xff, 0xbc, 0x8a, 0xff, 
+  0xd3, 0x28, 0xff, 0xeb, 0x24, 0xff, 0xfb, 0x20, 0xff, 0x81, 0xfb, 0x40, 0xff, 0x05, 0xfb, 0x20, 0xff, 0xeb, 0x24, 0xff, 0xd3, 0xab, 0xff, 0xb4, 0x0e, 0xff, 0x9d, 0x2f, 0xff, 0xae, 0x0f, 0xff, 
+  0x81, 0xb6, 0x50, 0xff, 0x09, 0xb6, 0x4f, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x6f, 0xff, 0xb6, 0x50, 0xff, 0xce, 0xb9, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 
+  0xbe, 0x51, 0xff, 0x81, 0xb6, 0x4f, 0xff, 0x03, 0xde, 0xb7, 0xff, 0xee, 0xf6, 0xff, 0xff, 0xf0, 0xff, 0xef, 0x12, 0xff, 0x81, 0xf7, 0x70, 0xff, 0x03, 0xd6, 0x15, 0xff, 0xc5, 0xd6, 0xff, 0xb5, 
+  0x54, 0xff, 0xc3, 0xed, 0xff, 0x81, 0xfb, 0x20, 0xff, 0x05, 0xbb, 0xed, 0xff, 0xac, 0xf2, 0xff, 0xd6, 0x79, 0xff, 0xef, 0x5c, 0xff, 0xee, 0xd9, 0xff, 0xbe, 0x72, 0xff, 0x84, 0xb6, 0x4f, 0xff, 
+  0x1b, 0xae, 0x38, 0xff, 0xce, 0x9c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xbe, 0x51, 0xff, 0xb6, 0x4f, 0xff, 0xde, 0xf8, 0xff, 0xf7, 0x37, 0xff, 0xff, 
+  0xef, 0xff, 0xef, 0x33, 0xff, 0xff, 0x91, 0xff, 0xf7, 0xb1, 0xff, 0xde, 0x98, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x1b, 0xff, 0xe6, 0xda, 0xff, 0xc5, 0xf7, 0xff, 0xe3, 0x68, 0xff, 0xe3, 0x89, 0xff, 
+  0xce, 0x58, 0xff, 0xde, 0xb9, 0xff, 0xe6, 0xfb, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x5d, 0xff, 0xef, 0x3b, 0xff, 0xbe, 0x72, 0xff, 0x81, 0xb6, 0x4f, 0xff, 0x14, 0xae, 0x4f, 0xff, 0xae, 0x38, 0xff, 
+  0xae, 0x1c, 0xff, 0xce, 0x9c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xbe, 0x51, 0xff, 0xe7, 0x39, 0xff, 0xf7, 0x79, 0xff, 0xff, 0xcf, 0xff, 0xf7, 0x54, 
+  0xff, 0xff, 0xb1, 0xff, 0xff, 0xb0, 0xff, 0xe7, 0x1a, 0xff, 0xef, 0x3c, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xdb, 0xff, 0x81, 0xc5, 0x95, 0xff, 0x09, 0xe6, 0xfb, 
+  0xff, 0xe7, 0x1b, 0xff, 0xef, 0x3c, 0xff, 0xe6, 0xfb, 0xff, 0xf7, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xbe, 0x93, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x18, 0xff, 0x81, 0xae, 0x1c, 0xff, 
+  0x0c, 0xce, 0x9c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0x78, 0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xef, 0x5b, 0xff, 0xf7, 0x9a, 0xff, 0xf7, 0xae, 0xff, 0xf7, 0x54, 0xff, 0xff, 0xb1, 0xff, 0xff, 
+  0xb0, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x3c, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x04, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0xde, 0xfb, 0xff, 0x81, 0xe6, 0xfb, 0xff, 
+  0x82, 0xe7, 0x1c, 0xff, 0x0e, 0xf7, 0x9d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xde, 0xf9, 0xff, 0xdf, 0x1c, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 
+  0xef, 0x5d, 0x78, 0xef, 0x7d, 0xb8, 0xf7, 0x9e, 0xff, 0xf7, 0x58, 0xff, 0xff, 0xef, 0xff, 0xf7, 0x54, 0xff, 0x81, 0xf7, 0x91, 0xff, 0x02, 0xe6, 0xfa, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 
+  0x82, 0xef, 0x3c, 0xff, 0x82, 0xef, 0x5d, 0xff, 0x00, 0xef, 0x7d, 0xff, 0x8a, 0xf7, 0x9e, 0xff, 0x05, 0xf7, 0x9e, 0xfc, 0xef, 0x7d, 0xf0, 0xef, 0x5d, 0xe0, 0xe7, 0x1c, 0x63, 0xef, 0x7d, 0xb8, 
+  0xf7, 0x9e, 0xff, 0x81, 0xf7, 0x7c, 0xff, 0x00, 0xf7, 0x7d, 0xff, 0x8a, 0xf7, 0x9e, 0xff, 0x10, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xef, 0x5d, 0xd8, 0xef, 0x3d, 0xc8, 0xe7, 0x1c, 0xb7, 0xe6, 
+  0xfc, 0xa3, 0xe6, 0xfc, 0x8f, 0xde, 0xbb, 0x7b, 0xd6, 0x9a, 0x67, 0xd6, 0x9a, 0x53, 0xbd, 0xd7, 0x3f, 0x8c, 0x51, 0x28, 0x29, 0x45, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x03, 
+  0xef, 0x7d, 0xb8, 0x81, 0xf7, 0x9e, 0xff, 0x11, 0xf7, 0x9e, 0xfc, 0xef, 0x7d, 0xf0, 0xef, 0x5d, 0xe0, 0xef, 0x5d, 0xd0, 0xe7, 0x3c, 0xbf, 0xe7, 0x1c, 0xac, 0xe7, 0x1c, 0x98, 0xde, 0xdb, 0x84, 
+  0xd6, 0x9a, 0x70, 0xd6, 0x9a, 0x5c, 0xce, 0x39, 0x48, 0xa5, 0x34, 0x34, 0x63, 0x0c, 0x1f, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x8a, 0x00, 
+  0x00, 0x00, 0x06, 0xce, 0x79, 0x37, 0xbd, 0xd7, 0x3f, 0x8c, 0x51, 0x28, 0x29, 0x45, 0x17, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x81, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x9d, 0xdf, 0x0b, 0x65, 0xb8, 0xf9, 0x43, 0x78, 0xc4, 0xfb, 0x6f, 0x8a, 0xcf, 0xfd, 0x83, 0x8d, 0xd1, 0xfd, 0x83, 0x80, 0xc9, 0xfb, 0x6c, 0x72, 0xc0, 0xf9, 0x40, 0x5f, 0xa7, 0xdf, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x96, 0xf4, 0x2f, 0x38, 0x9d, 0xfc, 0xa3, 0x39, 0x9a, 0xfe, 0xf4, 0x31, 0x93, 0xff, 0xff, 0x18, 0x88, 0xff, 0xff, 0x04, 0x82, 0xff, 0xff, 0x04, 0x83, 0xff, 0xff, 0x1a, 0x89, 0xff, 0xff, 0x39, 0x95, 0xff, 0xff, 0x46, 0xa1, 0xfe, 0xf4, 0x4d, 0xa9, 0xfc, 0xa3, 0x4c, 0xa7, 0xf4, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03, 0x02, 0x07, 0x12, 0x03, 0x06, 0x0d, 0x24, 0x03, 0x08, 0x13, 0x32, 0x03, 0x0d, 0x73, 0xd9, 0x0c, 0x17, 0x8a, 0xfb, 0x94, 0x16, 0x89, 0xff, 0xfc, 0x01, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x02, 0x81, 0xff, 0xff, 0x28, 0x91, 0xff, 0xfc, 0x36, 0x9b, 0xfb, 0x93, 0x2c, 0x85, 0xd6, 0x0b, 0x08, 0x12, 0x31, 0x03, 0x05, 0x0d, 0x22, 0x03, 0x02, 0x06, 0x10, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0xf3, 0xf3, 0xf3, 0xb7, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xea, 0xef, 0xf7, 0xff, 0x70, 0xa4, 0xfe, 0xff, 0x01, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x06, 0x82, 0xff, 0xff, 0x78, 0xad, 0xfe, 0xff, 0xeb, 0xf0, 0xf7, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xf1, 0xf1, 0xf1, 0x77, 
-  0xee, 0xee, 0xee, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xe8, 0xeb, 0xed, 0xff, 0xe7, 0xea, 0xec, 0xff, 0xe8, 0xeb, 0xee, 0xff, 0xe8, 0xeb, 0xee, 0xff, 0xe1, 0xe7, 0xef, 0xff, 0x63, 0x9d, 0xfc, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x69, 0xa2, 0xfc, 0xff, 0xe2, 0xe7, 0xee, 0xff, 0xe0, 0xea, 0xec, 0xff, 0xdf, 0xec, 0xee, 0xff, 0xe2, 0xe8, 0xeb, 0xff, 0xe6, 0xee, 0xef, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0x78, 
-  0xee, 0xee, 0xee, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xdf, 0xe9, 0xf2, 0xff, 0xe5, 0xee, 0xf8, 0xff, 0xe4, 0xec, 0xf4, 0xff, 0xed, 0xf3, 0xfa, 0xff, 0x83, 0xb0, 0xfc, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x03, 0x7e, 0xfb, 0xff, 0x44, 0x7c, 0xda, 0xff, 0x63, 0x81, 0xbb, 0xff, 0x47, 0x8f, 0xb1, 0xff, 0x48, 0x8d, 0xb1, 0xff, 0x62, 0x7f, 0xbc, 0xff, 0x3f, 0x7a, 0xdb, 0xff, 0x02, 0x7e, 0xfc, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x67, 0xaa, 0xf8, 0xff, 0x79, 0xfb, 0xfd, 0xff, 0x96, 0xe4, 0xed, 0xff, 0x85, 0xf3, 0xf7, 0xff, 0xaf, 0xf2, 0xf3, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0x78, 
-  0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xdc, 0xe6, 0xf1, 0xff, 0xdd, 0xe7, 0xf2, 0xff, 0xdc, 0xe5, 0xf1, 0xff, 0xb6, 0xcc, 0xf3, 0xff, 0x01, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x3a, 0x7e, 0xe7, 0xff, 0x90, 0x9c, 0xb5, 0xff, 0xc2, 0xc8, 0xcf, 0xff, 0xd0, 0xd9, 0xe5, 0xff, 0xc5, 0xdd, 0xe7, 0xff, 0x7e, 0xf0, 0xf3, 0xff, 0x8b, 0xde, 0xe5, 0xff, 0xb4, 0xbe, 0xc9, 0xff, 0x87, 0x95, 0xb2, 0xff, 0x35, 0x7e, 0xea, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0x7b, 0xc7, 0xee, 0xff, 0x87, 0xf2, 0xf6, 0xff, 0x7e, 0xf3, 0xf5, 0xff, 0xc7, 0xd8, 0xdf, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xd7, 0xe2, 0xec, 0xff, 0xd9, 0xe4, 0xf0, 0xff, 0xe4, 0xea, 0xf0, 0xff, 0x53, 0x93, 0xfa, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x44, 0x81, 0xe5, 0xff, 0xaf, 0xb7, 0xc1, 0xff, 0xdd, 0xe5, 0xee, 0xff, 0xdb, 0xe6, 0xf2, 0xff, 0xe2, 0xe9, 0xf1, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xb1, 0xd2, 0xdf, 0xff, 0x7a, 0xf0, 0xf4, 0xff, 0x97, 0xe8, 0xf0, 0xff, 0xce, 0xda, 0xe7, 0xff, 0xa4, 0xad, 0xbb, 0xff, 0x3d, 0x80, 0xe8, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x2f, 0x9b, 0xfc, 0xff, 0x7e, 0xf0, 0xf3, 0xff, 0xb8, 0xcd, 0xd9, 0xff, 0xd3, 0xda, 0xe1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xde, 0xe7, 0xf0, 0xff, 0xdb, 0xe5, 0xf0, 0xff, 0xb7, 0xcc, 0xed, 0xff, 0x01, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x21, 0x80, 0xf6, 0xff, 0xa9, 0xb3, 0xc2, 0xff, 0xde, 0xe7, 0xf1, 0xff, 0xd8, 0xe3, 0xf1, 0xff, 0xe1, 0xe8, 0xf1, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xc2, 0xcd, 0xdb, 0xff, 0xc9, 0xd2, 0xde, 0xff, 0xac, 0xce, 0xdb, 0xff, 0x7b, 0xf3, 0xf6, 0xff, 0x97, 0xeb, 0xf4, 0xff, 0xce, 0xdc, 0xea, 0xff, 0x9a, 0xa6, 0xbd, 0xff, 0x11, 0x7d, 0xf8, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x01, 0x7a, 0xff, 0xff, 0xa0, 0xb9, 0xdb, 0xff, 0xcd, 0xd5, 0xdf, 0xff, 0xd9, 0xdf, 0xe5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xd3, 0xde, 0xe9, 0xff, 0xd4, 0xe1, 0xee, 0xff, 0x8d, 0xad, 0xf0, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x74, 0x93, 0xd4, 0xff, 0xd5, 0xde, 0xe9, 0xff, 0xd4, 0xe1, 0xf0, 0xff, 0xe0, 0xe7, 0xf0, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xc1, 0xcc, 0xd9, 0xff, 0xc1, 0xcc, 0xd8, 0xff, 0xce, 0xd8, 0xe2, 0xff, 0xcb, 0xd5, 0xe0, 0xff, 0xa8, 0xcc, 0xda, 0xff, 0x7d, 0xf7, 0xfa, 0xff, 0x96, 0xea, 0xf3, 0xff, 0xa6, 0xd1, 0xdf, 0xff, 0x3b, 0x94, 0xd9, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x85, 0xa4, 0xe6, 0xff, 0xd1, 0xda, 0xe4, 0xff, 0xd6, 0xdd, 0xe3, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xcd, 0xdc, 0xea, 0xff, 0xd4, 0xdf, 0xec, 0xff, 0x6e, 0x99, 0xf4, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0xa4, 0xb3, 0xc9, 0xff, 0xd0, 0xdd, 0xed, 0xff, 0xde, 0xe6, 0xef, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xe1, 0xe6, 0xeb, 0xff, 0xbb, 0xc7, 0xd5, 0xff, 0xce, 0xd7, 0xe1, 0xff, 0xd0, 0xda, 0xe3, 0xff, 0xd0, 0xda, 0xe4, 0xff, 0xc9, 0xd3, 0xdf, 0xff, 0xa5, 0xca, 0xd9, 0xff, 0x7d, 0xf7, 0xfb, 0xff, 0x7b, 0xf6, 0xf8, 0xff, 0x67, 0xb0, 0xca, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x5d, 0x8d, 0xed, 0xff, 0xbc, 0xc8, 0xd6, 0xff, 0xcb, 0xd4, 0xdd, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xe9, 0xe9, 0xe9, 0xb8, 0xed, 0xed, 0xed, 0xff, 0xcc, 0xd9, 0xe4, 0xff, 0xd5, 0xe0, 0xeb, 0xff, 0x4c, 0x87, 0xf5, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x1a, 0x7d, 0xf7, 0xff, 0xb3, 0xc0, 0xd1, 0xff, 0xd3, 0xdc, 0xe8, 0xff, 0xe6, 0xe8, 0xec, 0xff, 0xb8, 0xc5, 0xd5, 0xff, 0xb8, 0xc4, 0xd3, 0xff, 0xdb, 0xe0, 0xe6, 0xff, 0xb5, 0xc1, 0xd0, 0xff, 0xc8, 0xd2, 0xdc, 0xff, 0xca, 0xd4, 0xdf, 0xff, 0xbe, 0xc9, 0xd7, 0xff, 0x98, 0xca, 0xd8, 0xff, 0x76, 0xee, 0xf1, 0xff, 0x7b, 0xf4, 0xf8, 0xff, 0x6d, 0xd6, 0xdb, 0xff, 0x03, 0x7a, 0xfb, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x41, 0x7f, 0xf0, 0xff, 0xb0, 0xbe, 0xcf, 0xff, 0xc6, 0xd0, 0xda, 0xff, 0xed, 0xed, 0xed, 0xff, 0xe7, 0xe7, 0xe7, 0x78, 
-  0xdd, 0xdd, 0xdd, 0xb8, 0xe1, 0xe1, 0xe1, 0xff, 0xc6, 0xd2, 0xdd, 0xff, 0xc3, 0xcf, 0xdb, 0xff, 0x35, 0x7d, 0xf3, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x23, 0x7c, 0xf3, 0xff, 0xd0, 0xd3, 0xd9, 0xff, 0xdf, 0xe2, 0xe6, 0xff, 0xac, 0xb9, 0xcb, 0xff, 0xb7, 0xc2, 0xd0, 0xff, 0xb4, 0xc0, 0xcd, 0xff, 0xad, 0xb9, 0xc6, 0xff, 0xb8, 0xc1, 0xcc, 0xff, 0xab, 0xb8, 0xc5, 0xff, 0xb0, 0xbd, 0xc9, 0xff, 0x8e, 0xbe, 0xcc, 0xff, 0x71, 0xea, 0xed, 0xff, 0x81, 0xce, 0xdb, 0xff, 0x7a, 0xdf, 0xe6, 0xff, 0x6d, 0xda, 0xde, 0xff, 0x09, 0x7b, 0xf8, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x30, 0x78, 0xf0, 0xff, 0xa0, 0xaf, 0xc1, 0xff, 0xba, 0xc4, 0xce, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xda, 0xda, 0xda, 0x78, 
-  0xd1, 0xd1, 0xd1, 0xb8, 0xd5, 0xd5, 0xd5, 0xff, 0xaf, 0xbc, 0xca, 0xff, 0xaa, 0xb8, 0xc8, 0xff, 0x3f, 0x7b, 0xed, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x0e, 0x79, 0xfb, 0xff, 0xc5, 0xc9, 0xd0, 0xff, 0x9f, 0xad, 0xc1, 0xff, 0xa9, 0xb6, 0xc6, 0xff, 0xaf, 0xba, 0xc8, 0xff, 0xb0, 0xbb, 0xc8, 0xff, 0xa8, 0xb4, 0xc0, 0xff, 0x9c, 0xab, 0xba, 0xff, 0x9d, 0xab, 0xbb, 0xff, 0x85, 0xb3, 0xc0, 0xff, 0x69, 0xdd, 0xe0, 0xff, 0x78, 0xc3, 0xd0, 0xff, 0x72, 0xd1, 0xda, 0xff, 0x72, 0xd5, 0xdd, 0xff, 0x84, 0xae, 0xc3, 0xff, 0x03, 0x78, 0xfe, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x41, 0x79, 0xeb, 0xff, 0xb8, 0xbe, 0xc5, 0xff, 0xad, 0xb6, 0xc1, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xcf, 0xcf, 0xcf, 0x78, 
-  0xc5, 0xc5, 0xc5, 0xb8, 0xc9, 0xc9, 0xc9, 0xff, 0xa4, 0xb1, 0xbe, 0xff, 0x9d, 0xac, 0xbe, 0xff, 0x50, 0x7e, 0xdf, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x75, 0x90, 0xbe, 0xff, 0x95, 0xa3, 0xb7, 0xff, 0xa1, 0xad, 0xbf, 0xff, 0x91, 0x9f, 0xb3, 0xff, 0x9a, 0xa6, 0xb6, 0xff, 0xa3, 0xae, 0xbc, 0xff, 0x95, 0xa2, 0xb1, 0xff, 0x7b, 0xa8, 0xb5, 0xff, 0x63, 0xd1, 0xd4, 0xff, 0x6e, 0xb7, 0xc3, 0xff, 0x6a, 0xc5, 0xcd, 0xff, 0x6a, 0xc8, 0xd1, 0xff, 0x93, 0xad, 0xc5, 0xff, 0x77, 0x9a, 0xc8, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x54, 0x7d, 0xdc, 0xff, 0x8e, 0x9c, 0xad, 0xff, 0xa3, 0xac, 0xb6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc2, 0xc2, 0xc2, 0x78, 
-  0xb9, 0xb9, 0xb9, 0xb8, 0xbd, 0xbd, 0xbd, 0xff, 0xb9, 0xbc, 0xbf, 0xff, 0x9b, 0xa7, 0xb4, 0xff, 0x5e, 0x7d, 0xc4, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x52, 0x83, 0xe0, 0xff, 0x80, 0x91, 0xa9, 0xff, 0x8c, 0x9a, 0xae, 0xff, 0x88, 0x96, 0xab, 0xff, 0x81, 0x91, 0xa7, 0xff, 0x87, 0x95, 0xa7, 0xff, 0x6f, 0x9b, 0xab, 0xff, 0x5d, 0xc3, 0xc8, 0xff, 0x67, 0xab, 0xb8, 0xff, 0x62, 0xb8, 0xc2, 0xff, 0x61, 0xbc, 0xc5, 0xff, 0x87, 0xa1, 0xb8, 0xff, 0x73, 0x98, 0xa3, 0xff, 0x35, 0x86, 0xde, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x55, 0x74, 0xbd, 0xff, 0x83, 0x91, 0xa4, 0xff, 0x97, 0xa1, 0xaa, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb7, 0xb7, 0xb7, 0x78, 
-  0xad, 0xad, 0xad, 0xb8, 0xb1, 0xb1, 0xb1, 0xff, 0x91, 0x9c, 0xa6, 0xff, 0xab, 0xad, 0xb0, 0xff, 0x7d, 0x88, 0x9e, 0xff, 0x03, 0x6d, 0xfa, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x0a, 0x76, 0xfe, 0xff, 0x73, 0x8f, 0xbe, 0xff, 0x77, 0x86, 0x9f, 0xff, 0x76, 0x86, 0x9f, 0xff, 0x76, 0x86, 0x9e, 0xff, 0x67, 0x90, 0xa2, 0xff, 0x57, 0xb6, 0xbd, 0xff, 0x5f, 0x9f, 0xae, 0xff, 0x59, 0xa8, 0xb4, 0xff, 0x59, 0xac, 0xb7, 0xff, 0x7c, 0x95, 0xad, 0xff, 0x6a, 0x8e, 0x99, 0xff, 0x49, 0x8e, 0xb0, 0xff, 0x10, 0x77, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x02, 0x6d, 0xfb, 0xff, 0x4f, 0x88, 0x9b, 0xff, 0x78, 0x87, 0x98, 0xff, 0x8d, 0x96, 0x9f, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xab, 0xab, 0xab, 0x78, 
-  0xe7, 0xe7, 0xe7, 0xb8, 0xec, 0xec, 0xec, 0xff, 0xb1, 0xcc, 0xcf, 0xff, 0xcd, 0xd8, 0xe4, 0xff, 0xe5, 0xe6, 0xe7, 0xff, 0x70, 0x8d, 0xe4, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x34, 0x82, 0xfa, 0xff, 0xb1, 0xc4, 0xe3, 0xff, 0xb7, 0xc5, 0xd6, 0xff, 0xa6, 0xce, 0xdc, 0xff, 0x9a, 0xf3, 0xf6, 0xff, 0xa0, 0xda, 0xe6, 0xff, 0x9c, 0xea, 0xf0, 0xff, 0x9b, 0xe8, 0xed, 0xff, 0xbf, 0xd3, 0xe5, 0xff, 0xa8, 0xcc, 0xcf, 0xff, 0x82, 0xbf, 0xcd, 0xff, 0x2e, 0x85, 0xfa, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x53, 0x82, 0xdf, 0xff, 0x8f, 0xe4, 0xe6, 0xff, 0x9a, 0xdd, 0xe2, 0xff, 0xc6, 0xd0, 0xd8, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe4, 0xe4, 0xe4, 0x78, 
-  0xee, 0xee, 0xee, 0xb8, 0xf4, 0xf4, 0xf4, 0xff, 0x9e, 0xd3, 0xc3, 0xff, 0xaf, 0xd5, 0xd2, 0xff, 0xd3, 0xdf, 0xeb, 0xff, 0xc0, 0xc5, 0xd3, 0xff, 0x1c, 0x6e, 0xf9, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x33, 0x85, 0xfe, 0xff, 0x8a, 0xbb, 0xee, 0xff, 0x9a, 0xf4, 0xfb, 0xff, 0xa5, 0xe2, 0xee, 0xff, 0xa2, 0xf1, 0xf7, 0xff, 0xa1, 0xf4, 0xf9, 0xff, 0xc4, 0xda, 0xec, 0xff, 0xad, 0xd1, 0xda, 0xff, 0x7c, 0xbf, 0xe4, 0xff, 0x34, 0x88, 0xfe, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x0d, 0x6c, 0xf7, 0xff, 0x95, 0xad, 0xc0, 0xff, 0xbc, 0xdd, 0xea, 0xff, 0x97, 0xf5, 0xf6, 0xff, 0xbc, 0xed, 0xf0, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xec, 0xec, 0xec, 0x78, 
-  0xee, 0xee, 0xee, 0xb8, 0xf4, 0xf4, 0xf4, 0xff, 0x9a, 0xd0, 0xc0, 0xff, 0x8f, 0xd2, 0xbb, 0xff, 0xac, 0xd3, 0xd0, 0xff, 0xc7, 0xd3, 0xe1, 0xff, 0x8c, 0x9b, 0xcf, 0xff, 0x00, 0x6b, 0xfe, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x15, 0x76, 0xff, 0xff, 0x4b, 0x99, 0xfe, 0xff, 0x7a, 0xbf, 0xfb, 0xff, 0x8d, 0xdd, 0xff, 0xff, 0x9b, 0xcd, 0xf6, 0xff, 0x8b, 0xbc, 0xf9, 0xff, 0x51, 0x9b, 0xfd, 0xff, 0x18, 0x75, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6a, 0xfe, 0xff, 0x51, 0x88, 0xb8, 0xff, 0x8a, 0xc7, 0xb6, 0xff, 0xba, 0xd6, 0xdc, 0xff, 0xba, 0xdc, 0xea, 0xff, 0xba, 0xee, 0xf1, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xee, 0xee, 0xee, 0xb8, 0xf3, 0xf3, 0xf3, 0xff, 0x96, 0xcf, 0xbe, 0xff, 0x89, 0xd0, 0xb8, 0xff, 0x8a, 0xcf, 0xb9, 0xff, 0xa9, 0xd0, 0xcf, 0xff, 0xb9, 0xc5, 0xd3, 0xff, 0x70, 0x88, 0xd3, 0xff, 0x00, 0x6a, 0xfe, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xfe, 0xff, 0x3f, 0x79, 0xc3, 0xff, 0x7c, 0xba, 0xa8, 0xff, 0x89, 0xcf, 0xb9, 0xff, 0x8b, 0xcf, 0xb9, 0xff, 0xb7, 0xd4, 0xdb, 0xff, 0xd0, 0xdc, 0xe7, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xed, 0xed, 0xed, 0xb8, 0xf3, 0xf3, 0xf3, 0xff, 0x92, 0xce, 0xbc, 0xff, 0x84, 0xce, 0xb5, 0xff, 0x85, 0xce, 0xb5, 0xff, 0x84, 0xce, 0xb6, 0xff, 0xa5, 0xce, 0xcc, 0xff, 0xb3, 0xbf, 0xcd, 0xff, 0x77, 0x8a, 0xcc, 0xff, 0x04, 0x68, 0xfb, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x02, 0x67, 0xfa, 0xff, 0x41, 0x79, 0xb9, 0xff, 0x74, 0xb4, 0xa1, 0xff, 0x84, 0xcc, 0xb6, 0xff, 0x84, 0xce, 0xb6, 0xff, 0x84, 0xce, 0xb5, 0xff, 0x86, 0xcd, 0xb6, 0xff, 0xc2, 0xd8, 0xd9, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 
-  0xed, 0xed, 0xed, 0xb8, 0xf3, 0xf3, 0xf3, 0xff, 0x8f, 0xcc, 0xba, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x81, 0xcb, 0xb4, 0xff, 0xb8, 0xd2, 0xdd, 0xff, 0x9c, 0xc8, 0xd2, 0xff, 0x54, 0xa4, 0xbf, 0xff, 0x26, 0x69, 0xe4, 0xff, 0x00, 0x67, 0xfe, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xfe, 0xff, 0x1f, 0x67, 0xe0, 0xff, 0x4f, 0x86, 0x9b, 0xff, 0x74, 0xb8, 0xa3, 0xff, 0x80, 0xcb, 0xb3, 0xff, 0x81, 0xcc, 0xb4, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0xb2, 0xd6, 0xcb, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xea, 0xea, 0xea, 0x78, 
-  0xec, 0xec, 0xec, 0xb8, 0xf2, 0xf2, 0xf2, 0xff, 0x8d, 0xcb, 0xb8, 0xff, 0x7d, 0xcb, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7d, 0xca, 0xb1, 0xff, 0xad, 0xcf, 0xd3, 0xff, 0xa9, 0xdb, 0xe8, 0xff, 0x82, 0xfd, 0xfd, 0xff, 0x8c, 0xd6, 0xe0, 0xff, 0x6e, 0xc5, 0xc8, 0xff, 0x4d, 0x8f, 0xb6, 0xff, 0x3e, 0x66, 0xd0, 0xff, 0x1d, 0x64, 0xec, 0xff, 0x00, 0x65, 0xfd, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x65, 0xfd, 0xff, 0x21, 0x65, 0xec, 0xff, 0x57, 0x74, 0xd4, 0xff, 0x6f, 0x82, 0xb0, 0xff, 0x75, 0xa5, 0x9b, 0xff, 0x78, 0xc2, 0xab, 0xff, 0x7d, 0xca, 0xb2, 0xff, 0x7d, 0xca, 0xb1, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7d, 0xca, 0xb0, 0xff, 0x7c, 0xcb, 0xb0, 0xff, 0x7f, 0xca, 0xb0, 0xff, 0xc7, 0xd4, 0xc9, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe9, 0xe9, 0xe9, 0x78, 
-  0xec, 0xec, 0xec, 0xb8, 0xf2, 0xf2, 0xf2, 0xff, 0x8a, 0xc9, 0xb6, 0xff, 0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0xb5, 0xd4, 0xd5, 0xff, 0xae, 0xdd, 0xe9, 0xff, 0x7e, 0xfd, 0xfd, 0xff, 0x93, 0xe2, 0xea, 0xff, 0x84, 0xeb, 0xef, 0xff, 0x83, 0xee, 0xf1, 0xff, 0xac, 0xc1, 0xce, 0xff, 0xb1, 0xb9, 0xc2, 0xff, 0xa1, 0xa8, 0xb0, 0xff, 0x69, 0x7d, 0xbd, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x69, 0x7d, 0xbc, 0xff, 0x91, 0x9b, 0xa5, 0xff, 0xc8, 0xcc, 0xd0, 0xff, 0xe2, 0xe7, 0xeb, 0xff, 0xc9, 0xd9, 0xe6, 0xff, 0x8f, 0xcb, 0xbb, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x7b, 0xc9, 0xae, 0xff, 0xc4, 0xc4, 0xaa, 0xff, 0xde, 0xd1, 0xc7, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe9, 0xe9, 0xe9, 0x78, 
-  0xeb, 0xeb, 0xeb, 0xb8, 0xf2, 0xf2, 0xf2, 0xff, 0x8a, 0xca, 0xb6, 0xff, 0x77, 0xc8, 0xad, 0xff, 0xc1, 0xdc, 0xd9, 0xff, 0xb9, 0xe5, 0xed, 0xff, 0x7a, 0xfd, 0xfe, 0xff, 0x98, 0xe5, 0xec, 0xff, 0x88, 0xf2, 0xf6, 0xff, 0x8b, 0xf3, 0xf4, 0xff, 0xbd, 0xd0, 0xd8, 0xff, 0xd2, 0xd8, 0xde, 0xff, 0xdb, 0xe0, 0xe6, 0xff, 0xd4, 0xda, 0xe0, 0xff, 0xb5, 0xbc, 0xc3, 0xff, 0x40, 0x6b, 0xe1, 0xff, 0x47, 0x6f, 0xe2, 0xff, 0xc2, 0xc7, 0xcc, 0xff, 0xcc, 0xd3, 0xda, 0xff, 0xd5, 0xdb, 0xe2, 0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xe5, 0xe9, 0xed, 0xff, 0xd8, 0xe4, 0xec, 0xff, 0x92, 0xce, 0xbb, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x79, 0xc8, 0xac, 0xff, 0xc3, 0xc3, 0xa8, 0xff, 0xdd, 0xc0, 0xa7, 0xff, 0xde, 0xd1, 0xc6, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe8, 0xe8, 0xe8, 0x78, 
-  0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0x8a, 0xc9, 0xb5, 0xff, 0xcc, 0xe3, 0xde, 0xff, 0xc5, 0xec, 0xf1, 0xff, 0x77, 0xf9, 0xf9, 0xff, 0x9e, 0xe9, 0xee, 0xff, 0x89, 0xf4, 0xf7, 0xff, 0x84, 0xf5, 0xf6, 0xff, 0xd2, 0xe0, 0xe4, 0xff, 0xe1, 0xe5, 0xe9, 0xff, 0xd8, 0xdb, 0xde, 0xff, 0xdf, 0xe1, 0xe3, 0xff, 0xd9, 0xdc, 0xe0, 0xff, 0xd8, 0xda, 0xdd, 0xff, 0xaa, 0xaf, 0xc2, 0xff, 0xaa, 0xaf, 0xc0, 0xff, 0xd8, 0xdb, 0xde, 0xff, 0xdb, 0xdf, 0xe3, 0xff, 0xe0, 0xe4, 0xe7, 0xff, 0xd7, 0xdb, 0xdf, 0xff, 0xe8, 0xea, 0xed, 0xff, 0xee, 0xf0, 0xf4, 0xff, 0xe7, 0xee, 0xf1, 0xff, 0x96, 0xcf, 0xbc, 0xff, 0x75, 0xc7, 0xab, 0xff, 0xc2, 0xc1, 0xa7, 0xff, 0xdd, 0xbf, 0xa6, 0xff, 0xdd, 0xbf, 0xa5, 0xff, 0xde, 0xd1, 0xc5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xe8, 0xe8, 0xe8, 0x78, 
-  0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xdc, 0xe8, 0xe5, 0xff, 0xce, 0xf2, 0xf4, 0xff, 0x73, 0xf4, 0xf4, 0xff, 0xa1, 0xea, 0xee, 0xff, 0x8c, 0xf5, 0xf8, 0xff, 0x83, 0xf5, 0xf6, 0xff, 0xd5, 0xe0, 0xe1, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe0, 0xe2, 0xe4, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xda, 0xdc, 0xde, 0xff, 0xda, 0xde, 0xe2, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xdd, 0xe0, 0xe2, 0xff, 0xec, 0xef, 0xf0, 0xff, 0xe8, 0xeb, 0xee, 0xff, 0xe6, 0xec, 0xec, 0xff, 0xc7, 0xde, 0xd6, 0xff, 0xe0, 0xe0, 0xdb, 0xff, 0xe6, 0xe4, 0xe1, 0xff, 0xe8, 0xe7, 0xe5, 0xff, 0xec, 0xed, 0xed, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xe8, 0xe8, 0xe8, 0x78, 
-  0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xc2, 0xea, 0xee, 0xff, 0x76, 0xfd, 0xfe, 0xff, 0x9e, 0xe9, 0xee, 0xff, 0x8c, 0xef, 0xf2, 0xff, 0x85, 0xf1, 0xf3, 0xff, 0xcf, 0xdc, 0xdf, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe4, 0xe6, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe9, 0xeb, 0xec, 0xff, 0xed, 0xef, 0xef, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xfc, 0xeb, 0xeb, 0xeb, 0xf0, 0xe7, 0xe7, 0xe7, 0xe0, 0xdf, 0xdf, 0xdf, 0x63, 
-  0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xde, 0xed, 0xee, 0xff, 0xe0, 0xec, 0xed, 0xff, 0xea, 0xec, 0xed, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xee, 0xee, 0xee, 0xf8, 0xe9, 0xe9, 0xe9, 0xe8, 0xe7, 0xe7, 0xe7, 0xd8, 0xe6, 0xe6, 0xe6, 0xc8, 0xe0, 0xe0, 0xe0, 0xb7, 0xde, 0xde, 0xde, 0xa3, 0xde, 0xde, 0xde, 0x8f, 0xd6, 0xd6, 0xd6, 0x7b, 0xd0, 0xd0, 0xd0, 0x67, 0xcf, 0xcf, 0xcf, 0x53, 0xb7, 0xb7, 0xb7, 0x3f, 0x89, 0x89, 0x89, 0x28, 0x27, 0x27, 0x27, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 
-  0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xfc, 0xeb, 0xeb, 0xeb, 0xf0, 0xe7, 0xe7, 0xe7, 0xe0, 0xe7, 0xe7, 0xe7, 0xd0, 0xe3, 0xe3, 0xe3, 0xbf, 0xdf, 0xdf, 0xdf, 0xac, 0xdf, 0xdf, 0xdf, 0x98, 0xda, 0xda, 0xda, 0x84, 0xd2, 0xd2, 0xd2, 0x70, 0xd1, 0xd1, 0xd1, 0x5c, 0xc6, 0xc6, 0xc6, 0x48, 0xa4, 0xa4, 0xa4, 0x34, 0x60, 0x60, 0x60, 0x1f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xcb, 0xcb, 0xcb, 0x37, 0xb8, 0xb8, 0xb8, 0x3f, 0x89, 0x89, 0x89, 0x28, 0x27, 0x27, 0x27, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4f, 0x9d, 0xdf, 0x0b, 0x65, 0xb8, 0xf9, 0x43, 0x78, 0xc4, 0xfb, 0x6f, 0x8a, 0xcf, 0xfd, 0x83, 0x8d, 0xd1, 0xfd, 0x83, 0x80, 0xc9, 
+  0xfb, 0x6c, 0x72, 0xc0, 0xf9, 0x40, 0x5f, 0xa7, 0xdf, 0x0b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x30, 0x96, 0xf4, 0x2f, 0x38, 0x9d, 0xfc, 0xa3, 0x39, 0x9a, 0xfe, 0xf4, 0x31, 0x93, 0xff, 0xff, 
+  0x18, 0x88, 0xff, 0xff, 0x04, 0x82, 0xff, 0xff, 0x04, 0x83, 0xff, 0xff, 0x1a, 0x89, 0xff, 0xff, 0x39, 0x95, 0xff, 0xff, 0x46, 0xa1, 0xfe, 0xf4, 0x4d, 0xa9, 0xfc, 0xa3, 0x4c, 0xa7, 0xf4, 0x2c, 
+  0x8a, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0x01, 0x02, 0x03, 0x02, 0x07, 0x12, 0x03, 0x06, 0x0d, 0x24, 0x03, 0x08, 0x13, 0x32, 0x03, 0x0d, 0x73, 0xd9, 0x0c, 0x17, 
+  0x8a, 0xfb, 0x94, 0x16, 0x89, 0xff, 0xfc, 0x01, 0x81, 0xff, 0xff, 0x87, 0x00, 0x80, 0xff, 0xff, 0x07, 0x02, 0x81, 0xff, 0xff, 0x28, 0x91, 0xff, 0xfc, 0x36, 0x9b, 0xfb, 0x93, 0x2c, 0x85, 0xd6, 
+  0x0b, 0x08, 0x12, 0x31, 0x03, 0x05, 0x0d, 0x22, 0x03, 0x02, 0x06, 0x10, 0x03, 0x00, 0x00, 0x01, 0x03, 0x82, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf3, 0xf3, 0xb7, 0x85, 
+  0xf6, 0xf6, 0xf6, 0xff, 0x02, 0xea, 0xef, 0xf7, 0xff, 0x70, 0xa4, 0xfe, 0xff, 0x01, 0x81, 0xff, 0xff, 0x8b, 0x00, 0x80, 0xff, 0xff, 0x02, 0x06, 0x82, 0xff, 0xff, 0x78, 0xad, 0xfe, 0xff, 0xeb, 
+  0xf0, 0xf7, 0xff, 0x85, 0xf6, 0xf6, 0xf6, 0xff, 0x04, 0xf1, 0xf1, 0xf1, 0x77, 0xee, 0xee, 0xee, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xe8, 0xeb, 0xed, 0xff, 0xe7, 0xea, 0xec, 0xff, 0x81, 0xe8, 0xeb, 
+  0xee, 0xff, 0x01, 0xe1, 0xe7, 0xef, 0xff, 0x63, 0x9d, 0xfc, 0xff, 0x8e, 0x00, 0x80, 0xff, 0xff, 0x0f, 0x01, 0x80, 0xff, 0xff, 0x69, 0xa2, 0xfc, 0xff, 0xe2, 0xe7, 0xee, 0xff, 0xe0, 0xea, 0xec, 
+  0xff, 0xdf, 0xec, 0xee, 0xff, 0xe2, 0xe8, 0xeb, 0xff, 0xe6, 0xee, 0xef, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0x78, 0xee, 0xee, 0xee, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xdf, 0xe9, 0xf2, 
+  0xff, 0xe5, 0xee, 0xf8, 0xff, 0xe4, 0xec, 0xf4, 0xff, 0xed, 0xf3, 0xfa, 0xff, 0x83, 0xb0, 0xfc, 0xff, 0x84, 0x00, 0x80, 0xff, 0xff, 0x07, 0x03, 0x7e, 0xfb, 0xff, 0x44, 0x7c, 0xda, 0xff, 0x63, 
+  0x81, 0xbb, 0xff, 0x47, 0x8f, 0xb1, 0xff, 0x48, 0x8d, 0xb1, 0xff, 0x62, 0x7f, 0xbc, 0xff, 0x3f, 0x7a, 0xdb, 0xff, 0x02, 0x7e, 0xfc, 0xff, 0x83, 0x00, 0x80, 0xff, 0xff, 0x0e, 0x01, 0x80, 0xff, 
+  0xff, 0x67, 0xaa, 0xf8, 0xff, 0x79, 0xfb, 0xfd, 0xff, 0x96, 0xe4, 0xed, 0xff, 0x85, 0xf3, 0xf7, 0xff, 0xaf, 0xf2, 0xf3, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0x78, 0xed, 0xed, 0xed, 
+  0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xdc, 0xe6, 0xf1, 0xff, 0xdd, 0xe7, 0xf2, 0xff, 0xdc, 0xe5, 0xf1, 0xff, 0xb6, 0xcc, 0xf3, 0xff, 0x01, 0x80, 0xff, 0xff, 0x83, 0x00, 0x80, 0xff, 0xff, 0x09, 0x3a, 
+  0x7e, 0xe7, 0xff, 0x90, 0x9c, 0xb5, 0xff, 0xc2, 0xc8, 0xcf, 0xff, 0xd0, 0xd9, 0xe5, 0xff, 0xc5, 0xdd, 0xe7, 0xff, 0x7e, 0xf0, 0xf3, 0xff, 0x8b, 0xde, 0xe5, 0xff, 0xb4, 0xbe, 0xc9, 0xff, 0x87, 
+  0x95, 0xb2, 0xff, 0x35, 0x7e, 0xea, 0xff, 0x82, 0x00, 0x80, 0xff, 0xff, 0x0f, 0x00, 0x7f, 0xff, 0xff, 0x01, 0x7e, 0xff, 0xff, 0x7b, 0xc7, 0xee, 0xff, 0x87, 0xf2, 0xf6, 0xff, 0x7e, 0xf3, 0xf5, 
+  0xff, 0xc7, 0xd8, 0xdf, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xd7, 0xe2, 0xec, 0xff, 0xd9, 0xe4, 0xf0, 0xff, 0xe4, 0xea, 0xf0, 
+  0xff, 0x53, 0x93, 0xfa, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x81, 0x00, 0x80, 0xff, 0xff, 0x7f, 0x44, 0x81, 0xe5, 0xff, 0xaf, 0xb7, 0xc1, 0xff, 0xdd, 0xe5, 0xee, 0xff, 0xdb, 
+  0xe6, 0xf2, 0xff, 0xe2, 0xe9, 0xf1, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xb1, 0xd2, 0xdf, 0xff, 0x7a, 0xf0, 0xf4, 0xff, 0x97, 0xe8, 0xf0, 0xff, 0xce, 0xda, 0xe7, 0xff, 0xa4, 0xad, 0xbb, 0xff, 0x3d, 
+  0x80, 0xe8, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x2f, 0x9b, 0xfc, 0xff, 0x7e, 0xf0, 0xf3, 0xff, 0xb8, 0xcd, 0xd9, 0xff, 0xd3, 
+  0xda, 0xe1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xde, 0xe7, 0xf0, 0xff, 0xdb, 0xe5, 0xf0, 0xff, 0xb7, 0xcc, 0xed, 0xff, 0x01, 
+  0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x21, 0x80, 0xf6, 0xff, 0xa9, 0xb3, 0xc2, 0xff, 0xde, 0xe7, 0xf1, 0xff, 0xd8, 0xe3, 0xf1, 0xff, 0xe1, 
+  0xe8, 0xf1, 0xff, 0xf4, 0xf6, 0xf8, 0xff, 0xc2, 0xcd, 0xdb, 0xff, 0xc9, 0xd2, 0xde, 0xff, 0xac, 0xce, 0xdb, 0xff, 0x7b, 0xf3, 0xf6, 0xff, 0x97, 0xeb, 0xf4, 0xff, 0xce, 0xdc, 0xea, 0xff, 0x9a, 
+  0xa6, 0xbd, 0xff, 0x11, 0x7d, 0xf8, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x01, 0x7a, 0xff, 0xff, 0xa0, 0xb9, 0xdb, 0xff, 0xcd, 0xd5, 0xdf, 0xff, 0xd9, 
+  0xdf, 0xe5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xd3, 0xde, 0xe9, 0xff, 0xd4, 0xe1, 0xee, 0xff, 0x8d, 0xad, 0xf0, 0xff, 0x00, 
+  0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x74, 0x93, 0xd4, 0xff, 0xd5, 0xde, 0xe9, 0xff, 0xd4, 0xe1, 0xf0, 0xff, 0xe0, 0xe7, 0xf0, 0xff, 0xf4, 
+  0xf5, 0xf8, 0xff, 0xc1, 0xcc, 0xd9, 0xff, 0xc1, 0xcc, 0xd8, 0xff, 0xce, 0xd8, 0xe2, 0xff, 0xcb, 0xd5, 0xe0, 0xff, 0xa8, 0xcc, 0xda, 0xff, 0x7d, 0xf7, 0xfa, 0xff, 0x96, 0xea, 0xf3, 0xff, 0xa6, 
+  0xd1, 0xdf, 0xff, 0x3b, 0x94, 0xd9, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x85, 0xa4, 0xe6, 0xff, 0xd1, 0xda, 0xe4, 0xff, 0xd6, 
+  0xdd, 0xe3, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xed, 0xed, 0xed, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xcd, 0xdc, 0xea, 0xff, 0xd4, 0xdf, 0xec, 0xff, 0x6e, 0x99, 0xf4, 0xff, 0x00, 
+  0x78, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0xa4, 0xb3, 0xc9, 0xff, 0xd0, 0xdd, 0xed, 0xff, 0xde, 0xe6, 0xef, 0xff, 0xf4, 0xf5, 0xf8, 0xff, 0xe1, 
+  0xe6, 0xeb, 0xff, 0xbb, 0xc7, 0xd5, 0xff, 0xce, 0xd7, 0xe1, 0xff, 0xd0, 0xda, 0xe3, 0xff, 0xd0, 0xda, 0xe4, 0xff, 0xc9, 0xd3, 0xdf, 0xff, 0xa5, 0xca, 0xd9, 0xff, 0x7d, 0xf7, 0xfb, 0xff, 0x7b, 
+  0xf6, 0xf8, 0xff, 0x67, 0xb0, 0xca, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x5d, 0x8d, 0xed, 0xff, 0xbc, 0xc8, 0xd6, 0xff, 0xcb, 
+  0xd4, 0xdd, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xe9, 0xe9, 0xe9, 0xb8, 0xed, 0xed, 0xed, 0xff, 0xcc, 0xd9, 0xe4, 0xff, 0xd5, 0xe0, 0xeb, 0xff, 0x4c, 0x87, 0xf5, 0xff, 0x00, 
+  0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x1a, 0x7d, 0xf7, 0xff, 0xb3, 0xc0, 0xd1, 0xff, 0x5c, 0xd3, 0xdc, 0xe8, 0xff, 0xe6, 0xe8, 0xec, 0xff, 0xb8, 0xc5, 0xd5, 0xff, 
+  0xb8, 0xc4, 0xd3, 0xff, 0xdb, 0xe0, 0xe6, 0xff, 0xb5, 0xc1, 0xd0, 0xff, 0xc8, 0xd2, 0xdc, 0xff, 0xca, 0xd4, 0xdf, 0xff, 0xbe, 0xc9, 0xd7, 0xff, 0x98, 0xca, 0xd8, 0xff, 0x76, 0xee, 0xf1, 0xff, 
+  0x7b, 0xf4, 0xf8, 0xff, 0x6d, 0xd6, 0xdb, 0xff, 0x03, 0x7a, 0xfb, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x41, 0x7f, 0xf0, 0xff, 0xb0, 0xbe, 0xcf, 0xff, 
+  0xc6, 0xd0, 0xda, 0xff, 0xed, 0xed, 0xed, 0xff, 0xe7, 0xe7, 0xe7, 0x78, 0xdd, 0xdd, 0xdd, 0xb8, 0xe1, 0xe1, 0xe1, 0xff, 0xc6, 0xd2, 0xdd, 0xff, 0xc3, 0xcf, 0xdb, 0xff, 0x35, 0x7d, 0xf3, 0xff, 
+  0x00, 0x75, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x23, 0x7c, 0xf3, 0xff, 0xd0, 0xd3, 0xd9, 0xff, 0xdf, 0xe2, 0xe6, 0xff, 0xac, 0xb9, 0xcb, 0xff, 0xb7, 0xc2, 0xd0, 0xff, 
+  0xb4, 0xc0, 0xcd, 0xff, 0xad, 0xb9, 0xc6, 0xff, 0xb8, 0xc1, 0xcc, 0xff, 0xab, 0xb8, 0xc5, 0xff, 0xb0, 0xbd, 0xc9, 0xff, 0x8e, 0xbe, 0xcc, 0xff, 0x71, 0xea, 0xed, 0xff, 0x81, 0xce, 0xdb, 0xff, 
+  0x7a, 0xdf, 0xe6, 0xff, 0x6d, 0xda, 0xde, 0xff, 0x09, 0x7b, 0xf8, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x30, 0x78, 0xf0, 0xff, 0xa0, 0xaf, 0xc1, 0xff, 
+  0xba, 0xc4, 0xce, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xda, 0xda, 0xda, 0x78, 0xd1, 0xd1, 0xd1, 0xb8, 0xd5, 0xd5, 0xd5, 0xff, 0xaf, 0xbc, 0xca, 0xff, 0xaa, 0xb8, 0xc8, 0xff, 0x3f, 0x7b, 0xed, 0xff, 
+  0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x0e, 0x79, 0xfb, 0xff, 0xc5, 0xc9, 0xd0, 0xff, 0x9f, 0xad, 0xc1, 0xff, 0xa9, 0xb6, 0xc6, 0xff, 0xaf, 0xba, 0xc8, 0xff, 
+  0xb0, 0xbb, 0xc8, 0xff, 0xa8, 0xb4, 0xc0, 0xff, 0x9c, 0xab, 0xba, 0xff, 0x9d, 0xab, 0xbb, 0xff, 0x85, 0xb3, 0xc0, 0xff, 0x69, 0xdd, 0xe0, 0xff, 0x78, 0xc3, 0xd0, 0xff, 0x72, 0xd1, 0xda, 0xff, 
+  0x72, 0xd5, 0xdd, 0xff, 0x84, 0xae, 0xc3, 0xff, 0x03, 0x78, 0xfe, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x41, 0x79, 0xeb, 0xff, 0xb8, 0xbe, 0xc5, 0xff, 
+  0xad, 0xb6, 0xc1, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xcf, 0xcf, 0xcf, 0x78, 0xc5, 0xc5, 0xc5, 0xb8, 0xc9, 0xc9, 0xc9, 0xff, 0xa4, 0xb1, 0xbe, 0xff, 0x9d, 0xac, 0xbe, 0xff, 0x50, 0x7e, 0xdf, 0xff, 
+  0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x75, 0xff, 0xff, 0x7f, 0x75, 0x90, 0xbe, 0xff, 0x95, 0xa3, 0xb7, 0xff, 0xa1, 0xad, 0xbf, 0xff, 0x91, 0x9f, 0xb3, 0xff, 0x9a, 0xa6, 
+  0xb6, 0xff, 0xa3, 0xae, 0xbc, 0xff, 0x95, 0xa2, 0xb1, 0xff, 0x7b, 0xa8, 0xb5, 0xff, 0x63, 0xd1, 0xd4, 0xff, 0x6e, 0xb7, 0xc3, 0xff, 0x6a, 0xc5, 0xcd, 0xff, 0x6a, 0xc8, 0xd1, 0xff, 0x93, 0xad, 
+  0xc5, 0xff, 0x77, 0x9a, 0xc8, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x54, 0x7d, 0xdc, 0xff, 0x8e, 0x9c, 0xad, 0xff, 0xa3, 0xac, 
+  0xb6, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0xc2, 0xc2, 0xc2, 0x78, 0xb9, 0xb9, 0xb9, 0xb8, 0xbd, 0xbd, 0xbd, 0xff, 0xb9, 0xbc, 0xbf, 0xff, 0x9b, 0xa7, 0xb4, 0xff, 0x5e, 0x7d, 0xc4, 0xff, 0x00, 0x71, 
+  0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x52, 0x83, 0xe0, 0xff, 0x80, 0x91, 0xa9, 0xff, 0x8c, 0x9a, 0xae, 0xff, 0x88, 0x96, 0xab, 0xff, 0x81, 0x91, 
+  0xa7, 0xff, 0x87, 0x95, 0xa7, 0xff, 0x6f, 0x9b, 0xab, 0xff, 0x5d, 0xc3, 0xc8, 0xff, 0x67, 0xab, 0xb8, 0xff, 0x62, 0xb8, 0xc2, 0xff, 0x61, 0xbc, 0xc5, 0xff, 0x87, 0xa1, 0xb8, 0xff, 0x73, 0x98, 
+  0xa3, 0xff, 0x35, 0x86, 0xde, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x55, 0x74, 0xbd, 0xff, 0x83, 0x91, 0xa4, 0xff, 0x97, 0xa1, 
+  0xaa, 0xff, 0xbd, 0xbd, 0xbd, 0xff, 0xb7, 0xb7, 0xb7, 0x78, 0xad, 0xad, 0xad, 0xb8, 0xb1, 0xb1, 0xb1, 0xff, 0x91, 0x9c, 0xa6, 0xff, 0xab, 0xad, 0xb0, 0xff, 0x7d, 0x88, 0x9e, 0xff, 0x03, 0x6d, 
+  0xfa, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x0a, 0x76, 0xfe, 0xff, 0x73, 0x8f, 0xbe, 0xff, 0x77, 0x86, 0x9f, 0xff, 0x76, 0x86, 0x9f, 0xff, 0x76, 0x86, 
+  0x9e, 0xff, 0x67, 0x90, 0xa2, 0xff, 0x57, 0xb6, 0xbd, 0xff, 0x5f, 0x9f, 0xae, 0xff, 0x59, 0xa8, 0xb4, 0xff, 0x59, 0xac, 0xb7, 0xff, 0x7c, 0x95, 0xad, 0xff, 0x6a, 0x8e, 0x99, 0xff, 0x49, 0x8e, 
+  0xb0, 0xff, 0x10, 0x77, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x02, 0x6d, 0xfb, 0xff, 0x4f, 0x88, 0x9b, 0xff, 0x78, 0x87, 0x98, 0xff, 0x8d, 0x96, 
+  0x9f, 0xff, 0xb1, 0xb1, 0xb1, 0xff, 0xab, 0xab, 0xab, 0x78, 0xe7, 0xe7, 0xe7, 0xb8, 0xec, 0xec, 0xec, 0xff, 0xb1, 0xcc, 0xcf, 0xff, 0xcd, 0xd8, 0xe4, 0xff, 0xe5, 0xe6, 0xe7, 0xff, 0x70, 0x8d, 
+  0xe4, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x34, 0x82, 0xfa, 0xff, 0xb1, 0xc4, 0xe3, 0xff, 0xb7, 0xc5, 0xd6, 0xff, 0xa6, 0xce, 
+  0xdc, 0xff, 0x9a, 0xf3, 0xf6, 0xff, 0xa0, 0xda, 0xe6, 0xff, 0x9c, 0xea, 0xf0, 0xff, 0x9b, 0xe8, 0xed, 0xff, 0xbf, 0xd3, 0xe5, 0xff, 0xa8, 0xcc, 0xcf, 0xff, 0x82, 0xbf, 0xcd, 0xff, 0x2e, 0x85, 
+  0xfa, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x53, 0x82, 0xdf, 0xff, 0x8f, 0xe4, 0xe6, 0xff, 0x9a, 0xdd, 0xe2, 0xff, 0xc6, 0xd0, 
+  0xd8, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe4, 0xe4, 0xe4, 0x78, 0xee, 0xee, 0xee, 0xb8, 0xf4, 0xf4, 0xf4, 0xff, 0x9e, 0xd3, 0xc3, 0xff, 0xaf, 0xd5, 0xd2, 0xff, 0xd3, 0xdf, 0xeb, 0xff, 0xc0, 0xc5, 
+  0xd3, 0xff, 0x1c, 0x6e, 0xf9, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x20, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x33, 0x85, 0xfe, 0xff, 0x8a, 0xbb, 0xee, 0xff, 0x9a, 
+  0xf4, 0xfb, 0xff, 0xa5, 0xe2, 0xee, 0xff, 0xa2, 0xf1, 0xf7, 0xff, 0xa1, 0xf4, 0xf9, 0xff, 0xc4, 0xda, 0xec, 0xff, 0xad, 0xd1, 0xda, 0xff, 0x7c, 0xbf, 0xe4, 0xff, 0x34, 0x88, 0xfe, 0xff, 0x00, 
+  0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x0d, 0x6c, 0xf7, 0xff, 0x95, 0xad, 0xc0, 0xff, 0xbc, 0xdd, 0xea, 0xff, 0x97, 0xf5, 0xf6, 0xff, 0xbc, 
+  0xed, 0xf0, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xec, 0xec, 0xec, 0x78, 0xee, 0xee, 0xee, 0xb8, 0xf4, 0xf4, 0xf4, 0xff, 0x9a, 0xd0, 0xc0, 0xff, 0x8f, 0xd2, 0xbb, 0xff, 0xac, 0xd3, 0xd0, 0xff, 0xc7, 
+  0xd3, 0xe1, 0xff, 0x8c, 0x9b, 0xcf, 0xff, 0x00, 0x6b, 0xfe, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x09, 0x15, 0x76, 0xff, 0xff, 0x4b, 0x99, 0xfe, 
+  0xff, 0x7a, 0xbf, 0xfb, 0xff, 0x8d, 0xdd, 0xff, 0xff, 0x9b, 0xcd, 0xf6, 0xff, 0x8b, 0xbc, 0xf9, 0xff, 0x51, 0x9b, 0xfd, 0xff, 0x18, 0x75, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 
+  0xff, 0x81, 0x00, 0x6c, 0xff, 0xff, 0x11, 0x00, 0x6a, 0xfe, 0xff, 0x51, 0x88, 0xb8, 0xff, 0x8a, 0xc7, 0xb6, 0xff, 0xba, 0xd6, 0xdc, 0xff, 0xba, 0xdc, 0xea, 0xff, 0xba, 0xee, 0xf1, 0xff, 0xf4, 
+  0xf4, 0xf4, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xee, 0xee, 0xee, 0xb8, 0xf3, 0xf3, 0xf3, 0xff, 0x96, 0xcf, 0xbe, 0xff, 0x89, 0xd0, 0xb8, 0xff, 0x8a, 0xcf, 0xb9, 0xff, 0xa9, 0xd0, 0xcf, 0xff, 0xb9, 
+  0xc5, 0xd3, 0xff, 0x70, 0x88, 0xd3, 0xff, 0x00, 0x6a, 0xfe, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x81, 0x00, 0x6c, 0xff, 0xff, 0x86, 0x00, 0x6d, 0xff, 0xff, 0x81, 0x00, 0x6c, 0xff, 0xff, 0x14, 0x00, 
+  0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xfe, 0xff, 0x3f, 0x79, 0xc3, 0xff, 0x7c, 0xba, 0xa8, 0xff, 0x89, 0xcf, 0xb9, 0xff, 0x8b, 0xcf, 0xb9, 0xff, 0xb7, 0xd4, 0xdb, 0xff, 0xd0, 
+  0xdc, 0xe7, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xed, 0xed, 0xed, 0xb8, 0xf3, 0xf3, 0xf3, 0xff, 0x92, 0xce, 0xbc, 0xff, 0x84, 0xce, 0xb5, 0xff, 0x85, 0xce, 0xb5, 0xff, 0x84, 
+  0xce, 0xb6, 0xff, 0xa5, 0xce, 0xcc, 0xff, 0xb3, 0xbf, 0xcd, 0xff, 0x77, 0x8a, 0xcc, 0xff, 0x04, 0x68, 0xfb, 0xff, 0x81, 0x00, 0x6a, 0xff, 0xff, 0x86, 0x00, 0x6b, 0xff, 0xff, 0x81, 0x00, 0x6a, 
+  0xff, 0xff, 0x16, 0x00, 0x69, 0xff, 0xff, 0x02, 0x67, 0xfa, 0xff, 0x41, 0x79, 0xb9, 0xff, 0x74, 0xb4, 0xa1, 0xff, 0x84, 0xcc, 0xb6, 0xff, 0x84, 0xce, 0xb6, 0xff, 0x84, 0xce, 0xb5, 0xff, 0x86, 
+  0xcd, 0xb6, 0xff, 0xc2, 0xd8, 0xd9, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xeb, 0xeb, 0xeb, 0x78, 0xed, 0xed, 0xed, 0xb8, 0xf3, 0xf3, 0xf3, 0xff, 0x8f, 0xcc, 0xba, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x81, 
+  0xcc, 0xb3, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x81, 0xcb, 0xb4, 0xff, 0xb8, 0xd2, 0xdd, 0xff, 0x9c, 0xc8, 0xd2, 0xff, 0x54, 0xa4, 0xbf, 0xff, 0x26, 0x69, 0xe4, 0xff, 0x00, 0x67, 0xfe, 0xff, 0x86, 
+  0x00, 0x69, 0xff, 0xff, 0x07, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xfe, 0xff, 0x1f, 0x67, 0xe0, 0xff, 0x4f, 0x86, 0x9b, 0xff, 0x74, 0xb8, 0xa3, 0xff, 0x80, 0xcb, 0xb3, 0xff, 0x81, 0xcc, 0xb4, 
+  0xff, 0x80, 0xcc, 0xb2, 0xff, 0x81, 0x80, 0xcc, 0xb3, 0xff, 0x11, 0xb2, 0xd6, 0xcb, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xea, 0xea, 0xea, 0x78, 0xec, 0xec, 0xec, 0xb8, 0xf2, 0xf2, 0xf2, 0xff, 0x8d, 
+  0xcb, 0xb8, 0xff, 0x7d, 0xcb, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7d, 0xca, 0xb1, 0xff, 0xad, 0xcf, 0xd3, 0xff, 0xa9, 0xdb, 0xe8, 0xff, 0x82, 0xfd, 0xfd, 0xff, 0x8c, 0xd6, 0xe0, 0xff, 0x6e, 
+  0xc5, 0xc8, 0xff, 0x4d, 0x8f, 0xb6, 0xff, 0x3e, 0x66, 0xd0, 0xff, 0x1d, 0x64, 0xec, 0xff, 0x00, 0x65, 0xfd, 0xff, 0x81, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x65, 0xfd, 0xff, 0x21, 0x65, 0xec, 
+  0xff, 0x57, 0x74, 0xd4, 0xff, 0x6f, 0x82, 0xb0, 0xff, 0x75, 0xa5, 0x9b, 0xff, 0x78, 0xc2, 0xab, 0xff, 0x7d, 0xca, 0xb2, 0xff, 0x7d, 0xca, 0xb1, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7d, 0xca, 0xb0, 
+  0xff, 0x7c, 0xcb, 0xb0, 0xff, 0x7f, 0xca, 0xb0, 0xff, 0xc7, 0xd4, 0xc9, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe9, 0xe9, 0xe9, 0x78, 0xec, 0xec, 0xec, 0xb8, 0xf2, 0xf2, 0xf2, 0xff, 0x8a, 0xc9, 0xb6, 
+  0xff, 0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0xb5, 0xd4, 0xd5, 0xff, 0xae, 0xdd, 0xe9, 0xff, 0x7e, 0xfd, 0xfd, 0xff, 0x93, 0xe2, 0xea, 0xff, 0x84, 0xeb, 0xef, 0xff, 0x83, 0xee, 0xf1, 
+  0xff, 0xac, 0xc1, 0xce, 0xff, 0xb1, 0xb9, 0xc2, 0xff, 0xa1, 0xa8, 0xb0, 0xff, 0x69, 0x7d, 0xbd, 0xff, 0x81, 0x00, 0x64, 0xff, 0xff, 0x07, 0x69, 0x7d, 0xbc, 0xff, 0x91, 0x9b, 0xa5, 0xff, 0xc8, 
+  0xcc, 0xd0, 0xff, 0xe2, 0xe7, 0xeb, 0xff, 0xc9, 0xd9, 0xe6, 0xff, 0x8f, 0xcb, 0xbb, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x81, 0x79, 0xc9, 0xae, 0xff, 0x1c, 0x7b, 0xc9, 0xae, 
+  0xff, 0xc4, 0xc4, 0xaa, 0xff, 0xde, 0xd1, 0xc7, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe9, 0xe9, 0xe9, 0x78, 0xeb, 0xeb, 0xeb, 0xb8, 0xf2, 0xf2, 0xf2, 0xff, 0x8a, 0xca, 0xb6, 0xff, 0x77, 0xc8, 0xad, 
+  0xff, 0xc1, 0xdc, 0xd9, 0xff, 0xb9, 0xe5, 0xed, 0xff, 0x7a, 0xfd, 0xfe, 0xff, 0x98, 0xe5, 0xec, 0xff, 0x88, 0xf2, 0xf6, 0xff, 0x8b, 0xf3, 0xf4, 0xff, 0xbd, 0xd0, 0xd8, 0xff, 0xd2, 0xd8, 0xde, 
+  0xff, 0xdb, 0xe0, 0xe6, 0xff, 0xd4, 0xda, 0xe0, 0xff, 0xb5, 0xbc, 0xc3, 0xff, 0x40, 0x6b, 0xe1, 0xff, 0x47, 0x6f, 0xe2, 0xff, 0xc2, 0xc7, 0xcc, 0xff, 0xcc, 0xd3, 0xda, 0xff, 0xd5, 0xdb, 0xe2, 
+  0xff, 0xf2, 0xf4, 0xf6, 0xff, 0xe5, 0xe9, 0xed, 0xff, 0xd8, 0xe4, 0xec, 0xff, 0x92, 0xce, 0xbb, 0xff, 0x81, 0x77, 0xc8, 0xad, 0xff, 0x53, 0x79, 0xc8, 0xac, 0xff, 0xc3, 0xc3, 0xa8, 0xff, 0xdd, 
+  0xc0, 0xa7, 0xff, 0xde, 0xd1, 0xc6, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xe8, 0xe8, 0xe8, 0x78, 0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0x8a, 0xc9, 0xb5, 0xff, 0xcc, 0xe3, 0xde, 0xff, 0xc5, 
+  0xec, 0xf1, 0xff, 0x77, 0xf9, 0xf9, 0xff, 0x9e, 0xe9, 0xee, 0xff, 0x89, 0xf4, 0xf7, 0xff, 0x84, 0xf5, 0xf6, 0xff, 0xd2, 0xe0, 0xe4, 0xff, 0xe1, 0xe5, 0xe9, 0xff, 0xd8, 0xdb, 0xde, 0xff, 0xdf, 
+  0xe1, 0xe3, 0xff, 0xd9, 0xdc, 0xe0, 0xff, 0xd8, 0xda, 0xdd, 0xff, 0xaa, 0xaf, 0xc2, 0xff, 0xaa, 0xaf, 0xc0, 0xff, 0xd8, 0xdb, 0xde, 0xff, 0xdb, 0xdf, 0xe3, 0xff, 0xe0, 0xe4, 0xe7, 0xff, 0xd7, 
+  0xdb, 0xdf, 0xff, 0xe8, 0xea, 0xed, 0xff, 0xee, 0xf0, 0xf4, 0xff, 0xe7, 0xee, 0xf1, 0xff, 0x96, 0xcf, 0xbc, 0xff, 0x75, 0xc7, 0xab, 0xff, 0xc2, 0xc1, 0xa7, 0xff, 0xdd, 0xbf, 0xa6, 0xff, 0xdd, 
+  0xbf, 0xa5, 0xff, 0xde, 0xd1, 0xc5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xe8, 0xe8, 0xe8, 0x78, 0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xdc, 0xe8, 0xe5, 0xff, 0xce, 0xf2, 0xf4, 0xff, 0x73, 
+  0xf4, 0xf4, 0xff, 0xa1, 0xea, 0xee, 0xff, 0x8c, 0xf5, 0xf8, 0xff, 0x83, 0xf5, 0xf6, 0xff, 0xd5, 0xe0, 0xe1, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe0, 0xe2, 0xe4, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xe3, 
+  0xe3, 0xe3, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xda, 0xdc, 0xde, 0xff, 0xda, 0xde, 0xe2, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xdf, 
+  0xe1, 0xe2, 0xff, 0xdd, 0xe0, 0xe2, 0xff, 0xec, 0xef, 0xf0, 0xff, 0xe8, 0xeb, 0xee, 0xff, 0xe6, 0xec, 0xec, 0xff, 0xc7, 0xde, 0xd6, 0xff, 0xe0, 0xe0, 0xdb, 0xff, 0xe6, 0xe4, 0xe1, 0xff, 0xe8, 
+  0xe7, 0xe5, 0xff, 0xec, 0xed, 0xed, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xe8, 0xe8, 0xe8, 0x78, 0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xc2, 0xea, 0xee, 0xff, 0x76, 0xfd, 0xfe, 0xff, 0x9e, 
+  0xe9, 0xee, 0xff, 0x8c, 0xef, 0xf2, 0xff, 0x85, 0xf1, 0xf3, 0xff, 0xcf, 0xdc, 0xdf, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe4, 
+  0xe6, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0x81, 0xe8, 0xea, 0xeb, 0xff, 0x01, 0xe9, 0xeb, 0xec, 0xff, 0xed, 0xef, 0xef, 0xff, 0x89, 0xf1, 0xf1, 0xf1, 0xff, 0x09, 0xf0, 0xf0, 0xf0, 0xfc, 0xeb, 
+  0xeb, 0xeb, 0xf0, 0xe7, 0xe7, 0xe7, 0xe0, 0xdf, 0xdf, 0xdf, 0x63, 0xeb, 0xeb, 0xeb, 0xb8, 0xf1, 0xf1, 0xf1, 0xff, 0xde, 0xed, 0xee, 0xff, 0xe0, 0xec, 0xed, 0xff, 0xea, 0xec, 0xed, 0xff, 0xf0, 
+  0xf0, 0xf0, 0xff, 0x89, 0xf1, 0xf1, 0xf1, 0xff, 0x10, 0xee, 0xee, 0xee, 0xf8, 0xe9, 0xe9, 0xe9, 0xe8, 0xe7, 0xe7, 0xe7, 0xd8, 0xe6, 0xe6, 0xe6, 0xc8, 0xe0, 0xe0, 0xe0, 0xb7, 0xde, 0xde, 0xde, 
+  0xa3, 0xde, 0xde, 0xde, 0x8f, 0xd6, 0xd6, 0xd6, 0x7b, 0xd0, 0xd0, 0xd0, 0x67, 0xcf, 0xcf, 0xcf, 0x53, 0xb7, 0xb7, 0xb7, 0x3f, 0x89, 0x89, 0x89, 0x28, 0x27, 0x27, 0x27, 0x17, 0x00, 0x00, 0x00, 
+  0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0xeb, 0xeb, 0xeb, 0xb8, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x11, 0xf0, 0xf0, 0xf0, 0xfc, 0xeb, 0xeb, 0xeb, 0xf0, 0xe7, 0xe7, 0xe7, 0xe0, 0xe7, 
+  0xe7, 0xe7, 0xd0, 0xe3, 0xe3, 0xe3, 0xbf, 0xdf, 0xdf, 0xdf, 0xac, 0xdf, 0xdf, 0xdf, 0x98, 0xda, 0xda, 0xda, 0x84, 0xd2, 0xd2, 0xd2, 0x70, 0xd1, 0xd1, 0xd1, 0x5c, 0xc6, 0xc6, 0xc6, 0x48, 0xa4, 
+  0xa4, 0xa4, 0x34, 0x60, 0x60, 0x60, 0x1f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x8a, 0x00, 0x00, 0x00, 0x00, 
+  0x06, 0xcb, 0xcb, 0xcb, 0x37, 0xb8, 0xb8, 0xb8, 0x3f, 0x89, 0x89, 0x89, 0x28, 0x27, 0x27, 0x27, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x81, 0x00, 0x00, 
+  0x00, 0x03, 0x96, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +323,7 @@ const lv_img_dsc_t osmand_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( osmand_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = osmand_32px_map,
 };
-
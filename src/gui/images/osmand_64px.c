@@ -10,271 +10,949 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_OSMAND_64PX uint8_t osmand_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0xb2, 0x0c, 0xb2, 0x0c, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf5, 0x27, 0xf9, 0x68, 0xfa, 0x9f, 0xfa, 0xcb, 0xfa, 0xe8, 0xfa, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfa, 0xe8, 0xfa, 0xc8, 0xfa, 0x9f, 0xfa, 0x67, 0xf6, 0x24, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x1b, 0xf5, 0x7b, 0xf5, 0xd4, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfa, 0xd3, 0xf5, 0x78, 0xf5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x1f, 0xf5, 0x9b, 0xf5, 0xf8, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xf5, 0xf7, 0xf5, 0x97, 0xf5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x08, 0xf0, 0x7c, 0xf5, 0xf4, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf5, 0xf4, 0xf5, 0x78, 0xad, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x24, 0x04, 0x44, 0x04, 0x44, 0x04, 0xf0, 0x2b, 0xf0, 0xcc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf5, 0xcb, 0xf1, 0x27, 0x44, 0x04, 0x44, 0x04, 0x24, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 
-  0xff, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x00, 0x07, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xcd, 0xff, 0xd1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd1, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb5, 0xff, 0xb2, 0xff, 0x92, 0xff, 0xb2, 0xff, 0xd1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd1, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0xd1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xb6, 0xff, 0xd2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xb2, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xb2, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd7, 0xff, 0xb2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd2, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd7, 0xff, 0xd1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb6, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xb6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xd5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xd9, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xb2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd9, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xd7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xdb, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xdb, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xd6, 0xff, 0xfb, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xdb, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xd6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xe4, 0x00, 0x0b, 
-  0xdb, 0x70, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd2, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd7, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xd6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xd6, 0xff, 0xda, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe4, 0x00, 0x0b, 
-  0xdb, 0x70, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb2, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd9, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xda, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe4, 0x00, 0x0b, 
-  0xdb, 0x70, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb2, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xb1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe4, 0x00, 0x0b, 
-  0xb7, 0x70, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0xed, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0x91, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xcd, 0xff, 0x92, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe4, 0x00, 0x0b, 
-  0xb7, 0x70, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xd7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xb2, 0xff, 0xad, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd6, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xb5, 0xff, 0xb2, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xd6, 0xff, 0xb2, 0xff, 0x91, 0xff, 0xb1, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb1, 0xff, 0x92, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xe4, 0x00, 0x0b, 
-  0xb7, 0x70, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xd5, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xb5, 0xff, 0xb2, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0x91, 0xff, 0x91, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb1, 0xff, 0xb5, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd1, 0xff, 0xda, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xda, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xde, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd2, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xde, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xed, 0xff, 0xb6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd6, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb1, 0xff, 0xba, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb1, 0xff, 0xb6, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xd2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd1, 0xff, 0x96, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xcd, 0xff, 0x96, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xad, 0xff, 0x95, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb1, 0xff, 0x95, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0xed, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xcd, 0xff, 0x91, 0xff, 0x96, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xb5, 0xff, 0xb1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xad, 0xff, 0x91, 0xff, 0xb6, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0xb1, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xed, 0xff, 0xad, 0xff, 0x91, 0xff, 0x95, 0xff, 0xba, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xda, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xda, 0xff, 0xba, 0xff, 0xda, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0x91, 0xff, 0x8e, 0xff, 0xad, 0xff, 0xcd, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xcd, 0xff, 0xd2, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xda, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0x92, 0xff, 0x92, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0x8d, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xcd, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xec, 0xff, 0xd1, 0xff, 0xb6, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xed, 0xff, 0xec, 0xff, 0xec, 0xff, 0xed, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb2, 0xff, 0xec, 0xff, 0xec, 0xff, 0xb2, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x0b, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xdb, 0xff, 0xcb, 0xff, 0xbb, 0xff, 0x97, 0x00, 0x08, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xe3, 0xff, 0xd3, 0xff, 0xc3, 0xff, 0xb3, 0xff, 0xa3, 0xff, 0x90, 0xdb, 0x7f, 0xdb, 0x6c, 0xb6, 0x58, 0x92, 0x44, 0x49, 0x33, 0x00, 0x27, 0x00, 0x20, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x00, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xdb, 0xff, 0xcb, 0xff, 0xbb, 0xff, 0xab, 0xff, 0x98, 0xdb, 0x88, 0xdb, 0x77, 0xb7, 0x63, 0x92, 0x4f, 0x6d, 0x3c, 0x00, 0x2b, 0x00, 0x23, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xe3, 0xff, 0xd3, 0xff, 0xc3, 0xff, 0xb3, 0xff, 0xa3, 0xff, 0x90, 0xdb, 0x7f, 0xdb, 0x6c, 0xb6, 0x58, 0x92, 0x44, 0x49, 0x33, 0x00, 0x27, 0x00, 0x20, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xdb, 0xff, 0xcb, 0xff, 0xbb, 0xff, 0xab, 0xff, 0x98, 0xdb, 0x88, 0xdb, 0x77, 0xb7, 0x63, 0x92, 0x4f, 0x6d, 0x3c, 0x00, 0x2b, 0x00, 0x23, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xdb, 0x43, 0xff, 0x8f, 0xdb, 0x7f, 0xdb, 0x6c, 0xb6, 0x58, 0x92, 0x44, 0x49, 0x33, 0x00, 0x27, 0x00, 0x20, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x04, 0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x9c, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x81, 0xb2, 0x0c, 0x01, 0x00, 0x04, 0x00, 0x03, 0xb4, 0x00, 0x00, 0x06, 0x00, 0x03, 0xf5, 0x27, 0xf9, 0x68, 0xfa, 0x9f, 
+  0xfa, 0xcb, 0xfa, 0xe8, 0xfa, 0xfc, 0x81, 0xfe, 0xff, 0x06, 0xfe, 0xfc, 0xfa, 0xe8, 0xfa, 0xc8, 0xfa, 0x9f, 0xfa, 0x67, 0xf6, 0x24, 0x00, 0x03, 0xad, 0x00, 0x00, 0x02, 0xf1, 0x1b, 0xf5, 0x7b, 
+  0xf5, 0xd4, 0x83, 0xf5, 0xff, 0x85, 0xf0, 0xff, 0x82, 0xf5, 0xff, 0x03, 0xfa, 0xff, 0xfa, 0xd3, 0xf5, 0x78, 0xf5, 0x18, 0xa9, 0x00, 0x00, 0x03, 0xf1, 0x1f, 0xf5, 0x9b, 0xf5, 0xf8, 0xf5, 0xff, 
+  0x8e, 0xf0, 0xff, 0x04, 0xf1, 0xff, 0xf5, 0xff, 0xf5, 0xf7, 0xf5, 0x97, 0xf5, 0x1c, 0xa5, 0x00, 0x00, 0x02, 0xac, 0x08, 0xf0, 0x7c, 0xf5, 0xf4, 0x94, 0xf0, 0xff, 0x03, 0xf5, 0xff, 0xf5, 0xf4, 
+  0xf5, 0x78, 0xad, 0x07, 0x92, 0x00, 0x00, 0x87, 0x00, 0x03, 0x81, 0x00, 0x04, 0x82, 0x20, 0x04, 0x00, 0x24, 0x04, 0x81, 0x44, 0x04, 0x01, 0xf0, 0x2b, 0xf0, 0xcc, 0x98, 0xf0, 0xff, 0x02, 0xf5, 
+  0xff, 0xf5, 0xcb, 0xf1, 0x27, 0x81, 0x44, 0x04, 0x00, 0x24, 0x04, 0x82, 0x20, 0x04, 0x81, 0x00, 0x04, 0x87, 0x00, 0x03, 0x01, 0x00, 0x00, 0xff, 0x68, 0x8f, 0xff, 0xff, 0x00, 0xf1, 0xff, 0x9b, 
+  0xf0, 0xff, 0x00, 0xf5, 0xff, 0x8e, 0xff, 0xff, 0x02, 0xff, 0xe3, 0x00, 0x07, 0xff, 0x70, 0x8d, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x9e, 0xf0, 0xff, 0x00, 0xf5, 0xff, 0x8d, 0xff, 0xff, 0x02, 0xff, 
+  0xe4, 0x00, 0x0b, 0xff, 0x70, 0x8d, 0xff, 0xff, 0xa0, 0xf0, 0xff, 0x00, 0xf1, 0xff, 0x8c, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x8c, 0xff, 0xff, 0xa2, 0xf0, 0xff, 0x00, 0xf1, 
+  0xff, 0x8b, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x8b, 0xff, 0xff, 0x00, 0xf5, 0xff, 0x8e, 0xf0, 0xff, 0x83, 0xd1, 0xff, 0x01, 0xcd, 0xff, 0xd1, 0xff, 0x8e, 0xf0, 0xff, 0x01, 
+  0xf5, 0xff, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x8a, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8c, 0xf0, 0xff, 
+  0x00, 0xd1, 0xff, 0x82, 0xb2, 0xff, 0x83, 0xb5, 0xff, 0x03, 0xb2, 0xff, 0x92, 0xff, 0xb2, 0xff, 0xd1, 0xff, 0x8c, 0xf0, 0xff, 0x00, 0xf9, 0xff, 0x82, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x82, 0xfe, 
+  0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x89, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8b, 0xf0, 0xff, 0x02, 0xd1, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xff, 
+  0xff, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x81, 0xdb, 0xff, 0x02, 0xb6, 0xff, 0xb2, 0xff, 0xd1, 0xff, 0x8b, 0xf0, 0xff, 0x02, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x00, 0xfa, 0xff, 
+  0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x89, 0xff, 0xff, 0x00, 0xf1, 0xff, 0x8a, 0xf0, 0xff, 0x02, 0xb2, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x83, 0xfe, 0xff, 
+  0x81, 0xff, 0xff, 0x02, 0xd7, 0xff, 0xb6, 0xff, 0xd2, 0xff, 0x8a, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xfb, 0xff, 0x82, 0xfe, 0xff, 0x00, 0xfa, 0xff, 0x83, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 
+  0xff, 0x70, 0x88, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x8a, 0xf0, 0xff, 0x01, 0xb2, 0xff, 0xd7, 0xff, 0x87, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdb, 0xff, 0xb7, 
+  0xff, 0xb2, 0xff, 0x8a, 0xf0, 0xff, 0x00, 0xf9, 0xff, 0x81, 0xfe, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x88, 0xff, 0xff, 0x00, 
+  0xf1, 0xff, 0x89, 0xf0, 0xff, 0x01, 0xb2, 0xff, 0xdb, 0xff, 0x88, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xd7, 0xff, 0xb2, 0xff, 0x89, 0xf0, 0xff, 
+  0x02, 0xf5, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0x81, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x87, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x89, 0xf0, 0xff, 0x01, 0xd2, 0xff, 
+  0xdb, 0xff, 0x88, 0xff, 0xff, 0x83, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xd7, 0xff, 0xd1, 0xff, 0x89, 0xf0, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xfb, 0xff, 0x84, 0xff, 
+  0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x87, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xb7, 0xff, 0x88, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x81, 
+  0xfb, 0xff, 0x83, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xb6, 0xff, 0xf1, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xf6, 0xff, 0xfb, 0xff, 0x85, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 
+  0x70, 0x87, 0xff, 0xff, 0x00, 0xf1, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xb6, 0xff, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x83, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x81, 0xff, 
+  0xff, 0x01, 0xd6, 0xff, 0xd5, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xfb, 0xff, 0x85, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x86, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x88, 0xf0, 
+  0xff, 0x01, 0xf1, 0xff, 0xdb, 0xff, 0x87, 0xff, 0xff, 0x83, 0xfb, 0xff, 0x83, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x02, 0xfb, 0xff, 0xfe, 0xff, 0xd9, 0xff, 0x89, 0xf0, 0xff, 0x00, 
+  0xdb, 0xff, 0x85, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x86, 0xff, 0xff, 0x00, 0xfa, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xd2, 0xff, 0xfb, 0xff, 0x86, 0xff, 0xff, 0x81, 0xfb, 0xff, 
+  0x87, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x85, 0xfe, 0xff, 0x00, 0xd1, 0xff, 0x88, 0xf0, 0xff, 0x03, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 
+  0xff, 0x70, 0x86, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xd6, 0xff, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xfb, 0xff, 0x86, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x83, 
+  0xfe, 0xff, 0x01, 0xfa, 0xff, 0xb2, 0xff, 0x88, 0xf0, 0xff, 0x00, 0xf6, 0xff, 0x82, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x86, 0xff, 0xff, 0x00, 0xf6, 0xff, 
+  0x88, 0xf0, 0xff, 0x00, 0xd6, 0xff, 0x85, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xfb, 0xff, 0x84, 0xff, 0xff, 0x81, 0xfb, 0xff, 0x00, 0xda, 0xff, 0x84, 0xfe, 
+  0xff, 0x00, 0xd9, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xf2, 0xff, 0xdb, 0xff, 0x81, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x86, 0xff, 0xff, 0x00, 0xf1, 0xff, 0x87, 
+  0xf0, 0xff, 0x02, 0xf1, 0xff, 0xd7, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xfb, 
+  0xff, 0xdb, 0xff, 0xda, 0xff, 0x85, 0xfe, 0xff, 0x00, 0xda, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xdb, 0xff, 0x81, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 
+  0x82, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xf1, 0xff, 0x87, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xfb, 0xff, 0x82, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xdb, 0xff, 0x81, 
+  0xfb, 0xff, 0x81, 0xdb, 0xff, 0x02, 0xfb, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x81, 0xdb, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xdb, 0xff, 0x00, 0xda, 0xff, 0x82, 0xfe, 0xff, 0x01, 0xfa, 0xff, 0xda, 0xff, 
+  0x81, 0xfe, 0xff, 0x00, 0xda, 0xff, 0x88, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xd7, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xdb, 0x70, 0x82, 0xff, 0xff, 0x00, 0xfb, 
+  0xff, 0x81, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xf1, 0xff, 0x87, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xda, 0xff, 0xdb, 0xff, 0x82, 0xfb, 0xff, 0x81, 0xdb, 
+  0xff, 0x02, 0xd6, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0x83, 0xdb, 0xff, 0x00, 0xd6, 0xff, 0x82, 0xfe, 0xff, 0x01, 0xfa, 0xff, 0xda, 0xff, 0x82, 0xfe, 0xff, 0x00, 0xda, 0xff, 0x88, 0xf0, 0xff, 0x00, 
+  0xf1, 0xff, 0x81, 0xd6, 0xff, 0x01, 0xdb, 0xff, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xdb, 0x70, 0x82, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xfb, 0xff, 0x01, 0xdb, 0xff, 
+  0xf1, 0xff, 0x87, 0xf0, 0xff, 0x03, 0xf1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x81, 0xd6, 0xff, 0x85, 0xdb, 0xff, 0x86, 0xd6, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xda, 0xff, 0x82, 0xfe, 0xff, 
+  0x01, 0xda, 0xff, 0xd6, 0xff, 0x88, 0xf0, 0xff, 0x04, 0xf1, 0xff, 0xd6, 0xff, 0xfb, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xdb, 0x70, 0x82, 0xff, 0xff, 
+  0x83, 0xdb, 0xff, 0x00, 0xf1, 0xff, 0x88, 0xf0, 0xff, 0x81, 0xdb, 0xff, 0x81, 0xd6, 0xff, 0x87, 0xdb, 0xff, 0x84, 0xd6, 0xff, 0x82, 0xfe, 0xff, 0x01, 0xda, 0xff, 0xd6, 0xff, 0x82, 0xfe, 0xff, 
+  0x02, 0xda, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0x88, 0xf0, 0xff, 0x04, 0xd2, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xd6, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdb, 0xe4, 0x00, 0x0b, 0xdb, 0x70, 0x82, 
+  0xdb, 0xff, 0x00, 0xd6, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xd6, 0xff, 0xd2, 0xff, 0x88, 0xf0, 0xff, 0x00, 0xd2, 0xff, 0x81, 0xd6, 0xff, 0x82, 0xd7, 0xff, 0x02, 0xd6, 0xff, 0xb6, 0xff, 0xd6, 0xff, 
+  0x82, 0xdb, 0xff, 0x04, 0xd7, 0xff, 0xb6, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xfa, 0xff, 0x81, 0xfe, 0xff, 0x01, 0xda, 0xff, 0xd6, 0xff, 0x82, 0xfe, 0xff, 0x01, 0xd6, 0xff, 0xda, 0xff, 0x81, 0xd6, 
+  0xff, 0x87, 0xf0, 0xff, 0x02, 0xec, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0x81, 0xd6, 0xff, 0x82, 0xdb, 0xff, 0x02, 0xdb, 0xe4, 0x00, 0x0b, 0xdb, 0x70, 0x83, 0xdb, 0xff, 0x82, 0xd6, 0xff, 0x01, 0xb2, 
+  0xff, 0xec, 0xff, 0x87, 0xf0, 0xff, 0x00, 0xf1, 0xff, 0x81, 0xb6, 0xff, 0x83, 0xd6, 0xff, 0x81, 0xb6, 0xff, 0x82, 0xd6, 0xff, 0x82, 0xb6, 0xff, 0x00, 0xd9, 0xff, 0x81, 0xfa, 0xff, 0x81, 0xd6, 
+  0xff, 0x00, 0xda, 0xff, 0x81, 0xfa, 0xff, 0x82, 0xd6, 0xff, 0x01, 0xb6, 0xff, 0xf1, 0xff, 0x86, 0xf0, 0xff, 0x81, 0xec, 0xff, 0x00, 0xb2, 0xff, 0x82, 0xb6, 0xff, 0x82, 0xdb, 0xff, 0x02, 0xdb, 
+  0xe4, 0x00, 0x0b, 0xdb, 0x70, 0x84, 0xdb, 0xff, 0x81, 0xd6, 0xff, 0x01, 0xb2, 0xff, 0xec, 0xff, 0x88, 0xf0, 0xff, 0x82, 0xb6, 0xff, 0x82, 0xd6, 0xff, 0x86, 0xb6, 0xff, 0x82, 0xd9, 0xff, 0x01, 
+  0xd6, 0xff, 0xb6, 0xff, 0x82, 0xd9, 0xff, 0x82, 0xd6, 0xff, 0x01, 0xb6, 0xff, 0xb1, 0xff, 0x85, 0xf0, 0xff, 0x83, 0xec, 0xff, 0x00, 0x92, 0xff, 0x82, 0xb6, 0xff, 0x00, 0xd7, 0xff, 0x81, 0xdb, 
+  0xff, 0x02, 0xdb, 0xe4, 0x00, 0x0b, 0xb7, 0x70, 0x85, 0xdb, 0xff, 0x02, 0xb6, 0xff, 0xb2, 0xff, 0xed, 0xff, 0x81, 0xec, 0xff, 0x86, 0xf0, 0xff, 0x01, 0xf1, 0xff, 0xb6, 0xff, 0x81, 0xb2, 0xff, 
+  0x81, 0xb6, 0xff, 0x85, 0xb2, 0xff, 0x82, 0xd9, 0xff, 0x01, 0xd6, 0xff, 0xb6, 0xff, 0x82, 0xd9, 0xff, 0x00, 0xb6, 0xff, 0x81, 0xd6, 0xff, 0x02, 0xb6, 0xff, 0x91, 0xff, 0xf1, 0xff, 0x84, 0xf0, 
+  0xff, 0x83, 0xec, 0xff, 0x01, 0xcd, 0xff, 0x92, 0xff, 0x82, 0xb2, 0xff, 0x00, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x02, 0xdb, 0xe4, 0x00, 0x0b, 0xb7, 0x70, 0x82, 0xdb, 0xff, 0x05, 0xb6, 0xff, 0xd7, 
+  0xff, 0xb7, 0xff, 0xdb, 0xff, 0xb2, 0xff, 0xad, 0xff, 0x82, 0xec, 0xff, 0x86, 0xf0, 0xff, 0x00, 0xd6, 0xff, 0x88, 0xb2, 0xff, 0x82, 0xd9, 0xff, 0x01, 0xb5, 0xff, 0xb2, 0xff, 0x82, 0xd9, 0xff, 
+  0x00, 0xb6, 0xff, 0x81, 0xd6, 0xff, 0x03, 0xb2, 0xff, 0x91, 0xff, 0xb1, 0xff, 0xf1, 0xff, 0x82, 0xf0, 0xff, 0x85, 0xec, 0xff, 0x01, 0xb1, 0xff, 0x92, 0xff, 0x82, 0xb2, 0xff, 0x00, 0xb6, 0xff, 
+  0x81, 0xdb, 0xff, 0x02, 0xdb, 0xe4, 0x00, 0x0b, 0xb7, 0x70, 0x82, 0xb7, 0xff, 0x81, 0xb6, 0xff, 0x82, 0xb7, 0xff, 0x00, 0x92, 0xff, 0x84, 0xec, 0xff, 0x84, 0xf0, 0xff, 0x00, 0xf1, 0xff, 0x87, 
+  0xb2, 0xff, 0x00, 0xd5, 0xff, 0x81, 0xd9, 0xff, 0x01, 0xb5, 0xff, 0xb2, 0xff, 0x82, 0xd5, 0xff, 0x82, 0xb6, 0xff, 0x00, 0xb2, 0xff, 0x81, 0x91, 0xff, 0x00, 0xf5, 0xff, 0x82, 0xf0, 0xff, 0x86, 
+  0xec, 0xff, 0x01, 0xb1, 0xff, 0xb5, 0xff, 0x82, 0xb2, 0xff, 0x00, 0xb6, 0xff, 0x81, 0xb7, 0xff, 0x02, 0xb7, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xfb, 0xff, 
+  0x81, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xf2, 0xff, 0x85, 0xec, 0xff, 0x83, 0xf0, 0xff, 0x00, 0xf6, 0xff, 0x81, 0xfb, 0xff, 0x82, 0xdb, 0xff, 0x00, 0xda, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xfa, 0xff, 
+  0x82, 0xfe, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xfb, 0xff, 0x82, 0xda, 0xff, 0x01, 0xf5, 0xff, 0xf0, 0xff, 0x88, 0xec, 0xff, 0x01, 0xd1, 0xff, 0xda, 0xff, 0x81, 0xfe, 0xff, 0x81, 0xdb, 0xff, 0x82, 
+  0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x88, 0xec, 0xff, 0x81, 0xf0, 0xff, 0x01, 0xf6, 0xff, 0xff, 0xff, 
+  0x82, 0xfb, 0xff, 0x00, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0x03, 0xde, 0xff, 0xda, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0x89, 0xec, 0xff, 0x00, 0xd6, 0xff, 0x83, 0xfe, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xff, 
+  0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xde, 0xff, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x00, 0xd6, 0xff, 0x89, 0xec, 0xff, 0x01, 0xf0, 0xff, 0xf5, 0xff, 
+  0x81, 0xfb, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x04, 0xfb, 0xff, 0xde, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0x89, 0xec, 0xff, 0x02, 0xd2, 0xff, 
+  0xdb, 0xff, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0xde, 0xff, 0x00, 0xdb, 0xff, 0x82, 0xff, 0xff, 
+  0x01, 0xdb, 0xff, 0xf1, 0xff, 0x89, 0xec, 0xff, 0x02, 0xf0, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0x81, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xfb, 0xff, 0x82, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x00, 0xfb, 0xff, 
+  0x81, 0xfa, 0xff, 0x01, 0xf5, 0xff, 0xf0, 0xff, 0x89, 0xec, 0xff, 0x02, 0xed, 0xff, 0xb6, 0xff, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 
+  0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x82, 0xde, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xd6, 0xff, 0x8b, 0xec, 0xff, 0x01, 0xf1, 0xff, 0xf5, 0xff, 0x81, 0xfa, 
+  0xff, 0x83, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x81, 0xfa, 0xff, 0x01, 0xf5, 0xff, 0xf1, 0xff, 0x8b, 0xec, 0xff, 0x02, 0xb1, 0xff, 0xba, 0xff, 0xda, 0xff, 0x82, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x82, 
+  0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xda, 0xff, 0x82, 0xde, 0xff, 0x04, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0x8c, 
+  0xec, 0xff, 0x02, 0xf1, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0x83, 0xfa, 0xff, 0x02, 0xf6, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0x8c, 0xec, 0xff, 0x01, 0xb1, 0xff, 0xb6, 0xff, 0x82, 0xda, 0xff, 0x82, 0xff, 
+  0xff, 0x00, 0xfe, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x84, 0xda, 0xff, 0x04, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdb, 0xff, 
+  0xd2, 0xff, 0xa1, 0xec, 0xff, 0x02, 0xd1, 0xff, 0x96, 0xff, 0xba, 0xff, 0x83, 0xda, 0xff, 0x85, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x86, 0xda, 0xff, 0x04, 
+  0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0x9f, 0xec, 0xff, 0x02, 0xcd, 0xff, 0x96, 0xff, 0xba, 0xff, 0x85, 0xda, 0xff, 0x84, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 
+  0x70, 0x82, 0xff, 0xff, 0x87, 0xda, 0xff, 0x04, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0x9d, 0xec, 0xff, 0x02, 0xad, 0xff, 0x95, 0xff, 0xba, 0xff, 0x87, 0xda, 0xff, 0x83, 
+  0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x88, 0xda, 0xff, 0x04, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0x9b, 0xec, 0xff, 0x02, 0xb1, 0xff, 
+  0x95, 0xff, 0xba, 0xff, 0x89, 0xda, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x8a, 0xda, 0xff, 0x04, 0xff, 0xff, 0xfb, 0xff, 0xb6, 0xff, 0xb5, 0xff, 
+  0xed, 0xff, 0x97, 0xec, 0xff, 0x03, 0xcd, 0xff, 0x91, 0xff, 0x96, 0xff, 0xba, 0xff, 0x8a, 0xda, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x89, 0xda, 
+  0xff, 0x06, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xda, 0xff, 0xb5, 0xff, 0xb1, 0xff, 0x95, 0xec, 0xff, 0x03, 0xad, 0xff, 0x91, 0xff, 0xb6, 0xff, 0xba, 0xff, 0x8b, 0xda, 0xff, 0x82, 
+  0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x84, 0xda, 0xff, 0x00, 0xba, 0xff, 0x82, 0xda, 0xff, 0x02, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x82, 0xfe, 0xff, 0x03, 
+  0xda, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0xb1, 0xff, 0x90, 0xec, 0xff, 0x03, 0xed, 0xff, 0xad, 0xff, 0x91, 0xff, 0x95, 0xff, 0x81, 0xba, 0xff, 0x83, 0xda, 0xff, 0x00, 0xba, 0xff, 0x81, 0xda, 0xff, 
+  0x81, 0xba, 0xff, 0x03, 0xda, 0xff, 0xba, 0xff, 0xda, 0xff, 0xba, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xda, 0xff, 0x86, 0xba, 0xff, 0x02, 
+  0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xfe, 0xff, 0x04, 0xda, 0xff, 0x91, 0xff, 0x8e, 0xff, 0xad, 0xff, 0xcd, 0xff, 0x89, 0xec, 0xff, 0x01, 0xcd, 0xff, 
+  0xd2, 0xff, 0x81, 0xb2, 0xff, 0x01, 0xb6, 0xff, 0xda, 0xff, 0x82, 0xba, 0xff, 0x81, 0xda, 0xff, 0x89, 0xba, 0xff, 0x00, 0xbb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 
+  0x82, 0xff, 0xff, 0x00, 0xda, 0xff, 0x85, 0xba, 0xff, 0x81, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x83, 0xfe, 0xff, 0x00, 0xfa, 0xff, 0x82, 0xfe, 0xff, 0x01, 0xda, 0xff, 0xdb, 0xff, 0x81, 0xb6, 0xff, 
+  0x00, 0xb2, 0xff, 0x81, 0x92, 0xff, 0x85, 0xec, 0xff, 0x00, 0x8d, 0xff, 0x81, 0x92, 0xff, 0x03, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x8c, 0xba, 0xff, 0x81, 0xbb, 
+  0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xda, 0xff, 0x84, 0xba, 0xff, 0x82, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xfe, 0xff, 
+  0x00, 0xfa, 0xff, 0x81, 0xfb, 0xff, 0x81, 0xff, 0xff, 0x03, 0xfb, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xcd, 0xff, 0x83, 0xec, 0xff, 0x02, 0xd1, 0xff, 0xb6, 0xff, 0xd7, 0xff, 0x81, 0xdb, 0xff, 0x85, 
+  0xff, 0xff, 0x8a, 0xba, 0xff, 0x82, 0xbb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xda, 0xff, 0x83, 0xba, 0xff, 0x82, 0xff, 0xff, 0x83, 0xfe, 
+  0xff, 0x00, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x00, 0xfa, 0xff, 0x81, 0xfb, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0xb6, 0xff, 0xed, 0xff, 0x81, 0xec, 0xff, 0x01, 0xed, 0xff, 0xb6, 0xff, 0x81, 
+  0xff, 0xff, 0x82, 0xfb, 0xff, 0x85, 0xff, 0xff, 0x88, 0xba, 0xff, 0x83, 0xbb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xda, 0xff, 0x82, 0xba, 
+  0xff, 0x82, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xb2, 0xff, 0x81, 0xec, 0xff, 0x01, 0xb2, 0xff, 
+  0xdb, 0xff, 0x82, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x86, 0xba, 0xff, 0x84, 0xbb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xda, 
+  0xff, 0x81, 0xba, 0xff, 0x82, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x83, 0xfe, 0xff, 0x89, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xdb, 0xff, 0x81, 0xd1, 0xff, 0x00, 0xdb, 0xff, 0x82, 0xff, 
+  0xff, 0x00, 0xfb, 0xff, 0x89, 0xff, 0xff, 0x84, 0xba, 0xff, 0x85, 0xbb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x01, 0xda, 0xff, 0xba, 0xff, 0x82, 
+  0xff, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0x81, 0xb7, 0xff, 0x8f, 0xff, 0xff, 0x82, 0xba, 0xff, 0x86, 0xbb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xff, 0xe4, 
+  0x00, 0x0b, 0xff, 0x70, 0x82, 0xff, 0xff, 0x00, 0xda, 0xff, 0x82, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xa1, 0xff, 0xff, 0x81, 0xda, 0xff, 0x81, 0xdb, 0xff, 0x00, 
+  0xdf, 0xff, 0x86, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x85, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x94, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x98, 0xff, 
+  0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x84, 0xff, 0xff, 0x82, 0xfe, 0xff, 0x81, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xaf, 0xff, 0xff, 0x02, 0xff, 0xe4, 0x00, 0x0b, 0xff, 0x70, 0x83, 0xff, 
+  0xff, 0x83, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x83, 0xfe, 0xff, 0xaa, 0xff, 0xff, 0x07, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xdb, 0xff, 0xcb, 0xff, 0xbb, 0xff, 0x97, 0x00, 0x08, 0xff, 0x70, 0xaa, 0xff, 
+  0xff, 0x14, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xe3, 0xff, 0xd3, 0xff, 0xc3, 0xff, 0xb3, 0xff, 0xa3, 0xff, 0x90, 0xdb, 0x7f, 0xdb, 0x6c, 0xb6, 0x58, 0x92, 0x44, 0x49, 0x33, 0x00, 0x27, 0x00, 0x20, 
+  0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x00, 0xff, 0x70, 0x9e, 0xff, 0xff, 0x15, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xdb, 0xff, 0xcb, 0xff, 0xbb, 0xff, 0xab, 0xff, 0x98, 0xdb, 0x88, 
+  0xdb, 0x77, 0xb7, 0x63, 0x92, 0x4f, 0x6d, 0x3c, 0x00, 0x2b, 0x00, 0x23, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x81, 0x00, 0x03, 0x87, 
+  0x00, 0x00, 0x00, 0xff, 0x70, 0x91, 0xff, 0xff, 0x13, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xe3, 0xff, 0xd3, 0xff, 0xc3, 0xff, 0xb3, 0xff, 0xa3, 0xff, 0x90, 0xdb, 0x7f, 0xdb, 0x6c, 0xb6, 0x58, 0x92, 
+  0x44, 0x49, 0x33, 0x00, 0x27, 0x00, 0x20, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x81, 0x00, 0x07, 0x01, 0x00, 0x04, 0x00, 0x03, 0x94, 0x00, 0x00, 0x00, 0xff, 0x70, 0x85, 
+  0xff, 0xff, 0x15, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xdb, 0xff, 0xcb, 0xff, 0xbb, 0xff, 0xab, 0xff, 0x98, 0xdb, 0x88, 0xdb, 0x77, 0xb7, 0x63, 0x92, 0x4f, 0x6d, 0x3c, 0x00, 0x2b, 0x00, 0x23, 0x00, 
+  0x1c, 0x00, 0x18, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x81, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x0d, 0xdb, 0x43, 0xff, 0x8f, 0xdb, 0x7f, 0xdb, 0x6c, 0xb6, 0x58, 
+  0x92, 0x44, 0x49, 0x33, 0x00, 0x27, 0x00, 0x20, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x81, 0x00, 0x07, 0x01, 0x00, 0x04, 0x00, 0x03, 0xad, 0x00, 0x00, 0x03, 0x00, 0x04, 
+  0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x81, 0x00, 0x03, 0xb9, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x6c, 0xac, 0x0c, 0x6c, 0xac, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0a, 0xe5, 0x27, 0xac, 0xfd, 0x68, 0xcd, 0xfd, 0x9f, 0x0e, 0xfe, 0xcb, 0x50, 0xfe, 0xe8, 0x91, 0xfe, 0xfc, 0xb2, 0xfe, 0xff, 0xb2, 0xfe, 0xff, 0x91, 0xfe, 0xfc, 0x70, 0xfe, 0xe8, 0x50, 0xfe, 0xc8, 0x0f, 0xfe, 0x9f, 0xee, 0xfd, 0x67, 0x6c, 0xe5, 0x24, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xe4, 0x1b, 0x28, 0xfd, 0x7b, 0x6a, 0xfd, 0xd4, 0x8a, 0xfd, 0xff, 0x49, 0xfd, 0xff, 0xe8, 0xfc, 0xff, 0xa6, 0xfc, 0xff, 0x63, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0x63, 0xfc, 0xff, 0xa6, 0xfc, 0xff, 0x09, 0xfd, 0xff, 0x6b, 0xfd, 0xff, 0xcc, 0xfd, 0xff, 0xcc, 0xfd, 0xd3, 0x8b, 0xfd, 0x78, 0xc9, 0xdc, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xe4, 0x1f, 0xc6, 0xfc, 0x9b, 0x07, 0xfd, 0xf8, 0xc6, 0xfc, 0xff, 0x63, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x84, 0xfc, 0xff, 0x08, 0xfd, 0xff, 0x6a, 0xfd, 0xf7, 0x4a, 0xfd, 0x97, 0xc8, 0xe4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xaa, 0x08, 0x64, 0xfc, 0x7c, 0xa5, 0xfc, 0xf4, 0x64, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0xc6, 0xfc, 0xff, 0x28, 0xfd, 0xf4, 0x08, 0xfd, 0x78, 0x04, 0x93, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x20, 0x08, 0x04, 0x40, 0x18, 0x04, 0x61, 0x20, 0x04, 0x81, 0x28, 0x04, 0x81, 0x30, 0x04, 0xa1, 0x38, 0x04, 0xa1, 0x38, 0x04, 0xc2, 0xe3, 0x2b, 0x43, 0xfc, 0xcc, 0x42, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0xc6, 0xfc, 0xff, 0x07, 0xfd, 0xcb, 0x66, 0xe4, 0x27, 0xa1, 0x38, 0x04, 0xa1, 0x30, 0x04, 0x81, 0x30, 0x04, 0x61, 0x28, 0x04, 0x60, 0x20, 0x04, 0x40, 0x10, 0x04, 0x20, 0x08, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-  0x9e, 0xf7, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0x85, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x43, 0xfc, 0xff, 0x08, 0xfd, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe3, 0x00, 0x00, 0x07, 
-  0x3c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x97, 0xfe, 0xff, 0x42, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x21, 0xfc, 0xff, 0xa5, 0xfc, 0xff, 0xb8, 0xfe, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x3c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x97, 0xf6, 0xff, 0x42, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x84, 0xfc, 0xff, 0xb8, 0xf6, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x3c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x1b, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0xb8, 0xf6, 0xff, 0x43, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x84, 0xfc, 0xff, 0xb8, 0xf6, 0xff, 0x3c, 0xef, 0xff, 0x1a, 0xef, 0xff, 0x59, 0xef, 0xff, 0x59, 0xef, 0xff, 0x59, 0xef, 0xff, 0x1b, 0xe7, 0xff, 0x1a, 0xef, 0xff, 0x59, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x3c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3b, 0xef, 0xff, 0x9d, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x5c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x86, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xc0, 0xfb, 0xff, 0xa3, 0xeb, 0xff, 0x84, 0xd3, 0xff, 0xc6, 0xc3, 0xff, 0xc6, 0xbb, 0xff, 0xc6, 0xbb, 0xff, 0x68, 0xc3, 0xff, 0xa7, 0xd3, 0xff, 0xa2, 0xeb, 0xff, 0xc0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xa8, 0xfc, 0xff, 0xb6, 0xee, 0xff, 0xaf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x13, 0xef, 0xff, 0xb5, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0x3b, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x3c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x3c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x6e, 0xfd, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xc1, 0xf3, 0xff, 0xca, 0xc3, 0xff, 0xed, 0x9b, 0xff, 0x71, 0x94, 0xff, 0x91, 0x9c, 0xff, 0xcb, 0xa4, 0xff, 0x4b, 0xad, 0xff, 0x4b, 0xad, 0xff, 0xeb, 0xa4, 0xff, 0x50, 0x94, 0xff, 0x50, 0x94, 0xff, 0xcd, 0x9b, 0xff, 0xc9, 0xcb, 0xff, 0xc1, 0xf3, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x88, 0xfd, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf3, 0xee, 0xff, 0xb5, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x3b, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x7c, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x3b, 0xf7, 0xff, 0x76, 0xfe, 0xff, 0x01, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xca, 0xcb, 0xff, 0x70, 0x9c, 0xff, 0x13, 0xad, 0xff, 0xd6, 0xc5, 0xff, 0x17, 0xce, 0xff, 0xba, 0xe6, 0xff, 0x98, 0xe6, 0xff, 0xaf, 0xe6, 0xff, 0x6f, 0xf7, 0xff, 0x4f, 0xef, 0xff, 0xaf, 0xde, 0xff, 0xd5, 0xcd, 0xff, 0x95, 0xbd, 0xff, 0xb2, 0x9c, 0xff, 0x50, 0x9c, 0xff, 0xc9, 0xd3, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x01, 0xfc, 0xff, 0xcc, 0xfe, 0xff, 0xf3, 0xee, 0xff, 0xb5, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x72, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x7c, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xfa, 0xee, 0xff, 0xfa, 0xee, 0xff, 0x3b, 0xf7, 0xff, 0x1b, 0xf7, 0xff, 0x67, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xc2, 0xf3, 0xff, 0x2e, 0xac, 0xff, 0x13, 0xad, 0xff, 0x17, 0xce, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x9d, 0xff, 0xff, 0x71, 0xf7, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x50, 0xf7, 0xff, 0xb9, 0xee, 0xff, 0xb9, 0xe6, 0xff, 0x95, 0xbd, 0xff, 0xf3, 0xa4, 0xff, 0x0d, 0xb4, 0xff, 0xc1, 0xf3, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x45, 0xfc, 0xff, 0x74, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x72, 0xde, 0xff, 0x99, 0xde, 0xff, 0x1b, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xda, 0xe6, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xff, 0xff, 0xda, 0xee, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xee, 0xff, 0xd3, 0xf5, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xc4, 0xeb, 0xff, 0x70, 0xa4, 0xff, 0x95, 0xbd, 0xff, 0xba, 0xe6, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5b, 0xf7, 0xff, 0xfb, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xe6, 0xff, 0x30, 0xf7, 0xff, 0xf0, 0xff, 0xff, 0x6f, 0xf7, 0xff, 0x50, 0xf7, 0xff, 0xf9, 0xee, 0xff, 0x1b, 0xf7, 0xff, 0x37, 0xd6, 0xff, 0x54, 0xb5, 0xff, 0x4f, 0xac, 0xff, 0xc2, 0xf3, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x6b, 0xfe, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x72, 0xde, 0xff, 0x99, 0xde, 0xff, 0x78, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x3b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x5b, 0xf7, 0xff, 0xb9, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x67, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe2, 0xf3, 0xff, 0x70, 0xac, 0xff, 0xb6, 0xc5, 0xff, 0xfb, 0xee, 0xff, 0x7c, 0xff, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xe6, 0xff, 0x78, 0xde, 0xff, 0x37, 0xde, 0xff, 0x30, 0xef, 0xff, 0x8f, 0xf7, 0xff, 0x8f, 0xf7, 0xff, 0x50, 0xf7, 0xff, 0xf9, 0xee, 0xff, 0x3b, 0xf7, 0xff, 0x78, 0xde, 0xff, 0x95, 0xbd, 0xff, 0x4f, 0xac, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa5, 0xfc, 0xff, 0xaf, 0xff, 0xff, 0x72, 0xde, 0xff, 0x78, 0xde, 0xff, 0x78, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x1c, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x7d, 0xff, 0xff, 0x3b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0xf4, 0xe5, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0x4e, 0xbc, 0xff, 0xb6, 0xbd, 0xff, 0xfb, 0xee, 0xff, 0x7c, 0xff, 0xff, 0x5c, 0xf7, 0xff, 0x1b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xe6, 0xff, 0x78, 0xde, 0xff, 0x58, 0xde, 0xff, 0x58, 0xde, 0xff, 0x37, 0xde, 0xff, 0x30, 0xef, 0xff, 0xaf, 0xff, 0xff, 0xaf, 0xff, 0xff, 0x50, 0xf7, 0xff, 0xf9, 0xee, 0xff, 0x3b, 0xf7, 0xff, 0x78, 0xde, 0xff, 0x54, 0xb5, 0xff, 0x0b, 0xc4, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xaf, 0xdd, 0xff, 0x78, 0xde, 0xff, 0x58, 0xde, 0xff, 0xda, 0xe6, 0xff, 0xfb, 0xee, 0xff, 0x1c, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x7c, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xfa, 0xee, 0xff, 0x1b, 0xf7, 0xff, 0x4f, 0xf5, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x00, 0xfc, 0xff, 0x09, 0xdc, 0xff, 0x54, 0xb5, 0xff, 0xda, 0xe6, 0xff, 0x7c, 0xff, 0xff, 0x3b, 0xf7, 0xff, 0x1b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xe6, 0xff, 0x78, 0xde, 0xff, 0x37, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0x58, 0xde, 0xff, 0x36, 0xd6, 0xff, 0x2f, 0xef, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x50, 0xf7, 0xff, 0xd9, 0xee, 0xff, 0x3b, 0xf7, 0xff, 0x58, 0xde, 0xff, 0xf3, 0xac, 0xff, 0xc5, 0xe3, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xee, 0xec, 0xff, 0x37, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0xfa, 0xee, 0xff, 0xfb, 0xee, 0xff, 0x1b, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xda, 0xe6, 0xff, 0x7c, 0xff, 0xff, 0x1b, 0xf7, 0xff, 0x1a, 0xf7, 0xff, 0xd9, 0xee, 0xff, 0x25, 0xfc, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xb1, 0xb4, 0xff, 0x78, 0xde, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0x1a, 0xf7, 0xff, 0x1a, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xe6, 0xff, 0x58, 0xde, 0xff, 0x58, 0xde, 0xff, 0x78, 0xde, 0xff, 0x99, 0xde, 0xff, 0xfa, 0xee, 0xff, 0xda, 0xe6, 0xff, 0x57, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0x2f, 0xef, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x50, 0xf7, 0xff, 0xd9, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0x93, 0xc5, 0xff, 0x88, 0xbc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0x05, 0xf4, 0xff, 0x78, 0xde, 0xff, 0xfa, 0xe6, 0xff, 0xfa, 0xee, 0xff, 0xfa, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd9, 0xe6, 0xff, 0xfa, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0x1a, 0xf7, 0xff, 0x36, 0xe6, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x08, 0xe4, 0xff, 0x95, 0xbd, 0xff, 0x1b, 0xef, 0xff, 0x3b, 0xf7, 0xff, 0x1a, 0xf7, 0xff, 0x1a, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xe6, 0xff, 0x57, 0xde, 0xff, 0x58, 0xd6, 0xff, 0x78, 0xde, 0xff, 0x78, 0xde, 0xff, 0xfa, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0x37, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0x30, 0xef, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x50, 0xf7, 0xff, 0x75, 0xe6, 0xff, 0x2f, 0xef, 0xff, 0xcc, 0xbd, 0xff, 0x03, 0xec, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xb4, 0xcd, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0x1b, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd9, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0xfa, 0xf6, 0xff, 0xfa, 0xee, 0xff, 0xf4, 0xed, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0x6e, 0xc4, 0xff, 0x78, 0xde, 0xff, 0x1b, 0xef, 0xff, 0xfa, 0xf6, 0xff, 0x1a, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x99, 0xde, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0x37, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0x30, 0xef, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xad, 0xde, 0xff, 0x27, 0xcc, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x51, 0xdd, 0xff, 0x37, 0xd6, 0xff, 0xb9, 0xe6, 0xff, 0x37, 0xd6, 0xff, 0x1b, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd9, 0xee, 0xff, 0xfa, 0xee, 0xff, 0xfa, 0xee, 0xff, 0x3b, 0xf7, 0xff, 0x72, 0xed, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xf1, 0xb4, 0xff, 0x78, 0xde, 0xff, 0xfa, 0xf6, 0xff, 0xfa, 0xf6, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0xdf, 0xff, 0xff, 0x16, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x99, 0xde, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0x17, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0x2f, 0xf7, 0xff, 0xf0, 0xff, 0xff, 0x6f, 0xf7, 0xff, 0xd0, 0xff, 0xff, 0x50, 0xde, 0xff, 0x4c, 0xb4, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xcf, 0xdc, 0xff, 0x37, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x57, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xb8, 0xe6, 0xff, 0xfa, 0xee, 0xff, 0x5b, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0xef, 0xec, 0xff, 0xa0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe0, 0xfb, 0xff, 0xc2, 0xf3, 0xff, 0x74, 0xbd, 0xff, 0xd9, 0xee, 0xff, 0xd9, 0xf6, 0xff, 0xda, 0xee, 0xff, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xe6, 0xff, 0x37, 0xde, 0xff, 0xf6, 0xd5, 0xff, 0xfa, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x16, 0xd6, 0xff, 0x17, 0xd6, 0xff, 0x79, 0xde, 0xff, 0xda, 0xe6, 0xff, 0xba, 0xe6, 0xff, 0xba, 0xe6, 0xff, 0xba, 0xe6, 0xff, 0xd9, 0xe6, 0xff, 0x78, 0xde, 0xff, 0x16, 0xd6, 0xff, 0xf3, 0xd5, 0xff, 0x8f, 0xff, 0xff, 0xed, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xef, 0xff, 0xcc, 0xc5, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x6d, 0xe4, 0xff, 0xf6, 0xd5, 0xff, 0x37, 0xde, 0xff, 0x57, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xdb, 0xde, 0x70, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x99, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x1b, 0xf7, 0xff, 0xd9, 0xe6, 0xff, 0x8c, 0xec, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0x27, 0xec, 0xff, 0x95, 0xbd, 0xff, 0x77, 0xe6, 0xff, 0xb9, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x79, 0xde, 0xff, 0xf6, 0xd5, 0xff, 0xf6, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0xba, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0xd5, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0x58, 0xd6, 0xff, 0x99, 0xde, 0xff, 0x99, 0xde, 0xff, 0x99, 0xde, 0xff, 0x37, 0xd6, 0xff, 0xf6, 0xd5, 0xff, 0xd3, 0xcd, 0xff, 0x6f, 0xf7, 0xff, 0xaf, 0xff, 0xff, 0xaf, 0xff, 0xff, 0x4f, 0xf7, 0xff, 0xaf, 0xff, 0xff, 0x8f, 0xf7, 0xff, 0x4c, 0xce, 0xff, 0xe1, 0xf3, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x2a, 0xe4, 0xff, 0xd5, 0xcd, 0xff, 0x16, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 
-  0xba, 0xd6, 0x70, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x98, 0xde, 0xff, 0xda, 0xee, 0xff, 0xda, 0xee, 0xff, 0x78, 0xde, 0xff, 0x4a, 0xec, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0x07, 0xe4, 0xff, 0x9a, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x58, 0xde, 0xff, 0xd5, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0x58, 0xde, 0xff, 0x37, 0xd6, 0xff, 0xb5, 0xcd, 0xff, 0xb4, 0xc5, 0xff, 0x99, 0xde, 0xff, 0x5d, 0xef, 0xff, 0x94, 0xc5, 0xff, 0xb5, 0xcd, 0xff, 0x37, 0xd6, 0xff, 0x58, 0xde, 0xff, 0x17, 0xce, 0xff, 0xb5, 0xcd, 0xff, 0x92, 0xc5, 0xff, 0x2e, 0xef, 0xff, 0x8e, 0xf7, 0xff, 0x8f, 0xf7, 0xff, 0x50, 0xde, 0xff, 0xf1, 0xd5, 0xff, 0x8f, 0xf7, 0xff, 0x6f, 0xf7, 0xff, 0x4d, 0xd6, 0xff, 0x02, 0xf4, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x08, 0xe4, 0xff, 0x94, 0xc5, 0xff, 0xd5, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0xba, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x9a, 0xd6, 0x70, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0x58, 0xd6, 0xff, 0xb9, 0xe6, 0xff, 0xb9, 0xe6, 0xff, 0x17, 0xce, 0xff, 0x09, 0xe4, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe6, 0xeb, 0xff, 0xd7, 0xc5, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x37, 0xd6, 0xff, 0x94, 0xcd, 0xff, 0xb5, 0xc5, 0xff, 0x37, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x16, 0xce, 0xff, 0x94, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0xd6, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0x71, 0xc5, 0xff, 0x0d, 0xe7, 0xff, 0x4e, 0xef, 0xff, 0x4e, 0xef, 0xff, 0x30, 0xd6, 0xff, 0xd1, 0xcd, 0xff, 0x2e, 0xef, 0xff, 0x4e, 0xef, 0xff, 0x2e, 0xef, 0xff, 0x4c, 0xce, 0xff, 0xe2, 0xf3, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xe9, 0xe3, 0xff, 0x53, 0xbd, 0xff, 0x73, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x79, 0xd6, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0xfb, 0xde, 0xe4, 0x00, 0x00, 0x0b, 
-  0x59, 0xce, 0x70, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xd6, 0xcd, 0xff, 0x58, 0xde, 0xff, 0x37, 0xd6, 0xff, 0xb4, 0xc5, 0xff, 0x0a, 0xe4, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xc0, 0xfb, 0xff, 0xe4, 0xf3, 0xff, 0x59, 0xd6, 0xff, 0x1c, 0xef, 0xff, 0xf6, 0xcd, 0xff, 0x73, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0xf6, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0xd6, 0xcd, 0xff, 0x74, 0xbd, 0xff, 0x74, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0x31, 0xbd, 0xff, 0xcd, 0xe6, 0xff, 0x2d, 0xef, 0xff, 0x2d, 0xef, 0xff, 0x0f, 0xd6, 0xff, 0x91, 0xcd, 0xff, 0xee, 0xe6, 0xff, 0x0e, 0xef, 0xff, 0x0e, 0xef, 0xff, 0xd0, 0xcd, 0xff, 0x6c, 0xbd, 0xff, 0xe1, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xc9, 0xdb, 0xff, 0x54, 0xbd, 0xff, 0x79, 0xd6, 0xff, 0x33, 0xbd, 0xff, 0x58, 0xce, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xe4, 0x00, 0x00, 0x0b, 
-  0x38, 0xc6, 0x70, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xd5, 0xcd, 0xff, 0xb5, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0x94, 0xc5, 0xff, 0x0c, 0xd4, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc1, 0xfb, 0xff, 0x17, 0xce, 0xff, 0xb5, 0xcd, 0xff, 0x32, 0xbd, 0xff, 0x33, 0xbd, 0xff, 0xd5, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0xb5, 0xc5, 0xff, 0xd5, 0xcd, 0xff, 0xd6, 0xcd, 0xff, 0xd6, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x33, 0xb5, 0xff, 0x53, 0xbd, 0xff, 0x53, 0xbd, 0xff, 0x53, 0xbd, 0xff, 0x10, 0xb5, 0xff, 0xad, 0xde, 0xff, 0xed, 0xe6, 0xff, 0xed, 0xe6, 0xff, 0xcf, 0xcd, 0xff, 0x70, 0xc5, 0xff, 0xcd, 0xde, 0xff, 0xed, 0xe6, 0xff, 0xcd, 0xe6, 0xff, 0xaf, 0xcd, 0xff, 0xd5, 0xd5, 0xff, 0xd0, 0xbc, 0xff, 0xc0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x2d, 0xd4, 0xff, 0x9a, 0xd6, 0xff, 0x74, 0xbd, 0xff, 0x53, 0xbd, 0xff, 0x17, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xe4, 0x00, 0x00, 0x0b, 
-  0xf8, 0xc5, 0x70, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x74, 0xbd, 0xff, 0xb4, 0xcd, 0xff, 0xb4, 0xcd, 0xff, 0x53, 0xbd, 0xff, 0x2d, 0xc4, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x8e, 0xc4, 0xff, 0xf1, 0xbc, 0xff, 0xf2, 0xb4, 0xff, 0x94, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0x95, 0xc5, 0xff, 0x53, 0xbd, 0xff, 0xf2, 0xb4, 0xff, 0x54, 0xbd, 0xff, 0x95, 0xc5, 0xff, 0x95, 0xc5, 0xff, 0x95, 0xc5, 0xff, 0x74, 0xbd, 0xff, 0xf2, 0xb4, 0xff, 0x12, 0xb5, 0xff, 0xef, 0xb4, 0xff, 0x6c, 0xd6, 0xff, 0xad, 0xde, 0xff, 0xad, 0xde, 0xff, 0x8e, 0xc5, 0xff, 0x2f, 0xbd, 0xff, 0x8d, 0xde, 0xff, 0xad, 0xde, 0xff, 0xad, 0xde, 0xff, 0x6f, 0xc5, 0xff, 0x94, 0xcd, 0xff, 0x94, 0xcd, 0xff, 0xae, 0xd4, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xd1, 0xcc, 0xff, 0x13, 0xad, 0xff, 0x12, 0xb5, 0xff, 0x12, 0xb5, 0xff, 0xf7, 0xc5, 0xff, 0x79, 0xce, 0xff, 0x79, 0xce, 0xff, 0x59, 0xce, 0xe4, 0x00, 0x00, 0x0b, 
-  0xd7, 0xbd, 0x70, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0xd6, 0xc5, 0xff, 0x53, 0xbd, 0xff, 0x74, 0xc5, 0xff, 0x33, 0xbd, 0xff, 0x6f, 0xac, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x09, 0xdc, 0xff, 0xb0, 0xac, 0xff, 0xd1, 0xb4, 0xff, 0x33, 0xbd, 0xff, 0x54, 0xbd, 0xff, 0x54, 0xbd, 0xff, 0x12, 0xb5, 0xff, 0xd1, 0xb4, 0xff, 0xd1, 0xb4, 0xff, 0x33, 0xb5, 0xff, 0x74, 0xbd, 0xff, 0x74, 0xbd, 0xff, 0x13, 0xb5, 0xff, 0xd1, 0xac, 0xff, 0xaf, 0xac, 0xff, 0x4c, 0xce, 0xff, 0x8c, 0xd6, 0xff, 0x8c, 0xd6, 0xff, 0x6e, 0xbd, 0xff, 0x0f, 0xb5, 0xff, 0x4c, 0xd6, 0xff, 0x6c, 0xd6, 0xff, 0x6c, 0xd6, 0xff, 0x4e, 0xbd, 0xff, 0x73, 0xc5, 0xff, 0x73, 0xc5, 0xff, 0xce, 0xa4, 0xff, 0x49, 0xe4, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xcc, 0x9b, 0xff, 0xb1, 0xac, 0xff, 0xf1, 0xb4, 0xff, 0xf1, 0xac, 0xff, 0xb6, 0xbd, 0xff, 0x39, 0xce, 0xff, 0x39, 0xce, 0xff, 0x38, 0xc6, 0xe4, 0x00, 0x00, 0x0b, 
-  0x96, 0xb5, 0x70, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf7, 0xc5, 0xff, 0x38, 0xce, 0xff, 0x33, 0xb5, 0xff, 0x32, 0xbd, 0xff, 0x4f, 0x9c, 0xff, 0x61, 0xf3, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xc3, 0xfb, 0xff, 0x90, 0xac, 0xff, 0x90, 0xac, 0xff, 0x90, 0xac, 0xff, 0xf2, 0xb4, 0xff, 0x33, 0xbd, 0xff, 0x33, 0xbd, 0xff, 0xb1, 0xac, 0xff, 0xb0, 0xac, 0xff, 0xb0, 0xac, 0xff, 0xf2, 0xb4, 0xff, 0xf2, 0xac, 0xff, 0xb0, 0xac, 0xff, 0x8e, 0xa4, 0xff, 0x0c, 0xce, 0xff, 0x4c, 0xd6, 0xff, 0x4c, 0xd6, 0xff, 0x4d, 0xbd, 0xff, 0xce, 0xb4, 0xff, 0x2c, 0xce, 0xff, 0x4c, 0xd6, 0xff, 0x4c, 0xd6, 0xff, 0x0e, 0xbd, 0xff, 0x32, 0xc5, 0xff, 0x32, 0xc5, 0xff, 0xce, 0xa4, 0xff, 0x8a, 0x9c, 0xff, 0x03, 0xfc, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x62, 0xf3, 0xff, 0xee, 0x8b, 0xff, 0xb0, 0xac, 0xff, 0xb1, 0xac, 0xff, 0xb1, 0xac, 0xff, 0x95, 0xb5, 0xff, 0x18, 0xc6, 0xff, 0x18, 0xc6, 0xff, 0xf8, 0xc5, 0xe4, 0x00, 0x00, 0x0b, 
-  0x75, 0xad, 0x70, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0x96, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0xb6, 0xbd, 0xff, 0xf2, 0xb4, 0xff, 0x70, 0xa4, 0xff, 0x67, 0xd3, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x6c, 0xd4, 0xff, 0xb1, 0xac, 0xff, 0x6f, 0xac, 0xff, 0x6f, 0xa4, 0xff, 0xd1, 0xac, 0xff, 0xb1, 0xac, 0xff, 0x6f, 0xa4, 0xff, 0x70, 0xac, 0xff, 0x70, 0xac, 0xff, 0x70, 0xa4, 0xff, 0x70, 0xa4, 0xff, 0x4d, 0xa4, 0xff, 0xcb, 0xc5, 0xff, 0x0b, 0xce, 0xff, 0x0b, 0xce, 0xff, 0x0d, 0xb5, 0xff, 0xad, 0xac, 0xff, 0xeb, 0xcd, 0xff, 0x0b, 0xce, 0xff, 0x0b, 0xce, 0xff, 0xed, 0xb4, 0xff, 0xf1, 0xbc, 0xff, 0x11, 0xbd, 0xff, 0x8d, 0x9c, 0xff, 0x8a, 0x8c, 0xff, 0x88, 0xd4, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x46, 0xd3, 0xff, 0x0e, 0x94, 0xff, 0x70, 0xa4, 0xff, 0x90, 0xa4, 0xff, 0x90, 0xa4, 0xff, 0x55, 0xb5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xe4, 0x00, 0x00, 0x0b, 
-  0x35, 0xad, 0x70, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0xb1, 0xa4, 0xff, 0x95, 0xb5, 0xff, 0x75, 0xb5, 0xff, 0x96, 0xbd, 0xff, 0x70, 0x9c, 0xff, 0x8a, 0xab, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x03, 0xfc, 0xff, 0x8f, 0xb4, 0xff, 0x90, 0xac, 0xff, 0x2f, 0xa4, 0xff, 0x2f, 0xa4, 0xff, 0x4f, 0xa4, 0xff, 0x4f, 0xa4, 0xff, 0x4f, 0xa4, 0xff, 0x4f, 0xa4, 0xff, 0x4f, 0xa4, 0xff, 0x2d, 0x9c, 0xff, 0xab, 0xbd, 0xff, 0xeb, 0xc5, 0xff, 0xeb, 0xc5, 0xff, 0xec, 0xac, 0xff, 0x8d, 0xac, 0xff, 0xab, 0xc5, 0xff, 0xab, 0xc5, 0xff, 0xcb, 0xc5, 0xff, 0xac, 0xac, 0xff, 0xd1, 0xb4, 0xff, 0xd1, 0xb4, 0xff, 0x6d, 0x9c, 0xff, 0x6a, 0x8c, 0xff, 0x69, 0xa4, 0xff, 0x25, 0xfc, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0xa6, 0xab, 0xff, 0xed, 0x93, 0xff, 0x4f, 0x9c, 0xff, 0x50, 0x9c, 0xff, 0x6f, 0x9c, 0xff, 0x34, 0xad, 0xff, 0xb6, 0xb5, 0xff, 0xb6, 0xb5, 0xff, 0x96, 0xb5, 0xe4, 0x00, 0x00, 0x0b, 
-  0x14, 0xa5, 0x70, 0x76, 0xb5, 0xff, 0x76, 0xb5, 0xff, 0x76, 0xb5, 0xff, 0xb1, 0xa4, 0xff, 0xb0, 0xa4, 0xff, 0x55, 0xb5, 0xff, 0x75, 0xb5, 0xff, 0x55, 0xb5, 0xff, 0xad, 0x83, 0xff, 0x41, 0xf3, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xa0, 0xfb, 0xff, 0x48, 0xec, 0xff, 0x90, 0xac, 0xff, 0x70, 0xa4, 0xff, 0x0e, 0x9c, 0xff, 0x2e, 0xa4, 0xff, 0x2e, 0xa4, 0xff, 0x2e, 0x9c, 0xff, 0x2e, 0x9c, 0xff, 0x0c, 0x9c, 0xff, 0x6b, 0xbd, 0xff, 0xab, 0xbd, 0xff, 0xab, 0xbd, 0xff, 0xac, 0xac, 0xff, 0x4c, 0xa4, 0xff, 0x8b, 0xbd, 0xff, 0x4a, 0xb5, 0xff, 0x6a, 0xbd, 0xff, 0x8c, 0xac, 0xff, 0xb0, 0xac, 0xff, 0xb0, 0xb4, 0xff, 0x4c, 0x94, 0xff, 0x49, 0x84, 0xff, 0x49, 0x8c, 0xff, 0xa8, 0xf4, 0xff, 0xa0, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x61, 0xf3, 0xff, 0x88, 0x9c, 0xff, 0xea, 0xac, 0xff, 0x0e, 0x94, 0xff, 0x2f, 0x9c, 0xff, 0x4f, 0x9c, 0xff, 0x13, 0xa5, 0xff, 0x76, 0xb5, 0xff, 0x76, 0xb5, 0xff, 0x75, 0xad, 0xe4, 0x00, 0x00, 0x0b, 
-  0x9a, 0xd6, 0x70, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x15, 0xce, 0xff, 0x78, 0xde, 0xff, 0x57, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x79, 0xd6, 0xff, 0x6e, 0xd4, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xc2, 0xfb, 0xff, 0xec, 0xec, 0xff, 0x57, 0xde, 0xff, 0x37, 0xd6, 0xff, 0xd5, 0xcd, 0xff, 0xf6, 0xd5, 0xff, 0xf6, 0xd5, 0xff, 0xd3, 0xcd, 0xff, 0x32, 0xef, 0xff, 0x72, 0xf7, 0xff, 0x72, 0xf7, 0xff, 0x73, 0xde, 0xff, 0x34, 0xd6, 0xff, 0x52, 0xef, 0xff, 0x11, 0xe7, 0xff, 0x52, 0xef, 0xff, 0x54, 0xde, 0xff, 0x77, 0xe6, 0xff, 0x77, 0xe6, 0xff, 0x13, 0xc6, 0xff, 0x11, 0xbe, 0xff, 0xf0, 0xbd, 0xff, 0x0a, 0xed, 0xff, 0xc3, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x49, 0xcc, 0xff, 0x90, 0xd6, 0xff, 0x52, 0xef, 0xff, 0xf2, 0xe6, 0xff, 0xd5, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0x9a, 0xde, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x95, 0xce, 0xff, 0x96, 0xd6, 0xff, 0xfa, 0xf6, 0xff, 0xd9, 0xee, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd7, 0xc5, 0xff, 0x63, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xe3, 0xfb, 0xff, 0x6f, 0xfd, 0xff, 0xd9, 0xee, 0xff, 0x78, 0xe6, 0xff, 0x78, 0xe6, 0xff, 0x55, 0xde, 0xff, 0xb4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf5, 0xee, 0xff, 0x96, 0xe6, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xd5, 0xee, 0xff, 0xfa, 0xf6, 0xff, 0xfa, 0xf6, 0xff, 0x95, 0xd6, 0xff, 0x93, 0xce, 0xff, 0x72, 0xce, 0xff, 0x8c, 0xf5, 0xff, 0x04, 0xfc, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x62, 0xf3, 0xff, 0x12, 0xb5, 0xff, 0x13, 0xef, 0xff, 0xd3, 0xff, 0xff, 0x93, 0xf7, 0xff, 0x73, 0xf7, 0xff, 0x57, 0xde, 0xff, 0x3c, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x95, 0xce, 0xff, 0xb3, 0xc6, 0xff, 0x95, 0xd6, 0xff, 0xfa, 0xee, 0xff, 0xd9, 0xee, 0xff, 0x7d, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0x8f, 0xd4, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x04, 0xfc, 0xff, 0x2c, 0xfd, 0xff, 0x15, 0xe6, 0xff, 0x55, 0xde, 0xff, 0xb4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf5, 0xee, 0xff, 0x96, 0xe6, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xd5, 0xee, 0xff, 0xf9, 0xf6, 0xff, 0xfa, 0xf6, 0xff, 0x95, 0xd6, 0xff, 0x93, 0xce, 0xff, 0x51, 0xde, 0xff, 0x6c, 0xfd, 0xff, 0x05, 0xfc, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x0d, 0xc4, 0xff, 0xf6, 0xcd, 0xff, 0xb8, 0xe6, 0xff, 0x73, 0xf7, 0xff, 0xd3, 0xff, 0xff, 0xb3, 0xff, 0xff, 0x73, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x95, 0xce, 0xff, 0xb2, 0xc6, 0xff, 0xb2, 0xc6, 0xff, 0x95, 0xd6, 0xff, 0xfa, 0xee, 0xff, 0xd9, 0xee, 0xff, 0x1c, 0xe7, 0xff, 0xf8, 0xc5, 0xff, 0xa8, 0xeb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0xc3, 0xfb, 0xff, 0xc8, 0xfc, 0xff, 0x2e, 0xfe, 0xff, 0x32, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xee, 0xff, 0x95, 0xe6, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xd5, 0xee, 0xff, 0xf9, 0xf6, 0xff, 0xf9, 0xf6, 0xff, 0x95, 0xd6, 0xff, 0x51, 0xd6, 0xff, 0xef, 0xf5, 0xff, 0x0a, 0xfd, 0xff, 0xc3, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x64, 0xe3, 0xff, 0xee, 0x94, 0xff, 0x77, 0xde, 0xff, 0xfa, 0xee, 0xff, 0xb8, 0xee, 0xff, 0x73, 0xf7, 0xff, 0xd2, 0xff, 0xff, 0xf3, 0xff, 0xff, 0x3b, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x94, 0xce, 0xff, 0x92, 0xbe, 0xff, 0x92, 0xbe, 0xff, 0x92, 0xbe, 0xff, 0x95, 0xd6, 0xff, 0xf9, 0xee, 0xff, 0xb9, 0xee, 0xff, 0x79, 0xd6, 0xff, 0x34, 0xbd, 0xff, 0x41, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x46, 0xfc, 0xff, 0x2b, 0xfd, 0xff, 0xee, 0xfd, 0xff, 0x12, 0xf6, 0xff, 0x52, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xb4, 0xee, 0xff, 0xd8, 0xf6, 0xff, 0xb7, 0xf6, 0xff, 0x53, 0xf6, 0xff, 0x0f, 0xfe, 0xff, 0x6c, 0xfd, 0xff, 0x47, 0xfc, 0xff, 0x80, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x41, 0xf3, 0xff, 0x4b, 0x9c, 0xff, 0xd0, 0xad, 0xff, 0x72, 0xc6, 0xff, 0xd8, 0xe6, 0xff, 0xf9, 0xee, 0xff, 0xb8, 0xee, 0xff, 0x73, 0xf7, 0xff, 0xf2, 0xff, 0xff, 0x3b, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x94, 0xce, 0xff, 0x91, 0xbe, 0xff, 0x92, 0xbe, 0xff, 0x92, 0xbe, 0xff, 0x92, 0xbe, 0xff, 0x75, 0xce, 0xff, 0xd9, 0xee, 0xff, 0x98, 0xe6, 0xff, 0xf7, 0xc5, 0xff, 0x90, 0xc4, 0xff, 0x40, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x04, 0xfc, 0xff, 0xea, 0xfc, 0xff, 0x6c, 0xfd, 0xff, 0xef, 0xfd, 0xff, 0x51, 0xfe, 0xff, 0x51, 0xfe, 0xff, 0xef, 0xfd, 0xff, 0x8d, 0xfd, 0xff, 0xea, 0xfc, 0xff, 0x04, 0xfc, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0xe9, 0xab, 0xff, 0x4e, 0x9d, 0xff, 0x51, 0xbe, 0xff, 0x92, 0xbe, 0xff, 0x72, 0xc6, 0xff, 0xb8, 0xe6, 0xff, 0xf9, 0xee, 0xff, 0xb8, 0xee, 0xff, 0x72, 0xf7, 0xff, 0x3b, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x94, 0xc6, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x75, 0xce, 0xff, 0xd9, 0xee, 0xff, 0x57, 0xde, 0xff, 0x96, 0xbd, 0xff, 0x2d, 0xcc, 0xff, 0x40, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0xa7, 0xbb, 0xff, 0xed, 0x94, 0xff, 0x10, 0xb6, 0xff, 0x71, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x72, 0xbe, 0xff, 0xb8, 0xe6, 0xff, 0xf9, 0xee, 0xff, 0xb8, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x74, 0xc6, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x74, 0xce, 0xff, 0xd9, 0xee, 0xff, 0x16, 0xd6, 0xff, 0x55, 0xb5, 0xff, 0x0c, 0xd4, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x86, 0xbb, 0xff, 0xac, 0x8c, 0xff, 0xef, 0xad, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x91, 0xbe, 0xff, 0x72, 0xbe, 0xff, 0xb8, 0xe6, 0xff, 0xd9, 0xee, 0xff, 0x1b, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x74, 0xc6, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x74, 0xce, 0xff, 0xb9, 0xee, 0xff, 0xf6, 0xd5, 0xff, 0x55, 0xad, 0xff, 0x0d, 0xcc, 0xff, 0x20, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x60, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x87, 0xb3, 0xff, 0xac, 0x84, 0xff, 0xcf, 0xad, 0xff, 0x50, 0xb6, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0x71, 0xbe, 0xff, 0xb8, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x74, 0xc6, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x71, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x54, 0xce, 0xff, 0xb9, 0xee, 0xff, 0xf6, 0xd5, 0xff, 0x55, 0xb5, 0xff, 0x70, 0xbc, 0xff, 0x22, 0xf3, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x01, 0xeb, 0xff, 0xa8, 0x9b, 0xff, 0xac, 0x8c, 0xff, 0xcf, 0xa5, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x71, 0xbe, 0xff, 0x1b, 0xe7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0x1c, 0xe7, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x74, 0xc6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x54, 0xce, 0xff, 0xb9, 0xee, 0xff, 0x16, 0xd6, 0xff, 0x32, 0xad, 0xff, 0xaa, 0xac, 0xff, 0x85, 0xdb, 0xff, 0x20, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x24, 0xd3, 0xff, 0xe9, 0x83, 0xff, 0xcc, 0x8c, 0xff, 0xcf, 0xad, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x1b, 0xe7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfc, 0xe6, 0x70, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x73, 0xc6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x96, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x75, 0xe6, 0xff, 0x50, 0xef, 0xff, 0x6e, 0xd6, 0xff, 0x4b, 0xad, 0xff, 0xa9, 0xab, 0xff, 0x03, 0xe3, 0xff, 0x20, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x03, 0xdb, 0xff, 0x88, 0x9b, 0xff, 0x4b, 0x7c, 0xff, 0x2d, 0x95, 0xff, 0xef, 0xad, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x1b, 0xe7, 0xff, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfc, 0xe6, 0x70, 0xbe, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x73, 0xc6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x76, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x75, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xcd, 0xff, 0xce, 0xac, 0xff, 0x0a, 0xa5, 0xff, 0x28, 0xb4, 0xff, 0x64, 0xdb, 0xff, 0x00, 0xf3, 0xff, 0x20, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x40, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x00, 0xf3, 0xff, 0x26, 0xd3, 0xff, 0x8b, 0xa3, 0xff, 0x0a, 0x74, 0xff, 0xcc, 0x8c, 0xff, 0xae, 0xa5, 0xff, 0x2f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x51, 0xb6, 0xff, 0x1b, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfc, 0xe6, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x73, 0xc6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x76, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x75, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xd2, 0xe6, 0xff, 0x53, 0xde, 0xff, 0x6f, 0xf7, 0xff, 0xee, 0xde, 0xff, 0xec, 0xc5, 0xff, 0x0c, 0x8c, 0xff, 0x8c, 0x8b, 0xff, 0x29, 0xab, 0xff, 0x27, 0xcb, 0xff, 0x03, 0xe3, 0xff, 0x00, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x00, 0xfb, 0xff, 0xe2, 0xe2, 0xff, 0x48, 0xcb, 0xff, 0xed, 0xb3, 0xff, 0x50, 0x9c, 0xff, 0x50, 0x94, 0xff, 0x13, 0xb5, 0xff, 0xb3, 0xbd, 0xff, 0x0f, 0xae, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x6f, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x3a, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfc, 0xe6, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x53, 0xc6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x97, 0xde, 0xff, 0xfa, 0xee, 0xff, 0x96, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xd2, 0xe6, 0xff, 0x74, 0xde, 0xff, 0xd0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x11, 0xd6, 0xff, 0x94, 0xc5, 0xff, 0xf2, 0xac, 0xff, 0xd2, 0xa4, 0xff, 0x71, 0x94, 0xff, 0x0f, 0x8c, 0xff, 0xad, 0x93, 0xff, 0x01, 0xf3, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x01, 0xf3, 0xff, 0x6c, 0x83, 0xff, 0xae, 0x83, 0xff, 0x0f, 0x8c, 0xff, 0x75, 0xb5, 0xff, 0x7a, 0xd6, 0xff, 0xdb, 0xe6, 0xff, 0x78, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x97, 0xde, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x3a, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfc, 0xe6, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x53, 0xc6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0xb7, 0xde, 0xff, 0x1b, 0xf7, 0xff, 0x96, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf3, 0xee, 0xff, 0x94, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0x4e, 0xef, 0xff, 0xaf, 0xf7, 0xff, 0x72, 0xde, 0xff, 0x58, 0xde, 0xff, 0x57, 0xd6, 0xff, 0x99, 0xde, 0xff, 0x99, 0xde, 0xff, 0x58, 0xd6, 0xff, 0xf7, 0xcd, 0xff, 0x34, 0xad, 0xff, 0x6a, 0xbb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0xac, 0xbb, 0xff, 0x34, 0xad, 0xff, 0x74, 0xbd, 0xff, 0xd6, 0xcd, 0xff, 0x17, 0xd6, 0xff, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xd9, 0xee, 0xff, 0x1b, 0xf7, 0xff, 0xb8, 0xde, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x1a, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfc, 0xe6, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x73, 0xc6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0xd8, 0xde, 0xff, 0x5c, 0xf7, 0xff, 0xd7, 0xe6, 0xff, 0xaf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf3, 0xee, 0xff, 0x95, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0x8f, 0xf7, 0xff, 0xcf, 0xff, 0xff, 0x73, 0xde, 0xff, 0x99, 0xde, 0xff, 0x78, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0xfb, 0xee, 0xff, 0xfb, 0xe6, 0xff, 0xda, 0xe6, 0xff, 0x17, 0xce, 0xff, 0xd2, 0xa4, 0xff, 0x25, 0xe3, 0xff, 0x20, 0xfb, 0xff, 0x20, 0xfb, 0xff, 0x26, 0xe3, 0xff, 0x14, 0xad, 0xff, 0x99, 0xde, 0xff, 0xba, 0xde, 0xff, 0x79, 0xde, 0xff, 0x99, 0xde, 0xff, 0x99, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xfa, 0xee, 0xff, 0x5c, 0xf7, 0xff, 0xd8, 0xde, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x50, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfc, 0xe6, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x73, 0xc6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xae, 0xff, 0x4f, 0xb6, 0xff, 0xf9, 0xe6, 0xff, 0x7d, 0xff, 0xff, 0xf8, 0xee, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x13, 0xef, 0xff, 0xb5, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x36, 0xef, 0xff, 0x78, 0xde, 0xff, 0xba, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x1c, 0xef, 0xff, 0x1c, 0xef, 0xff, 0x1c, 0xef, 0xff, 0x1b, 0xe7, 0xff, 0x99, 0xde, 0xff, 0xba, 0xde, 0xff, 0xf7, 0xc5, 0xff, 0x0f, 0xa4, 0xff, 0x00, 0xfb, 0xff, 0x00, 0xfb, 0xff, 0x70, 0xac, 0xff, 0x58, 0xd6, 0xff, 0xdb, 0xe6, 0xff, 0xba, 0xde, 0xff, 0xba, 0xe6, 0xff, 0x79, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x3c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x7d, 0xff, 0xff, 0xf9, 0xe6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xae, 0xff, 0x4f, 0xae, 0xff, 0x4f, 0xae, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 0xae, 0xff, 0x50, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x73, 0xc6, 0xff, 0x4e, 0xae, 0xff, 0x4f, 0xb6, 0xff, 0x3a, 0xe7, 0xff, 0xbe, 0xff, 0xff, 0x19, 0xef, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x14, 0xef, 0xff, 0xd6, 0xe6, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb3, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x1c, 0xef, 0xff, 0xba, 0xde, 0xff, 0xba, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0xba, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x79, 0xd6, 0xff, 0xb6, 0xbd, 0xff, 0xab, 0xcb, 0xff, 0xab, 0xc3, 0xff, 0xd7, 0xbd, 0xff, 0xdb, 0xe6, 0xff, 0xda, 0xde, 0xff, 0xdb, 0xe6, 0xff, 0x99, 0xde, 0xff, 0xff, 0xff, 0xff, 0xda, 0xe6, 0xff, 0xba, 0xde, 0xff, 0xba, 0xde, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xff, 0xff, 0x3c, 0xef, 0xff, 0xbe, 0xff, 0xff, 0x1a, 0xe7, 0xff, 0x2f, 0xae, 0xff, 0x4e, 0xae, 0xff, 0x4f, 0xae, 0xff, 0x4e, 0xae, 0xff, 0x30, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x73, 0xc6, 0xff, 0x4f, 0xae, 0xff, 0x3b, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0x39, 0xef, 0xff, 0xcf, 0xff, 0xff, 0x6e, 0xf7, 0xff, 0xef, 0xff, 0xff, 0x34, 0xef, 0xff, 0xf7, 0xee, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb4, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x99, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x1c, 0xef, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x5d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0x55, 0xad, 0xff, 0x55, 0xad, 0xff, 0xba, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x9a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xda, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x5c, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x5b, 0xe7, 0xff, 0x4f, 0xae, 0xff, 0x4e, 0xae, 0xff, 0x2f, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xae, 0xff, 0xfb, 0xad, 0xff, 0xfb, 0xa5, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x74, 0xc6, 0xff, 0x5b, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xef, 0xff, 0xaf, 0xff, 0xff, 0x4e, 0xef, 0xff, 0xef, 0xff, 0xff, 0x35, 0xef, 0xff, 0x17, 0xef, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb4, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0xba, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xda, 0xe6, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0xfb, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0xfc, 0xe6, 0xff, 0x3c, 0xe7, 0xff, 0x9a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0xdb, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0xff, 0x5c, 0xef, 0xff, 0x9e, 0xff, 0xff, 0xd9, 0xde, 0xff, 0x31, 0xb6, 0xff, 0x52, 0xbe, 0xff, 0x58, 0xc6, 0xff, 0x7b, 0xce, 0xff, 0xbb, 0xce, 0xff, 0xdb, 0xd6, 0xff, 0xdc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xf7, 0xff, 0xcf, 0xff, 0xff, 0xee, 0xff, 0xff, 0xce, 0xff, 0xff, 0x34, 0xef, 0xff, 0x17, 0xef, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb4, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0xba, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0xfb, 0xde, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x58, 0xd6, 0xff, 0xba, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1b, 0xe7, 0xff, 0x5c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5a, 0xf7, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xee, 0xff, 0xff, 0x34, 0xef, 0xff, 0xf7, 0xee, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xb4, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0xda, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x1b, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd8, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0x34, 0xef, 0xff, 0xd7, 0xe6, 0xff, 0x8e, 0xf7, 0xff, 0x8f, 0xf7, 0xff, 0x90, 0xf7, 0xff, 0xb4, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xe7, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x1c, 0xe7, 0xdb, 0xfb, 0xde, 0xcb, 0xdb, 0xde, 0xbb, 0xbb, 0xde, 0x97, 0x00, 0x00, 0x08, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x59, 0xef, 0xff, 0x58, 0xef, 0xff, 0x59, 0xef, 0xff, 0x3a, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xfc, 0x5d, 0xef, 0xf0, 0x3c, 0xe7, 0xe3, 0xfc, 0xe6, 0xd3, 0xdb, 0xde, 0xc3, 0xdb, 0xde, 0xb3, 0xdb, 0xde, 0xa3, 0x9a, 0xd6, 0x90, 0x38, 0xc6, 0x7f, 0x96, 0xb5, 0x6c, 0xd3, 0x9c, 0x58, 0xaf, 0x7b, 0x44, 0xa7, 0x39, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x1c, 0xe7, 0xdb, 0xfb, 0xde, 0xcb, 0xdb, 0xde, 0xbb, 0xdb, 0xde, 0xab, 0xdb, 0xde, 0x98, 0x79, 0xce, 0x88, 0xd7, 0xbd, 0x77, 0x35, 0xad, 0x63, 0x51, 0x8c, 0x4f, 0xcb, 0x5a, 0x3c, 0x62, 0x10, 0x2b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xfc, 0x5d, 0xef, 0xf0, 0x3c, 0xe7, 0xe3, 0xfc, 0xe6, 0xd3, 0xdb, 0xde, 0xc3, 0xdb, 0xde, 0xb3, 0xdb, 0xde, 0xa3, 0x9a, 0xd6, 0x90, 0x38, 0xc6, 0x7f, 0x96, 0xb5, 0x6c, 0xd3, 0x9c, 0x58, 0xaf, 0x7b, 0x44, 0xa7, 0x39, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xfb, 0xde, 0x70, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x1c, 0xe7, 0xdb, 0xfb, 0xde, 0xcb, 0xdb, 0xde, 0xbb, 0xdb, 0xde, 0xab, 0xdb, 0xde, 0x98, 0x79, 0xce, 0x88, 0xd7, 0xbd, 0x77, 0x35, 0xad, 0x63, 0x51, 0x8c, 0x4f, 0xeb, 0x5a, 0x3c, 0x62, 0x10, 0x2b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x59, 0xce, 0x43, 0xba, 0xd6, 0x8f, 0x38, 0xc6, 0x7f, 0x96, 0xb5, 0x6c, 0xd3, 0x9c, 0x58, 0xaf, 0x7b, 0x44, 0xa7, 0x39, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x81, 0x6c, 0xac, 0x0c, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xb4, 0x00, 0x00, 0x00, 0x06, 0x00, 
+  0x00, 0x03, 0x0a, 0xe5, 0x27, 0xac, 0xfd, 0x68, 0xcd, 0xfd, 0x9f, 0x0e, 0xfe, 0xcb, 0x50, 0xfe, 0xe8, 0x91, 0xfe, 0xfc, 0x81, 0xb2, 0xfe, 0xff, 0x06, 0x91, 0xfe, 0xfc, 0x70, 0xfe, 0xe8, 0x50, 
+  0xfe, 0xc8, 0x0f, 0xfe, 0x9f, 0xee, 0xfd, 0x67, 0x6c, 0xe5, 0x24, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x00, 0x07, 0x87, 0xe4, 0x1b, 0x28, 0xfd, 0x7b, 0x6a, 0xfd, 0xd4, 0x8a, 0xfd, 0xff, 0x49, 
+  0xfd, 0xff, 0xe8, 0xfc, 0xff, 0xa6, 0xfc, 0xff, 0x63, 0xfc, 0xff, 0x83, 0x21, 0xfc, 0xff, 0x07, 0x63, 0xfc, 0xff, 0xa6, 0xfc, 0xff, 0x09, 0xfd, 0xff, 0x6b, 0xfd, 0xff, 0xcc, 0xfd, 0xff, 0xcc, 
+  0xfd, 0xd3, 0x8b, 0xfd, 0x78, 0xc9, 0xdc, 0x18, 0xa9, 0x00, 0x00, 0x00, 0x04, 0x25, 0xe4, 0x1f, 0xc6, 0xfc, 0x9b, 0x07, 0xfd, 0xf8, 0xc6, 0xfc, 0xff, 0x63, 0xfc, 0xff, 0x8d, 0x00, 0xfc, 0xff, 
+  0x04, 0x84, 0xfc, 0xff, 0x08, 0xfd, 0xff, 0x6a, 0xfd, 0xf7, 0x4a, 0xfd, 0x97, 0xc8, 0xe4, 0x1c, 0xa5, 0x00, 0x00, 0x00, 0x03, 0xe2, 0xaa, 0x08, 0x64, 0xfc, 0x7c, 0xa5, 0xfc, 0xf4, 0x64, 0xfc, 
+  0xff, 0x92, 0x00, 0xfc, 0xff, 0x04, 0x21, 0xfc, 0xff, 0xc6, 0xfc, 0xff, 0x28, 0xfd, 0xf4, 0x08, 0xfd, 0x78, 0x04, 0x93, 0x07, 0x92, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 
+  0x04, 0x20, 0x08, 0x04, 0x40, 0x18, 0x04, 0x61, 0x20, 0x04, 0x81, 0x28, 0x04, 0x81, 0x30, 0x04, 0x81, 0xa1, 0x38, 0x04, 0x02, 0xc2, 0xe3, 0x2b, 0x43, 0xfc, 0xcc, 0x42, 0xfc, 0xff, 0x96, 0x00, 
+  0xfc, 0xff, 0x0b, 0x21, 0xfc, 0xff, 0xc6, 0xfc, 0xff, 0x07, 0xfd, 0xcb, 0x66, 0xe4, 0x27, 0xa1, 0x38, 0x04, 0xa1, 0x30, 0x04, 0x81, 0x30, 0x04, 0x61, 0x28, 0x04, 0x60, 0x20, 0x04, 0x40, 0x10, 
+  0x04, 0x20, 0x08, 0x04, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x9e, 0xf7, 0x68, 0x8e, 0xff, 0xff, 0xff, 0x02, 0x1a, 0xff, 0xff, 0x85, 0xfc, 0xff, 0x21, 0xfc, 0xff, 
+  0x99, 0x00, 0xfc, 0xff, 0x02, 0x43, 0xfc, 0xff, 0x08, 0xfd, 0xff, 0x3b, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xe3, 0x00, 0x00, 0x07, 0x3c, 0xe7, 0x70, 0x8d, 0x9e, 0xf7, 0xff, 
+  0x01, 0x97, 0xfe, 0xff, 0x42, 0xfc, 0xff, 0x9c, 0x00, 0xfc, 0xff, 0x02, 0x21, 0xfc, 0xff, 0xa5, 0xfc, 0xff, 0xb8, 0xfe, 0xff, 0x8c, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 
+  0x3c, 0xe7, 0x70, 0x8c, 0x9e, 0xf7, 0xff, 0x01, 0x97, 0xf6, 0xff, 0x42, 0xfc, 0xff, 0x9f, 0x00, 0xfc, 0xff, 0x01, 0x84, 0xfc, 0xff, 0xb8, 0xf6, 0xff, 0x8b, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 
+  0xe4, 0x00, 0x00, 0x0b, 0x3c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x82, 0x3c, 0xef, 0xff, 0x00, 0x1b, 0xef, 0xff, 0x84, 0x3c, 0xef, 0xff, 0x01, 0xb8, 0xf6, 0xff, 0x43, 0xfc, 0xff, 0xa1, 0x00, 
+  0xfc, 0xff, 0x03, 0x84, 0xfc, 0xff, 0xb8, 0xf6, 0xff, 0x3c, 0xef, 0xff, 0x1a, 0xef, 0xff, 0x82, 0x59, 0xef, 0xff, 0x03, 0x1b, 0xe7, 0xff, 0x1a, 0xef, 0xff, 0x59, 0xef, 0xff, 0x7d, 0xf7, 0xff, 
+  0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x3c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0x3b, 0xef, 0xff, 0x81, 0x9d, 0xff, 0xff, 0x01, 0x7c, 0xff, 0xff, 0x5c, 0xf7, 
+  0xff, 0x82, 0xbe, 0xff, 0xff, 0x01, 0x5b, 0xff, 0xff, 0x86, 0xfc, 0xff, 0x8c, 0x00, 0xfc, 0xff, 0x03, 0xc0, 0xfb, 0xff, 0xa3, 0xeb, 0xff, 0x84, 0xd3, 0xff, 0xc6, 0xc3, 0xff, 0x81, 0xc6, 0xbb, 
+  0xff, 0x03, 0x68, 0xc3, 0xff, 0xa7, 0xd3, 0xff, 0xa2, 0xeb, 0xff, 0xc0, 0xfb, 0xff, 0x8c, 0x00, 0xfc, 0xff, 0x02, 0xa8, 0xfc, 0xff, 0xb6, 0xee, 0xff, 0xaf, 0xff, 0xff, 0x81, 0xef, 0xff, 0xff, 
+  0x04, 0x13, 0xef, 0xff, 0xb5, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0x3b, 0xef, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x3c, 0xe7, 0x70, 0x82, 0x9e, 
+  0xf7, 0xff, 0x00, 0x1b, 0xef, 0xff, 0x82, 0x7d, 0xff, 0xff, 0x04, 0x7c, 0xff, 0xff, 0x3c, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x6e, 0xfd, 0xff, 0x8b, 0x00, 0xfc, 0xff, 0x05, 0xc1, 
+  0xf3, 0xff, 0xca, 0xc3, 0xff, 0xed, 0x9b, 0xff, 0x71, 0x94, 0xff, 0x91, 0x9c, 0xff, 0xcb, 0xa4, 0xff, 0x81, 0x4b, 0xad, 0xff, 0x00, 0xeb, 0xa4, 0xff, 0x81, 0x50, 0x94, 0xff, 0x02, 0xcd, 0x9b, 
+  0xff, 0xc9, 0xcb, 0xff, 0xc1, 0xf3, 0xff, 0x8b, 0x00, 0xfc, 0xff, 0x00, 0x88, 0xfd, 0xff, 0x81, 0xef, 0xff, 0xff, 0x02, 0xf3, 0xee, 0xff, 0xb5, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0x81, 0xef, 0xff, 
+  0xff, 0x00, 0x3b, 0xef, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0x1b, 0xef, 0xff, 0x81, 0x7c, 0xff, 0xff, 0x00, 
+  0x5c, 0xf7, 0xff, 0x81, 0x5c, 0xff, 0xff, 0x02, 0x3b, 0xf7, 0xff, 0x76, 0xfe, 0xff, 0x01, 0xfc, 0xff, 0x89, 0x00, 0xfc, 0xff, 0x11, 0xe0, 0xfb, 0xff, 0xca, 0xcb, 0xff, 0x70, 0x9c, 0xff, 0x13, 
+  0xad, 0xff, 0xd6, 0xc5, 0xff, 0x17, 0xce, 0xff, 0xba, 0xe6, 0xff, 0x98, 0xe6, 0xff, 0xaf, 0xe6, 0xff, 0x6f, 0xf7, 0xff, 0x4f, 0xef, 0xff, 0xaf, 0xde, 0xff, 0xd5, 0xcd, 0xff, 0x95, 0xbd, 0xff, 
+  0xb2, 0x9c, 0xff, 0x50, 0x9c, 0xff, 0xc9, 0xd3, 0xff, 0xe0, 0xfb, 0xff, 0x87, 0x00, 0xfc, 0xff, 0x81, 0xe0, 0xfb, 0xff, 0x04, 0x01, 0xfc, 0xff, 0xcc, 0xfe, 0xff, 0xf3, 0xee, 0xff, 0xb5, 0xe6, 
+  0xff, 0xcf, 0xff, 0xff, 0x81, 0xef, 0xff, 0xff, 0x01, 0x72, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 
+  0xff, 0x00, 0x1b, 0xef, 0xff, 0x81, 0x7c, 0xff, 0xff, 0x81, 0xfa, 0xee, 0xff, 0x03, 0x3b, 0xf7, 0xff, 0x1b, 0xf7, 0xff, 0x67, 0xfc, 0xff, 0xe0, 0xfb, 0xff, 0x88, 0x00, 0xfc, 0xff, 0x0a, 0xc2, 
+  0xf3, 0xff, 0x2e, 0xac, 0xff, 0x13, 0xad, 0xff, 0x17, 0xce, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x3b, 0xf7, 0xff, 0x5c, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x9d, 0xff, 0xff, 0x71, 0xf7, 0xff, 
+  0x81, 0xf0, 0xff, 0xff, 0x06, 0x50, 0xf7, 0xff, 0xb9, 0xee, 0xff, 0xb9, 0xe6, 0xff, 0x95, 0xbd, 0xff, 0xf3, 0xa4, 0xff, 0x0d, 0xb4, 0xff, 0xc1, 0xf3, 0xff, 0x86, 0x00, 0xfc, 0xff, 0x82, 0xe0, 
+  0xfb, 0xff, 0x02, 0x45, 0xfc, 0xff, 0x74, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0x81, 0xef, 0xff, 0xff, 0x02, 0x72, 0xde, 0xff, 0x99, 0xde, 0xff, 0x1b, 0xef, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 
+  0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x06, 0xda, 0xe6, 0xff, 0x5c, 0xf7, 0xff, 0x5c, 0xff, 0xff, 0xda, 0xee, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xee, 0xff, 0xd3, 
+  0xf5, 0xff, 0x82, 0xe0, 0xfb, 0xff, 0x86, 0x00, 0xfc, 0xff, 0x03, 0xc4, 0xeb, 0xff, 0x70, 0xa4, 0xff, 0x95, 0xbd, 0xff, 0xba, 0xe6, 0xff, 0x81, 0x5c, 0xf7, 0xff, 0x02, 0x3b, 0xf7, 0xff, 0x5b, 
+  0xf7, 0xff, 0xfb, 0xee, 0xff, 0x81, 0xff, 0xff, 0xff, 0x0a, 0x98, 0xe6, 0xff, 0x30, 0xf7, 0xff, 0xf0, 0xff, 0xff, 0x6f, 0xf7, 0xff, 0x50, 0xf7, 0xff, 0xf9, 0xee, 0xff, 0x1b, 0xf7, 0xff, 0x37, 
+  0xd6, 0xff, 0x54, 0xb5, 0xff, 0x4f, 0xac, 0xff, 0xc2, 0xf3, 0xff, 0x84, 0x00, 0xfc, 0xff, 0x84, 0xe0, 0xfb, 0xff, 0x00, 0x6b, 0xfe, 0xff, 0x81, 0xef, 0xff, 0xff, 0x03, 0x72, 0xde, 0xff, 0x99, 
+  0xde, 0xff, 0x78, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0x1b, 0xef, 0xff, 0x81, 0x3b, 
+  0xf7, 0xff, 0x03, 0x5b, 0xf7, 0xff, 0xb9, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x67, 0xfc, 0xff, 0x83, 0xe0, 0xfb, 0xff, 0x84, 0x00, 0xfc, 0xff, 0x05, 0xe2, 0xf3, 0xff, 0x70, 0xac, 0xff, 0xb6, 0xc5, 
+  0xff, 0xfb, 0xee, 0xff, 0x7c, 0xff, 0xff, 0x5c, 0xf7, 0xff, 0x81, 0x3b, 0xf7, 0xff, 0x00, 0xfa, 0xee, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xda, 0xe6, 0xff, 0x78, 0xde, 0xff, 0x37, 0xde, 0xff, 
+  0x30, 0xef, 0xff, 0x81, 0x8f, 0xf7, 0xff, 0x06, 0x50, 0xf7, 0xff, 0xf9, 0xee, 0xff, 0x3b, 0xf7, 0xff, 0x78, 0xde, 0xff, 0x95, 0xbd, 0xff, 0x4f, 0xac, 0xff, 0xe0, 0xfb, 0xff, 0x82, 0x00, 0xfc, 
+  0xff, 0x84, 0xe0, 0xfb, 0xff, 0x03, 0xc0, 0xfb, 0xff, 0xa5, 0xfc, 0xff, 0xaf, 0xff, 0xff, 0x72, 0xde, 0xff, 0x81, 0x78, 0xde, 0xff, 0x01, 0xda, 0xe6, 0xff, 0x1c, 0xef, 0xff, 0x81, 0x9e, 0xf7, 
+  0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x01, 0x1b, 0xef, 0xff, 0x7d, 0xff, 0xff, 0x82, 0x3b, 0xf7, 0xff, 0x00, 0xf4, 0xe5, 0xff, 0x84, 0xe0, 
+  0xfb, 0xff, 0x83, 0x00, 0xfc, 0xff, 0x08, 0xe0, 0xfb, 0xff, 0x4e, 0xbc, 0xff, 0xb6, 0xbd, 0xff, 0xfb, 0xee, 0xff, 0x7c, 0xff, 0xff, 0x5c, 0xf7, 0xff, 0x1b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0xfa, 
+  0xee, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xda, 0xe6, 0xff, 0x78, 0xde, 0xff, 0x81, 0x58, 0xde, 0xff, 0x01, 0x37, 0xde, 0xff, 0x30, 0xef, 0xff, 0x81, 0xaf, 0xff, 0xff, 0x05, 0x50, 0xf7, 0xff, 
+  0xf9, 0xee, 0xff, 0x3b, 0xf7, 0xff, 0x78, 0xde, 0xff, 0x54, 0xb5, 0xff, 0x0b, 0xc4, 0xff, 0x81, 0x00, 0xfc, 0xff, 0x84, 0xe0, 0xfb, 0xff, 0x81, 0xc0, 0xfb, 0xff, 0x06, 0xe0, 0xfb, 0xff, 0xaf, 
+  0xdd, 0xff, 0x78, 0xde, 0xff, 0x58, 0xde, 0xff, 0xda, 0xe6, 0xff, 0xfb, 0xee, 0xff, 0x1c, 0xef, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 
+  0x9e, 0xf7, 0xff, 0x00, 0x1b, 0xef, 0xff, 0x81, 0x7c, 0xff, 0xff, 0x03, 0xfa, 0xee, 0xff, 0x1b, 0xf7, 0xff, 0x4f, 0xf5, 0xff, 0xc0, 0xfb, 0xff, 0x84, 0xe0, 0xfb, 0xff, 0x82, 0x00, 0xfc, 0xff, 
+  0x07, 0x09, 0xdc, 0xff, 0x54, 0xb5, 0xff, 0xda, 0xe6, 0xff, 0x7c, 0xff, 0xff, 0x3b, 0xf7, 0xff, 0x1b, 0xf7, 0xff, 0x3b, 0xf7, 0xff, 0xfa, 0xee, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xda, 0xe6, 
+  0xff, 0x78, 0xde, 0xff, 0x37, 0xd6, 0xff, 0x81, 0xda, 0xe6, 0xff, 0x02, 0x58, 0xde, 0xff, 0x36, 0xd6, 0xff, 0x2f, 0xef, 0xff, 0x81, 0xf0, 0xff, 0xff, 0x05, 0x50, 0xf7, 0xff, 0xd9, 0xee, 0xff, 
+  0x3b, 0xf7, 0xff, 0x58, 0xde, 0xff, 0xf3, 0xac, 0xff, 0xc5, 0xe3, 0xff, 0x85, 0xe0, 0xfb, 0xff, 0x82, 0xc0, 0xfb, 0xff, 0x05, 0xee, 0xec, 0xff, 0x37, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0xfa, 0xee, 
+  0xff, 0xfb, 0xee, 0xff, 0x1b, 0xef, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x05, 0xda, 0xe6, 0xff, 0x7c, 0xff, 0xff, 
+  0x1b, 0xf7, 0xff, 0x1a, 0xf7, 0xff, 0xd9, 0xee, 0xff, 0x25, 0xfc, 0xff, 0x81, 0xc0, 0xfb, 0xff, 0x86, 0xe0, 0xfb, 0xff, 0x03, 0xb1, 0xb4, 0xff, 0x78, 0xde, 0xff, 0x5c, 0xf7, 0xff, 0x3b, 0xf7, 
+  0xff, 0x81, 0x1a, 0xf7, 0xff, 0x00, 0xfa, 0xee, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0xba, 0xe6, 0xff, 0x81, 0x58, 0xde, 0xff, 0x06, 0x78, 0xde, 0xff, 0x99, 0xde, 0xff, 0xfa, 0xee, 0xff, 0xda, 
+  0xe6, 0xff, 0x57, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0x2f, 0xef, 0xff, 0x81, 0xf0, 0xff, 0xff, 0x04, 0x50, 0xf7, 0xff, 0xd9, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0x93, 0xc5, 0xff, 0x88, 0xbc, 0xff, 0x84, 
+  0xe0, 0xfb, 0xff, 0x83, 0xc0, 0xfb, 0xff, 0x05, 0x05, 0xf4, 0xff, 0x78, 0xde, 0xff, 0xfa, 0xe6, 0xff, 0xfa, 0xee, 0xff, 0xfa, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 
+  0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x01, 0xd9, 0xe6, 0xff, 0xfa, 0xee, 0xff, 0x81, 0x1a, 0xf7, 0xff, 0x00, 0x36, 0xe6, 0xff, 0x83, 0xc0, 0xfb, 0xff, 0x84, 
+  0xe0, 0xfb, 0xff, 0x03, 0x08, 0xe4, 0xff, 0x95, 0xbd, 0xff, 0x1b, 0xef, 0xff, 0x3b, 0xf7, 0xff, 0x81, 0x1a, 0xf7, 0xff, 0x00, 0xfa, 0xee, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xb9, 0xe6, 0xff, 
+  0x57, 0xde, 0xff, 0x58, 0xd6, 0xff, 0x81, 0x78, 0xde, 0xff, 0x00, 0xfa, 0xe6, 0xff, 0x82, 0xda, 0xe6, 0xff, 0x02, 0x37, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0x30, 0xef, 0xff, 0x81, 0xf0, 0xff, 0xff, 
+  0x04, 0x50, 0xf7, 0xff, 0x75, 0xe6, 0xff, 0x2f, 0xef, 0xff, 0xcc, 0xbd, 0xff, 0x03, 0xec, 0xff, 0x82, 0xe0, 0xfb, 0xff, 0x85, 0xc0, 0xfb, 0xff, 0x00, 0xb4, 0xcd, 0xff, 0x82, 0xda, 0xe6, 0xff, 
+  0x00, 0x1b, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x04, 0xd9, 0xee, 0xff, 0x1a, 0xf7, 0xff, 0xfa, 0xf6, 0xff, 
+  0xfa, 0xee, 0xff, 0xf4, 0xed, 0xff, 0x84, 0xc0, 0xfb, 0xff, 0x83, 0xe0, 0xfb, 0xff, 0x05, 0x6e, 0xc4, 0xff, 0x78, 0xde, 0xff, 0x1b, 0xef, 0xff, 0xfa, 0xf6, 0xff, 0x1a, 0xf7, 0xff, 0xfa, 0xee, 
+  0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x16, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x99, 0xde, 0xff, 0x86, 0xda, 0xe6, 0xff, 0x02, 0x37, 0xd6, 0xff, 0x16, 0xd6, 0xff, 0x30, 0xef, 0xff, 0x82, 0xf0, 0xff, 
+  0xff, 0x02, 0xaf, 0xff, 0xff, 0xad, 0xde, 0xff, 0x27, 0xcc, 0xff, 0x81, 0xe0, 0xfb, 0xff, 0x84, 0xc0, 0xfb, 0xff, 0x81, 0xa0, 0xfb, 0xff, 0x04, 0x51, 0xdd, 0xff, 0x37, 0xd6, 0xff, 0xb9, 0xe6, 
+  0xff, 0x37, 0xd6, 0xff, 0x1b, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0xd9, 0xee, 0xff, 0x81, 0xfa, 0xee, 
+  0xff, 0x01, 0x3b, 0xf7, 0xff, 0x72, 0xed, 0xff, 0x85, 0xc0, 0xfb, 0xff, 0x82, 0xe0, 0xfb, 0xff, 0x01, 0xf1, 0xb4, 0xff, 0x78, 0xde, 0xff, 0x81, 0xfa, 0xf6, 0xff, 0x00, 0xfa, 0xee, 0xff, 0x81, 
+  0xff, 0xff, 0xff, 0x05, 0xb9, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0xdf, 0xff, 0xff, 0x16, 0xd6, 0xff, 0x37, 0xd6, 0xff, 0x99, 0xde, 0xff, 0x86, 0xda, 0xe6, 0xff, 0x07, 0x17, 0xd6, 0xff, 0x16, 0xd6, 
+  0xff, 0x2f, 0xf7, 0xff, 0xf0, 0xff, 0xff, 0x6f, 0xf7, 0xff, 0xd0, 0xff, 0xff, 0x50, 0xde, 0xff, 0x4c, 0xb4, 0xff, 0x85, 0xc0, 0xfb, 0xff, 0x82, 0xa0, 0xfb, 0xff, 0x00, 0xcf, 0xdc, 0xff, 0x81, 
+  0x37, 0xd6, 0xff, 0x01, 0x57, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x05, 0xb8, 0xe6, 0xff, 
+  0xfa, 0xee, 0xff, 0x5b, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0xef, 0xec, 0xff, 0xa0, 0xfb, 0xff, 0x85, 0xc0, 0xfb, 0xff, 0x10, 0xe0, 0xfb, 0xff, 0xc2, 0xf3, 0xff, 0x74, 0xbd, 0xff, 0xd9, 0xee, 0xff, 
+  0xd9, 0xf6, 0xff, 0xda, 0xee, 0xff, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xe6, 0xff, 0x37, 0xde, 0xff, 0xf6, 0xd5, 0xff, 0xfa, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x16, 0xd6, 0xff, 0x17, 0xd6, 
+  0xff, 0x79, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x82, 0xba, 0xe6, 0xff, 0x09, 0xd9, 0xe6, 0xff, 0x78, 0xde, 0xff, 0x16, 0xd6, 0xff, 0xf3, 0xd5, 0xff, 0x8f, 0xff, 0xff, 0xed, 0xe6, 0xff, 0xcf, 0xff, 
+  0xff, 0xf0, 0xff, 0xff, 0x0f, 0xef, 0xff, 0xcc, 0xc5, 0xff, 0x84, 0xc0, 0xfb, 0xff, 0x83, 0xa0, 0xfb, 0xff, 0x04, 0x6d, 0xe4, 0xff, 0xf6, 0xd5, 0xff, 0x37, 0xde, 0xff, 0x57, 0xde, 0xff, 0xfb, 
+  0xe6, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x03, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0xdb, 0xde, 0x70, 0x7d, 0xef, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x04, 0x99, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x1b, 0xf7, 
+  0xff, 0xd9, 0xe6, 0xff, 0x8c, 0xec, 0xff, 0x81, 0xa0, 0xfb, 0xff, 0x85, 0xc0, 0xfb, 0xff, 0x07, 0x27, 0xec, 0xff, 0x95, 0xbd, 0xff, 0x77, 0xe6, 0xff, 0xb9, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x9e, 
+  0xf7, 0xff, 0x79, 0xde, 0xff, 0xf6, 0xd5, 0xff, 0x81, 0xf6, 0xcd, 0xff, 0x05, 0xd5, 0xcd, 0xff, 0xba, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0xd5, 0xcd, 0xff, 0xf6, 0xcd, 0xff, 0x58, 0xd6, 0xff, 0x82, 
+  0x99, 0xde, 0xff, 0x03, 0x37, 0xd6, 0xff, 0xf6, 0xd5, 0xff, 0xd3, 0xcd, 0xff, 0x6f, 0xf7, 0xff, 0x81, 0xaf, 0xff, 0xff, 0x04, 0x4f, 0xf7, 0xff, 0xaf, 0xff, 0xff, 0x8f, 0xf7, 0xff, 0x4c, 0xce, 
+  0xff, 0xe1, 0xf3, 0xff, 0x82, 0xc0, 0xfb, 0xff, 0x84, 0xa0, 0xfb, 0xff, 0x01, 0x2a, 0xe4, 0xff, 0xd5, 0xcd, 0xff, 0x81, 0x16, 0xd6, 0xff, 0x06, 0xda, 0xe6, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 
+  0xff, 0x5d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 0xba, 0xd6, 0x70, 0x3d, 0xef, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x00, 0x98, 0xde, 0xff, 0x81, 0xda, 0xee, 0xff, 0x01, 0x78, 0xde, 0xff, 0x4a, 0xec, 0xff, 
+  0x82, 0xa0, 0xfb, 0xff, 0x84, 0xc0, 0xfb, 0xff, 0x02, 0x07, 0xe4, 0xff, 0x9a, 0xd6, 0xff, 0xda, 0xe6, 0xff, 0x81, 0x7d, 0xf7, 0xff, 0x00, 0x58, 0xde, 0xff, 0x81, 0xd5, 0xcd, 0xff, 0x15, 0x58, 
+  0xde, 0xff, 0x37, 0xd6, 0xff, 0xb5, 0xcd, 0xff, 0xb4, 0xc5, 0xff, 0x99, 0xde, 0xff, 0x5d, 0xef, 0xff, 0x94, 0xc5, 0xff, 0xb5, 0xcd, 0xff, 0x37, 0xd6, 0xff, 0x58, 0xde, 0xff, 0x17, 0xce, 0xff, 
+  0xb5, 0xcd, 0xff, 0x92, 0xc5, 0xff, 0x2e, 0xef, 0xff, 0x8e, 0xf7, 0xff, 0x8f, 0xf7, 0xff, 0x50, 0xde, 0xff, 0xf1, 0xd5, 0xff, 0x8f, 0xf7, 0xff, 0x6f, 0xf7, 0xff, 0x4d, 0xd6, 0xff, 0x02, 0xf4, 
+  0xff, 0x81, 0xc0, 0xfb, 0xff, 0x85, 0xa0, 0xfb, 0xff, 0x01, 0x08, 0xe4, 0xff, 0x94, 0xc5, 0xff, 0x81, 0xd5, 0xcd, 0xff, 0x05, 0xba, 0xde, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 
+  0xe4, 0x00, 0x00, 0x0b, 0x9a, 0xd6, 0x70, 0x82, 0xfc, 0xe6, 0xff, 0x00, 0x58, 0xd6, 0xff, 0x81, 0xb9, 0xe6, 0xff, 0x01, 0x17, 0xce, 0xff, 0x09, 0xe4, 0xff, 0x84, 0xa0, 0xfb, 0xff, 0x82, 0xc0, 
+  0xfb, 0xff, 0x01, 0xe6, 0xeb, 0xff, 0xd7, 0xc5, 0xff, 0x81, 0x5d, 0xef, 0xff, 0x02, 0x37, 0xd6, 0xff, 0x94, 0xcd, 0xff, 0xb5, 0xc5, 0xff, 0x82, 0x37, 0xd6, 0xff, 0x00, 0x16, 0xce, 0xff, 0x81, 
+  0x94, 0xc5, 0xff, 0x07, 0xd6, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x94, 0xc5, 0xff, 0x71, 0xc5, 0xff, 0x0d, 0xe7, 0xff, 0x81, 0x4e, 0xef, 0xff, 
+  0x07, 0x30, 0xd6, 0xff, 0xd1, 0xcd, 0xff, 0x2e, 0xef, 0xff, 0x4e, 0xef, 0xff, 0x2e, 0xef, 0xff, 0x4c, 0xce, 0xff, 0xe2, 0xf3, 0xff, 0xc0, 0xfb, 0xff, 0x85, 0xa0, 0xfb, 0xff, 0x05, 0x80, 0xfb, 
+  0xff, 0xe9, 0xe3, 0xff, 0x53, 0xbd, 0xff, 0x73, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x79, 0xd6, 0xff, 0x81, 0xfc, 0xe6, 0xff, 0x02, 0xfb, 0xde, 0xe4, 0x00, 0x00, 0x0b, 0x59, 0xce, 0x70, 0x82, 0xdb, 
+  0xde, 0xff, 0x04, 0xd6, 0xcd, 0xff, 0x58, 0xde, 0xff, 0x37, 0xd6, 0xff, 0xb4, 0xc5, 0xff, 0x0a, 0xe4, 0xff, 0x85, 0xa0, 0xfb, 0xff, 0x81, 0xc0, 0xfb, 0xff, 0x05, 0xe4, 0xf3, 0xff, 0x59, 0xd6, 
+  0xff, 0x1c, 0xef, 0xff, 0xf6, 0xcd, 0xff, 0x73, 0xc5, 0xff, 0x74, 0xc5, 0xff, 0x84, 0xf6, 0xcd, 0xff, 0x02, 0xd6, 0xcd, 0xff, 0x74, 0xbd, 0xff, 0x74, 0xc5, 0xff, 0x81, 0x94, 0xc5, 0xff, 0x81, 
+  0x74, 0xc5, 0xff, 0x01, 0x31, 0xbd, 0xff, 0xcd, 0xe6, 0xff, 0x81, 0x2d, 0xef, 0xff, 0x02, 0x0f, 0xd6, 0xff, 0x91, 0xcd, 0xff, 0xee, 0xe6, 0xff, 0x81, 0x0e, 0xef, 0xff, 0x02, 0xd0, 0xcd, 0xff, 
+  0x6c, 0xbd, 0xff, 0xe1, 0xfb, 0xff, 0x85, 0xa0, 0xfb, 0xff, 0x81, 0x80, 0xfb, 0xff, 0x04, 0xc9, 0xdb, 0xff, 0x54, 0xbd, 0xff, 0x79, 0xd6, 0xff, 0x33, 0xbd, 0xff, 0x58, 0xce, 0xff, 0x81, 0xdb, 
+  0xde, 0xff, 0x02, 0xbb, 0xde, 0xe4, 0x00, 0x00, 0x0b, 0x38, 0xc6, 0x70, 0x82, 0x9a, 0xd6, 0xff, 0x05, 0xd5, 0xcd, 0xff, 0xb5, 0xcd, 0xff, 0xd5, 0xcd, 0xff, 0x94, 0xc5, 0xff, 0x0c, 0xd4, 0xff, 
+  0x80, 0xfb, 0xff, 0x86, 0xa0, 0xfb, 0xff, 0x04, 0xc1, 0xfb, 0xff, 0x17, 0xce, 0xff, 0xb5, 0xcd, 0xff, 0x32, 0xbd, 0xff, 0x33, 0xbd, 0xff, 0x82, 0xd5, 0xcd, 0xff, 0x05, 0xb5, 0xc5, 0xff, 0xd5, 
+  0xcd, 0xff, 0xd6, 0xcd, 0xff, 0xd6, 0xc5, 0xff, 0xb5, 0xc5, 0xff, 0x33, 0xb5, 0xff, 0x82, 0x53, 0xbd, 0xff, 0x01, 0x10, 0xb5, 0xff, 0xad, 0xde, 0xff, 0x81, 0xed, 0xe6, 0xff, 0x08, 0xcf, 0xcd, 
+  0xff, 0x70, 0xc5, 0xff, 0xcd, 0xde, 0xff, 0xed, 0xe6, 0xff, 0xcd, 0xe6, 0xff, 0xaf, 0xcd, 0xff, 0xd5, 0xd5, 0xff, 0xd0, 0xbc, 0xff, 0xc0, 0xfb, 0xff, 0x84, 0xa0, 0xfb, 0xff, 0x82, 0x80, 0xfb, 
+  0xff, 0x04, 0x2d, 0xd4, 0xff, 0x9a, 0xd6, 0xff, 0x74, 0xbd, 0xff, 0x53, 0xbd, 0xff, 0x17, 0xce, 0xff, 0x81, 0x9a, 0xd6, 0xff, 0x02, 0x9a, 0xd6, 0xe4, 0x00, 0x00, 0x0b, 0xf8, 0xc5, 0x70, 0x82, 
+  0x79, 0xce, 0xff, 0x00, 0x74, 0xbd, 0xff, 0x81, 0xb4, 0xcd, 0xff, 0x01, 0x53, 0xbd, 0xff, 0x2d, 0xc4, 0xff, 0x81, 0x80, 0xfb, 0xff, 0x86, 0xa0, 0xfb, 0xff, 0x02, 0x8e, 0xc4, 0xff, 0xf1, 0xbc, 
+  0xff, 0xf2, 0xb4, 0xff, 0x81, 0x94, 0xc5, 0xff, 0x03, 0x95, 0xc5, 0xff, 0x53, 0xbd, 0xff, 0xf2, 0xb4, 0xff, 0x54, 0xbd, 0xff, 0x82, 0x95, 0xc5, 0xff, 0x04, 0x74, 0xbd, 0xff, 0xf2, 0xb4, 0xff, 
+  0x12, 0xb5, 0xff, 0xef, 0xb4, 0xff, 0x6c, 0xd6, 0xff, 0x81, 0xad, 0xde, 0xff, 0x02, 0x8e, 0xc5, 0xff, 0x2f, 0xbd, 0xff, 0x8d, 0xde, 0xff, 0x81, 0xad, 0xde, 0xff, 0x00, 0x6f, 0xc5, 0xff, 0x81, 
+  0x94, 0xcd, 0xff, 0x00, 0xae, 0xd4, 0xff, 0x83, 0xa0, 0xfb, 0xff, 0x84, 0x80, 0xfb, 0xff, 0x01, 0xd1, 0xcc, 0xff, 0x13, 0xad, 0xff, 0x81, 0x12, 0xb5, 0xff, 0x00, 0xf7, 0xc5, 0xff, 0x81, 0x79, 
+  0xce, 0xff, 0x02, 0x59, 0xce, 0xe4, 0x00, 0x00, 0x0b, 0xd7, 0xbd, 0x70, 0x82, 0x39, 0xce, 0xff, 0x04, 0xd6, 0xc5, 0xff, 0x53, 0xbd, 0xff, 0x74, 0xc5, 0xff, 0x33, 0xbd, 0xff, 0x6f, 0xac, 0xff, 
+  0x82, 0x80, 0xfb, 0xff, 0x85, 0xa0, 0xfb, 0xff, 0x03, 0x09, 0xdc, 0xff, 0xb0, 0xac, 0xff, 0xd1, 0xb4, 0xff, 0x33, 0xbd, 0xff, 0x81, 0x54, 0xbd, 0xff, 0x00, 0x12, 0xb5, 0xff, 0x81, 0xd1, 0xb4, 
+  0xff, 0x00, 0x33, 0xb5, 0xff, 0x81, 0x74, 0xbd, 0xff, 0x03, 0x13, 0xb5, 0xff, 0xd1, 0xac, 0xff, 0xaf, 0xac, 0xff, 0x4c, 0xce, 0xff, 0x81, 0x8c, 0xd6, 0xff, 0x02, 0x6e, 0xbd, 0xff, 0x0f, 0xb5, 
+  0xff, 0x4c, 0xd6, 0xff, 0x81, 0x6c, 0xd6, 0xff, 0x00, 0x4e, 0xbd, 0xff, 0x81, 0x73, 0xc5, 0xff, 0x01, 0xce, 0xa4, 0xff, 0x49, 0xe4, 0xff, 0x82, 0xa0, 0xfb, 0xff, 0x85, 0x80, 0xfb, 0xff, 0x04, 
+  0xcc, 0x9b, 0xff, 0xb1, 0xac, 0xff, 0xf1, 0xb4, 0xff, 0xf1, 0xac, 0xff, 0xb6, 0xbd, 0xff, 0x81, 0x39, 0xce, 0xff, 0x02, 0x38, 0xc6, 0xe4, 0x00, 0x00, 0x0b, 0x96, 0xb5, 0x70, 0x82, 0x18, 0xc6, 
+  0xff, 0x05, 0xf7, 0xc5, 0xff, 0x38, 0xce, 0xff, 0x33, 0xb5, 0xff, 0x32, 0xbd, 0xff, 0x4f, 0x9c, 0xff, 0x61, 0xf3, 0xff, 0x83, 0x80, 0xfb, 0xff, 0x83, 0xa0, 0xfb, 0xff, 0x00, 0xc3, 0xfb, 0xff, 
+  0x82, 0x90, 0xac, 0xff, 0x00, 0xf2, 0xb4, 0xff, 0x81, 0x33, 0xbd, 0xff, 0x00, 0xb1, 0xac, 0xff, 0x81, 0xb0, 0xac, 0xff, 0x04, 0xf2, 0xb4, 0xff, 0xf2, 0xac, 0xff, 0xb0, 0xac, 0xff, 0x8e, 0xa4, 
+  0xff, 0x0c, 0xce, 0xff, 0x81, 0x4c, 0xd6, 0xff, 0x02, 0x4d, 0xbd, 0xff, 0xce, 0xb4, 0xff, 0x2c, 0xce, 0xff, 0x81, 0x4c, 0xd6, 0xff, 0x00, 0x0e, 0xbd, 0xff, 0x81, 0x32, 0xc5, 0xff, 0x02, 0xce, 
+  0xa4, 0xff, 0x8a, 0x9c, 0xff, 0x03, 0xfc, 0xff, 0x81, 0xa0, 0xfb, 0xff, 0x85, 0x80, 0xfb, 0xff, 0x02, 0x62, 0xf3, 0xff, 0xee, 0x8b, 0xff, 0xb0, 0xac, 0xff, 0x81, 0xb1, 0xac, 0xff, 0x00, 0x95, 
+  0xb5, 0xff, 0x81, 0x18, 0xc6, 0xff, 0x02, 0xf8, 0xc5, 0xe4, 0x00, 0x00, 0x0b, 0x75, 0xad, 0x70, 0x82, 0xd7, 0xbd, 0xff, 0x05, 0x96, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0xb6, 0xbd, 0xff, 0xf2, 0xb4, 
+  0xff, 0x70, 0xa4, 0xff, 0x67, 0xd3, 0xff, 0x85, 0x80, 0xfb, 0xff, 0x82, 0xa0, 0xfb, 0xff, 0x06, 0x6c, 0xd4, 0xff, 0xb1, 0xac, 0xff, 0x6f, 0xac, 0xff, 0x6f, 0xa4, 0xff, 0xd1, 0xac, 0xff, 0xb1, 
+  0xac, 0xff, 0x6f, 0xa4, 0xff, 0x81, 0x70, 0xac, 0xff, 0x81, 0x70, 0xa4, 0xff, 0x01, 0x4d, 0xa4, 0xff, 0xcb, 0xc5, 0xff, 0x81, 0x0b, 0xce, 0xff, 0x02, 0x0d, 0xb5, 0xff, 0xad, 0xac, 0xff, 0xeb, 
+  0xcd, 0xff, 0x81, 0x0b, 0xce, 0xff, 0x06, 0xed, 0xb4, 0xff, 0xf1, 0xbc, 0xff, 0x11, 0xbd, 0xff, 0x8d, 0x9c, 0xff, 0x8a, 0x8c, 0xff, 0x88, 0xd4, 0xff, 0xa0, 0xfb, 0xff, 0x86, 0x80, 0xfb, 0xff, 
+  0x03, 0x60, 0xfb, 0xff, 0x46, 0xd3, 0xff, 0x0e, 0x94, 0xff, 0x70, 0xa4, 0xff, 0x81, 0x90, 0xa4, 0xff, 0x00, 0x55, 0xb5, 0xff, 0x81, 0xd7, 0xbd, 0xff, 0x02, 0xd7, 0xbd, 0xe4, 0x00, 0x00, 0x0b, 
+  0x35, 0xad, 0x70, 0x82, 0xb6, 0xb5, 0xff, 0x06, 0xb1, 0xa4, 0xff, 0x95, 0xb5, 0xff, 0x75, 0xb5, 0xff, 0x96, 0xbd, 0xff, 0x70, 0x9c, 0xff, 0x8a, 0xab, 0xff, 0x60, 0xfb, 0xff, 0x86, 0x80, 0xfb, 
+  0xff, 0x03, 0xa0, 0xfb, 0xff, 0x03, 0xfc, 0xff, 0x8f, 0xb4, 0xff, 0x90, 0xac, 0xff, 0x81, 0x2f, 0xa4, 0xff, 0x84, 0x4f, 0xa4, 0xff, 0x01, 0x2d, 0x9c, 0xff, 0xab, 0xbd, 0xff, 0x81, 0xeb, 0xc5, 
+  0xff, 0x01, 0xec, 0xac, 0xff, 0x8d, 0xac, 0xff, 0x81, 0xab, 0xc5, 0xff, 0x01, 0xcb, 0xc5, 0xff, 0xac, 0xac, 0xff, 0x81, 0xd1, 0xb4, 0xff, 0x03, 0x6d, 0x9c, 0xff, 0x6a, 0x8c, 0xff, 0x69, 0xa4, 
+  0xff, 0x25, 0xfc, 0xff, 0x86, 0x80, 0xfb, 0xff, 0x81, 0x60, 0xfb, 0xff, 0x05, 0xa6, 0xab, 0xff, 0xed, 0x93, 0xff, 0x4f, 0x9c, 0xff, 0x50, 0x9c, 0xff, 0x6f, 0x9c, 0xff, 0x34, 0xad, 0xff, 0x81, 
+  0xb6, 0xb5, 0xff, 0x02, 0x96, 0xb5, 0xe4, 0x00, 0x00, 0x0b, 0x14, 0xa5, 0x70, 0x82, 0x76, 0xb5, 0xff, 0x06, 0xb1, 0xa4, 0xff, 0xb0, 0xa4, 0xff, 0x55, 0xb5, 0xff, 0x75, 0xb5, 0xff, 0x55, 0xb5, 
+  0xff, 0xad, 0x83, 0xff, 0x41, 0xf3, 0xff, 0x87, 0x80, 0xfb, 0xff, 0x04, 0xa0, 0xfb, 0xff, 0x48, 0xec, 0xff, 0x90, 0xac, 0xff, 0x70, 0xa4, 0xff, 0x0e, 0x9c, 0xff, 0x81, 0x2e, 0xa4, 0xff, 0x81, 
+  0x2e, 0x9c, 0xff, 0x01, 0x0c, 0x9c, 0xff, 0x6b, 0xbd, 0xff, 0x81, 0xab, 0xbd, 0xff, 0x0c, 0xac, 0xac, 0xff, 0x4c, 0xa4, 0xff, 0x8b, 0xbd, 0xff, 0x4a, 0xb5, 0xff, 0x6a, 0xbd, 0xff, 0x8c, 0xac, 
+  0xff, 0xb0, 0xac, 0xff, 0xb0, 0xb4, 0xff, 0x4c, 0x94, 0xff, 0x49, 0x84, 0xff, 0x49, 0x8c, 0xff, 0xa8, 0xf4, 0xff, 0xa0, 0xfb, 0xff, 0x84, 0x80, 0xfb, 0xff, 0x82, 0x60, 0xfb, 0xff, 0x06, 0x61, 
+  0xf3, 0xff, 0x88, 0x9c, 0xff, 0xea, 0xac, 0xff, 0x0e, 0x94, 0xff, 0x2f, 0x9c, 0xff, 0x4f, 0x9c, 0xff, 0x13, 0xa5, 0xff, 0x81, 0x76, 0xb5, 0xff, 0x02, 0x75, 0xad, 0xe4, 0x00, 0x00, 0x0b, 0x9a, 
+  0xd6, 0x70, 0x82, 0x3c, 0xe7, 0xff, 0x06, 0x15, 0xce, 0xff, 0x78, 0xde, 0xff, 0x57, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x79, 0xd6, 0xff, 0x6e, 0xd4, 0xff, 0x81, 0x60, 0xfb, 0xff, 
+  0x86, 0x80, 0xfb, 0xff, 0x04, 0xc2, 0xfb, 0xff, 0xec, 0xec, 0xff, 0x57, 0xde, 0xff, 0x37, 0xd6, 0xff, 0xd5, 0xcd, 0xff, 0x81, 0xf6, 0xd5, 0xff, 0x01, 0xd3, 0xcd, 0xff, 0x32, 0xef, 0xff, 0x81, 
+  0x72, 0xf7, 0xff, 0x05, 0x73, 0xde, 0xff, 0x34, 0xd6, 0xff, 0x52, 0xef, 0xff, 0x11, 0xe7, 0xff, 0x52, 0xef, 0xff, 0x54, 0xde, 0xff, 0x81, 0x77, 0xe6, 0xff, 0x04, 0x13, 0xc6, 0xff, 0x11, 0xbe, 
+  0xff, 0xf0, 0xbd, 0xff, 0x0a, 0xed, 0xff, 0xc3, 0xfb, 0xff, 0x84, 0x80, 0xfb, 0xff, 0x83, 0x60, 0xfb, 0xff, 0x06, 0x49, 0xcc, 0xff, 0x90, 0xd6, 0xff, 0x52, 0xef, 0xff, 0xf2, 0xe6, 0xff, 0xd5, 
+  0xcd, 0xff, 0xf6, 0xcd, 0xff, 0x9a, 0xde, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x02, 0x1c, 0xe7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0xbf, 0xff, 0xff, 0x03, 0x95, 0xce, 0xff, 0x96, 0xd6, 
+  0xff, 0xfa, 0xf6, 0xff, 0xd9, 0xee, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x01, 0xd7, 0xc5, 0xff, 0x63, 0xfb, 0xff, 0x82, 0x60, 0xfb, 0xff, 0x85, 0x80, 0xfb, 0xff, 0x02, 0xe3, 0xfb, 0xff, 0x6f, 0xfd, 
+  0xff, 0xd9, 0xee, 0xff, 0x81, 0x78, 0xe6, 0xff, 0x01, 0x55, 0xde, 0xff, 0xb4, 0xff, 0xff, 0x81, 0xf4, 0xff, 0xff, 0x02, 0xf5, 0xee, 0xff, 0x96, 0xe6, 0xff, 0xd4, 0xff, 0xff, 0x81, 0xf4, 0xff, 
+  0xff, 0x00, 0xd5, 0xee, 0xff, 0x81, 0xfa, 0xf6, 0xff, 0x04, 0x95, 0xd6, 0xff, 0x93, 0xce, 0xff, 0x72, 0xce, 0xff, 0x8c, 0xf5, 0xff, 0x04, 0xfc, 0xff, 0x83, 0x80, 0xfb, 0xff, 0x84, 0x60, 0xfb, 
+  0xff, 0x07, 0x62, 0xf3, 0xff, 0x12, 0xb5, 0xff, 0x13, 0xef, 0xff, 0xd3, 0xff, 0xff, 0x93, 0xf7, 0xff, 0x73, 0xf7, 0xff, 0x57, 0xde, 0xff, 0x3c, 0xef, 0xff, 0x81, 0xbf, 0xff, 0xff, 0x0d, 0x9e, 
+  0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x95, 0xce, 0xff, 0xb3, 0xc6, 0xff, 0x95, 0xd6, 0xff, 0xfa, 0xee, 0xff, 0xd9, 0xee, 0xff, 
+  0x7d, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0x8f, 0xd4, 0xff, 0x84, 0x60, 0xfb, 0xff, 0x84, 0x80, 0xfb, 0xff, 0x04, 0x04, 0xfc, 0xff, 0x2c, 0xfd, 0xff, 0x15, 0xe6, 0xff, 0x55, 0xde, 0xff, 0xb4, 0xff, 
+  0xff, 0x81, 0xf4, 0xff, 0xff, 0x02, 0xf5, 0xee, 0xff, 0x96, 0xe6, 0xff, 0xd4, 0xff, 0xff, 0x81, 0xf4, 0xff, 0xff, 0x07, 0xd5, 0xee, 0xff, 0xf9, 0xf6, 0xff, 0xfa, 0xf6, 0xff, 0x95, 0xd6, 0xff, 
+  0x93, 0xce, 0xff, 0x51, 0xde, 0xff, 0x6c, 0xfd, 0xff, 0x05, 0xfc, 0xff, 0x82, 0x80, 0xfb, 0xff, 0x86, 0x60, 0xfb, 0xff, 0x07, 0x0d, 0xc4, 0xff, 0xf6, 0xcd, 0xff, 0xb8, 0xe6, 0xff, 0x73, 0xf7, 
+  0xff, 0xd3, 0xff, 0xff, 0xb3, 0xff, 0xff, 0x73, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x81, 0xbf, 0xff, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0xbe, 0xf7, 0xff, 0x00, 
+  0x95, 0xce, 0xff, 0x81, 0xb2, 0xc6, 0xff, 0x05, 0x95, 0xd6, 0xff, 0xfa, 0xee, 0xff, 0xd9, 0xee, 0xff, 0x1c, 0xe7, 0xff, 0xf8, 0xc5, 0xff, 0xa8, 0xeb, 0xff, 0x85, 0x60, 0xfb, 0xff, 0x83, 0x80, 
+  0xfb, 0xff, 0x07, 0xc3, 0xfb, 0xff, 0xc8, 0xfc, 0xff, 0x2e, 0xfe, 0xff, 0x32, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xee, 0xff, 0x95, 0xe6, 0xff, 0xd4, 0xff, 0xff, 0x81, 0xf4, 0xff, 0xff, 0x00, 
+  0xd5, 0xee, 0xff, 0x81, 0xf9, 0xf6, 0xff, 0x05, 0x95, 0xd6, 0xff, 0x51, 0xd6, 0xff, 0xef, 0xf5, 0xff, 0x0a, 0xfd, 0xff, 0xc3, 0xfb, 0xff, 0x80, 0xfb, 0xff, 0x88, 0x60, 0xfb, 0xff, 0x08, 0x64, 
+  0xe3, 0xff, 0xee, 0x94, 0xff, 0x77, 0xde, 0xff, 0xfa, 0xee, 0xff, 0xb8, 0xee, 0xff, 0x73, 0xf7, 0xff, 0xd2, 0xff, 0xff, 0xf3, 0xff, 0xff, 0x3b, 0xef, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x02, 0x9e, 
+  0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0xbe, 0xf7, 0xff, 0x00, 0x94, 0xce, 0xff, 0x82, 0x92, 0xbe, 0xff, 0x05, 0x95, 0xd6, 0xff, 0xf9, 0xee, 0xff, 0xb9, 0xee, 0xff, 0x79, 0xd6, 
+  0xff, 0x34, 0xbd, 0xff, 0x41, 0xfb, 0xff, 0x88, 0x60, 0xfb, 0xff, 0x81, 0x80, 0xfb, 0xff, 0x0e, 0x46, 0xfc, 0xff, 0x2b, 0xfd, 0xff, 0xee, 0xfd, 0xff, 0x12, 0xf6, 0xff, 0x52, 0xff, 0xff, 0xb3, 
+  0xff, 0xff, 0xd3, 0xff, 0xff, 0xb4, 0xee, 0xff, 0xd8, 0xf6, 0xff, 0xb7, 0xf6, 0xff, 0x53, 0xf6, 0xff, 0x0f, 0xfe, 0xff, 0x6c, 0xfd, 0xff, 0x47, 0xfc, 0xff, 0x80, 0xfb, 0xff, 0x89, 0x60, 0xfb, 
+  0xff, 0x09, 0x41, 0xf3, 0xff, 0x4b, 0x9c, 0xff, 0xd0, 0xad, 0xff, 0x72, 0xc6, 0xff, 0xd8, 0xe6, 0xff, 0xf9, 0xee, 0xff, 0xb8, 0xee, 0xff, 0x73, 0xf7, 0xff, 0xf2, 0xff, 0xff, 0x3b, 0xef, 0xff, 
+  0x81, 0xbe, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0xbe, 0xf7, 0xff, 0x01, 0x94, 0xce, 0xff, 0x91, 0xbe, 0xff, 0x82, 0x92, 0xbe, 0xff, 0x05, 0x75, 0xce, 
+  0xff, 0xd9, 0xee, 0xff, 0x98, 0xe6, 0xff, 0xf7, 0xc5, 0xff, 0x90, 0xc4, 0xff, 0x40, 0xfb, 0xff, 0x8a, 0x60, 0xfb, 0xff, 0x04, 0x80, 0xfb, 0xff, 0x04, 0xfc, 0xff, 0xea, 0xfc, 0xff, 0x6c, 0xfd, 
+  0xff, 0xef, 0xfd, 0xff, 0x81, 0x51, 0xfe, 0xff, 0x03, 0xef, 0xfd, 0xff, 0x8d, 0xfd, 0xff, 0xea, 0xfc, 0xff, 0x04, 0xfc, 0xff, 0x8a, 0x60, 0xfb, 0xff, 0x81, 0x40, 0xfb, 0xff, 0x09, 0xe9, 0xab, 
+  0xff, 0x4e, 0x9d, 0xff, 0x51, 0xbe, 0xff, 0x92, 0xbe, 0xff, 0x72, 0xc6, 0xff, 0xb8, 0xe6, 0xff, 0xf9, 0xee, 0xff, 0xb8, 0xee, 0xff, 0x72, 0xf7, 0xff, 0x3b, 0xef, 0xff, 0x81, 0xbe, 0xf7, 0xff, 
+  0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0xbe, 0xf7, 0xff, 0x00, 0x94, 0xc6, 0xff, 0x84, 0x91, 0xbe, 0xff, 0x05, 0x75, 0xce, 0xff, 0xd9, 0xee, 0xff, 0x57, 0xde, 0xff, 
+  0x96, 0xbd, 0xff, 0x2d, 0xcc, 0xff, 0x40, 0xfb, 0xff, 0x9c, 0x60, 0xfb, 0xff, 0x83, 0x40, 0xfb, 0xff, 0x03, 0xa7, 0xbb, 0xff, 0xed, 0x94, 0xff, 0x10, 0xb6, 0xff, 0x71, 0xbe, 0xff, 0x81, 0x91, 
+  0xbe, 0xff, 0x04, 0x72, 0xbe, 0xff, 0xb8, 0xe6, 0xff, 0xf9, 0xee, 0xff, 0xb8, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 
+  0x82, 0xbe, 0xf7, 0xff, 0x00, 0x74, 0xc6, 0xff, 0x82, 0x91, 0xbe, 0xff, 0x00, 0x71, 0xbe, 0xff, 0x81, 0x91, 0xbe, 0xff, 0x04, 0x74, 0xce, 0xff, 0xd9, 0xee, 0xff, 0x16, 0xd6, 0xff, 0x55, 0xb5, 
+  0xff, 0x0c, 0xd4, 0xff, 0x82, 0x40, 0xfb, 0xff, 0x96, 0x60, 0xfb, 0xff, 0x84, 0x40, 0xfb, 0xff, 0x03, 0x20, 0xfb, 0xff, 0x86, 0xbb, 0xff, 0xac, 0x8c, 0xff, 0xef, 0xad, 0xff, 0x81, 0x71, 0xbe, 
+  0xff, 0x82, 0x91, 0xbe, 0xff, 0x03, 0x72, 0xbe, 0xff, 0xb8, 0xe6, 0xff, 0xd9, 0xee, 0xff, 0x1b, 0xef, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 
+  0x82, 0xbe, 0xf7, 0xff, 0x00, 0x74, 0xc6, 0xff, 0x86, 0x71, 0xbe, 0xff, 0x05, 0x74, 0xce, 0xff, 0xb9, 0xee, 0xff, 0xf6, 0xd5, 0xff, 0x55, 0xad, 0xff, 0x0d, 0xcc, 0xff, 0x20, 0xfb, 0xff, 0x84, 
+  0x40, 0xfb, 0xff, 0x8e, 0x60, 0xfb, 0xff, 0x87, 0x40, 0xfb, 0xff, 0x04, 0x20, 0xfb, 0xff, 0x87, 0xb3, 0xff, 0xac, 0x84, 0xff, 0xcf, 0xad, 0xff, 0x50, 0xb6, 0xff, 0x86, 0x71, 0xbe, 0xff, 0x01, 
+  0xb8, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0xbe, 0xf7, 0xff, 0x06, 0x74, 0xc6, 0xff, 0x70, 0xbe, 0xff, 0x70, 
+  0xb6, 0xff, 0x70, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x71, 0xbe, 0xff, 0x70, 0xb6, 0xff, 0x81, 0x70, 0xbe, 0xff, 0x05, 0x54, 0xce, 0xff, 0xb9, 0xee, 0xff, 0xf6, 0xd5, 0xff, 0x55, 0xb5, 0xff, 0x70, 
+  0xbc, 0xff, 0x22, 0xf3, 0xff, 0x99, 0x40, 0xfb, 0xff, 0x04, 0x01, 0xeb, 0xff, 0xa8, 0x9b, 0xff, 0xac, 0x8c, 0xff, 0xcf, 0xa5, 0xff, 0x50, 0xb6, 0xff, 0x83, 0x70, 0xbe, 0xff, 0x01, 0x70, 0xb6, 
+  0xff, 0x70, 0xbe, 0xff, 0x81, 0x70, 0xb6, 0xff, 0x01, 0x71, 0xbe, 0xff, 0x1b, 0xe7, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x02, 0x9e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0x1c, 0xe7, 0x70, 0x82, 0xbe, 0xf7, 
+  0xff, 0x00, 0x74, 0xc6, 0xff, 0x88, 0x70, 0xb6, 0xff, 0x06, 0x54, 0xce, 0xff, 0xb9, 0xee, 0xff, 0x16, 0xd6, 0xff, 0x32, 0xad, 0xff, 0xaa, 0xac, 0xff, 0x85, 0xdb, 0xff, 0x20, 0xfb, 0xff, 0x95, 
+  0x40, 0xfb, 0xff, 0x05, 0x20, 0xfb, 0xff, 0x24, 0xd3, 0xff, 0xe9, 0x83, 0xff, 0xcc, 0x8c, 0xff, 0xcf, 0xad, 0xff, 0x50, 0xb6, 0xff, 0x81, 0x70, 0xbe, 0xff, 0x87, 0x70, 0xb6, 0xff, 0x00, 0x1b, 
+  0xe7, 0xff, 0x81, 0xbe, 0xf7, 0xff, 0x02, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0xfc, 0xe6, 0x70, 0x82, 0xbe, 0xf7, 0xff, 0x00, 0x73, 0xc6, 0xff, 0x87, 0x70, 0xb6, 0xff, 0x09, 0x50, 0xb6, 0xff, 
+  0x96, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x75, 0xe6, 0xff, 0x50, 0xef, 0xff, 0x6e, 0xd6, 0xff, 0x4b, 0xad, 0xff, 0xa9, 0xab, 0xff, 0x03, 0xe3, 0xff, 0x20, 0xfb, 0xff, 0x91, 0x40, 0xfb, 0xff, 0x06, 
+  0x20, 0xfb, 0xff, 0x03, 0xdb, 0xff, 0x88, 0x9b, 0xff, 0x4b, 0x7c, 0xff, 0x2d, 0x95, 0xff, 0xef, 0xad, 0xff, 0x50, 0xb6, 0xff, 0x8a, 0x70, 0xb6, 0xff, 0x06, 0x1b, 0xe7, 0xff, 0xbe, 0xf7, 0xff, 
+  0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0xfc, 0xe6, 0x70, 0xbe, 0xf7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x00, 0x73, 0xc6, 0xff, 0x83, 0x70, 0xb6, 0xff, 0x00, 0x50, 0xb6, 0xff, 0x81, 
+  0x70, 0xb6, 0xff, 0x0d, 0x50, 0xb6, 0xff, 0x76, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x75, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xcd, 0xff, 0xce, 0xac, 0xff, 0x0a, 
+  0xa5, 0xff, 0x28, 0xb4, 0xff, 0x64, 0xdb, 0xff, 0x00, 0xf3, 0xff, 0x20, 0xfb, 0xff, 0x8b, 0x40, 0xfb, 0xff, 0x0c, 0x20, 0xfb, 0xff, 0x00, 0xf3, 0xff, 0x26, 0xd3, 0xff, 0x8b, 0xa3, 0xff, 0x0a, 
+  0x74, 0xff, 0xcc, 0x8c, 0xff, 0xae, 0xa5, 0xff, 0x2f, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x81, 0x70, 0xb6, 0xff, 0x06, 0x50, 
+  0xb6, 0xff, 0x4f, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x51, 0xb6, 0xff, 0x1b, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0xfc, 
+  0xe6, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0x73, 0xc6, 0xff, 0x85, 0x4f, 0xb6, 0xff, 0x04, 0x50, 0xb6, 0xff, 0x76, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x75, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0x81, 0xf0, 
+  0xff, 0xff, 0x0a, 0xd2, 0xe6, 0xff, 0x53, 0xde, 0xff, 0x6f, 0xf7, 0xff, 0xee, 0xde, 0xff, 0xec, 0xc5, 0xff, 0x0c, 0x8c, 0xff, 0x8c, 0x8b, 0xff, 0x29, 0xab, 0xff, 0x27, 0xcb, 0xff, 0x03, 0xe3, 
+  0xff, 0x00, 0xfb, 0xff, 0x85, 0x20, 0xfb, 0xff, 0x08, 0x00, 0xfb, 0xff, 0xe2, 0xe2, 0xff, 0x48, 0xcb, 0xff, 0xed, 0xb3, 0xff, 0x50, 0x9c, 0xff, 0x50, 0x94, 0xff, 0x13, 0xb5, 0xff, 0xb3, 0xbd, 
+  0xff, 0x0f, 0xae, 0xff, 0x8a, 0x4f, 0xb6, 0xff, 0x04, 0x6f, 0xb6, 0xff, 0x70, 0xb6, 0xff, 0x50, 0xb6, 0xff, 0x3a, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x7e, 0xf7, 0xe4, 
+  0x00, 0x00, 0x0b, 0xfc, 0xe6, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0x53, 0xc6, 0xff, 0x85, 0x4f, 0xb6, 0xff, 0x03, 0x97, 0xde, 0xff, 0xfa, 0xee, 0xff, 0x96, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0x81, 
+  0xf0, 0xff, 0xff, 0x0c, 0xd2, 0xe6, 0xff, 0x74, 0xde, 0xff, 0xd0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x11, 0xd6, 0xff, 0x94, 0xc5, 0xff, 0xf2, 0xac, 0xff, 0xd2, 0xa4, 0xff, 0x71, 
+  0x94, 0xff, 0x0f, 0x8c, 0xff, 0xad, 0x93, 0xff, 0x01, 0xf3, 0xff, 0x83, 0x20, 0xfb, 0xff, 0x09, 0x01, 0xf3, 0xff, 0x6c, 0x83, 0xff, 0xae, 0x83, 0xff, 0x0f, 0x8c, 0xff, 0x75, 0xb5, 0xff, 0x7a, 
+  0xd6, 0xff, 0xdb, 0xe6, 0xff, 0x78, 0xde, 0xff, 0xd9, 0xee, 0xff, 0x97, 0xde, 0xff, 0x8b, 0x4f, 0xb6, 0xff, 0x03, 0x50, 0xb6, 0xff, 0x3a, 0xae, 0xff, 0x1c, 0xae, 0xff, 0x1c, 0xe7, 0xff, 0x81, 
+  0x9e, 0xf7, 0xff, 0x02, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0xfc, 0xe6, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x00, 0x53, 0xc6, 0xff, 0x84, 0x4f, 0xb6, 0xff, 0x0d, 0xb7, 0xde, 0xff, 0x1b, 0xf7, 0xff, 
+  0x96, 0xe6, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf3, 0xee, 0xff, 0x94, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0x4e, 0xef, 0xff, 0xaf, 0xf7, 0xff, 0x72, 0xde, 0xff, 0x58, 0xde, 
+  0xff, 0x57, 0xd6, 0xff, 0x81, 0x99, 0xde, 0xff, 0x03, 0x58, 0xd6, 0xff, 0xf7, 0xcd, 0xff, 0x34, 0xad, 0xff, 0x6a, 0xbb, 0xff, 0x83, 0x20, 0xfb, 0xff, 0x0a, 0xac, 0xbb, 0xff, 0x34, 0xad, 0xff, 
+  0x74, 0xbd, 0xff, 0xd6, 0xcd, 0xff, 0x17, 0xd6, 0xff, 0x7d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xd9, 0xee, 0xff, 0x1b, 0xf7, 0xff, 0xb8, 0xde, 0xff, 0x89, 0x4f, 0xb6, 0xff, 0x01, 
+  0x50, 0xb6, 0xff, 0x1a, 0xae, 0xff, 0x81, 0x1c, 0xae, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0xfc, 0xe6, 0x70, 0x82, 0x9e, 0xf7, 0xff, 
+  0x00, 0x73, 0xc6, 0xff, 0x83, 0x4f, 0xb6, 0xff, 0x03, 0xd8, 0xde, 0xff, 0x5c, 0xf7, 0xff, 0xd7, 0xe6, 0xff, 0xaf, 0xff, 0xff, 0x81, 0xef, 0xff, 0xff, 0x0f, 0xf3, 0xee, 0xff, 0x95, 0xe6, 0xff, 
+  0xcf, 0xff, 0xff, 0x8f, 0xf7, 0xff, 0xcf, 0xff, 0xff, 0x73, 0xde, 0xff, 0x99, 0xde, 0xff, 0x78, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x1b, 0xef, 0xff, 0xfb, 0xee, 0xff, 0xfb, 0xe6, 0xff, 0xda, 0xe6, 
+  0xff, 0x17, 0xce, 0xff, 0xd2, 0xa4, 0xff, 0x25, 0xe3, 0xff, 0x81, 0x20, 0xfb, 0xff, 0x04, 0x26, 0xe3, 0xff, 0x14, 0xad, 0xff, 0x99, 0xde, 0xff, 0xba, 0xde, 0xff, 0x79, 0xde, 0xff, 0x81, 0x99, 
+  0xde, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xbe, 0xff, 0xff, 0xfa, 0xee, 0xff, 0x5c, 0xf7, 0xff, 0xd8, 0xde, 0xff, 0x87, 0x4f, 0xb6, 0xff, 0x01, 0x50, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x82, 0x1c, 
+  0xae, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x7e, 0xf7, 0xe4, 0x00, 0x00, 0x0b, 0xfc, 0xe6, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x07, 0x73, 0xc6, 0xff, 0x4f, 0xb6, 0xff, 0x4f, 
+  0xae, 0xff, 0x4f, 0xb6, 0xff, 0xf9, 0xe6, 0xff, 0x7d, 0xff, 0xff, 0xf8, 0xee, 0xff, 0xcf, 0xff, 0xff, 0x81, 0xef, 0xff, 0xff, 0x02, 0x13, 0xef, 0xff, 0xb5, 0xe6, 0xff, 0xcf, 0xff, 0xff, 0x81, 
+  0xef, 0xff, 0xff, 0x03, 0x36, 0xef, 0xff, 0x78, 0xde, 0xff, 0xba, 0xde, 0xff, 0xda, 0xe6, 0xff, 0x82, 0x1c, 0xef, 0xff, 0x04, 0x1b, 0xe7, 0xff, 0x99, 0xde, 0xff, 0xba, 0xde, 0xff, 0xf7, 0xc5, 
+  0xff, 0x0f, 0xa4, 0xff, 0x81, 0x00, 0xfb, 0xff, 0x0e, 0x70, 0xac, 0xff, 0x58, 0xd6, 0xff, 0xdb, 0xe6, 0xff, 0xba, 0xde, 0xff, 0xba, 0xe6, 0xff, 0x79, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe6, 
+  0xff, 0xbe, 0xff, 0xff, 0x3c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x1b, 0xef, 0xff, 0x7d, 0xff, 0xff, 0xf9, 0xe6, 0xff, 0x4f, 0xb6, 0xff, 0x82, 0x4f, 0xae, 0xff, 0x03, 0x4f, 0xb6, 0xff, 0x4f, 0xae, 
+  0xff, 0x50, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x83, 0x1c, 0xae, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 0xfb, 0xde, 0x70, 0x82, 0x9e, 0xf7, 
+  0xff, 0x06, 0x73, 0xc6, 0xff, 0x4e, 0xae, 0xff, 0x4f, 0xb6, 0xff, 0x3a, 0xe7, 0xff, 0xbe, 0xff, 0xff, 0x19, 0xef, 0xff, 0xcf, 0xff, 0xff, 0x81, 0xef, 0xff, 0xff, 0x01, 0x14, 0xef, 0xff, 0xd6, 
+  0xe6, 0xff, 0x82, 0xef, 0xff, 0xff, 0x02, 0xb3, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x1c, 0xef, 0xff, 0x81, 0xba, 0xde, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xef, 0xff, 0x00, 0xba, 0xde, 0xff, 
+  0x81, 0xfb, 0xe6, 0xff, 0x0a, 0x79, 0xd6, 0xff, 0xb6, 0xbd, 0xff, 0xab, 0xcb, 0xff, 0xab, 0xc3, 0xff, 0xd7, 0xbd, 0xff, 0xdb, 0xe6, 0xff, 0xda, 0xde, 0xff, 0xdb, 0xe6, 0xff, 0x99, 0xde, 0xff, 
+  0xff, 0xff, 0xff, 0xda, 0xe6, 0xff, 0x81, 0xba, 0xde, 0xff, 0x0b, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xff, 0xff, 0x3c, 0xef, 0xff, 0xbe, 0xff, 0xff, 0x1a, 0xe7, 0xff, 0x2f, 0xae, 0xff, 
+  0x4e, 0xae, 0xff, 0x4f, 0xae, 0xff, 0x4e, 0xae, 0xff, 0x30, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x84, 0x1c, 0xae, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xe4, 0x00, 
+  0x00, 0x0b, 0xfb, 0xde, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x09, 0x73, 0xc6, 0xff, 0x4f, 0xae, 0xff, 0x3b, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0x39, 0xef, 0xff, 0xcf, 0xff, 0xff, 0x6e, 0xf7, 0xff, 0xef, 
+  0xff, 0xff, 0x34, 0xef, 0xff, 0xf7, 0xee, 0xff, 0x82, 0xef, 0xff, 0xff, 0x08, 0xb4, 0xde, 0xff, 0x1b, 0xe7, 0xff, 0x99, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x1c, 0xef, 0xff, 0xdb, 0xde, 0xff, 0xfb, 
+  0xe6, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x02, 0xdb, 0xde, 0xff, 0x5d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0x81, 0x55, 0xad, 0xff, 0x04, 0xba, 0xde, 0xff, 0xfb, 0xe6, 
+  0xff, 0x1c, 0xe7, 0xff, 0x9a, 0xde, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfb, 0xe6, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x0a, 0xda, 0xe6, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x5c, 
+  0xf7, 0xff, 0xdf, 0xff, 0xff, 0x5b, 0xe7, 0xff, 0x4f, 0xae, 0xff, 0x4e, 0xae, 0xff, 0x2f, 0xae, 0xff, 0x1a, 0xae, 0xff, 0x83, 0x1c, 0xae, 0xff, 0x02, 0xfb, 0xad, 0xff, 0xfb, 0xa5, 0xff, 0x1c, 
+  0xe7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 0xfb, 0xde, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x08, 0x74, 0xc6, 0xff, 0x5b, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xef, 
+  0xff, 0xaf, 0xff, 0xff, 0x4e, 0xef, 0xff, 0xef, 0xff, 0xff, 0x35, 0xef, 0xff, 0x17, 0xef, 0xff, 0x82, 0xef, 0xff, 0xff, 0x01, 0xb4, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x04, 
+  0xba, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xda, 0xe6, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xe7, 0xff, 0x0b, 0xfb, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 
+  0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0xfc, 0xe6, 0xff, 0x3c, 0xe7, 0xff, 0x9a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x83, 0x3c, 0xe7, 0xff, 0x0f, 0xdb, 0xe6, 0xff, 
+  0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xf7, 0xff, 0x5c, 0xef, 0xff, 0x9e, 0xff, 0xff, 0xd9, 0xde, 0xff, 0x31, 0xb6, 0xff, 0x52, 0xbe, 0xff, 0x58, 0xc6, 0xff, 0x7b, 0xce, 0xff, 0xbb, 0xce, 
+  0xff, 0xdb, 0xd6, 0xff, 0xdc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x82, 0x9e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 0xfb, 0xde, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x07, 
+  0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xf7, 0xff, 0xcf, 0xff, 0xff, 0xee, 0xff, 0xff, 0xce, 0xff, 0xff, 0x34, 0xef, 0xff, 0x17, 0xef, 0xff, 0x82, 0xef, 0xff, 0xff, 0x01, 0xb4, 0xde, 0xff, 
+  0x1c, 0xe7, 0xff, 0x83, 0x3c, 0xe7, 0xff, 0x01, 0xba, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x82, 0x3c, 0xe7, 0xff, 0x00, 0xfb, 0xde, 0xff, 0x83, 0x7d, 0xef, 0xff, 0x06, 0x3d, 0xef, 0xff, 0x1c, 0xe7, 
+  0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0x58, 0xd6, 0xff, 0xba, 0xde, 0xff, 0x82, 0xfb, 0xe6, 0xff, 0x00, 0x1b, 0xe7, 0xff, 0x81, 0x1c, 0xe7, 0xff, 0x03, 0x1b, 0xe7, 0xff, 
+  0x5c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x8d, 0x9e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 0xfb, 0xde, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x06, 0x7d, 0xf7, 0xff, 0x5a, 
+  0xf7, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xee, 0xff, 0xff, 0x34, 0xef, 0xff, 0xf7, 0xee, 0xff, 0x82, 0xef, 0xff, 0xff, 0x01, 0xb4, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x84, 0x3c, 0xe7, 0xff, 
+  0x00, 0x1c, 0xe7, 0xff, 0x81, 0xfb, 0xe6, 0xff, 0x04, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0xda, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x81, 0x3c, 0xef, 0xff, 0x00, 0x1b, 0xe7, 0xff, 
+  0x81, 0x3c, 0xef, 0xff, 0x01, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0x99, 0x9e, 0xf7, 0xff, 0x02, 0x7d, 0xef, 0xe4, 0x00, 0x00, 0x0b, 0xfb, 0xde, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x01, 0xd8, 0xe6, 
+  0xff, 0xcf, 0xff, 0xff, 0x81, 0xef, 0xff, 0xff, 0x05, 0x34, 0xef, 0xff, 0xd7, 0xe6, 0xff, 0x8e, 0xf7, 0xff, 0x8f, 0xf7, 0xff, 0x90, 0xf7, 0xff, 0xb4, 0xde, 0xff, 0x81, 0xfb, 0xe6, 0xff, 0x81, 
+  0x1b, 0xe7, 0xff, 0x00, 0x1c, 0xe7, 0xff, 0x81, 0x3c, 0xef, 0xff, 0x01, 0x5c, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0xa1, 0x9e, 0xf7, 0xff, 0x07, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x1c, 0xe7, 0xdb, 
+  0xfb, 0xde, 0xcb, 0xdb, 0xde, 0xbb, 0xbb, 0xde, 0x97, 0x00, 0x00, 0x08, 0xfb, 0xde, 0x70, 0x82, 0x9e, 0xf7, 0xff, 0x06, 0x59, 0xef, 0xff, 0x58, 0xef, 0xff, 0x59, 0xef, 0xff, 0x3a, 0xef, 0xff, 
+  0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xf7, 0xff, 0xa0, 0x9e, 0xf7, 0xff, 0x14, 0x9e, 0xf7, 0xfc, 0x5d, 0xef, 0xf0, 0x3c, 0xe7, 0xe3, 0xfc, 0xe6, 0xd3, 0xdb, 0xde, 0xc3, 0xdb, 0xde, 0xb3, 
+  0xdb, 0xde, 0xa3, 0x9a, 0xd6, 0x90, 0x38, 0xc6, 0x7f, 0x96, 0xb5, 0x6c, 0xd3, 0x9c, 0x58, 0xaf, 0x7b, 0x44, 0xa7, 0x39, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 
+  0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x70, 0x9e, 0x9e, 0xf7, 0xff, 0x15, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x1c, 0xe7, 0xdb, 0xfb, 0xde, 0xcb, 0xdb, 0xde, 
+  0xbb, 0xdb, 0xde, 0xab, 0xdb, 0xde, 0x98, 0x79, 0xce, 0x88, 0xd7, 0xbd, 0x77, 0x35, 0xad, 0x63, 0x51, 0x8c, 0x4f, 0xcb, 0x5a, 0x3c, 0x62, 0x10, 0x2b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 
+  0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x70, 
+  0x91, 0x9e, 0xf7, 0xff, 0x13, 0x9e, 0xf7, 0xfc, 0x5d, 0xef, 0xf0, 0x3c, 0xe7, 0xe3, 0xfc, 0xe6, 0xd3, 0xdb, 0xde, 0xc3, 0xdb, 0xde, 0xb3, 0xdb, 0xde, 0xa3, 0x9a, 0xd6, 0x90, 0x38, 0xc6, 0x7f, 
+  0x96, 0xb5, 0x6c, 0xd3, 0x9c, 0x58, 0xaf, 0x7b, 0x44, 0xa7, 0x39, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 
+  0x0b, 0x81, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x94, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xde, 0x70, 0x85, 0x9e, 0xf7, 0xff, 0x15, 0x7e, 0xf7, 0xf8, 0x5d, 0xef, 0xe8, 0x1c, 
+  0xe7, 0xdb, 0xfb, 0xde, 0xcb, 0xdb, 0xde, 0xbb, 0xdb, 0xde, 0xab, 0xdb, 0xde, 0x98, 0x79, 0xce, 0x88, 0xd7, 0xbd, 0x77, 0x35, 0xad, 0x63, 0x51, 0x8c, 0x4f, 0xeb, 0x5a, 0x3c, 0x62, 0x10, 0x2b, 
+  0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0xa0, 
+  0x00, 0x00, 0x00, 0x0d, 0x59, 0xce, 0x43, 0xba, 0xd6, 0x8f, 0x38, 0xc6, 0x7f, 0x96, 0xb5, 0x6c, 0xd3, 0x9c, 0x58, 0xaf, 0x7b, 0x44, 0xa7, 0x39, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 
+  0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0xb9, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0xac, 0x6c, 0x0c, 0xac, 0x6c, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe5, 0x0a, 0x27, 0xfd, 0xac, 0x68, 0xfd, 0xcd, 0x9f, 0xfe, 0x0e, 0xcb, 0xfe, 0x50, 0xe8, 0xfe, 0x91, 0xfc, 0xfe, 0xb2, 0xff, 0xfe, 0xb2, 0xff, 0xfe, 0x91, 0xfc, 0xfe, 0x70, 0xe8, 0xfe, 0x50, 0xc8, 0xfe, 0x0f, 0x9f, 0xfd, 0xee, 0x67, 0xe5, 0x6c, 0x24, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x87, 0x1b, 0xfd, 0x28, 0x7b, 0xfd, 0x6a, 0xd4, 0xfd, 0x8a, 0xff, 0xfd, 0x49, 0xff, 0xfc, 0xe8, 0xff, 0xfc, 0xa6, 0xff, 0xfc, 0x63, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0x63, 0xff, 0xfc, 0xa6, 0xff, 0xfd, 0x09, 0xff, 0xfd, 0x6b, 0xff, 0xfd, 0xcc, 0xff, 0xfd, 0xcc, 0xd3, 0xfd, 0x8b, 0x78, 0xdc, 0xc9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x25, 0x1f, 0xfc, 0xc6, 0x9b, 0xfd, 0x07, 0xf8, 0xfc, 0xc6, 0xff, 0xfc, 0x63, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x84, 0xff, 0xfd, 0x08, 0xff, 0xfd, 0x6a, 0xf7, 0xfd, 0x4a, 0x97, 0xe4, 0xc8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xe2, 0x08, 0xfc, 0x64, 0x7c, 0xfc, 0xa5, 0xf4, 0xfc, 0x64, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0xc6, 0xff, 0xfd, 0x28, 0xf4, 0xfd, 0x08, 0x78, 0x93, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x08, 0x20, 0x04, 0x18, 0x40, 0x04, 0x20, 0x61, 0x04, 0x28, 0x81, 0x04, 0x30, 0x81, 0x04, 0x38, 0xa1, 0x04, 0x38, 0xa1, 0x04, 0xe3, 0xc2, 0x2b, 0xfc, 0x43, 0xcc, 0xfc, 0x42, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0xc6, 0xff, 0xfd, 0x07, 0xcb, 0xe4, 0x66, 0x27, 0x38, 0xa1, 0x04, 0x30, 0xa1, 0x04, 0x30, 0x81, 0x04, 0x28, 0x61, 0x04, 0x20, 0x60, 0x04, 0x10, 0x40, 0x04, 0x08, 0x20, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-  0xf7, 0x9e, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xfc, 0x85, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x43, 0xff, 0xfd, 0x08, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe3, 0x00, 0x00, 0x07, 
-  0xe7, 0x3c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xfe, 0x97, 0xff, 0xfc, 0x42, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x21, 0xff, 0xfc, 0xa5, 0xff, 0xfe, 0xb8, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x3c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf6, 0x97, 0xff, 0xfc, 0x42, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x84, 0xff, 0xf6, 0xb8, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x3c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x1b, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xf6, 0xb8, 0xff, 0xfc, 0x43, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x84, 0xff, 0xf6, 0xb8, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x1a, 0xff, 0xef, 0x59, 0xff, 0xef, 0x59, 0xff, 0xef, 0x59, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x1a, 0xff, 0xef, 0x59, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x3c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x3b, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x9d, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x5b, 0xff, 0xfc, 0x86, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xc0, 0xff, 0xeb, 0xa3, 0xff, 0xd3, 0x84, 0xff, 0xc3, 0xc6, 0xff, 0xbb, 0xc6, 0xff, 0xbb, 0xc6, 0xff, 0xc3, 0x68, 0xff, 0xd3, 0xa7, 0xff, 0xeb, 0xa2, 0xff, 0xfb, 0xc0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0xa8, 0xff, 0xee, 0xb6, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xef, 0x13, 0xff, 0xe6, 0xb5, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xef, 0x3b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x3c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x3c, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x9d, 0xff, 0xfd, 0x6e, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xf3, 0xc1, 0xff, 0xc3, 0xca, 0xff, 0x9b, 0xed, 0xff, 0x94, 0x71, 0xff, 0x9c, 0x91, 0xff, 0xa4, 0xcb, 0xff, 0xad, 0x4b, 0xff, 0xad, 0x4b, 0xff, 0xa4, 0xeb, 0xff, 0x94, 0x50, 0xff, 0x94, 0x50, 0xff, 0x9b, 0xcd, 0xff, 0xcb, 0xc9, 0xff, 0xf3, 0xc1, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfd, 0x88, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xee, 0xf3, 0xff, 0xe6, 0xb5, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xef, 0x3b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xfe, 0x76, 0xff, 0xfc, 0x01, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xcb, 0xca, 0xff, 0x9c, 0x70, 0xff, 0xad, 0x13, 0xff, 0xc5, 0xd6, 0xff, 0xce, 0x17, 0xff, 0xe6, 0xba, 0xff, 0xe6, 0x98, 0xff, 0xe6, 0xaf, 0xff, 0xf7, 0x6f, 0xff, 0xef, 0x4f, 0xff, 0xde, 0xaf, 0xff, 0xcd, 0xd5, 0xff, 0xbd, 0x95, 0xff, 0x9c, 0xb2, 0xff, 0x9c, 0x50, 0xff, 0xd3, 0xc9, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x01, 0xff, 0xfe, 0xcc, 0xff, 0xee, 0xf3, 0xff, 0xe6, 0xb5, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0x72, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x7c, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x1b, 0xff, 0xfc, 0x67, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xf3, 0xc2, 0xff, 0xac, 0x2e, 0xff, 0xad, 0x13, 0xff, 0xce, 0x17, 0xff, 0xe6, 0xfb, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xee, 0xfa, 0xff, 0xff, 0x9d, 0xff, 0xf7, 0x71, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x50, 0xff, 0xee, 0xb9, 0xff, 0xe6, 0xb9, 0xff, 0xbd, 0x95, 0xff, 0xa4, 0xf3, 0xff, 0xb4, 0x0d, 0xff, 0xf3, 0xc1, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x45, 0xff, 0xe6, 0x74, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0x72, 0xff, 0xde, 0x99, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xda, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0x5c, 0xff, 0xee, 0xda, 0xff, 0xff, 0xff, 0xff, 0xee, 0xfa, 0xff, 0xf5, 0xd3, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xeb, 0xc4, 0xff, 0xa4, 0x70, 0xff, 0xbd, 0x95, 0xff, 0xe6, 0xba, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5b, 0xff, 0xee, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x98, 0xff, 0xf7, 0x30, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x6f, 0xff, 0xf7, 0x50, 0xff, 0xee, 0xf9, 0xff, 0xf7, 0x1b, 0xff, 0xd6, 0x37, 0xff, 0xb5, 0x54, 0xff, 0xac, 0x4f, 0xff, 0xf3, 0xc2, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfe, 0x6b, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0x72, 0xff, 0xde, 0x99, 0xff, 0xde, 0x78, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5b, 0xff, 0xe6, 0xb9, 0xff, 0xff, 0xbe, 0xff, 0xfc, 0x67, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xf3, 0xe2, 0xff, 0xac, 0x70, 0xff, 0xc5, 0xb6, 0xff, 0xee, 0xfb, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x3b, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xda, 0xff, 0xde, 0x78, 0xff, 0xde, 0x37, 0xff, 0xef, 0x30, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x50, 0xff, 0xee, 0xf9, 0xff, 0xf7, 0x3b, 0xff, 0xde, 0x78, 0xff, 0xbd, 0x95, 0xff, 0xac, 0x4f, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfc, 0xa5, 0xff, 0xff, 0xaf, 0xff, 0xde, 0x72, 0xff, 0xde, 0x78, 0xff, 0xde, 0x78, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xff, 0x7d, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x3b, 0xff, 0xe5, 0xf4, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xbc, 0x4e, 0xff, 0xbd, 0xb6, 0xff, 0xee, 0xfb, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xda, 0xff, 0xde, 0x78, 0xff, 0xde, 0x58, 0xff, 0xde, 0x58, 0xff, 0xde, 0x37, 0xff, 0xef, 0x30, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xaf, 0xff, 0xf7, 0x50, 0xff, 0xee, 0xf9, 0xff, 0xf7, 0x3b, 0xff, 0xde, 0x78, 0xff, 0xb5, 0x54, 0xff, 0xc4, 0x0b, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xdd, 0xaf, 0xff, 0xde, 0x78, 0xff, 0xde, 0x58, 0xff, 0xe6, 0xda, 0xff, 0xee, 0xfb, 0xff, 0xef, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xff, 0x7c, 0xff, 0xff, 0x7c, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x1b, 0xff, 0xf5, 0x4f, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xdc, 0x09, 0xff, 0xb5, 0x54, 0xff, 0xe6, 0xda, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xda, 0xff, 0xde, 0x78, 0xff, 0xd6, 0x37, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xde, 0x58, 0xff, 0xd6, 0x36, 0xff, 0xef, 0x2f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x50, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x3b, 0xff, 0xde, 0x58, 0xff, 0xac, 0xf3, 0xff, 0xe3, 0xc5, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xec, 0xee, 0xff, 0xd6, 0x37, 0xff, 0xe6, 0xda, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xfb, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xda, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x1a, 0xff, 0xee, 0xd9, 0xff, 0xfc, 0x25, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xb4, 0xb1, 0xff, 0xde, 0x78, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x1a, 0xff, 0xf7, 0x1a, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xba, 0xff, 0xde, 0x58, 0xff, 0xde, 0x58, 0xff, 0xde, 0x78, 0xff, 0xde, 0x99, 0xff, 0xee, 0xfa, 0xff, 0xe6, 0xda, 0xff, 0xd6, 0x57, 0xff, 0xd6, 0x16, 0xff, 0xef, 0x2f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x50, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x1a, 0xff, 0xc5, 0x93, 0xff, 0xbc, 0x88, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xf4, 0x05, 0xff, 0xde, 0x78, 0xff, 0xe6, 0xfa, 0xff, 0xee, 0xfa, 0xff, 0xe6, 0xfa, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xd9, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x1a, 0xff, 0xf7, 0x1a, 0xff, 0xe6, 0x36, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xe4, 0x08, 0xff, 0xbd, 0x95, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x1a, 0xff, 0xf7, 0x1a, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x57, 0xff, 0xd6, 0x58, 0xff, 0xde, 0x78, 0xff, 0xde, 0x78, 0xff, 0xe6, 0xfa, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xd6, 0x37, 0xff, 0xd6, 0x16, 0xff, 0xef, 0x30, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x50, 0xff, 0xe6, 0x75, 0xff, 0xef, 0x2f, 0xff, 0xbd, 0xcc, 0xff, 0xec, 0x03, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xcd, 0xb4, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x1a, 0xff, 0xf6, 0xfa, 0xff, 0xee, 0xfa, 0xff, 0xed, 0xf4, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xc4, 0x6e, 0xff, 0xde, 0x78, 0xff, 0xef, 0x1b, 0xff, 0xf6, 0xfa, 0xff, 0xf7, 0x1a, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x16, 0xff, 0xd6, 0x37, 0xff, 0xde, 0x99, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xd6, 0x37, 0xff, 0xd6, 0x16, 0xff, 0xef, 0x30, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xaf, 0xff, 0xde, 0xad, 0xff, 0xcc, 0x27, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xdd, 0x51, 0xff, 0xd6, 0x37, 0xff, 0xe6, 0xb9, 0xff, 0xd6, 0x37, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xee, 0xd9, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x3b, 0xff, 0xed, 0x72, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xfb, 0xe0, 0xff, 0xb4, 0xf1, 0xff, 0xde, 0x78, 0xff, 0xf6, 0xfa, 0xff, 0xf6, 0xfa, 0xff, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xb9, 0xff, 0xe6, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xd6, 0x16, 0xff, 0xd6, 0x37, 0xff, 0xde, 0x99, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xda, 0xff, 0xd6, 0x17, 0xff, 0xd6, 0x16, 0xff, 0xf7, 0x2f, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x6f, 0xff, 0xff, 0xd0, 0xff, 0xde, 0x50, 0xff, 0xb4, 0x4c, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xdc, 0xcf, 0xff, 0xd6, 0x37, 0xff, 0xd6, 0x37, 0xff, 0xde, 0x57, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xb8, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x5b, 0xff, 0xef, 0x1b, 0xff, 0xec, 0xef, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xe0, 0xff, 0xf3, 0xc2, 0xff, 0xbd, 0x74, 0xff, 0xee, 0xd9, 0xff, 0xf6, 0xd9, 0xff, 0xee, 0xda, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x37, 0xff, 0xd5, 0xf6, 0xff, 0xe6, 0xfa, 0xff, 0xff, 0xbe, 0xff, 0xd6, 0x16, 0xff, 0xd6, 0x17, 0xff, 0xde, 0x79, 0xff, 0xe6, 0xda, 0xff, 0xe6, 0xba, 0xff, 0xe6, 0xba, 0xff, 0xe6, 0xba, 0xff, 0xe6, 0xd9, 0xff, 0xde, 0x78, 0xff, 0xd6, 0x16, 0xff, 0xd5, 0xf3, 0xff, 0xff, 0x8f, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf0, 0xff, 0xef, 0x0f, 0xff, 0xc5, 0xcc, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xe4, 0x6d, 0xff, 0xd5, 0xf6, 0xff, 0xde, 0x37, 0xff, 0xde, 0x57, 0xff, 0xe6, 0xfb, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xde, 0xdb, 0x70, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xe6, 0x99, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x1b, 0xff, 0xe6, 0xd9, 0xff, 0xec, 0x8c, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xec, 0x27, 0xff, 0xbd, 0x95, 0xff, 0xe6, 0x77, 0xff, 0xe6, 0xb9, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0xde, 0x79, 0xff, 0xd5, 0xf6, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xd5, 0xff, 0xe6, 0xba, 0xff, 0xf7, 0x9e, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xf6, 0xff, 0xd6, 0x58, 0xff, 0xde, 0x99, 0xff, 0xde, 0x99, 0xff, 0xde, 0x99, 0xff, 0xd6, 0x37, 0xff, 0xd5, 0xf6, 0xff, 0xcd, 0xd3, 0xff, 0xf7, 0x6f, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xaf, 0xff, 0xf7, 0x4f, 0xff, 0xff, 0xaf, 0xff, 0xf7, 0x8f, 0xff, 0xce, 0x4c, 0xff, 0xf3, 0xe1, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xe4, 0x2a, 0xff, 0xcd, 0xd5, 0xff, 0xd6, 0x16, 0xff, 0xd6, 0x16, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xe4, 0x00, 0x00, 0x0b, 
-  0xd6, 0xba, 0x70, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0x98, 0xff, 0xee, 0xda, 0xff, 0xee, 0xda, 0xff, 0xde, 0x78, 0xff, 0xec, 0x4a, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xe4, 0x07, 0xff, 0xd6, 0x9a, 0xff, 0xe6, 0xda, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xde, 0x58, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xd5, 0xff, 0xde, 0x58, 0xff, 0xd6, 0x37, 0xff, 0xcd, 0xb5, 0xff, 0xc5, 0xb4, 0xff, 0xde, 0x99, 0xff, 0xef, 0x5d, 0xff, 0xc5, 0x94, 0xff, 0xcd, 0xb5, 0xff, 0xd6, 0x37, 0xff, 0xde, 0x58, 0xff, 0xce, 0x17, 0xff, 0xcd, 0xb5, 0xff, 0xc5, 0x92, 0xff, 0xef, 0x2e, 0xff, 0xf7, 0x8e, 0xff, 0xf7, 0x8f, 0xff, 0xde, 0x50, 0xff, 0xd5, 0xf1, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x6f, 0xff, 0xd6, 0x4d, 0xff, 0xf4, 0x02, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xe4, 0x08, 0xff, 0xc5, 0x94, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xd5, 0xff, 0xde, 0xba, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xe4, 0x00, 0x00, 0x0b, 
-  0xd6, 0x9a, 0x70, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xd6, 0x58, 0xff, 0xe6, 0xb9, 0xff, 0xe6, 0xb9, 0xff, 0xce, 0x17, 0xff, 0xe4, 0x09, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xeb, 0xe6, 0xff, 0xc5, 0xd7, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0x37, 0xff, 0xcd, 0x94, 0xff, 0xc5, 0xb5, 0xff, 0xd6, 0x37, 0xff, 0xd6, 0x37, 0xff, 0xd6, 0x37, 0xff, 0xce, 0x16, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0xd6, 0xff, 0xc5, 0x74, 0xff, 0xc5, 0xb5, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0xb5, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x71, 0xff, 0xe7, 0x0d, 0xff, 0xef, 0x4e, 0xff, 0xef, 0x4e, 0xff, 0xd6, 0x30, 0xff, 0xcd, 0xd1, 0xff, 0xef, 0x2e, 0xff, 0xef, 0x4e, 0xff, 0xef, 0x2e, 0xff, 0xce, 0x4c, 0xff, 0xf3, 0xe2, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xe3, 0xe9, 0xff, 0xbd, 0x53, 0xff, 0xc5, 0x73, 0xff, 0xc5, 0xb5, 0xff, 0xd6, 0x79, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xfb, 0xe4, 0x00, 0x00, 0x0b, 
-  0xce, 0x59, 0x70, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xcd, 0xd6, 0xff, 0xde, 0x58, 0xff, 0xd6, 0x37, 0xff, 0xc5, 0xb4, 0xff, 0xe4, 0x0a, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xc0, 0xff, 0xf3, 0xe4, 0xff, 0xd6, 0x59, 0xff, 0xef, 0x1c, 0xff, 0xcd, 0xf6, 0xff, 0xc5, 0x73, 0xff, 0xc5, 0x74, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xf6, 0xff, 0xcd, 0xd6, 0xff, 0xbd, 0x74, 0xff, 0xc5, 0x74, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x74, 0xff, 0xc5, 0x74, 0xff, 0xbd, 0x31, 0xff, 0xe6, 0xcd, 0xff, 0xef, 0x2d, 0xff, 0xef, 0x2d, 0xff, 0xd6, 0x0f, 0xff, 0xcd, 0x91, 0xff, 0xe6, 0xee, 0xff, 0xef, 0x0e, 0xff, 0xef, 0x0e, 0xff, 0xcd, 0xd0, 0xff, 0xbd, 0x6c, 0xff, 0xfb, 0xe1, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xdb, 0xc9, 0xff, 0xbd, 0x54, 0xff, 0xd6, 0x79, 0xff, 0xbd, 0x33, 0xff, 0xce, 0x58, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xe4, 0x00, 0x00, 0x0b, 
-  0xc6, 0x38, 0x70, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xb5, 0xff, 0xcd, 0xd5, 0xff, 0xc5, 0x94, 0xff, 0xd4, 0x0c, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc1, 0xff, 0xce, 0x17, 0xff, 0xcd, 0xb5, 0xff, 0xbd, 0x32, 0xff, 0xbd, 0x33, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xd5, 0xff, 0xc5, 0xb5, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xd6, 0xff, 0xc5, 0xd6, 0xff, 0xc5, 0xb5, 0xff, 0xb5, 0x33, 0xff, 0xbd, 0x53, 0xff, 0xbd, 0x53, 0xff, 0xbd, 0x53, 0xff, 0xb5, 0x10, 0xff, 0xde, 0xad, 0xff, 0xe6, 0xed, 0xff, 0xe6, 0xed, 0xff, 0xcd, 0xcf, 0xff, 0xc5, 0x70, 0xff, 0xde, 0xcd, 0xff, 0xe6, 0xed, 0xff, 0xe6, 0xcd, 0xff, 0xcd, 0xaf, 0xff, 0xd5, 0xd5, 0xff, 0xbc, 0xd0, 0xff, 0xfb, 0xc0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xd4, 0x2d, 0xff, 0xd6, 0x9a, 0xff, 0xbd, 0x74, 0xff, 0xbd, 0x53, 0xff, 0xce, 0x17, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xe4, 0x00, 0x00, 0x0b, 
-  0xc5, 0xf8, 0x70, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xbd, 0x74, 0xff, 0xcd, 0xb4, 0xff, 0xcd, 0xb4, 0xff, 0xbd, 0x53, 0xff, 0xc4, 0x2d, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xc4, 0x8e, 0xff, 0xbc, 0xf1, 0xff, 0xb4, 0xf2, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x95, 0xff, 0xbd, 0x53, 0xff, 0xb4, 0xf2, 0xff, 0xbd, 0x54, 0xff, 0xc5, 0x95, 0xff, 0xc5, 0x95, 0xff, 0xc5, 0x95, 0xff, 0xbd, 0x74, 0xff, 0xb4, 0xf2, 0xff, 0xb5, 0x12, 0xff, 0xb4, 0xef, 0xff, 0xd6, 0x6c, 0xff, 0xde, 0xad, 0xff, 0xde, 0xad, 0xff, 0xc5, 0x8e, 0xff, 0xbd, 0x2f, 0xff, 0xde, 0x8d, 0xff, 0xde, 0xad, 0xff, 0xde, 0xad, 0xff, 0xc5, 0x6f, 0xff, 0xcd, 0x94, 0xff, 0xcd, 0x94, 0xff, 0xd4, 0xae, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xcc, 0xd1, 0xff, 0xad, 0x13, 0xff, 0xb5, 0x12, 0xff, 0xb5, 0x12, 0xff, 0xc5, 0xf7, 0xff, 0xce, 0x79, 0xff, 0xce, 0x79, 0xff, 0xce, 0x59, 0xe4, 0x00, 0x00, 0x0b, 
-  0xbd, 0xd7, 0x70, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc5, 0xd6, 0xff, 0xbd, 0x53, 0xff, 0xc5, 0x74, 0xff, 0xbd, 0x33, 0xff, 0xac, 0x6f, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xdc, 0x09, 0xff, 0xac, 0xb0, 0xff, 0xb4, 0xd1, 0xff, 0xbd, 0x33, 0xff, 0xbd, 0x54, 0xff, 0xbd, 0x54, 0xff, 0xb5, 0x12, 0xff, 0xb4, 0xd1, 0xff, 0xb4, 0xd1, 0xff, 0xb5, 0x33, 0xff, 0xbd, 0x74, 0xff, 0xbd, 0x74, 0xff, 0xb5, 0x13, 0xff, 0xac, 0xd1, 0xff, 0xac, 0xaf, 0xff, 0xce, 0x4c, 0xff, 0xd6, 0x8c, 0xff, 0xd6, 0x8c, 0xff, 0xbd, 0x6e, 0xff, 0xb5, 0x0f, 0xff, 0xd6, 0x4c, 0xff, 0xd6, 0x6c, 0xff, 0xd6, 0x6c, 0xff, 0xbd, 0x4e, 0xff, 0xc5, 0x73, 0xff, 0xc5, 0x73, 0xff, 0xa4, 0xce, 0xff, 0xe4, 0x49, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0x9b, 0xcc, 0xff, 0xac, 0xb1, 0xff, 0xb4, 0xf1, 0xff, 0xac, 0xf1, 0xff, 0xbd, 0xb6, 0xff, 0xce, 0x39, 0xff, 0xce, 0x39, 0xff, 0xc6, 0x38, 0xe4, 0x00, 0x00, 0x0b, 
-  0xb5, 0x96, 0x70, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf7, 0xff, 0xce, 0x38, 0xff, 0xb5, 0x33, 0xff, 0xbd, 0x32, 0xff, 0x9c, 0x4f, 0xff, 0xf3, 0x61, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xc3, 0xff, 0xac, 0x90, 0xff, 0xac, 0x90, 0xff, 0xac, 0x90, 0xff, 0xb4, 0xf2, 0xff, 0xbd, 0x33, 0xff, 0xbd, 0x33, 0xff, 0xac, 0xb1, 0xff, 0xac, 0xb0, 0xff, 0xac, 0xb0, 0xff, 0xb4, 0xf2, 0xff, 0xac, 0xf2, 0xff, 0xac, 0xb0, 0xff, 0xa4, 0x8e, 0xff, 0xce, 0x0c, 0xff, 0xd6, 0x4c, 0xff, 0xd6, 0x4c, 0xff, 0xbd, 0x4d, 0xff, 0xb4, 0xce, 0xff, 0xce, 0x2c, 0xff, 0xd6, 0x4c, 0xff, 0xd6, 0x4c, 0xff, 0xbd, 0x0e, 0xff, 0xc5, 0x32, 0xff, 0xc5, 0x32, 0xff, 0xa4, 0xce, 0xff, 0x9c, 0x8a, 0xff, 0xfc, 0x03, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xf3, 0x62, 0xff, 0x8b, 0xee, 0xff, 0xac, 0xb0, 0xff, 0xac, 0xb1, 0xff, 0xac, 0xb1, 0xff, 0xb5, 0x95, 0xff, 0xc6, 0x18, 0xff, 0xc6, 0x18, 0xff, 0xc5, 0xf8, 0xe4, 0x00, 0x00, 0x0b, 
-  0xad, 0x75, 0x70, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0x96, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xb6, 0xff, 0xb4, 0xf2, 0xff, 0xa4, 0x70, 0xff, 0xd3, 0x67, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0xa0, 0xff, 0xd4, 0x6c, 0xff, 0xac, 0xb1, 0xff, 0xac, 0x6f, 0xff, 0xa4, 0x6f, 0xff, 0xac, 0xd1, 0xff, 0xac, 0xb1, 0xff, 0xa4, 0x6f, 0xff, 0xac, 0x70, 0xff, 0xac, 0x70, 0xff, 0xa4, 0x70, 0xff, 0xa4, 0x70, 0xff, 0xa4, 0x4d, 0xff, 0xc5, 0xcb, 0xff, 0xce, 0x0b, 0xff, 0xce, 0x0b, 0xff, 0xb5, 0x0d, 0xff, 0xac, 0xad, 0xff, 0xcd, 0xeb, 0xff, 0xce, 0x0b, 0xff, 0xce, 0x0b, 0xff, 0xb4, 0xed, 0xff, 0xbc, 0xf1, 0xff, 0xbd, 0x11, 0xff, 0x9c, 0x8d, 0xff, 0x8c, 0x8a, 0xff, 0xd4, 0x88, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xd3, 0x46, 0xff, 0x94, 0x0e, 0xff, 0xa4, 0x70, 0xff, 0xa4, 0x90, 0xff, 0xa4, 0x90, 0xff, 0xb5, 0x55, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xe4, 0x00, 0x00, 0x0b, 
-  0xad, 0x35, 0x70, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xa4, 0xb1, 0xff, 0xb5, 0x95, 0xff, 0xb5, 0x75, 0xff, 0xbd, 0x96, 0xff, 0x9c, 0x70, 0xff, 0xab, 0x8a, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xfc, 0x03, 0xff, 0xb4, 0x8f, 0xff, 0xac, 0x90, 0xff, 0xa4, 0x2f, 0xff, 0xa4, 0x2f, 0xff, 0xa4, 0x4f, 0xff, 0xa4, 0x4f, 0xff, 0xa4, 0x4f, 0xff, 0xa4, 0x4f, 0xff, 0xa4, 0x4f, 0xff, 0x9c, 0x2d, 0xff, 0xbd, 0xab, 0xff, 0xc5, 0xeb, 0xff, 0xc5, 0xeb, 0xff, 0xac, 0xec, 0xff, 0xac, 0x8d, 0xff, 0xc5, 0xab, 0xff, 0xc5, 0xab, 0xff, 0xc5, 0xcb, 0xff, 0xac, 0xac, 0xff, 0xb4, 0xd1, 0xff, 0xb4, 0xd1, 0xff, 0x9c, 0x6d, 0xff, 0x8c, 0x6a, 0xff, 0xa4, 0x69, 0xff, 0xfc, 0x25, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xab, 0xa6, 0xff, 0x93, 0xed, 0xff, 0x9c, 0x4f, 0xff, 0x9c, 0x50, 0xff, 0x9c, 0x6f, 0xff, 0xad, 0x34, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0xb6, 0xff, 0xb5, 0x96, 0xe4, 0x00, 0x00, 0x0b, 
-  0xa5, 0x14, 0x70, 0xb5, 0x76, 0xff, 0xb5, 0x76, 0xff, 0xb5, 0x76, 0xff, 0xa4, 0xb1, 0xff, 0xa4, 0xb0, 0xff, 0xb5, 0x55, 0xff, 0xb5, 0x75, 0xff, 0xb5, 0x55, 0xff, 0x83, 0xad, 0xff, 0xf3, 0x41, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xa0, 0xff, 0xec, 0x48, 0xff, 0xac, 0x90, 0xff, 0xa4, 0x70, 0xff, 0x9c, 0x0e, 0xff, 0xa4, 0x2e, 0xff, 0xa4, 0x2e, 0xff, 0x9c, 0x2e, 0xff, 0x9c, 0x2e, 0xff, 0x9c, 0x0c, 0xff, 0xbd, 0x6b, 0xff, 0xbd, 0xab, 0xff, 0xbd, 0xab, 0xff, 0xac, 0xac, 0xff, 0xa4, 0x4c, 0xff, 0xbd, 0x8b, 0xff, 0xb5, 0x4a, 0xff, 0xbd, 0x6a, 0xff, 0xac, 0x8c, 0xff, 0xac, 0xb0, 0xff, 0xb4, 0xb0, 0xff, 0x94, 0x4c, 0xff, 0x84, 0x49, 0xff, 0x8c, 0x49, 0xff, 0xf4, 0xa8, 0xff, 0xfb, 0xa0, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xf3, 0x61, 0xff, 0x9c, 0x88, 0xff, 0xac, 0xea, 0xff, 0x94, 0x0e, 0xff, 0x9c, 0x2f, 0xff, 0x9c, 0x4f, 0xff, 0xa5, 0x13, 0xff, 0xb5, 0x76, 0xff, 0xb5, 0x76, 0xff, 0xad, 0x75, 0xe4, 0x00, 0x00, 0x0b, 
-  0xd6, 0x9a, 0x70, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xce, 0x15, 0xff, 0xde, 0x78, 0xff, 0xde, 0x57, 0xff, 0xe6, 0xfb, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0x79, 0xff, 0xd4, 0x6e, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xc2, 0xff, 0xec, 0xec, 0xff, 0xde, 0x57, 0xff, 0xd6, 0x37, 0xff, 0xcd, 0xd5, 0xff, 0xd5, 0xf6, 0xff, 0xd5, 0xf6, 0xff, 0xcd, 0xd3, 0xff, 0xef, 0x32, 0xff, 0xf7, 0x72, 0xff, 0xf7, 0x72, 0xff, 0xde, 0x73, 0xff, 0xd6, 0x34, 0xff, 0xef, 0x52, 0xff, 0xe7, 0x11, 0xff, 0xef, 0x52, 0xff, 0xde, 0x54, 0xff, 0xe6, 0x77, 0xff, 0xe6, 0x77, 0xff, 0xc6, 0x13, 0xff, 0xbe, 0x11, 0xff, 0xbd, 0xf0, 0xff, 0xed, 0x0a, 0xff, 0xfb, 0xc3, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xcc, 0x49, 0xff, 0xd6, 0x90, 0xff, 0xef, 0x52, 0xff, 0xe6, 0xf2, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xf6, 0xff, 0xde, 0x9a, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xce, 0x95, 0xff, 0xd6, 0x96, 0xff, 0xf6, 0xfa, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc5, 0xd7, 0xff, 0xfb, 0x63, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xe3, 0xff, 0xfd, 0x6f, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x78, 0xff, 0xe6, 0x78, 0xff, 0xde, 0x55, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xee, 0xf5, 0xff, 0xe6, 0x96, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xee, 0xd5, 0xff, 0xf6, 0xfa, 0xff, 0xf6, 0xfa, 0xff, 0xd6, 0x95, 0xff, 0xce, 0x93, 0xff, 0xce, 0x72, 0xff, 0xf5, 0x8c, 0xff, 0xfc, 0x04, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xf3, 0x62, 0xff, 0xb5, 0x12, 0xff, 0xef, 0x13, 0xff, 0xff, 0xd3, 0xff, 0xf7, 0x93, 0xff, 0xf7, 0x73, 0xff, 0xde, 0x57, 0xff, 0xef, 0x3c, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xce, 0x95, 0xff, 0xc6, 0xb3, 0xff, 0xd6, 0x95, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x7d, 0xff, 0xde, 0xdb, 0xff, 0xd4, 0x8f, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfc, 0x04, 0xff, 0xfd, 0x2c, 0xff, 0xe6, 0x15, 0xff, 0xde, 0x55, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xee, 0xf5, 0xff, 0xe6, 0x96, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xee, 0xd5, 0xff, 0xf6, 0xf9, 0xff, 0xf6, 0xfa, 0xff, 0xd6, 0x95, 0xff, 0xce, 0x93, 0xff, 0xde, 0x51, 0xff, 0xfd, 0x6c, 0xff, 0xfc, 0x05, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xc4, 0x0d, 0xff, 0xcd, 0xf6, 0xff, 0xe6, 0xb8, 0xff, 0xf7, 0x73, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xb3, 0xff, 0xf7, 0x73, 0xff, 0xef, 0x1b, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xce, 0x95, 0xff, 0xc6, 0xb2, 0xff, 0xc6, 0xb2, 0xff, 0xd6, 0x95, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xd9, 0xff, 0xe7, 0x1c, 0xff, 0xc5, 0xf8, 0xff, 0xeb, 0xa8, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0xc3, 0xff, 0xfc, 0xc8, 0xff, 0xfe, 0x2e, 0xff, 0xff, 0x32, 0xff, 0xff, 0xf4, 0xff, 0xee, 0xf4, 0xff, 0xe6, 0x95, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xff, 0xee, 0xd5, 0xff, 0xf6, 0xf9, 0xff, 0xf6, 0xf9, 0xff, 0xd6, 0x95, 0xff, 0xd6, 0x51, 0xff, 0xf5, 0xef, 0xff, 0xfd, 0x0a, 0xff, 0xfb, 0xc3, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xe3, 0x64, 0xff, 0x94, 0xee, 0xff, 0xde, 0x77, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xb8, 0xff, 0xf7, 0x73, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xf3, 0xff, 0xef, 0x3b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xce, 0x94, 0xff, 0xbe, 0x92, 0xff, 0xbe, 0x92, 0xff, 0xbe, 0x92, 0xff, 0xd6, 0x95, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xb9, 0xff, 0xd6, 0x79, 0xff, 0xbd, 0x34, 0xff, 0xfb, 0x41, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x80, 0xff, 0xfc, 0x46, 0xff, 0xfd, 0x2b, 0xff, 0xfd, 0xee, 0xff, 0xf6, 0x12, 0xff, 0xff, 0x52, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xd3, 0xff, 0xee, 0xb4, 0xff, 0xf6, 0xd8, 0xff, 0xf6, 0xb7, 0xff, 0xf6, 0x53, 0xff, 0xfe, 0x0f, 0xff, 0xfd, 0x6c, 0xff, 0xfc, 0x47, 0xff, 0xfb, 0x80, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xf3, 0x41, 0xff, 0x9c, 0x4b, 0xff, 0xad, 0xd0, 0xff, 0xc6, 0x72, 0xff, 0xe6, 0xd8, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xb8, 0xff, 0xf7, 0x73, 0xff, 0xff, 0xf2, 0xff, 0xef, 0x3b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xce, 0x94, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x92, 0xff, 0xbe, 0x92, 0xff, 0xbe, 0x92, 0xff, 0xce, 0x75, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x98, 0xff, 0xc5, 0xf7, 0xff, 0xc4, 0x90, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x80, 0xff, 0xfc, 0x04, 0xff, 0xfc, 0xea, 0xff, 0xfd, 0x6c, 0xff, 0xfd, 0xef, 0xff, 0xfe, 0x51, 0xff, 0xfe, 0x51, 0xff, 0xfd, 0xef, 0xff, 0xfd, 0x8d, 0xff, 0xfc, 0xea, 0xff, 0xfc, 0x04, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xab, 0xe9, 0xff, 0x9d, 0x4e, 0xff, 0xbe, 0x51, 0xff, 0xbe, 0x92, 0xff, 0xc6, 0x72, 0xff, 0xe6, 0xb8, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xb8, 0xff, 0xf7, 0x72, 0xff, 0xef, 0x3b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xc6, 0x94, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xce, 0x75, 0xff, 0xee, 0xd9, 0xff, 0xde, 0x57, 0xff, 0xbd, 0x96, 0xff, 0xcc, 0x2d, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xbb, 0xa7, 0xff, 0x94, 0xed, 0xff, 0xb6, 0x10, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x72, 0xff, 0xe6, 0xb8, 0xff, 0xee, 0xf9, 0xff, 0xe6, 0xb8, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xc6, 0x74, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xce, 0x74, 0xff, 0xee, 0xd9, 0xff, 0xd6, 0x16, 0xff, 0xb5, 0x55, 0xff, 0xd4, 0x0c, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x20, 0xff, 0xbb, 0x86, 0xff, 0x8c, 0xac, 0xff, 0xad, 0xef, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x91, 0xff, 0xbe, 0x72, 0xff, 0xe6, 0xb8, 0xff, 0xee, 0xd9, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xc6, 0x74, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xce, 0x74, 0xff, 0xee, 0xb9, 0xff, 0xd5, 0xf6, 0xff, 0xad, 0x55, 0xff, 0xcc, 0x0d, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x60, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x20, 0xff, 0xb3, 0x87, 0xff, 0x84, 0xac, 0xff, 0xad, 0xcf, 0xff, 0xb6, 0x50, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xbe, 0x71, 0xff, 0xe6, 0xb8, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xc6, 0x74, 0xff, 0xbe, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xbe, 0x71, 0xff, 0xb6, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xce, 0x54, 0xff, 0xee, 0xb9, 0xff, 0xd5, 0xf6, 0xff, 0xb5, 0x55, 0xff, 0xbc, 0x70, 0xff, 0xf3, 0x22, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xeb, 0x01, 0xff, 0x9b, 0xa8, 0xff, 0x8c, 0xac, 0xff, 0xa5, 0xcf, 0xff, 0xb6, 0x50, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xbe, 0x71, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe7, 0x1c, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xc6, 0x74, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xce, 0x54, 0xff, 0xee, 0xb9, 0xff, 0xd6, 0x16, 0xff, 0xad, 0x32, 0xff, 0xac, 0xaa, 0xff, 0xdb, 0x85, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x20, 0xff, 0xd3, 0x24, 0xff, 0x83, 0xe9, 0xff, 0x8c, 0xcc, 0xff, 0xad, 0xcf, 0xff, 0xb6, 0x50, 0xff, 0xbe, 0x70, 0xff, 0xbe, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe6, 0xfc, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xc6, 0x73, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xde, 0x96, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x75, 0xff, 0xef, 0x50, 0xff, 0xd6, 0x6e, 0xff, 0xad, 0x4b, 0xff, 0xab, 0xa9, 0xff, 0xe3, 0x03, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x20, 0xff, 0xdb, 0x03, 0xff, 0x9b, 0x88, 0xff, 0x7c, 0x4b, 0xff, 0x95, 0x2d, 0xff, 0xad, 0xef, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe6, 0xfc, 0x70, 0xf7, 0xbe, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x73, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xde, 0x76, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x75, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xb0, 0xff, 0xcd, 0xf0, 0xff, 0xac, 0xce, 0xff, 0xa5, 0x0a, 0xff, 0xb4, 0x28, 0xff, 0xdb, 0x64, 0xff, 0xf3, 0x00, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x40, 0xff, 0xfb, 0x20, 0xff, 0xf3, 0x00, 0xff, 0xd3, 0x26, 0xff, 0xa3, 0x8b, 0xff, 0x74, 0x0a, 0xff, 0x8c, 0xcc, 0xff, 0xa5, 0xae, 0xff, 0xb6, 0x2f, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x51, 0xff, 0xe7, 0x1b, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe6, 0xfc, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x73, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x50, 0xff, 0xde, 0x76, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x75, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0xd2, 0xff, 0xde, 0x53, 0xff, 0xf7, 0x6f, 0xff, 0xde, 0xee, 0xff, 0xc5, 0xec, 0xff, 0x8c, 0x0c, 0xff, 0x8b, 0x8c, 0xff, 0xab, 0x29, 0xff, 0xcb, 0x27, 0xff, 0xe3, 0x03, 0xff, 0xfb, 0x00, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x00, 0xff, 0xe2, 0xe2, 0xff, 0xcb, 0x48, 0xff, 0xb3, 0xed, 0xff, 0x9c, 0x50, 0xff, 0x94, 0x50, 0xff, 0xb5, 0x13, 0xff, 0xbd, 0xb3, 0xff, 0xae, 0x0f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x6f, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xae, 0x3a, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe6, 0xfc, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x53, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xde, 0x97, 0xff, 0xee, 0xfa, 0xff, 0xe6, 0x96, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0xd2, 0xff, 0xde, 0x74, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0xff, 0xd6, 0x11, 0xff, 0xc5, 0x94, 0xff, 0xac, 0xf2, 0xff, 0xa4, 0xd2, 0xff, 0x94, 0x71, 0xff, 0x8c, 0x0f, 0xff, 0x93, 0xad, 0xff, 0xf3, 0x01, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xf3, 0x01, 0xff, 0x83, 0x6c, 0xff, 0x83, 0xae, 0xff, 0x8c, 0x0f, 0xff, 0xb5, 0x75, 0xff, 0xd6, 0x7a, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0x78, 0xff, 0xee, 0xd9, 0xff, 0xde, 0x97, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x50, 0xff, 0xae, 0x3a, 0xff, 0xae, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe6, 0xfc, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x53, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xde, 0xb7, 0xff, 0xf7, 0x1b, 0xff, 0xe6, 0x96, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xef, 0xff, 0xee, 0xf3, 0xff, 0xe6, 0x94, 0xff, 0xff, 0xcf, 0xff, 0xef, 0x4e, 0xff, 0xf7, 0xaf, 0xff, 0xde, 0x72, 0xff, 0xde, 0x58, 0xff, 0xd6, 0x57, 0xff, 0xde, 0x99, 0xff, 0xde, 0x99, 0xff, 0xd6, 0x58, 0xff, 0xcd, 0xf7, 0xff, 0xad, 0x34, 0xff, 0xbb, 0x6a, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xbb, 0xac, 0xff, 0xad, 0x34, 0xff, 0xbd, 0x74, 0xff, 0xcd, 0xd6, 0xff, 0xd6, 0x17, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x1b, 0xff, 0xde, 0xb8, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x50, 0xff, 0xae, 0x1a, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe6, 0xfc, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x73, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xde, 0xd8, 0xff, 0xf7, 0x5c, 0xff, 0xe6, 0xd7, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xee, 0xf3, 0xff, 0xe6, 0x95, 0xff, 0xff, 0xcf, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xcf, 0xff, 0xde, 0x73, 0xff, 0xde, 0x99, 0xff, 0xde, 0x78, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x1b, 0xff, 0xee, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xda, 0xff, 0xce, 0x17, 0xff, 0xa4, 0xd2, 0xff, 0xe3, 0x25, 0xff, 0xfb, 0x20, 0xff, 0xfb, 0x20, 0xff, 0xe3, 0x26, 0xff, 0xad, 0x14, 0xff, 0xde, 0x99, 0xff, 0xde, 0xba, 0xff, 0xde, 0x79, 0xff, 0xde, 0x99, 0xff, 0xde, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x5c, 0xff, 0xde, 0xd8, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xae, 0x50, 0xff, 0xae, 0x1a, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 
-  0xe6, 0xfc, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x73, 0xff, 0xb6, 0x4f, 0xff, 0xae, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xe6, 0xf9, 0xff, 0xff, 0x7d, 0xff, 0xee, 0xf8, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xef, 0x13, 0xff, 0xe6, 0xb5, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xef, 0x36, 0xff, 0xde, 0x78, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x1c, 0xff, 0xe7, 0x1b, 0xff, 0xde, 0x99, 0xff, 0xde, 0xba, 0xff, 0xc5, 0xf7, 0xff, 0xa4, 0x0f, 0xff, 0xfb, 0x00, 0xff, 0xfb, 0x00, 0xff, 0xac, 0x70, 0xff, 0xd6, 0x58, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xba, 0xff, 0xde, 0x79, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfb, 0xff, 0xff, 0xbe, 0xff, 0xe7, 0x3c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xff, 0x7d, 0xff, 0xe6, 0xf9, 0xff, 0xb6, 0x4f, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x50, 0xff, 0xae, 0x1a, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x73, 0xff, 0xae, 0x4e, 0xff, 0xb6, 0x4f, 0xff, 0xe7, 0x3a, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x19, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xef, 0x14, 0xff, 0xe6, 0xd6, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0xb3, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x1c, 0xff, 0xde, 0xba, 0xff, 0xde, 0xba, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xd6, 0x79, 0xff, 0xbd, 0xb6, 0xff, 0xcb, 0xab, 0xff, 0xc3, 0xab, 0xff, 0xbd, 0xd7, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0xda, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0x99, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xda, 0xff, 0xde, 0xba, 0xff, 0xde, 0xba, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0x9e, 0xff, 0xef, 0x3c, 0xff, 0xff, 0xbe, 0xff, 0xe7, 0x1a, 0xff, 0xae, 0x2f, 0xff, 0xae, 0x4e, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x4e, 0xff, 0xae, 0x30, 0xff, 0xae, 0x1a, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x73, 0xff, 0xae, 0x4f, 0xff, 0xe7, 0x3b, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x39, 0xff, 0xff, 0xcf, 0xff, 0xf7, 0x6e, 0xff, 0xff, 0xef, 0xff, 0xef, 0x34, 0xff, 0xee, 0xf7, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0xb4, 0xff, 0xe7, 0x1b, 0xff, 0xde, 0x99, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xdb, 0xff, 0xad, 0x55, 0xff, 0xad, 0x55, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xda, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x5b, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x4e, 0xff, 0xae, 0x2f, 0xff, 0xae, 0x1a, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xae, 0x1c, 0xff, 0xad, 0xfb, 0xff, 0xa5, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x74, 0xff, 0xef, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5a, 0xff, 0xff, 0xaf, 0xff, 0xef, 0x4e, 0xff, 0xff, 0xef, 0xff, 0xef, 0x35, 0xff, 0xef, 0x17, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0xb4, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0xba, 0xff, 0xff, 0xdf, 0xff, 0xe6, 0xda, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe6, 0xfb, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe6, 0xdb, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9d, 0xff, 0xef, 0x5c, 0xff, 0xff, 0x9e, 0xff, 0xde, 0xd9, 0xff, 0xb6, 0x31, 0xff, 0xbe, 0x52, 0xff, 0xc6, 0x58, 0xff, 0xce, 0x7b, 0xff, 0xce, 0xbb, 0xff, 0xd6, 0xdb, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5a, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xee, 0xff, 0xff, 0xce, 0xff, 0xef, 0x34, 0xff, 0xef, 0x17, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0xb4, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0xba, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0xfb, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x58, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x5a, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xee, 0xff, 0xef, 0x34, 0xff, 0xee, 0xf7, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xde, 0xb4, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xde, 0xda, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xd8, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xef, 0xff, 0xef, 0x34, 0xff, 0xe6, 0xd7, 0xff, 0xf7, 0x8e, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x90, 0xff, 0xde, 0xb4, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5c, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xe7, 0x1c, 0xdb, 0xde, 0xfb, 0xcb, 0xde, 0xdb, 0xbb, 0xde, 0xbb, 0x97, 0x00, 0x00, 0x08, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x59, 0xff, 0xef, 0x58, 0xff, 0xef, 0x59, 0xff, 0xef, 0x3a, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xfc, 0xef, 0x5d, 0xf0, 0xe7, 0x3c, 0xe3, 0xe6, 0xfc, 0xd3, 0xde, 0xdb, 0xc3, 0xde, 0xdb, 0xb3, 0xde, 0xdb, 0xa3, 0xd6, 0x9a, 0x90, 0xc6, 0x38, 0x7f, 0xb5, 0x96, 0x6c, 0x9c, 0xd3, 0x58, 0x7b, 0xaf, 0x44, 0x39, 0xa7, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xe7, 0x1c, 0xdb, 0xde, 0xfb, 0xcb, 0xde, 0xdb, 0xbb, 0xde, 0xdb, 0xab, 0xde, 0xdb, 0x98, 0xce, 0x79, 0x88, 0xbd, 0xd7, 0x77, 0xad, 0x35, 0x63, 0x8c, 0x51, 0x4f, 0x5a, 0xcb, 0x3c, 0x10, 0x62, 0x2b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xfc, 0xef, 0x5d, 0xf0, 0xe7, 0x3c, 0xe3, 0xe6, 0xfc, 0xd3, 0xde, 0xdb, 0xc3, 0xde, 0xdb, 0xb3, 0xde, 0xdb, 0xa3, 0xd6, 0x9a, 0x90, 0xc6, 0x38, 0x7f, 0xb5, 0x96, 0x6c, 0x9c, 0xd3, 0x58, 0x7b, 0xaf, 0x44, 0x39, 0xa7, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xde, 0xfb, 0x70, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xe7, 0x1c, 0xdb, 0xde, 0xfb, 0xcb, 0xde, 0xdb, 0xbb, 0xde, 0xdb, 0xab, 0xde, 0xdb, 0x98, 0xce, 0x79, 0x88, 0xbd, 0xd7, 0x77, 0xad, 0x35, 0x63, 0x8c, 0x51, 0x4f, 0x5a, 0xeb, 0x3c, 0x10, 0x62, 0x2b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xce, 0x59, 0x43, 0xd6, 0xba, 0x8f, 0xc6, 0x38, 0x7f, 0xb5, 0x96, 0x6c, 0x9c, 0xd3, 0x58, 0x7b, 0xaf, 0x44, 0x39, 0xa7, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x81, 0xac, 0x6c, 0x0c, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xb4, 0x00, 0x00, 0x00, 0x06, 0x00, 
+  0x00, 0x03, 0xe5, 0x0a, 0x27, 0xfd, 0xac, 0x68, 0xfd, 0xcd, 0x9f, 0xfe, 0x0e, 0xcb, 0xfe, 0x50, 0xe8, 0xfe, 0x91, 0xfc, 0x81, 0xfe, 0xb2, 0xff, 0x06, 0xfe, 0x91, 0xfc, 0xfe, 0x70, 0xe8, 0xfe, 
+  0x50, 0xc8, 0xfe, 0x0f, 0x9f, 0xfd, 0xee, 0x67, 0xe5, 0x6c, 0x24, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x00, 0x07, 0xe4, 0x87, 0x1b, 0xfd, 0x28, 0x7b, 0xfd, 0x6a, 0xd4, 0xfd, 0x8a, 0xff, 0xfd, 
+  0x49, 0xff, 0xfc, 0xe8, 0xff, 0xfc, 0xa6, 0xff, 0xfc, 0x63, 0xff, 0x83, 0xfc, 0x21, 0xff, 0x07, 0xfc, 0x63, 0xff, 0xfc, 0xa6, 0xff, 0xfd, 0x09, 0xff, 0xfd, 0x6b, 0xff, 0xfd, 0xcc, 0xff, 0xfd, 
+  0xcc, 0xd3, 0xfd, 0x8b, 0x78, 0xdc, 0xc9, 0x18, 0xa9, 0x00, 0x00, 0x00, 0x04, 0xe4, 0x25, 0x1f, 0xfc, 0xc6, 0x9b, 0xfd, 0x07, 0xf8, 0xfc, 0xc6, 0xff, 0xfc, 0x63, 0xff, 0x8d, 0xfc, 0x00, 0xff, 
+  0x04, 0xfc, 0x84, 0xff, 0xfd, 0x08, 0xff, 0xfd, 0x6a, 0xf7, 0xfd, 0x4a, 0x97, 0xe4, 0xc8, 0x1c, 0xa5, 0x00, 0x00, 0x00, 0x03, 0xaa, 0xe2, 0x08, 0xfc, 0x64, 0x7c, 0xfc, 0xa5, 0xf4, 0xfc, 0x64, 
+  0xff, 0x92, 0xfc, 0x00, 0xff, 0x04, 0xfc, 0x21, 0xff, 0xfc, 0xc6, 0xff, 0xfd, 0x28, 0xf4, 0xfd, 0x08, 0x78, 0x93, 0x04, 0x07, 0x92, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 
+  0x04, 0x08, 0x20, 0x04, 0x18, 0x40, 0x04, 0x20, 0x61, 0x04, 0x28, 0x81, 0x04, 0x30, 0x81, 0x04, 0x81, 0x38, 0xa1, 0x04, 0x02, 0xe3, 0xc2, 0x2b, 0xfc, 0x43, 0xcc, 0xfc, 0x42, 0xff, 0x96, 0xfc, 
+  0x00, 0xff, 0x0b, 0xfc, 0x21, 0xff, 0xfc, 0xc6, 0xff, 0xfd, 0x07, 0xcb, 0xe4, 0x66, 0x27, 0x38, 0xa1, 0x04, 0x30, 0xa1, 0x04, 0x30, 0x81, 0x04, 0x28, 0x61, 0x04, 0x20, 0x60, 0x04, 0x10, 0x40, 
+  0x04, 0x08, 0x20, 0x04, 0x00, 0x00, 0x04, 0x87, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0xf7, 0x9e, 0x68, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xff, 0x1a, 0xff, 0xfc, 0x85, 0xff, 0xfc, 0x21, 0xff, 
+  0x99, 0xfc, 0x00, 0xff, 0x02, 0xfc, 0x43, 0xff, 0xfd, 0x08, 0xff, 0xff, 0x3b, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xe3, 0x00, 0x00, 0x07, 0xe7, 0x3c, 0x70, 0x8d, 0xf7, 0x9e, 0xff, 
+  0x01, 0xfe, 0x97, 0xff, 0xfc, 0x42, 0xff, 0x9c, 0xfc, 0x00, 0xff, 0x02, 0xfc, 0x21, 0xff, 0xfc, 0xa5, 0xff, 0xfe, 0xb8, 0xff, 0x8c, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 
+  0xe7, 0x3c, 0x70, 0x8c, 0xf7, 0x9e, 0xff, 0x01, 0xf6, 0x97, 0xff, 0xfc, 0x42, 0xff, 0x9f, 0xfc, 0x00, 0xff, 0x01, 0xfc, 0x84, 0xff, 0xf6, 0xb8, 0xff, 0x8b, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 
+  0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x3c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x82, 0xef, 0x3c, 0xff, 0x00, 0xef, 0x1b, 0xff, 0x84, 0xef, 0x3c, 0xff, 0x01, 0xf6, 0xb8, 0xff, 0xfc, 0x43, 0xff, 0xa1, 0xfc, 
+  0x00, 0xff, 0x03, 0xfc, 0x84, 0xff, 0xf6, 0xb8, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x1a, 0xff, 0x82, 0xef, 0x59, 0xff, 0x03, 0xe7, 0x1b, 0xff, 0xef, 0x1a, 0xff, 0xef, 0x59, 0xff, 0xf7, 0x7d, 0xff, 
+  0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x3c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xef, 0x3b, 0xff, 0x81, 0xff, 0x9d, 0xff, 0x01, 0xff, 0x7c, 0xff, 0xf7, 0x5c, 
+  0xff, 0x82, 0xff, 0xbe, 0xff, 0x01, 0xff, 0x5b, 0xff, 0xfc, 0x86, 0xff, 0x8c, 0xfc, 0x00, 0xff, 0x03, 0xfb, 0xc0, 0xff, 0xeb, 0xa3, 0xff, 0xd3, 0x84, 0xff, 0xc3, 0xc6, 0xff, 0x81, 0xbb, 0xc6, 
+  0xff, 0x03, 0xc3, 0x68, 0xff, 0xd3, 0xa7, 0xff, 0xeb, 0xa2, 0xff, 0xfb, 0xc0, 0xff, 0x8c, 0xfc, 0x00, 0xff, 0x02, 0xfc, 0xa8, 0xff, 0xee, 0xb6, 0xff, 0xff, 0xaf, 0xff, 0x81, 0xff, 0xef, 0xff, 
+  0x04, 0xef, 0x13, 0xff, 0xe6, 0xb5, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xef, 0x3b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x3c, 0x70, 0x82, 0xf7, 
+  0x9e, 0xff, 0x00, 0xef, 0x1b, 0xff, 0x82, 0xff, 0x7d, 0xff, 0x04, 0xff, 0x7c, 0xff, 0xf7, 0x3c, 0xff, 0xff, 0xbe, 0xff, 0xff, 0x9d, 0xff, 0xfd, 0x6e, 0xff, 0x8b, 0xfc, 0x00, 0xff, 0x05, 0xf3, 
+  0xc1, 0xff, 0xc3, 0xca, 0xff, 0x9b, 0xed, 0xff, 0x94, 0x71, 0xff, 0x9c, 0x91, 0xff, 0xa4, 0xcb, 0xff, 0x81, 0xad, 0x4b, 0xff, 0x00, 0xa4, 0xeb, 0xff, 0x81, 0x94, 0x50, 0xff, 0x02, 0x9b, 0xcd, 
+  0xff, 0xcb, 0xc9, 0xff, 0xf3, 0xc1, 0xff, 0x8b, 0xfc, 0x00, 0xff, 0x00, 0xfd, 0x88, 0xff, 0x81, 0xff, 0xef, 0xff, 0x02, 0xee, 0xf3, 0xff, 0xe6, 0xb5, 0xff, 0xff, 0xcf, 0xff, 0x81, 0xff, 0xef, 
+  0xff, 0x00, 0xef, 0x3b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xef, 0x1b, 0xff, 0x81, 0xff, 0x7c, 0xff, 0x00, 
+  0xf7, 0x5c, 0xff, 0x81, 0xff, 0x5c, 0xff, 0x02, 0xf7, 0x3b, 0xff, 0xfe, 0x76, 0xff, 0xfc, 0x01, 0xff, 0x89, 0xfc, 0x00, 0xff, 0x11, 0xfb, 0xe0, 0xff, 0xcb, 0xca, 0xff, 0x9c, 0x70, 0xff, 0xad, 
+  0x13, 0xff, 0xc5, 0xd6, 0xff, 0xce, 0x17, 0xff, 0xe6, 0xba, 0xff, 0xe6, 0x98, 0xff, 0xe6, 0xaf, 0xff, 0xf7, 0x6f, 0xff, 0xef, 0x4f, 0xff, 0xde, 0xaf, 0xff, 0xcd, 0xd5, 0xff, 0xbd, 0x95, 0xff, 
+  0x9c, 0xb2, 0xff, 0x9c, 0x50, 0xff, 0xd3, 0xc9, 0xff, 0xfb, 0xe0, 0xff, 0x87, 0xfc, 0x00, 0xff, 0x81, 0xfb, 0xe0, 0xff, 0x04, 0xfc, 0x01, 0xff, 0xfe, 0xcc, 0xff, 0xee, 0xf3, 0xff, 0xe6, 0xb5, 
+  0xff, 0xff, 0xcf, 0xff, 0x81, 0xff, 0xef, 0xff, 0x01, 0xde, 0x72, 0xff, 0xe7, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 
+  0xff, 0x00, 0xef, 0x1b, 0xff, 0x81, 0xff, 0x7c, 0xff, 0x81, 0xee, 0xfa, 0xff, 0x03, 0xf7, 0x3b, 0xff, 0xf7, 0x1b, 0xff, 0xfc, 0x67, 0xff, 0xfb, 0xe0, 0xff, 0x88, 0xfc, 0x00, 0xff, 0x0a, 0xf3, 
+  0xc2, 0xff, 0xac, 0x2e, 0xff, 0xad, 0x13, 0xff, 0xce, 0x17, 0xff, 0xe6, 0xfb, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x5c, 0xff, 0xee, 0xfa, 0xff, 0xff, 0x9d, 0xff, 0xf7, 0x71, 0xff, 
+  0x81, 0xff, 0xf0, 0xff, 0x06, 0xf7, 0x50, 0xff, 0xee, 0xb9, 0xff, 0xe6, 0xb9, 0xff, 0xbd, 0x95, 0xff, 0xa4, 0xf3, 0xff, 0xb4, 0x0d, 0xff, 0xf3, 0xc1, 0xff, 0x86, 0xfc, 0x00, 0xff, 0x82, 0xfb, 
+  0xe0, 0xff, 0x02, 0xfc, 0x45, 0xff, 0xe6, 0x74, 0xff, 0xff, 0xcf, 0xff, 0x81, 0xff, 0xef, 0xff, 0x02, 0xde, 0x72, 0xff, 0xde, 0x99, 0xff, 0xef, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 
+  0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x06, 0xe6, 0xda, 0xff, 0xf7, 0x5c, 0xff, 0xff, 0x5c, 0xff, 0xee, 0xda, 0xff, 0xff, 0xff, 0xff, 0xee, 0xfa, 0xff, 0xf5, 
+  0xd3, 0xff, 0x82, 0xfb, 0xe0, 0xff, 0x86, 0xfc, 0x00, 0xff, 0x03, 0xeb, 0xc4, 0xff, 0xa4, 0x70, 0xff, 0xbd, 0x95, 0xff, 0xe6, 0xba, 0xff, 0x81, 0xf7, 0x5c, 0xff, 0x02, 0xf7, 0x3b, 0xff, 0xf7, 
+  0x5b, 0xff, 0xee, 0xfb, 0xff, 0x81, 0xff, 0xff, 0xff, 0x0a, 0xe6, 0x98, 0xff, 0xf7, 0x30, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x6f, 0xff, 0xf7, 0x50, 0xff, 0xee, 0xf9, 0xff, 0xf7, 0x1b, 0xff, 0xd6, 
+  0x37, 0xff, 0xb5, 0x54, 0xff, 0xac, 0x4f, 0xff, 0xf3, 0xc2, 0xff, 0x84, 0xfc, 0x00, 0xff, 0x84, 0xfb, 0xe0, 0xff, 0x00, 0xfe, 0x6b, 0xff, 0x81, 0xff, 0xef, 0xff, 0x03, 0xde, 0x72, 0xff, 0xde, 
+  0x99, 0xff, 0xde, 0x78, 0xff, 0xe7, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xef, 0x1b, 0xff, 0x81, 0xf7, 
+  0x3b, 0xff, 0x03, 0xf7, 0x5b, 0xff, 0xe6, 0xb9, 0xff, 0xff, 0xbe, 0xff, 0xfc, 0x67, 0xff, 0x83, 0xfb, 0xe0, 0xff, 0x84, 0xfc, 0x00, 0xff, 0x05, 0xf3, 0xe2, 0xff, 0xac, 0x70, 0xff, 0xc5, 0xb6, 
+  0xff, 0xee, 0xfb, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x5c, 0xff, 0x81, 0xf7, 0x3b, 0xff, 0x00, 0xee, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xe6, 0xda, 0xff, 0xde, 0x78, 0xff, 0xde, 0x37, 0xff, 
+  0xef, 0x30, 0xff, 0x81, 0xf7, 0x8f, 0xff, 0x06, 0xf7, 0x50, 0xff, 0xee, 0xf9, 0xff, 0xf7, 0x3b, 0xff, 0xde, 0x78, 0xff, 0xbd, 0x95, 0xff, 0xac, 0x4f, 0xff, 0xfb, 0xe0, 0xff, 0x82, 0xfc, 0x00, 
+  0xff, 0x84, 0xfb, 0xe0, 0xff, 0x03, 0xfb, 0xc0, 0xff, 0xfc, 0xa5, 0xff, 0xff, 0xaf, 0xff, 0xde, 0x72, 0xff, 0x81, 0xde, 0x78, 0xff, 0x01, 0xe6, 0xda, 0xff, 0xef, 0x1c, 0xff, 0x81, 0xf7, 0x9e, 
+  0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x01, 0xef, 0x1b, 0xff, 0xff, 0x7d, 0xff, 0x82, 0xf7, 0x3b, 0xff, 0x00, 0xe5, 0xf4, 0xff, 0x84, 0xfb, 
+  0xe0, 0xff, 0x83, 0xfc, 0x00, 0xff, 0x08, 0xfb, 0xe0, 0xff, 0xbc, 0x4e, 0xff, 0xbd, 0xb6, 0xff, 0xee, 0xfb, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xee, 
+  0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xe6, 0xda, 0xff, 0xde, 0x78, 0xff, 0x81, 0xde, 0x58, 0xff, 0x01, 0xde, 0x37, 0xff, 0xef, 0x30, 0xff, 0x81, 0xff, 0xaf, 0xff, 0x05, 0xf7, 0x50, 0xff, 
+  0xee, 0xf9, 0xff, 0xf7, 0x3b, 0xff, 0xde, 0x78, 0xff, 0xb5, 0x54, 0xff, 0xc4, 0x0b, 0xff, 0x81, 0xfc, 0x00, 0xff, 0x84, 0xfb, 0xe0, 0xff, 0x81, 0xfb, 0xc0, 0xff, 0x06, 0xfb, 0xe0, 0xff, 0xdd, 
+  0xaf, 0xff, 0xde, 0x78, 0xff, 0xde, 0x58, 0xff, 0xe6, 0xda, 0xff, 0xee, 0xfb, 0xff, 0xef, 0x1c, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 
+  0xf7, 0x9e, 0xff, 0x00, 0xef, 0x1b, 0xff, 0x81, 0xff, 0x7c, 0xff, 0x03, 0xee, 0xfa, 0xff, 0xf7, 0x1b, 0xff, 0xf5, 0x4f, 0xff, 0xfb, 0xc0, 0xff, 0x84, 0xfb, 0xe0, 0xff, 0x82, 0xfc, 0x00, 0xff, 
+  0x07, 0xdc, 0x09, 0xff, 0xb5, 0x54, 0xff, 0xe6, 0xda, 0xff, 0xff, 0x7c, 0xff, 0xf7, 0x3b, 0xff, 0xf7, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0xee, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xe6, 0xda, 
+  0xff, 0xde, 0x78, 0xff, 0xd6, 0x37, 0xff, 0x81, 0xe6, 0xda, 0xff, 0x02, 0xde, 0x58, 0xff, 0xd6, 0x36, 0xff, 0xef, 0x2f, 0xff, 0x81, 0xff, 0xf0, 0xff, 0x05, 0xf7, 0x50, 0xff, 0xee, 0xd9, 0xff, 
+  0xf7, 0x3b, 0xff, 0xde, 0x58, 0xff, 0xac, 0xf3, 0xff, 0xe3, 0xc5, 0xff, 0x85, 0xfb, 0xe0, 0xff, 0x82, 0xfb, 0xc0, 0xff, 0x05, 0xec, 0xee, 0xff, 0xd6, 0x37, 0xff, 0xe6, 0xda, 0xff, 0xee, 0xfa, 
+  0xff, 0xee, 0xfb, 0xff, 0xef, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x05, 0xe6, 0xda, 0xff, 0xff, 0x7c, 0xff, 
+  0xf7, 0x1b, 0xff, 0xf7, 0x1a, 0xff, 0xee, 0xd9, 0xff, 0xfc, 0x25, 0xff, 0x81, 0xfb, 0xc0, 0xff, 0x86, 0xfb, 0xe0, 0xff, 0x03, 0xb4, 0xb1, 0xff, 0xde, 0x78, 0xff, 0xf7, 0x5c, 0xff, 0xf7, 0x3b, 
+  0xff, 0x81, 0xf7, 0x1a, 0xff, 0x00, 0xee, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0xe6, 0xba, 0xff, 0x81, 0xde, 0x58, 0xff, 0x06, 0xde, 0x78, 0xff, 0xde, 0x99, 0xff, 0xee, 0xfa, 0xff, 0xe6, 
+  0xda, 0xff, 0xd6, 0x57, 0xff, 0xd6, 0x16, 0xff, 0xef, 0x2f, 0xff, 0x81, 0xff, 0xf0, 0xff, 0x04, 0xf7, 0x50, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x1a, 0xff, 0xc5, 0x93, 0xff, 0xbc, 0x88, 0xff, 0x84, 
+  0xfb, 0xe0, 0xff, 0x83, 0xfb, 0xc0, 0xff, 0x05, 0xf4, 0x05, 0xff, 0xde, 0x78, 0xff, 0xe6, 0xfa, 0xff, 0xee, 0xfa, 0xff, 0xe6, 0xfa, 0xff, 0xef, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 
+  0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x01, 0xe6, 0xd9, 0xff, 0xee, 0xfa, 0xff, 0x81, 0xf7, 0x1a, 0xff, 0x00, 0xe6, 0x36, 0xff, 0x83, 0xfb, 0xc0, 0xff, 0x84, 
+  0xfb, 0xe0, 0xff, 0x03, 0xe4, 0x08, 0xff, 0xbd, 0x95, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x3b, 0xff, 0x81, 0xf7, 0x1a, 0xff, 0x00, 0xee, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xe6, 0xb9, 0xff, 
+  0xde, 0x57, 0xff, 0xd6, 0x58, 0xff, 0x81, 0xde, 0x78, 0xff, 0x00, 0xe6, 0xfa, 0xff, 0x82, 0xe6, 0xda, 0xff, 0x02, 0xd6, 0x37, 0xff, 0xd6, 0x16, 0xff, 0xef, 0x30, 0xff, 0x81, 0xff, 0xf0, 0xff, 
+  0x04, 0xf7, 0x50, 0xff, 0xe6, 0x75, 0xff, 0xef, 0x2f, 0xff, 0xbd, 0xcc, 0xff, 0xec, 0x03, 0xff, 0x82, 0xfb, 0xe0, 0xff, 0x85, 0xfb, 0xc0, 0xff, 0x00, 0xcd, 0xb4, 0xff, 0x82, 0xe6, 0xda, 0xff, 
+  0x00, 0xe7, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x04, 0xee, 0xd9, 0xff, 0xf7, 0x1a, 0xff, 0xf6, 0xfa, 0xff, 
+  0xee, 0xfa, 0xff, 0xed, 0xf4, 0xff, 0x84, 0xfb, 0xc0, 0xff, 0x83, 0xfb, 0xe0, 0xff, 0x05, 0xc4, 0x6e, 0xff, 0xde, 0x78, 0xff, 0xef, 0x1b, 0xff, 0xf6, 0xfa, 0xff, 0xf7, 0x1a, 0xff, 0xee, 0xfa, 
+  0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xd6, 0x16, 0xff, 0xd6, 0x37, 0xff, 0xde, 0x99, 0xff, 0x86, 0xe6, 0xda, 0xff, 0x02, 0xd6, 0x37, 0xff, 0xd6, 0x16, 0xff, 0xef, 0x30, 0xff, 0x82, 0xff, 0xf0, 
+  0xff, 0x02, 0xff, 0xaf, 0xff, 0xde, 0xad, 0xff, 0xcc, 0x27, 0xff, 0x81, 0xfb, 0xe0, 0xff, 0x84, 0xfb, 0xc0, 0xff, 0x81, 0xfb, 0xa0, 0xff, 0x04, 0xdd, 0x51, 0xff, 0xd6, 0x37, 0xff, 0xe6, 0xb9, 
+  0xff, 0xd6, 0x37, 0xff, 0xe7, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xee, 0xd9, 0xff, 0x81, 0xee, 0xfa, 
+  0xff, 0x01, 0xf7, 0x3b, 0xff, 0xed, 0x72, 0xff, 0x85, 0xfb, 0xc0, 0xff, 0x82, 0xfb, 0xe0, 0xff, 0x01, 0xb4, 0xf1, 0xff, 0xde, 0x78, 0xff, 0x81, 0xf6, 0xfa, 0xff, 0x00, 0xee, 0xfa, 0xff, 0x81, 
+  0xff, 0xff, 0xff, 0x05, 0xe6, 0xb9, 0xff, 0xe6, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xd6, 0x16, 0xff, 0xd6, 0x37, 0xff, 0xde, 0x99, 0xff, 0x86, 0xe6, 0xda, 0xff, 0x07, 0xd6, 0x17, 0xff, 0xd6, 0x16, 
+  0xff, 0xf7, 0x2f, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x6f, 0xff, 0xff, 0xd0, 0xff, 0xde, 0x50, 0xff, 0xb4, 0x4c, 0xff, 0x85, 0xfb, 0xc0, 0xff, 0x82, 0xfb, 0xa0, 0xff, 0x00, 0xdc, 0xcf, 0xff, 0x81, 
+  0xd6, 0x37, 0xff, 0x01, 0xde, 0x57, 0xff, 0xe7, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x05, 0xe6, 0xb8, 0xff, 
+  0xee, 0xfa, 0xff, 0xf7, 0x5b, 0xff, 0xef, 0x1b, 0xff, 0xec, 0xef, 0xff, 0xfb, 0xa0, 0xff, 0x85, 0xfb, 0xc0, 0xff, 0x10, 0xfb, 0xe0, 0xff, 0xf3, 0xc2, 0xff, 0xbd, 0x74, 0xff, 0xee, 0xd9, 0xff, 
+  0xf6, 0xd9, 0xff, 0xee, 0xda, 0xff, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xb9, 0xff, 0xde, 0x37, 0xff, 0xd5, 0xf6, 0xff, 0xe6, 0xfa, 0xff, 0xff, 0xbe, 0xff, 0xd6, 0x16, 0xff, 0xd6, 0x17, 
+  0xff, 0xde, 0x79, 0xff, 0xe6, 0xda, 0xff, 0x82, 0xe6, 0xba, 0xff, 0x09, 0xe6, 0xd9, 0xff, 0xde, 0x78, 0xff, 0xd6, 0x16, 0xff, 0xd5, 0xf3, 0xff, 0xff, 0x8f, 0xff, 0xe6, 0xed, 0xff, 0xff, 0xcf, 
+  0xff, 0xff, 0xf0, 0xff, 0xef, 0x0f, 0xff, 0xc5, 0xcc, 0xff, 0x84, 0xfb, 0xc0, 0xff, 0x83, 0xfb, 0xa0, 0xff, 0x04, 0xe4, 0x6d, 0xff, 0xd5, 0xf6, 0xff, 0xde, 0x37, 0xff, 0xde, 0x57, 0xff, 0xe6, 
+  0xfb, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x03, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 0xde, 0xdb, 0x70, 0xef, 0x7d, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x04, 0xe6, 0x99, 0xff, 0xef, 0x1b, 0xff, 0xf7, 0x1b, 
+  0xff, 0xe6, 0xd9, 0xff, 0xec, 0x8c, 0xff, 0x81, 0xfb, 0xa0, 0xff, 0x85, 0xfb, 0xc0, 0xff, 0x07, 0xec, 0x27, 0xff, 0xbd, 0x95, 0xff, 0xe6, 0x77, 0xff, 0xe6, 0xb9, 0xff, 0xef, 0x5d, 0xff, 0xf7, 
+  0x9e, 0xff, 0xde, 0x79, 0xff, 0xd5, 0xf6, 0xff, 0x81, 0xcd, 0xf6, 0xff, 0x05, 0xcd, 0xd5, 0xff, 0xe6, 0xba, 0xff, 0xf7, 0x9e, 0xff, 0xcd, 0xd5, 0xff, 0xcd, 0xf6, 0xff, 0xd6, 0x58, 0xff, 0x82, 
+  0xde, 0x99, 0xff, 0x03, 0xd6, 0x37, 0xff, 0xd5, 0xf6, 0xff, 0xcd, 0xd3, 0xff, 0xf7, 0x6f, 0xff, 0x81, 0xff, 0xaf, 0xff, 0x04, 0xf7, 0x4f, 0xff, 0xff, 0xaf, 0xff, 0xf7, 0x8f, 0xff, 0xce, 0x4c, 
+  0xff, 0xf3, 0xe1, 0xff, 0x82, 0xfb, 0xc0, 0xff, 0x84, 0xfb, 0xa0, 0xff, 0x01, 0xe4, 0x2a, 0xff, 0xcd, 0xd5, 0xff, 0x81, 0xd6, 0x16, 0xff, 0x06, 0xe6, 0xda, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 
+  0xff, 0xef, 0x5d, 0xe4, 0x00, 0x00, 0x0b, 0xd6, 0xba, 0x70, 0xef, 0x3d, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x00, 0xde, 0x98, 0xff, 0x81, 0xee, 0xda, 0xff, 0x01, 0xde, 0x78, 0xff, 0xec, 0x4a, 0xff, 
+  0x82, 0xfb, 0xa0, 0xff, 0x84, 0xfb, 0xc0, 0xff, 0x02, 0xe4, 0x07, 0xff, 0xd6, 0x9a, 0xff, 0xe6, 0xda, 0xff, 0x81, 0xf7, 0x7d, 0xff, 0x00, 0xde, 0x58, 0xff, 0x81, 0xcd, 0xd5, 0xff, 0x15, 0xde, 
+  0x58, 0xff, 0xd6, 0x37, 0xff, 0xcd, 0xb5, 0xff, 0xc5, 0xb4, 0xff, 0xde, 0x99, 0xff, 0xef, 0x5d, 0xff, 0xc5, 0x94, 0xff, 0xcd, 0xb5, 0xff, 0xd6, 0x37, 0xff, 0xde, 0x58, 0xff, 0xce, 0x17, 0xff, 
+  0xcd, 0xb5, 0xff, 0xc5, 0x92, 0xff, 0xef, 0x2e, 0xff, 0xf7, 0x8e, 0xff, 0xf7, 0x8f, 0xff, 0xde, 0x50, 0xff, 0xd5, 0xf1, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x6f, 0xff, 0xd6, 0x4d, 0xff, 0xf4, 0x02, 
+  0xff, 0x81, 0xfb, 0xc0, 0xff, 0x85, 0xfb, 0xa0, 0xff, 0x01, 0xe4, 0x08, 0xff, 0xc5, 0x94, 0xff, 0x81, 0xcd, 0xd5, 0xff, 0x05, 0xde, 0xba, 0xff, 0xef, 0x3d, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 
+  0xe4, 0x00, 0x00, 0x0b, 0xd6, 0x9a, 0x70, 0x82, 0xe6, 0xfc, 0xff, 0x00, 0xd6, 0x58, 0xff, 0x81, 0xe6, 0xb9, 0xff, 0x01, 0xce, 0x17, 0xff, 0xe4, 0x09, 0xff, 0x84, 0xfb, 0xa0, 0xff, 0x82, 0xfb, 
+  0xc0, 0xff, 0x01, 0xeb, 0xe6, 0xff, 0xc5, 0xd7, 0xff, 0x81, 0xef, 0x5d, 0xff, 0x02, 0xd6, 0x37, 0xff, 0xcd, 0x94, 0xff, 0xc5, 0xb5, 0xff, 0x82, 0xd6, 0x37, 0xff, 0x00, 0xce, 0x16, 0xff, 0x81, 
+  0xc5, 0x94, 0xff, 0x07, 0xc5, 0xd6, 0xff, 0xc5, 0x74, 0xff, 0xc5, 0xb5, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0xb5, 0xff, 0xc5, 0x94, 0xff, 0xc5, 0x71, 0xff, 0xe7, 0x0d, 0xff, 0x81, 0xef, 0x4e, 0xff, 
+  0x07, 0xd6, 0x30, 0xff, 0xcd, 0xd1, 0xff, 0xef, 0x2e, 0xff, 0xef, 0x4e, 0xff, 0xef, 0x2e, 0xff, 0xce, 0x4c, 0xff, 0xf3, 0xe2, 0xff, 0xfb, 0xc0, 0xff, 0x85, 0xfb, 0xa0, 0xff, 0x05, 0xfb, 0x80, 
+  0xff, 0xe3, 0xe9, 0xff, 0xbd, 0x53, 0xff, 0xc5, 0x73, 0xff, 0xc5, 0xb5, 0xff, 0xd6, 0x79, 0xff, 0x81, 0xe6, 0xfc, 0xff, 0x02, 0xde, 0xfb, 0xe4, 0x00, 0x00, 0x0b, 0xce, 0x59, 0x70, 0x82, 0xde, 
+  0xdb, 0xff, 0x04, 0xcd, 0xd6, 0xff, 0xde, 0x58, 0xff, 0xd6, 0x37, 0xff, 0xc5, 0xb4, 0xff, 0xe4, 0x0a, 0xff, 0x85, 0xfb, 0xa0, 0xff, 0x81, 0xfb, 0xc0, 0xff, 0x05, 0xf3, 0xe4, 0xff, 0xd6, 0x59, 
+  0xff, 0xef, 0x1c, 0xff, 0xcd, 0xf6, 0xff, 0xc5, 0x73, 0xff, 0xc5, 0x74, 0xff, 0x84, 0xcd, 0xf6, 0xff, 0x02, 0xcd, 0xd6, 0xff, 0xbd, 0x74, 0xff, 0xc5, 0x74, 0xff, 0x81, 0xc5, 0x94, 0xff, 0x81, 
+  0xc5, 0x74, 0xff, 0x01, 0xbd, 0x31, 0xff, 0xe6, 0xcd, 0xff, 0x81, 0xef, 0x2d, 0xff, 0x02, 0xd6, 0x0f, 0xff, 0xcd, 0x91, 0xff, 0xe6, 0xee, 0xff, 0x81, 0xef, 0x0e, 0xff, 0x02, 0xcd, 0xd0, 0xff, 
+  0xbd, 0x6c, 0xff, 0xfb, 0xe1, 0xff, 0x85, 0xfb, 0xa0, 0xff, 0x81, 0xfb, 0x80, 0xff, 0x04, 0xdb, 0xc9, 0xff, 0xbd, 0x54, 0xff, 0xd6, 0x79, 0xff, 0xbd, 0x33, 0xff, 0xce, 0x58, 0xff, 0x81, 0xde, 
+  0xdb, 0xff, 0x02, 0xde, 0xbb, 0xe4, 0x00, 0x00, 0x0b, 0xc6, 0x38, 0x70, 0x82, 0xd6, 0x9a, 0xff, 0x05, 0xcd, 0xd5, 0xff, 0xcd, 0xb5, 0xff, 0xcd, 0xd5, 0xff, 0xc5, 0x94, 0xff, 0xd4, 0x0c, 0xff, 
+  0xfb, 0x80, 0xff, 0x86, 0xfb, 0xa0, 0xff, 0x04, 0xfb, 0xc1, 0xff, 0xce, 0x17, 0xff, 0xcd, 0xb5, 0xff, 0xbd, 0x32, 0xff, 0xbd, 0x33, 0xff, 0x82, 0xcd, 0xd5, 0xff, 0x05, 0xc5, 0xb5, 0xff, 0xcd, 
+  0xd5, 0xff, 0xcd, 0xd6, 0xff, 0xc5, 0xd6, 0xff, 0xc5, 0xb5, 0xff, 0xb5, 0x33, 0xff, 0x82, 0xbd, 0x53, 0xff, 0x01, 0xb5, 0x10, 0xff, 0xde, 0xad, 0xff, 0x81, 0xe6, 0xed, 0xff, 0x08, 0xcd, 0xcf, 
+  0xff, 0xc5, 0x70, 0xff, 0xde, 0xcd, 0xff, 0xe6, 0xed, 0xff, 0xe6, 0xcd, 0xff, 0xcd, 0xaf, 0xff, 0xd5, 0xd5, 0xff, 0xbc, 0xd0, 0xff, 0xfb, 0xc0, 0xff, 0x84, 0xfb, 0xa0, 0xff, 0x82, 0xfb, 0x80, 
+  0xff, 0x04, 0xd4, 0x2d, 0xff, 0xd6, 0x9a, 0xff, 0xbd, 0x74, 0xff, 0xbd, 0x53, 0xff, 0xce, 0x17, 0xff, 0x81, 0xd6, 0x9a, 0xff, 0x02, 0xd6, 0x9a, 0xe4, 0x00, 0x00, 0x0b, 0xc5, 0xf8, 0x70, 0x82, 
+  0xce, 0x79, 0xff, 0x00, 0xbd, 0x74, 0xff, 0x81, 0xcd, 0xb4, 0xff, 0x01, 0xbd, 0x53, 0xff, 0xc4, 0x2d, 0xff, 0x81, 0xfb, 0x80, 0xff, 0x86, 0xfb, 0xa0, 0xff, 0x02, 0xc4, 0x8e, 0xff, 0xbc, 0xf1, 
+  0xff, 0xb4, 0xf2, 0xff, 0x81, 0xc5, 0x94, 0xff, 0x03, 0xc5, 0x95, 0xff, 0xbd, 0x53, 0xff, 0xb4, 0xf2, 0xff, 0xbd, 0x54, 0xff, 0x82, 0xc5, 0x95, 0xff, 0x04, 0xbd, 0x74, 0xff, 0xb4, 0xf2, 0xff, 
+  0xb5, 0x12, 0xff, 0xb4, 0xef, 0xff, 0xd6, 0x6c, 0xff, 0x81, 0xde, 0xad, 0xff, 0x02, 0xc5, 0x8e, 0xff, 0xbd, 0x2f, 0xff, 0xde, 0x8d, 0xff, 0x81, 0xde, 0xad, 0xff, 0x00, 0xc5, 0x6f, 0xff, 0x81, 
+  0xcd, 0x94, 0xff, 0x00, 0xd4, 0xae, 0xff, 0x83, 0xfb, 0xa0, 0xff, 0x84, 0xfb, 0x80, 0xff, 0x01, 0xcc, 0xd1, 0xff, 0xad, 0x13, 0xff, 0x81, 0xb5, 0x12, 0xff, 0x00, 0xc5, 0xf7, 0xff, 0x81, 0xce, 
+  0x79, 0xff, 0x02, 0xce, 0x59, 0xe4, 0x00, 0x00, 0x0b, 0xbd, 0xd7, 0x70, 0x82, 0xce, 0x39, 0xff, 0x04, 0xc5, 0xd6, 0xff, 0xbd, 0x53, 0xff, 0xc5, 0x74, 0xff, 0xbd, 0x33, 0xff, 0xac, 0x6f, 0xff, 
+  0x82, 0xfb, 0x80, 0xff, 0x85, 0xfb, 0xa0, 0xff, 0x03, 0xdc, 0x09, 0xff, 0xac, 0xb0, 0xff, 0xb4, 0xd1, 0xff, 0xbd, 0x33, 0xff, 0x81, 0xbd, 0x54, 0xff, 0x00, 0xb5, 0x12, 0xff, 0x81, 0xb4, 0xd1, 
+  0xff, 0x00, 0xb5, 0x33, 0xff, 0x81, 0xbd, 0x74, 0xff, 0x03, 0xb5, 0x13, 0xff, 0xac, 0xd1, 0xff, 0xac, 0xaf, 0xff, 0xce, 0x4c, 0xff, 0x81, 0xd6, 0x8c, 0xff, 0x02, 0xbd, 0x6e, 0xff, 0xb5, 0x0f, 
+  0xff, 0xd6, 0x4c, 0xff, 0x81, 0xd6, 0x6c, 0xff, 0x00, 0xbd, 0x4e, 0xff, 0x81, 0xc5, 0x73, 0xff, 0x01, 0xa4, 0xce, 0xff, 0xe4, 0x49, 0xff, 0x82, 0xfb, 0xa0, 0xff, 0x85, 0xfb, 0x80, 0xff, 0x04, 
+  0x9b, 0xcc, 0xff, 0xac, 0xb1, 0xff, 0xb4, 0xf1, 0xff, 0xac, 0xf1, 0xff, 0xbd, 0xb6, 0xff, 0x81, 0xce, 0x39, 0xff, 0x02, 0xc6, 0x38, 0xe4, 0x00, 0x00, 0x0b, 0xb5, 0x96, 0x70, 0x82, 0xc6, 0x18, 
+  0xff, 0x05, 0xc5, 0xf7, 0xff, 0xce, 0x38, 0xff, 0xb5, 0x33, 0xff, 0xbd, 0x32, 0xff, 0x9c, 0x4f, 0xff, 0xf3, 0x61, 0xff, 0x83, 0xfb, 0x80, 0xff, 0x83, 0xfb, 0xa0, 0xff, 0x00, 0xfb, 0xc3, 0xff, 
+  0x82, 0xac, 0x90, 0xff, 0x00, 0xb4, 0xf2, 0xff, 0x81, 0xbd, 0x33, 0xff, 0x00, 0xac, 0xb1, 0xff, 0x81, 0xac, 0xb0, 0xff, 0x04, 0xb4, 0xf2, 0xff, 0xac, 0xf2, 0xff, 0xac, 0xb0, 0xff, 0xa4, 0x8e, 
+  0xff, 0xce, 0x0c, 0xff, 0x81, 0xd6, 0x4c, 0xff, 0x02, 0xbd, 0x4d, 0xff, 0xb4, 0xce, 0xff, 0xce, 0x2c, 0xff, 0x81, 0xd6, 0x4c, 0xff, 0x00, 0xbd, 0x0e, 0xff, 0x81, 0xc5, 0x32, 0xff, 0x02, 0xa4, 
+  0xce, 0xff, 0x9c, 0x8a, 0xff, 0xfc, 0x03, 0xff, 0x81, 0xfb, 0xa0, 0xff, 0x85, 0xfb, 0x80, 0xff, 0x02, 0xf3, 0x62, 0xff, 0x8b, 0xee, 0xff, 0xac, 0xb0, 0xff, 0x81, 0xac, 0xb1, 0xff, 0x00, 0xb5, 
+  0x95, 0xff, 0x81, 0xc6, 0x18, 0xff, 0x02, 0xc5, 0xf8, 0xe4, 0x00, 0x00, 0x0b, 0xad, 0x75, 0x70, 0x82, 0xbd, 0xd7, 0xff, 0x05, 0xbd, 0x96, 0xff, 0xc6, 0x18, 0xff, 0xbd, 0xb6, 0xff, 0xb4, 0xf2, 
+  0xff, 0xa4, 0x70, 0xff, 0xd3, 0x67, 0xff, 0x85, 0xfb, 0x80, 0xff, 0x82, 0xfb, 0xa0, 0xff, 0x06, 0xd4, 0x6c, 0xff, 0xac, 0xb1, 0xff, 0xac, 0x6f, 0xff, 0xa4, 0x6f, 0xff, 0xac, 0xd1, 0xff, 0xac, 
+  0xb1, 0xff, 0xa4, 0x6f, 0xff, 0x81, 0xac, 0x70, 0xff, 0x81, 0xa4, 0x70, 0xff, 0x01, 0xa4, 0x4d, 0xff, 0xc5, 0xcb, 0xff, 0x81, 0xce, 0x0b, 0xff, 0x02, 0xb5, 0x0d, 0xff, 0xac, 0xad, 0xff, 0xcd, 
+  0xeb, 0xff, 0x81, 0xce, 0x0b, 0xff, 0x06, 0xb4, 0xed, 0xff, 0xbc, 0xf1, 0xff, 0xbd, 0x11, 0xff, 0x9c, 0x8d, 0xff, 0x8c, 0x8a, 0xff, 0xd4, 0x88, 0xff, 0xfb, 0xa0, 0xff, 0x86, 0xfb, 0x80, 0xff, 
+  0x03, 0xfb, 0x60, 0xff, 0xd3, 0x46, 0xff, 0x94, 0x0e, 0xff, 0xa4, 0x70, 0xff, 0x81, 0xa4, 0x90, 0xff, 0x00, 0xb5, 0x55, 0xff, 0x81, 0xbd, 0xd7, 0xff, 0x02, 0xbd, 0xd7, 0xe4, 0x00, 0x00, 0x0b, 
+  0xad, 0x35, 0x70, 0x82, 0xb5, 0xb6, 0xff, 0x06, 0xa4, 0xb1, 0xff, 0xb5, 0x95, 0xff, 0xb5, 0x75, 0xff, 0xbd, 0x96, 0xff, 0x9c, 0x70, 0xff, 0xab, 0x8a, 0xff, 0xfb, 0x60, 0xff, 0x86, 0xfb, 0x80, 
+  0xff, 0x03, 0xfb, 0xa0, 0xff, 0xfc, 0x03, 0xff, 0xb4, 0x8f, 0xff, 0xac, 0x90, 0xff, 0x81, 0xa4, 0x2f, 0xff, 0x84, 0xa4, 0x4f, 0xff, 0x01, 0x9c, 0x2d, 0xff, 0xbd, 0xab, 0xff, 0x81, 0xc5, 0xeb, 
+  0xff, 0x01, 0xac, 0xec, 0xff, 0xac, 0x8d, 0xff, 0x81, 0xc5, 0xab, 0xff, 0x01, 0xc5, 0xcb, 0xff, 0xac, 0xac, 0xff, 0x81, 0xb4, 0xd1, 0xff, 0x03, 0x9c, 0x6d, 0xff, 0x8c, 0x6a, 0xff, 0xa4, 0x69, 
+  0xff, 0xfc, 0x25, 0xff, 0x86, 0xfb, 0x80, 0xff, 0x81, 0xfb, 0x60, 0xff, 0x05, 0xab, 0xa6, 0xff, 0x93, 0xed, 0xff, 0x9c, 0x4f, 0xff, 0x9c, 0x50, 0xff, 0x9c, 0x6f, 0xff, 0xad, 0x34, 0xff, 0x81, 
+  0xb5, 0xb6, 0xff, 0x02, 0xb5, 0x96, 0xe4, 0x00, 0x00, 0x0b, 0xa5, 0x14, 0x70, 0x82, 0xb5, 0x76, 0xff, 0x06, 0xa4, 0xb1, 0xff, 0xa4, 0xb0, 0xff, 0xb5, 0x55, 0xff, 0xb5, 0x75, 0xff, 0xb5, 0x55, 
+  0xff, 0x83, 0xad, 0xff, 0xf3, 0x41, 0xff, 0x87, 0xfb, 0x80, 0xff, 0x04, 0xfb, 0xa0, 0xff, 0xec, 0x48, 0xff, 0xac, 0x90, 0xff, 0xa4, 0x70, 0xff, 0x9c, 0x0e, 0xff, 0x81, 0xa4, 0x2e, 0xff, 0x81, 
+  0x9c, 0x2e, 0xff, 0x01, 0x9c, 0x0c, 0xff, 0xbd, 0x6b, 0xff, 0x81, 0xbd, 0xab, 0xff, 0x0c, 0xac, 0xac, 0xff, 0xa4, 0x4c, 0xff, 0xbd, 0x8b, 0xff, 0xb5, 0x4a, 0xff, 0xbd, 0x6a, 0xff, 0xac, 0x8c, 
+  0xff, 0xac, 0xb0, 0xff, 0xb4, 0xb0, 0xff, 0x94, 0x4c, 0xff, 0x84, 0x49, 0xff, 0x8c, 0x49, 0xff, 0xf4, 0xa8, 0xff, 0xfb, 0xa0, 0xff, 0x84, 0xfb, 0x80, 0xff, 0x82, 0xfb, 0x60, 0xff, 0x06, 0xf3, 
+  0x61, 0xff, 0x9c, 0x88, 0xff, 0xac, 0xea, 0xff, 0x94, 0x0e, 0xff, 0x9c, 0x2f, 0xff, 0x9c, 0x4f, 0xff, 0xa5, 0x13, 0xff, 0x81, 0xb5, 0x76, 0xff, 0x02, 0xad, 0x75, 0xe4, 0x00, 0x00, 0x0b, 0xd6, 
+  0x9a, 0x70, 0x82, 0xe7, 0x3c, 0xff, 0x06, 0xce, 0x15, 0xff, 0xde, 0x78, 0xff, 0xde, 0x57, 0xff, 0xe6, 0xfb, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0x79, 0xff, 0xd4, 0x6e, 0xff, 0x81, 0xfb, 0x60, 0xff, 
+  0x86, 0xfb, 0x80, 0xff, 0x04, 0xfb, 0xc2, 0xff, 0xec, 0xec, 0xff, 0xde, 0x57, 0xff, 0xd6, 0x37, 0xff, 0xcd, 0xd5, 0xff, 0x81, 0xd5, 0xf6, 0xff, 0x01, 0xcd, 0xd3, 0xff, 0xef, 0x32, 0xff, 0x81, 
+  0xf7, 0x72, 0xff, 0x05, 0xde, 0x73, 0xff, 0xd6, 0x34, 0xff, 0xef, 0x52, 0xff, 0xe7, 0x11, 0xff, 0xef, 0x52, 0xff, 0xde, 0x54, 0xff, 0x81, 0xe6, 0x77, 0xff, 0x04, 0xc6, 0x13, 0xff, 0xbe, 0x11, 
+  0xff, 0xbd, 0xf0, 0xff, 0xed, 0x0a, 0xff, 0xfb, 0xc3, 0xff, 0x84, 0xfb, 0x80, 0xff, 0x83, 0xfb, 0x60, 0xff, 0x06, 0xcc, 0x49, 0xff, 0xd6, 0x90, 0xff, 0xef, 0x52, 0xff, 0xe6, 0xf2, 0xff, 0xcd, 
+  0xd5, 0xff, 0xcd, 0xf6, 0xff, 0xde, 0x9a, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x02, 0xe7, 0x1c, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xff, 0xbf, 0xff, 0x03, 0xce, 0x95, 0xff, 0xd6, 0x96, 
+  0xff, 0xf6, 0xfa, 0xff, 0xee, 0xd9, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x01, 0xc5, 0xd7, 0xff, 0xfb, 0x63, 0xff, 0x82, 0xfb, 0x60, 0xff, 0x85, 0xfb, 0x80, 0xff, 0x02, 0xfb, 0xe3, 0xff, 0xfd, 0x6f, 
+  0xff, 0xee, 0xd9, 0xff, 0x81, 0xe6, 0x78, 0xff, 0x01, 0xde, 0x55, 0xff, 0xff, 0xb4, 0xff, 0x81, 0xff, 0xf4, 0xff, 0x02, 0xee, 0xf5, 0xff, 0xe6, 0x96, 0xff, 0xff, 0xd4, 0xff, 0x81, 0xff, 0xf4, 
+  0xff, 0x00, 0xee, 0xd5, 0xff, 0x81, 0xf6, 0xfa, 0xff, 0x04, 0xd6, 0x95, 0xff, 0xce, 0x93, 0xff, 0xce, 0x72, 0xff, 0xf5, 0x8c, 0xff, 0xfc, 0x04, 0xff, 0x83, 0xfb, 0x80, 0xff, 0x84, 0xfb, 0x60, 
+  0xff, 0x07, 0xf3, 0x62, 0xff, 0xb5, 0x12, 0xff, 0xef, 0x13, 0xff, 0xff, 0xd3, 0xff, 0xf7, 0x93, 0xff, 0xf7, 0x73, 0xff, 0xde, 0x57, 0xff, 0xef, 0x3c, 0xff, 0x81, 0xff, 0xbf, 0xff, 0x0d, 0xf7, 
+  0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xce, 0x95, 0xff, 0xc6, 0xb3, 0xff, 0xd6, 0x95, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xd9, 0xff, 
+  0xf7, 0x7d, 0xff, 0xde, 0xdb, 0xff, 0xd4, 0x8f, 0xff, 0x84, 0xfb, 0x60, 0xff, 0x84, 0xfb, 0x80, 0xff, 0x04, 0xfc, 0x04, 0xff, 0xfd, 0x2c, 0xff, 0xe6, 0x15, 0xff, 0xde, 0x55, 0xff, 0xff, 0xb4, 
+  0xff, 0x81, 0xff, 0xf4, 0xff, 0x02, 0xee, 0xf5, 0xff, 0xe6, 0x96, 0xff, 0xff, 0xd4, 0xff, 0x81, 0xff, 0xf4, 0xff, 0x07, 0xee, 0xd5, 0xff, 0xf6, 0xf9, 0xff, 0xf6, 0xfa, 0xff, 0xd6, 0x95, 0xff, 
+  0xce, 0x93, 0xff, 0xde, 0x51, 0xff, 0xfd, 0x6c, 0xff, 0xfc, 0x05, 0xff, 0x82, 0xfb, 0x80, 0xff, 0x86, 0xfb, 0x60, 0xff, 0x07, 0xc4, 0x0d, 0xff, 0xcd, 0xf6, 0xff, 0xe6, 0xb8, 0xff, 0xf7, 0x73, 
+  0xff, 0xff, 0xd3, 0xff, 0xff, 0xb3, 0xff, 0xf7, 0x73, 0xff, 0xef, 0x1b, 0xff, 0x81, 0xff, 0xbf, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0xbe, 0xff, 0x00, 
+  0xce, 0x95, 0xff, 0x81, 0xc6, 0xb2, 0xff, 0x05, 0xd6, 0x95, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xd9, 0xff, 0xe7, 0x1c, 0xff, 0xc5, 0xf8, 0xff, 0xeb, 0xa8, 0xff, 0x85, 0xfb, 0x60, 0xff, 0x83, 0xfb, 
+  0x80, 0xff, 0x07, 0xfb, 0xc3, 0xff, 0xfc, 0xc8, 0xff, 0xfe, 0x2e, 0xff, 0xff, 0x32, 0xff, 0xff, 0xf4, 0xff, 0xee, 0xf4, 0xff, 0xe6, 0x95, 0xff, 0xff, 0xd4, 0xff, 0x81, 0xff, 0xf4, 0xff, 0x00, 
+  0xee, 0xd5, 0xff, 0x81, 0xf6, 0xf9, 0xff, 0x05, 0xd6, 0x95, 0xff, 0xd6, 0x51, 0xff, 0xf5, 0xef, 0xff, 0xfd, 0x0a, 0xff, 0xfb, 0xc3, 0xff, 0xfb, 0x80, 0xff, 0x88, 0xfb, 0x60, 0xff, 0x08, 0xe3, 
+  0x64, 0xff, 0x94, 0xee, 0xff, 0xde, 0x77, 0xff, 0xee, 0xfa, 0xff, 0xee, 0xb8, 0xff, 0xf7, 0x73, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xf3, 0xff, 0xef, 0x3b, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x02, 0xf7, 
+  0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0xbe, 0xff, 0x00, 0xce, 0x94, 0xff, 0x82, 0xbe, 0x92, 0xff, 0x05, 0xd6, 0x95, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xb9, 0xff, 0xd6, 0x79, 
+  0xff, 0xbd, 0x34, 0xff, 0xfb, 0x41, 0xff, 0x88, 0xfb, 0x60, 0xff, 0x81, 0xfb, 0x80, 0xff, 0x0e, 0xfc, 0x46, 0xff, 0xfd, 0x2b, 0xff, 0xfd, 0xee, 0xff, 0xf6, 0x12, 0xff, 0xff, 0x52, 0xff, 0xff, 
+  0xb3, 0xff, 0xff, 0xd3, 0xff, 0xee, 0xb4, 0xff, 0xf6, 0xd8, 0xff, 0xf6, 0xb7, 0xff, 0xf6, 0x53, 0xff, 0xfe, 0x0f, 0xff, 0xfd, 0x6c, 0xff, 0xfc, 0x47, 0xff, 0xfb, 0x80, 0xff, 0x89, 0xfb, 0x60, 
+  0xff, 0x09, 0xf3, 0x41, 0xff, 0x9c, 0x4b, 0xff, 0xad, 0xd0, 0xff, 0xc6, 0x72, 0xff, 0xe6, 0xd8, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xb8, 0xff, 0xf7, 0x73, 0xff, 0xff, 0xf2, 0xff, 0xef, 0x3b, 0xff, 
+  0x81, 0xf7, 0xbe, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0xbe, 0xff, 0x01, 0xce, 0x94, 0xff, 0xbe, 0x91, 0xff, 0x82, 0xbe, 0x92, 0xff, 0x05, 0xce, 0x75, 
+  0xff, 0xee, 0xd9, 0xff, 0xe6, 0x98, 0xff, 0xc5, 0xf7, 0xff, 0xc4, 0x90, 0xff, 0xfb, 0x40, 0xff, 0x8a, 0xfb, 0x60, 0xff, 0x04, 0xfb, 0x80, 0xff, 0xfc, 0x04, 0xff, 0xfc, 0xea, 0xff, 0xfd, 0x6c, 
+  0xff, 0xfd, 0xef, 0xff, 0x81, 0xfe, 0x51, 0xff, 0x03, 0xfd, 0xef, 0xff, 0xfd, 0x8d, 0xff, 0xfc, 0xea, 0xff, 0xfc, 0x04, 0xff, 0x8a, 0xfb, 0x60, 0xff, 0x81, 0xfb, 0x40, 0xff, 0x09, 0xab, 0xe9, 
+  0xff, 0x9d, 0x4e, 0xff, 0xbe, 0x51, 0xff, 0xbe, 0x92, 0xff, 0xc6, 0x72, 0xff, 0xe6, 0xb8, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xb8, 0xff, 0xf7, 0x72, 0xff, 0xef, 0x3b, 0xff, 0x81, 0xf7, 0xbe, 0xff, 
+  0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0xbe, 0xff, 0x00, 0xc6, 0x94, 0xff, 0x84, 0xbe, 0x91, 0xff, 0x05, 0xce, 0x75, 0xff, 0xee, 0xd9, 0xff, 0xde, 0x57, 0xff, 
+  0xbd, 0x96, 0xff, 0xcc, 0x2d, 0xff, 0xfb, 0x40, 0xff, 0x9c, 0xfb, 0x60, 0xff, 0x83, 0xfb, 0x40, 0xff, 0x03, 0xbb, 0xa7, 0xff, 0x94, 0xed, 0xff, 0xb6, 0x10, 0xff, 0xbe, 0x71, 0xff, 0x81, 0xbe, 
+  0x91, 0xff, 0x04, 0xbe, 0x72, 0xff, 0xe6, 0xb8, 0xff, 0xee, 0xf9, 0xff, 0xe6, 0xb8, 0xff, 0xef, 0x1b, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 
+  0x82, 0xf7, 0xbe, 0xff, 0x00, 0xc6, 0x74, 0xff, 0x82, 0xbe, 0x91, 0xff, 0x00, 0xbe, 0x71, 0xff, 0x81, 0xbe, 0x91, 0xff, 0x04, 0xce, 0x74, 0xff, 0xee, 0xd9, 0xff, 0xd6, 0x16, 0xff, 0xb5, 0x55, 
+  0xff, 0xd4, 0x0c, 0xff, 0x82, 0xfb, 0x40, 0xff, 0x96, 0xfb, 0x60, 0xff, 0x84, 0xfb, 0x40, 0xff, 0x03, 0xfb, 0x20, 0xff, 0xbb, 0x86, 0xff, 0x8c, 0xac, 0xff, 0xad, 0xef, 0xff, 0x81, 0xbe, 0x71, 
+  0xff, 0x82, 0xbe, 0x91, 0xff, 0x03, 0xbe, 0x72, 0xff, 0xe6, 0xb8, 0xff, 0xee, 0xd9, 0xff, 0xef, 0x1b, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 
+  0x82, 0xf7, 0xbe, 0xff, 0x00, 0xc6, 0x74, 0xff, 0x86, 0xbe, 0x71, 0xff, 0x05, 0xce, 0x74, 0xff, 0xee, 0xb9, 0xff, 0xd5, 0xf6, 0xff, 0xad, 0x55, 0xff, 0xcc, 0x0d, 0xff, 0xfb, 0x20, 0xff, 0x84, 
+  0xfb, 0x40, 0xff, 0x8e, 0xfb, 0x60, 0xff, 0x87, 0xfb, 0x40, 0xff, 0x04, 0xfb, 0x20, 0xff, 0xb3, 0x87, 0xff, 0x84, 0xac, 0xff, 0xad, 0xcf, 0xff, 0xb6, 0x50, 0xff, 0x86, 0xbe, 0x71, 0xff, 0x01, 
+  0xe6, 0xb8, 0xff, 0xef, 0x1b, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0xbe, 0xff, 0x06, 0xc6, 0x74, 0xff, 0xbe, 0x70, 0xff, 0xb6, 
+  0x70, 0xff, 0xbe, 0x70, 0xff, 0xb6, 0x70, 0xff, 0xbe, 0x71, 0xff, 0xb6, 0x70, 0xff, 0x81, 0xbe, 0x70, 0xff, 0x05, 0xce, 0x54, 0xff, 0xee, 0xb9, 0xff, 0xd5, 0xf6, 0xff, 0xb5, 0x55, 0xff, 0xbc, 
+  0x70, 0xff, 0xf3, 0x22, 0xff, 0x99, 0xfb, 0x40, 0xff, 0x04, 0xeb, 0x01, 0xff, 0x9b, 0xa8, 0xff, 0x8c, 0xac, 0xff, 0xa5, 0xcf, 0xff, 0xb6, 0x50, 0xff, 0x83, 0xbe, 0x70, 0xff, 0x01, 0xb6, 0x70, 
+  0xff, 0xbe, 0x70, 0xff, 0x81, 0xb6, 0x70, 0xff, 0x01, 0xbe, 0x71, 0xff, 0xe7, 0x1b, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x02, 0xf7, 0x9e, 0xe4, 0x00, 0x00, 0x0b, 0xe7, 0x1c, 0x70, 0x82, 0xf7, 0xbe, 
+  0xff, 0x00, 0xc6, 0x74, 0xff, 0x88, 0xb6, 0x70, 0xff, 0x06, 0xce, 0x54, 0xff, 0xee, 0xb9, 0xff, 0xd6, 0x16, 0xff, 0xad, 0x32, 0xff, 0xac, 0xaa, 0xff, 0xdb, 0x85, 0xff, 0xfb, 0x20, 0xff, 0x95, 
+  0xfb, 0x40, 0xff, 0x05, 0xfb, 0x20, 0xff, 0xd3, 0x24, 0xff, 0x83, 0xe9, 0xff, 0x8c, 0xcc, 0xff, 0xad, 0xcf, 0xff, 0xb6, 0x50, 0xff, 0x81, 0xbe, 0x70, 0xff, 0x87, 0xb6, 0x70, 0xff, 0x00, 0xe7, 
+  0x1b, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0x02, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 0xe6, 0xfc, 0x70, 0x82, 0xf7, 0xbe, 0xff, 0x00, 0xc6, 0x73, 0xff, 0x87, 0xb6, 0x70, 0xff, 0x09, 0xb6, 0x50, 0xff, 
+  0xde, 0x96, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x75, 0xff, 0xef, 0x50, 0xff, 0xd6, 0x6e, 0xff, 0xad, 0x4b, 0xff, 0xab, 0xa9, 0xff, 0xe3, 0x03, 0xff, 0xfb, 0x20, 0xff, 0x91, 0xfb, 0x40, 0xff, 0x06, 
+  0xfb, 0x20, 0xff, 0xdb, 0x03, 0xff, 0x9b, 0x88, 0xff, 0x7c, 0x4b, 0xff, 0x95, 0x2d, 0xff, 0xad, 0xef, 0xff, 0xb6, 0x50, 0xff, 0x8a, 0xb6, 0x70, 0xff, 0x06, 0xe7, 0x1b, 0xff, 0xf7, 0xbe, 0xff, 
+  0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 0xe6, 0xfc, 0x70, 0xf7, 0xbe, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x00, 0xc6, 0x73, 0xff, 0x83, 0xb6, 0x70, 0xff, 0x00, 0xb6, 0x50, 0xff, 0x81, 
+  0xb6, 0x70, 0xff, 0x0d, 0xb6, 0x50, 0xff, 0xde, 0x76, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x75, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xb0, 0xff, 0xcd, 0xf0, 0xff, 0xac, 0xce, 0xff, 0xa5, 
+  0x0a, 0xff, 0xb4, 0x28, 0xff, 0xdb, 0x64, 0xff, 0xf3, 0x00, 0xff, 0xfb, 0x20, 0xff, 0x8b, 0xfb, 0x40, 0xff, 0x0c, 0xfb, 0x20, 0xff, 0xf3, 0x00, 0xff, 0xd3, 0x26, 0xff, 0xa3, 0x8b, 0xff, 0x74, 
+  0x0a, 0xff, 0x8c, 0xcc, 0xff, 0xa5, 0xae, 0xff, 0xb6, 0x2f, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x4f, 0xff, 0x81, 0xb6, 0x70, 0xff, 0x06, 0xb6, 
+  0x50, 0xff, 0xb6, 0x4f, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x51, 0xff, 0xe7, 0x1b, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 0xe6, 
+  0xfc, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xc6, 0x73, 0xff, 0x85, 0xb6, 0x4f, 0xff, 0x04, 0xb6, 0x50, 0xff, 0xde, 0x76, 0xff, 0xee, 0xd9, 0xff, 0xe6, 0x75, 0xff, 0xff, 0xb0, 0xff, 0x81, 0xff, 
+  0xf0, 0xff, 0x0a, 0xe6, 0xd2, 0xff, 0xde, 0x53, 0xff, 0xf7, 0x6f, 0xff, 0xde, 0xee, 0xff, 0xc5, 0xec, 0xff, 0x8c, 0x0c, 0xff, 0x8b, 0x8c, 0xff, 0xab, 0x29, 0xff, 0xcb, 0x27, 0xff, 0xe3, 0x03, 
+  0xff, 0xfb, 0x00, 0xff, 0x85, 0xfb, 0x20, 0xff, 0x08, 0xfb, 0x00, 0xff, 0xe2, 0xe2, 0xff, 0xcb, 0x48, 0xff, 0xb3, 0xed, 0xff, 0x9c, 0x50, 0xff, 0x94, 0x50, 0xff, 0xb5, 0x13, 0xff, 0xbd, 0xb3, 
+  0xff, 0xae, 0x0f, 0xff, 0x8a, 0xb6, 0x4f, 0xff, 0x04, 0xb6, 0x6f, 0xff, 0xb6, 0x70, 0xff, 0xb6, 0x50, 0xff, 0xae, 0x3a, 0xff, 0xe7, 0x1c, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x7e, 0xe4, 
+  0x00, 0x00, 0x0b, 0xe6, 0xfc, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xc6, 0x53, 0xff, 0x85, 0xb6, 0x4f, 0xff, 0x03, 0xde, 0x97, 0xff, 0xee, 0xfa, 0xff, 0xe6, 0x96, 0xff, 0xff, 0xb0, 0xff, 0x81, 
+  0xff, 0xf0, 0xff, 0x0c, 0xe6, 0xd2, 0xff, 0xde, 0x74, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xd0, 0xff, 0xd6, 0x11, 0xff, 0xc5, 0x94, 0xff, 0xac, 0xf2, 0xff, 0xa4, 0xd2, 0xff, 0x94, 
+  0x71, 0xff, 0x8c, 0x0f, 0xff, 0x93, 0xad, 0xff, 0xf3, 0x01, 0xff, 0x83, 0xfb, 0x20, 0xff, 0x09, 0xf3, 0x01, 0xff, 0x83, 0x6c, 0xff, 0x83, 0xae, 0xff, 0x8c, 0x0f, 0xff, 0xb5, 0x75, 0xff, 0xd6, 
+  0x7a, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0x78, 0xff, 0xee, 0xd9, 0xff, 0xde, 0x97, 0xff, 0x8b, 0xb6, 0x4f, 0xff, 0x03, 0xb6, 0x50, 0xff, 0xae, 0x3a, 0xff, 0xae, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0x81, 
+  0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 0xe6, 0xfc, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x00, 0xc6, 0x53, 0xff, 0x84, 0xb6, 0x4f, 0xff, 0x0d, 0xde, 0xb7, 0xff, 0xf7, 0x1b, 0xff, 
+  0xe6, 0x96, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xef, 0xff, 0xee, 0xf3, 0xff, 0xe6, 0x94, 0xff, 0xff, 0xcf, 0xff, 0xef, 0x4e, 0xff, 0xf7, 0xaf, 0xff, 0xde, 0x72, 0xff, 0xde, 0x58, 
+  0xff, 0xd6, 0x57, 0xff, 0x81, 0xde, 0x99, 0xff, 0x03, 0xd6, 0x58, 0xff, 0xcd, 0xf7, 0xff, 0xad, 0x34, 0xff, 0xbb, 0x6a, 0xff, 0x83, 0xfb, 0x20, 0xff, 0x0a, 0xbb, 0xac, 0xff, 0xad, 0x34, 0xff, 
+  0xbd, 0x74, 0xff, 0xcd, 0xd6, 0xff, 0xd6, 0x17, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xee, 0xd9, 0xff, 0xf7, 0x1b, 0xff, 0xde, 0xb8, 0xff, 0x89, 0xb6, 0x4f, 0xff, 0x01, 
+  0xb6, 0x50, 0xff, 0xae, 0x1a, 0xff, 0x81, 0xae, 0x1c, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 0xe6, 0xfc, 0x70, 0x82, 0xf7, 0x9e, 0xff, 
+  0x00, 0xc6, 0x73, 0xff, 0x83, 0xb6, 0x4f, 0xff, 0x03, 0xde, 0xd8, 0xff, 0xf7, 0x5c, 0xff, 0xe6, 0xd7, 0xff, 0xff, 0xaf, 0xff, 0x81, 0xff, 0xef, 0xff, 0x0f, 0xee, 0xf3, 0xff, 0xe6, 0x95, 0xff, 
+  0xff, 0xcf, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xcf, 0xff, 0xde, 0x73, 0xff, 0xde, 0x99, 0xff, 0xde, 0x78, 0xff, 0xe6, 0xda, 0xff, 0xef, 0x1b, 0xff, 0xee, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xda, 
+  0xff, 0xce, 0x17, 0xff, 0xa4, 0xd2, 0xff, 0xe3, 0x25, 0xff, 0x81, 0xfb, 0x20, 0xff, 0x04, 0xe3, 0x26, 0xff, 0xad, 0x14, 0xff, 0xde, 0x99, 0xff, 0xde, 0xba, 0xff, 0xde, 0x79, 0xff, 0x81, 0xde, 
+  0x99, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xff, 0xbe, 0xff, 0xee, 0xfa, 0xff, 0xf7, 0x5c, 0xff, 0xde, 0xd8, 0xff, 0x87, 0xb6, 0x4f, 0xff, 0x01, 0xae, 0x50, 0xff, 0xae, 0x1a, 0xff, 0x82, 0xae, 
+  0x1c, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xf7, 0x7e, 0xe4, 0x00, 0x00, 0x0b, 0xe6, 0xfc, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x07, 0xc6, 0x73, 0xff, 0xb6, 0x4f, 0xff, 0xae, 
+  0x4f, 0xff, 0xb6, 0x4f, 0xff, 0xe6, 0xf9, 0xff, 0xff, 0x7d, 0xff, 0xee, 0xf8, 0xff, 0xff, 0xcf, 0xff, 0x81, 0xff, 0xef, 0xff, 0x02, 0xef, 0x13, 0xff, 0xe6, 0xb5, 0xff, 0xff, 0xcf, 0xff, 0x81, 
+  0xff, 0xef, 0xff, 0x03, 0xef, 0x36, 0xff, 0xde, 0x78, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xda, 0xff, 0x82, 0xef, 0x1c, 0xff, 0x04, 0xe7, 0x1b, 0xff, 0xde, 0x99, 0xff, 0xde, 0xba, 0xff, 0xc5, 0xf7, 
+  0xff, 0xa4, 0x0f, 0xff, 0x81, 0xfb, 0x00, 0xff, 0x0e, 0xac, 0x70, 0xff, 0xd6, 0x58, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xba, 0xff, 0xde, 0x79, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfb, 
+  0xff, 0xff, 0xbe, 0xff, 0xe7, 0x3c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1b, 0xff, 0xff, 0x7d, 0xff, 0xe6, 0xf9, 0xff, 0xb6, 0x4f, 0xff, 0x82, 0xae, 0x4f, 0xff, 0x03, 0xb6, 0x4f, 0xff, 0xae, 0x4f, 
+  0xff, 0xae, 0x50, 0xff, 0xae, 0x1a, 0xff, 0x83, 0xae, 0x1c, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 0xde, 0xfb, 0x70, 0x82, 0xf7, 0x9e, 
+  0xff, 0x06, 0xc6, 0x73, 0xff, 0xae, 0x4e, 0xff, 0xb6, 0x4f, 0xff, 0xe7, 0x3a, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x19, 0xff, 0xff, 0xcf, 0xff, 0x81, 0xff, 0xef, 0xff, 0x01, 0xef, 0x14, 0xff, 0xe6, 
+  0xd6, 0xff, 0x82, 0xff, 0xef, 0xff, 0x02, 0xde, 0xb3, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x1c, 0xff, 0x81, 0xde, 0xba, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xef, 0x3c, 0xff, 0x00, 0xde, 0xba, 0xff, 
+  0x81, 0xe6, 0xfb, 0xff, 0x0a, 0xd6, 0x79, 0xff, 0xbd, 0xb6, 0xff, 0xcb, 0xab, 0xff, 0xc3, 0xab, 0xff, 0xbd, 0xd7, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0xda, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0x99, 0xff, 
+  0xff, 0xff, 0xff, 0xe6, 0xda, 0xff, 0x81, 0xde, 0xba, 0xff, 0x0b, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0x9e, 0xff, 0xef, 0x3c, 0xff, 0xff, 0xbe, 0xff, 0xe7, 0x1a, 0xff, 0xae, 0x2f, 0xff, 
+  0xae, 0x4e, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x4e, 0xff, 0xae, 0x30, 0xff, 0xae, 0x1a, 0xff, 0x84, 0xae, 0x1c, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xef, 0x7d, 0xe4, 0x00, 
+  0x00, 0x0b, 0xde, 0xfb, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x09, 0xc6, 0x73, 0xff, 0xae, 0x4f, 0xff, 0xe7, 0x3b, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x39, 0xff, 0xff, 0xcf, 0xff, 0xf7, 0x6e, 0xff, 0xff, 
+  0xef, 0xff, 0xef, 0x34, 0xff, 0xee, 0xf7, 0xff, 0x82, 0xff, 0xef, 0xff, 0x08, 0xde, 0xb4, 0xff, 0xe7, 0x1b, 0xff, 0xde, 0x99, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xe6, 
+  0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x02, 0xde, 0xdb, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xdb, 0xff, 0x81, 0xad, 0x55, 0xff, 0x04, 0xde, 0xba, 0xff, 0xe6, 0xfb, 
+  0xff, 0xe7, 0x1c, 0xff, 0xde, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x81, 0xe6, 0xfb, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x0a, 0xe6, 0xda, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbe, 0xff, 0xf7, 
+  0x5c, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x5b, 0xff, 0xae, 0x4f, 0xff, 0xae, 0x4e, 0xff, 0xae, 0x2f, 0xff, 0xae, 0x1a, 0xff, 0x83, 0xae, 0x1c, 0xff, 0x02, 0xad, 0xfb, 0xff, 0xa5, 0xfb, 0xff, 0xe7, 
+  0x1c, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 0xde, 0xfb, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x08, 0xc6, 0x74, 0xff, 0xef, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5a, 
+  0xff, 0xff, 0xaf, 0xff, 0xef, 0x4e, 0xff, 0xff, 0xef, 0xff, 0xef, 0x35, 0xff, 0xef, 0x17, 0xff, 0x82, 0xff, 0xef, 0xff, 0x01, 0xde, 0xb4, 0xff, 0xe7, 0x1c, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x04, 
+  0xde, 0xba, 0xff, 0xff, 0xdf, 0xff, 0xe6, 0xda, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0x81, 0xe7, 0x3c, 0xff, 0x0b, 0xe6, 0xfb, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 
+  0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x3c, 0xff, 0xde, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0x83, 0xe7, 0x3c, 0xff, 0x0f, 0xe6, 0xdb, 0xff, 
+  0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9d, 0xff, 0xef, 0x5c, 0xff, 0xff, 0x9e, 0xff, 0xde, 0xd9, 0xff, 0xb6, 0x31, 0xff, 0xbe, 0x52, 0xff, 0xc6, 0x58, 0xff, 0xce, 0x7b, 0xff, 0xce, 0xbb, 
+  0xff, 0xd6, 0xdb, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0x82, 0xf7, 0x9e, 0xff, 0x02, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 0xde, 0xfb, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x07, 
+  0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5a, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xee, 0xff, 0xff, 0xce, 0xff, 0xef, 0x34, 0xff, 0xef, 0x17, 0xff, 0x82, 0xff, 0xef, 0xff, 0x01, 0xde, 0xb4, 0xff, 
+  0xe7, 0x1c, 0xff, 0x83, 0xe7, 0x3c, 0xff, 0x01, 0xde, 0xba, 0xff, 0xde, 0xdb, 0xff, 0x82, 0xe7, 0x3c, 0xff, 0x00, 0xde, 0xfb, 0xff, 0x83, 0xef, 0x7d, 0xff, 0x06, 0xef, 0x3d, 0xff, 0xe7, 0x1c, 
+  0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x58, 0xff, 0xde, 0xba, 0xff, 0x82, 0xe6, 0xfb, 0xff, 0x00, 0xe7, 0x1b, 0xff, 0x81, 0xe7, 0x1c, 0xff, 0x03, 0xe7, 0x1b, 0xff, 
+  0xef, 0x5c, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0x8d, 0xf7, 0x9e, 0xff, 0x02, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 0xde, 0xfb, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x06, 0xf7, 0x7d, 0xff, 0xf7, 
+  0x5a, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xee, 0xff, 0xef, 0x34, 0xff, 0xee, 0xf7, 0xff, 0x82, 0xff, 0xef, 0xff, 0x01, 0xde, 0xb4, 0xff, 0xe7, 0x1c, 0xff, 0x84, 0xe7, 0x3c, 0xff, 
+  0x00, 0xe7, 0x1c, 0xff, 0x81, 0xe6, 0xfb, 0xff, 0x04, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xde, 0xda, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x1c, 0xff, 0x81, 0xef, 0x3c, 0xff, 0x00, 0xe7, 0x1b, 0xff, 
+  0x81, 0xef, 0x3c, 0xff, 0x01, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0x99, 0xf7, 0x9e, 0xff, 0x02, 0xef, 0x7d, 0xe4, 0x00, 0x00, 0x0b, 0xde, 0xfb, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x01, 0xe6, 0xd8, 
+  0xff, 0xff, 0xcf, 0xff, 0x81, 0xff, 0xef, 0xff, 0x05, 0xef, 0x34, 0xff, 0xe6, 0xd7, 0xff, 0xf7, 0x8e, 0xff, 0xf7, 0x8f, 0xff, 0xf7, 0x90, 0xff, 0xde, 0xb4, 0xff, 0x81, 0xe6, 0xfb, 0xff, 0x81, 
+  0xe7, 0x1b, 0xff, 0x00, 0xe7, 0x1c, 0xff, 0x81, 0xef, 0x3c, 0xff, 0x01, 0xef, 0x5c, 0xff, 0xf7, 0x7d, 0xff, 0xa1, 0xf7, 0x9e, 0xff, 0x07, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xe7, 0x1c, 0xdb, 
+  0xde, 0xfb, 0xcb, 0xde, 0xdb, 0xbb, 0xde, 0xbb, 0x97, 0x00, 0x00, 0x08, 0xde, 0xfb, 0x70, 0x82, 0xf7, 0x9e, 0xff, 0x06, 0xef, 0x59, 0xff, 0xef, 0x58, 0xff, 0xef, 0x59, 0xff, 0xef, 0x3a, 0xff, 
+  0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x7d, 0xff, 0xa0, 0xf7, 0x9e, 0xff, 0x14, 0xf7, 0x9e, 0xfc, 0xef, 0x5d, 0xf0, 0xe7, 0x3c, 0xe3, 0xe6, 0xfc, 0xd3, 0xde, 0xdb, 0xc3, 0xde, 0xdb, 0xb3, 
+  0xde, 0xdb, 0xa3, 0xd6, 0x9a, 0x90, 0xc6, 0x38, 0x7f, 0xb5, 0x96, 0x6c, 0x9c, 0xd3, 0x58, 0x7b, 0xaf, 0x44, 0x39, 0xa7, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 
+  0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x70, 0x9e, 0xf7, 0x9e, 0xff, 0x15, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xe7, 0x1c, 0xdb, 0xde, 0xfb, 0xcb, 0xde, 0xdb, 
+  0xbb, 0xde, 0xdb, 0xab, 0xde, 0xdb, 0x98, 0xce, 0x79, 0x88, 0xbd, 0xd7, 0x77, 0xad, 0x35, 0x63, 0x8c, 0x51, 0x4f, 0x5a, 0xcb, 0x3c, 0x10, 0x62, 0x2b, 0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 
+  0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x70, 
+  0x91, 0xf7, 0x9e, 0xff, 0x13, 0xf7, 0x9e, 0xfc, 0xef, 0x5d, 0xf0, 0xe7, 0x3c, 0xe3, 0xe6, 0xfc, 0xd3, 0xde, 0xdb, 0xc3, 0xde, 0xdb, 0xb3, 0xde, 0xdb, 0xa3, 0xd6, 0x9a, 0x90, 0xc6, 0x38, 0x7f, 
+  0xb5, 0x96, 0x6c, 0x9c, 0xd3, 0x58, 0x7b, 0xaf, 0x44, 0x39, 0xa7, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 
+  0x0b, 0x81, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x94, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfb, 0x70, 0x85, 0xf7, 0x9e, 0xff, 0x15, 0xf7, 0x7e, 0xf8, 0xef, 0x5d, 0xe8, 0xe7, 
+  0x1c, 0xdb, 0xde, 0xfb, 0xcb, 0xde, 0xdb, 0xbb, 0xde, 0xdb, 0xab, 0xde, 0xdb, 0x98, 0xce, 0x79, 0x88, 0xbd, 0xd7, 0x77, 0xad, 0x35, 0x63, 0x8c, 0x51, 0x4f, 0x5a, 0xeb, 0x3c, 0x10, 0x62, 0x2b, 
+  0x00, 0x00, 0x23, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0xa0, 
+  0x00, 0x00, 0x00, 0x0d, 0xce, 0x59, 0x43, 0xd6, 0xba, 0x8f, 0xc6, 0x38, 0x7f, 0xb5, 0x96, 0x6c, 0x9c, 0xd3, 0x58, 0x7b, 0xaf, 0x44, 0x39, 0xa7, 0x33, 0x00, 0x00, 0x27, 0x00, 0x00, 0x20, 0x00, 
+  0x00, 0x1b, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x03, 0xb9, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x62, 0x8e, 0xaa, 0x0c, 0x61, 0x8c, 0xa8, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x51, 0xa1, 0xe4, 0x27, 0x5f, 0xb4, 0xf8, 0x68, 0x69, 0xba, 0xf9, 0x9f, 0x73, 0xc1, 0xfb, 0xcb, 0x7d, 0xc8, 0xfd, 0xe8, 0x87, 0xcf, 0xff, 0xfc, 0x8f, 0xd3, 0xff, 0xff, 0x91, 0xd4, 0xff, 0xff, 0x8b, 0xd1, 0xff, 0xfc, 0x84, 0xcc, 0xfd, 0xe8, 0x7d, 0xc7, 0xfb, 0xc8, 0x75, 0xc2, 0xf9, 0x9f, 0x6e, 0xbd, 0xf8, 0x67, 0x61, 0xab, 0xe4, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x8f, 0xdd, 0x1b, 0x43, 0xa4, 0xf7, 0x7b, 0x4e, 0xab, 0xfc, 0xd4, 0x51, 0xaf, 0xff, 0xff, 0x4a, 0xa7, 0xff, 0xff, 0x42, 0x9e, 0xff, 0xff, 0x2d, 0x94, 0xff, 0xff, 0x19, 0x8b, 0xff, 0xff, 0x0a, 0x85, 0xff, 0xff, 0x06, 0x84, 0xff, 0xff, 0x06, 0x84, 0xff, 0xff, 0x0b, 0x86, 0xff, 0xff, 0x1a, 0x8c, 0xff, 0xff, 0x31, 0x96, 0xff, 0xff, 0x4a, 0xa2, 0xff, 0xff, 0x56, 0xad, 0xff, 0xff, 0x61, 0xb8, 0xff, 0xff, 0x62, 0xb7, 0xfc, 0xd3, 0x5a, 0xb0, 0xf7, 0x78, 0x4c, 0x9a, 0xdc, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x86, 0xe0, 0x1f, 0x32, 0x99, 0xf8, 0x9b, 0x38, 0xa0, 0xfe, 0xf8, 0x31, 0x99, 0xff, 0xff, 0x19, 0x8b, 0xff, 0xff, 0x01, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x02, 0x81, 0xff, 0xff, 0x21, 0x8f, 0xff, 0xff, 0x42, 0xa1, 0xff, 0xff, 0x51, 0xae, 0xfe, 0xf7, 0x4e, 0xaa, 0xf8, 0x97, 0x41, 0x97, 0xe0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x5d, 0xa7, 0x08, 0x1f, 0x8d, 0xf6, 0x7c, 0x26, 0x95, 0xfe, 0xf4, 0x1d, 0x8e, 0xff, 0xff, 0x04, 0x82, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x06, 0x83, 0xff, 0xff, 0x30, 0x97, 0xff, 0xff, 0x43, 0xa6, 0xfe, 0xf4, 0x40, 0xa0, 0xf5, 0x78, 0x23, 0x5f, 0x94, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x03, 0x04, 0x01, 0x05, 0x0c, 0x04, 0x03, 0x08, 0x17, 0x04, 0x05, 0x0b, 0x1e, 0x04, 0x06, 0x0f, 0x28, 0x04, 0x07, 0x11, 0x2e, 0x04, 0x08, 0x14, 0x36, 0x04, 0x08, 0x15, 0x3a, 0x04, 0x0d, 0x79, 0xe3, 0x2b, 0x16, 0x8a, 0xfb, 0xcc, 0x14, 0x8a, 0xff, 0xff, 0x03, 0x82, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x06, 0x83, 0xff, 0xff, 0x2d, 0x97, 0xff, 0xff, 0x39, 0x9f, 0xfb, 0xcb, 0x2f, 0x8c, 0xe1, 0x27, 0x08, 0x15, 0x39, 0x04, 0x08, 0x13, 0x34, 0x04, 0x07, 0x11, 0x2d, 0x04, 0x05, 0x0e, 0x26, 0x04, 0x04, 0x0b, 0x1d, 0x04, 0x03, 0x07, 0x14, 0x04, 0x01, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0xef, 0xef, 0xef, 0x68, 0xfc, 0xfc, 0xfc, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xcf, 0xe0, 0xfc, 0xff, 0x27, 0x90, 0xff, 0xff, 0x05, 0x83, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x15, 0x89, 0xff, 0xff, 0x44, 0xa2, 0xff, 0xff, 0xd5, 0xe5, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xf9, 0xf9, 0xf9, 0xe3, 0x00, 0x00, 0x00, 0x07, 
-  0xe4, 0xe4, 0xe4, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xb8, 0xd0, 0xf5, 0xff, 0x12, 0x88, 0xff, 0xff, 0x01, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x05, 0x83, 0xff, 0xff, 0x2b, 0x96, 0xff, 0xff, 0xbe, 0xd5, 0xf5, 0xff, 0xf1, 0xf1, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe3, 0xe3, 0xe3, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf1, 0xf1, 0xff, 0xba, 0xd1, 0xf4, 0xff, 0x0e, 0x87, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x02, 0x81, 0xff, 0xff, 0x21, 0x90, 0xff, 0xff, 0xc0, 0xd5, 0xf4, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe3, 0xe3, 0xe3, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xe1, 0xe6, 0xea, 0xff, 0xde, 0xe4, 0xe9, 0xff, 0xde, 0xe4, 0xe9, 0xff, 0xdc, 0xe2, 0xe6, 0xff, 0xe0, 0xe5, 0xea, 0xff, 0xdf, 0xe5, 0xea, 0xff, 0xdf, 0xe5, 0xea, 0xff, 0xdf, 0xe5, 0xea, 0xff, 0xdf, 0xe5, 0xea, 0xff, 0xc1, 0xd3, 0xee, 0xff, 0x15, 0x89, 0xfe, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0x81, 0xff, 0xff, 0x23, 0x90, 0xfe, 0xff, 0xc4, 0xd4, 0xed, 0xff, 0xde, 0xe4, 0xe9, 0xff, 0xcf, 0xe0, 0xe5, 0xff, 0xcb, 0xe7, 0xea, 0xff, 0xcb, 0xe7, 0xea, 0xff, 0xcb, 0xe7, 0xea, 0xff, 0xd6, 0xdf, 0xe4, 0xff, 0xcd, 0xe0, 0xe5, 0xff, 0xcb, 0xe7, 0xea, 0xff, 0xe8, 0xed, 0xee, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe3, 0xe3, 0xe3, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd9, 0xe3, 0xec, 0xff, 0xe6, 0xef, 0xf9, 0xff, 0xe7, 0xef, 0xf9, 0xff, 0xe4, 0xec, 0xf6, 0xff, 0xe1, 0xe8, 0xf0, 0xff, 0xee, 0xf4, 0xfb, 0xff, 0xee, 0xf4, 0xfb, 0xff, 0xee, 0xf4, 0xfb, 0xff, 0xdb, 0xe9, 0xf8, 0xff, 0x34, 0x92, 0xfe, 0xff, 0x01, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x79, 0xf8, 0xff, 0x16, 0x76, 0xe6, 0xff, 0x24, 0x71, 0xcd, 0xff, 0x2d, 0x78, 0xc2, 0xff, 0x2f, 0x79, 0xb9, 0xff, 0x2e, 0x77, 0xb8, 0xff, 0x40, 0x6d, 0xbf, 0xff, 0x37, 0x74, 0xd0, 0xff, 0x11, 0x75, 0xe9, 0xff, 0x00, 0x7a, 0xf9, 0xff, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x02, 0x80, 0xff, 0xff, 0x3d, 0x96, 0xfd, 0xff, 0xb1, 0xd3, 0xe7, 0xff, 0x7b, 0xf5, 0xf9, 0xff, 0x77, 0xfe, 0xff, 0xff, 0x78, 0xfe, 0xff, 0xff, 0x99, 0xdf, 0xe8, 0xff, 0xab, 0xd6, 0xe2, 0xff, 0x75, 0xfa, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0xd6, 0xe5, 0xe9, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe3, 0xe3, 0xe3, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd8, 0xe2, 0xeb, 0xff, 0xe5, 0xee, 0xf8, 0xff, 0xe5, 0xee, 0xf8, 0xff, 0xe5, 0xee, 0xf8, 0xff, 0xe2, 0xec, 0xf6, 0xff, 0xdf, 0xe6, 0xef, 0xff, 0xed, 0xf3, 0xfa, 0xff, 0xeb, 0xf1, 0xf8, 0xff, 0x73, 0xab, 0xfb, 0xff, 0x02, 0x81, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xfe, 0xff, 0x0c, 0x77, 0xef, 0xff, 0x52, 0x79, 0xc4, 0xff, 0x6c, 0x7d, 0x97, 0xff, 0x86, 0x8b, 0x91, 0xff, 0x86, 0x8f, 0x97, 0xff, 0x5a, 0x97, 0x9d, 0xff, 0x57, 0xaa, 0xab, 0xff, 0x55, 0xa9, 0xab, 0xff, 0x55, 0x9c, 0xa0, 0xff, 0x7f, 0x89, 0x92, 0xff, 0x84, 0x89, 0x90, 0xff, 0x65, 0x79, 0x99, 0xff, 0x4b, 0x77, 0xc8, 0xff, 0x06, 0x78, 0xf2, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x40, 0xb1, 0xfc, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x79, 0xfe, 0xff, 0xff, 0x98, 0xdd, 0xe8, 0xff, 0xa9, 0xd4, 0xe2, 0xff, 0x76, 0xfa, 0xfc, 0xff, 0x75, 0xff, 0xff, 0xff, 0x76, 0xfe, 0xfe, 0xff, 0xd6, 0xe3, 0xe6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd6, 0xe1, 0xeb, 0xff, 0xe3, 0xec, 0xf7, 0xff, 0xe3, 0xec, 0xf7, 0xff, 0xdd, 0xe7, 0xf3, 0xff, 0xe0, 0xea, 0xf5, 0xff, 0xe0, 0xea, 0xf5, 0xff, 0xdc, 0xe4, 0xed, 0xff, 0xb3, 0xce, 0xf6, 0xff, 0x05, 0x82, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0x7b, 0xf9, 0xff, 0x4e, 0x7a, 0xc8, 0xff, 0x83, 0x8c, 0x98, 0xff, 0x9b, 0xa0, 0xa6, 0xff, 0xb3, 0xb8, 0xbf, 0xff, 0xb9, 0xc0, 0xca, 0xff, 0xcd, 0xd5, 0xe0, 0xff, 0xc2, 0xd0, 0xde, 0xff, 0x7a, 0xd6, 0xde, 0xff, 0x77, 0xee, 0xf0, 0xff, 0x76, 0xea, 0xec, 0xff, 0x77, 0xd4, 0xda, 0xff, 0xab, 0xba, 0xc7, 0xff, 0xaa, 0xb2, 0xba, 0xff, 0x8d, 0x93, 0x9b, 0xff, 0x7d, 0x88, 0x98, 0xff, 0x46, 0x78, 0xce, 0xff, 0x00, 0x7c, 0xfb, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x05, 0x80, 0xff, 0xff, 0x5e, 0xd8, 0xf9, 0xff, 0x96, 0xdc, 0xe7, 0xff, 0xa8, 0xd3, 0xe2, 0xff, 0x79, 0xfa, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x75, 0xfe, 0xfe, 0xff, 0x93, 0xce, 0xd8, 0xff, 0xdc, 0xe1, 0xe4, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd5, 0xe0, 0xea, 0xff, 0xe1, 0xeb, 0xf6, 0xff, 0xe0, 0xeb, 0xf6, 0xff, 0xd4, 0xdc, 0xe6, 0xff, 0xd4, 0xdc, 0xe7, 0xff, 0xda, 0xe5, 0xf2, 0xff, 0xd6, 0xe2, 0xf0, 0xff, 0x36, 0x8e, 0xfa, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x13, 0x79, 0xee, 0xff, 0x71, 0x84, 0xab, 0xff, 0x9a, 0x9f, 0xa5, 0xff, 0xbb, 0xc1, 0xc7, 0xff, 0xd5, 0xdc, 0xe3, 0xff, 0xdb, 0xe2, 0xeb, 0xff, 0xda, 0xe4, 0xf1, 0xff, 0xdd, 0xe7, 0xf4, 0xff, 0xd4, 0xdd, 0xe9, 0xff, 0xec, 0xf1, 0xf5, 0xff, 0x8c, 0xec, 0xf2, 0xff, 0x7e, 0xfd, 0xff, 0xff, 0x7e, 0xfc, 0xfe, 0xff, 0x83, 0xe8, 0xf0, 0xff, 0xc7, 0xd6, 0xe5, 0xff, 0xca, 0xd4, 0xdf, 0xff, 0xa9, 0xb0, 0xba, 0xff, 0x96, 0x9b, 0xa0, 0xff, 0x68, 0x81, 0xb1, 0xff, 0x08, 0x7a, 0xf3, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x26, 0x8a, 0xf8, 0xff, 0xa1, 0xce, 0xde, 0xff, 0x79, 0xf9, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0xff, 0x77, 0xfe, 0xfe, 0xff, 0x92, 0xcd, 0xd8, 0xff, 0xc7, 0xd1, 0xdc, 0xff, 0xdc, 0xe1, 0xe5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcf, 0xda, 0xe4, 0xff, 0xdd, 0xe7, 0xf3, 0xff, 0xdf, 0xea, 0xf5, 0xff, 0xcd, 0xd8, 0xe5, 0xff, 0xfb, 0xfc, 0xfd, 0xff, 0xd4, 0xdd, 0xe8, 0xff, 0x96, 0xba, 0xef, 0xff, 0x02, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x1d, 0x7a, 0xec, 0xff, 0x7f, 0x8c, 0xa3, 0xff, 0xa9, 0xaf, 0xb6, 0xff, 0xce, 0xd5, 0xdd, 0xff, 0xe2, 0xe9, 0xf2, 0xff, 0xe0, 0xe8, 0xf2, 0xff, 0xdb, 0xe5, 0xf2, 0xff, 0xdb, 0xe7, 0xf4, 0xff, 0xd5, 0xde, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xcf, 0xdd, 0xff, 0x80, 0xe5, 0xed, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x75, 0xee, 0xf1, 0xff, 0x83, 0xe9, 0xf1, 0xff, 0xcc, 0xdc, 0xeb, 0xff, 0xd7, 0xe2, 0xee, 0xff, 0xbb, 0xc4, 0xcf, 0xff, 0xa4, 0xa9, 0xb0, 0xff, 0x77, 0x88, 0xa9, 0xff, 0x0d, 0x7a, 0xf2, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x02, 0x7c, 0xff, 0xff, 0x57, 0xce, 0xf7, 0xff, 0x78, 0xfc, 0xfd, 0xff, 0x78, 0xfd, 0xfe, 0xff, 0x91, 0xcc, 0xd7, 0xff, 0xc5, 0xd0, 0xdb, 0xff, 0xc3, 0xcd, 0xd7, 0xff, 0xdb, 0xe0, 0xe4, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd6, 0xe1, 0xe9, 0xff, 0xdb, 0xe5, 0xee, 0xff, 0xdb, 0xe6, 0xf2, 0xff, 0xdc, 0xe8, 0xf4, 0xff, 0xca, 0xd6, 0xe3, 0xff, 0xf4, 0xf5, 0xf6, 0xff, 0x3a, 0x8e, 0xf9, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x0d, 0x7c, 0xf3, 0xff, 0x7f, 0x8e, 0xa7, 0xff, 0xb0, 0xb6, 0xbe, 0xff, 0xd6, 0xde, 0xe6, 0xff, 0xe4, 0xed, 0xf6, 0xff, 0xdf, 0xe8, 0xf1, 0xff, 0xd8, 0xe4, 0xf1, 0xff, 0xda, 0xe6, 0xf3, 0xff, 0xd4, 0xdd, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xd7, 0xe2, 0xff, 0xc1, 0xcd, 0xdc, 0xff, 0xb6, 0xc5, 0xd6, 0xff, 0x7f, 0xe5, 0xec, 0xff, 0x76, 0xf0, 0xf3, 0xff, 0x77, 0xf0, 0xf3, 0xff, 0x82, 0xea, 0xf2, 0xff, 0xcb, 0xdc, 0xec, 0xff, 0xda, 0xe5, 0xf2, 0xff, 0xc2, 0xcc, 0xd8, 0xff, 0xa9, 0xb0, 0xb7, 0xff, 0x76, 0x89, 0xac, 0xff, 0x04, 0x7c, 0xf8, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x25, 0x95, 0xfb, 0xff, 0x76, 0xf6, 0xf8, 0xff, 0x90, 0xcb, 0xd8, 0xff, 0xc2, 0xce, 0xdb, 0xff, 0xc1, 0xcb, 0xd7, 0xff, 0xd1, 0xd8, 0xe1, 0xff, 0xdd, 0xe2, 0xe6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd8, 0xe1, 0xea, 0xff, 0xe5, 0xee, 0xf7, 0xff, 0xda, 0xe3, 0xed, 0xff, 0xd9, 0xe5, 0xf1, 0xff, 0xd9, 0xe5, 0xf3, 0xff, 0x9e, 0xbb, 0xe1, 0xff, 0x03, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x7e, 0xfd, 0xff, 0x6e, 0x88, 0xb7, 0xff, 0xae, 0xb4, 0xbb, 0xff, 0xd7, 0xde, 0xe8, 0xff, 0xe4, 0xec, 0xf6, 0xff, 0xde, 0xe7, 0xf1, 0xff, 0xd7, 0xe2, 0xf0, 0xff, 0xd8, 0xe4, 0xf3, 0xff, 0xd4, 0xdd, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xd7, 0xe2, 0xff, 0xc0, 0xcb, 0xdb, 0xff, 0xc1, 0xca, 0xd8, 0xff, 0xc0, 0xc9, 0xd7, 0xff, 0xb5, 0xc4, 0xd5, 0xff, 0x7f, 0xe5, 0xec, 0xff, 0x79, 0xf6, 0xf8, 0xff, 0x79, 0xf3, 0xf6, 0xff, 0x83, 0xea, 0xf2, 0xff, 0xc9, 0xdb, 0xeb, 0xff, 0xd8, 0xe5, 0xf3, 0xff, 0xc2, 0xcc, 0xd8, 0xff, 0xa3, 0xa9, 0xb1, 0xff, 0x5a, 0x7f, 0xbe, 0xff, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x03, 0x7b, 0xff, 0xff, 0x7c, 0xb3, 0xd7, 0xff, 0xc1, 0xcc, 0xda, 0xff, 0xbf, 0xc9, 0xd6, 0xff, 0xd1, 0xd8, 0xe1, 0xff, 0xd5, 0xdd, 0xe5, 0xff, 0xdd, 0xe2, 0xe6, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe1, 0xe1, 0xe1, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xd6, 0xe1, 0xea, 0xff, 0xe4, 0xed, 0xf6, 0xff, 0xe4, 0xed, 0xf6, 0xff, 0xd3, 0xde, 0xea, 0xff, 0xd5, 0xe2, 0xef, 0xff, 0x7c, 0xa7, 0xf2, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x45, 0x80, 0xdb, 0xff, 0xa2, 0xa9, 0xb0, 0xff, 0xd1, 0xd9, 0xe2, 0xff, 0xe2, 0xeb, 0xf5, 0xff, 0xdc, 0xe6, 0xf1, 0xff, 0xd5, 0xe1, 0xef, 0xff, 0xd5, 0xe3, 0xf2, 0xff, 0xd4, 0xdd, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xd7, 0xe2, 0xff, 0xbf, 0xcb, 0xda, 0xff, 0xbb, 0xc6, 0xd4, 0xff, 0xd0, 0xd9, 0xe3, 0xff, 0xd2, 0xda, 0xe4, 0xff, 0xbe, 0xc8, 0xd5, 0xff, 0xb3, 0xc3, 0xd4, 0xff, 0x7c, 0xe5, 0xec, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x83, 0xea, 0xf2, 0xff, 0xc7, 0xda, 0xeb, 0xff, 0xd6, 0xe3, 0xf1, 0xff, 0xbe, 0xc9, 0xd7, 0xff, 0x95, 0x9e, 0xa8, 0xff, 0x29, 0x79, 0xe2, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x73, 0x9d, 0xe8, 0xff, 0xbb, 0xc5, 0xd2, 0xff, 0xce, 0xd7, 0xe0, 0xff, 0xd4, 0xdc, 0xe5, 0xff, 0xd5, 0xdc, 0xe5, 0xff, 0xdc, 0xe1, 0xe5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcf, 0xda, 0xe4, 0xff, 0xe2, 0xec, 0xf6, 0xff, 0xd8, 0xe2, 0xed, 0xff, 0xd4, 0xe1, 0xef, 0xff, 0xcb, 0xd8, 0xe6, 0xff, 0x2b, 0x86, 0xf9, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x01, 0x7d, 0xfc, 0xff, 0x85, 0x96, 0xae, 0xff, 0xc3, 0xcb, 0xd5, 0xff, 0xdf, 0xe9, 0xf4, 0xff, 0xda, 0xe5, 0xf1, 0xff, 0xd3, 0xe0, 0xef, 0xff, 0xd4, 0xe2, 0xf1, 0xff, 0xd4, 0xdd, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xd6, 0xe1, 0xff, 0xbd, 0xc9, 0xd8, 0xff, 0xbd, 0xca, 0xd8, 0xff, 0xbf, 0xcb, 0xd9, 0xff, 0xc5, 0xcf, 0xda, 0xff, 0xd2, 0xdc, 0xe5, 0xff, 0xd0, 0xda, 0xe3, 0xff, 0xbc, 0xc7, 0xd4, 0xff, 0xb1, 0xc2, 0xd3, 0xff, 0x7c, 0xe4, 0xeb, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x82, 0xe9, 0xf1, 0xff, 0xc6, 0xd8, 0xea, 0xff, 0xd3, 0xdf, 0xee, 0xff, 0x96, 0xb0, 0xc0, 0xff, 0x43, 0x91, 0xb6, 0xff, 0x00, 0x7c, 0xfe, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x2a, 0x81, 0xf4, 0xff, 0xc4, 0xcd, 0xd6, 0xff, 0xd2, 0xdb, 0xe4, 0xff, 0xd3, 0xdc, 0xe5, 0xff, 0xd3, 0xdc, 0xe4, 0xff, 0xdc, 0xe1, 0xe5, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe1, 0xe1, 0xe1, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcb, 0xd8, 0xe4, 0xff, 0xcf, 0xdb, 0xe7, 0xff, 0xd2, 0xe0, 0xee, 0xff, 0xd1, 0xdf, 0xed, 0xff, 0xb2, 0xc6, 0xde, 0xff, 0x02, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x40, 0x81, 0xe0, 0xff, 0xab, 0xb2, 0xbb, 0xff, 0xd7, 0xe0, 0xeb, 0xff, 0xd9, 0xe3, 0xef, 0xff, 0xd1, 0xdf, 0xee, 0xff, 0xd2, 0xe0, 0xf0, 0xff, 0xd3, 0xdc, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xd5, 0xe0, 0xff, 0xbb, 0xc9, 0xd7, 0xff, 0xbe, 0xc9, 0xd4, 0xff, 0xc4, 0xce, 0xd9, 0xff, 0xc2, 0xcc, 0xd7, 0xff, 0xd1, 0xdb, 0xe4, 0xff, 0xd1, 0xda, 0xe4, 0xff, 0xd1, 0xda, 0xe4, 0xff, 0xd0, 0xd9, 0xe3, 0xff, 0xbb, 0xc6, 0xd4, 0xff, 0xb0, 0xc1, 0xd3, 0xff, 0x7e, 0xe4, 0xeb, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x7e, 0xfd, 0xff, 0xff, 0x81, 0xe9, 0xf1, 0xff, 0xa6, 0xcc, 0xe0, 0xff, 0x77, 0xe5, 0xe9, 0xff, 0x5d, 0xb9, 0xba, 0xff, 0x16, 0x7f, 0xea, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x02, 0x77, 0xff, 0xff, 0xa2, 0xb5, 0xcb, 0xff, 0xce, 0xd7, 0xe1, 0xff, 0xd1, 0xda, 0xe4, 0xff, 0xce, 0xd7, 0xe0, 0xff, 0xdb, 0xe0, 0xe4, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe1, 0xe1, 0xe1, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcb, 0xd9, 0xe6, 0xff, 0xd3, 0xe1, 0xf0, 0xff, 0xd0, 0xde, 0xed, 0xff, 0xd2, 0xdd, 0xe9, 0xff, 0xa0, 0xbc, 0xe8, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x6e, 0x8b, 0xc0, 0xff, 0xc3, 0xcb, 0xd5, 0xff, 0xd6, 0xe0, 0xec, 0xff, 0xcf, 0xdd, 0xed, 0xff, 0xd0, 0xdf, 0xef, 0xff, 0xd2, 0xdb, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfb, 0xfc, 0xff, 0xb4, 0xc2, 0xd1, 0xff, 0xb8, 0xc5, 0xd4, 0xff, 0xc7, 0xd1, 0xdc, 0xff, 0xd1, 0xda, 0xe3, 0xff, 0xd0, 0xda, 0xe3, 0xff, 0xd1, 0xda, 0xe3, 0xff, 0xd0, 0xda, 0xe4, 0xff, 0xd0, 0xda, 0xe4, 0xff, 0xd0, 0xda, 0xe4, 0xff, 0xce, 0xd8, 0xe3, 0xff, 0xb9, 0xc5, 0xd3, 0xff, 0xad, 0xc0, 0xd2, 0xff, 0x7d, 0xe4, 0xeb, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x7e, 0xfd, 0xff, 0xff, 0x7e, 0xfc, 0xfe, 0xff, 0x7b, 0xf5, 0xf7, 0xff, 0x6b, 0xd5, 0xd7, 0xff, 0x3b, 0x86, 0xca, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x88, 0xa7, 0xd5, 0xff, 0xb9, 0xc5, 0xd2, 0xff, 0xca, 0xd4, 0xde, 0xff, 0xb9, 0xc5, 0xd2, 0xff, 0xda, 0xe0, 0xe4, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe1, 0xe1, 0xe1, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xc9, 0xd8, 0xe6, 0xff, 0xce, 0xdc, 0xec, 0xff, 0xd3, 0xde, 0xeb, 0xff, 0xda, 0xe4, 0xf0, 0xff, 0x8f, 0xab, 0xea, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xfe, 0xff, 0x8c, 0x9d, 0xb3, 0xff, 0xc0, 0xcc, 0xda, 0xff, 0xcd, 0xdb, 0xed, 0xff, 0xce, 0xdd, 0xee, 0xff, 0xd1, 0xdb, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xd5, 0xe1, 0xff, 0xd6, 0xdc, 0xe4, 0xff, 0xf6, 0xf7, 0xf9, 0xff, 0xb4, 0xc1, 0xd0, 0xff, 0xb8, 0xc5, 0xd4, 0xff, 0xc6, 0xd0, 0xdb, 0xff, 0xcf, 0xd9, 0xe3, 0xff, 0xd0, 0xd9, 0xe3, 0xff, 0xcf, 0xd9, 0xe3, 0xff, 0xcf, 0xd9, 0xe3, 0xff, 0xcf, 0xd9, 0xe4, 0xff, 0xcf, 0xd8, 0xe4, 0xff, 0xcd, 0xd7, 0xe3, 0xff, 0xb6, 0xc2, 0xd2, 0xff, 0xad, 0xbf, 0xd2, 0xff, 0x7a, 0xe5, 0xed, 0xff, 0x7e, 0xfd, 0xff, 0xff, 0x75, 0xeb, 0xef, 0xff, 0x7e, 0xfa, 0xfc, 0xff, 0x82, 0xc8, 0xd6, 0xff, 0x63, 0x88, 0xae, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x78, 0x99, 0xdc, 0xff, 0xb7, 0xc4, 0xd4, 0xff, 0xb5, 0xc3, 0xd2, 0xff, 0xbb, 0xc9, 0xd8, 0xff, 0xda, 0xdf, 0xe4, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe0, 0xe0, 0xe0, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xc4, 0xd3, 0xe0, 0xff, 0xcf, 0xdc, 0xe8, 0xff, 0xdc, 0xe7, 0xf3, 0xff, 0xd5, 0xe0, 0xeb, 0xff, 0x75, 0x9c, 0xeb, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x0f, 0x7a, 0xf1, 0xff, 0x9e, 0xab, 0xba, 0xff, 0xc8, 0xd7, 0xe9, 0xff, 0xcb, 0xda, 0xed, 0xff, 0xcf, 0xd9, 0xe6, 0xff, 0xdf, 0xe0, 0xe2, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xcb, 0xd4, 0xe0, 0xff, 0xb6, 0xc4, 0xd6, 0xff, 0xaf, 0xbe, 0xd1, 0xff, 0xd4, 0xdb, 0xe3, 0xff, 0xf4, 0xf5, 0xf7, 0xff, 0xb3, 0xc0, 0xcf, 0xff, 0xb5, 0xc2, 0xd1, 0xff, 0xc5, 0xce, 0xda, 0xff, 0xcd, 0xd7, 0xe1, 0xff, 0xcd, 0xd6, 0xe1, 0xff, 0xcd, 0xd6, 0xe1, 0xff, 0xcd, 0xd6, 0xe2, 0xff, 0xcc, 0xd7, 0xe2, 0xff, 0xc0, 0xcb, 0xd8, 0xff, 0xb4, 0xc2, 0xd4, 0xff, 0x9a, 0xbd, 0xd0, 0xff, 0x7a, 0xf1, 0xf5, 0xff, 0x6c, 0xdc, 0xe1, 0xff, 0x7c, 0xf9, 0xfc, 0xff, 0x7d, 0xfb, 0xfd, 0xff, 0x79, 0xe1, 0xe9, 0xff, 0x5e, 0xb9, 0xbe, 0xff, 0x01, 0x79, 0xfc, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x65, 0x8c, 0xde, 0xff, 0xaf, 0xbd, 0xcd, 0xff, 0xb7, 0xc5, 0xd6, 0xff, 0xb8, 0xc7, 0xd7, 0xff, 0xd8, 0xde, 0xe3, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xee, 0xee, 0xee, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xda, 0xda, 0xda, 0x70, 0xeb, 0xeb, 0xeb, 0xff, 0xea, 0xea, 0xea, 0xff, 0xea, 0xea, 0xea, 0xff, 0xc6, 0xd2, 0xdd, 0xff, 0xd6, 0xe1, 0xec, 0xff, 0xd5, 0xe1, 0xed, 0xff, 0xcc, 0xd7, 0xe2, 0xff, 0x5d, 0x90, 0xeb, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x36, 0x84, 0xeb, 0xff, 0xa5, 0xaf, 0xbc, 0xff, 0xbc, 0xcc, 0xe1, 0xff, 0xc9, 0xd4, 0xe2, 0xff, 0xe6, 0xe7, 0xe9, 0xff, 0xf2, 0xf2, 0xf4, 0xff, 0xc5, 0xce, 0xda, 0xff, 0xae, 0xbd, 0xd0, 0xff, 0xb1, 0xbd, 0xcc, 0xff, 0xae, 0xbc, 0xcc, 0xff, 0xaa, 0xb9, 0xcb, 0xff, 0xcf, 0xd5, 0xdd, 0xff, 0xee, 0xef, 0xf1, 0xff, 0xac, 0xb9, 0xc8, 0xff, 0xae, 0xbc, 0xcb, 0xff, 0xbf, 0xc9, 0xd4, 0xff, 0xc6, 0xd1, 0xdb, 0xff, 0xc7, 0xd1, 0xdb, 0xff, 0xc7, 0xd1, 0xdc, 0xff, 0xbb, 0xc6, 0xd3, 0xff, 0xae, 0xbc, 0xce, 0xff, 0x95, 0xb7, 0xca, 0xff, 0x76, 0xec, 0xf0, 0xff, 0x78, 0xf5, 0xf7, 0xff, 0x79, 0xf4, 0xf6, 0xff, 0x78, 0xe7, 0xee, 0xff, 0x7a, 0xf5, 0xf8, 0xff, 0x78, 0xf1, 0xf4, 0xff, 0x63, 0xc7, 0xca, 0xff, 0x0b, 0x7d, 0xf3, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x50, 0x84, 0xe1, 0xff, 0xaa, 0xb7, 0xc8, 0xff, 0xb1, 0xc0, 0xd1, 0xff, 0xb2, 0xc1, 0xd1, 0xff, 0xd3, 0xd9, 0xde, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xd4, 0xd4, 0xd4, 0x70, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xc4, 0xd0, 0xdb, 0xff, 0xce, 0xda, 0xe6, 0xff, 0xce, 0xd9, 0xe6, 0xff, 0xc2, 0xce, 0xda, 0xff, 0x50, 0x8a, 0xe9, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x38, 0x80, 0xe4, 0xff, 0xcf, 0xd0, 0xd3, 0xff, 0xd1, 0xd7, 0xe0, 0xff, 0xea, 0xeb, 0xed, 0xff, 0xec, 0xed, 0xee, 0xff, 0xbf, 0xc9, 0xd6, 0xff, 0xa8, 0xb7, 0xcb, 0xff, 0xab, 0xb8, 0xc8, 0xff, 0xbf, 0xc9, 0xd6, 0xff, 0xba, 0xc5, 0xd1, 0xff, 0xa8, 0xb6, 0xc6, 0xff, 0xa4, 0xb3, 0xc4, 0xff, 0xc9, 0xd0, 0xd6, 0xff, 0xe8, 0xe9, 0xeb, 0xff, 0xa1, 0xaf, 0xc0, 0xff, 0xa8, 0xb6, 0xc5, 0xff, 0xb9, 0xc3, 0xce, 0xff, 0xc0, 0xca, 0xd5, 0xff, 0xb5, 0xc0, 0xcc, 0xff, 0xa8, 0xb6, 0xc7, 0xff, 0x90, 0xb1, 0xc3, 0xff, 0x71, 0xe6, 0xea, 0xff, 0x74, 0xf0, 0xf2, 0xff, 0x75, 0xef, 0xf2, 0xff, 0x84, 0xca, 0xd9, 0xff, 0x8a, 0xbb, 0xd0, 0xff, 0x77, 0xef, 0xf2, 0xff, 0x76, 0xec, 0xef, 0xff, 0x66, 0xca, 0xce, 0xff, 0x11, 0x7f, 0xf1, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x44, 0x7f, 0xe3, 0xff, 0xa2, 0xb0, 0xc1, 0xff, 0xaa, 0xb9, 0xca, 0xff, 0xab, 0xba, 0xca, 0xff, 0xcd, 0xd3, 0xd7, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xcf, 0xcf, 0xcf, 0x70, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xbe, 0xca, 0xd4, 0xff, 0xc8, 0xd3, 0xdf, 0xff, 0xc7, 0xd3, 0xdf, 0xff, 0xb5, 0xc1, 0xcc, 0xff, 0x47, 0x81, 0xe2, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x2d, 0x7d, 0xe7, 0xff, 0xb5, 0xba, 0xc4, 0xff, 0xe8, 0xe8, 0xeb, 0xff, 0xe9, 0xea, 0xec, 0xff, 0xb9, 0xc3, 0xd1, 0xff, 0xa0, 0xb1, 0xc6, 0xff, 0xa5, 0xb3, 0xc4, 0xff, 0xb8, 0xc4, 0xd2, 0xff, 0xb9, 0xc4, 0xd1, 0xff, 0xb9, 0xc3, 0xd1, 0xff, 0xb4, 0xc0, 0xcc, 0xff, 0xa2, 0xb1, 0xbf, 0xff, 0x9f, 0xaf, 0xbe, 0xff, 0xad, 0xb8, 0xc3, 0xff, 0x9e, 0xad, 0xbd, 0xff, 0xa5, 0xb4, 0xc3, 0xff, 0xa3, 0xb2, 0xbf, 0xff, 0xa9, 0xb5, 0xc0, 0xff, 0xa2, 0xb2, 0xc1, 0xff, 0x8b, 0xad, 0xbe, 0xff, 0x6c, 0xe0, 0xe4, 0xff, 0x70, 0xe9, 0xec, 0xff, 0x70, 0xe9, 0xec, 0xff, 0x7f, 0xc4, 0xd4, 0xff, 0x8a, 0xb7, 0xcc, 0xff, 0x72, 0xe4, 0xe9, 0xff, 0x73, 0xe8, 0xec, 0xff, 0x72, 0xe6, 0xeb, 0xff, 0x64, 0xc8, 0xcc, 0xff, 0x10, 0x7e, 0xf2, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x45, 0x7d, 0xde, 0xff, 0x99, 0xa8, 0xb9, 0xff, 0x9b, 0xac, 0xbe, 0xff, 0xa5, 0xb4, 0xc4, 0xff, 0xc7, 0xcd, 0xd2, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xdb, 0xdb, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xc9, 0xc9, 0xc9, 0x70, 0xd9, 0xd9, 0xd9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xad, 0xba, 0xc6, 0xff, 0xbe, 0xca, 0xd7, 0xff, 0xb8, 0xc5, 0xd2, 0xff, 0xa4, 0xb3, 0xc3, 0xff, 0x52, 0x82, 0xde, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x22, 0x7e, 0xf0, 0xff, 0xc9, 0xca, 0xcd, 0xff, 0xe0, 0xe1, 0xe5, 0xff, 0xb3, 0xbc, 0xcc, 0xff, 0x9b, 0xab, 0xc1, 0xff, 0x9e, 0xac, 0xbe, 0xff, 0xb1, 0xbd, 0xcc, 0xff, 0xb2, 0xbe, 0xcc, 0xff, 0xb3, 0xbe, 0xcb, 0xff, 0xb3, 0xbe, 0xcb, 0xff, 0xb4, 0xbe, 0xca, 0xff, 0xaf, 0xba, 0xc5, 0xff, 0x9d, 0xab, 0xb9, 0xff, 0x9f, 0xae, 0xbd, 0xff, 0xa0, 0xaf, 0xbd, 0xff, 0xa0, 0xaf, 0xbd, 0xff, 0xa0, 0xae, 0xbd, 0xff, 0x9f, 0xae, 0xbe, 0xff, 0x86, 0xa6, 0xb7, 0xff, 0x69, 0xd9, 0xdd, 0xff, 0x6c, 0xe3, 0xe5, 0xff, 0x6c, 0xe3, 0xe5, 0xff, 0x7b, 0xbf, 0xce, 0xff, 0x85, 0xb2, 0xc7, 0xff, 0x6e, 0xdd, 0xe3, 0xff, 0x6f, 0xe2, 0xe6, 0xff, 0x70, 0xe1, 0xe5, 0xff, 0x7d, 0xb8, 0xcb, 0xff, 0x63, 0xae, 0xb9, 0xff, 0x0a, 0x7c, 0xfa, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x4b, 0x7a, 0xd7, 0xff, 0xa0, 0xaa, 0xb5, 0xff, 0xc8, 0xcc, 0xd2, 0xff, 0x97, 0xa6, 0xb8, 0xff, 0xc2, 0xc7, 0xcc, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd6, 0xd6, 0xd6, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xc3, 0xc3, 0xc3, 0x70, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xa8, 0xb7, 0xc5, 0xff, 0xa7, 0xb6, 0xc6, 0xff, 0xa7, 0xb7, 0xc9, 0xff, 0xa2, 0xb1, 0xc3, 0xff, 0x5f, 0x82, 0xd3, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x06, 0x79, 0xfd, 0xff, 0xbc, 0xc0, 0xc6, 0xff, 0xab, 0xb5, 0xc5, 0xff, 0x94, 0xa5, 0xbc, 0xff, 0x98, 0xa6, 0xba, 0xff, 0xab, 0xb7, 0xc7, 0xff, 0xab, 0xb7, 0xc7, 0xff, 0xac, 0xb7, 0xc6, 0xff, 0xaa, 0xb5, 0xc4, 0xff, 0xac, 0xb7, 0xc5, 0xff, 0xad, 0xb8, 0xc5, 0xff, 0xad, 0xb8, 0xc4, 0xff, 0xa8, 0xb3, 0xbf, 0xff, 0x97, 0xa5, 0xb4, 0xff, 0x99, 0xa8, 0xb8, 0xff, 0x99, 0xa8, 0xb8, 0xff, 0x99, 0xa8, 0xb8, 0xff, 0x81, 0xa1, 0xb2, 0xff, 0x66, 0xd3, 0xd7, 0xff, 0x68, 0xdd, 0xdf, 0xff, 0x68, 0xdc, 0xdf, 0xff, 0x76, 0xb9, 0xc8, 0xff, 0x81, 0xac, 0xc1, 0xff, 0x69, 0xd7, 0xdc, 0xff, 0x6a, 0xdb, 0xe0, 0xff, 0x6c, 0xda, 0xe0, 0xff, 0x7c, 0xb3, 0xc7, 0xff, 0xa5, 0xb7, 0xce, 0xff, 0x80, 0x9a, 0xb9, 0xff, 0x03, 0x78, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x69, 0x85, 0xd0, 0xff, 0xd0, 0xd1, 0xd2, 0xff, 0xa3, 0xad, 0xb9, 0xff, 0x97, 0xa7, 0xb7, 0xff, 0xbc, 0xc1, 0xc7, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xcf, 0xcf, 0xcf, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xbd, 0xbd, 0xbd, 0x70, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0x9e, 0xad, 0xbb, 0xff, 0xa4, 0xb5, 0xc7, 0xff, 0xa4, 0xb4, 0xc7, 0xff, 0x9a, 0xa9, 0xba, 0xff, 0x67, 0x86, 0xc1, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x71, 0x8f, 0xbd, 0xff, 0x8b, 0x9d, 0xb5, 0xff, 0x90, 0x9e, 0xb4, 0xff, 0xa4, 0xb0, 0xc2, 0xff, 0xa4, 0xb0, 0xc1, 0xff, 0xa5, 0xb0, 0xc1, 0xff, 0x9c, 0xa8, 0xb9, 0xff, 0x8d, 0x9c, 0xb0, 0xff, 0x9f, 0xaa, 0xb9, 0xff, 0xa6, 0xb1, 0xbf, 0xff, 0xa6, 0xb1, 0xbf, 0xff, 0xa7, 0xb2, 0xbe, 0xff, 0xa3, 0xad, 0xba, 0xff, 0x90, 0x9e, 0xaf, 0xff, 0x93, 0xa2, 0xb3, 0xff, 0x7c, 0x9c, 0xad, 0xff, 0x63, 0xcd, 0xd1, 0xff, 0x66, 0xd6, 0xd8, 0xff, 0x65, 0xd6, 0xd9, 0xff, 0x71, 0xb2, 0xc2, 0xff, 0x7b, 0xa6, 0xba, 0xff, 0x66, 0xd1, 0xd6, 0xff, 0x69, 0xd5, 0xda, 0xff, 0x67, 0xd4, 0xd9, 0xff, 0x76, 0xac, 0xc0, 0xff, 0xa0, 0xb2, 0xca, 0xff, 0x9e, 0xb0, 0xc7, 0xff, 0x6f, 0x96, 0xce, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x85, 0x98, 0xc7, 0xff, 0x95, 0x9f, 0xac, 0xff, 0x91, 0x9f, 0xb2, 0xff, 0x93, 0xa2, 0xb2, 0xff, 0xb6, 0xbb, 0xc0, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xcc, 0xcc, 0xcc, 0xff, 0xc9, 0xc9, 0xc9, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xb7, 0xb7, 0xb7, 0x70, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xb2, 0xb8, 0xbe, 0xff, 0x9b, 0xaa, 0xb9, 0xff, 0x9d, 0xae, 0xc1, 0xff, 0x97, 0xa5, 0xb6, 0xff, 0x77, 0x8c, 0xac, 0xff, 0x00, 0x70, 0xfe, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x75, 0xff, 0xff, 0x49, 0x7f, 0xd8, 0xff, 0x82, 0x93, 0xac, 0xff, 0x86, 0x97, 0xaf, 0xff, 0x98, 0xa5, 0xb8, 0xff, 0x9d, 0xaa, 0xbc, 0xff, 0x9d, 0xaa, 0xbc, 0xff, 0x93, 0xa0, 0xb3, 0xff, 0x88, 0x99, 0xae, 0xff, 0x88, 0x98, 0xad, 0xff, 0x98, 0xa4, 0xb4, 0xff, 0xa0, 0xab, 0xba, 0xff, 0xa0, 0xab, 0xb9, 0xff, 0x95, 0xa2, 0xb0, 0xff, 0x8a, 0x99, 0xac, 0xff, 0x77, 0x96, 0xa8, 0xff, 0x60, 0xc7, 0xcb, 0xff, 0x62, 0xd0, 0xd3, 0xff, 0x61, 0xcf, 0xd3, 0xff, 0x6d, 0xad, 0xbc, 0xff, 0x76, 0xa0, 0xb4, 0xff, 0x62, 0xca, 0xd0, 0xff, 0x63, 0xce, 0xd4, 0xff, 0x64, 0xcd, 0xd3, 0xff, 0x72, 0xa7, 0xbb, 0xff, 0x99, 0xab, 0xc4, 0xff, 0x99, 0xab, 0xc4, 0xff, 0x74, 0x98, 0xa3, 0xff, 0x47, 0x88, 0xe1, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xfe, 0xff, 0x62, 0x78, 0x98, 0xff, 0x86, 0x96, 0xa8, 0xff, 0x8c, 0x9b, 0xad, 0xff, 0x8c, 0x9c, 0xac, 0xff, 0xb0, 0xb6, 0xba, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc6, 0xc6, 0xc6, 0xff, 0xc3, 0xc3, 0xc3, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xb2, 0xb2, 0xb2, 0x70, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xb6, 0xbb, 0xbe, 0xff, 0xc1, 0xc3, 0xc6, 0xff, 0x95, 0xa3, 0xb3, 0xff, 0x93, 0xa4, 0xb7, 0xff, 0x7a, 0x87, 0x98, 0xff, 0x0b, 0x6d, 0xf2, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x00, 0x74, 0xff, 0xff, 0x17, 0x7a, 0xf7, 0xff, 0x80, 0x91, 0xaa, 0xff, 0x7f, 0x91, 0xaa, 0xff, 0x80, 0x91, 0xaa, 0xff, 0x91, 0x9e, 0xb2, 0xff, 0x97, 0xa4, 0xb6, 0xff, 0x98, 0xa4, 0xb6, 0xff, 0x86, 0x94, 0xa8, 0xff, 0x84, 0x95, 0xab, 0xff, 0x83, 0x93, 0xa8, 0xff, 0x92, 0x9e, 0xae, 0xff, 0x8e, 0x9b, 0xab, 0xff, 0x82, 0x93, 0xa6, 0xff, 0x71, 0x91, 0xa3, 0xff, 0x5d, 0xc0, 0xc6, 0xff, 0x5f, 0xc9, 0xcd, 0xff, 0x5f, 0xc9, 0xcd, 0xff, 0x6a, 0xa7, 0xb7, 0xff, 0x71, 0x9a, 0xaf, 0xff, 0x5f, 0xc4, 0xcb, 0xff, 0x60, 0xc8, 0xce, 0xff, 0x5f, 0xc7, 0xce, 0xff, 0x6e, 0xa1, 0xb5, 0xff, 0x92, 0xa4, 0xbd, 0xff, 0x93, 0xa5, 0xbe, 0xff, 0x6f, 0x97, 0xa0, 0xff, 0x4f, 0x90, 0x96, 0xff, 0x1c, 0x81, 0xfc, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x0d, 0x6c, 0xef, 0xff, 0x6f, 0x7c, 0x8c, 0xff, 0x83, 0x93, 0xa5, 0xff, 0x87, 0x95, 0xa7, 0xff, 0x87, 0x96, 0xa6, 0xff, 0xab, 0xb0, 0xb4, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xbd, 0xbd, 0xbd, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xac, 0xac, 0xac, 0x70, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xad, 0xb1, 0xb5, 0xff, 0xc1, 0xc2, 0xc3, 0xff, 0xb4, 0xb6, 0xb9, 0xff, 0x8e, 0x9c, 0xad, 0xff, 0x7e, 0x8d, 0x9f, 0xff, 0x36, 0x6e, 0xd4, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x02, 0x75, 0xff, 0xff, 0x5e, 0x8b, 0xd3, 0xff, 0x86, 0x94, 0xaa, 0xff, 0x7b, 0x8c, 0xa6, 0xff, 0x7a, 0x8b, 0xa4, 0xff, 0x8b, 0x98, 0xac, 0xff, 0x86, 0x93, 0xa8, 0xff, 0x7c, 0x8d, 0xa4, 0xff, 0x7e, 0x8e, 0xa5, 0xff, 0x7e, 0x8e, 0xa5, 0xff, 0x7d, 0x8d, 0xa2, 0xff, 0x7d, 0x8d, 0xa2, 0xff, 0x6b, 0x8a, 0x9f, 0xff, 0x5a, 0xb9, 0xc0, 0xff, 0x5c, 0xc2, 0xc7, 0xff, 0x5c, 0xc2, 0xc7, 0xff, 0x65, 0xa1, 0xb1, 0xff, 0x6c, 0x95, 0xaa, 0xff, 0x5c, 0xbe, 0xc5, 0xff, 0x5c, 0xc1, 0xc8, 0xff, 0x5c, 0xc0, 0xc7, 0xff, 0x69, 0x9c, 0xb0, 0xff, 0x8c, 0x9e, 0xb7, 0xff, 0x8c, 0x9f, 0xb8, 0xff, 0x6b, 0x92, 0x9c, 0xff, 0x51, 0x90, 0x8b, 0xff, 0x41, 0x8f, 0xd2, 0xff, 0x02, 0x74, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x32, 0x68, 0xd0, 0xff, 0x71, 0x7f, 0x90, 0xff, 0x7f, 0x8e, 0xa1, 0xff, 0x81, 0x8f, 0xa1, 0xff, 0x81, 0x90, 0xa0, 0xff, 0xa5, 0xaa, 0xae, 0xff, 0xba, 0xba, 0xba, 0xff, 0xba, 0xba, 0xba, 0xff, 0xb7, 0xb7, 0xb7, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xa6, 0xa6, 0xa6, 0x70, 0xb4, 0xb4, 0xb4, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0x88, 0x95, 0xa1, 0xff, 0xac, 0xb0, 0xb4, 0xff, 0xab, 0xab, 0xad, 0xff, 0xb1, 0xb2, 0xb7, 0xff, 0x80, 0x8d, 0x9c, 0xff, 0x51, 0x6f, 0xa9, 0xff, 0x00, 0x6e, 0xfe, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x73, 0xff, 0xff, 0x1b, 0x7f, 0xfb, 0xff, 0x7b, 0x91, 0xb3, 0xff, 0x82, 0x90, 0xa6, 0xff, 0x76, 0x86, 0xa0, 0xff, 0x76, 0x86, 0x9f, 0xff, 0x77, 0x87, 0xa0, 0xff, 0x78, 0x89, 0xa1, 0xff, 0x79, 0x89, 0xa1, 0xff, 0x79, 0x89, 0xa0, 0xff, 0x79, 0x8a, 0xa0, 0xff, 0x67, 0x85, 0x9b, 0xff, 0x57, 0xb3, 0xbb, 0xff, 0x58, 0xbb, 0xc2, 0xff, 0x59, 0xbb, 0xc2, 0xff, 0x60, 0x9b, 0xac, 0xff, 0x68, 0x90, 0xa5, 0xff, 0x57, 0xb5, 0xbd, 0xff, 0x56, 0xb6, 0xbd, 0xff, 0x5a, 0xba, 0xc2, 0xff, 0x64, 0x96, 0xaa, 0xff, 0x86, 0x98, 0xb2, 0xff, 0x87, 0x99, 0xb2, 0xff, 0x66, 0x8d, 0x97, 0xff, 0x4f, 0x8e, 0x88, 0xff, 0x4b, 0x8d, 0xa3, 0xff, 0x27, 0x86, 0xfd, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0xff, 0x33, 0x73, 0xa5, 0xff, 0x6a, 0x7b, 0x8d, 0xff, 0x7c, 0x8a, 0x9c, 0xff, 0x7d, 0x8a, 0x9b, 0xff, 0x7c, 0x8b, 0x9a, 0xff, 0xa0, 0xa4, 0xa9, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb4, 0xb4, 0xb4, 0xff, 0xb1, 0xb1, 0xb1, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xa1, 0xa1, 0xa1, 0x70, 0xae, 0xae, 0xae, 0xff, 0xae, 0xae, 0xae, 0xff, 0xae, 0xae, 0xae, 0xff, 0x88, 0x95, 0xa1, 0xff, 0x84, 0x93, 0xa2, 0xff, 0xa7, 0xaa, 0xaf, 0xff, 0xaa, 0xab, 0xae, 0xff, 0xa6, 0xa8, 0xad, 0xff, 0x68, 0x73, 0x82, 0xff, 0x0b, 0x68, 0xed, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x02, 0x74, 0xff, 0xff, 0x40, 0x89, 0xec, 0xff, 0x81, 0x90, 0xa8, 0xff, 0x7d, 0x8b, 0xa1, 0xff, 0x72, 0x82, 0x9b, 0xff, 0x74, 0x84, 0x9d, 0xff, 0x74, 0x84, 0x9d, 0xff, 0x73, 0x83, 0x9c, 0xff, 0x74, 0x84, 0x9c, 0xff, 0x63, 0x80, 0x96, 0xff, 0x55, 0xac, 0xb6, 0xff, 0x55, 0xb4, 0xbc, 0xff, 0x56, 0xb4, 0xbc, 0xff, 0x5d, 0x96, 0xa8, 0xff, 0x64, 0x8a, 0xa0, 0xff, 0x55, 0xb0, 0xba, 0xff, 0x4f, 0xa8, 0xb1, 0xff, 0x52, 0xab, 0xb5, 0xff, 0x61, 0x91, 0xa5, 0xff, 0x81, 0x93, 0xac, 0xff, 0x81, 0x93, 0xad, 0xff, 0x63, 0x88, 0x93, 0xff, 0x4c, 0x89, 0x84, 0xff, 0x4a, 0x88, 0x8b, 0xff, 0x3f, 0x94, 0xef, 0xff, 0x02, 0x73, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x08, 0x6b, 0xee, 0xff, 0x42, 0x90, 0x95, 0xff, 0x51, 0x9e, 0xa5, 0xff, 0x6f, 0x80, 0x92, 0xff, 0x79, 0x86, 0x96, 0xff, 0x79, 0x87, 0x96, 0xff, 0x9b, 0x9f, 0xa3, 0xff, 0xae, 0xae, 0xae, 0xff, 0xae, 0xae, 0xae, 0xff, 0xab, 0xab, 0xab, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xd1, 0xd1, 0xd1, 0x70, 0xe4, 0xe4, 0xe4, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xac, 0xc1, 0xc7, 0xff, 0xbe, 0xcc, 0xdb, 0xff, 0xbc, 0xca, 0xd9, 0xff, 0xdb, 0xde, 0xe2, 0xff, 0xe9, 0xea, 0xea, 0xff, 0xcb, 0xcc, 0xcd, 0xff, 0x74, 0x8d, 0xd1, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x0e, 0x79, 0xff, 0xff, 0x63, 0x9b, 0xec, 0xff, 0xbc, 0xc7, 0xd7, 0xff, 0xb9, 0xc3, 0xd3, 0xff, 0xac, 0xba, 0xcc, 0xff, 0xae, 0xbc, 0xcf, 0xff, 0xaf, 0xbc, 0xcf, 0xff, 0x9b, 0xb8, 0xca, 0xff, 0x90, 0xe5, 0xe9, 0xff, 0x92, 0xec, 0xee, 0xff, 0x91, 0xec, 0xee, 0xff, 0x98, 0xcb, 0xd9, 0xff, 0x9d, 0xc3, 0xd4, 0xff, 0x91, 0xe8, 0xec, 0xff, 0x8b, 0xe0, 0xe4, 0xff, 0x90, 0xe8, 0xeb, 0xff, 0x9e, 0xc7, 0xd7, 0xff, 0xbc, 0xcb, 0xde, 0xff, 0xbc, 0xcb, 0xde, 0xff, 0x9b, 0xc0, 0xc4, 0xff, 0x88, 0xc1, 0xb7, 0xff, 0x83, 0xbd, 0xb9, 0xff, 0x52, 0xa1, 0xea, 0xff, 0x16, 0x7a, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x48, 0x89, 0xcc, 0xff, 0x7d, 0xcf, 0xd0, 0xff, 0x8d, 0xea, 0xeb, 0xff, 0x8d, 0xdc, 0xe0, 0xff, 0xa7, 0xb7, 0xc6, 0xff, 0xb1, 0xbe, 0xcb, 0xff, 0xcd, 0xd2, 0xd6, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xe3, 0xe3, 0xe3, 0xff, 0xdf, 0xdf, 0xdf, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe1, 0xe1, 0xe1, 0x70, 0xf5, 0xf5, 0xf5, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xaa, 0xd2, 0xc9, 0xff, 0xae, 0xd2, 0xd0, 0xff, 0xcf, 0xde, 0xed, 0xff, 0xcc, 0xda, 0xe9, 0xff, 0xed, 0xf0, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xff, 0xb6, 0xba, 0xc2, 0xff, 0x15, 0x6d, 0xf5, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x1a, 0x7e, 0xff, 0xff, 0x77, 0xac, 0xf7, 0xff, 0xca, 0xd7, 0xe8, 0xff, 0xc2, 0xce, 0xdd, 0xff, 0xc0, 0xcd, 0xdf, 0xff, 0xac, 0xc8, 0xda, 0xff, 0xa0, 0xf5, 0xf9, 0xff, 0xa2, 0xfd, 0xff, 0xff, 0xa2, 0xfd, 0xff, 0xff, 0xa8, 0xde, 0xeb, 0xff, 0xae, 0xd2, 0xe4, 0xff, 0xa1, 0xfa, 0xfc, 0xff, 0xa2, 0xfe, 0xff, 0xff, 0xa2, 0xfc, 0xfe, 0xff, 0xab, 0xd9, 0xe7, 0xff, 0xce, 0xdd, 0xee, 0xff, 0xce, 0xdd, 0xee, 0xff, 0xac, 0xd1, 0xd3, 0xff, 0x98, 0xd2, 0xc7, 0xff, 0x92, 0xce, 0xcb, 0xff, 0x64, 0xaf, 0xf2, 0xff, 0x24, 0x81, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x13, 0x6b, 0xf3, 0xff, 0x8e, 0x9f, 0xb2, 0xff, 0x96, 0xdf, 0xe5, 0xff, 0x9a, 0xf7, 0xf7, 0xff, 0x95, 0xef, 0xef, 0xff, 0x9c, 0xec, 0xf0, 0xff, 0xb8, 0xc9, 0xd7, 0xff, 0xdd, 0xe3, 0xe7, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf1, 0xf1, 0xf1, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe0, 0xe0, 0xe0, 0x70, 0xf5, 0xf5, 0xf5, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xa9, 0xd2, 0xc9, 0xff, 0x95, 0xd4, 0xbf, 0xff, 0xac, 0xd2, 0xcf, 0xff, 0xce, 0xdd, 0xec, 0xff, 0xca, 0xd9, 0xe8, 0xff, 0xe9, 0xec, 0xf0, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x7b, 0x91, 0xce, 0xff, 0x00, 0x6c, 0xfe, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x1d, 0x7f, 0xff, 0xff, 0x5e, 0xa4, 0xfa, 0xff, 0xa6, 0xc1, 0xe3, 0xff, 0xab, 0xc8, 0xda, 0xff, 0x9d, 0xf5, 0xf9, 0xff, 0xa0, 0xfc, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xff, 0xa6, 0xdd, 0xea, 0xff, 0xad, 0xd2, 0xe4, 0xff, 0x9f, 0xf9, 0xfc, 0xff, 0xa0, 0xfd, 0xff, 0xff, 0xa0, 0xfc, 0xfe, 0xff, 0xa9, 0xd7, 0xe7, 0xff, 0xcc, 0xdc, 0xed, 0xff, 0xce, 0xdc, 0xee, 0xff, 0xab, 0xd0, 0xd3, 0xff, 0x95, 0xd1, 0xc5, 0xff, 0x87, 0xc7, 0xd6, 0xff, 0x5e, 0xac, 0xf9, 0xff, 0x25, 0x81, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xfe, 0xff, 0x65, 0x82, 0xc4, 0xff, 0xb0, 0xbd, 0xca, 0xff, 0xc1, 0xd3, 0xe3, 0xff, 0x9c, 0xec, 0xf1, 0xff, 0x98, 0xf9, 0xf9, 0xff, 0x95, 0xf5, 0xf5, 0xff, 0x98, 0xeb, 0xef, 0xff, 0xda, 0xe1, 0xe6, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe0, 0xe0, 0xe0, 0x70, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xa7, 0xd1, 0xc8, 0xff, 0x92, 0xd3, 0xbd, 0xff, 0x92, 0xd3, 0xbe, 0xff, 0xaa, 0xd0, 0xcd, 0xff, 0xcd, 0xdd, 0xec, 0xff, 0xc9, 0xd8, 0xe7, 0xff, 0xdd, 0xe0, 0xe4, 0xff, 0xbd, 0xbe, 0xbf, 0xff, 0x3d, 0x73, 0xe8, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x15, 0x79, 0xff, 0xff, 0x44, 0x9a, 0xff, 0xff, 0x72, 0xc3, 0xfa, 0xff, 0x8d, 0xe4, 0xf6, 0xff, 0x9e, 0xfb, 0xfd, 0xff, 0xa3, 0xdc, 0xea, 0xff, 0xaa, 0xd0, 0xe3, 0xff, 0x9d, 0xf9, 0xfc, 0xff, 0x9e, 0xfd, 0xff, 0xff, 0x9d, 0xfc, 0xfe, 0xff, 0xa7, 0xd7, 0xe7, 0xff, 0xcc, 0xdb, 0xed, 0xff, 0xcc, 0xdb, 0xed, 0xff, 0xa9, 0xcf, 0xd2, 0xff, 0x8a, 0xc9, 0xd2, 0xff, 0x76, 0xbc, 0xef, 0xff, 0x52, 0xa2, 0xff, 0xff, 0x16, 0x79, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x23, 0x6c, 0xe0, 0xff, 0x71, 0x9c, 0x93, 0xff, 0xb8, 0xcb, 0xd7, 0xff, 0xcd, 0xdd, 0xec, 0xff, 0xc3, 0xd6, 0xe6, 0xff, 0x9a, 0xec, 0xf1, 0xff, 0x93, 0xfa, 0xfa, 0xff, 0x96, 0xff, 0xff, 0xff, 0xd9, 0xe6, 0xea, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe0, 0xe0, 0xe0, 0x70, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xa4, 0xd0, 0xc6, 0xff, 0x90, 0xd2, 0xbc, 0xff, 0x90, 0xd2, 0xbc, 0xff, 0x90, 0xd2, 0xbc, 0xff, 0xa8, 0xcf, 0xcd, 0xff, 0xcc, 0xdc, 0xeb, 0xff, 0xc6, 0xd5, 0xe5, 0xff, 0xcb, 0xce, 0xd3, 0xff, 0x9d, 0xa4, 0xba, 0xff, 0x09, 0x6a, 0xf6, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x02, 0x70, 0xff, 0xff, 0x30, 0x88, 0xff, 0xff, 0x55, 0xa6, 0xff, 0xff, 0x73, 0xbe, 0xfc, 0xff, 0x91, 0xc0, 0xf0, 0xff, 0x91, 0xe7, 0xfc, 0xff, 0x98, 0xf3, 0xff, 0xff, 0x9b, 0xf7, 0xff, 0xff, 0xa0, 0xd6, 0xe9, 0xff, 0xbe, 0xd7, 0xf0, 0xff, 0xb6, 0xd4, 0xf3, 0xff, 0x9c, 0xc9, 0xf1, 0xff, 0x7b, 0xc0, 0xf7, 0xff, 0x60, 0xac, 0xff, 0xff, 0x35, 0x89, 0xff, 0xff, 0x01, 0x6f, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x05, 0x67, 0xf4, 0xff, 0x58, 0x8a, 0x95, 0xff, 0x7e, 0xb7, 0xa7, 0xff, 0x92, 0xcc, 0xbe, 0xff, 0xc2, 0xd7, 0xe3, 0xff, 0xcc, 0xdc, 0xec, 0xff, 0xc1, 0xd4, 0xe5, 0xff, 0x97, 0xec, 0xf1, 0xff, 0x93, 0xff, 0xff, 0xff, 0xd9, 0xe6, 0xe9, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe0, 0xe0, 0xe0, 0x70, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xa4, 0xcf, 0xc5, 0xff, 0x8c, 0xd0, 0xba, 0xff, 0x8d, 0xd1, 0xba, 0xff, 0x8d, 0xd1, 0xba, 0xff, 0x8d, 0xd1, 0xbb, 0xff, 0xa6, 0xce, 0xcb, 0xff, 0xca, 0xda, 0xeb, 0xff, 0xc1, 0xd0, 0xdf, 0xff, 0xbb, 0xbe, 0xc2, 0xff, 0x7f, 0x91, 0xc3, 0xff, 0x00, 0x68, 0xfc, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xff, 0x01, 0x6f, 0xff, 0xff, 0x24, 0x80, 0xff, 0xff, 0x50, 0x9b, 0xff, 0xff, 0x64, 0xae, 0xff, 0xff, 0x78, 0xbd, 0xff, 0xff, 0x87, 0xc7, 0xff, 0xff, 0x88, 0xc8, 0xff, 0xff, 0x7a, 0xbe, 0xff, 0xff, 0x69, 0xb0, 0xff, 0xff, 0x54, 0x9c, 0xff, 0xff, 0x24, 0x7f, 0xff, 0xff, 0x01, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x67, 0xfb, 0xff, 0x47, 0x7c, 0xa9, 0xff, 0x71, 0xa8, 0x98, 0xff, 0x88, 0xc9, 0xb6, 0xff, 0x8d, 0xd0, 0xbb, 0xff, 0x92, 0xce, 0xbe, 0xff, 0xc1, 0xd6, 0xe1, 0xff, 0xcb, 0xdb, 0xec, 0xff, 0xc0, 0xd4, 0xe5, 0xff, 0x94, 0xeb, 0xf1, 0xff, 0xd8, 0xe6, 0xe9, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xe0, 0xe0, 0xe0, 0x70, 0xf4, 0xf4, 0xf4, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xa2, 0xcf, 0xc4, 0xff, 0x8b, 0xd0, 0xb9, 0xff, 0x8a, 0xd0, 0xb9, 0xff, 0x8b, 0xd0, 0xb9, 0xff, 0x8b, 0xd0, 0xb9, 0xff, 0x8b, 0xd0, 0xba, 0xff, 0xa5, 0xcd, 0xcb, 0xff, 0xc9, 0xd9, 0xea, 0xff, 0xb9, 0xc8, 0xd8, 0xff, 0xae, 0xb1, 0xb6, 0xff, 0x68, 0x84, 0xcb, 0xff, 0x00, 0x68, 0xfc, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x01, 0x6e, 0xff, 0xff, 0x01, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x67, 0xfc, 0xff, 0x39, 0x73, 0xb7, 0xff, 0x68, 0x9c, 0x8d, 0xff, 0x81, 0xc1, 0xaf, 0xff, 0x8a, 0xce, 0xba, 0xff, 0x8a, 0xcf, 0xb9, 0xff, 0x8b, 0xd0, 0xba, 0xff, 0x8f, 0xce, 0xbb, 0xff, 0xc0, 0xd5, 0xe1, 0xff, 0xcb, 0xdb, 0xeb, 0xff, 0xc0, 0xd3, 0xe4, 0xff, 0xd9, 0xe1, 0xe6, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdf, 0xdf, 0xdf, 0x70, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xa0, 0xce, 0xc3, 0xff, 0x88, 0xcf, 0xb7, 0xff, 0x88, 0xcf, 0xb7, 0xff, 0x87, 0xcf, 0xb7, 0xff, 0x87, 0xce, 0xb7, 0xff, 0x89, 0xcf, 0xb8, 0xff, 0x89, 0xcf, 0xb8, 0xff, 0xa3, 0xcc, 0xca, 0xff, 0xc7, 0xd7, 0xe8, 0xff, 0xb4, 0xc2, 0xd2, 0xff, 0xa7, 0xaa, 0xaf, 0xff, 0x61, 0x7f, 0xcd, 0xff, 0x00, 0x67, 0xfc, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x66, 0xfc, 0xff, 0x34, 0x6f, 0xba, 0xff, 0x63, 0x96, 0x87, 0xff, 0x7c, 0xbb, 0xa9, 0xff, 0x87, 0xcc, 0xb7, 0xff, 0x88, 0xce, 0xb9, 0xff, 0x88, 0xcf, 0xb8, 0xff, 0x88, 0xcf, 0xb8, 0xff, 0x88, 0xcf, 0xb8, 0xff, 0x8d, 0xcc, 0xba, 0xff, 0xbe, 0xd4, 0xe0, 0xff, 0xca, 0xda, 0xeb, 0xff, 0xdc, 0xe2, 0xe7, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdf, 0xdf, 0xdf, 0x70, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x9f, 0xcd, 0xc3, 0xff, 0x86, 0xce, 0xb6, 0xff, 0x85, 0xce, 0xb6, 0xff, 0x85, 0xce, 0xb6, 0xff, 0x86, 0xce, 0xb6, 0xff, 0x85, 0xce, 0xb5, 0xff, 0x85, 0xce, 0xb6, 0xff, 0x86, 0xce, 0xb7, 0xff, 0xa2, 0xcb, 0xc9, 0xff, 0xc5, 0xd5, 0xe6, 0xff, 0xb0, 0xbe, 0xce, 0xff, 0xa5, 0xa8, 0xac, 0xff, 0x69, 0x82, 0xc6, 0xff, 0x01, 0x65, 0xf9, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x01, 0x64, 0xf9, 0xff, 0x38, 0x70, 0xb0, 0xff, 0x60, 0x93, 0x84, 0xff, 0x78, 0xb8, 0xa5, 0xff, 0x83, 0xc9, 0xb4, 0xff, 0x85, 0xcd, 0xb7, 0xff, 0x86, 0xce, 0xb7, 0xff, 0x85, 0xce, 0xb6, 0xff, 0x85, 0xce, 0xb6, 0xff, 0x85, 0xce, 0xb6, 0xff, 0x86, 0xce, 0xb6, 0xff, 0x8b, 0xcc, 0xb9, 0xff, 0xbd, 0xd3, 0xdf, 0xff, 0xdc, 0xe2, 0xe7, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdf, 0xdf, 0xdf, 0x70, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x9e, 0xcd, 0xc2, 0xff, 0x84, 0xce, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x84, 0xce, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x85, 0xce, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x83, 0xcd, 0xb5, 0xff, 0x84, 0xcd, 0xb6, 0xff, 0xa1, 0xca, 0xc8, 0xff, 0xc5, 0xd5, 0xe6, 0xff, 0xaf, 0xbe, 0xce, 0xff, 0xa6, 0xaa, 0xae, 0xff, 0x7f, 0x8c, 0xb7, 0xff, 0x0e, 0x63, 0xef, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x08, 0x62, 0xec, 0xff, 0x42, 0x75, 0x9b, 0xff, 0x5f, 0x94, 0x85, 0xff, 0x75, 0xb7, 0xa3, 0xff, 0x81, 0xc9, 0xb3, 0xff, 0x83, 0xcc, 0xb5, 0xff, 0x84, 0xcd, 0xb6, 0xff, 0x83, 0xcd, 0xb5, 0xff, 0x83, 0xcd, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x84, 0xcd, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x88, 0xcb, 0xb7, 0xff, 0xd9, 0xe0, 0xe4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdf, 0xdf, 0xdf, 0x70, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x9d, 0xcc, 0xc2, 0xff, 0x82, 0xcd, 0xb3, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x81, 0xcc, 0xb2, 0xff, 0x82, 0xcc, 0xb3, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x81, 0xcc, 0xb4, 0xff, 0x81, 0xcb, 0xb4, 0xff, 0xa0, 0xc9, 0xc8, 0xff, 0xc5, 0xd6, 0xe7, 0xff, 0xb2, 0xc1, 0xd1, 0xff, 0x91, 0xa4, 0xab, 0xff, 0x51, 0x95, 0xa6, 0xff, 0x25, 0x6f, 0xd8, 0xff, 0x00, 0x64, 0xfb, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x69, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x63, 0xfb, 0xff, 0x23, 0x65, 0xcd, 0xff, 0x4c, 0x7d, 0x7f, 0xff, 0x62, 0x9a, 0x89, 0xff, 0x76, 0xba, 0xa6, 0xff, 0x80, 0xc9, 0xb3, 0xff, 0x81, 0xcb, 0xb5, 0xff, 0x82, 0xcc, 0xb5, 0xff, 0x82, 0xcd, 0xb4, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0x82, 0xcc, 0xb3, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0x81, 0xcc, 0xb4, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0xd6, 0xe0, 0xe1, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xee, 0xee, 0xee, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xde, 0xde, 0xde, 0x70, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0x9c, 0xcb, 0xc0, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x7f, 0xcc, 0xb2, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x82, 0xca, 0xb4, 0xff, 0xb2, 0xcf, 0xd7, 0xff, 0xc7, 0xd8, 0xea, 0xff, 0xa9, 0xcb, 0xdd, 0xff, 0x7e, 0xe7, 0xe9, 0xff, 0x6d, 0xce, 0xce, 0xff, 0x5a, 0xaa, 0xaa, 0xff, 0x4a, 0x75, 0xa8, 0xff, 0x19, 0x61, 0xe0, 0xff, 0x00, 0x64, 0xfb, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x68, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x64, 0xfb, 0xff, 0x15, 0x61, 0xdc, 0xff, 0x3d, 0x70, 0x96, 0xff, 0x55, 0x87, 0x79, 0xff, 0x67, 0xa4, 0x93, 0xff, 0x78, 0xbe, 0xa9, 0xff, 0x7e, 0xc9, 0xb2, 0xff, 0x7f, 0xcb, 0xb3, 0xff, 0x7e, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x7f, 0xcb, 0xb1, 0xff, 0x7f, 0xcc, 0xb2, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0xd6, 0xe0, 0xe1, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xee, 0xee, 0xee, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xde, 0xde, 0xde, 0x70, 0xf3, 0xf3, 0xf3, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x9b, 0xcb, 0xc0, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7d, 0xcb, 0xb1, 0xff, 0x7d, 0xcb, 0xb1, 0xff, 0x7d, 0xca, 0xb0, 0xff, 0x7d, 0xcb, 0xb1, 0xff, 0x7e, 0xcb, 0xb2, 0xff, 0x7f, 0xc9, 0xb1, 0xff, 0xb2, 0xce, 0xd6, 0xff, 0xc7, 0xd8, 0xe9, 0xff, 0xab, 0xcd, 0xde, 0xff, 0x83, 0xf6, 0xf8, 0xff, 0x84, 0xfe, 0xfe, 0xff, 0x80, 0xf6, 0xf7, 0xff, 0x82, 0xbe, 0xca, 0xff, 0x74, 0x98, 0xa6, 0xff, 0x54, 0x9f, 0xa1, 0xff, 0x3e, 0x84, 0xb0, 0xff, 0x1f, 0x6b, 0xd6, 0xff, 0x01, 0x60, 0xf4, 0xff, 0x00, 0x65, 0xfd, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x67, 0xff, 0xff, 0x00, 0x65, 0xfd, 0xff, 0x02, 0x60, 0xf4, 0xff, 0x32, 0x64, 0xd4, 0xff, 0x56, 0x70, 0xa1, 0xff, 0x50, 0x7f, 0x73, 0xff, 0x5e, 0x98, 0x87, 0xff, 0x6f, 0xb3, 0x9f, 0xff, 0x7a, 0xc4, 0xae, 0xff, 0x7e, 0xc9, 0xb2, 0xff, 0x7e, 0xcb, 0xb3, 0xff, 0x7e, 0xca, 0xb2, 0xff, 0x7d, 0xcb, 0xb2, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7d, 0xcb, 0xb1, 0xff, 0x7d, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7d, 0xca, 0xb0, 0xff, 0x7e, 0xcb, 0xb2, 0xff, 0x87, 0xca, 0xb0, 0xff, 0xd9, 0xe0, 0xe1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xde, 0xde, 0xde, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x9b, 0xcb, 0xbf, 0xff, 0x7b, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7b, 0xca, 0xaf, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7b, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7d, 0xc9, 0xb0, 0xff, 0xb2, 0xce, 0xd6, 0xff, 0xc7, 0xd8, 0xe9, 0xff, 0xa9, 0xcc, 0xde, 0xff, 0x80, 0xf6, 0xf8, 0xff, 0x81, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x91, 0xd7, 0xe3, 0xff, 0x9a, 0xc8, 0xd9, 0xff, 0x7a, 0xed, 0xef, 0xff, 0x71, 0xdc, 0xdc, 0xff, 0x62, 0xbd, 0xbe, 0xff, 0x5d, 0x80, 0x89, 0xff, 0x62, 0x70, 0x85, 0xff, 0x4b, 0x63, 0xa8, 0xff, 0x39, 0x63, 0xcb, 0xff, 0x15, 0x60, 0xe3, 0xff, 0x01, 0x60, 0xf6, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x00, 0x66, 0xff, 0xff, 0x01, 0x5f, 0xf6, 0xff, 0x13, 0x5e, 0xe2, 0xff, 0x42, 0x67, 0xcc, 0xff, 0x6b, 0x7b, 0xb3, 0xff, 0x84, 0x8a, 0x97, 0xff, 0x7d, 0x87, 0x93, 0xff, 0x95, 0xa2, 0xb0, 0xff, 0x9b, 0xb3, 0xbb, 0xff, 0x78, 0xbf, 0xaa, 0xff, 0x7b, 0xc7, 0xb0, 0xff, 0x7b, 0xc9, 0xb0, 0xff, 0x7c, 0xc9, 0xb1, 0xff, 0x7b, 0xca, 0xb1, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7b, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7b, 0xca, 0xaf, 0xff, 0x7c, 0xcb, 0xb0, 0xff, 0x7d, 0xcb, 0xb0, 0xff, 0x84, 0xc9, 0xaf, 0xff, 0xd0, 0xc3, 0xab, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdd, 0xdd, 0xdd, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x9a, 0xca, 0xbf, 0xff, 0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xca, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xca, 0xaf, 0xff, 0x7c, 0xc8, 0xaf, 0xff, 0xb7, 0xd1, 0xd7, 0xff, 0xce, 0xdc, 0xec, 0xff, 0xad, 0xcf, 0xdf, 0xff, 0x7f, 0xf6, 0xf8, 0xff, 0x7e, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x93, 0xda, 0xe4, 0xff, 0x9d, 0xcb, 0xdb, 0xff, 0x80, 0xf9, 0xfa, 0xff, 0x7f, 0xfb, 0xfc, 0xff, 0x7f, 0xfa, 0xfb, 0xff, 0x8b, 0xc1, 0xcd, 0xff, 0xa4, 0xb1, 0xbe, 0xff, 0x94, 0x9e, 0xaa, 0xff, 0x92, 0x99, 0xa0, 0xff, 0x86, 0x8c, 0x93, 0xff, 0x7b, 0x81, 0x87, 0xff, 0x68, 0x75, 0x8d, 0xff, 0x07, 0x62, 0xf4, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x00, 0x65, 0xff, 0xff, 0x09, 0x62, 0xf3, 0xff, 0x5e, 0x6b, 0x84, 0xff, 0x6e, 0x76, 0x7f, 0xff, 0x77, 0x80, 0x8a, 0xff, 0xab, 0xad, 0xaf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd8, 0xda, 0xdd, 0xff, 0xbe, 0xcc, 0xdb, 0xff, 0xcc, 0xda, 0xea, 0xff, 0xb6, 0xd1, 0xd8, 0xff, 0x7c, 0xc7, 0xb0, 0xff, 0x7a, 0xc9, 0xb0, 0xff, 0x7a, 0xc9, 0xb0, 0xff, 0x7b, 0xca, 0xb0, 0xff, 0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xca, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0x7a, 0xca, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0x7a, 0xc9, 0xae, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x84, 0xc8, 0xae, 0xff, 0xd0, 0xc3, 0xaa, 0xff, 0xde, 0xc1, 0xa8, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdd, 0xdd, 0xdd, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x99, 0xca, 0xbe, 0xff, 0x78, 0xc8, 0xad, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x7a, 0xc7, 0xae, 0xff, 0xbc, 0xd5, 0xd9, 0xff, 0xd6, 0xe2, 0xef, 0xff, 0xb3, 0xd2, 0xe1, 0xff, 0x7d, 0xf6, 0xf8, 0xff, 0x7d, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0x95, 0xdb, 0xe5, 0xff, 0xa2, 0xcf, 0xdd, 0xff, 0x7c, 0xfa, 0xfb, 0xff, 0x74, 0xea, 0xea, 0xff, 0x7a, 0xf4, 0xf4, 0xff, 0x93, 0xcd, 0xd7, 0xff, 0xbf, 0xca, 0xd7, 0xff, 0xbc, 0xc7, 0xd3, 0xff, 0xcb, 0xd2, 0xdc, 0xff, 0xc9, 0xd1, 0xda, 0xff, 0xc0, 0xc8, 0xd1, 0xff, 0xb6, 0xbd, 0xc5, 0xff, 0x9d, 0xa3, 0xaa, 0xff, 0x51, 0x6d, 0xb7, 0xff, 0x00, 0x63, 0xfe, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x64, 0xff, 0xff, 0x00, 0x63, 0xfe, 0xff, 0x5d, 0x75, 0xb9, 0xff, 0x9d, 0xa4, 0xab, 0xff, 0xa4, 0xad, 0xb8, 0xff, 0xaf, 0xba, 0xc6, 0xff, 0xb5, 0xc0, 0xcd, 0xff, 0xeb, 0xed, 0xf0, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf0, 0xf3, 0xf6, 0xff, 0xcb, 0xd8, 0xe6, 0xff, 0xd6, 0xe2, 0xef, 0xff, 0xbd, 0xd5, 0xda, 0xff, 0x7a, 0xc7, 0xae, 0xff, 0x79, 0xc9, 0xaf, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x78, 0xc8, 0xae, 0xff, 0x78, 0xc8, 0xad, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x78, 0xc8, 0xad, 0xff, 0x83, 0xc8, 0xae, 0xff, 0xcf, 0xc2, 0xa9, 0xff, 0xde, 0xc1, 0xa8, 0xff, 0xde, 0xc1, 0xa9, 0xff, 0xde, 0xe0, 0xe0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdd, 0xdd, 0xdd, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x9b, 0xcb, 0xbf, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x78, 0xc8, 0xae, 0xff, 0x76, 0xc8, 0xad, 0xff, 0x79, 0xc7, 0xad, 0xff, 0xc4, 0xda, 0xdc, 0xff, 0xde, 0xe8, 0xf2, 0xff, 0xb9, 0xd7, 0xe4, 0xff, 0x7b, 0xf6, 0xf9, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x99, 0xde, 0xe6, 0xff, 0xa7, 0xd2, 0xdf, 0xff, 0x7b, 0xfa, 0xfb, 0xff, 0x75, 0xf0, 0xf0, 0xff, 0x7b, 0xfa, 0xfa, 0xff, 0x96, 0xce, 0xd7, 0xff, 0xc6, 0xcf, 0xd9, 0xff, 0xc4, 0xcc, 0xd5, 0xff, 0xd3, 0xda, 0xe0, 0xff, 0xd9, 0xdf, 0xe5, 0xff, 0xd8, 0xde, 0xe5, 0xff, 0xd8, 0xde, 0xe4, 0xff, 0xd3, 0xd9, 0xe0, 0xff, 0xb8, 0xc0, 0xc9, 0xff, 0x90, 0x97, 0x9f, 0xff, 0x2c, 0x63, 0xe0, 0xff, 0x00, 0x63, 0xff, 0xff, 0x00, 0x63, 0xff, 0xff, 0x34, 0x66, 0xdf, 0xff, 0x9d, 0xa1, 0xa7, 0xff, 0xcc, 0xd2, 0xd8, 0xff, 0xcd, 0xd4, 0xda, 0xff, 0xc5, 0xce, 0xd8, 0xff, 0xc7, 0xd0, 0xda, 0xff, 0xc7, 0xcf, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf3, 0xf6, 0xff, 0xd1, 0xdc, 0xe7, 0xff, 0xde, 0xe8, 0xf2, 0xff, 0xc3, 0xd9, 0xdc, 0xff, 0x79, 0xc7, 0xae, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x77, 0xc8, 0xae, 0xff, 0x76, 0xc8, 0xad, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x80, 0xc7, 0xac, 0xff, 0xcf, 0xc2, 0xa8, 0xff, 0xde, 0xc0, 0xa7, 0xff, 0xdd, 0xc0, 0xa7, 0xff, 0xde, 0xc0, 0xa7, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdd, 0xdd, 0xdd, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0x9a, 0xcb, 0xbe, 0xff, 0x76, 0xc8, 0xad, 0xff, 0x75, 0xc8, 0xac, 0xff, 0x79, 0xc7, 0xad, 0xff, 0xc9, 0xde, 0xde, 0xff, 0xe7, 0xee, 0xf5, 0xff, 0xbf, 0xdc, 0xe6, 0xff, 0x7b, 0xf7, 0xf9, 0xff, 0x7a, 0xff, 0xff, 0xff, 0x79, 0xff, 0xff, 0xff, 0x9c, 0xe0, 0xe8, 0xff, 0xac, 0xd6, 0xe0, 0xff, 0x7a, 0xfa, 0xfc, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x7b, 0xfd, 0xfd, 0xff, 0xb4, 0xe5, 0xe9, 0xff, 0xc4, 0xcd, 0xd5, 0xff, 0xcd, 0xd4, 0xda, 0xff, 0xd3, 0xd8, 0xdd, 0xff, 0xde, 0xe2, 0xe7, 0xff, 0xdd, 0xe2, 0xe7, 0xff, 0xdd, 0xe2, 0xe7, 0xff, 0xda, 0xdf, 0xe3, 0xff, 0xcb, 0xd1, 0xd7, 0xff, 0xce, 0xd4, 0xdb, 0xff, 0xb7, 0xbd, 0xc3, 0xff, 0x75, 0x80, 0x9e, 0xff, 0x03, 0x60, 0xf8, 0xff, 0x04, 0x60, 0xf8, 0xff, 0x81, 0x8b, 0xa5, 0xff, 0xc4, 0xc8, 0xcd, 0xff, 0xd5, 0xda, 0xdf, 0xff, 0xcd, 0xd3, 0xda, 0xff, 0xcf, 0xd5, 0xdd, 0xff, 0xc5, 0xcd, 0xd5, 0xff, 0xfb, 0xfc, 0xfc, 0xff, 0xd7, 0xdd, 0xe3, 0xff, 0xf0, 0xf3, 0xf5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xef, 0xf1, 0xf4, 0xff, 0xd7, 0xe0, 0xea, 0xff, 0xe6, 0xee, 0xf5, 0xff, 0xc9, 0xde, 0xde, 0xff, 0x78, 0xc7, 0xad, 0xff, 0x76, 0xc7, 0xac, 0xff, 0x76, 0xc8, 0xac, 0xff, 0x76, 0xc8, 0xac, 0xff, 0x76, 0xc8, 0xad, 0xff, 0x75, 0xc7, 0xac, 0xff, 0x80, 0xc7, 0xab, 0xff, 0xce, 0xc1, 0xa7, 0xff, 0xdd, 0xc0, 0xa6, 0xff, 0xdd, 0xc0, 0xa6, 0xff, 0xdd, 0xbf, 0xa6, 0xff, 0xdd, 0xc0, 0xa7, 0xff, 0xdf, 0xe0, 0xe0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdc, 0xdc, 0xdc, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x9b, 0xcb, 0xbe, 0xff, 0x74, 0xc7, 0xab, 0xff, 0x78, 0xc7, 0xad, 0xff, 0xd1, 0xe3, 0xe1, 0xff, 0xef, 0xf4, 0xf8, 0xff, 0xc6, 0xe0, 0xe8, 0xff, 0x7b, 0xf7, 0xf9, 0xff, 0x78, 0xff, 0xff, 0xff, 0x79, 0xff, 0xff, 0xff, 0x9e, 0xe2, 0xe9, 0xff, 0xb1, 0xd8, 0xe2, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x7a, 0xff, 0xff, 0xff, 0x79, 0xfe, 0xfe, 0xff, 0x9c, 0xd5, 0xdb, 0xff, 0xf7, 0xf8, 0xf9, 0xff, 0xdd, 0xe1, 0xe6, 0xff, 0xce, 0xd4, 0xda, 0xff, 0xd3, 0xd6, 0xdb, 0xff, 0xdd, 0xe0, 0xe4, 0xff, 0xe3, 0xe6, 0xe9, 0xff, 0xe0, 0xe3, 0xe6, 0xff, 0xd2, 0xd5, 0xda, 0xff, 0xd7, 0xdb, 0xe0, 0xff, 0xd7, 0xdb, 0xe0, 0xff, 0xcb, 0xce, 0xd3, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0x58, 0x73, 0xc5, 0xff, 0x5a, 0x74, 0xc3, 0xff, 0xb6, 0xb8, 0xbb, 0xff, 0xd6, 0xd9, 0xdd, 0xff, 0xd3, 0xd7, 0xdc, 0xff, 0xd6, 0xda, 0xdf, 0xff, 0xc8, 0xd0, 0xd7, 0xff, 0xfb, 0xfc, 0xfc, 0xff, 0xd4, 0xda, 0xe0, 0xff, 0xd1, 0xd6, 0xdc, 0xff, 0xce, 0xd4, 0xdb, 0xff, 0xee, 0xf0, 0xf3, 0xff, 0xee, 0xee, 0xee, 0xff, 0xf0, 0xf2, 0xf5, 0xff, 0xdd, 0xe4, 0xec, 0xff, 0xef, 0xf3, 0xf8, 0xff, 0xd0, 0xe2, 0xe0, 0xff, 0x77, 0xc6, 0xac, 0xff, 0x74, 0xc7, 0xab, 0xff, 0x75, 0xc7, 0xac, 0xff, 0x74, 0xc7, 0xab, 0xff, 0x7f, 0xc6, 0xab, 0xff, 0xcd, 0xc0, 0xa6, 0xff, 0xdd, 0xbf, 0xa6, 0xff, 0xdd, 0xc0, 0xa6, 0xff, 0xdd, 0xbf, 0xa5, 0xff, 0xdd, 0xc0, 0xa6, 0xff, 0xdd, 0xc0, 0xa6, 0xff, 0xdf, 0xe0, 0xe0, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdc, 0xdc, 0xdc, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x9b, 0xcc, 0xbe, 0xff, 0x77, 0xc7, 0xac, 0xff, 0xd6, 0xe6, 0xe3, 0xff, 0xf7, 0xfa, 0xfc, 0xff, 0xcc, 0xe4, 0xeb, 0xff, 0x7a, 0xf7, 0xf9, 0xff, 0x71, 0xee, 0xee, 0xff, 0x77, 0xfe, 0xfe, 0xff, 0xa3, 0xe4, 0xea, 0xff, 0xb6, 0xdc, 0xe5, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x77, 0xff, 0xff, 0xff, 0x78, 0xfe, 0xfe, 0xff, 0xa1, 0xd5, 0xdb, 0xff, 0xdc, 0xdf, 0xe1, 0xff, 0xcc, 0xd1, 0xd8, 0xff, 0xf8, 0xf9, 0xfa, 0xff, 0xde, 0xe2, 0xe7, 0xff, 0xd5, 0xd9, 0xdc, 0xff, 0xda, 0xdb, 0xdd, 0xff, 0xdf, 0xe0, 0xe2, 0xff, 0xd8, 0xda, 0xdc, 0xff, 0xde, 0xe0, 0xe2, 0xff, 0xde, 0xe0, 0xe2, 0xff, 0xd7, 0xd9, 0xda, 0xff, 0xe6, 0xe7, 0xe8, 0xff, 0xd8, 0xd9, 0xda, 0xff, 0xa5, 0xa7, 0xab, 0xff, 0xa6, 0xa8, 0xab, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xde, 0xe0, 0xe2, 0xff, 0xcd, 0xd2, 0xd8, 0xff, 0xfc, 0xfc, 0xfd, 0xff, 0xd7, 0xdc, 0xe1, 0xff, 0xd9, 0xdc, 0xde, 0xff, 0xde, 0xe0, 0xe2, 0xff, 0xdf, 0xe0, 0xe2, 0xff, 0xd2, 0xd7, 0xdd, 0xff, 0xef, 0xf1, 0xf4, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xf1, 0xf3, 0xf6, 0xff, 0xe3, 0xe9, 0xee, 0xff, 0xf7, 0xfa, 0xfc, 0xff, 0xd6, 0xe7, 0xe3, 0xff, 0x77, 0xc7, 0xac, 0xff, 0x73, 0xc7, 0xab, 0xff, 0x77, 0xc6, 0xaa, 0xff, 0xce, 0xc0, 0xa5, 0xff, 0xdd, 0xbf, 0xa5, 0xff, 0xdd, 0xbf, 0xa5, 0xff, 0xdd, 0xbf, 0xa5, 0xff, 0xdd, 0xbf, 0xa5, 0xff, 0xdc, 0xbe, 0xa5, 0xff, 0xdc, 0xbe, 0xa4, 0xff, 0xe0, 0xe1, 0xe0, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdb, 0xdb, 0xdb, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0x9f, 0xcb, 0xbf, 0xff, 0xdc, 0xea, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xe7, 0xec, 0xff, 0x78, 0xf3, 0xf5, 0xff, 0x6d, 0xea, 0xea, 0xff, 0x76, 0xfd, 0xfd, 0xff, 0xa5, 0xe5, 0xeb, 0xff, 0xbb, 0xdf, 0xe6, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x76, 0xfe, 0xfe, 0xff, 0xa2, 0xd6, 0xdb, 0xff, 0xe2, 0xe2, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xcf, 0xd4, 0xd9, 0xff, 0xf7, 0xf8, 0xf9, 0xff, 0xd3, 0xd8, 0xdd, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xdc, 0xdd, 0xdd, 0xff, 0xea, 0xea, 0xeb, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xce, 0xd2, 0xd6, 0xff, 0xfa, 0xfb, 0xfc, 0xff, 0xd8, 0xdd, 0xe1, 0xff, 0xde, 0xdf, 0xe0, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xd6, 0xd9, 0xde, 0xff, 0xf0, 0xf3, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xf3, 0xff, 0xe2, 0xe7, 0xec, 0xff, 0xef, 0xf2, 0xf5, 0xff, 0xc6, 0xda, 0xd7, 0xff, 0x88, 0xc6, 0xb4, 0xff, 0x93, 0xc9, 0xb9, 0xff, 0xc4, 0xca, 0xbe, 0xff, 0xd7, 0xce, 0xc6, 0xff, 0xd9, 0xd3, 0xcc, 0xff, 0xdb, 0xd7, 0xd2, 0xff, 0xdd, 0xda, 0xd6, 0xff, 0xde, 0xde, 0xdc, 0xff, 0xe1, 0xe2, 0xe2, 0xff, 0xee, 0xef, 0xef, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdc, 0xdc, 0xdc, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xe6, 0xea, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xe8, 0xed, 0xff, 0x79, 0xf8, 0xf9, 0xff, 0x74, 0xfb, 0xfb, 0xff, 0x73, 0xf7, 0xf7, 0xff, 0xa4, 0xe5, 0xeb, 0xff, 0xbb, 0xdf, 0xe6, 0xff, 0x78, 0xfb, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x76, 0xfe, 0xfe, 0xff, 0xa2, 0xd6, 0xdc, 0xff, 0xe2, 0xe2, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xd1, 0xd5, 0xd9, 0xff, 0xd8, 0xda, 0xdc, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xec, 0xec, 0xec, 0xff, 0xec, 0xec, 0xec, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe2, 0xe3, 0xe3, 0xff, 0xde, 0xdf, 0xe0, 0xff, 0xd6, 0xda, 0xdc, 0xff, 0xbf, 0xc8, 0xcf, 0xff, 0xd0, 0xd5, 0xd9, 0xff, 0xd8, 0xdc, 0xde, 0xff, 0xd9, 0xdd, 0xdf, 0xff, 0xd9, 0xde, 0xe0, 0xff, 0xdb, 0xdf, 0xe1, 0xff, 0xdd, 0xe1, 0xe3, 0xff, 0xde, 0xe2, 0xe4, 0xff, 0xdb, 0xe0, 0xe3, 0xff, 0xe2, 0xe7, 0xe9, 0xff, 0xe6, 0xe9, 0xeb, 0xff, 0xea, 0xec, 0xed, 0xff, 0xef, 0xf0, 0xf0, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdb, 0xdb, 0xdb, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xea, 0xee, 0xf1, 0xff, 0xd1, 0xe8, 0xed, 0xff, 0x79, 0xf8, 0xf9, 0xff, 0x75, 0xff, 0xff, 0xff, 0x74, 0xff, 0xff, 0xff, 0xa4, 0xe5, 0xeb, 0xff, 0xba, 0xde, 0xe6, 0xff, 0x76, 0xfb, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x75, 0xfe, 0xfe, 0xff, 0xa1, 0xd6, 0xdb, 0xff, 0xe2, 0xe2, 0xe3, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe0, 0xe1, 0xe1, 0xff, 0xdb, 0xdd, 0xde, 0xff, 0xd8, 0xdb, 0xdd, 0xff, 0xd6, 0xda, 0xdd, 0xff, 0xd8, 0xdb, 0xde, 0xff, 0xd3, 0xd7, 0xd9, 0xff, 0xdd, 0xe2, 0xe4, 0xff, 0xde, 0xe2, 0xe5, 0xff, 0xde, 0xe3, 0xe5, 0xff, 0xdf, 0xe4, 0xe6, 0xff, 0xdc, 0xe0, 0xe2, 0xff, 0xdf, 0xe3, 0xe5, 0xff, 0xe1, 0xe5, 0xe7, 0xff, 0xe7, 0xea, 0xeb, 0xff, 0xec, 0xee, 0xef, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
-  0xdb, 0xdb, 0xdb, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xbf, 0xda, 0xe1, 0xff, 0x77, 0xf8, 0xf9, 0xff, 0x76, 0xff, 0xff, 0xff, 0x75, 0xff, 0xff, 0xff, 0xa0, 0xe3, 0xea, 0xff, 0xb7, 0xda, 0xe1, 0xff, 0x74, 0xf1, 0xf3, 0xff, 0x7a, 0xf1, 0xf4, 0xff, 0x84, 0xf0, 0xf2, 0xff, 0x9e, 0xd5, 0xdb, 0xff, 0xd6, 0xdb, 0xde, 0xff, 0xd9, 0xde, 0xe0, 0xff, 0xdb, 0xdf, 0xe2, 0xff, 0xdc, 0xe0, 0xe3, 0xff, 0xde, 0xe2, 0xe4, 0xff, 0xdf, 0xe3, 0xe5, 0xff, 0xe0, 0xe4, 0xe6, 0xff, 0xe4, 0xe7, 0xe9, 0xff, 0xea, 0xec, 0xed, 0xff, 0xef, 0xef, 0xf0, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xee, 0xee, 0xee, 0xf8, 0xe7, 0xe7, 0xe7, 0xe8, 0xe1, 0xe1, 0xe1, 0xdb, 0xdc, 0xdc, 0xdc, 0xcb, 0xd8, 0xd8, 0xd8, 0xbb, 0xd5, 0xd5, 0xd5, 0x97, 0x00, 0x00, 0x00, 0x08, 
-  0xdb, 0xdb, 0xdb, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xcb, 0xe8, 0xea, 0xff, 0xc4, 0xe9, 0xec, 0xff, 0xca, 0xe8, 0xea, 0xff, 0xd1, 0xe6, 0xe8, 0xff, 0xe0, 0xe4, 0xe7, 0xff, 0xe5, 0xe9, 0xeb, 0xff, 0xec, 0xee, 0xee, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xfc, 0xea, 0xea, 0xea, 0xf0, 0xe4, 0xe4, 0xe4, 0xe3, 0xde, 0xde, 0xde, 0xd3, 0xda, 0xda, 0xda, 0xc3, 0xd7, 0xd7, 0xd7, 0xb3, 0xd9, 0xd9, 0xd9, 0xa3, 0xd1, 0xd1, 0xd1, 0x90, 0xc3, 0xc3, 0xc3, 0x7f, 0xb1, 0xb1, 0xb1, 0x6c, 0x99, 0x99, 0x99, 0x58, 0x75, 0x75, 0x75, 0x44, 0x36, 0x36, 0x36, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
-  0xdb, 0xdb, 0xdb, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xee, 0xee, 0xee, 0xf8, 0xe7, 0xe7, 0xe7, 0xe8, 0xe1, 0xe1, 0xe1, 0xdb, 0xdc, 0xdc, 0xdc, 0xcb, 0xd8, 0xd8, 0xd8, 0xbb, 0xd7, 0xd7, 0xd7, 0xab, 0xd7, 0xd7, 0xd7, 0x98, 0xcb, 0xcb, 0xcb, 0x88, 0xba, 0xba, 0xba, 0x77, 0xa6, 0xa6, 0xa6, 0x63, 0x89, 0x89, 0x89, 0x4f, 0x5a, 0x5a, 0x5a, 0x3c, 0x0e, 0x0e, 0x0e, 0x2b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xdb, 0xdb, 0xdb, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf0, 0xf0, 0xf0, 0xfc, 0xea, 0xea, 0xea, 0xf0, 0xe4, 0xe4, 0xe4, 0xe3, 0xde, 0xde, 0xde, 0xd3, 0xda, 0xda, 0xda, 0xc3, 0xd7, 0xd7, 0xd7, 0xb3, 0xd9, 0xd9, 0xd9, 0xa3, 0xd2, 0xd2, 0xd2, 0x90, 0xc3, 0xc3, 0xc3, 0x7f, 0xb2, 0xb2, 0xb2, 0x6c, 0x99, 0x99, 0x99, 0x58, 0x75, 0x75, 0x75, 0x44, 0x36, 0x36, 0x36, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xdb, 0xdb, 0xdb, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xf1, 0xf1, 0xf1, 0xff, 0xee, 0xee, 0xee, 0xf8, 0xe7, 0xe7, 0xe7, 0xe8, 0xe1, 0xe1, 0xe1, 0xdb, 0xdc, 0xdc, 0xdc, 0xcb, 0xd8, 0xd8, 0xd8, 0xbb, 0xd7, 0xd7, 0xd7, 0xab, 0xd7, 0xd7, 0xd7, 0x98, 0xcb, 0xcb, 0xcb, 0x88, 0xba, 0xba, 0xba, 0x77, 0xa6, 0xa6, 0xa6, 0x63, 0x89, 0x89, 0x89, 0x4f, 0x5b, 0x5b, 0x5b, 0x3c, 0x0e, 0x0e, 0x0e, 0x2b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xc9, 0xc9, 0xc9, 0x43, 0xd3, 0xd3, 0xd3, 0x8f, 0xc3, 0xc3, 0xc3, 0x7f, 0xb2, 0xb2, 0xb2, 0x6c, 0x99, 0x99, 0x99, 0x58, 0x75, 0x75, 0x75, 0x44, 0x36, 0x36, 0x36, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x62, 0x8e, 0xaa, 0x0c, 0x61, 0x8c, 0xa8, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
+  0x00, 0x03, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x51, 0xa1, 0xe4, 0x27, 0x5f, 0xb4, 0xf8, 0x68, 0x69, 0xba, 0xf9, 0x9f, 0x73, 0xc1, 0xfb, 0xcb, 0x7d, 0xc8, 0xfd, 0xe8, 
+  0x87, 0xcf, 0xff, 0xfc, 0x8f, 0xd3, 0xff, 0xff, 0x91, 0xd4, 0xff, 0xff, 0x8b, 0xd1, 0xff, 0xfc, 0x84, 0xcc, 0xfd, 0xe8, 0x7d, 0xc7, 0xfb, 0xc8, 0x75, 0xc2, 0xf9, 0x9f, 0x6e, 0xbd, 0xf8, 0x67, 
+  0x61, 0xab, 0xe4, 0x24, 0x00, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x00, 0x00, 0x08, 0x36, 0x8f, 0xdd, 0x1b, 0x43, 0xa4, 0xf7, 0x7b, 0x4e, 0xab, 0xfc, 0xd4, 0x51, 0xaf, 0xff, 0xff, 0x4a, 0xa7, 
+  0xff, 0xff, 0x42, 0x9e, 0xff, 0xff, 0x2d, 0x94, 0xff, 0xff, 0x19, 0x8b, 0xff, 0xff, 0x0a, 0x85, 0xff, 0xff, 0x81, 0x06, 0x84, 0xff, 0xff, 0x08, 0x0b, 0x86, 0xff, 0xff, 0x1a, 0x8c, 0xff, 0xff, 
+  0x31, 0x96, 0xff, 0xff, 0x4a, 0xa2, 0xff, 0xff, 0x56, 0xad, 0xff, 0xff, 0x61, 0xb8, 0xff, 0xff, 0x62, 0xb7, 0xfc, 0xd3, 0x5a, 0xb0, 0xf7, 0x78, 0x4c, 0x9a, 0xdc, 0x18, 0xa9, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0x26, 0x86, 0xe0, 0x1f, 0x32, 0x99, 0xf8, 0x9b, 0x38, 0xa0, 0xfe, 0xf8, 0x31, 0x99, 0xff, 0xff, 0x19, 0x8b, 0xff, 0xff, 0x01, 0x81, 0xff, 0xff, 0x8b, 0x00, 0x80, 0xff, 0xff, 0x05, 
+  0x02, 0x81, 0xff, 0xff, 0x21, 0x8f, 0xff, 0xff, 0x42, 0xa1, 0xff, 0xff, 0x51, 0xae, 0xfe, 0xf7, 0x4e, 0xaa, 0xf8, 0x97, 0x41, 0x97, 0xe0, 0x1c, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x5d, 
+  0xa7, 0x08, 0x1f, 0x8d, 0xf6, 0x7c, 0x26, 0x95, 0xfe, 0xf4, 0x1d, 0x8e, 0xff, 0xff, 0x04, 0x82, 0xff, 0xff, 0x91, 0x00, 0x80, 0xff, 0xff, 0x04, 0x06, 0x83, 0xff, 0xff, 0x30, 0x97, 0xff, 0xff, 
+  0x43, 0xa6, 0xfe, 0xf4, 0x40, 0xa0, 0xf5, 0x78, 0x23, 0x5f, 0x94, 0x07, 0x92, 0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x01, 0x03, 0x04, 0x01, 0x05, 0x0c, 0x04, 0x03, 
+  0x08, 0x17, 0x04, 0x05, 0x0b, 0x1e, 0x04, 0x06, 0x0f, 0x28, 0x04, 0x07, 0x11, 0x2e, 0x04, 0x08, 0x14, 0x36, 0x04, 0x08, 0x15, 0x3a, 0x04, 0x0d, 0x79, 0xe3, 0x2b, 0x16, 0x8a, 0xfb, 0xcc, 0x14, 
+  0x8a, 0xff, 0xff, 0x03, 0x82, 0xff, 0xff, 0x95, 0x00, 0x80, 0xff, 0xff, 0x0b, 0x06, 0x83, 0xff, 0xff, 0x2d, 0x97, 0xff, 0xff, 0x39, 0x9f, 0xfb, 0xcb, 0x2f, 0x8c, 0xe1, 0x27, 0x08, 0x15, 0x39, 
+  0x04, 0x08, 0x13, 0x34, 0x04, 0x07, 0x11, 0x2d, 0x04, 0x05, 0x0e, 0x26, 0x04, 0x04, 0x0b, 0x1d, 0x04, 0x03, 0x07, 0x14, 0x04, 0x01, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x01, 0x04, 0x87, 0x00, 0x00, 
+  0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0xef, 0xef, 0xef, 0x68, 0xfc, 0xfc, 0xfc, 0xff, 0x8d, 0xfb, 0xfb, 0xfb, 0xff, 0x02, 0xcf, 0xe0, 0xfc, 0xff, 0x27, 0x90, 0xff, 0xff, 0x05, 0x83, 0xff, 
+  0xff, 0x99, 0x00, 0x80, 0xff, 0xff, 0x02, 0x15, 0x89, 0xff, 0xff, 0x44, 0xa2, 0xff, 0xff, 0xd5, 0xe5, 0xfb, 0xff, 0x8d, 0xfb, 0xfb, 0xfb, 0xff, 0x03, 0xf9, 0xf9, 0xf9, 0xe3, 0x00, 0x00, 0x00, 
+  0x07, 0xe4, 0xe4, 0xe4, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x8c, 0xf1, 0xf1, 0xf1, 0xff, 0x02, 0xb8, 0xd0, 0xf5, 0xff, 0x12, 0x88, 0xff, 0xff, 0x01, 0x81, 0xff, 0xff, 0x9b, 0x00, 0x80, 0xff, 0xff, 
+  0x03, 0x05, 0x83, 0xff, 0xff, 0x2b, 0x96, 0xff, 0xff, 0xbe, 0xd5, 0xf5, 0xff, 0xf1, 0xf1, 0xf2, 0xff, 0x8b, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xf1, 0xf1, 0xf1, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe3, 
+  0xe3, 0xe3, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x8a, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xf0, 0xf1, 0xf1, 0xff, 0xba, 0xd1, 0xf4, 0xff, 0x0e, 0x87, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x9d, 0x00, 0x80, 
+  0xff, 0xff, 0x02, 0x02, 0x81, 0xff, 0xff, 0x21, 0x90, 0xff, 0xff, 0xc0, 0xd5, 0xf4, 0xff, 0x8b, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe3, 0xe3, 0xe3, 
+  0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x00, 0xe1, 0xe6, 0xea, 0xff, 0x81, 0xde, 0xe4, 0xe9, 0xff, 0x01, 0xdc, 0xe2, 0xe6, 0xff, 0xe0, 0xe5, 0xea, 0xff, 0x83, 0xdf, 0xe5, 
+  0xea, 0xff, 0x01, 0xc1, 0xd3, 0xee, 0xff, 0x15, 0x89, 0xfe, 0xff, 0xa0, 0x00, 0x80, 0xff, 0xff, 0x04, 0x01, 0x81, 0xff, 0xff, 0x23, 0x90, 0xfe, 0xff, 0xc4, 0xd4, 0xed, 0xff, 0xde, 0xe4, 0xe9, 
+  0xff, 0xcf, 0xe0, 0xe5, 0xff, 0x82, 0xcb, 0xe7, 0xea, 0xff, 0x03, 0xd6, 0xdf, 0xe4, 0xff, 0xcd, 0xe0, 0xe5, 0xff, 0xcb, 0xe7, 0xea, 0xff, 0xe8, 0xed, 0xee, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 
+  0x03, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe3, 0xe3, 0xe3, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x04, 0xd9, 0xe3, 0xec, 0xff, 0xe6, 0xef, 0xf9, 0xff, 0xe7, 
+  0xef, 0xf9, 0xff, 0xe4, 0xec, 0xf6, 0xff, 0xe1, 0xe8, 0xf0, 0xff, 0x82, 0xee, 0xf4, 0xfb, 0xff, 0x02, 0xdb, 0xe9, 0xf8, 0xff, 0x34, 0x92, 0xfe, 0xff, 0x01, 0x80, 0xff, 0xff, 0x8a, 0x00, 0x80, 
+  0xff, 0xff, 0x0b, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x79, 0xf8, 0xff, 0x16, 0x76, 0xe6, 0xff, 0x24, 0x71, 0xcd, 0xff, 0x2d, 0x78, 0xc2, 0xff, 0x2f, 0x79, 0xb9, 0xff, 0x2e, 0x77, 0xb8, 0xff, 0x40, 
+  0x6d, 0xbf, 0xff, 0x37, 0x74, 0xd0, 0xff, 0x11, 0x75, 0xe9, 0xff, 0x00, 0x7a, 0xf9, 0xff, 0x00, 0x7f, 0xfe, 0xff, 0x8a, 0x00, 0x80, 0xff, 0xff, 0x0a, 0x02, 0x80, 0xff, 0xff, 0x3d, 0x96, 0xfd, 
+  0xff, 0xb1, 0xd3, 0xe7, 0xff, 0x7b, 0xf5, 0xf9, 0xff, 0x77, 0xfe, 0xff, 0xff, 0x78, 0xfe, 0xff, 0xff, 0x99, 0xdf, 0xe8, 0xff, 0xab, 0xd6, 0xe2, 0xff, 0x75, 0xfa, 0xfc, 0xff, 0x76, 0xff, 0xff, 
+  0xff, 0xd6, 0xe5, 0xe9, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe3, 0xe3, 0xe3, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 
+  0x00, 0xd8, 0xe2, 0xeb, 0xff, 0x82, 0xe5, 0xee, 0xf8, 0xff, 0x05, 0xe2, 0xec, 0xf6, 0xff, 0xdf, 0xe6, 0xef, 0xff, 0xed, 0xf3, 0xfa, 0xff, 0xeb, 0xf1, 0xf8, 0xff, 0x73, 0xab, 0xfb, 0xff, 0x02, 
+  0x81, 0xff, 0xff, 0x89, 0x00, 0x80, 0xff, 0xff, 0x0e, 0x00, 0x7f, 0xfe, 0xff, 0x0c, 0x77, 0xef, 0xff, 0x52, 0x79, 0xc4, 0xff, 0x6c, 0x7d, 0x97, 0xff, 0x86, 0x8b, 0x91, 0xff, 0x86, 0x8f, 0x97, 
+  0xff, 0x5a, 0x97, 0x9d, 0xff, 0x57, 0xaa, 0xab, 0xff, 0x55, 0xa9, 0xab, 0xff, 0x55, 0x9c, 0xa0, 0xff, 0x7f, 0x89, 0x92, 0xff, 0x84, 0x89, 0x90, 0xff, 0x65, 0x79, 0x99, 0xff, 0x4b, 0x77, 0xc8, 
+  0xff, 0x06, 0x78, 0xf2, 0xff, 0x89, 0x00, 0x80, 0xff, 0xff, 0x0a, 0x00, 0x7f, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x40, 0xb1, 0xfc, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x79, 0xfe, 0xff, 0xff, 0x98, 
+  0xdd, 0xe8, 0xff, 0xa9, 0xd4, 0xe2, 0xff, 0x76, 0xfa, 0xfc, 0xff, 0x75, 0xff, 0xff, 0xff, 0x76, 0xfe, 0xfe, 0xff, 0xd6, 0xe3, 0xe6, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xf0, 0xf0, 0xf0, 
+  0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x00, 0xd6, 0xe1, 0xeb, 0xff, 0x81, 0xe3, 0xec, 0xf7, 0xff, 0x00, 0xdd, 0xe7, 0xf3, 
+  0xff, 0x81, 0xe0, 0xea, 0xf5, 0xff, 0x03, 0xdc, 0xe4, 0xed, 0xff, 0xb3, 0xce, 0xf6, 0xff, 0x05, 0x82, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x88, 0x00, 0x80, 0xff, 0xff, 0x11, 0x01, 0x7b, 0xf9, 
+  0xff, 0x4e, 0x7a, 0xc8, 0xff, 0x83, 0x8c, 0x98, 0xff, 0x9b, 0xa0, 0xa6, 0xff, 0xb3, 0xb8, 0xbf, 0xff, 0xb9, 0xc0, 0xca, 0xff, 0xcd, 0xd5, 0xe0, 0xff, 0xc2, 0xd0, 0xde, 0xff, 0x7a, 0xd6, 0xde, 
+  0xff, 0x77, 0xee, 0xf0, 0xff, 0x76, 0xea, 0xec, 0xff, 0x77, 0xd4, 0xda, 0xff, 0xab, 0xba, 0xc7, 0xff, 0xaa, 0xb2, 0xba, 0xff, 0x8d, 0x93, 0x9b, 0xff, 0x7d, 0x88, 0x98, 0xff, 0x46, 0x78, 0xce, 
+  0xff, 0x00, 0x7c, 0xfb, 0xff, 0x86, 0x00, 0x80, 0xff, 0xff, 0x0b, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x05, 0x80, 0xff, 0xff, 0x5e, 0xd8, 0xf9, 0xff, 0x96, 
+  0xdc, 0xe7, 0xff, 0xa8, 0xd3, 0xe2, 0xff, 0x79, 0xfa, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x75, 0xfe, 0xfe, 0xff, 0x93, 0xce, 0xd8, 0xff, 0xdc, 0xe1, 0xe4, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 
+  0x03, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x09, 0xd5, 0xe0, 0xea, 0xff, 0xe1, 0xeb, 0xf6, 0xff, 0xe0, 
+  0xeb, 0xf6, 0xff, 0xd4, 0xdc, 0xe6, 0xff, 0xd4, 0xdc, 0xe7, 0xff, 0xda, 0xe5, 0xf2, 0xff, 0xd6, 0xe2, 0xf0, 0xff, 0x36, 0x8e, 0xfa, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x87, 
+  0x00, 0x80, 0xff, 0xff, 0x13, 0x13, 0x79, 0xee, 0xff, 0x71, 0x84, 0xab, 0xff, 0x9a, 0x9f, 0xa5, 0xff, 0xbb, 0xc1, 0xc7, 0xff, 0xd5, 0xdc, 0xe3, 0xff, 0xdb, 0xe2, 0xeb, 0xff, 0xda, 0xe4, 0xf1, 
+  0xff, 0xdd, 0xe7, 0xf4, 0xff, 0xd4, 0xdd, 0xe9, 0xff, 0xec, 0xf1, 0xf5, 0xff, 0x8c, 0xec, 0xf2, 0xff, 0x7e, 0xfd, 0xff, 0xff, 0x7e, 0xfc, 0xfe, 0xff, 0x83, 0xe8, 0xf0, 0xff, 0xc7, 0xd6, 0xe5, 
+  0xff, 0xca, 0xd4, 0xdf, 0xff, 0xa9, 0xb0, 0xba, 0xff, 0x96, 0x9b, 0xa0, 0xff, 0x68, 0x81, 0xb1, 0xff, 0x08, 0x7a, 0xf3, 0xff, 0x84, 0x00, 0x80, 0xff, 0xff, 0x81, 0x00, 0x7f, 0xff, 0xff, 0x0a, 
+  0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x26, 0x8a, 0xf8, 0xff, 0xa1, 0xce, 0xde, 0xff, 0x79, 0xf9, 0xfb, 0xff, 0x7a, 0xfe, 0xff, 0xff, 0x77, 0xfe, 0xfe, 0xff, 
+  0x92, 0xcd, 0xd8, 0xff, 0xc7, 0xd1, 0xdc, 0xff, 0xdc, 0xe1, 0xe5, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 
+  0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x0a, 0xcf, 0xda, 0xe4, 0xff, 0xdd, 0xe7, 0xf3, 0xff, 0xdf, 0xea, 0xf5, 0xff, 0xcd, 0xd8, 0xe5, 0xff, 0xfb, 0xfc, 0xfd, 0xff, 0xd4, 0xdd, 0xe8, 0xff, 
+  0x96, 0xba, 0xef, 0xff, 0x02, 0x7e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x85, 0x00, 0x80, 0xff, 0xff, 0x08, 0x1d, 0x7a, 0xec, 0xff, 0x7f, 0x8c, 
+  0xa3, 0xff, 0xa9, 0xaf, 0xb6, 0xff, 0xce, 0xd5, 0xdd, 0xff, 0xe2, 0xe9, 0xf2, 0xff, 0xe0, 0xe8, 0xf2, 0xff, 0xdb, 0xe5, 0xf2, 0xff, 0xdb, 0xe7, 0xf4, 0xff, 0xd5, 0xde, 0xe9, 0xff, 0x81, 0xff, 
+  0xff, 0xff, 0xff, 0x0a, 0xc3, 0xcf, 0xdd, 0xff, 0x80, 0xe5, 0xed, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x75, 0xee, 0xf1, 0xff, 0x83, 0xe9, 0xf1, 0xff, 0xcc, 0xdc, 0xeb, 0xff, 0xd7, 0xe2, 0xee, 0xff, 
+  0xbb, 0xc4, 0xcf, 0xff, 0xa4, 0xa9, 0xb0, 0xff, 0x77, 0x88, 0xa9, 0xff, 0x0d, 0x7a, 0xf2, 0xff, 0x83, 0x00, 0x80, 0xff, 0xff, 0x02, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x7d, 
+  0xff, 0xff, 0x81, 0x00, 0x7c, 0xff, 0xff, 0x07, 0x02, 0x7c, 0xff, 0xff, 0x57, 0xce, 0xf7, 0xff, 0x78, 0xfc, 0xfd, 0xff, 0x78, 0xfd, 0xfe, 0xff, 0x91, 0xcc, 0xd7, 0xff, 0xc5, 0xd0, 0xdb, 0xff, 
+  0xc3, 0xcd, 0xd7, 0xff, 0xdb, 0xe0, 0xe4, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 
+  0xf1, 0xf1, 0xff, 0x08, 0xd6, 0xe1, 0xe9, 0xff, 0xdb, 0xe5, 0xee, 0xff, 0xdb, 0xe6, 0xf2, 0xff, 0xdc, 0xe8, 0xf4, 0xff, 0xca, 0xd6, 0xe3, 0xff, 0xf4, 0xf5, 0xf6, 0xff, 0x3a, 0x8e, 0xf9, 0xff, 
+  0x00, 0x7c, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x81, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x83, 0x00, 0x80, 0xff, 0xff, 0x08, 0x0d, 0x7c, 0xf3, 0xff, 0x7f, 0x8e, 0xa7, 0xff, 
+  0xb0, 0xb6, 0xbe, 0xff, 0xd6, 0xde, 0xe6, 0xff, 0xe4, 0xed, 0xf6, 0xff, 0xdf, 0xe8, 0xf1, 0xff, 0xd8, 0xe4, 0xf1, 0xff, 0xda, 0xe6, 0xf3, 0xff, 0xd4, 0xdd, 0xe8, 0xff, 0x81, 0xff, 0xff, 0xff, 
+  0xff, 0x0c, 0xce, 0xd7, 0xe2, 0xff, 0xc1, 0xcd, 0xdc, 0xff, 0xb6, 0xc5, 0xd6, 0xff, 0x7f, 0xe5, 0xec, 0xff, 0x76, 0xf0, 0xf3, 0xff, 0x77, 0xf0, 0xf3, 0xff, 0x82, 0xea, 0xf2, 0xff, 0xcb, 0xdc, 
+  0xec, 0xff, 0xda, 0xe5, 0xf2, 0xff, 0xc2, 0xcc, 0xd8, 0xff, 0xa9, 0xb0, 0xb7, 0xff, 0x76, 0x89, 0xac, 0xff, 0x04, 0x7c, 0xf8, 0xff, 0x81, 0x00, 0x80, 0xff, 0xff, 0x01, 0x00, 0x7f, 0xff, 0xff, 
+  0x00, 0x7e, 0xff, 0xff, 0x81, 0x00, 0x7d, 0xff, 0xff, 0x09, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x25, 0x95, 0xfb, 0xff, 0x76, 0xf6, 0xf8, 0xff, 0x90, 0xcb, 
+  0xd8, 0xff, 0xc2, 0xce, 0xdb, 0xff, 0xc1, 0xcb, 0xd7, 0xff, 0xd1, 0xd8, 0xe1, 0xff, 0xdd, 0xe2, 0xe6, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
+  0xe2, 0xe2, 0xe2, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x06, 0xd8, 0xe1, 0xea, 0xff, 0xe5, 0xee, 0xf7, 0xff, 0xda, 0xe3, 0xed, 0xff, 0xd9, 0xe5, 0xf1, 0xff, 0xd9, 0xe5, 
+  0xf3, 0xff, 0x9e, 0xbb, 0xe1, 0xff, 0x03, 0x7d, 0xff, 0xff, 0x81, 0x00, 0x7c, 0xff, 0xff, 0x01, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x81, 0x00, 0x7f, 0xff, 0xff, 0x81, 0x00, 0x80, 
+  0xff, 0xff, 0x08, 0x00, 0x7e, 0xfd, 0xff, 0x6e, 0x88, 0xb7, 0xff, 0xae, 0xb4, 0xbb, 0xff, 0xd7, 0xde, 0xe8, 0xff, 0xe4, 0xec, 0xf6, 0xff, 0xde, 0xe7, 0xf1, 0xff, 0xd7, 0xe2, 0xf0, 0xff, 0xd8, 
+  0xe4, 0xf3, 0xff, 0xd4, 0xdd, 0xe9, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x10, 0xce, 0xd7, 0xe2, 0xff, 0xc0, 0xcb, 0xdb, 0xff, 0xc1, 0xca, 0xd8, 0xff, 0xc0, 0xc9, 0xd7, 0xff, 0xb5, 0xc4, 0xd5, 
+  0xff, 0x7f, 0xe5, 0xec, 0xff, 0x79, 0xf6, 0xf8, 0xff, 0x79, 0xf3, 0xf6, 0xff, 0x83, 0xea, 0xf2, 0xff, 0xc9, 0xdb, 0xeb, 0xff, 0xd8, 0xe5, 0xf3, 0xff, 0xc2, 0xcc, 0xd8, 0xff, 0xa3, 0xa9, 0xb1, 
+  0xff, 0x5a, 0x7f, 0xbe, 0xff, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x81, 0x00, 0x7d, 0xff, 0xff, 0x01, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x81, 
+  0x00, 0x7a, 0xff, 0xff, 0x06, 0x03, 0x7b, 0xff, 0xff, 0x7c, 0xb3, 0xd7, 0xff, 0xc1, 0xcc, 0xda, 0xff, 0xbf, 0xc9, 0xd6, 0xff, 0xd1, 0xd8, 0xe1, 0xff, 0xd5, 0xdd, 0xe5, 0xff, 0xdd, 0xe2, 0xe6, 
+  0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe1, 0xe1, 0xe1, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x00, 0xd6, 0xe1, 0xea, 
+  0xff, 0x81, 0xe4, 0xed, 0xf6, 0xff, 0x04, 0xd3, 0xde, 0xea, 0xff, 0xd5, 0xe2, 0xef, 0xff, 0x7c, 0xa7, 0xf2, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x81, 0x00, 0x7c, 0xff, 0xff, 
+  0x01, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x81, 0x00, 0x7f, 0xff, 0xff, 0x08, 0x00, 0x80, 0xff, 0xff, 0x45, 0x80, 0xdb, 0xff, 0xa2, 0xa9, 0xb0, 0xff, 0xd1, 0xd9, 0xe2, 0xff, 0xe2, 
+  0xeb, 0xf5, 0xff, 0xdc, 0xe6, 0xf1, 0xff, 0xd5, 0xe1, 0xef, 0xff, 0xd5, 0xe3, 0xf2, 0xff, 0xd4, 0xdd, 0xe9, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x07, 0xce, 0xd7, 0xe2, 0xff, 0xbf, 0xcb, 0xda, 
+  0xff, 0xbb, 0xc6, 0xd4, 0xff, 0xd0, 0xd9, 0xe3, 0xff, 0xd2, 0xda, 0xe4, 0xff, 0xbe, 0xc8, 0xd5, 0xff, 0xb3, 0xc3, 0xd4, 0xff, 0x7c, 0xe5, 0xec, 0xff, 0x81, 0x7d, 0xfd, 0xff, 0xff, 0x05, 0x83, 
+  0xea, 0xf2, 0xff, 0xc7, 0xda, 0xeb, 0xff, 0xd6, 0xe3, 0xf1, 0xff, 0xbe, 0xc9, 0xd7, 0xff, 0x95, 0x9e, 0xa8, 0xff, 0x29, 0x79, 0xe2, 0xff, 0x81, 0x00, 0x7e, 0xff, 0xff, 0x01, 0x00, 0x7d, 0xff, 
+  0xff, 0x00, 0x7c, 0xff, 0xff, 0x81, 0x00, 0x7b, 0xff, 0xff, 0x08, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x78, 0xff, 0xff, 0x73, 0x9d, 0xe8, 0xff, 0xbb, 0xc5, 0xd2, 0xff, 0xce, 
+  0xd7, 0xe0, 0xff, 0xd4, 0xdc, 0xe5, 0xff, 0xd5, 0xdc, 0xe5, 0xff, 0xdc, 0xe1, 0xe5, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0xe2, 0xe2, 
+  0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x08, 0xcf, 0xda, 0xe4, 0xff, 0xe2, 0xec, 0xf6, 0xff, 0xd8, 0xe2, 0xed, 0xff, 0xd4, 0xe1, 0xef, 0xff, 0xcb, 0xd8, 0xe6, 0xff, 0x2b, 
+  0x86, 0xf9, 0xff, 0x00, 0x79, 0xff, 0xff, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x81, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x00, 0x7d, 0xff, 0xff, 0x81, 0x00, 0x7e, 0xff, 0xff, 0x07, 0x01, 
+  0x7d, 0xfc, 0xff, 0x85, 0x96, 0xae, 0xff, 0xc3, 0xcb, 0xd5, 0xff, 0xdf, 0xe9, 0xf4, 0xff, 0xda, 0xe5, 0xf1, 0xff, 0xd3, 0xe0, 0xef, 0xff, 0xd4, 0xe2, 0xf1, 0xff, 0xd4, 0xdd, 0xe8, 0xff, 0x81, 
+  0xff, 0xff, 0xff, 0xff, 0x09, 0xcd, 0xd6, 0xe1, 0xff, 0xbd, 0xc9, 0xd8, 0xff, 0xbd, 0xca, 0xd8, 0xff, 0xbf, 0xcb, 0xd9, 0xff, 0xc5, 0xcf, 0xda, 0xff, 0xd2, 0xdc, 0xe5, 0xff, 0xd0, 0xda, 0xe3, 
+  0xff, 0xbc, 0xc7, 0xd4, 0xff, 0xb1, 0xc2, 0xd3, 0xff, 0x7c, 0xe4, 0xeb, 0xff, 0x81, 0x7d, 0xfd, 0xff, 0xff, 0x07, 0x82, 0xe9, 0xf1, 0xff, 0xc6, 0xd8, 0xea, 0xff, 0xd3, 0xdf, 0xee, 0xff, 0x96, 
+  0xb0, 0xc0, 0xff, 0x43, 0x91, 0xb6, 0xff, 0x00, 0x7c, 0xfe, 0xff, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x81, 0x00, 0x7b, 0xff, 0xff, 0x01, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x79, 0xff, 
+  0xff, 0x81, 0x00, 0x78, 0xff, 0xff, 0x05, 0x2a, 0x81, 0xf4, 0xff, 0xc4, 0xcd, 0xd6, 0xff, 0xd2, 0xdb, 0xe4, 0xff, 0xd3, 0xdc, 0xe5, 0xff, 0xd3, 0xdc, 0xe4, 0xff, 0xdc, 0xe1, 0xe5, 0xff, 0x81, 
+  0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe1, 0xe1, 0xe1, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x06, 0xcb, 0xd8, 0xe4, 0xff, 0xcf, 
+  0xdb, 0xe7, 0xff, 0xd2, 0xe0, 0xee, 0xff, 0xd1, 0xdf, 0xed, 0xff, 0xb2, 0xc6, 0xde, 0xff, 0x02, 0x79, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x81, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x00, 0x7b, 0xff, 
+  0xff, 0x81, 0x00, 0x7c, 0xff, 0xff, 0x08, 0x00, 0x7d, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xff, 0x40, 0x81, 0xe0, 0xff, 0xab, 0xb2, 0xbb, 0xff, 0xd7, 0xe0, 0xeb, 0xff, 0xd9, 0xe3, 0xef, 0xff, 0xd1, 
+  0xdf, 0xee, 0xff, 0xd2, 0xe0, 0xf0, 0xff, 0xd3, 0xdc, 0xe8, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xcc, 0xd5, 0xe0, 0xff, 0xbb, 0xc9, 0xd7, 0xff, 0xbe, 0xc9, 0xd4, 0xff, 0xc4, 0xce, 0xd9, 
+  0xff, 0xc2, 0xcc, 0xd7, 0xff, 0xd1, 0xdb, 0xe4, 0xff, 0x81, 0xd1, 0xda, 0xe4, 0xff, 0x0b, 0xd0, 0xd9, 0xe3, 0xff, 0xbb, 0xc6, 0xd4, 0xff, 0xb0, 0xc1, 0xd3, 0xff, 0x7e, 0xe4, 0xeb, 0xff, 0x7d, 
+  0xfd, 0xff, 0xff, 0x7e, 0xfd, 0xff, 0xff, 0x81, 0xe9, 0xf1, 0xff, 0xa6, 0xcc, 0xe0, 0xff, 0x77, 0xe5, 0xe9, 0xff, 0x5d, 0xb9, 0xba, 0xff, 0x16, 0x7f, 0xea, 0xff, 0x00, 0x7c, 0xff, 0xff, 0x81, 
+  0x00, 0x7b, 0xff, 0xff, 0x00, 0x00, 0x7a, 0xff, 0xff, 0x81, 0x00, 0x79, 0xff, 0xff, 0x07, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x02, 0x77, 0xff, 0xff, 0xa2, 0xb5, 0xcb, 0xff, 0xce, 
+  0xd7, 0xe1, 0xff, 0xd1, 0xda, 0xe4, 0xff, 0xce, 0xd7, 0xe0, 0xff, 0xdb, 0xe0, 0xe4, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe1, 0xe1, 0xe1, 
+  0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x04, 0xcb, 0xd9, 0xe6, 0xff, 0xd3, 0xe1, 0xf0, 0xff, 0xd0, 0xde, 0xed, 0xff, 0xd2, 0xdd, 0xe9, 0xff, 0xa0, 0xbc, 0xe8, 0xff, 0x81, 
+  0x00, 0x78, 0xff, 0xff, 0x00, 0x00, 0x79, 0xff, 0xff, 0x81, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x00, 0x7b, 0xff, 0xff, 0x81, 0x00, 0x7c, 0xff, 0xff, 0x06, 0x00, 0x7d, 0xff, 0xff, 0x6e, 0x8b, 0xc0, 
+  0xff, 0xc3, 0xcb, 0xd5, 0xff, 0xd6, 0xe0, 0xec, 0xff, 0xcf, 0xdd, 0xed, 0xff, 0xd0, 0xdf, 0xef, 0xff, 0xd2, 0xdb, 0xe7, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfa, 0xfb, 0xfc, 0xff, 0xb4, 
+  0xc2, 0xd1, 0xff, 0xb8, 0xc5, 0xd4, 0xff, 0xc7, 0xd1, 0xdc, 0xff, 0xd1, 0xda, 0xe3, 0xff, 0xd0, 0xda, 0xe3, 0xff, 0xd1, 0xda, 0xe3, 0xff, 0x82, 0xd0, 0xda, 0xe4, 0xff, 0x09, 0xce, 0xd8, 0xe3, 
+  0xff, 0xb9, 0xc5, 0xd3, 0xff, 0xad, 0xc0, 0xd2, 0xff, 0x7d, 0xe4, 0xeb, 0xff, 0x7d, 0xfd, 0xff, 0xff, 0x7e, 0xfd, 0xff, 0xff, 0x7e, 0xfc, 0xfe, 0xff, 0x7b, 0xf5, 0xf7, 0xff, 0x6b, 0xd5, 0xd7, 
+  0xff, 0x3b, 0x86, 0xca, 0xff, 0x81, 0x00, 0x7b, 0xff, 0xff, 0x00, 0x00, 0x7a, 0xff, 0xff, 0x81, 0x00, 0x79, 0xff, 0xff, 0x01, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x81, 0x00, 0x76, 
+  0xff, 0xff, 0x04, 0x88, 0xa7, 0xd5, 0xff, 0xb9, 0xc5, 0xd2, 0xff, 0xca, 0xd4, 0xde, 0xff, 0xb9, 0xc5, 0xd2, 0xff, 0xda, 0xe0, 0xe4, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xef, 0xef, 0xef, 
+  0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe1, 0xe1, 0xe1, 0x70, 0xf2, 0xf2, 0xf2, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x04, 0xc9, 0xd8, 0xe6, 0xff, 0xce, 0xdc, 0xec, 0xff, 0xd3, 0xde, 0xeb, 0xff, 0xda, 
+  0xe4, 0xf0, 0xff, 0x8f, 0xab, 0xea, 0xff, 0x81, 0x00, 0x77, 0xff, 0xff, 0x01, 0x00, 0x78, 0xff, 0xff, 0x00, 0x79, 0xff, 0xff, 0x81, 0x00, 0x7a, 0xff, 0xff, 0x07, 0x00, 0x7b, 0xff, 0xff, 0x00, 
+  0x7c, 0xff, 0xff, 0x00, 0x7b, 0xfe, 0xff, 0x8c, 0x9d, 0xb3, 0xff, 0xc0, 0xcc, 0xda, 0xff, 0xcd, 0xdb, 0xed, 0xff, 0xce, 0xdd, 0xee, 0xff, 0xd1, 0xdb, 0xe7, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 
+  0x07, 0xcc, 0xd5, 0xe1, 0xff, 0xd6, 0xdc, 0xe4, 0xff, 0xf6, 0xf7, 0xf9, 0xff, 0xb4, 0xc1, 0xd0, 0xff, 0xb8, 0xc5, 0xd4, 0xff, 0xc6, 0xd0, 0xdb, 0xff, 0xcf, 0xd9, 0xe3, 0xff, 0xd0, 0xd9, 0xe3, 
+  0xff, 0x81, 0xcf, 0xd9, 0xe3, 0xff, 0x0a, 0xcf, 0xd9, 0xe4, 0xff, 0xcf, 0xd8, 0xe4, 0xff, 0xcd, 0xd7, 0xe3, 0xff, 0xb6, 0xc2, 0xd2, 0xff, 0xad, 0xbf, 0xd2, 0xff, 0x7a, 0xe5, 0xed, 0xff, 0x7e, 
+  0xfd, 0xff, 0xff, 0x75, 0xeb, 0xef, 0xff, 0x7e, 0xfa, 0xfc, 0xff, 0x82, 0xc8, 0xd6, 0xff, 0x63, 0x88, 0xae, 0xff, 0x81, 0x00, 0x7a, 0xff, 0xff, 0x81, 0x00, 0x79, 0xff, 0xff, 0x01, 0x00, 0x78, 
+  0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x81, 0x00, 0x76, 0xff, 0xff, 0x05, 0x00, 0x75, 0xff, 0xff, 0x78, 0x99, 0xdc, 0xff, 0xb7, 0xc4, 0xd4, 0xff, 0xb5, 0xc3, 0xd2, 0xff, 0xbb, 0xc9, 0xd8, 0xff, 
+  0xda, 0xdf, 0xe4, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x03, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xe0, 0xe0, 0x70, 0xf1, 0xf1, 0xf1, 0xff, 0x81, 0xf0, 0xf0, 0xf0, 0xff, 0x05, 
+  0xc4, 0xd3, 0xe0, 0xff, 0xcf, 0xdc, 0xe8, 0xff, 0xdc, 0xe7, 0xf3, 0xff, 0xd5, 0xe0, 0xeb, 0xff, 0x75, 0x9c, 0xeb, 0xff, 0x00, 0x76, 0xff, 0xff, 0x81, 0x00, 0x77, 0xff, 0xff, 0x00, 0x00, 0x78, 
+  0xff, 0xff, 0x81, 0x00, 0x79, 0xff, 0xff, 0x11, 0x00, 0x7a, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xff, 0x0f, 0x7a, 0xf1, 0xff, 0x9e, 0xab, 0xba, 0xff, 0xc8, 0xd7, 0xe9, 0xff, 0xcb, 0xda, 0xed, 0xff, 
+  0xcf, 0xd9, 0xe6, 0xff, 0xdf, 0xe0, 0xe2, 0xff, 0xfc, 0xfd, 0xfd, 0xff, 0xcb, 0xd4, 0xe0, 0xff, 0xb6, 0xc4, 0xd6, 0xff, 0xaf, 0xbe, 0xd1, 0xff, 0xd4, 0xdb, 0xe3, 0xff, 0xf4, 0xf5, 0xf7, 0xff, 
+  0xb3, 0xc0, 0xcf, 0xff, 0xb5, 0xc2, 0xd1, 0xff, 0xc5, 0xce, 0xda, 0xff, 0xcd, 0xd7, 0xe1, 0xff, 0x81, 0xcd, 0xd6, 0xe1, 0xff, 0x0b, 0xcd, 0xd6, 0xe2, 0xff, 0xcc, 0xd7, 0xe2, 0xff, 0xc0, 0xcb, 
+  0xd8, 0xff, 0xb4, 0xc2, 0xd4, 0xff, 0x9a, 0xbd, 0xd0, 0xff, 0x7a, 0xf1, 0xf5, 0xff, 0x6c, 0xdc, 0xe1, 0xff, 0x7c, 0xf9, 0xfc, 0xff, 0x7d, 0xfb, 0xfd, 0xff, 0x79, 0xe1, 0xe9, 0xff, 0x5e, 0xb9, 
+  0xbe, 0xff, 0x01, 0x79, 0xfc, 0xff, 0x81, 0x00, 0x79, 0xff, 0xff, 0x01, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x81, 0x00, 0x76, 0xff, 0xff, 0x06, 0x00, 0x75, 0xff, 0xff, 0x00, 0x74, 
+  0xff, 0xff, 0x65, 0x8c, 0xde, 0xff, 0xaf, 0xbd, 0xcd, 0xff, 0xb7, 0xc5, 0xd6, 0xff, 0xb8, 0xc7, 0xd7, 0xff, 0xd8, 0xde, 0xe3, 0xff, 0x81, 0xf0, 0xf0, 0xf0, 0xff, 0x03, 0xee, 0xee, 0xee, 0xe4, 
+  0x00, 0x00, 0x00, 0x0b, 0xda, 0xda, 0xda, 0x70, 0xeb, 0xeb, 0xeb, 0xff, 0x81, 0xea, 0xea, 0xea, 0xff, 0x06, 0xc6, 0xd2, 0xdd, 0xff, 0xd6, 0xe1, 0xec, 0xff, 0xd5, 0xe1, 0xed, 0xff, 0xcc, 0xd7, 
+  0xe2, 0xff, 0x5d, 0x90, 0xeb, 0xff, 0x00, 0x75, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 0x81, 0x00, 0x77, 0xff, 0xff, 0x00, 0x00, 0x78, 0xff, 0xff, 0x81, 0x00, 0x79, 0xff, 0xff, 0x1e, 0x00, 0x7a, 
+  0xff, 0xff, 0x36, 0x84, 0xeb, 0xff, 0xa5, 0xaf, 0xbc, 0xff, 0xbc, 0xcc, 0xe1, 0xff, 0xc9, 0xd4, 0xe2, 0xff, 0xe6, 0xe7, 0xe9, 0xff, 0xf2, 0xf2, 0xf4, 0xff, 0xc5, 0xce, 0xda, 0xff, 0xae, 0xbd, 
+  0xd0, 0xff, 0xb1, 0xbd, 0xcc, 0xff, 0xae, 0xbc, 0xcc, 0xff, 0xaa, 0xb9, 0xcb, 0xff, 0xcf, 0xd5, 0xdd, 0xff, 0xee, 0xef, 0xf1, 0xff, 0xac, 0xb9, 0xc8, 0xff, 0xae, 0xbc, 0xcb, 0xff, 0xbf, 0xc9, 
+  0xd4, 0xff, 0xc6, 0xd1, 0xdb, 0xff, 0xc7, 0xd1, 0xdb, 0xff, 0xc7, 0xd1, 0xdc, 0xff, 0xbb, 0xc6, 0xd3, 0xff, 0xae, 0xbc, 0xce, 0xff, 0x95, 0xb7, 0xca, 0xff, 0x76, 0xec, 0xf0, 0xff, 0x78, 0xf5, 
+  0xf7, 0xff, 0x79, 0xf4, 0xf6, 0xff, 0x78, 0xe7, 0xee, 0xff, 0x7a, 0xf5, 0xf8, 0xff, 0x78, 0xf1, 0xf4, 0xff, 0x63, 0xc7, 0xca, 0xff, 0x0b, 0x7d, 0xf3, 0xff, 0x81, 0x00, 0x78, 0xff, 0xff, 0x00, 
+  0x00, 0x77, 0xff, 0xff, 0x81, 0x00, 0x76, 0xff, 0xff, 0x00, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 0x0a, 0x50, 0x84, 0xe1, 0xff, 0xaa, 0xb7, 0xc8, 0xff, 0xb1, 0xc0, 0xd1, 0xff, 
+  0xb2, 0xc1, 0xd1, 0xff, 0xd3, 0xd9, 0xde, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xea, 0xea, 0xea, 0xff, 0xe8, 0xe8, 0xe8, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xd4, 0xd4, 0xd4, 0x70, 0xe5, 0xe5, 0xe5, 0xff, 
+  0x81, 0xe4, 0xe4, 0xe4, 0xff, 0x04, 0xc4, 0xd0, 0xdb, 0xff, 0xce, 0xda, 0xe6, 0xff, 0xce, 0xd9, 0xe6, 0xff, 0xc2, 0xce, 0xda, 0xff, 0x50, 0x8a, 0xe9, 0xff, 0x81, 0x00, 0x75, 0xff, 0xff, 0x00, 
+  0x00, 0x76, 0xff, 0xff, 0x81, 0x00, 0x77, 0xff, 0xff, 0x81, 0x00, 0x78, 0xff, 0xff, 0x20, 0x00, 0x79, 0xff, 0xff, 0x38, 0x80, 0xe4, 0xff, 0xcf, 0xd0, 0xd3, 0xff, 0xd1, 0xd7, 0xe0, 0xff, 0xea, 
+  0xeb, 0xed, 0xff, 0xec, 0xed, 0xee, 0xff, 0xbf, 0xc9, 0xd6, 0xff, 0xa8, 0xb7, 0xcb, 0xff, 0xab, 0xb8, 0xc8, 0xff, 0xbf, 0xc9, 0xd6, 0xff, 0xba, 0xc5, 0xd1, 0xff, 0xa8, 0xb6, 0xc6, 0xff, 0xa4, 
+  0xb3, 0xc4, 0xff, 0xc9, 0xd0, 0xd6, 0xff, 0xe8, 0xe9, 0xeb, 0xff, 0xa1, 0xaf, 0xc0, 0xff, 0xa8, 0xb6, 0xc5, 0xff, 0xb9, 0xc3, 0xce, 0xff, 0xc0, 0xca, 0xd5, 0xff, 0xb5, 0xc0, 0xcc, 0xff, 0xa8, 
+  0xb6, 0xc7, 0xff, 0x90, 0xb1, 0xc3, 0xff, 0x71, 0xe6, 0xea, 0xff, 0x74, 0xf0, 0xf2, 0xff, 0x75, 0xef, 0xf2, 0xff, 0x84, 0xca, 0xd9, 0xff, 0x8a, 0xbb, 0xd0, 0xff, 0x77, 0xef, 0xf2, 0xff, 0x76, 
+  0xec, 0xef, 0xff, 0x66, 0xca, 0xce, 0xff, 0x11, 0x7f, 0xf1, 0xff, 0x00, 0x78, 0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x81, 0x00, 0x76, 0xff, 0xff, 0x00, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x74, 
+  0xff, 0xff, 0x0a, 0x00, 0x73, 0xff, 0xff, 0x44, 0x7f, 0xe3, 0xff, 0xa2, 0xb0, 0xc1, 0xff, 0xaa, 0xb9, 0xca, 0xff, 0xab, 0xba, 0xca, 0xff, 0xcd, 0xd3, 0xd7, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 
+  0xe4, 0xe4, 0xff, 0xe2, 0xe2, 0xe2, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xcf, 0xcf, 0xcf, 0x70, 0x82, 0xde, 0xde, 0xde, 0xff, 0x05, 0xbe, 0xca, 0xd4, 0xff, 0xc8, 0xd3, 0xdf, 0xff, 0xc7, 0xd3, 0xdf, 
+  0xff, 0xb5, 0xc1, 0xcc, 0xff, 0x47, 0x81, 0xe2, 0xff, 0x00, 0x74, 0xff, 0xff, 0x81, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x76, 0xff, 0xff, 0x00, 0x00, 0x77, 0xff, 0xff, 0x81, 0x00, 0x78, 0xff, 
+  0xff, 0x14, 0x2d, 0x7d, 0xe7, 0xff, 0xb5, 0xba, 0xc4, 0xff, 0xe8, 0xe8, 0xeb, 0xff, 0xe9, 0xea, 0xec, 0xff, 0xb9, 0xc3, 0xd1, 0xff, 0xa0, 0xb1, 0xc6, 0xff, 0xa5, 0xb3, 0xc4, 0xff, 0xb8, 0xc4, 
+  0xd2, 0xff, 0xb9, 0xc4, 0xd1, 0xff, 0xb9, 0xc3, 0xd1, 0xff, 0xb4, 0xc0, 0xcc, 0xff, 0xa2, 0xb1, 0xbf, 0xff, 0x9f, 0xaf, 0xbe, 0xff, 0xad, 0xb8, 0xc3, 0xff, 0x9e, 0xad, 0xbd, 0xff, 0xa5, 0xb4, 
+  0xc3, 0xff, 0xa3, 0xb2, 0xbf, 0xff, 0xa9, 0xb5, 0xc0, 0xff, 0xa2, 0xb2, 0xc1, 0xff, 0x8b, 0xad, 0xbe, 0xff, 0x6c, 0xe0, 0xe4, 0xff, 0x81, 0x70, 0xe9, 0xec, 0xff, 0x08, 0x7f, 0xc4, 0xd4, 0xff, 
+  0x8a, 0xb7, 0xcc, 0xff, 0x72, 0xe4, 0xe9, 0xff, 0x73, 0xe8, 0xec, 0xff, 0x72, 0xe6, 0xeb, 0xff, 0x64, 0xc8, 0xcc, 0xff, 0x10, 0x7e, 0xf2, 0xff, 0x00, 0x77, 0xff, 0xff, 0x00, 0x76, 0xff, 0xff, 
+  0x81, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 0x06, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x45, 0x7d, 0xde, 0xff, 0x99, 0xa8, 0xb9, 0xff, 0x9b, 0xac, 0xbe, 0xff, 0xa5, 
+  0xb4, 0xc4, 0xff, 0xc7, 0xcd, 0xd2, 0xff, 0x81, 0xde, 0xde, 0xde, 0xff, 0x03, 0xdb, 0xdb, 0xdb, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xc9, 0xc9, 0xc9, 0x70, 0xd9, 0xd9, 0xd9, 0xff, 0x81, 0xd8, 0xd8, 
+  0xd8, 0xff, 0x05, 0xad, 0xba, 0xc6, 0xff, 0xbe, 0xca, 0xd7, 0xff, 0xb8, 0xc5, 0xd2, 0xff, 0xa4, 0xb3, 0xc3, 0xff, 0x52, 0x82, 0xde, 0xff, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 
+  0x00, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x76, 0xff, 0xff, 0x81, 0x00, 0x77, 0xff, 0xff, 0x07, 0x22, 0x7e, 0xf0, 0xff, 0xc9, 0xca, 0xcd, 0xff, 0xe0, 0xe1, 0xe5, 0xff, 0xb3, 0xbc, 0xcc, 0xff, 
+  0x9b, 0xab, 0xc1, 0xff, 0x9e, 0xac, 0xbe, 0xff, 0xb1, 0xbd, 0xcc, 0xff, 0xb2, 0xbe, 0xcc, 0xff, 0x81, 0xb3, 0xbe, 0xcb, 0xff, 0x03, 0xb4, 0xbe, 0xca, 0xff, 0xaf, 0xba, 0xc5, 0xff, 0x9d, 0xab, 
+  0xb9, 0xff, 0x9f, 0xae, 0xbd, 0xff, 0x81, 0xa0, 0xaf, 0xbd, 0xff, 0x03, 0xa0, 0xae, 0xbd, 0xff, 0x9f, 0xae, 0xbe, 0xff, 0x86, 0xa6, 0xb7, 0xff, 0x69, 0xd9, 0xdd, 0xff, 0x81, 0x6c, 0xe3, 0xe5, 
+  0xff, 0x08, 0x7b, 0xbf, 0xce, 0xff, 0x85, 0xb2, 0xc7, 0xff, 0x6e, 0xdd, 0xe3, 0xff, 0x6f, 0xe2, 0xe6, 0xff, 0x70, 0xe1, 0xe5, 0xff, 0x7d, 0xb8, 0xcb, 0xff, 0x63, 0xae, 0xb9, 0xff, 0x0a, 0x7c, 
+  0xfa, 0xff, 0x00, 0x76, 0xff, 0xff, 0x81, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 0x07, 0x00, 0x73, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x00, 0x71, 0xff, 0xff, 0x4b, 0x7a, 0xd7, 
+  0xff, 0xa0, 0xaa, 0xb5, 0xff, 0xc8, 0xcc, 0xd2, 0xff, 0x97, 0xa6, 0xb8, 0xff, 0xc2, 0xc7, 0xcc, 0xff, 0x81, 0xd8, 0xd8, 0xd8, 0xff, 0x02, 0xd6, 0xd6, 0xd6, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xc3, 
+  0xc3, 0xc3, 0x70, 0x82, 0xd2, 0xd2, 0xd2, 0xff, 0x06, 0xa8, 0xb7, 0xc5, 0xff, 0xa7, 0xb6, 0xc6, 0xff, 0xa7, 0xb7, 0xc9, 0xff, 0xa2, 0xb1, 0xc3, 0xff, 0x5f, 0x82, 0xd3, 0xff, 0x00, 0x72, 0xff, 
+  0xff, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 0x81, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x76, 0xff, 0xff, 0x04, 0x06, 0x79, 0xfd, 0xff, 0xbc, 0xc0, 0xc6, 0xff, 0xab, 0xb5, 0xc5, 
+  0xff, 0x94, 0xa5, 0xbc, 0xff, 0x98, 0xa6, 0xba, 0xff, 0x81, 0xab, 0xb7, 0xc7, 0xff, 0x06, 0xac, 0xb7, 0xc6, 0xff, 0xaa, 0xb5, 0xc4, 0xff, 0xac, 0xb7, 0xc5, 0xff, 0xad, 0xb8, 0xc5, 0xff, 0xad, 
+  0xb8, 0xc4, 0xff, 0xa8, 0xb3, 0xbf, 0xff, 0x97, 0xa5, 0xb4, 0xff, 0x82, 0x99, 0xa8, 0xb8, 0xff, 0x0c, 0x81, 0xa1, 0xb2, 0xff, 0x66, 0xd3, 0xd7, 0xff, 0x68, 0xdd, 0xdf, 0xff, 0x68, 0xdc, 0xdf, 
+  0xff, 0x76, 0xb9, 0xc8, 0xff, 0x81, 0xac, 0xc1, 0xff, 0x69, 0xd7, 0xdc, 0xff, 0x6a, 0xdb, 0xe0, 0xff, 0x6c, 0xda, 0xe0, 0xff, 0x7c, 0xb3, 0xc7, 0xff, 0xa5, 0xb7, 0xce, 0xff, 0x80, 0x9a, 0xb9, 
+  0xff, 0x03, 0x78, 0xff, 0xff, 0x81, 0x00, 0x75, 0xff, 0xff, 0x00, 0x00, 0x74, 0xff, 0xff, 0x81, 0x00, 0x73, 0xff, 0xff, 0x00, 0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x04, 0x69, 
+  0x85, 0xd0, 0xff, 0xd0, 0xd1, 0xd2, 0xff, 0xa3, 0xad, 0xb9, 0xff, 0x97, 0xa7, 0xb7, 0xff, 0xbc, 0xc1, 0xc7, 0xff, 0x81, 0xd2, 0xd2, 0xd2, 0xff, 0x02, 0xcf, 0xcf, 0xcf, 0xe4, 0x00, 0x00, 0x00, 
+  0x0b, 0xbd, 0xbd, 0xbd, 0x70, 0x82, 0xcc, 0xcc, 0xcc, 0xff, 0x04, 0x9e, 0xad, 0xbb, 0xff, 0xa4, 0xb5, 0xc7, 0xff, 0xa4, 0xb4, 0xc7, 0xff, 0x9a, 0xa9, 0xba, 0xff, 0x67, 0x86, 0xc1, 0xff, 0x81, 
+  0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x73, 0xff, 0xff, 0x00, 0x00, 0x74, 0xff, 0xff, 0x82, 0x00, 0x75, 0xff, 0xff, 0x09, 0x00, 0x76, 0xff, 0xff, 0x71, 0x8f, 0xbd, 0xff, 0x8b, 0x9d, 0xb5, 0xff, 
+  0x90, 0x9e, 0xb4, 0xff, 0xa4, 0xb0, 0xc2, 0xff, 0xa4, 0xb0, 0xc1, 0xff, 0xa5, 0xb0, 0xc1, 0xff, 0x9c, 0xa8, 0xb9, 0xff, 0x8d, 0x9c, 0xb0, 0xff, 0x9f, 0xaa, 0xb9, 0xff, 0x81, 0xa6, 0xb1, 0xbf, 
+  0xff, 0x11, 0xa7, 0xb2, 0xbe, 0xff, 0xa3, 0xad, 0xba, 0xff, 0x90, 0x9e, 0xaf, 0xff, 0x93, 0xa2, 0xb3, 0xff, 0x7c, 0x9c, 0xad, 0xff, 0x63, 0xcd, 0xd1, 0xff, 0x66, 0xd6, 0xd8, 0xff, 0x65, 0xd6, 
+  0xd9, 0xff, 0x71, 0xb2, 0xc2, 0xff, 0x7b, 0xa6, 0xba, 0xff, 0x66, 0xd1, 0xd6, 0xff, 0x69, 0xd5, 0xda, 0xff, 0x67, 0xd4, 0xd9, 0xff, 0x76, 0xac, 0xc0, 0xff, 0xa0, 0xb2, 0xca, 0xff, 0x9e, 0xb0, 
+  0xc7, 0xff, 0x6f, 0x96, 0xce, 0xff, 0x00, 0x75, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 0x00, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x05, 0x00, 
+  0x70, 0xff, 0xff, 0x85, 0x98, 0xc7, 0xff, 0x95, 0x9f, 0xac, 0xff, 0x91, 0x9f, 0xb2, 0xff, 0x93, 0xa2, 0xb2, 0xff, 0xb6, 0xbb, 0xc0, 0xff, 0x81, 0xcc, 0xcc, 0xcc, 0xff, 0x02, 0xc9, 0xc9, 0xc9, 
+  0xe4, 0x00, 0x00, 0x00, 0x0b, 0xb7, 0xb7, 0xb7, 0x70, 0x82, 0xc6, 0xc6, 0xc6, 0xff, 0x07, 0xb2, 0xb8, 0xbe, 0xff, 0x9b, 0xaa, 0xb9, 0xff, 0x9d, 0xae, 0xc1, 0xff, 0x97, 0xa5, 0xb6, 0xff, 0x77, 
+  0x8c, 0xac, 0xff, 0x00, 0x70, 0xfe, 0xff, 0x00, 0x71, 0xff, 0xff, 0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 0x81, 0x00, 0x75, 0xff, 0xff, 0x03, 0x49, 
+  0x7f, 0xd8, 0xff, 0x82, 0x93, 0xac, 0xff, 0x86, 0x97, 0xaf, 0xff, 0x98, 0xa5, 0xb8, 0xff, 0x81, 0x9d, 0xaa, 0xbc, 0xff, 0x11, 0x93, 0xa0, 0xb3, 0xff, 0x88, 0x99, 0xae, 0xff, 0x88, 0x98, 0xad, 
+  0xff, 0x98, 0xa4, 0xb4, 0xff, 0xa0, 0xab, 0xba, 0xff, 0xa0, 0xab, 0xb9, 0xff, 0x95, 0xa2, 0xb0, 0xff, 0x8a, 0x99, 0xac, 0xff, 0x77, 0x96, 0xa8, 0xff, 0x60, 0xc7, 0xcb, 0xff, 0x62, 0xd0, 0xd3, 
+  0xff, 0x61, 0xcf, 0xd3, 0xff, 0x6d, 0xad, 0xbc, 0xff, 0x76, 0xa0, 0xb4, 0xff, 0x62, 0xca, 0xd0, 0xff, 0x63, 0xce, 0xd4, 0xff, 0x64, 0xcd, 0xd3, 0xff, 0x72, 0xa7, 0xbb, 0xff, 0x81, 0x99, 0xab, 
+  0xc4, 0xff, 0x01, 0x74, 0x98, 0xa3, 0xff, 0x47, 0x88, 0xe1, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 0x00, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x06, 
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x6f, 0xfe, 0xff, 0x62, 0x78, 0x98, 0xff, 0x86, 0x96, 0xa8, 0xff, 0x8c, 0x9b, 0xad, 0xff, 0x8c, 0x9c, 0xac, 0xff, 0xb0, 0xb6, 0xba, 0xff, 0x81, 0xc6, 0xc6, 0xc6, 
+  0xff, 0x02, 0xc3, 0xc3, 0xc3, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xb2, 0xb2, 0xb2, 0x70, 0x82, 0xc0, 0xc0, 0xc0, 0xff, 0x05, 0xb6, 0xbb, 0xbe, 0xff, 0xc1, 0xc3, 0xc6, 0xff, 0x95, 0xa3, 0xb3, 0xff, 
+  0x93, 0xa4, 0xb7, 0xff, 0x7a, 0x87, 0x98, 0xff, 0x0b, 0x6d, 0xf2, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x81, 0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x74, 0xff, 0xff, 
+  0x0e, 0x17, 0x7a, 0xf7, 0xff, 0x80, 0x91, 0xaa, 0xff, 0x7f, 0x91, 0xaa, 0xff, 0x80, 0x91, 0xaa, 0xff, 0x91, 0x9e, 0xb2, 0xff, 0x97, 0xa4, 0xb6, 0xff, 0x98, 0xa4, 0xb6, 0xff, 0x86, 0x94, 0xa8, 
+  0xff, 0x84, 0x95, 0xab, 0xff, 0x83, 0x93, 0xa8, 0xff, 0x92, 0x9e, 0xae, 0xff, 0x8e, 0x9b, 0xab, 0xff, 0x82, 0x93, 0xa6, 0xff, 0x71, 0x91, 0xa3, 0xff, 0x5d, 0xc0, 0xc6, 0xff, 0x81, 0x5f, 0xc9, 
+  0xcd, 0xff, 0x0a, 0x6a, 0xa7, 0xb7, 0xff, 0x71, 0x9a, 0xaf, 0xff, 0x5f, 0xc4, 0xcb, 0xff, 0x60, 0xc8, 0xce, 0xff, 0x5f, 0xc7, 0xce, 0xff, 0x6e, 0xa1, 0xb5, 0xff, 0x92, 0xa4, 0xbd, 0xff, 0x93, 
+  0xa5, 0xbe, 0xff, 0x6f, 0x97, 0xa0, 0xff, 0x4f, 0x90, 0x96, 0xff, 0x1c, 0x81, 0xfc, 0xff, 0x81, 0x00, 0x73, 0xff, 0xff, 0x81, 0x00, 0x72, 0xff, 0xff, 0x00, 0x00, 0x71, 0xff, 0xff, 0x81, 0x00, 
+  0x70, 0xff, 0xff, 0x06, 0x00, 0x6f, 0xff, 0xff, 0x0d, 0x6c, 0xef, 0xff, 0x6f, 0x7c, 0x8c, 0xff, 0x83, 0x93, 0xa5, 0xff, 0x87, 0x95, 0xa7, 0xff, 0x87, 0x96, 0xa6, 0xff, 0xab, 0xb0, 0xb4, 0xff, 
+  0x81, 0xc0, 0xc0, 0xc0, 0xff, 0x02, 0xbd, 0xbd, 0xbd, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xac, 0xac, 0xac, 0x70, 0x82, 0xba, 0xba, 0xba, 0xff, 0x05, 0xad, 0xb1, 0xb5, 0xff, 0xc1, 0xc2, 0xc3, 0xff, 
+  0xb4, 0xb6, 0xb9, 0xff, 0x8e, 0x9c, 0xad, 0xff, 0x7e, 0x8d, 0x9f, 0xff, 0x36, 0x6e, 0xd4, 0xff, 0x81, 0x00, 0x70, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x81, 0x00, 0x72, 0xff, 0xff, 0x81, 
+  0x00, 0x73, 0xff, 0xff, 0x07, 0x02, 0x75, 0xff, 0xff, 0x5e, 0x8b, 0xd3, 0xff, 0x86, 0x94, 0xaa, 0xff, 0x7b, 0x8c, 0xa6, 0xff, 0x7a, 0x8b, 0xa4, 0xff, 0x8b, 0x98, 0xac, 0xff, 0x86, 0x93, 0xa8, 
+  0xff, 0x7c, 0x8d, 0xa4, 0xff, 0x81, 0x7e, 0x8e, 0xa5, 0xff, 0x81, 0x7d, 0x8d, 0xa2, 0xff, 0x01, 0x6b, 0x8a, 0x9f, 0xff, 0x5a, 0xb9, 0xc0, 0xff, 0x81, 0x5c, 0xc2, 0xc7, 0xff, 0x0b, 0x65, 0xa1, 
+  0xb1, 0xff, 0x6c, 0x95, 0xaa, 0xff, 0x5c, 0xbe, 0xc5, 0xff, 0x5c, 0xc1, 0xc8, 0xff, 0x5c, 0xc0, 0xc7, 0xff, 0x69, 0x9c, 0xb0, 0xff, 0x8c, 0x9e, 0xb7, 0xff, 0x8c, 0x9f, 0xb8, 0xff, 0x6b, 0x92, 
+  0x9c, 0xff, 0x51, 0x90, 0x8b, 0xff, 0x41, 0x8f, 0xd2, 0xff, 0x02, 0x74, 0xff, 0xff, 0x81, 0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x00, 0x00, 0x70, 0xff, 0xff, 0x81, 0x00, 0x6f, 
+  0xff, 0xff, 0x06, 0x00, 0x6e, 0xff, 0xff, 0x32, 0x68, 0xd0, 0xff, 0x71, 0x7f, 0x90, 0xff, 0x7f, 0x8e, 0xa1, 0xff, 0x81, 0x8f, 0xa1, 0xff, 0x81, 0x90, 0xa0, 0xff, 0xa5, 0xaa, 0xae, 0xff, 0x81, 
+  0xba, 0xba, 0xba, 0xff, 0x02, 0xb7, 0xb7, 0xb7, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xa6, 0xa6, 0xa6, 0x70, 0x82, 0xb4, 0xb4, 0xb4, 0xff, 0x08, 0x88, 0x95, 0xa1, 0xff, 0xac, 0xb0, 0xb4, 0xff, 0xab, 
+  0xab, 0xad, 0xff, 0xb1, 0xb2, 0xb7, 0xff, 0x80, 0x8d, 0x9c, 0xff, 0x51, 0x6f, 0xa9, 0xff, 0x00, 0x6e, 0xfe, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 
+  0x82, 0x00, 0x72, 0xff, 0xff, 0x1b, 0x00, 0x73, 0xff, 0xff, 0x1b, 0x7f, 0xfb, 0xff, 0x7b, 0x91, 0xb3, 0xff, 0x82, 0x90, 0xa6, 0xff, 0x76, 0x86, 0xa0, 0xff, 0x76, 0x86, 0x9f, 0xff, 0x77, 0x87, 
+  0xa0, 0xff, 0x78, 0x89, 0xa1, 0xff, 0x79, 0x89, 0xa1, 0xff, 0x79, 0x89, 0xa0, 0xff, 0x79, 0x8a, 0xa0, 0xff, 0x67, 0x85, 0x9b, 0xff, 0x57, 0xb3, 0xbb, 0xff, 0x58, 0xbb, 0xc2, 0xff, 0x59, 0xbb, 
+  0xc2, 0xff, 0x60, 0x9b, 0xac, 0xff, 0x68, 0x90, 0xa5, 0xff, 0x57, 0xb5, 0xbd, 0xff, 0x56, 0xb6, 0xbd, 0xff, 0x5a, 0xba, 0xc2, 0xff, 0x64, 0x96, 0xaa, 0xff, 0x86, 0x98, 0xb2, 0xff, 0x87, 0x99, 
+  0xb2, 0xff, 0x66, 0x8d, 0x97, 0xff, 0x4f, 0x8e, 0x88, 0xff, 0x4b, 0x8d, 0xa3, 0xff, 0x27, 0x86, 0xfd, 0xff, 0x00, 0x72, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x81, 0x00, 0x70, 0xff, 0xff, 
+  0x81, 0x00, 0x6f, 0xff, 0xff, 0x07, 0x00, 0x6e, 0xff, 0xff, 0x00, 0x6d, 0xfe, 0xff, 0x33, 0x73, 0xa5, 0xff, 0x6a, 0x7b, 0x8d, 0xff, 0x7c, 0x8a, 0x9c, 0xff, 0x7d, 0x8a, 0x9b, 0xff, 0x7c, 0x8b, 
+  0x9a, 0xff, 0xa0, 0xa4, 0xa9, 0xff, 0x81, 0xb4, 0xb4, 0xb4, 0xff, 0x02, 0xb1, 0xb1, 0xb1, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xa1, 0xa1, 0xa1, 0x70, 0x82, 0xae, 0xae, 0xae, 0xff, 0x06, 0x88, 0x95, 
+  0xa1, 0xff, 0x84, 0x93, 0xa2, 0xff, 0xa7, 0xaa, 0xaf, 0xff, 0xaa, 0xab, 0xae, 0xff, 0xa6, 0xa8, 0xad, 0xff, 0x68, 0x73, 0x82, 0xff, 0x0b, 0x68, 0xed, 0xff, 0x81, 0x00, 0x6f, 0xff, 0xff, 0x81, 
+  0x00, 0x70, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x81, 0x00, 0x72, 0xff, 0xff, 0x04, 0x02, 0x74, 0xff, 0xff, 0x40, 0x89, 0xec, 0xff, 0x81, 0x90, 0xa8, 0xff, 0x7d, 0x8b, 0xa1, 0xff, 0x72, 
+  0x82, 0x9b, 0xff, 0x81, 0x74, 0x84, 0x9d, 0xff, 0x12, 0x73, 0x83, 0x9c, 0xff, 0x74, 0x84, 0x9c, 0xff, 0x63, 0x80, 0x96, 0xff, 0x55, 0xac, 0xb6, 0xff, 0x55, 0xb4, 0xbc, 0xff, 0x56, 0xb4, 0xbc, 
+  0xff, 0x5d, 0x96, 0xa8, 0xff, 0x64, 0x8a, 0xa0, 0xff, 0x55, 0xb0, 0xba, 0xff, 0x4f, 0xa8, 0xb1, 0xff, 0x52, 0xab, 0xb5, 0xff, 0x61, 0x91, 0xa5, 0xff, 0x81, 0x93, 0xac, 0xff, 0x81, 0x93, 0xad, 
+  0xff, 0x63, 0x88, 0x93, 0xff, 0x4c, 0x89, 0x84, 0xff, 0x4a, 0x88, 0x8b, 0xff, 0x3f, 0x94, 0xef, 0xff, 0x02, 0x73, 0xff, 0xff, 0x81, 0x00, 0x71, 0xff, 0xff, 0x00, 0x00, 0x70, 0xff, 0xff, 0x81, 
+  0x00, 0x6f, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x07, 0x00, 0x6d, 0xff, 0xff, 0x08, 0x6b, 0xee, 0xff, 0x42, 0x90, 0x95, 0xff, 0x51, 0x9e, 0xa5, 0xff, 0x6f, 0x80, 0x92, 0xff, 0x79, 0x86, 
+  0x96, 0xff, 0x79, 0x87, 0x96, 0xff, 0x9b, 0x9f, 0xa3, 0xff, 0x81, 0xae, 0xae, 0xae, 0xff, 0x03, 0xab, 0xab, 0xab, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xd1, 0xd1, 0xd1, 0x70, 0xe4, 0xe4, 0xe4, 0xff, 
+  0x81, 0xe3, 0xe3, 0xe3, 0xff, 0x06, 0xac, 0xc1, 0xc7, 0xff, 0xbe, 0xcc, 0xdb, 0xff, 0xbc, 0xca, 0xd9, 0xff, 0xdb, 0xde, 0xe2, 0xff, 0xe9, 0xea, 0xea, 0xff, 0xcb, 0xcc, 0xcd, 0xff, 0x74, 0x8d, 
+  0xd1, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x81, 0x00, 0x6f, 0xff, 0xff, 0x81, 0x00, 0x70, 0xff, 0xff, 0x82, 0x00, 0x71, 0xff, 0xff, 0x10, 0x0e, 0x79, 0xff, 0xff, 0x63, 0x9b, 0xec, 0xff, 0xbc, 
+  0xc7, 0xd7, 0xff, 0xb9, 0xc3, 0xd3, 0xff, 0xac, 0xba, 0xcc, 0xff, 0xae, 0xbc, 0xcf, 0xff, 0xaf, 0xbc, 0xcf, 0xff, 0x9b, 0xb8, 0xca, 0xff, 0x90, 0xe5, 0xe9, 0xff, 0x92, 0xec, 0xee, 0xff, 0x91, 
+  0xec, 0xee, 0xff, 0x98, 0xcb, 0xd9, 0xff, 0x9d, 0xc3, 0xd4, 0xff, 0x91, 0xe8, 0xec, 0xff, 0x8b, 0xe0, 0xe4, 0xff, 0x90, 0xe8, 0xeb, 0xff, 0x9e, 0xc7, 0xd7, 0xff, 0x81, 0xbc, 0xcb, 0xde, 0xff, 
+  0x04, 0x9b, 0xc0, 0xc4, 0xff, 0x88, 0xc1, 0xb7, 0xff, 0x83, 0xbd, 0xb9, 0xff, 0x52, 0xa1, 0xea, 0xff, 0x16, 0x7a, 0xff, 0xff, 0x82, 0x00, 0x70, 0xff, 0xff, 0x81, 0x00, 0x6f, 0xff, 0xff, 0x81, 
+  0x00, 0x6e, 0xff, 0xff, 0x08, 0x00, 0x6d, 0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x48, 0x89, 0xcc, 0xff, 0x7d, 0xcf, 0xd0, 0xff, 0x8d, 0xea, 0xeb, 0xff, 0x8d, 0xdc, 0xe0, 0xff, 0xa7, 0xb7, 0xc6, 
+  0xff, 0xb1, 0xbe, 0xcb, 0xff, 0xcd, 0xd2, 0xd6, 0xff, 0x81, 0xe3, 0xe3, 0xe3, 0xff, 0x02, 0xdf, 0xdf, 0xdf, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe1, 0xe1, 0xe1, 0x70, 0x82, 0xf5, 0xf5, 0xf5, 0xff, 
+  0x08, 0xaa, 0xd2, 0xc9, 0xff, 0xae, 0xd2, 0xd0, 0xff, 0xcf, 0xde, 0xed, 0xff, 0xcc, 0xda, 0xe9, 0xff, 0xed, 0xf0, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xff, 0xb6, 0xba, 0xc2, 0xff, 0x15, 0x6d, 0xf5, 
+  0xff, 0x00, 0x6d, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x81, 0x00, 0x6f, 0xff, 0xff, 0x82, 0x00, 0x70, 0xff, 0xff, 0x07, 0x00, 0x71, 0xff, 0xff, 0x1a, 0x7e, 0xff, 0xff, 0x77, 0xac, 0xf7, 
+  0xff, 0xca, 0xd7, 0xe8, 0xff, 0xc2, 0xce, 0xdd, 0xff, 0xc0, 0xcd, 0xdf, 0xff, 0xac, 0xc8, 0xda, 0xff, 0xa0, 0xf5, 0xf9, 0xff, 0x81, 0xa2, 0xfd, 0xff, 0xff, 0x05, 0xa8, 0xde, 0xeb, 0xff, 0xae, 
+  0xd2, 0xe4, 0xff, 0xa1, 0xfa, 0xfc, 0xff, 0xa2, 0xfe, 0xff, 0xff, 0xa2, 0xfc, 0xfe, 0xff, 0xab, 0xd9, 0xe7, 0xff, 0x81, 0xce, 0xdd, 0xee, 0xff, 0x05, 0xac, 0xd1, 0xd3, 0xff, 0x98, 0xd2, 0xc7, 
+  0xff, 0x92, 0xce, 0xcb, 0xff, 0x64, 0xaf, 0xf2, 0xff, 0x24, 0x81, 0xff, 0xff, 0x00, 0x70, 0xff, 0xff, 0x82, 0x00, 0x6f, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x81, 0x00, 0x6d, 0xff, 0xff, 
+  0x08, 0x00, 0x6c, 0xff, 0xff, 0x13, 0x6b, 0xf3, 0xff, 0x8e, 0x9f, 0xb2, 0xff, 0x96, 0xdf, 0xe5, 0xff, 0x9a, 0xf7, 0xf7, 0xff, 0x95, 0xef, 0xef, 0xff, 0x9c, 0xec, 0xf0, 0xff, 0xb8, 0xc9, 0xd7, 
+  0xff, 0xdd, 0xe3, 0xe7, 0xff, 0x81, 0xf5, 0xf5, 0xf5, 0xff, 0x0e, 0xf1, 0xf1, 0xf1, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xe0, 0xe0, 0x70, 0xf5, 0xf5, 0xf5, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf5, 
+  0xf5, 0xf5, 0xff, 0xa9, 0xd2, 0xc9, 0xff, 0x95, 0xd4, 0xbf, 0xff, 0xac, 0xd2, 0xcf, 0xff, 0xce, 0xdd, 0xec, 0xff, 0xca, 0xd9, 0xe8, 0xff, 0xe9, 0xec, 0xf0, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x7b, 
+  0x91, 0xce, 0xff, 0x00, 0x6c, 0xfe, 0xff, 0x81, 0x00, 0x6d, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x82, 0x00, 0x6f, 0xff, 0xff, 0x81, 0x00, 0x70, 0xff, 0xff, 0x13, 0x1d, 0x7f, 0xff, 0xff, 
+  0x5e, 0xa4, 0xfa, 0xff, 0xa6, 0xc1, 0xe3, 0xff, 0xab, 0xc8, 0xda, 0xff, 0x9d, 0xf5, 0xf9, 0xff, 0xa0, 0xfc, 0xfe, 0xff, 0xa0, 0xfd, 0xff, 0xff, 0xa6, 0xdd, 0xea, 0xff, 0xad, 0xd2, 0xe4, 0xff, 
+  0x9f, 0xf9, 0xfc, 0xff, 0xa0, 0xfd, 0xff, 0xff, 0xa0, 0xfc, 0xfe, 0xff, 0xa9, 0xd7, 0xe7, 0xff, 0xcc, 0xdc, 0xed, 0xff, 0xce, 0xdc, 0xee, 0xff, 0xab, 0xd0, 0xd3, 0xff, 0x95, 0xd1, 0xc5, 0xff, 
+  0x87, 0xc7, 0xd6, 0xff, 0x5e, 0xac, 0xf9, 0xff, 0x25, 0x81, 0xff, 0xff, 0x82, 0x00, 0x6f, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x81, 0x00, 0x6d, 0xff, 0xff, 0x81, 0x00, 0x6c, 0xff, 0xff, 
+  0x08, 0x00, 0x6b, 0xfe, 0xff, 0x65, 0x82, 0xc4, 0xff, 0xb0, 0xbd, 0xca, 0xff, 0xc1, 0xd3, 0xe3, 0xff, 0x9c, 0xec, 0xf1, 0xff, 0x98, 0xf9, 0xf9, 0xff, 0x95, 0xf5, 0xf5, 0xff, 0x98, 0xeb, 0xef, 
+  0xff, 0xda, 0xe1, 0xe6, 0xff, 0x81, 0xf5, 0xf5, 0xf5, 0xff, 0x02, 0xf0, 0xf0, 0xf0, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xe0, 0xe0, 0x70, 0x82, 0xf4, 0xf4, 0xf4, 0xff, 0x09, 0xa7, 0xd1, 0xc8, 
+  0xff, 0x92, 0xd3, 0xbd, 0xff, 0x92, 0xd3, 0xbe, 0xff, 0xaa, 0xd0, 0xcd, 0xff, 0xcd, 0xdd, 0xec, 0xff, 0xc9, 0xd8, 0xe7, 0xff, 0xdd, 0xe0, 0xe4, 0xff, 0xbd, 0xbe, 0xbf, 0xff, 0x3d, 0x73, 0xe8, 
+  0xff, 0x00, 0x6c, 0xff, 0xff, 0x82, 0x00, 0x6d, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x83, 0x00, 0x6f, 0xff, 0xff, 0x0a, 0x15, 0x79, 0xff, 0xff, 0x44, 0x9a, 0xff, 0xff, 0x72, 0xc3, 0xfa, 
+  0xff, 0x8d, 0xe4, 0xf6, 0xff, 0x9e, 0xfb, 0xfd, 0xff, 0xa3, 0xdc, 0xea, 0xff, 0xaa, 0xd0, 0xe3, 0xff, 0x9d, 0xf9, 0xfc, 0xff, 0x9e, 0xfd, 0xff, 0xff, 0x9d, 0xfc, 0xfe, 0xff, 0xa7, 0xd7, 0xe7, 
+  0xff, 0x81, 0xcc, 0xdb, 0xed, 0xff, 0x05, 0xa9, 0xcf, 0xd2, 0xff, 0x8a, 0xc9, 0xd2, 0xff, 0x76, 0xbc, 0xef, 0xff, 0x52, 0xa2, 0xff, 0xff, 0x16, 0x79, 0xff, 0xff, 0x00, 0x6f, 0xff, 0xff, 0x82, 
+  0x00, 0x6e, 0xff, 0xff, 0x81, 0x00, 0x6d, 0xff, 0xff, 0x82, 0x00, 0x6c, 0xff, 0xff, 0x09, 0x00, 0x6b, 0xff, 0xff, 0x23, 0x6c, 0xe0, 0xff, 0x71, 0x9c, 0x93, 0xff, 0xb8, 0xcb, 0xd7, 0xff, 0xcd, 
+  0xdd, 0xec, 0xff, 0xc3, 0xd6, 0xe6, 0xff, 0x9a, 0xec, 0xf1, 0xff, 0x93, 0xfa, 0xfa, 0xff, 0x96, 0xff, 0xff, 0xff, 0xd9, 0xe6, 0xea, 0xff, 0x81, 0xf4, 0xf4, 0xf4, 0xff, 0x02, 0xf0, 0xf0, 0xf0, 
+  0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xe0, 0xe0, 0x70, 0x82, 0xf4, 0xf4, 0xf4, 0xff, 0x00, 0xa4, 0xd0, 0xc6, 0xff, 0x82, 0x90, 0xd2, 0xbc, 0xff, 0x05, 0xa8, 0xcf, 0xcd, 0xff, 0xcc, 0xdc, 0xeb, 
+  0xff, 0xc6, 0xd5, 0xe5, 0xff, 0xcb, 0xce, 0xd3, 0xff, 0x9d, 0xa4, 0xba, 0xff, 0x09, 0x6a, 0xf6, 0xff, 0x82, 0x00, 0x6c, 0xff, 0xff, 0x82, 0x00, 0x6d, 0xff, 0xff, 0x82, 0x00, 0x6e, 0xff, 0xff, 
+  0x10, 0x00, 0x6f, 0xff, 0xff, 0x02, 0x70, 0xff, 0xff, 0x30, 0x88, 0xff, 0xff, 0x55, 0xa6, 0xff, 0xff, 0x73, 0xbe, 0xfc, 0xff, 0x91, 0xc0, 0xf0, 0xff, 0x91, 0xe7, 0xfc, 0xff, 0x98, 0xf3, 0xff, 
+  0xff, 0x9b, 0xf7, 0xff, 0xff, 0xa0, 0xd6, 0xe9, 0xff, 0xbe, 0xd7, 0xf0, 0xff, 0xb6, 0xd4, 0xf3, 0xff, 0x9c, 0xc9, 0xf1, 0xff, 0x7b, 0xc0, 0xf7, 0xff, 0x60, 0xac, 0xff, 0xff, 0x35, 0x89, 0xff, 
+  0xff, 0x01, 0x6f, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x82, 0x00, 0x6d, 0xff, 0xff, 0x82, 0x00, 0x6c, 0xff, 0xff, 0x81, 0x00, 0x6b, 0xff, 0xff, 0x09, 0x05, 0x67, 0xf4, 0xff, 0x58, 0x8a, 
+  0x95, 0xff, 0x7e, 0xb7, 0xa7, 0xff, 0x92, 0xcc, 0xbe, 0xff, 0xc2, 0xd7, 0xe3, 0xff, 0xcc, 0xdc, 0xec, 0xff, 0xc1, 0xd4, 0xe5, 0xff, 0x97, 0xec, 0xf1, 0xff, 0x93, 0xff, 0xff, 0xff, 0xd9, 0xe6, 
+  0xe9, 0xff, 0x81, 0xf4, 0xf4, 0xf4, 0xff, 0x02, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xe0, 0xe0, 0x70, 0x82, 0xf4, 0xf4, 0xf4, 0xff, 0x01, 0xa4, 0xcf, 0xc5, 0xff, 0x8c, 0xd0, 
+  0xba, 0xff, 0x81, 0x8d, 0xd1, 0xba, 0xff, 0x07, 0x8d, 0xd1, 0xbb, 0xff, 0xa6, 0xce, 0xcb, 0xff, 0xca, 0xda, 0xeb, 0xff, 0xc1, 0xd0, 0xdf, 0xff, 0xbb, 0xbe, 0xc2, 0xff, 0x7f, 0x91, 0xc3, 0xff, 
+  0x00, 0x68, 0xfc, 0xff, 0x00, 0x6b, 0xff, 0xff, 0x82, 0x00, 0x6c, 0xff, 0xff, 0x84, 0x00, 0x6d, 0xff, 0xff, 0x81, 0x00, 0x6e, 0xff, 0xff, 0x0b, 0x01, 0x6f, 0xff, 0xff, 0x24, 0x80, 0xff, 0xff, 
+  0x50, 0x9b, 0xff, 0xff, 0x64, 0xae, 0xff, 0xff, 0x78, 0xbd, 0xff, 0xff, 0x87, 0xc7, 0xff, 0xff, 0x88, 0xc8, 0xff, 0xff, 0x7a, 0xbe, 0xff, 0xff, 0x69, 0xb0, 0xff, 0xff, 0x54, 0x9c, 0xff, 0xff, 
+  0x24, 0x7f, 0xff, 0xff, 0x01, 0x6e, 0xff, 0xff, 0x83, 0x00, 0x6d, 0xff, 0xff, 0x82, 0x00, 0x6c, 0xff, 0xff, 0x82, 0x00, 0x6b, 0xff, 0xff, 0x10, 0x00, 0x6a, 0xff, 0xff, 0x00, 0x67, 0xfb, 0xff, 
+  0x47, 0x7c, 0xa9, 0xff, 0x71, 0xa8, 0x98, 0xff, 0x88, 0xc9, 0xb6, 0xff, 0x8d, 0xd0, 0xbb, 0xff, 0x92, 0xce, 0xbe, 0xff, 0xc1, 0xd6, 0xe1, 0xff, 0xcb, 0xdb, 0xec, 0xff, 0xc0, 0xd4, 0xe5, 0xff, 
+  0x94, 0xeb, 0xf1, 0xff, 0xd8, 0xe6, 0xe9, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xe0, 0xe0, 0x70, 0x81, 0xf4, 0xf4, 0xf4, 
+  0xff, 0x03, 0xf3, 0xf3, 0xf3, 0xff, 0xa2, 0xcf, 0xc4, 0xff, 0x8b, 0xd0, 0xb9, 0xff, 0x8a, 0xd0, 0xb9, 0xff, 0x81, 0x8b, 0xd0, 0xb9, 0xff, 0x06, 0x8b, 0xd0, 0xba, 0xff, 0xa5, 0xcd, 0xcb, 0xff, 
+  0xc9, 0xd9, 0xea, 0xff, 0xb9, 0xc8, 0xd8, 0xff, 0xae, 0xb1, 0xb6, 0xff, 0x68, 0x84, 0xcb, 0xff, 0x00, 0x68, 0xfc, 0xff, 0x82, 0x00, 0x6b, 0xff, 0xff, 0x83, 0x00, 0x6c, 0xff, 0xff, 0x87, 0x00, 
+  0x6d, 0xff, 0xff, 0x81, 0x01, 0x6e, 0xff, 0xff, 0x84, 0x00, 0x6d, 0xff, 0xff, 0x84, 0x00, 0x6c, 0xff, 0xff, 0x81, 0x00, 0x6b, 0xff, 0xff, 0x82, 0x00, 0x6a, 0xff, 0xff, 0x11, 0x00, 0x67, 0xfc, 
+  0xff, 0x39, 0x73, 0xb7, 0xff, 0x68, 0x9c, 0x8d, 0xff, 0x81, 0xc1, 0xaf, 0xff, 0x8a, 0xce, 0xba, 0xff, 0x8a, 0xcf, 0xb9, 0xff, 0x8b, 0xd0, 0xba, 0xff, 0x8f, 0xce, 0xbb, 0xff, 0xc0, 0xd5, 0xe1, 
+  0xff, 0xcb, 0xdb, 0xeb, 0xff, 0xc0, 0xd3, 0xe4, 0xff, 0xd9, 0xe1, 0xe6, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdf, 0xdf, 0xdf, 
+  0x70, 0xf4, 0xf4, 0xf4, 0xff, 0x81, 0xf3, 0xf3, 0xf3, 0xff, 0x00, 0xa0, 0xce, 0xc3, 0xff, 0x81, 0x88, 0xcf, 0xb7, 0xff, 0x01, 0x87, 0xcf, 0xb7, 0xff, 0x87, 0xce, 0xb7, 0xff, 0x81, 0x89, 0xcf, 
+  0xb8, 0xff, 0x05, 0xa3, 0xcc, 0xca, 0xff, 0xc7, 0xd7, 0xe8, 0xff, 0xb4, 0xc2, 0xd2, 0xff, 0xa7, 0xaa, 0xaf, 0xff, 0x61, 0x7f, 0xcd, 0xff, 0x00, 0x67, 0xfc, 0xff, 0x81, 0x00, 0x6a, 0xff, 0xff, 
+  0x83, 0x00, 0x6b, 0xff, 0xff, 0x8f, 0x00, 0x6c, 0xff, 0xff, 0x82, 0x00, 0x6b, 0xff, 0xff, 0x82, 0x00, 0x6a, 0xff, 0xff, 0x81, 0x00, 0x69, 0xff, 0xff, 0x05, 0x00, 0x66, 0xfc, 0xff, 0x34, 0x6f, 
+  0xba, 0xff, 0x63, 0x96, 0x87, 0xff, 0x7c, 0xbb, 0xa9, 0xff, 0x87, 0xcc, 0xb7, 0xff, 0x88, 0xce, 0xb9, 0xff, 0x82, 0x88, 0xcf, 0xb8, 0xff, 0x03, 0x8d, 0xcc, 0xba, 0xff, 0xbe, 0xd4, 0xe0, 0xff, 
+  0xca, 0xda, 0xeb, 0xff, 0xdc, 0xe2, 0xe7, 0xff, 0x81, 0xf3, 0xf3, 0xf3, 0xff, 0x02, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdf, 0xdf, 0xdf, 0x70, 0x82, 0xf3, 0xf3, 0xf3, 0xff, 0x01, 
+  0x9f, 0xcd, 0xc3, 0xff, 0x86, 0xce, 0xb6, 0xff, 0x81, 0x85, 0xce, 0xb6, 0xff, 0x0a, 0x86, 0xce, 0xb6, 0xff, 0x85, 0xce, 0xb5, 0xff, 0x85, 0xce, 0xb6, 0xff, 0x86, 0xce, 0xb7, 0xff, 0xa2, 0xcb, 
+  0xc9, 0xff, 0xc5, 0xd5, 0xe6, 0xff, 0xb0, 0xbe, 0xce, 0xff, 0xa5, 0xa8, 0xac, 0xff, 0x69, 0x82, 0xc6, 0xff, 0x01, 0x65, 0xf9, 0xff, 0x00, 0x69, 0xff, 0xff, 0x83, 0x00, 0x6a, 0xff, 0xff, 0x8e, 
+  0x00, 0x6b, 0xff, 0xff, 0x84, 0x00, 0x6a, 0xff, 0xff, 0x81, 0x00, 0x69, 0xff, 0xff, 0x07, 0x00, 0x68, 0xff, 0xff, 0x01, 0x64, 0xf9, 0xff, 0x38, 0x70, 0xb0, 0xff, 0x60, 0x93, 0x84, 0xff, 0x78, 
+  0xb8, 0xa5, 0xff, 0x83, 0xc9, 0xb4, 0xff, 0x85, 0xcd, 0xb7, 0xff, 0x86, 0xce, 0xb7, 0xff, 0x82, 0x85, 0xce, 0xb6, 0xff, 0x03, 0x86, 0xce, 0xb6, 0xff, 0x8b, 0xcc, 0xb9, 0xff, 0xbd, 0xd3, 0xdf, 
+  0xff, 0xdc, 0xe2, 0xe7, 0xff, 0x81, 0xf3, 0xf3, 0xf3, 0xff, 0x02, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdf, 0xdf, 0xdf, 0x70, 0x82, 0xf3, 0xf3, 0xf3, 0xff, 0x0f, 0x9e, 0xcd, 0xc2, 
+  0xff, 0x84, 0xce, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x84, 0xce, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x85, 0xce, 0xb5, 0xff, 0x83, 0xcd, 0xb4, 0xff, 0x83, 0xcd, 0xb5, 0xff, 0x84, 0xcd, 0xb6, 
+  0xff, 0xa1, 0xca, 0xc8, 0xff, 0xc5, 0xd5, 0xe6, 0xff, 0xaf, 0xbe, 0xce, 0xff, 0xa6, 0xaa, 0xae, 0xff, 0x7f, 0x8c, 0xb7, 0xff, 0x0e, 0x63, 0xef, 0xff, 0x00, 0x68, 0xff, 0xff, 0x82, 0x00, 0x69, 
+  0xff, 0xff, 0x8f, 0x00, 0x6a, 0xff, 0xff, 0x82, 0x00, 0x69, 0xff, 0xff, 0x82, 0x00, 0x68, 0xff, 0xff, 0x06, 0x08, 0x62, 0xec, 0xff, 0x42, 0x75, 0x9b, 0xff, 0x5f, 0x94, 0x85, 0xff, 0x75, 0xb7, 
+  0xa3, 0xff, 0x81, 0xc9, 0xb3, 0xff, 0x83, 0xcc, 0xb5, 0xff, 0x84, 0xcd, 0xb6, 0xff, 0x81, 0x83, 0xcd, 0xb5, 0xff, 0x01, 0x83, 0xcd, 0xb4, 0xff, 0x84, 0xcd, 0xb5, 0xff, 0x81, 0x83, 0xcd, 0xb4, 
+  0xff, 0x01, 0x88, 0xcb, 0xb7, 0xff, 0xd9, 0xe0, 0xe4, 0xff, 0x81, 0xf3, 0xf3, 0xf3, 0xff, 0x02, 0xef, 0xef, 0xef, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdf, 0xdf, 0xdf, 0x70, 0x82, 0xf3, 0xf3, 0xf3, 
+  0xff, 0x01, 0x9d, 0xcc, 0xc2, 0xff, 0x82, 0xcd, 0xb3, 0xff, 0x81, 0x81, 0xcc, 0xb3, 0xff, 0x0c, 0x83, 0xcd, 0xb4, 0xff, 0x81, 0xcc, 0xb2, 0xff, 0x82, 0xcc, 0xb3, 0xff, 0x80, 0xcc, 0xb3, 0xff, 
+  0x81, 0xcc, 0xb4, 0xff, 0x81, 0xcb, 0xb4, 0xff, 0xa0, 0xc9, 0xc8, 0xff, 0xc5, 0xd6, 0xe7, 0xff, 0xb2, 0xc1, 0xd1, 0xff, 0x91, 0xa4, 0xab, 0xff, 0x51, 0x95, 0xa6, 0xff, 0x25, 0x6f, 0xd8, 0xff, 
+  0x00, 0x64, 0xfb, 0xff, 0x81, 0x00, 0x68, 0xff, 0xff, 0x8e, 0x00, 0x69, 0xff, 0xff, 0x84, 0x00, 0x68, 0xff, 0xff, 0x08, 0x00, 0x63, 0xfb, 0xff, 0x23, 0x65, 0xcd, 0xff, 0x4c, 0x7d, 0x7f, 0xff, 
+  0x62, 0x9a, 0x89, 0xff, 0x76, 0xba, 0xa6, 0xff, 0x80, 0xc9, 0xb3, 0xff, 0x81, 0xcb, 0xb5, 0xff, 0x82, 0xcc, 0xb5, 0xff, 0x82, 0xcd, 0xb4, 0xff, 0x81, 0x81, 0xcc, 0xb3, 0xff, 0x00, 0x82, 0xcc, 
+  0xb3, 0xff, 0x81, 0x81, 0xcc, 0xb3, 0xff, 0x02, 0x81, 0xcc, 0xb4, 0xff, 0x81, 0xcc, 0xb3, 0xff, 0xd6, 0xe0, 0xe1, 0xff, 0x81, 0xf3, 0xf3, 0xf3, 0xff, 0x02, 0xee, 0xee, 0xee, 0xe4, 0x00, 0x00, 
+  0x00, 0x0b, 0xde, 0xde, 0xde, 0x70, 0x82, 0xf3, 0xf3, 0xf3, 0xff, 0x12, 0x9c, 0xcb, 0xc0, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x80, 0xcc, 0xb3, 0xff, 
+  0x7f, 0xcc, 0xb2, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x82, 0xca, 0xb4, 0xff, 0xb2, 0xcf, 0xd7, 0xff, 0xc7, 0xd8, 0xea, 0xff, 0xa9, 0xcb, 0xdd, 0xff, 
+  0x7e, 0xe7, 0xe9, 0xff, 0x6d, 0xce, 0xce, 0xff, 0x5a, 0xaa, 0xaa, 0xff, 0x4a, 0x75, 0xa8, 0xff, 0x19, 0x61, 0xe0, 0xff, 0x00, 0x64, 0xfb, 0xff, 0x8f, 0x00, 0x68, 0xff, 0xff, 0x81, 0x00, 0x67, 
+  0xff, 0xff, 0x0f, 0x00, 0x64, 0xfb, 0xff, 0x15, 0x61, 0xdc, 0xff, 0x3d, 0x70, 0x96, 0xff, 0x55, 0x87, 0x79, 0xff, 0x67, 0xa4, 0x93, 0xff, 0x78, 0xbe, 0xa9, 0xff, 0x7e, 0xc9, 0xb2, 0xff, 0x7f, 
+  0xcb, 0xb3, 0xff, 0x7e, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb3, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 0xcc, 0xb2, 0xff, 0x7f, 0xcb, 0xb1, 0xff, 0x7f, 0xcc, 0xb2, 0xff, 0x7f, 0xcb, 0xb2, 0xff, 0x80, 
+  0xcc, 0xb2, 0xff, 0x81, 0x7f, 0xcb, 0xb2, 0xff, 0x06, 0xd6, 0xe0, 0xe1, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xee, 0xee, 0xee, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xde, 0xde, 0xde, 
+  0x70, 0xf3, 0xf3, 0xf3, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 0xff, 0x00, 0x9b, 0xcb, 0xc0, 0xff, 0x81, 0x7e, 0xcb, 0xb1, 0xff, 0x81, 0x7d, 0xcb, 0xb1, 0xff, 0x10, 0x7d, 0xca, 0xb0, 0xff, 0x7d, 0xcb, 
+  0xb1, 0xff, 0x7e, 0xcb, 0xb2, 0xff, 0x7f, 0xc9, 0xb1, 0xff, 0xb2, 0xce, 0xd6, 0xff, 0xc7, 0xd8, 0xe9, 0xff, 0xab, 0xcd, 0xde, 0xff, 0x83, 0xf6, 0xf8, 0xff, 0x84, 0xfe, 0xfe, 0xff, 0x80, 0xf6, 
+  0xf7, 0xff, 0x82, 0xbe, 0xca, 0xff, 0x74, 0x98, 0xa6, 0xff, 0x54, 0x9f, 0xa1, 0xff, 0x3e, 0x84, 0xb0, 0xff, 0x1f, 0x6b, 0xd6, 0xff, 0x01, 0x60, 0xf4, 0xff, 0x00, 0x65, 0xfd, 0xff, 0x8b, 0x00, 
+  0x67, 0xff, 0xff, 0x15, 0x00, 0x65, 0xfd, 0xff, 0x02, 0x60, 0xf4, 0xff, 0x32, 0x64, 0xd4, 0xff, 0x56, 0x70, 0xa1, 0xff, 0x50, 0x7f, 0x73, 0xff, 0x5e, 0x98, 0x87, 0xff, 0x6f, 0xb3, 0x9f, 0xff, 
+  0x7a, 0xc4, 0xae, 0xff, 0x7e, 0xc9, 0xb2, 0xff, 0x7e, 0xcb, 0xb3, 0xff, 0x7e, 0xca, 0xb2, 0xff, 0x7d, 0xcb, 0xb2, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7d, 0xcb, 0xb1, 0xff, 
+  0x7d, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7e, 0xcb, 0xb1, 0xff, 0x7d, 0xca, 0xb0, 0xff, 0x7e, 0xcb, 0xb2, 0xff, 0x87, 0xca, 0xb0, 0xff, 0xd9, 0xe0, 0xe1, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 
+  0xff, 0x02, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xde, 0xde, 0xde, 0x70, 0x82, 0xf2, 0xf2, 0xf2, 0xff, 0x0b, 0x9b, 0xcb, 0xbf, 0xff, 0x7b, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 
+  0x7b, 0xca, 0xaf, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7b, 0xca, 0xb0, 0xff, 0x7c, 0xca, 0xb0, 0xff, 0x7d, 0xc9, 0xb0, 0xff, 0xb2, 0xce, 0xd6, 0xff, 0xc7, 0xd8, 0xe9, 0xff, 0xa9, 0xcc, 0xde, 0xff, 
+  0x80, 0xf6, 0xf8, 0xff, 0x81, 0x81, 0xff, 0xff, 0xff, 0x0a, 0x91, 0xd7, 0xe3, 0xff, 0x9a, 0xc8, 0xd9, 0xff, 0x7a, 0xed, 0xef, 0xff, 0x71, 0xdc, 0xdc, 0xff, 0x62, 0xbd, 0xbe, 0xff, 0x5d, 0x80, 
+  0x89, 0xff, 0x62, 0x70, 0x85, 0xff, 0x4b, 0x63, 0xa8, 0xff, 0x39, 0x63, 0xcb, 0xff, 0x15, 0x60, 0xe3, 0xff, 0x01, 0x60, 0xf6, 0xff, 0x85, 0x00, 0x66, 0xff, 0xff, 0x0c, 0x01, 0x5f, 0xf6, 0xff, 
+  0x13, 0x5e, 0xe2, 0xff, 0x42, 0x67, 0xcc, 0xff, 0x6b, 0x7b, 0xb3, 0xff, 0x84, 0x8a, 0x97, 0xff, 0x7d, 0x87, 0x93, 0xff, 0x95, 0xa2, 0xb0, 0xff, 0x9b, 0xb3, 0xbb, 0xff, 0x78, 0xbf, 0xaa, 0xff, 
+  0x7b, 0xc7, 0xb0, 0xff, 0x7b, 0xc9, 0xb0, 0xff, 0x7c, 0xc9, 0xb1, 0xff, 0x7b, 0xca, 0xb1, 0xff, 0x81, 0x7c, 0xca, 0xb0, 0xff, 0x00, 0x7b, 0xca, 0xb0, 0xff, 0x82, 0x7c, 0xca, 0xb0, 0xff, 0x05, 
+  0x7b, 0xca, 0xaf, 0xff, 0x7c, 0xcb, 0xb0, 0xff, 0x7d, 0xcb, 0xb0, 0xff, 0x84, 0xc9, 0xaf, 0xff, 0xd0, 0xc3, 0xab, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 0xff, 0x02, 0xed, 0xed, 
+  0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdd, 0xdd, 0xdd, 0x70, 0x82, 0xf2, 0xf2, 0xf2, 0xff, 0x19, 0x9a, 0xca, 0xbf, 0xff, 0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xca, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 
+  0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xca, 0xaf, 0xff, 0x7c, 0xc8, 0xaf, 0xff, 0xb7, 0xd1, 0xd7, 0xff, 0xce, 0xdc, 0xec, 0xff, 0xad, 0xcf, 0xdf, 0xff, 0x7f, 0xf6, 0xf8, 0xff, 0x7e, 0xff, 0xff, 0xff, 
+  0x7f, 0xff, 0xff, 0xff, 0x93, 0xda, 0xe4, 0xff, 0x9d, 0xcb, 0xdb, 0xff, 0x80, 0xf9, 0xfa, 0xff, 0x7f, 0xfb, 0xfc, 0xff, 0x7f, 0xfa, 0xfb, 0xff, 0x8b, 0xc1, 0xcd, 0xff, 0xa4, 0xb1, 0xbe, 0xff, 
+  0x94, 0x9e, 0xaa, 0xff, 0x92, 0x99, 0xa0, 0xff, 0x86, 0x8c, 0x93, 0xff, 0x7b, 0x81, 0x87, 0xff, 0x68, 0x75, 0x8d, 0xff, 0x07, 0x62, 0xf4, 0xff, 0x83, 0x00, 0x65, 0xff, 0xff, 0x0a, 0x09, 0x62, 
+  0xf3, 0xff, 0x5e, 0x6b, 0x84, 0xff, 0x6e, 0x76, 0x7f, 0xff, 0x77, 0x80, 0x8a, 0xff, 0xab, 0xad, 0xaf, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd8, 0xda, 0xdd, 0xff, 0xbe, 0xcc, 0xdb, 0xff, 0xcc, 0xda, 
+  0xea, 0xff, 0xb6, 0xd1, 0xd8, 0xff, 0x7c, 0xc7, 0xb0, 0xff, 0x81, 0x7a, 0xc9, 0xb0, 0xff, 0x06, 0x7b, 0xca, 0xb0, 0xff, 0x79, 0xc9, 0xaf, 0xff, 0x7a, 0xca, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 
+  0x7a, 0xca, 0xaf, 0xff, 0x7a, 0xc9, 0xaf, 0xff, 0x7a, 0xc9, 0xae, 0xff, 0x81, 0x79, 0xc9, 0xae, 0xff, 0x03, 0x84, 0xc8, 0xae, 0xff, 0xd0, 0xc3, 0xaa, 0xff, 0xde, 0xc1, 0xa8, 0xff, 0xdd, 0xdf, 
+  0xe0, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 0xff, 0x02, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdd, 0xdd, 0xdd, 0x70, 0x82, 0xf2, 0xf2, 0xf2, 0xff, 0x02, 0x99, 0xca, 0xbe, 0xff, 0x78, 0xc8, 
+  0xad, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x81, 0x79, 0xc9, 0xae, 0xff, 0x15, 0x7a, 0xc7, 0xae, 0xff, 0xbc, 0xd5, 0xd9, 0xff, 0xd6, 0xe2, 0xef, 0xff, 0xb3, 0xd2, 0xe1, 0xff, 0x7d, 0xf6, 0xf8, 0xff, 
+  0x7d, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0x95, 0xdb, 0xe5, 0xff, 0xa2, 0xcf, 0xdd, 0xff, 0x7c, 0xfa, 0xfb, 0xff, 0x74, 0xea, 0xea, 0xff, 0x7a, 0xf4, 0xf4, 0xff, 0x93, 0xcd, 0xd7, 0xff, 
+  0xbf, 0xca, 0xd7, 0xff, 0xbc, 0xc7, 0xd3, 0xff, 0xcb, 0xd2, 0xdc, 0xff, 0xc9, 0xd1, 0xda, 0xff, 0xc0, 0xc8, 0xd1, 0xff, 0xb6, 0xbd, 0xc5, 0xff, 0x9d, 0xa3, 0xaa, 0xff, 0x51, 0x6d, 0xb7, 0xff, 
+  0x00, 0x63, 0xfe, 0xff, 0x81, 0x00, 0x64, 0xff, 0xff, 0x0e, 0x00, 0x63, 0xfe, 0xff, 0x5d, 0x75, 0xb9, 0xff, 0x9d, 0xa4, 0xab, 0xff, 0xa4, 0xad, 0xb8, 0xff, 0xaf, 0xba, 0xc6, 0xff, 0xb5, 0xc0, 
+  0xcd, 0xff, 0xeb, 0xed, 0xf0, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf0, 0xf3, 0xf6, 0xff, 0xcb, 0xd8, 0xe6, 0xff, 0xd6, 0xe2, 0xef, 0xff, 0xbd, 0xd5, 0xda, 0xff, 0x7a, 0xc7, 0xae, 0xff, 0x79, 0xc9, 
+  0xaf, 0xff, 0x79, 0xc9, 0xae, 0xff, 0x81, 0x77, 0xc8, 0xad, 0xff, 0x01, 0x78, 0xc8, 0xae, 0xff, 0x78, 0xc8, 0xad, 0xff, 0x81, 0x78, 0xc9, 0xae, 0xff, 0x05, 0x78, 0xc8, 0xad, 0xff, 0x83, 0xc8, 
+  0xae, 0xff, 0xcf, 0xc2, 0xa9, 0xff, 0xde, 0xc1, 0xa8, 0xff, 0xde, 0xc1, 0xa9, 0xff, 0xde, 0xe0, 0xe0, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 0xff, 0x02, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 
+  0xdd, 0xdd, 0xdd, 0x70, 0x82, 0xf2, 0xf2, 0xf2, 0xff, 0x08, 0x9b, 0xcb, 0xbf, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x78, 0xc8, 0xae, 0xff, 0x76, 0xc8, 0xad, 0xff, 0x79, 0xc7, 0xad, 0xff, 0xc4, 0xda, 
+  0xdc, 0xff, 0xde, 0xe8, 0xf2, 0xff, 0xb9, 0xd7, 0xe4, 0xff, 0x7b, 0xf6, 0xf9, 0xff, 0x81, 0x7b, 0xff, 0xff, 0xff, 0x0f, 0x99, 0xde, 0xe6, 0xff, 0xa7, 0xd2, 0xdf, 0xff, 0x7b, 0xfa, 0xfb, 0xff, 
+  0x75, 0xf0, 0xf0, 0xff, 0x7b, 0xfa, 0xfa, 0xff, 0x96, 0xce, 0xd7, 0xff, 0xc6, 0xcf, 0xd9, 0xff, 0xc4, 0xcc, 0xd5, 0xff, 0xd3, 0xda, 0xe0, 0xff, 0xd9, 0xdf, 0xe5, 0xff, 0xd8, 0xde, 0xe5, 0xff, 
+  0xd8, 0xde, 0xe4, 0xff, 0xd3, 0xd9, 0xe0, 0xff, 0xb8, 0xc0, 0xc9, 0xff, 0x90, 0x97, 0x9f, 0xff, 0x2c, 0x63, 0xe0, 0xff, 0x81, 0x00, 0x63, 0xff, 0xff, 0x06, 0x34, 0x66, 0xdf, 0xff, 0x9d, 0xa1, 
+  0xa7, 0xff, 0xcc, 0xd2, 0xd8, 0xff, 0xcd, 0xd4, 0xda, 0xff, 0xc5, 0xce, 0xd8, 0xff, 0xc7, 0xd0, 0xda, 0xff, 0xc7, 0xcf, 0xd9, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf0, 0xf3, 0xf6, 0xff, 
+  0xd1, 0xdc, 0xe7, 0xff, 0xde, 0xe8, 0xf2, 0xff, 0xc3, 0xd9, 0xdc, 0xff, 0x79, 0xc7, 0xae, 0xff, 0x78, 0xc9, 0xae, 0xff, 0x82, 0x77, 0xc8, 0xad, 0xff, 0x08, 0x77, 0xc8, 0xae, 0xff, 0x76, 0xc8, 
+  0xad, 0xff, 0x77, 0xc8, 0xad, 0xff, 0x80, 0xc7, 0xac, 0xff, 0xcf, 0xc2, 0xa8, 0xff, 0xde, 0xc0, 0xa7, 0xff, 0xdd, 0xc0, 0xa7, 0xff, 0xde, 0xc0, 0xa7, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0x81, 0xf2, 
+  0xf2, 0xf2, 0xff, 0x02, 0xed, 0xed, 0xed, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdd, 0xdd, 0xdd, 0x70, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x14, 0xf2, 0xf2, 0xf2, 0xff, 0x9a, 0xcb, 0xbe, 0xff, 0x76, 0xc8, 
+  0xad, 0xff, 0x75, 0xc8, 0xac, 0xff, 0x79, 0xc7, 0xad, 0xff, 0xc9, 0xde, 0xde, 0xff, 0xe7, 0xee, 0xf5, 0xff, 0xbf, 0xdc, 0xe6, 0xff, 0x7b, 0xf7, 0xf9, 0xff, 0x7a, 0xff, 0xff, 0xff, 0x79, 0xff, 
+  0xff, 0xff, 0x9c, 0xe0, 0xe8, 0xff, 0xac, 0xd6, 0xe0, 0xff, 0x7a, 0xfa, 0xfc, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x7b, 0xfd, 0xfd, 0xff, 0xb4, 0xe5, 0xe9, 0xff, 0xc4, 0xcd, 0xd5, 0xff, 0xcd, 0xd4, 
+  0xda, 0xff, 0xd3, 0xd8, 0xdd, 0xff, 0xde, 0xe2, 0xe7, 0xff, 0x81, 0xdd, 0xe2, 0xe7, 0xff, 0x16, 0xda, 0xdf, 0xe3, 0xff, 0xcb, 0xd1, 0xd7, 0xff, 0xce, 0xd4, 0xdb, 0xff, 0xb7, 0xbd, 0xc3, 0xff, 
+  0x75, 0x80, 0x9e, 0xff, 0x03, 0x60, 0xf8, 0xff, 0x04, 0x60, 0xf8, 0xff, 0x81, 0x8b, 0xa5, 0xff, 0xc4, 0xc8, 0xcd, 0xff, 0xd5, 0xda, 0xdf, 0xff, 0xcd, 0xd3, 0xda, 0xff, 0xcf, 0xd5, 0xdd, 0xff, 
+  0xc5, 0xcd, 0xd5, 0xff, 0xfb, 0xfc, 0xfc, 0xff, 0xd7, 0xdd, 0xe3, 0xff, 0xf0, 0xf3, 0xf5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xef, 0xf1, 0xf4, 0xff, 0xd7, 0xe0, 0xea, 0xff, 0xe6, 0xee, 0xf5, 0xff, 
+  0xc9, 0xde, 0xde, 0xff, 0x78, 0xc7, 0xad, 0xff, 0x76, 0xc7, 0xac, 0xff, 0x81, 0x76, 0xc8, 0xac, 0xff, 0x03, 0x76, 0xc8, 0xad, 0xff, 0x75, 0xc7, 0xac, 0xff, 0x80, 0xc7, 0xab, 0xff, 0xce, 0xc1, 
+  0xa7, 0xff, 0x81, 0xdd, 0xc0, 0xa6, 0xff, 0x02, 0xdd, 0xbf, 0xa6, 0xff, 0xdd, 0xc0, 0xa7, 0xff, 0xdf, 0xe0, 0xe0, 0xff, 0x81, 0xf2, 0xf2, 0xf2, 0xff, 0x02, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 
+  0x00, 0x0b, 0xdc, 0xdc, 0xdc, 0x70, 0x82, 0xf1, 0xf1, 0xf1, 0xff, 0x16, 0x9b, 0xcb, 0xbe, 0xff, 0x74, 0xc7, 0xab, 0xff, 0x78, 0xc7, 0xad, 0xff, 0xd1, 0xe3, 0xe1, 0xff, 0xef, 0xf4, 0xf8, 0xff, 
+  0xc6, 0xe0, 0xe8, 0xff, 0x7b, 0xf7, 0xf9, 0xff, 0x78, 0xff, 0xff, 0xff, 0x79, 0xff, 0xff, 0xff, 0x9e, 0xe2, 0xe9, 0xff, 0xb1, 0xd8, 0xe2, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x7a, 0xff, 0xff, 0xff, 
+  0x79, 0xfe, 0xfe, 0xff, 0x9c, 0xd5, 0xdb, 0xff, 0xf7, 0xf8, 0xf9, 0xff, 0xdd, 0xe1, 0xe6, 0xff, 0xce, 0xd4, 0xda, 0xff, 0xd3, 0xd6, 0xdb, 0xff, 0xdd, 0xe0, 0xe4, 0xff, 0xe3, 0xe6, 0xe9, 0xff, 
+  0xe0, 0xe3, 0xe6, 0xff, 0xd2, 0xd5, 0xda, 0xff, 0x81, 0xd7, 0xdb, 0xe0, 0xff, 0x1b, 0xcb, 0xce, 0xd3, 0xff, 0xb4, 0xb6, 0xb8, 0xff, 0x58, 0x73, 0xc5, 0xff, 0x5a, 0x74, 0xc3, 0xff, 0xb6, 0xb8, 
+  0xbb, 0xff, 0xd6, 0xd9, 0xdd, 0xff, 0xd3, 0xd7, 0xdc, 0xff, 0xd6, 0xda, 0xdf, 0xff, 0xc8, 0xd0, 0xd7, 0xff, 0xfb, 0xfc, 0xfc, 0xff, 0xd4, 0xda, 0xe0, 0xff, 0xd1, 0xd6, 0xdc, 0xff, 0xce, 0xd4, 
+  0xdb, 0xff, 0xee, 0xf0, 0xf3, 0xff, 0xee, 0xee, 0xee, 0xff, 0xf0, 0xf2, 0xf5, 0xff, 0xdd, 0xe4, 0xec, 0xff, 0xef, 0xf3, 0xf8, 0xff, 0xd0, 0xe2, 0xe0, 0xff, 0x77, 0xc6, 0xac, 0xff, 0x74, 0xc7, 
+  0xab, 0xff, 0x75, 0xc7, 0xac, 0xff, 0x74, 0xc7, 0xab, 0xff, 0x7f, 0xc6, 0xab, 0xff, 0xcd, 0xc0, 0xa6, 0xff, 0xdd, 0xbf, 0xa6, 0xff, 0xdd, 0xc0, 0xa6, 0xff, 0xdd, 0xbf, 0xa5, 0xff, 0x81, 0xdd, 
+  0xc0, 0xa6, 0xff, 0x00, 0xdf, 0xe0, 0xe0, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x02, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdc, 0xdc, 0xdc, 0x70, 0x82, 0xf1, 0xf1, 0xf1, 0xff, 0x15, 
+  0x9b, 0xcc, 0xbe, 0xff, 0x77, 0xc7, 0xac, 0xff, 0xd6, 0xe6, 0xe3, 0xff, 0xf7, 0xfa, 0xfc, 0xff, 0xcc, 0xe4, 0xeb, 0xff, 0x7a, 0xf7, 0xf9, 0xff, 0x71, 0xee, 0xee, 0xff, 0x77, 0xfe, 0xfe, 0xff, 
+  0xa3, 0xe4, 0xea, 0xff, 0xb6, 0xdc, 0xe5, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x77, 0xff, 0xff, 0xff, 0x78, 0xfe, 0xfe, 0xff, 0xa1, 0xd5, 0xdb, 0xff, 0xdc, 0xdf, 0xe1, 0xff, 0xcc, 0xd1, 0xd8, 0xff, 
+  0xf8, 0xf9, 0xfa, 0xff, 0xde, 0xe2, 0xe7, 0xff, 0xd5, 0xd9, 0xdc, 0xff, 0xda, 0xdb, 0xdd, 0xff, 0xdf, 0xe0, 0xe2, 0xff, 0xd8, 0xda, 0xdc, 0xff, 0x81, 0xde, 0xe0, 0xe2, 0xff, 0x18, 0xd7, 0xd9, 
+  0xda, 0xff, 0xe6, 0xe7, 0xe8, 0xff, 0xd8, 0xd9, 0xda, 0xff, 0xa5, 0xa7, 0xab, 0xff, 0xa6, 0xa8, 0xab, 0xff, 0xd3, 0xd4, 0xd5, 0xff, 0xda, 0xdc, 0xdd, 0xff, 0xde, 0xe0, 0xe2, 0xff, 0xcd, 0xd2, 
+  0xd8, 0xff, 0xfc, 0xfc, 0xfd, 0xff, 0xd7, 0xdc, 0xe1, 0xff, 0xd9, 0xdc, 0xde, 0xff, 0xde, 0xe0, 0xe2, 0xff, 0xdf, 0xe0, 0xe2, 0xff, 0xd2, 0xd7, 0xdd, 0xff, 0xef, 0xf1, 0xf4, 0xff, 0xf8, 0xf8, 
+  0xf8, 0xff, 0xf1, 0xf3, 0xf6, 0xff, 0xe3, 0xe9, 0xee, 0xff, 0xf7, 0xfa, 0xfc, 0xff, 0xd6, 0xe7, 0xe3, 0xff, 0x77, 0xc7, 0xac, 0xff, 0x73, 0xc7, 0xab, 0xff, 0x77, 0xc6, 0xaa, 0xff, 0xce, 0xc0, 
+  0xa5, 0xff, 0x83, 0xdd, 0xbf, 0xa5, 0xff, 0x02, 0xdc, 0xbe, 0xa5, 0xff, 0xdc, 0xbe, 0xa4, 0xff, 0xe0, 0xe1, 0xe0, 0xff, 0x81, 0xf1, 0xf1, 0xf1, 0xff, 0x02, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 
+  0x00, 0x0b, 0xdb, 0xdb, 0xdb, 0x70, 0x82, 0xf1, 0xf1, 0xf1, 0xff, 0x0d, 0x9f, 0xcb, 0xbf, 0xff, 0xdc, 0xea, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xe7, 0xec, 0xff, 0x78, 0xf3, 0xf5, 0xff, 
+  0x6d, 0xea, 0xea, 0xff, 0x76, 0xfd, 0xfd, 0xff, 0xa5, 0xe5, 0xeb, 0xff, 0xbb, 0xdf, 0xe6, 0xff, 0x79, 0xfb, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x76, 0xfe, 0xfe, 0xff, 0xa2, 0xd6, 0xdb, 0xff, 
+  0xe2, 0xe2, 0xe3, 0xff, 0x81, 0xe4, 0xe4, 0xe4, 0xff, 0x04, 0xcf, 0xd4, 0xd9, 0xff, 0xf7, 0xf8, 0xf9, 0xff, 0xd3, 0xd8, 0xdd, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x81, 0xe4, 
+  0xe4, 0xe4, 0xff, 0x0b, 0xdc, 0xdd, 0xdd, 0xff, 0xea, 0xea, 0xeb, 0xff, 0xec, 0xec, 0xec, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 
+  0xe4, 0xe4, 0xe4, 0xff, 0xce, 0xd2, 0xd6, 0xff, 0xfa, 0xfb, 0xfc, 0xff, 0xd8, 0xdd, 0xe1, 0xff, 0xde, 0xdf, 0xe0, 0xff, 0x83, 0xe4, 0xe4, 0xe4, 0xff, 0x10, 0xd6, 0xd9, 0xde, 0xff, 0xf0, 0xf3, 
+  0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xef, 0xf3, 0xff, 0xe2, 0xe7, 0xec, 0xff, 0xef, 0xf2, 0xf5, 0xff, 0xc6, 0xda, 0xd7, 0xff, 0x88, 0xc6, 0xb4, 0xff, 0x93, 0xc9, 0xb9, 0xff, 0xc4, 0xca, 
+  0xbe, 0xff, 0xd7, 0xce, 0xc6, 0xff, 0xd9, 0xd3, 0xcc, 0xff, 0xdb, 0xd7, 0xd2, 0xff, 0xdd, 0xda, 0xd6, 0xff, 0xde, 0xde, 0xdc, 0xff, 0xe1, 0xe2, 0xe2, 0xff, 0xee, 0xef, 0xef, 0xff, 0x81, 0xf1, 
+  0xf1, 0xf1, 0xff, 0x02, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdc, 0xdc, 0xdc, 0x70, 0x82, 0xf1, 0xf1, 0xf1, 0xff, 0x0c, 0xe6, 0xea, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xe8, 
+  0xed, 0xff, 0x79, 0xf8, 0xf9, 0xff, 0x74, 0xfb, 0xfb, 0xff, 0x73, 0xf7, 0xf7, 0xff, 0xa4, 0xe5, 0xeb, 0xff, 0xbb, 0xdf, 0xe6, 0xff, 0x78, 0xfb, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x76, 0xfe, 
+  0xfe, 0xff, 0xa2, 0xd6, 0xdc, 0xff, 0xe2, 0xe2, 0xe3, 0xff, 0x83, 0xe4, 0xe4, 0xe4, 0xff, 0x01, 0xd1, 0xd5, 0xd9, 0xff, 0xd8, 0xda, 0xdc, 0xff, 0x82, 0xe4, 0xe4, 0xe4, 0xff, 0x01, 0xdc, 0xdc, 
+  0xdc, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x82, 0xec, 0xec, 0xec, 0xff, 0x11, 0xe5, 0xe5, 0xe5, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe2, 0xe3, 0xe3, 0xff, 0xde, 0xdf, 0xe0, 0xff, 0xd6, 0xda, 0xdc, 0xff, 
+  0xbf, 0xc8, 0xcf, 0xff, 0xd0, 0xd5, 0xd9, 0xff, 0xd8, 0xdc, 0xde, 0xff, 0xd9, 0xdd, 0xdf, 0xff, 0xd9, 0xde, 0xe0, 0xff, 0xdb, 0xdf, 0xe1, 0xff, 0xdd, 0xe1, 0xe3, 0xff, 0xde, 0xe2, 0xe4, 0xff, 
+  0xdb, 0xe0, 0xe3, 0xff, 0xe2, 0xe7, 0xe9, 0xff, 0xe6, 0xe9, 0xeb, 0xff, 0xea, 0xec, 0xed, 0xff, 0xef, 0xf0, 0xf0, 0xff, 0x8c, 0xf1, 0xf1, 0xf1, 0xff, 0x02, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 
+  0x00, 0x0b, 0xdb, 0xdb, 0xdb, 0x70, 0x82, 0xf1, 0xf1, 0xf1, 0xff, 0x0b, 0xea, 0xee, 0xf1, 0xff, 0xd1, 0xe8, 0xed, 0xff, 0x79, 0xf8, 0xf9, 0xff, 0x75, 0xff, 0xff, 0xff, 0x74, 0xff, 0xff, 0xff, 
+  0xa4, 0xe5, 0xeb, 0xff, 0xba, 0xde, 0xe6, 0xff, 0x76, 0xfb, 0xfc, 0xff, 0x76, 0xff, 0xff, 0xff, 0x75, 0xfe, 0xfe, 0xff, 0xa1, 0xd6, 0xdb, 0xff, 0xe2, 0xe2, 0xe3, 0xff, 0x84, 0xe4, 0xe4, 0xe4, 
+  0xff, 0x0e, 0xe0, 0xe1, 0xe1, 0xff, 0xdb, 0xdd, 0xde, 0xff, 0xd8, 0xdb, 0xdd, 0xff, 0xd6, 0xda, 0xdd, 0xff, 0xd8, 0xdb, 0xde, 0xff, 0xd3, 0xd7, 0xd9, 0xff, 0xdd, 0xe2, 0xe4, 0xff, 0xde, 0xe2, 
+  0xe5, 0xff, 0xde, 0xe3, 0xe5, 0xff, 0xdf, 0xe4, 0xe6, 0xff, 0xdc, 0xe0, 0xe2, 0xff, 0xdf, 0xe3, 0xe5, 0xff, 0xe1, 0xe5, 0xe7, 0xff, 0xe7, 0xea, 0xeb, 0xff, 0xec, 0xee, 0xef, 0xff, 0x99, 0xf1, 
+  0xf1, 0xf1, 0xff, 0x02, 0xec, 0xec, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x0b, 0xdb, 0xdb, 0xdb, 0x70, 0x82, 0xf1, 0xf1, 0xf1, 0xff, 0x13, 0xbf, 0xda, 0xe1, 0xff, 0x77, 0xf8, 0xf9, 0xff, 0x76, 0xff, 
+  0xff, 0xff, 0x75, 0xff, 0xff, 0xff, 0xa0, 0xe3, 0xea, 0xff, 0xb7, 0xda, 0xe1, 0xff, 0x74, 0xf1, 0xf3, 0xff, 0x7a, 0xf1, 0xf4, 0xff, 0x84, 0xf0, 0xf2, 0xff, 0x9e, 0xd5, 0xdb, 0xff, 0xd6, 0xdb, 
+  0xde, 0xff, 0xd9, 0xde, 0xe0, 0xff, 0xdb, 0xdf, 0xe2, 0xff, 0xdc, 0xe0, 0xe3, 0xff, 0xde, 0xe2, 0xe4, 0xff, 0xdf, 0xe3, 0xe5, 0xff, 0xe0, 0xe4, 0xe6, 0xff, 0xe4, 0xe7, 0xe9, 0xff, 0xea, 0xec, 
+  0xed, 0xff, 0xef, 0xef, 0xf0, 0xff, 0xa0, 0xf1, 0xf1, 0xf1, 0xff, 0x07, 0xee, 0xee, 0xee, 0xf8, 0xe7, 0xe7, 0xe7, 0xe8, 0xe1, 0xe1, 0xe1, 0xdb, 0xdc, 0xdc, 0xdc, 0xcb, 0xd8, 0xd8, 0xd8, 0xbb, 
+  0xd5, 0xd5, 0xd5, 0x97, 0x00, 0x00, 0x00, 0x08, 0xdb, 0xdb, 0xdb, 0x70, 0x82, 0xf1, 0xf1, 0xf1, 0xff, 0x06, 0xcb, 0xe8, 0xea, 0xff, 0xc4, 0xe9, 0xec, 0xff, 0xca, 0xe8, 0xea, 0xff, 0xd1, 0xe6, 
+  0xe8, 0xff, 0xe0, 0xe4, 0xe7, 0xff, 0xe5, 0xe9, 0xeb, 0xff, 0xec, 0xee, 0xee, 0xff, 0xa0, 0xf1, 0xf1, 0xf1, 0xff, 0x14, 0xf0, 0xf0, 0xf0, 0xfc, 0xea, 0xea, 0xea, 0xf0, 0xe4, 0xe4, 0xe4, 0xe3, 
+  0xde, 0xde, 0xde, 0xd3, 0xda, 0xda, 0xda, 0xc3, 0xd7, 0xd7, 0xd7, 0xb3, 0xd9, 0xd9, 0xd9, 0xa3, 0xd1, 0xd1, 0xd1, 0x90, 0xc3, 0xc3, 0xc3, 0x7f, 0xb1, 0xb1, 0xb1, 0x6c, 0x99, 0x99, 0x99, 0x58, 
+  0x75, 0x75, 0x75, 0x44, 0x36, 0x36, 0x36, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 
+  0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x70, 0x9e, 0xf1, 0xf1, 0xf1, 0xff, 0x15, 0xee, 0xee, 0xee, 0xf8, 0xe7, 0xe7, 0xe7, 0xe8, 0xe1, 0xe1, 0xe1, 0xdb, 0xdc, 0xdc, 0xdc, 0xcb, 0xd8, 0xd8, 
+  0xd8, 0xbb, 0xd7, 0xd7, 0xd7, 0xab, 0xd7, 0xd7, 0xd7, 0x98, 0xcb, 0xcb, 0xcb, 0x88, 0xba, 0xba, 0xba, 0x77, 0xa6, 0xa6, 0xa6, 0x63, 0x89, 0x89, 0x89, 0x4f, 0x5a, 0x5a, 0x5a, 0x3c, 0x0e, 0x0e, 
+  0x0e, 0x2b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+  0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x00, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0x70, 0x91, 0xf1, 0xf1, 0xf1, 0xff, 0x13, 0xf0, 0xf0, 0xf0, 0xfc, 0xea, 
+  0xea, 0xea, 0xf0, 0xe4, 0xe4, 0xe4, 0xe3, 0xde, 0xde, 0xde, 0xd3, 0xda, 0xda, 0xda, 0xc3, 0xd7, 0xd7, 0xd7, 0xb3, 0xd9, 0xd9, 0xd9, 0xa3, 0xd2, 0xd2, 0xd2, 0x90, 0xc3, 0xc3, 0xc3, 0x7f, 0xb2, 
+  0xb2, 0xb2, 0x6c, 0x99, 0x99, 0x99, 0x58, 0x75, 0x75, 0x75, 0x44, 0x36, 0x36, 0x36, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x00, 
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 
+  0xdb, 0xdb, 0x70, 0x85, 0xf1, 0xf1, 0xf1, 0xff, 0x15, 0xee, 0xee, 0xee, 0xf8, 0xe7, 0xe7, 0xe7, 0xe8, 0xe1, 0xe1, 0xe1, 0xdb, 0xdc, 0xdc, 0xdc, 0xcb, 0xd8, 0xd8, 0xd8, 0xbb, 0xd7, 0xd7, 0xd7, 
+  0xab, 0xd7, 0xd7, 0xd7, 0x98, 0xcb, 0xcb, 0xcb, 0x88, 0xba, 0xba, 0xba, 0x77, 0xa6, 0xa6, 0xa6, 0x63, 0x89, 0x89, 0x89, 0x4f, 0x5b, 0x5b, 0x5b, 0x3c, 0x0e, 0x0e, 0x0e, 0x2b, 0x00, 0x00, 0x00, 
+  0x23, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+  0x04, 0x81, 0x00, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc9, 0xc9, 0xc9, 0x43, 0xd3, 0xd3, 0xd3, 0x8f, 0xc3, 0xc3, 0xc3, 0x7f, 0xb2, 0xb2, 0xb2, 0x6c, 0x99, 0x99, 0x99, 0x58, 
+  0x75, 0x75, 0x75, 0x44, 0x36, 0x36, 0x36, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 
+  0x00, 0x00, 0x00, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xad, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x00, 0x03, 0xb9, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +960,7 @@ const lv_img_dsc_t osmand_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( osmand_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = osmand_64px_map,
 };
-
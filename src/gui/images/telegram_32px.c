@@ -10,143 +10,152 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TELEGRAM_32PX uint8_t telegram_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x13, 0x04, 0x13, 0x48, 0x13, 0x83, 0x13, 0xac, 0x13, 0xd4, 0x13, 0xeb, 0x13, 0xe8, 0x13, 0xd7, 0x13, 0xaf, 0x13, 0x84, 0x13, 0x4f, 0x13, 0x08, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x13, 0x10, 0x13, 0x74, 0x13, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf4, 0x13, 0x7f, 0x13, 0x17, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x00, 0x13, 0x54, 0x13, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf4, 0x13, 0x67, 0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x03, 0x13, 0x9b, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xb3, 0x13, 0x07, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x13, 0x04, 0x13, 0xb4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcf, 0x13, 0x0c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x03, 0x13, 0xab, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc8, 0x13, 0x08, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x13, 0x78, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x9f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0a, 0x00, 0x13, 0x30, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x4b, 0x0a, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x13, 0x00, 0x13, 0xc7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xe0, 0x13, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0x13, 0x40, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x5b, 0x0a, 0x00, 
-  0x0e, 0x00, 0x13, 0x9c, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc0, 0x13, 0x00, 
-  0x13, 0x04, 0x13, 0xf7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x18, 
-  0x13, 0x3f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x5b, 
-  0x13, 0x67, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x7f, 
-  0x13, 0x7c, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x93, 
-  0x13, 0x88, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x97, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x9f, 
-  0x13, 0x87, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa0, 
-  0x13, 0x7f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x9b, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x94, 
-  0x13, 0x68, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x83, 
-  0x13, 0x40, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x5f, 
-  0x13, 0x08, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x23, 
-  0x13, 0x00, 0x13, 0xa3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x77, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xcc, 0x0f, 0x00, 
-  0x00, 0x00, 0x13, 0x48, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x97, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x63, 0x0a, 0x00, 
-  0x00, 0x00, 0x13, 0x00, 0x13, 0xd0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xe7, 0x13, 0x0c, 0x00, 0x00, 
-  0x00, 0x00, 0x0a, 0x00, 0x13, 0x38, 0x13, 0xfc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x54, 0x0a, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x13, 0x88, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xac, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x04, 0x13, 0xbc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd0, 0x13, 0x0c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x08, 0x13, 0xc7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd8, 0x13, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x04, 0x13, 0xb0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc4, 0x13, 0x13, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x03, 0x13, 0x6b, 0x13, 0xf7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0x83, 0x13, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x13, 0x1b, 0x13, 0x8f, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x9f, 0x13, 0x27, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x13, 0x13, 0x5f, 0x13, 0x94, 0x13, 0xc8, 0x13, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf0, 0x13, 0xcb, 0x13, 0x9b, 0x13, 0x64, 0x13, 0x17, 0x13, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x0b, 0x13, 0x04, 0x13, 0x48, 0x13, 0x83, 0x13, 0xac, 0x13, 0xd4, 0x13, 0xeb, 0x13, 0xe8, 0x13, 0xd7, 0x13, 0xaf, 0x13, 0x84, 0x13, 0x4f, 0x13, 0x08, 
+  0x91, 0x00, 0x00, 0x02, 0x13, 0x10, 0x13, 0x74, 0x13, 0xec, 0x89, 0x13, 0xff, 0x02, 0x13, 0xf4, 0x13, 0x7f, 0x13, 0x17, 0x8e, 0x00, 0x00, 0x01, 0x13, 0x54, 0x13, 0xec, 0x8d, 0x13, 0xff, 0x02, 
+  0x13, 0xf4, 0x13, 0x67, 0x13, 0x03, 0x8a, 0x00, 0x00, 0x01, 0x17, 0x03, 0x13, 0x9b, 0x91, 0x13, 0xff, 0x01, 0x13, 0xb3, 0x13, 0x07, 0x88, 0x00, 0x00, 0x01, 0x13, 0x04, 0x13, 0xb4, 0x93, 0x13, 
+  0xff, 0x01, 0x13, 0xcf, 0x13, 0x0c, 0x86, 0x00, 0x00, 0x01, 0x13, 0x03, 0x13, 0xab, 0x95, 0x13, 0xff, 0x01, 0x13, 0xc8, 0x13, 0x08, 0x85, 0x00, 0x00, 0x00, 0x13, 0x78, 0x97, 0x13, 0xff, 0x00, 
+  0x13, 0x9f, 0x84, 0x00, 0x00, 0x01, 0x13, 0x30, 0x13, 0xfb, 0x98, 0x13, 0xff, 0x00, 0x13, 0x4b, 0x83, 0x00, 0x00, 0x00, 0x13, 0xc7, 0x99, 0x13, 0xff, 0x01, 0x13, 0xe0, 0x13, 0x07, 0x81, 0x00, 
+  0x00, 0x00, 0x13, 0x40, 0x93, 0x13, 0xff, 0x81, 0x57, 0xff, 0x85, 0x13, 0xff, 0x00, 0x13, 0x5b, 0x81, 0x00, 0x00, 0x00, 0x13, 0x9c, 0x91, 0x13, 0xff, 0x00, 0xbb, 0xff, 0x81, 0xff, 0xff, 0x00, 
+  0xdf, 0xff, 0x85, 0x13, 0xff, 0x03, 0x13, 0xc0, 0x00, 0x00, 0x13, 0x04, 0x13, 0xf7, 0x8e, 0x13, 0xff, 0x01, 0x77, 0xff, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x86, 0x13, 0xff, 0x01, 
+  0x13, 0x18, 0x13, 0x3f, 0x8c, 0x13, 0xff, 0x01, 0x57, 0xff, 0xbb, 0xff, 0x86, 0xff, 0xff, 0x00, 0xbb, 0xff, 0x86, 0x13, 0xff, 0x01, 0x13, 0x5b, 0x13, 0x67, 0x8a, 0x13, 0xff, 0x01, 0x77, 0xff, 
+  0xdf, 0xff, 0x84, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x00, 0x97, 0xff, 0x86, 0x13, 0xff, 0x01, 0x13, 0x7f, 0x13, 0x7c, 0x87, 0x13, 0xff, 0x01, 0x33, 0xff, 0xbb, 0xff, 0x85, 0xff, 
+  0xff, 0x00, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x87, 0x13, 0xff, 0x01, 0x13, 0x93, 0x13, 0x88, 0x85, 0x13, 0xff, 0x01, 0x97, 0xff, 0xdf, 0xff, 0x86, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x85, 0xff, 0xff, 
+  0x87, 0x13, 0xff, 0x01, 0x13, 0x9f, 0x13, 0x87, 0x85, 0x13, 0xff, 0x86, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x87, 0x13, 0xff, 0x01, 0x13, 0xa0, 0x13, 0x7f, 0x86, 
+  0x13, 0xff, 0x01, 0x9b, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x86, 0xff, 0xff, 0x00, 0xbb, 0xff, 0x87, 0x13, 0xff, 0x01, 0x13, 0x94, 0x13, 0x68, 0x88, 0x13, 0xff, 0x01, 0x33, 
+  0xff, 0xbb, 0xff, 0x81, 0xdf, 0xff, 0x87, 0xff, 0xff, 0x00, 0x97, 0xff, 0x87, 0x13, 0xff, 0x01, 0x13, 0x83, 0x13, 0x40, 0x89, 0x13, 0xff, 0x00, 0x77, 0xff, 0x81, 0xdf, 0xff, 0x87, 0xff, 0xff, 
+  0x88, 0x13, 0xff, 0x02, 0x13, 0x5f, 0x13, 0x08, 0x13, 0xfb, 0x88, 0x13, 0xff, 0x01, 0x33, 0xff, 0xdf, 0xff, 0x81, 0xdb, 0xff, 0x86, 0xff, 0xff, 0x88, 0x13, 0xff, 0x02, 0x13, 0x23, 0x00, 0x00, 
+  0x13, 0xa3, 0x89, 0x13, 0xff, 0x00, 0xbb, 0xff, 0x81, 0xdb, 0xff, 0x01, 0x77, 0xff, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x87, 0x13, 0xff, 0x00, 0x13, 0xcc, 0x81, 0x00, 0x00, 0x00, 
+  0x13, 0x48, 0x89, 0x13, 0xff, 0x02, 0x97, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x81, 0x13, 0xff, 0x00, 0x9b, 0xff, 0x82, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x87, 0x13, 0xff, 0x00, 0x13, 0x63, 0x82, 0x00, 
+  0x00, 0x00, 0x13, 0xd0, 0x88, 0x13, 0xff, 0x01, 0x33, 0xff, 0x57, 0xff, 0x83, 0x13, 0xff, 0x00, 0x77, 0xff, 0x81, 0xff, 0xff, 0x00, 0x77, 0xff, 0x86, 0x13, 0xff, 0x01, 0x13, 0xe7, 0x13, 0x0c, 
+  0x82, 0x00, 0x00, 0x01, 0x13, 0x38, 0x13, 0xfc, 0x8e, 0x13, 0xff, 0x01, 0x33, 0xff, 0x77, 0xff, 0x87, 0x13, 0xff, 0x00, 0x13, 0x54, 0x84, 0x00, 0x00, 0x00, 0x13, 0x88, 0x97, 0x13, 0xff, 0x00, 
+  0x13, 0xac, 0x85, 0x00, 0x00, 0x01, 0x13, 0x04, 0x13, 0xbc, 0x95, 0x13, 0xff, 0x01, 0x13, 0xd0, 0x13, 0x0c, 0x86, 0x00, 0x00, 0x01, 0x13, 0x08, 0x13, 0xc7, 0x93, 0x13, 0xff, 0x01, 0x13, 0xd8, 
+  0x13, 0x17, 0x88, 0x00, 0x00, 0x01, 0x13, 0x04, 0x13, 0xb0, 0x91, 0x13, 0xff, 0x01, 0x13, 0xc4, 0x13, 0x13, 0x8a, 0x00, 0x00, 0x02, 0x13, 0x03, 0x13, 0x6b, 0x13, 0xf7, 0x8d, 0x13, 0xff, 0x02, 
+  0x13, 0xfc, 0x13, 0x83, 0x13, 0x04, 0x8d, 0x00, 0x00, 0x02, 0x13, 0x1b, 0x13, 0x8f, 0x13, 0xfb, 0x8a, 0x13, 0xff, 0x01, 0x13, 0x9f, 0x13, 0x27, 0x91, 0x00, 0x00, 0x04, 0x13, 0x13, 0x13, 0x5f, 
+  0x13, 0x94, 0x13, 0xc8, 0x13, 0xf0, 0x81, 0x13, 0xff, 0x04, 0x13, 0xf0, 0x13, 0xcb, 0x13, 0x9b, 0x13, 0x64, 0x13, 0x17, 0x89, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x03, 0x00, 0x3a, 0x04, 0x04, 0x59, 0x04, 0x48, 0x59, 0x04, 0x83, 0x59, 0x04, 0xac, 0x59, 0x04, 0xd4, 0x59, 0x04, 0xeb, 0x59, 0x04, 0xe8, 0x59, 0x04, 0xd7, 0x59, 0x04, 0xaf, 0x59, 0x04, 0x84, 0x59, 0x04, 0x4f, 0x39, 0x04, 0x08, 0xd3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x03, 0x00, 0x59, 0x04, 0x10, 0x59, 0x04, 0x74, 0x59, 0x04, 0xec, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf4, 0x59, 0x04, 0x7f, 0x59, 0x04, 0x17, 0xd2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0xd6, 0x03, 0x00, 0x59, 0x04, 0x54, 0x59, 0x04, 0xec, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf4, 0x59, 0x04, 0x67, 0x59, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1a, 0x05, 0x03, 0x59, 0x04, 0x9b, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xb3, 0x5a, 0x04, 0x07, 0x2d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x02, 0x00, 0x39, 0x04, 0x04, 0x59, 0x04, 0xb4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xcf, 0x59, 0x04, 0x0c, 0x2d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x04, 0x03, 0x59, 0x04, 0xab, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc8, 0x59, 0x04, 0x08, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x03, 0x00, 0x59, 0x04, 0x78, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x9f, 0xf7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x59, 0x04, 0x30, 0x59, 0x04, 0xfb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x4b, 0x4e, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd7, 0x03, 0x00, 0x59, 0x04, 0xc7, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xe0, 0x39, 0x04, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x59, 0x04, 0x40, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xfa, 0x4c, 0xff, 0xfa, 0x54, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x5b, 0x2d, 0x02, 0x00, 
-  0x13, 0x03, 0x00, 0x59, 0x04, 0x9c, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x1c, 0x9e, 0xff, 0x3e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xd7, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc0, 0xb6, 0x03, 0x00, 
-  0x5a, 0x04, 0x04, 0x59, 0x04, 0xf7, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x3b, 0x6d, 0xff, 0x9d, 0xbe, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xce, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x18, 
-  0x59, 0x04, 0x3f, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x9a, 0x3c, 0xff, 0xfc, 0x9d, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xae, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x5b, 
-  0x59, 0x04, 0x67, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x0c, 0xff, 0x1b, 0x65, 0xff, 0xde, 0xc6, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xdf, 0xff, 0xfe, 0xd6, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x85, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x7f, 
-  0x59, 0x04, 0x7c, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x7a, 0x1c, 0xff, 0x3c, 0xae, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xfd, 0xd6, 0xff, 0x1e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x0c, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x93, 
-  0x59, 0x04, 0x88, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x5b, 0x75, 0xff, 0xde, 0xc6, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xdf, 0xff, 0xdd, 0xce, 0xff, 0x1e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x9f, 
-  0x59, 0x04, 0x87, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x7a, 0x0c, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xef, 0xff, 0xfd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x3e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xc6, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xa0, 
-  0x59, 0x04, 0x7f, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0xbc, 0x8d, 0xff, 0xfe, 0xce, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x3e, 0xdf, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9d, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x94, 
-  0x59, 0x04, 0x68, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x79, 0x24, 0xff, 0x1c, 0xa6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x7e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x75, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x83, 
-  0x59, 0x04, 0x40, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x1a, 0x65, 0xff, 0xdd, 0xd6, 0xff, 0xbd, 0xc6, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x0c, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x5f, 
-  0x39, 0x04, 0x08, 0x59, 0x04, 0xfb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x7a, 0x2c, 0xff, 0xbd, 0xce, 0xff, 0x7c, 0xb6, 0xff, 0x7c, 0xbe, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x23, 
-  0x15, 0x04, 0x00, 0x59, 0x04, 0xa3, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x5c, 0xb6, 0xff, 0x5c, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5a, 0x6d, 0xff, 0xbd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xbe, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xcc, 0x96, 0x03, 0x00, 
-  0x00, 0x00, 0x00, 0x59, 0x04, 0x48, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x9b, 0x85, 0xff, 0x7c, 0xbe, 0xff, 0x5a, 0x75, 0xff, 0x39, 0x04, 0xff, 0x39, 0x04, 0xff, 0xbc, 0x8d, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x8d, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x63, 0x2d, 0x02, 0x00, 
-  0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0xd0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x7a, 0x1c, 0xff, 0xda, 0x54, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0xda, 0x54, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5c, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xe7, 0x59, 0x04, 0x0c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x59, 0x04, 0x38, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x1c, 0xff, 0xfa, 0x5c, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x54, 0x2e, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0x39, 0x04, 0x88, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xac, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x04, 0x04, 0x59, 0x04, 0xbc, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xd0, 0x39, 0x04, 0x0c, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x5a, 0x04, 0x08, 0x59, 0x04, 0xc7, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xd8, 0x59, 0x04, 0x17, 0x2d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x02, 0x00, 0x3a, 0x04, 0x04, 0x59, 0x04, 0xb0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc4, 0x3a, 0x04, 0x13, 0x2e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x39, 0x04, 0x03, 0x59, 0x04, 0x6b, 0x59, 0x04, 0xf7, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xfc, 0x59, 0x04, 0x83, 0x39, 0x04, 0x04, 0x4d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x59, 0x04, 0x1b, 0x59, 0x04, 0x8f, 0x59, 0x04, 0xfb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x9f, 0x59, 0x04, 0x27, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x03, 0x00, 0x59, 0x04, 0x13, 0x59, 0x04, 0x5f, 0x59, 0x04, 0x94, 0x59, 0x04, 0xc8, 0x59, 0x04, 0xf0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf0, 0x59, 0x04, 0xcb, 0x59, 0x04, 0x9b, 0x59, 0x04, 0x64, 0x59, 0x04, 0x17, 0x17, 0x04, 0x00, 0x51, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x0b, 0x3a, 0x04, 0x04, 0x59, 0x04, 0x48, 0x59, 0x04, 0x83, 0x59, 0x04, 0xac, 0x59, 0x04, 0xd4, 0x59, 0x04, 0xeb, 0x59, 0x04, 0xe8, 0x59, 0x04, 
+  0xd7, 0x59, 0x04, 0xaf, 0x59, 0x04, 0x84, 0x59, 0x04, 0x4f, 0x39, 0x04, 0x08, 0x91, 0x00, 0x00, 0x00, 0x02, 0x59, 0x04, 0x10, 0x59, 0x04, 0x74, 0x59, 0x04, 0xec, 0x89, 0x59, 0x04, 0xff, 0x02, 
+  0x59, 0x04, 0xf4, 0x59, 0x04, 0x7f, 0x59, 0x04, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x54, 0x59, 0x04, 0xec, 0x8d, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0xf4, 0x59, 0x04, 0x67, 0x59, 
+  0x04, 0x03, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x05, 0x03, 0x59, 0x04, 0x9b, 0x91, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xb3, 0x5a, 0x04, 0x07, 0x88, 0x00, 0x00, 0x00, 0x01, 0x39, 0x04, 0x04, 
+  0x59, 0x04, 0xb4, 0x93, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xcf, 0x59, 0x04, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x04, 0x03, 0x59, 0x04, 0xab, 0x95, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 
+  0xc8, 0x59, 0x04, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x78, 0x97, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x9f, 0x84, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x30, 0x59, 0x04, 0xfb, 0x98, 
+  0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x4b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0xc7, 0x99, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xe0, 0x39, 0x04, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x59, 
+  0x04, 0x40, 0x92, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 0xff, 0xfa, 0x4c, 0xff, 0xfa, 0x54, 0xff, 0x85, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x5b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x9c, 
+  0x91, 0x59, 0x04, 0xff, 0x04, 0x1c, 0x9e, 0xff, 0x3e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xd7, 0xff, 0x39, 0x04, 0xff, 0x84, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x5a, 
+  0x04, 0x04, 0x59, 0x04, 0xf7, 0x8d, 0x59, 0x04, 0xff, 0x03, 0x39, 0x04, 0xff, 0x3b, 0x6d, 0xff, 0x9d, 0xbe, 0xff, 0xdf, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xdd, 0xce, 0xff, 0x86, 0x59, 
+  0x04, 0xff, 0x01, 0x59, 0x04, 0x18, 0x59, 0x04, 0x3f, 0x8b, 0x59, 0x04, 0xff, 0x03, 0x39, 0x04, 0xff, 0x9a, 0x3c, 0xff, 0xfc, 0x9d, 0xff, 0x7f, 0xe7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xbf, 
+  0xf7, 0xff, 0x5e, 0xe7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0x3c, 0xae, 0xff, 0x86, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0x5b, 0x59, 0x04, 0x67, 0x89, 0x59, 0x04, 0xff, 0x03, 0x59, 0x0c, 0xff, 
+  0x1b, 0x65, 0xff, 0xde, 0xc6, 0xff, 0xdf, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x5e, 0xdf, 0xff, 0xfe, 0xd6, 0xff, 0xdf, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0x9b, 0x85, 0xff, 0x86, 
+  0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0x7f, 0x59, 0x04, 0x7c, 0x87, 0x59, 0x04, 0xff, 0x02, 0x7a, 0x1c, 0xff, 0x3c, 0xae, 0xff, 0x7f, 0xe7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xbf, 0xf7, 0xff, 
+  0xfd, 0xd6, 0xff, 0x1e, 0xd7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x7a, 0x0c, 0xff, 0x86, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0x93, 0x59, 0x04, 0x88, 0x85, 0x59, 0x04, 0xff, 0x02, 0x5b, 0x75, 
+  0xff, 0xde, 0xc6, 0xff, 0xdf, 0xf7, 0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 0x5e, 0xdf, 0xff, 0xdd, 0xce, 0xff, 0x1e, 0xd7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x7f, 0xdf, 0xff, 0x39, 0x04, 0xff, 
+  0x86, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0x9f, 0x59, 0x04, 0x87, 0x84, 0x59, 0x04, 0xff, 0x01, 0x7a, 0x0c, 0xff, 0xdf, 0xf7, 0xff, 0x84, 0xff, 0xff, 0xff, 0x03, 0x9f, 0xef, 0xff, 0xfd, 0xce, 
+  0xff, 0xdd, 0xce, 0xff, 0x3e, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x00, 0xbd, 0xc6, 0xff, 0x87, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xa0, 0x59, 0x04, 0x7f, 0x86, 0x59, 0x04, 0xff, 0x04, 0xbc, 
+  0x8d, 0xff, 0xfe, 0xce, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x3e, 0xdf, 0xff, 0x81, 0xdd, 0xce, 0xff, 0x00, 0x5e, 0xe7, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfc, 0x9d, 0xff, 0x87, 0x59, 
+  0x04, 0xff, 0x01, 0x59, 0x04, 0x94, 0x59, 0x04, 0x68, 0x87, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 0xff, 0x79, 0x24, 0xff, 0x1c, 0xa6, 0xff, 0x81, 0xdd, 0xce, 0xff, 0x00, 0x7e, 0xe7, 0xff, 0x86, 
+  0xff, 0xff, 0xff, 0x00, 0x5b, 0x75, 0xff, 0x87, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0x83, 0x59, 0x04, 0x40, 0x89, 0x59, 0x04, 0xff, 0x03, 0x1a, 0x65, 0xff, 0xdd, 0xd6, 0xff, 0xbd, 0xc6, 0xff, 
+  0xdf, 0xf7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0x7a, 0x0c, 0xff, 0x87, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0x5f, 0x39, 0x04, 0x08, 0x59, 0x04, 0xfb, 0x88, 0x59, 0x04, 0xff, 0x04, 0x7a, 0x2c, 
+  0xff, 0xbd, 0xce, 0xff, 0x7c, 0xb6, 0xff, 0x7c, 0xbe, 0xff, 0x9f, 0xef, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0x7f, 0xdf, 0xff, 0x39, 0x04, 0xff, 0x87, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0x23, 
+  0x00, 0x00, 0x00, 0x59, 0x04, 0xa3, 0x88, 0x59, 0x04, 0xff, 0x00, 0x39, 0x04, 0xff, 0x81, 0x5c, 0xb6, 0xff, 0x02, 0x5b, 0xb6, 0xff, 0x5a, 0x6d, 0xff, 0xbd, 0xbe, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0x00, 0x9d, 0xbe, 0xff, 0x87, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xcc, 0x81, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x48, 0x89, 0x59, 0x04, 0xff, 0x02, 0x9b, 0x85, 0xff, 0x7c, 0xbe, 0xff, 0x5a, 
+  0x75, 0xff, 0x81, 0x39, 0x04, 0xff, 0x01, 0xbc, 0x8d, 0xff, 0xdf, 0xf7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0xdc, 0x8d, 0xff, 0x87, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x63, 0x82, 0x00, 0x00, 
+  0x00, 0x00, 0x59, 0x04, 0xd0, 0x88, 0x59, 0x04, 0xff, 0x01, 0x7a, 0x1c, 0xff, 0xda, 0x54, 0xff, 0x83, 0x59, 0x04, 0xff, 0x03, 0xda, 0x54, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5c, 
+  0xff, 0x86, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xe7, 0x59, 0x04, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x38, 0x59, 0x04, 0xfc, 0x8e, 0x59, 0x04, 0xff, 0x01, 0x59, 0x1c, 0xff, 0xfa, 
+  0x5c, 0xff, 0x87, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x54, 0x84, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x88, 0x97, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xac, 0x85, 0x00, 0x00, 0x00, 0x01, 0x7a, 
+  0x04, 0x04, 0x59, 0x04, 0xbc, 0x95, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xd0, 0x39, 0x04, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x04, 0x08, 0x59, 0x04, 0xc7, 0x93, 0x59, 0x04, 0xff, 0x01, 
+  0x59, 0x04, 0xd8, 0x59, 0x04, 0x17, 0x88, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x04, 0x04, 0x59, 0x04, 0xb0, 0x91, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xc4, 0x3a, 0x04, 0x13, 0x8a, 0x00, 0x00, 0x00, 
+  0x02, 0x39, 0x04, 0x03, 0x59, 0x04, 0x6b, 0x59, 0x04, 0xf7, 0x8d, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0xfc, 0x59, 0x04, 0x83, 0x39, 0x04, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x59, 0x04, 0x1b, 
+  0x59, 0x04, 0x8f, 0x59, 0x04, 0xfb, 0x8a, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0x9f, 0x59, 0x04, 0x27, 0x91, 0x00, 0x00, 0x00, 0x04, 0x59, 0x04, 0x13, 0x59, 0x04, 0x5f, 0x59, 0x04, 0x94, 0x59, 
+  0x04, 0xc8, 0x59, 0x04, 0xf0, 0x81, 0x59, 0x04, 0xff, 0x04, 0x59, 0x04, 0xf0, 0x59, 0x04, 0xcb, 0x59, 0x04, 0x9b, 0x59, 0x04, 0x64, 0x59, 0x04, 0x17, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x00, 0x04, 0x3a, 0x04, 0x04, 0x59, 0x48, 0x04, 0x59, 0x83, 0x04, 0x59, 0xac, 0x04, 0x59, 0xd4, 0x04, 0x59, 0xeb, 0x04, 0x59, 0xe8, 0x04, 0x59, 0xd7, 0x04, 0x59, 0xaf, 0x04, 0x59, 0x84, 0x04, 0x59, 0x4f, 0x04, 0x39, 0x08, 0x02, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x32, 0x00, 0x04, 0x59, 0x10, 0x04, 0x59, 0x74, 0x04, 0x59, 0xec, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf4, 0x04, 0x59, 0x7f, 0x04, 0x59, 0x17, 0x02, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x03, 0xd6, 0x00, 0x04, 0x59, 0x54, 0x04, 0x59, 0xec, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf4, 0x04, 0x59, 0x67, 0x04, 0x59, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x1a, 0x03, 0x04, 0x59, 0x9b, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xb3, 0x04, 0x5a, 0x07, 0x02, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x00, 0x04, 0x39, 0x04, 0x04, 0x59, 0xb4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xcf, 0x04, 0x59, 0x0c, 0x02, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3a, 0x03, 0x04, 0x59, 0xab, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc8, 0x04, 0x59, 0x08, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x00, 0x04, 0x59, 0x78, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x9f, 0x03, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0x2c, 0x00, 0x04, 0x59, 0x30, 0x04, 0x59, 0xfb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x4b, 0x02, 0x4e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0xd7, 0x00, 0x04, 0x59, 0xc7, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xe0, 0x04, 0x39, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x59, 0x40, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x4c, 0xfa, 0xff, 0x54, 0xfa, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x5b, 0x02, 0x2d, 0x00, 
-  0x03, 0x13, 0x00, 0x04, 0x59, 0x9c, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x9e, 0x1c, 0xff, 0xd7, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x1e, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc0, 0x03, 0xb6, 0x00, 
-  0x04, 0x5a, 0x04, 0x04, 0x59, 0xf7, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x6d, 0x3b, 0xff, 0xbe, 0x9d, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xdd, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x18, 
-  0x04, 0x59, 0x3f, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x3c, 0x9a, 0xff, 0x9d, 0xfc, 0xff, 0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x3c, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x5b, 
-  0x04, 0x59, 0x67, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x0c, 0x59, 0xff, 0x65, 0x1b, 0xff, 0xc6, 0xde, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x5e, 0xff, 0xd6, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x9b, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x7f, 
-  0x04, 0x59, 0x7c, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x1c, 0x7a, 0xff, 0xae, 0x3c, 0xff, 0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xd6, 0xfd, 0xff, 0xd7, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x7a, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x93, 
-  0x04, 0x59, 0x88, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x75, 0x5b, 0xff, 0xc6, 0xde, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x5e, 0xff, 0xce, 0xdd, 0xff, 0xd7, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7f, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x9f, 
-  0x04, 0x59, 0x87, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x0c, 0x7a, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9f, 0xff, 0xce, 0xfd, 0xff, 0xce, 0xdd, 0xff, 0xdf, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xbd, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xa0, 
-  0x04, 0x59, 0x7f, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x8d, 0xbc, 0xff, 0xce, 0xfe, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0x3e, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xfc, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x94, 
-  0x04, 0x59, 0x68, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x24, 0x79, 0xff, 0xa6, 0x1c, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xe7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0x5b, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x83, 
-  0x04, 0x59, 0x40, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x65, 0x1a, 0xff, 0xd6, 0xdd, 0xff, 0xc6, 0xbd, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x7a, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x5f, 
-  0x04, 0x39, 0x08, 0x04, 0x59, 0xfb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x2c, 0x7a, 0xff, 0xce, 0xbd, 0xff, 0xb6, 0x7c, 0xff, 0xbe, 0x7c, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7f, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x23, 
-  0x04, 0x15, 0x00, 0x04, 0x59, 0xa3, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0xb6, 0x5c, 0xff, 0xb6, 0x5c, 0xff, 0xb6, 0x5b, 0xff, 0x6d, 0x5a, 0xff, 0xbe, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x9d, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xcc, 0x03, 0x96, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x59, 0x48, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x85, 0x9b, 0xff, 0xbe, 0x7c, 0xff, 0x75, 0x5a, 0xff, 0x04, 0x39, 0xff, 0x04, 0x39, 0xff, 0x8d, 0xbc, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xdc, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x63, 0x02, 0x2d, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0xd0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x1c, 0x7a, 0xff, 0x54, 0xda, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x54, 0xda, 0xff, 0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xfa, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xe7, 0x04, 0x59, 0x0c, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x04, 0x59, 0x38, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x1c, 0x59, 0xff, 0x5c, 0xfa, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x54, 0x02, 0x2e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x00, 0x04, 0x39, 0x88, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xac, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7a, 0x04, 0x04, 0x59, 0xbc, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xd0, 0x04, 0x39, 0x0c, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4d, 0x00, 0x04, 0x5a, 0x08, 0x04, 0x59, 0xc7, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xd8, 0x04, 0x59, 0x17, 0x02, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4e, 0x00, 0x04, 0x3a, 0x04, 0x04, 0x59, 0xb0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc4, 0x04, 0x3a, 0x13, 0x02, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x04, 0x39, 0x03, 0x04, 0x59, 0x6b, 0x04, 0x59, 0xf7, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xfc, 0x04, 0x59, 0x83, 0x04, 0x39, 0x04, 0x02, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf2, 0x00, 0x04, 0x59, 0x1b, 0x04, 0x59, 0x8f, 0x04, 0x59, 0xfb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x9f, 0x04, 0x59, 0x27, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd6, 0x00, 0x04, 0x59, 0x13, 0x04, 0x59, 0x5f, 0x04, 0x59, 0x94, 0x04, 0x59, 0xc8, 0x04, 0x59, 0xf0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf0, 0x04, 0x59, 0xcb, 0x04, 0x59, 0x9b, 0x04, 0x59, 0x64, 0x04, 0x59, 0x17, 0x04, 0x17, 0x00, 0x04, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x0b, 0x04, 0x3a, 0x04, 0x04, 0x59, 0x48, 0x04, 0x59, 0x83, 0x04, 0x59, 0xac, 0x04, 0x59, 0xd4, 0x04, 0x59, 0xeb, 0x04, 0x59, 0xe8, 0x04, 0x59, 
+  0xd7, 0x04, 0x59, 0xaf, 0x04, 0x59, 0x84, 0x04, 0x59, 0x4f, 0x04, 0x39, 0x08, 0x91, 0x00, 0x00, 0x00, 0x02, 0x04, 0x59, 0x10, 0x04, 0x59, 0x74, 0x04, 0x59, 0xec, 0x89, 0x04, 0x59, 0xff, 0x02, 
+  0x04, 0x59, 0xf4, 0x04, 0x59, 0x7f, 0x04, 0x59, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x54, 0x04, 0x59, 0xec, 0x8d, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0xf4, 0x04, 0x59, 0x67, 0x04, 
+  0x59, 0x03, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x05, 0x1a, 0x03, 0x04, 0x59, 0x9b, 0x91, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xb3, 0x04, 0x5a, 0x07, 0x88, 0x00, 0x00, 0x00, 0x01, 0x04, 0x39, 0x04, 
+  0x04, 0x59, 0xb4, 0x93, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xcf, 0x04, 0x59, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x01, 0x04, 0x3a, 0x03, 0x04, 0x59, 0xab, 0x95, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 
+  0xc8, 0x04, 0x59, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x78, 0x97, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x9f, 0x84, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x30, 0x04, 0x59, 0xfb, 0x98, 
+  0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x4b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0xc7, 0x99, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xe0, 0x04, 0x39, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 
+  0x59, 0x40, 0x92, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 0xff, 0x4c, 0xfa, 0xff, 0x54, 0xfa, 0xff, 0x85, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x5b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x9c, 
+  0x91, 0x04, 0x59, 0xff, 0x04, 0x9e, 0x1c, 0xff, 0xd7, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x1e, 0xff, 0x04, 0x39, 0xff, 0x84, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 0xc0, 0x00, 0x00, 0x00, 0x04, 
+  0x5a, 0x04, 0x04, 0x59, 0xf7, 0x8d, 0x04, 0x59, 0xff, 0x03, 0x04, 0x39, 0xff, 0x6d, 0x3b, 0xff, 0xbe, 0x9d, 0xff, 0xf7, 0xdf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 0xce, 0xdd, 0xff, 0x86, 0x04, 
+  0x59, 0xff, 0x01, 0x04, 0x59, 0x18, 0x04, 0x59, 0x3f, 0x8b, 0x04, 0x59, 0xff, 0x03, 0x04, 0x39, 0xff, 0x3c, 0x9a, 0xff, 0x9d, 0xfc, 0xff, 0xe7, 0x7f, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xf7, 
+  0xbf, 0xff, 0xe7, 0x5e, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0xae, 0x3c, 0xff, 0x86, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0x5b, 0x04, 0x59, 0x67, 0x89, 0x04, 0x59, 0xff, 0x03, 0x0c, 0x59, 0xff, 
+  0x65, 0x1b, 0xff, 0xc6, 0xde, 0xff, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xdf, 0x5e, 0xff, 0xd6, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0x85, 0x9b, 0xff, 0x86, 
+  0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0x7f, 0x04, 0x59, 0x7c, 0x87, 0x04, 0x59, 0xff, 0x02, 0x1c, 0x7a, 0xff, 0xae, 0x3c, 0xff, 0xe7, 0x7f, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xbf, 0xff, 
+  0xd6, 0xfd, 0xff, 0xd7, 0x1e, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x0c, 0x7a, 0xff, 0x86, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0x93, 0x04, 0x59, 0x88, 0x85, 0x04, 0x59, 0xff, 0x02, 0x75, 0x5b, 
+  0xff, 0xc6, 0xde, 0xff, 0xf7, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 0xdf, 0x5e, 0xff, 0xce, 0xdd, 0xff, 0xd7, 0x1e, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xdf, 0x7f, 0xff, 0x04, 0x39, 0xff, 
+  0x86, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0x9f, 0x04, 0x59, 0x87, 0x84, 0x04, 0x59, 0xff, 0x01, 0x0c, 0x7a, 0xff, 0xf7, 0xdf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x03, 0xef, 0x9f, 0xff, 0xce, 0xfd, 
+  0xff, 0xce, 0xdd, 0xff, 0xdf, 0x3e, 0xff, 0x84, 0xff, 0xff, 0xff, 0x00, 0xc6, 0xbd, 0xff, 0x87, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xa0, 0x04, 0x59, 0x7f, 0x86, 0x04, 0x59, 0xff, 0x04, 0x8d, 
+  0xbc, 0xff, 0xce, 0xfe, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0x3e, 0xff, 0x81, 0xce, 0xdd, 0xff, 0x00, 0xe7, 0x5e, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0x9d, 0xfc, 0xff, 0x87, 0x04, 
+  0x59, 0xff, 0x01, 0x04, 0x59, 0x94, 0x04, 0x59, 0x68, 0x87, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 0xff, 0x24, 0x79, 0xff, 0xa6, 0x1c, 0xff, 0x81, 0xce, 0xdd, 0xff, 0x00, 0xe7, 0x7e, 0xff, 0x86, 
+  0xff, 0xff, 0xff, 0x00, 0x75, 0x5b, 0xff, 0x87, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0x83, 0x04, 0x59, 0x40, 0x89, 0x04, 0x59, 0xff, 0x03, 0x65, 0x1a, 0xff, 0xd6, 0xdd, 0xff, 0xc6, 0xbd, 0xff, 
+  0xf7, 0xdf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0x0c, 0x7a, 0xff, 0x87, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0x5f, 0x04, 0x39, 0x08, 0x04, 0x59, 0xfb, 0x88, 0x04, 0x59, 0xff, 0x04, 0x2c, 0x7a, 
+  0xff, 0xce, 0xbd, 0xff, 0xb6, 0x7c, 0xff, 0xbe, 0x7c, 0xff, 0xef, 0x9f, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xdf, 0x7f, 0xff, 0x04, 0x39, 0xff, 0x87, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0x23, 
+  0x00, 0x00, 0x00, 0x04, 0x59, 0xa3, 0x88, 0x04, 0x59, 0xff, 0x00, 0x04, 0x39, 0xff, 0x81, 0xb6, 0x5c, 0xff, 0x02, 0xb6, 0x5b, 0xff, 0x6d, 0x5a, 0xff, 0xbe, 0xbd, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0x00, 0xbe, 0x9d, 0xff, 0x87, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xcc, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x48, 0x89, 0x04, 0x59, 0xff, 0x02, 0x85, 0x9b, 0xff, 0xbe, 0x7c, 0xff, 0x75, 
+  0x5a, 0xff, 0x81, 0x04, 0x39, 0xff, 0x01, 0x8d, 0xbc, 0xff, 0xf7, 0xdf, 0xff, 0x81, 0xff, 0xff, 0xff, 0x00, 0x8d, 0xdc, 0xff, 0x87, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x63, 0x82, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0x59, 0xd0, 0x88, 0x04, 0x59, 0xff, 0x01, 0x1c, 0x7a, 0xff, 0x54, 0xda, 0xff, 0x83, 0x04, 0x59, 0xff, 0x03, 0x54, 0xda, 0xff, 0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xfa, 
+  0xff, 0x86, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xe7, 0x04, 0x59, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x38, 0x04, 0x59, 0xfc, 0x8e, 0x04, 0x59, 0xff, 0x01, 0x1c, 0x59, 0xff, 0x5c, 
+  0xfa, 0xff, 0x87, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x54, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x88, 0x97, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xac, 0x85, 0x00, 0x00, 0x00, 0x01, 0x04, 
+  0x7a, 0x04, 0x04, 0x59, 0xbc, 0x95, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xd0, 0x04, 0x39, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x01, 0x04, 0x5a, 0x08, 0x04, 0x59, 0xc7, 0x93, 0x04, 0x59, 0xff, 0x01, 
+  0x04, 0x59, 0xd8, 0x04, 0x59, 0x17, 0x88, 0x00, 0x00, 0x00, 0x01, 0x04, 0x3a, 0x04, 0x04, 0x59, 0xb0, 0x91, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xc4, 0x04, 0x3a, 0x13, 0x8a, 0x00, 0x00, 0x00, 
+  0x02, 0x04, 0x39, 0x03, 0x04, 0x59, 0x6b, 0x04, 0x59, 0xf7, 0x8d, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0xfc, 0x04, 0x59, 0x83, 0x04, 0x39, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x04, 0x59, 0x1b, 
+  0x04, 0x59, 0x8f, 0x04, 0x59, 0xfb, 0x8a, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0x9f, 0x04, 0x59, 0x27, 0x91, 0x00, 0x00, 0x00, 0x04, 0x04, 0x59, 0x13, 0x04, 0x59, 0x5f, 0x04, 0x59, 0x94, 0x04, 
+  0x59, 0xc8, 0x04, 0x59, 0xf0, 0x81, 0x04, 0x59, 0xff, 0x04, 0x04, 0x59, 0xf0, 0x04, 0x59, 0xcb, 0x04, 0x59, 0x9b, 0x04, 0x59, 0x64, 0x04, 0x59, 0x17, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x64, 0x00, 0x00, 0xcd, 0x86, 0x00, 0x04, 0xcb, 0x87, 0x00, 0x48, 0xcb, 0x87, 0x00, 0x83, 0xcb, 0x87, 0x00, 0xac, 0xcb, 0x87, 0x00, 0xd4, 0xcb, 0x87, 0x00, 0xeb, 0xcb, 0x87, 0x00, 0xe8, 0xcb, 0x87, 0x00, 0xd7, 0xcb, 0x87, 0x00, 0xaf, 0xcb, 0x87, 0x00, 0x84, 0xcb, 0x87, 0x00, 0x4f, 0xc9, 0x86, 0x00, 0x08, 0x95, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x63, 0x00, 0x00, 0xca, 0x87, 0x00, 0x10, 0xcb, 0x87, 0x00, 0x74, 0xcb, 0x87, 0x00, 0xec, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0x7f, 0xcb, 0x88, 0x00, 0x17, 0x93, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1c, 0x00, 0x00, 0xaf, 0x7a, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x54, 0xcb, 0x87, 0x00, 0xec, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0x67, 0xcb, 0x89, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xd3, 0x9f, 0x00, 0x03, 0xcb, 0x87, 0x00, 0x9b, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xb3, 0xd0, 0x87, 0x00, 0x07, 0x6c, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x59, 0x00, 0x00, 0xc6, 0x83, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xb4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xcf, 0xcc, 0x88, 0x00, 0x0c, 0x6c, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x86, 0x00, 0x03, 0xcb, 0x87, 0x00, 0xab, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xc8, 0xcc, 0x88, 0x00, 0x08, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x62, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x78, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x9f, 0xb9, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x63, 0x46, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x30, 0xcb, 0x87, 0x00, 0xfb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x4b, 0x6d, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb9, 0x7a, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xc7, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xe0, 0xc8, 0x86, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x40, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xd3, 0x9b, 0x48, 0xff, 0xd3, 0x9c, 0x50, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x5b, 0x6b, 0x45, 0x00, 0x00, 
-  0x95, 0x60, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x9c, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcc, 0x89, 0x00, 0xff, 0xe1, 0xbf, 0x9c, 0xff, 0xf2, 0xe4, 0xd4, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xf2, 0xe2, 0xcf, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xc0, 0xb1, 0x75, 0x00, 0x00, 
-  0xcd, 0x87, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xf7, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x84, 0x00, 0xff, 0xd7, 0xa6, 0x69, 0xff, 0xe8, 0xd1, 0xb6, 0xff, 0xfc, 0xf9, 0xf2, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xec, 0xd8, 0xc5, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x87, 0x00, 0x18, 
-  0xcb, 0x87, 0x00, 0x3f, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcf, 0x91, 0x37, 0xff, 0xe0, 0xbc, 0x97, 0xff, 0xf6, 0xeb, 0xdd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfa, 0xf6, 0xf2, 0xff, 0xf3, 0xe9, 0xdd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xe3, 0xc5, 0xa5, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x5b, 
-  0xcb, 0x87, 0x00, 0x67, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x88, 0x07, 0xff, 0xd5, 0xa2, 0x5e, 0xff, 0xed, 0xd9, 0xc3, 0xff, 0xfc, 0xf9, 0xf5, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf2, 0xe8, 0xdc, 0xff, 0xed, 0xde, 0xce, 0xff, 0xfd, 0xfa, 0xf8, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xda, 0xaf, 0x7d, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x7f, 
-  0xcb, 0x87, 0x00, 0x7c, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcd, 0x8d, 0x15, 0xff, 0xe4, 0xc5, 0xa6, 0xff, 0xf6, 0xec, 0xe1, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf9, 0xf4, 0xef, 0xff, 0xec, 0xdc, 0xcd, 0xff, 0xee, 0xe0, 0xd1, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xce, 0x8c, 0x0b, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x93, 
-  0xcb, 0x87, 0x00, 0x88, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0xd7, 0xa7, 0x72, 0xff, 0xed, 0xd9, 0xc4, 0xff, 0xfc, 0xf9, 0xf3, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfc, 0xfa, 0xff, 0xf2, 0xe7, 0xdc, 0xff, 0xe8, 0xd7, 0xc8, 0xff, 0xef, 0xe1, 0xd3, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf7, 0xec, 0xdb, 0xff, 0xca, 0x83, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x9f, 
-  0xcb, 0x87, 0x00, 0x87, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xce, 0x8c, 0x05, 0xff, 0xfc, 0xf8, 0xf2, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf7, 0xf1, 0xea, 0xff, 0xeb, 0xdb, 0xcc, 0xff, 0xe9, 0xd9, 0xcb, 0xff, 0xf0, 0xe5, 0xd7, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xea, 0xd4, 0xbd, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xa0, 
-  0xcb, 0x87, 0x00, 0x7f, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcc, 0x89, 0x00, 0xff, 0xde, 0xb6, 0x8c, 0xff, 0xef, 0xdd, 0xc9, 0xff, 0xfa, 0xf4, 0xed, 0xff, 0xfc, 0xfa, 0xf7, 0xff, 0xf0, 0xe4, 0xd7, 0xff, 0xe9, 0xd8, 0xcb, 0xff, 0xe9, 0xd8, 0xca, 0xff, 0xf3, 0xea, 0xdf, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xe1, 0xbe, 0x98, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x94, 
-  0xcb, 0x87, 0x00, 0x68, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcc, 0x8b, 0x1e, 0xff, 0xe0, 0xc2, 0xa3, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcb, 0xff, 0xf4, 0xec, 0xe4, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xd7, 0xa8, 0x71, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x83, 
-  0xcb, 0x87, 0x00, 0x40, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xd4, 0xa1, 0x62, 0xff, 0xe9, 0xda, 0xcd, 0xff, 0xe6, 0xd5, 0xc1, 0xff, 0xfb, 0xf8, 0xf4, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xcd, 0x8b, 0x08, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x5f, 
-  0xca, 0x86, 0x00, 0x08, 0xcb, 0x87, 0x00, 0xfb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcd, 0x8d, 0x26, 0xff, 0xe8, 0xd6, 0xc5, 0xff, 0xdf, 0xcb, 0xb3, 0xff, 0xdf, 0xcd, 0xb6, 0xff, 0xf6, 0xf0, 0xe8, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf6, 0xeb, 0xd9, 0xff, 0xca, 0x83, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x87, 0x00, 0x23, 
-  0xa7, 0x7f, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xa3, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xe2, 0xc8, 0xad, 0xff, 0xde, 0xca, 0xb1, 0xff, 0xdb, 0xc9, 0xb3, 0xff, 0xd3, 0xa7, 0x6c, 0xff, 0xea, 0xd4, 0xba, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xe8, 0xd0, 0xb8, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xcc, 0xb3, 0x6f, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x48, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xd8, 0xaf, 0x84, 0xff, 0xde, 0xcc, 0xb6, 0xff, 0xd2, 0xa7, 0x6f, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xdd, 0xb6, 0x88, 0xff, 0xfb, 0xf7, 0xf1, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xde, 0xb8, 0x8b, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x63, 0x6c, 0x46, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xcb, 0x8a, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xd0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcd, 0x8b, 0x1c, 0xff, 0xd0, 0x9a, 0x4e, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xd2, 0x9a, 0x54, 0xff, 0xf6, 0xec, 0xe0, 0xff, 0xfe, 0xfc, 0xfa, 0xff, 0xd3, 0x9d, 0x5b, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xe7, 0xca, 0x88, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x3f, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x38, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0xcc, 0x8a, 0x18, 0xff, 0xd3, 0x9e, 0x5b, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x87, 0x00, 0x54, 0x73, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x60, 0x00, 0x00, 0xcb, 0x86, 0x00, 0x88, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xac, 0xc3, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x8e, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xbc, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xd0, 0xca, 0x86, 0x00, 0x0c, 0x6c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x48, 0x00, 0x00, 0xd0, 0x8a, 0x00, 0x08, 0xcb, 0x87, 0x00, 0xc7, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xd8, 0xcb, 0x88, 0x00, 0x17, 0x6b, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x47, 0x00, 0x00, 0xd1, 0x83, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xb0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xc4, 0xcd, 0x86, 0x00, 0x13, 0x6d, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1c, 0x00, 0x00, 0xcb, 0x85, 0x00, 0x03, 0xcb, 0x87, 0x00, 0x6b, 0xcb, 0x87, 0x00, 0xf7, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0x83, 0xca, 0x86, 0x00, 0x04, 0x6b, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x5c, 0x00, 0x00, 0xcb, 0x88, 0x00, 0x1b, 0xcb, 0x87, 0x00, 0x8f, 0xcb, 0x87, 0x00, 0xfb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x9f, 0xcb, 0x87, 0x00, 0x27, 0x7d, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x77, 0x00, 0x00, 0xca, 0x87, 0x00, 0x13, 0xcb, 0x87, 0x00, 0x5f, 0xcb, 0x87, 0x00, 0x94, 0xcb, 0x87, 0x00, 0xc8, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0xcb, 0xcb, 0x87, 0x00, 0x9b, 0xcb, 0x87, 0x00, 0x64, 0xcc, 0x87, 0x00, 0x17, 0xb5, 0x82, 0x00, 0x00, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xcd, 0x86, 0x00, 0x04, 0xcb, 0x87, 0x00, 0x48, 0xcb, 0x87, 0x00, 0x83, 0xcb, 0x87, 0x00, 0xac, 0xcb, 0x87, 0x00, 0xd4, 0xcb, 0x87, 
+  0x00, 0xeb, 0xcb, 0x87, 0x00, 0xe8, 0xcb, 0x87, 0x00, 0xd7, 0xcb, 0x87, 0x00, 0xaf, 0xcb, 0x87, 0x00, 0x84, 0xcb, 0x87, 0x00, 0x4f, 0xc9, 0x86, 0x00, 0x08, 0x91, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xca, 0x87, 0x00, 0x10, 0xcb, 0x87, 0x00, 0x74, 0xcb, 0x87, 0x00, 0xec, 0x89, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0x7f, 0xcb, 0x88, 0x00, 0x17, 0x8e, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xcb, 0x87, 0x00, 0x54, 0xcb, 0x87, 0x00, 0xec, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0x67, 0xcb, 0x89, 0x00, 0x03, 0x8a, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xd3, 0x9f, 0x00, 0x03, 0xcb, 0x87, 0x00, 0x9b, 0x91, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xb3, 0xd0, 0x87, 0x00, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0xc6, 0x83, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xb4, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xcf, 0xcc, 0x88, 0x00, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x86, 0x00, 0x03, 
+  0xcb, 0x87, 0x00, 0xab, 0x95, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xc8, 0xcc, 0x88, 0x00, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x78, 0x97, 0xcb, 0x87, 0x00, 
+  0xff, 0x00, 0xcb, 0x87, 0x00, 0x9f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x87, 0x00, 0x30, 0xcb, 0x87, 0x00, 0xfb, 0x98, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x4b, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xc7, 0x99, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xe0, 0xc8, 0x86, 0x00, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x40, 
+  0x92, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x86, 0x00, 0xff, 0xd3, 0x9b, 0x48, 0xff, 0xd3, 0x9c, 0x50, 0xff, 0x85, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x5b, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xcb, 0x87, 0x00, 0x9c, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xcc, 0x89, 0x00, 0xff, 0xe1, 0xbf, 0x9c, 0xff, 0xf2, 0xe4, 0xd4, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xf2, 0xe2, 0xcf, 0xff, 
+  0xcb, 0x86, 0x00, 0xff, 0x84, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x87, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xf7, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x04, 
+  0xca, 0x84, 0x00, 0xff, 0xd7, 0xa6, 0x69, 0xff, 0xe8, 0xd1, 0xb6, 0xff, 0xfc, 0xf9, 0xf2, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x81, 0xfe, 0xfd, 0xfc, 0xff, 0x00, 0xec, 0xd8, 0xc5, 0xff, 0x86, 0xcb, 
+  0x87, 0x00, 0xff, 0x01, 0xca, 0x87, 0x00, 0x18, 0xcb, 0x87, 0x00, 0x3f, 0x8b, 0xcb, 0x87, 0x00, 0xff, 0x0a, 0xcb, 0x86, 0x00, 0xff, 0xcf, 0x91, 0x37, 0xff, 0xe0, 0xbc, 0x97, 0xff, 0xf6, 0xeb, 
+  0xdd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfa, 0xf6, 0xf2, 0xff, 0xf3, 0xe9, 0xdd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xe3, 0xc5, 0xa5, 0xff, 0x86, 0xcb, 
+  0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0x5b, 0xcb, 0x87, 0x00, 0x67, 0x89, 0xcb, 0x87, 0x00, 0xff, 0x04, 0xcb, 0x88, 0x07, 0xff, 0xd5, 0xa2, 0x5e, 0xff, 0xed, 0xd9, 0xc3, 0xff, 0xfc, 0xf9, 
+  0xf5, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x81, 0xfe, 0xfd, 0xfc, 0xff, 0x05, 0xf2, 0xe8, 0xdc, 0xff, 0xed, 0xde, 0xce, 0xff, 0xfd, 0xfa, 0xf8, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 
+  0xda, 0xaf, 0x7d, 0xff, 0x86, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0x7f, 0xcb, 0x87, 0x00, 0x7c, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcd, 0x8d, 0x15, 0xff, 0xe4, 0xc5, 0xa6, 0xff, 
+  0xf6, 0xec, 0xe1, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 0xff, 0x03, 0xf9, 0xf4, 0xef, 0xff, 0xec, 0xdc, 0xcd, 0xff, 0xee, 0xe0, 0xd1, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0x81, 0xfe, 
+  0xfd, 0xfc, 0xff, 0x01, 0xff, 0xfe, 0xfe, 0xff, 0xce, 0x8c, 0x0b, 0xff, 0x86, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0x93, 0xcb, 0x87, 0x00, 0x88, 0x84, 0xcb, 0x87, 0x00, 0xff, 0x04, 
+  0xcb, 0x87, 0x01, 0xff, 0xd7, 0xa7, 0x72, 0xff, 0xed, 0xd9, 0xc4, 0xff, 0xfc, 0xf9, 0xf3, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 0xff, 0x03, 0xfe, 0xfc, 0xfa, 0xff, 0xf2, 0xe7, 
+  0xdc, 0xff, 0xe8, 0xd7, 0xc8, 0xff, 0xef, 0xe1, 0xd3, 0xff, 0x83, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xf7, 0xec, 0xdb, 0xff, 0xca, 0x83, 0x00, 0xff, 0x86, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 
+  0x00, 0x9f, 0xcb, 0x87, 0x00, 0x87, 0x84, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xce, 0x8c, 0x05, 0xff, 0xfc, 0xf8, 0xf2, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 0xff, 0x05, 0xfe, 0xfe, 
+  0xfd, 0xff, 0xf7, 0xf1, 0xea, 0xff, 0xeb, 0xdb, 0xcc, 0xff, 0xe9, 0xd9, 0xcb, 0xff, 0xf0, 0xe5, 0xd7, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x83, 0xfe, 0xfd, 0xfc, 0xff, 0x00, 0xea, 0xd4, 0xbd, 0xff, 
+  0x87, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xa0, 0xcb, 0x87, 0x00, 0x7f, 0x85, 0xcb, 0x87, 0x00, 0xff, 0x09, 0xcc, 0x89, 0x00, 0xff, 0xde, 0xb6, 0x8c, 0xff, 0xef, 0xdd, 0xc9, 0xff, 
+  0xfa, 0xf4, 0xed, 0xff, 0xfc, 0xfa, 0xf7, 0xff, 0xf0, 0xe4, 0xd7, 0xff, 0xe9, 0xd8, 0xcb, 0xff, 0xe9, 0xd8, 0xca, 0xff, 0xf3, 0xea, 0xdf, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0x84, 0xfe, 0xfd, 0xfc, 
+  0xff, 0x00, 0xe1, 0xbe, 0x98, 0xff, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0x94, 0xcb, 0x87, 0x00, 0x68, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xcb, 0x86, 0x00, 0xff, 0xcc, 0x8b, 
+  0x1e, 0xff, 0xe0, 0xc2, 0xa3, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcb, 0xff, 0xf4, 0xec, 0xe4, 0xff, 0x86, 0xfe, 0xfd, 0xfc, 0xff, 0x00, 0xd7, 0xa8, 0x71, 0xff, 0x87, 0xcb, 0x87, 0x00, 
+  0xff, 0x01, 0xcb, 0x87, 0x00, 0x83, 0xcb, 0x87, 0x00, 0x40, 0x89, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xd4, 0xa1, 0x62, 0xff, 0xe9, 0xda, 0xcd, 0xff, 0xe6, 0xd5, 0xc1, 0xff, 0xfb, 0xf8, 0xf4, 0xff, 
+  0x85, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xfe, 0xfc, 0xfb, 0xff, 0xcd, 0x8b, 0x08, 0xff, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0x5f, 0xca, 0x86, 0x00, 0x08, 0xcb, 0x87, 0x00, 0xfb, 
+  0x88, 0xcb, 0x87, 0x00, 0xff, 0x04, 0xcd, 0x8d, 0x26, 0xff, 0xe8, 0xd6, 0xc5, 0xff, 0xdf, 0xcb, 0xb3, 0xff, 0xdf, 0xcd, 0xb6, 0xff, 0xf6, 0xf0, 0xe8, 0xff, 0x84, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 
+  0xf6, 0xeb, 0xd9, 0xff, 0xca, 0x83, 0x00, 0xff, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xca, 0x87, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xa3, 0x88, 0xcb, 0x87, 0x00, 0xff, 0x06, 
+  0xcb, 0x86, 0x00, 0xff, 0xe2, 0xc8, 0xad, 0xff, 0xde, 0xca, 0xb1, 0xff, 0xdb, 0xc9, 0xb3, 0xff, 0xd3, 0xa7, 0x6c, 0xff, 0xea, 0xd4, 0xba, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 
+  0xff, 0x00, 0xe8, 0xd0, 0xb8, 0xff, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0xcc, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x48, 0x89, 0xcb, 0x87, 0x00, 0xff, 0x02, 
+  0xd8, 0xaf, 0x84, 0xff, 0xde, 0xcc, 0xb6, 0xff, 0xd2, 0xa7, 0x6f, 0xff, 0x81, 0xcb, 0x86, 0x00, 0xff, 0x04, 0xdd, 0xb6, 0x88, 0xff, 0xfb, 0xf7, 0xf1, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 
+  0xfd, 0xff, 0xde, 0xb8, 0x8b, 0xff, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x63, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xd0, 0x88, 0xcb, 0x87, 0x00, 0xff, 0x01, 
+  0xcd, 0x8b, 0x1c, 0xff, 0xd0, 0x9a, 0x4e, 0xff, 0x83, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xd2, 0x9a, 0x54, 0xff, 0xf6, 0xec, 0xe0, 0xff, 0xfe, 0xfc, 0xfa, 0xff, 0xd3, 0x9d, 0x5b, 0xff, 0x86, 0xcb, 
+  0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xe7, 0xca, 0x88, 0x00, 0x0c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x87, 0x00, 0x38, 0xcb, 0x87, 0x00, 0xfc, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x02, 
+  0xcb, 0x87, 0x01, 0xff, 0xcc, 0x8a, 0x18, 0xff, 0xd3, 0x9e, 0x5b, 0xff, 0x87, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xca, 0x87, 0x00, 0x54, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x86, 0x00, 0x88, 
+  0x97, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0xac, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0x8e, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xbc, 0x95, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 
+  0x00, 0xd0, 0xca, 0x86, 0x00, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0x8a, 0x00, 0x08, 0xcb, 0x87, 0x00, 0xc7, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xd8, 0xcb, 0x88, 
+  0x00, 0x17, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd1, 0x83, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xb0, 0x91, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xc4, 0xcd, 0x86, 0x00, 0x13, 0x8a, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0xcb, 0x85, 0x00, 0x03, 0xcb, 0x87, 0x00, 0x6b, 0xcb, 0x87, 0x00, 0xf7, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0x83, 0xca, 0x86, 
+  0x00, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x88, 0x00, 0x1b, 0xcb, 0x87, 0x00, 0x8f, 0xcb, 0x87, 0x00, 0xfb, 0x8a, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0x9f, 0xcb, 0x87, 
+  0x00, 0x27, 0x91, 0x00, 0x00, 0x00, 0x00, 0x04, 0xca, 0x87, 0x00, 0x13, 0xcb, 0x87, 0x00, 0x5f, 0xcb, 0x87, 0x00, 0x94, 0xcb, 0x87, 0x00, 0xc8, 0xcb, 0x87, 0x00, 0xf0, 0x81, 0xcb, 0x87, 0x00, 
+  0xff, 0x04, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0xcb, 0xcb, 0x87, 0x00, 0x9b, 0xcb, 0x87, 0x00, 0x64, 0xcc, 0x87, 0x00, 0x17, 0x89, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +163,7 @@ const lv_img_dsc_t telegram_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( telegram_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = telegram_32px_map,
 };
-
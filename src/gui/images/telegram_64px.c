@@ -10,271 +10,337 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TELEGRAM_64PX uint8_t telegram_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x13, 0x13, 0x23, 0x13, 0x43, 0x13, 0x70, 0x13, 0x9f, 0x13, 0xb8, 0x13, 0xcc, 0x13, 0xe0, 0x13, 0xdb, 0x13, 0xcb, 0x13, 0xbc, 0x13, 0x9f, 0x13, 0x74, 0x13, 0x48, 0x13, 0x24, 0x13, 0x14, 0x13, 0x04, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x13, 0x13, 0x73, 0x13, 0xb3, 0x13, 0xd7, 0x13, 0xfc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xdc, 0x13, 0xbb, 0x13, 0x7c, 0x13, 0x23, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x27, 0x13, 0xb3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd3, 0x13, 0x38, 0x13, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x43, 0x13, 0xab, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc4, 0x13, 0x58, 0x03, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x13, 0x00, 0x13, 0x07, 0x13, 0xb7, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0xd4, 0x13, 0x2c, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x4c, 0x13, 0xfb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x70, 0x13, 0x08, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x13, 0x04, 0x13, 0x9f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc0, 0x13, 0x1f, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x17, 0x07, 0x13, 0xc8, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xec, 0x13, 0x1b, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x20, 0x13, 0xd3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf8, 0x13, 0x48, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x14, 0x00, 0x13, 0x10, 0x13, 0xe0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf8, 0x13, 0x34, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x0c, 0x13, 0xdb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x34, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x0b, 0x13, 0xc4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xec, 0x13, 0x1f, 0x02, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x87, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd3, 0x0b, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x5f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa8, 0x13, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x24, 0x13, 0xef, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0x4b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x9c, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xd7, 0x13, 0x04, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x13, 0x38, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x88, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0xdf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x18, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x50, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x88, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x04, 0x13, 0xaf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x9b, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xdb, 0x13, 0x08, 0x13, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x13, 0x00, 0x13, 0x10, 0x13, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0x9b, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x3b, 0x13, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x13, 0x00, 0x13, 0x6b, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc4, 0x13, 0x00, 0x13, 0x00, 
-  0x13, 0x00, 0x13, 0x00, 0x13, 0xdb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x77, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x08, 0x13, 0x00, 
-  0x13, 0x00, 0x13, 0x13, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x58, 0x13, 0x00, 
-  0x13, 0x00, 0x13, 0x60, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa4, 0x13, 0x00, 
-  0x13, 0x00, 0x13, 0x98, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc3, 0x13, 0x04, 
-  0x17, 0x00, 0x13, 0xbb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xdb, 0x13, 0x13, 
-  0x13, 0x0c, 0x13, 0xd0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xef, 0x13, 0x1c, 
-  0x13, 0x14, 0x13, 0xdc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfb, 0x13, 0x24, 
-  0x13, 0x18, 0x13, 0xe7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x2b, 
-  0x13, 0x1f, 0x13, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x3c, 
-  0x13, 0x1f, 0x13, 0xf3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x40, 
-  0x13, 0x1f, 0x13, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x40, 
-  0x13, 0x1f, 0x13, 0xef, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x43, 
-  0x13, 0x1b, 0x13, 0xeb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x30, 
-  0x13, 0x14, 0x13, 0xdc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x37, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x27, 
-  0x13, 0x0c, 0x13, 0xcf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0x9b, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf3, 0x13, 0x20, 
-  0x13, 0x04, 0x13, 0xc0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xe3, 0x13, 0x17, 
-  0x13, 0x00, 0x13, 0x9f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xc8, 0x13, 0x08, 
-  0x13, 0x00, 0x13, 0x63, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x77, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xac, 0x13, 0x00, 
-  0x13, 0x00, 0x13, 0x23, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x6f, 0x13, 0x00, 
-  0x17, 0x00, 0x13, 0x00, 0x13, 0xec, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x18, 0x13, 0x00, 
-  0x16, 0x00, 0x13, 0x00, 0x13, 0x74, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xdb, 0x13, 0x00, 0x03, 0x00, 
-  0x00, 0x00, 0x13, 0x00, 0x13, 0x14, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x58, 0x13, 0x00, 0x12, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x04, 0x13, 0xbf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xe8, 0x13, 0x08, 0x13, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x5f, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x97, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x17, 0x00, 0x13, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x33, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x54, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x9f, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0xb0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x57, 0xff, 0x9b, 0xff, 0x97, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xec, 0x13, 0x08, 0x13, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x30, 0x13, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x5c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x80, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xbb, 0x03, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0xa4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf3, 0x13, 0x04, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x13, 0x10, 0x13, 0xdb, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf3, 0x13, 0x2f, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x13, 0x00, 0x13, 0x20, 0x13, 0xf7, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x4f, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x1f, 0x13, 0xef, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x5c, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x3b, 0x13, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x63, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x14, 0x13, 0xe4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0x47, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x18, 0x13, 0xc3, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xdc, 0x13, 0x3b, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0x13, 0x08, 0x13, 0x70, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xa7, 0x13, 0x14, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x3b, 0x13, 0xe0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf0, 0x13, 0x63, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x17, 0x04, 0x13, 0x63, 0x13, 0xdf, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xf0, 0x13, 0x7c, 0x13, 0x18, 0x13, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x03, 0x13, 0x57, 0x13, 0xf0, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0x83, 0x17, 0x07, 0x07, 0x00, 0x13, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x48, 0x13, 0x9c, 0x13, 0xd0, 0x13, 0xf4, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0xd4, 0x13, 0xab, 0x13, 0x5c, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x0f, 0x13, 0x1c, 0x13, 0x3f, 0x13, 0x7f, 0x13, 0xa8, 0x13, 0xd0, 0x13, 0xf3, 0x13, 0xfc, 0x13, 0xff, 0x13, 0xff, 0x13, 0xfc, 0x13, 0xeb, 0x13, 0xd8, 0x13, 0xaf, 0x13, 0x7f, 0x13, 0x4f, 0x13, 0x20, 0x13, 0x10, 0x17, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x10, 0x13, 0x13, 0x13, 0x23, 0x13, 0x43, 0x13, 0x70, 0x13, 0x9f, 0x13, 0xb8, 0x13, 0xcc, 0x13, 0xe0, 0x13, 0xdb, 0x13, 0xcb, 0x13, 0xbc, 0x13, 0x9f, 
+  0x13, 0x74, 0x13, 0x48, 0x13, 0x24, 0x13, 0x14, 0x13, 0x04, 0xab, 0x00, 0x00, 0x04, 0x13, 0x13, 0x13, 0x73, 0x13, 0xb3, 0x13, 0xd7, 0x13, 0xfc, 0x8c, 0x13, 0xff, 0x03, 0x13, 0xdc, 0x13, 0xbb, 
+  0x13, 0x7c, 0x13, 0x23, 0xa7, 0x00, 0x00, 0x01, 0x13, 0x27, 0x13, 0xb3, 0x95, 0x13, 0xff, 0x01, 0x13, 0xd3, 0x13, 0x38, 0xa3, 0x00, 0x00, 0x01, 0x13, 0x43, 0x13, 0xab, 0x99, 0x13, 0xff, 0x01, 
+  0x13, 0xc4, 0x13, 0x58, 0x9f, 0x00, 0x00, 0x02, 0x13, 0x07, 0x13, 0xb7, 0x13, 0xfb, 0x9b, 0x13, 0xff, 0x02, 0x13, 0xfc, 0x13, 0xd4, 0x13, 0x2c, 0x9c, 0x00, 0x00, 0x01, 0x13, 0x4c, 0x13, 0xfb, 
+  0xa0, 0x13, 0xff, 0x01, 0x13, 0x70, 0x13, 0x08, 0x98, 0x00, 0x00, 0x01, 0x13, 0x04, 0x13, 0x9f, 0xa3, 0x13, 0xff, 0x01, 0x13, 0xc0, 0x13, 0x1f, 0x96, 0x00, 0x00, 0x01, 0x17, 0x07, 0x13, 0xc8, 
+  0xa5, 0x13, 0xff, 0x01, 0x13, 0xec, 0x13, 0x1b, 0x94, 0x00, 0x00, 0x01, 0x13, 0x20, 0x13, 0xd3, 0xa7, 0x13, 0xff, 0x01, 0x13, 0xf8, 0x13, 0x48, 0x92, 0x00, 0x00, 0x01, 0x13, 0x10, 0x13, 0xe0, 
+  0xa9, 0x13, 0xff, 0x01, 0x13, 0xf8, 0x13, 0x34, 0x90, 0x00, 0x00, 0x01, 0x13, 0x0c, 0x13, 0xdb, 0xac, 0x13, 0xff, 0x00, 0x13, 0x34, 0x8e, 0x00, 0x00, 0x01, 0x13, 0x0b, 0x13, 0xc4, 0xad, 0x13, 
+  0xff, 0x01, 0x13, 0xec, 0x13, 0x1f, 0x8d, 0x00, 0x00, 0x00, 0x13, 0x87, 0xaf, 0x13, 0xff, 0x00, 0x13, 0xd3, 0x8c, 0x00, 0x00, 0x00, 0x13, 0x5f, 0xb1, 0x13, 0xff, 0x00, 0x13, 0xa8, 0x8a, 0x00, 
+  0x00, 0x01, 0x13, 0x24, 0x13, 0xef, 0xb1, 0x13, 0xff, 0x01, 0x13, 0xfb, 0x13, 0x4b, 0x89, 0x00, 0x00, 0x00, 0x13, 0x9c, 0xb3, 0x13, 0xff, 0x01, 0x13, 0xd7, 0x13, 0x04, 0x87, 0x00, 0x00, 0x00, 
+  0x13, 0x38, 0xb5, 0x13, 0xff, 0x00, 0x13, 0x88, 0x87, 0x00, 0x00, 0x00, 0x13, 0xdf, 0xb6, 0x13, 0xff, 0x00, 0x13, 0x18, 0x85, 0x00, 0x00, 0x00, 0x13, 0x50, 0xb7, 0x13, 0xff, 0x00, 0x13, 0x88, 
+  0x84, 0x00, 0x00, 0x01, 0x13, 0x04, 0x13, 0xaf, 0xa8, 0x13, 0xff, 0x01, 0x9b, 0xff, 0xbb, 0xff, 0x8c, 0x13, 0xff, 0x01, 0x13, 0xdb, 0x13, 0x08, 0x83, 0x00, 0x00, 0x01, 0x13, 0x10, 0x13, 0xf4, 
+  0xa4, 0x13, 0xff, 0x02, 0x37, 0xff, 0x9b, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x8c, 0x13, 0xff, 0x00, 0x13, 0x3b, 0x83, 0x00, 0x00, 0x00, 0x13, 0x6b, 0xa3, 0x13, 0xff, 0x01, 
+  0x17, 0xff, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x8c, 0x13, 0xff, 0x00, 0x13, 0xc4, 0x83, 0x00, 0x00, 0x00, 0x13, 0xdb, 0xa0, 0x13, 0xff, 0x02, 0x33, 0xff, 0x77, 0xff, 0xdf, 0xff, 
+  0x87, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x8d, 0x13, 0xff, 0x00, 0x13, 0x08, 0x81, 0x00, 0x00, 0x00, 0x13, 0x13, 0x9f, 0x13, 0xff, 0x01, 0x57, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0x00, 0x77, 0xff, 
+  0x8d, 0x13, 0xff, 0x00, 0x13, 0x58, 0x81, 0x00, 0x00, 0x00, 0x13, 0x60, 0x9d, 0x13, 0xff, 0x00, 0x7b, 0xff, 0x8d, 0xff, 0xff, 0x00, 0x57, 0xff, 0x8d, 0x13, 0xff, 0x00, 0x13, 0xa4, 0x81, 0x00, 
+  0x00, 0x00, 0x13, 0x98, 0x9a, 0x13, 0xff, 0x01, 0x77, 0xff, 0xbb, 0xff, 0x88, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x8e, 0x13, 0xff, 0x03, 0x13, 0xc3, 0x13, 0x04, 0x00, 0x00, 0x13, 
+  0xbb, 0x98, 0x13, 0xff, 0x00, 0x9b, 0xff, 0x89, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x8e, 0x13, 0xff, 0x03, 0x13, 0xdb, 0x13, 0x13, 0x13, 0x0c, 0x13, 0xd0, 0x94, 
+  0x13, 0xff, 0x02, 0x33, 0xff, 0x77, 0xff, 0xbb, 0xff, 0x89, 0xff, 0xff, 0x82, 0xdf, 0xff, 0x86, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x8e, 0x13, 0xff, 0x03, 0x13, 0xef, 0x13, 0x1c, 0x13, 0x14, 0x13, 
+  0xdc, 0x92, 0x13, 0xff, 0x01, 0x17, 0xff, 0xbb, 0xff, 0x8b, 0xff, 0xff, 0x82, 0xdf, 0xff, 0x87, 0xff, 0xff, 0x00, 0x37, 0xff, 0x8e, 0x13, 0xff, 0x03, 0x13, 0xfb, 0x13, 0x24, 0x13, 0x18, 0x13, 
+  0xe7, 0x90, 0x13, 0xff, 0x01, 0x57, 0xff, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0x82, 0xdf, 0xff, 0x00, 0xdb, 0xff, 0x88, 0xff, 0xff, 0x90, 0x13, 0xff, 0x02, 0x13, 0x2b, 0x13, 0x1f, 0x13, 0xf0, 0x8d, 
+  0x13, 0xff, 0x02, 0x57, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x82, 0xdf, 0xff, 0x88, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x90, 0x13, 0xff, 0x02, 0x13, 0x3c, 0x13, 0x1f, 
+  0x13, 0xf3, 0x8b, 0x13, 0xff, 0x00, 0x37, 0xff, 0x8e, 0xff, 0xff, 0x84, 0xdf, 0xff, 0x89, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x90, 0x13, 0xff, 0x02, 0x13, 0x40, 0x13, 0x1f, 0x13, 0xf0, 0x8a, 0x13, 
+  0xff, 0x00, 0x17, 0xff, 0x8e, 0xff, 0xff, 0x84, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0x00, 0x77, 0xff, 0x90, 0x13, 0xff, 0x02, 0x13, 0x40, 0x13, 0x1f, 0x13, 0xef, 0x8a, 0x13, 0xff, 0x01, 0x37, 0xff, 
+  0xdf, 0xff, 0x8b, 0xff, 0xff, 0x85, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0x00, 0x53, 0xff, 0x90, 0x13, 0xff, 0x02, 0x13, 0x43, 0x13, 0x1b, 0x13, 0xeb, 0x8d, 0x13, 0xff, 0x00, 0x9b, 0xff, 0x87, 0xff, 
+  0xff, 0x85, 0xdf, 0xff, 0x8d, 0xff, 0xff, 0x00, 0x33, 0xff, 0x90, 0x13, 0xff, 0x02, 0x13, 0x30, 0x13, 0x14, 0x13, 0xdc, 0x8f, 0x13, 0xff, 0x02, 0x37, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0x82, 0xff, 
+  0xff, 0x85, 0xdf, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x91, 0x13, 0xff, 0x02, 0x13, 0x27, 0x13, 0x0c, 0x13, 0xcf, 0x92, 0x13, 0xff, 0x01, 0x57, 0xff, 0x9b, 0xff, 0x85, 0xdf, 0xff, 0x8e, 
+  0xff, 0xff, 0x00, 0xdb, 0xff, 0x90, 0x13, 0xff, 0x03, 0x13, 0xf3, 0x13, 0x20, 0x13, 0x04, 0x13, 0xc0, 0x94, 0x13, 0xff, 0x84, 0xdf, 0xff, 0x8f, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x90, 0x13, 0xff, 
+  0x03, 0x13, 0xe3, 0x13, 0x17, 0x00, 0x00, 0x13, 0x9f, 0x94, 0x13, 0xff, 0x00, 0xbb, 0xff, 0x82, 0xdf, 0xff, 0x90, 0xff, 0xff, 0x00, 0x37, 0xff, 0x90, 0x13, 0xff, 0x03, 0x13, 0xc8, 0x13, 0x08, 
+  0x00, 0x00, 0x13, 0x63, 0x94, 0x13, 0xff, 0x00, 0x77, 0xff, 0x82, 0xdf, 0xff, 0x00, 0xbb, 0xff, 0x8f, 0xff, 0xff, 0x91, 0x13, 0xff, 0x00, 0x13, 0xac, 0x81, 0x00, 0x00, 0x00, 0x13, 0x23, 0x94, 
+  0x13, 0xff, 0x00, 0x57, 0xff, 0x81, 0xdf, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xbb, 0xff, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x91, 0x13, 0xff, 0x00, 0x13, 0x6f, 0x82, 0x00, 0x00, 0x00, 
+  0x13, 0xec, 0x94, 0x13, 0xff, 0x01, 0xdb, 0xff, 0xdf, 0xff, 0x82, 0xdb, 0xff, 0x81, 0xbb, 0xff, 0x8b, 0xff, 0xff, 0x00, 0x9b, 0xff, 0x91, 0x13, 0xff, 0x00, 0x13, 0x18, 0x82, 0x00, 0x00, 0x00, 
+  0x13, 0x74, 0x94, 0x13, 0xff, 0x01, 0xbb, 0xff, 0xdf, 0xff, 0x84, 0xdb, 0xff, 0x00, 0x57, 0xff, 0x8a, 0xff, 0xff, 0x00, 0x37, 0xff, 0x90, 0x13, 0xff, 0x00, 0x13, 0xdb, 0x83, 0x00, 0x00, 0x00, 
+  0x13, 0x14, 0x94, 0x13, 0xff, 0x01, 0x57, 0xff, 0xdf, 0xff, 0x83, 0xdb, 0xff, 0x00, 0x77, 0xff, 0x81, 0x13, 0xff, 0x00, 0xbb, 0xff, 0x88, 0xff, 0xff, 0x91, 0x13, 0xff, 0x00, 0x13, 0x58, 0x83, 
+  0x00, 0x00, 0x01, 0x13, 0x04, 0x13, 0xbf, 0x94, 0x13, 0xff, 0x00, 0xdf, 0xff, 0x82, 0xdb, 0xff, 0x00, 0x57, 0xff, 0x83, 0x13, 0xff, 0x00, 0x57, 0xff, 0x86, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x90, 
+  0x13, 0xff, 0x01, 0x13, 0xe8, 0x13, 0x08, 0x84, 0x00, 0x00, 0x00, 0x13, 0x5f, 0x94, 0x13, 0xff, 0x00, 0xbb, 0xff, 0x81, 0xdb, 0xff, 0x00, 0x77, 0xff, 0x85, 0x13, 0xff, 0x01, 0x57, 0xff, 0xdf, 
+  0xff, 0x84, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x90, 0x13, 0xff, 0x00, 0x13, 0x97, 0x86, 0x00, 0x00, 0x00, 0x13, 0xf0, 0x93, 0x13, 0xff, 0x02, 0x57, 0xff, 0x9b, 0xff, 0x57, 0xff, 0x87, 0x13, 0xff, 
+  0x01, 0x33, 0xff, 0xbb, 0xff, 0x83, 0xff, 0xff, 0x00, 0xbb, 0xff, 0x90, 0x13, 0xff, 0x00, 0x13, 0x2f, 0x86, 0x00, 0x00, 0x00, 0x13, 0x54, 0xa0, 0x13, 0xff, 0x00, 0x9b, 0xff, 0x82, 0xff, 0xff, 
+  0x00, 0x57, 0xff, 0x8f, 0x13, 0xff, 0x00, 0x13, 0x9f, 0x88, 0x00, 0x00, 0x00, 0x13, 0xb0, 0xa0, 0x13, 0xff, 0x02, 0x57, 0xff, 0x9b, 0xff, 0x97, 0xff, 0x8f, 0x13, 0xff, 0x01, 0x13, 0xec, 0x13, 
+  0x08, 0x88, 0x00, 0x00, 0x01, 0x13, 0x30, 0x13, 0xf4, 0xb2, 0x13, 0xff, 0x00, 0x13, 0x5c, 0x8a, 0x00, 0x00, 0x00, 0x13, 0x80, 0xb1, 0x13, 0xff, 0x00, 0x13, 0xbb, 0x8c, 0x00, 0x00, 0x00, 0x13, 
+  0xa4, 0xaf, 0x13, 0xff, 0x01, 0x13, 0xf3, 0x13, 0x04, 0x8c, 0x00, 0x00, 0x01, 0x13, 0x10, 0x13, 0xdb, 0xad, 0x13, 0xff, 0x01, 0x13, 0xf3, 0x13, 0x2f, 0x8e, 0x00, 0x00, 0x01, 0x13, 0x20, 0x13, 
+  0xf7, 0xac, 0x13, 0xff, 0x00, 0x13, 0x4f, 0x90, 0x00, 0x00, 0x01, 0x13, 0x1f, 0x13, 0xef, 0xaa, 0x13, 0xff, 0x00, 0x13, 0x5c, 0x92, 0x00, 0x00, 0x01, 0x13, 0x3b, 0x13, 0xf4, 0xa8, 0x13, 0xff, 
+  0x00, 0x13, 0x63, 0x94, 0x00, 0x00, 0x01, 0x13, 0x14, 0x13, 0xe4, 0xa6, 0x13, 0xff, 0x00, 0x13, 0x47, 0x96, 0x00, 0x00, 0x01, 0x13, 0x18, 0x13, 0xc3, 0xa3, 0x13, 0xff, 0x01, 0x13, 0xdc, 0x13, 
+  0x3b, 0x98, 0x00, 0x00, 0x01, 0x13, 0x08, 0x13, 0x70, 0xa1, 0x13, 0xff, 0x01, 0x13, 0xa7, 0x13, 0x14, 0x9b, 0x00, 0x00, 0x01, 0x13, 0x3b, 0x13, 0xe0, 0x9d, 0x13, 0xff, 0x01, 0x13, 0xf0, 0x13, 
+  0x63, 0x9e, 0x00, 0x00, 0x02, 0x17, 0x04, 0x13, 0x63, 0x13, 0xdf, 0x99, 0x13, 0xff, 0x02, 0x13, 0xf0, 0x13, 0x7c, 0x13, 0x18, 0xa1, 0x00, 0x00, 0x02, 0x13, 0x03, 0x13, 0x57, 0x13, 0xf0, 0x95, 
+  0x13, 0xff, 0x02, 0x13, 0xfc, 0x13, 0x83, 0x17, 0x07, 0xa6, 0x00, 0x00, 0x03, 0x13, 0x48, 0x13, 0x9c, 0x13, 0xd0, 0x13, 0xf4, 0x8d, 0x13, 0xff, 0x03, 0x13, 0xfc, 0x13, 0xd4, 0x13, 0xab, 0x13, 
+  0x5c, 0xab, 0x00, 0x00, 0x07, 0x13, 0x0f, 0x13, 0x1c, 0x13, 0x3f, 0x13, 0x7f, 0x13, 0xa8, 0x13, 0xd0, 0x13, 0xf3, 0x13, 0xfc, 0x81, 0x13, 0xff, 0x07, 0x13, 0xfc, 0x13, 0xeb, 0x13, 0xd8, 0x13, 
+  0xaf, 0x13, 0x7f, 0x13, 0x4f, 0x13, 0x20, 0x13, 0x10, 0x96, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x04, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 0x39, 0x04, 0x13, 0x59, 0x04, 0x23, 0x59, 0x04, 0x43, 0x59, 0x04, 0x70, 0x59, 0x04, 0x9f, 0x59, 0x04, 0xb8, 0x59, 0x04, 0xcc, 0x59, 0x04, 0xe0, 0x59, 0x04, 0xdb, 0x59, 0x04, 0xcb, 0x59, 0x04, 0xbc, 0x59, 0x04, 0x9f, 0x59, 0x04, 0x74, 0x59, 0x04, 0x48, 0x59, 0x04, 0x24, 0x59, 0x04, 0x14, 0x59, 0x04, 0x04, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x04, 0x00, 0x5a, 0x04, 0x00, 0x59, 0x04, 0x00, 0x3a, 0x04, 0x13, 0x59, 0x04, 0x73, 0x59, 0x04, 0xb3, 0x59, 0x04, 0xd7, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xdc, 0x59, 0x04, 0xbb, 0x59, 0x04, 0x7c, 0x39, 0x04, 0x23, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 0x99, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x00, 0x3b, 0x04, 0x00, 0x5a, 0x04, 0x27, 0x59, 0x04, 0xb3, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xd3, 0x39, 0x04, 0x38, 0x39, 0x04, 0x00, 0x99, 0x04, 0x00, 0x59, 0x04, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x00, 0x79, 0x04, 0x00, 0xb9, 0x03, 0x00, 0x59, 0x04, 0x43, 0x59, 0x04, 0xab, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc4, 0x59, 0x04, 0x58, 0x14, 0x00, 0x00, 0x59, 0x04, 0x00, 0x98, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x04, 0x00, 0x59, 0x04, 0x00, 0x18, 0x04, 0x07, 0x59, 0x04, 0xb7, 0x59, 0x04, 0xfb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xd4, 0x59, 0x04, 0x2c, 0xf9, 0x03, 0x00, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x01, 0x00, 0x3a, 0x04, 0x00, 0x17, 0x04, 0x00, 0x59, 0x04, 0x4c, 0x59, 0x04, 0xfb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x70, 0x59, 0x04, 0x08, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0xbb, 0x05, 0x00, 0x1b, 0x04, 0x04, 0x59, 0x04, 0x9f, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc0, 0x39, 0x04, 0x1f, 0x5a, 0x04, 0x00, 0x5a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x1b, 0x05, 0x00, 0x1a, 0x05, 0x07, 0x59, 0x04, 0xc8, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xec, 0x5a, 0x04, 0x1b, 0x5a, 0x04, 0x00, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x20, 0x59, 0x04, 0xd3, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf8, 0x59, 0x04, 0x48, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00, 0x05, 0x00, 0x39, 0x04, 0x10, 0x59, 0x04, 0xe0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf8, 0x59, 0x04, 0x34, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0x00, 0x78, 0x04, 0x0c, 0x59, 0x04, 0xdb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0x34, 0x7a, 0x04, 0x00, 0x7a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x3a, 0x04, 0x0b, 0x59, 0x04, 0xc4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xec, 0x59, 0x04, 0x1f, 0x12, 0x00, 0x00, 0xdf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x87, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xd3, 0x58, 0x02, 0x00, 0xfa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x00, 0x59, 0x04, 0x5f, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xa8, 0xf9, 0x03, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x24, 0x59, 0x04, 0xef, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xfb, 0x59, 0x04, 0x4b, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x58, 0x04, 0x00, 0x59, 0x04, 0x9c, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xd7, 0x5a, 0x04, 0x04, 0x5a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x02, 0x00, 0x39, 0x04, 0x00, 0x39, 0x04, 0x38, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x88, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x00, 0x5a, 0x04, 0x00, 0x59, 0x04, 0xdf, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0x18, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x00, 0x59, 0x04, 0x50, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0x19, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x88, 0x7a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x04, 0x59, 0x04, 0xaf, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x9a, 0x04, 0xff, 0x5d, 0x8e, 0xff, 0x7d, 0x9e, 0xff, 0x7a, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xdb, 0x59, 0x04, 0x08, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x39, 0x04, 0x00, 0x39, 0x04, 0x10, 0x59, 0x04, 0xf4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0x9a, 0x1c, 0xff, 0x9b, 0x85, 0xff, 0xde, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x85, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0x3b, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x6b, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xf9, 0x03, 0xff, 0xda, 0x04, 0xff, 0xde, 0xc6, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x96, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc4, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 
-  0x5b, 0x04, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0xdb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x9a, 0x34, 0xff, 0x7b, 0x65, 0xff, 0x3f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x7d, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x18, 0x04, 0x08, 0x39, 0x04, 0x00, 
-  0x59, 0x04, 0x00, 0x5a, 0x04, 0x13, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xf9, 0x03, 0xff, 0x5b, 0x55, 0xff, 0xbd, 0xbe, 0xff, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x64, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x58, 0x59, 0x04, 0x00, 
-  0x59, 0x04, 0x00, 0x59, 0x04, 0x60, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x39, 0x04, 0xff, 0xbc, 0x65, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xff, 0xba, 0x34, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xa4, 0x59, 0x04, 0x00, 
-  0x59, 0x04, 0x00, 0x59, 0x04, 0x98, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x39, 0x04, 0xff, 0x5a, 0x04, 0xff, 0x5b, 0x75, 0xff, 0x7d, 0xae, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0xbd, 0xbe, 0xff, 0x5e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xdf, 0xff, 0x5a, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc3, 0x39, 0x04, 0x04, 
-  0x9b, 0x04, 0x00, 0x59, 0x04, 0xbb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x19, 0x04, 0xff, 0x59, 0x04, 0xff, 0x3d, 0x8e, 0xff, 0x9f, 0xef, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0xff, 0xdd, 0xce, 0xff, 0xbd, 0xc6, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xce, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xdb, 0x59, 0x04, 0x13, 
-  0x59, 0x04, 0x0c, 0x59, 0x04, 0xd0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x39, 0x04, 0xff, 0x7a, 0x1c, 0xff, 0x1a, 0x5d, 0xff, 0x9d, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xc6, 0xff, 0xbd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x9f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x8e, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xef, 0x59, 0x04, 0x1c, 
-  0x59, 0x04, 0x14, 0x59, 0x04, 0xdc, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xf9, 0x03, 0xff, 0xba, 0x04, 0xff, 0x7d, 0xae, 0xff, 0x5e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xd7, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xc6, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x25, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xfb, 0x39, 0x04, 0x24, 
-  0x59, 0x04, 0x18, 0x59, 0x04, 0xe7, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x1b, 0x35, 0xff, 0x1e, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdd, 0xc6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0x9d, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x79, 0x04, 0x2b, 
-  0x59, 0x04, 0x1f, 0x59, 0x04, 0xf0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0xfa, 0x44, 0xff, 0x1c, 0x9e, 0xff, 0x5f, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0x9d, 0xbe, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xcf, 0xff, 0xf9, 0x03, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0x3c, 
-  0x59, 0x04, 0x1f, 0x59, 0x04, 0xf3, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xda, 0x24, 0xff, 0x3e, 0xdf, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xdd, 0xc6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0xbd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x8e, 0xff, 0x19, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x40, 
-  0x39, 0x04, 0x1f, 0x59, 0x04, 0xf0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x9a, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5e, 0xdf, 0xff, 0xbd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xfd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x55, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x40, 
-  0x59, 0x04, 0x1f, 0x59, 0x04, 0xef, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x9a, 0x14, 0xff, 0x1e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0xff, 0xfd, 0xd6, 0xff, 0xbd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xbd, 0xce, 0xff, 0x1e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x9a, 0x3c, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x43, 
-  0x39, 0x04, 0x1b, 0x59, 0x04, 0xeb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x9a, 0x04, 0xff, 0x3d, 0x86, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xce, 0xff, 0xbd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x5e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xff, 0x7a, 0x24, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x5a, 0x04, 0x30, 
-  0x59, 0x04, 0x14, 0x59, 0x04, 0xdc, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0xf9, 0x03, 0xff, 0xfb, 0x2c, 0xff, 0x5d, 0xae, 0xff, 0x1e, 0xd7, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 0xff, 0xbd, 0xc6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0xbd, 0xc6, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xce, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0x27, 
-  0x39, 0x04, 0x0c, 0x59, 0x04, 0xcf, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0xba, 0x44, 0xff, 0xfc, 0x85, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xbd, 0xc6, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xbe, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf3, 0x59, 0x04, 0x20, 
-  0x39, 0x04, 0x04, 0x59, 0x04, 0xc0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xfd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x7d, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xe3, 0x59, 0x04, 0x17, 
-  0x59, 0x04, 0x00, 0x59, 0x04, 0x9f, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x3c, 0x9e, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xbd, 0xce, 0xff, 0x5e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1c, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xc8, 0x39, 0x04, 0x08, 
-  0x59, 0x04, 0x00, 0x59, 0x04, 0x63, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x7b, 0x75, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0x9c, 0xbe, 0xff, 0x3b, 0xae, 0xff, 0x5e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xac, 0x59, 0x04, 0x00, 
-  0x59, 0x04, 0x00, 0x39, 0x04, 0x23, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0xda, 0x54, 0xff, 0xbd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x7c, 0xbe, 0xff, 0x5b, 0xb6, 0xff, 0x1b, 0xa6, 0xff, 0x1d, 0xd7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xcf, 0xff, 0xf9, 0x03, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x6f, 0x39, 0x04, 0x00, 
-  0x7b, 0x05, 0x00, 0xf9, 0x03, 0x00, 0x59, 0x04, 0xec, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x7a, 0x04, 0xff, 0x9d, 0xbe, 0xff, 0xdd, 0xce, 0xff, 0x7c, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x7c, 0xb6, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x7e, 0xff, 0x19, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x18, 0x59, 0x04, 0x00, 
-  0xf4, 0x04, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x74, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x3c, 0xa6, 0xff, 0xdd, 0xd6, 0xff, 0x7c, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x1a, 0x4d, 0xff, 0x5f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x24, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xdb, 0x19, 0x04, 0x00, 0x16, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x14, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x3b, 0x4d, 0xff, 0xfd, 0xd6, 0xff, 0x7c, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x7b, 0xbe, 0xff, 0x3a, 0x5d, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x5d, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x58, 0x59, 0x04, 0x00, 0xae, 0x03, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x04, 0x59, 0x04, 0xbf, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xfd, 0xd6, 0xff, 0x7c, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x5b, 0xb6, 0xff, 0x1a, 0x4d, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x3b, 0x45, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xcf, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xe8, 0x59, 0x04, 0x08, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x04, 0x00, 0x59, 0x04, 0x5f, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x19, 0x04, 0xff, 0x1c, 0x96, 0xff, 0x9c, 0xc6, 0xff, 0x5b, 0xb6, 0xff, 0x3a, 0x65, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xfa, 0x44, 0xff, 0x1e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xb6, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x97, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x00, 0xfa, 0x04, 0x00, 0x59, 0x04, 0xf0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xda, 0x44, 0xff, 0xfb, 0x8d, 0xff, 0xda, 0x3c, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x59, 0x14, 0xff, 0x5d, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xa6, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x2f, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x54, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x19, 0x04, 0xff, 0xdc, 0x7d, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x1a, 0x4d, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x9f, 0x59, 0x04, 0x00, 0x57, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x03, 0x00, 0x1a, 0x04, 0x00, 0x59, 0x04, 0xb0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0xba, 0x3c, 0xff, 0xdc, 0x8d, 0xff, 0x5b, 0x75, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xec, 0x39, 0x04, 0x08, 0x3a, 0x04, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x30, 0x59, 0x04, 0xf4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x39, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x5c, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x00, 0x39, 0x04, 0x80, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xbb, 0x1f, 0x00, 0x00, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x00, 0x5a, 0x04, 0x00, 0x39, 0x04, 0xa4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf3, 0xba, 0x03, 0x04, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x03, 0x00, 0x7a, 0x04, 0x10, 0x59, 0x04, 0xdb, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf3, 0x39, 0x04, 0x2f, 0x19, 0x04, 0x00, 0x19, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x05, 0x00, 0x79, 0x04, 0x00, 0x59, 0x04, 0x20, 0x59, 0x04, 0xf7, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x4f, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x04, 0x00, 0x7a, 0x04, 0x00, 0x5a, 0x04, 0x1f, 0x59, 0x04, 0xef, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x5c, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x04, 0x00, 0x5a, 0x04, 0x00, 0x59, 0x04, 0x3b, 0x59, 0x04, 0xf4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0x63, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x00, 0x1a, 0x04, 0x00, 0x3a, 0x04, 0x14, 0x59, 0x04, 0xe4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x3a, 0x04, 0x47, 0x3a, 0x04, 0x00, 0x5a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x04, 0x00, 0x1a, 0x04, 0x00, 0x5a, 0x04, 0x18, 0x59, 0x04, 0xc3, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xdc, 0x59, 0x04, 0x3b, 0x3a, 0x04, 0x00, 0x3a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x59, 0x04, 0x00, 0x39, 0x04, 0x08, 0x39, 0x04, 0x70, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xa7, 0x39, 0x04, 0x14, 0x39, 0x04, 0x00, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x00, 0xf9, 0x03, 0x00, 0x5a, 0x04, 0x3b, 0x59, 0x04, 0xe0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf0, 0x39, 0x04, 0x63, 0x79, 0x04, 0x00, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x59, 0x04, 0x00, 0xb8, 0x04, 0x04, 0x59, 0x04, 0x63, 0x59, 0x04, 0xdf, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xf0, 0x59, 0x04, 0x7c, 0x59, 0x04, 0x18, 0x39, 0x04, 0x00, 0x6e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x59, 0x04, 0x00, 0x39, 0x04, 0x00, 0x59, 0x04, 0x03, 0x59, 0x04, 0x57, 0x59, 0x04, 0xf0, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xfc, 0x59, 0x04, 0x83, 0x1a, 0x05, 0x07, 0x77, 0x01, 0x00, 0xd9, 0x03, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x3a, 0x04, 0x00, 0x59, 0x04, 0x48, 0x59, 0x04, 0x9c, 0x59, 0x04, 0xd0, 0x59, 0x04, 0xf4, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xd4, 0x59, 0x04, 0xab, 0x59, 0x04, 0x5c, 0x9a, 0x03, 0x00, 0x59, 0x04, 0x00, 0x5b, 0x05, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x04, 0x00, 0x58, 0x04, 0x00, 0x59, 0x04, 0x00, 0x7a, 0x04, 0x00, 0x59, 0x04, 0x0f, 0x59, 0x04, 0x1c, 0x59, 0x04, 0x3f, 0x59, 0x04, 0x7f, 0x59, 0x04, 0xa8, 0x59, 0x04, 0xd0, 0x59, 0x04, 0xf3, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xff, 0x59, 0x04, 0xff, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xeb, 0x59, 0x04, 0xd8, 0x59, 0x04, 0xaf, 0x59, 0x04, 0x7f, 0x59, 0x04, 0x4f, 0x3a, 0x04, 0x20, 0x59, 0x04, 0x10, 0xf7, 0x04, 0x00, 0x19, 0x04, 0x00, 0x59, 0x04, 0x00, 0x59, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x00, 0x10, 0x39, 0x04, 0x13, 0x59, 0x04, 0x23, 0x59, 0x04, 0x43, 0x59, 0x04, 0x70, 0x59, 0x04, 0x9f, 0x59, 0x04, 0xb8, 0x59, 0x04, 0xcc, 0x59, 0x04, 
+  0xe0, 0x59, 0x04, 0xdb, 0x59, 0x04, 0xcb, 0x59, 0x04, 0xbc, 0x59, 0x04, 0x9f, 0x59, 0x04, 0x74, 0x59, 0x04, 0x48, 0x59, 0x04, 0x24, 0x59, 0x04, 0x14, 0x59, 0x04, 0x04, 0xab, 0x00, 0x00, 0x00, 
+  0x04, 0x3a, 0x04, 0x13, 0x59, 0x04, 0x73, 0x59, 0x04, 0xb3, 0x59, 0x04, 0xd7, 0x59, 0x04, 0xfc, 0x8c, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 0xdc, 0x59, 0x04, 0xbb, 0x59, 0x04, 0x7c, 0x39, 0x04, 
+  0x23, 0xa7, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x04, 0x27, 0x59, 0x04, 0xb3, 0x95, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xd3, 0x39, 0x04, 0x38, 0xa3, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x43, 0x59, 
+  0x04, 0xab, 0x99, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xc4, 0x59, 0x04, 0x58, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x18, 0x04, 0x07, 0x59, 0x04, 0xb7, 0x59, 0x04, 0xfb, 0x9b, 0x59, 0x04, 0xff, 0x02, 
+  0x59, 0x04, 0xfc, 0x59, 0x04, 0xd4, 0x59, 0x04, 0x2c, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x4c, 0x59, 0x04, 0xfb, 0xa0, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0x70, 0x59, 0x04, 0x08, 0x98, 
+  0x00, 0x00, 0x00, 0x01, 0x1b, 0x04, 0x04, 0x59, 0x04, 0x9f, 0xa3, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xc0, 0x39, 0x04, 0x1f, 0x96, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x05, 0x07, 0x59, 0x04, 0xc8, 
+  0xa5, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xec, 0x5a, 0x04, 0x1b, 0x94, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x20, 0x59, 0x04, 0xd3, 0xa7, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xf8, 0x59, 0x04, 
+  0x48, 0x92, 0x00, 0x00, 0x00, 0x01, 0x39, 0x04, 0x10, 0x59, 0x04, 0xe0, 0xa9, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xf8, 0x59, 0x04, 0x34, 0x90, 0x00, 0x00, 0x00, 0x01, 0x78, 0x04, 0x0c, 0x59, 
+  0x04, 0xdb, 0xac, 0x59, 0x04, 0xff, 0x00, 0x39, 0x04, 0x34, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x04, 0x0b, 0x59, 0x04, 0xc4, 0xad, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xec, 0x59, 0x04, 0x1f, 
+  0x8d, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x87, 0xaf, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xd3, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x5f, 0xb1, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xa8, 
+  0x8a, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x24, 0x59, 0x04, 0xef, 0xb1, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xfb, 0x59, 0x04, 0x4b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x9c, 0xb3, 0x59, 
+  0x04, 0xff, 0x01, 0x59, 0x04, 0xd7, 0x5a, 0x04, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x38, 0xb5, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x88, 0x87, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 
+  0xdf, 0xb6, 0x59, 0x04, 0xff, 0x00, 0x39, 0x04, 0x18, 0x85, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x50, 0xa7, 0x59, 0x04, 0xff, 0x00, 0x39, 0x04, 0xff, 0x81, 0x19, 0x04, 0xff, 0x8c, 0x59, 0x04, 
+  0xff, 0x00, 0x59, 0x04, 0x88, 0x84, 0x00, 0x00, 0x00, 0x01, 0x39, 0x04, 0x04, 0x59, 0x04, 0xaf, 0xa6, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 0x9a, 0x04, 0xff, 0x5d, 0x8e, 0xff, 0x7d, 0x9e, 
+  0xff, 0x7a, 0x04, 0xff, 0x8b, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xdb, 0x59, 0x04, 0x08, 0x83, 0x00, 0x00, 0x00, 0x01, 0x39, 0x04, 0x10, 0x59, 0x04, 0xf4, 0xa2, 0x59, 0x04, 0xff, 0x04, 0x39, 
+  0x04, 0xff, 0x19, 0x04, 0xff, 0x9a, 0x1c, 0xff, 0x9b, 0x85, 0xff, 0xde, 0xb6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xdc, 0x85, 0xff, 0x39, 0x04, 0xff, 0x8b, 0x59, 0x04, 0xff, 0x00, 0x39, 0x04, 
+  0x3b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x6b, 0xa1, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 0xf9, 0x03, 0xff, 0xda, 0x04, 0xff, 0xde, 0xc6, 0xff, 0x9f, 0xef, 0xff, 0x84, 0xff, 0xff, 
+  0xff, 0x01, 0x3d, 0x96, 0xff, 0x39, 0x04, 0xff, 0x8b, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xc4, 0x83, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0xdb, 0x9e, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 
+  0x59, 0x04, 0xff, 0x9a, 0x34, 0xff, 0x7b, 0x65, 0xff, 0x3f, 0xcf, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x9b, 0x7d, 0xff, 0x39, 0x04, 0xff, 0x8c, 0x59, 0x04, 0xff, 0x00, 0x18, 0x04, 0x08, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x13, 0x9d, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 0xf9, 0x03, 0xff, 0x5b, 0x55, 0xff, 0xbd, 0xbe, 0xff, 0x7f, 0xdf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 
+  0xfa, 0x64, 0xff, 0x8d, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x58, 0x81, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x60, 0x9b, 0x59, 0x04, 0xff, 0x81, 0x39, 0x04, 0xff, 0x01, 0xbc, 0x65, 0xff, 0x9f, 
+  0xef, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xff, 0x9f, 0xef, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xe7, 0xff, 0xba, 0x34, 0xff, 0x8d, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xa4, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x98, 0x97, 0x59, 0x04, 0xff, 0x81, 0x39, 0x04, 0xff, 0x03, 0x5a, 0x04, 0xff, 0x5b, 0x75, 0xff, 0x7d, 0xae, 0xff, 0xdf, 0xf7, 0xff, 0x85, 0xff, 0xff, 
+  0xff, 0x03, 0xdf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0xbd, 0xbe, 0xff, 0x5e, 0xdf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x5e, 0xdf, 0xff, 0x5a, 0x04, 0xff, 0x8d, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 
+  0xc3, 0x39, 0x04, 0x04, 0x00, 0x00, 0x00, 0x59, 0x04, 0xbb, 0x96, 0x59, 0x04, 0xff, 0x04, 0x19, 0x04, 0xff, 0x59, 0x04, 0xff, 0x3d, 0x8e, 0xff, 0x9f, 0xef, 0xff, 0xdf, 0xf7, 0xff, 0x86, 0xff, 
+  0xff, 0xff, 0x03, 0x7f, 0xe7, 0xff, 0xdd, 0xce, 0xff, 0xbd, 0xc6, 0xff, 0x9f, 0xef, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xce, 0xff, 0x39, 0x04, 0xff, 0x8d, 0x59, 0x04, 0xff, 0x03, 0x59, 
+  0x04, 0xdb, 0x59, 0x04, 0x13, 0x59, 0x04, 0x0c, 0x59, 0x04, 0xd0, 0x92, 0x59, 0x04, 0xff, 0x81, 0x39, 0x04, 0xff, 0x02, 0x7a, 0x1c, 0xff, 0x1a, 0x5d, 0xff, 0x9d, 0xa6, 0xff, 0x89, 0xff, 0xff, 
+  0xff, 0x03, 0xfd, 0xc6, 0xff, 0xbd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x9f, 0xe7, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0x1c, 0x8e, 0xff, 0x39, 0x04, 0xff, 0x8d, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 
+  0xef, 0x59, 0x04, 0x1c, 0x59, 0x04, 0x14, 0x59, 0x04, 0xdc, 0x90, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 0xf9, 0x03, 0xff, 0xba, 0x04, 0xff, 0x7d, 0xae, 0xff, 0x5e, 0xd7, 0xff, 0x89, 0xff, 
+  0xff, 0xff, 0x04, 0x3e, 0xd7, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xc6, 0xff, 0xbf, 0xf7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0x1b, 0x25, 0xff, 0x39, 0x04, 0xff, 0x8d, 0x59, 0x04, 
+  0xff, 0x03, 0x59, 0x04, 0xfb, 0x39, 0x04, 0x24, 0x59, 0x04, 0x18, 0x59, 0x04, 0xe7, 0x8f, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 0xff, 0x1b, 0x35, 0xff, 0x1e, 0xc7, 0xff, 0x8a, 0xff, 0xff, 0xff, 
+  0x04, 0xdf, 0xff, 0xff, 0xdd, 0xc6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0x9d, 0xb6, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0x19, 0x04, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x02, 0x79, 0x04, 0x2b, 
+  0x59, 0x04, 0x1f, 0x59, 0x04, 0xf0, 0x8b, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0xfa, 0x44, 0xff, 0x1c, 0x9e, 0xff, 0x5f, 0xd7, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x04, 0x7f, 
+  0xef, 0xff, 0x9d, 0xbe, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xc6, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x5f, 0xcf, 0xff, 0xf9, 0x03, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 
+  0x3c, 0x59, 0x04, 0x1f, 0x59, 0x04, 0xf3, 0x8a, 0x59, 0x04, 0xff, 0x03, 0x39, 0x04, 0xff, 0xda, 0x24, 0xff, 0x3e, 0xdf, 0xff, 0xbf, 0xf7, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xbf, 0xf7, 0xff, 
+  0xdd, 0xc6, 0xff, 0x81, 0xdd, 0xce, 0xff, 0x01, 0xdd, 0xd6, 0xff, 0xbd, 0xbe, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x3d, 0x8e, 0xff, 0x19, 0x04, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 
+  0x40, 0x39, 0x04, 0x1f, 0x59, 0x04, 0xf0, 0x89, 0x59, 0x04, 0xff, 0x01, 0x39, 0x04, 0xff, 0x9a, 0x04, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0x5e, 0xdf, 0xff, 0xbd, 0xce, 0xff, 
+  0xdd, 0xd6, 0xff, 0x81, 0xdd, 0xce, 0xff, 0x00, 0xfd, 0xc6, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x3b, 0x55, 0xff, 0x39, 0x04, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0x40, 0x59, 0x04, 
+  0x1f, 0x59, 0x04, 0xef, 0x89, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 0xff, 0x9a, 0x14, 0xff, 0x1e, 0xcf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0x7f, 0xe7, 0xff, 0xfd, 0xd6, 0xff, 0xbd, 0xce, 0xff, 
+  0x81, 0xdd, 0xce, 0xff, 0x01, 0xbd, 0xce, 0xff, 0x1e, 0xd7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xff, 0xf7, 0xff, 0x9a, 0x3c, 0xff, 0x90, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0x43, 0x39, 0x04, 
+  0x1b, 0x59, 0x04, 0xeb, 0x8b, 0x59, 0x04, 0xff, 0x03, 0x39, 0x04, 0xff, 0x9a, 0x04, 0xff, 0x3d, 0x86, 0xff, 0xbf, 0xef, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xce, 0xff, 0xbd, 0xce, 0xff, 
+  0x83, 0xdd, 0xce, 0xff, 0x00, 0x5e, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0x7f, 0xdf, 0xff, 0x7a, 0x24, 0xff, 0x90, 0x59, 0x04, 0xff, 0x02, 0x5a, 0x04, 0x30, 0x59, 0x04, 0x14, 0x59, 0x04, 
+  0xdc, 0x8c, 0x59, 0x04, 0xff, 0x0a, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0xf9, 0x03, 0xff, 0xfb, 0x2c, 0xff, 0x5d, 0xae, 0xff, 0x1e, 0xd7, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe7, 
+  0xff, 0xbd, 0xc6, 0xff, 0xdd, 0xd6, 0xff, 0x81, 0xdd, 0xce, 0xff, 0x02, 0xdd, 0xd6, 0xff, 0xbd, 0xc6, 0xff, 0x5e, 0xe7, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xce, 0xff, 0x91, 0x59, 0x04, 
+  0xff, 0x02, 0x39, 0x04, 0x27, 0x39, 0x04, 0x0c, 0x59, 0x04, 0xcf, 0x8f, 0x59, 0x04, 0xff, 0x81, 0x39, 0x04, 0xff, 0x03, 0x59, 0x04, 0xff, 0xba, 0x44, 0xff, 0xfc, 0x85, 0xff, 0xdd, 0xd6, 0xff, 
+  0x83, 0xdd, 0xce, 0xff, 0x01, 0xbd, 0xc6, 0xff, 0x9f, 0xef, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x9d, 0xbe, 0xff, 0x39, 0x04, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 0xf3, 0x59, 0x04, 
+  0x20, 0x39, 0x04, 0x04, 0x59, 0x04, 0xc0, 0x93, 0x59, 0x04, 0xff, 0x01, 0x39, 0x04, 0xff, 0xfd, 0xd6, 0xff, 0x81, 0xdd, 0xce, 0xff, 0x02, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0x7f, 0xe7, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0x00, 0xbc, 0x7d, 0xff, 0x90, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 0xe3, 0x59, 0x04, 0x17, 0x00, 0x00, 0x00, 0x59, 0x04, 0x9f, 0x93, 0x59, 0x04, 0xff, 0x05, 0x39, 0x04, 
+  0xff, 0x3c, 0x9e, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xbd, 0xce, 0xff, 0x5e, 0xdf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xfa, 0x1c, 0xff, 0x90, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 0xc8, 
+  0x39, 0x04, 0x08, 0x00, 0x00, 0x00, 0x59, 0x04, 0x63, 0x93, 0x59, 0x04, 0xff, 0x06, 0x39, 0x04, 0xff, 0x7b, 0x75, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0x9c, 0xbe, 0xff, 0x3b, 0xae, 0xff, 
+  0x5e, 0xdf, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x00, 0x19, 0x04, 0xff, 0x90, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xac, 0x81, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x23, 0x94, 0x59, 0x04, 0xff, 0x07, 
+  0xda, 0x54, 0xff, 0xbd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0x7c, 0xbe, 0xff, 0x5b, 0xb6, 0xff, 0x1b, 0xa6, 0xff, 0x1d, 0xd7, 0xff, 0xdf, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0x3e, 0xcf, 0xff, 
+  0xf9, 0x03, 0xff, 0x90, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x6f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0xec, 0x93, 0x59, 0x04, 0xff, 0x03, 0x7a, 0x04, 0xff, 0x9d, 0xbe, 0xff, 0xdd, 0xce, 
+  0xff, 0x7c, 0xb6, 0xff, 0x82, 0x5b, 0xb6, 0xff, 0x01, 0x7c, 0xb6, 0xff, 0xdf, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x1c, 0x7e, 0xff, 0x19, 0x04, 0xff, 0x90, 0x59, 0x04, 0xff, 0x00, 0x59, 
+  0x04, 0x18, 0x82, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x74, 0x93, 0x59, 0x04, 0xff, 0x03, 0x39, 0x04, 0xff, 0x3c, 0xa6, 0xff, 0xdd, 0xd6, 0xff, 0x7c, 0xb6, 0xff, 0x83, 0x5b, 0xb6, 0xff, 0x01, 
+  0x1a, 0x4d, 0xff, 0x5f, 0xdf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xfa, 0x24, 0xff, 0x39, 0x04, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0xdb, 0x83, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 
+  0x14, 0x93, 0x59, 0x04, 0xff, 0x03, 0x39, 0x04, 0xff, 0x3b, 0x4d, 0xff, 0xfd, 0xd6, 0xff, 0x7c, 0xb6, 0xff, 0x81, 0x5b, 0xb6, 0xff, 0x04, 0x7b, 0xbe, 0xff, 0x3a, 0x5d, 0xff, 0x39, 0x04, 0xff, 
+  0x59, 0x04, 0xff, 0x5d, 0x9e, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xf7, 0xff, 0x39, 0x04, 0xff, 0x90, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x58, 0x83, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 
+  0x04, 0x59, 0x04, 0xbf, 0x93, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 0xff, 0xfd, 0xd6, 0xff, 0x7c, 0xb6, 0xff, 0x81, 0x5b, 0xb6, 0xff, 0x01, 0x1a, 0x4d, 0xff, 0x39, 0x04, 0xff, 0x81, 0x59, 0x04, 
+  0xff, 0x02, 0x39, 0x04, 0xff, 0x3b, 0x45, 0xff, 0xdf, 0xf7, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0x3e, 0xcf, 0xff, 0x39, 0x04, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xe8, 0x59, 0x04, 
+  0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0x5f, 0x93, 0x59, 0x04, 0xff, 0x05, 0x19, 0x04, 0xff, 0x1c, 0x96, 0xff, 0x9c, 0xc6, 0xff, 0x5b, 0xb6, 0xff, 0x3a, 0x65, 0xff, 0x39, 0x04, 0xff, 
+  0x83, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 0xff, 0xfa, 0x44, 0xff, 0x1e, 0xcf, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0x9d, 0xb6, 0xff, 0x39, 0x04, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 
+  0x97, 0x86, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0xf0, 0x92, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 0xda, 0x44, 0xff, 0xfb, 0x8d, 0xff, 0xda, 0x3c, 0xff, 0x39, 0x04, 0xff, 0x85, 0x59, 0x04, 
+  0xff, 0x02, 0x39, 0x04, 0xff, 0x59, 0x14, 0xff, 0x5d, 0xa6, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x1c, 0xa6, 0xff, 0x90, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x2f, 0x86, 0x00, 0x00, 0x00, 0x00, 
+  0x59, 0x04, 0x54, 0x93, 0x59, 0x04, 0xff, 0x02, 0x39, 0x04, 0xff, 0x19, 0x04, 0xff, 0x39, 0x04, 0xff, 0x88, 0x59, 0x04, 0xff, 0x05, 0x19, 0x04, 0xff, 0xdc, 0x7d, 0xff, 0xbf, 0xef, 0xff, 0xff, 
+  0xff, 0xff, 0xdf, 0xf7, 0xff, 0x1a, 0x4d, 0xff, 0x8f, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x9f, 0x88, 0x00, 0x00, 0x00, 0x00, 0x59, 0x04, 0xb0, 0x9f, 0x59, 0x04, 0xff, 0x04, 0x39, 0x04, 0xff, 
+  0xba, 0x3c, 0xff, 0xdc, 0x8d, 0xff, 0x5b, 0x75, 0xff, 0x39, 0x04, 0xff, 0x8e, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xec, 0x39, 0x04, 0x08, 0x88, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x30, 0x59, 
+  0x04, 0xf4, 0xa0, 0x59, 0x04, 0xff, 0x00, 0x39, 0x04, 0xff, 0x90, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x5c, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0x80, 0xb1, 0x59, 0x04, 0xff, 0x00, 0x59, 
+  0x04, 0xbb, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x39, 0x04, 0xa4, 0xaf, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xf3, 0xba, 0x03, 0x04, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x7a, 0x04, 0x10, 0x59, 0x04, 0xdb, 
+  0xad, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xf3, 0x39, 0x04, 0x2f, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x20, 0x59, 0x04, 0xf7, 0xac, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x4f, 0x90, 0x00, 
+  0x00, 0x00, 0x01, 0x5a, 0x04, 0x1f, 0x59, 0x04, 0xef, 0xaa, 0x59, 0x04, 0xff, 0x00, 0x59, 0x04, 0x5c, 0x92, 0x00, 0x00, 0x00, 0x01, 0x59, 0x04, 0x3b, 0x59, 0x04, 0xf4, 0xa8, 0x59, 0x04, 0xff, 
+  0x00, 0x59, 0x04, 0x63, 0x94, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x04, 0x14, 0x59, 0x04, 0xe4, 0xa6, 0x59, 0x04, 0xff, 0x00, 0x3a, 0x04, 0x47, 0x96, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x04, 0x18, 0x59, 
+  0x04, 0xc3, 0xa3, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xdc, 0x59, 0x04, 0x3b, 0x98, 0x00, 0x00, 0x00, 0x01, 0x39, 0x04, 0x08, 0x39, 0x04, 0x70, 0xa1, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xa7, 
+  0x39, 0x04, 0x14, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x5a, 0x04, 0x3b, 0x59, 0x04, 0xe0, 0x9d, 0x59, 0x04, 0xff, 0x01, 0x59, 0x04, 0xf0, 0x39, 0x04, 0x63, 0x9e, 0x00, 0x00, 0x00, 0x02, 0xb8, 0x04, 
+  0x04, 0x59, 0x04, 0x63, 0x59, 0x04, 0xdf, 0x99, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0xf0, 0x59, 0x04, 0x7c, 0x59, 0x04, 0x18, 0xa1, 0x00, 0x00, 0x00, 0x02, 0x59, 0x04, 0x03, 0x59, 0x04, 0x57, 
+  0x59, 0x04, 0xf0, 0x95, 0x59, 0x04, 0xff, 0x02, 0x59, 0x04, 0xfc, 0x59, 0x04, 0x83, 0x1a, 0x05, 0x07, 0xa6, 0x00, 0x00, 0x00, 0x03, 0x59, 0x04, 0x48, 0x59, 0x04, 0x9c, 0x59, 0x04, 0xd0, 0x59, 
+  0x04, 0xf4, 0x8d, 0x59, 0x04, 0xff, 0x03, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xd4, 0x59, 0x04, 0xab, 0x59, 0x04, 0x5c, 0xab, 0x00, 0x00, 0x00, 0x07, 0x59, 0x04, 0x0f, 0x59, 0x04, 0x1c, 0x59, 0x04, 
+  0x3f, 0x59, 0x04, 0x7f, 0x59, 0x04, 0xa8, 0x59, 0x04, 0xd0, 0x59, 0x04, 0xf3, 0x59, 0x04, 0xfc, 0x81, 0x59, 0x04, 0xff, 0x07, 0x59, 0x04, 0xfc, 0x59, 0x04, 0xeb, 0x59, 0x04, 0xd8, 0x59, 0x04, 
+  0xaf, 0x59, 0x04, 0x7f, 0x59, 0x04, 0x4f, 0x3a, 0x04, 0x20, 0x59, 0x04, 0x10, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3a, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 0x04, 0x39, 0x13, 0x04, 0x59, 0x23, 0x04, 0x59, 0x43, 0x04, 0x59, 0x70, 0x04, 0x59, 0x9f, 0x04, 0x59, 0xb8, 0x04, 0x59, 0xcc, 0x04, 0x59, 0xe0, 0x04, 0x59, 0xdb, 0x04, 0x59, 0xcb, 0x04, 0x59, 0xbc, 0x04, 0x59, 0x9f, 0x04, 0x59, 0x74, 0x04, 0x59, 0x48, 0x04, 0x59, 0x24, 0x04, 0x59, 0x14, 0x04, 0x59, 0x04, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x59, 0x00, 0x04, 0x3a, 0x13, 0x04, 0x59, 0x73, 0x04, 0x59, 0xb3, 0x04, 0x59, 0xd7, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xdc, 0x04, 0x59, 0xbb, 0x04, 0x59, 0x7c, 0x04, 0x39, 0x23, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 0x03, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x3b, 0x00, 0x04, 0x5a, 0x27, 0x04, 0x59, 0xb3, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xd3, 0x04, 0x39, 0x38, 0x04, 0x39, 0x00, 0x04, 0x99, 0x00, 0x04, 0x59, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x00, 0x04, 0x79, 0x00, 0x03, 0xb9, 0x00, 0x04, 0x59, 0x43, 0x04, 0x59, 0xab, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc4, 0x04, 0x59, 0x58, 0x00, 0x14, 0x00, 0x04, 0x59, 0x00, 0x03, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd9, 0x00, 0x04, 0x59, 0x00, 0x04, 0x18, 0x07, 0x04, 0x59, 0xb7, 0x04, 0x59, 0xfb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xd4, 0x04, 0x59, 0x2c, 0x03, 0xf9, 0x00, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xec, 0x00, 0x04, 0x3a, 0x00, 0x04, 0x17, 0x00, 0x04, 0x59, 0x4c, 0x04, 0x59, 0xfb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x70, 0x04, 0x59, 0x08, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x05, 0xbb, 0x00, 0x04, 0x1b, 0x04, 0x04, 0x59, 0x9f, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc0, 0x04, 0x39, 0x1f, 0x04, 0x5a, 0x00, 0x04, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x1b, 0x00, 0x05, 0x1a, 0x07, 0x04, 0x59, 0xc8, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xec, 0x04, 0x5a, 0x1b, 0x04, 0x5a, 0x00, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x20, 0x04, 0x59, 0xd3, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf8, 0x04, 0x59, 0x48, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x05, 0x00, 0x00, 0x04, 0x39, 0x10, 0x04, 0x59, 0xe0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf8, 0x04, 0x59, 0x34, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x00, 0x04, 0x78, 0x0c, 0x04, 0x59, 0xdb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0x34, 0x04, 0x7a, 0x00, 0x04, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x3a, 0x0b, 0x04, 0x59, 0xc4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xec, 0x04, 0x59, 0x1f, 0x00, 0x12, 0x00, 0x07, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x87, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xd3, 0x02, 0x58, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x00, 0x04, 0x59, 0x5f, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xa8, 0x03, 0xf9, 0x00, 0x04, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x24, 0x04, 0x59, 0xef, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xfb, 0x04, 0x59, 0x4b, 0x05, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x57, 0x00, 0x04, 0x58, 0x00, 0x04, 0x59, 0x9c, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xd7, 0x04, 0x5a, 0x04, 0x04, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4e, 0x00, 0x04, 0x39, 0x00, 0x04, 0x39, 0x38, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x88, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x59, 0xdf, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0x18, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x59, 0x50, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x04, 0x19, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x88, 0x04, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x04, 0x04, 0x59, 0xaf, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x9a, 0xff, 0x8e, 0x5d, 0xff, 0x9e, 0x7d, 0xff, 0x04, 0x7a, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xdb, 0x04, 0x59, 0x08, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x39, 0x00, 0x04, 0x39, 0x10, 0x04, 0x59, 0xf4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x1c, 0x9a, 0xff, 0x85, 0x9b, 0xff, 0xb6, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xdc, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0x3b, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x6b, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x03, 0xf9, 0xff, 0x04, 0xda, 0xff, 0xc6, 0xde, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x3d, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc4, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 
-  0x04, 0x5b, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0xdb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x34, 0x9a, 0xff, 0x65, 0x7b, 0xff, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x9b, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x18, 0x08, 0x04, 0x39, 0x00, 
-  0x04, 0x59, 0x00, 0x04, 0x5a, 0x13, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x03, 0xf9, 0xff, 0x55, 0x5b, 0xff, 0xbe, 0xbd, 0xff, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0xfa, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x58, 0x04, 0x59, 0x00, 
-  0x04, 0x59, 0x00, 0x04, 0x59, 0x60, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x39, 0xff, 0x65, 0xbc, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x9f, 0xff, 0x34, 0xba, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xa4, 0x04, 0x59, 0x00, 
-  0x04, 0x59, 0x00, 0x04, 0x59, 0x98, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x39, 0xff, 0x04, 0x5a, 0xff, 0x75, 0x5b, 0xff, 0xae, 0x7d, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xe7, 0x5e, 0xff, 0xbe, 0xbd, 0xff, 0xdf, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x5e, 0xff, 0x04, 0x5a, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc3, 0x04, 0x39, 0x04, 
-  0x04, 0x9b, 0x00, 0x04, 0x59, 0xbb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x19, 0xff, 0x04, 0x59, 0xff, 0x8e, 0x3d, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x7f, 0xff, 0xce, 0xdd, 0xff, 0xc6, 0xbd, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xfe, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xdb, 0x04, 0x59, 0x13, 
-  0x04, 0x59, 0x0c, 0x04, 0x59, 0xd0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x39, 0xff, 0x1c, 0x7a, 0xff, 0x5d, 0x1a, 0xff, 0xa6, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xfd, 0xff, 0xce, 0xbd, 0xff, 0xce, 0xdd, 0xff, 0xe7, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x1c, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xef, 0x04, 0x59, 0x1c, 
-  0x04, 0x59, 0x14, 0x04, 0x59, 0xdc, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x03, 0xf9, 0xff, 0x04, 0xba, 0xff, 0xae, 0x7d, 0xff, 0xd7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x3e, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xc6, 0xdd, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x1b, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xfb, 0x04, 0x39, 0x24, 
-  0x04, 0x59, 0x18, 0x04, 0x59, 0xe7, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x35, 0x1b, 0xff, 0xc7, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xb6, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x19, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x79, 0x2b, 
-  0x04, 0x59, 0x1f, 0x04, 0x59, 0xf0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x44, 0xfa, 0xff, 0x9e, 0x1c, 0xff, 0xd7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7f, 0xff, 0xbe, 0x9d, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xc6, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x5f, 0xff, 0x03, 0xf9, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0x3c, 
-  0x04, 0x59, 0x1f, 0x04, 0x59, 0xf3, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x24, 0xda, 0xff, 0xdf, 0x3e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xc6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xbe, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x3d, 0xff, 0x04, 0x19, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x40, 
-  0x04, 0x39, 0x1f, 0x04, 0x59, 0xf0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0x5e, 0xff, 0xce, 0xbd, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xc6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x3b, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x40, 
-  0x04, 0x59, 0x1f, 0x04, 0x59, 0xef, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x14, 0x9a, 0xff, 0xcf, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x7f, 0xff, 0xd6, 0xfd, 0xff, 0xce, 0xbd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xbd, 0xff, 0xd7, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x3c, 0x9a, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x43, 
-  0x04, 0x39, 0x1b, 0x04, 0x59, 0xeb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x9a, 0xff, 0x86, 0x3d, 0xff, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xfe, 0xff, 0xce, 0xbd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xdf, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7f, 0xff, 0x24, 0x7a, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x5a, 0x30, 
-  0x04, 0x59, 0x14, 0x04, 0x59, 0xdc, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x03, 0xf9, 0xff, 0x2c, 0xfb, 0xff, 0xae, 0x5d, 0xff, 0xd7, 0x1e, 0xff, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x7f, 0xff, 0xc6, 0xbd, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xc6, 0xbd, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xfe, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0x27, 
-  0x04, 0x39, 0x0c, 0x04, 0x59, 0xcf, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x44, 0xba, 0xff, 0x85, 0xfc, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xc6, 0xbd, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x9d, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf3, 0x04, 0x59, 0x20, 
-  0x04, 0x39, 0x04, 0x04, 0x59, 0xc0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0xd6, 0xfd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xbc, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xe3, 0x04, 0x59, 0x17, 
-  0x04, 0x59, 0x00, 0x04, 0x59, 0x9f, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x9e, 0x3c, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xbd, 0xff, 0xdf, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xfa, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xc8, 0x04, 0x39, 0x08, 
-  0x04, 0x59, 0x00, 0x04, 0x59, 0x63, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x75, 0x7b, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xbe, 0x9c, 0xff, 0xae, 0x3b, 0xff, 0xdf, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x19, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xac, 0x04, 0x59, 0x00, 
-  0x04, 0x59, 0x00, 0x04, 0x39, 0x23, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x54, 0xda, 0xff, 0xce, 0xbd, 0xff, 0xce, 0xdd, 0xff, 0xbe, 0x7c, 0xff, 0xb6, 0x5b, 0xff, 0xa6, 0x1b, 0xff, 0xd7, 0x1d, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x3e, 0xff, 0x03, 0xf9, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x6f, 0x04, 0x39, 0x00, 
-  0x05, 0x7b, 0x00, 0x03, 0xf9, 0x00, 0x04, 0x59, 0xec, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x7a, 0xff, 0xbe, 0x9d, 0xff, 0xce, 0xdd, 0xff, 0xb6, 0x7c, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x7c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x1c, 0xff, 0x04, 0x19, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x18, 0x04, 0x59, 0x00, 
-  0x04, 0xf4, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x74, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0xa6, 0x3c, 0xff, 0xd6, 0xdd, 0xff, 0xb6, 0x7c, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x5b, 0xff, 0x4d, 0x1a, 0xff, 0xdf, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xfa, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xdb, 0x04, 0x19, 0x00, 0x00, 0x16, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x14, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x4d, 0x3b, 0xff, 0xd6, 0xfd, 0xff, 0xb6, 0x7c, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x5b, 0xff, 0xbe, 0x7b, 0xff, 0x5d, 0x3a, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x9e, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x58, 0x04, 0x59, 0x00, 0x03, 0xae, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x04, 0x04, 0x59, 0xbf, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0xd6, 0xfd, 0xff, 0xb6, 0x7c, 0xff, 0xb6, 0x5b, 0xff, 0xb6, 0x5b, 0xff, 0x4d, 0x1a, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x45, 0x3b, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x3e, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xe8, 0x04, 0x59, 0x08, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x79, 0x00, 0x04, 0x59, 0x5f, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x19, 0xff, 0x96, 0x1c, 0xff, 0xc6, 0x9c, 0xff, 0xb6, 0x5b, 0xff, 0x65, 0x3a, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x44, 0xfa, 0xff, 0xcf, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x9d, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x97, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x00, 0x04, 0xfa, 0x00, 0x04, 0x59, 0xf0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x44, 0xda, 0xff, 0x8d, 0xfb, 0xff, 0x3c, 0xda, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x14, 0x59, 0xff, 0xa6, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x1c, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x2f, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x54, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x19, 0xff, 0x7d, 0xdc, 0xff, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0x4d, 0x1a, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x9f, 0x04, 0x59, 0x00, 0x04, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x04, 0x1a, 0x00, 0x04, 0x59, 0xb0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x3c, 0xba, 0xff, 0x8d, 0xdc, 0xff, 0x75, 0x5b, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xec, 0x04, 0x39, 0x08, 0x04, 0x3a, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x30, 0x04, 0x59, 0xf4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x39, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x5c, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x00, 0x04, 0x39, 0x80, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xbb, 0x00, 0x1f, 0x00, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x39, 0xa4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf3, 0x03, 0xba, 0x04, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x99, 0x00, 0x04, 0x7a, 0x10, 0x04, 0x59, 0xdb, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf3, 0x04, 0x39, 0x2f, 0x04, 0x19, 0x00, 0x04, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x04, 0x79, 0x00, 0x04, 0x59, 0x20, 0x04, 0x59, 0xf7, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x4f, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x79, 0x00, 0x04, 0x7a, 0x00, 0x04, 0x5a, 0x1f, 0x04, 0x59, 0xef, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x5c, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7a, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x59, 0x3b, 0x04, 0x59, 0xf4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0x63, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x04, 0x1a, 0x00, 0x04, 0x3a, 0x14, 0x04, 0x59, 0xe4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x3a, 0x47, 0x04, 0x3a, 0x00, 0x04, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1b, 0x00, 0x04, 0x1a, 0x00, 0x04, 0x5a, 0x18, 0x04, 0x59, 0xc3, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xdc, 0x04, 0x59, 0x3b, 0x04, 0x3a, 0x00, 0x04, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe5, 0x00, 0x04, 0x59, 0x00, 0x04, 0x39, 0x08, 0x04, 0x39, 0x70, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xa7, 0x04, 0x39, 0x14, 0x04, 0x39, 0x00, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x5a, 0x00, 0x03, 0xf9, 0x00, 0x04, 0x5a, 0x3b, 0x04, 0x59, 0xe0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf0, 0x04, 0x39, 0x63, 0x04, 0x79, 0x00, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb9, 0x00, 0x04, 0x59, 0x00, 0x04, 0xb8, 0x04, 0x04, 0x59, 0x63, 0x04, 0x59, 0xdf, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xf0, 0x04, 0x59, 0x7c, 0x04, 0x59, 0x18, 0x04, 0x39, 0x00, 0x06, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x04, 0x59, 0x00, 0x04, 0x39, 0x00, 0x04, 0x59, 0x03, 0x04, 0x59, 0x57, 0x04, 0x59, 0xf0, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xfc, 0x04, 0x59, 0x83, 0x05, 0x1a, 0x07, 0x01, 0x77, 0x00, 0x03, 0xd9, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x04, 0x3a, 0x00, 0x04, 0x59, 0x48, 0x04, 0x59, 0x9c, 0x04, 0x59, 0xd0, 0x04, 0x59, 0xf4, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xd4, 0x04, 0x59, 0xab, 0x04, 0x59, 0x5c, 0x03, 0x9a, 0x00, 0x04, 0x59, 0x00, 0x05, 0x5b, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x58, 0x00, 0x04, 0x58, 0x00, 0x04, 0x59, 0x00, 0x04, 0x7a, 0x00, 0x04, 0x59, 0x0f, 0x04, 0x59, 0x1c, 0x04, 0x59, 0x3f, 0x04, 0x59, 0x7f, 0x04, 0x59, 0xa8, 0x04, 0x59, 0xd0, 0x04, 0x59, 0xf3, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xff, 0x04, 0x59, 0xff, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xeb, 0x04, 0x59, 0xd8, 0x04, 0x59, 0xaf, 0x04, 0x59, 0x7f, 0x04, 0x59, 0x4f, 0x04, 0x3a, 0x20, 0x04, 0x59, 0x10, 0x04, 0xf7, 0x00, 0x04, 0x19, 0x00, 0x04, 0x59, 0x00, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x00, 0x10, 0x04, 0x39, 0x13, 0x04, 0x59, 0x23, 0x04, 0x59, 0x43, 0x04, 0x59, 0x70, 0x04, 0x59, 0x9f, 0x04, 0x59, 0xb8, 0x04, 0x59, 0xcc, 0x04, 0x59, 
+  0xe0, 0x04, 0x59, 0xdb, 0x04, 0x59, 0xcb, 0x04, 0x59, 0xbc, 0x04, 0x59, 0x9f, 0x04, 0x59, 0x74, 0x04, 0x59, 0x48, 0x04, 0x59, 0x24, 0x04, 0x59, 0x14, 0x04, 0x59, 0x04, 0xab, 0x00, 0x00, 0x00, 
+  0x04, 0x04, 0x3a, 0x13, 0x04, 0x59, 0x73, 0x04, 0x59, 0xb3, 0x04, 0x59, 0xd7, 0x04, 0x59, 0xfc, 0x8c, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 0xdc, 0x04, 0x59, 0xbb, 0x04, 0x59, 0x7c, 0x04, 0x39, 
+  0x23, 0xa7, 0x00, 0x00, 0x00, 0x01, 0x04, 0x5a, 0x27, 0x04, 0x59, 0xb3, 0x95, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xd3, 0x04, 0x39, 0x38, 0xa3, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x43, 0x04, 
+  0x59, 0xab, 0x99, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xc4, 0x04, 0x59, 0x58, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x04, 0x18, 0x07, 0x04, 0x59, 0xb7, 0x04, 0x59, 0xfb, 0x9b, 0x04, 0x59, 0xff, 0x02, 
+  0x04, 0x59, 0xfc, 0x04, 0x59, 0xd4, 0x04, 0x59, 0x2c, 0x9c, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x4c, 0x04, 0x59, 0xfb, 0xa0, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0x70, 0x04, 0x59, 0x08, 0x98, 
+  0x00, 0x00, 0x00, 0x01, 0x04, 0x1b, 0x04, 0x04, 0x59, 0x9f, 0xa3, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xc0, 0x04, 0x39, 0x1f, 0x96, 0x00, 0x00, 0x00, 0x01, 0x05, 0x1a, 0x07, 0x04, 0x59, 0xc8, 
+  0xa5, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xec, 0x04, 0x5a, 0x1b, 0x94, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x20, 0x04, 0x59, 0xd3, 0xa7, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xf8, 0x04, 0x59, 
+  0x48, 0x92, 0x00, 0x00, 0x00, 0x01, 0x04, 0x39, 0x10, 0x04, 0x59, 0xe0, 0xa9, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xf8, 0x04, 0x59, 0x34, 0x90, 0x00, 0x00, 0x00, 0x01, 0x04, 0x78, 0x0c, 0x04, 
+  0x59, 0xdb, 0xac, 0x04, 0x59, 0xff, 0x00, 0x04, 0x39, 0x34, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x04, 0x3a, 0x0b, 0x04, 0x59, 0xc4, 0xad, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xec, 0x04, 0x59, 0x1f, 
+  0x8d, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x87, 0xaf, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xd3, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x5f, 0xb1, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xa8, 
+  0x8a, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x24, 0x04, 0x59, 0xef, 0xb1, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xfb, 0x04, 0x59, 0x4b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x9c, 0xb3, 0x04, 
+  0x59, 0xff, 0x01, 0x04, 0x59, 0xd7, 0x04, 0x5a, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x38, 0xb5, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x88, 0x87, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 
+  0xdf, 0xb6, 0x04, 0x59, 0xff, 0x00, 0x04, 0x39, 0x18, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x50, 0xa7, 0x04, 0x59, 0xff, 0x00, 0x04, 0x39, 0xff, 0x81, 0x04, 0x19, 0xff, 0x8c, 0x04, 0x59, 
+  0xff, 0x00, 0x04, 0x59, 0x88, 0x84, 0x00, 0x00, 0x00, 0x01, 0x04, 0x39, 0x04, 0x04, 0x59, 0xaf, 0xa6, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 0x04, 0x9a, 0xff, 0x8e, 0x5d, 0xff, 0x9e, 0x7d, 
+  0xff, 0x04, 0x7a, 0xff, 0x8b, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xdb, 0x04, 0x59, 0x08, 0x83, 0x00, 0x00, 0x00, 0x01, 0x04, 0x39, 0x10, 0x04, 0x59, 0xf4, 0xa2, 0x04, 0x59, 0xff, 0x04, 0x04, 
+  0x39, 0xff, 0x04, 0x19, 0xff, 0x1c, 0x9a, 0xff, 0x85, 0x9b, 0xff, 0xb6, 0xde, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x85, 0xdc, 0xff, 0x04, 0x39, 0xff, 0x8b, 0x04, 0x59, 0xff, 0x00, 0x04, 0x39, 
+  0x3b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x6b, 0xa1, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 0x03, 0xf9, 0xff, 0x04, 0xda, 0xff, 0xc6, 0xde, 0xff, 0xef, 0x9f, 0xff, 0x84, 0xff, 0xff, 
+  0xff, 0x01, 0x96, 0x3d, 0xff, 0x04, 0x39, 0xff, 0x8b, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xc4, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0xdb, 0x9e, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 
+  0x04, 0x59, 0xff, 0x34, 0x9a, 0xff, 0x65, 0x7b, 0xff, 0xcf, 0x3f, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x7d, 0x9b, 0xff, 0x04, 0x39, 0xff, 0x8c, 0x04, 0x59, 0xff, 0x00, 0x04, 0x18, 0x08, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x5a, 0x13, 0x9d, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 0x03, 0xf9, 0xff, 0x55, 0x5b, 0xff, 0xbe, 0xbd, 0xff, 0xdf, 0x7f, 0xff, 0x89, 0xff, 0xff, 0xff, 0x00, 
+  0x64, 0xfa, 0xff, 0x8d, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x58, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x60, 0x9b, 0x04, 0x59, 0xff, 0x81, 0x04, 0x39, 0xff, 0x01, 0x65, 0xbc, 0xff, 0xef, 
+  0x9f, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xff, 0xef, 0x9f, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xe7, 0x9f, 0xff, 0x34, 0xba, 0xff, 0x8d, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xa4, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x98, 0x97, 0x04, 0x59, 0xff, 0x81, 0x04, 0x39, 0xff, 0x03, 0x04, 0x5a, 0xff, 0x75, 0x5b, 0xff, 0xae, 0x7d, 0xff, 0xf7, 0xdf, 0xff, 0x85, 0xff, 0xff, 
+  0xff, 0x03, 0xf7, 0xdf, 0xff, 0xe7, 0x5e, 0xff, 0xbe, 0xbd, 0xff, 0xdf, 0x5e, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xdf, 0x5e, 0xff, 0x04, 0x5a, 0xff, 0x8d, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 
+  0xc3, 0x04, 0x39, 0x04, 0x00, 0x00, 0x00, 0x04, 0x59, 0xbb, 0x96, 0x04, 0x59, 0xff, 0x04, 0x04, 0x19, 0xff, 0x04, 0x59, 0xff, 0x8e, 0x3d, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0xdf, 0xff, 0x86, 0xff, 
+  0xff, 0xff, 0x03, 0xe7, 0x7f, 0xff, 0xce, 0xdd, 0xff, 0xc6, 0xbd, 0xff, 0xef, 0x9f, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xce, 0xfe, 0xff, 0x04, 0x39, 0xff, 0x8d, 0x04, 0x59, 0xff, 0x03, 0x04, 
+  0x59, 0xdb, 0x04, 0x59, 0x13, 0x04, 0x59, 0x0c, 0x04, 0x59, 0xd0, 0x92, 0x04, 0x59, 0xff, 0x81, 0x04, 0x39, 0xff, 0x02, 0x1c, 0x7a, 0xff, 0x5d, 0x1a, 0xff, 0xa6, 0x9d, 0xff, 0x89, 0xff, 0xff, 
+  0xff, 0x03, 0xc6, 0xfd, 0xff, 0xce, 0xbd, 0xff, 0xce, 0xdd, 0xff, 0xe7, 0x9f, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0x8e, 0x1c, 0xff, 0x04, 0x39, 0xff, 0x8d, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 
+  0xef, 0x04, 0x59, 0x1c, 0x04, 0x59, 0x14, 0x04, 0x59, 0xdc, 0x90, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 0x03, 0xf9, 0xff, 0x04, 0xba, 0xff, 0xae, 0x7d, 0xff, 0xd7, 0x5e, 0xff, 0x89, 0xff, 
+  0xff, 0xff, 0x04, 0xd7, 0x3e, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xc6, 0xdd, 0xff, 0xf7, 0xbf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0x25, 0x1b, 0xff, 0x04, 0x39, 0xff, 0x8d, 0x04, 0x59, 
+  0xff, 0x03, 0x04, 0x59, 0xfb, 0x04, 0x39, 0x24, 0x04, 0x59, 0x18, 0x04, 0x59, 0xe7, 0x8f, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 0xff, 0x35, 0x1b, 0xff, 0xc7, 0x1e, 0xff, 0x8a, 0xff, 0xff, 0xff, 
+  0x04, 0xff, 0xdf, 0xff, 0xc6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xb6, 0x9d, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0x04, 0x19, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x02, 0x04, 0x79, 0x2b, 
+  0x04, 0x59, 0x1f, 0x04, 0x59, 0xf0, 0x8b, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x44, 0xfa, 0xff, 0x9e, 0x1c, 0xff, 0xd7, 0x5f, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x04, 0xef, 
+  0x7f, 0xff, 0xbe, 0x9d, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xc6, 0xdd, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xcf, 0x5f, 0xff, 0x03, 0xf9, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 
+  0x3c, 0x04, 0x59, 0x1f, 0x04, 0x59, 0xf3, 0x8a, 0x04, 0x59, 0xff, 0x03, 0x04, 0x39, 0xff, 0x24, 0xda, 0xff, 0xdf, 0x3e, 0xff, 0xf7, 0xbf, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xbf, 0xff, 
+  0xc6, 0xdd, 0xff, 0x81, 0xce, 0xdd, 0xff, 0x01, 0xd6, 0xdd, 0xff, 0xbe, 0xbd, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x8e, 0x3d, 0xff, 0x04, 0x19, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 
+  0x40, 0x04, 0x39, 0x1f, 0x04, 0x59, 0xf0, 0x89, 0x04, 0x59, 0xff, 0x01, 0x04, 0x39, 0xff, 0x04, 0x9a, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xdf, 0x5e, 0xff, 0xce, 0xbd, 0xff, 
+  0xd6, 0xdd, 0xff, 0x81, 0xce, 0xdd, 0xff, 0x00, 0xc6, 0xfd, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x55, 0x3b, 0xff, 0x04, 0x39, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0x40, 0x04, 0x59, 
+  0x1f, 0x04, 0x59, 0xef, 0x89, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 0xff, 0x14, 0x9a, 0xff, 0xcf, 0x1e, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xe7, 0x7f, 0xff, 0xd6, 0xfd, 0xff, 0xce, 0xbd, 0xff, 
+  0x81, 0xce, 0xdd, 0xff, 0x01, 0xce, 0xbd, 0xff, 0xd7, 0x1e, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xff, 0x3c, 0x9a, 0xff, 0x90, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0x43, 0x04, 0x39, 
+  0x1b, 0x04, 0x59, 0xeb, 0x8b, 0x04, 0x59, 0xff, 0x03, 0x04, 0x39, 0xff, 0x04, 0x9a, 0xff, 0x86, 0x3d, 0xff, 0xef, 0xbf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xce, 0xfe, 0xff, 0xce, 0xbd, 0xff, 
+  0x83, 0xce, 0xdd, 0xff, 0x00, 0xdf, 0x5e, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xdf, 0x7f, 0xff, 0x24, 0x7a, 0xff, 0x90, 0x04, 0x59, 0xff, 0x02, 0x04, 0x5a, 0x30, 0x04, 0x59, 0x14, 0x04, 0x59, 
+  0xdc, 0x8c, 0x04, 0x59, 0xff, 0x0a, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x03, 0xf9, 0xff, 0x2c, 0xfb, 0xff, 0xae, 0x5d, 0xff, 0xd7, 0x1e, 0xff, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x7f, 
+  0xff, 0xc6, 0xbd, 0xff, 0xd6, 0xdd, 0xff, 0x81, 0xce, 0xdd, 0xff, 0x02, 0xd6, 0xdd, 0xff, 0xc6, 0xbd, 0xff, 0xe7, 0x5e, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xce, 0xfe, 0xff, 0x91, 0x04, 0x59, 
+  0xff, 0x02, 0x04, 0x39, 0x27, 0x04, 0x39, 0x0c, 0x04, 0x59, 0xcf, 0x8f, 0x04, 0x59, 0xff, 0x81, 0x04, 0x39, 0xff, 0x03, 0x04, 0x59, 0xff, 0x44, 0xba, 0xff, 0x85, 0xfc, 0xff, 0xd6, 0xdd, 0xff, 
+  0x83, 0xce, 0xdd, 0xff, 0x01, 0xc6, 0xbd, 0xff, 0xef, 0x9f, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xbe, 0x9d, 0xff, 0x04, 0x39, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 0xf3, 0x04, 0x59, 
+  0x20, 0x04, 0x39, 0x04, 0x04, 0x59, 0xc0, 0x93, 0x04, 0x59, 0xff, 0x01, 0x04, 0x39, 0xff, 0xd6, 0xfd, 0xff, 0x81, 0xce, 0xdd, 0xff, 0x02, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xe7, 0x7f, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0x00, 0x7d, 0xbc, 0xff, 0x90, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 0xe3, 0x04, 0x59, 0x17, 0x00, 0x00, 0x00, 0x04, 0x59, 0x9f, 0x93, 0x04, 0x59, 0xff, 0x05, 0x04, 0x39, 
+  0xff, 0x9e, 0x3c, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xbd, 0xff, 0xdf, 0x5e, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x1c, 0xfa, 0xff, 0x90, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 0xc8, 
+  0x04, 0x39, 0x08, 0x00, 0x00, 0x00, 0x04, 0x59, 0x63, 0x93, 0x04, 0x59, 0xff, 0x06, 0x04, 0x39, 0xff, 0x75, 0x7b, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xbe, 0x9c, 0xff, 0xae, 0x3b, 0xff, 
+  0xdf, 0x5e, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x00, 0x04, 0x19, 0xff, 0x90, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xac, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x23, 0x94, 0x04, 0x59, 0xff, 0x07, 
+  0x54, 0xda, 0xff, 0xce, 0xbd, 0xff, 0xce, 0xdd, 0xff, 0xbe, 0x7c, 0xff, 0xb6, 0x5b, 0xff, 0xa6, 0x1b, 0xff, 0xd7, 0x1d, 0xff, 0xff, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xcf, 0x3e, 0xff, 
+  0x03, 0xf9, 0xff, 0x90, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x6f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0xec, 0x93, 0x04, 0x59, 0xff, 0x03, 0x04, 0x7a, 0xff, 0xbe, 0x9d, 0xff, 0xce, 0xdd, 
+  0xff, 0xb6, 0x7c, 0xff, 0x82, 0xb6, 0x5b, 0xff, 0x01, 0xb6, 0x7c, 0xff, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x7e, 0x1c, 0xff, 0x04, 0x19, 0xff, 0x90, 0x04, 0x59, 0xff, 0x00, 0x04, 
+  0x59, 0x18, 0x82, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x74, 0x93, 0x04, 0x59, 0xff, 0x03, 0x04, 0x39, 0xff, 0xa6, 0x3c, 0xff, 0xd6, 0xdd, 0xff, 0xb6, 0x7c, 0xff, 0x83, 0xb6, 0x5b, 0xff, 0x01, 
+  0x4d, 0x1a, 0xff, 0xdf, 0x5f, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x24, 0xfa, 0xff, 0x04, 0x39, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0xdb, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 
+  0x14, 0x93, 0x04, 0x59, 0xff, 0x03, 0x04, 0x39, 0xff, 0x4d, 0x3b, 0xff, 0xd6, 0xfd, 0xff, 0xb6, 0x7c, 0xff, 0x81, 0xb6, 0x5b, 0xff, 0x04, 0xbe, 0x7b, 0xff, 0x5d, 0x3a, 0xff, 0x04, 0x39, 0xff, 
+  0x04, 0x59, 0xff, 0x9e, 0x5d, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xff, 0x04, 0x39, 0xff, 0x90, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x58, 0x83, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 
+  0x04, 0x04, 0x59, 0xbf, 0x93, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 0xff, 0xd6, 0xfd, 0xff, 0xb6, 0x7c, 0xff, 0x81, 0xb6, 0x5b, 0xff, 0x01, 0x4d, 0x1a, 0xff, 0x04, 0x39, 0xff, 0x81, 0x04, 0x59, 
+  0xff, 0x02, 0x04, 0x39, 0xff, 0x45, 0x3b, 0xff, 0xf7, 0xdf, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xcf, 0x3e, 0xff, 0x04, 0x39, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xe8, 0x04, 0x59, 
+  0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x5f, 0x93, 0x04, 0x59, 0xff, 0x05, 0x04, 0x19, 0xff, 0x96, 0x1c, 0xff, 0xc6, 0x9c, 0xff, 0xb6, 0x5b, 0xff, 0x65, 0x3a, 0xff, 0x04, 0x39, 0xff, 
+  0x83, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 0xff, 0x44, 0xfa, 0xff, 0xcf, 0x1e, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xb6, 0x9d, 0xff, 0x04, 0x39, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 
+  0x97, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0xf0, 0x92, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 0x44, 0xda, 0xff, 0x8d, 0xfb, 0xff, 0x3c, 0xda, 0xff, 0x04, 0x39, 0xff, 0x85, 0x04, 0x59, 
+  0xff, 0x02, 0x04, 0x39, 0xff, 0x14, 0x59, 0xff, 0xa6, 0x5d, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xa6, 0x1c, 0xff, 0x90, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x2f, 0x86, 0x00, 0x00, 0x00, 0x00, 
+  0x04, 0x59, 0x54, 0x93, 0x04, 0x59, 0xff, 0x02, 0x04, 0x39, 0xff, 0x04, 0x19, 0xff, 0x04, 0x39, 0xff, 0x88, 0x04, 0x59, 0xff, 0x05, 0x04, 0x19, 0xff, 0x7d, 0xdc, 0xff, 0xef, 0xbf, 0xff, 0xff, 
+  0xff, 0xff, 0xf7, 0xdf, 0xff, 0x4d, 0x1a, 0xff, 0x8f, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x9f, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0xb0, 0x9f, 0x04, 0x59, 0xff, 0x04, 0x04, 0x39, 0xff, 
+  0x3c, 0xba, 0xff, 0x8d, 0xdc, 0xff, 0x75, 0x5b, 0xff, 0x04, 0x39, 0xff, 0x8e, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xec, 0x04, 0x39, 0x08, 0x88, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x30, 0x04, 
+  0x59, 0xf4, 0xa0, 0x04, 0x59, 0xff, 0x00, 0x04, 0x39, 0xff, 0x90, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x5c, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0x80, 0xb1, 0x04, 0x59, 0xff, 0x00, 0x04, 
+  0x59, 0xbb, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x39, 0xa4, 0xaf, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xf3, 0x03, 0xba, 0x04, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x04, 0x7a, 0x10, 0x04, 0x59, 0xdb, 
+  0xad, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xf3, 0x04, 0x39, 0x2f, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x20, 0x04, 0x59, 0xf7, 0xac, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x4f, 0x90, 0x00, 
+  0x00, 0x00, 0x01, 0x04, 0x5a, 0x1f, 0x04, 0x59, 0xef, 0xaa, 0x04, 0x59, 0xff, 0x00, 0x04, 0x59, 0x5c, 0x92, 0x00, 0x00, 0x00, 0x01, 0x04, 0x59, 0x3b, 0x04, 0x59, 0xf4, 0xa8, 0x04, 0x59, 0xff, 
+  0x00, 0x04, 0x59, 0x63, 0x94, 0x00, 0x00, 0x00, 0x01, 0x04, 0x3a, 0x14, 0x04, 0x59, 0xe4, 0xa6, 0x04, 0x59, 0xff, 0x00, 0x04, 0x3a, 0x47, 0x96, 0x00, 0x00, 0x00, 0x01, 0x04, 0x5a, 0x18, 0x04, 
+  0x59, 0xc3, 0xa3, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xdc, 0x04, 0x59, 0x3b, 0x98, 0x00, 0x00, 0x00, 0x01, 0x04, 0x39, 0x08, 0x04, 0x39, 0x70, 0xa1, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xa7, 
+  0x04, 0x39, 0x14, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x04, 0x5a, 0x3b, 0x04, 0x59, 0xe0, 0x9d, 0x04, 0x59, 0xff, 0x01, 0x04, 0x59, 0xf0, 0x04, 0x39, 0x63, 0x9e, 0x00, 0x00, 0x00, 0x02, 0x04, 0xb8, 
+  0x04, 0x04, 0x59, 0x63, 0x04, 0x59, 0xdf, 0x99, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0xf0, 0x04, 0x59, 0x7c, 0x04, 0x59, 0x18, 0xa1, 0x00, 0x00, 0x00, 0x02, 0x04, 0x59, 0x03, 0x04, 0x59, 0x57, 
+  0x04, 0x59, 0xf0, 0x95, 0x04, 0x59, 0xff, 0x02, 0x04, 0x59, 0xfc, 0x04, 0x59, 0x83, 0x05, 0x1a, 0x07, 0xa6, 0x00, 0x00, 0x00, 0x03, 0x04, 0x59, 0x48, 0x04, 0x59, 0x9c, 0x04, 0x59, 0xd0, 0x04, 
+  0x59, 0xf4, 0x8d, 0x04, 0x59, 0xff, 0x03, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xd4, 0x04, 0x59, 0xab, 0x04, 0x59, 0x5c, 0xab, 0x00, 0x00, 0x00, 0x07, 0x04, 0x59, 0x0f, 0x04, 0x59, 0x1c, 0x04, 0x59, 
+  0x3f, 0x04, 0x59, 0x7f, 0x04, 0x59, 0xa8, 0x04, 0x59, 0xd0, 0x04, 0x59, 0xf3, 0x04, 0x59, 0xfc, 0x81, 0x04, 0x59, 0xff, 0x07, 0x04, 0x59, 0xfc, 0x04, 0x59, 0xeb, 0x04, 0x59, 0xd8, 0x04, 0x59, 
+  0xaf, 0x04, 0x59, 0x7f, 0x04, 0x59, 0x4f, 0x04, 0x3a, 0x20, 0x04, 0x59, 0x10, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x86, 0x00, 0x00, 0xcc, 0x87, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x00, 0xc5, 0x83, 0x00, 0x00, 0xcb, 0x86, 0x00, 0x13, 0xcc, 0x87, 0x00, 0x23, 0xca, 0x87, 0x00, 0x43, 0xca, 0x88, 0x00, 0x70, 0xcb, 0x87, 0x00, 0x9f, 0xcb, 0x88, 0x00, 0xb8, 0xcb, 0x88, 0x00, 0xcc, 0xcb, 0x87, 0x00, 0xe0, 0xcb, 0x87, 0x00, 0xdb, 0xca, 0x87, 0x00, 0xcb, 0xcb, 0x87, 0x00, 0xbc, 0xcb, 0x87, 0x00, 0x9f, 0xcb, 0x87, 0x00, 0x74, 0xcb, 0x87, 0x00, 0x48, 0xcb, 0x87, 0x00, 0x24, 0xcb, 0x88, 0x00, 0x14, 0xc8, 0x8a, 0x00, 0x04, 0xcc, 0x87, 0x00, 0x00, 0xca, 0x87, 0x00, 0x00, 0xc8, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x8d, 0x00, 0x00, 0xcd, 0x88, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x00, 0xcd, 0x86, 0x00, 0x13, 0xcb, 0x87, 0x00, 0x73, 0xcb, 0x87, 0x00, 0xb3, 0xcb, 0x87, 0x00, 0xd7, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xdc, 0xcb, 0x87, 0x00, 0xbb, 0xcc, 0x87, 0x00, 0x7c, 0xc9, 0x86, 0x00, 0x23, 0xcb, 0x87, 0x00, 0x00, 0xcc, 0x86, 0x00, 0x00, 0xcc, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x8a, 0x00, 0x00, 0xd6, 0x85, 0x00, 0x00, 0xcd, 0x88, 0x00, 0x27, 0xcb, 0x87, 0x00, 0xb3, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xd3, 0xcc, 0x86, 0x00, 0x38, 0xca, 0x83, 0x00, 0x00, 0xca, 0x92, 0x00, 0x00, 0xca, 0x88, 0x00, 0x00, 0x1d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x86, 0x00, 0x00, 0xca, 0x8b, 0x00, 0x00, 0xc7, 0x75, 0x00, 0x00, 0xca, 0x87, 0x00, 0x43, 0xcb, 0x87, 0x00, 0xab, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xc4, 0xcb, 0x88, 0x00, 0x58, 0xa1, 0x00, 0x00, 0x00, 0xcb, 0x88, 0x00, 0x00, 0xc4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x99, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x00, 0xc1, 0x82, 0x00, 0x07, 0xcb, 0x87, 0x00, 0xb7, 0xcb, 0x87, 0x00, 0xfb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0xd4, 0xcb, 0x89, 0x00, 0x2c, 0xc8, 0x7e, 0x00, 0x00, 0xcc, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x3d, 0x00, 0x00, 0xcd, 0x86, 0x00, 0x00, 0xba, 0x80, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x4c, 0xcb, 0x87, 0x00, 0xfb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x70, 0xcb, 0x89, 0x00, 0x08, 0xcb, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xdc, 0xb4, 0x00, 0x00, 0xd9, 0x80, 0x00, 0x04, 0xcb, 0x87, 0x00, 0x9f, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xc0, 0xcc, 0x86, 0x00, 0x1f, 0xd0, 0x87, 0x00, 0x00, 0xd2, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xd8, 0x9f, 0x00, 0x00, 0xd3, 0x9f, 0x00, 0x07, 0xcb, 0x87, 0x00, 0xc8, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xec, 0xd0, 0x87, 0x00, 0x1b, 0xd2, 0x87, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0xcb, 0x88, 0x00, 0x00, 0xc9, 0x8a, 0x00, 0x20, 0xcb, 0x87, 0x00, 0xd3, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf8, 0xcb, 0x87, 0x00, 0x48, 0xcc, 0x88, 0x00, 0x00, 0xcc, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xc6, 0x83, 0x00, 0x10, 0xcb, 0x87, 0x00, 0xe0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf8, 0xcc, 0x88, 0x00, 0x34, 0xcc, 0x87, 0x00, 0x00, 0xcc, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x81, 0x00, 0x00, 0xc4, 0x8e, 0x00, 0x0c, 0xcb, 0x88, 0x00, 0xdb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x87, 0x00, 0xff, 0xcc, 0x86, 0x00, 0x34, 0xce, 0x8b, 0x00, 0x00, 0xd1, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x88, 0x00, 0x00, 0xcf, 0x86, 0x00, 0x0b, 0xcb, 0x87, 0x00, 0xc4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xec, 0xcc, 0x88, 0x00, 0x1f, 0x91, 0x00, 0x00, 0x00, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x88, 0x00, 0x00, 0xca, 0x88, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x87, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xd3, 0xbd, 0x48, 0x00, 0x00, 0xd2, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x86, 0x00, 0x00, 0xcb, 0x88, 0x00, 0x5f, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xa8, 0xcb, 0x7e, 0x00, 0x00, 0xdb, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x88, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x24, 0xcb, 0x87, 0x00, 0xef, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xfb, 0xcc, 0x88, 0x00, 0x4b, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x87, 0x00, 0x00, 0xc1, 0x87, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x9c, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xd7, 0xce, 0x8a, 0x00, 0x04, 0xcd, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x48, 0x00, 0x00, 0xcb, 0x85, 0x00, 0x00, 0xcc, 0x86, 0x00, 0x38, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x88, 0xcb, 0x87, 0x00, 0x00, 0xc9, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x85, 0x00, 0x00, 0xce, 0x88, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xdf, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xc8, 0x86, 0x00, 0x18, 0xc9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x88, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x50, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xc9, 0x80, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x88, 0xd3, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x86, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xaf, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0xca, 0x84, 0x00, 0xff, 0xcf, 0x8f, 0x00, 0xff, 0xe6, 0xc7, 0x8b, 0xff, 0xe9, 0xcd, 0x9a, 0xff, 0xcd, 0x8b, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xdb, 0xcc, 0x87, 0x00, 0x08, 0xc9, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0x83, 0x00, 0x00, 0xcb, 0x86, 0x00, 0x10, 0xcb, 0x87, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x86, 0x00, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xd0, 0x92, 0x19, 0xff, 0xdb, 0xb2, 0x81, 0xff, 0xee, 0xd9, 0xb4, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xb9, 0x82, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0x3b, 0xcb, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0x87, 0x00, 0x00, 0xcc, 0x87, 0x00, 0x6b, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x85, 0x00, 0xff, 0xc7, 0x7c, 0x00, 0xff, 0xd4, 0x99, 0x00, 0xff, 0xed, 0xda, 0xbe, 0xff, 0xf8, 0xf1, 0xe7, 0xff, 0xfe, 0xfd, 0xfa, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xc5, 0x8e, 0xff, 0xca, 0x83, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x88, 0x00, 0xc4, 0xcb, 0x87, 0x00, 0x00, 0xc6, 0x84, 0x00, 0x00, 
-  0xd6, 0x87, 0x00, 0x00, 0xca, 0x87, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xdb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xce, 0x90, 0x2f, 0xff, 0xd9, 0xab, 0x64, 0xff, 0xf5, 0xe6, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xb2, 0x77, 0xff, 0xca, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xbf, 0x7f, 0x00, 0x08, 0xc8, 0x85, 0x00, 0x00, 
-  0xcc, 0x87, 0x00, 0x00, 0xcd, 0x87, 0x00, 0x13, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0xc9, 0x83, 0x00, 0xff, 0xc9, 0x7e, 0x00, 0xff, 0xd9, 0xa7, 0x4f, 0xff, 0xea, 0xd4, 0xb9, 0xff, 0xf7, 0xee, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfb, 0xf6, 0xff, 0xd3, 0x9e, 0x60, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x88, 0x00, 0x58, 0xcc, 0x88, 0x00, 0x00, 
-  0xcb, 0x87, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x60, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x83, 0x00, 0xff, 0xdf, 0xb4, 0x62, 0xff, 0xf9, 0xf2, 0xe6, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfc, 0xf9, 0xf7, 0xff, 0xf6, 0xf0, 0xe5, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf8, 0xf0, 0xe3, 0xff, 0xd0, 0x94, 0x33, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xa4, 0xc5, 0x88, 0x00, 0x00, 
-  0xcc, 0x88, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x98, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x83, 0x00, 0xff, 0xcd, 0x89, 0x00, 0xff, 0xd8, 0xa8, 0x6d, 0xff, 0xe8, 0xcd, 0xa7, 0xff, 0xfc, 0xf8, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfb, 0xf7, 0xf1, 0xff, 0xf2, 0xe8, 0xdd, 0xff, 0xe7, 0xd3, 0xbc, 0xff, 0xf3, 0xe7, 0xd5, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf4, 0xe8, 0xda, 0xff, 0xcd, 0x8a, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xc3, 0xca, 0x86, 0x00, 0x04, 
-  0xd6, 0x92, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xbb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xcc, 0x88, 0x00, 0xff, 0xe5, 0xc3, 0x88, 0xff, 0xf7, 0xef, 0xe6, 0xff, 0xfc, 0xf9, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xe2, 0xff, 0xeb, 0xda, 0xcb, 0xff, 0xe8, 0xd6, 0xc2, 0xff, 0xf7, 0xf0, 0xe7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xee, 0xdd, 0xca, 0xff, 0xca, 0x84, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xdb, 0xca, 0x87, 0x00, 0x13, 
-  0xca, 0x87, 0x00, 0x0c, 0xcb, 0x87, 0x00, 0xd0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcd, 0x8d, 0x17, 0xff, 0xd4, 0x9f, 0x58, 0xff, 0xeb, 0xd0, 0xa0, 0xff, 0xfe, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xec, 0xdb, 0xc1, 0xff, 0xe7, 0xd6, 0xc7, 0xff, 0xe9, 0xd8, 0xc5, 0xff, 0xf7, 0xf0, 0xe4, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xe2, 0xbf, 0x85, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xef, 0xcb, 0x88, 0x00, 0x1c, 
-  0xcb, 0x87, 0x00, 0x14, 0xcb, 0x87, 0x00, 0xdc, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x85, 0x00, 0xff, 0xc8, 0x7d, 0x00, 0xff, 0xd1, 0x95, 0x00, 0xff, 0xe6, 0xcb, 0xab, 0xff, 0xf4, 0xe7, 0xd4, 0xff, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe5, 0xd3, 0xff, 0xea, 0xd9, 0xc8, 0xff, 0xe9, 0xd9, 0xce, 0xff, 0xea, 0xd8, 0xc3, 0xff, 0xfa, 0xf5, 0xee, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9f, 0x1f, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xfb, 0xcb, 0x86, 0x00, 0x24, 
-  0xcb, 0x88, 0x00, 0x18, 0xcb, 0x87, 0x00, 0xe7, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xd5, 0x9f, 0x31, 0xff, 0xf1, 0xdf, 0xbf, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfc, 0xfa, 0xf7, 0xff, 0xea, 0xd8, 0xc1, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xda, 0xce, 0xff, 0xe6, 0xd0, 0xb4, 0xff, 0xfd, 0xfb, 0xf8, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x80, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcc, 0x8b, 0x00, 0x2b, 
-  0xca, 0x87, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x85, 0x00, 0xff, 0xc9, 0x80, 0x00, 0xff, 0xd4, 0x9c, 0x3f, 0xff, 0xe2, 0xc2, 0x9a, 0xff, 0xf5, 0xe7, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xf6, 0xee, 0xe6, 0xff, 0xe6, 0xd0, 0xb7, 0xff, 0xe9, 0xd9, 0xcd, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xea, 0xd9, 0xc4, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0xe8, 0xcc, 0xff, 0xc7, 0x7c, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0x3c, 
-  0xca, 0x87, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xf3, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x03, 0xff, 0xd2, 0x98, 0x1f, 0xff, 0xf3, 0xe6, 0xd5, 0xff, 0xfb, 0xf6, 0xef, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf5, 0xee, 0xff, 0xea, 0xd7, 0xc1, 0xff, 0xe9, 0xd8, 0xca, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xce, 0xff, 0xea, 0xd5, 0xb7, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xc5, 0x87, 0xff, 0xc9, 0x82, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x40, 
-  0xcb, 0x86, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xd1, 0x92, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xfa, 0xf7, 0xff, 0xf2, 0xe7, 0xd8, 0xff, 0xe7, 0xd6, 0xc7, 0xff, 0xe9, 0xda, 0xcd, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcb, 0xff, 0xec, 0xdb, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xa5, 0x51, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcc, 0x87, 0x00, 0x40, 
-  0xca, 0x87, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xef, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcf, 0x91, 0x13, 0xff, 0xf2, 0xe2, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xe2, 0xff, 0xec, 0xde, 0xcf, 0xff, 0xe8, 0xd6, 0xc6, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe8, 0xd6, 0xc8, 0xff, 0xef, 0xe2, 0xd0, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfb, 0xf4, 0xff, 0xce, 0x90, 0x39, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x43, 
-  0xcc, 0x86, 0x00, 0x1b, 0xcb, 0x87, 0x00, 0xeb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcf, 0x90, 0x00, 0xff, 0xe5, 0xc3, 0x82, 0xff, 0xfb, 0xf4, 0xeb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xde, 0xc7, 0xff, 0xe8, 0xd6, 0xc7, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe8, 0xd7, 0xc8, 0xff, 0xf2, 0xe7, 0xd5, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf6, 0xeb, 0xd7, 0xff, 0xcd, 0x8c, 0x20, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcd, 0x88, 0x00, 0x30, 
-  0xcb, 0x88, 0x00, 0x14, 0xcb, 0x87, 0x00, 0xdc, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xc8, 0x7d, 0x00, 0xff, 0xd6, 0x9e, 0x28, 0xff, 0xe6, 0xc9, 0xa7, 0xff, 0xf1, 0xe1, 0xcd, 0xff, 0xfa, 0xf5, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xe3, 0xff, 0xe9, 0xd6, 0xc0, 0xff, 0xe9, 0xd9, 0xcd, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcd, 0xff, 0xe7, 0xd4, 0xc2, 0xff, 0xf3, 0xe9, 0xdd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xef, 0xdd, 0xc5, 0xff, 0xcc, 0x89, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0x27, 
-  0xca, 0x85, 0x00, 0x0c, 0xcb, 0x87, 0x00, 0xcf, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcc, 0x8a, 0x00, 0xff, 0xcf, 0x93, 0x40, 0xff, 0xdf, 0xbc, 0x84, 0xff, 0xea, 0xda, 0xce, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe6, 0xd3, 0xc0, 0xff, 0xf8, 0xf1, 0xeb, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xe7, 0xcf, 0xb7, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf3, 0xcb, 0x88, 0x00, 0x20, 
-  0xca, 0x86, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xc0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xea, 0xdb, 0xce, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcd, 0xff, 0xe9, 0xd8, 0xc8, 0xff, 0xf5, 0xec, 0xe1, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xdd, 0xb5, 0x79, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xe3, 0xcb, 0x87, 0x00, 0x17, 
-  0xcb, 0x89, 0x00, 0x00, 0xcc, 0x87, 0x00, 0x9f, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x83, 0x00, 0xff, 0xe2, 0xc5, 0x9b, 0xff, 0xe9, 0xda, 0xce, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe7, 0xd5, 0xc5, 0xff, 0xf3, 0xe7, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfc, 0xfa, 0xff, 0xd3, 0x9b, 0x19, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xc8, 0xcc, 0x85, 0x00, 0x08, 
-  0xca, 0x87, 0x00, 0x00, 0xca, 0x87, 0x00, 0x63, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xd7, 0xab, 0x6f, 0xff, 0xea, 0xda, 0xce, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe4, 0xd1, 0xbb, 0xff, 0xda, 0xc5, 0xaa, 0xff, 0xf2, 0xe8, 0xd8, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xca, 0x81, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xac, 0xc8, 0x89, 0x00, 0x00, 
-  0xca, 0x87, 0x00, 0x00, 0xca, 0x86, 0x00, 0x23, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xd0, 0x98, 0x4e, 0xff, 0xe8, 0xd6, 0xc5, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe3, 0xce, 0xb5, 0xff, 0xdb, 0xc8, 0xb2, 0xff, 0xd9, 0xc2, 0xa4, 0xff, 0xeb, 0xe0, 0xcf, 0xff, 0xfd, 0xfa, 0xf5, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe5, 0xc9, 0xff, 0xc8, 0x7d, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x6f, 0xcb, 0x86, 0x00, 0x00, 
-  0xd8, 0xae, 0x00, 0x00, 0xc9, 0x7b, 0x00, 0x00, 0xcc, 0x87, 0x00, 0xec, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcd, 0x8c, 0x00, 0xff, 0xe5, 0xcf, 0xb8, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe1, 0xcc, 0xb2, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdb, 0xc7, 0xaf, 0xff, 0xe0, 0xcb, 0xae, 0xff, 0xfc, 0xfa, 0xf6, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xc0, 0x7a, 0xff, 0xc9, 0x82, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xc8, 0x89, 0x00, 0x18, 0xc9, 0x88, 0x00, 0x00, 
-  0x9e, 0x9e, 0x00, 0x00, 0xcb, 0x89, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x74, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x84, 0x00, 0xff, 0xe0, 0xc3, 0xa4, 0xff, 0xe9, 0xda, 0xcd, 0xff, 0xe1, 0xcb, 0xb1, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xd3, 0xa2, 0x46, 0xff, 0xf5, 0xe9, 0xd8, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x9c, 0x23, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xdb, 0xc8, 0x80, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xcb, 0x8a, 0x00, 0x00, 0xcb, 0x89, 0x00, 0x14, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xd5, 0xa3, 0x48, 0xff, 0xea, 0xdb, 0xd0, 0xff, 0xe0, 0xcb, 0xb2, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdc, 0xcb, 0xb7, 0xff, 0xd2, 0xa4, 0x5b, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcc, 0x8a, 0x00, 0xff, 0xe6, 0xc7, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfb, 0xf3, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x58, 0xcb, 0x88, 0x00, 0x00, 0x74, 0x74, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x88, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xbf, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x84, 0x00, 0xff, 0xea, 0xdc, 0xd0, 0xff, 0xe1, 0xcc, 0xb4, 0xff, 0xdb, 0xc8, 0xb1, 0xff, 0xdb, 0xc9, 0xb3, 0xff, 0xd1, 0xa1, 0x47, 0xff, 0xca, 0x84, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x83, 0x00, 0xff, 0xd7, 0xa5, 0x42, 0xff, 0xfc, 0xf8, 0xf1, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf4, 0xe6, 0xcb, 0xff, 0xca, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xe8, 0xca, 0x87, 0x00, 0x08, 0xcc, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x8b, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x5f, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xc9, 0x82, 0x00, 0xff, 0xe1, 0xc2, 0x93, 0xff, 0xe1, 0xd0, 0xbe, 0xff, 0xdc, 0xca, 0xb3, 0xff, 0xd2, 0xa4, 0x60, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0xca, 0x84, 0x00, 0xff, 0xd3, 0x9c, 0x43, 0xff, 0xf2, 0xe1, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xea, 0xd2, 0xaf, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x97, 0xc9, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x83, 0x00, 0x00, 0xd1, 0x9b, 0x00, 0x00, 0xcb, 0x88, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xd1, 0x99, 0x3d, 0xff, 0xdc, 0xbe, 0x8b, 0xff, 0xd0, 0x98, 0x3b, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcc, 0x8a, 0x11, 0xff, 0xe7, 0xca, 0x9f, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xe1, 0xbf, 0xa0, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x88, 0x00, 0x2f, 0xcb, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x80, 0x00, 0x00, 0xca, 0x87, 0x00, 0x00, 0xca, 0x88, 0x00, 0x54, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x82, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xc9, 0x7f, 0x00, 0xff, 0xdf, 0xb9, 0x77, 0xff, 0xfa, 0xf3, 0xeb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xf7, 0xf0, 0xff, 0xd4, 0x9f, 0x48, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0x9f, 0xc6, 0x88, 0x00, 0x00, 0xb5, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x7b, 0x00, 0x00, 0xce, 0x82, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xb0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x02, 0xff, 0xca, 0x83, 0x00, 0xff, 0xd1, 0x96, 0x35, 0xff, 0xdf, 0xb9, 0x8a, 0xff, 0xd8, 0xaa, 0x71, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xec, 0xcb, 0x85, 0x00, 0x08, 0xce, 0x85, 0x00, 0x00, 0x47, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x30, 0xcb, 0x87, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xc9, 0x87, 0x00, 0x5c, 0xc6, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x83, 0x00, 0x00, 0xcb, 0x86, 0x00, 0x80, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xbb, 0xff, 0x00, 0x00, 0x00, 0xc8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x86, 0x00, 0x00, 0xcd, 0x87, 0x00, 0x00, 0xcc, 0x86, 0x00, 0xa4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf3, 0xd0, 0x74, 0x00, 0x04, 0xcc, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6f, 0x00, 0x00, 0xcd, 0x8e, 0x00, 0x10, 0xcb, 0x87, 0x00, 0xdb, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf3, 0xca, 0x86, 0x00, 0x2f, 0xca, 0x7f, 0x00, 0x00, 0xcc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa4, 0x00, 0x00, 0xcc, 0x8c, 0x00, 0x00, 0xcb, 0x8a, 0x00, 0x20, 0xcb, 0x87, 0x00, 0xf7, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xca, 0x87, 0x00, 0x4f, 0xcb, 0x89, 0x00, 0x00, 0xca, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x8c, 0x00, 0x00, 0xd1, 0x8d, 0x00, 0x00, 0xd0, 0x8a, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xef, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x88, 0x00, 0x5c, 0xcb, 0x88, 0x00, 0x00, 0xca, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x8b, 0x00, 0x00, 0xd0, 0x87, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x3b, 0xcb, 0x88, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcc, 0x87, 0x00, 0x63, 0xca, 0x8a, 0x00, 0x00, 0xcb, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x8a, 0x00, 0x00, 0xd3, 0x80, 0x00, 0x00, 0xd1, 0x83, 0x00, 0x14, 0xcb, 0x87, 0x00, 0xe4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcd, 0x86, 0x00, 0x47, 0xcd, 0x85, 0x00, 0x00, 0xcd, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0x80, 0x00, 0x00, 0xd2, 0x82, 0x00, 0x00, 0xcd, 0x89, 0x00, 0x18, 0xcb, 0x87, 0x00, 0xc3, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xdc, 0xc9, 0x88, 0x00, 0x3b, 0xcd, 0x86, 0x00, 0x00, 0xcd, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x3c, 0x00, 0x00, 0xcc, 0x87, 0x00, 0x00, 0xcb, 0x85, 0x00, 0x08, 0xcb, 0x86, 0x00, 0x70, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xa7, 0xca, 0x86, 0x00, 0x14, 0xc5, 0x84, 0x00, 0x00, 0xc9, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x89, 0x00, 0x00, 0xc9, 0x7e, 0x00, 0x00, 0xcd, 0x88, 0x00, 0x3b, 0xcb, 0x87, 0x00, 0xe0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x86, 0x00, 0x63, 0xc8, 0x8b, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x73, 0x00, 0x00, 0xcc, 0x88, 0x00, 0x00, 0xc2, 0x96, 0x00, 0x04, 0xcb, 0x87, 0x00, 0x63, 0xcb, 0x87, 0x00, 0xdf, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0x7c, 0xcc, 0x88, 0x00, 0x18, 0xcb, 0x86, 0x00, 0x00, 0x6e, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1a, 0x00, 0x00, 0xc9, 0x88, 0x00, 0x00, 0xc7, 0x85, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x03, 0xcc, 0x88, 0x00, 0x57, 0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xfc, 0xca, 0x87, 0x00, 0x83, 0xd3, 0xa1, 0x00, 0x07, 0xb8, 0x2d, 0x00, 0x00, 0xc7, 0x77, 0x00, 0x00, 0x4d, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x88, 0x00, 0x00, 0xcb, 0x88, 0x00, 0x00, 0xd2, 0x85, 0x00, 0x00, 0xca, 0x87, 0x00, 0x48, 0xcb, 0x87, 0x00, 0x9c, 0xcb, 0x87, 0x00, 0xd0, 0xcb, 0x87, 0x00, 0xf4, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0xd4, 0xcb, 0x87, 0x00, 0xab, 0xcc, 0x87, 0x00, 0x5c, 0xd2, 0x6f, 0x00, 0x00, 0xca, 0x87, 0x00, 0x00, 0xd6, 0xa9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x89, 0x00, 0x00, 0xc3, 0x89, 0x00, 0x00, 0xca, 0x87, 0x00, 0x00, 0xce, 0x8d, 0x00, 0x00, 0xcc, 0x88, 0x00, 0x0f, 0xcb, 0x87, 0x00, 0x1c, 0xcb, 0x87, 0x00, 0x3f, 0xcc, 0x88, 0x00, 0x7f, 0xcb, 0x87, 0x00, 0xa8, 0xcb, 0x87, 0x00, 0xd0, 0xcb, 0x87, 0x00, 0xf3, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xcb, 0x87, 0x00, 0xfc, 0xca, 0x87, 0x00, 0xeb, 0xcb, 0x87, 0x00, 0xd8, 0xcb, 0x88, 0x00, 0xaf, 0xcc, 0x87, 0x00, 0x7f, 0xcb, 0x88, 0x00, 0x4f, 0xce, 0x86, 0x00, 0x20, 0xcb, 0x87, 0x00, 0x10, 0xb7, 0x9c, 0x00, 0x00, 0xca, 0x82, 0x00, 0x00, 0xca, 0x8a, 0x00, 0x00, 0xca, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x00, 0x00, 0x10, 0xcb, 0x86, 0x00, 0x13, 0xcc, 0x87, 0x00, 0x23, 0xca, 0x87, 0x00, 0x43, 0xca, 0x88, 0x00, 0x70, 0xcb, 0x87, 0x00, 0x9f, 0xcb, 0x88, 
+  0x00, 0xb8, 0xcb, 0x88, 0x00, 0xcc, 0xcb, 0x87, 0x00, 0xe0, 0xcb, 0x87, 0x00, 0xdb, 0xca, 0x87, 0x00, 0xcb, 0xcb, 0x87, 0x00, 0xbc, 0xcb, 0x87, 0x00, 0x9f, 0xcb, 0x87, 0x00, 0x74, 0xcb, 0x87, 
+  0x00, 0x48, 0xcb, 0x87, 0x00, 0x24, 0xcb, 0x88, 0x00, 0x14, 0xc8, 0x8a, 0x00, 0x04, 0xab, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcd, 0x86, 0x00, 0x13, 0xcb, 0x87, 0x00, 0x73, 0xcb, 0x87, 0x00, 0xb3, 
+  0xcb, 0x87, 0x00, 0xd7, 0xcb, 0x87, 0x00, 0xfc, 0x8c, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 0xdc, 0xcb, 0x87, 0x00, 0xbb, 0xcc, 0x87, 0x00, 0x7c, 0xc9, 0x86, 0x00, 0x23, 0xa7, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xcd, 0x88, 0x00, 0x27, 0xcb, 0x87, 0x00, 0xb3, 0x95, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xd3, 0xcc, 0x86, 0x00, 0x38, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0xca, 0x87, 0x00, 0x43, 0xcb, 0x87, 0x00, 0xab, 0x99, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xc4, 0xcb, 0x88, 0x00, 0x58, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc1, 0x82, 0x00, 0x07, 
+  0xcb, 0x87, 0x00, 0xb7, 0xcb, 0x87, 0x00, 0xfb, 0x9b, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0xd4, 0xcb, 0x89, 0x00, 0x2c, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0xcb, 0x87, 0x00, 0x4c, 0xcb, 0x87, 0x00, 0xfb, 0xa0, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0x70, 0xcb, 0x89, 0x00, 0x08, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd9, 0x80, 0x00, 0x04, 
+  0xcb, 0x87, 0x00, 0x9f, 0xa3, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xc0, 0xcc, 0x86, 0x00, 0x1f, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x9f, 0x00, 0x07, 0xcb, 0x87, 0x00, 0xc8, 
+  0xa5, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xec, 0xd0, 0x87, 0x00, 0x1b, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc9, 0x8a, 0x00, 0x20, 0xcb, 0x87, 0x00, 0xd3, 0xa7, 0xcb, 0x87, 0x00, 
+  0xff, 0x01, 0xcb, 0x87, 0x00, 0xf8, 0xcb, 0x87, 0x00, 0x48, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc6, 0x83, 0x00, 0x10, 0xcb, 0x87, 0x00, 0xe0, 0xa9, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 
+  0x00, 0xf8, 0xcc, 0x88, 0x00, 0x34, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0x8e, 0x00, 0x0c, 0xcb, 0x88, 0x00, 0xdb, 0xab, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xca, 0x87, 0x00, 0xff, 0xcc, 0x86, 
+  0x00, 0x34, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x86, 0x00, 0x0b, 0xcb, 0x87, 0x00, 0xc4, 0xad, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xec, 0xcc, 0x88, 0x00, 0x1f, 0x8d, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x87, 0xaf, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0xd3, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x88, 0x00, 0x5f, 0xb1, 0xcb, 0x87, 0x00, 
+  0xff, 0x00, 0xcb, 0x87, 0x00, 0xa8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x87, 0x00, 0x24, 0xcb, 0x87, 0x00, 0xef, 0xb1, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xfb, 0xcc, 0x88, 
+  0x00, 0x4b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x9c, 0xb3, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xd7, 0xce, 0x8a, 0x00, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xcc, 0x86, 0x00, 0x38, 0xb5, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x88, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xdf, 0xb6, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xc8, 0x86, 
+  0x00, 0x18, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x50, 0xa7, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x86, 0x00, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xc9, 0x80, 0x00, 0xff, 0x8c, 0xcb, 
+  0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcc, 0x86, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xaf, 0xa5, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xcb, 0x87, 0x01, 0xff, 
+  0xca, 0x84, 0x00, 0xff, 0xcf, 0x8f, 0x00, 0xff, 0xe6, 0xc7, 0x8b, 0xff, 0xe9, 0xcd, 0x9a, 0xff, 0xcd, 0x8b, 0x00, 0xff, 0x8b, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xdb, 0xcc, 0x87, 
+  0x00, 0x08, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x86, 0x00, 0x10, 0xcb, 0x87, 0x00, 0xf4, 0xa2, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xca, 0x86, 0x00, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xd0, 0x92, 
+  0x19, 0xff, 0xdb, 0xb2, 0x81, 0xff, 0xee, 0xd9, 0xb4, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xe0, 0xb9, 0x82, 0xff, 0xca, 0x85, 0x00, 0xff, 0x8b, 0xcb, 0x87, 0x00, 
+  0xff, 0x00, 0xcb, 0x86, 0x00, 0x3b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x87, 0x00, 0x6b, 0xa1, 0xcb, 0x87, 0x00, 0xff, 0x06, 0xca, 0x85, 0x00, 0xff, 0xc7, 0x7c, 0x00, 0xff, 0xd4, 0x99, 
+  0x00, 0xff, 0xed, 0xda, 0xbe, 0xff, 0xf8, 0xf1, 0xe7, 0xff, 0xfe, 0xfd, 0xfa, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x81, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xc5, 0x8e, 0xff, 
+  0xca, 0x83, 0x00, 0xff, 0x8b, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x88, 0x00, 0xc4, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xdb, 0x9e, 0xcb, 0x87, 0x00, 0xff, 0x06, 0xcb, 0x86, 
+  0x00, 0xff, 0xcb, 0x87, 0x00, 0xff, 0xce, 0x90, 0x2f, 0xff, 0xd9, 0xab, 0x64, 0xff, 0xf5, 0xe6, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0xb2, 0x77, 0xff, 0xca, 0x86, 0x00, 0xff, 0x8c, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xbf, 0x7f, 0x00, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x87, 0x00, 0x13, 
+  0x9c, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xcb, 0x87, 0x01, 0xff, 0xc9, 0x83, 0x00, 0xff, 0xc9, 0x7e, 0x00, 0xff, 0xd9, 0xa7, 0x4f, 0xff, 0xea, 0xd4, 0xb9, 0xff, 0xf7, 0xee, 0xdc, 0xff, 0x81, 0xff, 
+  0xff, 0xff, 0xff, 0x81, 0xfe, 0xfd, 0xfc, 0xff, 0x00, 0xff, 0xfe, 0xfe, 0xff, 0x83, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xfd, 0xfb, 0xf6, 0xff, 0xd3, 0x9e, 0x60, 0xff, 0x8d, 0xcb, 0x87, 0x00, 0xff, 
+  0x00, 0xcb, 0x88, 0x00, 0x58, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x60, 0x9b, 0xcb, 0x87, 0x00, 0xff, 0x04, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x83, 0x00, 0xff, 0xdf, 0xb4, 0x62, 
+  0xff, 0xf9, 0xf2, 0xe6, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0x83, 0xfe, 0xfd, 0xfc, 0xff, 0x03, 0xfe, 0xfd, 0xfd, 0xff, 0xfc, 0xf9, 0xf7, 0xff, 0xf6, 0xf0, 0xe5, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x82, 
+  0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xf8, 0xf0, 0xe3, 0xff, 0xd0, 0x94, 0x33, 0xff, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0xa4, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 
+  0x98, 0x97, 0xcb, 0x87, 0x00, 0xff, 0x07, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x83, 0x00, 0xff, 0xcd, 0x89, 0x00, 0xff, 0xd8, 0xa8, 0x6d, 0xff, 0xe8, 0xcd, 0xa7, 0xff, 0xfc, 0xf8, 0xed, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 0xff, 0x05, 0xff, 0xfe, 0xfe, 0xff, 0xfb, 0xf7, 0xf1, 0xff, 0xf2, 0xe8, 0xdd, 0xff, 0xe7, 0xd3, 0xbc, 0xff, 0xf3, 0xe7, 0xd5, 
+  0xff, 0xff, 0xfe, 0xfe, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xf4, 0xe8, 0xda, 0xff, 0xcd, 0x8a, 0x00, 0xff, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 0xc3, 0xca, 0x86, 0x00, 
+  0x04, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xbb, 0x95, 0xcb, 0x87, 0x00, 0xff, 0x07, 0xcb, 0x87, 0x01, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xcc, 0x88, 0x00, 0xff, 0xe5, 0xc3, 0x88, 0xff, 0xf7, 
+  0xef, 0xe6, 0xff, 0xfc, 0xf9, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0x83, 0xfe, 0xfd, 0xfc, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xe2, 0xff, 0xeb, 0xda, 0xcb, 
+  0xff, 0xe8, 0xd6, 0xc2, 0xff, 0xf7, 0xf0, 0xe7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x83, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xee, 0xdd, 0xca, 0xff, 0xca, 0x84, 0x00, 0xff, 0x8d, 0xcb, 0x87, 0x00, 0xff, 
+  0x03, 0xcb, 0x87, 0x00, 0xdb, 0xca, 0x87, 0x00, 0x13, 0xca, 0x87, 0x00, 0x0c, 0xcb, 0x87, 0x00, 0xd0, 0x92, 0xcb, 0x87, 0x00, 0xff, 0x06, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcd, 
+  0x8d, 0x17, 0xff, 0xd4, 0x9f, 0x58, 0xff, 0xeb, 0xd0, 0xa0, 0xff, 0xfe, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xfe, 0xfd, 0xfc, 0xff, 0x06, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xfb, 0xf9, 
+  0xff, 0xec, 0xdb, 0xc1, 0xff, 0xe7, 0xd6, 0xc7, 0xff, 0xe9, 0xd8, 0xc5, 0xff, 0xf7, 0xf0, 0xe4, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xfe, 0xfe, 0xff, 0xe2, 
+  0xbf, 0x85, 0xff, 0xca, 0x85, 0x00, 0xff, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 0xef, 0xcb, 0x88, 0x00, 0x1c, 0xcb, 0x87, 0x00, 0x14, 0xcb, 0x87, 0x00, 0xdc, 0x90, 0xcb, 0x87, 
+  0x00, 0xff, 0x07, 0xca, 0x85, 0x00, 0xff, 0xc8, 0x7d, 0x00, 0xff, 0xd1, 0x95, 0x00, 0xff, 0xe6, 0xcb, 0xab, 0xff, 0xf4, 0xe7, 0xd4, 0xff, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
+  0xfd, 0xfd, 0xff, 0x85, 0xfe, 0xfd, 0xfc, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe5, 0xd3, 0xff, 0xea, 0xd9, 0xc8, 0xff, 0xe9, 0xd9, 0xce, 0xff, 0xea, 0xd8, 0xc3, 0xff, 0xfa, 0xf5, 0xee, 
+  0xff, 0xff, 0xfe, 0xfe, 0xff, 0x84, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9f, 0x1f, 0xff, 0xcb, 0x86, 0x00, 0xff, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 
+  0xfb, 0xcb, 0x86, 0x00, 0x24, 0xcb, 0x88, 0x00, 0x18, 0xcb, 0x87, 0x00, 0xe7, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x86, 0x00, 0xff, 0xd5, 0x9f, 0x31, 0xff, 0xf1, 0xdf, 0xbf, 0xff, 0xff, 
+  0xfe, 0xff, 0xff, 0x89, 0xfe, 0xfd, 0xfc, 0xff, 0x05, 0xfc, 0xfa, 0xf7, 0xff, 0xea, 0xd8, 0xc1, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xda, 0xce, 0xff, 0xe6, 0xd0, 0xb4, 0xff, 0xfd, 0xfb, 0xf8, 
+  0xff, 0x86, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xca, 0x80, 0x00, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcc, 0x8b, 0x00, 0x2b, 0xca, 0x87, 0x00, 0x1f, 0xcb, 0x87, 0x00, 
+  0xf0, 0x8b, 0xcb, 0x87, 0x00, 0xff, 0x04, 0xca, 0x85, 0x00, 0xff, 0xc9, 0x80, 0x00, 0xff, 0xd4, 0x9c, 0x3f, 0xff, 0xe2, 0xc2, 0x9a, 0xff, 0xf5, 0xe7, 0xce, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 
+  0x87, 0xfe, 0xfd, 0xfc, 0xff, 0x07, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xf6, 0xee, 0xe6, 0xff, 0xe6, 0xd0, 0xb7, 0xff, 0xe9, 0xd9, 0xcd, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xea, 0xd9, 
+  0xc4, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0x86, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0xe8, 0xcc, 0xff, 0xc7, 0x7c, 0x00, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x86, 
+  0x00, 0x3c, 0xca, 0x87, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xf3, 0x8a, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xcb, 0x86, 0x03, 0xff, 0xd2, 0x98, 0x1f, 0xff, 0xf3, 0xe6, 0xd5, 0xff, 0xfb, 0xf6, 0xef, 0xff, 
+  0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x88, 0xfe, 0xfd, 0xfc, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf5, 0xee, 0xff, 0xea, 0xd7, 0xc1, 0xff, 0xe9, 0xd8, 0xca, 0xff, 0xe9, 0xd9, 
+  0xcc, 0xff, 0xe9, 0xd9, 0xce, 0xff, 0xea, 0xd5, 0xb7, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0x87, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xc5, 0x87, 0xff, 0xc9, 0x82, 0x00, 0xff, 
+  0x8f, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0x40, 0xcb, 0x86, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xf0, 0x89, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x86, 0x00, 0xff, 0xd1, 0x92, 0x00, 0xff, 
+  0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x89, 0xfe, 0xfd, 0xfc, 0xff, 0x08, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xfa, 0xf7, 0xff, 0xf2, 0xe7, 0xd8, 0xff, 0xe7, 0xd6, 0xc7, 0xff, 0xe9, 0xda, 
+  0xcd, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe9, 0xd9, 0xcb, 0xff, 0xec, 0xdb, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xa5, 0x51, 0xff, 
+  0xca, 0x85, 0x00, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcc, 0x87, 0x00, 0x40, 0xca, 0x87, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xef, 0x89, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x86, 0x00, 0xff, 
+  0xcf, 0x91, 0x13, 0xff, 0xf2, 0xe2, 0xc7, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfd, 0xff, 0x86, 0xfe, 0xfd, 0xfc, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xe2, 0xff, 
+  0xec, 0xde, 0xcf, 0xff, 0xe8, 0xd6, 0xc6, 0xff, 0x81, 0xe9, 0xd9, 0xcc, 0xff, 0x02, 0xe8, 0xd6, 0xc8, 0xff, 0xef, 0xe2, 0xd0, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0x89, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 
+  0xfd, 0xfb, 0xf4, 0xff, 0xce, 0x90, 0x39, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0x43, 0xcc, 0x86, 0x00, 0x1b, 0xcb, 0x87, 0x00, 0xeb, 0x8b, 0xcb, 0x87, 0x00, 0xff, 0x04, 
+  0xcb, 0x86, 0x00, 0xff, 0xcf, 0x90, 0x00, 0xff, 0xe5, 0xc3, 0x82, 0xff, 0xfb, 0xf4, 0xeb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0x84, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xee, 0xde, 
+  0xc7, 0xff, 0xe8, 0xd6, 0xc7, 0xff, 0x82, 0xe9, 0xd9, 0xcc, 0xff, 0x02, 0xe8, 0xd7, 0xc8, 0xff, 0xf2, 0xe7, 0xd5, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x8a, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xf6, 0xeb, 
+  0xd7, 0xff, 0xcd, 0x8c, 0x20, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcd, 0x88, 0x00, 0x30, 0xcb, 0x88, 0x00, 0x14, 0xcb, 0x87, 0x00, 0xdc, 0x8c, 0xcb, 0x87, 0x00, 0xff, 0x0a, 0xcb, 0x86, 
+  0x00, 0xff, 0xc9, 0x81, 0x00, 0xff, 0xc8, 0x7d, 0x00, 0xff, 0xd6, 0x9e, 0x28, 0xff, 0xe6, 0xc9, 0xa7, 0xff, 0xf1, 0xe1, 0xcd, 0xff, 0xfa, 0xf5, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xee, 
+  0xe3, 0xff, 0xe9, 0xd6, 0xc0, 0xff, 0xe9, 0xd9, 0xcd, 0xff, 0x81, 0xe9, 0xd9, 0xcc, 0xff, 0x03, 0xe9, 0xd9, 0xcd, 0xff, 0xe7, 0xd4, 0xc2, 0xff, 0xf3, 0xe9, 0xdd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 
+  0x8b, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xef, 0xdd, 0xc5, 0xff, 0xcc, 0x89, 0x00, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xcb, 0x86, 0x00, 0x27, 0xca, 0x85, 0x00, 0x0c, 0xcb, 0x87, 0x00, 0xcf, 
+  0x8f, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xcb, 0x86, 0x00, 0xff, 0xca, 0x85, 0x00, 0xff, 0xcc, 0x8a, 0x00, 0xff, 0xcf, 0x93, 0x40, 0xff, 0xdf, 0xbc, 0x84, 0xff, 0xea, 0xda, 0xce, 0xff, 0x83, 0xe9, 
+  0xd9, 0xcc, 0xff, 0x01, 0xe6, 0xd3, 0xc0, 0xff, 0xf8, 0xf1, 0xeb, 0xff, 0x8d, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xe7, 0xcf, 0xb7, 0xff, 0xcb, 0x86, 0x00, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x03, 
+  0xcb, 0x87, 0x00, 0xf3, 0xcb, 0x88, 0x00, 0x20, 0xca, 0x86, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xc0, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x86, 0x00, 0xff, 0xea, 0xdb, 0xce, 0xff, 0x81, 0xe9, 
+  0xd9, 0xcc, 0xff, 0x03, 0xe9, 0xd9, 0xcd, 0xff, 0xe9, 0xd8, 0xc8, 0xff, 0xf5, 0xec, 0xe1, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x8c, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xfe, 0xfc, 0xfb, 0xff, 0xdd, 0xb5, 
+  0x79, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 0xe3, 0xcb, 0x87, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x87, 0x00, 0x9f, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x06, 0xca, 0x83, 
+  0x00, 0xff, 0xe2, 0xc5, 0x9b, 0xff, 0xe9, 0xda, 0xce, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe7, 0xd5, 0xc5, 0xff, 0xf3, 0xe7, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 
+  0xfe, 0xfc, 0xfa, 0xff, 0xd3, 0x9b, 0x19, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 0xc8, 0xcc, 0x85, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xca, 0x87, 0x00, 0x63, 0x93, 0xcb, 
+  0x87, 0x00, 0xff, 0x06, 0xcb, 0x86, 0x00, 0xff, 0xd7, 0xab, 0x6f, 0xff, 0xea, 0xda, 0xce, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe4, 0xd1, 0xbb, 0xff, 0xda, 0xc5, 0xaa, 0xff, 0xf2, 0xe8, 0xd8, 0xff, 
+  0x8d, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xfd, 0xfb, 0xf9, 0xff, 0xca, 0x81, 0x00, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0xac, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x86, 
+  0x00, 0x23, 0x94, 0xcb, 0x87, 0x00, 0xff, 0x08, 0xd0, 0x98, 0x4e, 0xff, 0xe8, 0xd6, 0xc5, 0xff, 0xe9, 0xd9, 0xcc, 0xff, 0xe3, 0xce, 0xb5, 0xff, 0xdb, 0xc8, 0xb2, 0xff, 0xd9, 0xc2, 0xa4, 0xff, 
+  0xeb, 0xe0, 0xcf, 0xff, 0xfd, 0xfa, 0xf5, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x89, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe5, 0xc9, 0xff, 0xc8, 0x7d, 0x00, 0xff, 0x90, 0xcb, 
+  0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x6f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x87, 0x00, 0xec, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcd, 0x8c, 0x00, 0xff, 0xe5, 0xcf, 0xb8, 0xff, 
+  0xe9, 0xd9, 0xcc, 0xff, 0xe1, 0xcc, 0xb2, 0xff, 0x81, 0xdb, 0xc8, 0xb1, 0xff, 0x03, 0xdb, 0xc7, 0xaf, 0xff, 0xe0, 0xcb, 0xae, 0xff, 0xfc, 0xfa, 0xf6, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0x88, 0xfe, 
+  0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xc0, 0x7a, 0xff, 0xc9, 0x82, 0x00, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xc8, 0x89, 0x00, 0x18, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xcb, 0x87, 0x00, 0x74, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xca, 0x84, 0x00, 0xff, 0xe0, 0xc3, 0xa4, 0xff, 0xe9, 0xda, 0xcd, 0xff, 0xe1, 0xcb, 0xb1, 0xff, 0x83, 0xdb, 0xc8, 0xb1, 0xff, 0x01, 
+  0xd3, 0xa2, 0x46, 0xff, 0xf5, 0xe9, 0xd8, 0xff, 0x88, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x9c, 0x23, 0xff, 0xca, 0x85, 0x00, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x00, 
+  0xcb, 0x87, 0x00, 0xdb, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x89, 0x00, 0x14, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x86, 0x00, 0xff, 0xd5, 0xa3, 0x48, 0xff, 0xea, 0xdb, 0xd0, 0xff, 
+  0xe0, 0xcb, 0xb2, 0xff, 0x81, 0xdb, 0xc8, 0xb1, 0xff, 0x06, 0xdc, 0xcb, 0xb7, 0xff, 0xd2, 0xa4, 0x5b, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcc, 0x8a, 0x00, 0xff, 0xe6, 0xc7, 0x96, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0x85, 0xfe, 0xfd, 0xfc, 0xff, 0x01, 0xfd, 0xfb, 0xf3, 0xff, 0xcb, 0x86, 0x00, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x58, 0x83, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xcc, 0x88, 0x00, 0x04, 0xcb, 0x87, 0x00, 0xbf, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x06, 0xcb, 0x84, 0x00, 0xff, 0xea, 0xdc, 0xd0, 0xff, 0xe1, 0xcc, 0xb4, 0xff, 0xdb, 0xc8, 
+  0xb1, 0xff, 0xdb, 0xc9, 0xb3, 0xff, 0xd1, 0xa1, 0x47, 0xff, 0xca, 0x84, 0x00, 0xff, 0x81, 0xcb, 0x87, 0x00, 0xff, 0x02, 0xca, 0x83, 0x00, 0xff, 0xd7, 0xa5, 0x42, 0xff, 0xfc, 0xf8, 0xf1, 0xff, 
+  0x84, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xfe, 0xfd, 0xfd, 0xff, 0xf4, 0xe6, 0xcb, 0xff, 0xca, 0x86, 0x00, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xe8, 0xca, 0x87, 0x00, 0x08, 
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0x5f, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x06, 0xc9, 0x82, 0x00, 0xff, 0xe1, 0xc2, 0x93, 0xff, 0xe1, 0xd0, 0xbe, 0xff, 0xdc, 0xca, 0xb3, 0xff, 
+  0xd2, 0xa4, 0x60, 0xff, 0xcb, 0x86, 0x00, 0xff, 0xcb, 0x87, 0x01, 0xff, 0x81, 0xcb, 0x87, 0x00, 0xff, 0x04, 0xcb, 0x87, 0x01, 0xff, 0xca, 0x84, 0x00, 0xff, 0xd3, 0x9c, 0x43, 0xff, 0xf2, 0xe1, 
+  0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 0xff, 0x02, 0xfe, 0xfe, 0xfd, 0xff, 0xea, 0xd2, 0xaf, 0xff, 0xcb, 0x86, 0x00, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 
+  0x00, 0x97, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x88, 0x00, 0xf0, 0x92, 0xcb, 0x87, 0x00, 0xff, 0x04, 0xcb, 0x86, 0x00, 0xff, 0xd1, 0x99, 0x3d, 0xff, 0xdc, 0xbe, 0x8b, 0xff, 0xd0, 0x98, 
+  0x3b, 0xff, 0xcb, 0x86, 0x00, 0xff, 0x85, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x86, 0x00, 0xff, 0xcc, 0x8a, 0x11, 0xff, 0xe7, 0xca, 0x9f, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0x82, 0xfe, 0xfd, 0xfc, 
+  0xff, 0x00, 0xe1, 0xbf, 0xa0, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xca, 0x88, 0x00, 0x2f, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x88, 0x00, 0x54, 0x93, 0xcb, 0x87, 0x00, 0xff, 0x02, 
+  0xcb, 0x86, 0x00, 0xff, 0xca, 0x82, 0x00, 0xff, 0xcb, 0x86, 0x00, 0xff, 0x88, 0xcb, 0x87, 0x00, 0xff, 0x05, 0xc9, 0x7f, 0x00, 0xff, 0xdf, 0xb9, 0x77, 0xff, 0xfa, 0xf3, 0xeb, 0xff, 0xff, 0xff, 
+  0xfe, 0xff, 0xfb, 0xf7, 0xf0, 0xff, 0xd4, 0x9f, 0x48, 0xff, 0x8f, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0x9f, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x87, 0x00, 0xb0, 0x9e, 0xcb, 
+  0x87, 0x00, 0xff, 0x05, 0xcb, 0x87, 0x02, 0xff, 0xca, 0x83, 0x00, 0xff, 0xd1, 0x96, 0x35, 0xff, 0xdf, 0xb9, 0x8a, 0xff, 0xd8, 0xaa, 0x71, 0xff, 0xcb, 0x86, 0x00, 0xff, 0x8e, 0xcb, 0x87, 0x00, 
+  0xff, 0x01, 0xcb, 0x87, 0x00, 0xec, 0xcb, 0x85, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x87, 0x00, 0x30, 0xcb, 0x87, 0x00, 0xf4, 0xa0, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x86, 
+  0x00, 0xff, 0x90, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xc9, 0x87, 0x00, 0x5c, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x86, 0x00, 0x80, 0xb1, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcb, 0x87, 0x00, 0xbb, 
+  0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x86, 0x00, 0xa4, 0xaf, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xf3, 0xd0, 0x74, 0x00, 0x04, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0x8e, 
+  0x00, 0x10, 0xcb, 0x87, 0x00, 0xdb, 0xad, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xf3, 0xca, 0x86, 0x00, 0x2f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x8a, 0x00, 0x20, 0xcb, 0x87, 
+  0x00, 0xf7, 0xac, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xca, 0x87, 0x00, 0x4f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0x8a, 0x00, 0x1f, 0xcb, 0x87, 0x00, 0xef, 0xaa, 0xcb, 0x87, 0x00, 0xff, 0x00, 
+  0xcb, 0x88, 0x00, 0x5c, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x87, 0x00, 0x3b, 0xcb, 0x88, 0x00, 0xf4, 0xa8, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcc, 0x87, 0x00, 0x63, 0x94, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xd1, 0x83, 0x00, 0x14, 0xcb, 0x87, 0x00, 0xe4, 0xa6, 0xcb, 0x87, 0x00, 0xff, 0x00, 0xcd, 0x86, 0x00, 0x47, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0x89, 0x00, 0x18, 0xcb, 0x87, 
+  0x00, 0xc3, 0xa3, 0xcb, 0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xdc, 0xc9, 0x88, 0x00, 0x3b, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcb, 0x85, 0x00, 0x08, 0xcb, 0x86, 0x00, 0x70, 0xa1, 0xcb, 
+  0x87, 0x00, 0xff, 0x01, 0xcb, 0x87, 0x00, 0xa7, 0xca, 0x86, 0x00, 0x14, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0x88, 0x00, 0x3b, 0xcb, 0x87, 0x00, 0xe0, 0x9d, 0xcb, 0x87, 0x00, 0xff, 0x01, 
+  0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x86, 0x00, 0x63, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc2, 0x96, 0x00, 0x04, 0xcb, 0x87, 0x00, 0x63, 0xcb, 0x87, 0x00, 0xdf, 0x99, 0xcb, 0x87, 0x00, 0xff, 0x02, 
+  0xcb, 0x87, 0x00, 0xf0, 0xcb, 0x87, 0x00, 0x7c, 0xcc, 0x88, 0x00, 0x18, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x87, 0x00, 0x03, 0xcc, 0x88, 0x00, 0x57, 0xcb, 0x87, 0x00, 0xf0, 0x95, 0xcb, 
+  0x87, 0x00, 0xff, 0x02, 0xcb, 0x87, 0x00, 0xfc, 0xca, 0x87, 0x00, 0x83, 0xd3, 0xa1, 0x00, 0x07, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xca, 0x87, 0x00, 0x48, 0xcb, 0x87, 0x00, 0x9c, 0xcb, 0x87, 
+  0x00, 0xd0, 0xcb, 0x87, 0x00, 0xf4, 0x8d, 0xcb, 0x87, 0x00, 0xff, 0x03, 0xcb, 0x87, 0x00, 0xfc, 0xcb, 0x87, 0x00, 0xd4, 0xcb, 0x87, 0x00, 0xab, 0xcc, 0x87, 0x00, 0x5c, 0xab, 0x00, 0x00, 0x00, 
+  0x00, 0x07, 0xcc, 0x88, 0x00, 0x0f, 0xcb, 0x87, 0x00, 0x1c, 0xcb, 0x87, 0x00, 0x3f, 0xcc, 0x88, 0x00, 0x7f, 0xcb, 0x87, 0x00, 0xa8, 0xcb, 0x87, 0x00, 0xd0, 0xcb, 0x87, 0x00, 0xf3, 0xcb, 0x87, 
+  0x00, 0xfc, 0x81, 0xcb, 0x87, 0x00, 0xff, 0x07, 0xcb, 0x87, 0x00, 0xfc, 0xca, 0x87, 0x00, 0xeb, 0xcb, 0x87, 0x00, 0xd8, 0xcb, 0x88, 0x00, 0xaf, 0xcc, 0x87, 0x00, 0x7f, 0xcb, 0x88, 0x00, 0x4f, 
+  0xce, 0x86, 0x00, 0x20, 0xcb, 0x87, 0x00, 0x10, 0x96, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +348,7 @@ const lv_img_dsc_t telegram_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( telegram_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = telegram_64px_map,
 };
-
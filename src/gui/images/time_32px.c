@@ -10,143 +10,192 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TIME_32PX uint8_t time_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x4f, 0xff, 0x8b, 0xff, 0xb7, 0xff, 0xd4, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xd4, 0xff, 0xb7, 0xff, 0x8b, 0xff, 0x4f, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x8b, 0xff, 0xdc, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdc, 0xff, 0x8b, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x7b, 0xff, 0xe0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe0, 0xff, 0x7b, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1c, 0xff, 0xbb, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdf, 0xff, 0xa0, 0xff, 0x68, 0xff, 0x43, 0xff, 0x30, 0xff, 0x30, 0xff, 0x43, 0xff, 0x68, 0xff, 0xa0, 0xff, 0xdf, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xbb, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x28, 0xff, 0xd0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd4, 0xff, 0x6b, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x6b, 0xff, 0xd4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd0, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1c, 0xff, 0xd0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x98, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xff, 0x98, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd0, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0xbb, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe4, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6c, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xbb, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x7b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6c, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x1f, 0xff, 0xe0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x98, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x98, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe0, 0xff, 0x1f, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd4, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xff, 0xd4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x8b, 0xff, 0x00, 
-  0xff, 0x0c, 0xff, 0xdc, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdc, 0xff, 0x0c, 
-  0xff, 0x4f, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdf, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xdf, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x4f, 
-  0xff, 0x8b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xa0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x8b, 
-  0xff, 0xb7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x68, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x68, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xb7, 
-  0xff, 0xd4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x43, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x43, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd4, 
-  0xff, 0xe3, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x30, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x30, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe3, 
-  0xff, 0xe3, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x30, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xd4, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x30, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe3, 
-  0xff, 0xd4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x43, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6c, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x97, 0xff, 0x18, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x43, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd4, 
-  0xff, 0xb7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x68, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x40, 0xff, 0xc7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdb, 0xff, 0x68, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x68, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xb7, 
-  0xff, 0x8b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xa0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x74, 0xff, 0xe0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xc0, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xa0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x8b, 
-  0xff, 0x4f, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdf, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x23, 0xff, 0xa8, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x8f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xdf, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x4f, 
-  0xff, 0x0c, 0xff, 0xdc, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x6b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x50, 0xff, 0xd0, 0xff, 0xe7, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdc, 0xff, 0x0c, 
-  0xff, 0x00, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd4, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x73, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xff, 0xd4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x8b, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x1f, 0xff, 0xe0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x98, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x98, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe0, 0xff, 0x1f, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x7b, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6c, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0xbb, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe4, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6c, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xbb, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1c, 0xff, 0xd0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0x98, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xff, 0x98, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd0, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x28, 0xff, 0xd0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd4, 0xff, 0x6b, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x6b, 0xff, 0xd4, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xd0, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1c, 0xff, 0xbb, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdf, 0xff, 0xa0, 0xff, 0x68, 0xff, 0x43, 0xff, 0x30, 0xff, 0x30, 0xff, 0x43, 0xff, 0x68, 0xff, 0xa0, 0xff, 0xdf, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xbb, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x7b, 0xff, 0xe0, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe0, 0xff, 0x7b, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x8b, 0xff, 0xdc, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xdc, 0xff, 0x8b, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x4f, 0xff, 0x8b, 0xff, 0xb7, 0xff, 0xd4, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xd4, 0xff, 0xb7, 0xff, 0x8b, 0xff, 0x4f, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x04, 0xff, 0x0c, 0xff, 0x4f, 0xff, 0x8b, 0xff, 0xb7, 0xff, 0xd4, 0x81, 0xff, 0xe3, 0x04, 0xff, 0xd4, 0xff, 0xb7, 0xff, 0x8b, 0xff, 0x4f, 0xff, 0x0c, 
+  0x91, 0x00, 0x00, 0x02, 0xff, 0x1f, 0xff, 0x8b, 0xff, 0xdc, 0x89, 0xff, 0xe7, 0x02, 0xff, 0xdc, 0xff, 0x8b, 0xff, 0x1f, 0x8d, 0x00, 0x00, 0x02, 0xff, 0x07, 0xff, 0x7b, 0xff, 0xe0, 0x8d, 0xff, 
+  0xe7, 0x02, 0xff, 0xe0, 0xff, 0x7b, 0xff, 0x07, 0x8a, 0x00, 0x00, 0x01, 0xff, 0x1c, 0xff, 0xbb, 0x83, 0xff, 0xe7, 0x03, 0xff, 0xdf, 0xff, 0xa0, 0xff, 0x68, 0xff, 0x43, 0x81, 0xff, 0x30, 0x03, 
+  0xff, 0x43, 0xff, 0x68, 0xff, 0xa0, 0xff, 0xdf, 0x83, 0xff, 0xe7, 0x01, 0xff, 0xbb, 0xff, 0x1c, 0x88, 0x00, 0x00, 0x01, 0xff, 0x28, 0xff, 0xd0, 0x82, 0xff, 0xe7, 0x02, 0xff, 0xd4, 0xff, 0x6b, 
+  0xff, 0x0f, 0x87, 0x00, 0x00, 0x02, 0xff, 0x0f, 0xff, 0x6b, 0xff, 0xd4, 0x82, 0xff, 0xe7, 0x01, 0xff, 0xd0, 0xff, 0x28, 0x86, 0x00, 0x00, 0x01, 0xff, 0x1c, 0xff, 0xd0, 0x82, 0xff, 0xe7, 0x01, 
+  0xff, 0x98, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x01, 0xff, 0x13, 0xff, 0x98, 0x82, 0xff, 0xe7, 0x01, 0xff, 0xd0, 0xff, 0x1c, 0x84, 0x00, 0x00, 0x01, 0xff, 0x07, 0xff, 0xbb, 0x81, 0xff, 0xe7, 0x01, 
+  0xff, 0xe4, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x01, 0xff, 0x6c, 0xff, 0xe4, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xbb, 0xff, 0x07, 0x83, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x82, 0xff, 0xe7, 0x00, 0xff, 0x6c, 
+  0x91, 0x00, 0x00, 0x00, 0xff, 0x6c, 0x82, 0xff, 0xe7, 0x00, 0xff, 0x7b, 0x82, 0x00, 0x00, 0x01, 0xff, 0x1f, 0xff, 0xe0, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x98, 0x87, 0x00, 0x00, 0x02, 0xff, 0x8b, 
+  0xff, 0xe7, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x00, 0xff, 0x98, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xe0, 0xff, 0x1f, 0x81, 0x00, 0x00, 0x00, 0xff, 0x8b, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xd4, 0xff, 0x13, 
+  0x87, 0x00, 0x00, 0x02, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x01, 0xff, 0x13, 0xff, 0xd4, 0x81, 0xff, 0xe7, 0x03, 0xff, 0x8b, 0x00, 0x00, 0xff, 0x0c, 0xff, 0xdc, 0x81, 0xff, 
+  0xe7, 0x00, 0xff, 0x6b, 0x88, 0x00, 0x00, 0x02, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x00, 0xff, 0x6b, 0x81, 0xff, 0xe7, 0x02, 0xff, 0xdc, 0xff, 0x0c, 0xff, 0x4f, 0x81, 0xff, 
+  0xe7, 0x01, 0xff, 0xdf, 0xff, 0x0f, 0x88, 0x00, 0x00, 0x02, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x01, 0xff, 0x0f, 0xff, 0xdf, 0x81, 0xff, 0xe7, 0x01, 0xff, 0x4f, 0xff, 0x8b, 
+  0x81, 0xff, 0xe7, 0x00, 0xff, 0xa0, 0x89, 0x00, 0x00, 0x02, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x81, 0xff, 0xe7, 0x01, 0xff, 0x8b, 0xff, 0xb7, 0x81, 0xff, 
+  0xe7, 0x00, 0xff, 0x68, 0x89, 0x00, 0x00, 0x02, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0xff, 0x68, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xb7, 0xff, 0xd4, 0x81, 0xff, 0xe7, 0x00, 
+  0xff, 0x43, 0x89, 0x00, 0x00, 0x02, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0xff, 0x43, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xd4, 0xff, 0xe3, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x30, 
+  0x89, 0x00, 0x00, 0x02, 0xff, 0x8b, 0xff, 0xe7, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0xff, 0x30, 0x81, 0xff, 0xe7, 0x81, 0xff, 0xe3, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x30, 0x89, 0x00, 0x00, 0x03, 
+  0xff, 0x8b, 0xff, 0xe7, 0xff, 0xd4, 0xff, 0x3c, 0x89, 0x00, 0x00, 0x00, 0xff, 0x30, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xe3, 0xff, 0xd4, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 
+  0xff, 0x6c, 0x82, 0xff, 0xe7, 0x01, 0xff, 0x97, 0xff, 0x18, 0x87, 0x00, 0x00, 0x00, 0xff, 0x43, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xd4, 0xff, 0xb7, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x68, 0x8a, 0x00, 
+  0x00, 0x01, 0xff, 0x40, 0xff, 0xc7, 0x81, 0xff, 0xe7, 0x02, 0xff, 0xdb, 0xff, 0x68, 0xff, 0x04, 0x85, 0x00, 0x00, 0x00, 0xff, 0x68, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xb7, 0xff, 0x8b, 0x81, 0xff, 
+  0xe7, 0x00, 0xff, 0xa0, 0x8b, 0x00, 0x00, 0x02, 0xff, 0x07, 0xff, 0x74, 0xff, 0xe0, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xc0, 0xff, 0x3c, 0x84, 0x00, 0x00, 0x00, 0xff, 0xa0, 0x81, 0xff, 0xe7, 0x01, 
+  0xff, 0x8b, 0xff, 0x4f, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xdf, 0xff, 0x0f, 0x8c, 0x00, 0x00, 0x01, 0xff, 0x23, 0xff, 0xa8, 0x82, 0xff, 0xe7, 0x00, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x01, 0xff, 0x0f, 
+  0xff, 0xdf, 0x81, 0xff, 0xe7, 0x02, 0xff, 0x4f, 0xff, 0x0c, 0xff, 0xdc, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x6b, 0x8e, 0x00, 0x00, 0x03, 0xff, 0x50, 0xff, 0xd0, 0xff, 0xe7, 0xff, 0x6c, 0x82, 0x00, 
+  0x00, 0x00, 0xff, 0x6b, 0x81, 0xff, 0xe7, 0x03, 0xff, 0xdc, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x8b, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xd4, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x02, 0xff, 0x0f, 0xff, 0x73, 
+  0xff, 0x04, 0x81, 0x00, 0x00, 0x01, 0xff, 0x13, 0xff, 0xd4, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x8b, 0x81, 0x00, 0x00, 0x01, 0xff, 0x1f, 0xff, 0xe0, 0x81, 0xff, 0xe7, 0x00, 0xff, 0x98, 0x93, 0x00, 
+  0x00, 0x00, 0xff, 0x98, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xe0, 0xff, 0x1f, 0x82, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x82, 0xff, 0xe7, 0x00, 0xff, 0x6c, 0x91, 0x00, 0x00, 0x00, 0xff, 0x6c, 0x82, 0xff, 
+  0xe7, 0x00, 0xff, 0x7b, 0x83, 0x00, 0x00, 0x01, 0xff, 0x07, 0xff, 0xbb, 0x81, 0xff, 0xe7, 0x01, 0xff, 0xe4, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x01, 0xff, 0x6c, 0xff, 0xe4, 0x81, 0xff, 0xe7, 0x01, 
+  0xff, 0xbb, 0xff, 0x07, 0x84, 0x00, 0x00, 0x01, 0xff, 0x1c, 0xff, 0xd0, 0x82, 0xff, 0xe7, 0x01, 0xff, 0x98, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x01, 0xff, 0x13, 0xff, 0x98, 0x82, 0xff, 0xe7, 0x01, 
+  0xff, 0xd0, 0xff, 0x1c, 0x86, 0x00, 0x00, 0x01, 0xff, 0x28, 0xff, 0xd0, 0x82, 0xff, 0xe7, 0x02, 0xff, 0xd4, 0xff, 0x6b, 0xff, 0x0f, 0x87, 0x00, 0x00, 0x02, 0xff, 0x0f, 0xff, 0x6b, 0xff, 0xd4, 
+  0x82, 0xff, 0xe7, 0x01, 0xff, 0xd0, 0xff, 0x28, 0x88, 0x00, 0x00, 0x01, 0xff, 0x1c, 0xff, 0xbb, 0x83, 0xff, 0xe7, 0x03, 0xff, 0xdf, 0xff, 0xa0, 0xff, 0x68, 0xff, 0x43, 0x81, 0xff, 0x30, 0x03, 
+  0xff, 0x43, 0xff, 0x68, 0xff, 0xa0, 0xff, 0xdf, 0x83, 0xff, 0xe7, 0x01, 0xff, 0xbb, 0xff, 0x1c, 0x8a, 0x00, 0x00, 0x02, 0xff, 0x07, 0xff, 0x7b, 0xff, 0xe0, 0x8d, 0xff, 0xe7, 0x02, 0xff, 0xe0, 
+  0xff, 0x7b, 0xff, 0x07, 0x8d, 0x00, 0x00, 0x02, 0xff, 0x1f, 0xff, 0x8b, 0xff, 0xdc, 0x89, 0xff, 0xe7, 0x02, 0xff, 0xdc, 0xff, 0x8b, 0xff, 0x1f, 0x91, 0x00, 0x00, 0x04, 0xff, 0x0c, 0xff, 0x4f, 
+  0xff, 0x8b, 0xff, 0xb7, 0xff, 0xd4, 0x81, 0xff, 0xe3, 0x04, 0xff, 0xd4, 0xff, 0xb7, 0xff, 0x8b, 0xff, 0x4f, 0xff, 0x0c, 0x89, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 0xff, 0xff, 0x30, 0xff, 0xff, 0x30, 0xff, 0xff, 0x43, 0xff, 0xff, 0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 
-  0xff, 0xff, 0x4f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x4f, 
-  0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 
-  0xff, 0xff, 0xb7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x68, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x68, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb7, 
-  0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x43, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x43, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x30, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x30, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x43, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x97, 0xff, 0xff, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x43, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 
-  0xff, 0xff, 0xb7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x68, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x68, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb7, 
-  0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x74, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 
-  0xff, 0xff, 0x4f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x23, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x4f, 
-  0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x50, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x73, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 0xff, 0xff, 0x30, 0xff, 0xff, 0x30, 0xff, 0xff, 0x43, 0xff, 0xff, 0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xe3, 0x04, 0xff, 0xff, 0xd4, 
+  0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0x91, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0x89, 0xff, 0xff, 0xe7, 0x02, 0xff, 
+  0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 0x8d, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 
+  0x7b, 0xff, 0xff, 0x07, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xbb, 0x83, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 
+  0x81, 0xff, 0xff, 0x30, 0x03, 0xff, 0xff, 0x43, 0xff, 0xff, 0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0x83, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0x88, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x0f, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 
+  0xff, 0xff, 0xd4, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 
+  0x98, 0xff, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x07, 0xff, 0xff, 0xbb, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0x81, 0xff, 0xff, 0xe7, 0x01, 
+  0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7b, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6c, 0x91, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x82, 0xff, 
+  0xff, 0xe7, 0x00, 0xff, 0xff, 0x7b, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x98, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x8b, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x00, 0x01, 
+  0xff, 0xff, 0x13, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6b, 0x88, 
+  0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6b, 0x81, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 
+  0xff, 0xff, 0x4f, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 0x88, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xa0, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa0, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0x81, 0xff, 0xff, 0xe7, 0x00, 
+  0xff, 0xff, 0x68, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x68, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 
+  0xb7, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x43, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe3, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x30, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 
+  0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x30, 0x81, 0xff, 0xff, 0xe7, 0x81, 0xff, 0xff, 0xe3, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x30, 0x89, 0x00, 0x00, 0x00, 0x03, 
+  0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x3c, 0x89, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x30, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd4, 0x81, 
+  0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x97, 0xff, 0xff, 0x18, 0x87, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x43, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x68, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40, 0xff, 0xff, 0xc7, 
+  0x81, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x68, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xb7, 0xff, 0xff, 
+  0x8b, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xa0, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x74, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xc0, 0xff, 
+  0xff, 0x3c, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa0, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 
+  0x8c, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x23, 0xff, 0xff, 0xa8, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0x81, 0xff, 
+  0xff, 0xe7, 0x02, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6b, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x50, 0xff, 0xff, 0xd0, 0xff, 
+  0xff, 0xe7, 0xff, 0xff, 0x6c, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6b, 0x81, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8b, 0x81, 0xff, 
+  0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x73, 0xff, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 
+  0xff, 0xd4, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x8b, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x98, 0x93, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7b, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6c, 
+  0x91, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x7b, 0x83, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x07, 0xff, 0xff, 0xbb, 0x81, 0xff, 0xff, 0xe7, 0x01, 
+  0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0x84, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x98, 0xff, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0x82, 0xff, 0xff, 
+  0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 
+  0x0f, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd4, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x1c, 0xff, 0xff, 0xbb, 0x83, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 0x81, 0xff, 0xff, 0x30, 0x03, 0xff, 0xff, 0x43, 0xff, 0xff, 
+  0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0x83, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 
+  0x8d, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x07, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0x89, 0xff, 0xff, 0xe7, 
+  0x02, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0x91, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0x81, 0xff, 
+  0xff, 0xe3, 0x04, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 0xff, 0xff, 0x30, 0xff, 0xff, 0x30, 0xff, 0xff, 0x43, 0xff, 0xff, 0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 
-  0xff, 0xff, 0x4f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x4f, 
-  0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 
-  0xff, 0xff, 0xb7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x68, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x68, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb7, 
-  0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x43, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x43, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x30, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x30, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x43, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x97, 0xff, 0xff, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x43, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 
-  0xff, 0xff, 0xb7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x68, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x68, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb7, 
-  0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x74, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 
-  0xff, 0xff, 0x4f, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x23, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x4f, 
-  0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x50, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x73, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x98, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 0xff, 0xff, 0x30, 0xff, 0xff, 0x30, 0xff, 0xff, 0x43, 0xff, 0xff, 0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xe3, 0x04, 0xff, 0xff, 0xd4, 
+  0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0x91, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0x89, 0xff, 0xff, 0xe7, 0x02, 0xff, 
+  0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 0x8d, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 
+  0x7b, 0xff, 0xff, 0x07, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xbb, 0x83, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 
+  0x81, 0xff, 0xff, 0x30, 0x03, 0xff, 0xff, 0x43, 0xff, 0xff, 0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0x83, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0x88, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x0f, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 
+  0xff, 0xff, 0xd4, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 
+  0x98, 0xff, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x07, 0xff, 0xff, 0xbb, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0x81, 0xff, 0xff, 0xe7, 0x01, 
+  0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7b, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6c, 0x91, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x82, 0xff, 
+  0xff, 0xe7, 0x00, 0xff, 0xff, 0x7b, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x98, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x8b, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x00, 0x01, 
+  0xff, 0xff, 0x13, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6b, 0x88, 
+  0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6b, 0x81, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 
+  0xff, 0xff, 0x4f, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 0x88, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xa0, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa0, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0x81, 0xff, 0xff, 0xe7, 0x00, 
+  0xff, 0xff, 0x68, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x68, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 
+  0xb7, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x43, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xe3, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x30, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 
+  0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x30, 0x81, 0xff, 0xff, 0xe7, 0x81, 0xff, 0xff, 0xe3, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x30, 0x89, 0x00, 0x00, 0x00, 0x03, 
+  0xff, 0xff, 0x8b, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x3c, 0x89, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x30, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd4, 0x81, 
+  0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x97, 0xff, 0xff, 0x18, 0x87, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x43, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x68, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40, 0xff, 0xff, 0xc7, 
+  0x81, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x68, 0xff, 0xff, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x68, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xb7, 0xff, 0xff, 
+  0x8b, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xa0, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x74, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xc0, 0xff, 
+  0xff, 0x3c, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa0, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0f, 
+  0x8c, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x23, 0xff, 0xff, 0xa8, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xdf, 0x81, 0xff, 
+  0xff, 0xe7, 0x02, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xdc, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6b, 0x8e, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x50, 0xff, 0xff, 0xd0, 0xff, 
+  0xff, 0xe7, 0xff, 0xff, 0x6c, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6b, 0x81, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8b, 0x81, 0xff, 
+  0xff, 0xe7, 0x01, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x73, 0xff, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 
+  0xff, 0xd4, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x8b, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x98, 0x93, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x1f, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7b, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x6c, 
+  0x91, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6c, 0x82, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0x7b, 0x83, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x07, 0xff, 0xff, 0xbb, 0x81, 0xff, 0xff, 0xe7, 0x01, 
+  0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xe4, 0x81, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x07, 0x84, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0x98, 0xff, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0x98, 0x82, 0xff, 0xff, 
+  0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x1c, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xd4, 0xff, 0xff, 0x6b, 0xff, 0xff, 
+  0x0f, 0x87, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd4, 0x82, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x1c, 0xff, 0xff, 0xbb, 0x83, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x68, 0xff, 0xff, 0x43, 0x81, 0xff, 0xff, 0x30, 0x03, 0xff, 0xff, 0x43, 0xff, 0xff, 
+  0x68, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xdf, 0x83, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xbb, 0xff, 0xff, 0x1c, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xe0, 
+  0x8d, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x07, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xdc, 0x89, 0xff, 0xff, 0xe7, 
+  0x02, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x1f, 0x91, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xd4, 0x81, 0xff, 
+  0xff, 0xe3, 0x04, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xb7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x0c, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x0c, 
-  0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x4f, 
-  0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x8b, 
-  0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb7, 
-  0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 
-  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 
-  0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb7, 
-  0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x74, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x8b, 
-  0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x4f, 
-  0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x0c, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xd4, 0x81, 0xff, 
+  0xff, 0xff, 0xe3, 0x04, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x0c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0xff, 0x1f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xdc, 0x89, 0xff, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x1f, 0x8d, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xe0, 0x8d, 0xff, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x07, 
+  0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xbb, 0x83, 0xff, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x68, 
+  0xff, 0xff, 0xff, 0x43, 0x81, 0xff, 0xff, 0xff, 0x30, 0x03, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xdf, 0x83, 0xff, 0xff, 0xff, 0xe7, 0x01, 
+  0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x1c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xff, 0xd4, 
+  0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x0f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xd4, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x01, 
+  0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x28, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0x98, 
+  0xff, 0xff, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x98, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1c, 
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xbb, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xe4, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0x7b, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x7b, 
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x98, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 
+  0xff, 0x1f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8b, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x13, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x03, 
+  0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xdc, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x6b, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6b, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xff, 0xdc, 
+  0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x4f, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x0f, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x8b, 
+  0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xdf, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0x4f, 
+  0xff, 0xff, 0xff, 0x8b, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0xa0, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 
+  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa0, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xb7, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 
+  0xff, 0x68, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x68, 0x81, 0xff, 
+  0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x8b, 
+  0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x43, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xe3, 
+  0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x30, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xb8, 0x8a, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x81, 0xff, 0xff, 0xff, 0xe3, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x30, 0x89, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x3c, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 
+  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x82, 0xff, 0xff, 0xff, 
+  0xe7, 0x01, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x18, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x43, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 
+  0xff, 0xb7, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x68, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xc7, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x02, 
+  0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x68, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xb7, 
+  0xff, 0xff, 0xff, 0x8b, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0xa0, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x74, 0xff, 0xff, 0xff, 0xe0, 
+  0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x3c, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa0, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 
+  0xff, 0x8b, 0xff, 0xff, 0xff, 0x4f, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x0f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 
+  0xff, 0xa8, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xdf, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x02, 
+  0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xdc, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x6b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x50, 
+  0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x6c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6b, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xff, 0xdc, 
+  0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8b, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 
+  0xff, 0xff, 0xff, 0x8b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x98, 0x93, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x98, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0x82, 0xff, 
+  0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x00, 0xff, 0xff, 0xff, 0x7b, 0x83, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xbb, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x6c, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0xff, 0x6c, 0xff, 0xff, 0xff, 0xe4, 0x81, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x07, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 
+  0xff, 0xd0, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0x13, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x98, 0x82, 0xff, 
+  0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xff, 0xe7, 0x02, 
+  0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x0f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xd4, 0x82, 0xff, 
+  0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xbb, 0x83, 0xff, 0xff, 0xff, 0xe7, 0x03, 
+  0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0x43, 0x81, 0xff, 0xff, 0xff, 0x30, 0x03, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 
+  0xff, 0xa0, 0xff, 0xff, 0xff, 0xdf, 0x83, 0xff, 0xff, 0xff, 0xe7, 0x01, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0x1c, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 
+  0xff, 0x7b, 0xff, 0xff, 0xff, 0xe0, 0x8d, 0xff, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x07, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0xff, 0x1f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xdc, 0x89, 0xff, 0xff, 0xff, 0xe7, 0x02, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x1f, 0x91, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xd4, 0x81, 0xff, 0xff, 0xff, 0xe3, 0x04, 0xff, 0xff, 0xff, 0xd4, 
+  0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0x0c, 0x89, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +203,7 @@ const lv_img_dsc_t time_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( time_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = time_32px_map,
 };
-
@@ -10,143 +10,194 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TINDER_32PX uint8_t tinder_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xff, 0x17, 0xff, 0x57, 0xff, 0xa0, 0xff, 0xd0, 0xff, 0xef, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xef, 0xff, 0xd3, 0xff, 0xa3, 0xff, 0x58, 0xff, 0x17, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x28, 0xff, 0x9c, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x9f, 0xff, 0x2b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x0c, 0xff, 0x8b, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x8b, 0xff, 0x0f, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x27, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x28, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x33, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x34, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x27, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x28, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x92, 0x00, 0xff, 0x0c, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x0f, 0x92, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x00, 0x00, 0x00, 
-  0x92, 0x00, 0xff, 0x28, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xee, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x2b, 0x92, 0x00, 
-  0xff, 0x00, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x00, 
-  0xff, 0x17, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x17, 
-  0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 
-  0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0x17, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x18, 
-  0xff, 0x00, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0x00, 
-  0x92, 0x00, 0xff, 0x2b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x2c, 0x92, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x92, 0x00, 0xff, 0x0f, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0x0f, 0x92, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x28, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0x2b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x34, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0x37, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x28, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0x2b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0xff, 0x0f, 0xff, 0x8f, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x8f, 0xff, 0x0f, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xff, 0x2c, 0xff, 0x9f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xa0, 0xff, 0x2c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x00, 0xff, 0x17, 0xff, 0x5b, 0xff, 0xa3, 0xff, 0xd8, 0xff, 0xef, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xef, 0xff, 0xd8, 0xff, 0xa4, 0xff, 0x5b, 0xff, 0x17, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x04, 0xff, 0x17, 0xff, 0x57, 0xff, 0xa0, 0xff, 0xd0, 0xff, 0xef, 0x81, 0xff, 0xfc, 0x04, 0xff, 0xef, 0xff, 0xd3, 0xff, 0xa3, 0xff, 0x58, 0xff, 0x17, 
+  0x91, 0x00, 0x00, 0x02, 0xff, 0x28, 0xff, 0x9c, 0xff, 0xef, 0x89, 0xff, 0xff, 0x02, 0xff, 0xef, 0xff, 0x9f, 0xff, 0x2b, 0x8d, 0x00, 0x00, 0x02, 0xff, 0x0c, 0xff, 0x8b, 0xff, 0xf4, 0x8d, 0xff, 
+  0xff, 0x02, 0xff, 0xf7, 0xff, 0x8b, 0xff, 0x0f, 0x8a, 0x00, 0x00, 0x01, 0xff, 0x27, 0xff, 0xcc, 0x91, 0xff, 0xff, 0x01, 0xff, 0xcf, 0xff, 0x28, 0x88, 0x00, 0x00, 0x01, 0xff, 0x33, 0xff, 0xe4, 
+  0x93, 0xff, 0xff, 0x01, 0xff, 0xe7, 0xff, 0x34, 0x86, 0x00, 0x00, 0x01, 0xff, 0x27, 0xff, 0xe4, 0x95, 0xff, 0xff, 0x01, 0xff, 0xe7, 0xff, 0x28, 0x84, 0x00, 0x00, 0x01, 0xff, 0x0c, 0xff, 0xcc, 
+  0x8b, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xf7, 0xff, 0x89, 0xff, 0xff, 0x01, 0xff, 0xcf, 0xff, 0x0f, 0x83, 0x00, 0x00, 0x00, 0xff, 0x8b, 0x8d, 0xff, 0xff, 0x01, 0xed, 0xff, 0xf2, 0xff, 0x89, 0xff, 
+  0xff, 0x00, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x01, 0xff, 0x28, 0xff, 0xf4, 0x8d, 0xff, 0xff, 0x00, 0xed, 0xff, 0x81, 0xee, 0xff, 0x00, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x01, 0xff, 0xf4, 0xff, 0x2b, 
+  0x81, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x8d, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x81, 0xee, 0xff, 0x81, 0xed, 0xff, 0x00, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x03, 0xff, 0x9f, 0x00, 0x00, 0xff, 0x17, 0xff, 
+  0xef, 0x8d, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x82, 0xee, 0xff, 0x01, 0xed, 0xff, 0xee, 0xff, 0x87, 0xff, 0xff, 0x02, 0xff, 0xef, 0xff, 0x17, 0xff, 0x57, 0x88, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xf7, 
+  0xff, 0x83, 0xff, 0xff, 0x83, 0xee, 0xff, 0x81, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x87, 0xff, 0xff, 0x01, 0xff, 0x5b, 0xff, 0xa0, 0x87, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xea, 0xff, 0xf2, 0xff, 0x82, 
+  0xff, 0xff, 0x00, 0xf2, 0xff, 0x84, 0xee, 0xff, 0x81, 0xed, 0xff, 0x00, 0xfb, 0xff, 0x86, 0xff, 0xff, 0x01, 0xff, 0xa3, 0xff, 0xd0, 0x86, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x82, 0xea, 0xff, 0x01, 
+  0xff, 0xff, 0xfb, 0xff, 0x87, 0xee, 0xff, 0x01, 0xed, 0xff, 0xf2, 0xff, 0x86, 0xff, 0xff, 0x01, 0xff, 0xd8, 0xff, 0xef, 0x86, 0xff, 0xff, 0x00, 0xee, 0xff, 0x82, 0xea, 0xff, 0x00, 0xee, 0xff, 
+  0x82, 0xea, 0xff, 0x85, 0xee, 0xff, 0x81, 0xed, 0xff, 0x86, 0xff, 0xff, 0x01, 0xff, 0xef, 0xff, 0xfc, 0x86, 0xff, 0xff, 0x87, 0xea, 0xff, 0x86, 0xee, 0xff, 0x01, 0xed, 0xff, 0xfb, 0xff, 0x85, 
+  0xff, 0xff, 0x81, 0xff, 0xfc, 0x85, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x88, 0xea, 0xff, 0x86, 0xee, 0xff, 0x00, 0xf7, 0xff, 0x85, 0xff, 0xff, 0x01, 0xff, 0xfc, 0xff, 0xef, 0x85, 0xff, 0xff, 0x00, 
+  0xf7, 0xff, 0x89, 0xea, 0xff, 0x85, 0xee, 0xff, 0x00, 0xf6, 0xff, 0x85, 0xff, 0xff, 0x01, 0xff, 0xef, 0xff, 0xd3, 0x85, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x89, 0xea, 0xff, 0x85, 0xee, 0xff, 0x00, 
+  0xf7, 0xff, 0x85, 0xff, 0xff, 0x01, 0xff, 0xd8, 0xff, 0xa3, 0x85, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x8a, 0xea, 0xff, 0x84, 0xee, 0xff, 0x00, 0xfb, 0xff, 0x85, 0xff, 0xff, 0x01, 0xff, 0xa4, 0xff, 
+  0x57, 0x86, 0xff, 0xff, 0x8a, 0xea, 0xff, 0x84, 0xee, 0xff, 0x86, 0xff, 0xff, 0x02, 0xff, 0x5b, 0xff, 0x17, 0xff, 0xef, 0x85, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x8a, 0xea, 0xff, 0x82, 0xee, 0xff, 
+  0x00, 0xf6, 0xff, 0x85, 0xff, 0xff, 0x03, 0xff, 0xef, 0xff, 0x18, 0x00, 0x00, 0xff, 0x9f, 0x86, 0xff, 0xff, 0x8b, 0xea, 0xff, 0x81, 0xee, 0xff, 0x86, 0xff, 0xff, 0x00, 0xff, 0xa0, 0x81, 0x00, 
+  0x00, 0x01, 0xff, 0x2b, 0xff, 0xf7, 0x85, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8a, 0xea, 0xff, 0x00, 0xee, 0xff, 0x86, 0xff, 0xff, 0x01, 0xff, 0xf7, 0xff, 0x2c, 0x82, 0x00, 0x00, 0x00, 0xff, 0x8b, 
+  0x87, 0xff, 0xff, 0x00, 0xee, 0xff, 0x87, 0xea, 0xff, 0x00, 0xf2, 0xff, 0x87, 0xff, 0xff, 0x00, 0xff, 0x8f, 0x83, 0x00, 0x00, 0x01, 0xff, 0x0f, 0xff, 0xcf, 0x87, 0xff, 0xff, 0x03, 0xfb, 0xff, 
+  0xf2, 0xff, 0xee, 0xff, 0xea, 0xff, 0x81, 0xee, 0xff, 0x00, 0xf7, 0xff, 0x88, 0xff, 0xff, 0x01, 0xff, 0xd0, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x01, 0xff, 0x28, 0xff, 0xe7, 0x95, 0xff, 0xff, 0x01, 
+  0xff, 0xe8, 0xff, 0x2b, 0x86, 0x00, 0x00, 0x01, 0xff, 0x34, 0xff, 0xe7, 0x93, 0xff, 0xff, 0x01, 0xff, 0xe8, 0xff, 0x37, 0x88, 0x00, 0x00, 0x01, 0xff, 0x28, 0xff, 0xcf, 0x91, 0xff, 0xff, 0x01, 
+  0xff, 0xd0, 0xff, 0x2b, 0x8a, 0x00, 0x00, 0x02, 0xff, 0x0f, 0xff, 0x8f, 0xff, 0xf4, 0x8d, 0xff, 0xff, 0x02, 0xff, 0xf7, 0xff, 0x8f, 0xff, 0x0f, 0x8d, 0x00, 0x00, 0x02, 0xff, 0x2c, 0xff, 0x9f, 
+  0xff, 0xef, 0x89, 0xff, 0xff, 0x02, 0xff, 0xef, 0xff, 0xa0, 0xff, 0x2c, 0x91, 0x00, 0x00, 0x04, 0xff, 0x17, 0xff, 0x5b, 0xff, 0xa3, 0xff, 0xd8, 0xff, 0xef, 0x81, 0xff, 0xfc, 0x04, 0xff, 0xef, 
+  0xff, 0xd8, 0xff, 0xa4, 0xff, 0x5b, 0xff, 0x17, 0x89, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0x57, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xa3, 0xff, 0xff, 0x58, 0xff, 0xff, 0x17, 0xf7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x2b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x0f, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x27, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x28, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x34, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x27, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x28, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xfe, 0xff, 0x55, 0xfd, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x0f, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1c, 0xe7, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0xff, 0xec, 0xfa, 0xff, 0x8e, 0xfb, 0xff, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x1c, 0xe7, 0x00, 0x00, 0x00, 0x00, 
-  0x51, 0x8c, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x2b, 0x51, 0x8c, 0x00, 
-  0x1c, 0xe7, 0x00, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xfe, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x1c, 0xe7, 0x00, 
-  0xff, 0xff, 0x17, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xfc, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x17, 
-  0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xfd, 0xff, 0x36, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xed, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0xce, 0xfb, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xfd, 0xff, 0x4d, 0xfa, 0xff, 0xd2, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xd1, 0xfb, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0xd7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xfe, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x8e, 0xfa, 0xff, 0xfc, 0xfe, 0xff, 0x7a, 0xfe, 0xff, 0x70, 0xfb, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0xae, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x31, 0xfb, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x8e, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xfe, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xfd, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x55, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xfc, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x14, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfc, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x55, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xfd, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0x39, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 
-  0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xfe, 0xff, 0xcf, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xed, 0xfa, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0xff, 0x17, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xfb, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xd4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x18, 
-  0x1c, 0xe7, 0x00, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xfe, 0xff, 0x0f, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x2f, 0xfb, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x1c, 0xe7, 0x00, 
-  0x51, 0x8c, 0x00, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xfe, 0xff, 0xef, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0xee, 0xfa, 0xff, 0xdc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x2c, 0x51, 0x8c, 0x00, 
-  0x00, 0x00, 0x00, 0x1c, 0xe7, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xfe, 0xff, 0xf1, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0xf2, 0xfb, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x1c, 0xe7, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x1a, 0xfe, 0xff, 0xf4, 0xfb, 0xff, 0xd0, 0xfa, 0xff, 0x6f, 0xfa, 0xff, 0xaf, 0xfa, 0xff, 0x31, 0xfb, 0xff, 0xb5, 0xfc, 0xff, 0x9b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x0f, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0x2b, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0x37, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x2b, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x0f, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x17, 0xf7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x17, 0xff, 0xff, 0x57, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xef, 0x81, 0xff, 0xff, 0xfc, 0x04, 0xff, 0xff, 0xef, 
+  0xff, 0xff, 0xd3, 0xff, 0xff, 0xa3, 0xff, 0xff, 0x58, 0xff, 0xff, 0x17, 0x91, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x28, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xef, 0x89, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xef, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xf4, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf7, 0xff, 0xff, 
+  0x8b, 0xff, 0xff, 0x0f, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x27, 0xff, 0xff, 0xcc, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x33, 0xff, 0xff, 0xe4, 0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x34, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x27, 0xff, 0xff, 0xe4, 0x95, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xe7, 0xff, 0xff, 0x28, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xcc, 0x8b, 0xff, 0xff, 0xff, 0x02, 0x9a, 0xfe, 0xff, 0x55, 0xfd, 0xff, 0x9e, 0xff, 0xff, 0x88, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8b, 0x8c, 0xff, 0xff, 0xff, 0x03, 0xbb, 0xfe, 0xff, 0xec, 0xfa, 0xff, 0x8e, 0xfb, 0xff, 
+  0xba, 0xfe, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf4, 0x8c, 0xff, 0xff, 0xff, 0x04, 0xbb, 0xfe, 0xff, 0xec, 0xfa, 
+  0xff, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9c, 0x8d, 0xff, 0xff, 
+  0xff, 0x00, 0x39, 0xfe, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x02, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0x17, 0xff, 0xff, 0xef, 0x88, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xb3, 0xfc, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x81, 0x0c, 0xfb, 0xff, 0x01, 0x2c, 
+  0xfb, 0xff, 0xba, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xef, 0xff, 0xff, 0x17, 0xff, 0xff, 0x57, 0x88, 0xff, 0xff, 0xff, 0x01, 0xb8, 0xfd, 0xff, 0x36, 0xfd, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0x02, 0x1c, 0xff, 0xff, 0xed, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x81, 0x0c, 0xfb, 0xff, 0x01, 0xce, 0xfb, 0xff, 0xbe, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0x5b, 0xff, 0xff, 0xa0, 0x87, 0xff, 0xff, 0xff, 0x02, 0x37, 0xfd, 0xff, 0x4d, 0xfa, 0xff, 0xd2, 0xfb, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0x7e, 0xff, 0xff, 0xd1, 0xfb, 0xff, 0xad, 
+  0xfa, 0xff, 0x81, 0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x81, 0x0c, 0xfb, 0xff, 0x00, 0xd7, 0xfd, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xd0, 0x86, 0xff, 0xff, 
+  0xff, 0x00, 0x5a, 0xfe, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x04, 0x8e, 0xfa, 0xff, 0xfc, 0xfe, 0xff, 0x7a, 0xfe, 0xff, 0x70, 0xfb, 0xff, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x81, 0xcc, 0xfa, 
+  0xff, 0x00, 0xec, 0xfa, 0xff, 0x81, 0x0c, 0xfb, 0xff, 0x01, 0xae, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xef, 0x85, 0xff, 0xff, 0xff, 0x01, 
+  0xdf, 0xff, 0xff, 0x31, 0xfb, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x01, 0x4d, 0xfa, 0xff, 0x8e, 0xfa, 0xff, 0x81, 0x6d, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x02, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 
+  0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x81, 0x0c, 0xfb, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfc, 0x85, 0xff, 0xff, 0xff, 0x02, 0x9b, 
+  0xfe, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x81, 0x4d, 0xfa, 0xff, 0x00, 0x6d, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x81, 0xcc, 0xfa, 0xff, 
+  0x81, 0xec, 0xfa, 0xff, 0x01, 0x0c, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfc, 0x85, 0xff, 0xff, 0xff, 0x01, 0x57, 0xfd, 0xff, 0xee, 0xf9, 0xff, 0x81, 0x0e, 
+  0xfa, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x00, 0x4d, 0xfa, 0xff, 0x81, 0x6d, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x00, 0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x01, 0x0c, 
+  0xfb, 0xff, 0x55, 0xfd, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0x85, 0xff, 0xff, 0xff, 0x00, 0x95, 0xfc, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x00, 0x0e, 0xfa, 0xff, 
+  0x81, 0x2e, 0xfa, 0xff, 0x81, 0x4d, 0xfa, 0xff, 0x81, 0x6d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x01, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x00, 
+  0x14, 0xfd, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd3, 0x85, 0xff, 0xff, 0xff, 0x00, 0xb6, 0xfc, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x81, 0x2e, 
+  0xfa, 0xff, 0x81, 0x4d, 0xfa, 0xff, 0x00, 0x6d, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x81, 0xcc, 0xfa, 0xff, 0x01, 0xec, 0xfa, 0xff, 0x55, 0xfd, 0xff, 0x85, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xa3, 0x85, 0xff, 0xff, 0xff, 0x01, 0x98, 0xfd, 0xff, 0xce, 0xf9, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x02, 0x2e, 0xfa, 0xff, 0x4e, 
+  0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x81, 0x6d, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x81, 0xcc, 0xfa, 0xff, 0x00, 0x39, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xa4, 0xff, 0xff, 0x57, 0x85, 0xff, 0xff, 0xff, 0x03, 0xdc, 0xfe, 0xff, 0xcf, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x81, 0x4d, 0xfa, 
+  0xff, 0x81, 0x6d, 0xfa, 0xff, 0x00, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x02, 0xcc, 0xfa, 0xff, 0xed, 0xfa, 0xff, 0x5d, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0x5b, 0xff, 
+  0xff, 0x17, 0xff, 0xff, 0xef, 0x85, 0xff, 0xff, 0xff, 0x01, 0xb3, 0xfb, 0xff, 0xce, 0xf9, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x00, 0x4d, 0xfa, 0xff, 
+  0x81, 0x6d, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x00, 0xd4, 0xfc, 0xff, 0x85, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xef, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0x9f, 0x85, 0xff, 0xff, 0xff, 0x02, 0xdc, 0xfe, 0xff, 0x0f, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x00, 0x0e, 0xfa, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x01, 0x4e, 0xfa, 0xff, 0x4d, 
+  0xfa, 0xff, 0x81, 0x6d, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x01, 0x2f, 0xfb, 0xff, 0x7d, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xa0, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0x2b, 0xff, 0xff, 0xf7, 0x85, 0xff, 0xff, 0xff, 0x03, 0x1a, 0xfe, 0xff, 0xef, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x81, 0x4d, 0xfa, 
+  0xff, 0x81, 0x6d, 0xfa, 0xff, 0x01, 0xee, 0xfa, 0xff, 0xdc, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x2c, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8b, 0x86, 
+  0xff, 0xff, 0xff, 0x03, 0x9c, 0xfe, 0xff, 0xf1, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x81, 0x2e, 0xfa, 0xff, 0x03, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0xf2, 
+  0xfb, 0xff, 0x3d, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8f, 0x83, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xcf, 0x86, 0xff, 0xff, 0xff, 0x08, 0xbf, 0xff, 0xff, 
+  0x1a, 0xfe, 0xff, 0xf4, 0xfb, 0xff, 0xd0, 0xfa, 0xff, 0x6f, 0xfa, 0xff, 0xaf, 0xfa, 0xff, 0x31, 0xfb, 0xff, 0xb5, 0xfc, 0xff, 0x9b, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd0, 
+  0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xe7, 0x89, 0xff, 0xff, 0xff, 0x01, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xe8, 0xff, 0xff, 0x2b, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe7, 0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe8, 0xff, 0xff, 0x37, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x28, 0xff, 0xff, 0xcf, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x2b, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf4, 0x8d, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x0f, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xef, 0x89, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xef, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x2c, 0x91, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x17, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xef, 0x81, 0xff, 0xff, 0xfc, 
+  0x04, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x17, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0x57, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xa3, 0xff, 0xff, 0x58, 0xff, 0xff, 0x17, 0xbd, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x2b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x0f, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x27, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x28, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x34, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x27, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x28, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9a, 0xff, 0xfd, 0x55, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x0f, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xe7, 0x1c, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbb, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x8e, 0xff, 0xfe, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xe7, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-  0x8c, 0x51, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbb, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x2b, 0x8c, 0x51, 0x00, 
-  0xe7, 0x1c, 0x00, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x39, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0x1c, 0x00, 
-  0xff, 0xff, 0x17, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb3, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfe, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x17, 
-  0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb8, 0xff, 0xfd, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xfa, 0xed, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0xce, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x37, 0xff, 0xfa, 0x4d, 0xff, 0xfb, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xfb, 0xd1, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5a, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x8e, 0xff, 0xfe, 0xfc, 0xff, 0xfe, 0x7a, 0xff, 0xfb, 0x70, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0xae, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfb, 0x31, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x8e, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9b, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x57, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfd, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x95, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfd, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb6, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfd, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x98, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfe, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 
-  0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdc, 0xff, 0xf9, 0xcf, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xed, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0xff, 0x17, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xb3, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfc, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x18, 
-  0xe7, 0x1c, 0x00, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdc, 0xff, 0xfa, 0x0f, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xe7, 0x1c, 0x00, 
-  0x8c, 0x51, 0x00, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1a, 0xff, 0xf9, 0xef, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0xee, 0xff, 0xfe, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x2c, 0x8c, 0x51, 0x00, 
-  0x00, 0x00, 0x00, 0xe7, 0x1c, 0x00, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9c, 0xff, 0xfa, 0xf1, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfb, 0xf2, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xe7, 0x1c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0x1a, 0xff, 0xfb, 0xf4, 0xff, 0xfa, 0xd0, 0xff, 0xfa, 0x6f, 0xff, 0xfa, 0xaf, 0xff, 0xfb, 0x31, 0xff, 0xfc, 0xb5, 0xff, 0xfe, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x0f, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0x2b, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0x37, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x2b, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x0f, 0x8c, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x17, 0xbd, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x17, 0xff, 0xff, 0x57, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xef, 0x81, 0xff, 0xff, 0xfc, 0x04, 0xff, 0xff, 0xef, 
+  0xff, 0xff, 0xd3, 0xff, 0xff, 0xa3, 0xff, 0xff, 0x58, 0xff, 0xff, 0x17, 0x91, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x28, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xef, 0x89, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xef, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xf4, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf7, 0xff, 0xff, 
+  0x8b, 0xff, 0xff, 0x0f, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x27, 0xff, 0xff, 0xcc, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x33, 0xff, 0xff, 0xe4, 0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x34, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x27, 0xff, 0xff, 0xe4, 0x95, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xe7, 0xff, 0xff, 0x28, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xcc, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xfe, 0x9a, 0xff, 0xfd, 0x55, 0xff, 0xff, 0x9e, 0xff, 0x88, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8b, 0x8c, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xbb, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x8e, 0xff, 
+  0xfe, 0xba, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xf4, 0x8c, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xbb, 0xff, 0xfa, 0xec, 
+  0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfe, 0x18, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x9c, 0x8d, 0xff, 0xff, 
+  0xff, 0x00, 0xfe, 0x39, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x02, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfe, 0x18, 0xff, 0x87, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0x17, 0xff, 0xff, 0xef, 0x88, 0xff, 0xff, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xb3, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0x81, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 
+  0x2c, 0xff, 0xfe, 0xba, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xef, 0xff, 0xff, 0x17, 0xff, 0xff, 0x57, 0x88, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xb8, 0xff, 0xfd, 0x36, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0x1c, 0xff, 0xfa, 0xed, 0xff, 0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x81, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0xce, 0xff, 0xff, 0xbe, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0x5b, 0xff, 0xff, 0xa0, 0x87, 0xff, 0xff, 0xff, 0x02, 0xfd, 0x37, 0xff, 0xfa, 0x4d, 0xff, 0xfb, 0xd2, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xff, 0x7e, 0xff, 0xfb, 0xd1, 0xff, 0xfa, 
+  0xad, 0xff, 0x81, 0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x81, 0xfb, 0x0c, 0xff, 0x00, 0xfd, 0xd7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xd0, 0x86, 0xff, 0xff, 
+  0xff, 0x00, 0xfe, 0x5a, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x04, 0xfa, 0x8e, 0xff, 0xfe, 0xfc, 0xff, 0xfe, 0x7a, 0xff, 0xfb, 0x70, 0xff, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x81, 0xfa, 0xcc, 
+  0xff, 0x00, 0xfa, 0xec, 0xff, 0x81, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0xae, 0xff, 0xff, 0xdf, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xef, 0x85, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xdf, 0xff, 0xfb, 0x31, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x01, 0xfa, 0x4d, 0xff, 0xfa, 0x8e, 0xff, 0x81, 0xfa, 0x6d, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x02, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 
+  0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x81, 0xfb, 0x0c, 0xff, 0x00, 0xfe, 0xfb, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xef, 0xff, 0xff, 0xfc, 0x85, 0xff, 0xff, 0xff, 0x02, 0xfe, 
+  0x9b, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x81, 0xfa, 0x4d, 0xff, 0x00, 0xfa, 0x6d, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x81, 0xfa, 0xcc, 0xff, 
+  0x81, 0xfa, 0xec, 0xff, 0x01, 0xfb, 0x0c, 0xff, 0xfe, 0x18, 0xff, 0x85, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfc, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfd, 0x57, 0xff, 0xf9, 0xee, 0xff, 0x81, 0xfa, 
+  0x0e, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4d, 0xff, 0x81, 0xfa, 0x6d, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x00, 0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x01, 0xfb, 
+  0x0c, 0xff, 0xfd, 0x55, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfc, 0x95, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x00, 0xfa, 0x0e, 0xff, 
+  0x81, 0xfa, 0x2e, 0xff, 0x81, 0xfa, 0x4d, 0xff, 0x81, 0xfa, 0x6d, 0xff, 0x00, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x01, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x00, 
+  0xfd, 0x14, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd3, 0x85, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xb6, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 
+  0x2e, 0xff, 0x81, 0xfa, 0x4d, 0xff, 0x00, 0xfa, 0x6d, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x81, 0xfa, 0xcc, 0xff, 0x01, 0xfa, 0xec, 0xff, 0xfd, 0x55, 0xff, 0x85, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xa3, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfd, 0x98, 0xff, 0xf9, 0xce, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x02, 0xfa, 0x2e, 0xff, 0xfa, 
+  0x4e, 0xff, 0xfa, 0x4d, 0xff, 0x81, 0xfa, 0x6d, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x81, 0xfa, 0xcc, 0xff, 0x00, 0xfe, 0x39, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xa4, 0xff, 0xff, 0x57, 0x85, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xdc, 0xff, 0xf9, 0xcf, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x81, 0xfa, 0x4d, 
+  0xff, 0x81, 0xfa, 0x6d, 0xff, 0x00, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x02, 0xfa, 0xcc, 0xff, 0xfa, 0xed, 0xff, 0xff, 0x5d, 0xff, 0x85, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0x5b, 0xff, 
+  0xff, 0x17, 0xff, 0xff, 0xef, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xb3, 0xff, 0xf9, 0xce, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4d, 0xff, 
+  0x81, 0xfa, 0x6d, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x00, 0xfc, 0xd4, 0xff, 0x85, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xef, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0x9f, 0x85, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xdc, 0xff, 0xfa, 0x0f, 0xff, 0xf9, 0xce, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x00, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x01, 0xfa, 0x4e, 0xff, 0xfa, 
+  0x4d, 0xff, 0x81, 0xfa, 0x6d, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x01, 0xfb, 0x2f, 0xff, 0xff, 0x7d, 0xff, 0x85, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xa0, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0x2b, 0xff, 0xff, 0xf7, 0x85, 0xff, 0xff, 0xff, 0x03, 0xfe, 0x1a, 0xff, 0xf9, 0xef, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x81, 0xfa, 0x4d, 
+  0xff, 0x81, 0xfa, 0x6d, 0xff, 0x01, 0xfa, 0xee, 0xff, 0xfe, 0xdc, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x2c, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8b, 0x86, 
+  0xff, 0xff, 0xff, 0x03, 0xfe, 0x9c, 0xff, 0xfa, 0xf1, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 0x2e, 0xff, 0x03, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfb, 
+  0xf2, 0xff, 0xff, 0x3d, 0xff, 0x86, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8f, 0x83, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xcf, 0x86, 0xff, 0xff, 0xff, 0x08, 0xff, 0xbf, 0xff, 
+  0xfe, 0x1a, 0xff, 0xfb, 0xf4, 0xff, 0xfa, 0xd0, 0xff, 0xfa, 0x6f, 0xff, 0xfa, 0xaf, 0xff, 0xfb, 0x31, 0xff, 0xfc, 0xb5, 0xff, 0xfe, 0x9b, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd0, 
+  0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xe7, 0x89, 0xff, 0xff, 0xff, 0x01, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xe8, 0xff, 0xff, 0x2b, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe7, 0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe8, 0xff, 0xff, 0x37, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 
+  0xff, 0x28, 0xff, 0xff, 0xcf, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd0, 0xff, 0xff, 0x2b, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf4, 0x8d, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x0f, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x2c, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xef, 0x89, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xef, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x2c, 0x91, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x17, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xef, 0x81, 0xff, 0xff, 0xfc, 
+  0x04, 0xff, 0xff, 0xef, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x5b, 0xff, 0xff, 0x17, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0x17, 0xbc, 0xbc, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x0f, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x28, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x34, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x28, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xd0, 0xff, 0xff, 0xa9, 0xa9, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x0f, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe1, 0xe1, 0xe1, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xd6, 0xff, 0xff, 0x5f, 0x5d, 0xfe, 0xff, 0x71, 0x72, 0xfe, 0xff, 0xd3, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xe1, 0xe1, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xd5, 0xff, 0xff, 0x60, 0x5c, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x62, 0x64, 0xfe, 0xff, 0xbe, 0xc0, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x2b, 0x89, 0x89, 0x89, 0x00, 
-  0xe1, 0xe1, 0xe1, 0x00, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xc3, 0xff, 0xff, 0x61, 0x5b, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x63, 0xfe, 0xff, 0xbe, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe1, 0xe1, 0xe1, 0x00, 
-  0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x93, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x61, 0x65, 0xfe, 0xff, 0xd4, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x17, 
-  0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xbe, 0xb3, 0xff, 0xff, 0xb1, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xe1, 0xff, 0xff, 0x69, 0x5b, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x73, 0x78, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xb6, 0xa6, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x8f, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xee, 0xff, 0xff, 0x87, 0x79, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0xb7, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xc8, 0xff, 0xff, 0x6f, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x71, 0x4f, 0xfe, 0xff, 0xe4, 0xde, 0xff, 0xff, 0xd2, 0xcb, 0xff, 0xff, 0x7f, 0x6b, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x72, 0x76, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0x87, 0x63, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x71, 0x51, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0xda, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd2, 0xff, 0xff, 0x70, 0x3e, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x5f, 0x60, 0xfe, 0xff, 0xbe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xa9, 0xff, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0xa9, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x92, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0xa0, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 
-  0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x95, 0xfe, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0xab, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xb0, 0xfe, 0xff, 0x73, 0x38, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x62, 0x5a, 0xfe, 0xff, 0xc7, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 
-  0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xda, 0xff, 0xff, 0x75, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x67, 0x5d, 0xfe, 0xff, 0xe8, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 
-  0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0x99, 0x74, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x9f, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x18, 
-  0xe1, 0xe1, 0xe1, 0x00, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xda, 0xff, 0xff, 0x7a, 0x40, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x75, 0x66, 0xfe, 0xff, 0xec, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xe1, 0xe1, 0xe1, 0x00, 
-  0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xc2, 0xfe, 0xff, 0x77, 0x3d, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x73, 0x5e, 0xfe, 0xff, 0xdd, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x2c, 0x89, 0x89, 0x89, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe1, 0xe1, 0xe1, 0x00, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xd1, 0xfe, 0xff, 0x89, 0x5c, 0xfd, 0xff, 0x72, 0x3a, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x90, 0x7e, 0xfe, 0xff, 0xe7, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xe1, 0xe1, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf5, 0xff, 0xff, 0xcf, 0xc0, 0xff, 0xff, 0x9d, 0x7e, 0xfe, 0xff, 0x83, 0x58, 0xfe, 0xff, 0x79, 0x4e, 0xfe, 0xff, 0x7c, 0x54, 0xfe, 0xff, 0x85, 0x65, 0xfe, 0xff, 0xa7, 0x95, 0xff, 0xff, 0xd8, 0xd1, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x0f, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xf7, 0xf5, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0x2b, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0x37, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x2b, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x0f, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x17, 0xbc, 0xbc, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xef, 0x81, 0xff, 
+  0xff, 0xff, 0xfc, 0x04, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0x17, 0x91, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0xff, 0x28, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xef, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0x2b, 0x8d, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xf4, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x0f, 
+  0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xcc, 0x91, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x28, 0x88, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xe4, 0x93, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x34, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0xff, 0x27, 0xff, 0xff, 0xff, 0xe4, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x28, 0x84, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xcc, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x02, 0xd0, 0xd0, 0xff, 0xff, 0xa9, 0xa9, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8b, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x03, 0xd7, 0xd6, 0xff, 0xff, 
+  0x5f, 0x5d, 0xfe, 0xff, 0x71, 0x72, 0xfe, 0xff, 0xd3, 0xd4, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 
+  0xff, 0xff, 0xff, 0xf4, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x05, 0xd6, 0xd5, 0xff, 0xff, 0x60, 0x5c, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x62, 0x64, 0xfe, 0xff, 0xbe, 0xc0, 0xff, 0xff, 0xfe, 0xfe, 
+  0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x2b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9c, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x05, 
+  0xc6, 0xc3, 0xff, 0xff, 0x61, 0x5b, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x63, 0xfe, 0xff, 0xbe, 0xc0, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 
+  0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xef, 0x88, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf7, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x06, 0x9a, 0x93, 
+  0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x61, 0x65, 0xfe, 0xff, 0xd4, 0xd6, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x57, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfd, 0xfc, 0xff, 0xff, 0xbe, 0xb3, 0xff, 0xff, 0xb1, 0xa4, 0xff, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0xff, 0x08, 0xe3, 0xe1, 0xff, 0xff, 0x69, 0x5b, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 
+  0x73, 0x78, 0xff, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0xa0, 0x86, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfd, 0xff, 0xff, 
+  0xb6, 0xa6, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x8f, 0x78, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf0, 0xee, 0xff, 0xff, 0x87, 0x79, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x64, 0x57, 
+  0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0xb7, 0xba, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xd0, 0x86, 0xff, 0xff, 0xff, 0xff, 0x10, 0xd3, 0xc8, 0xff, 0xff, 0x6f, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x71, 0x4f, 0xfe, 0xff, 0xe4, 0xde, 
+  0xff, 0xff, 0xd2, 0xcb, 0xff, 0xff, 0x7f, 0x6b, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5d, 
+  0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x72, 0x76, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xef, 
+  0x85, 0xff, 0xff, 0xff, 0xff, 0x11, 0xf9, 0xf7, 0xff, 0xff, 0x87, 0x63, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x71, 0x51, 0xfe, 0xff, 0x6a, 0x4b, 
+  0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x61, 0x5e, 
+  0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0xda, 0xdb, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfc, 0x85, 0xff, 0xff, 0xff, 
+  0xff, 0x11, 0xdc, 0xd2, 0xff, 0xff, 0x70, 0x3e, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 
+  0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 
+  0xfe, 0xff, 0x5f, 0x60, 0xfe, 0xff, 0xbe, 0xbf, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xfc, 0x85, 0xff, 0xff, 0xff, 0xff, 0x11, 0xbc, 0xa9, 0xff, 0xff, 0x71, 0x3d, 
+  0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x68, 0x4f, 
+  0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0xa9, 0xa9, 
+  0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xef, 0x85, 0xff, 0xff, 0xff, 0xff, 0x11, 0xac, 0x92, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 
+  0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 
+  0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0xa0, 0xa0, 0xff, 0xff, 0x85, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd3, 0x85, 0xff, 0xff, 0xff, 0xff, 0x11, 0xaf, 0x95, 0xfe, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 
+  0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x51, 
+  0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0xab, 0xa9, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xa3, 0x85, 0xff, 0xff, 0xff, 0xff, 0x11, 0xc3, 0xb0, 0xfe, 0xff, 0x73, 0x38, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x40, 
+  0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 
+  0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x62, 0x5a, 0xfe, 0xff, 0xc7, 0xc5, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa4, 
+  0xff, 0xff, 0xff, 0x57, 0x85, 0xff, 0xff, 0xff, 0xff, 0x11, 0xe4, 0xda, 0xff, 0xff, 0x75, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x41, 
+  0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x53, 
+  0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x67, 0x5d, 0xfe, 0xff, 0xe8, 0xe7, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x17, 
+  0xff, 0xff, 0xff, 0xef, 0x84, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfd, 0xfc, 0xff, 0xff, 0x99, 0x74, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x70, 0x3f, 
+  0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x67, 0x51, 
+  0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x9f, 0x99, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0x9f, 0x85, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xe4, 0xda, 0xff, 0xff, 0x7a, 0x40, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x40, 
+  0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 
+  0xfe, 0xff, 0x75, 0x66, 0xfe, 0xff, 0xec, 0xeb, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa0, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 
+  0xff, 0xf7, 0x85, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xd1, 0xc2, 0xfe, 0xff, 0x77, 0x3d, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 
+  0x6e, 0x43, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x73, 0x5e, 0xfe, 0xff, 0xdd, 0xd9, 0xff, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x2c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8b, 0x86, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xdd, 0xd1, 
+  0xfe, 0xff, 0x89, 0x5c, 0xfd, 0xff, 0x72, 0x3a, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x49, 
+  0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x90, 0x7e, 0xfe, 0xff, 0xe7, 0xe4, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xcf, 0x86, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf7, 0xf5, 0xff, 0xff, 0xcf, 0xc0, 0xff, 0xff, 0x9d, 0x7e, 0xfe, 0xff, 0x83, 0x58, 0xfe, 0xff, 0x79, 0x4e, 0xfe, 0xff, 
+  0x7c, 0x54, 0xfe, 0xff, 0x85, 0x65, 0xfe, 0xff, 0xa7, 0x95, 0xff, 0xff, 0xd8, 0xd1, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 
+  0xff, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xe7, 0x88, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfc, 0xfb, 0xff, 0xff, 0xf7, 0xf5, 0xff, 0xff, 0xf9, 0xf7, 
+  0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0x2b, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 
+  0xff, 0xe7, 0x93, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0x37, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xcf, 0x91, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x2b, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xf4, 0x8d, 0xff, 
+  0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x0f, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 
+  0xff, 0xef, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x2c, 0x91, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 
+  0xff, 0x5b, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xef, 0x81, 0xff, 0xff, 0xff, 0xfc, 0x04, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xa4, 
+  0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff, 0x17, 0x89, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +205,7 @@ const lv_img_dsc_t tinder_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( tinder_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = tinder_32px_map,
 };
-
@@ -10,271 +10,483 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TINDER_64PX uint8_t tinder_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0x3b, 0xff, 0x63, 0xff, 0x87, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xe3, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xe3, 0xff, 0xdb, 0xff, 0xc0, 0xff, 0x8b, 0xff, 0x64, 0xff, 0x3c, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xff, 0x47, 0xff, 0x84, 0xff, 0xc4, 0xff, 0xec, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xec, 0xff, 0xc4, 0xff, 0x87, 0xff, 0x47, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x24, 0xff, 0x70, 0xff, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xc8, 0xff, 0x73, 0xff, 0x27, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x23, 0xff, 0x7f, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x83, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0x6b, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6c, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x33, 0xff, 0xb3, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb4, 0xff, 0x37, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x60, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x64, 0xff, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x87, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x8c, 0xff, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x14, 0xff, 0x9b, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xa0, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x14, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x87, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x8f, 0xff, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x60, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x67, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x34, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x38, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6c, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xed, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x73, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x24, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xed, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xed, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0xff, 0x24, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x24, 0xff, 0x00, 0x00, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x00, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x13, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x13, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x47, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x4b, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x00, 
-  0xff, 0x10, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0x10, 
-  0xff, 0x3b, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0x3b, 
-  0xff, 0x63, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x6b, 
-  0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0x64, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x6c, 
-  0xff, 0x3b, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0x3b, 
-  0xff, 0x10, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0x10, 
-  0xff, 0x00, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x48, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x4b, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x13, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x13, 0xff, 0x00, 
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0xff, 0x28, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x27, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x27, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x27, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x6b, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x77, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x37, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x64, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x6c, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x8c, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x8f, 0xff, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x14, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x17, 0xff, 0xa0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xa7, 0xff, 0x17, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0x8c, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x8f, 0xff, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x64, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0x6c, 0xff, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x38, 0xff, 0xb8, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb8, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0x73, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x23, 0xff, 0x88, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x8b, 0xff, 0x27, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x23, 0xff, 0x7b, 0xff, 0xc7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xc8, 0xff, 0x7f, 0xff, 0x28, 0xff, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0x4b, 0xff, 0x93, 0xff, 0xc4, 0xff, 0xeb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xec, 0xff, 0xc4, 0xff, 0x94, 0xff, 0x4b, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0xff, 0x38, 0xff, 0x6b, 0xff, 0xa3, 0xff, 0xc0, 0xff, 0xd8, 0xff, 0xe3, 0xff, 0xf3, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xe3, 0xff, 0xd8, 0xff, 0xc3, 0xff, 0xa4, 0xff, 0x6c, 0xff, 0x3b, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x07, 0xff, 0x10, 0xff, 0x3b, 0xff, 0x63, 0xff, 0x87, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xe3, 0xff, 0xf4, 0x81, 0xff, 0xfc, 0x07, 0xff, 0xf4, 0xff, 0xe3, 
+  0xff, 0xdb, 0xff, 0xc0, 0xff, 0x8b, 0xff, 0x64, 0xff, 0x3c, 0xff, 0x10, 0xaa, 0x00, 0x00, 0x05, 0xff, 0x13, 0xff, 0x47, 0xff, 0x84, 0xff, 0xc4, 0xff, 0xec, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0x05, 
+  0xff, 0xfb, 0xff, 0xec, 0xff, 0xc4, 0xff, 0x87, 0xff, 0x47, 0xff, 0x13, 0xa4, 0x00, 0x00, 0x04, 0xff, 0x03, 0xff, 0x24, 0xff, 0x70, 0xff, 0xc7, 0xff, 0xf7, 0x93, 0xff, 0xff, 0x04, 0xff, 0xf7, 
+  0xff, 0xc8, 0xff, 0x73, 0xff, 0x27, 0xff, 0x03, 0xa0, 0x00, 0x00, 0x02, 0xff, 0x23, 0xff, 0x7f, 0xff, 0xdc, 0x99, 0xff, 0xff, 0x02, 0xff, 0xe0, 0xff, 0x83, 0xff, 0x24, 0x9d, 0x00, 0x00, 0x02, 
+  0xff, 0x10, 0xff, 0x6b, 0xff, 0xd7, 0x9d, 0xff, 0xff, 0x02, 0xff, 0xdb, 0xff, 0x6c, 0xff, 0x10, 0x9a, 0x00, 0x00, 0x02, 0xff, 0x33, 0xff, 0xb3, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0x02, 0xff, 0xfb, 
+  0xff, 0xb4, 0xff, 0x37, 0x97, 0x00, 0x00, 0x02, 0xff, 0x07, 0xff, 0x60, 0xff, 0xe0, 0xa3, 0xff, 0xff, 0x02, 0xff, 0xe3, 0xff, 0x64, 0xff, 0x07, 0x94, 0x00, 0x00, 0x02, 0xff, 0x0f, 0xff, 0x87, 
+  0xff, 0xf4, 0xa5, 0xff, 0xff, 0x02, 0xff, 0xf4, 0xff, 0x8c, 0xff, 0x10, 0x92, 0x00, 0x00, 0x02, 0xff, 0x14, 0xff, 0x9b, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0x02, 0xff, 0xfc, 0xff, 0xa0, 0xff, 0x17, 
+  0x90, 0x00, 0x00, 0x01, 0xff, 0x14, 0xff, 0xa3, 0xab, 0xff, 0xff, 0x01, 0xff, 0xa7, 0xff, 0x17, 0x8e, 0x00, 0x00, 0x01, 0xff, 0x10, 0xff, 0x9b, 0xad, 0xff, 0xff, 0x01, 0xff, 0xa0, 0xff, 0x10, 
+  0x8c, 0x00, 0x00, 0x02, 0xff, 0x07, 0xff, 0x87, 0xff, 0xfc, 0xad, 0xff, 0xff, 0x02, 0xff, 0xfc, 0xff, 0x8f, 0xff, 0x07, 0x8b, 0x00, 0x00, 0x01, 0xff, 0x60, 0xff, 0xf4, 0x98, 0xff, 0xff, 0x01, 
+  0xf6, 0xff, 0xf7, 0xff, 0x94, 0xff, 0xff, 0x01, 0xff, 0xf4, 0xff, 0x67, 0x8a, 0x00, 0x00, 0x01, 0xff, 0x34, 0xff, 0xe0, 0x99, 0xff, 0xff, 0x03, 0xf2, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xfb, 0xff, 
+  0x93, 0xff, 0xff, 0x01, 0xff, 0xe3, 0xff, 0x38, 0x88, 0x00, 0x00, 0x01, 0xff, 0x10, 0xff, 0xb3, 0x9a, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x81, 0xed, 0xff, 0x01, 0xee, 0xff, 0xf6, 0xff, 0x93, 0xff, 
+  0xff, 0x01, 0xff, 0xb8, 0xff, 0x13, 0x87, 0x00, 0x00, 0x01, 0xff, 0x6c, 0xff, 0xfb, 0x9a, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xed, 0xff, 0xee, 0xff, 0x81, 0xed, 0xff, 0x01, 0xf2, 0xff, 0xfb, 0xff, 
+  0x91, 0xff, 0xff, 0x01, 0xff, 0xfc, 0xff, 0x73, 0x86, 0x00, 0x00, 0x01, 0xff, 0x24, 0xff, 0xd7, 0x9b, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xed, 0xff, 0x81, 0xee, 0xff, 0x81, 0xed, 0xff, 0x01, 0xee, 
+  0xff, 0xfb, 0xff, 0x91, 0xff, 0xff, 0x01, 0xff, 0xd8, 0xff, 0x24, 0x85, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x9c, 0xff, 0xff, 0x01, 0xf6, 0xff, 0xed, 0xff, 0x81, 0xee, 0xff, 0x82, 0xed, 0xff, 0x01, 
+  0xee, 0xff, 0xfb, 0xff, 0x91, 0xff, 0xff, 0x00, 0xff, 0x88, 0x84, 0x00, 0x00, 0x01, 0xff, 0x24, 0xff, 0xdc, 0x9c, 0xff, 0xff, 0x01, 0xf2, 0xff, 0xed, 0xff, 0x82, 0xee, 0xff, 0x82, 0xed, 0xff, 
+  0x01, 0xee, 0xff, 0xfb, 0xff, 0x90, 0xff, 0xff, 0x01, 0xff, 0xdc, 0xff, 0x24, 0x83, 0x00, 0x00, 0x00, 0xff, 0x73, 0x9d, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x83, 0xee, 0xff, 0x83, 0xed, 0xff, 0x01, 
+  0xee, 0xff, 0xfb, 0xff, 0x90, 0xff, 0xff, 0x00, 0xff, 0x7b, 0x82, 0x00, 0x00, 0x01, 0xff, 0x13, 0xff, 0xc7, 0x9c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x85, 0xee, 0xff, 0x83, 0xed, 0xff, 0x00, 0xee, 
+  0xff, 0x90, 0xff, 0xff, 0x01, 0xff, 0xc7, 0xff, 0x13, 0x81, 0x00, 0x00, 0x01, 0xff, 0x47, 0xff, 0xf7, 0x9c, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x86, 0xee, 0xff, 0x83, 0xed, 0xff, 0x00, 0xf2, 0xff, 
+  0x8f, 0xff, 0xff, 0x01, 0xff, 0xf7, 0xff, 0x4b, 0x81, 0x00, 0x00, 0x00, 0xff, 0x84, 0x92, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 0xff, 0x88, 0xff, 0xff, 0x87, 0xee, 0xff, 0x84, 0xed, 0xff, 0x00, 
+  0xf6, 0xff, 0x8f, 0xff, 0xff, 0x03, 0xff, 0x93, 0x00, 0x00, 0xff, 0x10, 0xff, 0xc4, 0x91, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x81, 0xea, 0xff, 0x00, 0xfb, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf7, 0xff, 
+  0x88, 0xee, 0xff, 0x83, 0xed, 0xff, 0x01, 0xee, 0xff, 0xfb, 0xff, 0x8e, 0xff, 0xff, 0x03, 0xff, 0xc4, 0xff, 0x10, 0xff, 0x3b, 0xff, 0xec, 0x90, 0xff, 0xff, 0x00, 0xf3, 0xff, 0x82, 0xea, 0xff, 
+  0x00, 0xf7, 0xff, 0x85, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8a, 0xee, 0xff, 0x83, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x8e, 0xff, 0xff, 0x03, 0xff, 0xeb, 0xff, 0x3b, 0xff, 0x63, 0xff, 0xfb, 0x8f, 0xff, 
+  0xff, 0x00, 0xf7, 0xff, 0x83, 0xea, 0xff, 0x00, 0xf2, 0xff, 0x84, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8b, 0xee, 0xff, 0x83, 0xed, 0xff, 0x01, 0xee, 0xff, 0xfb, 0xff, 0x8d, 0xff, 0xff, 0x02, 0xff, 
+  0xfb, 0xff, 0x6b, 0xff, 0x88, 0x8f, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x84, 0xea, 0xff, 0x00, 0xee, 0xff, 0x83, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xee, 0xff, 0xea, 0xff, 0x8b, 0xee, 0xff, 0x83, 0xed, 
+  0xff, 0x00, 0xf6, 0xff, 0x8e, 0xff, 0xff, 0x01, 0xff, 0xa3, 0xff, 0xbf, 0x8f, 0xff, 0xff, 0x00, 0xee, 0xff, 0x85, 0xea, 0xff, 0x03, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xee, 0xff, 0x81, 0xea, 
+  0xff, 0x8c, 0xee, 0xff, 0x83, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x8e, 0xff, 0xff, 0x01, 0xff, 0xc0, 0xff, 0xd8, 0x8e, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x86, 0xea, 0xff, 0x81, 0xee, 0xff, 0x84, 0xea, 
+  0xff, 0x8c, 0xee, 0xff, 0x83, 0xed, 0xff, 0x00, 0xfb, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xff, 0xd8, 0xff, 0xe3, 0x8e, 0xff, 0xff, 0x00, 0xee, 0xff, 0x8e, 0xea, 0xff, 0x8c, 0xee, 0xff, 0x82, 0xed, 
+  0xff, 0x00, 0xf6, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xff, 0xe3, 0xff, 0xf4, 0x8d, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x8f, 0xea, 0xff, 0x8c, 0xee, 0xff, 0x82, 0xed, 0xff, 0x00, 0xf2, 0xff, 0x8d, 0xff, 
+  0xff, 0x01, 0xff, 0xf3, 0xff, 0xfc, 0x8d, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x90, 0xea, 0xff, 0x8c, 0xee, 0xff, 0x81, 0xed, 0xff, 0x00, 0xee, 0xff, 0x8d, 0xff, 0xff, 0x81, 0xff, 0xfc, 0x8d, 0xff, 
+  0xff, 0x00, 0xee, 0xff, 0x91, 0xea, 0xff, 0x8c, 0xee, 0xff, 0x01, 0xed, 0xff, 0xee, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xff, 0xfc, 0xff, 0xf4, 0x8c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x92, 0xea, 0xff, 
+  0x8c, 0xee, 0xff, 0x01, 0xed, 0xff, 0xee, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xff, 0xf3, 0xff, 0xe3, 0x8c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x93, 0xea, 0xff, 0x8d, 0xee, 0xff, 0x00, 0xfb, 0xff, 0x8c, 
+  0xff, 0xff, 0x01, 0xff, 0xe3, 0xff, 0xdb, 0x8c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x94, 0xea, 0xff, 0x8c, 0xee, 0xff, 0x00, 0xfb, 0xff, 0x8c, 0xff, 0xff, 0x01, 0xff, 0xd8, 0xff, 0xc0, 0x8c, 0xff, 
+  0xff, 0x00, 0xfb, 0xff, 0x94, 0xea, 0xff, 0x8c, 0xee, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xff, 0xc0, 0xff, 0x88, 0x8c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x95, 0xea, 0xff, 0x8b, 0xee, 0xff, 0x8d, 0xff, 
+  0xff, 0x02, 0xff, 0xa3, 0xff, 0x64, 0xff, 0xfb, 0x8c, 0xff, 0xff, 0x95, 0xea, 0xff, 0x8a, 0xee, 0xff, 0x00, 0xf2, 0xff, 0x8c, 0xff, 0xff, 0x03, 0xff, 0xfb, 0xff, 0x6c, 0xff, 0x3b, 0xff, 0xec, 
+  0x8c, 0xff, 0xff, 0x00, 0xee, 0xff, 0x95, 0xea, 0xff, 0x88, 0xee, 0xff, 0x01, 0xed, 0xff, 0xf2, 0xff, 0x8c, 0xff, 0xff, 0x03, 0xff, 0xec, 0xff, 0x3b, 0xff, 0x10, 0xff, 0xc4, 0x8c, 0xff, 0xff, 
+  0x00, 0xf3, 0xff, 0x96, 0xea, 0xff, 0x88, 0xee, 0xff, 0x00, 0xfb, 0xff, 0x8c, 0xff, 0xff, 0x03, 0xff, 0xc4, 0xff, 0x10, 0x00, 0x00, 0xff, 0x87, 0x8c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x96, 0xea, 
+  0xff, 0x88, 0xee, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xff, 0x93, 0x81, 0x00, 0x00, 0x01, 0xff, 0x48, 0xff, 0xf7, 0x8c, 0xff, 0xff, 0x00, 0xee, 0xff, 0x96, 0xea, 0xff, 0x86, 0xee, 0xff, 0x00, 0xf6, 
+  0xff, 0x8c, 0xff, 0xff, 0x01, 0xff, 0xf7, 0xff, 0x4b, 0x81, 0x00, 0x00, 0x01, 0xff, 0x13, 0xff, 0xc7, 0x8c, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x97, 0xea, 0xff, 0x85, 0xee, 0xff, 0x8d, 0xff, 0xff, 
+  0x01, 0xff, 0xc7, 0xff, 0x13, 0x82, 0x00, 0x00, 0x00, 0xff, 0x73, 0x8d, 0xff, 0xff, 0x00, 0xf3, 0xff, 0x96, 0xea, 0xff, 0x84, 0xee, 0xff, 0x00, 0xf7, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xff, 0x7f, 
+  0x83, 0x00, 0x00, 0x01, 0xff, 0x28, 0xff, 0xdf, 0x8d, 0xff, 0xff, 0x00, 0xee, 0xff, 0x96, 0xea, 0xff, 0x82, 0xee, 0xff, 0x00, 0xf2, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xff, 0xdf, 0xff, 0x27, 0x84, 
+  0x00, 0x00, 0x00, 0xff, 0x83, 0x8d, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x98, 0xea, 0xff, 0x00, 0xf2, 0xff, 0x8e, 0xff, 0xff, 0x00, 0xff, 0x8b, 0x85, 0x00, 0x00, 0x01, 0xff, 0x27, 0xff, 0xd8, 0x8d, 
+  0xff, 0xff, 0x00, 0xfb, 0xff, 0x96, 0xea, 0xff, 0x00, 0xf2, 0xff, 0x8e, 0xff, 0xff, 0x01, 0xff, 0xdb, 0xff, 0x27, 0x86, 0x00, 0x00, 0x01, 0xff, 0x6b, 0xff, 0xfb, 0x8d, 0xff, 0xff, 0x01, 0xfb, 
+  0xff, 0xee, 0xff, 0x92, 0xea, 0xff, 0x01, 0xee, 0xff, 0xf7, 0xff, 0x8e, 0xff, 0xff, 0x01, 0xff, 0xfc, 0xff, 0x77, 0x87, 0x00, 0x00, 0x01, 0xff, 0x10, 0xff, 0xb3, 0x8f, 0xff, 0xff, 0x00, 0xf7, 
+  0xff, 0x90, 0xea, 0xff, 0x01, 0xee, 0xff, 0xfb, 0xff, 0x8f, 0xff, 0xff, 0x01, 0xff, 0xb8, 0xff, 0x10, 0x88, 0x00, 0x00, 0x01, 0xff, 0x37, 0xff, 0xe3, 0x90, 0xff, 0xff, 0x01, 0xf3, 0xff, 0xee, 
+  0xff, 0x8a, 0xea, 0xff, 0x02, 0xee, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0x90, 0xff, 0xff, 0x01, 0xff, 0xe4, 0xff, 0x3c, 0x8a, 0x00, 0x00, 0x01, 0xff, 0x64, 0xff, 0xf4, 0x91, 0xff, 0xff, 0x02, 0xfb, 
+  0xff, 0xf3, 0xff, 0xf2, 0xff, 0x84, 0xee, 0xff, 0x81, 0xf2, 0xff, 0x00, 0xf7, 0xff, 0x92, 0xff, 0xff, 0x01, 0xff, 0xf7, 0xff, 0x6c, 0x8b, 0x00, 0x00, 0x02, 0xff, 0x07, 0xff, 0x8c, 0xff, 0xfc, 
+  0xad, 0xff, 0xff, 0x02, 0xff, 0xfc, 0xff, 0x8f, 0xff, 0x07, 0x8c, 0x00, 0x00, 0x01, 0xff, 0x10, 0xff, 0xa0, 0xad, 0xff, 0xff, 0x01, 0xff, 0xa4, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x01, 0xff, 0x14, 
+  0xff, 0xa7, 0xab, 0xff, 0xff, 0x01, 0xff, 0xab, 0xff, 0x17, 0x90, 0x00, 0x00, 0x02, 0xff, 0x17, 0xff, 0xa0, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0x02, 0xff, 0xfc, 0xff, 0xa7, 0xff, 0x17, 0x92, 0x00, 
+  0x00, 0x02, 0xff, 0x10, 0xff, 0x8c, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0x02, 0xff, 0xf4, 0xff, 0x8f, 0xff, 0x13, 0x94, 0x00, 0x00, 0x02, 0xff, 0x07, 0xff, 0x64, 0xff, 0xe3, 0xa3, 0xff, 0xff, 0x02, 
+  0xff, 0xe4, 0xff, 0x6c, 0xff, 0x07, 0x97, 0x00, 0x00, 0x02, 0xff, 0x38, 0xff, 0xb8, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0x02, 0xff, 0xfb, 0xff, 0xb8, 0xff, 0x3c, 0x9a, 0x00, 0x00, 0x02, 0xff, 0x10, 
+  0xff, 0x73, 0xff, 0xd8, 0x9d, 0xff, 0xff, 0x02, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x10, 0x9d, 0x00, 0x00, 0x02, 0xff, 0x23, 0xff, 0x88, 0xff, 0xdc, 0x99, 0xff, 0xff, 0x02, 0xff, 0xe0, 0xff, 0x8b, 
+  0xff, 0x27, 0xa0, 0x00, 0x00, 0x04, 0xff, 0x03, 0xff, 0x23, 0xff, 0x7b, 0xff, 0xc7, 0xff, 0xf7, 0x93, 0xff, 0xff, 0x04, 0xff, 0xf7, 0xff, 0xc8, 0xff, 0x7f, 0xff, 0x28, 0xff, 0x03, 0xa4, 0x00, 
+  0x00, 0x05, 0xff, 0x10, 0xff, 0x4b, 0xff, 0x93, 0xff, 0xc4, 0xff, 0xeb, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0x05, 0xff, 0xfb, 0xff, 0xec, 0xff, 0xc4, 0xff, 0x94, 0xff, 0x4b, 0xff, 0x13, 0xaa, 0x00, 
+  0x00, 0x07, 0xff, 0x10, 0xff, 0x38, 0xff, 0x6b, 0xff, 0xa3, 0xff, 0xc0, 0xff, 0xd8, 0xff, 0xe3, 0xff, 0xf3, 0x81, 0xff, 0xfc, 0x07, 0xff, 0xf4, 0xff, 0xe3, 0xff, 0xd8, 0xff, 0xc3, 0xff, 0xa4, 
+  0xff, 0x6c, 0xff, 0x3b, 0xff, 0x10, 0x96, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x63, 0xff, 0xff, 0x87, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x64, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0x47, 0xff, 0xff, 0x84, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xec, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x87, 0xff, 0xff, 0x47, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x24, 0xff, 0xff, 0x70, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x73, 0xff, 0xff, 0x27, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x83, 0xff, 0xff, 0x24, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb4, 0xff, 0xff, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x60, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x64, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8c, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x60, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf4, 0xfc, 0xff, 0x96, 0xfd, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x67, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0xfc, 0xff, 0xec, 0xfa, 0xff, 0xf0, 0xfb, 0xff, 0x38, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x38, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfc, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x2c, 0xfb, 0xff, 0xd3, 0xfc, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xfd, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0xef, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x73, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x24, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xfd, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x6d, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0x24, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xfc, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x4d, 0xfb, 0xff, 0xb6, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x24, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x31, 0xfc, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x4c, 0xfb, 0xff, 0xb6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x24, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x8f, 0xfb, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x4d, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0xff, 0xed, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x8d, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x47, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfd, 0xff, 0xac, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0b, 0xfb, 0xff, 0x10, 0xfc, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xb8, 0xfd, 0xff, 0x71, 0xfb, 0xff, 0xbc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0x4f, 0xfb, 0xff, 0xac, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0x0b, 0xfb, 0xff, 0x14, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xd5, 0xfc, 0xff, 0x6e, 0xfa, 0xff, 0x6e, 0xfa, 0xff, 0x7a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd4, 0xfc, 0xff, 0xac, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x6d, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 
-  0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x75, 0xfc, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x57, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xfd, 0xff, 0xcd, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0b, 0xfb, 0xff, 0x71, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x3b, 
-  0xff, 0xff, 0x63, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0xfc, 0xff, 0x2e, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x33, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xfd, 0xff, 0xee, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x4c, 0xfb, 0xff, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6b, 
-  0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xfd, 0xff, 0x4e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x10, 0xfb, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xce, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0b, 0xfb, 0xff, 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xf0, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x16, 0xfd, 0xff, 0x3d, 0xff, 0xff, 0x77, 0xfd, 0xff, 0x70, 0xfb, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0xae, 0xfb, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfc, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xef, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xb0, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0b, 0xfb, 0xff, 0xd3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xfd, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x30, 0xfc, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd4, 0xfb, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x8e, 0xfb, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xb1, 0xfa, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x0c, 0xfb, 0xff, 0x4d, 0xfb, 0xff, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xfe, 0xff, 0x2f, 0xfa, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xfe, 0xff, 0x0f, 0xfa, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfd, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x0c, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xff, 0xef, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x2d, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xfe, 0xff, 0x0f, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x2d, 0xfb, 0xff, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0x64, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xfe, 0xff, 0x30, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xaf, 0xfb, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6c, 
-  0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x12, 0xfb, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0x72, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0x3b, 
-  0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xfc, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0x96, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xfe, 0xff, 0xef, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0x6e, 0xfb, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x48, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x53, 0xfb, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0xac, 0xfa, 0xff, 0xd4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfd, 0xff, 0xef, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xac, 0xfa, 0xff, 0x4e, 0xfb, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xd4, 0xfb, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0xad, 0xfa, 0xff, 0x76, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xfe, 0xff, 0xb1, 0xfa, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8c, 0xfa, 0xff, 0x73, 0xfc, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xfe, 0xff, 0x50, 0xfa, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0xf1, 0xfb, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x27, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xfe, 0xff, 0x70, 0xfa, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x12, 0xfc, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xfe, 0xff, 0x32, 0xfb, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xb4, 0xfc, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x77, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0x96, 0xfc, 0xff, 0x70, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x2e, 0xfa, 0xff, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x6d, 0xfa, 0xff, 0x91, 0xfb, 0xff, 0xf9, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x37, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xfe, 0xff, 0x55, 0xfc, 0xff, 0xb1, 0xfa, 0xff, 0xee, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0xee, 0xf9, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x0d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xd2, 0xfb, 0xff, 0x98, 0xfd, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xd9, 0xfd, 0xff, 0x75, 0xfc, 0xff, 0x93, 0xfb, 0xff, 0x52, 0xfb, 0xff, 0xf0, 0xfa, 0xff, 0xd0, 0xfa, 0xff, 0xf1, 0xfa, 0xff, 0x51, 0xfb, 0xff, 0xb2, 0xfb, 0xff, 0x34, 0xfc, 0xff, 0x57, 0xfd, 0xff, 0xbc, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x5e, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x64, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x38, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x73, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x77, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x23, 0xff, 0xff, 0x88, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x28, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x94, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x38, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x10, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x63, 0xff, 0xff, 0x87, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xe3, 0xff, 0xff, 
+  0xf4, 0x81, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x64, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x10, 0xaa, 0x00, 
+  0x00, 0x00, 0x05, 0xff, 0xff, 0x13, 0xff, 0xff, 0x47, 0xff, 0xff, 0x84, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xec, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 
+  0xff, 0xff, 0xc4, 0xff, 0xff, 0x87, 0xff, 0xff, 0x47, 0xff, 0xff, 0x13, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x24, 0xff, 0xff, 0x70, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 
+  0x93, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x73, 0xff, 0xff, 0x27, 0xff, 0xff, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7f, 0xff, 
+  0xff, 0xdc, 0x99, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x83, 0xff, 0xff, 0x24, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd7, 0x9d, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x10, 0x9a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x33, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xfb, 0xff, 0xff, 0xb4, 0xff, 0xff, 0x37, 0x97, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x60, 0xff, 0xff, 0xe0, 0xa3, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe3, 0xff, 0xff, 
+  0x64, 0xff, 0xff, 0x07, 0x94, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8c, 0xff, 0xff, 0x10, 
+  0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x14, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa3, 0xab, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0x9b, 0xad, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfc, 0x97, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x94, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x60, 0xff, 0xff, 0xf4, 0x97, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0xf4, 
+  0xfc, 0xff, 0x96, 0xfd, 0xff, 0x7d, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x67, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe0, 0x99, 0xff, 
+  0xff, 0xff, 0x04, 0x51, 0xfc, 0xff, 0xec, 0xfa, 0xff, 0xf0, 0xfb, 0xff, 0x38, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x38, 0x88, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0x9a, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xfc, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x02, 0x2c, 0xfb, 0xff, 0xd3, 0xfc, 0xff, 0x3d, 0xff, 0xff, 0x92, 0xff, 
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x13, 0x87, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xfb, 0x9a, 0xff, 0xff, 0xff, 0x01, 0x35, 0xfd, 0xff, 0xec, 0xfa, 0xff, 0x82, 
+  0x0c, 0xfb, 0xff, 0x01, 0xef, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x73, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x24, 0xff, 0xff, 0xd7, 
+  0x9b, 0xff, 0xff, 0xff, 0x02, 0x35, 0xfd, 0xff, 0xcc, 0xfa, 0xff, 0xec, 0xfa, 0xff, 0x82, 0x0c, 0xfb, 0xff, 0x01, 0x6d, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xd8, 0xff, 0xff, 0x24, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x9c, 0xff, 0xff, 0xff, 0x01, 0xb3, 0xfc, 0xff, 0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x82, 0x0c, 0xfb, 0xff, 0x02, 
+  0x4d, 0xfb, 0xff, 0xb6, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x88, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x24, 0xff, 0xff, 0xdc, 0x9b, 0xff, 0xff, 0xff, 
+  0x02, 0xdf, 0xff, 0xff, 0x31, 0xfc, 0xff, 0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x83, 0x0c, 0xfb, 0xff, 0x01, 0x4c, 0xfb, 0xff, 0xb6, 0xfd, 0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xdc, 0xff, 0xff, 0x24, 0x83, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x73, 0x9c, 0xff, 0xff, 0xff, 0x02, 0x7e, 0xff, 0xff, 0x8f, 0xfb, 0xff, 0xcc, 0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 0x83, 0x0c, 
+  0xfb, 0xff, 0x01, 0x4d, 0xfb, 0xff, 0x18, 0xfe, 0xff, 0x90, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7b, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0x9c, 0xff, 0xff, 0xff, 
+  0x02, 0x7a, 0xfe, 0xff, 0xed, 0xfa, 0xff, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x83, 0x0c, 0xfb, 0xff, 0x01, 0x8d, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xc7, 0xff, 0xff, 0x13, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x47, 0xff, 0xff, 0xf7, 0x92, 0xff, 0xff, 0xff, 0x01, 0x5d, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x15, 
+  0xfd, 0xff, 0xac, 0xfa, 0xff, 0x81, 0xcc, 0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 0x83, 0x0c, 0xfb, 0xff, 0x02, 0x0b, 0xfb, 0xff, 0x10, 0xfc, 0xff, 0x5d, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x84, 0x91, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0xb8, 0xfd, 0xff, 0x71, 0xfb, 0xff, 0xbc, 0xfe, 0xff, 0x86, 
+  0xff, 0xff, 0xff, 0x02, 0x1c, 0xff, 0xff, 0x4f, 0xfb, 0xff, 0xac, 0xfa, 0xff, 0x81, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x82, 0x0c, 0xfb, 0xff, 0x02, 0x2c, 0xfb, 0xff, 0x0b, 0xfb, 0xff, 
+  0x14, 0xfd, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0x90, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xff, 0xff, 0xd5, 0xfc, 0xff, 0x81, 
+  0x6e, 0xfa, 0xff, 0x00, 0x7a, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0xd4, 0xfc, 0xff, 0xac, 0xfa, 0xff, 0xcd, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 
+  0x84, 0x0c, 0xfb, 0xff, 0x01, 0x6d, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0x8f, 0xff, 0xff, 0xff, 
+  0x01, 0x9f, 0xff, 0xff, 0x75, 0xfc, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x00, 0x57, 0xfd, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xb8, 0xfd, 0xff, 0xcd, 0xfa, 0xff, 0x81, 0xad, 0xfa, 0xff, 0x83, 0xcc, 
+  0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 0x83, 0x0c, 0xfb, 0xff, 0x02, 0x0b, 0xfb, 0xff, 0x71, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x3b, 0xff, 
+  0xff, 0x63, 0xff, 0xff, 0xfb, 0x8e, 0xff, 0xff, 0xff, 0x06, 0xdf, 0xff, 0xff, 0xd6, 0xfc, 0xff, 0x2e, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0x2d, 0xfa, 0xff, 0x33, 0xfc, 0xff, 0x84, 
+  0xff, 0xff, 0xff, 0x02, 0xd8, 0xfd, 0xff, 0xee, 0xfa, 0xff, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x83, 0x0c, 0xfb, 0xff, 0x01, 0x4c, 0xfb, 
+  0xff, 0x79, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x88, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xb9, 0xfd, 0xff, 0x4e, 0xfa, 0xff, 0x81, 0x2e, 0xfa, 
+  0xff, 0x81, 0x4d, 0xfa, 0xff, 0x01, 0x10, 0xfb, 0xff, 0x3d, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0x5e, 0xff, 0xff, 0xf5, 0xfc, 0xff, 0xce, 0xfa, 0xff, 0x81, 0x8d, 0xfa, 0xff, 0x82, 0xad, 
+  0xfa, 0xff, 0x00, 0xcd, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 0x83, 0x0c, 0xfb, 0xff, 0x01, 0x0b, 0xfb, 0xff, 0xd2, 0xfc, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xa3, 0xff, 0xff, 0xbf, 0x8e, 0xff, 0xff, 0xff, 0x02, 0x1d, 0xff, 0xff, 0xf0, 0xfa, 0xff, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x81, 0x4d, 0xfa, 0xff, 0x04, 0x16, 0xfd, 0xff, 0x3d, 0xff, 
+  0xff, 0x77, 0xfd, 0xff, 0x70, 0xfb, 0xff, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x83, 0x0c, 0xfb, 0xff, 0x01, 0xae, 
+  0xfb, 0xff, 0x3c, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xd8, 0x8e, 0xff, 0xff, 0xff, 0x00, 0xd6, 0xfc, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 
+  0x03, 0x4e, 0xfa, 0xff, 0x4d, 0xfa, 0xff, 0xae, 0xfa, 0xff, 0xef, 0xfa, 0xff, 0x82, 0x6d, 0xfa, 0xff, 0x83, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x00, 0xcd, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 
+  0xff, 0x83, 0xec, 0xfa, 0xff, 0x82, 0x0c, 0xfb, 0xff, 0x01, 0x2c, 0xfb, 0xff, 0xf7, 0xfd, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xe3, 0x8d, 0xff, 0xff, 0xff, 0x01, 
+  0x1d, 0xff, 0xff, 0xb0, 0xfa, 0xff, 0x81, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x83, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x00, 0xcd, 
+  0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 0x82, 0x0c, 0xfb, 0xff, 0x01, 0x0b, 0xfb, 0xff, 0xd3, 0xfc, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf4, 
+  0x8d, 0xff, 0xff, 0xff, 0x01, 0x78, 0xfd, 0xff, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 
+  0xad, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x82, 0x0c, 0xfb, 0xff, 0x01, 0x30, 0xfc, 0xff, 0xbf, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf3, 0xff, 0xff, 
+  0xfc, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xd4, 0xfb, 0xff, 0xee, 0xf9, 0xff, 0x83, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x82, 
+  0x6d, 0xfa, 0xff, 0x83, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x00, 0xcd, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x81, 0x0c, 0xfb, 0xff, 0x01, 0x8e, 0xfb, 0xff, 0x3c, 
+  0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfc, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x5e, 0xff, 0xff, 0xb1, 0xfa, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 
+  0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 0x83, 0xcc, 0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 0x81, 0x0c, 0xfb, 0xff, 0x01, 0x4d, 0xfb, 
+  0xff, 0xdb, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf4, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x9c, 0xfe, 0xff, 0x2f, 0xfa, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x83, 0x0e, 
+  0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x83, 0xec, 
+  0xfa, 0xff, 0x02, 0x0c, 0xfb, 0xff, 0x2c, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xe3, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x3b, 0xfe, 0xff, 0x0f, 
+  0xfa, 0xff, 0x82, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x83, 0x4d, 0xfa, 0xff, 0x82, 0x6d, 0xfa, 0xff, 0x83, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x00, 0xcd, 
+  0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x01, 0x0c, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xdb, 0x8c, 0xff, 0xff, 0xff, 
+  0x00, 0xda, 0xfd, 0xff, 0x84, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 
+  0x82, 0xcc, 0xfa, 0xff, 0x83, 0xec, 0xfa, 0xff, 0x01, 0x0c, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xc0, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xfa, 
+  0xfd, 0xff, 0xef, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0x82, 0xee, 0xf9, 0xff, 0x83, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x82, 0x6d, 0xfa, 0xff, 
+  0x83, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x82, 0xec, 0xfa, 0xff, 0x01, 0x2d, 0xfb, 0xff, 0x9a, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xc0, 0xff, 
+  0xff, 0x88, 0x8c, 0xff, 0xff, 0xff, 0x02, 0x7b, 0xfe, 0xff, 0x0f, 0xfa, 0xff, 0xce, 0xf9, 0xff, 0x83, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 
+  0x83, 0x6d, 0xfa, 0xff, 0x83, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x00, 0xcd, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x81, 0xec, 0xfa, 0xff, 0x01, 0x2d, 0xfb, 0xff, 0xdb, 0xfe, 0xff, 0x8c, 
+  0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xa3, 0xff, 0xff, 0x64, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xdc, 0xfe, 0xff, 0x30, 0xfa, 0xff, 0x81, 0xce, 0xf9, 0xff, 0x82, 0xee, 0xf9, 0xff, 
+  0x83, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 0x82, 0xcc, 0xfa, 0xff, 0x03, 0xec, 0xfa, 0xff, 
+  0xcc, 0xfa, 0xff, 0xaf, 0xfb, 0xff, 0x7e, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0x8b, 0xff, 0xff, 0xff, 0x03, 0x9f, 
+  0xff, 0xff, 0x12, 0xfb, 0xff, 0xae, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0x83, 0xee, 0xf9, 0xff, 0x83, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x82, 
+  0x6d, 0xfa, 0xff, 0x83, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x00, 0xcd, 0xfa, 0xff, 0x83, 0xcc, 0xfa, 0xff, 0x00, 0x72, 0xfc, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xec, 0xff, 
+  0xff, 0x3b, 0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x76, 0xfc, 0xff, 0xae, 0xf9, 0xff, 0x81, 0xce, 0xf9, 0xff, 0x83, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 
+  0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 0x83, 0xcc, 0xfa, 0xff, 0x00, 0x96, 0xfd, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x03, 
+  0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0x87, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x3b, 0xfe, 0xff, 0xef, 0xf9, 0xff, 0x82, 0xce, 0xf9, 0xff, 0x82, 0xee, 0xf9, 0xff, 0x83, 
+  0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x83, 0xad, 0xfa, 0xff, 0x81, 0xcc, 0xfa, 0xff, 0x01, 
+  0x6e, 0xfb, 0xff, 0x1c, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x93, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x48, 0xff, 0xff, 0xf7, 0x8b, 0xff, 0xff, 0xff, 0x02, 0x9f, 0xff, 
+  0xff, 0x53, 0xfb, 0xff, 0xae, 0xf9, 0xff, 0x81, 0xce, 0xf9, 0xff, 0x83, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x83, 0x4d, 0xfa, 0xff, 0x82, 0x6d, 0xfa, 0xff, 0x83, 
+  0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x02, 0xcd, 0xfa, 0xff, 0xac, 0xfa, 0xff, 0xd4, 0xfc, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0x81, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xda, 0xfd, 0xff, 0xef, 0xf9, 0xff, 0x82, 0xce, 0xf9, 0xff, 0x83, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 
+  0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 0xff, 0x02, 0xac, 0xfa, 0xff, 0x4e, 0xfb, 0xff, 0xfc, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 
+  0x01, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x13, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x73, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xbf, 0xff, 0xff, 0xd4, 0xfb, 0xff, 0xae, 0xf9, 0xff, 0x82, 0xce, 0xf9, 
+  0xff, 0x82, 0xee, 0xf9, 0xff, 0x83, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x82, 0x6d, 0xfa, 0xff, 0x83, 0x8d, 0xfa, 0xff, 0x82, 0xad, 0xfa, 
+  0xff, 0x00, 0x76, 0xfd, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xdf, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xdd, 0xfe, 0xff, 
+  0xb1, 0xfa, 0xff, 0xae, 0xf9, 0xff, 0x81, 0xce, 0xf9, 0xff, 0x83, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x83, 0x8d, 
+  0xfa, 0xff, 0x02, 0x8c, 0xfa, 0xff, 0x73, 0xfc, 0xff, 0xbf, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x27, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x83, 0x8d, 
+  0xff, 0xff, 0xff, 0x02, 0x3b, 0xfe, 0xff, 0x50, 0xfa, 0xff, 0xae, 0xf9, 0xff, 0x81, 0xce, 0xf9, 0xff, 0x82, 0xee, 0xf9, 0xff, 0x83, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 
+  0xff, 0x83, 0x6d, 0xfa, 0xff, 0x82, 0x8d, 0xfa, 0xff, 0x01, 0xf1, 0xfb, 0xff, 0x5d, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0x85, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x27, 
+  0xff, 0xff, 0xd8, 0x8d, 0xff, 0xff, 0xff, 0x02, 0x1a, 0xfe, 0xff, 0x70, 0xfa, 0xff, 0xae, 0xf9, 0xff, 0x81, 0xce, 0xf9, 0xff, 0x82, 0xee, 0xf9, 0xff, 0x83, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 
+  0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x83, 0x6d, 0xfa, 0xff, 0x02, 0x8d, 0xfa, 0xff, 0x12, 0xfc, 0xff, 0x3d, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xdb, 0xff, 
+  0xff, 0x27, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xfb, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x7c, 0xfe, 0xff, 0x32, 0xfb, 0xff, 0x81, 0xce, 0xf9, 0xff, 0x83, 0xee, 0xf9, 0xff, 
+  0x82, 0x0e, 0xfa, 0xff, 0x83, 0x2e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x82, 0x6d, 0xfa, 0xff, 0x02, 0xae, 0xfa, 0xff, 0xb4, 0xfc, 0xff, 0x7e, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 
+  0xff, 0xfc, 0xff, 0xff, 0x77, 0x87, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0x8e, 0xff, 0xff, 0xff, 0x02, 0x5e, 0xff, 0xff, 0x96, 0xfc, 0xff, 0x70, 0xfa, 0xff, 0x81, 0xce, 
+  0xf9, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x83, 0x0e, 0xfa, 0xff, 0x82, 0x2e, 0xfa, 0xff, 0x00, 0x4e, 0xfa, 0xff, 0x82, 0x4d, 0xfa, 0xff, 0x03, 0x6d, 0xfa, 0xff, 0x91, 0xfb, 0xff, 0xf9, 0xfd, 0xff, 
+  0xdf, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x10, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x37, 0xff, 0xff, 0xe3, 0x8f, 0xff, 0xff, 0xff, 0x04, 0xbc, 0xfe, 
+  0xff, 0x55, 0xfc, 0xff, 0xb1, 0xfa, 0xff, 0xee, 0xf9, 0xff, 0xce, 0xf9, 0xff, 0x81, 0xee, 0xf9, 0xff, 0x82, 0x0e, 0xfa, 0xff, 0x81, 0x0d, 0xfa, 0xff, 0x81, 0x2d, 0xfa, 0xff, 0x03, 0xae, 0xfa, 
+  0xff, 0xd2, 0xfb, 0xff, 0x98, 0xfd, 0xff, 0x7e, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x3c, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf4, 
+  0x90, 0xff, 0xff, 0xff, 0x0d, 0x3e, 0xff, 0xff, 0xd9, 0xfd, 0xff, 0x75, 0xfc, 0xff, 0x93, 0xfb, 0xff, 0x52, 0xfb, 0xff, 0xf0, 0xfa, 0xff, 0xd0, 0xfa, 0xff, 0xf1, 0xfa, 0xff, 0x51, 0xfb, 0xff, 
+  0xb2, 0xfb, 0xff, 0x34, 0xfc, 0xff, 0x57, 0xfd, 0xff, 0xbc, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x6c, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0xff, 0x07, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xfc, 0x92, 0xff, 0xff, 0xff, 0x06, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x5e, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 
+  0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0x8c, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0xa0, 0xad, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xa4, 0xff, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa7, 0xab, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xab, 0xff, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 
+  0x02, 0xff, 0xff, 0x17, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10, 
+  0xff, 0xff, 0x8c, 0xff, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x13, 0x94, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x64, 0xff, 
+  0xff, 0xe3, 0xa3, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x07, 0x97, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x38, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xfb, 0x9f, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x3c, 0x9a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10, 0xff, 0xff, 0x73, 0xff, 0xff, 0xd8, 0x9d, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xdb, 0xff, 0xff, 0x77, 0xff, 0xff, 0x10, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x23, 0xff, 0xff, 0x88, 0xff, 0xff, 0xdc, 0x99, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 
+  0x8b, 0xff, 0xff, 0x27, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 0x93, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xf7, 
+  0xff, 0xff, 0xc8, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x28, 0xff, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0x10, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xeb, 
+  0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x94, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x13, 0xaa, 0x00, 0x00, 0x00, 0x07, 0xff, 
+  0xff, 0x10, 0xff, 0xff, 0x38, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf3, 0x81, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xf4, 0xff, 
+  0xff, 0xe3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x10, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x63, 0xff, 0xff, 0x87, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x64, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0x47, 0xff, 0xff, 0x84, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xec, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x87, 0xff, 0xff, 0x47, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x24, 0xff, 0xff, 0x70, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x73, 0xff, 0xff, 0x27, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x83, 0xff, 0xff, 0x24, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x33, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb4, 0xff, 0xff, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x60, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x64, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8c, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x60, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfc, 0xf4, 0xff, 0xfd, 0x96, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x67, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x51, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0xf0, 0xff, 0xfe, 0x38, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x38, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x2c, 0xff, 0xfc, 0xd3, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x35, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0xef, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x73, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x24, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x35, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x6d, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0x24, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb3, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x4d, 0xff, 0xfd, 0xb6, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x24, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfc, 0x31, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x4c, 0xff, 0xfd, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x24, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xfb, 0x8f, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x4d, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7a, 0xff, 0xfa, 0xed, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x8d, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x47, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x15, 0xff, 0xfa, 0xac, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0b, 0xff, 0xfc, 0x10, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xb8, 0xff, 0xfb, 0x71, 0xff, 0xfe, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xfb, 0x4f, 0xff, 0xfa, 0xac, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfb, 0x0b, 0xff, 0xfd, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfc, 0xd5, 0xff, 0xfa, 0x6e, 0xff, 0xfa, 0x6e, 0xff, 0xfe, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfc, 0xd4, 0xff, 0xfa, 0xac, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x6d, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 
-  0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfc, 0x75, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfd, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb8, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0b, 0xff, 0xfc, 0x71, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x3b, 
-  0xff, 0xff, 0x63, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfc, 0xd6, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x2d, 0xff, 0xfc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xd8, 0xff, 0xfa, 0xee, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x4c, 0xff, 0xfe, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6b, 
-  0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb9, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfb, 0x10, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xfc, 0xf5, 0xff, 0xfa, 0xce, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0b, 0xff, 0xfc, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xfa, 0xf0, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfd, 0x16, 0xff, 0xff, 0x3d, 0xff, 0xfd, 0x77, 0xff, 0xfb, 0x70, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0xae, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd6, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xef, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xfa, 0xb0, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0b, 0xff, 0xfc, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x78, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfc, 0x30, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfb, 0xd4, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x8e, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xfa, 0xb1, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x4d, 0xff, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9c, 0xff, 0xfa, 0x2f, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3b, 0xff, 0xfa, 0x0f, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfe, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xda, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x0c, 0xff, 0xfe, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0xf9, 0xef, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x2d, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7b, 0xff, 0xfa, 0x0f, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0x2d, 0xff, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0x64, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdc, 0xff, 0xfa, 0x30, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0xfa, 0xcc, 0xff, 0xfb, 0xaf, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6c, 
-  0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfb, 0x12, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfc, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0x3b, 
-  0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x76, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfd, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3b, 0xff, 0xf9, 0xef, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xcc, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x48, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfb, 0x53, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xcd, 0xff, 0xfa, 0xac, 0xff, 0xfc, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xda, 0xff, 0xf9, 0xef, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xac, 0xff, 0xfb, 0x4e, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfb, 0xd4, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfa, 0xad, 0xff, 0xfd, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x28, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdd, 0xff, 0xfa, 0xb1, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8c, 0xff, 0xfc, 0x73, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3b, 0xff, 0xfa, 0x50, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfa, 0x8d, 0xff, 0xfb, 0xf1, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x27, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1a, 0xff, 0xfa, 0x70, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x8d, 0xff, 0xfc, 0x12, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7c, 0xff, 0xfb, 0x32, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0x6d, 0xff, 0xfa, 0xae, 0xff, 0xfc, 0xb4, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x77, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xfc, 0x96, 0xff, 0xfa, 0x70, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x6d, 0xff, 0xfb, 0x91, 0xff, 0xfd, 0xf9, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x37, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbc, 0xff, 0xfc, 0x55, 0xff, 0xfa, 0xb1, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xce, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xee, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0e, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x0d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0xae, 0xff, 0xfb, 0xd2, 0xff, 0xfd, 0x98, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xfd, 0xd9, 0xff, 0xfc, 0x75, 0xff, 0xfb, 0x93, 0xff, 0xfb, 0x52, 0xff, 0xfa, 0xf0, 0xff, 0xfa, 0xd0, 0xff, 0xfa, 0xf1, 0xff, 0xfb, 0x51, 0xff, 0xfb, 0xb2, 0xff, 0xfc, 0x34, 0xff, 0xfd, 0x57, 0xff, 0xfe, 0xbc, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x5e, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x17, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xff, 0x64, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x38, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x73, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x77, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x23, 0xff, 0xff, 0x88, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x28, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x94, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0x38, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x10, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x63, 0xff, 0xff, 0x87, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xe3, 0xff, 0xff, 
+  0xf4, 0x81, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x64, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x10, 0xaa, 0x00, 
+  0x00, 0x00, 0x05, 0xff, 0xff, 0x13, 0xff, 0xff, 0x47, 0xff, 0xff, 0x84, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xec, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 
+  0xff, 0xff, 0xc4, 0xff, 0xff, 0x87, 0xff, 0xff, 0x47, 0xff, 0xff, 0x13, 0xa4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x24, 0xff, 0xff, 0x70, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 
+  0x93, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x73, 0xff, 0xff, 0x27, 0xff, 0xff, 0x03, 0xa0, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7f, 0xff, 
+  0xff, 0xdc, 0x99, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x83, 0xff, 0xff, 0x24, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xd7, 0x9d, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x10, 0x9a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x33, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xfb, 0xff, 0xff, 0xb4, 0xff, 0xff, 0x37, 0x97, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x60, 0xff, 0xff, 0xe0, 0xa3, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe3, 0xff, 0xff, 
+  0x64, 0xff, 0xff, 0x07, 0x94, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x87, 0xff, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8c, 0xff, 0xff, 0x10, 
+  0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x14, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa3, 0xab, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0x9b, 0xad, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xff, 0xa0, 0xff, 0xff, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x87, 0xff, 0xff, 0xfc, 0x97, 0xff, 0xff, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x94, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x60, 0xff, 0xff, 0xf4, 0x97, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xfc, 
+  0xf4, 0xff, 0xfd, 0x96, 0xff, 0xff, 0x7d, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x67, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x34, 0xff, 0xff, 0xe0, 0x99, 0xff, 
+  0xff, 0xff, 0x04, 0xfc, 0x51, 0xff, 0xfa, 0xec, 0xff, 0xfb, 0xf0, 0xff, 0xfe, 0x38, 0xff, 0xff, 0xdf, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x38, 0x88, 0x00, 0x00, 
+  0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0x9a, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xf4, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x02, 0xfb, 0x2c, 0xff, 0xfc, 0xd3, 0xff, 0xff, 0x3d, 0xff, 0x92, 0xff, 
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x13, 0x87, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xfb, 0x9a, 0xff, 0xff, 0xff, 0x01, 0xfd, 0x35, 0xff, 0xfa, 0xec, 0xff, 0x82, 
+  0xfb, 0x0c, 0xff, 0x01, 0xfb, 0xef, 0xff, 0xfe, 0x9a, 0xff, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x73, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x24, 0xff, 0xff, 0xd7, 
+  0x9b, 0xff, 0xff, 0xff, 0x02, 0xfd, 0x35, 0xff, 0xfa, 0xcc, 0xff, 0xfa, 0xec, 0xff, 0x82, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x6d, 0xff, 0xfe, 0x18, 0xff, 0x91, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xd8, 0xff, 0xff, 0x24, 0x85, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x9c, 0xff, 0xff, 0xff, 0x01, 0xfc, 0xb3, 0xff, 0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x82, 0xfb, 0x0c, 0xff, 0x02, 
+  0xfb, 0x4d, 0xff, 0xfd, 0xb6, 0xff, 0xff, 0xdf, 0xff, 0x90, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x88, 0x84, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x24, 0xff, 0xff, 0xdc, 0x9b, 0xff, 0xff, 0xff, 
+  0x02, 0xff, 0xdf, 0xff, 0xfc, 0x31, 0xff, 0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x83, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x4c, 0xff, 0xfd, 0xb6, 0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xdc, 0xff, 0xff, 0x24, 0x83, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x73, 0x9c, 0xff, 0xff, 0xff, 0x02, 0xff, 0x7e, 0xff, 0xfb, 0x8f, 0xff, 0xfa, 0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 0x83, 0xfb, 
+  0x0c, 0xff, 0x01, 0xfb, 0x4d, 0xff, 0xfe, 0x18, 0xff, 0x90, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7b, 0x82, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0x9c, 0xff, 0xff, 0xff, 
+  0x02, 0xfe, 0x7a, 0xff, 0xfa, 0xed, 0xff, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x83, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x8d, 0xff, 0xfe, 0x9a, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xc7, 0xff, 0xff, 0x13, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x47, 0xff, 0xff, 0xf7, 0x92, 0xff, 0xff, 0xff, 0x01, 0xff, 0x5d, 0xff, 0xff, 0xbf, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xfd, 
+  0x15, 0xff, 0xfa, 0xac, 0xff, 0x81, 0xfa, 0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 0x83, 0xfb, 0x0c, 0xff, 0x02, 0xfb, 0x0b, 0xff, 0xfc, 0x10, 0xff, 0xff, 0x5d, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x84, 0x91, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xfd, 0xb8, 0xff, 0xfb, 0x71, 0xff, 0xfe, 0xbc, 0xff, 0x86, 
+  0xff, 0xff, 0xff, 0x02, 0xff, 0x1c, 0xff, 0xfb, 0x4f, 0xff, 0xfa, 0xac, 0xff, 0x81, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x82, 0xfb, 0x0c, 0xff, 0x02, 0xfb, 0x2c, 0xff, 0xfb, 0x0b, 0xff, 
+  0xfd, 0x14, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0x90, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9f, 0xff, 0xfc, 0xd5, 0xff, 0x81, 
+  0xfa, 0x6e, 0xff, 0x00, 0xfe, 0x7a, 0xff, 0x85, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xfc, 0xd4, 0xff, 0xfa, 0xac, 0xff, 0xfa, 0xcd, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 
+  0x84, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x6d, 0xff, 0xfe, 0x9a, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0x8f, 0xff, 0xff, 0xff, 
+  0x01, 0xff, 0x9f, 0xff, 0xfc, 0x75, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x00, 0xfd, 0x57, 0xff, 0x85, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xb8, 0xff, 0xfa, 0xcd, 0xff, 0x81, 0xfa, 0xad, 0xff, 0x83, 0xfa, 
+  0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 0x83, 0xfb, 0x0c, 0xff, 0x02, 0xfb, 0x0b, 0xff, 0xfc, 0x71, 0xff, 0xff, 0xdf, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x3b, 0xff, 
+  0xff, 0x63, 0xff, 0xff, 0xfb, 0x8e, 0xff, 0xff, 0xff, 0x06, 0xff, 0xdf, 0xff, 0xfc, 0xd6, 0xff, 0xfa, 0x2e, 0xff, 0xfa, 0x2d, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0x2d, 0xff, 0xfc, 0x33, 0xff, 0x84, 
+  0xff, 0xff, 0xff, 0x02, 0xfd, 0xd8, 0xff, 0xfa, 0xee, 0xff, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x83, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x4c, 
+  0xff, 0xfe, 0x79, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6b, 0xff, 0xff, 0x88, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xb9, 0xff, 0xfa, 0x4e, 0xff, 0x81, 0xfa, 0x2e, 
+  0xff, 0x81, 0xfa, 0x4d, 0xff, 0x01, 0xfb, 0x10, 0xff, 0xff, 0x3d, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xff, 0x5e, 0xff, 0xfc, 0xf5, 0xff, 0xfa, 0xce, 0xff, 0x81, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 
+  0xad, 0xff, 0x00, 0xfa, 0xcd, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 0x83, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x0b, 0xff, 0xfc, 0xd2, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 
+  0xa3, 0xff, 0xff, 0xbf, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xff, 0x1d, 0xff, 0xfa, 0xf0, 0xff, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x81, 0xfa, 0x4d, 0xff, 0x04, 0xfd, 0x16, 0xff, 0xff, 0x3d, 
+  0xff, 0xfd, 0x77, 0xff, 0xfb, 0x70, 0xff, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x83, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 
+  0xae, 0xff, 0xff, 0x3c, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xd8, 0x8e, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xd6, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 
+  0x03, 0xfa, 0x4e, 0xff, 0xfa, 0x4d, 0xff, 0xfa, 0xae, 0xff, 0xfa, 0xef, 0xff, 0x82, 0xfa, 0x6d, 0xff, 0x83, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x00, 0xfa, 0xcd, 0xff, 0x82, 0xfa, 0xcc, 
+  0xff, 0x83, 0xfa, 0xec, 0xff, 0x82, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x2c, 0xff, 0xfd, 0xf7, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xe3, 0x8d, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0x1d, 0xff, 0xfa, 0xb0, 0xff, 0x81, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x83, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x00, 0xfa, 
+  0xcd, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 0x82, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x0b, 0xff, 0xfc, 0xd3, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf4, 
+  0x8d, 0xff, 0xff, 0xff, 0x01, 0xfd, 0x78, 0xff, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 
+  0xfa, 0xad, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x82, 0xfb, 0x0c, 0xff, 0x01, 0xfc, 0x30, 0xff, 0xff, 0xbf, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf3, 0xff, 0xff, 
+  0xfc, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xff, 0xfb, 0xd4, 0xff, 0xf9, 0xee, 0xff, 0x83, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x82, 
+  0xfa, 0x6d, 0xff, 0x83, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x00, 0xfa, 0xcd, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x81, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x8e, 0xff, 0xff, 
+  0x3c, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xfc, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0x5e, 0xff, 0xfa, 0xb1, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 
+  0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 0x83, 0xfa, 0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 0x81, 0xfb, 0x0c, 0xff, 0x01, 0xfb, 0x4d, 
+  0xff, 0xfe, 0xdb, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf4, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xfe, 0x9c, 0xff, 0xfa, 0x2f, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x83, 0xfa, 
+  0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 
+  0xec, 0xff, 0x02, 0xfb, 0x0c, 0xff, 0xfb, 0x2c, 0xff, 0xfe, 0x9a, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xe3, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xfe, 0x3b, 0xff, 0xfa, 
+  0x0f, 0xff, 0x82, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x83, 0xfa, 0x4d, 0xff, 0x82, 0xfa, 0x6d, 0xff, 0x83, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x00, 0xfa, 
+  0xcd, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x01, 0xfb, 0x0c, 0xff, 0xfe, 0x59, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xdb, 0x8c, 0xff, 0xff, 0xff, 
+  0x00, 0xfd, 0xda, 0xff, 0x84, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 
+  0x82, 0xfa, 0xcc, 0xff, 0x83, 0xfa, 0xec, 0xff, 0x01, 0xfb, 0x0c, 0xff, 0xfe, 0x59, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xc0, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xfd, 
+  0xfa, 0xff, 0xf9, 0xef, 0xff, 0xf9, 0xce, 0xff, 0x82, 0xf9, 0xee, 0xff, 0x83, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x82, 0xfa, 0x6d, 0xff, 
+  0x83, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x82, 0xfa, 0xec, 0xff, 0x01, 0xfb, 0x2d, 0xff, 0xfe, 0x9a, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xc0, 0xff, 
+  0xff, 0x88, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xfe, 0x7b, 0xff, 0xfa, 0x0f, 0xff, 0xf9, 0xce, 0xff, 0x83, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 
+  0x83, 0xfa, 0x6d, 0xff, 0x83, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x00, 0xfa, 0xcd, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x81, 0xfa, 0xec, 0xff, 0x01, 0xfb, 0x2d, 0xff, 0xfe, 0xdb, 0xff, 0x8c, 
+  0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xa3, 0xff, 0xff, 0x64, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xdc, 0xff, 0xfa, 0x30, 0xff, 0x81, 0xf9, 0xce, 0xff, 0x82, 0xf9, 0xee, 0xff, 
+  0x83, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 0x82, 0xfa, 0xcc, 0xff, 0x03, 0xfa, 0xec, 0xff, 
+  0xfa, 0xcc, 0xff, 0xfb, 0xaf, 0xff, 0xff, 0x7e, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xec, 0x8b, 0xff, 0xff, 0xff, 0x03, 0xff, 
+  0x9f, 0xff, 0xfb, 0x12, 0xff, 0xf9, 0xae, 0xff, 0xf9, 0xce, 0xff, 0x83, 0xf9, 0xee, 0xff, 0x83, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x82, 
+  0xfa, 0x6d, 0xff, 0x83, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x00, 0xfa, 0xcd, 0xff, 0x83, 0xfa, 0xcc, 0xff, 0x00, 0xfc, 0x72, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xec, 0xff, 
+  0xff, 0x3b, 0xff, 0xff, 0x10, 0xff, 0xff, 0xc4, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xfc, 0x76, 0xff, 0xf9, 0xae, 0xff, 0x81, 0xf9, 0xce, 0xff, 0x83, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 
+  0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 0x83, 0xfa, 0xcc, 0xff, 0x00, 0xfd, 0x96, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x03, 
+  0xff, 0xff, 0xc4, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0x87, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xfe, 0x3b, 0xff, 0xf9, 0xef, 0xff, 0x82, 0xf9, 0xce, 0xff, 0x82, 0xf9, 0xee, 0xff, 0x83, 
+  0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x83, 0xfa, 0xad, 0xff, 0x81, 0xfa, 0xcc, 0xff, 0x01, 
+  0xfb, 0x6e, 0xff, 0xff, 0x1c, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x93, 0x81, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x48, 0xff, 0xff, 0xf7, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xff, 0x9f, 
+  0xff, 0xfb, 0x53, 0xff, 0xf9, 0xae, 0xff, 0x81, 0xf9, 0xce, 0xff, 0x83, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x83, 0xfa, 0x4d, 0xff, 0x82, 0xfa, 0x6d, 0xff, 0x83, 
+  0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x02, 0xfa, 0xcd, 0xff, 0xfa, 0xac, 0xff, 0xfc, 0xd4, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x4b, 0x81, 0x00, 0x00, 0x00, 
+  0x01, 0xff, 0xff, 0x13, 0xff, 0xff, 0xc7, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xfd, 0xda, 0xff, 0xf9, 0xef, 0xff, 0x82, 0xf9, 0xce, 0xff, 0x83, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 
+  0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 0xff, 0x02, 0xfa, 0xac, 0xff, 0xfb, 0x4e, 0xff, 0xfe, 0xfc, 0xff, 0x8c, 0xff, 0xff, 0xff, 
+  0x01, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x13, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x73, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xff, 0xbf, 0xff, 0xfb, 0xd4, 0xff, 0xf9, 0xae, 0xff, 0x82, 0xf9, 0xce, 
+  0xff, 0x82, 0xf9, 0xee, 0xff, 0x83, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x82, 0xfa, 0x6d, 0xff, 0x83, 0xfa, 0x8d, 0xff, 0x82, 0xfa, 0xad, 
+  0xff, 0x00, 0xfd, 0x76, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x28, 0xff, 0xff, 0xdf, 0x8c, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xdd, 0xff, 
+  0xfa, 0xb1, 0xff, 0xf9, 0xae, 0xff, 0x81, 0xf9, 0xce, 0xff, 0x83, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x83, 0xfa, 
+  0x8d, 0xff, 0x02, 0xfa, 0x8c, 0xff, 0xfc, 0x73, 0xff, 0xff, 0xbf, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x27, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x83, 0x8d, 
+  0xff, 0xff, 0xff, 0x02, 0xfe, 0x3b, 0xff, 0xfa, 0x50, 0xff, 0xf9, 0xae, 0xff, 0x81, 0xf9, 0xce, 0xff, 0x82, 0xf9, 0xee, 0xff, 0x83, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 
+  0xff, 0x83, 0xfa, 0x6d, 0xff, 0x82, 0xfa, 0x8d, 0xff, 0x01, 0xfb, 0xf1, 0xff, 0xff, 0x5d, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x8b, 0x85, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x27, 
+  0xff, 0xff, 0xd8, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xfe, 0x1a, 0xff, 0xfa, 0x70, 0xff, 0xf9, 0xae, 0xff, 0x81, 0xf9, 0xce, 0xff, 0x82, 0xf9, 0xee, 0xff, 0x83, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 
+  0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x83, 0xfa, 0x6d, 0xff, 0x02, 0xfa, 0x8d, 0xff, 0xfc, 0x12, 0xff, 0xff, 0x3d, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xdb, 0xff, 
+  0xff, 0x27, 0x86, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xfb, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xfe, 0x7c, 0xff, 0xfb, 0x32, 0xff, 0x81, 0xf9, 0xce, 0xff, 0x83, 0xf9, 0xee, 0xff, 
+  0x82, 0xfa, 0x0e, 0xff, 0x83, 0xfa, 0x2e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x82, 0xfa, 0x6d, 0xff, 0x02, 0xfa, 0xae, 0xff, 0xfc, 0xb4, 0xff, 0xff, 0x7e, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xff, 
+  0xff, 0xfc, 0xff, 0xff, 0x77, 0x87, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0xb3, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xff, 0x5e, 0xff, 0xfc, 0x96, 0xff, 0xfa, 0x70, 0xff, 0x81, 0xf9, 
+  0xce, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x83, 0xfa, 0x0e, 0xff, 0x82, 0xfa, 0x2e, 0xff, 0x00, 0xfa, 0x4e, 0xff, 0x82, 0xfa, 0x4d, 0xff, 0x03, 0xfa, 0x6d, 0xff, 0xfb, 0x91, 0xff, 0xfd, 0xf9, 0xff, 
+  0xff, 0xdf, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x10, 0x88, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x37, 0xff, 0xff, 0xe3, 0x8f, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xbc, 
+  0xff, 0xfc, 0x55, 0xff, 0xfa, 0xb1, 0xff, 0xf9, 0xee, 0xff, 0xf9, 0xce, 0xff, 0x81, 0xf9, 0xee, 0xff, 0x82, 0xfa, 0x0e, 0xff, 0x81, 0xfa, 0x0d, 0xff, 0x81, 0xfa, 0x2d, 0xff, 0x03, 0xfa, 0xae, 
+  0xff, 0xfb, 0xd2, 0xff, 0xfd, 0x98, 0xff, 0xff, 0x7e, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x3c, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf4, 
+  0x90, 0xff, 0xff, 0xff, 0x0d, 0xff, 0x3e, 0xff, 0xfd, 0xd9, 0xff, 0xfc, 0x75, 0xff, 0xfb, 0x93, 0xff, 0xfb, 0x52, 0xff, 0xfa, 0xf0, 0xff, 0xfa, 0xd0, 0xff, 0xfa, 0xf1, 0xff, 0xfb, 0x51, 0xff, 
+  0xfb, 0xb2, 0xff, 0xfc, 0x34, 0xff, 0xfd, 0x57, 0xff, 0xfe, 0xbc, 0xff, 0xff, 0xbf, 0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x6c, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0xff, 0x07, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xfc, 0x92, 0xff, 0xff, 0xff, 0x06, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x5e, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xbf, 0xff, 0xff, 
+  0xdf, 0xff, 0x93, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x07, 0x8c, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x10, 0xff, 0xff, 0xa0, 0xad, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xa4, 0xff, 0xff, 0x13, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x14, 0xff, 0xff, 0xa7, 0xab, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xab, 0xff, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 
+  0x02, 0xff, 0xff, 0x17, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xa7, 0xff, 0xff, 0x17, 0x92, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10, 
+  0xff, 0xff, 0x8c, 0xff, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x13, 0x94, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x07, 0xff, 0xff, 0x64, 0xff, 
+  0xff, 0xe3, 0xa3, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x07, 0x97, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x38, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xfb, 0x9f, 0xff, 
+  0xff, 0xff, 0x02, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x3c, 0x9a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10, 0xff, 0xff, 0x73, 0xff, 0xff, 0xd8, 0x9d, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xff, 0xdb, 0xff, 0xff, 0x77, 0xff, 0xff, 0x10, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x23, 0xff, 0xff, 0x88, 0xff, 0xff, 0xdc, 0x99, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xe0, 0xff, 0xff, 
+  0x8b, 0xff, 0xff, 0x27, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x23, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xf7, 0x93, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xf7, 
+  0xff, 0xff, 0xc8, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x28, 0xff, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0x10, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xeb, 
+  0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xec, 0xff, 0xff, 0xc4, 0xff, 0xff, 0x94, 0xff, 0xff, 0x4b, 0xff, 0xff, 0x13, 0xaa, 0x00, 0x00, 0x00, 0x07, 0xff, 
+  0xff, 0x10, 0xff, 0xff, 0x38, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xf3, 0x81, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xf4, 0xff, 
+  0xff, 0xe3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xa4, 0xff, 0xff, 0x6c, 0xff, 0xff, 0x3b, 0xff, 0xff, 0x10, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xa0, 0x9e, 0xfe, 0xff, 0xb1, 0xb0, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0x8c, 0x8a, 0xfe, 0xff, 0x5e, 0x5c, 0xfe, 0xff, 0x7d, 0x7d, 0xfe, 0xff, 0xc4, 0xc5, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x9b, 0xfe, 0xff, 0x5e, 0x5b, 0xfe, 0xff, 0x5f, 0x5e, 0xfe, 0xff, 0x63, 0x64, 0xfe, 0xff, 0x97, 0x99, 0xfe, 0xff, 0xe5, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xa4, 0xfe, 0xff, 0x5f, 0x5b, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x5e, 0x5f, 0xfe, 0xff, 0x7a, 0x7c, 0xfe, 0xff, 0xcf, 0xd0, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xa3, 0xfe, 0xff, 0x5f, 0x5a, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5d, 0x5f, 0xfe, 0xff, 0x6b, 0x6e, 0xfe, 0xff, 0xbe, 0xc0, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x99, 0x94, 0xfe, 0xff, 0x5f, 0x59, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5e, 0x60, 0xfe, 0xff, 0x65, 0x69, 0xfe, 0xff, 0xb3, 0xb5, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0x8b, 0x84, 0xfe, 0xff, 0x60, 0x59, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5e, 0x61, 0xfe, 0xff, 0x63, 0x67, 0xfe, 0xff, 0xb2, 0xb5, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xeb, 0xff, 0xff, 0x7a, 0x72, 0xfe, 0xff, 0x61, 0x59, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0x65, 0x6a, 0xff, 0xff, 0xbd, 0xbf, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xce, 0xff, 0xff, 0x67, 0x5d, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5d, 0x62, 0xfe, 0xff, 0x6a, 0x70, 0xff, 0xff, 0xcf, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xec, 0xe8, 0xff, 0xff, 0xf8, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xa8, 0xa0, 0xfe, 0xff, 0x62, 0x56, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5c, 0x61, 0xfe, 0xff, 0x7d, 0x82, 0xff, 0xff, 0xe9, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xff, 0xff, 0xc4, 0xb6, 0xff, 0xff, 0x85, 0x6b, 0xfe, 0xff, 0xdd, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xe0, 0xff, 0xff, 0x76, 0x69, 0xfe, 0xff, 0x63, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5f, 0x63, 0xfe, 0xff, 0x5c, 0x62, 0xff, 0xff, 0x9d, 0xa1, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf2, 0xff, 0xff, 0xac, 0x98, 0xfe, 0xff, 0x6e, 0x4d, 0xfe, 0xff, 0x6d, 0x4d, 0xfe, 0xff, 0xd4, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xa2, 0x98, 0xfe, 0xff, 0x64, 0x54, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0x66, 0x6c, 0xff, 0xff, 0xcd, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x10, 
-  0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf2, 0xff, 0xff, 0xa5, 0x8d, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0x6a, 0x48, 0xfe, 0xff, 0xb7, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xbf, 0xb6, 0xff, 0xff, 0x6a, 0x59, 0xfe, 0xff, 0x65, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5c, 0x61, 0xfe, 0xff, 0x89, 0x8e, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0x3b, 
-  0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xff, 0xff, 0xae, 0x97, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6c, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x69, 0x46, 0xfe, 0xff, 0x9c, 0x86, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xc2, 0xb9, 0xff, 0xff, 0x71, 0x5d, 0xfe, 0xff, 0x66, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0x63, 0x69, 0xff, 0xff, 0xcb, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x6b, 
-  0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xb5, 0xff, 0xff, 0x72, 0x48, 0xfe, 0xff, 0x6d, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x47, 0xfe, 0xff, 0x7f, 0x61, 0xfe, 0xff, 0xea, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xe9, 0xff, 0xff, 0xac, 0x9d, 0xfe, 0xff, 0x6e, 0x57, 0xfe, 0xff, 0x66, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5c, 0x61, 0xfe, 0xff, 0x94, 0x98, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe0, 0xff, 0xff, 0x83, 0x5c, 0xfe, 0xff, 0x6d, 0x41, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0xb3, 0xa2, 0xfe, 0xff, 0xe9, 0xe4, 0xff, 0xff, 0xbc, 0xae, 0xff, 0xff, 0x83, 0x6b, 0xfe, 0xff, 0x68, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5e, 0x61, 0xfe, 0xff, 0x6f, 0x74, 0xff, 0xff, 0xe4, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xb1, 0x98, 0xfe, 0xff, 0x6e, 0x3f, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6b, 0x47, 0xfe, 0xff, 0x74, 0x54, 0xfe, 0xff, 0x7b, 0x5e, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x68, 0x4b, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5f, 0x63, 0xfe, 0xff, 0xbb, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe0, 0xff, 0xff, 0x80, 0x55, 0xfe, 0xff, 0x6f, 0x3f, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0x6a, 0x48, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5c, 0x60, 0xfe, 0xff, 0x97, 0x9a, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xae, 0xff, 0xff, 0x70, 0x3e, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5d, 0x5f, 0xfe, 0xff, 0x81, 0x84, 0xfe, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0xff, 0x9d, 0x78, 0xfe, 0xff, 0x6f, 0x3b, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x60, 0xfe, 0xff, 0x6d, 0x70, 0xfe, 0xff, 0xe3, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xe7, 0xff, 0xff, 0x85, 0x56, 0xfe, 0xff, 0x70, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x65, 0x67, 0xfe, 0xff, 0xd7, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
-  0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xd0, 0xff, 0xff, 0x78, 0x43, 0xfe, 0xff, 0x71, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x64, 0x65, 0xfe, 0xff, 0xd2, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
-  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xc6, 0xfe, 0xff, 0x76, 0x3f, 0xfe, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x62, 0x62, 0xfe, 0xff, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 
-  0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xba, 0xfe, 0xff, 0x74, 0x3c, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x62, 0x61, 0xfe, 0xff, 0xc9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 
-  0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xbe, 0xfe, 0xff, 0x75, 0x3c, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x65, 0x63, 0xfe, 0xff, 0xd3, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-  0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xcb, 0xfe, 0xff, 0x78, 0x3f, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x61, 0x5c, 0xfe, 0xff, 0x68, 0x64, 0xfe, 0xff, 0xda, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 
-  0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xd7, 0xff, 0xff, 0x7d, 0x45, 0xfd, 0xff, 0x73, 0x38, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x61, 0x5a, 0xfe, 0xff, 0x78, 0x74, 0xfe, 0xff, 0xed, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x6c, 
-  0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf2, 0xff, 0xff, 0x91, 0x60, 0xfd, 0xff, 0x72, 0x36, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x60, 0x58, 0xfe, 0xff, 0x90, 0x8c, 0xfe, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0x3b, 
-  0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x8c, 0xfe, 0xff, 0x72, 0x35, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x62, 0x59, 0xfe, 0xff, 0xb4, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x10, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xc4, 0xfe, 0xff, 0x79, 0x3d, 0xfd, 0xff, 0x74, 0x38, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x63, 0x57, 0xfe, 0xff, 0x73, 0x6b, 0xfe, 0xff, 0xe3, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf2, 0xff, 0xff, 0x97, 0x68, 0xfd, 0xff, 0x72, 0x35, 0xfd, 0xff, 0x74, 0x38, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x62, 0x55, 0xfe, 0xff, 0xa0, 0x9a, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xb8, 0xfe, 0xff, 0x78, 0x3b, 0xfd, 0xff, 0x74, 0x37, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x64, 0x55, 0xfe, 0xff, 0x74, 0x68, 0xfe, 0xff, 0xdf, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf6, 0xff, 0xff, 0xa3, 0x79, 0xfe, 0xff, 0x73, 0x34, 0xfd, 0xff, 0x74, 0x38, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x56, 0xfe, 0xff, 0xb3, 0xac, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xda, 0xff, 0xff, 0x8b, 0x56, 0xfd, 0xff, 0x73, 0x35, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x64, 0x52, 0xfe, 0xff, 0x98, 0x8c, 0xfe, 0xff, 0xf5, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xc6, 0xfe, 0xff, 0x82, 0x4a, 0xfd, 0xff, 0x72, 0x36, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x65, 0x4f, 0xfe, 0xff, 0x8b, 0x7c, 0xfe, 0xff, 0xeb, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xc0, 0xfe, 0xff, 0x84, 0x4e, 0xfd, 0xff, 0x72, 0x35, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4e, 0xfe, 0xff, 0x67, 0x4f, 0xfe, 0xff, 0x90, 0x80, 0xfe, 0xff, 0xe7, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xce, 0xfe, 0xff, 0x92, 0x63, 0xfd, 0xff, 0x73, 0x37, 0xfd, 0xff, 0x72, 0x38, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x68, 0x4b, 0xfe, 0xff, 0x6d, 0x53, 0xfe, 0xff, 0xa3, 0x94, 0xfe, 0xff, 0xf0, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe9, 0xff, 0xff, 0xb2, 0x91, 0xfe, 0xff, 0x80, 0x4b, 0xfd, 0xff, 0x71, 0x37, 0xfd, 0xff, 0x71, 0x3a, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0x69, 0x47, 0xfe, 0xff, 0x6b, 0x4c, 0xfe, 0xff, 0x88, 0x70, 0xfe, 0xff, 0xc8, 0xbe, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xe1, 0xd5, 0xff, 0xff, 0xac, 0x8a, 0xfe, 0xff, 0x86, 0x56, 0xfe, 0xff, 0x74, 0x3e, 0xfe, 0xff, 0x6f, 0x3a, 0xfe, 0xff, 0x6f, 0x3b, 0xfe, 0xff, 0x6f, 0x3d, 0xfe, 0xff, 0x6f, 0x3f, 0xfe, 0xff, 0x6e, 0x40, 0xfe, 0xff, 0x6d, 0x41, 0xfe, 0xff, 0x6c, 0x41, 0xfe, 0xff, 0x6b, 0x42, 0xfe, 0xff, 0x6b, 0x43, 0xfe, 0xff, 0x6b, 0x46, 0xfe, 0xff, 0x74, 0x53, 0xfe, 0xff, 0x91, 0x78, 0xfe, 0xff, 0xbf, 0xb1, 0xff, 0xff, 0xf1, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xed, 0xe6, 0xff, 0xff, 0xcc, 0xb8, 0xff, 0xff, 0xab, 0x8b, 0xfe, 0xff, 0x97, 0x72, 0xfe, 0xff, 0x8f, 0x67, 0xfe, 0xff, 0x84, 0x5b, 0xfe, 0xff, 0x82, 0x59, 0xfe, 0xff, 0x85, 0x5e, 0xfe, 0xff, 0x8c, 0x69, 0xfe, 0xff, 0x92, 0x73, 0xfe, 0xff, 0xa0, 0x86, 0xfe, 0xff, 0xba, 0xa7, 0xff, 0xff, 0xde, 0xd6, 0xff, 0xff, 0xf8, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xf7, 0xf4, 0xff, 0xff, 0xf0, 0xeb, 0xff, 0xff, 0xef, 0xe9, 0xff, 0xff, 0xf1, 0xec, 0xff, 0xff, 0xf6, 0xf3, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x96, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 
+  0xff, 0xdb, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf4, 0x81, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xc0, 
+  0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x10, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 
+  0xff, 0x84, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xc4, 
+  0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0x13, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 
+  0xff, 0xc7, 0xff, 0xff, 0xff, 0xf7, 0x93, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x03, 
+  0xa0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xdc, 0x99, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x83, 
+  0xff, 0xff, 0xff, 0x24, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xd7, 0x9d, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xdb, 
+  0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x10, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0x37, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xe0, 0xa3, 0xff, 
+  0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x07, 0x94, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 
+  0xff, 0xf4, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x10, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 
+  0xff, 0x9b, 0xff, 0xff, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0xff, 0x14, 0xff, 0xff, 0xff, 0xa3, 0xab, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x17, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 
+  0xff, 0x9b, 0xad, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0x10, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 
+  0xff, 0xfc, 0x96, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 
+  0xff, 0x8f, 0xff, 0xff, 0xff, 0x07, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xf4, 0x97, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfa, 0xfa, 0xff, 0xff, 0xa0, 0x9e, 
+  0xfe, 0xff, 0xb1, 0xb0, 0xff, 0xff, 0xec, 0xec, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x67, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0xff, 0x34, 0xff, 0xff, 0xff, 0xe0, 0x98, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfb, 0xfb, 0xff, 0xff, 0x8c, 0x8a, 0xfe, 0xff, 0x5e, 0x5c, 0xfe, 0xff, 0x7d, 0x7d, 0xfe, 0xff, 0xc4, 0xc5, 0xff, 0xff, 
+  0xf8, 0xf8, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x38, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xb3, 
+  0x9a, 0xff, 0xff, 0xff, 0xff, 0x05, 0x9e, 0x9b, 0xfe, 0xff, 0x5e, 0x5b, 0xfe, 0xff, 0x5f, 0x5e, 0xfe, 0xff, 0x63, 0x64, 0xfe, 0xff, 0x97, 0x99, 0xfe, 0xff, 0xe5, 0xe6, 0xff, 0xff, 0x92, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x13, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xfb, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x07, 
+  0xa7, 0xa4, 0xfe, 0xff, 0x5f, 0x5b, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x5e, 0x5f, 0xfe, 0xff, 0x7a, 0x7c, 0xfe, 0xff, 0xcf, 0xd0, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 
+  0x90, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x73, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xd7, 0x9b, 0xff, 0xff, 0xff, 
+  0xff, 0x08, 0xa6, 0xa3, 0xfe, 0xff, 0x5f, 0x5a, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5d, 0x5f, 0xfe, 0xff, 0x6b, 0x6e, 0xfe, 0xff, 0xbe, 0xc0, 
+  0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0x24, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f, 0x9b, 0xff, 
+  0xff, 0xff, 0xff, 0x0a, 0xfe, 0xfe, 0xff, 0xff, 0x99, 0x94, 0xfe, 0xff, 0x5f, 0x59, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 
+  0x5e, 0x60, 0xfe, 0xff, 0x65, 0x69, 0xfe, 0xff, 0xb3, 0xb5, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xdc, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xfa, 0xf9, 0xff, 0xff, 0x8b, 0x84, 0xfe, 0xff, 0x60, 0x59, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 
+  0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5e, 0x61, 0xfe, 0xff, 0x63, 0x67, 0xfe, 0xff, 0xb2, 0xb5, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0x8f, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x24, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x73, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xed, 0xeb, 0xff, 0xff, 
+  0x7a, 0x72, 0xfe, 0xff, 0x61, 0x59, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 
+  0x5e, 0x62, 0xfe, 0xff, 0x65, 0x6a, 0xff, 0xff, 0xbd, 0xbf, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7b, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xc7, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xd2, 0xce, 0xff, 0xff, 0x67, 0x5d, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 
+  0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5d, 0x62, 0xfe, 0xff, 0x6a, 0x70, 0xff, 0xff, 0xcf, 0xd1, 
+  0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x13, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0xf7, 0x91, 0xff, 
+  0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xff, 0xff, 0xec, 0xe8, 0xff, 0xff, 0xf8, 0xf6, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xfe, 0xfe, 0xff, 0xff, 0xa8, 0xa0, 0xfe, 0xff, 0x62, 0x56, 
+  0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 
+  0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5c, 0x61, 0xfe, 0xff, 0x7d, 0x82, 0xff, 0xff, 0xe9, 0xea, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x4b, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x84, 0x91, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf9, 0xf8, 0xff, 0xff, 0xc4, 0xb6, 0xff, 0xff, 0x85, 0x6b, 0xfe, 0xff, 0xdd, 0xd6, 0xff, 0xff, 
+  0x86, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xe3, 0xe0, 0xff, 0xff, 0x76, 0x69, 0xfe, 0xff, 0x63, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 
+  0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5f, 0x63, 0xfe, 0xff, 0x5c, 0x62, 0xff, 0xff, 0x9d, 0xa1, 
+  0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xc4, 0x90, 0xff, 0xff, 0xff, 
+  0xff, 0x04, 0xf5, 0xf2, 0xff, 0xff, 0xac, 0x98, 0xfe, 0xff, 0x6e, 0x4d, 0xfe, 0xff, 0x6d, 0x4d, 0xfe, 0xff, 0xd4, 0xcb, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfa, 0xf9, 0xff, 0xff, 
+  0xa2, 0x98, 0xfe, 0xff, 0x64, 0x54, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 
+  0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0x66, 0x6c, 0xff, 0xff, 0xcd, 0xcf, 0xff, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xec, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf5, 0xf2, 0xff, 0xff, 
+  0xa5, 0x8d, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0x6a, 0x48, 0xfe, 0xff, 0xb7, 0xa7, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x12, 0xfe, 0xfd, 0xff, 0xff, 0xbf, 0xb6, 
+  0xff, 0xff, 0x6a, 0x59, 0xfe, 0xff, 0x65, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 
+  0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5c, 0x61, 0xfe, 0xff, 0x89, 0x8e, 
+  0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xfb, 0x8e, 0xff, 0xff, 0xff, 
+  0xff, 0x07, 0xfa, 0xf8, 0xff, 0xff, 0xae, 0x97, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6c, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x69, 0x46, 0xfe, 0xff, 0x9c, 0x86, 0xfe, 0xff, 0xfd, 0xfd, 
+  0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfb, 0xfb, 0xff, 0xff, 0xc2, 0xb9, 0xff, 0xff, 0x71, 0x5d, 0xfe, 0xff, 0x66, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 
+  0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 
+  0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5e, 0x62, 0xfe, 0xff, 0x63, 0x69, 0xff, 0xff, 0xcb, 0xcd, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 
+  0xff, 0xfb, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0x88, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x07, 0xc7, 0xb5, 0xff, 0xff, 0x72, 0x48, 0xfe, 0xff, 0x6d, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 
+  0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x47, 0xfe, 0xff, 0x7f, 0x61, 0xfe, 0xff, 0xea, 0xe5, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x15, 0xed, 0xe9, 0xff, 0xff, 0xac, 0x9d, 0xfe, 0xff, 0x6e, 0x57, 
+  0xfe, 0xff, 0x66, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 
+  0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 
+  0xfe, 0xff, 0x5c, 0x61, 0xfe, 0xff, 0x94, 0x98, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xbf, 0x8e, 0xff, 0xff, 0xff, 
+  0xff, 0x20, 0xe8, 0xe0, 0xff, 0xff, 0x83, 0x5c, 0xfe, 0xff, 0x6d, 0x41, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x48, 
+  0xfe, 0xff, 0xb3, 0xa2, 0xfe, 0xff, 0xe9, 0xe4, 0xff, 0xff, 0xbc, 0xae, 0xff, 0xff, 0x83, 0x6b, 0xfe, 0xff, 0x68, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 
+  0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5b, 
+  0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5e, 0x61, 0xfe, 0xff, 0x6f, 0x74, 
+  0xff, 0xff, 0xe4, 0xe5, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xd8, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x21, 0xfe, 0xfe, 0xff, 0xff, 0xb1, 0x98, 
+  0xfe, 0xff, 0x6e, 0x3f, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6b, 0x47, 0xfe, 0xff, 0x74, 0x54, 
+  0xfe, 0xff, 0x7b, 0x5e, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x68, 0x4b, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 
+  0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 
+  0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x61, 0xfe, 0xff, 0x5f, 0x62, 0xfe, 0xff, 0x5f, 0x63, 0xfe, 0xff, 0xbb, 0xbd, 
+  0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xe3, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x22, 0xe8, 0xe0, 0xff, 0xff, 0x80, 0x55, 0xfe, 0xff, 0x6f, 0x3f, 
+  0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0x6a, 0x48, 
+  0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 
+  0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 
+  0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x61, 0xfe, 0xff, 0x5c, 0x60, 0xfe, 0xff, 0x97, 0x9a, 0xfe, 0xff, 0xfe, 0xfe, 
+  0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf4, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x22, 0xc3, 0xae, 0xff, 0xff, 0x70, 0x3e, 0xfe, 0xff, 0x70, 0x40, 
+  0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 
+  0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 
+  0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 
+  0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5d, 0x5f, 0xfe, 0xff, 0x81, 0x84, 0xfe, 0xff, 0xf6, 0xf6, 
+  0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xfc, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x23, 0xfc, 0xfa, 0xff, 0xff, 0x9d, 0x78, 0xfe, 0xff, 0x6f, 0x3b, 
+  0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 
+  0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 
+  0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 
+  0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x5f, 0x60, 0xfe, 0xff, 0x6d, 0x70, 
+  0xfe, 0xff, 0xe3, 0xe4, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xfc, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x23, 0xee, 0xe7, 0xff, 0xff, 0x85, 0x56, 0xfe, 0xff, 0x70, 0x3c, 
+  0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 
+  0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 
+  0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 
+  0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x61, 0x5f, 0xfe, 0xff, 0x60, 0x60, 0xfe, 0xff, 0x65, 0x67, 
+  0xfe, 0xff, 0xd7, 0xd8, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf4, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x23, 0xdd, 0xd0, 0xff, 0xff, 0x78, 0x43, 
+  0xfe, 0xff, 0x71, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 
+  0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 
+  0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 
+  0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x60, 0x5f, 
+  0xfe, 0xff, 0x64, 0x65, 0xfe, 0xff, 0xd2, 0xd2, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xe3, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xd7, 0xc6, 
+  0xfe, 0xff, 0x76, 0x3f, 0xfe, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x43, 
+  0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4c, 
+  0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x55, 
+  0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x81, 0x61, 
+  0x5e, 0xfe, 0xff, 0x01, 0x62, 0x62, 0xfe, 0xff, 0xc9, 0xc9, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xdb, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x23, 
+  0xcf, 0xba, 0xfe, 0xff, 0x74, 0x3c, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 
+  0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 
+  0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 
+  0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 
+  0x62, 0x5d, 0xfe, 0xff, 0x61, 0x5e, 0xfe, 0xff, 0x62, 0x61, 0xfe, 0xff, 0xc9, 0xc9, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xc0, 0x8c, 0xff, 
+  0xff, 0xff, 0xff, 0x23, 0xd2, 0xbe, 0xfe, 0xff, 0x75, 0x3c, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 
+  0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 
+  0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 
+  0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 
+  0x63, 0x5b, 0xfe, 0xff, 0x62, 0x5c, 0xfe, 0xff, 0x61, 0x5d, 0xfe, 0xff, 0x65, 0x63, 0xfe, 0xff, 0xd3, 0xd2, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 
+  0xff, 0x88, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x23, 0xdb, 0xcb, 0xfe, 0xff, 0x78, 0x3f, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 
+  0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 
+  0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 
+  0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 
+  0x63, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x62, 0x5b, 0xfe, 0xff, 0x61, 0x5c, 0xfe, 0xff, 0x68, 0x64, 0xfe, 0xff, 0xda, 0xd9, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 
+  0xff, 0xa3, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x23, 0xe3, 0xd7, 0xff, 0xff, 0x7d, 0x45, 0xfd, 0xff, 0x73, 0x38, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 
+  0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 
+  0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 
+  0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 
+  0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 0x63, 0x5b, 0xfe, 0xff, 0x61, 0x5a, 0xfe, 0xff, 0x78, 0x74, 0xfe, 0xff, 0xed, 0xec, 0xff, 0xff, 
+  0x8b, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xec, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x23, 0xf6, 0xf2, 0xff, 0xff, 
+  0x91, 0x60, 0xfd, 0xff, 0x72, 0x36, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 
+  0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 
+  0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 
+  0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x64, 0x58, 0xfe, 0xff, 0x64, 0x59, 0xfe, 0xff, 0x63, 0x5a, 0xfe, 0xff, 
+  0x60, 0x58, 0xfe, 0xff, 0x90, 0x8c, 0xfe, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 
+  0xff, 0xc4, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x21, 0xb0, 0x8c, 0xfe, 0xff, 0x72, 0x35, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 
+  0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 
+  0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 
+  0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 
+  0x64, 0x58, 0xfe, 0xff, 0x63, 0x59, 0xfe, 0xff, 0x62, 0x59, 0xfe, 0xff, 0xb4, 0xb1, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x87, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x21, 0xd6, 0xc4, 0xfe, 0xff, 0x79, 0x3d, 0xfd, 0xff, 0x74, 0x38, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 
+  0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 
+  0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 
+  0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x55, 0xfe, 0xff, 
+  0x65, 0x56, 0xfe, 0xff, 0x64, 0x57, 0xfe, 0xff, 0x63, 0x57, 0xfe, 0xff, 0x73, 0x6b, 0xfe, 0xff, 0xe3, 0xe2, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x93, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0xf7, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x21, 0xf6, 0xf2, 0xff, 0xff, 0x97, 0x68, 0xfd, 0xff, 0x72, 0x35, 0xfd, 0xff, 0x74, 0x38, 
+  0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 
+  0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 
+  0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 
+  0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x65, 0x56, 0xfe, 0xff, 0x65, 0x57, 0xfe, 0xff, 0x62, 0x55, 0xfe, 0xff, 0xa0, 0x9a, 0xfe, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x4b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xc7, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xce, 0xb8, 0xfe, 0xff, 
+  0x78, 0x3b, 0xfd, 0xff, 0x74, 0x37, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 
+  0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 
+  0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 
+  0x67, 0x52, 0xfe, 0xff, 0x67, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x55, 0xfe, 0xff, 0x64, 0x55, 0xfe, 0xff, 0x74, 0x68, 0xfe, 0xff, 0xdf, 0xdc, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x13, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x73, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xf8, 0xf6, 0xff, 0xff, 0xa3, 0x79, 
+  0xfe, 0xff, 0x73, 0x34, 0xfd, 0xff, 0x74, 0x38, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 
+  0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 
+  0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 0xfe, 0xff, 0x69, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x68, 0x51, 
+  0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 0x66, 0x53, 0xfe, 0xff, 0x66, 0x54, 0xfe, 0xff, 0x66, 0x56, 0xfe, 0xff, 0xb3, 0xac, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7f, 
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xdf, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xe6, 0xda, 0xff, 0xff, 0x8b, 0x56, 0xfd, 0xff, 0x73, 0x35, 0xfd, 0xff, 
+  0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 
+  0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 
+  0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x6a, 0x4d, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x67, 0x51, 0xfe, 0xff, 0x67, 0x52, 0xfe, 0xff, 
+  0x64, 0x52, 0xfe, 0xff, 0x98, 0x8c, 0xfe, 0xff, 0xf5, 0xf4, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x27, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0x83, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xd8, 0xc6, 0xfe, 0xff, 0x82, 0x4a, 0xfd, 0xff, 0x72, 0x36, 0xfd, 0xff, 0x74, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3b, 
+  0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 
+  0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6c, 0x49, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4d, 
+  0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4f, 0xfe, 0xff, 0x68, 0x50, 0xfe, 0xff, 0x65, 0x4f, 0xfe, 0xff, 0x8b, 0x7c, 0xfe, 0xff, 0xeb, 0xe8, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0xff, 0xff, 0xff, 0x8b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xd8, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x19, 0xd3, 0xc0, 0xfe, 0xff, 0x84, 0x4e, 0xfd, 0xff, 
+  0x72, 0x35, 0xfd, 0xff, 0x73, 0x39, 0xfd, 0xff, 0x73, 0x3a, 0xfd, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x72, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 
+  0x6f, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x49, 0xfe, 0xff, 
+  0x6b, 0x4a, 0xfe, 0xff, 0x6a, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x69, 0x4e, 0xfe, 0xff, 0x68, 0x4e, 0xfe, 0xff, 0x67, 0x4f, 0xfe, 0xff, 0x90, 0x80, 0xfe, 0xff, 0xe7, 0xe3, 0xff, 0xff, 
+  0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x27, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xfb, 0x8d, 0xff, 0xff, 0xff, 
+  0xff, 0x17, 0xdd, 0xce, 0xfe, 0xff, 0x92, 0x63, 0xfd, 0xff, 0x73, 0x37, 0xfd, 0xff, 0x72, 0x38, 0xfd, 0xff, 0x73, 0x3b, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3d, 0xfe, 0xff, 0x71, 0x3e, 
+  0xfe, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6f, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x46, 0xfe, 0xff, 0x6c, 0x47, 
+  0xfe, 0xff, 0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x4a, 0xfe, 0xff, 0x6b, 0x4b, 0xfe, 0xff, 0x6a, 0x4c, 0xfe, 0xff, 0x68, 0x4b, 0xfe, 0xff, 0x6d, 0x53, 0xfe, 0xff, 0xa3, 0x94, 0xfe, 0xff, 0xf0, 0xed, 
+  0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x77, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xb3, 0x8e, 0xff, 
+  0xff, 0xff, 0xff, 0x15, 0xf0, 0xe9, 0xff, 0xff, 0xb2, 0x91, 0xfe, 0xff, 0x80, 0x4b, 0xfd, 0xff, 0x71, 0x37, 0xfd, 0xff, 0x71, 0x3a, 0xfe, 0xff, 0x72, 0x3c, 0xfe, 0xff, 0x71, 0x3e, 0xfe, 0xff, 
+  0x71, 0x3f, 0xfe, 0xff, 0x70, 0x40, 0xfe, 0xff, 0x70, 0x41, 0xfe, 0xff, 0x6f, 0x42, 0xfe, 0xff, 0x6e, 0x43, 0xfe, 0xff, 0x6e, 0x44, 0xfe, 0xff, 0x6d, 0x45, 0xfe, 0xff, 0x6d, 0x47, 0xfe, 0xff, 
+  0x6c, 0x48, 0xfe, 0xff, 0x6b, 0x48, 0xfe, 0xff, 0x69, 0x47, 0xfe, 0xff, 0x6b, 0x4c, 0xfe, 0xff, 0x88, 0x70, 0xfe, 0xff, 0xc8, 0xbe, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x10, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0xe3, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x12, 0xfd, 0xfd, 
+  0xff, 0xff, 0xe1, 0xd5, 0xff, 0xff, 0xac, 0x8a, 0xfe, 0xff, 0x86, 0x56, 0xfe, 0xff, 0x74, 0x3e, 0xfe, 0xff, 0x6f, 0x3a, 0xfe, 0xff, 0x6f, 0x3b, 0xfe, 0xff, 0x6f, 0x3d, 0xfe, 0xff, 0x6f, 0x3f, 
+  0xfe, 0xff, 0x6e, 0x40, 0xfe, 0xff, 0x6d, 0x41, 0xfe, 0xff, 0x6c, 0x41, 0xfe, 0xff, 0x6b, 0x42, 0xfe, 0xff, 0x6b, 0x43, 0xfe, 0xff, 0x6b, 0x46, 0xfe, 0xff, 0x74, 0x53, 0xfe, 0xff, 0x91, 0x78, 
+  0xfe, 0xff, 0xbf, 0xb1, 0xff, 0xff, 0xf1, 0xee, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x3c, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
+  0xff, 0x64, 0xff, 0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xfe, 0xfd, 0xff, 0xff, 0xed, 0xe6, 0xff, 0xff, 0xcc, 0xb8, 0xff, 0xff, 0xab, 0x8b, 0xfe, 0xff, 0x97, 0x72, 0xfe, 0xff, 
+  0x8f, 0x67, 0xfe, 0xff, 0x84, 0x5b, 0xfe, 0xff, 0x82, 0x59, 0xfe, 0xff, 0x85, 0x5e, 0xfe, 0xff, 0x8c, 0x69, 0xfe, 0xff, 0x92, 0x73, 0xfe, 0xff, 0xa0, 0x86, 0xfe, 0xff, 0xba, 0xa7, 0xff, 0xff, 
+  0xde, 0xd6, 0xff, 0xff, 0xf8, 0xf6, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x6c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x07, 
+  0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xfc, 0x91, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xf9, 0xff, 0xff, 0xf7, 0xf4, 0xff, 0xff, 0xf0, 0xeb, 0xff, 0xff, 0xef, 0xe9, 
+  0xff, 0xff, 0xf1, 0xec, 0xff, 0xff, 0xf6, 0xf3, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x8f, 
+  0xff, 0xff, 0xff, 0x07, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xa0, 0xad, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x13, 
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xa7, 0xab, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xab, 0xff, 0xff, 0xff, 0x17, 0x90, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xfc, 0xa7, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x17, 
+  0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xf4, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x8f, 
+  0xff, 0xff, 0xff, 0x13, 0x94, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0xe3, 0xa3, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xe4, 
+  0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x07, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0x3c, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xd8, 0x9d, 0xff, 
+  0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0x10, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 
+  0xff, 0xdc, 0x99, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x27, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 
+  0xff, 0x23, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xf7, 0x93, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0x7f, 
+  0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x03, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 
+  0xff, 0xeb, 0xff, 0xff, 0xff, 0xfb, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0x4b, 
+  0xff, 0xff, 0xff, 0x13, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 
+  0xff, 0xd8, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf3, 0x81, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xc3, 
+  0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x10, 0x96, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +494,7 @@ const lv_img_dsc_t tinder_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( tinder_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = tinder_64px_map,
 };
-
@@ -10,207 +10,307 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_UTILITIES_48PX uint8_t utilities_48px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0c, 0x4e, 0x5c, 0x6e, 0x8b, 0x6e, 0xab, 0x6e, 0x63, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x23, 0x6e, 0x80, 0x72, 0xe8, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x6e, 0xd7, 0x6e, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x28, 0x6e, 0xbb, 0xb7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xa4, 0x4e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x23, 0x6e, 0xb4, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xfb, 0x4e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x13, 0x6e, 0xa3, 0xbb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x96, 0xfc, 0x6e, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x34, 0x4e, 0x58, 0x4e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x4c, 0x92, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xd3, 0x4e, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0f, 0x6e, 0xd3, 0x92, 0xfc, 0x6e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xa3, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xf7, 0x6e, 0x7b, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6c, 0x97, 0xff, 0xdf, 0xff, 0x72, 0xec, 0x4e, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x04, 0x72, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xbf, 0x4e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x34, 0x6e, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4e, 0x5b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x20, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x97, 0xff, 0x6e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0c, 0x6e, 0x8f, 0xb7, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0x84, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x30, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x6e, 0xd3, 0x6e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3b, 0x92, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0x97, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x20, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xeb, 0x6e, 0x7c, 0x4e, 0x23, 0x4e, 0x0b, 0x4e, 0x0b, 0x6e, 0xbc, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0x8c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x07, 0x92, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x6e, 0xc7, 0x6e, 0x94, 0x4e, 0x94, 0x92, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0x68, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x92, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x2b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xff, 0x72, 0xeb, 0x6e, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x92, 0xf8, 0x6e, 0x8f, 0x4e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x72, 0xf3, 0x4e, 0x88, 0x4a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x97, 0xff, 0x92, 0xfb, 0x6e, 0xd0, 0x6e, 0x74, 0x6e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x97, 0xff, 0x6e, 0xef, 0x6e, 0xe0, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xf0, 0x6e, 0xc3, 0x6e, 0x6c, 0x4e, 0x2b, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xfc, 0x6e, 0xd4, 0x4e, 0x24, 0x00, 0x00, 0x4a, 0x04, 0x6d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x96, 0xff, 0x6e, 0xd4, 0x6e, 0x3f, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xfc, 0x6e, 0xd4, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x08, 0x4e, 0x2c, 0x6e, 0x48, 0x6e, 0x47, 0x4e, 0x27, 0x4e, 0x58, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xd4, 0x6e, 0x3f, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0c, 0x4e, 0x40, 0x6e, 0x98, 0x72, 0xf3, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x92, 0xfc, 0x6e, 0xd4, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x0f, 0x6e, 0x8b, 0x92, 0xe4, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x96, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x10, 0x4e, 0x94, 0x97, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xd4, 0x6e, 0x3f, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0c, 0x6e, 0x90, 0xb7, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xfc, 0x6e, 0xd4, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x48, 0x92, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xa8, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xff, 0x6e, 0xd4, 0x6e, 0x3f, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6e, 0x13, 0x92, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xf4, 0x92, 0xf0, 0xb7, 0xfc, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4e, 0x44, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0x7f, 0x4e, 0x64, 0x4e, 0x8f, 0x72, 0xe0, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x92, 0xff, 0x6e, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xc7, 0x4e, 0x08, 0x00, 0x00, 0x4a, 0x0b, 0x6e, 0x3f, 0x6e, 0xb0, 0x92, 0xfb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4e, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6e, 0x64, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xe8, 0x6e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0c, 0x6e, 0x9b, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6e, 0x4c, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xfb, 0x6e, 0x98, 0x4e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4e, 0x1b, 0x92, 0xfc, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xdc, 0x4e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x13, 0x6e, 0xb4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xfc, 0x6e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xac, 0xbb, 0xff, 0x96, 0xff, 0x6e, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x04, 0x6e, 0x70, 0x97, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x4b, 0x72, 0xd8, 0x6e, 0xcc, 0x4e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x28, 0x72, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xf0, 0x6e, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x08, 0x6e, 0x2c, 0x6e, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x7f, 0xb7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xfc, 0x6e, 0xa4, 0x4e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x27, 0x92, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xfc, 0x4e, 0xaf, 0x6e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x07, 0x4e, 0x98, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xf4, 0x6e, 0xab, 0x4e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x0c, 0x4e, 0xbf, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xc8, 0x6e, 0x60, 0x4e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x1c, 0x6e, 0x6b, 0x6e, 0x4f, 0x6e, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x05, 0x4e, 0x0c, 0x4e, 0x5c, 0x6e, 0x8b, 0x6e, 0xab, 0x6e, 0x63, 0x49, 0x04, 0xa7, 0x00, 0x00, 0x03, 0x6e, 0x23, 0x6e, 0x80, 0x72, 0xe8, 0xb7, 0xff, 
+  0x81, 0xdb, 0xff, 0x01, 0x6e, 0xd7, 0x6e, 0x2f, 0xa6, 0x00, 0x00, 0x02, 0x6e, 0x28, 0x6e, 0xbb, 0xb7, 0xfb, 0x82, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x6e, 0xa4, 0x4e, 0x0c, 0xa5, 0x00, 0x00, 0x02, 
+  0x6e, 0x23, 0x6e, 0xb4, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x72, 0xfb, 0x4e, 0x30, 0xa5, 0x00, 0x00, 0x02, 0x6e, 0x13, 0x6e, 0xa3, 0xbb, 0xfc, 0x82, 0xff, 0xff, 0x02, 0xdf, 0xff, 
+  0x96, 0xfc, 0x6e, 0x8b, 0x85, 0x00, 0x00, 0x02, 0x6e, 0x34, 0x4e, 0x58, 0x4e, 0x1b, 0x9d, 0x00, 0x00, 0x01, 0x6e, 0x4c, 0x92, 0xec, 0x83, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x72, 0xd3, 0x4e, 0x2f, 
+  0x84, 0x00, 0x00, 0x03, 0x4e, 0x0f, 0x6e, 0xd3, 0x92, 0xfc, 0x6e, 0x90, 0x9d, 0x00, 0x00, 0x01, 0x6e, 0xa3, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x92, 0xf7, 0x6e, 0x7b, 0x6e, 0x07, 
+  0x84, 0x00, 0x00, 0x04, 0x6e, 0x6c, 0x97, 0xff, 0xdf, 0xff, 0x72, 0xec, 0x4e, 0x0f, 0x9b, 0x00, 0x00, 0x01, 0x4e, 0x04, 0x72, 0xf0, 0x83, 0xff, 0xff, 0x02, 0xb7, 0xff, 0x6e, 0xbf, 0x4e, 0x18, 
+  0x84, 0x00, 0x00, 0x01, 0x6e, 0x34, 0x6e, 0xd8, 0x81, 0xff, 0xff, 0x01, 0x92, 0xff, 0x4e, 0x5b, 0x9b, 0x00, 0x00, 0x01, 0x4e, 0x20, 0x92, 0xff, 0x82, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x97, 0xff, 
+  0x6e, 0x90, 0x84, 0x00, 0x00, 0x02, 0x4e, 0x0c, 0x6e, 0x8f, 0xb7, 0xf8, 0x81, 0xff, 0xff, 0x01, 0xb7, 0xff, 0x6e, 0x84, 0x9b, 0x00, 0x00, 0x01, 0x4e, 0x30, 0x92, 0xff, 0x83, 0xff, 0xff, 0x02, 
+  0xbb, 0xff, 0x6e, 0xd3, 0x6e, 0x3c, 0x83, 0x00, 0x00, 0x01, 0x6e, 0x3b, 0x92, 0xe4, 0x82, 0xff, 0xff, 0x01, 0xb7, 0xff, 0x4e, 0x97, 0x9b, 0x00, 0x00, 0x01, 0x6e, 0x20, 0x92, 0xff, 0x83, 0xff, 
+  0xff, 0x04, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xeb, 0x6e, 0x7c, 0x4e, 0x23, 0x81, 0x4e, 0x0b, 0x01, 0x6e, 0xbc, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xb7, 0xff, 0x4e, 0x8c, 0x9b, 0x00, 0x00, 0x01, 
+  0x2d, 0x07, 0x92, 0xf7, 0x84, 0xff, 0xff, 0x06, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x6e, 0xc7, 0x6e, 0x94, 0x4e, 0x94, 0x92, 0xfc, 0x82, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0x68, 
+  0x9b, 0x00, 0x00, 0x01, 0x4e, 0x53, 0x92, 0xfb, 0x85, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xdb, 0xff, 0x82, 0xb7, 0xff, 0x83, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x2b, 0x99, 0x00, 0x00, 
+  0x02, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0x89, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xbc, 0x9a, 0x00, 0x00, 0x04, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 
+  0xff, 0xff, 0xff, 0xdf, 0xff, 0x81, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xb7, 0xff, 0x72, 0xeb, 0x6e, 0x53, 0x99, 0x00, 0x00, 0x07, 0x4e, 0x53, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 
+  0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0x88, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x02, 0x92, 0xf8, 0x6e, 0x8f, 0x4e, 0x0f, 0x97, 0x00, 0x00, 0x02, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0x81, 
+  0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xbb, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xdf, 0xff, 0x81, 0xdb, 0xff, 0x03, 0xb7, 0xff, 0x72, 0xf3, 0x4e, 
+  0x88, 0x4a, 0x0c, 0x98, 0x00, 0x00, 0x04, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x81, 0xbb, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xdb, 0xff, 0x84, 
+  0xb7, 0xff, 0x04, 0x97, 0xff, 0x92, 0xfb, 0x6e, 0xd0, 0x6e, 0x74, 0x6e, 0x08, 0x98, 0x00, 0x00, 0x07, 0x4e, 0x53, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xdb, 
+  0xff, 0x81, 0xff, 0xff, 0x0b, 0xdb, 0xff, 0xbb, 0xff, 0x97, 0xff, 0x6e, 0xef, 0x6e, 0xe0, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xf0, 0x6e, 0xc3, 0x6e, 0x6c, 0x4e, 0x2b, 0x6e, 0x07, 0x97, 0x00, 0x00, 
+  0x05, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x81, 0xb7, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x07, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xfc, 0x6e, 0xd4, 0x4e, 
+  0x24, 0x00, 0x00, 0x4a, 0x04, 0x6d, 0x08, 0x9c, 0x00, 0x00, 0x04, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0x81, 0xb7, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x04, 0xdb, 
+  0xff, 0xbb, 0xff, 0x92, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x9f, 0x00, 0x00, 0x04, 0x4e, 0x53, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x81, 0xb7, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 
+  0x05, 0xdb, 0xff, 0xb7, 0xff, 0x96, 0xff, 0x6e, 0xd4, 0x6e, 0x3f, 0x49, 0x04, 0x9d, 0x00, 0x00, 0x02, 0x4e, 0x08, 0x6e, 0x6b, 0x72, 0xeb, 0x81, 0xff, 0xff, 0x00, 0xdb, 0xff, 0x81, 0xb7, 0xff, 
+  0x00, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xfc, 0x6e, 0xd4, 0x4e, 0x24, 0x9f, 0x00, 0x00, 0x04, 0x6e, 0x6b, 0x92, 0xe4, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x81, 
+  0xb7, 0xff, 0x07, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x9a, 0x00, 0x00, 0x09, 0x49, 0x08, 0x4e, 0x2c, 0x6e, 0x48, 0x6e, 0x47, 0x4e, 
+  0x27, 0x4e, 0x58, 0x72, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x81, 0xb7, 0xff, 0x08, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xd4, 0x6e, 0x3f, 0x49, 
+  0x04, 0x97, 0x00, 0x00, 0x03, 0x4e, 0x0c, 0x4e, 0x40, 0x6e, 0x98, 0x72, 0xf3, 0x84, 0x92, 0xff, 0x81, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0xb7, 0xff, 0x07, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 
+  0xdf, 0xff, 0xbb, 0xff, 0x92, 0xfc, 0x6e, 0xd4, 0x4e, 0x24, 0x98, 0x00, 0x00, 0x03, 0x6e, 0x0f, 0x6e, 0x8b, 0x92, 0xe4, 0xb7, 0xff, 0x87, 0xff, 0xff, 0x81, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x81, 
+  0xff, 0xff, 0x03, 0xdb, 0xff, 0x96, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x98, 0x00, 0x00, 0x02, 0x4e, 0x10, 0x4e, 0x94, 0x97, 0xf8, 0x88, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 
+  0xff, 0x81, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xd4, 0x6e, 0x3f, 0x49, 0x04, 0x97, 0x00, 0x00, 0x02, 0x4e, 0x0c, 0x6e, 0x90, 0xb7, 0xf8, 0x89, 0xff, 0xff, 0x02, 0xdb, 0xff, 0xbb, 
+  0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x97, 0xfc, 0x6e, 0xd4, 0x4e, 0x24, 0x99, 0x00, 0x00, 0x01, 0x4e, 0x48, 0x92, 0xe8, 0x8b, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0xff, 0xff, 
+  0x03, 0xdb, 0xff, 0x97, 0xfc, 0x6e, 0xcb, 0x6e, 0x3f, 0x9a, 0x00, 0x00, 0x01, 0x6e, 0xa8, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x87, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xb7, 0xff, 0x6e, 
+  0xd4, 0x6e, 0x3f, 0x49, 0x04, 0x99, 0x00, 0x00, 0x01, 0x6e, 0x13, 0x92, 0xfb, 0x83, 0xff, 0xff, 0x05, 0xdb, 0xff, 0x92, 0xf4, 0x92, 0xf0, 0xb7, 0xfc, 0xdb, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 
+  0x02, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x30, 0x9b, 0x00, 0x00, 0x01, 0x4e, 0x44, 0x92, 0xff, 0x82, 0xff, 0xff, 0x07, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0x7f, 0x4e, 0x64, 0x4e, 0x8f, 0x72, 0xe0, 0xb7, 
+  0xff, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x92, 0xff, 0x6e, 0x38, 0x9b, 0x00, 0x00, 0x01, 0x6e, 0x63, 0xb7, 0xff, 0x82, 0xff, 0xff, 0x08, 0xb7, 0xff, 0x6e, 0xc7, 0x4e, 0x08, 0x00, 
+  0x00, 0x4a, 0x0b, 0x6e, 0x3f, 0x6e, 0xb0, 0x92, 0xfb, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x01, 0x92, 0xff, 0x4e, 0x5c, 0x9b, 0x00, 0x00, 0x01, 0x6e, 0x64, 0xb7, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdb, 
+  0xff, 0x92, 0xe8, 0x6e, 0x43, 0x83, 0x00, 0x00, 0x02, 0x4e, 0x0c, 0x6e, 0x9b, 0xb7, 0xff, 0x83, 0xff, 0xff, 0x01, 0x92, 0xff, 0x6e, 0x60, 0x9b, 0x00, 0x00, 0x01, 0x6e, 0x4c, 0x96, 0xff, 0x81, 
+  0xff, 0xff, 0x02, 0xb7, 0xfb, 0x6e, 0x98, 0x4e, 0x10, 0x84, 0x00, 0x00, 0x01, 0x6e, 0x63, 0x97, 0xff, 0x83, 0xff, 0xff, 0x01, 0x92, 0xff, 0x6e, 0x48, 0x9b, 0x00, 0x00, 0x05, 0x4e, 0x1b, 0x92, 
+  0xfc, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xdc, 0x4e, 0x3f, 0x84, 0x00, 0x00, 0x02, 0x4e, 0x13, 0x6e, 0xb4, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x72, 0xfc, 0x6e, 0x18, 0x9c, 0x00, 0x00, 
+  0x03, 0x6e, 0xac, 0xbb, 0xff, 0x96, 0xff, 0x6e, 0x78, 0x84, 0x00, 0x00, 0x02, 0x4a, 0x04, 0x6e, 0x70, 0x97, 0xf3, 0x83, 0xff, 0xff, 0x01, 0xb7, 0xff, 0x6e, 0xb8, 0x9d, 0x00, 0x00, 0x03, 0x6e, 
+  0x4b, 0x72, 0xd8, 0x6e, 0xcc, 0x4e, 0x14, 0x84, 0x00, 0x00, 0x01, 0x4e, 0x28, 0x72, 0xcb, 0x83, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x92, 0xf0, 0x6e, 0x58, 0x9d, 0x00, 0x00, 0x02, 0x4d, 0x08, 0x6e, 
+  0x2c, 0x6e, 0x27, 0x85, 0x00, 0x00, 0x01, 0x6e, 0x7f, 0xb7, 0xfb, 0x83, 0xff, 0xff, 0x02, 0x97, 0xfc, 0x6e, 0xa4, 0x4e, 0x14, 0xa5, 0x00, 0x00, 0x01, 0x4e, 0x27, 0x92, 0xf7, 0x82, 0xff, 0xff, 
+  0x03, 0xdb, 0xff, 0x97, 0xfc, 0x4e, 0xaf, 0x6e, 0x1f, 0xa5, 0x00, 0x00, 0x08, 0x4a, 0x07, 0x4e, 0x98, 0xb7, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xf4, 0x6e, 0xab, 0x4e, 0x20, 0xa6, 
+  0x00, 0x00, 0x01, 0x6e, 0x0c, 0x4e, 0xbf, 0x81, 0x92, 0xff, 0x03, 0x72, 0xff, 0x6e, 0xc8, 0x6e, 0x60, 0x4e, 0x17, 0xa8, 0x00, 0x00, 0x03, 0x4e, 0x1c, 0x6e, 0x6b, 0x6e, 0x4f, 0x6e, 0x28, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x43, 0x0c, 0x0e, 0x53, 0x5c, 0x0e, 0x53, 0x8b, 0x0e, 0x53, 0xab, 0x0e, 0x53, 0x63, 0x08, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x52, 0x23, 0x2f, 0x5b, 0x80, 0xd1, 0x6b, 0xe8, 0xf5, 0x94, 0xff, 0x39, 0xc6, 0xff, 0x9b, 0xce, 0xff, 0x2f, 0x5b, 0xd7, 0xee, 0x52, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x52, 0x28, 0x70, 0x63, 0xbb, 0x36, 0x9d, 0xfb, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x19, 0xbe, 0xff, 0x0e, 0x53, 0xa4, 0x0f, 0x53, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x23, 0x0f, 0x53, 0xb4, 0x19, 0xbe, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xf1, 0x73, 0xfb, 0x0e, 0x53, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x5b, 0x13, 0x4f, 0x5b, 0xa3, 0xb7, 0xb5, 0xfc, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9b, 0xce, 0xff, 0x94, 0x8c, 0xfc, 0x2f, 0x53, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x34, 0x0e, 0x53, 0x58, 0xee, 0x4a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x4c, 0x73, 0x84, 0xec, 0x5d, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0x97, 0xad, 0xff, 0x90, 0x63, 0xd3, 0xee, 0x52, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x4a, 0x0f, 0x70, 0x63, 0xd3, 0x32, 0x7c, 0xfc, 0x4f, 0x5b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x63, 0xa3, 0xd8, 0xb5, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x53, 0x84, 0xf7, 0x0e, 0x53, 0x7b, 0xb0, 0x5a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x6c, 0xd4, 0x94, 0xff, 0x9b, 0xd6, 0xff, 0xd1, 0x6b, 0xec, 0xee, 0x4a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0x04, 0xf1, 0x73, 0xf0, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x97, 0xad, 0xff, 0x0e, 0x53, 0xbf, 0x0d, 0x4b, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x34, 0x70, 0x63, 0xd8, 0x5d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x20, 0x12, 0x7c, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0xd4, 0x94, 0xff, 0x0e, 0x53, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x53, 0x0c, 0x0e, 0x53, 0x8f, 0x56, 0xa5, 0xf8, 0xbf, 0xf7, 0xff, 0xfc, 0xde, 0xff, 0xd5, 0x94, 0xff, 0x0e, 0x53, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x30, 0x32, 0x7c, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0xdc, 0xd6, 0xff, 0x97, 0xad, 0xff, 0x2f, 0x5b, 0xd3, 0x0e, 0x53, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x3b, 0x12, 0x7c, 0xe4, 0xfc, 0xde, 0xff, 0x9e, 0xf7, 0xff, 0xfc, 0xde, 0xff, 0x36, 0x9d, 0xff, 0x0e, 0x53, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x5a, 0x20, 0x32, 0x7c, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x7b, 0xce, 0xff, 0x16, 0x9d, 0xff, 0x90, 0x63, 0xeb, 0x0e, 0x53, 0x7c, 0x0f, 0x53, 0x23, 0x2d, 0x4b, 0x0b, 0x2d, 0x4b, 0x0b, 0x70, 0x63, 0xbc, 0xd8, 0xb5, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xdb, 0xd6, 0xff, 0xf5, 0x94, 0xff, 0xee, 0x52, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x2a, 0x07, 0xf1, 0x73, 0xf7, 0x1c, 0xdf, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x5a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x53, 0x7c, 0xff, 0x70, 0x63, 0xc7, 0x0e, 0x53, 0x94, 0x0e, 0x53, 0x94, 0x73, 0x84, 0xfc, 0x1d, 0xe7, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x53, 0x84, 0xff, 0x0e, 0x53, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x53, 0x12, 0x7c, 0xfb, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x56, 0xa5, 0xff, 0x15, 0x9d, 0xff, 0x97, 0xad, 0xff, 0xdc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xf9, 0xbd, 0xff, 0xb1, 0x6b, 0xff, 0x0e, 0x53, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x73, 0xeb, 0xfc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xdc, 0xd6, 0xff, 0xbb, 0xd6, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x7a, 0xce, 0xff, 0xd5, 0x94, 0xff, 0x4f, 0x5b, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x6b, 0x12, 0x7c, 0xe4, 0x7a, 0xce, 0xff, 0x3d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x3a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0x77, 0xa5, 0xff, 0xd1, 0x6b, 0xeb, 0x0e, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x53, 0xd1, 0x73, 0xeb, 0x7a, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0x9b, 0xd6, 0xff, 0xd8, 0xb5, 0xff, 0xb8, 0xb5, 0xff, 0x7b, 0xce, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xde, 0xff, 0xdc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x7b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0xf2, 0x73, 0xf8, 0x0e, 0x5b, 0x8f, 0xee, 0x4a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x73, 0xeb, 0xdc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xb8, 0xad, 0xff, 0xb8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0x7b, 0xce, 0xff, 0x7b, 0xce, 0xff, 0x9b, 0xce, 0xff, 0x9b, 0xce, 0xff, 0x9b, 0xce, 0xff, 0x7a, 0xc6, 0xff, 0xd8, 0xb5, 0xff, 0x16, 0x9d, 0xff, 0xd1, 0x6b, 0xf3, 0xee, 0x52, 0x88, 0x6f, 0x52, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x6b, 0x12, 0x74, 0xe4, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xc6, 0xff, 0xb8, 0xb5, 0xff, 0xb8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0x15, 0x9d, 0xff, 0x16, 0x9d, 0xff, 0x77, 0xa5, 0xff, 0x77, 0xad, 0xff, 0x56, 0xa5, 0xff, 0xd5, 0x94, 0xff, 0x32, 0x7c, 0xfb, 0x70, 0x63, 0xd0, 0x0e, 0x53, 0x74, 0xae, 0x5a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x53, 0xd1, 0x73, 0xeb, 0x5a, 0xc6, 0xff, 0xdc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x97, 0xad, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xe7, 0xff, 0x7b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0xb4, 0x8c, 0xff, 0x70, 0x63, 0xef, 0x70, 0x63, 0xe0, 0x90, 0x63, 0xfb, 0x90, 0x63, 0xff, 0x70, 0x63, 0xf0, 0x4f, 0x5b, 0xc3, 0xee, 0x52, 0x6c, 0x0e, 0x53, 0x2b, 0xb0, 0x5a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x6b, 0xeb, 0xbb, 0xd6, 0xff, 0xbc, 0xd6, 0xff, 0x3a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x97, 0xad, 0xff, 0x3a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x73, 0x84, 0xfc, 0x4f, 0x5b, 0xd4, 0x0e, 0x4b, 0x24, 0x00, 0x00, 0x00, 0xad, 0x31, 0x04, 0x0c, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x6b, 0x12, 0x74, 0xe4, 0x3a, 0xc6, 0xff, 0xbc, 0xd6, 0xff, 0x1a, 0xbe, 0xff, 0x77, 0xad, 0xff, 0x77, 0xad, 0xff, 0x39, 0xc6, 0xff, 0xdc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x73, 0x84, 0xfc, 0x6f, 0x5b, 0xcb, 0x0e, 0x53, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x53, 0xd1, 0x73, 0xeb, 0x5a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x3a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x57, 0xa5, 0xff, 0x19, 0xbe, 0xff, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x3a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x94, 0x8c, 0xff, 0x4f, 0x5b, 0xd4, 0x0e, 0x53, 0x3f, 0x08, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x73, 0xeb, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0x57, 0xa5, 0xff, 0x77, 0xa5, 0xff, 0x19, 0xbe, 0xff, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x73, 0x84, 0xfc, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x6b, 0x12, 0x7c, 0xe4, 0x7a, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0x7b, 0xce, 0xff, 0x77, 0xad, 0xff, 0x56, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 0xbb, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x7b, 0xce, 0xff, 0xb8, 0xb5, 0xff, 0x73, 0x84, 0xfc, 0x4f, 0x5b, 0xcb, 0xee, 0x52, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x42, 0x08, 0x0e, 0x53, 0x2c, 0x0e, 0x53, 0x48, 0xee, 0x52, 0x47, 0xee, 0x52, 0x27, 0x0e, 0x53, 0x58, 0xd1, 0x73, 0xeb, 0x7a, 0xce, 0xff, 0x1d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x97, 0xad, 0xff, 0x36, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 0x9b, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xd9, 0xb5, 0xff, 0xb4, 0x8c, 0xff, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x3f, 0x08, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x42, 0x0c, 0xee, 0x52, 0x40, 0x4f, 0x5b, 0x98, 0xd1, 0x73, 0xf3, 0x32, 0x7c, 0xff, 0x73, 0x84, 0xff, 0x73, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0x57, 0xa5, 0xff, 0x36, 0x9d, 0xff, 0xd8, 0xb5, 0xff, 0xbb, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0xbc, 0xd6, 0xff, 0xd8, 0xb5, 0xff, 0x94, 0x8c, 0xfc, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x5a, 0x0f, 0x2f, 0x5b, 0x8b, 0x32, 0x7c, 0xe4, 0x97, 0xad, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xdc, 0xd6, 0xff, 0x97, 0xad, 0xff, 0x36, 0x9d, 0xff, 0xd8, 0xb5, 0xff, 0x7b, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0xdc, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x94, 0x8c, 0xfc, 0x70, 0x63, 0xcb, 0x0e, 0x53, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x10, 0xee, 0x52, 0x94, 0xd5, 0x94, 0xf8, 0xfc, 0xde, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0x15, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0x1c, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0x3a, 0xc6, 0xff, 0xf5, 0x94, 0xff, 0x4f, 0x5b, 0xd4, 0x0e, 0x53, 0x3f, 0x08, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x53, 0x0c, 0x2f, 0x5b, 0x90, 0xf5, 0x94, 0xf8, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x19, 0xbe, 0xff, 0xb8, 0xb5, 0xff, 0x7b, 0xce, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x19, 0xbe, 0xff, 0xb4, 0x8c, 0xfc, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x48, 0x53, 0x84, 0xe8, 0x3d, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xbb, 0xd6, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x7a, 0xce, 0xff, 0xb4, 0x94, 0xfc, 0x70, 0x63, 0xcb, 0x0e, 0x53, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x63, 0xa8, 0xf8, 0xbd, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0x9b, 0xd6, 0xff, 0x9b, 0xce, 0xff, 0xdc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x16, 0x9d, 0xff, 0x4f, 0x63, 0xd4, 0x0e, 0x53, 0x3f, 0x08, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x52, 0x13, 0xf2, 0x7b, 0xfb, 0x7e, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0x73, 0x84, 0xf4, 0x73, 0x84, 0xf0, 0xf5, 0x94, 0xfc, 0xd8, 0xb5, 0xff, 0xbb, 0xd6, 0xff, 0x5e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5e, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0xb1, 0x6b, 0xff, 0xee, 0x52, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x44, 0x94, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x7a, 0xce, 0xff, 0x32, 0x7c, 0xff, 0xee, 0x52, 0x7f, 0xee, 0x52, 0x64, 0x0e, 0x53, 0x8f, 0xd1, 0x6b, 0xe0, 0xf5, 0x94, 0xff, 0x5a, 0xc6, 0xff, 0x5d, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9b, 0xd6, 0xff, 0xf1, 0x73, 0xff, 0x0e, 0x53, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x63, 0x36, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0x56, 0xa5, 0xff, 0x4f, 0x63, 0xc7, 0xae, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x6d, 0x4a, 0x0b, 0x0e, 0x53, 0x3f, 0x4f, 0x5b, 0xb0, 0x53, 0x7c, 0xfb, 0x9b, 0xce, 0xff, 0x7e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xfc, 0xde, 0xff, 0x73, 0x84, 0xff, 0xee, 0x52, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x64, 0x56, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf9, 0xbd, 0xff, 0xf2, 0x73, 0xe8, 0x0e, 0x53, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x42, 0x0c, 0x0e, 0x53, 0x9b, 0x15, 0x9d, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0xff, 0x73, 0x84, 0xff, 0x0e, 0x53, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x4c, 0xb4, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0xf5, 0x94, 0xfb, 0x2f, 0x53, 0x98, 0x0e, 0x53, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x63, 0xb4, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfc, 0xde, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x4a, 0x1b, 0x12, 0x7c, 0xfc, 0x7e, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x70, 0x63, 0xdc, 0x0e, 0x53, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x4a, 0x13, 0x0e, 0x53, 0xb4, 0x9b, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7a, 0xce, 0xff, 0xb1, 0x6b, 0xfc, 0xee, 0x52, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x63, 0xac, 0xb7, 0xad, 0xff, 0xb4, 0x8c, 0xff, 0x0e, 0x53, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x31, 0x04, 0x0e, 0x53, 0x70, 0xd4, 0x94, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0x36, 0x9d, 0xff, 0x4f, 0x63, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x4b, 0xb1, 0x6b, 0xd8, 0x70, 0x63, 0xcc, 0xce, 0x4a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x4b, 0x28, 0xd1, 0x6b, 0xcb, 0xdc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x39, 0xc6, 0xff, 0x12, 0x7c, 0xf0, 0x0e, 0x53, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x43, 0x08, 0xee, 0x52, 0x2c, 0xee, 0x52, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x7f, 0x36, 0xa5, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdc, 0xde, 0xff, 0xd4, 0x94, 0xfc, 0x2f, 0x5b, 0xa4, 0xae, 0x4a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x27, 0x12, 0x74, 0xf7, 0x3d, 0xe7, 0xff, 0xbf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0xd5, 0x94, 0xfc, 0xee, 0x52, 0xaf, 0x2e, 0x53, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x4a, 0x07, 0x0e, 0x53, 0x98, 0x77, 0xa5, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xce, 0xff, 0x56, 0xa5, 0xff, 0x32, 0x7c, 0xf4, 0x4f, 0x5b, 0xab, 0x0e, 0x53, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x5a, 0x0c, 0x0e, 0x53, 0xbf, 0x53, 0x84, 0xff, 0x32, 0x7c, 0xff, 0xd1, 0x6b, 0xff, 0x70, 0x63, 0xc8, 0x0f, 0x53, 0x60, 0xce, 0x52, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x1c, 0x0e, 0x53, 0x6b, 0x0e, 0x53, 0x4f, 0x0e, 0x53, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x05, 0x4d, 0x43, 0x0c, 0x0e, 0x53, 0x5c, 0x0e, 0x53, 0x8b, 0x0e, 0x53, 0xab, 0x0e, 0x53, 0x63, 0x08, 0x42, 0x04, 0xa7, 0x00, 0x00, 0x00, 0x07, 
+  0xce, 0x52, 0x23, 0x2f, 0x5b, 0x80, 0xd1, 0x6b, 0xe8, 0xf5, 0x94, 0xff, 0x39, 0xc6, 0xff, 0x9b, 0xce, 0xff, 0x2f, 0x5b, 0xd7, 0xee, 0x52, 0x2f, 0xa6, 0x00, 0x00, 0x00, 0x08, 0xef, 0x52, 0x28, 
+  0x70, 0x63, 0xbb, 0x36, 0x9d, 0xfb, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x19, 0xbe, 0xff, 0x0e, 0x53, 0xa4, 0x0f, 0x53, 0x0c, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x53, 0x23, 
+  0x0f, 0x53, 0xb4, 0x19, 0xbe, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xf1, 0x73, 0xfb, 0x0e, 0x53, 0x30, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x2e, 0x5b, 0x13, 
+  0x4f, 0x5b, 0xa3, 0xb7, 0xb5, 0xfc, 0x82, 0xdf, 0xff, 0xff, 0x02, 0x9b, 0xce, 0xff, 0x94, 0x8c, 0xfc, 0x2f, 0x53, 0x8b, 0x85, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x34, 0x0e, 0x53, 0x58, 0xee, 
+  0x4a, 0x1b, 0x9d, 0x00, 0x00, 0x00, 0x08, 0xee, 0x52, 0x4c, 0x73, 0x84, 0xec, 0x5d, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0x97, 0xad, 0xff, 0x90, 0x63, 0xd3, 0xee, 
+  0x52, 0x2f, 0x84, 0x00, 0x00, 0x00, 0x03, 0xee, 0x4a, 0x0f, 0x70, 0x63, 0xd3, 0x32, 0x7c, 0xfc, 0x4f, 0x5b, 0x90, 0x9d, 0x00, 0x00, 0x00, 0x08, 0x70, 0x63, 0xa3, 0xd8, 0xb5, 0xff, 0xbf, 0xf7, 
+  0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x53, 0x84, 0xf7, 0x0e, 0x53, 0x7b, 0xb0, 0x5a, 0x07, 0x84, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0x6c, 0xd4, 0x94, 0xff, 0x9b, 0xd6, 
+  0xff, 0xd1, 0x6b, 0xec, 0xee, 0x4a, 0x0f, 0x9b, 0x00, 0x00, 0x00, 0x08, 0x2d, 0x33, 0x04, 0xf1, 0x73, 0xf0, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x97, 0xad, 
+  0xff, 0x0e, 0x53, 0xbf, 0x0d, 0x4b, 0x18, 0x84, 0x00, 0x00, 0x00, 0x05, 0xee, 0x52, 0x34, 0x70, 0x63, 0xd8, 0x5d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0x5b, 0x9b, 0x00, 
+  0x00, 0x00, 0x01, 0x0e, 0x53, 0x20, 0x12, 0x7c, 0xff, 0x82, 0x7e, 0xef, 0xff, 0x02, 0xbb, 0xd6, 0xff, 0xd4, 0x94, 0xff, 0x0e, 0x53, 0x90, 0x84, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x53, 0x0c, 0x0e, 
+  0x53, 0x8f, 0x56, 0xa5, 0xf8, 0xbf, 0xf7, 0xff, 0xfc, 0xde, 0xff, 0xd5, 0x94, 0xff, 0x0e, 0x53, 0x84, 0x9b, 0x00, 0x00, 0x00, 0x02, 0xee, 0x52, 0x30, 0x32, 0x7c, 0xff, 0x7e, 0xef, 0xff, 0x81, 
+  0x5e, 0xef, 0xff, 0x03, 0xdc, 0xd6, 0xff, 0x97, 0xad, 0xff, 0x2f, 0x5b, 0xd3, 0x0e, 0x53, 0x3c, 0x83, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x53, 0x3b, 0x12, 0x7c, 0xe4, 0xfc, 0xde, 0xff, 0x9e, 0xf7, 
+  0xff, 0xfc, 0xde, 0xff, 0x36, 0x9d, 0xff, 0x0e, 0x53, 0x97, 0x9b, 0x00, 0x00, 0x00, 0x03, 0xee, 0x5a, 0x20, 0x32, 0x7c, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x81, 0x3d, 0xe7, 0xff, 0x04, 
+  0x7b, 0xce, 0xff, 0x16, 0x9d, 0xff, 0x90, 0x63, 0xeb, 0x0e, 0x53, 0x7c, 0x0f, 0x53, 0x23, 0x81, 0x2d, 0x4b, 0x0b, 0x01, 0x70, 0x63, 0xbc, 0xd8, 0xb5, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x02, 0xdb, 
+  0xd6, 0xff, 0xf5, 0x94, 0xff, 0xee, 0x52, 0x8c, 0x9b, 0x00, 0x00, 0x00, 0x02, 0xab, 0x2a, 0x07, 0xf1, 0x73, 0xf7, 0x1c, 0xdf, 0xff, 0x82, 0x3d, 0xe7, 0xff, 0x04, 0x1d, 0xe7, 0xff, 0x5a, 0xc6, 
+  0xff, 0x77, 0xa5, 0xff, 0x53, 0x7c, 0xff, 0x70, 0x63, 0xc7, 0x81, 0x0e, 0x53, 0x94, 0x06, 0x73, 0x84, 0xfc, 0x1d, 0xe7, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x53, 0x84, 
+  0xff, 0x0e, 0x53, 0x68, 0x9b, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0x53, 0x12, 0x7c, 0xfb, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0x81, 0x1d, 0xe7, 0xff, 0x0c, 0x1d, 0xdf, 0xff, 
+  0xbb, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x56, 0xa5, 0xff, 0x15, 0x9d, 0xff, 0x97, 0xad, 0xff, 0xdc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xf9, 0xbd, 0xff, 0xb1, 0x6b, 
+  0xff, 0x0e, 0x53, 0x2b, 0x99, 0x00, 0x00, 0x00, 0x06, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x73, 0xeb, 0xfc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0x81, 0xfc, 
+  0xde, 0xff, 0x82, 0x1d, 0xdf, 0xff, 0x08, 0xdc, 0xd6, 0xff, 0xbb, 0xd6, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x7a, 0xce, 0xff, 0xd5, 0x94, 0xff, 0x4f, 
+  0x5b, 0xbc, 0x9a, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x53, 0x6b, 0x12, 0x7c, 0xe4, 0x7a, 0xce, 0xff, 0x3d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x3a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x85, 
+  0xfc, 0xde, 0xff, 0x82, 0x1d, 0xdf, 0xff, 0x03, 0xbb, 0xd6, 0xff, 0x77, 0xa5, 0xff, 0xd1, 0x6b, 0xeb, 0x0e, 0x53, 0x53, 0x99, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x53, 0x53, 0xd1, 0x73, 0xeb, 0x7a, 
+  0xce, 0xff, 0x1d, 0xdf, 0xff, 0x9b, 0xd6, 0xff, 0xd8, 0xb5, 0xff, 0xb8, 0xb5, 0xff, 0x7b, 0xce, 0xff, 0x81, 0xfc, 0xde, 0xff, 0x00, 0xdc, 0xd6, 0xff, 0x81, 0xdc, 0xde, 0xff, 0x83, 0xfc, 0xde, 
+  0xff, 0x04, 0x7b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0xf2, 0x73, 0xf8, 0x0e, 0x5b, 0x8f, 0xee, 0x4a, 0x0f, 0x97, 0x00, 0x00, 0x00, 0x0b, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x73, 0xeb, 0xdc, 
+  0xde, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xb8, 0xad, 0xff, 0xb8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0x81, 0x7b, 0xce, 0xff, 0x82, 0x9b, 
+  0xce, 0xff, 0x05, 0x7a, 0xc6, 0xff, 0xd8, 0xb5, 0xff, 0x16, 0x9d, 0xff, 0xd1, 0x6b, 0xf3, 0xee, 0x52, 0x88, 0x6f, 0x52, 0x0c, 0x98, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0x6b, 0x12, 0x74, 0xe4, 
+  0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xc6, 0xff, 0x81, 0xb8, 0xb5, 0xff, 0x0e, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0x15, 0x9d, 0xff, 
+  0x16, 0x9d, 0xff, 0x77, 0xa5, 0xff, 0x77, 0xad, 0xff, 0x56, 0xa5, 0xff, 0xd5, 0x94, 0xff, 0x32, 0x7c, 0xfb, 0x70, 0x63, 0xd0, 0x0e, 0x53, 0x74, 0xae, 0x5a, 0x08, 0x98, 0x00, 0x00, 0x00, 0x15, 
+  0x0e, 0x53, 0x53, 0xd1, 0x73, 0xeb, 0x5a, 0xc6, 0xff, 0xdc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x97, 0xad, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xe7, 0xff, 0x7b, 0xce, 
+  0xff, 0xd8, 0xb5, 0xff, 0xb4, 0x8c, 0xff, 0x70, 0x63, 0xef, 0x70, 0x63, 0xe0, 0x90, 0x63, 0xfb, 0x90, 0x63, 0xff, 0x70, 0x63, 0xf0, 0x4f, 0x5b, 0xc3, 0xee, 0x52, 0x6c, 0x0e, 0x53, 0x2b, 0xb0, 
+  0x5a, 0x07, 0x97, 0x00, 0x00, 0x00, 0x08, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x6b, 0xeb, 0xbb, 0xd6, 0xff, 0xbc, 0xd6, 0xff, 0x3a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x97, 0xad, 0xff, 0x3a, 
+  0xc6, 0xff, 0x81, 0xfc, 0xde, 0xff, 0x07, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x73, 0x84, 0xfc, 0x4f, 0x5b, 0xd4, 0x0e, 0x4b, 0x24, 0x00, 0x00, 0x00, 0xad, 0x31, 0x04, 0x0c, 0x63, 0x08, 0x9c, 
+  0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0x6b, 0x12, 0x74, 0xe4, 0x3a, 0xc6, 0xff, 0xbc, 0xd6, 0xff, 0x1a, 0xbe, 0xff, 0x81, 0x77, 0xad, 0xff, 0x07, 0x39, 0xc6, 0xff, 0xdc, 0xde, 0xff, 0xfc, 0xde, 
+  0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x73, 0x84, 0xfc, 0x6f, 0x5b, 0xcb, 0x0e, 0x53, 0x3f, 0x9f, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x53, 0x53, 0xd1, 0x73, 0xeb, 0x5a, 0xc6, 0xff, 0xdc, 0xd6, 
+  0xff, 0x3a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x57, 0xa5, 0xff, 0x19, 0xbe, 0xff, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x3a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x94, 0x8c, 0xff, 0x4f, 0x5b, 0xd4, 0x0e, 
+  0x53, 0x3f, 0x08, 0x42, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x0f, 0xae, 0x3a, 0x08, 0x0e, 0x53, 0x6b, 0xd1, 0x73, 0xeb, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0x57, 0xa5, 0xff, 0x77, 
+  0xa5, 0xff, 0x19, 0xbe, 0xff, 0xdc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x73, 0x84, 0xfc, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x24, 0x9f, 0x00, 0x00, 0x00, 0x0e, 0x0e, 
+  0x53, 0x6b, 0x12, 0x7c, 0xe4, 0x7a, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0x7b, 0xce, 0xff, 0x77, 0xad, 0xff, 0x56, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 0xbb, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x7b, 0xce, 0xff, 
+  0xb8, 0xb5, 0xff, 0x73, 0x84, 0xfc, 0x4f, 0x5b, 0xcb, 0xee, 0x52, 0x3f, 0x9a, 0x00, 0x00, 0x00, 0x14, 0x0c, 0x42, 0x08, 0x0e, 0x53, 0x2c, 0x0e, 0x53, 0x48, 0xee, 0x52, 0x47, 0xee, 0x52, 0x27, 
+  0x0e, 0x53, 0x58, 0xd1, 0x73, 0xeb, 0x7a, 0xce, 0xff, 0x1d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x97, 0xad, 0xff, 0x36, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 0x9b, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 
+  0xff, 0xd9, 0xb5, 0xff, 0xb4, 0x8c, 0xff, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x3f, 0x08, 0x42, 0x04, 0x97, 0x00, 0x00, 0x00, 0x04, 0xad, 0x42, 0x0c, 0xee, 0x52, 0x40, 0x4f, 0x5b, 0x98, 0xd1, 0x73, 
+  0xf3, 0x32, 0x7c, 0xff, 0x81, 0x73, 0x84, 0xff, 0x81, 0x32, 0x7c, 0xff, 0x0c, 0xfc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0x57, 0xa5, 0xff, 0x36, 0x9d, 0xff, 0xd8, 0xb5, 0xff, 0xbb, 
+  0xd6, 0xff, 0xfc, 0xde, 0xff, 0xbc, 0xd6, 0xff, 0xd8, 0xb5, 0xff, 0x94, 0x8c, 0xfc, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x24, 0x98, 0x00, 0x00, 0x00, 0x05, 0xaf, 0x5a, 0x0f, 0x2f, 0x5b, 0x8b, 0x32, 
+  0x7c, 0xe4, 0x97, 0xad, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x82, 0x5d, 0xef, 0xff, 0x0a, 0xdc, 0xd6, 0xff, 0x97, 0xad, 0xff, 0x36, 0x9d, 0xff, 0xd8, 0xb5, 0xff, 
+  0x7b, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0xdc, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x94, 0x8c, 0xfc, 0x70, 0x63, 0xcb, 0x0e, 0x53, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x10, 0xee, 0x52, 0x94, 
+  0xd5, 0x94, 0xf8, 0xfc, 0xde, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x00, 0x5e, 0xef, 0xff, 0x83, 0x5d, 0xe7, 0xff, 0x0b, 0x1d, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0x15, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 0x7a, 
+  0xce, 0xff, 0x1c, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0x3a, 0xc6, 0xff, 0xf5, 0x94, 0xff, 0x4f, 0x5b, 0xd4, 0x0e, 0x53, 0x3f, 0x08, 0x42, 0x04, 0x97, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x53, 0x0c, 0x2f, 
+  0x5b, 0x90, 0xf5, 0x94, 0xf8, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x82, 0x7e, 0xef, 0xff, 0x83, 0x5e, 0xef, 0xff, 0x03, 0x3d, 0xe7, 0xff, 0x19, 0xbe, 0xff, 0xb8, 0xb5, 0xff, 0x7b, 0xce, 0xff, 
+  0x81, 0x1d, 0xe7, 0xff, 0x03, 0x19, 0xbe, 0xff, 0xb4, 0x8c, 0xfc, 0x4f, 0x5b, 0xd4, 0xee, 0x52, 0x24, 0x99, 0x00, 0x00, 0x00, 0x03, 0xee, 0x52, 0x48, 0x53, 0x84, 0xe8, 0x3d, 0xe7, 0xff, 0xbf, 
+  0xf7, 0xff, 0x83, 0x9e, 0xf7, 0xff, 0x84, 0x7e, 0xef, 0xff, 0x07, 0xfc, 0xde, 0xff, 0xbb, 0xd6, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x7a, 0xce, 0xff, 0xb4, 0x94, 0xfc, 0x70, 0x63, 0xcb, 
+  0x0e, 0x53, 0x3f, 0x9a, 0x00, 0x00, 0x00, 0x02, 0x70, 0x63, 0xa8, 0xf8, 0xbd, 0xff, 0xbf, 0xff, 0xff, 0x81, 0xbf, 0xf7, 0xff, 0x04, 0x3d, 0xe7, 0xff, 0x9b, 0xd6, 0xff, 0x9b, 0xce, 0xff, 0xdc, 
+  0xde, 0xff, 0x5e, 0xef, 0xff, 0x82, 0x9e, 0xf7, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x05, 0x5e, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0x16, 0x9d, 0xff, 0x4f, 0x63, 0xd4, 0x0e, 0x53, 0x3f, 0x08, 0x42, 0x04, 
+  0x99, 0x00, 0x00, 0x00, 0x02, 0xed, 0x52, 0x13, 0xf2, 0x7b, 0xfb, 0x7e, 0xef, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x07, 0x3d, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0x73, 0x84, 0xf4, 0x73, 0x84, 0xf0, 0xf5, 
+  0x94, 0xfc, 0xd8, 0xb5, 0xff, 0xbb, 0xd6, 0xff, 0x5e, 0xef, 0xff, 0x81, 0xbf, 0xf7, 0xff, 0x04, 0x9e, 0xf7, 0xff, 0x5e, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0xb1, 0x6b, 0xff, 0xee, 0x52, 0x30, 0x9b, 
+  0x00, 0x00, 0x00, 0x01, 0xee, 0x52, 0x44, 0x94, 0x8c, 0xff, 0x81, 0xff, 0xff, 0xff, 0x09, 0xbf, 0xf7, 0xff, 0x7a, 0xce, 0xff, 0x32, 0x7c, 0xff, 0xee, 0x52, 0x7f, 0xee, 0x52, 0x64, 0x0e, 0x53, 
+  0x8f, 0xd1, 0x6b, 0xe0, 0xf5, 0x94, 0xff, 0x5a, 0xc6, 0xff, 0x5d, 0xef, 0xff, 0x81, 0xbf, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0xff, 0x9b, 0xd6, 0xff, 0xf1, 0x73, 0xff, 0x0e, 0x53, 0x38, 0x9b, 0x00, 
+  0x00, 0x00, 0x01, 0x0e, 0x53, 0x63, 0x36, 0xa5, 0xff, 0x81, 0xff, 0xff, 0xff, 0x0f, 0x3d, 0xe7, 0xff, 0x56, 0xa5, 0xff, 0x4f, 0x63, 0xc7, 0xae, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x6d, 0x4a, 0x0b, 
+  0x0e, 0x53, 0x3f, 0x4f, 0x5b, 0xb0, 0x53, 0x7c, 0xfb, 0x9b, 0xce, 0xff, 0x7e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xfc, 0xde, 0xff, 0x73, 0x84, 0xff, 0xee, 0x52, 0x5c, 0x9b, 0x00, 
+  0x00, 0x00, 0x06, 0xee, 0x52, 0x64, 0x56, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf9, 0xbd, 0xff, 0xf2, 0x73, 0xe8, 0x0e, 0x53, 0x43, 0x83, 0x00, 0x00, 0x00, 0x03, 0xad, 0x42, 0x0c, 
+  0x0e, 0x53, 0x9b, 0x15, 0x9d, 0xff, 0x9e, 0xf7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0x1c, 0xdf, 0xff, 0x73, 0x84, 0xff, 0x0e, 0x53, 0x60, 0x9b, 0x00, 0x00, 0x00, 0x06, 0xee, 0x52, 0x4c, 0xb4, 
+  0x8c, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0xf5, 0x94, 0xfb, 0x2f, 0x53, 0x98, 0x0e, 0x53, 0x10, 0x84, 0x00, 0x00, 0x00, 0x01, 0xee, 0x52, 0x63, 0xb4, 0x8c, 0xff, 0x81, 0xff, 0xff, 0xff, 
+  0x03, 0xdf, 0xff, 0xff, 0xfc, 0xde, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0x48, 0x9b, 0x00, 0x00, 0x00, 0x05, 0xee, 0x4a, 0x1b, 0x12, 0x7c, 0xfc, 0x7e, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x70, 0x63, 
+  0xdc, 0x0e, 0x53, 0x3f, 0x84, 0x00, 0x00, 0x00, 0x02, 0xae, 0x4a, 0x13, 0x0e, 0x53, 0xb4, 0x9b, 0xd6, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xbf, 0xff, 0xff, 0x7a, 0xce, 0xff, 0xb1, 0x6b, 0xfc, 
+  0xee, 0x52, 0x18, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x70, 0x63, 0xac, 0xb7, 0xad, 0xff, 0xb4, 0x8c, 0xff, 0x0e, 0x53, 0x78, 0x84, 0x00, 0x00, 0x00, 0x02, 0xad, 0x31, 0x04, 0x0e, 0x53, 0x70, 0xd4, 
+  0x94, 0xf3, 0x82, 0xff, 0xff, 0xff, 0x02, 0x3d, 0xe7, 0xff, 0x36, 0x9d, 0xff, 0x4f, 0x63, 0xb8, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x4b, 0xb1, 0x6b, 0xd8, 0x70, 0x63, 0xcc, 0xce, 0x4a, 
+  0x14, 0x84, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x4b, 0x28, 0xd1, 0x6b, 0xcb, 0xdc, 0xde, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xbf, 0xf7, 0xff, 0x39, 0xc6, 0xff, 0x12, 0x7c, 0xf0, 0x0e, 0x53, 0x58, 
+  0x9d, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x43, 0x08, 0xee, 0x52, 0x2c, 0xee, 0x52, 0x27, 0x85, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x53, 0x7f, 0x36, 0xa5, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 
+  0xff, 0xff, 0xdc, 0xde, 0xff, 0xd4, 0x94, 0xfc, 0x2f, 0x5b, 0xa4, 0xae, 0x4a, 0x14, 0xa5, 0x00, 0x00, 0x00, 0x08, 0xee, 0x52, 0x27, 0x12, 0x74, 0xf7, 0x3d, 0xe7, 0xff, 0xbf, 0xff, 0xff, 0x5d, 
+  0xef, 0xff, 0x5a, 0xc6, 0xff, 0xd5, 0x94, 0xfc, 0xee, 0x52, 0xaf, 0x2e, 0x53, 0x1f, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x4e, 0x4a, 0x07, 0x0e, 0x53, 0x98, 0x77, 0xa5, 0xff, 0xfc, 0xde, 0xff, 0x7a, 
+  0xce, 0xff, 0x56, 0xa5, 0xff, 0x32, 0x7c, 0xf4, 0x4f, 0x5b, 0xab, 0x0e, 0x53, 0x20, 0xa6, 0x00, 0x00, 0x00, 0x07, 0xad, 0x5a, 0x0c, 0x0e, 0x53, 0xbf, 0x53, 0x84, 0xff, 0x32, 0x7c, 0xff, 0xd1, 
+  0x6b, 0xff, 0x70, 0x63, 0xc8, 0x0f, 0x53, 0x60, 0xce, 0x52, 0x17, 0xa8, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x1c, 0x0e, 0x53, 0x6b, 0x0e, 0x53, 0x4f, 0x0e, 0x53, 0x28, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x4d, 0x0c, 0x53, 0x0e, 0x5c, 0x53, 0x0e, 0x8b, 0x53, 0x0e, 0xab, 0x53, 0x0e, 0x63, 0x42, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xce, 0x23, 0x5b, 0x2f, 0x80, 0x6b, 0xd1, 0xe8, 0x94, 0xf5, 0xff, 0xc6, 0x39, 0xff, 0xce, 0x9b, 0xff, 0x5b, 0x2f, 0xd7, 0x52, 0xee, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xef, 0x28, 0x63, 0x70, 0xbb, 0x9d, 0x36, 0xfb, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbe, 0x19, 0xff, 0x53, 0x0e, 0xa4, 0x53, 0x0f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x23, 0x53, 0x0f, 0xb4, 0xbe, 0x19, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x5a, 0xff, 0x73, 0xf1, 0xfb, 0x53, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x2e, 0x13, 0x5b, 0x4f, 0xa3, 0xb5, 0xb7, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xce, 0x9b, 0xff, 0x8c, 0x94, 0xfc, 0x53, 0x2f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x34, 0x53, 0x0e, 0x58, 0x4a, 0xee, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x4c, 0x84, 0x73, 0xec, 0xef, 0x5d, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x3d, 0xff, 0xad, 0x97, 0xff, 0x63, 0x90, 0xd3, 0x52, 0xee, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xee, 0x0f, 0x63, 0x70, 0xd3, 0x7c, 0x32, 0xfc, 0x5b, 0x4f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x70, 0xa3, 0xb5, 0xd8, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xce, 0x9b, 0xff, 0x84, 0x53, 0xf7, 0x53, 0x0e, 0x7b, 0x5a, 0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x6c, 0x94, 0xd4, 0xff, 0xd6, 0x9b, 0xff, 0x6b, 0xd1, 0xec, 0x4a, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x2d, 0x04, 0x73, 0xf1, 0xf0, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xde, 0xfc, 0xff, 0xad, 0x97, 0xff, 0x53, 0x0e, 0xbf, 0x4b, 0x0d, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x34, 0x63, 0x70, 0xd8, 0xe7, 0x5d, 0xff, 0xe7, 0x1d, 0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x20, 0x7c, 0x12, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xd6, 0xbb, 0xff, 0x94, 0xd4, 0xff, 0x53, 0x0e, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0f, 0x0c, 0x53, 0x0e, 0x8f, 0xa5, 0x56, 0xf8, 0xf7, 0xbf, 0xff, 0xde, 0xfc, 0xff, 0x94, 0xd5, 0xff, 0x53, 0x0e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x30, 0x7c, 0x32, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xdc, 0xff, 0xad, 0x97, 0xff, 0x5b, 0x2f, 0xd3, 0x53, 0x0e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x3b, 0x7c, 0x12, 0xe4, 0xde, 0xfc, 0xff, 0xf7, 0x9e, 0xff, 0xde, 0xfc, 0xff, 0x9d, 0x36, 0xff, 0x53, 0x0e, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xee, 0x20, 0x7c, 0x32, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7b, 0xff, 0x9d, 0x16, 0xff, 0x63, 0x90, 0xeb, 0x53, 0x0e, 0x7c, 0x53, 0x0f, 0x23, 0x4b, 0x2d, 0x0b, 0x4b, 0x2d, 0x0b, 0x63, 0x70, 0xbc, 0xb5, 0xd8, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xd6, 0xdb, 0xff, 0x94, 0xf5, 0xff, 0x52, 0xee, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xab, 0x07, 0x73, 0xf1, 0xf7, 0xdf, 0x1c, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x1d, 0xff, 0xc6, 0x5a, 0xff, 0xa5, 0x77, 0xff, 0x7c, 0x53, 0xff, 0x63, 0x70, 0xc7, 0x53, 0x0e, 0x94, 0x53, 0x0e, 0x94, 0x84, 0x73, 0xfc, 0xe7, 0x1d, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x5d, 0xff, 0xce, 0x9b, 0xff, 0x84, 0x53, 0xff, 0x53, 0x0e, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x53, 0x7c, 0x12, 0xfb, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xbd, 0xf9, 0xff, 0xa5, 0x56, 0xff, 0x9d, 0x15, 0xff, 0xad, 0x97, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xbd, 0xf9, 0xff, 0x6b, 0xb1, 0xff, 0x53, 0x0e, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x73, 0xd1, 0xeb, 0xde, 0xfc, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x94, 0xd5, 0xff, 0x5b, 0x4f, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x6b, 0x7c, 0x12, 0xe4, 0xce, 0x7a, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0xbe, 0x19, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xa5, 0x77, 0xff, 0x6b, 0xd1, 0xeb, 0x53, 0x0e, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x53, 0x73, 0xd1, 0xeb, 0xce, 0x7a, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0x9b, 0xff, 0xb5, 0xd8, 0xff, 0xb5, 0xb8, 0xff, 0xce, 0x7b, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7b, 0xff, 0xb5, 0xd8, 0xff, 0x73, 0xf2, 0xf8, 0x5b, 0x0e, 0x8f, 0x4a, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x73, 0xd1, 0xeb, 0xde, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xad, 0xb8, 0xff, 0xb5, 0xb8, 0xff, 0xce, 0x7a, 0xff, 0xe7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xce, 0x7b, 0xff, 0xce, 0x7b, 0xff, 0xce, 0x9b, 0xff, 0xce, 0x9b, 0xff, 0xce, 0x9b, 0xff, 0xc6, 0x7a, 0xff, 0xb5, 0xd8, 0xff, 0x9d, 0x16, 0xff, 0x6b, 0xd1, 0xf3, 0x52, 0xee, 0x88, 0x52, 0x6f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x6b, 0x74, 0x12, 0xe4, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x7a, 0xff, 0xb5, 0xb8, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x16, 0xff, 0xa5, 0x77, 0xff, 0xad, 0x77, 0xff, 0xa5, 0x56, 0xff, 0x94, 0xd5, 0xff, 0x7c, 0x32, 0xfb, 0x63, 0x70, 0xd0, 0x53, 0x0e, 0x74, 0x5a, 0xae, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x53, 0x73, 0xd1, 0xeb, 0xc6, 0x5a, 0xff, 0xde, 0xdc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x98, 0xff, 0xad, 0x97, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x1d, 0xff, 0xce, 0x7b, 0xff, 0xb5, 0xd8, 0xff, 0x8c, 0xb4, 0xff, 0x63, 0x70, 0xef, 0x63, 0x70, 0xe0, 0x63, 0x90, 0xfb, 0x63, 0x90, 0xff, 0x63, 0x70, 0xf0, 0x5b, 0x4f, 0xc3, 0x52, 0xee, 0x6c, 0x53, 0x0e, 0x2b, 0x5a, 0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x6b, 0xd1, 0xeb, 0xd6, 0xbb, 0xff, 0xd6, 0xbc, 0xff, 0xc6, 0x3a, 0xff, 0xa5, 0x77, 0xff, 0xad, 0x97, 0xff, 0xc6, 0x3a, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x4f, 0xd4, 0x4b, 0x0e, 0x24, 0x00, 0x00, 0x00, 0x31, 0xad, 0x04, 0x63, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x6b, 0x74, 0x12, 0xe4, 0xc6, 0x3a, 0xff, 0xd6, 0xbc, 0xff, 0xbe, 0x1a, 0xff, 0xad, 0x77, 0xff, 0xad, 0x77, 0xff, 0xc6, 0x39, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0xb8, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x6f, 0xcb, 0x53, 0x0e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x53, 0x73, 0xd1, 0xeb, 0xc6, 0x5a, 0xff, 0xd6, 0xdc, 0xff, 0xc6, 0x3a, 0xff, 0xa5, 0x77, 0xff, 0xa5, 0x57, 0xff, 0xbe, 0x19, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x3a, 0xff, 0xad, 0x98, 0xff, 0x8c, 0x94, 0xff, 0x5b, 0x4f, 0xd4, 0x53, 0x0e, 0x3f, 0x42, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x73, 0xd1, 0xeb, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xa5, 0x57, 0xff, 0xa5, 0x77, 0xff, 0xbe, 0x19, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xa5, 0x77, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x6b, 0x7c, 0x12, 0xe4, 0xce, 0x7a, 0xff, 0xdf, 0x1d, 0xff, 0xce, 0x7b, 0xff, 0xad, 0x77, 0xff, 0xa5, 0x56, 0xff, 0xbd, 0xf9, 0xff, 0xd6, 0xbb, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7b, 0xff, 0xb5, 0xb8, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x4f, 0xcb, 0x52, 0xee, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0c, 0x08, 0x53, 0x0e, 0x2c, 0x53, 0x0e, 0x48, 0x52, 0xee, 0x47, 0x52, 0xee, 0x27, 0x53, 0x0e, 0x58, 0x73, 0xd1, 0xeb, 0xce, 0x7a, 0xff, 0xe7, 0x1d, 0xff, 0xce, 0x9b, 0xff, 0xad, 0x97, 0xff, 0xa5, 0x36, 0xff, 0xbd, 0xf9, 0xff, 0xd6, 0x9b, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xd9, 0xff, 0x8c, 0xb4, 0xff, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x3f, 0x42, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xad, 0x0c, 0x52, 0xee, 0x40, 0x5b, 0x4f, 0x98, 0x73, 0xd1, 0xf3, 0x7c, 0x32, 0xff, 0x84, 0x73, 0xff, 0x84, 0x73, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0xa5, 0x57, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xd8, 0xff, 0xd6, 0xbb, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xbc, 0xff, 0xb5, 0xd8, 0xff, 0x8c, 0x94, 0xfc, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xaf, 0x0f, 0x5b, 0x2f, 0x8b, 0x7c, 0x32, 0xe4, 0xad, 0x97, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0xdc, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xd8, 0xff, 0xce, 0x7b, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0x8c, 0x94, 0xfc, 0x63, 0x70, 0xcb, 0x53, 0x0e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x10, 0x52, 0xee, 0x94, 0x94, 0xd5, 0xf8, 0xde, 0xfc, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x1d, 0xff, 0xb5, 0xd8, 0xff, 0x9d, 0x15, 0xff, 0xb5, 0xb8, 0xff, 0xce, 0x7a, 0xff, 0xdf, 0x1c, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x3a, 0xff, 0x94, 0xf5, 0xff, 0x5b, 0x4f, 0xd4, 0x53, 0x0e, 0x3f, 0x42, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0f, 0x0c, 0x5b, 0x2f, 0x90, 0x94, 0xf5, 0xf8, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0xb5, 0xb8, 0xff, 0xce, 0x7b, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xbe, 0x19, 0xff, 0x8c, 0xb4, 0xfc, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x48, 0x84, 0x53, 0xe8, 0xe7, 0x3d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x94, 0xb4, 0xfc, 0x63, 0x70, 0xcb, 0x53, 0x0e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x70, 0xa8, 0xbd, 0xf8, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0x9b, 0xff, 0xce, 0x9b, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x5e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xbb, 0xff, 0x9d, 0x16, 0xff, 0x63, 0x4f, 0xd4, 0x53, 0x0e, 0x3f, 0x42, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xed, 0x13, 0x7b, 0xf2, 0xfb, 0xef, 0x7e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x3d, 0xff, 0xb5, 0xd8, 0xff, 0x84, 0x73, 0xf4, 0x84, 0x73, 0xf0, 0x94, 0xf5, 0xfc, 0xb5, 0xd8, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5e, 0xff, 0xc6, 0x3a, 0xff, 0x6b, 0xb1, 0xff, 0x52, 0xee, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x44, 0x8c, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xce, 0x7a, 0xff, 0x7c, 0x32, 0xff, 0x52, 0xee, 0x7f, 0x52, 0xee, 0x64, 0x53, 0x0e, 0x8f, 0x6b, 0xd1, 0xe0, 0x94, 0xf5, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x5d, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xd6, 0x9b, 0xff, 0x73, 0xf1, 0xff, 0x53, 0x0e, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x63, 0xa5, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0xff, 0xa5, 0x56, 0xff, 0x63, 0x4f, 0xc7, 0x3a, 0xae, 0x08, 0x00, 0x00, 0x00, 0x4a, 0x6d, 0x0b, 0x53, 0x0e, 0x3f, 0x5b, 0x4f, 0xb0, 0x7c, 0x53, 0xfb, 0xce, 0x9b, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xde, 0xfc, 0xff, 0x84, 0x73, 0xff, 0x52, 0xee, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x64, 0xa5, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbd, 0xf9, 0xff, 0x73, 0xf2, 0xe8, 0x53, 0x0e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xad, 0x0c, 0x53, 0x0e, 0x9b, 0x9d, 0x15, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1c, 0xff, 0x84, 0x73, 0xff, 0x53, 0x0e, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x4c, 0x8c, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0x94, 0xf5, 0xfb, 0x53, 0x2f, 0x98, 0x53, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x63, 0x8c, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xfc, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xee, 0x1b, 0x7c, 0x12, 0xfc, 0xef, 0x7e, 0xff, 0xce, 0x9b, 0xff, 0x63, 0x70, 0xdc, 0x53, 0x0e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xae, 0x13, 0x53, 0x0e, 0xb4, 0xd6, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xce, 0x7a, 0xff, 0x6b, 0xb1, 0xfc, 0x52, 0xee, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x70, 0xac, 0xad, 0xb7, 0xff, 0x8c, 0xb4, 0xff, 0x53, 0x0e, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xad, 0x04, 0x53, 0x0e, 0x70, 0x94, 0xd4, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0xff, 0x9d, 0x36, 0xff, 0x63, 0x4f, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x4b, 0x6b, 0xb1, 0xd8, 0x63, 0x70, 0xcc, 0x4a, 0xce, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x0d, 0x28, 0x6b, 0xd1, 0xcb, 0xde, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xc6, 0x39, 0xff, 0x7c, 0x12, 0xf0, 0x53, 0x0e, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0c, 0x08, 0x52, 0xee, 0x2c, 0x52, 0xee, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x7f, 0xa5, 0x36, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xde, 0xdc, 0xff, 0x94, 0xd4, 0xfc, 0x5b, 0x2f, 0xa4, 0x4a, 0xae, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x27, 0x74, 0x12, 0xf7, 0xe7, 0x3d, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x5d, 0xff, 0xc6, 0x5a, 0xff, 0x94, 0xd5, 0xfc, 0x52, 0xee, 0xaf, 0x53, 0x2e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x4e, 0x07, 0x53, 0x0e, 0x98, 0xa5, 0x77, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7a, 0xff, 0xa5, 0x56, 0xff, 0x7c, 0x32, 0xf4, 0x5b, 0x4f, 0xab, 0x53, 0x0e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xad, 0x0c, 0x53, 0x0e, 0xbf, 0x84, 0x53, 0xff, 0x7c, 0x32, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0x70, 0xc8, 0x53, 0x0f, 0x60, 0x52, 0xce, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x1c, 0x53, 0x0e, 0x6b, 0x53, 0x0e, 0x4f, 0x53, 0x0e, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x05, 0x43, 0x4d, 0x0c, 0x53, 0x0e, 0x5c, 0x53, 0x0e, 0x8b, 0x53, 0x0e, 0xab, 0x53, 0x0e, 0x63, 0x42, 0x08, 0x04, 0xa7, 0x00, 0x00, 0x00, 0x07, 
+  0x52, 0xce, 0x23, 0x5b, 0x2f, 0x80, 0x6b, 0xd1, 0xe8, 0x94, 0xf5, 0xff, 0xc6, 0x39, 0xff, 0xce, 0x9b, 0xff, 0x5b, 0x2f, 0xd7, 0x52, 0xee, 0x2f, 0xa6, 0x00, 0x00, 0x00, 0x08, 0x52, 0xef, 0x28, 
+  0x63, 0x70, 0xbb, 0x9d, 0x36, 0xfb, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbe, 0x19, 0xff, 0x53, 0x0e, 0xa4, 0x53, 0x0f, 0x0c, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x53, 0x0e, 0x23, 
+  0x53, 0x0f, 0xb4, 0xbe, 0x19, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x5a, 0xff, 0x73, 0xf1, 0xfb, 0x53, 0x0e, 0x30, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x5b, 0x2e, 0x13, 
+  0x5b, 0x4f, 0xa3, 0xb5, 0xb7, 0xfc, 0x82, 0xff, 0xdf, 0xff, 0x02, 0xce, 0x9b, 0xff, 0x8c, 0x94, 0xfc, 0x53, 0x2f, 0x8b, 0x85, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x34, 0x53, 0x0e, 0x58, 0x4a, 
+  0xee, 0x1b, 0x9d, 0x00, 0x00, 0x00, 0x08, 0x52, 0xee, 0x4c, 0x84, 0x73, 0xec, 0xef, 0x5d, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x3d, 0xff, 0xad, 0x97, 0xff, 0x63, 0x90, 0xd3, 0x52, 
+  0xee, 0x2f, 0x84, 0x00, 0x00, 0x00, 0x03, 0x4a, 0xee, 0x0f, 0x63, 0x70, 0xd3, 0x7c, 0x32, 0xfc, 0x5b, 0x4f, 0x90, 0x9d, 0x00, 0x00, 0x00, 0x08, 0x63, 0x70, 0xa3, 0xb5, 0xd8, 0xff, 0xf7, 0xbf, 
+  0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xce, 0x9b, 0xff, 0x84, 0x53, 0xf7, 0x53, 0x0e, 0x7b, 0x5a, 0xb0, 0x07, 0x84, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0x6c, 0x94, 0xd4, 0xff, 0xd6, 0x9b, 
+  0xff, 0x6b, 0xd1, 0xec, 0x4a, 0xee, 0x0f, 0x9b, 0x00, 0x00, 0x00, 0x08, 0x33, 0x2d, 0x04, 0x73, 0xf1, 0xf0, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xde, 0xfc, 0xff, 0xad, 0x97, 
+  0xff, 0x53, 0x0e, 0xbf, 0x4b, 0x0d, 0x18, 0x84, 0x00, 0x00, 0x00, 0x05, 0x52, 0xee, 0x34, 0x63, 0x70, 0xd8, 0xe7, 0x5d, 0xff, 0xe7, 0x1d, 0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0x5b, 0x9b, 0x00, 
+  0x00, 0x00, 0x01, 0x53, 0x0e, 0x20, 0x7c, 0x12, 0xff, 0x82, 0xef, 0x7e, 0xff, 0x02, 0xd6, 0xbb, 0xff, 0x94, 0xd4, 0xff, 0x53, 0x0e, 0x90, 0x84, 0x00, 0x00, 0x00, 0x06, 0x53, 0x0f, 0x0c, 0x53, 
+  0x0e, 0x8f, 0xa5, 0x56, 0xf8, 0xf7, 0xbf, 0xff, 0xde, 0xfc, 0xff, 0x94, 0xd5, 0xff, 0x53, 0x0e, 0x84, 0x9b, 0x00, 0x00, 0x00, 0x02, 0x52, 0xee, 0x30, 0x7c, 0x32, 0xff, 0xef, 0x7e, 0xff, 0x81, 
+  0xef, 0x5e, 0xff, 0x03, 0xd6, 0xdc, 0xff, 0xad, 0x97, 0xff, 0x5b, 0x2f, 0xd3, 0x53, 0x0e, 0x3c, 0x83, 0x00, 0x00, 0x00, 0x06, 0x53, 0x0e, 0x3b, 0x7c, 0x12, 0xe4, 0xde, 0xfc, 0xff, 0xf7, 0x9e, 
+  0xff, 0xde, 0xfc, 0xff, 0x9d, 0x36, 0xff, 0x53, 0x0e, 0x97, 0x9b, 0x00, 0x00, 0x00, 0x03, 0x5a, 0xee, 0x20, 0x7c, 0x32, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x5d, 0xff, 0x81, 0xe7, 0x3d, 0xff, 0x04, 
+  0xce, 0x7b, 0xff, 0x9d, 0x16, 0xff, 0x63, 0x90, 0xeb, 0x53, 0x0e, 0x7c, 0x53, 0x0f, 0x23, 0x81, 0x4b, 0x2d, 0x0b, 0x01, 0x63, 0x70, 0xbc, 0xb5, 0xd8, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x02, 0xd6, 
+  0xdb, 0xff, 0x94, 0xf5, 0xff, 0x52, 0xee, 0x8c, 0x9b, 0x00, 0x00, 0x00, 0x02, 0x2a, 0xab, 0x07, 0x73, 0xf1, 0xf7, 0xdf, 0x1c, 0xff, 0x82, 0xe7, 0x3d, 0xff, 0x04, 0xe7, 0x1d, 0xff, 0xc6, 0x5a, 
+  0xff, 0xa5, 0x77, 0xff, 0x7c, 0x53, 0xff, 0x63, 0x70, 0xc7, 0x81, 0x53, 0x0e, 0x94, 0x06, 0x84, 0x73, 0xfc, 0xe7, 0x1d, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x5d, 0xff, 0xce, 0x9b, 0xff, 0x84, 0x53, 
+  0xff, 0x53, 0x0e, 0x68, 0x9b, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0x53, 0x7c, 0x12, 0xfb, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0x81, 0xe7, 0x1d, 0xff, 0x0c, 0xdf, 0x1d, 0xff, 
+  0xd6, 0xbb, 0xff, 0xbd, 0xf9, 0xff, 0xa5, 0x56, 0xff, 0x9d, 0x15, 0xff, 0xad, 0x97, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xbd, 0xf9, 0xff, 0x6b, 0xb1, 
+  0xff, 0x53, 0x0e, 0x2b, 0x99, 0x00, 0x00, 0x00, 0x06, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x73, 0xd1, 0xeb, 0xde, 0xfc, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0x81, 0xde, 
+  0xfc, 0xff, 0x82, 0xdf, 0x1d, 0xff, 0x08, 0xd6, 0xdc, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x94, 0xd5, 0xff, 0x5b, 
+  0x4f, 0xbc, 0x9a, 0x00, 0x00, 0x00, 0x07, 0x53, 0x0e, 0x6b, 0x7c, 0x12, 0xe4, 0xce, 0x7a, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0xbe, 0x19, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xdc, 0xff, 0x85, 
+  0xde, 0xfc, 0xff, 0x82, 0xdf, 0x1d, 0xff, 0x03, 0xd6, 0xbb, 0xff, 0xa5, 0x77, 0xff, 0x6b, 0xd1, 0xeb, 0x53, 0x0e, 0x53, 0x99, 0x00, 0x00, 0x00, 0x07, 0x53, 0x0e, 0x53, 0x73, 0xd1, 0xeb, 0xce, 
+  0x7a, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0x9b, 0xff, 0xb5, 0xd8, 0xff, 0xb5, 0xb8, 0xff, 0xce, 0x7b, 0xff, 0x81, 0xde, 0xfc, 0xff, 0x00, 0xd6, 0xdc, 0xff, 0x81, 0xde, 0xdc, 0xff, 0x83, 0xde, 0xfc, 
+  0xff, 0x04, 0xce, 0x7b, 0xff, 0xb5, 0xd8, 0xff, 0x73, 0xf2, 0xf8, 0x5b, 0x0e, 0x8f, 0x4a, 0xee, 0x0f, 0x97, 0x00, 0x00, 0x00, 0x0b, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x73, 0xd1, 0xeb, 0xde, 
+  0xdc, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xad, 0xb8, 0xff, 0xb5, 0xb8, 0xff, 0xce, 0x7a, 0xff, 0xe7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0x81, 0xce, 0x7b, 0xff, 0x82, 0xce, 
+  0x9b, 0xff, 0x05, 0xc6, 0x7a, 0xff, 0xb5, 0xd8, 0xff, 0x9d, 0x16, 0xff, 0x6b, 0xd1, 0xf3, 0x52, 0xee, 0x88, 0x52, 0x6f, 0x0c, 0x98, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0x6b, 0x74, 0x12, 0xe4, 
+  0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x7a, 0xff, 0x81, 0xb5, 0xb8, 0xff, 0x0e, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0x9d, 0x15, 0xff, 
+  0x9d, 0x16, 0xff, 0xa5, 0x77, 0xff, 0xad, 0x77, 0xff, 0xa5, 0x56, 0xff, 0x94, 0xd5, 0xff, 0x7c, 0x32, 0xfb, 0x63, 0x70, 0xd0, 0x53, 0x0e, 0x74, 0x5a, 0xae, 0x08, 0x98, 0x00, 0x00, 0x00, 0x15, 
+  0x53, 0x0e, 0x53, 0x73, 0xd1, 0xeb, 0xc6, 0x5a, 0xff, 0xde, 0xdc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x98, 0xff, 0xad, 0x97, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x1d, 0xff, 0xce, 0x7b, 
+  0xff, 0xb5, 0xd8, 0xff, 0x8c, 0xb4, 0xff, 0x63, 0x70, 0xef, 0x63, 0x70, 0xe0, 0x63, 0x90, 0xfb, 0x63, 0x90, 0xff, 0x63, 0x70, 0xf0, 0x5b, 0x4f, 0xc3, 0x52, 0xee, 0x6c, 0x53, 0x0e, 0x2b, 0x5a, 
+  0xb0, 0x07, 0x97, 0x00, 0x00, 0x00, 0x08, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x6b, 0xd1, 0xeb, 0xd6, 0xbb, 0xff, 0xd6, 0xbc, 0xff, 0xc6, 0x3a, 0xff, 0xa5, 0x77, 0xff, 0xad, 0x97, 0xff, 0xc6, 
+  0x3a, 0xff, 0x81, 0xde, 0xfc, 0xff, 0x07, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x4f, 0xd4, 0x4b, 0x0e, 0x24, 0x00, 0x00, 0x00, 0x31, 0xad, 0x04, 0x63, 0x0c, 0x08, 0x9c, 
+  0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0x6b, 0x74, 0x12, 0xe4, 0xc6, 0x3a, 0xff, 0xd6, 0xbc, 0xff, 0xbe, 0x1a, 0xff, 0x81, 0xad, 0x77, 0xff, 0x07, 0xc6, 0x39, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xfc, 
+  0xff, 0xc6, 0x5a, 0xff, 0xad, 0xb8, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x6f, 0xcb, 0x53, 0x0e, 0x3f, 0x9f, 0x00, 0x00, 0x00, 0x0f, 0x53, 0x0e, 0x53, 0x73, 0xd1, 0xeb, 0xc6, 0x5a, 0xff, 0xd6, 0xdc, 
+  0xff, 0xc6, 0x3a, 0xff, 0xa5, 0x77, 0xff, 0xa5, 0x57, 0xff, 0xbe, 0x19, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x3a, 0xff, 0xad, 0x98, 0xff, 0x8c, 0x94, 0xff, 0x5b, 0x4f, 0xd4, 0x53, 
+  0x0e, 0x3f, 0x42, 0x08, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x0f, 0x3a, 0xae, 0x08, 0x53, 0x0e, 0x6b, 0x73, 0xd1, 0xeb, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xa5, 0x57, 0xff, 0xa5, 
+  0x77, 0xff, 0xbe, 0x19, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xa5, 0x77, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x24, 0x9f, 0x00, 0x00, 0x00, 0x0e, 0x53, 
+  0x0e, 0x6b, 0x7c, 0x12, 0xe4, 0xce, 0x7a, 0xff, 0xdf, 0x1d, 0xff, 0xce, 0x7b, 0xff, 0xad, 0x77, 0xff, 0xa5, 0x56, 0xff, 0xbd, 0xf9, 0xff, 0xd6, 0xbb, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7b, 0xff, 
+  0xb5, 0xb8, 0xff, 0x84, 0x73, 0xfc, 0x5b, 0x4f, 0xcb, 0x52, 0xee, 0x3f, 0x9a, 0x00, 0x00, 0x00, 0x14, 0x42, 0x0c, 0x08, 0x53, 0x0e, 0x2c, 0x53, 0x0e, 0x48, 0x52, 0xee, 0x47, 0x52, 0xee, 0x27, 
+  0x53, 0x0e, 0x58, 0x73, 0xd1, 0xeb, 0xce, 0x7a, 0xff, 0xe7, 0x1d, 0xff, 0xce, 0x9b, 0xff, 0xad, 0x97, 0xff, 0xa5, 0x36, 0xff, 0xbd, 0xf9, 0xff, 0xd6, 0x9b, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 
+  0xff, 0xb5, 0xd9, 0xff, 0x8c, 0xb4, 0xff, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x3f, 0x42, 0x08, 0x04, 0x97, 0x00, 0x00, 0x00, 0x04, 0x42, 0xad, 0x0c, 0x52, 0xee, 0x40, 0x5b, 0x4f, 0x98, 0x73, 0xd1, 
+  0xf3, 0x7c, 0x32, 0xff, 0x81, 0x84, 0x73, 0xff, 0x81, 0x7c, 0x32, 0xff, 0x0c, 0xde, 0xfc, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0xa5, 0x57, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xd8, 0xff, 0xd6, 
+  0xbb, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xbc, 0xff, 0xb5, 0xd8, 0xff, 0x8c, 0x94, 0xfc, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x24, 0x98, 0x00, 0x00, 0x00, 0x05, 0x5a, 0xaf, 0x0f, 0x5b, 0x2f, 0x8b, 0x7c, 
+  0x32, 0xe4, 0xad, 0x97, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x82, 0xef, 0x5d, 0xff, 0x0a, 0xd6, 0xdc, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xd8, 0xff, 
+  0xce, 0x7b, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0x8c, 0x94, 0xfc, 0x63, 0x70, 0xcb, 0x53, 0x0e, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x10, 0x52, 0xee, 0x94, 
+  0x94, 0xd5, 0xf8, 0xde, 0xfc, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x00, 0xef, 0x5e, 0xff, 0x83, 0xe7, 0x5d, 0xff, 0x0b, 0xe7, 0x1d, 0xff, 0xb5, 0xd8, 0xff, 0x9d, 0x15, 0xff, 0xb5, 0xb8, 0xff, 0xce, 
+  0x7a, 0xff, 0xdf, 0x1c, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x3a, 0xff, 0x94, 0xf5, 0xff, 0x5b, 0x4f, 0xd4, 0x53, 0x0e, 0x3f, 0x42, 0x08, 0x04, 0x97, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0f, 0x0c, 0x5b, 
+  0x2f, 0x90, 0x94, 0xf5, 0xf8, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0x82, 0xef, 0x7e, 0xff, 0x83, 0xef, 0x5e, 0xff, 0x03, 0xe7, 0x3d, 0xff, 0xbe, 0x19, 0xff, 0xb5, 0xb8, 0xff, 0xce, 0x7b, 0xff, 
+  0x81, 0xe7, 0x1d, 0xff, 0x03, 0xbe, 0x19, 0xff, 0x8c, 0xb4, 0xfc, 0x5b, 0x4f, 0xd4, 0x52, 0xee, 0x24, 0x99, 0x00, 0x00, 0x00, 0x03, 0x52, 0xee, 0x48, 0x84, 0x53, 0xe8, 0xe7, 0x3d, 0xff, 0xf7, 
+  0xbf, 0xff, 0x83, 0xf7, 0x9e, 0xff, 0x84, 0xef, 0x7e, 0xff, 0x07, 0xde, 0xfc, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0x94, 0xb4, 0xfc, 0x63, 0x70, 0xcb, 
+  0x53, 0x0e, 0x3f, 0x9a, 0x00, 0x00, 0x00, 0x02, 0x63, 0x70, 0xa8, 0xbd, 0xf8, 0xff, 0xff, 0xbf, 0xff, 0x81, 0xf7, 0xbf, 0xff, 0x04, 0xe7, 0x3d, 0xff, 0xd6, 0x9b, 0xff, 0xce, 0x9b, 0xff, 0xde, 
+  0xdc, 0xff, 0xef, 0x5e, 0xff, 0x82, 0xf7, 0x9e, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x05, 0xef, 0x5e, 0xff, 0xd6, 0xbb, 0xff, 0x9d, 0x16, 0xff, 0x63, 0x4f, 0xd4, 0x53, 0x0e, 0x3f, 0x42, 0x08, 0x04, 
+  0x99, 0x00, 0x00, 0x00, 0x02, 0x52, 0xed, 0x13, 0x7b, 0xf2, 0xfb, 0xef, 0x7e, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x07, 0xe7, 0x3d, 0xff, 0xb5, 0xd8, 0xff, 0x84, 0x73, 0xf4, 0x84, 0x73, 0xf0, 0x94, 
+  0xf5, 0xfc, 0xb5, 0xd8, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x5e, 0xff, 0x81, 0xf7, 0xbf, 0xff, 0x04, 0xf7, 0x9e, 0xff, 0xef, 0x5e, 0xff, 0xc6, 0x3a, 0xff, 0x6b, 0xb1, 0xff, 0x52, 0xee, 0x30, 0x9b, 
+  0x00, 0x00, 0x00, 0x01, 0x52, 0xee, 0x44, 0x8c, 0x94, 0xff, 0x81, 0xff, 0xff, 0xff, 0x09, 0xf7, 0xbf, 0xff, 0xce, 0x7a, 0xff, 0x7c, 0x32, 0xff, 0x52, 0xee, 0x7f, 0x52, 0xee, 0x64, 0x53, 0x0e, 
+  0x8f, 0x6b, 0xd1, 0xe0, 0x94, 0xf5, 0xff, 0xc6, 0x5a, 0xff, 0xef, 0x5d, 0xff, 0x81, 0xff, 0xbf, 0xff, 0x03, 0xf7, 0x9e, 0xff, 0xd6, 0x9b, 0xff, 0x73, 0xf1, 0xff, 0x53, 0x0e, 0x38, 0x9b, 0x00, 
+  0x00, 0x00, 0x01, 0x53, 0x0e, 0x63, 0xa5, 0x36, 0xff, 0x81, 0xff, 0xff, 0xff, 0x0f, 0xe7, 0x3d, 0xff, 0xa5, 0x56, 0xff, 0x63, 0x4f, 0xc7, 0x3a, 0xae, 0x08, 0x00, 0x00, 0x00, 0x4a, 0x6d, 0x0b, 
+  0x53, 0x0e, 0x3f, 0x5b, 0x4f, 0xb0, 0x7c, 0x53, 0xfb, 0xce, 0x9b, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xde, 0xfc, 0xff, 0x84, 0x73, 0xff, 0x52, 0xee, 0x5c, 0x9b, 0x00, 
+  0x00, 0x00, 0x06, 0x52, 0xee, 0x64, 0xa5, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbd, 0xf9, 0xff, 0x73, 0xf2, 0xe8, 0x53, 0x0e, 0x43, 0x83, 0x00, 0x00, 0x00, 0x03, 0x42, 0xad, 0x0c, 
+  0x53, 0x0e, 0x9b, 0x9d, 0x15, 0xff, 0xf7, 0x9e, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xdf, 0x1c, 0xff, 0x84, 0x73, 0xff, 0x53, 0x0e, 0x60, 0x9b, 0x00, 0x00, 0x00, 0x06, 0x52, 0xee, 0x4c, 0x8c, 
+  0xb4, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0x94, 0xf5, 0xfb, 0x53, 0x2f, 0x98, 0x53, 0x0e, 0x10, 0x84, 0x00, 0x00, 0x00, 0x01, 0x52, 0xee, 0x63, 0x8c, 0xb4, 0xff, 0x81, 0xff, 0xff, 0xff, 
+  0x03, 0xff, 0xdf, 0xff, 0xde, 0xfc, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0x48, 0x9b, 0x00, 0x00, 0x00, 0x05, 0x4a, 0xee, 0x1b, 0x7c, 0x12, 0xfc, 0xef, 0x7e, 0xff, 0xce, 0x9b, 0xff, 0x63, 0x70, 
+  0xdc, 0x53, 0x0e, 0x3f, 0x84, 0x00, 0x00, 0x00, 0x02, 0x4a, 0xae, 0x13, 0x53, 0x0e, 0xb4, 0xd6, 0x9b, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xff, 0xbf, 0xff, 0xce, 0x7a, 0xff, 0x6b, 0xb1, 0xfc, 
+  0x52, 0xee, 0x18, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x63, 0x70, 0xac, 0xad, 0xb7, 0xff, 0x8c, 0xb4, 0xff, 0x53, 0x0e, 0x78, 0x84, 0x00, 0x00, 0x00, 0x02, 0x31, 0xad, 0x04, 0x53, 0x0e, 0x70, 0x94, 
+  0xd4, 0xf3, 0x82, 0xff, 0xff, 0xff, 0x02, 0xe7, 0x3d, 0xff, 0x9d, 0x36, 0xff, 0x63, 0x4f, 0xb8, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x4b, 0x6b, 0xb1, 0xd8, 0x63, 0x70, 0xcc, 0x4a, 0xce, 
+  0x14, 0x84, 0x00, 0x00, 0x00, 0x02, 0x4b, 0x0d, 0x28, 0x6b, 0xd1, 0xcb, 0xde, 0xdc, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xf7, 0xbf, 0xff, 0xc6, 0x39, 0xff, 0x7c, 0x12, 0xf0, 0x53, 0x0e, 0x58, 
+  0x9d, 0x00, 0x00, 0x00, 0x02, 0x43, 0x0c, 0x08, 0x52, 0xee, 0x2c, 0x52, 0xee, 0x27, 0x85, 0x00, 0x00, 0x00, 0x08, 0x53, 0x0e, 0x7f, 0xa5, 0x36, 0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xbf, 0xff, 0xde, 0xdc, 0xff, 0x94, 0xd4, 0xfc, 0x5b, 0x2f, 0xa4, 0x4a, 0xae, 0x14, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x52, 0xee, 0x27, 0x74, 0x12, 0xf7, 0xe7, 0x3d, 0xff, 0xff, 0xbf, 0xff, 0xef, 
+  0x5d, 0xff, 0xc6, 0x5a, 0xff, 0x94, 0xd5, 0xfc, 0x52, 0xee, 0xaf, 0x53, 0x2e, 0x1f, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x4a, 0x4e, 0x07, 0x53, 0x0e, 0x98, 0xa5, 0x77, 0xff, 0xde, 0xfc, 0xff, 0xce, 
+  0x7a, 0xff, 0xa5, 0x56, 0xff, 0x7c, 0x32, 0xf4, 0x5b, 0x4f, 0xab, 0x53, 0x0e, 0x20, 0xa6, 0x00, 0x00, 0x00, 0x07, 0x5a, 0xad, 0x0c, 0x53, 0x0e, 0xbf, 0x84, 0x53, 0xff, 0x7c, 0x32, 0xff, 0x6b, 
+  0xd1, 0xff, 0x63, 0x70, 0xc8, 0x53, 0x0f, 0x60, 0x52, 0xce, 0x17, 0xa8, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x1c, 0x53, 0x0e, 0x6b, 0x53, 0x0e, 0x4f, 0x53, 0x0e, 0x28, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x6a, 0x40, 0x0c, 0x72, 0x61, 0x50, 0x5c, 0x72, 0x5f, 0x51, 0x8b, 0x72, 0x60, 0x52, 0xab, 0x71, 0x5f, 0x52, 0x63, 0x40, 0x40, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x5a, 0x52, 0x23, 0x78, 0x66, 0x5a, 0x80, 0x8a, 0x78, 0x6c, 0xe8, 0xa8, 0x9c, 0x93, 0xff, 0xca, 0xc3, 0xbe, 0xff, 0xd6, 0xd0, 0xcc, 0xff, 0x76, 0x64, 0x56, 0xd7, 0x72, 0x5c, 0x51, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x5d, 0x51, 0x28, 0x80, 0x6e, 0x62, 0xbb, 0xae, 0xa4, 0x9c, 0xfb, 0xe2, 0xdd, 0xda, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xc8, 0xc0, 0xbb, 0xff, 0x72, 0x60, 0x52, 0xa4, 0x76, 0x62, 0x4e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x52, 0x23, 0x75, 0x61, 0x53, 0xb4, 0xc8, 0xc0, 0xba, 0xff, 0xf5, 0xf3, 0xf2, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xf4, 0xf2, 0xf1, 0xff, 0xcf, 0xc9, 0xc4, 0xff, 0x8b, 0x7c, 0x6f, 0xfb, 0x70, 0x60, 0x50, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x63, 0x55, 0x13, 0x79, 0x68, 0x5a, 0xa3, 0xbc, 0xb4, 0xad, 0xfc, 0xfb, 0xfa, 0xf9, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xd6, 0xd1, 0xcc, 0xff, 0x9d, 0x91, 0x86, 0xfc, 0x75, 0x63, 0x54, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x34, 0x73, 0x5f, 0x50, 0x58, 0x71, 0x5e, 0x4c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5e, 0x51, 0x4c, 0x9c, 0x8e, 0x84, 0xec, 0xeb, 0xe8, 0xe6, 0xff, 0xf7, 0xf5, 0xf5, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xea, 0xe6, 0xe4, 0xff, 0xba, 0xb0, 0xa9, 0xff, 0x82, 0x71, 0x64, 0xd3, 0x6f, 0x5e, 0x4e, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x5b, 0x49, 0x0f, 0x80, 0x6e, 0x61, 0xd3, 0x92, 0x83, 0x78, 0xfc, 0x7a, 0x67, 0x5a, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x6b, 0x5e, 0xa3, 0xc2, 0xba, 0xb3, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xd6, 0xd0, 0xcb, 0xff, 0x96, 0x88, 0x7d, 0xf7, 0x72, 0x5f, 0x53, 0x7b, 0x7f, 0x55, 0x55, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x61, 0x53, 0x6c, 0xa4, 0x98, 0x8e, 0xff, 0xd7, 0xd1, 0xcd, 0xff, 0x86, 0x77, 0x6b, 0xec, 0x6d, 0x5b, 0x49, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x33, 0x04, 0x8b, 0x7c, 0x6f, 0xf0, 0xe4, 0xe0, 0xdd, 0xff, 0xf2, 0xf0, 0xee, 0xff, 0xf2, 0xef, 0xec, 0xff, 0xe1, 0xdb, 0xd8, 0xff, 0xb8, 0xaf, 0xa8, 0xff, 0x73, 0x61, 0x52, 0xbf, 0x6a, 0x60, 0x4a, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5b, 0x52, 0x34, 0x7f, 0x6d, 0x60, 0xd8, 0xea, 0xe7, 0xe4, 0xff, 0xe6, 0xe2, 0xe0, 0xff, 0x96, 0x87, 0x7d, 0xff, 0x71, 0x5e, 0x4f, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x50, 0x20, 0x91, 0x82, 0x76, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xda, 0xd4, 0xcf, 0xff, 0xa4, 0x97, 0x8d, 0xff, 0x72, 0x5f, 0x51, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x62, 0x4e, 0x0c, 0x74, 0x62, 0x52, 0x8f, 0xb4, 0xaa, 0xa2, 0xf8, 0xf6, 0xf4, 0xf3, 0xff, 0xe0, 0xdb, 0xd8, 0xff, 0xa6, 0x9a, 0x91, 0xff, 0x72, 0x5f, 0x51, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5e, 0x4e, 0x30, 0x93, 0x84, 0x78, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xde, 0xd8, 0xd4, 0xff, 0xba, 0xb1, 0xa9, 0xff, 0x76, 0x64, 0x55, 0xd3, 0x73, 0x62, 0x51, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x61, 0x54, 0x3b, 0x90, 0x81, 0x75, 0xe4, 0xdf, 0xdb, 0xd7, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xe0, 0xdb, 0xd7, 0xff, 0xae, 0xa3, 0x9a, 0xff, 0x74, 0x5f, 0x50, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5d, 0x55, 0x20, 0x92, 0x83, 0x76, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xea, 0xe6, 0xe3, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xd5, 0xcd, 0xc8, 0xff, 0xae, 0xa1, 0x99, 0xff, 0x82, 0x70, 0x64, 0xeb, 0x74, 0x62, 0x54, 0x7c, 0x75, 0x5f, 0x50, 0x23, 0x66, 0x66, 0x4c, 0x0b, 0x66, 0x66, 0x4c, 0x0b, 0x7d, 0x6b, 0x5e, 0xbc, 0xc1, 0xb7, 0xb1, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xdc, 0xd7, 0xd2, 0xff, 0xa8, 0x9c, 0x93, 0xff, 0x71, 0x5d, 0x50, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x2a, 0x07, 0x8c, 0x7d, 0x72, 0xf7, 0xe3, 0xdf, 0xdb, 0xff, 0xea, 0xe5, 0xe2, 0xff, 0xe8, 0xe3, 0xe0, 0xff, 0xe9, 0xe4, 0xe0, 0xff, 0xe6, 0xe1, 0xde, 0xff, 0xd1, 0xca, 0xc4, 0xff, 0xb6, 0xab, 0xa3, 0xff, 0x97, 0x88, 0x7c, 0xff, 0x7f, 0x6d, 0x60, 0xc7, 0x73, 0x60, 0x53, 0x94, 0x73, 0x60, 0x50, 0x94, 0x9b, 0x8e, 0x83, 0xfc, 0xe6, 0xe1, 0xde, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xd6, 0xcf, 0xca, 0xff, 0x97, 0x88, 0x7e, 0xff, 0x71, 0x60, 0x51, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x50, 0x53, 0x90, 0x80, 0x75, 0xfb, 0xe6, 0xe1, 0xde, 0xff, 0xe9, 0xe3, 0xdf, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe7, 0xe2, 0xdd, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xdb, 0xd4, 0xcf, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xb2, 0xa7, 0x9e, 0xff, 0xab, 0x9f, 0x96, 0xff, 0xba, 0xaf, 0xa8, 0xff, 0xdf, 0xda, 0xd5, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xe5, 0xe0, 0xdc, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0x86, 0x76, 0x69, 0xff, 0x71, 0x5f, 0x53, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x8a, 0x7a, 0x6e, 0xeb, 0xe2, 0xdd, 0xd9, 0xff, 0xea, 0xe5, 0xe1, 0xff, 0xe1, 0xdb, 0xd6, 0xff, 0xdf, 0xd9, 0xd4, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xdf, 0xd7, 0xd2, 0xff, 0xda, 0xd4, 0xce, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xe9, 0xe3, 0xe0, 0xff, 0xe8, 0xe2, 0xde, 0xff, 0xe8, 0xe3, 0xde, 0xff, 0xd3, 0xcb, 0xc6, 0xff, 0xa5, 0x98, 0x8e, 0xff, 0x7b, 0x69, 0x5c, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x6b, 0x91, 0x82, 0x77, 0xe4, 0xd4, 0xcd, 0xc8, 0xff, 0xe9, 0xe3, 0xdf, 0xff, 0xdc, 0xd4, 0xcf, 0xff, 0xc9, 0xc0, 0xb9, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0xde, 0xd7, 0xd2, 0xff, 0xe2, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xe4, 0xdd, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xda, 0xd4, 0xce, 0xff, 0xb7, 0xac, 0xa4, 0xff, 0x88, 0x77, 0x6b, 0xeb, 0x73, 0x60, 0x51, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x50, 0x53, 0x8a, 0x7a, 0x6e, 0xeb, 0xd3, 0xcc, 0xc6, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xda, 0xd2, 0xcd, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0xc0, 0xb6, 0xaf, 0xff, 0xd5, 0xce, 0xc9, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xe1, 0xdb, 0xd6, 0xff, 0xe0, 0xd9, 0xd4, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xe2, 0xdc, 0xd7, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xd6, 0xce, 0xc8, 0xff, 0xc2, 0xb9, 0xb1, 0xff, 0x8d, 0x7d, 0x71, 0xf8, 0x74, 0x62, 0x56, 0x8f, 0x6d, 0x5b, 0x49, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x89, 0x7a, 0x6d, 0xeb, 0xdf, 0xd9, 0xd5, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xd8, 0xcf, 0xc9, 0xff, 0xbe, 0xb4, 0xac, 0xff, 0xbf, 0xb6, 0xaf, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0xe6, 0xe1, 0xdd, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xdb, 0xd3, 0xce, 0xff, 0xd6, 0xcd, 0xc7, 0xff, 0xd7, 0xce, 0xc8, 0xff, 0xd9, 0xd1, 0xcb, 0xff, 0xda, 0xd1, 0xcc, 0xff, 0xd8, 0xd1, 0xcb, 0xff, 0xd4, 0xcc, 0xc4, 0xff, 0xc3, 0xb9, 0xb1, 0xff, 0xad, 0xa1, 0x96, 0xff, 0x87, 0x78, 0x6c, 0xf3, 0x70, 0x5d, 0x4e, 0x88, 0x76, 0x4e, 0x4e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x6b, 0x8f, 0x81, 0x74, 0xe4, 0xd1, 0xc9, 0xc4, 0xff, 0xe2, 0xdc, 0xd6, 0xff, 0xd4, 0xcb, 0xc4, 0xff, 0xbf, 0xb5, 0xad, 0xff, 0xbe, 0xb4, 0xad, 0xff, 0xd1, 0xca, 0xc4, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xd8, 0xd1, 0xca, 0xff, 0xc6, 0xbc, 0xb4, 0xff, 0xac, 0x9f, 0x95, 0xff, 0xae, 0xa2, 0x98, 0xff, 0xb8, 0xac, 0xa3, 0xff, 0xba, 0xae, 0xa6, 0xff, 0xb3, 0xa7, 0x9e, 0xff, 0xa6, 0x98, 0x8e, 0xff, 0x92, 0x83, 0x77, 0xfb, 0x80, 0x6e, 0x60, 0xd0, 0x72, 0x61, 0x51, 0x74, 0x71, 0x55, 0x55, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x50, 0x53, 0x89, 0x79, 0x6d, 0xeb, 0xd0, 0xc8, 0xc2, 0xff, 0xe0, 0xda, 0xd5, 0xff, 0xd3, 0xc9, 0xc2, 0xff, 0xbd, 0xb2, 0xaa, 0xff, 0xba, 0xb0, 0xa9, 0xff, 0xd0, 0xc8, 0xc2, 0xff, 0xe2, 0xdd, 0xd9, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xd7, 0xce, 0xc7, 0xff, 0xc3, 0xb8, 0xb0, 0xff, 0xa4, 0x95, 0x8b, 0xff, 0x7d, 0x6c, 0x5d, 0xef, 0x7f, 0x6d, 0x5f, 0xe0, 0x81, 0x70, 0x63, 0xfb, 0x82, 0x6f, 0x62, 0xff, 0x7f, 0x6d, 0x60, 0xf0, 0x7c, 0x6a, 0x5c, 0xc3, 0x74, 0x5e, 0x53, 0x6c, 0x71, 0x5f, 0x4d, 0x2b, 0x7f, 0x55, 0x55, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x89, 0x78, 0x6c, 0xeb, 0xdb, 0xd4, 0xcf, 0xff, 0xde, 0xd6, 0xd1, 0xff, 0xd0, 0xc6, 0xbe, 0xff, 0xb8, 0xac, 0xa4, 0xff, 0xba, 0xb0, 0xa9, 0xff, 0xcd, 0xc5, 0xc0, 0xff, 0xe2, 0xde, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xd4, 0xca, 0xc4, 0xff, 0xbb, 0xb0, 0xa6, 0xff, 0x9c, 0x8d, 0x81, 0xfc, 0x7a, 0x68, 0x59, 0xd4, 0x6e, 0x60, 0x4c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x66, 0x33, 0x33, 0x04, 0x60, 0x60, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x6b, 0x8f, 0x7f, 0x74, 0xe4, 0xcf, 0xc6, 0xc0, 0xff, 0xdd, 0xd5, 0xd0, 0xff, 0xcd, 0xc2, 0xbb, 0xff, 0xb9, 0xad, 0xa5, 0xff, 0xb9, 0xae, 0xa7, 0xff, 0xcc, 0xc4, 0xbe, 0xff, 0xdf, 0xd9, 0xd5, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xd2, 0xc8, 0xc1, 0xff, 0xbf, 0xb3, 0xa9, 0xff, 0x9b, 0x8c, 0x80, 0xfc, 0x7c, 0x6b, 0x5c, 0xcb, 0x71, 0x61, 0x51, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x50, 0x53, 0x89, 0x79, 0x6d, 0xeb, 0xd0, 0xc8, 0xc2, 0xff, 0xdf, 0xd8, 0xd3, 0xff, 0xd0, 0xc6, 0xbe, 0xff, 0xb8, 0xad, 0xa4, 0xff, 0xb5, 0xaa, 0xa3, 0xff, 0xca, 0xc2, 0xbc, 0xff, 0xdd, 0xd7, 0xd3, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xd0, 0xc6, 0xbf, 0xff, 0xbd, 0xb0, 0xa7, 0xff, 0xa0, 0x91, 0x85, 0xff, 0x7a, 0x67, 0x57, 0xd4, 0x71, 0x61, 0x51, 0x3f, 0x40, 0x40, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x89, 0x7a, 0x6d, 0xeb, 0xde, 0xd8, 0xd3, 0xff, 0xe2, 0xdc, 0xd6, 0xff, 0xd3, 0xca, 0xc3, 0xff, 0xb6, 0xaa, 0xa1, 0xff, 0xb5, 0xab, 0xa3, 0xff, 0xc8, 0xc0, 0xb9, 0xff, 0xde, 0xd8, 0xd4, 0xff, 0xe2, 0xdc, 0xd7, 0xff, 0xd3, 0xca, 0xc2, 0xff, 0xba, 0xad, 0xa4, 0xff, 0x9b, 0x8b, 0x7f, 0xfc, 0x7a, 0x67, 0x57, 0xd4, 0x71, 0x5c, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x6b, 0x90, 0x82, 0x75, 0xe4, 0xd3, 0xcb, 0xc6, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xd5, 0xcc, 0xc5, 0xff, 0xb9, 0xae, 0xa5, 0xff, 0xb3, 0xa9, 0xa0, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xda, 0xd3, 0xce, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xd6, 0xcd, 0xc7, 0xff, 0xc2, 0xb6, 0xae, 0xff, 0x9c, 0x8d, 0x81, 0xfc, 0x7c, 0x6a, 0x5c, 0xcb, 0x71, 0x5d, 0x51, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0x40, 0x08, 0x71, 0x60, 0x4f, 0x2c, 0x71, 0x60, 0x51, 0x48, 0x73, 0x5d, 0x53, 0x47, 0x6f, 0x5c, 0x4e, 0x27, 0x73, 0x5f, 0x50, 0x58, 0x8a, 0x7a, 0x6e, 0xeb, 0xd4, 0xcd, 0xc7, 0xff, 0xe7, 0xe1, 0xde, 0xff, 0xd9, 0xd1, 0xcb, 0xff, 0xba, 0xaf, 0xa7, 0xff, 0xb1, 0xa5, 0x9d, 0xff, 0xc5, 0xbc, 0xb6, 0xff, 0xd8, 0xd1, 0xcd, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xd9, 0xd1, 0xcb, 0xff, 0xc5, 0xb9, 0xb2, 0xff, 0xa3, 0x95, 0x8a, 0xff, 0x7a, 0x68, 0x59, 0xd4, 0x71, 0x5d, 0x51, 0x3f, 0x40, 0x40, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x55, 0x40, 0x0c, 0x70, 0x5c, 0x50, 0x40, 0x7a, 0x68, 0x5b, 0x98, 0x8b, 0x7a, 0x6f, 0xf3, 0x92, 0x83, 0x77, 0xff, 0x9a, 0x8c, 0x82, 0xff, 0x9a, 0x8c, 0x81, 0xff, 0x92, 0x83, 0x77, 0xff, 0x94, 0x84, 0x78, 0xff, 0xe2, 0xdd, 0xda, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xdc, 0xd5, 0xd0, 0xff, 0xb5, 0xaa, 0xa1, 0xff, 0xb0, 0xa5, 0x9c, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0xd9, 0xd3, 0xce, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xdd, 0xd5, 0xd0, 0xff, 0xc2, 0xb7, 0xaf, 0xff, 0x9e, 0x90, 0x85, 0xfc, 0x7a, 0x68, 0x59, 0xd4, 0x71, 0x5c, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x55, 0x55, 0x0f, 0x75, 0x65, 0x56, 0x8b, 0x93, 0x84, 0x79, 0xe4, 0xbb, 0xb0, 0xa9, 0xff, 0xe1, 0xdc, 0xd8, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xec, 0xe9, 0xe6, 0xff, 0xeb, 0xe7, 0xe5, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xdd, 0xd7, 0xd2, 0xff, 0xba, 0xb0, 0xa8, 0xff, 0xae, 0xa3, 0x9a, 0xff, 0xc1, 0xb8, 0xb1, 0xff, 0xd5, 0xcd, 0xc8, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xdf, 0xd8, 0xd3, 0xff, 0xca, 0xc1, 0xba, 0xff, 0x9f, 0x91, 0x86, 0xfc, 0x7d, 0x6b, 0x5d, 0xcb, 0x73, 0x5f, 0x52, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x50, 0x10, 0x73, 0x5e, 0x4f, 0x94, 0xa7, 0x9a, 0x90, 0xf8, 0xe2, 0xdd, 0xda, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xee, 0xeb, 0xe8, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xc4, 0xba, 0xb4, 0xff, 0xac, 0xa0, 0x97, 0xff, 0xc0, 0xb6, 0xaf, 0xff, 0xd2, 0xcc, 0xc6, 0xff, 0xe4, 0xdf, 0xdb, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xcd, 0xc4, 0xbe, 0xff, 0xa8, 0x9b, 0x92, 0xff, 0x7a, 0x68, 0x59, 0xd4, 0x73, 0x5f, 0x52, 0x3f, 0x40, 0x40, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x62, 0x4e, 0x0c, 0x78, 0x63, 0x57, 0x90, 0xa8, 0x9c, 0x93, 0xf8, 0xf6, 0xf4, 0xf3, 0xff, 0xf2, 0xf0, 0xee, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xe8, 0xe3, 0xe0, 0xff, 0xc8, 0xc0, 0xb9, 0xff, 0xbe, 0xb5, 0xae, 0xff, 0xd5, 0xce, 0xc8, 0xff, 0xe5, 0xe1, 0xdd, 0xff, 0xe6, 0xe0, 0xdd, 0xff, 0xca, 0xc1, 0xba, 0xff, 0xa3, 0x95, 0x8b, 0xfc, 0x7b, 0x67, 0x5b, 0xd4, 0x71, 0x5c, 0x4e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x5e, 0x50, 0x48, 0x97, 0x88, 0x7e, 0xe8, 0xe6, 0xe3, 0xe0, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xf3, 0xf1, 0xef, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xe3, 0xde, 0xdb, 0xff, 0xda, 0xd4, 0xcf, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xd3, 0xcb, 0xc6, 0xff, 0xa4, 0x96, 0x8d, 0xfc, 0x7e, 0x6b, 0x60, 0xcb, 0x73, 0x5f, 0x52, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x6d, 0x61, 0xa8, 0xc3, 0xbb, 0xb6, 0xff, 0xf8, 0xf6, 0xf6, 0xff, 0xf7, 0xf5, 0xf3, 0xff, 0xf5, 0xf3, 0xf2, 0xff, 0xe7, 0xe3, 0xdf, 0xff, 0xd7, 0xd1, 0xcd, 0xff, 0xd7, 0xd1, 0xcc, 0xff, 0xde, 0xd9, 0xd5, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xd9, 0xd3, 0xce, 0xff, 0xae, 0xa2, 0x99, 0xff, 0x7b, 0x67, 0x5d, 0xd4, 0x73, 0x5f, 0x52, 0x3f, 0x40, 0x40, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x5e, 0x51, 0x13, 0x8f, 0x7e, 0x75, 0xfb, 0xee, 0xec, 0xeb, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xe7, 0xe3, 0xe1, 0xff, 0xc2, 0xba, 0xb4, 0xff, 0x9b, 0x8d, 0x82, 0xf4, 0x98, 0x8b, 0x80, 0xf0, 0xa9, 0x9e, 0x94, 0xfc, 0xc1, 0xb8, 0xb1, 0xff, 0xd9, 0xd4, 0xcf, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xf5, 0xf3, 0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xcd, 0xc5, 0xbf, 0xff, 0x86, 0x75, 0x68, 0xff, 0x72, 0x5e, 0x53, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x5e, 0x4f, 0x44, 0x9d, 0x90, 0x86, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf5, 0xf4, 0xf3, 0xff, 0xd3, 0xcd, 0xc9, 0xff, 0x93, 0x84, 0x79, 0xff, 0x72, 0x5e, 0x52, 0x7f, 0x73, 0x5e, 0x4f, 0x64, 0x72, 0x5f, 0x50, 0x8f, 0x87, 0x77, 0x6c, 0xe0, 0xa7, 0x9b, 0x92, 0xff, 0xcd, 0xc7, 0xc2, 0xff, 0xec, 0xe9, 0xe7, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xf2, 0xf0, 0xef, 0xff, 0xd7, 0xd2, 0xce, 0xff, 0x8c, 0x7d, 0x71, 0xff, 0x72, 0x60, 0x52, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x60, 0x51, 0x63, 0xb0, 0xa6, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe4, 0xe2, 0xff, 0xb1, 0xa7, 0x9f, 0xff, 0x7b, 0x6a, 0x5e, 0xc7, 0x71, 0x55, 0x39, 0x08, 0x00, 0x00, 0x00, 0x00, 0x66, 0x4c, 0x4c, 0x0b, 0x73, 0x5f, 0x52, 0x3f, 0x79, 0x69, 0x5c, 0xb0, 0x95, 0x88, 0x7c, 0xfb, 0xd6, 0xd0, 0xcc, 0xff, 0xf1, 0xee, 0xed, 0xff, 0xfa, 0xf9, 0xf9, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xdf, 0xdb, 0xd7, 0xff, 0x99, 0x8b, 0x80, 0xff, 0x72, 0x5e, 0x50, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5e, 0x52, 0x64, 0xb3, 0xa9, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf6, 0xff, 0xc6, 0xbe, 0xb9, 0xff, 0x8d, 0x7d, 0x71, 0xe8, 0x74, 0x61, 0x51, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x55, 0x40, 0x0c, 0x72, 0x5f, 0x51, 0x9b, 0xab, 0xa0, 0x97, 0xff, 0xf1, 0xef, 0xed, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfb, 0xfb, 0xfa, 0xff, 0xe3, 0xdf, 0xdc, 0xff, 0x9b, 0x8d, 0x83, 0xff, 0x72, 0x60, 0x52, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5e, 0x51, 0x4c, 0xa0, 0x94, 0x8a, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xe3, 0xe0, 0xdd, 0xff, 0xa8, 0x9b, 0x93, 0xfb, 0x75, 0x63, 0x54, 0x98, 0x70, 0x60, 0x50, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5e, 0x51, 0x63, 0xa2, 0x95, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xe0, 0xdb, 0xd8, 0xff, 0x90, 0x81, 0x76, 0xff, 0x71, 0x60, 0x51, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x5e, 0x4c, 0x1b, 0x91, 0x82, 0x75, 0xfc, 0xef, 0xec, 0xeb, 0xff, 0xd5, 0xcf, 0xca, 0xff, 0x7f, 0x6c, 0x60, 0xdc, 0x73, 0x5f, 0x4e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x47, 0x13, 0x74, 0x60, 0x52, 0xb4, 0xd7, 0xd2, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0x86, 0x75, 0x69, 0xfc, 0x70, 0x5c, 0x52, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x6d, 0x63, 0xac, 0xbc, 0xb3, 0xac, 0xff, 0xa0, 0x94, 0x8a, 0xff, 0x72, 0x61, 0x52, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x33, 0x33, 0x04, 0x71, 0x5f, 0x51, 0x70, 0xa4, 0x99, 0x8f, 0xf3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe5, 0xe3, 0xff, 0xaf, 0xa4, 0x9c, 0xff, 0x7c, 0x6a, 0x5e, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x60, 0x53, 0x4b, 0x86, 0x76, 0x6a, 0xd8, 0x7d, 0x6b, 0x5e, 0xcc, 0x73, 0x59, 0x4c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x60, 0x4c, 0x28, 0x87, 0x78, 0x6b, 0xcb, 0xdd, 0xd9, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf6, 0xf4, 0xff, 0xcc, 0xc6, 0xc0, 0xff, 0x91, 0x82, 0x77, 0xf0, 0x74, 0x60, 0x51, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x40, 0x08, 0x74, 0x5d, 0x51, 0x2c, 0x72, 0x5e, 0x51, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x62, 0x54, 0x7f, 0xaf, 0xa5, 0x9d, 0xfb, 0xf8, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xdd, 0xd9, 0xd5, 0xff, 0xa4, 0x97, 0x8e, 0xfc, 0x79, 0x66, 0x57, 0xa4, 0x6d, 0x55, 0x49, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x5c, 0x4e, 0x27, 0x8e, 0x7f, 0x74, 0xf7, 0xe6, 0xe3, 0xe0, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xea, 0xe8, 0xe5, 0xff, 0xce, 0xc7, 0xc2, 0xff, 0xa5, 0x99, 0x8f, 0xfc, 0x71, 0x5e, 0x4f, 0xaf, 0x73, 0x63, 0x52, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x49, 0x49, 0x07, 0x73, 0x5f, 0x50, 0x98, 0xb5, 0xab, 0xa3, 0xff, 0xe0, 0xdc, 0xd9, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xb4, 0xaa, 0xa2, 0xff, 0x93, 0x85, 0x7a, 0xf4, 0x78, 0x67, 0x58, 0xab, 0x70, 0x60, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x55, 0x55, 0x0c, 0x73, 0x60, 0x50, 0xbf, 0x98, 0x8a, 0x80, 0xff, 0x93, 0x84, 0x7a, 0xff, 0x88, 0x78, 0x6c, 0xff, 0x7e, 0x6c, 0x60, 0xc8, 0x75, 0x62, 0x52, 0x60, 0x6f, 0x59, 0x4e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x61, 0x4f, 0x1c, 0x72, 0x5f, 0x51, 0x6b, 0x74, 0x61, 0x51, 0x4f, 0x73, 0x60, 0x53, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6a, 0x6a, 0x40, 0x0c, 0x72, 0x61, 0x50, 0x5c, 0x72, 0x5f, 0x51, 0x8b, 0x72, 0x60, 0x52, 0xab, 0x71, 0x5f, 0x52, 0x63, 0x40, 0x40, 
+  0x40, 0x04, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x5a, 0x52, 0x23, 0x78, 0x66, 0x5a, 0x80, 0x8a, 0x78, 0x6c, 0xe8, 0xa8, 0x9c, 0x93, 0xff, 0xca, 0xc3, 0xbe, 0xff, 0xd6, 0xd0, 0xcc, 0xff, 
+  0x76, 0x64, 0x56, 0xd7, 0x72, 0x5c, 0x51, 0x2f, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x08, 0x76, 0x5d, 0x51, 0x28, 0x80, 0x6e, 0x62, 0xbb, 0xae, 0xa4, 0x9c, 0xfb, 0xe2, 0xdd, 0xda, 0xff, 0xfd, 0xfd, 
+  0xfd, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xc8, 0xc0, 0xbb, 0xff, 0x72, 0x60, 0x52, 0xa4, 0x76, 0x62, 0x4e, 0x0c, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x08, 0x70, 0x61, 0x52, 0x23, 0x75, 0x61, 0x53, 0xb4, 
+  0xc8, 0xc0, 0xba, 0xff, 0xf5, 0xf3, 0xf2, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xf4, 0xf2, 0xf1, 0xff, 0xcf, 0xc9, 0xc4, 0xff, 0x8b, 0x7c, 0x6f, 0xfb, 0x70, 0x60, 0x50, 0x30, 0xa5, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x71, 0x63, 0x55, 0x13, 0x79, 0x68, 0x5a, 0xa3, 0xbc, 0xb4, 0xad, 0xfc, 0xfb, 0xfa, 0xf9, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xd6, 0xd1, 0xcc, 0xff, 0x9d, 0x91, 
+  0x86, 0xfc, 0x75, 0x63, 0x54, 0x8b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0x73, 0x60, 0x52, 0x34, 0x73, 0x5f, 0x50, 0x58, 0x71, 0x5e, 0x4c, 0x1b, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x5e, 
+  0x51, 0x4c, 0x9c, 0x8e, 0x84, 0xec, 0xeb, 0xe8, 0xe6, 0xff, 0xf7, 0xf5, 0xf5, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xea, 0xe6, 0xe4, 0xff, 0xba, 0xb0, 0xa9, 0xff, 0x82, 0x71, 0x64, 0xd3, 0x6f, 0x5e, 
+  0x4e, 0x2f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x5b, 0x49, 0x0f, 0x80, 0x6e, 0x61, 0xd3, 0x92, 0x83, 0x78, 0xfc, 0x7a, 0x67, 0x5a, 0x90, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7e, 0x6b, 
+  0x5e, 0xa3, 0xc2, 0xba, 0xb3, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xd6, 0xd0, 0xcb, 0xff, 0x96, 0x88, 0x7d, 0xf7, 0x72, 0x5f, 0x53, 0x7b, 0x7f, 0x55, 
+  0x55, 0x07, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0x71, 0x61, 0x53, 0x6c, 0xa4, 0x98, 0x8e, 0xff, 0xd7, 0xd1, 0xcd, 0xff, 0x86, 0x77, 0x6b, 0xec, 0x6d, 0x5b, 0x49, 0x0f, 0x9b, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x66, 0x66, 0x33, 0x04, 0x8b, 0x7c, 0x6f, 0xf0, 0xe4, 0xe0, 0xdd, 0xff, 0xf2, 0xf0, 0xee, 0xff, 0xf2, 0xef, 0xec, 0xff, 0xe1, 0xdb, 0xd8, 0xff, 0xb8, 0xaf, 0xa8, 0xff, 0x73, 0x61, 
+  0x52, 0xbf, 0x6a, 0x60, 0x4a, 0x18, 0x84, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, 0x5b, 0x52, 0x34, 0x7f, 0x6d, 0x60, 0xd8, 0xea, 0xe7, 0xe4, 0xff, 0xe6, 0xe2, 0xe0, 0xff, 0x96, 0x87, 0x7d, 0xff, 
+  0x71, 0x5e, 0x4f, 0x5b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x60, 0x50, 0x20, 0x91, 0x82, 0x76, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xda, 0xd4, 
+  0xcf, 0xff, 0xa4, 0x97, 0x8d, 0xff, 0x72, 0x5f, 0x51, 0x90, 0x84, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0x62, 0x4e, 0x0c, 0x74, 0x62, 0x52, 0x8f, 0xb4, 0xaa, 0xa2, 0xf8, 0xf6, 0xf4, 0xf3, 0xff, 
+  0xe0, 0xdb, 0xd8, 0xff, 0xa6, 0x9a, 0x91, 0xff, 0x72, 0x5f, 0x51, 0x84, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x08, 0x72, 0x5e, 0x4e, 0x30, 0x93, 0x84, 0x78, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xee, 0xea, 
+  0xe7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xde, 0xd8, 0xd4, 0xff, 0xba, 0xb1, 0xa9, 0xff, 0x76, 0x64, 0x55, 0xd3, 0x73, 0x62, 0x51, 0x3c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x61, 0x54, 0x3b, 
+  0x90, 0x81, 0x75, 0xe4, 0xdf, 0xdb, 0xd7, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xe0, 0xdb, 0xd7, 0xff, 0xae, 0xa3, 0x9a, 0xff, 0x74, 0x5f, 0x50, 0x97, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x74, 0x5d, 
+  0x55, 0x20, 0x92, 0x83, 0x76, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xea, 0xe6, 0xe3, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xd5, 0xcd, 0xc8, 0xff, 0xae, 0xa1, 0x99, 0xff, 0x82, 0x70, 
+  0x64, 0xeb, 0x74, 0x62, 0x54, 0x7c, 0x75, 0x5f, 0x50, 0x23, 0x81, 0x66, 0x66, 0x4c, 0x0b, 0x06, 0x7d, 0x6b, 0x5e, 0xbc, 0xc1, 0xb7, 0xb1, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xef, 0xec, 0xe9, 0xff, 
+  0xdc, 0xd7, 0xd2, 0xff, 0xa8, 0x9c, 0x93, 0xff, 0x71, 0x5d, 0x50, 0x8c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x13, 0x55, 0x55, 0x2a, 0x07, 0x8c, 0x7d, 0x72, 0xf7, 0xe3, 0xdf, 0xdb, 0xff, 0xea, 0xe5, 
+  0xe2, 0xff, 0xe8, 0xe3, 0xe0, 0xff, 0xe9, 0xe4, 0xe0, 0xff, 0xe6, 0xe1, 0xde, 0xff, 0xd1, 0xca, 0xc4, 0xff, 0xb6, 0xab, 0xa3, 0xff, 0x97, 0x88, 0x7c, 0xff, 0x7f, 0x6d, 0x60, 0xc7, 0x73, 0x60, 
+  0x53, 0x94, 0x73, 0x60, 0x50, 0x94, 0x9b, 0x8e, 0x83, 0xfc, 0xe6, 0xe1, 0xde, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xd6, 0xcf, 0xca, 0xff, 0x97, 0x88, 0x7e, 0xff, 0x71, 0x60, 
+  0x51, 0x68, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x13, 0x72, 0x5f, 0x50, 0x53, 0x90, 0x80, 0x75, 0xfb, 0xe6, 0xe1, 0xde, 0xff, 0xe9, 0xe3, 0xdf, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 
+  0xe7, 0xe2, 0xdd, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xdb, 0xd4, 0xcf, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xb2, 0xa7, 0x9e, 0xff, 0xab, 0x9f, 0x96, 0xff, 0xba, 0xaf, 0xa8, 0xff, 0xdf, 0xda, 0xd5, 0xff, 
+  0xed, 0xe9, 0xe6, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xe5, 0xe0, 0xdc, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0x86, 0x76, 0x69, 0xff, 0x71, 0x5f, 0x53, 0x2b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x14, 0x71, 0x55, 
+  0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x8a, 0x7a, 0x6e, 0xeb, 0xe2, 0xdd, 0xd9, 0xff, 0xea, 0xe5, 0xe1, 0xff, 0xe1, 0xdb, 0xd6, 0xff, 0xdf, 0xd9, 0xd4, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xe4, 0xde, 
+  0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xdf, 0xd7, 0xd2, 0xff, 0xda, 0xd4, 0xce, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xe9, 0xe3, 0xe0, 0xff, 0xe8, 0xe2, 
+  0xde, 0xff, 0xe8, 0xe3, 0xde, 0xff, 0xd3, 0xcb, 0xc6, 0xff, 0xa5, 0x98, 0x8e, 0xff, 0x7b, 0x69, 0x5c, 0xbc, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x60, 0x52, 0x6b, 0x91, 0x82, 0x77, 0xe4, 
+  0xd4, 0xcd, 0xc8, 0xff, 0xe9, 0xe3, 0xdf, 0xff, 0xdc, 0xd4, 0xcf, 0xff, 0xc9, 0xc0, 0xb9, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0xde, 0xd7, 0xd2, 0xff, 0xe2, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 
+  0x81, 0xe3, 0xdd, 0xd8, 0xff, 0x02, 0xe4, 0xdd, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0x81, 0xe5, 0xdf, 0xdb, 0xff, 0x03, 0xda, 0xd4, 0xce, 0xff, 0xb7, 0xac, 0xa4, 0xff, 
+  0x88, 0x77, 0x6b, 0xeb, 0x73, 0x60, 0x51, 0x53, 0x99, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0x5f, 0x50, 0x53, 0x8a, 0x7a, 0x6e, 0xeb, 0xd3, 0xcc, 0xc6, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xda, 0xd2, 
+  0xcd, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0xc0, 0xb6, 0xaf, 0xff, 0xd5, 0xce, 0xc9, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xe1, 0xdb, 0xd6, 0xff, 0xe0, 0xd9, 0xd4, 0xff, 0x81, 0xe1, 0xda, 0xd5, 0xff, 0x81, 
+  0xe2, 0xdb, 0xd6, 0xff, 0x06, 0xe2, 0xdc, 0xd7, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xd6, 0xce, 0xc8, 0xff, 0xc2, 0xb9, 0xb1, 0xff, 0x8d, 0x7d, 0x71, 0xf8, 0x74, 0x62, 0x56, 0x8f, 0x6d, 0x5b, 0x49, 
+  0x0f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x16, 0x71, 0x55, 0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x89, 0x7a, 0x6d, 0xeb, 0xdf, 0xd9, 0xd5, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xd8, 0xcf, 0xc9, 0xff, 0xbe, 
+  0xb4, 0xac, 0xff, 0xbf, 0xb6, 0xaf, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0xe6, 0xe1, 0xdd, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xdb, 0xd3, 0xce, 0xff, 0xd6, 0xcd, 0xc7, 0xff, 0xd7, 0xce, 0xc8, 0xff, 0xd9, 
+  0xd1, 0xcb, 0xff, 0xda, 0xd1, 0xcc, 0xff, 0xd8, 0xd1, 0xcb, 0xff, 0xd4, 0xcc, 0xc4, 0xff, 0xc3, 0xb9, 0xb1, 0xff, 0xad, 0xa1, 0x96, 0xff, 0x87, 0x78, 0x6c, 0xf3, 0x70, 0x5d, 0x4e, 0x88, 0x76, 
+  0x4e, 0x4e, 0x0c, 0x98, 0x00, 0x00, 0x00, 0x00, 0x15, 0x73, 0x60, 0x52, 0x6b, 0x8f, 0x81, 0x74, 0xe4, 0xd1, 0xc9, 0xc4, 0xff, 0xe2, 0xdc, 0xd6, 0xff, 0xd4, 0xcb, 0xc4, 0xff, 0xbf, 0xb5, 0xad, 
+  0xff, 0xbe, 0xb4, 0xad, 0xff, 0xd1, 0xca, 0xc4, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xd8, 0xd1, 0xca, 0xff, 0xc6, 0xbc, 0xb4, 0xff, 0xac, 0x9f, 0x95, 0xff, 0xae, 0xa2, 0x98, 
+  0xff, 0xb8, 0xac, 0xa3, 0xff, 0xba, 0xae, 0xa6, 0xff, 0xb3, 0xa7, 0x9e, 0xff, 0xa6, 0x98, 0x8e, 0xff, 0x92, 0x83, 0x77, 0xfb, 0x80, 0x6e, 0x60, 0xd0, 0x72, 0x61, 0x51, 0x74, 0x71, 0x55, 0x55, 
+  0x08, 0x98, 0x00, 0x00, 0x00, 0x00, 0x15, 0x72, 0x5f, 0x50, 0x53, 0x89, 0x79, 0x6d, 0xeb, 0xd0, 0xc8, 0xc2, 0xff, 0xe0, 0xda, 0xd5, 0xff, 0xd3, 0xc9, 0xc2, 0xff, 0xbd, 0xb2, 0xaa, 0xff, 0xba, 
+  0xb0, 0xa9, 0xff, 0xd0, 0xc8, 0xc2, 0xff, 0xe2, 0xdd, 0xd9, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xd7, 0xce, 0xc7, 0xff, 0xc3, 0xb8, 0xb0, 0xff, 0xa4, 0x95, 0x8b, 0xff, 0x7d, 0x6c, 0x5d, 0xef, 0x7f, 
+  0x6d, 0x5f, 0xe0, 0x81, 0x70, 0x63, 0xfb, 0x82, 0x6f, 0x62, 0xff, 0x7f, 0x6d, 0x60, 0xf0, 0x7c, 0x6a, 0x5c, 0xc3, 0x74, 0x5e, 0x53, 0x6c, 0x71, 0x5f, 0x4d, 0x2b, 0x7f, 0x55, 0x55, 0x07, 0x97, 
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x71, 0x55, 0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x89, 0x78, 0x6c, 0xeb, 0xdb, 0xd4, 0xcf, 0xff, 0xde, 0xd6, 0xd1, 0xff, 0xd0, 0xc6, 0xbe, 0xff, 0xb8, 0xac, 0xa4, 
+  0xff, 0xba, 0xb0, 0xa9, 0xff, 0xcd, 0xc5, 0xc0, 0xff, 0xe2, 0xde, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xd4, 0xca, 0xc4, 0xff, 0xbb, 0xb0, 0xa6, 0xff, 0x9c, 0x8d, 0x81, 0xfc, 0x7a, 0x68, 0x59, 
+  0xd4, 0x6e, 0x60, 0x4c, 0x24, 0x00, 0x00, 0x00, 0x00, 0x66, 0x33, 0x33, 0x04, 0x60, 0x60, 0x60, 0x08, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x60, 0x52, 0x6b, 0x8f, 0x7f, 0x74, 0xe4, 0xcf, 
+  0xc6, 0xc0, 0xff, 0xdd, 0xd5, 0xd0, 0xff, 0xcd, 0xc2, 0xbb, 0xff, 0xb9, 0xad, 0xa5, 0xff, 0xb9, 0xae, 0xa7, 0xff, 0xcc, 0xc4, 0xbe, 0xff, 0xdf, 0xd9, 0xd5, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xd2, 
+  0xc8, 0xc1, 0xff, 0xbf, 0xb3, 0xa9, 0xff, 0x9b, 0x8c, 0x80, 0xfc, 0x7c, 0x6b, 0x5c, 0xcb, 0x71, 0x61, 0x51, 0x3f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x72, 0x5f, 0x50, 0x53, 0x89, 0x79, 0x6d, 
+  0xeb, 0xd0, 0xc8, 0xc2, 0xff, 0xdf, 0xd8, 0xd3, 0xff, 0xd0, 0xc6, 0xbe, 0xff, 0xb8, 0xad, 0xa4, 0xff, 0xb5, 0xaa, 0xa3, 0xff, 0xca, 0xc2, 0xbc, 0xff, 0xdd, 0xd7, 0xd3, 0xff, 0xe3, 0xdd, 0xd8, 
+  0xff, 0xd0, 0xc6, 0xbf, 0xff, 0xbd, 0xb0, 0xa7, 0xff, 0xa0, 0x91, 0x85, 0xff, 0x7a, 0x67, 0x57, 0xd4, 0x71, 0x61, 0x51, 0x3f, 0x40, 0x40, 0x40, 0x04, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x71, 
+  0x55, 0x39, 0x08, 0x73, 0x60, 0x52, 0x6b, 0x89, 0x7a, 0x6d, 0xeb, 0xde, 0xd8, 0xd3, 0xff, 0xe2, 0xdc, 0xd6, 0xff, 0xd3, 0xca, 0xc3, 0xff, 0xb6, 0xaa, 0xa1, 0xff, 0xb5, 0xab, 0xa3, 0xff, 0xc8, 
+  0xc0, 0xb9, 0xff, 0xde, 0xd8, 0xd4, 0xff, 0xe2, 0xdc, 0xd7, 0xff, 0xd3, 0xca, 0xc2, 0xff, 0xba, 0xad, 0xa4, 0xff, 0x9b, 0x8b, 0x7f, 0xfc, 0x7a, 0x67, 0x57, 0xd4, 0x71, 0x5c, 0x4e, 0x24, 0x9f, 
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x60, 0x52, 0x6b, 0x90, 0x82, 0x75, 0xe4, 0xd3, 0xcb, 0xc6, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xd5, 0xcc, 0xc5, 0xff, 0xb9, 0xae, 0xa5, 0xff, 0xb3, 0xa9, 0xa0, 
+  0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xda, 0xd3, 0xce, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xd6, 0xcd, 0xc7, 0xff, 0xc2, 0xb6, 0xae, 0xff, 0x9c, 0x8d, 0x81, 0xfc, 0x7c, 0x6a, 0x5c, 0xcb, 0x71, 0x5d, 0x51, 
+  0x3f, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x14, 0x60, 0x40, 0x40, 0x08, 0x71, 0x60, 0x4f, 0x2c, 0x71, 0x60, 0x51, 0x48, 0x73, 0x5d, 0x53, 0x47, 0x6f, 0x5c, 0x4e, 0x27, 0x73, 0x5f, 0x50, 0x58, 0x8a, 
+  0x7a, 0x6e, 0xeb, 0xd4, 0xcd, 0xc7, 0xff, 0xe7, 0xe1, 0xde, 0xff, 0xd9, 0xd1, 0xcb, 0xff, 0xba, 0xaf, 0xa7, 0xff, 0xb1, 0xa5, 0x9d, 0xff, 0xc5, 0xbc, 0xb6, 0xff, 0xd8, 0xd1, 0xcd, 0xff, 0xe3, 
+  0xde, 0xda, 0xff, 0xd9, 0xd1, 0xcb, 0xff, 0xc5, 0xb9, 0xb2, 0xff, 0xa3, 0x95, 0x8a, 0xff, 0x7a, 0x68, 0x59, 0xd4, 0x71, 0x5d, 0x51, 0x3f, 0x40, 0x40, 0x40, 0x04, 0x97, 0x00, 0x00, 0x00, 0x00, 
+  0x15, 0x6a, 0x55, 0x40, 0x0c, 0x70, 0x5c, 0x50, 0x40, 0x7a, 0x68, 0x5b, 0x98, 0x8b, 0x7a, 0x6f, 0xf3, 0x92, 0x83, 0x77, 0xff, 0x9a, 0x8c, 0x82, 0xff, 0x9a, 0x8c, 0x81, 0xff, 0x92, 0x83, 0x77, 
+  0xff, 0x94, 0x84, 0x78, 0xff, 0xe2, 0xdd, 0xda, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xdc, 0xd5, 0xd0, 0xff, 0xb5, 0xaa, 0xa1, 0xff, 0xb0, 0xa5, 0x9c, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0xd9, 0xd3, 0xce, 
+  0xff, 0xe4, 0xde, 0xda, 0xff, 0xdd, 0xd5, 0xd0, 0xff, 0xc2, 0xb7, 0xaf, 0xff, 0x9e, 0x90, 0x85, 0xfc, 0x7a, 0x68, 0x59, 0xd4, 0x71, 0x5c, 0x4e, 0x24, 0x98, 0x00, 0x00, 0x00, 0x00, 0x05, 0x77, 
+  0x55, 0x55, 0x0f, 0x75, 0x65, 0x56, 0x8b, 0x93, 0x84, 0x79, 0xe4, 0xbb, 0xb0, 0xa9, 0xff, 0xe1, 0xdc, 0xd8, 0xff, 0xed, 0xea, 0xe7, 0xff, 0x81, 0xf0, 0xed, 0xea, 0xff, 0x0d, 0xec, 0xe9, 0xe6, 
+  0xff, 0xeb, 0xe7, 0xe5, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xdd, 0xd7, 0xd2, 0xff, 0xba, 0xb0, 0xa8, 0xff, 0xae, 0xa3, 0x9a, 0xff, 0xc1, 0xb8, 0xb1, 0xff, 0xd5, 0xcd, 0xc8, 0xff, 0xe5, 0xdf, 0xdb, 
+  0xff, 0xdf, 0xd8, 0xd3, 0xff, 0xca, 0xc1, 0xba, 0xff, 0x9f, 0x91, 0x86, 0xfc, 0x7d, 0x6b, 0x5d, 0xcb, 0x73, 0x5f, 0x52, 0x3f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x60, 0x50, 0x10, 0x73, 
+  0x5e, 0x4f, 0x94, 0xa7, 0x9a, 0x90, 0xf8, 0xe2, 0xdd, 0xda, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xee, 0xeb, 0xe8, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0x81, 0xeb, 0xe7, 0xe4, 0xff, 
+  0x0c, 0xeb, 0xe7, 0xe3, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xc4, 0xba, 0xb4, 0xff, 0xac, 0xa0, 0x97, 0xff, 0xc0, 0xb6, 0xaf, 0xff, 0xd2, 0xcc, 0xc6, 0xff, 0xe4, 0xdf, 0xdb, 0xff, 0xe3, 0xdd, 0xd8, 
+  0xff, 0xcd, 0xc4, 0xbe, 0xff, 0xa8, 0x9b, 0x92, 0xff, 0x7a, 0x68, 0x59, 0xd4, 0x73, 0x5f, 0x52, 0x3f, 0x40, 0x40, 0x40, 0x04, 0x97, 0x00, 0x00, 0x00, 0x00, 0x15, 0x76, 0x62, 0x4e, 0x0c, 0x78, 
+  0x63, 0x57, 0x90, 0xa8, 0x9c, 0x93, 0xf8, 0xf6, 0xf4, 0xf3, 0xff, 0xf2, 0xf0, 0xee, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xee, 
+  0xea, 0xe7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xe8, 0xe3, 0xe0, 0xff, 0xc8, 0xc0, 0xb9, 0xff, 0xbe, 0xb5, 0xae, 0xff, 0xd5, 0xce, 0xc8, 0xff, 0xe5, 0xe1, 0xdd, 0xff, 0xe6, 
+  0xe0, 0xdd, 0xff, 0xca, 0xc1, 0xba, 0xff, 0xa3, 0x95, 0x8b, 0xfc, 0x7b, 0x67, 0x5b, 0xd4, 0x71, 0x5c, 0x4e, 0x24, 0x99, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x5e, 0x50, 0x48, 0x97, 0x88, 0x7e, 
+  0xe8, 0xe6, 0xe3, 0xe0, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xf3, 0xf1, 0xef, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0x81, 0xf2, 0xef, 0xed, 0xff, 0x0c, 0xf1, 0xee, 0xec, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xf0, 
+  0xed, 0xea, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xe3, 0xde, 0xdb, 0xff, 0xda, 0xd4, 0xcf, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xd3, 0xcb, 0xc6, 0xff, 0xa4, 
+  0x96, 0x8d, 0xfc, 0x7e, 0x6b, 0x60, 0xcb, 0x73, 0x5f, 0x52, 0x3f, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7f, 0x6d, 0x61, 0xa8, 0xc3, 0xbb, 0xb6, 0xff, 0xf8, 0xf6, 0xf6, 0xff, 0xf7, 0xf5, 0xf3, 
+  0xff, 0xf5, 0xf3, 0xf2, 0xff, 0xe7, 0xe3, 0xdf, 0xff, 0xd7, 0xd1, 0xcd, 0xff, 0xd7, 0xd1, 0xcc, 0xff, 0xde, 0xd9, 0xd5, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf3, 0xf0, 0xee, 
+  0xff, 0xf2, 0xef, 0xed, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xd9, 0xd3, 0xce, 0xff, 0xae, 0xa2, 0x99, 0xff, 0x7b, 0x67, 0x5d, 0xd4, 0x73, 0x5f, 0x52, 
+  0x3f, 0x40, 0x40, 0x40, 0x04, 0x99, 0x00, 0x00, 0x00, 0x00, 0x13, 0x6b, 0x5e, 0x51, 0x13, 0x8f, 0x7e, 0x75, 0xfb, 0xee, 0xec, 0xeb, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xe7, 
+  0xe3, 0xe1, 0xff, 0xc2, 0xba, 0xb4, 0xff, 0x9b, 0x8d, 0x82, 0xf4, 0x98, 0x8b, 0x80, 0xf0, 0xa9, 0x9e, 0x94, 0xfc, 0xc1, 0xb8, 0xb1, 0xff, 0xd9, 0xd4, 0xcf, 0xff, 0xed, 0xea, 0xe7, 0xff, 0xf5, 
+  0xf3, 0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xcd, 0xc5, 0xbf, 0xff, 0x86, 0x75, 0x68, 0xff, 0x72, 0x5e, 0x53, 0x30, 0x9b, 0x00, 0x00, 0x00, 0x00, 
+  0x0d, 0x70, 0x5e, 0x4f, 0x44, 0x9d, 0x90, 0x86, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf5, 0xf4, 0xf3, 0xff, 0xd3, 0xcd, 0xc9, 0xff, 0x93, 0x84, 0x79, 0xff, 0x72, 0x5e, 0x52, 
+  0x7f, 0x73, 0x5e, 0x4f, 0x64, 0x72, 0x5f, 0x50, 0x8f, 0x87, 0x77, 0x6c, 0xe0, 0xa7, 0x9b, 0x92, 0xff, 0xcd, 0xc7, 0xc2, 0xff, 0xec, 0xe9, 0xe7, 0xff, 0x81, 0xf7, 0xf6, 0xf5, 0xff, 0x03, 0xf2, 
+  0xf0, 0xef, 0xff, 0xd7, 0xd2, 0xce, 0xff, 0x8c, 0x7d, 0x71, 0xff, 0x72, 0x60, 0x52, 0x38, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x60, 0x51, 0x63, 0xb0, 0xa6, 0x9e, 0xff, 0x81, 0xff, 0xff, 
+  0xff, 0xff, 0x0f, 0xe7, 0xe4, 0xe2, 0xff, 0xb1, 0xa7, 0x9f, 0xff, 0x7b, 0x6a, 0x5e, 0xc7, 0x71, 0x55, 0x39, 0x08, 0x00, 0x00, 0x00, 0x00, 0x66, 0x4c, 0x4c, 0x0b, 0x73, 0x5f, 0x52, 0x3f, 0x79, 
+  0x69, 0x5c, 0xb0, 0x95, 0x88, 0x7c, 0xfb, 0xd6, 0xd0, 0xcc, 0xff, 0xf1, 0xee, 0xed, 0xff, 0xfa, 0xf9, 0xf9, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xdf, 0xdb, 0xd7, 0xff, 0x99, 0x8b, 0x80, 0xff, 0x72, 
+  0x5e, 0x50, 0x5c, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x5e, 0x52, 0x64, 0xb3, 0xa9, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf6, 0xff, 0xc6, 0xbe, 0xb9, 0xff, 0x8d, 0x7d, 0x71, 
+  0xe8, 0x74, 0x61, 0x51, 0x43, 0x83, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6a, 0x55, 0x40, 0x0c, 0x72, 0x5f, 0x51, 0x9b, 0xab, 0xa0, 0x97, 0xff, 0xf1, 0xef, 0xed, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfb, 
+  0xfb, 0xfa, 0xff, 0xe3, 0xdf, 0xdc, 0xff, 0x9b, 0x8d, 0x83, 0xff, 0x72, 0x60, 0x52, 0x60, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x5e, 0x51, 0x4c, 0xa0, 0x94, 0x8a, 0xff, 0xfd, 0xfd, 0xfc, 
+  0xff, 0xe3, 0xe0, 0xdd, 0xff, 0xa8, 0x9b, 0x93, 0xfb, 0x75, 0x63, 0x54, 0x98, 0x70, 0x60, 0x50, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x5e, 0x51, 0x63, 0xa2, 0x95, 0x8c, 0xff, 0x81, 
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xfb, 0xfa, 0xfa, 0xff, 0xe0, 0xdb, 0xd8, 0xff, 0x90, 0x81, 0x76, 0xff, 0x71, 0x60, 0x51, 0x48, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x71, 0x5e, 0x4c, 0x1b, 0x91, 
+  0x82, 0x75, 0xfc, 0xef, 0xec, 0xeb, 0xff, 0xd5, 0xcf, 0xca, 0xff, 0x7f, 0x6c, 0x60, 0xdc, 0x73, 0x5f, 0x4e, 0x3f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x55, 0x47, 0x13, 0x74, 0x60, 0x52, 
+  0xb4, 0xd7, 0xd2, 0xcd, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf7, 0xf6, 0xf5, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0x86, 0x75, 0x69, 0xfc, 0x70, 0x5c, 0x52, 0x18, 0x9c, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0x7f, 0x6d, 0x63, 0xac, 0xbc, 0xb3, 0xac, 0xff, 0xa0, 0x94, 0x8a, 0xff, 0x72, 0x61, 0x52, 0x78, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x33, 0x33, 0x04, 0x71, 0x5f, 0x51, 0x70, 0xa4, 
+  0x99, 0x8f, 0xf3, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe8, 0xe5, 0xe3, 0xff, 0xaf, 0xa4, 0x9c, 0xff, 0x7c, 0x6a, 0x5e, 0xb8, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 
+  0x60, 0x53, 0x4b, 0x86, 0x76, 0x6a, 0xd8, 0x7d, 0x6b, 0x5e, 0xcc, 0x73, 0x59, 0x4c, 0x14, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6c, 0x60, 0x4c, 0x28, 0x87, 0x78, 0x6b, 0xcb, 0xdd, 0xd9, 0xd5, 
+  0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf7, 0xf6, 0xf4, 0xff, 0xcc, 0xc6, 0xc0, 0xff, 0x91, 0x82, 0x77, 0xf0, 0x74, 0x60, 0x51, 0x58, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x60, 0x40, 
+  0x08, 0x74, 0x5d, 0x51, 0x2c, 0x72, 0x5e, 0x51, 0x27, 0x85, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x62, 0x54, 0x7f, 0xaf, 0xa5, 0x9d, 0xfb, 0xf8, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 
+  0xf6, 0xf5, 0xff, 0xdd, 0xd9, 0xd5, 0xff, 0xa4, 0x97, 0x8e, 0xfc, 0x79, 0x66, 0x57, 0xa4, 0x6d, 0x55, 0x49, 0x14, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x08, 0x6f, 0x5c, 0x4e, 0x27, 0x8e, 0x7f, 0x74, 
+  0xf7, 0xe6, 0xe3, 0xe0, 0xff, 0xf7, 0xf6, 0xf5, 0xff, 0xea, 0xe8, 0xe5, 0xff, 0xce, 0xc7, 0xc2, 0xff, 0xa5, 0x99, 0x8f, 0xfc, 0x71, 0x5e, 0x4f, 0xaf, 0x73, 0x63, 0x52, 0x1f, 0xa5, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x6d, 0x49, 0x49, 0x07, 0x73, 0x5f, 0x50, 0x98, 0xb5, 0xab, 0xa3, 0xff, 0xe0, 0xdc, 0xd9, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xb4, 0xaa, 0xa2, 0xff, 0x93, 0x85, 0x7a, 0xf4, 0x78, 
+  0x67, 0x58, 0xab, 0x70, 0x60, 0x50, 0x20, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6a, 0x55, 0x55, 0x0c, 0x73, 0x60, 0x50, 0xbf, 0x98, 0x8a, 0x80, 0xff, 0x93, 0x84, 0x7a, 0xff, 0x88, 0x78, 0x6c, 
+  0xff, 0x7e, 0x6c, 0x60, 0xc8, 0x75, 0x62, 0x52, 0x60, 0x6f, 0x59, 0x4e, 0x17, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0x61, 0x4f, 0x1c, 0x72, 0x5f, 0x51, 0x6b, 0x74, 0x61, 0x51, 0x4f, 0x73, 
+  0x60, 0x53, 0x28, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -218,8 +318,7 @@ const lv_img_dsc_t utilities_48px = {
   .header.always_zero = 0,
   .header.w = 48,
   .header.h = 48,
-  .data_size = 2304 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( utilities_48px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = utilities_48px_map,
 };
-
@@ -10,271 +10,452 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_UTILITIES_64PX uint8_t utilities_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x17, 0x6e, 0x6c, 0x6e, 0xa8, 0x6e, 0xcc, 0x6e, 0xec, 0x6e, 0xaf, 0x6e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x18, 0x6e, 0x9b, 0x4e, 0xfb, 0x6e, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x50, 0x6e, 0xef, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x6e, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x70, 0x6e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x5c, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xf7, 0x6e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x27, 0x4e, 0xf7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x03, 0x6e, 0x37, 0x4e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xbb, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x4e, 0xe7, 0x4e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x8f, 0x6e, 0xff, 0x6e, 0xf4, 0x6e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x38, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x28, 0x4e, 0xfc, 0xdb, 0xff, 0x92, 0xff, 0x4e, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x9c, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xcf, 0x6d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xb4, 0x92, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xfb, 0x4e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xe7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x47, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x1c, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x04, 0x4e, 0xd4, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x3b, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x4e, 0xcb, 0x6d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x68, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x44, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 0x9c, 0x6e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x0f, 0x6e, 0xeb, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x4e, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x37, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6e, 0xc8, 0x6e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x8b, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x10, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x4e, 0xfc, 0x4e, 0xa8, 0x6e, 0x47, 0x6e, 0x0f, 0x6e, 0x34, 0x4e, 0xf8, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x4e, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xeb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6e, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x4e, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x6e, 0xdc, 0x6e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x4e, 0xe0, 0x4e, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xbf, 0x6e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x92, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xe4, 0x4e, 0x64, 0x92, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x4e, 0xc0, 0x6e, 0xef, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xfc, 0x4e, 0xdb, 0x6e, 0xa0, 0x6e, 0x50, 0x6e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x08, 0x6e, 0x0f, 0x6d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x28, 0x4e, 0x53, 0x6e, 0x67, 0x6e, 0x67, 0x6e, 0x4b, 0x4e, 0x20, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x27, 0x6e, 0x93, 0x6e, 0xe8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x0f, 0x6e, 0x98, 0x4e, 0xfc, 0x92, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x2b, 0x6e, 0xdf, 0x72, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x2c, 0x4e, 0xec, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x13, 0x6e, 0xe3, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xa4, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x37, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xab, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x0c, 0x6e, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x44, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xe8, 0x6e, 0xb3, 0x4e, 0xdc, 0x6e, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x70, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x4e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x34, 0x6e, 0xaf, 0x6e, 0xff, 0x96, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x88, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x47, 0x6e, 0xe8, 0x92, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x8b, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xf3, 0x6e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x20, 0x6e, 0xe7, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x78, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x68, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x53, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x4e, 0xe0, 0x6e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x9c, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x17, 0x4e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x30, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x4e, 0xfc, 0x4e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xac, 0x97, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xbf, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x43, 0x6e, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6e, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x50, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x88, 0x6e, 0xdf, 0x6e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x07, 0x6e, 0xdc, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xc8, 0x92, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x73, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xf7, 0x6e, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x14, 0x4e, 0xf0, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xfc, 0x6e, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x94, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x4e, 0xf8, 0x6e, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x1c, 0x4e, 0xfc, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xff, 0x6e, 0xd3, 0x4e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x18, 0x4e, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xd3, 0x6e, 0x63, 0x52, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x34, 0x6e, 0x94, 0x6e, 0x7c, 0x6e, 0x58, 0x6e, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xea, 0x00, 0x00, 0x06, 0x4e, 0x17, 0x6e, 0x6c, 0x6e, 0xa8, 0x6e, 0xcc, 0x6e, 0xec, 0x6e, 0xaf, 0x6e, 0x0b, 0xb6, 0x00, 0x00, 0x04, 0x6e, 0x18, 0x6e, 
+  0x9b, 0x4e, 0xfb, 0x6e, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x01, 0x6e, 0xff, 0x6e, 0x6b, 0xb5, 0x00, 0x00, 0x02, 0x6e, 0x50, 0x6e, 0xef, 0x72, 0xff, 0x84, 0xff, 0xff, 0x01, 0x6e, 0xff, 0x6e, 
+  0x37, 0xb4, 0x00, 0x00, 0x02, 0x6e, 0x70, 0x6e, 0xff, 0xbb, 0xff, 0x84, 0xff, 0xff, 0x01, 0x92, 0xff, 0x6e, 0xa7, 0xb4, 0x00, 0x00, 0x02, 0x6e, 0x5c, 0x6e, 0xff, 0xdb, 0xff, 0x83, 0xff, 0xff, 
+  0x03, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xf7, 0x6e, 0x1f, 0xb3, 0x00, 0x00, 0x02, 0x6e, 0x27, 0x4e, 0xf7, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x84, 0x87, 0x00, 0x00, 
+  0x02, 0x92, 0x03, 0x6e, 0x37, 0x4e, 0x10, 0xa9, 0x00, 0x00, 0x01, 0x6e, 0xbb, 0x92, 0xff, 0x84, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x97, 0xff, 0x4e, 0xe7, 0x4e, 0x0c, 0x87, 0x00, 0x00, 0x03, 0x6e, 
+  0x8f, 0x6e, 0xff, 0x6e, 0xf4, 0x6e, 0x33, 0xa7, 0x00, 0x00, 0x01, 0x4e, 0x38, 0x6e, 0xff, 0x84, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x63, 0x87, 0x00, 0x00, 0x04, 0x6e, 
+  0x28, 0x4e, 0xfc, 0xdb, 0xff, 0x92, 0xff, 0x4e, 0xa8, 0xa7, 0x00, 0x00, 0x01, 0x6e, 0x9c, 0x92, 0xff, 0x84, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xcf, 0x6d, 0x03, 0x87, 0x00, 0x00, 
+  0x05, 0x6e, 0xb4, 0x92, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xfb, 0x4e, 0x1b, 0xa6, 0x00, 0x00, 0x01, 0x4e, 0xe7, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 
+  0x40, 0x87, 0x00, 0x00, 0x01, 0x6e, 0x47, 0x6e, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x6e, 0xff, 0x6e, 0x6b, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x1c, 0x6e, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 
+  0xff, 0x92, 0xff, 0x6e, 0xb8, 0x87, 0x00, 0x00, 0x02, 0x52, 0x04, 0x4e, 0xd4, 0xb7, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xa0, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x3b, 0x6e, 
+  0xff, 0x84, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x92, 0xff, 0x4e, 0xcb, 0x6d, 0x03, 0x86, 0x00, 0x00, 0x01, 0x4e, 0x68, 0x6e, 0xff, 0x82, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xc0, 0xa5, 
+  0x00, 0x00, 0x01, 0x6e, 0x44, 0x6e, 0xff, 0x84, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 0x9c, 0x6e, 0x04, 0x84, 0x00, 0x00, 0x02, 0x6e, 0x0f, 0x6e, 0xeb, 0xb7, 0xff, 0x82, 
+  0xff, 0xff, 0x02, 0xdb, 0xff, 0x97, 0xff, 0x4e, 0xcb, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x37, 0x6e, 0xff, 0x85, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6e, 0xc8, 0x6e, 0x2c, 0x83, 
+  0x00, 0x00, 0x01, 0x6e, 0x8b, 0x6e, 0xff, 0x83, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x97, 0xff, 0x6e, 0xc3, 0xa5, 0x00, 0x00, 0x01, 0x4e, 0x10, 0x6e, 0xff, 0x86, 0xff, 0xff, 0x09, 0xdb, 0xff, 0xbb, 
+  0xff, 0x72, 0xff, 0x4e, 0xfc, 0x4e, 0xa8, 0x6e, 0x47, 0x6e, 0x0f, 0x6e, 0x34, 0x4e, 0xf8, 0xdb, 0xff, 0x83, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x92, 0xff, 0x4e, 0xa4, 0xa6, 0x00, 0x00, 0x01, 0x6e, 
+  0xeb, 0xdb, 0xff, 0x86, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x01, 0xb7, 0xff, 0x72, 0xff, 0x82, 0x6e, 0xff, 0x00, 0x92, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x73, 0xa5, 0x00, 
+  0x00, 0x01, 0x6e, 0x94, 0x6e, 0xff, 0x88, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0xdb, 0xff, 0x81, 0xbb, 0xff, 0x00, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6e, 
+  0x28, 0xa4, 0x00, 0x00, 0x02, 0x6e, 0x94, 0x6e, 0xff, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xc7, 0xa4, 0x00, 0x00, 
+  0x02, 0x6e, 0x94, 0x6e, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x8e, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x4e, 0x4c, 0xa3, 0x00, 0x00, 0x02, 0x6e, 0x94, 0x6e, 
+  0xff, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x8c, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 0xaf, 0xa3, 0x00, 0x00, 0x02, 0x6e, 0x94, 
+  0x6e, 0xff, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x01, 0xdb, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x8c, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xbb, 0xff, 0x72, 0xff, 0x6e, 0xdc, 0x6e, 0x13, 0xa2, 0x00, 0x00, 
+  0x02, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x8a, 0xff, 0xff, 0x06, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 
+  0x6e, 0xff, 0x4e, 0xe0, 0x4e, 0x23, 0xa2, 0x00, 0x00, 0x02, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 
+  0x01, 0xdf, 0xff, 0xdb, 0xff, 0x81, 0xbb, 0xff, 0x83, 0xdb, 0xff, 0x81, 0xbb, 0xff, 0x04, 0xb7, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xbf, 0x6e, 0x18, 0xa2, 0x00, 0x00, 0x07, 0x6e, 0x94, 0x6e, 
+  0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x81, 0x92, 0xff, 0x00, 0x97, 0xff, 
+  0x82, 0xb7, 0xff, 0x05, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xe4, 0x4e, 0x64, 0x92, 0x03, 0xa2, 0x00, 0x00, 0x09, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 
+  0xbb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x04, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x4e, 0xc0, 0x6e, 0xef, 0x81, 0x6e, 0xff, 0x04, 0x4e, 0xfc, 0x4e, 
+  0xdb, 0x6e, 0xa0, 0x6e, 0x50, 0x6e, 0x07, 0xa3, 0x00, 0x00, 0x03, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x03, 0xbb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0x82, 
+  0xff, 0xff, 0x81, 0xdb, 0xff, 0x03, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0x81, 0x00, 0x00, 0x02, 0x6e, 0x08, 0x6e, 0x0f, 0x6d, 0x03, 0xa6, 0x00, 0x00, 0x03, 0x6e, 0x94, 0x6e, 0xff, 
+  0xdb, 0xff, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x81, 0xb7, 0xff, 0x01, 0xbb, 0xff, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x05, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0xab, 
+  0x00, 0x00, 0x03, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x81, 0xb7, 0xff, 0x02, 0xbb, 0xff, 0xdb, 0xff, 0xdf, 0xff, 0x81, 0xff, 0xff, 0x05, 0xdb, 0xff, 0xbb, 0xff, 
+  0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0xab, 0x00, 0x00, 0x0a, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 
+  0xdf, 0xff, 0x81, 0xff, 0xff, 0x05, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x43, 0xab, 0x00, 0x00, 0x06, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 
+  0xdb, 0xff, 0xbb, 0xff, 0x81, 0xb7, 0xff, 0x01, 0xdb, 0xff, 0xdf, 0xff, 0x81, 0xff, 0xff, 0x05, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0xab, 0x00, 0x00, 0x02, 
+  0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xbb, 0xff, 0x81, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x05, 0xdb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x92, 0xff, 
+  0x4e, 0xf7, 0x6e, 0x40, 0xab, 0x00, 0x00, 0x02, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xbb, 0xff, 0x81, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x81, 
+  0xdb, 0xff, 0x03, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x28, 0x4e, 0x53, 0x81, 0x6e, 0x67, 0x04, 0x6e, 0x4b, 0x4e, 0x20, 0x6e, 0x94, 0x6e, 0xff, 0xdb, 
+  0xff, 0x82, 0xff, 0xff, 0x00, 0xbb, 0xff, 0x81, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x81, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0xa3, 0x00, 0x00, 
+  0x02, 0x4e, 0x27, 0x6e, 0x93, 0x6e, 0xe8, 0x86, 0x6e, 0xff, 0x00, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x02, 0xbb, 0xff, 0x97, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x04, 0xdb, 0xff, 
+  0xb7, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0xa2, 0x00, 0x00, 0x04, 0x6e, 0x0f, 0x6e, 0x98, 0x4e, 0xfc, 0x92, 0xff, 0xdb, 0xff, 0x89, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x97, 0xff, 0xb7, 0xff, 
+  0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0xa2, 0x00, 0x00, 0x03, 0x6e, 0x2b, 0x6e, 0xdf, 0x72, 0xff, 0xdb, 0xff, 0x8a, 0xff, 0xff, 
+  0x02, 0xdb, 0xff, 0x97, 0xff, 0xb7, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0xa2, 0x00, 0x00, 0x02, 0x4e, 0x2c, 0x4e, 0xec, 
+  0x96, 0xff, 0x8c, 0xff, 0xff, 0x03, 0x97, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x4e, 0xf7, 0x6e, 0x40, 0xa2, 0x00, 0x00, 0x02, 
+  0x4e, 0x13, 0x6e, 0xe3, 0x97, 0xff, 0x8c, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x02, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0xa3, 
+  0x00, 0x00, 0x01, 0x4e, 0xa4, 0x72, 0xff, 0x8e, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x82, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x02, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0xa3, 0x00, 0x00, 0x01, 0x6e, 0x37, 
+  0x6e, 0xff, 0x93, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0xa4, 0x00, 0x00, 0x01, 0x6e, 0xab, 0x92, 0xff, 0x85, 0xff, 0xff, 0x82, 0xdb, 0xff, 0x00, 0xdf, 
+  0xff, 0x89, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0xf4, 0x6e, 0x40, 0xa4, 0x00, 0x00, 0x01, 0x6e, 0x0c, 0x6e, 0xf8, 0x85, 0xff, 0xff, 0x04, 0xdb, 0xff, 0xb7, 0xff, 0x92, 0xff, 0xb7, 
+  0xff, 0xbb, 0xff, 0x81, 0xdb, 0xff, 0x86, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x6e, 0x47, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x44, 0x6e, 0xff, 0x84, 0xff, 0xff, 0x08, 0xdb, 0xff, 
+  0x92, 0xff, 0x6e, 0xe8, 0x6e, 0xb3, 0x4e, 0xdc, 0x6e, 0xff, 0x72, 0xff, 0xbb, 0xff, 0xdb, 0xff, 0x86, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x34, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x70, 
+  0x72, 0xff, 0x83, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xbb, 0xff, 0x6e, 0xff, 0x4e, 0x30, 0x81, 0x00, 0x00, 0x04, 0x6e, 0x34, 0x6e, 0xaf, 0x6e, 0xff, 0x96, 0xff, 0xdb, 0xff, 0x85, 0xff, 0xff, 0x02, 
+  0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x63, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x88, 0x92, 0xff, 0x83, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x9c, 0x84, 0x00, 0x00, 0x03, 0x6e, 0x47, 0x6e, 0xe8, 
+  0x92, 0xff, 0xdb, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x83, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x8b, 0x96, 0xff, 0x82, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xf3, 
+  0x6e, 0x18, 0x85, 0x00, 0x00, 0x02, 0x4e, 0x20, 0x6e, 0xe7, 0x97, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x92, 0xff, 0x6e, 0x87, 0xa5, 0x00, 0x00, 0x01, 0x6e, 0x78, 0x92, 0xff, 0x82, 0xff, 
+  0xff, 0x02, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x7b, 0x87, 0x00, 0x00, 0x01, 0x6e, 0x68, 0x6e, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x72, 0xff, 0x6e, 0x73, 0xa5, 0x00, 0x00, 0x01, 0x4e, 0x53, 
+  0x6e, 0xff, 0x81, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x97, 0xff, 0x4e, 0xe0, 0x6e, 0x08, 0x87, 0x00, 0x00, 0x01, 0x6e, 0x9c, 0x92, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x4c, 
+  0xa5, 0x00, 0x00, 0x01, 0x6e, 0x17, 0x4e, 0xfc, 0x81, 0xff, 0xff, 0x02, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0x58, 0x87, 0x00, 0x00, 0x01, 0x6e, 0x30, 0x6e, 0xff, 0x85, 0xff, 0xff, 0x02, 0xbb, 0xff, 
+  0x4e, 0xfc, 0x4e, 0x13, 0xa6, 0x00, 0x00, 0x04, 0x6e, 0xac, 0x97, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0xc7, 0x88, 0x00, 0x00, 0x01, 0x6e, 0xbf, 0x96, 0xff, 0x84, 0xff, 0xff, 0x02, 0xdb, 0xff, 
+  0x92, 0xff, 0x6e, 0xbc, 0xa7, 0x00, 0x00, 0x04, 0x6e, 0x43, 0x6e, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6e, 0x37, 0x87, 0x00, 0x00, 0x01, 0x6e, 0x50, 0x6e, 0xff, 0x85, 0xff, 0xff, 0x02, 0xdb, 0xff, 
+  0x6e, 0xff, 0x6e, 0x50, 0xa8, 0x00, 0x00, 0x02, 0x6e, 0x88, 0x6e, 0xdf, 0x6e, 0x84, 0x87, 0x00, 0x00, 0x02, 0x4e, 0x07, 0x6e, 0xdc, 0xb7, 0xff, 0x84, 0xff, 0xff, 0x03, 0xdb, 0xff, 0x92, 0xff, 
+  0x6e, 0xc8, 0x92, 0x03, 0xb3, 0x00, 0x00, 0x01, 0x6e, 0x73, 0x6e, 0xff, 0x84, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xf7, 0x6e, 0x2b, 0xb3, 0x00, 0x00, 0x02, 0x6e, 0x14, 0x4e, 0xf0, 
+  0xdb, 0xff, 0x83, 0xff, 0xff, 0x03, 0xdb, 0xff, 0xb7, 0xff, 0x4e, 0xfc, 0x6e, 0x54, 0xb4, 0x00, 0x00, 0x01, 0x6e, 0x94, 0x72, 0xff, 0x82, 0xff, 0xff, 0x81, 0xdb, 0xff, 0x02, 0x92, 0xff, 0x4e, 
+  0xf8, 0x6e, 0x57, 0xb4, 0x00, 0x00, 0x01, 0x4e, 0x1c, 0x4e, 0xfc, 0x83, 0xdb, 0xff, 0x03, 0x97, 0xff, 0x6e, 0xff, 0x6e, 0xd3, 0x4e, 0x33, 0xb5, 0x00, 0x00, 0x01, 0x6e, 0x18, 0x4e, 0xf7, 0x81, 
+  0x72, 0xff, 0x81, 0x6e, 0xff, 0x02, 0x6e, 0xd3, 0x6e, 0x63, 0x52, 0x04, 0xb7, 0x00, 0x00, 0x04, 0x6e, 0x34, 0x6e, 0x94, 0x6e, 0x7c, 0x6e, 0x58, 0x6e, 0x2b, 0xff, 0x00, 0x00, 0xeb, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x53, 0x17, 0x0e, 0x53, 0x6c, 0x0e, 0x53, 0xa8, 0x0e, 0x53, 0xcc, 0x0e, 0x53, 0xec, 0x0e, 0x53, 0xaf, 0xee, 0x5a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x5b, 0x18, 0x0e, 0x53, 0x9b, 0xee, 0x52, 0xfb, 0x70, 0x63, 0xff, 0x36, 0x9d, 0xff, 0xf8, 0xbd, 0xff, 0x7a, 0xce, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x50, 0x0e, 0x53, 0xef, 0xf1, 0x73, 0xff, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xdf, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x70, 0x0f, 0x53, 0xff, 0xb8, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x5c, 0x0f, 0x53, 0xff, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xce, 0xff, 0x56, 0xa5, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x53, 0x27, 0x0e, 0x53, 0xf7, 0xf9, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x1c, 0xdf, 0xff, 0x39, 0xc6, 0xff, 0x4f, 0x63, 0xff, 0x0e, 0x53, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x03, 0x0e, 0x53, 0x37, 0x0e, 0x53, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0xbb, 0x73, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xd4, 0x94, 0xff, 0x0e, 0x53, 0xe7, 0x0f, 0x53, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x8f, 0x0e, 0x53, 0xff, 0xee, 0x52, 0xf4, 0x0f, 0x53, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x38, 0x0e, 0x53, 0xff, 0x3d, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbb, 0xd6, 0xff, 0xf8, 0xbd, 0xff, 0x0f, 0x5b, 0xff, 0x0e, 0x53, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x28, 0x0e, 0x53, 0xfc, 0x39, 0xc6, 0xff, 0x53, 0x84, 0xff, 0x0e, 0x53, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x9c, 0x73, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0x39, 0xc6, 0xff, 0x53, 0x7c, 0xff, 0x0e, 0x53, 0xcf, 0xab, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0xb4, 0x32, 0x7c, 0xff, 0xdf, 0xff, 0xff, 0x5a, 0xc6, 0xff, 0x0e, 0x53, 0xfb, 0x0f, 0x53, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0xe7, 0x39, 0xc6, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7a, 0xce, 0xff, 0x97, 0xad, 0xff, 0x0e, 0x53, 0xff, 0xee, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x47, 0x0e, 0x53, 0xff, 0xfc, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x9b, 0xd6, 0xff, 0x4f, 0x5b, 0xff, 0x0e, 0x53, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x53, 0x1c, 0x0e, 0x53, 0xff, 0x1d, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x53, 0x84, 0xff, 0x0e, 0x53, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0x04, 0x0e, 0x53, 0xd4, 0xd5, 0x94, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x39, 0xc6, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x3b, 0x0e, 0x53, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x73, 0x84, 0xff, 0x0e, 0x53, 0xcb, 0xab, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x68, 0x2f, 0x5b, 0xff, 0x3d, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3a, 0xc6, 0xff, 0xb4, 0x8c, 0xff, 0x0e, 0x53, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x44, 0x0e, 0x53, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5a, 0xce, 0xff, 0xb7, 0xad, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0x9c, 0x2d, 0x6b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x5b, 0x0f, 0x0e, 0x53, 0xeb, 0x77, 0xad, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xd5, 0x94, 0xff, 0x0e, 0x53, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x37, 0x0e, 0x53, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x19, 0xbe, 0xff, 0x77, 0xa5, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0xc8, 0x0e, 0x53, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x8b, 0x70, 0x63, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x39, 0xc6, 0xff, 0xb4, 0x8c, 0xff, 0xee, 0x52, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x10, 0x0e, 0x53, 0xff, 0xfc, 0xde, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0xb8, 0xad, 0xff, 0xf1, 0x73, 0xff, 0xee, 0x52, 0xfc, 0x0e, 0x53, 0xa8, 0xee, 0x52, 0x47, 0x2f, 0x5b, 0x0f, 0x0e, 0x53, 0x34, 0x0e, 0x53, 0xf8, 0x19, 0xbe, 0xff, 0x9e, 0xf7, 0xff, 0x5e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xf9, 0xbd, 0xff, 0x32, 0x7c, 0xff, 0xee, 0x52, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0xeb, 0x39, 0xc6, 0xff, 0x9e, 0xf7, 0xff, 0x1d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0x3a, 0xc6, 0xff, 0xd8, 0xb5, 0xff, 0x36, 0xa5, 0xff, 0xf1, 0x73, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x73, 0x84, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0xdc, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0x4f, 0x63, 0xff, 0x0e, 0x53, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0xfc, 0xde, 0xff, 0x7e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0xd8, 0xb5, 0xff, 0xb8, 0xb5, 0xff, 0xb8, 0xad, 0xff, 0x9b, 0xd6, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x5a, 0xc6, 0xff, 0x77, 0xa5, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0x1d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x7b, 0xce, 0xff, 0xbb, 0xd6, 0xff, 0x5e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0xdc, 0xde, 0xff, 0xd8, 0xb5, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xce, 0xff, 0x3a, 0xc6, 0xff, 0xbc, 0xd6, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xf9, 0xbd, 0xff, 0x56, 0xa5, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x77, 0xad, 0xff, 0xf9, 0xbd, 0xff, 0x9b, 0xce, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfd, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0x19, 0xbe, 0xff, 0x98, 0xad, 0xff, 0x70, 0x63, 0xff, 0x0e, 0x53, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xbc, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x77, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 0x7b, 0xce, 0xff, 0x1c, 0xdf, 0xff, 0x1d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xde, 0xff, 0xdc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xfc, 0xde, 0xff, 0xbc, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x97, 0xad, 0xff, 0xb1, 0x6b, 0xff, 0x0e, 0x53, 0xdc, 0x2e, 0x53, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7b, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xdc, 0xd6, 0xff, 0xbb, 0xd6, 0xff, 0xf9, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0xf8, 0xbd, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xdc, 0xd6, 0xff, 0xbb, 0xce, 0xff, 0x3a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x57, 0xa5, 0xff, 0x90, 0x63, 0xff, 0xee, 0x52, 0xe0, 0xee, 0x52, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xdc, 0xd6, 0xff, 0x9b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x56, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x98, 0xad, 0xff, 0x98, 0xad, 0xff, 0xd8, 0xb5, 0xff, 0xf9, 0xbd, 0xff, 0x19, 0xbe, 0xff, 0xf9, 0xb5, 0xff, 0xb8, 0xb5, 0xff, 0x97, 0xad, 0xff, 0x77, 0xa5, 0xff, 0x73, 0x84, 0xff, 0x0f, 0x5b, 0xff, 0x0e, 0x53, 0xbf, 0x0e, 0x5b, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5d, 0xef, 0xff, 0xbc, 0xd6, 0xff, 0x9b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x56, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xbd, 0xff, 0x77, 0xad, 0xff, 0x74, 0x84, 0xff, 0x53, 0x7c, 0xff, 0xd5, 0x8c, 0xff, 0x15, 0x9d, 0xff, 0x16, 0x9d, 0xff, 0xf5, 0x94, 0xff, 0x94, 0x8c, 0xff, 0xd1, 0x73, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xe4, 0x0e, 0x53, 0x64, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 0xce, 0xff, 0x5d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0x7b, 0xce, 0xff, 0xb8, 0xad, 0xff, 0x36, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xdc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0x77, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0xc0, 0x0e, 0x53, 0xef, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xfc, 0xee, 0x52, 0xdb, 0x0e, 0x53, 0xa0, 0xee, 0x52, 0x50, 0xb0, 0x5a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x36, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 0x3a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x7b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x52, 0x08, 0xee, 0x5a, 0x0f, 0xab, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xe7, 0xff, 0x7b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x36, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 0x3a, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0x5d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0xd8, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x16, 0x9d, 0xff, 0x97, 0xad, 0xff, 0x39, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x56, 0x9d, 0xff, 0x12, 0x74, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x15, 0x9d, 0xff, 0x97, 0xad, 0xff, 0x19, 0xbe, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x3a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x36, 0x9d, 0xff, 0x12, 0x74, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xbc, 0xd6, 0xff, 0x7b, 0xce, 0xff, 0x98, 0xad, 0xff, 0x15, 0x9d, 0xff, 0x97, 0xad, 0xff, 0x19, 0xbe, 0xff, 0x9b, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xb5, 0xff, 0x56, 0xa5, 0xff, 0x12, 0x74, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7b, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xdc, 0xd6, 0xff, 0x9b, 0xce, 0xff, 0xb8, 0xad, 0xff, 0xf5, 0x94, 0xff, 0x77, 0xad, 0xff, 0x19, 0xbe, 0xff, 0x9b, 0xce, 0xff, 0x1d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x7b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xdc, 0xde, 0xff, 0xbb, 0xd6, 0xff, 0xb8, 0xb5, 0xff, 0xf5, 0x94, 0xff, 0x77, 0xad, 0xff, 0xf9, 0xbd, 0xff, 0x9b, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0x77, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x28, 0x0e, 0x53, 0x53, 0x0e, 0x53, 0x67, 0x0e, 0x53, 0x67, 0x0e, 0x53, 0x4b, 0x0e, 0x53, 0x20, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0xb8, 0xb5, 0xff, 0xd5, 0x94, 0xff, 0x77, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x77, 0xad, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x27, 0x0e, 0x53, 0x93, 0xee, 0x52, 0xe8, 0x0e, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x70, 0x63, 0xff, 0x70, 0x63, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2f, 0x5b, 0xff, 0x9b, 0xd6, 0xff, 0x9e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0xd8, 0xb5, 0xff, 0xd5, 0x94, 0xff, 0x57, 0xa5, 0xff, 0xf8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x97, 0xad, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x5b, 0x0f, 0x0e, 0x53, 0x98, 0xee, 0x52, 0xfc, 0xf2, 0x73, 0xff, 0xf9, 0xbd, 0xff, 0x1d, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x1c, 0xdf, 0xff, 0x3d, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0xd8, 0xb5, 0xff, 0xd4, 0x94, 0xff, 0x56, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x5a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xdc, 0xde, 0xff, 0x3a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x2b, 0x0e, 0x53, 0xdf, 0xb1, 0x6b, 0xff, 0x9b, 0xce, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0xb4, 0x8c, 0xff, 0x56, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xdc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x2c, 0xee, 0x52, 0xec, 0x94, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0xb4, 0x8c, 0xff, 0x36, 0xa5, 0xff, 0xb8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xb5, 0xff, 0x33, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x52, 0x13, 0xee, 0x52, 0xe3, 0xb4, 0x8c, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x36, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 0x3a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x7a, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x53, 0x7c, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0xa4, 0xd1, 0x73, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5d, 0xe7, 0xff, 0xf9, 0xbd, 0xff, 0x3a, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x37, 0x0e, 0x53, 0xff, 0xfc, 0xde, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x5e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0xab, 0x94, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdc, 0xd6, 0xff, 0x5a, 0xc6, 0xff, 0x39, 0xc6, 0xff, 0x5a, 0xce, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x19, 0xbe, 0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x5b, 0x0c, 0xee, 0x52, 0xf8, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbb, 0xd6, 0xff, 0x39, 0xc6, 0xff, 0xf5, 0x94, 0xff, 0x93, 0x84, 0xff, 0xf5, 0x9c, 0xff, 0xd8, 0xb5, 0xff, 0x3a, 0xc6, 0xff, 0x9b, 0xce, 0xff, 0x5d, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbb, 0xd6, 0xff, 0x98, 0xad, 0xff, 0x0e, 0x53, 0xff, 0xee, 0x52, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x44, 0x0f, 0x53, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x12, 0x7c, 0xff, 0xee, 0x52, 0xe8, 0x0e, 0x53, 0xb3, 0xee, 0x52, 0xdc, 0x0e, 0x53, 0xff, 0xf1, 0x73, 0xff, 0xb8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xfc, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x70, 0xd1, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd6, 0xff, 0x97, 0xad, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x34, 0x0e, 0x53, 0xaf, 0x0e, 0x53, 0xff, 0x94, 0x8c, 0xff, 0x39, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0x70, 0x63, 0xff, 0x0e, 0x53, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x88, 0x73, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x90, 0x6b, 0xff, 0x0e, 0x53, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x47, 0x0e, 0x53, 0xe8, 0xf2, 0x73, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xf1, 0x73, 0xff, 0x0e, 0x53, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x8b, 0x94, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xce, 0xff, 0x36, 0xa5, 0xff, 0x0e, 0x53, 0xf3, 0x0e, 0x5b, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x20, 0x0e, 0x53, 0xe7, 0xb4, 0x8c, 0xff, 0xdc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xf1, 0x73, 0xff, 0x0e, 0x53, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x78, 0x12, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0x3a, 0xc6, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x68, 0x2f, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x7a, 0xce, 0xff, 0x90, 0x6b, 0xff, 0x0e, 0x53, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x53, 0x2f, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7a, 0xce, 0xff, 0xb4, 0x8c, 0xff, 0x0e, 0x53, 0xe0, 0xae, 0x52, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x9c, 0x12, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x17, 0x0e, 0x53, 0xfc, 0xfc, 0xde, 0xff, 0xbf, 0xf7, 0xff, 0x19, 0xbe, 0xff, 0x0f, 0x53, 0xff, 0x0e, 0x53, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0x30, 0x0e, 0x53, 0xff, 0xdc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xde, 0xff, 0xb8, 0xb5, 0xff, 0xee, 0x52, 0xfc, 0xef, 0x52, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x52, 0xac, 0xb4, 0x94, 0xff, 0x9e, 0xf7, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0xbf, 0x94, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7a, 0xce, 0xff, 0x73, 0x84, 0xff, 0xee, 0x52, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x43, 0x0f, 0x53, 0xff, 0x56, 0xa5, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x50, 0x0f, 0x53, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xde, 0xff, 0x19, 0xbe, 0xff, 0x0e, 0x53, 0xff, 0xee, 0x52, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x88, 0x0e, 0x53, 0xdf, 0x0e, 0x53, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x4b, 0x07, 0x0e, 0x53, 0xdc, 0x56, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xe7, 0xff, 0x7a, 0xce, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xc8, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x73, 0x4f, 0x5b, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0xd5, 0x94, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x14, 0xee, 0x52, 0xf0, 0x19, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xce, 0xff, 0xf5, 0x94, 0xff, 0xee, 0x52, 0xfc, 0x0e, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x94, 0xd1, 0x6b, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xce, 0xff, 0x39, 0xc6, 0xff, 0x33, 0x7c, 0xff, 0x0e, 0x53, 0xf8, 0x0e, 0x53, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x1c, 0x0e, 0x53, 0xfc, 0xf8, 0xbd, 0xff, 0x7a, 0xce, 0xff, 0x7a, 0xce, 0xff, 0xf9, 0xbd, 0xff, 0xb4, 0x94, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0xd3, 0x0e, 0x53, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x5b, 0x18, 0x0e, 0x53, 0xf7, 0xd1, 0x73, 0xff, 0xb1, 0x6b, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xd3, 0x0e, 0x53, 0x63, 0x10, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x34, 0x0e, 0x53, 0x94, 0x0e, 0x53, 0x7c, 0x0e, 0x53, 0x58, 0x0e, 0x53, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x06, 0x2e, 0x53, 0x17, 0x0e, 0x53, 0x6c, 0x0e, 0x53, 0xa8, 0x0e, 0x53, 0xcc, 0x0e, 0x53, 0xec, 0x0e, 0x53, 0xaf, 0xee, 
+  0x5a, 0x0b, 0xb6, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x5b, 0x18, 0x0e, 0x53, 0x9b, 0xee, 0x52, 0xfb, 0x70, 0x63, 0xff, 0x36, 0x9d, 0xff, 0xf8, 0xbd, 0xff, 0x7a, 0xce, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 
+  0x53, 0x6b, 0xb5, 0x00, 0x00, 0x00, 0x03, 0xee, 0x52, 0x50, 0x0e, 0x53, 0xef, 0xf1, 0x73, 0xff, 0xbb, 0xd6, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x1c, 0xdf, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 
+  0x37, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x70, 0x0f, 0x53, 0xff, 0xb8, 0xb5, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0x7e, 0xf7, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xa7, 0xb4, 0x00, 0x00, 
+  0x00, 0x02, 0x0e, 0x53, 0x5c, 0x0f, 0x53, 0xff, 0x7a, 0xce, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xff, 0x7b, 0xce, 0xff, 0x56, 0xa5, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x1f, 0xb3, 
+  0x00, 0x00, 0x00, 0x03, 0x0f, 0x53, 0x27, 0x0e, 0x53, 0xf7, 0xf9, 0xbd, 0xff, 0xff, 0xff, 0xff, 0x82, 0xdf, 0xff, 0xff, 0x03, 0x1c, 0xdf, 0xff, 0x39, 0xc6, 0xff, 0x4f, 0x63, 0xff, 0x0e, 0x53, 
+  0x84, 0x87, 0x00, 0x00, 0x00, 0x02, 0x10, 0x84, 0x03, 0x0e, 0x53, 0x37, 0x0e, 0x53, 0x10, 0xa9, 0x00, 0x00, 0x00, 0x01, 0xee, 0x52, 0xbb, 0x73, 0x84, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x06, 0xbf, 
+  0xff, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xd4, 0x94, 0xff, 0x0e, 0x53, 0xe7, 0x0f, 0x53, 0x0c, 0x87, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x8f, 0x0e, 0x53, 0xff, 0xee, 
+  0x52, 0xf4, 0x0f, 0x53, 0x33, 0xa7, 0x00, 0x00, 0x00, 0x03, 0xee, 0x52, 0x38, 0x0e, 0x53, 0xff, 0x3d, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0x82, 0xbf, 0xf7, 0xff, 0x03, 0xbb, 0xd6, 0xff, 0xf8, 0xbd, 
+  0xff, 0x0f, 0x5b, 0xff, 0x0e, 0x53, 0x63, 0x87, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0x28, 0x0e, 0x53, 0xfc, 0x39, 0xc6, 0xff, 0x53, 0x84, 0xff, 0x0e, 0x53, 0xa8, 0xa7, 0x00, 0x00, 0x00, 0x0a, 
+  0xee, 0x52, 0x9c, 0x73, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0x39, 0xc6, 0xff, 0x53, 0x7c, 0xff, 0x0e, 0x53, 0xcf, 0xab, 0x5a, 
+  0x03, 0x87, 0x00, 0x00, 0x00, 0x05, 0x0e, 0x53, 0xb4, 0x32, 0x7c, 0xff, 0xdf, 0xff, 0xff, 0x5a, 0xc6, 0xff, 0x0e, 0x53, 0xfb, 0x0f, 0x53, 0x1b, 0xa6, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0xe7, 
+  0x39, 0xc6, 0xff, 0xdf, 0xff, 0xff, 0x82, 0x9e, 0xf7, 0xff, 0x03, 0x7a, 0xce, 0xff, 0x97, 0xad, 0xff, 0x0e, 0x53, 0xff, 0xee, 0x52, 0x40, 0x87, 0x00, 0x00, 0x00, 0x06, 0xee, 0x52, 0x47, 0x0e, 
+  0x53, 0xff, 0xfc, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x9b, 0xd6, 0xff, 0x4f, 0x5b, 0xff, 0x0e, 0x53, 0x6b, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x2f, 0x53, 0x1c, 0x0e, 0x53, 0xff, 0x1d, 0xe7, 0xff, 0xbf, 
+  0xf7, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x03, 0x5e, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x53, 0x84, 0xff, 0x0e, 0x53, 0xb8, 0x87, 0x00, 0x00, 0x00, 0x07, 0x10, 0x44, 0x04, 0x0e, 0x53, 0xd4, 0xd5, 0x94, 
+  0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x39, 0xc6, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xa0, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x3b, 0x0e, 0x53, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xf7, 
+  0xff, 0x81, 0x7e, 0xef, 0xff, 0x04, 0x5d, 0xef, 0xff, 0x19, 0xbe, 0xff, 0x73, 0x84, 0xff, 0x0e, 0x53, 0xcb, 0xab, 0x5a, 0x03, 0x86, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x53, 0x68, 0x2f, 0x5b, 0xff, 
+  0x3d, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3a, 0xc6, 0xff, 0xb4, 0x8c, 0xff, 0x0e, 0x53, 0xc0, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x44, 0x0e, 0x53, 0xff, 0x9e, 0xf7, 0xff, 
+  0x7e, 0xef, 0xff, 0x82, 0x5e, 0xef, 0xff, 0x04, 0x5a, 0xce, 0xff, 0xb7, 0xad, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0x9c, 0x2d, 0x6b, 0x04, 0x84, 0x00, 0x00, 0x00, 0x03, 0x2f, 0x5b, 0x0f, 0x0e, 
+  0x53, 0xeb, 0x77, 0xad, 0xff, 0xbf, 0xf7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x02, 0x5a, 0xc6, 0xff, 0xd5, 0x94, 0xff, 0x0e, 0x53, 0xcb, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x53, 0x37, 0x0e, 0x53, 
+  0xff, 0x81, 0x7e, 0xef, 0xff, 0x82, 0x5d, 0xe7, 0xff, 0x05, 0x1d, 0xe7, 0xff, 0x19, 0xbe, 0xff, 0x77, 0xa5, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0xc8, 0x0e, 0x53, 0x2c, 0x83, 0x00, 0x00, 0x00, 
+  0x03, 0x0e, 0x53, 0x8b, 0x70, 0x63, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x02, 0x39, 0xc6, 0xff, 0xb4, 0x8c, 0xff, 0xee, 0x52, 0xc3, 0xa5, 0x00, 0x00, 0x00, 0x03, 
+  0x0e, 0x53, 0x10, 0x0e, 0x53, 0xff, 0xfc, 0xde, 0xff, 0x7e, 0xef, 0xff, 0x83, 0x3d, 0xe7, 0xff, 0x11, 0xfc, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0xb8, 0xad, 0xff, 0xf1, 0x73, 0xff, 0xee, 0x52, 0xfc, 
+  0x0e, 0x53, 0xa8, 0xee, 0x52, 0x47, 0x2f, 0x5b, 0x0f, 0x0e, 0x53, 0x34, 0x0e, 0x53, 0xf8, 0x19, 0xbe, 0xff, 0x9e, 0xf7, 0xff, 0x5e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xf9, 0xbd, 
+  0xff, 0x32, 0x7c, 0xff, 0xee, 0x52, 0xa4, 0xa6, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0xeb, 0x39, 0xc6, 0xff, 0x9e, 0xf7, 0xff, 0x1d, 0xe7, 0xff, 0x83, 0x3d, 0xe7, 0xff, 0x04, 0x1d, 0xdf, 0xff, 
+  0x3a, 0xc6, 0xff, 0xd8, 0xb5, 0xff, 0x36, 0xa5, 0xff, 0xf1, 0x73, 0xff, 0x82, 0x0e, 0x53, 0xff, 0x00, 0x73, 0x84, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x81, 0x5e, 0xef, 0xff, 0x03, 0xdc, 0xde, 0xff, 
+  0xf9, 0xbd, 0xff, 0x4f, 0x63, 0xff, 0x0e, 0x53, 0x73, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0xfc, 0xde, 0xff, 0x7e, 0xef, 0xff, 0x81, 0x1d, 0xdf, 0xff, 0x84, 0x1d, 
+  0xe7, 0xff, 0x05, 0xbb, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0xd8, 0xb5, 0xff, 0xb8, 0xb5, 0xff, 0xb8, 0xad, 0xff, 0x9b, 0xd6, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x82, 0x3d, 0xe7, 0xff, 0x03, 0x5a, 0xc6, 
+  0xff, 0x77, 0xa5, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x28, 0xa4, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xd6, 0xff, 0x9e, 0xf7, 0xff, 0x1d, 0xe7, 0xff, 0x81, 0xfc, 
+  0xde, 0xff, 0x85, 0x1d, 0xdf, 0xff, 0x04, 0x1d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x7b, 0xce, 0xff, 0xbb, 0xd6, 0xff, 0x5e, 0xef, 0xff, 0x83, 0x3d, 0xe7, 0xff, 0x03, 0xdc, 0xde, 0xff, 0xd8, 0xb5, 
+  0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xc7, 0xa4, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xce, 
+  0xff, 0x3a, 0xc6, 0xff, 0xbc, 0xd6, 0xff, 0x84, 0xfc, 0xde, 0xff, 0x85, 0x1d, 0xdf, 0xff, 0x81, 0x1d, 0xe7, 0xff, 0x04, 0x1d, 0xdf, 0xff, 0xf9, 0xbd, 0xff, 0x56, 0xa5, 0xff, 0x0e, 0x53, 0xff, 
+  0x0e, 0x53, 0x4c, 0xa3, 0x00, 0x00, 0x00, 0x09, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x77, 0xad, 0xff, 
+  0xf9, 0xbd, 0xff, 0x9b, 0xce, 0xff, 0x89, 0xfc, 0xde, 0xff, 0x06, 0xfd, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0x19, 0xbe, 0xff, 0x98, 0xad, 0xff, 0x70, 0x63, 0xff, 0x0e, 0x53, 0xaf, 
+  0xa3, 0x00, 0x00, 0x00, 0x0b, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xbc, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x77, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 
+  0x7b, 0xce, 0xff, 0x1c, 0xdf, 0xff, 0x1d, 0xe7, 0xff, 0x82, 0xdc, 0xd6, 0xff, 0x81, 0xdc, 0xde, 0xff, 0x84, 0xfc, 0xde, 0xff, 0x05, 0xbc, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x97, 0xad, 0xff, 0xb1, 
+  0x6b, 0xff, 0x0e, 0x53, 0xdc, 0x2e, 0x53, 0x13, 0xa2, 0x00, 0x00, 0x00, 0x0c, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7b, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xdc, 0xd6, 0xff, 0xbb, 0xd6, 0xff, 0xf9, 
+  0xb5, 0xff, 0x57, 0xa5, 0xff, 0xf8, 0xbd, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x87, 0xdc, 0xd6, 0xff, 0x06, 0xbb, 0xce, 0xff, 0x3a, 0xc6, 0xff, 0xb8, 
+  0xad, 0xff, 0x57, 0xa5, 0xff, 0x90, 0x63, 0xff, 0xee, 0x52, 0xe0, 0xee, 0x52, 0x23, 0xa2, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xdc, 
+  0xd6, 0xff, 0x9b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x56, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0x19, 0xbe, 0xff, 
+  0x81, 0x98, 0xad, 0xff, 0x0a, 0xd8, 0xb5, 0xff, 0xf9, 0xbd, 0xff, 0x19, 0xbe, 0xff, 0xf9, 0xb5, 0xff, 0xb8, 0xb5, 0xff, 0x97, 0xad, 0xff, 0x77, 0xa5, 0xff, 0x73, 0x84, 0xff, 0x0f, 0x5b, 0xff, 
+  0x0e, 0x53, 0xbf, 0x0e, 0x5b, 0x18, 0xa2, 0x00, 0x00, 0x00, 0x1b, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5d, 0xef, 0xff, 0xbc, 0xd6, 0xff, 0x9b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 
+  0x56, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xbd, 0xff, 0x77, 0xad, 0xff, 0x74, 0x84, 0xff, 0x53, 0x7c, 
+  0xff, 0xd5, 0x8c, 0xff, 0x15, 0x9d, 0xff, 0x16, 0x9d, 0xff, 0xf5, 0x94, 0xff, 0x94, 0x8c, 0xff, 0xd1, 0x73, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xe4, 0x0e, 0x53, 0x64, 0x10, 0x84, 0x03, 0xa2, 
+  0x00, 0x00, 0x00, 0x13, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 0xce, 0xff, 0x5d, 0xe7, 0xff, 0xbb, 0xd6, 0xff, 0x7b, 0xce, 0xff, 0xb8, 0xad, 0xff, 0x36, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x5a, 
+  0xc6, 0xff, 0xdc, 0xde, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0x77, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0xc0, 0x0e, 0x53, 0xef, 
+  0x81, 0x0e, 0x53, 0xff, 0x04, 0x0e, 0x53, 0xfc, 0xee, 0x52, 0xdb, 0x0e, 0x53, 0xa0, 0xee, 0x52, 0x50, 0xb0, 0x5a, 0x07, 0xa3, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 
+  0xc6, 0xff, 0x3d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x36, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 0x3a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x5e, 0xef, 0xff, 0xfc, 0xde, 0xff, 
+  0x7b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0x81, 0x00, 0x00, 0x00, 0x02, 0xae, 0x52, 0x08, 0xee, 0x5a, 0x0f, 0xab, 0x5a, 0x03, 
+  0xa6, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xe7, 0xff, 0x7b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x36, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 
+  0x3a, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0x5d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0xd8, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0xab, 0x00, 
+  0x00, 0x00, 0x12, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x5a, 0xc6, 0xff, 0x3d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x16, 0x9d, 0xff, 0x97, 0xad, 0xff, 0x39, 0xc6, 
+  0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x56, 0x9d, 0xff, 0x12, 0x74, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0xab, 0x00, 0x00, 0x00, 
+  0x12, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5d, 0xe7, 0xff, 0x9b, 0xce, 0xff, 0x5a, 0xc6, 0xff, 0x97, 0xad, 0xff, 0x15, 0x9d, 0xff, 0x97, 0xad, 0xff, 0x19, 0xbe, 0xff, 0xbb, 
+  0xd6, 0xff, 0x3d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x3a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x36, 0x9d, 0xff, 0x12, 0x74, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x43, 0xab, 0x00, 0x00, 0x00, 0x12, 0x0e, 
+  0x53, 0x94, 0x2f, 0x5b, 0xff, 0x7a, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xbc, 0xd6, 0xff, 0x7b, 0xce, 0xff, 0x98, 0xad, 0xff, 0x15, 0x9d, 0xff, 0x97, 0xad, 0xff, 0x19, 0xbe, 0xff, 0x9b, 0xd6, 0xff, 
+  0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xb5, 0xff, 0x56, 0xa5, 0xff, 0x12, 0x74, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0xab, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x53, 0x94, 
+  0x2f, 0x5b, 0xff, 0x7b, 0xce, 0xff, 0x5e, 0xef, 0xff, 0xdc, 0xd6, 0xff, 0x9b, 0xce, 0xff, 0xb8, 0xad, 0xff, 0xf5, 0x94, 0xff, 0x77, 0xad, 0xff, 0x19, 0xbe, 0xff, 0x9b, 0xce, 0xff, 0x1d, 0xe7, 
+  0xff, 0xfc, 0xde, 0xff, 0x7b, 0xce, 0xff, 0xd8, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0xab, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 
+  0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xdc, 0xde, 0xff, 0xbb, 0xd6, 0xff, 0xb8, 0xb5, 0xff, 0xf5, 0x94, 0xff, 0x77, 0xad, 0xff, 0xf9, 0xbd, 0xff, 0x9b, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 
+  0xde, 0xff, 0x9b, 0xce, 0xff, 0xf9, 0xb5, 0xff, 0x77, 0xa5, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x53, 0x28, 0x0e, 0x53, 0x53, 0x81, 
+  0x0e, 0x53, 0x67, 0x14, 0x0e, 0x53, 0x4b, 0x0e, 0x53, 0x20, 0x0e, 0x53, 0x94, 0x2f, 0x5b, 0xff, 0x9b, 0xce, 0xff, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 0xdc, 0xd6, 0xff, 0xb8, 0xb5, 0xff, 0xd5, 
+  0x94, 0xff, 0x77, 0xa5, 0xff, 0xf9, 0xbd, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x1d, 0xdf, 0xff, 0xbb, 0xd6, 0xff, 0xf9, 0xbd, 0xff, 0x77, 0xad, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 
+  0xee, 0x52, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x04, 0xee, 0x52, 0x27, 0x0e, 0x53, 0x93, 0xee, 0x52, 0xe8, 0x0e, 0x53, 0xff, 0x0f, 0x53, 0xff, 0x81, 0x70, 0x63, 0xff, 0x81, 0x0e, 0x53, 0xff, 0x11, 
+  0x2f, 0x5b, 0xff, 0x9b, 0xd6, 0xff, 0x9e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xfc, 0xde, 0xff, 0xd8, 0xb5, 0xff, 0xd5, 0x94, 0xff, 0x57, 0xa5, 0xff, 0xf8, 0xb5, 0xff, 0x7a, 0xce, 0xff, 0xfc, 0xde, 
+  0xff, 0x1d, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x19, 0xbe, 0xff, 0x97, 0xad, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0xee, 0x52, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x05, 0x2f, 0x5b, 0x0f, 0x0e, 0x53, 
+  0x98, 0xee, 0x52, 0xfc, 0xf2, 0x73, 0xff, 0xf9, 0xbd, 0xff, 0x1d, 0xe7, 0xff, 0x83, 0x9e, 0xf7, 0xff, 0x11, 0x1c, 0xdf, 0xff, 0x3d, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 
+  0xff, 0xd8, 0xb5, 0xff, 0xd4, 0x94, 0xff, 0x56, 0xa5, 0xff, 0xd8, 0xb5, 0xff, 0x5a, 0xce, 0xff, 0xfc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xdc, 0xde, 0xff, 0x3a, 0xc6, 0xff, 0x98, 0xad, 0xff, 0x32, 
+  0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x2b, 0x0e, 0x53, 0xdf, 0xb1, 0x6b, 0xff, 0x9b, 0xce, 0xff, 0x81, 0xbf, 0xf7, 0xff, 0x81, 0x7e, 0xef, 
+  0xff, 0x02, 0x5e, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5e, 0xef, 0xff, 0x81, 0x7e, 0xef, 0xff, 0x0e, 0x3d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0xd8, 0xb5, 0xff, 0xb4, 0x8c, 0xff, 0x56, 0xa5, 0xff, 0xd8, 
+  0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xdc, 0xde, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x5a, 0xc6, 0xff, 0xb8, 0xad, 0xff, 0x32, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x40, 0xa2, 0x00, 0x00, 
+  0x00, 0x05, 0x0e, 0x53, 0x2c, 0xee, 0x52, 0xec, 0x94, 0x8c, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x81, 0x5e, 0xef, 0xff, 0x00, 0x5d, 0xef, 0xff, 0x81, 0x5d, 0xe7, 0xff, 
+  0x83, 0x3d, 0xe7, 0xff, 0x0c, 0xbb, 0xd6, 0xff, 0xb4, 0x8c, 0xff, 0x36, 0xa5, 0xff, 0xb8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0x1d, 0xe7, 0xff, 0x5a, 0xc6, 0xff, 
+  0xb8, 0xb5, 0xff, 0x33, 0x7c, 0xff, 0x0e, 0x53, 0xf7, 0x0e, 0x53, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x02, 0xef, 0x52, 0x13, 0xee, 0x52, 0xe3, 0xb4, 0x8c, 0xff, 0x81, 0xbf, 0xf7, 0xff, 0x84, 0x7e, 
+  0xef, 0xff, 0x84, 0x5e, 0xef, 0xff, 0x0c, 0x5d, 0xef, 0xff, 0x9b, 0xce, 0xff, 0x36, 0x9d, 0xff, 0xb8, 0xb5, 0xff, 0x3a, 0xc6, 0xff, 0xdc, 0xd6, 0xff, 0x5d, 0xe7, 0xff, 0x3d, 0xe7, 0xff, 0x7a, 
+  0xce, 0xff, 0xd8, 0xb5, 0xff, 0x53, 0x7c, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x03, 0xee, 0x52, 0xa4, 0xd1, 0x73, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x82, 
+  0x9e, 0xf7, 0xff, 0x00, 0x9e, 0xef, 0xff, 0x87, 0x7e, 0xef, 0xff, 0x0a, 0x5d, 0xe7, 0xff, 0xf9, 0xbd, 0xff, 0x3a, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0x5d, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x9b, 0xce, 
+  0xff, 0xf9, 0xb5, 0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x37, 0x0e, 0x53, 0xff, 0xfc, 0xde, 0xff, 0xdf, 0xff, 0xff, 0x81, 0xbf, 
+  0xf7, 0xff, 0x00, 0x9f, 0xf7, 0xff, 0x86, 0x9e, 0xf7, 0xff, 0x83, 0x7e, 0xef, 0xff, 0x08, 0x5e, 0xef, 0xff, 0x3d, 0xe7, 0xff, 0x5e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xbb, 0xd6, 0xff, 0xf9, 0xbd, 
+  0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0xa4, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0xab, 0x94, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x81, 0xbf, 
+  0xf7, 0xff, 0x05, 0xdc, 0xd6, 0xff, 0x5a, 0xc6, 0xff, 0x39, 0xc6, 0xff, 0x5a, 0xce, 0xff, 0xbb, 0xd6, 0xff, 0x3d, 0xe7, 0xff, 0x86, 0x9e, 0xf7, 0xff, 0x05, 0x7e, 0xef, 0xff, 0xfc, 0xde, 0xff, 
+  0x19, 0xbe, 0xff, 0x53, 0x84, 0xff, 0xee, 0x52, 0xf4, 0x0e, 0x53, 0x40, 0xa4, 0x00, 0x00, 0x00, 0x03, 0x4d, 0x5b, 0x0c, 0xee, 0x52, 0xf8, 0xbb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x82, 0xdf, 0xff, 
+  0xff, 0x08, 0xbb, 0xd6, 0xff, 0x39, 0xc6, 0xff, 0xf5, 0x94, 0xff, 0x93, 0x84, 0xff, 0xf5, 0x9c, 0xff, 0xd8, 0xb5, 0xff, 0x3a, 0xc6, 0xff, 0x9b, 0xce, 0xff, 0x5d, 0xef, 0xff, 0x82, 0xbf, 0xf7, 
+  0xff, 0x00, 0x9f, 0xf7, 0xff, 0x81, 0x9e, 0xf7, 0xff, 0x03, 0xbb, 0xd6, 0xff, 0x98, 0xad, 0xff, 0x0e, 0x53, 0xff, 0xee, 0x52, 0x47, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x44, 0x0f, 0x53, 
+  0xff, 0xdf, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x0a, 0x5e, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x12, 0x7c, 0xff, 0xee, 0x52, 0xe8, 0x0e, 0x53, 0xb3, 0xee, 0x52, 0xdc, 0x0e, 0x53, 0xff, 0xf1, 0x73, 
+  0xff, 0xb8, 0xb5, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0x84, 0xbf, 0xf7, 0xff, 0x03, 0xfc, 0xde, 0xff, 0xf9, 0xbd, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x34, 0xa5, 0x00, 0x00, 0x00, 0x01, 
+  0x0e, 0x53, 0x70, 0xd1, 0x6b, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0x9b, 0xd6, 0xff, 0x97, 0xad, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x30, 0x81, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x53, 0x34, 0x0e, 
+  0x53, 0xaf, 0x0e, 0x53, 0xff, 0x94, 0x8c, 0xff, 0x39, 0xc6, 0xff, 0xbb, 0xd6, 0xff, 0xbf, 0xff, 0xff, 0x82, 0xdf, 0xff, 0xff, 0x03, 0x5d, 0xef, 0xff, 0x3a, 0xc6, 0xff, 0x70, 0x63, 0xff, 0x0e, 
+  0x53, 0x63, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x53, 0x88, 0x73, 0x8c, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0x5d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0x90, 0x6b, 0xff, 0x0e, 0x53, 0x9c, 0x84, 0x00, 
+  0x00, 0x00, 0x05, 0x0e, 0x53, 0x47, 0x0e, 0x53, 0xe8, 0xf2, 0x73, 0xff, 0x5a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 
+  0xf1, 0x73, 0xff, 0x0e, 0x53, 0x83, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x53, 0x8b, 0x94, 0x8c, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0x7a, 0xce, 0xff, 0x36, 0xa5, 0xff, 0x0e, 0x53, 0xf3, 0x0e, 
+  0x5b, 0x18, 0x85, 0x00, 0x00, 0x00, 0x03, 0x0e, 0x53, 0x20, 0x0e, 0x53, 0xe7, 0xb4, 0x8c, 0xff, 0xdc, 0xde, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xbf, 0xf7, 0xff, 0x5a, 0xc6, 0xff, 0xf1, 0x73, 
+  0xff, 0x0e, 0x53, 0x87, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x53, 0x78, 0x12, 0x74, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0x1c, 0xe7, 0xff, 0x3a, 0xc6, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0x7b, 
+  0x87, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x53, 0x68, 0x2f, 0x5b, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0xff, 0x7a, 0xce, 0xff, 0x90, 0x6b, 0xff, 0x0e, 0x53, 0x73, 0xa5, 0x00, 0x00, 0x00, 
+  0x07, 0x0e, 0x53, 0x53, 0x2f, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7a, 0xce, 0xff, 0xb4, 0x8c, 0xff, 0x0e, 0x53, 0xe0, 0xae, 0x52, 0x08, 0x87, 0x00, 0x00, 0x00, 0x01, 0xee, 0x52, 
+  0x9c, 0x12, 0x74, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0x5d, 0xef, 0xff, 0x5a, 0xc6, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x4c, 0xa5, 0x00, 0x00, 0x00, 0x06, 0xee, 0x52, 0x17, 0x0e, 0x53, 0xfc, 
+  0xfc, 0xde, 0xff, 0xbf, 0xf7, 0xff, 0x19, 0xbe, 0xff, 0x0f, 0x53, 0xff, 0x0e, 0x53, 0x58, 0x87, 0x00, 0x00, 0x00, 0x02, 0xee, 0x52, 0x30, 0x0e, 0x53, 0xff, 0xdc, 0xde, 0xff, 0x83, 0xff, 0xff, 
+  0xff, 0x03, 0xdc, 0xde, 0xff, 0xb8, 0xb5, 0xff, 0xee, 0x52, 0xfc, 0xef, 0x52, 0x13, 0xa6, 0x00, 0x00, 0x00, 0x04, 0xee, 0x52, 0xac, 0xb4, 0x94, 0xff, 0x9e, 0xf7, 0xff, 0x32, 0x7c, 0xff, 0x0e, 
+  0x53, 0xc7, 0x88, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x53, 0xbf, 0x94, 0x8c, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xbf, 0xff, 0xff, 0x7a, 0xce, 0xff, 0x73, 0x84, 0xff, 0xee, 0x52, 0xbc, 0xa7, 0x00, 
+  0x00, 0x00, 0x04, 0x0e, 0x53, 0x43, 0x0f, 0x53, 0xff, 0x56, 0xa5, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0x37, 0x87, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x50, 0x0f, 0x53, 0xff, 0x7e, 0xef, 0xff, 
+  0x83, 0xff, 0xff, 0xff, 0x03, 0xdc, 0xde, 0xff, 0x19, 0xbe, 0xff, 0x0e, 0x53, 0xff, 0xee, 0x52, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x88, 0x0e, 0x53, 0xdf, 0x0e, 0x53, 0x84, 0x87, 
+  0x00, 0x00, 0x00, 0x02, 0x6e, 0x4b, 0x07, 0x0e, 0x53, 0xdc, 0x56, 0xa5, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0x5d, 0xe7, 0xff, 0x7a, 0xce, 0xff, 0x12, 0x7c, 0xff, 0x0e, 0x53, 0xc8, 0x10, 0x84, 
+  0x03, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x73, 0x4f, 0x5b, 0xff, 0xbf, 0xf7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0x5d, 0xef, 0xff, 0x7a, 0xce, 0xff, 0xd5, 0x94, 0xff, 0x0e, 0x53, 0xf7, 
+  0xee, 0x52, 0x2b, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x14, 0xee, 0x52, 0xf0, 0x19, 0xc6, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xce, 0xff, 0xf5, 
+  0x94, 0xff, 0xee, 0x52, 0xfc, 0x0e, 0x53, 0x54, 0xb4, 0x00, 0x00, 0x00, 0x09, 0x0e, 0x53, 0x94, 0xd1, 0x6b, 0xff, 0xbf, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0xfc, 0xde, 0xff, 0x7a, 0xce, 0xff, 0x39, 
+  0xc6, 0xff, 0x33, 0x7c, 0xff, 0x0e, 0x53, 0xf8, 0x0e, 0x53, 0x57, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x53, 0x1c, 0x0e, 0x53, 0xfc, 0xf8, 0xbd, 0xff, 0x81, 0x7a, 0xce, 0xff, 0x04, 0xf9, 0xbd, 
+  0xff, 0xb4, 0x94, 0xff, 0x2f, 0x5b, 0xff, 0x0e, 0x53, 0xd3, 0x0e, 0x53, 0x33, 0xb5, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x5b, 0x18, 0x0e, 0x53, 0xf7, 0xd1, 0x73, 0xff, 0xb1, 0x6b, 0xff, 0x2f, 0x5b, 
+  0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xd3, 0x0e, 0x53, 0x63, 0x10, 0x44, 0x04, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x53, 0x34, 0x0e, 0x53, 0x94, 0x0e, 0x53, 0x7c, 0x0e, 0x53, 0x58, 0x0e, 0x53, 
+  0x2b, 0xff, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x2e, 0x17, 0x53, 0x0e, 0x6c, 0x53, 0x0e, 0xa8, 0x53, 0x0e, 0xcc, 0x53, 0x0e, 0xec, 0x53, 0x0e, 0xaf, 0x5a, 0xee, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x0e, 0x18, 0x53, 0x0e, 0x9b, 0x52, 0xee, 0xfb, 0x63, 0x70, 0xff, 0x9d, 0x36, 0xff, 0xbd, 0xf8, 0xff, 0xce, 0x7a, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x50, 0x53, 0x0e, 0xef, 0x73, 0xf1, 0xff, 0xd6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1c, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x70, 0x53, 0x0f, 0xff, 0xb5, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x5c, 0x53, 0x0f, 0xff, 0xce, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xce, 0x7b, 0xff, 0xa5, 0x56, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0f, 0x27, 0x53, 0x0e, 0xf7, 0xbd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0x1c, 0xff, 0xc6, 0x39, 0xff, 0x63, 0x4f, 0xff, 0x53, 0x0e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x03, 0x53, 0x0e, 0x37, 0x53, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0xbb, 0x84, 0x73, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x5a, 0xff, 0x94, 0xd4, 0xff, 0x53, 0x0e, 0xe7, 0x53, 0x0f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x8f, 0x53, 0x0e, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x38, 0x53, 0x0e, 0xff, 0xe7, 0x3d, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xd6, 0xbb, 0xff, 0xbd, 0xf8, 0xff, 0x5b, 0x0f, 0xff, 0x53, 0x0e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x28, 0x53, 0x0e, 0xfc, 0xc6, 0x39, 0xff, 0x84, 0x53, 0xff, 0x53, 0x0e, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x9c, 0x84, 0x73, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9f, 0xff, 0xe7, 0x3d, 0xff, 0xc6, 0x39, 0xff, 0x7c, 0x53, 0xff, 0x53, 0x0e, 0xcf, 0x5a, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0xb4, 0x7c, 0x32, 0xff, 0xff, 0xdf, 0xff, 0xc6, 0x5a, 0xff, 0x53, 0x0e, 0xfb, 0x53, 0x0f, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0xe7, 0xc6, 0x39, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xce, 0x7a, 0xff, 0xad, 0x97, 0xff, 0x53, 0x0e, 0xff, 0x52, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x47, 0x53, 0x0e, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xdf, 0xff, 0xd6, 0x9b, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x0e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x2f, 0x1c, 0x53, 0x0e, 0xff, 0xe7, 0x1d, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xbe, 0x19, 0xff, 0x84, 0x53, 0xff, 0x53, 0x0e, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10, 0x04, 0x53, 0x0e, 0xd4, 0x94, 0xd5, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x39, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x3b, 0x53, 0x0e, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5d, 0xff, 0xbe, 0x19, 0xff, 0x84, 0x73, 0xff, 0x53, 0x0e, 0xcb, 0x5a, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x68, 0x5b, 0x2f, 0xff, 0xe7, 0x3d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x3a, 0xff, 0x8c, 0xb4, 0xff, 0x53, 0x0e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x44, 0x53, 0x0e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xce, 0x5a, 0xff, 0xad, 0xb7, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0x9c, 0x6b, 0x2d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x2f, 0x0f, 0x53, 0x0e, 0xeb, 0xad, 0x77, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x5a, 0xff, 0x94, 0xd5, 0xff, 0x53, 0x0e, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x37, 0x53, 0x0e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x1d, 0xff, 0xbe, 0x19, 0xff, 0xa5, 0x77, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0xc8, 0x53, 0x0e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x8b, 0x63, 0x70, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xc6, 0x39, 0xff, 0x8c, 0xb4, 0xff, 0x52, 0xee, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x10, 0x53, 0x0e, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0xb8, 0xff, 0x73, 0xf1, 0xff, 0x52, 0xee, 0xfc, 0x53, 0x0e, 0xa8, 0x52, 0xee, 0x47, 0x5b, 0x2f, 0x0f, 0x53, 0x0e, 0x34, 0x53, 0x0e, 0xf8, 0xbe, 0x19, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5d, 0xff, 0xbd, 0xf9, 0xff, 0x7c, 0x32, 0xff, 0x52, 0xee, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0xeb, 0xc6, 0x39, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xc6, 0x3a, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x36, 0xff, 0x73, 0xf1, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x84, 0x73, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xdc, 0xff, 0xbd, 0xf9, 0xff, 0x63, 0x4f, 0xff, 0x53, 0x0e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xbe, 0x19, 0xff, 0xb5, 0xd8, 0xff, 0xb5, 0xb8, 0xff, 0xad, 0xb8, 0xff, 0xd6, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xc6, 0x5a, 0xff, 0xa5, 0x77, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xd6, 0x9b, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xce, 0x7b, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0xb5, 0xd8, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7a, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xbc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xe7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xbd, 0xf9, 0xff, 0xa5, 0x56, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0xad, 0x77, 0xff, 0xbd, 0xf9, 0xff, 0xce, 0x9b, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xbe, 0x19, 0xff, 0xad, 0x98, 0xff, 0x63, 0x70, 0xff, 0x53, 0x0e, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xbc, 0xff, 0xbd, 0xf9, 0xff, 0xa5, 0x77, 0xff, 0xbd, 0xf9, 0xff, 0xce, 0x7b, 0xff, 0xdf, 0x1c, 0xff, 0xe7, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xdc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xbc, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0x97, 0xff, 0x6b, 0xb1, 0xff, 0x53, 0x0e, 0xdc, 0x53, 0x2e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7b, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xbb, 0xff, 0xb5, 0xf9, 0xff, 0xa5, 0x57, 0xff, 0xbd, 0xf8, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xdc, 0xff, 0xce, 0xbb, 0xff, 0xc6, 0x3a, 0xff, 0xad, 0xb8, 0xff, 0xa5, 0x57, 0xff, 0x63, 0x90, 0xff, 0x52, 0xee, 0xe0, 0x52, 0xee, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xdc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x56, 0xff, 0xb5, 0xd8, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xbe, 0x19, 0xff, 0xad, 0x98, 0xff, 0xad, 0x98, 0xff, 0xb5, 0xd8, 0xff, 0xbd, 0xf9, 0xff, 0xbe, 0x19, 0xff, 0xb5, 0xf9, 0xff, 0xb5, 0xb8, 0xff, 0xad, 0x97, 0xff, 0xa5, 0x77, 0xff, 0x84, 0x73, 0xff, 0x5b, 0x0f, 0xff, 0x53, 0x0e, 0xbf, 0x5b, 0x0e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0xbc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x56, 0xff, 0xb5, 0xd8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0x77, 0xff, 0x84, 0x74, 0xff, 0x7c, 0x53, 0xff, 0x8c, 0xd5, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x16, 0xff, 0x94, 0xf5, 0xff, 0x8c, 0x94, 0xff, 0x73, 0xd1, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xe4, 0x53, 0x0e, 0x64, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x5a, 0xff, 0xe7, 0x5d, 0xff, 0xd6, 0xbb, 0xff, 0xce, 0x7b, 0xff, 0xad, 0xb8, 0xff, 0xa5, 0x36, 0xff, 0xb5, 0xd8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0xa5, 0x77, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0xc0, 0x53, 0x0e, 0xef, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xfc, 0x52, 0xee, 0xdb, 0x53, 0x0e, 0xa0, 0x52, 0xee, 0x50, 0x5a, 0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xc6, 0x5a, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x98, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xdc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7b, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x57, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xae, 0x08, 0x5a, 0xee, 0x0f, 0x5a, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xc6, 0x5a, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x5d, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x57, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xc6, 0x5a, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x16, 0xff, 0xad, 0x97, 0xff, 0xc6, 0x39, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xdc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0xb8, 0xff, 0x9d, 0x56, 0xff, 0x74, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xe7, 0x5d, 0xff, 0xce, 0x9b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x15, 0xff, 0xad, 0x97, 0xff, 0xbe, 0x19, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xdc, 0xff, 0xc6, 0x3a, 0xff, 0xad, 0xb8, 0xff, 0x9d, 0x36, 0xff, 0x74, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xbc, 0xff, 0xce, 0x7b, 0xff, 0xad, 0x98, 0xff, 0x9d, 0x15, 0xff, 0xad, 0x97, 0xff, 0xbe, 0x19, 0xff, 0xd6, 0x9b, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xb5, 0xb8, 0xff, 0xa5, 0x56, 0xff, 0x74, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7b, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xdc, 0xff, 0xce, 0x9b, 0xff, 0xad, 0xb8, 0xff, 0x94, 0xf5, 0xff, 0xad, 0x77, 0xff, 0xbe, 0x19, 0xff, 0xce, 0x9b, 0xff, 0xe7, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7b, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x57, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xdc, 0xff, 0xd6, 0xbb, 0xff, 0xb5, 0xb8, 0xff, 0x94, 0xf5, 0xff, 0xad, 0x77, 0xff, 0xbd, 0xf9, 0xff, 0xce, 0x9b, 0xff, 0xdf, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0xa5, 0x77, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x28, 0x53, 0x0e, 0x53, 0x53, 0x0e, 0x67, 0x53, 0x0e, 0x67, 0x53, 0x0e, 0x4b, 0x53, 0x0e, 0x20, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0xb5, 0xb8, 0xff, 0x94, 0xd5, 0xff, 0xa5, 0x77, 0xff, 0xbd, 0xf9, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0x77, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x27, 0x53, 0x0e, 0x93, 0x52, 0xee, 0xe8, 0x53, 0x0e, 0xff, 0x53, 0x0f, 0xff, 0x63, 0x70, 0xff, 0x63, 0x70, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x5b, 0x2f, 0xff, 0xd6, 0x9b, 0xff, 0xef, 0x9e, 0xff, 0xdf, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xb5, 0xd8, 0xff, 0x94, 0xd5, 0xff, 0xa5, 0x57, 0xff, 0xb5, 0xf8, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0xad, 0x97, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x2f, 0x0f, 0x53, 0x0e, 0x98, 0x52, 0xee, 0xfc, 0x73, 0xf2, 0xff, 0xbd, 0xf9, 0xff, 0xe7, 0x1d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xdf, 0x1c, 0xff, 0xe7, 0x3d, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xb5, 0xd8, 0xff, 0x94, 0xd4, 0xff, 0xa5, 0x56, 0xff, 0xb5, 0xd8, 0xff, 0xce, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0xc6, 0x3a, 0xff, 0xad, 0x98, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x2b, 0x53, 0x0e, 0xdf, 0x6b, 0xb1, 0xff, 0xce, 0x9b, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x1d, 0xff, 0xb5, 0xd8, 0xff, 0x8c, 0xb4, 0xff, 0xa5, 0x56, 0xff, 0xb5, 0xd8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xdc, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0xb8, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x2c, 0x52, 0xee, 0xec, 0x8c, 0x94, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xbb, 0xff, 0x8c, 0xb4, 0xff, 0xa5, 0x36, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x5a, 0xff, 0xd6, 0xdc, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x1d, 0xff, 0xc6, 0x5a, 0xff, 0xb5, 0xb8, 0xff, 0x7c, 0x33, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xef, 0x13, 0x52, 0xee, 0xe3, 0x8c, 0xb4, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x5d, 0xff, 0xce, 0x9b, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xdc, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7a, 0xff, 0xb5, 0xd8, 0xff, 0x7c, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0xa4, 0x73, 0xd1, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x5d, 0xff, 0xbd, 0xf9, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x37, 0x53, 0x0e, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5e, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xd6, 0xbb, 0xff, 0xbd, 0xf9, 0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0xab, 0x8c, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xd6, 0xdc, 0xff, 0xc6, 0x5a, 0xff, 0xc6, 0x39, 0xff, 0xce, 0x5a, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x3d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xbe, 0x19, 0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x4d, 0x0c, 0x52, 0xee, 0xf8, 0xd6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xd6, 0xbb, 0xff, 0xc6, 0x39, 0xff, 0x94, 0xf5, 0xff, 0x84, 0x93, 0xff, 0x9c, 0xf5, 0xff, 0xb5, 0xd8, 0xff, 0xc6, 0x3a, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xd6, 0xbb, 0xff, 0xad, 0x98, 0xff, 0x53, 0x0e, 0xff, 0x52, 0xee, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x44, 0x53, 0x0f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5e, 0xff, 0xc6, 0x5a, 0xff, 0x7c, 0x12, 0xff, 0x52, 0xee, 0xe8, 0x53, 0x0e, 0xb3, 0x52, 0xee, 0xdc, 0x53, 0x0e, 0xff, 0x73, 0xf1, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xde, 0xfc, 0xff, 0xbd, 0xf9, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x70, 0x6b, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9b, 0xff, 0xad, 0x97, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x34, 0x53, 0x0e, 0xaf, 0x53, 0x0e, 0xff, 0x8c, 0x94, 0xff, 0xc6, 0x39, 0xff, 0xd6, 0xbb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x5d, 0xff, 0xc6, 0x3a, 0xff, 0x63, 0x70, 0xff, 0x53, 0x0e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x88, 0x8c, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xce, 0x7a, 0xff, 0x6b, 0x90, 0xff, 0x53, 0x0e, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x47, 0x53, 0x0e, 0xe8, 0x73, 0xf2, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x5a, 0xff, 0x73, 0xf1, 0xff, 0x53, 0x0e, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x8b, 0x8c, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7a, 0xff, 0xa5, 0x36, 0xff, 0x53, 0x0e, 0xf3, 0x5b, 0x0e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x20, 0x53, 0x0e, 0xe7, 0x8c, 0xb4, 0xff, 0xde, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xc6, 0x5a, 0xff, 0x73, 0xf1, 0xff, 0x53, 0x0e, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x78, 0x74, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xff, 0xc6, 0x3a, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x68, 0x5b, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xce, 0x7a, 0xff, 0x6b, 0x90, 0xff, 0x53, 0x0e, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x53, 0x5b, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xce, 0x7a, 0xff, 0x8c, 0xb4, 0xff, 0x53, 0x0e, 0xe0, 0x52, 0xae, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x9c, 0x74, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xc6, 0x5a, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x17, 0x53, 0x0e, 0xfc, 0xde, 0xfc, 0xff, 0xf7, 0xbf, 0xff, 0xbe, 0x19, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0e, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0x30, 0x53, 0x0e, 0xff, 0xde, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdc, 0xff, 0xb5, 0xb8, 0xff, 0x52, 0xee, 0xfc, 0x52, 0xef, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0xac, 0x94, 0xb4, 0xff, 0xf7, 0x9e, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0xbf, 0x8c, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xce, 0x7a, 0xff, 0x84, 0x73, 0xff, 0x52, 0xee, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x43, 0x53, 0x0f, 0xff, 0xa5, 0x56, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x50, 0x53, 0x0f, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0x53, 0x0e, 0xff, 0x52, 0xee, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x88, 0x53, 0x0e, 0xdf, 0x53, 0x0e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6e, 0x07, 0x53, 0x0e, 0xdc, 0xa5, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5d, 0xff, 0xce, 0x7a, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xc8, 0x84, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x73, 0x5b, 0x4f, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0xce, 0x7a, 0xff, 0x94, 0xd5, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x14, 0x52, 0xee, 0xf0, 0xc6, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7a, 0xff, 0x94, 0xf5, 0xff, 0x52, 0xee, 0xfc, 0x53, 0x0e, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x94, 0x6b, 0xd1, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7a, 0xff, 0xc6, 0x39, 0xff, 0x7c, 0x33, 0xff, 0x53, 0x0e, 0xf8, 0x53, 0x0e, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x1c, 0x53, 0x0e, 0xfc, 0xbd, 0xf8, 0xff, 0xce, 0x7a, 0xff, 0xce, 0x7a, 0xff, 0xbd, 0xf9, 0xff, 0x94, 0xb4, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0xd3, 0x53, 0x0e, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x0e, 0x18, 0x53, 0x0e, 0xf7, 0x73, 0xd1, 0xff, 0x6b, 0xb1, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xd3, 0x53, 0x0e, 0x63, 0x44, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x34, 0x53, 0x0e, 0x94, 0x53, 0x0e, 0x7c, 0x53, 0x0e, 0x58, 0x53, 0x0e, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x06, 0x53, 0x2e, 0x17, 0x53, 0x0e, 0x6c, 0x53, 0x0e, 0xa8, 0x53, 0x0e, 0xcc, 0x53, 0x0e, 0xec, 0x53, 0x0e, 0xaf, 0x5a, 
+  0xee, 0x0b, 0xb6, 0x00, 0x00, 0x00, 0x08, 0x5b, 0x0e, 0x18, 0x53, 0x0e, 0x9b, 0x52, 0xee, 0xfb, 0x63, 0x70, 0xff, 0x9d, 0x36, 0xff, 0xbd, 0xf8, 0xff, 0xce, 0x7a, 0xff, 0x5b, 0x2f, 0xff, 0x53, 
+  0x0e, 0x6b, 0xb5, 0x00, 0x00, 0x00, 0x03, 0x52, 0xee, 0x50, 0x53, 0x0e, 0xef, 0x73, 0xf1, 0xff, 0xd6, 0xbb, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xdf, 0x1c, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 
+  0x37, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x70, 0x53, 0x0f, 0xff, 0xb5, 0xb8, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xf7, 0x7e, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xa7, 0xb4, 0x00, 0x00, 
+  0x00, 0x02, 0x53, 0x0e, 0x5c, 0x53, 0x0f, 0xff, 0xce, 0x7a, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xff, 0xce, 0x7b, 0xff, 0xa5, 0x56, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x1f, 0xb3, 
+  0x00, 0x00, 0x00, 0x03, 0x53, 0x0f, 0x27, 0x53, 0x0e, 0xf7, 0xbd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0x03, 0xdf, 0x1c, 0xff, 0xc6, 0x39, 0xff, 0x63, 0x4f, 0xff, 0x53, 0x0e, 
+  0x84, 0x87, 0x00, 0x00, 0x00, 0x02, 0x84, 0x10, 0x03, 0x53, 0x0e, 0x37, 0x53, 0x0e, 0x10, 0xa9, 0x00, 0x00, 0x00, 0x01, 0x52, 0xee, 0xbb, 0x84, 0x73, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x06, 0xff, 
+  0xbf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x5a, 0xff, 0x94, 0xd4, 0xff, 0x53, 0x0e, 0xe7, 0x53, 0x0f, 0x0c, 0x87, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x8f, 0x53, 0x0e, 0xff, 0x52, 
+  0xee, 0xf4, 0x53, 0x0f, 0x33, 0xa7, 0x00, 0x00, 0x00, 0x03, 0x52, 0xee, 0x38, 0x53, 0x0e, 0xff, 0xe7, 0x3d, 0xff, 0xff, 0xdf, 0xff, 0x82, 0xf7, 0xbf, 0xff, 0x03, 0xd6, 0xbb, 0xff, 0xbd, 0xf8, 
+  0xff, 0x5b, 0x0f, 0xff, 0x53, 0x0e, 0x63, 0x87, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0x28, 0x53, 0x0e, 0xfc, 0xc6, 0x39, 0xff, 0x84, 0x53, 0xff, 0x53, 0x0e, 0xa8, 0xa7, 0x00, 0x00, 0x00, 0x0a, 
+  0x52, 0xee, 0x9c, 0x84, 0x73, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9f, 0xff, 0xe7, 0x3d, 0xff, 0xc6, 0x39, 0xff, 0x7c, 0x53, 0xff, 0x53, 0x0e, 0xcf, 0x5a, 0xab, 
+  0x03, 0x87, 0x00, 0x00, 0x00, 0x05, 0x53, 0x0e, 0xb4, 0x7c, 0x32, 0xff, 0xff, 0xdf, 0xff, 0xc6, 0x5a, 0xff, 0x53, 0x0e, 0xfb, 0x53, 0x0f, 0x1b, 0xa6, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0xe7, 
+  0xc6, 0x39, 0xff, 0xff, 0xdf, 0xff, 0x82, 0xf7, 0x9e, 0xff, 0x03, 0xce, 0x7a, 0xff, 0xad, 0x97, 0xff, 0x53, 0x0e, 0xff, 0x52, 0xee, 0x40, 0x87, 0x00, 0x00, 0x00, 0x06, 0x52, 0xee, 0x47, 0x53, 
+  0x0e, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xdf, 0xff, 0xd6, 0x9b, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x0e, 0x6b, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x53, 0x2f, 0x1c, 0x53, 0x0e, 0xff, 0xe7, 0x1d, 0xff, 0xf7, 
+  0xbf, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x03, 0xef, 0x5e, 0xff, 0xbe, 0x19, 0xff, 0x84, 0x53, 0xff, 0x53, 0x0e, 0xb8, 0x87, 0x00, 0x00, 0x00, 0x07, 0x44, 0x10, 0x04, 0x53, 0x0e, 0xd4, 0x94, 0xd5, 
+  0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x39, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xa0, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x3b, 0x53, 0x0e, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0x9e, 
+  0xff, 0x81, 0xef, 0x7e, 0xff, 0x04, 0xef, 0x5d, 0xff, 0xbe, 0x19, 0xff, 0x84, 0x73, 0xff, 0x53, 0x0e, 0xcb, 0x5a, 0xab, 0x03, 0x86, 0x00, 0x00, 0x00, 0x07, 0x53, 0x0e, 0x68, 0x5b, 0x2f, 0xff, 
+  0xe7, 0x3d, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9e, 0xff, 0xc6, 0x3a, 0xff, 0x8c, 0xb4, 0xff, 0x53, 0x0e, 0xc0, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x44, 0x53, 0x0e, 0xff, 0xf7, 0x9e, 0xff, 
+  0xef, 0x7e, 0xff, 0x82, 0xef, 0x5e, 0xff, 0x04, 0xce, 0x5a, 0xff, 0xad, 0xb7, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0x9c, 0x6b, 0x2d, 0x04, 0x84, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x2f, 0x0f, 0x53, 
+  0x0e, 0xeb, 0xad, 0x77, 0xff, 0xf7, 0xbf, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x02, 0xc6, 0x5a, 0xff, 0x94, 0xd5, 0xff, 0x53, 0x0e, 0xcb, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x53, 0x0e, 0x37, 0x53, 0x0e, 
+  0xff, 0x81, 0xef, 0x7e, 0xff, 0x82, 0xe7, 0x5d, 0xff, 0x05, 0xe7, 0x1d, 0xff, 0xbe, 0x19, 0xff, 0xa5, 0x77, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0xc8, 0x53, 0x0e, 0x2c, 0x83, 0x00, 0x00, 0x00, 
+  0x03, 0x53, 0x0e, 0x8b, 0x63, 0x70, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x02, 0xc6, 0x39, 0xff, 0x8c, 0xb4, 0xff, 0x52, 0xee, 0xc3, 0xa5, 0x00, 0x00, 0x00, 0x03, 
+  0x53, 0x0e, 0x10, 0x53, 0x0e, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x7e, 0xff, 0x83, 0xe7, 0x3d, 0xff, 0x11, 0xde, 0xfc, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0xb8, 0xff, 0x73, 0xf1, 0xff, 0x52, 0xee, 0xfc, 
+  0x53, 0x0e, 0xa8, 0x52, 0xee, 0x47, 0x5b, 0x2f, 0x0f, 0x53, 0x0e, 0x34, 0x53, 0x0e, 0xf8, 0xbe, 0x19, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x5d, 0xff, 0xbd, 0xf9, 
+  0xff, 0x7c, 0x32, 0xff, 0x52, 0xee, 0xa4, 0xa6, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0xeb, 0xc6, 0x39, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x1d, 0xff, 0x83, 0xe7, 0x3d, 0xff, 0x04, 0xdf, 0x1d, 0xff, 
+  0xc6, 0x3a, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x36, 0xff, 0x73, 0xf1, 0xff, 0x82, 0x53, 0x0e, 0xff, 0x00, 0x84, 0x73, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x81, 0xef, 0x5e, 0xff, 0x03, 0xde, 0xdc, 0xff, 
+  0xbd, 0xf9, 0xff, 0x63, 0x4f, 0xff, 0x53, 0x0e, 0x73, 0xa5, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x7e, 0xff, 0x81, 0xdf, 0x1d, 0xff, 0x84, 0xe7, 
+  0x1d, 0xff, 0x05, 0xd6, 0xbb, 0xff, 0xbe, 0x19, 0xff, 0xb5, 0xd8, 0xff, 0xb5, 0xb8, 0xff, 0xad, 0xb8, 0xff, 0xd6, 0x9b, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x82, 0xe7, 0x3d, 0xff, 0x03, 0xc6, 0x5a, 
+  0xff, 0xa5, 0x77, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x28, 0xa4, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xd6, 0x9b, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x1d, 0xff, 0x81, 0xde, 
+  0xfc, 0xff, 0x85, 0xdf, 0x1d, 0xff, 0x04, 0xe7, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xce, 0x7b, 0xff, 0xd6, 0xbb, 0xff, 0xef, 0x5e, 0xff, 0x83, 0xe7, 0x3d, 0xff, 0x03, 0xde, 0xdc, 0xff, 0xb5, 0xd8, 
+  0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xc7, 0xa4, 0x00, 0x00, 0x00, 0x08, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7a, 
+  0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xbc, 0xff, 0x84, 0xde, 0xfc, 0xff, 0x85, 0xdf, 0x1d, 0xff, 0x81, 0xe7, 0x1d, 0xff, 0x04, 0xdf, 0x1d, 0xff, 0xbd, 0xf9, 0xff, 0xa5, 0x56, 0xff, 0x53, 0x0e, 0xff, 
+  0x53, 0x0e, 0x4c, 0xa3, 0x00, 0x00, 0x00, 0x09, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0xad, 0x77, 0xff, 
+  0xbd, 0xf9, 0xff, 0xce, 0x9b, 0xff, 0x89, 0xde, 0xfc, 0xff, 0x06, 0xde, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xbe, 0x19, 0xff, 0xad, 0x98, 0xff, 0x63, 0x70, 0xff, 0x53, 0x0e, 0xaf, 
+  0xa3, 0x00, 0x00, 0x00, 0x0b, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xbc, 0xff, 0xbd, 0xf9, 0xff, 0xa5, 0x77, 0xff, 0xbd, 0xf9, 0xff, 
+  0xce, 0x7b, 0xff, 0xdf, 0x1c, 0xff, 0xe7, 0x1d, 0xff, 0x82, 0xd6, 0xdc, 0xff, 0x81, 0xde, 0xdc, 0xff, 0x84, 0xde, 0xfc, 0xff, 0x05, 0xd6, 0xbc, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0x97, 0xff, 0x6b, 
+  0xb1, 0xff, 0x53, 0x0e, 0xdc, 0x53, 0x2e, 0x13, 0xa2, 0x00, 0x00, 0x00, 0x0c, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7b, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xdc, 0xff, 0xd6, 0xbb, 0xff, 0xb5, 
+  0xf9, 0xff, 0xa5, 0x57, 0xff, 0xbd, 0xf8, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 0x87, 0xd6, 0xdc, 0xff, 0x06, 0xce, 0xbb, 0xff, 0xc6, 0x3a, 0xff, 0xad, 
+  0xb8, 0xff, 0xa5, 0x57, 0xff, 0x63, 0x90, 0xff, 0x52, 0xee, 0xe0, 0x52, 0xee, 0x23, 0xa2, 0x00, 0x00, 0x00, 0x0e, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x5e, 0xff, 0xd6, 
+  0xdc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x56, 0xff, 0xb5, 0xd8, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xbe, 0x19, 0xff, 
+  0x81, 0xad, 0x98, 0xff, 0x0a, 0xb5, 0xd8, 0xff, 0xbd, 0xf9, 0xff, 0xbe, 0x19, 0xff, 0xb5, 0xf9, 0xff, 0xb5, 0xb8, 0xff, 0xad, 0x97, 0xff, 0xa5, 0x77, 0xff, 0x84, 0x73, 0xff, 0x5b, 0x0f, 0xff, 
+  0x53, 0x0e, 0xbf, 0x5b, 0x0e, 0x18, 0xa2, 0x00, 0x00, 0x00, 0x1b, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0xbc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xd8, 0xff, 
+  0xa5, 0x56, 0xff, 0xb5, 0xd8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0x77, 0xff, 0x84, 0x74, 0xff, 0x7c, 0x53, 
+  0xff, 0x8c, 0xd5, 0xff, 0x9d, 0x15, 0xff, 0x9d, 0x16, 0xff, 0x94, 0xf5, 0xff, 0x8c, 0x94, 0xff, 0x73, 0xd1, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xe4, 0x53, 0x0e, 0x64, 0x84, 0x10, 0x03, 0xa2, 
+  0x00, 0x00, 0x00, 0x13, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x5a, 0xff, 0xe7, 0x5d, 0xff, 0xd6, 0xbb, 0xff, 0xce, 0x7b, 0xff, 0xad, 0xb8, 0xff, 0xa5, 0x36, 0xff, 0xb5, 0xd8, 0xff, 0xc6, 
+  0x5a, 0xff, 0xde, 0xdc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0xa5, 0x77, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0xc0, 0x53, 0x0e, 0xef, 
+  0x81, 0x53, 0x0e, 0xff, 0x04, 0x53, 0x0e, 0xfc, 0x52, 0xee, 0xdb, 0x53, 0x0e, 0xa0, 0x52, 0xee, 0x50, 0x5a, 0xb0, 0x07, 0xa3, 0x00, 0x00, 0x00, 0x12, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xc6, 
+  0x5a, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x98, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xdc, 0xff, 0xef, 0x5e, 0xff, 0xde, 0xfc, 0xff, 
+  0xce, 0x7b, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x57, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0x81, 0x00, 0x00, 0x00, 0x02, 0x52, 0xae, 0x08, 0x5a, 0xee, 0x0f, 0x5a, 0xab, 0x03, 
+  0xa6, 0x00, 0x00, 0x00, 0x12, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xc6, 0x5a, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x7b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xb8, 0xff, 
+  0xc6, 0x3a, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x5d, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x57, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0xab, 0x00, 
+  0x00, 0x00, 0x12, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xc6, 0x5a, 0xff, 0xe7, 0x3d, 0xff, 0xce, 0x9b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x16, 0xff, 0xad, 0x97, 0xff, 0xc6, 0x39, 
+  0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xdc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0xb8, 0xff, 0x9d, 0x56, 0xff, 0x74, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0xab, 0x00, 0x00, 0x00, 
+  0x12, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xe7, 0x5d, 0xff, 0xce, 0x9b, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0x97, 0xff, 0x9d, 0x15, 0xff, 0xad, 0x97, 0xff, 0xbe, 0x19, 0xff, 0xd6, 
+  0xbb, 0xff, 0xe7, 0x3d, 0xff, 0xd6, 0xdc, 0xff, 0xc6, 0x3a, 0xff, 0xad, 0xb8, 0xff, 0x9d, 0x36, 0xff, 0x74, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x43, 0xab, 0x00, 0x00, 0x00, 0x12, 0x53, 
+  0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x7a, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xbc, 0xff, 0xce, 0x7b, 0xff, 0xad, 0x98, 0xff, 0x9d, 0x15, 0xff, 0xad, 0x97, 0xff, 0xbe, 0x19, 0xff, 0xd6, 0x9b, 0xff, 
+  0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xb5, 0xb8, 0xff, 0xa5, 0x56, 0xff, 0x74, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0xab, 0x00, 0x00, 0x00, 0x12, 0x53, 0x0e, 0x94, 
+  0x5b, 0x2f, 0xff, 0xce, 0x7b, 0xff, 0xef, 0x5e, 0xff, 0xd6, 0xdc, 0xff, 0xce, 0x9b, 0xff, 0xad, 0xb8, 0xff, 0x94, 0xf5, 0xff, 0xad, 0x77, 0xff, 0xbe, 0x19, 0xff, 0xce, 0x9b, 0xff, 0xe7, 0x1d, 
+  0xff, 0xde, 0xfc, 0xff, 0xce, 0x7b, 0xff, 0xb5, 0xd8, 0xff, 0xa5, 0x57, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0xab, 0x00, 0x00, 0x00, 0x12, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 
+  0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xdc, 0xff, 0xd6, 0xbb, 0xff, 0xb5, 0xb8, 0xff, 0x94, 0xf5, 0xff, 0xad, 0x77, 0xff, 0xbd, 0xf9, 0xff, 0xce, 0x9b, 0xff, 0xdf, 0x1d, 0xff, 0xde, 
+  0xfc, 0xff, 0xce, 0x9b, 0xff, 0xb5, 0xf9, 0xff, 0xa5, 0x77, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x53, 0x0e, 0x28, 0x53, 0x0e, 0x53, 0x81, 
+  0x53, 0x0e, 0x67, 0x14, 0x53, 0x0e, 0x4b, 0x53, 0x0e, 0x20, 0x53, 0x0e, 0x94, 0x5b, 0x2f, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 0xd6, 0xdc, 0xff, 0xb5, 0xb8, 0xff, 0x94, 
+  0xd5, 0xff, 0xa5, 0x77, 0xff, 0xbd, 0xf9, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xbb, 0xff, 0xbd, 0xf9, 0xff, 0xad, 0x77, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xf7, 
+  0x52, 0xee, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x04, 0x52, 0xee, 0x27, 0x53, 0x0e, 0x93, 0x52, 0xee, 0xe8, 0x53, 0x0e, 0xff, 0x53, 0x0f, 0xff, 0x81, 0x63, 0x70, 0xff, 0x81, 0x53, 0x0e, 0xff, 0x11, 
+  0x5b, 0x2f, 0xff, 0xd6, 0x9b, 0xff, 0xef, 0x9e, 0xff, 0xdf, 0x1d, 0xff, 0xde, 0xfc, 0xff, 0xb5, 0xd8, 0xff, 0x94, 0xd5, 0xff, 0xa5, 0x57, 0xff, 0xb5, 0xf8, 0xff, 0xce, 0x7a, 0xff, 0xde, 0xfc, 
+  0xff, 0xe7, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0xad, 0x97, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xf7, 0x52, 0xee, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x05, 0x5b, 0x2f, 0x0f, 0x53, 0x0e, 
+  0x98, 0x52, 0xee, 0xfc, 0x73, 0xf2, 0xff, 0xbd, 0xf9, 0xff, 0xe7, 0x1d, 0xff, 0x83, 0xf7, 0x9e, 0xff, 0x11, 0xdf, 0x1c, 0xff, 0xe7, 0x3d, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 
+  0xff, 0xb5, 0xd8, 0xff, 0x94, 0xd4, 0xff, 0xa5, 0x56, 0xff, 0xb5, 0xd8, 0xff, 0xce, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xdc, 0xff, 0xc6, 0x3a, 0xff, 0xad, 0x98, 0xff, 0x7c, 
+  0x32, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x2b, 0x53, 0x0e, 0xdf, 0x6b, 0xb1, 0xff, 0xce, 0x9b, 0xff, 0x81, 0xf7, 0xbf, 0xff, 0x81, 0xef, 0x7e, 
+  0xff, 0x02, 0xef, 0x5e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5e, 0xff, 0x81, 0xef, 0x7e, 0xff, 0x0e, 0xe7, 0x3d, 0xff, 0xe7, 0x1d, 0xff, 0xb5, 0xd8, 0xff, 0x8c, 0xb4, 0xff, 0xa5, 0x56, 0xff, 0xb5, 
+  0xd8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xdc, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xc6, 0x5a, 0xff, 0xad, 0xb8, 0xff, 0x7c, 0x32, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x40, 0xa2, 0x00, 0x00, 
+  0x00, 0x05, 0x53, 0x0e, 0x2c, 0x52, 0xee, 0xec, 0x8c, 0x94, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x7e, 0xff, 0x81, 0xef, 0x5e, 0xff, 0x00, 0xef, 0x5d, 0xff, 0x81, 0xe7, 0x5d, 0xff, 
+  0x83, 0xe7, 0x3d, 0xff, 0x0c, 0xd6, 0xbb, 0xff, 0x8c, 0xb4, 0xff, 0xa5, 0x36, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x5a, 0xff, 0xd6, 0xdc, 0xff, 0xe7, 0x3d, 0xff, 0xe7, 0x1d, 0xff, 0xc6, 0x5a, 0xff, 
+  0xb5, 0xb8, 0xff, 0x7c, 0x33, 0xff, 0x53, 0x0e, 0xf7, 0x53, 0x0e, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x02, 0x52, 0xef, 0x13, 0x52, 0xee, 0xe3, 0x8c, 0xb4, 0xff, 0x81, 0xf7, 0xbf, 0xff, 0x84, 0xef, 
+  0x7e, 0xff, 0x84, 0xef, 0x5e, 0xff, 0x0c, 0xef, 0x5d, 0xff, 0xce, 0x9b, 0xff, 0x9d, 0x36, 0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xdc, 0xff, 0xe7, 0x5d, 0xff, 0xe7, 0x3d, 0xff, 0xce, 
+  0x7a, 0xff, 0xb5, 0xd8, 0xff, 0x7c, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x03, 0x52, 0xee, 0xa4, 0x73, 0xd1, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0x82, 
+  0xf7, 0x9e, 0xff, 0x00, 0xef, 0x9e, 0xff, 0x87, 0xef, 0x7e, 0xff, 0x0a, 0xe7, 0x5d, 0xff, 0xbd, 0xf9, 0xff, 0xc6, 0x3a, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xce, 0x9b, 
+  0xff, 0xb5, 0xf9, 0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x37, 0x53, 0x0e, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xdf, 0xff, 0x81, 0xf7, 
+  0xbf, 0xff, 0x00, 0xf7, 0x9f, 0xff, 0x86, 0xf7, 0x9e, 0xff, 0x83, 0xef, 0x7e, 0xff, 0x08, 0xef, 0x5e, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xd6, 0xbb, 0xff, 0xbd, 0xf9, 
+  0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0xa4, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0xab, 0x8c, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0x81, 0xf7, 
+  0xbf, 0xff, 0x05, 0xd6, 0xdc, 0xff, 0xc6, 0x5a, 0xff, 0xc6, 0x39, 0xff, 0xce, 0x5a, 0xff, 0xd6, 0xbb, 0xff, 0xe7, 0x3d, 0xff, 0x86, 0xf7, 0x9e, 0xff, 0x05, 0xef, 0x7e, 0xff, 0xde, 0xfc, 0xff, 
+  0xbe, 0x19, 0xff, 0x84, 0x53, 0xff, 0x52, 0xee, 0xf4, 0x53, 0x0e, 0x40, 0xa4, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x4d, 0x0c, 0x52, 0xee, 0xf8, 0xd6, 0xbb, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xdf, 
+  0xff, 0x08, 0xd6, 0xbb, 0xff, 0xc6, 0x39, 0xff, 0x94, 0xf5, 0xff, 0x84, 0x93, 0xff, 0x9c, 0xf5, 0xff, 0xb5, 0xd8, 0xff, 0xc6, 0x3a, 0xff, 0xce, 0x9b, 0xff, 0xef, 0x5d, 0xff, 0x82, 0xf7, 0xbf, 
+  0xff, 0x00, 0xf7, 0x9f, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0x03, 0xd6, 0xbb, 0xff, 0xad, 0x98, 0xff, 0x53, 0x0e, 0xff, 0x52, 0xee, 0x47, 0xa5, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x44, 0x53, 0x0f, 
+  0xff, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x0a, 0xef, 0x5e, 0xff, 0xc6, 0x5a, 0xff, 0x7c, 0x12, 0xff, 0x52, 0xee, 0xe8, 0x53, 0x0e, 0xb3, 0x52, 0xee, 0xdc, 0x53, 0x0e, 0xff, 0x73, 0xf1, 
+  0xff, 0xb5, 0xb8, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0x84, 0xf7, 0xbf, 0xff, 0x03, 0xde, 0xfc, 0xff, 0xbd, 0xf9, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x34, 0xa5, 0x00, 0x00, 0x00, 0x01, 
+  0x53, 0x0e, 0x70, 0x6b, 0xd1, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xd6, 0x9b, 0xff, 0xad, 0x97, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x30, 0x81, 0x00, 0x00, 0x00, 0x06, 0x53, 0x0e, 0x34, 0x53, 
+  0x0e, 0xaf, 0x53, 0x0e, 0xff, 0x8c, 0x94, 0xff, 0xc6, 0x39, 0xff, 0xd6, 0xbb, 0xff, 0xff, 0xbf, 0xff, 0x82, 0xff, 0xdf, 0xff, 0x03, 0xef, 0x5d, 0xff, 0xc6, 0x3a, 0xff, 0x63, 0x70, 0xff, 0x53, 
+  0x0e, 0x63, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x53, 0x0e, 0x88, 0x8c, 0x73, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xef, 0x5d, 0xff, 0xce, 0x7a, 0xff, 0x6b, 0x90, 0xff, 0x53, 0x0e, 0x9c, 0x84, 0x00, 
+  0x00, 0x00, 0x05, 0x53, 0x0e, 0x47, 0x53, 0x0e, 0xe8, 0x73, 0xf2, 0xff, 0xc6, 0x5a, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xff, 0x03, 0xf7, 0x9e, 0xff, 0xc6, 0x5a, 0xff, 
+  0x73, 0xf1, 0xff, 0x53, 0x0e, 0x83, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x53, 0x0e, 0x8b, 0x8c, 0x94, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xce, 0x7a, 0xff, 0xa5, 0x36, 0xff, 0x53, 0x0e, 0xf3, 0x5b, 
+  0x0e, 0x18, 0x85, 0x00, 0x00, 0x00, 0x03, 0x53, 0x0e, 0x20, 0x53, 0x0e, 0xe7, 0x8c, 0xb4, 0xff, 0xde, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xf7, 0xbf, 0xff, 0xc6, 0x5a, 0xff, 0x73, 0xf1, 
+  0xff, 0x53, 0x0e, 0x87, 0xa5, 0x00, 0x00, 0x00, 0x01, 0x53, 0x0e, 0x78, 0x74, 0x12, 0xff, 0x81, 0xff, 0xff, 0xff, 0x03, 0xe7, 0x1c, 0xff, 0xc6, 0x3a, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0x7b, 
+  0x87, 0x00, 0x00, 0x00, 0x01, 0x53, 0x0e, 0x68, 0x5b, 0x2f, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xf7, 0x9e, 0xff, 0xce, 0x7a, 0xff, 0x6b, 0x90, 0xff, 0x53, 0x0e, 0x73, 0xa5, 0x00, 0x00, 0x00, 
+  0x07, 0x53, 0x0e, 0x53, 0x5b, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xce, 0x7a, 0xff, 0x8c, 0xb4, 0xff, 0x53, 0x0e, 0xe0, 0x52, 0xae, 0x08, 0x87, 0x00, 0x00, 0x00, 0x01, 0x52, 0xee, 
+  0x9c, 0x74, 0x12, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xef, 0x5d, 0xff, 0xc6, 0x5a, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x4c, 0xa5, 0x00, 0x00, 0x00, 0x06, 0x52, 0xee, 0x17, 0x53, 0x0e, 0xfc, 
+  0xde, 0xfc, 0xff, 0xf7, 0xbf, 0xff, 0xbe, 0x19, 0xff, 0x53, 0x0f, 0xff, 0x53, 0x0e, 0x58, 0x87, 0x00, 0x00, 0x00, 0x02, 0x52, 0xee, 0x30, 0x53, 0x0e, 0xff, 0xde, 0xdc, 0xff, 0x83, 0xff, 0xff, 
+  0xff, 0x03, 0xde, 0xdc, 0xff, 0xb5, 0xb8, 0xff, 0x52, 0xee, 0xfc, 0x52, 0xef, 0x13, 0xa6, 0x00, 0x00, 0x00, 0x04, 0x52, 0xee, 0xac, 0x94, 0xb4, 0xff, 0xf7, 0x9e, 0xff, 0x7c, 0x32, 0xff, 0x53, 
+  0x0e, 0xc7, 0x88, 0x00, 0x00, 0x00, 0x01, 0x53, 0x0e, 0xbf, 0x8c, 0x94, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xff, 0xbf, 0xff, 0xce, 0x7a, 0xff, 0x84, 0x73, 0xff, 0x52, 0xee, 0xbc, 0xa7, 0x00, 
+  0x00, 0x00, 0x04, 0x53, 0x0e, 0x43, 0x53, 0x0f, 0xff, 0xa5, 0x56, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0x37, 0x87, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x50, 0x53, 0x0f, 0xff, 0xef, 0x7e, 0xff, 
+  0x83, 0xff, 0xff, 0xff, 0x03, 0xde, 0xdc, 0xff, 0xbe, 0x19, 0xff, 0x53, 0x0e, 0xff, 0x52, 0xee, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x88, 0x53, 0x0e, 0xdf, 0x53, 0x0e, 0x84, 0x87, 
+  0x00, 0x00, 0x00, 0x02, 0x4b, 0x6e, 0x07, 0x53, 0x0e, 0xdc, 0xa5, 0x56, 0xff, 0x83, 0xff, 0xff, 0xff, 0x04, 0xe7, 0x5d, 0xff, 0xce, 0x7a, 0xff, 0x7c, 0x12, 0xff, 0x53, 0x0e, 0xc8, 0x84, 0x10, 
+  0x03, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x73, 0x5b, 0x4f, 0xff, 0xf7, 0xbf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x04, 0xef, 0x5d, 0xff, 0xce, 0x7a, 0xff, 0x94, 0xd5, 0xff, 0x53, 0x0e, 0xf7, 
+  0x52, 0xee, 0x2b, 0xb3, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x14, 0x52, 0xee, 0xf0, 0xc6, 0x19, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7a, 0xff, 0x94, 
+  0xf5, 0xff, 0x52, 0xee, 0xfc, 0x53, 0x0e, 0x54, 0xb4, 0x00, 0x00, 0x00, 0x09, 0x53, 0x0e, 0x94, 0x6b, 0xd1, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x3d, 0xff, 0xde, 0xfc, 0xff, 0xce, 0x7a, 0xff, 0xc6, 
+  0x39, 0xff, 0x7c, 0x33, 0xff, 0x53, 0x0e, 0xf8, 0x53, 0x0e, 0x57, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x53, 0x0e, 0x1c, 0x53, 0x0e, 0xfc, 0xbd, 0xf8, 0xff, 0x81, 0xce, 0x7a, 0xff, 0x04, 0xbd, 0xf9, 
+  0xff, 0x94, 0xb4, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x0e, 0xd3, 0x53, 0x0e, 0x33, 0xb5, 0x00, 0x00, 0x00, 0x08, 0x5b, 0x0e, 0x18, 0x53, 0x0e, 0xf7, 0x73, 0xd1, 0xff, 0x6b, 0xb1, 0xff, 0x5b, 0x2f, 
+  0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xd3, 0x53, 0x0e, 0x63, 0x44, 0x10, 0x04, 0xb7, 0x00, 0x00, 0x00, 0x04, 0x53, 0x0e, 0x34, 0x53, 0x0e, 0x94, 0x53, 0x0e, 0x7c, 0x53, 0x0e, 0x58, 0x53, 0x0e, 
+  0x2b, 0xff, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x63, 0x4d, 0x17, 0x72, 0x5f, 0x51, 0x6c, 0x72, 0x60, 0x51, 0xa8, 0x73, 0x60, 0x52, 0xcc, 0x72, 0x60, 0x52, 0xec, 0x72, 0x60, 0x52, 0xaf, 0x73, 0x5c, 0x5c, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5f, 0x55, 0x18, 0x72, 0x60, 0x52, 0x9b, 0x73, 0x5e, 0x50, 0xfb, 0x7f, 0x6e, 0x60, 0xff, 0xae, 0xa3, 0x9a, 0xff, 0xc4, 0xbc, 0xb7, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0x78, 0x66, 0x58, 0xff, 0x72, 0x5f, 0x51, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5e, 0x51, 0x50, 0x73, 0x60, 0x52, 0xef, 0x8b, 0x7c, 0x70, 0xff, 0xdb, 0xd5, 0xd1, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xdf, 0xdc, 0xff, 0x73, 0x60, 0x52, 0xff, 0x73, 0x61, 0x53, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5f, 0x51, 0x70, 0x75, 0x62, 0x54, 0xff, 0xbd, 0xb4, 0xad, 0xff, 0xfc, 0xfb, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xf0, 0xee, 0xed, 0xff, 0x8e, 0x7f, 0x75, 0xff, 0x72, 0x60, 0x52, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x52, 0x5c, 0x75, 0x62, 0x54, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xfa, 0xf9, 0xf9, 0xff, 0xd5, 0xce, 0xca, 0xff, 0xb1, 0xa7, 0x9e, 0xff, 0x71, 0x60, 0x50, 0xf7, 0x73, 0x62, 0x52, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x62, 0x54, 0x27, 0x71, 0x60, 0x50, 0xf7, 0xc5, 0xbd, 0xb7, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xe3, 0xdf, 0xdb, 0xff, 0xcb, 0xc5, 0xbe, 0xff, 0x7c, 0x6a, 0x5d, 0xff, 0x73, 0x5f, 0x52, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x03, 0x73, 0x61, 0x53, 0x37, 0x6f, 0x5f, 0x4f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5e, 0x52, 0xbb, 0x9a, 0x8b, 0x81, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xfa, 0xf8, 0xf8, 0xff, 0xf8, 0xf6, 0xf5, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xf2, 0xef, 0xee, 0xff, 0xcf, 0xc8, 0xc3, 0xff, 0xa4, 0x98, 0x8e, 0xff, 0x71, 0x60, 0x50, 0xe7, 0x75, 0x62, 0x4e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x5f, 0x52, 0x8f, 0x73, 0x60, 0x52, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x75, 0x60, 0x51, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5d, 0x50, 0x38, 0x73, 0x60, 0x52, 0xff, 0xe7, 0xe3, 0xe0, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xda, 0xd4, 0xd0, 0xff, 0xc4, 0xbc, 0xb5, 0xff, 0x76, 0x62, 0x55, 0xff, 0x73, 0x5f, 0x52, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x52, 0x28, 0x73, 0x60, 0x50, 0xfc, 0xcb, 0xc3, 0xbe, 0xff, 0x95, 0x87, 0x7d, 0xff, 0x73, 0x5f, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5e, 0x51, 0x9c, 0x9a, 0x8c, 0x81, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xf6, 0xf4, 0xf2, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf5, 0xf2, 0xf1, 0xff, 0xea, 0xe6, 0xe4, 0xff, 0xcb, 0xc4, 0xbd, 0xff, 0x96, 0x87, 0x7c, 0xff, 0x72, 0x60, 0x52, 0xcf, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x60, 0x52, 0xb4, 0x93, 0x85, 0x79, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0x71, 0x5f, 0x52, 0xfb, 0x75, 0x62, 0x4e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x60, 0x50, 0xe7, 0xcc, 0xc5, 0xbf, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xba, 0xb1, 0xaa, 0xff, 0x74, 0x61, 0x53, 0xff, 0x71, 0x5e, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5e, 0x53, 0x47, 0x74, 0x61, 0x53, 0xff, 0xe0, 0xdb, 0xd7, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xd8, 0xd1, 0xce, 0xff, 0x7b, 0x69, 0x5c, 0xff, 0x72, 0x5f, 0x51, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x64, 0x51, 0x1c, 0x73, 0x60, 0x52, 0xff, 0xe6, 0xe1, 0xde, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xc8, 0xc0, 0xba, 0xff, 0x96, 0x88, 0x7d, 0xff, 0x72, 0x60, 0x51, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x3f, 0x04, 0x73, 0x60, 0x50, 0xd4, 0xa6, 0x9a, 0x91, 0xff, 0xf9, 0xf7, 0xf6, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 0xcc, 0xc5, 0xbf, 0xff, 0x93, 0x84, 0x7a, 0xff, 0x72, 0x5f, 0x51, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5f, 0x52, 0x3b, 0x73, 0x60, 0x52, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xec, 0xe9, 0xe6, 0xff, 0xc8, 0xbf, 0xb8, 0xff, 0x9b, 0x8c, 0x82, 0xff, 0x73, 0x5f, 0x50, 0xcb, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x50, 0x68, 0x77, 0x64, 0x57, 0xff, 0xea, 0xe6, 0xe3, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xcd, 0xc6, 0xc1, 0xff, 0xa1, 0x94, 0x8a, 0xff, 0x73, 0x5f, 0x52, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x60, 0x51, 0x44, 0x73, 0x60, 0x52, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xd1, 0xca, 0xc5, 0xff, 0xbc, 0xb4, 0xab, 0xff, 0x77, 0x65, 0x57, 0xff, 0x72, 0x60, 0x51, 0x9c, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x66, 0x55, 0x0f, 0x73, 0x5f, 0x52, 0xeb, 0xb7, 0xad, 0xa6, 0xff, 0xf6, 0xf4, 0xf2, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xce, 0xc7, 0xc2, 0xff, 0xa5, 0x99, 0x8f, 0xff, 0x73, 0x5f, 0x50, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x61, 0x53, 0x37, 0x73, 0x60, 0x52, 0xff, 0xef, 0xec, 0xea, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xc8, 0xbf, 0xb8, 0xff, 0xb7, 0xab, 0xa3, 0xff, 0x79, 0x65, 0x59, 0xff, 0x71, 0x5f, 0x51, 0xc8, 0x73, 0x62, 0x51, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x52, 0x8b, 0x80, 0x6e, 0x62, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xf3, 0xef, 0xee, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xcb, 0xc4, 0xbd, 0xff, 0xa1, 0x94, 0x8a, 0xff, 0x72, 0x5e, 0x51, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x5f, 0x4f, 0x10, 0x73, 0x60, 0x52, 0xff, 0xe2, 0xdd, 0xd9, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xea, 0xe5, 0xe1, 0xff, 0xea, 0xe5, 0xe2, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xbd, 0xb3, 0xac, 0xff, 0x8b, 0x7b, 0x6f, 0xff, 0x71, 0x5e, 0x50, 0xfc, 0x73, 0x5f, 0x50, 0xa8, 0x74, 0x5e, 0x53, 0x47, 0x77, 0x66, 0x55, 0x0f, 0x73, 0x60, 0x51, 0x34, 0x71, 0x60, 0x50, 0xf8, 0xc7, 0xbf, 0xb8, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xc7, 0xbe, 0xb8, 0xff, 0x94, 0x85, 0x7a, 0xff, 0x72, 0x5e, 0x50, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x52, 0xeb, 0xcc, 0xc4, 0xbe, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xe8, 0xe2, 0xde, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xe9, 0xe3, 0xe0, 0xff, 0xe9, 0xe4, 0xe0, 0xff, 0xe5, 0xe0, 0xdc, 0xff, 0xcd, 0xc4, 0xbe, 0xff, 0xc4, 0xba, 0xb3, 0xff, 0xb1, 0xa5, 0x9d, 0xff, 0x8c, 0x7c, 0x70, 0xff, 0x73, 0x61, 0x53, 0xff, 0x73, 0x60, 0x52, 0xff, 0x73, 0x60, 0x52, 0xff, 0x9a, 0x8b, 0x81, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xee, 0xeb, 0xe8, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xe0, 0xda, 0xd7, 0xff, 0xc6, 0xbc, 0xb5, 0xff, 0x7c, 0x6a, 0x5d, 0xff, 0x72, 0x60, 0x52, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xe1, 0xdc, 0xd9, 0xff, 0xf0, 0xec, 0xe9, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe7, 0xe2, 0xdd, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xe8, 0xe2, 0xde, 0xff, 0xdb, 0xd4, 0xd0, 0xff, 0xc8, 0xc0, 0xb9, 0xff, 0xc3, 0xb9, 0xb2, 0xff, 0xbf, 0xb5, 0xad, 0xff, 0xbd, 0xb3, 0xac, 0xff, 0xd9, 0xd2, 0xce, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xd0, 0xc8, 0xc1, 0xff, 0xb7, 0xad, 0xa4, 0xff, 0x73, 0x60, 0x52, 0xff, 0x72, 0x5f, 0x52, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd8, 0xd2, 0xcd, 0xff, 0xf3, 0xef, 0xed, 0xff, 0xe7, 0xe2, 0xdd, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe6, 0xe0, 0xdb, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe0, 0xd8, 0xd3, 0xff, 0xd5, 0xce, 0xc7, 0xff, 0xda, 0xd3, 0xce, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xe9, 0xe4, 0xe0, 0xff, 0xe9, 0xe4, 0xe0, 0xff, 0xe0, 0xda, 0xd6, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0x93, 0x84, 0x79, 0xff, 0x73, 0x60, 0x52, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd7, 0xd1, 0xcc, 0xff, 0xf2, 0xee, 0xec, 0xff, 0xe6, 0xe0, 0xdb, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xd4, 0xcc, 0xc6, 0xff, 0xcf, 0xc6, 0xc0, 0xff, 0xdd, 0xd6, 0xd2, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xe4, 0xdd, 0xd8, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe5, 0xdf, 0xdb, 0xff, 0xe6, 0xe0, 0xdb, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe6, 0xe0, 0xdc, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe5, 0xe0, 0xdb, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xb4, 0xa9, 0xa0, 0xff, 0x73, 0x61, 0x53, 0xff, 0x72, 0x61, 0x50, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd6, 0xd0, 0xcb, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xe4, 0xdd, 0xd9, 0xff, 0xe0, 0xd9, 0xd3, 0xff, 0xc8, 0xbf, 0xb8, 0xff, 0xb8, 0xad, 0xa5, 0xff, 0xc7, 0xbe, 0xb8, 0xff, 0xd6, 0xcf, 0xca, 0xff, 0xe3, 0xdc, 0xd8, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xe2, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd8, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xe4, 0xdd, 0xd9, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xe5, 0xde, 0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xca, 0xc2, 0xba, 0xff, 0xbd, 0xb2, 0xaa, 0xff, 0x7f, 0x6d, 0x61, 0xff, 0x73, 0x60, 0x51, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd6, 0xce, 0xc9, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xde, 0xd6, 0xd1, 0xff, 0xc6, 0xbd, 0xb6, 0xff, 0xb6, 0xac, 0xa4, 0xff, 0xc6, 0xbd, 0xb6, 0xff, 0xd5, 0xce, 0xc9, 0xff, 0xe4, 0xdf, 0xdb, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xe0, 0xd9, 0xd4, 0xff, 0xe0, 0xd9, 0xd4, 0xff, 0xe1, 0xda, 0xd4, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xe2, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xdd, 0xd6, 0xd1, 0xff, 0xc6, 0xbd, 0xb5, 0xff, 0xbc, 0xb2, 0xa9, 0xff, 0x87, 0x76, 0x6a, 0xff, 0x71, 0x60, 0x52, 0xdc, 0x71, 0x63, 0x54, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd5, 0xce, 0xc8, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xe1, 0xd9, 0xd4, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xc5, 0xbb, 0xb3, 0xff, 0xb5, 0xaa, 0xa2, 0xff, 0xc4, 0xbb, 0xb5, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe3, 0xdc, 0xd8, 0xff, 0xde, 0xd7, 0xd1, 0xff, 0xdf, 0xd7, 0xd1, 0xff, 0xdf, 0xd7, 0xd2, 0xff, 0xdf, 0xd8, 0xd2, 0xff, 0xe0, 0xd8, 0xd3, 0xff, 0xe0, 0xd8, 0xd3, 0xff, 0xe0, 0xd9, 0xd4, 0xff, 0xe0, 0xd9, 0xd4, 0xff, 0xdb, 0xd3, 0xcc, 0xff, 0xcd, 0xc4, 0xbd, 0xff, 0xbe, 0xb4, 0xab, 0xff, 0xb5, 0xaa, 0xa0, 0xff, 0x81, 0x70, 0x64, 0xff, 0x71, 0x5e, 0x50, 0xe0, 0x74, 0x5e, 0x50, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd4, 0xcd, 0xc7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xdf, 0xd7, 0xd1, 0xff, 0xda, 0xd1, 0xcb, 0xff, 0xc3, 0xb9, 0xb1, 0xff, 0xb4, 0xa9, 0xa1, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0xd2, 0xcb, 0xc5, 0xff, 0xe1, 0xdc, 0xd8, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe5, 0xe0, 0xdb, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xcc, 0xc2, 0xbc, 0xff, 0xbd, 0xb2, 0xa9, 0xff, 0xbd, 0xb1, 0xa9, 0xff, 0xc2, 0xb9, 0xb1, 0xff, 0xc8, 0xbe, 0xb6, 0xff, 0xc9, 0xbf, 0xb8, 0xff, 0xc6, 0xbd, 0xb4, 0xff, 0xc1, 0xb5, 0xae, 0xff, 0xbc, 0xb2, 0xa8, 0xff, 0xb8, 0xac, 0xa3, 0xff, 0x9a, 0x8c, 0x81, 0xff, 0x75, 0x62, 0x55, 0xff, 0x71, 0x60, 0x51, 0xbf, 0x74, 0x5f, 0x55, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd3, 0xcb, 0xc6, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xdd, 0xd5, 0xce, 0xff, 0xd8, 0xcf, 0xc8, 0xff, 0xc1, 0xb7, 0xaf, 0xff, 0xb3, 0xa7, 0x9f, 0xff, 0xc2, 0xb8, 0xb1, 0xff, 0xd1, 0xc9, 0xc4, 0xff, 0xe0, 0xdb, 0xd6, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xda, 0xd2, 0xcb, 0xff, 0xc8, 0xbe, 0xb6, 0xff, 0xba, 0xae, 0xa5, 0xff, 0x9d, 0x8e, 0x84, 0xff, 0x96, 0x87, 0x7c, 0xff, 0xa6, 0x97, 0x8c, 0xff, 0xac, 0x9f, 0x95, 0xff, 0xae, 0xa0, 0x96, 0xff, 0xa9, 0x9c, 0x92, 0xff, 0x9e, 0x90, 0x86, 0xff, 0x8a, 0x79, 0x6d, 0xff, 0x74, 0x61, 0x53, 0xff, 0x73, 0x60, 0x50, 0xe4, 0x74, 0x5f, 0x50, 0x64, 0x7f, 0x7f, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd2, 0xca, 0xc5, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xdb, 0xd3, 0xcd, 0xff, 0xd6, 0xcc, 0xc5, 0xff, 0xc0, 0xb4, 0xac, 0xff, 0xb1, 0xa6, 0x9e, 0xff, 0xc0, 0xb7, 0xb0, 0xff, 0xd0, 0xc8, 0xc2, 0xff, 0xdf, 0xd9, 0xd5, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe4, 0xdd, 0xd8, 0xff, 0xd8, 0xcf, 0xc8, 0xff, 0xc6, 0xbb, 0xb4, 0xff, 0xb8, 0xac, 0xa2, 0xff, 0x93, 0x82, 0x76, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x60, 0x50, 0xc0, 0x73, 0x60, 0x52, 0xef, 0x73, 0x60, 0x52, 0xff, 0x73, 0x60, 0x52, 0xff, 0x73, 0x60, 0x50, 0xfc, 0x71, 0x5e, 0x50, 0xdb, 0x73, 0x60, 0x52, 0xa0, 0x74, 0x5e, 0x51, 0x50, 0x7f, 0x55, 0x55, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x64, 0x57, 0xff, 0xd1, 0xc9, 0xc3, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xd9, 0xd0, 0xca, 0xff, 0xd4, 0xca, 0xc2, 0xff, 0xbe, 0xb2, 0xaa, 0xff, 0xb0, 0xa4, 0x9c, 0xff, 0xbf, 0xb5, 0xae, 0xff, 0xce, 0xc6, 0xc1, 0xff, 0xdd, 0xd8, 0xd3, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xd6, 0xcc, 0xc5, 0xff, 0xc4, 0xba, 0xb1, 0xff, 0xb7, 0xaa, 0xa0, 0xff, 0x92, 0x82, 0x76, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x60, 0x51, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x54, 0x54, 0x08, 0x6d, 0x5b, 0x5b, 0x0f, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x64, 0x57, 0xff, 0xd1, 0xc8, 0xc2, 0xff, 0xea, 0xe4, 0xe1, 0xff, 0xd7, 0xce, 0xc7, 0xff, 0xd2, 0xc7, 0xbf, 0xff, 0xbc, 0xb0, 0xa8, 0xff, 0xaf, 0xa3, 0x9a, 0xff, 0xbe, 0xb4, 0xad, 0xff, 0xcd, 0xc5, 0xbf, 0xff, 0xdc, 0xd6, 0xd2, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xd4, 0xca, 0xc3, 0xff, 0xc3, 0xb7, 0xaf, 0xff, 0xb6, 0xa9, 0x9e, 0xff, 0x91, 0x81, 0x75, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x60, 0x51, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x64, 0x57, 0xff, 0xd1, 0xc9, 0xc3, 0xff, 0xea, 0xe5, 0xe2, 0xff, 0xd8, 0xcf, 0xc8, 0xff, 0xd2, 0xc7, 0xbf, 0xff, 0xbb, 0xaf, 0xa7, 0xff, 0xad, 0xa1, 0x99, 0xff, 0xbc, 0xb2, 0xab, 0xff, 0xcc, 0xc4, 0xbe, 0xff, 0xdb, 0xd5, 0xd0, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xe1, 0xda, 0xd4, 0xff, 0xd2, 0xc7, 0xc0, 0xff, 0xc1, 0xb5, 0xab, 0xff, 0xb4, 0xa7, 0x9c, 0xff, 0x91, 0x80, 0x74, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x60, 0x51, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd3, 0xcb, 0xc5, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xda, 0xd2, 0xcc, 0xff, 0xd4, 0xca, 0xc3, 0xff, 0xbc, 0xb1, 0xa8, 0xff, 0xac, 0xa0, 0x97, 0xff, 0xbb, 0xb1, 0xaa, 0xff, 0xca, 0xc2, 0xbc, 0xff, 0xda, 0xd3, 0xce, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xe1, 0xda, 0xd4, 0xff, 0xd1, 0xc6, 0xbf, 0xff, 0xc0, 0xb3, 0xaa, 0xff, 0xb3, 0xa5, 0x9b, 0xff, 0x90, 0x80, 0x73, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x60, 0x51, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd3, 0xcc, 0xc6, 0xff, 0xed, 0xe9, 0xe5, 0xff, 0xdd, 0xd4, 0xce, 0xff, 0xd7, 0xce, 0xc7, 0xff, 0xbe, 0xb2, 0xa9, 0xff, 0xab, 0x9f, 0x96, 0xff, 0xba, 0xb0, 0xa8, 0xff, 0xc9, 0xc1, 0xba, 0xff, 0xd8, 0xd2, 0xcd, 0xff, 0xe7, 0xe3, 0xdf, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xd4, 0xca, 0xc2, 0xff, 0xc3, 0xb6, 0xad, 0xff, 0xb4, 0xa7, 0x9d, 0xff, 0x91, 0x80, 0x74, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd5, 0xcd, 0xc8, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xdf, 0xd8, 0xd2, 0xff, 0xda, 0xd1, 0xca, 0xff, 0xbe, 0xb3, 0xab, 0xff, 0xa9, 0x9d, 0x94, 0xff, 0xb9, 0xae, 0xa6, 0xff, 0xc8, 0xbf, 0xb9, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xe6, 0xe1, 0xde, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xd7, 0xcd, 0xc6, 0xff, 0xc4, 0xb9, 0xb0, 0xff, 0xb6, 0xaa, 0xa0, 0xff, 0x92, 0x81, 0x75, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd6, 0xcf, 0xc9, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xbf, 0xb5, 0xad, 0xff, 0xa8, 0x9c, 0x92, 0xff, 0xb7, 0xad, 0xa5, 0xff, 0xc6, 0xbe, 0xb7, 0xff, 0xd6, 0xcf, 0xca, 0xff, 0xe5, 0xe0, 0xdc, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xd9, 0xd0, 0xca, 0xff, 0xc7, 0xbb, 0xb4, 0xff, 0xb8, 0xac, 0xa2, 0xff, 0x92, 0x82, 0x76, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x52, 0x28, 0x73, 0x60, 0x50, 0x53, 0x73, 0x5f, 0x52, 0x67, 0x73, 0x5f, 0x52, 0x67, 0x71, 0x60, 0x52, 0x4b, 0x6f, 0x5f, 0x4f, 0x20, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xf1, 0xed, 0xea, 0xff, 0xe4, 0xdd, 0xd9, 0xff, 0xdf, 0xd8, 0xd2, 0xff, 0xc1, 0xb6, 0xae, 0xff, 0xa7, 0x9a, 0x91, 0xff, 0xb6, 0xab, 0xa3, 0xff, 0xc5, 0xbc, 0xb6, 0xff, 0xd4, 0xcd, 0xc8, 0xff, 0xe4, 0xde, 0xdb, 0xff, 0xe5, 0xe0, 0xdb, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xc9, 0xbe, 0xb7, 0xff, 0xba, 0xae, 0xa5, 0xff, 0x92, 0x81, 0x76, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5d, 0x50, 0x27, 0x73, 0x60, 0x52, 0x93, 0x73, 0x5e, 0x52, 0xe8, 0x73, 0x60, 0x52, 0xff, 0x75, 0x62, 0x54, 0xff, 0x7e, 0x6c, 0x5f, 0xff, 0x7e, 0x6c, 0x5f, 0xff, 0x74, 0x61, 0x54, 0xff, 0x73, 0x60, 0x52, 0xff, 0x78, 0x65, 0x57, 0xff, 0xd8, 0xd1, 0xcd, 0xff, 0xf2, 0xef, 0xec, 0xff, 0xe6, 0xe1, 0xdc, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xc1, 0xb7, 0xaf, 0xff, 0xa6, 0x99, 0x8f, 0xff, 0xb5, 0xaa, 0xa2, 0xff, 0xc4, 0xbb, 0xb4, 0xff, 0xd3, 0xcc, 0xc6, 0xff, 0xe2, 0xdd, 0xd9, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xdf, 0xd7, 0xd2, 0xff, 0xcb, 0xc1, 0xba, 0xff, 0xbc, 0xb0, 0xa7, 0xff, 0x92, 0x83, 0x77, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x66, 0x55, 0x0f, 0x73, 0x5f, 0x52, 0x98, 0x71, 0x5e, 0x50, 0xfc, 0x8e, 0x7e, 0x72, 0xff, 0xc7, 0xbe, 0xb8, 0xff, 0xe5, 0xe1, 0xdd, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf2, 0xf0, 0xed, 0xff, 0xe4, 0xdf, 0xdc, 0xff, 0xea, 0xe6, 0xe3, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xc2, 0xb8, 0xb1, 0xff, 0xa4, 0x97, 0x8e, 0xff, 0xb3, 0xa8, 0xa0, 0xff, 0xc3, 0xb9, 0xb2, 0xff, 0xd2, 0xca, 0xc5, 0xff, 0xe1, 0xdb, 0xd7, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xcd, 0xc4, 0xbe, 0xff, 0xbd, 0xb2, 0xa9, 0xff, 0x93, 0x84, 0x79, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x5f, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x61, 0x54, 0x2b, 0x71, 0x60, 0x51, 0xdf, 0x85, 0x74, 0x68, 0xff, 0xd6, 0xd0, 0xcc, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xef, 0xeb, 0xe7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xea, 0xe4, 0xe1, 0xff, 0xe7, 0xe2, 0xdd, 0xff, 0xc4, 0xba, 0xb3, 0xff, 0xa3, 0x96, 0x8c, 0xff, 0xb2, 0xa7, 0x9f, 0xff, 0xc1, 0xb8, 0xb1, 0xff, 0xd0, 0xc9, 0xc3, 0xff, 0xe0, 0xda, 0xd6, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xd0, 0xc7, 0xc1, 0xff, 0xbf, 0xb5, 0xac, 0xff, 0x94, 0x85, 0x7a, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x5f, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x60, 0x4f, 0x2c, 0x73, 0x5e, 0x50, 0xec, 0xa0, 0x92, 0x88, 0xff, 0xf2, 0xf0, 0xee, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xea, 0xe5, 0xe1, 0xff, 0xdb, 0xd5, 0xd1, 0xff, 0xa2, 0x94, 0x8b, 0xff, 0xb1, 0xa5, 0x9d, 0xff, 0xc0, 0xb6, 0xaf, 0xff, 0xcf, 0xc8, 0xc2, 0xff, 0xde, 0xd9, 0xd4, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0xd2, 0xca, 0xc3, 0xff, 0xc1, 0xb6, 0xaf, 0xff, 0x95, 0x86, 0x7b, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x5f, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x5d, 0x50, 0x13, 0x73, 0x5e, 0x52, 0xe3, 0xa2, 0x95, 0x8c, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf0, 0xee, 0xeb, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xaf, 0xa4, 0x9b, 0xff, 0xbf, 0xb5, 0xae, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0xdd, 0xd7, 0xd3, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xd4, 0xcd, 0xc7, 0xff, 0xc3, 0xb9, 0xb1, 0xff, 0x96, 0x87, 0x7c, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5e, 0x50, 0xa4, 0x8a, 0x79, 0x6e, 0xff, 0xf5, 0xf4, 0xf2, 0xff, 0xf8, 0xf6, 0xf5, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xf0, 0xed, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf2, 0xef, 0xec, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xf1, 0xee, 0xeb, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xc5, 0xbd, 0xb6, 0xff, 0xcd, 0xc5, 0xbf, 0xff, 0xdc, 0xd6, 0xd1, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xd6, 0xcf, 0xca, 0xff, 0xc5, 0xbb, 0xb4, 0xff, 0x97, 0x88, 0x7d, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x61, 0x53, 0x37, 0x73, 0x60, 0x52, 0xff, 0xe0, 0xdc, 0xd9, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf5, 0xf2, 0xf1, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 0xf4, 0xf1, 0xef, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xf0, 0xed, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf2, 0xee, 0xec, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xf1, 0xee, 0xeb, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xd9, 0xd3, 0xcd, 0xff, 0xc7, 0xbd, 0xb6, 0xff, 0x97, 0x89, 0x7f, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0xab, 0x9d, 0x90, 0x87, 0xff, 0xfc, 0xfb, 0xfb, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xf8, 0xf6, 0xf5, 0xff, 0xf7, 0xf6, 0xf4, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xde, 0xd8, 0xd3, 0xff, 0xcf, 0xc8, 0xc3, 0xff, 0xcc, 0xc5, 0xbe, 0xff, 0xd1, 0xc9, 0xc5, 0xff, 0xda, 0xd5, 0xd0, 0xff, 0xea, 0xe5, 0xe3, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 0xf4, 0xf1, 0xef, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf2, 0xee, 0xec, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xc9, 0xc1, 0xba, 0xff, 0x98, 0x8a, 0x80, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x6a, 0x55, 0x0c, 0x73, 0x5e, 0x52, 0xf8, 0xd9, 0xd4, 0xd1, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xfa, 0xf8, 0xf8, 0xff, 0xda, 0xd5, 0xd1, 0xff, 0xca, 0xc3, 0xbd, 0xff, 0xaa, 0x9d, 0x94, 0xff, 0x9c, 0x8f, 0x84, 0xff, 0xaa, 0x9d, 0x95, 0xff, 0xc0, 0xb8, 0xb0, 0xff, 0xcd, 0xc5, 0xc0, 0xff, 0xd5, 0xcf, 0xc9, 0xff, 0xec, 0xe9, 0xe6, 0xff, 0xf6, 0xf4, 0xf2, 0xff, 0xf5, 0xf3, 0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf5, 0xf2, 0xf1, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 0xda, 0xd4, 0xcf, 0xff, 0xbd, 0xb2, 0xaa, 0xff, 0x73, 0x60, 0x52, 0xff, 0x74, 0x5e, 0x53, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x60, 0x51, 0x44, 0x75, 0x62, 0x54, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xed, 0xea, 0xe9, 0xff, 0xd0, 0xc9, 0xc4, 0xff, 0x91, 0x81, 0x77, 0xff, 0x73, 0x5e, 0x52, 0xe8, 0x73, 0x5f, 0x52, 0xb3, 0x73, 0x5e, 0x50, 0xdc, 0x73, 0x60, 0x52, 0xff, 0x8b, 0x7c, 0x70, 0xff, 0xbd, 0xb4, 0xad, 0xff, 0xce, 0xc7, 0xc1, 0xff, 0xdf, 0xdb, 0xd8, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xf7, 0xf6, 0xf4, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xf7, 0xf5, 0xf3, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xe1, 0xdd, 0xd9, 0xff, 0xc6, 0xbe, 0xb8, 0xff, 0x73, 0x60, 0x52, 0xff, 0x70, 0x62, 0x53, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x61, 0x51, 0x70, 0x88, 0x78, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xd6, 0xd1, 0xcd, 0xff, 0xba, 0xb2, 0xab, 0xff, 0x73, 0x60, 0x52, 0xff, 0x74, 0x5f, 0x4f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x51, 0x34, 0x73, 0x60, 0x51, 0xaf, 0x74, 0x61, 0x53, 0xff, 0x9e, 0x91, 0x87, 0xff, 0xcc, 0xc6, 0xc1, 0xff, 0xdb, 0xd5, 0xd2, 0xff, 0xf8, 0xf6, 0xf6, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xec, 0xea, 0xe7, 0xff, 0xcd, 0xc6, 0xc0, 0xff, 0x7e, 0x6c, 0x5e, 0xff, 0x73, 0x5f, 0x52, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x51, 0x88, 0x9c, 0x8e, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xe7, 0xe5, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0x82, 0x72, 0x65, 0xff, 0x72, 0x60, 0x51, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x60, 0x52, 0x47, 0x71, 0x60, 0x52, 0xe8, 0x8d, 0x7d, 0x72, 0xff, 0xce, 0xc7, 0xc2, 0xff, 0xe2, 0xdd, 0xda, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xf3, 0xf1, 0xf0, 0xff, 0xcf, 0xc8, 0xc2, 0xff, 0x8b, 0x7b, 0x6f, 0xff, 0x72, 0x5f, 0x51, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x52, 0x8b, 0x9e, 0x91, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfa, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xaf, 0xa5, 0x9d, 0xff, 0x73, 0x5f, 0x50, 0xf3, 0x74, 0x5f, 0x55, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x5f, 0x4f, 0x20, 0x73, 0x60, 0x52, 0xe7, 0xa3, 0x96, 0x8c, 0xff, 0xde, 0xda, 0xd6, 0xff, 0xfb, 0xfb, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xd0, 0xca, 0xc4, 0xff, 0x8c, 0x7c, 0x71, 0xff, 0x72, 0x5f, 0x51, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x52, 0x78, 0x8e, 0x7f, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe1, 0xde, 0xff, 0xce, 0xc6, 0xc2, 0xff, 0x7a, 0x66, 0x5a, 0xff, 0x72, 0x60, 0x51, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x61, 0x52, 0x68, 0x79, 0x66, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf2, 0xf1, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0x82, 0x72, 0x65, 0xff, 0x73, 0x5f, 0x52, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x50, 0x53, 0x76, 0x63, 0x55, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0xa2, 0x95, 0x8b, 0xff, 0x72, 0x60, 0x50, 0xe0, 0x71, 0x54, 0x54, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5e, 0x51, 0x9c, 0x8f, 0x7f, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xe8, 0xe6, 0xff, 0xcf, 0xc9, 0xc4, 0xff, 0x74, 0x61, 0x53, 0xff, 0x73, 0x60, 0x52, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5c, 0x51, 0x17, 0x73, 0x60, 0x50, 0xfc, 0xe1, 0xdc, 0xd9, 0xff, 0xf5, 0xf4, 0xf3, 0xff, 0xc7, 0xbf, 0xb9, 0xff, 0x75, 0x62, 0x54, 0xff, 0x73, 0x5f, 0x51, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5d, 0x53, 0x30, 0x73, 0x60, 0x52, 0xff, 0xde, 0xda, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd9, 0xd5, 0xff, 0xbd, 0xb4, 0xad, 0xff, 0x71, 0x5e, 0x50, 0xfc, 0x78, 0x5d, 0x50, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x5e, 0x52, 0xac, 0xa2, 0x95, 0x8d, 0xff, 0xf1, 0xf0, 0xee, 0xff, 0x93, 0x85, 0x7a, 0xff, 0x72, 0x60, 0x52, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x60, 0x51, 0xbf, 0x9e, 0x91, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf6, 0xf6, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0x99, 0x8b, 0x81, 0xff, 0x71, 0x5e, 0x52, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x53, 0x43, 0x75, 0x62, 0x54, 0xff, 0xb3, 0xa8, 0xa1, 0xff, 0x73, 0x60, 0x52, 0xff, 0x73, 0x61, 0x53, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x52, 0x50, 0x75, 0x62, 0x54, 0xff, 0xed, 0xeb, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xda, 0xd6, 0xff, 0xc7, 0xbf, 0xb9, 0xff, 0x74, 0x61, 0x53, 0xff, 0x74, 0x5e, 0x51, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x52, 0x88, 0x73, 0x60, 0x52, 0xdf, 0x73, 0x60, 0x51, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6d, 0x48, 0x07, 0x71, 0x60, 0x52, 0xdc, 0xb4, 0xaa, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xe7, 0xe4, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0x8f, 0x80, 0x75, 0xff, 0x73, 0x60, 0x52, 0xc8, 0x7f, 0x7f, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x52, 0x73, 0x7a, 0x68, 0x5b, 0xff, 0xf6, 0xf5, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xe7, 0xe5, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0xa7, 0x9a, 0x92, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x70, 0x5e, 0x53, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x54, 0x14, 0x71, 0x5e, 0x50, 0xf0, 0xc9, 0xc2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf8, 0xff, 0xe0, 0xdc, 0xd9, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0xa9, 0x9d, 0x94, 0xff, 0x71, 0x5e, 0x50, 0xfc, 0x73, 0x61, 0x51, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x5f, 0x52, 0x94, 0x87, 0x77, 0x6b, 0xff, 0xf6, 0xf5, 0xf4, 0xff, 0xe6, 0xe3, 0xe0, 0xff, 0xe0, 0xdc, 0xd8, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0xca, 0xc4, 0xbe, 0xff, 0x95, 0x86, 0x7b, 0xff, 0x71, 0x60, 0x50, 0xf8, 0x72, 0x60, 0x52, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x60, 0x4f, 0x1c, 0x73, 0x60, 0x50, 0xfc, 0xc4, 0xbc, 0xb6, 0xff, 0xd4, 0xce, 0xc9, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0xc5, 0xbc, 0xb6, 0xff, 0xa4, 0x96, 0x8d, 0xff, 0x77, 0x64, 0x57, 0xff, 0x71, 0x5f, 0x52, 0xd3, 0x73, 0x5f, 0x50, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x5f, 0x55, 0x18, 0x73, 0x60, 0x50, 0xf7, 0x89, 0x79, 0x6e, 0xff, 0x86, 0x75, 0x6a, 0xff, 0x76, 0x64, 0x56, 0xff, 0x73, 0x60, 0x52, 0xff, 0x71, 0x5f, 0x52, 0xd3, 0x73, 0x5f, 0x52, 0x63, 0x7f, 0x7f, 0x3f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x60, 0x51, 0x34, 0x72, 0x5f, 0x52, 0x94, 0x73, 0x60, 0x52, 0x7c, 0x72, 0x61, 0x53, 0x58, 0x73, 0x61, 0x54, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6e, 0x63, 0x4d, 0x17, 0x72, 0x5f, 0x51, 0x6c, 0x72, 0x60, 0x51, 0xa8, 0x73, 0x60, 0x52, 0xcc, 0x72, 
+  0x60, 0x52, 0xec, 0x72, 0x60, 0x52, 0xaf, 0x73, 0x5c, 0x5c, 0x0b, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x08, 0x74, 0x5f, 0x55, 0x18, 0x72, 0x60, 0x52, 0x9b, 0x73, 0x5e, 0x50, 0xfb, 0x7f, 0x6e, 0x60, 
+  0xff, 0xae, 0xa3, 0x9a, 0xff, 0xc4, 0xbc, 0xb7, 0xff, 0xd4, 0xcd, 0xc9, 0xff, 0x78, 0x66, 0x58, 0xff, 0x72, 0x5f, 0x51, 0x6b, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x5e, 0x51, 0x50, 0x73, 
+  0x60, 0x52, 0xef, 0x8b, 0x7c, 0x70, 0xff, 0xdb, 0xd5, 0xd1, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe3, 0xdf, 0xdc, 0xff, 0x73, 0x60, 0x52, 0xff, 0x73, 0x61, 0x53, 
+  0x37, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x5f, 0x51, 0x70, 0x75, 0x62, 0x54, 0xff, 0xbd, 0xb4, 0xad, 0xff, 0xfc, 0xfb, 0xfb, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x03, 0xfd, 0xfd, 0xfc, 
+  0xff, 0xf0, 0xee, 0xed, 0xff, 0x8e, 0x7f, 0x75, 0xff, 0x72, 0x60, 0x52, 0xa7, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x5f, 0x52, 0x5c, 0x75, 0x62, 0x54, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0xfe, 
+  0xfd, 0xfd, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xfa, 0xf9, 0xf9, 0xff, 0xd5, 0xce, 0xca, 0xff, 0xb1, 0xa7, 0x9e, 0xff, 0x71, 0x60, 0x50, 0xf7, 0x73, 0x62, 0x52, 0x1f, 0xb3, 
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x75, 0x62, 0x54, 0x27, 0x71, 0x60, 0x50, 0xf7, 0xc5, 0xbd, 0xb7, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xfb, 0xfa, 0xf9, 
+  0xff, 0xe3, 0xdf, 0xdb, 0xff, 0xcb, 0xc5, 0xbe, 0xff, 0x7c, 0x6a, 0x5d, 0xff, 0x73, 0x5f, 0x52, 0x84, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7f, 0x7f, 0x7f, 0x03, 0x73, 0x61, 0x53, 0x37, 0x6f, 
+  0x5f, 0x4f, 0x10, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x5e, 0x52, 0xbb, 0x9a, 0x8b, 0x81, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xfa, 0xf8, 0xf8, 0xff, 0xf8, 0xf6, 0xf5, 0xff, 0xf8, 0xf7, 0xf6, 
+  0xff, 0xf2, 0xef, 0xee, 0xff, 0xcf, 0xc8, 0xc3, 0xff, 0xa4, 0x98, 0x8e, 0xff, 0x71, 0x60, 0x50, 0xe7, 0x75, 0x62, 0x4e, 0x0c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x03, 0x71, 0x5f, 0x52, 0x8f, 0x73, 
+  0x60, 0x52, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x75, 0x60, 0x51, 0x33, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x03, 0x74, 0x5d, 0x50, 0x38, 0x73, 0x60, 0x52, 0xff, 0xe7, 0xe3, 0xe0, 0xff, 0xfa, 0xf9, 0xf8, 
+  0xff, 0x81, 0xf6, 0xf4, 0xf3, 0xff, 0x04, 0xf7, 0xf5, 0xf4, 0xff, 0xda, 0xd4, 0xd0, 0xff, 0xc4, 0xbc, 0xb5, 0xff, 0x76, 0x62, 0x55, 0xff, 0x73, 0x5f, 0x52, 0x63, 0x87, 0x00, 0x00, 0x00, 0x00, 
+  0x04, 0x72, 0x5f, 0x52, 0x28, 0x73, 0x60, 0x50, 0xfc, 0xcb, 0xc3, 0xbe, 0xff, 0x95, 0x87, 0x7d, 0xff, 0x73, 0x5f, 0x50, 0xa8, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x5e, 0x51, 0x9c, 0x9a, 
+  0x8c, 0x81, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xf6, 0xf4, 0xf2, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf5, 0xf2, 0xf1, 0xff, 0xea, 0xe6, 0xe4, 0xff, 0xcb, 0xc4, 0xbd, 0xff, 0x96, 0x87, 0x7c, 0xff, 0x72, 
+  0x60, 0x52, 0xcf, 0x55, 0x55, 0x55, 0x03, 0x87, 0x00, 0x00, 0x00, 0x00, 0x05, 0x71, 0x60, 0x52, 0xb4, 0x93, 0x85, 0x79, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xcf, 0xc7, 0xc2, 0xff, 0x71, 0x5f, 0x52, 
+  0xfb, 0x75, 0x62, 0x4e, 0x1b, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x03, 0x71, 0x60, 0x50, 0xe7, 0xcc, 0xc5, 0xbf, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xf2, 0xef, 0xed, 0xff, 0x81, 0xf3, 0xf0, 0xee, 0xff, 
+  0x03, 0xd3, 0xcc, 0xc7, 0xff, 0xba, 0xb1, 0xaa, 0xff, 0x74, 0x61, 0x53, 0xff, 0x71, 0x5e, 0x52, 0x40, 0x87, 0x00, 0x00, 0x00, 0x00, 0x06, 0x74, 0x5e, 0x53, 0x47, 0x74, 0x61, 0x53, 0xff, 0xe0, 
+  0xdb, 0xd7, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xd8, 0xd1, 0xce, 0xff, 0x7b, 0x69, 0x5c, 0xff, 0x72, 0x5f, 0x51, 0x6b, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x09, 0x76, 0x64, 0x51, 0x1c, 0x73, 0x60, 0x52, 
+  0xff, 0xe6, 0xe1, 0xde, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xc8, 0xc0, 0xba, 0xff, 0x96, 0x88, 0x7d, 0xff, 0x72, 0x60, 0x51, 
+  0xb8, 0x87, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7f, 0x7f, 0x3f, 0x04, 0x73, 0x60, 0x50, 0xd4, 0xa6, 0x9a, 0x91, 0xff, 0xf9, 0xf7, 0xf6, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 0xcc, 0xc5, 0xbf, 0xff, 0x93, 
+  0x84, 0x7a, 0xff, 0x72, 0x5f, 0x51, 0xa0, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x74, 0x5f, 0x52, 0x3b, 0x73, 0x60, 0x52, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xef, 0xeb, 0xe8, 
+  0xff, 0xef, 0xeb, 0xe9, 0xff, 0xec, 0xe9, 0xe6, 0xff, 0xc8, 0xbf, 0xb8, 0xff, 0x9b, 0x8c, 0x82, 0xff, 0x73, 0x5f, 0x50, 0xcb, 0x55, 0x55, 0x55, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 
+  0x5f, 0x50, 0x68, 0x77, 0x64, 0x57, 0xff, 0xea, 0xe6, 0xe3, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xcd, 0xc6, 0xc1, 0xff, 0xa1, 0x94, 0x8a, 0xff, 0x73, 0x5f, 0x52, 0xc0, 0xa5, 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0x60, 0x51, 0x44, 0x73, 0x60, 0x52, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0x81, 0xed, 0xe9, 0xe6, 0xff, 0x05, 0xee, 0xea, 0xe7, 0xff, 0xd1, 
+  0xca, 0xc5, 0xff, 0xbc, 0xb4, 0xab, 0xff, 0x77, 0x65, 0x57, 0xff, 0x72, 0x60, 0x51, 0x9c, 0x66, 0x66, 0x66, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08, 0x77, 0x66, 0x55, 0x0f, 0x73, 0x5f, 0x52, 
+  0xeb, 0xb7, 0xad, 0xa6, 0xff, 0xf6, 0xf4, 0xf2, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xce, 0xc7, 0xc2, 0xff, 0xa5, 0x99, 0x8f, 0xff, 0x73, 0x5f, 0x50, 0xcb, 0xa5, 0x00, 0x00, 
+  0x00, 0x00, 0x0c, 0x73, 0x61, 0x53, 0x37, 0x73, 0x60, 0x52, 0xff, 0xef, 0xec, 0xea, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xe7, 
+  0xe2, 0xde, 0xff, 0xc8, 0xbf, 0xb8, 0xff, 0xb7, 0xab, 0xa3, 0xff, 0x79, 0x65, 0x59, 0xff, 0x71, 0x5f, 0x51, 0xc8, 0x73, 0x62, 0x51, 0x2c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x08, 0x73, 0x5f, 0x52, 
+  0x8b, 0x80, 0x6e, 0x62, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xf3, 0xef, 0xee, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xcb, 0xc4, 0xbd, 0xff, 0xa1, 0x94, 0x8a, 0xff, 0x72, 0x5e, 0x51, 
+  0xc3, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6f, 0x5f, 0x4f, 0x10, 0x73, 0x60, 0x52, 0xff, 0xe2, 0xdd, 0xd9, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xea, 0xe5, 0xe1, 0xff, 0xea, 
+  0xe5, 0xe2, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xe3, 0xde, 0xda, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xbd, 0xb3, 0xac, 0xff, 0x8b, 0x7b, 0x6f, 0xff, 0x71, 0x5e, 0x50, 0xfc, 0x73, 0x5f, 0x50, 0xa8, 0x74, 
+  0x5e, 0x53, 0x47, 0x77, 0x66, 0x55, 0x0f, 0x73, 0x60, 0x51, 0x34, 0x71, 0x60, 0x50, 0xf8, 0xc7, 0xbf, 0xb8, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xec, 
+  0xe8, 0xe5, 0xff, 0xc7, 0xbe, 0xb8, 0xff, 0x94, 0x85, 0x7a, 0xff, 0x72, 0x5e, 0x50, 0xa4, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73, 0x5f, 0x52, 0xeb, 0xcc, 0xc4, 0xbe, 0xff, 0xf2, 0xef, 0xed, 
+  0xff, 0xe8, 0xe2, 0xde, 0xff, 0x81, 0xe8, 0xe3, 0xdf, 0xff, 0x07, 0xe9, 0xe3, 0xe0, 0xff, 0xe9, 0xe4, 0xe0, 0xff, 0xe5, 0xe0, 0xdc, 0xff, 0xcd, 0xc4, 0xbe, 0xff, 0xc4, 0xba, 0xb3, 0xff, 0xb1, 
+  0xa5, 0x9d, 0xff, 0x8c, 0x7c, 0x70, 0xff, 0x73, 0x61, 0x53, 0xff, 0x81, 0x73, 0x60, 0x52, 0xff, 0x02, 0x9a, 0x8b, 0x81, 0xff, 0xf1, 0xed, 0xeb, 0xff, 0xee, 0xeb, 0xe8, 0xff, 0x81, 0xed, 0xe8, 
+  0xe5, 0xff, 0x03, 0xe0, 0xda, 0xd7, 0xff, 0xc6, 0xbc, 0xb5, 0xff, 0x7c, 0x6a, 0x5d, 0xff, 0x72, 0x60, 0x52, 0x73, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x03, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 
+  0xff, 0xe1, 0xdc, 0xd9, 0xff, 0xf0, 0xec, 0xe9, 0xff, 0x81, 0xe6, 0xe0, 0xdc, 0xff, 0x81, 0xe7, 0xe1, 0xdd, 0xff, 0x0b, 0xe7, 0xe2, 0xdd, 0xff, 0xe7, 0xe2, 0xde, 0xff, 0xe8, 0xe2, 0xde, 0xff, 
+  0xdb, 0xd4, 0xd0, 0xff, 0xc8, 0xc0, 0xb9, 0xff, 0xc3, 0xb9, 0xb2, 0xff, 0xbf, 0xb5, 0xad, 0xff, 0xbd, 0xb3, 0xac, 0xff, 0xd9, 0xd2, 0xce, 0xff, 0xf0, 0xed, 0xea, 0xff, 0xef, 0xeb, 0xe8, 0xff, 
+  0xea, 0xe6, 0xe2, 0xff, 0x81, 0xeb, 0xe6, 0xe3, 0xff, 0x03, 0xd0, 0xc8, 0xc1, 0xff, 0xb7, 0xad, 0xa4, 0xff, 0x73, 0x60, 0x52, 0xff, 0x72, 0x5f, 0x52, 0x28, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x07, 
+  0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd8, 0xd2, 0xcd, 0xff, 0xf3, 0xef, 0xed, 0xff, 0xe7, 0xe2, 0xdd, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xe5, 0xdf, 0xda, 0xff, 
+  0x81, 0xe5, 0xdf, 0xdb, 0xff, 0x00, 0xe6, 0xe0, 0xdb, 0xff, 0x81, 0xe6, 0xe0, 0xdc, 0xff, 0x06, 0xe7, 0xe1, 0xdd, 0xff, 0xe0, 0xd8, 0xd3, 0xff, 0xd5, 0xce, 0xc7, 0xff, 0xda, 0xd3, 0xce, 0xff, 
+  0xed, 0xe8, 0xe5, 0xff, 0xeb, 0xe6, 0xe3, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0x81, 0xe9, 0xe4, 0xe0, 0xff, 0x03, 0xe0, 0xda, 0xd6, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0x93, 0x84, 0x79, 0xff, 0x73, 0x60, 
+  0x52, 0xc7, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd7, 0xd1, 0xcc, 0xff, 0xf2, 0xee, 0xec, 0xff, 0xe6, 0xe0, 0xdb, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 
+  0xd4, 0xcc, 0xc6, 0xff, 0xcf, 0xc6, 0xc0, 0xff, 0xdd, 0xd6, 0xd2, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xe4, 0xdd, 0xd8, 0xff, 0x81, 0xe4, 0xde, 0xd9, 0xff, 0x01, 0xe4, 0xde, 0xda, 0xff, 0xe5, 0xdf, 
+  0xda, 0xff, 0x81, 0xe5, 0xdf, 0xdb, 0xff, 0x00, 0xe6, 0xe0, 0xdb, 0xff, 0x81, 0xe6, 0xe0, 0xdc, 0xff, 0x81, 0xe7, 0xe1, 0xdd, 0xff, 0x04, 0xe5, 0xe0, 0xdb, 0xff, 0xc7, 0xbe, 0xb7, 0xff, 0xb4, 
+  0xa9, 0xa0, 0xff, 0x73, 0x61, 0x53, 0xff, 0x72, 0x61, 0x50, 0x4c, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd6, 0xd0, 0xcb, 0xff, 0xf0, 0xed, 0xeb, 
+  0xff, 0xe4, 0xdd, 0xd9, 0xff, 0xe0, 0xd9, 0xd3, 0xff, 0xc8, 0xbf, 0xb8, 0xff, 0xb8, 0xad, 0xa5, 0xff, 0xc7, 0xbe, 0xb8, 0xff, 0xd6, 0xcf, 0xca, 0xff, 0xe3, 0xdc, 0xd8, 0xff, 0x81, 0xe2, 0xdb, 
+  0xd6, 0xff, 0x04, 0xe2, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd8, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xe4, 0xdd, 0xd9, 0xff, 0x81, 0xe4, 0xde, 0xd9, 0xff, 0x06, 0xe5, 0xde, 0xda, 
+  0xff, 0xe5, 0xdf, 0xda, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xca, 0xc2, 0xba, 0xff, 0xbd, 0xb2, 0xaa, 0xff, 0x7f, 0x6d, 0x61, 0xff, 0x73, 0x60, 0x51, 0xaf, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73, 
+  0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd6, 0xce, 0xc9, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xde, 0xd6, 0xd1, 0xff, 0xc6, 0xbd, 0xb6, 0xff, 0xb6, 0xac, 0xa4, 0xff, 0xc6, 
+  0xbd, 0xb6, 0xff, 0xd5, 0xce, 0xc9, 0xff, 0xe4, 0xdf, 0xdb, 0xff, 0xe7, 0xe1, 0xdd, 0xff, 0x81, 0xe0, 0xd9, 0xd4, 0xff, 0x00, 0xe1, 0xda, 0xd4, 0xff, 0x81, 0xe1, 0xda, 0xd5, 0xff, 0x82, 0xe2, 
+  0xdb, 0xd6, 0xff, 0x07, 0xe2, 0xdc, 0xd7, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xdd, 0xd6, 0xd1, 0xff, 0xc6, 0xbd, 0xb5, 0xff, 0xbc, 0xb2, 0xa9, 0xff, 0x87, 0x76, 0x6a, 0xff, 0x71, 0x60, 0x52, 0xdc, 
+  0x71, 0x63, 0x54, 0x13, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd5, 0xce, 0xc8, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xe1, 0xd9, 0xd4, 0xff, 0xdc, 0xd4, 
+  0xce, 0xff, 0xc5, 0xbb, 0xb3, 0xff, 0xb5, 0xaa, 0xa2, 0xff, 0xc4, 0xbb, 0xb5, 0xff, 0xd3, 0xcc, 0xc7, 0xff, 0xe3, 0xdd, 0xd9, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe3, 0xdc, 0xd8, 0xff, 0xde, 0xd7, 
+  0xd1, 0xff, 0xdf, 0xd7, 0xd1, 0xff, 0xdf, 0xd7, 0xd2, 0xff, 0xdf, 0xd8, 0xd2, 0xff, 0x81, 0xe0, 0xd8, 0xd3, 0xff, 0x81, 0xe0, 0xd9, 0xd4, 0xff, 0x06, 0xdb, 0xd3, 0xcc, 0xff, 0xcd, 0xc4, 0xbd, 
+  0xff, 0xbe, 0xb4, 0xab, 0xff, 0xb5, 0xaa, 0xa0, 0xff, 0x81, 0x70, 0x64, 0xff, 0x71, 0x5e, 0x50, 0xe0, 0x74, 0x5e, 0x50, 0x23, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x73, 0x60, 0x52, 0x94, 0x77, 
+  0x65, 0x57, 0xff, 0xd4, 0xcd, 0xc7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xdf, 0xd7, 0xd1, 0xff, 0xda, 0xd1, 0xcb, 0xff, 0xc3, 0xb9, 0xb1, 0xff, 0xb4, 0xa9, 0xa1, 0xff, 0xc3, 0xba, 0xb3, 0xff, 0xd2, 
+  0xcb, 0xc5, 0xff, 0xe1, 0xdc, 0xd8, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe5, 0xe0, 0xdb, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xcc, 0xc2, 0xbc, 0xff, 0xbd, 0xb2, 0xa9, 0xff, 0xbd, 0xb1, 0xa9, 0xff, 0xc2, 
+  0xb9, 0xb1, 0xff, 0xc8, 0xbe, 0xb6, 0xff, 0xc9, 0xbf, 0xb8, 0xff, 0xc6, 0xbd, 0xb4, 0xff, 0xc1, 0xb5, 0xae, 0xff, 0xbc, 0xb2, 0xa8, 0xff, 0xb8, 0xac, 0xa3, 0xff, 0x9a, 0x8c, 0x81, 0xff, 0x75, 
+  0x62, 0x55, 0xff, 0x71, 0x60, 0x51, 0xbf, 0x74, 0x5f, 0x55, 0x18, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd3, 0xcb, 0xc6, 0xff, 0xec, 0xe8, 0xe5, 
+  0xff, 0xdd, 0xd5, 0xce, 0xff, 0xd8, 0xcf, 0xc8, 0xff, 0xc1, 0xb7, 0xaf, 0xff, 0xb3, 0xa7, 0x9f, 0xff, 0xc2, 0xb8, 0xb1, 0xff, 0xd1, 0xc9, 0xc4, 0xff, 0xe0, 0xdb, 0xd6, 0xff, 0xed, 0xe9, 0xe6, 
+  0xff, 0xe4, 0xde, 0xda, 0xff, 0xda, 0xd2, 0xcb, 0xff, 0xc8, 0xbe, 0xb6, 0xff, 0xba, 0xae, 0xa5, 0xff, 0x9d, 0x8e, 0x84, 0xff, 0x96, 0x87, 0x7c, 0xff, 0xa6, 0x97, 0x8c, 0xff, 0xac, 0x9f, 0x95, 
+  0xff, 0xae, 0xa0, 0x96, 0xff, 0xa9, 0x9c, 0x92, 0xff, 0x9e, 0x90, 0x86, 0xff, 0x8a, 0x79, 0x6d, 0xff, 0x74, 0x61, 0x53, 0xff, 0x73, 0x60, 0x50, 0xe4, 0x74, 0x5f, 0x50, 0x64, 0x7f, 0x7f, 0x7f, 
+  0x03, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x13, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd2, 0xca, 0xc5, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xdb, 0xd3, 0xcd, 0xff, 0xd6, 0xcc, 0xc5, 0xff, 0xc0, 
+  0xb4, 0xac, 0xff, 0xb1, 0xa6, 0x9e, 0xff, 0xc0, 0xb7, 0xb0, 0xff, 0xd0, 0xc8, 0xc2, 0xff, 0xdf, 0xd9, 0xd5, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe4, 0xdd, 0xd8, 0xff, 0xd8, 0xcf, 0xc8, 0xff, 0xc6, 
+  0xbb, 0xb4, 0xff, 0xb8, 0xac, 0xa2, 0xff, 0x93, 0x82, 0x76, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x60, 0x50, 0xc0, 0x73, 0x60, 0x52, 0xef, 0x81, 0x73, 0x60, 0x52, 0xff, 0x04, 0x73, 0x60, 0x50, 
+  0xfc, 0x71, 0x5e, 0x50, 0xdb, 0x73, 0x60, 0x52, 0xa0, 0x74, 0x5e, 0x51, 0x50, 0x7f, 0x55, 0x55, 0x07, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 0x60, 0x52, 0x94, 0x77, 0x64, 0x57, 0xff, 0xd1, 
+  0xc9, 0xc3, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xd9, 0xd0, 0xca, 0xff, 0xd4, 0xca, 0xc2, 0xff, 0xbe, 0xb2, 0xaa, 0xff, 0xb0, 0xa4, 0x9c, 0xff, 0xbf, 0xb5, 0xae, 0xff, 0xce, 0xc6, 0xc1, 0xff, 0xdd, 
+  0xd8, 0xd3, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xe3, 0xdc, 0xd7, 0xff, 0xd6, 0xcc, 0xc5, 0xff, 0xc4, 0xba, 0xb1, 0xff, 0xb7, 0xaa, 0xa0, 0xff, 0x92, 0x82, 0x76, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 
+  0x60, 0x51, 0x43, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x54, 0x54, 0x08, 0x6d, 0x5b, 0x5b, 0x0f, 0x55, 0x55, 0x55, 0x03, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 0x60, 0x52, 0x94, 0x77, 
+  0x64, 0x57, 0xff, 0xd1, 0xc8, 0xc2, 0xff, 0xea, 0xe4, 0xe1, 0xff, 0xd7, 0xce, 0xc7, 0xff, 0xd2, 0xc7, 0xbf, 0xff, 0xbc, 0xb0, 0xa8, 0xff, 0xaf, 0xa3, 0x9a, 0xff, 0xbe, 0xb4, 0xad, 0xff, 0xcd, 
+  0xc5, 0xbf, 0xff, 0xdc, 0xd6, 0xd2, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xd4, 0xca, 0xc3, 0xff, 0xc3, 0xb7, 0xaf, 0xff, 0xb6, 0xa9, 0x9e, 0xff, 0x91, 0x81, 0x75, 0xff, 0x73, 
+  0x60, 0x50, 0xf7, 0x73, 0x60, 0x51, 0x43, 0xab, 0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 0x60, 0x52, 0x94, 0x77, 0x64, 0x57, 0xff, 0xd1, 0xc9, 0xc3, 0xff, 0xea, 0xe5, 0xe2, 0xff, 0xd8, 0xcf, 0xc8, 
+  0xff, 0xd2, 0xc7, 0xbf, 0xff, 0xbb, 0xaf, 0xa7, 0xff, 0xad, 0xa1, 0x99, 0xff, 0xbc, 0xb2, 0xab, 0xff, 0xcc, 0xc4, 0xbe, 0xff, 0xdb, 0xd5, 0xd0, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xe1, 0xda, 0xd4, 
+  0xff, 0xd2, 0xc7, 0xc0, 0xff, 0xc1, 0xb5, 0xab, 0xff, 0xb4, 0xa7, 0x9c, 0xff, 0x91, 0x80, 0x74, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x60, 0x51, 0x43, 0xab, 0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 
+  0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd3, 0xcb, 0xc5, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xda, 0xd2, 0xcc, 0xff, 0xd4, 0xca, 0xc3, 0xff, 0xbc, 0xb1, 0xa8, 0xff, 0xac, 0xa0, 0x97, 0xff, 0xbb, 
+  0xb1, 0xaa, 0xff, 0xca, 0xc2, 0xbc, 0xff, 0xda, 0xd3, 0xce, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xe1, 0xda, 0xd4, 0xff, 0xd1, 0xc6, 0xbf, 0xff, 0xc0, 0xb3, 0xaa, 0xff, 0xb3, 0xa5, 0x9b, 0xff, 0x90, 
+  0x80, 0x73, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x60, 0x51, 0x43, 0xab, 0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd3, 0xcc, 0xc6, 0xff, 0xed, 0xe9, 0xe5, 
+  0xff, 0xdd, 0xd4, 0xce, 0xff, 0xd7, 0xce, 0xc7, 0xff, 0xbe, 0xb2, 0xa9, 0xff, 0xab, 0x9f, 0x96, 0xff, 0xba, 0xb0, 0xa8, 0xff, 0xc9, 0xc1, 0xba, 0xff, 0xd8, 0xd2, 0xcd, 0xff, 0xe7, 0xe3, 0xdf, 
+  0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xd4, 0xca, 0xc2, 0xff, 0xc3, 0xb6, 0xad, 0xff, 0xb4, 0xa7, 0x9d, 0xff, 0x91, 0x80, 0x74, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0xab, 0x00, 0x00, 
+  0x00, 0x00, 0x12, 0x73, 0x60, 0x52, 0x94, 0x77, 0x65, 0x57, 0xff, 0xd5, 0xcd, 0xc8, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xdf, 0xd8, 0xd2, 0xff, 0xda, 0xd1, 0xca, 0xff, 0xbe, 0xb3, 0xab, 0xff, 0xa9, 
+  0x9d, 0x94, 0xff, 0xb9, 0xae, 0xa6, 0xff, 0xc8, 0xbf, 0xb9, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xe6, 0xe1, 0xde, 0xff, 0xe3, 0xdd, 0xd8, 0xff, 0xd7, 0xcd, 0xc6, 0xff, 0xc4, 0xb9, 0xb0, 0xff, 0xb6, 
+  0xaa, 0xa0, 0xff, 0x92, 0x81, 0x75, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0xab, 0x00, 0x00, 0x00, 0x00, 0x12, 0x73, 0x60, 0x52, 0x94, 0x78, 0x65, 0x57, 0xff, 0xd6, 0xcf, 0xc9, 
+  0xff, 0xef, 0xeb, 0xe9, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xbf, 0xb5, 0xad, 0xff, 0xa8, 0x9c, 0x92, 0xff, 0xb7, 0xad, 0xa5, 0xff, 0xc6, 0xbe, 0xb7, 0xff, 0xd6, 0xcf, 0xca, 
+  0xff, 0xe5, 0xe0, 0xdc, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xd9, 0xd0, 0xca, 0xff, 0xc7, 0xbb, 0xb4, 0xff, 0xb8, 0xac, 0xa2, 0xff, 0x92, 0x82, 0x76, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 
+  0x40, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x5f, 0x52, 0x28, 0x73, 0x60, 0x50, 0x53, 0x81, 0x73, 0x5f, 0x52, 0x67, 0x14, 0x71, 0x60, 0x52, 0x4b, 0x6f, 0x5f, 0x4f, 0x20, 0x73, 0x60, 0x52, 
+  0x94, 0x78, 0x65, 0x57, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xf1, 0xed, 0xea, 0xff, 0xe4, 0xdd, 0xd9, 0xff, 0xdf, 0xd8, 0xd2, 0xff, 0xc1, 0xb6, 0xae, 0xff, 0xa7, 0x9a, 0x91, 0xff, 0xb6, 0xab, 0xa3, 
+  0xff, 0xc5, 0xbc, 0xb6, 0xff, 0xd4, 0xcd, 0xc8, 0xff, 0xe4, 0xde, 0xdb, 0xff, 0xe5, 0xe0, 0xdb, 0xff, 0xdc, 0xd4, 0xce, 0xff, 0xc9, 0xbe, 0xb7, 0xff, 0xba, 0xae, 0xa5, 0xff, 0x92, 0x81, 0x76, 
+  0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x5d, 0x50, 0x27, 0x73, 0x60, 0x52, 0x93, 0x73, 0x5e, 0x52, 0xe8, 0x73, 0x60, 0x52, 0xff, 0x75, 
+  0x62, 0x54, 0xff, 0x81, 0x7e, 0x6c, 0x5f, 0xff, 0x13, 0x74, 0x61, 0x54, 0xff, 0x73, 0x60, 0x52, 0xff, 0x78, 0x65, 0x57, 0xff, 0xd8, 0xd1, 0xcd, 0xff, 0xf2, 0xef, 0xec, 0xff, 0xe6, 0xe1, 0xdc, 
+  0xff, 0xe2, 0xdb, 0xd6, 0xff, 0xc1, 0xb7, 0xaf, 0xff, 0xa6, 0x99, 0x8f, 0xff, 0xb5, 0xaa, 0xa2, 0xff, 0xc4, 0xbb, 0xb4, 0xff, 0xd3, 0xcc, 0xc6, 0xff, 0xe2, 0xdd, 0xd9, 0xff, 0xe7, 0xe1, 0xdd, 
+  0xff, 0xdf, 0xd7, 0xd2, 0xff, 0xcb, 0xc1, 0xba, 0xff, 0xbc, 0xb0, 0xa7, 0xff, 0x92, 0x83, 0x77, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x71, 0x5e, 0x52, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x06, 0x77, 
+  0x66, 0x55, 0x0f, 0x73, 0x5f, 0x52, 0x98, 0x71, 0x5e, 0x50, 0xfc, 0x8e, 0x7e, 0x72, 0xff, 0xc7, 0xbe, 0xb8, 0xff, 0xe5, 0xe1, 0xdd, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0x81, 0xf4, 0xf2, 0xf0, 0xff, 
+  0x12, 0xf2, 0xf0, 0xed, 0xff, 0xe4, 0xdf, 0xdc, 0xff, 0xea, 0xe6, 0xe3, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xe4, 0xde, 0xda, 0xff, 0xc2, 0xb8, 0xb1, 0xff, 0xa4, 0x97, 0x8e, 
+  0xff, 0xb3, 0xa8, 0xa0, 0xff, 0xc3, 0xb9, 0xb2, 0xff, 0xd2, 0xca, 0xc5, 0xff, 0xe1, 0xdb, 0xd7, 0xff, 0xe8, 0xe3, 0xdf, 0xff, 0xe1, 0xda, 0xd5, 0xff, 0xcd, 0xc4, 0xbe, 0xff, 0xbd, 0xb2, 0xa9, 
+  0xff, 0x93, 0x84, 0x79, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x5f, 0x53, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x73, 0x61, 0x54, 0x2b, 0x71, 0x60, 0x51, 0xdf, 0x85, 0x74, 0x68, 0xff, 0xd6, 
+  0xd0, 0xcc, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xef, 0xeb, 0xe7, 0xff, 0xed, 0xe9, 0xe6, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xef, 
+  0xec, 0xe9, 0xff, 0xef, 0xeb, 0xe9, 0xff, 0xea, 0xe4, 0xe1, 0xff, 0xe7, 0xe2, 0xdd, 0xff, 0xc4, 0xba, 0xb3, 0xff, 0xa3, 0x96, 0x8c, 0xff, 0xb2, 0xa7, 0x9f, 0xff, 0xc1, 0xb8, 0xb1, 0xff, 0xd0, 
+  0xc9, 0xc3, 0xff, 0xe0, 0xda, 0xd6, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xe4, 0xde, 0xd9, 0xff, 0xd0, 0xc7, 0xc1, 0xff, 0xbf, 0xb5, 0xac, 0xff, 0x94, 0x85, 0x7a, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 
+  0x5f, 0x53, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x71, 0x60, 0x4f, 0x2c, 0x73, 0x5e, 0x50, 0xec, 0xa0, 0x92, 0x88, 0xff, 0xf2, 0xf0, 0xee, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf1, 0xed, 0xeb, 
+  0xff, 0xed, 0xe9, 0xe6, 0xff, 0xed, 0xe8, 0xe5, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xeb, 0xe7, 0xe4, 0xff, 0x81, 0xeb, 0xe6, 0xe3, 0xff, 0x0e, 0xea, 0xe6, 0xe2, 0xff, 0xea, 
+  0xe5, 0xe1, 0xff, 0xdb, 0xd5, 0xd1, 0xff, 0xa2, 0x94, 0x8b, 0xff, 0xb1, 0xa5, 0x9d, 0xff, 0xc0, 0xb6, 0xaf, 0xff, 0xcf, 0xc8, 0xc2, 0xff, 0xde, 0xd9, 0xd4, 0xff, 0xea, 0xe6, 0xe2, 0xff, 0xe7, 
+  0xe1, 0xdd, 0xff, 0xd2, 0xca, 0xc3, 0xff, 0xc1, 0xb6, 0xaf, 0xff, 0x95, 0x86, 0x7b, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x73, 0x5f, 0x53, 0x40, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x5d, 0x50, 
+  0x13, 0x73, 0x5e, 0x52, 0xe3, 0xa2, 0x95, 0x8c, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 0xf0, 0xee, 0xeb, 0xff, 0xf0, 0xec, 0xea, 0xff, 0xef, 0xec, 0xe9, 0xff, 0xef, 0xeb, 0xe9, 
+  0xff, 0xef, 0xeb, 0xe8, 0xff, 0x81, 0xee, 0xea, 0xe7, 0xff, 0x81, 0xed, 0xe9, 0xe6, 0xff, 0x0d, 0xed, 0xe8, 0xe5, 0xff, 0xec, 0xe8, 0xe5, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xaf, 0xa4, 0x9b, 0xff, 
+  0xbf, 0xb5, 0xae, 0xff, 0xce, 0xc6, 0xc0, 0xff, 0xdd, 0xd7, 0xd3, 0xff, 0xeb, 0xe7, 0xe3, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xd4, 0xcd, 0xc7, 0xff, 0xc3, 0xb9, 0xb1, 0xff, 0x96, 0x87, 0x7c, 0xff, 
+  0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x72, 0x5e, 0x50, 0xa4, 0x8a, 0x79, 0x6e, 0xff, 0xf5, 0xf4, 0xf2, 0xff, 0xf8, 0xf6, 0xf5, 0xff, 0xf3, 0xf0, 
+  0xee, 0xff, 0xf2, 0xf0, 0xed, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf2, 0xef, 0xec, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xf1, 0xee, 0xeb, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0x81, 0xf0, 0xec, 0xea, 0xff, 0x00, 
+  0xef, 0xec, 0xe9, 0xff, 0x81, 0xef, 0xeb, 0xe8, 0xff, 0x0a, 0xec, 0xe7, 0xe4, 0xff, 0xc5, 0xbd, 0xb6, 0xff, 0xcd, 0xc5, 0xbf, 0xff, 0xdc, 0xd6, 0xd1, 0xff, 0xec, 0xe7, 0xe4, 0xff, 0xec, 0xe8, 
+  0xe5, 0xff, 0xd6, 0xcf, 0xca, 0xff, 0xc5, 0xbb, 0xb4, 0xff, 0x97, 0x88, 0x7d, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x73, 0x61, 0x53, 0x37, 
+  0x73, 0x60, 0x52, 0xff, 0xe0, 0xdc, 0xd9, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xf6, 0xf3, 0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf5, 0xf2, 0xf1, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 
+  0xf4, 0xf1, 0xef, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0xf2, 0xf0, 0xed, 0xff, 0xf2, 0xef, 0xed, 0xff, 0xf2, 0xee, 0xec, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xf1, 0xee, 0xeb, 0xff, 
+  0xf0, 0xed, 0xeb, 0xff, 0xee, 0xea, 0xe8, 0xff, 0xe9, 0xe4, 0xe1, 0xff, 0xee, 0xea, 0xe7, 0xff, 0xef, 0xeb, 0xe8, 0xff, 0xd9, 0xd3, 0xcd, 0xff, 0xc7, 0xbd, 0xb6, 0xff, 0x97, 0x89, 0x7f, 0xff, 
+  0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x11, 0x73, 0x60, 0x52, 0xab, 0x9d, 0x90, 0x87, 0xff, 0xfc, 0xfb, 0xfb, 0xff, 0xf9, 0xf8, 0xf7, 0xff, 0xf8, 0xf6, 
+  0xf5, 0xff, 0xf7, 0xf6, 0xf4, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xde, 0xd8, 0xd3, 0xff, 0xcf, 0xc8, 0xc3, 0xff, 0xcc, 0xc5, 0xbe, 0xff, 0xd1, 0xc9, 0xc5, 0xff, 0xda, 0xd5, 0xd0, 0xff, 0xea, 0xe5, 
+  0xe3, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 0xf4, 0xf1, 0xef, 0xff, 0xf3, 0xf0, 0xef, 0xff, 0xf3, 0xf0, 0xee, 0xff, 0x81, 0xf2, 0xef, 0xed, 0xff, 0x05, 0xf2, 0xee, 0xec, 0xff, 
+  0xe3, 0xde, 0xda, 0xff, 0xc9, 0xc1, 0xba, 0xff, 0x98, 0x8a, 0x80, 0xff, 0x72, 0x5e, 0x52, 0xf4, 0x73, 0x5f, 0x53, 0x40, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x19, 0x6a, 0x6a, 0x55, 0x0c, 0x73, 0x5e, 
+  0x52, 0xf8, 0xd9, 0xd4, 0xd1, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xfa, 0xf9, 0xf8, 0xff, 0xfa, 0xf8, 0xf8, 0xff, 0xda, 0xd5, 0xd1, 0xff, 0xca, 0xc3, 0xbd, 0xff, 0xaa, 0x9d, 
+  0x94, 0xff, 0x9c, 0x8f, 0x84, 0xff, 0xaa, 0x9d, 0x95, 0xff, 0xc0, 0xb8, 0xb0, 0xff, 0xcd, 0xc5, 0xc0, 0xff, 0xd5, 0xcf, 0xc9, 0xff, 0xec, 0xe9, 0xe6, 0xff, 0xf6, 0xf4, 0xf2, 0xff, 0xf5, 0xf3, 
+  0xf2, 0xff, 0xf5, 0xf3, 0xf1, 0xff, 0xf5, 0xf2, 0xf1, 0xff, 0xf4, 0xf2, 0xf0, 0xff, 0xf4, 0xf1, 0xf0, 0xff, 0xda, 0xd4, 0xcf, 0xff, 0xbd, 0xb2, 0xaa, 0xff, 0x73, 0x60, 0x52, 0xff, 0x74, 0x5e, 
+  0x53, 0x47, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x19, 0x72, 0x60, 0x51, 0x44, 0x75, 0x62, 0x54, 0xff, 0xf8, 0xf7, 0xf6, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfc, 0xfc, 0xfb, 0xff, 
+  0xed, 0xea, 0xe9, 0xff, 0xd0, 0xc9, 0xc4, 0xff, 0x91, 0x81, 0x77, 0xff, 0x73, 0x5e, 0x52, 0xe8, 0x73, 0x5f, 0x52, 0xb3, 0x73, 0x5e, 0x50, 0xdc, 0x73, 0x60, 0x52, 0xff, 0x8b, 0x7c, 0x70, 0xff, 
+  0xbd, 0xb4, 0xad, 0xff, 0xce, 0xc7, 0xc1, 0xff, 0xdf, 0xdb, 0xd8, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xf7, 0xf6, 0xf4, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xf7, 0xf5, 0xf3, 0xff, 0xf6, 0xf4, 0xf3, 0xff, 
+  0xe1, 0xdd, 0xd9, 0xff, 0xc6, 0xbe, 0xb8, 0xff, 0x73, 0x60, 0x52, 0xff, 0x70, 0x62, 0x53, 0x34, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x61, 0x51, 0x70, 0x88, 0x78, 0x6c, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0xff, 0x04, 0xfd, 0xfd, 0xfd, 0xff, 0xd6, 0xd1, 0xcd, 0xff, 0xba, 0xb2, 0xab, 0xff, 0x73, 0x60, 0x52, 0xff, 0x74, 0x5f, 0x4f, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 0x60, 
+  0x51, 0x34, 0x73, 0x60, 0x51, 0xaf, 0x74, 0x61, 0x53, 0xff, 0x9e, 0x91, 0x87, 0xff, 0xcc, 0xc6, 0xc1, 0xff, 0xdb, 0xd5, 0xd2, 0xff, 0xf8, 0xf6, 0xf6, 0xff, 0x81, 0xf9, 0xf8, 0xf7, 0xff, 0x04, 
+  0xf8, 0xf7, 0xf6, 0xff, 0xec, 0xea, 0xe7, 0xff, 0xcd, 0xc6, 0xc0, 0xff, 0x7e, 0x6c, 0x5e, 0xff, 0x73, 0x5f, 0x52, 0x63, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x60, 0x51, 0x88, 0x9c, 0x8e, 
+  0x85, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xea, 0xe7, 0xe5, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0x82, 0x72, 0x65, 0xff, 0x72, 0x60, 0x51, 0x9c, 0x84, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x72, 0x60, 
+  0x52, 0x47, 0x71, 0x60, 0x52, 0xe8, 0x8d, 0x7d, 0x72, 0xff, 0xce, 0xc7, 0xc2, 0xff, 0xe2, 0xdd, 0xda, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xf3, 0xf1, 
+  0xf0, 0xff, 0xcf, 0xc8, 0xc2, 0xff, 0x8b, 0x7b, 0x6f, 0xff, 0x72, 0x5f, 0x51, 0x83, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x5f, 0x52, 0x8b, 0x9e, 0x91, 0x87, 0xff, 0x81, 0xff, 0xff, 0xff, 
+  0xff, 0x04, 0xfb, 0xfb, 0xfa, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xaf, 0xa5, 0x9d, 0xff, 0x73, 0x5f, 0x50, 0xf3, 0x74, 0x5f, 0x55, 0x18, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0x5f, 0x4f, 0x20, 
+  0x73, 0x60, 0x52, 0xe7, 0xa3, 0x96, 0x8c, 0xff, 0xde, 0xda, 0xd6, 0xff, 0xfb, 0xfb, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xf7, 0xf5, 0xf4, 0xff, 0xd0, 0xca, 0xc4, 0xff, 
+  0x8c, 0x7c, 0x71, 0xff, 0x72, 0x5f, 0x51, 0x87, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x60, 0x52, 0x78, 0x8e, 0x7f, 0x73, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xe4, 0xe1, 0xde, 0xff, 
+  0xce, 0xc6, 0xc2, 0xff, 0x7a, 0x66, 0x5a, 0xff, 0x72, 0x60, 0x51, 0x7b, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x72, 0x61, 0x52, 0x68, 0x79, 0x66, 0x5a, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 
+  0xf4, 0xf2, 0xf1, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0x82, 0x72, 0x65, 0xff, 0x73, 0x5f, 0x52, 0x73, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x60, 0x50, 0x53, 0x76, 0x63, 0x55, 0xff, 0xfc, 0xfc, 
+  0xfb, 0xff, 0xfa, 0xfa, 0xf9, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0xa2, 0x95, 0x8b, 0xff, 0x72, 0x60, 0x50, 0xe0, 0x71, 0x54, 0x54, 0x08, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x73, 0x5e, 0x51, 0x9c, 
+  0x8f, 0x7f, 0x74, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0xeb, 0xe8, 0xe6, 0xff, 0xcf, 0xc9, 0xc4, 0xff, 0x74, 0x61, 0x53, 0xff, 0x73, 0x60, 0x52, 0x4c, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x06, 
+  0x73, 0x5c, 0x51, 0x17, 0x73, 0x60, 0x50, 0xfc, 0xe1, 0xdc, 0xd9, 0xff, 0xf5, 0xf4, 0xf3, 0xff, 0xc7, 0xbf, 0xb9, 0xff, 0x75, 0x62, 0x54, 0xff, 0x73, 0x5f, 0x51, 0x58, 0x87, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x72, 0x5d, 0x53, 0x30, 0x73, 0x60, 0x52, 0xff, 0xde, 0xda, 0xd6, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0xde, 0xd9, 0xd5, 0xff, 0xbd, 0xb4, 0xad, 0xff, 0x71, 0x5e, 0x50, 0xfc, 
+  0x78, 0x5d, 0x50, 0x13, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x04, 0x71, 0x5e, 0x52, 0xac, 0xa2, 0x95, 0x8d, 0xff, 0xf1, 0xf0, 0xee, 0xff, 0x93, 0x85, 0x7a, 0xff, 0x72, 0x60, 0x52, 0xc7, 0x88, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x71, 0x60, 0x51, 0xbf, 0x9e, 0x91, 0x87, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf8, 0xf6, 0xf6, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0x99, 0x8b, 0x81, 0xff, 0x71, 0x5e, 
+  0x52, 0xbc, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0x5f, 0x53, 0x43, 0x75, 0x62, 0x54, 0xff, 0xb3, 0xa8, 0xa1, 0xff, 0x73, 0x60, 0x52, 0xff, 0x73, 0x61, 0x53, 0x37, 0x87, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0x72, 0x5f, 0x52, 0x50, 0x75, 0x62, 0x54, 0xff, 0xed, 0xeb, 0xe9, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x03, 0xde, 0xda, 0xd6, 0xff, 0xc7, 0xbf, 0xb9, 0xff, 0x74, 0x61, 0x53, 0xff, 
+  0x74, 0x5e, 0x51, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0x5f, 0x52, 0x88, 0x73, 0x60, 0x52, 0xdf, 0x73, 0x60, 0x51, 0x84, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6d, 0x6d, 0x48, 0x07, 
+  0x71, 0x60, 0x52, 0xdc, 0xb4, 0xaa, 0xa2, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x04, 0xea, 0xe7, 0xe4, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0x8f, 0x80, 0x75, 0xff, 0x73, 0x60, 0x52, 0xc8, 0x7f, 0x7f, 
+  0x7f, 0x03, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x73, 0x5f, 0x52, 0x73, 0x7a, 0x68, 0x5b, 0xff, 0xf6, 0xf5, 0xf4, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x04, 0xea, 0xe7, 0xe5, 0xff, 0xd2, 0xcc, 
+  0xc7, 0xff, 0xa7, 0x9a, 0x92, 0xff, 0x73, 0x60, 0x50, 0xf7, 0x70, 0x5e, 0x53, 0x2b, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6d, 0x61, 0x54, 0x14, 0x71, 0x5e, 0x50, 0xf0, 0xc9, 0xc2, 0xbd, 0xff, 
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf9, 0xf9, 0xf8, 0xff, 0xe0, 0xdc, 0xd9, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0xa9, 0x9d, 0x94, 0xff, 0x71, 0x5e, 0x50, 0xfc, 0x73, 0x61, 0x51, 0x54, 0xb4, 0x00, 
+  0x00, 0x00, 0x00, 0x09, 0x72, 0x5f, 0x52, 0x94, 0x87, 0x77, 0x6b, 0xff, 0xf6, 0xf5, 0xf4, 0xff, 0xe6, 0xe3, 0xe0, 0xff, 0xe0, 0xdc, 0xd8, 0xff, 0xd3, 0xcd, 0xc8, 0xff, 0xca, 0xc4, 0xbe, 0xff, 
+  0x95, 0x86, 0x7b, 0xff, 0x71, 0x60, 0x50, 0xf8, 0x72, 0x60, 0x52, 0x57, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x09, 0x72, 0x60, 0x4f, 0x1c, 0x73, 0x60, 0x50, 0xfc, 0xc4, 0xbc, 0xb6, 0xff, 0xd4, 0xce, 
+  0xc9, 0xff, 0xd2, 0xcc, 0xc7, 0xff, 0xc5, 0xbc, 0xb6, 0xff, 0xa4, 0x96, 0x8d, 0xff, 0x77, 0x64, 0x57, 0xff, 0x71, 0x5f, 0x52, 0xd3, 0x73, 0x5f, 0x50, 0x33, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x74, 0x5f, 0x55, 0x18, 0x73, 0x60, 0x50, 0xf7, 0x89, 0x79, 0x6e, 0xff, 0x86, 0x75, 0x6a, 0xff, 0x76, 0x64, 0x56, 0xff, 0x73, 0x60, 0x52, 0xff, 0x71, 0x5f, 0x52, 0xd3, 0x73, 0x5f, 0x52, 0x63, 
+  0x7f, 0x7f, 0x3f, 0x04, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73, 0x60, 0x51, 0x34, 0x72, 0x5f, 0x52, 0x94, 0x73, 0x60, 0x52, 0x7c, 0x72, 0x61, 0x53, 0x58, 0x73, 0x61, 0x54, 0x2b, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +463,7 @@ const lv_img_dsc_t utilities_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( utilities_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = utilities_64px_map,
 };
-
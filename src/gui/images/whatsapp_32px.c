@@ -10,143 +10,167 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_WHATSAPP_32PX uint8_t whatsapp_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3e, 0x03, 0x3e, 0x14, 0x3e, 0x50, 0x3e, 0x83, 0x3e, 0x9c, 0x3e, 0xac, 0x3e, 0xb3, 0x3e, 0x9b, 0x3e, 0x83, 0x3e, 0x4c, 0x3e, 0x17, 0x3e, 0x03, 0x39, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x3e, 0x07, 0x3e, 0x4c, 0x3e, 0xb0, 0x3e, 0xf7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xfb, 0x3e, 0xb4, 0x3e, 0x54, 0x3e, 0x0b, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x3a, 0x00, 0x3e, 0x43, 0x3e, 0xc4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xd0, 0x3e, 0x4b, 0x3a, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x3e, 0x03, 0x3e, 0x80, 0x3e, 0xf8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xfb, 0x3e, 0x8b, 0x3e, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x3e, 0x08, 0x3e, 0xa7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xaf, 0x3e, 0x0c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x3e, 0x04, 0x3e, 0xa8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xaf, 0x3e, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x8b, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x98, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x35, 0x00, 0x3e, 0x43, 0x3e, 0xf8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xfb, 0x3e, 0x4c, 0x39, 0x00, 0x00, 0x00, 
-  0x0d, 0x00, 0x3e, 0x08, 0x3e, 0xcb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xd8, 0x3e, 0x0f, 0x05, 0x00, 
-  0x39, 0x00, 0x3e, 0x4f, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x60, 0x39, 0x00, 
-  0x3e, 0x03, 0x3e, 0xb4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xc4, 0x3e, 0x04, 
-  0x3e, 0x14, 0x3e, 0xf7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x23, 
-  0x3e, 0x50, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x5f, 
-  0x3e, 0x84, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x90, 
-  0x3e, 0xa4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xb8, 
-  0x3e, 0xb4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xcb, 
-  0x3e, 0xb7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xcb, 
-  0x3e, 0xa3, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xb7, 
-  0x3e, 0x80, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0xbf, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x98, 
-  0x3e, 0x53, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x68, 
-  0x3e, 0x1b, 0x3e, 0xfb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x24, 
-  0x3e, 0x04, 0x3e, 0xbc, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xc7, 0x3e, 0x04, 
-  0x39, 0x00, 0x3e, 0x5b, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x68, 0x35, 0x00, 
-  0x2c, 0x00, 0x3e, 0x0c, 0x3e, 0xd4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xdc, 0x3e, 0x0f, 0x31, 0x00, 
-  0x00, 0x00, 0x39, 0x00, 0x3e, 0x4f, 0x3e, 0xfb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xfc, 0x3e, 0x5f, 0x39, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x3e, 0xe7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x9e, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xa7, 0x3e, 0x00, 0x11, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x35, 0x00, 0x3e, 0x33, 0x3e, 0xf8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xc3, 0x3e, 0x0f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x39, 0x00, 0x3e, 0x7f, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xcb, 0x3e, 0x10, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x04, 0x00, 0x3e, 0x04, 0x3e, 0xcf, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xb0, 0x3e, 0x0f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x3e, 0x2f, 0x3e, 0xf8, 0x3e, 0xff, 0x3e, 0xf8, 0x3e, 0xcf, 0x3e, 0x80, 0x3e, 0x6b, 0x3e, 0xdb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe0, 0x3e, 0x67, 0x3d, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x3e, 0x78, 0x3e, 0xbf, 0x3e, 0x74, 0x3e, 0x2c, 0x3e, 0x04, 0x39, 0x00, 0x35, 0x00, 0x3e, 0x0f, 0x3e, 0x63, 0x3e, 0xc8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xcf, 0x3e, 0x6f, 0x3e, 0x13, 0x3a, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x35, 0x00, 0x3e, 0x0b, 0x3e, 0x04, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x35, 0x00, 0x3e, 0x07, 0x3e, 0x23, 0x3e, 0x6c, 0x3e, 0x97, 0x3e, 0xbc, 0x3e, 0xcc, 0x3e, 0xd3, 0x3e, 0xbf, 0x3e, 0x9f, 0x3e, 0x70, 0x3e, 0x28, 0x3e, 0x07, 0x35, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x0b, 0x3e, 0x03, 0x3e, 0x14, 0x3e, 0x50, 0x3e, 0x83, 0x3e, 0x9c, 0x3e, 0xac, 0x3e, 0xb3, 0x3e, 0x9b, 0x3e, 0x83, 0x3e, 0x4c, 0x3e, 0x17, 0x3e, 0x03, 
+  0x91, 0x00, 0x00, 0x03, 0x3e, 0x07, 0x3e, 0x4c, 0x3e, 0xb0, 0x3e, 0xf7, 0x87, 0x3e, 0xff, 0x03, 0x3e, 0xfb, 0x3e, 0xb4, 0x3e, 0x54, 0x3e, 0x0b, 0x8e, 0x00, 0x00, 0x01, 0x3e, 0x43, 0x3e, 0xc4, 
+  0x8d, 0x3e, 0xff, 0x01, 0x3e, 0xd0, 0x3e, 0x4b, 0x8b, 0x00, 0x00, 0x02, 0x3e, 0x03, 0x3e, 0x80, 0x3e, 0xf8, 0x8f, 0x3e, 0xff, 0x02, 0x3e, 0xfb, 0x3e, 0x8b, 0x3e, 0x04, 0x88, 0x00, 0x00, 0x01, 
+  0x3e, 0x08, 0x3e, 0xa7, 0x93, 0x3e, 0xff, 0x01, 0x3e, 0xaf, 0x3e, 0x0c, 0x86, 0x00, 0x00, 0x01, 0x3e, 0x04, 0x3e, 0xa8, 0x95, 0x3e, 0xff, 0x01, 0x3e, 0xaf, 0x3e, 0x07, 0x85, 0x00, 0x00, 0x00, 
+  0x3e, 0x8b, 0x84, 0x3e, 0xff, 0x01, 0xbf, 0xff, 0x9e, 0xff, 0x90, 0x3e, 0xff, 0x00, 0x3e, 0x98, 0x84, 0x00, 0x00, 0x01, 0x3e, 0x43, 0x3e, 0xf8, 0x82, 0x3e, 0xff, 0x00, 0x5e, 0xff, 0x82, 0xff, 
+  0xff, 0x00, 0xdf, 0xff, 0x8f, 0x3e, 0xff, 0x01, 0x3e, 0xfb, 0x3e, 0x4c, 0x82, 0x00, 0x00, 0x01, 0x3e, 0x08, 0x3e, 0xcb, 0x83, 0x3e, 0xff, 0x00, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x00, 0x5e, 0xff, 
+  0x8f, 0x3e, 0xff, 0x01, 0x3e, 0xd8, 0x3e, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x3e, 0x4f, 0x83, 0x3e, 0xff, 0x00, 0x7e, 0xff, 0x84, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x90, 0x3e, 0xff, 0x03, 0x3e, 0x60, 
+  0x00, 0x00, 0x3e, 0x03, 0x3e, 0xb4, 0x83, 0x3e, 0xff, 0x00, 0xbf, 0xff, 0x85, 0xff, 0xff, 0x00, 0x3d, 0xff, 0x8f, 0x3e, 0xff, 0x03, 0x3e, 0xc4, 0x3e, 0x04, 0x3e, 0x14, 0x3e, 0xf7, 0x83, 0x3e, 
+  0xff, 0x00, 0xbf, 0xff, 0x85, 0xff, 0xff, 0x00, 0x7e, 0xff, 0x90, 0x3e, 0xff, 0x01, 0x3e, 0x23, 0x3e, 0x50, 0x84, 0x3e, 0xff, 0x00, 0xbf, 0xff, 0x85, 0xff, 0xff, 0x91, 0x3e, 0xff, 0x01, 0x3e, 
+  0x5f, 0x3e, 0x84, 0x84, 0x3e, 0xff, 0x00, 0x7e, 0xff, 0x84, 0xff, 0xff, 0x00, 0x7e, 0xff, 0x91, 0x3e, 0xff, 0x01, 0x3e, 0x90, 0x3e, 0xa4, 0x84, 0x3e, 0xff, 0x00, 0x3d, 0xff, 0x83, 0xff, 0xff, 
+  0x00, 0xdf, 0xff, 0x92, 0x3e, 0xff, 0x01, 0x3e, 0xb8, 0x3e, 0xb4, 0x85, 0x3e, 0xff, 0x00, 0x9e, 0xff, 0x83, 0xff, 0xff, 0x00, 0x5e, 0xff, 0x91, 0x3e, 0xff, 0x01, 0x3e, 0xcb, 0x3e, 0xb7, 0x86, 
+  0x3e, 0xff, 0x00, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x91, 0x3e, 0xff, 0x01, 0x3e, 0xcb, 0x3e, 0xa3, 0x86, 0x3e, 0xff, 0x00, 0x5e, 0xff, 0x83, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x90, 
+  0x3e, 0xff, 0x01, 0x3e, 0xb7, 0x3e, 0x80, 0x87, 0x3e, 0xff, 0x00, 0x9e, 0xff, 0x83, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x84, 0x3e, 0xff, 0x02, 0x7e, 0xff, 0xbf, 0xff, 0x5e, 0xff, 0x87, 0x3e, 0xff, 
+  0x01, 0x3e, 0x98, 0x3e, 0x53, 0x88, 0x3e, 0xff, 0x00, 0xbf, 0xff, 0x83, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x5e, 0xff, 0x81, 0x3e, 0xff, 0x00, 0x7e, 0xff, 0x82, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x86, 
+  0x3e, 0xff, 0x02, 0x3e, 0x68, 0x3e, 0x1b, 0x3e, 0xfb, 0x88, 0x3e, 0xff, 0x00, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x01, 0xbf, 0xff, 0x7e, 0xff, 0x85, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x84, 0x3e, 0xff, 
+  0x02, 0x3e, 0x24, 0x3e, 0x04, 0x3e, 0xbc, 0x89, 0x3e, 0xff, 0x00, 0xbf, 0xff, 0x8c, 0xff, 0xff, 0x83, 0x3e, 0xff, 0x03, 0x3e, 0xc7, 0x3e, 0x04, 0x00, 0x00, 0x3e, 0x5b, 0x8a, 0x3e, 0xff, 0x00, 
+  0x9f, 0xff, 0x8b, 0xff, 0xff, 0x00, 0x3d, 0xff, 0x82, 0x3e, 0xff, 0x00, 0x3e, 0x68, 0x81, 0x00, 0x00, 0x01, 0x3e, 0x0c, 0x3e, 0xd4, 0x8a, 0x3e, 0xff, 0x01, 0x5e, 0xff, 0xdf, 0xff, 0x88, 0xff, 
+  0xff, 0x00, 0x9f, 0xff, 0x82, 0x3e, 0xff, 0x01, 0x3e, 0xdc, 0x3e, 0x0f, 0x82, 0x00, 0x00, 0x01, 0x3e, 0x4f, 0x3e, 0xfb, 0x8b, 0x3e, 0xff, 0x01, 0x5e, 0xff, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x00, 
+  0xbf, 0xff, 0x82, 0x3e, 0xff, 0x01, 0x3e, 0xfc, 0x3e, 0x5f, 0x84, 0x00, 0x00, 0x00, 0x3e, 0xe7, 0x8e, 0x3e, 0xff, 0x04, 0x9e, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x5e, 0xff, 0x83, 0x3e, 
+  0xff, 0x00, 0x3e, 0xa7, 0x84, 0x00, 0x00, 0x01, 0x3e, 0x33, 0x3e, 0xf8, 0x96, 0x3e, 0xff, 0x01, 0x3e, 0xc3, 0x3e, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x3e, 0x7f, 0x96, 0x3e, 0xff, 0x01, 0x3e, 0xcb, 
+  0x3e, 0x10, 0x84, 0x00, 0x00, 0x01, 0x3e, 0x04, 0x3e, 0xcf, 0x95, 0x3e, 0xff, 0x01, 0x3e, 0xb0, 0x3e, 0x0f, 0x85, 0x00, 0x00, 0x07, 0x3e, 0x2f, 0x3e, 0xf8, 0x3e, 0xff, 0x3e, 0xf8, 0x3e, 0xcf, 
+  0x3e, 0x80, 0x3e, 0x6b, 0x3e, 0xdb, 0x8d, 0x3e, 0xff, 0x01, 0x3e, 0xe0, 0x3e, 0x67, 0x87, 0x00, 0x00, 0x04, 0x3e, 0x78, 0x3e, 0xbf, 0x3e, 0x74, 0x3e, 0x2c, 0x3e, 0x04, 0x81, 0x00, 0x00, 0x02, 
+  0x3e, 0x0f, 0x3e, 0x63, 0x3e, 0xc8, 0x89, 0x3e, 0xff, 0x02, 0x3e, 0xcf, 0x3e, 0x6f, 0x3e, 0x13, 0x88, 0x00, 0x00, 0x01, 0x3e, 0x0b, 0x3e, 0x04, 0x86, 0x00, 0x00, 0x0b, 0x3e, 0x07, 0x3e, 0x23, 
+  0x3e, 0x6c, 0x3e, 0x97, 0x3e, 0xbc, 0x3e, 0xcc, 0x3e, 0xd3, 0x3e, 0xbf, 0x3e, 0x9f, 0x3e, 0x70, 0x3e, 0x28, 0x3e, 0x07, 0x89, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x13, 0x00, 0x6a, 0x1d, 0x00, 0x8d, 0x2e, 0x03, 0xad, 0x26, 0x14, 0xad, 0x2e, 0x50, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0x9c, 0xad, 0x2e, 0xac, 0xad, 0x2e, 0xb3, 0xad, 0x2e, 0x9b, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0x4c, 0x8d, 0x2e, 0x17, 0xad, 0x2e, 0x03, 0x8b, 0x25, 0x00, 0xe4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0x00, 0x8c, 0x2e, 0x07, 0xad, 0x2e, 0x4c, 0xad, 0x2e, 0xb0, 0xad, 0x2e, 0xf7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0x54, 0xad, 0x26, 0x0b, 0x4a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x13, 0x00, 0x2c, 0x1e, 0x00, 0xad, 0x2e, 0x43, 0xad, 0x2e, 0xc4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xd0, 0xad, 0x2e, 0x4b, 0xcd, 0x25, 0x00, 0x86, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x13, 0x00, 0xcd, 0x2e, 0x03, 0xad, 0x2e, 0x80, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0x8b, 0xcd, 0x26, 0x04, 0x87, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x13, 0x00, 0xad, 0x26, 0x08, 0xad, 0x2e, 0xa7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xaf, 0x8d, 0x2e, 0x0c, 0x67, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x13, 0x00, 0x8d, 0x26, 0x04, 0xad, 0x2e, 0xa8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xaf, 0x8d, 0x2e, 0x07, 0x86, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x8b, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x14, 0x97, 0xff, 0x14, 0x8f, 0xff, 0xad, 0x36, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x98, 0xeb, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x49, 0x1d, 0x00, 0xad, 0x2e, 0x43, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xae, 0x36, 0xff, 0xdd, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xc7, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0x4c, 0xcb, 0x25, 0x00, 0x00, 0x00, 0x00, 
-  0x67, 0x13, 0x00, 0xad, 0x2e, 0x08, 0xad, 0x2e, 0xcb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x26, 0xff, 0x9b, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x36, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xd8, 0xad, 0x2e, 0x0f, 0xe5, 0x00, 0x00, 
-  0x8a, 0x1d, 0x00, 0xad, 0x2e, 0x4f, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xf1, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xa7, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x60, 0xea, 0x1d, 0x00, 
-  0xad, 0x2e, 0x03, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x37, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xe7, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xc4, 0xad, 0x2e, 0x04, 
-  0x8d, 0x2e, 0x14, 0xad, 0x2e, 0xf7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xac, 0x26, 0xff, 0x58, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x56, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x23, 
-  0x8d, 0x26, 0x50, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x36, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x5f, 
-  0xad, 0x2e, 0x84, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xd1, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf1, 0x6e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x90, 
-  0xad, 0x2e, 0xa4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0xbc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xbf, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xb8, 
-  0xad, 0x2e, 0xb4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xf2, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xae, 0x3e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xcb, 
-  0xad, 0x2e, 0xb7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x79, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd7, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xcb, 
-  0xad, 0x2e, 0xa3, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xae, 0x3e, 0xff, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xaf, 0xff, 0xac, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xb7, 
-  0xad, 0x2e, 0x80, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xf3, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xaf, 0xff, 0xac, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xf1, 0x6e, 0xff, 0x57, 0xa7, 0xff, 0xae, 0x46, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x98, 
-  0xad, 0x2e, 0x53, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x36, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd7, 0xff, 0xcf, 0x46, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xd0, 0x5e, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x57, 0xaf, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x68, 
-  0xad, 0x26, 0x1b, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xac, 0x26, 0xff, 0x78, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x57, 0xaf, 0xff, 0xd0, 0x66, 0xff, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0x35, 0x97, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8d, 0x2e, 0x24, 
-  0x8d, 0x26, 0x04, 0xad, 0x2e, 0xbc, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xac, 0x26, 0xff, 0x58, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xef, 0xff, 0xad, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xc7, 0xad, 0x26, 0x04, 
-  0xcb, 0x25, 0x00, 0xad, 0x2e, 0x5b, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x15, 0x97, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd7, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x68, 0x0a, 0x25, 0x00, 
-  0xe4, 0x12, 0x00, 0xad, 0x2e, 0x0c, 0xad, 0x2e, 0xd4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xcf, 0x4e, 0xff, 0x79, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x8f, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0x0f, 0xc6, 0x1b, 0x00, 
-  0x00, 0x00, 0x00, 0xea, 0x25, 0x00, 0xad, 0x2e, 0x4f, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xcf, 0x4e, 0xff, 0x78, 0xbf, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x35, 0x97, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xfc, 0xad, 0x2e, 0x5f, 0xab, 0x25, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x26, 0x00, 0xad, 0x2e, 0xe7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xac, 0x26, 0xff, 0xac, 0x1e, 0xff, 0x13, 0x87, 0xff, 0x78, 0xb7, 0xff, 0x79, 0xbf, 0xff, 0x36, 0x9f, 0xff, 0xae, 0x3e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xa7, 0xad, 0x26, 0x00, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x27, 0x15, 0x00, 0xad, 0x2e, 0x33, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xac, 0x26, 0xff, 0xac, 0x1e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xc3, 0xad, 0x2e, 0x0f, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8b, 0x1d, 0x00, 0xad, 0x2e, 0x7f, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xcb, 0xad, 0x2e, 0x10, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x62, 0x01, 0x00, 0x8d, 0x26, 0x04, 0xad, 0x2e, 0xcf, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xb0, 0xad, 0x2e, 0x0f, 0x4a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xa9, 0x24, 0x00, 0xad, 0x2e, 0x2f, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xcf, 0xad, 0x2e, 0x80, 0xad, 0x2e, 0x6b, 0xad, 0x2e, 0xdb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe0, 0xad, 0x2e, 0x67, 0x6b, 0x27, 0x00, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe9, 0x1c, 0x00, 0xad, 0x2e, 0x78, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0x74, 0xad, 0x2e, 0x2c, 0xad, 0x26, 0x04, 0xeb, 0x25, 0x00, 0x4a, 0x2d, 0x00, 0x8d, 0x2e, 0x0f, 0xad, 0x2e, 0x63, 0xad, 0x2e, 0xc8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xcf, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0x13, 0xcc, 0x1d, 0x00, 0x85, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe9, 0x1c, 0x00, 0x8c, 0x26, 0x0b, 0xad, 0x2e, 0x04, 0xe9, 0x1c, 0x00, 0x0a, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x00, 0x29, 0x25, 0x00, 0x8d, 0x26, 0x07, 0xad, 0x2e, 0x23, 0xad, 0x2e, 0x6c, 0xad, 0x2e, 0x97, 0xad, 0x2e, 0xbc, 0xad, 0x2e, 0xcc, 0xad, 0x2e, 0xd3, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0x9f, 0xad, 0x2e, 0x70, 0xad, 0x2e, 0x28, 0x8d, 0x26, 0x07, 0x6a, 0x25, 0x00, 0xe7, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x0b, 0x8d, 0x2e, 0x03, 0xad, 0x26, 0x14, 0xad, 0x2e, 0x50, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0x9c, 0xad, 0x2e, 0xac, 0xad, 0x2e, 0xb3, 0xad, 0x2e, 
+  0x9b, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0x4c, 0x8d, 0x2e, 0x17, 0xad, 0x2e, 0x03, 0x91, 0x00, 0x00, 0x00, 0x03, 0x8c, 0x2e, 0x07, 0xad, 0x2e, 0x4c, 0xad, 0x2e, 0xb0, 0xad, 0x2e, 0xf7, 0x87, 0xad, 
+  0x2e, 0xff, 0x03, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0x54, 0xad, 0x26, 0x0b, 0x8e, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x43, 0xad, 0x2e, 0xc4, 0x8d, 0xad, 0x2e, 0xff, 0x01, 0xad, 
+  0x2e, 0xd0, 0xad, 0x2e, 0x4b, 0x8b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x2e, 0x03, 0xad, 0x2e, 0x80, 0xad, 0x2e, 0xf8, 0x8f, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0x8b, 0xcd, 0x26, 
+  0x04, 0x88, 0x00, 0x00, 0x00, 0x01, 0xad, 0x26, 0x08, 0xad, 0x2e, 0xa7, 0x93, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xaf, 0x8d, 0x2e, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x26, 0x04, 0xad, 
+  0x2e, 0xa8, 0x95, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xaf, 0x8d, 0x2e, 0x07, 0x85, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x8b, 0x84, 0xad, 0x2e, 0xff, 0x02, 0x14, 0x97, 0xff, 0x14, 0x8f, 0xff, 
+  0xad, 0x36, 0xff, 0x8f, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x2e, 0x98, 0x84, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x43, 0xad, 0x2e, 0xf8, 0x82, 0xad, 0x2e, 0xff, 0x01, 0xae, 0x36, 0xff, 0xdd, 0xe7, 
+  0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0x7a, 0xc7, 0xff, 0xad, 0x26, 0xff, 0x8e, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0x4c, 0x82, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x08, 0xad, 
+  0x2e, 0xcb, 0x82, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x26, 0xff, 0x9b, 0xd7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0xae, 0x36, 0xff, 0x8f, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xd8, 0xad, 0x2e, 0x0f, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x4f, 0x83, 0xad, 0x2e, 0xff, 0x00, 0xf1, 0x6e, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0x36, 0xa7, 0xff, 0xad, 0x26, 0xff, 0x8f, 0xad, 0x2e, 0xff, 0x03, 
+  0xad, 0x2e, 0x60, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x03, 0xad, 0x2e, 0xb4, 0x82, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0xff, 0x37, 0xa7, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xdd, 0xe7, 0xff, 0x8c, 
+  0x1e, 0xff, 0x8f, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x2e, 0xc4, 0xad, 0x2e, 0x04, 0x8d, 0x2e, 0x14, 0xad, 0x2e, 0xf7, 0x82, 0xad, 0x2e, 0xff, 0x01, 0xac, 0x26, 0xff, 0x58, 0xaf, 0xff, 0x85, 0xff, 
+  0xff, 0xff, 0x00, 0xd0, 0x56, 0xff, 0x90, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x23, 0x8d, 0x26, 0x50, 0x83, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0xff, 0x36, 0xa7, 0xff, 0x84, 0xff, 0xff, 0xff, 
+  0x01, 0xdd, 0xef, 0xff, 0xad, 0x26, 0xff, 0x90, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x5f, 0xad, 0x2e, 0x84, 0x84, 0xad, 0x2e, 0xff, 0x00, 0xd1, 0x66, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xff, 
+  0xf7, 0xff, 0xf1, 0x6e, 0xff, 0x91, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x90, 0xad, 0x2e, 0xa4, 0x84, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x1e, 0xff, 0xbc, 0xdf, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 
+  0x79, 0xbf, 0xff, 0x92, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xb8, 0xad, 0x2e, 0xb4, 0x85, 0xad, 0x2e, 0xff, 0x00, 0xf2, 0x7e, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xf7, 0xff, 0xae, 0x3e, 
+  0xff, 0x91, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xcb, 0xad, 0x2e, 0xb7, 0x85, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0xff, 0x79, 0xc7, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x9b, 0xd7, 0xff, 0xad, 
+  0x26, 0xff, 0x90, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xcb, 0xad, 0x2e, 0xa3, 0x86, 0xad, 0x2e, 0xff, 0x01, 0xae, 0x3e, 0xff, 0xdd, 0xef, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0x58, 0xaf, 0xff, 
+  0xac, 0x1e, 0xff, 0x84, 0xad, 0x2e, 0xff, 0x81, 0xad, 0x26, 0xff, 0x88, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xb7, 0xad, 0x2e, 0x80, 0x86, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0xff, 0xf3, 0x7e, 
+  0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x57, 0xaf, 0xff, 0xac, 0x1e, 0xff, 0x83, 0xad, 0x2e, 0xff, 0x03, 0xf1, 0x6e, 0xff, 0x57, 0xa7, 0xff, 0xae, 0x46, 0xff, 0xad, 0x26, 0xff, 0x86, 0xad, 0x2e, 
+  0xff, 0x01, 0xad, 0x2e, 0x98, 0xad, 0x2e, 0x53, 0x87, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0xff, 0x36, 0xa7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x9b, 0xd7, 0xff, 0xcf, 0x46, 0xff, 0x81, 0xad, 
+  0x2e, 0xff, 0x04, 0xd0, 0x5e, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x57, 0xaf, 0xff, 0x86, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0x68, 0xad, 0x26, 0x1b, 0xad, 0x2e, 0xfb, 
+  0x87, 0xad, 0x2e, 0xff, 0x01, 0xac, 0x26, 0xff, 0x78, 0xbf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xff, 0xf7, 0xff, 0x57, 0xaf, 0xff, 0xd0, 0x66, 0xff, 0xdd, 0xef, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0x02, 0xfe, 0xf7, 0xff, 0x35, 0x97, 0xff, 0xad, 0x26, 0xff, 0x83, 0xad, 0x2e, 0xff, 0x02, 0x8d, 0x2e, 0x24, 0x8d, 0x26, 0x04, 0xad, 0x2e, 0xbc, 0x88, 0xad, 0x2e, 0xff, 0x01, 0xac, 0x26, 0xff, 
+  0x58, 0xb7, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xde, 0xef, 0xff, 0xad, 0x1e, 0xff, 0x82, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x2e, 0xc7, 0xad, 0x26, 0x04, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x5b, 0x89, 
+  0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0x15, 0x97, 0xff, 0xfe, 0xf7, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xbb, 0xd7, 0xff, 0x8c, 0x1e, 0xff, 0x82, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x2e, 0x68, 
+  0x81, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x0c, 0xad, 0x2e, 0xd4, 0x89, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0xcf, 0x4e, 0xff, 0x79, 0xbf, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x14, 0x8f, 
+  0xff, 0xad, 0x26, 0xff, 0x81, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x4f, 0xad, 0x2e, 0xfb, 0x8a, 0xad, 0x2e, 0xff, 0x03, 0xad, 
+  0x26, 0xff, 0xcf, 0x4e, 0xff, 0x78, 0xbf, 0xff, 0xde, 0xf7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xff, 0xf7, 0xff, 0x35, 0x97, 0xff, 0xac, 0x26, 0xff, 0x81, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 
+  0xfc, 0xad, 0x2e, 0x5f, 0x84, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0xe7, 0x8c, 0xad, 0x2e, 0xff, 0x07, 0xac, 0x26, 0xff, 0xac, 0x1e, 0xff, 0x13, 0x87, 0xff, 0x78, 0xb7, 0xff, 0x79, 0xbf, 0xff, 
+  0x36, 0x9f, 0xff, 0xae, 0x3e, 0xff, 0xad, 0x26, 0xff, 0x82, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x2e, 0xa7, 0x84, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x33, 0xad, 0x2e, 0xf8, 0x8f, 0xad, 0x2e, 0xff, 
+  0x02, 0xac, 0x26, 0xff, 0xac, 0x1e, 0xff, 0xad, 0x26, 0xff, 0x83, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xc3, 0xad, 0x2e, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x7f, 0x96, 0xad, 0x2e, 
+  0xff, 0x01, 0xad, 0x2e, 0xcb, 0xad, 0x2e, 0x10, 0x84, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x26, 0x04, 0xad, 0x2e, 0xcf, 0x95, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xb0, 0xad, 0x2e, 0x0f, 0x85, 0x00, 
+  0x00, 0x00, 0x07, 0xad, 0x2e, 0x2f, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xcf, 0xad, 0x2e, 0x80, 0xad, 0x2e, 0x6b, 0xad, 0x2e, 0xdb, 0x8d, 0xad, 0x2e, 0xff, 0x01, 
+  0xad, 0x2e, 0xe0, 0xad, 0x2e, 0x67, 0x87, 0x00, 0x00, 0x00, 0x04, 0xad, 0x2e, 0x78, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0x74, 0xad, 0x2e, 0x2c, 0xad, 0x26, 0x04, 0x81, 0x00, 0x00, 0x00, 0x02, 0x8d, 
+  0x2e, 0x0f, 0xad, 0x2e, 0x63, 0xad, 0x2e, 0xc8, 0x89, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xcf, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0x13, 0x88, 0x00, 0x00, 0x00, 0x01, 0x8c, 0x26, 0x0b, 0xad, 0x2e, 
+  0x04, 0x86, 0x00, 0x00, 0x00, 0x0b, 0x8d, 0x26, 0x07, 0xad, 0x2e, 0x23, 0xad, 0x2e, 0x6c, 0xad, 0x2e, 0x97, 0xad, 0x2e, 0xbc, 0xad, 0x2e, 0xcc, 0xad, 0x2e, 0xd3, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 
+  0x9f, 0xad, 0x2e, 0x70, 0xad, 0x2e, 0x28, 0x8d, 0x26, 0x07, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x47, 0x00, 0x1d, 0x6a, 0x00, 0x2e, 0x8d, 0x03, 0x26, 0xad, 0x14, 0x2e, 0xad, 0x50, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0x9c, 0x2e, 0xad, 0xac, 0x2e, 0xad, 0xb3, 0x2e, 0xad, 0x9b, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0x4c, 0x2e, 0x8d, 0x17, 0x2e, 0xad, 0x03, 0x25, 0x8b, 0x00, 0x03, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe9, 0x00, 0x2e, 0x8c, 0x07, 0x2e, 0xad, 0x4c, 0x2e, 0xad, 0xb0, 0x2e, 0xad, 0xf7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0x54, 0x26, 0xad, 0x0b, 0x1d, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x86, 0x00, 0x1e, 0x2c, 0x00, 0x2e, 0xad, 0x43, 0x2e, 0xad, 0xc4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xd0, 0x2e, 0xad, 0x4b, 0x25, 0xcd, 0x00, 0x13, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x86, 0x00, 0x2e, 0xcd, 0x03, 0x2e, 0xad, 0x80, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0x8b, 0x26, 0xcd, 0x04, 0x13, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x86, 0x00, 0x26, 0xad, 0x08, 0x2e, 0xad, 0xa7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xaf, 0x2e, 0x8d, 0x0c, 0x13, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x86, 0x00, 0x26, 0x8d, 0x04, 0x2e, 0xad, 0xa8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xaf, 0x2e, 0x8d, 0x07, 0x13, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x8b, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x97, 0x14, 0xff, 0x8f, 0x14, 0xff, 0x36, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x98, 0x45, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1d, 0x49, 0x00, 0x2e, 0xad, 0x43, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x36, 0xae, 0xff, 0xe7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x7a, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0x4c, 0x25, 0xcb, 0x00, 0x00, 0x00, 0x00, 
-  0x13, 0x67, 0x00, 0x2e, 0xad, 0x08, 0x2e, 0xad, 0xcb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8c, 0xff, 0xd7, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xae, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xd8, 0x2e, 0xad, 0x0f, 0x00, 0xe5, 0x00, 
-  0x1d, 0x8a, 0x00, 0x2e, 0xad, 0x4f, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x6e, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x36, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x60, 0x1d, 0xea, 0x00, 
-  0x2e, 0xad, 0x03, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0xa7, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xdd, 0xff, 0x1e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xc4, 0x2e, 0xad, 0x04, 
-  0x2e, 0x8d, 0x14, 0x2e, 0xad, 0xf7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xac, 0xff, 0xaf, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xd0, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x23, 
-  0x26, 0x8d, 0x50, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0xa7, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdd, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x5f, 
-  0x2e, 0xad, 0x84, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x66, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x6e, 0xf1, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x90, 
-  0x2e, 0xad, 0xa4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0xdf, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x79, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xb8, 
-  0x2e, 0xad, 0xb4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x7e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0x3e, 0xae, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xcb, 
-  0x2e, 0xad, 0xb7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0xc7, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x9b, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xcb, 
-  0x2e, 0xad, 0xa3, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x3e, 0xae, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x58, 0xff, 0x1e, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xb7, 
-  0x2e, 0xad, 0x80, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x7e, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x57, 0xff, 0x1e, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x6e, 0xf1, 0xff, 0xa7, 0x57, 0xff, 0x46, 0xae, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x98, 
-  0x2e, 0xad, 0x53, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0xa7, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x9b, 0xff, 0x46, 0xcf, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x5e, 0xd0, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xaf, 0x57, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x68, 
-  0x26, 0xad, 0x1b, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xac, 0xff, 0xbf, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xaf, 0x57, 0xff, 0x66, 0xd0, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0x97, 0x35, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0x8d, 0x24, 
-  0x26, 0x8d, 0x04, 0x2e, 0xad, 0xbc, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xac, 0xff, 0xb7, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xde, 0xff, 0x1e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xc7, 0x26, 0xad, 0x04, 
-  0x25, 0xcb, 0x00, 0x2e, 0xad, 0x5b, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x97, 0x15, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbb, 0xff, 0x1e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x68, 0x25, 0x0a, 0x00, 
-  0x12, 0xe4, 0x00, 0x2e, 0xad, 0x0c, 0x2e, 0xad, 0xd4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x4e, 0xcf, 0xff, 0xbf, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x14, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0x0f, 0x1b, 0xc6, 0x00, 
-  0x00, 0x00, 0x00, 0x25, 0xea, 0x00, 0x2e, 0xad, 0x4f, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x4e, 0xcf, 0xff, 0xbf, 0x78, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x97, 0x35, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xfc, 0x2e, 0xad, 0x5f, 0x25, 0xab, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8c, 0x00, 0x2e, 0xad, 0xe7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xac, 0xff, 0x1e, 0xac, 0xff, 0x87, 0x13, 0xff, 0xb7, 0x78, 0xff, 0xbf, 0x79, 0xff, 0x9f, 0x36, 0xff, 0x3e, 0xae, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xa7, 0x26, 0xad, 0x00, 0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x27, 0x00, 0x2e, 0xad, 0x33, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xac, 0xff, 0x1e, 0xac, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xc3, 0x2e, 0xad, 0x0f, 0x14, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1d, 0x8b, 0x00, 0x2e, 0xad, 0x7f, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xcb, 0x2e, 0xad, 0x10, 0x2c, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x62, 0x00, 0x26, 0x8d, 0x04, 0x2e, 0xad, 0xcf, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xb0, 0x2e, 0xad, 0x0f, 0x1d, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x24, 0xa9, 0x00, 0x2e, 0xad, 0x2f, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xcf, 0x2e, 0xad, 0x80, 0x2e, 0xad, 0x6b, 0x2e, 0xad, 0xdb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe0, 0x2e, 0xad, 0x67, 0x27, 0x6b, 0x00, 0x14, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x1c, 0xe9, 0x00, 0x2e, 0xad, 0x78, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0x74, 0x2e, 0xad, 0x2c, 0x26, 0xad, 0x04, 0x25, 0xeb, 0x00, 0x2d, 0x4a, 0x00, 0x2e, 0x8d, 0x0f, 0x2e, 0xad, 0x63, 0x2e, 0xad, 0xc8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xcf, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0x13, 0x1d, 0xcc, 0x00, 0x13, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x1c, 0xe9, 0x00, 0x26, 0x8c, 0x0b, 0x2e, 0xad, 0x04, 0x1c, 0xe9, 0x00, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x25, 0x29, 0x00, 0x26, 0x8d, 0x07, 0x2e, 0xad, 0x23, 0x2e, 0xad, 0x6c, 0x2e, 0xad, 0x97, 0x2e, 0xad, 0xbc, 0x2e, 0xad, 0xcc, 0x2e, 0xad, 0xd3, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0x9f, 0x2e, 0xad, 0x70, 0x2e, 0xad, 0x28, 0x26, 0x8d, 0x07, 0x25, 0x6a, 0x00, 0x13, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x0b, 0x2e, 0x8d, 0x03, 0x26, 0xad, 0x14, 0x2e, 0xad, 0x50, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0x9c, 0x2e, 0xad, 0xac, 0x2e, 0xad, 0xb3, 0x2e, 0xad, 
+  0x9b, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0x4c, 0x2e, 0x8d, 0x17, 0x2e, 0xad, 0x03, 0x91, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x8c, 0x07, 0x2e, 0xad, 0x4c, 0x2e, 0xad, 0xb0, 0x2e, 0xad, 0xf7, 0x87, 0x2e, 
+  0xad, 0xff, 0x03, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0x54, 0x26, 0xad, 0x0b, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x43, 0x2e, 0xad, 0xc4, 0x8d, 0x2e, 0xad, 0xff, 0x01, 0x2e, 
+  0xad, 0xd0, 0x2e, 0xad, 0x4b, 0x8b, 0x00, 0x00, 0x00, 0x02, 0x2e, 0xcd, 0x03, 0x2e, 0xad, 0x80, 0x2e, 0xad, 0xf8, 0x8f, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0x8b, 0x26, 0xcd, 
+  0x04, 0x88, 0x00, 0x00, 0x00, 0x01, 0x26, 0xad, 0x08, 0x2e, 0xad, 0xa7, 0x93, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xaf, 0x2e, 0x8d, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x01, 0x26, 0x8d, 0x04, 0x2e, 
+  0xad, 0xa8, 0x95, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xaf, 0x2e, 0x8d, 0x07, 0x85, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x8b, 0x84, 0x2e, 0xad, 0xff, 0x02, 0x97, 0x14, 0xff, 0x8f, 0x14, 0xff, 
+  0x36, 0xad, 0xff, 0x8f, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0xad, 0x98, 0x84, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x43, 0x2e, 0xad, 0xf8, 0x82, 0x2e, 0xad, 0xff, 0x01, 0x36, 0xae, 0xff, 0xe7, 0xdd, 
+  0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xc7, 0x7a, 0xff, 0x26, 0xad, 0xff, 0x8e, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0x4c, 0x82, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x08, 0x2e, 
+  0xad, 0xcb, 0x82, 0x2e, 0xad, 0xff, 0x01, 0x26, 0x8c, 0xff, 0xd7, 0x9b, 0xff, 0x83, 0xff, 0xff, 0xff, 0x00, 0x36, 0xae, 0xff, 0x8f, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xd8, 0x2e, 0xad, 0x0f, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x4f, 0x83, 0x2e, 0xad, 0xff, 0x00, 0x6e, 0xf1, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xa7, 0x36, 0xff, 0x26, 0xad, 0xff, 0x8f, 0x2e, 0xad, 0xff, 0x03, 
+  0x2e, 0xad, 0x60, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x03, 0x2e, 0xad, 0xb4, 0x82, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0xff, 0xa7, 0x37, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xe7, 0xdd, 0xff, 0x1e, 
+  0x8c, 0xff, 0x8f, 0x2e, 0xad, 0xff, 0x03, 0x2e, 0xad, 0xc4, 0x2e, 0xad, 0x04, 0x2e, 0x8d, 0x14, 0x2e, 0xad, 0xf7, 0x82, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xac, 0xff, 0xaf, 0x58, 0xff, 0x85, 0xff, 
+  0xff, 0xff, 0x00, 0x56, 0xd0, 0xff, 0x90, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x23, 0x26, 0x8d, 0x50, 0x83, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0xff, 0xa7, 0x36, 0xff, 0x84, 0xff, 0xff, 0xff, 
+  0x01, 0xef, 0xdd, 0xff, 0x26, 0xad, 0xff, 0x90, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x5f, 0x2e, 0xad, 0x84, 0x84, 0x2e, 0xad, 0xff, 0x00, 0x66, 0xd1, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xf7, 
+  0xff, 0xff, 0x6e, 0xf1, 0xff, 0x91, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x90, 0x2e, 0xad, 0xa4, 0x84, 0x2e, 0xad, 0xff, 0x01, 0x1e, 0x8c, 0xff, 0xdf, 0xbc, 0xff, 0x82, 0xff, 0xff, 0xff, 0x00, 
+  0xbf, 0x79, 0xff, 0x92, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xb8, 0x2e, 0xad, 0xb4, 0x85, 0x2e, 0xad, 0xff, 0x00, 0x7e, 0xf2, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xfe, 0xff, 0x3e, 0xae, 
+  0xff, 0x91, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xcb, 0x2e, 0xad, 0xb7, 0x85, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0xff, 0xc7, 0x79, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xd7, 0x9b, 0xff, 0x26, 
+  0xad, 0xff, 0x90, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xcb, 0x2e, 0xad, 0xa3, 0x86, 0x2e, 0xad, 0xff, 0x01, 0x3e, 0xae, 0xff, 0xef, 0xdd, 0xff, 0x82, 0xff, 0xff, 0xff, 0x01, 0xaf, 0x58, 0xff, 
+  0x1e, 0xac, 0xff, 0x84, 0x2e, 0xad, 0xff, 0x81, 0x26, 0xad, 0xff, 0x88, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xb7, 0x2e, 0xad, 0x80, 0x86, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0xff, 0x7e, 0xf3, 
+  0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xaf, 0x57, 0xff, 0x1e, 0xac, 0xff, 0x83, 0x2e, 0xad, 0xff, 0x03, 0x6e, 0xf1, 0xff, 0xa7, 0x57, 0xff, 0x46, 0xae, 0xff, 0x26, 0xad, 0xff, 0x86, 0x2e, 0xad, 
+  0xff, 0x01, 0x2e, 0xad, 0x98, 0x2e, 0xad, 0x53, 0x87, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0xff, 0xa7, 0x36, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xd7, 0x9b, 0xff, 0x46, 0xcf, 0xff, 0x81, 0x2e, 
+  0xad, 0xff, 0x04, 0x5e, 0xd0, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xaf, 0x57, 0xff, 0x86, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0x68, 0x26, 0xad, 0x1b, 0x2e, 0xad, 0xfb, 
+  0x87, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xac, 0xff, 0xbf, 0x78, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xf7, 0xff, 0xff, 0xaf, 0x57, 0xff, 0x66, 0xd0, 0xff, 0xef, 0xdd, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0x02, 0xf7, 0xfe, 0xff, 0x97, 0x35, 0xff, 0x26, 0xad, 0xff, 0x83, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0x8d, 0x24, 0x26, 0x8d, 0x04, 0x2e, 0xad, 0xbc, 0x88, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xac, 0xff, 
+  0xb7, 0x58, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xef, 0xde, 0xff, 0x1e, 0xad, 0xff, 0x82, 0x2e, 0xad, 0xff, 0x03, 0x2e, 0xad, 0xc7, 0x26, 0xad, 0x04, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x5b, 0x89, 
+  0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x97, 0x15, 0xff, 0xf7, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xd7, 0xbb, 0xff, 0x1e, 0x8c, 0xff, 0x82, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0xad, 0x68, 
+  0x81, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x0c, 0x2e, 0xad, 0xd4, 0x89, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x4e, 0xcf, 0xff, 0xbf, 0x79, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x8f, 0x14, 
+  0xff, 0x26, 0xad, 0xff, 0x81, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x4f, 0x2e, 0xad, 0xfb, 0x8a, 0x2e, 0xad, 0xff, 0x03, 0x26, 
+  0xad, 0xff, 0x4e, 0xcf, 0xff, 0xbf, 0x78, 0xff, 0xf7, 0xde, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xff, 0x97, 0x35, 0xff, 0x26, 0xac, 0xff, 0x81, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 
+  0xfc, 0x2e, 0xad, 0x5f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0xe7, 0x8c, 0x2e, 0xad, 0xff, 0x07, 0x26, 0xac, 0xff, 0x1e, 0xac, 0xff, 0x87, 0x13, 0xff, 0xb7, 0x78, 0xff, 0xbf, 0x79, 0xff, 
+  0x9f, 0x36, 0xff, 0x3e, 0xae, 0xff, 0x26, 0xad, 0xff, 0x82, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0xad, 0xa7, 0x84, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x33, 0x2e, 0xad, 0xf8, 0x8f, 0x2e, 0xad, 0xff, 
+  0x02, 0x26, 0xac, 0xff, 0x1e, 0xac, 0xff, 0x26, 0xad, 0xff, 0x83, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xc3, 0x2e, 0xad, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x7f, 0x96, 0x2e, 0xad, 
+  0xff, 0x01, 0x2e, 0xad, 0xcb, 0x2e, 0xad, 0x10, 0x84, 0x00, 0x00, 0x00, 0x01, 0x26, 0x8d, 0x04, 0x2e, 0xad, 0xcf, 0x95, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xb0, 0x2e, 0xad, 0x0f, 0x85, 0x00, 
+  0x00, 0x00, 0x07, 0x2e, 0xad, 0x2f, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xcf, 0x2e, 0xad, 0x80, 0x2e, 0xad, 0x6b, 0x2e, 0xad, 0xdb, 0x8d, 0x2e, 0xad, 0xff, 0x01, 
+  0x2e, 0xad, 0xe0, 0x2e, 0xad, 0x67, 0x87, 0x00, 0x00, 0x00, 0x04, 0x2e, 0xad, 0x78, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0x74, 0x2e, 0xad, 0x2c, 0x26, 0xad, 0x04, 0x81, 0x00, 0x00, 0x00, 0x02, 0x2e, 
+  0x8d, 0x0f, 0x2e, 0xad, 0x63, 0x2e, 0xad, 0xc8, 0x89, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xcf, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0x13, 0x88, 0x00, 0x00, 0x00, 0x01, 0x26, 0x8c, 0x0b, 0x2e, 0xad, 
+  0x04, 0x86, 0x00, 0x00, 0x00, 0x0b, 0x26, 0x8d, 0x07, 0x2e, 0xad, 0x23, 0x2e, 0xad, 0x6c, 0x2e, 0xad, 0x97, 0x2e, 0xad, 0xbc, 0x2e, 0xad, 0xcc, 0x2e, 0xad, 0xd3, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 
+  0x9f, 0x2e, 0xad, 0x70, 0x2e, 0xad, 0x28, 0x26, 0x8d, 0x07, 0x89, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x6a, 0x11, 0x00, 0x51, 0xac, 0x1c, 0x00, 0x68, 0xd2, 0x27, 0x03, 0x65, 0xd3, 0x24, 0x14, 0x65, 0xd3, 0x25, 0x50, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0x9c, 0x66, 0xd3, 0x25, 0xac, 0x66, 0xd3, 0x25, 0xb3, 0x66, 0xd3, 0x25, 0x9b, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0x4c, 0x65, 0xd2, 0x25, 0x17, 0x68, 0xd4, 0x25, 0x03, 0x57, 0xb1, 0x1e, 0x00, 0x1d, 0x7b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x9b, 0x18, 0x00, 0x64, 0xd1, 0x26, 0x07, 0x66, 0xd3, 0x25, 0x4c, 0x66, 0xd3, 0x25, 0xb0, 0x66, 0xd3, 0x25, 0xf7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd3, 0x25, 0x54, 0x67, 0xd3, 0x24, 0x0b, 0x51, 0xaa, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x6f, 0x0d, 0x00, 0x63, 0xc5, 0x1c, 0x00, 0x66, 0xd3, 0x25, 0x43, 0x66, 0xd3, 0x25, 0xc4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xd0, 0x66, 0xd4, 0x25, 0x4b, 0x66, 0xb7, 0x20, 0x00, 0x33, 0x6f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x70, 0x0f, 0x00, 0x6b, 0xd7, 0x2a, 0x03, 0x66, 0xd3, 0x25, 0x80, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0x8b, 0x68, 0xd7, 0x21, 0x04, 0x36, 0x6f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x70, 0x0f, 0x00, 0x65, 0xd4, 0x24, 0x08, 0x66, 0xd3, 0x25, 0xa7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xaf, 0x69, 0xd1, 0x28, 0x0c, 0x35, 0x6e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x6f, 0x10, 0x00, 0x68, 0xd1, 0x23, 0x04, 0x66, 0xd3, 0x25, 0xa8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xaf, 0x68, 0xd1, 0x25, 0x07, 0x33, 0x70, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd1, 0x27, 0x00, 0x66, 0xd3, 0x25, 0x8b, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x6b, 0xd5, 0x2c, 0xff, 0xa4, 0xe1, 0x94, 0xff, 0x9e, 0xe0, 0x8b, 0xff, 0x6c, 0xd5, 0x2f, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x98, 0x5a, 0xbb, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x48, 0xa8, 0x17, 0x00, 0x66, 0xd3, 0x25, 0x43, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x6f, 0xd5, 0x34, 0xff, 0xe7, 0xf7, 0xe1, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xcd, 0xee, 0xbf, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0x4c, 0x56, 0xba, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x38, 0x6c, 0x10, 0x00, 0x65, 0xd3, 0x25, 0x08, 0x66, 0xd3, 0x25, 0xcb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x62, 0xd2, 0x1d, 0xff, 0xd9, 0xf2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xf8, 0xff, 0x6e, 0xd5, 0x31, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xd8, 0x67, 0xd4, 0x25, 0x0f, 0x28, 0x1c, 0x02, 0x00, 
-  0x54, 0xb1, 0x1c, 0x00, 0x66, 0xd3, 0x25, 0x4f, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x8a, 0xdb, 0x68, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xe6, 0xa0, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x60, 0x4e, 0xbd, 0x19, 0x00, 
-  0x65, 0xd3, 0x25, 0x03, 0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x23, 0xff, 0xb5, 0xe6, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xf7, 0xdf, 0xff, 0x5f, 0xd2, 0x18, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xc4, 0x67, 0xd3, 0x25, 0x04, 
-  0x67, 0xd2, 0x25, 0x14, 0x66, 0xd3, 0x25, 0xf7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x64, 0xd3, 0x20, 0xff, 0xbd, 0xea, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfa, 0xff, 0x80, 0xda, 0x54, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd3, 0x26, 0x23, 
-  0x67, 0xd2, 0x24, 0x50, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x23, 0xff, 0xb3, 0xe6, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf9, 0xe7, 0xff, 0x68, 0xd4, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd3, 0x25, 0x5f, 
-  0x66, 0xd3, 0x25, 0x84, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x86, 0xda, 0x61, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xf2, 0xff, 0x88, 0xdb, 0x68, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x90, 
-  0x66, 0xd3, 0x25, 0xa4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x60, 0xd2, 0x18, 0xff, 0xe3, 0xf6, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xec, 0xba, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xb8, 
-  0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x94, 0xde, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xfc, 0xf1, 0xff, 0x72, 0xd6, 0x3a, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xcb, 
-  0x66, 0xd3, 0x25, 0xb7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x22, 0xff, 0xcc, 0xee, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xf2, 0xcf, 0xff, 0x65, 0xd3, 0x1d, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xcb, 
-  0x66, 0xd3, 0x25, 0xa3, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x71, 0xd6, 0x3a, 0xff, 0xec, 0xf9, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbd, 0xe9, 0xab, 0xff, 0x64, 0xd3, 0x1c, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x65, 0xd3, 0x22, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xb7, 
-  0x66, 0xd3, 0x25, 0x80, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x23, 0xff, 0x97, 0xde, 0x7b, 0xff, 0xfb, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xbb, 0xe9, 0xa9, 0xff, 0x64, 0xd3, 0x1c, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x8b, 0xdb, 0x6a, 0xff, 0xb6, 0xe7, 0xa4, 0xff, 0x72, 0xd6, 0x3e, 0xff, 0x65, 0xd3, 0x21, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x98, 
-  0x66, 0xd3, 0x25, 0x53, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x1f, 0xff, 0xb4, 0xe6, 0xa0, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd8, 0xf2, 0xce, 0xff, 0x75, 0xd7, 0x42, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x7f, 0xd9, 0x57, 0xff, 0xf4, 0xfb, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xf2, 0xff, 0xbc, 0xe9, 0xab, 0xff, 0x69, 0xd4, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x25, 0x68, 
-  0x65, 0xd3, 0x24, 0x1b, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x62, 0xd3, 0x20, 0xff, 0xc4, 0xeb, 0xb6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0xf4, 0xff, 0xb7, 0xe7, 0xa5, 0xff, 0x84, 0xda, 0x5d, 0xff, 0xec, 0xf9, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfb, 0xed, 0xff, 0xa8, 0xe3, 0x91, 0xff, 0x65, 0xd3, 0x20, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd2, 0x25, 0x24, 
-  0x65, 0xd1, 0x23, 0x04, 0x66, 0xd3, 0x25, 0xbc, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x63, 0xd3, 0x20, 0xff, 0xbf, 0xe9, 0xad, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xf9, 0xea, 0xff, 0x66, 0xd4, 0x16, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xc7, 0x66, 0xd4, 0x24, 0x04, 
-  0x5b, 0xb7, 0x20, 0x00, 0x66, 0xd3, 0x25, 0x5b, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x1f, 0xff, 0xa5, 0xe2, 0x8d, 0xff, 0xf3, 0xfb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xf3, 0xd3, 0xff, 0x60, 0xd2, 0x18, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x68, 0x52, 0x9f, 0x1d, 0x00, 
-  0x1e, 0x5d, 0x11, 0x00, 0x65, 0xd3, 0x25, 0x0c, 0x66, 0xd3, 0x25, 0xd4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x23, 0xff, 0x76, 0xd7, 0x45, 0xff, 0xc9, 0xed, 0xbb, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xa3, 0xe2, 0x8a, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd4, 0x25, 0x0f, 0x31, 0x7a, 0x1a, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x54, 0xbb, 0x20, 0x00, 0x66, 0xd3, 0x25, 0x4f, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x7a, 0xd8, 0x49, 0xff, 0xc4, 0xeb, 0xb6, 0xff, 0xf1, 0xfa, 0xed, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xf2, 0xff, 0xab, 0xe4, 0x94, 0xff, 0x64, 0xd3, 0x20, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xfc, 0x66, 0xd3, 0x25, 0x5f, 0x57, 0xb3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xd0, 0x21, 0x00, 0x66, 0xd3, 0x25, 0xe7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x64, 0xd3, 0x21, 0xff, 0x62, 0xd3, 0x16, 0xff, 0x9b, 0xdf, 0x83, 0xff, 0xc0, 0xeb, 0xaf, 0xff, 0xc5, 0xec, 0xb5, 0xff, 0xad, 0xe3, 0x9c, 0xff, 0x6e, 0xd5, 0x37, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xa7, 0x67, 0xd5, 0x24, 0x00, 0x42, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x38, 0xa5, 0x11, 0x00, 0x66, 0xd3, 0x25, 0x33, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x64, 0xd3, 0x1f, 0xff, 0x63, 0xd3, 0x1c, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xc3, 0x67, 0xd4, 0x26, 0x0f, 0x35, 0x97, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x55, 0xb1, 0x18, 0x00, 0x66, 0xd3, 0x25, 0x7f, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xcb, 0x65, 0xd4, 0x25, 0x10, 0x48, 0x9b, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x11, 0x2d, 0x00, 0x00, 0x67, 0xd1, 0x24, 0x04, 0x66, 0xd3, 0x25, 0xcf, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xb0, 0x66, 0xd4, 0x26, 0x0f, 0x54, 0xaa, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x47, 0x94, 0x1d, 0x00, 0x66, 0xd3, 0x25, 0x2f, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xcf, 0x66, 0xd3, 0x25, 0x80, 0x66, 0xd3, 0x25, 0x6b, 0x66, 0xd3, 0x25, 0xdb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe0, 0x66, 0xd3, 0x25, 0x67, 0x59, 0xee, 0x23, 0x00, 0x35, 0x98, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4a, 0x9c, 0x19, 0x00, 0x66, 0xd3, 0x25, 0x78, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0x74, 0x66, 0xd4, 0x25, 0x2c, 0x68, 0xd4, 0x23, 0x04, 0x59, 0xbc, 0x1f, 0x00, 0x4d, 0xaa, 0x25, 0x00, 0x66, 0xd2, 0x25, 0x0f, 0x66, 0xd3, 0x25, 0x63, 0x66, 0xd3, 0x25, 0xc8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xcf, 0x66, 0xd3, 0x25, 0x6f, 0x67, 0xd3, 0x26, 0x13, 0x62, 0xb7, 0x17, 0x00, 0x2a, 0x71, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x48, 0x9c, 0x18, 0x00, 0x64, 0xd2, 0x23, 0x0b, 0x66, 0xd3, 0x25, 0x04, 0x49, 0x9b, 0x19, 0x00, 0x4f, 0xa1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x82, 0x16, 0x00, 0x4b, 0xa3, 0x1f, 0x00, 0x66, 0xd2, 0x24, 0x07, 0x67, 0xd3, 0x26, 0x23, 0x66, 0xd3, 0x25, 0x6c, 0x66, 0xd3, 0x25, 0x97, 0x66, 0xd3, 0x25, 0xbc, 0x66, 0xd3, 0x25, 0xcc, 0x66, 0xd3, 0x25, 0xd3, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0x9f, 0x66, 0xd3, 0x25, 0x70, 0x67, 0xd3, 0x25, 0x28, 0x66, 0xd2, 0x24, 0x07, 0x50, 0xab, 0x21, 0x00, 0x37, 0x7e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x68, 0xd2, 0x27, 0x03, 0x65, 0xd3, 0x24, 0x14, 0x65, 0xd3, 0x25, 0x50, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0x9c, 0x66, 0xd3, 
+  0x25, 0xac, 0x66, 0xd3, 0x25, 0xb3, 0x66, 0xd3, 0x25, 0x9b, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0x4c, 0x65, 0xd2, 0x25, 0x17, 0x68, 0xd4, 0x25, 0x03, 0x91, 0x00, 0x00, 0x00, 0x00, 0x03, 
+  0x64, 0xd1, 0x26, 0x07, 0x66, 0xd3, 0x25, 0x4c, 0x66, 0xd3, 0x25, 0xb0, 0x66, 0xd3, 0x25, 0xf7, 0x87, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd3, 
+  0x25, 0x54, 0x67, 0xd3, 0x24, 0x0b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x25, 0x43, 0x66, 0xd3, 0x25, 0xc4, 0x8d, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xd0, 0x66, 0xd4, 
+  0x25, 0x4b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6b, 0xd7, 0x2a, 0x03, 0x66, 0xd3, 0x25, 0x80, 0x66, 0xd3, 0x25, 0xf8, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 
+  0x25, 0x8b, 0x68, 0xd7, 0x21, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0xd4, 0x24, 0x08, 0x66, 0xd3, 0x25, 0xa7, 0x93, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xaf, 0x69, 0xd1, 
+  0x28, 0x0c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0xd1, 0x23, 0x04, 0x66, 0xd3, 0x25, 0xa8, 0x95, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xaf, 0x68, 0xd1, 0x25, 0x07, 0x85, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0x8b, 0x83, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x6b, 0xd5, 0x2c, 0xff, 0xa4, 0xe1, 0x94, 0xff, 0x9e, 0xe0, 0x8b, 0xff, 0x6c, 0xd5, 0x2f, 0xff, 0x8f, 0x66, 
+  0xd3, 0x25, 0xff, 0x00, 0x66, 0xd3, 0x25, 0x98, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x25, 0x43, 0x66, 0xd3, 0x25, 0xf8, 0x82, 0x66, 0xd3, 0x25, 0xff, 0x05, 0x6f, 0xd5, 0x34, 0xff, 
+  0xe7, 0xf7, 0xe1, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xcd, 0xee, 0xbf, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x8e, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 
+  0x25, 0x4c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0xd3, 0x25, 0x08, 0x66, 0xd3, 0x25, 0xcb, 0x82, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x62, 0xd2, 0x1d, 0xff, 0xd9, 0xf2, 0xcf, 0xff, 0x82, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0xfa, 0xfe, 0xf8, 0xff, 0x6e, 0xd5, 0x31, 0xff, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xd8, 0x67, 0xd4, 0x25, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x66, 0xd3, 0x25, 0x4f, 0x83, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x8a, 0xdb, 0x68, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0xb2, 0xe6, 0xa0, 0xff, 0x66, 0xd3, 0x24, 0xff, 
+  0x8f, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x25, 0x60, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd3, 0x25, 0x03, 0x66, 0xd3, 0x25, 0xb4, 0x82, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x65, 0xd3, 0x23, 0xff, 
+  0xb5, 0xe6, 0xa4, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xe6, 0xf7, 0xdf, 0xff, 0x5f, 0xd2, 0x18, 0xff, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x25, 0xc4, 0x67, 0xd3, 0x25, 0x04, 
+  0x67, 0xd2, 0x25, 0x14, 0x66, 0xd3, 0x25, 0xf7, 0x82, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x64, 0xd3, 0x20, 0xff, 0xbd, 0xea, 0xac, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xfe, 0xfa, 0xff, 
+  0x80, 0xda, 0x54, 0xff, 0x90, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x67, 0xd3, 0x26, 0x23, 0x67, 0xd2, 0x24, 0x50, 0x83, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x65, 0xd3, 0x23, 0xff, 0xb3, 0xe6, 0xa4, 0xff, 
+  0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xec, 0xf9, 0xe7, 0xff, 0x68, 0xd4, 0x24, 0xff, 0x90, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x67, 0xd3, 0x25, 0x5f, 0x66, 0xd3, 0x25, 0x84, 0x84, 0x66, 0xd3, 0x25, 
+  0xff, 0x01, 0x86, 0xda, 0x61, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf5, 0xfc, 0xf2, 0xff, 0x88, 0xdb, 0x68, 0xff, 0x91, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 
+  0x25, 0x90, 0x66, 0xd3, 0x25, 0xa4, 0x84, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x60, 0xd2, 0x18, 0xff, 0xe3, 0xf6, 0xdc, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc7, 0xec, 0xba, 0xff, 0x92, 0x66, 
+  0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xb8, 0x66, 0xd3, 0x25, 0xb4, 0x85, 0x66, 0xd3, 0x25, 0xff, 0x00, 0x94, 0xde, 0x75, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf4, 0xfc, 0xf1, 0xff, 
+  0x72, 0xd6, 0x3a, 0xff, 0x91, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xcb, 0x66, 0xd3, 0x25, 0xb7, 0x85, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x65, 0xd3, 0x22, 0xff, 0xcc, 0xee, 0xbe, 0xff, 
+  0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xd9, 0xf2, 0xcf, 0xff, 0x65, 0xd3, 0x1d, 0xff, 0x90, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xcb, 0x66, 0xd3, 0x25, 0xa3, 0x86, 0x66, 0xd3, 0x25, 
+  0xff, 0x01, 0x71, 0xd6, 0x3a, 0xff, 0xec, 0xf9, 0xe7, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfe, 0xff, 0xbd, 0xe9, 0xab, 0xff, 0x64, 0xd3, 0x1c, 0xff, 0x84, 0x66, 0xd3, 0x25, 
+  0xff, 0x01, 0x66, 0xd3, 0x24, 0xff, 0x65, 0xd3, 0x22, 0xff, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xb7, 0x66, 0xd3, 0x25, 0x80, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 
+  0x23, 0xff, 0x97, 0xde, 0x7b, 0xff, 0xfb, 0xfe, 0xf9, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfd, 0xff, 0xfd, 0xff, 0xbb, 0xe9, 0xa9, 0xff, 0x64, 0xd3, 0x1c, 0xff, 0x83, 0x66, 0xd3, 0x25, 
+  0xff, 0x03, 0x8b, 0xdb, 0x6a, 0xff, 0xb6, 0xe7, 0xa4, 0xff, 0x72, 0xd6, 0x3e, 0xff, 0x65, 0xd3, 0x21, 0xff, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0x98, 0x66, 0xd3, 0x25, 0x53, 
+  0x87, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x65, 0xd3, 0x1f, 0xff, 0xb4, 0xe6, 0xa0, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfe, 0xff, 0xd8, 0xf2, 0xce, 0xff, 
+  0x75, 0xd7, 0x42, 0xff, 0x81, 0x66, 0xd3, 0x25, 0xff, 0x05, 0x7f, 0xd9, 0x57, 0xff, 0xf4, 0xfb, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xf2, 0xff, 0xbc, 0xe9, 0xab, 0xff, 0x69, 0xd4, 
+  0x25, 0xff, 0x85, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x65, 0xd3, 0x25, 0x68, 0x65, 0xd3, 0x24, 0x1b, 0x66, 0xd3, 0x25, 0xfb, 0x87, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x62, 0xd3, 0x20, 0xff, 0xc4, 0xeb, 
+  0xb6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf6, 0xfc, 0xf4, 0xff, 0xb7, 0xe7, 0xa5, 0xff, 0x84, 0xda, 0x5d, 0xff, 0xec, 0xf9, 0xe7, 0xff, 0x83, 0xff, 0xff, 0xff, 
+  0xff, 0x02, 0xf1, 0xfb, 0xed, 0xff, 0xa8, 0xe3, 0x91, 0xff, 0x65, 0xd3, 0x20, 0xff, 0x83, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd2, 0x25, 0x24, 0x65, 0xd1, 0x23, 0x04, 0x66, 0xd3, 0x25, 0xbc, 
+  0x88, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x63, 0xd3, 0x20, 0xff, 0xbf, 0xe9, 0xad, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x01, 0xed, 0xf9, 0xea, 0xff, 0x66, 0xd4, 0x16, 0xff, 
+  0x82, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x25, 0xc7, 0x66, 0xd4, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0x5b, 0x89, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x65, 0xd3, 0x1f, 0xff, 
+  0xa5, 0xe2, 0x8d, 0xff, 0xf3, 0xfb, 0xef, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x01, 0xdc, 0xf3, 0xd3, 0xff, 0x60, 0xd2, 0x18, 0xff, 0x82, 0x66, 0xd3, 0x25, 0xff, 0x00, 0x66, 0xd3, 0x25, 0x68, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0xd3, 0x25, 0x0c, 0x66, 0xd3, 0x25, 0xd4, 0x89, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x23, 0xff, 0x76, 0xd7, 0x45, 0xff, 0xc9, 0xed, 0xbb, 0xff, 
+  0xfd, 0xff, 0xfc, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xff, 0xfd, 0xff, 0xa3, 0xe2, 0x8a, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x81, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xdc, 
+  0x66, 0xd4, 0x25, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x25, 0x4f, 0x66, 0xd3, 0x25, 0xfb, 0x8a, 0x66, 0xd3, 0x25, 0xff, 0x04, 0x65, 0xd3, 0x23, 0xff, 0x7a, 0xd8, 0x49, 0xff, 
+  0xc4, 0xeb, 0xb6, 0xff, 0xf1, 0xfa, 0xed, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf5, 0xfc, 0xf2, 0xff, 0xab, 0xe4, 0x94, 0xff, 0x64, 0xd3, 0x20, 0xff, 0x81, 0x66, 
+  0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xfc, 0x66, 0xd3, 0x25, 0x5f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0xe7, 0x8c, 0x66, 0xd3, 0x25, 0xff, 0x07, 0x64, 0xd3, 0x21, 0xff, 
+  0x62, 0xd3, 0x16, 0xff, 0x9b, 0xdf, 0x83, 0xff, 0xc0, 0xeb, 0xaf, 0xff, 0xc5, 0xec, 0xb5, 0xff, 0xad, 0xe3, 0x9c, 0xff, 0x6e, 0xd5, 0x37, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x82, 0x66, 0xd3, 0x25, 
+  0xff, 0x00, 0x66, 0xd3, 0x25, 0xa7, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x25, 0x33, 0x66, 0xd3, 0x25, 0xf8, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x64, 0xd3, 0x1f, 0xff, 0x63, 0xd3, 
+  0x1c, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x83, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xc3, 0x67, 0xd4, 0x26, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0x7f, 0x96, 0x66, 
+  0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xcb, 0x65, 0xd4, 0x25, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x67, 0xd1, 0x24, 0x04, 0x66, 0xd3, 0x25, 0xcf, 0x95, 0x66, 0xd3, 0x25, 0xff, 0x01, 
+  0x66, 0xd3, 0x25, 0xb0, 0x66, 0xd4, 0x26, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0xd3, 0x25, 0x2f, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 
+  0x25, 0xcf, 0x66, 0xd3, 0x25, 0x80, 0x66, 0xd3, 0x25, 0x6b, 0x66, 0xd3, 0x25, 0xdb, 0x8d, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xe0, 0x66, 0xd3, 0x25, 0x67, 0x87, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0x66, 0xd3, 0x25, 0x78, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0x74, 0x66, 0xd4, 0x25, 0x2c, 0x68, 0xd4, 0x23, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0xd2, 0x25, 0x0f, 
+  0x66, 0xd3, 0x25, 0x63, 0x66, 0xd3, 0x25, 0xc8, 0x89, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xcf, 0x66, 0xd3, 0x25, 0x6f, 0x67, 0xd3, 0x26, 0x13, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x64, 0xd2, 0x23, 0x0b, 0x66, 0xd3, 0x25, 0x04, 0x86, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66, 0xd2, 0x24, 0x07, 0x67, 0xd3, 0x26, 0x23, 0x66, 0xd3, 0x25, 0x6c, 0x66, 0xd3, 0x25, 0x97, 0x66, 0xd3, 
+  0x25, 0xbc, 0x66, 0xd3, 0x25, 0xcc, 0x66, 0xd3, 0x25, 0xd3, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0x9f, 0x66, 0xd3, 0x25, 0x70, 0x67, 0xd3, 0x25, 0x28, 0x66, 0xd2, 0x24, 0x07, 0x89, 0x00, 
+  0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +178,7 @@ const lv_img_dsc_t whatsapp_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( whatsapp_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = whatsapp_32px_map,
 };
-
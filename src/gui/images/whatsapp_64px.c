@@ -10,271 +10,364 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_WHATSAPP_64PX uint8_t whatsapp_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x03, 0x3e, 0x07, 0x3e, 0x07, 0x3e, 0x17, 0x3e, 0x33, 0x3e, 0x44, 0x3e, 0x53, 0x3e, 0x60, 0x3e, 0x6c, 0x3e, 0x5c, 0x3e, 0x43, 0x3e, 0x28, 0x3e, 0x13, 0x3e, 0x08, 0x3e, 0x07, 0x3e, 0x03, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3e, 0x08, 0x3e, 0x18, 0x3e, 0x37, 0x3e, 0x7b, 0x3e, 0xbc, 0x3e, 0xeb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xf0, 0x3e, 0xb4, 0x3e, 0x77, 0x3e, 0x3b, 0x3e, 0x1b, 0x3e, 0x0b, 0x3d, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x1d, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x18, 0x3e, 0x3f, 0x3e, 0x88, 0x3e, 0xe0, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xeb, 0x3e, 0x90, 0x3e, 0x47, 0x3e, 0x1f, 0x1d, 0x00, 0x3e, 0x00, 0x39, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x18, 0x3e, 0x68, 0x3e, 0xb4, 0x3e, 0xfb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xc0, 0x3e, 0x73, 0x3e, 0x28, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3d, 0x07, 0x3e, 0x67, 0x3e, 0xbf, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xcc, 0x3e, 0x7f, 0x3e, 0x10, 0x3e, 0x00, 0x02, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x16, 0x00, 0x3e, 0x00, 0x3e, 0x40, 0x3e, 0xbf, 0x3e, 0xf3, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xfc, 0x3e, 0xc7, 0x3e, 0x53, 0x3e, 0x00, 0x3a, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x6f, 0x3e, 0xe4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xec, 0x3e, 0x88, 0x1e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x0b, 0x3e, 0x97, 0x3e, 0xfb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xa3, 0x3e, 0x10, 0x3e, 0x00, 0x3a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x1f, 0x3e, 0xb8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xbf, 0x3e, 0x23, 0x3a, 0x00, 0x1d, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x24, 0x3e, 0xc0, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xdb, 0x3e, 0x2f, 0x3a, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x20, 0x3e, 0xc7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xd4, 0x3e, 0x24, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x13, 0x3e, 0xbb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xc3, 0x3e, 0x1b, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x39, 0x00, 0x1e, 0x00, 0x3e, 0xa8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x19, 0xff, 0x19, 0xff, 0x19, 0xff, 0x19, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xb8, 0x3a, 0x0f, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x80, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x9b, 0x3a, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x47, 0x3e, 0xe8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xec, 0x3e, 0x50, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3e, 0x00, 0x3e, 0x07, 0x3e, 0xbf, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xc8, 0x3e, 0x14, 0x3e, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x6f, 0x3e, 0xf4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x88, 0x3e, 0x00, 0x3d, 0x00, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x20, 0x3e, 0xc4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xdb, 0x3e, 0x38, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3e, 0x67, 0x3e, 0xfc, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3d, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x7f, 0x3d, 0x03, 0x3e, 0x00, 0x08, 0x00, 
-  0x35, 0x00, 0x3e, 0x00, 0x3e, 0x1b, 0x3e, 0xb8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x19, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xd8, 0x3e, 0x28, 0x3e, 0x00, 0x1d, 0x00, 
-  0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x47, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x60, 0x3a, 0x03, 0x3e, 0x00, 
-  0x3e, 0x00, 0x3e, 0x0b, 0x3e, 0x8b, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xaf, 0x3e, 0x10, 0x3e, 0x00, 
-  0x3e, 0x00, 0x3e, 0x18, 0x3e, 0xe0, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x3d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x23, 0x3a, 0x00, 
-  0x3a, 0x00, 0x3e, 0x3b, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x64, 0x3e, 0x03, 
-  0x3e, 0x03, 0x3e, 0x7b, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x9c, 0x3e, 0x04, 
-  0x3e, 0x07, 0x3e, 0xbc, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x19, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xd3, 0x3e, 0x07, 
-  0x3e, 0x08, 0x3e, 0xf3, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x19, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x0f, 
-  0x3e, 0x14, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x37, 
-  0x3e, 0x3c, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x63, 
-  0x3e, 0x57, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x7c, 
-  0x3e, 0x63, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x94, 
-  0x3e, 0x70, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x98, 
-  0x3e, 0x74, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x9b, 
-  0x3e, 0x64, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x93, 
-  0x3e, 0x53, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x7b, 
-  0x3e, 0x3b, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x64, 
-  0x3e, 0x17, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1e, 0xff, 0x5e, 0xff, 0x1d, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x48, 
-  0x3e, 0x07, 0x3e, 0xe8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x1d, 0xff, 0x3d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x1b, 
-  0x3e, 0x07, 0x3e, 0xb8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe7, 0x3e, 0x08, 
-  0x3e, 0x04, 0x3e, 0x88, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5e, 0xff, 0x3d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xb0, 0x3e, 0x04, 
-  0x3e, 0x00, 0x3e, 0x4f, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x5e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x6b, 0x3e, 0x03, 
-  0x3a, 0x00, 0x3e, 0x1b, 0x3e, 0xef, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3a, 0x23, 0x3d, 0x00, 
-  0x3e, 0x00, 0x3e, 0x0f, 0x3e, 0xa0, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xb4, 0x3e, 0x10, 0x3e, 0x00, 
-  0x3e, 0x00, 0x39, 0x00, 0x3e, 0x57, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x1e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x68, 0x3e, 0x03, 0x3e, 0x00, 
-  0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x23, 0x3e, 0xcc, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1e, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe4, 0x3e, 0x30, 0x3a, 0x00, 0x21, 0x00, 
-  0x04, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x78, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1e, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x8b, 0x3e, 0x07, 0x3e, 0x00, 0x0c, 0x00, 
-  0x00, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x3e, 0x34, 0x3e, 0xd7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xdc, 0x3e, 0x3b, 0x3e, 0x00, 0x5d, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x08, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x83, 0x3e, 0xfc, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x5e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0x97, 0x5d, 0x00, 0x3e, 0x00, 0x09, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x14, 0x3e, 0xc8, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xd8, 0x3e, 0x33, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x5b, 0x3e, 0xf0, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0x1d, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xf4, 0x3e, 0x70, 0x3a, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x3e, 0x00, 0x3e, 0xcf, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3d, 0xff, 0x19, 0xff, 0x1e, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7e, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xab, 0x3a, 0x00, 0x3e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3e, 0xd0, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x1e, 0xff, 0x19, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xd7, 0x3e, 0x18, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x3e, 0x3f, 0x3e, 0xec, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0x1d, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe4, 0x3e, 0x3b, 0x3a, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x8f, 0x3e, 0xfb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xec, 0x3e, 0x3c, 0x3e, 0x00, 0x3a, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x39, 0x0b, 0x3e, 0xc4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xf4, 0x3e, 0x40, 0x4e, 0x00, 0x5d, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3e, 0x00, 0x3e, 0x47, 0x3e, 0xe3, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xec, 0x3e, 0x4b, 0x3e, 0x00, 0x3e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3e, 0x84, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xdb, 0x3e, 0x3c, 0x3a, 0x00, 0x3e, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0d, 0x00, 0x3e, 0x00, 0x3e, 0x14, 0x3e, 0xb7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xf8, 0x3e, 0xbf, 0x3e, 0x2b, 0x3e, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x39, 0x00, 0x3e, 0x00, 0x3e, 0x43, 0x3e, 0xe4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe4, 0x3e, 0xc8, 0x3e, 0xa8, 0x3e, 0xd7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xdc, 0x3e, 0x80, 0x3d, 0x03, 0x3e, 0x00, 0x3a, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3e, 0x00, 0x39, 0x00, 0x3e, 0x74, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe3, 0x3e, 0xb7, 0x3e, 0x87, 0x3e, 0x4b, 0x3e, 0x0b, 0x3a, 0x00, 0x3e, 0x2c, 0x3e, 0x94, 0x3e, 0xdb, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe4, 0x3e, 0x9c, 0x3e, 0x3b, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x08, 0x00, 0x3e, 0x00, 0x3e, 0x18, 0x3e, 0xb4, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe3, 0x3e, 0xa8, 0x3e, 0x6f, 0x3e, 0x40, 0x3e, 0x14, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x38, 0x3e, 0x83, 0x3e, 0xdc, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xe8, 0x3e, 0x98, 0x3e, 0x47, 0xff, 0x00, 0x3e, 0x00, 0x1a, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3e, 0x00, 0x3e, 0x38, 0x3e, 0xdc, 0x3e, 0xa3, 0x3e, 0x58, 0x3e, 0x30, 0x3e, 0x14, 0x39, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3e, 0x03, 0x3e, 0x2c, 0x3e, 0x6b, 0x3e, 0xb7, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xcc, 0x3e, 0x70, 0x3e, 0x33, 0x3e, 0x0b, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x36, 0x00, 0x3d, 0x0b, 0x3e, 0x1f, 0x3e, 0x0f, 0x1c, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3a, 0x04, 0x3e, 0x13, 0x3e, 0x23, 0x3e, 0x64, 0x3e, 0xb4, 0x3e, 0xec, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3e, 0xf4, 0x3e, 0xbf, 0x3e, 0x73, 0x3e, 0x2c, 0x3e, 0x14, 0x3a, 0x04, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3d, 0x00, 0x5a, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x28, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3e, 0x03, 0x3e, 0x07, 0x3e, 0x08, 0x3e, 0x17, 0x3e, 0x47, 0x3e, 0x70, 0x3e, 0x84, 0x3e, 0x93, 0x3e, 0xa3, 0x3e, 0xac, 0x3e, 0x9f, 0x3e, 0x8b, 0x3e, 0x74, 0x3e, 0x54, 0x3e, 0x23, 0x3e, 0x0b, 0x3e, 0x07, 0x3e, 0x03, 0x9f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x31, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x00, 0x3e, 0x03, 0x81, 0x3e, 0x07, 0x0c, 0x3e, 0x17, 0x3e, 0x33, 0x3e, 0x44, 0x3e, 0x53, 0x3e, 0x60, 0x3e, 0x6c, 0x3e, 0x5c, 0x3e, 0x43, 0x3e, 0x28, 
+  0x3e, 0x13, 0x3e, 0x08, 0x3e, 0x07, 0x3e, 0x03, 0xac, 0x00, 0x00, 0x05, 0x3e, 0x08, 0x3e, 0x18, 0x3e, 0x37, 0x3e, 0x7b, 0x3e, 0xbc, 0x3e, 0xeb, 0x89, 0x3e, 0xff, 0x05, 0x3e, 0xf0, 0x3e, 0xb4, 
+  0x3e, 0x77, 0x3e, 0x3b, 0x3e, 0x1b, 0x3e, 0x0b, 0xa7, 0x00, 0x00, 0x03, 0x3e, 0x18, 0x3e, 0x3f, 0x3e, 0x88, 0x3e, 0xe0, 0x91, 0x3e, 0xff, 0x03, 0x3e, 0xeb, 0x3e, 0x90, 0x3e, 0x47, 0x3e, 0x1f, 
+  0xa3, 0x00, 0x00, 0x03, 0x3e, 0x18, 0x3e, 0x68, 0x3e, 0xb4, 0x3e, 0xfb, 0x96, 0x3e, 0xff, 0x02, 0x3e, 0xc0, 0x3e, 0x73, 0x3e, 0x28, 0x9f, 0x00, 0x00, 0x02, 0x3d, 0x07, 0x3e, 0x67, 0x3e, 0xbf, 
+  0x9b, 0x3e, 0xff, 0x02, 0x3e, 0xcc, 0x3e, 0x7f, 0x3e, 0x10, 0x9c, 0x00, 0x00, 0x02, 0x3e, 0x40, 0x3e, 0xbf, 0x3e, 0xf3, 0x9d, 0x3e, 0xff, 0x02, 0x3e, 0xfc, 0x3e, 0xc7, 0x3e, 0x53, 0x9a, 0x00, 
+  0x00, 0x01, 0x3e, 0x6f, 0x3e, 0xe4, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0xec, 0x3e, 0x88, 0x97, 0x00, 0x00, 0x02, 0x3e, 0x0b, 0x3e, 0x97, 0x3e, 0xfb, 0xa4, 0x3e, 0xff, 0x01, 0x3e, 0xa3, 0x3e, 0x10, 
+  0x94, 0x00, 0x00, 0x01, 0x3e, 0x1f, 0x3e, 0xb8, 0xa7, 0x3e, 0xff, 0x01, 0x3e, 0xbf, 0x3e, 0x23, 0x92, 0x00, 0x00, 0x01, 0x3e, 0x24, 0x3e, 0xc0, 0xa9, 0x3e, 0xff, 0x01, 0x3e, 0xdb, 0x3e, 0x2f, 
+  0x90, 0x00, 0x00, 0x01, 0x3e, 0x20, 0x3e, 0xc7, 0xab, 0x3e, 0xff, 0x01, 0x3e, 0xd4, 0x3e, 0x24, 0x8e, 0x00, 0x00, 0x01, 0x3e, 0x13, 0x3e, 0xbb, 0xad, 0x3e, 0xff, 0x01, 0x3e, 0xc3, 0x3e, 0x1b, 
+  0x8d, 0x00, 0x00, 0x00, 0x3e, 0xa8, 0x89, 0x3e, 0xff, 0x83, 0x19, 0xff, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0xb8, 0x3a, 0x0f, 0x8b, 0x00, 0x00, 0x00, 0x3e, 0x80, 0x89, 0x3e, 0xff, 0x02, 0x5e, 0xff, 
+  0xdf, 0xff, 0xff, 0xff, 0x81, 0xdf, 0xff, 0x00, 0x5e, 0xff, 0xa1, 0x3e, 0xff, 0x00, 0x3e, 0x9b, 0x8a, 0x00, 0x00, 0x01, 0x3e, 0x47, 0x3e, 0xe8, 0x88, 0x3e, 0xff, 0x00, 0x7e, 0xff, 0x85, 0xff, 
+  0xff, 0x00, 0x5e, 0xff, 0xa0, 0x3e, 0xff, 0x01, 0x3e, 0xec, 0x3e, 0x50, 0x88, 0x00, 0x00, 0x01, 0x3e, 0x07, 0x3e, 0xbf, 0x88, 0x3e, 0xff, 0x00, 0x7e, 0xff, 0x86, 0xff, 0xff, 0x00, 0x9f, 0xff, 
+  0xa1, 0x3e, 0xff, 0x01, 0x3e, 0xc8, 0x3e, 0x14, 0x87, 0x00, 0x00, 0x01, 0x3e, 0x6f, 0x3e, 0xf4, 0x88, 0x3e, 0xff, 0x88, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xa1, 0x3e, 0xff, 0x00, 0x3e, 0x88, 0x86, 
+  0x00, 0x00, 0x01, 0x3e, 0x20, 0x3e, 0xc4, 0x87, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xdf, 0xff, 0x88, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0xdb, 0x3e, 0x38, 0x85, 0x00, 0x00, 
+  0x01, 0x3e, 0x67, 0x3e, 0xfc, 0x86, 0x3e, 0xff, 0x01, 0x3d, 0xff, 0x7e, 0xff, 0x89, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x1d, 0xff, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0x7f, 0x3d, 0x03, 0x83, 0x00, 0x00, 
+  0x01, 0x3e, 0x1b, 0x3e, 0xb8, 0x87, 0x3e, 0xff, 0x01, 0x19, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0x00, 0x1e, 0xff, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0xd8, 0x3e, 0x28, 0x83, 0x00, 0x00, 0x00, 0x3e, 
+  0x47, 0x88, 0x3e, 0xff, 0x00, 0x1d, 0xff, 0x8b, 0xff, 0xff, 0x01, 0x9f, 0xff, 0x1d, 0xff, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0x60, 0x3a, 0x03, 0x81, 0x00, 0x00, 0x01, 0x3e, 0x0b, 0x3e, 0x8b, 0x89, 
+  0x3e, 0xff, 0x8c, 0xff, 0xff, 0x00, 0x1d, 0xff, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0xaf, 0x3e, 0x10, 0x81, 0x00, 0x00, 0x01, 0x3e, 0x18, 0x3e, 0xe0, 0x88, 0x3e, 0xff, 0x00, 0x5e, 0xff, 0x8c, 0xff, 
+  0xff, 0x01, 0x5e, 0xff, 0x3d, 0xff, 0xa1, 0x3e, 0xff, 0x00, 0x3e, 0x23, 0x81, 0x00, 0x00, 0x00, 0x3e, 0x3b, 0x89, 0x3e, 0xff, 0x00, 0x5e, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x9f, 0xff, 0x1d, 0xff, 
+  0xa1, 0x3e, 0xff, 0x00, 0x3e, 0x64, 0x81, 0x3e, 0x03, 0x00, 0x3e, 0x7b, 0x8a, 0x3e, 0xff, 0x8c, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xa2, 0x3e, 0xff, 0x03, 0x3e, 0x9c, 0x3e, 0x04, 0x3e, 0x07, 0x3e, 
+  0xbc, 0x89, 0x3e, 0xff, 0x00, 0x1d, 0xff, 0x8b, 0xff, 0xff, 0x01, 0xbf, 0xff, 0x19, 0xff, 0xa2, 0x3e, 0xff, 0x03, 0x3e, 0xd3, 0x3e, 0x07, 0x3e, 0x08, 0x3e, 0xf3, 0x89, 0x3e, 0xff, 0x01, 0x19, 
+  0xff, 0xbf, 0xff, 0x89, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x1d, 0xff, 0xa4, 0x3e, 0xff, 0x01, 0x3e, 0x0f, 0x3e, 0x14, 0x8b, 0x3e, 0xff, 0x00, 0x5e, 0xff, 0x88, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x1d, 
+  0xff, 0xa5, 0x3e, 0xff, 0x01, 0x3e, 0x37, 0x3e, 0x3c, 0x8b, 0x3e, 0xff, 0x00, 0x1d, 0xff, 0x88, 0xff, 0xff, 0xa7, 0x3e, 0xff, 0x01, 0x3e, 0x63, 0x3e, 0x57, 0x8b, 0x3e, 0xff, 0x01, 0x1d, 0xff, 
+  0x9e, 0xff, 0x87, 0xff, 0xff, 0x00, 0x5e, 0xff, 0xa6, 0x3e, 0xff, 0x01, 0x3e, 0x7c, 0x3e, 0x63, 0x8c, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xdf, 0xff, 0x86, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x1d, 0xff, 
+  0xa5, 0x3e, 0xff, 0x01, 0x3e, 0x94, 0x3e, 0x70, 0x8d, 0x3e, 0xff, 0x00, 0x5e, 0xff, 0x87, 0xff, 0xff, 0x00, 0x7e, 0xff, 0xa5, 0x3e, 0xff, 0x01, 0x3e, 0x98, 0x3e, 0x74, 0x8e, 0x3e, 0xff, 0x00, 
+  0xbf, 0xff, 0x87, 0xff, 0xff, 0xa5, 0x3e, 0xff, 0x01, 0x3e, 0x9b, 0x3e, 0x64, 0x8f, 0x3e, 0xff, 0x87, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x1e, 0xff, 0xa3, 0x3e, 0xff, 0x01, 0x3e, 0x93, 0x3e, 0x53, 
+  0x8f, 0x3e, 0xff, 0x00, 0x7e, 0xff, 0x87, 0xff, 0xff, 0x01, 0xbf, 0xff, 0x1e, 0xff, 0xa2, 0x3e, 0xff, 0x01, 0x3e, 0x7b, 0x3e, 0x3b, 0x90, 0x3e, 0xff, 0x00, 0xbf, 0xff, 0x87, 0xff, 0xff, 0x01, 
+  0xbf, 0xff, 0x1e, 0xff, 0xa1, 0x3e, 0xff, 0x01, 0x3e, 0x64, 0x3e, 0x17, 0x90, 0x3e, 0xff, 0x01, 0x5e, 0xff, 0xdf, 0xff, 0x87, 0xff, 0xff, 0x01, 0xbf, 0xff, 0x1e, 0xff, 0x8a, 0x3e, 0xff, 0x01, 
+  0x1e, 0xff, 0x5e, 0xff, 0x81, 0x1d, 0xff, 0x91, 0x3e, 0xff, 0x02, 0x3e, 0x48, 0x3e, 0x07, 0x3e, 0xe8, 0x8f, 0x3e, 0xff, 0x01, 0x1e, 0xff, 0x7e, 0xff, 0x88, 0xff, 0xff, 0x01, 0xbf, 0xff, 0x1e, 
+  0xff, 0x89, 0x3e, 0xff, 0x05, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x1d, 0xff, 0x3d, 0xff, 0x8f, 0x3e, 0xff, 0x02, 0x3e, 0x1b, 0x3e, 0x07, 0x3e, 0xb8, 0x90, 0x3e, 0xff, 0x01, 0x1e, 
+  0xff, 0x9f, 0xff, 0x88, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x3e, 0xff, 0x1d, 0xff, 0x85, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x01, 0x7e, 0xff, 0x1d, 0xff, 0x8d, 0x3e, 0xff, 
+  0x03, 0x3e, 0xe7, 0x3e, 0x08, 0x3e, 0x04, 0x3e, 0x88, 0x91, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xbf, 0xff, 0x89, 0xff, 0xff, 0x01, 0x9f, 0xff, 0x1d, 0xff, 0x83, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xbf, 
+  0xff, 0x86, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x5e, 0xff, 0x3d, 0xff, 0x8b, 0x3e, 0xff, 0x03, 0x3e, 0xb0, 0x3e, 0x04, 0x00, 0x00, 0x3e, 0x4f, 0x92, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xbf, 0xff, 0x89, 
+  0xff, 0xff, 0x01, 0xdf, 0xff, 0x5e, 0xff, 0x81, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0x9f, 0xff, 0x89, 0xff, 0xff, 0x01, 0xbf, 0xff, 0x5e, 0xff, 0x8a, 0x3e, 0xff, 0x04, 0x3e, 0x6b, 0x3e, 0x03, 0x00, 
+  0x00, 0x3e, 0x1b, 0x3e, 0xef, 0x92, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x7e, 0xff, 0x9f, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x9e, 0xff, 0x1e, 0xff, 0x88, 
+  0x3e, 0xff, 0x00, 0x3a, 0x23, 0x81, 0x00, 0x00, 0x01, 0x3e, 0x0f, 0x3e, 0xa0, 0x93, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xbf, 0xff, 0x9a, 0xff, 0xff, 0x00, 0x1e, 0xff, 0x87, 0x3e, 0xff, 0x01, 0x3e, 
+  0xb4, 0x3e, 0x10, 0x82, 0x00, 0x00, 0x00, 0x3e, 0x57, 0x94, 0x3e, 0xff, 0x01, 0x1d, 0xff, 0xbf, 0xff, 0x98, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x1e, 0xff, 0x87, 0x3e, 0xff, 0x01, 0x3e, 0x68, 0x3e, 
+  0x03, 0x82, 0x00, 0x00, 0x01, 0x3e, 0x23, 0x3e, 0xcc, 0x94, 0x3e, 0xff, 0x01, 0x1e, 0xff, 0x9e, 0xff, 0x97, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x1d, 0xff, 0x86, 0x3e, 0xff, 0x01, 0x3e, 0xe4, 0x3e, 
+  0x30, 0x84, 0x00, 0x00, 0x00, 0x3e, 0x78, 0x95, 0x3e, 0xff, 0x02, 0x1e, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0x95, 0xff, 0xff, 0x01, 0x9f, 0xff, 0x1d, 0xff, 0x86, 0x3e, 0xff, 0x01, 0x3e, 0x8b, 0x3e, 
+  0x07, 0x84, 0x00, 0x00, 0x01, 0x3e, 0x34, 0x3e, 0xd7, 0x96, 0x3e, 0xff, 0x01, 0x5e, 0xff, 0x7e, 0xff, 0x94, 0xff, 0xff, 0x87, 0x3e, 0xff, 0x01, 0x3e, 0xdc, 0x3e, 0x3b, 0x86, 0x00, 0x00, 0x01, 
+  0x3e, 0x83, 0x3e, 0xfc, 0x97, 0x3e, 0xff, 0x01, 0x5e, 0xff, 0x9f, 0xff, 0x91, 0xff, 0xff, 0x01, 0x9f, 0xff, 0x1d, 0xff, 0x86, 0x3e, 0xff, 0x00, 0x3e, 0x97, 0x87, 0x00, 0x00, 0x01, 0x3e, 0x14, 
+  0x3e, 0xc8, 0x9a, 0x3e, 0xff, 0x00, 0x9f, 0xff, 0x8e, 0xff, 0xff, 0x01, 0x9f, 0xff, 0x1d, 0xff, 0x86, 0x3e, 0xff, 0x01, 0x3e, 0xd8, 0x3e, 0x33, 0x88, 0x00, 0x00, 0x01, 0x3e, 0x5b, 0x3e, 0xf0, 
+  0x99, 0x3e, 0xff, 0x81, 0x1d, 0xff, 0x01, 0x7e, 0xff, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0x01, 0x5e, 0xff, 0x1d, 0xff, 0x86, 0x3e, 0xff, 0x01, 0x3e, 0xf4, 0x3e, 0x70, 0x8a, 0x00, 0x00, 0x00, 0x3e, 
+  0xcf, 0x9b, 0x3e, 0xff, 0x03, 0x3d, 0xff, 0x19, 0xff, 0x1e, 0xff, 0x9f, 0xff, 0x85, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x7e, 0xff, 0x1d, 0xff, 0x88, 0x3e, 0xff, 0x00, 0x3e, 0xab, 0x8b, 0x00, 0x00, 
+  0x00, 0x3e, 0xd0, 0x9e, 0x3e, 0xff, 0x81, 0x1d, 0xff, 0x00, 0x3e, 0xff, 0x82, 0x7e, 0xff, 0x02, 0x1e, 0xff, 0x19, 0xff, 0x1d, 0xff, 0x88, 0x3e, 0xff, 0x01, 0x3e, 0xd7, 0x3e, 0x18, 0x8a, 0x00, 
+  0x00, 0x01, 0x3e, 0x3f, 0x3e, 0xec, 0xa1, 0x3e, 0xff, 0x81, 0x1d, 0xff, 0x8b, 0x3e, 0xff, 0x01, 0x3e, 0xe4, 0x3e, 0x3b, 0x8b, 0x00, 0x00, 0x01, 0x3e, 0x8f, 0x3e, 0xfb, 0xae, 0x3e, 0xff, 0x01, 
+  0x3e, 0xec, 0x3e, 0x3c, 0x8b, 0x00, 0x00, 0x01, 0x39, 0x0b, 0x3e, 0xc4, 0xae, 0x3e, 0xff, 0x01, 0x3e, 0xf4, 0x3e, 0x40, 0x8c, 0x00, 0x00, 0x01, 0x3e, 0x47, 0x3e, 0xe3, 0xad, 0x3e, 0xff, 0x01, 
+  0x3e, 0xec, 0x3e, 0x4b, 0x8d, 0x00, 0x00, 0x00, 0x3e, 0x84, 0xad, 0x3e, 0xff, 0x01, 0x3e, 0xdb, 0x3e, 0x3c, 0x8d, 0x00, 0x00, 0x01, 0x3e, 0x14, 0x3e, 0xb7, 0xab, 0x3e, 0xff, 0x02, 0x3e, 0xf8, 
+  0x3e, 0xbf, 0x3e, 0x2b, 0x8e, 0x00, 0x00, 0x01, 0x3e, 0x43, 0x3e, 0xe4, 0x86, 0x3e, 0xff, 0x03, 0x3e, 0xe4, 0x3e, 0xc8, 0x3e, 0xa8, 0x3e, 0xd7, 0x9f, 0x3e, 0xff, 0x02, 0x3e, 0xdc, 0x3e, 0x80, 
+  0x3d, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x3e, 0x74, 0x84, 0x3e, 0xff, 0x08, 0x3e, 0xe3, 0x3e, 0xb7, 0x3e, 0x87, 0x3e, 0x4b, 0x3e, 0x0b, 0x00, 0x00, 0x3e, 0x2c, 0x3e, 0x94, 0x3e, 0xdb, 0x9b, 0x3e, 
+  0xff, 0x02, 0x3e, 0xe4, 0x3e, 0x9c, 0x3e, 0x3b, 0x90, 0x00, 0x00, 0x01, 0x3e, 0x18, 0x3e, 0xb4, 0x81, 0x3e, 0xff, 0x04, 0x3e, 0xe3, 0x3e, 0xa8, 0x3e, 0x6f, 0x3e, 0x40, 0x3e, 0x14, 0x85, 0x00, 
+  0x00, 0x02, 0x3e, 0x38, 0x3e, 0x83, 0x3e, 0xdc, 0x97, 0x3e, 0xff, 0x02, 0x3e, 0xe8, 0x3e, 0x98, 0x3e, 0x47, 0x92, 0x00, 0x00, 0x05, 0x3e, 0x38, 0x3e, 0xdc, 0x3e, 0xa3, 0x3e, 0x58, 0x3e, 0x30, 
+  0x3e, 0x14, 0x89, 0x00, 0x00, 0x03, 0x3e, 0x03, 0x3e, 0x2c, 0x3e, 0x6b, 0x3e, 0xb7, 0x93, 0x3e, 0xff, 0x03, 0x3e, 0xcc, 0x3e, 0x70, 0x3e, 0x33, 0x3e, 0x0b, 0x93, 0x00, 0x00, 0x02, 0x3d, 0x0b, 
+  0x3e, 0x1f, 0x3e, 0x0f, 0x8e, 0x00, 0x00, 0x05, 0x3a, 0x04, 0x3e, 0x13, 0x3e, 0x23, 0x3e, 0x64, 0x3e, 0xb4, 0x3e, 0xec, 0x8b, 0x3e, 0xff, 0x05, 0x3e, 0xf4, 0x3e, 0xbf, 0x3e, 0x73, 0x3e, 0x2c, 
+  0x3e, 0x14, 0x3a, 0x04, 0xaa, 0x00, 0x00, 0x11, 0x3e, 0x03, 0x3e, 0x07, 0x3e, 0x08, 0x3e, 0x17, 0x3e, 0x47, 0x3e, 0x70, 0x3e, 0x84, 0x3e, 0x93, 0x3e, 0xa3, 0x3e, 0xac, 0x3e, 0x9f, 0x3e, 0x8b, 
+  0x3e, 0x74, 0x3e, 0x54, 0x3e, 0x23, 0x3e, 0x0b, 0x3e, 0x07, 0x3e, 0x03, 0x96, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1d, 0x00, 0x2c, 0x2f, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0xac, 0x1e, 0x00, 0x8d, 0x26, 0x03, 0xad, 0x2e, 0x07, 0xad, 0x26, 0x07, 0xcd, 0x26, 0x17, 0xac, 0x26, 0x33, 0xad, 0x26, 0x44, 0xad, 0x26, 0x53, 0xad, 0x26, 0x60, 0xad, 0x2e, 0x6c, 0x8d, 0x26, 0x5c, 0x8d, 0x2e, 0x43, 0xad, 0x26, 0x28, 0xcd, 0x26, 0x13, 0xad, 0x26, 0x08, 0xad, 0x2e, 0x07, 0xad, 0x2e, 0x03, 0x8c, 0x26, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0x8d, 0x26, 0x00, 0xcb, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x4e, 0x2e, 0x00, 0xac, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0x6d, 0x2e, 0x00, 0x8d, 0x2e, 0x08, 0xad, 0x2e, 0x18, 0xad, 0x26, 0x37, 0x8d, 0x26, 0x7b, 0xad, 0x2e, 0xbc, 0xad, 0x2e, 0xeb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xf0, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0x77, 0x8d, 0x2e, 0x3b, 0xad, 0x2e, 0x1b, 0xad, 0x2e, 0x0b, 0xac, 0x2e, 0x00, 0xad, 0x26, 0x00, 0x8d, 0x2e, 0x00, 0x27, 0x07, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x18, 0xad, 0x2e, 0x3f, 0xad, 0x2e, 0x88, 0xad, 0x2e, 0xe0, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xeb, 0xad, 0x2e, 0x90, 0xad, 0x2e, 0x47, 0xad, 0x26, 0x1f, 0x49, 0x07, 0x00, 0xad, 0x26, 0x00, 0x0c, 0x1e, 0x00, 0x89, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x2e, 0x00, 0xac, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x8c, 0x2e, 0x18, 0x8d, 0x2e, 0x68, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xc0, 0xad, 0x2e, 0x73, 0xad, 0x26, 0x28, 0xcd, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x05, 0x00, 0x0d, 0x2f, 0x00, 0xad, 0x2e, 0x00, 0xac, 0x2e, 0x07, 0x8d, 0x2e, 0x67, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xcc, 0xad, 0x2e, 0x7f, 0xcd, 0x2e, 0x10, 0xad, 0x2e, 0x00, 0x0d, 0x00, 0x00, 0x6d, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x26, 0x00, 0x6c, 0x05, 0x00, 0xcd, 0x2e, 0x00, 0xad, 0x2e, 0x40, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0xf3, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xfc, 0xad, 0x2e, 0xc7, 0xad, 0x2e, 0x53, 0xcd, 0x2e, 0x00, 0x6d, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0xac, 0x2e, 0x00, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0xe4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xec, 0xad, 0x2e, 0x88, 0xae, 0x07, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0xcd, 0x2e, 0x0b, 0x8d, 0x2e, 0x97, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xa3, 0xcd, 0x26, 0x10, 0xad, 0x26, 0x00, 0x6d, 0x2e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x1f, 0xad, 0x2e, 0xb8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0x23, 0x6d, 0x26, 0x00, 0x0a, 0x17, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x26, 0x24, 0xad, 0x2e, 0xc0, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xdb, 0x8d, 0x2e, 0x2f, 0x6d, 0x26, 0x00, 0x6d, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x26, 0x00, 0x8d, 0x26, 0x00, 0xad, 0x2e, 0x20, 0xad, 0x2e, 0xc7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8d, 0x26, 0xd4, 0xad, 0x26, 0x24, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x8d, 0x26, 0x13, 0xad, 0x2e, 0xbb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xc3, 0x8d, 0x2e, 0x1b, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x2e, 0x00, 0x8c, 0x2e, 0x00, 0xcf, 0x07, 0x00, 0xad, 0x2e, 0xa8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0x8a, 0x06, 0xff, 0x8a, 0x06, 0xff, 0x8a, 0x06, 0xff, 0x8b, 0x06, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xb8, 0x8c, 0x2e, 0x0f, 0xad, 0x2e, 0x00, 0xee, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x26, 0x00, 0x8d, 0x26, 0x00, 0xad, 0x2e, 0x80, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0xf0, 0x4e, 0xff, 0x79, 0xc7, 0xff, 0xbc, 0xdf, 0xff, 0x9a, 0xcf, 0xff, 0x79, 0xb7, 0xff, 0xf0, 0x4e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x9b, 0x6c, 0x2e, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x26, 0x00, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x47, 0xad, 0x2e, 0xe8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0x12, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xef, 0xff, 0xae, 0x3e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xec, 0xad, 0x2e, 0x50, 0xad, 0x2e, 0x00, 0xad, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0xad, 0x26, 0x00, 0xcc, 0x26, 0x07, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0xf2, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x8f, 0xff, 0x8c, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xc8, 0xad, 0x26, 0x14, 0xad, 0x26, 0x00, 0x8c, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x0b, 0x27, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0xf4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x26, 0xff, 0xce, 0x2e, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xe7, 0xff, 0x8c, 0x0e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x88, 0xae, 0x1e, 0x00, 0x8c, 0x2e, 0x00, 0xe3, 0x09, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4e, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x20, 0xad, 0x2e, 0xc4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8b, 0x06, 0xff, 0x9b, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x56, 0xff, 0x8c, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xdb, 0xad, 0x2e, 0x38, 0xad, 0x26, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xcc, 0x26, 0x00, 0x6d, 0x2e, 0x00, 0xad, 0x2e, 0x67, 0xad, 0x2e, 0xfc, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x16, 0xff, 0xf1, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xbf, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x7f, 0x8a, 0x36, 0x03, 0x8c, 0x2e, 0x00, 0xa4, 0x09, 0x00, 
-  0x8b, 0x25, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x26, 0x1b, 0xad, 0x2e, 0xb8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8a, 0x06, 0xff, 0x79, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x06, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xd8, 0x8d, 0x2e, 0x28, 0xac, 0x26, 0x00, 0xc7, 0x06, 0x00, 
-  0x6d, 0x2e, 0x00, 0xcc, 0x26, 0x00, 0x8d, 0x2e, 0x47, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8b, 0x06, 0xff, 0xbc, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0x8f, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x60, 0x8d, 0x2e, 0x03, 0x8d, 0x2e, 0x00, 
-  0xad, 0x2e, 0x00, 0xad, 0x2e, 0x0b, 0xad, 0x2e, 0x8b, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x26, 0xff, 0xce, 0x1e, 0xff, 0xdd, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xe7, 0xff, 0x8a, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xaf, 0xad, 0x2e, 0x10, 0xad, 0x26, 0x00, 
-  0xad, 0x2e, 0x00, 0xad, 0x2e, 0x18, 0xad, 0x2e, 0xe0, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0xd0, 0x46, 0xff, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf1, 0x56, 0xff, 0x8c, 0x16, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0x23, 0x4d, 0x2e, 0x00, 
-  0x6d, 0x2e, 0x00, 0x8d, 0x2e, 0x3b, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0xcf, 0x3e, 0xff, 0xdd, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0x97, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8d, 0x2e, 0x64, 0x8d, 0x2e, 0x03, 
-  0x8d, 0x2e, 0x03, 0x8d, 0x2e, 0x7b, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x26, 0xff, 0xce, 0x1e, 0xff, 0xdd, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xcf, 0x3e, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x9c, 0xad, 0x2e, 0x04, 
-  0x8d, 0x26, 0x07, 0x8d, 0x26, 0xbc, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8a, 0x06, 0xff, 0xbc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xa7, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xd3, 0xad, 0x2e, 0x07, 
-  0xad, 0x26, 0x08, 0xad, 0x2e, 0xf3, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8b, 0x06, 0xff, 0x78, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xc7, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x0f, 
-  0xcd, 0x26, 0x14, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0xf0, 0x4e, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xcf, 0xff, 0xac, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x37, 
-  0x8d, 0x2e, 0x3c, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8b, 0x06, 0xff, 0xbc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xae, 0x36, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x63, 
-  0xad, 0x26, 0x57, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x06, 0xff, 0x13, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x46, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0x7c, 
-  0xad, 0x2e, 0x63, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x06, 0xff, 0xbc, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xc7, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x94, 
-  0xad, 0x2e, 0x70, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x26, 0xff, 0xf0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x6f, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x98, 
-  0xad, 0x26, 0x74, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x1e, 0xff, 0x77, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xae, 0x1e, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x9b, 
-  0x8d, 0x2e, 0x64, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xdc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xcf, 0xff, 0xad, 0x0e, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x93, 
-  0xad, 0x2e, 0x53, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xf1, 0x66, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xaf, 0xff, 0xac, 0x06, 0xff, 0x8c, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x7b, 
-  0x8d, 0x2e, 0x3b, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x56, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x9f, 0xff, 0xac, 0x06, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8d, 0x2e, 0x64, 
-  0xad, 0x2e, 0x17, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xac, 0x26, 0xff, 0xce, 0x46, 0xff, 0x9b, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x9f, 0xff, 0xac, 0x06, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xac, 0x06, 0xff, 0xf0, 0x4e, 0xff, 0x8b, 0x06, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8d, 0x2e, 0x48, 
-  0xcd, 0x26, 0x07, 0xad, 0x2e, 0xe8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x0e, 0xff, 0xf2, 0x6e, 0xff, 0xde, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xa7, 0xff, 0xac, 0x06, 0xff, 0x8c, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x16, 0xff, 0x9a, 0xcf, 0xff, 0xde, 0xef, 0xff, 0x9b, 0xd7, 0xff, 0x13, 0x77, 0xff, 0x8c, 0x06, 0xff, 0x8c, 0x16, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x2e, 0x1b, 
-  0xad, 0x2e, 0x07, 0xad, 0x2e, 0xb8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x0e, 0xff, 0x34, 0x87, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xc7, 0xff, 0xce, 0x1e, 0xff, 0x8c, 0x16, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8b, 0x06, 0xff, 0x9a, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd7, 0xff, 0xf1, 0x5e, 0xff, 0x8b, 0x06, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe7, 0xac, 0x2e, 0x08, 
-  0xad, 0x2e, 0x04, 0xad, 0x2e, 0x88, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x06, 0xff, 0x56, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x7f, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8b, 0x06, 0xff, 0x78, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xc7, 0xff, 0xcf, 0x36, 0xff, 0x8c, 0x16, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8d, 0x26, 0xb0, 0x8d, 0x26, 0x04, 
-  0x8c, 0x26, 0x00, 0x8d, 0x26, 0x4f, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8b, 0x06, 0xff, 0x78, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xcf, 0xff, 0xd0, 0x4e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x0e, 0xff, 0x35, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xaf, 0xff, 0xcf, 0x3e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x6b, 0xad, 0x2e, 0x03, 
-  0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x1b, 0xad, 0x2e, 0xef, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8a, 0x06, 0xff, 0x99, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xb7, 0xff, 0xf2, 0x76, 0xff, 0x35, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x14, 0x7f, 0xff, 0x8c, 0x0e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8d, 0x26, 0x23, 0x0b, 0x37, 0x00, 
-  0xad, 0x26, 0x00, 0x8d, 0x26, 0x0f, 0xad, 0x26, 0xa0, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8b, 0x06, 0xff, 0x78, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd7, 0xff, 0xad, 0x06, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0x10, 0xad, 0x26, 0x00, 
-  0x8c, 0x26, 0x00, 0x4a, 0x1e, 0x00, 0xad, 0x2e, 0x57, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x06, 0xff, 0x57, 0xa7, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd7, 0xff, 0xac, 0x06, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0x68, 0x8d, 0x26, 0x03, 0xad, 0x26, 0x00, 
-  0x4d, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x23, 0xad, 0x2e, 0xcc, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xac, 0x0e, 0xff, 0x14, 0x87, 0xff, 0xdd, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xbf, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe4, 0xad, 0x26, 0x30, 0x8d, 0x2e, 0x00, 0x09, 0x18, 0x00, 
-  0x00, 0x01, 0x00, 0xad, 0x2e, 0x00, 0x0f, 0x27, 0x00, 0xad, 0x2e, 0x78, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xac, 0x0e, 0xff, 0xf1, 0x66, 0xff, 0x99, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x35, 0x8f, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x8b, 0xac, 0x2e, 0x07, 0xad, 0x2e, 0x00, 0xa4, 0x0a, 0x00, 
-  0x00, 0x00, 0x00, 0x67, 0x2d, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x34, 0xad, 0x2e, 0xd7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xac, 0x1e, 0xff, 0xae, 0x3e, 0xff, 0x13, 0x77, 0xff, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xef, 0xff, 0xce, 0x26, 0xff, 0x8c, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0x3b, 0xad, 0x26, 0x00, 0xcb, 0x3e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa2, 0x01, 0x00, 0xab, 0x2e, 0x00, 0x8d, 0x26, 0x00, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0xfc, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x26, 0xff, 0xad, 0x36, 0xff, 0x35, 0x8f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x87, 0xff, 0x8c, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0x97, 0xac, 0x36, 0x00, 0x8d, 0x26, 0x00, 0x84, 0x0a, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x2e, 0x00, 0xad, 0x26, 0x00, 0xad, 0x26, 0x14, 0xad, 0x2e, 0xc8, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x26, 0xff, 0xad, 0x16, 0xff, 0x35, 0x8f, 0xff, 0xdd, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x87, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xd8, 0x8d, 0x2e, 0x33, 0x8d, 0x2e, 0x00, 0x8d, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x26, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x2e, 0x5b, 0xad, 0x2e, 0xf0, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x0e, 0xff, 0x8c, 0x06, 0xff, 0x12, 0x67, 0xff, 0x9a, 0xc7, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xd7, 0xff, 0xf0, 0x3e, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xf4, 0xad, 0x2e, 0x70, 0x8c, 0x2e, 0x00, 0x0b, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0x0e, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0xcf, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x16, 0xff, 0x8a, 0x06, 0xff, 0xad, 0x06, 0xff, 0x35, 0x8f, 0xff, 0xbc, 0xdf, 0xff, 0xdd, 0xe7, 0xff, 0xde, 0xef, 0xff, 0xde, 0xef, 0xff, 0xde, 0xef, 0xff, 0xbd, 0xe7, 0xff, 0x9a, 0xcf, 0xff, 0x12, 0x6f, 0xff, 0x8b, 0x06, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xab, 0x6c, 0x2e, 0x00, 0xed, 0x1e, 0x00, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x2e, 0x00, 0x0c, 0x26, 0x00, 0xad, 0x2e, 0xd0, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0x8c, 0x26, 0xff, 0x8b, 0x06, 0xff, 0x8a, 0x06, 0xff, 0xcf, 0x2e, 0xff, 0xf2, 0x66, 0xff, 0x12, 0x6f, 0xff, 0xf1, 0x56, 0xff, 0xad, 0x06, 0xff, 0x8a, 0x06, 0xff, 0x8c, 0x0e, 0xff, 0xad, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xd7, 0x8c, 0x26, 0x18, 0xad, 0x26, 0x00, 0xad, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x00, 0xad, 0x26, 0x00, 0xad, 0x26, 0x3f, 0xad, 0x2e, 0xec, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x26, 0xff, 0x8c, 0x16, 0xff, 0x8c, 0x0e, 0xff, 0x8c, 0x16, 0xff, 0xac, 0x26, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe4, 0xad, 0x2e, 0x3b, 0x8d, 0x2e, 0x00, 0x6d, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x8f, 0xad, 0x2e, 0xfb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xec, 0xad, 0x26, 0x3c, 0xad, 0x26, 0x00, 0x8e, 0x26, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x26, 0x00, 0x6c, 0x26, 0x0b, 0xad, 0x2e, 0xc4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xf4, 0xad, 0x2e, 0x40, 0x51, 0x33, 0x00, 0x8c, 0x3e, 0x00, 0x6d, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x05, 0x00, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x47, 0xad, 0x2e, 0xe3, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xec, 0xad, 0x2e, 0x4b, 0xee, 0x2e, 0x00, 0xcd, 0x2e, 0x00, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x1f, 0x00, 0x8c, 0x2e, 0x00, 0xad, 0x2e, 0x84, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xdb, 0xad, 0x2e, 0x3c, 0x8c, 0x2e, 0x00, 0xee, 0x2e, 0x00, 0x87, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x8d, 0x26, 0x00, 0x8d, 0x26, 0x14, 0xad, 0x2e, 0xb7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xbf, 0xac, 0x2e, 0x2b, 0x8d, 0x2e, 0x00, 0x2d, 0x2e, 0x00, 0xee, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xeb, 0x35, 0x00, 0x8d, 0x2e, 0x00, 0x8d, 0x2e, 0x43, 0xad, 0x2e, 0xe4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe4, 0xad, 0x2e, 0xc8, 0xad, 0x2e, 0xa8, 0xad, 0x2e, 0xd7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0x80, 0x6b, 0x27, 0x03, 0xad, 0x2e, 0x00, 0x8d, 0x2e, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xcd, 0x2e, 0x00, 0x0a, 0x26, 0x00, 0xad, 0x2e, 0x74, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe3, 0xad, 0x2e, 0xb7, 0xad, 0x2e, 0x87, 0xad, 0x26, 0x4b, 0xad, 0x26, 0x0b, 0x8c, 0x2e, 0x00, 0x8d, 0x2e, 0x2c, 0xad, 0x2e, 0x94, 0xad, 0x2e, 0xdb, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe4, 0xad, 0x2e, 0x9c, 0x8d, 0x26, 0x3b, 0x8d, 0x26, 0x00, 0xac, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xa0, 0x01, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x2e, 0x18, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe3, 0xad, 0x2e, 0xa8, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0x40, 0xad, 0x26, 0x14, 0x8d, 0x26, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x26, 0x00, 0xe8, 0x3c, 0x00, 0x8d, 0x2e, 0x00, 0xee, 0x36, 0x00, 0x8d, 0x2e, 0x38, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xe8, 0xad, 0x2e, 0x98, 0xad, 0x2e, 0x47, 0xff, 0xff, 0x00, 0x8d, 0x26, 0x00, 0x50, 0x0e, 0x00, 0xab, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x38, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0xa3, 0xad, 0x2e, 0x58, 0xad, 0x2e, 0x30, 0xad, 0x2e, 0x14, 0x6c, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x26, 0x00, 0x0d, 0x2f, 0x00, 0xcd, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x26, 0x00, 0x8c, 0x26, 0x00, 0x8d, 0x2e, 0x00, 0xec, 0x2e, 0x03, 0xad, 0x26, 0x2c, 0x8d, 0x26, 0x6b, 0xad, 0x2e, 0xb7, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xcc, 0x8d, 0x2e, 0x70, 0xad, 0x26, 0x33, 0xad, 0x26, 0x0b, 0x8d, 0x2e, 0x00, 0xad, 0x26, 0x00, 0xac, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x6f, 0x35, 0x00, 0xac, 0x26, 0x0b, 0x8d, 0x26, 0x1f, 0xad, 0x2e, 0x0f, 0xe0, 0x07, 0x00, 0x8d, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0xee, 0x26, 0x00, 0xee, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x0a, 0x00, 0x69, 0x37, 0x00, 0xad, 0x2e, 0x00, 0xad, 0x2e, 0x00, 0x8d, 0x26, 0x04, 0xad, 0x2e, 0x13, 0xad, 0x2e, 0x23, 0x8d, 0x2e, 0x64, 0x8d, 0x26, 0xb4, 0xad, 0x2e, 0xec, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x2e, 0xf4, 0xad, 0x2e, 0xbf, 0x8d, 0x2e, 0x73, 0xad, 0x2e, 0x2c, 0xad, 0x26, 0x14, 0x8d, 0x26, 0x04, 0xad, 0x2e, 0x00, 0xad, 0x26, 0x00, 0xac, 0x26, 0x00, 0x86, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xa9, 0x1f, 0x00, 0x72, 0x46, 0x00, 0xed, 0x2e, 0x00, 0x8d, 0x26, 0x00, 0xac, 0x26, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0a, 0x00, 0xa0, 0x21, 0x00, 0x8d, 0x26, 0x00, 0xad, 0x2e, 0x00, 0x6c, 0x2e, 0x00, 0x8d, 0x2e, 0x03, 0x8d, 0x26, 0x07, 0x8d, 0x2e, 0x08, 0xad, 0x2e, 0x17, 0xad, 0x2e, 0x47, 0xad, 0x26, 0x70, 0xad, 0x2e, 0x84, 0xad, 0x2e, 0x93, 0x8d, 0x2e, 0xa3, 0xad, 0x2e, 0xac, 0xad, 0x2e, 0x9f, 0xad, 0x26, 0x8b, 0x8d, 0x26, 0x74, 0x8c, 0x2e, 0x54, 0xad, 0x2e, 0x23, 0xad, 0x2e, 0x0b, 0xad, 0x2e, 0x07, 0x8d, 0x2e, 0x03, 0xff, 0x7f, 0x00, 0xad, 0x2e, 0x00, 0x8d, 0x26, 0x00, 0x27, 0x2c, 0x00, 0xc5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x00, 0x0f, 0x8d, 0x26, 0x03, 0xad, 0x2e, 0x07, 0xad, 0x26, 0x07, 0xcd, 0x26, 0x17, 0xac, 0x26, 0x33, 0xad, 0x26, 0x44, 0xad, 0x26, 0x53, 0xad, 0x26, 
+  0x60, 0xad, 0x2e, 0x6c, 0x8d, 0x26, 0x5c, 0x8d, 0x2e, 0x43, 0xad, 0x26, 0x28, 0xcd, 0x26, 0x13, 0xad, 0x26, 0x08, 0xad, 0x2e, 0x07, 0xad, 0x2e, 0x03, 0xac, 0x00, 0x00, 0x00, 0x05, 0x8d, 0x2e, 
+  0x08, 0xad, 0x2e, 0x18, 0xad, 0x26, 0x37, 0x8d, 0x26, 0x7b, 0xad, 0x2e, 0xbc, 0xad, 0x2e, 0xeb, 0x89, 0xad, 0x2e, 0xff, 0x05, 0xad, 0x2e, 0xf0, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0x77, 0x8d, 0x2e, 
+  0x3b, 0xad, 0x2e, 0x1b, 0xad, 0x2e, 0x0b, 0xa7, 0x00, 0x00, 0x00, 0x03, 0x8d, 0x2e, 0x18, 0xad, 0x2e, 0x3f, 0xad, 0x2e, 0x88, 0xad, 0x2e, 0xe0, 0x91, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x2e, 0xeb, 
+  0xad, 0x2e, 0x90, 0xad, 0x2e, 0x47, 0xad, 0x26, 0x1f, 0xa3, 0x00, 0x00, 0x00, 0x03, 0x8c, 0x2e, 0x18, 0x8d, 0x2e, 0x68, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0xfb, 0x96, 0xad, 0x2e, 0xff, 0x02, 0xad, 
+  0x2e, 0xc0, 0xad, 0x2e, 0x73, 0xad, 0x26, 0x28, 0x9f, 0x00, 0x00, 0x00, 0x02, 0xac, 0x2e, 0x07, 0x8d, 0x2e, 0x67, 0xad, 0x2e, 0xbf, 0x9b, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xcc, 0xad, 0x2e, 
+  0x7f, 0xcd, 0x2e, 0x10, 0x9c, 0x00, 0x00, 0x00, 0x02, 0xad, 0x2e, 0x40, 0xad, 0x2e, 0xbf, 0xad, 0x2e, 0xf3, 0x9d, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xfc, 0xad, 0x2e, 0xc7, 0xad, 0x2e, 0x53, 
+  0x9a, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0xe4, 0xa1, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xec, 0xad, 0x2e, 0x88, 0x97, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x2e, 0x0b, 0x8d, 0x2e, 
+  0x97, 0xad, 0x2e, 0xfb, 0xa4, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xa3, 0xcd, 0x26, 0x10, 0x94, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x1f, 0xad, 0x2e, 0xb8, 0xa7, 0xad, 0x2e, 0xff, 0x01, 0xad, 
+  0x2e, 0xbf, 0xad, 0x2e, 0x23, 0x92, 0x00, 0x00, 0x00, 0x01, 0xad, 0x26, 0x24, 0xad, 0x2e, 0xc0, 0xa9, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xdb, 0x8d, 0x2e, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x01, 
+  0xad, 0x2e, 0x20, 0xad, 0x2e, 0xc7, 0xab, 0xad, 0x2e, 0xff, 0x01, 0x8d, 0x26, 0xd4, 0xad, 0x26, 0x24, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x26, 0x13, 0xad, 0x2e, 0xbb, 0xad, 0xad, 0x2e, 0xff, 
+  0x01, 0xad, 0x2e, 0xc3, 0x8d, 0x2e, 0x1b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0xa8, 0x88, 0xad, 0x2e, 0xff, 0x00, 0x8c, 0x1e, 0xff, 0x82, 0x8a, 0x06, 0xff, 0x01, 0x8b, 0x06, 0xff, 0x8c, 
+  0x1e, 0xff, 0xa0, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xb8, 0x8c, 0x2e, 0x0f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x80, 0x88, 0xad, 0x2e, 0xff, 0x07, 0x8c, 0x1e, 0xff, 0xf0, 0x4e, 0xff, 
+  0x79, 0xc7, 0xff, 0xbc, 0xdf, 0xff, 0x9a, 0xcf, 0xff, 0x79, 0xb7, 0xff, 0xf0, 0x4e, 0xff, 0xad, 0x26, 0xff, 0xa0, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x2e, 0x9b, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x8d, 
+  0x2e, 0x47, 0xad, 0x2e, 0xe8, 0x87, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x1e, 0xff, 0x12, 0x67, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xde, 0xef, 0xff, 0xae, 0x3e, 0xff, 0xa0, 0xad, 0x2e, 0xff, 0x01, 
+  0xad, 0x2e, 0xec, 0xad, 0x2e, 0x50, 0x88, 0x00, 0x00, 0x00, 0x01, 0xcc, 0x26, 0x07, 0xad, 0x2e, 0xbf, 0x87, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x1e, 0xff, 0xf2, 0x5e, 0xff, 0x86, 0xff, 0xff, 0xff, 
+  0x01, 0x56, 0x8f, 0xff, 0x8c, 0x26, 0xff, 0xa0, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xc8, 0xad, 0x26, 0x14, 0x87, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0xf4, 0x86, 0xad, 0x2e, 
+  0xff, 0x02, 0x8c, 0x26, 0xff, 0xce, 0x2e, 0xff, 0xff, 0xf7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xdd, 0xe7, 0xff, 0x8c, 0x0e, 0xff, 0xa1, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x2e, 0x88, 0x86, 0x00, 
+  0x00, 0x00, 0x01, 0xad, 0x2e, 0x20, 0xad, 0x2e, 0xc4, 0x86, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0x8b, 0x06, 0xff, 0x9b, 0xcf, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xf1, 0x56, 0xff, 0x8c, 
+  0x26, 0xff, 0xa0, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xdb, 0xad, 0x2e, 0x38, 0x85, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x67, 0xad, 0x2e, 0xfc, 0x86, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x16, 0xff, 
+  0xf1, 0x56, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x9a, 0xbf, 0xff, 0x8b, 0x06, 0xff, 0xa1, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x7f, 0x8a, 0x36, 0x03, 0x83, 0x00, 0x00, 0x00, 0x01, 0xad, 0x26, 
+  0x1b, 0xad, 0x2e, 0xb8, 0x87, 0xad, 0x2e, 0xff, 0x01, 0x8a, 0x06, 0xff, 0x79, 0xbf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xad, 0x06, 0xff, 0xac, 0x26, 0xff, 0xa0, 0xad, 0x2e, 0xff, 0x01, 0xad, 
+  0x2e, 0xd8, 0x8d, 0x2e, 0x28, 0x83, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x2e, 0x47, 0x87, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0x8b, 0x06, 0xff, 0xbc, 0xe7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 
+  0x35, 0x8f, 0xff, 0x8b, 0x06, 0xff, 0xa1, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x60, 0x8d, 0x2e, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x0b, 0xad, 0x2e, 0x8b, 0x87, 0xad, 0x2e, 0xff, 
+  0x02, 0x8c, 0x26, 0xff, 0xce, 0x1e, 0xff, 0xdd, 0xe7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xe7, 0xff, 0x8a, 0x06, 0xff, 0xa1, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xaf, 0xad, 0x2e, 0x10, 
+  0x81, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x18, 0xad, 0x2e, 0xe0, 0x87, 0xad, 0x2e, 0xff, 0x02, 0x8c, 0x1e, 0xff, 0xd0, 0x46, 0xff, 0xdd, 0xef, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xff, 0xf7, 
+  0xff, 0xf1, 0x56, 0xff, 0x8c, 0x16, 0xff, 0xa1, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x26, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x2e, 0x3b, 0x88, 0xad, 0x2e, 0xff, 0x02, 0x8c, 0x1e, 0xff, 0xcf, 
+  0x3e, 0xff, 0xdd, 0xe7, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0x35, 0x97, 0xff, 0x8b, 0x06, 0xff, 0xa1, 0xad, 0x2e, 0xff, 0x00, 0x8d, 0x2e, 0x64, 0x81, 0x8d, 0x2e, 0x03, 0x00, 0x8d, 0x2e, 0x7b, 
+  0x88, 0xad, 0x2e, 0xff, 0x02, 0x8c, 0x26, 0xff, 0xce, 0x1e, 0xff, 0xdd, 0xe7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xf7, 0xff, 0xcf, 0x3e, 0xff, 0x8c, 0x1e, 0xff, 0xa1, 0xad, 0x2e, 0xff, 
+  0x03, 0xad, 0x2e, 0x9c, 0xad, 0x2e, 0x04, 0x8d, 0x26, 0x07, 0x8d, 0x26, 0xbc, 0x88, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0x8a, 0x06, 0xff, 0xbc, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 
+  0x57, 0xa7, 0xff, 0x8b, 0x06, 0xff, 0xa2, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x2e, 0xd3, 0xad, 0x2e, 0x07, 0xad, 0x26, 0x08, 0xad, 0x2e, 0xf3, 0x89, 0xad, 0x2e, 0xff, 0x01, 0x8b, 0x06, 0xff, 0x78, 
+  0xaf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x9a, 0xc7, 0xff, 0x8b, 0x06, 0xff, 0xa4, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x0f, 0xcd, 0x26, 0x14, 0x8a, 0xad, 0x2e, 0xff, 0x02, 0x8c, 0x1e, 0xff, 
+  0xf0, 0x4e, 0xff, 0xff, 0xf7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x9a, 0xcf, 0xff, 0xac, 0x06, 0xff, 0xa5, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x37, 0x8d, 0x2e, 0x3c, 0x8b, 0xad, 0x2e, 0xff, 
+  0x01, 0x8b, 0x06, 0xff, 0xbc, 0xdf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xff, 0xf7, 0xff, 0xae, 0x36, 0xff, 0xad, 0x26, 0xff, 0xa5, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x63, 0xad, 0x26, 0x57, 
+  0x8b, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x06, 0xff, 0x13, 0x77, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0xcf, 0x46, 0xff, 0xa6, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0x7c, 0xad, 0x2e, 0x63, 0x8b, 0xad, 
+  0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0x8c, 0x06, 0xff, 0xbc, 0xd7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0x9a, 0xc7, 0xff, 0x8b, 0x06, 0xff, 0xa5, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x94, 0xad, 
+  0x2e, 0x70, 0x8c, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x26, 0xff, 0xf0, 0x4e, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x13, 0x6f, 0xff, 0x8c, 0x1e, 0xff, 0xa4, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x98, 
+  0xad, 0x26, 0x74, 0x8d, 0xad, 0x2e, 0xff, 0x01, 0x8c, 0x1e, 0xff, 0x77, 0xa7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xff, 0xf7, 0xff, 0xae, 0x1e, 0xff, 0xac, 0x26, 0xff, 0xa3, 0xad, 0x2e, 0xff, 
+  0x01, 0xad, 0x2e, 0x9b, 0x8d, 0x2e, 0x64, 0x8f, 0xad, 0x2e, 0xff, 0x00, 0xdc, 0xdf, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xbb, 0xcf, 0xff, 0xad, 0x0e, 0xff, 0xac, 0x26, 0xff, 0xa2, 0xad, 0x2e, 
+  0xff, 0x01, 0xad, 0x2e, 0x93, 0xad, 0x2e, 0x53, 0x8e, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0xf1, 0x66, 0xff, 0xff, 0xf7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0x78, 0xaf, 0xff, 0xac, 0x06, 
+  0xff, 0x8c, 0x26, 0xff, 0xa1, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x7b, 0x8d, 0x2e, 0x3b, 0x8f, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0xff, 0x56, 0x9f, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0x56, 
+  0x9f, 0xff, 0xac, 0x06, 0xff, 0xac, 0x26, 0xff, 0x8a, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0x8c, 0x1e, 0xff, 0xad, 0x26, 0xff, 0x92, 0xad, 0x2e, 0xff, 0x01, 0x8d, 0x2e, 0x64, 0xad, 0x2e, 
+  0x17, 0x8f, 0xad, 0x2e, 0xff, 0x02, 0xac, 0x26, 0xff, 0xce, 0x46, 0xff, 0x9b, 0xcf, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0x36, 0x9f, 0xff, 0xac, 0x06, 0xff, 0xac, 0x26, 0xff, 0x88, 0xad, 0x2e, 
+  0xff, 0x02, 0xad, 0x26, 0xff, 0xac, 0x06, 0xff, 0xf0, 0x4e, 0xff, 0x81, 0x8b, 0x06, 0xff, 0x00, 0xad, 0x26, 0xff, 0x90, 0xad, 0x2e, 0xff, 0x02, 0x8d, 0x2e, 0x48, 0xcd, 0x26, 0x07, 0xad, 0x2e, 
+  0xe8, 0x8f, 0xad, 0x2e, 0xff, 0x02, 0x8c, 0x0e, 0xff, 0xf2, 0x6e, 0xff, 0xde, 0xef, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0x57, 0xa7, 0xff, 0xac, 0x06, 0xff, 0x8c, 0x26, 0xff, 0x87, 0xad, 0x2e, 
+  0xff, 0x06, 0xad, 0x16, 0xff, 0x9a, 0xcf, 0xff, 0xde, 0xef, 0xff, 0x9b, 0xd7, 0xff, 0x13, 0x77, 0xff, 0x8c, 0x06, 0xff, 0x8c, 0x16, 0xff, 0x8f, 0xad, 0x2e, 0xff, 0x02, 0x8c, 0x2e, 0x1b, 0xad, 
+  0x2e, 0x07, 0xad, 0x2e, 0xb8, 0x8f, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x26, 0xff, 0x8c, 0x0e, 0xff, 0x34, 0x87, 0xff, 0xff, 0xf7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0x9a, 0xc7, 0xff, 0xce, 0x1e, 
+  0xff, 0x8c, 0x16, 0xff, 0x85, 0xad, 0x2e, 0xff, 0x01, 0x8b, 0x06, 0xff, 0x9a, 0xbf, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xbc, 0xd7, 0xff, 0xf1, 0x5e, 0xff, 0x8b, 0x06, 0xff, 0xac, 0x26, 0xff, 
+  0x8c, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x2e, 0xe7, 0xac, 0x2e, 0x08, 0xad, 0x2e, 0x04, 0xad, 0x2e, 0x88, 0x90, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x26, 0xff, 0x8c, 0x06, 0xff, 0x56, 0x97, 0xff, 0x89, 
+  0xff, 0xff, 0xff, 0x02, 0x34, 0x7f, 0xff, 0x8b, 0x06, 0xff, 0xad, 0x26, 0xff, 0x82, 0xad, 0x2e, 0xff, 0x01, 0x8b, 0x06, 0xff, 0x78, 0xa7, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0x9a, 0xc7, 0xff, 
+  0xcf, 0x36, 0xff, 0x8c, 0x16, 0xff, 0x8b, 0xad, 0x2e, 0xff, 0x03, 0x8d, 0x26, 0xb0, 0x8d, 0x26, 0x04, 0x00, 0x00, 0x00, 0x8d, 0x26, 0x4f, 0x92, 0xad, 0x2e, 0xff, 0x01, 0x8b, 0x06, 0xff, 0x78, 
+  0xaf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x05, 0xbb, 0xcf, 0xff, 0xd0, 0x4e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x8c, 0x0e, 0xff, 0x35, 0x8f, 0xff, 0x89, 0xff, 0xff, 0xff, 0x03, 0x78, 0xaf, 
+  0xff, 0xcf, 0x3e, 0xff, 0xad, 0x2e, 0xff, 0xad, 0x26, 0xff, 0x88, 0xad, 0x2e, 0xff, 0x04, 0xad, 0x2e, 0x6b, 0xad, 0x2e, 0x03, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x1b, 0xad, 0x2e, 0xef, 0x92, 0xad, 
+  0x2e, 0xff, 0x01, 0x8a, 0x06, 0xff, 0x99, 0xbf, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0x79, 0xb7, 0xff, 0xf2, 0x76, 0xff, 0x35, 0x97, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xff, 0xf7, 0xff, 0x14, 
+  0x7f, 0xff, 0x8c, 0x0e, 0xff, 0x88, 0xad, 0x2e, 0xff, 0x00, 0x8d, 0x26, 0x23, 0x81, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x26, 0x0f, 0xad, 0x26, 0xa0, 0x93, 0xad, 0x2e, 0xff, 0x01, 0x8b, 0x06, 0xff, 
+  0x78, 0xaf, 0xff, 0x99, 0xff, 0xff, 0xff, 0x02, 0xbb, 0xd7, 0xff, 0xad, 0x06, 0xff, 0xad, 0x26, 0xff, 0x86, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xb4, 0xad, 0x2e, 0x10, 0x82, 0x00, 0x00, 0x00, 
+  0x00, 0xad, 0x2e, 0x57, 0x94, 0xad, 0x2e, 0xff, 0x02, 0x8c, 0x06, 0xff, 0x57, 0xa7, 0xff, 0xfe, 0xf7, 0xff, 0x97, 0xff, 0xff, 0xff, 0x02, 0x9b, 0xd7, 0xff, 0xac, 0x06, 0xff, 0xad, 0x26, 0xff, 
+  0x86, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0x68, 0x8d, 0x26, 0x03, 0x82, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x23, 0xad, 0x2e, 0xcc, 0x93, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x26, 0xff, 0xac, 0x0e, 
+  0xff, 0x14, 0x87, 0xff, 0xdd, 0xe7, 0xff, 0x96, 0xff, 0xff, 0xff, 0x01, 0x79, 0xbf, 0xff, 0x8b, 0x06, 0xff, 0x86, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xe4, 0xad, 0x26, 0x30, 0x84, 0x00, 0x00, 
+  0x00, 0x00, 0xad, 0x2e, 0x78, 0x94, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x26, 0xff, 0xac, 0x0e, 0xff, 0xf1, 0x66, 0xff, 0x99, 0xbf, 0xff, 0x94, 0xff, 0xff, 0xff, 0x02, 0xff, 0xf7, 0xff, 0x35, 0x8f, 
+  0xff, 0x8b, 0x06, 0xff, 0x86, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0x8b, 0xac, 0x2e, 0x07, 0x84, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x34, 0xad, 0x2e, 0xd7, 0x95, 0xad, 0x2e, 0xff, 0x03, 0xac, 
+  0x1e, 0xff, 0xae, 0x3e, 0xff, 0x13, 0x77, 0xff, 0xdd, 0xdf, 0xff, 0x92, 0xff, 0xff, 0xff, 0x02, 0xdd, 0xef, 0xff, 0xce, 0x26, 0xff, 0x8c, 0x26, 0xff, 0x85, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 
+  0xdc, 0xad, 0x2e, 0x3b, 0x86, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0xfc, 0x95, 0xad, 0x2e, 0xff, 0x81, 0xad, 0x26, 0xff, 0x02, 0xad, 0x36, 0xff, 0x35, 0x8f, 0xff, 0xff, 0xf7, 
+  0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0x34, 0x87, 0xff, 0x8c, 0x06, 0xff, 0x86, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x2e, 0x97, 0x87, 0x00, 0x00, 0x00, 0x01, 0xad, 0x26, 0x14, 0xad, 0x2e, 0xc8, 0x98, 
+  0xad, 0x2e, 0xff, 0x03, 0x8c, 0x26, 0xff, 0xad, 0x16, 0xff, 0x35, 0x8f, 0xff, 0xdd, 0xe7, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x34, 0x87, 0xff, 0x8b, 0x06, 0xff, 0x86, 0xad, 0x2e, 0xff, 0x01, 
+  0xad, 0x2e, 0xd8, 0x8d, 0x2e, 0x33, 0x88, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x5b, 0xad, 0x2e, 0xf0, 0x98, 0xad, 0x2e, 0xff, 0x05, 0xad, 0x26, 0xff, 0x8c, 0x0e, 0xff, 0x8c, 0x06, 0xff, 0x12, 
+  0x67, 0xff, 0x9a, 0xc7, 0xff, 0xde, 0xf7, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xbc, 0xd7, 0xff, 0xf0, 0x3e, 0xff, 0x8b, 0x06, 0xff, 0x86, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xf4, 0xad, 0x2e, 
+  0x70, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0xcf, 0x9a, 0xad, 0x2e, 0xff, 0x06, 0xad, 0x26, 0xff, 0x8c, 0x16, 0xff, 0x8a, 0x06, 0xff, 0xad, 0x06, 0xff, 0x35, 0x8f, 0xff, 0xbc, 0xdf, 0xff, 
+  0xdd, 0xe7, 0xff, 0x82, 0xde, 0xef, 0xff, 0x04, 0xbd, 0xe7, 0xff, 0x9a, 0xcf, 0xff, 0x12, 0x6f, 0xff, 0x8b, 0x06, 0xff, 0x8c, 0x1e, 0xff, 0x87, 0xad, 0x2e, 0xff, 0x00, 0xad, 0x2e, 0xab, 0x8b, 
+  0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0xd0, 0x9d, 0xad, 0x2e, 0xff, 0x0a, 0x8c, 0x26, 0xff, 0x8b, 0x06, 0xff, 0x8a, 0x06, 0xff, 0xcf, 0x2e, 0xff, 0xf2, 0x66, 0xff, 0x12, 0x6f, 0xff, 0xf1, 0x56, 
+  0xff, 0xad, 0x06, 0xff, 0x8a, 0x06, 0xff, 0x8c, 0x0e, 0xff, 0xad, 0x26, 0xff, 0x87, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xd7, 0x8c, 0x26, 0x18, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xad, 0x26, 0x3f, 
+  0xad, 0x2e, 0xec, 0x9f, 0xad, 0x2e, 0xff, 0x05, 0xad, 0x26, 0xff, 0x8c, 0x26, 0xff, 0x8c, 0x16, 0xff, 0x8c, 0x0e, 0xff, 0x8c, 0x16, 0xff, 0xac, 0x26, 0xff, 0x89, 0xad, 0x2e, 0xff, 0x01, 0xad, 
+  0x2e, 0xe4, 0xad, 0x2e, 0x3b, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x8f, 0xad, 0x2e, 0xfb, 0xae, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xec, 0xad, 0x26, 0x3c, 0x8b, 0x00, 0x00, 0x00, 0x01, 
+  0x6c, 0x26, 0x0b, 0xad, 0x2e, 0xc4, 0xae, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x26, 0xf4, 0xad, 0x2e, 0x40, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x2e, 0x47, 0xad, 0x2e, 0xe3, 0xad, 0xad, 0x2e, 0xff, 
+  0x01, 0xad, 0x2e, 0xec, 0xad, 0x2e, 0x4b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0xad, 0x2e, 0x84, 0xad, 0xad, 0x2e, 0xff, 0x01, 0xad, 0x2e, 0xdb, 0xad, 0x2e, 0x3c, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x8d, 
+  0x26, 0x14, 0xad, 0x2e, 0xb7, 0xab, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xf8, 0xad, 0x2e, 0xbf, 0xac, 0x2e, 0x2b, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x2e, 0x43, 0xad, 0x2e, 0xe4, 0x86, 0xad, 
+  0x2e, 0xff, 0x03, 0xad, 0x2e, 0xe4, 0xad, 0x2e, 0xc8, 0xad, 0x2e, 0xa8, 0xad, 0x2e, 0xd7, 0x9f, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0x80, 0x6b, 0x27, 0x03, 0x8f, 0x00, 0x00, 
+  0x00, 0x00, 0xad, 0x2e, 0x74, 0x84, 0xad, 0x2e, 0xff, 0x08, 0xad, 0x2e, 0xe3, 0xad, 0x2e, 0xb7, 0xad, 0x2e, 0x87, 0xad, 0x26, 0x4b, 0xad, 0x26, 0x0b, 0x00, 0x00, 0x00, 0x8d, 0x2e, 0x2c, 0xad, 
+  0x2e, 0x94, 0xad, 0x2e, 0xdb, 0x9b, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xe4, 0xad, 0x2e, 0x9c, 0x8d, 0x26, 0x3b, 0x90, 0x00, 0x00, 0x00, 0x01, 0xad, 0x2e, 0x18, 0xad, 0x2e, 0xb4, 0x81, 0xad, 
+  0x2e, 0xff, 0x04, 0xad, 0x2e, 0xe3, 0xad, 0x2e, 0xa8, 0xad, 0x2e, 0x6f, 0xad, 0x2e, 0x40, 0xad, 0x26, 0x14, 0x85, 0x00, 0x00, 0x00, 0x02, 0x8d, 0x2e, 0x38, 0xad, 0x2e, 0x83, 0xad, 0x2e, 0xdc, 
+  0x97, 0xad, 0x2e, 0xff, 0x02, 0xad, 0x2e, 0xe8, 0xad, 0x2e, 0x98, 0xad, 0x2e, 0x47, 0x92, 0x00, 0x00, 0x00, 0x05, 0xad, 0x2e, 0x38, 0xad, 0x2e, 0xdc, 0xad, 0x2e, 0xa3, 0xad, 0x2e, 0x58, 0xad, 
+  0x2e, 0x30, 0xad, 0x2e, 0x14, 0x89, 0x00, 0x00, 0x00, 0x03, 0xec, 0x2e, 0x03, 0xad, 0x26, 0x2c, 0x8d, 0x26, 0x6b, 0xad, 0x2e, 0xb7, 0x93, 0xad, 0x2e, 0xff, 0x03, 0xad, 0x26, 0xcc, 0x8d, 0x2e, 
+  0x70, 0xad, 0x26, 0x33, 0xad, 0x26, 0x0b, 0x93, 0x00, 0x00, 0x00, 0x02, 0xac, 0x26, 0x0b, 0x8d, 0x26, 0x1f, 0xad, 0x2e, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x05, 0x8d, 0x26, 0x04, 0xad, 0x2e, 0x13, 
+  0xad, 0x2e, 0x23, 0x8d, 0x2e, 0x64, 0x8d, 0x26, 0xb4, 0xad, 0x2e, 0xec, 0x8b, 0xad, 0x2e, 0xff, 0x05, 0xad, 0x2e, 0xf4, 0xad, 0x2e, 0xbf, 0x8d, 0x2e, 0x73, 0xad, 0x2e, 0x2c, 0xad, 0x26, 0x14, 
+  0x8d, 0x26, 0x04, 0xaa, 0x00, 0x00, 0x00, 0x11, 0x8d, 0x2e, 0x03, 0x8d, 0x26, 0x07, 0x8d, 0x2e, 0x08, 0xad, 0x2e, 0x17, 0xad, 0x2e, 0x47, 0xad, 0x26, 0x70, 0xad, 0x2e, 0x84, 0xad, 0x2e, 0x93, 
+  0x8d, 0x2e, 0xa3, 0xad, 0x2e, 0xac, 0xad, 0x2e, 0x9f, 0xad, 0x26, 0x8b, 0x8d, 0x26, 0x74, 0x8c, 0x2e, 0x54, 0xad, 0x2e, 0x23, 0xad, 0x2e, 0x0b, 0xad, 0x2e, 0x07, 0x8d, 0x2e, 0x03, 0x96, 0x00, 
+  0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x09, 0x00, 0x2f, 0x2c, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x00, 0x1e, 0xac, 0x00, 0x26, 0x8d, 0x03, 0x2e, 0xad, 0x07, 0x26, 0xad, 0x07, 0x26, 0xcd, 0x17, 0x26, 0xac, 0x33, 0x26, 0xad, 0x44, 0x26, 0xad, 0x53, 0x26, 0xad, 0x60, 0x2e, 0xad, 0x6c, 0x26, 0x8d, 0x5c, 0x2e, 0x8d, 0x43, 0x26, 0xad, 0x28, 0x26, 0xcd, 0x13, 0x26, 0xad, 0x08, 0x2e, 0xad, 0x07, 0x2e, 0xad, 0x03, 0x26, 0x8c, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xad, 0x00, 0x26, 0x8d, 0x00, 0x25, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x2e, 0x4e, 0x00, 0x2e, 0xac, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0x6d, 0x00, 0x2e, 0x8d, 0x08, 0x2e, 0xad, 0x18, 0x26, 0xad, 0x37, 0x26, 0x8d, 0x7b, 0x2e, 0xad, 0xbc, 0x2e, 0xad, 0xeb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xf0, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0x77, 0x2e, 0x8d, 0x3b, 0x2e, 0xad, 0x1b, 0x2e, 0xad, 0x0b, 0x2e, 0xac, 0x00, 0x26, 0xad, 0x00, 0x2e, 0x8d, 0x00, 0x07, 0x27, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x8c, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x18, 0x2e, 0xad, 0x3f, 0x2e, 0xad, 0x88, 0x2e, 0xad, 0xe0, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xeb, 0x2e, 0xad, 0x90, 0x2e, 0xad, 0x47, 0x26, 0xad, 0x1f, 0x07, 0x49, 0x00, 0x26, 0xad, 0x00, 0x1e, 0x0c, 0x00, 0x04, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xac, 0x00, 0x2e, 0xac, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0x8c, 0x18, 0x2e, 0x8d, 0x68, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xc0, 0x2e, 0xad, 0x73, 0x26, 0xad, 0x28, 0x2e, 0xcd, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x4b, 0x00, 0x2f, 0x0d, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xac, 0x07, 0x2e, 0x8d, 0x67, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xcc, 0x2e, 0xad, 0x7f, 0x2e, 0xcd, 0x10, 0x2e, 0xad, 0x00, 0x00, 0x0d, 0x00, 0x26, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8d, 0x00, 0x05, 0x6c, 0x00, 0x2e, 0xcd, 0x00, 0x2e, 0xad, 0x40, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0xf3, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xfc, 0x2e, 0xad, 0xc7, 0x2e, 0xad, 0x53, 0x2e, 0xcd, 0x00, 0x2e, 0x6d, 0x00, 0x2e, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xac, 0x00, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0xe4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xec, 0x2e, 0xad, 0x88, 0x07, 0xae, 0x00, 0x2e, 0xad, 0x00, 0x26, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xcd, 0x0b, 0x2e, 0x8d, 0x97, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xa3, 0x26, 0xcd, 0x10, 0x26, 0xad, 0x00, 0x2e, 0x6d, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x6d, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x1f, 0x2e, 0xad, 0xb8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0x23, 0x26, 0x6d, 0x00, 0x17, 0x0a, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0x8d, 0x00, 0x26, 0xad, 0x24, 0x2e, 0xad, 0xc0, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xdb, 0x2e, 0x8d, 0x2f, 0x26, 0x6d, 0x00, 0x2e, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8d, 0x00, 0x26, 0x8d, 0x00, 0x2e, 0xad, 0x20, 0x2e, 0xad, 0xc7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8d, 0xd4, 0x26, 0xad, 0x24, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x00, 0x26, 0x8d, 0x13, 0x2e, 0xad, 0xbb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xc3, 0x2e, 0x8d, 0x1b, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xab, 0x00, 0x2e, 0x8c, 0x00, 0x07, 0xcf, 0x00, 0x2e, 0xad, 0xa8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x06, 0x8a, 0xff, 0x06, 0x8a, 0xff, 0x06, 0x8a, 0xff, 0x06, 0x8b, 0xff, 0x1e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xb8, 0x2e, 0x8c, 0x0f, 0x2e, 0xad, 0x00, 0x26, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8e, 0x00, 0x26, 0x8d, 0x00, 0x2e, 0xad, 0x80, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x4e, 0xf0, 0xff, 0xc7, 0x79, 0xff, 0xdf, 0xbc, 0xff, 0xcf, 0x9a, 0xff, 0xb7, 0x79, 0xff, 0x4e, 0xf0, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x9b, 0x2e, 0x6c, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xad, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x47, 0x2e, 0xad, 0xe8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x67, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xde, 0xff, 0x3e, 0xae, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xec, 0x2e, 0xad, 0x50, 0x2e, 0xad, 0x00, 0x26, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x00, 0x26, 0xad, 0x00, 0x26, 0xcc, 0x07, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x5e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x56, 0xff, 0x26, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xc8, 0x26, 0xad, 0x14, 0x26, 0xad, 0x00, 0x36, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x27, 0x0b, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0xf4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x2e, 0xce, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xdd, 0xff, 0x0e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x88, 0x1e, 0xae, 0x00, 0x2e, 0x8c, 0x00, 0x09, 0xe3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2e, 0x4e, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x20, 0x2e, 0xad, 0xc4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xcf, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xf1, 0xff, 0x26, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xdb, 0x2e, 0xad, 0x38, 0x26, 0xad, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x26, 0xcc, 0x00, 0x2e, 0x6d, 0x00, 0x2e, 0xad, 0x67, 0x2e, 0xad, 0xfc, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x16, 0x8c, 0xff, 0x56, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9a, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x7f, 0x36, 0x8a, 0x03, 0x2e, 0x8c, 0x00, 0x09, 0xa4, 0x00, 
-  0x25, 0x8b, 0x00, 0x2e, 0xad, 0x00, 0x26, 0xad, 0x1b, 0x2e, 0xad, 0xb8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8a, 0xff, 0xbf, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0xad, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xd8, 0x2e, 0x8d, 0x28, 0x26, 0xac, 0x00, 0x06, 0xc7, 0x00, 
-  0x2e, 0x6d, 0x00, 0x26, 0xcc, 0x00, 0x2e, 0x8d, 0x47, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xe7, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x35, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x60, 0x2e, 0x8d, 0x03, 0x2e, 0x8d, 0x00, 
-  0x2e, 0xad, 0x00, 0x2e, 0xad, 0x0b, 0x2e, 0xad, 0x8b, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x1e, 0xce, 0xff, 0xe7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbd, 0xff, 0x06, 0x8a, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xaf, 0x2e, 0xad, 0x10, 0x26, 0xad, 0x00, 
-  0x2e, 0xad, 0x00, 0x2e, 0xad, 0x18, 0x2e, 0xad, 0xe0, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x46, 0xd0, 0xff, 0xef, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x56, 0xf1, 0xff, 0x16, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0x23, 0x2e, 0x4d, 0x00, 
-  0x2e, 0x6d, 0x00, 0x2e, 0x8d, 0x3b, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x3e, 0xcf, 0xff, 0xe7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x35, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0x8d, 0x64, 0x2e, 0x8d, 0x03, 
-  0x2e, 0x8d, 0x03, 0x2e, 0x8d, 0x7b, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x1e, 0xce, 0xff, 0xe7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0x3e, 0xcf, 0xff, 0x1e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x9c, 0x2e, 0xad, 0x04, 
-  0x26, 0x8d, 0x07, 0x26, 0x8d, 0xbc, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x06, 0x8a, 0xff, 0xdf, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x57, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xd3, 0x2e, 0xad, 0x07, 
-  0x26, 0xad, 0x08, 0x2e, 0xad, 0xf3, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xaf, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x9a, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x0f, 
-  0x26, 0xcd, 0x14, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x4e, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x9a, 0xff, 0x06, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x37, 
-  0x2e, 0x8d, 0x3c, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xdf, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x36, 0xae, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x63, 
-  0x26, 0xad, 0x57, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8c, 0xff, 0x77, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0xcf, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0x7c, 
-  0x2e, 0xad, 0x63, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x06, 0x8c, 0xff, 0xd7, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x9a, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x94, 
-  0x2e, 0xad, 0x70, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x4e, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x13, 0xff, 0x1e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x98, 
-  0x26, 0xad, 0x74, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0xa7, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x1e, 0xae, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x9b, 
-  0x2e, 0x8d, 0x64, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0xdf, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xbb, 0xff, 0x0e, 0xad, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x93, 
-  0x2e, 0xad, 0x53, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x66, 0xf1, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x78, 0xff, 0x06, 0xac, 0xff, 0x26, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x7b, 
-  0x2e, 0x8d, 0x3b, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x9f, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x56, 0xff, 0x06, 0xac, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0x8d, 0x64, 
-  0x2e, 0xad, 0x17, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xac, 0xff, 0x46, 0xce, 0xff, 0xcf, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x36, 0xff, 0x06, 0xac, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x06, 0xac, 0xff, 0x4e, 0xf0, 0xff, 0x06, 0x8b, 0xff, 0x06, 0x8b, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0x8d, 0x48, 
-  0x26, 0xcd, 0x07, 0x2e, 0xad, 0xe8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x0e, 0x8c, 0xff, 0x6e, 0xf2, 0xff, 0xef, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x57, 0xff, 0x06, 0xac, 0xff, 0x26, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x16, 0xad, 0xff, 0xcf, 0x9a, 0xff, 0xef, 0xde, 0xff, 0xd7, 0x9b, 0xff, 0x77, 0x13, 0xff, 0x06, 0x8c, 0xff, 0x16, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0x8c, 0x1b, 
-  0x2e, 0xad, 0x07, 0x2e, 0xad, 0xb8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x0e, 0x8c, 0xff, 0x87, 0x34, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x9a, 0xff, 0x1e, 0xce, 0xff, 0x16, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xbf, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbc, 0xff, 0x5e, 0xf1, 0xff, 0x06, 0x8b, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe7, 0x2e, 0xac, 0x08, 
-  0x2e, 0xad, 0x04, 0x2e, 0xad, 0x88, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x06, 0x8c, 0xff, 0x97, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x34, 0xff, 0x06, 0x8b, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xa7, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x9a, 0xff, 0x36, 0xcf, 0xff, 0x16, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8d, 0xb0, 0x26, 0x8d, 0x04, 
-  0x26, 0x8c, 0x00, 0x26, 0x8d, 0x4f, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xaf, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xbb, 0xff, 0x4e, 0xd0, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x0e, 0x8c, 0xff, 0x8f, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x78, 0xff, 0x3e, 0xcf, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x6b, 0x2e, 0xad, 0x03, 
-  0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x1b, 0x2e, 0xad, 0xef, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8a, 0xff, 0xbf, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x79, 0xff, 0x76, 0xf2, 0xff, 0x97, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x7f, 0x14, 0xff, 0x0e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8d, 0x23, 0x37, 0x0b, 0x00, 
-  0x26, 0xad, 0x00, 0x26, 0x8d, 0x0f, 0x26, 0xad, 0xa0, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xaf, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbb, 0xff, 0x06, 0xad, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0x10, 0x26, 0xad, 0x00, 
-  0x26, 0x8c, 0x00, 0x1e, 0x4a, 0x00, 0x2e, 0xad, 0x57, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x06, 0x8c, 0xff, 0xa7, 0x57, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x9b, 0xff, 0x06, 0xac, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0x68, 0x26, 0x8d, 0x03, 0x26, 0xad, 0x00, 
-  0x2e, 0x4d, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x23, 0x2e, 0xad, 0xcc, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x0e, 0xac, 0xff, 0x87, 0x14, 0xff, 0xe7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x79, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe4, 0x26, 0xad, 0x30, 0x2e, 0x8d, 0x00, 0x18, 0x09, 0x00, 
-  0x01, 0x00, 0x00, 0x2e, 0xad, 0x00, 0x27, 0x0f, 0x00, 0x2e, 0xad, 0x78, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x0e, 0xac, 0xff, 0x66, 0xf1, 0xff, 0xbf, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0x8f, 0x35, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x8b, 0x2e, 0xac, 0x07, 0x2e, 0xad, 0x00, 0x0a, 0xa4, 0x00, 
-  0x00, 0x00, 0x00, 0x2d, 0x67, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x34, 0x2e, 0xad, 0xd7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x1e, 0xac, 0xff, 0x3e, 0xae, 0xff, 0x77, 0x13, 0xff, 0xdf, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdd, 0xff, 0x26, 0xce, 0xff, 0x26, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0x3b, 0x26, 0xad, 0x00, 0x3e, 0xcb, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xa2, 0x00, 0x2e, 0xab, 0x00, 0x26, 0x8d, 0x00, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0xfc, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x26, 0xad, 0xff, 0x36, 0xad, 0xff, 0x8f, 0x35, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x34, 0xff, 0x06, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0x97, 0x36, 0xac, 0x00, 0x26, 0x8d, 0x00, 0x0a, 0x84, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xab, 0x00, 0x26, 0xad, 0x00, 0x26, 0xad, 0x14, 0x2e, 0xad, 0xc8, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x16, 0xad, 0xff, 0x8f, 0x35, 0xff, 0xe7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x34, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xd8, 0x2e, 0x8d, 0x33, 0x2e, 0x8d, 0x00, 0x26, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xad, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xad, 0x5b, 0x2e, 0xad, 0xf0, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x0e, 0x8c, 0xff, 0x06, 0x8c, 0xff, 0x67, 0x12, 0xff, 0xc7, 0x9a, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbc, 0xff, 0x3e, 0xf0, 0xff, 0x06, 0x8b, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xf4, 0x2e, 0xad, 0x70, 0x2e, 0x8c, 0x00, 0x36, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xab, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0xcf, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x16, 0x8c, 0xff, 0x06, 0x8a, 0xff, 0x06, 0xad, 0xff, 0x8f, 0x35, 0xff, 0xdf, 0xbc, 0xff, 0xe7, 0xdd, 0xff, 0xef, 0xde, 0xff, 0xef, 0xde, 0xff, 0xef, 0xde, 0xff, 0xe7, 0xbd, 0xff, 0xcf, 0x9a, 0xff, 0x6f, 0x12, 0xff, 0x06, 0x8b, 0xff, 0x1e, 0x8c, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xab, 0x2e, 0x6c, 0x00, 0x1e, 0xed, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xcd, 0x00, 0x26, 0x0c, 0x00, 0x2e, 0xad, 0xd0, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x06, 0x8b, 0xff, 0x06, 0x8a, 0xff, 0x2e, 0xcf, 0xff, 0x66, 0xf2, 0xff, 0x6f, 0x12, 0xff, 0x56, 0xf1, 0xff, 0x06, 0xad, 0xff, 0x06, 0x8a, 0xff, 0x0e, 0x8c, 0xff, 0x26, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xd7, 0x26, 0x8c, 0x18, 0x26, 0xad, 0x00, 0x26, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x26, 0xad, 0x00, 0x26, 0xad, 0x3f, 0x2e, 0xad, 0xec, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x16, 0x8c, 0xff, 0x0e, 0x8c, 0xff, 0x16, 0x8c, 0xff, 0x26, 0xac, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe4, 0x2e, 0xad, 0x3b, 0x2e, 0x8d, 0x00, 0x2e, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x8f, 0x2e, 0xad, 0xfb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xec, 0x26, 0xad, 0x3c, 0x26, 0xad, 0x00, 0x26, 0x8e, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8c, 0x00, 0x26, 0x6c, 0x0b, 0x2e, 0xad, 0xc4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xf4, 0x2e, 0xad, 0x40, 0x33, 0x51, 0x00, 0x3e, 0x8c, 0x00, 0x36, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xcb, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x47, 0x2e, 0xad, 0xe3, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xec, 0x2e, 0xad, 0x4b, 0x2e, 0xee, 0x00, 0x2e, 0xcd, 0x00, 0x0a, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x4f, 0x00, 0x2e, 0x8c, 0x00, 0x2e, 0xad, 0x84, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xdb, 0x2e, 0xad, 0x3c, 0x2e, 0x8c, 0x00, 0x2e, 0xee, 0x00, 0x13, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0xe5, 0x00, 0x26, 0x8d, 0x00, 0x26, 0x8d, 0x14, 0x2e, 0xad, 0xb7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xbf, 0x2e, 0xac, 0x2b, 0x2e, 0x8d, 0x00, 0x2e, 0x2d, 0x00, 0x26, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x35, 0xeb, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0x8d, 0x43, 0x2e, 0xad, 0xe4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe4, 0x2e, 0xad, 0xc8, 0x2e, 0xad, 0xa8, 0x2e, 0xad, 0xd7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0x80, 0x27, 0x6b, 0x03, 0x2e, 0xad, 0x00, 0x2e, 0x8d, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2e, 0xcd, 0x00, 0x26, 0x0a, 0x00, 0x2e, 0xad, 0x74, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe3, 0x2e, 0xad, 0xb7, 0x2e, 0xad, 0x87, 0x26, 0xad, 0x4b, 0x26, 0xad, 0x0b, 0x2e, 0x8c, 0x00, 0x2e, 0x8d, 0x2c, 0x2e, 0xad, 0x94, 0x2e, 0xad, 0xdb, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe4, 0x2e, 0xad, 0x9c, 0x26, 0x8d, 0x3b, 0x26, 0x8d, 0x00, 0x2e, 0xac, 0x00, 0x2e, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0xa0, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xad, 0x18, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe3, 0x2e, 0xad, 0xa8, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0x40, 0x26, 0xad, 0x14, 0x26, 0x8d, 0x00, 0x2e, 0xad, 0x00, 0x26, 0xad, 0x00, 0x3c, 0xe8, 0x00, 0x2e, 0x8d, 0x00, 0x36, 0xee, 0x00, 0x2e, 0x8d, 0x38, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xe8, 0x2e, 0xad, 0x98, 0x2e, 0xad, 0x47, 0xff, 0xff, 0x00, 0x26, 0x8d, 0x00, 0x0e, 0x50, 0x00, 0x2e, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x38, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0xa3, 0x2e, 0xad, 0x58, 0x2e, 0xad, 0x30, 0x2e, 0xad, 0x14, 0x2e, 0x6c, 0x00, 0x2e, 0xad, 0x00, 0x26, 0xad, 0x00, 0x2f, 0x0d, 0x00, 0x2e, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8c, 0x00, 0x26, 0x8c, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xec, 0x03, 0x26, 0xad, 0x2c, 0x26, 0x8d, 0x6b, 0x2e, 0xad, 0xb7, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xcc, 0x2e, 0x8d, 0x70, 0x26, 0xad, 0x33, 0x26, 0xad, 0x0b, 0x2e, 0x8d, 0x00, 0x26, 0xad, 0x00, 0x26, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x35, 0x6f, 0x00, 0x26, 0xac, 0x0b, 0x26, 0x8d, 0x1f, 0x2e, 0xad, 0x0f, 0x07, 0xe0, 0x00, 0x2e, 0x8d, 0x00, 0x2e, 0xad, 0x00, 0x26, 0xee, 0x00, 0x26, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x00, 0x37, 0x69, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0xad, 0x00, 0x26, 0x8d, 0x04, 0x2e, 0xad, 0x13, 0x2e, 0xad, 0x23, 0x2e, 0x8d, 0x64, 0x26, 0x8d, 0xb4, 0x2e, 0xad, 0xec, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xff, 0x2e, 0xad, 0xf4, 0x2e, 0xad, 0xbf, 0x2e, 0x8d, 0x73, 0x2e, 0xad, 0x2c, 0x26, 0xad, 0x14, 0x26, 0x8d, 0x04, 0x2e, 0xad, 0x00, 0x26, 0xad, 0x00, 0x26, 0xac, 0x00, 0x13, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1f, 0xa9, 0x00, 0x46, 0x72, 0x00, 0x2e, 0xed, 0x00, 0x26, 0x8d, 0x00, 0x26, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc5, 0x00, 0x21, 0xa0, 0x00, 0x26, 0x8d, 0x00, 0x2e, 0xad, 0x00, 0x2e, 0x6c, 0x00, 0x2e, 0x8d, 0x03, 0x26, 0x8d, 0x07, 0x2e, 0x8d, 0x08, 0x2e, 0xad, 0x17, 0x2e, 0xad, 0x47, 0x26, 0xad, 0x70, 0x2e, 0xad, 0x84, 0x2e, 0xad, 0x93, 0x2e, 0x8d, 0xa3, 0x2e, 0xad, 0xac, 0x2e, 0xad, 0x9f, 0x26, 0xad, 0x8b, 0x26, 0x8d, 0x74, 0x2e, 0x8c, 0x54, 0x2e, 0xad, 0x23, 0x2e, 0xad, 0x0b, 0x2e, 0xad, 0x07, 0x2e, 0x8d, 0x03, 0x7f, 0xff, 0x00, 0x2e, 0xad, 0x00, 0x26, 0x8d, 0x00, 0x2c, 0x27, 0x00, 0x0a, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x8d, 0x03, 0x2e, 0xad, 0x07, 0x26, 0xad, 0x07, 0x26, 0xcd, 0x17, 0x26, 0xac, 0x33, 0x26, 0xad, 0x44, 0x26, 0xad, 0x53, 0x26, 0xad, 
+  0x60, 0x2e, 0xad, 0x6c, 0x26, 0x8d, 0x5c, 0x2e, 0x8d, 0x43, 0x26, 0xad, 0x28, 0x26, 0xcd, 0x13, 0x26, 0xad, 0x08, 0x2e, 0xad, 0x07, 0x2e, 0xad, 0x03, 0xac, 0x00, 0x00, 0x00, 0x05, 0x2e, 0x8d, 
+  0x08, 0x2e, 0xad, 0x18, 0x26, 0xad, 0x37, 0x26, 0x8d, 0x7b, 0x2e, 0xad, 0xbc, 0x2e, 0xad, 0xeb, 0x89, 0x2e, 0xad, 0xff, 0x05, 0x2e, 0xad, 0xf0, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0x77, 0x2e, 0x8d, 
+  0x3b, 0x2e, 0xad, 0x1b, 0x2e, 0xad, 0x0b, 0xa7, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x8d, 0x18, 0x2e, 0xad, 0x3f, 0x2e, 0xad, 0x88, 0x2e, 0xad, 0xe0, 0x91, 0x2e, 0xad, 0xff, 0x03, 0x2e, 0xad, 0xeb, 
+  0x2e, 0xad, 0x90, 0x2e, 0xad, 0x47, 0x26, 0xad, 0x1f, 0xa3, 0x00, 0x00, 0x00, 0x03, 0x2e, 0x8c, 0x18, 0x2e, 0x8d, 0x68, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0xfb, 0x96, 0x2e, 0xad, 0xff, 0x02, 0x2e, 
+  0xad, 0xc0, 0x2e, 0xad, 0x73, 0x26, 0xad, 0x28, 0x9f, 0x00, 0x00, 0x00, 0x02, 0x2e, 0xac, 0x07, 0x2e, 0x8d, 0x67, 0x2e, 0xad, 0xbf, 0x9b, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xcc, 0x2e, 0xad, 
+  0x7f, 0x2e, 0xcd, 0x10, 0x9c, 0x00, 0x00, 0x00, 0x02, 0x2e, 0xad, 0x40, 0x2e, 0xad, 0xbf, 0x2e, 0xad, 0xf3, 0x9d, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xfc, 0x2e, 0xad, 0xc7, 0x2e, 0xad, 0x53, 
+  0x9a, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0xe4, 0xa1, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xec, 0x2e, 0xad, 0x88, 0x97, 0x00, 0x00, 0x00, 0x02, 0x2e, 0xcd, 0x0b, 0x2e, 0x8d, 
+  0x97, 0x2e, 0xad, 0xfb, 0xa4, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xa3, 0x26, 0xcd, 0x10, 0x94, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x1f, 0x2e, 0xad, 0xb8, 0xa7, 0x2e, 0xad, 0xff, 0x01, 0x2e, 
+  0xad, 0xbf, 0x2e, 0xad, 0x23, 0x92, 0x00, 0x00, 0x00, 0x01, 0x26, 0xad, 0x24, 0x2e, 0xad, 0xc0, 0xa9, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xdb, 0x2e, 0x8d, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x01, 
+  0x2e, 0xad, 0x20, 0x2e, 0xad, 0xc7, 0xab, 0x2e, 0xad, 0xff, 0x01, 0x26, 0x8d, 0xd4, 0x26, 0xad, 0x24, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x26, 0x8d, 0x13, 0x2e, 0xad, 0xbb, 0xad, 0x2e, 0xad, 0xff, 
+  0x01, 0x2e, 0xad, 0xc3, 0x2e, 0x8d, 0x1b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0xa8, 0x88, 0x2e, 0xad, 0xff, 0x00, 0x1e, 0x8c, 0xff, 0x82, 0x06, 0x8a, 0xff, 0x01, 0x06, 0x8b, 0xff, 0x1e, 
+  0x8c, 0xff, 0xa0, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xb8, 0x2e, 0x8c, 0x0f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x80, 0x88, 0x2e, 0xad, 0xff, 0x07, 0x1e, 0x8c, 0xff, 0x4e, 0xf0, 0xff, 
+  0xc7, 0x79, 0xff, 0xdf, 0xbc, 0xff, 0xcf, 0x9a, 0xff, 0xb7, 0x79, 0xff, 0x4e, 0xf0, 0xff, 0x26, 0xad, 0xff, 0xa0, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0xad, 0x9b, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x2e, 
+  0x8d, 0x47, 0x2e, 0xad, 0xe8, 0x87, 0x2e, 0xad, 0xff, 0x01, 0x1e, 0x8c, 0xff, 0x67, 0x12, 0xff, 0x84, 0xff, 0xff, 0xff, 0x01, 0xef, 0xde, 0xff, 0x3e, 0xae, 0xff, 0xa0, 0x2e, 0xad, 0xff, 0x01, 
+  0x2e, 0xad, 0xec, 0x2e, 0xad, 0x50, 0x88, 0x00, 0x00, 0x00, 0x01, 0x26, 0xcc, 0x07, 0x2e, 0xad, 0xbf, 0x87, 0x2e, 0xad, 0xff, 0x01, 0x1e, 0x8c, 0xff, 0x5e, 0xf2, 0xff, 0x86, 0xff, 0xff, 0xff, 
+  0x01, 0x8f, 0x56, 0xff, 0x26, 0x8c, 0xff, 0xa0, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xc8, 0x26, 0xad, 0x14, 0x87, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0xf4, 0x86, 0x2e, 0xad, 
+  0xff, 0x02, 0x26, 0x8c, 0xff, 0x2e, 0xce, 0xff, 0xf7, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xe7, 0xdd, 0xff, 0x0e, 0x8c, 0xff, 0xa1, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0xad, 0x88, 0x86, 0x00, 
+  0x00, 0x00, 0x01, 0x2e, 0xad, 0x20, 0x2e, 0xad, 0xc4, 0x86, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xcf, 0x9b, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x56, 0xf1, 0xff, 0x26, 
+  0x8c, 0xff, 0xa0, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xdb, 0x2e, 0xad, 0x38, 0x85, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x67, 0x2e, 0xad, 0xfc, 0x86, 0x2e, 0xad, 0xff, 0x01, 0x16, 0x8c, 0xff, 
+  0x56, 0xf1, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xbf, 0x9a, 0xff, 0x06, 0x8b, 0xff, 0xa1, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x7f, 0x36, 0x8a, 0x03, 0x83, 0x00, 0x00, 0x00, 0x01, 0x26, 0xad, 
+  0x1b, 0x2e, 0xad, 0xb8, 0x87, 0x2e, 0xad, 0xff, 0x01, 0x06, 0x8a, 0xff, 0xbf, 0x79, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x06, 0xad, 0xff, 0x26, 0xac, 0xff, 0xa0, 0x2e, 0xad, 0xff, 0x01, 0x2e, 
+  0xad, 0xd8, 0x2e, 0x8d, 0x28, 0x83, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x8d, 0x47, 0x87, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x06, 0x8b, 0xff, 0xe7, 0xbc, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 
+  0x8f, 0x35, 0xff, 0x06, 0x8b, 0xff, 0xa1, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x60, 0x2e, 0x8d, 0x03, 0x81, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x0b, 0x2e, 0xad, 0x8b, 0x87, 0x2e, 0xad, 0xff, 
+  0x02, 0x26, 0x8c, 0xff, 0x1e, 0xce, 0xff, 0xe7, 0xdd, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xe7, 0xbd, 0xff, 0x06, 0x8a, 0xff, 0xa1, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xaf, 0x2e, 0xad, 0x10, 
+  0x81, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x18, 0x2e, 0xad, 0xe0, 0x87, 0x2e, 0xad, 0xff, 0x02, 0x1e, 0x8c, 0xff, 0x46, 0xd0, 0xff, 0xef, 0xdd, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xff, 
+  0xff, 0x56, 0xf1, 0xff, 0x16, 0x8c, 0xff, 0xa1, 0x2e, 0xad, 0xff, 0x00, 0x26, 0xad, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x8d, 0x3b, 0x88, 0x2e, 0xad, 0xff, 0x02, 0x1e, 0x8c, 0xff, 0x3e, 
+  0xcf, 0xff, 0xe7, 0xdd, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0x97, 0x35, 0xff, 0x06, 0x8b, 0xff, 0xa1, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0x8d, 0x64, 0x81, 0x2e, 0x8d, 0x03, 0x00, 0x2e, 0x8d, 0x7b, 
+  0x88, 0x2e, 0xad, 0xff, 0x02, 0x26, 0x8c, 0xff, 0x1e, 0xce, 0xff, 0xe7, 0xdd, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xfe, 0xff, 0x3e, 0xcf, 0xff, 0x1e, 0x8c, 0xff, 0xa1, 0x2e, 0xad, 0xff, 
+  0x03, 0x2e, 0xad, 0x9c, 0x2e, 0xad, 0x04, 0x26, 0x8d, 0x07, 0x26, 0x8d, 0xbc, 0x88, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x06, 0x8a, 0xff, 0xdf, 0xbc, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 
+  0xa7, 0x57, 0xff, 0x06, 0x8b, 0xff, 0xa2, 0x2e, 0xad, 0xff, 0x03, 0x2e, 0xad, 0xd3, 0x2e, 0xad, 0x07, 0x26, 0xad, 0x08, 0x2e, 0xad, 0xf3, 0x89, 0x2e, 0xad, 0xff, 0x01, 0x06, 0x8b, 0xff, 0xaf, 
+  0x78, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0xc7, 0x9a, 0xff, 0x06, 0x8b, 0xff, 0xa4, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x0f, 0x26, 0xcd, 0x14, 0x8a, 0x2e, 0xad, 0xff, 0x02, 0x1e, 0x8c, 0xff, 
+  0x4e, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xcf, 0x9a, 0xff, 0x06, 0xac, 0xff, 0xa5, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x37, 0x2e, 0x8d, 0x3c, 0x8b, 0x2e, 0xad, 0xff, 
+  0x01, 0x06, 0x8b, 0xff, 0xdf, 0xbc, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xff, 0x36, 0xae, 0xff, 0x26, 0xad, 0xff, 0xa5, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x63, 0x26, 0xad, 0x57, 
+  0x8b, 0x2e, 0xad, 0xff, 0x01, 0x06, 0x8c, 0xff, 0x77, 0x13, 0xff, 0x87, 0xff, 0xff, 0xff, 0x00, 0x46, 0xcf, 0xff, 0xa6, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0x7c, 0x2e, 0xad, 0x63, 0x8b, 0x2e, 
+  0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x06, 0x8c, 0xff, 0xd7, 0xbc, 0xff, 0x86, 0xff, 0xff, 0xff, 0x01, 0xc7, 0x9a, 0xff, 0x06, 0x8b, 0xff, 0xa5, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x94, 0x2e, 
+  0xad, 0x70, 0x8c, 0x2e, 0xad, 0xff, 0x01, 0x26, 0x8c, 0xff, 0x4e, 0xf0, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0x6f, 0x13, 0xff, 0x1e, 0x8c, 0xff, 0xa4, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x98, 
+  0x26, 0xad, 0x74, 0x8d, 0x2e, 0xad, 0xff, 0x01, 0x1e, 0x8c, 0xff, 0xa7, 0x77, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xff, 0x1e, 0xae, 0xff, 0x26, 0xac, 0xff, 0xa3, 0x2e, 0xad, 0xff, 
+  0x01, 0x2e, 0xad, 0x9b, 0x2e, 0x8d, 0x64, 0x8f, 0x2e, 0xad, 0xff, 0x00, 0xdf, 0xdc, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xcf, 0xbb, 0xff, 0x0e, 0xad, 0xff, 0x26, 0xac, 0xff, 0xa2, 0x2e, 0xad, 
+  0xff, 0x01, 0x2e, 0xad, 0x93, 0x2e, 0xad, 0x53, 0x8e, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x66, 0xf1, 0xff, 0xf7, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xaf, 0x78, 0xff, 0x06, 0xac, 
+  0xff, 0x26, 0x8c, 0xff, 0xa1, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x7b, 0x2e, 0x8d, 0x3b, 0x8f, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0xff, 0x9f, 0x56, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0x9f, 
+  0x56, 0xff, 0x06, 0xac, 0xff, 0x26, 0xac, 0xff, 0x8a, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x1e, 0x8c, 0xff, 0x26, 0xad, 0xff, 0x92, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0x8d, 0x64, 0x2e, 0xad, 
+  0x17, 0x8f, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xac, 0xff, 0x46, 0xce, 0xff, 0xcf, 0x9b, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0x9f, 0x36, 0xff, 0x06, 0xac, 0xff, 0x26, 0xac, 0xff, 0x88, 0x2e, 0xad, 
+  0xff, 0x02, 0x26, 0xad, 0xff, 0x06, 0xac, 0xff, 0x4e, 0xf0, 0xff, 0x81, 0x06, 0x8b, 0xff, 0x00, 0x26, 0xad, 0xff, 0x90, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0x8d, 0x48, 0x26, 0xcd, 0x07, 0x2e, 0xad, 
+  0xe8, 0x8f, 0x2e, 0xad, 0xff, 0x02, 0x0e, 0x8c, 0xff, 0x6e, 0xf2, 0xff, 0xef, 0xde, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0xa7, 0x57, 0xff, 0x06, 0xac, 0xff, 0x26, 0x8c, 0xff, 0x87, 0x2e, 0xad, 
+  0xff, 0x06, 0x16, 0xad, 0xff, 0xcf, 0x9a, 0xff, 0xef, 0xde, 0xff, 0xd7, 0x9b, 0xff, 0x77, 0x13, 0xff, 0x06, 0x8c, 0xff, 0x16, 0x8c, 0xff, 0x8f, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0x8c, 0x1b, 0x2e, 
+  0xad, 0x07, 0x2e, 0xad, 0xb8, 0x8f, 0x2e, 0xad, 0xff, 0x03, 0x26, 0xad, 0xff, 0x0e, 0x8c, 0xff, 0x87, 0x34, 0xff, 0xf7, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0xc7, 0x9a, 0xff, 0x1e, 0xce, 
+  0xff, 0x16, 0x8c, 0xff, 0x85, 0x2e, 0xad, 0xff, 0x01, 0x06, 0x8b, 0xff, 0xbf, 0x9a, 0xff, 0x83, 0xff, 0xff, 0xff, 0x03, 0xd7, 0xbc, 0xff, 0x5e, 0xf1, 0xff, 0x06, 0x8b, 0xff, 0x26, 0xac, 0xff, 
+  0x8c, 0x2e, 0xad, 0xff, 0x03, 0x2e, 0xad, 0xe7, 0x2e, 0xac, 0x08, 0x2e, 0xad, 0x04, 0x2e, 0xad, 0x88, 0x90, 0x2e, 0xad, 0xff, 0x02, 0x26, 0xad, 0xff, 0x06, 0x8c, 0xff, 0x97, 0x56, 0xff, 0x89, 
+  0xff, 0xff, 0xff, 0x02, 0x7f, 0x34, 0xff, 0x06, 0x8b, 0xff, 0x26, 0xad, 0xff, 0x82, 0x2e, 0xad, 0xff, 0x01, 0x06, 0x8b, 0xff, 0xa7, 0x78, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xc7, 0x9a, 0xff, 
+  0x36, 0xcf, 0xff, 0x16, 0x8c, 0xff, 0x8b, 0x2e, 0xad, 0xff, 0x03, 0x26, 0x8d, 0xb0, 0x26, 0x8d, 0x04, 0x00, 0x00, 0x00, 0x26, 0x8d, 0x4f, 0x92, 0x2e, 0xad, 0xff, 0x01, 0x06, 0x8b, 0xff, 0xaf, 
+  0x78, 0xff, 0x89, 0xff, 0xff, 0xff, 0x05, 0xcf, 0xbb, 0xff, 0x4e, 0xd0, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x0e, 0x8c, 0xff, 0x8f, 0x35, 0xff, 0x89, 0xff, 0xff, 0xff, 0x03, 0xaf, 0x78, 
+  0xff, 0x3e, 0xcf, 0xff, 0x2e, 0xad, 0xff, 0x26, 0xad, 0xff, 0x88, 0x2e, 0xad, 0xff, 0x04, 0x2e, 0xad, 0x6b, 0x2e, 0xad, 0x03, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x1b, 0x2e, 0xad, 0xef, 0x92, 0x2e, 
+  0xad, 0xff, 0x01, 0x06, 0x8a, 0xff, 0xbf, 0x99, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xb7, 0x79, 0xff, 0x76, 0xf2, 0xff, 0x97, 0x35, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xff, 0x7f, 
+  0x14, 0xff, 0x0e, 0x8c, 0xff, 0x88, 0x2e, 0xad, 0xff, 0x00, 0x26, 0x8d, 0x23, 0x81, 0x00, 0x00, 0x00, 0x01, 0x26, 0x8d, 0x0f, 0x26, 0xad, 0xa0, 0x93, 0x2e, 0xad, 0xff, 0x01, 0x06, 0x8b, 0xff, 
+  0xaf, 0x78, 0xff, 0x99, 0xff, 0xff, 0xff, 0x02, 0xd7, 0xbb, 0xff, 0x06, 0xad, 0xff, 0x26, 0xad, 0xff, 0x86, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xb4, 0x2e, 0xad, 0x10, 0x82, 0x00, 0x00, 0x00, 
+  0x00, 0x2e, 0xad, 0x57, 0x94, 0x2e, 0xad, 0xff, 0x02, 0x06, 0x8c, 0xff, 0xa7, 0x57, 0xff, 0xf7, 0xfe, 0xff, 0x97, 0xff, 0xff, 0xff, 0x02, 0xd7, 0x9b, 0xff, 0x06, 0xac, 0xff, 0x26, 0xad, 0xff, 
+  0x86, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0x68, 0x26, 0x8d, 0x03, 0x82, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x23, 0x2e, 0xad, 0xcc, 0x93, 0x2e, 0xad, 0xff, 0x03, 0x26, 0xad, 0xff, 0x0e, 0xac, 
+  0xff, 0x87, 0x14, 0xff, 0xe7, 0xdd, 0xff, 0x96, 0xff, 0xff, 0xff, 0x01, 0xbf, 0x79, 0xff, 0x06, 0x8b, 0xff, 0x86, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xe4, 0x26, 0xad, 0x30, 0x84, 0x00, 0x00, 
+  0x00, 0x00, 0x2e, 0xad, 0x78, 0x94, 0x2e, 0xad, 0xff, 0x03, 0x26, 0xad, 0xff, 0x0e, 0xac, 0xff, 0x66, 0xf1, 0xff, 0xbf, 0x99, 0xff, 0x94, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xff, 0xff, 0x8f, 0x35, 
+  0xff, 0x06, 0x8b, 0xff, 0x86, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0x8b, 0x2e, 0xac, 0x07, 0x84, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x34, 0x2e, 0xad, 0xd7, 0x95, 0x2e, 0xad, 0xff, 0x03, 0x1e, 
+  0xac, 0xff, 0x3e, 0xae, 0xff, 0x77, 0x13, 0xff, 0xdf, 0xdd, 0xff, 0x92, 0xff, 0xff, 0xff, 0x02, 0xef, 0xdd, 0xff, 0x26, 0xce, 0xff, 0x26, 0x8c, 0xff, 0x85, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 
+  0xdc, 0x2e, 0xad, 0x3b, 0x86, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0xfc, 0x95, 0x2e, 0xad, 0xff, 0x81, 0x26, 0xad, 0xff, 0x02, 0x36, 0xad, 0xff, 0x8f, 0x35, 0xff, 0xf7, 0xff, 
+  0xff, 0x90, 0xff, 0xff, 0xff, 0x01, 0x87, 0x34, 0xff, 0x06, 0x8c, 0xff, 0x86, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0xad, 0x97, 0x87, 0x00, 0x00, 0x00, 0x01, 0x26, 0xad, 0x14, 0x2e, 0xad, 0xc8, 0x98, 
+  0x2e, 0xad, 0xff, 0x03, 0x26, 0x8c, 0xff, 0x16, 0xad, 0xff, 0x8f, 0x35, 0xff, 0xe7, 0xdd, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x87, 0x34, 0xff, 0x06, 0x8b, 0xff, 0x86, 0x2e, 0xad, 0xff, 0x01, 
+  0x2e, 0xad, 0xd8, 0x2e, 0x8d, 0x33, 0x88, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x5b, 0x2e, 0xad, 0xf0, 0x98, 0x2e, 0xad, 0xff, 0x05, 0x26, 0xad, 0xff, 0x0e, 0x8c, 0xff, 0x06, 0x8c, 0xff, 0x67, 
+  0x12, 0xff, 0xc7, 0x9a, 0xff, 0xf7, 0xde, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xd7, 0xbc, 0xff, 0x3e, 0xf0, 0xff, 0x06, 0x8b, 0xff, 0x86, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xf4, 0x2e, 0xad, 
+  0x70, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0xcf, 0x9a, 0x2e, 0xad, 0xff, 0x06, 0x26, 0xad, 0xff, 0x16, 0x8c, 0xff, 0x06, 0x8a, 0xff, 0x06, 0xad, 0xff, 0x8f, 0x35, 0xff, 0xdf, 0xbc, 0xff, 
+  0xe7, 0xdd, 0xff, 0x82, 0xef, 0xde, 0xff, 0x04, 0xe7, 0xbd, 0xff, 0xcf, 0x9a, 0xff, 0x6f, 0x12, 0xff, 0x06, 0x8b, 0xff, 0x1e, 0x8c, 0xff, 0x87, 0x2e, 0xad, 0xff, 0x00, 0x2e, 0xad, 0xab, 0x8b, 
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0xd0, 0x9d, 0x2e, 0xad, 0xff, 0x0a, 0x26, 0x8c, 0xff, 0x06, 0x8b, 0xff, 0x06, 0x8a, 0xff, 0x2e, 0xcf, 0xff, 0x66, 0xf2, 0xff, 0x6f, 0x12, 0xff, 0x56, 0xf1, 
+  0xff, 0x06, 0xad, 0xff, 0x06, 0x8a, 0xff, 0x0e, 0x8c, 0xff, 0x26, 0xad, 0xff, 0x87, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xd7, 0x26, 0x8c, 0x18, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x26, 0xad, 0x3f, 
+  0x2e, 0xad, 0xec, 0x9f, 0x2e, 0xad, 0xff, 0x05, 0x26, 0xad, 0xff, 0x26, 0x8c, 0xff, 0x16, 0x8c, 0xff, 0x0e, 0x8c, 0xff, 0x16, 0x8c, 0xff, 0x26, 0xac, 0xff, 0x89, 0x2e, 0xad, 0xff, 0x01, 0x2e, 
+  0xad, 0xe4, 0x2e, 0xad, 0x3b, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x8f, 0x2e, 0xad, 0xfb, 0xae, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xec, 0x26, 0xad, 0x3c, 0x8b, 0x00, 0x00, 0x00, 0x01, 
+  0x26, 0x6c, 0x0b, 0x2e, 0xad, 0xc4, 0xae, 0x2e, 0xad, 0xff, 0x01, 0x26, 0xad, 0xf4, 0x2e, 0xad, 0x40, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x8d, 0x47, 0x2e, 0xad, 0xe3, 0xad, 0x2e, 0xad, 0xff, 
+  0x01, 0x2e, 0xad, 0xec, 0x2e, 0xad, 0x4b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xad, 0x84, 0xad, 0x2e, 0xad, 0xff, 0x01, 0x2e, 0xad, 0xdb, 0x2e, 0xad, 0x3c, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x26, 
+  0x8d, 0x14, 0x2e, 0xad, 0xb7, 0xab, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xf8, 0x2e, 0xad, 0xbf, 0x2e, 0xac, 0x2b, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x8d, 0x43, 0x2e, 0xad, 0xe4, 0x86, 0x2e, 
+  0xad, 0xff, 0x03, 0x2e, 0xad, 0xe4, 0x2e, 0xad, 0xc8, 0x2e, 0xad, 0xa8, 0x2e, 0xad, 0xd7, 0x9f, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0x80, 0x27, 0x6b, 0x03, 0x8f, 0x00, 0x00, 
+  0x00, 0x00, 0x2e, 0xad, 0x74, 0x84, 0x2e, 0xad, 0xff, 0x08, 0x2e, 0xad, 0xe3, 0x2e, 0xad, 0xb7, 0x2e, 0xad, 0x87, 0x26, 0xad, 0x4b, 0x26, 0xad, 0x0b, 0x00, 0x00, 0x00, 0x2e, 0x8d, 0x2c, 0x2e, 
+  0xad, 0x94, 0x2e, 0xad, 0xdb, 0x9b, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xe4, 0x2e, 0xad, 0x9c, 0x26, 0x8d, 0x3b, 0x90, 0x00, 0x00, 0x00, 0x01, 0x2e, 0xad, 0x18, 0x2e, 0xad, 0xb4, 0x81, 0x2e, 
+  0xad, 0xff, 0x04, 0x2e, 0xad, 0xe3, 0x2e, 0xad, 0xa8, 0x2e, 0xad, 0x6f, 0x2e, 0xad, 0x40, 0x26, 0xad, 0x14, 0x85, 0x00, 0x00, 0x00, 0x02, 0x2e, 0x8d, 0x38, 0x2e, 0xad, 0x83, 0x2e, 0xad, 0xdc, 
+  0x97, 0x2e, 0xad, 0xff, 0x02, 0x2e, 0xad, 0xe8, 0x2e, 0xad, 0x98, 0x2e, 0xad, 0x47, 0x92, 0x00, 0x00, 0x00, 0x05, 0x2e, 0xad, 0x38, 0x2e, 0xad, 0xdc, 0x2e, 0xad, 0xa3, 0x2e, 0xad, 0x58, 0x2e, 
+  0xad, 0x30, 0x2e, 0xad, 0x14, 0x89, 0x00, 0x00, 0x00, 0x03, 0x2e, 0xec, 0x03, 0x26, 0xad, 0x2c, 0x26, 0x8d, 0x6b, 0x2e, 0xad, 0xb7, 0x93, 0x2e, 0xad, 0xff, 0x03, 0x26, 0xad, 0xcc, 0x2e, 0x8d, 
+  0x70, 0x26, 0xad, 0x33, 0x26, 0xad, 0x0b, 0x93, 0x00, 0x00, 0x00, 0x02, 0x26, 0xac, 0x0b, 0x26, 0x8d, 0x1f, 0x2e, 0xad, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x05, 0x26, 0x8d, 0x04, 0x2e, 0xad, 0x13, 
+  0x2e, 0xad, 0x23, 0x2e, 0x8d, 0x64, 0x26, 0x8d, 0xb4, 0x2e, 0xad, 0xec, 0x8b, 0x2e, 0xad, 0xff, 0x05, 0x2e, 0xad, 0xf4, 0x2e, 0xad, 0xbf, 0x2e, 0x8d, 0x73, 0x2e, 0xad, 0x2c, 0x26, 0xad, 0x14, 
+  0x26, 0x8d, 0x04, 0xaa, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x8d, 0x03, 0x26, 0x8d, 0x07, 0x2e, 0x8d, 0x08, 0x2e, 0xad, 0x17, 0x2e, 0xad, 0x47, 0x26, 0xad, 0x70, 0x2e, 0xad, 0x84, 0x2e, 0xad, 0x93, 
+  0x2e, 0x8d, 0xa3, 0x2e, 0xad, 0xac, 0x2e, 0xad, 0x9f, 0x26, 0xad, 0x8b, 0x26, 0x8d, 0x74, 0x2e, 0x8c, 0x54, 0x2e, 0xad, 0x23, 0x2e, 0xad, 0x0b, 0x2e, 0xad, 0x07, 0x2e, 0x8d, 0x03, 0x96, 0x00, 
+  0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xa0, 0x19, 0x00, 0x64, 0xe3, 0x26, 0x00, 0x67, 0xd2, 0x26, 0x00, 0x66, 0xd3, 0x25, 0x00, 0x61, 0xd3, 0x19, 0x00, 0x65, 0xd2, 0x24, 0x03, 0x65, 0xd3, 0x26, 0x07, 0x69, 0xd6, 0x24, 0x07, 0x66, 0xd8, 0x21, 0x17, 0x64, 0xd3, 0x23, 0x33, 0x66, 0xd3, 0x23, 0x44, 0x65, 0xd5, 0x24, 0x53, 0x67, 0xd3, 0x24, 0x60, 0x67, 0xd3, 0x25, 0x6c, 0x65, 0xd2, 0x24, 0x5c, 0x67, 0xd1, 0x25, 0x43, 0x67, 0xd3, 0x24, 0x28, 0x68, 0xda, 0x24, 0x13, 0x68, 0xd6, 0x23, 0x08, 0x65, 0xd3, 0x25, 0x07, 0x67, 0xd3, 0x26, 0x03, 0x62, 0xcf, 0x23, 0x00, 0x66, 0xd3, 0x25, 0x00, 0x67, 0xd4, 0x25, 0x00, 0x6c, 0xd2, 0x21, 0x00, 0x5c, 0xb8, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x70, 0xc7, 0x2a, 0x00, 0x64, 0xd3, 0x25, 0x00, 0x67, 0xd3, 0x26, 0x00, 0x67, 0xcd, 0x25, 0x00, 0x68, 0xd2, 0x27, 0x08, 0x66, 0xd3, 0x25, 0x18, 0x65, 0xd3, 0x24, 0x37, 0x65, 0xd2, 0x24, 0x7b, 0x65, 0xd3, 0x26, 0xbc, 0x66, 0xd3, 0x25, 0xeb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xf0, 0x65, 0xd3, 0x25, 0xb4, 0x67, 0xd3, 0x26, 0x77, 0x65, 0xd2, 0x25, 0x3b, 0x66, 0xd3, 0x25, 0x1b, 0x68, 0xd4, 0x25, 0x0b, 0x60, 0xd4, 0x28, 0x00, 0x67, 0xd3, 0x24, 0x00, 0x69, 0xd0, 0x29, 0x00, 0x3b, 0xe5, 0x00, 0x00, 0x11, 0x1f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xd1, 0x26, 0x00, 0x66, 0xd0, 0x26, 0x00, 0x69, 0xd1, 0x25, 0x00, 0x68, 0xd2, 0x27, 0x18, 0x66, 0xd4, 0x25, 0x3f, 0x67, 0xd3, 0x26, 0x88, 0x66, 0xd3, 0x25, 0xe0, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xeb, 0x67, 0xd4, 0x25, 0x90, 0x67, 0xd3, 0x25, 0x47, 0x66, 0xd3, 0x24, 0x1f, 0x4a, 0xe7, 0x00, 0x00, 0x65, 0xd4, 0x22, 0x00, 0x5f, 0xc1, 0x19, 0x00, 0x48, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xd3, 0x25, 0x00, 0x64, 0xd3, 0x25, 0x00, 0x66, 0xd2, 0x25, 0x00, 0x64, 0xd1, 0x26, 0x18, 0x66, 0xd2, 0x25, 0x68, 0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xc0, 0x66, 0xd3, 0x26, 0x73, 0x67, 0xd3, 0x24, 0x28, 0x68, 0xd9, 0x28, 0x00, 0x66, 0xd5, 0x26, 0x00, 0x66, 0xd5, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0x00, 0x00, 0x6b, 0xe0, 0x2c, 0x00, 0x66, 0xd4, 0x25, 0x00, 0x5d, 0xd3, 0x25, 0x07, 0x66, 0xd2, 0x25, 0x67, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xcc, 0x66, 0xd3, 0x25, 0x7f, 0x66, 0xd7, 0x27, 0x10, 0x66, 0xd4, 0x25, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0xcc, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xd1, 0x23, 0x00, 0x64, 0xab, 0x00, 0x00, 0x68, 0xd8, 0x27, 0x00, 0x66, 0xd4, 0x25, 0x40, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0xf3, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xfc, 0x66, 0xd3, 0x25, 0xc7, 0x66, 0xd4, 0x25, 0x53, 0x66, 0xd9, 0x28, 0x00, 0x65, 0xcc, 0x27, 0x00, 0x65, 0xd0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xd4, 0x27, 0x00, 0x69, 0xd3, 0x26, 0x00, 0x63, 0xd6, 0x28, 0x00, 0x66, 0xd4, 0x25, 0x6f, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xec, 0x66, 0xd3, 0x25, 0x88, 0x72, 0xf4, 0x00, 0x00, 0x66, 0xd3, 0x26, 0x00, 0x67, 0xd5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd3, 0x25, 0x00, 0x68, 0xd4, 0x26, 0x00, 0x6b, 0xd7, 0x2a, 0x0b, 0x66, 0xd2, 0x25, 0x97, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xa3, 0x68, 0xd7, 0x21, 0x10, 0x66, 0xd5, 0x23, 0x00, 0x6b, 0xce, 0x27, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xce, 0x26, 0x00, 0x69, 0xd2, 0x25, 0x00, 0x67, 0xd3, 0x25, 0x1f, 0x66, 0xd3, 0x25, 0xb8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xbf, 0x65, 0xd4, 0x25, 0x23, 0x6a, 0xcd, 0x21, 0x00, 0x52, 0xe1, 0x0f, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd3, 0x25, 0x00, 0x66, 0xd1, 0x26, 0x00, 0x65, 0xd4, 0x24, 0x24, 0x66, 0xd3, 0x25, 0xc0, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x26, 0xdb, 0x69, 0xd1, 0x28, 0x2f, 0x68, 0xcd, 0x24, 0x00, 0x6a, 0xcd, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd2, 0x24, 0x00, 0x67, 0xd2, 0x24, 0x00, 0x65, 0xd3, 0x25, 0x20, 0x66, 0xd3, 0x25, 0xc7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd2, 0x24, 0xd4, 0x65, 0xd3, 0x24, 0x24, 0x67, 0xd2, 0x25, 0x00, 0x67, 0xd2, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd0, 0x28, 0x00, 0x66, 0xd1, 0x26, 0x00, 0x68, 0xd1, 0x23, 0x13, 0x66, 0xd3, 0x25, 0xbb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xc3, 0x68, 0xd1, 0x25, 0x1b, 0x66, 0xd2, 0x26, 0x00, 0x65, 0xd2, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xd5, 0x2b, 0x00, 0x5f, 0xcf, 0x2c, 0x00, 0x75, 0xfa, 0x00, 0x00, 0x66, 0xd3, 0x25, 0xa8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x61, 0xd2, 0x16, 0xff, 0x53, 0xd0, 0x00, 0xff, 0x4e, 0xd0, 0x00, 0xff, 0x51, 0xd0, 0x00, 0xff, 0x55, 0xd0, 0x00, 0xff, 0x61, 0xd2, 0x17, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xb8, 0x63, 0xd0, 0x28, 0x0f, 0x67, 0xd4, 0x26, 0x00, 0x6d, 0xdb, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xcf, 0x1f, 0x00, 0x6a, 0xd2, 0x24, 0x00, 0x66, 0xd3, 0x25, 0x80, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x61, 0xd2, 0x15, 0xff, 0x81, 0xdb, 0x49, 0xff, 0xcc, 0xee, 0xbd, 0xff, 0xdd, 0xf3, 0xd7, 0xff, 0xd2, 0xf0, 0xc8, 0xff, 0xc5, 0xed, 0xb3, 0xff, 0x81, 0xdb, 0x4b, 0xff, 0x66, 0xd3, 0x23, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x9b, 0x61, 0xcd, 0x26, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd5, 0x24, 0x00, 0x66, 0xd2, 0x25, 0x00, 0x66, 0xd2, 0x25, 0x47, 0x66, 0xd3, 0x25, 0xe8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x61, 0xd2, 0x17, 0xff, 0x91, 0xdf, 0x61, 0xff, 0xf7, 0xfc, 0xf5, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xed, 0xfa, 0xe6, 0xff, 0x70, 0xd5, 0x38, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xec, 0x66, 0xd3, 0x25, 0x50, 0x66, 0xd3, 0x25, 0x00, 0x66, 0xd4, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x65, 0xd5, 0x24, 0x00, 0x62, 0xda, 0x21, 0x07, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x62, 0xd2, 0x1b, 0xff, 0x8d, 0xde, 0x59, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xe7, 0x8b, 0xff, 0x63, 0xd2, 0x1e, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xc8, 0x66, 0xd5, 0x21, 0x14, 0x66, 0xd4, 0x23, 0x00, 0x5d, 0xd1, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x56, 0xe1, 0x1e, 0x00, 0x69, 0xd1, 0x26, 0x00, 0x66, 0xd4, 0x25, 0x6f, 0x66, 0xd3, 0x25, 0xf4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x63, 0xd2, 0x1f, 0xff, 0x71, 0xd8, 0x26, 0xff, 0xf7, 0xfd, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xfa, 0xe1, 0xff, 0x61, 0xd2, 0x06, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x88, 0x6e, 0xd5, 0x18, 0x00, 0x60, 0xd2, 0x2c, 0x00, 0x16, 0x3d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0xca, 0x27, 0x00, 0x66, 0xd2, 0x25, 0x00, 0x65, 0xd3, 0x25, 0x20, 0x66, 0xd3, 0x25, 0xc4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x59, 0xd1, 0x00, 0xff, 0xd6, 0xf2, 0xc8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0xdd, 0x54, 0xff, 0x63, 0xd2, 0x1d, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xdb, 0x67, 0xd4, 0x25, 0x38, 0x68, 0xd4, 0x24, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x63, 0xd7, 0x21, 0x00, 0x6a, 0xcb, 0x2a, 0x00, 0x66, 0xd3, 0x25, 0x67, 0x66, 0xd3, 0x25, 0xfc, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x60, 0xd2, 0x12, 0xff, 0x88, 0xdd, 0x53, 0xff, 0xf7, 0xfc, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xf0, 0xb8, 0xff, 0x59, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x25, 0x7f, 0x54, 0xd2, 0x2e, 0x03, 0x64, 0xd2, 0x29, 0x00, 0x1f, 0x33, 0x0b, 0x00, 
-  0x57, 0xb0, 0x1e, 0x00, 0x67, 0xd3, 0x25, 0x00, 0x67, 0xd4, 0x24, 0x1b, 0x66, 0xd3, 0x25, 0xb8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x54, 0xd0, 0x00, 0xff, 0xc6, 0xed, 0xb5, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfd, 0xf6, 0xff, 0x69, 0xd5, 0x00, 0xff, 0x64, 0xd3, 0x22, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xd8, 0x67, 0xd2, 0x26, 0x28, 0x62, 0xd5, 0x20, 0x00, 0x3a, 0xd8, 0x00, 0x00, 
-  0x6a, 0xcd, 0x27, 0x00, 0x63, 0xd7, 0x24, 0x00, 0x67, 0xd2, 0x25, 0x47, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x24, 0xff, 0x5a, 0xd2, 0x00, 0xff, 0xe3, 0xf5, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xa9, 0xe6, 0x86, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x60, 0x69, 0xcf, 0x27, 0x03, 0x67, 0xd2, 0x26, 0x00, 
-  0x65, 0xd3, 0x25, 0x00, 0x65, 0xd3, 0x25, 0x0b, 0x66, 0xd3, 0x25, 0x8b, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x63, 0xd2, 0x1f, 0xff, 0x70, 0xd7, 0x19, 0xff, 0xe8, 0xf7, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xf6, 0xde, 0xff, 0x53, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd4, 0x25, 0xaf, 0x67, 0xd4, 0x25, 0x10, 0x66, 0xd5, 0x24, 0x00, 
-  0x66, 0xd3, 0x25, 0x00, 0x66, 0xd3, 0x25, 0x18, 0x66, 0xd3, 0x25, 0xe0, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x62, 0xd2, 0x1a, 0xff, 0x7d, 0xda, 0x40, 0xff, 0xea, 0xf8, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xf2, 0xff, 0x86, 0xdd, 0x50, 0xff, 0x60, 0xd2, 0x14, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd6, 0x24, 0x23, 0x6c, 0xc7, 0x2a, 0x00, 
-  0x6a, 0xcd, 0x27, 0x00, 0x67, 0xd2, 0x25, 0x3b, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x62, 0xd2, 0x1b, 0xff, 0x7a, 0xda, 0x39, 0xff, 0xea, 0xf8, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0xf6, 0xff, 0xac, 0xe6, 0x8d, 0xff, 0x5a, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd2, 0x26, 0x64, 0x67, 0xd2, 0x26, 0x03, 
-  0x66, 0xd2, 0x25, 0x03, 0x66, 0xd2, 0x25, 0x7b, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x63, 0xd2, 0x1f, 0xff, 0x6f, 0xd7, 0x17, 0xff, 0xe8, 0xf7, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfb, 0xef, 0xff, 0x7c, 0xda, 0x39, 0xff, 0x62, 0xd2, 0x1a, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x26, 0x9c, 0x66, 0xd3, 0x26, 0x04, 
-  0x67, 0xd2, 0x24, 0x07, 0x67, 0xd2, 0x24, 0xbc, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x54, 0xd1, 0x00, 0xff, 0xe1, 0xf4, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xba, 0xea, 0xa1, 0xff, 0x56, 0xd0, 0x00, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd3, 0x25, 0xd3, 0x67, 0xd3, 0x25, 0x07, 
-  0x69, 0xd6, 0x24, 0x08, 0x66, 0xd3, 0x25, 0xf3, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x56, 0xd0, 0x00, 0xff, 0xbf, 0xeb, 0xab, 0xff, 0xfb, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xf0, 0xc2, 0xff, 0x5a, 0xd2, 0x00, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd5, 0x27, 0x0f, 
-  0x66, 0xd8, 0x21, 0x14, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x61, 0xd2, 0x17, 0xff, 0x81, 0xdb, 0x45, 0xff, 0xf6, 0xfc, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf1, 0xc5, 0xff, 0x60, 0xd4, 0x00, 0xff, 0x65, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd4, 0x26, 0x37, 
-  0x66, 0xd2, 0x25, 0x3c, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x55, 0xd1, 0x00, 0xff, 0xe1, 0xf6, 0xd8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfd, 0xf3, 0xff, 0x70, 0xd6, 0x30, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd3, 0x25, 0x63, 
-  0x67, 0xd4, 0x24, 0x57, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x5e, 0xd1, 0x01, 0xff, 0x9b, 0xe2, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7a, 0xd9, 0x44, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0x7c, 
-  0x66, 0xd4, 0x26, 0x63, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x5e, 0xd2, 0x00, 0xff, 0xdd, 0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xf2, 0xbd, 0xff, 0x5c, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x25, 0x94, 
-  0x66, 0xd4, 0x26, 0x70, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x63, 0xd2, 0x1f, 0xff, 0x82, 0xdc, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xe1, 0x6a, 0xff, 0x61, 0xd2, 0x16, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd3, 0x26, 0x98, 
-  0x66, 0xd4, 0x24, 0x74, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x62, 0xd2, 0x17, 0xff, 0xbb, 0xec, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0xf3, 0xff, 0x6d, 0xd6, 0x1a, 0xff, 0x64, 0xd3, 0x20, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x25, 0x9b, 
-  0x67, 0xd2, 0x25, 0x64, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x6a, 0xd4, 0x2c, 0xff, 0xe4, 0xf7, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xf3, 0xca, 0xff, 0x65, 0xd4, 0x0a, 0xff, 0x64, 0xd3, 0x1f, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x93, 
-  0x66, 0xd3, 0x26, 0x53, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x23, 0xff, 0x8a, 0xdc, 0x61, 0xff, 0xf7, 0xfd, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xbf, 0xec, 0xa8, 0xff, 0x62, 0xd3, 0x00, 0xff, 0x64, 0xd2, 0x20, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd4, 0x25, 0x7b, 
-  0x67, 0xd2, 0x25, 0x3b, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd4, 0x23, 0xff, 0xb2, 0xe8, 0x99, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0xf7, 0xff, 0xb1, 0xe7, 0x98, 0xff, 0x63, 0xd3, 0x00, 0xff, 0x64, 0xd3, 0x20, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x22, 0xff, 0x62, 0xd2, 0x18, 0xff, 0x65, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd2, 0x25, 0x64, 
-  0x66, 0xd4, 0x25, 0x17, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x64, 0xd3, 0x1e, 0xff, 0x74, 0xd7, 0x41, 0xff, 0xd7, 0xf2, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfd, 0xf5, 0xff, 0xaf, 0xe6, 0x95, 0xff, 0x62, 0xd3, 0x00, 0xff, 0x64, 0xd3, 0x20, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x22, 0xff, 0x64, 0xd4, 0x00, 0xff, 0x80, 0xdb, 0x45, 0xff, 0x5b, 0xd2, 0x00, 0xff, 0x5c, 0xd1, 0x00, 0xff, 0x65, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x67, 0xd2, 0x25, 0x48, 
-  0x69, 0xd7, 0x23, 0x07, 0x66, 0xd3, 0x25, 0xe8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x61, 0xd2, 0x0a, 0xff, 0x8e, 0xdd, 0x67, 0xff, 0xed, 0xf9, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0xf7, 0xff, 0xbb, 0xea, 0xa2, 0xff, 0x62, 0xd3, 0x00, 0xff, 0x64, 0xd2, 0x20, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x65, 0xd4, 0x12, 0xff, 0xd3, 0xf1, 0xc5, 0xff, 0xee, 0xf9, 0xe9, 0xff, 0xd8, 0xf2, 0xce, 0xff, 0x9b, 0xe1, 0x74, 0xff, 0x5d, 0xd2, 0x00, 0xff, 0x60, 0xd2, 0x12, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x63, 0xd2, 0x26, 0x1b, 
-  0x66, 0xd3, 0x25, 0x07, 0x66, 0xd3, 0x25, 0xb8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x61, 0xd2, 0x08, 0xff, 0xa2, 0xe3, 0x80, 0xff, 0xf5, 0xfc, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xd3, 0xf2, 0xc2, 0xff, 0x6e, 0xd7, 0x19, 0xff, 0x5f, 0xd2, 0x10, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0xce, 0xf0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xfd, 0xf7, 0xff, 0xdd, 0xf4, 0xd1, 0xff, 0x8a, 0xde, 0x57, 0xff, 0x5a, 0xd1, 0x00, 0xff, 0x64, 0xd3, 0x22, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x25, 0xe7, 0x63, 0xd3, 0x26, 0x08, 
-  0x66, 0xd4, 0x26, 0x04, 0x66, 0xd4, 0x26, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x5d, 0xd1, 0x00, 0xff, 0xb0, 0xe7, 0x94, 0xff, 0xfa, 0xfe, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xfc, 0xf6, 0xff, 0xa2, 0xe4, 0x79, 0xff, 0x5c, 0xd2, 0x00, 0xff, 0x65, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x5a, 0xd1, 0x00, 0xff, 0xbe, 0xec, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf2, 0xc0, 0xff, 0x77, 0xd9, 0x33, 0xff, 0x60, 0xd2, 0x11, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd2, 0x24, 0xb0, 0x66, 0xd2, 0x24, 0x04, 
-  0x63, 0xd2, 0x22, 0x00, 0x65, 0xd2, 0x24, 0x4f, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x56, 0xd1, 0x00, 0xff, 0xc1, 0xec, 0xaa, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xf4, 0xcc, 0xff, 0x7e, 0xda, 0x47, 0xff, 0x67, 0xd3, 0x2b, 0xff, 0x66, 0xd3, 0x23, 0xff, 0x5f, 0xd2, 0x05, 0xff, 0xaa, 0xe6, 0x87, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xed, 0xa8, 0xff, 0x75, 0xd7, 0x3c, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x26, 0x6b, 0x65, 0xd3, 0x26, 0x03, 
-  0x69, 0xcf, 0x27, 0x00, 0x65, 0xd5, 0x26, 0x1b, 0x66, 0xd3, 0x26, 0xef, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x27, 0xff, 0x54, 0xd1, 0x00, 0xff, 0xcb, 0xef, 0xb9, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xc8, 0xee, 0xb3, 0xff, 0x8e, 0xdc, 0x6d, 0xff, 0xac, 0xe6, 0x8e, 0xff, 0xfb, 0xfe, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xf0, 0xff, 0x9d, 0xe1, 0x7a, 0xff, 0x61, 0xd2, 0x09, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x69, 0xd0, 0x23, 0x23, 0x57, 0xe0, 0x2d, 0x00, 
-  0x65, 0xd3, 0x23, 0x00, 0x66, 0xd2, 0x23, 0x0f, 0x66, 0xd3, 0x24, 0xa0, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x27, 0xff, 0x57, 0xd1, 0x00, 0xff, 0xc2, 0xeb, 0xac, 0xff, 0xfa, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xf3, 0xd4, 0xff, 0x69, 0xd5, 0x00, 0xff, 0x65, 0xd3, 0x22, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd4, 0x25, 0x10, 0x67, 0xd3, 0x24, 0x00, 
-  0x62, 0xd1, 0x24, 0x00, 0x4e, 0xc8, 0x1c, 0x00, 0x65, 0xd3, 0x25, 0x57, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x5f, 0xd2, 0x00, 0xff, 0xb5, 0xe8, 0x9d, 0xff, 0xf2, 0xfb, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xf1, 0xcf, 0xff, 0x64, 0xd4, 0x00, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0x68, 0x67, 0xd2, 0x21, 0x03, 0x67, 0xd3, 0x23, 0x00, 
-  0x6c, 0xc7, 0x28, 0x00, 0x67, 0xd1, 0x25, 0x00, 0x65, 0xd3, 0x25, 0x23, 0x66, 0xd3, 0x25, 0xcc, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x62, 0xd3, 0x08, 0xff, 0x9e, 0xe1, 0x7e, 0xff, 0xe7, 0xf8, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xc6, 0xec, 0xb9, 0xff, 0x56, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd4, 0x24, 0x30, 0x67, 0xd0, 0x25, 0x00, 0x46, 0x00, 0x19, 0x00, 
-  0x00, 0x22, 0x00, 0x00, 0x66, 0xd4, 0x25, 0x00, 0x76, 0xe1, 0x21, 0x00, 0x66, 0xd3, 0x25, 0x78, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x23, 0xff, 0x62, 0xd3, 0x0a, 0xff, 0x86, 0xdb, 0x5e, 0xff, 0xcc, 0xef, 0xba, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfc, 0xf1, 0xff, 0xa8, 0xe4, 0x8a, 0xff, 0x5c, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x8b, 0x64, 0xd4, 0x28, 0x07, 0x65, 0xd4, 0x26, 0x00, 0x20, 0x56, 0x06, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3c, 0xab, 0x28, 0x00, 0x65, 0xd2, 0x25, 0x00, 0x65, 0xd3, 0x25, 0x34, 0x66, 0xd3, 0x25, 0xd7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x64, 0xd3, 0x1b, 0xff, 0x6e, 0xd5, 0x37, 0xff, 0x95, 0xdf, 0x70, 0xff, 0xe5, 0xf8, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xf8, 0xe7, 0xff, 0x70, 0xd7, 0x1e, 0xff, 0x63, 0xd2, 0x1e, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd4, 0x25, 0x3b, 0x66, 0xd3, 0x24, 0x00, 0x5c, 0xd9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x33, 0x03, 0x00, 0x5c, 0xd4, 0x29, 0x00, 0x6c, 0xd2, 0x22, 0x00, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0xfc, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x6a, 0xd4, 0x31, 0xff, 0xaa, 0xe6, 0x86, 0xff, 0xf8, 0xfe, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0xf7, 0xff, 0xa4, 0xe4, 0x7f, 0xff, 0x5d, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0x97, 0x5d, 0xd5, 0x33, 0x00, 0x68, 0xd2, 0x20, 0x00, 0x21, 0x50, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xd5, 0x2b, 0x00, 0x66, 0xd4, 0x23, 0x00, 0x66, 0xd5, 0x21, 0x14, 0x66, 0xd3, 0x25, 0xc8, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x63, 0xd2, 0x1e, 0xff, 0x66, 0xd3, 0x14, 0xff, 0xa9, 0xe6, 0x86, 0xff, 0xeb, 0xf9, 0xe4, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xfd, 0xf8, 0xff, 0xa2, 0xe4, 0x7d, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xd8, 0x67, 0xd2, 0x26, 0x33, 0x67, 0xd2, 0x26, 0x00, 0x69, 0xd2, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd4, 0x23, 0x00, 0x66, 0xd3, 0x25, 0x00, 0x66, 0xd3, 0x26, 0x5b, 0x66, 0xd3, 0x25, 0xf0, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x5f, 0xd2, 0x08, 0xff, 0x5d, 0xd2, 0x00, 0xff, 0x8f, 0xdf, 0x5d, 0xff, 0xd1, 0xf1, 0xc2, 0xff, 0xf1, 0xfa, 0xed, 0xff, 0xf8, 0xfd, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf7, 0xfc, 0xf5, 0xff, 0xde, 0xf5, 0xd2, 0xff, 0x7e, 0xdb, 0x3a, 0xff, 0x5c, 0xd1, 0x00, 0xff, 0x67, 0xd3, 0x26, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xf4, 0x65, 0xd3, 0x25, 0x70, 0x63, 0xcf, 0x27, 0x00, 0x5c, 0xbf, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xd5, 0x08, 0x00, 0x69, 0xd2, 0x2a, 0x00, 0x66, 0xd3, 0x25, 0xcf, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x24, 0xff, 0x60, 0xd2, 0x12, 0xff, 0x52, 0xd0, 0x00, 0xff, 0x6b, 0xd6, 0x00, 0xff, 0xa7, 0xe5, 0x86, 0xff, 0xdd, 0xf3, 0xd6, 0xff, 0xe9, 0xf8, 0xe3, 0xff, 0xee, 0xfa, 0xe8, 0xff, 0xef, 0xfa, 0xea, 0xff, 0xed, 0xf9, 0xe7, 0xff, 0xe8, 0xf6, 0xe3, 0xff, 0xd2, 0xf0, 0xc6, 0xff, 0x92, 0xdf, 0x65, 0xff, 0x55, 0xd1, 0x00, 0xff, 0x62, 0xd2, 0x1c, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xab, 0x64, 0xcd, 0x2c, 0x00, 0x6b, 0xdd, 0x1b, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd8, 0x26, 0x00, 0x61, 0xc1, 0x23, 0x00, 0x66, 0xd3, 0x26, 0xd0, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x64, 0xd2, 0x20, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0x54, 0xd1, 0x00, 0xff, 0x75, 0xd9, 0x2b, 0xff, 0x8d, 0xde, 0x5f, 0xff, 0x93, 0xdf, 0x69, 0xff, 0x87, 0xdc, 0x53, 0xff, 0x66, 0xd4, 0x00, 0xff, 0x53, 0xd0, 0x00, 0xff, 0x5f, 0xd2, 0x08, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xd7, 0x63, 0xd2, 0x22, 0x18, 0x65, 0xd3, 0x23, 0x00, 0x66, 0xd5, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x66, 0xd4, 0x24, 0x00, 0x67, 0xd4, 0x24, 0x3f, 0x66, 0xd3, 0x25, 0xec, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x63, 0xd2, 0x1d, 0xff, 0x60, 0xd2, 0x0f, 0xff, 0x5f, 0xd2, 0x09, 0xff, 0x61, 0xd2, 0x14, 0xff, 0x64, 0xd3, 0x21, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe4, 0x67, 0xd4, 0x26, 0x3b, 0x69, 0xd0, 0x26, 0x00, 0x6a, 0xcc, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xc4, 0x29, 0x00, 0x67, 0xd1, 0x25, 0x00, 0x66, 0xd3, 0x25, 0x8f, 0x66, 0xd3, 0x25, 0xfb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x65, 0xd3, 0x25, 0xec, 0x65, 0xd4, 0x24, 0x3c, 0x67, 0xd6, 0x20, 0x00, 0x6e, 0xd0, 0x20, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xd1, 0x24, 0x00, 0x5f, 0xce, 0x21, 0x0b, 0x66, 0xd3, 0x25, 0xc4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xf4, 0x65, 0xd4, 0x25, 0x40, 0x89, 0x68, 0x34, 0x00, 0x60, 0xd1, 0x3b, 0x00, 0x66, 0xcc, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xb7, 0x00, 0x00, 0x66, 0xd2, 0x26, 0x00, 0x66, 0xd2, 0x26, 0x47, 0x66, 0xd3, 0x25, 0xe3, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xec, 0x68, 0xd5, 0x26, 0x4b, 0x6e, 0xdb, 0x2b, 0x00, 0x69, 0xd7, 0x25, 0x00, 0x1d, 0x4e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xea, 0x17, 0x00, 0x63, 0xcf, 0x27, 0x00, 0x66, 0xd3, 0x25, 0x84, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xdb, 0x66, 0xd4, 0x26, 0x3c, 0x64, 0xd0, 0x27, 0x00, 0x70, 0xdd, 0x26, 0x00, 0x35, 0x72, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x5b, 0x00, 0x00, 0x67, 0xd2, 0x24, 0x00, 0x67, 0xd1, 0x24, 0x14, 0x66, 0xd3, 0x25, 0xb7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xbf, 0x64, 0xd4, 0x26, 0x2b, 0x68, 0xd1, 0x27, 0x00, 0x69, 0xc3, 0x2b, 0x00, 0x6d, 0xdb, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5b, 0xbc, 0x30, 0x00, 0x65, 0xd1, 0x26, 0x00, 0x66, 0xd2, 0x25, 0x43, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd3, 0x25, 0xc8, 0x66, 0xd3, 0x25, 0xa8, 0x66, 0xd3, 0x25, 0xd7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd3, 0x25, 0x80, 0x59, 0xee, 0x23, 0x03, 0x65, 0xd4, 0x26, 0x00, 0x69, 0xcf, 0x28, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6a, 0xd7, 0x26, 0x00, 0x53, 0xc1, 0x1f, 0x00, 0x66, 0xd4, 0x25, 0x74, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe3, 0x66, 0xd3, 0x25, 0xb7, 0x66, 0xd4, 0x25, 0x87, 0x66, 0xd4, 0x24, 0x4b, 0x6a, 0xd4, 0x1d, 0x0b, 0x63, 0xcf, 0x27, 0x00, 0x66, 0xd2, 0x25, 0x2c, 0x66, 0xd3, 0x25, 0x94, 0x66, 0xd3, 0x25, 0xdb, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd3, 0x25, 0x9c, 0x65, 0xd2, 0x24, 0x3b, 0x69, 0xd2, 0x23, 0x00, 0x62, 0xd6, 0x26, 0x00, 0x65, 0xd5, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x33, 0x00, 0x00, 0x67, 0xd4, 0x25, 0x00, 0x68, 0xd3, 0x26, 0x18, 0x67, 0xd3, 0x25, 0xb4, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe3, 0x66, 0xd3, 0x25, 0xa8, 0x67, 0xd4, 0x25, 0x6f, 0x65, 0xd3, 0x25, 0x40, 0x68, 0xd4, 0x23, 0x14, 0x66, 0xcf, 0x24, 0x00, 0x66, 0xd4, 0x25, 0x00, 0x68, 0xd4, 0x22, 0x00, 0x3f, 0x9c, 0x38, 0x00, 0x66, 0xd2, 0x25, 0x00, 0x72, 0xdc, 0x2e, 0x00, 0x66, 0xd2, 0x25, 0x38, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xe8, 0x66, 0xd3, 0x25, 0x98, 0x67, 0xd3, 0x26, 0x47, 0xff, 0xff, 0xff, 0x00, 0x65, 0xd2, 0x24, 0x00, 0x83, 0xca, 0x06, 0x00, 0x55, 0xd5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x68, 0xd1, 0x26, 0x00, 0x66, 0xd4, 0x25, 0x38, 0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd3, 0x25, 0xa3, 0x65, 0xd4, 0x25, 0x58, 0x67, 0xd3, 0x26, 0x30, 0x65, 0xd4, 0x26, 0x14, 0x5f, 0xcc, 0x26, 0x00, 0x65, 0xd3, 0x25, 0x00, 0x67, 0xd4, 0x24, 0x00, 0x65, 0xe0, 0x28, 0x00, 0x66, 0xd9, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x20, 0x00, 0x61, 0xd0, 0x21, 0x00, 0x67, 0xd2, 0x25, 0x00, 0x62, 0xdc, 0x28, 0x03, 0x66, 0xd3, 0x24, 0x2c, 0x66, 0xd2, 0x24, 0x6b, 0x66, 0xd3, 0x25, 0xb7, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xcc, 0x67, 0xd2, 0x25, 0x70, 0x67, 0xd3, 0x24, 0x33, 0x65, 0xd5, 0x24, 0x0b, 0x68, 0xd2, 0x27, 0x00, 0x65, 0xd3, 0x22, 0x00, 0x64, 0xd3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x7c, 0xae, 0x2d, 0x00, 0x60, 0xd4, 0x21, 0x0b, 0x65, 0xd1, 0x24, 0x1f, 0x66, 0xd3, 0x25, 0x0f, 0x00, 0xff, 0x00, 0x00, 0x67, 0xd2, 0x26, 0x00, 0x65, 0xd4, 0x26, 0x00, 0x6f, 0xdc, 0x24, 0x00, 0x6d, 0xdb, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x45, 0x06, 0x00, 0x48, 0xec, 0x30, 0x00, 0x65, 0xd5, 0x25, 0x00, 0x66, 0xd5, 0x27, 0x00, 0x66, 0xcf, 0x21, 0x04, 0x66, 0xd3, 0x25, 0x13, 0x67, 0xd5, 0x25, 0x23, 0x67, 0xd2, 0x26, 0x64, 0x67, 0xd2, 0x24, 0xb4, 0x66, 0xd3, 0x25, 0xec, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x25, 0xf4, 0x67, 0xd3, 0x25, 0xbf, 0x66, 0xd2, 0x25, 0x73, 0x68, 0xd5, 0x26, 0x2c, 0x65, 0xd3, 0x24, 0x14, 0x69, 0xd0, 0x24, 0x04, 0x67, 0xd4, 0x27, 0x00, 0x65, 0xd3, 0x24, 0x00, 0x61, 0xd6, 0x22, 0x00, 0x31, 0x70, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x45, 0xf4, 0x1a, 0x00, 0x8d, 0xce, 0x3e, 0x00, 0x69, 0xdc, 0x2a, 0x00, 0x65, 0xd2, 0x24, 0x00, 0x63, 0xd6, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x57, 0x05, 0x00, 0x00, 0x35, 0x21, 0x00, 0x66, 0xd1, 0x23, 0x00, 0x67, 0xd3, 0x25, 0x00, 0x61, 0xcd, 0x26, 0x00, 0x67, 0xd2, 0x26, 0x03, 0x67, 0xd2, 0x24, 0x07, 0x66, 0xd2, 0x27, 0x08, 0x65, 0xd3, 0x27, 0x17, 0x66, 0xd4, 0x25, 0x47, 0x67, 0xd3, 0x24, 0x70, 0x66, 0xd3, 0x25, 0x84, 0x65, 0xd3, 0x25, 0x93, 0x66, 0xd2, 0x25, 0xa3, 0x67, 0xd3, 0x26, 0xac, 0x66, 0xd3, 0x25, 0x9f, 0x66, 0xd3, 0x24, 0x8b, 0x66, 0xd2, 0x24, 0x74, 0x64, 0xd2, 0x25, 0x54, 0x67, 0xd5, 0x25, 0x23, 0x68, 0xd5, 0x25, 0x0b, 0x67, 0xd3, 0x25, 0x07, 0x66, 0xd2, 0x25, 0x03, 0xfe, 0xff, 0x77, 0x00, 0x66, 0xd3, 0x25, 0x00, 0x67, 0xd1, 0x24, 0x00, 0x35, 0x84, 0x29, 0x00, 0x28, 0x57, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x65, 0xd2, 0x24, 0x03, 0x65, 0xd3, 0x26, 0x07, 0x69, 0xd6, 0x24, 0x07, 0x66, 0xd8, 0x21, 0x17, 0x64, 0xd3, 0x23, 0x33, 0x66, 0xd3, 
+  0x23, 0x44, 0x65, 0xd5, 0x24, 0x53, 0x67, 0xd3, 0x24, 0x60, 0x67, 0xd3, 0x25, 0x6c, 0x65, 0xd2, 0x24, 0x5c, 0x67, 0xd1, 0x25, 0x43, 0x67, 0xd3, 0x24, 0x28, 0x68, 0xda, 0x24, 0x13, 0x68, 0xd6, 
+  0x23, 0x08, 0x65, 0xd3, 0x25, 0x07, 0x67, 0xd3, 0x26, 0x03, 0xac, 0x00, 0x00, 0x00, 0x00, 0x05, 0x68, 0xd2, 0x27, 0x08, 0x66, 0xd3, 0x25, 0x18, 0x65, 0xd3, 0x24, 0x37, 0x65, 0xd2, 0x24, 0x7b, 
+  0x65, 0xd3, 0x26, 0xbc, 0x66, 0xd3, 0x25, 0xeb, 0x89, 0x66, 0xd3, 0x25, 0xff, 0x05, 0x66, 0xd3, 0x25, 0xf0, 0x65, 0xd3, 0x25, 0xb4, 0x67, 0xd3, 0x26, 0x77, 0x65, 0xd2, 0x25, 0x3b, 0x66, 0xd3, 
+  0x25, 0x1b, 0x68, 0xd4, 0x25, 0x0b, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x03, 0x68, 0xd2, 0x27, 0x18, 0x66, 0xd4, 0x25, 0x3f, 0x67, 0xd3, 0x26, 0x88, 0x66, 0xd3, 0x25, 0xe0, 0x91, 0x66, 0xd3, 0x25, 
+  0xff, 0x03, 0x66, 0xd3, 0x25, 0xeb, 0x67, 0xd4, 0x25, 0x90, 0x67, 0xd3, 0x25, 0x47, 0x66, 0xd3, 0x24, 0x1f, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x03, 0x64, 0xd1, 0x26, 0x18, 0x66, 0xd2, 0x25, 0x68, 
+  0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd3, 0x25, 0xfb, 0x96, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xc0, 0x66, 0xd3, 0x26, 0x73, 0x67, 0xd3, 0x24, 0x28, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x5d, 0xd3, 0x25, 0x07, 0x66, 0xd2, 0x25, 0x67, 0x66, 0xd3, 0x25, 0xbf, 0x9b, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xcc, 0x66, 0xd3, 0x25, 0x7f, 0x66, 0xd7, 0x27, 0x10, 0x9c, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0x66, 0xd4, 0x25, 0x40, 0x66, 0xd3, 0x25, 0xbf, 0x66, 0xd3, 0x25, 0xf3, 0x9d, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xfc, 0x66, 0xd3, 0x25, 0xc7, 0x66, 0xd4, 
+  0x25, 0x53, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd4, 0x25, 0x6f, 0x66, 0xd3, 0x25, 0xe4, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xec, 0x66, 0xd3, 0x25, 0x88, 0x97, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0x6b, 0xd7, 0x2a, 0x0b, 0x66, 0xd2, 0x25, 0x97, 0x66, 0xd3, 0x25, 0xfb, 0xa4, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xa3, 0x68, 0xd7, 0x21, 0x10, 0x94, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x67, 0xd3, 0x25, 0x1f, 0x66, 0xd3, 0x25, 0xb8, 0xa7, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xbf, 0x65, 0xd4, 0x25, 0x23, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x65, 0xd4, 0x24, 0x24, 0x66, 0xd3, 0x25, 0xc0, 0xa9, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x26, 0xdb, 0x69, 0xd1, 0x28, 0x2f, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0xd3, 0x25, 0x20, 
+  0x66, 0xd3, 0x25, 0xc7, 0xab, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x67, 0xd2, 0x24, 0xd4, 0x65, 0xd3, 0x24, 0x24, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0xd1, 0x23, 0x13, 0x66, 0xd3, 0x25, 0xbb, 
+  0xad, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xc3, 0x68, 0xd1, 0x25, 0x1b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0xa8, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x05, 0x61, 0xd2, 
+  0x16, 0xff, 0x53, 0xd0, 0x00, 0xff, 0x4e, 0xd0, 0x00, 0xff, 0x51, 0xd0, 0x00, 0xff, 0x55, 0xd0, 0x00, 0xff, 0x61, 0xd2, 0x17, 0xff, 0xa0, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xb8, 
+  0x63, 0xd0, 0x28, 0x0f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0x80, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x07, 0x61, 0xd2, 0x15, 0xff, 0x81, 0xdb, 0x49, 0xff, 0xcc, 0xee, 0xbd, 0xff, 
+  0xdd, 0xf3, 0xd7, 0xff, 0xd2, 0xf0, 0xc8, 0xff, 0xc5, 0xed, 0xb3, 0xff, 0x81, 0xdb, 0x4b, 0xff, 0x66, 0xd3, 0x23, 0xff, 0xa0, 0x66, 0xd3, 0x25, 0xff, 0x00, 0x66, 0xd3, 0x25, 0x9b, 0x8a, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x66, 0xd2, 0x25, 0x47, 0x66, 0xd3, 0x25, 0xe8, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x09, 0x66, 0xd3, 0x26, 0xff, 0x61, 0xd2, 0x17, 0xff, 0x91, 0xdf, 0x61, 0xff, 0xf7, 0xfc, 
+  0xf5, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xed, 0xfa, 0xe6, 0xff, 0x70, 0xd5, 0x38, 0xff, 0xa0, 0x66, 0xd3, 0x25, 0xff, 0x01, 
+  0x66, 0xd3, 0x25, 0xec, 0x66, 0xd3, 0x25, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0xda, 0x21, 0x07, 0x66, 0xd3, 0x25, 0xbf, 0x87, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x62, 0xd2, 0x1b, 0xff, 
+  0x8d, 0xde, 0x59, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xae, 0xe7, 0x8b, 0xff, 0x63, 0xd2, 0x1e, 0xff, 0xa0, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xc8, 
+  0x66, 0xd5, 0x21, 0x14, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd4, 0x25, 0x6f, 0x66, 0xd3, 0x25, 0xf4, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x63, 0xd2, 0x1f, 0xff, 0x71, 0xd8, 0x26, 0xff, 
+  0xf7, 0xfd, 0xf4, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xeb, 0xfa, 0xe1, 0xff, 0x61, 0xd2, 0x06, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x00, 0x66, 0xd3, 0x25, 0x88, 0x86, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x65, 0xd3, 0x25, 0x20, 0x66, 0xd3, 0x25, 0xc4, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x24, 0xff, 0x59, 0xd1, 0x00, 0xff, 0xd6, 0xf2, 0xc8, 0xff, 0xff, 0xff, 0xfe, 0xff, 
+  0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0x89, 0xdd, 0x54, 0xff, 0x63, 0xd2, 0x1d, 0xff, 0xa0, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xdb, 0x67, 0xd4, 0x25, 0x38, 0x85, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x66, 0xd3, 0x25, 0x67, 0x66, 0xd3, 0x25, 0xfc, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x60, 0xd2, 0x12, 0xff, 0x88, 0xdd, 0x53, 0xff, 0xf7, 0xfc, 0xf6, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0xcd, 0xf0, 0xb8, 0xff, 0x59, 0xd1, 0x00, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x65, 0xd3, 0x25, 0x7f, 0x54, 0xd2, 0x2e, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x67, 0xd4, 
+  0x24, 0x1b, 0x66, 0xd3, 0x25, 0xb8, 0x87, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x54, 0xd0, 0x00, 0xff, 0xc6, 0xed, 0xb5, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf8, 0xfd, 
+  0xf6, 0xff, 0x69, 0xd5, 0x00, 0xff, 0x64, 0xd3, 0x22, 0xff, 0xa0, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xd8, 0x67, 0xd2, 0x26, 0x28, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd2, 
+  0x25, 0x47, 0x87, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x65, 0xd3, 0x24, 0xff, 0x5a, 0xd2, 0x00, 0xff, 0xe3, 0xf5, 0xdd, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfd, 0xfe, 0xfd, 0xff, 0xa9, 0xe6, 
+  0x86, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0x60, 0x69, 0xcf, 0x27, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0xd3, 0x25, 0x0b, 0x66, 0xd3, 
+  0x25, 0x8b, 0x87, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x63, 0xd2, 0x1f, 0xff, 0x70, 0xd7, 0x19, 0xff, 0xe8, 0xf7, 0xe2, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x01, 0xe5, 0xf6, 0xde, 0xff, 0x53, 0xd1, 
+  0x00, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x67, 0xd4, 0x25, 0xaf, 0x67, 0xd4, 0x25, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x25, 0x18, 0x66, 0xd3, 0x25, 0xe0, 0x87, 0x66, 
+  0xd3, 0x25, 0xff, 0x02, 0x62, 0xd2, 0x1a, 0xff, 0x7d, 0xda, 0x40, 0xff, 0xea, 0xf8, 0xe5, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf5, 0xfc, 0xf2, 0xff, 0x86, 0xdd, 0x50, 0xff, 0x60, 0xd2, 
+  0x14, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x00, 0x65, 0xd6, 0x24, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd2, 0x25, 0x3b, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x62, 0xd2, 0x1b, 0xff, 
+  0x7a, 0xda, 0x39, 0xff, 0xea, 0xf8, 0xe4, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf9, 0xfd, 0xf6, 0xff, 0xac, 0xe6, 0x8d, 0xff, 0x5a, 0xd1, 0x00, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x03, 
+  0x67, 0xd2, 0x26, 0x64, 0x67, 0xd2, 0x26, 0x03, 0x66, 0xd2, 0x25, 0x03, 0x66, 0xd2, 0x25, 0x7b, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x63, 0xd2, 0x1f, 0xff, 0x6f, 0xd7, 0x17, 0xff, 0xe8, 0xf7, 
+  0xe2, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf3, 0xfb, 0xef, 0xff, 0x7c, 0xda, 0x39, 0xff, 0x62, 0xd2, 0x1a, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x26, 0x9c, 0x66, 0xd3, 
+  0x26, 0x04, 0x67, 0xd2, 0x24, 0x07, 0x67, 0xd2, 0x24, 0xbc, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x24, 0xff, 0x54, 0xd1, 0x00, 0xff, 0xe1, 0xf4, 0xdb, 0xff, 0x89, 0xff, 0xff, 0xff, 
+  0xff, 0x03, 0xfc, 0xfe, 0xfb, 0xff, 0xba, 0xea, 0xa1, 0xff, 0x56, 0xd0, 0x00, 0xff, 0x66, 0xd3, 0x26, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x67, 0xd3, 0x25, 0xd3, 0x67, 0xd3, 0x25, 0x07, 
+  0x69, 0xd6, 0x24, 0x08, 0x66, 0xd3, 0x25, 0xf3, 0x89, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x56, 0xd0, 0x00, 0xff, 0xbf, 0xeb, 0xab, 0xff, 0xfb, 0xfe, 0xf9, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xd1, 0xf0, 0xc2, 0xff, 0x5a, 0xd2, 0x00, 0xff, 0x66, 0xd3, 0x26, 0xff, 0xa3, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd5, 0x27, 0x0f, 0x66, 0xd8, 0x21, 0x14, 0x8a, 0x66, 0xd3, 0x25, 0xff, 0x02, 
+  0x61, 0xd2, 0x17, 0xff, 0x81, 0xdb, 0x45, 0xff, 0xf6, 0xfc, 0xf4, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xd2, 0xf1, 0xc5, 0xff, 0x60, 0xd4, 0x00, 0xff, 0x65, 0xd3, 0x25, 0xff, 0xa4, 0x66, 
+  0xd3, 0x25, 0xff, 0x01, 0x66, 0xd4, 0x26, 0x37, 0x66, 0xd2, 0x25, 0x3c, 0x8b, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x55, 0xd1, 0x00, 0xff, 0xe1, 0xf6, 0xd8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x85, 0xff, 
+  0xff, 0xff, 0xff, 0x02, 0xf8, 0xfd, 0xf3, 0xff, 0x70, 0xd6, 0x30, 0xff, 0x65, 0xd3, 0x23, 0xff, 0xa5, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x67, 0xd3, 0x25, 0x63, 0x67, 0xd4, 0x24, 0x57, 0x8b, 0x66, 
+  0xd3, 0x25, 0xff, 0x01, 0x5e, 0xd1, 0x01, 0xff, 0x9b, 0xe2, 0x73, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xfe, 0xff, 0x7a, 0xd9, 0x44, 0xff, 0xa6, 0x66, 0xd3, 0x25, 0xff, 0x01, 
+  0x66, 0xd3, 0x24, 0x7c, 0x66, 0xd4, 0x26, 0x63, 0x8b, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x24, 0xff, 0x5e, 0xd2, 0x00, 0xff, 0xdd, 0xf5, 0xcf, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xd0, 0xf2, 0xbd, 0xff, 0x5c, 0xd1, 0x00, 0xff, 0x66, 0xd3, 0x26, 0xff, 0xa4, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x65, 0xd3, 0x25, 0x94, 0x66, 0xd4, 0x26, 0x70, 0x8c, 0x66, 0xd3, 0x25, 0xff, 0x01, 
+  0x63, 0xd2, 0x1f, 0xff, 0x82, 0xdc, 0x4b, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0x99, 0xe1, 0x6a, 0xff, 0x61, 0xd2, 0x16, 0xff, 0xa4, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x67, 0xd3, 0x26, 0x98, 
+  0x66, 0xd4, 0x24, 0x74, 0x8d, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x62, 0xd2, 0x17, 0xff, 0xbb, 0xec, 0x9f, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf6, 0xfc, 0xf3, 0xff, 0x6d, 0xd6, 0x1a, 0xff, 
+  0x64, 0xd3, 0x20, 0xff, 0xa3, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x65, 0xd3, 0x25, 0x9b, 0x67, 0xd2, 0x25, 0x64, 0x8e, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x6a, 0xd4, 0x2c, 0xff, 0xe4, 0xf7, 0xd9, 0xff, 
+  0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xd9, 0xf3, 0xca, 0xff, 0x65, 0xd4, 0x0a, 0xff, 0x64, 0xd3, 0x1f, 0xff, 0xa2, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0x93, 0x66, 0xd3, 0x26, 0x53, 
+  0x8e, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x23, 0xff, 0x8a, 0xdc, 0x61, 0xff, 0xf7, 0xfd, 0xf3, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfd, 0xfe, 0xfc, 0xff, 0xbf, 0xec, 0xa8, 0xff, 
+  0x62, 0xd3, 0x00, 0xff, 0x64, 0xd2, 0x20, 0xff, 0xa1, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x67, 0xd4, 0x25, 0x7b, 0x67, 0xd2, 0x25, 0x3b, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x67, 0xd4, 0x23, 0xff, 
+  0xb2, 0xe8, 0x99, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf9, 0xfd, 0xf7, 0xff, 0xb1, 0xe7, 0x98, 0xff, 0x63, 0xd3, 0x00, 0xff, 0x64, 0xd3, 0x20, 0xff, 0x8a, 0x66, 
+  0xd3, 0x25, 0xff, 0x02, 0x65, 0xd3, 0x22, 0xff, 0x62, 0xd2, 0x18, 0xff, 0x65, 0xd3, 0x24, 0xff, 0x92, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd2, 0x25, 0x64, 0x66, 0xd4, 0x25, 0x17, 0x8f, 0x66, 
+  0xd3, 0x25, 0xff, 0x02, 0x64, 0xd3, 0x1e, 0xff, 0x74, 0xd7, 0x41, 0xff, 0xd7, 0xf2, 0xcb, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf8, 0xfd, 0xf5, 0xff, 0xaf, 0xe6, 0x95, 0xff, 0x62, 0xd3, 
+  0x00, 0xff, 0x64, 0xd3, 0x20, 0xff, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x05, 0x65, 0xd3, 0x22, 0xff, 0x64, 0xd4, 0x00, 0xff, 0x80, 0xdb, 0x45, 0xff, 0x5b, 0xd2, 0x00, 0xff, 0x5c, 0xd1, 0x00, 0xff, 
+  0x65, 0xd3, 0x24, 0xff, 0x90, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x67, 0xd2, 0x25, 0x48, 0x69, 0xd7, 0x23, 0x07, 0x66, 0xd3, 0x25, 0xe8, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x61, 0xd2, 0x0a, 0xff, 
+  0x8e, 0xdd, 0x67, 0xff, 0xed, 0xf9, 0xe7, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf9, 0xfd, 0xf7, 0xff, 0xbb, 0xea, 0xa2, 0xff, 0x62, 0xd3, 0x00, 0xff, 0x64, 0xd2, 0x20, 0xff, 0x86, 0x66, 
+  0xd3, 0x25, 0xff, 0x07, 0x66, 0xd3, 0x26, 0xff, 0x65, 0xd4, 0x12, 0xff, 0xd3, 0xf1, 0xc5, 0xff, 0xee, 0xf9, 0xe9, 0xff, 0xd8, 0xf2, 0xce, 0xff, 0x9b, 0xe1, 0x74, 0xff, 0x5d, 0xd2, 0x00, 0xff, 
+  0x60, 0xd2, 0x12, 0xff, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x63, 0xd2, 0x26, 0x1b, 0x66, 0xd3, 0x25, 0x07, 0x66, 0xd3, 0x25, 0xb8, 0x8f, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x24, 0xff, 
+  0x61, 0xd2, 0x08, 0xff, 0xa2, 0xe3, 0x80, 0xff, 0xf5, 0xfc, 0xf2, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfd, 0xfe, 0xfc, 0xff, 0xd3, 0xf2, 0xc2, 0xff, 0x6e, 0xd7, 0x19, 0xff, 0x5f, 0xd2, 
+  0x10, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x83, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x26, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0xce, 0xf0, 0xbb, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xff, 
+  0xfe, 0xff, 0xf9, 0xfd, 0xf7, 0xff, 0xdd, 0xf4, 0xd1, 0xff, 0x8a, 0xde, 0x57, 0xff, 0x5a, 0xd1, 0x00, 0xff, 0x64, 0xd3, 0x22, 0xff, 0x8c, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x65, 0xd3, 0x25, 0xe7, 
+  0x63, 0xd3, 0x26, 0x08, 0x66, 0xd4, 0x26, 0x04, 0x66, 0xd4, 0x26, 0x88, 0x90, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x24, 0xff, 0x5d, 0xd1, 0x00, 0xff, 0xb0, 0xe7, 0x94, 0xff, 0xfa, 0xfe, 
+  0xf8, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xfc, 0xf6, 0xff, 0xa2, 0xe4, 0x79, 0xff, 0x5c, 0xd2, 0x00, 0xff, 0x65, 0xd3, 0x24, 0xff, 0x81, 0x66, 0xd3, 0x25, 
+  0xff, 0x02, 0x66, 0xd3, 0x26, 0xff, 0x5a, 0xd1, 0x00, 0xff, 0xbe, 0xec, 0xa3, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf2, 0xc0, 0xff, 
+  0x77, 0xd9, 0x33, 0xff, 0x60, 0xd2, 0x11, 0xff, 0x8b, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd2, 0x24, 0xb0, 0x66, 0xd2, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd2, 0x24, 0x4f, 0x91, 0x66, 
+  0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x26, 0xff, 0x56, 0xd1, 0x00, 0xff, 0xc1, 0xec, 0xaa, 0xff, 0xfd, 0xfe, 0xfc, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x06, 0xda, 0xf4, 0xcc, 0xff, 0x7e, 0xda, 
+  0x47, 0xff, 0x67, 0xd3, 0x2b, 0xff, 0x66, 0xd3, 0x23, 0xff, 0x5f, 0xd2, 0x05, 0xff, 0xaa, 0xe6, 0x87, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc1, 0xed, 0xa8, 0xff, 
+  0x75, 0xd7, 0x3c, 0xff, 0x66, 0xd3, 0x25, 0xff, 0x66, 0xd3, 0x24, 0xff, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x04, 0x65, 0xd3, 0x26, 0x6b, 0x65, 0xd3, 0x26, 0x03, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd5, 
+  0x26, 0x1b, 0x66, 0xd3, 0x26, 0xef, 0x91, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x27, 0xff, 0x54, 0xd1, 0x00, 0xff, 0xcb, 0xef, 0xb9, 0xff, 0xfc, 0xfe, 0xfb, 0xff, 0x88, 0xff, 0xff, 0xff, 
+  0xff, 0x04, 0xfd, 0xff, 0xfb, 0xff, 0xc8, 0xee, 0xb3, 0xff, 0x8e, 0xdc, 0x6d, 0xff, 0xac, 0xe6, 0x8e, 0xff, 0xfb, 0xfe, 0xfa, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf5, 0xfc, 0xf0, 0xff, 
+  0x9d, 0xe1, 0x7a, 0xff, 0x61, 0xd2, 0x09, 0xff, 0x88, 0x66, 0xd3, 0x25, 0xff, 0x00, 0x69, 0xd0, 0x23, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd2, 0x23, 0x0f, 0x66, 0xd3, 0x24, 0xa0, 
+  0x92, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x27, 0xff, 0x57, 0xd1, 0x00, 0xff, 0xc2, 0xeb, 0xac, 0xff, 0xfa, 0xfe, 0xf7, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x02, 0xdc, 0xf3, 0xd4, 0xff, 
+  0x69, 0xd5, 0x00, 0xff, 0x65, 0xd3, 0x22, 0xff, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xb4, 0x66, 0xd4, 0x25, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd3, 0x25, 0x57, 
+  0x94, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x5f, 0xd2, 0x00, 0xff, 0xb5, 0xe8, 0x9d, 0xff, 0xf2, 0xfb, 0xed, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0x02, 0xd7, 0xf1, 0xcf, 0xff, 0x64, 0xd4, 0x00, 0xff, 
+  0x65, 0xd3, 0x23, 0xff, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x24, 0x68, 0x67, 0xd2, 0x21, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0xd3, 0x25, 0x23, 0x66, 0xd3, 0x25, 0xcc, 
+  0x93, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x65, 0xd3, 0x23, 0xff, 0x62, 0xd3, 0x08, 0xff, 0x9e, 0xe1, 0x7e, 0xff, 0xe7, 0xf8, 0xe0, 0xff, 0x95, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xff, 0xfd, 0xff, 
+  0xc6, 0xec, 0xb9, 0xff, 0x56, 0xd1, 0x00, 0xff, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd4, 0x24, 0x30, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0x78, 
+  0x94, 0x66, 0xd3, 0x25, 0xff, 0x04, 0x65, 0xd3, 0x23, 0xff, 0x62, 0xd3, 0x0a, 0xff, 0x86, 0xdb, 0x5e, 0xff, 0xcc, 0xef, 0xba, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xf5, 0xfc, 0xf1, 0xff, 0xa8, 0xe4, 0x8a, 0xff, 0x5c, 0xd1, 0x00, 0xff, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0x8b, 0x64, 0xd4, 0x28, 0x07, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x65, 0xd3, 0x25, 0x34, 0x66, 0xd3, 0x25, 0xd7, 0x95, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x64, 0xd3, 0x1b, 0xff, 0x6e, 0xd5, 0x37, 0xff, 0x95, 0xdf, 0x70, 0xff, 0xe5, 0xf8, 0xdb, 0xff, 0x92, 0xff, 
+  0xff, 0xff, 0xff, 0x02, 0xeb, 0xf8, 0xe7, 0xff, 0x70, 0xd7, 0x1e, 0xff, 0x63, 0xd2, 0x1e, 0xff, 0x85, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd4, 0x25, 0x3b, 0x86, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0xfc, 0x95, 0x66, 0xd3, 0x25, 0xff, 0x81, 0x66, 0xd3, 0x24, 0xff, 0x02, 0x6a, 0xd4, 0x31, 0xff, 0xaa, 0xe6, 0x86, 0xff, 0xf8, 
+  0xfe, 0xf4, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf9, 0xfd, 0xf7, 0xff, 0xa4, 0xe4, 0x7f, 0xff, 0x5d, 0xd1, 0x00, 0xff, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x00, 0x66, 0xd3, 0x25, 0x97, 0x87, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd5, 0x21, 0x14, 0x66, 0xd3, 0x25, 0xc8, 0x98, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x63, 0xd2, 0x1e, 0xff, 0x66, 0xd3, 0x14, 0xff, 0xa9, 0xe6, 0x86, 0xff, 0xeb, 
+  0xf9, 0xe4, 0xff, 0x81, 0xfe, 0xff, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xfd, 0xf8, 0xff, 0xa2, 0xe4, 0x7d, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0x66, 0xd3, 
+  0x26, 0xff, 0x85, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xd8, 0x67, 0xd2, 0x26, 0x33, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x26, 0x5b, 0x66, 0xd3, 0x25, 0xf0, 0x98, 0x66, 
+  0xd3, 0x25, 0xff, 0x06, 0x66, 0xd3, 0x24, 0xff, 0x5f, 0xd2, 0x08, 0xff, 0x5d, 0xd2, 0x00, 0xff, 0x8f, 0xdf, 0x5d, 0xff, 0xd1, 0xf1, 0xc2, 0xff, 0xf1, 0xfa, 0xed, 0xff, 0xf8, 0xfd, 0xf6, 0xff, 
+  0x85, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xff, 0xfd, 0xff, 0xf7, 0xfc, 0xf5, 0xff, 0xde, 0xf5, 0xd2, 0xff, 0x7e, 0xdb, 0x3a, 0xff, 0x5c, 0xd1, 0x00, 0xff, 0x67, 0xd3, 0x26, 0xff, 0x85, 0x66, 
+  0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xf4, 0x65, 0xd3, 0x25, 0x70, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0xcf, 0x9a, 0x66, 0xd3, 0x25, 0xff, 0x0f, 0x65, 0xd3, 0x24, 0xff, 
+  0x60, 0xd2, 0x12, 0xff, 0x52, 0xd0, 0x00, 0xff, 0x6b, 0xd6, 0x00, 0xff, 0xa7, 0xe5, 0x86, 0xff, 0xdd, 0xf3, 0xd6, 0xff, 0xe9, 0xf8, 0xe3, 0xff, 0xee, 0xfa, 0xe8, 0xff, 0xef, 0xfa, 0xea, 0xff, 
+  0xed, 0xf9, 0xe7, 0xff, 0xe8, 0xf6, 0xe3, 0xff, 0xd2, 0xf0, 0xc6, 0xff, 0x92, 0xdf, 0x65, 0xff, 0x55, 0xd1, 0x00, 0xff, 0x62, 0xd2, 0x1c, 0xff, 0x66, 0xd3, 0x26, 0xff, 0x86, 0x66, 0xd3, 0x25, 
+  0xff, 0x00, 0x66, 0xd3, 0x25, 0xab, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x26, 0xd0, 0x9d, 0x66, 0xd3, 0x25, 0xff, 0x0a, 0x64, 0xd2, 0x20, 0xff, 0x5b, 0xd1, 0x00, 0xff, 0x54, 0xd1, 
+  0x00, 0xff, 0x75, 0xd9, 0x2b, 0xff, 0x8d, 0xde, 0x5f, 0xff, 0x93, 0xdf, 0x69, 0xff, 0x87, 0xdc, 0x53, 0xff, 0x66, 0xd4, 0x00, 0xff, 0x53, 0xd0, 0x00, 0xff, 0x5f, 0xd2, 0x08, 0xff, 0x66, 0xd3, 
+  0x24, 0xff, 0x87, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xd7, 0x63, 0xd2, 0x22, 0x18, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x67, 0xd4, 0x24, 0x3f, 0x66, 0xd3, 0x25, 0xec, 0x9f, 0x66, 
+  0xd3, 0x25, 0xff, 0x05, 0x66, 0xd3, 0x24, 0xff, 0x63, 0xd2, 0x1d, 0xff, 0x60, 0xd2, 0x0f, 0xff, 0x5f, 0xd2, 0x09, 0xff, 0x61, 0xd2, 0x14, 0xff, 0x64, 0xd3, 0x21, 0xff, 0x89, 0x66, 0xd3, 0x25, 
+  0xff, 0x01, 0x66, 0xd3, 0x25, 0xe4, 0x67, 0xd4, 0x26, 0x3b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd3, 0x25, 0x8f, 0x66, 0xd3, 0x25, 0xfb, 0xae, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x65, 0xd3, 
+  0x25, 0xec, 0x65, 0xd4, 0x24, 0x3c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5f, 0xce, 0x21, 0x0b, 0x66, 0xd3, 0x25, 0xc4, 0xae, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x24, 0xf4, 0x65, 0xd4, 
+  0x25, 0x40, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd2, 0x26, 0x47, 0x66, 0xd3, 0x25, 0xe3, 0xad, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xec, 0x68, 0xd5, 0x26, 0x4b, 0x8d, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x66, 0xd3, 0x25, 0x84, 0xad, 0x66, 0xd3, 0x25, 0xff, 0x01, 0x66, 0xd3, 0x25, 0xdb, 0x66, 0xd4, 0x26, 0x3c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x67, 0xd1, 0x24, 0x14, 
+  0x66, 0xd3, 0x25, 0xb7, 0xab, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xf8, 0x66, 0xd3, 0x25, 0xbf, 0x64, 0xd4, 0x26, 0x2b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0xd2, 0x25, 0x43, 
+  0x66, 0xd3, 0x25, 0xe4, 0x86, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd3, 0x25, 0xc8, 0x66, 0xd3, 0x25, 0xa8, 0x66, 0xd3, 0x25, 0xd7, 0x9f, 0x66, 0xd3, 0x25, 0xff, 0x02, 
+  0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd3, 0x25, 0x80, 0x59, 0xee, 0x23, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd4, 0x25, 0x74, 0x84, 0x66, 0xd3, 0x25, 0xff, 0x08, 0x66, 0xd3, 0x25, 0xe3, 
+  0x66, 0xd3, 0x25, 0xb7, 0x66, 0xd4, 0x25, 0x87, 0x66, 0xd4, 0x24, 0x4b, 0x6a, 0xd4, 0x1d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd2, 0x25, 0x2c, 0x66, 0xd3, 0x25, 0x94, 0x66, 0xd3, 0x25, 0xdb, 
+  0x9b, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xe4, 0x66, 0xd3, 0x25, 0x9c, 0x65, 0xd2, 0x24, 0x3b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0xd3, 0x26, 0x18, 0x67, 0xd3, 0x25, 0xb4, 
+  0x81, 0x66, 0xd3, 0x25, 0xff, 0x04, 0x66, 0xd3, 0x25, 0xe3, 0x66, 0xd3, 0x25, 0xa8, 0x67, 0xd4, 0x25, 0x6f, 0x65, 0xd3, 0x25, 0x40, 0x68, 0xd4, 0x23, 0x14, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x66, 0xd2, 0x25, 0x38, 0x66, 0xd3, 0x25, 0x83, 0x66, 0xd3, 0x25, 0xdc, 0x97, 0x66, 0xd3, 0x25, 0xff, 0x02, 0x66, 0xd3, 0x25, 0xe8, 0x66, 0xd3, 0x25, 0x98, 0x67, 0xd3, 0x26, 0x47, 0x92, 0x00, 
+  0x00, 0x00, 0x00, 0x05, 0x66, 0xd4, 0x25, 0x38, 0x66, 0xd3, 0x25, 0xdc, 0x66, 0xd3, 0x25, 0xa3, 0x65, 0xd4, 0x25, 0x58, 0x67, 0xd3, 0x26, 0x30, 0x65, 0xd4, 0x26, 0x14, 0x89, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0x62, 0xdc, 0x28, 0x03, 0x66, 0xd3, 0x24, 0x2c, 0x66, 0xd2, 0x24, 0x6b, 0x66, 0xd3, 0x25, 0xb7, 0x93, 0x66, 0xd3, 0x25, 0xff, 0x03, 0x66, 0xd3, 0x24, 0xcc, 0x67, 0xd2, 0x25, 0x70, 
+  0x67, 0xd3, 0x24, 0x33, 0x65, 0xd5, 0x24, 0x0b, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0xd4, 0x21, 0x0b, 0x65, 0xd1, 0x24, 0x1f, 0x66, 0xd3, 0x25, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x05, 
+  0x66, 0xcf, 0x21, 0x04, 0x66, 0xd3, 0x25, 0x13, 0x67, 0xd5, 0x25, 0x23, 0x67, 0xd2, 0x26, 0x64, 0x67, 0xd2, 0x24, 0xb4, 0x66, 0xd3, 0x25, 0xec, 0x8b, 0x66, 0xd3, 0x25, 0xff, 0x05, 0x66, 0xd3, 
+  0x25, 0xf4, 0x67, 0xd3, 0x25, 0xbf, 0x66, 0xd2, 0x25, 0x73, 0x68, 0xd5, 0x26, 0x2c, 0x65, 0xd3, 0x24, 0x14, 0x69, 0xd0, 0x24, 0x04, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x11, 0x67, 0xd2, 0x26, 0x03, 
+  0x67, 0xd2, 0x24, 0x07, 0x66, 0xd2, 0x27, 0x08, 0x65, 0xd3, 0x27, 0x17, 0x66, 0xd4, 0x25, 0x47, 0x67, 0xd3, 0x24, 0x70, 0x66, 0xd3, 0x25, 0x84, 0x65, 0xd3, 0x25, 0x93, 0x66, 0xd2, 0x25, 0xa3, 
+  0x67, 0xd3, 0x26, 0xac, 0x66, 0xd3, 0x25, 0x9f, 0x66, 0xd3, 0x24, 0x8b, 0x66, 0xd2, 0x24, 0x74, 0x64, 0xd2, 0x25, 0x54, 0x67, 0xd5, 0x25, 0x23, 0x68, 0xd5, 0x25, 0x0b, 0x67, 0xd3, 0x25, 0x07, 
+  0x66, 0xd2, 0x25, 0x03, 0x96, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +375,7 @@ const lv_img_dsc_t whatsapp_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( whatsapp_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = whatsapp_64px_map,
 };
-
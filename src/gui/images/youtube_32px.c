@@ -10,143 +10,99 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_YOUTUBE_32PX uint8_t youtube_32px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xe4, 0x17, 0xe5, 0x33, 0xe5, 0x47, 0xe5, 0x50, 0xe5, 0x57, 0xe5, 0x5b, 0xe5, 0x5c, 0xe5, 0x5c, 0xe5, 0x5c, 0xe5, 0x5c, 0xe5, 0x5c, 0xe5, 0x5c, 0xe5, 0x5c, 0xe5, 0x5c, 0xe5, 0x5b, 0xe5, 0x57, 0xe5, 0x50, 0xe5, 0x44, 0xe4, 0x33, 0xe4, 0x17, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x2b, 0xe5, 0xa3, 0xe5, 0xe8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xe8, 0xe5, 0xa3, 0xe4, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe4, 0x33, 0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf4, 0xe4, 0x33, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe5, 0xbb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xbb, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe4, 0x0f, 0xe5, 0xfc, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xfc, 0xe4, 0x0f, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x3b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x3b, 0x00, 0x00, 
-  0x00, 0x00, 0xe4, 0x57, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0x57, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x6b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x6b, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x74, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x74, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x7b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x7b, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x7b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x7b, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x7b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x7b, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x78, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x78, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x74, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x74, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x68, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x68, 0x00, 0x00, 
-  0x00, 0x00, 0xe5, 0x54, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x54, 0x00, 0x00, 
-  0x00, 0x00, 0xe4, 0x34, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0x34, 0x00, 0x00, 
-  0x00, 0x00, 0xe4, 0x08, 0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf8, 0xe4, 0x08, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe5, 0xac, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xac, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe4, 0x24, 0xe5, 0xe8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xe8, 0xe4, 0x24, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x17, 0xe5, 0x80, 0xe5, 0xc8, 0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf4, 0xe5, 0xc8, 0xe5, 0x80, 0xe5, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe4, 0x13, 0xe4, 0x24, 0xe5, 0x30, 0xe4, 0x37, 0xe4, 0x3b, 0xe5, 0x3c, 0xe5, 0x3c, 0xe5, 0x3c, 0xe5, 0x3c, 0xe5, 0x3c, 0xe5, 0x3c, 0xe5, 0x3c, 0xe5, 0x3c, 0xe5, 0x3b, 0xe4, 0x37, 0xe5, 0x30, 0xe4, 0x24, 0xe4, 0x13, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x05, 0xe4, 0x17, 0xe5, 0x33, 0xe5, 0x47, 0xe5, 0x50, 0xe5, 0x57, 0xe5, 0x5b, 0x87, 0xe5, 0x5c, 0x05, 0xe5, 0x5b, 0xe5, 0x57, 0xe5, 
+  0x50, 0xe5, 0x44, 0xe4, 0x33, 0xe4, 0x17, 0x88, 0x00, 0x00, 0x02, 0xe4, 0x2b, 0xe5, 0xa3, 0xe5, 0xe8, 0x93, 0xe5, 0xff, 0x02, 0xe5, 0xe8, 0xe5, 0xa3, 0xe4, 0x2b, 0x84, 0x00, 0x00, 0x01, 0xe4, 
+  0x33, 0xe5, 0xf4, 0x97, 0xe5, 0xff, 0x01, 0xe5, 0xf4, 0xe4, 0x33, 0x83, 0x00, 0x00, 0x00, 0xe5, 0xbb, 0x99, 0xe5, 0xff, 0x00, 0xe5, 0xbb, 0x82, 0x00, 0x00, 0x01, 0xe4, 0x0f, 0xe5, 0xfc, 0x99, 
+  0xe5, 0xff, 0x01, 0xe5, 0xfc, 0xe4, 0x0f, 0x81, 0x00, 0x00, 0x00, 0xe5, 0x3b, 0x9b, 0xe5, 0xff, 0x00, 0xe5, 0x3b, 0x81, 0x00, 0x00, 0x00, 0xe4, 0x57, 0x8a, 0xe5, 0xff, 0x00, 0xe9, 0xff, 0x8f, 
+  0xe5, 0xff, 0x00, 0xe4, 0x57, 0x81, 0x00, 0x00, 0x00, 0xe5, 0x6b, 0x8a, 0xe5, 0xff, 0x02, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0x8d, 0xe5, 0xff, 0x00, 0xe5, 0x6b, 0x81, 0x00, 0x00, 0x00, 0xe5, 
+  0x74, 0x8a, 0xe5, 0xff, 0x82, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xe9, 0xff, 0x8b, 0xe5, 0xff, 0x00, 0xe5, 0x74, 0x81, 0x00, 0x00, 0x00, 0xe5, 0x7b, 0x8a, 0xe5, 0xff, 0x84, 0xff, 0xff, 0x01, 0xf6, 
+  0xff, 0xe9, 0xff, 0x89, 0xe5, 0xff, 0x00, 0xe5, 0x7b, 0x81, 0x00, 0x00, 0x00, 0xe5, 0x7b, 0x8a, 0xe5, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x88, 0xe5, 0xff, 0x00, 0xe5, 0x7b, 0x81, 0x00, 
+  0x00, 0x00, 0xe5, 0x7b, 0x8a, 0xe5, 0xff, 0x85, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x89, 0xe5, 0xff, 0x00, 0xe5, 0x7b, 0x81, 0x00, 0x00, 0x00, 0xe5, 0x78, 0x8a, 0xe5, 0xff, 0x83, 0xff, 0xff, 0x00, 
+  0xf2, 0xff, 0x8b, 0xe5, 0xff, 0x00, 0xe5, 0x78, 0x81, 0x00, 0x00, 0x00, 0xe5, 0x74, 0x8a, 0xe5, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8d, 0xe5, 0xff, 0x00, 0xe5, 0x74, 0x81, 0x00, 0x00, 
+  0x00, 0xe5, 0x68, 0x8a, 0xe5, 0xff, 0x00, 0xf2, 0xff, 0x8f, 0xe5, 0xff, 0x00, 0xe5, 0x68, 0x81, 0x00, 0x00, 0x00, 0xe5, 0x54, 0x9b, 0xe5, 0xff, 0x00, 0xe5, 0x54, 0x81, 0x00, 0x00, 0x00, 0xe4, 
+  0x34, 0x9b, 0xe5, 0xff, 0x00, 0xe4, 0x34, 0x81, 0x00, 0x00, 0x01, 0xe4, 0x08, 0xe5, 0xf8, 0x99, 0xe5, 0xff, 0x01, 0xe5, 0xf8, 0xe4, 0x08, 0x82, 0x00, 0x00, 0x00, 0xe5, 0xac, 0x99, 0xe5, 0xff, 
+  0x00, 0xe5, 0xac, 0x83, 0x00, 0x00, 0x01, 0xe4, 0x24, 0xe5, 0xe8, 0x97, 0xe5, 0xff, 0x01, 0xe5, 0xe8, 0xe4, 0x24, 0x84, 0x00, 0x00, 0x03, 0xe5, 0x17, 0xe5, 0x80, 0xe5, 0xc8, 0xe5, 0xf4, 0x91, 
+  0xe5, 0xff, 0x03, 0xe5, 0xf4, 0xe5, 0xc8, 0xe5, 0x80, 0xe5, 0x17, 0x89, 0x00, 0x00, 0x04, 0xe4, 0x13, 0xe4, 0x24, 0xe5, 0x30, 0xe4, 0x37, 0xe4, 0x3b, 0x87, 0xe5, 0x3c, 0x04, 0xe5, 0x3b, 0xe4, 
+  0x37, 0xe5, 0x30, 0xe4, 0x24, 0xe4, 0x13, 0xff, 0x00, 0x00, 0xa6, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xe4, 0xd0, 0x17, 0x04, 0xd1, 0x33, 0x04, 0xd1, 0x47, 0x04, 0xd1, 0x50, 0x04, 0xd1, 0x57, 0x04, 0xd1, 0x5b, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x5b, 0x04, 0xd1, 0x57, 0x04, 0xd1, 0x50, 0x04, 0xd1, 0x44, 0x04, 0xd1, 0x33, 0x04, 0xd1, 0x17, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x2b, 0x04, 0xd1, 0xa3, 0x24, 0xd1, 0xe8, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xe8, 0x04, 0xd1, 0xa3, 0x04, 0xd1, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0x33, 0x24, 0xd1, 0xf4, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xf4, 0x04, 0xd1, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0xbb, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xe3, 0xd0, 0x0f, 0x24, 0xd1, 0xfc, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xfc, 0xe3, 0xd0, 0x0f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x3b, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x3b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x57, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x69, 0xda, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x57, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x6b, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0x18, 0xee, 0xff, 0x49, 0xda, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x6b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x74, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x76, 0xe5, 0xff, 0x08, 0xda, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x74, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x7b, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x14, 0xe5, 0xff, 0xa7, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x7b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x7b, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfb, 0xee, 0xff, 0x8e, 0xdb, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0x7b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x7b, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0x10, 0xe4, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0x7b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x78, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x71, 0xe4, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x78, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x74, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xb3, 0xe4, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x74, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x68, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x51, 0xe4, 0xff, 0x45, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x68, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x54, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x54, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x04, 0xd1, 0x34, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x34, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0xd1, 0x08, 0x24, 0xd1, 0xf8, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xf8, 0x03, 0xd1, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xac, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x24, 0x24, 0xd1, 0xe8, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xe8, 0x04, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x17, 0x24, 0xd1, 0x80, 0x04, 0xd1, 0xc8, 0x24, 0xd1, 0xf4, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xf4, 0x04, 0xd1, 0xc8, 0x24, 0xd1, 0x80, 0x04, 0xd1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x04, 0xd1, 0x13, 0x04, 0xd1, 0x24, 0x04, 0xd1, 0x30, 0x04, 0xd1, 0x37, 0x04, 0xd1, 0x3b, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3c, 0x04, 0xd1, 0x3b, 0x04, 0xd1, 0x37, 0x04, 0xd1, 0x30, 0x04, 0xd1, 0x24, 0x04, 0xd1, 0x13, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x05, 0xe4, 0xd0, 0x17, 0x04, 0xd1, 0x33, 0x04, 0xd1, 0x47, 0x04, 0xd1, 0x50, 0x04, 0xd1, 0x57, 0x04, 0xd1, 0x5b, 0x87, 
+  0x04, 0xd1, 0x5c, 0x05, 0x04, 0xd1, 0x5b, 0x04, 0xd1, 0x57, 0x04, 0xd1, 0x50, 0x04, 0xd1, 0x44, 0x04, 0xd1, 0x33, 0x04, 0xd1, 0x17, 0x88, 0x00, 0x00, 0x00, 0x02, 0x04, 0xd1, 0x2b, 0x04, 0xd1, 
+  0xa3, 0x24, 0xd1, 0xe8, 0x93, 0x24, 0xd1, 0xff, 0x02, 0x24, 0xd1, 0xe8, 0x04, 0xd1, 0xa3, 0x04, 0xd1, 0x2b, 0x84, 0x00, 0x00, 0x00, 0x01, 0x24, 0xd1, 0x33, 0x24, 0xd1, 0xf4, 0x97, 0x24, 0xd1, 
+  0xff, 0x01, 0x24, 0xd1, 0xf4, 0x04, 0xd1, 0x33, 0x83, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0xbb, 0x99, 0x24, 0xd1, 0xff, 0x00, 0x24, 0xd1, 0xbb, 0x82, 0x00, 0x00, 0x00, 0x01, 0xe3, 0xd0, 0x0f, 
+  0x24, 0xd1, 0xfc, 0x99, 0x24, 0xd1, 0xff, 0x01, 0x24, 0xd1, 0xfc, 0xe3, 0xd0, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x3b, 0x9b, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x3b, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x04, 0xd1, 0x57, 0x8a, 0x24, 0xd1, 0xff, 0x00, 0x69, 0xda, 0xff, 0x8f, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x57, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x6b, 0x89, 0x24, 
+  0xd1, 0xff, 0x03, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0x18, 0xee, 0xff, 0x49, 0xda, 0xff, 0x8d, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x6b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x74, 0x89, 
+  0x24, 0xd1, 0xff, 0x05, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x76, 0xe5, 0xff, 0x08, 0xda, 0xff, 0x8b, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x74, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0x04, 0xd1, 0x7b, 0x89, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x5d, 0xf7, 0xff, 0x14, 0xe5, 0xff, 0xa7, 0xd1, 0xff, 0x89, 
+  0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x7b, 0x89, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xdf, 
+  0xff, 0xff, 0xfb, 0xee, 0xff, 0x8e, 0xdb, 0xff, 0x88, 0x24, 0xd1, 0xff, 0x00, 0x24, 0xd1, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x7b, 0x89, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 
+  0x5d, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xfc, 0xfe, 0xff, 0x10, 0xe4, 0xff, 0x89, 0x24, 0xd1, 0xff, 0x00, 0x24, 0xd1, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x78, 0x89, 0x24, 
+  0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x5d, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0x3c, 0xff, 0xff, 0x71, 0xe4, 0xff, 0x8b, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x78, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xd1, 0x74, 0x89, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xff, 0x81, 0x5d, 0xff, 0xff, 0x00, 0xb3, 0xe4, 0xff, 0x8d, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x74, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xd1, 0x68, 0x89, 0x24, 0xd1, 0xff, 0x02, 0x04, 0xd1, 0xff, 0x51, 0xe4, 0xff, 0x45, 0xd1, 0xff, 0x8e, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x68, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 
+  0xd1, 0x54, 0x9b, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x54, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x34, 0x9b, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x34, 0x81, 0x00, 0x00, 0x00, 0x01, 0x03, 
+  0xd1, 0x08, 0x24, 0xd1, 0xf8, 0x99, 0x24, 0xd1, 0xff, 0x01, 0x24, 0xd1, 0xf8, 0x03, 0xd1, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xac, 0x99, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xac, 
+  0x83, 0x00, 0x00, 0x00, 0x01, 0x04, 0xd1, 0x24, 0x24, 0xd1, 0xe8, 0x97, 0x24, 0xd1, 0xff, 0x01, 0x24, 0xd1, 0xe8, 0x04, 0xd1, 0x24, 0x84, 0x00, 0x00, 0x00, 0x03, 0x04, 0xd1, 0x17, 0x24, 0xd1, 
+  0x80, 0x04, 0xd1, 0xc8, 0x24, 0xd1, 0xf4, 0x91, 0x24, 0xd1, 0xff, 0x03, 0x24, 0xd1, 0xf4, 0x04, 0xd1, 0xc8, 0x24, 0xd1, 0x80, 0x04, 0xd1, 0x17, 0x89, 0x00, 0x00, 0x00, 0x04, 0x04, 0xd1, 0x13, 
+  0x04, 0xd1, 0x24, 0x04, 0xd1, 0x30, 0x04, 0xd1, 0x37, 0x04, 0xd1, 0x3b, 0x87, 0x04, 0xd1, 0x3c, 0x04, 0x04, 0xd1, 0x3b, 0x04, 0xd1, 0x37, 0x04, 0xd1, 0x30, 0x04, 0xd1, 0x24, 0x04, 0xd1, 0x13, 
+  0xff, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xd0, 0xe4, 0x17, 0xd1, 0x04, 0x33, 0xd1, 0x04, 0x47, 0xd1, 0x04, 0x50, 0xd1, 0x04, 0x57, 0xd1, 0x04, 0x5b, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x5b, 0xd1, 0x04, 0x57, 0xd1, 0x04, 0x50, 0xd1, 0x04, 0x44, 0xd1, 0x04, 0x33, 0xd1, 0x04, 0x17, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x2b, 0xd1, 0x04, 0xa3, 0xd1, 0x24, 0xe8, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xe8, 0xd1, 0x04, 0xa3, 0xd1, 0x04, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x33, 0xd1, 0x24, 0xf4, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xf4, 0xd1, 0x04, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0xbb, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd0, 0xe3, 0x0f, 0xd1, 0x24, 0xfc, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xfc, 0xd0, 0xe3, 0x0f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x3b, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x3b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x57, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xda, 0x69, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x57, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x6b, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xee, 0x18, 0xff, 0xda, 0x49, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x6b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x74, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xe5, 0x76, 0xff, 0xda, 0x08, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x74, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x7b, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5d, 0xff, 0xe5, 0x14, 0xff, 0xd1, 0xa7, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x7b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x7b, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xee, 0xfb, 0xff, 0xdb, 0x8e, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0x7b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x7b, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xe4, 0x10, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0x7b, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x78, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xe4, 0x71, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x78, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x74, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xff, 0x5d, 0xff, 0xe4, 0xb3, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x74, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x68, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xe4, 0x51, 0xff, 0xd1, 0x45, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x68, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x54, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x54, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x04, 0x34, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x34, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd1, 0x03, 0x08, 0xd1, 0x24, 0xf8, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xf8, 0xd1, 0x03, 0x08, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xac, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x24, 0xd1, 0x24, 0xe8, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xe8, 0xd1, 0x04, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x17, 0xd1, 0x24, 0x80, 0xd1, 0x04, 0xc8, 0xd1, 0x24, 0xf4, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xf4, 0xd1, 0x04, 0xc8, 0xd1, 0x24, 0x80, 0xd1, 0x04, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xd1, 0x04, 0x13, 0xd1, 0x04, 0x24, 0xd1, 0x04, 0x30, 0xd1, 0x04, 0x37, 0xd1, 0x04, 0x3b, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3c, 0xd1, 0x04, 0x3b, 0xd1, 0x04, 0x37, 0xd1, 0x04, 0x30, 0xd1, 0x04, 0x24, 0xd1, 0x04, 0x13, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x05, 0xd0, 0xe4, 0x17, 0xd1, 0x04, 0x33, 0xd1, 0x04, 0x47, 0xd1, 0x04, 0x50, 0xd1, 0x04, 0x57, 0xd1, 0x04, 0x5b, 0x87, 
+  0xd1, 0x04, 0x5c, 0x05, 0xd1, 0x04, 0x5b, 0xd1, 0x04, 0x57, 0xd1, 0x04, 0x50, 0xd1, 0x04, 0x44, 0xd1, 0x04, 0x33, 0xd1, 0x04, 0x17, 0x88, 0x00, 0x00, 0x00, 0x02, 0xd1, 0x04, 0x2b, 0xd1, 0x04, 
+  0xa3, 0xd1, 0x24, 0xe8, 0x93, 0xd1, 0x24, 0xff, 0x02, 0xd1, 0x24, 0xe8, 0xd1, 0x04, 0xa3, 0xd1, 0x04, 0x2b, 0x84, 0x00, 0x00, 0x00, 0x01, 0xd1, 0x24, 0x33, 0xd1, 0x24, 0xf4, 0x97, 0xd1, 0x24, 
+  0xff, 0x01, 0xd1, 0x24, 0xf4, 0xd1, 0x04, 0x33, 0x83, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0xbb, 0x99, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x24, 0xbb, 0x82, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xe3, 0x0f, 
+  0xd1, 0x24, 0xfc, 0x99, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x24, 0xfc, 0xd0, 0xe3, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x3b, 0x9b, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x3b, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0xd1, 0x04, 0x57, 0x8a, 0xd1, 0x24, 0xff, 0x00, 0xda, 0x69, 0xff, 0x8f, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x57, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x6b, 0x89, 0xd1, 
+  0x24, 0xff, 0x03, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xee, 0x18, 0xff, 0xda, 0x49, 0xff, 0x8d, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x6b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x74, 0x89, 
+  0xd1, 0x24, 0xff, 0x05, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xe5, 0x76, 0xff, 0xda, 0x08, 0xff, 0x8b, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x74, 0x81, 0x00, 
+  0x00, 0x00, 0x00, 0xd1, 0x04, 0x7b, 0x89, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xf7, 0x5d, 0xff, 0xe5, 0x14, 0xff, 0xd1, 0xa7, 0xff, 0x89, 
+  0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x7b, 0x89, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0x83, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xdf, 0xff, 0xee, 0xfb, 0xff, 0xdb, 0x8e, 0xff, 0x88, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x24, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x7b, 0x89, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 
+  0xff, 0x5d, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfc, 0xff, 0xe4, 0x10, 0xff, 0x89, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x24, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x78, 0x89, 0xd1, 
+  0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xff, 0x5d, 0xff, 0x81, 0xff, 0xff, 0xff, 0x01, 0xff, 0x3c, 0xff, 0xe4, 0x71, 0xff, 0x8b, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x78, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0xd1, 0x04, 0x74, 0x89, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xff, 0x81, 0xff, 0x5d, 0xff, 0x00, 0xe4, 0xb3, 0xff, 0x8d, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x74, 0x81, 0x00, 0x00, 0x00, 
+  0x00, 0xd1, 0x04, 0x68, 0x89, 0xd1, 0x24, 0xff, 0x02, 0xd1, 0x04, 0xff, 0xe4, 0x51, 0xff, 0xd1, 0x45, 0xff, 0x8e, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x68, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 
+  0x04, 0x54, 0x9b, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x54, 0x81, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x34, 0x9b, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x34, 0x81, 0x00, 0x00, 0x00, 0x01, 0xd1, 
+  0x03, 0x08, 0xd1, 0x24, 0xf8, 0x99, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x24, 0xf8, 0xd1, 0x03, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xac, 0x99, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xac, 
+  0x83, 0x00, 0x00, 0x00, 0x01, 0xd1, 0x04, 0x24, 0xd1, 0x24, 0xe8, 0x97, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x24, 0xe8, 0xd1, 0x04, 0x24, 0x84, 0x00, 0x00, 0x00, 0x03, 0xd1, 0x04, 0x17, 0xd1, 0x24, 
+  0x80, 0xd1, 0x04, 0xc8, 0xd1, 0x24, 0xf4, 0x91, 0xd1, 0x24, 0xff, 0x03, 0xd1, 0x24, 0xf4, 0xd1, 0x04, 0xc8, 0xd1, 0x24, 0x80, 0xd1, 0x04, 0x17, 0x89, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x04, 0x13, 
+  0xd1, 0x04, 0x24, 0xd1, 0x04, 0x30, 0xd1, 0x04, 0x37, 0xd1, 0x04, 0x3b, 0x87, 0xd1, 0x04, 0x3c, 0x04, 0xd1, 0x04, 0x3b, 0xd1, 0x04, 0x37, 0xd1, 0x04, 0x30, 0xd1, 0x04, 0x24, 0xd1, 0x04, 0x13, 
+  0xff, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x1e, 0x1e, 0xd2, 0x17, 0x22, 0x22, 0xd3, 0x33, 0x21, 0x22, 0xd3, 0x47, 0x21, 0x21, 0xd2, 0x50, 0x21, 0x22, 0xd3, 0x57, 0x21, 0x22, 0xd3, 0x5b, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5c, 0x21, 0x22, 0xd2, 0x5b, 0x21, 0x22, 0xd2, 0x57, 0x21, 0x22, 0xd3, 0x50, 0x21, 0x22, 0xd3, 0x44, 0x20, 0x22, 0xd1, 0x33, 0x1f, 0x1f, 0xd2, 0x17, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd2, 0x2b, 0x21, 0x22, 0xd3, 0xa3, 0x22, 0x23, 0xd3, 0xe8, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xe8, 0x21, 0x22, 0xd3, 0xa3, 0x20, 0x22, 0xd2, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x23, 0xd3, 0x33, 0x22, 0x23, 0xd3, 0xf4, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xf4, 0x20, 0x22, 0xd2, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0xd3, 0xbb, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0xd1, 0x0f, 0x22, 0x23, 0xd3, 0xfc, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xfc, 0x1c, 0x1c, 0xd1, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd2, 0x3b, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x22, 0xd2, 0x3b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd2, 0x57, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x4a, 0x4b, 0xd8, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x22, 0xd2, 0x57, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x6b, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0xe6, 0xe7, 0xf9, 0xff, 0xc0, 0xc0, 0xeb, 0xff, 0x4a, 0x4a, 0xd6, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0x6b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x74, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf9, 0xff, 0xae, 0xae, 0xe3, 0xff, 0x3f, 0x3f, 0xd5, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0x74, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x7b, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xe8, 0xe8, 0xf1, 0xff, 0xa0, 0xa0, 0xde, 0xff, 0x35, 0x36, 0xd4, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0x7b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x7b, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf9, 0xff, 0xdb, 0xdb, 0xea, 0xff, 0x71, 0x72, 0xd9, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd2, 0x7b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x7b, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xde, 0xf7, 0xff, 0x82, 0x82, 0xe0, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd2, 0x7b, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x78, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xe4, 0xf8, 0xff, 0x8c, 0x8c, 0xe2, 0xff, 0x23, 0x24, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0x78, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x74, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xe8, 0xe8, 0xf9, 0xff, 0x95, 0x95, 0xe4, 0xff, 0x24, 0x25, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0x74, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x68, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0x88, 0x88, 0xe2, 0xff, 0x27, 0x28, 0xd4, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0x68, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x54, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0x54, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0xd2, 0x34, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0x34, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1c, 0x22, 0xd1, 0x08, 0x22, 0x23, 0xd3, 0xf8, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xf8, 0x1c, 0x22, 0xd1, 0x08, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xac, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xd1, 0x24, 0x22, 0x23, 0xd3, 0xe8, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xe8, 0x20, 0x20, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd1, 0x17, 0x21, 0x23, 0xd3, 0x80, 0x21, 0x22, 0xd3, 0xc8, 0x22, 0x23, 0xd3, 0xf4, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xf4, 0x21, 0x22, 0xd3, 0xc8, 0x21, 0x23, 0xd3, 0x80, 0x22, 0x22, 0xd1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x1f, 0x1f, 0xd1, 0x13, 0x1f, 0x22, 0xd3, 0x24, 0x21, 0x21, 0xd1, 0x30, 0x20, 0x22, 0xd3, 0x37, 0x20, 0x22, 0xd1, 0x3b, 0x22, 0x22, 0xd2, 0x3c, 0x22, 0x22, 0xd2, 0x3c, 0x22, 0x22, 0xd2, 0x3c, 0x21, 0x21, 0xd3, 0x3c, 0x21, 0x21, 0xd3, 0x3c, 0x22, 0x22, 0xd3, 0x3c, 0x21, 0x22, 0xd2, 0x3c, 0x22, 0x22, 0xd2, 0x3c, 0x21, 0x22, 0xd3, 0x3b, 0x20, 0x22, 0xd3, 0x37, 0x21, 0x21, 0xd3, 0x30, 0x1f, 0x21, 0xd2, 0x24, 0x20, 0x20, 0xd3, 0x13, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1e, 0x1e, 0xd2, 0x17, 0x22, 0x22, 0xd3, 0x33, 0x21, 0x22, 0xd3, 0x47, 0x21, 0x21, 0xd2, 0x50, 0x21, 
+  0x22, 0xd3, 0x57, 0x21, 0x22, 0xd3, 0x5b, 0x87, 0x21, 0x22, 0xd2, 0x5c, 0x05, 0x21, 0x22, 0xd2, 0x5b, 0x21, 0x22, 0xd2, 0x57, 0x21, 0x22, 0xd3, 0x50, 0x21, 0x22, 0xd3, 0x44, 0x20, 0x22, 0xd1, 
+  0x33, 0x1f, 0x1f, 0xd2, 0x17, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x22, 0xd2, 0x2b, 0x21, 0x22, 0xd3, 0xa3, 0x22, 0x23, 0xd3, 0xe8, 0x93, 0x22, 0x23, 0xd3, 0xff, 0x02, 0x22, 0x23, 0xd3, 
+  0xe8, 0x21, 0x22, 0xd3, 0xa3, 0x20, 0x22, 0xd2, 0x2b, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x23, 0xd3, 0x33, 0x22, 0x23, 0xd3, 0xf4, 0x97, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x22, 0x23, 0xd3, 
+  0xf4, 0x20, 0x22, 0xd2, 0x33, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0xd3, 0xbb, 0x99, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x23, 0xd3, 0xbb, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 
+  0x1c, 0xd1, 0x0f, 0x22, 0x23, 0xd3, 0xfc, 0x99, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x22, 0x23, 0xd3, 0xfc, 0x1c, 0x1c, 0xd1, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd2, 0x3b, 0x9b, 
+  0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x22, 0xd2, 0x3b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd2, 0x57, 0x8a, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x4a, 0x4b, 0xd8, 0xff, 0x8f, 0x22, 0x23, 
+  0xd3, 0xff, 0x00, 0x20, 0x22, 0xd2, 0x57, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x6b, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x03, 0x21, 0x22, 0xd3, 0xff, 0xe6, 0xe7, 0xf9, 0xff, 0xc0, 
+  0xc0, 0xeb, 0xff, 0x4a, 0x4a, 0xd6, 0xff, 0x8d, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0x6b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x74, 0x89, 0x22, 0x23, 0xd3, 0xff, 
+  0x05, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xf9, 0xff, 0xae, 0xae, 0xe3, 0xff, 0x3f, 0x3f, 0xd5, 0xff, 0x8b, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 
+  0x22, 0xd2, 0x74, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x7b, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 
+  0x03, 0xfe, 0xfe, 0xfe, 0xff, 0xe8, 0xe8, 0xf1, 0xff, 0xa0, 0xa0, 0xde, 0xff, 0x35, 0x36, 0xd4, 0xff, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x21, 0x22, 0xd2, 0x7b, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf8, 0xf8, 0xf9, 0xff, 0xdb, 0xdb, 0xea, 
+  0xff, 0x71, 0x72, 0xd9, 0xff, 0x88, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x23, 0xd2, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0x7b, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 
+  0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0xde, 0xde, 0xf7, 0xff, 0x82, 0x82, 0xe0, 0xff, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x23, 0xd2, 0x7b, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x78, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe3, 0xe4, 0xf8, 
+  0xff, 0x8c, 0x8c, 0xe2, 0xff, 0x23, 0x24, 0xd3, 0xff, 0x8a, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0x78, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x74, 0x89, 0x22, 0x23, 
+  0xd3, 0xff, 0x04, 0x21, 0x22, 0xd3, 0xff, 0xe9, 0xe9, 0xfa, 0xff, 0xe8, 0xe8, 0xf9, 0xff, 0x95, 0x95, 0xe4, 0xff, 0x24, 0x25, 0xd3, 0xff, 0x8c, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 
+  0x74, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x68, 0x89, 0x22, 0x23, 0xd3, 0xff, 0x02, 0x21, 0x22, 0xd3, 0xff, 0x88, 0x88, 0xe2, 0xff, 0x27, 0x28, 0xd4, 0xff, 0x8e, 0x22, 0x23, 
+  0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0x68, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0x54, 0x9b, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0x54, 0x81, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x20, 0x21, 0xd2, 0x34, 0x9b, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x20, 0x21, 0xd2, 0x34, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x22, 0xd1, 0x08, 0x22, 0x23, 0xd3, 0xf8, 0x99, 0x22, 0x23, 
+  0xd3, 0xff, 0x01, 0x22, 0x23, 0xd3, 0xf8, 0x1c, 0x22, 0xd1, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xac, 0x99, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xac, 0x83, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x20, 0xd1, 0x24, 0x22, 0x23, 0xd3, 0xe8, 0x97, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x22, 0x23, 0xd3, 0xe8, 0x20, 0x20, 0xd1, 0x24, 0x84, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0x22, 0x22, 0xd1, 0x17, 0x21, 0x23, 0xd3, 0x80, 0x21, 0x22, 0xd3, 0xc8, 0x22, 0x23, 0xd3, 0xf4, 0x91, 0x22, 0x23, 0xd3, 0xff, 0x03, 0x22, 0x23, 0xd3, 0xf4, 0x21, 0x22, 0xd3, 0xc8, 0x21, 
+  0x23, 0xd3, 0x80, 0x22, 0x22, 0xd1, 0x17, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x1f, 0xd1, 0x13, 0x1f, 0x22, 0xd3, 0x24, 0x21, 0x21, 0xd1, 0x30, 0x20, 0x22, 0xd3, 0x37, 0x20, 0x22, 0xd1, 
+  0x3b, 0x82, 0x22, 0x22, 0xd2, 0x3c, 0x81, 0x21, 0x21, 0xd3, 0x3c, 0x07, 0x22, 0x22, 0xd3, 0x3c, 0x21, 0x22, 0xd2, 0x3c, 0x22, 0x22, 0xd2, 0x3c, 0x21, 0x22, 0xd3, 0x3b, 0x20, 0x22, 0xd3, 0x37, 
+  0x21, 0x21, 0xd3, 0x30, 0x1f, 0x21, 0xd2, 0x24, 0x20, 0x20, 0xd3, 0x13, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -154,8 +110,7 @@ const lv_img_dsc_t youtube_32px = {
   .header.always_zero = 0,
   .header.w = 32,
   .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( youtube_32px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = youtube_32px_map,
 };
-
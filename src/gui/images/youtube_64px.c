@@ -10,271 +10,190 @@
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_YOUTUBE_64PX uint8_t youtube_64px_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xe4, 0x1c, 0xe4, 0x3f, 0xe5, 0x5c, 0xe5, 0x70, 0xe4, 0x84, 0xe5, 0x93, 0xe4, 0x9c, 0xe5, 0xa7, 0xe5, 0xac, 0xe5, 0xb0, 0xe4, 0xb4, 0xe5, 0xb7, 0xe5, 0xb7, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb8, 0xe5, 0xb7, 0xe5, 0xb7, 0xe4, 0xb4, 0xe5, 0xb0, 0xe5, 0xac, 0xe5, 0xa4, 0xe4, 0x9c, 0xe5, 0x93, 0xe5, 0x83, 0xe4, 0x70, 0xe5, 0x5b, 0xe4, 0x3f, 0xe4, 0x1c, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x1c, 0xe5, 0x73, 0xe5, 0xb8, 0xe5, 0xef, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xec, 0xe5, 0xb8, 0xe5, 0x73, 0xe4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x10, 0xe4, 0x9c, 0xe5, 0xfb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xfb, 0xe4, 0x9c, 0xc4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x17, 0xe5, 0xd7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xd7, 0xc4, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xb7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x43, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xab, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xe5, 0xf0, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf0, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x33, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x60, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x87, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xa3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xbb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xcf, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xdb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xec, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xed, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe4, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xf0, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xeb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xd7, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xc8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xb4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x9c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x7c, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x57, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xc4, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x24, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x90, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x27, 0xe5, 0xfb, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xfb, 0xe4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x8b, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0xe5, 0xa4, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xa4, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x5b, 0xe5, 0xd3, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xd3, 0xe5, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x30, 0xe4, 0x77, 0xe5, 0xaf, 0xe5, 0xdb, 0xe5, 0xf8, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xf7, 0xe5, 0xdb, 0xe5, 0xac, 0xe4, 0x77, 0xe4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x04, 0xc4, 0x1b, 0xe4, 0x2f, 0xe4, 0x43, 0xe4, 0x50, 0xe5, 0x5b, 0xe5, 0x64, 0xe5, 0x6b, 0xe4, 0x6f, 0xe5, 0x73, 0xe4, 0x74, 0xe5, 0x77, 0xe5, 0x77, 0xe5, 0x78, 0xe5, 0x78, 0xe5, 0x78, 0xe5, 0x78, 0xe5, 0x7b, 0xe5, 0x7b, 0xe5, 0x7b, 0xe5, 0x7b, 0xe5, 0x78, 0xe5, 0x78, 0xe5, 0x78, 0xe4, 0x78, 0xe5, 0x77, 0xe5, 0x77, 0xe4, 0x74, 0xe5, 0x73, 0xe4, 0x6f, 0xe5, 0x6b, 0xe5, 0x63, 0xe5, 0x5b, 0xe4, 0x50, 0xe4, 0x40, 0xe5, 0x2f, 0xe4, 0x18, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xca, 0x00, 0x00, 0x0b, 0x80, 0x03, 0xe4, 0x1c, 0xe4, 0x3f, 0xe5, 0x5c, 0xe5, 
+  0x70, 0xe4, 0x84, 0xe5, 0x93, 0xe4, 0x9c, 0xe5, 0xa7, 0xe5, 0xac, 0xe5, 0xb0, 0xe4, 0xb4, 0x81, 0xe5, 0xb7, 0x8d, 0xe5, 0xb8, 0x81, 0xe5, 0xb7, 0x0a, 0xe4, 0xb4, 0xe5, 0xb0, 0xe5, 0xac, 0xe5, 
+  0xa4, 0xe4, 0x9c, 0xe5, 0x93, 0xe5, 0x83, 0xe4, 0x70, 0xe5, 0x5b, 0xe4, 0x3f, 0xe4, 0x1c, 0x93, 0x00, 0x00, 0x03, 0xe4, 0x1c, 0xe5, 0x73, 0xe5, 0xb8, 0xe5, 0xef, 0xa7, 0xe5, 0xff, 0x03, 0xe5, 
+  0xec, 0xe5, 0xb8, 0xe5, 0x73, 0xe4, 0x1c, 0x8d, 0x00, 0x00, 0x02, 0xc4, 0x10, 0xe4, 0x9c, 0xe5, 0xfb, 0xad, 0xe5, 0xff, 0x02, 0xe5, 0xfb, 0xe4, 0x9c, 0xc4, 0x10, 0x8a, 0x00, 0x00, 0x01, 0xc4, 
+  0x17, 0xe5, 0xd7, 0xb1, 0xe5, 0xff, 0x01, 0xe5, 0xd7, 0xc4, 0x17, 0x89, 0x00, 0x00, 0x00, 0xe5, 0xb7, 0xb3, 0xe5, 0xff, 0x00, 0xe5, 0xb7, 0x88, 0x00, 0x00, 0x00, 0xe5, 0x43, 0xb5, 0xe5, 0xff, 
+  0x00, 0xe5, 0x43, 0x87, 0x00, 0x00, 0x00, 0xe5, 0xab, 0xb5, 0xe5, 0xff, 0x00, 0xe5, 0xab, 0x86, 0x00, 0x00, 0x01, 0xc0, 0x04, 0xe5, 0xf0, 0xb5, 0xe5, 0xff, 0x01, 0xe5, 0xf0, 0xc0, 0x04, 0x85, 
+  0x00, 0x00, 0x00, 0xe4, 0x33, 0xb7, 0xe5, 0xff, 0x00, 0xe4, 0x33, 0x85, 0x00, 0x00, 0x00, 0xe5, 0x60, 0xb7, 0xe5, 0xff, 0x00, 0xe5, 0x60, 0x85, 0x00, 0x00, 0x00, 0xe5, 0x87, 0xb7, 0xe5, 0xff, 
+  0x00, 0xe5, 0x87, 0x85, 0x00, 0x00, 0x00, 0xe4, 0xa3, 0xb7, 0xe5, 0xff, 0x00, 0xe4, 0xa3, 0x85, 0x00, 0x00, 0x00, 0xe4, 0xbb, 0x94, 0xe5, 0xff, 0x02, 0xe4, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0x9f, 
+  0xe5, 0xff, 0x00, 0xe4, 0xbb, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xcf, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x81, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x9e, 0xe5, 0xff, 0x00, 0xe5, 0xcf, 0x85, 0x00, 0x00, 
+  0x00, 0xe5, 0xdb, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x83, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x9c, 0xe5, 0xff, 0x00, 0xe5, 0xdb, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xe4, 0x94, 0xe5, 0xff, 0x00, 0xe4, 
+  0xff, 0x85, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x9a, 0xe5, 0xff, 0x00, 0xe5, 0xe4, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xec, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x86, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 
+  0xff, 0x98, 0xe5, 0xff, 0x00, 0xe5, 0xec, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xf3, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x88, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 0xff, 0x96, 0xe5, 0xff, 0x00, 0xe5, 
+  0xf3, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xf4, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x8a, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xed, 0xff, 0x94, 0xe5, 0xff, 0x00, 0xe5, 0xf4, 0x85, 0x00, 0x00, 0x00, 0xe5, 
+  0xf7, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x8c, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xe9, 0xff, 0xe4, 0xff, 0x91, 0xe5, 0xff, 0x00, 0xe5, 0xf7, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xf7, 0x94, 0xe5, 0xff, 
+  0x00, 0xe4, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xe9, 0xff, 0x91, 0xe5, 0xff, 0x00, 0xe5, 0xf7, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xf7, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x8c, 0xff, 0xff, 
+  0x00, 0xee, 0xff, 0x93, 0xe5, 0xff, 0x00, 0xe5, 0xf7, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xf7, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x95, 0xe5, 0xff, 0x00, 0xe5, 
+  0xf7, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xf4, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x88, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x97, 0xe5, 0xff, 0x00, 0xe5, 0xf4, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xf0, 0x94, 
+  0xe5, 0xff, 0x00, 0xe4, 0xff, 0x86, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x99, 0xe5, 0xff, 0x00, 0xe5, 0xf0, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xeb, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x84, 0xff, 0xff, 
+  0x00, 0xf2, 0xff, 0x9b, 0xe5, 0xff, 0x00, 0xe5, 0xeb, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xe3, 0x94, 0xe5, 0xff, 0x00, 0xe4, 0xff, 0x82, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x9d, 0xe5, 0xff, 0x00, 0xe5, 
+  0xe3, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xd7, 0x94, 0xe5, 0xff, 0x03, 0xe4, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0x9e, 0xe5, 0xff, 0x00, 0xe5, 0xd7, 0x85, 0x00, 0x00, 0x00, 0xe4, 0xc8, 0xb7, 
+  0xe5, 0xff, 0x00, 0xe4, 0xc8, 0x85, 0x00, 0x00, 0x00, 0xe5, 0xb4, 0xb7, 0xe5, 0xff, 0x00, 0xe5, 0xb4, 0x85, 0x00, 0x00, 0x00, 0xe4, 0x9c, 0xb7, 0xe5, 0xff, 0x00, 0xe4, 0x9c, 0x85, 0x00, 0x00, 
+  0x00, 0xe4, 0x7c, 0xb7, 0xe5, 0xff, 0x00, 0xe4, 0x7c, 0x85, 0x00, 0x00, 0x00, 0xc4, 0x57, 0xb7, 0xe5, 0xff, 0x00, 0xc4, 0x57, 0x85, 0x00, 0x00, 0x00, 0xe4, 0x24, 0xb7, 0xe5, 0xff, 0x00, 0xe4, 
+  0x24, 0x86, 0x00, 0x00, 0x00, 0xe5, 0xe3, 0xb5, 0xe5, 0xff, 0x00, 0xe5, 0xe3, 0x87, 0x00, 0x00, 0x00, 0xe5, 0x90, 0xb5, 0xe5, 0xff, 0x00, 0xe5, 0x90, 0x87, 0x00, 0x00, 0x01, 0xe4, 0x27, 0xe5, 
+  0xfb, 0xb3, 0xe5, 0xff, 0x01, 0xe5, 0xfb, 0xe4, 0x27, 0x88, 0x00, 0x00, 0x00, 0xe5, 0x8b, 0xb3, 0xe5, 0xff, 0x00, 0xe5, 0x8b, 0x89, 0x00, 0x00, 0x01, 0xc0, 0x04, 0xe5, 0xa4, 0xb1, 0xe5, 0xff, 
+  0x01, 0xe5, 0xa4, 0xc0, 0x04, 0x8b, 0x00, 0x00, 0x01, 0xe5, 0x5b, 0xe5, 0xd3, 0xad, 0xe5, 0xff, 0x01, 0xe5, 0xd3, 0xe5, 0x5b, 0x8f, 0x00, 0x00, 0x04, 0xc4, 0x30, 0xe4, 0x77, 0xe5, 0xaf, 0xe5, 
+  0xdb, 0xe5, 0xf8, 0xa3, 0xe5, 0xff, 0x04, 0xe5, 0xf7, 0xe5, 0xdb, 0xe5, 0xac, 0xe4, 0x77, 0xe4, 0x30, 0x95, 0x00, 0x00, 0x0a, 0xe0, 0x04, 0xc4, 0x1b, 0xe4, 0x2f, 0xe4, 0x43, 0xe4, 0x50, 0xe5, 
+  0x5b, 0xe5, 0x64, 0xe5, 0x6b, 0xe4, 0x6f, 0xe5, 0x73, 0xe4, 0x74, 0x81, 0xe5, 0x77, 0x83, 0xe5, 0x78, 0x83, 0xe5, 0x7b, 0x82, 0xe5, 0x78, 0x00, 0xe4, 0x78, 0x81, 0xe5, 0x77, 0x0a, 0xe4, 0x74, 
+  0xe5, 0x73, 0xe4, 0x6f, 0xe5, 0x6b, 0xe5, 0x63, 0xe5, 0x5b, 0xe4, 0x50, 0xe4, 0x40, 0xe5, 0x2f, 0xe4, 0x18, 0xc0, 0x04, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0xff, 0x00, 0x00, 0xcc, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xc3, 0xd0, 0x1c, 0x04, 0xd1, 0x3f, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x70, 0x04, 0xd1, 0x84, 0x04, 0xd1, 0x93, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0xa7, 0x04, 0xd1, 0xac, 0x04, 0xd1, 0xb0, 0x04, 0xd1, 0xb4, 0x04, 0xd1, 0xb7, 0x04, 0xd1, 0xb7, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xb7, 0x04, 0xd1, 0xb7, 0x04, 0xd1, 0xb4, 0x04, 0xd1, 0xb0, 0x04, 0xd1, 0xac, 0x04, 0xd1, 0xa4, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0x93, 0x24, 0xd1, 0x83, 0x04, 0xd1, 0x70, 0x04, 0xd1, 0x5b, 0x04, 0xd1, 0x3f, 0xe3, 0xd0, 0x1c, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xd0, 0x1c, 0x04, 0xd1, 0x73, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xef, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xec, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0x73, 0xe3, 0xd0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x10, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0xfb, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xfb, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd1, 0x17, 0x04, 0xd1, 0xd7, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xd7, 0x03, 0xd1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0xb7, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x43, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xab, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x04, 0xd1, 0xf0, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xf0, 0x00, 0xc8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xd0, 0x33, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0xe4, 0xd0, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x60, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x87, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xa3, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xbb, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x10, 0xe4, 0xff, 0xa7, 0xd9, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xcf, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xbe, 0xff, 0xff, 0x92, 0xe4, 0xff, 0x86, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xdb, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x10, 0xe4, 0xff, 0x45, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xe4, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdb, 0xee, 0xff, 0xaf, 0xdb, 0xff, 0x25, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xec, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x7a, 0xee, 0xff, 0x6d, 0xdb, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf3, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x39, 0xe6, 0xff, 0x0c, 0xdb, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf4, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x1c, 0xef, 0xff, 0xf8, 0xe5, 0xff, 0xcb, 0xda, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf7, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x1c, 0xef, 0xff, 0xb6, 0xe5, 0xff, 0x8a, 0xda, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf7, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x1c, 0xef, 0xff, 0x18, 0xe6, 0xff, 0xe8, 0xd9, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf7, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0x4d, 0xe3, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf7, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xae, 0xe3, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf4, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xef, 0xe3, 0xff, 0x25, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf0, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0x30, 0xec, 0xff, 0x45, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xeb, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0x72, 0xec, 0xff, 0x65, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xe3, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xb3, 0xec, 0xff, 0x86, 0xd9, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xd7, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x79, 0xf6, 0xff, 0x14, 0xed, 0xff, 0xa6, 0xd9, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xc8, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x66, 0xd9, 0xff, 0x04, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xb4, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x9c, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x7c, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x57, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xd1, 0x24, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x23, 0xd1, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xe3, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x90, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x27, 0x04, 0xd1, 0xfb, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xfb, 0x04, 0xd1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x8b, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x04, 0xd1, 0xa4, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x04, 0xd1, 0xa4, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x5b, 0x24, 0xd1, 0xd3, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xd3, 0x04, 0xd1, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x30, 0x04, 0xd1, 0x77, 0x04, 0xd1, 0xaf, 0x24, 0xd1, 0xdb, 0x04, 0xd1, 0xf8, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xff, 0x24, 0xd1, 0xf7, 0x04, 0xd1, 0xdb, 0x04, 0xd1, 0xac, 0x04, 0xd1, 0x77, 0x04, 0xd1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x04, 0xe4, 0xd0, 0x1b, 0x04, 0xd1, 0x2f, 0x04, 0xd1, 0x43, 0x04, 0xd1, 0x50, 0x04, 0xd1, 0x5b, 0x04, 0xd1, 0x64, 0x04, 0xd1, 0x6b, 0x04, 0xd1, 0x6f, 0x04, 0xd1, 0x73, 0x04, 0xd1, 0x74, 0x04, 0xd1, 0x77, 0x04, 0xd1, 0x77, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x7b, 0x04, 0xd1, 0x7b, 0x04, 0xd1, 0x7b, 0x04, 0xd1, 0x7b, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x78, 0x04, 0xd1, 0x77, 0x04, 0xd1, 0x77, 0x24, 0xd1, 0x74, 0x04, 0xd1, 0x73, 0x04, 0xd1, 0x6f, 0x04, 0xd1, 0x6b, 0x04, 0xd1, 0x63, 0x04, 0xd1, 0x5b, 0x24, 0xd1, 0x50, 0x04, 0xd1, 0x40, 0x04, 0xd1, 0x2f, 0xe4, 0xd8, 0x18, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x80, 0x03, 
+  0xc3, 0xd0, 0x1c, 0x04, 0xd1, 0x3f, 0x04, 0xd1, 0x5c, 0x04, 0xd1, 0x70, 0x04, 0xd1, 0x84, 0x04, 0xd1, 0x93, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0xa7, 0x04, 0xd1, 0xac, 0x04, 0xd1, 0xb0, 0x04, 0xd1, 
+  0xb4, 0x81, 0x04, 0xd1, 0xb7, 0x8d, 0x04, 0xd1, 0xb8, 0x81, 0x04, 0xd1, 0xb7, 0x0a, 0x04, 0xd1, 0xb4, 0x04, 0xd1, 0xb0, 0x04, 0xd1, 0xac, 0x04, 0xd1, 0xa4, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0x93, 
+  0x24, 0xd1, 0x83, 0x04, 0xd1, 0x70, 0x04, 0xd1, 0x5b, 0x04, 0xd1, 0x3f, 0xe3, 0xd0, 0x1c, 0x93, 0x00, 0x00, 0x00, 0x03, 0xe3, 0xd0, 0x1c, 0x04, 0xd1, 0x73, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0xef, 
+  0xa7, 0x24, 0xd1, 0xff, 0x03, 0x04, 0xd1, 0xec, 0x04, 0xd1, 0xb8, 0x04, 0xd1, 0x73, 0xe3, 0xd0, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x02, 0x04, 0xd1, 0x10, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0xfb, 0xad, 
+  0x24, 0xd1, 0xff, 0x02, 0x04, 0xd1, 0xfb, 0x04, 0xd1, 0x9c, 0x04, 0xd1, 0x10, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x03, 0xd1, 0x17, 0x04, 0xd1, 0xd7, 0xb1, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xd7, 
+  0x03, 0xd1, 0x17, 0x89, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd1, 0xb7, 0xb3, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xb7, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x43, 0xb5, 0x24, 0xd1, 0xff, 0x00, 
+  0x04, 0xd1, 0x43, 0x87, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xab, 0xb5, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xab, 0x86, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8, 0x04, 0x04, 0xd1, 0xf0, 0xb5, 0x24, 
+  0xd1, 0xff, 0x01, 0x04, 0xd1, 0xf0, 0x00, 0xc8, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xd0, 0x33, 0xb7, 0x24, 0xd1, 0xff, 0x00, 0xe4, 0xd0, 0x33, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 
+  0x60, 0xb7, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x60, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x87, 0xb7, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x87, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 
+  0xa3, 0x95, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xff, 0xa0, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xa3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xbb, 0x94, 0x24, 0xd1, 0xff, 0x03, 0x04, 0xd1, 
+  0xff, 0x10, 0xe4, 0xff, 0xa7, 0xd9, 0xff, 0x04, 0xd1, 0xff, 0x9e, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xbb, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xcf, 0x94, 0x24, 0xd1, 0xff, 0x05, 0x04, 
+  0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xbe, 0xff, 0xff, 0x92, 0xe4, 0xff, 0x86, 0xd1, 0xff, 0x04, 0xd1, 0xff, 0x9c, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 
+  0xdb, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0x5d, 0xf7, 0xff, 0x10, 0xe4, 0xff, 0x45, 0xd1, 0xff, 0x9b, 0x24, 0xd1, 0xff, 0x00, 0x04, 
+  0xd1, 0xdb, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xe4, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0xdb, 0xee, 0xff, 
+  0xaf, 0xdb, 0xff, 0x25, 0xd1, 0xff, 0x99, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xe4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xec, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 
+  0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 0x9e, 0xf7, 0xff, 0x7a, 0xee, 0xff, 0x6d, 0xdb, 0xff, 0x98, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xec, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf3, 0x94, 
+  0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x39, 0xe6, 0xff, 0x0c, 0xdb, 0xff, 0x04, 0xd1, 0xff, 0x95, 0x24, 
+  0xd1, 0xff, 0x00, 0x04, 0xd1, 0xf3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf4, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x04, 0x9e, 0xf7, 
+  0xff, 0x1c, 0xef, 0xff, 0xf8, 0xe5, 0xff, 0xcb, 0xda, 0xff, 0x04, 0xd1, 0xff, 0x93, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf7, 0x94, 0x24, 0xd1, 
+  0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x88, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 0xff, 0x5d, 0xf7, 0xff, 0x1c, 0xef, 0xff, 0xb6, 0xe5, 0xff, 0x8a, 0xda, 0xff, 0x04, 0xd1, 0xff, 0x91, 
+  0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf7, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x03, 0x9e, 
+  0xf7, 0xff, 0x1c, 0xef, 0xff, 0x18, 0xe6, 0xff, 0xe8, 0xd9, 0xff, 0x91, 0x24, 0xd1, 0xff, 0x00, 0x24, 0xd1, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf7, 0x94, 0x24, 0xd1, 0xff, 0x01, 
+  0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xfe, 0xff, 0x4d, 0xe3, 0xff, 0x93, 0x24, 0xd1, 0xff, 0x00, 0x24, 0xd1, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 
+  0xf7, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x1c, 0xff, 0xff, 0xae, 0xe3, 0xff, 0x95, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xf7, 0x85, 
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf4, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0x5d, 0xff, 0xff, 0xef, 0xe3, 0xff, 0x25, 0xd1, 0xff, 
+  0x96, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xf0, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 
+  0x7e, 0xff, 0xff, 0x30, 0xec, 0xff, 0x45, 0xd1, 0xff, 0x98, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xf0, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xeb, 0x94, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 
+  0xff, 0x9a, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0x9e, 0xff, 0xff, 0x72, 0xec, 0xff, 0x65, 0xd1, 0xff, 0x9a, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xeb, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 
+  0xd1, 0xe3, 0x94, 0x24, 0xd1, 0xff, 0x06, 0x04, 0xd1, 0xff, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xb3, 0xec, 0xff, 0x86, 0xd9, 0xff, 0x04, 0xd1, 0xff, 0x9b, 0x24, 0xd1, 0xff, 
+  0x00, 0x04, 0xd1, 0xe3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xd7, 0x94, 0x24, 0xd1, 0xff, 0x04, 0x04, 0xd1, 0xff, 0x79, 0xf6, 0xff, 0x14, 0xed, 0xff, 0xa6, 0xd9, 0xff, 0x04, 0xd1, 0xff, 
+  0x9d, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xd7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xc8, 0x94, 0x24, 0xd1, 0xff, 0x02, 0x04, 0xd1, 0xff, 0x66, 0xd9, 0xff, 0x04, 0xd1, 0xff, 0x9f, 0x24, 
+  0xd1, 0xff, 0x00, 0x04, 0xd1, 0xc8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xb4, 0xb7, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0xb4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x9c, 0xb7, 0x24, 
+  0xd1, 0xff, 0x00, 0x04, 0xd1, 0x9c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x7c, 0xb7, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x7c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x57, 0xb7, 0x24, 
+  0xd1, 0xff, 0x00, 0x04, 0xd1, 0x57, 0x85, 0x00, 0x00, 0x00, 0x00, 0x23, 0xd1, 0x24, 0xb7, 0x24, 0xd1, 0xff, 0x00, 0x23, 0xd1, 0x24, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xe3, 0xb5, 0x24, 
+  0xd1, 0xff, 0x00, 0x04, 0xd1, 0xe3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x90, 0xb5, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x90, 0x87, 0x00, 0x00, 0x00, 0x01, 0x04, 0xd1, 0x27, 0x04, 0xd1, 
+  0xfb, 0xb3, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xfb, 0x04, 0xd1, 0x27, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x8b, 0xb3, 0x24, 0xd1, 0xff, 0x00, 0x04, 0xd1, 0x8b, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0xc0, 0x04, 0x04, 0xd1, 0xa4, 0xb1, 0x24, 0xd1, 0xff, 0x01, 0x04, 0xd1, 0xa4, 0x00, 0xc0, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x01, 0x04, 0xd1, 0x5b, 0x24, 0xd1, 0xd3, 0xad, 0x24, 0xd1, 
+  0xff, 0x01, 0x24, 0xd1, 0xd3, 0x04, 0xd1, 0x5b, 0x8f, 0x00, 0x00, 0x00, 0x04, 0x04, 0xd1, 0x30, 0x04, 0xd1, 0x77, 0x04, 0xd1, 0xaf, 0x24, 0xd1, 0xdb, 0x04, 0xd1, 0xf8, 0xa3, 0x24, 0xd1, 0xff, 
+  0x04, 0x24, 0xd1, 0xf7, 0x04, 0xd1, 0xdb, 0x04, 0xd1, 0xac, 0x04, 0xd1, 0x77, 0x04, 0xd1, 0x30, 0x95, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xf8, 0x04, 0xe4, 0xd0, 0x1b, 0x04, 0xd1, 0x2f, 0x04, 0xd1, 
+  0x43, 0x04, 0xd1, 0x50, 0x04, 0xd1, 0x5b, 0x04, 0xd1, 0x64, 0x04, 0xd1, 0x6b, 0x04, 0xd1, 0x6f, 0x04, 0xd1, 0x73, 0x04, 0xd1, 0x74, 0x81, 0x04, 0xd1, 0x77, 0x83, 0x04, 0xd1, 0x78, 0x83, 0x04, 
+  0xd1, 0x7b, 0x83, 0x04, 0xd1, 0x78, 0x81, 0x04, 0xd1, 0x77, 0x0a, 0x24, 0xd1, 0x74, 0x04, 0xd1, 0x73, 0x04, 0xd1, 0x6f, 0x04, 0xd1, 0x6b, 0x04, 0xd1, 0x63, 0x04, 0xd1, 0x5b, 0x24, 0xd1, 0x50, 
+  0x04, 0xd1, 0x40, 0x04, 0xd1, 0x2f, 0xe4, 0xd8, 0x18, 0x00, 0xc0, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xcc, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0xd0, 0xc3, 0x1c, 0xd1, 0x04, 0x3f, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x70, 0xd1, 0x04, 0x84, 0xd1, 0x04, 0x93, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0xa7, 0xd1, 0x04, 0xac, 0xd1, 0x04, 0xb0, 0xd1, 0x04, 0xb4, 0xd1, 0x04, 0xb7, 0xd1, 0x04, 0xb7, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xb7, 0xd1, 0x04, 0xb7, 0xd1, 0x04, 0xb4, 0xd1, 0x04, 0xb0, 0xd1, 0x04, 0xac, 0xd1, 0x04, 0xa4, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0x93, 0xd1, 0x24, 0x83, 0xd1, 0x04, 0x70, 0xd1, 0x04, 0x5b, 0xd1, 0x04, 0x3f, 0xd0, 0xe3, 0x1c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xe3, 0x1c, 0xd1, 0x04, 0x73, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xef, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xec, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0x73, 0xd0, 0xe3, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x10, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0xfb, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xfb, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x03, 0x17, 0xd1, 0x04, 0xd7, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xd7, 0xd1, 0x03, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0xb7, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x43, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xab, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x04, 0xd1, 0x04, 0xf0, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xf0, 0xc8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xe4, 0x33, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd0, 0xe4, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x60, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x87, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xa3, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xbb, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xe4, 0x10, 0xff, 0xd9, 0xa7, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xcf, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xbe, 0xff, 0xe4, 0x92, 0xff, 0xd1, 0x86, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xdb, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5d, 0xff, 0xe4, 0x10, 0xff, 0xd1, 0x45, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xe4, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xee, 0xdb, 0xff, 0xdb, 0xaf, 0xff, 0xd1, 0x25, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xec, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xee, 0x7a, 0xff, 0xdb, 0x6d, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf3, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x5d, 0xff, 0xe6, 0x39, 0xff, 0xdb, 0x0c, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf4, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1c, 0xff, 0xe5, 0xf8, 0xff, 0xda, 0xcb, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf7, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x5d, 0xff, 0xef, 0x1c, 0xff, 0xe5, 0xb6, 0xff, 0xda, 0x8a, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf7, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x1c, 0xff, 0xe6, 0x18, 0xff, 0xd9, 0xe8, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf7, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xff, 0xe3, 0x4d, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf7, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xe3, 0xae, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf4, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xe3, 0xef, 0xff, 0xd1, 0x25, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf0, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xec, 0x30, 0xff, 0xd1, 0x45, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xeb, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xec, 0x72, 0xff, 0xd1, 0x65, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xe3, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xec, 0xb3, 0xff, 0xd9, 0x86, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xd7, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xf6, 0x79, 0xff, 0xed, 0x14, 0xff, 0xd9, 0xa6, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xc8, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xff, 0xd9, 0x66, 0xff, 0xd1, 0x04, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xb4, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x9c, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x7c, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x57, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x23, 0x24, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x23, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xe3, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x90, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x27, 0xd1, 0x04, 0xfb, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xfb, 0xd1, 0x04, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x8b, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x04, 0xd1, 0x04, 0xa4, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x04, 0xa4, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x5b, 0xd1, 0x24, 0xd3, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xd3, 0xd1, 0x04, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x30, 0xd1, 0x04, 0x77, 0xd1, 0x04, 0xaf, 0xd1, 0x24, 0xdb, 0xd1, 0x04, 0xf8, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xff, 0xd1, 0x24, 0xf7, 0xd1, 0x04, 0xdb, 0xd1, 0x04, 0xac, 0xd1, 0x04, 0x77, 0xd1, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x04, 0xd0, 0xe4, 0x1b, 0xd1, 0x04, 0x2f, 0xd1, 0x04, 0x43, 0xd1, 0x04, 0x50, 0xd1, 0x04, 0x5b, 0xd1, 0x04, 0x64, 0xd1, 0x04, 0x6b, 0xd1, 0x04, 0x6f, 0xd1, 0x04, 0x73, 0xd1, 0x04, 0x74, 0xd1, 0x04, 0x77, 0xd1, 0x04, 0x77, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x7b, 0xd1, 0x04, 0x7b, 0xd1, 0x04, 0x7b, 0xd1, 0x04, 0x7b, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x78, 0xd1, 0x04, 0x77, 0xd1, 0x04, 0x77, 0xd1, 0x24, 0x74, 0xd1, 0x04, 0x73, 0xd1, 0x04, 0x6f, 0xd1, 0x04, 0x6b, 0xd1, 0x04, 0x63, 0xd1, 0x04, 0x5b, 0xd1, 0x24, 0x50, 0xd1, 0x04, 0x40, 0xd1, 0x04, 0x2f, 0xd8, 0xe4, 0x18, 0xc0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x03, 
+  0xd0, 0xc3, 0x1c, 0xd1, 0x04, 0x3f, 0xd1, 0x04, 0x5c, 0xd1, 0x04, 0x70, 0xd1, 0x04, 0x84, 0xd1, 0x04, 0x93, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0xa7, 0xd1, 0x04, 0xac, 0xd1, 0x04, 0xb0, 0xd1, 0x04, 
+  0xb4, 0x81, 0xd1, 0x04, 0xb7, 0x8d, 0xd1, 0x04, 0xb8, 0x81, 0xd1, 0x04, 0xb7, 0x0a, 0xd1, 0x04, 0xb4, 0xd1, 0x04, 0xb0, 0xd1, 0x04, 0xac, 0xd1, 0x04, 0xa4, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0x93, 
+  0xd1, 0x24, 0x83, 0xd1, 0x04, 0x70, 0xd1, 0x04, 0x5b, 0xd1, 0x04, 0x3f, 0xd0, 0xe3, 0x1c, 0x93, 0x00, 0x00, 0x00, 0x03, 0xd0, 0xe3, 0x1c, 0xd1, 0x04, 0x73, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0xef, 
+  0xa7, 0xd1, 0x24, 0xff, 0x03, 0xd1, 0x04, 0xec, 0xd1, 0x04, 0xb8, 0xd1, 0x04, 0x73, 0xd0, 0xe3, 0x1c, 0x8d, 0x00, 0x00, 0x00, 0x02, 0xd1, 0x04, 0x10, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0xfb, 0xad, 
+  0xd1, 0x24, 0xff, 0x02, 0xd1, 0x04, 0xfb, 0xd1, 0x04, 0x9c, 0xd1, 0x04, 0x10, 0x8a, 0x00, 0x00, 0x00, 0x01, 0xd1, 0x03, 0x17, 0xd1, 0x04, 0xd7, 0xb1, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xd7, 
+  0xd1, 0x03, 0x17, 0x89, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0xb7, 0xb3, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xb7, 0x88, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x43, 0xb5, 0xd1, 0x24, 0xff, 0x00, 
+  0xd1, 0x04, 0x43, 0x87, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xab, 0xb5, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xab, 0x86, 0x00, 0x00, 0x00, 0x01, 0xc8, 0x00, 0x04, 0xd1, 0x04, 0xf0, 0xb5, 0xd1, 
+  0x24, 0xff, 0x01, 0xd1, 0x04, 0xf0, 0xc8, 0x00, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xe4, 0x33, 0xb7, 0xd1, 0x24, 0xff, 0x00, 0xd0, 0xe4, 0x33, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 
+  0x60, 0xb7, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x60, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x87, 0xb7, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x87, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 
+  0xa3, 0x95, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xff, 0xa0, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xa3, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xbb, 0x94, 0xd1, 0x24, 0xff, 0x03, 0xd1, 0x04, 
+  0xff, 0xe4, 0x10, 0xff, 0xd9, 0xa7, 0xff, 0xd1, 0x04, 0xff, 0x9e, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xbb, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xcf, 0x94, 0xd1, 0x24, 0xff, 0x05, 0xd1, 
+  0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xbe, 0xff, 0xe4, 0x92, 0xff, 0xd1, 0x86, 0xff, 0xd1, 0x04, 0xff, 0x9c, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 
+  0xdb, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x81, 0xff, 0xff, 0xff, 0x02, 0xf7, 0x5d, 0xff, 0xe4, 0x10, 0xff, 0xd1, 0x45, 0xff, 0x9b, 0xd1, 0x24, 0xff, 0x00, 0xd1, 
+  0x04, 0xdb, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xe4, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x82, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xee, 0xdb, 0xff, 
+  0xdb, 0xaf, 0xff, 0xd1, 0x25, 0xff, 0x99, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xe4, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xec, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 
+  0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 0xf7, 0x9e, 0xff, 0xee, 0x7a, 0xff, 0xdb, 0x6d, 0xff, 0x98, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xec, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf3, 0x94, 
+  0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 0xff, 0xdf, 0xff, 0xf7, 0x5d, 0xff, 0xe6, 0x39, 0xff, 0xdb, 0x0c, 0xff, 0xd1, 0x04, 0xff, 0x95, 0xd1, 
+  0x24, 0xff, 0x00, 0xd1, 0x04, 0xf3, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf4, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x87, 0xff, 0xff, 0xff, 0x04, 0xf7, 0x9e, 
+  0xff, 0xef, 0x1c, 0xff, 0xe5, 0xf8, 0xff, 0xda, 0xcb, 0xff, 0xd1, 0x04, 0xff, 0x93, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf7, 0x94, 0xd1, 0x24, 
+  0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x88, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 0xff, 0xf7, 0x5d, 0xff, 0xef, 0x1c, 0xff, 0xe5, 0xb6, 0xff, 0xda, 0x8a, 0xff, 0xd1, 0x04, 0xff, 0x91, 
+  0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf7, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x03, 0xf7, 
+  0x9e, 0xff, 0xef, 0x1c, 0xff, 0xe6, 0x18, 0xff, 0xd9, 0xe8, 0xff, 0x91, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x24, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf7, 0x94, 0xd1, 0x24, 0xff, 0x01, 
+  0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfb, 0xff, 0xe3, 0x4d, 0xff, 0x93, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x24, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 
+  0xf7, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xff, 0x1c, 0xff, 0xe3, 0xae, 0xff, 0x95, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xf7, 0x85, 
+  0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf4, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xff, 0x5d, 0xff, 0xe3, 0xef, 0xff, 0xd1, 0x25, 0xff, 
+  0x96, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xf0, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 
+  0xff, 0x7e, 0xff, 0xec, 0x30, 0xff, 0xd1, 0x45, 0xff, 0x98, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xf0, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xeb, 0x94, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 
+  0xff, 0xfe, 0x9a, 0xff, 0x82, 0xff, 0xff, 0xff, 0x02, 0xff, 0x9e, 0xff, 0xec, 0x72, 0xff, 0xd1, 0x65, 0xff, 0x9a, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xeb, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 
+  0x04, 0xe3, 0x94, 0xd1, 0x24, 0xff, 0x06, 0xd1, 0x04, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xec, 0xb3, 0xff, 0xd9, 0x86, 0xff, 0xd1, 0x04, 0xff, 0x9b, 0xd1, 0x24, 0xff, 
+  0x00, 0xd1, 0x04, 0xe3, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xd7, 0x94, 0xd1, 0x24, 0xff, 0x04, 0xd1, 0x04, 0xff, 0xf6, 0x79, 0xff, 0xed, 0x14, 0xff, 0xd9, 0xa6, 0xff, 0xd1, 0x04, 0xff, 
+  0x9d, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xd7, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xc8, 0x94, 0xd1, 0x24, 0xff, 0x02, 0xd1, 0x04, 0xff, 0xd9, 0x66, 0xff, 0xd1, 0x04, 0xff, 0x9f, 0xd1, 
+  0x24, 0xff, 0x00, 0xd1, 0x04, 0xc8, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xb4, 0xb7, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0xb4, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x9c, 0xb7, 0xd1, 
+  0x24, 0xff, 0x00, 0xd1, 0x04, 0x9c, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x7c, 0xb7, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x7c, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x57, 0xb7, 0xd1, 
+  0x24, 0xff, 0x00, 0xd1, 0x04, 0x57, 0x85, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x23, 0x24, 0xb7, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x23, 0x24, 0x86, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0xe3, 0xb5, 0xd1, 
+  0x24, 0xff, 0x00, 0xd1, 0x04, 0xe3, 0x87, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x90, 0xb5, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x90, 0x87, 0x00, 0x00, 0x00, 0x01, 0xd1, 0x04, 0x27, 0xd1, 0x04, 
+  0xfb, 0xb3, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xfb, 0xd1, 0x04, 0x27, 0x88, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x04, 0x8b, 0xb3, 0xd1, 0x24, 0xff, 0x00, 0xd1, 0x04, 0x8b, 0x89, 0x00, 0x00, 0x00, 
+  0x01, 0xc0, 0x00, 0x04, 0xd1, 0x04, 0xa4, 0xb1, 0xd1, 0x24, 0xff, 0x01, 0xd1, 0x04, 0xa4, 0xc0, 0x00, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xd1, 0x04, 0x5b, 0xd1, 0x24, 0xd3, 0xad, 0xd1, 0x24, 
+  0xff, 0x01, 0xd1, 0x24, 0xd3, 0xd1, 0x04, 0x5b, 0x8f, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x04, 0x30, 0xd1, 0x04, 0x77, 0xd1, 0x04, 0xaf, 0xd1, 0x24, 0xdb, 0xd1, 0x04, 0xf8, 0xa3, 0xd1, 0x24, 0xff, 
+  0x04, 0xd1, 0x24, 0xf7, 0xd1, 0x04, 0xdb, 0xd1, 0x04, 0xac, 0xd1, 0x04, 0x77, 0xd1, 0x04, 0x30, 0x95, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0x00, 0x04, 0xd0, 0xe4, 0x1b, 0xd1, 0x04, 0x2f, 0xd1, 0x04, 
+  0x43, 0xd1, 0x04, 0x50, 0xd1, 0x04, 0x5b, 0xd1, 0x04, 0x64, 0xd1, 0x04, 0x6b, 0xd1, 0x04, 0x6f, 0xd1, 0x04, 0x73, 0xd1, 0x04, 0x74, 0x81, 0xd1, 0x04, 0x77, 0x83, 0xd1, 0x04, 0x78, 0x83, 0xd1, 
+  0x04, 0x7b, 0x83, 0xd1, 0x04, 0x78, 0x81, 0xd1, 0x04, 0x77, 0x0a, 0xd1, 0x24, 0x74, 0xd1, 0x04, 0x73, 0xd1, 0x04, 0x6f, 0xd1, 0x04, 0x6b, 0xd1, 0x04, 0x63, 0xd1, 0x04, 0x5b, 0xd1, 0x24, 0x50, 
+  0xd1, 0x04, 0x40, 0xd1, 0x04, 0x2f, 0xd8, 0xe4, 0x18, 0xc0, 0x00, 0x04, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
+  0xcc, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x1a, 0x1a, 0xd3, 0x1c, 0x20, 0x20, 0xd2, 0x3f, 0x21, 0x21, 0xd2, 0x5c, 0x22, 0x22, 0xd3, 0x70, 0x20, 0x22, 0xd2, 0x84, 0x21, 0x22, 0xd3, 0x93, 0x20, 0x22, 0xd3, 0x9c, 0x21, 0x21, 0xd2, 0xa7, 0x22, 0x22, 0xd4, 0xac, 0x21, 0x22, 0xd2, 0xb0, 0x20, 0x22, 0xd3, 0xb4, 0x21, 0x21, 0xd3, 0xb7, 0x21, 0x22, 0xd3, 0xb7, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd2, 0xb7, 0x21, 0x21, 0xd3, 0xb7, 0x20, 0x22, 0xd1, 0xb4, 0x21, 0x22, 0xd2, 0xb0, 0x22, 0x22, 0xd2, 0xac, 0x22, 0x22, 0xd3, 0xa4, 0x20, 0x22, 0xd3, 0x9c, 0x21, 0x22, 0xd3, 0x93, 0x21, 0x23, 0xd4, 0x83, 0x1f, 0x22, 0xd1, 0x70, 0x21, 0x21, 0xd2, 0x5b, 0x20, 0x20, 0xd2, 0x3f, 0x1b, 0x1b, 0xd1, 0x1c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0xd1, 0x1c, 0x21, 0x21, 0xd2, 0x73, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd3, 0xef, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xec, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x21, 0xd2, 0x73, 0x1b, 0x1b, 0xd1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0xcf, 0x10, 0x20, 0x22, 0xd2, 0x9c, 0x21, 0x22, 0xd3, 0xfb, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xfb, 0x20, 0x22, 0xd2, 0x9c, 0x1f, 0x1f, 0xcf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x22, 0xd0, 0x17, 0x21, 0x22, 0xd3, 0xd7, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xd7, 0x17, 0x22, 0xd0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x23, 0xd3, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd1, 0x43, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x22, 0xd1, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xab, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x04, 0x21, 0x22, 0xd2, 0xf0, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xf0, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0xd2, 0x33, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x1e, 0x1e, 0xd2, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd4, 0x60, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x22, 0xd4, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd1, 0x87, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x22, 0xd1, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd3, 0xa3, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x22, 0xd3, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd1, 0xbb, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0x7e, 0x7f, 0xe4, 0xff, 0x35, 0x36, 0xd5, 0xff, 0x21, 0x22, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x22, 0xd1, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xcf, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xf4, 0xf5, 0xfa, 0xff, 0x91, 0x91, 0xe3, 0xff, 0x2e, 0x2f, 0xd4, 0xff, 0x21, 0x22, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xdb, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xe8, 0xe8, 0xf3, 0xff, 0x81, 0x81, 0xde, 0xff, 0x29, 0x2a, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xe4, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfb, 0xff, 0xd9, 0xd9, 0xeb, 0xff, 0x76, 0x76, 0xdc, 0xff, 0x25, 0x26, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xec, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xf4, 0xff, 0xcd, 0xcd, 0xe6, 0xff, 0x6c, 0x6c, 0xdb, 0xff, 0x23, 0x24, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf3, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfb, 0xff, 0xe7, 0xe7, 0xed, 0xff, 0xc5, 0xc5, 0xe4, 0xff, 0x61, 0x62, 0xda, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf4, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xf4, 0xff, 0xe1, 0xe1, 0xe8, 0xff, 0xbd, 0xbd, 0xe3, 0xff, 0x58, 0x58, 0xd9, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xf7, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfb, 0xff, 0xe7, 0xe7, 0xed, 0xff, 0xe1, 0xe1, 0xe8, 0xff, 0xb4, 0xb4, 0xe3, 0xff, 0x4e, 0x4f, 0xd7, 0xff, 0x20, 0x21, 0xd2, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x22, 0xd3, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf7, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xf4, 0xff, 0xe1, 0xe1, 0xe8, 0xff, 0xc0, 0xc0, 0xe4, 0xff, 0x3d, 0x3e, 0xd6, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd2, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf7, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xdc, 0xf8, 0xff, 0x69, 0x6a, 0xdf, 0xff, 0x21, 0x23, 0xd2, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd2, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xf7, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xe2, 0xf9, 0xff, 0x73, 0x74, 0xe3, 0xff, 0x23, 0x24, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xf4, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xe8, 0xfa, 0xff, 0x7b, 0x7c, 0xe4, 0xff, 0x25, 0x26, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf0, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xfb, 0xff, 0x84, 0x85, 0xe6, 0xff, 0x28, 0x29, 0xd4, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xeb, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xfc, 0xff, 0x8d, 0x8e, 0xe8, 0xff, 0x2b, 0x2c, 0xd4, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xe3, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xfd, 0xff, 0x95, 0x96, 0xea, 0xff, 0x2f, 0x30, 0xd5, 0xff, 0x21, 0x22, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xd7, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x21, 0xd2, 0xff, 0xcb, 0xcb, 0xf4, 0xff, 0x9f, 0x9f, 0xeb, 0xff, 0x34, 0x35, 0xd6, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd2, 0xc8, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x2d, 0x2e, 0xd5, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x22, 0xd2, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd3, 0xb4, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x22, 0xd3, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd2, 0x9c, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x22, 0xd2, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd4, 0x7c, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x22, 0xd4, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xd0, 0x57, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x20, 0x20, 0xd0, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x23, 0xd4, 0x24, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x1c, 0x23, 0xd4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xe3, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0xd3, 0x90, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x21, 0xd3, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xd1, 0x27, 0x21, 0x22, 0xd3, 0xfb, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x22, 0xd3, 0xfb, 0x20, 0x20, 0xd1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0xd2, 0x8b, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x21, 0xd2, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x22, 0x22, 0xd3, 0xa4, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x22, 0xd3, 0xa4, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd1, 0x5b, 0x21, 0x23, 0xd3, 0xd3, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x21, 0x23, 0xd3, 0xd3, 0x22, 0x22, 0xd1, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0xd0, 0x30, 0x20, 0x22, 0xd4, 0x77, 0x21, 0x21, 0xd3, 0xaf, 0x21, 0x23, 0xd2, 0xdb, 0x21, 0x22, 0xd2, 0xf8, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xff, 0x22, 0x23, 0xd3, 0xf7, 0x21, 0x21, 0xd2, 0xdb, 0x21, 0x21, 0xd2, 0xac, 0x20, 0x22, 0xd2, 0x77, 0x1f, 0x1f, 0xd4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x1d, 0x1d, 0xcd, 0x1b, 0x20, 0x20, 0xd3, 0x2f, 0x1e, 0x22, 0xd4, 0x43, 0x1f, 0x22, 0xd2, 0x50, 0x21, 0x21, 0xd2, 0x5b, 0x21, 0x21, 0xd1, 0x64, 0x21, 0x21, 0xd3, 0x6b, 0x20, 0x22, 0xd3, 0x6f, 0x21, 0x21, 0xd2, 0x73, 0x20, 0x22, 0xd1, 0x74, 0x22, 0x22, 0xd2, 0x77, 0x22, 0x22, 0xd2, 0x77, 0x22, 0x22, 0xd2, 0x78, 0x22, 0x22, 0xd2, 0x78, 0x22, 0x22, 0xd2, 0x78, 0x21, 0x21, 0xd2, 0x78, 0x21, 0x21, 0xd3, 0x7b, 0x21, 0x21, 0xd3, 0x7b, 0x21, 0x21, 0xd3, 0x7b, 0x21, 0x21, 0xd3, 0x7b, 0x22, 0x22, 0xd4, 0x78, 0x22, 0x22, 0xd2, 0x78, 0x22, 0x22, 0xd2, 0x78, 0x1f, 0x22, 0xd2, 0x78, 0x22, 0x22, 0xd2, 0x77, 0x22, 0x22, 0xd2, 0x77, 0x20, 0x23, 0xd3, 0x74, 0x21, 0x21, 0xd2, 0x73, 0x20, 0x22, 0xd3, 0x6f, 0x21, 0x21, 0xd3, 0x6b, 0x21, 0x21, 0xd3, 0x63, 0x21, 0x21, 0xd2, 0x5b, 0x1f, 0x23, 0xd2, 0x50, 0x1f, 0x1f, 0xd3, 0x40, 0x21, 0x21, 0xd2, 0x2f, 0x1e, 0x1e, 0xd6, 0x18, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  /*Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit, run length compressed*/
+  0x52, 0x4c, 0x45, 0x41, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 
+  0x00, 0x00, 0x0d, 0x00, 0x00, 0x7f, 0x03, 0x1a, 0x1a, 0xd3, 0x1c, 0x20, 0x20, 0xd2, 0x3f, 0x21, 0x21, 0xd2, 0x5c, 0x22, 0x22, 0xd3, 0x70, 0x20, 0x22, 0xd2, 0x84, 0x21, 0x22, 0xd3, 0x93, 0x20, 
+  0x22, 0xd3, 0x9c, 0x21, 0x21, 0xd2, 0xa7, 0x22, 0x22, 0xd4, 0xac, 0x21, 0x22, 0xd2, 0xb0, 0x20, 0x22, 0xd3, 0xb4, 0x21, 0x21, 0xd3, 0xb7, 0x21, 0x22, 0xd3, 0xb7, 0x8d, 0x21, 0x22, 0xd2, 0xb8, 
+  0x0c, 0x21, 0x22, 0xd2, 0xb7, 0x21, 0x21, 0xd3, 0xb7, 0x20, 0x22, 0xd1, 0xb4, 0x21, 0x22, 0xd2, 0xb0, 0x22, 0x22, 0xd2, 0xac, 0x22, 0x22, 0xd3, 0xa4, 0x20, 0x22, 0xd3, 0x9c, 0x21, 0x22, 0xd3, 
+  0x93, 0x21, 0x23, 0xd4, 0x83, 0x1f, 0x22, 0xd1, 0x70, 0x21, 0x21, 0xd2, 0x5b, 0x20, 0x20, 0xd2, 0x3f, 0x1b, 0x1b, 0xd1, 0x1c, 0x93, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1b, 0x1b, 0xd1, 0x1c, 0x21, 
+  0x21, 0xd2, 0x73, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x22, 0xd3, 0xef, 0xa7, 0x22, 0x23, 0xd3, 0xff, 0x03, 0x21, 0x22, 0xd2, 0xec, 0x21, 0x22, 0xd2, 0xb8, 0x21, 0x21, 0xd2, 0x73, 0x1b, 0x1b, 0xd1, 
+  0x1c, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x1f, 0xcf, 0x10, 0x20, 0x22, 0xd2, 0x9c, 0x21, 0x22, 0xd3, 0xfb, 0xad, 0x22, 0x23, 0xd3, 0xff, 0x02, 0x21, 0x22, 0xd3, 0xfb, 0x20, 0x22, 0xd2, 
+  0x9c, 0x1f, 0x1f, 0xcf, 0x10, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x22, 0xd0, 0x17, 0x21, 0x22, 0xd3, 0xd7, 0xb1, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 0x22, 0xd3, 0xd7, 0x17, 0x22, 0xd0, 
+  0x17, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x23, 0xd3, 0xb7, 0xb3, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0xb7, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd1, 0x43, 0xb5, 
+  0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x22, 0xd1, 0x43, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xab, 0xb5, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0xab, 0x86, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0xcc, 0x04, 0x21, 0x22, 0xd2, 0xf0, 0xb5, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 0x22, 0xd2, 0xf0, 0x00, 0x00, 0xcc, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 
+  0x1e, 0xd2, 0x33, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x1e, 0x1e, 0xd2, 0x33, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd4, 0x60, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x22, 0xd4, 
+  0x60, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd1, 0x87, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x22, 0xd1, 0x87, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd3, 0xa3, 0x95, 
+  0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xff, 0xa0, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x20, 0x22, 0xd3, 0xa3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd1, 0xbb, 0x94, 0x22, 0x23, 
+  0xd3, 0xff, 0x03, 0x20, 0x21, 0xd2, 0xff, 0x7e, 0x7f, 0xe4, 0xff, 0x35, 0x36, 0xd5, 0xff, 0x21, 0x22, 0xd3, 0xff, 0x9e, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x20, 0x22, 0xd1, 0xbb, 0x85, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xcf, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x05, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xf4, 0xf5, 0xfa, 0xff, 0x91, 0x91, 0xe3, 0xff, 0x2e, 0x2f, 0xd4, 
+  0xff, 0x21, 0x22, 0xd3, 0xff, 0x9c, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0xcf, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xdb, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x06, 0x20, 
+  0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xe8, 0xe8, 0xf3, 0xff, 0x81, 0x81, 0xde, 0xff, 0x29, 0x2a, 0xd3, 0xff, 0x9b, 0x22, 0x23, 0xd3, 0xff, 
+  0x00, 0x21, 0x22, 0xd2, 0xdb, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xe4, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x82, 0xff, 0xff, 
+  0xff, 0xff, 0x03, 0xfa, 0xfa, 0xfb, 0xff, 0xd9, 0xd9, 0xeb, 0xff, 0x76, 0x76, 0xdc, 0xff, 0x25, 0x26, 0xd3, 0xff, 0x99, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xe4, 0x85, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xec, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 
+  0xf1, 0xf4, 0xff, 0xcd, 0xcd, 0xe6, 0xff, 0x6c, 0x6c, 0xdb, 0xff, 0x23, 0x24, 0xd3, 0xff, 0x97, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0xec, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 
+  0x22, 0xd2, 0xf3, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfa, 0xfa, 0xfb, 0xff, 0xe7, 0xe7, 0xed, 0xff, 0xc5, 
+  0xc5, 0xe4, 0xff, 0x61, 0x62, 0xda, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x95, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0xf3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf4, 0x94, 
+  0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xf4, 0xff, 0xe1, 0xe1, 0xe8, 0xff, 0xbd, 
+  0xbd, 0xe3, 0xff, 0x58, 0x58, 0xd9, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x93, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xf7, 0x94, 
+  0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfa, 0xfa, 0xfb, 0xff, 0xe7, 0xe7, 0xed, 0xff, 0xe1, 0xe1, 0xe8, 0xff, 0xb4, 
+  0xb4, 0xe3, 0xff, 0x4e, 0x4f, 0xd7, 0xff, 0x20, 0x21, 0xd2, 0xff, 0x91, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x22, 0xd3, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf7, 0x94, 
+  0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfe, 0xfe, 0xff, 0xf1, 0xf1, 0xf4, 0xff, 0xe1, 0xe1, 0xe8, 0xff, 0xc0, 
+  0xc0, 0xe4, 0xff, 0x3d, 0x3e, 0xd6, 0xff, 0x91, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x23, 0xd2, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf7, 0x94, 0x22, 0x23, 0xd3, 0xff, 
+  0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x02, 0xdc, 0xdc, 0xf8, 0xff, 0x69, 0x6a, 0xdf, 0xff, 0x21, 0x23, 0xd2, 0xff, 0x92, 0x22, 0x23, 0xd3, 0xff, 
+  0x00, 0x22, 0x23, 0xd2, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xf7, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x88, 0xff, 0xff, 
+  0xff, 0xff, 0x02, 0xe2, 0xe2, 0xf9, 0xff, 0x73, 0x74, 0xe3, 0xff, 0x23, 0x24, 0xd3, 0xff, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xf7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 
+  0x22, 0xd3, 0xf4, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe8, 0xe8, 0xfa, 0xff, 0x7b, 0x7c, 0xe4, 0xff, 0x25, 
+  0x26, 0xd3, 0xff, 0x96, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xf4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd2, 0xf0, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 
+  0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x02, 0xee, 0xee, 0xfb, 0xff, 0x84, 0x85, 0xe6, 0xff, 0x28, 0x29, 0xd4, 0xff, 0x98, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd2, 
+  0xf0, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xeb, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf2, 
+  0xf2, 0xfc, 0xff, 0x8d, 0x8e, 0xe8, 0xff, 0x2b, 0x2c, 0xd4, 0xff, 0x9a, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xeb, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xe3, 0x94, 
+  0x22, 0x23, 0xd3, 0xff, 0x06, 0x20, 0x21, 0xd2, 0xff, 0xd1, 0xd1, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xfd, 0xff, 0x95, 0x96, 0xea, 0xff, 0x2f, 0x30, 0xd5, 0xff, 0x21, 0x22, 0xd3, 
+  0xff, 0x9b, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xe3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xd7, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x04, 0x20, 0x21, 0xd2, 0xff, 0xcb, 
+  0xcb, 0xf4, 0xff, 0x9f, 0x9f, 0xeb, 0xff, 0x34, 0x35, 0xd6, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x9d, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xd7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
+  0x22, 0xd2, 0xc8, 0x94, 0x22, 0x23, 0xd3, 0xff, 0x02, 0x21, 0x22, 0xd2, 0xff, 0x2d, 0x2e, 0xd5, 0xff, 0x21, 0x22, 0xd2, 0xff, 0x9f, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x20, 0x22, 0xd2, 0xc8, 0x85, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xd3, 0xb4, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x22, 0x22, 0xd3, 0xb4, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd2, 0x9c, 0xb7, 0x22, 0x23, 
+  0xd3, 0xff, 0x00, 0x20, 0x22, 0xd2, 0x9c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xd4, 0x7c, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x20, 0x22, 0xd4, 0x7c, 0x85, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x20, 0x20, 0xd0, 0x57, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x20, 0x20, 0xd0, 0x57, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x23, 0xd4, 0x24, 0xb7, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x1c, 
+  0x23, 0xd4, 0x24, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x22, 0xd3, 0xe3, 0xb5, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x22, 0xd3, 0xe3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0xd3, 
+  0x90, 0xb5, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x21, 0xd3, 0x90, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x20, 0xd1, 0x27, 0x21, 0x22, 0xd3, 0xfb, 0xb3, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 
+  0x22, 0xd3, 0xfb, 0x20, 0x20, 0xd1, 0x27, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0xd2, 0x8b, 0xb3, 0x22, 0x23, 0xd3, 0xff, 0x00, 0x21, 0x21, 0xd2, 0x8b, 0x89, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0xbf, 0x04, 0x22, 0x22, 0xd3, 0xa4, 0xb1, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x22, 0x22, 0xd3, 0xa4, 0x00, 0x00, 0xbf, 0x04, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0xd1, 
+  0x5b, 0x21, 0x23, 0xd3, 0xd3, 0xad, 0x22, 0x23, 0xd3, 0xff, 0x01, 0x21, 0x23, 0xd3, 0xd3, 0x22, 0x22, 0xd1, 0x5b, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x1f, 0xd0, 0x30, 0x20, 0x22, 0xd4, 
+  0x77, 0x21, 0x21, 0xd3, 0xaf, 0x21, 0x23, 0xd2, 0xdb, 0x21, 0x22, 0xd2, 0xf8, 0xa3, 0x22, 0x23, 0xd3, 0xff, 0x04, 0x22, 0x23, 0xd3, 0xf7, 0x21, 0x21, 0xd2, 0xdb, 0x21, 0x21, 0xd2, 0xac, 0x20, 
+  0x22, 0xd2, 0x77, 0x1f, 0x1f, 0xd4, 0x30, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xff, 0x04, 0x1d, 0x1d, 0xcd, 0x1b, 0x20, 0x20, 0xd3, 0x2f, 0x1e, 0x22, 0xd4, 0x43, 0x1f, 0x22, 0xd2, 
+  0x50, 0x21, 0x21, 0xd2, 0x5b, 0x21, 0x21, 0xd1, 0x64, 0x21, 0x21, 0xd3, 0x6b, 0x20, 0x22, 0xd3, 0x6f, 0x21, 0x21, 0xd2, 0x73, 0x20, 0x22, 0xd1, 0x74, 0x81, 0x22, 0x22, 0xd2, 0x77, 0x82, 0x22, 
+  0x22, 0xd2, 0x78, 0x00, 0x21, 0x21, 0xd2, 0x78, 0x83, 0x21, 0x21, 0xd3, 0x7b, 0x00, 0x22, 0x22, 0xd4, 0x78, 0x81, 0x22, 0x22, 0xd2, 0x78, 0x00, 0x1f, 0x22, 0xd2, 0x78, 0x81, 0x22, 0x22, 0xd2, 
+  0x77, 0x0a, 0x20, 0x23, 0xd3, 0x74, 0x21, 0x21, 0xd2, 0x73, 0x20, 0x22, 0xd3, 0x6f, 0x21, 0x21, 0xd3, 0x6b, 0x21, 0x21, 0xd3, 0x63, 0x21, 0x21, 0xd2, 0x5b, 0x1f, 0x23, 0xd2, 0x50, 0x1f, 0x1f, 
+  0xd3, 0x40, 0x21, 0x21, 0xd2, 0x2f, 0x1e, 0x1e, 0xd6, 0x18, 0x00, 0x00, 0xbf, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
@@ -282,8 +201,7 @@ const lv_img_dsc_t youtube_64px = {
   .header.always_zero = 0,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .data_size = sizeof( youtube_64px_map ),
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .data = youtube_64px_map,
 };
-
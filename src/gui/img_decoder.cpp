@@ -0,0 +1,192 @@
+/****************************************************************************
+ *   Oct 17 09:41:12 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <esp_timer.h>
+#include "img_decoder.h"
+
+typedef struct {
+    const void *src;                // image descriptor the buffer belongs to
+    uint8_t *data;                  // decoded true color alpha pixel in psram
+    uint32_t last_used;             // lv_tick_get() of the last open
+    uint16_t ref;                   // number of open decoder descriptors
+} img_decoder_cache_t;
+
+static img_decoder_cache_t img_decoder_cache[ IMG_DECODER_CACHE_SIZE ];
+
+static lv_res_t img_decoder_info_cb( lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header );
+static lv_res_t img_decoder_open_cb( lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc );
+static void img_decoder_close_cb( lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc );
+static bool img_decoder_is_rle( const void *src );
+static uint8_t *img_decoder_decode( const lv_img_dsc_t *img );
+
+void img_decoder_setup( void ) {
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+    if ( decoder == NULL ) {
+        log_e("image decoder alloc failed");
+        return;
+    }
+    lv_img_decoder_set_info_cb( decoder, img_decoder_info_cb );
+    lv_img_decoder_set_open_cb( decoder, img_decoder_open_cb );
+    lv_img_decoder_set_close_cb( decoder, img_decoder_close_cb );
+}
+
+static bool img_decoder_is_rle( const void *src ) {
+    if ( lv_img_src_get_type( src ) != LV_IMG_SRC_VARIABLE ) {
+        return( false );
+    }
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    if ( img->header.cf != LV_IMG_CF_RAW_ALPHA || img->data_size < strlen( IMG_DECODER_RLE_MAGIC ) ) {
+        return( false );
+    }
+    return( memcmp( img->data, IMG_DECODER_RLE_MAGIC, strlen( IMG_DECODER_RLE_MAGIC ) ) == 0 );
+}
+
+static lv_res_t img_decoder_info_cb( lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header ) {
+    if ( !img_decoder_is_rle( src ) ) {
+        return( LV_RES_INV );
+    }
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    /*
+     * the decoded buffer is handed out as img_data, so lvgl draws it like a true color alpha image
+     */
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    return( LV_RES_OK );
+}
+
+static uint8_t *img_decoder_decode( const lv_img_dsc_t *img ) {
+    uint64_t start = esp_timer_get_time();
+    size_t out_len = img->header.w * img->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    const uint8_t *in = img->data + strlen( IMG_DECODER_RLE_MAGIC );
+    const uint8_t *in_end = img->data + img->data_size;
+    uint8_t *out = (uint8_t *)ps_malloc( out_len );
+    uint8_t *out_end = out + out_len;
+    uint8_t *pos = out;
+
+    if ( out == NULL ) {
+        log_e("image buffer alloc failed");
+        return( NULL );
+    }
+
+    while( in < in_end && pos < out_end ) {
+        uint8_t control = *in++;
+        size_t count = ( control & 0x7f ) + 1;
+
+        if ( control & 0x80 ) {
+            if ( in + LV_IMG_PX_SIZE_ALPHA_BYTE > in_end || pos + count * LV_IMG_PX_SIZE_ALPHA_BYTE > out_end ) {
+                break;
+            }
+            for( size_t i = 0 ; i < count ; i++ ) {
+                memcpy( pos, in, LV_IMG_PX_SIZE_ALPHA_BYTE );
+                pos += LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+            in += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+        else {
+            size_t len = count * LV_IMG_PX_SIZE_ALPHA_BYTE;
+            if ( in + len > in_end || pos + len > out_end ) {
+                break;
+            }
+            memcpy( pos, in, len );
+            pos += len;
+            in += len;
+        }
+    }
+
+    if ( pos != out_end ) {
+        log_e("corrupt image data, %d of %d bytes decoded", pos - out, out_len );
+        free( out );
+        return( NULL );
+    }
+
+    log_d("decode %dx%d image (%d -> %d bytes) in %dus", img->header.w, img->header.h, img->data_size, out_len, (uint32_t)( esp_timer_get_time() - start ) );
+    return( out );
+}
+
+static lv_res_t img_decoder_open_cb( lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc ) {
+    img_decoder_cache_t *slot = NULL;
+
+    dsc->user_data = NULL;
+    /*
+     * look for an already decoded image
+     */
+    for( int i = 0 ; i < IMG_DECODER_CACHE_SIZE ; i++ ) {
+        if ( img_decoder_cache[ i ].src == dsc->src ) {
+            img_decoder_cache[ i ].ref++;
+            img_decoder_cache[ i ].last_used = lv_tick_get();
+            dsc->img_data = img_decoder_cache[ i ].data;
+            return( LV_RES_OK );
+        }
+    }
+
+    uint8_t *data = img_decoder_decode( (const lv_img_dsc_t *)dsc->src );
+    if ( data == NULL ) {
+        return( LV_RES_INV );
+    }
+    /*
+     * take a free slot or drop the least recently used image that is not in use
+     */
+    for( int i = 0 ; i < IMG_DECODER_CACHE_SIZE ; i++ ) {
+        if ( img_decoder_cache[ i ].src == NULL ) {
+            slot = &img_decoder_cache[ i ];
+            break;
+        }
+        if ( img_decoder_cache[ i ].ref == 0 && ( slot == NULL || lv_tick_elaps( img_decoder_cache[ i ].last_used ) > lv_tick_elaps( slot->last_used ) ) ) {
+            slot = &img_decoder_cache[ i ];
+        }
+    }
+
+    if ( slot == NULL ) {
+        /*
+         * all cached images are on screen, keep this one only until it is closed
+         */
+        dsc->user_data = data;
+    }
+    else {
+        if ( slot->data ) {
+            free( slot->data );
+        }
+        slot->src = dsc->src;
+        slot->data = data;
+        slot->ref = 1;
+        slot->last_used = lv_tick_get();
+    }
+    dsc->img_data = data;
+    return( LV_RES_OK );
+}
+
+static void img_decoder_close_cb( lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc ) {
+    if ( dsc->user_data ) {
+        free( dsc->user_data );
+        dsc->user_data = NULL;
+        return;
+    }
+
+    for( int i = 0 ; i < IMG_DECODER_CACHE_SIZE ; i++ ) {
+        if ( img_decoder_cache[ i ].src == dsc->src && img_decoder_cache[ i ].ref ) {
+            img_decoder_cache[ i ].ref--;
+            return;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+/****************************************************************************
+ *   Oct 17 09:41:12 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _IMG_DECODER_H
+    #define _IMG_DECODER_H
+
+    #include "config.h"
+
+    #define IMG_DECODER_RLE_MAGIC       "RLEA"
+    #define IMG_DECODER_CACHE_SIZE      16      // number of decoded images kept in psram
+
+    /**
+     * run length compressed true color alpha images are stored as LV_IMG_CF_RAW_ALPHA.
+     * the data starts with IMG_DECODER_RLE_MAGIC and is followed by PackBits like runs of
+     * LV_IMG_PX_SIZE_ALPHA_BYTE sized pixels. a control byte c with bit 7 set is followed by
+     * one pixel that is repeated ( c & 0x7f ) + 1 times, otherwise c + 1 literal pixels follow.
+     * see tools/img2lvgl.py
+     */
+
+    /**
+     * @brief register the image decoder for run length compressed images
+     */
+    void img_decoder_setup( void );
+
+#endif // _IMG_DECODER_H
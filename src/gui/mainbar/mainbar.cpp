@@ -49,6 +49,14 @@ static lv_point_t *tile_pos_table = NULL;
 static uint32_t current_tile = 0;
 static uint32_t tile_entrys = 0;
 static uint32_t app_tile_pos = MAINBAR_APP_TILE_X_START;
+static lv_task_t *mainbar_hibernate_task = NULL;
+static bool mainbar_jumping = false;
+
+static void mainbar_event_cb( lv_obj_t *obj, lv_event_t event );
+static void mainbar_tile_changed( uint32_t tile_number );
+static void mainbar_app_create( uint32_t tile_number );
+static void mainbar_app_destroy( uint32_t tile_number );
+static void mainbar_hibernate_task_cb( lv_task_t *task );
 
 void mainbar_setup( void ) {
     lv_style_init( &mainbar_style );
@@ -76,6 +84,9 @@ void mainbar_setup( void ) {
     lv_tileview_set_edge_flash( mainbar, false);
     lv_obj_add_style( mainbar, LV_OBJ_PART_MAIN, &mainbar_style );
     lv_page_set_scrlbar_mode( mainbar, LV_SCRLBAR_MODE_OFF);
+    lv_obj_set_event_cb( mainbar, mainbar_event_cb );
+
+    mainbar_hibernate_task = lv_task_create( mainbar_hibernate_task_cb, MAINBAR_APP_HIBERNATE_INTERVAL, LV_TASK_PRIO_LOWEST, NULL );
 }
 
 uint32_t mainbar_add_tile( uint16_t x, uint16_t y, const char *id ) {
@@ -123,6 +134,12 @@ uint32_t mainbar_add_tile( uint16_t x, uint16_t y, const char *id ) {
     tile[ tile_entrys - 1 ].x = x;
     tile[ tile_entrys - 1 ].y = y;
     tile[ tile_entrys - 1 ].id = id;
+    tile[ tile_entrys - 1 ].app_tile = tile_entrys - 1;
+    tile[ tile_entrys - 1 ].app_tiles = 1;
+    tile[ tile_entrys - 1 ].create_cb = NULL;
+    tile[ tile_entrys - 1 ].destroy_cb = NULL;
+    tile[ tile_entrys - 1 ].created = true;
+    tile[ tile_entrys - 1 ].last_active = 0;
     lv_obj_set_size( tile[ tile_entrys - 1 ].tile, lv_disp_get_hor_res( NULL ), LV_VER_RES);
     //lv_obj_reset_style_list( tile[ tile_entrys - 1 ].tile, LV_OBJ_PART_MAIN );
     lv_obj_add_style( tile[ tile_entrys - 1 ].tile, LV_OBJ_PART_MAIN, &mainbar_style );
@@ -181,14 +198,71 @@ uint32_t mainbar_add_app_tile( uint16_t x, uint16_t y, const char *id ) {
                 retval = mainbar_add_tile( hor + app_tile_pos, ver + MAINBAR_APP_TILE_Y_START, id );
             }
             else {
-                mainbar_add_tile( hor + app_tile_pos, ver + MAINBAR_APP_TILE_Y_START, id );
+                uint32_t tile_number = mainbar_add_tile( hor + app_tile_pos, ver + MAINBAR_APP_TILE_Y_START, id );
+                tile[ tile_number ].app_tile = retval;
             }
         }
     }
+    tile[ retval ].app_tiles = x * y;
     app_tile_pos = app_tile_pos + x + 1;
     return( retval );
 }
 
+bool mainbar_add_app_tile_lifecycle_cb( uint32_t tile_number, MAINBAR_CALLBACK_FUNC create_cb, MAINBAR_CALLBACK_FUNC destroy_cb ) {
+    if ( tile_number < tile_entrys ) {
+        uint32_t app_tile = tile[ tile_number ].app_tile;
+        tile[ app_tile ].create_cb = create_cb;
+        tile[ app_tile ].destroy_cb = destroy_cb;
+        tile[ app_tile ].created = false;
+        return( true );
+    }
+    else {
+        log_e("tile number %d do not exist", tile_number );
+        return( false );
+    }
+}
+
+static void mainbar_app_create( uint32_t tile_number ) {
+    uint32_t app_tile = tile[ tile_number ].app_tile;
+
+    if ( tile[ app_tile ].created || tile[ app_tile ].create_cb == NULL ) {
+        return;
+    }
+
+    uint32_t start = millis();
+    uint32_t free_heap = ESP.getFreeHeap();
+    tile[ app_tile ].create_cb();
+    tile[ app_tile ].created = true;
+    log_i("create app tile: %s, %dms, heap: %d -> %d", tile[ app_tile ].id, millis() - start, free_heap, ESP.getFreeHeap() );
+}
+
+static void mainbar_app_destroy( uint32_t tile_number ) {
+    uint32_t free_heap = ESP.getFreeHeap();
+
+    for ( int i = tile_number ; i < tile_number + tile[ tile_number ].app_tiles ; i++ ) {
+        lv_obj_clean( tile[ i ].tile );
+        tile[ i ].activate_cb = NULL;
+        tile[ i ].hibernate_cb = NULL;
+    }
+    tile[ tile_number ].destroy_cb();
+    tile[ tile_number ].created = false;
+    log_i("destroy app tile: %s, heap: %d -> %d", tile[ tile_number ].id, free_heap, ESP.getFreeHeap() );
+}
+
+static void mainbar_hibernate_task_cb( lv_task_t *task ) {
+    for ( int i = 0 ; i < tile_entrys ; i++ ) {
+        if ( tile[ i ].app_tile != i || !tile[ i ].created || tile[ i ].destroy_cb == NULL ) {
+            continue;
+        }
+        if ( tile[ current_tile ].app_tile == i ) {
+            continue;
+        }
+        if ( millis() - tile[ i ].last_active > MAINBAR_APP_HIBERNATE_TIMEOUT ) {
+            mainbar_app_destroy( i );
+        }
+    }
+}
+
 lv_obj_t *mainbar_get_tile_obj( uint32_t tile_number ) {
     if ( tile_number < tile_entrys ) {
         return( tile[ tile_number ].tile );
@@ -212,24 +286,50 @@ void mainbar_jump_to_maintile( lv_anim_enable_t anim ) {
 void mainbar_jump_to_tilenumber( uint32_t tile_number, lv_anim_enable_t anim ) {
     if ( tile_number < tile_entrys ) {
         log_i("jump to tile %d from tile %d", tile_number, current_tile );
+        mainbar_jumping = true;
         lv_tileview_set_tile_act( mainbar, tile_pos_table[ tile_number ].x, tile_pos_table[ tile_number ].y, anim );
-        // call hibernate callback for the current tile if exist
-        if ( tile[ current_tile ].hibernate_cb != NULL ) {
-            log_i("call hibernate cb for tile: %d", current_tile );
-            tile[ current_tile ].hibernate_cb();
-        }
-        // call activate callback for the new tile if exist
-        if ( tile[ tile_number ].activate_cb != NULL ) { 
-            log_i("call activate cb for tile: %d", tile_number );
-            tile[ tile_number ].activate_cb();
-        }
-        current_tile = tile_number;
+        mainbar_jumping = false;
+        mainbar_tile_changed( tile_number );
     }
     else {
         log_e( "tile number %d do not exist", tile_number );
     }
 }
 
+static void mainbar_event_cb( lv_obj_t *obj, lv_event_t event ) {
+    switch( event ) {
+        /*
+         * the tileview sends the index into tile_pos_table, which is the tile number,
+         * at the end of a swipe and on lv_tileview_set_tile_act()
+         */
+        case( LV_EVENT_VALUE_CHANGED ): if ( !mainbar_jumping ) {
+                                            uint32_t tile_number = *( uint32_t * )lv_event_get_data();
+                                            if ( tile_number < tile_entrys && tile_number != current_tile ) {
+                                                log_i("swipe to tile %d from tile %d", tile_number, current_tile );
+                                                mainbar_tile_changed( tile_number );
+                                            }
+                                        }
+                                        break;
+    }
+}
+
+static void mainbar_tile_changed( uint32_t tile_number ) {
+    // call hibernate callback for the current tile if exist
+    if ( tile[ current_tile ].hibernate_cb != NULL ) {
+        log_i("call hibernate cb for tile: %d", current_tile );
+        tile[ current_tile ].hibernate_cb();
+    }
+    tile[ tile[ current_tile ].app_tile ].last_active = millis();
+    // build the app tiles on first use
+    mainbar_app_create( tile_number );
+    // call activate callback for the new tile if exist
+    if ( tile[ tile_number ].activate_cb != NULL ) { 
+        log_i("call activate cb for tile: %d", tile_number );
+        tile[ tile_number ].activate_cb();
+    }
+    current_tile = tile_number;
+}
+
 lv_obj_t * mainbar_obj_create(lv_obj_t *parent)
 {
     lv_obj_t * child = lv_obj_create( parent, NULL );
@@ -33,10 +33,18 @@
         uint16_t x;
         uint16_t y;
         const char *id;
+        uint32_t app_tile;                  // first tile of the app tile formation
+        uint16_t app_tiles;                 // number of tiles in the app tile formation, only on the first tile
+        MAINBAR_CALLBACK_FUNC create_cb;    // only on the first tile, see mainbar_add_app_tile_lifecycle_cb()
+        MAINBAR_CALLBACK_FUNC destroy_cb;
+        bool created;
+        uint32_t last_active;
     } lv_tile_t;
 
-    #define MAINBAR_APP_TILE_X_START     0
-    #define MAINBAR_APP_TILE_Y_START     4
+    #define MAINBAR_APP_TILE_X_START        0
+    #define MAINBAR_APP_TILE_Y_START        4
+    #define MAINBAR_APP_HIBERNATE_TIMEOUT   60000   // ms after leaving an app until its object tree is deleted
+    #define MAINBAR_APP_HIBERNATE_INTERVAL  10000   // ms between two checks for idle apps
 
     /**
      * @brief mainbar setup funktion
@@ -88,6 +96,21 @@
      * @return  tile number, if get more than 1 tile it is the first tile number
      */
     uint32_t mainbar_add_app_tile( uint16_t x, uint16_t y, const char *id );
+    /**
+     * @brief build the object tree of an app tile formation on the first activation instead of at boot time.
+     *  create_cb is called before the first jump into one of the app tiles and builds all app tiles,
+     *  activate and hibernate callbacks are registered from there. with a destroy_cb the object tree is
+     *  deleted MAINBAR_APP_HIBERNATE_TIMEOUT ms after leaving the app and destroy_cb is called after that,
+     *  it must stop all tasks and reset all pointers into the deleted object tree. event callbacks
+     *  (blectl, wifictl, ...) are registered at setup time, they must check the pointers before use
+     * 
+     * @param   tile_number     first tile number from mainbar_add_app_tile()
+     * @param   create_cb       pointer to the create callback function
+     * @param   destroy_cb      pointer to the destroy callback function or NULL to keep the object tree
+     * 
+     * @return  true or false, true means registration was success
+     */
+    bool mainbar_add_app_tile_lifecycle_cb( uint32_t tile_number, MAINBAR_CALLBACK_FUNC create_cb, MAINBAR_CALLBACK_FUNC destroy_cb );
     /**
      * @brief get the lv_obj_t for a specific tile number
      *
@@ -119,7 +119,7 @@ void battery_settings_tile_setup( void ) {
     lv_obj_set_event_cb( battery_percent_switch, battery_percent_switch_event_handler );
     lv_obj_t *stepcounter_label = lv_label_create( battery_percent_switch_cont, NULL);
     lv_obj_add_style( stepcounter_label, LV_OBJ_PART_MAIN, &battery_settings_style  );
-    lv_label_set_text( stepcounter_label, "calculated percent");
+    lv_label_set_text( stepcounter_label, "fuel gauge");
     lv_obj_align( stepcounter_label, battery_percent_switch_cont, LV_ALIGN_IN_LEFT_MID, 5, 0 );
 
     lv_obj_t *battery_experimental_switch_cont = lv_obj_create( battery_settings_tile, NULL );
@@ -158,7 +158,7 @@ void battery_settings_tile_setup( void ) {
 }
 
 void battery_set_experimental_indicator( void ) {
-    if ( pmu_get_experimental_power_save() || pmu_get_calculated_percent() ) {
+    if ( pmu_get_experimental_power_save() ) {
         setup_set_indicator( battery_setup_icon, ICON_INDICATOR_N );
     }
     else {
@@ -39,7 +39,9 @@ lv_obj_t *battery_view_voltage;
 lv_obj_t *charge_view_current;
 lv_obj_t *discharge_view_current;
 lv_obj_t *vbus_view_voltage;
+lv_obj_t *battery_view_runtime;
 lv_task_t *battery_view_task;
+static uint32_t battery_view_snapshot_version = 0;
 
 LV_IMG_DECLARE(exit_32px);
 LV_IMG_DECLARE(setup_32px);
@@ -92,7 +94,7 @@ void battery_view_tile_setup( uint32_t tile_num ) {
     lv_obj_align( battery_design_cont, battery_view_tile, LV_ALIGN_IN_TOP_RIGHT, 0, 75 );
     lv_obj_t *battery_design_cap_label = lv_label_create( battery_design_cont, NULL);
     lv_obj_add_style( battery_design_cap_label, LV_OBJ_PART_MAIN, &battery_view_style  );
-    lv_label_set_text( battery_design_cap_label, "designed cap");
+    lv_label_set_text( battery_design_cap_label, "learned/designed");
     lv_obj_align( battery_design_cap_label, battery_design_cont, LV_ALIGN_IN_LEFT_MID, 5, 0 );
     battery_view_design_cap = lv_label_create( battery_design_cont, NULL);
     lv_obj_add_style( battery_view_design_cap, LV_OBJ_PART_MAIN, &battery_view_style  );
@@ -164,6 +166,19 @@ void battery_view_tile_setup( uint32_t tile_num ) {
     lv_label_set_text( vbus_view_voltage, "2.4mV");
     lv_obj_align( vbus_view_voltage, vbus_voltage_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
+    lv_obj_t *battery_runtime_cont = lv_obj_create( battery_view_tile, NULL );
+    lv_obj_set_size( battery_runtime_cont, lv_disp_get_hor_res( NULL ) , 22 );
+    lv_obj_add_style( battery_runtime_cont, LV_OBJ_PART_MAIN, &battery_view_style  );
+    lv_obj_align( battery_runtime_cont, vbus_voltage_cont, LV_ALIGN_OUT_BOTTOM_MID, 0, 0 );
+    lv_obj_t *battery_runtime_label = lv_label_create( battery_runtime_cont, NULL);
+    lv_obj_add_style( battery_runtime_label, LV_OBJ_PART_MAIN, &battery_view_style  );
+    lv_label_set_text( battery_runtime_label, "runtime");
+    lv_obj_align( battery_runtime_label, battery_runtime_cont, LV_ALIGN_IN_LEFT_MID, 5, 0 );
+    battery_view_runtime = lv_label_create( battery_runtime_cont, NULL);
+    lv_obj_add_style( battery_view_runtime, LV_OBJ_PART_MAIN, &battery_view_style  );
+    lv_label_set_text( battery_view_runtime, "unknown");
+    lv_obj_align( battery_view_runtime, battery_runtime_cont, LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+
     mainbar_add_tile_activate_cb( battery_view_tile_num, battery_activate_cb );
     mainbar_add_tile_activate_cb( battery_view_tile_num + 1, battery_activate_cb );
     mainbar_add_tile_hibernate_cb( battery_view_tile_num, battery_hibernate_cb );
@@ -171,6 +186,7 @@ void battery_view_tile_setup( uint32_t tile_num ) {
 }
 
 void battery_activate_cb( void ) {
+    battery_view_snapshot_version = 0;
     battery_view_task = lv_task_create(battery_view_update_task, 1000,  LV_TASK_PRIO_LOWEST, NULL );
 }
 
@@ -195,10 +211,22 @@ static void exit_battery_view_event_cb( lv_obj_t * obj, lv_event_t event ) {
 
 
 void battery_view_update_task( lv_task_t *task ) {
+    pmu_snapshot_t snapshot;
+    fuelgauge_t gauge;
     char temp[16]="";
 
+    /*
+     * only redraw on a new pmu snapshot
+     */
+    pmu_get_snapshot( &snapshot );
+    if ( snapshot.version == battery_view_snapshot_version ) {
+        return;
+    }
+    battery_view_snapshot_version = snapshot.version;
+    pmu_get_fuelgauge( &gauge );
+
     if ( pmu_get_battery_percent( ) >= 0 ) {
-        snprintf( temp, sizeof( temp ), "%0.1fmAh", pmu_get_coulumb_data() );
+        snprintf( temp, sizeof( temp ), "%0.1fmAh", gauge.soc * gauge.capacity );
     }
     else {
         snprintf( temp, sizeof( temp ), "unknown" );        
@@ -206,23 +234,33 @@ void battery_view_update_task( lv_task_t *task ) {
     lv_label_set_text( battery_view_current_cap, temp );
     lv_obj_align( battery_view_current_cap, lv_obj_get_parent( battery_view_current_cap ), LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
-    snprintf( temp, sizeof( temp ), "%dmAh", pmu_get_designed_battery_cap() );
+    snprintf( temp, sizeof( temp ), "%.0f/%dmAh", gauge.capacity, pmu_get_designed_battery_cap() );
     lv_label_set_text( battery_view_design_cap, temp );
     lv_obj_align( battery_view_design_cap, lv_obj_get_parent( battery_view_design_cap ), LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
-    snprintf( temp, sizeof( temp ), "%0.2fV", pmu_get_battery_voltage() / 1000 );
+    snprintf( temp, sizeof( temp ), "%0.2fV", snapshot.batt_voltage / 1000 );
     lv_label_set_text( battery_view_voltage, temp );
     lv_obj_align( battery_view_voltage, lv_obj_get_parent( battery_view_voltage ), LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
-    snprintf( temp, sizeof( temp ), "%0.1fmA", pmu_get_battery_charge_current() );
+    snprintf( temp, sizeof( temp ), "%0.1fmA", snapshot.charge_current );
     lv_label_set_text( charge_view_current, temp );
     lv_obj_align( charge_view_current, lv_obj_get_parent( charge_view_current ), LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
-    snprintf( temp, sizeof( temp ), "%0.1fmA", pmu_get_battery_discharge_current() );
+    snprintf( temp, sizeof( temp ), "%0.1fmA", snapshot.discharge_current );
     lv_label_set_text( discharge_view_current, temp );
     lv_obj_align( discharge_view_current, lv_obj_get_parent( discharge_view_current ), LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 
-    snprintf( temp, sizeof( temp ), "%0.2fV", pmu_get_vbus_voltage() / 1000 );
+    snprintf( temp, sizeof( temp ), "%0.2fV", snapshot.vbus_voltage / 1000 );
     lv_label_set_text( vbus_view_voltage, temp );
     lv_obj_align( vbus_view_voltage, lv_obj_get_parent( vbus_view_voltage ), LV_ALIGN_IN_RIGHT_MID, -5, 0 );
+
+    int32_t runtime = fuelgauge_get_runtime( &gauge );
+    if ( runtime >= 0 ) {
+        snprintf( temp, sizeof( temp ), "%dh %02dmin", runtime / 60, runtime % 60 );
+    }
+    else {
+        snprintf( temp, sizeof( temp ), "unknown" );
+    }
+    lv_label_set_text( battery_view_runtime, temp );
+    lv_obj_align( battery_view_runtime, lv_obj_get_parent( battery_view_runtime ), LV_ALIGN_IN_RIGHT_MID, -5, 0 );
 }
@@ -28,7 +28,7 @@
 #include "hardware/blectl.h"
 #include "hardware/powermgm.h"
 #include "hardware/motor.h"
-#include "hardware/json_psram_allocator.h"
+#include "hardware/json_msg.h"
 
 lv_obj_t *bluetooth_call_tile=NULL;
 lv_style_t bluetooth_call_style;
@@ -44,7 +44,7 @@ LV_FONT_DECLARE(Ubuntu_16px);
 
 static void exit_bluetooth_call_event_cb( lv_obj_t * obj, lv_event_t event );
 bool bluetooth_call_event_cb( EventBits_t event, void *arg );
-static void bluetooth_call_msg_pharse( const char* msg );
+static void bluetooth_call_msg_pharse( JsonDocument &doc );
 
 void bluetooth_call_tile_setup( void ) {
     // get an app tile and copy mainstyle
@@ -76,12 +76,12 @@ void bluetooth_call_tile_setup( void ) {
     lv_obj_align( exit_btn, bluetooth_call_tile, LV_ALIGN_IN_TOP_RIGHT, -10, 10 );
     lv_obj_set_event_cb( exit_btn, exit_bluetooth_call_event_cb );
 
-    blectl_register_cb( BLECTL_MSG, bluetooth_call_event_cb, "bluetooth_call" );
+    blectl_register_cb( BLECTL_MSG_JSON, bluetooth_call_event_cb, "bluetooth_call" );
 }
 
 bool bluetooth_call_event_cb( EventBits_t event, void *arg ) {
     switch( event ) {
-        case BLECTL_MSG:            bluetooth_call_msg_pharse( (const char*)arg );
+        case BLECTL_MSG_JSON:       bluetooth_call_msg_pharse( *(JsonDocument*)arg );
                                     break;
     }
     return( true );
@@ -94,54 +94,45 @@ static void exit_bluetooth_call_event_cb( lv_obj_t * obj, lv_event_t event ) {
     }
 }
 
-void bluetooth_call_msg_pharse( const char* msg ) {
+void bluetooth_call_msg_pharse( JsonDocument &doc ) {
     static bool standby = false;
 
-    SpiRamJsonDocument doc( strlen( msg ) * 4 );
-
-    DeserializationError error = deserializeJson( doc, msg );
-    if ( error ) {
-        log_e("bluetooth call deserializeJson() failed: %s", error.c_str() );
-    }
-    else {
-        if ( doc["t"] && doc["cmd"] ) {
-            if( !strcmp( doc["t"], "call" ) && !strcmp( doc["cmd"], "accept" ) ) {
-                statusbar_hide( true );
-                if ( powermgm_get_event( POWERMGM_STANDBY ) ) {
-                    standby = true;
-                }
-                else {
-                    standby = false;
-                }
-                
-                powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
-                mainbar_jump_to_tilenumber( bluetooth_call_tile_num, LV_ANIM_OFF );
-                if ( doc["number"] ) {
-                    if ( doc["name"] ) {
-                        lv_label_set_text( bluetooth_call_number_label, doc["name"] );
-                    }
-                    else {
-                        lv_label_set_text( bluetooth_call_number_label, doc["number"] );
-                    }
+    if ( doc["t"] && doc["cmd"] ) {
+        if( !strcmp( doc["t"], "call" ) && !strcmp( doc["cmd"], "accept" ) ) {
+            statusbar_hide( true );
+            if ( powermgm_get_event( POWERMGM_STANDBY ) ) {
+                standby = true;
+            }
+            else {
+                standby = false;
+            }
+            
+            powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
+            mainbar_jump_to_tilenumber( bluetooth_call_tile_num, LV_ANIM_OFF );
+            if ( doc["number"] ) {
+                if ( doc["name"] ) {
+                    lv_label_set_text( bluetooth_call_number_label, doc["name"] );
                 }
                 else {
-                    lv_label_set_text( bluetooth_call_number_label, "n/a" );
+                    lv_label_set_text( bluetooth_call_number_label, doc["number"] );
                 }
-                lv_obj_align( bluetooth_call_number_label, bluetooth_call_img, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );                
-                lv_obj_invalidate( lv_scr_act() );
-                motor_vibe(100);            
             }
+            else {
+                lv_label_set_text( bluetooth_call_number_label, "n/a" );
+            }
+            lv_obj_align( bluetooth_call_number_label, bluetooth_call_img, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );                
+            lv_obj_invalidate( lv_scr_act() );
+            motor_vibe(100);            
         }
+    }
 
-        if ( doc["t"] && doc["cmd"] ) {
-            if( !strcmp( doc["t"], "call" ) && !strcmp( doc["cmd"], "start" ) ) {
-                if ( standby == true ) {
-                    powermgm_set_event( POWERMGM_STANDBY_REQUEST );
-                }
-                mainbar_jump_to_maintile( LV_ANIM_OFF );
-                lv_obj_invalidate( lv_scr_act() );
+    if ( doc["t"] && doc["cmd"] ) {
+        if( !strcmp( doc["t"], "call" ) && !strcmp( doc["cmd"], "start" ) ) {
+            if ( standby == true ) {
+                powermgm_set_event( POWERMGM_STANDBY_REQUEST );
             }
+            mainbar_jump_to_maintile( LV_ANIM_OFF );
+            lv_obj_invalidate( lv_scr_act() );
         }
-    }        
-    doc.clear();
+    }
 }
@@ -29,7 +29,7 @@
 #include "hardware/blectl.h"
 #include "hardware/powermgm.h"
 #include "hardware/motor.h"
-#include "hardware/json_psram_allocator.h"
+#include "hardware/json_msg.h"
 #include "hardware/sound.h"
 
 lv_obj_t *bluetooth_message_tile=NULL;
@@ -73,7 +73,7 @@ static bool bluetooth_message_active = true;
 
 static void exit_bluetooth_message_event_cb( lv_obj_t * obj, lv_event_t event );
 bool bluetooth_message_event_cb( EventBits_t event, void *arg );
-static void bluetooth_message_msg_pharse( const char* msg );
+static void bluetooth_message_msg_pharse( JsonDocument &doc );
 const lv_img_dsc_t *bluetooth_message_find_img( const char * src_name );
 
 void bluetooth_message_tile_setup( void ) {
@@ -126,14 +126,12 @@ void bluetooth_message_tile_setup( void ) {
     lv_obj_align( exit_btn, bluetooth_message_tile, LV_ALIGN_IN_TOP_RIGHT, -10, 10 );
     lv_obj_set_event_cb( exit_btn, exit_bluetooth_message_event_cb );
 
-    blectl_register_cb( BLECTL_MSG, bluetooth_message_event_cb, "bluetooth_message" );
+    blectl_register_cb( BLECTL_MSG_JSON, bluetooth_message_event_cb, "bluetooth_message" );
 }
 
 bool bluetooth_message_event_cb( EventBits_t event, void *arg ) {
-    log_i("msg = %s", (char*)arg );
-    
     switch( event ) {
-        case BLECTL_MSG:            bluetooth_message_msg_pharse( (const char*)arg );
+        case BLECTL_MSG_JSON:       bluetooth_message_msg_pharse( *(JsonDocument*)arg );
                                     break;
     }
     return( true );
@@ -167,18 +165,12 @@ const lv_img_dsc_t *bluetooth_message_find_img( const char * src_name ) {
     return( &message_32px );
 }
 
-void bluetooth_message_msg_pharse( const char* msg ) {
+void bluetooth_message_msg_pharse( JsonDocument &doc ) {
     if ( bluetooth_message_active == false ) {
         return;
     }
 
-    SpiRamJsonDocument doc( strlen( msg ) * 4 );
-
-    DeserializationError error = deserializeJson( doc, msg );
-    if ( error ) {
-        log_e("bluetooth message deserializeJson() failed: %s", error.c_str() );
-    }
-    else {
+    if ( doc["t"] ) {
         if( !strcmp( doc["t"], "notify" ) ) {
             statusbar_hide( true );
 
@@ -222,6 +214,5 @@ void bluetooth_message_msg_pharse( const char* msg ) {
 
             sound_play_progmem_wav( piep_wav, piep_wav_len );
         }
-    }        
-    doc.clear();
+    }
 }
@@ -37,12 +37,14 @@
 #include "hardware/powermgm.h"
 #include "hardware/wifictl.h"
 #include "hardware/motor.h"
+#include "hardware/config_store.h"
 #include "hardware/http_ota.h"
+#include "hardware/jobqueue.h"
 
 EventGroupHandle_t update_event_handle = NULL;
-TaskHandle_t _update_Task;
 lv_task_t *_update_progress_task;
-void update_Task( void * pvParameters );
+static void update_check_version_job( void *arg );
+static void update_job( void *arg );
 
 icon_t *update_setup_icon = NULL;
 
@@ -50,6 +52,7 @@ lv_obj_t *update_settings_tile=NULL;
 lv_style_t update_settings_style;
 uint32_t update_tile_num;
 static int16_t progress = 0;
+static uint32_t throughput = 0;
 
 lv_obj_t *update_btn = NULL;
 lv_obj_t *update_status_label = NULL;
@@ -147,7 +150,7 @@ void update_tile_setup( void ) {
     lv_bar_set_value( update_progressbar, 0, LV_ANIM_ON );
 
     wifictl_register_cb( WIFICTL_CONNECT, update_wifictl_event_cb, "update" );
-    http_ota_register_cb( HTTP_OTA_PROGRESS | HTTP_OTA_ERROR, update_http_ota_event_cb, "http updater");
+    http_ota_register_cb( HTTP_OTA_PROGRESS | HTTP_OTA_THROUGHPUT | HTTP_OTA_ERROR, update_http_ota_event_cb, "http updater");
 
     mainbar_add_tile_activate_cb( update_tile_num, update_update_activate_cb );
     mainbar_add_tile_hibernate_cb( update_tile_num, update_update_hibernate_cb );
@@ -166,9 +169,9 @@ void update_update_hibernate_cb( void ) {
 
 void update_progress_task( lv_task_t *task ) {
     if ( progress > 0 ) {
-        char msg[16]="";
+        char msg[24]="";
         lv_bar_set_value( update_progressbar, progress , LV_ANIM_ON );
-        snprintf( msg, sizeof( msg ), "%d%%", progress );
+        snprintf( msg, sizeof( msg ), "%d%%, %dKB/s", progress, throughput );
         lv_label_set_text( update_status_label, msg );
         lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
     }
@@ -180,6 +183,9 @@ bool update_http_ota_event_cb( EventBits_t event, void *arg ) {
         case HTTP_OTA_PROGRESS:
             progress = *(int16_t *)arg;
             break;
+        case HTTP_OTA_THROUGHPUT:
+            throughput = *(uint32_t *)arg;
+            break;
         case HTTP_OTA_ERROR:        
             lv_label_set_text( update_status_label, (char *)arg );
             lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
@@ -231,6 +237,7 @@ static void update_event_handler(lv_obj_t * obj, lv_event_t event) {
             delay(20);
             display_standby();
             ttgo->stopLvglTick();
+            config_store_commit();
             SPIFFS.end();
             log_i("SPIFFS unmounted!");
             delay(500);
@@ -240,13 +247,7 @@ static void update_event_handler(lv_obj_t * obj, lv_event_t event) {
             return;
         }
         else {
-            xEventGroupSetBits( update_event_handle, UPDATE_REQUEST );
-            xTaskCreate(    update_Task,
-                            "update Task",
-                            10000,
-                            NULL,
-                            0,
-                            &_update_Task );
+            jobqueue_submit( update_job, NULL, JOBQUEUE_PRIO_HIGH, 0, "update" );
         }
     }
 }
@@ -256,41 +257,48 @@ void update_check_version( void ) {
         return;
     }
     else {
-        xEventGroupSetBits( update_event_handle, UPDATE_GET_VERSION_REQUEST );
-        xTaskCreate(    update_Task,
-                        "update Task",
-                        5000,
-                        NULL,
-                        1,
-                        &_update_Task );
+        jobqueue_submit( update_check_version_job, NULL, JOBQUEUE_PRIO_LOW, JOBQUEUE_NETWORK, "update check version" );
     }
 }
 
-void update_Task( void * pvParameters ) {
-    log_i("start update task, heap: %d", ESP.getFreeHeap() );
-
-    if ( xEventGroupGetBits( update_event_handle) & UPDATE_GET_VERSION_REQUEST ) {
-        int64_t firmware_version = update_check_new_version( update_setup_get_url() );
-        if ( firmware_version > atol( __FIRMWARE__ ) && firmware_version > 0 ) {
-            char version_msg[48] = "";
-            snprintf( version_msg, sizeof( version_msg ), "new version: %lld", firmware_version );
-            lv_label_set_text( update_status_label, (const char*)version_msg );
-            lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
-            setup_set_indicator( update_setup_icon, ICON_INDICATOR_1 );
-        }
-        else if ( firmware_version == atol( __FIRMWARE__ ) ) {
-            lv_label_set_text( update_status_label, "yeah! up to date ..." );
-            lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );  
-            setup_hide_indicator( update_setup_icon );
-        }
-        else {
-            lv_label_set_text( update_status_label, "get update info failed" );
-            lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );  
-            setup_hide_indicator( update_setup_icon );
-        }
-        lv_obj_invalidate( lv_scr_act() );
+static void update_check_version_job( void *arg ) {
+    /*
+     * the update itself can be queued or running on the other worker
+     */
+    if ( xEventGroupGetBits( update_event_handle ) & UPDATE_REQUEST ) {
+        return;
     }
-    if ( ( xEventGroupGetBits( update_event_handle) & UPDATE_REQUEST ) && ( update_get_url() != NULL ) ) {
+    xEventGroupSetBits( update_event_handle, UPDATE_GET_VERSION_REQUEST );
+    log_i("start update check version job, heap: %d", ESP.getFreeHeap() );
+
+    int64_t firmware_version = update_check_new_version( update_setup_get_url() );
+    if ( firmware_version > atol( __FIRMWARE__ ) && firmware_version > 0 ) {
+        char version_msg[48] = "";
+        snprintf( version_msg, sizeof( version_msg ), "new version: %lld", firmware_version );
+        lv_label_set_text( update_status_label, (const char*)version_msg );
+        lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );
+        setup_set_indicator( update_setup_icon, ICON_INDICATOR_1 );
+    }
+    else if ( firmware_version == atol( __FIRMWARE__ ) ) {
+        lv_label_set_text( update_status_label, "yeah! up to date ..." );
+        lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );  
+        setup_hide_indicator( update_setup_icon );
+    }
+    else {
+        lv_label_set_text( update_status_label, "get update info failed" );
+        lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );  
+        setup_hide_indicator( update_setup_icon );
+    }
+    lv_obj_invalidate( lv_scr_act() );
+    xEventGroupClearBits( update_event_handle, UPDATE_GET_VERSION_REQUEST );
+    log_i("finish update check version job, heap: %d", ESP.getFreeHeap() );
+}
+
+static void update_job( void *arg ) {
+    xEventGroupSetBits( update_event_handle, UPDATE_REQUEST );
+    log_i("start update job, heap: %d", ESP.getFreeHeap() );
+
+    if ( update_get_url() != NULL ) {
         if( WiFi.status() == WL_CONNECTED ) {
 
             uint32_t display_timeout = display_get_timeout();
@@ -307,6 +315,7 @@ void update_Task( void * pvParameters ) {
                 lv_label_set_text( update_btn_label, "restart");
             }
             progress = 0;
+            throughput = 0;
             lv_bar_set_value( update_progressbar, 0 , LV_ANIM_ON );            
             display_set_timeout( display_timeout );
             powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
@@ -316,9 +325,8 @@ void update_Task( void * pvParameters ) {
             lv_obj_align( update_status_label, update_btn, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );  
         }
     }
-    xEventGroupClearBits( update_event_handle, UPDATE_REQUEST | UPDATE_GET_VERSION_REQUEST );
+    xEventGroupClearBits( update_event_handle, UPDATE_REQUEST );
     lv_disp_trig_activity(NULL);
     lv_obj_invalidate( lv_scr_act() );
-    log_i("finish update task, heap: %d", ESP.getFreeHeap() );
-    vTaskDelete( NULL );
+    log_i("finish update job, heap: %d", ESP.getFreeHeap() );
 }
\ No newline at end of file
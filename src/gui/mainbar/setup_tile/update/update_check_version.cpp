@@ -24,6 +24,7 @@
 
 #include "update_check_version.h"
 #include "hardware/json_psram_allocator.h"
+#include "hardware/http_pool.h"
 
 char *firmwarehost = NULL;
 char *firmwarefile = NULL;
@@ -35,29 +36,32 @@ int64_t firmwareversion = -1;
 int64_t update_check_new_version( char *url ) {
     int httpcode = -1;
 
-    HTTPClient check_update_client;
+    HTTPClient *check_update_client = http_pool_begin( url );
+    if ( check_update_client == NULL ) {
+        log_e("HTTPClient begin failed");
+        return( -1 );
+    }
 
-    check_update_client.setUserAgent( "ESP32-" __FIRMWARE__ );
-    check_update_client.begin( url );
-    httpcode = check_update_client.GET();
+    check_update_client->setUserAgent( "ESP32-" __FIRMWARE__ );
+    httpcode = http_pool_get( check_update_client );
 
     if ( httpcode != 200 ) {
         log_e("HTTPClient error %d", httpcode );
-        check_update_client.end();
+        http_pool_end( check_update_client, false );
         return( -1 );
     }
 
-    SpiRamJsonDocument doc( check_update_client.getSize() * 4 );
+    SpiRamJsonDocument doc( check_update_client->getSize() * 4 );
 
-    DeserializationError error = deserializeJson( doc, check_update_client.getStream() );
+    DeserializationError error = deserializeJson( doc, check_update_client->getStream() );
     if (error) {
         log_e("update check deserializeJson() failed: %s", error.c_str() );
         doc.clear();
-        check_update_client.end();
+        http_pool_end( check_update_client, false );
         return( -1 );
     }
 
-    check_update_client.end();
+    http_pool_end( check_update_client, true );
 
     if ( doc["host"] ) {
         if ( firmwarehost == NULL ) {
@@ -30,6 +30,7 @@
 #include "gui/keyboard.h"
 
 #include "hardware/json_psram_allocator.h"
+#include "hardware/config_store.h"
 
 static update_config_t *update_config = NULL;
 
@@ -159,31 +160,13 @@ static void exit_update_check_setup_event_cb( lv_obj_t * obj, lv_event_t event )
 }
 
 void update_save_config( void ) {
-    if ( SPIFFS.exists( UPDATE_CONFIG_FILE ) ) {
-        SPIFFS.remove( UPDATE_CONFIG_FILE );
-        log_i("remove old binary update config");
-    }
-
-    fs::File file = SPIFFS.open( UPDATE_JSON_CONFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", UPDATE_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["autosync"] = update_config->autosync;
-        doc["updateurl"] = update_config->updateurl;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( update_config );
 }
 
-void update_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void update_read_json_config( void ) {
     if ( SPIFFS.exists( UPDATE_JSON_CONFIG_FILE ) ) {       
         fs::File file = SPIFFS.open( UPDATE_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -228,6 +211,10 @@ void update_read_config( void ) {
     }
 }
 
+void update_read_config( void ) {
+    config_store_register( "update", update_config, sizeof( update_config_t ), update_read_json_config );
+}
+
 bool update_setup_get_autosync( void ) {
     return( update_config->autosync );
 }
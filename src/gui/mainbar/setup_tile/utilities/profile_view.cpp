@@ -0,0 +1,155 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <TTGO.h>
+#include "profile_view.h"
+
+#include "gui/mainbar/mainbar.h"
+#include "gui/mainbar/setup_tile/setup_tile.h"
+#include "gui/statusbar.h"
+
+#include "hardware/powermgm.h"
+#include "hardware/callback.h"
+
+#define PROFILE_VIEW_TOP_ENTRYS     6
+
+lv_obj_t *profile_view_tile = NULL;
+lv_style_t profile_view_style;
+uint32_t profile_view_tile_num;
+
+lv_obj_t *profile_view_label = NULL;
+lv_task_t *profile_view_task = NULL;
+
+LV_IMG_DECLARE(exit_32px);
+
+static void exit_profile_view_event_cb( lv_obj_t * obj, lv_event_t event );
+static void profile_view_update_task( lv_task_t *task );
+static void profile_view_activate_cb( void );
+static void profile_view_hibernate_cb( void );
+
+void profile_view_tile_setup( void ) {
+    // get an app tile and copy mainstyle
+    profile_view_tile_num = mainbar_add_app_tile( 1, 1, "profile view" );
+    profile_view_tile = mainbar_get_tile_obj( profile_view_tile_num );
+
+    lv_style_copy( &profile_view_style, mainbar_get_style() );
+    lv_style_set_bg_color( &profile_view_style, LV_OBJ_PART_MAIN, LV_COLOR_GRAY);
+    lv_style_set_bg_opa( &profile_view_style, LV_OBJ_PART_MAIN, LV_OPA_100);
+    lv_style_set_border_width( &profile_view_style, LV_OBJ_PART_MAIN, 0);
+    lv_obj_add_style( profile_view_tile, LV_OBJ_PART_MAIN, &profile_view_style );
+
+    lv_obj_t *exit_btn = lv_imgbtn_create( profile_view_tile, NULL);
+    lv_imgbtn_set_src( exit_btn, LV_BTN_STATE_RELEASED, &exit_32px);
+    lv_imgbtn_set_src( exit_btn, LV_BTN_STATE_PRESSED, &exit_32px);
+    lv_imgbtn_set_src( exit_btn, LV_BTN_STATE_CHECKED_RELEASED, &exit_32px);
+    lv_imgbtn_set_src( exit_btn, LV_BTN_STATE_CHECKED_PRESSED, &exit_32px);
+    lv_obj_add_style( exit_btn, LV_IMGBTN_PART_MAIN, &profile_view_style );
+    lv_obj_align( exit_btn, profile_view_tile, LV_ALIGN_IN_TOP_LEFT, 10, STATUSBAR_HEIGHT + 10 );
+    lv_obj_set_event_cb( exit_btn, exit_profile_view_event_cb );
+
+    lv_obj_t *exit_label = lv_label_create( profile_view_tile, NULL);
+    lv_obj_add_style( exit_label, LV_OBJ_PART_MAIN, &profile_view_style  );
+    lv_label_set_text( exit_label, "Profile");
+    lv_obj_align( exit_label, exit_btn, LV_ALIGN_OUT_RIGHT_MID, 5, 0 );
+
+    profile_view_label = lv_label_create( profile_view_tile, NULL);
+    lv_obj_add_style( profile_view_label, LV_OBJ_PART_MAIN, &profile_view_style  );
+    lv_label_set_long_mode( profile_view_label, LV_LABEL_LONG_CROP );
+    lv_obj_set_size( profile_view_label, lv_disp_get_hor_res( NULL ) - 20, lv_disp_get_ver_res( NULL ) - STATUSBAR_HEIGHT - 60 );
+    lv_label_set_text( profile_view_label, "" );
+    lv_obj_align( profile_view_label, profile_view_tile, LV_ALIGN_IN_TOP_LEFT, 10, STATUSBAR_HEIGHT + 50 );
+
+    mainbar_add_tile_activate_cb( profile_view_tile_num, profile_view_activate_cb );
+    mainbar_add_tile_hibernate_cb( profile_view_tile_num, profile_view_hibernate_cb );
+}
+
+uint32_t profile_view_get_tile_num( void ) {
+    return( profile_view_tile_num );
+}
+
+static void profile_view_activate_cb( void ) {
+    profile_view_update_task( NULL );
+    profile_view_task = lv_task_create( profile_view_update_task, 1000,  LV_TASK_PRIO_LOWEST, NULL );
+}
+
+static void profile_view_hibernate_cb( void ) {
+    if ( profile_view_task ) {
+        lv_task_del( profile_view_task );
+        profile_view_task = NULL;
+    }
+}
+
+static void exit_profile_view_event_cb( lv_obj_t * obj, lv_event_t event ) {
+    switch( event ) {
+        case( LV_EVENT_CLICKED ):       mainbar_jump_to_tilenumber( setup_get_tile_num(), LV_ANIM_OFF );
+                                        break;
+    }
+}
+
+static void profile_view_update_task( lv_task_t *task ) {
+    callback_table_t top[ PROFILE_VIEW_TOP_ENTRYS ];
+    int top_entrys = 0;
+    char text[ 384 ] = "";
+    size_t len = 0;
+
+    powermgm_stats_t *stats = powermgm_get_stats();
+    uint64_t total = stats->standby + stats->silence_wakeup + stats->wakeup;
+    if ( total == 0 )
+        total = 1;
+
+    len += snprintf( text + len, sizeof( text ) - len, "wakeup %d%% silence %d%%\nstandby %d%% sleep %d%%\n",
+                                                        (int)( stats->wakeup * 100 / total ),
+                                                        (int)( stats->silence_wakeup * 100 / total ),
+                                                        (int)( stats->standby * 100 / total ),
+                                                        (int)( stats->light_sleep * 100 / total ) );
+    /*
+     * find the callback functions with the most time spend
+     */
+    for ( callback_t *callback = callback_get_first() ; callback != NULL ; callback = callback->next ) {
+        for ( int entry = 0 ; entry < callback->entrys ; entry++ ) {
+            callback_table_t table;
+            callback_get_stats( &callback->table[ entry ], &table );
+            for ( int i = 0 ; i < PROFILE_VIEW_TOP_ENTRYS ; i++ ) {
+                if ( i == top_entrys || table.time > top[ i ].time ) {
+                    memmove( &top[ i + 1 ], &top[ i ], sizeof( callback_table_t ) * ( PROFILE_VIEW_TOP_ENTRYS - i - 1 ) );
+                    top[ i ] = table;
+                    if ( top_entrys < PROFILE_VIEW_TOP_ENTRYS ) {
+                        top_entrys++;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    const char *rejected_id = NULL;
+    uint32_t rejected = callback_get_rejected( &rejected_id );
+    if ( rejected && rejected_id ) {
+        len += snprintf( text + len, sizeof( text ) - len, "late cb: %d %.14s\n", rejected, rejected_id );
+    }
+
+    for ( int i = 0 ; i < top_entrys && len < sizeof( text ) ; i++ ) {
+        len += snprintf( text + len, sizeof( text ) - len, "%.14s %dms %dus\n", top[ i ].id, (int)( top[ i ].time / 1000 ), (int)top[ i ].time_max );
+    }
+
+    lv_label_set_text( profile_view_label, text );
+}
@@ -0,0 +1,39 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _PROFILE_VIEW_H
+    #define _PROFILE_VIEW_H
+
+    #include <TTGO.h>
+
+    /**
+     * @brief   setup the profile view tile, shows the time spend in each power state
+     *          and the callback functions with the most time spend
+     */
+    void profile_view_tile_setup( void );
+    /**
+     * @brief   get the tile number of the profile view
+     * 
+     * @return  tile number
+     */
+    uint32_t profile_view_get_tile_num( void );
+
+#endif // _PROFILE_VIEW_H
@@ -21,6 +21,7 @@
  */
 #include "config.h"
 #include "utilities.h"
+#include "profile_view.h"
 #include "esp_system.h"//Needed for reset types
 #include <Arduino.h>
 
@@ -31,6 +32,7 @@
 
 #include "hardware/motor.h"
 #include "hardware/display.h"
+#include "hardware/config_store.h"
 
 
 
@@ -42,6 +44,7 @@ lv_obj_t *reboot_btn = NULL;
 lv_obj_t *poweroff_btn = NULL;
 
 lv_obj_t *format_spiffs_btn = NULL;
+lv_obj_t *profile_btn = NULL;
 
 lv_obj_t *SpiffsWarningBox = NULL;
 
@@ -60,6 +63,7 @@ static void format_SPIFFS(void);
 
 static void reboot_utilities_event_cb( lv_obj_t * obj, lv_event_t event );
 static void poweroff_utilities_event_cb( lv_obj_t * obj, lv_event_t event );
+static void profile_utilities_event_cb( lv_obj_t * obj, lv_event_t event );
 
 
 void utilities_tile_setup( void ) {
@@ -89,6 +93,15 @@ void utilities_tile_setup( void ) {
     lv_label_set_text( exit_label, "System Utilities");
     lv_obj_align( exit_label, exit_btn, LV_ALIGN_OUT_RIGHT_MID, 5, 0 );
 
+    //Add button for the power state and callback time profile
+    profile_btn = lv_btn_create( utilities_tile, NULL);
+    lv_obj_set_size( profile_btn, 70, 30);
+    lv_obj_set_event_cb( profile_btn, profile_utilities_event_cb );
+    lv_obj_add_style( profile_btn, LV_BTN_PART_MAIN, mainbar_get_button_style() );
+    lv_obj_align( profile_btn, utilities_tile, LV_ALIGN_IN_TOP_RIGHT, -5, STATUSBAR_HEIGHT + 10 );
+    lv_obj_t *profile_btn_label = lv_label_create( profile_btn, NULL );
+    lv_label_set_text( profile_btn_label, "Profile");
+
     //Spiffs:
     //Add button for dump spiffs details to serial including config files
     //Add button for clear all spiffs settings
@@ -173,6 +186,8 @@ void utilities_tile_setup( void ) {
     }
     lv_label_set_align( last_reason_label, LV_LABEL_ALIGN_CENTER );
     lv_obj_align( last_reason_label, last_reboot_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 5 );//Now that the text has changed, align it.
+
+    profile_view_tile_setup();
 }
 
 static void enter_utilities_event_cb( lv_obj_t * obj, lv_event_t event ) {
@@ -189,6 +204,13 @@ static void exit_utilities_event_cb( lv_obj_t * obj, lv_event_t event ) {
                                         break;
     }
 }
+static void profile_utilities_event_cb( lv_obj_t * obj, lv_event_t event ) {
+    switch( event ) {
+        case( LV_EVENT_CLICKED ):       mainbar_jump_to_tilenumber( profile_view_get_tile_num(), LV_ANIM_OFF );
+                                        break;
+    }
+}
+
 //********************************SPIFFS stuff
 
 static void SpiffsWarningBox_event_handler( lv_obj_t * obj, lv_event_t event ){
@@ -268,6 +290,7 @@ static void reboot_utilities_event_cb( lv_obj_t * obj, lv_event_t event ) {
 
                                         TTGOClass *ttgo = TTGOClass::getWatch();
                                         ttgo->stopLvglTick();
+                                        config_store_commit();
                                         SPIFFS.end();
                                         log_i("SPIFFS unmounted!");
                                         delay(500);
@@ -286,6 +309,7 @@ static void poweroff_utilities_event_cb( lv_obj_t * obj, lv_event_t event ) {
                                         
                                         TTGOClass *ttgo = TTGOClass::getWatch();
                                         ttgo->stopLvglTick();
+                                        config_store_commit();
                                         SPIFFS.end();
                                         log_i("SPIFFS unmounted!");
                                         delay(500);
@@ -32,7 +32,7 @@
 #include "hardware/motor.h"
 #include "webserver/webserver.h"
 #include "hardware/blectl.h"
-#include "hardware/json_psram_allocator.h"
+#include "hardware/json_msg.h"
 
 #include <WiFi.h>
 
@@ -65,7 +65,7 @@ void wifi_settings_enter_pass_event_cb( lv_obj_t * obj, lv_event_t event );
 bool wifi_setup_wifictl_event_cb( EventBits_t event, void *arg );
 
 bool wifi_setup_bluetooth_message_event_cb( EventBits_t event, void *arg );
-static void wifi_setup_bluetooth_message_msg_pharse( const char* msg );
+static void wifi_setup_bluetooth_message_msg_pharse( JsonDocument &doc );
 
 LV_IMG_DECLARE(lock_16px);
 LV_IMG_DECLARE(unlock_16px);
@@ -369,7 +369,7 @@ void wlan_setup_tile_setup( uint32_t wifi_setup_tile_num ) {
     else
         lv_switch_off( wifi_webserver_onoff, LV_ANIM_OFF);
 
-    blectl_register_cb( BLECTL_MSG, wifi_setup_bluetooth_message_event_cb, "wlan settings" );
+    blectl_register_cb( BLECTL_MSG_JSON, wifi_setup_bluetooth_message_event_cb, "wlan settings" );
 }
 
 static void wps_start_event_handler( lv_obj_t * obj, lv_event_t event ) {
@@ -415,21 +415,15 @@ static void wifi_webserver_onoff_event_handler( lv_obj_t * obj, lv_event_t event
 
 bool wifi_setup_bluetooth_message_event_cb( EventBits_t event, void *arg ) {
     switch( event ) {
-        case BLECTL_MSG:            wifi_setup_bluetooth_message_msg_pharse( (const char*)arg );
+        case BLECTL_MSG_JSON:       wifi_setup_bluetooth_message_msg_pharse( *(JsonDocument*)arg );
                                     break;
     }
     return( true );
 }
 
-void wifi_setup_bluetooth_message_msg_pharse( const char* msg ) {
+void wifi_setup_bluetooth_message_msg_pharse( JsonDocument &doc ) {
 
-    SpiRamJsonDocument doc( strlen( msg ) * 4 );
-
-    DeserializationError error = deserializeJson( doc, msg );
-    if ( error ) {
-        log_e("bluetooth message deserializeJson() failed: %s", error.c_str() );
-    }
-    else {
+    if ( doc["t"] && doc["app"] && doc["settings"] ) {
         if( !strcmp( doc["t"], "conf" ) ) {
              if ( !strcmp( doc["app"], "settings" ) ) {
                 if ( !strcmp( doc["settings"], "wlan" ) ) {
@@ -439,6 +433,5 @@ void wifi_setup_bluetooth_message_msg_pharse( const char* msg ) {
              }
 
         }
-    }        
-    doc.clear();
+    }
 }
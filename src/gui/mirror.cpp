@@ -0,0 +1,292 @@
+/****************************************************************************
+ *   Oct 27 19:42:18 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <esp_timer.h>
+
+#include "mirror.h"
+#include "screenshot.h"
+
+#include "hardware/framebuffer.h"
+#include "hardware/powermgm.h"
+
+enum {
+    MIRROR_OFF = 0,
+    MIRROR_RUNNING,
+    MIRROR_STOPPING
+};
+
+static SemaphoreHandle_t mirror_mutex = NULL;
+static QueueHandle_t mirror_queue = NULL;
+TaskHandle_t _mirror_send_Task = NULL;
+
+static volatile int mirror_state = MIRROR_OFF;
+static volatile bool mirror_dropped = false;
+static volatile bool mirror_resync_request = false;
+static MIRROR_SEND_FUNC mirror_send_func = NULL;
+static uint8_t *mirror_scratch = NULL;
+static size_t mirror_queued = 0;
+static uint32_t mirror_seq = 0;
+static mirror_stats_t mirror_stats;
+
+static bool mirror_powermgm_loop_cb( EventBits_t event, void *arg );
+static void mirror_flush_hook( const lv_area_t *area, const lv_color_t *color_p, bool last );
+static void mirror_send_Task( void * pvParameters );
+static void mirror_request_resync( void );
+
+void mirror_setup( void ) {
+    mirror_mutex = xSemaphoreCreateMutex();
+    if ( mirror_mutex == NULL ) {
+        log_e("mirror mutex alloc failed");
+        while(1);
+    }
+    memset( &mirror_stats, 0, sizeof( mirror_stats ) );
+    powermgm_register_loop_cb( POWERMGM_WAKEUP, mirror_powermgm_loop_cb, "mirror loop" );
+}
+
+void mirror_start( MIRROR_SEND_FUNC send_func ) {
+    xSemaphoreTake( mirror_mutex, portMAX_DELAY );
+    mirror_send_func = send_func;
+    if ( mirror_state == MIRROR_OFF ) {
+        /*
+         * worst case for the rle encoding is one control byte every 128 literal pixels
+         */
+        size_t pixel = lv_disp_get_hor_res( NULL ) * FRAMEBUFFER_LINES;
+        mirror_scratch = (uint8_t*)ps_malloc( sizeof( mirror_header_t ) + pixel * sizeof( uint16_t ) + pixel / 128 + 1 );
+        mirror_queue = xQueueCreate( MIRROR_QUEUE_LEN, sizeof( uint8_t * ) );
+        if ( mirror_scratch && mirror_queue ) {
+            mirror_queued = 0;
+            mirror_dropped = false;
+            mirror_state = MIRROR_RUNNING;
+            xTaskCreate(    mirror_send_Task,               /* Function to implement the task */
+                            "mirror send Task",             /* Name of the task */
+                            3000,                           /* Stack size in words */
+                            NULL,                           /* Task input parameter */
+                            1,                              /* Priority of the task */
+                            &_mirror_send_Task );           /* Task handle. */
+            framebuffer_set_flush_hook( mirror_flush_hook );
+            log_i("mirror started");
+        }
+        else {
+            log_e("mirror buffer alloc failed");
+            free( mirror_scratch );
+            mirror_scratch = NULL;
+            if ( mirror_queue ) {
+                vQueueDelete( mirror_queue );
+                mirror_queue = NULL;
+            }
+        }
+    }
+    else {
+        /*
+         * a stopping send task keeps running for the new client
+         */
+        mirror_state = MIRROR_RUNNING;
+    }
+    xSemaphoreGive( mirror_mutex );
+
+    mirror_request_resync();
+}
+
+void mirror_stop( void ) {
+    /*
+     * the send task may just wait for a busy client, so let it clean up by itself
+     */
+    xSemaphoreTake( mirror_mutex, portMAX_DELAY );
+    if ( mirror_state == MIRROR_RUNNING ) {
+        mirror_state = MIRROR_STOPPING;
+    }
+    xSemaphoreGive( mirror_mutex );
+}
+
+bool mirror_is_active( void ) {
+    return( mirror_state == MIRROR_RUNNING );
+}
+
+mirror_stats_t *mirror_get_stats( void ) {
+    return( &mirror_stats );
+}
+
+static void mirror_request_resync( void ) {
+    mirror_resync_request = true;
+    powermgm_set_event( POWERMGM_LOOP_NOTIFY );
+}
+
+static bool mirror_powermgm_loop_cb( EventBits_t event, void *arg ) {
+    if ( !mirror_resync_request ) {
+        return( true );
+    }
+    /*
+     * redraw the whole screen, the flush hook sends it to the clients
+     */
+    mirror_resync_request = false;
+    if ( mirror_state == MIRROR_RUNNING ) {
+        mirror_stats.resyncs++;
+        lv_obj_invalidate( lv_scr_act() );
+    }
+    return( true );
+}
+
+static void mirror_flush_hook( const lv_area_t *area, const lv_color_t *color_p, bool last ) {
+    /*
+     * never block the flush task for long, a lost rectangle is repaired by a full redraw
+     */
+    if ( xSemaphoreTake( mirror_mutex, pdMS_TO_TICKS( MIRROR_LOCK_TIMEOUT ) ) != pdTRUE ) {
+        mirror_dropped = true;
+        return;
+    }
+
+    if ( mirror_state == MIRROR_RUNNING ) {
+        mirror_header_t *header = (mirror_header_t*)mirror_scratch;
+        size_t pixel = lv_area_get_width( area ) * lv_area_get_height( area );
+        uint8_t *msg = NULL;
+
+        memcpy( header->magic, MIRROR_MAGIC, sizeof( header->magic ) );
+        header->seq = mirror_seq++;
+        header->timestamp = esp_timer_get_time();
+        header->latency = 0;
+        header->frame_bytes = 0;
+        header->x = area->x1;
+        header->y = area->y1;
+        header->w = lv_area_get_width( area );
+        header->h = lv_area_get_height( area );
+        header->flags = last ? MIRROR_FLAG_LAST : 0;
+        header->len = screenshot_rle_encode( (const uint16_t*)color_p, pixel, mirror_scratch + sizeof( mirror_header_t ) );
+
+        size_t len = sizeof( mirror_header_t ) + header->len;
+        if ( mirror_queued + len <= MIRROR_QUEUE_SIZE ) {
+            msg = (uint8_t*)ps_malloc( len );
+        }
+        if ( msg ) {
+            memcpy( msg, mirror_scratch, len );
+            if ( xQueueSend( mirror_queue, &msg, 0 ) == pdTRUE ) {
+                mirror_queued += len;
+            }
+            else {
+                free( msg );
+                msg = NULL;
+            }
+        }
+        if ( msg == NULL ) {
+            mirror_dropped = true;
+            mirror_stats.dropped++;
+        }
+    }
+    xSemaphoreGive( mirror_mutex );
+}
+
+static void mirror_send_Task( void * pvParameters ) {
+    uint64_t nextmillis = millis() + 1000;
+    uint32_t frame_start = 0;
+    uint32_t frame_bytes = 0;
+    uint32_t last_latency = 0;
+    uint32_t last_frame_bytes = 0;
+    bool new_frame = true;
+    int32_t frames = 0;
+    uint64_t bytes = 0;
+    uint64_t latency = 0;
+    uint32_t latency_max = 0;
+
+    log_i("start mirror send task, heap: %d", ESP.getFreeHeap() );
+
+    while( true ) {
+        uint8_t *msg = NULL;
+
+        xSemaphoreTake( mirror_mutex, portMAX_DELAY );
+        if ( mirror_state == MIRROR_STOPPING ) {
+            framebuffer_set_flush_hook( NULL );
+            while ( xQueueReceive( mirror_queue, &msg, 0 ) == pdTRUE ) {
+                free( msg );
+            }
+            vQueueDelete( mirror_queue );
+            free( mirror_scratch );
+            mirror_queue = NULL;
+            mirror_scratch = NULL;
+            mirror_queued = 0;
+            mirror_state = MIRROR_OFF;
+            xSemaphoreGive( mirror_mutex );
+            log_i("mirror stopped");
+            vTaskDelete( NULL );
+        }
+        xSemaphoreGive( mirror_mutex );
+
+        if ( xQueueReceive( mirror_queue, &msg, pdMS_TO_TICKS( 100 ) ) == pdTRUE ) {
+            mirror_header_t *header = (mirror_header_t*)msg;
+            size_t len = sizeof( mirror_header_t ) + header->len;
+            bool last = header->flags & MIRROR_FLAG_LAST;
+
+            if ( new_frame ) {
+                frame_start = header->timestamp;
+                frame_bytes = 0;
+                new_frame = false;
+            }
+            header->latency = last_latency;
+            header->frame_bytes = last_frame_bytes;
+            /*
+             * backpressure, wait until all clients can take the next message
+             */
+            while ( mirror_state == MIRROR_RUNNING && !mirror_send_func( msg, len ) ) {
+                vTaskDelay( pdMS_TO_TICKS( MIRROR_SEND_RETRY ) );
+            }
+            free( msg );
+
+            xSemaphoreTake( mirror_mutex, portMAX_DELAY );
+            mirror_queued -= len;
+            xSemaphoreGive( mirror_mutex );
+
+            frame_bytes += len;
+            mirror_stats.rects++;
+            mirror_stats.bytes += len;
+            if ( last ) {
+                last_latency = (uint32_t)esp_timer_get_time() - frame_start;
+                last_frame_bytes = frame_bytes;
+                new_frame = true;
+                frames++;
+                bytes += frame_bytes;
+                latency += last_latency;
+                if ( last_latency > latency_max ) {
+                    latency_max = last_latency;
+                }
+                mirror_stats.frames++;
+            }
+        }
+        else if ( mirror_dropped ) {
+            /*
+             * the queue is drained, now a full redraw brings the clients back in sync
+             */
+            mirror_dropped = false;
+            new_frame = true;
+            mirror_request_resync();
+        }
+
+        if ( nextmillis < millis() ) {
+            nextmillis = millis() + 1000;
+            mirror_stats.framerate = frames;
+            mirror_stats.frame_bytes = frames ? bytes / frames : 0;
+            mirror_stats.latency = frames ? latency / frames : 0;
+            mirror_stats.latency_max = latency_max;
+            frames = 0;
+            bytes = 0;
+            latency = 0;
+            latency_max = 0;
+        }
+    }
+}
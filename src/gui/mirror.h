@@ -0,0 +1,104 @@
+/****************************************************************************
+ *   Oct 27 19:42:18 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _MIRROR_H
+    #define _MIRROR_H
+
+    #include "config.h"
+
+    #define MIRROR_MAGIC            "MIRR"
+    #define MIRROR_QUEUE_SIZE       128 * 1024  // max bytes of pending rectangles in PSRAM, enough for a uncompressed full redraw
+    #define MIRROR_QUEUE_LEN        64          // max pending rectangles
+    #define MIRROR_SEND_RETRY       5           // ms to wait while the client is busy
+    #define MIRROR_LOCK_TIMEOUT     10          // ms the flush task waits for the queue before the rectangle is dropped
+    #define MIRROR_FLAG_LAST        _BV(0)      // last rectangle of a frame
+
+    /**
+     * every dirty rectangle is send as one message, the header is followed by the
+     * pixel of the rectangle in the run length format of the compressed screenshot,
+     * see gui/screenshot.h. latency and frame_bytes are the values of the last
+     * completely send frame.
+     */
+    typedef struct {
+        char magic[ 4 ];
+        uint32_t seq;
+        uint32_t timestamp;         // us, when the rectangle was flushed
+        uint32_t latency;           // us from the flush of the first rectangle until the last one was send
+        uint32_t frame_bytes;       // bytes of all rectangles of the frame
+        uint16_t x;
+        uint16_t y;
+        uint16_t w;
+        uint16_t h;
+        uint16_t flags;
+        uint16_t len;               // bytes of rle data that follow
+    } __attribute__((packed)) mirror_header_t;
+
+    typedef struct {
+        uint32_t frames;            // frames send
+        uint32_t rects;             // rectangles send
+        uint32_t bytes;             // bytes send
+        uint32_t dropped;           // rectangles dropped while the queue was full
+        uint32_t resyncs;           // full redraws requested
+        uint32_t frame_bytes;       // average bytes per frame in the last second
+        uint32_t latency;           // average latency per frame in the last second in us
+        uint32_t latency_max;       // max latency per frame in the last second in us
+        int32_t framerate;          // frames send in the last second
+    } mirror_stats_t;
+
+    /**
+     * @brief   send one message to all clients
+     * 
+     * @param   data    pointer to the message
+     * @param   len     length of the message
+     * 
+     * @return  false if the clients are busy and the message should be send later
+     */
+    typedef bool ( * MIRROR_SEND_FUNC ) ( const uint8_t *data, size_t len );
+
+    /**
+     * @brief setup screen mirror, does nothing until a client is attached
+     */
+    void mirror_setup( void );
+    /**
+     * @brief attach a client, on the first one the framebuffer is hooked and the whole
+     * screen is send, every following client requests a full redraw
+     * 
+     * @param   send_func   function to send the messages to all clients
+     */
+    void mirror_start( MIRROR_SEND_FUNC send_func );
+    /**
+     * @brief detach all clients, the send task unhooks the framebuffer and frees all buffers
+     */
+    void mirror_stop( void );
+    /**
+     * @brief get mirror state
+     * 
+     * @return  true if a client is attached
+     */
+    bool mirror_is_active( void );
+    /**
+     * @brief get mirror statistics
+     * 
+     * @return  pointer to mirror_stats_t
+     */
+    mirror_stats_t *mirror_get_stats( void );
+
+#endif // _MIRROR_H
@@ -22,48 +22,215 @@
 #include "config.h"
 #include "screenshot.h"
 
-uint16_t *png;
+#include "hardware/powermgm.h"
 
+static SemaphoreHandle_t screenshot_mutex = NULL;
+
+static volatile bool screenshot_stream_active = false;
+static volatile bool screenshot_strip_request = false;
+static uint32_t screenshot_strip_request_time = 0;
+static bool screenshot_compress = false;
+static int32_t screenshot_height = 0;
+static int32_t screenshot_line = 0;
+static int32_t screenshot_strip_first = 0;
+static int32_t screenshot_strip_last = 0;
+
+static uint16_t *screenshot_strip = NULL;
+static uint8_t *screenshot_out = NULL;
+static size_t screenshot_out_len = 0;
+static size_t screenshot_out_pos = 0;
+
+static bool screenshot_powermgm_loop_cb( EventBits_t event, void *arg );
+static void screenshot_request_strip( void );
+static void screenshot_render_strip( void );
 static void screenshot_disp_flush( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p );
 
 void screenshot_setup( void ) {
-    png = (uint16_t*)ps_malloc( lv_disp_get_hor_res( NULL ) * lv_disp_get_ver_res( NULL ) * sizeof( lv_color_t ) );
-    if ( png == NULL ) {
-        log_e("screenshot malloc failed");
+    screenshot_mutex = xSemaphoreCreateMutex();
+    if ( screenshot_mutex == NULL ) {
+        log_e("screenshot semaphore alloc failed");
         while(1);
     }
+    powermgm_register_loop_cb( POWERMGM_STANDBY | POWERMGM_SILENCE_WAKEUP | POWERMGM_WAKEUP, screenshot_powermgm_loop_cb, "screenshot loop" );
+}
+
+bool screenshot_stream_start( bool compress ) {
+    size_t strip_pixel = lv_disp_get_hor_res( NULL ) * SCREENSHOT_STRIP_LINES;
+    bool retval = false;
+
+    xSemaphoreTake( screenshot_mutex, portMAX_DELAY );
+    if ( !screenshot_stream_active ) {
+        screenshot_strip = (uint16_t*)malloc( strip_pixel * sizeof( uint16_t ) );
+        /*
+         * worst case for the rle encoding is one control byte every 128 literal pixels
+         */
+        screenshot_out = (uint8_t*)malloc( strip_pixel * sizeof( uint16_t ) + strip_pixel / 128 + 1 + sizeof( screenshot_header_t ) );
+        if ( screenshot_strip && screenshot_out ) {
+            screenshot_compress = compress;
+            screenshot_height = lv_disp_get_ver_res( NULL );
+            screenshot_line = 0;
+            screenshot_out_len = 0;
+            screenshot_out_pos = 0;
+            screenshot_strip_request = false;
+
+            if ( compress ) {
+                screenshot_header_t *header = (screenshot_header_t*)screenshot_out;
+                memcpy( header->magic, SCREENSHOT_RLE_MAGIC, sizeof( header->magic ) );
+                header->width = lv_disp_get_hor_res( NULL );
+                header->height = lv_disp_get_ver_res( NULL );
+                screenshot_out_len = sizeof( screenshot_header_t );
+            }
+            screenshot_stream_active = true;
+            retval = true;
+        }
+        else {
+            log_e("screenshot strip alloc failed");
+            free( screenshot_strip );
+            free( screenshot_out );
+            screenshot_strip = NULL;
+            screenshot_out = NULL;
+        }
+    }
+    xSemaphoreGive( screenshot_mutex );
+
+    return( retval );
+}
+
+size_t screenshot_stream_read( uint8_t *buffer, size_t maxlen ) {
+    size_t len = 0;
+    /*
+     * called from the async tcp task, never wait for the gui loop. a strip
+     * that is rendered right now or not requested yet is a try again
+     */
+    if ( xSemaphoreTake( screenshot_mutex, 0 ) != pdTRUE ) {
+        return( SCREENSHOT_STREAM_TRY_AGAIN );
+    }
+
+    if ( !screenshot_stream_active ) {
+        xSemaphoreGive( screenshot_mutex );
+        return( 0 );
+    }
+
+    if ( screenshot_out_pos >= screenshot_out_len ) {
+        if ( screenshot_line >= screenshot_height ) {
+            xSemaphoreGive( screenshot_mutex );
+            return( 0 );
+        }
+        if ( !screenshot_strip_request ) {
+            screenshot_request_strip();
+        }
+        else if ( millis() - screenshot_strip_request_time > SCREENSHOT_STRIP_TIMEOUT ) {
+            log_e("screenshot strip timeout");
+            xSemaphoreGive( screenshot_mutex );
+            return( 0 );
+        }
+        xSemaphoreGive( screenshot_mutex );
+        return( SCREENSHOT_STREAM_TRY_AGAIN );
+    }
+
+    len = screenshot_out_len - screenshot_out_pos;
+    if ( len > maxlen ) {
+        len = maxlen;
+    }
+    memcpy( buffer, screenshot_out + screenshot_out_pos, len );
+    screenshot_out_pos += len;
+    /*
+     * render the next strip while this one is on the way
+     */
+    if ( screenshot_out_pos >= screenshot_out_len && screenshot_line < screenshot_height ) {
+        screenshot_request_strip();
+    }
+    xSemaphoreGive( screenshot_mutex );
+
+    return( len );
+}
+
+/*
+ * call with screenshot_mutex taken
+ */
+static void screenshot_request_strip( void ) {
+    screenshot_strip_request = true;
+    screenshot_strip_request_time = millis();
+    powermgm_set_event( POWERMGM_LOOP_NOTIFY );
+}
+
+void screenshot_stream_stop( void ) {
+    xSemaphoreTake( screenshot_mutex, portMAX_DELAY );
+    screenshot_stream_active = false;
+    screenshot_strip_request = false;
+    free( screenshot_strip );
+    free( screenshot_out );
+    screenshot_strip = NULL;
+    screenshot_out = NULL;
+    xSemaphoreGive( screenshot_mutex );
+}
+
+static bool screenshot_powermgm_loop_cb( EventBits_t event, void *arg ) {
+    if ( !screenshot_strip_request ) {
+        return( true );
+    }
+
+    xSemaphoreTake( screenshot_mutex, portMAX_DELAY );
+    if ( screenshot_stream_active && screenshot_strip_request ) {
+        screenshot_render_strip();
+        screenshot_strip_request = false;
+    }
+    xSemaphoreGive( screenshot_mutex );
+
+    return( true );
 }
 
-void screenshot_take( void ) {
+static void screenshot_render_strip( void ) {
+    lv_disp_t *system_disp = lv_disp_get_default();
     lv_disp_drv_t driver;
-    lv_disp_t *system_disp;;
+    lv_area_t area;
+
+    screenshot_strip_first = screenshot_line;
+    screenshot_strip_last = screenshot_line + SCREENSHOT_STRIP_LINES - 1;
+    if ( screenshot_strip_last >= lv_disp_get_ver_res( NULL ) ) {
+        screenshot_strip_last = lv_disp_get_ver_res( NULL ) - 1;
+    }
+    /*
+     * send pending changes to the display first, then redraw only
+     * the strip into the screenshot flush function
+     */
+    lv_refr_now( system_disp );
+
+    area.x1 = 0;
+    area.x2 = lv_disp_get_hor_res( NULL ) - 1;
+    area.y1 = screenshot_strip_first;
+    area.y2 = screenshot_strip_last;
 
-    system_disp = lv_disp_get_default();
     driver.flush_cb = system_disp->driver.flush_cb;
     system_disp->driver.flush_cb = screenshot_disp_flush;
-    lv_obj_invalidate( lv_scr_act() );
+    lv_obj_invalidate_area( lv_scr_act(), &area );
     lv_refr_now( system_disp );
     system_disp->driver.flush_cb = driver.flush_cb;
-}
 
-void screenshot_save( void ) {
-    SPIFFS.remove( SCREENSHOT_FILE_NAME );
-    fs::File file = SPIFFS.open( SCREENSHOT_FILE_NAME, FILE_WRITE );
-    
-    file.write( (uint8_t *)png, lv_disp_get_hor_res( NULL ) * lv_disp_get_ver_res( NULL ) * 2 );
-    file.close();
+    size_t pixel = lv_disp_get_hor_res( NULL ) * ( screenshot_strip_last - screenshot_strip_first + 1 );
+    if ( screenshot_compress ) {
+        screenshot_out_len = screenshot_rle_encode( screenshot_strip, pixel, screenshot_out );
+    }
+    else {
+        memcpy( screenshot_out, screenshot_strip, pixel * sizeof( uint16_t ) );
+        screenshot_out_len = pixel * sizeof( uint16_t );
+    }
+    screenshot_out_pos = 0;
+    screenshot_line = screenshot_strip_last + 1;
 }
 
 static void screenshot_disp_flush( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p ) {
 
-    uint32_t x, y;
+    int32_t x, y;
     uint16_t *data = (uint16_t *)color_p;
 
-    for(y = area->y1; y <= area->y2; y++) {
-        for(x = area->x1; x <= area->x2; x++) {
-            *(png + (y * lv_disp_get_hor_res( NULL ) + x )) = *data;
+    for( y = area->y1; y <= area->y2; y++ ) {
+        for( x = area->x1; x <= area->x2; x++ ) {
+            if ( y >= screenshot_strip_first && y <= screenshot_strip_last ) {
+                *( screenshot_strip + ( ( y - screenshot_strip_first ) * lv_disp_get_hor_res( NULL ) + x ) ) = *data;
+            }
             data++;
         }
     } 
-    lv_disp_flush_ready(disp_drv);
+    lv_disp_flush_ready( disp_drv );
 }
@@ -23,21 +23,53 @@
     #define _SCREENSHOT_H
 
     #include "config.h"
+    #include "screenshot_rle.h"
 
-    #define SCREENSHOT_FILE_NAME    "/screen.data"
+    #define SCREENSHOT_STRIP_LINES      10      // lines rendered and send at once
+    #define SCREENSHOT_STRIP_TIMEOUT    1000    // ms to wait for the gui to render a strip
+    #define SCREENSHOT_STREAM_TRY_AGAIN ( (size_t)-1 )  // next strip not rendered yet, see screenshot_stream_read()
+    #define SCREENSHOT_RLE_MAGIC        "R565"
+
+    /**
+     * compressed screenshot format, the header is followed by PackBits like runs of
+     * RGB565 pixels, row by row. a control byte c with bit 7 set is followed by one
+     * pixel that is repeated ( c & 0x7f ) + 1 times, otherwise c + 1 literal pixels follow.
+     * see tools/screenshot2png.py
+     */
+    typedef struct {
+        char magic[ 4 ];
+        uint16_t width;
+        uint16_t height;
+    } __attribute__((packed)) screenshot_header_t;
 
     /**
      * @brief setup screenshot
      */
     void screenshot_setup( void );
     /**
-     * @brief take a screenshoot an store it in psram
+     * @brief start a screenshot stream, the screen is rendered strip by strip
+     * from the gui loop while the stream is read
+     * 
+     * @param   compress    true for the compressed format, false for raw RGB565
+     * 
+     * @return  true if success, false if a stream is already in progress
+     */
+    bool screenshot_stream_start( bool compress );
+    /**
+     * @brief read the next bytes from the screenshot stream, never blocks. the next strip is
+     * rendered by the gui loop in the meantime
+     * 
+     * @param   buffer      pointer to the destination buffer
+     * @param   maxlen      size of the destination buffer
+     * 
+     * @return  number of bytes, 0 at the end of the stream or on timeout, SCREENSHOT_STREAM_TRY_AGAIN
+     *          when the next strip is not rendered yet
      */
-    void screenshot_take( void );
+    size_t screenshot_stream_read( uint8_t *buffer, size_t maxlen );
     /**
-     * @brief store a screenshoot from psram to spiffs
+     * @brief stop the screenshot stream and free the strip buffers
      */
-    void screenshot_save( void );
+    void screenshot_stream_stop( void );
 
 /*
     struct PNG_IMAGE {
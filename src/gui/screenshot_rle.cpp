@@ -0,0 +1,64 @@
+/****************************************************************************
+ *   Nov 07 16:02:48 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * the encoder uses no arduino or lvgl api, so it builds on the host
+ * for the native tests
+ */
+#include <string.h>
+
+#include "screenshot_rle.h"
+
+size_t screenshot_rle_encode( const uint16_t *pixel, size_t count, uint8_t *out ) {
+    size_t len = 0;
+    size_t i = 0;
+
+    while ( i < count ) {
+        size_t run = 1;
+        while ( i + run < count && run < 128 && pixel[ i + run ] == pixel[ i ] ) {
+            run++;
+        }
+
+        if ( run > 1 ) {
+            out[ len++ ] = 0x80 | ( run - 1 );
+            memcpy( &out[ len ], &pixel[ i ], sizeof( uint16_t ) );
+            len += sizeof( uint16_t );
+            i += run;
+        }
+        else {
+            /*
+             * collect literal pixels until the next run of two equal pixels starts
+             */
+            size_t literal = 1;
+            while ( i + literal < count && literal < 128 ) {
+                if ( i + literal + 1 < count && pixel[ i + literal ] == pixel[ i + literal + 1 ] ) {
+                    break;
+                }
+                literal++;
+            }
+            out[ len++ ] = literal - 1;
+            memcpy( &out[ len ], &pixel[ i ], literal * sizeof( uint16_t ) );
+            len += literal * sizeof( uint16_t );
+            i += literal;
+        }
+    }
+    return( len );
+}
@@ -0,0 +1,39 @@
+/****************************************************************************
+ *   Nov 07 16:02:48 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _SCREENSHOT_RLE_H
+    #define _SCREENSHOT_RLE_H
+
+    #include <stdint.h>
+    #include <stddef.h>
+
+    /**
+     * @brief compress RGB565 pixel into the run length format described in screenshot.h
+     * 
+     * @param   pixel       pointer to the pixel
+     * @param   count       number of pixel
+     * @param   out         destination, count * 2 + count / 128 + 1 bytes in the worst case
+     * 
+     * @return  number of bytes written to out
+     */
+    size_t screenshot_rle_encode( const uint16_t *pixel, size_t count, uint8_t *out );
+
+#endif // _SCREENSHOT_RLE_H
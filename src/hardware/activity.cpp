@@ -0,0 +1,163 @@
+/****************************************************************************
+ *   Nov 02 20:48:16 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * the kernel uses no arduino or freertos api, so it builds on the host
+ * for tools/activity_bench.cpp
+ */
+#include "activity.h"
+
+static const char *activity_name[ ACTIVITY_NUM ] = { "still", "walk", "run", "sleep" };
+
+void activity_init( activity_state_t *state ) {
+    state->gravity[ 0 ] = 0;
+    state->gravity[ 1 ] = 0;
+    state->gravity[ 2 ] = 0;
+    state->rest = 0;
+    state->moving = 0;
+    state->activity = ACTIVITY_STILL;
+}
+
+void activity_features( const int16_t *xyz, const int16_t *last, activity_features_t *features ) {
+    int16_t magnitude[ ACTIVITY_WINDOW ];
+    int32_t sum = 0;
+    int32_t gx = 0;
+    int32_t gy = 0;
+    int32_t gz = 0;
+
+    /*
+     * magnitude without sqrt: max + 11/32 mid + 1/4 min, within 8% of the euclidean length
+     */
+    for ( int i = 0 ; i < ACTIVITY_WINDOW ; i++, xyz += 3 ) {
+        int32_t x = xyz[ 0 ];
+        int32_t y = xyz[ 1 ];
+        int32_t z = xyz[ 2 ];
+        gx += x;
+        gy += y;
+        gz += z;
+
+        int32_t a = x < 0 ? -x : x;
+        int32_t b = y < 0 ? -y : y;
+        int32_t c = z < 0 ? -z : z;
+        int32_t t;
+        if ( a < b ) { t = a; a = b; b = t; }
+        if ( b < c ) { t = b; b = c; c = t; }
+        if ( a < b ) { t = a; a = b; b = t; }
+
+        int32_t m = a + ( ( b * 11 ) >> 5 ) + ( c >> 2 );
+        magnitude[ i ] = m > INT16_MAX ? INT16_MAX : m;
+        sum += m;
+    }
+    int32_t mean = sum >> ACTIVITY_WINDOW_SHIFT;
+
+    /*
+     * second pass over the contiguous magnitudes, variance and crossings of the mean with hysteresis
+     */
+    int32_t var = 0;
+    int32_t crossings = 0;
+    bool below = true;
+    for ( int i = 0 ; i < ACTIVITY_WINDOW ; i++ ) {
+        int32_t d = magnitude[ i ] - mean;
+        var += d * d;
+        if ( below && d > ACTIVITY_HYSTERESIS ) {
+            crossings++;
+            below = false;
+        }
+        else if ( !below && d < -ACTIVITY_HYSTERESIS ) {
+            below = true;
+        }
+    }
+
+    features->mean = mean;
+    features->var = var >> ACTIVITY_WINDOW_SHIFT;
+    features->crossings = crossings;
+    features->gravity[ 0 ] = gx >> ACTIVITY_WINDOW_SHIFT;
+    features->gravity[ 1 ] = gy >> ACTIVITY_WINDOW_SHIFT;
+    features->gravity[ 2 ] = gz >> ACTIVITY_WINDOW_SHIFT;
+    features->tilt = 0;
+    if ( last ) {
+        for ( int i = 0 ; i < 3 ; i++ ) {
+            int32_t d = features->gravity[ i ] - last[ i ];
+            features->tilt += d < 0 ? -d : d;
+        }
+    }
+}
+
+int activity_classify( const int16_t *xyz, activity_state_t *state, activity_features_t *features ) {
+    activity_features_t local;
+    int activity = ACTIVITY_STILL;
+
+    if ( features == NULL ) {
+        features = &local;
+    }
+    activity_features( xyz, state->rest || state->gravity[ 0 ] || state->gravity[ 1 ] || state->gravity[ 2 ] ? state->gravity : NULL, features );
+
+    if ( features->var >= ACTIVITY_RUN_VAR && features->crossings >= ACTIVITY_RUN_CROSSINGS ) {
+        activity = ACTIVITY_RUN;
+    }
+    else if ( features->var >= ACTIVITY_WALK_VAR && features->crossings >= ACTIVITY_WALK_CROSSINGS ) {
+        activity = ACTIVITY_WALK;
+    }
+
+    /*
+     * a single window with a gait is a gesture, asleep a few of them are turning over
+     */
+    state->moving = activity != ACTIVITY_STILL ? state->moving + 1 : 0;
+    if ( state->moving < ( state->rest >= ACTIVITY_SLEEP_ONSET ? ACTIVITY_WAKE_WINDOWS : ACTIVITY_GAIT_WINDOWS ) ) {
+        activity = ACTIVITY_STILL;
+    }
+
+    /*
+     * sleep is a long phase of rest, awake a restless window halves the rest, asleep
+     * turning over costs only ACTIVITY_SLEEP_RESTLESS of the ACTIVITY_SLEEP_MARGIN
+     */
+    if ( activity != ACTIVITY_STILL ) {
+        state->rest = 0;
+    }
+    else if ( state->moving == 0 && features->var < ACTIVITY_REST_VAR && features->tilt < ACTIVITY_REST_TILT ) {
+        if ( state->rest < ACTIVITY_SLEEP_ONSET + ACTIVITY_SLEEP_MARGIN ) {
+            state->rest++;
+        }
+    }
+    else if ( state->rest >= ACTIVITY_SLEEP_ONSET ) {
+        state->rest = state->rest > ACTIVITY_SLEEP_RESTLESS ? state->rest - ACTIVITY_SLEEP_RESTLESS : 0;
+    }
+    else {
+        state->rest /= 2;
+    }
+    if ( activity == ACTIVITY_STILL && state->rest >= ACTIVITY_SLEEP_ONSET ) {
+        activity = ACTIVITY_SLEEP;
+    }
+
+    state->gravity[ 0 ] = features->gravity[ 0 ];
+    state->gravity[ 1 ] = features->gravity[ 1 ];
+    state->gravity[ 2 ] = features->gravity[ 2 ];
+    state->activity = activity;
+
+    return( activity );
+}
+
+const char *activity_get_name( int activity ) {
+    if ( activity < 0 || activity >= ACTIVITY_NUM ) {
+        return( "unknown" );
+    }
+    return( activity_name[ activity ] );
+}
@@ -0,0 +1,103 @@
+/****************************************************************************
+ *   Nov 02 20:48:16 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _ACTIVITY_H
+    #define _ACTIVITY_H
+
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #define ACTIVITY_RATE_MHZ           12500           // sample rate in mHz, the bma fifo is downsampled to this
+    #define ACTIVITY_WINDOW_SHIFT       5
+    #define ACTIVITY_WINDOW             ( 1 << ACTIVITY_WINDOW_SHIFT )  // samples per window, 2.56s
+    #define ACTIVITY_HYSTERESIS         40              // mg around the mean magnitude for a crossing
+    #define ACTIVITY_REST_VAR           ( 12 * 12 )     // mg^2, magnitude variance below this is rest
+    #define ACTIVITY_REST_TILT          40              // mg, max change of the gravity vector between two windows at rest
+    #define ACTIVITY_WALK_VAR           ( 45 * 45 )     // mg^2, min magnitude variance for walking
+    #define ACTIVITY_RUN_VAR            ( 200 * 200 )   // mg^2, min magnitude variance for running
+    #define ACTIVITY_WALK_CROSSINGS     2               // min crossings per window for walking, 0.8Hz
+    #define ACTIVITY_RUN_CROSSINGS      4               // min crossings per window for running, 1.6Hz
+    #define ACTIVITY_GAIT_WINDOWS       2               // windows in a row with a gait before walk or run is reported
+    #define ACTIVITY_WAKE_WINDOWS       4               // windows in a row with a gait that end sleep, shorter is turning over
+    #define ACTIVITY_SLEEP_ONSET        234             // windows at rest before sleep is assumed, 10 minutes
+    #define ACTIVITY_SLEEP_MARGIN       48              // windows the rest counter grows above the onset, 2 minutes
+    #define ACTIVITY_SLEEP_RESTLESS     12              // windows a restless window costs while asleep
+
+    enum {
+        ACTIVITY_STILL = 0,
+        ACTIVITY_WALK,
+        ACTIVITY_RUN,
+        ACTIVITY_SLEEP,
+        ACTIVITY_NUM
+    };
+
+    /**
+     * features of one window, all integer in mg
+     */
+    typedef struct {
+        int32_t mean;               // mean acceleration magnitude
+        int32_t var;                // variance of the magnitude in mg^2
+        int32_t crossings;          // upward crossings of the mean with ACTIVITY_HYSTERESIS, cadence
+        int32_t tilt;               // L1 change of the gravity vector since the last window
+        int16_t gravity[ 3 ];       // mean x, y, z
+    } activity_features_t;
+
+    typedef struct {
+        int16_t gravity[ 3 ];       // gravity vector of the last window
+        uint32_t rest;              // windows at rest, halved by restless windows while awake
+        uint32_t moving;            // windows in a row with a gait
+        uint8_t activity;           // last result
+    } activity_state_t;
+
+    /**
+     * @brief reset the classifier state
+     * 
+     * @param   state       pointer to the state
+     */
+    void activity_init( activity_state_t *state );
+    /**
+     * @brief extract the features of one window, fixed point only
+     * 
+     * @param   xyz         ACTIVITY_WINDOW interleaved x, y, z samples in mg
+     * @param   last        gravity vector of the last window for the tilt, NULL if unknown
+     * @param   features    pointer to the result
+     */
+    void activity_features( const int16_t *xyz, const int16_t *last, activity_features_t *features );
+    /**
+     * @brief classify one window, sleep is rest that lasts ACTIVITY_SLEEP_ONSET windows
+     * 
+     * @param   xyz         ACTIVITY_WINDOW interleaved x, y, z samples in mg
+     * @param   state       pointer to the classifier state
+     * @param   features    pointer to the features of this window, or NULL
+     * 
+     * @return  ACTIVITY_STILL, ACTIVITY_WALK, ACTIVITY_RUN or ACTIVITY_SLEEP
+     */
+    int activity_classify( const int16_t *xyz, activity_state_t *state, activity_features_t *features );
+    /**
+     * @brief get the name of an activity
+     * 
+     * @param   activity    ACTIVITY_STILL, ACTIVITY_WALK, ACTIVITY_RUN or ACTIVITY_SLEEP
+     * 
+     * @return  "still", "walk", "run", "sleep" or "unknown"
+     */
+    const char *activity_get_name( int activity );
+
+#endif // _ACTIVITY_H
@@ -35,36 +35,54 @@
 #include "blectl.h"
 #include "powermgm.h"
 #include "callback.h"
+#include "gadgetbridge.h"
+#include "json_msg.h"
 #include "json_psram_allocator.h"
 
 #include "gui/statusbar.h"
+#include "config_store.h"
 
 EventGroupHandle_t blectl_status = NULL;
 portMUX_TYPE DRAM_ATTR blectlMux = portMUX_INITIALIZER_UNLOCKED;
 
 blectl_config_t blectl_config;
-blectl_msg_t blectl_msg;
+blectl_stats_t blectl_stats;
+static volatile bool blectl_stats_reset = false;
+
+/*
+ * send task state, TX_READY is set by the stack when a notify is handed
+ * over to the controller, TX_CONGESTED while the controller buffers are full
+ */
+#define BLECTL_TX_READY         _BV(0)
+#define BLECTL_TX_CONGESTED     _BV(1)
+EventGroupHandle_t blectl_tx_status = NULL;
+QueueHandle_t blectl_msg_queue = NULL;
+TaskHandle_t _blectl_send_Task;
 
 callback_t *blectl_callback = NULL;
 
 bool blectl_send_event_cb( EventBits_t event, void *arg );
 bool blectl_powermgm_event_cb( EventBits_t event, void *arg );
-bool blectl_powermgm_loop_cb( EventBits_t event, void *arg );
-void blectl_loop( void );
+void blectl_send_Task( void * pvParameters );
 
 BLEServer *pServer = NULL;
 BLECharacteristic *pTxCharacteristic;
+BLE2902 *pTxDescriptor;
 BLECharacteristic *pRxCharacteristic;
 uint8_t txValue = 0;
 
 BLECharacteristic *pBatteryLevelCharacteristic;
 BLECharacteristic *pBatteryPowerStateCharacteristic;
 
-char *gadgetbridge_msg = NULL;
-uint32_t gadgetbridge_msg_size = 0;
-
 class BleCtlServerCallbacks: public BLEServerCallbacks {
     void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param ) {
+        /*
+         * the send task owns the counters and resets them before the first message
+         */
+        portENTER_CRITICAL(&blectlMux);
+        blectl_stats.mtu = BLECTL_DEFAULT_MTU;
+        blectl_stats_reset = true;
+        portEXIT_CRITICAL(&blectlMux);
         blectl_set_event( BLECTL_CONNECT );
         blectl_clear_event( BLECTL_DISCONNECT );
         blectl_send_event_cb( BLECTL_CONNECT, (void *)"connected" );
@@ -77,6 +95,11 @@ class BleCtlServerCallbacks: public BLEServerCallbacks {
     void onDisconnect(BLEServer* pServer) {
         blectl_set_event( BLECTL_DISCONNECT );
         blectl_clear_event( BLECTL_CONNECT );
+        /*
+         * wakeup the send task to abort the current message
+         */
+        xEventGroupSetBits( blectl_tx_status, BLECTL_TX_READY );
+        xEventGroupClearBits( blectl_tx_status, BLECTL_TX_CONGESTED );
         blectl_send_event_cb( BLECTL_DISCONNECT, (void *)"disconnected" );
         log_i("BLE disconnected");
         delay(500);
@@ -127,87 +150,53 @@ class BtlCtlSecurity : public BLESecurityCallbacks {
     }
 };
 
-void blectl_add_char_to_gadgetbridge_msg( char msg_char ) {
-    gadgetbridge_msg_size++;
-
-    if ( gadgetbridge_msg == NULL ) {
-        gadgetbridge_msg = (char *)ps_calloc( gadgetbridge_msg_size + 1, 1 );
-        if ( gadgetbridge_msg == NULL ) {
-            log_e("gadgetbridge_msg alloc fail");
-            while(true);
-        }
-    }
-    else {
-        char *new_gadgetbridge_msg = NULL;
-        new_gadgetbridge_msg = (char *)ps_realloc( gadgetbridge_msg, gadgetbridge_msg_size + 1 );
-        if ( new_gadgetbridge_msg == NULL ) {
-            log_e("gadgetbridge_msg realloc fail");
-            while(true);            
-        }
-        gadgetbridge_msg = new_gadgetbridge_msg;
+static void blectl_gatts_event_handler( esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param ) {
+    switch( event ) {
+        case ESP_GATTS_MTU_EVT:
+            portENTER_CRITICAL(&blectlMux);
+            blectl_stats.mtu = param->mtu.mtu;
+            portEXIT_CRITICAL(&blectlMux);
+            log_i("BLE MTU %d", param->mtu.mtu );
+            break;
+        case ESP_GATTS_CONGEST_EVT:
+            if ( param->congest.congested ) {
+                portENTER_CRITICAL(&blectlMux);
+                blectl_stats.congested++;
+                portEXIT_CRITICAL(&blectlMux);
+                xEventGroupSetBits( blectl_tx_status, BLECTL_TX_CONGESTED );
+            }
+            else {
+                xEventGroupClearBits( blectl_tx_status, BLECTL_TX_CONGESTED );
+                xEventGroupSetBits( blectl_tx_status, BLECTL_TX_READY );
+            }
+            break;
+        case ESP_GATTS_CONF_EVT:
+            if ( pTxCharacteristic && param->conf.handle == pTxCharacteristic->getHandle() ) {
+                xEventGroupSetBits( blectl_tx_status, BLECTL_TX_READY );
+            }
+            break;
+        default:
+            break;
     }
-    gadgetbridge_msg[ gadgetbridge_msg_size - 1 ] = msg_char;
-    gadgetbridge_msg[ gadgetbridge_msg_size ] = '\0';
 }
 
-void blectl_delete_gadgetbridge_msg ( void ) {
-    gadgetbridge_msg_size = 0;
-
-    if ( gadgetbridge_msg == NULL ) {
-        gadgetbridge_msg = (char *)ps_calloc( gadgetbridge_msg_size + 1, 1 );
-        if ( gadgetbridge_msg == NULL ) {
-            log_e("gadgetbridge_msg alloc fail");
-            while(true);
-        }
-    }
-    else {
-        char *new_gadgetbridge_msg = NULL;
-        new_gadgetbridge_msg = (char *)ps_realloc( gadgetbridge_msg, gadgetbridge_msg_size + 1 );
-        if ( new_gadgetbridge_msg == NULL ) {
-            log_e("gadgetbridge_msg realloc fail");
-            while(true);            
-        }
-        gadgetbridge_msg = new_gadgetbridge_msg;
+static void blectl_gadgetbridge_frame( char *frame, size_t len ) {
+    /*
+     * decode once in place for all json consumers
+     */
+    JsonDocument *doc = json_msg_decode( frame, len, gadgetbridge_get_filter( frame ) );
+    if ( doc ) {
+        blectl_send_event_cb( BLECTL_MSG_JSON, (void *)doc );
+        json_msg_release();
     }
-    gadgetbridge_msg[ gadgetbridge_msg_size ] = '\0';
 }
 
 class BleCtlCallbacks : public BLECharacteristicCallbacks
 {
     void onWrite(BLECharacteristic *pCharacteristic)
     {
-        char *msg = (char *)ps_calloc( pCharacteristic->getValue().length() + 1, 1 );
-        if ( msg == NULL ) {
-            Serial.printf("ps_calloc fail\r\n");
-            return;
-        }
-        else {
-            strlcpy( msg, pCharacteristic->getValue().c_str(), pCharacteristic->getValue().length() + 1 );
-            for ( int i = 0 ; i < pCharacteristic->getValue().length(); i++ ) {
-                switch( msg[ i ] ) {
-                    case EndofText:         blectl_delete_gadgetbridge_msg();
-                                            log_i("attention, new link establish");
-                                            break;
-                    case DataLinkEscape:    blectl_delete_gadgetbridge_msg();
-                                            log_i("attention, new message");
-                                            break;
-                    case LineFeed:          log_i("message complete, fire BLTCTL_MSG callback");
-                                            if( gadgetbridge_msg[ 0 ] == 'G' && gadgetbridge_msg[ 1 ] == 'B' ) {
-                                                log_i("gadgetbridge message identified, cut down to json");
-                                                gadgetbridge_msg[ gadgetbridge_msg_size - 1 ] = '\0';
-                                                log_i("msg: %s", &gadgetbridge_msg[ 3 ] );
-                                                blectl_send_event_cb( BLECTL_MSG, (void *)&gadgetbridge_msg[ 3 ] );
-                                            }
-                                            else {
-                                                log_i("msg: %s", gadgetbridge_msg );
-                                                blectl_send_event_cb( BLECTL_MSG, (void *)&gadgetbridge_msg[ 0 ] );
-                                            }
-                                            break;
-                    default:                blectl_add_char_to_gadgetbridge_msg( msg[ i ] );
-                }
-            }
-            free(msg);
-        }
+        std::string value = pCharacteristic->getValue();
+        gadgetbridge_feed( (const uint8_t *)value.data(), value.length() );
     }
 };
 
@@ -221,16 +210,25 @@ void blectl_setup( void ) {
     esp_bt_controller_mem_release( ESP_BT_MODE_IDLE );
     esp_bt_mem_release( ESP_BT_MODE_IDLE );
 
-    blectl_msg.active = false;
-    blectl_msg.msg = NULL;
-    blectl_msg.msglen = 0;
-    blectl_msg.msgpos = 0;
+    blectl_tx_status = xEventGroupCreate();
+    blectl_msg_queue = xQueueCreate( BLECTL_MSG_QUEUE_LEN, sizeof( blectl_msg_t ) );
+    if ( blectl_tx_status == NULL || blectl_msg_queue == NULL ) {
+        log_e("blectl send queue alloc failed");
+        while( true );
+    }
+    blectl_stats.mtu = BLECTL_DEFAULT_MTU;
+
+    if ( !gadgetbridge_setup( blectl_gadgetbridge_frame ) ) {
+        log_e("gadgetbridge setup failed");
+    }
 
     // Create the BLE Device
     // Name needs to match filter in Gadgetbridge's banglejs getSupportedType() function.
     // This is too long I think:
     // BLEDevice::init("Espruino Gadgetbridge Compatible Device");
     BLEDevice::init("Espruino (T-Watch2020)");
+    BLEDevice::setMTU( BLECTL_MTU );
+    BLEDevice::setCustomGattsHandler( blectl_gatts_event_handler );
     // The minimum power level (-12dbm) ESP_PWR_LVL_N12 was too low
     switch( blectl_config.txpower ) {
         case 0:             BLEDevice::setPower( ESP_PWR_LVL_N12 );
@@ -268,7 +266,8 @@ void blectl_setup( void ) {
     // Create a BLE Characteristic
     pTxCharacteristic = pService->createCharacteristic( CHARACTERISTIC_UUID_TX, BLECharacteristic::PROPERTY_NOTIFY );
     pTxCharacteristic->setAccessPermissions(ESP_GATT_PERM_READ_ENCRYPTED | ESP_GATT_PERM_WRITE_ENCRYPTED);
-    pTxCharacteristic->addDescriptor( new BLE2902() );
+    pTxDescriptor = new BLE2902();
+    pTxCharacteristic->addDescriptor( pTxDescriptor );
     pRxCharacteristic = pService->createCharacteristic( CHARACTERISTIC_UUID_RX, BLECharacteristic::PROPERTY_WRITE );
     pRxCharacteristic->setAccessPermissions(ESP_GATT_PERM_READ_ENCRYPTED | ESP_GATT_PERM_WRITE_ENCRYPTED);
     pRxCharacteristic->setCallbacks( new BleCtlCallbacks() );
@@ -319,7 +318,13 @@ void blectl_setup( void ) {
         blectl_on();
     }
     powermgm_register_cb( POWERMGM_SILENCE_WAKEUP | POWERMGM_STANDBY | POWERMGM_WAKEUP, blectl_powermgm_event_cb, "blectl" );
-    powermgm_register_loop_cb( POWERMGM_SILENCE_WAKEUP | POWERMGM_STANDBY | POWERMGM_WAKEUP, blectl_powermgm_loop_cb, "blectl loop" );
+
+    xTaskCreate(    blectl_send_Task,               /* Function to implement the task */
+                    "blectl send Task",             /* Name of the task */
+                    4096,                           /* Stack size in words */
+                    NULL,                           /* Task input parameter */
+                    1,                              /* Priority of the task */
+                    &_blectl_send_Task );           /* Task handle. */
 }
 
 bool blectl_powermgm_event_cb( EventBits_t event, void *arg ) {
@@ -345,11 +350,6 @@ bool blectl_powermgm_event_cb( EventBits_t event, void *arg ) {
     return( retval );
 }
 
-bool blectl_powermgm_loop_cb( EventBits_t event, void *arg ) {
-    blectl_loop();
-    return( true );
-}
-
 void blectl_set_event( EventBits_t bits ) {
     portENTER_CRITICAL(&blectlMux);
     xEventGroupSetBits( blectl_status, bits );
@@ -456,28 +456,13 @@ bool blectl_get_advertising( void ) {
 }
 
 void blectl_save_config( void ) {
-    fs::File file = SPIFFS.open( BLECTL_JSON_COFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", BLECTL_JSON_COFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["autoon"] = blectl_config.autoon;
-        doc["advertising"] = blectl_config.advertising;
-        doc["enable_on_standby"] = blectl_config.enable_on_standby;
-        doc["tx_power"] = blectl_config.txpower;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &blectl_config );
 }
 
-void blectl_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void blectl_read_json_config( void ) {
     if ( SPIFFS.exists( BLECTL_JSON_COFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( BLECTL_JSON_COFIG_FILE, FILE_READ );
         if (!file) {
@@ -503,6 +488,10 @@ void blectl_read_config( void ) {
     }
 }
 
+void blectl_read_config( void ) {
+    config_store_register( "blectl", &blectl_config, sizeof( blectl_config ), blectl_read_json_config );
+}
+
 void blectl_update_battery( int32_t percent, bool charging, bool plug ) {
     uint8_t level = (uint8_t)percent;
     if (level > 100) level = 100;
@@ -519,25 +508,43 @@ void blectl_update_battery( int32_t percent, bool charging, bool plug ) {
 }
 
 void blectl_send_msg( char *msg ) {
-    if ( !blectl_msg.active && blectl_get_event( BLECTL_CONNECT ) ) {
-        blectl_msg.msg = (char *)ps_calloc( strlen( (const char*)msg + 1 ), 1 );
-        if ( blectl_msg.msg ) {
-            memcpy( blectl_msg.msg, msg, strlen( (const char*)msg + 1 ) );
-        }
-        else {
-            log_e("ps_calloc failed");
-            blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, ps_calloc failed" );
-            return;
-        }
-        blectl_msg.active = true;
-        blectl_msg.msglen = strlen( (const char*)msg );
-        blectl_msg.msgpos = 0;
+    blectl_msg_t blectl_msg;
+
+    if ( !blectl_get_event( BLECTL_CONNECT ) ) {
+        log_e("blectl is not connected");
+        blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, blectl is not connected" );
+        return;
     }
-    else {
-        log_e("blectl is send another msg or not connected");
-        blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, blectl is send another msg or not connected" );
+
+    blectl_msg.msglen = strlen( (const char*)msg );
+    blectl_msg.msg = (char *)ps_malloc( blectl_msg.msglen + 1 );
+    if ( blectl_msg.msg == NULL ) {
+        log_e("ps_malloc failed");
+        blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, ps_malloc failed" );
+        return;
+    }
+    memcpy( blectl_msg.msg, msg, blectl_msg.msglen + 1 );
+
+    if ( xQueueSend( blectl_msg_queue, &blectl_msg, 0 ) != pdTRUE ) {
+        log_e("blectl msg queue full");
+        free( blectl_msg.msg );
+        blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, msg queue full" );
         return;
     }
+
+    uint32_t queue_depth = uxQueueMessagesWaiting( blectl_msg_queue );
+    portENTER_CRITICAL(&blectlMux);
+    blectl_stats.queue_depth = queue_depth;
+    if ( blectl_stats.queue_depth > blectl_stats.queue_depth_max ) {
+        blectl_stats.queue_depth_max = blectl_stats.queue_depth;
+    }
+    portEXIT_CRITICAL(&blectlMux);
+}
+
+void blectl_get_stats( blectl_stats_t *stats ) {
+    portENTER_CRITICAL(&blectlMux);
+    *stats = blectl_stats;
+    portEXIT_CRITICAL(&blectlMux);
 }
 
 void blectl_on( void ) {
@@ -561,50 +568,111 @@ void blectl_off( void ) {
     blectl_send_event_cb( BLECTL_OFF, (void *)NULL );
 }
 
-void blectl_loop ( void ) {
-    static uint64_t NextMillis = millis();
-
-    if ( millis() - NextMillis > BLECTL_CHUNKDELAY ) {
-        NextMillis += BLECTL_CHUNKDELAY;
-        if ( blectl_msg.active ) {
-            if ( blectl_msg.msgpos < blectl_msg.msglen ) {
-                if ( ( blectl_msg.msglen - blectl_msg.msgpos ) > BLECTL_CHUNKSIZE ) {
-                    pTxCharacteristic->setValue( (unsigned char*)&blectl_msg.msg[ blectl_msg.msgpos ], BLECTL_CHUNKSIZE );
-                    pTxCharacteristic->notify();
-                    log_i("send %dbyte [ %c%c%c ... ] chunk", BLECTL_CHUNKSIZE, blectl_msg.msg[ blectl_msg.msgpos ], blectl_msg.msg[ blectl_msg.msgpos + 1 ], blectl_msg.msg[ blectl_msg.msgpos + 2 ] );
-                    blectl_msg.msgpos += BLECTL_CHUNKSIZE;
-                }
-                else if ( ( blectl_msg.msglen - blectl_msg.msgpos ) > 0 ) {
-                    pTxCharacteristic->setValue( (unsigned char*)&blectl_msg.msg[ blectl_msg.msgpos ], blectl_msg.msglen - blectl_msg.msgpos );
-                    pTxCharacteristic->notify();
-                    log_i("send last %dbyte chunk", blectl_msg.msglen - blectl_msg.msgpos );
-                    blectl_send_event_cb( BLECTL_MSG_SEND_SUCCESS , (char*)"msg send success" );
-                    free( blectl_msg.msg );
-                    blectl_msg.active = false;
-                    blectl_msg.msg = NULL;
-                    blectl_msg.msglen = 0;
-                    blectl_msg.msgpos = 0;
-                }
-                else {
-                    log_e("malformed chunksize");
-                    blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, malformed chunksize" );
-                    free( blectl_msg.msg );
-                    blectl_msg.active = false;
-                    blectl_msg.msg = NULL;
-                    blectl_msg.msglen = 0;
-                    blectl_msg.msgpos = 0;
-                }
-            }
-            else {
-                log_e("unkown msg state");
-                blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, unkown msg state" );
-                if ( blectl_msg.msg )
-                    free( blectl_msg.msg );
-                blectl_msg.active = false;
-                blectl_msg.msg = NULL;
-                blectl_msg.msglen = 0;
-                blectl_msg.msgpos = 0;
+static bool blectl_send_chunks( char *msg, int32_t msglen ) {
+    int32_t msgpos = 0;
+    uint32_t start = millis();
+
+    while( msgpos < msglen ) {
+        if ( !blectl_get_event( BLECTL_CONNECT ) ) {
+            log_e("connection lost");
+            return( false );
+        }
+        /*
+         * a notify carries up to MTU - 3 bytes of payload
+         */
+        portENTER_CRITICAL(&blectlMux);
+        int32_t chunksize = blectl_stats.mtu - 3;
+        portEXIT_CRITICAL(&blectlMux);
+        if ( chunksize > msglen - msgpos ) {
+            chunksize = msglen - msgpos;
+        }
+
+        xEventGroupClearBits( blectl_tx_status, BLECTL_TX_READY );
+        pTxCharacteristic->setValue( (unsigned char*)&msg[ msgpos ], chunksize );
+        pTxCharacteristic->notify();
+        /*
+         * pace by notify complete and hold back while the controller is congested, without
+         * notifications enabled by the peer notify() sends nothing and no complete comes
+         */
+        if ( !pTxDescriptor->getNotifications() ) {
+            portENTER_CRITICAL(&blectlMux);
+            blectl_stats.unsubscribed++;
+            portEXIT_CRITICAL(&blectlMux);
+        }
+        else if ( !( xEventGroupWaitBits( blectl_tx_status, BLECTL_TX_READY, pdTRUE, pdTRUE, pdMS_TO_TICKS( BLECTL_CHUNK_TIMEOUT ) ) & BLECTL_TX_READY ) ) {
+            portENTER_CRITICAL(&blectlMux);
+            blectl_stats.timeouts++;
+            portEXIT_CRITICAL(&blectlMux);
+        }
+        while ( xEventGroupGetBits( blectl_tx_status ) & BLECTL_TX_CONGESTED ) {
+            xEventGroupWaitBits( blectl_tx_status, BLECTL_TX_READY, pdTRUE, pdTRUE, pdMS_TO_TICKS( BLECTL_CHUNK_TIMEOUT ) );
+            if ( !blectl_get_event( BLECTL_CONNECT ) ) {
+                log_e("connection lost");
+                return( false );
             }
         }
+        log_d("send %dbyte chunk", chunksize );
+
+        msgpos += chunksize;
+        portENTER_CRITICAL(&blectlMux);
+        blectl_stats.chunks++;
+        blectl_stats.bytes += chunksize;
+        portEXIT_CRITICAL(&blectlMux);
+    }
+
+    uint32_t send_time = millis() - start;
+    portENTER_CRITICAL(&blectlMux);
+    blectl_stats.send_time += send_time;
+    if ( blectl_stats.send_time ) {
+        blectl_stats.throughput = ( (uint64_t)blectl_stats.bytes * 1000 ) / blectl_stats.send_time;
+    }
+    portEXIT_CRITICAL(&blectlMux);
+    return( true );
+}
+
+void blectl_send_Task( void * pvParameters ) {
+    blectl_msg_t blectl_msg;
+
+    log_i("start blectl send task, heap: %d", ESP.getFreeHeap() );
+
+    while( true ) {
+        if ( xQueueReceive( blectl_msg_queue, &blectl_msg, portMAX_DELAY ) != pdTRUE ) {
+            continue;
+        }
+        uint32_t queue_depth = uxQueueMessagesWaiting( blectl_msg_queue );
+        portENTER_CRITICAL(&blectlMux);
+        if ( blectl_stats_reset ) {
+            blectl_stats_t stats = { 0 };
+            stats.mtu = blectl_stats.mtu;
+            stats.stack_free = blectl_stats.stack_free;
+            blectl_stats = stats;
+            blectl_stats_reset = false;
+        }
+        blectl_stats.queue_depth = queue_depth;
+        portEXIT_CRITICAL(&blectlMux);
+
+        bool send = blectl_send_chunks( blectl_msg.msg, blectl_msg.msglen );
+        if ( send ) {
+            log_i("send %dbyte msg", blectl_msg.msglen );
+            blectl_send_event_cb( BLECTL_MSG_SEND_SUCCESS , (char*)"msg send success" );
+        }
+        else {
+            blectl_send_event_cb( BLECTL_MSG_SEND_ABORT , (char*)"msg send abort, connection lost" );
+        }
+        free( blectl_msg.msg );
+        /*
+         * the callbacks above run on this stack, watch the lowest free stack
+         */
+        uint32_t stack_free = uxTaskGetStackHighWaterMark( NULL );
+        portENTER_CRITICAL(&blectlMux);
+        if ( send ) {
+            blectl_stats.msg_send++;
+        }
+        else {
+            blectl_stats.msg_abort++;
+        }
+        blectl_stats.stack_free = stack_free;
+        portEXIT_CRITICAL(&blectlMux);
+        log_d("blectl send task stack free: %d", stack_free );
     }
-}
\ No newline at end of file
+}
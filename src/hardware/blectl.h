@@ -62,12 +62,10 @@
 
     #define BLECTL_JSON_COFIG_FILE         "/blectl.json"
 
-    #define EndofText               0x03
-    #define LineFeed                0x0a
-    #define DataLinkEscape          0x10
-
-    #define BLECTL_CHUNKSIZE        20
-    #define BLECTL_CHUNKDELAY       50
+    #define BLECTL_MTU              185         // local ATT MTU we ask the central for
+    #define BLECTL_DEFAULT_MTU      23          // ATT MTU until the central negotiates
+    #define BLECTL_MSG_QUEUE_LEN    8           // max queued outgoing messages
+    #define BLECTL_CHUNK_TIMEOUT    500         // max ms to wait for a notify complete
 
     typedef struct {
         bool autoon = true;
@@ -77,26 +75,39 @@
     } blectl_config_t;
 
     typedef struct {
-        bool active;
         char *msg;
         int32_t msglen;
-        int32_t msgpos;
-        int32_t msgchunk;
     } blectl_msg_t;
 
+    typedef struct {
+        uint16_t mtu;                   // negotiated ATT MTU
+        uint32_t msg_send;
+        uint32_t msg_abort;
+        uint32_t chunks;
+        uint32_t bytes;
+        uint32_t send_time;             // ms spend in sending chunks
+        uint32_t throughput;            // bytes per second while sending
+        uint32_t congested;
+        uint32_t timeouts;
+        uint32_t unsubscribed;          // chunks send while the peer has notifications off
+        uint32_t queue_depth;
+        uint32_t queue_depth_max;
+        uint32_t stack_free;            // lowest free send task stack in bytes
+    } blectl_stats_t;
+
     #define BLECTL_CONNECT               _BV(0)
     #define BLECTL_DISCONNECT            _BV(1)
     #define BLECTL_STANDBY               _BV(2)
     #define BLECTL_ON                    _BV(3)
     #define BLECTL_OFF                   _BV(4)
     #define BLECTL_ACTIVE                _BV(5)
-    #define BLECTL_MSG                   _BV(6)
     #define BLECTL_PIN_AUTH              _BV(7)
     #define BLECTL_PAIRING               _BV(8)
     #define BLECTL_PAIRING_SUCCESS       _BV(9)
     #define BLECTL_PAIRING_ABORT         _BV(10)
     #define BLECTL_MSG_SEND_SUCCESS      _BV(11)
     #define BLECTL_MSG_SEND_ABORT        _BV(12)
+    #define BLECTL_MSG_JSON              _BV(13)
 
     /**
      * @brief ble setup function
@@ -129,7 +140,8 @@
      *                                      BLECTL_ON,
      *                                      BLECTL_OFF,       
      *                                      BLECTL_ACTIVE,    
-     *                                      BLECTL_MSG,
+     *                                      BLECTL_MSG_JSON, arg is a pointer to the decoded JsonDocument,
+     *                                          only valid while the callback runs
      *                                      BLECTL_PIN_AUTH,
      *                                      BLECTL_PAIRING,
      *                                      BLECTL_PAIRING_SUCCESS,
@@ -179,11 +191,19 @@
      */
     void blectl_update_battery( int32_t percent, bool charging, bool plug );
     /**
-     * @brief send an message over bluettoth to gadgetbridge
+     * @brief queue an message to send over bluettoth to gadgetbridge. the message is copied
+     * and send in MTU sized chunks from the blectl send task. BLECTL_MSG_SEND_SUCCESS or
+     * BLECTL_MSG_SEND_ABORT is fired when done
      * 
      * @param   msg     pointer to a string
      */
     void blectl_send_msg( char *msg );
+    /**
+     * @brief get a copy of the transport statistics of the current connection
+     * 
+     * @param   stats   pointer to a blectl_stats_t structure that receives the copy
+     */
+    void blectl_get_stats( blectl_stats_t *stats );
     /**
      * @brief set the transmission power
      * 
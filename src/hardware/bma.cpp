@@ -22,13 +22,17 @@
 #include "config.h"
 #include <TTGO.h>
 #include <soc/rtc.h>
+#include <esp_timer.h>
 
 #include "bma.h"
+#include "activity.h"
 #include "powermgm.h"
 #include "callback.h"
+#include "i2cctl.h"
 #include "json_psram_allocator.h"
 
 #include "gui/statusbar.h"
+#include "config_store.h"
 
 volatile bool DRAM_ATTR bma_irq_flag = false;
 portMUX_TYPE DRAM_ATTR BMA_IRQ_Mux = portMUX_INITIALIZER_UNLOCKED;
@@ -42,10 +46,28 @@ callback_t *bma_callback = NULL;
 
 bool first_loop_run = true;
 
+static bool bma_fifo_enabled = false;
+static uint8_t bma_fifo_shift = 10;                                 // raw to mg, 1000 / 1024 per lsb at 2g
+static int16_t bma_window[ ACTIVITY_WINDOW * 3 ];
+static uint32_t bma_window_pos = 0;
+static activity_state_t bma_activity_state;
+static int bma_activity = -1;
+static uint32_t bma_activity_minute = 0;                            // unix minute of bma_activity_count
+static uint16_t bma_activity_count[ ACTIVITY_NUM ];
+static bma_activity_stats_t bma_activity_stats;
+static SemaphoreHandle_t bma_motion_mutex = NULL;
+static int16_t *bma_motion = NULL;                                  // PSRAM ring, BMA_MOTION_SAMPLES x, y, z
+static uint32_t bma_motion_seq = 0;                                 // sequence number of the next sample
+
 void IRAM_ATTR bma_irq( void );
 bool bma_send_event_cb( EventBits_t event, void *arg );
 bool bma_powermgm_event_cb( EventBits_t event, void *arg );
 bool bma_powermgm_loop_cb( EventBits_t event, void *arg );
+static bool bma_irq_event_cb( EventBits_t event, void *arg );
+static void bma_handle_irq( void );
+static void bma_fifo_enable( bool enable );
+static void bma_fifo_drain( void );
+static void bma_activity_window( void );
 
 void bma_setup( void ) {
     TTGOClass *ttgo = TTGOClass::getWatch();
@@ -53,6 +75,10 @@ void bma_setup( void ) {
     for ( int i = 0 ; i < BMA_CONFIG_NUM ; i++ ) {
         bma_config[ i ].enable = true;
     }
+    /*
+     * the fifo wakes up the esp32 every BMA_FIFO_WATERMARK in standby, so it is opt-in
+     */
+    bma_config[ BMA_ACTIVITY ].enable = false;
 
     if ( stepcounter_valid != 0xa5a5a5a5 ) {
       stepcounter = 0;
@@ -65,10 +91,22 @@ void bma_setup( void ) {
 
     bma_read_config();
 
+    bma_motion_mutex = xSemaphoreCreateMutex();
+    bma_motion = (int16_t*)ps_calloc( BMA_MOTION_SAMPLES * 3, sizeof( int16_t ) );
+    if ( bma_motion_mutex == NULL || bma_motion == NULL ) {
+        log_e("bma motion ring alloc failed");
+        bma_motion = NULL;
+    }
+    activity_init( &bma_activity_state );
+
     ttgo->bma->begin();
     ttgo->bma->attachInterrupt();
     ttgo->bma->direction();
 
+    /*
+     * the irq is handled in task context by the deferred callback, register it before the irq is attached
+     */
+    bma_register_cb( BMACTL_EVENT_INT, bma_irq_event_cb, "bma irq" );
     pinMode( BMA423_INT1, INPUT );
     attachInterrupt( BMA423_INT1, bma_irq, RISING );
 
@@ -125,46 +163,226 @@ void bma_reload_settings( void ) {
     ttgo->bma->enableStepCountInterrupt( bma_config[ BMA_STEPCOUNTER ].enable );
     ttgo->bma->enableWakeupInterrupt( bma_config[ BMA_DOUBLECLICK ].enable );
     ttgo->bma->enableTiltInterrupt( bma_config[ BMA_TILT ].enable );
+    bma_fifo_enable( bma_config[ BMA_ACTIVITY ].enable );
+}
+
+/*
+ * the accel runs at the odr of the feature engine, the fifo takes only every
+ * 2^n filtered sample down to BMA_FIFO_ODR and raises int1 at the watermark
+ */
+static void bma_fifo_enable( bool enable ) {
+    uint8_t data = 0;
+    int downs = 0;
+
+    if ( enable ) {
+        i2cctl_read_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_ACC_CONF, &data, 1 );
+        downs = ( data & 0x0f ) - BMA_FIFO_ODR;
+        if ( downs < 0 || downs > 7 ) {
+            log_e("bma odr 0x%02x not supported by the fifo", data & 0x0f );
+            enable = false;
+        }
+        i2cctl_read_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_ACC_RANGE, &data, 1 );
+        bma_fifo_shift = 10 - ( data & 0x03 );
+    }
+
+    if ( enable == bma_fifo_enabled ) {
+        return;
+    }
+
+    if ( enable ) {
+        uint8_t wtm[ 2 ] = { BMA_FIFO_WATERMARK & 0xff, BMA_FIFO_WATERMARK >> 8 };
+        data = 0x80 | ( downs << 4 );
+        i2cctl_write_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_FIFO_DOWNS, &data, 1 );
+        i2cctl_write_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_FIFO_WTM, wtm, 2 );
+        data = 0x00;
+        i2cctl_write_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_FIFO_CONFIG_0, &data, 1 );
+        data = 0x40;
+        i2cctl_write_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_FIFO_CONFIG_1, &data, 1 );
+        data = BMA_FIFO_FLUSH;
+        i2cctl_write_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_CMD, &data, 1 );
+    }
+    else {
+        data = 0x00;
+        i2cctl_write_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_FIFO_CONFIG_1, &data, 1 );
+    }
+
+    i2cctl_read_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_INT_MAP_DATA, &data, 1 );
+    data = enable ? data | _BV(1) : data & ~_BV(1);
+    i2cctl_write_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_INT_MAP_DATA, &data, 1 );
+
+    bma_window_pos = 0;
+    bma_activity_minute = 0;
+    memset( bma_activity_count, 0, sizeof( bma_activity_count ) );
+    activity_init( &bma_activity_state );
+    bma_activity = enable ? ACTIVITY_STILL : -1;
+    bma_fifo_enabled = enable;
+    log_i("bma fifo %s", enable ? "enabled" : "disabled" );
+}
+
+/*
+ * read the fifo in bursts, every complete window is classified
+ */
+static void bma_fifo_drain( void ) {
+    uint8_t frames[ BMA_FIFO_BURST ];
+    uint64_t start = esp_timer_get_time();
+
+    if ( i2cctl_read_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_FIFO_LENGTH, frames, 2 ) ) {
+        log_e("bma fifo length read failed");
+        return;
+    }
+    uint32_t length = ( frames[ 0 ] | ( frames[ 1 ] << 8 ) ) & 0x3fff;
+    length -= length % BMA_FIFO_FRAME;
+    if ( length == 0 ) {
+        return;
+    }
+    if ( length >= BMA_FIFO_SIZE - BMA_FIFO_FRAME ) {
+        bma_activity_stats.overflows++;
+    }
+
+    while ( length ) {
+        uint32_t burst = length > BMA_FIFO_BURST ? BMA_FIFO_BURST : length;
+        int16_t samples[ BMA_FIFO_BURST / BMA_FIFO_FRAME * 3 ];
+        uint32_t count = 0;
+
+        if ( i2cctl_read_bytes( BMA4_I2C_ADDR_SECONDARY, BMA_REG_FIFO_DATA, frames, burst ) ) {
+            log_e("bma fifo read failed");
+            break;
+        }
+        length -= burst;
+        bma_activity_stats.bursts++;
+
+        for ( uint8_t *frame = frames ; frame < frames + burst ; frame += BMA_FIFO_FRAME, count++ ) {
+            if ( ( frame[ 0 ] | ( frame[ 1 ] << 8 ) ) == BMA_FIFO_EMPTY ) {
+                length = 0;
+                break;
+            }
+            for ( int axis = 0 ; axis < 3 ; axis++ ) {
+                int16_t raw = frame[ axis * 2 ] | ( frame[ axis * 2 + 1 ] << 8 );
+                samples[ count * 3 + axis ] = ( ( raw >> 4 ) * 1000 ) >> bma_fifo_shift;
+            }
+        }
+        bma_activity_stats.samples += count;
+
+        if ( bma_motion ) {
+            xSemaphoreTake( bma_motion_mutex, portMAX_DELAY );
+            for ( uint32_t i = 0 ; i < count ; i++, bma_motion_seq++ ) {
+                memcpy( &bma_motion[ ( bma_motion_seq % BMA_MOTION_SAMPLES ) * 3 ], &samples[ i * 3 ], 3 * sizeof( int16_t ) );
+            }
+            xSemaphoreGive( bma_motion_mutex );
+        }
+
+        for ( uint32_t i = 0 ; i < count ; i++ ) {
+            memcpy( &bma_window[ bma_window_pos * 3 ], &samples[ i * 3 ], 3 * sizeof( int16_t ) );
+            if ( ++bma_window_pos == ACTIVITY_WINDOW ) {
+                bma_window_pos = 0;
+                bma_activity_window();
+            }
+        }
+    }
+
+    uint32_t time = esp_timer_get_time() - start;
+    bma_activity_stats.drains++;
+    if ( time > bma_activity_stats.drain_time_max ) {
+        bma_activity_stats.drain_time_max = time;
+    }
+}
+
+/*
+ * classify the full window and send the most frequent activity of a closed minute
+ */
+static void bma_activity_window( void ) {
+    uint64_t start = esp_timer_get_time();
+    bma_activity = activity_classify( bma_window, &bma_activity_state, NULL );
+    uint32_t time = esp_timer_get_time() - start;
+
+    bma_activity_stats.windows++;
+    bma_activity_stats.activity[ bma_activity ]++;
+    if ( time > bma_activity_stats.kernel_time_max ) {
+        bma_activity_stats.kernel_time_max = time;
+    }
+
+    time_t now;
+    time( &now );
+    uint32_t minute = now / 60;
+    if ( minute != bma_activity_minute ) {
+        if ( bma_activity_minute ) {
+            bma_activity_event_t event;
+            event.time = (time_t)bma_activity_minute * 60;
+            event.activity = ACTIVITY_STILL;
+            for ( int i = 1 ; i < ACTIVITY_NUM ; i++ ) {
+                if ( bma_activity_count[ i ] > bma_activity_count[ event.activity ] ) {
+                    event.activity = i;
+                }
+            }
+            bma_send_event_cb( BMACTL_ACTIVITY, (void *)&event );
+        }
+        memset( bma_activity_count, 0, sizeof( bma_activity_count ) );
+        bma_activity_minute = minute;
+    }
+    bma_activity_count[ bma_activity ]++;
 }
 
 void IRAM_ATTR bma_irq( void ) {
     portENTER_CRITICAL_ISR(&BMA_IRQ_Mux);
     bma_irq_flag = true;
     portEXIT_CRITICAL_ISR(&BMA_IRQ_Mux);
+    callback_send_from_isr( bma_callback, BMACTL_EVENT_INT, NULL );
+    powermgm_set_event_from_isr( POWERMGM_LOOP_NOTIFY );
 }
 
-void bma_loop( void ) {
+static bool bma_irq_event_cb( EventBits_t event, void *arg ) {
+    bma_handle_irq();
+    return( true );
+}
+
+static void bma_handle_irq( void ) {
     TTGOClass *ttgo = TTGOClass::getWatch();
     /*
-     * handle IRQ event
+     * the flag makes sure the irq is handled once, from the deferred callback or
+     * from bma_loop when the deferred queue was full
      */
     portENTER_CRITICAL(&BMA_IRQ_Mux);
     bool temp_bma_irq_flag = bma_irq_flag;
     bma_irq_flag = false;
     portEXIT_CRITICAL(&BMA_IRQ_Mux);
 
-    if ( temp_bma_irq_flag ) {                
-        while( !ttgo->bma->readInterrupt() );
+    if ( !temp_bma_irq_flag ) {
+        return;
+    }
 
-        if ( ttgo->bma->isDoubleClick() ) {
-            powermgm_set_event( POWERMGM_BMA_DOUBLECLICK );
-            bma_send_event_cb( BMACTL_DOUBLECLICK, (void *)"" );
-        }
-        if ( ttgo->bma->isTilt() ) {
-            powermgm_set_event( POWERMGM_BMA_TILT );
-            bma_send_event_cb( BMACTL_TILT, (void *)"" );
-        }
-        if ( ttgo->bma->isStepCounter() ) {
-            stepcounter_before_reset = ttgo->bma->getCounter();
-            char msg[16]="";
-            snprintf( msg, sizeof( msg ),"%d", stepcounter + stepcounter_before_reset );
-            bma_send_event_cb( BMACTL_STEPCOUNTER, (void *)msg );
-        }
+    while( !ttgo->bma->readInterrupt() );
+
+    if ( bma_fifo_enabled ) {
+        bma_fifo_drain();
+    }
+
+    if ( ttgo->bma->isDoubleClick() ) {
+        powermgm_set_event( POWERMGM_BMA_DOUBLECLICK );
+        bma_send_event_cb( BMACTL_DOUBLECLICK, (void *)"" );
+    }
+    if ( ttgo->bma->isTilt() ) {
+        powermgm_set_event( POWERMGM_BMA_TILT );
+        bma_send_event_cb( BMACTL_TILT, (void *)"" );
     }
+    if ( ttgo->bma->isStepCounter() ) {
+        stepcounter_before_reset = ttgo->bma->getCounter();
+        char msg[16]="";
+        snprintf( msg, sizeof( msg ),"%d", stepcounter + stepcounter_before_reset );
+        bma_send_event_cb( BMACTL_STEPCOUNTER, (void *)msg );
+    }
+}
+
+void bma_loop( void ) {
+    TTGOClass *ttgo = TTGOClass::getWatch();
+
+    bma_handle_irq();
 
     // force update statusbar after restart/boot
     if ( first_loop_run ) {
         first_loop_run = false;
+        if ( bma_fifo_enabled ) {
+            bma_fifo_drain();
+        }
         stepcounter_before_reset = ttgo->bma->getCounter();
         char msg[16]="";
         snprintf( msg, sizeof( msg ),"%d", stepcounter + stepcounter_before_reset );
@@ -172,6 +390,45 @@ void bma_loop( void ) {
     }
 }
 
+uint32_t bma_get_stepcounter( void ) {
+    return( stepcounter + stepcounter_before_reset );
+}
+
+int bma_get_activity( void ) {
+    return( bma_activity );
+}
+
+bma_activity_stats_t *bma_get_activity_stats( void ) {
+    return( &bma_activity_stats );
+}
+
+bool bma_get_motion_range( uint32_t *first, uint32_t *last ) {
+    if ( bma_motion == NULL ) {
+        return( false );
+    }
+    xSemaphoreTake( bma_motion_mutex, portMAX_DELAY );
+    *last = bma_motion_seq;
+    *first = bma_motion_seq > BMA_MOTION_SAMPLES ? bma_motion_seq - BMA_MOTION_SAMPLES : 0;
+    xSemaphoreGive( bma_motion_mutex );
+    return( true );
+}
+
+size_t bma_get_motion( uint32_t seq, int16_t *xyz, size_t max ) {
+    size_t count = 0;
+
+    if ( bma_motion == NULL ) {
+        return( 0 );
+    }
+    xSemaphoreTake( bma_motion_mutex, portMAX_DELAY );
+    if ( seq + BMA_MOTION_SAMPLES >= bma_motion_seq ) {
+        for ( ; seq < bma_motion_seq && count < max ; seq++, count++ ) {
+            memcpy( &xyz[ count * 3 ], &bma_motion[ ( seq % BMA_MOTION_SAMPLES ) * 3 ], 3 * sizeof( int16_t ) );
+        }
+    }
+    xSemaphoreGive( bma_motion_mutex );
+    return( count );
+}
+
 bool bma_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id ) {
     if ( bma_callback == NULL ) {
         bma_callback = callback_init( "bma" );
@@ -188,32 +445,13 @@ bool bma_send_event_cb( EventBits_t event, void *arg ) {
 }
 
 void bma_save_config( void ) {
-    if ( SPIFFS.exists( BMA_COFIG_FILE ) ) {
-        SPIFFS.remove( BMA_COFIG_FILE );
-        log_i("remove old binary bma config");
-    }
-
-    fs::File file = SPIFFS.open( BMA_JSON_COFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", BMA_JSON_COFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["stepcounter"] = bma_config[ BMA_STEPCOUNTER ].enable;
-        doc["doubleclick"] = bma_config[ BMA_DOUBLECLICK ].enable;
-        doc["tilt"] = bma_config[ BMA_TILT ].enable;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( bma_config );
 }
 
-void bma_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void bma_read_json_config( void ) {
     if ( SPIFFS.exists( BMA_JSON_COFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( BMA_JSON_COFIG_FILE, FILE_READ );
         if (!file) {
@@ -259,6 +497,21 @@ void bma_read_config( void ) {
     }
 }
 
+/*
+ * version 0 has the config items up to BMA_TILT, see config_store_register_version()
+ */
+static bool bma_upgrade_config( uint16_t version, const void *data, uint16_t size ) {
+    if ( version == 0 && size == BMA_ACTIVITY * sizeof( bma_config_t ) ) {
+        memcpy( bma_config, data, size );
+        return( true );
+    }
+    return( false );
+}
+
+void bma_read_config( void ) {
+    config_store_register_version( "bma", bma_config, sizeof( bma_config ), BMA_CONFIG_VERSION, bma_upgrade_config, bma_read_json_config );
+}
+
 bool bma_get_config( int config ) {
     if ( config < BMA_CONFIG_NUM ) {
         return( bma_config[ config ].enable );
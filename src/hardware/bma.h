@@ -24,23 +24,66 @@
 
     #include "TTGO.h"
     #include "callback.h"
+    #include "activity.h"
     
-    #define BMACTL_EVENT_INT            _BV(0)
+    #define BMACTL_EVENT_INT            _BV(0)      // send from the bma423 irq through callback_send_from_isr(), arg is NULL
     #define BMACTL_DOUBLECLICK          _BV(1)
     #define BMACTL_STEPCOUNTER          _BV(2)
     #define BMACTL_TILT                 _BV(3)
+    #define BMACTL_ACTIVITY             _BV(4)
+
+    #define BMA_REG_FIFO_LENGTH         0x24            // 14 bit fill level in bytes, lsb first
+    #define BMA_REG_FIFO_DATA           0x26
+    #define BMA_REG_ACC_CONF            0x40            // odr in bit 3:0
+    #define BMA_REG_ACC_RANGE           0x41            // 2g << range
+    #define BMA_REG_FIFO_DOWNS          0x45            // bit 7 filtered data, bit 6:4 downsampling 2^n
+    #define BMA_REG_FIFO_WTM            0x46            // 13 bit watermark in bytes, lsb first
+    #define BMA_REG_FIFO_CONFIG_0       0x48
+    #define BMA_REG_FIFO_CONFIG_1       0x49            // bit 6 accel, bit 4 header
+    #define BMA_REG_INT_MAP_DATA        0x58            // bit 1 fifo watermark on int1
+    #define BMA_REG_CMD                 0x7e
+
+    #define BMA_FIFO_ODR                0x05            // odr code of 12.5Hz, the feature engine keeps running at its own odr
+    #define BMA_FIFO_FRAME              6               // headerless accel frame, x, y, z 12 bit left justified
+    #define BMA_FIFO_SIZE               1024
+    #define BMA_FIFO_WATERMARK          ( 128 * BMA_FIFO_FRAME )    // 10.24s of samples per wakeup
+    #define BMA_FIFO_BURST              ( 20 * BMA_FIFO_FRAME )     // bytes per i2c read, below the 128 byte wire buffer
+    #define BMA_FIFO_EMPTY              0x8000          // x value of a frame read from an empty fifo
+    #define BMA_FIFO_FLUSH              0xb0
+    #define BMA_MOTION_SAMPLES          4096            // samples in the PSRAM motion ring, 5.5 minutes
 
     #define BMA_COFIG_FILE          "/bma.cfg"
     #define BMA_JSON_COFIG_FILE     "/bma.json"
+    #define BMA_CONFIG_VERSION      1               // 1: BMA_ACTIVITY
 
     typedef struct {
         bool enable=true;
     } bma_config_t;
 
+    /**
+     * arg of BMACTL_ACTIVITY, send once per minute with the most frequent activity of that minute
+     */
+    typedef struct {
+        time_t time;                    // start of the minute
+        int activity;                   // ACTIVITY_STILL, ACTIVITY_WALK, ACTIVITY_RUN or ACTIVITY_SLEEP
+    } bma_activity_event_t;
+
+    typedef struct {
+        uint32_t samples;               // samples read from the fifo
+        uint32_t bursts;                // i2c burst reads
+        uint32_t drains;                // fifo drains
+        uint32_t overflows;             // drains with a full fifo, samples lost
+        uint32_t windows;               // classified windows
+        uint32_t activity[ ACTIVITY_NUM ];  // windows per activity
+        uint32_t kernel_time_max;       // us per window
+        uint32_t drain_time_max;        // us per drain
+    } bma_activity_stats_t;
+
     enum {  
         BMA_STEPCOUNTER,
         BMA_DOUBLECLICK,
         BMA_TILT,
+        BMA_ACTIVITY,
         BMA_CONFIG_NUM
     };
 
@@ -75,13 +118,13 @@
     /**
      * @brief get config
      * 
-     * @param   config     configitem: BMA_STEPCOUNTER, BMA_DOUBLECLICK or BMA_CONFIG_NUM
+     * @param   config     configitem: BMA_STEPCOUNTER, BMA_DOUBLECLICK, BMA_TILT or BMA_ACTIVITY
      */
     bool bma_get_config( int config );
     /**
      * @brief set config
      * 
-     * @param   config     configitem: BMA_STEPCOUNTER, BMA_DOUBLECLICK or BMA_CONFIG_NUM
+     * @param   config     configitem: BMA_STEPCOUNTER, BMA_DOUBLECLICK, BMA_TILT or BMA_ACTIVITY
      * @param   bool    true or false
      */
     void bma_set_config( int config, bool enable );
@@ -91,10 +134,47 @@
      * @param   rotation on degree
      */
     void bma_set_rotate_tilt( uint32_t rotation );
+    /**
+     * @brief get the steps counted since the first start, survives a reset
+     * 
+     * @return  stepcounter
+     */
+    uint32_t bma_get_stepcounter( void );
+    /**
+     * @brief get the activity of the last classified window
+     * 
+     * @return  ACTIVITY_STILL, ACTIVITY_WALK, ACTIVITY_RUN, ACTIVITY_SLEEP or -1 when activity recognition is off
+     */
+    int bma_get_activity( void );
+    /**
+     * @brief get activity recognition statistics
+     * 
+     * @return  pointer to bma_activity_stats_t
+     */
+    bma_activity_stats_t *bma_get_activity_stats( void );
+    /**
+     * @brief get the sequence numbers of the samples in the motion ring
+     * 
+     * @param   first       pointer to the sequence number of the oldest sample
+     * @param   last        pointer to the sequence number after the newest sample
+     * 
+     * @return  false if no motion ring exists
+     */
+    bool bma_get_motion_range( uint32_t *first, uint32_t *last );
+    /**
+     * @brief copy samples from the motion ring, ACTIVITY_RATE_MHZ in mg
+     * 
+     * @param   seq         sequence number of the first sample
+     * @param   xyz         pointer to max interleaved x, y, z samples
+     * @param   max         max samples
+     * 
+     * @return  number of samples copied, 0 if seq is no longer or not yet in the ring
+     */
+    size_t bma_get_motion( uint32_t seq, int16_t *xyz, size_t max );
     /**
      * @brief registers a callback function which is called on a corresponding event
      * 
-     * @param   event           possible values: BMACTL_DOUBLECLICK, BMACTL_STEPCOUNTER and BMACTL_TILT
+     * @param   event           possible values: BMACTL_DOUBLECLICK, BMACTL_STEPCOUNTER, BMACTL_TILT and BMACTL_ACTIVITY
      * @param   callback_func   pointer to the callback function
      * @param   id              program id
      * 
@@ -19,30 +19,62 @@
  *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
  */
 #include "config.h"
+#include <esp_timer.h>
 
 #include "callback.h"
+#include "eventlog.h"
 
-void  display_record_event( callback_t *callback, EventBits_t event );
+typedef struct {
+    callback_t *callback;
+    EventBits_t event;
+    void *arg;
+} callback_deferred_t;
+
+static bool callback_build_index( callback_t *callback );
+static bool callback_call( callback_t *callback, EventBits_t event, void *arg, bool log );
 
 static bool display_event_logging = false;
+static bool callback_frozen = false;
+static uint32_t callback_rejected = 0;
+static const char *callback_rejected_id = NULL;
+static QueueHandle_t callback_deferred_queue = NULL;
+static portMUX_TYPE callback_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static callback_t *callback_first = NULL;
+static callback_t *callback_last = NULL;
 
 callback_t *callback_init( const char *name ) {
     callback_t *callback = NULL;
-    
-#if defined( BOARD_HAS_PSRAM )
-    callback = (callback_t*)ps_calloc( sizeof( callback_t ), 1 );
-#else
-    callback = (callback_t*)calloc( sizeof( callback_t ), 1 );
-#endif // BOARD_HAS_PSRAM
+    /*
+     * callback tables are hot on every event, keep them in internal DRAM
+     */
+    callback = (callback_t*)heap_caps_calloc( sizeof( callback_t ), 1, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT );
     if ( callback == NULL ) {
         log_e("callback_t structure calloc faild for: %s", name );
     }
     else {
         callback->entrys = 0;
+        callback->size = 0;
         callback->table = NULL;
+        callback->index.entry = NULL;
+        callback->index_valid = false;
         callback->name = name;
+        callback->next = NULL;
+        if ( callback_last ) {
+            callback_last->next = callback;
+        }
+        else {
+            callback_first = callback;
+        }
+        callback_last = callback;
         log_i("init callback_t structure success for: %s", name );
     }
+
+    if ( callback_deferred_queue == NULL ) {
+        callback_deferred_queue = xQueueCreate( CALLBACK_DEFERRED_QUEUE_LEN, sizeof( callback_deferred_t ) );
+        if ( callback_deferred_queue == NULL ) {
+            log_e("deferred callback queue alloc failed");
+        }
+    }
     return( callback );
 }
 
@@ -54,159 +86,211 @@ bool callback_register( callback_t *callback, EventBits_t event, CALLBACK_FUNC c
         return( retval );
     }
 
-    callback->entrys++;
-
-    if ( callback->table == NULL ) {
-
-#if defined( BOARD_HAS_PSRAM )
-        callback->table = ( callback_table_t * )ps_malloc( sizeof( callback_table_t ) * callback->entrys );
-#else
-        callback->table = ( callback_table_t * )malloc( sizeof( callback_table_t ) * callback->entrys );
-#endif // BOARD_HAS_PSRAM
+    if ( callback_frozen ) {
+        /*
+         * a module that registers late never gets its events, count it for the profile pages
+         */
+        log_e("callback tables are frozen, register %s for %s during setup", id, callback->name );
+        callback_rejected++;
+        callback_rejected_id = id;
+        return( retval );
+    }
 
-        if ( callback->table == NULL ) {
-            log_e("callback_table_t malloc faild for: %s", id );
-            return( retval );
-        }
-        retval = true;
+    if ( callback->entrys >= CALLBACK_MAX_ENTRYS ) {
+        log_e("callback table full for: %s", id );
+        return( retval );
     }
-    else {
-        callback_table_t *new_callback_table = NULL;
 
-#if defined( BOARD_HAS_PSRAM )
-            new_callback_table = ( callback_table_t * )ps_realloc( callback->table, sizeof( callback_table_t ) * callback->entrys );
-#else
-            new_callback_table = ( callback_table_t * )realloc( callback->table, sizeof( callback_table_t ) * callback->entrys );
-#endif // BOARD_HAS_PSRAM
+    /*
+     * grow table in chunks, registrations only happens on startup
+     */
+    if ( callback->entrys == callback->size ) {
+        callback_table_t *new_callback_table = NULL;
 
+        new_callback_table = ( callback_table_t * )heap_caps_realloc( callback->table, sizeof( callback_table_t ) * ( callback->size + CALLBACK_TABLE_CHUNK ), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT );
         if ( new_callback_table == NULL ) {
             log_e("callback_table_t realloc faild for: %s", id );
             return( retval );
         }
-
         callback->table = new_callback_table;
-        retval = true;
+        callback->size += CALLBACK_TABLE_CHUNK;
     }
 
+    callback->entrys++;
+    retval = true;
+
     callback->table[ callback->entrys - 1 ].event = event;
     callback->table[ callback->entrys - 1 ].callback_func = callback_func;
     callback->table[ callback->entrys - 1 ].id = id;
     callback->table[ callback->entrys - 1 ].counter = 0;
-    log_i("register callback_func for %s success (%p:%s)", callback->name, callback->table[ callback->entrys - 1 ].callback_func, callback->table[ callback->entrys - 1 ].id );
+    callback->table[ callback->entrys - 1 ].time = 0;
+    callback->table[ callback->entrys - 1 ].time_max = 0;
+    callback->table[ callback->entrys - 1 ].cycles = 0;
+    log_i("register callback_func for %s success (%p:%08x:%s)", callback->name, callback->table[ callback->entrys - 1 ].callback_func, event, callback->table[ callback->entrys - 1 ].id );
     return( retval );
 }
 
-void display_record_event( callback_t *callback, EventBits_t event ) {
-    time_t now;
-    struct tm info;
-
-    time( &now );
-    localtime_r( &now, &info );
+static bool callback_build_index( callback_t *callback ) {
+    uint32_t total = callback_index_size( &callback->table[ 0 ].event, sizeof( callback_table_t ), callback->entrys );
 
-    char event_log_filename[32];
-    size_t written = strftime(event_log_filename, sizeof(event_log_filename), "/event_log_%Y-%m-%d.csv", &info);
-    if(written == 0){
-        log_e("Can't convert time to filename" );
-        return;
+    callback->index.entry = (uint8_t *)heap_caps_malloc( total ? total : 1, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT );
+    if ( callback->index.entry == NULL ) {
+        log_e("callback index alloc failed for: %s", callback->name );
+        return( false );
     }
+    callback_index_fill( &callback->index, &callback->table[ 0 ].event, sizeof( callback_table_t ), callback->entrys );
+    callback->index_valid = true;
+    return( true );
+}
 
-    bool write_header = !(SPIFFS.exists(event_log_filename));
-
-    fs::File file = SPIFFS.open( event_log_filename, FILE_APPEND );
+void callback_freeze( void ) {
+    /*
+     * build all indexes once, a table without index falls back to the scan
+     */
+    for ( callback_t *callback = callback_first ; callback ; callback = callback->next ) {
+        if ( callback->entrys ) {
+            callback_build_index( callback );
+        }
+    }
+    callback_frozen = true;
+    log_i("callback tables frozen");
+}
 
-    if (!file) {
-        log_e("Can't open file: %s!", event_log_filename );
-        return;
+static inline bool callback_call_entry( callback_t *callback, callback_table_t *entry, EventBits_t event, void *arg, bool log ) {
+    if ( log ) {
+        log_d("call %s cb (%p:%04x:%s)", callback->name, entry->callback_func, event, entry->id );
+    }
+    /*
+     * profile each callback function call
+     */
+    uint32_t start_cycles = ESP.getCycleCount();
+    int64_t start = esp_timer_get_time();
+
+    bool retval = entry->callback_func( event, arg );
+
+    uint32_t cycles = ESP.getCycleCount() - start_cycles;
+    uint32_t time = esp_timer_get_time() - start;
+    /*
+     * the same table is send from powermgm, the jobqueue workers or the ble task,
+     * the 64 bit sums are not atomic on the esp32
+     */
+    portENTER_CRITICAL( &callback_stats_mux );
+    entry->cycles += cycles;
+    entry->time += time;
+    if ( time > entry->time_max ) {
+        entry->time_max = time;
     }
+    entry->counter++;
+    portEXIT_CRITICAL( &callback_stats_mux );
+    return( retval );
+}
 
-    if (write_header) {
-        file.println("Date\tTime\tFirmware\tUptime_ms\tCallback\tEvent\tFreeHeap\tBatt_V\tCharge_C\tDischarge_C\tBatt_%\tCharging_mA\tDischarging_mA\tPower_mW\tAXP_Temp_degC\tBMA_Temp_degC" );
-    }
-
-    if (! file.print( &info, "%F%t%T%t" ) ) {
-        log_e("Failed to append to event log file: %s!", event_log_filename );
-    } else {
-        AXP20X_Class *power = TTGOClass::getWatch()->power;
-        BMA *bma = TTGOClass::getWatch()->bma;
-        char log_line[256]="";
-        snprintf( log_line, sizeof( log_line ), "%s\t%lu\t%s\t%04x\t%u\t%0.2f\t%u\t%u\t%d\t%0.1f\t%0.1f\t%0.1f\t%0.1f\t%0.1f",
-            __FIRMWARE__,
-            millis(), 
-            callback->name,
-            event,
-            ESP.getFreeHeap(),
-            power->getBattVoltage() / 1000.0,
-            power->getBattChargeCoulomb(),
-            power->getBattDischargeCoulomb(),
-            power->getBattPercentage(),
-            power->getBattChargeCurrent(),
-            power->getBattDischargeCurrent(),
-            power->getBattInpower(),
-            power->getTemp(), // need to subtract 144.7 till this is resolved: https://github.com/Xinyuan-LilyGO/TTGO_TWatch_Library/issues/76
-            bma->temperature()
-        );
-        if (! file.println(log_line) ) {
-            log_e("Failed to append to event log file: %s!", event_log_filename );
+static bool callback_call( callback_t *callback, EventBits_t event, void *arg, bool log ) {
+    bool retval = true;
+    int bit = callback_index_bit( event );
+    /*
+     * single event bit, only visit the matching entrys
+     */
+    if ( callback->index_valid && bit >= 0 ) {
+        for ( int i = callback->index.start[ bit ] ; i < callback->index.start[ bit + 1 ] ; i++ ) {
+            if ( !callback_call_entry( callback, &callback->table[ callback->index.entry[ i ] ], event, arg, log ) ) {
+                retval = false;
+            }
         }
+        return( retval );
     }
-    file.close();
+    /*
+     * event with more than one bit set or send before the freeze, scan the whole table
+     */
+    for ( int entry = 0 ; entry < callback->entrys ; entry++ ) {
+        if ( event & callback->table[ entry ].event ) {
+            if ( !callback_call_entry( callback, &callback->table[ entry ], event, arg, log ) ) {
+                retval = false;
+            }
+        }
+    }
+    return( retval );
 }
 
 bool callback_send( callback_t *callback, EventBits_t event, void *arg ) {
-    bool retval = false;
-
     if ( callback == NULL ) {
         log_e("no callback structure found");
-        return( retval );
+        return( false );
     }
 
     if ( callback->entrys == 0 ) {
         log_w("no callback found");
-        return( retval );
+        return( false );
     }
 
     if( display_event_logging ) {
-        display_record_event( callback, event );
+        eventlog_record( callback->name, event );
     }
 
-    retval = true;
-
-    for ( int entry = 0 ; entry < callback->entrys ; entry++ ) {
-        yield();
-        if ( event & callback->table[ entry ].event ) {
-            log_i("call %s cb (%p:%04x:%s)", callback->name, callback->table[ entry ].callback_func, event, callback->table[ entry ].id );
-            callback->table[ entry ].counter++;
-            if ( !callback->table[ entry ].callback_func( event, arg ) ) {
-                retval = false;
-            }
-        }
-    }
-    return( retval );
+    return( callback_call( callback, event, arg, true ) );
 }
 
 bool callback_send_no_log( callback_t *callback, EventBits_t event, void *arg ) {
-    bool retval = false;
-
     if ( callback == NULL ) {
-        return( retval );
+        return( false );
     }
 
     if ( callback->entrys == 0 ) {
-        return( retval );
+        return( false );
     }
 
-    retval = true;
+    return( callback_call( callback, event, arg, false ) );
+}
 
-    for ( int entry = 0 ; entry < callback->entrys ; entry++ ) {
-        yield();
-        if ( event & callback->table[ entry ].event ) {
-            callback->table[ entry ].counter++;
-            if ( !callback->table[ entry ].callback_func( event, arg ) ) {
-                retval = false;
-            }
-        }
+bool IRAM_ATTR callback_send_from_isr( callback_t *callback, EventBits_t event, void *arg ) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    callback_deferred_t deferred;
+
+    if ( callback == NULL || callback_deferred_queue == NULL ) {
+        return( false );
     }
-    return( retval );
+
+    deferred.callback = callback;
+    deferred.event = event;
+    deferred.arg = arg;
+
+    if ( xQueueSendFromISR( callback_deferred_queue, &deferred, &xHigherPriorityTaskWoken ) != pdTRUE ) {
+        return( false );
+    }
+
+    if ( xHigherPriorityTaskWoken ) {
+        portYIELD_FROM_ISR();
+    }
+    return( true );
+}
+
+void callback_process_deferred( void ) {
+    callback_deferred_t deferred;
+
+    if ( callback_deferred_queue == NULL ) {
+        return;
+    }
+
+    while( xQueueReceive( callback_deferred_queue, &deferred, 0 ) == pdTRUE ) {
+        callback_send( deferred.callback, deferred.event, deferred.arg );
+    }
+}
+
+callback_t *callback_get_first( void ) {
+    return( callback_first );
+}
+
+uint32_t callback_get_rejected( const char **id ) {
+    if ( id ) {
+        *id = callback_rejected_id;
+    }
+    return( callback_rejected );
+}
+
+void callback_get_stats( callback_table_t *entry, callback_table_t *stats ) {
+    portENTER_CRITICAL( &callback_stats_mux );
+    *stats = *entry;
+    portEXIT_CRITICAL( &callback_stats_mux );
 }
 
 void display_event_logging_enable( bool enable ) {
@@ -22,6 +22,11 @@
     #define _CALLBACK_H
 
     #include "config.h"
+    #include "callback_index.h"
+
+    #define CALLBACK_TABLE_CHUNK            8
+    #define CALLBACK_MAX_ENTRYS             255     // limited by the uint8_t event index
+    #define CALLBACK_DEFERRED_QUEUE_LEN     16
 
     typedef bool ( * CALLBACK_FUNC ) ( EventBits_t event, void *arg );
 
@@ -30,12 +35,19 @@
         CALLBACK_FUNC callback_func;
         const char *id;
         uint64_t counter;
+        uint64_t time;                  // us spend in the callback function, sum
+        uint32_t time_max;              // us
+        uint64_t cycles;                // cpu cycles spend in the callback function, sum
     } callback_table_t;
 
-    typedef struct {
+    typedef struct callback_t {
         uint32_t entrys;
+        uint32_t size;
         callback_table_t *table;
+        callback_index_t index;
+        bool index_valid;               // set by callback_freeze()
         const char *name;
+        struct callback_t *next;        // next callback structure, see callback_get_first()
     } callback_t;
 
     /**
@@ -47,7 +59,8 @@
      */
     callback_t *callback_init( const char *name );
     /**
-     * @brief   register an callback function
+     * @brief   register an callback function, only possible before callback_freeze().
+     *          a later registration is rejected and counted, see callback_get_rejected()
      * 
      * @param   callback        pointer to a callback_t structure
      * @param   event           event filter mask
@@ -57,6 +70,11 @@
      * @return  true if success, false if failed
      */
     bool callback_register( callback_t *callback, EventBits_t event, CALLBACK_FUNC callback_func, const char *id );
+    /**
+     * @brief   build the event index of all callback tables and reject further registrations,
+     *          call once at the end of setup. the index is never rebuild while events are send
+     */
+    void callback_freeze( void );
     /**
      * @brief   call all callback function thats match with the event filter mask
      * 
@@ -78,7 +96,45 @@
      */
     bool callback_send_no_log( callback_t *callback, EventBits_t event, void *arg );
     /**
-     * @brief enable/disable SPIFFS event logging
+     * @brief   queue an event from interrupt context, the callback functions are called later
+     *          from task context with callback_process_deferred()
+     * 
+     * @param   callback        pointer to a callback_t structure
+     * @param   event           event filter mask
+     * @param   arg             argument for the called callback function, must be valid until the event is processed
+     * 
+     * @return  true if success, false if the deferred queue is full
+     */
+    bool callback_send_from_isr( callback_t *callback, EventBits_t event, void *arg );
+    /**
+     * @brief   call all callback functions for events queued with callback_send_from_isr(), call from powermgm loop
+     */
+    void callback_process_deferred( void );
+    /**
+     * @brief   get the first callback structure, all callback structures are linked by the next pointer.
+     *          used to read the per callback function counter and time statistics
+     * 
+     * @return  pointer to the first callback_t structure or NULL if none exists
+     */
+    callback_t *callback_get_first( void );
+    /**
+     * @brief   get the number of registrations rejected after callback_freeze()
+     * 
+     * @param   id          pointer to a string pointer that receives the id of the last rejected callback function or NULL
+     * 
+     * @return  number of rejected registrations
+     */
+    uint32_t callback_get_rejected( const char **id );
+    /**
+     * @brief   get a consistent copy of the counter and time statistics of a callback table entry
+     * 
+     * @param   entry       pointer to a callback_table_t entry, see callback_get_first()
+     * @param   stats       pointer to a callback_table_t structure that receives the copy
+     */
+    void callback_get_stats( callback_table_t *entry, callback_table_t *stats );
+    /**
+     * @brief enable/disable event logging into the binary event log, called from
+     * eventlog_set_enable(), see eventlog.h
      * 
      * @param enable    true if logging enabled, false if logging disabled
      */
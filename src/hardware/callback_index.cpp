@@ -0,0 +1,53 @@
+/****************************************************************************
+ *   Nov 04 09:12:40 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * the index uses no arduino or freertos api, so it builds on the host
+ * for tools/callback_bench.cpp
+ */
+#include "callback_index.h"
+
+static inline uint32_t callback_index_event( const uint32_t *event, size_t stride, uint32_t entry ) {
+    return( *(const uint32_t *)( (const uint8_t *)event + entry * stride ) );
+}
+
+uint32_t callback_index_size( const uint32_t *event, size_t stride, uint32_t entrys ) {
+    uint32_t total = 0;
+
+    for ( uint32_t entry = 0 ; entry < entrys ; entry++ ) {
+        total += __builtin_popcount( callback_index_event( event, stride, entry ) & ( ( 1UL << CALLBACK_EVENT_BITS ) - 1 ) );
+    }
+    return( total );
+}
+
+void callback_index_fill( callback_index_t *index, const uint32_t *event, size_t stride, uint32_t entrys ) {
+    uint16_t pos = 0;
+
+    for ( int bit = 0 ; bit < CALLBACK_EVENT_BITS ; bit++ ) {
+        index->start[ bit ] = pos;
+        for ( uint32_t entry = 0 ; entry < entrys ; entry++ ) {
+            if ( callback_index_event( event, stride, entry ) & ( 1UL << bit ) ) {
+                index->entry[ pos++ ] = entry;
+            }
+        }
+    }
+    index->start[ CALLBACK_EVENT_BITS ] = pos;
+}
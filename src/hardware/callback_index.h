@@ -0,0 +1,68 @@
+/****************************************************************************
+ *   Nov 04 09:12:40 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _CALLBACK_INDEX_H
+    #define _CALLBACK_INDEX_H
+
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #define CALLBACK_EVENT_BITS             24      // the upper 8 bits of EventBits_t are reserved by freertos
+
+    typedef struct {
+        uint8_t *entry;                 // table entrys sorted by event bit
+        uint16_t start[ CALLBACK_EVENT_BITS + 1 ];
+    } callback_index_t;
+
+    /**
+     * @brief   count the index entrys needed for a callback table
+     *
+     * @param   event       pointer to the event mask of the first table entry
+     * @param   stride      size of a table entry in bytes
+     * @param   entrys      number of table entrys
+     *
+     * @return  number of bytes needed for callback_index_t.entry
+     */
+    uint32_t callback_index_size( const uint32_t *event, size_t stride, uint32_t entrys );
+    /**
+     * @brief   fill the index, each event bit gets a continuous run of table entrys in table order
+     *
+     * @param   index       pointer to a callback_index_t with callback_index_size() bytes of entry
+     * @param   event       pointer to the event mask of the first table entry
+     * @param   stride      size of a table entry in bytes
+     * @param   entrys      number of table entrys, max 255
+     */
+    void callback_index_fill( callback_index_t *index, const uint32_t *event, size_t stride, uint32_t entrys );
+    /**
+     * @brief   get the event bit to look up in the index
+     *
+     * @param   event       event mask
+     *
+     * @return  the bit number if exactly one bit below CALLBACK_EVENT_BITS is set, else -1
+     */
+    static inline int callback_index_bit( uint32_t event ) {
+        if ( event && !( event & ( event - 1 ) ) && event < ( 1UL << CALLBACK_EVENT_BITS ) ) {
+            return( __builtin_ctz( event ) );
+        }
+        return( -1 );
+    }
+
+#endif // _CALLBACK_INDEX_H
@@ -0,0 +1,396 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <SPIFFS.h>
+#include <rom/crc.h>
+
+#include "config_store.h"
+#include "powermgm.h"
+
+static SemaphoreHandle_t config_store_mutex = NULL;
+static config_store_entry_t config_store_entry[ CONFIG_STORE_MAX_ENTRYS ];
+static int config_store_entrys = 0;
+static bool config_store_dirty = false;
+static uint32_t config_store_last_change = 0;
+
+static uint8_t *config_store_data = NULL;          // content of the store file behind the header
+static config_store_header_t config_store_header;
+
+static bool config_store_read_file( const char *filename );
+static config_store_record_t *config_store_find_record( const char *key );
+static config_store_entry_t *config_store_find_entry( const char *key );
+static void config_store_retry( void );
+static bool config_store_powermgm_event_cb( EventBits_t event, void *arg );
+static bool config_store_powermgm_loop_cb( EventBits_t event, void *arg );
+
+void config_store_setup( void ) {
+    config_store_mutex = xSemaphoreCreateMutex();
+    if ( config_store_mutex == NULL ) {
+        log_e("config store mutex alloc failed");
+        while(true);
+    }
+    /*
+     * a complete tmp file is left when the last commit was interrupted between remove and rename
+     */
+    if ( !config_store_read_file( CONFIG_STORE_FILE ) ) {
+        if ( config_store_read_file( CONFIG_STORE_TMP_FILE ) ) {
+            log_i("config store recovered from %s", CONFIG_STORE_TMP_FILE );
+        }
+    }
+
+    powermgm_register_cb( POWERMGM_STANDBY, config_store_powermgm_event_cb, "config store" );
+    powermgm_register_loop_cb( POWERMGM_STANDBY | POWERMGM_SILENCE_WAKEUP | POWERMGM_WAKEUP, config_store_powermgm_loop_cb, "config store loop" );
+}
+
+bool config_store_register( const char *key, void *data, uint16_t size, CONFIG_STORE_MIGRATE_FUNC migrate_func ) {
+    return( config_store_register_version( key, data, size, 0, NULL, migrate_func ) );
+}
+
+bool config_store_register_version( const char *key, void *data, uint16_t size, uint16_t version, CONFIG_STORE_UPGRADE_FUNC upgrade_func, CONFIG_STORE_MIGRATE_FUNC migrate_func ) {
+    bool retval = false;
+
+    if ( config_store_mutex == NULL ) {
+        log_e("config store not initialized");
+        return( false );
+    }
+
+    xSemaphoreTake( config_store_mutex, portMAX_DELAY );
+
+    config_store_entry_t *entry = config_store_find_entry( key );
+    if ( entry && entry->data == data ) {
+        xSemaphoreGive( config_store_mutex );
+        return( true );
+    }
+    else if ( entry == NULL ) {
+        if ( config_store_entrys >= CONFIG_STORE_MAX_ENTRYS || strlen( key ) >= CONFIG_STORE_KEY_LEN ) {
+            log_e("can't register config key %s", key );
+            xSemaphoreGive( config_store_mutex );
+            return( false );
+        }
+        entry = &config_store_entry[ config_store_entrys++ ];
+    }
+    entry->key = key;
+    entry->data = data;
+    entry->size = size;
+    entry->version = version;
+    entry->dirty = false;
+
+    config_store_record_t *record = config_store_find_record( key );
+    bool stored = record != NULL;
+    if ( record && record->version == version && record->size == size ) {
+        memcpy( data, (uint8_t*)record + sizeof( config_store_record_t ), size );
+        retval = true;
+    }
+    else if ( record && upgrade_func && upgrade_func( record->version, (uint8_t*)record + sizeof( config_store_record_t ), record->size ) ) {
+        log_i("config %s upgraded from version %d to %d", key, record->version, version );
+        entry->dirty = true;
+        retval = true;
+    }
+    else if ( record ) {
+        log_e("config %s: can't read version %d with %d bytes, use defaults", key, record->version, record->size );
+        entry->dirty = true;
+    }
+    else {
+        entry->dirty = true;
+    }
+    entry->crc = entry->dirty ? 0 : crc32_le( 0, (const uint8_t*)data, size );
+
+    xSemaphoreGive( config_store_mutex );
+
+    /*
+     * read the old config outside the lock, the migrate function calls config_store_save()
+     */
+    if ( !stored && migrate_func ) {
+        log_i("migrate config %s into config store", key );
+        migrate_func();
+    }
+
+    if ( entry->dirty ) {
+        config_store_save( data );
+    }
+    return( retval );
+}
+
+void config_store_save( void *data ) {
+    if ( config_store_mutex == NULL ) {
+        return;
+    }
+
+    xSemaphoreTake( config_store_mutex, portMAX_DELAY );
+    for ( int i = 0 ; i < config_store_entrys ; i++ ) {
+        if ( config_store_entry[ i ].data == data ) {
+            config_store_entry[ i ].dirty = true;
+            config_store_dirty = true;
+            config_store_last_change = millis();
+        }
+    }
+    xSemaphoreGive( config_store_mutex );
+}
+
+bool config_store_commit( void ) {
+    bool retval = false;
+    uint32_t size = 0;
+    uint16_t entrys = 0;
+    uint64_t start = millis();
+
+    if ( config_store_mutex == NULL ) {
+        return( false );
+    }
+
+    xSemaphoreTake( config_store_mutex, portMAX_DELAY );
+
+    if ( !config_store_dirty ) {
+        xSemaphoreGive( config_store_mutex );
+        return( true );
+    }
+    /*
+     * coalesce changes, only write when the content of one config has really changed
+     */
+    bool changed = false;
+    for ( int i = 0 ; i < config_store_entrys ; i++ ) {
+        if ( config_store_entry[ i ].dirty && config_store_entry[ i ].crc != crc32_le( 0, (const uint8_t*)config_store_entry[ i ].data, config_store_entry[ i ].size ) ) {
+            changed = true;
+        }
+        config_store_entry[ i ].dirty = false;
+    }
+    config_store_dirty = false;
+
+    if ( !changed ) {
+        log_d("config store unchanged");
+        xSemaphoreGive( config_store_mutex );
+        return( true );
+    }
+    /*
+     * registered configs first, then keep all records from the old store that are not registered
+     */
+    for ( int i = 0 ; i < config_store_entrys ; i++ ) {
+        size += sizeof( config_store_record_t ) + config_store_entry[ i ].size;
+        entrys++;
+    }
+    uint8_t *record = config_store_data;
+    for ( int i = 0 ; config_store_data && i < config_store_header.entrys ; i++ ) {
+        config_store_record_t *old = (config_store_record_t *)record;
+        if ( !config_store_find_entry( old->key ) ) {
+            size += sizeof( config_store_record_t ) + old->size;
+            entrys++;
+        }
+        record += sizeof( config_store_record_t ) + old->size;
+    }
+
+    uint8_t *data = (uint8_t*)ps_malloc( size );
+    if ( data == NULL ) {
+        log_e("config store alloc failed");
+        config_store_retry();
+        xSemaphoreGive( config_store_mutex );
+        return( false );
+    }
+
+    uint8_t *pos = data;
+    for ( int i = 0 ; i < config_store_entrys ; i++ ) {
+        config_store_record_t *new_record = (config_store_record_t *)pos;
+        memset( new_record, 0, sizeof( config_store_record_t ) );
+        strlcpy( new_record->key, config_store_entry[ i ].key, sizeof( new_record->key ) );
+        new_record->size = config_store_entry[ i ].size;
+        new_record->version = config_store_entry[ i ].version;
+        pos += sizeof( config_store_record_t );
+        memcpy( pos, config_store_entry[ i ].data, config_store_entry[ i ].size );
+        pos += config_store_entry[ i ].size;
+    }
+    record = config_store_data;
+    for ( int i = 0 ; config_store_data && i < config_store_header.entrys ; i++ ) {
+        config_store_record_t *old = (config_store_record_t *)record;
+        if ( !config_store_find_entry( old->key ) ) {
+            memcpy( pos, old, sizeof( config_store_record_t ) + old->size );
+            pos += sizeof( config_store_record_t ) + old->size;
+        }
+        record += sizeof( config_store_record_t ) + old->size;
+    }
+
+    config_store_header_t header;
+    header.magic = CONFIG_STORE_MAGIC;
+    header.version = CONFIG_STORE_VERSION;
+    header.entrys = entrys;
+    header.size = size;
+    header.crc = crc32_le( 0, data, size );
+    /*
+     * write into a tmp file and replace the store when the write is complete,
+     * so a brownout never leaves a half written store
+     */
+    fs::File file = SPIFFS.open( CONFIG_STORE_TMP_FILE, FILE_WRITE );
+    if ( !file ) {
+        log_e("Can't open file: %s!", CONFIG_STORE_TMP_FILE );
+    }
+    else {
+        size_t written = file.write( (uint8_t*)&header, sizeof( header ) );
+        written += file.write( data, size );
+        file.close();
+
+        if ( written != sizeof( header ) + size ) {
+            log_e("Failed to write config store");
+            SPIFFS.remove( CONFIG_STORE_TMP_FILE );
+        }
+        else {
+            /*
+             * a failed rename leaves the complete tmp file, config_store_setup() reads it
+             */
+            SPIFFS.remove( CONFIG_STORE_FILE );
+            if ( !SPIFFS.rename( CONFIG_STORE_TMP_FILE, CONFIG_STORE_FILE ) ) {
+                log_e("Failed to rename %s", CONFIG_STORE_TMP_FILE );
+            }
+            else {
+                retval = true;
+            }
+        }
+    }
+
+    if ( retval ) {
+        for ( int i = 0 ; i < config_store_entrys ; i++ ) {
+            config_store_entry[ i ].crc = crc32_le( 0, (const uint8_t*)config_store_entry[ i ].data, config_store_entry[ i ].size );
+        }
+        free( config_store_data );
+        config_store_data = data;
+        config_store_header = header;
+        log_i("config store written, %d entrys, %d bytes, %dms", entrys, size, (uint32_t)( millis() - start ) );
+    }
+    else {
+        free( data );
+        config_store_retry();
+    }
+
+    xSemaphoreGive( config_store_mutex );
+    return( retval );
+}
+
+/*
+ * mark all configs as changed after a failed commit, so the next commit writes them again
+ */
+static void config_store_retry( void ) {
+    for ( int i = 0 ; i < config_store_entrys ; i++ ) {
+        config_store_entry[ i ].dirty = true;
+    }
+    config_store_dirty = true;
+    config_store_last_change = millis();
+}
+
+static bool config_store_read_file( const char *filename ) {
+    if ( !SPIFFS.exists( filename ) ) {
+        return( false );
+    }
+
+    fs::File file = SPIFFS.open( filename, FILE_READ );
+    if ( !file ) {
+        log_e("Can't open file: %s!", filename );
+        return( false );
+    }
+
+    config_store_header_t header;
+    if ( file.read( (uint8_t*)&header, sizeof( header ) ) != sizeof( header ) || header.magic != CONFIG_STORE_MAGIC || header.size != file.size() - sizeof( header ) ) {
+        log_e("config store %s: bad header", filename );
+        file.close();
+        return( false );
+    }
+    if ( header.version != CONFIG_STORE_VERSION ) {
+        log_e("config store %s: unsupported version %d", filename, header.version );
+        file.close();
+        return( false );
+    }
+
+    uint8_t *data = (uint8_t*)ps_malloc( header.size );
+    if ( data == NULL ) {
+        log_e("config store alloc failed");
+        file.close();
+        return( false );
+    }
+    size_t len = file.read( data, header.size );
+    file.close();
+
+    if ( len != header.size || crc32_le( 0, data, header.size ) != header.crc ) {
+        log_e("config store %s: crc error", filename );
+        free( data );
+        return( false );
+    }
+    /*
+     * check all record sizes once, so the records can be walked without further checks
+     */
+    uint32_t pos = 0;
+    for ( int i = 0 ; i < header.entrys ; i++ ) {
+        if ( pos + sizeof( config_store_record_t ) > header.size ) {
+            break;
+        }
+        config_store_record_t *record = (config_store_record_t *)( data + pos );
+        record->key[ CONFIG_STORE_KEY_LEN - 1 ] = '\0';
+        pos += sizeof( config_store_record_t ) + record->size;
+    }
+    if ( pos != header.size ) {
+        log_e("config store %s: bad record", filename );
+        free( data );
+        return( false );
+    }
+
+    free( config_store_data );
+    config_store_data = data;
+    config_store_header = header;
+    log_i("config store read, %d entrys, %d bytes", header.entrys, header.size );
+    return( true );
+}
+
+static config_store_record_t *config_store_find_record( const char *key ) {
+    uint8_t *record = config_store_data;
+
+    for ( int i = 0 ; config_store_data && i < config_store_header.entrys ; i++ ) {
+        if ( !strcmp( ( (config_store_record_t *)record )->key, key ) ) {
+            return( (config_store_record_t *)record );
+        }
+        record += sizeof( config_store_record_t ) + ( (config_store_record_t *)record )->size;
+    }
+    return( NULL );
+}
+
+static config_store_entry_t *config_store_find_entry( const char *key ) {
+    for ( int i = 0 ; i < config_store_entrys ; i++ ) {
+        if ( !strcmp( config_store_entry[ i ].key, key ) ) {
+            return( &config_store_entry[ i ] );
+        }
+    }
+    return( NULL );
+}
+
+static bool config_store_powermgm_event_cb( EventBits_t event, void *arg ) {
+    switch( event ) {
+        case POWERMGM_STANDBY:          config_store_commit();
+                                        break;
+    }
+    return( true );
+}
+
+static bool config_store_powermgm_loop_cb( EventBits_t event, void *arg ) {
+    if ( config_store_dirty ) {
+        uint32_t elapsed = millis() - config_store_last_change;
+        if ( elapsed >= CONFIG_STORE_COMMIT_DELAY ) {
+            config_store_commit();
+        }
+        else {
+            powermgm_set_next_deadline( CONFIG_STORE_COMMIT_DELAY - elapsed );
+        }
+    }
+    return( true );
+}
@@ -0,0 +1,118 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _CONFIG_STORE_H
+    #define _CONFIG_STORE_H
+
+    #include "config.h"
+
+    #define CONFIG_STORE_FILE           "/config.bin"
+    #define CONFIG_STORE_TMP_FILE       "/config.tmp"
+    #define CONFIG_STORE_MAGIC          0x53474643      // "CFGS"
+    #define CONFIG_STORE_VERSION        1
+    #define CONFIG_STORE_KEY_LEN        16
+    #define CONFIG_STORE_MAX_ENTRYS     24
+    #define CONFIG_STORE_COMMIT_DELAY   5000            // ms after the last change before the store is written
+
+    typedef void ( * CONFIG_STORE_MIGRATE_FUNC ) ( void );
+    /**
+     * fill the registered config structure from a stored record of an older version,
+     * return false if the stored version or size is unknown. called with the store
+     * locked, don't call config_store_save() from it
+     */
+    typedef bool ( * CONFIG_STORE_UPGRADE_FUNC ) ( uint16_t version, const void *data, uint16_t size );
+
+    /**
+     * on flash layout, the header is followed by one record and the config data
+     * for each key. the crc covers everything behind the header
+     */
+    typedef struct {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t entrys;
+        uint32_t size;
+        uint32_t crc;
+    } __attribute__((packed)) config_store_header_t;
+
+    typedef struct {
+        char key[ CONFIG_STORE_KEY_LEN ];
+        uint16_t size;
+        uint16_t version;               // layout version of the config structure
+    } __attribute__((packed)) config_store_record_t;
+
+    typedef struct {
+        const char *key;
+        void *data;
+        uint16_t size;
+        uint16_t version;
+        uint32_t crc;                   // crc of the last committed data
+        bool dirty;
+    } config_store_entry_t;
+
+    /**
+     * @brief   read the config store from spiffs, call once after SPIFFS.begin()
+     */
+    void config_store_setup( void );
+    /**
+     * @brief   register a config structure with layout version 0, see config_store_register_version()
+     * 
+     * @param   key             unique key for the config, max CONFIG_STORE_KEY_LEN - 1 chars
+     * @param   data            pointer to the config structure, must stay valid
+     * @param   size            size of the config structure
+     * @param   migrate_func    pointer to a function to read the old config or NULL
+     * 
+     * @return  true if the config was read from the store, false if not
+     */
+    bool config_store_register( const char *key, void *data, uint16_t size, CONFIG_STORE_MIGRATE_FUNC migrate_func );
+    /**
+     * @brief   register a config structure and fill it from the store.
+     *          when the key is not in the store the migrate function is called to
+     *          read the old json config and the result is stored with the next commit.
+     *          a stored record is only copied when version and size match, every
+     *          change of the structure layout needs a new version and an upgrade
+     *          function that knows the old layouts. a record that can't be upgraded
+     *          is replaced by the default values
+     * 
+     * @param   key             unique key for the config, max CONFIG_STORE_KEY_LEN - 1 chars
+     * @param   data            pointer to the config structure, must stay valid
+     * @param   size            size of the config structure
+     * @param   version         layout version of the config structure
+     * @param   upgrade_func    pointer to a function to read older versions or NULL
+     * @param   migrate_func    pointer to a function to read the old config or NULL
+     * 
+     * @return  true if the config was read from the store, false if not
+     */
+    bool config_store_register_version( const char *key, void *data, uint16_t size, uint16_t version, CONFIG_STORE_UPGRADE_FUNC upgrade_func, CONFIG_STORE_MIGRATE_FUNC migrate_func );
+    /**
+     * @brief   mark a registered config structure as changed, the store is written
+     *          CONFIG_STORE_COMMIT_DELAY ms after the last change or on standby
+     * 
+     * @param   data            pointer to the registered config structure
+     */
+    void config_store_save( void *data );
+    /**
+     * @brief   write all changed config structures now, call before a reboot
+     * 
+     * @return  true if success or nothing to write, false if failed
+     */
+    bool config_store_commit( void );
+
+#endif // _CONFIG_STORE_H
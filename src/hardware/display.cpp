@@ -29,6 +29,7 @@
 #include "gui/gui.h"
 
 #include "json_psram_allocator.h"
+#include "config_store.h"
 
 display_config_t display_config;
 callback_t *display_callback = NULL;
@@ -85,13 +86,23 @@ void display_loop( void ) {
     }
   }
   if ( display_get_timeout() != DISPLAY_MAX_TIMEOUT ) {
-    if ( lv_disp_get_inactive_time(NULL) > ( ( display_get_timeout() * 1000 ) - display_get_brightness() * 8 ) ) {
-        dest_brightness = ( ( display_get_timeout() * 1000 ) - lv_disp_get_inactive_time( NULL ) ) / 8 ;
+    // signed, the inactive time runs past the timeout until standby
+    int32_t timeout = display_get_timeout() * 1000;
+    int32_t inactive = lv_disp_get_inactive_time( NULL );
+    int32_t fade_start = timeout - (int32_t)display_get_brightness() * 8;
+    if ( inactive > fade_start ) {
+        dest_brightness = inactive < timeout ? ( timeout - inactive ) / 8 : 0;
     }
     else {
         dest_brightness = display_get_brightness();
+        // next loop pass when the fade out starts
+        powermgm_set_next_deadline( fade_start - inactive );
     }
   }
+  // fade in/out one step per loop pass
+  if ( dest_brightness != brightness ) {
+    powermgm_set_next_deadline( DISPLAY_FADE_INTERVAL );
+  }
 }
 
 bool display_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id ) {
@@ -143,34 +154,13 @@ void display_wakeup( bool silence ) {
 }
 
 void display_save_config( void ) {
-    if ( SPIFFS.exists( DISPLAY_CONFIG_FILE ) ) {
-        SPIFFS.remove( DISPLAY_CONFIG_FILE );
-        log_i("remove old binary display config");
-    }
-
-    fs::File file = SPIFFS.open( DISPLAY_JSON_CONFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", DISPLAY_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["brightness"] = display_config.brightness;
-        doc["rotation"] = display_config.rotation;
-        doc["timeout"] = display_config.timeout;
-        doc["block_return_maintile"] = display_config.block_return_maintile;
-        doc["background_image"] = display_config.background_image;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &display_config );
 }
 
-void display_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void display_read_json_config( void ) {
     if ( SPIFFS.exists( DISPLAY_JSON_CONFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( DISPLAY_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -218,6 +208,10 @@ void display_read_config( void ) {
     }
 }
 
+void display_read_config( void ) {
+    config_store_register( "display", &display_config, sizeof( display_config ), display_read_json_config );
+}
+
 uint32_t display_get_timeout( void ) {
     return( display_config.timeout );
 }
@@ -33,6 +33,8 @@
     #define DISPLAY_MIN_BRIGHTNESS      8
     #define DISPLAY_MAX_BRIGHTNESS      255
 
+    #define DISPLAY_FADE_INTERVAL       2           // ms per brightness step while fading
+
     #define DISPLAY_MIN_ROTATE          0
     #define DISPLAY_MAX_ROTATE          270
 
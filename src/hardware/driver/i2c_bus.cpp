@@ -33,6 +33,8 @@ void I2C_Bus::scan(void)
 uint16_t I2C_Bus::readBytes(uint8_t addr, uint8_t *data, uint16_t len, uint16_t delay_ms)
 {
     uint16_t ret = 0;
+    // don't sleep while holding the bus, the read below only copies the wire buffer
+    if (delay_ms)delay(delay_ms);
     xSemaphoreTakeRecursive(_i2c_mux, portMAX_DELAY);
     uint8_t cnt = _port->requestFrom(addr, (uint8_t)len, (uint8_t)1);
     if (!cnt) {
@@ -40,9 +42,12 @@ uint16_t I2C_Bus::readBytes(uint8_t addr, uint8_t *data, uint16_t len, uint16_t
     }
     uint16_t index = 0;
     while (_port->available()) {
-        if (index > len)return 1 << 14;
-        if (delay_ms)delay(delay_ms);
-        data[index++] = _port->read();
+        uint8_t value = _port->read();
+        if (index >= len) {
+            ret = 1 << 14;
+            continue;
+        }
+        data[index++] = value;
     }
     xSemaphoreGiveRecursive(_i2c_mux);
     return ret;
@@ -62,8 +67,12 @@ uint16_t I2C_Bus::readBytes(uint8_t addr, uint8_t reg, uint8_t *data, uint16_t l
     }
     uint16_t index = 0;
     while (_port->available()) {
-        if (index > len)return 1 << 14;
-        data[index++] = _port->read();
+        uint8_t value = _port->read();
+        if (index >= len) {
+            ret = 1 << 14;
+            continue;
+        }
+        data[index++] = value;
     }
     xSemaphoreGiveRecursive(_i2c_mux);
     return ret;
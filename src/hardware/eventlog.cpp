@@ -0,0 +1,245 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <SPIFFS.h>
+
+#include "eventlog.h"
+#include "callback.h"
+#include "config_store.h"
+#include "powermgm.h"
+#include "pmu.h"
+
+static eventlog_record_t *eventlog_ring = NULL;
+static volatile uint32_t eventlog_head = 0;
+static volatile uint32_t eventlog_tail = 0;
+static eventlog_stats_t eventlog_stats;
+static eventlog_config_t eventlog_config = { false };
+portMUX_TYPE DRAM_ATTR eventlogMux = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t eventlog_file_mux = NULL;
+TaskHandle_t _eventlog_flush_Task;
+
+bool eventlog_powermgm_event_cb( EventBits_t event, void *arg );
+void eventlog_flush_Task( void * pvParameters );
+
+bool eventlog_setup( void ) {
+    config_store_register( "eventlog", &eventlog_config, sizeof( eventlog_config ), NULL );
+
+    eventlog_file_mux = xSemaphoreCreateMutex();
+    if ( eventlog_file_mux == NULL ) {
+        log_e("eventlog mutex alloc failed");
+        return( false );
+    }
+    /*
+     * register at setup, the callback tables are frozen when the log is enabled later
+     */
+    powermgm_register_cb( POWERMGM_STANDBY, eventlog_powermgm_event_cb, "eventlog" );
+
+    if ( eventlog_config.enable ) {
+        eventlog_set_enable( true );
+    }
+    return( true );
+}
+
+static bool eventlog_start( void ) {
+    if ( eventlog_ring ) {
+        return( true );
+    }
+
+    eventlog_ring = (eventlog_record_t *)ps_calloc( EVENTLOG_RING_RECORDS, sizeof( eventlog_record_t ) );
+    if ( eventlog_ring == NULL || eventlog_file_mux == NULL ) {
+        log_e("eventlog ring alloc failed");
+        free( eventlog_ring );
+        eventlog_ring = NULL;
+        return( false );
+    }
+
+    xTaskCreate(    eventlog_flush_Task,            /* Function to implement the task */
+                    "eventlog flush Task",          /* Name of the task */
+                    3000,                           /* Stack size in words */
+                    NULL,                           /* Task input parameter */
+                    1,                              /* Priority of the task */
+                    &_eventlog_flush_Task );        /* Task handle. */
+    return( true );
+}
+
+void eventlog_set_enable( bool enable ) {
+    if ( enable && !eventlog_start() ) {
+        enable = false;
+    }
+    display_event_logging_enable( enable );
+    if ( !enable ) {
+        eventlog_flush();
+    }
+    if ( eventlog_config.enable != enable ) {
+        eventlog_config.enable = enable;
+        config_store_save( &eventlog_config );
+    }
+    log_i("event log %s", enable ? "enabled" : "disabled" );
+}
+
+bool eventlog_get_enable( void ) {
+    return( eventlog_config.enable );
+}
+
+bool eventlog_powermgm_event_cb( EventBits_t event, void *arg ) {
+    switch( event ) {
+        case POWERMGM_STANDBY:
+            eventlog_flush();
+            break;
+    }
+    return( true );
+}
+
+void eventlog_record( const char *name, EventBits_t event ) {
+    eventlog_record_t record;
+    pmu_snapshot_t snapshot;
+    time_t now;
+
+    if ( eventlog_ring == NULL ) {
+        return;
+    }
+
+    pmu_get_snapshot( &snapshot );
+
+    time( &now );
+    record.time = now;
+    record.uptime = millis();
+    strncpy( record.callback, name, sizeof( record.callback ) );
+    record.event = event;
+    record.free_heap = ESP.getFreeHeap();
+    record.batt_voltage = snapshot.batt_voltage;
+    record.charge_current = snapshot.charge_current;
+    record.discharge_current = snapshot.discharge_current;
+    record.batt_percent = snapshot.batt_percentage;
+    record.flags = ( snapshot.charging ? EVENTLOG_FLAG_CHARGING : 0 ) | ( snapshot.vbus_plug ? EVENTLOG_FLAG_VBUS : 0 );
+    record.coulomb = snapshot.coulomb_counted * 100;
+
+    portENTER_CRITICAL( &eventlogMux );
+    bool stored = eventlog_head - eventlog_tail < EVENTLOG_RING_RECORDS;
+    if ( stored ) {
+        eventlog_ring[ eventlog_head % EVENTLOG_RING_RECORDS ] = record;
+        eventlog_head++;
+        eventlog_stats.recorded++;
+    }
+    else {
+        eventlog_stats.dropped++;
+    }
+    uint32_t pending = eventlog_head - eventlog_tail;
+    portEXIT_CRITICAL( &eventlogMux );
+
+    if ( stored && pending >= EVENTLOG_FLUSH_RECORDS ) {
+        xTaskNotifyGive( _eventlog_flush_Task );
+    }
+}
+
+static bool eventlog_rotate( void ) {
+    if ( SPIFFS.exists( EVENTLOG_FILE ) ) {
+        eventlog_header_t header;
+        fs::File file = SPIFFS.open( EVENTLOG_FILE, FILE_READ );
+        size_t size = file.size();
+        bool current = file.read( (uint8_t *)&header, sizeof( header ) ) == sizeof( header ) && header.version == EVENTLOG_VERSION && header.record_size == sizeof( eventlog_record_t );
+        file.close();
+
+        /*
+         * a log from an older firmware is rotated, records of different size are not mixed in one file
+         */
+        if ( current && size + EVENTLOG_FLUSH_RECORDS * sizeof( eventlog_record_t ) <= EVENTLOG_MAX_FILE_SIZE ) {
+            return( true );
+        }
+        SPIFFS.remove( EVENTLOG_OLD_FILE );
+        SPIFFS.rename( EVENTLOG_FILE, EVENTLOG_OLD_FILE );
+        eventlog_stats.rotations++;
+    }
+
+    eventlog_header_t header;
+    memset( &header, 0, sizeof( header ) );
+    header.magic = EVENTLOG_MAGIC;
+    header.version = EVENTLOG_VERSION;
+    header.record_size = sizeof( eventlog_record_t );
+    strncpy( header.firmware, __FIRMWARE__, sizeof( header.firmware ) - 1 );
+
+    fs::File file = SPIFFS.open( EVENTLOG_FILE, FILE_WRITE );
+    if ( !file ) {
+        log_e("Can't open file: %s!", EVENTLOG_FILE );
+        return( false );
+    }
+    bool retval = file.write( (uint8_t *)&header, sizeof( header ) ) == sizeof( header );
+    file.close();
+    return( retval );
+}
+
+void eventlog_flush( void ) {
+    if ( eventlog_ring == NULL ) {
+        return;
+    }
+
+    xSemaphoreTake( eventlog_file_mux, portMAX_DELAY );
+
+    portENTER_CRITICAL( &eventlogMux );
+    uint32_t pending = eventlog_head - eventlog_tail;
+    portEXIT_CRITICAL( &eventlogMux );
+
+    if ( pending && eventlog_rotate() ) {
+        fs::File file = SPIFFS.open( EVENTLOG_FILE, FILE_APPEND );
+        if ( !file ) {
+            log_e("Can't open file: %s!", EVENTLOG_FILE );
+        }
+        else {
+            /*
+             * only the flush writes the tail, so the records between tail and
+             * head can be written without holding the lock
+             */
+            while( pending ) {
+                uint32_t pos = eventlog_tail % EVENTLOG_RING_RECORDS;
+                uint32_t count = EVENTLOG_RING_RECORDS - pos;
+                if ( count > pending ) {
+                    count = pending;
+                }
+                if ( file.write( (uint8_t *)&eventlog_ring[ pos ], count * sizeof( eventlog_record_t ) ) != count * sizeof( eventlog_record_t ) ) {
+                    log_e("Failed to append to event log file: %s!", EVENTLOG_FILE );
+                    break;
+                }
+                portENTER_CRITICAL( &eventlogMux );
+                eventlog_tail += count;
+                eventlog_stats.flushed += count;
+                pending = eventlog_head - eventlog_tail;
+                portEXIT_CRITICAL( &eventlogMux );
+            }
+            file.close();
+        }
+    }
+
+    xSemaphoreGive( eventlog_file_mux );
+}
+
+eventlog_stats_t *eventlog_get_stats( void ) {
+    return( &eventlog_stats );
+}
+
+void eventlog_flush_Task( void * pvParameters ) {
+    log_i("start eventlog flush task, heap: %d", ESP.getFreeHeap() );
+
+    while( true ) {
+        ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        eventlog_flush();
+    }
+}
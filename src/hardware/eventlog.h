@@ -0,0 +1,112 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _EVENTLOG_H
+    #define _EVENTLOG_H
+
+    #include "TTGO.h"
+
+    #define EVENTLOG_FILE               "/eventlog.bin"
+    #define EVENTLOG_OLD_FILE           "/eventlog.old"
+    #define EVENTLOG_MAGIC              0x474c5645      // "EVLG" little endian
+    #define EVENTLOG_VERSION            2
+    #define EVENTLOG_RING_RECORDS       256             // records hold in RAM
+    #define EVENTLOG_FLUSH_RECORDS      112             // flush batch, 4k = one flash sector
+    #define EVENTLOG_MAX_FILE_SIZE      65536           // rotate to EVENTLOG_OLD_FILE above this size
+
+    #define EVENTLOG_FLAG_CHARGING      _BV(0)
+    #define EVENTLOG_FLAG_VBUS          _BV(1)
+
+    /*
+     * on flash format, all values little endian, see tools/eventlog2csv.py
+     */
+    typedef struct __attribute__((packed)) {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t record_size;
+        char firmware[24];
+    } eventlog_header_t;
+
+    typedef struct __attribute__((packed)) {
+        uint32_t time;                  // unix time
+        uint32_t uptime;                // ms since boot
+        char callback[8];               // callback name, not null terminated if 8 chars long
+        uint32_t event;
+        uint32_t free_heap;
+        uint16_t batt_voltage;          // mV
+        uint16_t charge_current;        // mA
+        uint16_t discharge_current;     // mA
+        uint8_t batt_percent;
+        uint8_t flags;
+        int32_t coulomb;                // 0.01mAh counted since boot, charge positive, since version 2
+    } eventlog_record_t;
+
+    typedef struct {
+        bool enable;                    // record the callback events, off by default
+    } eventlog_config_t;
+
+    typedef struct {
+        uint32_t recorded;
+        uint32_t flushed;
+        uint32_t dropped;
+        uint32_t rotations;
+    } eventlog_stats_t;
+
+    /**
+     * @brief read the event log config and register the standby flush, starts
+     * recording when enabled. call during setup before callback_freeze()
+     * 
+     * @return  true if success, false if failed
+     */
+    bool eventlog_setup( void );
+    /**
+     * @brief enable/disable the event log, the ring buffer and the flush task
+     * are allocated on the first enable. the setting is stored in the config store
+     * 
+     * @param   enable  true to record the callback events, false to stop and flush
+     */
+    void eventlog_set_enable( bool enable );
+    /**
+     * @brief get the event log enable setting
+     * 
+     * @return  true if the callback events are recorded
+     */
+    bool eventlog_get_enable( void );
+    /**
+     * @brief store an event record in the ring buffer, the ring is written to
+     * SPIFFS in EVENTLOG_FLUSH_RECORDS batches by the flush task
+     * 
+     * @param   name    callback name
+     * @param   event   event bits
+     */
+    void eventlog_record( const char *name, EventBits_t event );
+    /**
+     * @brief write all pending records to SPIFFS
+     */
+    void eventlog_flush( void );
+    /**
+     * @brief get the event log statistics
+     * 
+     * @return  pointer to a eventlog_stats_t structure
+     */
+    eventlog_stats_t *eventlog_get_stats( void );
+
+#endif // _EVENTLOG_H
@@ -21,36 +21,73 @@
  */
 #include "config.h"
 #include <TTGO.h>
-#include <esp_ipc.h>
+#include <esp_timer.h>
 
 #include "framebuffer.h"
 #include "powermgm.h"
 
-lv_color_t *framebuffer;
+typedef struct {
+    lv_disp_drv_t *disp_drv;
+    lv_area_t area;
+    lv_color_t *color_p;
+} framebuffer_flush_t;
 
-static lv_disp_buf_t disp_buf;
+lv_color_t *framebuffer1 = NULL;
+lv_color_t *framebuffer2 = NULL;
 
-lv_disp_drv_t *framebuffer_disp_drv = NULL;
-const lv_area_t *framebuffer_area = NULL;
-lv_color_t *framebuffer_color_p = NULL;
+static lv_disp_buf_t disp_buf;
 
 volatile bool DRAM_ATTR framebuffer_flag = false;
 portMUX_TYPE DRAM_ATTR FRAMEBUFFER_Mux = portMUX_INITIALIZER_UNLOCKED;
 
+QueueHandle_t framebuffer_flush_queue = NULL;
+TaskHandle_t _framebuffer_flush_Task = NULL;
+
 static int32_t frame = 0;
 static int32_t framerate = 0;
+static uint64_t flush_time = 0;
+static uint64_t flush_time_max = 0;
+static uint32_t flush_count = 0;
+static uint32_t flush_latency = 0;
+static uint32_t flush_latency_max = 0;
+static volatile FRAMEBUFFER_FLUSH_HOOK_FUNC flush_hook = NULL;
+static uint32_t flush_stack_free = 0;
 
 bool framebuffer_powermgm_event_cb( EventBits_t event, void *arg );
-void framebuffer_ipc_call( void * arg );
+void framebuffer_flush_Task( void * pvParameters );
 static void framebuffer_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
 
 void framebuffer_setup( void ) {
-    framebuffer = (lv_color_t*)ps_malloc( lv_disp_get_hor_res( NULL ) * lv_disp_get_ver_res( NULL ) * sizeof( lv_color_t ) );
-    if ( framebuffer == NULL ) {
-        log_e("framebuffer 1 malloc failed");
+    /*
+     * two strip buffers in internal dma capable ram, lvgl render into one while the other is on the bus
+     */
+    framebuffer1 = (lv_color_t*)heap_caps_malloc( lv_disp_get_hor_res( NULL ) * FRAMEBUFFER_LINES * sizeof( lv_color_t ), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL );
+    framebuffer2 = (lv_color_t*)heap_caps_malloc( lv_disp_get_hor_res( NULL ) * FRAMEBUFFER_LINES * sizeof( lv_color_t ), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL );
+    if ( framebuffer1 == NULL || framebuffer2 == NULL ) {
+        log_e("framebuffer malloc failed");
+        if ( framebuffer1 ) {
+            free( framebuffer1 );
+        }
+        if ( framebuffer2 ) {
+            free( framebuffer2 );
+        }
         return;
     }
-    lv_disp_buf_init( &disp_buf, framebuffer, NULL, lv_disp_get_hor_res( NULL ) * lv_disp_get_ver_res( NULL ) );
+    lv_disp_buf_init( &disp_buf, framebuffer1, framebuffer2, lv_disp_get_hor_res( NULL ) * FRAMEBUFFER_LINES );
+
+    framebuffer_flush_queue = xQueueCreate( 2, sizeof( framebuffer_flush_t ) );
+    if ( framebuffer_flush_queue == NULL ) {
+        log_e("framebuffer flush queue alloc failed");
+        return;
+    }
+
+    xTaskCreatePinnedToCore(    framebuffer_flush_Task,         /* Function to implement the task */
+                                "framebuffer flush Task",       /* Name of the task */
+                                4096,                           /* Stack size in words */
+                                NULL,                           /* Task input parameter */
+                                2,                              /* Priority of the task */
+                                &_framebuffer_flush_Task,       /* Task handle. */
+                                0 );                            /* Core where the task should run */
 
     powermgm_register_cb( POWERMGM_STANDBY | POWERMGM_WAKEUP | POWERMGM_SILENCE_WAKEUP, framebuffer_powermgm_event_cb, "framebuffer" );
 
@@ -61,7 +98,7 @@ void framebuffer_setup( void ) {
     system_disp->driver.ver_res = lv_disp_get_ver_res( NULL );
     system_disp->driver.buffer = &disp_buf;
 
-    log_i("framebuffer enable");
+    log_i("framebuffer enable, 2 x %d lines", FRAMEBUFFER_LINES );
 }
 
 bool framebuffer_powermgm_event_cb( EventBits_t event, void *arg ) {
@@ -80,36 +117,104 @@ bool framebuffer_powermgm_event_cb( EventBits_t event, void *arg ) {
 }
 
 static void framebuffer_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
-    static uint64_t nextmillis = 0;
+    framebuffer_flush_t flush;
 
-    if ( framebuffer_flag )
+    /*
+     * drop the strip in standby, lvgl still needs to know that the buffer is free
+     */
+    if ( framebuffer_flag ) {
+        lv_disp_flush_ready( disp_drv );
         return;
-
-    portENTER_CRITICAL(&FRAMEBUFFER_Mux);
-    framebuffer_disp_drv = disp_drv;
-    framebuffer_area = area;
-    framebuffer_color_p = color_p;
-    framebuffer_flag = true;
-
-    if ( nextmillis < millis() ) {
-        nextmillis = millis() + 1000;
-        framerate = frame;
-        frame = 0;
     }
-    portEXIT_CRITICAL(&FRAMEBUFFER_Mux);
 
-    esp_ipc_call( 0, framebuffer_ipc_call, NULL );
+    flush.disp_drv = disp_drv;
+    flush.area = *area;
+    flush.color_p = color_p;
+
+    if ( xQueueSend( framebuffer_flush_queue, &flush, portMAX_DELAY ) != pdTRUE ) {
+        log_e("framebuffer flush queue failed");
+        lv_disp_flush_ready( disp_drv );
+    }
 }
 
-void framebuffer_ipc_call( void * arg ) {
+void framebuffer_flush_Task( void * pvParameters ) {
+    static uint64_t nextmillis = 0;
     TTGOClass *ttgo = TTGOClass::getWatch();
+    framebuffer_flush_t flush;
+
+    log_i("start framebuffer flush task on core: %d", xPortGetCoreID() );
+
+    while( true ) {
+        if ( xQueueReceive( framebuffer_flush_queue, &flush, portMAX_DELAY ) != pdTRUE ) {
+            continue;
+        }
+
+        int64_t start = esp_timer_get_time();
+        uint32_t w = flush.area.x2 - flush.area.x1 + 1;
+        uint32_t h = flush.area.y2 - flush.area.y1 + 1;
+        ttgo->tft->setAddrWindow( flush.area.x1, flush.area.y1, w, h ); /* set the working window */
+        ttgo->tft->pushColors( ( uint16_t *)flush.color_p, w * h, false );
+        uint32_t latency = esp_timer_get_time() - start;
+
+        bool last = lv_disp_flush_is_last( flush.disp_drv );
+        FRAMEBUFFER_FLUSH_HOOK_FUNC hook = flush_hook;
+        if ( hook ) {
+            hook( &flush.area, flush.color_p, last );
+            /*
+             * the mirror encodes the strip on this stack, watch the lowest free stack
+             */
+            uint32_t stack_free = uxTaskGetStackHighWaterMark( NULL );
+            if ( stack_free != flush_stack_free ) {
+                flush_stack_free = stack_free;
+                log_d("framebuffer flush task stack free: %d", stack_free );
+            }
+        }
+        lv_disp_flush_ready( flush.disp_drv );
+
+        portENTER_CRITICAL(&FRAMEBUFFER_Mux);
+        flush_time += latency;
+        flush_count++;
+        if ( latency > flush_time_max ) {
+            flush_time_max = latency;
+        }
+        if ( last ) {
+            frame++;
+        }
+        if ( nextmillis < millis() ) {
+            nextmillis = millis() + 1000;
+            framerate = frame;
+            frame = 0;
+            flush_latency = flush_count ? flush_time / flush_count : 0;
+            flush_latency_max = flush_time_max;
+            flush_time = 0;
+            flush_time_max = 0;
+            flush_count = 0;
+        }
+        portEXIT_CRITICAL(&FRAMEBUFFER_Mux);
+    }
+}
 
-    uint32_t size = (framebuffer_area->x2 - framebuffer_area->x1 + 1) * (framebuffer_area->y2 - framebuffer_area->y1 + 1) ;
-    ttgo->tft->setAddrWindow(framebuffer_area->x1, framebuffer_area->y1, (framebuffer_area->x2 - framebuffer_area->x1 + 1), (framebuffer_area->y2 - framebuffer_area->y1 + 1)); /* set the working window */
-    ttgo->tft->pushColors(( uint16_t *)framebuffer_color_p, size, false);
+int32_t framebuffer_get_framerate( void ) {
     portENTER_CRITICAL(&FRAMEBUFFER_Mux);
-    frame++;
-    framebuffer_flag = false;
+    int32_t temp = framerate;
     portEXIT_CRITICAL(&FRAMEBUFFER_Mux);
-    lv_disp_flush_ready(framebuffer_disp_drv);
-}
\ No newline at end of file
+    return( temp );
+}
+
+uint32_t framebuffer_get_flush_latency( void ) {
+    portENTER_CRITICAL(&FRAMEBUFFER_Mux);
+    uint32_t temp = flush_latency;
+    portEXIT_CRITICAL(&FRAMEBUFFER_Mux);
+    return( temp );
+}
+
+uint32_t framebuffer_get_flush_latency_max( void ) {
+    portENTER_CRITICAL(&FRAMEBUFFER_Mux);
+    uint32_t temp = flush_latency_max;
+    portEXIT_CRITICAL(&FRAMEBUFFER_Mux);
+    return( temp );
+}
+
+void framebuffer_set_flush_hook( FRAMEBUFFER_FLUSH_HOOK_FUNC func ) {
+    flush_hook = func;
+}
@@ -22,6 +22,47 @@
 #ifndef _FRAMEBUFFER_H
     #define _FRAMEBUFFER_H
 
+    #define FRAMEBUFFER_LINES       40
+
+    #include <lvgl/lvgl.h>
+
+    /**
+     * @brief   called from the flush task for each strip after it is send to the display
+     * 
+     * @param   area        area of the strip
+     * @param   color_p     pixel of the strip, only valid during the call
+     * @param   last        true if this is the last strip of a frame
+     */
+    typedef void ( * FRAMEBUFFER_FLUSH_HOOK_FUNC ) ( const lv_area_t *area, const lv_color_t *color_p, bool last );
+
+    /**
+     * @brief setup the framebuffer, two strip buffers in internal dma capable ram
+     * and a flush task on core 0 so lvgl can render the next strip while the last one is transfered
+     */
     void framebuffer_setup( void );
+    /**
+     * @brief get the number of full frames send to the display in the last second
+     * 
+     * @return  frames per second
+     */
+    int32_t framebuffer_get_framerate( void );
+    /**
+     * @brief get the average time to transfer one strip to the display, measured over the last second
+     * 
+     * @return  flush latency in us
+     */
+    uint32_t framebuffer_get_flush_latency( void );
+    /**
+     * @brief get the max time to transfer one strip to the display, measured over the last second
+     * 
+     * @return  max flush latency in us
+     */
+    uint32_t framebuffer_get_flush_latency_max( void );
+    /**
+     * @brief set a function that gets a copy of every strip, NULL to remove it
+     * 
+     * @param   func    pointer to the hook function or NULL
+     */
+    void framebuffer_set_flush_hook( FRAMEBUFFER_FLUSH_HOOK_FUNC func );
     
 #endif // _FRAMEBUFFER_H
\ No newline at end of file
@@ -0,0 +1,200 @@
+/****************************************************************************
+ *   Nov 08 11:02:47 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * the gauge uses no arduino or freertos api, so it builds on the host
+ * for tools/fuelgauge_replay.cpp
+ */
+#include <math.h>
+#include "fuelgauge.h"
+
+/*
+ * open circuit voltage of a lipo cell from 100% down to 0% in 10% steps
+ */
+static const float fuelgauge_ocv[ 11 ] = { 4200, 4110, 4020, 3950, 3880, 3840, 3800, 3770, 3730, 3680, 3300 };
+/*
+ * rough start values for the discharge rate in mA and the time share of wakeup, silence wakeup and standby
+ */
+static const float fuelgauge_rate[ FUELGAUGE_STATE_NUM ] = { 80, 40, 4 };
+static const float fuelgauge_share[ FUELGAUGE_STATE_NUM ] = { 0.1f, 0.05f, 0.85f };
+
+static float fuelgauge_clamp( float value, float min, float max ) {
+    return( value < min ? min : value > max ? max : value );
+}
+
+float fuelgauge_voltage_soc( float voltage ) {
+    if ( voltage >= fuelgauge_ocv[ 0 ] )
+        return( 1.0f );
+    for ( int i = 1 ; i < 11 ; i++ ) {
+        if ( voltage >= fuelgauge_ocv[ i ] ) {
+            float fraction = ( voltage - fuelgauge_ocv[ i ] ) / ( fuelgauge_ocv[ i - 1 ] - fuelgauge_ocv[ i ] );
+            return( ( 10 - i + fraction ) / 10.0f );
+        }
+    }
+    return( 0.0f );
+}
+
+/*
+ * the voltage without the drop over the internal resistance
+ */
+static float fuelgauge_sample_ocv( const fuelgauge_sample_t *sample ) {
+    return( sample->voltage + ( sample->discharge_current - sample->charge_current ) * FUELGAUGE_RESISTANCE );
+}
+
+void fuelgauge_init( fuelgauge_t *gauge, float designed, float capacity ) {
+    gauge->magic = FUELGAUGE_MAGIC;
+    gauge->time = 0;
+    gauge->soc = 0;
+    gauge->ocv = 0;
+    gauge->designed = designed;
+    gauge->capacity = capacity > 0 ? fuelgauge_clamp( capacity, designed * 0.5f, designed * 1.5f ) : designed;
+    for ( int i = 0 ; i < FUELGAUGE_STATE_NUM ; i++ ) {
+        gauge->rate[ i ] = fuelgauge_rate[ i ];
+        gauge->share[ i ] = fuelgauge_share[ i ];
+    }
+    gauge->charge_current = 0;
+    gauge->discharge_current = 0;
+    gauge->discharged = -1;
+    gauge->cycles = 0;
+    gauge->percent = -1;
+    gauge->state = FUELGAUGE_WAKEUP;
+    gauge->vbus = false;
+    gauge->started = false;
+}
+
+static void fuelgauge_next( fuelgauge_t *gauge, const fuelgauge_sample_t *sample ) {
+    gauge->time = sample->time;
+    gauge->charge_current = sample->charge_current;
+    gauge->discharge_current = sample->discharge_current;
+    gauge->state = sample->state < 0 || sample->state >= FUELGAUGE_STATE_NUM ? FUELGAUGE_WAKEUP : sample->state;
+    gauge->vbus = sample->vbus;
+}
+
+static void fuelgauge_publish( fuelgauge_t *gauge, const fuelgauge_sample_t *sample ) {
+    int32_t percent = (int32_t)( gauge->soc * 100 + 0.5f );
+    /*
+     * on battery the percent only goes down, an upward correction shows up when the charge falls below it
+     */
+    if ( sample->vbus || gauge->percent < 0 || percent < gauge->percent )
+        gauge->percent = percent;
+}
+
+void fuelgauge_update( fuelgauge_t *gauge, const fuelgauge_sample_t *sample ) {
+    float ocv = fuelgauge_sample_ocv( sample );
+
+    /*
+     * first sample or a long gap without counting, the voltage is all we know. the
+     * coulomb counter keeps counting in any gap, its delta is always taken
+     */
+    if ( !gauge->started || sample->time < gauge->time || ( isnan( sample->coulomb ) && sample->time - gauge->time > FUELGAUGE_MAX_GAP ) ) {
+        if ( !gauge->started || ( !sample->vbus && sample->discharge_current < FUELGAUGE_REST_CURRENT ) )
+            gauge->soc = fuelgauge_voltage_soc( ocv );
+        gauge->ocv = ocv;
+        gauge->discharged = -1;
+        gauge->started = true;
+        fuelgauge_next( gauge, sample );
+        fuelgauge_publish( gauge, sample );
+        return;
+    }
+
+    float dt = sample->time - gauge->time;
+    if ( dt <= 0 ) {
+        fuelgauge_next( gauge, sample );
+        return;
+    }
+
+    /*
+     * count the charge, take the coulomb counter if there is one, otherwise the mean current over the interval
+     */
+    float delta = sample->coulomb;
+    if ( isnan( delta ) ) {
+        float current = ( gauge->charge_current + sample->charge_current - gauge->discharge_current - sample->discharge_current ) / 2;
+        delta = current * dt / 3600.0f;
+    }
+    if ( delta > 0 )
+        delta *= FUELGAUGE_CHARGE_EFFICIENCY;
+    gauge->soc = fuelgauge_clamp( gauge->soc + delta / gauge->capacity, 0.0f, sample->charging ? 0.99f : 1.0f );
+
+    if ( sample->charging )
+        gauge->discharged = -1;
+    else if ( gauge->discharged >= 0 && delta < 0 )
+        gauge->discharged -= delta;
+
+    /*
+     * learn the discharge rate of the last power state and how long the watch stays in it, not on vbus
+     */
+    if ( !gauge->vbus && !sample->vbus ) {
+        float weight = fuelgauge_clamp( dt / FUELGAUGE_RATE_TAU, 0.0f, 1.0f );
+        float current = delta < 0 ? -delta * 3600.0f / dt : 0;
+        gauge->rate[ gauge->state ] += weight * ( current - gauge->rate[ gauge->state ] );
+
+        weight = fuelgauge_clamp( dt / FUELGAUGE_SHARE_TAU, 0.0f, 1.0f );
+        for ( int i = 0 ; i < FUELGAUGE_STATE_NUM ; i++ )
+            gauge->share[ i ] += weight * ( ( i == gauge->state ? 1.0f : 0.0f ) - gauge->share[ i ] );
+    }
+
+    /*
+     * pull the charge to the voltage in the lower part of the curve, strong at rest and weak under load
+     */
+    gauge->ocv += fuelgauge_clamp( dt / FUELGAUGE_OCV_TAU, 0.0f, 1.0f ) * ( ocv - gauge->ocv );
+    float voltage_soc = fuelgauge_voltage_soc( gauge->ocv );
+    if ( !sample->vbus && voltage_soc < FUELGAUGE_VOLTAGE_SOC ) {
+        float weight = fuelgauge_clamp( dt / FUELGAUGE_VOLTAGE_TAU, 0.0f, 1.0f );
+        if ( sample->discharge_current >= FUELGAUGE_REST_CURRENT )
+            weight *= FUELGAUGE_LOAD_WEIGHT;
+        gauge->soc += weight * ( voltage_soc - gauge->soc );
+        /*
+         * the charge taken out since full against the charge the voltage says is gone gives the real capacity
+         */
+        if ( gauge->discharged > 0 && voltage_soc < FUELGAUGE_LEARN_SOC ) {
+            float capacity = fuelgauge_clamp( gauge->discharged / ( 1.0f - voltage_soc ), gauge->designed * 0.5f, gauge->designed * 1.5f );
+            gauge->capacity += FUELGAUGE_LEARN_WEIGHT * ( capacity - gauge->capacity );
+            gauge->discharged = -1;
+            gauge->cycles++;
+        }
+    }
+
+    /*
+     * charging done at a high voltage means a full battery
+     */
+    if ( sample->vbus && !sample->charging && sample->voltage >= FUELGAUGE_FULL_VOLTAGE ) {
+        gauge->soc = 1.0f;
+        gauge->discharged = 0;
+    }
+
+    fuelgauge_next( gauge, sample );
+    fuelgauge_publish( gauge, sample );
+}
+
+float fuelgauge_get_rate( const fuelgauge_t *gauge ) {
+    float rate = 0;
+    for ( int i = 0 ; i < FUELGAUGE_STATE_NUM ; i++ )
+        rate += gauge->share[ i ] * gauge->rate[ i ];
+    return( rate );
+}
+
+int32_t fuelgauge_get_runtime( const fuelgauge_t *gauge ) {
+    float rate = fuelgauge_get_rate( gauge );
+
+    if ( !gauge->started || gauge->vbus || rate <= 0 )
+        return( -1 );
+    return( (int32_t)( gauge->soc * gauge->capacity / rate * 60.0f ) );
+}
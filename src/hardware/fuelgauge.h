@@ -0,0 +1,125 @@
+/****************************************************************************
+ *   Nov 08 11:02:47 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _FUELGAUGE_H
+    #define _FUELGAUGE_H
+
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #define FUELGAUGE_MAGIC             0x47465542      // "BUFG" little endian, marks a valid gauge state after reset
+    #define FUELGAUGE_REST_CURRENT      30              // mA, below this the voltage is close to the open circuit voltage
+    #define FUELGAUGE_RESISTANCE        0.25f           // ohm, cell and pcb, corrects the voltage under load
+    #define FUELGAUGE_VOLTAGE_SOC       0.5f            // the voltage corrects the charge only below this, above it is too flat
+    #define FUELGAUGE_VOLTAGE_TAU       1800.0f         // s at rest until the charge follows the voltage
+    #define FUELGAUGE_LOAD_WEIGHT       0.2f            // weight of the voltage correction under load
+    #define FUELGAUGE_OCV_TAU           300.0f          // s, filters the load corrected voltage
+    #define FUELGAUGE_FULL_VOLTAGE      4100            // mV, charging done above this is a full battery
+    #define FUELGAUGE_CHARGE_EFFICIENCY 0.95f
+    #define FUELGAUGE_LEARN_SOC         0.3f            // voltage charge below this after a full charge learns the capacity
+    #define FUELGAUGE_LEARN_WEIGHT      0.3f            // weight of a new capacity estimate
+    #define FUELGAUGE_RATE_TAU          3600.0f         // s in a power state until its rate follows a new current
+    #define FUELGAUGE_SHARE_TAU         86400.0f        // s until the time share of the power states follows a new usage
+    #define FUELGAUGE_MAX_GAP           ( 6 * 3600 )    // s, longer gaps without coulomb are not integrated
+
+    enum {
+        FUELGAUGE_WAKEUP = 0,
+        FUELGAUGE_SILENCE_WAKEUP,
+        FUELGAUGE_STANDBY,
+        FUELGAUGE_STATE_NUM
+    };
+
+    /**
+     * one measurement, the charge moved since the last sample comes from the
+     * coulomb counter, without it the currents are integrated
+     */
+    typedef struct {
+        uint32_t time;                  // s, monotonic
+        float voltage;                  // mV
+        float charge_current;           // mA
+        float discharge_current;        // mA
+        float coulomb;                  // mAh since the last sample, charge positive, NAN if unknown
+        bool charging;
+        bool vbus;
+        int state;                      // power state from this sample on, FUELGAUGE_WAKEUP, FUELGAUGE_SILENCE_WAKEUP or FUELGAUGE_STANDBY
+    } fuelgauge_sample_t;
+
+    typedef struct {
+        uint32_t magic;
+        uint32_t time;                  // s of the last sample
+        float soc;                      // state of charge 0..1
+        float ocv;                      // filtered open circuit voltage in mV
+        float capacity;                 // learned capacity in mAh
+        float designed;                 // designed capacity in mAh
+        float rate[ FUELGAUGE_STATE_NUM ];      // mA per power state
+        float share[ FUELGAUGE_STATE_NUM ];     // time share of the power states
+        float charge_current;           // mA of the last sample
+        float discharge_current;        // mA of the last sample
+        float discharged;               // mAh since the last full charge, < 0 without one
+        uint32_t cycles;                // learned capacities
+        int32_t percent;                // published percent, does not rise while discharging
+        int state;                      // power state since the last sample
+        bool vbus;                      // vbus of the last sample
+        bool started;                   // the first sample was seen
+    } fuelgauge_t;
+
+    /**
+     * @brief reset the gauge, the charge is taken from the voltage of the first sample
+     * 
+     * @param   gauge       pointer to the gauge
+     * @param   designed    designed capacity in mAh
+     * @param   capacity    learned capacity in mAh, 0 if unknown
+     */
+    void fuelgauge_init( fuelgauge_t *gauge, float designed, float capacity );
+    /**
+     * @brief add a sample, count the charge, correct it with the voltage at rest, learn the
+     * capacity after a full charge and the discharge rate of the last power state
+     * 
+     * @param   gauge       pointer to the gauge
+     * @param   sample      pointer to the sample
+     */
+    void fuelgauge_update( fuelgauge_t *gauge, const fuelgauge_sample_t *sample );
+    /**
+     * @brief get the mean discharge current with the learned time share of the power states
+     * 
+     * @param   gauge       pointer to the gauge
+     * 
+     * @return  current in mA
+     */
+    float fuelgauge_get_rate( const fuelgauge_t *gauge );
+    /**
+     * @brief get the remaining runtime with the learned discharge rates
+     * 
+     * @param   gauge       pointer to the gauge
+     * 
+     * @return  runtime in minutes, -1 while charging or unknown
+     */
+    int32_t fuelgauge_get_runtime( const fuelgauge_t *gauge );
+    /**
+     * @brief get the state of charge of an open circuit voltage
+     * 
+     * @param   voltage     mV
+     * 
+     * @return  state of charge 0..1
+     */
+    float fuelgauge_voltage_soc( float voltage );
+
+#endif // _FUELGAUGE_H
@@ -0,0 +1,74 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+
+#include "gadgetbridge.h"
+
+static char *gadgetbridge_buffer = NULL;
+static gadgetbridge_frame_t gadgetbridge_framer;
+static StaticJsonDocument<256> gadgetbridge_filter[ GADGETBRIDGE_MSG_NUM ];
+
+bool gadgetbridge_setup( GADGETBRIDGE_FRAME_FUNC frame_func ) {
+    if ( gadgetbridge_buffer == NULL ) {
+        gadgetbridge_buffer = (char *)ps_calloc( GADGETBRIDGE_MAX_FRAME_SIZE, 1 );
+        if ( gadgetbridge_buffer == NULL ) {
+            log_e("gadgetbridge frame buffer alloc failed");
+            return( false );
+        }
+    }
+
+    for ( int i = 0 ; i < GADGETBRIDGE_MSG_NUM ; i++ ) {
+        gadgetbridge_filter[ i ].clear();
+        for ( int field = 0 ; gadgetbridge_msg[ i ].fields[ field ] != NULL ; field++ ) {
+            gadgetbridge_filter[ i ][ gadgetbridge_msg[ i ].fields[ field ] ] = true;
+        }
+    }
+
+    gadgetbridge_frame_init( &gadgetbridge_framer, gadgetbridge_buffer, GADGETBRIDGE_MAX_FRAME_SIZE, frame_func );
+    return( true );
+}
+
+void gadgetbridge_reset( void ) {
+    gadgetbridge_frame_reset( &gadgetbridge_framer );
+}
+
+void gadgetbridge_feed( const uint8_t *data, size_t len ) {
+    if ( gadgetbridge_buffer == NULL ) {
+        return;
+    }
+
+    uint32_t overflows = gadgetbridge_framer.stats.overflows;
+    gadgetbridge_frame_feed( &gadgetbridge_framer, data, len );
+    if ( gadgetbridge_framer.stats.overflows != overflows ) {
+        log_e("frame to big, dropped");
+    }
+}
+
+JsonDocument *gadgetbridge_get_filter( const char *frame ) {
+    int msg = gadgetbridge_frame_msg( frame );
+
+    return( msg >= 0 ? &gadgetbridge_filter[ msg ] : NULL );
+}
+
+const gadgetbridge_stats_t *gadgetbridge_get_stats( void ) {
+    return( &gadgetbridge_framer.stats );
+}
@@ -0,0 +1,66 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _GADGETBRIDGE_H
+    #define _GADGETBRIDGE_H
+
+    #include "TTGO.h"
+    #include "ArduinoJson.h"
+    #include "gadgetbridge_frame.h"
+
+    #define GADGETBRIDGE_MAX_FRAME_SIZE     8192
+
+    /**
+     * @brief setup the gadgetbridge protocol parser, allocate the frame buffer once
+     * 
+     * @param   frame_func  function to call for each complete frame
+     * 
+     * @return  true if success, false if failed
+     */
+    bool gadgetbridge_setup( GADGETBRIDGE_FRAME_FUNC frame_func );
+    /**
+     * @brief feed received bytes into the parser
+     * 
+     * @param   data    pointer to the received bytes
+     * @param   len     number of bytes
+     */
+    void gadgetbridge_feed( const uint8_t *data, size_t len );
+    /**
+     * @brief discard the current frame
+     */
+    void gadgetbridge_reset( void );
+    /**
+     * @brief get the ArduinoJson filter for the message type of a frame, call before the frame is
+     * decoded in place
+     * 
+     * @param   frame   pointer to a complete frame
+     * 
+     * @return  pointer to the filter document for a known message type, NULL to decode all fields
+     */
+    JsonDocument *gadgetbridge_get_filter( const char *frame );
+    /**
+     * @brief get the parser statistics
+     * 
+     * @return  pointer to a gadgetbridge_stats_t structure
+     */
+    const gadgetbridge_stats_t *gadgetbridge_get_stats( void );
+
+#endif // _GADGETBRIDGE_H
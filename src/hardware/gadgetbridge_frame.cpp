@@ -0,0 +1,247 @@
+/****************************************************************************
+ *   Nov 04 18:40:12 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * the framer uses no arduino or freertos api, so it builds on the host
+ * for tools/gadgetbridge_replay.cpp
+ */
+#include <string.h>
+
+#include "gadgetbridge_frame.h"
+
+static const char *gadgetbridge_notify_fields[] = { "t", "src", "title", "body", "sender", "tel", NULL };
+static const char *gadgetbridge_call_fields[] = { "t", "cmd", "name", "number", NULL };
+static const char *gadgetbridge_musicinfo_fields[] = { "t", "artist", "album", "track", "dur", "c", "n", NULL };
+static const char *gadgetbridge_musicstate_fields[] = { "t", "state", "position", "shuffle", "repeat", NULL };
+static const char *gadgetbridge_conf_fields[] = { "t", "app", "settings", "ssid", "key", "apikey", "lat", "lon", NULL };
+
+const gadgetbridge_msg_t gadgetbridge_msg[ GADGETBRIDGE_MSG_NUM ] = {
+    { "notify", gadgetbridge_notify_fields },
+    { "call", gadgetbridge_call_fields },
+    { "musicinfo", gadgetbridge_musicinfo_fields },
+    { "musicstate", gadgetbridge_musicstate_fields },
+    { "conf", gadgetbridge_conf_fields }
+};
+
+static void gadgetbridge_frame_complete( gadgetbridge_frame_t *framer );
+static const char *gadgetbridge_frame_skip_space( const char *json );
+static const char *gadgetbridge_frame_skip_string( const char *json );
+static const char *gadgetbridge_frame_skip_value( const char *json );
+
+void gadgetbridge_frame_init( gadgetbridge_frame_t *framer, char *buffer, size_t size, GADGETBRIDGE_FRAME_FUNC frame_func ) {
+    framer->buffer = buffer;
+    framer->size = size;
+    framer->frame_func = frame_func;
+    memset( &framer->stats, 0, sizeof( framer->stats ) );
+    gadgetbridge_frame_reset( framer );
+}
+
+void gadgetbridge_frame_reset( gadgetbridge_frame_t *framer ) {
+    framer->len = 0;
+    framer->state = GADGETBRIDGE_STATE_IDLE;
+}
+
+void gadgetbridge_frame_feed( gadgetbridge_frame_t *framer, const uint8_t *data, size_t len ) {
+    framer->stats.bytes += len;
+
+    for ( size_t i = 0 ; i < len ; i++ ) {
+        switch( data[ i ] ) {
+            case EndofText:         gadgetbridge_frame_reset( framer );
+                                    framer->stats.resets++;
+                                    break;
+            case StartofText:
+            case DataLinkEscape:    gadgetbridge_frame_reset( framer );
+                                    framer->state = GADGETBRIDGE_STATE_FRAME;
+                                    break;
+            case LineFeed:          if ( framer->state != GADGETBRIDGE_STATE_OVERFLOW ) {
+                                        gadgetbridge_frame_complete( framer );
+                                    }
+                                    gadgetbridge_frame_reset( framer );
+                                    break;
+            default:                if ( framer->state == GADGETBRIDGE_STATE_OVERFLOW ) {
+                                        break;
+                                    }
+                                    /*
+                                     * keep one byte free for the '\0'
+                                     */
+                                    if ( framer->len + 1 >= framer->size ) {
+                                        framer->state = GADGETBRIDGE_STATE_OVERFLOW;
+                                        framer->stats.overflows++;
+                                        break;
+                                    }
+                                    framer->buffer[ framer->len++ ] = data[ i ];
+                                    framer->state = GADGETBRIDGE_STATE_FRAME;
+        }
+    }
+}
+
+static void gadgetbridge_frame_complete( gadgetbridge_frame_t *framer ) {
+    char *frame = framer->buffer;
+    size_t len = framer->len;
+
+    if ( len == 0 ) {
+        return;
+    }
+
+    frame[ len ] = '\0';
+    /*
+     * cut down "GB({...})" to the json part
+     */
+    if ( len >= 3 && frame[ 0 ] == 'G' && frame[ 1 ] == 'B' && frame[ 2 ] == '(' ) {
+        frame += 3;
+        len -= 3;
+        if ( len > 0 && frame[ len - 1 ] == ')' ) {
+            len--;
+            frame[ len ] = '\0';
+        }
+    }
+
+    framer->stats.frames++;
+    if ( framer->frame_func ) {
+        framer->frame_func( frame, len );
+    }
+    /*
+     * the next frame starts at the same place, a pointer kept beyond the frame function
+     * sees an empty string instead of a mix of two frames
+     */
+    frame[ 0 ] = '\0';
+}
+
+const char *gadgetbridge_frame_type( const char *frame, size_t *len ) {
+    const char *json = gadgetbridge_frame_skip_space( frame );
+
+    if ( *json++ != '{' ) {
+        return( NULL );
+    }
+    /*
+     * walk the keys of the top level object, nested values are skipped as a whole
+     */
+    while ( true ) {
+        json = gadgetbridge_frame_skip_space( json );
+        if ( *json != '"' ) {
+            return( NULL );
+        }
+        const char *key = json + 1;
+        json = gadgetbridge_frame_skip_string( json );
+        if ( json == NULL ) {
+            return( NULL );
+        }
+        size_t key_len = json - key - 1;
+
+        json = gadgetbridge_frame_skip_space( json );
+        if ( *json++ != ':' ) {
+            return( NULL );
+        }
+        json = gadgetbridge_frame_skip_space( json );
+
+        if ( key_len == 1 && key[ 0 ] == 't' && *json == '"' ) {
+            const char *type = json + 1;
+            json = gadgetbridge_frame_skip_string( json );
+            if ( json == NULL ) {
+                return( NULL );
+            }
+            *len = json - type - 1;
+            return( type );
+        }
+
+        json = gadgetbridge_frame_skip_value( json );
+        if ( json == NULL ) {
+            return( NULL );
+        }
+        json = gadgetbridge_frame_skip_space( json );
+        if ( *json++ != ',' ) {
+            return( NULL );
+        }
+    }
+}
+
+int gadgetbridge_frame_msg( const char *frame ) {
+    size_t type_len = 0;
+    const char *type = gadgetbridge_frame_type( frame, &type_len );
+
+    if ( type == NULL ) {
+        return( -1 );
+    }
+    for ( int i = 0 ; i < GADGETBRIDGE_MSG_NUM ; i++ ) {
+        if ( !strncmp( type, gadgetbridge_msg[ i ].type, type_len ) && gadgetbridge_msg[ i ].type[ type_len ] == '\0' ) {
+            return( i );
+        }
+    }
+    return( -1 );
+}
+
+static const char *gadgetbridge_frame_skip_space( const char *json ) {
+    while ( *json == ' ' || *json == '\t' || *json == '\r' || *json == '\n' ) {
+        json++;
+    }
+    return( json );
+}
+
+/*
+ * json points to the opening '"', returns the position behind the closing '"' or NULL
+ */
+static const char *gadgetbridge_frame_skip_string( const char *json ) {
+    for ( json++ ; *json ; json++ ) {
+        if ( *json == '\\' ) {
+            if ( *++json == '\0' ) {
+                break;
+            }
+        }
+        else if ( *json == '"' ) {
+            return( json + 1 );
+        }
+    }
+    return( NULL );
+}
+
+static const char *gadgetbridge_frame_skip_value( const char *json ) {
+    int depth = 0;
+
+    while ( *json ) {
+        switch( *json ) {
+            case '"':   json = gadgetbridge_frame_skip_string( json );
+                        if ( json == NULL ) {
+                            return( NULL );
+                        }
+                        if ( depth == 0 ) {
+                            return( json );
+                        }
+                        continue;
+            case '{':
+            case '[':   depth++;
+                        break;
+            case '}':
+            case ']':   if ( depth == 0 ) {
+                            return( json );
+                        }
+                        if ( --depth == 0 ) {
+                            return( json + 1 );
+                        }
+                        break;
+            case ',':   if ( depth == 0 ) {
+                            return( json );
+                        }
+                        break;
+        }
+        json++;
+    }
+    return( depth ? NULL : json );
+}
@@ -0,0 +1,119 @@
+/****************************************************************************
+ *   Nov 04 18:40:12 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _GADGETBRIDGE_FRAME_H
+    #define _GADGETBRIDGE_FRAME_H
+
+    #include <stdint.h>
+    #include <stddef.h>
+
+    #define StartofText             0x02
+    #define EndofText               0x03
+    #define LineFeed                0x0a
+    #define DataLinkEscape          0x10
+
+    #define GADGETBRIDGE_MSG_NUM    5
+
+    typedef enum {
+        GADGETBRIDGE_STATE_IDLE = 0,
+        GADGETBRIDGE_STATE_FRAME,
+        GADGETBRIDGE_STATE_OVERFLOW
+    } gadgetbridge_state_t;
+
+    typedef struct {
+        uint32_t bytes;
+        uint32_t frames;
+        uint32_t overflows;
+        uint32_t resets;
+    } gadgetbridge_stats_t;
+
+    /**
+     * @brief called for each complete frame
+     * 
+     * @param   frame   pointer to the frame, '\0' terminated and without "GB(...)" wrapper.
+     *                  the frame is only valid until the frame function returns, the next
+     *                  frame is assembled at the same place. the consumer can modify it in place
+     * @param   len     frame length without '\0'
+     */
+    typedef void ( * GADGETBRIDGE_FRAME_FUNC ) ( char *frame, size_t len );
+
+    typedef struct {
+        const char *type;
+        const char * const *fields;     // NULL terminated
+    } gadgetbridge_msg_t;
+
+    typedef struct {
+        char *buffer;
+        size_t size;
+        size_t len;
+        gadgetbridge_state_t state;
+        gadgetbridge_stats_t stats;
+        GADGETBRIDGE_FRAME_FUNC frame_func;
+    } gadgetbridge_frame_t;
+
+    /**
+     * @brief init a framer
+     * 
+     * @param   framer      pointer to a gadgetbridge_frame_t structure
+     * @param   buffer      frame buffer, frames with size or more bytes are dropped
+     * @param   size        buffer size in bytes
+     * @param   frame_func  function to call for each complete frame
+     */
+    void gadgetbridge_frame_init( gadgetbridge_frame_t *framer, char *buffer, size_t size, GADGETBRIDGE_FRAME_FUNC frame_func );
+    /**
+     * @brief feed received bytes into the framer, frame_func is called for each complete frame
+     * 
+     * @param   framer      pointer to a gadgetbridge_frame_t structure
+     * @param   data        pointer to the received bytes
+     * @param   len         number of bytes
+     */
+    void gadgetbridge_frame_feed( gadgetbridge_frame_t *framer, const uint8_t *data, size_t len );
+    /**
+     * @brief discard the current frame
+     * 
+     * @param   framer      pointer to a gadgetbridge_frame_t structure
+     */
+    void gadgetbridge_frame_reset( gadgetbridge_frame_t *framer );
+    /**
+     * @brief message types with the fields the watch use, all other fields are skipped on decode
+     */
+    extern const gadgetbridge_msg_t gadgetbridge_msg[ GADGETBRIDGE_MSG_NUM ];
+
+    /**
+     * @brief find the message type of a frame without a full decode, the "t" key of the
+     * top level object, example: { "t": "notify", ... }
+     * 
+     * @param   frame       pointer to a '\0' terminated frame
+     * @param   len         pointer to store the length of the type
+     * 
+     * @return  pointer to the type inside the frame, not '\0' terminated, NULL if not found
+     */
+    const char *gadgetbridge_frame_type( const char *frame, size_t *len );
+    /**
+     * @brief get the message type of a frame
+     * 
+     * @param   frame       pointer to a '\0' terminated frame
+     * 
+     * @return  index into gadgetbridge_msg, -1 if the type is unknown or not found
+     */
+    int gadgetbridge_frame_msg( const char *frame );
+
+#endif // _GADGETBRIDGE_FRAME_H
@@ -0,0 +1,312 @@
+/****************************************************************************
+ *   Oct 18 11:05:47 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <SPIFFS.h>
+#include <rom/crc.h>
+#include <time.h>
+
+#include "http_cache.h"
+#include "http_pool.h"
+#include "powermgm.h"
+
+static SemaphoreHandle_t http_cache_mutex = NULL;
+static http_cache_entry_t http_cache_entry[ HTTP_CACHE_MAX_ENTRYS ];
+static http_cache_stats_t http_cache_stats;
+
+static http_cache_entry_t *http_cache_find( uint32_t url_crc, size_t size );
+static http_cache_entry_t *http_cache_alloc_entry( void );
+static void http_cache_store( http_cache_entry_t *entry );
+static uint32_t http_cache_max_age( const char *cache_control );
+static bool http_cache_powermgm_event_cb( EventBits_t event, void *arg );
+
+void http_cache_setup( void ) {
+    http_cache_mutex = xSemaphoreCreateMutex();
+    if ( http_cache_mutex == NULL ) {
+        log_e("http cache mutex alloc failed");
+        while(1);
+    }
+    powermgm_register_cb( POWERMGM_STANDBY, http_cache_powermgm_event_cb, "http cache" );
+}
+
+http_cache_stats_t *http_cache_get_stats( void ) {
+    return( &http_cache_stats );
+}
+
+int http_cache_get( const char *url, void *data, size_t size, HTTP_CACHE_PARSE_FUNC parse_func, void *arg, uint32_t flags ) {
+    const char *header_keys[] = { "ETag", "Last-Modified", "Cache-Control" };
+    uint32_t url_crc = crc32_le( 0, (const uint8_t*)url, strlen( url ) );
+    char etag[ HTTP_CACHE_ETAG_LEN ] = "";
+    char last_modified[ HTTP_CACHE_DATE_LEN ] = "";
+    bool cached = false;
+    time_t now;
+    int httpcode = -1;
+
+    time( &now );
+
+    xSemaphoreTake( http_cache_mutex, portMAX_DELAY );
+    http_cache_stats.requests++;
+    http_cache_entry_t *entry = http_cache_find( url_crc, size );
+    if ( entry ) {
+        if ( now > HTTP_CACHE_MIN_VALID_TIME && now < entry->header.expires ) {
+            memcpy( data, entry->data, size );
+            http_cache_stats.fresh++;
+            http_cache_stats.bytes_saved += entry->header.body_size;
+            xSemaphoreGive( http_cache_mutex );
+            log_d("fresh: %s", url );
+            return( 200 );
+        }
+        strlcpy( etag, entry->header.etag, sizeof( etag ) );
+        strlcpy( last_modified, entry->header.last_modified, sizeof( last_modified ) );
+        cached = true;
+    }
+    xSemaphoreGive( http_cache_mutex );
+
+    HTTPClient *client = http_pool_begin( url );
+    if ( client == NULL ) {
+        log_e("HTTPClient begin failed, %s", url );
+        return( -1 );
+    }
+
+    client->collectHeaders( header_keys, sizeof( header_keys ) / sizeof( header_keys[ 0 ] ) );
+    if ( flags & HTTP_CACHE_FORCE_UNSECURE ) {
+        client->addHeader("force-unsecure","true");
+    }
+    if ( cached && etag[ 0 ] ) {
+        client->addHeader("If-None-Match", etag );
+    }
+    if ( cached && last_modified[ 0 ] ) {
+        client->addHeader("If-Modified-Since", last_modified );
+    }
+    httpcode = http_pool_get( client );
+
+    if ( httpcode == HTTP_CODE_NOT_MODIFIED && cached ) {
+        uint32_t max_age = http_cache_max_age( client->header("Cache-Control").c_str() );
+        strlcpy( etag, client->header("ETag").c_str(), sizeof( etag ) );
+        strlcpy( last_modified, client->header("Last-Modified").c_str(), sizeof( last_modified ) );
+        http_pool_end( client, true );
+
+        xSemaphoreTake( http_cache_mutex, portMAX_DELAY );
+        entry = http_cache_find( url_crc, size );
+        if ( entry ) {
+            memcpy( data, entry->data, size );
+            http_cache_stats.not_modified++;
+            http_cache_stats.bytes_saved += entry->header.body_size;
+            if ( max_age && now > HTTP_CACHE_MIN_VALID_TIME ) {
+                entry->header.expires = now + max_age;
+                entry->dirty = true;
+            }
+            /*
+             * a new validator is written at once. a new expiry stays in ram until
+             * the entry is dropped or the watch goes into standby, losing it costs
+             * one more revalidation
+             */
+            if ( ( etag[ 0 ] && strcmp( etag, entry->header.etag ) ) || ( last_modified[ 0 ] && strcmp( last_modified, entry->header.last_modified ) ) ) {
+                if ( etag[ 0 ] ) {
+                    strlcpy( entry->header.etag, etag, sizeof( entry->header.etag ) );
+                }
+                if ( last_modified[ 0 ] ) {
+                    strlcpy( entry->header.last_modified, last_modified, sizeof( entry->header.last_modified ) );
+                }
+                http_cache_store( entry );
+            }
+            httpcode = 200;
+        }
+        else {
+            httpcode = -1;
+        }
+        xSemaphoreGive( http_cache_mutex );
+        log_d("not modified: %s", url );
+        return( httpcode );
+    }
+
+    if ( httpcode != 200 ) {
+        log_e("HTTPClient error %d, %s", httpcode, url );
+        http_pool_end( client, false );
+        return( -1 );
+    }
+
+    if ( !parse_func( client, data, arg ) ) {
+        http_pool_end( client, false );
+        return( -1 );
+    }
+
+    http_cache_header_t header;
+    memset( &header, 0, sizeof( header ) );
+    header.magic = HTTP_CACHE_MAGIC;
+    header.url_crc = url_crc;
+    header.size = size;
+    header.body_size = client->getSize() > 0 ? client->getSize() : 0;
+    strlcpy( header.etag, client->header("ETag").c_str(), sizeof( header.etag ) );
+    strlcpy( header.last_modified, client->header("Last-Modified").c_str(), sizeof( header.last_modified ) );
+    uint32_t max_age = http_cache_max_age( client->header("Cache-Control").c_str() );
+    header.expires = ( max_age && now > HTTP_CACHE_MIN_VALID_TIME ) ? now + max_age : 0;
+    http_pool_end( client, true );
+
+    /*
+     * nothing to revalidate with and never fresh, don't waste psram and flash
+     */
+    if ( !header.etag[ 0 ] && !header.last_modified[ 0 ] && !header.expires ) {
+        return( 200 );
+    }
+
+    xSemaphoreTake( http_cache_mutex, portMAX_DELAY );
+    entry = http_cache_find( url_crc, size );
+    if ( entry == NULL ) {
+        entry = http_cache_alloc_entry();
+        entry->data = (uint8_t *)ps_malloc( size );
+    }
+    if ( entry->data ) {
+        entry->header = header;
+        entry->last_used = millis();
+        memcpy( entry->data, data, size );
+        http_cache_store( entry );
+    }
+    else {
+        log_e("http cache entry alloc failed");
+    }
+    xSemaphoreGive( http_cache_mutex );
+
+    return( 200 );
+}
+
+/*
+ * find an entry in ram or load it from spiffs, call with the mutex taken
+ */
+static http_cache_entry_t *http_cache_find( uint32_t url_crc, size_t size ) {
+    http_cache_entry_t *entry = NULL;
+    char filename[ 32 ];
+
+    for( int i = 0 ; i < HTTP_CACHE_MAX_ENTRYS ; i++ ) {
+        if ( http_cache_entry[ i ].data && http_cache_entry[ i ].header.url_crc == url_crc ) {
+            if ( http_cache_entry[ i ].header.size != size ) {
+                free( http_cache_entry[ i ].data );
+                http_cache_entry[ i ].data = NULL;
+                return( NULL );
+            }
+            http_cache_entry[ i ].last_used = millis();
+            return( &http_cache_entry[ i ] );
+        }
+    }
+
+    snprintf( filename, sizeof( filename ), HTTP_CACHE_FILE, url_crc );
+    if ( !SPIFFS.exists( filename ) ) {
+        return( NULL );
+    }
+
+    fs::File file = SPIFFS.open( filename, FILE_READ );
+    if ( !file ) {
+        return( NULL );
+    }
+
+    http_cache_header_t header;
+    uint8_t *data = NULL;
+    if ( file.read( (uint8_t*)&header, sizeof( header ) ) == sizeof( header ) && header.magic == HTTP_CACHE_MAGIC && header.url_crc == url_crc && header.size == size ) {
+        data = (uint8_t *)ps_malloc( size );
+        if ( data && file.read( data, size ) != size ) {
+            free( data );
+            data = NULL;
+        }
+    }
+    file.close();
+
+    if ( data == NULL ) {
+        log_e("drop invalid http cache file %s", filename );
+        SPIFFS.remove( filename );
+        return( NULL );
+    }
+
+    entry = http_cache_alloc_entry();
+    entry->header = header;
+    entry->data = data;
+    entry->last_used = millis();
+    entry->dirty = false;
+    return( entry );
+}
+
+/*
+ * take a free entry or drop the least recently used one and write its
+ * expiry first, call with the mutex taken
+ */
+static http_cache_entry_t *http_cache_alloc_entry( void ) {
+    http_cache_entry_t *entry = &http_cache_entry[ 0 ];
+
+    for( int i = 0 ; i < HTTP_CACHE_MAX_ENTRYS ; i++ ) {
+        if ( http_cache_entry[ i ].data == NULL ) {
+            return( &http_cache_entry[ i ] );
+        }
+        if ( http_cache_entry[ i ].last_used < entry->last_used ) {
+            entry = &http_cache_entry[ i ];
+        }
+    }
+    if ( entry->dirty ) {
+        http_cache_store( entry );
+    }
+    free( entry->data );
+    entry->data = NULL;
+    return( entry );
+}
+
+static void http_cache_store( http_cache_entry_t *entry ) {
+    char filename[ 32 ];
+
+    snprintf( filename, sizeof( filename ), HTTP_CACHE_FILE, entry->header.url_crc );
+    fs::File file = SPIFFS.open( filename, FILE_WRITE );
+    if ( !file ) {
+        log_e("can't open file: %s!", filename );
+        return;
+    }
+    if ( file.write( (uint8_t*)&entry->header, sizeof( entry->header ) ) != sizeof( entry->header ) || file.write( entry->data, entry->header.size ) != entry->header.size ) {
+        log_e("write %s failed", filename );
+        file.close();
+        SPIFFS.remove( filename );
+        return;
+    }
+    file.close();
+    entry->dirty = false;
+    http_cache_stats.writes++;
+}
+
+/*
+ * write the expiry of all entrys revalidated since the last store
+ */
+static bool http_cache_powermgm_event_cb( EventBits_t event, void *arg ) {
+    switch( event ) {
+        case POWERMGM_STANDBY:          xSemaphoreTake( http_cache_mutex, portMAX_DELAY );
+                                        for( int i = 0 ; i < HTTP_CACHE_MAX_ENTRYS ; i++ ) {
+                                            if ( http_cache_entry[ i ].data && http_cache_entry[ i ].dirty ) {
+                                                http_cache_store( &http_cache_entry[ i ] );
+                                            }
+                                        }
+                                        xSemaphoreGive( http_cache_mutex );
+                                        break;
+    }
+    return( true );
+}
+
+static uint32_t http_cache_max_age( const char *cache_control ) {
+    const char *max_age = strstr( cache_control, "max-age=" );
+
+    if ( max_age == NULL || strstr( cache_control, "no-cache" ) || strstr( cache_control, "no-store" ) ) {
+        return( 0 );
+    }
+    return( atol( max_age + strlen( "max-age=" ) ) );
+}
@@ -0,0 +1,104 @@
+/****************************************************************************
+ *   Oct 18 11:05:47 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _HTTP_CACHE_H
+    #define _HTTP_CACHE_H
+
+    #include "config.h"
+    #include "HTTPClient.h"
+
+    #define HTTP_CACHE_FILE             "/httpc_%08x.bin"
+    #define HTTP_CACHE_MAGIC            0x43505448      // "HTPC"
+    #define HTTP_CACHE_MAX_ENTRYS       8
+    #define HTTP_CACHE_ETAG_LEN         64
+    #define HTTP_CACHE_DATE_LEN         32
+    #define HTTP_CACHE_MIN_VALID_TIME   1600000000      // time() below this is not synced, nothing is fresh
+
+    #define HTTP_CACHE_FORCE_UNSECURE   _BV(0)          // send "force-unsecure: true"
+
+    /**
+     * @brief   parse a http response body into the decoded structure
+     * 
+     * @param   client      pointer to the HTTPClient with the 200 response
+     * @param   data        pointer to the decoded structure
+     * @param   arg         pointer to the argument passed to http_cache_get()
+     * 
+     * @return  true if success, false if not
+     */
+    typedef bool ( * HTTP_CACHE_PARSE_FUNC ) ( HTTPClient *client, void *data, void *arg );
+
+    /**
+     * on flash layout of an entry, the header is followed by the decoded structure
+     */
+    typedef struct {
+        uint32_t magic;
+        uint32_t url_crc;
+        char etag[ HTTP_CACHE_ETAG_LEN ];
+        char last_modified[ HTTP_CACHE_DATE_LEN ];
+        uint32_t expires;                           // time() until the entry is fresh, 0 = revalidate always
+        uint32_t body_size;                         // content length of the last 200 response
+        uint32_t size;
+    } __attribute__((packed)) http_cache_header_t;
+
+    typedef struct {
+        http_cache_header_t header;
+        uint8_t *data;
+        uint32_t last_used;
+        bool dirty;                                 // expiry changed by a 304 and not written yet
+    } http_cache_entry_t;
+
+    typedef struct {
+        uint32_t requests;                          // http_cache_get() calls
+        uint32_t fresh;                             // served without network traffic
+        uint32_t not_modified;                      // revalidated with 304
+        uint32_t bytes_saved;                       // body bytes of the cached responses not transferred
+        uint32_t writes;                            // entrys written to spiffs
+    } http_cache_stats_t;
+
+    /**
+     * @brief   setup the http cache, call once after SPIFFS.begin()
+     */
+    void http_cache_setup( void );
+    /**
+     * @brief   GET an url through the cache. a fresh entry is copied into data without
+     *          network traffic, a stale entry is revalidated with If-None-Match or
+     *          If-Modified-Since and on 304 the last decoded structure is copied into
+     *          data without parsing. on 200 the parse function fills data and the
+     *          result is stored with the response ETag, Last-Modified and max-age
+     * 
+     * @param   url         url to get
+     * @param   data        pointer to the decoded structure
+     * @param   size        size of the decoded structure
+     * @param   parse_func  pointer to the function that parses a 200 response into data
+     * @param   arg         argument for the parse function
+     * @param   flags       HTTP_CACHE_FORCE_UNSECURE or 0
+     * 
+     * @return  200 if data is valid, -1 on failure
+     */
+    int http_cache_get( const char *url, void *data, size_t size, HTTP_CACHE_PARSE_FUNC parse_func, void *arg, uint32_t flags );
+    /**
+     * @brief   get the http cache statistics
+     * 
+     * @return  pointer to the http_cache_stats_t structure
+     */
+    http_cache_stats_t *http_cache_get_stats( void );
+
+#endif // _HTTP_CACHE_H
@@ -19,108 +19,310 @@
  *  along with this program; if not, write to the Free Software
  *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
  */
-
 /*
  *  inspire by https://github.com/nhatuan84/esp32-http-firmware-update-over-the-air
  *
  */
 #include "config.h"
 #include <HTTPClient.h>
-#include <Update.h>
+#include <MD5Builder.h>
+#include <SPIFFS.h>
+#include <rom/crc.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <lwip/sockets.h>
 
 #include "callback.h"
 #include "http_ota.h"
+#include "http_pool.h"
+
+typedef struct {
+    uint8_t *data;
+    uint32_t offset;                        // partition offset of data[ 0 ]
+    size_t len;
+} http_ota_buffer_t;
 
 callback_t *http_ota_callback = NULL;
+
+static const esp_partition_t *http_ota_partition = NULL;
+static http_ota_checkpoint_t http_ota_checkpoint;
+static QueueHandle_t http_ota_free_queue = NULL;
+static QueueHandle_t http_ota_full_queue = NULL;
+static SemaphoreHandle_t http_ota_write_done = NULL;
+static volatile uint32_t http_ota_written = 0;
+static volatile esp_err_t http_ota_write_error = ESP_OK;
+
 bool http_ota_send_event_cb( EventBits_t event, void *arg );
+static bool http_ota_download( const char* url, const char* md5, uint8_t *buff );
+static void http_ota_write_Task( void * pvParameters );
+static bool http_ota_load_checkpoint( uint32_t url_crc, const char *md5 );
+static void http_ota_save_checkpoint( uint32_t offset );
+static bool http_ota_verify_md5( uint8_t *buff, const char *md5 );
+static int http_ota_wait_data( WiFiClient *client, uint32_t timeout );
 
 bool http_ota_start( const char* url, const char* md5 ) {
-    int downloaded = 0;
-    int written = 0;
-    int total = 1;
-    int len = 1;
-    uint8_t buff[ 1024 * 2 ] = { 0 };
-    size_t size = sizeof( buff );
-    bool ret = true;
-
-    HTTPClient http;
-
-    http.setUserAgent( "ESP32-" __FIRMWARE__ );
-    http.begin( url );
-    int httpCode = http.GET();
-
-    if ( httpCode > 0 && httpCode == HTTP_CODE_OK ) {
-        http_ota_send_event_cb( HTTP_OTA_START, (void *)NULL );
-
-        len = http.getSize();
-        total = len;
-        downloaded = 0;
-
-        WiFiClient * stream = http.getStreamPtr();
-
-        if ( Update.begin( total, U_FLASH ) ) {
-            Update.setMD5( md5 );
-            downloaded = 0;
-            while ( !Update.isFinished() ) {
-                if( http.connected() && ( len > 0 ) ) {
-                    size = stream->available();
-                    if( size > 0 ) {
-                        int c = stream->readBytes( buff, ( ( size > sizeof( buff ) ) ? sizeof( buff ) : size ) );
-                        written = Update.write( buff, c );
-                        if ( written > 0 ) {
-                            if( written != c ) {
-                                http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Flashing chunk not full ... warning!" );
-                                log_w("Flashing chunk not full ... warning!");
-                            }
-                            downloaded += written;
-                            static int16_t old_progress = 0;
-                            int16_t progress = ( 100 * downloaded ) / total ;
-                            if ( old_progress != progress ) {
-                                http_ota_send_event_cb( HTTP_OTA_PROGRESS, (void*)&progress );
-                                log_i("progress: %d", progress );
-                                old_progress = progress;
-                            }
-                        } else {
-                            http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Flashing ... failed!" );
-                            log_e("Flashing ... failed!");
-                            ret = false;
-                            break;
-                        }
-                        if(len > 0) {
-                            len -= c;
-                        }
-                    }
-                    delay( 1 );
-                }
+    bool ret = false;
+
+    http_ota_partition = esp_ota_get_next_update_partition( NULL );
+    if ( http_ota_partition == NULL ) {
+        http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"no ota partition" );
+        log_e("no ota partition");
+        return( false );
+    }
+
+    uint8_t *buff = (uint8_t*)ps_malloc( HTTP_OTA_BUFFER_SIZE * HTTP_OTA_BUFFERS );
+    http_ota_free_queue = xQueueCreate( HTTP_OTA_BUFFERS, sizeof( http_ota_buffer_t * ) );
+    http_ota_full_queue = xQueueCreate( HTTP_OTA_BUFFERS + 1, sizeof( http_ota_buffer_t * ) );
+    http_ota_write_done = xSemaphoreCreateBinary();
+    if ( buff == NULL || http_ota_free_queue == NULL || http_ota_full_queue == NULL || http_ota_write_done == NULL ) {
+        http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"out of memory" );
+        log_e("http ota alloc failed");
+    }
+    else {
+        ret = http_ota_download( url, md5, buff );
+    }
+
+    if ( http_ota_write_done ) {
+        vSemaphoreDelete( http_ota_write_done );
+    }
+    if ( http_ota_full_queue ) {
+        vQueueDelete( http_ota_full_queue );
+    }
+    if ( http_ota_free_queue ) {
+        vQueueDelete( http_ota_free_queue );
+    }
+    http_ota_write_done = NULL;
+    http_ota_full_queue = NULL;
+    http_ota_free_queue = NULL;
+    free( buff );
+    return( ret );
+}
+
+static bool http_ota_download( const char* url, const char* md5, uint8_t *buff ) {
+    http_ota_buffer_t buffer[ HTTP_OTA_BUFFERS ];
+    http_ota_buffer_t *current = NULL;
+    TaskHandle_t write_task = NULL;
+    uint32_t url_crc = crc32_le( 0, (const uint8_t*)url, strlen( url ) );
+    uint32_t offset = 0;
+    uint32_t total = 0;
+    uint32_t received = 0;
+    uint32_t start = 0;
+    uint32_t last_report = 0;
+    int16_t old_progress = -1;
+    int retry = 0;
+    int resumes = 0;
+    bool ret = false;
+
+    for( int i = 0 ; i < HTTP_OTA_BUFFERS ; i++ ) {
+        http_ota_buffer_t *entry = &buffer[ i ];
+        entry->data = buff + i * HTTP_OTA_BUFFER_SIZE;
+        xQueueSend( http_ota_free_queue, &entry, 0 );
+    }
+
+    if ( http_ota_load_checkpoint( url_crc, md5 ) ) {
+        offset = http_ota_checkpoint.offset;
+        total = http_ota_checkpoint.total;
+        log_i("resume download at %d/%d", offset, http_ota_checkpoint.total );
+    }
+    http_ota_written = offset;
+    http_ota_write_error = ESP_OK;
+
+    /*
+     * one pass per connection, a dropped connection is resumed where it stopped
+     */
+    while( true ) {
+        const char *header_keys[] = { "Content-Range" };
+        char range[ 32 ] = "";
+
+        HTTPClient *http = http_pool_begin( url );
+        if ( http == NULL ) {
+            log_e("[HTTP] begin... failed!");
+            if ( ++retry > HTTP_OTA_RETRYS ) {
+                http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"[HTTP] begin... failed!" );
+                break;
+            }
+            vTaskDelay( 1000 * retry );
+            continue;
+        }
+
+        http->setUserAgent( "ESP32-" __FIRMWARE__ );
+        http->collectHeaders( header_keys, sizeof( header_keys ) / sizeof( header_keys[ 0 ] ) );
+        if ( offset > 0 ) {
+            snprintf( range, sizeof( range ), "bytes=%d-", offset );
+            http->addHeader( "Range", range );
+        }
+        int httpCode = http_pool_get( http );
+
+        if ( httpCode == HTTP_CODE_PARTIAL_CONTENT ) {
+            uint32_t from = 0, to = 0, size = 0;
+            if ( sscanf( http->header( "Content-Range" ).c_str(), "bytes %u-%u/%u", &from, &to, &size ) != 3 || from != offset || ( total && size != total ) ) {
+                log_e("unexpected Content-Range: %s", http->header( "Content-Range" ).c_str() );
+                http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"[HTTP] Range ... failed!" );
+                SPIFFS.remove( HTTP_OTA_CHECKPOINT_FILE );
+                http_pool_end( http, false );
+                break;
+            }
+            total = size;
+        }
+        else if ( httpCode == HTTP_CODE_OK && http->getSize() > 0 ) {
+            /*
+             * the server ignores the Range header or the image has changed, start over
+             */
+            if ( offset > 0 ) {
+                log_w("server sends the whole image, restart at 0");
+            }
+            offset = 0;
+            total = http->getSize();
+            if ( current ) {
+                current->offset = 0;
+                current->len = 0;
             }
         }
         else {
-            http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Flashing init ... failed!" );
-            log_e("Flashing init ... failed!");
+            log_e("[HTTP] GET... failed! (%d)", httpCode );
+            http_pool_end( http, false );
+            if ( httpCode > 0 || ++retry > HTTP_OTA_RETRYS ) {
+                http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"[HTTP] GET... failed!" );
+                break;
+            }
+            vTaskDelay( 1000 * retry );
+            continue;
         }
-        http_ota_send_event_cb( HTTP_OTA_FINISH, (void*)NULL );
+
+        if ( write_task == NULL ) {
+            if ( total > http_ota_partition->size ) {
+                http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"image too large" );
+                log_e("image too large: %d > %d", total, http_ota_partition->size );
+                http_pool_end( http, false );
+                break;
+            }
+            http_ota_checkpoint.magic = HTTP_OTA_CHECKPOINT_MAGIC;
+            http_ota_checkpoint.url_crc = url_crc;
+            http_ota_checkpoint.partition = http_ota_partition->address;
+            http_ota_checkpoint.total = total;
+            strlcpy( http_ota_checkpoint.md5, md5 ? md5 : "", sizeof( http_ota_checkpoint.md5 ) );
+
+            xTaskCreate(    http_ota_write_Task,            /* Function to implement the task */
+                            "http ota write Task",          /* Name of the task */
+                            3000,                           /* Stack size in words */
+                            NULL,                           /* Task input parameter */
+                            1,                              /* Priority of the task */
+                            &write_task );                  /* Task handle. */
+            if ( write_task == NULL ) {
+                http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"out of memory" );
+                log_e("http ota write task failed");
+                http_pool_end( http, false );
+                break;
+            }
+            http_ota_send_event_cb( HTTP_OTA_START, (void *)NULL );
+            start = millis();
+            last_report = start;
+        }
+
+        WiFiClient *stream = http->getStreamPtr();
+        uint32_t pass_start = offset;
+
+        while( offset < total && http_ota_write_error == ESP_OK ) {
+            if ( current == NULL ) {
+                xQueueReceive( http_ota_free_queue, &current, portMAX_DELAY );
+                current->offset = offset;
+                current->len = 0;
+            }
+            /*
+             * sleep in select() until data arrives, the writer flashes meanwhile
+             */
+            if ( http_ota_wait_data( stream, HTTP_OTA_READ_TIMEOUT ) <= 0 ) {
+                log_w("no data for %dms", HTTP_OTA_READ_TIMEOUT );
+                break;
+            }
+            size_t len = HTTP_OTA_BUFFER_SIZE - current->len;
+            if ( len > total - offset ) {
+                len = total - offset;
+            }
+            int c = stream->read( current->data + current->len, len );
+            if ( c <= 0 ) {
+                log_w("connection closed at %d/%d", offset, total );
+                break;
+            }
+            current->len += c;
+            offset += c;
+            received += c;
+
+            if ( current->len == HTTP_OTA_BUFFER_SIZE || offset == total ) {
+                xQueueSend( http_ota_full_queue, &current, portMAX_DELAY );
+                current = NULL;
+            }
+
+            int16_t progress = ( (uint64_t)offset * 100 ) / total;
+            if ( old_progress != progress ) {
+                http_ota_send_event_cb( HTTP_OTA_PROGRESS, (void*)&progress );
+                log_i("progress: %d", progress );
+                old_progress = progress;
+            }
+            if ( millis() - last_report >= 1000 ) {
+                uint32_t throughput = (uint64_t)received * 1000 / 1024 / ( millis() - start );
+                http_ota_send_event_cb( HTTP_OTA_THROUGHPUT, (void*)&throughput );
+                last_report = millis();
+            }
+        }
+        http_pool_end( http, offset == total );
+
+        if ( offset == total || http_ota_write_error != ESP_OK ) {
+            break;
+        }
+        /*
+         * only connections in a row without progress count as failed
+         */
+        if ( offset != pass_start ) {
+            retry = 0;
+        }
+        if ( ++retry > HTTP_OTA_RETRYS ) {
+            http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Download firmware ... failed!" );
+            log_e("Download firmware ... failed!");
+            break;
+        }
+        log_w("resume download at %d/%d, retry %d", offset, total, retry );
+        resumes++;
+        vTaskDelay( 1000 * retry );
     }
-    else {
-        http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"[HTTP] GET... failed!" );
-        log_e("[HTTP] GET... failed!");
-        ret = false;        
+
+    if ( write_task ) {
+        /*
+         * NULL tells the writer that nothing more comes
+         */
+        current = NULL;
+        xQueueSend( http_ota_full_queue, &current, portMAX_DELAY );
+        xSemaphoreTake( http_ota_write_done, portMAX_DELAY );
+        http_ota_send_event_cb( HTTP_OTA_FINISH, (void*)NULL );
+
+        uint32_t duration = millis() - start;
+        log_i("received %d bytes in %dms, %d KB/s, %d resumes", received, duration, duration ? (uint32_t)( (uint64_t)received * 1000 / 1024 / duration ) : 0, resumes );
     }
-    http.end();
 
-    if( downloaded == total && len == 0 ) {
-        if( Update.end() ) {
-            http_ota_send_event_cb( HTTP_OTA_FINISH, (void*)"Flashing ... done!" );
-            log_i("Flashing ... done!");
-        } else {
+    if ( http_ota_write_error != ESP_OK ) {
+        http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Flashing ... failed!" );
+        log_e("Flashing ... failed! (%d)", http_ota_write_error );
+    }
+    else if ( total && http_ota_written == total ) {
+        SPIFFS.remove( HTTP_OTA_CHECKPOINT_FILE );
+        if ( !http_ota_verify_md5( buff, md5 ) ) {
             http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Flashing md5 ... failed!" );
             log_e("Flashing md5 ... failed!");
-            ret = false;
         }
-    } else {
-        http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Download firmware ... failed!" );
-        log_e("Download firmware ... failed!");
-        ret = false;
+        else if ( esp_ota_set_boot_partition( http_ota_partition ) != ESP_OK ) {
+            http_ota_send_event_cb( HTTP_OTA_ERROR, (void*)"Flashing image ... failed!" );
+            log_e("Flashing image ... failed!");
+        }
+        else {
+            http_ota_send_event_cb( HTTP_OTA_FINISH, (void*)"Flashing ... done!" );
+            log_i("Flashing ... done!");
+            ret = true;
+        }
     }
+    else if ( write_task ) {
+        http_ota_save_checkpoint( http_ota_written );
+    }
+
     return( ret );
 }
 
@@ -137,4 +339,110 @@ bool http_ota_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const
 
 bool http_ota_send_event_cb( EventBits_t event, void *arg ) {
     return( callback_send_no_log( http_ota_callback, event, arg ) );
-}
\ No newline at end of file
+}
+
+/*
+ * erase and write one sector per buffer, the buffers arrive in order
+ */
+static void http_ota_write_Task( void * pvParameters ) {
+    http_ota_buffer_t *buffer = NULL;
+
+    while( xQueueReceive( http_ota_full_queue, &buffer, portMAX_DELAY ) == pdTRUE && buffer != NULL ) {
+        if ( http_ota_write_error == ESP_OK ) {
+            esp_err_t err = esp_partition_erase_range( http_ota_partition, buffer->offset, HTTP_OTA_BUFFER_SIZE );
+            if ( err == ESP_OK ) {
+                err = esp_partition_write( http_ota_partition, buffer->offset, buffer->data, buffer->len );
+            }
+            if ( err != ESP_OK ) {
+                log_e("flash write at %d failed: %d", buffer->offset, err );
+                http_ota_write_error = err;
+            }
+            else {
+                http_ota_written = buffer->offset + buffer->len;
+                if ( http_ota_written % HTTP_OTA_CHECKPOINT_SIZE == 0 ) {
+                    http_ota_save_checkpoint( http_ota_written );
+                }
+            }
+        }
+        xQueueSend( http_ota_free_queue, &buffer, portMAX_DELAY );
+    }
+    xSemaphoreGive( http_ota_write_done );
+    vTaskDelete( NULL );
+}
+
+static bool http_ota_load_checkpoint( uint32_t url_crc, const char *md5 ) {
+    http_ota_checkpoint_t checkpoint;
+
+    fs::File file = SPIFFS.open( HTTP_OTA_CHECKPOINT_FILE, FILE_READ );
+    if ( !file ) {
+        return( false );
+    }
+    size_t len = file.read( (uint8_t*)&checkpoint, sizeof( checkpoint ) );
+    file.close();
+
+    if ( len != sizeof( checkpoint ) || checkpoint.magic != HTTP_OTA_CHECKPOINT_MAGIC || checkpoint.url_crc != url_crc
+      || checkpoint.partition != http_ota_partition->address || checkpoint.offset >= checkpoint.total
+      || checkpoint.offset % HTTP_OTA_BUFFER_SIZE || strcmp( checkpoint.md5, md5 ? md5 : "" ) ) {
+        log_i("no matching checkpoint, start at 0");
+        SPIFFS.remove( HTTP_OTA_CHECKPOINT_FILE );
+        return( false );
+    }
+    http_ota_checkpoint = checkpoint;
+    return( true );
+}
+
+static void http_ota_save_checkpoint( uint32_t offset ) {
+    /*
+     * only whole sectors count, a partial sector is erased again on resume
+     */
+    http_ota_checkpoint.offset = offset - offset % HTTP_OTA_BUFFER_SIZE;
+
+    fs::File file = SPIFFS.open( HTTP_OTA_CHECKPOINT_FILE, FILE_WRITE );
+    if ( !file ) {
+        log_e("can't write %s", HTTP_OTA_CHECKPOINT_FILE );
+        return;
+    }
+    file.write( (uint8_t*)&http_ota_checkpoint, sizeof( http_ota_checkpoint ) );
+    file.close();
+    log_d("checkpoint at %d", http_ota_checkpoint.offset );
+}
+
+/*
+ * read back the flashed image, this also covers the part from before a resume
+ */
+static bool http_ota_verify_md5( uint8_t *buff, const char *md5 ) {
+    MD5Builder md5_builder;
+
+    if ( md5 == NULL || *md5 == '\0' ) {
+        return( true );
+    }
+
+    md5_builder.begin();
+    for( uint32_t pos = 0 ; pos < http_ota_written ; pos += HTTP_OTA_BUFFER_SIZE ) {
+        size_t len = http_ota_written - pos > HTTP_OTA_BUFFER_SIZE ? HTTP_OTA_BUFFER_SIZE : http_ota_written - pos;
+        if ( esp_partition_read( http_ota_partition, pos, buff, len ) != ESP_OK ) {
+            return( false );
+        }
+        md5_builder.add( buff, len );
+    }
+    md5_builder.calculate();
+    return( md5_builder.toString().equalsIgnoreCase( md5 ) );
+}
+
+static int http_ota_wait_data( WiFiClient *client, uint32_t timeout ) {
+    fd_set readset;
+    struct timeval tv;
+
+    if ( client->available() ) {
+        return( 1 );
+    }
+    if ( !client->connected() ) {
+        return( -1 );
+    }
+
+    FD_ZERO( &readset );
+    FD_SET( client->fd(), &readset );
+    tv.tv_sec = timeout / 1000;
+    tv.tv_usec = ( timeout % 1000 ) * 1000;
+    return( select( client->fd() + 1, &readset, NULL, NULL, &tv ) );
+}
@@ -7,8 +7,50 @@
     #define HTTP_OTA_FINISH         _BV(1)
     #define HTTP_OTA_ERROR          _BV(2)
     #define HTTP_OTA_PROGRESS       _BV(3)
-	
+    #define HTTP_OTA_THROUGHPUT     _BV(4)
+
+    #define HTTP_OTA_BUFFER_SIZE        4096                // one flash sector
+    #define HTTP_OTA_BUFFERS            3
+    #define HTTP_OTA_READ_TIMEOUT       10000               // ms without data before the download is resumed
+    #define HTTP_OTA_RETRYS             5
+    #define HTTP_OTA_CHECKPOINT_FILE    "/http_ota.bin"
+    #define HTTP_OTA_CHECKPOINT_MAGIC   0x4341544f          // "OTAC"
+    #define HTTP_OTA_CHECKPOINT_SIZE    ( 64 * 1024 )       // bytes flashed between two checkpoints
+
+    /**
+     * download progress that survives a reboot
+     */
+    typedef struct {
+        uint32_t magic;
+        uint32_t url_crc;
+        uint32_t partition;                 // flash address of the update partition
+        uint32_t total;
+        uint32_t offset;                    // bytes written to flash, sector aligned
+        char md5[ 33 ];
+    } http_ota_checkpoint_t;
+
+    /**
+     * @brief   download a firmware image and flash it into the next ota partition.
+     *          network reads and flash writes run in parallel through HTTP_OTA_BUFFERS buffers.
+     *          an interrupted download is resumed with a Range request, also after a reboot
+     *          when url and md5 are the same
+     * 
+     * @param   url     url of the firmware image
+     * @param   md5     md5 of the image or NULL
+     * 
+     * @return  true if the image was flashed and will boot next, false if failed
+     */
     bool http_ota_start( const char* url, const char* md5 );
+    /**
+     * @brief   register a callback for HTTP_OTA_START, HTTP_OTA_FINISH, HTTP_OTA_ERROR (char* message),
+     *          HTTP_OTA_PROGRESS (int16_t percent) and HTTP_OTA_THROUGHPUT (uint32_t KB/s)
+     * 
+     * @param   event           event mask
+     * @param   callback_func   pointer to the callback function
+     * @param   id              id for the callback
+     * 
+     * @return  true if success, false if failed
+     */
     bool http_ota_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id );
 
 #endif /* __HTTP_OTA_H */
\ No newline at end of file
@@ -0,0 +1,244 @@
+/****************************************************************************
+ *   Oct 19 20:14:09 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <esp_timer.h>
+
+#include "http_pool.h"
+#include "wifictl.h"
+
+static SemaphoreHandle_t http_pool_mutex = NULL;
+static http_pool_host_t http_pool_host[ HTTP_POOL_MAX_HOSTS ];
+
+static http_pool_host_t *http_pool_find_host( HTTPClient *http );
+static bool http_pool_connect( http_pool_host_t *entry );
+static bool http_pool_wifictl_event_cb( EventBits_t event, void *arg );
+
+void http_pool_setup( void ) {
+    http_pool_mutex = xSemaphoreCreateMutex();
+    if ( http_pool_mutex == NULL ) {
+        log_e("http pool mutex alloc failed");
+        while(1);
+    }
+    wifictl_register_cb( WIFICTL_DISCONNECT | WIFICTL_OFF, http_pool_wifictl_event_cb, "http pool" );
+}
+
+http_pool_host_t *http_pool_get_host( int num ) {
+    if ( num < 0 || num >= HTTP_POOL_MAX_HOSTS || http_pool_host[ num ].mutex == NULL ) {
+        return( NULL );
+    }
+    return( &http_pool_host[ num ] );
+}
+
+HTTPClient *http_pool_begin( const char *url ) {
+    http_pool_host_t *entry = NULL;
+    char host[ HTTP_POOL_HOST_LEN ] = "";
+    uint16_t port = 80;
+
+    /*
+     * split http://host[:port]/path, everything else is not pooled
+     */
+    if ( !strncmp( url, "http://", 7 ) ) {
+        const char *start = url + 7;
+        size_t len = strcspn( start, ":/" );
+        if ( len < sizeof( host ) ) {
+            memcpy( host, start, len );
+            host[ len ] = '\0';
+            if ( start[ len ] == ':' ) {
+                port = atoi( start + len + 1 );
+            }
+        }
+    }
+
+    if ( host[ 0 ] == '\0' ) {
+        HTTPClient *http = new HTTPClient();
+        if ( http && !http->begin( url ) ) {
+            delete http;
+            http = NULL;
+        }
+        return( http );
+    }
+
+    xSemaphoreTake( http_pool_mutex, portMAX_DELAY );
+    for( int i = 0 ; i < HTTP_POOL_MAX_HOSTS ; i++ ) {
+        if ( http_pool_host[ i ].mutex && !strcmp( http_pool_host[ i ].host, host ) && http_pool_host[ i ].port == port ) {
+            entry = &http_pool_host[ i ];
+            break;
+        }
+        if ( entry == NULL && http_pool_host[ i ].mutex == NULL ) {
+            entry = &http_pool_host[ i ];
+        }
+    }
+    if ( entry && entry->mutex == NULL ) {
+        entry->mutex = xSemaphoreCreateMutex();
+        entry->client = new WiFiClient();
+        entry->http = new HTTPClient();
+        if ( entry->mutex == NULL || entry->client == NULL || entry->http == NULL ) {
+            log_e("http pool host alloc failed");
+            while(1);
+        }
+        strlcpy( entry->host, host, sizeof( entry->host ) );
+        entry->port = port;
+    }
+    xSemaphoreGive( http_pool_mutex );
+
+    if ( entry == NULL ) {
+        log_w("http pool full, no keep-alive for %s", host );
+        HTTPClient *http = new HTTPClient();
+        if ( http && !http->begin( url ) ) {
+            delete http;
+            http = NULL;
+        }
+        return( http );
+    }
+
+    xSemaphoreTake( entry->mutex, portMAX_DELAY );
+    entry->start = esp_timer_get_time();
+    entry->requests++;
+
+    if ( !http_pool_connect( entry ) ) {
+        xSemaphoreGive( entry->mutex );
+        return( NULL );
+    }
+    /*
+     * HTTP/1.0 keeps the response free of chunked encoding so the body can be
+     * streamed into the json parser, keep-alive is negotiated with the Connection header
+     */
+    entry->http->setUserAgent( "ESP32HTTPClient" );
+    entry->http->useHTTP10( true );
+    entry->http->setReuse( true );
+    if ( !entry->http->begin( *entry->client, url ) ) {
+        xSemaphoreGive( entry->mutex );
+        return( NULL );
+    }
+    return( entry->http );
+}
+
+int http_pool_get( HTTPClient *http ) {
+    http_pool_host_t *entry = http_pool_find_host( http );
+    int httpcode = http->GET();
+
+    if ( entry == NULL ) {
+        return( httpcode );
+    }
+    /*
+     * the server may have closed the idle connection, try once more on a new one
+     */
+    if ( httpcode < 0 && entry->reusing ) {
+        log_w("%s: request on reused connection failed (%d), reconnect", entry->host, httpcode );
+        entry->client->stop();
+        if ( http_pool_connect( entry ) ) {
+            httpcode = http->GET();
+        }
+    }
+
+    uint32_t latency = esp_timer_get_time() - entry->start;
+    entry->latency += latency;
+    if ( latency > entry->latency_max ) {
+        entry->latency_max = latency;
+    }
+    log_d("%s: %d after %dus", entry->host, httpcode, latency );
+    return( httpcode );
+}
+
+void http_pool_end( HTTPClient *http, bool reuse ) {
+    http_pool_host_t *entry = http_pool_find_host( http );
+
+    if ( entry == NULL ) {
+        http->end();
+        delete http;
+        return;
+    }
+
+    if ( !reuse ) {
+        entry->client->stop();
+    }
+    http->end();
+    xSemaphoreGive( entry->mutex );
+}
+
+static http_pool_host_t *http_pool_find_host( HTTPClient *http ) {
+    for( int i = 0 ; i < HTTP_POOL_MAX_HOSTS ; i++ ) {
+        if ( http_pool_host[ i ].http == http ) {
+            return( &http_pool_host[ i ] );
+        }
+    }
+    return( NULL );
+}
+
+/*
+ * make sure the host connection is open, call with the host mutex taken
+ */
+static bool http_pool_connect( http_pool_host_t *entry ) {
+    if ( entry->client->connected() ) {
+        /*
+         * drop what is left from the last response
+         */
+        while( entry->client->available() ) {
+            entry->client->read();
+        }
+        entry->reused++;
+        entry->reusing = true;
+        return( true );
+    }
+
+    entry->reusing = false;
+    entry->client->stop();
+    if ( entry->dns_time == 0 || millis() - entry->dns_time > HTTP_POOL_DNS_TTL ) {
+        if ( !WiFi.hostByName( entry->host, entry->ip ) ) {
+            log_e("%s: dns lookup failed", entry->host );
+            entry->dns_time = 0;
+            return( false );
+        }
+        entry->dns_time = millis();
+        entry->dns_lookups++;
+    }
+
+    if ( !entry->client->connect( entry->ip, entry->port, HTTP_POOL_CONNECT_TIMEOUT ) ) {
+        /*
+         * the cached address may be outdated, resolve again next time
+         */
+        log_e("%s: connect failed", entry->host );
+        entry->dns_time = 0;
+        return( false );
+    }
+    entry->connects++;
+    return( true );
+}
+
+static bool http_pool_wifictl_event_cb( EventBits_t event, void *arg ) {
+    switch( event ) {
+        case WIFICTL_DISCONNECT:
+        case WIFICTL_OFF:
+            /*
+             * a new network may resolve differently, busy hosts fail on their own
+             */
+            for( int i = 0 ; i < HTTP_POOL_MAX_HOSTS ; i++ ) {
+                if ( http_pool_host[ i ].mutex && xSemaphoreTake( http_pool_host[ i ].mutex, 0 ) == pdTRUE ) {
+                    http_pool_host[ i ].client->stop();
+                    http_pool_host[ i ].dns_time = 0;
+                    xSemaphoreGive( http_pool_host[ i ].mutex );
+                }
+            }
+            break;
+    }
+    return( true );
+}
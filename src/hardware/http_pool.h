@@ -0,0 +1,90 @@
+/****************************************************************************
+ *   Oct 19 20:14:09 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _HTTP_POOL_H
+    #define _HTTP_POOL_H
+
+    #include "config.h"
+    #include <WiFi.h>
+    #include <HTTPClient.h>
+
+    #define HTTP_POOL_MAX_HOSTS         4
+    #define HTTP_POOL_HOST_LEN          64
+    #define HTTP_POOL_DNS_TTL           600000          // ms a resolved address is reused
+    #define HTTP_POOL_CONNECT_TIMEOUT   5000            // ms
+
+    typedef struct {
+        char host[ HTTP_POOL_HOST_LEN ];
+        uint16_t port;
+        IPAddress ip;                               // cached dns result
+        uint32_t dns_time;                          // millis() of the last dns lookup, 0 = not resolved
+        WiFiClient *client;                         // persistent tcp connection
+        HTTPClient *http;                           // persistent http client bound to the connection
+        SemaphoreHandle_t mutex;                    // one request per host at a time
+        uint64_t start;                             // esp_timer_get_time() at http_pool_begin()
+        bool reusing;                               // the current request runs on an already open connection
+        uint32_t requests;
+        uint32_t connects;                          // new tcp connections
+        uint32_t reused;                            // requests on an already open connection
+        uint32_t dns_lookups;
+        uint64_t latency;                           // us from http_pool_begin() to the response header
+        uint32_t latency_max;
+    } http_pool_host_t;
+
+    /**
+     * @brief   setup the http connection pool
+     */
+    void http_pool_setup( void );
+    /**
+     * @brief   get a http client for an url. http urls share one persistent HTTP/1.0 keep-alive
+     *          connection and a cached dns result per host, other urls get a new client.
+     *          the host is locked until http_pool_end() is called
+     * 
+     * @param   url     url to request
+     * 
+     * @return  pointer to a HTTPClient after begin(), NULL on failure
+     */
+    HTTPClient *http_pool_begin( const char *url );
+    /**
+     * @brief   send a GET request, a request on a connection that was closed by the server in the meantime is retried once
+     * 
+     * @param   http    pointer to the HTTPClient from http_pool_begin()
+     * 
+     * @return  http status code or a negative HTTPClient error
+     */
+    int http_pool_get( HTTPClient *http );
+    /**
+     * @brief   finish a request and unlock the host
+     * 
+     * @param   http    pointer to the HTTPClient from http_pool_begin()
+     * @param   reuse   false if the response body was not read completely, the connection is closed
+     */
+    void http_pool_end( HTTPClient *http, bool reuse );
+    /**
+     * @brief   get a host entry for statistics
+     * 
+     * @param   num     host number, 0 ... HTTP_POOL_MAX_HOSTS - 1
+     * 
+     * @return  pointer to the http_pool_host_t structure or NULL if not in use
+     */
+    http_pool_host_t *http_pool_get_host( int num );
+
+#endif // _HTTP_POOL_H
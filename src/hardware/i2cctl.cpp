@@ -0,0 +1,95 @@
+/****************************************************************************
+ *   Nov 07 09:41:12 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <TTGO.h>
+#include <esp_timer.h>
+
+#include "i2cctl.h"
+
+static i2cctl_stats_t i2cctl_stats[ I2CCTL_MAX_DEVICES ];
+static portMUX_TYPE i2cctl_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void i2cctl_account( uint8_t addr, bool write, uint16_t len, uint16_t ret, uint32_t time ) {
+    portENTER_CRITICAL( &i2cctl_stats_mux );
+    for ( int i = 0 ; i < I2CCTL_MAX_DEVICES ; i++ ) {
+        i2cctl_stats_t *stats = &i2cctl_stats[ i ];
+        /*
+         * the first free entry belongs to the next new device
+         */
+        if ( stats->addr != addr && stats->addr != 0 ) {
+            continue;
+        }
+        stats->addr = addr;
+        if ( write ) {
+            stats->writes++;
+        }
+        else {
+            stats->reads++;
+        }
+        if ( ret ) {
+            stats->errors++;
+        }
+        else {
+            stats->bytes += len;
+        }
+        stats->time += time;
+        if ( time > stats->time_max ) {
+            stats->time_max = time;
+        }
+        break;
+    }
+    portEXIT_CRITICAL( &i2cctl_stats_mux );
+}
+
+uint16_t i2cctl_read_bytes( uint8_t addr, uint8_t reg, uint8_t *data, uint16_t len ) {
+    TTGOClass *ttgo = TTGOClass::getWatch();
+    int64_t start = esp_timer_get_time();
+
+    uint16_t ret = ttgo->i2c->readBytes( addr, reg, data, len );
+
+    i2cctl_account( addr, false, len, ret, esp_timer_get_time() - start );
+    return( ret );
+}
+
+uint16_t i2cctl_write_bytes( uint8_t addr, uint8_t reg, uint8_t *data, uint16_t len ) {
+    TTGOClass *ttgo = TTGOClass::getWatch();
+    int64_t start = esp_timer_get_time();
+
+    uint16_t ret = ttgo->i2c->writeBytes( addr, reg, data, len );
+
+    i2cctl_account( addr, true, len, ret, esp_timer_get_time() - start );
+    return( ret );
+}
+
+bool i2cctl_get_stats( int num, i2cctl_stats_t *stats ) {
+    bool retval = false;
+
+    if ( num < 0 || num >= I2CCTL_MAX_DEVICES ) {
+        return( retval );
+    }
+
+    portENTER_CRITICAL( &i2cctl_stats_mux );
+    *stats = i2cctl_stats[ num ];
+    portEXIT_CRITICAL( &i2cctl_stats_mux );
+    retval = stats->addr != 0;
+    return( retval );
+}
@@ -0,0 +1,75 @@
+/****************************************************************************
+ *   Nov 07 09:41:12 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _I2CCTL_H
+    #define _I2CCTL_H
+
+    #include "config.h"
+
+    #define I2CCTL_MAX_DEVICES          8               // device addresses with statistics
+
+    typedef struct {
+        uint8_t addr;                   // 7 bit device address, 0 if not in use
+        uint32_t reads;
+        uint32_t writes;
+        uint32_t errors;
+        uint32_t bytes;
+        uint64_t time;                  // us spend in the transfers, including the wait for the bus
+        uint32_t time_max;              // us
+    } i2cctl_stats_t;
+
+    /**
+     * @brief   read registers through the TTGO i2c bus and count the transfer
+     *          in the statistics of the device
+     * 
+     * @param   addr    7 bit device address
+     * @param   reg     first register
+     * @param   data    pointer to the receive buffer
+     * @param   len     number of bytes to read
+     * 
+     * @return  0 if success, the I2C_Bus error bits if failed
+     */
+    uint16_t i2cctl_read_bytes( uint8_t addr, uint8_t reg, uint8_t *data, uint16_t len );
+    /**
+     * @brief   write registers through the TTGO i2c bus and count the transfer
+     *          in the statistics of the device
+     * 
+     * @param   addr    7 bit device address
+     * @param   reg     first register
+     * @param   data    pointer to the data to write
+     * @param   len     number of bytes to write
+     * 
+     * @return  0 if success, the I2C_Bus error bits if failed
+     */
+    uint16_t i2cctl_write_bytes( uint8_t addr, uint8_t reg, uint8_t *data, uint16_t len );
+    /**
+     * @brief   get a copy of the statistics of a device. only the transfers of the
+     *          firmware are counted, the AXP202, BMA423 and touch libraries use the
+     *          bus directly
+     * 
+     * @param   num     0 ... I2CCTL_MAX_DEVICES - 1
+     * @param   stats   pointer to a i2cctl_stats_t structure that receives the copy
+     * 
+     * @return  true if the entry is in use, false if not
+     */
+    bool i2cctl_get_stats( int num, i2cctl_stats_t *stats );
+
+#endif // _I2CCTL_H
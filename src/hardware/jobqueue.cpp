@@ -0,0 +1,297 @@
+/****************************************************************************
+ *   Oct 20 17:32:51 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <esp_timer.h>
+
+#include "jobqueue.h"
+#include "powermgm.h"
+#include "wifictl.h"
+
+static SemaphoreHandle_t jobqueue_mutex = NULL;
+static SemaphoreHandle_t jobqueue_pending = NULL;
+static jobqueue_job_t jobqueue_job[ JOBQUEUE_MAX_JOBS ];
+static jobqueue_job_t jobqueue_running[ JOBQUEUE_WORKERS ];
+static jobqueue_stats_t jobqueue_stats[ JOBQUEUE_MAX_STATS ];
+static uint32_t jobqueue_seq = 0;
+
+static void jobqueue_worker_Task( void * pvParameters );
+static jobqueue_stats_t *jobqueue_find_stats( const char *id );
+static jobqueue_job_t *jobqueue_find_job( jobqueue_job_t *job, int entrys, JOBQUEUE_FUNC func, void *arg );
+static bool jobqueue_add( const jobqueue_job_t *job );
+static void jobqueue_cancel( uint32_t flags );
+static bool jobqueue_powermgm_event_cb( EventBits_t event, void *arg );
+static bool jobqueue_wifictl_event_cb( EventBits_t event, void *arg );
+
+void jobqueue_setup( void ) {
+    char name[ 24 ];
+
+    jobqueue_mutex = xSemaphoreCreateMutex();
+    jobqueue_pending = xSemaphoreCreateCounting( JOBQUEUE_MAX_JOBS, 0 );
+    if ( jobqueue_mutex == NULL || jobqueue_pending == NULL ) {
+        log_e("jobqueue semaphore alloc failed");
+        while(1);
+    }
+
+    for( int i = 0 ; i < JOBQUEUE_WORKERS ; i++ ) {
+        snprintf( name, sizeof( name ), "jobqueue worker %d", i );
+        xTaskCreate(    jobqueue_worker_Task,           /* Function to implement the task */
+                        name,                           /* Name of the task */
+                        JOBQUEUE_STACK_SIZE,            /* Stack size in words */
+                        (void *)i,                      /* Task input parameter */
+                        1,                              /* Priority of the task */
+                        NULL );                         /* Task handle. */
+    }
+
+    powermgm_register_cb( POWERMGM_STANDBY, jobqueue_powermgm_event_cb, "jobqueue" );
+    wifictl_register_cb( WIFICTL_DISCONNECT | WIFICTL_OFF, jobqueue_wifictl_event_cb, "jobqueue" );
+}
+
+bool jobqueue_submit( JOBQUEUE_FUNC func, void *arg, uint8_t prio, uint32_t flags, const char *id ) {
+    xSemaphoreTake( jobqueue_mutex, portMAX_DELAY );
+    /*
+     * a job that is pending or running is not added again, a running job
+     * runs once more when it is finished
+     */
+    jobqueue_job_t *job = jobqueue_find_job( jobqueue_job, JOBQUEUE_MAX_JOBS, func, arg );
+    if ( job == NULL ) {
+        job = jobqueue_find_job( jobqueue_running, JOBQUEUE_WORKERS, func, arg );
+        if ( job ) {
+            job->rerun = true;
+        }
+    }
+    if ( job ) {
+        jobqueue_stats_t *stats = jobqueue_find_stats( id );
+        if ( stats ) {
+            stats->deduplicated++;
+        }
+        /*
+         * keep the higher priority of both
+         */
+        if ( prio < job->prio ) {
+            job->prio = prio;
+        }
+        xSemaphoreGive( jobqueue_mutex );
+        log_d("job %s already %s", id, job->rerun ? "running" : "pending" );
+        return( true );
+    }
+
+    jobqueue_job_t new_job;
+    new_job.func = func;
+    new_job.arg = arg;
+    new_job.id = id;
+    new_job.prio = prio;
+    new_job.flags = flags;
+    bool retval = jobqueue_add( &new_job );
+    xSemaphoreGive( jobqueue_mutex );
+
+    if ( !retval ) {
+        log_e("jobqueue full, drop job %s", id );
+        return( false );
+    }
+    xSemaphoreGive( jobqueue_pending );
+    return( true );
+}
+
+bool jobqueue_cancel_job( JOBQUEUE_FUNC func, void *arg ) {
+    bool retval = false;
+
+    xSemaphoreTake( jobqueue_mutex, portMAX_DELAY );
+    jobqueue_job_t *job = jobqueue_find_job( jobqueue_job, JOBQUEUE_MAX_JOBS, func, arg );
+    if ( job == NULL ) {
+        job = jobqueue_find_job( jobqueue_running, JOBQUEUE_WORKERS, func, arg );
+        if ( job && !job->rerun ) {
+            job = NULL;
+        }
+    }
+    if ( job ) {
+        jobqueue_stats_t *stats = jobqueue_find_stats( job->id );
+        if ( stats ) {
+            stats->canceled++;
+        }
+        log_i("cancel job %s", job->id );
+        if ( job->rerun ) {
+            job->rerun = false;
+        }
+        else {
+            job->func = NULL;
+        }
+        retval = true;
+    }
+    xSemaphoreGive( jobqueue_mutex );
+
+    return( retval );
+}
+
+jobqueue_stats_t *jobqueue_get_stats( int num ) {
+    if ( num < 0 || num >= JOBQUEUE_MAX_STATS || jobqueue_stats[ num ].id == NULL ) {
+        return( NULL );
+    }
+    return( &jobqueue_stats[ num ] );
+}
+
+/*
+ * find or add the statistics of a job id, call with the mutex taken
+ */
+static jobqueue_stats_t *jobqueue_find_stats( const char *id ) {
+    for( int i = 0 ; i < JOBQUEUE_MAX_STATS ; i++ ) {
+        if ( jobqueue_stats[ i ].id == NULL ) {
+            jobqueue_stats[ i ].id = id;
+            return( &jobqueue_stats[ i ] );
+        }
+        if ( !strcmp( jobqueue_stats[ i ].id, id ) ) {
+            return( &jobqueue_stats[ i ] );
+        }
+    }
+    return( NULL );
+}
+
+/*
+ * find a job in the pending or running jobs, call with the mutex taken
+ */
+static jobqueue_job_t *jobqueue_find_job( jobqueue_job_t *job, int entrys, JOBQUEUE_FUNC func, void *arg ) {
+    for( int i = 0 ; i < entrys ; i++ ) {
+        if ( job[ i ].func == func && job[ i ].arg == arg ) {
+            return( &job[ i ] );
+        }
+    }
+    return( NULL );
+}
+
+/*
+ * add a job into a free pending slot, call with the mutex taken
+ */
+static bool jobqueue_add( const jobqueue_job_t *job ) {
+    for( int i = 0 ; i < JOBQUEUE_MAX_JOBS ; i++ ) {
+        if ( jobqueue_job[ i ].func == NULL ) {
+            jobqueue_job[ i ] = *job;
+            jobqueue_job[ i ].seq = jobqueue_seq++;
+            jobqueue_job[ i ].rerun = false;
+            return( true );
+        }
+    }
+    return( false );
+}
+
+static void jobqueue_cancel( uint32_t flags ) {
+    xSemaphoreTake( jobqueue_mutex, portMAX_DELAY );
+    for( int i = 0 ; i < JOBQUEUE_MAX_JOBS ; i++ ) {
+        if ( jobqueue_job[ i ].func && ( jobqueue_job[ i ].flags & flags ) ) {
+            jobqueue_stats_t *stats = jobqueue_find_stats( jobqueue_job[ i ].id );
+            if ( stats ) {
+                stats->canceled++;
+            }
+            log_i("cancel job %s", jobqueue_job[ i ].id );
+            jobqueue_job[ i ].func = NULL;
+        }
+    }
+    /*
+     * a running job can't be stopped, but it doesn't run again
+     */
+    for( int i = 0 ; i < JOBQUEUE_WORKERS ; i++ ) {
+        if ( jobqueue_running[ i ].func && jobqueue_running[ i ].rerun && ( jobqueue_running[ i ].flags & flags ) ) {
+            log_i("cancel rerun of job %s", jobqueue_running[ i ].id );
+            jobqueue_running[ i ].rerun = false;
+        }
+    }
+    xSemaphoreGive( jobqueue_mutex );
+}
+
+static bool jobqueue_powermgm_event_cb( EventBits_t event, void *arg ) {
+    switch( event ) {
+        case POWERMGM_STANDBY:
+            jobqueue_cancel( JOBQUEUE_CANCEL_STANDBY );
+            break;
+    }
+    return( true );
+}
+
+static bool jobqueue_wifictl_event_cb( EventBits_t event, void *arg ) {
+    switch( event ) {
+        case WIFICTL_DISCONNECT:
+        case WIFICTL_OFF:
+            jobqueue_cancel( JOBQUEUE_CANCEL_WIFI );
+            break;
+    }
+    return( true );
+}
+
+static void jobqueue_worker_Task( void * pvParameters ) {
+    jobqueue_job_t *running = &jobqueue_running[ (int)pvParameters ];
+
+    while( true ) {
+        jobqueue_job_t job;
+
+        /*
+         * a canceled job leaves a count behind, in this case nothing is found
+         */
+        xSemaphoreTake( jobqueue_pending, portMAX_DELAY );
+
+        int next = -1;
+        xSemaphoreTake( jobqueue_mutex, portMAX_DELAY );
+        for( int i = 0 ; i < JOBQUEUE_MAX_JOBS ; i++ ) {
+            if ( jobqueue_job[ i ].func == NULL ) {
+                continue;
+            }
+            if ( next == -1 || jobqueue_job[ i ].prio < jobqueue_job[ next ].prio || ( jobqueue_job[ i ].prio == jobqueue_job[ next ].prio && (int32_t)( jobqueue_job[ i ].seq - jobqueue_job[ next ].seq ) < 0 ) ) {
+                next = i;
+            }
+        }
+        if ( next != -1 ) {
+            job = jobqueue_job[ next ];
+            jobqueue_job[ next ].func = NULL;
+            *running = job;
+            running->rerun = false;
+        }
+        xSemaphoreGive( jobqueue_mutex );
+
+        if ( next == -1 ) {
+            continue;
+        }
+
+        uint64_t start = esp_timer_get_time();
+        job.func( job.arg );
+        uint32_t time = esp_timer_get_time() - start;
+
+        xSemaphoreTake( jobqueue_mutex, portMAX_DELAY );
+        jobqueue_stats_t *stats = jobqueue_find_stats( job.id );
+        if ( stats ) {
+            stats->runs++;
+            stats->time += time;
+            if ( time > stats->time_max ) {
+                stats->time_max = time;
+            }
+            stats->stack_free = uxTaskGetStackHighWaterMark( NULL );
+        }
+        bool rerun = running->rerun && jobqueue_add( running );
+        bool dropped = running->rerun && !rerun;
+        running->func = NULL;
+        xSemaphoreGive( jobqueue_mutex );
+
+        if ( rerun ) {
+            xSemaphoreGive( jobqueue_pending );
+        }
+        else if ( dropped ) {
+            log_e("jobqueue full, drop rerun of job %s", job.id );
+        }
+        log_d("job %s done in %dus, heap: %d", job.id, time, ESP.getFreeHeap() );
+    }
+}
@@ -0,0 +1,101 @@
+/****************************************************************************
+ *   Oct 20 17:32:51 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _JOBQUEUE_H
+    #define _JOBQUEUE_H
+
+    #include "config.h"
+
+    #define JOBQUEUE_WORKERS            2
+    #define JOBQUEUE_STACK_SIZE         10000           // stack size of each worker task
+    #define JOBQUEUE_MAX_JOBS           16              // pending jobs
+    #define JOBQUEUE_MAX_STATS          16              // job ids with statistics
+
+    #define JOBQUEUE_PRIO_HIGH          0
+    #define JOBQUEUE_PRIO_NORMAL        1
+    #define JOBQUEUE_PRIO_LOW           2
+
+    #define JOBQUEUE_CANCEL_WIFI        _BV(0)          // drop the pending job when wifi disconnects
+    #define JOBQUEUE_CANCEL_STANDBY     _BV(1)          // drop the pending job on standby
+    #define JOBQUEUE_NETWORK            ( JOBQUEUE_CANCEL_WIFI | JOBQUEUE_CANCEL_STANDBY )
+
+    typedef void ( * JOBQUEUE_FUNC ) ( void *arg );
+
+    typedef struct {
+        JOBQUEUE_FUNC func;
+        void *arg;
+        const char *id;
+        uint8_t prio;
+        uint32_t flags;
+        uint32_t seq;                               // submit order inside the same priority
+        bool rerun;                                 // submitted again while running
+    } jobqueue_job_t;
+
+    typedef struct {
+        const char *id;
+        uint32_t runs;
+        uint32_t deduplicated;                      // submits merged into the same pending or running job
+        uint32_t canceled;
+        uint64_t time;                              // us spent in the job
+        uint32_t time_max;                          // us
+        uint32_t stack_free;                        // lowest free worker stack in bytes after the job
+    } jobqueue_stats_t;
+
+    /**
+     * @brief   start the worker tasks, call once before the first jobqueue_submit()
+     */
+    void jobqueue_setup( void );
+    /**
+     * @brief   run a function on one of the JOBQUEUE_WORKERS worker tasks. jobs with
+     *          a higher priority run first. when the same function with the same
+     *          argument is already pending the job is not added again, when it is
+     *          running it runs once more after it is finished. the same job never
+     *          runs on two workers at once
+     * 
+     * @param   func        pointer to the job function
+     * @param   arg         argument for the job function
+     * @param   prio        JOBQUEUE_PRIO_HIGH, JOBQUEUE_PRIO_NORMAL or JOBQUEUE_PRIO_LOW
+     * @param   flags       JOBQUEUE_CANCEL_WIFI, JOBQUEUE_CANCEL_STANDBY or 0
+     * @param   id          job name for statistics, must stay valid
+     * 
+     * @return  true if the job is pending, false if the queue is full
+     */
+    bool jobqueue_submit( JOBQUEUE_FUNC func, void *arg, uint8_t prio, uint32_t flags, const char *id );
+    /**
+     * @brief   drop the pending job and the rerun of the running job, a running job
+     *          is not stopped and has to leave the gui alone, see weather_forecast.cpp
+     * 
+     * @param   func        pointer to the job function
+     * @param   arg         argument for the job function
+     * 
+     * @return  true if a job was dropped
+     */
+    bool jobqueue_cancel_job( JOBQUEUE_FUNC func, void *arg );
+    /**
+     * @brief   get the statistics of a job id
+     * 
+     * @param   num     0 ... JOBQUEUE_MAX_STATS - 1
+     * 
+     * @return  pointer to the jobqueue_stats_t structure or NULL if not in use
+     */
+    jobqueue_stats_t *jobqueue_get_stats( int num );
+
+#endif // _JOBQUEUE_H
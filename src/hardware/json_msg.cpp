@@ -0,0 +1,95 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <esp_timer.h>
+
+#include "json_msg.h"
+#include "json_psram_allocator.h"
+
+static SpiRamJsonDocument *json_msg_doc = NULL;
+static SemaphoreHandle_t json_msg_mux = NULL;
+static json_msg_stats_t json_msg_stats;
+
+void json_msg_setup( void ) {
+    json_msg_mux = xSemaphoreCreateMutex();
+    if ( json_msg_mux == NULL ) {
+        log_e("json msg mutex alloc failed");
+        return;
+    }
+    /*
+     * the arena is allocated once and reused for all messages
+     */
+    json_msg_doc = new SpiRamJsonDocument( JSON_MSG_DOC_SIZE );
+}
+
+JsonDocument *json_msg_decode( char *msg, size_t len, JsonDocument *filter ) {
+    DeserializationError error;
+
+    if ( msg == NULL || json_msg_mux == NULL || json_msg_doc == NULL ) {
+        return( NULL );
+    }
+
+    if ( xSemaphoreTake( json_msg_mux, pdMS_TO_TICKS( 1000 ) ) != pdTRUE ) {
+        log_e("json msg document busy");
+        json_msg_stats.busy++;
+        return( NULL );
+    }
+
+    int64_t start = esp_timer_get_time();
+
+    if ( filter ) {
+        error = deserializeJson( *json_msg_doc, msg, len, DeserializationOption::Filter( *filter ) );
+    }
+    else {
+        error = deserializeJson( *json_msg_doc, msg, len );
+    }
+
+    uint32_t decode_time = esp_timer_get_time() - start;
+
+    if ( error ) {
+        log_e("json msg deserializeJson() failed: %s", error.c_str() );
+        json_msg_stats.failed++;
+        json_msg_doc->clear();
+        xSemaphoreGive( json_msg_mux );
+        return( NULL );
+    }
+
+    json_msg_stats.decoded++;
+    json_msg_stats.decode_time += decode_time;
+    if ( decode_time > json_msg_stats.decode_time_max ) {
+        json_msg_stats.decode_time_max = decode_time;
+    }
+    if ( json_msg_doc->memoryUsage() > json_msg_stats.memory_usage_max ) {
+        json_msg_stats.memory_usage_max = json_msg_doc->memoryUsage();
+    }
+
+    return( json_msg_doc );
+}
+
+void json_msg_release( void ) {
+    json_msg_doc->clear();
+    xSemaphoreGive( json_msg_mux );
+}
+
+const json_msg_stats_t *json_msg_get_stats( void ) {
+    return( &json_msg_stats );
+}
@@ -0,0 +1,67 @@
+/****************************************************************************
+ *   Sep 22 10:12:33 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _JSON_MSG_H
+    #define _JSON_MSG_H
+
+    #include "config.h"
+    #include "ArduinoJson.h"
+
+    #define JSON_MSG_DOC_SIZE       4096
+
+    typedef struct {
+        uint32_t decoded;
+        uint32_t failed;
+        uint32_t busy;
+        size_t memory_usage_max;
+        uint32_t decode_time_max;
+        uint64_t decode_time;
+    } json_msg_stats_t;
+
+    /**
+     * @brief   setup the shared message document, allocated once and reused for all messages
+     */
+    void json_msg_setup( void );
+    /**
+     * @brief   decode an json message in place into the shared message document.
+     *          the message buffer is modified and the strings in the document point into it,
+     *          so it must stay valid until json_msg_release() is called.
+     *          on success the shared document is locked until json_msg_release()
+     * 
+     * @param   msg     pointer to the message, modified in place
+     * @param   len     message length
+     * @param   filter  pointer to an ArduinoJson filter document or NULL to decode all fields
+     * 
+     * @return  pointer to the shared document if success, NULL if failed
+     */
+    JsonDocument *json_msg_decode( char *msg, size_t len, JsonDocument *filter );
+    /**
+     * @brief   clear and unlock the shared message document
+     */
+    void json_msg_release( void );
+    /**
+     * @brief   get the message decoder statistics
+     * 
+     * @return  pointer to a json_msg_stats_t structure
+     */
+    const json_msg_stats_t *json_msg_get_stats( void );
+
+#endif // _JSON_MSG_H
@@ -25,6 +25,7 @@
 
 #include "motor.h"
 #include "powermgm.h"
+#include "config_store.h"
 
 volatile int DRAM_ATTR motor_run_time_counter=0;
 hw_timer_t * timer = NULL;
@@ -83,30 +84,13 @@ void motor_set_vibe_config( bool enable ) {
 }
 
 void motor_save_config( void ) {
-    if ( SPIFFS.exists( MOTOR_CONFIG_FILE ) ) {
-        SPIFFS.remove( MOTOR_CONFIG_FILE );
-        log_i("remove old binary motor config");
-    }
-
-    fs::File file = SPIFFS.open( MOTOR_JSON_CONFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", MOTOR_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["motor"] = motor_config.vibe;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &motor_config );
 }
 
-void motor_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void motor_read_json_config( void ) {
     if ( SPIFFS.exists( MOTOR_JSON_CONFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( MOTOR_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -148,4 +132,8 @@ void motor_read_config( void ) {
         file.close();
         }
     }
-}
\ No newline at end of file
+}
+
+void motor_read_config( void ) {
+    config_store_register( "motor", &motor_config, sizeof( motor_config ), motor_read_json_config );
+}
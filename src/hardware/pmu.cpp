@@ -11,6 +11,7 @@
 #include "callback.h"
 
 #include "gui/statusbar.h"
+#include "config_store.h"
 
 static bool firstlooprun = true;
 volatile bool DRAM_ATTR pmu_irq_flag = false;
@@ -19,15 +20,39 @@ portMUX_TYPE DRAM_ATTR PMU_IRQ_Mux = portMUX_INITIALIZER_UNLOCKED;
 callback_t *pmu_callback = NULL;
 pmu_config_t pmu_config;
 
+pmu_snapshot_t pmu_snapshot;
+portMUX_TYPE DRAM_ATTR PMU_SNAPSHOT_Mux = portMUX_INITIALIZER_UNLOCKED;
+TaskHandle_t _pmu_snapshot_Task = NULL;
+static volatile uint32_t pmu_snapshot_stack_free = 0;
+static SemaphoreHandle_t pmu_snapshot_mutex = NULL;
+/*
+ * the fuel gauge survives a reset, the coulomb counter of the axp202 keeps counting
+ */
+__NOINIT_ATTR fuelgauge_t pmu_fuelgauge;
+static bool pmu_coulomb_valid = false;
+static float pmu_coulomb_last = 0;
+static float pmu_coulomb_counted = 0;
+
 void IRAM_ATTR pmu_irq( void );
+void pmu_snapshot_Task( void * pvParameters );
+static void pmu_read_snapshot( void );
+static void pmu_save_learned_battery_cap( void );
 bool pmu_powermgm_event_cb( EventBits_t event, void *arg );
 bool pmu_powermgm_loop_cb( EventBits_t event, void *arg );
+static bool pmu_irq_event_cb( EventBits_t event, void *arg );
+static void pmu_handle_irq( void );
 bool pmu_send_cb( EventBits_t event, void *arg );
 
 void pmu_setup( void ) {
 
     pmu_read_config();
 
+    pmu_snapshot_mutex = xSemaphoreCreateMutex();
+    if ( pmu_fuelgauge.magic != FUELGAUGE_MAGIC || pmu_fuelgauge.designed != pmu_config.designed_battery_cap ) {
+        fuelgauge_init( &pmu_fuelgauge, pmu_config.designed_battery_cap, pmu_config.learned_battery_cap );
+        log_i("fuel gauge reset, capacity %.0fmAh", pmu_fuelgauge.capacity );
+    }
+
     TTGOClass *ttgo = TTGOClass::getWatch();
 
     // Turn on the IRQ used
@@ -62,9 +87,24 @@ void pmu_setup( void ) {
     ttgo->power->setLDO3Mode( AXP202_LDO3_MODE_DCIN );
     ttgo->power->setPowerOutPut( AXP202_LDO3, AXP202_ON );
 
+    /*
+     * the irq is handled in task context by the deferred callback, register it before the irq is attached
+     */
+    pmu_register_cb( PMUCTL_EVENT_INT, pmu_irq_event_cb, "pmu irq" );
     pinMode( AXP202_INT, INPUT );
     attachInterrupt( AXP202_INT, &pmu_irq, FALLING );
 
+    /*
+     * first snapshot before anyone asks for it
+     */
+    pmu_read_snapshot();
+    xTaskCreate(    pmu_snapshot_Task,              /* Function to implement the task */
+                    "pmu snapshot Task",            /* Name of the task */
+                    3072,                           /* Stack size in words */
+                    NULL,                           /* Task input parameter */
+                    1,                              /* Priority of the task */
+                    &_pmu_snapshot_Task );          /* Task handle. */
+
     powermgm_register_cb( POWERMGM_SILENCE_WAKEUP | POWERMGM_STANDBY | POWERMGM_WAKEUP, pmu_powermgm_event_cb, "pmu" );
     powermgm_register_loop_cb( POWERMGM_SILENCE_WAKEUP | POWERMGM_STANDBY | POWERMGM_WAKEUP , pmu_powermgm_loop_cb, "pmu loop" );
 }
@@ -87,56 +127,206 @@ bool pmu_powermgm_event_cb( EventBits_t event, void *arg ) {
     return( true );
 }
 
+static void pmu_read_snapshot( void ) {
+    TTGOClass *ttgo = TTGOClass::getWatch();
+    pmu_snapshot_t snapshot;
+    fuelgauge_sample_t sample;
+    fuelgauge_t gauge;
+
+    /*
+     * the snapshot task and the powermgm events read snapshots
+     */
+    xSemaphoreTake( pmu_snapshot_mutex, portMAX_DELAY );
+
+    snapshot.batt_voltage = ttgo->power->getBattVoltage();
+    snapshot.charge_current = ttgo->power->getBattChargeCurrent();
+    snapshot.discharge_current = ttgo->power->getBattDischargeCurrent();
+    snapshot.vbus_voltage = ttgo->power->getVbusVoltage();
+    snapshot.vbus_current = ttgo->power->getVbusCurrent();
+    snapshot.charge_coulomb = ttgo->power->getBattChargeCoulomb();
+    snapshot.discharge_coulomb = ttgo->power->getBattDischargeCoulomb();
+    snapshot.batt_percentage = ttgo->power->getBattPercentage();
+    snapshot.temp = ttgo->power->getTemp();
+    snapshot.charging = ttgo->power->isChargeing();
+    snapshot.vbus_plug = ttgo->power->isVBUSPlug();
+
+    /*
+     * the charge moved since the last snapshot is taken before the counter is cleared, the first
+     * snapshot after boot does not know where the counter was
+     */
+    float coulomb = 65536.0f * 0.5f * ( (float)snapshot.charge_coulomb - (float)snapshot.discharge_coulomb ) / 3600.0f / PMU_ADC_SAMPLING_RATE;
+    sample.coulomb = pmu_coulomb_valid ? coulomb - pmu_coulomb_last : NAN;
+    if ( pmu_coulomb_valid )
+        pmu_coulomb_counted += sample.coulomb;
+    pmu_coulomb_valid = true;
+    snapshot.coulomb_counted = pmu_coulomb_counted;
+
+    if ( snapshot.charge_coulomb < snapshot.discharge_coulomb || snapshot.batt_voltage < 3200 ) {
+        ttgo->power->ClearCoulombcounter();
+        snapshot.charge_coulomb = 0;
+        snapshot.discharge_coulomb = 0;
+        snapshot.coulomb_data = 0;
+    }
+    else {
+        snapshot.coulomb_data = coulomb;
+    }
+    pmu_coulomb_last = snapshot.coulomb_data;
+
+    sample.time = millis() / 1000;
+    sample.voltage = snapshot.batt_voltage;
+    sample.charge_current = snapshot.charge_current;
+    sample.discharge_current = snapshot.discharge_current;
+    sample.charging = snapshot.charging;
+    sample.vbus = snapshot.vbus_plug;
+    if ( powermgm_get_event( POWERMGM_STANDBY ) )
+        sample.state = FUELGAUGE_STANDBY;
+    else if ( powermgm_get_event( POWERMGM_SILENCE_WAKEUP ) )
+        sample.state = FUELGAUGE_SILENCE_WAKEUP;
+    else
+        sample.state = FUELGAUGE_WAKEUP;
+    /*
+     * only this function writes the gauge, so it can be read without the lock
+     */
+    gauge = pmu_fuelgauge;
+    fuelgauge_update( &gauge, &sample );
+
+    portENTER_CRITICAL( &PMU_SNAPSHOT_Mux );
+    snapshot.version = pmu_snapshot.version + 1;
+    snapshot.timestamp = millis();
+    pmu_snapshot = snapshot;
+    pmu_fuelgauge = gauge;
+    portEXIT_CRITICAL( &PMU_SNAPSHOT_Mux );
+
+    xSemaphoreGive( pmu_snapshot_mutex );
+}
+
+void pmu_snapshot_Task( void * pvParameters ) {
+    log_i("start pmu snapshot task, heap: %d", ESP.getFreeHeap() );
+
+    while( true ) {
+        /*
+         * in standby only update on request
+         */
+        if ( powermgm_get_event( POWERMGM_STANDBY ) ) {
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        }
+        else {
+            ulTaskNotifyTake( pdTRUE, pdMS_TO_TICKS( pmu_config.snapshot_interval ) );
+        }
+        pmu_read_snapshot();
+        /*
+         * the fuel gauge update runs on this stack, watch the lowest free stack
+         */
+        uint32_t stack_free = uxTaskGetStackHighWaterMark( NULL );
+        if ( stack_free != pmu_snapshot_stack_free ) {
+            pmu_snapshot_stack_free = stack_free;
+            log_d("pmu snapshot task stack free: %d", stack_free );
+        }
+    }
+}
+
+uint32_t pmu_get_snapshot_stack_free( void ) {
+    return( pmu_snapshot_stack_free );
+}
+
+void pmu_get_snapshot( pmu_snapshot_t *snapshot ) {
+    portENTER_CRITICAL( &PMU_SNAPSHOT_Mux );
+    *snapshot = pmu_snapshot;
+    portEXIT_CRITICAL( &PMU_SNAPSHOT_Mux );
+}
+
+void pmu_get_fuelgauge( fuelgauge_t *gauge ) {
+    portENTER_CRITICAL( &PMU_SNAPSHOT_Mux );
+    *gauge = pmu_fuelgauge;
+    portEXIT_CRITICAL( &PMU_SNAPSHOT_Mux );
+}
+
+void pmu_update_snapshot( void ) {
+    if ( _pmu_snapshot_Task ) {
+        xTaskNotifyGive( _pmu_snapshot_Task );
+    }
+}
+
+int32_t pmu_get_snapshot_interval( void ) {
+    return( pmu_config.snapshot_interval );
+}
+
+void pmu_set_snapshot_interval( int32_t interval ) {
+    if ( interval < 100 ) {
+        interval = 100;
+    }
+    pmu_config.snapshot_interval = interval;
+    pmu_save_config();
+    pmu_update_snapshot();
+}
+
 void IRAM_ATTR  pmu_irq( void ) {
     portENTER_CRITICAL_ISR(&PMU_IRQ_Mux);
     pmu_irq_flag = true;
     portEXIT_CRITICAL_ISR(&PMU_IRQ_Mux);
+    callback_send_from_isr( pmu_callback, PMUCTL_EVENT_INT, NULL );
+    powermgm_set_event_from_isr( POWERMGM_LOOP_NOTIFY );
 }
 
-void pmu_loop( void ) {
-    static uint64_t nextmillis = 0;
-    static int32_t percent = 0;
+static bool pmu_irq_event_cb( EventBits_t event, void *arg ) {
+    pmu_handle_irq();
+    return( true );
+}
+
+static void pmu_handle_irq( void ) {
     TTGOClass *ttgo = TTGOClass::getWatch();
     /*
-     * handle IRQ event
+     * the flag makes sure the irq is handled once, from the deferred callback or
+     * from pmu_loop when the deferred queue was full
      */
     portENTER_CRITICAL(&PMU_IRQ_Mux);
     bool temp_pmu_irq_flag = pmu_irq_flag;
     pmu_irq_flag = false;
     portEXIT_CRITICAL(&PMU_IRQ_Mux);
 
-    if ( temp_pmu_irq_flag ) {        
-        ttgo->power->readIRQ();
-        if ( ttgo->power->isVbusPlugInIRQ() ) {
-            powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
-        }
-        if ( ttgo->power->isVbusRemoveIRQ() ) {
-            powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
-        }
-        if ( ttgo->power->isChargingIRQ() ) {
-            powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
-        }
-        if ( ttgo->power->isChargingDoneIRQ() ) {
-            powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
-        }
-        if ( ttgo->power->isPEKShortPressIRQ() ) {
-            powermgm_set_event( POWERMGM_PMU_BUTTON );
-            ttgo->power->clearIRQ();
-            return;
-        }
-        if ( ttgo->power->isTimerTimeoutIRQ() ) {
-            powermgm_set_event( POWERMGM_SILENCE_WAKEUP_REQUEST );
-            ttgo->power->clearTimerStatus();
-            ttgo->power->offTimer();
-            ttgo->power->clearIRQ();
-            return;
-        }
+    if ( !temp_pmu_irq_flag ) {
+        return;
+    }
+
+    ttgo->power->readIRQ();
+    if ( ttgo->power->isVbusPlugInIRQ() ) {
+        powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
+    }
+    if ( ttgo->power->isVbusRemoveIRQ() ) {
+        powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
+    }
+    if ( ttgo->power->isChargingIRQ() ) {
+        powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
+    }
+    if ( ttgo->power->isChargingDoneIRQ() ) {
+        powermgm_set_event( POWERMGM_WAKEUP_REQUEST );
+    }
+    if ( ttgo->power->isPEKShortPressIRQ() ) {
+        powermgm_set_event( POWERMGM_PMU_BUTTON );
         ttgo->power->clearIRQ();
-        bool plug = ttgo->power->isVBUSPlug();
-        bool charging = ttgo->power->isChargeing();
-        pmu_send_cb( PMUCTL_VBUS_PLUG, (void *)&plug );
-        pmu_send_cb( PMUCTL_CHARGING, (void *)&charging );
+        return;
     }
+    if ( ttgo->power->isTimerTimeoutIRQ() ) {
+        powermgm_set_event( POWERMGM_SILENCE_WAKEUP_REQUEST );
+        ttgo->power->clearTimerStatus();
+        ttgo->power->offTimer();
+        ttgo->power->clearIRQ();
+        return;
+    }
+    ttgo->power->clearIRQ();
+    bool plug = ttgo->power->isVBUSPlug();
+    bool charging = ttgo->power->isChargeing();
+    pmu_update_snapshot();
+    pmu_send_cb( PMUCTL_VBUS_PLUG, (void *)&plug );
+    pmu_send_cb( PMUCTL_CHARGING, (void *)&charging );
+}
+
+void pmu_loop( void ) {
+    static uint64_t nextmillis = 0;
+    static int32_t percent = 0;
+    static int32_t runtime = -1;
+
+    pmu_handle_irq();
 
     if ( !powermgm_get_event( POWERMGM_STANDBY ) ) {
         if ( nextmillis < millis() ) {
@@ -145,14 +335,24 @@ void pmu_loop( void ) {
                 percent = pmu_get_battery_percent();
                 pmu_send_cb( PMUCTL_BATTERY_PERCENT, (void*)&percent );
             }
+            int32_t minutes = pmu_get_battery_runtime();
+            if ( ( minutes < 0 ) != ( runtime < 0 ) || abs( minutes - runtime ) >= PMU_RUNTIME_STEP ) {
+                runtime = minutes;
+                pmu_send_cb( PMUCTL_BATTERY_RUNTIME, (void*)&runtime );
+            }
+            pmu_save_learned_battery_cap();
         }
+        uint64_t now = millis();
+        powermgm_set_next_deadline( nextmillis > now ? nextmillis - now : 0 );
     }
 
     if ( firstlooprun ) {
         int32_t percent = pmu_get_battery_percent();
-        bool plug = ttgo->power->isVBUSPlug();
-        bool charging = ttgo->power->isChargeing();
+        bool plug = pmu_is_vbus_plug();
+        bool charging = pmu_is_charging();
+        runtime = pmu_get_battery_runtime();
         pmu_send_cb( PMUCTL_BATTERY_PERCENT, (void*)&percent );
+        pmu_send_cb( PMUCTL_BATTERY_RUNTIME, (void*)&runtime );
         pmu_send_cb( PMUCTL_VBUS_PLUG, (void*)&plug );
         pmu_send_cb( PMUCTL_CHARGING, (void*)&charging );
         firstlooprun = false;
@@ -179,7 +379,7 @@ void pmu_standby( void ) {
 
     ttgo->power->clearTimerStatus();
     if ( pmu_get_silence_wakeup() ) {
-        if ( ttgo->power->isChargeing() || ttgo->power->isVBUSPlug() ) {
+        if ( pmu_is_charging() || pmu_is_vbus_plug() ) {
             ttgo->power->setTimer( pmu_config.silence_wakeup_time_vbplug );
             log_i("enable silence wakeup timer, %dmin", pmu_config.silence_wakeup_time_vbplug );
         }
@@ -201,6 +401,10 @@ void pmu_standby( void ) {
 
     gpio_wakeup_enable( (gpio_num_t)AXP202_INT, GPIO_INTR_LOW_LEVEL );
     esp_sleep_enable_gpio_wakeup ();
+    /*
+     * close the interval of the last state for the fuel gauge
+     */
+    pmu_read_snapshot();
 }
 
 void pmu_wakeup( void ) {
@@ -219,43 +423,32 @@ void pmu_wakeup( void ) {
     ttgo->power->offTimer();
 
     ttgo->power->setPowerOutPut( AXP202_LDO2, AXP202_ON );
+
+    pmu_read_snapshot();
 }
 
 void pmu_save_config( void ) {
-    if ( SPIFFS.exists( PMU_CONFIG_FILE ) ) {
-        SPIFFS.remove( PMU_CONFIG_FILE );
-        log_i("remove old binary pmu config");
-    }
-    
-    fs::File file = SPIFFS.open( PMU_JSON_CONFIG_FILE, FILE_WRITE );
+    config_store_save( &pmu_config );
+}
 
-    if (!file) {
-        log_e("Can't open file: %s!", PMU_JSON_CONFIG_FILE );
+/*
+ * keep the learned capacity over a power loss, it changes at most once per charge cycle
+ */
+static void pmu_save_learned_battery_cap( void ) {
+    fuelgauge_t gauge;
+    pmu_get_fuelgauge( &gauge );
+
+    if ( gauge.cycles && (int32_t)( gauge.capacity + 0.5f ) != pmu_config.learned_battery_cap ) {
+        pmu_config.learned_battery_cap = gauge.capacity + 0.5f;
+        log_i("learned battery capacity %dmAh", pmu_config.learned_battery_cap );
+        pmu_save_config();
     }
-    else {
-        SpiRamJsonDocument doc( 3000 );
-
-        doc["silence_wakeup"] = pmu_config.silence_wakeup;
-        doc["silence_wakeup_time"] = pmu_config.silence_wakeup_time;
-        doc["silence_wakeup_time_vbplug"] = pmu_config.silence_wakeup_time_vbplug;
-        doc["experimental_power_save"] = pmu_config.experimental_power_save;
-        doc["normal_voltage"] = pmu_config.normal_voltage;
-        doc["normal_power_save_voltage"] = pmu_config.normal_power_save_voltage;
-        doc["experimental_normal_voltage"] = pmu_config.experimental_normal_voltage;
-        doc["experimental_power_save_voltage"] = pmu_config.experimental_power_save_voltage;
-        doc["compute_percent"] = pmu_config.compute_percent;
-        doc["high_charging_target_voltage"] = pmu_config.high_charging_target_voltage;
-        doc["designed_battery_cap"] = pmu_config.designed_battery_cap;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
 }
 
-void pmu_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void pmu_read_json_config( void ) {
     if ( SPIFFS.exists( PMU_JSON_CONFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( PMU_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -274,9 +467,10 @@ void pmu_read_config( void ) {
                 pmu_config.silence_wakeup_time = doc["silence_wakeup_time"] | SILENCEWAKEUPTIME;
                 pmu_config.silence_wakeup_time_vbplug = doc["silence_wakeup_time_vbplug"] | SILENCEWAKEUPTIME_PLUG;
                 pmu_config.experimental_power_save = doc["experimental_power_save"] | false;
-                pmu_config.compute_percent = doc["compute_percent"] | false;
+                pmu_config.compute_percent = doc["compute_percent"] | true;
                 pmu_config.high_charging_target_voltage = doc["high_charging_target_voltage"] | false;
                 pmu_config.designed_battery_cap = doc["designed_battery_cap"] | 300;
+                pmu_config.snapshot_interval = doc["snapshot_interval"] | PMU_SNAPSHOT_INTERVAL;
                 pmu_config.normal_voltage = doc["normal_voltage"] | NORMALVOLTAGE;
                 pmu_config.normal_power_save_voltage = doc["normal_power_save_voltage"] | NORMALPOWERSAVEVOLTAGE;
                 pmu_config.experimental_normal_voltage = doc["experimental_normal_voltage"] | EXPERIMENTALNORMALVOLTAGE;
@@ -309,6 +503,21 @@ void pmu_read_config( void ) {
     }
 }
 
+/*
+ * version 0 ends before learned_battery_cap, see config_store_register_version()
+ */
+static bool pmu_upgrade_config( uint16_t version, const void *data, uint16_t size ) {
+    if ( version == 0 && size == offsetof( pmu_config_t, learned_battery_cap ) ) {
+        memcpy( &pmu_config, data, size );
+        return( true );
+    }
+    return( false );
+}
+
+void pmu_read_config( void ) {
+    config_store_register_version( "pmu", &pmu_config, sizeof( pmu_config ), PMU_CONFIG_VERSION, pmu_upgrade_config, pmu_read_json_config );
+}
+
 bool pmu_get_silence_wakeup( void ) {
     return( pmu_config.silence_wakeup );
 }
@@ -341,51 +550,63 @@ void pmu_set_experimental_power_save( bool value ) {
 }
 
 int32_t pmu_get_battery_percent( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-
-    if ( ttgo->power->getBattChargeCoulomb() < ttgo->power->getBattDischargeCoulomb() || ttgo->power->getBattVoltage() < 3200 ) {
-        ttgo->power->ClearCoulombcounter();
-    }
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
 
     if ( pmu_get_calculated_percent() ) {
-        return( ( ttgo->power->getCoulombData() / pmu_config.designed_battery_cap ) * 100 );
+        fuelgauge_t gauge;
+        pmu_get_fuelgauge( &gauge );
+        return( gauge.percent );
     }
     else {
-        return( ttgo->power->getBattPercentage() );
+        return( snapshot.batt_percentage );
     }
 }
 
+int32_t pmu_get_battery_runtime( void ) {
+    fuelgauge_t gauge;
+    pmu_get_fuelgauge( &gauge );
+    return( fuelgauge_get_runtime( &gauge ) );
+}
+
 float pmu_get_battery_voltage( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-    return( ttgo->power->getBattVoltage() );
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
+    return( snapshot.batt_voltage );
 }
 
 float pmu_get_battery_charge_current( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-    return( ttgo->power->getBattChargeCurrent() );
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
+    return( snapshot.charge_current );
 }
 
 float pmu_get_battery_discharge_current( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-    return( ttgo->power->getBattDischargeCurrent() );
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
+    return( snapshot.discharge_current );
 }
 
 float pmu_get_vbus_voltage( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-    return( ttgo->power->getVbusVoltage() );
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
+    return( snapshot.vbus_voltage );
 }
 
 float pmu_get_coulumb_data( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-    return( ttgo->power->getCoulombData() );
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
+    return( snapshot.coulomb_data );
 }
 
 bool pmu_is_charging( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-    return( ttgo->power->isChargeing() );
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
+    return( snapshot.charging );
 }
 
 bool pmu_is_vbus_plug( void ) {
-    TTGOClass *ttgo = TTGOClass::getWatch();
-    return( ttgo->power->isVBUSPlug() );
-}
\ No newline at end of file
+    pmu_snapshot_t snapshot;
+    pmu_get_snapshot( &snapshot );
+    return( snapshot.vbus_plug );
+}
@@ -24,13 +24,17 @@
 
     #include "TTGO.h"
     #include "callback.h"
+    #include "fuelgauge.h"
 
     #define PMUCTL_BATTERY_PERCENT      1
     #define PMUCTL_VBUS_PLUG            2
     #define PMUCTL_CHARGING             4
+    #define PMUCTL_BATTERY_RUNTIME      8
+    #define PMUCTL_EVENT_INT            16      // send from the axp202 irq through callback_send_from_isr(), arg is NULL
 
     #define PMU_CONFIG_FILE         "/pmu.cfg"
     #define PMU_JSON_CONFIG_FILE    "/pmu.json"
+    #define PMU_CONFIG_VERSION      1               // 1: learned_battery_cap
 
 	//Some default values, used below as well as in pmu.cpp during json reads
     #define SILENCEWAKEUPTIME                 45
@@ -39,6 +43,9 @@
     #define NORMALPOWERSAVEVOLTAGE          3000
     #define EXPERIMENTALNORMALVOLTAGE       3000
     #define EXPERIMENTALPOWERSAVEVOLTAGE    2700
+    #define PMU_SNAPSHOT_INTERVAL           1000
+    #define PMU_ADC_SAMPLING_RATE           200         // Hz, scales the coulomb counter
+    #define PMU_RUNTIME_STEP                5           // min, smaller runtime changes are not sent
 
     typedef struct {
         int32_t designed_battery_cap = 300;
@@ -49,11 +56,31 @@
         int32_t experimental_normal_voltage = EXPERIMENTALNORMALVOLTAGE;
         int32_t experimental_power_save_voltage = EXPERIMENTALPOWERSAVEVOLTAGE;
         bool high_charging_target_voltage = true;
-        bool compute_percent = false;
+        bool compute_percent = true;
         bool experimental_power_save = false;
         bool silence_wakeup = true;
+        int32_t snapshot_interval = PMU_SNAPSHOT_INTERVAL;
+        int32_t learned_battery_cap = 0;        // mAh learned by the fuel gauge, 0 if unknown
     } pmu_config_t;
 
+    typedef struct {
+        uint32_t version;               // incremented on every update
+        uint32_t timestamp;             // millis() of the update
+        float batt_voltage;             // mV
+        float charge_current;           // mA
+        float discharge_current;        // mA
+        float vbus_voltage;             // mV
+        float vbus_current;             // mA
+        uint32_t charge_coulomb;
+        uint32_t discharge_coulomb;
+        float coulomb_data;             // mAh
+        float coulomb_counted;          // mAh counted since boot, charge positive, never cleared
+        int32_t batt_percentage;        // axp202 fuel gauge
+        float temp;
+        bool charging;
+        bool vbus_plug;
+    } pmu_snapshot_t;
+
     /**
      * @brief setup pmu: axp202
      */
@@ -68,6 +95,19 @@
      * @return  charge in percent or -1 if unknown
      */
     int32_t pmu_get_battery_percent( void );
+    /**
+     * @brief get the remaining runtime on battery, predicted with the discharge
+     * rates the fuel gauge learned for wakeup, silence wakeup and standby
+     * 
+     * @return  runtime in minutes or -1 while charging or unknown
+     */
+    int32_t pmu_get_battery_runtime( void );
+    /**
+     * @brief get a copy of the fuel gauge state, see hardware/fuelgauge.h
+     * 
+     * @param   gauge       pointer to a fuelgauge_t structure to fill
+     */
+    void pmu_get_fuelgauge( fuelgauge_t *gauge );
     /**
      * @brief set the axp202 in standby
      */
@@ -85,7 +125,8 @@
      */
     void pmu_read_config( void );
     /**
-     * @brief read the config for calculated mAh based on the axp202 coloumb counter
+     * @brief read the config for the percent from the fuel gauge, it fuses the axp202
+     * coulomb counter with the battery voltage and the learned capacity
      */
     bool pmu_get_calculated_percent( void );
     /**
@@ -97,7 +138,7 @@
     /**
      * @brief set the config to use calculated mAh
      * 
-     * @param   value   true enable calculated percent, false use AXP202 percent
+     * @param   value   true use the fuel gauge percent, false use AXP202 percent
      */
     void pmu_set_calculated_percent( bool value );
     /**
@@ -126,6 +167,36 @@
      * @param   value   true means enable, false means disable
      */
     void pmu_set_silence_wakeup( bool value );
+    /**
+     * @brief   get a copy of the last pmu sensor snapshot. the snapshot is read by the
+     *          pmu snapshot task every snapshot_interval ms, consumers should use it
+     *          instead of reading the axp202 directly
+     * 
+     * @param   snapshot    pointer to a pmu_snapshot_t structure to fill
+     */
+    void pmu_get_snapshot( pmu_snapshot_t *snapshot );
+    /**
+     * @brief   request an immediate snapshot update
+     */
+    void pmu_update_snapshot( void );
+    /**
+     * @brief   get the snapshot interval
+     * 
+     * @return  interval in ms
+     */
+    int32_t pmu_get_snapshot_interval( void );
+    /**
+     * @brief   set the snapshot interval
+     * 
+     * @param   interval    interval in ms
+     */
+    void pmu_set_snapshot_interval( int32_t interval );
+    /**
+     * @brief   get the lowest free stack of the pmu snapshot task
+     * 
+     * @return  free stack in bytes
+     */
+    uint32_t pmu_get_snapshot_stack_free( void );
     /**
      * @brief get the current battery voltage in mV
      * 
@@ -169,8 +240,14 @@
      */
     bool pmu_is_vbus_plug( void );
     /**
+     * @brief registers a callback function which is called on a corresponding event
      * 
+     * @param   event           possible values: PMUCTL_BATTERY_PERCENT, PMUCTL_VBUS_PLUG, PMUCTL_CHARGING
+     *                          and PMUCTL_BATTERY_RUNTIME with a int32_t runtime in minutes or -1
+     * @param   callback_func   pointer to the callback function
+     * @param   id              program id
      * 
+     * @return  true if success, false if failed
      */
     bool pmu_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id );
 
@@ -26,6 +26,7 @@
 #include <time.h>
 #include "driver/adc.h"
 #include "esp_pm.h"
+#include <esp_timer.h>
 
 #include "pmu.h"
 #include "bma.h"
@@ -43,13 +44,27 @@
 #include <app/alarm_clock/alarm_in_progress.h>
 
 EventGroupHandle_t powermgm_status = NULL;
-portMUX_TYPE DRAM_ATTR powermgmMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t powermgm_next_deadline = 0;
+static bool powermgm_light_sleep = false;
+static powermgm_stats_t powermgm_stats;
+static int64_t powermgm_state_since = 0;
+
+/*
+ * events that wake up the powermgm loop
+ */
+#define POWERMGM_LOOP_EVENTS    ( POWERMGM_STANDBY_REQUEST | POWERMGM_SILENCE_WAKEUP_REQUEST | POWERMGM_WAKEUP_REQUEST | \
+                                  POWERMGM_PMU_BUTTON | POWERMGM_BMA_DOUBLECLICK | POWERMGM_BMA_TILT | POWERMGM_RTC_ALARM | \
+                                  POWERMGM_LOOP_NOTIFY )
+#define POWERMGM_NO_DEADLINE    0xffffffff
 
 callback_t *powermgm_callback = NULL;
 callback_t *powermgm_loop_callback = NULL;
 
 bool powermgm_send_event_cb( EventBits_t event );
 bool powermgm_send_loop_event_cb( EventBits_t event );
+static void powermgm_wait( void );
+static void powermgm_account_state( void );
+static void powermgm_light_sleep_start( void );
 
 void powermgm_setup( void ) {
 
@@ -57,6 +72,7 @@ void powermgm_setup( void ) {
 
     pmu_setup();
     bma_setup();
+    stephistory_setup();
     rtcctl_setup();
     wifictl_setup();
     touch_setup();
@@ -88,6 +104,7 @@ void powermgm_loop( void ) {
   
     // drive into
     if ( powermgm_get_event( POWERMGM_SILENCE_WAKEUP_REQUEST | POWERMGM_WAKEUP_REQUEST ) ) {
+        powermgm_account_state();
         powermgm_clear_event( POWERMGM_STANDBY | POWERMGM_SILENCE_WAKEUP | POWERMGM_WAKEUP );
 
         //Network transfer times are likely a greater time consumer than actual computational time
@@ -116,12 +133,14 @@ void powermgm_loop( void ) {
         bool noBuzz = powermgm_get_event( POWERMGM_SILENCE_WAKEUP | POWERMGM_SILENCE_WAKEUP_REQUEST );
         
         // send standby event
+        powermgm_account_state();
         powermgm_clear_event( POWERMGM_STANDBY | POWERMGM_SILENCE_WAKEUP | POWERMGM_WAKEUP );
         powermgm_set_event( POWERMGM_STANDBY );
 
         adc_power_off();
 
-        if ( powermgm_send_event_cb( POWERMGM_STANDBY ) ) {
+        powermgm_light_sleep = powermgm_send_event_cb( POWERMGM_STANDBY );
+        if ( powermgm_light_sleep ) {
             if (!noBuzz) motor_vibe(3);  //Only buzz if a non silent wake was performed
             log_i("Free heap: %d", ESP.getFreeHeap());
             log_i("Free PSRAM heap: %d", ESP.getFreePsram());
@@ -129,7 +148,7 @@ void powermgm_loop( void ) {
             log_i("go standby");
             delay( 100 );
             setCpuFrequencyMhz( 80 );
-            esp_light_sleep_start();
+            powermgm_light_sleep_start();
             // from here, the consumption is round about 2.5mA
             // total standby time is 152h (6days) without use?
         }
@@ -145,36 +164,104 @@ void powermgm_loop( void ) {
     }
     powermgm_clear_event( POWERMGM_SILENCE_WAKEUP_REQUEST | POWERMGM_WAKEUP_REQUEST | POWERMGM_STANDBY_REQUEST );
 
-    // send loop event depending on powermem state
+    // fire callbacks queued from interrupt context, also in standby, the pmu and bma irq wakes up through them
+    callback_process_deferred();
+
+    // send loop event depending on powermem state, loop callbacks request their next deadline
+    powermgm_next_deadline = POWERMGM_NO_DEADLINE;
     if ( powermgm_get_event( POWERMGM_STANDBY ) ) {
-        vTaskDelay( 100 );
         powermgm_send_loop_event_cb( POWERMGM_STANDBY );
     }
     else if ( powermgm_get_event( POWERMGM_WAKEUP ) ) {
+        powermgm_set_next_deadline( POWERMGM_LOOP_MAX_WAIT );
         powermgm_send_loop_event_cb( POWERMGM_WAKEUP );
     }
     else if ( powermgm_get_event( POWERMGM_SILENCE_WAKEUP ) ) {
+        powermgm_set_next_deadline( POWERMGM_LOOP_MAX_WAIT );
         powermgm_send_loop_event_cb( POWERMGM_SILENCE_WAKEUP );
     }
+
+    powermgm_wait();
+}
+
+static void powermgm_wait( void ) {
+    TickType_t ticks = portMAX_DELAY;
+
+    if ( powermgm_next_deadline != POWERMGM_NO_DEADLINE ) {
+        ticks = pdMS_TO_TICKS( powermgm_next_deadline );
+    }
+
+    /*
+     * in standby give the other tasks POWERMGM_STANDBY_IDLE ms, when nothing
+     * happens until then and no deadline is pending go back to light sleep
+     */
+    if ( powermgm_get_event( POWERMGM_STANDBY ) && powermgm_light_sleep ) {
+        if ( ticks > pdMS_TO_TICKS( POWERMGM_STANDBY_IDLE ) ) {
+            if ( !( xEventGroupWaitBits( powermgm_status, POWERMGM_LOOP_EVENTS, pdFALSE, pdFALSE, pdMS_TO_TICKS( POWERMGM_STANDBY_IDLE ) ) & POWERMGM_LOOP_EVENTS ) ) {
+                log_d("go back to light sleep");
+                powermgm_light_sleep_start();
+            }
+            powermgm_clear_event( POWERMGM_LOOP_NOTIFY );
+            return;
+        }
+    }
+
+    xEventGroupWaitBits( powermgm_status, POWERMGM_LOOP_EVENTS, pdFALSE, pdFALSE, ticks );
+    powermgm_clear_event( POWERMGM_LOOP_NOTIFY );
+}
+
+static void powermgm_account_state( void ) {
+    int64_t now = esp_timer_get_time();
+    uint64_t time = now - powermgm_state_since;
+
+    if ( powermgm_get_event( POWERMGM_STANDBY ) ) {
+        powermgm_stats.standby += time;
+    }
+    else if ( powermgm_get_event( POWERMGM_SILENCE_WAKEUP ) ) {
+        powermgm_stats.silence_wakeup += time;
+    }
+    else if ( powermgm_get_event( POWERMGM_WAKEUP ) ) {
+        powermgm_stats.wakeup += time;
+    }
+    powermgm_state_since = now;
+}
+
+static void powermgm_light_sleep_start( void ) {
+    int64_t start = esp_timer_get_time();
+    esp_light_sleep_start();
+    powermgm_stats.light_sleep += esp_timer_get_time() - start;
+    powermgm_stats.light_sleep_count++;
+}
+
+powermgm_stats_t *powermgm_get_stats( void ) {
+    powermgm_account_state();
+    return( &powermgm_stats );
+}
+
+void powermgm_set_next_deadline( uint32_t ms ) {
+    if ( ms < powermgm_next_deadline ) {
+        powermgm_next_deadline = ms;
+    }
 }
 
 void powermgm_set_event( EventBits_t bits ) {
-    portENTER_CRITICAL(&powermgmMux);
     xEventGroupSetBits( powermgm_status, bits );
-    portEXIT_CRITICAL(&powermgmMux);
+}
+
+void IRAM_ATTR powermgm_set_event_from_isr( EventBits_t bits ) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    if ( xEventGroupSetBitsFromISR( powermgm_status, bits, &xHigherPriorityTaskWoken ) == pdPASS && xHigherPriorityTaskWoken ) {
+        portYIELD_FROM_ISR();
+    }
 }
 
 void powermgm_clear_event( EventBits_t bits ) {
-    portENTER_CRITICAL(&powermgmMux);
     xEventGroupClearBits( powermgm_status, bits );
-    portEXIT_CRITICAL(&powermgmMux);
 }
 
 EventBits_t powermgm_get_event( EventBits_t bits ) {
-    portENTER_CRITICAL(&powermgmMux);
-    EventBits_t temp = xEventGroupGetBits( powermgm_status ) & bits;
-    portEXIT_CRITICAL(&powermgmMux);
-    return( temp );
+    return( xEventGroupGetBits( powermgm_status ) & bits );
 }
 
 bool powermgm_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id ) {
@@ -35,6 +35,18 @@
     #define POWERMGM_BMA_DOUBLECLICK            _BV(9)
     #define POWERMGM_BMA_TILT                   _BV(10)
     #define POWERMGM_RTC_ALARM                  _BV(11)
+    #define POWERMGM_LOOP_NOTIFY                _BV(12)
+
+    #define POWERMGM_LOOP_MAX_WAIT              1000        // max ms between two loop passes when awake
+    #define POWERMGM_STANDBY_IDLE               100         // ms without events in standby before going back to light sleep
+
+    typedef struct {
+        uint64_t standby;               // us in each power state
+        uint64_t silence_wakeup;
+        uint64_t wakeup;
+        uint64_t light_sleep;           // us in light sleep, part of standby
+        uint32_t light_sleep_count;
+    } powermgm_stats_t;
     
     /**
      * @brief setp power managment, coordinate managment beween CPU, wifictl, pmu, bma, display, backlight and lvgl
@@ -56,6 +68,12 @@
      * @param   bits    event to trigger, example: POWERMGM_WIFI_ON_REQUEST for switch an WiFi
      */
     void powermgm_clear_event( EventBits_t bits );
+    /**
+     * @brief trigger a power managemt event from interrupt context, wakes up the powermgm loop
+     * 
+     * @param   bits    event to trigger, example: POWERMGM_RTC_ALARM or POWERMGM_LOOP_NOTIFY to only run the loop
+     */
+    void powermgm_set_event_from_isr( EventBits_t bits );
     /**
      * @brief get a power managemt event state
      * 
@@ -80,5 +98,20 @@
      * @param   id                  pointer to an string
      */
     bool powermgm_register_loop_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id );
+    /**
+     * @brief   request the next loop pass in at most ms milliseconds, call from a loop callback.
+     *          the powermgm loop sleeps until the earliest requested deadline or an event.
+     *          without a deadline the loop runs again after POWERMGM_LOOP_MAX_WAIT ms when awake
+     *          and only on events in standby
+     * 
+     * @param   ms  time in ms until the next loop pass is needed
+     */
+    void powermgm_set_next_deadline( uint32_t ms );
+    /**
+     * @brief   get the time spend in each power state and in light sleep since boot
+     * 
+     * @return  pointer to a powermgm_stats_t structure
+     */
+    powermgm_stats_t *powermgm_get_stats( void );
 
 #endif // _POWERMGM_H
\ No newline at end of file
@@ -25,8 +25,6 @@
 #include "powermgm.h"
 #include "callback.h"
 
-volatile bool DRAM_ATTR rtc_irq_flag = false;
-portMUX_TYPE DRAM_ATTR RTC_IRQ_Mux = portMUX_INITIALIZER_UNLOCKED;
 static void IRAM_ATTR rtcctl_irq( void );
 
 static bool alarm_enabled = false;
@@ -35,7 +33,6 @@ static int alarm_minute = 0;
 
 bool rtcctl_send_event_cb( EventBits_t event );
 bool rtcctl_powermgm_event_cb( EventBits_t event, void *arg );
-bool rtcctl_powermgm_loop_cb( EventBits_t event, void *arg );
 
 callback_t *rtcctl_callback = NULL;
 
@@ -54,7 +51,6 @@ void rtcctl_setup( void ) {
     rtcctl_set_alarm_term( alarm_hour, alarm_minute );
 
     powermgm_register_cb( POWERMGM_SILENCE_WAKEUP | POWERMGM_STANDBY | POWERMGM_WAKEUP, rtcctl_powermgm_event_cb, "rtcctl" );
-    powermgm_register_loop_cb( POWERMGM_SILENCE_WAKEUP | POWERMGM_WAKEUP, rtcctl_powermgm_loop_cb, "rtcctl loop" );
 }
 
 bool rtcctl_powermgm_event_cb( EventBits_t event, void *arg ) {
@@ -71,29 +67,12 @@ bool rtcctl_powermgm_event_cb( EventBits_t event, void *arg ) {
     return( true );
 }
 
-bool rtcctl_powermgm_loop_cb( EventBits_t event, void *arg ) {
-    rtcctl_loop();
-    return( true );
-}
-
 static void IRAM_ATTR rtcctl_irq( void ) {
-    portENTER_CRITICAL_ISR(&RTC_IRQ_Mux);
-    rtc_irq_flag = true;
-    portEXIT_CRITICAL_ISR(&RTC_IRQ_Mux);
-    powermgm_set_event( POWERMGM_RTC_ALARM );
-}
-
-void rtcctl_loop( void ) {
-    // fire callback
-    if ( !powermgm_get_event( POWERMGM_STANDBY ) ) {
-        portENTER_CRITICAL( &RTC_IRQ_Mux );
-        bool temp_rtc_irq_flag = rtc_irq_flag;
-        rtc_irq_flag = false;
-        portEXIT_CRITICAL( &RTC_IRQ_Mux );
-        if ( temp_rtc_irq_flag ) {
-            rtcctl_send_event_cb( RTCCTL_ALARM_OCCURRED );
-        }
-    }
+    /*
+     * the alarm callback is fired from powermgm loop after wakeup
+     */
+    callback_send_from_isr( rtcctl_callback, RTCCTL_ALARM_OCCURRED, NULL );
+    powermgm_set_event_from_isr( POWERMGM_RTC_ALARM );
 }
 
 bool rtcctl_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id ) {
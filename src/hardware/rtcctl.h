@@ -34,10 +34,6 @@
      * @brief setup rtc controller routine
      */
     void rtcctl_setup( void );
-    /**
-     * @brief rtc controller loop routine
-     */
-    void rtcctl_loop( void );
     /**
      * @brief registers a callback function which is called on a corresponding event
      * 
@@ -28,6 +28,7 @@
 #include "sound.h"
 #include "callback.h"
 #include "json_psram_allocator.h"
+#include "config_store.h"
 
 // based on https://github.com/earlephilhower/ESP8266Audio
 #include <SPIFFS.h>
@@ -169,6 +170,10 @@ void sound_loop( void ) {
         if ( wav->isRunning() && !wav->loop() ) {
             log_i("stop playing wav sound");
         }
+        // keep the i2s buffers filled while playing
+        if ( mp3->isRunning() || wav->isRunning() ) {
+            powermgm_set_next_deadline( 1 );
+        }
     }
 }
 
@@ -207,26 +212,13 @@ void sound_speak( const char *str )
 }
 
 void sound_save_config( void ) {
-    fs::File file = SPIFFS.open( SOUND_JSON_CONFIG_FILE, FILE_WRITE );
-    sound_set_volume_config(sound_config.volume);
-    if (!file) {
-        log_e("Can't open file: %s!", SOUND_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["enable"] = sound_config.enable;
-        doc["volume"] = sound_config.volume;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &sound_config );
 }
 
-void sound_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void sound_read_json_config( void ) {
     fs::File file = SPIFFS.open( SOUND_JSON_CONFIG_FILE, FILE_READ );
     if (!file) {
         log_e("Can't open file: %s!", SOUND_JSON_CONFIG_FILE );
@@ -248,6 +240,10 @@ void sound_read_config( void ) {
     file.close();
 }
 
+void sound_read_config( void ) {
+    config_store_register( "sound", &sound_config, sizeof( sound_config ), sound_read_json_config );
+}
+
 bool sound_get_enabled_config( void ) {
     return sound_config.enable;
 }
@@ -0,0 +1,523 @@
+/****************************************************************************
+ *   Oct 29 21:07:44 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+#include <SPIFFS.h>
+#include <esp_timer.h>
+
+#include "stephistory.h"
+#include "bma.h"
+
+/*
+ * running buckets and closed buckets that are not on flash yet, survives a reset
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t counter;                                               // bma stepcounter at the last update
+    stephistory_bucket_t hour;
+    stephistory_bucket_t day;
+    stephistory_bucket_t pending_hours[ STEPHISTORY_FLUSH_HOURS ];
+    uint32_t pending_hour_count;
+    stephistory_bucket_t pending_days[ STEPHISTORY_PENDING_DAYS ];
+    uint32_t pending_day_count;
+} stephistory_state_t;
+
+/*
+ * per resolution files, the minutes are only in RAM
+ */
+typedef struct {
+    const char *file;
+    const char *old_file;
+    uint32_t max_records;
+} stephistory_store_t;
+
+static const stephistory_store_t stephistory_store[ STEPHISTORY_RESOLUTION_NUM ] = {
+    { NULL, NULL, 0 },
+    { STEPHISTORY_HOUR_FILE, STEPHISTORY_HOUR_OLD_FILE, STEPHISTORY_HOUR_MAX_RECORDS },
+    { STEPHISTORY_DAY_FILE, STEPHISTORY_DAY_OLD_FILE, STEPHISTORY_DAY_MAX_RECORDS }
+};
+
+__NOINIT_ATTR stephistory_state_t stephistory_state;
+
+static SemaphoreHandle_t stephistory_mutex = NULL;
+static uint16_t *stephistory_minutes = NULL;
+static uint8_t *stephistory_minute_activity = NULL;                 // activity + 1 per minute, 0 if unknown
+static uint32_t stephistory_minute = 0;                             // unix minute of the last ring update
+static uint32_t stephistory_last_time[ STEPHISTORY_RESOLUTION_NUM ];    // time of the last bucket on flash
+static stephistory_stats_t stephistory_stats;
+
+static bool stephistory_bma_event_cb( EventBits_t event, void *arg );
+static void stephistory_add_activity( bma_activity_event_t *event );
+static stephistory_bucket_t *stephistory_get_bucket( int resolution, time_t start );
+static void stephistory_roll( time_t now );
+static void stephistory_close( stephistory_bucket_t *bucket, time_t start, stephistory_bucket_t *pending, uint32_t *count, uint32_t max );
+static bool stephistory_append( int resolution, stephistory_bucket_t *buckets, uint32_t *count );
+static bool stephistory_read_record( fs::File &file, uint32_t index, stephistory_bucket_t *bucket );
+static uint32_t stephistory_read_last_time( int resolution );
+static void stephistory_migrate( const char *v1_file, const char *file );
+static size_t stephistory_query_file( const char *filename, uint32_t first, time_t to, stephistory_bucket_t *buckets, size_t max );
+static size_t stephistory_query_ram( stephistory_bucket_t *ram, uint32_t count, uint32_t first, time_t to, stephistory_bucket_t *buckets, size_t max );
+
+void stephistory_setup( void ) {
+    stephistory_mutex = xSemaphoreCreateMutex();
+    stephistory_minutes = (uint16_t*)ps_calloc( STEPHISTORY_MINUTES, sizeof( uint16_t ) );
+    stephistory_minute_activity = (uint8_t*)ps_calloc( STEPHISTORY_MINUTES, sizeof( uint8_t ) );
+    if ( stephistory_mutex == NULL || stephistory_minutes == NULL || stephistory_minute_activity == NULL ) {
+        log_e("stephistory alloc failed");
+        return;
+    }
+
+    if ( stephistory_state.magic != STEPHISTORY_MAGIC ) {
+        memset( &stephistory_state, 0, sizeof( stephistory_state ) );
+        stephistory_state.magic = STEPHISTORY_MAGIC;
+        stephistory_state.counter = bma_get_stepcounter();
+        log_i("stephistory state not valid. reset");
+    }
+
+    stephistory_migrate( STEPHISTORY_V1_HOUR_OLD_FILE, STEPHISTORY_HOUR_OLD_FILE );
+    stephistory_migrate( STEPHISTORY_V1_HOUR_FILE, STEPHISTORY_HOUR_FILE );
+    stephistory_migrate( STEPHISTORY_V1_DAY_OLD_FILE, STEPHISTORY_DAY_OLD_FILE );
+    stephistory_migrate( STEPHISTORY_V1_DAY_FILE, STEPHISTORY_DAY_FILE );
+
+    stephistory_last_time[ STEPHISTORY_HOUR ] = stephistory_read_last_time( STEPHISTORY_HOUR );
+    stephistory_last_time[ STEPHISTORY_DAY ] = stephistory_read_last_time( STEPHISTORY_DAY );
+
+    bma_register_cb( BMACTL_STEPCOUNTER | BMACTL_ACTIVITY, stephistory_bma_event_cb, "stephistory" );
+}
+
+/*
+ * convert a steps only file from older firmware, the records get zero active and sleep minutes
+ */
+static void stephistory_migrate( const char *v1_file, const char *file ) {
+    stephistory_bucket_t buckets[ 32 ];
+    uint8_t v1[ sizeof( buckets ) / sizeof( stephistory_bucket_t ) * 8 ];
+    uint32_t records = 0;
+
+    if ( !SPIFFS.exists( v1_file ) ) {
+        return;
+    }
+    fs::File in = SPIFFS.open( v1_file, FILE_READ );
+    fs::File out = SPIFFS.open( file, FILE_WRITE );
+    if ( !in || !out ) {
+        log_e("Can't convert file: %s!", v1_file );
+        return;
+    }
+    memset( buckets, 0, sizeof( buckets ) );
+    while( true ) {
+        size_t count = in.read( v1, sizeof( v1 ) ) / 8;
+        if ( count == 0 ) {
+            break;
+        }
+        for ( size_t i = 0 ; i < count ; i++ ) {
+            memcpy( &buckets[ i ].time, &v1[ i * 8 ], sizeof( uint32_t ) );
+            memcpy( &buckets[ i ].steps, &v1[ i * 8 + 4 ], sizeof( uint32_t ) );
+        }
+        out.write( (uint8_t *)buckets, count * sizeof( stephistory_bucket_t ) );
+        records += count;
+    }
+    in.close();
+    out.close();
+    SPIFFS.remove( v1_file );
+    log_i("converted %d records from %s to %s", records, v1_file, file );
+}
+
+static bool stephistory_bma_event_cb( EventBits_t event, void *arg ) {
+    uint32_t counter = bma_get_stepcounter();
+    uint32_t steps = 0;
+    bool flush = false;
+    time_t now;
+
+    time( &now );
+    /*
+     * without a valid time the steps stay in the counter until the time is synced
+     */
+    if ( now < STEPHISTORY_VALID_TIME ) {
+        return( true );
+    }
+
+    switch( event ) {
+        case BMACTL_STEPCOUNTER:
+            xSemaphoreTake( stephistory_mutex, portMAX_DELAY );
+            stephistory_roll( now );
+            if ( counter < stephistory_state.counter ) {
+                stephistory_state.counter = counter;
+            }
+            steps = counter - stephistory_state.counter;
+            stephistory_state.counter = counter;
+            if ( steps ) {
+                uint16_t *minute = &stephistory_minutes[ stephistory_minute % STEPHISTORY_MINUTES ];
+                *minute = ( *minute + steps > 0xffff ) ? 0xffff : *minute + steps;
+                stephistory_state.hour.steps += steps;
+                stephistory_state.day.steps += steps;
+                stephistory_stats.steps += steps;
+            }
+            flush = stephistory_state.pending_hour_count >= STEPHISTORY_FLUSH_HOURS || stephistory_state.pending_day_count;
+            xSemaphoreGive( stephistory_mutex );
+            break;
+        case BMACTL_ACTIVITY:
+            xSemaphoreTake( stephistory_mutex, portMAX_DELAY );
+            stephistory_roll( now );
+            stephistory_add_activity( (bma_activity_event_t *)arg );
+            flush = stephistory_state.pending_hour_count >= STEPHISTORY_FLUSH_HOURS || stephistory_state.pending_day_count;
+            xSemaphoreGive( stephistory_mutex );
+            break;
+    }
+
+    if ( flush ) {
+        stephistory_flush();
+    }
+    return( true );
+}
+
+/*
+ * count the minute into its buckets, the bma sends it when the first window of the
+ * next minute is classified, so the last minute of an hour arrives after the hour is closed
+ */
+static void stephistory_add_activity( bma_activity_event_t *event ) {
+    uint32_t minute = event->time / 60;
+
+    if ( minute > stephistory_minute || minute + STEPHISTORY_MINUTES <= stephistory_minute ) {
+        return;
+    }
+    stephistory_minute_activity[ minute % STEPHISTORY_MINUTES ] = event->activity + 1;
+    stephistory_stats.minutes++;
+
+    for ( int resolution = STEPHISTORY_HOUR ; resolution < STEPHISTORY_RESOLUTION_NUM ; resolution++ ) {
+        stephistory_bucket_t *bucket = stephistory_get_bucket( resolution, stephistory_bucket_start( resolution, event->time ) );
+        if ( bucket == NULL ) {
+            continue;
+        }
+        if ( event->activity == ACTIVITY_WALK || event->activity == ACTIVITY_RUN ) {
+            bucket->active++;
+        }
+        else if ( event->activity == ACTIVITY_SLEEP ) {
+            bucket->sleep++;
+        }
+    }
+}
+
+/*
+ * get the running bucket or a closed one that is not on flash yet, a closed bucket
+ * without steps is added to the pending buckets, call with the mutex taken
+ */
+static stephistory_bucket_t *stephistory_get_bucket( int resolution, time_t start ) {
+    stephistory_bucket_t *running = resolution == STEPHISTORY_HOUR ? &stephistory_state.hour : &stephistory_state.day;
+    stephistory_bucket_t *pending = resolution == STEPHISTORY_HOUR ? stephistory_state.pending_hours : stephistory_state.pending_days;
+    uint32_t *count = resolution == STEPHISTORY_HOUR ? &stephistory_state.pending_hour_count : &stephistory_state.pending_day_count;
+    uint32_t max = resolution == STEPHISTORY_HOUR ? STEPHISTORY_FLUSH_HOURS : STEPHISTORY_PENDING_DAYS;
+
+    if ( (uint32_t)start == running->time ) {
+        return( running );
+    }
+    if ( (uint32_t)start > running->time ) {
+        return( NULL );
+    }
+    if ( *count && pending[ *count - 1 ].time == (uint32_t)start ) {
+        return( &pending[ *count - 1 ] );
+    }
+    if ( (uint32_t)start <= stephistory_last_time[ resolution ] || ( *count && pending[ *count - 1 ].time > (uint32_t)start ) || *count >= max ) {
+        return( NULL );
+    }
+    memset( &pending[ *count ], 0, sizeof( stephistory_bucket_t ) );
+    pending[ *count ].time = start;
+    return( &pending[ (*count)++ ] );
+}
+
+time_t stephistory_bucket_start( int resolution, time_t time ) {
+    struct tm info;
+
+    switch( resolution ) {
+        case STEPHISTORY_MINUTE:
+            return( time - time % 60 );
+        case STEPHISTORY_HOUR:
+            localtime_r( &time, &info );
+            return( time - info.tm_min * 60 - info.tm_sec );
+        default:
+            localtime_r( &time, &info );
+            return( time - info.tm_hour * 3600 - info.tm_min * 60 - info.tm_sec );
+    }
+}
+
+/*
+ * move the running buckets forward to now, call with the mutex taken
+ */
+static void stephistory_roll( time_t now ) {
+    uint32_t minute = now / 60;
+
+    if ( minute > stephistory_minute ) {
+        uint32_t gap = minute - stephistory_minute;
+        if ( gap > STEPHISTORY_MINUTES ) {
+            gap = STEPHISTORY_MINUTES;
+        }
+        for ( uint32_t i = 1 ; i <= gap ; i++ ) {
+            stephistory_minutes[ ( minute - gap + i ) % STEPHISTORY_MINUTES ] = 0;
+            stephistory_minute_activity[ ( minute - gap + i ) % STEPHISTORY_MINUTES ] = 0;
+        }
+    }
+    else if ( minute < stephistory_minute ) {
+        memset( stephistory_minutes, 0, STEPHISTORY_MINUTES * sizeof( uint16_t ) );
+        memset( stephistory_minute_activity, 0, STEPHISTORY_MINUTES * sizeof( uint8_t ) );
+    }
+    stephistory_minute = minute;
+
+    stephistory_close( &stephistory_state.hour, stephistory_bucket_start( STEPHISTORY_HOUR, now ), stephistory_state.pending_hours, &stephistory_state.pending_hour_count, STEPHISTORY_FLUSH_HOURS );
+    stephistory_close( &stephistory_state.day, stephistory_bucket_start( STEPHISTORY_DAY, now ), stephistory_state.pending_days, &stephistory_state.pending_day_count, STEPHISTORY_PENDING_DAYS );
+}
+
+static void stephistory_close( stephistory_bucket_t *bucket, time_t start, stephistory_bucket_t *pending, uint32_t *count, uint32_t max ) {
+    if ( bucket->time == (uint32_t)start ) {
+        return;
+    }
+    /*
+     * only buckets with steps or activity are stored, when the flash was not writeable the oldest pending bucket is lost
+     */
+    if ( bucket->steps || bucket->active || bucket->sleep ) {
+        if ( *count >= max ) {
+            log_e("stephistory pending buckets full, drop %d steps", pending[ 0 ].steps );
+            memmove( &pending[ 0 ], &pending[ 1 ], ( max - 1 ) * sizeof( stephistory_bucket_t ) );
+            *count = max - 1;
+        }
+        pending[ (*count)++ ] = *bucket;
+    }
+    bucket->time = start;
+    bucket->steps = 0;
+    bucket->active = 0;
+    bucket->sleep = 0;
+}
+
+void stephistory_flush( void ) {
+    if ( stephistory_mutex == NULL ) {
+        return;
+    }
+
+    xSemaphoreTake( stephistory_mutex, portMAX_DELAY );
+    if ( stephistory_state.pending_hour_count || stephistory_state.pending_day_count ) {
+        stephistory_append( STEPHISTORY_HOUR, stephistory_state.pending_hours, &stephistory_state.pending_hour_count );
+        stephistory_append( STEPHISTORY_DAY, stephistory_state.pending_days, &stephistory_state.pending_day_count );
+        stephistory_stats.flushes++;
+    }
+    xSemaphoreGive( stephistory_mutex );
+}
+
+/*
+ * append pending buckets in one write and rotate the file before it grows above max_records
+ */
+static bool stephistory_append( int resolution, stephistory_bucket_t *buckets, uint32_t *count ) {
+    const stephistory_store_t *store = &stephistory_store[ resolution ];
+    uint32_t records = 0;
+    uint32_t valid = 0;
+
+    if ( *count == 0 ) {
+        return( true );
+    }
+    /*
+     * the files are searched binary, so a bucket before the last one on flash
+     * after the time was set back is dropped
+     */
+    for ( uint32_t i = 0 ; i < *count ; i++ ) {
+        if ( buckets[ i ].time > stephistory_last_time[ resolution ] ) {
+            buckets[ valid++ ] = buckets[ i ];
+            stephistory_last_time[ resolution ] = buckets[ i ].time;
+        }
+        else {
+            log_e("stephistory drop bucket at %d, not after %d", buckets[ i ].time, stephistory_last_time[ resolution ] );
+        }
+    }
+
+    if ( valid == 0 ) {
+        *count = 0;
+        return( true );
+    }
+
+    if ( SPIFFS.exists( store->file ) ) {
+        fs::File file = SPIFFS.open( store->file, FILE_READ );
+        records = file.size() / sizeof( stephistory_bucket_t );
+        file.close();
+    }
+    if ( records + valid > store->max_records ) {
+        SPIFFS.remove( store->old_file );
+        SPIFFS.rename( store->file, store->old_file );
+        stephistory_stats.rotations++;
+    }
+
+    fs::File file = SPIFFS.open( store->file, FILE_APPEND );
+    if ( !file ) {
+        log_e("Can't open file: %s!", store->file );
+        *count = valid;
+        return( false );
+    }
+    bool retval = file.write( (uint8_t *)buckets, valid * sizeof( stephistory_bucket_t ) ) == valid * sizeof( stephistory_bucket_t );
+    file.close();
+
+    if ( retval ) {
+        stephistory_stats.records += valid;
+        *count = 0;
+    }
+    else {
+        log_e("Failed to append to step history file: %s!", store->file );
+        *count = valid;
+    }
+    return( retval );
+}
+
+static bool stephistory_read_record( fs::File &file, uint32_t index, stephistory_bucket_t *bucket ) {
+    if ( !file.seek( index * sizeof( stephistory_bucket_t ) ) ) {
+        return( false );
+    }
+    return( file.read( (uint8_t *)bucket, sizeof( stephistory_bucket_t ) ) == sizeof( stephistory_bucket_t ) );
+}
+
+static uint32_t stephistory_read_last_time( int resolution ) {
+    const stephistory_store_t *store = &stephistory_store[ resolution ];
+    const char *files[ 2 ] = { store->file, store->old_file };
+    stephistory_bucket_t bucket;
+
+    for ( int i = 0 ; i < 2 ; i++ ) {
+        if ( !SPIFFS.exists( files[ i ] ) ) {
+            continue;
+        }
+        fs::File file = SPIFFS.open( files[ i ], FILE_READ );
+        uint32_t records = file.size() / sizeof( stephistory_bucket_t );
+        bool found = records && stephistory_read_record( file, records - 1, &bucket );
+        file.close();
+        if ( found ) {
+            return( bucket.time );
+        }
+    }
+    return( 0 );
+}
+
+size_t stephistory_query( int resolution, time_t from, time_t to, stephistory_bucket_t *buckets, size_t max ) {
+    uint64_t start = esp_timer_get_time();
+    size_t count = 0;
+    time_t now;
+
+    if ( stephistory_mutex == NULL || resolution < 0 || resolution >= STEPHISTORY_RESOLUTION_NUM ) {
+        return( 0 );
+    }
+    uint32_t first = from > 0 ? from : 0;
+
+    time( &now );
+    xSemaphoreTake( stephistory_mutex, portMAX_DELAY );
+    if ( now >= STEPHISTORY_VALID_TIME ) {
+        stephistory_roll( now );
+    }
+
+    switch( resolution ) {
+        case STEPHISTORY_MINUTE:
+            /*
+             * the ring holds the minutes up to the last update
+             */
+            for ( uint32_t minute = stephistory_minute - STEPHISTORY_MINUTES + 1 ; minute <= stephistory_minute && count < max ; minute++ ) {
+                uint16_t steps = stephistory_minutes[ minute % STEPHISTORY_MINUTES ];
+                uint8_t activity = stephistory_minute_activity[ minute % STEPHISTORY_MINUTES ];
+                if ( ( steps || activity ) && minute * 60 >= first && minute * 60 <= to ) {
+                    buckets[ count ].time = minute * 60;
+                    buckets[ count ].steps = steps;
+                    buckets[ count ].active = activity == ACTIVITY_WALK + 1 || activity == ACTIVITY_RUN + 1;
+                    buckets[ count ].sleep = activity == ACTIVITY_SLEEP + 1;
+                    count++;
+                }
+            }
+            break;
+        case STEPHISTORY_HOUR:
+            count += stephistory_query_file( STEPHISTORY_HOUR_OLD_FILE, first, to, &buckets[ count ], max - count );
+            count += stephistory_query_file( STEPHISTORY_HOUR_FILE, first, to, &buckets[ count ], max - count );
+            count += stephistory_query_ram( stephistory_state.pending_hours, stephistory_state.pending_hour_count, first, to, &buckets[ count ], max - count );
+            count += stephistory_query_ram( &stephistory_state.hour, 1, first, to, &buckets[ count ], max - count );
+            break;
+        case STEPHISTORY_DAY:
+            count += stephistory_query_file( STEPHISTORY_DAY_OLD_FILE, first, to, &buckets[ count ], max - count );
+            count += stephistory_query_file( STEPHISTORY_DAY_FILE, first, to, &buckets[ count ], max - count );
+            count += stephistory_query_ram( stephistory_state.pending_days, stephistory_state.pending_day_count, first, to, &buckets[ count ], max - count );
+            count += stephistory_query_ram( &stephistory_state.day, 1, first, to, &buckets[ count ], max - count );
+            break;
+    }
+
+    uint32_t time = esp_timer_get_time() - start;
+    stephistory_stats.queries++;
+    if ( time > stephistory_stats.query_time_max ) {
+        stephistory_stats.query_time_max = time;
+    }
+    xSemaphoreGive( stephistory_mutex );
+
+    return( count );
+}
+
+/*
+ * binary search the first bucket at or after first, then read sequential up to to
+ */
+static size_t stephistory_query_file( const char *filename, uint32_t first, time_t to, stephistory_bucket_t *buckets, size_t max ) {
+    stephistory_bucket_t bucket;
+    size_t count = 0;
+
+    if ( max == 0 || !SPIFFS.exists( filename ) ) {
+        return( 0 );
+    }
+
+    fs::File file = SPIFFS.open( filename, FILE_READ );
+    if ( !file ) {
+        return( 0 );
+    }
+    uint32_t records = file.size() / sizeof( stephistory_bucket_t );
+    uint32_t low = 0;
+    uint32_t high = records;
+
+    while ( low < high ) {
+        uint32_t mid = ( low + high ) / 2;
+        if ( !stephistory_read_record( file, mid, &bucket ) ) {
+            break;
+        }
+        if ( bucket.time < first ) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    if ( low < records && file.seek( low * sizeof( stephistory_bucket_t ) ) ) {
+        while ( count < max && file.read( (uint8_t *)&bucket, sizeof( bucket ) ) == sizeof( bucket ) ) {
+            if ( (time_t)bucket.time > to ) {
+                break;
+            }
+            buckets[ count++ ] = bucket;
+        }
+    }
+    file.close();
+
+    return( count );
+}
+
+static size_t stephistory_query_ram( stephistory_bucket_t *ram, uint32_t count, uint32_t first, time_t to, stephistory_bucket_t *buckets, size_t max ) {
+    size_t n = 0;
+
+    for ( uint32_t i = 0 ; i < count && n < max ; i++ ) {
+        if ( ( ram[ i ].steps || ram[ i ].active || ram[ i ].sleep ) && ram[ i ].time >= first && (time_t)ram[ i ].time <= to ) {
+            buckets[ n++ ] = ram[ i ];
+        }
+    }
+    return( n );
+}
+
+stephistory_stats_t *stephistory_get_stats( void ) {
+    return( &stephistory_stats );
+}
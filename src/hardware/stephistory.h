@@ -0,0 +1,109 @@
+/****************************************************************************
+ *   Oct 29 21:07:44 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _STEPHISTORY_H
+    #define _STEPHISTORY_H
+
+    #include "TTGO.h"
+
+    #define STEPHISTORY_HOUR_FILE           "/activity_hour.bin"
+    #define STEPHISTORY_HOUR_OLD_FILE       "/activity_hour.old"
+    #define STEPHISTORY_DAY_FILE            "/activity_day.bin"
+    #define STEPHISTORY_DAY_OLD_FILE        "/activity_day.old"
+    #define STEPHISTORY_V1_HOUR_FILE        "/steps_hour.bin"   // steps only records, converted on setup
+    #define STEPHISTORY_V1_HOUR_OLD_FILE    "/steps_hour.old"
+    #define STEPHISTORY_V1_DAY_FILE         "/steps_day.bin"
+    #define STEPHISTORY_V1_DAY_OLD_FILE     "/steps_day.old"
+    #define STEPHISTORY_MAGIC               0x56544341      // "ACTV" little endian, marks a valid running state after reset
+    #define STEPHISTORY_MINUTES             1440            // minutes hold in the PSRAM ring, one day
+    #define STEPHISTORY_FLUSH_HOURS         6               // closed hours collected before they are appended to flash
+    #define STEPHISTORY_PENDING_DAYS        2               // closed days hold in RAM, a closed day is appended at once
+    #define STEPHISTORY_HOUR_MAX_RECORDS    1488            // 62 days of hours per file, rotate to STEPHISTORY_HOUR_OLD_FILE above this
+    #define STEPHISTORY_DAY_MAX_RECORDS     732             // two years of days per file, rotate to STEPHISTORY_DAY_OLD_FILE above this
+    #define STEPHISTORY_VALID_TIME          1577836800      // 2020-01-01, earlier times are not synced and not recorded
+
+    enum {
+        STEPHISTORY_MINUTE = 0,
+        STEPHISTORY_HOUR,
+        STEPHISTORY_DAY,
+        STEPHISTORY_RESOLUTION_NUM
+    };
+
+    /**
+     * one bucket, on flash a plain array of them sorted by time, only buckets with steps or activity are stored
+     */
+    typedef struct __attribute__((packed)) {
+        uint32_t time;                  // unix time of the bucket start, hours and days in local time
+        uint32_t steps;
+        uint16_t active;                // minutes walking or running, see hardware/activity.h
+        uint16_t sleep;                 // minutes asleep
+    } stephistory_bucket_t;
+
+    typedef struct {
+        uint32_t steps;                 // steps recorded since boot
+        uint32_t minutes;               // activity minutes recorded since boot
+        uint32_t flushes;               // batched appends to flash
+        uint32_t records;               // buckets written to flash
+        uint32_t rotations;
+        uint32_t queries;
+        uint32_t query_time_max;        // us
+    } stephistory_stats_t;
+
+    /**
+     * @brief setup step history, take the steps from the bma stepcounter event and the
+     * active and sleep minutes from the bma activity event
+     */
+    void stephistory_setup( void );
+    /**
+     * @brief get the steps of a time range in one resolution, the minute resolution covers only the last
+     * STEPHISTORY_MINUTES. flash is searched binary, only the requested buckets are read
+     * 
+     * @param   resolution  STEPHISTORY_MINUTE, STEPHISTORY_HOUR or STEPHISTORY_DAY
+     * @param   from        unix time, first bucket start
+     * @param   to          unix time, last bucket start
+     * @param   buckets     pointer to the bucket array
+     * @param   max         size of the bucket array
+     * 
+     * @return  number of buckets with steps or activity, sorted by time
+     */
+    size_t stephistory_query( int resolution, time_t from, time_t to, stephistory_bucket_t *buckets, size_t max );
+    /**
+     * @brief get the local start time of a bucket
+     * 
+     * @param   resolution  STEPHISTORY_MINUTE, STEPHISTORY_HOUR or STEPHISTORY_DAY
+     * @param   time        unix time
+     * 
+     * @return  unix time of the bucket start that contains time
+     */
+    time_t stephistory_bucket_start( int resolution, time_t time );
+    /**
+     * @brief append all closed buckets to flash, the running hour and day survive a
+     * reset in RAM and are written when they are closed
+     */
+    void stephistory_flush( void );
+    /**
+     * @brief get step history statistics
+     * 
+     * @return  pointer to stephistory_stats_t
+     */
+    stephistory_stats_t *stephistory_get_stats( void );
+
+#endif // _STEPHISTORY_H
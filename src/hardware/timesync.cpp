@@ -28,12 +28,13 @@
 #include "timesync.h"
 #include "powermgm.h"
 #include "json_psram_allocator.h"
+#include "config_store.h"
+#include "jobqueue.h"
 
 EventGroupHandle_t time_event_handle = NULL;
-TaskHandle_t _timesync_Task;
 timesync_config_t timesync_config;
 
-void timesync_Task( void * pvParameters );
+static void timesync_job( void *arg );
 bool timesync_powermgm_event_cb( EventBits_t event, void *arg );
 bool timesync_wifictl_event_cb( EventBits_t event, void *arg );
 
@@ -75,52 +76,21 @@ bool timesync_wifictl_event_cb( EventBits_t event, void *arg ) {
     switch ( event ) {
         case WIFICTL_CONNECT:       
             if ( timesync_config.timesync ) {
-            if ( xEventGroupGetBits( time_event_handle ) & TIME_SYNC_REQUEST ) {
-                break;
+                jobqueue_submit( timesync_job, NULL, JOBQUEUE_PRIO_HIGH, JOBQUEUE_NETWORK, "timesync" );
             }
-            else {
-                xEventGroupSetBits( time_event_handle, TIME_SYNC_REQUEST );
-                xTaskCreate(  timesync_Task,      /* Function to implement the task */
-                            "timesync Task",    /* Name of the task */
-                            2000,              /* Stack size in words */
-                            NULL,               /* Task input parameter */
-                            1,                  /* Priority of the task */
-                            &_timesync_Task );  /* Task handle. */
-            }
-        }
-        break;
+            break;
     }
     return( true );
 }
 
 void timesync_save_config( void ) {
-    if ( SPIFFS.exists( TIMESYNC_CONFIG_FILE ) ) {
-        SPIFFS.remove( TIMESYNC_CONFIG_FILE );
-        log_i("remove old binary timesync config");
-    }
-
-    fs::File file = SPIFFS.open( TIMESYNC_JSON_CONFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", TIMESYNC_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 1000 );
-
-        doc["daylightsave"] = timesync_config.daylightsave;
-        doc["timesync"] = timesync_config.timesync;
-        doc["timezone"] = timesync_config.timezone;
-        doc["use_24hr_clock"] = timesync_config.use_24hr_clock;
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &timesync_config );
 }
 
-void timesync_read_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void timesync_read_json_config( void ) {
     if ( SPIFFS.exists( TIMESYNC_JSON_CONFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( TIMESYNC_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -167,6 +137,10 @@ void timesync_read_config( void ) {
     }
 }
 
+void timesync_read_config( void ) {
+    config_store_register( "timesync", &timesync_config, sizeof( timesync_config ), timesync_read_json_config );
+}
+
 bool timesync_get_timesync( void ) {
     return( timesync_config.timesync );
 }
@@ -213,28 +187,24 @@ void timesyncToRTC( void ) {
   ttgo->rtc->syncToRtc();
 }
 
-void timesync_Task( void * pvParameters ) {
-  log_i("start time sync task, heap: %d", ESP.getFreeHeap() );
+static void timesync_job( void *arg ) {
+  struct tm info;
 
-  if ( xEventGroupGetBits( time_event_handle ) & TIME_SYNC_REQUEST ) {   
-    struct tm info;
+  log_i("start time sync job, heap: %d", ESP.getFreeHeap() );
 
-    long gmtOffset_sec = timesync_config.timezone * 3600;
-    int daylightOffset_sec = 0;
-    
-    if ( timesync_config.daylightsave )
-      daylightOffset_sec = 3600;
-            
-    configTime( gmtOffset_sec, daylightOffset_sec, "pool.ntp.org" );
+  long gmtOffset_sec = timesync_config.timezone * 3600;
+  int daylightOffset_sec = 0;
+  
+  if ( timesync_config.daylightsave )
+    daylightOffset_sec = 3600;
+          
+  configTime( gmtOffset_sec, daylightOffset_sec, "pool.ntp.org" );
 
-    if( !getLocalTime( &info ) ) {
-        log_e("Failed to obtain time" );
-    }
-    else {
-        xEventGroupSetBits( time_event_handle, TIME_SYNC_OK );
-    }
+  if( !getLocalTime( &info ) ) {
+      log_e("Failed to obtain time" );
+  }
+  else {
+      xEventGroupSetBits( time_event_handle, TIME_SYNC_OK );
   }
-  xEventGroupClearBits( time_event_handle, TIME_SYNC_REQUEST );
-  log_i("finish time sync task, heap: %d", ESP.getFreeHeap() );
-  vTaskDelete( NULL );
+  log_i("finish time sync job, heap: %d", ESP.getFreeHeap() );
 }
@@ -24,7 +24,6 @@
 
     #include <TTGO.h>
 
-    #define TIME_SYNC_REQUEST       _BV(0)
     #define TIME_SYNC_OK            _BV(1)
 
     #define TIMESYNC_CONFIG_FILE        "/timesync.cfg"
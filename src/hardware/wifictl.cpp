@@ -28,6 +28,7 @@
 #include "wifictl.h"
 #include "powermgm.h"
 #include "callback.h"
+#include "config_store.h"
 #include "json_psram_allocator.h"
 
 #include "gui/statusbar.h"
@@ -194,39 +195,14 @@ bool wifictl_powermgm_event_cb( EventBits_t event, void *arg ) {
 }
 
 void wifictl_save_config( void ) {
-    if ( SPIFFS.exists( WIFICTL_CONFIG_FILE ) ) {
-        SPIFFS.remove( WIFICTL_CONFIG_FILE );
-        log_i("remove old binary wificfg config");
-    }
-    if ( SPIFFS.exists( WIFICTL_LIST_FILE ) ) {
-        SPIFFS.remove( WIFICTL_LIST_FILE );
-        log_i("remove old binary wifilist config");
-    }
-
-    fs::File file = SPIFFS.open( WIFICTL_JSON_CONFIG_FILE, FILE_WRITE );
-
-    if (!file) {
-        log_e("Can't open file: %s!", WIFICTL_JSON_CONFIG_FILE );
-    }
-    else {
-        SpiRamJsonDocument doc( 10000 );
-
-        doc["autoon"] = wifictl_config.autoon;
-        doc["webserver"] = wifictl_config.webserver;
-        for ( int i = 0 ; i < NETWORKLIST_ENTRYS ; i++ ) {
-            doc["networklist"][ i ]["ssid"] = wifictl_networklist[ i ].ssid;
-            doc["networklist"][ i ]["psk"] = wifictl_networklist[ i ].password;
-        }
-
-        if ( serializeJsonPretty( doc, file ) == 0) {
-            log_e("Failed to write config file");
-        }
-        doc.clear();
-    }
-    file.close();
+    config_store_save( &wifictl_config );
+    config_store_save( wifictl_networklist );
 }
 
-void wifictl_load_config( void ) {
+/*
+ * read the json config from older firmware, see config_store_register()
+ */
+static void wifictl_load_json_config( void ) {
     if ( SPIFFS.exists( WIFICTL_JSON_CONFIG_FILE ) ) {        
         fs::File file = SPIFFS.open( WIFICTL_JSON_CONFIG_FILE, FILE_READ );
         if (!file) {
@@ -278,6 +254,14 @@ void wifictl_load_config( void ) {
     }
 }
 
+void wifictl_load_config( void ) {
+    /*
+     * the json config contains both, so the network list is migrated together with the config
+     */
+    config_store_register( "wifilist", wifictl_networklist, sizeof( networklist ) * NETWORKLIST_ENTRYS, NULL );
+    config_store_register( "wifictl", &wifictl_config, sizeof( wifictl_config ), wifictl_load_json_config );
+}
+
 bool wifictl_get_autoon( void ) {
   return( wifictl_config.autoon );
 }
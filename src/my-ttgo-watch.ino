@@ -30,6 +30,8 @@
 #include "gui/gui.h"
 #include "gui/splashscreen.h"
 #include "gui/screenshot.h"
+#include "gui/mirror.h"
+#include "gui/img_decoder.h"
 
 #include "hardware/display.h"
 #include "hardware/powermgm.h"
@@ -40,6 +42,13 @@
 #include "hardware/timesync.h"
 #include "hardware/sound.h"
 #include "hardware/framebuffer.h"
+#include "hardware/json_msg.h"
+#include "hardware/config_store.h"
+#include "hardware/http_cache.h"
+#include "hardware/http_pool.h"
+#include "hardware/jobqueue.h"
+#include "hardware/callback.h"
+#include "hardware/eventlog.h"
 
 #include "app/weather/weather.h"
 #include "app/stopwatch/stopwatch_app.h"
@@ -49,6 +58,7 @@
 #include "app/osmand/osmand_app.h"
 #include "app/IRController/IRController.h"
 #include "app/powermeter/powermeter_app.h"
+#include "app/activity/activity_app.h"
 
 TTGOClass *ttgo = TTGOClass::getWatch();
 
@@ -62,12 +72,19 @@ void setup()
     ttgo->lvgl_begin();
 
     SPIFFS.begin();
+    config_store_setup();
+    http_cache_setup();
+    http_pool_setup();
+    jobqueue_setup();
     motor_setup();
 
     // force to store all new heap allocations in psram to get more internal ram
     heap_caps_malloc_extmem_enable( 1 );
     display_setup();
+    framebuffer_setup();
     screenshot_setup();
+    mirror_setup();
+    img_decoder_setup();
 
     splash_screen_stage_one();
     splash_screen_stage_update( "init serial", 10 );
@@ -90,6 +107,8 @@ void setup()
     timesyncToSystem();
     splash_screen_stage_update( "init powermgm", 60 );
     powermgm_setup();
+    eventlog_setup();
+    json_msg_setup();
     splash_screen_stage_update( "init gui", 80 );
     splash_screen_stage_finish();
     
@@ -106,6 +125,7 @@ void setup()
     osmand_app_setup();
     IRController_setup();
     powermeter_app_setup();
+    activity_app_setup();
     /*
      *
      */
@@ -116,11 +136,18 @@ void setup()
     heap_caps_malloc_extmem_enable( 16*1024 );
     blectl_setup();
     sound_setup();
+    /*
+     * all callbacks are registered, build the event indexes
+     */
+    callback_freeze();
 
     display_set_brightness( display_get_brightness() );
 
+    uint32_t setup_time = millis();
+
     delay(500);
 
+    Serial.printf("Setup time: %dms\r\n", setup_time );
     Serial.printf("Total heap: %d\r\n", ESP.getHeapSize());
     Serial.printf("Free heap: %d\r\n", ESP.getFreeHeap());
     Serial.printf("Total PSRAM: %d\r\n", ESP.getPsramSize());
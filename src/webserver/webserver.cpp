@@ -30,72 +30,561 @@
 #include <ESP32SSDP.h>
 
 #include "webserver.h"
+#include "webserver_response.h"
 #include "config.h"
 #include "gui/screenshot.h"
+#include "gui/mirror.h"
+#include "hardware/framebuffer.h"
+#include "hardware/blectl.h"
+#include "hardware/pmu.h"
+#include "hardware/powermgm.h"
+#include "hardware/callback.h"
+#include "hardware/eventlog.h"
+#include "hardware/config_store.h"
+#include "hardware/http_cache.h"
+#include "hardware/http_pool.h"
+#include "hardware/i2cctl.h"
+#include "hardware/jobqueue.h"
+#include "hardware/stephistory.h"
+#include "hardware/bma.h"
 
 AsyncWebServer asyncserver( WEBSERVERPORT );
+AsyncWebSocket mirror_ws( "/mirror" );
 TaskHandle_t _WEBSERVER_Task;
 
+/*
+ * stream a screenshot strip by strip as chunked response, nothing is stored in spiffs
+ */
+static void webserver_send_screenshot( AsyncWebServerRequest *request, bool compress ) {
+  if ( !screenshot_stream_start( compress ) ) {
+    request->send(503, "text/plain", "screenshot in progress\r\n" );
+    return;
+  }
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse( "application/octet-stream", []( uint8_t *buffer, size_t maxLen, size_t index ) -> size_t {
+    size_t len = screenshot_stream_read( buffer, maxLen );
+    return( len == SCREENSHOT_STREAM_TRY_AGAIN ? RESPONSE_TRY_AGAIN : len );
+  });
+  response->addHeader( "Content-Disposition", compress ? "inline; filename=\"screen.rle\"" : "inline; filename=\"screen.data\"" );
+  request->onDisconnect( []() {
+    screenshot_stream_stop();
+  });
+  request->send( response );
+}
+
+/*
+ * export the step history as json, the buckets are queried in small batches while the response is sent
+ */
+typedef struct {
+  int resolution;
+  time_t from;
+  time_t to;
+  bool first;
+  bool last;
+  bool done;
+  stephistory_bucket_t buckets[ 16 ];
+  size_t count;
+  size_t pos;
+} webserver_steps_t;
+
+static void webserver_send_steps( AsyncWebServerRequest *request ) {
+  static const char *resolution[ STEPHISTORY_RESOLUTION_NUM ] = { "minute", "hour", "day" };
+  webserver_steps_t state;
+  time_t now;
+
+  time( &now );
+  memset( &state, 0, sizeof( state ) );
+  state.resolution = STEPHISTORY_HOUR;
+  state.from = now - 7 * 86400;
+  state.to = now;
+  state.first = true;
+
+  if ( request->hasParam( "res" ) ) {
+    state.resolution = -1;
+    for ( int i = 0 ; i < STEPHISTORY_RESOLUTION_NUM ; i++ ) {
+      if ( request->getParam( "res" )->value() == resolution[ i ] ) {
+        state.resolution = i;
+      }
+    }
+    if ( state.resolution < 0 ) {
+      request->send(400, "text/plain", "res must be minute, hour or day\r\n" );
+      return;
+    }
+  }
+  if ( request->hasParam( "from" ) )
+    state.from = request->getParam( "from" )->value().toInt();
+  if ( request->hasParam( "to" ) )
+    state.to = request->getParam( "to" )->value().toInt();
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse( "application/json", [ state ]( uint8_t *buffer, size_t maxLen, size_t index ) mutable -> size_t {
+    char line[ 48 ];
+    size_t len = 0;
+
+    if ( index == 0 ) {
+      len = snprintf( (char*)buffer, maxLen, "{\"resolution\":\"%s\",\"steps\":[", resolution[ state.resolution ] );
+    }
+    while ( !state.done ) {
+      if ( state.pos >= state.count && !state.last ) {
+        state.count = stephistory_query( state.resolution, state.from, state.to, state.buckets, sizeof( state.buckets ) / sizeof( stephistory_bucket_t ) );
+        state.pos = 0;
+        if ( state.count == 0 ) {
+          state.last = true;
+        }
+        else {
+          state.from = state.buckets[ state.count - 1 ].time + 1;
+        }
+      }
+      if ( state.last ) {
+        if ( len + 3 > maxLen )
+          break;
+        memcpy( &buffer[ len ], "]}\n", 3 );
+        len += 3;
+        state.done = true;
+        break;
+      }
+      size_t n = snprintf( line, sizeof( line ), "%s[%u,%u,%u,%u]", state.first ? "" : ",", state.buckets[ state.pos ].time, state.buckets[ state.pos ].steps,
+                           state.buckets[ state.pos ].active, state.buckets[ state.pos ].sleep );
+      if ( len + n > maxLen )
+        break;
+      memcpy( &buffer[ len ], line, n );
+      len += n;
+      state.first = false;
+      state.pos++;
+    }
+    return( len );
+  });
+  request->send( response );
+}
+
+/*
+ * export the motion ring as csv for tools/activity_bench.cpp, an optional label is appended to every line
+ */
+typedef struct {
+  uint32_t seq;
+  uint32_t last;
+  int16_t xyz[ 16 * 3 ];
+  size_t count;
+  size_t pos;
+  char label[ 8 ];
+} webserver_motion_t;
+
+static void webserver_send_motion( AsyncWebServerRequest *request ) {
+  webserver_motion_t state;
+
+  memset( &state, 0, sizeof( state ) );
+  if ( !bma_get_motion_range( &state.seq, &state.last ) ) {
+    request->send(503, "text/plain", "no motion ring\r\n" );
+    return;
+  }
+  if ( request->hasParam( "label" ) )
+    strlcpy( state.label, request->getParam( "label" )->value().c_str(), sizeof( state.label ) );
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse( "text/csv", [ state ]( uint8_t *buffer, size_t maxLen, size_t index ) mutable -> size_t {
+    char line[ 32 ];
+    size_t len = 0;
+
+    if ( index == 0 ) {
+      len = snprintf( (char*)buffer, maxLen, "# x,y,z in mg at %d.%dHz, %d samples\n", ACTIVITY_RATE_MHZ / 1000, ACTIVITY_RATE_MHZ % 1000 / 100, state.last - state.seq );
+    }
+    while ( true ) {
+      if ( state.pos >= state.count ) {
+        if ( state.seq >= state.last )
+          break;
+        size_t max = sizeof( state.xyz ) / sizeof( int16_t ) / 3;
+        if ( state.last - state.seq < max )
+          max = state.last - state.seq;
+        state.count = bma_get_motion( state.seq, state.xyz, max );
+        state.pos = 0;
+        state.seq += max;
+        if ( state.count == 0 )
+          continue;
+      }
+      int16_t *xyz = &state.xyz[ state.pos * 3 ];
+      size_t n = snprintf( line, sizeof( line ), state.label[ 0 ] ? "%d,%d,%d,%s\n" : "%d,%d,%d\n", xyz[ 0 ], xyz[ 1 ], xyz[ 2 ], state.label );
+      if ( len + n > maxLen )
+        break;
+      memcpy( &buffer[ len ], line, n );
+      len += n;
+      state.pos++;
+    }
+    return( len );
+  });
+  response->addHeader( "Content-Disposition", "inline; filename=\"motion.csv\"" );
+  request->send( response );
+}
+
+/*
+ * the first client starts the screen mirror, the last one stops it
+ */
+static bool webserver_mirror_send( const uint8_t *data, size_t len ) {
+  if ( !mirror_ws.availableForWriteAll() ) {
+    return( false );
+  }
+  mirror_ws.binaryAll( (uint8_t*)data, len );
+  return( true );
+}
+
+static void webserver_mirror_event( AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len ) {
+  switch( type ) {
+    case WS_EVT_CONNECT:    log_i("mirror client #%u connected from %s", client->id(), client->remoteIP().toString().c_str() );
+                            mirror_start( webserver_mirror_send );
+                            break;
+    case WS_EVT_DISCONNECT: log_i("mirror client #%u disconnected", client->id() );
+                            if ( server->count() == 0 ) {
+                              mirror_stop();
+                            }
+                            break;
+    default:                break;
+  }
+}
+
+static const char info_tpl[] =
+  "<html><head><meta charset=\"utf-8\"></head><body><h3>Information</h3>"
+  "<b><u>Memory</u></b><br>"
+  "<b>Heap size: </b>%heap_size%<br>"
+  "<b>Heap free: </b>%heap_free%<br>"
+  "<b>Heap free min: </b>%heap_free_min%<br>"
+  "<b>Psram size: </b>%psram_size%<br>"
+  "<b>Psram free: </b>%psram_free%<br>"
+
+  "<br><b><u>System</u></b><br>"
+  "\t<b>Battery voltage: </b>%battery_voltage% Volts<br>"
+  "\t<b>Uptime: </b>%uptime%<br>"
+
+  "<br><b><u>Display</u></b><br>"
+  "<b>Framerate: </b>%framerate% fps<br>"
+  "<b>Flush latency: </b>%flush_latency% us (max %flush_latency_max% us)<br>"
+
+  "<br><b><u>Bluetooth</u></b><br>"
+  "<b>MTU: </b>%ble_mtu%<br>"
+  "<b>Messages send: </b>%ble_msg_send% (abort %ble_msg_abort%)<br>"
+  "<b>Throughput: </b>%ble_throughput% bytes/s (%ble_bytes% bytes in %ble_chunks% chunks)<br>"
+  "<b>Congested: </b>%ble_congested% (timeouts %ble_timeouts%, unsubscribed %ble_unsubscribed%)<br>"
+  "<b>Queue depth: </b>%ble_queue_depth% (max %ble_queue_depth_max%)<br>"
+  "<b>Send task stack free: </b>%ble_stack_free% bytes<br>"
+
+  "<br><b><u>Chip</u></b>"
+  "<br><b>SdkVersion: </b>%sdk_version%<br>"
+  "<b>CpuFreq: </b>%cpu_freq% MHz<br>"
+
+  "<br><b><u>Flash</u></b><br>"
+  "<b>FlashChipSpeed: </b>%flash_speed% MHz<br>"
+  "<b>Flash mode: </b>%flash_mode%</b><br>"
+  "<b>Flash sector size: </b>%flash_sector_size%<br>"
+  "<b>FlashChipMode: </b>%flash_chip_mode%<br>"
+  "<b>FlashChipSize (SDK): </b>%flash_size%<br>"
+
+  "<br><b><u>Firmware</u></b><br>"
+  "<b>SketchSpace free: </b>%sketch_free%<br>"
+  "<b>BuildTime: </b>" __DATE__ " " __TIME__ "<br>"
+  "<b>Version: </b>" __FIRMWARE__ "<br>"
+  "<b>GCC-Version: </b>" __VERSION__ "<br>"
+  "<b>SketchMD5: </b>%sketch_md5%<br>"
+
+  "<br><b><u>Filesystem</u></b><br>"
+  "<b>Total size: </b>%spiffs_total%<br>"
+  "<b>Used size: </b>%spiffs_used%<br>"
+
+  "<br>";
+
+static bool webserver_info_field( const char *field, uint32_t index, char *buf, size_t size ) {
+  blectl_stats_t ble;
+
+  blectl_get_stats( &ble );
+
+  if ( !strcmp( field, "heap_size" ) )                snprintf( buf, size, "%d", ESP.getHeapSize() );
+  else if ( !strcmp( field, "heap_free" ) )           snprintf( buf, size, "%d", ESP.getFreeHeap() );
+  else if ( !strcmp( field, "heap_free_min" ) )       snprintf( buf, size, "%d", ESP.getMinFreeHeap() );
+  else if ( !strcmp( field, "psram_size" ) )          snprintf( buf, size, "%d", ESP.getPsramSize() );
+  else if ( !strcmp( field, "psram_free" ) )          snprintf( buf, size, "%d", ESP.getFreePsram() );
+  else if ( !strcmp( field, "battery_voltage" ) )     snprintf( buf, size, "%.2f", pmu_get_battery_voltage() / 1000 );
+  else if ( !strcmp( field, "uptime" ) )              snprintf( buf, size, "%lu", millis() / 1000 );
+  else if ( !strcmp( field, "framerate" ) )           snprintf( buf, size, "%d", framebuffer_get_framerate() );
+  else if ( !strcmp( field, "flush_latency" ) )       snprintf( buf, size, "%d", framebuffer_get_flush_latency() );
+  else if ( !strcmp( field, "flush_latency_max" ) )   snprintf( buf, size, "%d", framebuffer_get_flush_latency_max() );
+  else if ( !strcmp( field, "ble_mtu" ) )             snprintf( buf, size, "%d", ble.mtu );
+  else if ( !strcmp( field, "ble_msg_send" ) )        snprintf( buf, size, "%d", ble.msg_send );
+  else if ( !strcmp( field, "ble_msg_abort" ) )       snprintf( buf, size, "%d", ble.msg_abort );
+  else if ( !strcmp( field, "ble_throughput" ) )      snprintf( buf, size, "%d", ble.throughput );
+  else if ( !strcmp( field, "ble_bytes" ) )           snprintf( buf, size, "%d", ble.bytes );
+  else if ( !strcmp( field, "ble_chunks" ) )          snprintf( buf, size, "%d", ble.chunks );
+  else if ( !strcmp( field, "ble_congested" ) )       snprintf( buf, size, "%d", ble.congested );
+  else if ( !strcmp( field, "ble_timeouts" ) )        snprintf( buf, size, "%d", ble.timeouts );
+  else if ( !strcmp( field, "ble_unsubscribed" ) )    snprintf( buf, size, "%d", ble.unsubscribed );
+  else if ( !strcmp( field, "ble_queue_depth" ) )     snprintf( buf, size, "%d", ble.queue_depth );
+  else if ( !strcmp( field, "ble_queue_depth_max" ) ) snprintf( buf, size, "%d", ble.queue_depth_max );
+  else if ( !strcmp( field, "ble_stack_free" ) )      snprintf( buf, size, "%d", ble.stack_free );
+  else if ( !strcmp( field, "sdk_version" ) )         strlcpy( buf, ESP.getSdkVersion(), size );
+  else if ( !strcmp( field, "cpu_freq" ) )            snprintf( buf, size, "%d", ESP.getCpuFreqMHz() );
+  else if ( !strcmp( field, "flash_speed" ) )         snprintf( buf, size, "%d", ESP.getFlashChipSpeed() / 1000000 );
+  else if ( !strcmp( field, "flash_sector_size" ) )   snprintf( buf, size, "%d", SPI_FLASH_SEC_SIZE );
+  else if ( !strcmp( field, "flash_chip_mode" ) )     snprintf( buf, size, "%d", ESP.getFlashChipMode() );
+  else if ( !strcmp( field, "flash_size" ) )          snprintf( buf, size, "%d", ESP.getFlashChipSize() );
+  else if ( !strcmp( field, "spiffs_total" ) )        snprintf( buf, size, "%d", SPIFFS.totalBytes() );
+  else if ( !strcmp( field, "spiffs_used" ) )         snprintf( buf, size, "%d", SPIFFS.usedBytes() );
+  else if ( !strcmp( field, "sketch_md5" ) )          strlcpy( buf, ESP.getSketchMD5().c_str(), size );
+  else if ( !strcmp( field, "flash_mode" ) ) {
+    FlashMode_t mode = ESP.getFlashChipMode();
+    strlcpy( buf, mode == FM_QIO ? "QIO" : mode == FM_QOUT ? "QOUT" : mode == FM_DIO ? "DIO" : mode == FM_DOUT ? "DOUT" : "UNKNOWN", size );
+  }
+  else if ( !strcmp( field, "sketch_free" ) ) {
+    int SketchFull = ESP.getSketchSize() + ESP.getFreeSketchSpace();
+    snprintf( buf, size, "%d (%d%%)", ESP.getFreeSketchSpace(), ESP.getFreeSketchSpace() / ( SketchFull / 100 ) );
+  }
+  return( false );
+}
+
+static const char network_tpl[] =
+  "<html><head><meta charset=\"utf-8\"></head><body><h3>Network</h3>"
+  "<b>IP Addr: </b>%ip%<br>"
+  "<b>MAC: </b>%mac%<br>"
+  "<b>SNMask: </b>%subnet%<br>"
+  "<b>GW IP: </b>%gateway%<br>"
+  "<b>DNS 1: </b>%dns1%<br>"
+  "<b>DNS 2: </b>%dns2%<br>"
+  "<b>RSSI: </b>%rssi%dB<br>"
+  "<b>Hostname: </b>%hostname%<br>"
+  "<b>SSID: </b>%ssid%<br>"
+  "<br>Upnp Info: <a target=\"_blank\" href='/description.xml'>description.xml</a><br>"
+  "</body></head></html>";
+
+static void webserver_ip_field( char *buf, size_t size, IPAddress ip ) {
+  snprintf( buf, size, "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3] );
+}
+
+static bool webserver_network_field( const char *field, uint32_t index, char *buf, size_t size ) {
+  if ( !strcmp( field, "ip" ) )               webserver_ip_field( buf, size, WiFi.localIP() );
+  else if ( !strcmp( field, "subnet" ) )      webserver_ip_field( buf, size, WiFi.subnetMask() );
+  else if ( !strcmp( field, "gateway" ) )     webserver_ip_field( buf, size, WiFi.gatewayIP() );
+  else if ( !strcmp( field, "dns1" ) )        webserver_ip_field( buf, size, WiFi.dnsIP(0) );
+  else if ( !strcmp( field, "dns2" ) )        webserver_ip_field( buf, size, WiFi.dnsIP(1) );
+  else if ( !strcmp( field, "rssi" ) )        snprintf( buf, size, "%d", WiFi.RSSI() );
+  else if ( !strcmp( field, "mac" ) ) {
+    byte mac[6];
+    WiFi.macAddress(mac);
+    snprintf( buf, size, "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5] );
+  }
+  else if ( !strcmp( field, "hostname" ) )    strlcpy( buf, WiFi.getHostname(), size );
+  else if ( !strcmp( field, "ssid" ) )        strlcpy( buf, WiFi.SSID().c_str(), size );
+  return( false );
+}
+
+static const char profile_tpl[] =
+  "<html><head><meta charset=\"utf-8\"></head><body><h3>Profile</h3>"
+  "<b><u>Power states</u></b><br>"
+  "<b>Wakeup: </b>%wakeup%<br>"
+  "<b>Silence wakeup: </b>%silence_wakeup%<br>"
+  "<b>Standby: </b>%standby%<br>"
+  "<b>Light sleep: </b>%light_sleep%<br>"
+
+  "<br><b><u>HTTP cache</u></b><br>"
+  "<b>Requests: </b>%cache_requests%<br>"
+  "<b>Fresh: </b>%cache_fresh%<br>"
+  "<b>Not modified: </b>%cache_not_modified%<br>"
+  "<b>Bytes saved: </b>%cache_bytes_saved%<br>"
+  "<b>Flash writes: </b>%cache_writes%<br>"
+
+  "<br><b><u>HTTP hosts</u></b><br>"
+  "<table border=\"1\" cellpadding=\"2\"><tr><th>host</th><th>requests</th><th>connects</th><th>reused</th><th>dns lookups</th><th>avg ms</th><th>max ms</th></tr>"
+  "%hosts%"
+  "</table>"
+
+  "<br><b><u>Jobs</u></b><br>"
+  "<table border=\"1\" cellpadding=\"2\"><tr><th>id</th><th>runs</th><th>deduplicated</th><th>canceled</th><th>avg ms</th><th>max ms</th><th>stack free</th></tr>"
+  "%jobs%"
+  "</table>"
+
+  "<br><b><u>I2C</u></b><br>"
+  "<table border=\"1\" cellpadding=\"2\"><tr><th>device</th><th>reads</th><th>writes</th><th>errors</th><th>bytes</th><th>avg us</th><th>max us</th></tr>"
+  "%i2c%"
+  "</table>"
+
+  "<br><b><u>Screen mirror</u></b><br>"
+  "<b>Clients: </b>%mirror_clients%<br>"
+  "<b>Frames: </b>%mirror_frames%<br>"
+  "<b>Frame size: </b>%mirror_frame_bytes%<br>"
+  "<b>Latency: </b>%mirror_latency%<br>"
+  "<b>Dropped: </b>%mirror_dropped%<br>"
+
+  "<br><b><u>Step history</u></b><br>"
+  "<b>Steps: </b>%steps%<br>"
+  "<b>Flash: </b>%steps_flash%<br>"
+  "<b>Queries: </b>%steps_queries%<br>"
+
+  "<br><b><u>Activity</u></b><br>"
+  "<b>Activity: </b>%activity%<br>"
+  "<b>Samples: </b>%activity_samples%<br>"
+  "<b>Windows: </b>%activity_windows%<br>"
+  "<b>Kernel: </b>%activity_kernel%<br>"
+
+  "<br><b><u>Fuel gauge</u></b><br>"
+  "<b>Charge: </b>%fuel_charge%<br>"
+  "<b>Capacity: </b>%fuel_capacity%<br>"
+  "<b>Rates: </b>%fuel_rates%<br>"
+  "<b>Runtime: </b>%fuel_runtime%<br>"
+  "<b>Snapshot task stack free: </b>%fuel_stack_free%<br>"
+
+  "<br><b><u>Event log</u></b> (<a href=\"/eventlog?enable=1\">on</a> / <a href=\"/eventlog?enable=0\">off</a>)<br>"
+  "<b>State: </b>%eventlog%<br>"
+
+  "<br><b><u>Callbacks</u></b><br>"
+  "<b>Rejected late registrations: </b>%callbacks_rejected%<br>"
+  "<table border=\"1\" cellpadding=\"2\"><tr><th>table</th><th>id</th><th>calls</th><th>total ms</th><th>avg us</th><th>max us</th><th>cycles</th></tr>"
+  "%callbacks%"
+  "</table></body></html>";
+
+static void webserver_profile_state( char *buf, size_t size, uint64_t time, const char *suffix ) {
+  powermgm_stats_t *stats = powermgm_get_stats();
+  uint64_t total = stats->standby + stats->silence_wakeup + stats->wakeup;
+  if ( total == 0 )
+    total = 1;
+
+  snprintf( buf, size, "%d ms (%d%%%s)", (uint32_t)( time / 1000 ), (uint32_t)( time * 100 / total ), suffix );
+}
+
+static bool webserver_profile_field( const char *field, uint32_t index, char *buf, size_t size ) {
+  powermgm_stats_t *stats = powermgm_get_stats();
+  http_cache_stats_t *http_cache = http_cache_get_stats();
+  mirror_stats_t *mirror = mirror_get_stats();
+  stephistory_stats_t *steps = stephistory_get_stats();
+  bma_activity_stats_t *activity = bma_get_activity_stats();
+  eventlog_stats_t *eventlog = eventlog_get_stats();
+  fuelgauge_t gauge;
+  pmu_get_fuelgauge( &gauge );
+
+  if ( !strcmp( field, "wakeup" ) )                   webserver_profile_state( buf, size, stats->wakeup, "" );
+  else if ( !strcmp( field, "silence_wakeup" ) )      webserver_profile_state( buf, size, stats->silence_wakeup, "" );
+  else if ( !strcmp( field, "standby" ) )             webserver_profile_state( buf, size, stats->standby, "" );
+  else if ( !strcmp( field, "light_sleep" ) ) {
+    char times[ 24 ];
+    snprintf( times, sizeof( times ), ", %d times", stats->light_sleep_count );
+    webserver_profile_state( buf, size, stats->light_sleep, times );
+  }
+  else if ( !strcmp( field, "cache_requests" ) )      snprintf( buf, size, "%d", http_cache->requests );
+  else if ( !strcmp( field, "cache_fresh" ) )         snprintf( buf, size, "%d", http_cache->fresh );
+  else if ( !strcmp( field, "cache_not_modified" ) )  snprintf( buf, size, "%d", http_cache->not_modified );
+  else if ( !strcmp( field, "cache_bytes_saved" ) )   snprintf( buf, size, "%d", http_cache->bytes_saved );
+  else if ( !strcmp( field, "cache_writes" ) )        snprintf( buf, size, "%d", http_cache->writes );
+  else if ( !strcmp( field, "mirror_clients" ) )      snprintf( buf, size, "%d", mirror_ws.count() );
+  else if ( !strcmp( field, "mirror_frames" ) )       snprintf( buf, size, "%d ( %d fps, %d rects, %d bytes )", mirror->frames, mirror->framerate, mirror->rects, mirror->bytes );
+  else if ( !strcmp( field, "mirror_frame_bytes" ) )  snprintf( buf, size, "%d bytes", mirror->frame_bytes );
+  else if ( !strcmp( field, "mirror_latency" ) )      snprintf( buf, size, "%d us ( max %d us )", mirror->latency, mirror->latency_max );
+  else if ( !strcmp( field, "mirror_dropped" ) )      snprintf( buf, size, "%d rects, %d resyncs", mirror->dropped, mirror->resyncs );
+  else if ( !strcmp( field, "steps" ) )               snprintf( buf, size, "%d", steps->steps );
+  else if ( !strcmp( field, "steps_flash" ) )         snprintf( buf, size, "%d appends, %d records, %d rotations", steps->flushes, steps->records, steps->rotations );
+  else if ( !strcmp( field, "steps_queries" ) )       snprintf( buf, size, "%d ( max %d us )", steps->queries, steps->query_time_max );
+  else if ( !strcmp( field, "activity" ) )            snprintf( buf, size, "%s, %d minutes recorded", bma_get_activity() < 0 ? "off" : activity_get_name( bma_get_activity() ), steps->minutes );
+  else if ( !strcmp( field, "activity_samples" ) )    snprintf( buf, size, "%d in %d bursts, %d drains ( max %d us ), %d overflows", activity->samples, activity->bursts, activity->drains, activity->drain_time_max, activity->overflows );
+  else if ( !strcmp( field, "activity_windows" ) )    snprintf( buf, size, "%d ( still %d, walk %d, run %d, sleep %d )", activity->windows, activity->activity[ ACTIVITY_STILL ],
+                                                                activity->activity[ ACTIVITY_WALK ], activity->activity[ ACTIVITY_RUN ], activity->activity[ ACTIVITY_SLEEP ] );
+  else if ( !strcmp( field, "activity_kernel" ) )     snprintf( buf, size, "max %d us per window", activity->kernel_time_max );
+  else if ( !strcmp( field, "fuel_charge" ) )         snprintf( buf, size, "%d%% ( %.1f mAh, %.0f mV open circuit )", gauge.percent, gauge.soc * gauge.capacity, gauge.ocv );
+  else if ( !strcmp( field, "fuel_capacity" ) )       snprintf( buf, size, "%.0f of %.0f mAh designed, learned %d times", gauge.capacity, gauge.designed, gauge.cycles );
+  else if ( !strcmp( field, "fuel_rates" ) )          snprintf( buf, size, "wakeup %.1f mA ( %.1f%% ), silence wakeup %.1f mA ( %.1f%% ), standby %.1f mA ( %.1f%% ), mean %.1f mA",
+                                                                gauge.rate[ FUELGAUGE_WAKEUP ], gauge.share[ FUELGAUGE_WAKEUP ] * 100, gauge.rate[ FUELGAUGE_SILENCE_WAKEUP ], gauge.share[ FUELGAUGE_SILENCE_WAKEUP ] * 100,
+                                                                gauge.rate[ FUELGAUGE_STANDBY ], gauge.share[ FUELGAUGE_STANDBY ] * 100, fuelgauge_get_rate( &gauge ) );
+  else if ( !strcmp( field, "fuel_runtime" ) )        snprintf( buf, size, "%d min", fuelgauge_get_runtime( &gauge ) );
+  else if ( !strcmp( field, "fuel_stack_free" ) )     snprintf( buf, size, "%d bytes", pmu_get_snapshot_stack_free() );
+  else if ( !strcmp( field, "eventlog" ) )            snprintf( buf, size, "%s, %d recorded, %d flushed, %d dropped, %d rotations", eventlog_get_enable() ? "on" : "off",
+                                                                eventlog->recorded, eventlog->flushed, eventlog->dropped, eventlog->rotations );
+  else if ( !strcmp( field, "callbacks_rejected" ) ) {
+    const char *id = NULL;
+    uint32_t rejected = callback_get_rejected( &id );
+    if ( rejected && id ) {
+      snprintf( buf, size, "%d ( last: %s )", rejected, id );
+    }
+    else {
+      snprintf( buf, size, "%d", rejected );
+    }
+  }
+  else if ( !strcmp( field, "hosts" ) ) {
+    http_pool_host_t *host = http_pool_get_host( index );
+    if ( host && host->host[ 0 ] ) {
+      snprintf( buf, size, "<tr><td>%s:%d</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td></tr>",
+                host->host, host->port, host->requests, host->connects, host->reused, host->dns_lookups,
+                (uint32_t)( host->requests ? host->latency / host->requests / 1000 : 0 ), host->latency_max / 1000 );
+    }
+    return( index + 1 < HTTP_POOL_MAX_HOSTS );
+  }
+  else if ( !strcmp( field, "jobs" ) ) {
+    jobqueue_stats_t *job = jobqueue_get_stats( index );
+    if ( job ) {
+      snprintf( buf, size, "<tr><td>%s</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td></tr>",
+                job->id, job->runs, job->deduplicated, job->canceled,
+                (uint32_t)( job->runs ? job->time / job->runs / 1000 : 0 ), job->time_max / 1000, job->stack_free );
+    }
+    return( job != NULL );
+  }
+  else if ( !strcmp( field, "i2c" ) ) {
+    i2cctl_stats_t i2c;
+    if ( i2cctl_get_stats( index, &i2c ) ) {
+      uint32_t transfers = i2c.reads + i2c.writes;
+      snprintf( buf, size, "<tr><td>0x%02x</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td></tr>",
+                i2c.addr, i2c.reads, i2c.writes, i2c.errors, i2c.bytes,
+                (uint32_t)( transfers ? i2c.time / transfers : 0 ), i2c.time_max );
+      return( true );
+    }
+    return( false );
+  }
+  else if ( !strcmp( field, "callbacks" ) ) {
+    /*
+     * one row per callback table entry, walk the list up to the row number
+     */
+    for ( callback_t *callback = callback_get_first() ; callback != NULL ; callback = callback->next ) {
+      if ( index >= callback->entrys ) {
+        index -= callback->entrys;
+        continue;
+      }
+      callback_table_t table;
+      callback_get_stats( &callback->table[ index ], &table );
+      snprintf( buf, size, "<tr><td>%s</td><td>%s</td><td>%d</td><td>%d</td><td>%d</td><td>%d</td><td>%.0f</td></tr>",
+                callback->name, table.id, (uint32_t)table.counter, (uint32_t)( table.time / 1000 ),
+                (uint32_t)( table.counter ? table.time / table.counter : 0 ), table.time_max, (double)table.cycles );
+      return( true );
+    }
+  }
+  return( false );
+}
 
-  static const char* serverIndex =
-    "<!DOCTYPE html>\n <html><head>\n <script src='https://ajax.googleapis.com/ajax/libs/jquery/3.2.1/jquery.min.js'></script>"
-    "\n <script src='/jquery.min.js'></script>"
-
-    "\n <style>"
-    "\n #progressbarfull {"
-    "\n background-color: #20201F;"
-    "\n border-radius: 20px;"
-    "\n width: 320px;"
-    "\n padding: 4px;"
-    "\n}"
-    "\n #progressbar {"
-    "\n background-color: #20CC00;"
-    "\n width: 3%;"
-    "\n height: 16px;"
-    "\n border-radius: 10px;"
-    "\n}"
-    "\n</style>"
-    "\n </head><body>"
-    "<h2>Update by Browser</h2>"
-    "\n <form method='POST' action='#' enctype='multipart/form-data' id='upload_form'>"
-    "\n <input type='file' name='update'>"
-    "\n <br><br><input type='submit' value='Update'>"
-    "\n </form>"
-    "\n <div id='prg'>Progress: 0%</div>"
-    "\n <div id=\"progressbarfull\"><div id=\"progressbar\"></div></div>"
-    "\n <script>"
-    "\n $('form').submit(function(e){"
-    "\n e.preventDefault();"
-    "\n var form = $('#upload_form')[0];"
-    "\n var data = new FormData(form);"
-    "\n $.ajax({"
-    "\n url: '/update',"
-    "\n type: 'POST',"
-    "\n data: data,"
-    "\n contentType: false,"
-    "\n processData:false,"
-    "\n xhr: function() {"
-    "\n var xhr = new window.XMLHttpRequest();"
-    "\n xhr.upload.addEventListener('progress', function(evt) {"
-    "\n if (evt.lengthComputable) {"
-    "\n var per = evt.loaded / evt.total;"
-    "\n document.getElementById(\"prg\").innerHTML = 'Progress: ' + Math.round(per*100) + '%';"
-    "\n document.getElementById(\"progressbar\").style.width=Math.round(per*100)+ '%';"
-    "}"
-    "}, false);"
-    "return xhr;"
-    "},"
-    "\n success:function(d, s) {"
-    "\n document.getElementById(\"prg\").innerHTML = 'Progress: success';"
-    "\n console.log('success!')"
-    "},"
-    "\n error: function (a, b, c) {"
-    "\n document.getElementById(\"prg\").innerHTML = 'Progress: error';"
-    "}"
-    "});"
-    "});"
-    "\n </script>"
-    "\n </body></html>";
+static const char description_tpl[] =
+  "<?xml version=\"1.0\"?>\n"
+  "<root xmlns=\"urn:schemas-upnp-org:device-1-0\">\n"
+  "<specVersion>\n"
+  "\t<major>1</major>\n"
+  "\t<minor>0</minor>\n"
+  "</specVersion>\n"
+  "<URLBase>http://%ip%/</URLBase>\n"
+  "<device>\n"
+  "\t<deviceType>upnp:rootdevice</deviceType>\n"
+
+  /*this is the icon name in Windows*/
+  "\t<friendlyName>" DEV_NAME " %mac%</friendlyName>\n" /*because the hostename is 'Espressif' */
+
+  "\t<presentationURL>/</presentationURL>\n"
+  "\t<manufacturer>Dirk Broßwick (sharandac)</manufacturer>\n"
+  "\t<manufacturerURL>https://github.com/sharandac/My-TTGO-Watch</manufacturerURL>\n"
+  "\t<modelName>" DEV_INFO "</modelName>\n"
+
+  "\t<modelNumber>%hostname%</modelNumber>\n"
+  "\t<modelURL>/</modelURL>\n"
+
+  "\t<serialNumber>Build: " __FIRMWARE__ "</serialNumber>\n"
+  //The last six bytes of the UUID are the hardware address of the first Ethernet adapter in the system the UUID was generated on.
+  "\t<UDN>uuid:38323636-4558-4DDA-9188-CDA0E6%mac%</UDN>\n"
+  "</device>\n"
+  "</root>\r\n"
+  "\r\n";
+
+static bool webserver_description_field( const char *field, uint32_t index, char *buf, size_t size ) {
+  if ( !strcmp( field, "ip" ) )               webserver_ip_field( buf, size, WiFi.localIP() );
+  else if ( !strcmp( field, "hostname" ) )    strlcpy( buf, WiFi.getHostname(), size );
+  else if ( !strcmp( field, "mac" ) ) {
+    byte mac[6];
+    WiFi.macAddress(mac);
+    snprintf( buf, size, "%02X%02X%02X", mac[3], mac[4], mac[5] );
+  }
+  return( false );
+}
 
 void handleUpdate( AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
 
@@ -129,6 +618,7 @@ void handleUpdate( AsyncWebServerRequest *request, const String& filename, size_
     } else {
       Serial.println("Update complete");
       Serial.flush();
+      config_store_commit();
       ESP.restart();
     }
   }
@@ -139,105 +629,38 @@ void handleUpdate( AsyncWebServerRequest *request, const String& filename, size_
  */
 void asyncwebserver_start(void){
 
-  asyncserver.on("/index.htm", HTTP_GET, [](AsyncWebServerRequest *request) {
-    String html = (String) "<!DOCTYPE html>"
-      "<html>"
-      "<frameset cols=\"300, *\">"
-      "<frame src=\"/nav.htm\" name=\"nav\">"
-      "<frame name=\"cont\">"
-      "</frameset>"
-      "</html>";
-    request->send(200, "text/html", html);
+  webserver_add_assets( &asyncserver );
+
+  asyncserver.on("/info", HTTP_GET, [](AsyncWebServerRequest *request) {
+    webserver_send_template( request, "text/html", info_tpl, webserver_info_field );
   });
 
-  asyncserver.on("/nav.htm", HTTP_GET, [](AsyncWebServerRequest *request) {
-    String html = (String) "<!DOCTYPE html>"
-      "<html><head>"
-      "<meta http-equiv='Content-type' content='text/html; charset=utf-8'>"
-      "<title>Web Interface</title>"
-      "</head><body>"
-      "<h1>TTGo Watch Web Server</h1>"
-      "<p>This is your device, program it as you see fit."
-      "<p>Here are some URLs the device already supports, which you might find helpful:"
-      "<ul>"
-      "<li><a target=\"cont\" href=\"/info\">/info</a> - Display information about the device"
-      "<li><a target=\"cont\" href=\"/network\">/network</a> - Display network information"
-      "<li><a target=\"cont\" href=\"/shot\">/shot</a> - Capture a screen shot"
-      "<li><a target=\"cont\" href=\"/screen.data\">/screen.data</a> - Retrieve the image in RGB565 format, open it with gimp"
-      "<li><a target=\"_blank\" href=\"/edit\">/edit</a> - View, edit, upload, and delete files"
-      "</ul>"
-      "<p><div style=\"color:red;\">Caution:</div> Use these with care:"
-      "<ul><li><a target=\"cont\"  href=\"/reset\">/reset</a> Reboot the device"
-      "<li><a target=\"_top\" href=\"/update\">/update</a> Transmit a firmware update through POST request"
-      "</body></html>";
-    request->send(200, "text/html", html);
+  asyncserver.on("/network", HTTP_GET, [](AsyncWebServerRequest *request) {
+    webserver_send_template( request, "text/html", network_tpl, webserver_network_field );
   });
 
-  asyncserver.on("/info", HTTP_GET, [](AsyncWebServerRequest *request) {
-    FlashMode_t mode = ESP.getFlashChipMode();
-    int SketchFull = ESP.getSketchSize() + ESP.getFreeSketchSpace();
+  asyncserver.on("/profile", HTTP_GET, [](AsyncWebServerRequest *request) {
+    webserver_send_template( request, "text/html", profile_tpl, webserver_profile_field );
+  });
 
-    String html = (String) "<html><head><meta charset=\"utf-8\"></head><body><h3>Information</h3>" +
-                  "<b><u>Memory</u></b><br>" +
-                  "<b>Heap size: </b>" + ESP.getHeapSize() + "<br>" +
-                  "<b>Heap free: </b>" + ESP.getFreeHeap() + "<br>" +
-                  "<b>Heap free min: </b>" + ESP.getMinFreeHeap() + "<br>" +
-                  "<b>Heap size: </b>" + ESP.getHeapSize() + "<br>" +
-                  "<b>Psram size: </b>" + ESP.getPsramSize() + "<br>" +
-                  "<b>Psram free: </b>" + ESP.getFreePsram() + "<br>" +
-
-                  "<br><b><u>System</u></b><br>" +
-                  "\t<b>Battery voltage: </b>" + TTGOClass::getWatch()->power->getBattVoltage() / 1000 + " Volts" + "<br>" +
-
-                  "\t<b>Uptime: </b>" + millis() / 1000 + "<br>" +
-                  "<br><b><u>Chip</u></b>" +
-                  "<br><b>SdkVersion: </b>" + String(ESP.getSdkVersion()) + "<br>" +
-                  "<b>CpuFreq: </b>" + String(ESP.getCpuFreqMHz()) + " MHz<br>" +
-                  
-                  "<br><b><u>Flash</u></b><br>" +
-                  "<b>FlashChipSpeed: </b>" + String(ESP.getFlashChipSpeed() / 1000000) + " MHz<br>" +
-                  "<b>Flash mode: </b>" + String( mode == FM_QIO ? "QIO" : mode == FM_QOUT ? "QOUT" : mode == FM_DIO ? "DIO" : mode == FM_DOUT ? "DOUT" : "UNKNOWN") + "</b><br>" +
-                  "<b>Flash sector size: </b>" + String( SPI_FLASH_SEC_SIZE) + "<br>" +
-                  "<b>FlashChipMode: </b>" + ESP.getFlashChipMode() + "<br>" +
-                  "<b>FlashChipSize (SDK): </b>" + ESP.getFlashChipSize() + "<br>" +
-                  
-                  "<br><b><u>Firmware</u></b><br>" +
-                  "<b>SketchSpace free: </b>" + ESP.getFreeSketchSpace() + " (" + (ESP.getFreeSketchSpace() / (SketchFull / 100)) + "%)<br>" +
-                  "<b>BuildTime: </b>" +  __DATE__ + " " + __TIME__  + "<br>" +
-                  "<b>Version: </b>" + __FIRMWARE__ + "<br>" +
-                  "<b>GCC-Version: </b>" + __VERSION__ + "<br>" +
-                  "<b>SketchMD5: </b>" + String(ESP.getSketchMD5()) + "<br>" +
-                  
-                  "<br><b><u>Filesystem</u></b><br>" +
-                  "<b>Total size: </b>" + SPIFFS.totalBytes() + "<br>" +
-                  "<b>Used size: </b>" + SPIFFS.usedBytes() + "<br>" +
-
-                  "<br>";
-    request->send(200, "text/html", html);
+  asyncserver.on("/steps", HTTP_GET, [](AsyncWebServerRequest * request) {
+    webserver_send_steps( request );
   });
 
-  asyncserver.on("/network", HTTP_GET, [](AsyncWebServerRequest *request) {
-    String html = (String) "<html><head><meta charset=\"utf-8\"></head><body><h3>Network</h3>" +
-                  "<b>IP Addr: </b>" + WiFi.localIP().toString() + "<br>" +
-                  "<b>MAC: </b>" + WiFi.macAddress() + "<br>" +
-                  "<b>SNMask: </b>" + WiFi.subnetMask().toString() + "<br>" +
-                  "<b>GW IP: </b>" + WiFi.gatewayIP().toString() + "<br>" +
-                  "<b>DNS 1: </b>" + WiFi.dnsIP(0).toString() + "<br>" +
-                  "<b>DNS 2: </b>" + WiFi.dnsIP(1).toString() + "<br>" +
-                  "<b>RSSI: </b>" + String(WiFi.RSSI()) + "dB<br>" +
-                  "<b>Hostname: </b>" + WiFi.getHostname() + "<br>" +
-                  "<b>SSID: </b>" + WiFi.SSID() + "<br>" +
-                  "<br>Upnp Info: <a target=\"_blank\" href='/description.xml'>description.xml</a>" + "<br>" +
-                  "</body></head></html>";
-    request->send(200, "text/html", html);
+  asyncserver.on("/motion", HTTP_GET, [](AsyncWebServerRequest * request) {
+    webserver_send_motion( request );
   });
 
   asyncserver.on("/shot", HTTP_GET, [](AsyncWebServerRequest * request) {
-    request->send(200, "text/plain", "screen is taken\r\n" );
-    screenshot_take();
-    screenshot_save();
+    webserver_send_screenshot( request, true );
+  });
+  asyncserver.on("/screen.data", HTTP_GET, [](AsyncWebServerRequest * request) {
+    webserver_send_screenshot( request, false );
   });
 
+  mirror_ws.onEvent( webserver_mirror_event );
+  asyncserver.addHandler( &mirror_ws );
+
   asyncserver.addHandler(new SPIFFSEditor(SPIFFS));
   asyncserver.rewrite("/", "/index.htm");
   asyncserver.serveStatic("/", SPIFFS, "/");
@@ -306,14 +729,22 @@ void asyncwebserver_start(void){
     }
   });
 
+  asyncserver.on("/eventlog", HTTP_GET, []( AsyncWebServerRequest * request ) {
+    if ( request->hasParam( "enable" ) ) {
+      eventlog_set_enable( request->getParam( "enable" )->value().toInt() != 0 );
+    }
+    request->send( 200, "text/plain", eventlog_get_enable() ? "event log on\r\n" : "event log off\r\n" );
+  });
+
   asyncserver.on("/reset", HTTP_GET, []( AsyncWebServerRequest * request ) {
     request->send(200, "text/plain", "Reset\r\n" );
+    config_store_commit();
     delay(3000);
     ESP.restart();    
   });
 
   asyncserver.on("/update", HTTP_GET, [](AsyncWebServerRequest * request) {
-    request->send(200, "text/html", serverIndex);
+    webserver_send_asset( request, webserver_find_asset( "/update.htm" ) );
   });
 
   asyncserver.on(
@@ -323,43 +754,7 @@ void asyncwebserver_start(void){
   );
 
   asyncserver.on("/description.xml", HTTP_GET, [](AsyncWebServerRequest *request) {
-    byte mac[6];
-    WiFi.macAddress(mac);
-    char tmp[6 + 1];
-    snprintf(tmp, sizeof(tmp), "%02X%02X%02X", mac[3], mac[4], mac[5]);
-    String MacStrPart = String(tmp);
-
-    String xmltext = String("<?xml version=\"1.0\"?>\n") +
-            "<root xmlns=\"urn:schemas-upnp-org:device-1-0\">\n"
-            "<specVersion>\n"
-            "\t<major>1</major>\n"
-            "\t<minor>0</minor>\n"
-            "</specVersion>\n"
-            "<URLBase>http://" + WiFi.localIP().toString() + "/</URLBase>\n" 
-            "<device>\n"
-            "\t<deviceType>upnp:rootdevice</deviceType>\n"
-
-            /*this is the icon name in Windows*/
-            /*"\t<friendlyName>" + WiFi.getHostname() + "</friendlyName>\n"*/ 
-            "\t<friendlyName>" + DEV_NAME + " " + MacStrPart + "</friendlyName>\n" /*because the hostename is 'Espressif' */
-
-            "\t<presentationURL>/</presentationURL>\n"
-            "\t<manufacturer>" + "Dirk Broßwick (sharandac)" + "</manufacturer>\n"
-            "\t<manufacturerURL>https://github.com/sharandac/My-TTGO-Watch</manufacturerURL>\n"
-            "\t<modelName>" +  DEV_INFO + "</modelName>\n"
-
-            "\t<modelNumber>" + WiFi.getHostname() + "</modelNumber>\n"
-            "\t<modelURL>" +
-            "/" + "</modelURL>\n"
-
-            "\t<serialNumber>Build: " + __FIRMWARE__ + "</serialNumber>\n"
-            //The last six bytes of the UUID are the hardware address of the first Ethernet adapter in the system the UUID was generated on.
-            "\t<UDN>uuid:38323636-4558-4DDA-9188-CDA0E6" + MacStrPart + "</UDN>\n"
-            "</device>\n"
-            "</root>\r\n"
-            "\r\n";
-
-    request->send(200, "text/xml", xmltext);
+    webserver_send_template( request, "text/xml", description_tpl, webserver_description_field );
   });
 
   //Upnp / SSDP presentation - Multicast  - link to description.xml
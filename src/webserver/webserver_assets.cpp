@@ -0,0 +1,105 @@
+/*
+ * generated by tools/html2gz.py from src/webserver/html, do not edit
+ */
+#include "webserver_assets.h"
+
+static const uint8_t index_htm_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb3, 0x51, 0x74, 0xf1, 0x77, 0x0e, 0x89, 0x0c, 0x70, 0x55, 0xc8, 0x28, 0xc9, 0xcd, 0xb1, 0xe3, 0xb2, 0x81, 0x52, 0x69, 0x45, 0x89, 
+  0xb9, 0xa9, 0xc5, 0xa9, 0x25, 0x0a, 0xc9, 0xf9, 0x39, 0xc5, 0xb6, 0x4a, 0xc6, 0x06, 0x06, 0x3a, 0x0a, 0x5a, 0x4a, 0x30, 0x09, 0x85, 0xe2, 0xa2, 0x64, 0x5b, 0x25, 0xfd, 0xbc, 0xc4, 0x32, 0x3d, 
+  0xa0, 0x7a, 0x25, 0x85, 0x3c, 0xa0, 0x98, 0xad, 0x12, 0x90, 0x8b, 0x50, 0x01, 0x11, 0x4a, 0xce, 0xcf, 0x2b, 0x01, 0x89, 0xe9, 0xc3, 0xcc, 0x03, 0xb1, 0x21, 0x56, 0x00, 0x00, 0x58, 0xe1, 0xb2, 
+  0x95, 0x7a, 0x00, 0x00, 0x00, 
+};
+
+static const uint8_t mirror_htm_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0x6d, 0x6f, 0xdb, 0x36, 0x10, 0xfe, 0xae, 0x5f, 0x71, 0x41, 0x81, 0x48, 0x8a, 0x65, 0xbd, 0x39, 0xc9, 0x8c, 0x58, 0xf6, 
+  0x87, 0xa6, 0x2d, 0x16, 0xac, 0xc5, 0x86, 0x26, 0xdb, 0x30, 0x0c, 0xc3, 0x20, 0x4b, 0x94, 0x45, 0x4c, 0x12, 0x55, 0x92, 0x7e, 0x11, 0xd6, 0xfc, 0xf7, 0x1d, 0x49, 0xc9, 0x76, 0x1c, 0x77, 0xd8, 
+  0x02, 0x24, 0x36, 0x79, 0xcf, 0x1d, 0x9f, 0x7b, 0x78, 0xbc, 0x4b, 0x72, 0xf1, 0xee, 0xc7, 0xfb, 0xa7, 0xdf, 0x7e, 0x7a, 0x0f, 0xa5, 0xac, 0xab, 0x85, 0x95, 0xe8, 0x8f, 0xa4, 0x24, 0x69, 0x8e, 
+  0x8b, 0x9a, 0xc8, 0x14, 0x0d, 0xb2, 0x1d, 0x93, 0x2f, 0x6b, 0xba, 0x99, 0xdb, 0xf7, 0xac, 0x91, 0xa4, 0x91, 0x63, 0xd9, 0xb5, 0xc4, 0x86, 0xcc, 0xac, 0xe6, 0xb6, 0x24, 0x3b, 0x19, 0x28, 0xcf, 
+  0x19, 0x64, 0x65, 0xca, 0x05, 0x91, 0xf3, 0xb5, 0x2c, 0xc6, 0x53, 0x1b, 0x63, 0x48, 0x2a, 0x2b, 0xb2, 0x78, 0xcc, 0x38, 0x21, 0x0d, 0xd4, 0x94, 0x73, 0xc6, 0x93, 0xc0, 0x6c, 0x5a, 0x89, 0x90, 
+  0x9d, 0xfa, 0x7c, 0x23, 0x8c, 0xf9, 0x6f, 0x0b, 0x60, 0x4b, 0x73, 0x59, 0xde, 0xc1, 0xf5, 0x34, 0x6c, 0x77, 0x33, 0x5c, 0x97, 0x84, 0xae, 0x4a, 0x79, 0xb4, 0x41, 0xeb, 0x74, 0x45, 0xc6, 0x9c, 
+  0x34, 0x39, 0xe1, 0xb4, 0x59, 0xdd, 0x41, 0x4b, 0x77, 0xa4, 0x4a, 0x25, 0xc9, 0x95, 0x75, 0xc9, 0x38, 0xee, 0xdf, 0x41, 0xd4, 0xee, 0x40, 0xb0, 0x8a, 0xe6, 0xf0, 0x26, 0x0e, 0xe3, 0x30, 0xfa, 
+  0x30, 0xb3, 0x9e, 0xad, 0x24, 0xe8, 0x0f, 0x4c, 0x02, 0x9d, 0x61, 0xb2, 0x64, 0x79, 0xa7, 0x92, 0x8e, 0x4f, 0x09, 0xe2, 0x8e, 0x95, 0x64, 0x69, 0xb3, 0x49, 0x05, 0xd0, 0x7c, 0x6e, 0x1b, 0x82, 
+  0xb6, 0x61, 0x37, 0xb7, 0xe3, 0xeb, 0xd0, 0xee, 0x99, 0x99, 0xc5, 0x22, 0x09, 0x0c, 0x1a, 0xdd, 0x72, 0xba, 0x31, 0x3e, 0x32, 0x95, 0xc2, 0x5e, 0xa0, 0x4a, 0x0d, 0xc9, 0x24, 0x52, 0x4d, 0x02, 
+  0x34, 0xa9, 0xac, 0x33, 0x4e, 0x5b, 0xb9, 0xb0, 0x36, 0x29, 0x87, 0x4c, 0xee, 0x60, 0x0e, 0x39, 0xcb, 0xd6, 0x35, 0x4a, 0xe9, 0xaf, 0x88, 0x7c, 0x5f, 0x11, 0xf5, 0xf5, 0x6d, 0xf7, 0x90, 0x3b, 
+  0xc3, 0xb9, 0xae, 0x32, 0x68, 0xf1, 0x77, 0xd2, 0xb1, 0xe3, 0xdc, 0x76, 0x67, 0xda, 0xbb, 0xe0, 0x69, 0x4d, 0x04, 0x06, 0x08, 0x3d, 0x58, 0x76, 0x72, 0xf8, 0xaa, 0xd4, 0x68, 0xb2, 0xce, 0x2c, 
+  0x34, 0xe6, 0xcf, 0xbd, 0x75, 0x66, 0x59, 0xc5, 0xba, 0x41, 0x3e, 0xac, 0x81, 0x9c, 0xa7, 0x5b, 0x67, 0xb9, 0x2e, 0x0a, 0xc2, 0x5d, 0x2d, 0xbe, 0x8a, 0xb9, 0xa1, 0x64, 0x8b, 0xc0, 0x06, 0xff, 
+  0xbe, 0x4b, 0x65, 0xfa, 0x0b, 0x2e, 0x07, 0x8c, 0x96, 0xbf, 0x80, 0x7e, 0xe9, 0xab, 0x98, 0x1f, 0x49, 0xb3, 0x92, 0x25, 0x24, 0x30, 0x89, 0xe1, 0xeb, 0x57, 0x78, 0x94, 0xea, 0x4e, 0xfc, 0x82, 
+  0xb3, 0xfa, 0x1e, 0x2b, 0xe1, 0x9e, 0xe5, 0xc4, 0x51, 0x01, 0x15, 0xff, 0x9f, 0x69, 0x23, 0xa7, 0x4e, 0xe8, 0x7a, 0xf0, 0x72, 0x27, 0x7a, 0xb5, 0x13, 0xbf, 0xda, 0x99, 0xb8, 0x2e, 0x5c, 0xcc, 
+  0xc1, 0xfe, 0xf4, 0xf0, 0xf9, 0xb3, 0xed, 0x22, 0x0d, 0x00, 0x4e, 0xe4, 0x9a, 0x37, 0x8a, 0xd2, 0x21, 0xdd, 0x63, 0xa7, 0x49, 0xec, 0x44, 0xb1, 0x07, 0x92, 0xaf, 0x89, 0x26, 0xfe, 0x52, 0x87, 
+  0x53, 0xe4, 0xed, 0x11, 0x52, 0xa9, 0xb0, 0x3b, 0xc1, 0x44, 0xb7, 0x4e, 0x1c, 0xf6, 0x18, 0x0f, 0xba, 0x33, 0xd6, 0xf8, 0x24, 0xc2, 0xf6, 0x0c, 0xe6, 0x7a, 0x1f, 0xa1, 0x3c, 0x63, 0x3d, 0xe5, 
+  0x50, 0x54, 0xe9, 0x4a, 0x9c, 0xc1, 0x4d, 0xf7, 0x51, 0xf0, 0x11, 0xa0, 0x1d, 0xa5, 0x1f, 0x9d, 0x82, 0x26, 0xe1, 0x49, 0x30, 0x5a, 0xaf, 0x10, 0x8a, 0xe5, 0xe6, 0x63, 0x49, 0xa1, 0x60, 0x0f, 
+  0xea, 0x19, 0xa9, 0x0b, 0x76, 0xb6, 0xc8, 0x66, 0x0f, 0x6b, 0x55, 0xe2, 0x88, 0xf5, 0x73, 0x34, 0x79, 0xd0, 0x32, 0xa1, 0x0f, 0xf0, 0x80, 0x9a, 0xe2, 0x01, 0x08, 0xae, 0x40, 0xa0, 0x92, 0xc0, 
+  0xd7, 0x0d, 0x54, 0xe6, 0xf6, 0x0b, 0xc6, 0xeb, 0x54, 0x02, 0xbe, 0x15, 0x59, 0x12, 0x6c, 0x0b, 0x75, 0xcb, 0x89, 0x10, 0x24, 0x07, 0x53, 0xbe, 0xa2, 0x64, 0xd2, 0x03, 0x41, 0x08, 0x48, 0xc6, 
+  0x2a, 0x11, 0x1c, 0x76, 0xe3, 0x16, 0x8b, 0xa5, 0xed, 0xe0, 0x2a, 0x50, 0x2f, 0xbf, 0xa4, 0x15, 0x01, 0x47, 0x1d, 0x99, 0xe8, 0xcc, 0x2e, 0x2f, 0xf1, 0xd4, 0x04, 0x29, 0xf9, 0xe6, 0x1c, 0x53, 
+  0xa3, 0x86, 0x67, 0x76, 0xa2, 0xcb, 0x54, 0xf9, 0x8d, 0x46, 0x3a, 0x0f, 0x50, 0x84, 0xc0, 0x51, 0xb0, 0x06, 0x61, 0x4e, 0x06, 0x97, 0x10, 0xee, 0xbe, 0x2b, 0x5c, 0x94, 0x29, 0x9a, 0xe1, 0xde, 
+  0x02, 0x33, 0x81, 0x66, 0x3c, 0x1e, 0x02, 0xf6, 0x21, 0x59, 0x85, 0x6e, 0xaf, 0xe4, 0xc6, 0xb8, 0x47, 0x52, 0xaa, 0x1f, 0xf5, 0x04, 0x2e, 0xfa, 0xa8, 0xd3, 0xd0, 0x55, 0x75, 0x8f, 0xe7, 0xcc, 
+  0x21, 0x72, 0x7b, 0x00, 0x68, 0xdd, 0x46, 0x73, 0x88, 0x07, 0x97, 0x76, 0xf7, 0x3b, 0x1d, 0x8d, 0xfe, 0x50, 0x6c, 0x1c, 0x73, 0xce, 0x62, 0x01, 0x51, 0xe4, 0xea, 0x18, 0x11, 0x32, 0xbb, 0x82, 
+  0xf8, 0xe6, 0x06, 0x02, 0x98, 0x44, 0xff, 0xea, 0x72, 0x63, 0x3c, 0x26, 0x47, 0x1e, 0xb7, 0x93, 0x33, 0x1e, 0xc6, 0xe1, 0xbf, 0x04, 0x47, 0x8b, 0xd9, 0x7c, 0xb6, 0xcc, 0xaf, 0x2a, 0x91, 0x76, 
+  0x2d, 0x0f, 0xf5, 0x81, 0xd5, 0xe0, 0xc1, 0x0e, 0x8b, 0x5e, 0x0b, 0x60, 0x1e, 0x10, 0xe6, 0xf6, 0xaa, 0x09, 0x0c, 0xdd, 0xc1, 0x94, 0xed, 0xe5, 0x20, 0x87, 0xe9, 0x51, 0xa3, 0x91, 0x6a, 0xc0, 
+  0x87, 0xd6, 0xd3, 0x77, 0x45, 0xe7, 0xd0, 0x77, 0xb6, 0xa2, 0xef, 0x3a, 0xbf, 0x92, 0xe5, 0x23, 0xcb, 0xfe, 0x22, 0xd8, 0xe9, 0xb6, 0xe2, 0x2e, 0x08, 0x6c, 0xbc, 0xb6, 0x8a, 0x65, 0xa9, 0xf2, 
+  0xf3, 0x4b, 0x26, 0x24, 0xae, 0xed, 0xc0, 0x74, 0x6a, 0x5b, 0x73, 0xda, 0x0a, 0x7f, 0x49, 0x9b, 0x94, 0x77, 0x4f, 0x38, 0x97, 0x30, 0x8a, 0x9d, 0x72, 0x9e, 0x76, 0x86, 0xa0, 0xdd, 0x03, 0x58, 
+  0x83, 0x2c, 0x04, 0xe6, 0x84, 0xf6, 0x81, 0x85, 0x43, 0x36, 0x72, 0xa8, 0x01, 0xdd, 0x0b, 0x71, 0xad, 0x0b, 0x5f, 0x47, 0x7d, 0xde, 0x7b, 0x66, 0x15, 0x13, 0x2f, 0xfc, 0xf6, 0x4e, 0xdf, 0xec, 
+  0xdb, 0xba, 0xf7, 0xbb, 0x3e, 0xc5, 0x2c, 0xf9, 0xf7, 0x4f, 0x9f, 0x3e, 0x2a, 0x56, 0x39, 0x15, 0x7d, 0xda, 0x24, 0xf7, 0x54, 0xff, 0xe2, 0x1d, 0xf8, 0xbe, 0x6f, 0x1b, 0xfd, 0x71, 0x6a, 0x3e, 
+  0xd1, 0x9a, 0xb0, 0xb5, 0x74, 0x7a, 0x94, 0x07, 0x71, 0x18, 0x86, 0x03, 0x17, 0x54, 0x0f, 0x21, 0x0f, 0x38, 0x03, 0xf8, 0x26, 0xad, 0x9c, 0x13, 0x2e, 0xff, 0x8b, 0x49, 0x3f, 0x36, 0x50, 0x46, 
+  0x28, 0x5a, 0xac, 0x6e, 0xa5, 0xb0, 0x63, 0x2e, 0x36, 0x80, 0x28, 0x8c, 0xaf, 0x5d, 0x5f, 0xb2, 0x0f, 0x38, 0x56, 0x73, 0x6c, 0xce, 0x1a, 0xf6, 0xc3, 0xdb, 0xc0, 0xe0, 0x34, 0x55, 0xe7, 0xb8, 
+  0x97, 0x7e, 0xdb, 0x43, 0xa3, 0x0e, 0xd3, 0x48, 0x9f, 0x32, 0x2c, 0x94, 0x17, 0xe6, 0x76, 0xea, 0x55, 0x0b, 0x7b, 0xdf, 0xab, 0xc5, 0xd0, 0x71, 0x8e, 0x66, 0xd7, 0xb3, 0x67, 0xfc, 0x66, 0xd6, 
+  0xbe, 0x80, 0x66, 0x6a, 0xac, 0xf7, 0x13, 0x35, 0x09, 0xf4, 0x44, 0x4f, 0x02, 0xf3, 0xdf, 0xcc, 0x3f, 0x0c, 0x1f, 0x7c, 0x7f, 0xde, 0x08, 0x00, 0x00, 
+};
+
+static const uint8_t nav_htm_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x54, 0x51, 0x4f, 0xdb, 0x30, 0x10, 0x7e, 0xe7, 0x57, 0xdc, 0xfa, 0x30, 0x5e, 0x4a, 0x23, 0x26, 0x31, 0x4d, 0x90, 0x66, 0xd2, 
+  0x0a, 0x62, 0x9b, 0xb6, 0x81, 0xa0, 0x80, 0xf6, 0x84, 0x9c, 0xe4, 0xd2, 0x58, 0x38, 0xb1, 0x67, 0x5f, 0x5a, 0x22, 0xf1, 0xe3, 0x77, 0xe7, 0x64, 0x80, 0x60, 0x2a, 0x52, 0x53, 0xdb, 0xe7, 0xf3, 
+  0x77, 0xdf, 0x7d, 0x67, 0x5f, 0xfa, 0xee, 0xf8, 0x6c, 0xb1, 0xfc, 0x7d, 0x7e, 0x02, 0x35, 0x35, 0x26, 0xdb, 0x49, 0xe3, 0x90, 0xd6, 0xa8, 0x4a, 0x5e, 0x34, 0x48, 0x8a, 0x37, 0xc8, 0xed, 0xe1, 
+  0x9f, 0x4e, 0xaf, 0xe7, 0xbb, 0x0b, 0xdb, 0x12, 0xb6, 0xb4, 0x47, 0xbd, 0xc3, 0x5d, 0x28, 0x86, 0xd5, 0x7c, 0x97, 0xf0, 0x9e, 0x12, 0x39, 0x79, 0x04, 0x45, 0xad, 0x7c, 0x40, 0x9a, 0x77, 0x54, 
+  0xed, 0x7d, 0xda, 0x65, 0x0c, 0xd2, 0x64, 0x30, 0xbb, 0xc1, 0x1c, 0xbe, 0xb1, 0xb7, 0xaf, 0x54, 0x81, 0x69, 0x32, 0x18, 0x77, 0xd2, 0x24, 0x06, 0x4a, 0x73, 0x5b, 0xf6, 0x12, 0x7b, 0x3f, 0x5b, 
+  0x2e, 0x4f, 0x2d, 0xdc, 0x28, 0x2a, 0x6a, 0x90, 0x23, 0x97, 0xe8, 0xd7, 0xe8, 0xd9, 0x6d, 0x9f, 0xb7, 0x5d, 0xb6, 0xac, 0x75, 0x00, 0xfe, 0xf5, 0xb6, 0xf3, 0x50, 0xe2, 0x5a, 0x17, 0x38, 0x05, 
+  0xe7, 0xed, 0xca, 0xab, 0x06, 0x34, 0x81, 0x8a, 0x5b, 0x10, 0x10, 0xa1, 0xd2, 0x34, 0x93, 0x23, 0x5f, 0xd1, 0x23, 0x28, 0xfe, 0x82, 0x6d, 0x10, 0xae, 0x2e, 0x7e, 0x04, 0xa0, 0x1a, 0xc7, 0xc3, 
+  0xa0, 0x8c, 0x67, 0x02, 0x3d, 0x84, 0xce, 0x39, 0xeb, 0x29, 0x4c, 0x61, 0x53, 0x6b, 0x8e, 0x2d, 0x28, 0x8d, 0x5e, 0xd5, 0xc4, 0x38, 0x6d, 0x09, 0x35, 0x1a, 0x57, 0x75, 0xe6, 0x70, 0x27, 0xed, 
+  0x44, 0x23, 0xa3, 0xb3, 0x54, 0x01, 0x29, 0xbf, 0xe2, 0x44, 0x27, 0xa2, 0xc2, 0x04, 0x6a, 0x8f, 0xd5, 0x7c, 0x92, 0xe8, 0xb6, 0xb2, 0x93, 0x2c, 0x0e, 0x69, 0xa2, 0x32, 0xd8, 0x83, 0x63, 0x1d, 
+  0x9c, 0x51, 0x3d, 0x88, 0xc9, 0x37, 0x8a, 0xb4, 0x6d, 0x41, 0xe5, 0xb6, 0xa3, 0x67, 0x3c, 0xb6, 0x42, 0xb6, 0x48, 0x1b, 0xeb, 0xef, 0x18, 0x75, 0x9c, 0xbd, 0x00, 0x1e, 0xad, 0xcf, 0x03, 0x6c, 
+  0xc5, 0x63, 0xbd, 0x2a, 0x6d, 0x90, 0xf1, 0xc6, 0xd9, 0x0b, 0x3c, 0x67, 0x37, 0xe8, 0x21, 0x90, 0x22, 0xd6, 0x87, 0x93, 0x2f, 0x94, 0x31, 0xb9, 0x2a, 0xee, 0x80, 0x34, 0x2b, 0x98, 0x77, 0x25, 
+  0x43, 0x6e, 0x0d, 0x10, 0x08, 0x5d, 0x60, 0xf8, 0x38, 0x8e, 0xe0, 0x27, 0xf7, 0xa2, 0x6f, 0x4c, 0x59, 0xcc, 0xc0, 0x85, 0x24, 0xeb, 0x7b, 0xa9, 0xd8, 0xf7, 0xcb, 0xb3, 0x5f, 0x53, 0xf8, 0xec, 
+  0x31, 0xcc, 0x1b, 0xdd, 0x76, 0x84, 0x0f, 0x35, 0x97, 0xf7, 0xa1, 0x54, 0xfd, 0x7b, 0xd5, 0xb8, 0xa3, 0xca, 0xdb, 0x66, 0x1e, 0x67, 0x64, 0xe7, 0x9c, 0x24, 0x74, 0xad, 0xbe, 0x8f, 0x5c, 0xb6, 
+  0x92, 0x68, 0xac, 0x08, 0xc1, 0x2c, 0x86, 0xc9, 0x6b, 0x1a, 0x46, 0x05, 0x82, 0x21, 0x60, 0x00, 0x5b, 0xc1, 0xe0, 0x27, 0x84, 0x16, 0x97, 0xd7, 0xcc, 0xc7, 0xa8, 0x1c, 0xcd, 0x1c, 0x94, 0x73, 
+  0xd8, 0x96, 0x01, 0x14, 0x44, 0x03, 0xb0, 0xc6, 0x40, 0xd6, 0x9a, 0x90, 0xa8, 0x82, 0xf4, 0x5a, 0x53, 0x7f, 0x9b, 0x63, 0x5b, 0xd4, 0xb3, 0xc2, 0xb9, 0xed, 0xaa, 0xd4, 0x96, 0x44, 0x14, 0x1e, 
+  0x46, 0x32, 0x0b, 0xe5, 0xa8, 0x93, 0xdb, 0xc9, 0x0f, 0xa9, 0x71, 0x9c, 0x7f, 0xc0, 0x12, 0x42, 0xe1, 0x11, 0x5b, 0x10, 0xb7, 0xa9, 0x3c, 0x30, 0xbe, 0xfe, 0x24, 0x57, 0x7b, 0xa3, 0xa9, 0x1e, 
+  0x03, 0x0f, 0x2e, 0xe2, 0xf1, 0xc1, 0xb5, 0xab, 0x99, 0xeb, 0x5f, 0xc6, 0xbd, 0xcd, 0x8d, 0x6a, 0xef, 0x9e, 0xa4, 0xd0, 0xde, 0x5b, 0x3f, 0xe3, 0xf7, 0x29, 0x72, 0x3c, 0x2e, 0x46, 0x16, 0x3f, 
+  0xa3, 0x61, 0xa8, 0xcc, 0x10, 0xdb, 0xe8, 0x35, 0x82, 0xe5, 0xc0, 0xcc, 0x6c, 0x83, 0x79, 0xb0, 0xc5, 0xdd, 0x5b, 0x15, 0x8f, 0x07, 0x67, 0xa5, 0x22, 0x25, 0x29, 0x3e, 0xad, 0x5e, 0x65, 0xfa, 
+  0x2c, 0x3d, 0xa9, 0xe5, 0xc5, 0xe9, 0x97, 0x83, 0x8f, 0x07, 0x30, 0x5c, 0xdc, 0x29, 0x58, 0xd6, 0xfa, 0x31, 0xd9, 0x95, 0x6e, 0xdc, 0x1b, 0x99, 0x61, 0xa9, 0x45, 0x53, 0x19, 0xc6, 0x48, 0xd7, 
+  0x1a, 0x37, 0x53, 0x10, 0xc3, 0x14, 0x3a, 0x67, 0xac, 0x2a, 0xa7, 0xf1, 0x12, 0x97, 0x68, 0x90, 0xa4, 0x2b, 0x18, 0x0c, 0xdc, 0x76, 0xe2, 0x33, 0x76, 0x59, 0x5a, 0xea, 0x35, 0xdf, 0xc7, 0xde, 
+  0xa0, 0x24, 0x64, 0xac, 0x3f, 0xf4, 0x58, 0x1e, 0x4d, 0xb2, 0x85, 0xea, 0xe4, 0x32, 0x1c, 0xa6, 0x09, 0x3b, 0x64, 0x70, 0x15, 0x50, 0xf4, 0xe1, 0xff, 0x48, 0xac, 0xe0, 0x76, 0x32, 0xb4, 0x82, 
+  0xff, 0x6a, 0xf2, 0x8f, 0x1c, 0x17, 0x14, 0x85, 0x5d, 0x1c, 0x23, 0xbd, 0x0b, 0xcc, 0xad, 0xdd, 0xf6, 0xee, 0x6f, 0xc9, 0xba, 0xc7, 0xe4, 0x3a, 0xc7, 0x0a, 0xca, 0x33, 0x1d, 0x26, 0x11, 0x61, 
+  0xe9, 0x55, 0x1b, 0x1a, 0xe9, 0x74, 0x9c, 0x8a, 0x6f, 0x36, 0xd2, 0xd8, 0x86, 0x6d, 0x46, 0xf5, 0xb6, 0x5b, 0xd5, 0x70, 0x7e, 0x76, 0xb9, 0x04, 0xcf, 0xfd, 0x1a, 0x03, 0x17, 0x2d, 0x89, 0xad, 
+  0x35, 0x4d, 0x86, 0xee, 0xfe, 0x17, 0x89, 0x9f, 0x9d, 0x7c, 0xee, 0x05, 0x00, 0x00, 
+};
+
+static const uint8_t update_htm_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x54, 0xdf, 0x4f, 0xdb, 0x30, 0x10, 0x7e, 0xef, 0x5f, 0x71, 0x80, 0x90, 0xdb, 0x01, 0x69, 0xe8, 0xa6, 0x3d, 0x74, 0x69, 0x1e, 
+  0x28, 0x20, 0x26, 0x81, 0x40, 0x5b, 0x91, 0xb6, 0xa7, 0xc9, 0x89, 0xaf, 0x89, 0x35, 0xc7, 0xce, 0x1c, 0xa7, 0x50, 0x4d, 0xfd, 0xdf, 0x77, 0x76, 0xda, 0x42, 0x11, 0x48, 0xd3, 0xb4, 0x48, 0x89, 
+  0x73, 0xbe, 0x1f, 0xdf, 0xdd, 0x7d, 0x67, 0x27, 0x7b, 0xe7, 0xb7, 0xd3, 0xd9, 0xf7, 0xbb, 0x0b, 0x28, 0x5d, 0xa5, 0xd2, 0x5e, 0x12, 0x96, 0xa4, 0x44, 0x2e, 0x48, 0x68, 0xdc, 0x52, 0x61, 0xda, 
+  0x3b, 0xa8, 0xad, 0x29, 0x2c, 0x36, 0x4d, 0xc6, 0xed, 0xbc, 0x55, 0x0a, 0x7e, 0xf7, 0x00, 0x32, 0x9e, 0xff, 0x2c, 0xac, 0x69, 0xb5, 0x38, 0xc9, 0x8d, 0x32, 0x76, 0x0c, 0x07, 0xa3, 0x78, 0x14, 
+  0x9f, 0x5e, 0x7e, 0xf2, 0x4a, 0x63, 0x05, 0xda, 0x13, 0xcb, 0x85, 0x6c, 0x9b, 0x31, 0x8c, 0xe2, 0xfa, 0xd1, 0x6f, 0x3f, 0x48, 0xe1, 0xca, 0x31, 0xbc, 0xdf, 0xc8, 0x35, 0x17, 0x42, 0xea, 0x62, 
+  0x0c, 0x1f, 0xbc, 0xbc, 0xda, 0x01, 0x7a, 0x1b, 0x64, 0x3a, 0x8d, 0xe3, 0xe7, 0xd1, 0x0e, 0xbd, 0x50, 0xa2, 0x2c, 0x4a, 0x37, 0x86, 0xd3, 0x8f, 0x5d, 0xe8, 0x17, 0x19, 0x9c, 0xc6, 0x1d, 0x42, 
+  0x32, 0x5c, 0xd7, 0x94, 0x0c, 0x43, 0x8d, 0x49, 0x66, 0xc4, 0xd2, 0x97, 0x3d, 0x4a, 0xef, 0x6b, 0xc1, 0x1d, 0x42, 0xb6, 0x84, 0x33, 0x6b, 0x1e, 0x1a, 0xb4, 0x64, 0x32, 0x22, 0xd5, 0xdc, 0xd8, 
+  0x0a, 0x2a, 0x74, 0xa5, 0x11, 0x13, 0x76, 0x77, 0xfb, 0x75, 0xc6, 0x80, 0xe7, 0x4e, 0x1a, 0x3d, 0x61, 0x07, 0x0c, 0x50, 0xe7, 0x6e, 0x59, 0xe3, 0x84, 0x55, 0xad, 0x72, 0xb2, 0xe6, 0xd6, 0x0d, 
+  0xbd, 0xc3, 0x09, 0xc5, 0xe2, 0x0c, 0x24, 0xb9, 0xb4, 0xb5, 0x32, 0x5c, 0xfc, 0xf0, 0xbb, 0x8c, 0xc2, 0x49, 0x5d, 0xb7, 0x0e, 0x3a, 0x9f, 0xb9, 0x54, 0xc8, 0x40, 0xf3, 0x0a, 0xbd, 0x99, 0x87, 
+  0xf7, 0x16, 0x99, 0x4d, 0xc3, 0xfb, 0xdc, 0xb2, 0x69, 0xb3, 0x4a, 0x3a, 0x06, 0x0b, 0xae, 0x5a, 0x12, 0xef, 0xb7, 0xc6, 0x01, 0x8d, 0x56, 0x21, 0x17, 0x01, 0xad, 0xb6, 0x05, 0x4b, 0xef, 0xd6, 
+  0x6d, 0x1c, 0x43, 0x7c, 0x98, 0x0c, 0x49, 0xf5, 0x64, 0xb0, 0xff, 0x82, 0xcb, 0xfd, 0xf4, 0x35, 0x0d, 0xed, 0x06, 0xb7, 0x8d, 0x73, 0x93, 0x5b, 0x59, 0xbb, 0xb4, 0x27, 0x4c, 0xde, 0x56, 0xa8, 
+  0x5d, 0x54, 0xa0, 0xbb, 0x50, 0xe8, 0x7f, 0xcf, 0x96, 0x9f, 0x45, 0x7f, 0xa7, 0xc8, 0x41, 0x44, 0xb4, 0x5e, 0x2c, 0x48, 0x77, 0x2d, 0x1b, 0x87, 0x1a, 0x6d, 0x7f, 0x93, 0xff, 0x31, 0xcc, 0x5b, 
+  0x1d, 0x9a, 0xd7, 0xc7, 0x41, 0x60, 0x18, 0xa3, 0xda, 0xa2, 0xb7, 0x3d, 0xc7, 0x39, 0xa7, 0x16, 0xf6, 0x07, 0x9e, 0xbd, 0x05, 0xf1, 0xff, 0x58, 0x5a, 0x98, 0x80, 0xc6, 0x07, 0xf8, 0x76, 0x73, 
+  0x7d, 0xe5, 0x5c, 0xfd, 0x05, 0x7f, 0xb5, 0xd8, 0xac, 0x2d, 0x48, 0x1b, 0x75, 0xa0, 0xaf, 0xa0, 0x6d, 0x2a, 0xd9, 0xc1, 0x5b, 0xb8, 0x0e, 0x11, 0x40, 0xce, 0xc1, 0x8b, 0x91, 0x42, 0x5d, 0xb8, 
+  0x72, 0x6a, 0x2a, 0xea, 0x33, 0xcf, 0x14, 0x6e, 0xf4, 0x1d, 0x7e, 0x8d, 0x1e, 0xff, 0x86, 0xbb, 0x32, 0x0a, 0x13, 0xd8, 0xb9, 0x10, 0x20, 0x0a, 0x18, 0x82, 0x17, 0x9c, 0x71, 0x5c, 0xc1, 0x3b, 
+  0x1a, 0xae, 0x38, 0xe4, 0xe4, 0x9f, 0x37, 0x3b, 0xe4, 0x89, 0x19, 0x44, 0x52, 0x53, 0x82, 0x57, 0xb3, 0x9b, 0x6b, 0x0a, 0xcd, 0x9e, 0x68, 0x62, 0x70, 0x14, 0xf0, 0x8e, 0x80, 0x1d, 0xb2, 0xbf, 
+  0x08, 0xb5, 0x25, 0x8a, 0x42, 0x86, 0x81, 0x8e, 0xc2, 0x61, 0xa0, 0xa0, 0x2f, 0xa2, 0xac, 0xe8, 0xbb, 0xa2, 0x2e, 0x70, 0xd5, 0xe0, 0xb6, 0x6f, 0x46, 0xfb, 0x32, 0xc8, 0x78, 0xdb, 0x9c, 0x4d, 
+  0xe5, 0xff, 0x96, 0x7d, 0xd3, 0xe6, 0xb9, 0xef, 0x76, 0x07, 0x99, 0x1b, 0xdd, 0x18, 0xca, 0x48, 0x99, 0xc2, 0xf3, 0x1e, 0x54, 0x7b, 0x2c, 0x80, 0xaf, 0x9e, 0x32, 0x40, 0x6b, 0x8d, 0xfd, 0x7f, 
+  0x29, 0x84, 0x70, 0x6c, 0x17, 0xa3, 0x46, 0xdd, 0xef, 0x0e, 0xec, 0x31, 0xb0, 0xe1, 0xfa, 0x7c, 0x6d, 0x9b, 0xd0, 0x20, 0x51, 0xea, 0xa7, 0xeb, 0x92, 0x66, 0xf6, 0x9c, 0x4e, 0x6b, 0xdf, 0x95, 
+  0xb2, 0x19, 0x90, 0x7e, 0x45, 0x2f, 0xdd, 0x13, 0xeb, 0x91, 0x4f, 0x86, 0xe1, 0x8a, 0xa0, 0xcb, 0x20, 0x5c, 0x90, 0x7f, 0x00, 0x29, 0x85, 0xa8, 0xf8, 0x31, 0x05, 0x00, 0x00, 
+};
+
+const webserver_asset_t webserver_assets[] = {
+    { "/index.htm", "text/html", "\"4696b220\"", index_htm_gz, sizeof( index_htm_gz ) },
+    { "/mirror.htm", "text/html", "\"3e416c26\"", mirror_htm_gz, sizeof( mirror_htm_gz ) },
+    { "/nav.htm", "text/html", "\"fd9d5bc5\"", nav_htm_gz, sizeof( nav_htm_gz ) },
+    { "/update.htm", "text/html", "\"273d3e46\"", update_htm_gz, sizeof( update_htm_gz ) },
+    { NULL, NULL, NULL, NULL, 0 }
+};
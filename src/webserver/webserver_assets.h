@@ -0,0 +1,43 @@
+/****************************************************************************
+ *   Oct 22 20:14:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _WEBSERVER_ASSETS_H
+    #define _WEBSERVER_ASSETS_H
+
+    #include <Arduino.h>
+
+    /**
+     * gzip compressed static page in flash, generated with tools/html2gz.py from src/webserver/html
+     */
+    typedef struct {
+        const char *path;
+        const char *mime;
+        const char *etag;                   // crc32 of the compressed data, quoted
+        const uint8_t *data;
+        size_t size;
+    } webserver_asset_t;
+
+    /**
+     * all assets, terminated by an entry with path NULL
+     */
+    extern const webserver_asset_t webserver_assets[];
+
+#endif // _WEBSERVER_ASSETS_H
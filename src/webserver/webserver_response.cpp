@@ -0,0 +1,141 @@
+/****************************************************************************
+ *   Oct 22 20:14:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#include "config.h"
+
+#include "webserver_response.h"
+
+static size_t webserver_template_fill( webserver_template_t *state, uint8_t *buffer, size_t maxLen );
+
+void webserver_send_asset( AsyncWebServerRequest *request, const webserver_asset_t *asset ) {
+    if ( request->hasHeader( "If-None-Match" ) && request->header( "If-None-Match" ) == asset->etag ) {
+        request->send( 304 );
+        return;
+    }
+
+    AsyncWebServerResponse *response = request->beginResponse_P( 200, asset->mime, asset->data, asset->size );
+    response->addHeader( "Content-Encoding", "gzip" );
+    response->addHeader( "Cache-Control", WEBSERVER_ASSET_CACHE_CONTROL );
+    response->addHeader( "ETag", asset->etag );
+    request->send( response );
+}
+
+const webserver_asset_t *webserver_find_asset( const char *path ) {
+    for ( const webserver_asset_t *asset = webserver_assets ; asset->path != NULL ; asset++ ) {
+        if ( !strcmp( asset->path, path ) ) {
+            return( asset );
+        }
+    }
+    return( NULL );
+}
+
+void webserver_add_assets( AsyncWebServer *server ) {
+    for ( const webserver_asset_t *asset = webserver_assets ; asset->path != NULL ; asset++ ) {
+        server->on( asset->path, HTTP_GET, [ asset ]( AsyncWebServerRequest *request ) {
+            webserver_send_asset( request, asset );
+        });
+    }
+}
+
+void webserver_send_template( AsyncWebServerRequest *request, const char *mime, const char *tpl, WEBSERVER_TEMPLATE_FUNC func ) {
+    webserver_template_t state;
+
+    state.tpl = tpl;
+    state.pos = 0;
+    state.func = func;
+    state.field[ 0 ] = '\0';
+    state.index = 0;
+    state.more = false;
+    state.out_pos = 0;
+    state.out_len = 0;
+
+    /*
+     * the state is copied into the callback and freed together with the response
+     */
+    AsyncWebServerResponse *response = request->beginChunkedResponse( mime, [ state ]( uint8_t *buffer, size_t maxLen, size_t index ) mutable -> size_t {
+        return( webserver_template_fill( &state, buffer, maxLen ) );
+    });
+    response->addHeader( "Cache-Control", "no-cache" );
+    request->send( response );
+}
+
+static size_t webserver_template_fill( webserver_template_t *state, uint8_t *buffer, size_t maxLen ) {
+    size_t len = 0;
+
+    while( len < maxLen ) {
+        /*
+         * copy what is left from the last field
+         */
+        if ( state->out_pos < state->out_len ) {
+            size_t n = state->out_len - state->out_pos;
+            if ( n > maxLen - len ) {
+                n = maxLen - len;
+            }
+            memcpy( buffer + len, state->out + state->out_pos, n );
+            state->out_pos += n;
+            len += n;
+            continue;
+        }
+        /*
+         * next row of a repeated field
+         */
+        if ( state->more ) {
+            state->out[ 0 ] = '\0';
+            state->more = state->func( state->field, state->index++, state->out, sizeof( state->out ) );
+            state->out_len = strlen( state->out );
+            state->out_pos = 0;
+            continue;
+        }
+
+        const char *tpl = state->tpl + state->pos;
+        if ( *tpl == '\0' ) {
+            break;
+        }
+        if ( *tpl != '%' ) {
+            size_t n = strcspn( tpl, "%" );
+            if ( n > maxLen - len ) {
+                n = maxLen - len;
+            }
+            memcpy( buffer + len, tpl, n );
+            state->pos += n;
+            len += n;
+            continue;
+        }
+        if ( tpl[ 1 ] == '%' ) {
+            buffer[ len++ ] = '%';
+            state->pos += 2;
+            continue;
+        }
+
+        const char *end = strchr( tpl + 1, '%' );
+        size_t n = end ? end - ( tpl + 1 ) : 0;
+        if ( end == NULL || n >= sizeof( state->field ) ) {
+            log_e("broken template field at %d", state->pos );
+            break;
+        }
+        memcpy( state->field, tpl + 1, n );
+        state->field[ n ] = '\0';
+        state->pos += n + 2;
+        state->index = 0;
+        state->more = true;
+    }
+    return( len );
+}
@@ -0,0 +1,93 @@
+/****************************************************************************
+ *   Oct 22 20:14:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef _WEBSERVER_RESPONSE_H
+    #define _WEBSERVER_RESPONSE_H
+
+    #include <ESPAsyncWebServer.h>
+    #include "webserver_assets.h"
+
+    #define WEBSERVER_ASSET_CACHE_CONTROL   "public, max-age=604800"
+    #define WEBSERVER_TEMPLATE_FIELD_LEN    24              // max field name length in a template
+    #define WEBSERVER_TEMPLATE_LINE_SIZE    256             // max output of one field
+
+    /**
+     * @brief   template field callback, write the value of a field into buf.
+     *          fields that produce table rows are called again with index + 1 as long as they return true
+     * 
+     * @param   field   field name without the surrounding %
+     * @param   index   0 on the first call of this field, counts up for repeated rows
+     * @param   buf     output buffer, terminated with zero
+     * @param   size    size of buf
+     * 
+     * @return  true if the field should be called again with the next index
+     */
+    typedef bool ( * WEBSERVER_TEMPLATE_FUNC ) ( const char *field, uint32_t index, char *buf, size_t size );
+
+    /**
+     * render state of a template response, lives inside the chunked response callback
+     */
+    typedef struct {
+        const char *tpl;                                // template text, %name% is a field, %% a single %
+        size_t pos;                                     // read position in tpl
+        WEBSERVER_TEMPLATE_FUNC func;
+        char field[ WEBSERVER_TEMPLATE_FIELD_LEN ];     // field in progress
+        uint32_t index;
+        bool more;                                      // the field wants to be called again
+        char out[ WEBSERVER_TEMPLATE_LINE_SIZE ];       // output of the last field call
+        size_t out_pos;
+        size_t out_len;
+    } webserver_template_t;
+
+    /**
+     * @brief   send a gzip compressed asset from flash with Content-Encoding and cache headers,
+     *          a matching If-None-Match is answered with 304
+     * 
+     * @param   request     pointer to the request
+     * @param   asset       pointer to the asset
+     */
+    void webserver_send_asset( AsyncWebServerRequest *request, const webserver_asset_t *asset );
+    /**
+     * @brief   find an asset by path
+     * 
+     * @param   path        path like "/index.htm"
+     * 
+     * @return  pointer to the asset or NULL if not found
+     */
+    const webserver_asset_t *webserver_find_asset( const char *path );
+    /**
+     * @brief   register all assets from webserver_assets[] at the server
+     * 
+     * @param   server      pointer to the AsyncWebServer
+     */
+    void webserver_add_assets( AsyncWebServer *server );
+    /**
+     * @brief   send a template as chunked response, the fields are rendered one by one into a fixed
+     *          buffer while the response is sent, no String is build
+     * 
+     * @param   request     pointer to the request
+     * @param   mime        content type
+     * @param   tpl         template text, must stay valid
+     * @param   func        field callback
+     */
+    void webserver_send_template( AsyncWebServerRequest *request, const char *mime, const char *tpl, WEBSERVER_TEMPLATE_FUNC func );
+
+#endif // _WEBSERVER_RESPONSE_H
@@ -0,0 +1,109 @@
+/****************************************************************************
+ *   Nov 07 14:20:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * arduino core shim for the host tests, see LilyGoWatch.h
+ */
+#ifndef _SHIM_ARDUINO_H
+    #define _SHIM_ARDUINO_H
+
+    #include <stdarg.h>
+    #include <stdint.h>
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+
+    #include "freertos/FreeRTOS.h"
+
+    #define IRAM_ATTR
+    #define DRAM_ATTR
+    #define _BV( bit )                  ( 1UL << ( bit ) )
+
+    #define MALLOC_CAP_INTERNAL         _BV(0)
+    #define MALLOC_CAP_8BIT             _BV(1)
+    #define MALLOC_CAP_SPIRAM           _BV(2)
+
+    /*
+     * the test advances the time, nothing runs in the background
+     */
+    inline uint64_t shim_time_us = 0;
+
+    static inline unsigned long millis( void ) { return( shim_time_us / 1000 ); }
+    static inline unsigned long micros( void ) { return( shim_time_us ); }
+    static inline void delay( uint32_t ms ) { shim_time_us += (uint64_t)ms * 1000; }
+
+    /*
+     * set shim_log to see the module log on stderr
+     */
+    inline bool shim_log = false;
+
+    __attribute__((format( printf, 2, 3 ))) static inline void shim_log_printf( const char *level, const char *format, ... ) {
+        va_list args;
+
+        if ( !shim_log ) {
+            return;
+        }
+        va_start( args, format );
+        fprintf( stderr, "[%s] ", level );
+        vfprintf( stderr, format, args );
+        fprintf( stderr, "\n" );
+        va_end( args );
+    }
+
+    #define log_e( ... )                shim_log_printf( "E", __VA_ARGS__ )
+    #define log_w( ... )                shim_log_printf( "W", __VA_ARGS__ )
+    #define log_i( ... )                shim_log_printf( "I", __VA_ARGS__ )
+    #define log_d( ... )                shim_log_printf( "D", __VA_ARGS__ )
+    #define log_v( ... )                shim_log_printf( "V", __VA_ARGS__ )
+
+    /*
+     * no psram on the host, count the allocations that a test can fail
+     */
+    inline uint32_t shim_malloc_fail = 0;      // fail the next n allocations
+
+    static inline void *shim_malloc( size_t size ) {
+        if ( shim_malloc_fail ) {
+            shim_malloc_fail--;
+            return( NULL );
+        }
+        return( malloc( size ) );
+    }
+
+    static inline void *ps_malloc( size_t size ) { return( shim_malloc( size ) ); }
+    static inline void *ps_calloc( size_t n, size_t size ) { void *p = shim_malloc( n * size ); if ( p ) memset( p, 0, n * size ); return( p ); }
+    static inline void *ps_realloc( void *p, size_t size ) { return( shim_malloc_fail ? shim_malloc( size ) : realloc( p, size ) ); }
+    static inline void *heap_caps_malloc( size_t size, uint32_t caps ) { (void)caps; return( shim_malloc( size ) ); }
+    static inline void *heap_caps_calloc( size_t n, size_t size, uint32_t caps ) { (void)caps; return( ps_calloc( n, size ) ); }
+    static inline void *heap_caps_realloc( void *p, size_t size, uint32_t caps ) { (void)caps; return( ps_realloc( p, size ) ); }
+
+    static inline size_t shim_strlcpy( char *dst, const char *src, size_t size ) {
+        size_t len = strlen( src );
+
+        if ( size ) {
+            size_t n = len < size - 1 ? len : size - 1;
+            memcpy( dst, src, n );
+            dst[ n ] = '\0';
+        }
+        return( len );
+    }
+    #define strlcpy                     shim_strlcpy
+
+#endif // _SHIM_ARDUINO_H
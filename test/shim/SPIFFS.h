@@ -0,0 +1,116 @@
+/****************************************************************************
+ *   Nov 07 14:20:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * in memory SPIFFS shim for the host tests, a test can look at and change
+ * the files in shim_files and let writes or renames fail
+ */
+#ifndef _SHIM_SPIFFS_H
+    #define _SHIM_SPIFFS_H
+
+    #include <map>
+    #include <string>
+    #include <vector>
+
+    #include "Arduino.h"
+
+    #define FILE_READ                   "r"
+    #define FILE_WRITE                  "w"
+    #define FILE_APPEND                 "a"
+
+    inline std::map< std::string, std::vector< uint8_t > > shim_files;
+    inline uint32_t shim_files_writes = 0;      // files opened for write or append
+    inline bool shim_files_write_fail = false;  // writes store nothing
+    inline bool shim_files_rename_fail = false;
+
+    namespace fs {
+
+        class File {
+            public:
+                File() : _file( NULL ), _pos( 0 ) {}
+                File( std::vector< uint8_t > *file ) : _file( file ), _pos( 0 ) {}
+
+                operator bool() const { return( _file != NULL ); }
+                size_t size( void ) const { return( _file ? _file->size() : 0 ); }
+                size_t position( void ) const { return( _pos ); }
+                bool seek( size_t pos ) { if ( !_file || pos > _file->size() ) return( false ); _pos = pos; return( true ); }
+                int available( void ) const { return( _file ? (int)( _file->size() - _pos ) : 0 ); }
+                void close( void ) { _file = NULL; }
+
+                size_t read( uint8_t *buf, size_t len ) {
+                    if ( !_file ) {
+                        return( 0 );
+                    }
+                    if ( len > _file->size() - _pos ) {
+                        len = _file->size() - _pos;
+                    }
+                    memcpy( buf, _file->data() + _pos, len );
+                    _pos += len;
+                    return( len );
+                }
+
+                size_t write( const uint8_t *buf, size_t len ) {
+                    if ( !_file || shim_files_write_fail ) {
+                        return( 0 );
+                    }
+                    _file->insert( _file->end(), buf, buf + len );
+                    _pos = _file->size();
+                    return( len );
+                }
+
+            private:
+                std::vector< uint8_t > *_file;
+                size_t _pos;
+        };
+
+        class FS {
+            public:
+                bool begin( bool format = false ) { (void)format; return( true ); }
+                bool exists( const char *path ) { return( shim_files.count( path ) != 0 ); }
+                bool remove( const char *path ) { return( shim_files.erase( path ) != 0 ); }
+
+                bool rename( const char *from, const char *to ) {
+                    if ( shim_files_rename_fail || !exists( from ) ) {
+                        return( false );
+                    }
+                    shim_files[ to ] = shim_files[ from ];
+                    shim_files.erase( from );
+                    return( true );
+                }
+
+                File open( const char *path, const char *mode = FILE_READ ) {
+                    if ( mode[ 0 ] == 'r' ) {
+                        return( exists( path ) ? File( &shim_files[ path ] ) : File() );
+                    }
+                    shim_files_writes++;
+                    if ( mode[ 0 ] == 'w' ) {
+                        shim_files[ path ].clear();
+                    }
+                    File file( &shim_files[ path ] );
+                    file.seek( file.size() );
+                    return( file );
+                }
+        };
+    }
+
+    inline fs::FS SPIFFS;
+
+#endif // _SHIM_SPIFFS_H
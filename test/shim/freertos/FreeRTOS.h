@@ -0,0 +1,57 @@
+/****************************************************************************
+ *   Nov 07 14:20:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * freertos shim for the host tests, the tests are single threaded: a mutex
+ * is always free, a critical section does nothing
+ */
+#ifndef _SHIM_FREERTOS_H
+    #define _SHIM_FREERTOS_H
+
+    #include <stdint.h>
+
+    typedef uint32_t EventBits_t;
+    typedef uint32_t TickType_t;
+    typedef int BaseType_t;
+    typedef void *SemaphoreHandle_t;
+    typedef void *QueueHandle_t;
+    typedef void *TaskHandle_t;
+    typedef int portMUX_TYPE;
+
+    #define pdTRUE                      1
+    #define pdFALSE                     0
+    #define portMAX_DELAY               0xffffffff
+    #define pdMS_TO_TICKS( ms )         ( ms )
+    #define portMUX_INITIALIZER_UNLOCKED 0
+
+    #define portENTER_CRITICAL( mux )       ( (void)( mux ) )
+    #define portEXIT_CRITICAL( mux )        ( (void)( mux ) )
+    #define portENTER_CRITICAL_ISR( mux )   ( (void)( mux ) )
+    #define portEXIT_CRITICAL_ISR( mux )    ( (void)( mux ) )
+
+    inline int shim_semaphore;
+
+    static inline SemaphoreHandle_t xSemaphoreCreateMutex( void ) { return( &shim_semaphore ); }
+    static inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex( void ) { return( &shim_semaphore ); }
+    static inline BaseType_t xSemaphoreTake( SemaphoreHandle_t sem, TickType_t ticks ) { (void)sem; (void)ticks; return( pdTRUE ); }
+    static inline BaseType_t xSemaphoreGive( SemaphoreHandle_t sem ) { (void)sem; return( pdTRUE ); }
+
+#endif // _SHIM_FREERTOS_H
@@ -0,0 +1,42 @@
+/****************************************************************************
+ *   Nov 07 14:20:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * esp32 rom crc shim for the host tests, same polynom and inversion as the rom
+ */
+#ifndef _SHIM_ROM_CRC_H
+    #define _SHIM_ROM_CRC_H
+
+    #include <stddef.h>
+    #include <stdint.h>
+
+    static inline uint32_t crc32_le( uint32_t crc, const uint8_t *buf, size_t len ) {
+        crc = ~crc;
+        while ( len-- ) {
+            crc ^= *buf++;
+            for ( int bit = 0 ; bit < 8 ; bit++ ) {
+                crc = ( crc >> 1 ) ^ ( 0xedb88320 & -( crc & 1 ) );
+            }
+        }
+        return( ~crc );
+    }
+
+#endif // _SHIM_ROM_CRC_H
@@ -0,0 +1,143 @@
+/****************************************************************************
+ *   Nov 05 19:02:11 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host tests of the activity kernel with synthetic windows, run with: pio test -e native
+ */
+#include <math.h>
+#include <unity.h>
+
+#include "hardware/activity.h"
+
+static int16_t test_xyz[ ACTIVITY_WINDOW * 3 ];
+static uint32_t test_sample;
+static activity_state_t test_state;
+
+/*
+ * wrist at rest with gravity on z plus a vertical oscillation of amplitude mg at frequency mHz
+ */
+static void test_window( int amplitude, int frequency ) {
+    for ( int i = 0 ; i < ACTIVITY_WINDOW ; i++, test_sample++ ) {
+        float phase = 2.0f * M_PI * frequency * test_sample / ACTIVITY_RATE_MHZ;
+        test_xyz[ i * 3 + 0 ] = 50;
+        test_xyz[ i * 3 + 1 ] = -30;
+        test_xyz[ i * 3 + 2 ] = 1000 + amplitude * sinf( phase );
+    }
+}
+
+void setUp( void ) {
+    test_sample = 0;
+    activity_init( &test_state );
+}
+
+void tearDown( void ) {
+}
+
+static void test_features( void ) {
+    activity_features_t features;
+
+    test_window( 0, 0 );
+    activity_features( test_xyz, NULL, &features );
+    TEST_ASSERT_EQUAL_INT( 0, features.var );
+    TEST_ASSERT_EQUAL_INT( 0, features.crossings );
+    TEST_ASSERT_EQUAL_INT( 0, features.tilt );
+    TEST_ASSERT_EQUAL_INT( 1000, features.gravity[ 2 ] );
+    /*
+     * the magnitude approximation is within 8% of the euclidean length
+     */
+    TEST_ASSERT_FLOAT_WITHIN( 80, 1002, features.mean );
+
+    const int16_t last[ 3 ] = { 0, 0, 1000 };
+    activity_features( test_xyz, last, &features );
+    TEST_ASSERT_EQUAL_INT( 80, features.tilt );
+
+    test_window( 200, 2000 );
+    activity_features( test_xyz, NULL, &features );
+    TEST_ASSERT_GREATER_THAN( ACTIVITY_WALK_VAR, features.var );
+    TEST_ASSERT_GREATER_THAN( ACTIVITY_WALK_CROSSINGS - 1, features.crossings );
+}
+
+static void test_still( void ) {
+    for ( int w = 0 ; w < 10 ; w++ ) {
+        test_window( 0, 0 );
+        TEST_ASSERT_EQUAL_INT( ACTIVITY_STILL, activity_classify( test_xyz, &test_state, NULL ) );
+    }
+}
+
+/*
+ * a gait is reported after ACTIVITY_GAIT_WINDOWS, a single window is a gesture
+ */
+static void test_walk_run( void ) {
+    test_window( 200, 1800 );
+    TEST_ASSERT_EQUAL_INT( ACTIVITY_STILL, activity_classify( test_xyz, &test_state, NULL ) );
+    test_window( 0, 0 );
+    TEST_ASSERT_EQUAL_INT( ACTIVITY_STILL, activity_classify( test_xyz, &test_state, NULL ) );
+
+    for ( int w = 0 ; w < ACTIVITY_GAIT_WINDOWS ; w++ ) {
+        test_window( 200, 1800 );
+        TEST_ASSERT_EQUAL_INT( w < ACTIVITY_GAIT_WINDOWS - 1 ? ACTIVITY_STILL : ACTIVITY_WALK, activity_classify( test_xyz, &test_state, NULL ) );
+    }
+
+    setUp();
+    for ( int w = 0 ; w < ACTIVITY_GAIT_WINDOWS ; w++ ) {
+        test_window( 800, 2800 );
+        TEST_ASSERT_EQUAL_INT( w < ACTIVITY_GAIT_WINDOWS - 1 ? ACTIVITY_STILL : ACTIVITY_RUN, activity_classify( test_xyz, &test_state, NULL ) );
+    }
+}
+
+/*
+ * sleep after ACTIVITY_SLEEP_ONSET windows at rest, with the margin turning over does not wake up
+ */
+static void test_sleep( void ) {
+    for ( int w = 0 ; w < ACTIVITY_SLEEP_ONSET ; w++ ) {
+        test_window( 0, 0 );
+        TEST_ASSERT_EQUAL_INT( w < ACTIVITY_SLEEP_ONSET - 1 ? ACTIVITY_STILL : ACTIVITY_SLEEP, activity_classify( test_xyz, &test_state, NULL ) );
+    }
+    for ( int w = 0 ; w < ACTIVITY_SLEEP_MARGIN ; w++ ) {
+        test_window( 0, 0 );
+        TEST_ASSERT_EQUAL_INT( ACTIVITY_SLEEP, activity_classify( test_xyz, &test_state, NULL ) );
+    }
+    for ( int w = 0 ; w < ACTIVITY_WAKE_WINDOWS - 1 ; w++ ) {
+        test_window( 200, 1800 );
+        TEST_ASSERT_EQUAL_INT( ACTIVITY_SLEEP, activity_classify( test_xyz, &test_state, NULL ) );
+    }
+    test_window( 200, 1800 );
+    TEST_ASSERT_EQUAL_INT( ACTIVITY_WALK, activity_classify( test_xyz, &test_state, NULL ) );
+    test_window( 0, 0 );
+    TEST_ASSERT_EQUAL_INT( ACTIVITY_STILL, activity_classify( test_xyz, &test_state, NULL ) );
+}
+
+static void test_name( void ) {
+    TEST_ASSERT_EQUAL_STRING( "still", activity_get_name( ACTIVITY_STILL ) );
+    TEST_ASSERT_EQUAL_STRING( "sleep", activity_get_name( ACTIVITY_SLEEP ) );
+    TEST_ASSERT_EQUAL_STRING( "unknown", activity_get_name( ACTIVITY_NUM ) );
+    TEST_ASSERT_EQUAL_STRING( "unknown", activity_get_name( -1 ) );
+}
+
+int main( void ) {
+    UNITY_BEGIN();
+    RUN_TEST( test_features );
+    RUN_TEST( test_still );
+    RUN_TEST( test_walk_run );
+    RUN_TEST( test_sleep );
+    RUN_TEST( test_name );
+    return( UNITY_END() );
+}
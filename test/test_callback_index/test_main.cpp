@@ -0,0 +1,124 @@
+/****************************************************************************
+ *   Nov 05 19:02:11 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host tests of the callback event index, run with: pio test -e native
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+#include "hardware/callback_index.h"
+
+typedef struct {
+    uint32_t event;
+    void *callback_func;
+    const char *id;
+} test_table_t;
+
+static uint8_t test_entry[ 255 * CALLBACK_EVENT_BITS ];
+static callback_index_t test_index;
+
+void setUp( void ) {
+    memset( test_entry, 0xff, sizeof( test_entry ) );
+    test_index.entry = test_entry;
+}
+
+void tearDown( void ) {
+}
+
+static void test_bit( void ) {
+    TEST_ASSERT_EQUAL_INT( -1, callback_index_bit( 0 ) );
+    TEST_ASSERT_EQUAL_INT( 0, callback_index_bit( 1 ) );
+    TEST_ASSERT_EQUAL_INT( 5, callback_index_bit( 1UL << 5 ) );
+    TEST_ASSERT_EQUAL_INT( CALLBACK_EVENT_BITS - 1, callback_index_bit( 1UL << ( CALLBACK_EVENT_BITS - 1 ) ) );
+    TEST_ASSERT_EQUAL_INT( -1, callback_index_bit( 1UL << CALLBACK_EVENT_BITS ) );
+    TEST_ASSERT_EQUAL_INT( -1, callback_index_bit( 0x3 ) );
+}
+
+static void test_empty( void ) {
+    TEST_ASSERT_EQUAL_UINT32( 0, callback_index_size( NULL, sizeof( test_table_t ), 0 ) );
+    callback_index_fill( &test_index, NULL, sizeof( test_table_t ), 0 );
+    for ( int bit = 0 ; bit <= CALLBACK_EVENT_BITS ; bit++ ) {
+        TEST_ASSERT_EQUAL_INT( 0, test_index.start[ bit ] );
+    }
+}
+
+static void test_order( void ) {
+    test_table_t table[] = {
+        { 0x01, NULL, "a" },
+        { 0x06, NULL, "b" },
+        { 0x02, NULL, "c" },
+        { 0x01 | 0xff000000, NULL, "d" },      // the freertos bits are not indexed
+    };
+    const uint32_t entrys = sizeof( table ) / sizeof( table[ 0 ] );
+
+    TEST_ASSERT_EQUAL_UINT32( 5, callback_index_size( &table[ 0 ].event, sizeof( test_table_t ), entrys ) );
+    callback_index_fill( &test_index, &table[ 0 ].event, sizeof( test_table_t ), entrys );
+
+    /*
+     * bit 0: a, d  bit 1: b, c  bit 2: b, in registration order
+     */
+    TEST_ASSERT_EQUAL_INT( 0, test_index.start[ 0 ] );
+    TEST_ASSERT_EQUAL_INT( 2, test_index.start[ 1 ] );
+    TEST_ASSERT_EQUAL_INT( 4, test_index.start[ 2 ] );
+    TEST_ASSERT_EQUAL_INT( 5, test_index.start[ 3 ] );
+    TEST_ASSERT_EQUAL_INT( 5, test_index.start[ CALLBACK_EVENT_BITS ] );
+    const uint8_t expected[] = { 0, 3, 1, 2, 1 };
+    TEST_ASSERT_EQUAL_MEMORY( expected, test_entry, sizeof( expected ) );
+    TEST_ASSERT_EQUAL_UINT8( 0xff, test_entry[ sizeof( expected ) ] );
+}
+
+/*
+ * the index visits the same entrys in the same order as the table scan
+ */
+static void test_scan( void ) {
+    static test_table_t table[ 255 ];
+
+    srand( 1 );
+    for ( int entry = 0 ; entry < 255 ; entry++ ) {
+        table[ entry ].event = ( 1UL << ( rand() % CALLBACK_EVENT_BITS ) ) | ( 1UL << ( rand() % CALLBACK_EVENT_BITS ) );
+    }
+    uint32_t size = callback_index_size( &table[ 0 ].event, sizeof( test_table_t ), 255 );
+    TEST_ASSERT_LESS_OR_EQUAL( sizeof( test_entry ), size );
+    callback_index_fill( &test_index, &table[ 0 ].event, sizeof( test_table_t ), 255 );
+    TEST_ASSERT_EQUAL_UINT32( size, test_index.start[ CALLBACK_EVENT_BITS ] );
+
+    for ( int bit = 0 ; bit < CALLBACK_EVENT_BITS ; bit++ ) {
+        int i = test_index.start[ bit ];
+        for ( int entry = 0 ; entry < 255 ; entry++ ) {
+            if ( table[ entry ].event & ( 1UL << bit ) ) {
+                TEST_ASSERT_TRUE( i < test_index.start[ bit + 1 ] );
+                TEST_ASSERT_EQUAL_INT( entry, test_entry[ i++ ] );
+            }
+        }
+        TEST_ASSERT_EQUAL_INT( test_index.start[ bit + 1 ], i );
+    }
+}
+
+int main( void ) {
+    UNITY_BEGIN();
+    RUN_TEST( test_bit );
+    RUN_TEST( test_empty );
+    RUN_TEST( test_order );
+    RUN_TEST( test_scan );
+    return( UNITY_END() );
+}
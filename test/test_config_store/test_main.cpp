@@ -0,0 +1,288 @@
+/****************************************************************************
+ *   Nov 07 14:20:05 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host tests of the config store through its setup path on the SPIFFS and
+ * freertos shims of test/shim, run with: pio test -e native
+ *
+ * the module is included to reset its static state between the tests, a
+ * test reboots the watch with test_reboot() and keeps the shim files
+ */
+#include <unity.h>
+
+#include "hardware/config_store.cpp"
+
+typedef struct {
+    uint32_t interval;
+    char name[ 16 ];
+    bool enable;
+} test_config_t;
+
+typedef struct {
+    uint32_t interval;
+} test_config_v0_t;
+
+static EventBits_t test_event = 0;
+static CALLBACK_FUNC test_event_cb = NULL;
+static CALLBACK_FUNC test_loop_cb = NULL;
+static uint32_t test_deadline = 0;
+static int test_migrated = 0;
+static test_config_t test_config;
+
+/*
+ * powermgm as seen by the config store
+ */
+bool powermgm_register_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id ) {
+    (void)id;
+    test_event = event;
+    test_event_cb = callback_func;
+    return( true );
+}
+
+bool powermgm_register_loop_cb( EventBits_t event, CALLBACK_FUNC callback_func, const char *id ) {
+    (void)event;
+    (void)id;
+    test_loop_cb = callback_func;
+    return( true );
+}
+
+void powermgm_set_next_deadline( uint32_t ms ) {
+    test_deadline = ms;
+}
+
+static void test_defaults( void ) {
+    test_config.interval = 15;
+    strlcpy( test_config.name, "watch", sizeof( test_config.name ) );
+    test_config.enable = true;
+}
+
+static void test_migrate( void ) {
+    test_config.interval = 30;
+    test_migrated++;
+    config_store_save( &test_config );
+}
+
+static bool test_upgrade( uint16_t version, const void *data, uint16_t size ) {
+    if ( version != 0 || size != sizeof( test_config_v0_t ) ) {
+        return( false );
+    }
+    test_defaults();
+    test_config.interval = ( (const test_config_v0_t *)data )->interval;
+    return( true );
+}
+
+/*
+ * forget everything that is not on flash, like a reset of the watch
+ */
+static void test_reboot( void ) {
+    free( config_store_data );
+    config_store_data = NULL;
+    memset( &config_store_header, 0, sizeof( config_store_header ) );
+    memset( config_store_entry, 0, sizeof( config_store_entry ) );
+    config_store_entrys = 0;
+    config_store_dirty = false;
+    config_store_last_change = 0;
+    config_store_mutex = NULL;
+    test_event = 0;
+    test_event_cb = NULL;
+    test_loop_cb = NULL;
+    test_deadline = 0;
+    test_migrated = 0;
+    test_defaults();
+    config_store_setup();
+}
+
+void setUp( void ) {
+    shim_files.clear();
+    shim_files_writes = 0;
+    shim_files_write_fail = false;
+    shim_files_rename_fail = false;
+    shim_time_us = 0;
+    test_reboot();
+}
+
+void tearDown( void ) {
+}
+
+static void test_first_boot_migrates( void ) {
+    TEST_ASSERT_EQUAL( POWERMGM_STANDBY, test_event );
+    TEST_ASSERT_NOT_NULL( test_event_cb );
+    TEST_ASSERT_NOT_NULL( test_loop_cb );
+    TEST_ASSERT_FALSE( config_store_register( "test", &test_config, sizeof( test_config ), test_migrate ) );
+    TEST_ASSERT_EQUAL( 1, test_migrated );
+    TEST_ASSERT_EQUAL( 30, test_config.interval );
+    TEST_ASSERT_EQUAL( 0, shim_files_writes );
+
+    TEST_ASSERT_TRUE( config_store_commit() );
+    TEST_ASSERT_EQUAL( 1, shim_files_writes );
+    TEST_ASSERT_TRUE( SPIFFS.exists( CONFIG_STORE_FILE ) );
+    TEST_ASSERT_FALSE( SPIFFS.exists( CONFIG_STORE_TMP_FILE ) );
+}
+
+static void test_reboot_reads_store( void ) {
+    config_store_register( "test", &test_config, sizeof( test_config ), test_migrate );
+    test_config.enable = false;
+    config_store_save( &test_config );
+    config_store_commit();
+
+    test_reboot();
+    TEST_ASSERT_TRUE( config_store_register( "test", &test_config, sizeof( test_config ), test_migrate ) );
+    TEST_ASSERT_EQUAL( 0, test_migrated );
+    TEST_ASSERT_EQUAL( 30, test_config.interval );
+    TEST_ASSERT_FALSE( test_config.enable );
+    TEST_ASSERT_EQUAL_STRING( "watch", test_config.name );
+}
+
+static void test_unchanged_save_not_written( void ) {
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    config_store_commit();
+    uint32_t writes = shim_files_writes;
+
+    config_store_save( &test_config );
+    TEST_ASSERT_TRUE( config_store_commit() );
+    TEST_ASSERT_EQUAL( writes, shim_files_writes );
+}
+
+static void test_loop_commits_after_delay( void ) {
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    config_store_commit();
+    uint32_t writes = shim_files_writes;
+
+    test_config.interval = 60;
+    config_store_save( &test_config );
+    delay( 1000 );
+    test_loop_cb( POWERMGM_WAKEUP, NULL );
+    TEST_ASSERT_EQUAL( writes, shim_files_writes );
+    TEST_ASSERT_EQUAL( CONFIG_STORE_COMMIT_DELAY - 1000, test_deadline );
+
+    delay( CONFIG_STORE_COMMIT_DELAY - 1000 );
+    test_loop_cb( POWERMGM_WAKEUP, NULL );
+    TEST_ASSERT_EQUAL( writes + 1, shim_files_writes );
+
+    test_reboot();
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    TEST_ASSERT_EQUAL( 60, test_config.interval );
+}
+
+static void test_standby_commits( void ) {
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    test_config.interval = 120;
+    config_store_save( &test_config );
+    test_event_cb( POWERMGM_STANDBY, NULL );
+
+    test_reboot();
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    TEST_ASSERT_EQUAL( 120, test_config.interval );
+}
+
+static void test_recover_tmp_file( void ) {
+    config_store_register( "test", &test_config, sizeof( test_config ), test_migrate );
+    config_store_commit();
+    /*
+     * power lost between remove and rename of the last commit
+     */
+    shim_files[ CONFIG_STORE_TMP_FILE ] = shim_files[ CONFIG_STORE_FILE ];
+    SPIFFS.remove( CONFIG_STORE_FILE );
+
+    test_reboot();
+    TEST_ASSERT_TRUE( config_store_register( "test", &test_config, sizeof( test_config ), test_migrate ) );
+    TEST_ASSERT_EQUAL( 30, test_config.interval );
+}
+
+static void test_failed_rename_keeps_tmp_file( void ) {
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    config_store_commit();
+    test_config.interval = 90;
+    config_store_save( &test_config );
+    shim_files_rename_fail = true;
+    TEST_ASSERT_FALSE( config_store_commit() );
+    TEST_ASSERT_TRUE( config_store_dirty );
+
+    shim_files_rename_fail = false;
+    test_reboot();
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    TEST_ASSERT_EQUAL( 90, test_config.interval );
+}
+
+static void test_crc_error_uses_defaults( void ) {
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    test_config.interval = 45;
+    config_store_save( &test_config );
+    config_store_commit();
+    shim_files[ CONFIG_STORE_FILE ].back() ^= 0x01;
+
+    test_reboot();
+    TEST_ASSERT_FALSE( config_store_register( "test", &test_config, sizeof( test_config ), NULL ) );
+    TEST_ASSERT_EQUAL( 15, test_config.interval );
+}
+
+static void test_upgrade_old_version( void ) {
+    test_config_v0_t old = { 75 };
+
+    config_store_register( "test", &old, sizeof( old ), NULL );
+    old.interval = 75;
+    config_store_commit();
+
+    test_reboot();
+    TEST_ASSERT_TRUE( config_store_register_version( "test", &test_config, sizeof( test_config ), 1, test_upgrade, test_migrate ) );
+    TEST_ASSERT_EQUAL( 0, test_migrated );
+    TEST_ASSERT_EQUAL( 75, test_config.interval );
+    TEST_ASSERT_TRUE( test_config.enable );
+    config_store_commit();
+
+    test_reboot();
+    TEST_ASSERT_TRUE( config_store_register_version( "test", &test_config, sizeof( test_config ), 1, NULL, NULL ) );
+    TEST_ASSERT_EQUAL( 75, test_config.interval );
+}
+
+static void test_keeps_unregistered_records( void ) {
+    uint32_t other = 7;
+
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    config_store_register( "other", &other, sizeof( other ), NULL );
+    config_store_commit();
+
+    test_reboot();
+    config_store_register( "test", &test_config, sizeof( test_config ), NULL );
+    test_config.interval = 20;
+    config_store_save( &test_config );
+    config_store_commit();
+
+    test_reboot();
+    other = 0;
+    TEST_ASSERT_TRUE( config_store_register( "other", &other, sizeof( other ), NULL ) );
+    TEST_ASSERT_EQUAL( 7, other );
+}
+
+int main( void ) {
+    UNITY_BEGIN();
+    RUN_TEST( test_first_boot_migrates );
+    RUN_TEST( test_reboot_reads_store );
+    RUN_TEST( test_unchanged_save_not_written );
+    RUN_TEST( test_loop_commits_after_delay );
+    RUN_TEST( test_standby_commits );
+    RUN_TEST( test_recover_tmp_file );
+    RUN_TEST( test_failed_rename_keeps_tmp_file );
+    RUN_TEST( test_crc_error_uses_defaults );
+    RUN_TEST( test_upgrade_old_version );
+    RUN_TEST( test_keeps_unregistered_records );
+    return( UNITY_END() );
+}
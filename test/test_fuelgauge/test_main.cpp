@@ -0,0 +1,182 @@
+/****************************************************************************
+ *   Nov 05 19:02:11 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host tests of the fuel gauge, run with: pio test -e native
+ */
+#include <math.h>
+#include <unity.h>
+
+#include "hardware/fuelgauge.h"
+
+static fuelgauge_t test_gauge;
+
+static fuelgauge_sample_t test_sample( uint32_t time, float voltage, float discharge, float coulomb, int state ) {
+    fuelgauge_sample_t sample;
+
+    sample.time = time;
+    sample.voltage = voltage;
+    sample.charge_current = 0;
+    sample.discharge_current = discharge;
+    sample.coulomb = coulomb;
+    sample.charging = false;
+    sample.vbus = false;
+    sample.state = state;
+    return( sample );
+}
+
+void setUp( void ) {
+    fuelgauge_init( &test_gauge, 300, 0 );
+}
+
+void tearDown( void ) {
+}
+
+static void test_voltage_soc( void ) {
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 1.0f, fuelgauge_voltage_soc( 4300 ) );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 1.0f, fuelgauge_voltage_soc( 4200 ) );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.5f, fuelgauge_voltage_soc( 3840 ) );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.0f, fuelgauge_voltage_soc( 3300 ) );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.0f, fuelgauge_voltage_soc( 3000 ) );
+
+    float last = 0;
+    for ( int voltage = 3300 ; voltage <= 4200 ; voltage += 5 ) {
+        float soc = fuelgauge_voltage_soc( voltage );
+        TEST_ASSERT_TRUE( soc >= last );
+        last = soc;
+    }
+}
+
+/*
+ * the first sample takes the charge from the load corrected voltage
+ */
+static void test_start( void ) {
+    fuelgauge_sample_t sample = test_sample( 100, 3840 - 20 * FUELGAUGE_RESISTANCE, 20, NAN, FUELGAUGE_WAKEUP );
+
+    TEST_ASSERT_EQUAL_INT( -1, fuelgauge_get_runtime( &test_gauge ) );
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_TRUE( test_gauge.started );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.5f, test_gauge.soc );
+    TEST_ASSERT_EQUAL_INT( 50, test_gauge.percent );
+    TEST_ASSERT_GREATER_THAN( 0, fuelgauge_get_runtime( &test_gauge ) );
+}
+
+/*
+ * the counted charge moves the percent, on battery it never rises
+ */
+static void test_count( void ) {
+    fuelgauge_sample_t sample = test_sample( 0, 4110, 0, NAN, FUELGAUGE_WAKEUP );
+
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_EQUAL_INT( 90, test_gauge.percent );
+
+    sample = test_sample( 60, 4110, 60, -30.0f, FUELGAUGE_WAKEUP );
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.8f, test_gauge.soc );
+    TEST_ASSERT_EQUAL_INT( 80, test_gauge.percent );
+
+    sample = test_sample( 120, 4110, 60, 6.0f, FUELGAUGE_WAKEUP );
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_GREATER_THAN( 0.8f, test_gauge.soc );
+    TEST_ASSERT_EQUAL_INT( 80, test_gauge.percent );
+
+    /*
+     * without coulomb the mean current is integrated, 60mA for 1h is 60mAh
+     */
+    sample = test_sample( 3720, 4110, 60, NAN, FUELGAUGE_WAKEUP );
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.8f + 6.0f * FUELGAUGE_CHARGE_EFFICIENCY / 300 - 0.2f, test_gauge.soc );
+    TEST_ASSERT_EQUAL_INT( 62, test_gauge.percent );
+}
+
+static void test_charging( void ) {
+    fuelgauge_sample_t sample = test_sample( 0, 3900, 0, NAN, FUELGAUGE_WAKEUP );
+
+    fuelgauge_update( &test_gauge, &sample );
+    sample = test_sample( 60, 4000, 0, 3.0f, FUELGAUGE_WAKEUP );
+    sample.vbus = true;
+    sample.charging = true;
+    sample.charge_current = 180;
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_EQUAL_INT( -1, fuelgauge_get_runtime( &test_gauge ) );
+    TEST_ASSERT_TRUE( test_gauge.soc <= 0.99f );
+
+    /*
+     * charging done at a high voltage is full
+     */
+    sample = test_sample( 120, FUELGAUGE_FULL_VOLTAGE + 50, 0, 0, FUELGAUGE_WAKEUP );
+    sample.vbus = true;
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_EQUAL_INT( 100, test_gauge.percent );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.0f, test_gauge.discharged );
+}
+
+/*
+ * the standby rate follows the counted charge, the runtime follows the rate
+ */
+static void test_rate( void ) {
+    fuelgauge_sample_t sample = test_sample( 0, 4110, 0, NAN, FUELGAUGE_STANDBY );
+
+    fuelgauge_update( &test_gauge, &sample );
+    int32_t runtime = fuelgauge_get_runtime( &test_gauge );
+    for ( uint32_t time = 600 ; time <= 6 * 3600 ; time += 600 ) {
+        sample = test_sample( time, 4110, 2, -2.0f * 600 / 3600, FUELGAUGE_STANDBY );
+        fuelgauge_update( &test_gauge, &sample );
+    }
+    TEST_ASSERT_FLOAT_WITHIN( 0.5f, 2.0f, test_gauge.rate[ FUELGAUGE_STANDBY ] );
+    TEST_ASSERT_GREATER_THAN( runtime, fuelgauge_get_runtime( &test_gauge ) );
+}
+
+/*
+ * the coulomb counter covers a long gap, the currents don't
+ */
+static void test_gap( void ) {
+    fuelgauge_sample_t sample = test_sample( 0, 4110, 0, NAN, FUELGAUGE_STANDBY );
+
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_EQUAL_INT( 90, test_gauge.percent );
+
+    sample = test_sample( FUELGAUGE_MAX_GAP + 2 * 3600, 4110, 2, -60.0f, FUELGAUGE_STANDBY );
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.7f, test_gauge.soc );
+    TEST_ASSERT_EQUAL_INT( 70, test_gauge.percent );
+    TEST_ASSERT_FLOAT_WITHIN( 0.1f, 60.0f / 8, test_gauge.rate[ FUELGAUGE_STANDBY ] );
+
+    /*
+     * the same gap without coulomb restarts from the voltage
+     */
+    sample = test_sample( 2 * ( FUELGAUGE_MAX_GAP + 2 * 3600 ), 3840 - 2 * FUELGAUGE_RESISTANCE, 2, NAN, FUELGAUGE_STANDBY );
+    fuelgauge_update( &test_gauge, &sample );
+    TEST_ASSERT_FLOAT_WITHIN( 0.001f, 0.5f, test_gauge.soc );
+    TEST_ASSERT_EQUAL_INT( 50, test_gauge.percent );
+    TEST_ASSERT_FLOAT_WITHIN( 0.1f, 60.0f / 8, test_gauge.rate[ FUELGAUGE_STANDBY ] );
+}
+
+int main( void ) {
+    UNITY_BEGIN();
+    RUN_TEST( test_voltage_soc );
+    RUN_TEST( test_start );
+    RUN_TEST( test_count );
+    RUN_TEST( test_charging );
+    RUN_TEST( test_rate );
+    RUN_TEST( test_gap );
+    return( UNITY_END() );
+}
@@ -0,0 +1,162 @@
+/****************************************************************************
+ *   Nov 05 19:02:11 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host tests of the gadgetbridge framer, run with: pio test -e native
+ */
+#include <string.h>
+#include <string>
+#include <vector>
+#include <unity.h>
+
+#include "hardware/gadgetbridge_frame.h"
+
+#define TEST_BUFFER_SIZE    64
+
+static char test_buffer[ TEST_BUFFER_SIZE ];
+static gadgetbridge_frame_t test_framer;
+static std::vector<std::string> test_frames;
+static char *test_last_frame;
+
+static void test_frame( char *frame, size_t len ) {
+    TEST_ASSERT_EQUAL_INT( '\0', frame[ len ] );
+    test_frames.push_back( std::string( frame, len ) );
+    test_last_frame = frame;
+}
+
+static void test_feed( const char *data ) {
+    gadgetbridge_frame_feed( &test_framer, (const uint8_t *)data, strlen( data ) );
+}
+
+void setUp( void ) {
+    test_frames.clear();
+    test_last_frame = NULL;
+    gadgetbridge_frame_init( &test_framer, test_buffer, TEST_BUFFER_SIZE, test_frame );
+}
+
+void tearDown( void ) {
+}
+
+static void test_wrapper( void ) {
+    test_feed( "\x10GB({\"t\":\"notify\"})\n\x10{\"t\":\"call\"}\n\x10GB(\n" );
+    TEST_ASSERT_EQUAL_INT( 3, test_frames.size() );
+    TEST_ASSERT_EQUAL_STRING( "{\"t\":\"notify\"}", test_frames[ 0 ].c_str() );
+    TEST_ASSERT_EQUAL_STRING( "{\"t\":\"call\"}", test_frames[ 1 ].c_str() );
+    TEST_ASSERT_EQUAL_STRING( "", test_frames[ 2 ].c_str() );
+    TEST_ASSERT_EQUAL_UINT32( 3, test_framer.stats.frames );
+}
+
+static void test_chunks( void ) {
+    const char *stream = "\x10GB({\"t\":\"notify\",\"body\":\"a\"})\n\x03\x10GB({\"t\":\"call\"})\n";
+
+    for ( size_t i = 0 ; i < strlen( stream ) ; i++ ) {
+        gadgetbridge_frame_feed( &test_framer, (const uint8_t *)&stream[ i ], 1 );
+    }
+    std::vector<std::string> bytewise = test_frames;
+    setUp();
+    test_feed( stream );
+    TEST_ASSERT_EQUAL_INT( 2, test_frames.size() );
+    TEST_ASSERT_TRUE( bytewise == test_frames );
+    TEST_ASSERT_EQUAL_UINT32( 1, test_framer.stats.resets );
+}
+
+static void test_reset( void ) {
+    test_feed( "\x10GB({\"t\":\"no" );
+    test_feed( "\x03" );
+    test_feed( "\x10GB({\"t\":\"call\"})\n" );
+    TEST_ASSERT_EQUAL_INT( 1, test_frames.size() );
+    TEST_ASSERT_EQUAL_STRING( "{\"t\":\"call\"}", test_frames[ 0 ].c_str() );
+}
+
+static void test_overflow( void ) {
+    std::string big( TEST_BUFFER_SIZE, 'a' );
+
+    test_feed( ( "\x10" + big + "\n" ).c_str() );
+    TEST_ASSERT_EQUAL_INT( 0, test_frames.size() );
+    TEST_ASSERT_EQUAL_UINT32( 1, test_framer.stats.overflows );
+
+    std::string fits( TEST_BUFFER_SIZE - 1, 'b' );
+    test_feed( ( "\x10" + fits + "\n" ).c_str() );
+    TEST_ASSERT_EQUAL_INT( 1, test_frames.size() );
+    TEST_ASSERT_EQUAL_STRING( fits.c_str(), test_frames[ 0 ].c_str() );
+}
+
+/*
+ * a frame is only valid during the frame function
+ */
+static void test_lifetime( void ) {
+    test_feed( "\x10GB({\"t\":\"notify\"})\n" );
+    TEST_ASSERT_NOT_NULL( test_last_frame );
+    TEST_ASSERT_EQUAL_STRING( "", test_last_frame );
+    test_feed( "\x10GB({\"t\":\"call\"})\n" );
+    TEST_ASSERT_EQUAL_STRING( "{\"t\":\"notify\"}", test_frames[ 0 ].c_str() );
+}
+
+static void test_type( void ) {
+    const char *tests[][ 2 ] = {
+        { "{\"t\":\"notify\",\"id\":1}", "notify" },
+        { " { \"t\" : \"call\" , \"cmd\":\"accept\"}", "call" },
+        { "{\"id\":1,\"body\":\"\\\"t\\\":\\\"call\\\"\",\"t\":\"notify\"}", "notify" },
+        { "{\"a\":{\"t\":\"call\"},\"b\":[1,{\"t\":2},\"]\"],\"t\":\"musicinfo\"}", "musicinfo" },
+        { "{\"n\":-1.5e3 ,\"x\":true,\"t\":\"conf\"}", "conf" },
+        { "{\"id\":1}", NULL },
+        { "[\"t\",\"notify\"]", NULL },
+        { "{\"t\":1}", NULL },
+        { "{\"t\":\"notify", NULL },
+        { "", NULL },
+    };
+
+    for ( size_t i = 0 ; i < sizeof( tests ) / sizeof( tests[ 0 ] ) ; i++ ) {
+        size_t len = 0;
+        const char *type = gadgetbridge_frame_type( tests[ i ][ 0 ], &len );
+        if ( tests[ i ][ 1 ] == NULL ) {
+            TEST_ASSERT_NULL( type );
+        }
+        else {
+            TEST_ASSERT_NOT_NULL( type );
+            TEST_ASSERT_EQUAL_INT( strlen( tests[ i ][ 1 ] ), len );
+            TEST_ASSERT_EQUAL_STRING_LEN( tests[ i ][ 1 ], type, len );
+        }
+    }
+}
+
+static void test_msg( void ) {
+    for ( int i = 0 ; i < GADGETBRIDGE_MSG_NUM ; i++ ) {
+        std::string frame = std::string( "{\"t\":\"" ) + gadgetbridge_msg[ i ].type + "\"}";
+        TEST_ASSERT_EQUAL_INT( i, gadgetbridge_frame_msg( frame.c_str() ) );
+        TEST_ASSERT_EQUAL_STRING( "t", gadgetbridge_msg[ i ].fields[ 0 ] );
+    }
+    TEST_ASSERT_EQUAL_INT( -1, gadgetbridge_frame_msg( "{\"t\":\"notif\"}" ) );
+    TEST_ASSERT_EQUAL_INT( -1, gadgetbridge_frame_msg( "{\"t\":\"notifyx\"}" ) );
+    TEST_ASSERT_EQUAL_INT( -1, gadgetbridge_frame_msg( "{\"t\":\"find\"}" ) );
+}
+
+int main( void ) {
+    UNITY_BEGIN();
+    RUN_TEST( test_wrapper );
+    RUN_TEST( test_chunks );
+    RUN_TEST( test_reset );
+    RUN_TEST( test_overflow );
+    RUN_TEST( test_lifetime );
+    RUN_TEST( test_type );
+    RUN_TEST( test_msg );
+    return( UNITY_END() );
+}
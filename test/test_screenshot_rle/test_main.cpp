@@ -0,0 +1,178 @@
+/****************************************************************************
+ *   Nov 07 16:02:48 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host tests of the run length encoding of the screenshot stream and the
+ * mirror messages, run with: pio test -e native
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+#include "gui/screenshot_rle.h"
+
+#define TEST_WIDTH      240
+#define TEST_LINES      10          // FRAMEBUFFER_LINES and SCREENSHOT_STRIP_LINES
+#define TEST_PIXEL      ( TEST_WIDTH * TEST_LINES )
+
+static uint16_t test_pixel[ TEST_PIXEL ];
+static uint16_t test_decoded[ TEST_PIXEL ];
+static uint8_t test_out[ TEST_PIXEL * 2 + TEST_PIXEL / 128 + 1 ];
+
+/*
+ * decode like tools/screenshot2png.py and the mirror client, returns the
+ * number of pixel or -1 if the data is broken
+ */
+static int test_decode( const uint8_t *data, size_t len, uint16_t *pixel, size_t count ) {
+    size_t pos = 0;
+    size_t n = 0;
+
+    while ( pos < len ) {
+        uint8_t control = data[ pos++ ];
+        size_t run = ( control & 0x7f ) + 1;
+
+        if ( n + run > count ) {
+            return( -1 );
+        }
+        if ( control & 0x80 ) {
+            if ( pos + 2 > len ) {
+                return( -1 );
+            }
+            for ( size_t i = 0 ; i < run ; i++ ) {
+                memcpy( &pixel[ n++ ], &data[ pos ], sizeof( uint16_t ) );
+            }
+            pos += 2;
+        }
+        else {
+            if ( pos + run * 2 > len ) {
+                return( -1 );
+            }
+            memcpy( &pixel[ n ], &data[ pos ], run * sizeof( uint16_t ) );
+            n += run;
+            pos += run * 2;
+        }
+    }
+    return( n );
+}
+
+static void test_round_trip( size_t count ) {
+    memset( test_decoded, 0xa5, sizeof( test_decoded ) );
+    size_t len = screenshot_rle_encode( test_pixel, count, test_out );
+
+    TEST_ASSERT_TRUE( len <= count * 2 + count / 128 + 1 );
+    TEST_ASSERT_EQUAL( count, test_decode( test_out, len, test_decoded, TEST_PIXEL ) );
+    TEST_ASSERT_EQUAL( 0, memcmp( test_pixel, test_decoded, count * sizeof( uint16_t ) ) );
+}
+
+void setUp( void ) {
+    memset( test_pixel, 0, sizeof( test_pixel ) );
+}
+
+void tearDown( void ) {
+}
+
+static void test_empty( void ) {
+    TEST_ASSERT_EQUAL( 0, screenshot_rle_encode( test_pixel, 0, test_out ) );
+}
+
+static void test_single_pixel( void ) {
+    test_pixel[ 0 ] = 0xf800;
+    test_round_trip( 1 );
+    TEST_ASSERT_EQUAL( 0x00, test_out[ 0 ] );
+}
+
+static void test_solid_strip( void ) {
+    for ( size_t i = 0 ; i < TEST_PIXEL ; i++ ) {
+        test_pixel[ i ] = 0x07e0;
+    }
+    test_round_trip( TEST_PIXEL );
+    /*
+     * one run of 128 pixel in 3 bytes, 2400 pixel are 19 runs
+     */
+    TEST_ASSERT_EQUAL( ( TEST_PIXEL + 127 ) / 128 * 3, screenshot_rle_encode( test_pixel, TEST_PIXEL, test_out ) );
+}
+
+static void test_literal_strip( void ) {
+    for ( size_t i = 0 ; i < TEST_PIXEL ; i++ ) {
+        test_pixel[ i ] = i;
+    }
+    test_round_trip( TEST_PIXEL );
+    TEST_ASSERT_EQUAL( TEST_PIXEL * 2 + ( TEST_PIXEL + 127 ) / 128, screenshot_rle_encode( test_pixel, TEST_PIXEL, test_out ) );
+}
+
+static void test_run_boundaries( void ) {
+    /*
+     * runs and literals around the 128 pixel limit of a control byte
+     */
+    const size_t length[] = { 1, 2, 3, 127, 128, 129, 255, 256, 257 };
+    uint16_t color = 1;
+
+    for ( size_t run = 0 ; run < sizeof( length ) / sizeof( length[ 0 ] ) ; run++ ) {
+        for ( size_t literal = 0 ; literal < sizeof( length ) / sizeof( length[ 0 ] ) ; literal++ ) {
+            size_t n = 0;
+
+            for ( size_t i = 0 ; i < length[ literal ] && n < TEST_PIXEL ; i++ ) {
+                test_pixel[ n++ ] = color++;
+            }
+            for ( size_t i = 0 ; i < length[ run ] && n < TEST_PIXEL ; i++ ) {
+                test_pixel[ n++ ] = 0xffff;
+            }
+            test_pixel[ n++ ] = color++;
+            test_round_trip( n );
+        }
+    }
+}
+
+static void test_pairs( void ) {
+    /*
+     * a literal pixel followed by a run of two is the worst case of mixed data
+     */
+    for ( size_t i = 0 ; i < TEST_PIXEL ; i++ ) {
+        test_pixel[ i ] = ( i % 3 == 0 ) ? i : 0x1234;
+    }
+    test_round_trip( TEST_PIXEL );
+}
+
+static void test_random_rectangles( void ) {
+    srand( 1 );
+    for ( int rect = 0 ; rect < 200 ; rect++ ) {
+        size_t w = 1 + rand() % TEST_WIDTH;
+        size_t h = 1 + rand() % TEST_LINES;
+        int colors = 1 + rand() % 4;
+
+        for ( size_t i = 0 ; i < w * h ; i++ ) {
+            test_pixel[ i ] = ( rand() % 8 ) ? ( rand() % colors ) * 0x1111 : rand();
+        }
+        test_round_trip( w * h );
+    }
+}
+
+int main( void ) {
+    UNITY_BEGIN();
+    RUN_TEST( test_empty );
+    RUN_TEST( test_single_pixel );
+    RUN_TEST( test_solid_strip );
+    RUN_TEST( test_literal_strip );
+    RUN_TEST( test_run_boundaries );
+    RUN_TEST( test_pairs );
+    RUN_TEST( test_random_rectangles );
+    return( UNITY_END() );
+}
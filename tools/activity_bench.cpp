@@ -0,0 +1,210 @@
+/****************************************************************************
+ *   Nov 02 20:48:16 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host benchmark of the activity kernel in src/hardware/activity.cpp over
+ * recorded or synthetic traces, reports samples/sec and accuracy
+ *
+ * traces are csv files with x,y,z in mg at 12.5Hz and an optional label
+ * column, without the column the label is taken from the file name
+ * ( walk_01.csv ). lines starting with # are skipped. record real traces
+ * with wget "x.x.x.x/motion?label=walk" -O walk_01.csv or write synthetic
+ * ones with tools/activity_trace.py
+ *
+ * build: g++ -O2 -I src -o activity_bench tools/activity_bench.cpp src/hardware/activity.cpp
+ * usage: activity_bench trace.csv [trace.csv ...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include "hardware/activity.h"
+
+#define BENCH_MIN_TIME      1.0         // seconds the kernel is repeated at least
+
+typedef struct {
+    std::vector<int16_t> xyz;           // interleaved x, y, z
+    std::vector<int8_t> label;          // per sample, -1 if unknown
+    const char *filename;
+} bench_trace_t;
+
+static int bench_label( const char *name ) {
+    for ( int i = 0 ; i < ACTIVITY_NUM ; i++ ) {
+        size_t len = strlen( activity_get_name( i ) );
+        if ( !strncmp( name, activity_get_name( i ), len ) && ( name[ len ] == '\0' || name[ len ] == '_' || name[ len ] == '.' || name[ len ] == '-' || name[ len ] == '\n' || name[ len ] == '\r' ) ) {
+            return( i );
+        }
+    }
+    return( -1 );
+}
+
+static bool bench_read_trace( const char *filename, bench_trace_t *trace ) {
+    FILE *f = fopen( filename, "r" );
+    char line[ 128 ];
+
+    if ( f == NULL ) {
+        perror( filename );
+        return( false );
+    }
+    const char *base = strrchr( filename, '/' );
+    int file_label = bench_label( base ? base + 1 : filename );
+
+    trace->filename = filename;
+    while ( fgets( line, sizeof( line ), f ) ) {
+        int x, y, z, n = 0;
+        if ( line[ 0 ] == '#' || sscanf( line, "%d,%d,%d%n", &x, &y, &z, &n ) != 3 ) {
+            continue;
+        }
+        trace->xyz.push_back( x );
+        trace->xyz.push_back( y );
+        trace->xyz.push_back( z );
+        trace->label.push_back( line[ n ] == ',' ? bench_label( &line[ n + 1 ] ) : file_label );
+    }
+    fclose( f );
+    return( true );
+}
+
+/*
+ * the label of a window is the label of most of its samples
+ */
+static int bench_window_label( const int8_t *label ) {
+    int count[ ACTIVITY_NUM ] = { 0 };
+    int best = -1;
+
+    for ( int i = 0 ; i < ACTIVITY_WINDOW ; i++ ) {
+        if ( label[ i ] >= 0 ) {
+            count[ label[ i ] ]++;
+        }
+    }
+    for ( int i = 0 ; i < ACTIVITY_NUM ; i++ ) {
+        if ( count[ i ] > ACTIVITY_WINDOW / 2 ) {
+            best = i;
+        }
+    }
+    return( best );
+}
+
+static double bench_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( ts.tv_sec + ts.tv_nsec / 1e9 );
+}
+
+int main( int argc, char **argv ) {
+    std::vector<bench_trace_t> traces;
+    uint32_t confusion[ ACTIVITY_NUM ][ ACTIVITY_NUM ];
+    uint64_t samples = 0;
+
+    if ( argc < 2 ) {
+        fprintf( stderr, "usage: %s trace.csv [trace.csv ...]\n", argv[ 0 ] );
+        return( 1 );
+    }
+
+    for ( int i = 1 ; i < argc ; i++ ) {
+        bench_trace_t trace;
+        if ( !bench_read_trace( argv[ i ], &trace ) ) {
+            return( 1 );
+        }
+        samples += trace.label.size() / ACTIVITY_WINDOW * ACTIVITY_WINDOW;
+        traces.push_back( trace );
+    }
+
+    /*
+     * accuracy, every trace starts with a fresh state like a watch after enabling the fifo
+     */
+    memset( confusion, 0, sizeof( confusion ) );
+    printf( "%-24s %8s %8s  %s\n", "trace", "windows", "correct", "still/walk/run/sleep" );
+    for ( size_t t = 0 ; t < traces.size() ; t++ ) {
+        bench_trace_t *trace = &traces[ t ];
+        size_t windows = trace->label.size() / ACTIVITY_WINDOW;
+        uint32_t result[ ACTIVITY_NUM ] = { 0 };
+        uint32_t correct = 0;
+        uint32_t labeled = 0;
+        activity_state_t state;
+
+        activity_init( &state );
+        for ( size_t w = 0 ; w < windows ; w++ ) {
+            int activity = activity_classify( &trace->xyz[ w * ACTIVITY_WINDOW * 3 ], &state, NULL );
+            int label = bench_window_label( &trace->label[ w * ACTIVITY_WINDOW ] );
+            result[ activity ]++;
+            if ( label >= 0 ) {
+                confusion[ label ][ activity ]++;
+                correct += label == activity;
+                labeled++;
+            }
+        }
+        printf( "%-24s %8zu %7.1f%%  %u/%u/%u/%u\n", trace->filename, windows, labeled ? 100.0 * correct / labeled : 0.0,
+                result[ ACTIVITY_STILL ], result[ ACTIVITY_WALK ], result[ ACTIVITY_RUN ], result[ ACTIVITY_SLEEP ] );
+    }
+
+    uint32_t correct = 0;
+    uint32_t labeled = 0;
+    printf( "\nconfusion, rows are labels, columns are results\n%-8s", "" );
+    for ( int i = 0 ; i < ACTIVITY_NUM ; i++ ) {
+        printf( "%8s", activity_get_name( i ) );
+    }
+    printf( "%10s\n", "recall" );
+    for ( int i = 0 ; i < ACTIVITY_NUM ; i++ ) {
+        uint32_t total = 0;
+        printf( "%-8s", activity_get_name( i ) );
+        for ( int j = 0 ; j < ACTIVITY_NUM ; j++ ) {
+            printf( "%8u", confusion[ i ][ j ] );
+            total += confusion[ i ][ j ];
+        }
+        printf( "%9.1f%%\n", total ? 100.0 * confusion[ i ][ i ] / total : 0.0 );
+        correct += confusion[ i ][ i ];
+        labeled += total;
+    }
+    printf( "accuracy %.1f%% of %u labeled windows, sleep needs %d windows at rest before it is detected\n",
+            labeled ? 100.0 * correct / labeled : 0.0, labeled, ACTIVITY_SLEEP_ONSET );
+
+    /*
+     * throughput of the kernel alone, the traces are already in memory
+     */
+    if ( samples == 0 ) {
+        return( 0 );
+    }
+    uint64_t processed = 0;
+    uint32_t checksum = 0;
+    double start = bench_now();
+    double elapsed = 0;
+    do {
+        for ( size_t t = 0 ; t < traces.size() ; t++ ) {
+            bench_trace_t *trace = &traces[ t ];
+            size_t windows = trace->label.size() / ACTIVITY_WINDOW;
+            activity_state_t state;
+
+            activity_init( &state );
+            for ( size_t w = 0 ; w < windows ; w++ ) {
+                checksum += activity_classify( &trace->xyz[ w * ACTIVITY_WINDOW * 3 ], &state, NULL );
+            }
+            processed += windows * ACTIVITY_WINDOW;
+        }
+        elapsed = bench_now() - start;
+    } while ( elapsed < BENCH_MIN_TIME );
+
+    printf( "%.1f Msamples/sec, %.0f ns per window, %.0fx realtime ( checksum %u )\n", processed / elapsed / 1e6,
+            elapsed * 1e9 / ( processed / ACTIVITY_WINDOW ), processed / elapsed / ( ACTIVITY_RATE_MHZ / 1000.0 ), checksum );
+
+    return( 0 );
+}
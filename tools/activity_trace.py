@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# write synthetic labeled motion traces in the /motion csv format for
+# tools/activity_bench.cpp, x,y,z in mg at 12.5Hz with the label appended.
+# real traces are recorded with wget "x.x.x.x/motion?label=walk"
+#
+# usage: activity_trace.py [outdir] [minutes per trace] [seed]
+#
+import math
+import os
+import random
+import sys
+
+RATE = 12.5
+LSB = 1000.0 / 1024.0
+
+def orientation( rnd ):
+    """ random gravity vector of 1000mg, the watch face mostly up """
+    pitch = rnd.uniform( -0.6, 0.6 )
+    roll = rnd.uniform( -0.6, 0.6 )
+    return [ 1000.0 * math.sin( roll ), 1000.0 * math.sin( pitch ), 1000.0 * math.cos( pitch ) * math.cos( roll ) ]
+
+def quantize( value ):
+    """ 12 bit at 2g like the bma fifo """
+    raw = max( -2048, min( 2047, int( round( value / LSB ) ) ) )
+    return int( raw * 1000 ) >> 10
+
+def still( rnd, samples ):
+    gravity = orientation( rnd )
+    pos = 0
+    while pos < samples:
+        # typing or a small hand movement about every minute, then the hand rests again
+        if rnd.random() < 0.3:
+            gravity = orientation( rnd )
+            for i in range( int( RATE * rnd.uniform( 0.5, 2.0 ) ) ):
+                yield [ g + rnd.gauss( 0, 60 ) for g in gravity ]
+                pos += 1
+        for i in range( int( RATE * rnd.uniform( 5, 30 ) ) ):
+            yield [ g + rnd.gauss( 0, 6 ) for g in gravity ]
+            pos += 1
+
+def gait( rnd, samples, cadence, amplitude, noise ):
+    gravity = orientation( rnd )
+    phase = rnd.uniform( 0, 2 * math.pi )
+    for pos in range( samples ):
+        t = pos / RATE
+        # slow drift of the step rate and arm swing at half the step rate
+        f = cadence * ( 1.0 + 0.05 * math.sin( 2 * math.pi * t / 40.0 ) )
+        step = amplitude * ( math.sin( 2 * math.pi * f * t + phase ) + 0.3 * math.sin( 4 * math.pi * f * t ) )
+        swing = 0.3 * amplitude * math.sin( math.pi * f * t )
+        yield [ gravity[ 0 ] + swing + rnd.gauss( 0, noise ),
+                gravity[ 1 ] + 0.2 * step + rnd.gauss( 0, noise ),
+                gravity[ 2 ] + step + rnd.gauss( 0, noise ) ]
+
+def sleep( rnd, samples ):
+    gravity = orientation( rnd )
+    pos = 0
+    while pos < samples:
+        # turn over every 10 to 40 minutes, breathing is below the noise
+        for i in range( int( RATE * 60 * rnd.uniform( 10, 40 ) ) ):
+            yield [ g + rnd.gauss( 0, 3 ) for g in gravity ]
+            pos += 1
+        gravity = orientation( rnd )
+        for i in range( int( RATE * rnd.uniform( 2, 5 ) ) ):
+            yield [ g + rnd.gauss( 0, 120 ) for g in gravity ]
+            pos += 1
+
+def write_trace( filename, label, generator, samples ):
+    with open( filename, "w" ) as f:
+        f.write( "# x,y,z in mg at 12.5Hz, %d samples, synthetic %s\n" % ( samples, label ) )
+        for pos, xyz in enumerate( generator ):
+            if pos >= samples:
+                break
+            f.write( "%d,%d,%d,%s\n" % ( quantize( xyz[ 0 ] ), quantize( xyz[ 1 ] ), quantize( xyz[ 2 ] ), label ) )
+
+def main():
+    outdir = sys.argv[ 1 ] if len( sys.argv ) > 1 else "traces"
+    minutes = float( sys.argv[ 2 ] ) if len( sys.argv ) > 2 else 30
+    rnd = random.Random( int( sys.argv[ 3 ] ) if len( sys.argv ) > 3 else 1 )
+    samples = int( minutes * 60 * RATE )
+
+    os.makedirs( outdir, exist_ok=True )
+    for n in range( 3 ):
+        write_trace( os.path.join( outdir, "still_%02d.csv" % n ), "still", still( rnd, samples ), samples )
+        write_trace( os.path.join( outdir, "walk_%02d.csv" % n ), "walk", gait( rnd, samples, rnd.uniform( 1.5, 2.1 ), rnd.uniform( 120, 300 ), 25 ), samples )
+        write_trace( os.path.join( outdir, "run_%02d.csv" % n ), "run", gait( rnd, samples, rnd.uniform( 2.5, 3.0 ), rnd.uniform( 500, 900 ), 40 ), samples )
+        write_trace( os.path.join( outdir, "sleep_%02d.csv" % n ), "sleep", sleep( rnd, samples * 4 ), samples * 4 )
+    print( "12 traces of %d minutes written to %s, sleep traces are 4 times longer" % ( minutes, outdir ) )
+
+if __name__ == "__main__":
+    main()
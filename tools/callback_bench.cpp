@@ -0,0 +1,266 @@
+/****************************************************************************
+ *   Nov 04 09:12:40 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host micro benchmark of the callback event index in src/hardware/callback_index.cpp
+ * against the table scan. the tables are the registrations of a boot, see
+ * tools/callback_registrations.py, or synthetic tables where every entry listens
+ * to a few of the used event bits. events are send with a single bit set, drawn
+ * from the bits the table listens to
+ *
+ * build: g++ -O2 -I src -o callback_bench tools/callback_bench.cpp src/hardware/callback_index.cpp
+ * usage: tools/callback_registrations.py | callback_bench -
+ *        callback_bench registrations.txt
+ *        callback_bench [entrys] [event bits used] [bits per entry]
+ */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hardware/callback_index.h"
+
+#define BENCH_MIN_TIME      0.5         // seconds each dispatch is repeated at least
+#define BENCH_EVENTS        4096        // events in the send sequence
+#define BENCH_TABLES        16          // max callback tables in a registration list
+#define BENCH_NAME_LEN      32
+
+typedef bool ( * BENCH_FUNC ) ( uint32_t event, void *arg );
+
+/*
+ * same layout as callback_table_t, event first
+ */
+typedef struct {
+    uint32_t event;
+    BENCH_FUNC callback_func;
+    const char *id;
+    uint64_t counter;
+    uint64_t time;
+    uint32_t time_max;
+    uint64_t cycles;
+} bench_table_t;
+
+static __attribute__((noinline)) bool bench_callback( uint32_t event, void *arg ) {
+    ( *(uint64_t *)arg ) += event;
+    return( true );
+}
+
+static double bench_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( ts.tv_sec + ts.tv_nsec / 1e9 );
+}
+
+static uint64_t bench_scan( bench_table_t *table, uint32_t entrys, const uint32_t *events, uint64_t *calls ) {
+    uint64_t sum = 0;
+
+    for ( int e = 0 ; e < BENCH_EVENTS ; e++ ) {
+        for ( uint32_t entry = 0 ; entry < entrys ; entry++ ) {
+            if ( events[ e ] & table[ entry ].event ) {
+                table[ entry ].callback_func( events[ e ], &sum );
+                table[ entry ].counter++;
+                ( *calls )++;
+            }
+        }
+    }
+    return( sum );
+}
+
+static uint64_t bench_index( bench_table_t *table, callback_index_t *index, const uint32_t *events, uint64_t *calls ) {
+    uint64_t sum = 0;
+
+    for ( int e = 0 ; e < BENCH_EVENTS ; e++ ) {
+        int bit = callback_index_bit( events[ e ] );
+        for ( int i = index->start[ bit ] ; i < index->start[ bit + 1 ] ; i++ ) {
+            bench_table_t *entry = &table[ index->entry[ i ] ];
+            entry->callback_func( events[ e ], &sum );
+            entry->counter++;
+            ( *calls )++;
+        }
+    }
+    return( sum );
+}
+
+static int bench_bits( uint32_t event ) {
+    int bits = 0;
+
+    for ( ; event ; event &= event - 1 ) {
+        bits++;
+    }
+    return( bits );
+}
+
+/*
+ * send BENCH_EVENTS single bit events drawn from the bits the table listens to,
+ * through the scan and through the index and print one row
+ */
+static void bench_measure( const char *name, bench_table_t *table, uint32_t entrys ) {
+    uint32_t events[ BENCH_EVENTS ];
+    int used[ CALLBACK_EVENT_BITS ];
+    int bits = 0;
+    int entry_bits = 0;
+    uint32_t mask = 0;
+    callback_index_t index;
+    double time[ 2 ];
+    uint64_t sum[ 2 ];
+    uint64_t calls[ 2 ] = { 0, 0 };
+    uint64_t rounds[ 2 ] = { 0, 0 };
+
+    for ( uint32_t entry = 0 ; entry < entrys ; entry++ ) {
+        table[ entry ].callback_func = bench_callback;
+        mask |= table[ entry ].event;
+        entry_bits += bench_bits( table[ entry ].event );
+    }
+    for ( int bit = 0 ; bit < CALLBACK_EVENT_BITS ; bit++ ) {
+        if ( mask & ( 1UL << bit ) ) {
+            used[ bits++ ] = bit;
+        }
+    }
+    if ( bits == 0 ) {
+        return;
+    }
+    for ( int e = 0 ; e < BENCH_EVENTS ; e++ ) {
+        events[ e ] = 1UL << used[ rand() % bits ];
+    }
+
+    double start = bench_now();
+    index.entry = (uint8_t *)malloc( callback_index_size( &table[ 0 ].event, sizeof( bench_table_t ), entrys ) + 1 );
+    callback_index_fill( &index, &table[ 0 ].event, sizeof( bench_table_t ), entrys );
+    double build = bench_now() - start;
+
+    for ( int mode = 0 ; mode < 2 ; mode++ ) {
+        start = bench_now();
+        do {
+            sum[ mode ] = mode ? bench_index( table, &index, events, &calls[ mode ] ) : bench_scan( table, entrys, events, &calls[ mode ] );
+            rounds[ mode ]++;
+            time[ mode ] = bench_now() - start;
+        } while ( time[ mode ] < BENCH_MIN_TIME );
+    }
+
+    printf( "%-14s %7u %5d %5.1f %9.1f %9.1f %9.1f %8.1fx %8.2f %s\n", name, entrys, bits, (double)entry_bits / entrys,
+            build * 1e6,
+            time[ 0 ] * 1e9 / ( rounds[ 0 ] * BENCH_EVENTS ),
+            time[ 1 ] * 1e9 / ( rounds[ 1 ] * BENCH_EVENTS ),
+            ( time[ 0 ] / rounds[ 0 ] ) / ( time[ 1 ] / rounds[ 1 ] ),
+            (double)calls[ 1 ] / ( rounds[ 1 ] * BENCH_EVENTS ),
+            sum[ 0 ] == sum[ 1 ] && calls[ 0 ] / rounds[ 0 ] == calls[ 1 ] / rounds[ 1 ] ? "ok" : "MISMATCH" );
+
+    free( index.entry );
+}
+
+static void bench_run( uint32_t entrys, int bits, int bits_per_entry ) {
+    bench_table_t *table = (bench_table_t *)calloc( entrys, sizeof( bench_table_t ) );
+
+    for ( uint32_t entry = 0 ; entry < entrys ; entry++ ) {
+        for ( int i = 0 ; i < bits_per_entry ; i++ ) {
+            table[ entry ].event |= 1UL << ( rand() % bits );
+        }
+    }
+    bench_measure( "synthetic", table, entrys );
+    free( table );
+}
+
+/*
+ * "table<tab>event mask in hex<tab>id" lines, one per registration
+ */
+static int bench_registrations( const char *filename ) {
+    static char names[ BENCH_TABLES ][ BENCH_NAME_LEN ];
+    static bench_table_t tables[ BENCH_TABLES ][ 255 ];
+    uint32_t entrys[ BENCH_TABLES ] = { 0 };
+    uint32_t total = 0;
+    int count = 0;
+    char line[ 256 ];
+
+    FILE *file = strcmp( filename, "-" ) ? fopen( filename, "r" ) : stdin;
+    if ( file == NULL ) {
+        perror( filename );
+        return( 1 );
+    }
+
+    while ( fgets( line, sizeof( line ), file ) ) {
+        char *event = strchr( line, '\t' );
+        if ( event == NULL || line[ 0 ] == '#' ) {
+            continue;
+        }
+        *event++ = '\0';
+
+        int table = 0;
+        while ( table < count && strcmp( names[ table ], line ) ) {
+            table++;
+        }
+        if ( table == count ) {
+            if ( count == BENCH_TABLES || strlen( line ) >= BENCH_NAME_LEN ) {
+                fprintf( stderr, "more than %d tables or table name too long: %s\n", BENCH_TABLES, line );
+                return( 1 );
+            }
+            memcpy( names[ count++ ], line, strlen( line ) + 1 );
+        }
+        if ( entrys[ table ] == 255 ) {
+            fprintf( stderr, "more than 255 entrys in %s\n", names[ table ] );
+            return( 1 );
+        }
+        tables[ table ][ entrys[ table ]++ ].event = strtoul( event, NULL, 16 );
+        total++;
+    }
+    if ( file != stdin ) {
+        fclose( file );
+    }
+
+    printf( "%u registrations in %d tables\n", total, count );
+    printf( "%-14s %7s %5s %5s %9s %9s %9s %9s %8s\n", "table", "entrys", "bits", "b/ent", "build/us", "scan/ns", "index/ns", "speedup", "calls" );
+    for ( int table = 0 ; table < count ; table++ ) {
+        bench_measure( names[ table ], tables[ table ], entrys[ table ] );
+    }
+    return( 0 );
+}
+
+int main( int argc, char **argv ) {
+    static const uint32_t sweep[] = { 8, 16, 32, 64, 128, 255 };
+
+    srand( 1 );
+    if ( argc == 2 && !isdigit( (unsigned char)argv[ 1 ][ 0 ] ) ) {
+        return( bench_registrations( argv[ 1 ] ) );
+    }
+
+    int bits = argc > 2 ? atoi( argv[ 2 ] ) : 12;
+    int bits_per_entry = argc > 3 ? atoi( argv[ 3 ] ) : 2;
+
+    if ( bits < 1 || bits > CALLBACK_EVENT_BITS || bits_per_entry < 1 ) {
+        fprintf( stderr, "usage: %s registrations.txt|- or %s [entrys] [event bits used] [bits per entry]\n", argv[ 0 ], argv[ 0 ] );
+        return( 1 );
+    }
+
+    printf( "%-14s %7s %5s %5s %9s %9s %9s %9s %8s\n", "table", "entrys", "bits", "b/ent", "build/us", "scan/ns", "index/ns", "speedup", "calls" );
+    if ( argc > 1 ) {
+        uint32_t entrys = atoi( argv[ 1 ] );
+        if ( entrys < 1 || entrys > 255 ) {
+            fprintf( stderr, "entrys must be 1..255\n" );
+            return( 1 );
+        }
+        bench_run( entrys, bits, bits_per_entry );
+        return( 0 );
+    }
+    for ( size_t i = 0 ; i < sizeof( sweep ) / sizeof( sweep[ 0 ] ) ; i++ ) {
+        bench_run( sweep[ i ], bits, bits_per_entry );
+    }
+    return( 0 );
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# list the callback registrations of a boot as "table event id" lines for
+# tools/callback_bench.cpp. reads the serial log of a boot with core debug
+# level info, callback_register() logs every registration with its event mask:
+#
+#   register callback_func for powermgm success (0x400d1234:00000015:pmu)
+#
+# without a log the *_register_cb() calls are collected from the source tree,
+# the event masks are resolved from the _BV() defines and enums of the headers
+#
+# usage: callback_registrations.py [--log boot.log] [src] > registrations.txt
+#
+import glob
+import os
+import re
+import sys
+
+# register function prefix to the name given to callback_init()
+TABLES = {
+    "powermgm_register_cb": "powermgm",
+    "powermgm_register_loop_cb": "powermgm loop",
+    "wifictl_register_cb": "wifictl",
+    "blectl_register_cb": "blectl",
+    "pmu_register_cb": "pmu",
+    "bma_register_cb": "bma",
+    "rtcctl_register_cb": "rtctl",
+    "sound_register_cb": "sound",
+    "display_register_cb": "display",
+    "http_ota_register_cb": "http ota",
+}
+
+LOG_LINE = re.compile( r"register callback_func for (.+) success \(0x[0-9a-fA-F]+:([0-9a-fA-F]+):(.*)\)\s*$" )
+DEFINE = re.compile( r"^\s*#\s*define\s+([A-Z][A-Z0-9_]+)\s+(_BV\(\s*\d+\s*\)|0x[0-9a-fA-F]+|\d+)(?=\s|$)", re.M )
+ENUM = re.compile( r"\b([A-Z][A-Z0-9_]+)\s*=\s*(_BV\(\s*\d+\s*\)|0x[0-9a-fA-F]+|\d+)\s*,?" )
+CALL = re.compile( r"\b(%s)\(\s*([^,;]+?)\s*,\s*(\w+)\s*(?:,\s*\"([^\"]*)\"\s*)?\)" % "|".join( TABLES ) )
+
+def value( text ):
+    bv = re.match( r"_BV\(\s*(\d+)\s*\)", text )
+    if bv:
+        return 1 << int( bv.group( 1 ) )
+    return int( text, 0 )
+
+def from_log( filename ):
+    with open( filename, errors = "replace" ) as f:
+        for line in f:
+            match = LOG_LINE.search( line )
+            if match:
+                yield match.group( 1 ), int( match.group( 2 ), 16 ), match.group( 3 )
+
+def from_source( src ):
+    names = {}
+    for header in glob.glob( os.path.join( src, "**", "*.h" ), recursive = True ):
+        with open( header, errors = "replace" ) as f:
+            text = f.read()
+        for pattern in ( DEFINE, ENUM ):
+            for name, expr in pattern.findall( text ):
+                names.setdefault( name, value( expr ) )
+
+    for source in sorted( glob.glob( os.path.join( src, "**", "*.cpp" ), recursive = True ) ):
+        with open( source, errors = "replace" ) as f:
+            text = f.read()
+        for function, mask, callback_func, id in CALL.findall( text ):
+            event = 0
+            for name in mask.split( "|" ):
+                name = name.strip()
+                if name not in names:
+                    sys.exit( "%s: unknown event %s" % ( source, name ) )
+                event |= names[ name ]
+            yield TABLES[ function ], event, id or callback_func
+
+def main():
+    args = sys.argv[ 1: ]
+    if args[ :1 ] == [ "--log" ] and len( args ) > 1:
+        registrations = from_log( args[ 1 ] )
+    elif len( args ) < 2 and not args[ :1 ] == [ "--log" ]:
+        registrations = from_source( args[ 0 ] if args else "src" )
+    else:
+        sys.exit( "usage: %s [--log boot.log] [src]" % sys.argv[ 0 ] )
+
+    count = 0
+    for table, event, id in registrations:
+        print( "%s\t%08x\t%s" % ( table, event, id ) )
+        count += 1
+    if count == 0:
+        sys.exit( "no registrations found" )
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+#
+# convert the binary event log (/eventlog.bin, /eventlog.old) from the
+# watch SPIFFS into CSV, see src/hardware/eventlog.h for the format
+#
+# usage: eventlog2csv.py eventlog.old eventlog.bin > eventlog.csv
+#
+import csv
+import struct
+import sys
+import time
+
+EVENTLOG_MAGIC = 0x474c5645
+EVENTLOG_FLAG_CHARGING = 0x01
+EVENTLOG_FLAG_VBUS = 0x02
+
+HEADER = struct.Struct("<IHH24s")
+RECORDS = { 1: struct.Struct("<II8sIIHHHBB"), 2: struct.Struct("<II8sIIHHHBBi") }
+
+COLUMNS = [ "Date", "Time", "Firmware", "Uptime_ms", "Callback", "Event", "FreeHeap",
+            "Batt_V", "Batt_%", "Charging_mA", "Discharging_mA", "Charging", "VBUS", "Coulomb_mAh" ]
+
+def decode( filename, writer ):
+    with open( filename, "rb" ) as f:
+        data = f.read()
+
+    if len( data ) < HEADER.size:
+        sys.exit( "%s: file too short" % filename )
+
+    magic, version, record_size, firmware = HEADER.unpack_from( data, 0 )
+    if magic != EVENTLOG_MAGIC:
+        sys.exit( "%s: bad magic 0x%08x" % ( filename, magic ) )
+    record = RECORDS.get( version )
+    if record is None or record_size != record.size:
+        sys.exit( "%s: unsupported version %d, record size %d" % ( filename, version, record_size ) )
+    firmware = firmware.split( b"\0", 1 )[0].decode( "ascii", "replace" )
+
+    pos = HEADER.size
+    while pos + record.size <= len( data ):
+        values = record.unpack_from( data, pos )
+        ( now, uptime, callback, event, free_heap, batt_voltage, charge_current,
+          discharge_current, batt_percent, flags ) = values[ :10 ]
+        # the counted coulomb since boot is only in version 2 logs
+        coulomb = "%0.2f" % ( values[ 10 ] / 100.0 ) if version >= 2 else ""
+        pos += record.size
+
+        tm = time.localtime( now )
+        writer.writerow( [
+            time.strftime( "%Y-%m-%d", tm ),
+            time.strftime( "%H:%M:%S", tm ),
+            firmware,
+            uptime,
+            callback.split( b"\0", 1 )[0].decode( "ascii", "replace" ),
+            "%04x" % event,
+            free_heap,
+            "%0.2f" % ( batt_voltage / 1000.0 ),
+            batt_percent,
+            charge_current,
+            discharge_current,
+            1 if flags & EVENTLOG_FLAG_CHARGING else 0,
+            1 if flags & EVENTLOG_FLAG_VBUS else 0,
+            coulomb ] )
+
+    if pos != len( data ):
+        sys.stderr.write( "%s: %d trailing bytes ignored\n" % ( filename, len( data ) - pos ) )
+
+def main():
+    if len( sys.argv ) < 2:
+        sys.exit( "usage: %s eventlog.bin [eventlog.bin ...]" % sys.argv[0] )
+
+    writer = csv.writer( sys.stdout, delimiter = "\t", lineterminator = "\n" )
+    writer.writerow( COLUMNS )
+    for filename in sys.argv[1:]:
+        decode( filename, writer )
+
+if __name__ == "__main__":
+    main()
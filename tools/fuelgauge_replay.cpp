@@ -0,0 +1,249 @@
+/****************************************************************************
+ *   Nov 08 11:02:47 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host replay of the fuel gauge in src/hardware/fuelgauge.cpp over recorded
+ * event logs, reports the stability of the percent against the axp202
+ * percent, the learned capacity and how well the learned discharge rate
+ * predicts the consumption of the next hours
+ *
+ * the event logs are the tab separated csv files of tools/eventlog2csv.py,
+ * the power state is taken from the powermgm events and the charge from the
+ * counted coulomb like on the watch. logs from firmware before event log
+ * version 2 have no coulomb, there the charge is counted from the logged
+ * currents and in standby, where the logged current is the one before
+ * sleep, taken from the voltage drop over the interval. the capacity and
+ * the standby rate from such logs are only a rough estimate
+ *
+ * build: g++ -O2 -I src -o fuelgauge_replay tools/fuelgauge_replay.cpp src/hardware/fuelgauge.cpp
+ * usage: fuelgauge_replay [-c designed_mAh] eventlog.csv [eventlog.csv ...]
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include "hardware/fuelgauge.h"
+
+#define REPLAY_DESIGNED_CAP     300     // mAh, default of pmu_config_t
+#define REPLAY_POWERMGM_STANDBY         0x0001
+#define REPLAY_POWERMGM_SILENCE_WAKEUP  0x0004
+#define REPLAY_POWERMGM_WAKEUP          0x0010
+
+typedef struct {
+    fuelgauge_sample_t sample;
+    uint32_t uptime;                    // ms since boot
+    float coulomb;                      // mAh counted since boot, NAN if not logged
+    int32_t axp_percent;
+} replay_row_t;
+
+typedef struct {
+    uint32_t time;
+    float charge;                       // mAh left
+    float rate;                         // predicted mA
+    float current;                      // logged discharge current, the naive prediction
+    bool vbus;
+} replay_point_t;
+
+typedef struct {
+    int32_t last;
+    int32_t max_step;
+    uint32_t up;
+    uint32_t steps;
+} replay_stability_t;
+
+static bool replay_read_log( const char *filename, std::vector<replay_row_t> *rows, int *state ) {
+    FILE *f = fopen( filename, "r" );
+    char line[ 256 ];
+
+    if ( f == NULL ) {
+        perror( filename );
+        return( false );
+    }
+    while ( fgets( line, sizeof( line ), f ) ) {
+        char *column[ 14 ];
+        int n = 0;
+        for ( char *p = line ; n < 14 ; n++ ) {
+            column[ n ] = p;
+            p = strchr( p, '\t' );
+            if ( p == NULL ) {
+                n++;
+                break;
+            }
+            *p++ = '\0';
+        }
+        struct tm tm;
+        memset( &tm, 0, sizeof( tm ) );
+        if ( n < 13 || sscanf( column[ 0 ], "%d-%d-%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday ) != 3 || sscanf( column[ 1 ], "%d:%d:%d", &tm.tm_hour, &tm.tm_min, &tm.tm_sec ) != 3 ) {
+            continue;
+        }
+        tm.tm_year -= 1900;
+        tm.tm_mon -= 1;
+        tm.tm_isdst = -1;
+
+        if ( !strcmp( column[ 4 ], "powermgm" ) ) {
+            unsigned int event = strtoul( column[ 5 ], NULL, 16 );
+            if ( event & REPLAY_POWERMGM_STANDBY )
+                *state = FUELGAUGE_STANDBY;
+            else if ( event & REPLAY_POWERMGM_SILENCE_WAKEUP )
+                *state = FUELGAUGE_SILENCE_WAKEUP;
+            else if ( event & REPLAY_POWERMGM_WAKEUP )
+                *state = FUELGAUGE_WAKEUP;
+        }
+
+        replay_row_t row;
+        row.sample.time = mktime( &tm );
+        row.sample.voltage = atof( column[ 7 ] ) * 1000.0f;
+        row.sample.charge_current = atof( column[ 9 ] );
+        row.sample.discharge_current = atof( column[ 10 ] );
+        row.sample.coulomb = NAN;
+        row.sample.charging = atoi( column[ 11 ] );
+        row.sample.vbus = atoi( column[ 12 ] );
+        row.sample.state = *state;
+        row.uptime = strtoul( column[ 3 ], NULL, 10 );
+        row.coulomb = n > 13 && column[ 13 ][ 0 ] != '\n' && column[ 13 ][ 0 ] != '\0' ? atof( column[ 13 ] ) : NAN;
+        row.axp_percent = atoi( column[ 8 ] );
+        rows->push_back( row );
+    }
+    fclose( f );
+    return( true );
+}
+
+static void replay_step( replay_stability_t *stability, int32_t percent, bool battery ) {
+    if ( battery && stability->last >= 0 && percent != stability->last ) {
+        int32_t step = abs( percent - stability->last );
+        if ( step > stability->max_step )
+            stability->max_step = step;
+        if ( percent > stability->last )
+            stability->up++;
+        stability->steps++;
+    }
+    stability->last = percent;
+}
+
+/*
+ * mean error of the predicted rate against the charge really used in the next hours on battery
+ */
+static void replay_prediction( const std::vector<replay_point_t> &points, uint32_t horizon ) {
+    double error = 0;
+    double bias = 0;
+    double naive = 0;
+    uint32_t count = 0;
+
+    for ( size_t i = 0, j = 0 ; i < points.size() ; i++ ) {
+        if ( points[ i ].vbus || points[ i ].rate <= 0 )
+            continue;
+        if ( j < i )
+            j = i;
+        while ( j < points.size() && !points[ j ].vbus && points[ j ].time < points[ i ].time + horizon )
+            j++;
+        if ( j >= points.size() || points[ j ].vbus )
+            continue;
+        float used = ( points[ i ].charge - points[ j ].charge ) * 3600.0f / ( points[ j ].time - points[ i ].time );
+        if ( used <= 0 )
+            continue;
+        error += fabs( points[ i ].rate - used ) / used;
+        bias += ( points[ i ].rate - used ) / used;
+        naive += fabs( points[ i ].current - used ) / used;
+        count++;
+    }
+    if ( count )
+        printf( "rate prediction %2uh: %5.1f%% mean error, %+5.1f%% bias over %u samples, logged current %.1f%% mean error\n",
+                horizon / 3600, 100.0 * error / count, 100.0 * bias / count, count, 100.0 * naive / count );
+    else
+        printf( "rate prediction %2uh: no discharge long enough\n", horizon / 3600 );
+}
+
+int main( int argc, char **argv ) {
+    std::vector<replay_row_t> rows;
+    std::vector<replay_point_t> points;
+    float designed = REPLAY_DESIGNED_CAP;
+    int state = FUELGAUGE_WAKEUP;
+    int arg = 1;
+
+    if ( arg + 1 < argc && !strcmp( argv[ arg ], "-c" ) ) {
+        designed = atof( argv[ arg + 1 ] );
+        arg += 2;
+    }
+    if ( arg >= argc || designed <= 0 ) {
+        fprintf( stderr, "usage: %s [-c designed_mAh] eventlog.csv [eventlog.csv ...]\n", argv[ 0 ] );
+        return( 1 );
+    }
+    for ( ; arg < argc ; arg++ ) {
+        if ( !replay_read_log( argv[ arg ], &rows, &state ) )
+            return( 1 );
+    }
+    if ( rows.empty() ) {
+        fprintf( stderr, "no events found\n" );
+        return( 1 );
+    }
+
+    fuelgauge_t gauge;
+    replay_stability_t gauge_stability = { -1, 0, 0, 0 };
+    replay_stability_t axp_stability = { -1, 0, 0, 0 };
+    uint32_t standby_estimates = 0;
+    uint32_t counted = 0;
+
+    fuelgauge_init( &gauge, designed, 0 );
+    for ( size_t i = 0 ; i < rows.size() ; i++ ) {
+        fuelgauge_sample_t sample = rows[ i ].sample;
+        /*
+         * the counted coulomb restarts with every boot, without it the current before sleep says
+         * nothing about standby, take the charge the voltage says is gone
+         */
+        if ( i > 0 && !isnan( rows[ i ].coulomb ) && !isnan( rows[ i - 1 ].coulomb ) && rows[ i ].uptime >= rows[ i - 1 ].uptime ) {
+            sample.coulomb = rows[ i ].coulomb - rows[ i - 1 ].coulomb;
+            counted++;
+        }
+        else if ( i > 0 && gauge.started && gauge.state == FUELGAUGE_STANDBY && !gauge.vbus && !sample.vbus ) {
+            const fuelgauge_sample_t *last = &rows[ i - 1 ].sample;
+            float before = fuelgauge_voltage_soc( last->voltage + last->discharge_current * FUELGAUGE_RESISTANCE );
+            float after = fuelgauge_voltage_soc( sample.voltage + sample.discharge_current * FUELGAUGE_RESISTANCE );
+            sample.coulomb = ( after - before ) * gauge.designed;
+            standby_estimates++;
+        }
+        fuelgauge_update( &gauge, &sample );
+
+        bool battery = !sample.vbus && !sample.charging;
+        replay_step( &gauge_stability, gauge.percent, battery );
+        replay_step( &axp_stability, rows[ i ].axp_percent, battery );
+
+        replay_point_t point = { gauge.time, gauge.soc * gauge.capacity, fuelgauge_get_rate( &gauge ), sample.discharge_current, sample.vbus };
+        points.push_back( point );
+    }
+
+    uint32_t span = rows.back().sample.time - rows.front().sample.time;
+    printf( "%zu events over %.1f days, %u intervals from the coulomb counter, %u standby intervals from the voltage\n", rows.size(), span / 86400.0, counted, standby_estimates );
+    printf( "%-8s %8s %8s %8s  on battery\n", "percent", "changes", "max step", "up" );
+    printf( "%-8s %8u %7d%% %8u\n", "gauge", gauge_stability.steps, gauge_stability.max_step, gauge_stability.up );
+    printf( "%-8s %8u %7d%% %8u\n", "axp202", axp_stability.steps, axp_stability.max_step, axp_stability.up );
+    printf( "capacity %.0f mAh of %.0f mAh designed, learned %u times\n", gauge.capacity, gauge.designed, gauge.cycles );
+    printf( "rate wakeup %.1f mA ( %.1f%% ), silence wakeup %.1f mA ( %.1f%% ), standby %.1f mA ( %.1f%% ), mean %.1f mA\n",
+            gauge.rate[ FUELGAUGE_WAKEUP ], gauge.share[ FUELGAUGE_WAKEUP ] * 100, gauge.rate[ FUELGAUGE_SILENCE_WAKEUP ], gauge.share[ FUELGAUGE_SILENCE_WAKEUP ] * 100,
+            gauge.rate[ FUELGAUGE_STANDBY ], gauge.share[ FUELGAUGE_STANDBY ] * 100, fuelgauge_get_rate( &gauge ) );
+    replay_prediction( points, 3600 );
+    replay_prediction( points, 6 * 3600 );
+    printf( "last: %d%%, runtime %d min\n", gauge.percent, fuelgauge_get_runtime( &gauge ) );
+
+    return( 0 );
+}
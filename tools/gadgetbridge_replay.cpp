@@ -0,0 +1,223 @@
+/****************************************************************************
+ *   Nov 04 18:40:12 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host replay and fuzz harness for the gadgetbridge framer in src/hardware/gadgetbridge_frame.cpp
+ *
+ * replay: the capture is fed once byte by byte and once in random chunks of 1 to 512 bytes
+ * like ble writes, both runs must deliver the same frames. -v prints every frame, then the
+ * throughput is reported. a capture is the raw byte stream gadgetbridge writes, for example
+ * printf '\x10GB({"t":"notify","id":1,"body":"hi"})\n' > notify.bin
+ *
+ * fuzz: random streams mixed from protocol bytes, printable text and oversized frames, every
+ * delivered frame is checked to be '\0' terminated inside the buffer. build with
+ * -fsanitize=address,undefined to catch stray accesses
+ *
+ * build: g++ -O2 -I src -o gadgetbridge_replay tools/gadgetbridge_replay.cpp src/hardware/gadgetbridge_frame.cpp
+ * usage: gadgetbridge_replay [-v] capture.bin [capture.bin ...]
+ *        gadgetbridge_replay -f iterations [seed]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include "hardware/gadgetbridge_frame.h"
+
+#define REPLAY_BUFFER_SIZE      8192        // same as GADGETBRIDGE_MAX_FRAME_SIZE
+#define REPLAY_MIN_TIME         1.0         // seconds the throughput run is repeated at least
+#define FUZZ_STREAM_MAX         ( 3 * REPLAY_BUFFER_SIZE )
+
+static char replay_buffer[ REPLAY_BUFFER_SIZE ];
+static gadgetbridge_frame_t replay_framer;
+static std::vector<char> replay_frames;     // all delivered frames, '\0' separated
+static bool replay_verbose = false;
+static uint32_t replay_errors = 0;
+
+static double replay_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( ts.tv_sec + ts.tv_nsec / 1e9 );
+}
+
+static void replay_frame( char *frame, size_t len ) {
+    if ( frame < replay_buffer || frame + len >= replay_buffer + REPLAY_BUFFER_SIZE || frame[ len ] != '\0' ) {
+        fprintf( stderr, "frame %u outside the buffer or not terminated\n", replay_framer.stats.frames );
+        replay_errors++;
+        return;
+    }
+    if ( replay_verbose ) {
+        printf( "%6zu %.*s\n", len, (int)len, frame );
+    }
+    replay_frames.insert( replay_frames.end(), frame, frame + len + 1 );
+    /*
+     * the consumer may modify the frame in place
+     */
+    memset( frame, 'x', len );
+}
+
+/*
+ * throughput run, the frames are discarded
+ */
+static void replay_discard( char *, size_t ) {
+}
+
+/*
+ * feed a stream in chunks, chunk 0 is random 1..512 bytes
+ */
+static std::vector<char> replay_run( const std::vector<uint8_t> &stream, size_t chunk, gadgetbridge_stats_t *stats ) {
+    replay_frames.clear();
+    gadgetbridge_frame_init( &replay_framer, replay_buffer, REPLAY_BUFFER_SIZE, replay_frame );
+    for ( size_t pos = 0 ; pos < stream.size() ; ) {
+        size_t len = chunk ? chunk : 1 + rand() % 512;
+        if ( len > stream.size() - pos ) {
+            len = stream.size() - pos;
+        }
+        gadgetbridge_frame_feed( &replay_framer, &stream[ pos ], len );
+        pos += len;
+    }
+    if ( stats ) {
+        *stats = replay_framer.stats;
+    }
+    return( replay_frames );
+}
+
+static bool replay_read( const char *filename, std::vector<uint8_t> *stream ) {
+    FILE *f = fopen( filename, "rb" );
+    uint8_t data[ 4096 ];
+    size_t len;
+
+    if ( f == NULL ) {
+        perror( filename );
+        return( false );
+    }
+    while ( ( len = fread( data, 1, sizeof( data ), f ) ) > 0 ) {
+        stream->insert( stream->end(), data, data + len );
+    }
+    fclose( f );
+    return( true );
+}
+
+static void fuzz_stream( std::vector<uint8_t> *stream ) {
+    static const uint8_t protocol[] = { StartofText, EndofText, LineFeed, DataLinkEscape, '(', ')', 'G', 'B', '\0' };
+    size_t len = rand() % FUZZ_STREAM_MAX;
+
+    stream->clear();
+    while ( stream->size() < len ) {
+        switch( rand() % 8 ) {
+            case 0:     stream->push_back( protocol[ rand() % sizeof( protocol ) ] );
+                        break;
+            case 1:     stream->push_back( rand() );
+                        break;
+            case 2:     {
+                            /*
+                             * a frame around the buffer size
+                             */
+                            size_t frame = REPLAY_BUFFER_SIZE - 8 + rand() % 16;
+                            stream->push_back( DataLinkEscape );
+                            stream->insert( stream->end(), frame, 'a' + rand() % 26 );
+                            stream->push_back( LineFeed );
+                            break;
+                        }
+            case 3:     {
+                            static const char *msg = "GB({\"t\":\"notify\",\"id\":1,\"body\":\"hello\"})\n";
+                            stream->push_back( DataLinkEscape );
+                            stream->insert( stream->end(), msg, msg + strlen( msg ) );
+                            break;
+                        }
+            default:    stream->push_back( ' ' + rand() % 95 );
+        }
+    }
+}
+
+static int fuzz( uint32_t iterations, uint32_t seed ) {
+    std::vector<uint8_t> stream;
+    uint64_t bytes = 0;
+    uint64_t frames = 0;
+    uint64_t overflows = 0;
+
+    srand( seed );
+    for ( uint32_t i = 0 ; i < iterations && replay_errors == 0 ; i++ ) {
+        gadgetbridge_stats_t stats;
+
+        fuzz_stream( &stream );
+        std::vector<char> whole = replay_run( stream, 1, NULL );
+        std::vector<char> chunked = replay_run( stream, 0, &stats );
+        if ( whole != chunked ) {
+            fprintf( stderr, "iteration %u: chunked feed delivers other frames\n", i );
+            replay_errors++;
+        }
+        bytes += stats.bytes;
+        frames += stats.frames;
+        overflows += stats.overflows;
+    }
+    printf( "%u iterations, seed %u: %llu bytes, %llu frames, %llu overflows, %u errors\n", iterations, seed,
+            (unsigned long long)bytes, (unsigned long long)frames, (unsigned long long)overflows, replay_errors );
+    return( replay_errors ? 1 : 0 );
+}
+
+int main( int argc, char **argv ) {
+    std::vector<uint8_t> stream;
+    int arg = 1;
+
+    if ( argc > 2 && !strcmp( argv[ 1 ], "-f" ) ) {
+        return( fuzz( atoi( argv[ 2 ] ), argc > 3 ? atoi( argv[ 3 ] ) : time( NULL ) ) );
+    }
+    if ( argc > 1 && !strcmp( argv[ 1 ], "-v" ) ) {
+        replay_verbose = true;
+        arg++;
+    }
+    if ( arg >= argc ) {
+        fprintf( stderr, "usage: %s [-v] capture.bin [capture.bin ...]\n       %s -f iterations [seed]\n", argv[ 0 ], argv[ 0 ] );
+        return( 1 );
+    }
+    for ( ; arg < argc ; arg++ ) {
+        if ( !replay_read( argv[ arg ], &stream ) ) {
+            return( 1 );
+        }
+    }
+
+    gadgetbridge_stats_t stats;
+    std::vector<char> whole = replay_run( stream, 1, &stats );
+    replay_verbose = false;
+    std::vector<char> chunked = replay_run( stream, 0, NULL );
+    printf( "%u bytes, %u frames, %u overflows, %u resets\n", stats.bytes, stats.frames, stats.overflows, stats.resets );
+    if ( whole != chunked ) {
+        fprintf( stderr, "chunked feed delivers other frames\n" );
+        replay_errors++;
+    }
+
+    /*
+     * throughput of the framer alone, without copying the frames
+     */
+    uint64_t bytes = 0;
+    double start = replay_now();
+    double elapsed = 0;
+    gadgetbridge_frame_init( &replay_framer, replay_buffer, REPLAY_BUFFER_SIZE, replay_discard );
+    do {
+        gadgetbridge_frame_feed( &replay_framer, stream.data(), stream.size() );
+        bytes += stream.size();
+        elapsed = replay_now() - start;
+    } while ( elapsed < REPLAY_MIN_TIME && stream.size() );
+    printf( "%.1f MB/s\n", bytes / elapsed / 1e6 );
+    return( replay_errors ? 1 : 0 );
+}
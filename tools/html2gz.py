@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+#
+# gzip the static pages of the webserver into a c file that is served
+# from flash, see src/webserver/webserver_assets.h
+#
+# usage: html2gz.py [src/webserver/html] [src/webserver/webserver_assets.cpp]
+#
+import gzip
+import os
+import sys
+import zlib
+
+MIME = {
+    ".htm": "text/html",
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".ico": "image/x-icon",
+    ".png": "image/png",
+    ".svg": "image/svg+xml",
+}
+
+def format_bytes( data ):
+    lines = []
+    for pos in range( 0, len( data ), 32 ):
+        lines.append( "  " + "".join( "0x%02x, " % value for value in data[ pos : pos + 32 ] ) )
+    return "\n".join( lines )
+
+def main():
+    base = os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), "..", "src", "webserver" )
+    source = sys.argv[ 1 ] if len( sys.argv ) > 1 else os.path.join( base, "html" )
+    target = sys.argv[ 2 ] if len( sys.argv ) > 2 else os.path.join( base, "webserver_assets.cpp" )
+
+    out = []
+    out.append( "/*\n * generated by tools/html2gz.py from src/webserver/html, do not edit\n */" )
+    out.append( '#include "webserver_assets.h"\n' )
+    table = []
+    for filename in sorted( os.listdir( source ) ):
+        name, ext = os.path.splitext( filename )
+        if ext.lower() not in MIME:
+            continue
+        with open( os.path.join( source, filename ), "rb" ) as f:
+            data = f.read()
+        # mtime 0 keeps the output the same for the same input
+        compressed = gzip.compress( data, compresslevel = 9, mtime = 0 )
+        symbol = ( name + "_" + ext[ 1: ] ).replace( "-", "_" ).replace( ".", "_" ) + "_gz"
+        out.append( "static const uint8_t %s[] = {\n%s\n};\n" % ( symbol, format_bytes( compressed ) ) )
+        table.append( '    { "/%s", "%s", "\\"%08x\\"", %s, sizeof( %s ) },' % ( filename, MIME[ ext.lower() ], zlib.crc32( compressed ), symbol, symbol ) )
+        print( "%s: %d -> %d bytes" % ( filename, len( data ), len( compressed ) ) )
+
+    out.append( "const webserver_asset_t webserver_assets[] = {" )
+    out.extend( table )
+    out.append( "    { NULL, NULL, NULL, NULL, 0 }" )
+    out.append( "};\n" )
+    with open( target, "w" ) as f:
+        f.write( "\n".join( out ) )
+
+if __name__ == "__main__":
+    main()
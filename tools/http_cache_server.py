@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+#
+# serve recorded api responses with ETag, Last-Modified and Cache-Control max-age
+# and answer If-None-Match/If-Modified-Since with 304 to test the http cache, see
+# src/hardware/http_cache.h
+#
+# usage: http_cache_server.py directory [port] [max-age]
+#
+# the url path without the query selects the file, /data/2.5/forecast?lat=.. is served
+# from directory/data/2.5/forecast. the ETag is the md5 of the file, change a file to
+# get a 200 on the next revalidation. GET /stats returns the counters as json
+#
+import email.utils
+import hashlib
+import http.server
+import json
+import os
+import sys
+import threading
+import urllib.parse
+
+class CacheHandler( http.server.BaseHTTPRequestHandler ):
+    protocol_version = "HTTP/1.1"
+
+    def do_GET( self ):
+        path = urllib.parse.urlsplit( self.path ).path
+
+        if path == "/stats":
+            self.send_body( 200, json.dumps( self.server.stats ).encode(), "application/json", {} )
+            return
+
+        filename = os.path.realpath( os.path.join( self.server.directory, path.lstrip( "/" ) ) )
+        if not filename.startswith( self.server.directory + os.sep ) or not os.path.isfile( filename ):
+            self.count( "not_found", 0, 0 )
+            self.send_body( 404, b"", "text/plain", {} )
+            return
+
+        with open( filename, "rb" ) as f:
+            data = f.read()
+
+        etag = '"%s"' % hashlib.md5( data ).hexdigest()
+        mtime = int( os.path.getmtime( filename ) )
+        headers = {
+            "ETag": etag,
+            "Last-Modified": email.utils.formatdate( mtime, usegmt = True ),
+            "Cache-Control": "max-age=%d" % self.server.max_age,
+        }
+
+        if self.not_modified( etag, mtime ):
+            self.count( "not_modified", 0, len( data ) )
+            self.send_body( 304, b"", None, headers )
+            return
+
+        self.count( "ok", len( data ), 0 )
+        self.send_body( 200, data, "application/json", headers )
+
+    def not_modified( self, etag, mtime ):
+        # If-None-Match takes precedence over If-Modified-Since, see rfc 7232 section 6
+        if_none_match = self.headers.get( "If-None-Match" )
+        if if_none_match is not None:
+            return etag in [ tag.strip() for tag in if_none_match.split( "," ) ] or if_none_match.strip() == "*"
+
+        if_modified_since = self.headers.get( "If-Modified-Since" )
+        if if_modified_since is not None:
+            try:
+                since = email.utils.parsedate_to_datetime( if_modified_since ).timestamp()
+            except ( TypeError, ValueError ):
+                return False
+            return mtime <= since
+        return False
+
+    def count( self, result, sent, saved ):
+        with self.server.lock:
+            stats = self.server.stats
+            stats[ "requests" ] += 1
+            stats[ result ] += 1
+            stats[ "bytes_sent" ] += sent
+            stats[ "bytes_saved" ] += saved
+            self.log_message( "%s: requests %d, 200 %d, 304 %d, sent %d bytes, saved %d bytes", result, stats[ "requests" ], stats[ "ok" ], stats[ "not_modified" ], stats[ "bytes_sent" ], stats[ "bytes_saved" ] )
+
+    def send_body( self, code, body, content_type, headers ):
+        self.send_response( code )
+        for key, value in headers.items():
+            self.send_header( key, value )
+        if content_type:
+            self.send_header( "Content-Type", content_type )
+        # send a Content-Length also on 304, the watch keeps the connection in its pool
+        self.send_header( "Content-Length", str( len( body ) ) )
+        self.end_headers()
+        self.wfile.write( body )
+
+def main():
+    if len( sys.argv ) < 2:
+        sys.exit( "usage: %s directory [port] [max-age]" % sys.argv[ 0 ] )
+
+    server = http.server.ThreadingHTTPServer( ( "", int( sys.argv[ 2 ] ) if len( sys.argv ) > 2 else 8080 ), CacheHandler )
+    server.directory = os.path.realpath( sys.argv[ 1 ] )
+    server.max_age = int( sys.argv[ 3 ] ) if len( sys.argv ) > 3 else 60
+    server.lock = threading.Lock()
+    server.stats = { "requests": 0, "ok": 0, "not_modified": 0, "not_found": 0, "bytes_sent": 0, "bytes_saved": 0 }
+    print( "serve %s, max-age %d s" % ( server.directory, server.max_age ) )
+    server.serve_forever()
+
+if __name__ == "__main__":
+    main()
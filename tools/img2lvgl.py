@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+#
+# convert png images or already generated lvgl true color alpha c arrays into
+# run length compressed lvgl images, see src/gui/img_decoder.h for the format
+#
+# images with identical pixel data are written only once, the other files
+# become an alias to the first map.
+#
+# usage: img2lvgl.py icon.png [icon.png ...]          write icon.c next to the png
+#        img2lvgl.py src/gui/images/*.c               compress generated c arrays in place
+#
+import hashlib
+import os
+import re
+import struct
+import sys
+import zlib
+
+IMG_DECODER_RLE_MAGIC = b"RLEA"
+
+SECTIONS = (
+    ( "LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8", "Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit", 2 ),
+    ( "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0", "Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit", 3 ),
+    ( "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0", "Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped", 3 ),
+    ( "LV_COLOR_DEPTH == 32", "Pixel format: Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha 8 bit", 4 ),
+)
+
+def read_png( filename ):
+    with open( filename, "rb" ) as f:
+        data = f.read()
+    if data[ :8 ] != b"\x89PNG\r\n\x1a\n":
+        sys.exit( "%s: not a png" % filename )
+
+    pos = 8
+    idat = b""
+    while pos < len( data ):
+        length, tag = struct.unpack_from( ">I4s", data, pos )
+        payload = data[ pos + 8 : pos + 8 + length ]
+        if tag == b"IHDR":
+            width, height, depth, colortype, _, _, interlace = struct.unpack( ">IIBBBBB", payload )
+        elif tag == b"IDAT":
+            idat += payload
+        pos += length + 12
+
+    channels = { 2: 3, 6: 4 }.get( colortype )
+    if depth != 8 or channels is None or interlace:
+        sys.exit( "%s: only 8 bit non interlaced rgb or rgba png supported" % filename )
+
+    raw = zlib.decompress( idat )
+    stride = width * channels
+    rows = []
+    prev = bytearray( stride )
+    pos = 0
+    for y in range( height ):
+        filter_type = raw[ pos ]
+        line = bytearray( raw[ pos + 1 : pos + 1 + stride ] )
+        pos += stride + 1
+        for x in range( stride ):
+            a = line[ x - channels ] if x >= channels else 0
+            b = prev[ x ]
+            c = prev[ x - channels ] if x >= channels else 0
+            if filter_type == 1:
+                line[ x ] = ( line[ x ] + a ) & 0xff
+            elif filter_type == 2:
+                line[ x ] = ( line[ x ] + b ) & 0xff
+            elif filter_type == 3:
+                line[ x ] = ( line[ x ] + ( ( a + b ) >> 1 ) ) & 0xff
+            elif filter_type == 4:
+                p = a + b - c
+                pa, pb, pc = abs( p - a ), abs( p - b ), abs( p - c )
+                line[ x ] = ( line[ x ] + ( a if pa <= pb and pa <= pc else b if pb <= pc else c ) ) & 0xff
+        rows.append( line )
+        prev = line
+
+    rgba = []
+    for line in rows:
+        for x in range( width ):
+            px = line[ x * channels : ( x + 1 ) * channels ]
+            rgba.append( ( px[ 0 ], px[ 1 ], px[ 2 ], px[ 3 ] if channels == 4 else 0xff ) )
+    return width, height, rgba
+
+def convert_rgba( rgba ):
+    """ build the pixel lists for all color depth sections like the lvgl image converter does """
+    sections = []
+    for _, _, size in SECTIONS:
+        sections.append( [] )
+    for r, g, b, a in rgba:
+        c8 = ( r & 0xe0 ) | ( ( g & 0xe0 ) >> 3 ) | ( b >> 6 )
+        c16 = ( ( r & 0xf8 ) << 8 ) | ( ( g & 0xfc ) << 3 ) | ( b >> 3 )
+        sections[ 0 ].append( bytes( ( c8, a ) ) )
+        sections[ 1 ].append( bytes( ( c16 & 0xff, c16 >> 8, a ) ) )
+        sections[ 2 ].append( bytes( ( c16 >> 8, c16 & 0xff, a ) ) )
+        sections[ 3 ].append( bytes( ( b, g, r, a ) ) )
+    return sections
+
+def read_c_array( filename ):
+    with open( filename ) as f:
+        source = f.read()
+    if "LV_IMG_CF_TRUE_COLOR_ALPHA" not in source:
+        return None
+
+    width = int( re.search( r"\.header\.w\s*=\s*(\d+)", source ).group( 1 ) )
+    height = int( re.search( r"\.header\.h\s*=\s*(\d+)", source ).group( 1 ) )
+    sections = []
+    for condition, _, size in SECTIONS:
+        block = re.search( r"#if " + re.escape( condition ) + r"\n(.*?)#endif", source, re.S )
+        data = bytes( int( value, 16 ) for value in re.findall( r"0x([0-9a-fA-F]{2})", block.group( 1 ) ) )
+        if len( data ) != width * height * size:
+            sys.exit( "%s: %s has %d bytes, expected %d" % ( filename, condition, len( data ), width * height * size ) )
+        sections.append( [ data[ i : i + size ] for i in range( 0, len( data ), size ) ] )
+    return width, height, sections
+
+def rle_encode( pixel ):
+    """ PackBits like runs, the color of fully transparent pixel is don't care """
+    size = len( pixel[ 0 ] )
+    pixel = [ px if px[ -1 ] else bytes( size ) for px in pixel ]
+    out = bytearray( IMG_DECODER_RLE_MAGIC )
+    literal = []
+
+    def flush():
+        while literal:
+            count = min( len( literal ), 128 )
+            out.append( count - 1 )
+            for px in literal[ :count ]:
+                out.extend( px )
+            del literal[ :count ]
+
+    pos = 0
+    while pos < len( pixel ):
+        run = 1
+        while pos + run < len( pixel ) and run < 128 and pixel[ pos + run ] == pixel[ pos ]:
+            run += 1
+        if run > 1:
+            flush()
+            out.append( 0x80 | ( run - 1 ) )
+            out += pixel[ pos ]
+        else:
+            literal.append( pixel[ pos ] )
+        pos += run
+    flush()
+    return bytes( out )
+
+def format_bytes( data ):
+    lines = []
+    for pos in range( 0, len( data ), 32 ):
+        lines.append( "  " + "".join( "0x%02x, " % value for value in data[ pos : pos + 32 ] ) )
+    return "\n".join( lines )
+
+def write_c_file( filename, name, width, height, encoded, alias ):
+    attribute = "LV_ATTRIBUTE_IMG_" + name.upper()
+    out = []
+    out.append( '#include "lvgl/lvgl.h"\n' )
+    if alias is None:
+        out.append( "#ifndef LV_ATTRIBUTE_MEM_ALIGN\n#define LV_ATTRIBUTE_MEM_ALIGN\n#endif\n" )
+        out.append( "#ifndef %s\n#define %s\n#endif\n" % ( attribute, attribute ) )
+        out.append( "const LV_ATTRIBUTE_MEM_ALIGN %s uint8_t %s_map[] = {" % ( attribute, name ) )
+        for ( condition, comment, _ ), data in zip( SECTIONS, encoded ):
+            out.append( "#if %s\n  /*%s, run length compressed*/\n%s\n#endif" % ( condition, comment, format_bytes( data ) ) )
+        out.append( "};\n" )
+        data_name = name + "_map"
+        data_size = "sizeof( %s_map )" % name
+    else:
+        out.append( "/* same pixel data as %s, see tools/img2lvgl.py */" % alias )
+        out.append( "extern const uint8_t %s_map[];\n" % alias )
+        for pos, ( ( condition, _, _ ), data ) in enumerate( zip( SECTIONS, encoded ) ):
+            out.append( "#%s %s\n#define %s_DATA_SIZE %d" % ( "if" if pos == 0 else "elif", condition, name.upper(), len( data ) ) )
+        out.append( "#endif\n" )
+        data_name = alias + "_map"
+        data_size = name.upper() + "_DATA_SIZE"
+    out.append( "const lv_img_dsc_t %s = {" % name )
+    out.append( "  .header.always_zero = 0," )
+    out.append( "  .header.w = %d," % width )
+    out.append( "  .header.h = %d," % height )
+    out.append( "  .data_size = %s," % data_size )
+    out.append( "  .header.cf = LV_IMG_CF_RAW_ALPHA," )
+    out.append( "  .data = %s," % data_name )
+    out.append( "};\n" )
+    with open( filename, "w" ) as f:
+        f.write( "\n".join( out ) )
+
+def main():
+    if len( sys.argv ) < 2:
+        sys.exit( "usage: %s image.png|image.c [...]" % sys.argv[ 0 ] )
+
+    known = {}
+    raw_total = 0
+    compressed_total = 0
+    for source in sys.argv[ 1: ]:
+        base, ext = os.path.splitext( source )
+        name = os.path.basename( base )
+        if ext.lower() == ".png":
+            width, height, rgba = read_png( source )
+            sections = convert_rgba( rgba )
+        else:
+            image = read_c_array( source )
+            if image is None:
+                print( "%s: not a true color alpha image, skipped" % source )
+                continue
+            width, height, sections = image
+
+        encoded = [ rle_encode( pixel ) for pixel in sections ]
+        digest = hashlib.sha1( struct.pack( "<HH", width, height ) + b"".join( encoded ) ).hexdigest()
+        alias = known.setdefault( digest, name )
+        if alias == name:
+            alias = None
+
+        write_c_file( base + ".c", name, width, height, encoded, alias )
+        raw_total += width * height * 3
+        compressed_total += 0 if alias else len( encoded[ 1 ] )
+        print( "%s: %dx%d, %d -> %d bytes%s" % ( base + ".c", width, height, width * height * 3, len( encoded[ 1 ] ), ", alias of " + alias if alias else "" ) )
+
+    print( "total (16 bit): %d -> %d bytes" % ( raw_total, compressed_total ) )
+
+if __name__ == "__main__":
+    main()
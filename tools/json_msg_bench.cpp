@@ -0,0 +1,180 @@
+/****************************************************************************
+ *   Nov 05 08:21:37 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host benchmark of the gadgetbridge message decode, frames from captures are decoded
+ * in place like json_msg_decode() does, once with the filter of their message type and
+ * once without, reports time and arena usage per message type
+ *
+ * captures are raw byte streams like for tools/gadgetbridge_replay.cpp. ArduinoJson is
+ * header only, pio installs it with the lib_deps of the watch
+ *
+ * build: g++ -O2 -I src -I .pio/libdeps/ttgo-t-watch/ArduinoJson/src -o json_msg_bench tools/json_msg_bench.cpp src/hardware/gadgetbridge_frame.cpp
+ * usage: json_msg_bench capture.bin [capture.bin ...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include <ArduinoJson.h>
+#include "hardware/gadgetbridge_frame.h"
+
+#define BENCH_DOC_SIZE          4096        // same as JSON_MSG_DOC_SIZE
+#define BENCH_FRAME_SIZE        8192        // same as GADGETBRIDGE_MAX_FRAME_SIZE
+#define BENCH_MIN_TIME          0.5         // seconds each decode mode is repeated at least
+
+typedef struct {
+    uint32_t frames;
+    uint32_t failed[ 2 ];
+    size_t memory_max[ 2 ];
+    double time[ 2 ];                       // seconds per decode
+} bench_type_t;
+
+static std::vector<std::string> bench_frames;
+
+static double bench_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( ts.tv_sec + ts.tv_nsec / 1e9 );
+}
+
+static void bench_frame( char *frame, size_t len ) {
+    bench_frames.push_back( std::string( frame, len ) );
+}
+
+static bool bench_read( const char *filename, gadgetbridge_frame_t *framer ) {
+    FILE *f = fopen( filename, "rb" );
+    uint8_t data[ 4096 ];
+    size_t len;
+
+    if ( f == NULL ) {
+        perror( filename );
+        return( false );
+    }
+    while ( ( len = fread( data, 1, sizeof( data ), f ) ) > 0 ) {
+        gadgetbridge_frame_feed( framer, data, len );
+    }
+    fclose( f );
+    return( true );
+}
+
+int main( int argc, char **argv ) {
+    static char frame_buffer[ BENCH_FRAME_SIZE ];
+    static char work[ BENCH_FRAME_SIZE ];
+    gadgetbridge_frame_t framer;
+    StaticJsonDocument<256> filter[ GADGETBRIDGE_MSG_NUM ];
+    bench_type_t type[ GADGETBRIDGE_MSG_NUM + 1 ];     // last one for unknown types
+    DynamicJsonDocument doc( BENCH_DOC_SIZE );
+
+    if ( argc < 2 ) {
+        fprintf( stderr, "usage: %s capture.bin [capture.bin ...]\n", argv[ 0 ] );
+        return( 1 );
+    }
+
+    gadgetbridge_frame_init( &framer, frame_buffer, sizeof( frame_buffer ), bench_frame );
+    for ( int i = 1 ; i < argc ; i++ ) {
+        if ( !bench_read( argv[ i ], &framer ) ) {
+            return( 1 );
+        }
+    }
+    if ( bench_frames.empty() ) {
+        fprintf( stderr, "no frames found\n" );
+        return( 1 );
+    }
+
+    /*
+     * same filters as gadgetbridge_setup()
+     */
+    for ( int i = 0 ; i < GADGETBRIDGE_MSG_NUM ; i++ ) {
+        for ( int field = 0 ; gadgetbridge_msg[ i ].fields[ field ] != NULL ; field++ ) {
+            filter[ i ][ gadgetbridge_msg[ i ].fields[ field ] ] = true;
+        }
+    }
+    memset( type, 0, sizeof( type ) );
+
+    /*
+     * type scan alone
+     */
+    uint64_t scans = 0;
+    int checksum = 0;
+    double start = bench_now();
+    double scan_time = 0;
+    do {
+        for ( size_t f = 0 ; f < bench_frames.size() ; f++, scans++ ) {
+            checksum += gadgetbridge_frame_msg( bench_frames[ f ].c_str() );
+        }
+        scan_time = bench_now() - start;
+    } while ( scan_time < BENCH_MIN_TIME );
+
+    /*
+     * decode every frame with and without filter, the frame is copied first since the decode is in place
+     */
+    for ( size_t f = 0 ; f < bench_frames.size() ; f++ ) {
+        const std::string &frame = bench_frames[ f ];
+        int msg = gadgetbridge_frame_msg( frame.c_str() );
+        bench_type_t *t = &type[ msg >= 0 ? msg : GADGETBRIDGE_MSG_NUM ];
+
+        t->frames++;
+        for ( int mode = 0 ; mode < 2 ; mode++ ) {
+            bool filtered = mode == 0 && msg >= 0;
+            uint64_t rounds = 0;
+            DeserializationError error;
+
+            start = bench_now();
+            double elapsed = 0;
+            do {
+                memcpy( work, frame.c_str(), frame.size() + 1 );
+                if ( filtered ) {
+                    error = deserializeJson( doc, work, frame.size(), DeserializationOption::Filter( filter[ msg ] ) );
+                }
+                else {
+                    error = deserializeJson( doc, work, frame.size() );
+                }
+                rounds++;
+                elapsed = bench_now() - start;
+            } while ( elapsed < BENCH_MIN_TIME / bench_frames.size() );
+
+            t->time[ mode ] += elapsed / rounds;
+            if ( error ) {
+                t->failed[ mode ]++;
+            }
+            if ( doc.memoryUsage() > t->memory_max[ mode ] ) {
+                t->memory_max[ mode ] = doc.memoryUsage();
+            }
+            doc.clear();
+        }
+    }
+
+    printf( "%-12s %7s %10s %10s %8s %8s %7s %7s\n", "type", "frames", "filter/us", "full/us", "filter/B", "full/B", "failed", "full" );
+    for ( int i = 0 ; i <= GADGETBRIDGE_MSG_NUM ; i++ ) {
+        bench_type_t *t = &type[ i ];
+        if ( t->frames == 0 ) {
+            continue;
+        }
+        printf( "%-12s %7u %10.2f %10.2f %8zu %8zu %7u %7u\n", i < GADGETBRIDGE_MSG_NUM ? gadgetbridge_msg[ i ].type : "(unknown)", t->frames,
+                t->time[ 0 ] * 1e6 / t->frames, t->time[ 1 ] * 1e6 / t->frames, t->memory_max[ 0 ], t->memory_max[ 1 ], t->failed[ 0 ], t->failed[ 1 ] );
+    }
+    printf( "type scan %.3f us per frame, arena %d bytes (checksum %d)\n", scan_time * 1e6 / scans, BENCH_DOC_SIZE, checksum );
+    return( 0 );
+}
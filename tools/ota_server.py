@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+#
+# serve a firmware image for the http ota with Range support and drop the
+# connection at random points to test the download resume, see
+# src/hardware/http_ota.h
+#
+# usage: ota_server.py firmware.bin [port] [drop probability per 4k block]
+#
+# point the "host" and "file" entries of the version json to http://<pc>:<port> and /firmware.bin
+#
+import hashlib
+import http.server
+import os
+import random
+import re
+import sys
+
+BLOCK_SIZE = 4096
+
+class OtaHandler( http.server.BaseHTTPRequestHandler ):
+    protocol_version = "HTTP/1.1"
+
+    def do_GET( self ):
+        with open( self.server.firmware, "rb" ) as f:
+            data = f.read()
+
+        start = 0
+        match = re.match( r"bytes=(\d+)-$", self.headers.get( "Range", "" ) )
+        if match:
+            start = int( match.group( 1 ) )
+            if start >= len( data ):
+                self.send_response( 416 )
+                self.send_header( "Content-Range", "bytes */%d" % len( data ) )
+                self.send_header( "Content-Length", "0" )
+                self.end_headers()
+                return
+            self.send_response( 206 )
+            self.send_header( "Content-Range", "bytes %d-%d/%d" % ( start, len( data ) - 1, len( data ) ) )
+        else:
+            self.send_response( 200 )
+        self.send_header( "Content-Type", "application/octet-stream" )
+        self.send_header( "Content-Length", str( len( data ) - start ) )
+        self.end_headers()
+
+        for pos in range( start, len( data ), BLOCK_SIZE ):
+            if random.random() < self.server.drop:
+                cut = random.randrange( BLOCK_SIZE )
+                self.wfile.write( data[ pos : pos + cut ] )
+                self.log_message( "drop connection at %d", pos + cut )
+                self.close_connection = True
+                return
+            self.wfile.write( data[ pos : pos + BLOCK_SIZE ] )
+
+def main():
+    if len( sys.argv ) < 2:
+        sys.exit( "usage: %s firmware.bin [port] [drop probability]" % sys.argv[ 0 ] )
+
+    server = http.server.ThreadingHTTPServer( ( "", int( sys.argv[ 2 ] ) if len( sys.argv ) > 2 else 8080 ), OtaHandler )
+    server.firmware = sys.argv[ 1 ]
+    server.drop = float( sys.argv[ 3 ] ) if len( sys.argv ) > 3 else 0.01
+    with open( server.firmware, "rb" ) as f:
+        data = f.read()
+    print( "%s: %d bytes, md5 %s, drop probability %.3f per block" % ( server.firmware, len( data ), hashlib.md5( data ).hexdigest(), server.drop ) )
+    server.serve_forever()
+
+if __name__ == "__main__":
+    main()
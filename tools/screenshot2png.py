@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+#
+# convert a compressed screenshot from http://x.x.x.x/shot into png,
+# see src/gui/screenshot.h for the format
+#
+# usage: screenshot2png.py screen.rle screen.png
+#
+import struct
+import sys
+import zlib
+
+HEADER = struct.Struct("<4sHH")
+SCREENSHOT_RLE_MAGIC = b"R565"
+
+def decode( data ):
+    if len( data ) < HEADER.size:
+        sys.exit( "file too short" )
+
+    magic, width, height = HEADER.unpack_from( data, 0 )
+    if magic != SCREENSHOT_RLE_MAGIC:
+        sys.exit( "bad magic %r" % magic )
+
+    pixel = []
+    pos = HEADER.size
+    while pos < len( data ) and len( pixel ) < width * height:
+        control = data[ pos ]
+        pos += 1
+        if control & 0x80:
+            value, = struct.unpack_from( "<H", data, pos )
+            pixel.extend( [ value ] * ( ( control & 0x7f ) + 1 ) )
+            pos += 2
+        else:
+            count = control + 1
+            pixel.extend( struct.unpack_from( "<%dH" % count, data, pos ) )
+            pos += count * 2
+
+    if len( pixel ) < width * height:
+        sys.exit( "image truncated, %d of %d pixel" % ( len( pixel ), width * height ) )
+
+    return width, height, pixel
+
+def rgb565( value ):
+    r = ( value >> 11 ) & 0x1f
+    g = ( value >> 5 ) & 0x3f
+    b = value & 0x1f
+    return bytes( ( r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2 ) )
+
+def write_png( filename, width, height, pixel ):
+    def chunk( tag, payload ):
+        return struct.pack( ">I", len( payload ) ) + tag + payload + struct.pack( ">I", zlib.crc32( tag + payload ) & 0xffffffff )
+
+    raw = bytearray()
+    for y in range( height ):
+        raw.append( 0 )
+        for x in range( width ):
+            raw += rgb565( pixel[ y * width + x ] )
+
+    with open( filename, "wb" ) as f:
+        f.write( b"\x89PNG\r\n\x1a\n" )
+        f.write( chunk( b"IHDR", struct.pack( ">IIBBBBB", width, height, 8, 2, 0, 0, 0 ) ) )
+        f.write( chunk( b"IDAT", zlib.compress( bytes( raw ), 9 ) ) )
+        f.write( chunk( b"IEND", b"" ) )
+
+if __name__ == "__main__":
+    if len( sys.argv ) != 3:
+        sys.exit( "usage: %s screen.rle screen.png" % sys.argv[0] )
+
+    with open( sys.argv[1], "rb" ) as f:
+        width, height, pixel = decode( f.read() )
+    write_png( sys.argv[2], width, height, pixel )
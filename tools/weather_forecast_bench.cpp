@@ -0,0 +1,128 @@
+/****************************************************************************
+ *   Nov 06 09:14:52 2020
+ *   Copyright  2020  Dirk Brosswick
+ *   Email: dirk.brosswick@googlemail.com
+ ****************************************************************************/
+ 
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+/*
+ * host benchmark of the weather forecast decode, recorded openweathermap forecast
+ * responses are decoded with the same filter and document size as weather_forecast_parse(),
+ * once with the filter and once without, reports time and memoryUsage() per response
+ *
+ * record a response with the url from weather_fetch_forecast(), cnt must be WEATHER_MAX_FORECAST:
+ * curl -o forecast.json "http://api.openweathermap.org/data/2.5/forecast?cnt=16&lat=..&lon=..&appid=..&units=metric"
+ *
+ * ArduinoJson is header only, pio installs it with the lib_deps of the watch. build with
+ * -m32 (gcc-multilib) to get the 16 byte slots of the esp32, a 64 bit build reports more
+ *
+ * build: g++ -m32 -O2 -I src -I .pio/libdeps/ttgo-t-watch/ArduinoJson/src -o weather_forecast_bench tools/weather_forecast_bench.cpp src/app/weather/weather_filter.cpp
+ * usage: weather_forecast_bench forecast.json [forecast.json ...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include <ArduinoJson.h>
+#include "app/weather/weather_filter.h"
+
+#define BENCH_FULL_DOC_SIZE     65536       // unfiltered response
+#define BENCH_MIN_TIME          0.5         // seconds each decode mode is repeated at least
+
+static double bench_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return( ts.tv_sec + ts.tv_nsec / 1e9 );
+}
+
+static bool bench_read( const char *filename, std::string &response ) {
+    FILE *f = fopen( filename, "rb" );
+    char data[ 4096 ];
+    size_t len;
+
+    if ( f == NULL ) {
+        perror( filename );
+        return( false );
+    }
+    while ( ( len = fread( data, 1, sizeof( data ), f ) ) > 0 ) {
+        response.append( data, len );
+    }
+    fclose( f );
+    return( true );
+}
+
+int main( int argc, char **argv ) {
+    DynamicJsonDocument filter( WEATHER_FILTER_BUFFER_SIZE );
+    DynamicJsonDocument doc( WEATHER_FORECAST_BUFFER_SIZE );
+    DynamicJsonDocument full( BENCH_FULL_DOC_SIZE );
+    size_t memory_max = 0;
+    int failed = 0;
+
+    if ( argc < 2 ) {
+        fprintf( stderr, "usage: %s forecast.json [forecast.json ...]\n", argv[ 0 ] );
+        return( 1 );
+    }
+
+    weather_forecast_filter( filter );
+
+    printf( "%-24s %7s %10s %10s %8s %8s %s\n", "response", "bytes", "filter/us", "full/us", "filter/B", "full/B", "result" );
+    for ( int i = 1 ; i < argc ; i++ ) {
+        std::string response;
+        DeserializationError error[ 2 ];
+        double time[ 2 ];
+
+        if ( !bench_read( argv[ i ], response ) ) {
+            return( 1 );
+        }
+
+        /*
+         * a const input is copied into the document like the HTTPClient stream on the watch
+         */
+        for ( int mode = 0 ; mode < 2 ; mode++ ) {
+            uint64_t rounds = 0;
+            double start = bench_now();
+            double elapsed = 0;
+            do {
+                if ( mode == 0 ) {
+                    error[ mode ] = deserializeJson( doc, (const char *)response.c_str(), response.size(), DeserializationOption::Filter( filter ) );
+                }
+                else {
+                    error[ mode ] = deserializeJson( full, (const char *)response.c_str(), response.size() );
+                }
+                rounds++;
+                elapsed = bench_now() - start;
+            } while ( elapsed < BENCH_MIN_TIME );
+            time[ mode ] = elapsed / rounds;
+        }
+
+        if ( error[ 0 ] ) {
+            failed++;
+        }
+        if ( doc.memoryUsage() > memory_max ) {
+            memory_max = doc.memoryUsage();
+        }
+        printf( "%-24s %7zu %10.2f %10.2f %8zu %8zu %s\n", argv[ i ], response.size(), time[ 0 ] * 1e6, time[ 1 ] * 1e6, doc.memoryUsage(), full.memoryUsage(), error[ 0 ].c_str() );
+        doc.clear();
+        full.clear();
+    }
+
+    printf( "filter %zu bytes, max forecast %zu of %d bytes (%d%%), %d failed\n", filter.memoryUsage(), memory_max, WEATHER_FORECAST_BUFFER_SIZE, (int)( memory_max * 100 / WEATHER_FORECAST_BUFFER_SIZE ), failed );
+    return( failed ? 2 : 0 );
+}